@@ -0,0 +1,91 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABaseUtils.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADABU_THREADPOOL_H__
+#define __COLLADABU_THREADPOOL_H__
+
+#include "COLLADABUPrerequisites.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace COLLADABU
+{
+	/** A fixed number of worker threads that execute tasks in the order they have been added.*/
+	class ThreadPool
+	{
+	public:
+		/** A task executed by one of the worker threads.*/
+		typedef std::function<void()> Task;
+
+	private:
+		typedef std::deque<Task> TaskQueue;
+		typedef std::vector<std::thread> ThreadList;
+
+	private:
+		/** The worker threads.*/
+		ThreadList mThreads;
+
+		/** Tasks not yet taken by a worker thread.*/
+		TaskQueue mTasks;
+
+		/** Number of tasks added but not yet finished.*/
+		size_t mUnfinishedTaskCount;
+
+		/** True, if the worker threads should terminate.*/
+		bool mStop;
+
+		/** Guards all the members above.*/
+		std::mutex mMutex;
+
+		/** Signaled when a task has been added or the pool is stopped.*/
+		std::condition_variable mTaskAdded;
+
+		/** Signaled when the last unfinished task has been finished.*/
+		std::condition_variable mAllTasksFinished;
+
+	public:
+		/** Starts @a threadCount worker threads. If @a threadCount is 0, one thread per hardware thread
+		is started.*/
+		explicit ThreadPool( size_t threadCount = 0 );
+
+		/** Waits for all tasks to be finished and terminates the worker threads.*/
+		~ThreadPool();
+
+		/** Adds @a task to the queue. It is executed by the next idle worker thread.*/
+		void addTask( const Task& task );
+
+		/** Blocks until all added tasks have been finished.*/
+		void waitForAllTasks();
+
+		/** Returns the number of worker threads.*/
+		size_t getThreadCount() const { return mThreads.size(); }
+
+		/** Returns the number of threads the hardware can execute concurrently, at least 1.*/
+		static size_t getHardwareThreadCount();
+
+	private:
+		/** Executed by each worker thread.*/
+		void workerLoop();
+
+		/** Disable default copy ctor. */
+		ThreadPool( const ThreadPool& pre );
+		/** Disable default assignment operator. */
+		const ThreadPool& operator= ( const ThreadPool& pre );
+	};
+
+} // namespace COLLADABU
+
+#endif // __COLLADABU_THREADPOOL_H__
@@ -14,6 +14,8 @@
 #include "COLLADABUPrerequisites.h"
 #include "COLLADABUUtils.h"
 
+#include <atomic>
+
 
 namespace COLLADABU
 {
@@ -109,24 +111,54 @@ namespace COLLADABU
 		static const URI INVALID;
 
 	private:
-		/** Resolved version of the URI */
-		String mUriString;
-
-		/** Original URI before resolution */
-		String mOriginalURIString;
-
-		/** scheme component */
-		String mScheme;
-		/** authority component */
-		String mAuthority;
-		/** path component */
-		String mPath;
-		/** query component */
-		String mQuery;
-		/** fragment component */
-		String mFragment;
-		/** Indicates, if the URi is valid*/
-		bool mIsValid;
+		/** The strings of an URI. All URIs set from the same original string and resolved against the
+		same base data share one instance, which is looked up in an intern table by the original string
+		before anything is parsed. A shared instance is never modified.*/
+		struct Data
+		{
+			Data() : mIsValid(false), mHash(0), mBaseData(0), mKeyHash(0), mReferenceCount(1), mInterned(false) {}
+
+			/** Resolved version of the URI */
+			String mUriString;
+
+			/** Original URI before resolution */
+			String mOriginalURIString;
+
+			/** scheme component */
+			String mScheme;
+			/** authority component */
+			String mAuthority;
+			/** path component */
+			String mPath;
+			/** query component */
+			String mQuery;
+			/** fragment component */
+			String mFragment;
+			/** Indicates, if the URi is valid*/
+			bool mIsValid;
+
+			/** Hash of mUriString.*/
+			size_t mHash;
+
+			/** The data of the base URI mOriginalURIString has been resolved against, 0 if the 
+			resolution did not depend on a base URI. Holds a reference, so the address is not reused 
+			while this data is in the intern table.*/
+			Data* mBaseData;
+
+			/** Hash of mOriginalURIString and mBaseData, the key in the intern table.*/
+			size_t mKeyHash;
+
+			/** Number of URIs referencing this data.*/
+			std::atomic<size_t> mReferenceCount;
+
+			/** True, if the data is in the intern table.*/
+			bool mInterned;
+		};
+
+		struct InternTable;
+
+		/** The data of this URI. Never 0.*/
+		Data* mData;
 
 	public:
 		/**
@@ -179,7 +211,7 @@ namespace COLLADABU
 		URI();
 
 		/** Returns if the URi is valid.*/
-		bool isValid() const { return mIsValid; }
+		bool isValid() const { return mData->mIsValid; }
 
 		// Returns the fully resolved URI as a string
 		const String& getURIString() const;
@@ -238,12 +270,12 @@ namespace COLLADABU
 		String getPathExtension() const;      // URI("/folder/file.dae").getPathExtension() == ".dae"
 		String getPathFile() const;     // URI("/folder/file.dae").getPathFile() == "file.dae"
 
-		const String& getScheme() const { return mScheme;}
+		const String& getScheme() const { return mData->mScheme;}
 		const String& getProtocol() const { return getScheme();} // Alias for getScheme()
-		const String& getAuthority() const { return mAuthority; }
-		const String& getPath() const { return mPath; }
-		const String& getQuery() const { return mQuery; }
-		const String& getFragment() const { return mFragment; }
+		const String& getAuthority() const { return mData->mAuthority; }
+		const String& getPath() const { return mData->mPath; }
+		const String& getQuery() const { return mData->mQuery; } // Includes the leading '?', e.g. "?a=b"
+		const String& getFragment() const { return mData->mFragment; }
 		const String& getID() const { return getFragment(); } // Alias for getFragment()
 
 
@@ -283,14 +315,22 @@ namespace COLLADABU
 		URI getRelativeTo ( const URI& uri, bool& success, bool ignoreCase = false ) const;
 
 		/**
-		* Comparison operator.
+		* Comparison operator. URIs set from the same string share their data and are compared by
+		* pointer.
 		* @return Returns true if URI's are equal.
 		*/
 		inline bool operator==(const URI& other) const 
         {
-			return mUriString == other.mUriString;
+			return (mData == other.mData) || 
+				   ( (mData->mHash == other.mData->mHash) && (mData->mUriString == other.mData->mUriString) );
 		}
 
+		/** Returns the hash of the resolved URI string. It is calculated once, when the URI is set.*/
+		size_t getHash() const { return mData->mHash; }
+
+		/** Returns the number of distinct URIs currently in the intern table.*/
+		static size_t getInternedCount();
+
 		URI& operator=(const URI& other);
 		URI& operator=(const String& uri);
 
@@ -364,6 +404,30 @@ namespace COLLADABU
 		*/
 		void initialize();
 
+		/** Makes this URI reference @a data, of which the caller passes one reference.*/
+		void setData(Data* data);
+
+		/** Returns the data shared by all empty URIs.*/
+		static Data* getEmptyData();
+
+		/** Returns the table all URI data is interned in.*/
+		static InternTable& getInternTable();
+
+		/** Returns a reference to the data in the intern table set from the @a length characters at 
+		@a uriRef and resolved against @a baseData, 0 if there is none. @a keyHash is the hash of both.*/
+		static Data* findInterned(const char* uriRef, size_t length, const Data* baseData, size_t keyHash);
+
+		/** Inserts @a data in the intern table, unless an equal entry has been inserted meanwhile. 
+		Takes over the reference to @a data and returns a reference to the result.*/
+		static Data* intern(Data* data);
+
+		/** Returns true, if the @a length characters at @a uriRef start with a scheme, i.e. the
+		resolution of the URI does not depend on a base URI.*/
+		static bool hasScheme(const char* uriRef, size_t length);
+
+		/** Releases a reference to @a data and deletes it, if it was the last one.*/
+		static void release(Data* data);
+
 		/** Parses @a path and splits it in its components.*/
 		static void parsePath(const String& path,
 			/* out */ String& dir,
@@ -372,21 +436,24 @@ namespace COLLADABU
 
 
 
+        // Splits the @a length characters at @a uriRef in the components of RFC 3986, appendix B.
         // Returns true if parsing succeeded, false otherwise. 
-        // Parsing can fail if the uri reference isn't properly formed.
-		static bool parseUriRef(const String& uriRef,
+		static bool parseUriRef(const char* uriRef,
+			size_t length,
 			String& scheme,
 			String& authority,
 			String& path,
 			String& query,
 			String& fragment);
 
+		/** Parses @a uriRef, resolves it against @a baseURI and makes the result the data of this URI.*/
+		void setURI(const char* uriRef, size_t length, const URI* baseURI);
 
-		/** Checks if th eURI is valid.*/
-		void validate(const URI* baseURI);
+		/** Resolves the components of @a data against @a baseURI.*/
+		static void validate(Data& data, const URI* baseURI);
 
 		/** Checks if the URI is valid, i.e. it must have path or fragment*/
-		void validate();
+		static void validate(Data& data);
 
 		static String assembleUri(const String& scheme,
 			const String& authority,
@@ -395,8 +462,6 @@ namespace COLLADABU
 			const String& fragment,
 			bool forceLibxmlCompatible = false);
 
-		void setURI(String _URIString, const URI* baseURI);
-
     };
 
 
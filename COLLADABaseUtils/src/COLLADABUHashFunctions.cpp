@@ -57,7 +57,8 @@ namespace COLLADABU
 
 	size_t calculateHash( const URI& uri )
 	{
-		return calculateHash(uri.getURIString());
+		// calculated once, when the URI is set
+		return uri.getHash();
 	}
 
 
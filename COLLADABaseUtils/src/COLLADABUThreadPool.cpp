@@ -0,0 +1,100 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABaseUtils.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADABUStableHeaders.h"
+#include "COLLADABUThreadPool.h"
+
+
+namespace COLLADABU
+{
+
+	//--------------------------------------------------------------------
+	ThreadPool::ThreadPool( size_t threadCount )
+		: mUnfinishedTaskCount(0)
+		, mStop(false)
+	{
+		if ( threadCount == 0 )
+			threadCount = getHardwareThreadCount();
+
+		mThreads.reserve(threadCount);
+		for ( size_t i = 0; i < threadCount; ++i )
+			mThreads.push_back( std::thread( &ThreadPool::workerLoop, this ) );
+	}
+
+	//--------------------------------------------------------------------
+	ThreadPool::~ThreadPool()
+	{
+		waitForAllTasks();
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStop = true;
+		}
+		mTaskAdded.notify_all();
+
+		for ( ThreadList::iterator it = mThreads.begin(); it != mThreads.end(); ++it )
+			it->join();
+	}
+
+	//--------------------------------------------------------------------
+	void ThreadPool::addTask( const Task& task )
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mTasks.push_back(task);
+			++mUnfinishedTaskCount;
+		}
+		mTaskAdded.notify_one();
+	}
+
+	//--------------------------------------------------------------------
+	void ThreadPool::waitForAllTasks()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		while ( mUnfinishedTaskCount != 0 )
+			mAllTasksFinished.wait(lock);
+	}
+
+	//--------------------------------------------------------------------
+	size_t ThreadPool::getHardwareThreadCount()
+	{
+		size_t threadCount = std::thread::hardware_concurrency();
+		return threadCount == 0 ? 1 : threadCount;
+	}
+
+	//--------------------------------------------------------------------
+	void ThreadPool::workerLoop()
+	{
+		for ( ;; )
+		{
+			Task task;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				while ( !mStop && mTasks.empty() )
+					mTaskAdded.wait(lock);
+				if ( mTasks.empty() )
+					return;
+				task = mTasks.front();
+				mTasks.pop_front();
+			}
+
+			task();
+
+			bool allTasksFinished = false;
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				allTasksFinished = (--mUnfinishedTaskCount == 0);
+			}
+			if ( allTasksFinished )
+				mAllTasksFinished.notify_all();
+		}
+	}
+
+} // namespace COLLADABU
@@ -11,19 +11,15 @@
 #include "COLLADABUStableHeaders.h"
 #include "COLLADABUURI.h"
 #include "COLLADABUStringUtils.h"
-#include "COLLADABUPcreCompiledPattern.h"
 #include "COLLADABUHashFunctions.h"
 
 #include <algorithm>
-#include "pcre.h"
+#include <mutex>
+#include <unordered_map>
 
 namespace COLLADABU
 {
 
-
-	const int regExpMatchesVectorLength = 30;    /* should be a multiple of 3 */
-
-
 	const String URI::SCHEME_FILE = "file";
 	const String URI::SCHEME_HTTP = "http";
 	const String URI::SCHEME_HTTPS = "https";
@@ -130,34 +126,188 @@ namespace COLLADABU
 	}
 
 
-	void setStringFromMatches(String& matchString, const String& entireString, int *resultPositions, int index)
+	/** Number of independently locked parts of the intern table.*/
+	static const size_t INTERN_TABLE_SHARD_COUNT = 64;
+
+	/** The table all URI data is interned in, keyed by the hash of the original string and the base data.
+	It is split in shards, each guarded by its own mutex, so threads setting different URIs rarely wait
+	for each other. Entries are removed, when the last URI referencing them is destroyed.*/
+	struct URI::InternTable
+	{
+		typedef std::unordered_multimap<size_t, Data*> DataMap;
+
+		struct Shard
+		{
+			std::mutex mMutex;
+			DataMap mEntries;
+		};
+
+		Shard mShards[INTERN_TABLE_SHARD_COUNT];
+
+		Shard& getShard( size_t keyHash ) { return mShards[keyHash % INTERN_TABLE_SHARD_COUNT]; }
+	};
+
+	URI::InternTable& URI::getInternTable()
+	{
+		// never destroyed, since static URIs might be destroyed after it
+		static InternTable* internTable = new InternTable();
+		return *internTable;
+	}
+
+	URI::Data* URI::getEmptyData()
+	{
+		// the reference of the static is never released
+		static Data* emptyData = new Data();
+		return emptyData;
+	}
+
+	namespace
+	{
+		/** Hash of the key of URI data in the intern table.*/
+		size_t calculateKeyHash( const char* uriRef, size_t length, const void* baseData )
+		{
+			// FNV-1a, the string need not be null terminated
+			size_t hash = 2166136261u;
+			for ( size_t i = 0; i < length; ++i )
+				hash = ( hash ^ (unsigned char)uriRef[i] ) * 16777619u;
+			return hash ^ ( std::hash<const void*>()(baseData) + 0x9e3779b9 + (hash << 6) + (hash >> 2) );
+		}
+
+		/** Adds a reference to @a data, unless its last reference is being released. Returns false in
+		this case, the data must then not be referenced again.*/
+		template<class Data>
+		bool tryAddReference( Data* data )
+		{
+			size_t referenceCount = data->mReferenceCount.load(std::memory_order_relaxed);
+			while ( referenceCount != 0 )
+			{
+				if ( data->mReferenceCount.compare_exchange_weak(referenceCount, referenceCount + 1, std::memory_order_relaxed) )
+					return true;
+			}
+			return false;
+		}
+	}
+
+	URI::Data* URI::findInterned( const char* uriRef, size_t length, const Data* baseData, size_t keyHash )
+	{
+		InternTable::Shard& shard = getInternTable().getShard(keyHash);
+		std::lock_guard<std::mutex> lock(shard.mMutex);
+		std::pair<InternTable::DataMap::iterator, InternTable::DataMap::iterator> range = shard.mEntries.equal_range(keyHash);
+		for ( InternTable::DataMap::iterator it = range.first; it != range.second; ++it )
+		{
+			Data* internedData = it->second;
+			if ( internedData->mBaseData == baseData 
+				&& internedData->mOriginalURIString.length() == length
+				&& internedData->mOriginalURIString.compare(0, length, uriRef, length) == 0 )
+			{
+				return tryAddReference(internedData) ? internedData : 0;
+			}
+		}
+		return 0;
+	}
+
+	URI::Data* URI::intern( Data* data )
+	{
+		InternTable::Shard& shard = getInternTable().getShard(data->mKeyHash);
+		Data* internedData = 0;
+		{
+			std::lock_guard<std::mutex> lock(shard.mMutex);
+			std::pair<InternTable::DataMap::iterator, InternTable::DataMap::iterator> range = shard.mEntries.equal_range(data->mKeyHash);
+			InternTable::DataMap::iterator it = range.first;
+			for ( ; it != range.second; ++it )
+			{
+				if ( it->second->mBaseData == data->mBaseData && it->second->mOriginalURIString == data->mOriginalURIString )
+					break;
+			}
+			if ( it == range.second )
+			{
+				data->mInterned = true;
+				shard.mEntries.insert(std::make_pair(data->mKeyHash, data));
+				return data;
+			}
+
+			// another thread has interned the same URI after our lookup
+			internedData = it->second;
+			if ( !tryAddReference(internedData) )
+			{
+				// replace the entry, release() will not remove the new one
+				internedData->mInterned = false;
+				it->second = data;
+				data->mInterned = true;
+				return data;
+			}
+		}
+		release(data);
+		return internedData;
+	}
+
+	void URI::release( Data* data )
 	{
-		int& startPosition = resultPositions[2*index];
-		int& endPosition = resultPositions[2*index+1];
-		if ( startPosition >= 0)
+		if ( data->mReferenceCount.fetch_sub(1, std::memory_order_acq_rel) != 1 )
+			return;
+
 		{
-			matchString.assign( entireString, startPosition, endPosition - startPosition);
+			// intern() might replace the entry concurrently
+			InternTable::Shard& shard = getInternTable().getShard(data->mKeyHash);
+			std::lock_guard<std::mutex> lock(shard.mMutex);
+			if ( data->mInterned )
+			{
+				std::pair<InternTable::DataMap::iterator, InternTable::DataMap::iterator> range = shard.mEntries.equal_range(data->mKeyHash);
+				for ( InternTable::DataMap::iterator it = range.first; it != range.second; ++it )
+				{
+					if ( it->second == data )
+					{
+						shard.mEntries.erase(it);
+						break;
+					}
+				}
+			}
 		}
+		Data* baseData = data->mBaseData;
+		delete data;
+		if ( baseData )
+			release(baseData);
 	}
 
+	size_t URI::getInternedCount()
+	{
+		InternTable& internTable = getInternTable();
+		size_t count = 0;
+		for ( size_t i = 0; i < INTERN_TABLE_SHARD_COUNT; ++i )
+		{
+			std::lock_guard<std::mutex> lock(internTable.mShards[i].mMutex);
+			count += internTable.mShards[i].mEntries.size();
+		}
+		return count;
+	}
+
+	void URI::setData( Data* data )
+	{
+		Data* oldData = mData;
+		mData = data;
+		release(oldData);
+	}
 
 	void URI::initialize()
 	{
-		reset();
+		mData = getEmptyData();
+		mData->mReferenceCount.fetch_add(1, std::memory_order_relaxed);
 	}
 
-	URI::~URI() { }
+	URI::~URI() 
+	{
+		release(mData);
+	}
 
 
 	URI::URI(const String& uriStr, bool nofrag)
-		: mIsValid(false)
 	{
 		initialize();
 
 		if (nofrag) {
 			size_t pos = uriStr.find_last_of('#');
 			if (pos != String::npos) {
-				set(uriStr.substr(0, pos));
+				set(uriStr.c_str(), pos);
 				return;
 			}
 		}
@@ -167,7 +317,6 @@ namespace COLLADABU
 
 
     URI::URI(const char* uriString)
-		: mIsValid(false)
 	{
 		initialize();
         if (uriString) {
@@ -177,7 +326,6 @@ namespace COLLADABU
 
 
     URI::URI(const char* uriString, size_t length)
-		: mIsValid(false)
 	{
 		initialize();
         if (uriString && length > 0) {
@@ -187,7 +335,6 @@ namespace COLLADABU
 
 
     URI::URI( const String& path, const String& fragment )
-		: mIsValid(false)
 	{
 		initialize();
 		set("", "", path, "", fragment);
@@ -195,55 +342,40 @@ namespace COLLADABU
 
 
 	URI::URI()
-        : mIsValid( false)
 	{
 		initialize();
 	}
 
 	URI::URI(const URI& baseURI, const String& uriStr)
-		: mIsValid(false)
 	{
 		initialize();
 		set(uriStr, &baseURI);
 	}
 
 	URI::URI(const URI& copyFrom_, bool nofrag) 
-		: mIsValid(false)
 	{
-		initialize();
 		if (nofrag) {
+			initialize();
 			const String& uriStr = copyFrom_.getURIString();
 			size_t pos = uriStr.find_last_of('#');
 			if (pos != String::npos) {
-				set(uriStr.substr(0, pos));
+				set(uriStr.c_str(), pos);
 				return;
 			}
 			set(uriStr);
 		}
 		else
 		{
-			mUriString = copyFrom_.mUriString;
-			mOriginalURIString = copyFrom_.mOriginalURIString;
-			mScheme = copyFrom_.mScheme;
-			mAuthority = copyFrom_.mAuthority;
-			mPath = copyFrom_.mPath;
-			mQuery = copyFrom_.mQuery;
-			mFragment = copyFrom_.mFragment;
-			mIsValid = copyFrom_.mIsValid;
+			mData = copyFrom_.mData;
+			mData->mReferenceCount.fetch_add(1, std::memory_order_relaxed);
 		}
 	}
 
 	void URI::copyFrom(const URI& copyFrom)
 	{
-//		set(copyFrom.originalStr());
-		mUriString = copyFrom.mUriString;
-		mOriginalURIString = copyFrom.mOriginalURIString;
-		mScheme = copyFrom.mScheme;
-		mAuthority = copyFrom.mAuthority;
-		mPath = copyFrom.mPath;
-		mQuery = copyFrom.mQuery;
-		mFragment = copyFrom.mFragment;
-		mIsValid = copyFrom.mIsValid;
+		// the data is shared, it is never modified
+		copyFrom.mData->mReferenceCount.fetch_add(1, std::memory_order_relaxed);
+		setData(copyFrom.mData);
 	}
 
 	URI& URI::operator=(const URI& other) {
@@ -259,22 +391,18 @@ namespace COLLADABU
 	void URI::reset() 
 	{
 		// Clear everything 
-		mUriString.clear();
-		mOriginalURIString.clear();
-		mScheme.clear();
-		mAuthority.clear();
-		mPath.clear();
-		mQuery.clear();
-		mFragment.clear();
+		Data* emptyData = getEmptyData();
+		emptyData->mReferenceCount.fetch_add(1, std::memory_order_relaxed);
+		setData(emptyData);
 	}
 
 
 	const String& URI::getURIString() const {
-		return mUriString;
+		return mData->mUriString;
 	}
 
 	const String& URI::originalStr() const {
-		return mOriginalURIString;
+		return mData->mOriginalURIString;
 	}
 
 	void URI::parsePath(const String& path,
@@ -288,118 +416,99 @@ namespace COLLADABU
 			// in line with what path parsers in other libraries/languages do, and it
 			// more accurately reflects the intended structure of the file name.
 
-			// The following implementation cannot handle paths like this:
-			// /tmp/se.3/file
-
-			// regular expression: "(.*/)?(.*)?"
-			static const PcreCompiledPattern findDirCompiledPattern("(.*/)?(.*)?");
-
-			pcre* findDir = findDirCompiledPattern.getCompiledPattern();
-
-
-			// regular expression: "([^.]*)?(\.(.*))?"
-			static const PcreCompiledPattern findExtCompiledPattern("([^.]*)?(\\.(.*))?");
-			pcre* findExt = findExtCompiledPattern.getCompiledPattern();
-			
-			String tmpFile;
 			dir.clear();
 			baseName.clear();
 			extension.clear();
 
-			int dirMatches[regExpMatchesVectorLength];
-
-			int  dirResult = pcre_exec(
-										findDir,           /* the compiled pattern */
-										0,                 /* no extra data - we didn't study the pattern */
-										path.c_str(),      /* the subject string */
-										(int)path.size(),  /* the length of the subject */
-										0,                 /* start at offset 0 in the subject */
-										0,                 /* default options */
-										dirMatches,     /* output vector for substring information */
-										regExpMatchesVectorLength); /* number of elements in the output vector */
-
-			if ( dirResult >= 0 )
-			{	
-				setStringFromMatches(dir, path, dirMatches, 1);
-				setStringFromMatches(tmpFile, path, dirMatches, 2);
-
-				int extMatches[regExpMatchesVectorLength];
-
-				int  extResult = pcre_exec(
-											findExt,           /* the compiled pattern */
-											0,                 /* no extra data - we didn't study the pattern */
-											tmpFile.c_str(),      /* the subject string */
-											(int)tmpFile.size(),  /* the length of the subject */
-											0,                 /* start at offset 0 in the subject */
-											0,                 /* default options */
-											extMatches,     /* output vector for substring information */
-											regExpMatchesVectorLength); /* number of elements in the output vector */
-
-				
-				if ( extResult >= 0 )
-				{
-					setStringFromMatches(baseName, tmpFile, extMatches, 1);
-					setStringFromMatches(extension, tmpFile, extMatches, 3);
-				}
+			// dir is everything up to and including the last '/', the rest is the file, which is 
+			// split at its first '.' in base name and extension
+			size_t fileStart = path.rfind('/');
+			fileStart = (fileStart == String::npos) ? 0 : fileStart + 1;
+			dir.assign(path, 0, fileStart);
+
+			size_t extensionDot = path.find('.', fileStart);
+			if ( extensionDot == String::npos )
+			{
+				baseName.assign(path, fileStart, String::npos);
+			}
+			else
+			{
+				baseName.assign(path, fileStart, extensionDot - fileStart);
+				extension.assign(path, extensionDot + 1, String::npos);
 			}
 	}
 
-	void URI::set(const String& uriStr_, const URI* baseURI) {
-		// We make a copy of the uriStr so that set(mOriginalURIString, ...) works properly.
-		String uriStr = uriStr_;
-		reset();
-		mOriginalURIString = uriStr;
+	void URI::set(const String& uriStr, const URI* baseURI) {
+		setURI(uriStr.c_str(), uriStr.length(), baseURI);
+	}
 
-		if (!parseUriRef(uriStr, mScheme, mAuthority, mPath, mQuery, mFragment)) 
+    void URI::set(const char* uriStr, const URI* baseURI) {
+        setURI(uriStr, strlen(uriStr), baseURI);
+    }
+
+    void URI::set(const char* uriStr, size_t length, const URI* baseURI) {
+        setURI(uriStr, length, baseURI);
+    }
+
+	void URI::setURI(const char* uriRef, size_t length, const URI* baseURI) {
+		// Only relative references depend on the base URI. Its data is part of the key, since equal
+		// data is resolved equally.
+		Data* baseData = (baseURI && !hasScheme(uriRef, length)) ? baseURI->mData : 0;
+
+		// Nothing to do, if the URI is set to what it already is
+		if ( mData->mBaseData == baseData
+			&& mData->mOriginalURIString.length() == length
+			&& mData->mOriginalURIString.compare(0, length, uriRef, length) == 0 )
+			return;
+
+		size_t keyHash = calculateKeyHash(uriRef, length, baseData);
+		Data* data = findInterned(uriRef, length, baseData, keyHash);
+		if ( data )
 		{
+			setData(data);
+			return;
+		}
+
+		// The new data is built while the current one is still referenced, so that 
+		// set(originalStr(), ...) and baseURI == this work properly.
+		data = new Data();
+		data->mOriginalURIString.assign(uriRef, length);
+
+		if (!parseUriRef(data->mOriginalURIString.c_str(), length, data->mScheme, data->mAuthority, data->mPath, data->mQuery, data->mFragment)) 
+		{
+			delete data;
 			reset();
 			return;
 		}
-		else
+
+		data->mIsValid = true;
+		validate(*data, baseURI);
+		if ( data->mUriString.empty() && data->mOriginalURIString.empty() && !data->mIsValid )
+		{
+			// all empty URIs share one data
+			delete data;
+			reset();
+			return;
+		}
+		data->mHash = calculateHash(data->mUriString);
+		data->mKeyHash = keyHash;
+		if ( baseData )
 		{
-			mIsValid = true;
+			baseData->mReferenceCount.fetch_add(1, std::memory_order_relaxed);
+			data->mBaseData = baseData;
 		}
 
-		validate(baseURI);
+		setData(intern(data));
 	}
 
-    void URI::set(const char* uriStr_, const URI* baseURI) {
-        // We make a copy of the uriStr so that set(mOriginalURIString, ...) works properly.
-        String uriStr = uriStr_;
-        reset();
-        mOriginalURIString = uriStr;
-
-        if (!parseUriRef(uriStr, mScheme, mAuthority, mPath, mQuery, mFragment)) 
-        {
-            reset();
-            return;
-        }
-        else
-        {
-            mIsValid = true;
-        }
-
-        validate(baseURI);
-    }
-
-    void URI::set(const char* uriStr_, size_t length, const URI* baseURI) {
-        // We make a copy of the uriStr so that set(mOriginalURIString, ...) works properly.
-        String uriStr(uriStr_, length);
-        reset();
-        mOriginalURIString = uriStr;
-
-        if (!parseUriRef(uriStr, mScheme, mAuthority, mPath, mQuery, mFragment)) 
-        {
-            reset();
-            return;
-        }
-        else
-        {
-            mIsValid = true;
-        }
-
-        validate(baseURI);
-    }
+	bool URI::hasScheme(const char* uriRef, size_t length) {
+		// the same as the scheme in parseUriRef(): ([^:/?#]+):
+		const char* end = uriRef + length;
+		const char* schemeEnd = uriRef;
+		while ( schemeEnd != end && *schemeEnd != ':' && *schemeEnd != '/' && *schemeEnd != '?' && *schemeEnd != '#' )
+			++schemeEnd;
+		return schemeEnd != end && *schemeEnd == ':' && schemeEnd != uriRef;
+	}
 
 	void URI::set(const String& scheme_,
 		const String& authority_,
@@ -412,11 +521,11 @@ namespace COLLADABU
 	}
 
 
-	const String& URI::scheme() const { return mScheme; }
-	const String& URI::authority() const { return mAuthority; }
-	const String& URI::path() const { return mPath; }
-	const String& URI::query() const { return mQuery; }
-	const String& URI::fragment() const { return mFragment; }
+	const String& URI::scheme() const { return mData->mScheme; }
+	const String& URI::authority() const { return mData->mAuthority; }
+	const String& URI::path() const { return mData->mPath; }
+	const String& URI::query() const { return mData->mQuery; }
+	const String& URI::fragment() const { return mData->mFragment; }
 	const String& URI::id() const { return fragment(); }
 
 
@@ -427,30 +536,30 @@ namespace COLLADABU
 	}
 
 	void URI::pathComponents(String& dir, String& baseName, String& ext) const {
-		parsePath(mPath, dir, baseName, ext);
+		parsePath(mData->mPath, dir, baseName, ext);
 	}
 
 	String URI::getPathDir() const {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(mData->mPath, dir, base, ext);
 		return dir;
 	}
 
 	String URI::getPathFileBase() const {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(mData->mPath, dir, base, ext);
 		return base;
 	}
 
 	String URI::getPathExtension() const {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(mData->mPath, dir, base, ext);
 		return ext;
 	}
 
 	String URI::getPathFile() const {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(mData->mPath, dir, base, ext);
 		String pathFile = base;
 		if ( !ext.empty() )
 			pathFile += "." + ext;
@@ -472,35 +581,35 @@ namespace COLLADABU
 
 	void URI::setPathDir(const String& dir) {
 		String tmp, base, ext;
-		parsePath(mPath, tmp, base, ext);
+		parsePath(mData->mPath, tmp, base, ext);
 		setPath(addSlashToEnd(dir), base, ext);
 	}
 
 	void URI::setPathFileBase(const String& baseName) {
 		String dir, tmp, ext;
-		parsePath(mPath, dir, tmp, ext);
+		parsePath(mData->mPath, dir, tmp, ext);
 		setPath(dir, baseName, ext);
 	}
 
 	void URI::setPathExtension(const String& ext) 
 	{
 		String dir, base, tmp;
-		parsePath(mPath, dir, base, tmp);
+		parsePath(mData->mPath, dir, base, tmp);
 		setPath(dir, base, ext);
 	}
 
 	void URI::setPathFile(const String& file) {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(mData->mPath, dir, base, ext);
 		setPath(dir, file, "");
 	}
 
 
-	void URI::setScheme(const String& scheme_) { set(scheme_, mAuthority, mPath, mQuery, mFragment); };
-	void URI::setAuthority(const String& authority_) { set(mScheme, authority_, mPath, mQuery, mFragment); }
-	void URI::setPath(const String& path_) { set(mScheme, mAuthority, path_, mQuery, mFragment); }
-	void URI::setQuery(const String& query_) { set(mScheme, mAuthority, mPath, query_, mFragment); }
-	void URI::setFragment(const String& fragment_) { set(mScheme, mAuthority, mPath, mQuery, fragment_); }
+	void URI::setScheme(const String& scheme_) { set(scheme_, mData->mAuthority, mData->mPath, mData->mQuery, mData->mFragment); };
+	void URI::setAuthority(const String& authority_) { set(mData->mScheme, authority_, mData->mPath, mData->mQuery, mData->mFragment); }
+	void URI::setPath(const String& path_) { set(mData->mScheme, mData->mAuthority, path_, mData->mQuery, mData->mFragment); }
+	void URI::setQuery(const String& query_) { set(mData->mScheme, mData->mAuthority, mData->mPath, query_, mData->mFragment); }
+	void URI::setFragment(const String& fragment_) { set(mData->mScheme, mData->mAuthority, mData->mPath, mData->mQuery, fragment_); }
 	void URI::setId(const String& id) { setFragment(id); }
 
 
@@ -512,12 +621,12 @@ namespace COLLADABU
 		}
 	}
 
-	void URI::validate()
+	void URI::validate(Data& data)
 	{
-		mIsValid = !mPath.empty() || !mFragment.empty();
+		data.mIsValid = !data.mPath.empty() || !data.mFragment.empty();
 	}
 
-	void URI::validate(const URI* baseURI)
+	void URI::validate(Data& data, const URI* baseURI)
 	{
 		// If no base URI was supplied, use the container's document URI. If there's
 		// no container or the container doesn't have a doc URI, use the application
@@ -540,85 +649,85 @@ namespace COLLADABU
 		}
 */
 		// This is rewritten according to the updated rfc 3986
-		if (!mScheme.empty()) // if defined(R.scheme) then
+		if (!data.mScheme.empty()) // if defined(R.scheme) then
 		{
 			// Everything stays the same except path which we normalize
 			// T.scheme    = R.scheme;
 			// T.authority = R.authority;
 			// T.path      = remove_dot_segments(R.path);
 			// T.query     = R.query;
-			normalize(mPath);
+			normalize(data.mPath);
 		}
 		else
 		{
-			if (!mAuthority.empty()) // if defined(R.authority) then
+			if (!data.mAuthority.empty()) // if defined(R.authority) then
 			{
 				// Authority and query stay the same, path is normalized
 				// T.authority = R.authority;
 				// T.path      = remove_dot_segments(R.path);
 				// T.query     = R.query;
-				normalize(mPath);
+				normalize(data.mPath);
 			}
 			else
 			{
-				if (mPath.empty())  // if (R.path == "") then
+				if (data.mPath.empty())  // if (R.path == "") then
 				{
 					if ( baseURI )
 					{
 						// T.path = Base.path;
-						mPath = baseURI->mPath;
+						data.mPath = baseURI->mData->mPath;
 
 						//if defined(R.query) then
 						//   T.query = R.query;
 						//else
 						//   T.query = Base.query;
 						//endif;
-						if (mQuery.empty())
-							mQuery = baseURI->mQuery;
+						if (data.mQuery.empty())
+							data.mQuery = baseURI->mData->mQuery;
 					}
 				}
 				else
 				{
-					if (mPath[0] == '/')  // if (R.path starts-with "/") then
+					if (data.mPath[0] == '/')  // if (R.path starts-with "/") then
 					{
 						// T.path = remove_dot_segments(R.path);
-						normalize(mPath);
+						normalize(data.mPath);
 					}
 					else
 					{
 						// T.path = merge(Base.path, R.path);
 						if ( baseURI )
 						{
-							if (!baseURI->mAuthority.empty() && baseURI->mPath.empty()) // authority defined, path empty
+							if (!baseURI->mData->mAuthority.empty() && baseURI->mData->mPath.empty()) // authority defined, path empty
 							{
-								mPath.insert(0, "/");
+								data.mPath.insert(0, "/");
 							}
 							else 
 							{
 								String dir, baseName, ext;
-								parsePath(baseURI->mPath, dir, baseName, ext);
-								mPath = dir + mPath;
+								parsePath(baseURI->mData->mPath, dir, baseName, ext);
+								data.mPath = dir + data.mPath;
 							}
 							// T.path = remove_dot_segments(T.path);
-							normalize(mPath);
+							normalize(data.mPath);
 						}
 					}
 					// T.query = R.query;
 				}
 				// T.authority = Base.authority;
 				if ( baseURI )
-					mAuthority = baseURI->mAuthority;
+					data.mAuthority = baseURI->mData->mAuthority;
 			}
 			// T.scheme = Base.scheme;
 			if ( baseURI )
-				mScheme = baseURI->mScheme;
+				data.mScheme = baseURI->mData->mScheme;
 		}
 		// T.fragment = R.fragment;
 
 		// Reassemble all this into a String version of the URI
-		mUriString = assembleUri(mScheme, mAuthority, mPath, mQuery, mFragment);
+		data.mUriString = assembleUri(data.mScheme, data.mAuthority, data.mPath, data.mQuery, data.mFragment);
 
-		validate();
+		validate(data);
 	}
 
 
@@ -808,7 +917,7 @@ namespace COLLADABU
 	bool URI::makeRelativeTo ( const URI& relativeToURI, bool ignoreCase)
 	{
 		// Can only do this function if both URIs have the same scheme and authority
-		if (mScheme != relativeToURI.mScheme  ||  mAuthority != relativeToURI.mAuthority)
+		if (mData->mScheme != relativeToURI.mData->mScheme  ||  mData->mAuthority != relativeToURI.mData->mAuthority)
 			return false;
 
 		// advance till we find a segment that doesn't match
@@ -882,7 +991,7 @@ namespace COLLADABU
 		WideString thisSlashWideString(this_slash);
 		newPath += StringUtils::wideString2utf8String(thisSlashWideString);
 
-		set("", "", newPath, mQuery, mFragment, 0/*relativeToURI*/);
+		set("", "", newPath, mData->mQuery, mData->mFragment, 0/*relativeToURI*/);
 		return true;
 	}
 
@@ -896,55 +1005,73 @@ namespace COLLADABU
 
     //---------------------------------------------------------------
 	bool URI::parseUriRef (
-        const String& uriRef,
+        const char* uriRef,
+		size_t length,
 		String& scheme,
 		String& authority,
 		String& path,
 		String& query,
 		String& fragment) 
 	{
+		// Hand written equivalent of the regular expression for parsing URI references from the 
+		// URI spec:
+		//   http://tools.ietf.org/html/rfc3986#appendix-B
+		// regular expression: "^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\?([^#]*))?(#(.*))?"
+		// The components are located by their offsets and assigned once.
+		const char* pos = uriRef;
+		const char* end = uriRef + length;
 
 		// For performance reasons we treat the special case of an URI containing only a fragment
-		// separately, by checking if the uriRef starts with an "#" and treat the rest as
-		// the fragment
-		if ( !uriRef.empty() && uriRef[0] == '#')
+		// separately
+		if ( pos != end && *pos == '#' )
 		{
-			fragment.assign( uriRef, 1, uriRef.length() - 1 );
+			fragment.assign( pos + 1, end );
 			return true;
 		}
 
+		// scheme: ([^:/?#]+):
+		const char* schemeEnd = pos;
+		while ( schemeEnd != end && *schemeEnd != ':' && *schemeEnd != '/' && *schemeEnd != '?' && *schemeEnd != '#' )
+			++schemeEnd;
+		if ( schemeEnd != end && *schemeEnd == ':' && schemeEnd != pos )
+		{
+			scheme.assign( pos, schemeEnd );
+			pos = schemeEnd + 1;
+		}
 
-		// This regular expression for parsing URI references comes from the URI spec:
-		//   http://tools.ietf.org/html/rfc3986#appendix-B
-		// regular expression: "^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\?([^#]*))?(#(.*))?"
-		static const PcreCompiledPattern matchUriCompiledPattern("^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?");
-		pcre* matchUri = matchUriCompiledPattern.getCompiledPattern();
-
-
-		int uriMatches[regExpMatchesVectorLength];
-
-		int  uriResult = pcre_exec(
-									matchUri,					/* the compiled pattern */
-									0,							/* no extra data - we didn't study the pattern */
-									uriRef.c_str(),				/* the subject string */
-									(int)uriRef.size(),			/* the length of the subject */
-									0,							/* start at offset 0 in the subject */
-									0,							/* default options */
-									uriMatches,				/* output vector for substring information */
-									regExpMatchesVectorLength);		/* number of elements in the output vector */
+		// authority: //([^/?#]*)
+		if ( (end - pos) >= 2 && pos[0] == '/' && pos[1] == '/' )
+		{
+			pos += 2;
+			const char* authorityEnd = pos;
+			while ( authorityEnd != end && *authorityEnd != '/' && *authorityEnd != '?' && *authorityEnd != '#' )
+				++authorityEnd;
+			authority.assign( pos, authorityEnd );
+			pos = authorityEnd;
+		}
 
+		// path: [^?#]*
+		const char* pathEnd = pos;
+		while ( pathEnd != end && *pathEnd != '?' && *pathEnd != '#' )
+			++pathEnd;
+		path.assign( pos, pathEnd );
+		pos = pathEnd;
 
-		if ( uriResult >= 0 )
+		// query: (\?[^#]*), including the '?' as before
+		if ( pos != end && *pos == '?' )
 		{
-			setStringFromMatches(scheme, uriRef, uriMatches, 2);
-			setStringFromMatches(authority, uriRef, uriMatches, 4);
-			setStringFromMatches(path, uriRef, uriMatches, 5);
-			setStringFromMatches(query, uriRef, uriMatches, 6);
-			setStringFromMatches(fragment, uriRef, uriMatches, 9);
-			return true;
+			const char* queryEnd = pos + 1;
+			while ( queryEnd != end && *queryEnd != '#' )
+				++queryEnd;
+			query.assign( pos, queryEnd );
+			pos = queryEnd;
 		}
 
-		return false;
+		// fragment: #(.*)
+		if ( pos != end && *pos == '#' )
+			fragment.assign( pos + 1, end );
+
+		return true;
 	}
 
 	namespace {
@@ -995,8 +1122,10 @@ namespace COLLADABU
 			}
 			uriLength += path.length();
 
+			// the query component includes its '?', but callers of setQuery() might omit it
+			bool addQuestionMark = !query.empty() && query[0] != '?';
 			if (!query.empty())
-				uriLength += 1 /*"?"*/ + query.length();
+				uriLength += (addQuestionMark ? 1 : 0) /*"?"*/ + query.length();
 			if (!fragment.empty())
 				uriLength += 1 /*"#"*/ + fragment.length();
 
@@ -1033,8 +1162,9 @@ namespace COLLADABU
 			}
 			uri += path;
 
-			if (!query.empty())
-				uri += "?" + query;
+			if (addQuestionMark)
+				uri += '?';
+			uri += query;
 			if (!fragment.empty())
 				uri += "#" + fragment;
 
@@ -1065,15 +1195,15 @@ namespace COLLADABU
 //		parseUriRef(uriRef, scheme, authority, path, query, fragment);
 
 		// Make sure we have a file scheme URI, or that it doesn't have a scheme
-		if (!mScheme.empty()  &&  mScheme != "file")
+		if (!mData->mScheme.empty()  &&  mData->mScheme != "file")
 			return "";
 
 		String filePath;
-        String currentPath ( mPath );
+        String currentPath ( mData->mPath );
 
 		if (type == Utils::WINDOWS) {
-			if (!mAuthority.empty())
-				filePath += String("\\\\") + mAuthority; // UNC path
+			if (!mData->mAuthority.empty())
+				filePath += String("\\\\") + mData->mAuthority; // UNC path
 
 			// Replace two leading slashes with one leading slash, so that
 			// ///otherComputer/file.dae becomes //otherComputer/file.dae and
@@ -1106,7 +1236,7 @@ namespace COLLADABU
 
 	URI::operator size_t()const
 	{
-		return 	calculateHash( *this );
+		return 	mData->mHash;
 	}
 }
 
@@ -39,6 +39,7 @@
 #include "COLLADAFWGeometry.h"
 #include "COLLADAFWILoader.h"
 #include "COLLADAFWIWriter.h"
+#include "COLLADAFWIMeshStreamWriter.h"
 #include "COLLADAFWImage.h"
 #include "COLLADAFWImageSource.h"
 #include "COLLADAFWIndexList.h"
@@ -13,16 +13,21 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWArray.h"
+#include "COLLADAFWMemoryArena.h"
 #include <string.h>
 #include <cassert>
 #include <stdlib.h>
+#include <new>
 
 
 namespace COLLADAFW
 {
 	/**
 	Array template that simplifies handling of C-arrays.
-	The memory will be allocated with malloc, freed with free and resized with realloc.
+	The memory will be allocated with malloc, freed with free and resized with realloc. If a MemoryArena
+	is current on the calling thread, when the memory is allocated, it is taken from the arena instead
+	and the array is flagged with ARENA_MEMORY. Memory passed to setData() is expected to be allocated
+	with malloc, use takeData() to pass memory from one array to another.
 	Don't take this class for other data types then the primitives data types, because no
 	constructors and destructors will be called!
 	*/
@@ -40,7 +45,9 @@ namespace COLLADAFW
 			RELEASE_MEMORY					= 0x0001,
 			/** Keep the ownership of the data, when this array is assigned to another one, i.e.
 			it will release the memory on destruction, if the RELEASE_MEMORY flag is set.*/
-			KEEP_OWNERSHIP_ON_ASSIGNEMNT    = 0x0002
+			KEEP_OWNERSHIP_ON_ASSIGNEMNT    = 0x0002,
+			/** The memory has been allocated from a MemoryArena. Set by allocMemory() and takeData() only.*/
+			ARENA_MEMORY					= 0x0004
 		};
 
 		enum FlagCombinations
@@ -107,20 +114,30 @@ namespace COLLADAFW
 		/** Returns the C-style data array.*/
 		const Type* getData () const { return mData; }
 
-		/** Set the C-style data array.*/
+		/** Set the C-style data array. If the array releases its memory, @a data must have been
+		allocated with malloc.*/
 		void setData ( Type* data, const size_t count )
 		{
-			mData = data;
-			mCount = count;
-			mCapacity = count;
+			setData ( data, count, count );
 		}
 
-		/** Set the C-style data array and count.*/
+		/** Set the C-style data array and count. If the array releases its memory, @a data must have
+		been allocated with malloc.*/
 		void setData ( Type* data, const size_t count, const size_t capacity )
 		{
 			mData = data;
 			mCount = count;
 			mCapacity = capacity;
+			mFlags &= ~ARENA_MEMORY;
+		}
+
+		/** Takes the data of @a array, which yields its ownership. Unlike setData(), this keeps track of
+		memory allocated from a MemoryArena.*/
+		void takeData ( ArrayPrimitiveType<Type>& array )
+		{
+			setData ( array.mData, array.mCount, array.mCapacity );
+			mFlags |= ( array.mFlags & ARENA_MEMORY );
+			array.yieldOwnerShip();
 		}
 
 		/** Returns the number of elements in the array.*/
@@ -136,60 +153,113 @@ namespace COLLADAFW
 		/** The number of elements, for which is currently memory allocated. */
 		void setCapacity ( const size_t capacity ) { mCapacity = capacity; }
 
+		/** The maximum number of elements, whose size in bytes can be represented by size_t.*/
+		static size_t getMaxCapacity () { return ((size_t)-1) / sizeof (Type); }
+
 		/** Allocates memory for @a size elements of type DataType.
 		Must not be called more than once, without calling releaseMemory() in between.
 		The memory must be released using releaseMemory().
 		@param size The size of the array
-		@param flags Flags that allow to control, how the memory should be released.*/
-		void allocMemory ( size_t capacity, int flags = DEFAULT_ALLOC_FLAGS )
+		@param flags Flags that allow to control, how the memory should be released.
+		@return False, if the memory could not be allocated. The array is empty then.*/
+		bool allocMemory ( size_t capacity, int flags = DEFAULT_ALLOC_FLAGS )
 		{
+			bool success = true;
 			if ( capacity == 0 )
+			{
 				setData ( 0, 0, 0 );
+			}
+			else if ( capacity > getMaxCapacity() )
+			{
+				setData ( 0, 0, 0 );
+				success = false;
+			}
+			else if ( MemoryArena::getCurrentArena() )
+			{
+				Type* data = ( Type* ) ( MemoryArena::allocateBlock ( capacity * sizeof (Type) ) );
+				setData ( data, 0, data ? capacity : 0 );
+				if ( data )
+					mFlags |= ARENA_MEMORY;
+				success = ( data != 0 );
+			}
 			else
-				setData ( ( Type* ) ( malloc ( capacity * sizeof (Type) ) ), 0, capacity );
-			mFlags |= flags;
+			{
+				Type* data = ( Type* ) ( malloc ( capacity * sizeof (Type) ) );
+				setData ( data, 0, data ? capacity : 0 );
+				success = ( data != 0 );
+			}
+			mFlags |= ( flags & ~ARENA_MEMORY );
+			return success;
 		}
 
 		/** Releases the memory that has been allocated by allocateMemory().
 		Must not be called, if the memory has not been allocated by allocateMemory().*/
 		void releaseMemory ()
 		{
-			free ( mData );
+			if ( mFlags & ARENA_MEMORY )
+				MemoryArena::releaseBlock ( mData );
+			else
+				free ( mData );
 			setData ( 0, 0, 0 );
 		}
 
 		/**
 		* Increases the capacity of the array, if necessary, to ensure that it can hold at least
-		* the number of elements specified by the minimum capacity argument.
+		* the number of elements specified by the minimum capacity argument. The capacity grows
+		* geometrically, i.e. by at least half of the current capacity, such that appending elements
+		* one by one causes a logarithmic number of reallocations only.
 		* @param minCapacity the desired minimum capacity
+		* @return False, if the memory could not be allocated. The array is left unchanged then.
 		*/
-		void reallocMemory ( size_t minCapacity )
+		bool reallocMemory ( size_t minCapacity )
 		{
 			if ( minCapacity <= mCapacity)
-				return;
-			size_t newCapacity = ( mCapacity * 3 ) / 2 + 1;
-			if (newCapacity < minCapacity)
+				return true;
+			size_t newCapacity = mCapacity + mCapacity / 2 + 1;
+			if ( (newCapacity < minCapacity) || (newCapacity > getMaxCapacity()) )
 				newCapacity = minCapacity;
-			mCapacity = newCapacity;
+			return reserve ( newCapacity );
+		}
+
+		/**
+		* Increases the capacity of the array to exactly @a capacity elements, if it is smaller.
+		* Use this instead of reallocMemory(), if the final number of elements is known in advance.
+		* @param capacity the desired capacity
+		* @return False, if the memory could not be allocated. The array is left unchanged then.
+		*/
+		bool reserve ( size_t capacity )
+		{
+			if ( capacity <= mCapacity )
+				return true;
+			if ( capacity > getMaxCapacity() )
+				return false;
 
 			if ( mData )
 			{
-				mData = ( Type* ) realloc ( mData, mCapacity * sizeof ( Type ) );
-				if ( mCount > mCapacity )
-					mCount = mCapacity;
+				Type* data;
+				if ( mFlags & ARENA_MEMORY )
+					data = ( Type* ) MemoryArena::reallocateBlock ( mData, capacity * sizeof ( Type ) );
+				else
+					data = ( Type* ) realloc ( mData, capacity * sizeof ( Type ) );
+				// on failure the old memory is still valid and owned by the array
+				if ( !data )
+					return false;
+				mData = data;
+				mCapacity = capacity;
+				return true;
 			}
 			else
 			{
-				allocMemory(newCapacity, mFlags);
+				return allocMemory(capacity, mFlags);
 			}
 		}
 
 		/** Appends @a newValue to the end of array. If not enough memory was allocated, a resize
-		of the array will be done! */
+		of the array will be done! Throws std::bad_alloc, if the array could not be resized.*/
 		Type& append ( const Type& newValue )
 		{
-			if ( mCount >= mCapacity )
-				reallocMemory (mCount + 1);
+			if ( (mCount >= mCapacity) && !reallocMemory (mCount + 1) )
+				throw std::bad_alloc();
 
 			return mData [ mCount++ ] = newValue;
 		}
@@ -203,10 +273,11 @@ namespace COLLADAFW
 
 
 		/** Appends @a newValue to the end of array. If not enough memory was allocated,
-		a resize of the array will be done! */
+		a resize of the array will be done! Throws std::bad_alloc, if the array could not be resized.*/
 		ArrayPrimitiveType<Type>* appendValues ( const Type* data, size_t length  )
 		{
-			reallocMemory ( mCount + length );
+			if ( (length > getMaxCapacity() - mCount) || !reallocMemory ( mCount + length ) )
+				throw std::bad_alloc();
 
 			memcpy ( mData + mCount, data, length * sizeof (Type) );
 			mCount += length;
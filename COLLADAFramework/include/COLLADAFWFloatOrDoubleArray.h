@@ -95,6 +95,14 @@ namespace COLLADAFW
 		/** Set the C-style data array.*/
 		void setData( double* data, const size_t count );
 
+		/** Takes the data of @a valuesArray, which yields its ownership. Use this instead of setData(), 
+		if the data might have been allocated from a MemoryArena.*/
+		void takeData( FloatArray& valuesArray );
+
+		/** Takes the data of @a valuesArray, which yields its ownership. Use this instead of setData(), 
+		if the data might have been allocated from a MemoryArena.*/
+		void takeData( DoubleArray& valuesArray );
+
 		/** Appends the values of the input array to the end of values array.
 		The programmer must ensure, that the memory allocated,
 		was large enough to hold another element. No new memory is allocated.*/
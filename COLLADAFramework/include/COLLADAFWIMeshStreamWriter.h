@@ -0,0 +1,107 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_IMESHSTREAMWRITER_H__
+#define __COLLADAFW_IMESHSTREAMWRITER_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+
+namespace COLLADAFW
+{
+	class Mesh;
+	class MeshPrimitive;
+
+	/** Optional interface, a writer can implement in addition to IWriter, to receive meshes piece by
+	piece while they are parsed, instead of one complete Mesh in IWriter::writeGeometry(). The loader
+	does not hold the values of the mesh sources at all and only buffers the indices of the current
+	primitive up to a limit, which bounds the memory needed for large meshes.
+	For each mesh, beginMesh() is called first, followed by any number of writeMeshSourceData(),
+	writeMeshVertexData() and writeMeshPrimitive() calls, and endMesh() at last.
+	IWriter::writeGeometry() is not called for streamed meshes. Splines are still written with
+	IWriter::writeGeometry().
+	If a method returns false, loading is aborted.
+	All objects passed are deleted by the loader after the call returns.*/
+	class IMeshStreamWriter
+	{
+	public:
+		/** The vertex data arrays of a mesh.*/
+		enum VertexDataSemantic
+		{
+			POSITIONS,
+			NORMALS,
+			COLORS,
+			UV_COORDINATES,
+			TANGENTS,
+			BINORMALS,
+
+			VERTEX_DATA_SEMANTIC_COUNT
+		};
+
+	public:
+
+		/** Constructor. */
+		IMeshStreamWriter() {}
+
+		/** Destructor. */
+		virtual ~IMeshStreamWriter() {}
+
+		/** Called when a mesh starts.
+		@param mesh The mesh, with unique id, name and original id set. It does not contain vertex data or
+		primitives and is the same object that is passed to all following calls for this mesh.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool beginMesh( const Mesh* mesh ) = 0;
+
+		/** Called with the values of a float array of a source of the mesh, chunk by chunk, as they are
+		parsed. The vertex data array the values belong to is not known yet. It is passed to
+		writeMeshVertexData() as soon as the first primitive that uses the source is parsed.
+		@param mesh The mesh the source belongs to.
+		@param sourceId The id of the source.
+		@param values The next values of the source. They are only valid during the call.
+		@param valuesCount The number of values in @a values.
+		@param firstValueIndex Index of the first value in @a values within all values of the source.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool writeMeshSourceData( const Mesh* mesh, const String& sourceId, const float* values, size_t valuesCount, size_t firstValueIndex ) = 0;
+
+		/** Called, when the first primitive that uses a source of the mesh is parsed. The values of the
+		source, passed to writeMeshSourceData() before, are appended to the vertex data array
+		@a semantic of the mesh.
+		@param mesh The mesh the vertex data belongs to.
+		@param semantic The vertex data array of the mesh, the values of the source are appended to.
+		@param sourceId The id of the source.
+		@param stride The number of values per vertex.
+		@param valuesCount The number of values of the source.
+		@param firstValueIndex Index of the first value of the source within all values of @a semantic
+		of the mesh. The indices of the primitives refer to all values of a semantic.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool writeMeshVertexData( const Mesh* mesh, VertexDataSemantic semantic, const String& sourceId, size_t stride, size_t valuesCount, size_t firstValueIndex ) = 0;
+
+		/** Called with each completed primitive of the mesh. Triangles and lines elements with more
+		vertices than the loader is configured to buffer, are passed in several primitives, each with
+		the material of the element.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool writeMeshPrimitive( const Mesh* mesh, const MeshPrimitive* meshPrimitive ) = 0;
+
+		/** Called when the mesh is complete.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool endMesh( const Mesh* mesh ) = 0;
+
+	private:
+
+		/** Disable default copy ctor. */
+		IMeshStreamWriter( const IMeshStreamWriter& pre );
+
+		/** Disable default assignment operator. */
+		const IMeshStreamWriter& operator= ( const IMeshStreamWriter& pre );
+
+	};
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_IMESHSTREAMWRITER_H__
@@ -13,6 +13,9 @@
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWTypes.h"
+#include "COLLADAFWMemoryArena.h"
+
+#include <new>
 
 
 namespace COLLADAFW
@@ -61,6 +64,19 @@ namespace COLLADAFW
         size_t getInitialIndex () const { return mInitialIndex; }
         void setInitialIndex ( size_t val ) { mInitialIndex = val; }
 
+        /** Allocates index lists from the memory arena current on the calling thread, if any.*/
+        static void* operator new( size_t size )
+        {
+            void* indexList = MemoryArena::allocateBlock( size );
+            if ( !indexList )
+                throw std::bad_alloc();
+            return indexList;
+        }
+
+        /** Releases index lists allocated from the heap. Those allocated from a memory arena are released
+        with the arena.*/
+        static void operator delete( void* indexList ) { MemoryArena::releaseBlock( indexList ); }
+
     private:
 
         /** Disable default copy ctor. */
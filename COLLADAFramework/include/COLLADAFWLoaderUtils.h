@@ -14,18 +14,34 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWTypes.h"
 
+#include <atomic>
 #include <map>
+#include <mutex>
 
 namespace COLLADAFW
 {
-	/** This class provides utilities useful for most if the loaders.*/
+	/** This class provides utilities useful for most if the loaders.
+	The ObjectIds are taken from one atomic counter per ClassId, i.e. getLowestObjectIdFor() can be called
+	from several threads at the same time, without locks.*/
 	class LoaderUtils 	
 	{
+	public:
+		/** Number of ClassIds with a counter of their own. All ClassIds of COLLADA_TYPE are below.*/
+		static const size_t CLASS_ID_COUNT = COLLADA_TYPE::INSTANCE_KINEMATICS_SCENE + 1;
+
 	private:
+		typedef std::atomic<ObjectId> ObjectIdCounter;
+
 		typedef std::map<ClassId, ObjectId> ClassIdObjectIdMap;
 
-		/** Maps each ClassId to the lowest ObjectId, not already used for this type.*/
+		/** The lowest ObjectId, not already used for each ClassId below CLASS_ID_COUNT.*/
+		ObjectIdCounter mLowestObjectIds[CLASS_ID_COUNT];
+
+		/** Maps ClassIds not below CLASS_ID_COUNT to the lowest ObjectId, not already used for this type.*/
 		ClassIdObjectIdMap mLowestObjectIdMap;
+
+		/** Guards mLowestObjectIdMap.*/
+		std::mutex mLowestObjectIdMapMutex;
 	
 	public:
 		LoaderUtils();
@@ -0,0 +1,186 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_MEMORYARENA_H__
+#define __COLLADAFW_MEMORYARENA_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+#include <stddef.h>
+
+
+namespace COLLADAFW
+{
+
+	/** Memory from which framework objects and the storage of ArrayPrimitiveType are carved during a
+	load. Memory is taken from large chunks and is released all at once by release() or the destructor,
+	instead of object by object.
+	An arena is used by the thread, it has been made current on (see setCurrentArena()). All objects
+	derived from Object, all IndexLists and all memory allocated by ArrayPrimitiveType::allocMemory()
+	on that thread are then allocated from the arena. Deleting such an object or releasing such an
+	array does not free any memory. Arrays remember that their memory has been taken from an arena, so
+	memory allocated with malloc and passed to an array by ArrayPrimitiveType::setData() is still freed
+	with free, even while an arena is current.
+	The arena must outlive all objects allocated from it, including those deleted by the loader's
+	destructor, e.g. by letting the loader delete it (see COLLADASaxFWL::Loader::setMemoryArena()). 
+	Writers that need data beyond the lifetime of the arena have to copy it while no arena is current.*/
+	class MemoryArena
+	{
+	public:
+		/** Statistics to size an arena.*/
+		struct Statistics
+		{
+			Statistics();
+
+			/** Number of blocks allocated from the arena.*/
+			size_t allocationCount;
+
+			/** Number of blocks that have been reallocated.*/
+			size_t reallocationCount;
+
+			/** Number of reallocations that could be done without copying the block.*/
+			size_t inPlaceReallocationCount;
+
+			/** Number of bytes used within the chunks, including block headers and blocks left behind
+			by reallocations.*/
+			size_t usedBytes;
+
+			/** Number of bytes of all chunks.*/
+			size_t reservedBytes;
+
+			/** Number of chunks.*/
+			size_t chunkCount;
+
+			/** Size of the largest block allocated.*/
+			size_t largestAllocation;
+		};
+
+		/** Counts the calls of the block functions, regardless of the arena or heap used. Intended to
+		measure the number of allocations done by a load.*/
+		struct BlockStatistics
+		{
+			/** Number of calls of allocateBlock().*/
+			size_t allocationCount;
+
+			/** Number of calls of reallocateBlock() with a valid block.*/
+			size_t reallocationCount;
+		};
+
+		/** Makes an arena current on the calling thread for the lifetime of this object and restores
+		the previous one on destruction.*/
+		class ScopedCurrentArena
+		{
+		private:
+			MemoryArena* mPreviousArena;
+			bool mChanged;
+
+		public:
+			/** Makes @a arena current. If @a arena is 0, the current arena is not changed.*/
+			explicit ScopedCurrentArena( MemoryArena* arena );
+			~ScopedCurrentArena();
+
+		private:
+			/** Disable default copy ctor. */
+			ScopedCurrentArena( const ScopedCurrentArena& pre );
+			/** Disable default assignment operator. */
+			const ScopedCurrentArena& operator= ( const ScopedCurrentArena& pre );
+		};
+
+		/** Default size of the chunks.*/
+		static const size_t DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+	private:
+		struct Chunk;
+
+		/** The chunk new blocks are taken from. The other chunks are linked to it.*/
+		Chunk* mCurrentChunk;
+
+		/** The size of regular chunks. Blocks larger than a quarter of this get a chunk of their own.*/
+		size_t mChunkSize;
+
+		/** Position of the next free byte in mCurrentChunk.*/
+		char* mPosition;
+
+		/** End of mCurrentChunk.*/
+		char* mEnd;
+
+		/** The last block allocated from mCurrentChunk. It can be grown in place.*/
+		char* mLastBlock;
+
+		Statistics mStatistics;
+
+	public:
+
+		/** Constructor.
+		@param chunkSize Size of the chunks memory is reserved in.*/
+		explicit MemoryArena( size_t chunkSize = DEFAULT_CHUNK_SIZE );
+
+		/** Destructor. Releases all memory.*/
+		virtual ~MemoryArena();
+
+		/** Releases all memory allocated from the arena in one step and resets the statistics. Must
+		not be called, while objects allocated from the arena are still in use.*/
+		void release();
+
+		/** Returns the statistics of the arena since construction or the last call of release().*/
+		const Statistics& getStatistics() const { return mStatistics; }
+
+		/** Returns the size of the chunks memory is reserved in.*/
+		size_t getChunkSize() const { return mChunkSize; }
+
+		/** Returns the arena current on the calling thread, 0 if there is none.*/
+		static MemoryArena* getCurrentArena();
+
+		/** Makes @a arena current on the calling thread. 0 lets following allocations use the heap.
+		@return The previously current arena.*/
+		static MemoryArena* setCurrentArena( MemoryArena* arena );
+
+		/** Allocates a block of @a size bytes from the current arena or, if there is none, from the
+		heap. The block must be released by releaseBlock().*/
+		static void* allocateBlock( size_t size );
+
+		/** Resizes @a block, allocated by allocateBlock(), to @a size bytes. The content is preserved.
+		Blocks from an arena stay in that arena.*/
+		static void* reallocateBlock( void* block, size_t size );
+
+		/** Releases @a block, allocated by allocateBlock(). Blocks from an arena are only released
+		with the arena. 0 is ignored.*/
+		static void releaseBlock( void* block );
+
+		/** Returns the number of block function calls of all threads since the start of the program 
+		or the last call of resetBlockStatistics().*/
+		static BlockStatistics getBlockStatistics();
+
+		/** Resets the counters returned by getBlockStatistics().*/
+		static void resetBlockStatistics();
+
+	private:
+		/** Returns @a size bytes of memory from the chunks.*/
+		char* allocate( size_t size );
+
+		/** Resizes the memory at @a data of @a oldSize bytes to @a newSize bytes.*/
+		char* reallocate( char* data, size_t oldSize, size_t newSize );
+
+		/** Adds a chunk of @a size bytes. If @a makeCurrent is true or there is no chunk yet, the new
+		chunk becomes the one following blocks are taken from.
+		@return The memory of the chunk, 0 if it could not be allocated.*/
+		char* addChunk( size_t size, bool makeCurrent );
+
+		/** Disable default copy ctor. */
+		MemoryArena( const MemoryArena& pre );
+
+		/** Disable default assignment operator. */
+		const MemoryArena& operator= ( const MemoryArena& pre );
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_MEMORYARENA_H__
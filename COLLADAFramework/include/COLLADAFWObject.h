@@ -13,6 +13,9 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWUniqueId.h"
+#include "COLLADAFWMemoryArena.h"
+
+#include <new>
 
 
 namespace COLLADAFW
@@ -31,6 +34,19 @@ namespace COLLADAFW
 		/** Returns the unique id of the object.*/
 		virtual const UniqueId& getUniqueId() const = 0;
 
+		/** Allocates objects from the memory arena current on the calling thread, if any.*/
+		static void* operator new( size_t size )
+		{
+			void* object = MemoryArena::allocateBlock( size );
+			if ( !object )
+				throw std::bad_alloc();
+			return object;
+		}
+
+		/** Releases objects allocated from the heap. Those allocated from a memory arena are released
+		with the arena.*/
+		static void operator delete( void* object ) { MemoryArena::releaseBlock( object ); }
+
 	};
 
 
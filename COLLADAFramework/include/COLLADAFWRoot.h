@@ -21,6 +21,7 @@ namespace COLLADAFW
 	class IWriter;
 	class ILoader;
 	class UniqueId;
+	class MemoryArena;
 
 	/** The root class of the framework.*/
 	class Root 	
@@ -31,11 +32,22 @@ namespace COLLADAFW
 
 		/** The writer that writes the data.*/
 		IWriter* mWriter;
+
+		/** The arena the objects created during a load are allocated from, 0 to use the heap.*/
+		MemoryArena* mMemoryArena;
 	
 	public:
-		Root(ILoader* loader, IWriter* writer) : mLoader(loader), mWriter(writer){}
+		Root(ILoader* loader, IWriter* writer) : mLoader(loader), mWriter(writer), mMemoryArena(0){}
 		virtual ~Root();
 
+		/** Sets the arena, all framework objects and arrays created by the loader and the writer during
+		loadDocument() are allocated from. The arena is not released by the root. It must outlive the 
+		loader and every object allocated from it. 0 allocates them from the heap, which is the default.*/
+		void setMemoryArena( MemoryArena* memoryArena ) { mMemoryArena = memoryArena; }
+
+		/** Returns the arena set by setMemoryArena().*/
+		MemoryArena* getMemoryArena() const { return mMemoryArena; }
+
 		/** Loads @a fileName in to the model.
 		@returns True, if loading succeeded, false otherwise.*/
 		bool loadDocument(const String& fileName);
@@ -136,6 +136,24 @@ namespace COLLADAFW
 		}
 	}
 
+	//------------------------------
+	void FloatOrDoubleArray::takeData( FloatArray& valuesArray )
+	{
+		if ( mType == DATA_TYPE_FLOAT ) 
+		{
+			mValuesF.takeData( valuesArray );
+		}
+	}
+
+	//------------------------------
+	void FloatOrDoubleArray::takeData( DoubleArray& valuesArray )
+	{
+		if ( mType == DATA_TYPE_DOUBLE ) 
+		{
+			mValuesD.takeData( valuesArray );
+		}
+	}
+
 	//------------------------------
 	bool FloatOrDoubleArray::appendValues( const FloatArray& valuesArray )
 	{
@@ -16,6 +16,8 @@ namespace COLLADAFW
 	//--------------------------------------------------------------------
 	LoaderUtils::LoaderUtils()
 	{
+		for ( size_t i = 0; i < CLASS_ID_COUNT; ++i )
+			mLowestObjectIds[i].store( 0, std::memory_order_relaxed );
 	}
 	
 	//--------------------------------------------------------------------
@@ -23,8 +25,16 @@ namespace COLLADAFW
 	{
 	}
 
+	//--------------------------------------------------------------------
 	ObjectId LoaderUtils::getLowestObjectIdFor( ClassId classId )
 	{
+		if ( (size_t)classId < CLASS_ID_COUNT )
+		{
+			// only uniqueness is required, no ordering with other memory operations
+			return mLowestObjectIds[classId].fetch_add( 1, std::memory_order_relaxed );
+		}
+
+		std::lock_guard<std::mutex> lock( mLowestObjectIdMapMutex );
 		ClassIdObjectIdMap::iterator it = mLowestObjectIdMap.find(classId);
 		
 		if ( it == mLowestObjectIdMap.end() )
@@ -0,0 +1,290 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWMemoryArena.h"
+
+#include <atomic>
+
+#include <stdlib.h>
+#include <string.h>
+
+
+namespace COLLADAFW
+{
+
+	/** Alignment of all blocks. Sufficient for all types stored in the framework.*/
+	static const size_t ALIGNMENT = 16;
+
+	/** Header in front of each block returned by MemoryArena::allocateBlock().*/
+	union BlockHeader
+	{
+		struct
+		{
+			/** The arena the block has been allocated from, 0 if it has been allocated from the heap.*/
+			MemoryArena* arena;
+
+			/** The size of the block, without the header.*/
+			size_t size;
+		} info;
+
+		char alignment[ALIGNMENT];
+	};
+
+	/** Header at the beginning of each chunk.*/
+	struct MemoryArena::Chunk
+	{
+		/** The next chunk in the list of chunks.*/
+		Chunk* next;
+
+		/** Size of the memory following the header.*/
+		size_t size;
+	};
+
+	/** Size of the chunk header, rounded up to the alignment.*/
+	static const size_t CHUNK_HEADER_SIZE = ( ( sizeof(void*) + sizeof(size_t) + ALIGNMENT - 1 ) / ALIGNMENT ) * ALIGNMENT;
+
+	/** The arena current on this thread.*/
+	static thread_local MemoryArena* currentArena = 0;
+
+	/** Counters returned by MemoryArena::getBlockStatistics().*/
+	static std::atomic<size_t> blockAllocationCount(0);
+	static std::atomic<size_t> blockReallocationCount(0);
+
+	//------------------------------
+	static size_t alignSize( size_t size )
+	{
+		return ( size + ALIGNMENT - 1 ) & ~( ALIGNMENT - 1 );
+	}
+
+	//------------------------------
+	MemoryArena::Statistics::Statistics()
+		: allocationCount(0)
+		, reallocationCount(0)
+		, inPlaceReallocationCount(0)
+		, usedBytes(0)
+		, reservedBytes(0)
+		, chunkCount(0)
+		, largestAllocation(0)
+	{
+	}
+
+	//------------------------------
+	MemoryArena::ScopedCurrentArena::ScopedCurrentArena( MemoryArena* arena )
+		: mPreviousArena(0)
+		, mChanged(arena != 0)
+	{
+		if ( mChanged )
+			mPreviousArena = setCurrentArena(arena);
+	}
+
+	//------------------------------
+	MemoryArena::ScopedCurrentArena::~ScopedCurrentArena()
+	{
+		if ( mChanged )
+			setCurrentArena(mPreviousArena);
+	}
+
+	//------------------------------
+	MemoryArena::MemoryArena( size_t chunkSize )
+		: mCurrentChunk(0)
+		, mChunkSize( alignSize(chunkSize > ALIGNMENT ? chunkSize : ALIGNMENT) )
+		, mPosition(0)
+		, mEnd(0)
+		, mLastBlock(0)
+	{
+	}
+
+	//------------------------------
+	MemoryArena::~MemoryArena()
+	{
+		release();
+	}
+
+	//------------------------------
+	void MemoryArena::release()
+	{
+		Chunk* chunk = mCurrentChunk;
+		while ( chunk )
+		{
+			Chunk* next = chunk->next;
+			free(chunk);
+			chunk = next;
+		}
+		mCurrentChunk = 0;
+		mPosition = 0;
+		mEnd = 0;
+		mLastBlock = 0;
+		mStatistics = Statistics();
+	}
+
+	//------------------------------
+	MemoryArena* MemoryArena::getCurrentArena()
+	{
+		return currentArena;
+	}
+
+	//------------------------------
+	MemoryArena* MemoryArena::setCurrentArena( MemoryArena* arena )
+	{
+		MemoryArena* previousArena = currentArena;
+		currentArena = arena;
+		return previousArena;
+	}
+
+	//------------------------------
+	char* MemoryArena::addChunk( size_t size, bool makeCurrent )
+	{
+		Chunk* chunk = (Chunk*)malloc( CHUNK_HEADER_SIZE + size );
+		if ( !chunk )
+			return 0;
+		chunk->size = size;
+		mStatistics.reservedBytes += size;
+		mStatistics.chunkCount++;
+
+		char* data = (char*)chunk + CHUNK_HEADER_SIZE;
+		if ( makeCurrent || !mCurrentChunk )
+		{
+			chunk->next = mCurrentChunk;
+			mCurrentChunk = chunk;
+			mPosition = data;
+			mEnd = data + size;
+			mLastBlock = 0;
+		}
+		else
+		{
+			// linked behind the current chunk, which is still used for the following blocks
+			chunk->next = mCurrentChunk->next;
+			mCurrentChunk->next = chunk;
+		}
+		return data;
+	}
+
+	//------------------------------
+	char* MemoryArena::allocate( size_t size )
+	{
+		size = alignSize(size);
+		mStatistics.allocationCount++;
+		mStatistics.usedBytes += size;
+		if ( size > mStatistics.largestAllocation )
+			mStatistics.largestAllocation = size;
+
+		if ( size > mChunkSize / 4 )
+		{
+			// large blocks get a chunk of their own, to not waste the rest of the current chunk
+			bool becomesCurrent = (mCurrentChunk == 0);
+			char* data = addChunk(size, false);
+			if ( becomesCurrent )
+				mPosition = mEnd;
+			return data;
+		}
+
+		if ( (size_t)(mEnd - mPosition) < size )
+		{
+			if ( !addChunk(mChunkSize, true) )
+				return 0;
+		}
+
+		mLastBlock = mPosition;
+		mPosition += size;
+		return mLastBlock;
+	}
+
+	//------------------------------
+	char* MemoryArena::reallocate( char* data, size_t oldSize, size_t newSize )
+	{
+		mStatistics.reallocationCount++;
+		size_t alignedOldSize = alignSize(oldSize);
+		size_t alignedNewSize = alignSize(newSize);
+
+		if ( alignedNewSize <= alignedOldSize )
+		{
+			mStatistics.inPlaceReallocationCount++;
+			return data;
+		}
+
+		if ( (data == mLastBlock) && ((size_t)(mEnd - data) >= alignedNewSize) )
+		{
+			// the last block can grow into the free rest of the current chunk
+			mStatistics.inPlaceReallocationCount++;
+			mStatistics.usedBytes += alignedNewSize - alignedOldSize;
+			if ( alignedNewSize > mStatistics.largestAllocation )
+				mStatistics.largestAllocation = alignedNewSize;
+			mPosition = data + alignedNewSize;
+			return data;
+		}
+
+		char* newData = allocate(newSize);
+		if ( newData )
+			memcpy(newData, data, oldSize);
+		return newData;
+	}
+
+	//------------------------------
+	void* MemoryArena::allocateBlock( size_t size )
+	{
+		blockAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		MemoryArena* arena = currentArena;
+		size_t blockSize = sizeof(BlockHeader) + size;
+		BlockHeader* header = (BlockHeader*)( arena ? arena->allocate(blockSize) : malloc(blockSize) );
+		if ( !header )
+			return 0;
+		header->info.arena = arena;
+		header->info.size = size;
+		return header + 1;
+	}
+
+	//------------------------------
+	void* MemoryArena::reallocateBlock( void* block, size_t size )
+	{
+		if ( !block )
+			return allocateBlock(size);
+
+		blockReallocationCount.fetch_add(1, std::memory_order_relaxed);
+		BlockHeader* header = (BlockHeader*)block - 1;
+		MemoryArena* arena = header->info.arena;
+		size_t blockSize = sizeof(BlockHeader) + size;
+		if ( arena )
+			header = (BlockHeader*)arena->reallocate( (char*)header, sizeof(BlockHeader) + header->info.size, blockSize );
+		else
+			header = (BlockHeader*)realloc( header, blockSize );
+		if ( !header )
+			return 0;
+		header->info.size = size;
+		return header + 1;
+	}
+
+	//------------------------------
+	void MemoryArena::releaseBlock( void* block )
+	{
+		if ( !block )
+			return;
+		BlockHeader* header = (BlockHeader*)block - 1;
+		if ( !header->info.arena )
+			free(header);
+	}
+
+	//------------------------------
+	MemoryArena::BlockStatistics MemoryArena::getBlockStatistics()
+	{
+		BlockStatistics statistics;
+		statistics.allocationCount = blockAllocationCount.load(std::memory_order_relaxed);
+		statistics.reallocationCount = blockReallocationCount.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	//------------------------------
+	void MemoryArena::resetBlockStatistics()
+	{
+		blockAllocationCount.store(0, std::memory_order_relaxed);
+		blockReallocationCount.store(0, std::memory_order_relaxed);
+	}
+
+} // namespace COLLADAFW
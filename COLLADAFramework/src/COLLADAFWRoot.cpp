@@ -11,6 +11,7 @@
 #include "COLLADAFWStableHeaders.h"
 #include "COLLADAFWRoot.h"
 #include "COLLADAFWILoader.h"
+#include "COLLADAFWMemoryArena.h"
 
 namespace COLLADAFW
 {
@@ -24,6 +25,7 @@ namespace COLLADAFW
 	{
 		if ( !mLoader || !mWriter )
 			return false;
+		MemoryArena::ScopedCurrentArena scopedArena(mMemoryArena);
 		return mLoader->loadDocument(fileName, mWriter); 
 	}
 
@@ -31,6 +33,7 @@ namespace COLLADAFW
 	{
 		if ( !mLoader || !mWriter )
 			return false;
+		MemoryArena::ScopedCurrentArena scopedArena(mMemoryArena);
 		return mLoader->loadDocument(uri, buffer, length, mWriter); 
 	}
     
@@ -0,0 +1,11 @@
+OPTIONS="-O3 -Wall -std=c++11"
+
+INCLUDES="-I../../include -I../../include/performanceTest -I../../../COLLADABaseUtils/include -I../../../COLLADABaseUtils/include/Math"
+
+FILES="main.cpp performanceTest.cpp ../COLLADAFWMemoryArena.cpp"
+
+OUTPUTFILE="-o performanceTest"
+
+
+
+g++ $OPTIONS $INCLUDES $FILES $OUTPUTFILE -lpthread
@@ -0,0 +1,20 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+	
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+
+#include "performanceTest.h"
+
+
+int main()
+{
+	performanceTest();
+
+	return 0;
+}
@@ -0,0 +1,101 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+	
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include "COLLADAFWTypes.h"
+#include "COLLADAFWMemoryArena.h"
+
+#include <iostream>
+#include <iomanip>
+
+#include <time.h>
+
+
+/** Number of vertices of the simulated triangles element.*/
+static const size_t VERTEX_COUNT = 10000000;
+
+/** Number of index lists filled per vertex, i.e. positions, normals and uv coordinates.*/
+static const size_t INDEX_LIST_COUNT = 3;
+
+
+/** How the index lists are prepared before the indices are appended.*/
+enum ReservePolicy
+{
+	/** The lists start empty and grow while appending.*/
+	NO_RESERVE,
+
+	/** The lists are reallocated to the number of triangles, as the loader did before it used the
+	vertex count.*/
+	RESERVE_PRIMITIVE_COUNT,
+
+	/** The lists are reserved for the exact number of vertices.*/
+	RESERVE_VERTEX_COUNT
+};
+
+
+/** Appends the indices of VERTEX_COUNT vertices to INDEX_LIST_COUNT lists, interleaved like the mesh
+loader does it, and prints time and the number of times the lists had to grow.*/
+static void runTest( const char* name, ReservePolicy reservePolicy, COLLADAFW::MemoryArena* arena )
+{
+	COLLADAFW::MemoryArena::ScopedCurrentArena scopedArena( arena );
+
+	size_t allocationCount = 0;
+	size_t reallocationCount = 0;
+	clock_t startTime = clock();
+	{
+		COLLADAFW::UIntValuesArray indexLists[INDEX_LIST_COUNT];
+		for ( size_t i = 0; i < INDEX_LIST_COUNT; ++i )
+		{
+			indexLists[i].allocMemory( 0, COLLADAFW::UIntValuesArray::OWNER );
+			if ( reservePolicy == RESERVE_PRIMITIVE_COUNT )
+				indexLists[i].reallocMemory( VERTEX_COUNT / 3 );
+			else if ( reservePolicy == RESERVE_VERTEX_COUNT )
+				indexLists[i].reserve( VERTEX_COUNT );
+			if ( indexLists[i].getCapacity() > 0 )
+				allocationCount++;
+		}
+
+		for ( size_t vertex = 0; vertex < VERTEX_COUNT; ++vertex )
+		{
+			for ( size_t i = 0; i < INDEX_LIST_COUNT; ++i )
+			{
+				COLLADAFW::UIntValuesArray& indexList = indexLists[i];
+				if ( indexList.getCount() == indexList.getCapacity() )
+					(indexList.getCapacity() > 0) ? reallocationCount++ : allocationCount++;
+				indexList.append( (unsigned int)(vertex ^ i) );
+			}
+		}
+	}
+	double seconds = (double)(clock() - startTime) / CLOCKS_PER_SEC;
+
+	std::cout << std::setw(36) << std::left << name 
+			  << std::setw(10) << std::right << std::fixed << std::setprecision(3) << seconds << " s" 
+			  << std::setw(8) << allocationCount << " allocations" 
+			  << std::setw(8) << reallocationCount << " reallocations" << std::endl;
+}
+
+
+void performanceTest()
+{
+	std::cout << "appending " << VERTEX_COUNT << " vertices to " << INDEX_LIST_COUNT << " index lists" << std::endl;
+
+	runTest( "heap, no reserve", NO_RESERVE, 0 );
+	runTest( "heap, primitive count reserved", RESERVE_PRIMITIVE_COUNT, 0 );
+	runTest( "heap, vertex count reserved", RESERVE_VERTEX_COUNT, 0 );
+
+	COLLADAFW::MemoryArena arena;
+	runTest( "arena, no reserve", NO_RESERVE, &arena );
+	arena.release();
+	runTest( "arena, vertex count reserved", RESERVE_VERTEX_COUNT, &arena );
+	const COLLADAFW::MemoryArena::Statistics& arenaStatistics = arena.getStatistics();
+	std::cout << "arena: " << arenaStatistics.reservedBytes << " bytes reserved in " 
+			  << arenaStatistics.chunkCount << " chunks" << std::endl;
+}
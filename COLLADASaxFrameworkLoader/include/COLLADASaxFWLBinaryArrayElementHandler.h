@@ -0,0 +1,165 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_BINARYARRAYELEMENTHANDLER_H__
+#define __COLLADASAXFWL_BINARYARRAYELEMENTHANDLER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include "GeneratedSaxParserIUnknownElementHandler.h"
+
+#include <map>
+#include <vector>
+
+
+namespace GeneratedSaxParser
+{
+	class MemoryMappedFile;
+}
+
+namespace COLLADASaxFWL
+{
+	class IFilePartLoader;
+
+    /** Reads the \<binary_array\> elements written by the COLLADAStreamWriter into a
+	\<technique profile="OpenCOLLADA_binary"\>. They contain the values of a float array or primitive index list
+	as little endian binary data, either base64 encoded or stored in a file next to the document:
+	\<binary_array type="float32|float64|uint32" count="..." encoding="base64"\>...\</binary_array\> or
+	\<binary_array type="..." count="..." url="document.dae.bin" offset="..."/\>.
+	Binary files are mapped into memory once per document and the values are passed to the receiver
+	without any text conversion. The count attribute is checked against the size of the binary file,
+	before an array is passed to the receiver.*/
+	class BinaryArrayElementHandler : public GeneratedSaxParser::IUnknownElementHandler
+	{
+	public:
+		/** The type of the values of a binary array.*/
+		enum ValueType
+		{
+			VALUE_TYPE_UNKNOWN,
+			VALUE_TYPE_FLOAT32,
+			VALUE_TYPE_FLOAT64,
+			VALUE_TYPE_UINT32
+		};
+
+		/** Receives the values of the binary arrays of a technique.*/
+		class IReceiver
+		{
+		public:
+			virtual ~IReceiver() {}
+
+			/** Called at the beginning of each binary array. @a valueCount is the count attribute. For base64
+			encoded arrays it cannot be checked in advance and might exceed the values actually received,
+			so memory must not be allocated for it without limit.
+			@return False, if the values are not needed, e.g. because they have already been read from text.*/
+			virtual bool beginBinaryArray( ValueType valueType, size_t valueCount ) = 0;
+
+			/** Receives the next @a valueCount little endian values of the binary array. Use convertValues()
+			to read them. Might be called several times per array.
+			@return False, if parsing should be aborted.*/
+			virtual bool binaryArrayData( ValueType valueType, const char* data, size_t valueCount ) = 0;
+		};
+
+	private:
+		/** Maps the file names of the binary files to the mapped files.*/
+		typedef std::map<String, GeneratedSaxParser::MemoryMappedFile*> MappedFileMap;
+
+		/** The loader of the technique. Used to resolve urls and to report errors.*/
+		IFilePartLoader* mLoader;
+
+		/** The receiver of the values of the current technique.*/
+		IReceiver* mReceiver;
+
+		/** The binary files already mapped.*/
+		MappedFileMap mMappedFiles;
+
+		/** The depth of the current element within the technique.*/
+		size_t mElementDepth;
+
+		/** True, while base64 encoded values of a binary array are received.*/
+		bool mReceivingBase64;
+
+		/** The value type of the current binary array.*/
+		ValueType mValueType;
+
+		/** The number of values of the current binary array.*/
+		size_t mValueCount;
+
+		/** The number of values of the current binary array already passed to the receiver.*/
+		size_t mReceivedValueCount;
+
+		/** The bits of the base64 characters not yet written to mDecodedData.*/
+		unsigned int mBase64Bits;
+
+		/** The number of bits in mBase64Bits.*/
+		unsigned int mBase64BitCount;
+
+		/** The decoded bytes not yet passed to the receiver.*/
+		std::vector<char> mDecodedData;
+
+	public:
+		/** The profile of the techniques that contain the binary arrays.*/
+		static const char* const TECHNIQUE_PROFILE;
+
+        /** Constructor. */
+		BinaryArrayElementHandler();
+
+        /** Destructor. Unmaps all binary files.*/
+		virtual ~BinaryArrayElementHandler();
+
+		/** Passes the binary arrays of the technique @a loader is in to @a receiver, until end() is called.*/
+		void begin( IFilePartLoader* loader, IReceiver* receiver );
+
+		/** Stops passing binary arrays to the receiver.*/
+		void end();
+
+		/** Returns the size of a value of type @a valueType in bytes, 0 if it is unknown.*/
+		static size_t getValueSize( ValueType valueType );
+
+		/** Converts @a valueCount little endian values of type @a valueType, starting at @a data,
+		into @a values.*/
+		static void convertValues( ValueType valueType, const char* data, size_t valueCount, float* values );
+
+		/** Converts @a valueCount little endian values of type @a valueType, starting at @a data,
+		into @a values.*/
+		static void convertValues( ValueType valueType, const char* data, size_t valueCount, unsigned long long* values );
+
+        /** Implementation of IUnknownElementHandler. */
+        virtual bool elementBegin( const ParserChar* elementName, const GeneratedSaxParser::xmlChar** attributes);
+        virtual bool elementEnd(const ParserChar* elementName);
+        virtual bool textData(const ParserChar* text, size_t textLength);
+
+	private:
+
+        /** Disable default copy ctor. */
+		BinaryArrayElementHandler( const BinaryArrayElementHandler& pre );
+
+        /** Disable default assignment operator. */
+		const BinaryArrayElementHandler& operator= ( const BinaryArrayElementHandler& pre );
+
+		/** Passes the values of a binary array stored in a binary file to the receiver. Arrays exceeding
+		the file are reported and not passed.*/
+		bool readFromFile( const ParserChar* url, unsigned long long offset );
+
+		/** Returns the binary file @a url refers to, relative to the document. It is mapped on first use.
+		@return The mapped file or 0 if it could not be mapped.*/
+		const GeneratedSaxParser::MemoryMappedFile* getMappedFile( const String& url );
+
+		/** Passes the complete values in mDecodedData to the receiver.*/
+		bool passDecodedData();
+
+		/** Reports @a message to the error handler.
+		@return False, if parsing should be aborted.*/
+		bool handleError( const String& message );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_BINARYARRAYELEMENTHANDLER_H__
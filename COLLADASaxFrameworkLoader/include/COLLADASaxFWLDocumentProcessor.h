@@ -19,6 +19,7 @@
 #include "COLLADASaxFWLSidTreeNode.h"
 #include "COLLADASaxFWLLoader.h"
 #include "COLLADASaxFWLExtraDataElementHandler.h"
+#include "COLLADASaxFWLBinaryArrayElementHandler.h"
 
 
 #include "COLLADAFWUniqueId.h"
@@ -99,6 +100,9 @@ namespace COLLADASaxFWL
         /** The handler to handle the extra data elements. */
         ExtraDataElementHandler mExtraDataElementHandler;
 
+        /** The handler to read the binary arrays written by the COLLADAStreamWriter. */
+        BinaryArrayElementHandler mBinaryArrayElementHandler;
+
 		/** A combination of ObjectFlags, indicating which objects should be parsed during the 
 		parse process.*/
 		int mObjectFlags;
@@ -149,6 +153,9 @@ namespace COLLADASaxFWL
         /** The handler to handle the extra data elements. */
         ExtraDataElementHandler& getExtraDataElementHandler () { return mExtraDataElementHandler; }
 
+        /** The handler to read the binary arrays written by the COLLADAStreamWriter. */
+        BinaryArrayElementHandler& getBinaryArrayElementHandler () { return mBinaryArrayElementHandler; }
+
 		/** A combination of ObjectFlags, indicating which objects should be parsed during the 
 		parse process.*/
 		int getObjectFlags() const { return mObjectFlags; }
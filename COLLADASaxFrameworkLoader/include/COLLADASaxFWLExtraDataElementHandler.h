@@ -30,6 +30,10 @@ namespace COLLADASaxFWL
         of the callback handlers has to be called. */
         bool* mCallbackHandlersCallingList;
 
+        /** If set, all elements are passed to this handler instead of the extra data callback handlers. 
+        Used by the loaders to read data of their own from a technique. */
+        GeneratedSaxParser::IUnknownElementHandler* mOverridingElementHandler;
+
 	public:
 
         /** Constructor. */
@@ -47,6 +51,10 @@ namespace COLLADASaxFWL
         /** Set the flag, if the callback handler on the given index position should be called. */
         void setExtraDataCallbackHandlerCalling ( const size_t index, const bool calling );
 
+        /** Passes all elements to @a elementHandler instead of the extra data callback handlers, until 
+        it is set to 0 again. */
+        void setOverridingElementHandler ( GeneratedSaxParser::IUnknownElementHandler* elementHandler ) { mOverridingElementHandler = elementHandler; }
+
         /** Implementation of IUnknownElementHandler. */
         virtual bool elementBegin( const ParserChar* elementName, const GeneratedSaxParser::xmlChar** attributes);
         virtual bool elementEnd(const ParserChar* elementName);
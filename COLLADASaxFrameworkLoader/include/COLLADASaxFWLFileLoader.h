@@ -94,6 +94,16 @@ namespace COLLADASaxFWL
 		bool load();
 		bool load( const char* buffer, int length );
 
+		/** Starts loading a file, that is passed in chunks by loadChunk(), into the frame work data model.*/
+		bool beginLoad();
+
+		/** Parses the next @a length bytes of the file started by beginLoad().
+		@return False, if parsing has been stopped.*/
+		bool loadChunk( const char* data, size_t length );
+
+		/** Parses the rest of the file started by beginLoad().*/
+		bool endLoad();
+
 		/** Returns the parsing status of the file loader.*/
 		ParsingStatus getParsingStatus() const { return mParsingStatus; }
 
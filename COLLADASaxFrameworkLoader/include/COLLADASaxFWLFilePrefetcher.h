@@ -0,0 +1,147 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_FILEPREFETCHER_H__
+#define __COLLADASAXFWL_FILEPREFETCHER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include "COLLADAFWTypes.h"
+
+#include "COLLADABUURI.h"
+#include "COLLADABUThreadPool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+
+namespace COLLADASaxFWL
+{
+
+	/** Reads external referenced documents on worker threads, while the loader parses the documents
+	that precede them. Only the I/O is overlapped with parsing: the documents themselves are still parsed
+	by the loader, one after the other, on the thread that called Loader::loadDocument(). This keeps the
+	order of the writer calls and the assignment of unique ids independent of the number of threads.
+	At most a fixed number of files is read in advance at a time, the others wait in a queue until a
+	file is released. Files that are memory mapped by the loader are not copied into memory, their pages
+	are only touched, so they are in the page cache when the loader maps them.*/
+	class FilePrefetcher
+	{
+	public:
+		/** Content of a prefetched file.*/
+		typedef std::vector<char> FileContent;
+
+		/** The number of files read in advance per worker thread, if no other maximum is passed.*/
+		static const size_t DEFAULT_MAX_PENDING_FILES_PER_THREAD = 2;
+
+	private:
+		/** State of one prefetched file.*/
+		struct PrefetchedFile
+		{
+			PrefetchedFile() : started(false), finished(false), succeeded(false) {}
+
+			/** The native path of the file.*/
+			String nativePath;
+
+			/** True, if the file has been passed to a worker thread.*/
+			bool started;
+
+			/** True, if the worker thread is done with the file.*/
+			bool finished;
+
+			/** True, if the file could be read completely.*/
+			bool succeeded;
+
+			/** The content of the file. Empty, if the file is memory mapped by the loader.*/
+			FileContent content;
+		};
+
+		typedef std::map<COLLADAFW::FileId, PrefetchedFile*> FileIdPrefetchedFileMap;
+
+		typedef std::deque<PrefetchedFile*> PrefetchedFileQueue;
+
+	private:
+		/** The files, prefetching has been started for and that have not been released.*/
+		FileIdPrefetchedFileMap mPrefetchedFiles;
+
+		/** The files, prefetching has been requested for, that have not been started yet.*/
+		PrefetchedFileQueue mQueuedFiles;
+
+		/** The number of files started and not yet released.*/
+		size_t mPendingFileCount;
+
+		/** The maximum of mPendingFileCount.*/
+		size_t mMaxPendingFileCount;
+
+		/** If true, the pages of the files are only touched, not copied.*/
+		bool mTouchPagesOnly;
+
+		/** Guards all members above and the members of the prefetched files.*/
+		std::mutex mMutex;
+
+		/** Signaled whenever a file has been finished.*/
+		std::condition_variable mFileFinished;
+
+		/** The worker threads. Must be destroyed first, since the workers access the members above.*/
+		COLLADABU::ThreadPool mThreadPool;
+
+	public:
+
+		/** Constructor.
+		@param threadCount The number of worker threads reading files.
+		@param touchPagesOnly If true, the files are read into the page cache of the operating system 
+		instead of into memory, because the loader parses them from a memory mapping.
+		@param maxPendingFileCount The maximum number of files read in advance and not yet released.
+		0 allows DEFAULT_MAX_PENDING_FILES_PER_THREAD files per thread.*/
+		FilePrefetcher( size_t threadCount, bool touchPagesOnly, size_t maxPendingFileCount = 0 );
+
+		/** Destructor. Waits for all reads to finish.*/
+		virtual ~FilePrefetcher();
+
+		/** Queues the file with file id @a fileId and uri @a fileUri to be read on a worker thread. It is 
+		read as soon as less than the maximum number of files are pending.*/
+		void prefetch( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri );
+
+		/** Waits until the file with file id @a fileId has been read.
+		@return The content of the file or 0 if the file has not been prefetched, has not been started 
+		yet, could not be read or has only been touched. Valid until release() is called for @a fileId.*/
+		const FileContent* waitForFile( COLLADAFW::FileId fileId );
+
+		/** Releases the memory of the file with file id @a fileId and starts reading the next queued file.*/
+		void release( COLLADAFW::FileId fileId );
+
+	private:
+		/** Passes queued files to the worker threads, as long as less than mMaxPendingFileCount files are
+		pending. mMutex has to be locked.*/
+		void startQueuedFiles();
+
+		/** Reads the file of @a prefetchedFile. Executed by a worker thread.*/
+		void readFile( PrefetchedFile* prefetchedFile );
+
+		/** Reads the file @a nativePath into @a content.*/
+		static bool copyFile( const String& nativePath, FileContent& content );
+
+		/** Maps the file @a nativePath and touches each of its pages.*/
+		static bool touchFile( const String& nativePath );
+
+        /** Disable default copy ctor. */
+		FilePrefetcher( const FilePrefetcher& pre );
+
+        /** Disable default assignment operator. */
+		const FilePrefetcher& operator= ( const FilePrefetcher& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_FILEPREFETCHER_H__
@@ -94,6 +94,9 @@ namespace COLLADASaxFWL
 		/** Returns the writer the data will be written to.*/
 		COLLADAFW::IWriter* writer();
 
+		/** Returns the writer meshes are streamed to, 0 if they are written as a whole.*/
+		COLLADAFW::IMeshStreamWriter* meshStreamWriter();
+
 		/** Reports an error to the error handler. If this method returns true, the 
 		loader stops parsing immediately. If severity is not CRITICAL and this method 
 		returns true, the loader continues loading. */
@@ -23,6 +23,7 @@
 #include "COLLADAFWTypes.h"
 #include "COLLADAFWSkinController.h"
 #include "COLLADAFWInstanceController.h"
+#include "COLLADAFWMemoryArena.h"
 
 #include "COLLADABUHashFunctions.h"
 #include "COLLADABUURI.h"
@@ -33,6 +34,7 @@
 namespace COLLADAFW
 {
 	class IWriter;
+	class IMeshStreamWriter;
 	class VisualScene;
 	class LibraryNodes;
 	class Effect;
@@ -43,6 +45,11 @@ namespace COLLADAFW
 	class MorphController;
 }
 
+namespace GeneratedSaxParser
+{
+	class ZipArchive;
+}
+
 
 namespace COLLADASaxFWL
 {
@@ -51,6 +58,8 @@ namespace COLLADASaxFWL
 	class DocumentProcessor;
 	class PostProcessor;
     class FileLoader;
+	class FilePrefetcher;
+	class SaxParserErrorHandler;
 
 
 	typedef std::list<String> StringList;
@@ -93,6 +102,19 @@ namespace COLLADASaxFWL
 			ALL_OBJECTS_MASK           = (1<<17) - 1,
 		};
 
+		/** The xml parsers the loader can parse documents with. Only the parsers the loader is built with
+		(GENERATEDSAXPARSER_XMLPARSER_LIBXML, GENERATEDSAXPARSER_XMLPARSER_EXPAT) are available.*/
+		enum XmlParser
+		{
+			XMLPARSER_LIBXML_SAX1,     ///< libxml's SAX1 interface
+			XMLPARSER_LIBXML_SAX2,     ///< libxml's SAX2 interface
+			XMLPARSER_EXPAT            ///< expat
+		};
+
+		/** Default maximum number of vertices of a triangles or lines element, buffered for a mesh 
+		stream writer.*/
+		static const size_t DEFAULT_MESH_STREAM_MAX_VERTEX_COUNT = 3 * 65536;
+
 	public:
 		typedef COLLADABU::hash_map<COLLADABU::URI, COLLADAFW::UniqueId> URIUniqueIdMap;
 
@@ -182,6 +204,9 @@ namespace COLLADASaxFWL
 		/** Function pointer to functions provided to registerExternalReferenceDeciderCallbackFunction.*/
 		typedef bool (*ExternalReferenceDeciderCallbackFunction)( const COLLADABU::URI&, COLLADAFW::FileId );
 
+		/** Maps file ids to the decision of the ExternalReferenceDeciderCallbackFunction.*/
+		typedef std::map<COLLADAFW::FileId, bool> FileIdBoolMap;
+
 	public:
 		const static InstanceControllerDataList EMPTY_INSTANCE_CONTROLLER_DATALIST;
 		static const JointSidsOrIds EMPTY_JOINTSIDSORIDS;
@@ -299,6 +324,47 @@ namespace COLLADASaxFWL
 		/** The call back function used to decide which filed should be leaded.*/
 		ExternalReferenceDeciderCallbackFunction mExternalReferenceDeciderCallbackFunction;
 
+		/** If true, files are mapped into memory and parsed directly from the mapping.*/
+		bool mUseMemoryMappedFiles;
+
+		/** The xml parser documents are parsed with.*/
+		XmlParser mXmlParser;
+
+		/** If true, libraries not needed for the object flags are left out of memory mapped files.*/
+		bool mSkipUnusedLibraries;
+
+		/** Number of threads used to read external referenced files in advance. 0 or 1 disables 
+		reading in advance.*/
+		size_t mFileLoadingThreadCount;
+
+		/** Reads the external referenced files in advance, if mFileLoadingThreadCount is greater than 1.
+		Only valid during loadDocument() and between beginDocument() and endDocument().*/
+		FilePrefetcher* mFilePrefetcher;
+
+		/** The error handler of the document passed in chunks by feed(). Only valid between 
+		beginDocument() and endDocument().*/
+		SaxParserErrorHandler* mPushSaxParserErrorHandler;
+
+		/** The archive the root document is read from, if it is a .zae archive or a member of one, 
+		0 otherwise. Only valid during loadDocument().*/
+		GeneratedSaxParser::ZipArchive* mArchive;
+
+		/** The decisions of mExternalReferenceDeciderCallbackFunction, for files that are read in advance.*/
+		FileIdBoolMap mLoadFileDecisions;
+
+		/** The arena the framework objects are allocated from during loadDocument(), 0 to use the heap.*/
+		COLLADAFW::MemoryArena* mMemoryArena;
+
+		/** True, if mMemoryArena is deleted by the destructor.*/
+		bool mDeleteMemoryArena;
+
+		/** Receives meshes piece by piece instead of mWriter, if set.*/
+		COLLADAFW::IMeshStreamWriter* mMeshStreamWriter;
+
+		/** The maximum number of vertices of a triangles or lines element that are buffered, before
+		they are passed to mMeshStreamWriter.*/
+		size_t mMeshStreamMaxVertexCount;
+
 	public:
 
         /** Constructor. */
@@ -315,6 +381,9 @@ namespace COLLADASaxFWL
         AnimationSidAddressBindingList & getAnimationSidAddressBindingList() { return mAnimationSidAddressBindings; }
 
         /** Starts loading the model and feeds the writer with data.
+		Besides plain documents, gzip compressed documents, .zae archives and members of .zae archives, 
+		as in "dir/scene.zae/models/tree.dae", are loaded. External references of a document in an 
+		archive are read from the archive.
 		@param fileName The name of the file that should be loaded.
 		@param writer The writer that should be fed with data.
 		@return True, if loading succeeded, false otherwise.*/
@@ -327,11 +396,98 @@ namespace COLLADASaxFWL
          @param writer The writer that should be fed with data.
          @return True, if loading succeeded, false otherwise.*/
 		virtual bool loadDocument( const String& uri, const char* buffer, int length, COLLADAFW::IWriter* writer );
+
+		/** Starts loading a model, that is passed in chunks by feed(), and feeds the writer with data.
+		The document does not need to be in memory completely, so it can be parsed while it is received,
+		read or decompressed, and its size is not limited to the range of int. 
+		@param uri The URI associated with the document. External references are resolved against it.
+		@param writer The writer that should be fed with data.
+		@return True, if the xml parser could be created. endDocument() has to be called in any case.*/
+		bool beginDocument( const String& uri, COLLADAFW::IWriter* writer );
+
+		/** Parses the next @a length bytes of the document started by beginDocument(). The chunks may have
+		any size and may end anywhere in the document. The chunk is not used after feed() returns.
+		@return False, if parsing has been stopped. The remaining chunks do not need to be passed.*/
+		bool feed( const char* chunk, size_t length );
+
+		/** Parses the rest of the document started by beginDocument(), loads the external referenced files
+		from their URIs as loadDocument(const String&, COLLADAFW::IWriter*) does and finishes the writer.
+		@return True, if loading succeeded, false otherwise.*/
+		bool endDocument();
         
 		/** Sets the flags indicating which objects should be loaded.
 		@param objectFlags The flags indicating which objects should be loaded.*/
 		void setObjectFlags( int objectFlags ) { mObjectFlags = objectFlags; }
 
+		/** Sets if the files loaded by loadDocument(const String&, COLLADAFW::IWriter*) should be mapped 
+		into memory and passed to the xml parser directly from the mapping instead of being read through 
+		intermediate buffers. Disabled by default.*/
+		void setUseMemoryMappedFiles( bool useMemoryMappedFiles ) { mUseMemoryMappedFiles = useMemoryMappedFiles; }
+
+		/** Returns true if files are parsed from a memory mapping.*/
+		bool getUseMemoryMappedFiles() const { return mUseMemoryMappedFiles; }
+
+		/** Sets the xml parser documents are parsed with. Defaults to XMLPARSER_LIBXML_SAX1, or to
+		XMLPARSER_EXPAT if the loader is built with expat only. With SAX2, libxml passes element names
+		interned in its dictionary, so the hash of each distinct element name is calculated only once per
+		document instead of once per element. Its per element callbacks are more expensive, though, so
+		SAX1 is usually faster. If the loader is not built with the requested parser, the default one
+		is used.*/
+		void setXmlParser( XmlParser xmlParser ) { mXmlParser = xmlParser; }
+
+		/** Returns the xml parser documents are parsed with.*/
+		XmlParser getXmlParser() const { return mXmlParser; }
+
+		/** Sets if the libraries not needed for the objects set by setObjectFlags() are not passed to the
+		xml parser at all, if files are memory mapped. The libraries are found by a quick scan of the mapping
+		for the child elements of the COLLADA element, so e.g. loading only the scene graph does not 
+		tokenize \<library_geometries\>. The loaded objects are the same as without skipping. Disabled by 
+		default. Ignored, if memory mapped files are not used.*/
+		void setSkipUnusedLibraries( bool skipUnusedLibraries ) { mSkipUnusedLibraries = skipUnusedLibraries; }
+
+		/** Returns true if libraries not needed for the object flags are left out of memory mapped files.*/
+		bool getSkipUnusedLibraries() const { return mSkipUnusedLibraries; }
+
+		/** Sets the number of threads used by loadDocument(const String&, COLLADAFW::IWriter*) to read 
+		external referenced files, while the files referencing them are still parsed. Only the I/O is
+		overlapped with parsing: the files are parsed one after the other on the calling thread, in the 
+		order of their file ids, i.e. the writer receives the same calls with the same unique ids as without
+		threads. Two files per thread are read in advance at most. If memory mapped files are used, the files
+		are only read into the page cache of the operating system and parsed from their mapping, otherwise
+		they are read into memory. If enabled, the external reference decider callback function is called 
+		as soon as a file id is assigned to a file, instead of right before the file is loaded. 0 or 1 
+		disables reading in advance, which is the default.*/
+		void setFileLoadingThreadCount( size_t fileLoadingThreadCount ) { mFileLoadingThreadCount = fileLoadingThreadCount; }
+
+		/** Returns the number of threads used to read external referenced files.*/
+		size_t getFileLoadingThreadCount() const { return mFileLoadingThreadCount; }
+
+		/** Sets the arena, all framework objects and arrays created during loadDocument() are allocated 
+		from, including those created by the writer. 0 allocates them from the heap, which is the default. 
+		An arena set with COLLADAFW::Root::setMemoryArena() is used, if none is set here.
+		@param deleteWithLoader If true, the loader deletes the arena in its destructor, after the objects 
+		it deletes itself, so the writer must not keep objects allocated from it beyond the lifetime of 
+		the loader. Otherwise the arena must outlive the loader.*/
+		void setMemoryArena( COLLADAFW::MemoryArena* memoryArena, bool deleteWithLoader = false );
+
+		/** Returns the arena set by setMemoryArena().*/
+		COLLADAFW::MemoryArena* getMemoryArena() const { return mMemoryArena; }
+
+		/** Sets a writer that receives the vertex data and primitives of each mesh while the mesh is 
+		parsed, instead of the complete mesh passed to COLLADAFW::IWriter::writeGeometry(). This limits 
+		the memory needed to load large meshes. 0 disables streaming, which is the default.
+		@param meshStreamWriter The writer, usually the same object as the writer passed to loadDocument().
+		@param maxVertexCount The maximum number of vertices of a triangles or lines element that are 
+		buffered, before they are passed to the writer as a primitive of their own.*/
+		void setMeshStreamWriter( COLLADAFW::IMeshStreamWriter* meshStreamWriter, size_t maxVertexCount = DEFAULT_MESH_STREAM_MAX_VERTEX_COUNT ) 
+		{ mMeshStreamWriter = meshStreamWriter; mMeshStreamMaxVertexCount = maxVertexCount; }
+
+		/** Returns the writer set by setMeshStreamWriter().*/
+		COLLADAFW::IMeshStreamWriter* getMeshStreamWriter() const { return mMeshStreamWriter; }
+
+		/** Returns the maximum number of vertices set by setMeshStreamWriter().*/
+		size_t getMeshStreamMaxVertexCount() const { return mMeshStreamMaxVertexCount; }
+
         /** Register an extra data callback handler.
         * @param ExtraDataCallbackHandler* extraDataCallbackHandler The callback handler to register.
         * @return bool True, if the handler could be registered successfull. */
@@ -353,6 +509,13 @@ namespace COLLADASaxFWL
 		assigned to any Uri, an invalid uri is returned.*/
 		const COLLADABU::URI& getFileUri( COLLADAFW::FileId fileId )const;
 
+		/** Returns the archive the root document is read from or 0, if it is not read from a .zae archive.*/
+		const GeneratedSaxParser::ZipArchive* getArchive() const { return mArchive; }
+
+		/** Returns true, if @a fileUri refers to a member of the archive the root document is read from,
+		and sets @a memberName to the name of the member.*/
+		bool getArchiveMemberName( const COLLADABU::URI& fileUri, String& memberName ) const;
+
         /** Maps the Unique generated from the id of the COLLADA controller element to the
          InstanceControllerDataList containing all instance controllers that reference the same controller.*/
 		InstanceControllerDataListMap& getInstanceControllerDataListMap() { return mInstanceControllerDataListMap; }
@@ -405,6 +568,23 @@ namespace COLLADASaxFWL
 		@a fileId nor @a uri have been passed to that method before.*/
 		void addFileIdUriPair( COLLADAFW::FileId fileId, const COLLADABU::URI& uri );
 
+		/** Returns true if the file with file id @a fileId and uri @a fileUri should be loaded, i.e. if it 
+		is the root file or the external reference decider callback function accepts it.*/
+		bool shouldLoadFile( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri );
+
+		/** Loads the file with file id @a fileId and uri @a fileUri using mFileLoader. The content read 
+		in advance by mFilePrefetcher is used, if available.*/
+		bool loadFile( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri );
+
+		/** Loads the files with file ids from mCurrentFileId on, including the files they reference.
+		@return False, if loading has been aborted.*/
+		bool loadFiles( SaxParserErrorHandler& saxParserErrorHandler );
+
+		/** Stops reading files in advance, post processes the loaded files or cancels the writer, if 
+		@a abortLoading is true, and finishes the writer.
+		@return True, if loading has not been aborted.*/
+		bool finishLoading( SaxParserErrorHandler& saxParserErrorHandler, bool abortLoading );
+
 		/** Returns the GeometryMaterialIdInfo to map symbols to ids*/
 		GeometryMaterialIdInfo& getMeshMaterialIdInfo( );
 
@@ -475,6 +655,9 @@ namespace COLLADASaxFWL
 		/** Returns the writer the data will be written to.*/
 		COLLADAFW::IWriter* writer(){ return mWriter; }
 
+		/** Returns the writer meshes are streamed to, 0 if they are written as a whole.*/
+		COLLADAFW::IMeshStreamWriter* meshStreamWriter(){ return mMeshStreamWriter; }
+
 
         /** Disable default copy ctor. */
 		Loader( const Loader& pre );
@@ -18,6 +18,7 @@
 #include "COLLADASaxFWLSourceArrayLoader.h"
 
 #include "COLLADAFWMesh.h"
+#include "COLLADAFWIMeshStreamWriter.h"
 
 
 namespace COLLADASaxFWL
@@ -121,6 +122,10 @@ namespace COLLADASaxFWL
 		end__ph__p and read in end__h and data__h*/
 		bool mCurrentPhHasEmptyP;
 
+		/** True, if the p element of the current MeshPrimitive contained indices. Binary indices are 
+		only read, if it did not.*/
+		bool mCurrentPHasIndices;
+
 		/** The expected vertex count of the current MeshPrimitive. Uses this, if the face vertex count can be
 		predicted or calculated, before reading the p elements.*/
 		size_t mCurrentExpectedVertexCount;
@@ -167,13 +172,24 @@ namespace COLLADASaxFWL
         /** Flag for the extra tag preservation, to know if we are parsing in the mesh. */
         bool mInMesh;
 
+        /** The writer the vertex data and primitives are passed to while parsing, 0 if the mesh is 
+        written as a whole.*/
+        COLLADAFW::IMeshStreamWriter* mStreamWriter;
+
+        /** The maximum number of vertices of a triangles or lines element, buffered before they are 
+        passed to mStreamWriter.*/
+        size_t mStreamMaxVertexCount;
+
+        /** The number of values of each vertex data array, already passed to mStreamWriter.*/
+        size_t mStreamedValuesCounts[COLLADAFW::IMeshStreamWriter::VERTEX_DATA_SEMANTIC_COUNT];
+
     public:
 
         /** Constructor. */
 		MeshLoader ( IFilePartLoader* callingFilePartLoader, const String& geometryId, const String& geometryName );
 
-        /** Destructor. */
-        virtual ~MeshLoader () { delete mMesh; }
+        /** Destructor. Deletes the primitive of an aborted parse, that has not been appended.*/
+        virtual ~MeshLoader () { delete mCurrentMeshPrimitive; delete mMesh; }
 
         /** Returns the unique id of the current parsed object. */
         virtual const COLLADAFW::UniqueId& getUniqueId();
@@ -181,11 +197,23 @@ namespace COLLADASaxFWL
         /** Returns the mesh that has just been loaded.*/
 		COLLADAFW::Mesh* getMesh() { return mMesh; }
 
+		/** Returns true, if the vertex data and primitives of the mesh have been passed to a mesh stream
+		writer instead of being stored in the mesh.*/
+		bool isStreamed() const { return mStreamWriter != 0; }
+
 		/** Sax callback function for the beginning of a source element.*/
 		virtual bool begin__source(const source__AttributeData& attributes);
 
 		/** Sax callback function for the ending of a source element.*/
 		virtual bool end__source();
+
+		/** Sax callback function for the beginning of a float array element. Does not reserve memory
+		for the values, if they are passed to the stream writer.*/
+		virtual bool begin__float_array( const float_array__AttributeData& attributeData );
+
+		/** Sax callback function for the float data of a float array element. Passes the values to the
+		stream writer, if there is one.*/
+		virtual bool data__float_array( const float* data, size_t length );
 		
 		/** Cleans up everything and gives control to calling file part loader.*/
 		virtual bool end__mesh();
@@ -231,6 +259,15 @@ namespace COLLADASaxFWL
 		/** Sax callback function for the data of a p within a triangles element element.*/
 		virtual bool data__p( const unsigned long long* data, size_t length );
 
+		/** Implementation of BinaryArrayElementHandler::IReceiver. Accepts the indices of the current
+		triangles or polylist element, if its p element did not contain them as text. The values of
+		float arrays are passed to the stream writer, if there is one, and handled by the SourceArrayLoader
+		otherwise.*/
+		virtual bool beginBinaryArray( BinaryArrayElementHandler::ValueType valueType, size_t valueCount );
+
+		/** Implementation of BinaryArrayElementHandler::IReceiver.*/
+		virtual bool binaryArrayData( BinaryArrayElementHandler::ValueType valueType, const char* data, size_t valueCount );
+
 
 		/** Sax callback function for the beginning of a polylist element.*/
 		virtual bool begin__polylist( const polylist__AttributeData& attributeData );
@@ -371,9 +408,31 @@ namespace COLLADASaxFWL
         void initializeBinormalsOffset ();
         bool initializePositionsOffset ();
 
+		/** Returns the number of indices to reserve in each index list of the current mesh primitive,
+		limited to MAX_RESERVE_COUNT.*/
+		size_t getIndicesReserveCount() const;
+
+		/** Reserves memory for getIndicesReserveCount() indices in each used index list of the 
+		current mesh primitive. Must be called after initializeOffsets().
+		@return False, if the memory could not be allocated. The error has been reported then.*/
+		bool reserveIndices();
+
+		/** Appends the current mesh primitive to the mesh or passes it to the stream writer.
+		@return False, if the stream writer failed.*/
+		bool appendCurrentMeshPrimitive();
+
+		/** Passes the faces of the current triangles or lines element, parsed so far, to the stream 
+		writer, if their number exceeds the buffer limit, and continues with a new mesh primitive.
+		@return False, if the stream writer failed.*/
+		bool streamCompletedFaces();
+
 		/** Writes all the indices in data into the indices array of the current mesh primitive.*/
 		bool writePrimitiveIndices ( const unsigned long long* data, size_t length );
 
+		/** Returns true within sources and within triangles and polylists, whose indices might have been
+		written binary.*/
+		virtual bool receivesBinaryArrays() const;
+
         /**
          * Get the number of all indices in all p elements in the current primitive element.
          */
@@ -384,8 +443,16 @@ namespace COLLADASaxFWL
          * source data of the input elements and write it into the source elements.
          * Attention: if there are multiple sources for the same semantic, we have to 
          * concat the source arrays and the indices!
+         * @return False, if the stream writer failed.
          */
-        void loadSourceElements ( const MeshPrimitiveInputList& polyBaseElement );
+        bool loadSourceElements ( const MeshPrimitiveInputList& polyBaseElement );
+
+        /** Passes the next values of the float array of the current source to the stream writer.*/
+        bool streamSourceValues ( const float* values, size_t valuesCount );
+
+        /** Passes the source of @a input, whose values have already been streamed, to the stream writer
+        as vertex data of the semantic of @a input, if it has not been passed for that semantic before.*/
+        bool streamSourceElement ( const InputShared& input );
 
         /**
          * Load the source element of the current input element into the framework mesh.
@@ -90,6 +90,9 @@ namespace COLLADASaxFWL
          */
         size_t mInitialIndex;
 
+        /** The number of values of the source, passed to a mesh stream writer instead of being stored.*/
+        size_t mStreamedValuesCount;
+
         /**
          * Flags, if the source element is already loaded into the framework. A source element 
          * can be referenced from the same input element in multiple primitive elements or from
@@ -108,6 +111,7 @@ namespace COLLADASaxFWL
             : mId()
 			, mStride(0)
 			, mInitialIndex (0)
+			, mStreamedValuesCount (0)
             , mLoadedInputElements ( COLLADAFW::MeshPrimitiveArray::OWNER )
         {}
 
@@ -200,6 +204,12 @@ namespace COLLADASaxFWL
         */
         void setInitialIndex ( size_t InitialIndex ) { mInitialIndex = InitialIndex; }
 
+        /** Returns the number of values of the source, passed to a mesh stream writer.*/
+        size_t getStreamedValuesCount () const { return mStreamedValuesCount; }
+
+        /** Adds @a valuesCount to the number of values, passed to a mesh stream writer.*/
+        void addStreamedValues ( size_t valuesCount ) { mStreamedValuesCount += valuesCount; }
+
 		/** Appends an accessor parameter to the source's  accessor.*/
 		void appendAccessorParameter( const AccessorParameter& parameter ) { mAccessor.push_back( parameter ); }
 
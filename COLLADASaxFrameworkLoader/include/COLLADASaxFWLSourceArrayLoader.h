@@ -15,6 +15,7 @@
 #include "COLLADASaxFWLSource.h"
 #include "COLLADASaxFWLFilePartLoader.h"
 #include "COLLADASaxFWLXmlTypes.h"
+#include "COLLADASaxFWLBinaryArrayElementHandler.h"
 #include "COLLADAFWFloatOrDoubleArray.h"
 
 
@@ -25,14 +26,18 @@ namespace COLLADASaxFWL
     Base class for elements, that contain source arrays. The derived classes need to implement 
 	the corresponding begin_source and end_soure callback function and call the beginSource and 
 	endSource function. All the tags in between are handled by this class. It provides an array,
-	containing all the loaded sources.
+	containing all the loaded sources. The values of float arrays written binary into an OpenCOLLADA_binary
+	technique of the source are read as well, if the array does not contain them as text.
     */
-    class SourceArrayLoader : public FilePartLoader
+    class SourceArrayLoader : public FilePartLoader, public BinaryArrayElementHandler::IReceiver
     {
 	public:
 		static const COLLADAFW::FloatOrDoubleArray::DataType DATA_TYPE_REAL;
 
 	protected:
+		/** The maximal number of values or indices, memory is reserved for in advance according to a 
+		count attribute. Counts are not trusted beyond, larger arrays grow with the data actually parsed.*/
+		static const size_t MAX_RESERVE_COUNT = 1 << 20;
 	
         /**
         * Provides the bulk of the mesh's vertex data. See main entry.
@@ -48,6 +53,9 @@ namespace COLLADASaxFWL
 		/** The id of the array being parsed.*/
 		String mCurrentArrayId;
 
+		/** True, while the binary arrays of an OpenCOLLADA_binary technique are read.*/
+		bool mReadingBinaryArrays;
+
 	public:
 		/** Takes a null terminated string, that represents an uriFragment of URIFragmentType defined in the 
 		COLLADA XSD and returns the id it points to.*/
@@ -72,6 +80,9 @@ namespace COLLADASaxFWL
 		/** Returns the id of the source being parsed.*/
 		const String& getCurrentSourceId() const { return mCurrentSourceId; }
 
+		/** Returns the number of values to reserve memory for, if a count attribute is @a count.*/
+		static size_t getReserveCount( uint64 count ) { return count < MAX_RESERVE_COUNT ? (size_t)count : MAX_RESERVE_COUNT; }
+
 		/** Clears all the source loaded by the source array loader.*/
 		void clearSources();
 
@@ -155,6 +166,24 @@ namespace COLLADASaxFWL
 		virtual bool data__param( const ParserChar* value, size_t length ){return true;}
 
 
+		/** Starts reading the binary arrays, if the technique is an OpenCOLLADA_binary technique of an element
+		that can receive them. Other techniques are passed to the extra data handlers.*/
+		virtual bool begin__technique( const technique__AttributeData& attributeData );
+
+		/** Stops reading the binary arrays.*/
+		virtual bool end__technique();
+
+		/** Implementation of BinaryArrayElementHandler::IReceiver. Accepts the values of the float array
+		of the current source, if it has not been filled from text.*/
+		virtual bool beginBinaryArray( BinaryArrayElementHandler::ValueType valueType, size_t valueCount );
+
+		/** Implementation of BinaryArrayElementHandler::IReceiver.*/
+		virtual bool binaryArrayData( BinaryArrayElementHandler::ValueType valueType, const char* data, size_t valueCount );
+
+	protected:
+		/** Returns true, if the element currently parsed takes binary arrays.*/
+		virtual bool receivesBinaryArrays() const;
+
 	private:
 
         /** Disable default copy ctor. */
@@ -170,7 +199,7 @@ namespace COLLADASaxFWL
 	SourceType* SourceArrayLoader::beginArray( uint64 count,  const ParserChar* id )
 	{
 		SourceType* newSource = new SourceType();
-		newSource->getArrayElement().getValues().allocMemory((size_t)count);
+		newSource->getArrayElement().getValues().allocMemory(getReserveCount(count));
 		newSource->setId(mCurrentSourceId);
 		mCurrentSoure = newSource;
 		if ( id )
@@ -17,6 +17,7 @@
 #include "COLLADASaxFWLColladaParserAutoGen15FunctionMapFactory.h"
 
 #include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserISectionFilter.h"
 
 namespace COLLADASaxFWL14
 {
@@ -26,6 +27,10 @@ namespace COLLADASaxFWL15
 {
     class ColladaParserAutoGen15Private;
 }
+namespace GeneratedSaxParser
+{
+    class SaxParser;
+}
 
 namespace COLLADASaxFWL
 {
@@ -34,8 +39,9 @@ namespace COLLADASaxFWL
     /**
      * Starts parsing a file to find out which COLLADA version it uses.
      * Creates appropriate parser and continues with that.
+     * As section filter it rejects the libraries not needed for the flags.
      */
-    class VersionParser : public GeneratedSaxParser::Parser
+    class VersionParser : public GeneratedSaxParser::Parser, public GeneratedSaxParser::ISectionFilter
     {
     private:
         /** The function map we use to parse the COLLADA file. It contains only those elements that are required 
@@ -54,6 +60,12 @@ namespace COLLADASaxFWL
         int mFlags;
         /** Indicates which parts of the file have already been parsed. */
         int& mParsedFlags;
+        /** The COLLADA elements required to parse all the objects listed in the flags, if libraries
+        are skipped.*/
+        int mRequiredElements;
+
+        /** The xml parser of a document passed in chunks, while it is parsed.*/
+        GeneratedSaxParser::SaxParser* mPushSaxParser;
 
     public:
         VersionParser(GeneratedSaxParser::IErrorHandler* errorHandler, 
@@ -79,7 +91,27 @@ namespace COLLADASaxFWL
         bool createAndLaunchParser();
         bool createAndLaunchParser(const char* buffer, int length);
 
+        /** Creates the xml parser for a document, that is passed in chunks by pushData().*/
+        bool beginPushParsing();
+
+        /** Parses the next @a length bytes of the document.
+        @return False, if parsing has been stopped.*/
+        bool pushData(const char* data, size_t length);
+
+        /** Parses the rest of the document and deletes the parser objects.*/
+        bool endPushParsing();
+
+        /** Implementation of ISectionFilter. Returns false for the libraries and the scene, if they are not 
+        needed for the flags.*/
+        virtual bool isSectionRequired( const ParserChar* elementName, size_t elementNameLength );
+
     protected:
+        /** Creates the xml parser configured by the loader.*/
+        GeneratedSaxParser::SaxParser* createSaxParser();
+
+        /** Deletes the generated parser objects created while parsing.*/
+        void deletePrivateParsers();
+
         void createFunctionMap14();
         void createFunctionMap15();
         bool parse14( const ParserChar* elementName, const ParserAttributes& attributes );
@@ -0,0 +1,17 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___PERFORMANCETEST_H__
+#define ___PERFORMANCETEST_H__
+
+void performanceTest();
+
+
+#endif // ___PERFORMANCETEST_H__
@@ -0,0 +1,17 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___BINARYARRAYUNITTEST_H__
+#define ___BINARYARRAYUNITTEST_H__
+
+bool binaryArrayUnitTest();
+
+
+#endif // ___BINARYARRAYUNITTEST_H__
@@ -0,0 +1,351 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLBinaryArrayElementHandler.h"
+#include "COLLADASaxFWLIFilePartLoader.h"
+
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserUtils.h"
+
+#include "COLLADABUURI.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+
+namespace COLLADASaxFWL
+{
+
+	const char* const BinaryArrayElementHandler::TECHNIQUE_PROFILE = "OpenCOLLADA_binary";
+
+	/** Number of decoded bytes collected, before they are passed to the receiver.*/
+	static const size_t DECODED_DATA_CHUNK_SIZE = 64*1024;
+
+	/** Maps the base64 characters to their values. All other characters are mapped to 64.*/
+	static unsigned char BASE64_VALUES[256];
+
+	/** Fills BASE64_VALUES, once the first handler is created.*/
+	static bool initializeBase64Values()
+	{
+		static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		memset( BASE64_VALUES, 64, sizeof(BASE64_VALUES) );
+		for ( unsigned char i = 0; i < 64; ++i )
+			BASE64_VALUES[(unsigned char)alphabet[i]] = i;
+		return true;
+	}
+
+	//------------------------------
+	static unsigned long long readLittleEndian( const char* data, size_t size )
+	{
+		unsigned long long bits = 0;
+		for ( size_t i = size; i > 0; --i )
+			bits = (bits << 8) | (unsigned char)data[i - 1];
+		return bits;
+	}
+
+	//------------------------------
+	static double readValue( BinaryArrayElementHandler::ValueType valueType, const char* data )
+	{
+		switch ( valueType )
+		{
+		case BinaryArrayElementHandler::VALUE_TYPE_FLOAT32:
+			{
+				unsigned int bits = (unsigned int)readLittleEndian( data, 4 );
+				float value;
+				memcpy( &value, &bits, 4 );
+				return value;
+			}
+		case BinaryArrayElementHandler::VALUE_TYPE_FLOAT64:
+			{
+				unsigned long long bits = readLittleEndian( data, 8 );
+				double value;
+				memcpy( &value, &bits, 8 );
+				return value;
+			}
+		case BinaryArrayElementHandler::VALUE_TYPE_UINT32:
+			return (double)readLittleEndian( data, 4 );
+		default:
+			return 0;
+		}
+	}
+
+	//------------------------------
+	BinaryArrayElementHandler::BinaryArrayElementHandler()
+		: mLoader(0)
+		, mReceiver(0)
+		, mElementDepth(0)
+		, mReceivingBase64(false)
+		, mValueType(VALUE_TYPE_UNKNOWN)
+		, mValueCount(0)
+		, mReceivedValueCount(0)
+		, mBase64Bits(0)
+		, mBase64BitCount(0)
+	{
+		static bool base64ValuesInitialized = initializeBase64Values();
+		(void)base64ValuesInitialized;
+	}
+
+	//------------------------------
+	BinaryArrayElementHandler::~BinaryArrayElementHandler()
+	{
+		MappedFileMap::iterator it = mMappedFiles.begin();
+		for ( ; it != mMappedFiles.end(); ++it )
+			delete it->second;
+	}
+
+	//------------------------------
+	void BinaryArrayElementHandler::begin( IFilePartLoader* loader, IReceiver* receiver )
+	{
+		mLoader = loader;
+		mReceiver = receiver;
+		mElementDepth = 0;
+		mReceivingBase64 = false;
+	}
+
+	//------------------------------
+	void BinaryArrayElementHandler::end()
+	{
+		mLoader = 0;
+		mReceiver = 0;
+		mReceivingBase64 = false;
+		std::vector<char>().swap( mDecodedData );
+	}
+
+	//------------------------------
+	size_t BinaryArrayElementHandler::getValueSize( ValueType valueType )
+	{
+		switch ( valueType )
+		{
+		case VALUE_TYPE_FLOAT32:
+		case VALUE_TYPE_UINT32:
+			return 4;
+		case VALUE_TYPE_FLOAT64:
+			return 8;
+		default:
+			return 0;
+		}
+	}
+
+	//------------------------------
+	void BinaryArrayElementHandler::convertValues( ValueType valueType, const char* data, size_t valueCount, float* values )
+	{
+#ifdef GENERATEDSAXPARSER_LITTLE_ENDIAN
+		if ( valueType == VALUE_TYPE_FLOAT32 )
+		{
+			// the binary data already has the memory layout of the floats
+			memcpy( values, data, valueCount * sizeof(float) );
+			return;
+		}
+#endif
+		size_t valueSize = getValueSize( valueType );
+		for ( size_t i = 0; i < valueCount; ++i )
+			values[i] = (float)readValue( valueType, data + i * valueSize );
+	}
+
+	//------------------------------
+	void BinaryArrayElementHandler::convertValues( ValueType valueType, const char* data, size_t valueCount, unsigned long long* values )
+	{
+		size_t valueSize = getValueSize( valueType );
+		if ( valueType == VALUE_TYPE_UINT32 )
+		{
+			for ( size_t i = 0; i < valueCount; ++i )
+				values[i] = readLittleEndian( data + i * valueSize, valueSize );
+		}
+		else
+		{
+			for ( size_t i = 0; i < valueCount; ++i )
+				values[i] = (unsigned long long)readValue( valueType, data + i * valueSize );
+		}
+	}
+
+	//------------------------------
+	bool BinaryArrayElementHandler::elementBegin( const ParserChar* elementName, const GeneratedSaxParser::xmlChar** attributes )
+	{
+		mElementDepth++;
+		if ( !mReceiver || mElementDepth != 1 || strcmp( elementName, "binary_array" ) != 0 )
+			return true;
+
+		const ParserChar* type = 0;
+		const ParserChar* count = 0;
+		const ParserChar* encoding = 0;
+		const ParserChar* url = 0;
+		const ParserChar* offset = 0;
+		if ( attributes )
+		{
+			for ( const GeneratedSaxParser::xmlChar** attribute = attributes; *attribute; attribute += 2 )
+			{
+				const ParserChar* name = (const ParserChar*)attribute[0];
+				const ParserChar* value = (const ParserChar*)attribute[1];
+				if ( strcmp( name, "type" ) == 0 )
+					type = value;
+				else if ( strcmp( name, "count" ) == 0 )
+					count = value;
+				else if ( strcmp( name, "encoding" ) == 0 )
+					encoding = value;
+				else if ( strcmp( name, "url" ) == 0 )
+					url = value;
+				else if ( strcmp( name, "offset" ) == 0 )
+					offset = value;
+			}
+		}
+
+		mValueType = VALUE_TYPE_UNKNOWN;
+		if ( type )
+		{
+			if ( strcmp( type, "float32" ) == 0 )
+				mValueType = VALUE_TYPE_FLOAT32;
+			else if ( strcmp( type, "float64" ) == 0 )
+				mValueType = VALUE_TYPE_FLOAT64;
+			else if ( strcmp( type, "uint32" ) == 0 )
+				mValueType = VALUE_TYPE_UINT32;
+		}
+		if ( mValueType == VALUE_TYPE_UNKNOWN || !count )
+			return handleError( "Binary array with unknown type or without count ignored." );
+
+		// the size of the array in bytes has to be representable
+		unsigned long long valueCount = strtoull( count, 0, 10 );
+		if ( valueCount > ((size_t)-1) / getValueSize(mValueType) )
+			return handleError( "Binary array with invalid count ignored." );
+		mValueCount = (size_t)valueCount;
+		mReceivedValueCount = 0;
+
+		if ( url )
+			return readFromFile( url, offset ? strtoull( offset, 0, 10 ) : 0 );
+
+		if ( encoding && strcmp( encoding, "base64" ) == 0 )
+		{
+			if ( !mReceiver->beginBinaryArray( mValueType, mValueCount ) )
+				return true;
+			mReceivingBase64 = true;
+			mBase64Bits = 0;
+			mBase64BitCount = 0;
+			mDecodedData.clear();
+			mDecodedData.reserve( std::min( mValueCount * getValueSize(mValueType), DECODED_DATA_CHUNK_SIZE ) + 8 );
+			return true;
+		}
+
+		return handleError( "Binary array without url and with unsupported encoding ignored." );
+	}
+
+	//------------------------------
+	bool BinaryArrayElementHandler::elementEnd( const ParserChar* elementName )
+	{
+		if ( mElementDepth > 0 )
+			mElementDepth--;
+		if ( !mReceivingBase64 || mElementDepth != 0 )
+			return true;
+
+		mReceivingBase64 = false;
+		if ( !passDecodedData() )
+			return false;
+		if ( mReceivedValueCount != mValueCount )
+			return handleError( "Binary array contains less values than given by its count attribute." );
+		return true;
+	}
+
+	//------------------------------
+	bool BinaryArrayElementHandler::textData( const ParserChar* text, size_t textLength )
+	{
+		if ( !mReceivingBase64 )
+			return true;
+
+		for ( size_t i = 0; i < textLength; ++i )
+		{
+			unsigned char value = BASE64_VALUES[(unsigned char)text[i]];
+			// skips white spaces and the padding
+			if ( value >= 64 )
+				continue;
+
+			mBase64Bits = (mBase64Bits << 6) | value;
+			mBase64BitCount += 6;
+			if ( mBase64BitCount >= 8 )
+			{
+				mBase64BitCount -= 8;
+				mDecodedData.push_back( (char)((mBase64Bits >> mBase64BitCount) & 0xff) );
+			}
+		}
+
+		if ( mDecodedData.size() >= DECODED_DATA_CHUNK_SIZE )
+			return passDecodedData();
+		return true;
+	}
+
+	//------------------------------
+	bool BinaryArrayElementHandler::passDecodedData()
+	{
+		size_t valueSize = getValueSize( mValueType );
+		size_t valueCount = std::min( mDecodedData.size() / valueSize, mValueCount - mReceivedValueCount );
+		if ( valueCount == 0 )
+		{
+			// values beyond the count attribute are dropped
+			if ( mReceivedValueCount == mValueCount )
+				mDecodedData.clear();
+			return true;
+		}
+
+		if ( !mReceiver->binaryArrayData( mValueType, &mDecodedData[0], valueCount ) )
+			return false;
+		mReceivedValueCount += valueCount;
+
+		// keep the bytes of an incomplete value for the next text
+		mDecodedData.erase( mDecodedData.begin(), mDecodedData.begin() + valueCount * valueSize );
+		return true;
+	}
+
+	//------------------------------
+	bool BinaryArrayElementHandler::readFromFile( const ParserChar* url, unsigned long long offset )
+	{
+		const GeneratedSaxParser::MemoryMappedFile* mappedFile = getMappedFile( url );
+		if ( !mappedFile )
+			return handleError( String("Could not read binary file \"") + url + "\"." );
+
+		// elementBegin() made sure, the size does not overflow
+		size_t size = mValueCount * getValueSize( mValueType );
+		if ( offset > mappedFile->getSize() || size > mappedFile->getSize() - offset )
+			return handleError( String("Binary array exceeds binary file \"") + url + "\"." );
+
+		if ( !mReceiver->beginBinaryArray( mValueType, mValueCount ) || mValueCount == 0 )
+			return true;
+		// the values are passed straight from the mapped pages
+		if ( !mReceiver->binaryArrayData( mValueType, mappedFile->getData() + offset, mValueCount ) )
+			return false;
+		mReceivedValueCount = mValueCount;
+		return true;
+	}
+
+	//------------------------------
+	const GeneratedSaxParser::MemoryMappedFile* BinaryArrayElementHandler::getMappedFile( const String& url )
+	{
+		MappedFileMap::const_iterator it = mMappedFiles.find( url );
+		if ( it != mMappedFiles.end() )
+			return it->second;
+
+		COLLADABU::URI fileUri( mLoader->getFileUri(), url );
+		GeneratedSaxParser::MemoryMappedFile* mappedFile = new GeneratedSaxParser::MemoryMappedFile();
+		if ( !mappedFile->open( fileUri.toNativePath().c_str() ) )
+		{
+			delete mappedFile;
+			mappedFile = 0;
+		}
+		// failures are remembered as well, so the file is not opened again for each array
+		mMappedFiles[url] = mappedFile;
+		return mappedFile;
+	}
+
+	//------------------------------
+	bool BinaryArrayElementHandler::handleError( const String& message )
+	{
+		mReceivingBase64 = false;
+		return !mLoader->handleFWLError( SaxFWLError::ERROR_DATA_NOT_VALID, message );
+	}
+
+} // namespace COLLADASaxFWL
@@ -20,6 +20,7 @@ namespace COLLADASaxFWL
     ExtraDataElementHandler::ExtraDataElementHandler() 
         : mExtraDataCallbackHandlerList (0)
         , mCallbackHandlersCallingList (0)
+        , mOverridingElementHandler (0)
 	{
 	}
 	
@@ -57,6 +58,9 @@ namespace COLLADASaxFWL
     //------------------------------
     bool ExtraDataElementHandler::elementBegin( const ParserChar* elementName, const GeneratedSaxParser::xmlChar** attributes )
     {
+        if ( mOverridingElementHandler )
+            return mOverridingElementHandler->elementBegin ( elementName, attributes );
+
         // Go through the list of extra data callback handlers and call the elementBegin method.
         const size_t numHandlers = mExtraDataCallbackHandlerList.size ();
         if ( numHandlers > 0 && !mCallbackHandlersCallingList ) return false;
@@ -75,6 +79,9 @@ namespace COLLADASaxFWL
     //------------------------------
     bool ExtraDataElementHandler::elementEnd( const ParserChar* elementName )
     {
+        if ( mOverridingElementHandler )
+            return mOverridingElementHandler->elementEnd ( elementName );
+
         // Go through the list of extra data callback handlers and call the elementEnd method.
         const size_t numHandlers = mExtraDataCallbackHandlerList.size ();
         if ( numHandlers > 0 && !mCallbackHandlersCallingList ) return false;
@@ -93,6 +100,9 @@ namespace COLLADASaxFWL
     //------------------------------
     bool ExtraDataElementHandler::textData( const ParserChar* text, size_t textLength )
     {
+        if ( mOverridingElementHandler )
+            return mOverridingElementHandler->textData ( text, textLength );
+
         // Go through the list of extra data callback handlers and call the textData method.
         const size_t numHandlers = mExtraDataCallbackHandlerList.size ();
         if ( numHandlers > 0 && !mCallbackHandlersCallingList ) return false;
@@ -29,12 +29,14 @@
 
 #include "COLLADAFWObject.h"
 
+#if !defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML) && !defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+#	error "No prepocesser flag set to chose the xml parser to use"
+#endif
 #if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
 #	include "GeneratedSaxParserLibxmlSaxParser.h"
-#elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+#endif
+#if defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
 #	include "GeneratedSaxParserExpatSaxParser.h"
-#else
-#	error "No prepocesser flag set to chose the xml parser to use"
 #endif
 
 #if defined(COLLADABU_OS_WIN)
@@ -68,6 +70,8 @@ namespace COLLADASaxFWL
 	//-----------------------------
 	FileLoader::~FileLoader()
 	{
+		// only a file passed in chunks, that has not been ended, still has a version parser
+		delete mVersionParser;
 	}
 
 	//-----------------------------
@@ -94,6 +98,42 @@ namespace COLLADASaxFWL
         return success;
 	}    
 
+	//-----------------------------
+	bool FileLoader::beginLoad()
+	{
+		// the version parser has to live until endLoad()
+		mVersionParser = new VersionParser( mSaxParserErrorHandler, this, mObjectFlags, mParsedObjectFlags );
+		mParsingStatus = PARSING_PARSING;
+		if ( !mVersionParser->beginPushParsing() )
+		{
+			delete mVersionParser;
+			mVersionParser = 0;
+			mParsingStatus = PARSING_FINISHED;
+			return false;
+		}
+		return true;
+	}
+
+	//-----------------------------
+	bool FileLoader::loadChunk( const char* data, size_t length )
+	{
+		if ( !mVersionParser )
+			return false;
+		return mVersionParser->pushData( data, length );
+	}
+
+	//-----------------------------
+	bool FileLoader::endLoad()
+	{
+		if ( !mVersionParser )
+			return false;
+		bool success = mVersionParser->endPushParsing();
+		mParsingStatus = PARSING_FINISHED;
+		delete mVersionParser;
+		mVersionParser = 0;
+		return success;
+	}
+
 	//-----------------------------
 	const COLLADABU::URI& FileLoader::getFileUri()
 	{
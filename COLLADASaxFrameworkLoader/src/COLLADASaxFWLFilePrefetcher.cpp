@@ -0,0 +1,181 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLFilePrefetcher.h"
+
+#include "GeneratedSaxParserMemoryMappedFile.h"
+
+#include <algorithm>
+#include <stdio.h>
+
+
+namespace COLLADASaxFWL
+{
+
+	/** Size of the chunks a file is read in.*/
+	static const size_t READ_CHUNK_SIZE = 1024 * 1024;
+
+	/** Distance of the bytes touched in a memory mapped file. Not larger than the smallest page size.*/
+	static const size_t TOUCH_STRIDE = 4096;
+
+    //------------------------------
+	FilePrefetcher::FilePrefetcher( size_t threadCount, bool touchPagesOnly, size_t maxPendingFileCount )
+		: mPendingFileCount( 0 )
+		, mMaxPendingFileCount( maxPendingFileCount ? maxPendingFileCount : DEFAULT_MAX_PENDING_FILES_PER_THREAD * std::max(threadCount, (size_t)1) )
+		, mTouchPagesOnly( touchPagesOnly )
+		, mThreadPool( threadCount )
+	{
+	}
+
+    //------------------------------
+	FilePrefetcher::~FilePrefetcher()
+	{
+		mThreadPool.waitForAllTasks();
+
+		FileIdPrefetchedFileMap::iterator it = mPrefetchedFiles.begin();
+		for ( ; it != mPrefetchedFiles.end(); ++it )
+			delete it->second;
+	}
+
+	//------------------------------
+	void FilePrefetcher::prefetch( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri )
+	{
+		PrefetchedFile* prefetchedFile = new PrefetchedFile();
+		prefetchedFile->nativePath = fileUri.toNativePath();
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		PrefetchedFile*& entry = mPrefetchedFiles[fileId];
+		if ( entry )
+		{
+			// already requested
+			delete prefetchedFile;
+			return;
+		}
+		entry = prefetchedFile;
+		mQueuedFiles.push_back( prefetchedFile );
+		startQueuedFiles();
+	}
+
+	//------------------------------
+	void FilePrefetcher::startQueuedFiles()
+	{
+		while ( !mQueuedFiles.empty() && (mPendingFileCount < mMaxPendingFileCount) )
+		{
+			PrefetchedFile* prefetchedFile = mQueuedFiles.front();
+			mQueuedFiles.pop_front();
+			prefetchedFile->started = true;
+			++mPendingFileCount;
+			mThreadPool.addTask( std::bind( &FilePrefetcher::readFile, this, prefetchedFile ) );
+		}
+	}
+
+	//------------------------------
+	const FilePrefetcher::FileContent* FilePrefetcher::waitForFile( COLLADAFW::FileId fileId )
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		FileIdPrefetchedFileMap::const_iterator it = mPrefetchedFiles.find(fileId);
+		if ( it == mPrefetchedFiles.end() )
+			return 0;
+
+		// a file not started yet is read by the loader itself, instead of waiting for a worker
+		PrefetchedFile* prefetchedFile = it->second;
+		if ( !prefetchedFile->started )
+			return 0;
+
+		while ( !prefetchedFile->finished )
+			mFileFinished.wait(lock);
+
+		return (prefetchedFile->succeeded && !mTouchPagesOnly) ? &prefetchedFile->content : 0;
+	}
+
+	//------------------------------
+	void FilePrefetcher::release( COLLADAFW::FileId fileId )
+	{
+		PrefetchedFile* prefetchedFile = 0;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			FileIdPrefetchedFileMap::iterator it = mPrefetchedFiles.find(fileId);
+			if ( it == mPrefetchedFiles.end() )
+				return;
+
+			prefetchedFile = it->second;
+			if ( prefetchedFile->started )
+			{
+				while ( !prefetchedFile->finished )
+					mFileFinished.wait(lock);
+				--mPendingFileCount;
+			}
+			else
+			{
+				mQueuedFiles.erase( std::find( mQueuedFiles.begin(), mQueuedFiles.end(), prefetchedFile ) );
+			}
+			mPrefetchedFiles.erase(it);
+			startQueuedFiles();
+		}
+		delete prefetchedFile;
+	}
+
+	//------------------------------
+	void FilePrefetcher::readFile( PrefetchedFile* prefetchedFile )
+	{
+		// the content is read outside the lock, nobody else accesses it before finished is set
+		FileContent content;
+		bool succeeded = mTouchPagesOnly ? touchFile( prefetchedFile->nativePath ) : copyFile( prefetchedFile->nativePath, content );
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			prefetchedFile->content.swap( content );
+			prefetchedFile->succeeded = succeeded;
+			prefetchedFile->finished = true;
+		}
+		mFileFinished.notify_all();
+	}
+
+	//------------------------------
+	bool FilePrefetcher::copyFile( const String& nativePath, FileContent& content )
+	{
+		FILE* file = fopen( nativePath.c_str(), "rb" );
+		if ( !file )
+			return false;
+
+		size_t size = 0;
+		for ( ;; )
+		{
+			content.resize( size + READ_CHUNK_SIZE );
+			size_t bytesRead = fread( &content[size], 1, READ_CHUNK_SIZE, file );
+			size += bytesRead;
+			if ( bytesRead < READ_CHUNK_SIZE )
+				break;
+		}
+		bool succeeded = (ferror(file) == 0);
+		content.resize( size );
+		fclose( file );
+		return succeeded;
+	}
+
+	//------------------------------
+	bool FilePrefetcher::touchFile( const String& nativePath )
+	{
+		GeneratedSaxParser::MemoryMappedFile mappedFile;
+		if ( !mappedFile.open( nativePath.c_str() ) )
+			return false;
+
+		// reading one byte per page makes the operating system read the file, without copying it
+		const volatile char* data = mappedFile.getData();
+		size_t size = mappedFile.getSize();
+		char sum = 0;
+		for ( size_t i = 0; i < size; i += TOUCH_STRIDE )
+			sum ^= data[i];
+		(void)sum;
+		return true;
+	}
+
+} // namespace COLLADASaxFWL
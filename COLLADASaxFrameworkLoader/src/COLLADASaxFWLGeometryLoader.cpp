@@ -64,6 +64,9 @@ namespace COLLADASaxFWL
         default:
             break;
         }
+		// the stream writer receives the mesh before its sources are parsed
+		if ( mMeshLoader->isStreamed() && !meshStreamWriter()->beginMesh( mMeshLoader->getMesh() ) )
+			return false;
 		return true;
 	}
 
@@ -99,7 +102,10 @@ namespace COLLADASaxFWL
 		COLLADAFW::Mesh * mesh = mMeshLoader ? mMeshLoader->getMesh() : 0;
 		if ( ((getObjectFlags() & Loader::GEOMETRY_FLAG) != 0) && mesh )
 		{
-			success |= writer()->writeGeometry(mesh);
+			if ( mMeshLoader->isStreamed() )
+				success = meshStreamWriter()->endMesh(mesh);
+			else
+				success |= writer()->writeGeometry(mesh);
 		}
 
         COLLADAFW::Spline * spline = mSplineLoader ? mSplineLoader->getSpline() : 0;
@@ -46,6 +46,12 @@ namespace COLLADASaxFWL
 		return getColladaLoader()->writer();
 	}
 
+	//-----------------------------
+	COLLADAFW::IMeshStreamWriter* IFilePartLoader::meshStreamWriter()
+	{
+		return getColladaLoader()->meshStreamWriter();
+	}
+
 	//-----------------------------
 	const COLLADAFW::UniqueId& IFilePartLoader::createUniqueId( const String& uriString, COLLADAFW::ClassId classId )
 	{
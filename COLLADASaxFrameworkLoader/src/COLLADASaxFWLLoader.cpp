@@ -11,12 +11,15 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADASaxFWLStableHeaders.h"
 #include "COLLADASaxFWLLoader.h"
 #include "COLLADASaxFWLFileLoader.h"
+#include "COLLADASaxFWLFilePrefetcher.h"
 #include "COLLADASaxFWLPostProcessor.h"
 #include "COLLADASaxFWLSaxParserErrorHandler.h"
 #include "COLLADASaxFWLUtils.h"
 
 #include "COLLADABUURI.h"
 
+#include "GeneratedSaxParserZipArchive.h"
+
 #include "COLLADAFWVisualScene.h"
 #include "COLLADAFWLibraryNodes.h"
 #include "COLLADAFWIWriter.h"
@@ -29,6 +32,7 @@ http://www.opensource.org/licenses/mit-license.php
 #include <sys/types.h>
 #include <sys/timeb.h>
 #include <fstream>
+#include <algorithm>
 
 namespace COLLADASaxFWL
 {
@@ -49,6 +53,21 @@ namespace COLLADASaxFWL
 		, mSidTreeRoot( new SidTreeNode("", 0) )
 		, mSkinControllerSet( compare )
 		, mExternalReferenceDeciderCallbackFunction()
+		, mUseMemoryMappedFiles(false)
+#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
+		, mXmlParser(XMLPARSER_LIBXML_SAX1)
+#else
+		, mXmlParser(XMLPARSER_EXPAT)
+#endif
+		, mSkipUnusedLibraries(false)
+		, mFileLoadingThreadCount(0)
+		, mFilePrefetcher(0)
+		, mPushSaxParserErrorHandler(0)
+		, mArchive(0)
+		, mMemoryArena(0)
+		, mDeleteMemoryArena(false)
+		, mMeshStreamWriter(0)
+		, mMeshStreamMaxVertexCount(DEFAULT_MESH_STREAM_MAX_VERTEX_COUNT)
 
 	{
 	}
@@ -57,6 +76,12 @@ namespace COLLADASaxFWL
 	//---------------------------------
 	Loader::~Loader()
 	{
+		// a document passed in chunks, that has not been ended
+		delete mFileLoader;
+		delete mPushSaxParserErrorHandler;
+		delete mFilePrefetcher;
+		delete mArchive;
+
 		delete mSidTreeRoot;
 
 		// delete visual scenes
@@ -83,6 +108,19 @@ namespace COLLADASaxFWL
 			COLLADAFW::AnimationList* animationList = it->second;
 			FW_DELETE animationList;
 		}
+
+		// the objects deleted above might have been allocated from the arena
+		if ( mDeleteMemoryArena )
+			delete mMemoryArena;
+	}
+
+	//---------------------------------
+	void Loader::setMemoryArena( COLLADAFW::MemoryArena* memoryArena, bool deleteWithLoader )
+	{
+		if ( mDeleteMemoryArena && (memoryArena != mMemoryArena) )
+			delete mMemoryArena;
+		mMemoryArena = memoryArena;
+		mDeleteMemoryArena = deleteWithLoader && (memoryArena != 0);
 	}
 
     //---------------------------------
@@ -189,6 +227,50 @@ namespace COLLADASaxFWL
 	{
 		mURIFileIdMap[uri] = fileId;
 		mFileIdURIMap[fileId] = uri;
+
+		if ( mFilePrefetcher && (fileId != 0) )
+		{
+			// decide now, to not read files that will not be loaded. Members of the archive are inflated
+			// while they are parsed.
+			bool loadFile = shouldLoadFile( fileId, uri );
+			mLoadFileDecisions[fileId] = loadFile;
+			String memberName;
+			if ( loadFile && !getArchiveMemberName( uri, memberName ) )
+				mFilePrefetcher->prefetch( fileId, uri );
+		}
+	}
+
+	//---------------------------------
+	bool Loader::shouldLoadFile( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri )
+	{
+		if ( (fileId == 0) || !mExternalReferenceDeciderCallbackFunction )
+			return true;
+
+		FileIdBoolMap::const_iterator it = mLoadFileDecisions.find( fileId );
+		if ( it != mLoadFileDecisions.end() )
+			return it->second;
+
+		return mExternalReferenceDeciderCallbackFunction( fileUri, fileId );
+	}
+
+	//---------------------------------
+	bool Loader::loadFile( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri )
+	{
+		// memory mapped files are only brought into the page cache in advance, there is nothing to wait for
+		const FilePrefetcher::FileContent* content = (mFilePrefetcher && !mUseMemoryMappedFiles) ? mFilePrefetcher->waitForFile( fileId ) : 0;
+
+		// gzip compressed files are decompressed while they are parsed by load()
+		bool useContent = content 
+			&& !content->empty()
+			&& (content->size() <= (size_t)std::numeric_limits<int>::max())
+			&& !((content->size() >= 2) && ((unsigned char)(*content)[0] == 0x1f) && ((unsigned char)(*content)[1] == 0x8b));
+
+		bool success = useContent ? mFileLoader->load( &(*content)[0], (int)content->size() ) : mFileLoader->load();
+
+		if ( mFilePrefetcher )
+			mFilePrefetcher->release( fileId );
+
+		return success;
 	}
 
 	//---------------------------------
@@ -198,24 +280,49 @@ namespace COLLADASaxFWL
 			return false;
 		mWriter = writer;
 
+		COLLADAFW::MemoryArena::ScopedCurrentArena scopedArena(mMemoryArena);
+
 		mWriter->start();
 
 		SaxParserErrorHandler saxParserErrorHandler(mErrorHandler);
 
-		COLLADABU::URI rootFileUri(COLLADABU::URI::nativePathToUri(fileName));
+		// the root document of a .zae archive is read from the archive, its uri is the path of the member
+		String rootFileName = fileName;
+		String memberName;
+		mArchive = new GeneratedSaxParser::ZipArchive();
+		if ( mArchive->openDocument( fileName, memberName ) )
+		{
+			rootFileName = mArchive->getFileName() + "/" + memberName;
+		}
+		else
+		{
+			delete mArchive;
+			mArchive = 0;
+		}
+
+		COLLADABU::URI rootFileUri(COLLADABU::URI::nativePathToUri(rootFileName));
+
+		if ( mFileLoadingThreadCount > 1 )
+			mFilePrefetcher = new FilePrefetcher( mFileLoadingThreadCount, mUseMemoryMappedFiles );
 		
 		// the root file has always file id 0
 		addFileIdUriPair( mNextFileId++, rootFileUri );
 
+		bool abortLoading = !loadFiles( saxParserErrorHandler );
+
+		return finishLoading( saxParserErrorHandler, abortLoading );
+	}
+
+	//---------------------------------
+	bool Loader::loadFiles( SaxParserErrorHandler& saxParserErrorHandler )
+	{
 		bool abortLoading = false;
 
 		while ( (mCurrentFileId < mNextFileId) && !abortLoading )
 		{
 			const COLLADABU::URI& fileUri = getFileUri( mCurrentFileId );
 
-			if ( (mCurrentFileId == 0) 
-				|| !mExternalReferenceDeciderCallbackFunction 
-				|| mExternalReferenceDeciderCallbackFunction(fileUri, mCurrentFileId) )
+			if ( shouldLoadFile( mCurrentFileId, fileUri ) )
 			{
 				mFileLoader = new FileLoader(this, 
 					fileUri,
@@ -223,14 +330,28 @@ namespace COLLADASaxFWL
 					mObjectFlags,
 					mParsedObjectFlags, 
 					mExtraDataCallbackHandlerList );
-				bool success = mFileLoader->load();
+				bool success = loadFile( mCurrentFileId, fileUri );
 				delete mFileLoader;
+				mFileLoader = 0;
 				abortLoading = !success;
 			}
 
 			mCurrentFileId++;
 		}
 
+		return !abortLoading;
+	}
+
+	//---------------------------------
+	bool Loader::finishLoading( SaxParserErrorHandler& saxParserErrorHandler, bool abortLoading )
+	{
+		// waits for files still being read, if loading has been aborted
+		delete mFilePrefetcher;
+		mFilePrefetcher = 0;
+		mLoadFileDecisions.clear();
+		delete mArchive;
+		mArchive = 0;
+
 		if ( !abortLoading )
 		{
 			PostProcessor postProcessor(this, 
@@ -251,12 +372,35 @@ namespace COLLADASaxFWL
 		return !abortLoading;
 	}
 
+	//---------------------------------
+	bool Loader::getArchiveMemberName( const COLLADABU::URI& fileUri, String& memberName ) const
+	{
+		if ( !mArchive )
+			return false;
+
+		// the uris of the members start with the path of the archive, passed through an uri as well
+		String archivePath = COLLADABU::URI(COLLADABU::URI::nativePathToUri(mArchive->getFileName())).toNativePath();
+		String path = fileUri.toNativePath();
+		if ( (path.size() <= archivePath.size() + 1) || (path.compare( 0, archivePath.size(), archivePath ) != 0) )
+			return false;
+
+		char separator = path[archivePath.size()];
+		if ( (separator != '/') && (separator != '\\') )
+			return false;
+
+		memberName = path.substr( archivePath.size() + 1 );
+		std::replace( memberName.begin(), memberName.end(), '\\', '/' );
+		return true;
+	}
+
 	//---------------------------------
 	bool Loader::loadDocument( const String& uri, const char* buffer, int length, COLLADAFW::IWriter* writer )
 	{
 		if ( !writer )
 			return false;
 		mWriter = writer;
+
+		COLLADAFW::MemoryArena::ScopedCurrentArena scopedArena(mMemoryArena);
         
 		SaxParserErrorHandler saxParserErrorHandler(mErrorHandler);
         
@@ -308,6 +452,73 @@ namespace COLLADASaxFWL
 		return !abortLoading;
 	}
 
+	//---------------------------------
+	bool Loader::beginDocument( const String& uri, COLLADAFW::IWriter* writer )
+	{
+		if ( !writer || mPushSaxParserErrorHandler )
+			return false;
+		mWriter = writer;
+
+		COLLADAFW::MemoryArena::ScopedCurrentArena scopedArena(mMemoryArena);
+
+		mWriter->start();
+
+		mPushSaxParserErrorHandler = new SaxParserErrorHandler(mErrorHandler);
+
+		COLLADABU::URI rootUri(uri);
+
+		if ( mFileLoadingThreadCount > 1 )
+			mFilePrefetcher = new FilePrefetcher( mFileLoadingThreadCount, mUseMemoryMappedFiles );
+
+		// the root file has always file id 0
+		addFileIdUriPair( mNextFileId++, rootUri );
+
+		// the file loader of the root file lives until endDocument()
+		mFileLoader = new FileLoader(this, 
+			getFileUri( mCurrentFileId ),
+			mPushSaxParserErrorHandler, 
+			mObjectFlags,
+			mParsedObjectFlags, 
+			mExtraDataCallbackHandlerList );
+		return mFileLoader->beginLoad();
+	}
+
+	//---------------------------------
+	bool Loader::feed( const char* chunk, size_t length )
+	{
+		if ( !mFileLoader || !mPushSaxParserErrorHandler )
+			return false;
+
+		COLLADAFW::MemoryArena::ScopedCurrentArena scopedArena(mMemoryArena);
+
+		return mFileLoader->loadChunk( chunk, length );
+	}
+
+	//---------------------------------
+	bool Loader::endDocument()
+	{
+		if ( !mFileLoader || !mPushSaxParserErrorHandler )
+			return false;
+
+		COLLADAFW::MemoryArena::ScopedCurrentArena scopedArena(mMemoryArena);
+
+		bool abortLoading = !mFileLoader->endLoad();
+		delete mFileLoader;
+		mFileLoader = 0;
+		mCurrentFileId++;
+
+		// the external referenced files are read from their uris
+		if ( !abortLoading )
+			abortLoading = !loadFiles( *mPushSaxParserErrorHandler );
+
+		bool success = finishLoading( *mPushSaxParserErrorHandler, abortLoading );
+
+		delete mPushSaxParserErrorHandler;
+		mPushSaxParserErrorHandler = 0;
+
+		return success;
+	}
+
     //---------------------------------
     bool Loader::registerExtraDataCallbackHandler ( IExtraDataCallbackHandler* extraDataCallbackHandler )
     {
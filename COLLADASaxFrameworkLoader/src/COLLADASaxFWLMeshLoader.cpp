@@ -24,6 +24,7 @@
 #include "COLLADAFWIWriter.h"
 
 #include <fstream>
+#include <algorithm>
 
 
 namespace COLLADASaxFWL
@@ -44,6 +45,7 @@ namespace COLLADASaxFWL
         , mCurrentVertexCount(0)
         , mCurrentLastPrimitiveVertexCount(0)
         , mCurrentPhHasEmptyP(true)
+        , mCurrentPHasIndices(false)
         , mCurrentExpectedVertexCount(0)
         , mCurrentFaceOrLineCount(0)
 		, mPositionsOffset (0)
@@ -59,6 +61,8 @@ namespace COLLADASaxFWL
 		, mCurrentPrimitiveType(NONE)
 		, mPOrPhElementCountOfCurrentPrimitive(0)
         , mInMesh (true)
+        , mStreamWriter ( ((getObjectFlags() & Loader::GEOMETRY_FLAG) != 0) ? meshStreamWriter() : 0 )
+        , mStreamMaxVertexCount ( getColladaLoader()->getMeshStreamMaxVertexCount() )
 	{
         if ( !geometryName.empty() )
             mMesh->setName ( geometryName );
@@ -67,6 +71,9 @@ namespace COLLADASaxFWL
 
         if ( !geometryId.empty() )
             mMesh->setOriginalId ( geometryId );
+
+        for ( int i = 0; i < COLLADAFW::IMeshStreamWriter::VERTEX_DATA_SEMANTIC_COUNT; ++i )
+            mStreamedValuesCounts[i] = 0;
 	}
 
     //------------------------------
@@ -119,7 +126,7 @@ namespace COLLADASaxFWL
 
  
     //------------------------------
-    void MeshLoader::loadSourceElements ( const MeshPrimitiveInputList& polyBaseElement )
+    bool MeshLoader::loadSourceElements ( const MeshPrimitiveInputList& polyBaseElement )
     {
         const InputSharedArray& inputArray = polyBaseElement.getInputArray ();
         size_t numInputElements = inputArray.getCount ();
@@ -128,9 +135,128 @@ namespace COLLADASaxFWL
             // Get the input element and read the semantic.
             InputShared* input = inputArray [n];
 
+            // The values of streamed sources have already been passed to the stream writer.
+            if ( mStreamWriter )
+            {
+                if ( !streamSourceElement ( *input ) )
+                    return false;
+                continue;
+            }
+
             // Load the source element of the current input element into the framework mesh.
             loadSourceElement ( *input );
         }
+        return true;
+    }
+
+    //------------------------------
+    bool MeshLoader::streamSourceValues ( const float* values, size_t valuesCount )
+    {
+        size_t firstValueIndex = mCurrentSoure->getStreamedValuesCount ();
+        mCurrentSoure->addStreamedValues ( valuesCount );
+        return mStreamWriter->writeMeshSourceData ( mMesh, mCurrentSoure->getId (), values, valuesCount, firstValueIndex );
+    }
+
+    //------------------------------
+    bool MeshLoader::streamSourceElement ( const InputShared& input )
+    {
+        COLLADAFW::IMeshStreamWriter::VertexDataSemantic vertexDataSemantic;
+        InputSemantic::Semantic semantic = input.getSemantic ();
+        switch ( semantic )
+        {
+        case InputSemantic::POSITION:
+            vertexDataSemantic = COLLADAFW::IMeshStreamWriter::POSITIONS;
+            break;
+        case InputSemantic::NORMAL:
+            vertexDataSemantic = COLLADAFW::IMeshStreamWriter::NORMALS;
+            break;
+        case InputSemantic::COLOR:
+            vertexDataSemantic = COLLADAFW::IMeshStreamWriter::COLORS;
+            break;
+        case InputSemantic::UV:
+        case InputSemantic::TEXCOORD:
+            vertexDataSemantic = COLLADAFW::IMeshStreamWriter::UV_COORDINATES;
+            break;
+        case InputSemantic::TEXTANGENT:
+            vertexDataSemantic = COLLADAFW::IMeshStreamWriter::TANGENTS;
+            break;
+        case InputSemantic::TEXBINORMAL:
+            vertexDataSemantic = COLLADAFW::IMeshStreamWriter::BINORMALS;
+            break;
+        default:
+            // Not implemented source
+            return true;
+        }
+
+        // Get the source element with the uri of the input element.
+        SourceBase* sourceBase = getSourceById ( input.getSource ().getFragment () );
+        if ( sourceBase == 0 ) return true;
+
+        // Check if the source element is already loaded.
+        if ( sourceBase->isLoadedInputElement ( semantic ) ) return true;
+        sourceBase->addLoadedInputElement ( semantic );
+
+        // the indices of following sources continue after the values of this one
+        size_t initialIndex = mStreamedValuesCounts[vertexDataSemantic];
+        size_t valuesCount = sourceBase->getStreamedValuesCount ();
+        sourceBase->setInitialIndex ( initialIndex );
+        mStreamedValuesCounts[vertexDataSemantic] += valuesCount;
+
+        return mStreamWriter->writeMeshVertexData ( mMesh, vertexDataSemantic, sourceBase->getId (), (size_t) sourceBase->getStride (), valuesCount, initialIndex );
+    }
+
+    //------------------------------
+    bool MeshLoader::appendCurrentMeshPrimitive ()
+    {
+        if ( mStreamWriter )
+        {
+            bool success = mStreamWriter->writeMeshPrimitive ( mMesh, mCurrentMeshPrimitive );
+            delete mCurrentMeshPrimitive;
+            mCurrentMeshPrimitive = 0;
+            return success;
+        }
+
+        mMesh->appendPrimitive ( mCurrentMeshPrimitive );
+        return true;
+    }
+
+    //------------------------------
+    bool MeshLoader::streamCompletedFaces ()
+    {
+        size_t faceVertexCount = 0;
+        COLLADAFW::MeshPrimitive* nextMeshPrimitive = 0;
+        switch ( mCurrentPrimitiveType )
+        {
+        case TRIANGLES:
+            faceVertexCount = 3;
+            break;
+        case LINES:
+            faceVertexCount = 2;
+            break;
+        default:
+            // the vertex counts of the other primitives are not known before they are complete
+            return true;
+        }
+
+        if ( (mCurrentVertexCount < mStreamMaxVertexCount) || (mCurrentVertexCount % faceVertexCount != 0) )
+            return true;
+
+        if ( mCurrentPrimitiveType == TRIANGLES )
+            nextMeshPrimitive = new COLLADAFW::Triangles(createUniqueId(COLLADAFW::Triangles::ID()));
+        else
+            nextMeshPrimitive = new COLLADAFW::Lines(createUniqueId(COLLADAFW::Lines::ID()));
+        nextMeshPrimitive->setMaterialId ( mCurrentMeshPrimitive->getMaterialId () );
+        nextMeshPrimitive->setMaterial ( mCurrentMeshPrimitive->getMaterial () );
+
+        mCurrentMeshPrimitive->setFaceCount ( mCurrentVertexCount / faceVertexCount );
+        bool success = appendCurrentMeshPrimitive ();
+
+        mCurrentMeshPrimitive = nextMeshPrimitive;
+        mCurrentExpectedVertexCount = mCurrentExpectedVertexCount > mCurrentVertexCount ? mCurrentExpectedVertexCount - mCurrentVertexCount : 0;
+        mCurrentVertexCount = 0;
+        // a failed reservation is not fatal here, the index lists grow while they are filled
+        reserveIndices ();
+        return success;
     }
 
     //------------------------------
@@ -218,8 +344,7 @@ namespace COLLADASaxFWL
 				}
                 else
 				{
-					positions.setData ( valuesArray.getData (), valuesArray.getCount () );
-					valuesArray.yieldOwnerShip();
+					positions.takeData ( valuesArray );
 				}
 
                 // Set the source base as loaded element.
@@ -248,8 +373,7 @@ namespace COLLADASaxFWL
 				}
                 else 
 				{
-					positions.setData ( valuesArray.getData (), valuesArray.getCount () );
-					valuesArray.yieldOwnerShip();
+					positions.takeData ( valuesArray );
 				}
                 
                 // Set the source base as loaded element.
@@ -310,8 +434,7 @@ namespace COLLADASaxFWL
 				}
                 else 
 				{
-					normals.setData ( valuesArray.getData (), valuesArray.getCount () );
-					valuesArray.yieldOwnerShip();
+					normals.takeData ( valuesArray );
 				}
 
                 // Set the source base as loaded element.
@@ -340,8 +463,7 @@ namespace COLLADASaxFWL
 				}
                 else 
 				{ 
-					normals.setData ( valuesArray.getData (), valuesArray.getCount () );
-					valuesArray.yieldOwnerShip();
+					normals.takeData ( valuesArray );
 				}
 
                 // Set the source base as loaded element.
@@ -644,6 +766,7 @@ namespace COLLADASaxFWL
                             texCoordIndices->setName ( tex.mName );
                             texCoordIndices->setStride ( tex.mStride );
                             texCoordIndices->setInitialIndex ( tex.mInitialIndex );
+                            texCoordIndices->getIndices().reserve ( getIndicesReserveCount () );
 
                             texCoordIndicesArray.append( texCoordIndices );
                         }
@@ -678,6 +801,7 @@ namespace COLLADASaxFWL
                             colorIndices->setName ( col.mName );
                             colorIndices->setStride ( col.mStride );
                             colorIndices->setInitialIndex ( col.mInitialIndex );
+                            colorIndices->getIndices().reserve ( getIndicesReserveCount () );
 
                             colorIndicesArray.append ( colorIndices );
                         }
@@ -695,6 +819,9 @@ namespace COLLADASaxFWL
 				// Reset the current offset value
 				mCurrentOffset = 0;
 				++mCurrentVertexCount;
+
+				if ( mStreamWriter && !streamCompletedFaces() )
+					return false;
 			}
 			else
 			{
@@ -706,6 +833,40 @@ namespace COLLADASaxFWL
 	}
 
 
+	//------------------------------
+	size_t MeshLoader::getIndicesReserveCount() const
+	{
+		// faces are streamed as soon as the limit is reached and the last face is complete
+		size_t vertexCount = mCurrentExpectedVertexCount;
+		if ( mStreamWriter && (vertexCount > mStreamMaxVertexCount + 2) )
+			vertexCount = mStreamMaxVertexCount + 2;
+		// the expected vertex count is taken from the count attribute and might be arbitrarily large
+		return getReserveCount(vertexCount);
+	}
+
+	//------------------------------
+	bool MeshLoader::reserveIndices()
+	{
+		size_t vertexCount = getIndicesReserveCount();
+		if ( !mCurrentMeshPrimitive || (vertexCount == 0) )
+			return true;
+
+		// each index list receives one index per vertex, independent of the number of inputs
+		bool success = true;
+		if ( mUsePositions )
+			success &= mCurrentMeshPrimitive->getPositionIndices().reserve(vertexCount);
+		if ( mUseNormals )
+			success &= mCurrentMeshPrimitive->getNormalIndices().reserve(vertexCount);
+		if ( mUseTangents )
+			success &= mCurrentMeshPrimitive->getTangentIndices().reserve(vertexCount);
+		if ( mUseBinormals )
+			success &= mCurrentMeshPrimitive->getBinormalIndices().reserve(vertexCount);
+
+		if ( !success )
+			handleFWLError(SaxFWLError::ERROR_DATA_NOT_VALID, "Could not allocate memory for the indices of a mesh primitive.", IError::SEVERITY_CRITICAL);
+		return success;
+	}
+
 	//------------------------------
 	bool MeshLoader::initializeOffsets()
 	{
@@ -973,6 +1134,7 @@ namespace COLLADASaxFWL
 		mCurrentMeshPrimitive = 0;
 		mCurrentFaceOrLineCount = 0;
 		mCurrentPhHasEmptyP = true;
+		mCurrentPHasIndices = false;
 		mPOrPhElementCountOfCurrentPrimitive = 0;
 	}
 
@@ -998,6 +1160,25 @@ namespace COLLADASaxFWL
 		return endSource();
 	}
 
+	//------------------------------
+	bool MeshLoader::begin__float_array( const float_array__AttributeData& attributeData )
+	{
+		if ( !mStreamWriter )
+			return SourceArrayLoader::begin__float_array( attributeData );
+
+		// the values are not stored
+		return beginArray<FloatSource>( 0, attributeData.id ) != 0;
+	}
+
+	//------------------------------
+	bool MeshLoader::data__float_array( const float* data, size_t length )
+	{
+		if ( !mStreamWriter )
+			return SourceArrayLoader::data__float_array( data, length );
+
+		return streamSourceValues( data, length );
+	}
+
 	//------------------------------
 	bool MeshLoader::begin__vertices( const vertices__AttributeData& attributeData )
 	{
@@ -1038,26 +1219,8 @@ namespace COLLADASaxFWL
 	{
 		mCurrentPrimitiveType = TRIANGLES;
 		mCurrentMeshPrimitive = new COLLADAFW::Triangles(createUniqueId(COLLADAFW::Triangles::ID()));
-		if ( (size_t)attributeData.count > 0)
-		{
-			mCurrentMeshPrimitive->getPositionIndices().reallocMemory((size_t)attributeData.count);
-			if ( mUseNormals )
-			{
-				mCurrentMeshPrimitive->getNormalIndices().reallocMemory((size_t)attributeData.count);
-			}
-
-            if ( mUseTangents )
-            {
-                mCurrentMeshPrimitive->getTangentIndices().reallocMemory((size_t)attributeData.count);
-            }
-
-            if ( mUseBinormals )
-            {
-                mCurrentMeshPrimitive->getBinormalIndices().reallocMemory((size_t)attributeData.count);
-            }
-
-			// TODO pre-alloc memory for uv indices
-		}
+		// the index lists are reserved in begin__p(), when the inputs are known
+		mCurrentExpectedVertexCount = 3 * (size_t)attributeData.count;
 		if ( attributeData.material )
 		{
 			mCurrentMeshPrimitive->setMaterialId(mMaterialIdInfo.getMaterialId(attributeData.material));
@@ -1069,12 +1232,13 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__triangles()
 	{
+		bool success = true;
 		size_t trianglesCount = mCurrentVertexCount/3;
 		// check if the triangles really contains triangles. If not, we will discard it
 		if ( trianglesCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(trianglesCount);
-			mMesh->appendPrimitive(mCurrentMeshPrimitive);
+			success = appendCurrentMeshPrimitive();
 		}
 		else
 		{
@@ -1083,7 +1247,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 
@@ -1115,7 +1279,7 @@ namespace COLLADASaxFWL
 	{
 		mCurrentPrimitiveType = POLYLIST;
         COLLADAFW::Polylist* polylist = new COLLADAFW::Polylist(createUniqueId(COLLADAFW::Polylist::ID()));
-		polylist->getGroupedVerticesVertexCountArray().allocMemory((size_t)attributeData.count);
+		polylist->getGroupedVerticesVertexCountArray().allocMemory(getReserveCount(attributeData.count));
 		mCurrentMeshPrimitive = polylist;
 		if ( attributeData.material )
 		{
@@ -1129,6 +1293,7 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__polylist()
 	{
+		bool success = true;
 		// check if there are enough vertices as expected by the vcount and that there exist at least
 		// one polygon. If not, we will discard it
 		if ( mCurrentVertexCount >= mCurrentExpectedVertexCount && mCurrentVertexCount > 0 )
@@ -1137,7 +1302,7 @@ namespace COLLADASaxFWL
 			COLLADAFW::Polylist::VertexCountArray& vertexCountArray = polylist->getGroupedVerticesVertexCountArray();
 
 			mCurrentMeshPrimitive->setFaceCount(vertexCountArray.getCount());
-			mMesh->appendPrimitive(mCurrentMeshPrimitive);
+			success = appendCurrentMeshPrimitive();
 		}
 		else
 		{
@@ -1146,7 +1311,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1156,6 +1321,7 @@ namespace COLLADASaxFWL
         if ( attributeData.material )
             mCurrentMeshMaterial = attributeData.material;
         mCurrentCOLLADAPrimitiveCount = (size_t)attributeData.count;
+        mCurrentExpectedVertexCount = 2 * mCurrentCOLLADAPrimitiveCount;
         return true;
 	}
 
@@ -1174,7 +1340,7 @@ namespace COLLADASaxFWL
 	{
 		COLLADAFW::Linestrips* lineStrips = new COLLADAFW::Linestrips(createUniqueId(COLLADAFW::Linestrips::ID()));
 		// The actual size might be bigger, but its a lower bound
-		lineStrips->getGroupedVerticesVertexCountArray().allocMemory((size_t)attributeData.count);
+		lineStrips->getGroupedVerticesVertexCountArray().allocMemory(getReserveCount(attributeData.count));
 		mCurrentMeshPrimitive = lineStrips;
 		mCurrentPrimitiveType = LINESTRIPS;
 		if ( attributeData.material )
@@ -1188,12 +1354,13 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__linestrips()
 	{
+		bool success = true;
 		mCurrentPrimitiveType = LINESTRIPS;
 		// check if there is at least one linestrip. If not, we will discard it.
 		if ( mCurrentFaceOrLineCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(mCurrentFaceOrLineCount);
-			mMesh->appendPrimitive(mCurrentMeshPrimitive);
+			success = appendCurrentMeshPrimitive();
 		}
 		else
 		{
@@ -1202,7 +1369,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1240,7 +1407,7 @@ namespace COLLADASaxFWL
 		mCurrentPrimitiveType = POLYGONS;
 		COLLADAFW::Polygons* polygons = new COLLADAFW::Polygons(createUniqueId(COLLADAFW::Polygons::ID()));
 		// The actual size might be bigger, but its a lower bound
-		polygons->getGroupedVerticesVertexCountArray().allocMemory((size_t)attributeData.count);
+		polygons->getGroupedVerticesVertexCountArray().allocMemory(getReserveCount(attributeData.count));
 		mCurrentMeshPrimitive = polygons;
 		if ( attributeData.material )
 		{
@@ -1253,11 +1420,12 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__polygons()
 	{
+		bool success = true;
 		// check if there is at least one polygon. If not, we will discard it.
 		if ( mCurrentFaceOrLineCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(mCurrentFaceOrLineCount);
-			mMesh->appendPrimitive(mCurrentMeshPrimitive);
+			success = appendCurrentMeshPrimitive();
 		}
 		else
 		{
@@ -1266,7 +1434,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1319,7 +1487,7 @@ namespace COLLADASaxFWL
 	{
 		COLLADAFW::Tristrips* tristrips = new COLLADAFW::Tristrips(createUniqueId(COLLADAFW::Tristrips::ID()));
 		// The actual size might be bigger, but its a lower bound
-		tristrips->getGroupedVerticesVertexCountArray().allocMemory((size_t)attributeData.count);
+		tristrips->getGroupedVerticesVertexCountArray().allocMemory(getReserveCount(attributeData.count));
 		mCurrentMeshPrimitive = tristrips;
 		mCurrentPrimitiveType = TRISTRIPS;
 		if ( attributeData.material )
@@ -1333,12 +1501,13 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__tristrips()
 	{
+		bool success = true;
 		mCurrentPrimitiveType = TRISTRIPS;
 		// check if there is at least one tristrip. If not, we will discard it.
 		if ( mCurrentFaceOrLineCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(mCurrentFaceOrLineCount);
-			mMesh->appendPrimitive(mCurrentMeshPrimitive);
+			success = appendCurrentMeshPrimitive();
 		}
 		else
 		{
@@ -1347,7 +1516,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1356,7 +1525,7 @@ namespace COLLADASaxFWL
 		mCurrentPrimitiveType = TRIFANS;
 		COLLADAFW::Trifans* trifans = new COLLADAFW::Trifans(createUniqueId(COLLADAFW::Trifans::ID()));
 		// The actual size might be bigger, but its a lower bound
-		trifans->getGroupedVerticesVertexCountArray().allocMemory((size_t)attributeData.count);
+		trifans->getGroupedVerticesVertexCountArray().allocMemory(getReserveCount(attributeData.count));
 		mCurrentMeshPrimitive = trifans;
 		if ( attributeData.material )
 		{
@@ -1369,11 +1538,12 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__trifans()
 	{
+		bool success = true;
 		// check if there is at least one trifan. If not, we will discard it.
 		if ( mCurrentFaceOrLineCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(mCurrentFaceOrLineCount);
-			mMesh->appendPrimitive(mCurrentMeshPrimitive);
+			success = appendCurrentMeshPrimitive();
 		}
 		else
 		{
@@ -1382,7 +1552,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1392,26 +1562,23 @@ namespace COLLADASaxFWL
 		{
 		case TRIANGLES:
 			{
-				loadSourceElements(mMeshPrimitiveInputs);
+				if ( !loadSourceElements(mMeshPrimitiveInputs) )
+					return false; // abort
 				if (initializeOffsets())
 					return false; // abort
+				if ( !reserveIndices() )
+					return false; // abort
 			}
 			break;
         case LINES:
             {
-                loadSourceElements(mMeshPrimitiveInputs);
+                if ( !loadSourceElements(mMeshPrimitiveInputs) )
+                    return false; // abort
 				if (initializeOffsets())
 					return false; // abort
                 mCurrentMeshPrimitive = new COLLADAFW::Lines(createUniqueId(COLLADAFW::Lines::ID()));
-                if ( mCurrentCOLLADAPrimitiveCount > 0)
-                {
-                    mCurrentMeshPrimitive->getPositionIndices().reallocMemory(mCurrentCOLLADAPrimitiveCount);
-                    if ( mUseNormals )
-                    {
-                        mCurrentMeshPrimitive->getNormalIndices().reallocMemory(mCurrentCOLLADAPrimitiveCount);
-                    }
-                    // TODO pre-alloc memory for uv indices
-                }
+                if ( !reserveIndices() )
+                    return false; // abort
                 mCurrentMeshPrimitive->setMaterialId(mMaterialIdInfo.getMaterialId(mCurrentMeshMaterial));
 				mCurrentMeshPrimitive->setMaterial(mCurrentMeshMaterial);
             }
@@ -1420,7 +1587,8 @@ namespace COLLADASaxFWL
 			{
 				if ( mPOrPhElementCountOfCurrentPrimitive == 0)
 				{
-					loadSourceElements(mMeshPrimitiveInputs);
+					if ( !loadSourceElements(mMeshPrimitiveInputs) )
+						return false; // abort
 					if (initializeOffsets())
 						return false; // abort
 				}
@@ -1460,9 +1628,12 @@ namespace COLLADASaxFWL
 			{
 				if ( mPOrPhElementCountOfCurrentPrimitive == 0)
 				{
-					loadSourceElements(mMeshPrimitiveInputs);
+					if ( !loadSourceElements(mMeshPrimitiveInputs) )
+						return false; // abort
 					if (initializeOffsets())
 						return false; // abort
+					// only the vertex count of polylists is known in advance, from the vcount element
+					reserveIndices();
 				}
 			}
 			break;
@@ -1490,7 +1661,11 @@ namespace COLLADASaxFWL
                 if ( linesCount > 0 )
                 {
                     mCurrentMeshPrimitive->setFaceCount(linesCount);
-                    mMesh->appendPrimitive(mCurrentMeshPrimitive);
+                    if ( !appendCurrentMeshPrimitive() )
+                    {
+                        initCurrentValues();
+                        return false; // abort
+                    }
                 }
                 else
                 {
@@ -1634,8 +1809,66 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::data__p( const unsigned long long* data, size_t length )
 	{
+		if ( length > 0 )
+			mCurrentPHasIndices = true;
 		return writePrimitiveIndices(data, length);
 	}
 
+	//------------------------------
+	bool MeshLoader::receivesBinaryArrays() const
+	{
+		if ( mCurrentPrimitiveType == NONE )
+			return SourceArrayLoader::receivesBinaryArrays();
+		return (mCurrentPrimitiveType == TRIANGLES) || (mCurrentPrimitiveType == POLYLIST);
+	}
+
+	//------------------------------
+	bool MeshLoader::beginBinaryArray( BinaryArrayElementHandler::ValueType valueType, size_t valueCount )
+	{
+		if ( (mCurrentPrimitiveType == NONE) && mStreamWriter )
+		{
+			// the values written as text are used, if there are any
+			return mCurrentSoure && (mCurrentSoure->getDataType() == SourceBase::DATA_TYPE_FLOAT) && (mCurrentSoure->getStreamedValuesCount() == 0);
+		}
+		if ( mCurrentPrimitiveType == NONE )
+			return SourceArrayLoader::beginBinaryArray( valueType, valueCount );
+
+		// the inputs are resolved in begin__p(), so the indices must follow the p element
+		if ( (mCurrentPrimitiveType != TRIANGLES) && (mCurrentPrimitiveType != POLYLIST) )
+			return false;
+		return (mPOrPhElementCountOfCurrentPrimitive > 0) && !mCurrentPHasIndices;
+	}
+
+	//------------------------------
+	bool MeshLoader::binaryArrayData( BinaryArrayElementHandler::ValueType valueType, const char* data, size_t valueCount )
+	{
+		const size_t BLOCK_SIZE = 1024;
+		size_t valueSize = BinaryArrayElementHandler::getValueSize( valueType );
+		if ( (mCurrentPrimitiveType == NONE) && mStreamWriter )
+		{
+			float values[BLOCK_SIZE];
+			for ( size_t i = 0; i < valueCount; i += BLOCK_SIZE )
+			{
+				size_t blockCount = std::min( BLOCK_SIZE, valueCount - i );
+				BinaryArrayElementHandler::convertValues( valueType, data + i * valueSize, blockCount, values );
+				if ( !streamSourceValues( values, blockCount ) )
+					return false;
+			}
+			return true;
+		}
+		if ( mCurrentPrimitiveType == NONE )
+			return SourceArrayLoader::binaryArrayData( valueType, data, valueCount );
+
+		unsigned long long indices[BLOCK_SIZE];
+		for ( size_t i = 0; i < valueCount; i += BLOCK_SIZE )
+		{
+			size_t blockCount = std::min( BLOCK_SIZE, valueCount - i );
+			BinaryArrayElementHandler::convertValues( valueType, data + i * valueSize, blockCount, indices );
+			if ( !writePrimitiveIndices( indices, blockCount ) )
+				return false;
+		}
+		return true;
+	}
+
 
 } // namespace COLLADASaxFWL
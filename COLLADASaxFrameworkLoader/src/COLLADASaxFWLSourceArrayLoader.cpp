@@ -10,6 +10,7 @@
 
 #include "COLLADASaxFWLStableHeaders.h"
 #include "COLLADASaxFWLSourceArrayLoader.h"
+#include "COLLADASaxFWLFileLoader.h"
 #include "COLLADAFWTypes.h"
 
 namespace COLLADASaxFWL
@@ -26,7 +27,8 @@ namespace COLLADASaxFWL
 	SourceArrayLoader::SourceArrayLoader(IFilePartLoader* callingFilePartLoader)
 		:FilePartLoader(callingFilePartLoader),
 		 mSourceArray( SourceArray::OWNER ),
-		 mCurrentSoure(0)
+		 mCurrentSoure(0),
+		 mReadingBinaryArrays(false)
 	{
 	}
 
@@ -69,8 +71,7 @@ namespace COLLADASaxFWL
 			FloatSource* source = ( FloatSource* ) sourceBase;
 			FloatArrayElement& arrayElement = source->getArrayElement();
 			COLLADAFW::FloatArray& valuesArray = arrayElement.getValues();
-			values->setData ( valuesArray.getData (), valuesArray.getCount () );
-			valuesArray.yieldOwnerShip();
+			values->takeData ( valuesArray );
 			return true;
 		}
 		else if (sourceBase->getDataType() == SourceBase::DATA_TYPE_DOUBLE)
@@ -80,8 +81,7 @@ namespace COLLADASaxFWL
 			DoubleSource* source = ( DoubleSource* ) sourceBase;
 			DoubleArrayElement& arrayElement = source->getArrayElement();
 			COLLADAFW::DoubleArray& valuesArray = arrayElement.getValues();
-			values->setData ( valuesArray.getData (), valuesArray.getCount () );
-			valuesArray.yieldOwnerShip();
+			values->takeData ( valuesArray );
 			return true;
 		}
 		else
@@ -239,5 +239,65 @@ namespace COLLADASaxFWL
 		return true;
 	}
 
+	//------------------------------
+	bool SourceArrayLoader::begin__technique( const technique__AttributeData& attributeData )
+	{
+		if ( !attributeData.profile || strcmp( attributeData.profile, BinaryArrayElementHandler::TECHNIQUE_PROFILE ) != 0 || !receivesBinaryArrays() )
+			return FilePartLoader::begin__technique( attributeData );
+
+		// the binary arrays are not passed to the extra data handlers
+		getFileLoader()->getBinaryArrayElementHandler().begin( this, this );
+		getFileLoader()->getExtraDataElementHandler().setOverridingElementHandler( &getFileLoader()->getBinaryArrayElementHandler() );
+		mReadingBinaryArrays = true;
+		return true;
+	}
+
+	//------------------------------
+	bool SourceArrayLoader::end__technique()
+	{
+		if ( !mReadingBinaryArrays )
+			return FilePartLoader::end__technique();
+
+		getFileLoader()->getExtraDataElementHandler().setOverridingElementHandler( 0 );
+		getFileLoader()->getBinaryArrayElementHandler().end();
+		mReadingBinaryArrays = false;
+		return true;
+	}
+
+	//------------------------------
+	bool SourceArrayLoader::receivesBinaryArrays() const
+	{
+		return mCurrentSoure && mCurrentSoure->getDataType() == SourceBase::DATA_TYPE_FLOAT;
+	}
+
+	//------------------------------
+	bool SourceArrayLoader::beginBinaryArray( BinaryArrayElementHandler::ValueType valueType, size_t valueCount )
+	{
+		if ( !mCurrentSoure || mCurrentSoure->getDataType() != SourceBase::DATA_TYPE_FLOAT )
+			return false;
+
+		// the values written as text are used, if there are any
+		FloatSource* source = (FloatSource*)mCurrentSoure;
+		COLLADAFW::FloatArray& array = source->getArrayElement().getValues();
+		if ( !array.empty() )
+			return false;
+		// the count of base64 encoded arrays is not checked in advance
+		array.reserve( getReserveCount( valueCount ) );
+		return true;
+	}
+
+	//------------------------------
+	bool SourceArrayLoader::binaryArrayData( BinaryArrayElementHandler::ValueType valueType, const char* data, size_t valueCount )
+	{
+		FloatSource* source = (FloatSource*)mCurrentSoure;
+		COLLADAFW::FloatArray& array = source->getArrayElement().getValues();
+		size_t count = array.getCount();
+		if ( !array.reallocMemory( count + valueCount ) )
+			return !handleFWLError( SaxFWLError::ERROR_DATA_NOT_VALID, "Could not allocate memory for the values of a binary array.", IError::SEVERITY_CRITICAL );
+		BinaryArrayElementHandler::convertValues( valueType, data, valueCount, array.getData() + count );
+		array.setCount( count + valueCount );
+		return true;
+	}
+
 
 } // namespace COLLADAFW
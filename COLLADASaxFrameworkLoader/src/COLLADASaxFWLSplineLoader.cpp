@@ -193,8 +193,7 @@ namespace COLLADASaxFWL
                     }
                     else
                     {
-                        positions.setData ( valuesArray.getData (), valuesArray.getCount () );
-                        valuesArray.yieldOwnerShip();
+                        positions.takeData ( valuesArray );
                     }
 
                     // Set the source base as loaded element.
@@ -223,8 +222,7 @@ namespace COLLADASaxFWL
                     }
                     else 
                     {
-                        positions.setData ( valuesArray.getData (), valuesArray.getCount () );
-                        valuesArray.yieldOwnerShip();
+                        positions.takeData ( valuesArray );
                     }
 
                     // Set the source base as loaded element.
@@ -285,8 +283,7 @@ namespace COLLADASaxFWL
                     }
                     else
                     {
-                        positions.setData ( valuesArray.getData (), valuesArray.getCount () );
-                        valuesArray.yieldOwnerShip();
+                        positions.takeData ( valuesArray );
                     }
 
                     // Set the source base as loaded element.
@@ -315,8 +312,7 @@ namespace COLLADASaxFWL
                     }
                     else 
                     {
-                        positions.setData ( valuesArray.getData (), valuesArray.getCount () );
-                        valuesArray.yieldOwnerShip();
+                        positions.takeData ( valuesArray );
                     }
 
                     // Set the source base as loaded element.
@@ -377,8 +373,7 @@ namespace COLLADASaxFWL
                     }
                     else
                     {
-                        positions.setData ( valuesArray.getData (), valuesArray.getCount () );
-                        valuesArray.yieldOwnerShip();
+                        positions.takeData ( valuesArray );
                     }
 
                     // Set the source base as loaded element.
@@ -407,8 +402,7 @@ namespace COLLADASaxFWL
                     }
                     else 
                     {
-                        positions.setData ( valuesArray.getData (), valuesArray.getCount () );
-                        valuesArray.yieldOwnerShip();
+                        positions.takeData ( valuesArray );
                     }
 
                     // Set the source base as loaded element.
@@ -15,6 +15,9 @@
 #include "COLLADASaxFWLRootParser15.h"
 
 #include "GeneratedSaxParserUtils.h"
+#include "GeneratedSaxParserZipArchive.h"
+
+#include <string.h>
 
 namespace COLLADASaxFWL
 {
@@ -154,6 +157,40 @@ namespace COLLADASaxFWL
     size_t libraryFlagsFunctionMapMapSize14 = sizeof(libraryFlagsFunctionMapMap14)/sizeof(LibraryFlagsFunctionMapPair14);
     size_t libraryFlagsFunctionMapMapSize15 = sizeof(libraryFlagsFunctionMapMap15)/sizeof(LibraryFlagsFunctionMapPair15);
 
+
+    struct LibraryNameFlagsPair
+    {
+        const char* name;
+        LibraryFlags flag;
+    };
+
+    // The children of the COLLADA element, that can be left out, if they are not required. The asset is 
+    // always parsed, since it is required by the schema.
+    LibraryNameFlagsPair libraryNameFlagsMap[] = {
+        {"library_animation_clips", COLLADA_LIBRARY_ANIMATION_CLIPS},
+        {"library_animations", COLLADA_LIBRARY_ANIMATIONS},
+        {"library_articulated_systems", COLLADA_LIBRARY_ARTICULATED_SYSTEMS},
+        {"library_cameras", COLLADA_LIBRARY_CAMERAS},
+        {"library_controllers", COLLADA_LIBRARY_CONTROLLERS},
+        {"library_effects", COLLADA_LIBRARY_EFFECTS},
+        {"library_force_fields", COLLADA_LIBRARY_FORCE_FIELDS},
+        {"library_formulas", COLLADA_LIBRARY_FORMULAS},
+        {"library_geometries", COLLADA_LIBRARY_GEOMETRIES},
+        {"library_images", COLLADA_LIBRARY_IMAGES},
+        {"library_joints", COLLADA_LIBRARY_JOINTS},
+        {"library_kinematics_models", COLLADA_LIBRARY_KINEMATICS_MODELS},
+        {"library_kinematics_scenes", COLLADA_LIBRARY_KINEMATICS_SCENES},
+        {"library_lights", COLLADA_LIBRARY_LIGHTS},
+        {"library_materials", COLLADA_LIBRARY_MATERIALS},
+        {"library_nodes", COLLADA_LIBRARY_NODES},
+        {"library_physics_materials", COLLADA_LIBRARY_PHYSICS_MATERIALS},
+        {"library_physics_models", COLLADA_LIBRARY_PHYSICS_MODELS},
+        {"library_physics_scenes", COLLADA_LIBRARY_PHYSICS_SCENES},
+        {"library_visual_scenes", COLLADA_LIBRARY_VISUAL_SCENES},
+        {"scene", COLLADA_SCENE}};
+
+    size_t libraryNameFlagsMapSize = sizeof(libraryNameFlagsMap)/sizeof(LibraryNameFlagsPair);
+
     template<class Flags>
     bool setInFirstUnsetInSecond(int firstFlags, int secondFlags, Flags flag)
     {
@@ -161,113 +198,121 @@ namespace COLLADASaxFWL
     }
 
     //------------------------------
-    template<class FlagsMapPair, class ElementFunctionMap>
-    void createFunctionMap( int flags, int& parsedFlags, ElementFunctionMap& functionMap, FlagsMapPair* flagsMapMap, size_t flagsMapMapSize )
+    /** Returns the COLLADA elements we need to parse to get all data needed to parse objects in @a flags
+    and adds the objects that will have been parsed in addition to @a afterLoadParsedObjectFlags.*/
+    int getRequiredElements( int flags, int parsedFlags, int& afterLoadParsedObjectFlags )
     {
-        // A combination of ObjectFlags, indicating which objects will have been parsed, after load() 
-        // has been called. These will be contained for sure.
-        // We need this to ensure that objects that are store by the Loader ( visual scene, library nodes, 
-        // effects, cameras, lights) are parsed only once.
-        int afterLoadParsedObjectFlags = parsedFlags | flags;
+        int requiredElements = 0;
 
-        if ( (flags & Loader::ALL_OBJECTS_MASK ) != Loader::ALL_OBJECTS_MASK )
+        if ( (flags & Loader::ASSET_FLAG) != 0 )
         {
-            // we need to set a customized function map, since we don't need all COLLADA libraries 
-            //determine which COLLADA elements we need to parse to get all date needed to parse objects in mObjectFlags
-            int requiredFunctionMaps = 0;
+            requiredElements|= COLLADA_ASSET;
+        }
 
-            if ( (flags & Loader::ASSET_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_ASSET;
-            }
+        if ( (flags & Loader::SCENE_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_SCENE;
+        }
 
-            if ( (flags & Loader::SCENE_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_SCENE;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::VISUAL_SCENES_FLAG) )
+        {
+            requiredElements|= COLLADA_LIBRARY_VISUAL_SCENES;
+            requiredElements|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::VISUAL_SCENES_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::LIBRARY_NODES_FLAG) )
+        {
+            requiredElements|= COLLADA_LIBRARY_NODES;
+            requiredElements|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::LIBRARY_NODES_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::GEOMETRY_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_GEOMETRIES;
+        }
 
-            if ( (flags & Loader::GEOMETRY_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_GEOMETRIES;
-            }
+        if ( (flags & Loader::MATERIAL_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_MATERIALS;
+        }
 
-            if ( (flags & Loader::MATERIAL_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_MATERIALS;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::EFFECT_FLAG) )
+        {
+            requiredElements|= COLLADA_LIBRARY_EFFECTS;
+            requiredElements|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::EFFECT_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::CAMERA_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_CAMERAS;
+            //requiredElements|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( (flags & Loader::CAMERA_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
-                //requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::IMAGE_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_IMAGES;
+        }
 
-            if ( (flags & Loader::IMAGE_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_IMAGES;
-            }
+        if ( (flags & Loader::LIGHT_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_LIGHTS;
+        }
 
-            if ( (flags & Loader::LIGHT_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
-            }
+        if ( (flags & Loader::ANIMATION_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( (flags & Loader::ANIMATION_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::ANIMATION_LIST_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_ANIMATIONS;
 
-            if ( (flags & Loader::ANIMATION_LIST_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+            requiredElements|= COLLADA_LIBRARY_VISUAL_SCENES;
+            afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
+            requiredElements|= COLLADA_LIBRARY_NODES;
+            afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
+            requiredElements|= COLLADA_LIBRARY_EFFECTS;
+            afterLoadParsedObjectFlags |= Loader::EFFECT_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
-                afterLoadParsedObjectFlags |= Loader::EFFECT_FLAG;
+            //requiredElements|= COLLADA_LIBRARY_CAMERAS;
+            //requiredElements|= COLLADA_LIBRARY_LIGHTS;
+        }
 
-                //requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
-                //requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
-            }
+        if ( (flags & Loader::CONTROLLER_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_CONTROLLERS;
 
-            if ( (flags & Loader::CONTROLLER_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
+            requiredElements|= COLLADA_LIBRARY_VISUAL_SCENES;
+            afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
+            requiredElements|= COLLADA_LIBRARY_NODES;
+            afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
+        }
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
-            }
+        if ( (flags & Loader::SKIN_CONTROLLER_DATA_FLAG) != 0 )
+        {
+            requiredElements|= COLLADA_LIBRARY_CONTROLLERS;
+        }
 
-            if ( (flags & Loader::SKIN_CONTROLLER_DATA_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
-            }
+        return requiredElements;
+    }
+
+    //------------------------------
+    template<class FlagsMapPair, class ElementFunctionMap>
+    void createFunctionMap( int flags, int& parsedFlags, ElementFunctionMap& functionMap, FlagsMapPair* flagsMapMap, size_t flagsMapMapSize )
+    {
+        // A combination of ObjectFlags, indicating which objects will have been parsed, after load() 
+        // has been called. These will be contained for sure.
+        // We need this to ensure that objects that are store by the Loader ( visual scene, library nodes, 
+        // effects, cameras, lights) are parsed only once.
+        int afterLoadParsedObjectFlags = parsedFlags | flags;
 
+        if ( (flags & Loader::ALL_OBJECTS_MASK ) != Loader::ALL_OBJECTS_MASK )
+        {
+            // we need to set a customized function map, since we don't need all COLLADA libraries 
+            int requiredFunctionMaps = getRequiredElements( flags, parsedFlags, afterLoadParsedObjectFlags );
 
             // Fills function map
             for ( size_t i = 0; i < flagsMapMapSize; ++i )
@@ -305,6 +350,8 @@ namespace COLLADASaxFWL
         , mFileLoader( fileLoader )
         , mFlags( flags )
         , mParsedFlags( parsedFlags )
+        , mRequiredElements( COLLADA_NO_FLAGS )
+        , mPushSaxParser( 0 )
     {
 
     }
@@ -312,29 +359,76 @@ namespace COLLADASaxFWL
     //------------------------------
     VersionParser::~VersionParser()
     {
-
+        // a document passed in chunks, that has not been ended
+        if ( mPushSaxParser )
+        {
+            delete mPushSaxParser;
+            deletePrivateParsers();
+        }
     }
 
     //------------------------------
-    bool VersionParser::createAndLaunchParser()
+    GeneratedSaxParser::SaxParser* VersionParser::createSaxParser()
     {
-        const COLLADABU::URI& fileURI = mFileLoader->getFileUri();
-        String nativePath = fileURI.toNativePath();
-        const char* fileName = nativePath.c_str();
+        Loader::XmlParser xmlParser = mFileLoader->getColladaLoader()->getXmlParser();
+#if defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+        if ( xmlParser == Loader::XMLPARSER_EXPAT )
+            return new GeneratedSaxParser::ExpatSaxParser( this, XMLPARSER_BUFFERSIZE );
+#endif
 #if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
-        GeneratedSaxParser::LibxmlSaxParser versionSaxParser( this );
-#elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
-        GeneratedSaxParser::ExpatSaxParser versionSaxParser( this, XMLPARSER_BUFFERSIZE );
+        if ( xmlParser == Loader::XMLPARSER_LIBXML_SAX2 )
+            return new GeneratedSaxParser::LibxmlSaxParser( this, GeneratedSaxParser::LibxmlSaxParser::SAX2 );
+        return new GeneratedSaxParser::LibxmlSaxParser( this, GeneratedSaxParser::LibxmlSaxParser::SAX1 );
+#else
+        return new GeneratedSaxParser::ExpatSaxParser( this, XMLPARSER_BUFFERSIZE );
 #endif
-        bool success = versionSaxParser.parseFile( fileName );
-
- //       mFileLoader->postProcess();
+    }
 
+    //------------------------------
+    void VersionParser::deletePrivateParsers()
+    {
         delete mPrivateParser14;
         delete mPrivateParser15;
+        mPrivateParser14 = 0;
+        mPrivateParser15 = 0;
 
         mFileLoader->setPrivateParser( (COLLADASaxFWL14::ColladaParserAutoGen14Private*)0 );
         mFileLoader->setPrivateParser( (COLLADASaxFWL15::ColladaParserAutoGen15Private*)0 );
+    }
+
+    //------------------------------
+    bool VersionParser::createAndLaunchParser()
+    {
+        const COLLADABU::URI& fileURI = mFileLoader->getFileUri();
+        String nativePath = fileURI.toNativePath();
+        const char* fileName = nativePath.c_str();
+        GeneratedSaxParser::SaxParser* versionSaxParser = createSaxParser();
+        // libraries not needed are left out only if the function map will not contain them anyway
+        GeneratedSaxParser::ISectionFilter* sectionFilter = 0;
+        if ( mFileLoader->getColladaLoader()->getSkipUnusedLibraries() && (mFlags & Loader::ALL_OBJECTS_MASK ) != Loader::ALL_OBJECTS_MASK )
+        {
+            int afterLoadParsedObjectFlags = mParsedFlags | mFlags;
+            mRequiredElements = getRequiredElements( mFlags, mParsedFlags, afterLoadParsedObjectFlags );
+            sectionFilter = this;
+        }
+
+        // members of a .zae archive and gzip compressed files are decompressed while they are parsed
+        const Loader* loader = mFileLoader->getColladaLoader();
+        String memberName;
+        bool success = false;
+        if ( loader->getArchiveMemberName( fileURI, memberName ) )
+            success = versionSaxParser->parseZipArchiveMember( *loader->getArchive(), memberName );
+        else if ( GeneratedSaxParser::SaxParser::isGzipFile( fileName ) )
+            success = versionSaxParser->parseGzipFile( fileName );
+        else if ( loader->getUseMemoryMappedFiles() )
+            success = versionSaxParser->parseMemoryMappedFile( fileName, sectionFilter );
+        else
+            success = versionSaxParser->parseFile( fileName );
+        delete versionSaxParser;
+
+ //       mFileLoader->postProcess();
+
+        deletePrivateParsers();
 
         return success;
     }
@@ -345,24 +439,70 @@ namespace COLLADASaxFWL
         const COLLADABU::URI& uri = mFileLoader->getFileUri();
         const char* uriString = uri.originalStr().c_str();
 //        const char* uriString = uri.getURIString().c_str();
-#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
-        GeneratedSaxParser::LibxmlSaxParser versionSaxParser( this );
-#elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
-        GeneratedSaxParser::ExpatSaxParser versionSaxParser( this, XMLPARSER_BUFFERSIZE );
-#endif
-        bool success = versionSaxParser.parseBuffer( uriString, buffer, length );
+        GeneratedSaxParser::SaxParser* versionSaxParser = createSaxParser();
+        bool success = versionSaxParser->parseBuffer( uriString, buffer, length );
+        delete versionSaxParser;
         
         //       mFileLoader->postProcess();
         
-        delete mPrivateParser14;
-        delete mPrivateParser15;
-        
-        mFileLoader->setPrivateParser( (COLLADASaxFWL14::ColladaParserAutoGen14Private*)0 );
-        mFileLoader->setPrivateParser( (COLLADASaxFWL15::ColladaParserAutoGen15Private*)0 );
+        deletePrivateParsers();
         
         return success;
     }
+
+    //------------------------------
+    bool VersionParser::beginPushParsing()
+    {
+        const COLLADABU::URI& uri = mFileLoader->getFileUri();
+        mPushSaxParser = createSaxParser();
+        if ( !mPushSaxParser->beginPushParsing( uri.originalStr().c_str() ) )
+        {
+            delete mPushSaxParser;
+            mPushSaxParser = 0;
+            return false;
+        }
+        return true;
+    }
+
+    //------------------------------
+    bool VersionParser::pushData( const char* data, size_t length )
+    {
+        if ( !mPushSaxParser )
+            return false;
+        return mPushSaxParser->pushData( data, length );
+    }
+
+    //------------------------------
+    bool VersionParser::endPushParsing()
+    {
+        if ( !mPushSaxParser )
+            return false;
+
+        bool success = mPushSaxParser->endPushParsing();
+
+        delete mPushSaxParser;
+        mPushSaxParser = 0;
+
+        deletePrivateParsers();
+
+        return success;
+    }
     
+    //------------------------------
+    bool VersionParser::isSectionRequired( const ParserChar* elementName, size_t elementNameLength )
+    {
+        for ( size_t i = 0; i < libraryNameFlagsMapSize; ++i )
+        {
+            const LibraryNameFlagsPair& libraryNameFlagsPair = libraryNameFlagsMap[i];
+            if ( strlen(libraryNameFlagsPair.name) == elementNameLength && memcmp( libraryNameFlagsPair.name, elementName, elementNameLength ) == 0 )
+            {
+                return (mRequiredElements & libraryNameFlagsPair.flag) != 0;
+            }
+        }
+        // asset, extra and unknown elements
+        return true;
+    }
+
     //------------------------------
     bool VersionParser::elementBegin( const ParserChar* elementName, const ParserAttributes& attributes )
     {
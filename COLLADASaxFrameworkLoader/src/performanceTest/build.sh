@@ -0,0 +1,20 @@
+
+OPTIONS="-O3 -Wall -Wno-unused-variable -Wno-unused-but-set-variable"
+
+INCLUDES="-I../../include -I../../include/generated14 -I../../include/generated15 -I../../include/performanceTest -I../../../GeneratedSaxParser/include -I../../../COLLADAFramework/include -I../../../COLLADABaseUtils/include -I../../../COLLADABaseUtils/include/Math -I../../../Externals/MathMLSolver/include -I../../../Externals/MathMLSolver/include/AST -I../../../Externals/pcre/include -I../../../Externals/UTF/include"
+
+PARSER14FILES="../generated14/COLLADASaxFWLColladaParserAutoGen14Private.cpp ../generated14/COLLADASaxFWLColladaParserAutoGen14PrivateEnums.cpp ../generated14/COLLADASaxFWLColladaParserAutoGen14PrivateFindElementHash.cpp ../generated14/COLLADASaxFWLColladaParserAutoGen14PrivateFunctionMap.cpp ../generated14/COLLADASaxFWLColladaParserAutoGen14PrivateNameMap.cpp "
+
+PARSER15FILES="../generated15/COLLADASaxFWLColladaParserAutoGen15Private.cpp ../generated15/COLLADASaxFWLColladaParserAutoGen15PrivateEnums.cpp ../generated15/COLLADASaxFWLColladaParserAutoGen15PrivateFindElementHash.cpp ../generated15/COLLADASaxFWLColladaParserAutoGen15PrivateFunctionMap.cpp ../generated15/COLLADASaxFWLColladaParserAutoGen15PrivateNameMap.cpp "
+
+GENERATEDSAXPARSERFILES="../../../GeneratedSaxParser/src/GeneratedSaxParserUtils.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserFloatingPointConverter.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserStackMemoryManager.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserParserTemplateBase.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserParser.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserParserError.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserNamespaceStack.cpp "
+
+BASEUTILSFILES="../../../COLLADABaseUtils/src/COLLADABUURI.cpp ../../../COLLADABaseUtils/src/COLLADABUStringUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUHashFunctions.cpp ../../../COLLADABaseUtils/src/COLLADABUNativeString.cpp ../../../Externals/UTF/src/ConvertUTF.c"
+
+FILES="main.cpp performanceTest.cpp "$PARSER14FILES$PARSER15FILES$GENERATEDSAXPARSERFILES$BASEUTILSFILES
+
+OUTPUTFILE="-o performanceTest"
+
+
+
+g++ $OPTIONS $INCLUDES $FILES $OUTPUTFILE
@@ -0,0 +1,209 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include "COLLADASaxFWLColladaParserAutoGen14Private.h"
+#include "COLLADASaxFWLColladaParserAutoGen15Private.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <string.h>
+#include <time.h>
+
+
+/** Number of geometries dispatched by each measurement.*/
+static const size_t GEOMETRY_COUNT = 200000;
+
+/** Number of values in each float_array and p element.*/
+static const size_t VALUE_COUNT = 9;
+
+
+/** One sax event.*/
+struct Event
+{
+	enum Type
+	{
+		BEGIN,
+		TEXT,
+		END
+	};
+
+	Type type;
+	const char* name;
+	/** Null terminated attribute name and value pairs for BEGIN, 0 if there are none.*/
+	const GeneratedSaxParser::ParserChar** attributes;
+	/** The text for TEXT.*/
+	const char* text;
+};
+
+typedef std::vector<Event> EventList;
+
+
+static const GeneratedSaxParser::ParserChar* GEOMETRY_ATTRIBUTES[] = { "id", "geometry", 0 };
+static const GeneratedSaxParser::ParserChar* SOURCE_ATTRIBUTES[] = { "id", "positions", 0 };
+static const GeneratedSaxParser::ParserChar* FLOAT_ARRAY_ATTRIBUTES[] = { "id", "positions-array", "count", "9", 0 };
+static const GeneratedSaxParser::ParserChar* ACCESSOR_ATTRIBUTES[] = { "source", "#positions-array", "count", "3", "stride", "3", 0 };
+static const GeneratedSaxParser::ParserChar* PARAM_ATTRIBUTES[] = { "name", "X", "type", "float", 0 };
+static const GeneratedSaxParser::ParserChar* VERTICES_ATTRIBUTES[] = { "id", "vertices", 0 };
+static const GeneratedSaxParser::ParserChar* VERTICES_INPUT_ATTRIBUTES[] = { "semantic", "POSITION", "source", "#positions", 0 };
+static const GeneratedSaxParser::ParserChar* TRIANGLES_ATTRIBUTES[] = { "count", "3", 0 };
+static const GeneratedSaxParser::ParserChar* TRIANGLES_INPUT_ATTRIBUTES[] = { "semantic", "VERTEX", "source", "#vertices", "offset", "0", 0 };
+
+
+//--------------------------------------------------------------------
+static double elapsedSeconds( clock_t startTime )
+{
+	return (double)(clock() - startTime) / CLOCKS_PER_SEC;
+}
+
+//--------------------------------------------------------------------
+static void addBegin( EventList& events, const char* name, const GeneratedSaxParser::ParserChar** attributes = 0 )
+{
+	Event event = { Event::BEGIN, name, attributes, 0 };
+	events.push_back( event );
+}
+
+//--------------------------------------------------------------------
+static void addText( EventList& events, const char* text )
+{
+	Event event = { Event::TEXT, 0, 0, text };
+	events.push_back( event );
+}
+
+//--------------------------------------------------------------------
+static void addEnd( EventList& events, const char* name )
+{
+	Event event = { Event::END, name, 0, 0 };
+	events.push_back( event );
+}
+
+//--------------------------------------------------------------------
+/** Creates the events of a geometry with one source and one triangles element, as in a typical
+COLLADA document. Most of the elements are dispatched to generated functions that do not call the
+implementation.*/
+static void createGeometryEvents( EventList& events, const char* floatArrayText, const char* pText )
+{
+	addBegin( events, "geometry", GEOMETRY_ATTRIBUTES );
+	addBegin( events, "mesh" );
+
+	addBegin( events, "source", SOURCE_ATTRIBUTES );
+	addBegin( events, "float_array", FLOAT_ARRAY_ATTRIBUTES );
+	addText( events, floatArrayText );
+	addEnd( events, "float_array" );
+	addBegin( events, "technique_common" );
+	addBegin( events, "accessor", ACCESSOR_ATTRIBUTES );
+	for ( size_t i = 0; i < 3; ++i )
+	{
+		addBegin( events, "param", PARAM_ATTRIBUTES );
+		addEnd( events, "param" );
+	}
+	addEnd( events, "accessor" );
+	addEnd( events, "technique_common" );
+	addEnd( events, "source" );
+
+	addBegin( events, "vertices", VERTICES_ATTRIBUTES );
+	addBegin( events, "input", VERTICES_INPUT_ATTRIBUTES );
+	addEnd( events, "input" );
+	addEnd( events, "vertices" );
+
+	addBegin( events, "triangles", TRIANGLES_ATTRIBUTES );
+	addBegin( events, "input", TRIANGLES_INPUT_ATTRIBUTES );
+	addEnd( events, "input" );
+	addBegin( events, "p" );
+	addText( events, pText );
+	addEnd( events, "p" );
+	addEnd( events, "triangles" );
+
+	addEnd( events, "mesh" );
+	addEnd( events, "geometry" );
+}
+
+//--------------------------------------------------------------------
+/** Passes @a geometryEvents GEOMETRY_COUNT times to a new parser of type PrivateParser.
+@return The time needed, a negative value if the parser failed.*/
+template<class PrivateParser, class ParserImpl>
+static double dispatch( const EventList& geometryEvents, const char* namespaceName, const char* version, bool cacheEnabled, size_t& elementCount )
+{
+	ParserImpl impl;
+	PrivateParser parser( &impl );
+	parser.setDispatchCacheEnabled( cacheEnabled );
+
+	const GeneratedSaxParser::ParserChar* rootAttributes[] = { "xmlns", namespaceName, "version", version, 0 };
+	GeneratedSaxParser::ParserAttributes colladaAttributes( rootAttributes );
+	GeneratedSaxParser::ParserAttributes noAttributes( 0 );
+
+	elementCount = 0;
+	clock_t startTime = clock();
+	bool success = parser.elementBegin( "COLLADA", colladaAttributes );
+	success = success && parser.elementBegin( "library_geometries", noAttributes );
+	for ( size_t i = 0; (i < GEOMETRY_COUNT) && success; ++i )
+	{
+		for ( EventList::const_iterator it = geometryEvents.begin(); (it != geometryEvents.end()) && success; ++it )
+		{
+			const Event& event = *it;
+			switch ( event.type )
+			{
+			case Event::BEGIN:
+				{
+					success = parser.elementBegin( event.name, GeneratedSaxParser::ParserAttributes(event.attributes) );
+					elementCount++;
+					break;
+				}
+			case Event::TEXT:
+				success = parser.textData( event.text, strlen(event.text) );
+				break;
+			case Event::END:
+				success = parser.elementEnd( event.name );
+				break;
+			}
+		}
+	}
+	success = success && parser.elementEnd( "library_geometries" );
+	success = success && parser.elementEnd( "COLLADA" );
+	double time = elapsedSeconds( startTime );
+	return success ? time : -1;
+}
+
+//--------------------------------------------------------------------
+template<class PrivateParser, class ParserImpl>
+static void compare( const char* title, const EventList& geometryEvents, const char* namespaceName, const char* version )
+{
+	size_t uncachedElementCount = 0;
+	size_t cachedElementCount = 0;
+	double uncachedTime = dispatch<PrivateParser, ParserImpl>( geometryEvents, namespaceName, version, false, uncachedElementCount );
+	double cachedTime = dispatch<PrivateParser, ParserImpl>( geometryEvents, namespaceName, version, true, cachedElementCount );
+
+	std::cout << title << ": " << uncachedElementCount << " elements, without dispatch cache " << uncachedTime << "s, with dispatch cache " << cachedTime << "s";
+	if ( uncachedTime < 0 || cachedTime < 0 )
+		std::cout << " (PARSING FAILED)";
+	else if ( cachedTime > 0 )
+		std::cout << ", speedup " << uncachedTime / cachedTime;
+	std::cout << std::endl;
+}
+
+//--------------------------------------------------------------------
+void performanceTest()
+{
+	std::string floatArrayText;
+	std::string pText;
+	for ( size_t i = 0; i < VALUE_COUNT; ++i )
+	{
+		floatArrayText += "0.5 ";
+		pText += ( i % 3 == 0 ) ? "0 " : ( i % 3 == 1 ) ? "1 " : "2 ";
+	}
+
+	EventList geometryEvents;
+	createGeometryEvents( geometryEvents, floatArrayText.c_str(), pText.c_str() );
+
+	compare<COLLADASaxFWL14::ColladaParserAutoGen14Private, COLLADASaxFWL14::ColladaParserAutoGen14>( "COLLADA 1.4 dispatch", geometryEvents, COLLADASaxFWL14::NAME_NAMESPACE_COLLADA, "1.4.1" );
+	compare<COLLADASaxFWL15::ColladaParserAutoGen15Private, COLLADASaxFWL15::ColladaParserAutoGen15>( "COLLADA 1.5 dispatch", geometryEvents, COLLADASaxFWL15::NAME_NAMESPACE_COLLADA, "1.5.0" );
+}
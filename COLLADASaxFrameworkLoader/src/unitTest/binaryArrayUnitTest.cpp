@@ -0,0 +1,337 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "binaryArrayUnitTest.h"
+
+#include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLIErrorHandler.h"
+
+#include "COLLADAFWRoot.h"
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWGeometry.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWMeshPrimitive.h"
+
+#include "COLLADASWStreamWriter.h"
+#include "COLLADASWLibraryGeometries.h"
+#include "COLLADASWSource.h"
+#include "COLLADASWVertices.h"
+#include "COLLADASWInputList.h"
+#include "COLLADASWPrimitves.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <stdio.h>
+
+
+static int errorCount = 0;
+
+/** Number of vertices of the test mesh.*/
+static const size_t VERTEX_COUNT = 100;
+
+/** Number of triangles of the test mesh.*/
+static const size_t TRIANGLE_COUNT = 98;
+
+
+/** Stores the positions and position indices of the first mesh loaded.*/
+class MeshRecorder : public COLLADAFW::IWriter
+{
+public:
+	std::vector<float> positions;
+	std::vector<unsigned int> indices;
+	size_t meshCount;
+
+	MeshRecorder() : meshCount(0) {}
+
+	virtual void cancel( const COLLADAFW::String& errorMessage ) {}
+	virtual void start() {}
+	virtual void finish() {}
+	virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset ) { return true; }
+	virtual bool writeScene( const COLLADAFW::Scene* scene ) { return true; }
+	virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene ) { return true; }
+	virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes ) { return true; }
+	virtual bool writeMaterial( const COLLADAFW::Material* material ) { return true; }
+	virtual bool writeEffect( const COLLADAFW::Effect* effect ) { return true; }
+	virtual bool writeCamera( const COLLADAFW::Camera* camera ) { return true; }
+	virtual bool writeImage( const COLLADAFW::Image* image ) { return true; }
+	virtual bool writeLight( const COLLADAFW::Light* light ) { return true; }
+	virtual bool writeAnimation( const COLLADAFW::Animation* animation ) { return true; }
+	virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList ) { return true; }
+	virtual bool writeAnimationClip( const COLLADAFW::AnimationClip* animationClip ) { return true; }
+	virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData ) { return true; }
+	virtual bool writeController( const COLLADAFW::Controller* controller ) { return true; }
+	virtual bool writeFormulas( const COLLADAFW::Formulas* formulas ) { return true; }
+	virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene ) { return true; }
+
+	virtual bool writeGeometry( const COLLADAFW::Geometry* geometry )
+	{
+		if ( geometry->getType() != COLLADAFW::Geometry::GEO_TYPE_MESH || meshCount++ > 0 )
+			return true;
+		const COLLADAFW::Mesh* mesh = (const COLLADAFW::Mesh*)geometry;
+
+		const COLLADAFW::FloatArray* floatValues = mesh->getPositions().getFloatValues();
+		const COLLADAFW::DoubleArray* doubleValues = mesh->getPositions().getDoubleValues();
+		if ( floatValues )
+			positions.assign( floatValues->getData(), floatValues->getData() + floatValues->getCount() );
+		else if ( doubleValues )
+			positions.assign( doubleValues->getData(), doubleValues->getData() + doubleValues->getCount() );
+
+		const COLLADAFW::MeshPrimitiveArray& primitives = mesh->getMeshPrimitives();
+		for ( size_t i = 0; i < primitives.getCount(); ++i )
+		{
+			const COLLADAFW::UIntValuesArray& primitiveIndices = primitives[i]->getPositionIndices();
+			indices.insert( indices.end(), primitiveIndices.getData(), primitiveIndices.getData() + primitiveIndices.getCount() );
+		}
+		return true;
+	}
+};
+
+
+/** Writes the geometries library of the test document.*/
+class GeometriesWriter : public COLLADASW::LibraryGeometries
+{
+public:
+	GeometriesWriter( COLLADASW::StreamWriter* streamWriter ) : COLLADASW::LibraryGeometries( streamWriter ) {}
+
+	void openMesh( const COLLADASW::String& geometryId ) { COLLADASW::LibraryGeometries::openMesh( geometryId ); }
+	void closeMesh() { COLLADASW::LibraryGeometries::closeMesh(); }
+};
+
+
+/** Counts the errors reported by the loader.*/
+class ErrorCounter : public COLLADASaxFWL::IErrorHandler
+{
+public:
+	size_t errors;
+
+	ErrorCounter() : errors(0) {}
+
+	virtual bool handleError( const COLLADASaxFWL::IError* error )
+	{
+		errors++;
+		return false;
+	}
+};
+
+
+//--------------------------------------------------------------------
+static float getPosition( size_t i )
+{
+	// exactly representable as float and as text
+	return (float)i * 0.25f - 10.0f;
+}
+
+//--------------------------------------------------------------------
+static unsigned int getIndex( size_t i )
+{
+	// the triangles of a strip
+	return (unsigned int)( i / 3 + i % 3 );
+}
+
+//--------------------------------------------------------------------
+static void writeDocument( const std::string& fileName, COLLADASW::StreamWriter::BinaryArrayEncoding encoding, bool keepText )
+{
+	COLLADASW::NativeString nativeFileName( fileName );
+	COLLADASW::StreamWriter streamWriter( nativeFileName );
+	streamWriter.setBinaryArrays( encoding, 16, keepText );
+	streamWriter.startDocument();
+
+	GeometriesWriter libraryGeometries( &streamWriter );
+	libraryGeometries.openMesh( "mesh" );
+
+	COLLADASW::FloatSourceF source( &streamWriter );
+	source.setId( "mesh-positions" );
+	source.setArrayId( "mesh-positions-array" );
+	source.setAccessorStride( 3 );
+	source.setAccessorCount( (unsigned long)VERTEX_COUNT );
+	source.getParameterNameList().push_back( "X" );
+	source.getParameterNameList().push_back( "Y" );
+	source.getParameterNameList().push_back( "Z" );
+	source.prepareToAppendValues();
+	for ( size_t i = 0; i < 3 * VERTEX_COUNT; ++i )
+		source.appendValues( getPosition( i ) );
+	source.finish();
+
+	COLLADASW::Vertices vertices( &streamWriter );
+	vertices.setId( "mesh-vertices" );
+	vertices.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::POSITION, COLLADASW::URI( COLLADASW::String(), COLLADASW::String( "mesh-positions" ) ) ) );
+	vertices.add();
+
+	COLLADASW::Triangles triangles( &streamWriter );
+	triangles.setCount( (unsigned long)TRIANGLE_COUNT );
+	triangles.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::VERTEX, COLLADASW::URI( COLLADASW::String(), COLLADASW::String( "mesh-vertices" ) ), 0 ) );
+	triangles.prepareToAppendValues();
+	for ( size_t i = 0; i < 3 * TRIANGLE_COUNT; ++i )
+		triangles.appendValues( (unsigned long)getIndex( i ) );
+	triangles.finish();
+
+	libraryGeometries.closeMesh();
+	libraryGeometries.closeLibrary();
+
+	streamWriter.endDocument();
+}
+
+//--------------------------------------------------------------------
+static std::string readFile( const std::string& fileName )
+{
+	std::ifstream file( fileName.c_str(), std::ios::binary );
+	std::stringstream content;
+	content << file.rdbuf();
+	return content.str();
+}
+
+//--------------------------------------------------------------------
+static void writeFile( const std::string& fileName, const std::string& content )
+{
+	std::ofstream file( fileName.c_str(), std::ios::binary | std::ios::trunc );
+	file << content;
+}
+
+//--------------------------------------------------------------------
+static size_t loadDocument( const std::string& fileName, MeshRecorder& meshRecorder )
+{
+	ErrorCounter errorCounter;
+	COLLADASaxFWL::Loader loader( &errorCounter );
+	COLLADAFW::Root root( &loader, &meshRecorder );
+	root.loadDocument( fileName );
+	return errorCounter.errors;
+}
+
+//--------------------------------------------------------------------
+static bool check( bool condition, const std::string& testName )
+{
+	if ( condition )
+	{
+		std::cout << "match                 " << testName << std::endl;
+		return true;
+	}
+	std::cout << "      don't match     " << testName << std::endl;
+	errorCount++;
+	return false;
+}
+
+//--------------------------------------------------------------------
+static bool hasMeshData( const MeshRecorder& meshRecorder )
+{
+	if ( meshRecorder.positions.size() != 3 * VERTEX_COUNT || meshRecorder.indices.size() != 3 * TRIANGLE_COUNT )
+		return false;
+	for ( size_t i = 0; i < meshRecorder.positions.size(); ++i )
+		if ( meshRecorder.positions[i] != getPosition( i ) )
+			return false;
+	for ( size_t i = 0; i < meshRecorder.indices.size(); ++i )
+		if ( meshRecorder.indices[i] != getIndex( i ) )
+			return false;
+	return true;
+}
+
+//--------------------------------------------------------------------
+static void testRoundTrip( COLLADASW::StreamWriter::BinaryArrayEncoding encoding, bool keepText, const std::string& testName )
+{
+	std::string fileName = "binaryArrayUnitTest.dae";
+	remove( ( fileName + ".bin" ).c_str() );
+	writeDocument( fileName, encoding, keepText );
+
+	std::string document = readFile( fileName );
+	check( document.find( "<technique profile=\"OpenCOLLADA_binary\">" ) != std::string::npos, testName + ": binary technique written" );
+	bool hasText = document.find( "-10 -9.75 -9.5" ) != std::string::npos;
+	check( hasText == keepText, testName + ": text written only if kept" );
+	bool hasBinaryFile = !readFile( fileName + ".bin" ).empty();
+	check( hasBinaryFile == ( encoding == COLLADASW::StreamWriter::BINARY_ARRAYS_SIDECAR ), testName + ": binary file written only for sidecar" );
+
+	MeshRecorder meshRecorder;
+	size_t errors = loadDocument( fileName, meshRecorder );
+	check( errors == 0, testName + ": loaded without errors" );
+	check( hasMeshData( meshRecorder ), testName + ": values loaded" );
+}
+
+//--------------------------------------------------------------------
+static void testInvalidSidecar()
+{
+	std::string fileName = "binaryArrayUnitTest.dae";
+	writeDocument( fileName, COLLADASW::StreamWriter::BINARY_ARRAYS_SIDECAR, false );
+	std::string document = readFile( fileName );
+	std::string binaryData = readFile( fileName + ".bin" );
+
+	// the positions are at the beginning of the binary file, the indices follow
+	writeFile( fileName + ".bin", binaryData.substr( 0, 3 * VERTEX_COUNT * 4 - 1 ) );
+	MeshRecorder truncatedRecorder;
+	size_t errors = loadDocument( fileName, truncatedRecorder );
+	check( errors > 0, "truncated sidecar: error reported" );
+	check( truncatedRecorder.positions.empty() && truncatedRecorder.indices.empty(), "truncated sidecar: no values loaded" );
+
+	// a count whose size in bytes overflows
+	writeFile( fileName + ".bin", binaryData );
+	std::string countAttribute = "<binary_array type=\"float32\" count=\"300\"";
+	size_t position = document.find( countAttribute );
+	check( position != std::string::npos, "oversized sidecar: count attribute written" );
+	if ( position == std::string::npos )
+		return;
+	std::string oversizedDocument = document;
+	oversizedDocument.replace( position, countAttribute.size(), "<binary_array type=\"float32\" count=\"4611686018427387905\"" );
+	writeFile( fileName, oversizedDocument );
+	MeshRecorder overflowRecorder;
+	errors = loadDocument( fileName, overflowRecorder );
+	check( errors > 0, "overflowing sidecar count: error reported" );
+	check( overflowRecorder.positions.empty(), "overflowing sidecar count: no values loaded" );
+
+	// a count larger than the binary file
+	oversizedDocument = document;
+	oversizedDocument.replace( position, countAttribute.size(), "<binary_array type=\"float32\" count=\"1000000\"" );
+	writeFile( fileName, oversizedDocument );
+	MeshRecorder oversizedRecorder;
+	errors = loadDocument( fileName, oversizedRecorder );
+	check( errors > 0, "oversized sidecar count: error reported" );
+	check( oversizedRecorder.positions.empty(), "oversized sidecar count: no values loaded" );
+}
+
+//--------------------------------------------------------------------
+static void testInvalidBase64()
+{
+	std::string fileName = "binaryArrayUnitTest.dae";
+	writeDocument( fileName, COLLADASW::StreamWriter::BINARY_ARRAYS_BASE64, false );
+	std::string document = readFile( fileName );
+
+	// a huge count must not be allocated in advance
+	std::string countAttribute = "<binary_array type=\"float32\" count=\"300\"";
+	size_t position = document.find( countAttribute );
+	check( position != std::string::npos, "oversized base64: count attribute written" );
+	if ( position == std::string::npos )
+		return;
+	document.replace( position, countAttribute.size(), "<binary_array type=\"float32\" count=\"1152921504606846976\"" );
+	writeFile( fileName, document );
+	MeshRecorder meshRecorder;
+	size_t errors = loadDocument( fileName, meshRecorder );
+	check( errors > 0, "oversized base64 count: error reported" );
+	check( meshRecorder.positions.size() == 3 * VERTEX_COUNT, "oversized base64 count: received values loaded" );
+}
+
+//--------------------------------------------------------------------
+bool binaryArrayUnitTest()
+{
+	std::cout << "binaryArrayUnitTest()" << std::endl;
+	std::cout << std::endl;
+
+	testRoundTrip( COLLADASW::StreamWriter::BINARY_ARRAYS_SIDECAR, false, "sidecar" );
+	testRoundTrip( COLLADASW::StreamWriter::BINARY_ARRAYS_SIDECAR, true, "sidecar, text kept" );
+	testRoundTrip( COLLADASW::StreamWriter::BINARY_ARRAYS_BASE64, false, "base64" );
+	testRoundTrip( COLLADASW::StreamWriter::BINARY_ARRAYS_BASE64, true, "base64, text kept" );
+	testInvalidSidecar();
+	testInvalidBase64();
+
+	remove( "binaryArrayUnitTest.dae" );
+	remove( "binaryArrayUnitTest.dae.bin" );
+
+	std::cout << std::endl;
+	std::cout << errorCount << " errors" << std::endl;
+	return errorCount == 0;
+}
@@ -0,0 +1,19 @@
+
+OPTIONS="-O1 -w -DGENERATEDSAXPARSER_XMLPARSER_LIBXML -DPCRE_STATIC"
+
+INCLUDES="-I../../include -I../../include/generated14 -I../../include/generated15 -I../../include/unitTest -I../../../GeneratedSaxParser/include -I../../../COLLADAFramework/include -I../../../COLLADABaseUtils/include -I../../../COLLADABaseUtils/include/Math -I../../../COLLADAStreamWriter/include -I../../../common/libftoa/include -I../../../common/libBuffer/include -I../../../Externals/MathMLSolver/include -I../../../Externals/MathMLSolver/include/AST -I../../../Externals/pcre/include -I../../../Externals/UTF/include -I/usr/include/libxml2"
+
+LOADERFILES="../*.cpp ../generated14/*.cpp ../generated15/*.cpp"
+
+LIBRARYFILES="../../../GeneratedSaxParser/src/*.cpp ../../../COLLADAFramework/src/*.cpp ../../../COLLADABaseUtils/src/*.cpp ../../../COLLADABaseUtils/src/Math/*.cpp ../../../COLLADAStreamWriter/src/*.cpp ../../../common/libftoa/src/*.cpp ../../../common/libBuffer/src/*.cpp ../../../Externals/MathMLSolver/src/*.cpp ../../../Externals/MathMLSolver/src/AST/*.cpp"
+
+CFILES="../../../Externals/UTF/src/ConvertUTF.c ../../../Externals/pcre/src/*.c"
+
+FILES="main.cpp binaryArrayUnitTest.cpp meshStreamWriterUnitTest.cpp "$LOADERFILES" "$LIBRARYFILES
+
+OUTPUTFILE="-o unitTest"
+
+
+
+gcc -c $OPTIONS $INCLUDES $CFILES
+g++ $OPTIONS $INCLUDES $FILES *.o -lxml2 -lz -lpthread $OUTPUTFILE
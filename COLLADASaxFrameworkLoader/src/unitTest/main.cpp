@@ -0,0 +1,21 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "binaryArrayUnitTest.h"
+#include "meshStreamWriterUnitTest.h"
+
+
+int main()
+{
+	bool success = binaryArrayUnitTest();
+	success &= meshStreamWriterUnitTest();
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,348 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "meshStreamWriterUnitTest.h"
+
+#include "COLLADASaxFWLLoader.h"
+
+#include "COLLADAFWRoot.h"
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWIMeshStreamWriter.h"
+#include "COLLADAFWGeometry.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWMeshPrimitive.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <stdio.h>
+
+
+static int errorCount = 0;
+
+/** Number of vertices of the test mesh. Their positions are passed in several chunks.*/
+static const size_t VERTEX_COUNT = 3000;
+
+/** Number of triangles of each of the two triangles elements. The last primitive of each is passed
+at the end of the triangles element.*/
+static const size_t TRIANGLE_COUNT = 11;
+
+/** Number of normals of each of the two normal sources.*/
+static const size_t NORMAL_COUNT = 10;
+
+/** Maximum number of vertices passed in one primitive.*/
+static const size_t MAX_VERTEX_COUNT = 6;
+
+
+/** Records the calls of the mesh stream writer. Returns false from call number failingCall.*/
+class MeshStreamRecorder : public COLLADAFW::IWriter, public COLLADAFW::IMeshStreamWriter
+{
+public:
+	/** One entry per call: "beginMesh", "source <id>", "vertexData <id>", "primitive" or "endMesh".*/
+	std::vector<std::string> calls;
+	size_t failingCall;
+	size_t geometryCount;
+
+	std::vector<float> positions;
+	bool positionChunksInOrder;
+	size_t positionChunkCount;
+	size_t maxChunkSize;
+	std::vector<size_t> vertexDataSemantics;
+	std::vector<size_t> vertexDataCounts;
+	std::vector<size_t> vertexDataIndices;
+	std::vector<unsigned int> positionIndices;
+	std::vector<unsigned int> normalIndices;
+	size_t faceCount;
+	size_t maxPrimitiveVertexCount;
+
+	MeshStreamRecorder( size_t failing = 0 )
+		: failingCall(failing)
+		, geometryCount(0)
+		, positionChunksInOrder(true)
+		, positionChunkCount(0)
+		, maxChunkSize(0)
+		, faceCount(0)
+		, maxPrimitiveVertexCount(0)
+	{}
+
+	virtual void cancel( const COLLADAFW::String& errorMessage ) {}
+	virtual void start() {}
+	virtual void finish() {}
+	virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset ) { return true; }
+	virtual bool writeScene( const COLLADAFW::Scene* scene ) { return true; }
+	virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene ) { return true; }
+	virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes ) { return true; }
+	virtual bool writeMaterial( const COLLADAFW::Material* material ) { return true; }
+	virtual bool writeEffect( const COLLADAFW::Effect* effect ) { return true; }
+	virtual bool writeCamera( const COLLADAFW::Camera* camera ) { return true; }
+	virtual bool writeImage( const COLLADAFW::Image* image ) { return true; }
+	virtual bool writeLight( const COLLADAFW::Light* light ) { return true; }
+	virtual bool writeAnimation( const COLLADAFW::Animation* animation ) { return true; }
+	virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList ) { return true; }
+	virtual bool writeAnimationClip( const COLLADAFW::AnimationClip* animationClip ) { return true; }
+	virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData ) { return true; }
+	virtual bool writeController( const COLLADAFW::Controller* controller ) { return true; }
+	virtual bool writeFormulas( const COLLADAFW::Formulas* formulas ) { return true; }
+	virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene ) { return true; }
+	virtual bool writeGeometry( const COLLADAFW::Geometry* geometry ) { geometryCount++; return true; }
+
+	virtual bool beginMesh( const COLLADAFW::Mesh* mesh )
+	{
+		return record( "beginMesh" );
+	}
+
+	virtual bool writeMeshSourceData( const COLLADAFW::Mesh* mesh, const COLLADAFW::String& sourceId, const float* values, size_t valuesCount, size_t firstValueIndex )
+	{
+		if ( sourceId == "mesh-positions" )
+		{
+			positionChunksInOrder &= ( firstValueIndex == positions.size() );
+			positionChunkCount++;
+			positions.insert( positions.end(), values, values + valuesCount );
+		}
+		if ( valuesCount > maxChunkSize )
+			maxChunkSize = valuesCount;
+		return record( "source " + sourceId );
+	}
+
+	virtual bool writeMeshVertexData( const COLLADAFW::Mesh* mesh, VertexDataSemantic semantic, const COLLADAFW::String& sourceId, size_t stride, size_t valuesCount, size_t firstValueIndex )
+	{
+		vertexDataSemantics.push_back( semantic );
+		vertexDataCounts.push_back( valuesCount );
+		vertexDataIndices.push_back( firstValueIndex );
+		return record( "vertexData " + sourceId );
+	}
+
+	virtual bool writeMeshPrimitive( const COLLADAFW::Mesh* mesh, const COLLADAFW::MeshPrimitive* meshPrimitive )
+	{
+		const COLLADAFW::UIntValuesArray& primitivePositionIndices = meshPrimitive->getPositionIndices();
+		const COLLADAFW::UIntValuesArray& primitiveNormalIndices = meshPrimitive->getNormalIndices();
+		positionIndices.insert( positionIndices.end(), primitivePositionIndices.getData(), primitivePositionIndices.getData() + primitivePositionIndices.getCount() );
+		normalIndices.insert( normalIndices.end(), primitiveNormalIndices.getData(), primitiveNormalIndices.getData() + primitiveNormalIndices.getCount() );
+		faceCount += meshPrimitive->getFaceCount();
+		if ( primitivePositionIndices.getCount() > maxPrimitiveVertexCount )
+			maxPrimitiveVertexCount = primitivePositionIndices.getCount();
+		return record( "primitive" );
+	}
+
+	virtual bool endMesh( const COLLADAFW::Mesh* mesh )
+	{
+		return record( "endMesh" );
+	}
+
+	/** Returns the index of the first call named @a call, calls.size() if there is none.*/
+	size_t findCall( const std::string& call ) const
+	{
+		for ( size_t i = 0; i < calls.size(); ++i )
+			if ( calls[i] == call )
+				return i;
+		return calls.size();
+	}
+
+	/** Returns the number of calls named @a call.*/
+	size_t countCalls( const std::string& call ) const
+	{
+		size_t count = 0;
+		for ( size_t i = 0; i < calls.size(); ++i )
+			if ( calls[i] == call )
+				count++;
+		return count;
+	}
+
+private:
+	bool record( const std::string& call )
+	{
+		calls.push_back( call );
+		return calls.size() != failingCall;
+	}
+};
+
+
+//--------------------------------------------------------------------
+static float getPosition( size_t i )
+{
+	// exactly representable as float and as text
+	return (float)i * 0.25f - 100.0f;
+}
+
+//--------------------------------------------------------------------
+static void writeSource( std::ostream& document, const std::string& id, size_t count, size_t firstValue )
+{
+	document << "<source id=\"" << id << "\"><float_array id=\"" << id << "-array\" count=\"" << 3 * count << "\">";
+	for ( size_t i = 0; i < 3 * count; ++i )
+		document << getPosition( firstValue + i ) << " ";
+	document << "</float_array><technique_common><accessor source=\"#" << id << "-array\" count=\"" << count << "\" stride=\"3\">"
+		<< "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/>"
+		<< "</accessor></technique_common></source>\n";
+}
+
+//--------------------------------------------------------------------
+static void writeTriangles( std::ostream& document, const std::string& normalsId, size_t firstVertex )
+{
+	document << "<triangles count=\"" << TRIANGLE_COUNT << "\">"
+		<< "<input semantic=\"VERTEX\" source=\"#mesh-vertices\" offset=\"0\"/>"
+		<< "<input semantic=\"NORMAL\" source=\"#" << normalsId << "\" offset=\"1\"/><p>";
+	for ( size_t i = 0; i < 3 * TRIANGLE_COUNT; ++i )
+		document << firstVertex + i << " " << i % NORMAL_COUNT << " ";
+	document << "</p></triangles>\n";
+}
+
+//--------------------------------------------------------------------
+static void writeDocument( const std::string& fileName )
+{
+	std::ofstream document( fileName.c_str(), std::ios::binary | std::ios::trunc );
+	document << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+		<< "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+		<< "<library_geometries><geometry id=\"mesh\"><mesh>\n";
+	writeSource( document, "mesh-positions", VERTEX_COUNT, 0 );
+	writeSource( document, "mesh-normals-a", NORMAL_COUNT, 0 );
+	writeSource( document, "mesh-normals-b", NORMAL_COUNT, 3 * NORMAL_COUNT );
+	document << "<vertices id=\"mesh-vertices\"><input semantic=\"POSITION\" source=\"#mesh-positions\"/></vertices>\n";
+	writeTriangles( document, "mesh-normals-a", 0 );
+	writeTriangles( document, "mesh-normals-b", 3 * TRIANGLE_COUNT );
+	document << "</mesh></geometry></library_geometries>\n"
+		<< "</COLLADA>\n";
+}
+
+//--------------------------------------------------------------------
+static bool loadDocument( const std::string& fileName, MeshStreamRecorder& meshStreamRecorder )
+{
+	COLLADASaxFWL::Loader loader;
+	loader.setMeshStreamWriter( &meshStreamRecorder, MAX_VERTEX_COUNT );
+	COLLADAFW::Root root( &loader, &meshStreamRecorder );
+	return root.loadDocument( fileName );
+}
+
+//--------------------------------------------------------------------
+static bool check( bool condition, const std::string& testName )
+{
+	if ( condition )
+	{
+		std::cout << "match                 " << testName << std::endl;
+		return true;
+	}
+	std::cout << "      don't match     " << testName << std::endl;
+	errorCount++;
+	return false;
+}
+
+//--------------------------------------------------------------------
+static bool hasPositions( const MeshStreamRecorder& recorder )
+{
+	if ( recorder.positions.size() != 3 * VERTEX_COUNT )
+		return false;
+	for ( size_t i = 0; i < recorder.positions.size(); ++i )
+		if ( recorder.positions[i] != getPosition( i ) )
+			return false;
+	return true;
+}
+
+//--------------------------------------------------------------------
+static bool hasIndices( const MeshStreamRecorder& recorder )
+{
+	if ( recorder.positionIndices.size() != 6 * TRIANGLE_COUNT || recorder.normalIndices.size() != 6 * TRIANGLE_COUNT )
+		return false;
+	for ( size_t i = 0; i < recorder.positionIndices.size(); ++i )
+	{
+		if ( recorder.positionIndices[i] != i )
+			return false;
+		// the normals of the second source follow the normals of the first one
+		size_t normalIndex = ( i % ( 3 * TRIANGLE_COUNT ) ) % NORMAL_COUNT + ( i < 3 * TRIANGLE_COUNT ? 0 : NORMAL_COUNT );
+		if ( recorder.normalIndices[i] != normalIndex )
+			return false;
+	}
+	return true;
+}
+
+//--------------------------------------------------------------------
+static void testStreaming()
+{
+	std::string fileName = "meshStreamWriterUnitTest.dae";
+	writeDocument( fileName );
+
+	MeshStreamRecorder recorder;
+	bool success = loadDocument( fileName, recorder );
+	check( success, "streamed mesh loaded" );
+	check( recorder.geometryCount == 0, "streamed mesh not written as geometry" );
+	check( !recorder.calls.empty() && recorder.calls.front() == "beginMesh", "beginMesh called first" );
+	check( !recorder.calls.empty() && recorder.calls.back() == "endMesh" && recorder.countCalls( "endMesh" ) == 1, "endMesh called last" );
+
+	// the positions are passed chunk by chunk, while the float array is parsed
+	check( recorder.positionChunkCount > 1, "positions passed in several chunks" );
+	check( recorder.maxChunkSize < 3 * VERTEX_COUNT, "no chunk contains the whole float array" );
+	check( recorder.positionChunksInOrder, "chunks passed in order" );
+	check( hasPositions( recorder ), "position values passed" );
+	check( recorder.findCall( "source mesh-normals-b" ) < recorder.findCall( "vertexData mesh-positions" ), "sources passed before the primitives are parsed" );
+
+	// the sources are bound to the vertex data arrays by the primitives
+	bool vertexDataBound = recorder.vertexDataSemantics.size() == 3
+		&& recorder.vertexDataSemantics[0] == COLLADAFW::IMeshStreamWriter::POSITIONS && recorder.vertexDataCounts[0] == 3 * VERTEX_COUNT && recorder.vertexDataIndices[0] == 0
+		&& recorder.vertexDataSemantics[1] == COLLADAFW::IMeshStreamWriter::NORMALS && recorder.vertexDataCounts[1] == 3 * NORMAL_COUNT && recorder.vertexDataIndices[1] == 0
+		&& recorder.vertexDataSemantics[2] == COLLADAFW::IMeshStreamWriter::NORMALS && recorder.vertexDataCounts[2] == 3 * NORMAL_COUNT && recorder.vertexDataIndices[2] == 3 * NORMAL_COUNT;
+	check( vertexDataBound, "vertex data bound with value offsets" );
+	check( recorder.findCall( "vertexData mesh-normals-b" ) > recorder.findCall( "primitive" ), "second normals bound by the second triangles" );
+
+	// the triangles are passed in primitives of at most MAX_VERTEX_COUNT vertices
+	check( recorder.countCalls( "primitive" ) == 2 * ( ( 3 * TRIANGLE_COUNT + MAX_VERTEX_COUNT - 1 ) / MAX_VERTEX_COUNT ), "triangles split into primitives" );
+	check( recorder.maxPrimitiveVertexCount <= MAX_VERTEX_COUNT, "primitives limited in size" );
+	check( recorder.faceCount == 2 * TRIANGLE_COUNT, "all triangles passed" );
+	check( hasIndices( recorder ), "indices with offsets of the second normals" );
+}
+
+//--------------------------------------------------------------------
+static void testAbort( const std::string& failingCall, size_t occurrence, const std::string& testName )
+{
+	std::string fileName = "meshStreamWriterUnitTest.dae";
+	writeDocument( fileName );
+
+	// find the number of the call to fail
+	MeshStreamRecorder completeRecorder;
+	loadDocument( fileName, completeRecorder );
+	size_t callNumber = 0;
+	for ( size_t i = 0, found = 0; i < completeRecorder.calls.size(); ++i )
+	{
+		if ( completeRecorder.calls[i] == failingCall && ++found == occurrence )
+		{
+			callNumber = i + 1;
+			break;
+		}
+	}
+	check( callNumber != 0, testName + ": call found" );
+	if ( callNumber == 0 )
+		return;
+
+	MeshStreamRecorder recorder( callNumber );
+	bool success = loadDocument( fileName, recorder );
+	check( !success, testName + ": loading aborted" );
+	check( recorder.calls.size() == callNumber, testName + ": no calls after the failed one" );
+	check( recorder.geometryCount == 0, testName + ": mesh not written as geometry" );
+}
+
+//--------------------------------------------------------------------
+bool meshStreamWriterUnitTest()
+{
+	std::cout << "meshStreamWriterUnitTest()" << std::endl;
+	std::cout << std::endl;
+
+	testStreaming();
+	testAbort( "beginMesh", 1, "beginMesh failed" );
+	testAbort( "source mesh-positions", 2, "source data failed" );
+	testAbort( "vertexData mesh-normals-a", 1, "vertex data failed" );
+	testAbort( "primitive", 1, "first primitive failed" );
+	testAbort( "primitive", 6, "last primitive of triangles failed" );
+	testAbort( "endMesh", 1, "endMesh failed" );
+
+	remove( "meshStreamWriterUnitTest.dae" );
+
+	std::cout << std::endl;
+	std::cout << errorCount << " errors" << std::endl;
+	return errorCount == 0;
+}
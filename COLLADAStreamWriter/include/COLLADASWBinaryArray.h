@@ -0,0 +1,109 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+	This file is part of COLLADAStreamWriter.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASTREAMWRITER_BINARY_ARRAY_H__
+#define __COLLADASTREAMWRITER_BINARY_ARRAY_H__
+
+#include "COLLADASWPrerequisites.h"
+
+#include <vector>
+
+namespace COLLADASW
+{
+
+    /** Collects the values of a float array or a primitive index list as little endian binary data,
+    to be written by StreamWriter::appendBinaryArray(). The binary data is written in an OpenCOLLADA_binary
+    technique next to the array, so that readers not knowing the technique still find valid COLLADA.*/
+    class BinaryArray
+    {
+
+    public:
+
+        /** The type of the values stored in the binary data.*/
+        enum ValueType
+        {
+            VALUE_TYPE_FLOAT32,
+            VALUE_TYPE_FLOAT64,
+            VALUE_TYPE_UINT32
+        };
+
+    private:
+
+        /** The type the appended values are converted to.*/
+        ValueType mValueType;
+
+        /** The little endian binary data of all appended values.*/
+        std::vector<unsigned char> mData;
+
+        /** The number of values appended.*/
+        size_t mValueCount;
+
+        /** True between open() and close().*/
+        bool mIsOpen;
+
+        /** True, if the values should also be written as text.*/
+        bool mKeepText;
+
+    public:
+
+        BinaryArray()
+            : mValueType ( VALUE_TYPE_FLOAT32 )
+            , mValueCount ( 0 )
+            , mIsOpen ( false )
+            , mKeepText ( true )
+        {}
+
+        /** Starts collecting @a valueCount values of type @a valueType. Values appended before are removed.
+        @param keepText True, if the values are also written as text.*/
+        void open ( ValueType valueType, size_t valueCount, bool keepText );
+
+        /** Stops collecting values and releases the binary data.*/
+        void close();
+
+        /** True, if values are being collected.*/
+        bool isOpen() const { return mIsOpen; }
+
+        /** True, if the values should also be written as text. Always true, if not open.*/
+        bool keepsText() const { return !mIsOpen || mKeepText; }
+
+        /** Returns the type of the values stored in the binary data.*/
+        ValueType getValueType() const { return mValueType; }
+
+        /** Returns the name of the type of the values, as written in the type attribute.*/
+        const String& getValueTypeName() const;
+
+        /** Returns the number of values appended.*/
+        size_t getValueCount() const { return mValueCount; }
+
+        /** Returns the little endian binary data or 0 if it is empty.*/
+        const unsigned char* getData() const { return mData.empty() ? 0 : &mData[0]; }
+
+        /** Returns the size of the binary data in bytes.*/
+        size_t getSize() const { return mData.size(); }
+
+        /** Appends @a value converted to the value type.*/
+        void appendValue ( double value );
+
+        /** Appends @a value converted to the value type.*/
+        void appendValue ( float value );
+
+        /** Appends @a value converted to the value type.*/
+        void appendValue ( unsigned long value );
+
+    private:
+
+        /** Appends the @a size bytes of @a value in little endian byte order.*/
+        void appendBytes ( const void* value, size_t size );
+
+    };
+
+} //namespace COLLADASW
+
+#endif //__COLLADASTREAMWRITER_BINARY_ARRAY_H__
@@ -50,6 +50,7 @@ namespace COLLADASW
         static const String CSW_ELEMENT_BIND_MATERIAL;
 		static const String CSW_ELEMENT_BIND_SHAPE_MATRIX;
 		static const String CSW_ELEMENT_BIND_VERTEX_INPUT;
+		static const String CSW_ELEMENT_BINARY_ARRAY;
         static const String CSW_ELEMENT_BORDER_COLOR;
         static const String CSW_ELEMENT_CAMERA;
         static const String CSW_ELEMENT_CAMERA_ORTHOGRAPHIC;
@@ -343,6 +344,7 @@ namespace COLLADASW
 		static const String CSW_ATTRIBUTE_CLOSED;
 		static const String CSW_ATTRIBUTE_COUNT;
         static const String CSW_ATTRIBUTE_END;
+        static const String CSW_ATTRIBUTE_ENCODING;
         static const String CSW_ATTRIBUTE_FACE;
         static const String CSW_ATTRIBUTE_ID;
 		static const String CSW_ATTRIBUTE_INDEX;
@@ -444,6 +446,12 @@ namespace COLLADASW
         static const String CSW_VALUE_TYPE_NAME;
         static const String CSW_VALUE_TYPE_IDREF;
 
+        static const String CSW_BINARY_ARRAY_PROFILE;
+        static const String CSW_BINARY_ARRAY_ENCODING_BASE64;
+        static const String CSW_BINARY_ARRAY_TYPE_FLOAT32;
+        static const String CSW_BINARY_ARRAY_TYPE_FLOAT64;
+        static const String CSW_BINARY_ARRAY_TYPE_UINT32;
+
         static const String CSW_SAMPLER_FILTER_LINEAR;
         static const String CSW_SAMPLER_FILTER_LINEAR_MIPMAP_LINEAR;
         static const String CSW_SAMPLER_FILTER_LINEAR_MIPMAP_NEAREST;
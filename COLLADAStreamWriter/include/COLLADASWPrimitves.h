@@ -15,6 +15,7 @@
 #include "COLLADASWElementWriter.h"
 #include "COLLADASWInputList.h"
 #include "COLLADASWConstants.h"
+#include "COLLADASWBinaryArray.h"
 
 #include <vector>
 #include <string.h>
@@ -50,6 +51,9 @@ namespace COLLADASW
         /** List of the number in the @a \<vcount\> element*/
         VCountList mVCountList;
 
+        /** Collects the indices of triangles and polylists, if they are written binary as well.*/
+        BinaryArray mBinaryArray;
+
     public:
 
         /**
@@ -157,49 +161,75 @@ namespace COLLADASW
         /** Adds @a number to the array*/
         void appendValues ( const std::vector<unsigned long>& numberVec )
         {
-            mSW->appendValues ( numberVec );
+            if ( mBinaryArray.isOpen() )
+            {
+                for ( size_t i = 0; i < numberVec.size(); ++i )
+                    mBinaryArray.appendValue ( numberVec[i] );
+            }
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( numberVec );
         }
 
         /** Adds @a number to the array*/
         void appendValues ( const int number )
         {
-            mSW->appendValues ( number );
+            appendBinaryValue ( (unsigned long)number );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( number );
         }
 
         /** Adds @a number to the array*/
         void appendValues ( const unsigned int number )
         {
-            mSW->appendValues ( number );
+            appendBinaryValue ( number );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( number );
         }
 
         /** Adds @a number to the array*/
         void appendValues ( const long number )
         {
-            mSW->appendValues ( number );
+            appendBinaryValue ( (unsigned long)number );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( number );
         }
 
         /** Adds @a number to the array*/
         void appendValues ( const unsigned long number )
         {
-            mSW->appendValues ( number );
+            appendBinaryValue ( number );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( number );
         }
 
         /** Adds @a number1  and @a number2 to the array*/
         void appendValues ( const unsigned long number1, const unsigned long number2 )
         {
-            mSW->appendValues ( number1, number2 );
+            appendBinaryValue ( number1 );
+            appendBinaryValue ( number2 );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( number1, number2 );
         }
 
         /** Adds @a number1, @a number2 and @a number3 to the array*/
         void appendValues ( const unsigned long number1, const unsigned long number2, const unsigned long number3 )
         {
-            mSW->appendValues ( number1, number2, number3 );
+            appendBinaryValue ( number1 );
+            appendBinaryValue ( number2 );
+            appendBinaryValue ( number3 );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( number1, number2, number3 );
         }
 
         /** Adds @a number1, @a number2, @a number3 and @a number4 to the array*/
         void appendValues ( const unsigned long number1, const unsigned long number2, const unsigned long number3, const unsigned long number4 )
         {
-            mSW->appendValues ( number1, number2, number3, number4 );
+            appendBinaryValue ( number1 );
+            appendBinaryValue ( number2 );
+            appendBinaryValue ( number3 );
+            appendBinaryValue ( number4 );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( number1, number2, number3, number4 );
         };
 
         /** 
@@ -219,6 +249,17 @@ namespace COLLADASW
          */
         void prepareBaseToAppendValues ( bool openPolyListElement=true, bool openVertexListElement=false );
 
+    private:
+        /** Adds @a number to the binary array, if one is written.*/
+        void appendBinaryValue ( unsigned long number )
+        {
+            if ( mBinaryArray.isOpen() ) mBinaryArray.appendValue ( number );
+        }
+
+        /** Returns the number of indices in the \<p\> element of a triangles or polylist element,
+        0 for all other primitives or if it is not known in advance.*/
+        size_t getExpectedIndexCount() const;
+
     };
 
 
@@ -14,6 +14,7 @@
 #include "COLLADASWPrerequisites.h"
 #include "COLLADASWElementWriter.h"
 #include "COLLADASWConstants.h"
+#include "COLLADASWBinaryArray.h"
 
 #include <string>
 #include <vector>
@@ -54,6 +55,11 @@ namespace COLLADASW
         /** The list with the parameters. */
         ParameterNameList mParameterNameList;
 
+    protected:
+
+        /** Collects the values, if the array is written binary as well.*/
+        BinaryArray mBinaryArray;
+
     public:
 
     	SourceBase ( StreamWriter* streamWriter ) 
@@ -132,13 +138,49 @@ namespace COLLADASW
     protected:
 
         /** Prepares to fill the array. This member must be called exactly once
-        before add is called the first time.*/
-        void prepareBaseToAppendValues ( const String* arrayName );
+        before add is called the first time.
+        @param doubleValues True, if double values are added. Used to choose the type of the values
+        of a binary float array.*/
+        void prepareBaseToAppendValues ( const String* arrayName, bool doubleValues = false );
 
         /** This function must be called after the last value has been added to the array and before another
         element has been opened*/
         void finishBase ( const String* parameterTypeName, bool closeSourceElement=true );
 
+        /** Adds the binary array, if one is written, in an OpenCOLLADA_binary technique to the source. */
+        void addBinaryArrayTechnique();
+
+        /** Adds @a value to the binary array, if one is written.*/
+        void appendBinaryValue ( double value )
+        {
+            if ( mBinaryArray.isOpen() ) mBinaryArray.appendValue ( value );
+        }
+
+        /** Adds @a value to the binary array, if one is written.*/
+        void appendBinaryValue ( float value )
+        {
+            if ( mBinaryArray.isOpen() ) mBinaryArray.appendValue ( value );
+        }
+
+        /** Name and IDREF arrays are never written binary.*/
+        void appendBinaryValue ( const String& ) {}
+
+        /** Adds the 16 values of @a matrix to the binary array, if one is written.*/
+        template<class MatrixType>
+        void appendBinaryMatrix ( const MatrixType matrix[][4] )
+        {
+            if ( !mBinaryArray.isOpen() ) return;
+            for ( int i = 0; i < 4; ++i )
+                for ( int j = 0; j < 4; ++j )
+                    mBinaryArray.appendValue ( matrix[i][j] );
+        }
+
+        /** Used by the Source template to detect double values.*/
+        static bool isDouble ( const double* ) { return true; }
+
+        /** Used by the Source template to detect double values.*/
+        static bool isDouble ( const void* ) { return false; }
+
         /** Close the array element. */
         void closeArray();
 
@@ -169,49 +211,73 @@ namespace COLLADASW
         before add is called the first time.*/
         inline void prepareToAppendValues()
         {
-            prepareBaseToAppendValues ( arrayName );
+            prepareBaseToAppendValues ( arrayName, isDouble ( (const Type*)0 ) );
         }
 
         /** Adds @a value to the array*/
         void appendValues ( const double matrix[][4] )
         {
-            mSW->appendValues ( matrix );
+            appendBinaryMatrix ( matrix );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( matrix );
         }
 
         /** Adds @a value to the array*/
         void appendValues ( const float matrix[][4] )
         {
-            mSW->appendValues ( matrix );
+            appendBinaryMatrix ( matrix );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( matrix );
         }
 
         /** Adds @a value to the array*/
         void appendValues ( const std::vector<Type>& value )
         {
-            mSW->appendValues ( value );
+            if ( mBinaryArray.isOpen() )
+            {
+                for ( size_t i = 0; i < value.size(); ++i )
+                    appendBinaryValue ( value[i] );
+            }
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( value );
         }
 
         /** Adds @a value to the array*/
         void appendValues ( const Type value )
         {
-            mSW->appendValues ( value );
+            appendBinaryValue ( value );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( value );
         }
 
         /** Adds @a value1  and @a value2 to the array*/
         void appendValues ( const Type value1, const Type value2 )
         {
-            mSW->appendValues ( value1, value2 );
+            appendBinaryValue ( value1 );
+            appendBinaryValue ( value2 );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( value1, value2 );
         }
 
         /** Adds @a value1, @a value2 and @a value3 to the array*/
         void appendValues ( const Type value1, const Type value2, const Type value3 )
         {
-            mSW->appendValues ( value1, value2, value3 );
+            appendBinaryValue ( value1 );
+            appendBinaryValue ( value2 );
+            appendBinaryValue ( value3 );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( value1, value2, value3 );
         }
 
         /** Adds @a value1, @a value2, @a value3 and @a value4 to the array*/
         void appendValues ( const Type value1, const Type value2, const Type value3, const Type value4 )
         {
-            mSW->appendValues ( value1, value2, value3, value4 );
+            appendBinaryValue ( value1 );
+            appendBinaryValue ( value2 );
+            appendBinaryValue ( value3 );
+            appendBinaryValue ( value4 );
+            if ( mBinaryArray.keepsText() )
+                mSW->appendValues ( value1, value2, value3, value4 );
         }
 
         /**
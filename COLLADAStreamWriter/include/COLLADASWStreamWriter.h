@@ -33,6 +33,7 @@ namespace COLLADABU
 
 namespace Common
 {
+	class IBufferFlusher;
 	class FWriteBufferFlusher;
 	class CharacterBuffer;
 }
@@ -41,6 +42,7 @@ namespace COLLADASW
 {
 
     class StreamWriter;
+    class BinaryArray;
 
 	typedef unsigned long ElementIndexType;
 
@@ -78,6 +80,19 @@ namespace COLLADASW
 			COLLADA_1_4_1,
 			COLLADA_1_5_0
 		};
+
+		/** How large float arrays and primitive index lists are written in addition to, or instead of,
+		their text. See setBinaryArrays().*/
+		enum BinaryArrayEncoding
+		{
+			BINARY_ARRAYS_NONE,     //!< Arrays are written as text only
+			BINARY_ARRAYS_BASE64,   //!< Arrays are written base64 encoded into the document
+			BINARY_ARRAYS_SIDECAR   //!< Arrays are written into the file <document>.bin next to the document
+		};
+
+		/** Arrays with less values are not written binary by default.*/
+		static const size_t DEFAULT_BINARY_ARRAY_MINIMUM_VALUE_COUNT = 1024;
+
     private:
 
         /** Contains information about an open tag*/
@@ -111,7 +126,9 @@ namespace COLLADASW
 		typedef std::deque<OpenTag> OpenTagStack;
 
     private:
-		Common::FWriteBufferFlusher* mBufferFlusher;
+		/** Writes the document, gzip compressed if the file name ends with .gz or as .zae archive if it
+		ends with .zae.*/
+		Common::IBufferFlusher* mBufferFlusher;
 
 		Common::CharacterBuffer* mCharacterBuffer;
 
@@ -138,8 +155,28 @@ namespace COLLADASW
 		/** The version of the COLLADA file.*/
 		COLLADAVersion mCOLLADAVersion;
 
+		/** The name of the COLLADA file.*/
+		String mFileName;
+
+		/** How large arrays are written binary.*/
+		BinaryArrayEncoding mBinaryArrayEncoding;
+
+		/** Arrays with less values are written as text only.*/
+		size_t mBinaryArrayMinimumValueCount;
+
+		/** If true, binary arrays are also written as text.*/
+		bool mKeepBinaryArrayText;
+
+		/** The file binary arrays are written to, if the encoding is BINARY_ARRAYS_SIDECAR. Opened, when
+		the first array is written.*/
+		Common::FWriteBufferFlusher* mBinaryFileFlusher;
+
+		/** The number of bytes written to the binary file.*/
+		unsigned long long mBinaryFileSize;
+
     public:
-        /** Creates a stream writer that writes to file @a fileName*/
+        /** Creates a stream writer that writes to file @a fileName. If @a fileName ends with .gz, the
+		document is gzip compressed, if it ends with .zae, it is written as root document of a .zae archive.*/
         StreamWriter ( const NativeString& fileName, bool doublePrecision = false, COLLADAVersion cOLLADAVersion = COLLADA_1_4_1);
 
         /** Closes all open tags and closes the stream*/
@@ -335,6 +372,35 @@ namespace COLLADASW
 		/** Returns the version of the COLLADA file that ias written by the StreamWriter.*/
 		COLLADAVersion getCOLLADAVersion() const { return mCOLLADAVersion; } 
 
+		/** Returns true, if the double values are exported with maximum precision.*/
+		bool getDoublePrecision() const { return mDoublePrecision; }
+
+		/** Lets float arrays and the index lists of triangles and polylists with at least
+		@a minimumValueCount values be written little endian binary. The binary data is written in a
+		\<technique profile="OpenCOLLADA_binary"\> of the source or an \<extra\> of the primitive, that loaders
+		not knowing it skip. By default the arrays are left empty, but keep their count attribute. Such
+		documents are not interoperable: only the OpenCOLLADA loader reads their values, other COLLADA
+		readers see empty arrays. If @a keepText is true, the values are written as text as well, so every
+		COLLADA reader gets them. This writes each value twice and the OpenCOLLADA loader then reads the
+		text and skips the binary data.*/
+		void setBinaryArrays ( BinaryArrayEncoding encoding, size_t minimumValueCount = DEFAULT_BINARY_ARRAY_MINIMUM_VALUE_COUNT, bool keepText = false );
+
+		/** Returns how large arrays are written binary.*/
+		BinaryArrayEncoding getBinaryArrayEncoding() const { return mBinaryArrayEncoding; }
+
+		/** Returns true, if binary arrays are also written as text.*/
+		bool getKeepBinaryArrayText() const { return mKeepBinaryArrayText; }
+
+		/** Returns true, if an array with @a valueCount values should be written binary.*/
+		bool writesBinaryArray ( size_t valueCount ) const
+		{
+			return mBinaryArrayEncoding != BINARY_ARRAYS_NONE && valueCount >= mBinaryArrayMinimumValueCount;
+		}
+
+		/** Adds a \<binary_array\> element with the data of @a binaryArray, either base64 encoded or
+		referencing the data written to the binary file.*/
+		void appendBinaryArray ( const BinaryArray& binaryArray );
+
     private:
 
 		/** Closes all elements opened since the element with index @a elementIndex has been open, 
@@ -411,6 +477,25 @@ namespace COLLADASW
         has been calls, contents should be added, but if not, the xml file will still be valid*/
         void prepareToAddContents();
 
+		/** Opens the binary file, if not yet done.
+		@return False, if it could not be opened.*/
+		bool openBinaryFile();
+
+		/** Writes @a size bytes of @a data into the binary file, starting at a multiple of 8 bytes.
+		@param offset Receives the offset of the data in the binary file.
+		@return False, if it could not be written.*/
+		bool writeToBinaryFile ( const unsigned char* data, size_t size, unsigned long long& offset );
+
+		/** Adds @a size bytes of @a data base64 encoded to the stream.*/
+		void appendBase64 ( const unsigned char* data, size_t size );
+
+		/** Returns true, if @a fileName ends with @a extension, ignoring case.*/
+		static bool hasExtension ( const String& fileName, const char* extension );
+
+		/** Creates the flusher writing to @a fileName, depending on its extension.
+		@param error Receives the error code, if the file could not be opened.*/
+		static Common::IBufferFlusher* createBufferFlusher ( const NativeString& fileName, int& error );
+
     };
 
 
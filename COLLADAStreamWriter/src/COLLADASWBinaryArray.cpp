@@ -0,0 +1,127 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+	This file is part of COLLADAStreamWriter.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASWBinaryArray.h"
+#include "COLLADASWConstants.h"
+
+#include <string.h>
+
+namespace COLLADASW
+{
+
+    //---------------------------------------------------------------
+    void BinaryArray::open ( ValueType valueType, size_t valueCount, bool keepText )
+    {
+        mValueType = valueType;
+        mValueCount = 0;
+        mKeepText = keepText;
+        mIsOpen = true;
+        mData.clear();
+        mData.reserve ( valueCount * ( valueType == VALUE_TYPE_FLOAT64 ? 8 : 4 ) );
+    }
+
+    //---------------------------------------------------------------
+    void BinaryArray::close()
+    {
+        mIsOpen = false;
+        mValueCount = 0;
+        std::vector<unsigned char>().swap ( mData );
+    }
+
+    //---------------------------------------------------------------
+    const String& BinaryArray::getValueTypeName() const
+    {
+        switch ( mValueType )
+        {
+        case VALUE_TYPE_FLOAT64:
+            return CSWC::CSW_BINARY_ARRAY_TYPE_FLOAT64;
+        case VALUE_TYPE_UINT32:
+            return CSWC::CSW_BINARY_ARRAY_TYPE_UINT32;
+        default:
+            return CSWC::CSW_BINARY_ARRAY_TYPE_FLOAT32;
+        }
+    }
+
+    //---------------------------------------------------------------
+    void BinaryArray::appendValue ( double value )
+    {
+        switch ( mValueType )
+        {
+        case VALUE_TYPE_FLOAT64:
+            {
+                unsigned long long bits;
+                memcpy ( &bits, &value, sizeof(bits) );
+                appendBytes ( &bits, sizeof(bits) );
+            }
+            break;
+        case VALUE_TYPE_UINT32:
+            appendValue ( (unsigned long) value );
+            return;
+        default:
+            {
+                float floatValue = (float) value;
+                unsigned int bits;
+                memcpy ( &bits, &floatValue, sizeof(bits) );
+                appendBytes ( &bits, sizeof(bits) );
+            }
+            break;
+        }
+        mValueCount++;
+    }
+
+    //---------------------------------------------------------------
+    void BinaryArray::appendValue ( float value )
+    {
+        if ( mValueType == VALUE_TYPE_FLOAT32 )
+        {
+            unsigned int bits;
+            memcpy ( &bits, &value, sizeof(bits) );
+            appendBytes ( &bits, sizeof(bits) );
+            mValueCount++;
+        }
+        else
+        {
+            appendValue ( (double) value );
+        }
+    }
+
+    //---------------------------------------------------------------
+    void BinaryArray::appendValue ( unsigned long value )
+    {
+        if ( mValueType == VALUE_TYPE_UINT32 )
+        {
+            unsigned int bits = (unsigned int) value;
+            appendBytes ( &bits, sizeof(bits) );
+            mValueCount++;
+        }
+        else
+        {
+            appendValue ( (double) value );
+        }
+    }
+
+    //---------------------------------------------------------------
+    void BinaryArray::appendBytes ( const void* value, size_t size )
+    {
+        // shifting instead of copying the bytes gives little endian on every host
+        unsigned long long bits = 0;
+        if ( size == 8 )
+            bits = *(const unsigned long long*) value;
+        else
+            bits = *(const unsigned int*) value;
+
+        for ( size_t i = 0; i < size; ++i )
+        {
+            mData.push_back ( (unsigned char) ( bits & 0xff ) );
+            bits >>= 8;
+        }
+    }
+
+} //namespace COLLADASW
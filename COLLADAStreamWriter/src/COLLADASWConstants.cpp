@@ -42,6 +42,7 @@ namespace COLLADASW
     const String CSWC::CSW_ELEMENT_BIND_MATERIAL = "bind_material";
 	const String CSWC::CSW_ELEMENT_BIND_SHAPE_MATRIX = "bind_shape_matrix";
 	const String CSWC::CSW_ELEMENT_BIND_VERTEX_INPUT = "bind_vertex_input";
+	const String CSWC::CSW_ELEMENT_BINARY_ARRAY = "binary_array";
     const String CSWC::CSW_ELEMENT_BORDER_COLOR = "border_color";
     const String CSWC::CSW_ELEMENT_CAMERA = "camera";
     const String CSWC::CSW_ELEMENT_CAMERA_ORTHOGRAPHIC = "orthographic";
@@ -333,6 +334,7 @@ namespace COLLADASW
 	const String CSWC::CSW_ATTRIBUTE_CLOSED = "closed";
     const String CSWC::CSW_ATTRIBUTE_COUNT = "count";
     const String CSWC::CSW_ATTRIBUTE_END = "end";
+    const String CSWC::CSW_ATTRIBUTE_ENCODING = "encoding";
     const String CSWC::CSW_ATTRIBUTE_FACE = "face";
     const String CSWC::CSW_ATTRIBUTE_ID = "id";
 	const String CSWC::CSW_ATTRIBUTE_INDEX = "index";
@@ -434,6 +436,12 @@ namespace COLLADASW
     const String CSWC::CSW_VALUE_TYPE_NAME = "name";
     const String CSWC::CSW_VALUE_TYPE_IDREF = "IDREF";
 
+    const String CSWC::CSW_BINARY_ARRAY_PROFILE = "OpenCOLLADA_binary";
+    const String CSWC::CSW_BINARY_ARRAY_ENCODING_BASE64 = "base64";
+    const String CSWC::CSW_BINARY_ARRAY_TYPE_FLOAT32 = "float32";
+    const String CSWC::CSW_BINARY_ARRAY_TYPE_FLOAT64 = "float64";
+    const String CSWC::CSW_BINARY_ARRAY_TYPE_UINT32 = "uint32";
+
     const String CSWC::CSW_SAMPLER_FILTER_LINEAR = "LINEAR";
     const String CSWC::CSW_SAMPLER_FILTER_LINEAR_MIPMAP_LINEAR = "LINEAR_MIPMAP_LINEAR" ;
     const String CSWC::CSW_SAMPLER_FILTER_LINEAR_MIPMAP_NEAREST = "LINEAR_MIPMAP_NEAREST";
@@ -37,6 +37,10 @@ namespace COLLADASW
         if ( openPolylistElement )
         {
             mSW->openElement ( CSWC::CSW_ELEMENT_P );
+
+            size_t indexCount = getExpectedIndexCount();
+            if ( indexCount > 0 && mSW->writesBinaryArray ( indexCount ) )
+                mBinaryArray.open ( BinaryArray::VALUE_TYPE_UINT32, indexCount, mSW->getKeepBinaryArrayText() );
         }
         else if ( openVertexlistElement )
         {
@@ -107,9 +111,45 @@ namespace COLLADASW
     //---------------------------------------------------------------
     void PrimitivesBase::finish()
     {
+        if ( mBinaryArray.isOpen() )
+        {
+            // close the <p> element and add the indices in an extra element after it
+            mSW->closeElement();
+            mSW->openElement ( CSWC::CSW_ELEMENT_EXTRA );
+            mSW->openElement ( CSWC::CSW_ELEMENT_TECHNIQUE );
+            mSW->appendAttribute ( CSWC::CSW_ATTRIBUTE_PROFILE, CSWC::CSW_BINARY_ARRAY_PROFILE );
+            mSW->appendBinaryArray ( mBinaryArray );
+            mSW->closeElement();
+            mSW->closeElement();
+            mBinaryArray.close();
+        }
         mPrimitiveCloser.close();
     }
 
+    //---------------------------------------------------------------
+    size_t PrimitivesBase::getExpectedIndexCount() const
+    {
+        size_t vertexCount = 0;
+        if ( mPrimitiveName == CSWC::CSW_ELEMENT_TRIANGLES )
+        {
+            vertexCount = 3 * (size_t)mCount;
+        }
+        else if ( mPrimitiveName == CSWC::CSW_ELEMENT_POLYLIST )
+        {
+            for ( VCountList::const_iterator it = mVCountList.begin(); it != mVCountList.end(); ++it )
+                vertexCount += *it;
+        }
+
+        // each vertex has an index for every distinct offset of the inputs
+        int maxOffset = -1;
+        for ( InputList::List::const_iterator it = mInputList.mList.begin(); it != mInputList.mList.end(); ++it )
+        {
+            if ( it->getOffset() > maxOffset )
+                maxOffset = it->getOffset();
+        }
+        return vertexCount * (size_t)( maxOffset + 1 );
+    }
+
 	void PrimitivesBase::CloseVCountAndOpenVElement()
 	{
 		closeElement();
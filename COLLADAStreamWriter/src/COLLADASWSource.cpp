@@ -15,7 +15,7 @@ namespace COLLADASW
 {
 
     //---------------------------------------------------------------
-    void SourceBase::prepareBaseToAppendValues ( const String *arrayName )
+    void SourceBase::prepareBaseToAppendValues ( const String *arrayName, bool doubleValues )
     {
         mSourceCloser = mSW->openElement ( CSWC::CSW_ELEMENT_SOURCE );
         mSW->appendAttribute ( CSWC::CSW_ATTRIBUTE_ID, mNodeId );
@@ -24,6 +24,13 @@ namespace COLLADASW
         mSW->openElement ( *arrayName );
         mSW->appendAttribute ( CSWC::CSW_ATTRIBUTE_ID, mArrayId );
         mSW->appendAttribute ( CSWC::CSW_ATTRIBUTE_COUNT, mAccessorCount * mAccessorStride );
+
+        if ( arrayName == &CSWC::CSW_ELEMENT_FLOAT_ARRAY && mSW->writesBinaryArray ( mAccessorCount * mAccessorStride ) )
+        {
+            // doubles are only written with 64 bit, if the text has double precision as well
+            BinaryArray::ValueType valueType = ( doubleValues && mSW->getDoublePrecision() ) ? BinaryArray::VALUE_TYPE_FLOAT64 : BinaryArray::VALUE_TYPE_FLOAT32;
+            mBinaryArray.open ( valueType, mAccessorCount * mAccessorStride, mSW->getKeepBinaryArrayText() );
+        }
     }
 
     //---------------------------------------------------------------
@@ -33,9 +40,25 @@ namespace COLLADASW
 
         addBaseTechnique ( parameterTypeName );
 
+        addBinaryArrayTechnique();
+
         if ( closeSourceElement ) closeSource();
     }
 
+    //---------------------------------------------------------------
+    void SourceBase::addBinaryArrayTechnique()
+    {
+        if ( !mBinaryArray.isOpen() )
+            return;
+
+        mSW->openElement ( CSWC::CSW_ELEMENT_TECHNIQUE );
+        mSW->appendAttribute ( CSWC::CSW_ATTRIBUTE_PROFILE, CSWC::CSW_BINARY_ARRAY_PROFILE );
+        mSW->appendBinaryArray ( mBinaryArray );
+        mSW->closeElement();
+
+        mBinaryArray.close();
+    }
+
     //---------------------------------------------------------------
     void SourceBase::closeArray()
     {
@@ -12,11 +12,14 @@
 
 #include "COLLADASWConstants.h"
 #include "COLLADASWException.h"
+#include "COLLADASWBinaryArray.h"
 
 #include "COLLADABUStringUtils.h"
+#include "COLLADABUURI.h"
 
 #include "CommonCharacterBuffer.h"
 #include "CommonFWriteBufferFlusher.h"
+#include "CommonGzipBufferFlusher.h"
 
 #include <string>
 #include <fstream>
@@ -66,19 +69,28 @@ namespace COLLADASW
 
     //---------------------------------------------------------------
     StreamWriter::StreamWriter ( const NativeString & fileName, bool doublePrecision /*= false*/, COLLADAVersion cOLLADAVersion /*= COLLADA_1_4_1*/ )
-            : mBufferFlusher( new Common::FWriteBufferFlusher(fileName.c_str(), FWRITEBUFFERSIZE))
-			, mCharacterBuffer( new Common::CharacterBuffer(CHARACTERBUFFERSIZE, mBufferFlusher) )
+            : mBufferFlusher( 0 )
+			, mCharacterBuffer( 0 )
 			, mLevel ( 0 )
             , mIndent ( 2 )
             , mDoublePrecision (doublePrecision)
 			, mCOLLADAVersion(cOLLADAVersion)
 			, mNextElementIndex(0)
+			, mFileName(fileName)
+			, mBinaryArrayEncoding(BINARY_ARRAYS_NONE)
+			, mBinaryArrayMinimumValueCount(DEFAULT_BINARY_ARRAY_MINIMUM_VALUE_COUNT)
+			, mKeepBinaryArrayText(false)
+			, mBinaryFileFlusher(0)
+			, mBinaryFileSize(0)
     {
-		int error = mBufferFlusher->getError();
+		int error = 0;
+		mBufferFlusher = createBufferFlusher( fileName, error );
 		if ( error != 0 )
 		{
+			delete mBufferFlusher;
 			throw StreamWriterException(StreamWriterException::ERROR_FILE_OPEN, "Could not open file \"" + fileName + "\" for writing. errno_t = " + Utils::toString(error) );
 		}
+		mCharacterBuffer = new Common::CharacterBuffer(CHARACTERBUFFERSIZE, mBufferFlusher);
     }
 
     //---------------------------------------------------------------
@@ -87,6 +99,7 @@ namespace COLLADASW
         endDocument();
 		delete mCharacterBuffer;
 		delete mBufferFlusher;
+		delete mBinaryFileFlusher;
     }
 
     //---------------------------------------------------------------
@@ -359,11 +372,7 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        for ( size_t i=0; i<length; ++i )
-        {
-            appendNumber ( values[i] );
-            appendChar ( ' ' );
-        }
+        mCharacterBuffer->copyToBufferAsChar( values, length );
 
         mOpenTags.back().mHasText = true;
     }
@@ -437,11 +446,7 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        for ( size_t i=0; i<length; ++i )
-        {
-            appendNumber ( values[i] );
-            appendChar ( ' ' );
-        }
+        mCharacterBuffer->copyToBufferAsChar( values, length, mDoublePrecision );
 
         mOpenTags.back().mHasText = true;
     }
@@ -499,12 +504,8 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        std::vector<float>::const_iterator it = values.begin();
-        for ( ; it!=values.end(); ++it )
-        {
-            appendNumber ( *it );
-            appendChar ( ' ' );
-        }
+        if ( !values.empty() )
+            mCharacterBuffer->copyToBufferAsChar( &values[0], values.size() );
 
         mOpenTags.back().mHasText = true;
     }
@@ -516,12 +517,8 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        std::vector<double>::const_iterator it = values.begin();
-        for ( ; it!=values.end(); ++it )
-        {
-            appendNumber ( *it );
-            appendChar ( ' ' );
-        }
+        if ( !values.empty() )
+            mCharacterBuffer->copyToBufferAsChar( &values[0], values.size(), mDoublePrecision );
 
         mOpenTags.back().mHasText = true;
     }
@@ -1171,4 +1168,130 @@ namespace COLLADASW
 	{
 		mCharacterBuffer->copyToBufferAsChar( value );
 	}
+
+	//---------------------------------------------------------------
+	void StreamWriter::setBinaryArrays( BinaryArrayEncoding encoding, size_t minimumValueCount, bool keepText )
+	{
+		mBinaryArrayEncoding = encoding;
+		mBinaryArrayMinimumValueCount = minimumValueCount;
+		mKeepBinaryArrayText = keepText;
+	}
+
+	//---------------------------------------------------------------
+	void StreamWriter::appendBinaryArray( const BinaryArray& binaryArray )
+	{
+		openElement ( CSWC::CSW_ELEMENT_BINARY_ARRAY );
+		appendAttribute ( CSWC::CSW_ATTRIBUTE_TYPE, binaryArray.getValueTypeName() );
+		appendAttribute ( CSWC::CSW_ATTRIBUTE_COUNT, (unsigned long)binaryArray.getValueCount() );
+
+		unsigned long long offset = 0;
+		if ( mBinaryArrayEncoding == BINARY_ARRAYS_SIDECAR
+			&& openBinaryFile()
+			&& writeToBinaryFile( binaryArray.getData(), binaryArray.getSize(), offset ) )
+		{
+			size_t separatorPos = mFileName.find_last_of( "/\\" );
+			String binaryFileName = ( separatorPos == String::npos ) ? mFileName : mFileName.substr( separatorPos + 1 );
+			appendAttribute ( CSWC::CSW_ATTRIBUTE_URL, COLLADABU::URI::uriEncode( binaryFileName + ".bin" ) );
+			appendAttribute ( CSWC::CSW_ATTRIBUTE_OFFSET, Utils::toString( offset ) );
+		}
+		else
+		{
+			// also used, if the binary file could not be written
+			appendAttribute ( CSWC::CSW_ATTRIBUTE_ENCODING, CSWC::CSW_BINARY_ARRAY_ENCODING_BASE64 );
+			appendBase64( binaryArray.getData(), binaryArray.getSize() );
+		}
+		closeElement();
+	}
+
+	//---------------------------------------------------------------
+	bool StreamWriter::openBinaryFile()
+	{
+		// a file next to an archive can not be referenced by the document inside it
+		if ( hasExtension( mFileName, ".zae" ) )
+			return false;
+
+		if ( !mBinaryFileFlusher )
+		{
+			mBinaryFileFlusher = new Common::FWriteBufferFlusher( ( mFileName + ".bin" ).c_str(), FWRITEBUFFERSIZE );
+		}
+		return mBinaryFileFlusher->getError() == 0;
+	}
+
+	//---------------------------------------------------------------
+	bool StreamWriter::writeToBinaryFile( const unsigned char* data, size_t size, unsigned long long& offset )
+	{
+		// the loader may map the values straight from the file, so they are aligned for every value type
+		static const char padding[8] = { 0 };
+		size_t paddingSize = (size_t)( ( 8 - mBinaryFileSize % 8 ) % 8 );
+		if ( paddingSize > 0 )
+		{
+			if ( !mBinaryFileFlusher->receiveData( padding, paddingSize ) )
+				return false;
+			mBinaryFileSize += paddingSize;
+		}
+
+		offset = mBinaryFileSize;
+		if ( size > 0 && !mBinaryFileFlusher->receiveData( (const char*)data, size ) )
+			return false;
+		mBinaryFileSize += size;
+		return true;
+	}
+
+	//---------------------------------------------------------------
+	void StreamWriter::appendBase64( const unsigned char* data, size_t size )
+	{
+		static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+		prepareToAddContents();
+
+		// encode blocks of 3 bytes into 4 characters, 48 blocks per line
+		char line[65];
+		size_t linePos = 0;
+		for ( size_t i = 0; i < size; i += 3 )
+		{
+			unsigned int block = (unsigned int)data[i] << 16;
+			if ( i + 1 < size )
+				block |= (unsigned int)data[i + 1] << 8;
+			if ( i + 2 < size )
+				block |= (unsigned int)data[i + 2];
+
+			line[linePos++] = alphabet[( block >> 18 ) & 0x3f];
+			line[linePos++] = alphabet[( block >> 12 ) & 0x3f];
+			line[linePos++] = ( i + 1 < size ) ? alphabet[( block >> 6 ) & 0x3f] : '=';
+			line[linePos++] = ( i + 2 < size ) ? alphabet[block & 0x3f] : '=';
+
+			if ( linePos == 64 || i + 3 >= size )
+			{
+				appendNewLine();
+				addWhiteSpace ( mLevel * mIndent );
+				appendString ( line, linePos );
+				linePos = 0;
+			}
+		}
+		mOpenTags.back().mHasText = false;
+	}
+
+	//---------------------------------------------------------------
+	bool StreamWriter::hasExtension( const String& fileName, const char* extension )
+	{
+		size_t extensionLength = strlen( extension );
+		return fileName.length() >= extensionLength
+			&& Utils::equalsIgnoreCase( fileName.substr( fileName.length() - extensionLength ), extension );
+	}
+
+	//---------------------------------------------------------------
+	Common::IBufferFlusher* StreamWriter::createBufferFlusher( const NativeString& fileName, int& error )
+	{
+		if ( hasExtension( fileName, ".gz" ) || hasExtension( fileName, ".zae" ) )
+		{
+			Common::GzipBufferFlusher::Format format = hasExtension( fileName, ".zae" ) ? Common::GzipBufferFlusher::FORMAT_ZAE : Common::GzipBufferFlusher::FORMAT_GZIP;
+			Common::GzipBufferFlusher* gzipBufferFlusher = new Common::GzipBufferFlusher( fileName.c_str(), format );
+			error = gzipBufferFlusher->getError();
+			return gzipBufferFlusher;
+		}
+
+		Common::FWriteBufferFlusher* fWriteBufferFlusher = new Common::FWriteBufferFlusher( fileName.c_str(), FWRITEBUFFERSIZE );
+		error = fWriteBufferFlusher->getError();
+		return fWriteBufferFlusher;
+	}
 } //namespace COLLADASW
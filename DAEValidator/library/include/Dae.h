@@ -6,6 +6,7 @@
 #include <set>
 #include "no_warning_string"
 #include <tuple>
+#include <unordered_map>
 #include "no_warning_vector"
 
 namespace opencollada
@@ -23,6 +24,24 @@ namespace opencollada
 			COLLADA15
 		};
 
+		// Attribute holding an xs:anyURI. DAE references are resolved in the referenced document.
+		struct UriAttribute
+		{
+			const std::string* name;
+			bool daeReference;
+		};
+
+		// Element name to its xs:anyURI attributes
+		using UriAttributes = std::unordered_map<std::string, std::vector<UriAttribute>>;
+
+		// xs:anyURI and IDREFs of a document, and the documents it references
+		struct Links
+		{
+			std::map<Uri, Dae> externalDAEs;
+			std::vector<std::tuple<size_t, Uri>> anyURIs;
+			std::vector<std::tuple<size_t, std::string>> IDREFs;
+		};
+
 		Dae() = default;
 		Dae(Dae && other);
 		const Dae & operator = (Dae && other);
@@ -33,31 +52,42 @@ namespace opencollada
 		static const std::string & GetColladaNamespace141();
 		static const std::string & GetColladaNamespace15();
 
+		static const UriAttributes & GetUriAttributes();
+
 		virtual void readFile(const std::string & path) override;
 		
 		Version getVersion() const;
 
 		const Uri & getURI() const { return mUri; }
 
-		const std::map<Uri, Dae> & getExternalDAEs() const { return mExternalDAEs; }
-		const std::vector<std::tuple<size_t, Uri>> & getAnyURIs() const { return mAnyURIs; }
-		const std::vector<std::tuple<size_t, std::string>> & getIDREFs() const { return mIDREFs; }
+		// Links are collected with one traversal of the document on first use.
+		const Links & getLinks() const;
+		const std::map<Uri, Dae> & getExternalDAEs() const { return getLinks().externalDAEs; }
+		const std::vector<std::tuple<size_t, Uri>> & getAnyURIs() const { return getLinks().anyURIs; }
+		const std::vector<std::tuple<size_t, std::string>> & getIDREFs() const { return getLinks().IDREFs; }
 		const std::set<std::string> & getIds() const;
 
+		// Adds the xs:anyURI and IDREFs of node, not of its children, to links.
+		// Lets a traversal of the document done for other checks collect the links as well.
+		void collectLinks(const XmlNode & node, Links & links) const;
+		// Loads the external DAEs found by collectLinks().
+		static void ReadExternalDAEs(Links & links);
+
 	private:
 		void readExternalFile(const std::string & path);
-		void onAnyDAEURI(size_t line, const std::string & uri);
-		void onAnyURI(size_t line, const std::string & uri);
+		void onAnyDAEURI(size_t line, const std::string & uri, Links & links) const;
+		void onAnyURI(size_t line, const std::string & uri, Links & links) const;
 		void initializeCache() const;
+		static bool IsColladaElement(const XmlNode & node);
 
 		Dae(const Dae&) = delete;
 		const Dae& operator = (const Dae&) = delete;
 
 	private:
 		Uri mUri;
-		std::map<Uri, Dae> mExternalDAEs;
-		std::vector<std::tuple<size_t, Uri>> mAnyURIs;
-		std::vector<std::tuple<size_t, std::string>> mIDREFs;
+
+		mutable Links mLinks;
+		mutable bool mLinksInitialized = false;
 
 		mutable std::set<std::string> mIdCache;
 		mutable bool mCacheInitialized = false;
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <iosfwd>
+#include <set>
+#include "no_warning_string"
+
+namespace opencollada
+{
+	// Checks unique ids, unique sids and links of a COLLADA document with a single SAX pass,
+	// without building the document tree. Memory used grows with the number of ids, not with the file size.
+	// Schema validation still needs the tree and is not done here.
+	class DaeStreamChecker
+	{
+	public:
+		// Writes errors to err. Returns 0 if no error has been found.
+		static int Check(const std::string & path, std::ostream & err);
+
+		// Collects the ids declared in a document. Returns false if it could not be parsed.
+		static bool ReadIds(const std::string & path, std::set<std::string> & ids);
+	};
+}
\ No newline at end of file
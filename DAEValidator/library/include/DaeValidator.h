@@ -6,37 +6,61 @@
 #include "no_warning_list"
 #include "no_warning_map"
 #include "no_warning_string"
+#include <iosfwd>
+#include <mutex>
 
 namespace opencollada
 {
 	class DaeValidator
 	{
 	public:
-		DaeValidator(const std::list<std::string> & daePaths);
+		// threadCount is the number of documents processed in parallel. 0 uses one thread per hardware thread.
+		// Output is written in the order of daePaths, whatever the number of threads.
+		DaeValidator(const std::list<std::string> & daePaths, size_t threadCount = 1);
 
 		int checkAll() const;
 		int checkSchema(const std::string & schema_uri = std::string()) const;
 		int checkUniqueIds() const;
 		int checkUniqueSids() const;
 		int checkLinks() const;
+		// Checks ids, sids and links while reading the documents, without loading them in memory.
+		int checkStreaming() const;
+
+		static int CheckEscapeChar(const std::string & s);
+		// Reports non-escaped characters and duplicates of id. Adds id to ids.
+		static int CheckId(const Uri & uri, const std::string & id, size_t line, std::map<std::string, size_t> & ids, std::ostream & err);
+		// Reports duplicates of sid within its parent. Adds sid to sids.
+		static int CheckSid(const Uri & uri, const std::string & sid, size_t line, std::map<std::string, size_t> & sids, std::ostream & err);
 
 	private:
-		int checkSchema(const Dae & dae) const;
-		int checkAll(const Dae & dae) const;
-		int checkUniqueIds(const Dae & dae) const;
-		int checkUniqueSids(const Dae & dae) const;
-		int checkLinks(const Dae & dae) const;
+		using PathTask = std::function<int(const std::string &, std::ostream &, std::ostream &)>;
+		using Task = std::function<int(const Dae &, std::ostream &, std::ostream &)>;
+		using IdLookup = std::function<bool(const std::string &)>;
 
-		int for_each_dae(const std::function<int(const Dae &)> & task) const;
+		int checkSchema(const Dae & dae, std::ostream & out, std::ostream & err) const;
+		int checkAll(const Dae & dae, std::ostream & out, std::ostream & err) const;
+		int checkUniqueIds(const Dae & dae, std::ostream & out, std::ostream & err) const;
+		int checkUniqueSids(const Dae & dae, std::ostream & out, std::ostream & err) const;
+		int checkLinks(const Dae & dae, std::ostream & out, std::ostream & err) const;
+		int checkLinks(const Dae & dae, const Dae::Links & links, const IdLookup & hasId, std::ostream & err) const;
+		// Checks ids, sids and links with a single traversal of the document, which also collects the links.
+		int checkIdsSidsAndLinks(const Dae & dae, std::ostream & out, std::ostream & err) const;
+
+		int for_each_dae(const Task & task) const;
+		int for_each_path(const PathTask & task) const;
+		int for_each_path_parallel(const PathTask & task, size_t threadCount) const;
+		int processPath(size_t index, const PathTask & task, std::ostream & out, std::ostream & err) const;
 
 		static int ValidateAgainstSchema(const Dae & dae, const XmlSchema & schema);
-		static int CheckEscapeChar(const std::string & s);
 
 	private:
 		std::vector<std::string> mDaePaths;
+		size_t mThreadCount = 1;
 		// namespace to XmlSchema
 		mutable std::map<std::string, XmlSchema> mSchemas;
 		// namespace to xsd location
 		mutable std::map<std::string, std::string> mSchemaLocations;
+		// Guards mSchemas and mSchemaLocations when documents are processed in parallel
+		mutable std::mutex mSchemasMutex;
 	};
 }
\ No newline at end of file
@@ -25,8 +25,13 @@ namespace opencollada
 
 		const XmlDoc & operator = (XmlDoc && other);
 
+		// Reads a plain or gzip compressed document, the root document of a .zae archive
+		// or a member of a .zae archive, as in "dir/scene.zae/models/tree.dae".
 		virtual void readFile(const std::string & path);
 
+		// Path of the document read last. For a .zae archive this is the path of its root document.
+		const std::string & getPath() const;
+
 		operator bool() const;
 		void reset();
 		XmlNode root() const;
@@ -61,6 +66,8 @@ namespace opencollada
 	private:
 		xmlDocPtr mDoc = nullptr;
 
+		std::string mPath;
+
 		XPathCache mXPathCache;
 	};
 }
\ No newline at end of file
@@ -24,6 +24,7 @@ namespace opencollada
 		XmlDoc & doc() const;
 		XmlNode child(const std::string & name) const;
 		XmlNode firstChild() const;
+		XmlNode parent() const; // Null for the root element.
 		std::string text() const;
 		std::string name() const;
 		class XmlAttribute attribute(const std::string & name) const;
@@ -34,6 +35,7 @@ namespace opencollada
 		size_t line() const;
 
 		void for_each_attribute(const std::function<void(const class XmlAttribute &)> & fn) const;
+		void for_each_child(const std::function<void(const XmlNode &)> & fn) const; // Element children only.
 
 	private:
 		XmlNode(xmlNodePtr node);
@@ -19,7 +19,9 @@ namespace opencollada
 	const char* checkUniqueIds = "--check-unique-ids";
 	const char* checkUniqueSids = "--check-unique-sids";
 	const char* checkLinks = "--check-links";
+	const char* streaming = "--streaming";
 	const char* recursive = "--recursive";
+	const char* threads = "--threads";
 	const char* quiet = "--quiet";
 	const char* help = "--help";
 
@@ -35,7 +37,9 @@ namespace opencollada
 		argparse.addArgument(checkUniqueIds).help("Check that ids in documents are unique.");
 		argparse.addArgument(checkUniqueSids).help("Check that sids in documents are unique in their scope.");
 		argparse.addArgument(checkLinks).help("Check that URIs refer to valid files and/or elements.");
+		argparse.addArgument(streaming).help("Check ids, sids and links while reading documents, without loading them in memory. Use it for very large documents. Schema checks are only done if requested.");
 		argparse.addArgument(recursive).help("Recursively parse directories. Ignored if 'path' is not a directory.");
+		argparse.addArgument(threads).numParameters(1).hint(0, "count").help("Number of documents processed in parallel. 0 uses one thread per core. Output order does not depend on it. Default is 1.");
 		argparse.addArgument(quiet).help("If set, no output is sent to standard out/err.");
 		argparse.addArgument(help).help("Display help.");
 
@@ -74,10 +78,24 @@ namespace opencollada
 			return 0;
 		}
 
-		DaeValidator validator(daePaths);
+		size_t threadCount = 1;
+		if (const auto & arg = argparse.findArgument(threads))
+			threadCount = arg.getValue<size_t>();
+
+		DaeValidator validator(daePaths, threadCount);
 		int result = 0;
 
-		if (!argparse.findArgument(checkSchemaAuto) &&
+		if (argparse.findArgument(streaming))
+		{
+			result |= validator.checkStreaming();
+
+			if (argparse.findArgument(checkSchemaAuto))
+				result |= validator.checkSchema();
+
+			if (const auto & arg = argparse.findArgument(checkSchema))
+				result |= validator.checkSchema(arg.getValue<string>());
+		}
+		else if (!argparse.findArgument(checkSchemaAuto) &&
 			!argparse.findArgument(checkUniqueIds) &&
 			!argparse.findArgument(checkUniqueSids) &&
 			!argparse.findArgument(checkSchema) &&
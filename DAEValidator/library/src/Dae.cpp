@@ -3,7 +3,9 @@
 #include "PathUtil.h"
 #include "StringUtil.h"
 #include "Strings.h"
+#include "no_warning_algorithm"
 #include <iostream>
+#include <mutex>
 #include "no_warning_sstream"
 
 using namespace std;
@@ -18,10 +20,6 @@ namespace opencollada
 	string Dae::mColladaSchemaFileName15 = "collada_schema_1_5.xsd";
 	XmlSchema Dae::mColladaSchema15;
 
-	const string xpath_all = "//collada:";
-	const string xpath_or_all = "|//collada:";
-	const string xpath_child = "/collada:";
-
 	Dae::Dae(Dae && other)
 	{
 		*this = move(other);
@@ -31,16 +29,21 @@ namespace opencollada
 	{
 		this->XmlDoc::operator=(move(other));
 		mUri = move(other.mUri);
-		mExternalDAEs = move(other.mExternalDAEs);
+		mLinks = move(other.mLinks);
+		mLinksInitialized = other.mLinksInitialized;
 		return *this;
 	}
 
 	const XmlSchema & Dae::GetColladaSchema141()
 	{
-		if (!mColladaSchema141)
-			mColladaSchema141.readFile(Path::Join(Path::GetExecutableDirectory(), mColladaSchemaFileName141));
-		if (!mColladaSchema141)
-			mColladaSchema141.readFile(Path::Join(Path::GetWorkingDirectory(), mColladaSchemaFileName141));
+		// Documents may be validated by several threads
+		static once_flag loaded;
+		call_once(loaded, []() {
+			if (!mColladaSchema141)
+				mColladaSchema141.readFile(Path::Join(Path::GetExecutableDirectory(), mColladaSchemaFileName141));
+			if (!mColladaSchema141)
+				mColladaSchema141.readFile(Path::Join(Path::GetWorkingDirectory(), mColladaSchemaFileName141));
+		});
 		return mColladaSchema141;
 	}
 
@@ -63,215 +66,181 @@ namespace opencollada
 		return mColladaNamespace15;
 	}
 
-	void Dae::readFile(const string & path)
+	const Dae::UriAttributes & Dae::GetUriAttributes()
 	{
-		mUri = Uri::FromNativePath(path);
+		// Built on first use, Strings are initialized in another translation unit
+		static const string camera_node = "camera_node";
+		static const UriAttributes uriAttributes = {
+			// InstanceWithExtra and other <instance_*> with "url" attribute
+			{ Strings::instance_animation, { { &Strings::url, true } } },
+			{ Strings::instance_camera, { { &Strings::url, true } } },
+			{ Strings::instance_controller, { { &Strings::url, true } } },
+			{ Strings::instance_effect, { { &Strings::url, true } } },
+			{ Strings::instance_force_field, { { &Strings::url, true } } },
+			{ Strings::instance_formula, { { &Strings::url, true } } },
+			{ Strings::instance_geometry, { { &Strings::url, true } } },
+			{ Strings::instance_image, { { &Strings::url, true } } },
+			{ Strings::instance_joint, { { &Strings::url, true } } },
+			{ Strings::instance_kinematics_model, { { &Strings::url, true } } },
+			{ Strings::instance_kinematics_scene, { { &Strings::url, true } } },
+			{ Strings::instance_light, { { &Strings::url, true } } },
+			{ Strings::instance_node, { { &Strings::url, true }, { &Strings::proxy, true } } },
+			{ Strings::instance_physics_material, { { &Strings::url, true } } },
+			{ Strings::instance_physics_model, { { &Strings::url, true }, { &Strings::parent, true } } },
+			{ Strings::instance_physics_scene, { { &Strings::url, true } } },
+			{ Strings::instance_visual_scene, { { &Strings::url, true } } },
+			{ Strings::accessor, { { &Strings::source, true } } },
+			{ Strings::skin, { { &Strings::source, true } } },
+			{ Strings::morph, { { &Strings::source, true } } },
+			{ Strings::render, { { &camera_node, true } } },
+			{ Strings::instance_material, { { &Strings::target, true } } },
+			{ Strings::instance_rigid_body, { { &Strings::target, true } } },
+			{ Strings::convex_mesh, { { &Strings::convex_hull_of, true } } },
+			// TODO
+			// rigid_body attribute of <attachment> and <ref_attachment> is an sid. Make sid check.
+			{ Strings::include, { { &Strings::url, false } } },
+			{ Strings::profile_BRIDGE, { { &Strings::url, false } } },
+			// URI fragments
+			{ Strings::channel, { { &Strings::source, false } } },
+			{ Strings::input, { { &Strings::source, false } } }
+			// Ignore these anyURI:
+			// <COLLADA>@base
+			// <contributor>/<author_website>
+			// <contributor>/<source_data>
+		};
+		return uriAttributes;
+	}
 
+	void Dae::readFile(const string & path)
+	{
 		Super::readFile(path);
 
-		if (!*this)
-			return;
+		// The root document of a .zae archive is identified by its path in the archive
+		mUri = Uri::FromNativePath(getPath());
 
-		// List referenced DAEs
-
-		// InstanceWithExtra and other <instance_*> with "url" attribute
-		const auto & instances = root().selectNodes(
-			xpath_all + Strings::instance_animation +
-			xpath_or_all + Strings::instance_camera +
-			xpath_or_all + Strings::instance_controller +
-			xpath_or_all + Strings::instance_effect +
-			xpath_or_all + Strings::instance_force_field +
-			xpath_or_all + Strings::instance_formula +
-			xpath_or_all + Strings::instance_geometry +
-			xpath_or_all + Strings::instance_image +
-			xpath_or_all + Strings::instance_joint +
-			xpath_or_all + Strings::instance_kinematics_model +
-			xpath_or_all + Strings::instance_kinematics_scene +
-			xpath_or_all + Strings::instance_light +
-			xpath_or_all + Strings::instance_node +
-			xpath_or_all + Strings::instance_physics_material +
-			xpath_or_all + Strings::instance_physics_model +
-			xpath_or_all + Strings::instance_physics_scene +
-			xpath_or_all + Strings::instance_visual_scene
-		);
-		for (auto instance : instances)
-			if (auto url = instance.attribute(Strings::url))
-				onAnyDAEURI(instance.line(), url.value());
-
-		// <instance_node>
-		const auto & instance_nodes = root().selectNodes(xpath_all + Strings::instance_node);
-		for (auto instance_node : instance_nodes)
-		{
-			if (auto proxy = instance_node.attribute(Strings::proxy))
-				onAnyDAEURI(instance_node.line(), proxy.value());
-		}
+		mLinks = Links();
+		mLinksInitialized = false;
+	}
 
-		// <accessor>
-		// <skin>
-		// <morph>
-		const auto & elementsWithSource = root().selectNodes(
-			xpath_all + Strings::accessor +
-			xpath_or_all + Strings::skin +
-			xpath_or_all + Strings::morph
-		);
-		for (auto element : elementsWithSource)
-		{
-			if (auto source = element.attribute(Strings::source))
-				onAnyDAEURI(element.line(), source.value());
-		}
+	Dae::Version Dae::getVersion() const
+	{
+		string root_namespace = getRootNamespace();
+		if (root_namespace == Dae::GetColladaNamespace141())
+			return Version::COLLADA14;
+		else if (root_namespace == Dae::GetColladaNamespace15())
+			return Version::COLLADA15;
+		return Version::Unknown;
+	}
 
-		// <render>
-		const auto & renders = root().selectNodes(xpath_all + Strings::render);
-		for (auto render : renders)
-		{
-			if (auto camera_node = render.attribute("camera_node"))
-				onAnyDAEURI(render.line(), camera_node.value());
-		}
+	const set<string> & Dae::getIds() const
+	{
+		initializeCache();
+		return mIdCache;
+	}
 
-		// <skeleton>
-		const auto & skeletons = root().selectNodes(xpath_all + Strings::skeleton);
-		for (auto skeleton : skeletons)
-		{
-			onAnyDAEURI(skeleton.line(), skeleton.text());
-		}
+	void Dae::readExternalFile(const string & url)
+	{
+		// Simple load file but not the references
+		Super::readFile(url);
+	}
 
-		// <instance_material>
-		// <instance_rigid_body>
-		const auto & elementsWithTarget = root().selectNodes(
-			xpath_all + Strings::instance_material +
-			xpath_or_all + Strings::instance_rigid_body
-		);
-		for (auto element : elementsWithTarget)
+	const Dae::Links & Dae::getLinks() const
+	{
+		if (!mLinksInitialized)
 		{
-			if (auto target = element.attribute(Strings::target))
-				onAnyDAEURI(element.line(), target.value());
-		}
+			mLinksInitialized = true;
 
-		// <instance_physics_model>
-		const auto & instance_physics_models = root().selectNodes(xpath_all + Strings::instance_physics_model);
-		for (auto instance_physics_model : instance_physics_models)
-		{
-			if (auto parent = instance_physics_model.attribute(Strings::parent))
-				onAnyDAEURI(instance_physics_model.line(),  parent.value());
-		}
+			// Depth first traversal in document order
+			vector<XmlNode> nodes;
+			if (auto root_node = root())
+				nodes.push_back(root_node);
+			while (!nodes.empty())
+			{
+				XmlNode node = nodes.back();
+				nodes.pop_back();
+				collectLinks(node, mLinks);
+
+				size_t firstChild = nodes.size();
+				node.for_each_child([&](const XmlNode & child) {
+					nodes.push_back(child);
+				});
+				reverse(nodes.begin() + static_cast<ptrdiff_t>(firstChild), nodes.end());
+			}
 
-		// <convex_mesh>
-		const auto & convex_meshes = root().selectNodes(xpath_all + Strings::convex_mesh);
-		for (auto convex_mesh : convex_meshes)
-		{
-			if (auto convex_hull_of = convex_mesh.attribute(Strings::convex_hull_of))
-				onAnyDAEURI(convex_mesh.line(), convex_hull_of.value());
+			ReadExternalDAEs(mLinks);
 		}
+		return mLinks;
+	}
 
-		// TODO
-		// rigid_body attribute is an sid. Make sid check.
-
-		// <ref_attachment>
-		// <attachment>
-		//auto attachments = root().selectNodes(
-		//	xpath_all + Strings::attachment +
-		//	xpath_or_all + Strings::ref_attachment
-		//);
-		//for (auto attachment : attachments)
-		//{
-		//	if (auto rigid_body = attachment.attribute(Strings::rigid_body))
-		//		onAnyDAEURI(attachment.line(), rigid_body.value());
-		//}
-
-		// Load found DAE references
-		for (auto & uri_dae : mExternalDAEs)
-			uri_dae.second.readExternalFile(uri_dae.first.nativePath());
-
-		// Look for additional xs:anyURI that are not DAE references:
-
-		// <image>/<init_from>
-		const auto & init_froms = root().selectNodes(xpath_all + Strings::image + xpath_child + Strings::init_from);
-		for (auto init_from : init_froms)
-		{
-			onAnyURI(init_from.line(), init_from.text());
-		}
+	void Dae::collectLinks(const XmlNode & node, Links & links) const
+	{
+		const string name = node.name();
 
-		// <binary>/<ref>
-		// <init_from>/<ref>
-		const auto & refs = root().selectNodes(
-			xpath_all + Strings::binary + xpath_child + Strings::ref +
-			xpath_or_all + Strings::init_from + xpath_child + Strings::ref
-		);
-		for (auto ref : refs)
+		// xs:anyURI attributes
+		const auto & uriAttributes = GetUriAttributes();
+		auto it = uriAttributes.find(name);
+		if (it != uriAttributes.end())
 		{
-			onAnyURI(ref.line(), ref.text());
+			if (!IsColladaElement(node))
+				return;
+			for (const auto & uriAttribute : it->second)
+			{
+				if (auto attribute = node.attribute(*uriAttribute.name))
+				{
+					if (uriAttribute.daeReference)
+						onAnyDAEURI(node.line(), attribute.value(), links);
+					else
+						onAnyURI(node.line(), attribute.value(), links);
+				}
+			}
+			return;
 		}
 
-		// <include>
-		// <profile_BRIDGE>
-		const auto & elementsWithUrl = root().selectNodes(
-			xpath_all + Strings::include +
-			xpath_or_all + Strings::profile_BRIDGE
-		);
-		for (auto element : elementsWithUrl)
+		// xs:anyURI and IDREFs held by the text of the element
+		if (name == Strings::skeleton)
 		{
-			if (auto url = element.attribute(Strings::url))
-				onAnyURI(element.line(), url.value());
+			if (IsColladaElement(node))
+				onAnyDAEURI(node.line(), node.text(), links);
 		}
-
-		// Ignore these anyURI:
-		// <COLLADA>@base
-		// <contributor>/<author_website>
-		// <contributor>/<source_data>
-
-		// Look for URI fragments:
-
-		// <channel>
-		// <input>
-		const auto & elementsWithSourceFragment = root().selectNodes(
-			xpath_all + Strings::channel +
-			xpath_or_all + Strings::input
-		);
-		for (auto element : elementsWithSourceFragment)
+		else if (name == Strings::init_from || name == Strings::ref)
 		{
-			if (auto source = element.attribute(Strings::source))
-				//onURIFragment(element.line(), source.value());
-				onAnyURI(element.line(), source.value());
+			// <image>/<init_from>
+			// <binary>/<ref>
+			// <init_from>/<ref>
+			XmlNode parent = node.parent();
+			if (!parent || !IsColladaElement(node))
+				return;
+			string parentName = parent.name();
+			if (name == Strings::init_from ? parentName == Strings::image : (parentName == Strings::binary || parentName == Strings::init_from))
+				onAnyURI(node.line(), node.text(), links);
 		}
-
-		// Look for IDREFs
-
-		// <IDREF_array>
-		const auto & IDREF_arrays = root().selectNodes(xpath_all + Strings::IDREF_array);
-		for (auto IDREF_array : IDREF_arrays)
+		else if (name == Strings::IDREF_array)
 		{
-			stringstream ss(IDREF_array.text());
+			if (!IsColladaElement(node))
+				return;
+			stringstream ss(node.text());
 			string buffer;
 			while (ss >> buffer)
-				mIDREFs.emplace_back(IDREF_array.line(), buffer);
+				links.IDREFs.emplace_back(node.line(), buffer);
 		}
 	}
 
-	Dae::Version Dae::getVersion() const
+	void Dae::ReadExternalDAEs(Links & links)
 	{
-		string root_namespace = getRootNamespace();
-		if (root_namespace == Dae::GetColladaNamespace141())
-			return Version::COLLADA14;
-		else if (root_namespace == Dae::GetColladaNamespace15())
-			return Version::COLLADA15;
-		return Version::Unknown;
-	}
-
-	const set<string> & Dae::getIds() const
-	{
-		initializeCache();
-		return mIdCache;
+		for (auto & uri_dae : links.externalDAEs)
+			uri_dae.second.readExternalFile(uri_dae.first.nativePath());
 	}
 
-	void Dae::readExternalFile(const string & url)
+	bool Dae::IsColladaElement(const XmlNode & node)
 	{
-		// Simple load file but not the references
-		Super::readFile(url);
+		// The elements looked for are in the namespace of the root element
+		auto ns = node.ns();
+		return ns && ns.href() == node.doc().getRootNamespace();
 	}
 
-	void Dae::onAnyDAEURI(size_t line, const string & uri)
+	void Dae::onAnyDAEURI(size_t line, const string & uri, Links & links) const
 	{
-		onAnyURI(line, uri);
+		onAnyURI(line, uri, links);
 
 		if (String::StartsWith(uri, "#"))
 			return;
@@ -285,14 +254,14 @@ namespace opencollada
 			absoluteUriNoFragment.setFragment(string());
 			if (absoluteUriNoFragment != mUri)
 			{
-				mExternalDAEs[absoluteUriNoFragment] = Dae();
+				links.externalDAEs[absoluteUriNoFragment] = Dae();
 			}
 		}
 	}
 
-	void Dae::onAnyURI(size_t line, const string & uri)
+	void Dae::onAnyURI(size_t line, const string & uri, Links & links) const
 	{
-		mAnyURIs.emplace_back(line, Uri(mUri, uri));
+		links.anyURIs.emplace_back(line, Uri(mUri, uri));
 	}
 
 	void Dae::initializeCache() const
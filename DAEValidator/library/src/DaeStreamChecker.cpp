@@ -0,0 +1,378 @@
+#include "DaeStreamChecker.h"
+#include "DaeValidator.h"
+#include "PathUtil.h"
+#include "Strings.h"
+#include "StringUtil.h"
+#include "Uri.h"
+#include "no_warning_map"
+#include "no_warning_iostream"
+#include "no_warning_vector"
+
+#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
+#include "GeneratedSaxParserIErrorHandler.h"
+#include "GeneratedSaxParserLibxmlSaxParser.h"
+#include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserParserError.h"
+#include "GeneratedSaxParserZipArchive.h"
+#endif
+
+using namespace std;
+
+namespace opencollada
+{
+#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
+	namespace
+	{
+		// Returns the local part of a qualified name
+		const char* LocalName(const char* name)
+		{
+			for (const char* c = name; *c; ++c)
+				if (*c == ':')
+					name = c + 1;
+			return name;
+		}
+
+		class StreamChecker : public GeneratedSaxParser::Parser, public GeneratedSaxParser::IErrorHandler
+		{
+		public:
+			// If err is null, only the ids are collected.
+			StreamChecker(const string & path, ostream* err)
+				: GeneratedSaxParser::Parser(this)
+				, mPath(path)
+				, mUri(Uri::FromNativePath(path))
+				, mErr(err)
+			{}
+
+			int parse()
+			{
+				GeneratedSaxParser::LibxmlSaxParser saxParser(this, GeneratedSaxParser::LibxmlSaxParser::SAX2);
+
+				// Archives and compressed documents are decompressed on another thread while they are checked
+				GeneratedSaxParser::ZipArchive archive;
+				string memberName;
+				if (archive.openDocument(mPath, memberName))
+				{
+					mUri = Uri::FromNativePath(archive.getFileName() + "/" + memberName);
+					saxParser.parseZipArchiveMember(archive, memberName);
+				}
+				else if (GeneratedSaxParser::SaxParser::isGzipFile(mPath.c_str()))
+				{
+					saxParser.parseGzipFile(mPath.c_str());
+				}
+				else
+				{
+					saxParser.parseFile(mPath.c_str());
+				}
+				if (mErr)
+					resolvePendingFragments();
+				return mResult;
+			}
+
+			const map<string, size_t> & getIds() const { return mIds; }
+
+			// Parser
+			virtual bool elementBegin(const GeneratedSaxParser::ParserChar* elementName, const GeneratedSaxParser::ParserAttributes & attributes) override
+			{
+				size_t line = getLineNumber();
+
+				if (mDepth > 0)
+				{
+					// Text of the parent is read up to its first child, as XmlNode::text()
+					Element & parent = mElements[mDepth - 1];
+					if (!parent.hasChild)
+					{
+						parent.hasChild = true;
+						endText(parent);
+					}
+				}
+
+				if (mDepth == mElements.size())
+					mElements.emplace_back();
+				Element & element = mElements[mDepth];
+				element.name = LocalName(elementName);
+				element.line = line;
+				element.text = Text::None;
+				element.hasChild = false;
+				element.childSids.clear();
+				++mDepth;
+
+				const GeneratedSaxParser::ParserChar** attribute = attributes.attributes;
+				for (; attribute && *attribute; attribute += 2)
+				{
+					const char* name = LocalName(attribute[0]);
+					if (name == Strings::id)
+					{
+						if (mErr)
+							mResult |= DaeValidator::CheckId(mUri, attribute[1], line, mIds, *mErr);
+						else
+							mIds.insert(make_pair(attribute[1], line));
+					}
+					else if (mErr && name == sid && mDepth > 1)
+					{
+						mResult |= DaeValidator::CheckSid(mUri, attribute[1], line, mElements[mDepth - 2].childSids, *mErr);
+					}
+				}
+
+				if (!mErr)
+					return true;
+
+				const auto & uriAttributes = Dae::GetUriAttributes();
+				auto it = uriAttributes.find(element.name);
+				if (it != uriAttributes.end())
+				{
+					for (const auto & uriAttribute : it->second)
+					{
+						for (attribute = attributes.attributes; attribute && *attribute; attribute += 2)
+						{
+							if (LocalName(attribute[0]) == *uriAttribute.name)
+							{
+								onAnyURI(line, attribute[1], uriAttribute.daeReference);
+								break;
+							}
+						}
+					}
+				}
+
+				const string* parentName = mDepth > 1 ? &mElements[mDepth - 2].name : nullptr;
+				if (element.name == Strings::skeleton)
+					element.text = Text::DaeURI;
+				else if (element.name == Strings::init_from && parentName && *parentName == Strings::image)
+					element.text = Text::AnyURI;
+				else if (element.name == Strings::ref && parentName && (*parentName == Strings::binary || *parentName == Strings::init_from))
+					element.text = Text::AnyURI;
+				else if (element.name == Strings::IDREF_array)
+					element.text = Text::IDREFs;
+
+				mText.clear();
+				return true;
+			}
+
+			virtual bool elementEnd(const GeneratedSaxParser::ParserChar* elementName) override
+			{
+				if (mDepth == 0)
+					return true;
+				Element & element = mElements[--mDepth];
+				if (!element.hasChild)
+					endText(element);
+				element.childSids.clear();
+				return true;
+			}
+
+			virtual bool textData(const GeneratedSaxParser::ParserChar* text, size_t textLength) override
+			{
+				if (mDepth == 0)
+					return true;
+				Element & element = mElements[mDepth - 1];
+				if (element.hasChild)
+					return true;
+
+				if (element.text == Text::IDREFs)
+				{
+					// IDREFs are checked as they are read, the text of an IDREF_array may be huge
+					for (size_t i = 0; i < textLength; ++i)
+					{
+						char c = text[i];
+						if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+							onIDREF(element.line);
+						else
+							mText += c;
+					}
+				}
+				else if (element.text != Text::None)
+				{
+					mText.append(text, textLength);
+				}
+				return true;
+			}
+
+			// IErrorHandler
+			virtual bool handleError(const GeneratedSaxParser::ParserError & error) override
+			{
+				mResult |= 1;
+				if (mErr)
+				{
+					if (error.getErrorType() == GeneratedSaxParser::ParserError::ERROR_COULD_NOT_OPEN_FILE)
+					{
+						*mErr << "Error loading " << mPath << endl;
+					}
+					else
+					{
+						string message = error.getAdditionalText();
+						while (!message.empty() && (message.back() == '\n' || message.back() == '\r'))
+							message.pop_back();
+						*mErr << mUri << ":" << getLineNumber() << ": " << message << endl;
+					}
+				}
+				return false;
+			}
+
+			virtual void beginReporting() override {}
+			virtual void endReporting() override {}
+			virtual bool hasErrors() const override { return mResult != 0; }
+			virtual bool hasCriticalError() const override { return mResult != 0; }
+
+		private:
+			enum class Text
+			{
+				None,
+				AnyURI,
+				DaeURI,
+				IDREFs
+			};
+
+			struct Element
+			{
+				string name;
+				size_t line = 0;
+				Text text = Text::None;
+				bool hasChild = false;
+				// sid to line of the children of this element
+				map<string, size_t> childSids;
+			};
+
+			struct ExternalDae
+			{
+				bool loaded = false;
+				set<string> ids;
+			};
+
+			void endText(Element & element)
+			{
+				if (element.text == Text::IDREFs)
+					onIDREF(element.line);
+				else if (element.text != Text::None)
+					onAnyURI(element.line, mText, element.text == Text::DaeURI);
+				element.text = Text::None;
+				mText.clear();
+			}
+
+			void onIDREF(size_t line)
+			{
+				if (mText.empty())
+					return;
+				onFragment(line, mText);
+				mText.clear();
+			}
+
+			void onAnyURI(size_t line, const string & uri, bool daeReference)
+			{
+				// Local references are the most frequent ones, they don't need to be parsed or looked up on disk
+				if (String::StartsWith(uri, "#"))
+				{
+					onFragment(line, uri.substr(1));
+					return;
+				}
+
+				Uri absoluteUri(mUri, uri);
+				if (!Path::Exists(absoluteUri.nativePath()))
+				{
+					*mErr << mUri << ":" << line << ": Can't resolve " << absoluteUri << endl;
+					mResult |= 1;
+					return;
+				}
+
+				if (absoluteUri.fragment().empty())
+					return;
+
+				Uri noFragmentUri(absoluteUri);
+				noFragmentUri.setFragment("");
+				if (noFragmentUri == mUri)
+				{
+					onFragment(line, absoluteUri.fragment());
+				}
+				else if (daeReference && !absoluteUri.pathFile().empty())
+				{
+					auto it = mExternalDaes.find(noFragmentUri);
+					if (it == mExternalDaes.end())
+					{
+						it = mExternalDaes.insert(make_pair(noFragmentUri, ExternalDae())).first;
+						it->second.loaded = DaeStreamChecker::ReadIds(noFragmentUri.nativePath(), it->second.ids);
+					}
+
+					if (!it->second.loaded)
+					{
+						*mErr << mUri << ":" << line << ": " << absoluteUri << ": referenced file exists but has not been successfully loaded." << endl;
+						mResult |= 1;
+					}
+					else if (it->second.ids.find(absoluteUri.fragment()) == it->second.ids.end())
+					{
+						*mErr << mUri << ":" << line << ": Can't resolve " << absoluteUri << endl;
+						mResult |= 1;
+					}
+				}
+			}
+
+			void onFragment(size_t line, const string & id)
+			{
+				if (id.empty())
+					return;
+				// References to ids declared later are resolved once the whole document has been read
+				if (mIds.find(id) == mIds.end())
+					mPendingFragments.emplace_back(line, id);
+			}
+
+			void resolvePendingFragments()
+			{
+				for (const auto & fragment : mPendingFragments)
+				{
+					if (mIds.find(fragment.second) == mIds.end())
+					{
+						*mErr << mUri << ":" << fragment.first << ": Can't resolve #" << fragment.second << endl;
+						mResult |= 1;
+					}
+				}
+				mPendingFragments.clear();
+			}
+
+		private:
+			static const string sid;
+
+			string mPath;
+			Uri mUri;
+			ostream* mErr = nullptr;
+			int mResult = 0;
+
+			// Open elements. Entries beyond mDepth are kept to reuse their memory.
+			vector<Element> mElements;
+			size_t mDepth = 0;
+			// Text of the current element, or the IDREF being read
+			string mText;
+
+			// id to line
+			map<string, size_t> mIds;
+			// Line and id of the references to ids not declared before them
+			vector<pair<size_t, string>> mPendingFragments;
+			map<Uri, ExternalDae> mExternalDaes;
+		};
+
+		const string StreamChecker::sid = "sid";
+	}
+
+	int DaeStreamChecker::Check(const string & path, ostream & err)
+	{
+		StreamChecker checker(path, &err);
+		return checker.parse();
+	}
+
+	bool DaeStreamChecker::ReadIds(const string & path, set<string> & ids)
+	{
+		StreamChecker checker(path, nullptr);
+		if (checker.parse() != 0)
+			return false;
+		for (const auto & id : checker.getIds())
+			ids.insert(id.first);
+		return true;
+	}
+#else
+	int DaeStreamChecker::Check(const string &, ostream & err)
+	{
+		err << "Streaming checks need the libxml SAX parser." << endl;
+		return 1;
+	}
+
+	bool DaeStreamChecker::ReadIds(const string &, set<string> &)
+	{
+		return false;
+	}
+#endif
+}
@@ -1,13 +1,21 @@
 #include "Macros.h"
 #include "DaeValidator.h"
+#include "DaeStreamChecker.h"
 #include "PathUtil.h"
 #include "Strings.h"
 #include "StringUtil.h"
+#include "XmlAttribute.h"
+#include "no_warning_algorithm"
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <cstdio>
 #include "no_warning_iomanip"
 #include "no_warning_iostream"
+#include "no_warning_memory"
 #include <set>
 #include "no_warning_sstream"
+#include <thread>
 
 using namespace std;
 
@@ -25,7 +33,8 @@ namespace std
 
 namespace opencollada
 {
-	DaeValidator::DaeValidator(const list<string> & daePaths)
+	DaeValidator::DaeValidator(const list<string> & daePaths, size_t threadCount)
+		: mThreadCount(threadCount)
 	{
 		mDaePaths.reserve(daePaths.size());
 		mDaePaths.insert(mDaePaths.end(), daePaths.begin(), daePaths.end());
@@ -68,57 +77,159 @@ namespace opencollada
 		size_t mSize = 0;
 	};
 
-	int DaeValidator::for_each_dae(const function<int(const Dae &)> & task) const
+	// Output of a document processed by a worker thread
+	struct DaeOutput
 	{
+		stringstream out;
+		stringstream err;
+		string libxmlErr;
 		int result = 0;
-		size_t count = 1;
-		for (const auto & daePath : mDaePaths)
-		{
-			if (mDaePaths.size() > 1)
-			{
-				cout << "[" << count << "/" << mDaePaths.size() << " " << static_cast<size_t>(static_cast<float>(count) / static_cast<float>(mDaePaths.size()) * 100.0f) << "%]" << endl;
-				++count;
-			}
+		bool done = false;
+	};
 
-			cout << "Processing " << daePath << " (" << Size(Path::GetFileSize(daePath)).str() << ")" << endl;
+	static string ReadTempFile(FILE* file)
+	{
+		string content;
+		char buffer[4096];
+		rewind(file);
+		size_t count;
+		while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+			content.append(buffer, count);
+		return content;
+	}
 
+	int DaeValidator::for_each_dae(const Task & task) const
+	{
+		return for_each_path([&](const string & daePath, ostream & out, ostream & err) {
 			Dae dae;
 			dae.readFile(daePath);
 			if (dae)
 			{
-				result |= task(dae);
+				return task(dae, out, err);
 			}
-			else
+
+			err << "Error loading " << daePath << endl;
+			return 1;
+		});
+	}
+
+	int DaeValidator::for_each_path(const PathTask & task) const
+	{
+		size_t threadCount = mThreadCount == 0 ? thread::hardware_concurrency() : mThreadCount;
+		if (threadCount > mDaePaths.size())
+			threadCount = mDaePaths.size();
+
+		if (threadCount > 1)
+			return for_each_path_parallel(task, threadCount);
+
+		int result = 0;
+		for (size_t i = 0; i < mDaePaths.size(); ++i)
+		{
+			result |= processPath(i, task, cout, cerr);
+		}
+		return result;
+	}
+
+	int DaeValidator::for_each_path_parallel(const PathTask & task, size_t threadCount) const
+	{
+		// libxml has to be initialized by the main thread before other threads use it
+		xmlInitParser();
+
+		vector<unique_ptr<DaeOutput>> outputs;
+		outputs.reserve(mDaePaths.size());
+		for (size_t i = 0; i < mDaePaths.size(); ++i)
+			outputs.emplace_back(new DaeOutput);
+
+		atomic<size_t> nextIndex(0);
+		mutex outputsMutex;
+		condition_variable outputDone;
+
+		auto worker = [&]() {
+			for (size_t i = nextIndex++; i < outputs.size(); i = nextIndex++)
 			{
-				result |= 1;
-				cerr << "Error loading " << daePath << endl;
+				DaeOutput & output = *outputs[i];
+
+				// libxml writes the messages of this thread to a file of its own, formatted as for stderr.
+				// They are written before the document's own errors, as when processed serially.
+				FILE* libxmlErr = tmpfile();
+				if (libxmlErr)
+					xmlSetGenericErrorFunc(libxmlErr, nullptr);
+
+				int result = processPath(i, task, output.out, output.err);
+
+				if (libxmlErr)
+				{
+					xmlSetGenericErrorFunc(nullptr, nullptr);
+					output.libxmlErr = ReadTempFile(libxmlErr);
+					fclose(libxmlErr);
+				}
+				{
+					lock_guard<mutex> lock(outputsMutex);
+					output.result = result;
+					output.done = true;
+				}
+				outputDone.notify_all();
+			}
+		};
+
+		vector<thread> threads;
+		for (size_t i = 0; i < threadCount; ++i)
+			threads.emplace_back(worker);
+
+		// Write output in document order as soon as it is available
+		int result = 0;
+		for (auto & output : outputs)
+		{
+			{
+				unique_lock<mutex> lock(outputsMutex);
+				outputDone.wait(lock, [&]() { return output->done; });
 			}
+			cout << output->out.str();
+			cerr << output->libxmlErr << output->err.str();
+			result |= output->result;
+			output.reset();
 		}
+
+		for (auto & t : threads)
+			t.join();
+
 		return result;
 	}
 
+	int DaeValidator::processPath(size_t index, const PathTask & task, ostream & out, ostream & err) const
+	{
+		const auto & daePath = mDaePaths[index];
+		if (mDaePaths.size() > 1)
+		{
+			size_t count = index + 1;
+			out << "[" << count << "/" << mDaePaths.size() << " " << static_cast<size_t>(static_cast<float>(count) / static_cast<float>(mDaePaths.size()) * 100.0f) << "%]" << endl;
+		}
+
+		out << "Processing " << daePath << " (" << Size(Path::GetFileSize(daePath)).str() << ")" << endl;
+
+		return task(daePath, out, err);
+	}
+
 	int DaeValidator::checkAll() const
 	{
-		return for_each_dae([&](const Dae & dae) {
-			return checkAll(dae);
+		return for_each_dae([&](const Dae & dae, ostream & out, ostream & err) {
+			return checkAll(dae, out, err);
 		});
 	}
 
-	int DaeValidator::checkAll(const Dae & dae) const
+	int DaeValidator::checkAll(const Dae & dae, ostream & out, ostream & err) const
 	{
 		return
-			checkSchema(dae) |
-			checkUniqueIds(dae) |
-			checkUniqueSids(dae) |
-			checkLinks(dae);
+			checkSchema(dae, out, err) |
+			checkIdsSidsAndLinks(dae, out, err);
 	}
 
 	int DaeValidator::checkSchema(const string & schema_uri) const
 	{
 		if (schema_uri.empty())
 		{
-			return for_each_dae([&](const Dae & dae) {
-				return checkSchema(dae);
+			return for_each_dae([&](const Dae & dae, ostream & out, ostream & err) {
+				return checkSchema(dae, out, err);
 			});
 		}
 
@@ -126,7 +237,7 @@ namespace opencollada
 		schema.readFile(schema_uri);
 		if (schema)
 		{
-			return for_each_dae([&](const Dae & dae) {
+			return for_each_dae([&](const Dae & dae, ostream &, ostream &) {
 				return ValidateAgainstSchema(dae, schema);
 			});
 		}
@@ -135,9 +246,9 @@ namespace opencollada
 		return 1;
 	}
 
-	int DaeValidator::checkSchema(const Dae & dae) const
+	int DaeValidator::checkSchema(const Dae & dae, ostream & out, ostream & err) const
 	{
-		cout << "Checking schema..." << endl;
+		out << "Checking schema..." << endl;
 
 		int result = 0;
 
@@ -149,18 +260,20 @@ namespace opencollada
 		else if (version == Dae::Version::COLLADA15)
 		{
 			//result |= ValidateAgainstSchema(dae, Dae::GetColladaSchema15());
-			cerr << "COLLADA 1.5 not supported yet." << endl;
+			err << "COLLADA 1.5 not supported yet." << endl;
 			return 1;
 		}
 		else
 		{
-			cerr << "Can't determine COLLADA version used by input file" << endl;
+			err << "Can't determine COLLADA version used by input file" << endl;
 			return 1;
 		}
 
 		vector<XmlNode> subDocs;
 
 		// Find xsi:schemaLocation attributes in dae and try to validate against specified xsd documents
+		// namespace to xsd location, as declared by this document
+		map<string, string> schemaLocations;
 		const auto & elements = dae.root().selectNodes("//*[@xsi:schemaLocation]");
 		for (const auto & element : elements)
 		{
@@ -176,84 +289,78 @@ namespace opencollada
 					if (ns != Dae::GetColladaNamespace141() && ns != Dae::GetColladaNamespace15())
 					{
 						// "insert" does nothing if element already exists.
-						mSchemas.insert(pair<string, XmlSchema>(ns, XmlSchema()));
-						mSchemaLocations.insert(pair<string, string>(ns, xsdUri));
+						schemaLocations.insert(pair<string, string>(ns, xsdUri));
 					}
 				}
 			}
 		}
 
-		// Preload uninitialized .xsd files
-		auto itSchema = mSchemas.begin();
-		auto itSchemaLocation = mSchemaLocations.begin();
-		for (; itSchema != mSchemas.end(); ++itSchema, ++itSchemaLocation)
+		// Schemas are loaded once and shared by all documents, which may be processed in parallel.
+		// Loaded schemas are never removed, so they can be used after the lock is released.
+		vector<pair<const string*, const XmlSchema*>> schemas;
 		{
-			const auto & schemaUri = itSchemaLocation->second;
-			auto & schema = itSchema->second;
-
-			// Don't try to load schemas that already failed in a previous run
-			if (schema.failedToLoad())
+			lock_guard<mutex> lock(mSchemasMutex);
+			for (const auto & location : schemaLocations)
 			{
-				cout << "Error loading " << schemaUri << endl;
-				result |= 1;
-				continue;
-			}
+				const auto & ns = location.first;
+				auto itSchema = mSchemas.insert(pair<string, XmlSchema>(ns, XmlSchema())).first;
+				auto itSchemaLocation = mSchemaLocations.insert(location).first;
+				const auto & schemaUri = itSchemaLocation->second;
+				auto & schema = itSchema->second;
+
+				// Don't try to load schemas that already failed for a previous document
+				if (!schema && !schema.failedToLoad())
+				{
+					schema.readFile(schemaUri);
 
-			string uri = schemaUri;
+					if (!schema)
+					{
+						// Try to find schema document in executable directory
+						Uri xsdUri(schemaUri);
+						if (xsdUri.isValid())
+						{
+							schema.readFile(Path::Join(Path::GetExecutableDirectory(), xsdUri.pathFile()));
+						}
+					}
 
-			if (!schema)
-			{
-				schema.readFile(uri);
-			}
+					if (!schema)
+					{
+						// Try to find schema document in COLLADA document directory
+						Uri xsdUri(schemaUri);
+						string xsdFile = xsdUri.pathFile();
+						xsdUri = dae.getURI();
+						xsdUri.setPathFile(xsdFile);
+						schema.readFile(xsdUri.str());
+					}
+				}
 
-			if (!schema)
-			{
-				// Try to find schema document in executable directory
-				Uri xsdUri(schemaUri);
-				if (xsdUri.isValid())
+				if (schema)
 				{
-					uri = Path::Join(Path::GetExecutableDirectory(), xsdUri.pathFile());
-					schema.readFile(uri);
+					if (schema.getURI() != schemaUri)
+					{
+						out << "Using " << schema.getURI() << endl;
+					}
+					schemas.emplace_back(&itSchema->first, &schema);
+				}
+				else
+				{
+					out << "Error loading " << schemaUri << endl;
+					result |= 1;
 				}
-			}
-
-			if (!schema)
-			{
-				// Try to find schema document in COLLADA document directory
-				Uri xsdUri(schemaUri);
-				string xsdFile = xsdUri.pathFile();
-				xsdUri = dae.getURI();
-				xsdUri.setPathFile(xsdFile);
-				uri = xsdUri.str();
-				schema.readFile(uri);
-			}
-
-			if (schema && uri != schemaUri)
-			{
-				cout << "Using " << uri << endl;
-			}
-			else if (!schema)
-			{
-				cout << "Error loading " << schemaUri << endl;
-				result |= 1;
 			}
 		}
 
 		// Validate "sub documents"
-		for (const auto & schema : mSchemas)
+		for (const auto & schema : schemas)
 		{
-			// Ignore schemas that failed to load
-			if (!schema.second)
-				continue;
-
-			const auto & ns = schema.first;
+			const auto & ns = *schema.first;
 			stringstream xpath;
 			xpath << "//*[namespace-uri()='" << ns << "' and not(namespace-uri(./..)='" << ns << "')]";
 			const auto & nodes = dae.root().selectNodes(xpath.str());
 			for (auto node : nodes)
 			{
 				auto autoRestoreRoot = dae.setTempRoot(node);
-				result |= ValidateAgainstSchema(dae, schema.second);
+				result |= ValidateAgainstSchema(dae, *schema.second);
 			}
 		}
 
@@ -262,54 +369,35 @@ namespace opencollada
 
 	int DaeValidator::checkUniqueIds() const
 	{
-		return for_each_dae([&](const Dae & dae) {
-			return checkUniqueIds(dae);
+		return for_each_dae([&](const Dae & dae, ostream & out, ostream & err) {
+			return checkUniqueIds(dae, out, err);
 		});
 	}
 
-	int DaeValidator::checkUniqueIds(const Dae & dae) const
+	int DaeValidator::checkUniqueIds(const Dae & dae, ostream & out, ostream & err) const
 	{
-		cout << "Checking unique ids..." << endl;
+		out << "Checking unique ids..." << endl;
 
 		int result = 0;
 		map<string, size_t> ids;
 		const auto & nodes = dae.root().selectNodes("//*[@id]");
 		for (const auto & node : nodes)
 		{
-			string id = node.attribute("id").value();
-			size_t line = node.line();
-
-			int checkEscapeCharResult = CheckEscapeChar(id);
-			if (checkEscapeCharResult != 0)
-			{
-				cerr << dae.getURI() << ":" << line << ": \"" << id << "\" contains non-escaped characters." << endl;
-				result |= checkEscapeCharResult;
-			}
-
-			auto it = ids.find(id);
-			if (it != ids.end())
-			{
-				cerr << dae.getURI() << ":" << line << ": Duplicated id \"" << id << "\". See first declaration at line " << it->second << "." << endl;
-				result |= 1;
-			}
-			else
-			{
-				ids[id] = line;
-			}
+			result |= CheckId(dae.getURI(), node.attribute("id").value(), node.line(), ids, err);
 		}
 		return result;
 	}
 
 	int DaeValidator::checkUniqueSids() const
 	{
-		return for_each_dae([&](const Dae & dae) {
-			return checkUniqueSids(dae);
+		return for_each_dae([&](const Dae & dae, ostream & out, ostream & err) {
+			return checkUniqueSids(dae, out, err);
 		});
 	}
 
-	int DaeValidator::checkUniqueSids(const Dae & dae) const
+	int DaeValidator::checkUniqueSids(const Dae & dae, ostream & out, ostream & err) const
 	{
-		cout << "Checking unique sids..." << endl;
+		out << "Checking unique sids..." << endl;
 
 		int result = 0;
 		const auto & parents = dae.root().selectNodes("//*[@sid]/..");
@@ -319,19 +407,7 @@ namespace opencollada
 			map<string, size_t> sids;
 			for (auto child : children)
 			{
-				string sid = child.attribute("sid").value();
-				size_t line = child.line();
-
-				auto it = sids.find(sid);
-				if (it != sids.end())
-				{
-					cerr << dae.getURI() << ":" << line << ": Duplicated sid \"" << sid << "\". See first declaration at line " << it->second << "." << endl;
-					result |= 1;
-				}
-				else
-				{
-					sids[sid] = line;
-				}
+				result |= CheckSid(dae.getURI(), child.attribute("sid").value(), child.line(), sids, err);
 			}
 		}
 		return result;
@@ -339,25 +415,31 @@ namespace opencollada
 
 	int DaeValidator::checkLinks() const
 	{
-		return for_each_dae([&](const Dae & dae) {
-			return checkLinks(dae);
+		return for_each_dae([&](const Dae & dae, ostream & out, ostream & err) {
+			return checkLinks(dae, out, err);
 		});
 	}
 
-	int DaeValidator::checkLinks(const Dae & dae) const
+	int DaeValidator::checkLinks(const Dae & dae, ostream & out, ostream & err) const
 	{
-		cout << "Checking links..." << endl;
+		out << "Checking links..." << endl;
 
 		const auto & ids = dae.getIds();
+		return checkLinks(dae, dae.getLinks(), [&](const string & id) {
+			return ids.find(id) != ids.end();
+		}, err);
+	}
 
+	int DaeValidator::checkLinks(const Dae & dae, const Dae::Links & links, const IdLookup & hasId, ostream & err) const
+	{
 		int result = 0;
-		for (const auto & t : dae.getAnyURIs())
+		for (const auto & t : links.anyURIs)
 		{
 			const auto & line = get<0>(t);
 			const auto & uri = get<1>(t);
 			if (!Path::Exists(uri.nativePath()))
 			{
-				cerr << dae.getURI() << ":" << line << ": Can't resolve " << uri << endl;
+				err << dae.getURI() << ":" << line << ": Can't resolve " << uri << endl;
 				result |= 1;
 			}
 			else if (!uri.fragment().empty())
@@ -366,17 +448,16 @@ namespace opencollada
 				no_fragment_uri.setFragment("");
 				if (no_fragment_uri == dae.getURI())
 				{
-					auto id = ids.find(uri.fragment());
-					if (id == ids.end())
+					if (!hasId(uri.fragment()))
 					{
-						cerr << dae.getURI() << ":" << line << ": Can't resolve #" << uri.fragment() << endl;
+						err << dae.getURI() << ":" << line << ": Can't resolve #" << uri.fragment() << endl;
 						result |= 1;
 					}
 				}
 				else
 				{
-					auto it = dae.getExternalDAEs().find(no_fragment_uri);
-					if (it != dae.getExternalDAEs().end())
+					auto it = links.externalDAEs.find(no_fragment_uri);
+					if (it != links.externalDAEs.end())
 					{
 						if (it->second)
 						{
@@ -384,13 +465,13 @@ namespace opencollada
 							auto id = ext_ids.find(uri.fragment());
 							if (id == ext_ids.end())
 							{
-								cerr << dae.getURI() << ":" << line << ": Can't resolve " << uri << endl;
+								err << dae.getURI() << ":" << line << ": Can't resolve " << uri << endl;
 								result |= 1;
 							}
 						}
 						else
 						{
-							cerr << dae.getURI() << ":" << line << ": " << uri << ": referenced file exists but has not been successfully loaded." << endl;
+							err << dae.getURI() << ":" << line << ": " << uri << ": referenced file exists but has not been successfully loaded." << endl;
 							result |= 1;
 						}
 					}
@@ -399,15 +480,14 @@ namespace opencollada
 		}
 
 		// IDREF
-		for (const auto & IDREF : dae.getIDREFs())
+		for (const auto & IDREF : links.IDREFs)
 		{
 			const auto & line = get<0>(IDREF);
 			const auto & idref = get<1>(IDREF);
 
-			auto id = ids.find(idref);
-			if (id == ids.end())
+			if (!hasId(idref))
 			{
-				cerr << dae.getURI() << ":" << line << ": Can't resolve #" << idref << endl;
+				err << dae.getURI() << ":" << line << ": Can't resolve #" << idref << endl;
 				result |= 1;
 			}
 		}
@@ -415,6 +495,94 @@ namespace opencollada
 		return result;
 	}
 
+	int DaeValidator::checkStreaming() const
+	{
+		return for_each_path([&](const string & daePath, ostream & out, ostream & err) {
+			out << "Checking unique ids, unique sids and links..." << endl;
+			return DaeStreamChecker::Check(daePath, err);
+		});
+	}
+
+	int DaeValidator::checkIdsSidsAndLinks(const Dae & dae, ostream & out, ostream & err) const
+	{
+		// Errors are collected per check, to be written in the same order as by the separate checks
+		stringstream idErrors;
+		stringstream sidErrors;
+		map<string, size_t> ids;
+		Dae::Links links;
+		int result = 0;
+
+		// Depth first traversal in document order, as the XPath queries of the separate checks
+		vector<XmlNode> nodes;
+		if (auto root = dae.root())
+			nodes.push_back(root);
+		while (!nodes.empty())
+		{
+			XmlNode node = nodes.back();
+			nodes.pop_back();
+
+			if (auto id = node.attribute("id"))
+				result |= CheckId(dae.getURI(), id.value(), node.line(), ids, idErrors);
+			dae.collectLinks(node, links);
+
+			map<string, size_t> sids;
+			size_t firstChild = nodes.size();
+			node.for_each_child([&](const XmlNode & child) {
+				if (auto sid = child.attribute("sid"))
+					result |= CheckSid(dae.getURI(), sid.value(), child.line(), sids, sidErrors);
+				nodes.push_back(child);
+			});
+			reverse(nodes.begin() + static_cast<ptrdiff_t>(firstChild), nodes.end());
+		}
+
+		out << "Checking unique ids..." << endl;
+		err << idErrors.str();
+
+		out << "Checking unique sids..." << endl;
+		err << sidErrors.str();
+
+		out << "Checking links..." << endl;
+		Dae::ReadExternalDAEs(links);
+		result |= checkLinks(dae, links, [&](const string & id) {
+			return ids.find(id) != ids.end();
+		}, err);
+
+		return result;
+	}
+
+	int DaeValidator::CheckId(const Uri & uri, const string & id, size_t line, map<string, size_t> & ids, ostream & err)
+	{
+		int result = CheckEscapeChar(id);
+		if (result != 0)
+		{
+			err << uri << ":" << line << ": \"" << id << "\" contains non-escaped characters." << endl;
+		}
+
+		auto it = ids.find(id);
+		if (it != ids.end())
+		{
+			err << uri << ":" << line << ": Duplicated id \"" << id << "\". See first declaration at line " << it->second << "." << endl;
+			result |= 1;
+		}
+		else
+		{
+			ids[id] = line;
+		}
+		return result;
+	}
+
+	int DaeValidator::CheckSid(const Uri & uri, const string & sid, size_t line, map<string, size_t> & sids, ostream & err)
+	{
+		auto it = sids.find(sid);
+		if (it != sids.end())
+		{
+			err << uri << ":" << line << ": Duplicated sid \"" << sid << "\". See first declaration at line " << it->second << "." << endl;
+			return 1;
+		}
+		sids[sid] = line;
+		return 0;
+	}
+
 	int DaeValidator::ValidateAgainstSchema(const Dae & dae, const XmlSchema & schema)
 	{
 		return schema.validate(dae) ? 0 : 1;
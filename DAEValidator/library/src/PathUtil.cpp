@@ -1,6 +1,8 @@
 #include "PathUtil.h"
 #include "StringUtil.h"
 
+#include "GeneratedSaxParserZipArchive.h"
+
 #if defined(_WIN32)
 #include <direct.h>
 #define getcwd _getcwd
@@ -55,7 +57,13 @@ namespace opencollada
 	bool Path::Exists(const string & path)
 	{
 		struct stat st;
-		return stat(path.c_str(), &st) == 0;
+		if (stat(path.c_str(), &st) == 0)
+			return true;
+
+		// Member of a .zae archive
+		GeneratedSaxParser::ZipArchive archive;
+		string memberName;
+		return archive.openDocument(path, memberName);
 	}
 
 	string Path::GetExecutablePath()
@@ -132,7 +140,9 @@ namespace opencollada
 					{
 						dirs.push_back(Path::Join(dirs.front(), ent->d_name));
 					}
-					else if (String::EndsWith(String::Lower(ent->d_name), ".dae"))
+					else if (String::EndsWith(String::Lower(ent->d_name), ".dae") ||
+						String::EndsWith(String::Lower(ent->d_name), ".dae.gz") ||
+						String::EndsWith(String::Lower(ent->d_name), ".zae"))
 					{
 						daes.push_back(Path::Join(dirs.front(), ent->d_name));
 					}
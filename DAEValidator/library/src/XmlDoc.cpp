@@ -1,23 +1,52 @@
 #include "Macros.h"
 
-#if IS_GNUC_AND_GNUC_VERSION_LT(5,1,1)
-#include <cstring>
-#endif
-
 #include "XmlDoc.h"
 #include "XmlNode.h"
 #include "XmlNamespace.h"
 
+#include "GeneratedSaxParserBackgroundInflater.h"
+#include "GeneratedSaxParserZipArchive.h"
+
 #include "no_warning_fstream"
 #include "no_warning_vector"
+#include <limits>
 #include <sys/stat.h>
 
 using namespace std;
 
-#include "zlib.h"
-
 namespace opencollada
 {
+	namespace
+	{
+		// Parses compressed data while it is inflated on another thread, so the decompressed document never is in memory completely.
+		xmlDocPtr ReadCompressedMemory(const char* data, size_t size, GeneratedSaxParser::BackgroundInflater::Format format, const string & url)
+		{
+			xmlParserCtxtPtr ctxt = xmlCreatePushParserCtxt(nullptr, nullptr, nullptr, 0, url.c_str());
+			if (!ctxt)
+				return nullptr;
+			// same options as xmlReadMemory(), which also makes the nodes store their line numbers
+			xmlCtxtUseOptions(ctxt, 0);
+
+			GeneratedSaxParser::BackgroundInflater inflater(data, size, format);
+			const char* chunk = nullptr;
+			size_t chunkLength = 0;
+			while (!ctxt->disableSAX && (chunkLength = inflater.readChunk(chunk)) > 0)
+				xmlParseChunk(ctxt, chunk, static_cast<int>(chunkLength), 0);
+			xmlParseChunk(ctxt, nullptr, 0, 1);
+
+			xmlDocPtr doc = ctxt->myDoc;
+			bool wellFormed = ctxt->wellFormed != 0;
+			xmlFreeParserCtxt(ctxt);
+
+			if (!wellFormed || inflater.hasFailed())
+			{
+				xmlFreeDoc(doc);
+				return nullptr;
+			}
+			return doc;
+		}
+	}
+
 	XmlDoc::XmlDoc(XmlDoc && other)
 	{
 		*this = move(other);
@@ -31,6 +60,7 @@ namespace opencollada
 	const XmlDoc & XmlDoc::operator = (XmlDoc && other)
 	{
 		swap(mDoc, other.mDoc);
+		swap(mPath, other.mPath);
 		return *this;
 	}
 
@@ -38,6 +68,28 @@ namespace opencollada
 	{
 		reset();
 
+		mPath = path;
+
+		GeneratedSaxParser::ZipArchive archive;
+		string memberName;
+		if (archive.openDocument(path, memberName))
+		{
+			mPath = archive.getFileName() + "/" + memberName;
+			const GeneratedSaxParser::ZipArchive::Entry* entry = archive.findEntry(memberName);
+			const char* data = archive.getEntryData(*entry);
+			if (!data)
+				return;
+
+			if (entry->compressionMethod == GeneratedSaxParser::ZipArchive::METHOD_DEFLATED)
+				mDoc = ReadCompressedMemory(data, entry->compressedSize, GeneratedSaxParser::BackgroundInflater::FORMAT_DEFLATE, mPath);
+			else if (entry->compressionMethod == GeneratedSaxParser::ZipArchive::METHOD_STORED && entry->compressedSize <= static_cast<size_t>(numeric_limits<int>::max()))
+				mDoc = xmlReadMemory(data, static_cast<int>(entry->compressedSize), mPath.c_str(), NULL, 0);
+
+			if (mDoc)
+				mDoc->_private = this;
+			return;
+		}
+
 		ifstream ifile(path, ios_base::binary);
 
 		if (!ifile.is_open()) return;
@@ -67,33 +119,18 @@ namespace opencollada
 		// Compressed document (gzip only)
 		else
 		{
-			vector<char> decompressed_content(*reinterpret_cast<const uint32_t*>(content.data() + content.size() - 4));
-#if IS_GNUC_AND_GNUC_VERSION_LT(5,1,1)
-			z_stream zInfo;
-			memset(&zInfo, 0, sizeof(zInfo));
-#else
-			z_stream zInfo {};
-#endif
-			zInfo.total_in = zInfo.avail_in = static_cast<uInt>(content.size());
-			zInfo.total_out = zInfo.avail_out = static_cast<uInt>(decompressed_content.size());
-			zInfo.next_in = reinterpret_cast<Bytef*>(content.data());
-			zInfo.next_out = reinterpret_cast<Bytef*>(decompressed_content.data());
-
-			int nErr = inflateInit2(&zInfo, 16 + MAX_WBITS);
-			if (nErr == Z_OK)
-			{
-				nErr = inflate(&zInfo, Z_FINISH);
-			}
-			inflateEnd(&zInfo);
-
-			if (nErr == Z_STREAM_END)
-				mDoc = xmlReadMemory(decompressed_content.data(), static_cast<int>(decompressed_content.size()), path.c_str(), NULL, 0);
+			mDoc = ReadCompressedMemory(content.data(), content.size(), GeneratedSaxParser::BackgroundInflater::FORMAT_GZIP, path);
 		}
 
 		if (mDoc)
 			mDoc->_private = this;
 	}
 
+	const string & XmlDoc::getPath() const
+	{
+		return mPath;
+	}
+
 	XmlDoc::operator bool() const
 	{
 		return mDoc != nullptr;
@@ -54,6 +54,12 @@ namespace opencollada
 		return XmlNode(mNode->children->next);
 	}
 
+	XmlNode XmlNode::parent() const
+	{
+		xmlNodePtr parent = mNode->parent;
+		return XmlNode(parent && parent->type == XML_ELEMENT_NODE ? parent : nullptr);
+	}
+
 	string XmlNode::text() const
 	{
 		for (xmlNodePtr node = mNode->children; node; node = node->next)
@@ -136,6 +142,17 @@ namespace opencollada
 			fn(XmlAttribute(attr));
 		}
 	}
+
+	void XmlNode::for_each_child(const function<void(const XmlNode &)> & fn) const
+	{
+		for (xmlNodePtr node = mNode->children; node; node = node->next)
+		{
+			if (node->type == XML_ELEMENT_NODE)
+			{
+				fn(XmlNode(node));
+			}
+		}
+	}
 }
 
 bool operator == (const string & s, const unsigned char* c)
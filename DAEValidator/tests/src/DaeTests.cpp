@@ -129,5 +129,28 @@ namespace opencollada_test
 			dae.readFile(data_path("dae/ReadFileTest_1.4.dae"));
 			Assert::AreEqual(dae.getIDREFs().size(), static_cast<size_t>(1));
 		}
+
+		TEST_METHOD(CollectLinks)
+		{
+			Dae dae;
+			dae.readFile(data_path("dae/ReadFileTest_1.4.dae"));
+
+			// Collecting the links of every node gives the links found by getLinks()
+			Dae::Links links;
+			vector<XmlNode> nodes;
+			nodes.push_back(dae.root());
+			while (!nodes.empty())
+			{
+				XmlNode node = nodes.back();
+				nodes.pop_back();
+				dae.collectLinks(node, links);
+				node.for_each_child([&](const XmlNode & child) {
+					nodes.push_back(child);
+				});
+			}
+			Assert::AreEqual(links.anyURIs.size(), dae.getAnyURIs().size());
+			Assert::AreEqual(links.IDREFs.size(), dae.getIDREFs().size());
+			Assert::AreEqual(links.externalDAEs.size(), dae.getExternalDAEs().size());
+		}
 	};
 }
\ No newline at end of file
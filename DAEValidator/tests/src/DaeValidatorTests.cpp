@@ -24,6 +24,30 @@ namespace opencollada_test
 			Assert::AreEqual(0, v.checkAll());
 		}
 
+		TEST_METHOD(CheckAllThreads)
+		{
+			{
+				list<string> daes{
+					Path::GetAbsolutePath(data_path("daevalidator/file.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/unique_ids_ok.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/unique_sids_ok.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/links_ok.dae"))
+				};
+				DaeValidator v(daes, 4);
+				Assert::AreEqual(0, v.checkAll());
+			}
+			{
+				list<string> daes{
+					Path::GetAbsolutePath(data_path("daevalidator/file.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/unique_ids_error.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/unique_sids_error.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/links_error.dae"))
+				};
+				DaeValidator v(daes, 0);
+				Assert::AreNotEqual(0, v.checkAll());
+			}
+		}
+
 		TEST_METHOD(CheckSchema)
 		{
 			{
@@ -105,5 +129,33 @@ namespace opencollada_test
 				Assert::AreNotEqual(0, v.checkLinks());
 			}
 		}
+
+		TEST_METHOD(CheckStreaming)
+		{
+			{
+				list<string> daes{
+					Path::GetAbsolutePath(data_path("daevalidator/unique_ids_ok.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/unique_sids_ok.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/links_ok.dae"))
+				};
+				DaeValidator v(daes);
+				Assert::AreEqual(0, v.checkStreaming());
+			}
+			{
+				list<string> daes{ Path::GetAbsolutePath(data_path("daevalidator/unique_ids_error.dae")) };
+				DaeValidator v(daes);
+				Assert::AreNotEqual(0, v.checkStreaming());
+			}
+			{
+				list<string> daes{ Path::GetAbsolutePath(data_path("daevalidator/unique_sids_error.dae")) };
+				DaeValidator v(daes);
+				Assert::AreNotEqual(0, v.checkStreaming());
+			}
+			{
+				list<string> daes{ Path::GetAbsolutePath(data_path("daevalidator/links_error.dae")) };
+				DaeValidator v(daes);
+				Assert::AreNotEqual(0, v.checkStreaming());
+			}
+		}
 	};
 }
\ No newline at end of file
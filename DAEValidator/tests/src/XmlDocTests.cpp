@@ -92,6 +92,23 @@ namespace opencollada_test
 				Assert::IsFalse(doc);
 				doc.readFile(data_path("xml/compressed_file.dae"));
 				Assert::IsTrue(doc);
+				// errors report the lines of the nodes
+				const auto & nodes = doc.root().selectNodes("//collada:asset");
+				Assert::AreEqual(static_cast<size_t>(1), nodes.size());
+				Assert::AreEqual(static_cast<size_t>(3), nodes[0].line());
+			}
+			{
+				XmlDoc doc;
+				doc.readFile(data_path("xml/archive.zae"));
+				Assert::IsTrue(doc);
+				Assert::AreEqual(data_path("xml/archive.zae") + "/models/file.dae", doc.getPath());
+				const auto & nodes = doc.root().selectNodes("//collada:asset");
+				Assert::AreEqual(static_cast<size_t>(1), nodes.size());
+				Assert::AreEqual(static_cast<size_t>(3), nodes[0].line());
+				doc.readFile(data_path("xml/archive.zae") + "/models/file.dae");
+				Assert::IsTrue(doc);
+				doc.readFile(data_path("xml/archive.zae") + "/models/missing.dae");
+				Assert::IsFalse(doc);
 			}
 		}
 
@@ -99,6 +99,17 @@ namespace opencollada_test
 			Assert::IsFalse(first_child);
 		}
 
+		TEST_METHOD(Parent)
+		{
+			XmlDoc doc;
+			doc.readFile(data_path("xml/file.dae"));
+			XmlNode root = doc.root();
+			Assert::IsFalse(root.parent());
+
+			XmlNode asset = root.child("asset");
+			Assert::IsTrue(asset.parent() == root);
+		}
+
 		TEST_METHOD(Text)
 		{
 			XmlDoc doc;
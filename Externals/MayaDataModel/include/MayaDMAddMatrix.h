@@ -27,47 +27,47 @@ public:
 	void setMatrixIn(size_t i_i,const matrix& i_)
 	{
 		if(i_ == identity) return;
-		fprintf(mFile,"\tsetAttr \".i[%i]\" -type \"matrix\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"]\" -type \"matrix\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMatrixIn(size_t i_start,size_t i_end,matrix* i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\" ");
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			i_[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startMatrixIn(size_t i_start,size_t i_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\"",i_start,i_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendMatrixIn(const matrix& i)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		i.write(mFile);
 	}
 	void endMatrixIn()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getMatrixIn(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getMatrixIn()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getMatrixSum()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	AddMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
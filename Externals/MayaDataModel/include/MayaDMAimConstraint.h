@@ -26,14 +26,14 @@ public:
 		void write(FILE* file) const
 		{
 			targetTranslate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetRotatePivot.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetRotateTranslate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", targetWeight);
+			writeString(file," ");
+			writeFloat(file,"",targetWeight);
 		}
 	};
 public:
@@ -45,661 +45,661 @@ public:
 
 	void setTarget(size_t tg_i,const Target& tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i]\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"]\" ");
 		tg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTarget(size_t tg_start,size_t tg_end,Target* tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\" ", tg_start,tg_end);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\" ");
 		size_t size = (tg_end-tg_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			tg[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTarget(size_t tg_start,size_t tg_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\"",tg_start,tg_end);
-		fprintf(mFile," -type \"Target\" ");
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\"");
+		writeString(mFile," -type \"Target\" ");
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		tg.write(mFile);
 	}
 	void endTarget()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetTranslate(size_t tg_i,const double3& tt)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tt\" -type \"double3\" ");
 		tt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetTranslateX(size_t tg_i,double ttx)
 	{
 		if(ttx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.ttx\" %f;\n", tg_i,ttx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.ttx\" ",ttx,";\n");
 	}
 	void setTargetTranslateY(size_t tg_i,double tty)
 	{
 		if(tty == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.tty\" %f;\n", tg_i,tty);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.tty\" ",tty,";\n");
 	}
 	void setTargetTranslateZ(size_t tg_i,double ttz)
 	{
 		if(ttz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.ttz\" %f;\n", tg_i,ttz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.ttz\" ",ttz,";\n");
 	}
 	void setTargetRotatePivot(size_t tg_i,const double3& trp)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].trp\" -type \"double3\" ");
 		trp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotatePivotX(size_t tg_i,double trpx)
 	{
 		if(trpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpx\" %f;\n", tg_i,trpx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpx\" ",trpx,";\n");
 	}
 	void setTargetRotatePivotY(size_t tg_i,double trpy)
 	{
 		if(trpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpy\" %f;\n", tg_i,trpy);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpy\" ",trpy,";\n");
 	}
 	void setTargetRotatePivotZ(size_t tg_i,double trpz)
 	{
 		if(trpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpz\" %f;\n", tg_i,trpz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpz\" ",trpz,";\n");
 	}
 	void setTargetRotateTranslate(size_t tg_i,const double3& trt)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].trt\" -type \"double3\" ");
 		trt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotateTranslateX(size_t tg_i,double trtx)
 	{
 		if(trtx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trtx\" %f;\n", tg_i,trtx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trtx\" ",trtx,";\n");
 	}
 	void setTargetRotateTranslateY(size_t tg_i,double trty)
 	{
 		if(trty == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trty\" %f;\n", tg_i,trty);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trty\" ",trty,";\n");
 	}
 	void setTargetRotateTranslateZ(size_t tg_i,double trtz)
 	{
 		if(trtz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trtz\" %f;\n", tg_i,trtz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trtz\" ",trtz,";\n");
 	}
 	void setTargetParentMatrix(size_t tg_i,const matrix& tpm)
 	{
 		if(tpm == identity) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tpm\" -type \"matrix\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tpm\" -type \"matrix\" ");
 		tpm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetWeight(size_t tg_i,double tw)
 	{
 		if(tw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tw\" %f;\n", tg_i,tw);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tw\" ",tw,";\n");
 	}
 	void setConstraintParentInverseMatrix(const matrix& cpim)
 	{
 		if(cpim == identity) return;
-		fprintf(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
 		cpim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAimVector(const double3& a)
 	{
 		if(a == double3(1.0,0.0,0.0)) return;
-		fprintf(mFile,"\tsetAttr \".a\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".a\" -type \"double3\" ");
 		a.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAimVectorX(double ax)
 	{
 		if(ax == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".a.ax\" %f;\n", ax);
+		writeFloat(mFile,"\tsetAttr \".a.ax\" ",ax,";\n");
 	}
 	void setAimVectorY(double ay)
 	{
 		if(ay == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".a.ay\" %f;\n", ay);
+		writeFloat(mFile,"\tsetAttr \".a.ay\" ",ay,";\n");
 	}
 	void setAimVectorZ(double az)
 	{
 		if(az == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".a.az\" %f;\n", az);
+		writeFloat(mFile,"\tsetAttr \".a.az\" ",az,";\n");
 	}
 	void setUpVector(const double3& u)
 	{
 		if(u == double3(0.0,1.0,0.0)) return;
-		fprintf(mFile,"\tsetAttr \".u\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".u\" -type \"double3\" ");
 		u.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUpVectorX(double ux)
 	{
 		if(ux == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".u.ux\" %f;\n", ux);
+		writeFloat(mFile,"\tsetAttr \".u.ux\" ",ux,";\n");
 	}
 	void setUpVectorY(double uy)
 	{
 		if(uy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".u.uy\" %f;\n", uy);
+		writeFloat(mFile,"\tsetAttr \".u.uy\" ",uy,";\n");
 	}
 	void setUpVectorZ(double uz)
 	{
 		if(uz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".u.uz\" %f;\n", uz);
+		writeFloat(mFile,"\tsetAttr \".u.uz\" ",uz,";\n");
 	}
 	void setWorldUpVector(const double3& wu)
 	{
 		if(wu == double3(0.0,1.0,0.0)) return;
-		fprintf(mFile,"\tsetAttr \".wu\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".wu\" -type \"double3\" ");
 		wu.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWorldUpVectorX(double wux)
 	{
 		if(wux == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wu.wux\" %f;\n", wux);
+		writeFloat(mFile,"\tsetAttr \".wu.wux\" ",wux,";\n");
 	}
 	void setWorldUpVectorY(double wuy)
 	{
 		if(wuy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wu.wuy\" %f;\n", wuy);
+		writeFloat(mFile,"\tsetAttr \".wu.wuy\" ",wuy,";\n");
 	}
 	void setWorldUpVectorZ(double wuz)
 	{
 		if(wuz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wu.wuz\" %f;\n", wuz);
+		writeFloat(mFile,"\tsetAttr \".wu.wuz\" ",wuz,";\n");
 	}
 	void setWorldUpMatrix(const matrix& wum)
 	{
 		if(wum == identity) return;
-		fprintf(mFile,"\tsetAttr \".wum\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".wum\" -type \"matrix\" ");
 		wum.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWorldUpType(unsigned int wut)
 	{
 		if(wut == 3) return;
-		fprintf(mFile,"\tsetAttr \".wut\" %i;\n", wut);
+		writeInt(mFile,"\tsetAttr \".wut\" ",wut,";\n");
 	}
 	void setConstraintTranslate(const double3& ct)
 	{
-		fprintf(mFile,"\tsetAttr \".ct\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ct\" -type \"double3\" ");
 		ct.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintTranslateX(double ctx)
 	{
 		if(ctx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ct.ctx\" %f;\n", ctx);
+		writeFloat(mFile,"\tsetAttr \".ct.ctx\" ",ctx,";\n");
 	}
 	void setConstraintTranslateY(double cty)
 	{
 		if(cty == 0) return;
-		fprintf(mFile,"\tsetAttr \".ct.cty\" %f;\n", cty);
+		writeFloat(mFile,"\tsetAttr \".ct.cty\" ",cty,";\n");
 	}
 	void setConstraintTranslateZ(double ctz)
 	{
 		if(ctz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ct.ctz\" %f;\n", ctz);
+		writeFloat(mFile,"\tsetAttr \".ct.ctz\" ",ctz,";\n");
 	}
 	void setConstraintRotatePivot(const double3& crp)
 	{
-		fprintf(mFile,"\tsetAttr \".crp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".crp\" -type \"double3\" ");
 		crp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotatePivotX(double crpx)
 	{
 		if(crpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpx\" %f;\n", crpx);
+		writeFloat(mFile,"\tsetAttr \".crp.crpx\" ",crpx,";\n");
 	}
 	void setConstraintRotatePivotY(double crpy)
 	{
 		if(crpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpy\" %f;\n", crpy);
+		writeFloat(mFile,"\tsetAttr \".crp.crpy\" ",crpy,";\n");
 	}
 	void setConstraintRotatePivotZ(double crpz)
 	{
 		if(crpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpz\" %f;\n", crpz);
+		writeFloat(mFile,"\tsetAttr \".crp.crpz\" ",crpz,";\n");
 	}
 	void setConstraintRotateTranslate(const double3& crt)
 	{
-		fprintf(mFile,"\tsetAttr \".crt\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".crt\" -type \"double3\" ");
 		crt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotateTranslateX(double crtx)
 	{
 		if(crtx == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crtx\" %f;\n", crtx);
+		writeFloat(mFile,"\tsetAttr \".crt.crtx\" ",crtx,";\n");
 	}
 	void setConstraintRotateTranslateY(double crty)
 	{
 		if(crty == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crty\" %f;\n", crty);
+		writeFloat(mFile,"\tsetAttr \".crt.crty\" ",crty,";\n");
 	}
 	void setConstraintRotateTranslateZ(double crtz)
 	{
 		if(crtz == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crtz\" %f;\n", crtz);
+		writeFloat(mFile,"\tsetAttr \".crt.crtz\" ",crtz,";\n");
 	}
 	void setConstraintRotateOrder(unsigned int cro)
 	{
 		if(cro == 0) return;
-		fprintf(mFile,"\tsetAttr \".cro\" %i;\n", cro);
+		writeInt(mFile,"\tsetAttr \".cro\" ",cro,";\n");
 	}
 	void setConstraintJointOrient(const double3& cjo)
 	{
-		fprintf(mFile,"\tsetAttr \".cjo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".cjo\" -type \"double3\" ");
 		cjo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintJointOrientX(double cjox)
 	{
 		if(cjox == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjox\" %f;\n", cjox);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjox\" ",cjox,";\n");
 	}
 	void setConstraintJointOrientY(double cjoy)
 	{
 		if(cjoy == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjoy\" %f;\n", cjoy);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjoy\" ",cjoy,";\n");
 	}
 	void setConstraintJointOrientZ(double cjoz)
 	{
 		if(cjoz == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjoz\" %f;\n", cjoz);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjoz\" ",cjoz,";\n");
 	}
 	void setOffset(const double3& o)
 	{
-		fprintf(mFile,"\tsetAttr \".o\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".o\" -type \"double3\" ");
 		o.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetX(double ox)
 	{
 		if(ox == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.ox\" %f;\n", ox);
+		writeFloat(mFile,"\tsetAttr \".o.ox\" ",ox,";\n");
 	}
 	void setOffsetY(double oy)
 	{
 		if(oy == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.oy\" %f;\n", oy);
+		writeFloat(mFile,"\tsetAttr \".o.oy\" ",oy,";\n");
 	}
 	void setOffsetZ(double oz)
 	{
 		if(oz == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.oz\" %f;\n", oz);
+		writeFloat(mFile,"\tsetAttr \".o.oz\" ",oz,";\n");
 	}
 	void setRestRotate(const double3& rsrr)
 	{
-		fprintf(mFile,"\tsetAttr \".rsrr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rsrr\" -type \"double3\" ");
 		rsrr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRestRotateX(double rrx)
 	{
 		if(rrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rrx\" %f;\n", rrx);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rrx\" ",rrx,";\n");
 	}
 	void setRestRotateY(double rry)
 	{
 		if(rry == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rry\" %f;\n", rry);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rry\" ",rry,";\n");
 	}
 	void setRestRotateZ(double rrz)
 	{
 		if(rrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rrz\" %f;\n", rrz);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rrz\" ",rrz,";\n");
 	}
 	void setUseOldOffsetCalculation(bool uooc)
 	{
 		if(uooc == false) return;
-		fprintf(mFile,"\tsetAttr \".uooc\" %i;\n", uooc);
+		writeInt(mFile,"\tsetAttr \".uooc\" ",uooc,";\n");
 	}
 	void getTarget(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i]\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"]\"");
 	}
 	void getTarget()const
 	{
 
-		fprintf(mFile,"\"%s.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg\"");
 	}
 	void getTargetTranslate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt\"");
 	}
 	void getTargetTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt\"");
 	}
 	void getTargetTranslateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.ttx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.ttx\"");
 	}
 	void getTargetTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.ttx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.ttx\"");
 	}
 	void getTargetTranslateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.tty\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.tty\"");
 	}
 	void getTargetTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.tty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.tty\"");
 	}
 	void getTargetTranslateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.ttz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.ttz\"");
 	}
 	void getTargetTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.ttz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.ttz\"");
 	}
 	void getTargetRotatePivot(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp\"");
 	}
 	void getTargetRotatePivot()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp\"");
 	}
 	void getTargetRotatePivotX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpx\"");
 	}
 	void getTargetRotatePivotX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpx\"");
 	}
 	void getTargetRotatePivotY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpy\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpy\"");
 	}
 	void getTargetRotatePivotY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpy\"");
 	}
 	void getTargetRotatePivotZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpz\"");
 	}
 	void getTargetRotatePivotZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpz\"");
 	}
 	void getTargetRotateTranslate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt\"");
 	}
 	void getTargetRotateTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt\"");
 	}
 	void getTargetRotateTranslateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trtx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trtx\"");
 	}
 	void getTargetRotateTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trtx\"");
 	}
 	void getTargetRotateTranslateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trty\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trty\"");
 	}
 	void getTargetRotateTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trty\"");
 	}
 	void getTargetRotateTranslateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trtz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trtz\"");
 	}
 	void getTargetRotateTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trtz\"");
 	}
 	void getTargetParentMatrix(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tpm\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tpm\"");
 	}
 	void getTargetParentMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tpm\"");
 	}
 	void getTargetWeight(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tw\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tw\"");
 	}
 	void getTargetWeight()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tw\"");
 	}
 	void getConstraintParentInverseMatrix()const
 	{
-		fprintf(mFile,"\"%s.cpim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpim\"");
 	}
 	void getAimVector()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getAimVectorX()const
 	{
-		fprintf(mFile,"\"%s.a.ax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a.ax\"");
 	}
 	void getAimVectorY()const
 	{
-		fprintf(mFile,"\"%s.a.ay\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a.ay\"");
 	}
 	void getAimVectorZ()const
 	{
-		fprintf(mFile,"\"%s.a.az\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a.az\"");
 	}
 	void getUpVector()const
 	{
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getUpVectorX()const
 	{
-		fprintf(mFile,"\"%s.u.ux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u.ux\"");
 	}
 	void getUpVectorY()const
 	{
-		fprintf(mFile,"\"%s.u.uy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u.uy\"");
 	}
 	void getUpVectorZ()const
 	{
-		fprintf(mFile,"\"%s.u.uz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u.uz\"");
 	}
 	void getWorldUpVector()const
 	{
-		fprintf(mFile,"\"%s.wu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu\"");
 	}
 	void getWorldUpVectorX()const
 	{
-		fprintf(mFile,"\"%s.wu.wux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu.wux\"");
 	}
 	void getWorldUpVectorY()const
 	{
-		fprintf(mFile,"\"%s.wu.wuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu.wuy\"");
 	}
 	void getWorldUpVectorZ()const
 	{
-		fprintf(mFile,"\"%s.wu.wuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu.wuz\"");
 	}
 	void getWorldUpMatrix()const
 	{
-		fprintf(mFile,"\"%s.wum\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wum\"");
 	}
 	void getWorldUpType()const
 	{
-		fprintf(mFile,"\"%s.wut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wut\"");
 	}
 	void getConstraintTranslate()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getConstraintTranslateX()const
 	{
-		fprintf(mFile,"\"%s.ct.ctx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctx\"");
 	}
 	void getConstraintTranslateY()const
 	{
-		fprintf(mFile,"\"%s.ct.cty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.cty\"");
 	}
 	void getConstraintTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.ct.ctz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctz\"");
 	}
 	void getConstraintRotatePivot()const
 	{
-		fprintf(mFile,"\"%s.crp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp\"");
 	}
 	void getConstraintRotatePivotX()const
 	{
-		fprintf(mFile,"\"%s.crp.crpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpx\"");
 	}
 	void getConstraintRotatePivotY()const
 	{
-		fprintf(mFile,"\"%s.crp.crpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpy\"");
 	}
 	void getConstraintRotatePivotZ()const
 	{
-		fprintf(mFile,"\"%s.crp.crpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpz\"");
 	}
 	void getConstraintRotateTranslate()const
 	{
-		fprintf(mFile,"\"%s.crt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt\"");
 	}
 	void getConstraintRotateTranslateX()const
 	{
-		fprintf(mFile,"\"%s.crt.crtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crtx\"");
 	}
 	void getConstraintRotateTranslateY()const
 	{
-		fprintf(mFile,"\"%s.crt.crty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crty\"");
 	}
 	void getConstraintRotateTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.crt.crtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crtz\"");
 	}
 	void getConstraintRotateOrder()const
 	{
-		fprintf(mFile,"\"%s.cro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cro\"");
 	}
 	void getConstraintJointOrient()const
 	{
-		fprintf(mFile,"\"%s.cjo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo\"");
 	}
 	void getConstraintJointOrientX()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjox\"");
 	}
 	void getConstraintJointOrientY()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjoy\"");
 	}
 	void getConstraintJointOrientZ()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjoz\"");
 	}
 	void getConstraintRotate()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getConstraintRotateX()const
 	{
-		fprintf(mFile,"\"%s.cr.crx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crx\"");
 	}
 	void getConstraintRotateY()const
 	{
-		fprintf(mFile,"\"%s.cr.cry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.cry\"");
 	}
 	void getConstraintRotateZ()const
 	{
-		fprintf(mFile,"\"%s.cr.crz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crz\"");
 	}
 	void getConstraintVector()const
 	{
-		fprintf(mFile,"\"%s.cv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv\"");
 	}
 	void getConstraintVectorX()const
 	{
-		fprintf(mFile,"\"%s.cv.cvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv.cvx\"");
 	}
 	void getConstraintVectorY()const
 	{
-		fprintf(mFile,"\"%s.cv.cvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv.cvy\"");
 	}
 	void getConstraintVectorZ()const
 	{
-		fprintf(mFile,"\"%s.cv.cvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv.cvz\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOffsetX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOffsetY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 	void getRestRotate()const
 	{
-		fprintf(mFile,"\"%s.rsrr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr\"");
 	}
 	void getRestRotateX()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rrx\"");
 	}
 	void getRestRotateY()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rry\"");
 	}
 	void getRestRotateZ()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rrz\"");
 	}
 	void getUseOldOffsetCalculation()const
 	{
-		fprintf(mFile,"\"%s.uooc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uooc\"");
 	}
 protected:
 	AimConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		double directionZ;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", directionX);
-			fprintf(file,"%f ", directionY);
-			fprintf(file,"%f", directionZ);
+			writeFloat(file,"",directionX," ");
+			writeFloat(file,"",directionY," ");
+			writeFloat(file,"",directionZ);
 		}
 	};
 public:
@@ -37,94 +37,94 @@ public:
 
 	void setDirection(const Direction& d)
 	{
-		fprintf(mFile,"\tsetAttr \".d\" ");
+		writeString(mFile,"\tsetAttr \".d\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionX(double dx)
 	{
 		if(dx == 0) return;
-		fprintf(mFile,"\tsetAttr \".d.dx\" %f;\n", dx);
+		writeFloat(mFile,"\tsetAttr \".d.dx\" ",dx,";\n");
 	}
 	void setDirectionY(double dy)
 	{
 		if(dy == 0) return;
-		fprintf(mFile,"\tsetAttr \".d.dy\" %f;\n", dy);
+		writeFloat(mFile,"\tsetAttr \".d.dy\" ",dy,";\n");
 	}
 	void setDirectionZ(double dz)
 	{
 		if(dz == 0) return;
-		fprintf(mFile,"\tsetAttr \".d.dz\" %f;\n", dz);
+		writeFloat(mFile,"\tsetAttr \".d.dz\" ",dz,";\n");
 	}
 	void setSpeed(double spd)
 	{
 		if(spd == 0) return;
-		fprintf(mFile,"\tsetAttr \".spd\" %f;\n", spd);
+		writeFloat(mFile,"\tsetAttr \".spd\" ",spd,";\n");
 	}
 	void setInheritVelocity(double iv)
 	{
 		if(iv == 0) return;
-		fprintf(mFile,"\tsetAttr \".iv\" %f;\n", iv);
+		writeFloat(mFile,"\tsetAttr \".iv\" ",iv,";\n");
 	}
 	void setComponentOnly(bool co)
 	{
 		if(co == false) return;
-		fprintf(mFile,"\tsetAttr \".co\" %i;\n", co);
+		writeInt(mFile,"\tsetAttr \".co\" ",co,";\n");
 	}
 	void setSpread(double spr)
 	{
 		if(spr == 0) return;
-		fprintf(mFile,"\tsetAttr \".spr\" %f;\n", spr);
+		writeFloat(mFile,"\tsetAttr \".spr\" ",spr,";\n");
 	}
 	void setEnableSpread(bool es)
 	{
 		if(es == false) return;
-		fprintf(mFile,"\tsetAttr \".es\" %i;\n", es);
+		writeInt(mFile,"\tsetAttr \".es\" ",es,";\n");
 	}
 	void setInheritRotation(bool ir)
 	{
 		if(ir == false) return;
-		fprintf(mFile,"\tsetAttr \".ir\" %i;\n", ir);
+		writeInt(mFile,"\tsetAttr \".ir\" ",ir,";\n");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDirectionX()const
 	{
-		fprintf(mFile,"\"%s.d.dx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dx\"");
 	}
 	void getDirectionY()const
 	{
-		fprintf(mFile,"\"%s.d.dy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dy\"");
 	}
 	void getDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.d.dz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dz\"");
 	}
 	void getSpeed()const
 	{
-		fprintf(mFile,"\"%s.spd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spd\"");
 	}
 	void getInheritVelocity()const
 	{
-		fprintf(mFile,"\"%s.iv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iv\"");
 	}
 	void getComponentOnly()const
 	{
-		fprintf(mFile,"\"%s.co\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co\"");
 	}
 	void getSpread()const
 	{
-		fprintf(mFile,"\"%s.spr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spr\"");
 	}
 	void getEnableSpread()const
 	{
-		fprintf(mFile,"\"%s.es\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".es\"");
 	}
 	void getInheritRotation()const
 	{
-		fprintf(mFile,"\"%s.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir\"");
 	}
 protected:
 	AirField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
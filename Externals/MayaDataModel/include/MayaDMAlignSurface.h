@@ -27,180 +27,180 @@ public:
 	void setTangentScale1(double ts1)
 	{
 		if(ts1 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ts1\" %f;\n", ts1);
+		writeFloat(mFile,"\tsetAttr \".ts1\" ",ts1,";\n");
 	}
 	void setTangentScale2(double ts2)
 	{
 		if(ts2 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ts2\" %f;\n", ts2);
+		writeFloat(mFile,"\tsetAttr \".ts2\" ",ts2,";\n");
 	}
 	void setCurvatureScale1(double cs1)
 	{
 		if(cs1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs1\" %f;\n", cs1);
+		writeFloat(mFile,"\tsetAttr \".cs1\" ",cs1,";\n");
 	}
 	void setCurvatureScale2(double cs2)
 	{
 		if(cs2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs2\" %f;\n", cs2);
+		writeFloat(mFile,"\tsetAttr \".cs2\" ",cs2,";\n");
 	}
 	void setPositionalContinuityType(unsigned int pct)
 	{
 		if(pct == 1) return;
-		fprintf(mFile,"\tsetAttr \".pct\" %i;\n", pct);
+		writeInt(mFile,"\tsetAttr \".pct\" ",pct,";\n");
 	}
 	void setTangentContinuityType(unsigned int tct)
 	{
 		if(tct == 1) return;
-		fprintf(mFile,"\tsetAttr \".tct\" %i;\n", tct);
+		writeInt(mFile,"\tsetAttr \".tct\" ",tct,";\n");
 	}
 	void setJoinParameter(float jnp)
 	{
 		if(jnp == 123456.0) return;
-		fprintf(mFile,"\tsetAttr \".jnp\" %f;\n", jnp);
+		writeFloat(mFile,"\tsetAttr \".jnp\" ",jnp,";\n");
 	}
 	void setTwist(bool tw)
 	{
 		if(tw == false) return;
-		fprintf(mFile,"\tsetAttr \".tw\" %i;\n", tw);
+		writeInt(mFile,"\tsetAttr \".tw\" ",tw,";\n");
 	}
 	void setReverse1(bool rv1)
 	{
 		if(rv1 == false) return;
-		fprintf(mFile,"\tsetAttr \".rv1\" %i;\n", rv1);
+		writeInt(mFile,"\tsetAttr \".rv1\" ",rv1,";\n");
 	}
 	void setReverse2(bool rv2)
 	{
 		if(rv2 == false) return;
-		fprintf(mFile,"\tsetAttr \".rv2\" %i;\n", rv2);
+		writeInt(mFile,"\tsetAttr \".rv2\" ",rv2,";\n");
 	}
 	void setSwap1(bool sw1)
 	{
 		if(sw1 == false) return;
-		fprintf(mFile,"\tsetAttr \".sw1\" %i;\n", sw1);
+		writeInt(mFile,"\tsetAttr \".sw1\" ",sw1,";\n");
 	}
 	void setSwap2(bool sw2)
 	{
 		if(sw2 == false) return;
-		fprintf(mFile,"\tsetAttr \".sw2\" %i;\n", sw2);
+		writeInt(mFile,"\tsetAttr \".sw2\" ",sw2,";\n");
 	}
 	void setAttach(bool at)
 	{
 		if(at == false) return;
-		fprintf(mFile,"\tsetAttr \".at\" %i;\n", at);
+		writeInt(mFile,"\tsetAttr \".at\" ",at,";\n");
 	}
 	void setKeepMultipleKnots(bool kmk)
 	{
 		if(kmk == true) return;
-		fprintf(mFile,"\tsetAttr \".kmk\" %i;\n", kmk);
+		writeInt(mFile,"\tsetAttr \".kmk\" ",kmk,";\n");
 	}
 	void setPositionalContinuity(bool pc)
 	{
 		if(pc == true) return;
-		fprintf(mFile,"\tsetAttr \".pc\" %i;\n", pc);
+		writeInt(mFile,"\tsetAttr \".pc\" ",pc,";\n");
 	}
 	void setTangentContinuity(bool tc)
 	{
 		if(tc == true) return;
-		fprintf(mFile,"\tsetAttr \".tc\" %i;\n", tc);
+		writeInt(mFile,"\tsetAttr \".tc\" ",tc,";\n");
 	}
 	void setCurvatureContinuity(bool cc)
 	{
 		if(cc == false) return;
-		fprintf(mFile,"\tsetAttr \".cc\" %i;\n", cc);
+		writeInt(mFile,"\tsetAttr \".cc\" ",cc,";\n");
 	}
 	void setDirectionU(bool du)
 	{
 		if(du == true) return;
-		fprintf(mFile,"\tsetAttr \".du\" %i;\n", du);
+		writeInt(mFile,"\tsetAttr \".du\" ",du,";\n");
 	}
 	void getInputSurface1()const
 	{
-		fprintf(mFile,"\"%s.is1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is1\"");
 	}
 	void getInputSurface2()const
 	{
-		fprintf(mFile,"\"%s.is2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is2\"");
 	}
 	void getOutputSurface1()const
 	{
-		fprintf(mFile,"\"%s.os1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os1\"");
 	}
 	void getOutputSurface2()const
 	{
-		fprintf(mFile,"\"%s.os2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os2\"");
 	}
 	void getTangentScale1()const
 	{
-		fprintf(mFile,"\"%s.ts1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ts1\"");
 	}
 	void getTangentScale2()const
 	{
-		fprintf(mFile,"\"%s.ts2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ts2\"");
 	}
 	void getCurvatureScale1()const
 	{
-		fprintf(mFile,"\"%s.cs1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs1\"");
 	}
 	void getCurvatureScale2()const
 	{
-		fprintf(mFile,"\"%s.cs2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs2\"");
 	}
 	void getPositionalContinuityType()const
 	{
-		fprintf(mFile,"\"%s.pct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pct\"");
 	}
 	void getTangentContinuityType()const
 	{
-		fprintf(mFile,"\"%s.tct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tct\"");
 	}
 	void getJoinParameter()const
 	{
-		fprintf(mFile,"\"%s.jnp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jnp\"");
 	}
 	void getTwist()const
 	{
-		fprintf(mFile,"\"%s.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tw\"");
 	}
 	void getReverse1()const
 	{
-		fprintf(mFile,"\"%s.rv1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rv1\"");
 	}
 	void getReverse2()const
 	{
-		fprintf(mFile,"\"%s.rv2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rv2\"");
 	}
 	void getSwap1()const
 	{
-		fprintf(mFile,"\"%s.sw1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sw1\"");
 	}
 	void getSwap2()const
 	{
-		fprintf(mFile,"\"%s.sw2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sw2\"");
 	}
 	void getAttach()const
 	{
-		fprintf(mFile,"\"%s.at\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".at\"");
 	}
 	void getKeepMultipleKnots()const
 	{
-		fprintf(mFile,"\"%s.kmk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kmk\"");
 	}
 	void getPositionalContinuity()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getTangentContinuity()const
 	{
-		fprintf(mFile,"\"%s.tc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc\"");
 	}
 	void getCurvatureContinuity()const
 	{
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 	void getDirectionU()const
 	{
-		fprintf(mFile,"\"%s.du\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".du\"");
 	}
 protected:
 	AlignSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,7 +27,7 @@ public:
 	void setAmbientShade(float as)
 	{
 		if(as == 0.45) return;
-		fprintf(mFile,"\tsetAttr \".as\" %f;\n", as);
+		writeFloat(mFile,"\tsetAttr \".as\" ",as,";\n");
 	}
 	void setObjectType(char ot)
 	{
@@ -37,53 +37,53 @@ public:
 	void setShadowRadius(float sr)
 	{
 		if(sr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setCastSoftShadows(bool cw)
 	{
 		if(cw == false) return;
-		fprintf(mFile,"\tsetAttr \".cw\" %i;\n", cw);
+		writeInt(mFile,"\tsetAttr \".cw\" ",cw,";\n");
 	}
 	void setReceiveShadows(bool gs)
 	{
 		if(gs == true) return;
-		fprintf(mFile,"\tsetAttr \".gs\" %i;\n", gs);
+		writeInt(mFile,"\tsetAttr \".gs\" ",gs,";\n");
 	}
 	void getAmbientShade()const
 	{
-		fprintf(mFile,"\"%s.as\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".as\"");
 	}
 	void getObjectType()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getShadowRadius()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getCastSoftShadows()const
 	{
-		fprintf(mFile,"\"%s.cw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cw\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getReceiveShadows()const
 	{
-		fprintf(mFile,"\"%s.gs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gs\"");
 	}
 protected:
 	AmbientLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
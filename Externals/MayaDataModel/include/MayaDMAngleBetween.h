@@ -31,117 +31,117 @@ public:
 
 	void setVector1(const double3& v1)
 	{
-		fprintf(mFile,"\tsetAttr \".v1\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".v1\" -type \"double3\" ");
 		v1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVector1X(double v1x)
 	{
 		if(v1x == 0) return;
-		fprintf(mFile,"\tsetAttr \".v1.v1x\" %f;\n", v1x);
+		writeFloat(mFile,"\tsetAttr \".v1.v1x\" ",v1x,";\n");
 	}
 	void setVector1Y(double v1y)
 	{
 		if(v1y == 1) return;
-		fprintf(mFile,"\tsetAttr \".v1.v1y\" %f;\n", v1y);
+		writeFloat(mFile,"\tsetAttr \".v1.v1y\" ",v1y,";\n");
 	}
 	void setVector1Z(double v1z)
 	{
 		if(v1z == 0) return;
-		fprintf(mFile,"\tsetAttr \".v1.v1z\" %f;\n", v1z);
+		writeFloat(mFile,"\tsetAttr \".v1.v1z\" ",v1z,";\n");
 	}
 	void setVector2(const double3& v2)
 	{
-		fprintf(mFile,"\tsetAttr \".v2\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".v2\" -type \"double3\" ");
 		v2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVector2X(double v2x)
 	{
 		if(v2x == 0) return;
-		fprintf(mFile,"\tsetAttr \".v2.v2x\" %f;\n", v2x);
+		writeFloat(mFile,"\tsetAttr \".v2.v2x\" ",v2x,";\n");
 	}
 	void setVector2Y(double v2y)
 	{
 		if(v2y == 0) return;
-		fprintf(mFile,"\tsetAttr \".v2.v2y\" %f;\n", v2y);
+		writeFloat(mFile,"\tsetAttr \".v2.v2y\" ",v2y,";\n");
 	}
 	void setVector2Z(double v2z)
 	{
 		if(v2z == 1) return;
-		fprintf(mFile,"\tsetAttr \".v2.v2z\" %f;\n", v2z);
+		writeFloat(mFile,"\tsetAttr \".v2.v2z\" ",v2z,";\n");
 	}
 	void getVector1()const
 	{
-		fprintf(mFile,"\"%s.v1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v1\"");
 	}
 	void getVector1X()const
 	{
-		fprintf(mFile,"\"%s.v1.v1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v1.v1x\"");
 	}
 	void getVector1Y()const
 	{
-		fprintf(mFile,"\"%s.v1.v1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v1.v1y\"");
 	}
 	void getVector1Z()const
 	{
-		fprintf(mFile,"\"%s.v1.v1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v1.v1z\"");
 	}
 	void getVector2()const
 	{
-		fprintf(mFile,"\"%s.v2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v2\"");
 	}
 	void getVector2X()const
 	{
-		fprintf(mFile,"\"%s.v2.v2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v2.v2x\"");
 	}
 	void getVector2Y()const
 	{
-		fprintf(mFile,"\"%s.v2.v2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v2.v2y\"");
 	}
 	void getVector2Z()const
 	{
-		fprintf(mFile,"\"%s.v2.v2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v2.v2z\"");
 	}
 	void getEuler()const
 	{
-		fprintf(mFile,"\"%s.eu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eu\"");
 	}
 	void getEulerX()const
 	{
-		fprintf(mFile,"\"%s.eu.eux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eu.eux\"");
 	}
 	void getEulerY()const
 	{
-		fprintf(mFile,"\"%s.eu.euy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eu.euy\"");
 	}
 	void getEulerZ()const
 	{
-		fprintf(mFile,"\"%s.eu.euz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eu.euz\"");
 	}
 	void getAxisAngle()const
 	{
-		fprintf(mFile,"\"%s.axa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".axa\"");
 	}
 	void getAxis()const
 	{
-		fprintf(mFile,"\"%s.axa.ax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".axa.ax\"");
 	}
 	void getAxisX()const
 	{
-		fprintf(mFile,"\"%s.axa.ax.axx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".axa.ax.axx\"");
 	}
 	void getAxisY()const
 	{
-		fprintf(mFile,"\"%s.axa.ax.axy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".axa.ax.axy\"");
 	}
 	void getAxisZ()const
 	{
-		fprintf(mFile,"\"%s.axa.ax.axz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".axa.ax.axz\"");
 	}
 	void getAngle()const
 	{
-		fprintf(mFile,"\"%s.axa.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".axa.a\"");
 	}
 protected:
 	AngleBetween(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
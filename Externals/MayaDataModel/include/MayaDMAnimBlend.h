@@ -27,15 +27,15 @@ public:
 	void setWeight(double w)
 	{
 		if(w == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void getBlend()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getWeight()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 protected:
 	AnimBlend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setRotationBlend(unsigned int rb)
 	{
 		if(rb == 0) return;
-		fprintf(mFile,"\tsetAttr \".rb\" %i;\n", rb);
+		writeInt(mFile,"\tsetAttr \".rb\" ",rb,";\n");
 	}
 	void getRotationBlend()const
 	{
-		fprintf(mFile,"\"%s.rb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rb\"");
 	}
 protected:
 	AnimBlendInOut(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
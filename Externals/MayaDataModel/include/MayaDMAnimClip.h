@@ -27,239 +27,239 @@ public:
 	void setEnable(bool ea)
 	{
 		if(ea == 1) return;
-		fprintf(mFile,"\tsetAttr \".ea\" %i;\n", ea);
+		writeInt(mFile,"\tsetAttr \".ea\" ",ea,";\n");
 	}
 	void setAbsoluteChannel(size_t ac_i,bool ac)
 	{
 		if(ac == false) return;
-		fprintf(mFile,"\tsetAttr \".ac[%i]\" %i;\n", ac_i,ac);
+		writeInt(mFile,"\tsetAttr \".ac[",ac_i); writeInt(mFile,"]\" ",ac,";\n");
 	}
 	void setAbsoluteChannel(size_t ac_start,size_t ac_end,bool* ac)
 	{
-		fprintf(mFile,"\tsetAttr \".ac[%i:%i]\" ", ac_start,ac_end);
+		writeInt(mFile,"\tsetAttr \".ac[",ac_start); writeInt(mFile,":",ac_end,"]\" ");
 		size_t size = (ac_end-ac_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ac[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ac[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startAbsoluteChannel(size_t ac_start,size_t ac_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ac[%i:%i]\"",ac_start,ac_end);
+		writeInt(mFile,"\tsetAttr \".ac[",ac_start); writeInt(mFile,":",ac_end,"]\"");
 	}
 	void appendAbsoluteChannel(bool ac)const
 	{
-		fprintf(mFile," %i",ac);
+		writeInt(mFile," ",ac);
 	}
 	void endAbsoluteChannel()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChannelOffset(size_t co_i,double co)
 	{
 		if(co == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".co[%i]\" %f;\n", co_i,co);
+		writeInt(mFile,"\tsetAttr \".co[",co_i); writeFloat(mFile,"]\" ",co,";\n");
 	}
 	void setChannelOffset(size_t co_start,size_t co_end,double* co)
 	{
-		fprintf(mFile,"\tsetAttr \".co[%i:%i]\" ", co_start,co_end);
+		writeInt(mFile,"\tsetAttr \".co[",co_start); writeInt(mFile,":",co_end,"]\" ");
 		size_t size = (co_end-co_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",co[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",co[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startChannelOffset(size_t co_start,size_t co_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".co[%i:%i]\"",co_start,co_end);
+		writeInt(mFile,"\tsetAttr \".co[",co_start); writeInt(mFile,":",co_end,"]\"");
 	}
 	void appendChannelOffset(double co)const
 	{
-		fprintf(mFile," %f",co);
+		writeFloat(mFile," ",co);
 	}
 	void endChannelOffset()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStartFrame(double sf)
 	{
 		if(sf == 0) return;
-		fprintf(mFile,"\tsetAttr \".sf\" %f;\n", sf);
+		writeFloat(mFile,"\tsetAttr \".sf\" ",sf,";\n");
 	}
 	void setScale(double sc)
 	{
 		if(sc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %f;\n", sc);
+		writeFloat(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setHold(double h)
 	{
 		if(h == 0) return;
-		fprintf(mFile,"\tsetAttr \".h\" %f;\n", h);
+		writeFloat(mFile,"\tsetAttr \".h\" ",h,";\n");
 	}
 	void setPreCycle(double cb)
 	{
 		if(cb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".cb\" ",cb,";\n");
 	}
 	void setPostCycle(double ca)
 	{
 		if(ca == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ca\" %f;\n", ca);
+		writeFloat(mFile,"\tsetAttr \".ca\" ",ca,";\n");
 	}
 	void setWeight(double w)
 	{
 		if(w == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setWeightStyle(unsigned int ws)
 	{
 		if(ws == 0) return;
-		fprintf(mFile,"\tsetAttr \".ws\" %i;\n", ws);
+		writeInt(mFile,"\tsetAttr \".ws\" ",ws,";\n");
 	}
 	void setPose(bool ps)
 	{
 		if(ps == false) return;
-		fprintf(mFile,"\tsetAttr \".ps\" %i;\n", ps);
+		writeInt(mFile,"\tsetAttr \".ps\" ",ps,";\n");
 	}
 	void setSourceStart(double ss)
 	{
 		if(ss == 0) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %f;\n", ss);
+		writeFloat(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setSourceEnd(double se)
 	{
 		if(se == 0) return;
-		fprintf(mFile,"\tsetAttr \".se\" %f;\n", se);
+		writeFloat(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setClipInstance(bool ci)
 	{
 		if(ci == 1) return;
-		fprintf(mFile,"\tsetAttr \".ci\" %i;\n", ci);
+		writeInt(mFile,"\tsetAttr \".ci\" ",ci,";\n");
 	}
 	void setTimeWarp(double tw)
 	{
 		if(tw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tw\" %f;\n", tw);
+		writeFloat(mFile,"\tsetAttr \".tw\" ",tw,";\n");
 	}
 	void setTimeWarpEnable(bool twe)
 	{
 		if(twe == false) return;
-		fprintf(mFile,"\tsetAttr \".twe\" %i;\n", twe);
+		writeInt(mFile,"\tsetAttr \".twe\" ",twe,";\n");
 	}
 	void setCycle(double cy)
 	{
 		if(cy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cy\" %f;\n", cy);
+		writeFloat(mFile,"\tsetAttr \".cy\" ",cy,";\n");
 	}
 	void getEnable()const
 	{
-		fprintf(mFile,"\"%s.ea\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ea\"");
 	}
 	void getAbsoluteChannel(size_t ac_i)const
 	{
-		fprintf(mFile,"\"%s.ac[%i]\"",mName.c_str(),ac_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac[",ac_i,"]\"");
 	}
 	void getAbsoluteChannel()const
 	{
 
-		fprintf(mFile,"\"%s.ac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac\"");
 	}
 	void getChannelOffset(size_t co_i)const
 	{
-		fprintf(mFile,"\"%s.co[%i]\"",mName.c_str(),co_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".co[",co_i,"]\"");
 	}
 	void getChannelOffset()const
 	{
 
-		fprintf(mFile,"\"%s.co\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co\"");
 	}
 	void getStartFrame()const
 	{
-		fprintf(mFile,"\"%s.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sf\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getHold()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getPreCycle()const
 	{
-		fprintf(mFile,"\"%s.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb\"");
 	}
 	void getPostCycle()const
 	{
-		fprintf(mFile,"\"%s.ca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ca\"");
 	}
 	void getWeight()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getWeightStyle()const
 	{
-		fprintf(mFile,"\"%s.ws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ws\"");
 	}
 	void getPose()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getSourceStart()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getSourceEnd()const
 	{
-		fprintf(mFile,"\"%s.se\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".se\"");
 	}
 	void getClip()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getClipInstance()const
 	{
-		fprintf(mFile,"\"%s.ci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ci\"");
 	}
 	void getTimeWarp()const
 	{
-		fprintf(mFile,"\"%s.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tw\"");
 	}
 	void getTimeWarpEnable()const
 	{
-		fprintf(mFile,"\"%s.twe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twe\"");
 	}
 	void getStart()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getDuration()const
 	{
-		fprintf(mFile,"\"%s.du\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".du\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getAbsoluteRotations()const
 	{
-		fprintf(mFile,"\"%s.abro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".abro\"");
 	}
 	void getCycle()const
 	{
-		fprintf(mFile,"\"%s.cy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cy\"");
 	}
 	void getStartTrim()const
 	{
-		fprintf(mFile,"\"%s.str\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".str\"");
 	}
 	void getStartPercent()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 protected:
 	AnimClip(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
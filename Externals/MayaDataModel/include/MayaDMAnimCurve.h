@@ -27,406 +27,406 @@ public:
 	void setTangentType(unsigned int tan)
 	{
 		if(tan == 4) return;
-		fprintf(mFile,"\tsetAttr \".tan\" %i;\n", tan);
+		writeInt(mFile,"\tsetAttr \".tan\" ",tan,";\n");
 	}
 	void setWeightedTangents(bool wgt)
 	{
 		if(wgt == true) return;
-		fprintf(mFile,"\tsetAttr \".wgt\" %i;\n", wgt);
+		writeInt(mFile,"\tsetAttr \".wgt\" ",wgt,";\n");
 	}
 	void setKeyTanLocked(size_t ktl_i,bool ktl)
 	{
 		if(ktl == true) return;
-		fprintf(mFile,"\tsetAttr \".ktl[%i]\" %i;\n", ktl_i,ktl);
+		writeInt(mFile,"\tsetAttr \".ktl[",ktl_i); writeInt(mFile,"]\" ",ktl,";\n");
 	}
 	void setKeyTanLocked(size_t ktl_start,size_t ktl_end,bool* ktl)
 	{
-		fprintf(mFile,"\tsetAttr \".ktl[%i:%i]\" ", ktl_start,ktl_end);
+		writeInt(mFile,"\tsetAttr \".ktl[",ktl_start); writeInt(mFile,":",ktl_end,"]\" ");
 		size_t size = (ktl_end-ktl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ktl[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ktl[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTanLocked(size_t ktl_start,size_t ktl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ktl[%i:%i]\"",ktl_start,ktl_end);
+		writeInt(mFile,"\tsetAttr \".ktl[",ktl_start); writeInt(mFile,":",ktl_end,"]\"");
 	}
 	void appendKeyTanLocked(bool ktl)const
 	{
-		fprintf(mFile," %i",ktl);
+		writeInt(mFile," ",ktl);
 	}
 	void endKeyTanLocked()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyWeightLocked(size_t kwl_i,bool kwl)
 	{
 		if(kwl == true) return;
-		fprintf(mFile,"\tsetAttr \".kwl[%i]\" %i;\n", kwl_i,kwl);
+		writeInt(mFile,"\tsetAttr \".kwl[",kwl_i); writeInt(mFile,"]\" ",kwl,";\n");
 	}
 	void setKeyWeightLocked(size_t kwl_start,size_t kwl_end,bool* kwl)
 	{
-		fprintf(mFile,"\tsetAttr \".kwl[%i:%i]\" ", kwl_start,kwl_end);
+		writeInt(mFile,"\tsetAttr \".kwl[",kwl_start); writeInt(mFile,":",kwl_end,"]\" ");
 		size_t size = (kwl_end-kwl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kwl[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",kwl[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyWeightLocked(size_t kwl_start,size_t kwl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".kwl[%i:%i]\"",kwl_start,kwl_end);
+		writeInt(mFile,"\tsetAttr \".kwl[",kwl_start); writeInt(mFile,":",kwl_end,"]\"");
 	}
 	void appendKeyWeightLocked(bool kwl)const
 	{
-		fprintf(mFile," %i",kwl);
+		writeInt(mFile," ",kwl);
 	}
 	void endKeyWeightLocked()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTanInX(size_t kix_i,double kix)
 	{
 		if(kix == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".kix[%i]\" %f;\n", kix_i,kix);
+		writeInt(mFile,"\tsetAttr \".kix[",kix_i); writeFloat(mFile,"]\" ",kix,";\n");
 	}
 	void setKeyTanInX(size_t kix_start,size_t kix_end,double* kix)
 	{
-		fprintf(mFile,"\tsetAttr \".kix[%i:%i]\" ", kix_start,kix_end);
+		writeInt(mFile,"\tsetAttr \".kix[",kix_start); writeInt(mFile,":",kix_end,"]\" ");
 		size_t size = (kix_end-kix_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",kix[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",kix[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTanInX(size_t kix_start,size_t kix_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".kix[%i:%i]\"",kix_start,kix_end);
+		writeInt(mFile,"\tsetAttr \".kix[",kix_start); writeInt(mFile,":",kix_end,"]\"");
 	}
 	void appendKeyTanInX(double kix)const
 	{
-		fprintf(mFile," %f",kix);
+		writeFloat(mFile," ",kix);
 	}
 	void endKeyTanInX()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTanInY(size_t kiy_i,double kiy)
 	{
 		if(kiy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".kiy[%i]\" %f;\n", kiy_i,kiy);
+		writeInt(mFile,"\tsetAttr \".kiy[",kiy_i); writeFloat(mFile,"]\" ",kiy,";\n");
 	}
 	void setKeyTanInY(size_t kiy_start,size_t kiy_end,double* kiy)
 	{
-		fprintf(mFile,"\tsetAttr \".kiy[%i:%i]\" ", kiy_start,kiy_end);
+		writeInt(mFile,"\tsetAttr \".kiy[",kiy_start); writeInt(mFile,":",kiy_end,"]\" ");
 		size_t size = (kiy_end-kiy_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",kiy[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",kiy[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTanInY(size_t kiy_start,size_t kiy_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".kiy[%i:%i]\"",kiy_start,kiy_end);
+		writeInt(mFile,"\tsetAttr \".kiy[",kiy_start); writeInt(mFile,":",kiy_end,"]\"");
 	}
 	void appendKeyTanInY(double kiy)const
 	{
-		fprintf(mFile," %f",kiy);
+		writeFloat(mFile," ",kiy);
 	}
 	void endKeyTanInY()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTanOutX(size_t kox_i,double kox)
 	{
 		if(kox == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".kox[%i]\" %f;\n", kox_i,kox);
+		writeInt(mFile,"\tsetAttr \".kox[",kox_i); writeFloat(mFile,"]\" ",kox,";\n");
 	}
 	void setKeyTanOutX(size_t kox_start,size_t kox_end,double* kox)
 	{
-		fprintf(mFile,"\tsetAttr \".kox[%i:%i]\" ", kox_start,kox_end);
+		writeInt(mFile,"\tsetAttr \".kox[",kox_start); writeInt(mFile,":",kox_end,"]\" ");
 		size_t size = (kox_end-kox_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",kox[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",kox[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTanOutX(size_t kox_start,size_t kox_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".kox[%i:%i]\"",kox_start,kox_end);
+		writeInt(mFile,"\tsetAttr \".kox[",kox_start); writeInt(mFile,":",kox_end,"]\"");
 	}
 	void appendKeyTanOutX(double kox)const
 	{
-		fprintf(mFile," %f",kox);
+		writeFloat(mFile," ",kox);
 	}
 	void endKeyTanOutX()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTanOutY(size_t koy_i,double koy)
 	{
 		if(koy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".koy[%i]\" %f;\n", koy_i,koy);
+		writeInt(mFile,"\tsetAttr \".koy[",koy_i); writeFloat(mFile,"]\" ",koy,";\n");
 	}
 	void setKeyTanOutY(size_t koy_start,size_t koy_end,double* koy)
 	{
-		fprintf(mFile,"\tsetAttr \".koy[%i:%i]\" ", koy_start,koy_end);
+		writeInt(mFile,"\tsetAttr \".koy[",koy_start); writeInt(mFile,":",koy_end,"]\" ");
 		size_t size = (koy_end-koy_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",koy[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",koy[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTanOutY(size_t koy_start,size_t koy_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".koy[%i:%i]\"",koy_start,koy_end);
+		writeInt(mFile,"\tsetAttr \".koy[",koy_start); writeInt(mFile,":",koy_end,"]\"");
 	}
 	void appendKeyTanOutY(double koy)const
 	{
-		fprintf(mFile," %f",koy);
+		writeFloat(mFile," ",koy);
 	}
 	void endKeyTanOutY()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTanInType(size_t kit_i,unsigned int kit)
 	{
 		if(kit == 4) return;
-		fprintf(mFile,"\tsetAttr \".kit[%i]\" %i;\n", kit_i,kit);
+		writeInt(mFile,"\tsetAttr \".kit[",kit_i); writeInt(mFile,"]\" ",kit,";\n");
 	}
 	void setKeyTanInType(size_t kit_start,size_t kit_end,unsigned int* kit)
 	{
-		fprintf(mFile,"\tsetAttr \".kit[%i:%i]\" ", kit_start,kit_end);
+		writeInt(mFile,"\tsetAttr \".kit[",kit_start); writeInt(mFile,":",kit_end,"]\" ");
 		size_t size = (kit_end-kit_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kit[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",kit[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTanInType(size_t kit_start,size_t kit_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".kit[%i:%i]\"",kit_start,kit_end);
+		writeInt(mFile,"\tsetAttr \".kit[",kit_start); writeInt(mFile,":",kit_end,"]\"");
 	}
 	void appendKeyTanInType(unsigned int kit)const
 	{
-		fprintf(mFile," %i",kit);
+		writeInt(mFile," ",kit);
 	}
 	void endKeyTanInType()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTanOutType(size_t kot_i,unsigned int kot)
 	{
 		if(kot == 4) return;
-		fprintf(mFile,"\tsetAttr \".kot[%i]\" %i;\n", kot_i,kot);
+		writeInt(mFile,"\tsetAttr \".kot[",kot_i); writeInt(mFile,"]\" ",kot,";\n");
 	}
 	void setKeyTanOutType(size_t kot_start,size_t kot_end,unsigned int* kot)
 	{
-		fprintf(mFile,"\tsetAttr \".kot[%i:%i]\" ", kot_start,kot_end);
+		writeInt(mFile,"\tsetAttr \".kot[",kot_start); writeInt(mFile,":",kot_end,"]\" ");
 		size_t size = (kot_end-kot_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kot[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",kot[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTanOutType(size_t kot_start,size_t kot_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".kot[%i:%i]\"",kot_start,kot_end);
+		writeInt(mFile,"\tsetAttr \".kot[",kot_start); writeInt(mFile,":",kot_end,"]\"");
 	}
 	void appendKeyTanOutType(unsigned int kot)const
 	{
-		fprintf(mFile," %i",kot);
+		writeInt(mFile," ",kot);
 	}
 	void endKeyTanOutType()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyBreakdown(size_t kbd_i,bool kbd)
 	{
 		if(kbd == false) return;
-		fprintf(mFile,"\tsetAttr \".kbd[%i]\" %i;\n", kbd_i,kbd);
+		writeInt(mFile,"\tsetAttr \".kbd[",kbd_i); writeInt(mFile,"]\" ",kbd,";\n");
 	}
 	void setKeyBreakdown(size_t kbd_start,size_t kbd_end,bool* kbd)
 	{
-		fprintf(mFile,"\tsetAttr \".kbd[%i:%i]\" ", kbd_start,kbd_end);
+		writeInt(mFile,"\tsetAttr \".kbd[",kbd_start); writeInt(mFile,":",kbd_end,"]\" ");
 		size_t size = (kbd_end-kbd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kbd[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",kbd[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyBreakdown(size_t kbd_start,size_t kbd_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".kbd[%i:%i]\"",kbd_start,kbd_end);
+		writeInt(mFile,"\tsetAttr \".kbd[",kbd_start); writeInt(mFile,":",kbd_end,"]\"");
 	}
 	void appendKeyBreakdown(bool kbd)const
 	{
-		fprintf(mFile," %i",kbd);
+		writeInt(mFile," ",kbd);
 	}
 	void endKeyBreakdown()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTickDrawSpecial(size_t kyts_i,bool kyts)
 	{
 		if(kyts == false) return;
-		fprintf(mFile,"\tsetAttr \".kyts[%i]\" %i;\n", kyts_i,kyts);
+		writeInt(mFile,"\tsetAttr \".kyts[",kyts_i); writeInt(mFile,"]\" ",kyts,";\n");
 	}
 	void setKeyTickDrawSpecial(size_t kyts_start,size_t kyts_end,bool* kyts)
 	{
-		fprintf(mFile,"\tsetAttr \".kyts[%i:%i]\" ", kyts_start,kyts_end);
+		writeInt(mFile,"\tsetAttr \".kyts[",kyts_start); writeInt(mFile,":",kyts_end,"]\" ");
 		size_t size = (kyts_end-kyts_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kyts[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",kyts[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTickDrawSpecial(size_t kyts_start,size_t kyts_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".kyts[%i:%i]\"",kyts_start,kyts_end);
+		writeInt(mFile,"\tsetAttr \".kyts[",kyts_start); writeInt(mFile,":",kyts_end,"]\"");
 	}
 	void appendKeyTickDrawSpecial(bool kyts)const
 	{
-		fprintf(mFile," %i",kyts);
+		writeInt(mFile," ",kyts);
 	}
 	void endKeyTickDrawSpecial()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotationInterpolation(unsigned int roti)
 	{
 		if(roti == 1) return;
-		fprintf(mFile,"\tsetAttr \".roti\" %i;\n", roti);
+		writeInt(mFile,"\tsetAttr \".roti\" ",roti,";\n");
 	}
 	void setPreInfinity(unsigned int pre)
 	{
 		if(pre == 0) return;
-		fprintf(mFile,"\tsetAttr \".pre\" %i;\n", pre);
+		writeInt(mFile,"\tsetAttr \".pre\" ",pre,";\n");
 	}
 	void setPostInfinity(unsigned int pst)
 	{
 		if(pst == 0) return;
-		fprintf(mFile,"\tsetAttr \".pst\" %i;\n", pst);
+		writeInt(mFile,"\tsetAttr \".pst\" ",pst,";\n");
 	}
 	void setStipplePattern(unsigned int sp)
 	{
 		if(sp == 6) return;
-		fprintf(mFile,"\tsetAttr \".sp\" %i;\n", sp);
+		writeInt(mFile,"\tsetAttr \".sp\" ",sp,";\n");
 	}
 	void setOutStippleThreshold(double ot)
 	{
 		if(ot == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ot\" %f;\n", ot);
+		writeFloat(mFile,"\tsetAttr \".ot\" ",ot,";\n");
 	}
 	void setOutStippleRange(const doubleArray& osr)
 	{
 		if(osr.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".osr\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".osr\" -type \"doubleArray\" ");
 		osr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInStippleRange(const doubleArray& isr)
 	{
 		if(isr.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".isr\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".isr\" -type \"doubleArray\" ");
 		isr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStippleReverse(bool sr)
 	{
 		if(sr == false) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %i;\n", sr);
+		writeInt(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setUseCurveColor(bool ucc)
 	{
 		if(ucc == false) return;
-		fprintf(mFile,"\tsetAttr \".ucc\" %i;\n", ucc);
+		writeInt(mFile,"\tsetAttr \".ucc\" ",ucc,";\n");
 	}
 	void setCurveColor(const float3& cc)
 	{
-		fprintf(mFile,"\tsetAttr \".cc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cc\" -type \"float3\" ");
 		cc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCurveColorR(float ccr)
 	{
 		if(ccr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cc.ccr\" %f;\n", ccr);
+		writeFloat(mFile,"\tsetAttr \".cc.ccr\" ",ccr,";\n");
 	}
 	void setCurveColorG(float ccg)
 	{
 		if(ccg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cc.ccg\" %f;\n", ccg);
+		writeFloat(mFile,"\tsetAttr \".cc.ccg\" ",ccg,";\n");
 	}
 	void setCurveColorB(float ccb)
 	{
 		if(ccb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cc.ccb\" %f;\n", ccb);
+		writeFloat(mFile,"\tsetAttr \".cc.ccb\" ",ccb,";\n");
 	}
 	void getApply()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getStipplePattern()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getOutStippleThreshold()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutStippleRange()const
 	{
-		fprintf(mFile,"\"%s.osr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".osr\"");
 	}
 	void getInStippleRange()const
 	{
-		fprintf(mFile,"\"%s.isr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isr\"");
 	}
 	void getStippleReverse()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getUseCurveColor()const
 	{
-		fprintf(mFile,"\"%s.ucc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ucc\"");
 	}
 	void getCurveColor()const
 	{
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 	void getCurveColorR()const
 	{
-		fprintf(mFile,"\"%s.cc.ccr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc.ccr\"");
 	}
 	void getCurveColorG()const
 	{
-		fprintf(mFile,"\"%s.cc.ccg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc.ccg\"");
 	}
 	void getCurveColorB()const
 	{
-		fprintf(mFile,"\"%s.cc.ccb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc.ccb\"");
 	}
 protected:
 	AnimCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -22,8 +22,8 @@ public:
 		double keyValue;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", keyTime);
-			fprintf(file,"%f", keyValue);
+			writeFloat(file,"",keyTime," ");
+			writeFloat(file,"",keyValue);
 		}
 	};
 public:
@@ -35,52 +35,52 @@ public:
 
 	void setKeyTimeValue(size_t ktv_i,const KeyTimeValue& ktv)
 	{
-		fprintf(mFile,"\tsetAttr \".ktv[%i]\" ",ktv_i);
+		writeInt(mFile,"\tsetAttr \".ktv[",ktv_i,"]\" ");
 		ktv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTimeValue(size_t ktv_start,size_t ktv_end,KeyTimeValue* ktv)
 	{
-		fprintf(mFile,"\tsetAttr \".ktv[%i:%i]\" ", ktv_start,ktv_end);
+		writeInt(mFile,"\tsetAttr \".ktv[",ktv_start); writeInt(mFile,":",ktv_end,"]\" ");
 		size_t size = (ktv_end-ktv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ktv[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeyTimeValue(size_t ktv_start,size_t ktv_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ktv[%i:%i]\"",ktv_start,ktv_end);
-		fprintf(mFile," -type \"KeyTimeValue\" ");
+		writeInt(mFile,"\tsetAttr \".ktv[",ktv_start); writeInt(mFile,":",ktv_end,"]\"");
+		writeString(mFile," -type \"KeyTimeValue\" ");
 	}
 	void appendKeyTimeValue(const KeyTimeValue& ktv)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ktv.write(mFile);
 	}
 	void endKeyTimeValue()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyTime(size_t ktv_i,double kt)
 	{
 		if(kt == 0) return;
-		fprintf(mFile,"\tsetAttr \".ktv[%i].kt\" %f;\n", ktv_i,kt);
+		writeInt(mFile,"\tsetAttr \".ktv[",ktv_i); writeFloat(mFile,"].kt\" ",kt,";\n");
 	}
 	void setKeyValue(size_t ktv_i,double kv)
 	{
 		if(kv == 0) return;
-		fprintf(mFile,"\tsetAttr \".ktv[%i].kv\" %f;\n", ktv_i,kv);
+		writeInt(mFile,"\tsetAttr \".ktv[",ktv_i); writeFloat(mFile,"].kv\" ",kv,";\n");
 	}
 	void getInput()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	AnimCurveUA(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,179 +27,179 @@ public:
 	void setSpreadX(float sprx)
 	{
 		if(sprx == 13.0) return;
-		fprintf(mFile,"\tsetAttr \".sprx\" %f;\n", sprx);
+		writeFloat(mFile,"\tsetAttr \".sprx\" ",sprx,";\n");
 	}
 	void setSpreadY(float spry)
 	{
 		if(spry == 3.0) return;
-		fprintf(mFile,"\tsetAttr \".spry\" %f;\n", spry);
+		writeFloat(mFile,"\tsetAttr \".spry\" ",spry,";\n");
 	}
 	void setRoughness(float roug)
 	{
 		if(roug == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".roug\" %f;\n", roug);
+		writeFloat(mFile,"\tsetAttr \".roug\" ",roug,";\n");
 	}
 	void setAngle(float angl)
 	{
 		if(angl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".angl\" %f;\n", angl);
+		writeFloat(mFile,"\tsetAttr \".angl\" ",angl,";\n");
 	}
 	void setFresnelRefractiveIndex(float frfi)
 	{
 		if(frfi == 6.0) return;
-		fprintf(mFile,"\tsetAttr \".frfi\" %f;\n", frfi);
+		writeFloat(mFile,"\tsetAttr \".frfi\" ",frfi,";\n");
 	}
 	void setAnisotropicReflectivity(bool arfl)
 	{
 		if(arfl == true) return;
-		fprintf(mFile,"\tsetAttr \".arfl\" %i;\n", arfl);
+		writeInt(mFile,"\tsetAttr \".arfl\" ",arfl,";\n");
 	}
 	void setMiReflectionBlur(float mircb)
 	{
 		if(mircb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mircb\" %f;\n", mircb);
+		writeFloat(mFile,"\tsetAttr \".mircb\" ",mircb,";\n");
 	}
 	void setMiReflectionRays(short mircr)
 	{
 		if(mircr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mircr\" %i;\n", mircr);
+		writeInt(mFile,"\tsetAttr \".mircr\" ",mircr,";\n");
 	}
 	void setMiAngle(float mia)
 	{
 		if(mia == 0) return;
-		fprintf(mFile,"\tsetAttr \".mia\" %f;\n", mia);
+		writeFloat(mFile,"\tsetAttr \".mia\" ",mia,";\n");
 	}
 	void setMiSpreadX(float misx)
 	{
 		if(misx == 10) return;
-		fprintf(mFile,"\tsetAttr \".misx\" %f;\n", misx);
+		writeFloat(mFile,"\tsetAttr \".misx\" ",misx,";\n");
 	}
 	void setMiSpreadY(float misy)
 	{
 		if(misy == 5) return;
-		fprintf(mFile,"\tsetAttr \".misy\" %f;\n", misy);
+		writeFloat(mFile,"\tsetAttr \".misy\" ",misy,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void getTangentUCamera()const
 	{
-		fprintf(mFile,"\"%s.utan\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utan\"");
 	}
 	void getTangentUCameraX()const
 	{
-		fprintf(mFile,"\"%s.utan.utnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utan.utnx\"");
 	}
 	void getTangentUCameraY()const
 	{
-		fprintf(mFile,"\"%s.utan.utny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utan.utny\"");
 	}
 	void getTangentUCameraZ()const
 	{
-		fprintf(mFile,"\"%s.utan.utnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utan.utnz\"");
 	}
 	void getTangentVCamera()const
 	{
-		fprintf(mFile,"\"%s.vtan\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtan\"");
 	}
 	void getTangentVCameraX()const
 	{
-		fprintf(mFile,"\"%s.vtan.vtnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtan.vtnx\"");
 	}
 	void getTangentVCameraY()const
 	{
-		fprintf(mFile,"\"%s.vtan.vtny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtan.vtny\"");
 	}
 	void getTangentVCameraZ()const
 	{
-		fprintf(mFile,"\"%s.vtan.vtnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtan.vtnz\"");
 	}
 	void getSpreadX()const
 	{
-		fprintf(mFile,"\"%s.sprx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sprx\"");
 	}
 	void getSpreadY()const
 	{
-		fprintf(mFile,"\"%s.spry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spry\"");
 	}
 	void getRoughness()const
 	{
-		fprintf(mFile,"\"%s.roug\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".roug\"");
 	}
 	void getAngle()const
 	{
-		fprintf(mFile,"\"%s.angl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".angl\"");
 	}
 	void getFresnelRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.frfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frfi\"");
 	}
 	void getAnisotropicReflectivity()const
 	{
-		fprintf(mFile,"\"%s.arfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".arfl\"");
 	}
 	void getMiReflectionBlur()const
 	{
-		fprintf(mFile,"\"%s.mircb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircb\"");
 	}
 	void getMiReflectionRays()const
 	{
-		fprintf(mFile,"\"%s.mircr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircr\"");
 	}
 	void getMiAngle()const
 	{
-		fprintf(mFile,"\"%s.mia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mia\"");
 	}
 	void getMiSpreadX()const
 	{
-		fprintf(mFile,"\"%s.misx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misx\"");
 	}
 	void getMiSpreadY()const
 	{
-		fprintf(mFile,"\"%s.misy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misy\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 protected:
 	Anisotropic(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
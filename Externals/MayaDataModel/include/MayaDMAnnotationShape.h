@@ -27,79 +27,79 @@ public:
 	void setText(const string& txt)
 	{
 		if(txt == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".txt\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".txt\" -type \"string\" ");
 		txt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDagObjectMatrix(size_t dom_i,const matrix& dom)
 	{
 		if(dom == identity) return;
-		fprintf(mFile,"\tsetAttr \".dom[%i]\" -type \"matrix\" ",dom_i);
+		writeInt(mFile,"\tsetAttr \".dom[",dom_i,"]\" -type \"matrix\" ");
 		dom.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDagObjectMatrix(size_t dom_start,size_t dom_end,matrix* dom)
 	{
-		fprintf(mFile,"\tsetAttr \".dom[%i:%i]\" ", dom_start,dom_end);
+		writeInt(mFile,"\tsetAttr \".dom[",dom_start); writeInt(mFile,":",dom_end,"]\" ");
 		size_t size = (dom_end-dom_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			dom[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDagObjectMatrix(size_t dom_start,size_t dom_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".dom[%i:%i]\"",dom_start,dom_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".dom[",dom_start); writeInt(mFile,":",dom_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendDagObjectMatrix(const matrix& dom)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		dom.write(mFile);
 	}
 	void endDagObjectMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplayArrow(bool daro)
 	{
 		if(daro == true) return;
-		fprintf(mFile,"\tsetAttr \".daro\" %i;\n", daro);
+		writeInt(mFile,"\tsetAttr \".daro\" ",daro,";\n");
 	}
 	void getText()const
 	{
-		fprintf(mFile,"\"%s.txt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txt\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.tp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.tp.tpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpx\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.tp.tpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpy\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.tp.tpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpz\"");
 	}
 	void getDagObjectMatrix(size_t dom_i)const
 	{
-		fprintf(mFile,"\"%s.dom[%i]\"",mName.c_str(),dom_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dom[",dom_i,"]\"");
 	}
 	void getDagObjectMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.dom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dom\"");
 	}
 	void getDisplayArrow()const
 	{
-		fprintf(mFile,"\"%s.daro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".daro\"");
 	}
 protected:
 	AnnotationShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
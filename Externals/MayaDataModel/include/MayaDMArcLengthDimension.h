@@ -26,11 +26,11 @@ public:
 
 	void getArcLength()const
 	{
-		fprintf(mFile,"\"%s.al\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al\"");
 	}
 	void getArcLengthInV()const
 	{
-		fprintf(mFile,"\"%s.alv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".alv\"");
 	}
 protected:
 	ArcLengthDimension(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
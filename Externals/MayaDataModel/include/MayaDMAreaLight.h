@@ -47,10 +47,10 @@ public:
 			short smapWindowYMax;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", smapWindowXMin);
-				fprintf(file,"%i ", smapWindowYMin);
-				fprintf(file,"%i ", smapWindowXMax);
-				fprintf(file,"%i", smapWindowYMax);
+				writeInt(file,"",smapWindowXMin," ");
+				writeInt(file,"",smapWindowYMin," ");
+				writeInt(file,"",smapWindowXMax," ");
+				writeInt(file,"",smapWindowYMax);
 			}
 		} smapWindow;
 		bool smapMerge;
@@ -64,41 +64,41 @@ public:
 		bool areaVisible;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miExportMrLight);
-			fprintf(file,"%i ", emitPhotons);
+			writeInt(file,"",miExportMrLight," ");
+			writeInt(file,"",emitPhotons," ");
 			energy.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", photonIntensity);
-			fprintf(file,"%f ", exponent);
-			fprintf(file,"%i ", causticPhotons);
-			fprintf(file,"%i ", causticPhotonsEmit);
-			fprintf(file,"%i ", globIllPhotons);
-			fprintf(file,"%i ", globIllPhotonsEmit);
-			fprintf(file,"%i ", shadowMap);
-			fprintf(file,"%i ", smapResolution);
-			fprintf(file,"%i ", smapSamples);
-			fprintf(file,"%f ", smapSoftness);
-			fprintf(file,"%f ", smapBias);
+			writeString(file," ");
+			writeFloat(file,"",photonIntensity," ");
+			writeFloat(file,"",exponent," ");
+			writeInt(file,"",causticPhotons," ");
+			writeInt(file,"",causticPhotonsEmit," ");
+			writeInt(file,"",globIllPhotons," ");
+			writeInt(file,"",globIllPhotonsEmit," ");
+			writeInt(file,"",shadowMap," ");
+			writeInt(file,"",smapResolution," ");
+			writeInt(file,"",smapSamples," ");
+			writeFloat(file,"",smapSoftness," ");
+			writeFloat(file,"",smapBias," ");
 			smapFilename.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", smapLightName);
-			fprintf(file,"%i ", smapSceneName);
-			fprintf(file,"%i ", smapFrameExt);
-			fprintf(file,"%i ", smapDetail);
-			fprintf(file,"%i ", smapDetailSamples);
-			fprintf(file,"%f ", smapDetailAccuracy);
-			fprintf(file,"%i ", smapDetailAlpha);
+			writeString(file," ");
+			writeInt(file,"",smapLightName," ");
+			writeInt(file,"",smapSceneName," ");
+			writeInt(file,"",smapFrameExt," ");
+			writeInt(file,"",smapDetail," ");
+			writeInt(file,"",smapDetailSamples," ");
+			writeFloat(file,"",smapDetailAccuracy," ");
+			writeInt(file,"",smapDetailAlpha," ");
 			smapWindow.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", smapMerge);
-			fprintf(file,"%i ", smapTrace);
-			fprintf(file,"%i ", areaLight);
-			fprintf(file,"%i ", areaType);
-			fprintf(file,"%f ", areaShapeIntensity);
-			fprintf(file,"%i ", areaHiSamples);
-			fprintf(file,"%i ", areaHiSampleLimit);
-			fprintf(file,"%i ", areaLoSamples);
-			fprintf(file,"%i ", areaVisible);
+			writeString(file," ");
+			writeInt(file,"",smapMerge," ");
+			writeInt(file,"",smapTrace," ");
+			writeInt(file,"",areaLight," ");
+			writeInt(file,"",areaType," ");
+			writeFloat(file,"",areaShapeIntensity," ");
+			writeInt(file,"",areaHiSamples," ");
+			writeInt(file,"",areaHiSampleLimit," ");
+			writeInt(file,"",areaLoSamples," ");
+			writeInt(file,"",areaVisible," ");
 		}
 	};
 public:
@@ -111,24 +111,24 @@ public:
 	void setPointWorld(const float3& pw)
 	{
 		if(pw == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
 		pw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointWorldX(float tx)
 	{
 		if(tx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.tx\" %f;\n", tx);
+		writeFloat(mFile,"\tsetAttr \".pw.tx\" ",tx,";\n");
 	}
 	void setPointWorldY(float ty)
 	{
 		if(ty == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.ty\" %f;\n", ty);
+		writeFloat(mFile,"\tsetAttr \".pw.ty\" ",ty,";\n");
 	}
 	void setPointWorldZ(float tz)
 	{
 		if(tz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.tz\" %f;\n", tz);
+		writeFloat(mFile,"\tsetAttr \".pw.tz\" ",tz,";\n");
 	}
 	void setObjectType(char ot)
 	{
@@ -137,424 +137,424 @@ public:
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiExportMrLight(bool milt)
 	{
 		if(milt == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.milt\" %i;\n", milt);
+		writeInt(mFile,"\tsetAttr \".mrc.milt\" ",milt,";\n");
 	}
 	void setEmitPhotons(bool phot)
 	{
 		if(phot == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.phot\" %i;\n", phot);
+		writeInt(mFile,"\tsetAttr \".mrc.phot\" ",phot,";\n");
 	}
 	void setEnergy(const float3& eng)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc.eng\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mrc.eng\" -type \"float3\" ");
 		eng.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnergyR(float engr)
 	{
 		if(engr == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engr\" %f;\n", engr);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engr\" ",engr,";\n");
 	}
 	void setEnergyG(float engg)
 	{
 		if(engg == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engg\" %f;\n", engg);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engg\" ",engg,";\n");
 	}
 	void setEnergyB(float engb)
 	{
 		if(engb == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engb\" %f;\n", engb);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engb\" ",engb,";\n");
 	}
 	void setPhotonIntensity(float phi)
 	{
 		if(phi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.phi\" %f;\n", phi);
+		writeFloat(mFile,"\tsetAttr \".mrc.phi\" ",phi,";\n");
 	}
 	void setExponent(float exp)
 	{
 		if(exp == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.exp\" %f;\n", exp);
+		writeFloat(mFile,"\tsetAttr \".mrc.exp\" ",exp,";\n");
 	}
 	void setCausticPhotons(int cph)
 	{
 		if(cph == 10000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.cph\" %i;\n", cph);
+		writeInt(mFile,"\tsetAttr \".mrc.cph\" ",cph,";\n");
 	}
 	void setCausticPhotonsEmit(int cphe)
 	{
 		if(cphe == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.cphe\" %i;\n", cphe);
+		writeInt(mFile,"\tsetAttr \".mrc.cphe\" ",cphe,";\n");
 	}
 	void setGlobIllPhotons(int gph)
 	{
 		if(gph == 10000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gph\" %i;\n", gph);
+		writeInt(mFile,"\tsetAttr \".mrc.gph\" ",gph,";\n");
 	}
 	void setGlobIllPhotonsEmit(int gphe)
 	{
 		if(gphe == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gphe\" %i;\n", gphe);
+		writeInt(mFile,"\tsetAttr \".mrc.gphe\" ",gphe,";\n");
 	}
 	void setShadowMap(bool usm)
 	{
 		if(usm == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.usm\" %i;\n", usm);
+		writeInt(mFile,"\tsetAttr \".mrc.usm\" ",usm,";\n");
 	}
 	void setSmapResolution(int smr)
 	{
 		if(smr == 256) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smr\" %i;\n", smr);
+		writeInt(mFile,"\tsetAttr \".mrc.smr\" ",smr,";\n");
 	}
 	void setSmapSamples(short smsa)
 	{
 		if(smsa == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smsa\" %i;\n", smsa);
+		writeInt(mFile,"\tsetAttr \".mrc.smsa\" ",smsa,";\n");
 	}
 	void setSmapSoftness(float smso)
 	{
 		if(smso == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smso\" %f;\n", smso);
+		writeFloat(mFile,"\tsetAttr \".mrc.smso\" ",smso,";\n");
 	}
 	void setSmapBias(float smb)
 	{
 		if(smb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smb\" %f;\n", smb);
+		writeFloat(mFile,"\tsetAttr \".mrc.smb\" ",smb,";\n");
 	}
 	void setSmapFilename(const string& smf)
 	{
 		if(smf == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".mrc.smf\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".mrc.smf\" -type \"string\" ");
 		smf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSmapLightName(bool smln)
 	{
 		if(smln == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smln\" %i;\n", smln);
+		writeInt(mFile,"\tsetAttr \".mrc.smln\" ",smln,";\n");
 	}
 	void setSmapSceneName(bool smsn)
 	{
 		if(smsn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smsn\" %i;\n", smsn);
+		writeInt(mFile,"\tsetAttr \".mrc.smsn\" ",smsn,";\n");
 	}
 	void setSmapFrameExt(bool smfe)
 	{
 		if(smfe == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smfe\" %i;\n", smfe);
+		writeInt(mFile,"\tsetAttr \".mrc.smfe\" ",smfe,";\n");
 	}
 	void setSmapDetail(bool smd)
 	{
 		if(smd == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smd\" %i;\n", smd);
+		writeInt(mFile,"\tsetAttr \".mrc.smd\" ",smd,";\n");
 	}
 	void setSmapDetailSamples(short sds)
 	{
 		if(sds == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sds\" %i;\n", sds);
+		writeInt(mFile,"\tsetAttr \".mrc.sds\" ",sds,";\n");
 	}
 	void setSmapDetailAccuracy(float sdac)
 	{
 		if(sdac == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sdac\" %f;\n", sdac);
+		writeFloat(mFile,"\tsetAttr \".mrc.sdac\" ",sdac,";\n");
 	}
 	void setSmapDetailAlpha(bool sdal)
 	{
 		if(sdal == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sdal\" %i;\n", sdal);
+		writeInt(mFile,"\tsetAttr \".mrc.sdal\" ",sdal,";\n");
 	}
 	void setSmapWindow(const MentalRayControls::SmapWindow& smw)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc.smw\" ");
+		writeString(mFile,"\tsetAttr \".mrc.smw\" ");
 		smw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSmapWindowXMin(short smxl)
 	{
 		if(smxl == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smw.smxl\" %i;\n", smxl);
+		writeInt(mFile,"\tsetAttr \".mrc.smw.smxl\" ",smxl,";\n");
 	}
 	void setSmapWindowYMin(short smyl)
 	{
 		if(smyl == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smw.smyl\" %i;\n", smyl);
+		writeInt(mFile,"\tsetAttr \".mrc.smw.smyl\" ",smyl,";\n");
 	}
 	void setSmapWindowXMax(short smxh)
 	{
 		if(smxh == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smw.smxh\" %i;\n", smxh);
+		writeInt(mFile,"\tsetAttr \".mrc.smw.smxh\" ",smxh,";\n");
 	}
 	void setSmapWindowYMax(short smyh)
 	{
 		if(smyh == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smw.smyh\" %i;\n", smyh);
+		writeInt(mFile,"\tsetAttr \".mrc.smw.smyh\" ",smyh,";\n");
 	}
 	void setSmapMerge(bool smm)
 	{
 		if(smm == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smm\" %i;\n", smm);
+		writeInt(mFile,"\tsetAttr \".mrc.smm\" ",smm,";\n");
 	}
 	void setSmapTrace(bool smt)
 	{
 		if(smt == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smt\" %i;\n", smt);
+		writeInt(mFile,"\tsetAttr \".mrc.smt\" ",smt,";\n");
 	}
 	void setAreaLight(bool algt)
 	{
 		if(algt == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.algt\" %i;\n", algt);
+		writeInt(mFile,"\tsetAttr \".mrc.algt\" ",algt,";\n");
 	}
 	void setAreaType(unsigned int atyp)
 	{
 		if(atyp == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.atyp\" %i;\n", atyp);
+		writeInt(mFile,"\tsetAttr \".mrc.atyp\" ",atyp,";\n");
 	}
 	void setAreaShapeIntensity(float alsi)
 	{
 		if(alsi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.alsi\" %f;\n", alsi);
+		writeFloat(mFile,"\tsetAttr \".mrc.alsi\" ",alsi,";\n");
 	}
 	void setAreaHiSamples(short ahs)
 	{
 		if(ahs == 8) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ahs\" %i;\n", ahs);
+		writeInt(mFile,"\tsetAttr \".mrc.ahs\" ",ahs,";\n");
 	}
 	void setAreaHiSampleLimit(short alev)
 	{
 		if(alev == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.alev\" %i;\n", alev);
+		writeInt(mFile,"\tsetAttr \".mrc.alev\" ",alev,";\n");
 	}
 	void setAreaLoSamples(short als)
 	{
 		if(als == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.als\" %i;\n", als);
+		writeInt(mFile,"\tsetAttr \".mrc.als\" ",als,";\n");
 	}
 	void setAreaVisible(bool avis)
 	{
 		if(avis == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.avis\" %i;\n", avis);
+		writeInt(mFile,"\tsetAttr \".mrc.avis\" ",avis,";\n");
 	}
 	void getLightGlow()const
 	{
-		fprintf(mFile,"\"%s.lg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lg\"");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.pw.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.tx\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.pw.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.ty\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.pw.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.tz\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getObjectType()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiExportMrLight()const
 	{
-		fprintf(mFile,"\"%s.mrc.milt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.milt\"");
 	}
 	void getMiLightShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.mils\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mils\"");
 	}
 	void getMiPhotonEmitter()const
 	{
-		fprintf(mFile,"\"%s.mrc.mipe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mipe\"");
 	}
 	void getEmitPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.phot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.phot\"");
 	}
 	void getEnergy()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng\"");
 	}
 	void getEnergyR()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engr\"");
 	}
 	void getEnergyG()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engg\"");
 	}
 	void getEnergyB()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engb\"");
 	}
 	void getPhotonIntensity()const
 	{
-		fprintf(mFile,"\"%s.mrc.phi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.phi\"");
 	}
 	void getExponent()const
 	{
-		fprintf(mFile,"\"%s.mrc.exp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.exp\"");
 	}
 	void getCausticPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.cph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.cph\"");
 	}
 	void getCausticPhotonsEmit()const
 	{
-		fprintf(mFile,"\"%s.mrc.cphe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.cphe\"");
 	}
 	void getGlobIllPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.gph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gph\"");
 	}
 	void getGlobIllPhotonsEmit()const
 	{
-		fprintf(mFile,"\"%s.mrc.gphe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gphe\"");
 	}
 	void getShadowMap()const
 	{
-		fprintf(mFile,"\"%s.mrc.usm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.usm\"");
 	}
 	void getSmapResolution()const
 	{
-		fprintf(mFile,"\"%s.mrc.smr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smr\"");
 	}
 	void getSmapSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.smsa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smsa\"");
 	}
 	void getSmapSoftness()const
 	{
-		fprintf(mFile,"\"%s.mrc.smso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smso\"");
 	}
 	void getSmapBias()const
 	{
-		fprintf(mFile,"\"%s.mrc.smb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smb\"");
 	}
 	void getSmapCamera()const
 	{
-		fprintf(mFile,"\"%s.mrc.smc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smc\"");
 	}
 	void getSmapFilename()const
 	{
-		fprintf(mFile,"\"%s.mrc.smf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smf\"");
 	}
 	void getSmapLightName()const
 	{
-		fprintf(mFile,"\"%s.mrc.smln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smln\"");
 	}
 	void getSmapSceneName()const
 	{
-		fprintf(mFile,"\"%s.mrc.smsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smsn\"");
 	}
 	void getSmapFrameExt()const
 	{
-		fprintf(mFile,"\"%s.mrc.smfe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smfe\"");
 	}
 	void getSmapDetail()const
 	{
-		fprintf(mFile,"\"%s.mrc.smd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smd\"");
 	}
 	void getSmapDetailSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.sds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sds\"");
 	}
 	void getSmapDetailAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.sdac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sdac\"");
 	}
 	void getSmapDetailAlpha()const
 	{
-		fprintf(mFile,"\"%s.mrc.sdal\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sdal\"");
 	}
 	void getSmapWindow()const
 	{
-		fprintf(mFile,"\"%s.mrc.smw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smw\"");
 	}
 	void getSmapWindowXMin()const
 	{
-		fprintf(mFile,"\"%s.mrc.smw.smxl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smw.smxl\"");
 	}
 	void getSmapWindowYMin()const
 	{
-		fprintf(mFile,"\"%s.mrc.smw.smyl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smw.smyl\"");
 	}
 	void getSmapWindowXMax()const
 	{
-		fprintf(mFile,"\"%s.mrc.smw.smxh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smw.smxh\"");
 	}
 	void getSmapWindowYMax()const
 	{
-		fprintf(mFile,"\"%s.mrc.smw.smyh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smw.smyh\"");
 	}
 	void getSmapMerge()const
 	{
-		fprintf(mFile,"\"%s.mrc.smm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smm\"");
 	}
 	void getSmapTrace()const
 	{
-		fprintf(mFile,"\"%s.mrc.smt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smt\"");
 	}
 	void getAreaLight()const
 	{
-		fprintf(mFile,"\"%s.mrc.algt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.algt\"");
 	}
 	void getAreaType()const
 	{
-		fprintf(mFile,"\"%s.mrc.atyp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.atyp\"");
 	}
 	void getAreaShapeIntensity()const
 	{
-		fprintf(mFile,"\"%s.mrc.alsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.alsi\"");
 	}
 	void getAreaHiSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.ahs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ahs\"");
 	}
 	void getAreaHiSampleLimit()const
 	{
-		fprintf(mFile,"\"%s.mrc.alev\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.alev\"");
 	}
 	void getAreaLoSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.als\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.als\"");
 	}
 	void getAreaVisible()const
 	{
-		fprintf(mFile,"\"%s.mrc.avis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.avis\"");
 	}
 	void getAreaObject()const
 	{
-		fprintf(mFile,"\"%s.mrc.aobj\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.aobj\"");
 	}
 protected:
 	AreaLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
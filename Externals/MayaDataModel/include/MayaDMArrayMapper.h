@@ -27,60 +27,60 @@ public:
 	void setMinValue(double min)
 	{
 		if(min == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".min\" %f;\n", min);
+		writeFloat(mFile,"\tsetAttr \".min\" ",min,";\n");
 	}
 	void setMaxValue(double max)
 	{
 		if(max == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".max\" %f;\n", max);
+		writeFloat(mFile,"\tsetAttr \".max\" ",max,";\n");
 	}
 	void getComputeNode()const
 	{
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getUCoordPP()const
 	{
-		fprintf(mFile,"\"%s.upp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upp\"");
 	}
 	void getVCoordPP()const
 	{
-		fprintf(mFile,"\"%s.vpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vpp\"");
 	}
 	void getMinValue()const
 	{
-		fprintf(mFile,"\"%s.min\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".min\"");
 	}
 	void getMaxValue()const
 	{
-		fprintf(mFile,"\"%s.max\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".max\"");
 	}
 	void getComputeNodeColor()const
 	{
-		fprintf(mFile,"\"%s.cnc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnc\"");
 	}
 	void getComputeNodeColorR()const
 	{
-		fprintf(mFile,"\"%s.cnc.cncr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnc.cncr\"");
 	}
 	void getComputeNodeColorG()const
 	{
-		fprintf(mFile,"\"%s.cnc.cncg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnc.cncg\"");
 	}
 	void getComputeNodeColorB()const
 	{
-		fprintf(mFile,"\"%s.cnc.cncb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnc.cncb\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.tim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tim\"");
 	}
 	void getOutColorPP()const
 	{
-		fprintf(mFile,"\"%s.ocpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocpp\"");
 	}
 	void getOutValuePP()const
 	{
-		fprintf(mFile,"\"%s.ovpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ovpp\"");
 	}
 protected:
 	ArrayMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
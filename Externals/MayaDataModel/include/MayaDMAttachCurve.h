@@ -27,86 +27,86 @@ public:
 	void setReverse1(bool rv1)
 	{
 		if(rv1 == false) return;
-		fprintf(mFile,"\tsetAttr \".rv1\" %i;\n", rv1);
+		writeInt(mFile,"\tsetAttr \".rv1\" ",rv1,";\n");
 	}
 	void setReverse2(bool rv2)
 	{
 		if(rv2 == false) return;
-		fprintf(mFile,"\tsetAttr \".rv2\" %i;\n", rv2);
+		writeInt(mFile,"\tsetAttr \".rv2\" ",rv2,";\n");
 	}
 	void setMethod(unsigned int m)
 	{
 		if(m == 0) return;
-		fprintf(mFile,"\tsetAttr \".m\" %i;\n", m);
+		writeInt(mFile,"\tsetAttr \".m\" ",m,";\n");
 	}
 	void setKeepMultipleKnots(bool kmk)
 	{
 		if(kmk == true) return;
-		fprintf(mFile,"\tsetAttr \".kmk\" %i;\n", kmk);
+		writeInt(mFile,"\tsetAttr \".kmk\" ",kmk,";\n");
 	}
 	void setBlendBias(double bb)
 	{
 		if(bb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".bb\" %f;\n", bb);
+		writeFloat(mFile,"\tsetAttr \".bb\" ",bb,";\n");
 	}
 	void setBlendKnotInsertion(bool bki)
 	{
 		if(bki == false) return;
-		fprintf(mFile,"\tsetAttr \".bki\" %i;\n", bki);
+		writeInt(mFile,"\tsetAttr \".bki\" ",bki,";\n");
 	}
 	void setParameter(double p)
 	{
 		if(p == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".p\" %f;\n", p);
+		writeFloat(mFile,"\tsetAttr \".p\" ",p,";\n");
 	}
 	void getInputCurve1()const
 	{
-		fprintf(mFile,"\"%s.ic1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic1\"");
 	}
 	void getInputCurve2()const
 	{
-		fprintf(mFile,"\"%s.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2\"");
 	}
 	void getInputCurves(size_t ics_i)const
 	{
-		fprintf(mFile,"\"%s.ics[%i]\"",mName.c_str(),ics_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ics[",ics_i,"]\"");
 	}
 	void getInputCurves()const
 	{
 
-		fprintf(mFile,"\"%s.ics\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ics\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getReverse1()const
 	{
-		fprintf(mFile,"\"%s.rv1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rv1\"");
 	}
 	void getReverse2()const
 	{
-		fprintf(mFile,"\"%s.rv2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rv2\"");
 	}
 	void getMethod()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getKeepMultipleKnots()const
 	{
-		fprintf(mFile,"\"%s.kmk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kmk\"");
 	}
 	void getBlendBias()const
 	{
-		fprintf(mFile,"\"%s.bb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb\"");
 	}
 	void getBlendKnotInsertion()const
 	{
-		fprintf(mFile,"\"%s.bki\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bki\"");
 	}
 	void getParameter()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 protected:
 	AttachCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,113 +27,113 @@ public:
 	void setMethod(unsigned int m)
 	{
 		if(m == 0) return;
-		fprintf(mFile,"\tsetAttr \".m\" %i;\n", m);
+		writeInt(mFile,"\tsetAttr \".m\" ",m,";\n");
 	}
 	void setDirectionU(bool du)
 	{
 		if(du == true) return;
-		fprintf(mFile,"\tsetAttr \".du\" %i;\n", du);
+		writeInt(mFile,"\tsetAttr \".du\" ",du,";\n");
 	}
 	void setReverse1(bool rv1)
 	{
 		if(rv1 == false) return;
-		fprintf(mFile,"\tsetAttr \".rv1\" %i;\n", rv1);
+		writeInt(mFile,"\tsetAttr \".rv1\" ",rv1,";\n");
 	}
 	void setReverse2(bool rv2)
 	{
 		if(rv2 == false) return;
-		fprintf(mFile,"\tsetAttr \".rv2\" %i;\n", rv2);
+		writeInt(mFile,"\tsetAttr \".rv2\" ",rv2,";\n");
 	}
 	void setSwap1(bool sw1)
 	{
 		if(sw1 == false) return;
-		fprintf(mFile,"\tsetAttr \".sw1\" %i;\n", sw1);
+		writeInt(mFile,"\tsetAttr \".sw1\" ",sw1,";\n");
 	}
 	void setSwap2(bool sw2)
 	{
 		if(sw2 == false) return;
-		fprintf(mFile,"\tsetAttr \".sw2\" %i;\n", sw2);
+		writeInt(mFile,"\tsetAttr \".sw2\" ",sw2,";\n");
 	}
 	void setTwist(bool tw)
 	{
 		if(tw == false) return;
-		fprintf(mFile,"\tsetAttr \".tw\" %i;\n", tw);
+		writeInt(mFile,"\tsetAttr \".tw\" ",tw,";\n");
 	}
 	void setBlendBias(double bb)
 	{
 		if(bb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".bb\" %f;\n", bb);
+		writeFloat(mFile,"\tsetAttr \".bb\" ",bb,";\n");
 	}
 	void setBlendKnotInsertion(bool bki)
 	{
 		if(bki == false) return;
-		fprintf(mFile,"\tsetAttr \".bki\" %i;\n", bki);
+		writeInt(mFile,"\tsetAttr \".bki\" ",bki,";\n");
 	}
 	void setParameter(double p)
 	{
 		if(p == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".p\" %f;\n", p);
+		writeFloat(mFile,"\tsetAttr \".p\" ",p,";\n");
 	}
 	void setKeepMultipleKnots(bool kmk)
 	{
 		if(kmk == true) return;
-		fprintf(mFile,"\tsetAttr \".kmk\" %i;\n", kmk);
+		writeInt(mFile,"\tsetAttr \".kmk\" ",kmk,";\n");
 	}
 	void getInputSurface1()const
 	{
-		fprintf(mFile,"\"%s.is1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is1\"");
 	}
 	void getInputSurface2()const
 	{
-		fprintf(mFile,"\"%s.is2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is2\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getMethod()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getDirectionU()const
 	{
-		fprintf(mFile,"\"%s.du\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".du\"");
 	}
 	void getReverse1()const
 	{
-		fprintf(mFile,"\"%s.rv1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rv1\"");
 	}
 	void getReverse2()const
 	{
-		fprintf(mFile,"\"%s.rv2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rv2\"");
 	}
 	void getSwap1()const
 	{
-		fprintf(mFile,"\"%s.sw1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sw1\"");
 	}
 	void getSwap2()const
 	{
-		fprintf(mFile,"\"%s.sw2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sw2\"");
 	}
 	void getTwist()const
 	{
-		fprintf(mFile,"\"%s.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tw\"");
 	}
 	void getBlendBias()const
 	{
-		fprintf(mFile,"\"%s.bb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb\"");
 	}
 	void getBlendKnotInsertion()const
 	{
-		fprintf(mFile,"\"%s.bki\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bki\"");
 	}
 	void getParameter()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getKeepMultipleKnots()const
 	{
-		fprintf(mFile,"\"%s.kmk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kmk\"");
 	}
 protected:
 	AttachSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
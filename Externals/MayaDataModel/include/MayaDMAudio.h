@@ -27,31 +27,31 @@ public:
 	void setOffset(double o)
 	{
 		if(o == 0) return;
-		fprintf(mFile,"\tsetAttr \".o\" %f;\n", o);
+		writeFloat(mFile,"\tsetAttr \".o\" ",o,";\n");
 	}
 	void setFilename(const string& f)
 	{
 		if(f == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".f\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".f\" -type \"string\" ");
 		f.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOrder(int r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %i;\n", r);
+		writeInt(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getFilename()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getOrder()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 protected:
 	Audio(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
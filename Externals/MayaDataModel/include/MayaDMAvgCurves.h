@@ -27,50 +27,50 @@ public:
 	void setWeight1(double w1)
 	{
 		if(w1 == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".w1\" %f;\n", w1);
+		writeFloat(mFile,"\tsetAttr \".w1\" ",w1,";\n");
 	}
 	void setWeight2(double w2)
 	{
 		if(w2 == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".w2\" %f;\n", w2);
+		writeFloat(mFile,"\tsetAttr \".w2\" ",w2,";\n");
 	}
 	void setAutomaticWeight(bool aw)
 	{
 		if(aw == true) return;
-		fprintf(mFile,"\tsetAttr \".aw\" %i;\n", aw);
+		writeInt(mFile,"\tsetAttr \".aw\" ",aw,";\n");
 	}
 	void setNormalizeWeights(bool nw)
 	{
 		if(nw == true) return;
-		fprintf(mFile,"\tsetAttr \".nw\" %i;\n", nw);
+		writeInt(mFile,"\tsetAttr \".nw\" ",nw,";\n");
 	}
 	void getInputCurve1()const
 	{
-		fprintf(mFile,"\"%s.ic1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic1\"");
 	}
 	void getInputCurve2()const
 	{
-		fprintf(mFile,"\"%s.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2\"");
 	}
 	void getWeight1()const
 	{
-		fprintf(mFile,"\"%s.w1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w1\"");
 	}
 	void getWeight2()const
 	{
-		fprintf(mFile,"\"%s.w2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w2\"");
 	}
 	void getAutomaticWeight()const
 	{
-		fprintf(mFile,"\"%s.aw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aw\"");
 	}
 	void getNormalizeWeights()const
 	{
-		fprintf(mFile,"\"%s.nw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nw\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	AvgCurves(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
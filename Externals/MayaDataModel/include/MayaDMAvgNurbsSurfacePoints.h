@@ -27,12 +27,12 @@ public:
 		void write(FILE* file) const
 		{
 			inputSurface.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", weight);
-			fprintf(file,"%f ", parameterU);
-			fprintf(file,"%f ", parameterV);
-			fprintf(file,"%i ", cvIthIndex);
-			fprintf(file,"%i", cvJthIndex);
+			writeString(file," ");
+			writeFloat(file,"",weight," ");
+			writeFloat(file,"",parameterU," ");
+			writeFloat(file,"",parameterV," ");
+			writeInt(file,"",cvIthIndex," ");
+			writeInt(file,"",cvJthIndex);
 		}
 	};
 	struct Result{
@@ -49,155 +49,155 @@ public:
 
 	void setSurfacePoint(size_t sp_i,const SurfacePoint& sp)
 	{
-		fprintf(mFile,"\tsetAttr \".sp[%i]\" ",sp_i);
+		writeInt(mFile,"\tsetAttr \".sp[",sp_i,"]\" ");
 		sp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSurfacePoint(size_t sp_start,size_t sp_end,SurfacePoint* sp)
 	{
-		fprintf(mFile,"\tsetAttr \".sp[%i:%i]\" ", sp_start,sp_end);
+		writeInt(mFile,"\tsetAttr \".sp[",sp_start); writeInt(mFile,":",sp_end,"]\" ");
 		size_t size = (sp_end-sp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			sp[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSurfacePoint(size_t sp_start,size_t sp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sp[%i:%i]\"",sp_start,sp_end);
-		fprintf(mFile," -type \"SurfacePoint\" ");
+		writeInt(mFile,"\tsetAttr \".sp[",sp_start); writeInt(mFile,":",sp_end,"]\"");
+		writeString(mFile," -type \"SurfacePoint\" ");
 	}
 	void appendSurfacePoint(const SurfacePoint& sp)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		sp.write(mFile);
 	}
 	void endSurfacePoint()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputSurface(size_t sp_i,const nurbsSurface& is)
 	{
-		fprintf(mFile,"\tsetAttr \".sp[%i].is\" -type \"nurbsSurface\" ",sp_i);
+		writeInt(mFile,"\tsetAttr \".sp[",sp_i,"].is\" -type \"nurbsSurface\" ");
 		is.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeight(size_t sp_i,double wt)
 	{
 		if(wt == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sp[%i].wt\" %f;\n", sp_i,wt);
+		writeInt(mFile,"\tsetAttr \".sp[",sp_i); writeFloat(mFile,"].wt\" ",wt,";\n");
 	}
 	void setParameterU(size_t sp_i,double u)
 	{
 		if(u == -1000.0) return;
-		fprintf(mFile,"\tsetAttr \".sp[%i].u\" %f;\n", sp_i,u);
+		writeInt(mFile,"\tsetAttr \".sp[",sp_i); writeFloat(mFile,"].u\" ",u,";\n");
 	}
 	void setParameterV(size_t sp_i,double v)
 	{
 		if(v == -1000.0) return;
-		fprintf(mFile,"\tsetAttr \".sp[%i].v\" %f;\n", sp_i,v);
+		writeInt(mFile,"\tsetAttr \".sp[",sp_i); writeFloat(mFile,"].v\" ",v,";\n");
 	}
 	void setCvIthIndex(size_t sp_i,int ci)
 	{
 		if(ci == -1) return;
-		fprintf(mFile,"\tsetAttr \".sp[%i].ci\" %i;\n", sp_i,ci);
+		writeInt(mFile,"\tsetAttr \".sp[",sp_i); writeInt(mFile,"].ci\" ",ci,";\n");
 	}
 	void setCvJthIndex(size_t sp_i,int cj)
 	{
 		if(cj == -1) return;
-		fprintf(mFile,"\tsetAttr \".sp[%i].cj\" %i;\n", sp_i,cj);
+		writeInt(mFile,"\tsetAttr \".sp[",sp_i); writeInt(mFile,"].cj\" ",cj,";\n");
 	}
 	void getInputSurface(size_t sp_i)const
 	{
-		fprintf(mFile,"\"%s.sp[%i].is\"",mName.c_str(),sp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sp[",sp_i,"].is\"");
 	}
 	void getInputSurface()const
 	{
 
-		fprintf(mFile,"\"%s.sp.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.is\"");
 	}
 	void getWeight(size_t sp_i)const
 	{
-		fprintf(mFile,"\"%s.sp[%i].wt\"",mName.c_str(),sp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sp[",sp_i,"].wt\"");
 	}
 	void getWeight()const
 	{
 
-		fprintf(mFile,"\"%s.sp.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.wt\"");
 	}
 	void getParameterU(size_t sp_i)const
 	{
-		fprintf(mFile,"\"%s.sp[%i].u\"",mName.c_str(),sp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sp[",sp_i,"].u\"");
 	}
 	void getParameterU()const
 	{
 
-		fprintf(mFile,"\"%s.sp.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.u\"");
 	}
 	void getParameterV(size_t sp_i)const
 	{
-		fprintf(mFile,"\"%s.sp[%i].v\"",mName.c_str(),sp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sp[",sp_i,"].v\"");
 	}
 	void getParameterV()const
 	{
 
-		fprintf(mFile,"\"%s.sp.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.v\"");
 	}
 	void getCvIthIndex(size_t sp_i)const
 	{
-		fprintf(mFile,"\"%s.sp[%i].ci\"",mName.c_str(),sp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sp[",sp_i,"].ci\"");
 	}
 	void getCvIthIndex()const
 	{
 
-		fprintf(mFile,"\"%s.sp.ci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.ci\"");
 	}
 	void getCvJthIndex(size_t sp_i)const
 	{
-		fprintf(mFile,"\"%s.sp[%i].cj\"",mName.c_str(),sp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sp[",sp_i,"].cj\"");
 	}
 	void getCvJthIndex()const
 	{
 
-		fprintf(mFile,"\"%s.sp.cj\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.cj\"");
 	}
 	void getResult()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.r.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.r.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.px\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.r.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.py\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.r.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.pz\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.r.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.r.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.nx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.r.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.ny\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.r.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.nz\"");
 	}
 protected:
 	AvgNurbsSurfacePoints(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
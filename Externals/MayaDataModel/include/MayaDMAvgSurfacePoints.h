@@ -32,167 +32,167 @@ public:
 	void setWeight(size_t wt_i,double wt)
 	{
 		if(wt == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".wt[%i]\" %f;\n", wt_i,wt);
+		writeInt(mFile,"\tsetAttr \".wt[",wt_i); writeFloat(mFile,"]\" ",wt,";\n");
 	}
 	void setWeight(size_t wt_start,size_t wt_end,double* wt)
 	{
-		fprintf(mFile,"\tsetAttr \".wt[%i:%i]\" ", wt_start,wt_end);
+		writeInt(mFile,"\tsetAttr \".wt[",wt_start); writeInt(mFile,":",wt_end,"]\" ");
 		size_t size = (wt_end-wt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",wt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",wt[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWeight(size_t wt_start,size_t wt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wt[%i:%i]\"",wt_start,wt_end);
+		writeInt(mFile,"\tsetAttr \".wt[",wt_start); writeInt(mFile,":",wt_end,"]\"");
 	}
 	void appendWeight(double wt)const
 	{
-		fprintf(mFile," %f",wt);
+		writeFloat(mFile," ",wt);
 	}
 	void endWeight()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParameterU(size_t u_i,double u)
 	{
 		if(u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".u[%i]\" %f;\n", u_i,u);
+		writeInt(mFile,"\tsetAttr \".u[",u_i); writeFloat(mFile,"]\" ",u,";\n");
 	}
 	void setParameterU(size_t u_start,size_t u_end,double* u)
 	{
-		fprintf(mFile,"\tsetAttr \".u[%i:%i]\" ", u_start,u_end);
+		writeInt(mFile,"\tsetAttr \".u[",u_start); writeInt(mFile,":",u_end,"]\" ");
 		size_t size = (u_end-u_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",u[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",u[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startParameterU(size_t u_start,size_t u_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".u[%i:%i]\"",u_start,u_end);
+		writeInt(mFile,"\tsetAttr \".u[",u_start); writeInt(mFile,":",u_end,"]\"");
 	}
 	void appendParameterU(double u)const
 	{
-		fprintf(mFile," %f",u);
+		writeFloat(mFile," ",u);
 	}
 	void endParameterU()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParameterV(size_t v_i,double v)
 	{
 		if(v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v[%i]\" %f;\n", v_i,v);
+		writeInt(mFile,"\tsetAttr \".v[",v_i); writeFloat(mFile,"]\" ",v,";\n");
 	}
 	void setParameterV(size_t v_start,size_t v_end,double* v)
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
+		writeInt(mFile,"\tsetAttr \".v[",v_start); writeInt(mFile,":",v_end,"]\" ");
 		size_t size = (v_end-v_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",v[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startParameterV(size_t v_start,size_t v_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i:%i]\"",v_start,v_end);
+		writeInt(mFile,"\tsetAttr \".v[",v_start); writeInt(mFile,":",v_end,"]\"");
 	}
 	void appendParameterV(double v)const
 	{
-		fprintf(mFile," %f",v);
+		writeFloat(mFile," ",v);
 	}
 	void endParameterV()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTurnOnPercentage(bool top)
 	{
 		if(top == false) return;
-		fprintf(mFile,"\tsetAttr \".top\" %i;\n", top);
+		writeInt(mFile,"\tsetAttr \".top\" ",top,";\n");
 	}
 	void getInputSurfaces(size_t is_i)const
 	{
-		fprintf(mFile,"\"%s.is[%i]\"",mName.c_str(),is_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".is[",is_i,"]\"");
 	}
 	void getInputSurfaces()const
 	{
 
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getWeight(size_t wt_i)const
 	{
-		fprintf(mFile,"\"%s.wt[%i]\"",mName.c_str(),wt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wt[",wt_i,"]\"");
 	}
 	void getWeight()const
 	{
 
-		fprintf(mFile,"\"%s.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wt\"");
 	}
 	void getParameterU(size_t u_i)const
 	{
-		fprintf(mFile,"\"%s.u[%i]\"",mName.c_str(),u_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".u[",u_i,"]\"");
 	}
 	void getParameterU()const
 	{
 
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getParameterV(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i]\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"]\"");
 	}
 	void getParameterV()const
 	{
 
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getTurnOnPercentage()const
 	{
-		fprintf(mFile,"\"%s.top\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".top\"");
 	}
 	void getResult()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.r.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.r.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.px\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.r.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.py\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.r.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.pz\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.r.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.r.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.nx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.r.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.ny\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.r.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.nz\"");
 	}
 protected:
 	AvgSurfacePoints(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,69 +27,69 @@ public:
 	void setBakeAlpha(bool alpha)
 	{
 		if(alpha == 0) return;
-		fprintf(mFile,"\tsetAttr \".alpha\" %i;\n", alpha);
+		writeInt(mFile,"\tsetAttr \".alpha\" ",alpha,";\n");
 	}
 	void setAlphaMode(unsigned int mode)
 	{
 		if(mode == 1) return;
-		fprintf(mFile,"\tsetAttr \".mode\" %i;\n", mode);
+		writeInt(mFile,"\tsetAttr \".mode\" ",mode,";\n");
 	}
 	void setOcclusionRays(int mor)
 	{
 		if(mor == 64) return;
-		fprintf(mFile,"\tsetAttr \".mor\" %i;\n", mor);
+		writeInt(mFile,"\tsetAttr \".mor\" ",mor,";\n");
 	}
 	void setOcclusionFalloff(float mof)
 	{
 		if(mof == 0) return;
-		fprintf(mFile,"\tsetAttr \".mof\" %f;\n", mof);
+		writeFloat(mFile,"\tsetAttr \".mof\" ",mof,";\n");
 	}
 	void setColorMode(unsigned int clm)
 	{
 		if(clm == 0) return;
-		fprintf(mFile,"\tsetAttr \".clm\" %i;\n", clm);
+		writeInt(mFile,"\tsetAttr \".clm\" ",clm,";\n");
 	}
 	void setOrthogonalReflection(bool orf)
 	{
 		if(orf == 0) return;
-		fprintf(mFile,"\tsetAttr \".orf\" %i;\n", orf);
+		writeInt(mFile,"\tsetAttr \".orf\" ",orf,";\n");
 	}
 	void setNormalDirection(unsigned int ndr)
 	{
 		if(ndr == 1) return;
-		fprintf(mFile,"\tsetAttr \".ndr\" %i;\n", ndr);
+		writeInt(mFile,"\tsetAttr \".ndr\" ",ndr,";\n");
 	}
 	void getBakeAlpha()const
 	{
-		fprintf(mFile,"\"%s.alpha\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".alpha\"");
 	}
 	void getAlphaMode()const
 	{
-		fprintf(mFile,"\"%s.mode\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mode\"");
 	}
 	void getOcclusionRays()const
 	{
-		fprintf(mFile,"\"%s.mor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mor\"");
 	}
 	void getOcclusionFalloff()const
 	{
-		fprintf(mFile,"\"%s.mof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mof\"");
 	}
 	void getColorMode()const
 	{
-		fprintf(mFile,"\"%s.clm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clm\"");
 	}
 	void getOrthogonalReflection()const
 	{
-		fprintf(mFile,"\"%s.orf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".orf\"");
 	}
 	void getNormalDirection()const
 	{
-		fprintf(mFile,"\"%s.ndr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ndr\"");
 	}
 	void getCustomShader()const
 	{
-		fprintf(mFile,"\"%s.csh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csh\"");
 	}
 protected:
 	BakeSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setMaxCreated(int mc)
 	{
 		if(mc == -1) return;
-		fprintf(mFile,"\tsetAttr \".mc\" %i;\n", mc);
+		writeInt(mFile,"\tsetAttr \".mc\" ",mc,";\n");
 	}
 	void getMaxCreated()const
 	{
-		fprintf(mFile,"\"%s.mc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mc\"");
 	}
 protected:
 	BaseGeometryVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
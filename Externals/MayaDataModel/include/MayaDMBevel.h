@@ -27,94 +27,94 @@ public:
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setWidth(double w)
 	{
 		if(w == 0) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setDepth(double d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setExtrudeDepth(double ed)
 	{
 		if(ed == 1) return;
-		fprintf(mFile,"\tsetAttr \".ed\" %f;\n", ed);
+		writeFloat(mFile,"\tsetAttr \".ed\" ",ed,";\n");
 	}
 	void setCornerType(unsigned int ct)
 	{
 		if(ct == 2) return;
-		fprintf(mFile,"\tsetAttr \".ct\" %i;\n", ct);
+		writeInt(mFile,"\tsetAttr \".ct\" ",ct,";\n");
 	}
 	void setNumberOfSides(int ns)
 	{
 		if(ns == 4) return;
-		fprintf(mFile,"\tsetAttr \".ns\" %i;\n", ns);
+		writeInt(mFile,"\tsetAttr \".ns\" ",ns,";\n");
 	}
 	void setBevelShapeType(unsigned int bst)
 	{
 		if(bst == 1) return;
-		fprintf(mFile,"\tsetAttr \".bst\" %i;\n", bst);
+		writeInt(mFile,"\tsetAttr \".bst\" ",bst,";\n");
 	}
 	void setJoinSurfaces(bool js)
 	{
 		if(js == true) return;
-		fprintf(mFile,"\tsetAttr \".js\" %i;\n", js);
+		writeInt(mFile,"\tsetAttr \".js\" ",js,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getUseDirectionCurve()const
 	{
-		fprintf(mFile,"\"%s.udc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udc\"");
 	}
 	void getOutputSurface1()const
 	{
-		fprintf(mFile,"\"%s.os1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os1\"");
 	}
 	void getOutputSurface2()const
 	{
-		fprintf(mFile,"\"%s.os2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os2\"");
 	}
 	void getOutputSurface3()const
 	{
-		fprintf(mFile,"\"%s.os3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os3\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getWidth()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getExtrudeDepth()const
 	{
-		fprintf(mFile,"\"%s.ed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed\"");
 	}
 	void getCornerType()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getNumberOfSides()const
 	{
-		fprintf(mFile,"\"%s.ns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ns\"");
 	}
 	void getBevelShapeType()const
 	{
-		fprintf(mFile,"\"%s.bst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bst\"");
 	}
 	void getJoinSurfaces()const
 	{
-		fprintf(mFile,"\"%s.js\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".js\"");
 	}
 protected:
 	Bevel(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
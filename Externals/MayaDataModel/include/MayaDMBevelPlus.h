@@ -27,256 +27,256 @@ public:
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setWidth(double w)
 	{
 		if(w == 0) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setDepth(double d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setExtrudeDepth(double ed)
 	{
 		if(ed == 0) return;
-		fprintf(mFile,"\tsetAttr \".ed\" %f;\n", ed);
+		writeFloat(mFile,"\tsetAttr \".ed\" ",ed,";\n");
 	}
 	void setNumberOfSides(int ns)
 	{
 		if(ns == 4) return;
-		fprintf(mFile,"\tsetAttr \".ns\" %i;\n", ns);
+		writeInt(mFile,"\tsetAttr \".ns\" ",ns,";\n");
 	}
 	void setCapSides(int cap)
 	{
 		if(cap == 1) return;
-		fprintf(mFile,"\tsetAttr \".cap\" %i;\n", cap);
+		writeInt(mFile,"\tsetAttr \".cap\" ",cap,";\n");
 	}
 	void setJoinSurfaces(bool js)
 	{
 		if(js == true) return;
-		fprintf(mFile,"\tsetAttr \".js\" %i;\n", js);
+		writeInt(mFile,"\tsetAttr \".js\" ",js,";\n");
 	}
 	void setOrderedCurves(bool oc)
 	{
 		if(oc == false) return;
-		fprintf(mFile,"\tsetAttr \".oc\" %i;\n", oc);
+		writeInt(mFile,"\tsetAttr \".oc\" ",oc,";\n");
 	}
 	void setNormalsOutwards(bool no)
 	{
 		if(no == false) return;
-		fprintf(mFile,"\tsetAttr \".no\" %i;\n", no);
+		writeInt(mFile,"\tsetAttr \".no\" ",no,";\n");
 	}
 	void setPolyOutMethod(unsigned int pom)
 	{
 		if(pom == 0) return;
-		fprintf(mFile,"\tsetAttr \".pom\" %i;\n", pom);
+		writeInt(mFile,"\tsetAttr \".pom\" ",pom,";\n");
 	}
 	void setPolyOutCount(int poc)
 	{
 		if(poc == 200) return;
-		fprintf(mFile,"\tsetAttr \".poc\" %i;\n", poc);
+		writeInt(mFile,"\tsetAttr \".poc\" ",poc,";\n");
 	}
 	void setPolyOutExtrusionType(unsigned int pet)
 	{
 		if(pet == 1) return;
-		fprintf(mFile,"\tsetAttr \".pet\" %i;\n", pet);
+		writeInt(mFile,"\tsetAttr \".pet\" ",pet,";\n");
 	}
 	void setPolyOutExtrusionSamples(int pes)
 	{
 		if(pes == 2) return;
-		fprintf(mFile,"\tsetAttr \".pes\" %i;\n", pes);
+		writeInt(mFile,"\tsetAttr \".pes\" ",pes,";\n");
 	}
 	void setPolyOutCurveType(unsigned int pct)
 	{
 		if(pct == 1) return;
-		fprintf(mFile,"\tsetAttr \".pct\" %i;\n", pct);
+		writeInt(mFile,"\tsetAttr \".pct\" ",pct,";\n");
 	}
 	void setPolyOutCurveSamples(int pcs)
 	{
 		if(pcs == 6) return;
-		fprintf(mFile,"\tsetAttr \".pcs\" %i;\n", pcs);
+		writeInt(mFile,"\tsetAttr \".pcs\" ",pcs,";\n");
 	}
 	void setPolyOutUseChordHeight(bool uch)
 	{
 		if(uch == false) return;
-		fprintf(mFile,"\tsetAttr \".uch\" %i;\n", uch);
+		writeInt(mFile,"\tsetAttr \".uch\" ",uch,";\n");
 	}
 	void setPolyOutChordHeight(double cht)
 	{
 		if(cht == 0) return;
-		fprintf(mFile,"\tsetAttr \".cht\" %f;\n", cht);
+		writeFloat(mFile,"\tsetAttr \".cht\" ",cht,";\n");
 	}
 	void setPolyOutUseChordHeightRatio(bool ucr)
 	{
 		if(ucr == true) return;
-		fprintf(mFile,"\tsetAttr \".ucr\" %i;\n", ucr);
+		writeInt(mFile,"\tsetAttr \".ucr\" ",ucr,";\n");
 	}
 	void setPolyOutChordHeightRatio(double chr)
 	{
 		if(chr == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".chr\" %f;\n", chr);
+		writeFloat(mFile,"\tsetAttr \".chr\" ",chr,";\n");
 	}
 	void getInputCurves(size_t ics_i)const
 	{
-		fprintf(mFile,"\"%s.ics[%i]\"",mName.c_str(),ics_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ics[",ics_i,"]\"");
 	}
 	void getInputCurves()const
 	{
 
-		fprintf(mFile,"\"%s.ics\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ics\"");
 	}
 	void getOuterStyleCurve()const
 	{
-		fprintf(mFile,"\"%s.osc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".osc\"");
 	}
 	void getInnerStyleCurve()const
 	{
-		fprintf(mFile,"\"%s.isc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isc\"");
 	}
 	void getOutputPoly()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getStartCapSurface()const
 	{
-		fprintf(mFile,"\"%s.scs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scs\"");
 	}
 	void getEndCapSurface()const
 	{
-		fprintf(mFile,"\"%s.ecs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecs\"");
 	}
 	void getOutputSurfaces(size_t os1_i)const
 	{
-		fprintf(mFile,"\"%s.os1[%i]\"",mName.c_str(),os1_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".os1[",os1_i,"]\"");
 	}
 	void getOutputSurfaces()const
 	{
 
-		fprintf(mFile,"\"%s.os1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os1\"");
 	}
 	void getCount(size_t c_i)const
 	{
-		fprintf(mFile,"\"%s.c[%i]\"",mName.c_str(),c_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".c[",c_i,"]\"");
 	}
 	void getCount()const
 	{
 
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getPosition(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getPosition()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPositionX(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].px\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].px\"");
 	}
 	void getPositionX()const
 	{
 
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPositionY(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].py\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].py\"");
 	}
 	void getPositionY()const
 	{
 
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPositionZ(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].pz\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].pz\"");
 	}
 	void getPositionZ()const
 	{
 
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getWidth()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getExtrudeDepth()const
 	{
-		fprintf(mFile,"\"%s.ed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed\"");
 	}
 	void getNumberOfSides()const
 	{
-		fprintf(mFile,"\"%s.ns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ns\"");
 	}
 	void getCapSides()const
 	{
-		fprintf(mFile,"\"%s.cap\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cap\"");
 	}
 	void getJoinSurfaces()const
 	{
-		fprintf(mFile,"\"%s.js\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".js\"");
 	}
 	void getOrderedCurves()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getNormalsOutwards()const
 	{
-		fprintf(mFile,"\"%s.no\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".no\"");
 	}
 	void getPolyOutMethod()const
 	{
-		fprintf(mFile,"\"%s.pom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pom\"");
 	}
 	void getPolyOutCount()const
 	{
-		fprintf(mFile,"\"%s.poc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".poc\"");
 	}
 	void getPolyOutExtrusionType()const
 	{
-		fprintf(mFile,"\"%s.pet\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pet\"");
 	}
 	void getPolyOutExtrusionSamples()const
 	{
-		fprintf(mFile,"\"%s.pes\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pes\"");
 	}
 	void getPolyOutCurveType()const
 	{
-		fprintf(mFile,"\"%s.pct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pct\"");
 	}
 	void getPolyOutCurveSamples()const
 	{
-		fprintf(mFile,"\"%s.pcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcs\"");
 	}
 	void getPolyOutUseChordHeight()const
 	{
-		fprintf(mFile,"\"%s.uch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uch\"");
 	}
 	void getPolyOutChordHeight()const
 	{
-		fprintf(mFile,"\"%s.cht\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cht\"");
 	}
 	void getPolyOutUseChordHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.ucr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ucr\"");
 	}
 	void getPolyOutChordHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.chr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chr\"");
 	}
 protected:
 	BevelPlus(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,27 +27,27 @@ public:
 	void setTransformMode(unsigned int tm)
 	{
 		if(tm == 0) return;
-		fprintf(mFile,"\tsetAttr \".tm\" %i;\n", tm);
+		writeInt(mFile,"\tsetAttr \".tm\" ",tm,";\n");
 	}
 	void getInputRail1()const
 	{
-		fprintf(mFile,"\"%s.ir1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir1\"");
 	}
 	void getInputRail2()const
 	{
-		fprintf(mFile,"\"%s.ir2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir2\"");
 	}
 	void getSweepStyle()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getTransformMode()const
 	{
-		fprintf(mFile,"\"%s.tm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tm\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	BirailSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
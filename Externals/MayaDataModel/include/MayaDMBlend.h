@@ -27,48 +27,48 @@ public:
 	void setInput(size_t i_i,double i_)
 	{
 		if(i_ == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i]\" %f;\n", i_i,i_);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"]\" ",i_,";\n");
 	}
 	void setInput(size_t i_start,size_t i_end,double* i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\" ");
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",i_[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",i_[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput(size_t i_start,size_t i_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\"",i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\"");
 	}
 	void appendInput(double i)const
 	{
-		fprintf(mFile," %f",i);
+		writeFloat(mFile," ",i);
 	}
 	void endInput()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCurrent(int c)
 	{
 		if(c == 0) return;
-		fprintf(mFile,"\tsetAttr \".c\" %i;\n", c);
+		writeInt(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void getInput(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getInput()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	Blend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,80 +27,80 @@ public:
 	void setBaseColorName(const string& bcn)
 	{
 		if(bcn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bcn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bcn\" -type \"string\" ");
 		bcn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSrcColorName(const string& src)
 	{
 		if(src == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".src\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".src\" -type \"string\" ");
 		src.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDstColorName(const string& dst)
 	{
 		if(dst == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".dst\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".dst\" -type \"string\" ");
 		dst.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBlendFunc(unsigned int bfn)
 	{
 		if(bfn == 0) return;
-		fprintf(mFile,"\tsetAttr \".bfn\" %i;\n", bfn);
+		writeInt(mFile,"\tsetAttr \".bfn\" ",bfn,";\n");
 	}
 	void setBlendWeightA(float bwa)
 	{
 		if(bwa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bwa\" %f;\n", bwa);
+		writeFloat(mFile,"\tsetAttr \".bwa\" ",bwa,";\n");
 	}
 	void setBlendWeightB(float bwb)
 	{
 		if(bwb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bwb\" %f;\n", bwb);
+		writeFloat(mFile,"\tsetAttr \".bwb\" ",bwb,";\n");
 	}
 	void setBlendWeightC(float bwc)
 	{
 		if(bwc == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".bwc\" %f;\n", bwc);
+		writeFloat(mFile,"\tsetAttr \".bwc\" ",bwc,";\n");
 	}
 	void setBlendWeightD(float bwd)
 	{
 		if(bwd == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".bwd\" %f;\n", bwd);
+		writeFloat(mFile,"\tsetAttr \".bwd\" ",bwd,";\n");
 	}
 	void getBaseColorName()const
 	{
-		fprintf(mFile,"\"%s.bcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcn\"");
 	}
 	void getSrcColorName()const
 	{
-		fprintf(mFile,"\"%s.src\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".src\"");
 	}
 	void getDstColorName()const
 	{
-		fprintf(mFile,"\"%s.dst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dst\"");
 	}
 	void getBlendFunc()const
 	{
-		fprintf(mFile,"\"%s.bfn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bfn\"");
 	}
 	void getBlendWeightA()const
 	{
-		fprintf(mFile,"\"%s.bwa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwa\"");
 	}
 	void getBlendWeightB()const
 	{
-		fprintf(mFile,"\"%s.bwb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwb\"");
 	}
 	void getBlendWeightC()const
 	{
-		fprintf(mFile,"\"%s.bwc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwc\"");
 	}
 	void getBlendWeightD()const
 	{
-		fprintf(mFile,"\"%s.bwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwd\"");
 	}
 protected:
 	BlendColorSets(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,124 +27,124 @@ public:
 	void setInputAngle(size_t ia_i,double ia)
 	{
 		if(ia == 0) return;
-		fprintf(mFile,"\tsetAttr \".ia[%i]\" %f;\n", ia_i,ia);
+		writeInt(mFile,"\tsetAttr \".ia[",ia_i); writeFloat(mFile,"]\" ",ia,";\n");
 	}
 	void setInputAngle(size_t ia_start,size_t ia_end,double* ia)
 	{
-		fprintf(mFile,"\tsetAttr \".ia[%i:%i]\" ", ia_start,ia_end);
+		writeInt(mFile,"\tsetAttr \".ia[",ia_start); writeInt(mFile,":",ia_end,"]\" ");
 		size_t size = (ia_end-ia_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ia[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ia[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputAngle(size_t ia_start,size_t ia_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ia[%i:%i]\"",ia_start,ia_end);
+		writeInt(mFile,"\tsetAttr \".ia[",ia_start); writeInt(mFile,":",ia_end,"]\"");
 	}
 	void appendInputAngle(double ia)const
 	{
-		fprintf(mFile," %f",ia);
+		writeFloat(mFile," ",ia);
 	}
 	void endInputAngle()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputLinear(size_t il_i,double il)
 	{
 		if(il == 0) return;
-		fprintf(mFile,"\tsetAttr \".il[%i]\" %f;\n", il_i,il);
+		writeInt(mFile,"\tsetAttr \".il[",il_i); writeFloat(mFile,"]\" ",il,";\n");
 	}
 	void setInputLinear(size_t il_start,size_t il_end,double* il)
 	{
-		fprintf(mFile,"\tsetAttr \".il[%i:%i]\" ", il_start,il_end);
+		writeInt(mFile,"\tsetAttr \".il[",il_start); writeInt(mFile,":",il_end,"]\" ");
 		size_t size = (il_end-il_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",il[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",il[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputLinear(size_t il_start,size_t il_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".il[%i:%i]\"",il_start,il_end);
+		writeInt(mFile,"\tsetAttr \".il[",il_start); writeInt(mFile,":",il_end,"]\"");
 	}
 	void appendInputLinear(double il)const
 	{
-		fprintf(mFile," %f",il);
+		writeFloat(mFile," ",il);
 	}
 	void endInputLinear()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getDeviceValue()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getDeviceBlender()const
 	{
-		fprintf(mFile,"\"%s.db\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".db\"");
 	}
 	void getInputAngle(size_t ia_i)const
 	{
-		fprintf(mFile,"\"%s.ia[%i]\"",mName.c_str(),ia_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ia[",ia_i,"]\"");
 	}
 	void getInputAngle()const
 	{
 
-		fprintf(mFile,"\"%s.ia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ia\"");
 	}
 	void getOutputAngle()const
 	{
-		fprintf(mFile,"\"%s.oa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oa\"");
 	}
 	void getInputLinear(size_t il_i)const
 	{
-		fprintf(mFile,"\"%s.il[%i]\"",mName.c_str(),il_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".il[",il_i,"]\"");
 	}
 	void getInputLinear()const
 	{
 
-		fprintf(mFile,"\"%s.il\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".il\"");
 	}
 	void getOutputLinear()const
 	{
-		fprintf(mFile,"\"%s.ol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ol\"");
 	}
 	void getBlender()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getMinTime()const
 	{
-		fprintf(mFile,"\"%s.mnt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mnt\"");
 	}
 	void getPeriod()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getTimeStamp()const
 	{
-		fprintf(mFile,"\"%s.ts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ts\"");
 	}
 	void getData()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getStride()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.off\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".off\"");
 	}
 protected:
 	BlendDevice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -25,7 +25,7 @@ public:
 				void write(FILE* file) const
 				{
 					inputPointsTarget.write(file);
-					fprintf(file, " ");
+					writeString(file," ");
 					inputComponentsTarget.write(file);
 				}
 			}* inputTargetItem;
@@ -37,13 +37,13 @@ public:
 				for (size_t i = 0; i<nbInputTargetItem; ++i)
 				{
 					inputTargetItem[i].write(file);
-					fprintf(file, " ");
-					if (i + 1<nbInputTargetItem) fprintf(file, " ");
+					writeString(file," ");
+					if (i + 1<nbInputTargetItem) writeString(file," ");
 				}
 				for (size_t i = 0; i<nbTargetWeights; ++i)
 				{
-					fprintf(file,"%f", targetWeights[i]);
-					if (i + 1<nbTargetWeights) fprintf(file, " ");
+					writeFloat(file,"",targetWeights[i]);
+					if (i + 1<nbTargetWeights) writeString(file," ");
 				}
 			}
 		}* inputTargetGroup;
@@ -53,7 +53,7 @@ public:
 			for (size_t i = 0; i<nbInputTargetGroup; ++i)
 			{
 				inputTargetGroup[i].write(file);
-				if (i + 1<nbInputTargetGroup) fprintf(file, " ");
+				if (i + 1<nbInputTargetGroup) writeString(file," ");
 			}
 		}
 	};
@@ -67,373 +67,373 @@ public:
 	void setTopologyCheck(bool tc)
 	{
 		if(tc == true) return;
-		fprintf(mFile,"\tsetAttr \".tc\" %i;\n", tc);
+		writeInt(mFile,"\tsetAttr \".tc\" ",tc,";\n");
 	}
 	void setWeight(size_t w_i,float w)
 	{
 		if(w == 0) return;
-		fprintf(mFile,"\tsetAttr \".w[%i]\" %f;\n", w_i,w);
+		writeInt(mFile,"\tsetAttr \".w[",w_i); writeFloat(mFile,"]\" ",w,";\n");
 	}
 	void setWeight(size_t w_start,size_t w_end,float* w)
 	{
-		fprintf(mFile,"\tsetAttr \".w[%i:%i]\" ", w_start,w_end);
+		writeInt(mFile,"\tsetAttr \".w[",w_start); writeInt(mFile,":",w_end,"]\" ");
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",w[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWeight(size_t w_start,size_t w_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".w[%i:%i]\"",w_start,w_end);
+		writeInt(mFile,"\tsetAttr \".w[",w_start); writeInt(mFile,":",w_end,"]\"");
 	}
 	void appendWeight(float w)const
 	{
-		fprintf(mFile," %f",w);
+		writeFloat(mFile," ",w);
 	}
 	void endWeight()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIcon(size_t icn_i,const string& icn)
 	{
 		if(icn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".icn[%i]\" -type \"string\" ",icn_i);
+		writeInt(mFile,"\tsetAttr \".icn[",icn_i,"]\" -type \"string\" ");
 		icn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIcon(size_t icn_start,size_t icn_end,string* icn)
 	{
-		fprintf(mFile,"\tsetAttr \".icn[%i:%i]\" ", icn_start,icn_end);
+		writeInt(mFile,"\tsetAttr \".icn[",icn_start); writeInt(mFile,":",icn_end,"]\" ");
 		size_t size = (icn_end-icn_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			icn[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startIcon(size_t icn_start,size_t icn_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".icn[%i:%i]\"",icn_start,icn_end);
-		fprintf(mFile," -type \"string\" ");
+		writeInt(mFile,"\tsetAttr \".icn[",icn_start); writeInt(mFile,":",icn_end,"]\"");
+		writeString(mFile," -type \"string\" ");
 	}
 	void appendIcon(const string& icn)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		icn.write(mFile);
 	}
 	void endIcon()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputTarget(size_t it_i,const InputTarget& it)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i]\" ",it_i);
+		writeInt(mFile,"\tsetAttr \".it[",it_i,"]\" ");
 		it.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputTarget(size_t it_start,size_t it_end,InputTarget* it)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i:%i]\" ", it_start,it_end);
+		writeInt(mFile,"\tsetAttr \".it[",it_start); writeInt(mFile,":",it_end,"]\" ");
 		size_t size = (it_end-it_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			it[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputTarget(size_t it_start,size_t it_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i:%i]\"",it_start,it_end);
-		fprintf(mFile," -type \"InputTarget\" ");
+		writeInt(mFile,"\tsetAttr \".it[",it_start); writeInt(mFile,":",it_end,"]\"");
+		writeString(mFile," -type \"InputTarget\" ");
 	}
 	void appendInputTarget(const InputTarget& it)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		it.write(mFile);
 	}
 	void endInputTarget()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputTargetGroup(size_t it_i,size_t itg_i,const InputTarget::InputTargetGroup& itg)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i]\" ",it_i,itg_i);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i,"]\" ");
 		itg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputTargetGroup(size_t it_i,size_t itg_start,size_t itg_end,InputTarget::InputTargetGroup* itg)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i:%i]\" ", it_i,itg_start,itg_end);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_start); writeInt(mFile,":",itg_end,"]\" ");
 		size_t size = (itg_end-itg_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			itg[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputTargetGroup(size_t it_i,size_t itg_start,size_t itg_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i:%i]\"",it_i,itg_start,itg_end);
-		fprintf(mFile," -type \"InputTarget::InputTargetGroup\" ");
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_start); writeInt(mFile,":",itg_end,"]\"");
+		writeString(mFile," -type \"InputTarget::InputTargetGroup\" ");
 	}
 	void appendInputTargetGroup(const InputTarget::InputTargetGroup& itg)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		itg.write(mFile);
 	}
 	void endInputTargetGroup()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputTargetItem(size_t it_i,size_t itg_i,size_t iti_i,const InputTarget::InputTargetGroup::InputTargetItem& iti)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].iti[%i]\" ",it_i,itg_i,iti_i);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"]\" ");
 		iti.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputTargetItem(size_t it_i,size_t itg_i,size_t iti_start,size_t iti_end,InputTarget::InputTargetGroup::InputTargetItem* iti)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].iti[%i:%i]\" ", it_i,itg_i,iti_start,iti_end);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_start); writeInt(mFile,":",iti_end,"]\" ");
 		size_t size = (iti_end-iti_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			iti[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputTargetItem(size_t it_i,size_t itg_i,size_t iti_start,size_t iti_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].iti[%i:%i]\"",it_i,itg_i,iti_start,iti_end);
-		fprintf(mFile," -type \"InputTarget::InputTargetGroup::InputTargetItem\" ");
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_start); writeInt(mFile,":",iti_end,"]\"");
+		writeString(mFile," -type \"InputTarget::InputTargetGroup::InputTargetItem\" ");
 	}
 	void appendInputTargetItem(const InputTarget::InputTargetGroup::InputTargetItem& iti)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		iti.write(mFile);
 	}
 	void endInputTargetItem()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputPointsTarget(size_t it_i,size_t itg_i,size_t iti_i,const pointArray& ipt)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].iti[%i].ipt\" -type \"pointArray\" ",it_i,itg_i,iti_i);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"].ipt\" -type \"pointArray\" ");
 		ipt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputComponentsTarget(size_t it_i,size_t itg_i,size_t iti_i,const componentList& ict)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].iti[%i].ict\" -type \"componentList\" ",it_i,itg_i,iti_i);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"].ict\" -type \"componentList\" ");
 		ict.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetWeights(size_t it_i,size_t itg_i,size_t tw_i,float tw)
 	{
 		if(tw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].tw[%i]\" %f;\n", it_i,itg_i,tw_i,tw);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].tw[",tw_i); writeFloat(mFile,"]\" ",tw,";\n");
 	}
 	void setTargetWeights(size_t it_i,size_t itg_i,size_t tw_start,size_t tw_end,float* tw)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].tw[%i:%i]\" ", it_i,itg_i,tw_start,tw_end);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].tw[",tw_start); writeInt(mFile,":",tw_end,"]\" ");
 		size_t size = (tw_end-tw_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tw[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",tw[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTargetWeights(size_t it_i,size_t itg_i,size_t tw_start,size_t tw_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].tw[%i:%i]\"",it_i,itg_i,tw_start,tw_end);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].tw[",tw_start); writeInt(mFile,":",tw_end,"]\"");
 	}
 	void appendTargetWeights(float tw)const
 	{
-		fprintf(mFile," %f",tw);
+		writeFloat(mFile," ",tw);
 	}
 	void endTargetWeights()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOrigin(unsigned int ori)
 	{
 		if(ori == 1) return;
-		fprintf(mFile,"\tsetAttr \".or\" %i;\n", ori);
+		writeInt(mFile,"\tsetAttr \".or\" ",ori,";\n");
 	}
 	void setBaseOrigin(const double3& bo)
 	{
-		fprintf(mFile,"\tsetAttr \".bo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".bo\" -type \"double3\" ");
 		bo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseOriginX(double bx)
 	{
 		if(bx == 0) return;
-		fprintf(mFile,"\tsetAttr \".bo.bx\" %f;\n", bx);
+		writeFloat(mFile,"\tsetAttr \".bo.bx\" ",bx,";\n");
 	}
 	void setBaseOriginY(double by)
 	{
 		if(by == 0) return;
-		fprintf(mFile,"\tsetAttr \".bo.by\" %f;\n", by);
+		writeFloat(mFile,"\tsetAttr \".bo.by\" ",by,";\n");
 	}
 	void setBaseOriginZ(double bz)
 	{
 		if(bz == 0) return;
-		fprintf(mFile,"\tsetAttr \".bo.bz\" %f;\n", bz);
+		writeFloat(mFile,"\tsetAttr \".bo.bz\" ",bz,";\n");
 	}
 	void setTargetOrigin(const double3& to)
 	{
-		fprintf(mFile,"\tsetAttr \".to\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".to\" -type \"double3\" ");
 		to.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetOriginX(double tx)
 	{
 		if(tx == 0) return;
-		fprintf(mFile,"\tsetAttr \".to.tx\" %f;\n", tx);
+		writeFloat(mFile,"\tsetAttr \".to.tx\" ",tx,";\n");
 	}
 	void setTargetOriginY(double ty)
 	{
 		if(ty == 0) return;
-		fprintf(mFile,"\tsetAttr \".to.ty\" %f;\n", ty);
+		writeFloat(mFile,"\tsetAttr \".to.ty\" ",ty,";\n");
 	}
 	void setTargetOriginZ(double tz)
 	{
 		if(tz == 0) return;
-		fprintf(mFile,"\tsetAttr \".to.tz\" %f;\n", tz);
+		writeFloat(mFile,"\tsetAttr \".to.tz\" ",tz,";\n");
 	}
 	void setParallelBlender(bool pb)
 	{
 		if(pb == 0) return;
-		fprintf(mFile,"\tsetAttr \".pb\" %i;\n", pb);
+		writeInt(mFile,"\tsetAttr \".pb\" ",pb,";\n");
 	}
 	void getTopologyCheck()const
 	{
-		fprintf(mFile,"\"%s.tc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc\"");
 	}
 	void getWeight(size_t w_i)const
 	{
-		fprintf(mFile,"\"%s.w[%i]\"",mName.c_str(),w_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".w[",w_i,"]\"");
 	}
 	void getWeight()const
 	{
 
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getIcon(size_t icn_i)const
 	{
-		fprintf(mFile,"\"%s.icn[%i]\"",mName.c_str(),icn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".icn[",icn_i,"]\"");
 	}
 	void getIcon()const
 	{
 
-		fprintf(mFile,"\"%s.icn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".icn\"");
 	}
 	void getInputTarget(size_t it_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i]\"",mName.c_str(),it_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i,"]\"");
 	}
 	void getInputTarget()const
 	{
 
-		fprintf(mFile,"\"%s.it\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it\"");
 	}
 	void getInputTargetGroup(size_t it_i,size_t itg_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itg[%i]\"",mName.c_str(),it_i,itg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i); writeInt(mFile,"].itg[",itg_i,"]\"");
 	}
 	void getInputTargetGroup(size_t itg_i)const
 	{
 
-		fprintf(mFile,"\"%s.it.itg[%i]\"",mName.c_str(),itg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it.itg[",itg_i,"]\"");
 	}
 	void getInputTargetItem(size_t it_i,size_t itg_i,size_t iti_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itg[%i].iti[%i]\"",mName.c_str(),it_i,itg_i,iti_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"]\"");
 	}
 	void getInputTargetItem(size_t itg_i,size_t iti_i)const
 	{
 
-		fprintf(mFile,"\"%s.it.itg[%i].iti[%i]\"",mName.c_str(),itg_i,iti_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it.itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"]\"");
 	}
 	void getInputGeomTarget(size_t it_i,size_t itg_i,size_t iti_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itg[%i].iti[%i].igt\"",mName.c_str(),it_i,itg_i,iti_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"].igt\"");
 	}
 	void getInputGeomTarget(size_t itg_i,size_t iti_i)const
 	{
 
-		fprintf(mFile,"\"%s.it.itg[%i].iti[%i].igt\"",mName.c_str(),itg_i,iti_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it.itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"].igt\"");
 	}
 	void getInputPointsTarget(size_t it_i,size_t itg_i,size_t iti_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itg[%i].iti[%i].ipt\"",mName.c_str(),it_i,itg_i,iti_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"].ipt\"");
 	}
 	void getInputPointsTarget(size_t itg_i,size_t iti_i)const
 	{
 
-		fprintf(mFile,"\"%s.it.itg[%i].iti[%i].ipt\"",mName.c_str(),itg_i,iti_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it.itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"].ipt\"");
 	}
 	void getInputComponentsTarget(size_t it_i,size_t itg_i,size_t iti_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itg[%i].iti[%i].ict\"",mName.c_str(),it_i,itg_i,iti_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"].ict\"");
 	}
 	void getInputComponentsTarget(size_t itg_i,size_t iti_i)const
 	{
 
-		fprintf(mFile,"\"%s.it.itg[%i].iti[%i].ict\"",mName.c_str(),itg_i,iti_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it.itg[",itg_i); writeInt(mFile,"].iti[",iti_i,"].ict\"");
 	}
 	void getTargetWeights(size_t it_i,size_t itg_i,size_t tw_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itg[%i].tw[%i]\"",mName.c_str(),it_i,itg_i,tw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i); writeInt(mFile,"].itg[",itg_i); writeInt(mFile,"].tw[",tw_i,"]\"");
 	}
 	void getTargetWeights(size_t itg_i,size_t tw_i)const
 	{
 
-		fprintf(mFile,"\"%s.it.itg[%i].tw[%i]\"",mName.c_str(),itg_i,tw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it.itg[",itg_i); writeInt(mFile,"].tw[",tw_i,"]\"");
 	}
 	void getOrigin()const
 	{
-		fprintf(mFile,"\"%s.or\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or\"");
 	}
 	void getBaseOrigin()const
 	{
-		fprintf(mFile,"\"%s.bo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo\"");
 	}
 	void getBaseOriginX()const
 	{
-		fprintf(mFile,"\"%s.bo.bx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo.bx\"");
 	}
 	void getBaseOriginY()const
 	{
-		fprintf(mFile,"\"%s.bo.by\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo.by\"");
 	}
 	void getBaseOriginZ()const
 	{
-		fprintf(mFile,"\"%s.bo.bz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo.bz\"");
 	}
 	void getTargetOrigin()const
 	{
-		fprintf(mFile,"\"%s.to\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to\"");
 	}
 	void getTargetOriginX()const
 	{
-		fprintf(mFile,"\"%s.to.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.tx\"");
 	}
 	void getTargetOriginY()const
 	{
-		fprintf(mFile,"\"%s.to.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.ty\"");
 	}
 	void getTargetOriginZ()const
 	{
-		fprintf(mFile,"\"%s.to.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.tz\"");
 	}
 protected:
 	BlendShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
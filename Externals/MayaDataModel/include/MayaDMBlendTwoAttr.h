@@ -27,11 +27,11 @@ public:
 	void setAttributesBlender(float ab)
 	{
 		if(ab == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ab\" %f;\n", ab);
+		writeFloat(mFile,"\tsetAttr \".ab\" ",ab,";\n");
 	}
 	void getAttributesBlender()const
 	{
-		fprintf(mFile,"\"%s.ab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ab\"");
 	}
 protected:
 	BlendTwoAttr(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
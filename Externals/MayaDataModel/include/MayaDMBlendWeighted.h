@@ -27,39 +27,39 @@ public:
 	void setWeight(size_t w_i,float w)
 	{
 		if(w == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".w[%i]\" %f;\n", w_i,w);
+		writeInt(mFile,"\tsetAttr \".w[",w_i); writeFloat(mFile,"]\" ",w,";\n");
 	}
 	void setWeight(size_t w_start,size_t w_end,float* w)
 	{
-		fprintf(mFile,"\tsetAttr \".w[%i:%i]\" ", w_start,w_end);
+		writeInt(mFile,"\tsetAttr \".w[",w_start); writeInt(mFile,":",w_end,"]\" ");
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",w[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWeight(size_t w_start,size_t w_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".w[%i:%i]\"",w_start,w_end);
+		writeInt(mFile,"\tsetAttr \".w[",w_start); writeInt(mFile,":",w_end,"]\"");
 	}
 	void appendWeight(float w)const
 	{
-		fprintf(mFile," %f",w);
+		writeFloat(mFile," ",w);
 	}
 	void endWeight()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getWeight(size_t w_i)const
 	{
-		fprintf(mFile,"\"%s.w[%i]\"",mName.c_str(),w_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".w[",w_i,"]\"");
 	}
 	void getWeight()const
 	{
 
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 protected:
 	BlendWeighted(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -25,7 +25,7 @@ public:
 			void write(FILE* file) const
 			{
 				bdPresetAttr.write(file);
-				fprintf(file, " ");
+				writeString(file," ");
 				bdPresetValue.write(file);
 			}
 		}* bdPresetElements;
@@ -33,11 +33,11 @@ public:
 		void write(FILE* file) const
 		{
 			bdPresetName.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			for (size_t i = 0; i<nbBdPresetElements; ++i)
 			{
 				bdPresetElements[i].write(file);
-				if (i + 1<nbBdPresetElements) fprintf(file, " ");
+				if (i + 1<nbBdPresetElements) writeString(file," ");
 			}
 		}
 	};
@@ -47,7 +47,7 @@ public:
 		void write(FILE* file) const
 		{
 			bdUserInfoName.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			bdUserInfoValue.write(file);
 		}
 	};
@@ -61,135 +61,135 @@ public:
 	void setTypeId(int tid)
 	{
 		if(tid == 0) return;
-		fprintf(mFile,"\tsetAttr \".tid\" %i;\n", tid);
+		writeInt(mFile,"\tsetAttr \".tid\" ",tid,";\n");
 	}
 	void setBlindDataPresets(size_t bdps_i,const BlindDataPresets& bdps)
 	{
-		fprintf(mFile,"\tsetAttr \".bdps[%i]\" ",bdps_i);
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_i,"]\" ");
 		bdps.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBlindDataPresets(size_t bdps_start,size_t bdps_end,BlindDataPresets* bdps)
 	{
-		fprintf(mFile,"\tsetAttr \".bdps[%i:%i]\" ", bdps_start,bdps_end);
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_start); writeInt(mFile,":",bdps_end,"]\" ");
 		size_t size = (bdps_end-bdps_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			bdps[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBlindDataPresets(size_t bdps_start,size_t bdps_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".bdps[%i:%i]\"",bdps_start,bdps_end);
-		fprintf(mFile," -type \"BlindDataPresets\" ");
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_start); writeInt(mFile,":",bdps_end,"]\"");
+		writeString(mFile," -type \"BlindDataPresets\" ");
 	}
 	void appendBlindDataPresets(const BlindDataPresets& bdps)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		bdps.write(mFile);
 	}
 	void endBlindDataPresets()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdPresetName(size_t bdps_i,const string& bdpn)
 	{
 		if(bdpn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bdps[%i].bdpn\" -type \"string\" ",bdps_i);
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_i,"].bdpn\" -type \"string\" ");
 		bdpn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdPresetElements(size_t bdps_i,size_t bdpe_i,const BlindDataPresets::BdPresetElements& bdpe)
 	{
-		fprintf(mFile,"\tsetAttr \".bdps[%i].bdpe[%i]\" ",bdps_i,bdpe_i);
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_i); writeInt(mFile,"].bdpe[",bdpe_i,"]\" ");
 		bdpe.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdPresetElements(size_t bdps_i,size_t bdpe_start,size_t bdpe_end,BlindDataPresets::BdPresetElements* bdpe)
 	{
-		fprintf(mFile,"\tsetAttr \".bdps[%i].bdpe[%i:%i]\" ", bdps_i,bdpe_start,bdpe_end);
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_i); writeInt(mFile,"].bdpe[",bdpe_start); writeInt(mFile,":",bdpe_end,"]\" ");
 		size_t size = (bdpe_end-bdpe_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			bdpe[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBdPresetElements(size_t bdps_i,size_t bdpe_start,size_t bdpe_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".bdps[%i].bdpe[%i:%i]\"",bdps_i,bdpe_start,bdpe_end);
-		fprintf(mFile," -type \"BlindDataPresets::BdPresetElements\" ");
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_i); writeInt(mFile,"].bdpe[",bdpe_start); writeInt(mFile,":",bdpe_end,"]\"");
+		writeString(mFile," -type \"BlindDataPresets::BdPresetElements\" ");
 	}
 	void appendBdPresetElements(const BlindDataPresets::BdPresetElements& bdpe)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		bdpe.write(mFile);
 	}
 	void endBdPresetElements()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdPresetAttr(size_t bdps_i,size_t bdpe_i,const string& bdpa)
 	{
 		if(bdpa == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bdps[%i].bdpe[%i].bdpa\" -type \"string\" ",bdps_i,bdpe_i);
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_i); writeInt(mFile,"].bdpe[",bdpe_i,"].bdpa\" -type \"string\" ");
 		bdpa.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdPresetValue(size_t bdps_i,size_t bdpe_i,const string& bdpv)
 	{
 		if(bdpv == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bdps[%i].bdpe[%i].bdpv\" -type \"string\" ",bdps_i,bdpe_i);
+		writeInt(mFile,"\tsetAttr \".bdps[",bdps_i); writeInt(mFile,"].bdpe[",bdpe_i,"].bdpv\" -type \"string\" ");
 		bdpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdUserInfo(size_t bdui_i,const BdUserInfo& bdui)
 	{
-		fprintf(mFile,"\tsetAttr \".bdui[%i]\" ",bdui_i);
+		writeInt(mFile,"\tsetAttr \".bdui[",bdui_i,"]\" ");
 		bdui.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdUserInfo(size_t bdui_start,size_t bdui_end,BdUserInfo* bdui)
 	{
-		fprintf(mFile,"\tsetAttr \".bdui[%i:%i]\" ", bdui_start,bdui_end);
+		writeInt(mFile,"\tsetAttr \".bdui[",bdui_start); writeInt(mFile,":",bdui_end,"]\" ");
 		size_t size = (bdui_end-bdui_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			bdui[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBdUserInfo(size_t bdui_start,size_t bdui_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".bdui[%i:%i]\"",bdui_start,bdui_end);
-		fprintf(mFile," -type \"BdUserInfo\" ");
+		writeInt(mFile,"\tsetAttr \".bdui[",bdui_start); writeInt(mFile,":",bdui_end,"]\"");
+		writeString(mFile," -type \"BdUserInfo\" ");
 	}
 	void appendBdUserInfo(const BdUserInfo& bdui)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		bdui.write(mFile);
 	}
 	void endBdUserInfo()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdUserInfoName(size_t bdui_i,const string& bdun)
 	{
 		if(bdun == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bdui[%i].bdun\" -type \"string\" ",bdui_i);
+		writeInt(mFile,"\tsetAttr \".bdui[",bdui_i,"].bdun\" -type \"string\" ");
 		bdun.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBdUserInfoValue(size_t bdui_i,const string& bduv)
 	{
 		if(bduv == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bdui[%i].bduv\" -type \"string\" ",bdui_i);
+		writeInt(mFile,"\tsetAttr \".bdui[",bdui_i,"].bduv\" -type \"string\" ");
 		bduv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 protected:
 	BlindDataTemplate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
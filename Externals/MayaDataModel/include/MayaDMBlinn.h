@@ -27,102 +27,102 @@ public:
 	void setEccentricity(float ec)
 	{
 		if(ec == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".ec\" %f;\n", ec);
+		writeFloat(mFile,"\tsetAttr \".ec\" ",ec,";\n");
 	}
 	void setSpecularRollOff(float sro)
 	{
 		if(sro == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".sro\" %f;\n", sro);
+		writeFloat(mFile,"\tsetAttr \".sro\" ",sro,";\n");
 	}
 	void setReflectionRolloff(bool rro)
 	{
 		if(rro == true) return;
-		fprintf(mFile,"\tsetAttr \".rro\" %i;\n", rro);
+		writeInt(mFile,"\tsetAttr \".rro\" ",rro,";\n");
 	}
 	void setMiReflectionBlur(float mircb)
 	{
 		if(mircb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mircb\" %f;\n", mircb);
+		writeFloat(mFile,"\tsetAttr \".mircb\" ",mircb,";\n");
 	}
 	void setMiReflectionRays(short mircr)
 	{
 		if(mircr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mircr\" %i;\n", mircr);
+		writeInt(mFile,"\tsetAttr \".mircr\" ",mircr,";\n");
 	}
 	void setMiShinyness(float mis)
 	{
 		if(mis == 10) return;
-		fprintf(mFile,"\tsetAttr \".mis\" %f;\n", mis);
+		writeFloat(mFile,"\tsetAttr \".mis\" ",mis,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void getEccentricity()const
 	{
-		fprintf(mFile,"\"%s.ec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ec\"");
 	}
 	void getSpecularRollOff()const
 	{
-		fprintf(mFile,"\"%s.sro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sro\"");
 	}
 	void getReflectionRolloff()const
 	{
-		fprintf(mFile,"\"%s.rro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro\"");
 	}
 	void getMiReflectionBlur()const
 	{
-		fprintf(mFile,"\"%s.mircb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircb\"");
 	}
 	void getMiReflectionRays()const
 	{
-		fprintf(mFile,"\"%s.mircr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircr\"");
 	}
 	void getMiShinyness()const
 	{
-		fprintf(mFile,"\"%s.mis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mis\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 protected:
 	Blinn(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
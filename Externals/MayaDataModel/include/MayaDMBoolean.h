@@ -27,32 +27,32 @@ public:
 	void setOperation(unsigned int op)
 	{
 		if(op == 0) return;
-		fprintf(mFile,"\tsetAttr \".op\" %i;\n", op);
+		writeInt(mFile,"\tsetAttr \".op\" ",op,";\n");
 	}
 	void setTolerance(double tlb)
 	{
 		if(tlb == 0) return;
-		fprintf(mFile,"\tsetAttr \".tlb\" %f;\n", tlb);
+		writeFloat(mFile,"\tsetAttr \".tlb\" ",tlb,";\n");
 	}
 	void getInputShellA()const
 	{
-		fprintf(mFile,"\"%s.isa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isa\"");
 	}
 	void getInputShellB()const
 	{
-		fprintf(mFile,"\"%s.isb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isb\"");
 	}
 	void getOperation()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tlb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlb\"");
 	}
 	void getOutputShell()const
 	{
-		fprintf(mFile,"\"%s.osh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".osh\"");
 	}
 protected:
 	Boolean(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,20 +27,20 @@ public:
 	void setOrder(bool _or)
 	{
 		if(_or == true) return;
-		fprintf(mFile,"\tsetAttr \".or\" %i;\n", _or);
+		writeInt(mFile,"\tsetAttr \".or\" ",_or,";\n");
 	}
 	void setEndPoint(bool ep)
 	{
 		if(ep == false) return;
-		fprintf(mFile,"\tsetAttr \".ep\" %i;\n", ep);
+		writeInt(mFile,"\tsetAttr \".ep\" ",ep,";\n");
 	}
 	void getOrder()const
 	{
-		fprintf(mFile,"\"%s.or\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or\"");
 	}
 	void getEndPoint()const
 	{
-		fprintf(mFile,"\"%s.ep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ep\"");
 	}
 protected:
 	Boundary(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
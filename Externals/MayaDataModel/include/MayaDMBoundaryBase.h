@@ -27,31 +27,31 @@ public:
 	void setEndPointTolerance(double ept)
 	{
 		if(ept == 0) return;
-		fprintf(mFile,"\tsetAttr \".ept\" %f;\n", ept);
+		writeFloat(mFile,"\tsetAttr \".ept\" ",ept,";\n");
 	}
 	void getInputCurve1()const
 	{
-		fprintf(mFile,"\"%s.ic1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic1\"");
 	}
 	void getInputCurve2()const
 	{
-		fprintf(mFile,"\"%s.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2\"");
 	}
 	void getInputCurve3()const
 	{
-		fprintf(mFile,"\"%s.ic3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic3\"");
 	}
 	void getInputCurve4()const
 	{
-		fprintf(mFile,"\"%s.ic4\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic4\"");
 	}
 	void getEndPointTolerance()const
 	{
-		fprintf(mFile,"\"%s.ept\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ept\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	BoundaryBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
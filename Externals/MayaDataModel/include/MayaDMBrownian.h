@@ -27,124 +27,124 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setLacunarity(float l)
 	{
 		if(l == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".l\" %f;\n", l);
+		writeFloat(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void setIncrement(float ic)
 	{
 		if(ic == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".ic\" %f;\n", ic);
+		writeFloat(mFile,"\tsetAttr \".ic\" ",ic,";\n");
 	}
 	void setOctaves(float oct)
 	{
 		if(oct == 3.0) return;
-		fprintf(mFile,"\tsetAttr \".oct\" %f;\n", oct);
+		writeFloat(mFile,"\tsetAttr \".oct\" ",oct,";\n");
 	}
 	void setWeight3d(const float3& w3)
 	{
 		if(w3 == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".w3\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".w3\" -type \"float3\" ");
 		w3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeight3dX(float w3x)
 	{
 		if(w3x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".w3.w3x\" %f;\n", w3x);
+		writeFloat(mFile,"\tsetAttr \".w3.w3x\" ",w3x,";\n");
 	}
 	void setWeight3dY(float w3y)
 	{
 		if(w3y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".w3.w3y\" %f;\n", w3y);
+		writeFloat(mFile,"\tsetAttr \".w3.w3y\" ",w3y,";\n");
 	}
 	void setWeight3dZ(float w3z)
 	{
 		if(w3z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".w3.w3z\" %f;\n", w3z);
+		writeFloat(mFile,"\tsetAttr \".w3.w3z\" ",w3z,";\n");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getLacunarity()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getIncrement()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getOctaves()const
 	{
-		fprintf(mFile,"\"%s.oct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oct\"");
 	}
 	void getWeight3d()const
 	{
-		fprintf(mFile,"\"%s.w3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w3\"");
 	}
 	void getWeight3dX()const
 	{
-		fprintf(mFile,"\"%s.w3.w3x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w3.w3x\"");
 	}
 	void getWeight3dY()const
 	{
-		fprintf(mFile,"\"%s.w3.w3y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w3.w3y\"");
 	}
 	void getWeight3dZ()const
 	{
-		fprintf(mFile,"\"%s.w3.w3z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w3.w3z\"");
 	}
 protected:
 	Brownian(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
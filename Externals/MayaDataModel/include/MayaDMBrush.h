@@ -23,9 +23,9 @@ public:
 		unsigned int leafCurl_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leafCurl_Position);
-			fprintf(file,"%f ", leafCurl_FloatValue);
-			fprintf(file,"%i", leafCurl_Interp);
+			writeFloat(file,"",leafCurl_Position," ");
+			writeFloat(file,"",leafCurl_FloatValue," ");
+			writeInt(file,"",leafCurl_Interp);
 		}
 	};
 	struct PetalCurl{
@@ -34,9 +34,9 @@ public:
 		unsigned int petalCurl_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", petalCurl_Position);
-			fprintf(file,"%f ", petalCurl_FloatValue);
-			fprintf(file,"%i", petalCurl_Interp);
+			writeFloat(file,"",petalCurl_Position," ");
+			writeFloat(file,"",petalCurl_FloatValue," ");
+			writeInt(file,"",petalCurl_Interp);
 		}
 	};
 	struct WidthScale{
@@ -45,9 +45,9 @@ public:
 		unsigned int widthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", widthScale_Position);
-			fprintf(file,"%f ", widthScale_FloatValue);
-			fprintf(file,"%i", widthScale_Interp);
+			writeFloat(file,"",widthScale_Position," ");
+			writeFloat(file,"",widthScale_FloatValue," ");
+			writeInt(file,"",widthScale_Interp);
 		}
 	};
 	struct LeafWidthScale{
@@ -56,9 +56,9 @@ public:
 		unsigned int leafWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leafWidthScale_Position);
-			fprintf(file,"%f ", leafWidthScale_FloatValue);
-			fprintf(file,"%i", leafWidthScale_Interp);
+			writeFloat(file,"",leafWidthScale_Position," ");
+			writeFloat(file,"",leafWidthScale_FloatValue," ");
+			writeInt(file,"",leafWidthScale_Interp);
 		}
 	};
 	struct PetalWidthScale{
@@ -67,9 +67,9 @@ public:
 		unsigned int petalWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", petalWidthScale_Position);
-			fprintf(file,"%f ", petalWidthScale_FloatValue);
-			fprintf(file,"%i", petalWidthScale_Interp);
+			writeFloat(file,"",petalWidthScale_Position," ");
+			writeFloat(file,"",petalWidthScale_FloatValue," ");
+			writeInt(file,"",petalWidthScale_Interp);
 		}
 	};
 	struct TwigLengthScale{
@@ -78,9 +78,9 @@ public:
 		unsigned int twigLengthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", twigLengthScale_Position);
-			fprintf(file,"%f ", twigLengthScale_FloatValue);
-			fprintf(file,"%i", twigLengthScale_Interp);
+			writeFloat(file,"",twigLengthScale_Position," ");
+			writeFloat(file,"",twigLengthScale_FloatValue," ");
+			writeInt(file,"",twigLengthScale_Interp);
 		}
 	};
 	struct Environment{
@@ -89,10 +89,10 @@ public:
 		unsigned int environment_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", environment_Position);
+			writeFloat(file,"",environment_Position," ");
 			environment_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", environment_Interp);
+			writeString(file," ");
+			writeInt(file,"",environment_Interp);
 		}
 	};
 	struct ReflectionRolloff{
@@ -101,9 +101,9 @@ public:
 		unsigned int reflectionRolloff_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", reflectionRolloff_Position);
-			fprintf(file,"%f ", reflectionRolloff_FloatValue);
-			fprintf(file,"%i", reflectionRolloff_Interp);
+			writeFloat(file,"",reflectionRolloff_Position," ");
+			writeFloat(file,"",reflectionRolloff_FloatValue," ");
+			writeInt(file,"",reflectionRolloff_Interp);
 		}
 	};
 public:
@@ -116,3750 +116,3750 @@ public:
 	void setTime(double tim)
 	{
 		if(tim == 0) return;
-		fprintf(mFile,"\tsetAttr \".tim\" %f;\n", tim);
+		writeFloat(mFile,"\tsetAttr \".tim\" ",tim,";\n");
 	}
 	void setGlobalScale(double gsc)
 	{
 		if(gsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gsc\" %f;\n", gsc);
+		writeFloat(mFile,"\tsetAttr \".gsc\" ",gsc,";\n");
 	}
 	void setDepth(bool dep)
 	{
 		if(dep == false) return;
-		fprintf(mFile,"\tsetAttr \".dep\" %i;\n", dep);
+		writeInt(mFile,"\tsetAttr \".dep\" ",dep,";\n");
 	}
 	void setModifyDepth(bool mdp)
 	{
 		if(mdp == true) return;
-		fprintf(mFile,"\tsetAttr \".mdp\" %i;\n", mdp);
+		writeInt(mFile,"\tsetAttr \".mdp\" ",mdp,";\n");
 	}
 	void setModifyColor(bool mdc)
 	{
 		if(mdc == true) return;
-		fprintf(mFile,"\tsetAttr \".mdc\" %i;\n", mdc);
+		writeInt(mFile,"\tsetAttr \".mdc\" ",mdc,";\n");
 	}
 	void setModifyAlpha(bool mda)
 	{
 		if(mda == true) return;
-		fprintf(mFile,"\tsetAttr \".mda\" %i;\n", mda);
+		writeInt(mFile,"\tsetAttr \".mda\" ",mda,";\n");
 	}
 	void setIlluminated(bool ill)
 	{
 		if(ill == false) return;
-		fprintf(mFile,"\tsetAttr \".ill\" %i;\n", ill);
+		writeInt(mFile,"\tsetAttr \".ill\" ",ill,";\n");
 	}
 	void setCastShadows(bool csd)
 	{
 		if(csd == false) return;
-		fprintf(mFile,"\tsetAttr \".csd\" %i;\n", csd);
+		writeInt(mFile,"\tsetAttr \".csd\" ",csd,";\n");
 	}
 	void setLightingBasedWidth(double lbw)
 	{
 		if(lbw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lbw\" %f;\n", lbw);
+		writeFloat(mFile,"\tsetAttr \".lbw\" ",lbw,";\n");
 	}
 	void setBranches(bool brc)
 	{
 		if(brc == false) return;
-		fprintf(mFile,"\tsetAttr \".brc\" %i;\n", brc);
+		writeInt(mFile,"\tsetAttr \".brc\" ",brc,";\n");
 	}
 	void setTwigs(bool twg)
 	{
 		if(twg == false) return;
-		fprintf(mFile,"\tsetAttr \".twg\" %i;\n", twg);
+		writeInt(mFile,"\tsetAttr \".twg\" ",twg,";\n");
 	}
 	void setBuds(bool bud)
 	{
 		if(bud == false) return;
-		fprintf(mFile,"\tsetAttr \".bud\" %i;\n", bud);
+		writeInt(mFile,"\tsetAttr \".bud\" ",bud,";\n");
 	}
 	void setLeaves(bool lvs)
 	{
 		if(lvs == false) return;
-		fprintf(mFile,"\tsetAttr \".lvs\" %i;\n", lvs);
+		writeInt(mFile,"\tsetAttr \".lvs\" ",lvs,";\n");
 	}
 	void setFlowers(bool flw)
 	{
 		if(flw == false) return;
-		fprintf(mFile,"\tsetAttr \".flw\" %i;\n", flw);
+		writeInt(mFile,"\tsetAttr \".flw\" ",flw,";\n");
 	}
 	void setBrushType(unsigned int brt)
 	{
 		if(brt == 0) return;
-		fprintf(mFile,"\tsetAttr \".brt\" %i;\n", brt);
+		writeInt(mFile,"\tsetAttr \".brt\" ",brt,";\n");
 	}
 	void setBrushWidth(double bwd)
 	{
 		if(bwd == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".bwd\" %f;\n", bwd);
+		writeFloat(mFile,"\tsetAttr \".bwd\" ",bwd,";\n");
 	}
 	void setScreenspaceWidth(bool spw)
 	{
 		if(spw == false) return;
-		fprintf(mFile,"\tsetAttr \".spw\" %i;\n", spw);
+		writeInt(mFile,"\tsetAttr \".spw\" ",spw,";\n");
 	}
 	void setDistanceScaling(double dsl)
 	{
 		if(dsl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dsl\" %f;\n", dsl);
+		writeFloat(mFile,"\tsetAttr \".dsl\" ",dsl,";\n");
 	}
 	void setMinPixelWidth(double mpw)
 	{
 		if(mpw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mpw\" %f;\n", mpw);
+		writeFloat(mFile,"\tsetAttr \".mpw\" ",mpw,";\n");
 	}
 	void setMaxPixelWidth(double mxp)
 	{
 		if(mxp == 1000.0) return;
-		fprintf(mFile,"\tsetAttr \".mxp\" %f;\n", mxp);
+		writeFloat(mFile,"\tsetAttr \".mxp\" ",mxp,";\n");
 	}
 	void setStampDensity(double sdn)
 	{
 		if(sdn == 8.0) return;
-		fprintf(mFile,"\tsetAttr \".sdn\" %f;\n", sdn);
+		writeFloat(mFile,"\tsetAttr \".sdn\" ",sdn,";\n");
 	}
 	void setSoftness(double sft)
 	{
 		if(sft == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".sft\" %f;\n", sft);
+		writeFloat(mFile,"\tsetAttr \".sft\" ",sft,";\n");
 	}
 	void setEdgeAntialias(bool eaa)
 	{
 		if(eaa == true) return;
-		fprintf(mFile,"\tsetAttr \".eaa\" %i;\n", eaa);
+		writeInt(mFile,"\tsetAttr \".eaa\" ",eaa,";\n");
 	}
 	void setEdgeClip(bool ecl)
 	{
 		if(ecl == false) return;
-		fprintf(mFile,"\tsetAttr \".ecl\" %i;\n", ecl);
+		writeInt(mFile,"\tsetAttr \".ecl\" ",ecl,";\n");
 	}
 	void setEdgeClipDepth(double ecd)
 	{
 		if(ecd == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".ecd\" %f;\n", ecd);
+		writeFloat(mFile,"\tsetAttr \".ecd\" ",ecd,";\n");
 	}
 	void setOcclusionWidthScale(bool ows)
 	{
 		if(ows == false) return;
-		fprintf(mFile,"\tsetAttr \".ows\" %i;\n", ows);
+		writeInt(mFile,"\tsetAttr \".ows\" ",ows,";\n");
 	}
 	void setBlurIntensity(int bin)
 	{
 		if(bin == 4) return;
-		fprintf(mFile,"\tsetAttr \".bin\" %i;\n", bin);
+		writeInt(mFile,"\tsetAttr \".bin\" ",bin,";\n");
 	}
 	void setColor1(const float3& cl1)
 	{
-		fprintf(mFile,"\tsetAttr \".cl1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cl1\" -type \"float3\" ");
 		cl1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor1R(float c1r)
 	{
 		if(c1r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl1.c1r\" %f;\n", c1r);
+		writeFloat(mFile,"\tsetAttr \".cl1.c1r\" ",c1r,";\n");
 	}
 	void setColor1G(float c1g)
 	{
 		if(c1g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl1.c1g\" %f;\n", c1g);
+		writeFloat(mFile,"\tsetAttr \".cl1.c1g\" ",c1g,";\n");
 	}
 	void setColor1B(float c1b)
 	{
 		if(c1b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl1.c1b\" %f;\n", c1b);
+		writeFloat(mFile,"\tsetAttr \".cl1.c1b\" ",c1b,";\n");
 	}
 	void setColor2(const float3& cl2)
 	{
-		fprintf(mFile,"\tsetAttr \".cl2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cl2\" -type \"float3\" ");
 		cl2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor2R(float c2r)
 	{
 		if(c2r == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cl2.c2r\" %f;\n", c2r);
+		writeFloat(mFile,"\tsetAttr \".cl2.c2r\" ",c2r,";\n");
 	}
 	void setColor2G(float c2g)
 	{
 		if(c2g == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cl2.c2g\" %f;\n", c2g);
+		writeFloat(mFile,"\tsetAttr \".cl2.c2g\" ",c2g,";\n");
 	}
 	void setColor2B(float c2b)
 	{
 		if(c2b == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cl2.c2b\" %f;\n", c2b);
+		writeFloat(mFile,"\tsetAttr \".cl2.c2b\" ",c2b,";\n");
 	}
 	void setTransparency1(const float3& tn1)
 	{
-		fprintf(mFile,"\tsetAttr \".tn1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".tn1\" -type \"float3\" ");
 		tn1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparency1R(float t1r)
 	{
 		if(t1r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tn1.t1r\" %f;\n", t1r);
+		writeFloat(mFile,"\tsetAttr \".tn1.t1r\" ",t1r,";\n");
 	}
 	void setTransparency1G(float t1g)
 	{
 		if(t1g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tn1.t1g\" %f;\n", t1g);
+		writeFloat(mFile,"\tsetAttr \".tn1.t1g\" ",t1g,";\n");
 	}
 	void setTransparency1B(float t1b)
 	{
 		if(t1b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tn1.t1b\" %f;\n", t1b);
+		writeFloat(mFile,"\tsetAttr \".tn1.t1b\" ",t1b,";\n");
 	}
 	void setTransparency2(const float3& tn2)
 	{
-		fprintf(mFile,"\tsetAttr \".tn2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".tn2\" -type \"float3\" ");
 		tn2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparency2R(float t2r)
 	{
 		if(t2r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tn2.t2r\" %f;\n", t2r);
+		writeFloat(mFile,"\tsetAttr \".tn2.t2r\" ",t2r,";\n");
 	}
 	void setTransparency2G(float t2g)
 	{
 		if(t2g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tn2.t2g\" %f;\n", t2g);
+		writeFloat(mFile,"\tsetAttr \".tn2.t2g\" ",t2g,";\n");
 	}
 	void setTransparency2B(float t2b)
 	{
 		if(t2b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tn2.t2b\" %f;\n", t2b);
+		writeFloat(mFile,"\tsetAttr \".tn2.t2b\" ",t2b,";\n");
 	}
 	void setIncandescence1(const float3& in1)
 	{
-		fprintf(mFile,"\tsetAttr \".in1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".in1\" -type \"float3\" ");
 		in1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescence1R(float i1r)
 	{
 		if(i1r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".in1.i1r\" %f;\n", i1r);
+		writeFloat(mFile,"\tsetAttr \".in1.i1r\" ",i1r,";\n");
 	}
 	void setIncandescence1G(float i1g)
 	{
 		if(i1g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".in1.i1g\" %f;\n", i1g);
+		writeFloat(mFile,"\tsetAttr \".in1.i1g\" ",i1g,";\n");
 	}
 	void setIncandescence1B(float i1b)
 	{
 		if(i1b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".in1.i1b\" %f;\n", i1b);
+		writeFloat(mFile,"\tsetAttr \".in1.i1b\" ",i1b,";\n");
 	}
 	void setIncandescence2(const float3& in2)
 	{
-		fprintf(mFile,"\tsetAttr \".in2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".in2\" -type \"float3\" ");
 		in2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescence2R(float i2r)
 	{
 		if(i2r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".in2.i2r\" %f;\n", i2r);
+		writeFloat(mFile,"\tsetAttr \".in2.i2r\" ",i2r,";\n");
 	}
 	void setIncandescence2G(float i2g)
 	{
 		if(i2g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".in2.i2g\" %f;\n", i2g);
+		writeFloat(mFile,"\tsetAttr \".in2.i2g\" ",i2g,";\n");
 	}
 	void setIncandescence2B(float i2b)
 	{
 		if(i2b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".in2.i2b\" %f;\n", i2b);
+		writeFloat(mFile,"\tsetAttr \".in2.i2b\" ",i2b,";\n");
 	}
 	void setSpecularColor(const float3& spc)
 	{
-		fprintf(mFile,"\tsetAttr \".spc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".spc\" -type \"float3\" ");
 		spc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColorR(float spr)
 	{
 		if(spr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".spc.spr\" %f;\n", spr);
+		writeFloat(mFile,"\tsetAttr \".spc.spr\" ",spr,";\n");
 	}
 	void setSpecularColorG(float spg)
 	{
 		if(spg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".spc.spg\" %f;\n", spg);
+		writeFloat(mFile,"\tsetAttr \".spc.spg\" ",spg,";\n");
 	}
 	void setSpecularColorB(float spb)
 	{
 		if(spb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".spc.spb\" %f;\n", spb);
+		writeFloat(mFile,"\tsetAttr \".spc.spb\" ",spb,";\n");
 	}
 	void setSpecular(double spe)
 	{
 		if(spe == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spe\" %f;\n", spe);
+		writeFloat(mFile,"\tsetAttr \".spe\" ",spe,";\n");
 	}
 	void setSpecularPower(double spp)
 	{
 		if(spp == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".spp\" %f;\n", spp);
+		writeFloat(mFile,"\tsetAttr \".spp\" ",spp,";\n");
 	}
 	void setTranslucence(double trn)
 	{
 		if(trn == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".trn\" %f;\n", trn);
+		writeFloat(mFile,"\tsetAttr \".trn\" ",trn,";\n");
 	}
 	void setGlow(double glw)
 	{
 		if(glw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".glw\" %f;\n", glw);
+		writeFloat(mFile,"\tsetAttr \".glw\" ",glw,";\n");
 	}
 	void setGlowColor(const float3& glc)
 	{
-		fprintf(mFile,"\tsetAttr \".glc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".glc\" -type \"float3\" ");
 		glc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlowColorR(float glr)
 	{
 		if(glr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".glc.glr\" %f;\n", glr);
+		writeFloat(mFile,"\tsetAttr \".glc.glr\" ",glr,";\n");
 	}
 	void setGlowColorG(float glg)
 	{
 		if(glg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".glc.glg\" %f;\n", glg);
+		writeFloat(mFile,"\tsetAttr \".glc.glg\" ",glg,";\n");
 	}
 	void setGlowColorB(float glb)
 	{
 		if(glb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".glc.glb\" %f;\n", glb);
+		writeFloat(mFile,"\tsetAttr \".glc.glb\" ",glb,";\n");
 	}
 	void setGlowSpread(double gls)
 	{
 		if(gls == 3.0) return;
-		fprintf(mFile,"\tsetAttr \".gls\" %f;\n", gls);
+		writeFloat(mFile,"\tsetAttr \".gls\" ",gls,";\n");
 	}
 	void setShaderGlow(double sgl)
 	{
 		if(sgl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sgl\" %f;\n", sgl);
+		writeFloat(mFile,"\tsetAttr \".sgl\" ",sgl,";\n");
 	}
 	void setHueRand(double chr)
 	{
 		if(chr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".chr\" %f;\n", chr);
+		writeFloat(mFile,"\tsetAttr \".chr\" ",chr,";\n");
 	}
 	void setSatRand(double csr)
 	{
 		if(csr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csr\" %f;\n", csr);
+		writeFloat(mFile,"\tsetAttr \".csr\" ",csr,";\n");
 	}
 	void setValRand(double cvr)
 	{
 		if(cvr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cvr\" %f;\n", cvr);
+		writeFloat(mFile,"\tsetAttr \".cvr\" ",cvr,";\n");
 	}
 	void setRootFade(double rfd)
 	{
 		if(rfd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rfd\" %f;\n", rfd);
+		writeFloat(mFile,"\tsetAttr \".rfd\" ",rfd,";\n");
 	}
 	void setTipFade(double tfd)
 	{
 		if(tfd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tfd\" %f;\n", tfd);
+		writeFloat(mFile,"\tsetAttr \".tfd\" ",tfd,";\n");
 	}
 	void setFakeShadow(unsigned int fks)
 	{
 		if(fks == 0) return;
-		fprintf(mFile,"\tsetAttr \".fks\" %i;\n", fks);
+		writeInt(mFile,"\tsetAttr \".fks\" ",fks,";\n");
 	}
 	void setShadowOffset(double sof)
 	{
 		if(sof == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sof\" %f;\n", sof);
+		writeFloat(mFile,"\tsetAttr \".sof\" ",sof,";\n");
 	}
 	void setShadowDiffusion(double sdf)
 	{
 		if(sdf == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".sdf\" %f;\n", sdf);
+		writeFloat(mFile,"\tsetAttr \".sdf\" ",sdf,";\n");
 	}
 	void setShadowTransparency(double stn)
 	{
 		if(stn == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".stn\" %f;\n", stn);
+		writeFloat(mFile,"\tsetAttr \".stn\" ",stn,";\n");
 	}
 	void setBackShadow(double bks)
 	{
 		if(bks == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bks\" %f;\n", bks);
+		writeFloat(mFile,"\tsetAttr \".bks\" ",bks,";\n");
 	}
 	void setBrightnessRand(double brn)
 	{
 		if(brn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".brn\" %f;\n", brn);
+		writeFloat(mFile,"\tsetAttr \".brn\" ",brn,";\n");
 	}
 	void setCenterShadow(double cns)
 	{
 		if(cns == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cns\" %f;\n", cns);
+		writeFloat(mFile,"\tsetAttr \".cns\" ",cns,";\n");
 	}
 	void setDepthShadowType(unsigned int dpt)
 	{
 		if(dpt == 0) return;
-		fprintf(mFile,"\tsetAttr \".dpt\" %i;\n", dpt);
+		writeInt(mFile,"\tsetAttr \".dpt\" ",dpt,";\n");
 	}
 	void setDepthShadow(double dpl)
 	{
 		if(dpl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dpl\" %f;\n", dpl);
+		writeFloat(mFile,"\tsetAttr \".dpl\" ",dpl,";\n");
 	}
 	void setDepthShadowDepth(double dps)
 	{
 		if(dps == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dps\" %f;\n", dps);
+		writeFloat(mFile,"\tsetAttr \".dps\" ",dps,";\n");
 	}
 	void setRealLights(bool rll)
 	{
 		if(rll == false) return;
-		fprintf(mFile,"\tsetAttr \".rll\" %i;\n", rll);
+		writeInt(mFile,"\tsetAttr \".rll\" ",rll,";\n");
 	}
 	void setLightDirection(const double3& ldr)
 	{
-		fprintf(mFile,"\tsetAttr \".ldr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ldr\" -type \"double3\" ");
 		ldr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLightDirectionX(double ldx)
 	{
 		if(ldx == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".ldr.ldx\" %f;\n", ldx);
+		writeFloat(mFile,"\tsetAttr \".ldr.ldx\" ",ldx,";\n");
 	}
 	void setLightDirectionY(double ldy)
 	{
 		if(ldy == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".ldr.ldy\" %f;\n", ldy);
+		writeFloat(mFile,"\tsetAttr \".ldr.ldy\" ",ldy,";\n");
 	}
 	void setLightDirectionZ(double ldz)
 	{
 		if(ldz == -0.5) return;
-		fprintf(mFile,"\tsetAttr \".ldr.ldz\" %f;\n", ldz);
+		writeFloat(mFile,"\tsetAttr \".ldr.ldz\" ",ldz,";\n");
 	}
 	void setGapSize(double gsz)
 	{
 		if(gsz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gsz\" %f;\n", gsz);
+		writeFloat(mFile,"\tsetAttr \".gsz\" ",gsz,";\n");
 	}
 	void setGapSpacing(double gsp)
 	{
 		if(gsp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gsp\" %f;\n", gsp);
+		writeFloat(mFile,"\tsetAttr \".gsp\" ",gsp,";\n");
 	}
 	void setGapRand(double grn)
 	{
 		if(grn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".grn\" %f;\n", grn);
+		writeFloat(mFile,"\tsetAttr \".grn\" ",grn,";\n");
 	}
 	void setFlowSpeed(double fws)
 	{
 		if(fws == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fws\" %f;\n", fws);
+		writeFloat(mFile,"\tsetAttr \".fws\" ",fws,";\n");
 	}
 	void setTextureFlow(bool tfl)
 	{
 		if(tfl == true) return;
-		fprintf(mFile,"\tsetAttr \".tfl\" %i;\n", tfl);
+		writeInt(mFile,"\tsetAttr \".tfl\" ",tfl,";\n");
 	}
 	void setTimeClip(bool tcl)
 	{
 		if(tcl == false) return;
-		fprintf(mFile,"\tsetAttr \".tcl\" %i;\n", tcl);
+		writeInt(mFile,"\tsetAttr \".tcl\" ",tcl,";\n");
 	}
 	void setStrokeTime(bool srm)
 	{
 		if(srm == false) return;
-		fprintf(mFile,"\tsetAttr \".srm\" %i;\n", srm);
+		writeInt(mFile,"\tsetAttr \".srm\" ",srm,";\n");
 	}
 	void setStartTime(double sti)
 	{
 		if(sti == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sti\" %f;\n", sti);
+		writeFloat(mFile,"\tsetAttr \".sti\" ",sti,";\n");
 	}
 	void setEndTime(double eti)
 	{
 		if(eti == 1000.0) return;
-		fprintf(mFile,"\tsetAttr \".eti\" %f;\n", eti);
+		writeFloat(mFile,"\tsetAttr \".eti\" ",eti,";\n");
 	}
 	void setTubes(bool tub)
 	{
 		if(tub == false) return;
-		fprintf(mFile,"\tsetAttr \".tub\" %i;\n", tub);
+		writeInt(mFile,"\tsetAttr \".tub\" ",tub,";\n");
 	}
 	void setCreationScript(const string& csc)
 	{
 		if(csc == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".csc\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".csc\" -type \"string\" ");
 		csc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRuntimeScript(const string& rsc)
 	{
 		if(rsc == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".rsc\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rsc\" -type \"string\" ");
 		rsc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTubeCompletion(bool tcm)
 	{
 		if(tcm == true) return;
-		fprintf(mFile,"\tsetAttr \".tcm\" %i;\n", tcm);
+		writeInt(mFile,"\tsetAttr \".tcm\" ",tcm,";\n");
 	}
 	void setTubesPerStep(double tps)
 	{
 		if(tps == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tps\" %f;\n", tps);
+		writeFloat(mFile,"\tsetAttr \".tps\" ",tps,";\n");
 	}
 	void setTubeRand(double trd)
 	{
 		if(trd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".trd\" %f;\n", trd);
+		writeFloat(mFile,"\tsetAttr \".trd\" ",trd,";\n");
 	}
 	void setStartTubes(int stb)
 	{
 		if(stb == 0) return;
-		fprintf(mFile,"\tsetAttr \".stb\" %i;\n", stb);
+		writeInt(mFile,"\tsetAttr \".stb\" ",stb,";\n");
 	}
 	void setLengthMax(double lnx)
 	{
 		if(lnx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lnx\" %f;\n", lnx);
+		writeFloat(mFile,"\tsetAttr \".lnx\" ",lnx,";\n");
 	}
 	void setLengthMin(double lnn)
 	{
 		if(lnn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lnn\" %f;\n", lnn);
+		writeFloat(mFile,"\tsetAttr \".lnn\" ",lnn,";\n");
 	}
 	void setSegments(int sgm)
 	{
 		if(sgm == 10) return;
-		fprintf(mFile,"\tsetAttr \".sgm\" %i;\n", sgm);
+		writeInt(mFile,"\tsetAttr \".sgm\" ",sgm,";\n");
 	}
 	void setTubeWidth1(double tw1)
 	{
 		if(tw1 == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".tw1\" %f;\n", tw1);
+		writeFloat(mFile,"\tsetAttr \".tw1\" ",tw1,";\n");
 	}
 	void setTubeWidth2(double tw2)
 	{
 		if(tw2 == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".tw2\" %f;\n", tw2);
+		writeFloat(mFile,"\tsetAttr \".tw2\" ",tw2,";\n");
 	}
 	void setWidthRand(double wdr)
 	{
 		if(wdr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wdr\" %f;\n", wdr);
+		writeFloat(mFile,"\tsetAttr \".wdr\" ",wdr,";\n");
 	}
 	void setWidthBias(double wdb)
 	{
 		if(wdb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wdb\" %f;\n", wdb);
+		writeFloat(mFile,"\tsetAttr \".wdb\" ",wdb,";\n");
 	}
 	void setLengthFlex(double lfx)
 	{
 		if(lfx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lfx\" %f;\n", lfx);
+		writeFloat(mFile,"\tsetAttr \".lfx\" ",lfx,";\n");
 	}
 	void setSegmentLengthBias(double sgb)
 	{
 		if(sgb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sgb\" %f;\n", sgb);
+		writeFloat(mFile,"\tsetAttr \".sgb\" ",sgb,";\n");
 	}
 	void setSegmentWidthBias(double swb)
 	{
 		if(swb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".swb\" %f;\n", swb);
+		writeFloat(mFile,"\tsetAttr \".swb\" ",swb,";\n");
 	}
 	void setTubeDirection(unsigned int tdr)
 	{
 		if(tdr == 0) return;
-		fprintf(mFile,"\tsetAttr \".tdr\" %i;\n", tdr);
+		writeInt(mFile,"\tsetAttr \".tdr\" ",tdr,";\n");
 	}
 	void setElevationMin(double elm)
 	{
 		if(elm == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".elm\" %f;\n", elm);
+		writeFloat(mFile,"\tsetAttr \".elm\" ",elm,";\n");
 	}
 	void setElevationMax(double elx)
 	{
 		if(elx == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".elx\" %f;\n", elx);
+		writeFloat(mFile,"\tsetAttr \".elx\" ",elx,";\n");
 	}
 	void setAzimuthMin(double azn)
 	{
 		if(azn == -0.1) return;
-		fprintf(mFile,"\tsetAttr \".azn\" %f;\n", azn);
+		writeFloat(mFile,"\tsetAttr \".azn\" ",azn,";\n");
 	}
 	void setAzimuthMax(double azx)
 	{
 		if(azx == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".azx\" %f;\n", azx);
+		writeFloat(mFile,"\tsetAttr \".azx\" ",azx,";\n");
 	}
 	void setFlatness1(double fl1)
 	{
 		if(fl1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fl1\" %f;\n", fl1);
+		writeFloat(mFile,"\tsetAttr \".fl1\" ",fl1,";\n");
 	}
 	void setFlatness2(double fl2)
 	{
 		if(fl2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fl2\" %f;\n", fl2);
+		writeFloat(mFile,"\tsetAttr \".fl2\" ",fl2,";\n");
 	}
 	void setTwist(double twi)
 	{
 		if(twi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".twi\" %f;\n", twi);
+		writeFloat(mFile,"\tsetAttr \".twi\" ",twi,";\n");
 	}
 	void setTwistRate(double twr)
 	{
 		if(twr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".twr\" %f;\n", twr);
+		writeFloat(mFile,"\tsetAttr \".twr\" ",twr,";\n");
 	}
 	void setTwistRand(double twd)
 	{
 		if(twd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".twd\" %f;\n", twd);
+		writeFloat(mFile,"\tsetAttr \".twd\" ",twd,";\n");
 	}
 	void setSpiralMin(double spm)
 	{
 		if(spm == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spm\" %f;\n", spm);
+		writeFloat(mFile,"\tsetAttr \".spm\" ",spm,";\n");
 	}
 	void setSpiralMax(double spx)
 	{
 		if(spx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spx\" %f;\n", spx);
+		writeFloat(mFile,"\tsetAttr \".spx\" ",spx,";\n");
 	}
 	void setSpiralDecay(double spd)
 	{
 		if(spd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spd\" %f;\n", spd);
+		writeFloat(mFile,"\tsetAttr \".spd\" ",spd,";\n");
 	}
 	void setBend(double ben)
 	{
 		if(ben == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ben\" %f;\n", ben);
+		writeFloat(mFile,"\tsetAttr \".ben\" ",ben,";\n");
 	}
 	void setBendBias(double bnb)
 	{
 		if(bnb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bnb\" %f;\n", bnb);
+		writeFloat(mFile,"\tsetAttr \".bnb\" ",bnb,";\n");
 	}
 	void setDisplacementDelay(double ddl)
 	{
 		if(ddl == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".ddl\" %f;\n", ddl);
+		writeFloat(mFile,"\tsetAttr \".ddl\" ",ddl,";\n");
 	}
 	void setWiggle(double wgl)
 	{
 		if(wgl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wgl\" %f;\n", wgl);
+		writeFloat(mFile,"\tsetAttr \".wgl\" ",wgl,";\n");
 	}
 	void setWiggleFrequency(double wgf)
 	{
 		if(wgf == 3) return;
-		fprintf(mFile,"\tsetAttr \".wgf\" %f;\n", wgf);
+		writeFloat(mFile,"\tsetAttr \".wgf\" ",wgf,";\n");
 	}
 	void setWiggleOffset(double wgo)
 	{
 		if(wgo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wgo\" %f;\n", wgo);
+		writeFloat(mFile,"\tsetAttr \".wgo\" ",wgo,";\n");
 	}
 	void setCurl(double crl)
 	{
 		if(crl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crl\" %f;\n", crl);
+		writeFloat(mFile,"\tsetAttr \".crl\" ",crl,";\n");
 	}
 	void setCurlFrequency(double crf)
 	{
 		if(crf == 1) return;
-		fprintf(mFile,"\tsetAttr \".crf\" %f;\n", crf);
+		writeFloat(mFile,"\tsetAttr \".crf\" ",crf,";\n");
 	}
 	void setCurlOffset(double cro)
 	{
 		if(cro == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cro\" %f;\n", cro);
+		writeFloat(mFile,"\tsetAttr \".cro\" ",cro,";\n");
 	}
 	void setNoise(double noi)
 	{
 		if(noi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".noi\" %f;\n", noi);
+		writeFloat(mFile,"\tsetAttr \".noi\" ",noi,";\n");
 	}
 	void setNoiseFrequency(double nof)
 	{
 		if(nof == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".nof\" %f;\n", nof);
+		writeFloat(mFile,"\tsetAttr \".nof\" ",nof,";\n");
 	}
 	void setNoiseOffset(double noo)
 	{
 		if(noo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".noo\" %f;\n", noo);
+		writeFloat(mFile,"\tsetAttr \".noo\" ",noo,";\n");
 	}
 	void setSplitMaxDepth(double smd)
 	{
 		if(smd == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".smd\" %f;\n", smd);
+		writeFloat(mFile,"\tsetAttr \".smd\" ",smd,";\n");
 	}
 	void setSplitRand(double srd)
 	{
 		if(srd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".srd\" %f;\n", srd);
+		writeFloat(mFile,"\tsetAttr \".srd\" ",srd,";\n");
 	}
 	void setSplitAngle(double spa)
 	{
 		if(spa == 30.0) return;
-		fprintf(mFile,"\tsetAttr \".spa\" %f;\n", spa);
+		writeFloat(mFile,"\tsetAttr \".spa\" ",spa,";\n");
 	}
 	void setSplitSizeDecay(double ssd)
 	{
 		if(ssd == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".ssd\" %f;\n", ssd);
+		writeFloat(mFile,"\tsetAttr \".ssd\" ",ssd,";\n");
 	}
 	void setSplitBias(double slb)
 	{
 		if(slb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".slb\" %f;\n", slb);
+		writeFloat(mFile,"\tsetAttr \".slb\" ",slb,";\n");
 	}
 	void setSplitTwist(double slt)
 	{
 		if(slt == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".slt\" %f;\n", slt);
+		writeFloat(mFile,"\tsetAttr \".slt\" ",slt,";\n");
 	}
 	void setStartBranches(double sbr)
 	{
 		if(sbr == 0) return;
-		fprintf(mFile,"\tsetAttr \".sbr\" %f;\n", sbr);
+		writeFloat(mFile,"\tsetAttr \".sbr\" ",sbr,";\n");
 	}
 	void setNumBranches(int nbr)
 	{
 		if(nbr == 2) return;
-		fprintf(mFile,"\tsetAttr \".nbr\" %i;\n", nbr);
+		writeInt(mFile,"\tsetAttr \".nbr\" ",nbr,";\n");
 	}
 	void setBranchDropout(double bdr)
 	{
 		if(bdr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bdr\" %f;\n", bdr);
+		writeFloat(mFile,"\tsetAttr \".bdr\" ",bdr,";\n");
 	}
 	void setMiddleBranch(bool mbr)
 	{
 		if(mbr == false) return;
-		fprintf(mFile,"\tsetAttr \".mbr\" %i;\n", mbr);
+		writeInt(mFile,"\tsetAttr \".mbr\" ",mbr,";\n");
 	}
 	void setMinSize(double mms)
 	{
 		if(mms == 0.0001) return;
-		fprintf(mFile,"\tsetAttr \".mms\" %f;\n", mms);
+		writeFloat(mFile,"\tsetAttr \".mms\" ",mms,";\n");
 	}
 	void setPathFollow(double pfl)
 	{
 		if(pfl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pfl\" %f;\n", pfl);
+		writeFloat(mFile,"\tsetAttr \".pfl\" ",pfl,";\n");
 	}
 	void setPathAttract(double pat)
 	{
 		if(pat == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pat\" %f;\n", pat);
+		writeFloat(mFile,"\tsetAttr \".pat\" ",pat,";\n");
 	}
 	void setCurveFollow(double cfw)
 	{
 		if(cfw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfw\" %f;\n", cfw);
+		writeFloat(mFile,"\tsetAttr \".cfw\" ",cfw,";\n");
 	}
 	void setCurveAttract(double cva)
 	{
 		if(cva == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cva\" %f;\n", cva);
+		writeFloat(mFile,"\tsetAttr \".cva\" ",cva,";\n");
 	}
 	void setCurveMaxDist(double cmd)
 	{
 		if(cmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cmd\" %f;\n", cmd);
+		writeFloat(mFile,"\tsetAttr \".cmd\" ",cmd,";\n");
 	}
 	void setUniformForce(const double3& ufr)
 	{
-		fprintf(mFile,"\tsetAttr \".ufr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ufr\" -type \"double3\" ");
 		ufr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUniformForceX(double ufx)
 	{
 		if(ufx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ufr.ufx\" %f;\n", ufx);
+		writeFloat(mFile,"\tsetAttr \".ufr.ufx\" ",ufx,";\n");
 	}
 	void setUniformForceY(double ufy)
 	{
 		if(ufy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ufr.ufy\" %f;\n", ufy);
+		writeFloat(mFile,"\tsetAttr \".ufr.ufy\" ",ufy,";\n");
 	}
 	void setUniformForceZ(double ufz)
 	{
 		if(ufz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ufr.ufz\" %f;\n", ufz);
+		writeFloat(mFile,"\tsetAttr \".ufr.ufz\" ",ufz,";\n");
 	}
 	void setTurbulenceType(unsigned int trt)
 	{
 		if(trt == 0) return;
-		fprintf(mFile,"\tsetAttr \".trt\" %i;\n", trt);
+		writeInt(mFile,"\tsetAttr \".trt\" ",trt,";\n");
 	}
 	void setTurbulenceInterpolation(unsigned int tin)
 	{
 		if(tin == 0) return;
-		fprintf(mFile,"\tsetAttr \".tin\" %i;\n", tin);
+		writeInt(mFile,"\tsetAttr \".tin\" ",tin,";\n");
 	}
 	void setTurbulence(double tur)
 	{
 		if(tur == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".tur\" %f;\n", tur);
+		writeFloat(mFile,"\tsetAttr \".tur\" ",tur,";\n");
 	}
 	void setTurbulenceFrequency(double trf)
 	{
 		if(trf == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".trf\" %f;\n", trf);
+		writeFloat(mFile,"\tsetAttr \".trf\" ",trf,";\n");
 	}
 	void setTurbulenceSpeed(double trs)
 	{
 		if(trs == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".trs\" %f;\n", trs);
+		writeFloat(mFile,"\tsetAttr \".trs\" ",trs,";\n");
 	}
 	void setTurbulenceOffset(const double3& tro)
 	{
-		fprintf(mFile,"\tsetAttr \".tro\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".tro\" -type \"double3\" ");
 		tro.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTurbulenceOffsetX(double trx)
 	{
 		if(trx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tro.trx\" %f;\n", trx);
+		writeFloat(mFile,"\tsetAttr \".tro.trx\" ",trx,";\n");
 	}
 	void setTurbulenceOffsetY(double try_)
 	{
 		if(try_ == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tro.try\" %f;\n", try_);
+		writeFloat(mFile,"\tsetAttr \".tro.try\" ",try_,";\n");
 	}
 	void setTurbulenceOffsetZ(double trz)
 	{
 		if(trz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tro.trz\" %f;\n", trz);
+		writeFloat(mFile,"\tsetAttr \".tro.trz\" ",trz,";\n");
 	}
 	void setRandom(double ran)
 	{
 		if(ran == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ran\" %f;\n", ran);
+		writeFloat(mFile,"\tsetAttr \".ran\" ",ran,";\n");
 	}
 	void setGravity(double grv)
 	{
 		if(grv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".grv\" %f;\n", grv);
+		writeFloat(mFile,"\tsetAttr \".grv\" ",grv,";\n");
 	}
 	void setMomentum(double mmt)
 	{
 		if(mmt == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mmt\" %f;\n", mmt);
+		writeFloat(mFile,"\tsetAttr \".mmt\" ",mmt,";\n");
 	}
 	void setDeflection(bool def)
 	{
 		if(def == false) return;
-		fprintf(mFile,"\tsetAttr \".def\" %i;\n", def);
+		writeInt(mFile,"\tsetAttr \".def\" ",def,";\n");
 	}
 	void setDeflectionMin(double dfm)
 	{
 		if(dfm == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dfm\" %f;\n", dfm);
+		writeFloat(mFile,"\tsetAttr \".dfm\" ",dfm,";\n");
 	}
 	void setDeflectionMax(double dfx)
 	{
 		if(dfx == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".dfx\" %f;\n", dfx);
+		writeFloat(mFile,"\tsetAttr \".dfx\" ",dfx,";\n");
 	}
 	void setTwigsInCluster(int tic)
 	{
 		if(tic == 1) return;
-		fprintf(mFile,"\tsetAttr \".tic\" %i;\n", tic);
+		writeInt(mFile,"\tsetAttr \".tic\" ",tic,";\n");
 	}
 	void setTwigDropout(double tdp)
 	{
 		if(tdp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tdp\" %f;\n", tdp);
+		writeFloat(mFile,"\tsetAttr \".tdp\" ",tdp,";\n");
 	}
 	void setTwigAngle1(double ta1)
 	{
 		if(ta1 == 90.0) return;
-		fprintf(mFile,"\tsetAttr \".ta1\" %f;\n", ta1);
+		writeFloat(mFile,"\tsetAttr \".ta1\" ",ta1,";\n");
 	}
 	void setTwigAngle2(double ta2)
 	{
 		if(ta2 == 80.0) return;
-		fprintf(mFile,"\tsetAttr \".ta2\" %f;\n", ta2);
+		writeFloat(mFile,"\tsetAttr \".ta2\" ",ta2,";\n");
 	}
 	void setTwigTwist(double ttw)
 	{
 		if(ttw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ttw\" %f;\n", ttw);
+		writeFloat(mFile,"\tsetAttr \".ttw\" ",ttw,";\n");
 	}
 	void setTwigLength(double twl)
 	{
 		if(twl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".twl\" %f;\n", twl);
+		writeFloat(mFile,"\tsetAttr \".twl\" ",twl,";\n");
 	}
 	void setTwigStart(double tst)
 	{
 		if(tst == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tst\" %f;\n", tst);
+		writeFloat(mFile,"\tsetAttr \".tst\" ",tst,";\n");
 	}
 	void setNumTwigClusters(double ntc)
 	{
 		if(ntc == 4) return;
-		fprintf(mFile,"\tsetAttr \".ntc\" %f;\n", ntc);
+		writeFloat(mFile,"\tsetAttr \".ntc\" ",ntc,";\n");
 	}
 	void setTwigBaseWidth(double twb)
 	{
 		if(twb == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".twb\" %f;\n", twb);
+		writeFloat(mFile,"\tsetAttr \".twb\" ",twb,";\n");
 	}
 	void setTwigTipWidth(double twt)
 	{
 		if(twt == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".twt\" %f;\n", twt);
+		writeFloat(mFile,"\tsetAttr \".twt\" ",twt,";\n");
 	}
 	void setTwigStiffness(double tgs)
 	{
 		if(tgs == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tgs\" %f;\n", tgs);
+		writeFloat(mFile,"\tsetAttr \".tgs\" ",tgs,";\n");
 	}
 	void setBranchAfterTwigs(bool bat)
 	{
 		if(bat == false) return;
-		fprintf(mFile,"\tsetAttr \".bat\" %i;\n", bat);
+		writeInt(mFile,"\tsetAttr \".bat\" ",bat,";\n");
 	}
 	void setLeavesInCluster(int lic)
 	{
 		if(lic == 1) return;
-		fprintf(mFile,"\tsetAttr \".lic\" %i;\n", lic);
+		writeInt(mFile,"\tsetAttr \".lic\" ",lic,";\n");
 	}
 	void setLeafLocation(unsigned int llo)
 	{
 		if(llo == 0) return;
-		fprintf(mFile,"\tsetAttr \".llo\" %i;\n", llo);
+		writeInt(mFile,"\tsetAttr \".llo\" ",llo,";\n");
 	}
 	void setLeafDropout(double ldp)
 	{
 		if(ldp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ldp\" %f;\n", ldp);
+		writeFloat(mFile,"\tsetAttr \".ldp\" ",ldp,";\n");
 	}
 	void setLeafAngle1(double ll1)
 	{
 		if(ll1 == 75.0) return;
-		fprintf(mFile,"\tsetAttr \".ll1\" %f;\n", ll1);
+		writeFloat(mFile,"\tsetAttr \".ll1\" ",ll1,";\n");
 	}
 	void setLeafAngle2(double ll2)
 	{
 		if(ll2 == 25.0) return;
-		fprintf(mFile,"\tsetAttr \".ll2\" %f;\n", ll2);
+		writeFloat(mFile,"\tsetAttr \".ll2\" ",ll2,";\n");
 	}
 	void setLeafTwist(double ltw)
 	{
 		if(ltw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ltw\" %f;\n", ltw);
+		writeFloat(mFile,"\tsetAttr \".ltw\" ",ltw,";\n");
 	}
 	void setLeafBend(double lbn)
 	{
 		if(lbn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lbn\" %f;\n", lbn);
+		writeFloat(mFile,"\tsetAttr \".lbn\" ",lbn,";\n");
 	}
 	void setLeafCurl(size_t lcl_i,const LeafCurl& lcl)
 	{
-		fprintf(mFile,"\tsetAttr \".lcl[%i]\" ",lcl_i);
+		writeInt(mFile,"\tsetAttr \".lcl[",lcl_i,"]\" ");
 		lcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeafCurl(size_t lcl_start,size_t lcl_end,LeafCurl* lcl)
 	{
-		fprintf(mFile,"\tsetAttr \".lcl[%i:%i]\" ", lcl_start,lcl_end);
+		writeInt(mFile,"\tsetAttr \".lcl[",lcl_start); writeInt(mFile,":",lcl_end,"]\" ");
 		size_t size = (lcl_end-lcl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			lcl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLeafCurl(size_t lcl_start,size_t lcl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".lcl[%i:%i]\"",lcl_start,lcl_end);
-		fprintf(mFile," -type \"LeafCurl\" ");
+		writeInt(mFile,"\tsetAttr \".lcl[",lcl_start); writeInt(mFile,":",lcl_end,"]\"");
+		writeString(mFile," -type \"LeafCurl\" ");
 	}
 	void appendLeafCurl(const LeafCurl& lcl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		lcl.write(mFile);
 	}
 	void endLeafCurl()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeafCurl_Position(size_t lcl_i,float lclp)
 	{
 		if(lclp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lcl[%i].lclp\" %f;\n", lcl_i,lclp);
+		writeInt(mFile,"\tsetAttr \".lcl[",lcl_i); writeFloat(mFile,"].lclp\" ",lclp,";\n");
 	}
 	void setLeafCurl_FloatValue(size_t lcl_i,float lclfv)
 	{
 		if(lclfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lcl[%i].lclfv\" %f;\n", lcl_i,lclfv);
+		writeInt(mFile,"\tsetAttr \".lcl[",lcl_i); writeFloat(mFile,"].lclfv\" ",lclfv,";\n");
 	}
 	void setLeafCurl_Interp(size_t lcl_i,unsigned int lcli)
 	{
 		if(lcli == 0) return;
-		fprintf(mFile,"\tsetAttr \".lcl[%i].lcli\" %i;\n", lcl_i,lcli);
+		writeInt(mFile,"\tsetAttr \".lcl[",lcl_i); writeInt(mFile,"].lcli\" ",lcli,";\n");
 	}
 	void setLeafTwirl(double ltwl)
 	{
 		if(ltwl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ltwl\" %f;\n", ltwl);
+		writeFloat(mFile,"\tsetAttr \".ltwl\" ",ltwl,";\n");
 	}
 	void setLeafSegments(int lsg)
 	{
 		if(lsg == 5) return;
-		fprintf(mFile,"\tsetAttr \".lsg\" %i;\n", lsg);
+		writeInt(mFile,"\tsetAttr \".lsg\" ",lsg,";\n");
 	}
 	void setLeafStart(double lst)
 	{
 		if(lst == .5) return;
-		fprintf(mFile,"\tsetAttr \".lst\" %f;\n", lst);
+		writeFloat(mFile,"\tsetAttr \".lst\" ",lst,";\n");
 	}
 	void setNumLeafClusters(double nlc)
 	{
 		if(nlc == 3) return;
-		fprintf(mFile,"\tsetAttr \".nlc\" %f;\n", nlc);
+		writeFloat(mFile,"\tsetAttr \".nlc\" ",nlc,";\n");
 	}
 	void setLeafFlatness(double lft)
 	{
 		if(lft == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lft\" %f;\n", lft);
+		writeFloat(mFile,"\tsetAttr \".lft\" ",lft,";\n");
 	}
 	void setLeafLength(double lln)
 	{
 		if(lln == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".lln\" %f;\n", lln);
+		writeFloat(mFile,"\tsetAttr \".lln\" ",lln,";\n");
 	}
 	void setLeafBaseWidth(double leb)
 	{
 		if(leb == 0.15) return;
-		fprintf(mFile,"\tsetAttr \".leb\" %f;\n", leb);
+		writeFloat(mFile,"\tsetAttr \".leb\" ",leb,";\n");
 	}
 	void setLeafTipWidth(double let)
 	{
 		if(let == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".let\" %f;\n", let);
+		writeFloat(mFile,"\tsetAttr \".let\" ",let,";\n");
 	}
 	void setLeafSizeDecay(double lsd)
 	{
 		if(lsd == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".lsd\" %f;\n", lsd);
+		writeFloat(mFile,"\tsetAttr \".lsd\" ",lsd,";\n");
 	}
 	void setLeafTranslucence(double ltr)
 	{
 		if(ltr == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".ltr\" %f;\n", ltr);
+		writeFloat(mFile,"\tsetAttr \".ltr\" ",ltr,";\n");
 	}
 	void setLeafSpecular(double lsp)
 	{
 		if(lsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lsp\" %f;\n", lsp);
+		writeFloat(mFile,"\tsetAttr \".lsp\" ",lsp,";\n");
 	}
 	void setTerminalLeaf(bool tml)
 	{
 		if(tml == false) return;
-		fprintf(mFile,"\tsetAttr \".tml\" %i;\n", tml);
+		writeInt(mFile,"\tsetAttr \".tml\" ",tml,";\n");
 	}
 	void setLeafColor1(const float3& lc1)
 	{
-		fprintf(mFile,"\tsetAttr \".lc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lc1\" -type \"float3\" ");
 		lc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeafColor1R(float lr1)
 	{
 		if(lr1 == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".lc1.lr1\" %f;\n", lr1);
+		writeFloat(mFile,"\tsetAttr \".lc1.lr1\" ",lr1,";\n");
 	}
 	void setLeafColor1G(float lg1)
 	{
 		if(lg1 == 0.6) return;
-		fprintf(mFile,"\tsetAttr \".lc1.lg1\" %f;\n", lg1);
+		writeFloat(mFile,"\tsetAttr \".lc1.lg1\" ",lg1,";\n");
 	}
 	void setLeafColor1B(float lb1)
 	{
 		if(lb1 == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".lc1.lb1\" %f;\n", lb1);
+		writeFloat(mFile,"\tsetAttr \".lc1.lb1\" ",lb1,";\n");
 	}
 	void setLeafColor2(const float3& lc2)
 	{
-		fprintf(mFile,"\tsetAttr \".lc2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lc2\" -type \"float3\" ");
 		lc2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeafColor2R(float lr2)
 	{
 		if(lr2 == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".lc2.lr2\" %f;\n", lr2);
+		writeFloat(mFile,"\tsetAttr \".lc2.lr2\" ",lr2,";\n");
 	}
 	void setLeafColor2G(float lg2)
 	{
 		if(lg2 == 0.6) return;
-		fprintf(mFile,"\tsetAttr \".lc2.lg2\" %f;\n", lg2);
+		writeFloat(mFile,"\tsetAttr \".lc2.lg2\" ",lg2,";\n");
 	}
 	void setLeafColor2B(float lb2)
 	{
 		if(lb2 == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".lc2.lb2\" %f;\n", lb2);
+		writeFloat(mFile,"\tsetAttr \".lc2.lb2\" ",lb2,";\n");
 	}
 	void setLeafHueRand(double lhr)
 	{
 		if(lhr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lhr\" %f;\n", lhr);
+		writeFloat(mFile,"\tsetAttr \".lhr\" ",lhr,";\n");
 	}
 	void setLeafSatRand(double lsr)
 	{
 		if(lsr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lsr\" %f;\n", lsr);
+		writeFloat(mFile,"\tsetAttr \".lsr\" ",lsr,";\n");
 	}
 	void setLeafValRand(double lvr)
 	{
 		if(lvr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lvr\" %f;\n", lvr);
+		writeFloat(mFile,"\tsetAttr \".lvr\" ",lvr,";\n");
 	}
 	void setLeafUseBranchTex(bool lub)
 	{
 		if(lub == true) return;
-		fprintf(mFile,"\tsetAttr \".lub\" %i;\n", lub);
+		writeInt(mFile,"\tsetAttr \".lub\" ",lub,";\n");
 	}
 	void setLeafImage(const string& lim)
 	{
 		if(lim == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".lim\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".lim\" -type \"string\" ");
 		lim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeafStiffness(double lfs)
 	{
 		if(lfs == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".lfs\" %f;\n", lfs);
+		writeFloat(mFile,"\tsetAttr \".lfs\" ",lfs,";\n");
 	}
 	void setBudSize(double bds)
 	{
 		if(bds == 0.03) return;
-		fprintf(mFile,"\tsetAttr \".bds\" %f;\n", bds);
+		writeFloat(mFile,"\tsetAttr \".bds\" ",bds,";\n");
 	}
 	void setBudColor(const float3& bcr)
 	{
-		fprintf(mFile,"\tsetAttr \".bcr\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".bcr\" -type \"float3\" ");
 		bcr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBudColorR(float bur)
 	{
 		if(bur == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".bcr.bur\" %f;\n", bur);
+		writeFloat(mFile,"\tsetAttr \".bcr.bur\" ",bur,";\n");
 	}
 	void setBudColorG(float bug)
 	{
 		if(bug == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".bcr.bug\" %f;\n", bug);
+		writeFloat(mFile,"\tsetAttr \".bcr.bug\" ",bug,";\n");
 	}
 	void setBudColorB(float bub)
 	{
 		if(bub == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".bcr.bub\" %f;\n", bub);
+		writeFloat(mFile,"\tsetAttr \".bcr.bub\" ",bub,";\n");
 	}
 	void setPetalsInFlower(int pif)
 	{
 		if(pif == 1) return;
-		fprintf(mFile,"\tsetAttr \".pif\" %i;\n", pif);
+		writeInt(mFile,"\tsetAttr \".pif\" ",pif,";\n");
 	}
 	void setFlowerLocation(unsigned int flc)
 	{
 		if(flc == 0) return;
-		fprintf(mFile,"\tsetAttr \".flc\" %i;\n", flc);
+		writeInt(mFile,"\tsetAttr \".flc\" ",flc,";\n");
 	}
 	void setPetalDropout(double pdp)
 	{
 		if(pdp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pdp\" %f;\n", pdp);
+		writeFloat(mFile,"\tsetAttr \".pdp\" ",pdp,";\n");
 	}
 	void setFlowerAngle1(double fw1)
 	{
 		if(fw1 == 75.0) return;
-		fprintf(mFile,"\tsetAttr \".fw1\" %f;\n", fw1);
+		writeFloat(mFile,"\tsetAttr \".fw1\" ",fw1,";\n");
 	}
 	void setFlowerAngle2(double fw2)
 	{
 		if(fw2 == 25.0) return;
-		fprintf(mFile,"\tsetAttr \".fw2\" %f;\n", fw2);
+		writeFloat(mFile,"\tsetAttr \".fw2\" ",fw2,";\n");
 	}
 	void setFlowerTwist(double ftw)
 	{
 		if(ftw == 0.23) return;
-		fprintf(mFile,"\tsetAttr \".ftw\" %f;\n", ftw);
+		writeFloat(mFile,"\tsetAttr \".ftw\" ",ftw,";\n");
 	}
 	void setPetalBend(double pbn)
 	{
 		if(pbn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pbn\" %f;\n", pbn);
+		writeFloat(mFile,"\tsetAttr \".pbn\" ",pbn,";\n");
 	}
 	void setPetalCurl(size_t pcl_i,const PetalCurl& pcl)
 	{
-		fprintf(mFile,"\tsetAttr \".pcl[%i]\" ",pcl_i);
+		writeInt(mFile,"\tsetAttr \".pcl[",pcl_i,"]\" ");
 		pcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPetalCurl(size_t pcl_start,size_t pcl_end,PetalCurl* pcl)
 	{
-		fprintf(mFile,"\tsetAttr \".pcl[%i:%i]\" ", pcl_start,pcl_end);
+		writeInt(mFile,"\tsetAttr \".pcl[",pcl_start); writeInt(mFile,":",pcl_end,"]\" ");
 		size_t size = (pcl_end-pcl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			pcl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPetalCurl(size_t pcl_start,size_t pcl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pcl[%i:%i]\"",pcl_start,pcl_end);
-		fprintf(mFile," -type \"PetalCurl\" ");
+		writeInt(mFile,"\tsetAttr \".pcl[",pcl_start); writeInt(mFile,":",pcl_end,"]\"");
+		writeString(mFile," -type \"PetalCurl\" ");
 	}
 	void appendPetalCurl(const PetalCurl& pcl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		pcl.write(mFile);
 	}
 	void endPetalCurl()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPetalCurl_Position(size_t pcl_i,float pclp)
 	{
 		if(pclp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pcl[%i].pclp\" %f;\n", pcl_i,pclp);
+		writeInt(mFile,"\tsetAttr \".pcl[",pcl_i); writeFloat(mFile,"].pclp\" ",pclp,";\n");
 	}
 	void setPetalCurl_FloatValue(size_t pcl_i,float pclfv)
 	{
 		if(pclfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pcl[%i].pclfv\" %f;\n", pcl_i,pclfv);
+		writeInt(mFile,"\tsetAttr \".pcl[",pcl_i); writeFloat(mFile,"].pclfv\" ",pclfv,";\n");
 	}
 	void setPetalCurl_Interp(size_t pcl_i,unsigned int pcli)
 	{
 		if(pcli == 0) return;
-		fprintf(mFile,"\tsetAttr \".pcl[%i].pcli\" %i;\n", pcl_i,pcli);
+		writeInt(mFile,"\tsetAttr \".pcl[",pcl_i); writeInt(mFile,"].pcli\" ",pcli,";\n");
 	}
 	void setPetalTwirl(double lpwl)
 	{
 		if(lpwl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lpwl\" %f;\n", lpwl);
+		writeFloat(mFile,"\tsetAttr \".lpwl\" ",lpwl,";\n");
 	}
 	void setPetalSegments(int psg)
 	{
 		if(psg == 5) return;
-		fprintf(mFile,"\tsetAttr \".psg\" %i;\n", psg);
+		writeInt(mFile,"\tsetAttr \".psg\" ",psg,";\n");
 	}
 	void setFlowerStart(double fst)
 	{
 		if(fst == 1) return;
-		fprintf(mFile,"\tsetAttr \".fst\" %f;\n", fst);
+		writeFloat(mFile,"\tsetAttr \".fst\" ",fst,";\n");
 	}
 	void setNumFlowers(double nfl)
 	{
 		if(nfl == 10) return;
-		fprintf(mFile,"\tsetAttr \".nfl\" %f;\n", nfl);
+		writeFloat(mFile,"\tsetAttr \".nfl\" ",nfl,";\n");
 	}
 	void setPetalFlatness(double pft)
 	{
 		if(pft == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pft\" %f;\n", pft);
+		writeFloat(mFile,"\tsetAttr \".pft\" ",pft,";\n");
 	}
 	void setPetalLength(double pln)
 	{
 		if(pln == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".pln\" %f;\n", pln);
+		writeFloat(mFile,"\tsetAttr \".pln\" ",pln,";\n");
 	}
 	void setPetalBaseWidth(double ptb)
 	{
 		if(ptb == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".ptb\" %f;\n", ptb);
+		writeFloat(mFile,"\tsetAttr \".ptb\" ",ptb,";\n");
 	}
 	void setPetalTipWidth(double ptt)
 	{
 		if(ptt == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".ptt\" %f;\n", ptt);
+		writeFloat(mFile,"\tsetAttr \".ptt\" ",ptt,";\n");
 	}
 	void setFlowerSizeDecay(double fsd)
 	{
 		if(fsd == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".fsd\" %f;\n", fsd);
+		writeFloat(mFile,"\tsetAttr \".fsd\" ",fsd,";\n");
 	}
 	void setFlowerTranslucence(double ftr)
 	{
 		if(ftr == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".ftr\" %f;\n", ftr);
+		writeFloat(mFile,"\tsetAttr \".ftr\" ",ftr,";\n");
 	}
 	void setFlowerSpecular(double fsp)
 	{
 		if(fsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fsp\" %f;\n", fsp);
+		writeFloat(mFile,"\tsetAttr \".fsp\" ",fsp,";\n");
 	}
 	void setPetalColor1(const float3& pc1)
 	{
-		fprintf(mFile,"\tsetAttr \".pc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pc1\" -type \"float3\" ");
 		pc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPetalColor1R(float pr1)
 	{
 		if(pr1 == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".pc1.pr1\" %f;\n", pr1);
+		writeFloat(mFile,"\tsetAttr \".pc1.pr1\" ",pr1,";\n");
 	}
 	void setPetalColor1G(float pg1)
 	{
 		if(pg1 == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".pc1.pg1\" %f;\n", pg1);
+		writeFloat(mFile,"\tsetAttr \".pc1.pg1\" ",pg1,";\n");
 	}
 	void setPetalColor1B(float pb1)
 	{
 		if(pb1 == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".pc1.pb1\" %f;\n", pb1);
+		writeFloat(mFile,"\tsetAttr \".pc1.pb1\" ",pb1,";\n");
 	}
 	void setPetalColor2(const float3& pc2)
 	{
-		fprintf(mFile,"\tsetAttr \".pc2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pc2\" -type \"float3\" ");
 		pc2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPetalColor2R(float pr2)
 	{
 		if(pr2 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pc2.pr2\" %f;\n", pr2);
+		writeFloat(mFile,"\tsetAttr \".pc2.pr2\" ",pr2,";\n");
 	}
 	void setPetalColor2G(float pg2)
 	{
 		if(pg2 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pc2.pg2\" %f;\n", pg2);
+		writeFloat(mFile,"\tsetAttr \".pc2.pg2\" ",pg2,";\n");
 	}
 	void setPetalColor2B(float pb2)
 	{
 		if(pb2 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pc2.pb2\" %f;\n", pb2);
+		writeFloat(mFile,"\tsetAttr \".pc2.pb2\" ",pb2,";\n");
 	}
 	void setFlowerHueRand(double fhr)
 	{
 		if(fhr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fhr\" %f;\n", fhr);
+		writeFloat(mFile,"\tsetAttr \".fhr\" ",fhr,";\n");
 	}
 	void setFlowerSatRand(double fsr)
 	{
 		if(fsr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fsr\" %f;\n", fsr);
+		writeFloat(mFile,"\tsetAttr \".fsr\" ",fsr,";\n");
 	}
 	void setFlowerValRand(double fvr)
 	{
 		if(fvr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fvr\" %f;\n", fvr);
+		writeFloat(mFile,"\tsetAttr \".fvr\" ",fvr,";\n");
 	}
 	void setFlowerUseBranchTex(bool fub)
 	{
 		if(fub == true) return;
-		fprintf(mFile,"\tsetAttr \".fub\" %i;\n", fub);
+		writeInt(mFile,"\tsetAttr \".fub\" ",fub,";\n");
 	}
 	void setFlowerImage(const string& fim)
 	{
 		if(fim == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".fim\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".fim\" -type \"string\" ");
 		fim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFlowerStiffness(double fls)
 	{
 		if(fls == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".fls\" %f;\n", fls);
+		writeFloat(mFile,"\tsetAttr \".fls\" ",fls,";\n");
 	}
 	void setSimplifyMethod(unsigned int smp)
 	{
 		if(smp == 0) return;
-		fprintf(mFile,"\tsetAttr \".smp\" %i;\n", smp);
+		writeInt(mFile,"\tsetAttr \".smp\" ",smp,";\n");
 	}
 	void setColorLengthMap(unsigned int clm)
 	{
 		if(clm == 0) return;
-		fprintf(mFile,"\tsetAttr \".clm\" %i;\n", clm);
+		writeInt(mFile,"\tsetAttr \".clm\" ",clm,";\n");
 	}
 	void setTranspLengthMap(unsigned int tlm)
 	{
 		if(tlm == 0) return;
-		fprintf(mFile,"\tsetAttr \".tlm\" %i;\n", tlm);
+		writeInt(mFile,"\tsetAttr \".tlm\" ",tlm,";\n");
 	}
 	void setIncandLengthMap(unsigned int ilm)
 	{
 		if(ilm == 0) return;
-		fprintf(mFile,"\tsetAttr \".ilm\" %i;\n", ilm);
+		writeInt(mFile,"\tsetAttr \".ilm\" ",ilm,";\n");
 	}
 	void setWidthLengthMap(unsigned int wlm)
 	{
 		if(wlm == 0) return;
-		fprintf(mFile,"\tsetAttr \".wlm\" %i;\n", wlm);
+		writeInt(mFile,"\tsetAttr \".wlm\" ",wlm,";\n");
 	}
 	void setSplitLengthMap(unsigned int spl)
 	{
 		if(spl == 0) return;
-		fprintf(mFile,"\tsetAttr \".spl\" %i;\n", spl);
+		writeInt(mFile,"\tsetAttr \".spl\" ",spl,";\n");
 	}
 	void setMapColor(bool mcl)
 	{
 		if(mcl == false) return;
-		fprintf(mFile,"\tsetAttr \".mcl\" %i;\n", mcl);
+		writeInt(mFile,"\tsetAttr \".mcl\" ",mcl,";\n");
 	}
 	void setMapOpacity(bool mop)
 	{
 		if(mop == false) return;
-		fprintf(mFile,"\tsetAttr \".mop\" %i;\n", mop);
+		writeInt(mFile,"\tsetAttr \".mop\" ",mop,";\n");
 	}
 	void setMapDisplacement(bool mds)
 	{
 		if(mds == false) return;
-		fprintf(mFile,"\tsetAttr \".mds\" %i;\n", mds);
+		writeInt(mFile,"\tsetAttr \".mds\" ",mds,";\n");
 	}
 	void setTextureType(unsigned int txt)
 	{
 		if(txt == 0) return;
-		fprintf(mFile,"\tsetAttr \".txt\" %i;\n", txt);
+		writeInt(mFile,"\tsetAttr \".txt\" ",txt,";\n");
 	}
 	void setMapMethod(unsigned int mmd)
 	{
 		if(mmd == 0) return;
-		fprintf(mFile,"\tsetAttr \".mmd\" %i;\n", mmd);
+		writeInt(mFile,"\tsetAttr \".mmd\" ",mmd,";\n");
 	}
 	void setTexColorScale(double tcs)
 	{
 		if(tcs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tcs\" %f;\n", tcs);
+		writeFloat(mFile,"\tsetAttr \".tcs\" ",tcs,";\n");
 	}
 	void setTexColorOffset(double tco)
 	{
 		if(tco == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tco\" %f;\n", tco);
+		writeFloat(mFile,"\tsetAttr \".tco\" ",tco,";\n");
 	}
 	void setTexOpacityScale(double tos)
 	{
 		if(tos == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tos\" %f;\n", tos);
+		writeFloat(mFile,"\tsetAttr \".tos\" ",tos,";\n");
 	}
 	void setTexOpacityOffset(double too)
 	{
 		if(too == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".too\" %f;\n", too);
+		writeFloat(mFile,"\tsetAttr \".too\" ",too,";\n");
 	}
 	void setDisplacementScale(double dsc)
 	{
 		if(dsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dsc\" %f;\n", dsc);
+		writeFloat(mFile,"\tsetAttr \".dsc\" ",dsc,";\n");
 	}
 	void setDisplacementOffset(double dof)
 	{
 		if(dof == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dof\" %f;\n", dof);
+		writeFloat(mFile,"\tsetAttr \".dof\" ",dof,";\n");
 	}
 	void setBumpIntensity(double bmi)
 	{
 		if(bmi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bmi\" %f;\n", bmi);
+		writeFloat(mFile,"\tsetAttr \".bmi\" ",bmi,";\n");
 	}
 	void setBumpBlur(double bbl)
 	{
 		if(bbl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".bbl\" %f;\n", bbl);
+		writeFloat(mFile,"\tsetAttr \".bbl\" ",bbl,";\n");
 	}
 	void setLuminanceIsDisplacement(bool lid)
 	{
 		if(lid == true) return;
-		fprintf(mFile,"\tsetAttr \".lid\" %i;\n", lid);
+		writeInt(mFile,"\tsetAttr \".lid\" ",lid,";\n");
 	}
 	void setTexColor1(const float3& tc1)
 	{
-		fprintf(mFile,"\tsetAttr \".tc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".tc1\" -type \"float3\" ");
 		tc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTexColor1R(float x1r)
 	{
 		if(x1r == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tc1.x1r\" %f;\n", x1r);
+		writeFloat(mFile,"\tsetAttr \".tc1.x1r\" ",x1r,";\n");
 	}
 	void setTexColor1G(float x1g)
 	{
 		if(x1g == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tc1.x1g\" %f;\n", x1g);
+		writeFloat(mFile,"\tsetAttr \".tc1.x1g\" ",x1g,";\n");
 	}
 	void setTexColor1B(float x1b)
 	{
 		if(x1b == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tc1.x1b\" %f;\n", x1b);
+		writeFloat(mFile,"\tsetAttr \".tc1.x1b\" ",x1b,";\n");
 	}
 	void setTexColor2(const float3& tc2)
 	{
-		fprintf(mFile,"\tsetAttr \".tc2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".tc2\" -type \"float3\" ");
 		tc2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTexColor2R(float x2r)
 	{
 		if(x2r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tc2.x2r\" %f;\n", x2r);
+		writeFloat(mFile,"\tsetAttr \".tc2.x2r\" ",x2r,";\n");
 	}
 	void setTexColor2G(float x2g)
 	{
 		if(x2g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tc2.x2g\" %f;\n", x2g);
+		writeFloat(mFile,"\tsetAttr \".tc2.x2g\" ",x2g,";\n");
 	}
 	void setTexColor2B(float x2b)
 	{
 		if(x2b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tc2.x2b\" %f;\n", x2b);
+		writeFloat(mFile,"\tsetAttr \".tc2.x2b\" ",x2b,";\n");
 	}
 	void setTexAlpha1(double al1)
 	{
 		if(al1 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".al1\" %f;\n", al1);
+		writeFloat(mFile,"\tsetAttr \".al1\" ",al1,";\n");
 	}
 	void setTexAlpha2(double al2)
 	{
 		if(al2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".al2\" %f;\n", al2);
+		writeFloat(mFile,"\tsetAttr \".al2\" ",al2,";\n");
 	}
 	void setTexUniformity(double txu)
 	{
 		if(txu == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".txu\" %f;\n", txu);
+		writeFloat(mFile,"\tsetAttr \".txu\" ",txu,";\n");
 	}
 	void setFringeRemoval(bool frm)
 	{
 		if(frm == true) return;
-		fprintf(mFile,"\tsetAttr \".frm\" %i;\n", frm);
+		writeInt(mFile,"\tsetAttr \".frm\" ",frm,";\n");
 	}
 	void setRepeatU(double rpu)
 	{
 		if(rpu == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rpu\" %f;\n", rpu);
+		writeFloat(mFile,"\tsetAttr \".rpu\" ",rpu,";\n");
 	}
 	void setRepeatV(double rpv)
 	{
 		if(rpv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rpv\" %f;\n", rpv);
+		writeFloat(mFile,"\tsetAttr \".rpv\" ",rpv,";\n");
 	}
 	void setOffsetU(double ofu)
 	{
 		if(ofu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ofu\" %f;\n", ofu);
+		writeFloat(mFile,"\tsetAttr \".ofu\" ",ofu,";\n");
 	}
 	void setOffsetV(double ofv)
 	{
 		if(ofv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ofv\" %f;\n", ofv);
+		writeFloat(mFile,"\tsetAttr \".ofv\" ",ofv,";\n");
 	}
 	void setBlurMult(double bmt)
 	{
 		if(bmt == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bmt\" %f;\n", bmt);
+		writeFloat(mFile,"\tsetAttr \".bmt\" ",bmt,";\n");
 	}
 	void setSmear(double smr)
 	{
 		if(smr == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".smr\" %f;\n", smr);
+		writeFloat(mFile,"\tsetAttr \".smr\" ",smr,";\n");
 	}
 	void setSmearU(double sru)
 	{
 		if(sru == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sru\" %f;\n", sru);
+		writeFloat(mFile,"\tsetAttr \".sru\" ",sru,";\n");
 	}
 	void setSmearV(double srv)
 	{
 		if(srv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".srv\" %f;\n", srv);
+		writeFloat(mFile,"\tsetAttr \".srv\" ",srv,";\n");
 	}
 	void setImageName(const string& imn)
 	{
 		if(imn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".imn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".imn\" -type \"string\" ");
 		imn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseFrameExtension(bool ufe)
 	{
 		if(ufe == false) return;
-		fprintf(mFile,"\tsetAttr \".ufe\" %i;\n", ufe);
+		writeInt(mFile,"\tsetAttr \".ufe\" ",ufe,";\n");
 	}
 	void setFrameExtension(int fe)
 	{
 		if(fe == 1) return;
-		fprintf(mFile,"\tsetAttr \".fe\" %i;\n", fe);
+		writeInt(mFile,"\tsetAttr \".fe\" ",fe,";\n");
 	}
 	void setFractalRatio(double fra)
 	{
 		if(fra == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".fra\" %f;\n", fra);
+		writeFloat(mFile,"\tsetAttr \".fra\" ",fra,";\n");
 	}
 	void setFractalAmplitude(double fam)
 	{
 		if(fam == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fam\" %f;\n", fam);
+		writeFloat(mFile,"\tsetAttr \".fam\" ",fam,";\n");
 	}
 	void setFractalThreshold(double fth)
 	{
 		if(fth == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fth\" %f;\n", fth);
+		writeFloat(mFile,"\tsetAttr \".fth\" ",fth,";\n");
 	}
 	void setMultiStreaks(int mst)
 	{
 		if(mst == 0) return;
-		fprintf(mFile,"\tsetAttr \".mst\" %i;\n", mst);
+		writeInt(mFile,"\tsetAttr \".mst\" ",mst,";\n");
 	}
 	void setMultiStreakSpread1(double ms1)
 	{
 		if(ms1 == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".ms1\" %f;\n", ms1);
+		writeFloat(mFile,"\tsetAttr \".ms1\" ",ms1,";\n");
 	}
 	void setMultiStreakSpread2(double ms2)
 	{
 		if(ms2 == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".ms2\" %f;\n", ms2);
+		writeFloat(mFile,"\tsetAttr \".ms2\" ",ms2,";\n");
 	}
 	void setMultiStreakDiffuseRand(double msdr)
 	{
 		if(msdr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".msdr\" %f;\n", msdr);
+		writeFloat(mFile,"\tsetAttr \".msdr\" ",msdr,";\n");
 	}
 	void setMultiStreakSpecularRand(double mssr)
 	{
 		if(mssr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mssr\" %f;\n", mssr);
+		writeFloat(mFile,"\tsetAttr \".mssr\" ",mssr,";\n");
 	}
 	void setMultiStreakLightAll(bool msla)
 	{
 		if(msla == false) return;
-		fprintf(mFile,"\tsetAttr \".msla\" %i;\n", msla);
+		writeInt(mFile,"\tsetAttr \".msla\" ",msla,";\n");
 	}
 	void setSingleSided(bool snsd)
 	{
 		if(snsd == false) return;
-		fprintf(mFile,"\tsetAttr \".snsd\" %i;\n", snsd);
+		writeInt(mFile,"\tsetAttr \".snsd\" ",snsd,";\n");
 	}
 	void setTubeSections(int tbs)
 	{
 		if(tbs == 6) return;
-		fprintf(mFile,"\tsetAttr \".tbs\" %i;\n", tbs);
+		writeInt(mFile,"\tsetAttr \".tbs\" ",tbs,";\n");
 	}
 	void setSubSegments(int ssg)
 	{
 		if(ssg == 1) return;
-		fprintf(mFile,"\tsetAttr \".ssg\" %i;\n", ssg);
+		writeInt(mFile,"\tsetAttr \".ssg\" ",ssg,";\n");
 	}
 	void setPerPixelLighting(bool ppl)
 	{
 		if(ppl == false) return;
-		fprintf(mFile,"\tsetAttr \".ppl\" %i;\n", ppl);
+		writeInt(mFile,"\tsetAttr \".ppl\" ",ppl,";\n");
 	}
 	void setWidthScale(size_t wsc_i,const WidthScale& wsc)
 	{
-		fprintf(mFile,"\tsetAttr \".wsc[%i]\" ",wsc_i);
+		writeInt(mFile,"\tsetAttr \".wsc[",wsc_i,"]\" ");
 		wsc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWidthScale(size_t wsc_start,size_t wsc_end,WidthScale* wsc)
 	{
-		fprintf(mFile,"\tsetAttr \".wsc[%i:%i]\" ", wsc_start,wsc_end);
+		writeInt(mFile,"\tsetAttr \".wsc[",wsc_start); writeInt(mFile,":",wsc_end,"]\" ");
 		size_t size = (wsc_end-wsc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wsc[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWidthScale(size_t wsc_start,size_t wsc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wsc[%i:%i]\"",wsc_start,wsc_end);
-		fprintf(mFile," -type \"WidthScale\" ");
+		writeInt(mFile,"\tsetAttr \".wsc[",wsc_start); writeInt(mFile,":",wsc_end,"]\"");
+		writeString(mFile," -type \"WidthScale\" ");
 	}
 	void appendWidthScale(const WidthScale& wsc)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wsc.write(mFile);
 	}
 	void endWidthScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWidthScale_Position(size_t wsc_i,float wscp)
 	{
 		if(wscp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wsc[%i].wscp\" %f;\n", wsc_i,wscp);
+		writeInt(mFile,"\tsetAttr \".wsc[",wsc_i); writeFloat(mFile,"].wscp\" ",wscp,";\n");
 	}
 	void setWidthScale_FloatValue(size_t wsc_i,float wscfv)
 	{
 		if(wscfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wsc[%i].wscfv\" %f;\n", wsc_i,wscfv);
+		writeInt(mFile,"\tsetAttr \".wsc[",wsc_i); writeFloat(mFile,"].wscfv\" ",wscfv,";\n");
 	}
 	void setWidthScale_Interp(size_t wsc_i,unsigned int wsci)
 	{
 		if(wsci == 0) return;
-		fprintf(mFile,"\tsetAttr \".wsc[%i].wsci\" %i;\n", wsc_i,wsci);
+		writeInt(mFile,"\tsetAttr \".wsc[",wsc_i); writeInt(mFile,"].wsci\" ",wsci,";\n");
 	}
 	void setLeafWidthScale(size_t lws_i,const LeafWidthScale& lws)
 	{
-		fprintf(mFile,"\tsetAttr \".lws[%i]\" ",lws_i);
+		writeInt(mFile,"\tsetAttr \".lws[",lws_i,"]\" ");
 		lws.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeafWidthScale(size_t lws_start,size_t lws_end,LeafWidthScale* lws)
 	{
-		fprintf(mFile,"\tsetAttr \".lws[%i:%i]\" ", lws_start,lws_end);
+		writeInt(mFile,"\tsetAttr \".lws[",lws_start); writeInt(mFile,":",lws_end,"]\" ");
 		size_t size = (lws_end-lws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			lws[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLeafWidthScale(size_t lws_start,size_t lws_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".lws[%i:%i]\"",lws_start,lws_end);
-		fprintf(mFile," -type \"LeafWidthScale\" ");
+		writeInt(mFile,"\tsetAttr \".lws[",lws_start); writeInt(mFile,":",lws_end,"]\"");
+		writeString(mFile," -type \"LeafWidthScale\" ");
 	}
 	void appendLeafWidthScale(const LeafWidthScale& lws)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		lws.write(mFile);
 	}
 	void endLeafWidthScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeafWidthScale_Position(size_t lws_i,float lwsp)
 	{
 		if(lwsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lws[%i].lwsp\" %f;\n", lws_i,lwsp);
+		writeInt(mFile,"\tsetAttr \".lws[",lws_i); writeFloat(mFile,"].lwsp\" ",lwsp,";\n");
 	}
 	void setLeafWidthScale_FloatValue(size_t lws_i,float lwsfv)
 	{
 		if(lwsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lws[%i].lwsfv\" %f;\n", lws_i,lwsfv);
+		writeInt(mFile,"\tsetAttr \".lws[",lws_i); writeFloat(mFile,"].lwsfv\" ",lwsfv,";\n");
 	}
 	void setLeafWidthScale_Interp(size_t lws_i,unsigned int lwsi)
 	{
 		if(lwsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".lws[%i].lwsi\" %i;\n", lws_i,lwsi);
+		writeInt(mFile,"\tsetAttr \".lws[",lws_i); writeInt(mFile,"].lwsi\" ",lwsi,";\n");
 	}
 	void setPetalWidthScale(size_t pws_i,const PetalWidthScale& pws)
 	{
-		fprintf(mFile,"\tsetAttr \".pws[%i]\" ",pws_i);
+		writeInt(mFile,"\tsetAttr \".pws[",pws_i,"]\" ");
 		pws.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPetalWidthScale(size_t pws_start,size_t pws_end,PetalWidthScale* pws)
 	{
-		fprintf(mFile,"\tsetAttr \".pws[%i:%i]\" ", pws_start,pws_end);
+		writeInt(mFile,"\tsetAttr \".pws[",pws_start); writeInt(mFile,":",pws_end,"]\" ");
 		size_t size = (pws_end-pws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			pws[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPetalWidthScale(size_t pws_start,size_t pws_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pws[%i:%i]\"",pws_start,pws_end);
-		fprintf(mFile," -type \"PetalWidthScale\" ");
+		writeInt(mFile,"\tsetAttr \".pws[",pws_start); writeInt(mFile,":",pws_end,"]\"");
+		writeString(mFile," -type \"PetalWidthScale\" ");
 	}
 	void appendPetalWidthScale(const PetalWidthScale& pws)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		pws.write(mFile);
 	}
 	void endPetalWidthScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPetalWidthScale_Position(size_t pws_i,float pwsp)
 	{
 		if(pwsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pws[%i].pwsp\" %f;\n", pws_i,pwsp);
+		writeInt(mFile,"\tsetAttr \".pws[",pws_i); writeFloat(mFile,"].pwsp\" ",pwsp,";\n");
 	}
 	void setPetalWidthScale_FloatValue(size_t pws_i,float pwsfv)
 	{
 		if(pwsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pws[%i].pwsfv\" %f;\n", pws_i,pwsfv);
+		writeInt(mFile,"\tsetAttr \".pws[",pws_i); writeFloat(mFile,"].pwsfv\" ",pwsfv,";\n");
 	}
 	void setPetalWidthScale_Interp(size_t pws_i,unsigned int pwsi)
 	{
 		if(pwsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".pws[%i].pwsi\" %i;\n", pws_i,pwsi);
+		writeInt(mFile,"\tsetAttr \".pws[",pws_i); writeInt(mFile,"].pwsi\" ",pwsi,";\n");
 	}
 	void setTwigLengthScale(size_t tls_i,const TwigLengthScale& tls)
 	{
-		fprintf(mFile,"\tsetAttr \".tls[%i]\" ",tls_i);
+		writeInt(mFile,"\tsetAttr \".tls[",tls_i,"]\" ");
 		tls.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTwigLengthScale(size_t tls_start,size_t tls_end,TwigLengthScale* tls)
 	{
-		fprintf(mFile,"\tsetAttr \".tls[%i:%i]\" ", tls_start,tls_end);
+		writeInt(mFile,"\tsetAttr \".tls[",tls_start); writeInt(mFile,":",tls_end,"]\" ");
 		size_t size = (tls_end-tls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			tls[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTwigLengthScale(size_t tls_start,size_t tls_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tls[%i:%i]\"",tls_start,tls_end);
-		fprintf(mFile," -type \"TwigLengthScale\" ");
+		writeInt(mFile,"\tsetAttr \".tls[",tls_start); writeInt(mFile,":",tls_end,"]\"");
+		writeString(mFile," -type \"TwigLengthScale\" ");
 	}
 	void appendTwigLengthScale(const TwigLengthScale& tls)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		tls.write(mFile);
 	}
 	void endTwigLengthScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTwigLengthScale_Position(size_t tls_i,float tlsp)
 	{
 		if(tlsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tls[%i].tlsp\" %f;\n", tls_i,tlsp);
+		writeInt(mFile,"\tsetAttr \".tls[",tls_i); writeFloat(mFile,"].tlsp\" ",tlsp,";\n");
 	}
 	void setTwigLengthScale_FloatValue(size_t tls_i,float tlsfv)
 	{
 		if(tlsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tls[%i].tlsfv\" %f;\n", tls_i,tlsfv);
+		writeInt(mFile,"\tsetAttr \".tls[",tls_i); writeFloat(mFile,"].tlsfv\" ",tlsfv,";\n");
 	}
 	void setTwigLengthScale_Interp(size_t tls_i,unsigned int tlsi)
 	{
 		if(tlsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".tls[%i].tlsi\" %i;\n", tls_i,tlsi);
+		writeInt(mFile,"\tsetAttr \".tls[",tls_i); writeInt(mFile,"].tlsi\" ",tlsi,";\n");
 	}
 	void setBranchThorns(bool bth)
 	{
 		if(bth == false) return;
-		fprintf(mFile,"\tsetAttr \".bth\" %i;\n", bth);
+		writeInt(mFile,"\tsetAttr \".bth\" ",bth,";\n");
 	}
 	void setTwigThorns(bool tth)
 	{
 		if(tth == false) return;
-		fprintf(mFile,"\tsetAttr \".tth\" %i;\n", tth);
+		writeInt(mFile,"\tsetAttr \".tth\" ",tth,";\n");
 	}
 	void setLeafThorns(bool lth)
 	{
 		if(lth == false) return;
-		fprintf(mFile,"\tsetAttr \".lth\" %i;\n", lth);
+		writeInt(mFile,"\tsetAttr \".lth\" ",lth,";\n");
 	}
 	void setFlowerThorns(bool flt)
 	{
 		if(flt == false) return;
-		fprintf(mFile,"\tsetAttr \".flt\" %i;\n", flt);
+		writeInt(mFile,"\tsetAttr \".flt\" ",flt,";\n");
 	}
 	void setThornDensity(double nth)
 	{
 		if(nth == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".nth\" %f;\n", nth);
+		writeFloat(mFile,"\tsetAttr \".nth\" ",nth,";\n");
 	}
 	void setThornLength(double tln)
 	{
 		if(tln == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tln\" %f;\n", tln);
+		writeFloat(mFile,"\tsetAttr \".tln\" ",tln,";\n");
 	}
 	void setThornBaseWidth(double tbwd)
 	{
 		if(tbwd == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".tbwd\" %f;\n", tbwd);
+		writeFloat(mFile,"\tsetAttr \".tbwd\" ",tbwd,";\n");
 	}
 	void setThornTipWidth(double ttwd)
 	{
 		if(ttwd == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".ttwd\" %f;\n", ttwd);
+		writeFloat(mFile,"\tsetAttr \".ttwd\" ",ttwd,";\n");
 	}
 	void setThornElevation(double tel)
 	{
 		if(tel == 0.6) return;
-		fprintf(mFile,"\tsetAttr \".tel\" %f;\n", tel);
+		writeFloat(mFile,"\tsetAttr \".tel\" ",tel,";\n");
 	}
 	void setThornSpecular(double tsp)
 	{
 		if(tsp == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".tsp\" %f;\n", tsp);
+		writeFloat(mFile,"\tsetAttr \".tsp\" ",tsp,";\n");
 	}
 	void setThornBaseColor(const float3& tbc)
 	{
-		fprintf(mFile,"\tsetAttr \".tbc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".tbc\" -type \"float3\" ");
 		tbc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setThornBaseColorR(float tbcr)
 	{
 		if(tbcr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tbc.tbcr\" %f;\n", tbcr);
+		writeFloat(mFile,"\tsetAttr \".tbc.tbcr\" ",tbcr,";\n");
 	}
 	void setThornBaseColorG(float tbcg)
 	{
 		if(tbcg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tbc.tbcg\" %f;\n", tbcg);
+		writeFloat(mFile,"\tsetAttr \".tbc.tbcg\" ",tbcg,";\n");
 	}
 	void setThornBaseColorB(float tbcb)
 	{
 		if(tbcb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tbc.tbcb\" %f;\n", tbcb);
+		writeFloat(mFile,"\tsetAttr \".tbc.tbcb\" ",tbcb,";\n");
 	}
 	void setThornTipColor(const float3& ttc)
 	{
-		fprintf(mFile,"\tsetAttr \".ttc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ttc\" -type \"float3\" ");
 		ttc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setThornTipColorR(float ttcr)
 	{
 		if(ttcr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".ttc.ttcr\" %f;\n", ttcr);
+		writeFloat(mFile,"\tsetAttr \".ttc.ttcr\" ",ttcr,";\n");
 	}
 	void setThornTipColorG(float ttcg)
 	{
 		if(ttcg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".ttc.ttcg\" %f;\n", ttcg);
+		writeFloat(mFile,"\tsetAttr \".ttc.ttcg\" ",ttcg,";\n");
 	}
 	void setThornTipColorB(float ttcb)
 	{
 		if(ttcb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".ttc.ttcb\" %f;\n", ttcb);
+		writeFloat(mFile,"\tsetAttr \".ttc.ttcb\" ",ttcb,";\n");
 	}
 	void setEnvironment(size_t env_i,const Environment& env)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i]\" ",env_i);
+		writeInt(mFile,"\tsetAttr \".env[",env_i,"]\" ");
 		env.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment(size_t env_start,size_t env_end,Environment* env)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i:%i]\" ", env_start,env_end);
+		writeInt(mFile,"\tsetAttr \".env[",env_start); writeInt(mFile,":",env_end,"]\" ");
 		size_t size = (env_end-env_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			env[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEnvironment(size_t env_start,size_t env_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i:%i]\"",env_start,env_end);
-		fprintf(mFile," -type \"Environment\" ");
+		writeInt(mFile,"\tsetAttr \".env[",env_start); writeInt(mFile,":",env_end,"]\"");
+		writeString(mFile," -type \"Environment\" ");
 	}
 	void appendEnvironment(const Environment& env)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		env.write(mFile);
 	}
 	void endEnvironment()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment_Position(size_t env_i,float envp)
 	{
 		if(envp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envp\" %f;\n", env_i,envp);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envp\" ",envp,";\n");
 	}
 	void setEnvironment_Color(size_t env_i,const float3& envc)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i].envc\" -type \"float3\" ",env_i);
+		writeInt(mFile,"\tsetAttr \".env[",env_i,"].envc\" -type \"float3\" ");
 		envc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment_ColorR(size_t env_i,float envcr)
 	{
 		if(envcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcr\" %f;\n", env_i,envcr);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcr\" ",envcr,";\n");
 	}
 	void setEnvironment_ColorG(size_t env_i,float envcg)
 	{
 		if(envcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcg\" %f;\n", env_i,envcg);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcg\" ",envcg,";\n");
 	}
 	void setEnvironment_ColorB(size_t env_i,float envcb)
 	{
 		if(envcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcb\" %f;\n", env_i,envcb);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcb\" ",envcb,";\n");
 	}
 	void setEnvironment_Interp(size_t env_i,unsigned int envi)
 	{
 		if(envi == 0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envi\" %i;\n", env_i,envi);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeInt(mFile,"].envi\" ",envi,";\n");
 	}
 	void setReflectionRolloff(size_t rro_i,const ReflectionRolloff& rro)
 	{
-		fprintf(mFile,"\tsetAttr \".rro[%i]\" ",rro_i);
+		writeInt(mFile,"\tsetAttr \".rro[",rro_i,"]\" ");
 		rro.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReflectionRolloff(size_t rro_start,size_t rro_end,ReflectionRolloff* rro)
 	{
-		fprintf(mFile,"\tsetAttr \".rro[%i:%i]\" ", rro_start,rro_end);
+		writeInt(mFile,"\tsetAttr \".rro[",rro_start); writeInt(mFile,":",rro_end,"]\" ");
 		size_t size = (rro_end-rro_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			rro[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startReflectionRolloff(size_t rro_start,size_t rro_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".rro[%i:%i]\"",rro_start,rro_end);
-		fprintf(mFile," -type \"ReflectionRolloff\" ");
+		writeInt(mFile,"\tsetAttr \".rro[",rro_start); writeInt(mFile,":",rro_end,"]\"");
+		writeString(mFile," -type \"ReflectionRolloff\" ");
 	}
 	void appendReflectionRolloff(const ReflectionRolloff& rro)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		rro.write(mFile);
 	}
 	void endReflectionRolloff()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReflectionRolloff_Position(size_t rro_i,float rrop)
 	{
 		if(rrop == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rro[%i].rrop\" %f;\n", rro_i,rrop);
+		writeInt(mFile,"\tsetAttr \".rro[",rro_i); writeFloat(mFile,"].rrop\" ",rrop,";\n");
 	}
 	void setReflectionRolloff_FloatValue(size_t rro_i,float rrofv)
 	{
 		if(rrofv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rro[%i].rrofv\" %f;\n", rro_i,rrofv);
+		writeInt(mFile,"\tsetAttr \".rro[",rro_i); writeFloat(mFile,"].rrofv\" ",rrofv,";\n");
 	}
 	void setReflectionRolloff_Interp(size_t rro_i,unsigned int rroi)
 	{
 		if(rroi == 0) return;
-		fprintf(mFile,"\tsetAttr \".rro[%i].rroi\" %i;\n", rro_i,rroi);
+		writeInt(mFile,"\tsetAttr \".rro[",rro_i); writeInt(mFile,"].rroi\" ",rroi,";\n");
 	}
 	void setBranchReflectivity(double brf)
 	{
 		if(brf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".brf\" %f;\n", brf);
+		writeFloat(mFile,"\tsetAttr \".brf\" ",brf,";\n");
 	}
 	void setLeafReflectivity(double lrf)
 	{
 		if(lrf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lrf\" %f;\n", lrf);
+		writeFloat(mFile,"\tsetAttr \".lrf\" ",lrf,";\n");
 	}
 	void setFlowerReflectivity(double frf)
 	{
 		if(frf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".frf\" %f;\n", frf);
+		writeFloat(mFile,"\tsetAttr \".frf\" ",frf,";\n");
 	}
 	void setForwardTwist(bool fwt)
 	{
 		if(fwt == false) return;
-		fprintf(mFile,"\tsetAttr \".fwt\" %i;\n", fwt);
+		writeInt(mFile,"\tsetAttr \".fwt\" ",fwt,";\n");
 	}
 	void setLeafForwardTwist(bool lfwt)
 	{
 		if(lfwt == false) return;
-		fprintf(mFile,"\tsetAttr \".lfwt\" %i;\n", lfwt);
+		writeInt(mFile,"\tsetAttr \".lfwt\" ",lfwt,";\n");
 	}
 	void setPetalForwardTwist(bool lpwt)
 	{
 		if(lpwt == false) return;
-		fprintf(mFile,"\tsetAttr \".lpwt\" %i;\n", lpwt);
+		writeInt(mFile,"\tsetAttr \".lpwt\" ",lpwt,";\n");
 	}
 	void setEndCaps(bool edc)
 	{
 		if(edc == false) return;
-		fprintf(mFile,"\tsetAttr \".edc\" %i;\n", edc);
+		writeInt(mFile,"\tsetAttr \".edc\" ",edc,";\n");
 	}
 	void setHardEdges(bool hde)
 	{
 		if(hde == false) return;
-		fprintf(mFile,"\tsetAttr \".hde\" %i;\n", hde);
+		writeInt(mFile,"\tsetAttr \".hde\" ",hde,";\n");
 	}
 	void getOutBrush()const
 	{
-		fprintf(mFile,"\"%s.obr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".obr\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.tim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tim\"");
 	}
 	void getGlobalScale()const
 	{
-		fprintf(mFile,"\"%s.gsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gsc\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.dep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dep\"");
 	}
 	void getModifyDepth()const
 	{
-		fprintf(mFile,"\"%s.mdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mdp\"");
 	}
 	void getModifyColor()const
 	{
-		fprintf(mFile,"\"%s.mdc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mdc\"");
 	}
 	void getModifyAlpha()const
 	{
-		fprintf(mFile,"\"%s.mda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mda\"");
 	}
 	void getIlluminated()const
 	{
-		fprintf(mFile,"\"%s.ill\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ill\"");
 	}
 	void getCastShadows()const
 	{
-		fprintf(mFile,"\"%s.csd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csd\"");
 	}
 	void getLightingBasedWidth()const
 	{
-		fprintf(mFile,"\"%s.lbw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lbw\"");
 	}
 	void getBranches()const
 	{
-		fprintf(mFile,"\"%s.brc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".brc\"");
 	}
 	void getTwigs()const
 	{
-		fprintf(mFile,"\"%s.twg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twg\"");
 	}
 	void getBuds()const
 	{
-		fprintf(mFile,"\"%s.bud\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bud\"");
 	}
 	void getLeaves()const
 	{
-		fprintf(mFile,"\"%s.lvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lvs\"");
 	}
 	void getFlowers()const
 	{
-		fprintf(mFile,"\"%s.flw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flw\"");
 	}
 	void getBrushType()const
 	{
-		fprintf(mFile,"\"%s.brt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".brt\"");
 	}
 	void getBrushWidth()const
 	{
-		fprintf(mFile,"\"%s.bwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwd\"");
 	}
 	void getScreenspaceWidth()const
 	{
-		fprintf(mFile,"\"%s.spw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spw\"");
 	}
 	void getDistanceScaling()const
 	{
-		fprintf(mFile,"\"%s.dsl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsl\"");
 	}
 	void getMinPixelWidth()const
 	{
-		fprintf(mFile,"\"%s.mpw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpw\"");
 	}
 	void getMaxPixelWidth()const
 	{
-		fprintf(mFile,"\"%s.mxp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxp\"");
 	}
 	void getStampDensity()const
 	{
-		fprintf(mFile,"\"%s.sdn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdn\"");
 	}
 	void getSoftness()const
 	{
-		fprintf(mFile,"\"%s.sft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sft\"");
 	}
 	void getEdgeAntialias()const
 	{
-		fprintf(mFile,"\"%s.eaa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eaa\"");
 	}
 	void getEdgeClip()const
 	{
-		fprintf(mFile,"\"%s.ecl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecl\"");
 	}
 	void getEdgeClipDepth()const
 	{
-		fprintf(mFile,"\"%s.ecd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecd\"");
 	}
 	void getOcclusionWidthScale()const
 	{
-		fprintf(mFile,"\"%s.ows\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ows\"");
 	}
 	void getBlurIntensity()const
 	{
-		fprintf(mFile,"\"%s.bin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bin\"");
 	}
 	void getColor1()const
 	{
-		fprintf(mFile,"\"%s.cl1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl1\"");
 	}
 	void getColor1R()const
 	{
-		fprintf(mFile,"\"%s.cl1.c1r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl1.c1r\"");
 	}
 	void getColor1G()const
 	{
-		fprintf(mFile,"\"%s.cl1.c1g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl1.c1g\"");
 	}
 	void getColor1B()const
 	{
-		fprintf(mFile,"\"%s.cl1.c1b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl1.c1b\"");
 	}
 	void getColor2()const
 	{
-		fprintf(mFile,"\"%s.cl2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl2\"");
 	}
 	void getColor2R()const
 	{
-		fprintf(mFile,"\"%s.cl2.c2r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl2.c2r\"");
 	}
 	void getColor2G()const
 	{
-		fprintf(mFile,"\"%s.cl2.c2g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl2.c2g\"");
 	}
 	void getColor2B()const
 	{
-		fprintf(mFile,"\"%s.cl2.c2b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl2.c2b\"");
 	}
 	void getTransparency1()const
 	{
-		fprintf(mFile,"\"%s.tn1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn1\"");
 	}
 	void getTransparency1R()const
 	{
-		fprintf(mFile,"\"%s.tn1.t1r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn1.t1r\"");
 	}
 	void getTransparency1G()const
 	{
-		fprintf(mFile,"\"%s.tn1.t1g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn1.t1g\"");
 	}
 	void getTransparency1B()const
 	{
-		fprintf(mFile,"\"%s.tn1.t1b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn1.t1b\"");
 	}
 	void getTransparency2()const
 	{
-		fprintf(mFile,"\"%s.tn2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn2\"");
 	}
 	void getTransparency2R()const
 	{
-		fprintf(mFile,"\"%s.tn2.t2r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn2.t2r\"");
 	}
 	void getTransparency2G()const
 	{
-		fprintf(mFile,"\"%s.tn2.t2g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn2.t2g\"");
 	}
 	void getTransparency2B()const
 	{
-		fprintf(mFile,"\"%s.tn2.t2b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn2.t2b\"");
 	}
 	void getIncandescence1()const
 	{
-		fprintf(mFile,"\"%s.in1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in1\"");
 	}
 	void getIncandescence1R()const
 	{
-		fprintf(mFile,"\"%s.in1.i1r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in1.i1r\"");
 	}
 	void getIncandescence1G()const
 	{
-		fprintf(mFile,"\"%s.in1.i1g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in1.i1g\"");
 	}
 	void getIncandescence1B()const
 	{
-		fprintf(mFile,"\"%s.in1.i1b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in1.i1b\"");
 	}
 	void getIncandescence2()const
 	{
-		fprintf(mFile,"\"%s.in2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in2\"");
 	}
 	void getIncandescence2R()const
 	{
-		fprintf(mFile,"\"%s.in2.i2r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in2.i2r\"");
 	}
 	void getIncandescence2G()const
 	{
-		fprintf(mFile,"\"%s.in2.i2g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in2.i2g\"");
 	}
 	void getIncandescence2B()const
 	{
-		fprintf(mFile,"\"%s.in2.i2b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in2.i2b\"");
 	}
 	void getSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.spc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc\"");
 	}
 	void getSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.spc.spr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spr\"");
 	}
 	void getSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.spc.spg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spg\"");
 	}
 	void getSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.spc.spb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spb\"");
 	}
 	void getSpecular()const
 	{
-		fprintf(mFile,"\"%s.spe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spe\"");
 	}
 	void getSpecularPower()const
 	{
-		fprintf(mFile,"\"%s.spp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spp\"");
 	}
 	void getTranslucence()const
 	{
-		fprintf(mFile,"\"%s.trn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trn\"");
 	}
 	void getGlow()const
 	{
-		fprintf(mFile,"\"%s.glw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".glw\"");
 	}
 	void getGlowColor()const
 	{
-		fprintf(mFile,"\"%s.glc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".glc\"");
 	}
 	void getGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.glc.glr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".glc.glr\"");
 	}
 	void getGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.glc.glg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".glc.glg\"");
 	}
 	void getGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.glc.glb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".glc.glb\"");
 	}
 	void getGlowSpread()const
 	{
-		fprintf(mFile,"\"%s.gls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gls\"");
 	}
 	void getShaderGlow()const
 	{
-		fprintf(mFile,"\"%s.sgl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgl\"");
 	}
 	void getHueRand()const
 	{
-		fprintf(mFile,"\"%s.chr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chr\"");
 	}
 	void getSatRand()const
 	{
-		fprintf(mFile,"\"%s.csr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csr\"");
 	}
 	void getValRand()const
 	{
-		fprintf(mFile,"\"%s.cvr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cvr\"");
 	}
 	void getRootFade()const
 	{
-		fprintf(mFile,"\"%s.rfd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfd\"");
 	}
 	void getTipFade()const
 	{
-		fprintf(mFile,"\"%s.tfd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tfd\"");
 	}
 	void getFakeShadow()const
 	{
-		fprintf(mFile,"\"%s.fks\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fks\"");
 	}
 	void getShadowOffset()const
 	{
-		fprintf(mFile,"\"%s.sof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sof\"");
 	}
 	void getShadowDiffusion()const
 	{
-		fprintf(mFile,"\"%s.sdf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdf\"");
 	}
 	void getShadowTransparency()const
 	{
-		fprintf(mFile,"\"%s.stn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stn\"");
 	}
 	void getBackShadow()const
 	{
-		fprintf(mFile,"\"%s.bks\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bks\"");
 	}
 	void getBrightnessRand()const
 	{
-		fprintf(mFile,"\"%s.brn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".brn\"");
 	}
 	void getCenterShadow()const
 	{
-		fprintf(mFile,"\"%s.cns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cns\"");
 	}
 	void getDepthShadowType()const
 	{
-		fprintf(mFile,"\"%s.dpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpt\"");
 	}
 	void getDepthShadow()const
 	{
-		fprintf(mFile,"\"%s.dpl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpl\"");
 	}
 	void getDepthShadowDepth()const
 	{
-		fprintf(mFile,"\"%s.dps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dps\"");
 	}
 	void getRealLights()const
 	{
-		fprintf(mFile,"\"%s.rll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rll\"");
 	}
 	void getLightDirection()const
 	{
-		fprintf(mFile,"\"%s.ldr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldr\"");
 	}
 	void getLightDirectionX()const
 	{
-		fprintf(mFile,"\"%s.ldr.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldr.ldx\"");
 	}
 	void getLightDirectionY()const
 	{
-		fprintf(mFile,"\"%s.ldr.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldr.ldy\"");
 	}
 	void getLightDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.ldr.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldr.ldz\"");
 	}
 	void getGapSize()const
 	{
-		fprintf(mFile,"\"%s.gsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gsz\"");
 	}
 	void getGapSpacing()const
 	{
-		fprintf(mFile,"\"%s.gsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gsp\"");
 	}
 	void getGapRand()const
 	{
-		fprintf(mFile,"\"%s.grn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grn\"");
 	}
 	void getFlowSpeed()const
 	{
-		fprintf(mFile,"\"%s.fws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fws\"");
 	}
 	void getTextureFlow()const
 	{
-		fprintf(mFile,"\"%s.tfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tfl\"");
 	}
 	void getTimeClip()const
 	{
-		fprintf(mFile,"\"%s.tcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcl\"");
 	}
 	void getStrokeTime()const
 	{
-		fprintf(mFile,"\"%s.srm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srm\"");
 	}
 	void getStartTime()const
 	{
-		fprintf(mFile,"\"%s.sti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sti\"");
 	}
 	void getEndTime()const
 	{
-		fprintf(mFile,"\"%s.eti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eti\"");
 	}
 	void getTubes()const
 	{
-		fprintf(mFile,"\"%s.tub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tub\"");
 	}
 	void getCreationScript()const
 	{
-		fprintf(mFile,"\"%s.csc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csc\"");
 	}
 	void getRuntimeScript()const
 	{
-		fprintf(mFile,"\"%s.rsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsc\"");
 	}
 	void getTubeCompletion()const
 	{
-		fprintf(mFile,"\"%s.tcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcm\"");
 	}
 	void getTubesPerStep()const
 	{
-		fprintf(mFile,"\"%s.tps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tps\"");
 	}
 	void getTubeRand()const
 	{
-		fprintf(mFile,"\"%s.trd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trd\"");
 	}
 	void getStartTubes()const
 	{
-		fprintf(mFile,"\"%s.stb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stb\"");
 	}
 	void getLengthMax()const
 	{
-		fprintf(mFile,"\"%s.lnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lnx\"");
 	}
 	void getLengthMin()const
 	{
-		fprintf(mFile,"\"%s.lnn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lnn\"");
 	}
 	void getSegments()const
 	{
-		fprintf(mFile,"\"%s.sgm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgm\"");
 	}
 	void getTubeWidth1()const
 	{
-		fprintf(mFile,"\"%s.tw1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tw1\"");
 	}
 	void getTubeWidth2()const
 	{
-		fprintf(mFile,"\"%s.tw2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tw2\"");
 	}
 	void getWidthRand()const
 	{
-		fprintf(mFile,"\"%s.wdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wdr\"");
 	}
 	void getWidthBias()const
 	{
-		fprintf(mFile,"\"%s.wdb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wdb\"");
 	}
 	void getLengthFlex()const
 	{
-		fprintf(mFile,"\"%s.lfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfx\"");
 	}
 	void getSegmentLengthBias()const
 	{
-		fprintf(mFile,"\"%s.sgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgb\"");
 	}
 	void getSegmentWidthBias()const
 	{
-		fprintf(mFile,"\"%s.swb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".swb\"");
 	}
 	void getTubeDirection()const
 	{
-		fprintf(mFile,"\"%s.tdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tdr\"");
 	}
 	void getElevationMin()const
 	{
-		fprintf(mFile,"\"%s.elm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".elm\"");
 	}
 	void getElevationMax()const
 	{
-		fprintf(mFile,"\"%s.elx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".elx\"");
 	}
 	void getAzimuthMin()const
 	{
-		fprintf(mFile,"\"%s.azn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".azn\"");
 	}
 	void getAzimuthMax()const
 	{
-		fprintf(mFile,"\"%s.azx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".azx\"");
 	}
 	void getFlatness1()const
 	{
-		fprintf(mFile,"\"%s.fl1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fl1\"");
 	}
 	void getFlatness2()const
 	{
-		fprintf(mFile,"\"%s.fl2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fl2\"");
 	}
 	void getTwist()const
 	{
-		fprintf(mFile,"\"%s.twi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twi\"");
 	}
 	void getTwistRate()const
 	{
-		fprintf(mFile,"\"%s.twr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twr\"");
 	}
 	void getTwistRand()const
 	{
-		fprintf(mFile,"\"%s.twd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twd\"");
 	}
 	void getSpiralMin()const
 	{
-		fprintf(mFile,"\"%s.spm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spm\"");
 	}
 	void getSpiralMax()const
 	{
-		fprintf(mFile,"\"%s.spx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spx\"");
 	}
 	void getSpiralDecay()const
 	{
-		fprintf(mFile,"\"%s.spd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spd\"");
 	}
 	void getBend()const
 	{
-		fprintf(mFile,"\"%s.ben\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ben\"");
 	}
 	void getBendBias()const
 	{
-		fprintf(mFile,"\"%s.bnb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bnb\"");
 	}
 	void getDisplacementDelay()const
 	{
-		fprintf(mFile,"\"%s.ddl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ddl\"");
 	}
 	void getWiggle()const
 	{
-		fprintf(mFile,"\"%s.wgl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wgl\"");
 	}
 	void getWiggleFrequency()const
 	{
-		fprintf(mFile,"\"%s.wgf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wgf\"");
 	}
 	void getWiggleOffset()const
 	{
-		fprintf(mFile,"\"%s.wgo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wgo\"");
 	}
 	void getCurl()const
 	{
-		fprintf(mFile,"\"%s.crl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crl\"");
 	}
 	void getCurlFrequency()const
 	{
-		fprintf(mFile,"\"%s.crf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crf\"");
 	}
 	void getCurlOffset()const
 	{
-		fprintf(mFile,"\"%s.cro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cro\"");
 	}
 	void getNoise()const
 	{
-		fprintf(mFile,"\"%s.noi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".noi\"");
 	}
 	void getNoiseFrequency()const
 	{
-		fprintf(mFile,"\"%s.nof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nof\"");
 	}
 	void getNoiseOffset()const
 	{
-		fprintf(mFile,"\"%s.noo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".noo\"");
 	}
 	void getSplitMaxDepth()const
 	{
-		fprintf(mFile,"\"%s.smd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smd\"");
 	}
 	void getSplitRand()const
 	{
-		fprintf(mFile,"\"%s.srd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srd\"");
 	}
 	void getSplitAngle()const
 	{
-		fprintf(mFile,"\"%s.spa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spa\"");
 	}
 	void getSplitSizeDecay()const
 	{
-		fprintf(mFile,"\"%s.ssd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssd\"");
 	}
 	void getSplitBias()const
 	{
-		fprintf(mFile,"\"%s.slb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slb\"");
 	}
 	void getSplitTwist()const
 	{
-		fprintf(mFile,"\"%s.slt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slt\"");
 	}
 	void getStartBranches()const
 	{
-		fprintf(mFile,"\"%s.sbr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sbr\"");
 	}
 	void getNumBranches()const
 	{
-		fprintf(mFile,"\"%s.nbr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nbr\"");
 	}
 	void getBranchDropout()const
 	{
-		fprintf(mFile,"\"%s.bdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bdr\"");
 	}
 	void getMiddleBranch()const
 	{
-		fprintf(mFile,"\"%s.mbr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mbr\"");
 	}
 	void getMinSize()const
 	{
-		fprintf(mFile,"\"%s.mms\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mms\"");
 	}
 	void getPathFollow()const
 	{
-		fprintf(mFile,"\"%s.pfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfl\"");
 	}
 	void getPathAttract()const
 	{
-		fprintf(mFile,"\"%s.pat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pat\"");
 	}
 	void getCurveFollow()const
 	{
-		fprintf(mFile,"\"%s.cfw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfw\"");
 	}
 	void getCurveAttract()const
 	{
-		fprintf(mFile,"\"%s.cva\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cva\"");
 	}
 	void getCurveMaxDist()const
 	{
-		fprintf(mFile,"\"%s.cmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmd\"");
 	}
 	void getUniformForce()const
 	{
-		fprintf(mFile,"\"%s.ufr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufr\"");
 	}
 	void getUniformForceX()const
 	{
-		fprintf(mFile,"\"%s.ufr.ufx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufr.ufx\"");
 	}
 	void getUniformForceY()const
 	{
-		fprintf(mFile,"\"%s.ufr.ufy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufr.ufy\"");
 	}
 	void getUniformForceZ()const
 	{
-		fprintf(mFile,"\"%s.ufr.ufz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufr.ufz\"");
 	}
 	void getTurbulenceType()const
 	{
-		fprintf(mFile,"\"%s.trt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trt\"");
 	}
 	void getTurbulenceInterpolation()const
 	{
-		fprintf(mFile,"\"%s.tin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tin\"");
 	}
 	void getTurbulence()const
 	{
-		fprintf(mFile,"\"%s.tur\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tur\"");
 	}
 	void getTurbulenceFrequency()const
 	{
-		fprintf(mFile,"\"%s.trf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trf\"");
 	}
 	void getTurbulenceSpeed()const
 	{
-		fprintf(mFile,"\"%s.trs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trs\"");
 	}
 	void getTurbulenceOffset()const
 	{
-		fprintf(mFile,"\"%s.tro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tro\"");
 	}
 	void getTurbulenceOffsetX()const
 	{
-		fprintf(mFile,"\"%s.tro.trx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tro.trx\"");
 	}
 	void getTurbulenceOffsetY()const
 	{
-		fprintf(mFile,"\"%s.tro.try\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tro.try\"");
 	}
 	void getTurbulenceOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.tro.trz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tro.trz\"");
 	}
 	void getRandom()const
 	{
-		fprintf(mFile,"\"%s.ran\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ran\"");
 	}
 	void getGravity()const
 	{
-		fprintf(mFile,"\"%s.grv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grv\"");
 	}
 	void getMomentum()const
 	{
-		fprintf(mFile,"\"%s.mmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmt\"");
 	}
 	void getDeflection()const
 	{
-		fprintf(mFile,"\"%s.def\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def\"");
 	}
 	void getDeflectionMin()const
 	{
-		fprintf(mFile,"\"%s.dfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfm\"");
 	}
 	void getDeflectionMax()const
 	{
-		fprintf(mFile,"\"%s.dfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfx\"");
 	}
 	void getTwigsInCluster()const
 	{
-		fprintf(mFile,"\"%s.tic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tic\"");
 	}
 	void getTwigDropout()const
 	{
-		fprintf(mFile,"\"%s.tdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tdp\"");
 	}
 	void getTwigAngle1()const
 	{
-		fprintf(mFile,"\"%s.ta1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ta1\"");
 	}
 	void getTwigAngle2()const
 	{
-		fprintf(mFile,"\"%s.ta2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ta2\"");
 	}
 	void getTwigTwist()const
 	{
-		fprintf(mFile,"\"%s.ttw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ttw\"");
 	}
 	void getTwigLength()const
 	{
-		fprintf(mFile,"\"%s.twl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twl\"");
 	}
 	void getTwigStart()const
 	{
-		fprintf(mFile,"\"%s.tst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tst\"");
 	}
 	void getNumTwigClusters()const
 	{
-		fprintf(mFile,"\"%s.ntc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ntc\"");
 	}
 	void getTwigBaseWidth()const
 	{
-		fprintf(mFile,"\"%s.twb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twb\"");
 	}
 	void getTwigTipWidth()const
 	{
-		fprintf(mFile,"\"%s.twt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twt\"");
 	}
 	void getTwigStiffness()const
 	{
-		fprintf(mFile,"\"%s.tgs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tgs\"");
 	}
 	void getBranchAfterTwigs()const
 	{
-		fprintf(mFile,"\"%s.bat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bat\"");
 	}
 	void getLeavesInCluster()const
 	{
-		fprintf(mFile,"\"%s.lic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lic\"");
 	}
 	void getLeafLocation()const
 	{
-		fprintf(mFile,"\"%s.llo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".llo\"");
 	}
 	void getLeafDropout()const
 	{
-		fprintf(mFile,"\"%s.ldp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldp\"");
 	}
 	void getLeafAngle1()const
 	{
-		fprintf(mFile,"\"%s.ll1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ll1\"");
 	}
 	void getLeafAngle2()const
 	{
-		fprintf(mFile,"\"%s.ll2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ll2\"");
 	}
 	void getLeafTwist()const
 	{
-		fprintf(mFile,"\"%s.ltw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltw\"");
 	}
 	void getLeafBend()const
 	{
-		fprintf(mFile,"\"%s.lbn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lbn\"");
 	}
 	void getLeafCurl(size_t lcl_i)const
 	{
-		fprintf(mFile,"\"%s.lcl[%i]\"",mName.c_str(),lcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lcl[",lcl_i,"]\"");
 	}
 	void getLeafCurl()const
 	{
 
-		fprintf(mFile,"\"%s.lcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcl\"");
 	}
 	void getLeafCurl_Position(size_t lcl_i)const
 	{
-		fprintf(mFile,"\"%s.lcl[%i].lclp\"",mName.c_str(),lcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lcl[",lcl_i,"].lclp\"");
 	}
 	void getLeafCurl_Position()const
 	{
 
-		fprintf(mFile,"\"%s.lcl.lclp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcl.lclp\"");
 	}
 	void getLeafCurl_FloatValue(size_t lcl_i)const
 	{
-		fprintf(mFile,"\"%s.lcl[%i].lclfv\"",mName.c_str(),lcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lcl[",lcl_i,"].lclfv\"");
 	}
 	void getLeafCurl_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.lcl.lclfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcl.lclfv\"");
 	}
 	void getLeafCurl_Interp(size_t lcl_i)const
 	{
-		fprintf(mFile,"\"%s.lcl[%i].lcli\"",mName.c_str(),lcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lcl[",lcl_i,"].lcli\"");
 	}
 	void getLeafCurl_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.lcl.lcli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcl.lcli\"");
 	}
 	void getLeafTwirl()const
 	{
-		fprintf(mFile,"\"%s.ltwl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltwl\"");
 	}
 	void getLeafSegments()const
 	{
-		fprintf(mFile,"\"%s.lsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsg\"");
 	}
 	void getLeafStart()const
 	{
-		fprintf(mFile,"\"%s.lst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lst\"");
 	}
 	void getNumLeafClusters()const
 	{
-		fprintf(mFile,"\"%s.nlc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nlc\"");
 	}
 	void getLeafFlatness()const
 	{
-		fprintf(mFile,"\"%s.lft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lft\"");
 	}
 	void getLeafLength()const
 	{
-		fprintf(mFile,"\"%s.lln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lln\"");
 	}
 	void getLeafBaseWidth()const
 	{
-		fprintf(mFile,"\"%s.leb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".leb\"");
 	}
 	void getLeafTipWidth()const
 	{
-		fprintf(mFile,"\"%s.let\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".let\"");
 	}
 	void getLeafSizeDecay()const
 	{
-		fprintf(mFile,"\"%s.lsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsd\"");
 	}
 	void getLeafTranslucence()const
 	{
-		fprintf(mFile,"\"%s.ltr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltr\"");
 	}
 	void getLeafSpecular()const
 	{
-		fprintf(mFile,"\"%s.lsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsp\"");
 	}
 	void getTerminalLeaf()const
 	{
-		fprintf(mFile,"\"%s.tml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tml\"");
 	}
 	void getLeafColor1()const
 	{
-		fprintf(mFile,"\"%s.lc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc1\"");
 	}
 	void getLeafColor1R()const
 	{
-		fprintf(mFile,"\"%s.lc1.lr1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc1.lr1\"");
 	}
 	void getLeafColor1G()const
 	{
-		fprintf(mFile,"\"%s.lc1.lg1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc1.lg1\"");
 	}
 	void getLeafColor1B()const
 	{
-		fprintf(mFile,"\"%s.lc1.lb1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc1.lb1\"");
 	}
 	void getLeafColor2()const
 	{
-		fprintf(mFile,"\"%s.lc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc2\"");
 	}
 	void getLeafColor2R()const
 	{
-		fprintf(mFile,"\"%s.lc2.lr2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc2.lr2\"");
 	}
 	void getLeafColor2G()const
 	{
-		fprintf(mFile,"\"%s.lc2.lg2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc2.lg2\"");
 	}
 	void getLeafColor2B()const
 	{
-		fprintf(mFile,"\"%s.lc2.lb2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc2.lb2\"");
 	}
 	void getLeafHueRand()const
 	{
-		fprintf(mFile,"\"%s.lhr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lhr\"");
 	}
 	void getLeafSatRand()const
 	{
-		fprintf(mFile,"\"%s.lsr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsr\"");
 	}
 	void getLeafValRand()const
 	{
-		fprintf(mFile,"\"%s.lvr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lvr\"");
 	}
 	void getLeafUseBranchTex()const
 	{
-		fprintf(mFile,"\"%s.lub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lub\"");
 	}
 	void getLeafImage()const
 	{
-		fprintf(mFile,"\"%s.lim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lim\"");
 	}
 	void getLeafStiffness()const
 	{
-		fprintf(mFile,"\"%s.lfs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfs\"");
 	}
 	void getBudSize()const
 	{
-		fprintf(mFile,"\"%s.bds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bds\"");
 	}
 	void getBudColor()const
 	{
-		fprintf(mFile,"\"%s.bcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcr\"");
 	}
 	void getBudColorR()const
 	{
-		fprintf(mFile,"\"%s.bcr.bur\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcr.bur\"");
 	}
 	void getBudColorG()const
 	{
-		fprintf(mFile,"\"%s.bcr.bug\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcr.bug\"");
 	}
 	void getBudColorB()const
 	{
-		fprintf(mFile,"\"%s.bcr.bub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcr.bub\"");
 	}
 	void getPetalsInFlower()const
 	{
-		fprintf(mFile,"\"%s.pif\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pif\"");
 	}
 	void getFlowerLocation()const
 	{
-		fprintf(mFile,"\"%s.flc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc\"");
 	}
 	void getPetalDropout()const
 	{
-		fprintf(mFile,"\"%s.pdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pdp\"");
 	}
 	void getFlowerAngle1()const
 	{
-		fprintf(mFile,"\"%s.fw1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw1\"");
 	}
 	void getFlowerAngle2()const
 	{
-		fprintf(mFile,"\"%s.fw2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw2\"");
 	}
 	void getFlowerTwist()const
 	{
-		fprintf(mFile,"\"%s.ftw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ftw\"");
 	}
 	void getPetalBend()const
 	{
-		fprintf(mFile,"\"%s.pbn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pbn\"");
 	}
 	void getPetalCurl(size_t pcl_i)const
 	{
-		fprintf(mFile,"\"%s.pcl[%i]\"",mName.c_str(),pcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pcl[",pcl_i,"]\"");
 	}
 	void getPetalCurl()const
 	{
 
-		fprintf(mFile,"\"%s.pcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcl\"");
 	}
 	void getPetalCurl_Position(size_t pcl_i)const
 	{
-		fprintf(mFile,"\"%s.pcl[%i].pclp\"",mName.c_str(),pcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pcl[",pcl_i,"].pclp\"");
 	}
 	void getPetalCurl_Position()const
 	{
 
-		fprintf(mFile,"\"%s.pcl.pclp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcl.pclp\"");
 	}
 	void getPetalCurl_FloatValue(size_t pcl_i)const
 	{
-		fprintf(mFile,"\"%s.pcl[%i].pclfv\"",mName.c_str(),pcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pcl[",pcl_i,"].pclfv\"");
 	}
 	void getPetalCurl_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.pcl.pclfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcl.pclfv\"");
 	}
 	void getPetalCurl_Interp(size_t pcl_i)const
 	{
-		fprintf(mFile,"\"%s.pcl[%i].pcli\"",mName.c_str(),pcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pcl[",pcl_i,"].pcli\"");
 	}
 	void getPetalCurl_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.pcl.pcli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcl.pcli\"");
 	}
 	void getPetalTwirl()const
 	{
-		fprintf(mFile,"\"%s.lpwl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lpwl\"");
 	}
 	void getPetalSegments()const
 	{
-		fprintf(mFile,"\"%s.psg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".psg\"");
 	}
 	void getFlowerStart()const
 	{
-		fprintf(mFile,"\"%s.fst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fst\"");
 	}
 	void getNumFlowers()const
 	{
-		fprintf(mFile,"\"%s.nfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nfl\"");
 	}
 	void getPetalFlatness()const
 	{
-		fprintf(mFile,"\"%s.pft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pft\"");
 	}
 	void getPetalLength()const
 	{
-		fprintf(mFile,"\"%s.pln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pln\"");
 	}
 	void getPetalBaseWidth()const
 	{
-		fprintf(mFile,"\"%s.ptb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ptb\"");
 	}
 	void getPetalTipWidth()const
 	{
-		fprintf(mFile,"\"%s.ptt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ptt\"");
 	}
 	void getFlowerSizeDecay()const
 	{
-		fprintf(mFile,"\"%s.fsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsd\"");
 	}
 	void getFlowerTranslucence()const
 	{
-		fprintf(mFile,"\"%s.ftr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ftr\"");
 	}
 	void getFlowerSpecular()const
 	{
-		fprintf(mFile,"\"%s.fsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsp\"");
 	}
 	void getPetalColor1()const
 	{
-		fprintf(mFile,"\"%s.pc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc1\"");
 	}
 	void getPetalColor1R()const
 	{
-		fprintf(mFile,"\"%s.pc1.pr1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc1.pr1\"");
 	}
 	void getPetalColor1G()const
 	{
-		fprintf(mFile,"\"%s.pc1.pg1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc1.pg1\"");
 	}
 	void getPetalColor1B()const
 	{
-		fprintf(mFile,"\"%s.pc1.pb1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc1.pb1\"");
 	}
 	void getPetalColor2()const
 	{
-		fprintf(mFile,"\"%s.pc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc2\"");
 	}
 	void getPetalColor2R()const
 	{
-		fprintf(mFile,"\"%s.pc2.pr2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc2.pr2\"");
 	}
 	void getPetalColor2G()const
 	{
-		fprintf(mFile,"\"%s.pc2.pg2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc2.pg2\"");
 	}
 	void getPetalColor2B()const
 	{
-		fprintf(mFile,"\"%s.pc2.pb2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc2.pb2\"");
 	}
 	void getFlowerHueRand()const
 	{
-		fprintf(mFile,"\"%s.fhr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fhr\"");
 	}
 	void getFlowerSatRand()const
 	{
-		fprintf(mFile,"\"%s.fsr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsr\"");
 	}
 	void getFlowerValRand()const
 	{
-		fprintf(mFile,"\"%s.fvr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fvr\"");
 	}
 	void getFlowerUseBranchTex()const
 	{
-		fprintf(mFile,"\"%s.fub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fub\"");
 	}
 	void getFlowerImage()const
 	{
-		fprintf(mFile,"\"%s.fim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fim\"");
 	}
 	void getFlowerStiffness()const
 	{
-		fprintf(mFile,"\"%s.fls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fls\"");
 	}
 	void getSimplifyMethod()const
 	{
-		fprintf(mFile,"\"%s.smp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smp\"");
 	}
 	void getColorLengthMap()const
 	{
-		fprintf(mFile,"\"%s.clm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clm\"");
 	}
 	void getTranspLengthMap()const
 	{
-		fprintf(mFile,"\"%s.tlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlm\"");
 	}
 	void getIncandLengthMap()const
 	{
-		fprintf(mFile,"\"%s.ilm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ilm\"");
 	}
 	void getWidthLengthMap()const
 	{
-		fprintf(mFile,"\"%s.wlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wlm\"");
 	}
 	void getSplitLengthMap()const
 	{
-		fprintf(mFile,"\"%s.spl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spl\"");
 	}
 	void getMapColor()const
 	{
-		fprintf(mFile,"\"%s.mcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mcl\"");
 	}
 	void getMapOpacity()const
 	{
-		fprintf(mFile,"\"%s.mop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mop\"");
 	}
 	void getMapDisplacement()const
 	{
-		fprintf(mFile,"\"%s.mds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mds\"");
 	}
 	void getTextureType()const
 	{
-		fprintf(mFile,"\"%s.txt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txt\"");
 	}
 	void getMapMethod()const
 	{
-		fprintf(mFile,"\"%s.mmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmd\"");
 	}
 	void getTexColorScale()const
 	{
-		fprintf(mFile,"\"%s.tcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcs\"");
 	}
 	void getTexColorOffset()const
 	{
-		fprintf(mFile,"\"%s.tco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tco\"");
 	}
 	void getTexOpacityScale()const
 	{
-		fprintf(mFile,"\"%s.tos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tos\"");
 	}
 	void getTexOpacityOffset()const
 	{
-		fprintf(mFile,"\"%s.too\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".too\"");
 	}
 	void getDisplacementScale()const
 	{
-		fprintf(mFile,"\"%s.dsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsc\"");
 	}
 	void getDisplacementOffset()const
 	{
-		fprintf(mFile,"\"%s.dof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dof\"");
 	}
 	void getBumpIntensity()const
 	{
-		fprintf(mFile,"\"%s.bmi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmi\"");
 	}
 	void getBumpBlur()const
 	{
-		fprintf(mFile,"\"%s.bbl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bbl\"");
 	}
 	void getLuminanceIsDisplacement()const
 	{
-		fprintf(mFile,"\"%s.lid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lid\"");
 	}
 	void getTexColor1()const
 	{
-		fprintf(mFile,"\"%s.tc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc1\"");
 	}
 	void getTexColor1R()const
 	{
-		fprintf(mFile,"\"%s.tc1.x1r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc1.x1r\"");
 	}
 	void getTexColor1G()const
 	{
-		fprintf(mFile,"\"%s.tc1.x1g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc1.x1g\"");
 	}
 	void getTexColor1B()const
 	{
-		fprintf(mFile,"\"%s.tc1.x1b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc1.x1b\"");
 	}
 	void getTexColor2()const
 	{
-		fprintf(mFile,"\"%s.tc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc2\"");
 	}
 	void getTexColor2R()const
 	{
-		fprintf(mFile,"\"%s.tc2.x2r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc2.x2r\"");
 	}
 	void getTexColor2G()const
 	{
-		fprintf(mFile,"\"%s.tc2.x2g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc2.x2g\"");
 	}
 	void getTexColor2B()const
 	{
-		fprintf(mFile,"\"%s.tc2.x2b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc2.x2b\"");
 	}
 	void getTexAlpha1()const
 	{
-		fprintf(mFile,"\"%s.al1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al1\"");
 	}
 	void getTexAlpha2()const
 	{
-		fprintf(mFile,"\"%s.al2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al2\"");
 	}
 	void getTexUniformity()const
 	{
-		fprintf(mFile,"\"%s.txu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txu\"");
 	}
 	void getFringeRemoval()const
 	{
-		fprintf(mFile,"\"%s.frm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frm\"");
 	}
 	void getRepeatU()const
 	{
-		fprintf(mFile,"\"%s.rpu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpu\"");
 	}
 	void getRepeatV()const
 	{
-		fprintf(mFile,"\"%s.rpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpv\"");
 	}
 	void getOffsetU()const
 	{
-		fprintf(mFile,"\"%s.ofu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofu\"");
 	}
 	void getOffsetV()const
 	{
-		fprintf(mFile,"\"%s.ofv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofv\"");
 	}
 	void getBlurMult()const
 	{
-		fprintf(mFile,"\"%s.bmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmt\"");
 	}
 	void getSmear()const
 	{
-		fprintf(mFile,"\"%s.smr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smr\"");
 	}
 	void getSmearU()const
 	{
-		fprintf(mFile,"\"%s.sru\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sru\"");
 	}
 	void getSmearV()const
 	{
-		fprintf(mFile,"\"%s.srv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srv\"");
 	}
 	void getImageName()const
 	{
-		fprintf(mFile,"\"%s.imn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imn\"");
 	}
 	void getUseFrameExtension()const
 	{
-		fprintf(mFile,"\"%s.ufe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufe\"");
 	}
 	void getFrameExtension()const
 	{
-		fprintf(mFile,"\"%s.fe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fe\"");
 	}
 	void getFractalRatio()const
 	{
-		fprintf(mFile,"\"%s.fra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fra\"");
 	}
 	void getFractalAmplitude()const
 	{
-		fprintf(mFile,"\"%s.fam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fam\"");
 	}
 	void getFractalThreshold()const
 	{
-		fprintf(mFile,"\"%s.fth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fth\"");
 	}
 	void getMultiStreaks()const
 	{
-		fprintf(mFile,"\"%s.mst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mst\"");
 	}
 	void getMultiStreakSpread1()const
 	{
-		fprintf(mFile,"\"%s.ms1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ms1\"");
 	}
 	void getMultiStreakSpread2()const
 	{
-		fprintf(mFile,"\"%s.ms2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ms2\"");
 	}
 	void getMultiStreakDiffuseRand()const
 	{
-		fprintf(mFile,"\"%s.msdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msdr\"");
 	}
 	void getMultiStreakSpecularRand()const
 	{
-		fprintf(mFile,"\"%s.mssr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mssr\"");
 	}
 	void getMultiStreakLightAll()const
 	{
-		fprintf(mFile,"\"%s.msla\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msla\"");
 	}
 	void getSingleSided()const
 	{
-		fprintf(mFile,"\"%s.snsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".snsd\"");
 	}
 	void getTubeSections()const
 	{
-		fprintf(mFile,"\"%s.tbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tbs\"");
 	}
 	void getSubSegments()const
 	{
-		fprintf(mFile,"\"%s.ssg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssg\"");
 	}
 	void getPerPixelLighting()const
 	{
-		fprintf(mFile,"\"%s.ppl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppl\"");
 	}
 	void getWidthScale(size_t wsc_i)const
 	{
-		fprintf(mFile,"\"%s.wsc[%i]\"",mName.c_str(),wsc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wsc[",wsc_i,"]\"");
 	}
 	void getWidthScale()const
 	{
 
-		fprintf(mFile,"\"%s.wsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wsc\"");
 	}
 	void getWidthScale_Position(size_t wsc_i)const
 	{
-		fprintf(mFile,"\"%s.wsc[%i].wscp\"",mName.c_str(),wsc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wsc[",wsc_i,"].wscp\"");
 	}
 	void getWidthScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.wsc.wscp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wsc.wscp\"");
 	}
 	void getWidthScale_FloatValue(size_t wsc_i)const
 	{
-		fprintf(mFile,"\"%s.wsc[%i].wscfv\"",mName.c_str(),wsc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wsc[",wsc_i,"].wscfv\"");
 	}
 	void getWidthScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.wsc.wscfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wsc.wscfv\"");
 	}
 	void getWidthScale_Interp(size_t wsc_i)const
 	{
-		fprintf(mFile,"\"%s.wsc[%i].wsci\"",mName.c_str(),wsc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wsc[",wsc_i,"].wsci\"");
 	}
 	void getWidthScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.wsc.wsci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wsc.wsci\"");
 	}
 	void getLeafWidthScale(size_t lws_i)const
 	{
-		fprintf(mFile,"\"%s.lws[%i]\"",mName.c_str(),lws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lws[",lws_i,"]\"");
 	}
 	void getLeafWidthScale()const
 	{
 
-		fprintf(mFile,"\"%s.lws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lws\"");
 	}
 	void getLeafWidthScale_Position(size_t lws_i)const
 	{
-		fprintf(mFile,"\"%s.lws[%i].lwsp\"",mName.c_str(),lws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lws[",lws_i,"].lwsp\"");
 	}
 	void getLeafWidthScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.lws.lwsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lws.lwsp\"");
 	}
 	void getLeafWidthScale_FloatValue(size_t lws_i)const
 	{
-		fprintf(mFile,"\"%s.lws[%i].lwsfv\"",mName.c_str(),lws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lws[",lws_i,"].lwsfv\"");
 	}
 	void getLeafWidthScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.lws.lwsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lws.lwsfv\"");
 	}
 	void getLeafWidthScale_Interp(size_t lws_i)const
 	{
-		fprintf(mFile,"\"%s.lws[%i].lwsi\"",mName.c_str(),lws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lws[",lws_i,"].lwsi\"");
 	}
 	void getLeafWidthScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.lws.lwsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lws.lwsi\"");
 	}
 	void getPetalWidthScale(size_t pws_i)const
 	{
-		fprintf(mFile,"\"%s.pws[%i]\"",mName.c_str(),pws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pws[",pws_i,"]\"");
 	}
 	void getPetalWidthScale()const
 	{
 
-		fprintf(mFile,"\"%s.pws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pws\"");
 	}
 	void getPetalWidthScale_Position(size_t pws_i)const
 	{
-		fprintf(mFile,"\"%s.pws[%i].pwsp\"",mName.c_str(),pws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pws[",pws_i,"].pwsp\"");
 	}
 	void getPetalWidthScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.pws.pwsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pws.pwsp\"");
 	}
 	void getPetalWidthScale_FloatValue(size_t pws_i)const
 	{
-		fprintf(mFile,"\"%s.pws[%i].pwsfv\"",mName.c_str(),pws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pws[",pws_i,"].pwsfv\"");
 	}
 	void getPetalWidthScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.pws.pwsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pws.pwsfv\"");
 	}
 	void getPetalWidthScale_Interp(size_t pws_i)const
 	{
-		fprintf(mFile,"\"%s.pws[%i].pwsi\"",mName.c_str(),pws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pws[",pws_i,"].pwsi\"");
 	}
 	void getPetalWidthScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.pws.pwsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pws.pwsi\"");
 	}
 	void getTwigLengthScale(size_t tls_i)const
 	{
-		fprintf(mFile,"\"%s.tls[%i]\"",mName.c_str(),tls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tls[",tls_i,"]\"");
 	}
 	void getTwigLengthScale()const
 	{
 
-		fprintf(mFile,"\"%s.tls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tls\"");
 	}
 	void getTwigLengthScale_Position(size_t tls_i)const
 	{
-		fprintf(mFile,"\"%s.tls[%i].tlsp\"",mName.c_str(),tls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tls[",tls_i,"].tlsp\"");
 	}
 	void getTwigLengthScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.tls.tlsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tls.tlsp\"");
 	}
 	void getTwigLengthScale_FloatValue(size_t tls_i)const
 	{
-		fprintf(mFile,"\"%s.tls[%i].tlsfv\"",mName.c_str(),tls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tls[",tls_i,"].tlsfv\"");
 	}
 	void getTwigLengthScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.tls.tlsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tls.tlsfv\"");
 	}
 	void getTwigLengthScale_Interp(size_t tls_i)const
 	{
-		fprintf(mFile,"\"%s.tls[%i].tlsi\"",mName.c_str(),tls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tls[",tls_i,"].tlsi\"");
 	}
 	void getTwigLengthScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.tls.tlsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tls.tlsi\"");
 	}
 	void getBranchThorns()const
 	{
-		fprintf(mFile,"\"%s.bth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bth\"");
 	}
 	void getTwigThorns()const
 	{
-		fprintf(mFile,"\"%s.tth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tth\"");
 	}
 	void getLeafThorns()const
 	{
-		fprintf(mFile,"\"%s.lth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lth\"");
 	}
 	void getFlowerThorns()const
 	{
-		fprintf(mFile,"\"%s.flt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flt\"");
 	}
 	void getThornDensity()const
 	{
-		fprintf(mFile,"\"%s.nth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nth\"");
 	}
 	void getThornLength()const
 	{
-		fprintf(mFile,"\"%s.tln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tln\"");
 	}
 	void getThornBaseWidth()const
 	{
-		fprintf(mFile,"\"%s.tbwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tbwd\"");
 	}
 	void getThornTipWidth()const
 	{
-		fprintf(mFile,"\"%s.ttwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ttwd\"");
 	}
 	void getThornElevation()const
 	{
-		fprintf(mFile,"\"%s.tel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tel\"");
 	}
 	void getThornSpecular()const
 	{
-		fprintf(mFile,"\"%s.tsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tsp\"");
 	}
 	void getThornBaseColor()const
 	{
-		fprintf(mFile,"\"%s.tbc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tbc\"");
 	}
 	void getThornBaseColorR()const
 	{
-		fprintf(mFile,"\"%s.tbc.tbcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tbc.tbcr\"");
 	}
 	void getThornBaseColorG()const
 	{
-		fprintf(mFile,"\"%s.tbc.tbcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tbc.tbcg\"");
 	}
 	void getThornBaseColorB()const
 	{
-		fprintf(mFile,"\"%s.tbc.tbcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tbc.tbcb\"");
 	}
 	void getThornTipColor()const
 	{
-		fprintf(mFile,"\"%s.ttc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ttc\"");
 	}
 	void getThornTipColorR()const
 	{
-		fprintf(mFile,"\"%s.ttc.ttcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ttc.ttcr\"");
 	}
 	void getThornTipColorG()const
 	{
-		fprintf(mFile,"\"%s.ttc.ttcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ttc.ttcg\"");
 	}
 	void getThornTipColorB()const
 	{
-		fprintf(mFile,"\"%s.ttc.ttcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ttc.ttcb\"");
 	}
 	void getEnvironment(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i]\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"]\"");
 	}
 	void getEnvironment()const
 	{
 
-		fprintf(mFile,"\"%s.env\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env\"");
 	}
 	void getEnvironment_Position(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envp\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envp\"");
 	}
 	void getEnvironment_Position()const
 	{
 
-		fprintf(mFile,"\"%s.env.envp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envp\"");
 	}
 	void getEnvironment_Color(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc\"");
 	}
 	void getEnvironment_Color()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc\"");
 	}
 	void getEnvironment_ColorR(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcr\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcr\"");
 	}
 	void getEnvironment_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcr\"");
 	}
 	void getEnvironment_ColorG(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcg\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcg\"");
 	}
 	void getEnvironment_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcg\"");
 	}
 	void getEnvironment_ColorB(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcb\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcb\"");
 	}
 	void getEnvironment_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcb\"");
 	}
 	void getEnvironment_Interp(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envi\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envi\"");
 	}
 	void getEnvironment_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.env.envi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envi\"");
 	}
 	void getReflectionRolloff(size_t rro_i)const
 	{
-		fprintf(mFile,"\"%s.rro[%i]\"",mName.c_str(),rro_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rro[",rro_i,"]\"");
 	}
 	void getReflectionRolloff()const
 	{
 
-		fprintf(mFile,"\"%s.rro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro\"");
 	}
 	void getReflectionRolloff_Position(size_t rro_i)const
 	{
-		fprintf(mFile,"\"%s.rro[%i].rrop\"",mName.c_str(),rro_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rro[",rro_i,"].rrop\"");
 	}
 	void getReflectionRolloff_Position()const
 	{
 
-		fprintf(mFile,"\"%s.rro.rrop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro.rrop\"");
 	}
 	void getReflectionRolloff_FloatValue(size_t rro_i)const
 	{
-		fprintf(mFile,"\"%s.rro[%i].rrofv\"",mName.c_str(),rro_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rro[",rro_i,"].rrofv\"");
 	}
 	void getReflectionRolloff_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.rro.rrofv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro.rrofv\"");
 	}
 	void getReflectionRolloff_Interp(size_t rro_i)const
 	{
-		fprintf(mFile,"\"%s.rro[%i].rroi\"",mName.c_str(),rro_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rro[",rro_i,"].rroi\"");
 	}
 	void getReflectionRolloff_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.rro.rroi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro.rroi\"");
 	}
 	void getBranchReflectivity()const
 	{
-		fprintf(mFile,"\"%s.brf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".brf\"");
 	}
 	void getLeafReflectivity()const
 	{
-		fprintf(mFile,"\"%s.lrf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lrf\"");
 	}
 	void getFlowerReflectivity()const
 	{
-		fprintf(mFile,"\"%s.frf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frf\"");
 	}
 	void getForwardTwist()const
 	{
-		fprintf(mFile,"\"%s.fwt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fwt\"");
 	}
 	void getLeafForwardTwist()const
 	{
-		fprintf(mFile,"\"%s.lfwt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfwt\"");
 	}
 	void getPetalForwardTwist()const
 	{
-		fprintf(mFile,"\"%s.lpwt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lpwt\"");
 	}
 	void getEndCaps()const
 	{
-		fprintf(mFile,"\"%s.edc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".edc\"");
 	}
 	void getHardEdges()const
 	{
-		fprintf(mFile,"\"%s.hde\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hde\"");
 	}
 protected:
 	Brush(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
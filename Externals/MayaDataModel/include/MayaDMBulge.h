@@ -27,20 +27,20 @@ public:
 	void setUWidth(float uw)
 	{
 		if(uw == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".uw\" %f;\n", uw);
+		writeFloat(mFile,"\tsetAttr \".uw\" ",uw,";\n");
 	}
 	void setVWidth(float vw)
 	{
 		if(vw == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".vw\" %f;\n", vw);
+		writeFloat(mFile,"\tsetAttr \".vw\" ",vw,";\n");
 	}
 	void getUWidth()const
 	{
-		fprintf(mFile,"\"%s.uw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uw\"");
 	}
 	void getVWidth()const
 	{
-		fprintf(mFile,"\"%s.vw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vw\"");
 	}
 protected:
 	Bulge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
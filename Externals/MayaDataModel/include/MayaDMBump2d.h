@@ -27,376 +27,376 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setAdjustEdges(bool ae)
 	{
 		if(ae == false) return;
-		fprintf(mFile,"\tsetAttr \".ae\" %i;\n", ae);
+		writeInt(mFile,"\tsetAttr \".ae\" ",ae,";\n");
 	}
 	void setBumpDepth(float bd)
 	{
 		if(bd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bd\" %f;\n", bd);
+		writeFloat(mFile,"\tsetAttr \".bd\" ",bd,";\n");
 	}
 	void setBumpInterp(unsigned int bi)
 	{
 		if(bi == 0) return;
-		fprintf(mFile,"\tsetAttr \".bi\" %i;\n", bi);
+		writeInt(mFile,"\tsetAttr \".bi\" ",bi,";\n");
 	}
 	void setBumpFilter(float bf)
 	{
 		if(bf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bf\" %f;\n", bf);
+		writeFloat(mFile,"\tsetAttr \".bf\" ",bf,";\n");
 	}
 	void setBumpFilterOffset(float bfo)
 	{
 		if(bfo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bfo\" %f;\n", bfo);
+		writeFloat(mFile,"\tsetAttr \".bfo\" ",bfo,";\n");
 	}
 	void setBumpValue(float bv)
 	{
 		if(bv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bv\" %f;\n", bv);
+		writeFloat(mFile,"\tsetAttr \".bv\" ",bv,";\n");
 	}
 	void setProvide3dInfo(bool p3d)
 	{
 		if(p3d == false) return;
-		fprintf(mFile,"\tsetAttr \".p3d\" %i;\n", p3d);
+		writeInt(mFile,"\tsetAttr \".p3d\" ",p3d,";\n");
 	}
 	void setVertexUvOne(const float2& vt1)
 	{
-		fprintf(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
 		vt1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvOneU(float t1u)
 	{
 		if(t1u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1u\" %f;\n", t1u);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1u\" ",t1u,";\n");
 	}
 	void setVertexUvOneV(float t1v)
 	{
 		if(t1v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1v\" %f;\n", t1v);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1v\" ",t1v,";\n");
 	}
 	void setVertexUvTwo(const float2& vt2)
 	{
-		fprintf(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
 		vt2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvTwoU(float t2u)
 	{
 		if(t2u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2u\" %f;\n", t2u);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2u\" ",t2u,";\n");
 	}
 	void setVertexUvTwoV(float t2v)
 	{
 		if(t2v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2v\" %f;\n", t2v);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2v\" ",t2v,";\n");
 	}
 	void setVertexCameraOne(const float3& vc1)
 	{
-		fprintf(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
 		vc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraOneX(float c1x)
 	{
 		if(c1x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1x\" %f;\n", c1x);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1x\" ",c1x,";\n");
 	}
 	void setVertexCameraOneY(float c1y)
 	{
 		if(c1y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1y\" %f;\n", c1y);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1y\" ",c1y,";\n");
 	}
 	void setVertexCameraOneZ(float c1z)
 	{
 		if(c1z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1z\" %f;\n", c1z);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1z\" ",c1z,";\n");
 	}
 	void setVertexCameraTwo(const float3& vc2)
 	{
-		fprintf(mFile,"\tsetAttr \".vc2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc2\" -type \"float3\" ");
 		vc2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraTwoX(float c2x)
 	{
 		if(c2x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2x\" %f;\n", c2x);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2x\" ",c2x,";\n");
 	}
 	void setVertexCameraTwoY(float c2y)
 	{
 		if(c2y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2y\" %f;\n", c2y);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2y\" ",c2y,";\n");
 	}
 	void setVertexCameraTwoZ(float c2z)
 	{
 		if(c2z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2z\" %f;\n", c2z);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2z\" ",c2z,";\n");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getPointObj()const
 	{
-		fprintf(mFile,"\"%s.po\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po\"");
 	}
 	void getPointObjX()const
 	{
-		fprintf(mFile,"\"%s.po.pox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.pox\"");
 	}
 	void getPointObjY()const
 	{
-		fprintf(mFile,"\"%s.po.poy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poy\"");
 	}
 	void getPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.po.poz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rpox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rpox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.rpoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rpoy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.rpoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rpoz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getRayOrigin()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getRayOriginX()const
 	{
-		fprintf(mFile,"\"%s.ro.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rox\"");
 	}
 	void getRayOriginY()const
 	{
-		fprintf(mFile,"\"%s.ro.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.roy\"");
 	}
 	void getRayOriginZ()const
 	{
-		fprintf(mFile,"\"%s.ro.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.roz\"");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.u\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.v\"");
 	}
 	void getUvFilterSize()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getUvFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.fs.fsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsx\"");
 	}
 	void getUvFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.fs.fsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsy\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getTangentUCamera()const
 	{
-		fprintf(mFile,"\"%s.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu\"");
 	}
 	void getTangentUx()const
 	{
-		fprintf(mFile,"\"%s.tu.tux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tux\"");
 	}
 	void getTangentUy()const
 	{
-		fprintf(mFile,"\"%s.tu.tuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tuy\"");
 	}
 	void getTangentUz()const
 	{
-		fprintf(mFile,"\"%s.tu.tuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tuz\"");
 	}
 	void getTangentVCamera()const
 	{
-		fprintf(mFile,"\"%s.tv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv\"");
 	}
 	void getTangentVx()const
 	{
-		fprintf(mFile,"\"%s.tv.tvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvx\"");
 	}
 	void getTangentVy()const
 	{
-		fprintf(mFile,"\"%s.tv.tvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvy\"");
 	}
 	void getTangentVz()const
 	{
-		fprintf(mFile,"\"%s.tv.tvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvz\"");
 	}
 	void getAdjustEdges()const
 	{
-		fprintf(mFile,"\"%s.ae\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ae\"");
 	}
 	void getBumpDepth()const
 	{
-		fprintf(mFile,"\"%s.bd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bd\"");
 	}
 	void getBumpInterp()const
 	{
-		fprintf(mFile,"\"%s.bi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bi\"");
 	}
 	void getBumpFilter()const
 	{
-		fprintf(mFile,"\"%s.bf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bf\"");
 	}
 	void getBumpFilterOffset()const
 	{
-		fprintf(mFile,"\"%s.bfo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bfo\"");
 	}
 	void getBumpValue()const
 	{
-		fprintf(mFile,"\"%s.bv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv\"");
 	}
 	void getProvide3dInfo()const
 	{
-		fprintf(mFile,"\"%s.p3d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p3d\"");
 	}
 	void getOutNormal()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutNormalX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutNormalY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutNormalZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 	void getVertexUvOne()const
 	{
-		fprintf(mFile,"\"%s.vt1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1\"");
 	}
 	void getVertexUvOneU()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1u\"");
 	}
 	void getVertexUvOneV()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1v\"");
 	}
 	void getVertexUvTwo()const
 	{
-		fprintf(mFile,"\"%s.vt2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2\"");
 	}
 	void getVertexUvTwoU()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2u\"");
 	}
 	void getVertexUvTwoV()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2v\"");
 	}
 	void getVertexCameraOne()const
 	{
-		fprintf(mFile,"\"%s.vc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1\"");
 	}
 	void getVertexCameraOneX()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1x\"");
 	}
 	void getVertexCameraOneY()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1y\"");
 	}
 	void getVertexCameraOneZ()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1z\"");
 	}
 	void getVertexCameraTwo()const
 	{
-		fprintf(mFile,"\"%s.vc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2\"");
 	}
 	void getVertexCameraTwoX()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2x\"");
 	}
 	void getVertexCameraTwoY()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2y\"");
 	}
 	void getVertexCameraTwoZ()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2z\"");
 	}
 protected:
 	Bump2d(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
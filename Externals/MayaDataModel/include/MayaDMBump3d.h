@@ -27,195 +27,195 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setBumpDepth(float bd)
 	{
 		if(bd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bd\" %f;\n", bd);
+		writeFloat(mFile,"\tsetAttr \".bd\" ",bd,";\n");
 	}
 	void setBumpFilter(float bf)
 	{
 		if(bf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bf\" %f;\n", bf);
+		writeFloat(mFile,"\tsetAttr \".bf\" ",bf,";\n");
 	}
 	void setBumpFilterOffset(float bfo)
 	{
 		if(bfo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bfo\" %f;\n", bfo);
+		writeFloat(mFile,"\tsetAttr \".bfo\" ",bfo,";\n");
 	}
 	void setBumpValue(float bv)
 	{
 		if(bv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bv\" %f;\n", bv);
+		writeFloat(mFile,"\tsetAttr \".bv\" ",bv,";\n");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getPointObj()const
 	{
-		fprintf(mFile,"\"%s.po\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po\"");
 	}
 	void getPointObjX()const
 	{
-		fprintf(mFile,"\"%s.po.pox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.pox\"");
 	}
 	void getPointObjY()const
 	{
-		fprintf(mFile,"\"%s.po.poy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poy\"");
 	}
 	void getPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.po.poz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rpox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rpox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.rpoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rpoy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.rpoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rpoz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getRayOrigin()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getRayOriginX()const
 	{
-		fprintf(mFile,"\"%s.ro.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rox\"");
 	}
 	void getRayOriginY()const
 	{
-		fprintf(mFile,"\"%s.ro.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.roy\"");
 	}
 	void getRayOriginZ()const
 	{
-		fprintf(mFile,"\"%s.ro.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.roz\"");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getTangentUCamera()const
 	{
-		fprintf(mFile,"\"%s.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu\"");
 	}
 	void getTangentUx()const
 	{
-		fprintf(mFile,"\"%s.tu.tux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tux\"");
 	}
 	void getTangentUy()const
 	{
-		fprintf(mFile,"\"%s.tu.tuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tuy\"");
 	}
 	void getTangentUz()const
 	{
-		fprintf(mFile,"\"%s.tu.tuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tuz\"");
 	}
 	void getTangentVCamera()const
 	{
-		fprintf(mFile,"\"%s.tv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv\"");
 	}
 	void getTangentVx()const
 	{
-		fprintf(mFile,"\"%s.tv.tvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvx\"");
 	}
 	void getTangentVy()const
 	{
-		fprintf(mFile,"\"%s.tv.tvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvy\"");
 	}
 	void getTangentVz()const
 	{
-		fprintf(mFile,"\"%s.tv.tvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvz\"");
 	}
 	void getBumpDepth()const
 	{
-		fprintf(mFile,"\"%s.bd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bd\"");
 	}
 	void getBumpFilter()const
 	{
-		fprintf(mFile,"\"%s.bf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bf\"");
 	}
 	void getBumpFilterOffset()const
 	{
-		fprintf(mFile,"\"%s.bfo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bfo\"");
 	}
 	void getBumpValue()const
 	{
-		fprintf(mFile,"\"%s.bv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv\"");
 	}
 	void getOutNormal()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutNormalX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutNormalY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutNormalZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 protected:
 	Bump3d(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,16 +26,16 @@ public:
 
 	void getOutCacheData(size_t ocd_i)const
 	{
-		fprintf(mFile,"\"%s.ocd[%i]\"",mName.c_str(),ocd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ocd[",ocd_i,"]\"");
 	}
 	void getOutCacheData()const
 	{
 
-		fprintf(mFile,"\"%s.ocd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd\"");
 	}
 	void getInRange()const
 	{
-		fprintf(mFile,"\"%s.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir\"");
 	}
 protected:
 	CacheBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
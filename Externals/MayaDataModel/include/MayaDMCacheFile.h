@@ -27,262 +27,262 @@ public:
 	void setCacheName(const string& cn)
 	{
 		if(cn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cn\" -type \"string\" ");
 		cn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCachePath(const string& cp)
 	{
 		if(cp == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cp\" -type \"string\" ");
 		cp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChannel(size_t ch_i,const string& ch)
 	{
 		if(ch == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ch[%i]\" -type \"string\" ",ch_i);
+		writeInt(mFile,"\tsetAttr \".ch[",ch_i,"]\" -type \"string\" ");
 		ch.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChannel(size_t ch_start,size_t ch_end,string* ch)
 	{
-		fprintf(mFile,"\tsetAttr \".ch[%i:%i]\" ", ch_start,ch_end);
+		writeInt(mFile,"\tsetAttr \".ch[",ch_start); writeInt(mFile,":",ch_end,"]\" ");
 		size_t size = (ch_end-ch_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ch[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startChannel(size_t ch_start,size_t ch_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ch[%i:%i]\"",ch_start,ch_end);
-		fprintf(mFile," -type \"string\" ");
+		writeInt(mFile,"\tsetAttr \".ch[",ch_start); writeInt(mFile,":",ch_end,"]\"");
+		writeString(mFile," -type \"string\" ");
 	}
 	void appendChannel(const string& ch)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ch.write(mFile);
 	}
 	void endChannel()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPerPtWeights(size_t ppw_i,const doubleArray& ppw)
 	{
 		if(ppw.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ppw[%i]\" -type \"doubleArray\" ",ppw_i);
+		writeInt(mFile,"\tsetAttr \".ppw[",ppw_i,"]\" -type \"doubleArray\" ");
 		ppw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPerPtWeights(size_t ppw_start,size_t ppw_end,doubleArray* ppw)
 	{
-		fprintf(mFile,"\tsetAttr \".ppw[%i:%i]\" ", ppw_start,ppw_end);
+		writeInt(mFile,"\tsetAttr \".ppw[",ppw_start); writeInt(mFile,":",ppw_end,"]\" ");
 		size_t size = (ppw_end-ppw_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ppw[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPerPtWeights(size_t ppw_start,size_t ppw_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ppw[%i:%i]\"",ppw_start,ppw_end);
-		fprintf(mFile," -type \"doubleArray\" ");
+		writeInt(mFile,"\tsetAttr \".ppw[",ppw_start); writeInt(mFile,":",ppw_end,"]\"");
+		writeString(mFile," -type \"doubleArray\" ");
 	}
 	void appendPerPtWeights(const doubleArray& ppw)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ppw.write(mFile);
 	}
 	void endPerPtWeights()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOriginalStart(double os)
 	{
 		if(os == 0) return;
-		fprintf(mFile,"\tsetAttr \".os\" %f;\n", os);
+		writeFloat(mFile,"\tsetAttr \".os\" ",os,";\n");
 	}
 	void setOriginalEnd(double oe)
 	{
 		if(oe == 0) return;
-		fprintf(mFile,"\tsetAttr \".oe\" %f;\n", oe);
+		writeFloat(mFile,"\tsetAttr \".oe\" ",oe,";\n");
 	}
 	void setSourceStart(double ss)
 	{
 		if(ss == 0) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %f;\n", ss);
+		writeFloat(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setSourceEnd(double se)
 	{
 		if(se == 0) return;
-		fprintf(mFile,"\tsetAttr \".se\" %f;\n", se);
+		writeFloat(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setStartFrame(double sf)
 	{
 		if(sf == 0) return;
-		fprintf(mFile,"\tsetAttr \".sf\" %f;\n", sf);
+		writeFloat(mFile,"\tsetAttr \".sf\" ",sf,";\n");
 	}
 	void setScale(double sc)
 	{
 		if(sc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %f;\n", sc);
+		writeFloat(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setHold(double h)
 	{
 		if(h == 0) return;
-		fprintf(mFile,"\tsetAttr \".h\" %f;\n", h);
+		writeFloat(mFile,"\tsetAttr \".h\" ",h,";\n");
 	}
 	void setPreCycle(double cb)
 	{
 		if(cb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".cb\" ",cb,";\n");
 	}
 	void setPostCycle(double ca)
 	{
 		if(ca == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ca\" %f;\n", ca);
+		writeFloat(mFile,"\tsetAttr \".ca\" ",ca,";\n");
 	}
 	void setTime(double tim)
 	{
 		if(tim == 0) return;
-		fprintf(mFile,"\tsetAttr \".tim\" %f;\n", tim);
+		writeFloat(mFile,"\tsetAttr \".tim\" ",tim,";\n");
 	}
 	void setEnable(bool en)
 	{
 		if(en == 1) return;
-		fprintf(mFile,"\tsetAttr \".en\" %i;\n", en);
+		writeInt(mFile,"\tsetAttr \".en\" ",en,";\n");
 	}
 	void setTrack(short tr)
 	{
 		if(tr == 0) return;
-		fprintf(mFile,"\tsetAttr \".tr\" %i;\n", tr);
+		writeInt(mFile,"\tsetAttr \".tr\" ",tr,";\n");
 	}
 	void setTrackState(short ts)
 	{
 		if(ts == 0) return;
-		fprintf(mFile,"\tsetAttr \".ts\" %i;\n", ts);
+		writeInt(mFile,"\tsetAttr \".ts\" ",ts,";\n");
 	}
 	void setMultiThread(bool mt)
 	{
 		if(mt == 0) return;
-		fprintf(mFile,"\tsetAttr \".mt\" %i;\n", mt);
+		writeInt(mFile,"\tsetAttr \".mt\" ",mt,";\n");
 	}
 	void setMemQueueSize(int qs)
 	{
 		if(qs == 20) return;
-		fprintf(mFile,"\tsetAttr \".qs\" %i;\n", qs);
+		writeInt(mFile,"\tsetAttr \".qs\" ",qs,";\n");
 	}
 	void setDisplayLoadProgress(bool dp)
 	{
 		if(dp == 1) return;
-		fprintf(mFile,"\tsetAttr \".dp\" %i;\n", dp);
+		writeInt(mFile,"\tsetAttr \".dp\" ",dp,";\n");
 	}
 	void getCacheName()const
 	{
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getCachePath()const
 	{
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getChannel(size_t ch_i)const
 	{
-		fprintf(mFile,"\"%s.ch[%i]\"",mName.c_str(),ch_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ch[",ch_i,"]\"");
 	}
 	void getChannel()const
 	{
 
-		fprintf(mFile,"\"%s.ch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ch\"");
 	}
 	void getCacheWeights()const
 	{
-		fprintf(mFile,"\"%s.cw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cw\"");
 	}
 	void getPerPtWeights(size_t ppw_i)const
 	{
-		fprintf(mFile,"\"%s.ppw[%i]\"",mName.c_str(),ppw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ppw[",ppw_i,"]\"");
 	}
 	void getPerPtWeights()const
 	{
 
-		fprintf(mFile,"\"%s.ppw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppw\"");
 	}
 	void getOriginalStart()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getOriginalEnd()const
 	{
-		fprintf(mFile,"\"%s.oe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oe\"");
 	}
 	void getSourceStart()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getSourceEnd()const
 	{
-		fprintf(mFile,"\"%s.se\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".se\"");
 	}
 	void getStartFrame()const
 	{
-		fprintf(mFile,"\"%s.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sf\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getHold()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getPreCycle()const
 	{
-		fprintf(mFile,"\"%s.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb\"");
 	}
 	void getPostCycle()const
 	{
-		fprintf(mFile,"\"%s.ca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ca\"");
 	}
 	void getStart()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getEnd()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.tim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tim\"");
 	}
 	void getEnable()const
 	{
-		fprintf(mFile,"\"%s.en\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".en\"");
 	}
 	void getTrack()const
 	{
-		fprintf(mFile,"\"%s.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tr\"");
 	}
 	void getTrackState()const
 	{
-		fprintf(mFile,"\"%s.ts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ts\"");
 	}
 	void getMultiThread()const
 	{
-		fprintf(mFile,"\"%s.mt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mt\"");
 	}
 	void getMemQueueSize()const
 	{
-		fprintf(mFile,"\"%s.qs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".qs\"");
 	}
 	void getDisplayLoadProgress()const
 	{
-		fprintf(mFile,"\"%s.dp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dp\"");
 	}
 protected:
 	CacheFile(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
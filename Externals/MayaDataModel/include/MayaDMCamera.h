@@ -27,20 +27,20 @@ public:
 			void write(FILE* file) const
 			{
 				filmRollPivot.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f ", filmRollValue);
-				fprintf(file,"%i", filmRollOrder);
+				writeString(file," ");
+				writeFloat(file,"",filmRollValue," ");
+				writeInt(file,"",filmRollOrder);
 			}
 		} filmRollControl;
 		double postScale;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", preScale);
+			writeFloat(file,"",preScale," ");
 			filmTranslate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			filmRollControl.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", postScale);
+			writeString(file," ");
+			writeFloat(file,"",postScale);
 		}
 	};
 	struct MentalRayControls{
@@ -56,16 +56,16 @@ public:
 		bool miFbComputeContour;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miFbComputeColor);
-			fprintf(file,"%i ", miFbBitsizeColor);
-			fprintf(file,"%i ", miFbComputeAlpha);
-			fprintf(file,"%i ", miFbBitsizeAlpha);
-			fprintf(file,"%i ", miFbComputeDepth);
-			fprintf(file,"%i ", miFbComputeNormal);
-			fprintf(file,"%i ", miFbComputeMotion);
-			fprintf(file,"%i ", miFbComputeCoverage);
-			fprintf(file,"%i ", miFbComputeTag);
-			fprintf(file,"%i ", miFbComputeContour);
+			writeInt(file,"",miFbComputeColor," ");
+			writeInt(file,"",miFbBitsizeColor," ");
+			writeInt(file,"",miFbComputeAlpha," ");
+			writeInt(file,"",miFbBitsizeAlpha," ");
+			writeInt(file,"",miFbComputeDepth," ");
+			writeInt(file,"",miFbComputeNormal," ");
+			writeInt(file,"",miFbComputeMotion," ");
+			writeInt(file,"",miFbComputeCoverage," ");
+			writeInt(file,"",miFbComputeTag," ");
+			writeInt(file,"",miFbComputeContour," ");
 		}
 	};
 public:
@@ -78,855 +78,855 @@ public:
 	void setRenderable(bool rnd)
 	{
 		if(rnd == true) return;
-		fprintf(mFile,"\tsetAttr \".rnd\" %i;\n", rnd);
+		writeInt(mFile,"\tsetAttr \".rnd\" ",rnd,";\n");
 	}
 	void setCameraAperture(const double2& cap)
 	{
 		if(cap == double2(3.6, 2.4)) return;
-		fprintf(mFile,"\tsetAttr \".cap\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".cap\" -type \"double2\" ");
 		cap.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHorizontalFilmAperture(double hfa)
 	{
 		if(hfa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cap.hfa\" %f;\n", hfa);
+		writeFloat(mFile,"\tsetAttr \".cap.hfa\" ",hfa,";\n");
 	}
 	void setVerticalFilmAperture(double vfa)
 	{
 		if(vfa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cap.vfa\" %f;\n", vfa);
+		writeFloat(mFile,"\tsetAttr \".cap.vfa\" ",vfa,";\n");
 	}
 	void setShakeOverscan(double sos)
 	{
 		if(sos == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sos\" %f;\n", sos);
+		writeFloat(mFile,"\tsetAttr \".sos\" ",sos,";\n");
 	}
 	void setShakeOverscanEnabled(bool soe)
 	{
 		if(soe == false) return;
-		fprintf(mFile,"\tsetAttr \".soe\" %i;\n", soe);
+		writeInt(mFile,"\tsetAttr \".soe\" ",soe,";\n");
 	}
 	void setFilmOffset(const double2& fio)
 	{
 		if(fio == double2(0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".fio\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".fio\" -type \"double2\" ");
 		fio.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHorizontalFilmOffset(double hfo)
 	{
 		if(hfo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fio.hfo\" %f;\n", hfo);
+		writeFloat(mFile,"\tsetAttr \".fio.hfo\" ",hfo,";\n");
 	}
 	void setVerticalFilmOffset(double vfo)
 	{
 		if(vfo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fio.vfo\" %f;\n", vfo);
+		writeFloat(mFile,"\tsetAttr \".fio.vfo\" ",vfo,";\n");
 	}
 	void setShakeEnabled(bool se)
 	{
 		if(se == false) return;
-		fprintf(mFile,"\tsetAttr \".se\" %i;\n", se);
+		writeInt(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setShake(const double2& shk)
 	{
 		if(shk == double2(0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".shk\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".shk\" -type \"double2\" ");
 		shk.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHorizontalShake(double hs)
 	{
 		if(hs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".shk.hs\" %f;\n", hs);
+		writeFloat(mFile,"\tsetAttr \".shk.hs\" ",hs,";\n");
 	}
 	void setVerticalShake(double vs)
 	{
 		if(vs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".shk.vs\" %f;\n", vs);
+		writeFloat(mFile,"\tsetAttr \".shk.vs\" ",vs,";\n");
 	}
 	void setStereoHorizontalImageTranslateEnabled(bool hte)
 	{
 		if(hte == false) return;
-		fprintf(mFile,"\tsetAttr \".hte\" %i;\n", hte);
+		writeInt(mFile,"\tsetAttr \".hte\" ",hte,";\n");
 	}
 	void setStereoHorizontalImageTranslate(double hit)
 	{
 		if(hit == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hit\" %f;\n", hit);
+		writeFloat(mFile,"\tsetAttr \".hit\" ",hit,";\n");
 	}
 	void setPostProjection(const PostProjection& ppj)
 	{
-		fprintf(mFile,"\tsetAttr \".ppj\" ");
+		writeString(mFile,"\tsetAttr \".ppj\" ");
 		ppj.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPreScale(double psc)
 	{
 		if(psc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ppj.psc\" %f;\n", psc);
+		writeFloat(mFile,"\tsetAttr \".ppj.psc\" ",psc,";\n");
 	}
 	void setFilmTranslate(const double2& ct)
 	{
 		if(ct == double2(0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ppj.ct\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".ppj.ct\" -type \"double2\" ");
 		ct.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFilmTranslateH(double fth)
 	{
 		if(fth == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ppj.ct.fth\" %f;\n", fth);
+		writeFloat(mFile,"\tsetAttr \".ppj.ct.fth\" ",fth,";\n");
 	}
 	void setFilmTranslateV(double ftv)
 	{
 		if(ftv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ppj.ct.ftv\" %f;\n", ftv);
+		writeFloat(mFile,"\tsetAttr \".ppj.ct.ftv\" ",ftv,";\n");
 	}
 	void setFilmRollControl(const PostProjection::FilmRollControl& frc)
 	{
-		fprintf(mFile,"\tsetAttr \".ppj.frc\" ");
+		writeString(mFile,"\tsetAttr \".ppj.frc\" ");
 		frc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFilmRollPivot(const double2& frp)
 	{
 		if(frp == double2(0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ppj.frc.frp\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".ppj.frc.frp\" -type \"double2\" ");
 		frp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHorizontalRollPivot(double hrp)
 	{
 		if(hrp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ppj.frc.frp.hrp\" %f;\n", hrp);
+		writeFloat(mFile,"\tsetAttr \".ppj.frc.frp.hrp\" ",hrp,";\n");
 	}
 	void setVerticalRollPivot(double vrp)
 	{
 		if(vrp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ppj.frc.frp.vrp\" %f;\n", vrp);
+		writeFloat(mFile,"\tsetAttr \".ppj.frc.frp.vrp\" ",vrp,";\n");
 	}
 	void setFilmRollValue(double frv)
 	{
 		if(frv == 0) return;
-		fprintf(mFile,"\tsetAttr \".ppj.frc.frv\" %f;\n", frv);
+		writeFloat(mFile,"\tsetAttr \".ppj.frc.frv\" ",frv,";\n");
 	}
 	void setFilmRollOrder(unsigned int fro)
 	{
 		if(fro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ppj.frc.fro\" %i;\n", fro);
+		writeInt(mFile,"\tsetAttr \".ppj.frc.fro\" ",fro,";\n");
 	}
 	void setPostScale(double ptsc)
 	{
 		if(ptsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ppj.ptsc\" %f;\n", ptsc);
+		writeFloat(mFile,"\tsetAttr \".ppj.ptsc\" ",ptsc,";\n");
 	}
 	void setFilmFit(unsigned int ff)
 	{
 		if(ff == 1) return;
-		fprintf(mFile,"\tsetAttr \".ff\" %i;\n", ff);
+		writeInt(mFile,"\tsetAttr \".ff\" ",ff,";\n");
 	}
 	void setFilmFitOffset(double ffo)
 	{
 		if(ffo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ffo\" %f;\n", ffo);
+		writeFloat(mFile,"\tsetAttr \".ffo\" ",ffo,";\n");
 	}
 	void setOverscan(double ovr)
 	{
 		if(ovr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ovr\" %f;\n", ovr);
+		writeFloat(mFile,"\tsetAttr \".ovr\" ",ovr,";\n");
 	}
 	void setFocalLength(double fl)
 	{
 		if(fl == 35.0) return;
-		fprintf(mFile,"\tsetAttr \".fl\" %f;\n", fl);
+		writeFloat(mFile,"\tsetAttr \".fl\" ",fl,";\n");
 	}
 	void setLensSqueezeRatio(double lsr)
 	{
 		if(lsr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lsr\" %f;\n", lsr);
+		writeFloat(mFile,"\tsetAttr \".lsr\" ",lsr,";\n");
 	}
 	void setCameraScale(double cs)
 	{
 		if(cs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cs\" %f;\n", cs);
+		writeFloat(mFile,"\tsetAttr \".cs\" ",cs,";\n");
 	}
 	void setTriggerUpdate(double tu)
 	{
 		if(tu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tu\" %f;\n", tu);
+		writeFloat(mFile,"\tsetAttr \".tu\" ",tu,";\n");
 	}
 	void setNearClipPlane(double ncp)
 	{
 		if(ncp == 0) return;
-		fprintf(mFile,"\tsetAttr \".ncp\" %f;\n", ncp);
+		writeFloat(mFile,"\tsetAttr \".ncp\" ",ncp,";\n");
 	}
 	void setFarClipPlane(double fcp)
 	{
 		if(fcp == 1) return;
-		fprintf(mFile,"\tsetAttr \".fcp\" %f;\n", fcp);
+		writeFloat(mFile,"\tsetAttr \".fcp\" ",fcp,";\n");
 	}
 	void setFStop(double fs)
 	{
 		if(fs == 5.6) return;
-		fprintf(mFile,"\tsetAttr \".fs\" %f;\n", fs);
+		writeFloat(mFile,"\tsetAttr \".fs\" ",fs,";\n");
 	}
 	void setFocusDistance(double fd)
 	{
 		if(fd == 5) return;
-		fprintf(mFile,"\tsetAttr \".fd\" %f;\n", fd);
+		writeFloat(mFile,"\tsetAttr \".fd\" ",fd,";\n");
 	}
 	void setShutterAngle(double sa)
 	{
 		if(sa == 1) return;
-		fprintf(mFile,"\tsetAttr \".sa\" %f;\n", sa);
+		writeFloat(mFile,"\tsetAttr \".sa\" ",sa,";\n");
 	}
 	void setCenterOfInterest(double coi)
 	{
 		if(coi == 5) return;
-		fprintf(mFile,"\tsetAttr \".coi\" %f;\n", coi);
+		writeFloat(mFile,"\tsetAttr \".coi\" ",coi,";\n");
 	}
 	void setOrthographicWidth(double ow)
 	{
 		if(ow == 1) return;
-		fprintf(mFile,"\tsetAttr \".ow\" %f;\n", ow);
+		writeFloat(mFile,"\tsetAttr \".ow\" ",ow,";\n");
 	}
 	void setImageName(const string& imn)
 	{
 		if(imn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".imn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".imn\" -type \"string\" ");
 		imn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDepthName(const string& den)
 	{
 		if(den == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".den\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".den\" -type \"string\" ");
 		den.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaskName(const string& man)
 	{
 		if(man == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".man\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".man\" -type \"string\" ");
 		man.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTumblePivot(const double3& tp)
 	{
 		if(tp == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".tp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".tp\" -type \"double3\" ");
 		tp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTumblePivotX(double tpx)
 	{
 		if(tpx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tp.tpx\" %f;\n", tpx);
+		writeFloat(mFile,"\tsetAttr \".tp.tpx\" ",tpx,";\n");
 	}
 	void setTumblePivotY(double tpy)
 	{
 		if(tpy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tp.tpy\" %f;\n", tpy);
+		writeFloat(mFile,"\tsetAttr \".tp.tpy\" ",tpy,";\n");
 	}
 	void setTumblePivotZ(double tpz)
 	{
 		if(tpz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tp.tpz\" %f;\n", tpz);
+		writeFloat(mFile,"\tsetAttr \".tp.tpz\" ",tpz,";\n");
 	}
 	void setUsePivotAsLocalSpace(bool uls)
 	{
 		if(uls == 0) return;
-		fprintf(mFile,"\tsetAttr \".uls\" %i;\n", uls);
+		writeInt(mFile,"\tsetAttr \".uls\" ",uls,";\n");
 	}
 	void setHomeCommand(const string& hc)
 	{
 		if(hc == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".hc\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".hc\" -type \"string\" ");
 		hc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocatorScale(double lls)
 	{
 		if(lls == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lls\" %f;\n", lls);
+		writeFloat(mFile,"\tsetAttr \".lls\" ",lls,";\n");
 	}
 	void setDisplayFilmGate(bool dfg)
 	{
 		if(dfg == false) return;
-		fprintf(mFile,"\tsetAttr \".dfg\" %i;\n", dfg);
+		writeInt(mFile,"\tsetAttr \".dfg\" ",dfg,";\n");
 	}
 	void setDisplayResolution(bool dr)
 	{
 		if(dr == false) return;
-		fprintf(mFile,"\tsetAttr \".dr\" %i;\n", dr);
+		writeInt(mFile,"\tsetAttr \".dr\" ",dr,";\n");
 	}
 	void setDisplaySafeAction(bool dsa)
 	{
 		if(dsa == false) return;
-		fprintf(mFile,"\tsetAttr \".dsa\" %i;\n", dsa);
+		writeInt(mFile,"\tsetAttr \".dsa\" ",dsa,";\n");
 	}
 	void setDisplaySafeTitle(bool dst)
 	{
 		if(dst == false) return;
-		fprintf(mFile,"\tsetAttr \".dst\" %i;\n", dst);
+		writeInt(mFile,"\tsetAttr \".dst\" ",dst,";\n");
 	}
 	void setDisplayFieldChart(bool dfc)
 	{
 		if(dfc == false) return;
-		fprintf(mFile,"\tsetAttr \".dfc\" %i;\n", dfc);
+		writeInt(mFile,"\tsetAttr \".dfc\" ",dfc,";\n");
 	}
 	void setDisplayFilmPivot(bool dfp)
 	{
 		if(dfp == false) return;
-		fprintf(mFile,"\tsetAttr \".dfp\" %i;\n", dfp);
+		writeInt(mFile,"\tsetAttr \".dfp\" ",dfp,";\n");
 	}
 	void setDisplayFilmOrigin(bool dfo)
 	{
 		if(dfo == false) return;
-		fprintf(mFile,"\tsetAttr \".dfo\" %i;\n", dfo);
+		writeInt(mFile,"\tsetAttr \".dfo\" ",dfo,";\n");
 	}
 	void setClippingPlanes(bool cp)
 	{
 		if(cp == true) return;
-		fprintf(mFile,"\tsetAttr \".cp\" %i;\n", cp);
+		writeInt(mFile,"\tsetAttr \".cp\" ",cp,";\n");
 	}
 	void setBestFitClippingPlanes(bool bfc)
 	{
 		if(bfc == true) return;
-		fprintf(mFile,"\tsetAttr \".bfc\" %i;\n", bfc);
+		writeInt(mFile,"\tsetAttr \".bfc\" ",bfc,";\n");
 	}
 	void setDepthOfField(bool dof)
 	{
 		if(dof == false) return;
-		fprintf(mFile,"\tsetAttr \".dof\" %i;\n", dof);
+		writeInt(mFile,"\tsetAttr \".dof\" ",dof,";\n");
 	}
 	void setMotionBlur(bool mb)
 	{
 		if(mb == false) return;
-		fprintf(mFile,"\tsetAttr \".mb\" %i;\n", mb);
+		writeInt(mFile,"\tsetAttr \".mb\" ",mb,";\n");
 	}
 	void setOrthographic(bool o)
 	{
 		if(o == false) return;
-		fprintf(mFile,"\tsetAttr \".o\" %i;\n", o);
+		writeInt(mFile,"\tsetAttr \".o\" ",o,";\n");
 	}
 	void setJournalCommand(bool jc)
 	{
 		if(jc == false) return;
-		fprintf(mFile,"\tsetAttr \".jc\" %i;\n", jc);
+		writeInt(mFile,"\tsetAttr \".jc\" ",jc,";\n");
 	}
 	void setImage(bool img)
 	{
 		if(img == true) return;
-		fprintf(mFile,"\tsetAttr \".img\" %i;\n", img);
+		writeInt(mFile,"\tsetAttr \".img\" ",img,";\n");
 	}
 	void setDepth(bool dep)
 	{
 		if(dep == false) return;
-		fprintf(mFile,"\tsetAttr \".dep\" %i;\n", dep);
+		writeInt(mFile,"\tsetAttr \".dep\" ",dep,";\n");
 	}
 	void setTransparencyBasedDepth(bool tdth)
 	{
 		if(tdth == true) return;
-		fprintf(mFile,"\tsetAttr \".tdth\" %i;\n", tdth);
+		writeInt(mFile,"\tsetAttr \".tdth\" ",tdth,";\n");
 	}
 	void setThreshold(double tthd)
 	{
 		if(tthd == 0.9) return;
-		fprintf(mFile,"\tsetAttr \".tthd\" %f;\n", tthd);
+		writeFloat(mFile,"\tsetAttr \".tthd\" ",tthd,";\n");
 	}
 	void setDepthType(unsigned int dptp)
 	{
 		if(dptp == 1) return;
-		fprintf(mFile,"\tsetAttr \".dptp\" %i;\n", dptp);
+		writeInt(mFile,"\tsetAttr \".dptp\" ",dptp,";\n");
 	}
 	void setUseExploreDepthFormat(bool uexd)
 	{
 		if(uexd == false) return;
-		fprintf(mFile,"\tsetAttr \".uexd\" %i;\n", uexd);
+		writeInt(mFile,"\tsetAttr \".uexd\" ",uexd,";\n");
 	}
 	void setMask(bool ma)
 	{
 		if(ma == true) return;
-		fprintf(mFile,"\tsetAttr \".ma\" %i;\n", ma);
+		writeInt(mFile,"\tsetAttr \".ma\" ",ma,";\n");
 	}
 	void setBackgroundColor(const float3& col)
 	{
-		fprintf(mFile,"\tsetAttr \".col\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".col\" -type \"float3\" ");
 		col.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBackgroundColorR(float colr)
 	{
 		if(colr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".col.colr\" %f;\n", colr);
+		writeFloat(mFile,"\tsetAttr \".col.colr\" ",colr,";\n");
 	}
 	void setBackgroundColorG(float colg)
 	{
 		if(colg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".col.colg\" %f;\n", colg);
+		writeFloat(mFile,"\tsetAttr \".col.colg\" ",colg,";\n");
 	}
 	void setBackgroundColorB(float colb)
 	{
 		if(colb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".col.colb\" %f;\n", colb);
+		writeFloat(mFile,"\tsetAttr \".col.colb\" ",colb,";\n");
 	}
 	void setFocusRegionScale(double frs)
 	{
 		if(frs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".frs\" %f;\n", frs);
+		writeFloat(mFile,"\tsetAttr \".frs\" ",frs,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiFbComputeColor(bool micc)
 	{
 		if(micc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.micc\" %i;\n", micc);
+		writeInt(mFile,"\tsetAttr \".mrc.micc\" ",micc,";\n");
 	}
 	void setMiFbBitsizeColor(short mict)
 	{
 		if(mict == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mict\" %i;\n", mict);
+		writeInt(mFile,"\tsetAttr \".mrc.mict\" ",mict,";\n");
 	}
 	void setMiFbComputeAlpha(bool mica)
 	{
 		if(mica == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mica\" %i;\n", mica);
+		writeInt(mFile,"\tsetAttr \".mrc.mica\" ",mica,";\n");
 	}
 	void setMiFbBitsizeAlpha(short miat)
 	{
 		if(miat == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.miat\" %i;\n", miat);
+		writeInt(mFile,"\tsetAttr \".mrc.miat\" ",miat,";\n");
 	}
 	void setMiFbComputeDepth(bool micd)
 	{
 		if(micd == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.micd\" %i;\n", micd);
+		writeInt(mFile,"\tsetAttr \".mrc.micd\" ",micd,";\n");
 	}
 	void setMiFbComputeNormal(bool micn)
 	{
 		if(micn == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.micn\" %i;\n", micn);
+		writeInt(mFile,"\tsetAttr \".mrc.micn\" ",micn,";\n");
 	}
 	void setMiFbComputeMotion(bool micm)
 	{
 		if(micm == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.micm\" %i;\n", micm);
+		writeInt(mFile,"\tsetAttr \".mrc.micm\" ",micm,";\n");
 	}
 	void setMiFbComputeCoverage(bool micv)
 	{
 		if(micv == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.micv\" %i;\n", micv);
+		writeInt(mFile,"\tsetAttr \".mrc.micv\" ",micv,";\n");
 	}
 	void setMiFbComputeTag(bool mitg)
 	{
 		if(mitg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mitg\" %i;\n", mitg);
+		writeInt(mFile,"\tsetAttr \".mrc.mitg\" ",mitg,";\n");
 	}
 	void setMiFbComputeContour(bool mico)
 	{
 		if(mico == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mico\" %i;\n", mico);
+		writeInt(mFile,"\tsetAttr \".mrc.mico\" ",mico,";\n");
 	}
 	void getRenderable()const
 	{
-		fprintf(mFile,"\"%s.rnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rnd\"");
 	}
 	void getCameraAperture()const
 	{
-		fprintf(mFile,"\"%s.cap\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cap\"");
 	}
 	void getHorizontalFilmAperture()const
 	{
-		fprintf(mFile,"\"%s.cap.hfa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cap.hfa\"");
 	}
 	void getVerticalFilmAperture()const
 	{
-		fprintf(mFile,"\"%s.cap.vfa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cap.vfa\"");
 	}
 	void getShakeOverscan()const
 	{
-		fprintf(mFile,"\"%s.sos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sos\"");
 	}
 	void getShakeOverscanEnabled()const
 	{
-		fprintf(mFile,"\"%s.soe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".soe\"");
 	}
 	void getFilmOffset()const
 	{
-		fprintf(mFile,"\"%s.fio\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fio\"");
 	}
 	void getHorizontalFilmOffset()const
 	{
-		fprintf(mFile,"\"%s.fio.hfo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fio.hfo\"");
 	}
 	void getVerticalFilmOffset()const
 	{
-		fprintf(mFile,"\"%s.fio.vfo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fio.vfo\"");
 	}
 	void getShakeEnabled()const
 	{
-		fprintf(mFile,"\"%s.se\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".se\"");
 	}
 	void getShake()const
 	{
-		fprintf(mFile,"\"%s.shk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shk\"");
 	}
 	void getHorizontalShake()const
 	{
-		fprintf(mFile,"\"%s.shk.hs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shk.hs\"");
 	}
 	void getVerticalShake()const
 	{
-		fprintf(mFile,"\"%s.shk.vs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shk.vs\"");
 	}
 	void getStereoHorizontalImageTranslateEnabled()const
 	{
-		fprintf(mFile,"\"%s.hte\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hte\"");
 	}
 	void getStereoHorizontalImageTranslate()const
 	{
-		fprintf(mFile,"\"%s.hit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hit\"");
 	}
 	void getPostProjection()const
 	{
-		fprintf(mFile,"\"%s.ppj\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj\"");
 	}
 	void getPreScale()const
 	{
-		fprintf(mFile,"\"%s.ppj.psc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.psc\"");
 	}
 	void getFilmTranslate()const
 	{
-		fprintf(mFile,"\"%s.ppj.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.ct\"");
 	}
 	void getFilmTranslateH()const
 	{
-		fprintf(mFile,"\"%s.ppj.ct.fth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.ct.fth\"");
 	}
 	void getFilmTranslateV()const
 	{
-		fprintf(mFile,"\"%s.ppj.ct.ftv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.ct.ftv\"");
 	}
 	void getFilmRollControl()const
 	{
-		fprintf(mFile,"\"%s.ppj.frc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.frc\"");
 	}
 	void getFilmRollPivot()const
 	{
-		fprintf(mFile,"\"%s.ppj.frc.frp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.frc.frp\"");
 	}
 	void getHorizontalRollPivot()const
 	{
-		fprintf(mFile,"\"%s.ppj.frc.frp.hrp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.frc.frp.hrp\"");
 	}
 	void getVerticalRollPivot()const
 	{
-		fprintf(mFile,"\"%s.ppj.frc.frp.vrp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.frc.frp.vrp\"");
 	}
 	void getFilmRollValue()const
 	{
-		fprintf(mFile,"\"%s.ppj.frc.frv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.frc.frv\"");
 	}
 	void getFilmRollOrder()const
 	{
-		fprintf(mFile,"\"%s.ppj.frc.fro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.frc.fro\"");
 	}
 	void getPostScale()const
 	{
-		fprintf(mFile,"\"%s.ppj.ptsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppj.ptsc\"");
 	}
 	void getFilmFit()const
 	{
-		fprintf(mFile,"\"%s.ff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ff\"");
 	}
 	void getFilmFitOffset()const
 	{
-		fprintf(mFile,"\"%s.ffo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ffo\"");
 	}
 	void getOverscan()const
 	{
-		fprintf(mFile,"\"%s.ovr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ovr\"");
 	}
 	void getFocalLength()const
 	{
-		fprintf(mFile,"\"%s.fl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fl\"");
 	}
 	void getLensSqueezeRatio()const
 	{
-		fprintf(mFile,"\"%s.lsr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsr\"");
 	}
 	void getCameraScale()const
 	{
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getTriggerUpdate()const
 	{
-		fprintf(mFile,"\"%s.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu\"");
 	}
 	void getNearClipPlane()const
 	{
-		fprintf(mFile,"\"%s.ncp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ncp\"");
 	}
 	void getFarClipPlane()const
 	{
-		fprintf(mFile,"\"%s.fcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcp\"");
 	}
 	void getFStop()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getFocusDistance()const
 	{
-		fprintf(mFile,"\"%s.fd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd\"");
 	}
 	void getShutterAngle()const
 	{
-		fprintf(mFile,"\"%s.sa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sa\"");
 	}
 	void getCenterOfInterest()const
 	{
-		fprintf(mFile,"\"%s.coi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".coi\"");
 	}
 	void getOrthographicWidth()const
 	{
-		fprintf(mFile,"\"%s.ow\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ow\"");
 	}
 	void getImageName()const
 	{
-		fprintf(mFile,"\"%s.imn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imn\"");
 	}
 	void getDepthName()const
 	{
-		fprintf(mFile,"\"%s.den\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".den\"");
 	}
 	void getMaskName()const
 	{
-		fprintf(mFile,"\"%s.man\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".man\"");
 	}
 	void getTumblePivot()const
 	{
-		fprintf(mFile,"\"%s.tp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp\"");
 	}
 	void getTumblePivotX()const
 	{
-		fprintf(mFile,"\"%s.tp.tpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpx\"");
 	}
 	void getTumblePivotY()const
 	{
-		fprintf(mFile,"\"%s.tp.tpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpy\"");
 	}
 	void getTumblePivotZ()const
 	{
-		fprintf(mFile,"\"%s.tp.tpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpz\"");
 	}
 	void getUsePivotAsLocalSpace()const
 	{
-		fprintf(mFile,"\"%s.uls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uls\"");
 	}
 	void getImagePlane(size_t ip_i)const
 	{
-		fprintf(mFile,"\"%s.ip[%i]\"",mName.c_str(),ip_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ip[",ip_i,"]\"");
 	}
 	void getImagePlane()const
 	{
 
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getHomeCommand()const
 	{
-		fprintf(mFile,"\"%s.hc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc\"");
 	}
 	void getBookmarks(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i]\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"]\"");
 	}
 	void getBookmarks()const
 	{
 
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getLocatorScale()const
 	{
-		fprintf(mFile,"\"%s.lls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lls\"");
 	}
 	void getDisplayFilmGate()const
 	{
-		fprintf(mFile,"\"%s.dfg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfg\"");
 	}
 	void getDisplayResolution()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getDisplaySafeAction()const
 	{
-		fprintf(mFile,"\"%s.dsa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsa\"");
 	}
 	void getDisplaySafeTitle()const
 	{
-		fprintf(mFile,"\"%s.dst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dst\"");
 	}
 	void getDisplayFieldChart()const
 	{
-		fprintf(mFile,"\"%s.dfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfc\"");
 	}
 	void getDisplayFilmPivot()const
 	{
-		fprintf(mFile,"\"%s.dfp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfp\"");
 	}
 	void getDisplayFilmOrigin()const
 	{
-		fprintf(mFile,"\"%s.dfo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfo\"");
 	}
 	void getClippingPlanes()const
 	{
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getBestFitClippingPlanes()const
 	{
-		fprintf(mFile,"\"%s.bfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bfc\"");
 	}
 	void getDepthOfField()const
 	{
-		fprintf(mFile,"\"%s.dof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dof\"");
 	}
 	void getMotionBlur()const
 	{
-		fprintf(mFile,"\"%s.mb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mb\"");
 	}
 	void getOrthographic()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getJournalCommand()const
 	{
-		fprintf(mFile,"\"%s.jc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jc\"");
 	}
 	void getImage()const
 	{
-		fprintf(mFile,"\"%s.img\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".img\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.dep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dep\"");
 	}
 	void getTransparencyBasedDepth()const
 	{
-		fprintf(mFile,"\"%s.tdth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tdth\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.tthd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tthd\"");
 	}
 	void getDepthType()const
 	{
-		fprintf(mFile,"\"%s.dptp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dptp\"");
 	}
 	void getUseExploreDepthFormat()const
 	{
-		fprintf(mFile,"\"%s.uexd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uexd\"");
 	}
 	void getMask()const
 	{
-		fprintf(mFile,"\"%s.ma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ma\"");
 	}
 	void getBackgroundColor()const
 	{
-		fprintf(mFile,"\"%s.col\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col\"");
 	}
 	void getBackgroundColorR()const
 	{
-		fprintf(mFile,"\"%s.col.colr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.colr\"");
 	}
 	void getBackgroundColorG()const
 	{
-		fprintf(mFile,"\"%s.col.colg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.colg\"");
 	}
 	void getBackgroundColorB()const
 	{
-		fprintf(mFile,"\"%s.col.colb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.colb\"");
 	}
 	void getFocusRegionScale()const
 	{
-		fprintf(mFile,"\"%s.frs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frs\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiOutputShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.mios\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mios\"");
 	}
 	void getMiFbComputeColor()const
 	{
-		fprintf(mFile,"\"%s.mrc.micc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.micc\"");
 	}
 	void getMiFbBitsizeColor()const
 	{
-		fprintf(mFile,"\"%s.mrc.mict\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mict\"");
 	}
 	void getMiFbComputeAlpha()const
 	{
-		fprintf(mFile,"\"%s.mrc.mica\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mica\"");
 	}
 	void getMiFbBitsizeAlpha()const
 	{
-		fprintf(mFile,"\"%s.mrc.miat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.miat\"");
 	}
 	void getMiFbComputeDepth()const
 	{
-		fprintf(mFile,"\"%s.mrc.micd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.micd\"");
 	}
 	void getMiFbComputeNormal()const
 	{
-		fprintf(mFile,"\"%s.mrc.micn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.micn\"");
 	}
 	void getMiFbComputeMotion()const
 	{
-		fprintf(mFile,"\"%s.mrc.micm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.micm\"");
 	}
 	void getMiFbComputeCoverage()const
 	{
-		fprintf(mFile,"\"%s.mrc.micv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.micv\"");
 	}
 	void getMiFbComputeTag()const
 	{
-		fprintf(mFile,"\"%s.mrc.mitg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mitg\"");
 	}
 	void getMiFbComputeContour()const
 	{
-		fprintf(mFile,"\"%s.mrc.mico\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mico\"");
 	}
 	void getMiVolumeShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.mivs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mivs\"");
 	}
 	void getMiLensShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.mils\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mils\"");
 	}
 	void getMiEnvironmentShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.mies\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mies\"");
 	}
 	void getMiOutputShaderList(size_t miol_i)const
 	{
-		fprintf(mFile,"\"%s.mrc.miol[%i]\"",mName.c_str(),miol_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".mrc.miol[",miol_i,"]\"");
 	}
 	void getMiLensShaderList(size_t mill_i)const
 	{
-		fprintf(mFile,"\"%s.mrc.mill[%i]\"",mName.c_str(),mill_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".mrc.mill[",mill_i,"]\"");
 	}
 	void getMiRenderPassList(size_t mirp_i)const
 	{
-		fprintf(mFile,"\"%s.mrc.mirp[%i]\"",mName.c_str(),mirp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".mrc.mirp[",mirp_i,"]\"");
 	}
 protected:
 	Camera(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
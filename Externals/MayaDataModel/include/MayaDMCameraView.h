@@ -27,210 +27,210 @@ public:
 	void setEye(const double3& e)
 	{
 		if(e == double3(60.0, 45.0, 60.0)) return;
-		fprintf(mFile,"\tsetAttr \".e\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".e\" -type \"double3\" ");
 		e.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEyeX(double ex)
 	{
 		if(ex == 0) return;
-		fprintf(mFile,"\tsetAttr \".e.ex\" %f;\n", ex);
+		writeFloat(mFile,"\tsetAttr \".e.ex\" ",ex,";\n");
 	}
 	void setEyeY(double ey)
 	{
 		if(ey == 0) return;
-		fprintf(mFile,"\tsetAttr \".e.ey\" %f;\n", ey);
+		writeFloat(mFile,"\tsetAttr \".e.ey\" ",ey,";\n");
 	}
 	void setEyeZ(double ez)
 	{
 		if(ez == 0) return;
-		fprintf(mFile,"\tsetAttr \".e.ez\" %f;\n", ez);
+		writeFloat(mFile,"\tsetAttr \".e.ez\" ",ez,";\n");
 	}
 	void setCenterOfInterest(const double3& coi)
 	{
 		if(coi == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".coi\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".coi\" -type \"double3\" ");
 		coi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCenterOfInterestX(double cx)
 	{
 		if(cx == 0) return;
-		fprintf(mFile,"\tsetAttr \".coi.cx\" %f;\n", cx);
+		writeFloat(mFile,"\tsetAttr \".coi.cx\" ",cx,";\n");
 	}
 	void setCenterOfInterestY(double cy)
 	{
 		if(cy == 0) return;
-		fprintf(mFile,"\tsetAttr \".coi.cy\" %f;\n", cy);
+		writeFloat(mFile,"\tsetAttr \".coi.cy\" ",cy,";\n");
 	}
 	void setCenterOfInterestZ(double cz)
 	{
 		if(cz == 0) return;
-		fprintf(mFile,"\tsetAttr \".coi.cz\" %f;\n", cz);
+		writeFloat(mFile,"\tsetAttr \".coi.cz\" ",cz,";\n");
 	}
 	void setUp(const double3& u)
 	{
 		if(u == double3(0.0, 1.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".u\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".u\" -type \"double3\" ");
 		u.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUpX(double ux)
 	{
 		if(ux == 0) return;
-		fprintf(mFile,"\tsetAttr \".u.ux\" %f;\n", ux);
+		writeFloat(mFile,"\tsetAttr \".u.ux\" ",ux,";\n");
 	}
 	void setUpY(double uy)
 	{
 		if(uy == 0) return;
-		fprintf(mFile,"\tsetAttr \".u.uy\" %f;\n", uy);
+		writeFloat(mFile,"\tsetAttr \".u.uy\" ",uy,";\n");
 	}
 	void setUpZ(double uz)
 	{
 		if(uz == 0) return;
-		fprintf(mFile,"\tsetAttr \".u.uz\" %f;\n", uz);
+		writeFloat(mFile,"\tsetAttr \".u.uz\" ",uz,";\n");
 	}
 	void setTumblePivot(const double3& tp)
 	{
 		if(tp == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".tp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".tp\" -type \"double3\" ");
 		tp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTumblePivotX(double tpx)
 	{
 		if(tpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tp.tpx\" %f;\n", tpx);
+		writeFloat(mFile,"\tsetAttr \".tp.tpx\" ",tpx,";\n");
 	}
 	void setTumblePivotY(double tpy)
 	{
 		if(tpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".tp.tpy\" %f;\n", tpy);
+		writeFloat(mFile,"\tsetAttr \".tp.tpy\" ",tpy,";\n");
 	}
 	void setTumblePivotZ(double tpz)
 	{
 		if(tpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tp.tpz\" %f;\n", tpz);
+		writeFloat(mFile,"\tsetAttr \".tp.tpz\" ",tpz,";\n");
 	}
 	void setHorizontalAperture(double ha)
 	{
 		if(ha == 3) return;
-		fprintf(mFile,"\tsetAttr \".ha\" %f;\n", ha);
+		writeFloat(mFile,"\tsetAttr \".ha\" ",ha,";\n");
 	}
 	void setVerticalAperture(double va)
 	{
 		if(va == 2) return;
-		fprintf(mFile,"\tsetAttr \".va\" %f;\n", va);
+		writeFloat(mFile,"\tsetAttr \".va\" ",va,";\n");
 	}
 	void setFocalLength(double fl)
 	{
 		if(fl == 35.0) return;
-		fprintf(mFile,"\tsetAttr \".fl\" %f;\n", fl);
+		writeFloat(mFile,"\tsetAttr \".fl\" ",fl,";\n");
 	}
 	void setOrthographicWidth(double ow)
 	{
 		if(ow == 1) return;
-		fprintf(mFile,"\tsetAttr \".ow\" %f;\n", ow);
+		writeFloat(mFile,"\tsetAttr \".ow\" ",ow,";\n");
 	}
 	void setOrthographic(bool o)
 	{
 		if(o == false) return;
-		fprintf(mFile,"\tsetAttr \".o\" %i;\n", o);
+		writeInt(mFile,"\tsetAttr \".o\" ",o,";\n");
 	}
 	void setDescription(const string& d)
 	{
 		if(d == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".d\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"string\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getEye()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 	void getEyeX()const
 	{
-		fprintf(mFile,"\"%s.e.ex\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e.ex\"");
 	}
 	void getEyeY()const
 	{
-		fprintf(mFile,"\"%s.e.ey\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e.ey\"");
 	}
 	void getEyeZ()const
 	{
-		fprintf(mFile,"\"%s.e.ez\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e.ez\"");
 	}
 	void getCenterOfInterest()const
 	{
-		fprintf(mFile,"\"%s.coi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".coi\"");
 	}
 	void getCenterOfInterestX()const
 	{
-		fprintf(mFile,"\"%s.coi.cx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".coi.cx\"");
 	}
 	void getCenterOfInterestY()const
 	{
-		fprintf(mFile,"\"%s.coi.cy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".coi.cy\"");
 	}
 	void getCenterOfInterestZ()const
 	{
-		fprintf(mFile,"\"%s.coi.cz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".coi.cz\"");
 	}
 	void getUp()const
 	{
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getUpX()const
 	{
-		fprintf(mFile,"\"%s.u.ux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u.ux\"");
 	}
 	void getUpY()const
 	{
-		fprintf(mFile,"\"%s.u.uy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u.uy\"");
 	}
 	void getUpZ()const
 	{
-		fprintf(mFile,"\"%s.u.uz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u.uz\"");
 	}
 	void getTumblePivot()const
 	{
-		fprintf(mFile,"\"%s.tp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp\"");
 	}
 	void getTumblePivotX()const
 	{
-		fprintf(mFile,"\"%s.tp.tpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpx\"");
 	}
 	void getTumblePivotY()const
 	{
-		fprintf(mFile,"\"%s.tp.tpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpy\"");
 	}
 	void getTumblePivotZ()const
 	{
-		fprintf(mFile,"\"%s.tp.tpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp.tpz\"");
 	}
 	void getHorizontalAperture()const
 	{
-		fprintf(mFile,"\"%s.ha\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ha\"");
 	}
 	void getVerticalAperture()const
 	{
-		fprintf(mFile,"\"%s.va\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".va\"");
 	}
 	void getFocalLength()const
 	{
-		fprintf(mFile,"\"%s.fl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fl\"");
 	}
 	void getOrthographicWidth()const
 	{
-		fprintf(mFile,"\"%s.ow\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ow\"");
 	}
 	void getOrthographic()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getDescription()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 protected:
 	CameraView(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,43 +27,43 @@ public:
 	void setMemberIndex(size_t mi_i,const intArray& mi)
 	{
 		if(mi.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".mi[%i]\" -type \"intArray\" ",mi_i);
+		writeInt(mFile,"\tsetAttr \".mi[",mi_i,"]\" -type \"intArray\" ");
 		mi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMemberIndex(size_t mi_start,size_t mi_end,intArray* mi)
 	{
-		fprintf(mFile,"\tsetAttr \".mi[%i:%i]\" ", mi_start,mi_end);
+		writeInt(mFile,"\tsetAttr \".mi[",mi_start); writeInt(mFile,":",mi_end,"]\" ");
 		size_t size = (mi_end-mi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			mi[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startMemberIndex(size_t mi_start,size_t mi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".mi[%i:%i]\"",mi_start,mi_end);
-		fprintf(mFile," -type \"intArray\" ");
+		writeInt(mFile,"\tsetAttr \".mi[",mi_start); writeInt(mFile,":",mi_end,"]\"");
+		writeString(mFile," -type \"intArray\" ");
 	}
 	void appendMemberIndex(const intArray& mi)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		mi.write(mFile);
 	}
 	void endMemberIndex()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getMember(size_t m_i)const
 	{
-		fprintf(mFile,"\"%s.m[%i]\"",mName.c_str(),m_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".m[",m_i,"]\"");
 	}
 	void getMember()const
 	{
 
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 protected:
 	CharacterMap(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
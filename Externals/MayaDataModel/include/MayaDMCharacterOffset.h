@@ -26,400 +26,400 @@ public:
 
 	void setInRootTranslate(const double3& rti)
 	{
-		fprintf(mFile,"\tsetAttr \".rti\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rti\" -type \"double3\" ");
 		rti.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInRootTranslateX(double rtix)
 	{
 		if(rtix == 0) return;
-		fprintf(mFile,"\tsetAttr \".rti.rtix\" %f;\n", rtix);
+		writeFloat(mFile,"\tsetAttr \".rti.rtix\" ",rtix,";\n");
 	}
 	void setInRootTranslateY(double rtiy)
 	{
 		if(rtiy == 0) return;
-		fprintf(mFile,"\tsetAttr \".rti.rtiy\" %f;\n", rtiy);
+		writeFloat(mFile,"\tsetAttr \".rti.rtiy\" ",rtiy,";\n");
 	}
 	void setInRootTranslateZ(double rtiz)
 	{
 		if(rtiz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rti.rtiz\" %f;\n", rtiz);
+		writeFloat(mFile,"\tsetAttr \".rti.rtiz\" ",rtiz,";\n");
 	}
 	void setInRootRotate(const double3& rri)
 	{
-		fprintf(mFile,"\tsetAttr \".rri\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rri\" -type \"double3\" ");
 		rri.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInRootRotateX(double rrix)
 	{
 		if(rrix == 0) return;
-		fprintf(mFile,"\tsetAttr \".rri.rrix\" %f;\n", rrix);
+		writeFloat(mFile,"\tsetAttr \".rri.rrix\" ",rrix,";\n");
 	}
 	void setInRootRotateY(double rriy)
 	{
 		if(rriy == 0) return;
-		fprintf(mFile,"\tsetAttr \".rri.rriy\" %f;\n", rriy);
+		writeFloat(mFile,"\tsetAttr \".rri.rriy\" ",rriy,";\n");
 	}
 	void setInRootRotateZ(double rriz)
 	{
 		if(rriz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rri.rriz\" %f;\n", rriz);
+		writeFloat(mFile,"\tsetAttr \".rri.rriz\" ",rriz,";\n");
 	}
 	void setRootRotateOrder(unsigned int rror)
 	{
 		if(rror == 0) return;
-		fprintf(mFile,"\tsetAttr \".rror\" %i;\n", rror);
+		writeInt(mFile,"\tsetAttr \".rror\" ",rror,";\n");
 	}
 	void setRootJointOrient(const double3& rjo)
 	{
-		fprintf(mFile,"\tsetAttr \".rjo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rjo\" -type \"double3\" ");
 		rjo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRootJointOrientX(double rjox)
 	{
 		if(rjox == 0) return;
-		fprintf(mFile,"\tsetAttr \".rjo.rjox\" %f;\n", rjox);
+		writeFloat(mFile,"\tsetAttr \".rjo.rjox\" ",rjox,";\n");
 	}
 	void setRootJointOrientY(double rjoy)
 	{
 		if(rjoy == 0) return;
-		fprintf(mFile,"\tsetAttr \".rjo.rjoy\" %f;\n", rjoy);
+		writeFloat(mFile,"\tsetAttr \".rjo.rjoy\" ",rjoy,";\n");
 	}
 	void setRootJointOrientZ(double rjoz)
 	{
 		if(rjoz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rjo.rjoz\" %f;\n", rjoz);
+		writeFloat(mFile,"\tsetAttr \".rjo.rjoz\" ",rjoz,";\n");
 	}
 	void setRootParentMatrix(const matrix& rpm)
 	{
 		if(rpm == identity) return;
-		fprintf(mFile,"\tsetAttr \".rpm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".rpm\" -type \"matrix\" ");
 		rpm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRootParentInverseMatrix(const matrix& rpim)
 	{
 		if(rpim == identity) return;
-		fprintf(mFile,"\tsetAttr \".rpim\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".rpim\" -type \"matrix\" ");
 		rpim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setApplyControlParentTransform(bool acpx)
 	{
 		if(acpx == false) return;
-		fprintf(mFile,"\tsetAttr \".acpx\" %i;\n", acpx);
+		writeInt(mFile,"\tsetAttr \".acpx\" ",acpx,";\n");
 	}
 	void setEnable(bool nabl)
 	{
 		if(nabl == true) return;
-		fprintf(mFile,"\tsetAttr \".nabl\" %i;\n", nabl);
+		writeInt(mFile,"\tsetAttr \".nabl\" ",nabl,";\n");
 	}
 	void setOffsetRootTranslate(const double3& rtf)
 	{
-		fprintf(mFile,"\tsetAttr \".rtf\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rtf\" -type \"double3\" ");
 		rtf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetRootTranslateX(double rtfx)
 	{
 		if(rtfx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rtf.rtfx\" %f;\n", rtfx);
+		writeFloat(mFile,"\tsetAttr \".rtf.rtfx\" ",rtfx,";\n");
 	}
 	void setOffsetRootTranslateY(double rtfy)
 	{
 		if(rtfy == 0) return;
-		fprintf(mFile,"\tsetAttr \".rtf.rtfy\" %f;\n", rtfy);
+		writeFloat(mFile,"\tsetAttr \".rtf.rtfy\" ",rtfy,";\n");
 	}
 	void setOffsetRootTranslateZ(double rtfz)
 	{
 		if(rtfz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rtf.rtfz\" %f;\n", rtfz);
+		writeFloat(mFile,"\tsetAttr \".rtf.rtfz\" ",rtfz,";\n");
 	}
 	void setInitialOffsetRootTranslate(const double3& itf)
 	{
-		fprintf(mFile,"\tsetAttr \".itf\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".itf\" -type \"double3\" ");
 		itf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialOffsetRootTranslateX(double itfx)
 	{
 		if(itfx == 0) return;
-		fprintf(mFile,"\tsetAttr \".itf.itfx\" %f;\n", itfx);
+		writeFloat(mFile,"\tsetAttr \".itf.itfx\" ",itfx,";\n");
 	}
 	void setInitialOffsetRootTranslateY(double itfy)
 	{
 		if(itfy == 0) return;
-		fprintf(mFile,"\tsetAttr \".itf.itfy\" %f;\n", itfy);
+		writeFloat(mFile,"\tsetAttr \".itf.itfy\" ",itfy,";\n");
 	}
 	void setInitialOffsetRootTranslateZ(double itfz)
 	{
 		if(itfz == 0) return;
-		fprintf(mFile,"\tsetAttr \".itf.itfz\" %f;\n", itfz);
+		writeFloat(mFile,"\tsetAttr \".itf.itfz\" ",itfz,";\n");
 	}
 	void setRotateControlScale(const double3& rcs)
 	{
-		fprintf(mFile,"\tsetAttr \".rcs\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rcs\" -type \"double3\" ");
 		rcs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateControlScaleX(double rcsx)
 	{
 		if(rcsx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rcs.rcsx\" %f;\n", rcsx);
+		writeFloat(mFile,"\tsetAttr \".rcs.rcsx\" ",rcsx,";\n");
 	}
 	void setRotateControlScaleY(double rcsy)
 	{
 		if(rcsy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rcs.rcsy\" %f;\n", rcsy);
+		writeFloat(mFile,"\tsetAttr \".rcs.rcsy\" ",rcsy,";\n");
 	}
 	void setRotateControlScaleZ(double rcsz)
 	{
 		if(rcsz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rcs.rcsz\" %f;\n", rcsz);
+		writeFloat(mFile,"\tsetAttr \".rcs.rcsz\" ",rcsz,";\n");
 	}
 	void setRotateControlParentMatrix(const matrix& rcpm)
 	{
 		if(rcpm == identity) return;
-		fprintf(mFile,"\tsetAttr \".rcpm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".rcpm\" -type \"matrix\" ");
 		rcpm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetRootRotate(const double3& rrf)
 	{
-		fprintf(mFile,"\tsetAttr \".rrf\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rrf\" -type \"double3\" ");
 		rrf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetRootRotateX(double rrfx)
 	{
 		if(rrfx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rrf.rrfx\" %f;\n", rrfx);
+		writeFloat(mFile,"\tsetAttr \".rrf.rrfx\" ",rrfx,";\n");
 	}
 	void setOffsetRootRotateY(double rrfy)
 	{
 		if(rrfy == 0) return;
-		fprintf(mFile,"\tsetAttr \".rrf.rrfy\" %f;\n", rrfy);
+		writeFloat(mFile,"\tsetAttr \".rrf.rrfy\" ",rrfy,";\n");
 	}
 	void setOffsetRootRotateZ(double rrfz)
 	{
 		if(rrfz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rrf.rrfz\" %f;\n", rrfz);
+		writeFloat(mFile,"\tsetAttr \".rrf.rrfz\" ",rrfz,";\n");
 	}
 	void setOffsetRootRotateOrder(unsigned int rfor)
 	{
 		if(rfor == 0) return;
-		fprintf(mFile,"\tsetAttr \".rfor\" %i;\n", rfor);
+		writeInt(mFile,"\tsetAttr \".rfor\" ",rfor,";\n");
 	}
 	void setOffsetRootRotatePivot(const double3& rpf)
 	{
-		fprintf(mFile,"\tsetAttr \".rpf\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rpf\" -type \"double3\" ");
 		rpf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetRootRotatePivotX(double rppfx)
 	{
 		if(rppfx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rpf.rppfx\" %f;\n", rppfx);
+		writeFloat(mFile,"\tsetAttr \".rpf.rppfx\" ",rppfx,";\n");
 	}
 	void setOffsetRootRotatePivotY(double rppfy)
 	{
 		if(rppfy == 0) return;
-		fprintf(mFile,"\tsetAttr \".rpf.rppfy\" %f;\n", rppfy);
+		writeFloat(mFile,"\tsetAttr \".rpf.rppfy\" ",rppfy,";\n");
 	}
 	void setOffsetRootRotatePivotZ(double rppfz)
 	{
 		if(rppfz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rpf.rppfz\" %f;\n", rppfz);
+		writeFloat(mFile,"\tsetAttr \".rpf.rppfz\" ",rppfz,";\n");
 	}
 	void getInRootTranslate()const
 	{
-		fprintf(mFile,"\"%s.rti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rti\"");
 	}
 	void getInRootTranslateX()const
 	{
-		fprintf(mFile,"\"%s.rti.rtix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rti.rtix\"");
 	}
 	void getInRootTranslateY()const
 	{
-		fprintf(mFile,"\"%s.rti.rtiy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rti.rtiy\"");
 	}
 	void getInRootTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.rti.rtiz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rti.rtiz\"");
 	}
 	void getInRootRotate()const
 	{
-		fprintf(mFile,"\"%s.rri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rri\"");
 	}
 	void getInRootRotateX()const
 	{
-		fprintf(mFile,"\"%s.rri.rrix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rri.rrix\"");
 	}
 	void getInRootRotateY()const
 	{
-		fprintf(mFile,"\"%s.rri.rriy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rri.rriy\"");
 	}
 	void getInRootRotateZ()const
 	{
-		fprintf(mFile,"\"%s.rri.rriz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rri.rriz\"");
 	}
 	void getRootRotateOrder()const
 	{
-		fprintf(mFile,"\"%s.rror\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rror\"");
 	}
 	void getRootJointOrient()const
 	{
-		fprintf(mFile,"\"%s.rjo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rjo\"");
 	}
 	void getRootJointOrientX()const
 	{
-		fprintf(mFile,"\"%s.rjo.rjox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rjo.rjox\"");
 	}
 	void getRootJointOrientY()const
 	{
-		fprintf(mFile,"\"%s.rjo.rjoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rjo.rjoy\"");
 	}
 	void getRootJointOrientZ()const
 	{
-		fprintf(mFile,"\"%s.rjo.rjoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rjo.rjoz\"");
 	}
 	void getRootParentMatrix()const
 	{
-		fprintf(mFile,"\"%s.rpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpm\"");
 	}
 	void getRootParentInverseMatrix()const
 	{
-		fprintf(mFile,"\"%s.rpim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpim\"");
 	}
 	void getApplyControlParentTransform()const
 	{
-		fprintf(mFile,"\"%s.acpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acpx\"");
 	}
 	void getEnable()const
 	{
-		fprintf(mFile,"\"%s.nabl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nabl\"");
 	}
 	void getOffsetRootTranslate()const
 	{
-		fprintf(mFile,"\"%s.rtf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtf\"");
 	}
 	void getOffsetRootTranslateX()const
 	{
-		fprintf(mFile,"\"%s.rtf.rtfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtf.rtfx\"");
 	}
 	void getOffsetRootTranslateY()const
 	{
-		fprintf(mFile,"\"%s.rtf.rtfy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtf.rtfy\"");
 	}
 	void getOffsetRootTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.rtf.rtfz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtf.rtfz\"");
 	}
 	void getInitialOffsetRootTranslate()const
 	{
-		fprintf(mFile,"\"%s.itf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itf\"");
 	}
 	void getInitialOffsetRootTranslateX()const
 	{
-		fprintf(mFile,"\"%s.itf.itfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itf.itfx\"");
 	}
 	void getInitialOffsetRootTranslateY()const
 	{
-		fprintf(mFile,"\"%s.itf.itfy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itf.itfy\"");
 	}
 	void getInitialOffsetRootTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.itf.itfz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itf.itfz\"");
 	}
 	void getRotateControlScale()const
 	{
-		fprintf(mFile,"\"%s.rcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcs\"");
 	}
 	void getRotateControlScaleX()const
 	{
-		fprintf(mFile,"\"%s.rcs.rcsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcs.rcsx\"");
 	}
 	void getRotateControlScaleY()const
 	{
-		fprintf(mFile,"\"%s.rcs.rcsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcs.rcsy\"");
 	}
 	void getRotateControlScaleZ()const
 	{
-		fprintf(mFile,"\"%s.rcs.rcsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcs.rcsz\"");
 	}
 	void getRotateControlParentMatrix()const
 	{
-		fprintf(mFile,"\"%s.rcpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcpm\"");
 	}
 	void getOffsetRootRotate()const
 	{
-		fprintf(mFile,"\"%s.rrf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rrf\"");
 	}
 	void getOffsetRootRotateX()const
 	{
-		fprintf(mFile,"\"%s.rrf.rrfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rrf.rrfx\"");
 	}
 	void getOffsetRootRotateY()const
 	{
-		fprintf(mFile,"\"%s.rrf.rrfy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rrf.rrfy\"");
 	}
 	void getOffsetRootRotateZ()const
 	{
-		fprintf(mFile,"\"%s.rrf.rrfz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rrf.rrfz\"");
 	}
 	void getOffsetRootRotateOrder()const
 	{
-		fprintf(mFile,"\"%s.rfor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfor\"");
 	}
 	void getOffsetRootRotatePivot()const
 	{
-		fprintf(mFile,"\"%s.rpf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpf\"");
 	}
 	void getOffsetRootRotatePivotX()const
 	{
-		fprintf(mFile,"\"%s.rpf.rppfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpf.rppfx\"");
 	}
 	void getOffsetRootRotatePivotY()const
 	{
-		fprintf(mFile,"\"%s.rpf.rppfy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpf.rppfy\"");
 	}
 	void getOffsetRootRotatePivotZ()const
 	{
-		fprintf(mFile,"\"%s.rpf.rppfz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpf.rppfz\"");
 	}
 	void getOutRootTranslate()const
 	{
-		fprintf(mFile,"\"%s.rto\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rto\"");
 	}
 	void getOutRootTranslateX()const
 	{
-		fprintf(mFile,"\"%s.rto.rtox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rto.rtox\"");
 	}
 	void getOutRootTranslateY()const
 	{
-		fprintf(mFile,"\"%s.rto.rtoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rto.rtoy\"");
 	}
 	void getOutRootTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.rto.rtoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rto.rtoz\"");
 	}
 	void getOutRootRotate()const
 	{
-		fprintf(mFile,"\"%s.rro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro\"");
 	}
 	void getOutRootRotateX()const
 	{
-		fprintf(mFile,"\"%s.rro.rrox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro.rrox\"");
 	}
 	void getOutRootRotateY()const
 	{
-		fprintf(mFile,"\"%s.rro.rroy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro.rroy\"");
 	}
 	void getOutRootRotateZ()const
 	{
-		fprintf(mFile,"\"%s.rro.rroz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rro.rroz\"");
 	}
 protected:
 	CharacterOffset(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,87 +27,87 @@ public:
 	void setColor1(const float3& c1)
 	{
 		if(c1 == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c1\" -type \"float3\" ");
 		c1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor1R(float c1r)
 	{
 		if(c1r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1r\" %f;\n", c1r);
+		writeFloat(mFile,"\tsetAttr \".c1.c1r\" ",c1r,";\n");
 	}
 	void setColor1G(float c1g)
 	{
 		if(c1g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1g\" %f;\n", c1g);
+		writeFloat(mFile,"\tsetAttr \".c1.c1g\" ",c1g,";\n");
 	}
 	void setColor1B(float c1b)
 	{
 		if(c1b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1b\" %f;\n", c1b);
+		writeFloat(mFile,"\tsetAttr \".c1.c1b\" ",c1b,";\n");
 	}
 	void setColor2(const float3& c2)
 	{
 		if(c2 == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c2\" -type \"float3\" ");
 		c2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor2R(float c2r)
 	{
 		if(c2r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2r\" %f;\n", c2r);
+		writeFloat(mFile,"\tsetAttr \".c2.c2r\" ",c2r,";\n");
 	}
 	void setColor2G(float c2g)
 	{
 		if(c2g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2g\" %f;\n", c2g);
+		writeFloat(mFile,"\tsetAttr \".c2.c2g\" ",c2g,";\n");
 	}
 	void setColor2B(float c2b)
 	{
 		if(c2b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2b\" %f;\n", c2b);
+		writeFloat(mFile,"\tsetAttr \".c2.c2b\" ",c2b,";\n");
 	}
 	void setContrast(float ct)
 	{
 		if(ct == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ct\" %f;\n", ct);
+		writeFloat(mFile,"\tsetAttr \".ct\" ",ct,";\n");
 	}
 	void getColor1()const
 	{
-		fprintf(mFile,"\"%s.c1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1\"");
 	}
 	void getColor1R()const
 	{
-		fprintf(mFile,"\"%s.c1.c1r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1r\"");
 	}
 	void getColor1G()const
 	{
-		fprintf(mFile,"\"%s.c1.c1g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1g\"");
 	}
 	void getColor1B()const
 	{
-		fprintf(mFile,"\"%s.c1.c1b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1b\"");
 	}
 	void getColor2()const
 	{
-		fprintf(mFile,"\"%s.c2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2\"");
 	}
 	void getColor2R()const
 	{
-		fprintf(mFile,"\"%s.c2.c2r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2r\"");
 	}
 	void getColor2G()const
 	{
-		fprintf(mFile,"\"%s.c2.c2g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2g\"");
 	}
 	void getColor2B()const
 	{
-		fprintf(mFile,"\"%s.c2.c2b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2b\"");
 	}
 	void getContrast()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 protected:
 	Checker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,24 +27,24 @@ public:
 	void setSelector(int s)
 	{
 		if(s == 0) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void getSelector()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getInput(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getInput()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	Choice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,85 +27,85 @@ public:
 	void setInLevel(size_t il_i,bool il)
 	{
 		if(il == false) return;
-		fprintf(mFile,"\tsetAttr \".il[%i]\" %i;\n", il_i,il);
+		writeInt(mFile,"\tsetAttr \".il[",il_i); writeInt(mFile,"]\" ",il,";\n");
 	}
 	void setInLevel(size_t il_start,size_t il_end,bool* il)
 	{
-		fprintf(mFile,"\tsetAttr \".il[%i:%i]\" ", il_start,il_end);
+		writeInt(mFile,"\tsetAttr \".il[",il_start); writeInt(mFile,":",il_end,"]\" ");
 		size_t size = (il_end-il_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",il[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",il[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInLevel(size_t il_start,size_t il_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".il[%i:%i]\"",il_start,il_end);
+		writeInt(mFile,"\tsetAttr \".il[",il_start); writeInt(mFile,":",il_end,"]\"");
 	}
 	void appendInLevel(bool il)const
 	{
-		fprintf(mFile," %i",il);
+		writeInt(mFile," ",il);
 	}
 	void endInLevel()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplayLevel(size_t dl_i,unsigned int dl)
 	{
 		if(dl == 0) return;
-		fprintf(mFile,"\tsetAttr \".dl[%i]\" %i;\n", dl_i,dl);
+		writeInt(mFile,"\tsetAttr \".dl[",dl_i); writeInt(mFile,"]\" ",dl,";\n");
 	}
 	void setDisplayLevel(size_t dl_start,size_t dl_end,unsigned int* dl)
 	{
-		fprintf(mFile,"\tsetAttr \".dl[%i:%i]\" ", dl_start,dl_end);
+		writeInt(mFile,"\tsetAttr \".dl[",dl_start); writeInt(mFile,":",dl_end,"]\" ");
 		size_t size = (dl_end-dl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",dl[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",dl[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDisplayLevel(size_t dl_start,size_t dl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".dl[%i:%i]\"",dl_start,dl_end);
+		writeInt(mFile,"\tsetAttr \".dl[",dl_start); writeInt(mFile,":",dl_end,"]\"");
 	}
 	void appendDisplayLevel(unsigned int dl)const
 	{
-		fprintf(mFile," %i",dl);
+		writeInt(mFile," ",dl);
 	}
 	void endDisplayLevel()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInLevel(size_t il_i)const
 	{
-		fprintf(mFile,"\"%s.il[%i]\"",mName.c_str(),il_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".il[",il_i,"]\"");
 	}
 	void getInLevel()const
 	{
 
-		fprintf(mFile,"\"%s.il\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".il\"");
 	}
 	void getDisplayLevel(size_t dl_i)const
 	{
-		fprintf(mFile,"\"%s.dl[%i]\"",mName.c_str(),dl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dl[",dl_i,"]\"");
 	}
 	void getDisplayLevel()const
 	{
 
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getOutput(size_t o_i)const
 	{
-		fprintf(mFile,"\"%s.o[%i]\"",mName.c_str(),o_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".o[",o_i,"]\"");
 	}
 	void getOutput()const
 	{
 
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	Chooser(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,132 +27,132 @@ public:
 	void setMin(const float3& mn)
 	{
 		if(mn == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".mn\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mn\" -type \"float3\" ");
 		mn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinR(float mnr)
 	{
 		if(mnr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mn.mnr\" %f;\n", mnr);
+		writeFloat(mFile,"\tsetAttr \".mn.mnr\" ",mnr,";\n");
 	}
 	void setMinG(float mng)
 	{
 		if(mng == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mn.mng\" %f;\n", mng);
+		writeFloat(mFile,"\tsetAttr \".mn.mng\" ",mng,";\n");
 	}
 	void setMinB(float mnb)
 	{
 		if(mnb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mn.mnb\" %f;\n", mnb);
+		writeFloat(mFile,"\tsetAttr \".mn.mnb\" ",mnb,";\n");
 	}
 	void setMax(const float3& mx)
 	{
 		if(mx == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".mx\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mx\" -type \"float3\" ");
 		mx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxR(float mxr)
 	{
 		if(mxr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mx.mxr\" %f;\n", mxr);
+		writeFloat(mFile,"\tsetAttr \".mx.mxr\" ",mxr,";\n");
 	}
 	void setMaxG(float mxg)
 	{
 		if(mxg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mx.mxg\" %f;\n", mxg);
+		writeFloat(mFile,"\tsetAttr \".mx.mxg\" ",mxg,";\n");
 	}
 	void setMaxB(float mxb)
 	{
 		if(mxb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mx.mxb\" %f;\n", mxb);
+		writeFloat(mFile,"\tsetAttr \".mx.mxb\" ",mxb,";\n");
 	}
 	void setInput(const float3& ip)
 	{
 		if(ip == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ip\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ip\" -type \"float3\" ");
 		ip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputR(float ipr)
 	{
 		if(ipr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipr\" %f;\n", ipr);
+		writeFloat(mFile,"\tsetAttr \".ip.ipr\" ",ipr,";\n");
 	}
 	void setInputG(float ipg)
 	{
 		if(ipg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipg\" %f;\n", ipg);
+		writeFloat(mFile,"\tsetAttr \".ip.ipg\" ",ipg,";\n");
 	}
 	void setInputB(float ipb)
 	{
 		if(ipb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipb\" %f;\n", ipb);
+		writeFloat(mFile,"\tsetAttr \".ip.ipb\" ",ipb,";\n");
 	}
 	void getMin()const
 	{
-		fprintf(mFile,"\"%s.mn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mn\"");
 	}
 	void getMinR()const
 	{
-		fprintf(mFile,"\"%s.mn.mnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mn.mnr\"");
 	}
 	void getMinG()const
 	{
-		fprintf(mFile,"\"%s.mn.mng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mn.mng\"");
 	}
 	void getMinB()const
 	{
-		fprintf(mFile,"\"%s.mn.mnb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mn.mnb\"");
 	}
 	void getMax()const
 	{
-		fprintf(mFile,"\"%s.mx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mx\"");
 	}
 	void getMaxR()const
 	{
-		fprintf(mFile,"\"%s.mx.mxr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mx.mxr\"");
 	}
 	void getMaxG()const
 	{
-		fprintf(mFile,"\"%s.mx.mxg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mx.mxg\"");
 	}
 	void getMaxB()const
 	{
-		fprintf(mFile,"\"%s.mx.mxb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mx.mxb\"");
 	}
 	void getInput()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getInputR()const
 	{
-		fprintf(mFile,"\"%s.ip.ipr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipr\"");
 	}
 	void getInputG()const
 	{
-		fprintf(mFile,"\"%s.ip.ipg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipg\"");
 	}
 	void getInputB()const
 	{
-		fprintf(mFile,"\"%s.ip.ipb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipb\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getOutputR()const
 	{
-		fprintf(mFile,"\"%s.op.opr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op.opr\"");
 	}
 	void getOutputG()const
 	{
-		fprintf(mFile,"\"%s.op.opg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op.opg\"");
 	}
 	void getOutputB()const
 	{
-		fprintf(mFile,"\"%s.op.opb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op.opb\"");
 	}
 protected:
 	Clamp(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
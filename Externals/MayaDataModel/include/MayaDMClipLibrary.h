@@ -24,8 +24,8 @@ public:
 				short clipEval_InmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", clipEval_InmapTo);
-					fprintf(file,"%i", clipEval_InmapFrom);
+					writeInt(file,"",clipEval_InmapTo," ");
+					writeInt(file,"",clipEval_InmapFrom);
 				}
 			}* clipEval_Inmap;
 			size_t nbClipEval_Inmap;
@@ -34,8 +34,8 @@ public:
 				short clipEval_OutmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", clipEval_OutmapTo);
-					fprintf(file,"%i", clipEval_OutmapFrom);
+					writeInt(file,"",clipEval_OutmapTo," ");
+					writeInt(file,"",clipEval_OutmapFrom);
 				}
 			}* clipEval_Outmap;
 			size_t nbClipEval_Outmap;
@@ -44,13 +44,13 @@ public:
 				for (size_t i = 0; i<nbClipEval_Inmap; ++i)
 				{
 					clipEval_Inmap[i].write(file);
-					fprintf(file, " ");
-					if (i + 1<nbClipEval_Inmap) fprintf(file, " ");
+					writeString(file," ");
+					if (i + 1<nbClipEval_Inmap) writeString(file," ");
 				}
 				for (size_t i = 0; i<nbClipEval_Outmap; ++i)
 				{
 					clipEval_Outmap[i].write(file);
-					if (i + 1<nbClipEval_Outmap) fprintf(file, " ");
+					if (i + 1<nbClipEval_Outmap) writeString(file," ");
 				}
 			}
 		}* clipEval;
@@ -60,7 +60,7 @@ public:
 			for (size_t i = 0; i<nbClipEval; ++i)
 			{
 				clipEval[i].write(file);
-				if (i + 1<nbClipEval) fprintf(file, " ");
+				if (i + 1<nbClipEval) writeString(file," ");
 			}
 		}
 	};
@@ -80,347 +80,347 @@ public:
 
 	void setClipEvalList(size_t cel_i,const ClipEvalList& cel)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i]\" ",cel_i);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i,"]\" ");
 		cel.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipEvalList(size_t cel_start,size_t cel_end,ClipEvalList* cel)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i:%i]\" ", cel_start,cel_end);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_start); writeInt(mFile,":",cel_end,"]\" ");
 		size_t size = (cel_end-cel_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cel[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClipEvalList(size_t cel_start,size_t cel_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i:%i]\"",cel_start,cel_end);
-		fprintf(mFile," -type \"ClipEvalList\" ");
+		writeInt(mFile,"\tsetAttr \".cel[",cel_start); writeInt(mFile,":",cel_end,"]\"");
+		writeString(mFile," -type \"ClipEvalList\" ");
 	}
 	void appendClipEvalList(const ClipEvalList& cel)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cel.write(mFile);
 	}
 	void endClipEvalList()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipEval(size_t cel_i,size_t cev_i,const ClipEvalList::ClipEval& cev)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i]\" ",cel_i,cev_i);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i,"]\" ");
 		cev.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipEval(size_t cel_i,size_t cev_start,size_t cev_end,ClipEvalList::ClipEval* cev)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i:%i]\" ", cel_i,cev_start,cev_end);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_start); writeInt(mFile,":",cev_end,"]\" ");
 		size_t size = (cev_end-cev_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cev[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClipEval(size_t cel_i,size_t cev_start,size_t cev_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i:%i]\"",cel_i,cev_start,cev_end);
-		fprintf(mFile," -type \"ClipEvalList::ClipEval\" ");
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_start); writeInt(mFile,":",cev_end,"]\"");
+		writeString(mFile," -type \"ClipEvalList::ClipEval\" ");
 	}
 	void appendClipEval(const ClipEvalList::ClipEval& cev)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cev.write(mFile);
 	}
 	void endClipEval()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipEval_Inmap(size_t cel_i,size_t cev_i,size_t cevi_i,const ClipEvalList::ClipEval::ClipEval_Inmap& cevi)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevi[%i]\" ",cel_i,cev_i,cevi_i);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i,"]\" ");
 		cevi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipEval_Inmap(size_t cel_i,size_t cev_i,size_t cevi_start,size_t cevi_end,ClipEvalList::ClipEval::ClipEval_Inmap* cevi)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevi[%i:%i]\" ", cel_i,cev_i,cevi_start,cevi_end);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevi[",cevi_start); writeInt(mFile,":",cevi_end,"]\" ");
 		size_t size = (cevi_end-cevi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cevi[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClipEval_Inmap(size_t cel_i,size_t cev_i,size_t cevi_start,size_t cevi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevi[%i:%i]\"",cel_i,cev_i,cevi_start,cevi_end);
-		fprintf(mFile," -type \"ClipEvalList::ClipEval::ClipEval_Inmap\" ");
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevi[",cevi_start); writeInt(mFile,":",cevi_end,"]\"");
+		writeString(mFile," -type \"ClipEvalList::ClipEval::ClipEval_Inmap\" ");
 	}
 	void appendClipEval_Inmap(const ClipEvalList::ClipEval::ClipEval_Inmap& cevi)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cevi.write(mFile);
 	}
 	void endClipEval_Inmap()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipEval_InmapTo(size_t cel_i,size_t cev_i,size_t cevi_i,short cevit)
 	{
 		if(cevit == 0) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevi[%i].cevit\" %i;\n", cel_i,cev_i,cevi_i,cevit);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i); writeInt(mFile,"].cevit\" ",cevit,";\n");
 	}
 	void setClipEval_InmapFrom(size_t cel_i,size_t cev_i,size_t cevi_i,short cevif)
 	{
 		if(cevif == 0) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevi[%i].cevif\" %i;\n", cel_i,cev_i,cevi_i,cevif);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i); writeInt(mFile,"].cevif\" ",cevif,";\n");
 	}
 	void setClipEval_Outmap(size_t cel_i,size_t cev_i,size_t cevo_i,const ClipEvalList::ClipEval::ClipEval_Outmap& cevo)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevo[%i]\" ",cel_i,cev_i,cevo_i);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i,"]\" ");
 		cevo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipEval_Outmap(size_t cel_i,size_t cev_i,size_t cevo_start,size_t cevo_end,ClipEvalList::ClipEval::ClipEval_Outmap* cevo)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevo[%i:%i]\" ", cel_i,cev_i,cevo_start,cevo_end);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevo[",cevo_start); writeInt(mFile,":",cevo_end,"]\" ");
 		size_t size = (cevo_end-cevo_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cevo[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClipEval_Outmap(size_t cel_i,size_t cev_i,size_t cevo_start,size_t cevo_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevo[%i:%i]\"",cel_i,cev_i,cevo_start,cevo_end);
-		fprintf(mFile," -type \"ClipEvalList::ClipEval::ClipEval_Outmap\" ");
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevo[",cevo_start); writeInt(mFile,":",cevo_end,"]\"");
+		writeString(mFile," -type \"ClipEvalList::ClipEval::ClipEval_Outmap\" ");
 	}
 	void appendClipEval_Outmap(const ClipEvalList::ClipEval::ClipEval_Outmap& cevo)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cevo.write(mFile);
 	}
 	void endClipEval_Outmap()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipEval_OutmapTo(size_t cel_i,size_t cev_i,size_t cevo_i,short cevot)
 	{
 		if(cevot == 0) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevo[%i].cevot\" %i;\n", cel_i,cev_i,cevo_i,cevot);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i); writeInt(mFile,"].cevot\" ",cevot,";\n");
 	}
 	void setClipEval_OutmapFrom(size_t cel_i,size_t cev_i,size_t cevo_i,short cevof)
 	{
 		if(cevof == 0) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].cev[%i].cevo[%i].cevof\" %i;\n", cel_i,cev_i,cevo_i,cevof);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i); writeInt(mFile,"].cevof\" ",cevof,";\n");
 	}
 	void setCharacterdata(size_t cd_i,const Characterdata& cd)
 	{
-		fprintf(mFile,"\tsetAttr \".cd[%i]\" ",cd_i);
+		writeInt(mFile,"\tsetAttr \".cd[",cd_i,"]\" ");
 		cd.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCharacterdata(size_t cd_start,size_t cd_end,Characterdata* cd)
 	{
-		fprintf(mFile,"\tsetAttr \".cd[%i:%i]\" ", cd_start,cd_end);
+		writeInt(mFile,"\tsetAttr \".cd[",cd_start); writeInt(mFile,":",cd_end,"]\" ");
 		size_t size = (cd_end-cd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cd[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCharacterdata(size_t cd_start,size_t cd_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cd[%i:%i]\"",cd_start,cd_end);
-		fprintf(mFile," -type \"Characterdata\" ");
+		writeInt(mFile,"\tsetAttr \".cd[",cd_start); writeInt(mFile,":",cd_end,"]\"");
+		writeString(mFile," -type \"Characterdata\" ");
 	}
 	void appendCharacterdata(const Characterdata& cd)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cd.write(mFile);
 	}
 	void endCharacterdata()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClipIndexMapping(size_t cd_i,const intArray& cim)
 	{
 		if(cim.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".cd[%i].cim\" -type \"intArray\" ",cd_i);
+		writeInt(mFile,"\tsetAttr \".cd[",cd_i,"].cim\" -type \"intArray\" ");
 		cim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setActiveClip(int act)
 	{
 		if(act == -1) return;
-		fprintf(mFile,"\tsetAttr \".act\" %i;\n", act);
+		writeInt(mFile,"\tsetAttr \".act\" ",act,";\n");
 	}
 	void getClipEvalList(size_t cel_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i]\"",mName.c_str(),cel_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i,"]\"");
 	}
 	void getClipEvalList()const
 	{
 
-		fprintf(mFile,"\"%s.cel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cel\"");
 	}
 	void getClipEval(size_t cel_i,size_t cev_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].cev[%i]\"",mName.c_str(),cel_i,cev_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i); writeInt(mFile,"].cev[",cev_i,"]\"");
 	}
 	void getClipEval(size_t cev_i)const
 	{
 
-		fprintf(mFile,"\"%s.cel.cev[%i]\"",mName.c_str(),cev_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel.cev[",cev_i,"]\"");
 	}
 	void getClipEval_Raw(size_t cel_i,size_t cev_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].cev[%i].cevr\"",mName.c_str(),cel_i,cev_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i); writeInt(mFile,"].cev[",cev_i,"].cevr\"");
 	}
 	void getClipEval_Raw(size_t cev_i)const
 	{
 
-		fprintf(mFile,"\"%s.cel.cev[%i].cevr\"",mName.c_str(),cev_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel.cev[",cev_i,"].cevr\"");
 	}
 	void getClipEval_Inmap(size_t cel_i,size_t cev_i,size_t cevi_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].cev[%i].cevi[%i]\"",mName.c_str(),cel_i,cev_i,cevi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i,"]\"");
 	}
 	void getClipEval_Inmap(size_t cev_i,size_t cevi_i)const
 	{
 
-		fprintf(mFile,"\"%s.cel.cev[%i].cevi[%i]\"",mName.c_str(),cev_i,cevi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel.cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i,"]\"");
 	}
 	void getClipEval_InmapTo(size_t cel_i,size_t cev_i,size_t cevi_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].cev[%i].cevi[%i].cevit\"",mName.c_str(),cel_i,cev_i,cevi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i,"].cevit\"");
 	}
 	void getClipEval_InmapTo(size_t cev_i,size_t cevi_i)const
 	{
 
-		fprintf(mFile,"\"%s.cel.cev[%i].cevi[%i].cevit\"",mName.c_str(),cev_i,cevi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel.cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i,"].cevit\"");
 	}
 	void getClipEval_InmapFrom(size_t cel_i,size_t cev_i,size_t cevi_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].cev[%i].cevi[%i].cevif\"",mName.c_str(),cel_i,cev_i,cevi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i,"].cevif\"");
 	}
 	void getClipEval_InmapFrom(size_t cev_i,size_t cevi_i)const
 	{
 
-		fprintf(mFile,"\"%s.cel.cev[%i].cevi[%i].cevif\"",mName.c_str(),cev_i,cevi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel.cev[",cev_i); writeInt(mFile,"].cevi[",cevi_i,"].cevif\"");
 	}
 	void getClipEval_Outmap(size_t cel_i,size_t cev_i,size_t cevo_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].cev[%i].cevo[%i]\"",mName.c_str(),cel_i,cev_i,cevo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i,"]\"");
 	}
 	void getClipEval_Outmap(size_t cev_i,size_t cevo_i)const
 	{
 
-		fprintf(mFile,"\"%s.cel.cev[%i].cevo[%i]\"",mName.c_str(),cev_i,cevo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel.cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i,"]\"");
 	}
 	void getClipEval_OutmapTo(size_t cel_i,size_t cev_i,size_t cevo_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].cev[%i].cevo[%i].cevot\"",mName.c_str(),cel_i,cev_i,cevo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i,"].cevot\"");
 	}
 	void getClipEval_OutmapTo(size_t cev_i,size_t cevo_i)const
 	{
 
-		fprintf(mFile,"\"%s.cel.cev[%i].cevo[%i].cevot\"",mName.c_str(),cev_i,cevo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel.cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i,"].cevot\"");
 	}
 	void getClipEval_OutmapFrom(size_t cel_i,size_t cev_i,size_t cevo_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].cev[%i].cevo[%i].cevof\"",mName.c_str(),cel_i,cev_i,cevo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i); writeInt(mFile,"].cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i,"].cevof\"");
 	}
 	void getClipEval_OutmapFrom(size_t cev_i,size_t cevo_i)const
 	{
 
-		fprintf(mFile,"\"%s.cel.cev[%i].cevo[%i].cevof\"",mName.c_str(),cev_i,cevo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel.cev[",cev_i); writeInt(mFile,"].cevo[",cevo_i,"].cevof\"");
 	}
 	void getClipFunction()const
 	{
-		fprintf(mFile,"\"%s.cf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cf\"");
 	}
 	void getCharacterdata(size_t cd_i)const
 	{
-		fprintf(mFile,"\"%s.cd[%i]\"",mName.c_str(),cd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cd[",cd_i,"]\"");
 	}
 	void getCharacterdata()const
 	{
 
-		fprintf(mFile,"\"%s.cd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cd\"");
 	}
 	void getCharacterMapping(size_t cd_i)const
 	{
-		fprintf(mFile,"\"%s.cd[%i].cm\"",mName.c_str(),cd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cd[",cd_i,"].cm\"");
 	}
 	void getCharacterMapping()const
 	{
 
-		fprintf(mFile,"\"%s.cd.cm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cd.cm\"");
 	}
 	void getClipIndexMapping(size_t cd_i)const
 	{
-		fprintf(mFile,"\"%s.cd[%i].cim\"",mName.c_str(),cd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cd[",cd_i,"].cim\"");
 	}
 	void getClipIndexMapping()const
 	{
 
-		fprintf(mFile,"\"%s.cd.cim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cd.cim\"");
 	}
 	void getClipName(size_t cn_i)const
 	{
-		fprintf(mFile,"\"%s.cn[%i]\"",mName.c_str(),cn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cn[",cn_i,"]\"");
 	}
 	void getClipName()const
 	{
 
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getStart(size_t st_i)const
 	{
-		fprintf(mFile,"\"%s.st[%i]\"",mName.c_str(),st_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".st[",st_i,"]\"");
 	}
 	void getStart()const
 	{
 
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getDuration(size_t du_i)const
 	{
-		fprintf(mFile,"\"%s.du[%i]\"",mName.c_str(),du_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".du[",du_i,"]\"");
 	}
 	void getDuration()const
 	{
 
-		fprintf(mFile,"\"%s.du\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".du\"");
 	}
 	void getSourceClip(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i]\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"]\"");
 	}
 	void getSourceClip()const
 	{
 
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getClip(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i]\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"]\"");
 	}
 	void getClip()const
 	{
 
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 protected:
 	ClipLibrary(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,55 +27,55 @@ public:
 	void setPreserveShape(unsigned int ps)
 	{
 		if(ps == 1) return;
-		fprintf(mFile,"\tsetAttr \".ps\" %i;\n", ps);
+		writeInt(mFile,"\tsetAttr \".ps\" ",ps,";\n");
 	}
 	void setBlendBias(double bb)
 	{
 		if(bb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".bb\" %f;\n", bb);
+		writeFloat(mFile,"\tsetAttr \".bb\" ",bb,";\n");
 	}
 	void setBlendKnotInsertion(bool bki)
 	{
 		if(bki == false) return;
-		fprintf(mFile,"\tsetAttr \".bki\" %i;\n", bki);
+		writeInt(mFile,"\tsetAttr \".bki\" ",bki,";\n");
 	}
 	void setParameter(double p)
 	{
 		if(p == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".p\" %f;\n", p);
+		writeFloat(mFile,"\tsetAttr \".p\" ",p,";\n");
 	}
 	void setDirection(unsigned int d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getPreserveShape()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getBlendBias()const
 	{
-		fprintf(mFile,"\"%s.bb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb\"");
 	}
 	void getBlendKnotInsertion()const
 	{
-		fprintf(mFile,"\"%s.bki\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bki\"");
 	}
 	void getParameter()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	CloseSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
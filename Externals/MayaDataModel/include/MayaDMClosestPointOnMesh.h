@@ -32,96 +32,96 @@ public:
 	void setInPosition(const double3& ip)
 	{
 		if(ip == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
 		ip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInPositionX(double ipx)
 	{
 		if(ipx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipx\" %f;\n", ipx);
+		writeFloat(mFile,"\tsetAttr \".ip.ipx\" ",ipx,";\n");
 	}
 	void setInPositionY(double ipy)
 	{
 		if(ipy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipy\" %f;\n", ipy);
+		writeFloat(mFile,"\tsetAttr \".ip.ipy\" ",ipy,";\n");
 	}
 	void setInPositionZ(double ipz)
 	{
 		if(ipz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipz\" %f;\n", ipz);
+		writeFloat(mFile,"\tsetAttr \".ip.ipz\" ",ipz,";\n");
 	}
 	void getInMesh()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getInPosition()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getInPositionX()const
 	{
-		fprintf(mFile,"\"%s.ip.ipx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipx\"");
 	}
 	void getInPositionY()const
 	{
-		fprintf(mFile,"\"%s.ip.ipy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipy\"");
 	}
 	void getInPositionZ()const
 	{
-		fprintf(mFile,"\"%s.ip.ipz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipz\"");
 	}
 	void getResult()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.r.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.r.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.px\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.r.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.py\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.r.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.pz\"");
 	}
 	void getParameterU()const
 	{
-		fprintf(mFile,"\"%s.r.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.u\"");
 	}
 	void getParameterV()const
 	{
-		fprintf(mFile,"\"%s.r.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.v\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.r.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.r.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.nx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.r.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.ny\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.r.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.nz\"");
 	}
 	void getClosestFaceIndex()const
 	{
-		fprintf(mFile,"\"%s.r.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.f\"");
 	}
 	void getClosestVertexIndex()const
 	{
-		fprintf(mFile,"\"%s.r.vt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.vt\"");
 	}
 protected:
 	ClosestPointOnMesh(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
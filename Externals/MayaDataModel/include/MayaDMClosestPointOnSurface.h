@@ -32,72 +32,72 @@ public:
 	void setInPosition(const double3& ip)
 	{
 		if(ip == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
 		ip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInPositionX(double ipx)
 	{
 		if(ipx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipx\" %f;\n", ipx);
+		writeFloat(mFile,"\tsetAttr \".ip.ipx\" ",ipx,";\n");
 	}
 	void setInPositionY(double ipy)
 	{
 		if(ipy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipy\" %f;\n", ipy);
+		writeFloat(mFile,"\tsetAttr \".ip.ipy\" ",ipy,";\n");
 	}
 	void setInPositionZ(double ipz)
 	{
 		if(ipz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipz\" %f;\n", ipz);
+		writeFloat(mFile,"\tsetAttr \".ip.ipz\" ",ipz,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInPosition()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getInPositionX()const
 	{
-		fprintf(mFile,"\"%s.ip.ipx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipx\"");
 	}
 	void getInPositionY()const
 	{
-		fprintf(mFile,"\"%s.ip.ipy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipy\"");
 	}
 	void getInPositionZ()const
 	{
-		fprintf(mFile,"\"%s.ip.ipz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipz\"");
 	}
 	void getResult()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.r.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.r.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.px\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.r.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.py\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.r.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.pz\"");
 	}
 	void getParameterU()const
 	{
-		fprintf(mFile,"\"%s.r.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.u\"");
 	}
 	void getParameterV()const
 	{
-		fprintf(mFile,"\"%s.r.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.v\"");
 	}
 protected:
 	ClosestPointOnSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,179 +27,179 @@ public:
 	void setGapColor(const float3& gc)
 	{
 		if(gc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
 		gc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGapColorR(float gcr)
 	{
 		if(gcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcr\" %f;\n", gcr);
+		writeFloat(mFile,"\tsetAttr \".gc.gcr\" ",gcr,";\n");
 	}
 	void setGapColorG(float gcg)
 	{
 		if(gcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcg\" %f;\n", gcg);
+		writeFloat(mFile,"\tsetAttr \".gc.gcg\" ",gcg,";\n");
 	}
 	void setGapColorB(float gcb)
 	{
 		if(gcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcb\" %f;\n", gcb);
+		writeFloat(mFile,"\tsetAttr \".gc.gcb\" ",gcb,";\n");
 	}
 	void setUColor(const float3& uc)
 	{
 		if(uc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".uc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".uc\" -type \"float3\" ");
 		uc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUColorR(float ucr)
 	{
 		if(ucr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uc.ucr\" %f;\n", ucr);
+		writeFloat(mFile,"\tsetAttr \".uc.ucr\" ",ucr,";\n");
 	}
 	void setUColorG(float ucg)
 	{
 		if(ucg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uc.ucg\" %f;\n", ucg);
+		writeFloat(mFile,"\tsetAttr \".uc.ucg\" ",ucg,";\n");
 	}
 	void setUColorB(float ucb)
 	{
 		if(ucb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uc.ucb\" %f;\n", ucb);
+		writeFloat(mFile,"\tsetAttr \".uc.ucb\" ",ucb,";\n");
 	}
 	void setVColor(const float3& vc)
 	{
 		if(vc == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".vc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc\" -type \"float3\" ");
 		vc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVColorR(float vcr)
 	{
 		if(vcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcr\" %f;\n", vcr);
+		writeFloat(mFile,"\tsetAttr \".vc.vcr\" ",vcr,";\n");
 	}
 	void setVColorG(float vcg)
 	{
 		if(vcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcg\" %f;\n", vcg);
+		writeFloat(mFile,"\tsetAttr \".vc.vcg\" ",vcg,";\n");
 	}
 	void setVColorB(float vcb)
 	{
 		if(vcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcb\" %f;\n", vcb);
+		writeFloat(mFile,"\tsetAttr \".vc.vcb\" ",vcb,";\n");
 	}
 	void setUWidth(float uwi)
 	{
 		if(uwi == 0.75) return;
-		fprintf(mFile,"\tsetAttr \".uwi\" %f;\n", uwi);
+		writeFloat(mFile,"\tsetAttr \".uwi\" ",uwi,";\n");
 	}
 	void setVWidth(float vwi)
 	{
 		if(vwi == 0.75) return;
-		fprintf(mFile,"\tsetAttr \".vwi\" %f;\n", vwi);
+		writeFloat(mFile,"\tsetAttr \".vwi\" ",vwi,";\n");
 	}
 	void setUWave(float uwa)
 	{
 		if(uwa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uwa\" %f;\n", uwa);
+		writeFloat(mFile,"\tsetAttr \".uwa\" ",uwa,";\n");
 	}
 	void setVWave(float vwa)
 	{
 		if(vwa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vwa\" %f;\n", vwa);
+		writeFloat(mFile,"\tsetAttr \".vwa\" ",vwa,";\n");
 	}
 	void setRandomness(float r)
 	{
 		if(r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setWidthSpread(float ws)
 	{
 		if(ws == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ws\" %f;\n", ws);
+		writeFloat(mFile,"\tsetAttr \".ws\" ",ws,";\n");
 	}
 	void setBrightSpread(float bs)
 	{
 		if(bs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bs\" %f;\n", bs);
+		writeFloat(mFile,"\tsetAttr \".bs\" ",bs,";\n");
 	}
 	void getGapColor()const
 	{
-		fprintf(mFile,"\"%s.gc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc\"");
 	}
 	void getGapColorR()const
 	{
-		fprintf(mFile,"\"%s.gc.gcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcr\"");
 	}
 	void getGapColorG()const
 	{
-		fprintf(mFile,"\"%s.gc.gcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcg\"");
 	}
 	void getGapColorB()const
 	{
-		fprintf(mFile,"\"%s.gc.gcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcb\"");
 	}
 	void getUColor()const
 	{
-		fprintf(mFile,"\"%s.uc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uc\"");
 	}
 	void getUColorR()const
 	{
-		fprintf(mFile,"\"%s.uc.ucr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uc.ucr\"");
 	}
 	void getUColorG()const
 	{
-		fprintf(mFile,"\"%s.uc.ucg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uc.ucg\"");
 	}
 	void getUColorB()const
 	{
-		fprintf(mFile,"\"%s.uc.ucb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uc.ucb\"");
 	}
 	void getVColor()const
 	{
-		fprintf(mFile,"\"%s.vc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc\"");
 	}
 	void getVColorR()const
 	{
-		fprintf(mFile,"\"%s.vc.vcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcr\"");
 	}
 	void getVColorG()const
 	{
-		fprintf(mFile,"\"%s.vc.vcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcg\"");
 	}
 	void getVColorB()const
 	{
-		fprintf(mFile,"\"%s.vc.vcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcb\"");
 	}
 	void getUWidth()const
 	{
-		fprintf(mFile,"\"%s.uwi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uwi\"");
 	}
 	void getVWidth()const
 	{
-		fprintf(mFile,"\"%s.vwi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vwi\"");
 	}
 	void getUWave()const
 	{
-		fprintf(mFile,"\"%s.uwa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uwa\"");
 	}
 	void getVWave()const
 	{
-		fprintf(mFile,"\"%s.vwa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vwa\"");
 	}
 	void getRandomness()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getWidthSpread()const
 	{
-		fprintf(mFile,"\"%s.ws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ws\"");
 	}
 	void getBrightSpread()const
 	{
-		fprintf(mFile,"\"%s.bs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bs\"");
 	}
 protected:
 	Cloth(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
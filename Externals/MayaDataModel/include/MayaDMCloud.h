@@ -27,269 +27,269 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setColor1(const float3& c1)
 	{
 		if(c1 == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c1\" -type \"float3\" ");
 		c1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor1R(float c1r)
 	{
 		if(c1r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1r\" %f;\n", c1r);
+		writeFloat(mFile,"\tsetAttr \".c1.c1r\" ",c1r,";\n");
 	}
 	void setColor1G(float c1g)
 	{
 		if(c1g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1g\" %f;\n", c1g);
+		writeFloat(mFile,"\tsetAttr \".c1.c1g\" ",c1g,";\n");
 	}
 	void setColor1B(float c1b)
 	{
 		if(c1b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1b\" %f;\n", c1b);
+		writeFloat(mFile,"\tsetAttr \".c1.c1b\" ",c1b,";\n");
 	}
 	void setColor2(const float3& c2)
 	{
 		if(c2 == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c2\" -type \"float3\" ");
 		c2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor2R(float c2r)
 	{
 		if(c2r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2r\" %f;\n", c2r);
+		writeFloat(mFile,"\tsetAttr \".c2.c2r\" ",c2r,";\n");
 	}
 	void setColor2G(float c2g)
 	{
 		if(c2g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2g\" %f;\n", c2g);
+		writeFloat(mFile,"\tsetAttr \".c2.c2g\" ",c2g,";\n");
 	}
 	void setColor2B(float c2b)
 	{
 		if(c2b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2b\" %f;\n", c2b);
+		writeFloat(mFile,"\tsetAttr \".c2.c2b\" ",c2b,";\n");
 	}
 	void setContrast(float c)
 	{
 		if(c == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".c\" %f;\n", c);
+		writeFloat(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setSoftEdges(bool se)
 	{
 		if(se == true) return;
-		fprintf(mFile,"\tsetAttr \".se\" %i;\n", se);
+		writeInt(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setTranspRange(float tr)
 	{
 		if(tr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tr\" %f;\n", tr);
+		writeFloat(mFile,"\tsetAttr \".tr\" ",tr,";\n");
 	}
 	void setCenterThresh(float ct)
 	{
 		if(ct == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ct\" %f;\n", ct);
+		writeFloat(mFile,"\tsetAttr \".ct\" ",ct,";\n");
 	}
 	void setEdgeThresh(float et)
 	{
 		if(et == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".et\" %f;\n", et);
+		writeFloat(mFile,"\tsetAttr \".et\" ",et,";\n");
 	}
 	void setRipples(const float3& r)
 	{
 		if(r == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".r\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".r\" -type \"float3\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRipplesX(float rx)
 	{
 		if(rx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".r.rx\" ",rx,";\n");
 	}
 	void setRipplesY(float ry)
 	{
 		if(ry == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".r.ry\" ",ry,";\n");
 	}
 	void setRipplesZ(float rz)
 	{
 		if(rz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".r.rz\" ",rz,";\n");
 	}
 	void setDepth(const float2& d)
 	{
 		if(d == float2(0.0f,8.0f)) return;
-		fprintf(mFile,"\tsetAttr \".d\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"float2\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDepthMin(float dmn)
 	{
 		if(dmn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmn\" %f;\n", dmn);
+		writeFloat(mFile,"\tsetAttr \".d.dmn\" ",dmn,";\n");
 	}
 	void setDepthMax(float dmx)
 	{
 		if(dmx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmx\" %f;\n", dmx);
+		writeFloat(mFile,"\tsetAttr \".d.dmx\" ",dmx,";\n");
 	}
 	void setAmplitude(float a)
 	{
 		if(a == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getEyeToTextureMatrix()const
 	{
-		fprintf(mFile,"\"%s.e2t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2t\"");
 	}
 	void getColor1()const
 	{
-		fprintf(mFile,"\"%s.c1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1\"");
 	}
 	void getColor1R()const
 	{
-		fprintf(mFile,"\"%s.c1.c1r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1r\"");
 	}
 	void getColor1G()const
 	{
-		fprintf(mFile,"\"%s.c1.c1g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1g\"");
 	}
 	void getColor1B()const
 	{
-		fprintf(mFile,"\"%s.c1.c1b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1b\"");
 	}
 	void getColor2()const
 	{
-		fprintf(mFile,"\"%s.c2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2\"");
 	}
 	void getColor2R()const
 	{
-		fprintf(mFile,"\"%s.c2.c2r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2r\"");
 	}
 	void getColor2G()const
 	{
-		fprintf(mFile,"\"%s.c2.c2g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2g\"");
 	}
 	void getColor2B()const
 	{
-		fprintf(mFile,"\"%s.c2.c2b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2b\"");
 	}
 	void getContrast()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getSoftEdges()const
 	{
-		fprintf(mFile,"\"%s.se\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".se\"");
 	}
 	void getTranspRange()const
 	{
-		fprintf(mFile,"\"%s.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tr\"");
 	}
 	void getCenterThresh()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getEdgeThresh()const
 	{
-		fprintf(mFile,"\"%s.et\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".et\"");
 	}
 	void getRipples()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRipplesX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRipplesY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRipplesZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDepthMin()const
 	{
-		fprintf(mFile,"\"%s.d.dmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmn\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.d.dmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmx\"");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 protected:
 	Cloud(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -32,136 +32,136 @@ public:
 	void setPercentResolution(float ptr)
 	{
 		if(ptr == 5) return;
-		fprintf(mFile,"\tsetAttr \".ptr\" %f;\n", ptr);
+		writeFloat(mFile,"\tsetAttr \".ptr\" ",ptr,";\n");
 	}
 	void setUsePartialResolution(unsigned int upr)
 	{
 		if(upr == 0) return;
-		fprintf(mFile,"\tsetAttr \".upr\" %i;\n", upr);
+		writeInt(mFile,"\tsetAttr \".upr\" ",upr,";\n");
 	}
 	void setRelative(bool rel)
 	{
 		if(rel == false) return;
-		fprintf(mFile,"\tsetAttr \".rel\" %i;\n", rel);
+		writeInt(mFile,"\tsetAttr \".rel\" ",rel,";\n");
 	}
 	void setWeightedCompensationMatrix(const matrix& wcm)
 	{
 		if(wcm == identity) return;
-		fprintf(mFile,"\tsetAttr \".wcm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".wcm\" -type \"matrix\" ");
 		wcm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGeomMatrix(size_t gm_i,const matrix& gm)
 	{
 		if(gm == identity) return;
-		fprintf(mFile,"\tsetAttr \".gm[%i]\" -type \"matrix\" ",gm_i);
+		writeInt(mFile,"\tsetAttr \".gm[",gm_i,"]\" -type \"matrix\" ");
 		gm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGeomMatrix(size_t gm_start,size_t gm_end,matrix* gm)
 	{
-		fprintf(mFile,"\tsetAttr \".gm[%i:%i]\" ", gm_start,gm_end);
+		writeInt(mFile,"\tsetAttr \".gm[",gm_start); writeInt(mFile,":",gm_end,"]\" ");
 		size_t size = (gm_end-gm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			gm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGeomMatrix(size_t gm_start,size_t gm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".gm[%i:%i]\"",gm_start,gm_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".gm[",gm_start); writeInt(mFile,":",gm_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendGeomMatrix(const matrix& gm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		gm.write(mFile);
 	}
 	void endGeomMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMatrix(const matrix& ma)
 	{
 		if(ma == identity) return;
-		fprintf(mFile,"\tsetAttr \".ma\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".ma\" -type \"matrix\" ");
 		ma.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBindPreMatrix(const matrix& pm)
 	{
 		if(pm == identity) return;
-		fprintf(mFile,"\tsetAttr \".pm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".pm\" -type \"matrix\" ");
 		pm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAngleInterpolation(unsigned int ait)
 	{
 		if(ait == 0) return;
-		fprintf(mFile,"\tsetAttr \".ait\" %i;\n", ait);
+		writeInt(mFile,"\tsetAttr \".ait\" ",ait,";\n");
 	}
 	void getUsePartialResolution()const
 	{
-		fprintf(mFile,"\"%s.upr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upr\"");
 	}
 	void getRelative()const
 	{
-		fprintf(mFile,"\"%s.rel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rel\"");
 	}
 	void getClusterXforms()const
 	{
-		fprintf(mFile,"\"%s.x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x\"");
 	}
 	void getPreMatrix()const
 	{
-		fprintf(mFile,"\"%s.x.pre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.pre\"");
 	}
 	void getWeightedMatrix()const
 	{
-		fprintf(mFile,"\"%s.x.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.wt\"");
 	}
 	void getPostMatrix()const
 	{
-		fprintf(mFile,"\"%s.x.post\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.post\"");
 	}
 	void getWeightedCompensationMatrix()const
 	{
-		fprintf(mFile,"\"%s.wcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wcm\"");
 	}
 	void getGeomMatrix(size_t gm_i)const
 	{
-		fprintf(mFile,"\"%s.gm[%i]\"",mName.c_str(),gm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gm[",gm_i,"]\"");
 	}
 	void getGeomMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.gm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gm\"");
 	}
 	void getMatrix()const
 	{
-		fprintf(mFile,"\"%s.ma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ma\"");
 	}
 	void getBindPreMatrix()const
 	{
-		fprintf(mFile,"\"%s.pm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pm\"");
 	}
 	void getBindState()const
 	{
-		fprintf(mFile,"\"%s.bs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bs\"");
 	}
 	void getPostCompensationMatrix()const
 	{
-		fprintf(mFile,"\"%s.psc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".psc\"");
 	}
 	void getPreCompensationMatrix()const
 	{
-		fprintf(mFile,"\"%s.prc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".prc\"");
 	}
 	void getAngleInterpolation()const
 	{
-		fprintf(mFile,"\"%s.ait\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ait\"");
 	}
 protected:
 	Cluster(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
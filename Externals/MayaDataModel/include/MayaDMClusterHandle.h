@@ -31,80 +31,80 @@ public:
 
 	void setOrigin(const double3& _or)
 	{
-		fprintf(mFile,"\tsetAttr \".or\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".or\" -type \"double3\" ");
 		_or.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOriginX(double ox)
 	{
 		if(ox == 0) return;
-		fprintf(mFile,"\tsetAttr \".or.ox\" %f;\n", ox);
+		writeFloat(mFile,"\tsetAttr \".or.ox\" ",ox,";\n");
 	}
 	void setOriginY(double oy)
 	{
 		if(oy == 0) return;
-		fprintf(mFile,"\tsetAttr \".or.oy\" %f;\n", oy);
+		writeFloat(mFile,"\tsetAttr \".or.oy\" ",oy,";\n");
 	}
 	void setOriginZ(double oz)
 	{
 		if(oz == 0) return;
-		fprintf(mFile,"\tsetAttr \".or.oz\" %f;\n", oz);
+		writeFloat(mFile,"\tsetAttr \".or.oz\" ",oz,";\n");
 	}
 	void getClusterTransforms(size_t x_i)const
 	{
-		fprintf(mFile,"\"%s.x[%i]\"",mName.c_str(),x_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".x[",x_i,"]\"");
 	}
 	void getClusterTransforms()const
 	{
 
-		fprintf(mFile,"\"%s.x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x\"");
 	}
 	void getPreWeightedMatrixTransform(size_t x_i)const
 	{
-		fprintf(mFile,"\"%s.x[%i].pre\"",mName.c_str(),x_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".x[",x_i,"].pre\"");
 	}
 	void getPreWeightedMatrixTransform()const
 	{
 
-		fprintf(mFile,"\"%s.x.pre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.pre\"");
 	}
 	void getWeightedMatrixTransform(size_t x_i)const
 	{
-		fprintf(mFile,"\"%s.x[%i].wt\"",mName.c_str(),x_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".x[",x_i,"].wt\"");
 	}
 	void getWeightedMatrixTransform()const
 	{
 
-		fprintf(mFile,"\"%s.x.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.wt\"");
 	}
 	void getPostWeightedMatrixTransform(size_t x_i)const
 	{
-		fprintf(mFile,"\"%s.x[%i].post\"",mName.c_str(),x_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".x[",x_i,"].post\"");
 	}
 	void getPostWeightedMatrixTransform()const
 	{
 
-		fprintf(mFile,"\"%s.x.post\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.post\"");
 	}
 	void getOrigin()const
 	{
-		fprintf(mFile,"\"%s.or\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or\"");
 	}
 	void getOriginX()const
 	{
-		fprintf(mFile,"\"%s.or.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.ox\"");
 	}
 	void getOriginY()const
 	{
-		fprintf(mFile,"\"%s.or.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.oy\"");
 	}
 	void getOriginZ()const
 	{
-		fprintf(mFile,"\"%s.or.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.oz\"");
 	}
 	void getWeightedNode()const
 	{
-		fprintf(mFile,"\"%s.wn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn\"");
 	}
 protected:
 	ClusterHandle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
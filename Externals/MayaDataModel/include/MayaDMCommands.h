@@ -10,6 +10,8 @@
 #ifndef __MayaDM_COMMANDS_H__
 #define __MayaDM_COMMANDS_H__
 
+#include "MayaDMWriter.h"
+
 namespace MayaDM
 {
 	/** This command parents (moves) objects under a new group, removes
@@ -23,22 +25,22 @@ namespace MayaDM
 		bool relative = false, bool removeObject = false, bool shape = false, 
 		bool world = false ) 
 	{
-		fprintf ( file, "parent" );
+		writeString ( file, "parent" );
 
-		if ( absolute ) fprintf ( file, " -a" );
-		if ( addObject ) fprintf ( file, " -add" );
-		if ( noConnections ) fprintf ( file, " -nc" );
-		if ( relative ) fprintf ( file, " -r" );
-		if ( removeObject ) fprintf ( file, " -rm" );
-		if ( shape ) fprintf ( file, " -s" );
-		if ( world ) fprintf ( file, " -w" );
+		if ( absolute ) writeString ( file, " -a" );
+		if ( addObject ) writeString ( file, " -add" );
+		if ( noConnections ) writeString ( file, " -nc" );
+		if ( relative ) writeString ( file, " -r" );
+		if ( removeObject ) writeString ( file, " -rm" );
+		if ( shape ) writeString ( file, " -s" );
+		if ( world ) writeString ( file, " -w" );
 
-		fprintf ( file, " \"%s\"", childName.c_str () );
+		writeString ( file, " \"", childName.c_str (), "\"" );
 		if ( strcmp ( parentName.c_str (), "" ) != 0 )
 		{
-			fprintf ( file, " \"%s\"", parentName.c_str () );
+			writeString ( file, " \"", parentName.c_str (), "\"" );
 		}
-		fprintf ( file, ";\n" );
+		writeString ( file, ";\n" );
 	}
 	
 	/** This command parents (moves) shapes under a new group, removes
@@ -87,10 +89,11 @@ namespace MayaDM
         const std::string& flagName,
         const std::string& flagValue )
     {
-        fprintf ( file, "addAttr -ln \"%s\"", attributeName.c_str() );
-        fprintf ( file, " -%s \"%s\"", flagName.c_str (), flagValue.c_str () );
-        fprintf ( file, " %s", nodeName.c_str() );
-        fprintf ( file, ";\n" );
+        writeString ( file, "addAttr -ln \"", attributeName.c_str(), "\"" );
+        writeString ( file, " -", flagName.c_str () );
+        writeString ( file, " \"", flagValue.c_str (), "\"" );
+        writeString ( file, " ", nodeName.c_str() );
+        writeString ( file, ";\n" );
     }
 
     /**
@@ -107,15 +110,16 @@ namespace MayaDM
             std::cerr << "addAttr: file not valid! Can't add Attribute!" << std::endl;
             return false;
         }
-        fprintf ( file, "addAttr -ln \"%s\"", attributeName.c_str() );
+        writeString ( file, "addAttr -ln \"", attributeName.c_str(), "\"" );
 
+        writeString ( file, " -", attributeFlag.getFlagName ().c_str () );
         if ( attributeFlag.getQuotations () )
-            fprintf ( file, " -%s \"%s\"", attributeFlag.getFlagName ().c_str (), attributeFlag.getFlagValue ().c_str () );
+            writeString ( file, " \"", attributeFlag.getFlagValue ().c_str (), "\"" );
         else
-            fprintf ( file, " -%s %s", attributeFlag.getFlagName ().c_str (), attributeFlag.getFlagValue ().c_str () );
+            writeString ( file, " ", attributeFlag.getFlagValue ().c_str () );
 
-        fprintf ( file, " %s", nodeName.c_str() );
-        fprintf ( file, ";\n" );
+        writeString ( file, " ", nodeName.c_str() );
+        writeString ( file, ";\n" );
 
         return true;
     }
@@ -134,9 +138,10 @@ namespace MayaDM
             std::cerr << "addAttr: file not valid! Can't add Attribute!" << std::endl;
             return false;
         }
-        fprintf ( file, "\taddAttr -ln \"%s\"", attributeName.c_str() );
-        fprintf ( file, " -%s \"%s\"", flagName.c_str (), flagValue.c_str () );
-        fprintf ( file, ";\n" );
+        writeString ( file, "\taddAttr -ln \"", attributeName.c_str(), "\"" );
+        writeString ( file, " -", flagName.c_str () );
+        writeString ( file, " \"", flagValue.c_str (), "\"" );
+        writeString ( file, ";\n" );
 
         return true;
     }
@@ -154,14 +159,15 @@ namespace MayaDM
             std::cerr << "addAttr: file not valid! Can't add Attribute!" << std::endl;
             return false;
         }
-        fprintf ( file, "\taddAttr -ln \"%s\"", attributeName.c_str() );
+        writeString ( file, "\taddAttr -ln \"", attributeName.c_str(), "\"" );
 
+        writeString ( file, " -", attributeFlag.getFlagName ().c_str () );
         if ( attributeFlag.getQuotations () )
-            fprintf ( file, " -%s \"%s\"", attributeFlag.getFlagName ().c_str (), attributeFlag.getFlagValue ().c_str () );
+            writeString ( file, " \"", attributeFlag.getFlagValue ().c_str (), "\"" );
         else
-            fprintf ( file, " -%s %s", attributeFlag.getFlagName ().c_str (), attributeFlag.getFlagValue ().c_str () );
+            writeString ( file, " ", attributeFlag.getFlagValue ().c_str () );
 
-        fprintf ( file, ";\n" );
+        writeString ( file, ";\n" );
 
         return true;
     }
@@ -179,15 +185,16 @@ namespace MayaDM
             std::cerr << "addAttr: file not valid! Can't add Attribute!" << std::endl;
             return false;
         }
-        fprintf ( file, "\taddAttr -ln \"%s\"", attributeName.c_str() );
+        writeString ( file, "\taddAttr -ln \"", attributeName.c_str(), "\"" );
         for ( size_t i=0; i<attributeFlags.size (); ++i )
         {
+            writeString ( file, " -", attributeFlags[i].getFlagName ().c_str () );
             if ( attributeFlags[i].getQuotations () == false )
-                fprintf ( file, " -%s %s", attributeFlags[i].getFlagName ().c_str (), attributeFlags[i].getFlagValue ().c_str () );
+                writeString ( file, " ", attributeFlags[i].getFlagValue ().c_str () );
             else
-                fprintf ( file, " -%s \"%s\"", attributeFlags[i].getFlagName ().c_str (), attributeFlags[i].getFlagValue ().c_str () );
+                writeString ( file, " \"", attributeFlags[i].getFlagValue ().c_str (), "\"" );
         }
-        fprintf ( file, ";\n" );
+        writeString ( file, ";\n" );
 
         return true;
     }
@@ -203,11 +210,13 @@ namespace MayaDM
         const std::string& flagValue, 
         const std::string& attributeValue )
     {
-        fprintf ( file, "setAttr %s.%s", nodeName.c_str(), attributeName.c_str() );
-        fprintf ( file, " -%s \"%s\"", flagName.c_str (), flagValue.c_str () );
+        writeString ( file, "setAttr ", nodeName.c_str() );
+        writeString ( file, ".", attributeName.c_str() );
+        writeString ( file, " -", flagName.c_str () );
+        writeString ( file, " \"", flagValue.c_str (), "\"" );
         if ( strcmp ( attributeValue.c_str(), "" ) != 0 )
-            fprintf ( file, " \"%s\"", attributeValue.c_str() );
-        fprintf ( file, ";\n" );
+            writeString ( file, " \"", attributeValue.c_str(), "\"" );
+        writeString ( file, ";\n" );
     }
 
     /**
@@ -220,11 +229,12 @@ namespace MayaDM
         const std::string& flagValue, 
         const std::string& attributeValue )
     {
-        fprintf ( file, "\tsetAttr .%s", attributeName.c_str() );
-        fprintf ( file, " -%s \"%s\"", flagName.c_str (), flagValue.c_str () );
+        writeString ( file, "\tsetAttr .", attributeName.c_str() );
+        writeString ( file, " -", flagName.c_str () );
+        writeString ( file, " \"", flagValue.c_str (), "\"" );
         if ( strcmp ( attributeValue.c_str(), "" ) != 0 )
-            fprintf ( file, " \"%s\"", attributeValue.c_str() );
-        fprintf ( file, ";\n" );
+            writeString ( file, " \"", attributeValue.c_str(), "\"" );
+        writeString ( file, ";\n" );
     }
 
     /**
@@ -236,17 +246,18 @@ namespace MayaDM
         const std::vector<AttributeFlag>& attributeFlags, 
         const std::string& attributeValue )
     {
-        fprintf ( file, "\tsetAttr .%s", attributeName.c_str() );
+        writeString ( file, "\tsetAttr .", attributeName.c_str() );
         for ( size_t i=0; i<attributeFlags.size (); ++i )
         {
+            writeString ( file, " -", attributeFlags[i].getFlagName ().c_str () );
             if ( attributeFlags[i].getQuotations () == false )
-                fprintf ( file, " -%s %s", attributeFlags[i].getFlagName ().c_str (), attributeFlags[i].getFlagValue ().c_str () );
+                writeString ( file, " ", attributeFlags[i].getFlagValue ().c_str () );
             else
-                fprintf ( file, " -%s \"%s\"", attributeFlags[i].getFlagName ().c_str (), attributeFlags[i].getFlagValue ().c_str () );
+                writeString ( file, " \"", attributeFlags[i].getFlagValue ().c_str (), "\"" );
         }
         if ( strcmp ( attributeValue.c_str(), "" ) != 0 )
-            fprintf ( file, " \"%s\"", attributeValue.c_str() );
-        fprintf ( file, ";\n" );
+            writeString ( file, " \"", attributeValue.c_str(), "\"" );
+        writeString ( file, ";\n" );
     }
 
     static void setAttr ( 
@@ -256,23 +267,27 @@ namespace MayaDM
         const bool flagValue, 
         const std::string& attributeValue )
     {
-        fprintf ( file, "\tsetAttr .%s", attributeName.c_str() );
-        fprintf ( file, " -%s %i", flagName.c_str (), flagValue );
+        writeString ( file, "\tsetAttr .", attributeName.c_str() );
+        writeString ( file, " -", flagName.c_str () );
+        writeInt ( file, " ", flagValue );
         if ( strcmp ( attributeValue.c_str(), "" ) != 0 )
-            fprintf ( file, " \"%s\"", attributeValue.c_str() );
-        fprintf ( file, ";\n" );
+            writeString ( file, " \"", attributeValue.c_str(), "\"" );
+        writeString ( file, ";\n" );
     }
 
     static void startSetAttr ( FILE* file, std::string attributeName, std::string nodeName )
     {
         if ( strcmp ( nodeName.c_str(), "" ) == 0 )
-            fprintf ( file, "\tsetAttr .%s", attributeName.c_str() );
+            writeString ( file, "\tsetAttr .", attributeName.c_str() );
         else
-            fprintf ( file, "setAttr %s.%s", nodeName.c_str(), attributeName.c_str() );
+        {
+            writeString ( file, "setAttr ", nodeName.c_str() );
+            writeString ( file, ".", attributeName.c_str() );
+        }
     }
     static void endSetAttr ( FILE* file )
     {
-        fprintf ( file, ";\n" );
+        writeString ( file, ";\n" );
     }
 
     /**
@@ -304,11 +319,11 @@ namespace MayaDM
      */
     #define mayaSelect(file, objName, noExpand) \
     {                                           \
-        fprintf(file, "select ");               \
+        MayaDM::writeString(file, "select ");               \
         if ( noExpand )                         \
-            fprintf(file, "-noExpand ");        \
-        fprintf(file, "%s", objName.c_str());   \
-        fprintf(file, ";\n");                   \
+            MayaDM::writeString(file, "-noExpand ");        \
+        MayaDM::writeString(file, objName.c_str());   \
+        MayaDM::writeString(file, ";\n");                   \
     }
 
     /**
@@ -319,10 +334,10 @@ namespace MayaDM
     */
     static void editCameraAspectRatio(FILE* file, const std::string& name, const double aspectRatio)
     {                                           
-        fprintf(file,"camera -e");
-        fprintf(file, " -ar %f", aspectRatio);
-        fprintf(file, " %s", name.c_str());
-        fprintf(file, ";\n");
+        writeString(file,"camera -e");
+        writeFloat(file," -ar ",aspectRatio);
+        writeString(file," ",name.c_str());
+        writeString(file,";\n");
     }
 
     /**
@@ -334,10 +349,10 @@ namespace MayaDM
     static void editCameraHorizontalFieldOfView(FILE* file, const std::string& name, 
         const double horizontalFieldOfView)
     {                                           
-        fprintf(file,"camera -e");
-        fprintf(file, " -hfv %f", horizontalFieldOfView);
-        fprintf(file, " %s", name.c_str());
-        fprintf(file, ";\n");
+        writeString(file,"camera -e");
+        writeFloat(file," -hfv ",horizontalFieldOfView);
+        writeString(file," ",name.c_str());
+        writeString(file,";\n");
     }
 
     /**
@@ -349,10 +364,10 @@ namespace MayaDM
     static void editCameraVerticalFieldOfView(FILE* file, const std::string& name, 
         const double verticalFieldOfView)
     {                                           
-        fprintf(file,"camera -e");
-        fprintf(file, " -vfv %f", verticalFieldOfView);
-        fprintf(file, " %s", name.c_str());
-        fprintf(file, ";\n");
+        writeString(file,"camera -e");
+        writeFloat(file," -vfv ",verticalFieldOfView);
+        writeString(file," ",name.c_str());
+        writeString(file,";\n");
     }
 
     /**
@@ -364,10 +379,10 @@ namespace MayaDM
     static void editCameraOrthographicWidth(FILE* file, const std::string& name, 
         const double orthographicWidth)
     {                                           
-        fprintf(file,"camera -e");
-        fprintf(file, " -ow %f", orthographicWidth);
-        fprintf(file, " %s", name.c_str());
-        fprintf(file, ";\n");
+        writeString(file,"camera -e");
+        writeFloat(file," -ow ",orthographicWidth);
+        writeString(file," ",name.c_str());
+        writeString(file,";\n");
     }
 
 }
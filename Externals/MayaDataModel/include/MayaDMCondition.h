@@ -27,121 +27,121 @@ public:
 	void setOperation(unsigned int op)
 	{
 		if(op == 0) return;
-		fprintf(mFile,"\tsetAttr \".op\" %i;\n", op);
+		writeInt(mFile,"\tsetAttr \".op\" ",op,";\n");
 	}
 	void setFirstTerm(float ft)
 	{
 		if(ft == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %f;\n", ft);
+		writeFloat(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setSecondTerm(float st)
 	{
 		if(st == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".st\" %f;\n", st);
+		writeFloat(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void setColorIfTrue(const float3& ct)
 	{
 		if(ct == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ct\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ct\" -type \"float3\" ");
 		ct.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorIfTrueR(float ctr)
 	{
 		if(ctr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ct.ctr\" %f;\n", ctr);
+		writeFloat(mFile,"\tsetAttr \".ct.ctr\" ",ctr,";\n");
 	}
 	void setColorIfTrueG(float ctg)
 	{
 		if(ctg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ct.ctg\" %f;\n", ctg);
+		writeFloat(mFile,"\tsetAttr \".ct.ctg\" ",ctg,";\n");
 	}
 	void setColorIfTrueB(float ctb)
 	{
 		if(ctb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ct.ctb\" %f;\n", ctb);
+		writeFloat(mFile,"\tsetAttr \".ct.ctb\" ",ctb,";\n");
 	}
 	void setColorIfFalse(const float3& cf)
 	{
 		if(cf == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".cf\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cf\" -type \"float3\" ");
 		cf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorIfFalseR(float cfr)
 	{
 		if(cfr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cf.cfr\" %f;\n", cfr);
+		writeFloat(mFile,"\tsetAttr \".cf.cfr\" ",cfr,";\n");
 	}
 	void setColorIfFalseG(float cfg)
 	{
 		if(cfg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cf.cfg\" %f;\n", cfg);
+		writeFloat(mFile,"\tsetAttr \".cf.cfg\" ",cfg,";\n");
 	}
 	void setColorIfFalseB(float cfb)
 	{
 		if(cfb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cf.cfb\" %f;\n", cfb);
+		writeFloat(mFile,"\tsetAttr \".cf.cfb\" ",cfb,";\n");
 	}
 	void getOperation()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getFirstTerm()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getSecondTerm()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getColorIfTrue()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getColorIfTrueR()const
 	{
-		fprintf(mFile,"\"%s.ct.ctr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctr\"");
 	}
 	void getColorIfTrueG()const
 	{
-		fprintf(mFile,"\"%s.ct.ctg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctg\"");
 	}
 	void getColorIfTrueB()const
 	{
-		fprintf(mFile,"\"%s.ct.ctb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctb\"");
 	}
 	void getColorIfFalse()const
 	{
-		fprintf(mFile,"\"%s.cf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cf\"");
 	}
 	void getColorIfFalseR()const
 	{
-		fprintf(mFile,"\"%s.cf.cfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cf.cfr\"");
 	}
 	void getColorIfFalseG()const
 	{
-		fprintf(mFile,"\"%s.cf.cfg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cf.cfg\"");
 	}
 	void getColorIfFalseB()const
 	{
-		fprintf(mFile,"\"%s.cf.cfb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cf.cfb\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 protected:
 	Condition(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
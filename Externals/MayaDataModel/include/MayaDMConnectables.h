@@ -9,6 +9,7 @@
 */
 #ifndef __MayaDM_CONNECTABLES_H__
 #define __MayaDM_CONNECTABLES_H__
+#include "MayaDMWriter.h"
 namespace MayaDM
 {
 enum ConnectableType
@@ -367,20 +368,20 @@ enum ConnectableType
 	CT_WTMATRIX};
 /** Macro to connect compatible attributes.*/
     #define connectAttr(file, src, dst) {   		\
-    fprintf(file, "connectAttr ");      		\
+    MayaDM::writeString(file, "connectAttr ");      		\
     src;                                			\
-    fprintf(file, " ");                 		\
+    MayaDM::writeString(file, " ");                 		\
     dst;                                			\
-    fprintf(file, ";\n"); }
+    MayaDM::writeString(file, ";\n"); }
 
 /** Macro to connect compatible attributes.*/
     #define connectNextAttr(file, src, dst) {   \
-    fprintf(file, "connectAttr ");      		\
+    MayaDM::writeString(file, "connectAttr ");      		\
     src;                                		\
-    fprintf(file, " ");                 		\
+    MayaDM::writeString(file, " ");                 		\
     dst;                                		\
-    fprintf(file, " -na"); 		\
-    fprintf(file, ";\n"); }
+    MayaDM::writeString(file, " -na"); 		\
+    MayaDM::writeString(file, ";\n"); }
 
 }//namespace MayaDM
 #endif//__MayaDM_CONNECTABLES_H__
@@ -27,20 +27,20 @@ public:
 	void setEnableRestPosition(bool erp)
 	{
 		if(erp == false) return;
-		fprintf(mFile,"\tsetAttr \".erp\" %i;\n", erp);
+		writeInt(mFile,"\tsetAttr \".erp\" ",erp,";\n");
 	}
 	void setLockOutput(bool lo)
 	{
 		if(lo == false) return;
-		fprintf(mFile,"\tsetAttr \".lo\" %i;\n", lo);
+		writeInt(mFile,"\tsetAttr \".lo\" ",lo,";\n");
 	}
 	void getEnableRestPosition()const
 	{
-		fprintf(mFile,"\"%s.erp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".erp\"");
 	}
 	void getLockOutput()const
 	{
-		fprintf(mFile,"\"%s.lo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lo\"");
 	}
 protected:
 	Constraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,15 +27,15 @@ public:
 	void setIsCollapsed(bool isc)
 	{
 		if(isc == false) return;
-		fprintf(mFile,"\tsetAttr \".isc\" %i;\n", isc);
+		writeInt(mFile,"\tsetAttr \".isc\" ",isc,";\n");
 	}
 	void getHyperLayout()const
 	{
-		fprintf(mFile,"\"%s.hl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hl\"");
 	}
 	void getIsCollapsed()const
 	{
-		fprintf(mFile,"\"%s.isc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isc\"");
 	}
 protected:
 	Container(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
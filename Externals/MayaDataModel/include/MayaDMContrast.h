@@ -27,132 +27,132 @@ public:
 	void setValue(const float3& v)
 	{
 		if(v == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".v\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".v\" -type \"float3\" ");
 		v.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setValueX(float vx)
 	{
 		if(vx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vx\" %f;\n", vx);
+		writeFloat(mFile,"\tsetAttr \".v.vx\" ",vx,";\n");
 	}
 	void setValueY(float vy)
 	{
 		if(vy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vy\" %f;\n", vy);
+		writeFloat(mFile,"\tsetAttr \".v.vy\" ",vy,";\n");
 	}
 	void setValueZ(float vz)
 	{
 		if(vz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vz\" %f;\n", vz);
+		writeFloat(mFile,"\tsetAttr \".v.vz\" ",vz,";\n");
 	}
 	void setContrast(const float3& c)
 	{
 		if(c == float3(2.0f,2.0f,2.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setContrastX(float cx)
 	{
 		if(cx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cx\" %f;\n", cx);
+		writeFloat(mFile,"\tsetAttr \".c.cx\" ",cx,";\n");
 	}
 	void setContrastY(float cy)
 	{
 		if(cy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cy\" %f;\n", cy);
+		writeFloat(mFile,"\tsetAttr \".c.cy\" ",cy,";\n");
 	}
 	void setContrastZ(float cz)
 	{
 		if(cz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cz\" %f;\n", cz);
+		writeFloat(mFile,"\tsetAttr \".c.cz\" ",cz,";\n");
 	}
 	void setBias(const float3& b)
 	{
 		if(b == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".b\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".b\" -type \"float3\" ");
 		b.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBiasX(float bx)
 	{
 		if(bx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".b.bx\" %f;\n", bx);
+		writeFloat(mFile,"\tsetAttr \".b.bx\" ",bx,";\n");
 	}
 	void setBiasY(float by)
 	{
 		if(by == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".b.by\" %f;\n", by);
+		writeFloat(mFile,"\tsetAttr \".b.by\" ",by,";\n");
 	}
 	void setBiasZ(float bz)
 	{
 		if(bz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".b.bz\" %f;\n", bz);
+		writeFloat(mFile,"\tsetAttr \".b.bz\" ",bz,";\n");
 	}
 	void getValue()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getValueX()const
 	{
-		fprintf(mFile,"\"%s.v.vx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vx\"");
 	}
 	void getValueY()const
 	{
-		fprintf(mFile,"\"%s.v.vy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vy\"");
 	}
 	void getValueZ()const
 	{
-		fprintf(mFile,"\"%s.v.vz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vz\"");
 	}
 	void getContrast()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getContrastX()const
 	{
-		fprintf(mFile,"\"%s.c.cx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cx\"");
 	}
 	void getContrastY()const
 	{
-		fprintf(mFile,"\"%s.c.cy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cy\"");
 	}
 	void getContrastZ()const
 	{
-		fprintf(mFile,"\"%s.c.cz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cz\"");
 	}
 	void getBias()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getBiasX()const
 	{
-		fprintf(mFile,"\"%s.b.bx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.bx\"");
 	}
 	void getBiasY()const
 	{
-		fprintf(mFile,"\"%s.b.by\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.by\"");
 	}
 	void getBiasZ()const
 	{
-		fprintf(mFile,"\"%s.b.bz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.bz\"");
 	}
 	void getOutValue()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutValueX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutValueY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutValueZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 protected:
 	Contrast(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
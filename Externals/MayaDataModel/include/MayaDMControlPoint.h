@@ -24,12 +24,12 @@ public:
 		void write(FILE* file) const
 		{
 			uvSetName.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			for (size_t i = 0; i<nbUvSetPoints; ++i)
 			{
 				uvSetPoints[i].write(file);
-				fprintf(file, " ");
-				if (i + 1<nbUvSetPoints) fprintf(file, " ");
+				writeString(file," ");
+				if (i + 1<nbUvSetPoints) writeString(file," ");
 			}
 		}
 	};
@@ -44,23 +44,23 @@ public:
 			float colorSetPointsA;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%f ", colorSetPointsR);
-				fprintf(file,"%f ", colorSetPointsG);
-				fprintf(file,"%f ", colorSetPointsB);
-				fprintf(file,"%f", colorSetPointsA);
+				writeFloat(file,"",colorSetPointsR," ");
+				writeFloat(file,"",colorSetPointsG," ");
+				writeFloat(file,"",colorSetPointsB," ");
+				writeFloat(file,"",colorSetPointsA);
 			}
 		}* colorSetPoints;
 		size_t nbColorSetPoints;
 		void write(FILE* file) const
 		{
 			colorName.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", clamped);
-			fprintf(file,"%i ", representation);
+			writeString(file," ");
+			writeInt(file,"",clamped," ");
+			writeInt(file,"",representation," ");
 			for (size_t i = 0; i<nbColorSetPoints; ++i)
 			{
 				colorSetPoints[i].write(file);
-				if (i + 1<nbColorSetPoints) fprintf(file, " ");
+				if (i + 1<nbColorSetPoints) writeString(file," ");
 			}
 		}
 	};
@@ -74,488 +74,488 @@ public:
 	void setTweak(bool tw)
 	{
 		if(tw == false) return;
-		fprintf(mFile,"\tsetAttr \".tw\" %i;\n", tw);
+		writeInt(mFile,"\tsetAttr \".tw\" ",tw,";\n");
 	}
 	void setRelativeTweak(bool rtw)
 	{
 		if(rtw == true) return;
-		fprintf(mFile,"\tsetAttr \".rtw\" %i;\n", rtw);
+		writeInt(mFile,"\tsetAttr \".rtw\" ",rtw,";\n");
 	}
 	void setControlPoints(size_t cp_i,const double3& cp)
 	{
-		fprintf(mFile,"\tsetAttr \".cp[%i]\" -type \"double3\" ",cp_i);
+		writeInt(mFile,"\tsetAttr \".cp[",cp_i,"]\" -type \"double3\" ");
 		cp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setControlPoints(size_t cp_start,size_t cp_end,double* cp)
 	{
-		fprintf(mFile,"\tsetAttr \".cp[%i:%i]\" ", cp_start,cp_end);
+		writeInt(mFile,"\tsetAttr \".cp[",cp_start); writeInt(mFile,":",cp_end,"]\" ");
 		size_t size = (cp_end-cp_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",cp[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startControlPoints(size_t cp_start,size_t cp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cp[%i:%i]\"",cp_start,cp_end);
+		writeInt(mFile,"\tsetAttr \".cp[",cp_start); writeInt(mFile,":",cp_end,"]\"");
 	}
 	void appendControlPoints(double cp)const
 	{
-		fprintf(mFile," %f",cp);
+		writeFloat(mFile," ",cp);
 	}
 	void endControlPoints()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setXValue(size_t cp_i,double xv)
 	{
 		if(xv == 0) return;
-		fprintf(mFile,"\tsetAttr \".cp[%i].xv\" %f;\n", cp_i,xv);
+		writeInt(mFile,"\tsetAttr \".cp[",cp_i); writeFloat(mFile,"].xv\" ",xv,";\n");
 	}
 	void setYValue(size_t cp_i,double yv)
 	{
 		if(yv == 0) return;
-		fprintf(mFile,"\tsetAttr \".cp[%i].yv\" %f;\n", cp_i,yv);
+		writeInt(mFile,"\tsetAttr \".cp[",cp_i); writeFloat(mFile,"].yv\" ",yv,";\n");
 	}
 	void setZValue(size_t cp_i,double zv)
 	{
 		if(zv == 0) return;
-		fprintf(mFile,"\tsetAttr \".cp[%i].zv\" %f;\n", cp_i,zv);
+		writeInt(mFile,"\tsetAttr \".cp[",cp_i); writeFloat(mFile,"].zv\" ",zv,";\n");
 	}
 	void setUvSet(size_t uvst_i,const UvSet& uvst)
 	{
-		fprintf(mFile,"\tsetAttr \".uvst[%i]\" ",uvst_i);
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_i,"]\" ");
 		uvst.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvSet(size_t uvst_start,size_t uvst_end,UvSet* uvst)
 	{
-		fprintf(mFile,"\tsetAttr \".uvst[%i:%i]\" ", uvst_start,uvst_end);
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_start); writeInt(mFile,":",uvst_end,"]\" ");
 		size_t size = (uvst_end-uvst_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			uvst[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startUvSet(size_t uvst_start,size_t uvst_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".uvst[%i:%i]\"",uvst_start,uvst_end);
-		fprintf(mFile," -type \"UvSet\" ");
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_start); writeInt(mFile,":",uvst_end,"]\"");
+		writeString(mFile," -type \"UvSet\" ");
 	}
 	void appendUvSet(const UvSet& uvst)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		uvst.write(mFile);
 	}
 	void endUvSet()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvSetName(size_t uvst_i,const string& uvsn)
 	{
 		if(uvsn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvst[%i].uvsn\" -type \"string\" ",uvst_i);
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_i,"].uvsn\" -type \"string\" ");
 		uvsn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvSetPoints(size_t uvst_i,size_t uvsp_i,const float2& uvsp)
 	{
-		fprintf(mFile,"\tsetAttr \".uvst[%i].uvsp[%i]\" -type \"float2\" ",uvst_i,uvsp_i);
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_i); writeInt(mFile,"].uvsp[",uvsp_i,"]\" -type \"float2\" ");
 		uvsp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvSetPoints(size_t uvst_i,size_t uvsp_start,size_t uvsp_end,float* uvsp)
 	{
-		fprintf(mFile,"\tsetAttr \".uvst[%i].uvsp[%i:%i]\" ", uvst_i,uvsp_start,uvsp_end);
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_i); writeInt(mFile,"].uvsp[",uvsp_start); writeInt(mFile,":",uvsp_end,"]\" ");
 		size_t size = (uvsp_end-uvsp_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uvsp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",uvsp[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startUvSetPoints(size_t uvst_i,size_t uvsp_start,size_t uvsp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".uvst[%i].uvsp[%i:%i]\"",uvst_i,uvsp_start,uvsp_end);
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_i); writeInt(mFile,"].uvsp[",uvsp_start); writeInt(mFile,":",uvsp_end,"]\"");
 	}
 	void appendUvSetPoints(float uvsp)const
 	{
-		fprintf(mFile," %f",uvsp);
+		writeFloat(mFile," ",uvsp);
 	}
 	void endUvSetPoints()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvSetPointsU(size_t uvst_i,size_t uvsp_i,float uvpu)
 	{
 		if(uvpu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uvst[%i].uvsp[%i].uvpu\" %f;\n", uvst_i,uvsp_i,uvpu);
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_i); writeInt(mFile,"].uvsp[",uvsp_i); writeFloat(mFile,"].uvpu\" ",uvpu,";\n");
 	}
 	void setUvSetPointsV(size_t uvst_i,size_t uvsp_i,float uvpv)
 	{
 		if(uvpv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uvst[%i].uvsp[%i].uvpv\" %f;\n", uvst_i,uvsp_i,uvpv);
+		writeInt(mFile,"\tsetAttr \".uvst[",uvst_i); writeInt(mFile,"].uvsp[",uvsp_i); writeFloat(mFile,"].uvpv\" ",uvpv,";\n");
 	}
 	void setCurrentUVSet(const string& cuvs)
 	{
 		if(cuvs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cuvs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cuvs\" -type \"string\" ");
 		cuvs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplayImmediate(bool di)
 	{
 		if(di == false) return;
-		fprintf(mFile,"\tsetAttr \".di\" %i;\n", di);
+		writeInt(mFile,"\tsetAttr \".di\" ",di,";\n");
 	}
 	void setDisplayColors(bool dcol)
 	{
 		if(dcol == false) return;
-		fprintf(mFile,"\tsetAttr \".dcol\" %i;\n", dcol);
+		writeInt(mFile,"\tsetAttr \".dcol\" ",dcol,";\n");
 	}
 	void setDisplayColorChannel(const string& dcc)
 	{
 		if(dcc == "color") return;
-		fprintf(mFile,"\tsetAttr \".dcc\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".dcc\" -type \"string\" ");
 		dcc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCurrentColorSet(const string& ccls)
 	{
 		if(ccls == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ccls\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ccls\" -type \"string\" ");
 		ccls.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorSet(size_t clst_i,const ColorSet& clst)
 	{
-		fprintf(mFile,"\tsetAttr \".clst[%i]\" ",clst_i);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i,"]\" ");
 		clst.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorSet(size_t clst_start,size_t clst_end,ColorSet* clst)
 	{
-		fprintf(mFile,"\tsetAttr \".clst[%i:%i]\" ", clst_start,clst_end);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_start); writeInt(mFile,":",clst_end,"]\" ");
 		size_t size = (clst_end-clst_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			clst[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColorSet(size_t clst_start,size_t clst_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".clst[%i:%i]\"",clst_start,clst_end);
-		fprintf(mFile," -type \"ColorSet\" ");
+		writeInt(mFile,"\tsetAttr \".clst[",clst_start); writeInt(mFile,":",clst_end,"]\"");
+		writeString(mFile," -type \"ColorSet\" ");
 	}
 	void appendColorSet(const ColorSet& clst)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		clst.write(mFile);
 	}
 	void endColorSet()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorName(size_t clst_i,const string& clsn)
 	{
 		if(clsn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".clst[%i].clsn\" -type \"string\" ",clst_i);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i,"].clsn\" -type \"string\" ");
 		clsn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClamped(size_t clst_i,bool clam)
 	{
 		if(clam == false) return;
-		fprintf(mFile,"\tsetAttr \".clst[%i].clam\" %i;\n", clst_i,clam);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].clam\" ",clam,";\n");
 	}
 	void setRepresentation(size_t clst_i,unsigned int rprt)
 	{
 		if(rprt == 2) return;
-		fprintf(mFile,"\tsetAttr \".clst[%i].rprt\" %i;\n", clst_i,rprt);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].rprt\" ",rprt,";\n");
 	}
 	void setColorSetPoints(size_t clst_i,size_t clsp_i,const ColorSet::ColorSetPoints& clsp)
 	{
-		fprintf(mFile,"\tsetAttr \".clst[%i].clsp[%i]\" ",clst_i,clsp_i);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i,"]\" ");
 		clsp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorSetPoints(size_t clst_i,size_t clsp_start,size_t clsp_end,ColorSet::ColorSetPoints* clsp)
 	{
-		fprintf(mFile,"\tsetAttr \".clst[%i].clsp[%i:%i]\" ", clst_i,clsp_start,clsp_end);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_start); writeInt(mFile,":",clsp_end,"]\" ");
 		size_t size = (clsp_end-clsp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			clsp[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColorSetPoints(size_t clst_i,size_t clsp_start,size_t clsp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".clst[%i].clsp[%i:%i]\"",clst_i,clsp_start,clsp_end);
-		fprintf(mFile," -type \"ColorSet::ColorSetPoints\" ");
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_start); writeInt(mFile,":",clsp_end,"]\"");
+		writeString(mFile," -type \"ColorSet::ColorSetPoints\" ");
 	}
 	void appendColorSetPoints(const ColorSet::ColorSetPoints& clsp)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		clsp.write(mFile);
 	}
     void appendColorSetPoints(float clsp)
     {
-        fprintf(mFile," %f",clsp);
+        writeFloat(mFile," ",clsp);
     }
 	void endColorSetPoints()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorSetPointsR(size_t clst_i,size_t clsp_i,float clpr)
 	{
 		if(clpr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clst[%i].clsp[%i].clpr\" %f;\n", clst_i,clsp_i,clpr);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i); writeFloat(mFile,"].clpr\" ",clpr,";\n");
 	}
 	void setColorSetPointsG(size_t clst_i,size_t clsp_i,float clpg)
 	{
 		if(clpg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clst[%i].clsp[%i].clpg\" %f;\n", clst_i,clsp_i,clpg);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i); writeFloat(mFile,"].clpg\" ",clpg,";\n");
 	}
 	void setColorSetPointsB(size_t clst_i,size_t clsp_i,float clpb)
 	{
 		if(clpb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clst[%i].clsp[%i].clpb\" %f;\n", clst_i,clsp_i,clpb);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i); writeFloat(mFile,"].clpb\" ",clpb,";\n");
 	}
 	void setColorSetPointsA(size_t clst_i,size_t clsp_i,float clpa)
 	{
 		if(clpa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clst[%i].clsp[%i].clpa\" %f;\n", clst_i,clsp_i,clpa);
+		writeInt(mFile,"\tsetAttr \".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i); writeFloat(mFile,"].clpa\" ",clpa,";\n");
 	}
 	void getTweak()const
 	{
-		fprintf(mFile,"\"%s.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tw\"");
 	}
 	void getRelativeTweak()const
 	{
-		fprintf(mFile,"\"%s.rtw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtw\"");
 	}
 	void getControlPoints(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i]\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"]\"");
 	}
 	void getControlPoints()const
 	{
 
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getXValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].xv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].xv\"");
 	}
 	void getXValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.xv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.xv\"");
 	}
 	void getYValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].yv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].yv\"");
 	}
 	void getYValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.yv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.yv\"");
 	}
 	void getZValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].zv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].zv\"");
 	}
 	void getZValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.zv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.zv\"");
 	}
 	void getWeights(size_t wt_i)const
 	{
-		fprintf(mFile,"\"%s.wt[%i]\"",mName.c_str(),wt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wt[",wt_i,"]\"");
 	}
 	void getWeights()const
 	{
 
-		fprintf(mFile,"\"%s.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wt\"");
 	}
 	void getTweakLocation()const
 	{
-		fprintf(mFile,"\"%s.twl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twl\"");
 	}
 	void getBlindDataNodes(size_t bn_i)const
 	{
-		fprintf(mFile,"\"%s.bn[%i]\"",mName.c_str(),bn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".bn[",bn_i,"]\"");
 	}
 	void getBlindDataNodes()const
 	{
 
-		fprintf(mFile,"\"%s.bn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bn\"");
 	}
 	void getUvSet(size_t uvst_i)const
 	{
-		fprintf(mFile,"\"%s.uvst[%i]\"",mName.c_str(),uvst_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst[",uvst_i,"]\"");
 	}
 	void getUvSet()const
 	{
 
-		fprintf(mFile,"\"%s.uvst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvst\"");
 	}
 	void getUvSetName(size_t uvst_i)const
 	{
-		fprintf(mFile,"\"%s.uvst[%i].uvsn\"",mName.c_str(),uvst_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst[",uvst_i,"].uvsn\"");
 	}
 	void getUvSetName()const
 	{
 
-		fprintf(mFile,"\"%s.uvst.uvsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvst.uvsn\"");
 	}
 	void getUvSetPoints(size_t uvst_i,size_t uvsp_i)const
 	{
-		fprintf(mFile,"\"%s.uvst[%i].uvsp[%i]\"",mName.c_str(),uvst_i,uvsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst[",uvst_i); writeInt(mFile,"].uvsp[",uvsp_i,"]\"");
 	}
 	void getUvSetPoints(size_t uvsp_i)const
 	{
 
-		fprintf(mFile,"\"%s.uvst.uvsp[%i]\"",mName.c_str(),uvsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst.uvsp[",uvsp_i,"]\"");
 	}
 	void getUvSetPointsU(size_t uvst_i,size_t uvsp_i)const
 	{
-		fprintf(mFile,"\"%s.uvst[%i].uvsp[%i].uvpu\"",mName.c_str(),uvst_i,uvsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst[",uvst_i); writeInt(mFile,"].uvsp[",uvsp_i,"].uvpu\"");
 	}
 	void getUvSetPointsU(size_t uvsp_i)const
 	{
 
-		fprintf(mFile,"\"%s.uvst.uvsp[%i].uvpu\"",mName.c_str(),uvsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst.uvsp[",uvsp_i,"].uvpu\"");
 	}
 	void getUvSetPointsV(size_t uvst_i,size_t uvsp_i)const
 	{
-		fprintf(mFile,"\"%s.uvst[%i].uvsp[%i].uvpv\"",mName.c_str(),uvst_i,uvsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst[",uvst_i); writeInt(mFile,"].uvsp[",uvsp_i,"].uvpv\"");
 	}
 	void getUvSetPointsV(size_t uvsp_i)const
 	{
 
-		fprintf(mFile,"\"%s.uvst.uvsp[%i].uvpv\"",mName.c_str(),uvsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst.uvsp[",uvsp_i,"].uvpv\"");
 	}
 	void getUvSetTweakLocation(size_t uvst_i)const
 	{
-		fprintf(mFile,"\"%s.uvst[%i].uvtw\"",mName.c_str(),uvst_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvst[",uvst_i,"].uvtw\"");
 	}
 	void getUvSetTweakLocation()const
 	{
 
-		fprintf(mFile,"\"%s.uvst.uvtw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvst.uvtw\"");
 	}
 	void getCurrentUVSet()const
 	{
-		fprintf(mFile,"\"%s.cuvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cuvs\"");
 	}
 	void getDisplayImmediate()const
 	{
-		fprintf(mFile,"\"%s.di\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di\"");
 	}
 	void getDisplayColors()const
 	{
-		fprintf(mFile,"\"%s.dcol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcol\"");
 	}
 	void getDisplayColorChannel()const
 	{
-		fprintf(mFile,"\"%s.dcc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcc\"");
 	}
 	void getCurrentColorSet()const
 	{
-		fprintf(mFile,"\"%s.ccls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccls\"");
 	}
 	void getColorSet(size_t clst_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i]\"",mName.c_str(),clst_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i,"]\"");
 	}
 	void getColorSet()const
 	{
 
-		fprintf(mFile,"\"%s.clst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clst\"");
 	}
 	void getColorName(size_t clst_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i].clsn\"",mName.c_str(),clst_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i,"].clsn\"");
 	}
 	void getColorName()const
 	{
 
-		fprintf(mFile,"\"%s.clst.clsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clst.clsn\"");
 	}
 	void getClamped(size_t clst_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i].clam\"",mName.c_str(),clst_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i,"].clam\"");
 	}
 	void getClamped()const
 	{
 
-		fprintf(mFile,"\"%s.clst.clam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clst.clam\"");
 	}
 	void getRepresentation(size_t clst_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i].rprt\"",mName.c_str(),clst_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i,"].rprt\"");
 	}
 	void getRepresentation()const
 	{
 
-		fprintf(mFile,"\"%s.clst.rprt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clst.rprt\"");
 	}
 	void getColorSetPoints(size_t clst_i,size_t clsp_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i].clsp[%i]\"",mName.c_str(),clst_i,clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i,"]\"");
 	}
 	void getColorSetPoints(size_t clsp_i)const
 	{
 
-		fprintf(mFile,"\"%s.clst.clsp[%i]\"",mName.c_str(),clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst.clsp[",clsp_i,"]\"");
 	}
 	void getColorSetPointsR(size_t clst_i,size_t clsp_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i].clsp[%i].clpr\"",mName.c_str(),clst_i,clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i,"].clpr\"");
 	}
 	void getColorSetPointsR(size_t clsp_i)const
 	{
 
-		fprintf(mFile,"\"%s.clst.clsp[%i].clpr\"",mName.c_str(),clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst.clsp[",clsp_i,"].clpr\"");
 	}
 	void getColorSetPointsG(size_t clst_i,size_t clsp_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i].clsp[%i].clpg\"",mName.c_str(),clst_i,clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i,"].clpg\"");
 	}
 	void getColorSetPointsG(size_t clsp_i)const
 	{
 
-		fprintf(mFile,"\"%s.clst.clsp[%i].clpg\"",mName.c_str(),clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst.clsp[",clsp_i,"].clpg\"");
 	}
 	void getColorSetPointsB(size_t clst_i,size_t clsp_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i].clsp[%i].clpb\"",mName.c_str(),clst_i,clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i,"].clpb\"");
 	}
 	void getColorSetPointsB(size_t clsp_i)const
 	{
 
-		fprintf(mFile,"\"%s.clst.clsp[%i].clpb\"",mName.c_str(),clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst.clsp[",clsp_i,"].clpb\"");
 	}
 	void getColorSetPointsA(size_t clst_i,size_t clsp_i)const
 	{
-		fprintf(mFile,"\"%s.clst[%i].clsp[%i].clpa\"",mName.c_str(),clst_i,clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst[",clst_i); writeInt(mFile,"].clsp[",clsp_i,"].clpa\"");
 	}
 	void getColorSetPointsA(size_t clsp_i)const
 	{
 
-		fprintf(mFile,"\"%s.clst.clsp[%i].clpa\"",mName.c_str(),clsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clst.clsp[",clsp_i,"].clpa\"");
 	}
 protected:
 	ControlPoint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,32 +27,32 @@ public:
 	void setSrcColorSetName(const string& src)
 	{
 		if(src == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".src\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".src\" -type \"string\" ");
 		src.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDstColorName(const string& dst)
 	{
 		if(dst == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".dst\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".dst\" -type \"string\" ");
 		dst.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ig\"");
 	}
 	void getOutputGeometry()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 	void getSrcColorSetName()const
 	{
-		fprintf(mFile,"\"%s.src\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".src\"");
 	}
 	void getDstColorName()const
 	{
-		fprintf(mFile,"\"%s.dst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dst\"");
 	}
 protected:
 	CopyColorSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
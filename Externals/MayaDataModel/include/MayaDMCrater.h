@@ -27,252 +27,252 @@ public:
 	void setShaker(float sh)
 	{
 		if(sh == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".sh\" %f;\n", sh);
+		writeFloat(mFile,"\tsetAttr \".sh\" ",sh,";\n");
 	}
 	void setChannel1(const float3& c1)
 	{
 		if(c1 == float3(1.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c1\" -type \"float3\" ");
 		c1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChannel1R(float c1r)
 	{
 		if(c1r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1r\" %f;\n", c1r);
+		writeFloat(mFile,"\tsetAttr \".c1.c1r\" ",c1r,";\n");
 	}
 	void setChannel1G(float c1g)
 	{
 		if(c1g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1g\" %f;\n", c1g);
+		writeFloat(mFile,"\tsetAttr \".c1.c1g\" ",c1g,";\n");
 	}
 	void setChannel1B(float c1b)
 	{
 		if(c1b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c1.c1b\" %f;\n", c1b);
+		writeFloat(mFile,"\tsetAttr \".c1.c1b\" ",c1b,";\n");
 	}
 	void setChannel2(const float3& c2)
 	{
 		if(c2 == float3(0.0f,1.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c2\" -type \"float3\" ");
 		c2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChannel2R(float c2r)
 	{
 		if(c2r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2r\" %f;\n", c2r);
+		writeFloat(mFile,"\tsetAttr \".c2.c2r\" ",c2r,";\n");
 	}
 	void setChannel2G(float c2g)
 	{
 		if(c2g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2g\" %f;\n", c2g);
+		writeFloat(mFile,"\tsetAttr \".c2.c2g\" ",c2g,";\n");
 	}
 	void setChannel2B(float c2b)
 	{
 		if(c2b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c2.c2b\" %f;\n", c2b);
+		writeFloat(mFile,"\tsetAttr \".c2.c2b\" ",c2b,";\n");
 	}
 	void setChannel3(const float3& c3)
 	{
 		if(c3 == float3(0.0f,0.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c3\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c3\" -type \"float3\" ");
 		c3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChannel3R(float c3r)
 	{
 		if(c3r == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c3.c3r\" %f;\n", c3r);
+		writeFloat(mFile,"\tsetAttr \".c3.c3r\" ",c3r,";\n");
 	}
 	void setChannel3G(float c3g)
 	{
 		if(c3g == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c3.c3g\" %f;\n", c3g);
+		writeFloat(mFile,"\tsetAttr \".c3.c3g\" ",c3g,";\n");
 	}
 	void setChannel3B(float c3b)
 	{
 		if(c3b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c3.c3b\" %f;\n", c3b);
+		writeFloat(mFile,"\tsetAttr \".c3.c3b\" ",c3b,";\n");
 	}
 	void setMelt(float m)
 	{
 		if(m == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".m\" %f;\n", m);
+		writeFloat(mFile,"\tsetAttr \".m\" ",m,";\n");
 	}
 	void setBalance(float ba)
 	{
 		if(ba == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ba\" %f;\n", ba);
+		writeFloat(mFile,"\tsetAttr \".ba\" ",ba,";\n");
 	}
 	void setFrequency(float fr)
 	{
 		if(fr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setNormDepth(float nd)
 	{
 		if(nd == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".nd\" %f;\n", nd);
+		writeFloat(mFile,"\tsetAttr \".nd\" ",nd,";\n");
 	}
 	void setNormMelt(float nm)
 	{
 		if(nm == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nm\" %f;\n", nm);
+		writeFloat(mFile,"\tsetAttr \".nm\" ",nm,";\n");
 	}
 	void setNormBalance(float nb)
 	{
 		if(nb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nb\" %f;\n", nb);
+		writeFloat(mFile,"\tsetAttr \".nb\" ",nb,";\n");
 	}
 	void setNormFrequency(float nf)
 	{
 		if(nf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nf\" %f;\n", nf);
+		writeFloat(mFile,"\tsetAttr \".nf\" ",nf,";\n");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getShaker()const
 	{
-		fprintf(mFile,"\"%s.sh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh\"");
 	}
 	void getChannel1()const
 	{
-		fprintf(mFile,"\"%s.c1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1\"");
 	}
 	void getChannel1R()const
 	{
-		fprintf(mFile,"\"%s.c1.c1r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1r\"");
 	}
 	void getChannel1G()const
 	{
-		fprintf(mFile,"\"%s.c1.c1g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1g\"");
 	}
 	void getChannel1B()const
 	{
-		fprintf(mFile,"\"%s.c1.c1b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c1.c1b\"");
 	}
 	void getChannel2()const
 	{
-		fprintf(mFile,"\"%s.c2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2\"");
 	}
 	void getChannel2R()const
 	{
-		fprintf(mFile,"\"%s.c2.c2r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2r\"");
 	}
 	void getChannel2G()const
 	{
-		fprintf(mFile,"\"%s.c2.c2g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2g\"");
 	}
 	void getChannel2B()const
 	{
-		fprintf(mFile,"\"%s.c2.c2b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c2.c2b\"");
 	}
 	void getChannel3()const
 	{
-		fprintf(mFile,"\"%s.c3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c3\"");
 	}
 	void getChannel3R()const
 	{
-		fprintf(mFile,"\"%s.c3.c3r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c3.c3r\"");
 	}
 	void getChannel3G()const
 	{
-		fprintf(mFile,"\"%s.c3.c3g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c3.c3g\"");
 	}
 	void getChannel3B()const
 	{
-		fprintf(mFile,"\"%s.c3.c3b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c3.c3b\"");
 	}
 	void getMelt()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getBalance()const
 	{
-		fprintf(mFile,"\"%s.ba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ba\"");
 	}
 	void getFrequency()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getNormDepth()const
 	{
-		fprintf(mFile,"\"%s.nd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nd\"");
 	}
 	void getNormMelt()const
 	{
-		fprintf(mFile,"\"%s.nm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nm\"");
 	}
 	void getNormBalance()const
 	{
-		fprintf(mFile,"\"%s.nb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nb\"");
 	}
 	void getNormFrequency()const
 	{
-		fprintf(mFile,"\"%s.nf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nf\"");
 	}
 	void getOutNormal()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutNormalX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutNormalY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutNormalZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 protected:
 	Crater(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,39 +27,39 @@ public:
 	void setColorSetName(const string& colos)
 	{
 		if(colos == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".colos\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".colos\" -type \"string\" ");
 		colos.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClamped(bool clam)
 	{
 		if(clam == true) return;
-		fprintf(mFile,"\tsetAttr \".clam\" %i;\n", clam);
+		writeInt(mFile,"\tsetAttr \".clam\" ",clam,";\n");
 	}
 	void setRepresentation(unsigned int rprt)
 	{
 		if(rprt == 3) return;
-		fprintf(mFile,"\tsetAttr \".rprt\" %i;\n", rprt);
+		writeInt(mFile,"\tsetAttr \".rprt\" ",rprt,";\n");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ig\"");
 	}
 	void getOutputGeometry()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 	void getColorSetName()const
 	{
-		fprintf(mFile,"\"%s.colos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".colos\"");
 	}
 	void getClamped()const
 	{
-		fprintf(mFile,"\"%s.clam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clam\"");
 	}
 	void getRepresentation()const
 	{
-		fprintf(mFile,"\"%s.rprt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rprt\"");
 	}
 protected:
 	CreateColorSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
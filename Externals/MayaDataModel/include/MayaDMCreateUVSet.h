@@ -27,21 +27,21 @@ public:
 	void setUvSetName(const string& uvs)
 	{
 		if(uvs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
 		uvs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ig\"");
 	}
 	void getOutputGeometry()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 protected:
 	CreateUVSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,11 +26,11 @@ public:
 
 	void getInputMesh()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	CurveFromMesh(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,7 +26,7 @@ public:
 
 	void getCurveOnMesh()const
 	{
-		fprintf(mFile,"\"%s.com\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".com\"");
 	}
 protected:
 	CurveFromMeshCoM(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,39 +27,39 @@ public:
 	void setEdgeIndex(size_t ei_i,int ei)
 	{
 		if(ei == 0) return;
-		fprintf(mFile,"\tsetAttr \".ei[%i]\" %i;\n", ei_i,ei);
+		writeInt(mFile,"\tsetAttr \".ei[",ei_i); writeInt(mFile,"]\" ",ei,";\n");
 	}
 	void setEdgeIndex(size_t ei_start,size_t ei_end,int* ei)
 	{
-		fprintf(mFile,"\tsetAttr \".ei[%i:%i]\" ", ei_start,ei_end);
+		writeInt(mFile,"\tsetAttr \".ei[",ei_start); writeInt(mFile,":",ei_end,"]\" ");
 		size_t size = (ei_end-ei_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ei[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ei[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEdgeIndex(size_t ei_start,size_t ei_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ei[%i:%i]\"",ei_start,ei_end);
+		writeInt(mFile,"\tsetAttr \".ei[",ei_start); writeInt(mFile,":",ei_end,"]\"");
 	}
 	void appendEdgeIndex(int ei)const
 	{
-		fprintf(mFile," %i",ei);
+		writeInt(mFile," ",ei);
 	}
 	void endEdgeIndex()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getEdgeIndex(size_t ei_i)const
 	{
-		fprintf(mFile,"\"%s.ei[%i]\"",mName.c_str(),ei_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ei[",ei_i,"]\"");
 	}
 	void getEdgeIndex()const
 	{
 
-		fprintf(mFile,"\"%s.ei\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ei\"");
 	}
 protected:
 	CurveFromMeshEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
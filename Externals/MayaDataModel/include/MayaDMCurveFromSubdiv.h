@@ -27,37 +27,37 @@ public:
 	void setMinValue(double min)
 	{
 		if(min == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".min\" %f;\n", min);
+		writeFloat(mFile,"\tsetAttr \".min\" ",min,";\n");
 	}
 	void setMaxValue(double max)
 	{
 		if(max == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".max\" %f;\n", max);
+		writeFloat(mFile,"\tsetAttr \".max\" ",max,";\n");
 	}
 	void setRelative(bool r)
 	{
 		if(r == false) return;
-		fprintf(mFile,"\tsetAttr \".r\" %i;\n", r);
+		writeInt(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void getInputSubdiv()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getMinValue()const
 	{
-		fprintf(mFile,"\"%s.min\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".min\"");
 	}
 	void getMaxValue()const
 	{
-		fprintf(mFile,"\"%s.max\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".max\"");
 	}
 	void getRelative()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	CurveFromSubdiv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
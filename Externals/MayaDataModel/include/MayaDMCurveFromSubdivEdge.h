@@ -27,76 +27,76 @@ public:
 	void setEdgeIndexL(size_t eil_i,int eil)
 	{
 		if(eil == 0) return;
-		fprintf(mFile,"\tsetAttr \".eil[%i]\" %i;\n", eil_i,eil);
+		writeInt(mFile,"\tsetAttr \".eil[",eil_i); writeInt(mFile,"]\" ",eil,";\n");
 	}
 	void setEdgeIndexL(size_t eil_start,size_t eil_end,int* eil)
 	{
-		fprintf(mFile,"\tsetAttr \".eil[%i:%i]\" ", eil_start,eil_end);
+		writeInt(mFile,"\tsetAttr \".eil[",eil_start); writeInt(mFile,":",eil_end,"]\" ");
 		size_t size = (eil_end-eil_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",eil[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",eil[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEdgeIndexL(size_t eil_start,size_t eil_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".eil[%i:%i]\"",eil_start,eil_end);
+		writeInt(mFile,"\tsetAttr \".eil[",eil_start); writeInt(mFile,":",eil_end,"]\"");
 	}
 	void appendEdgeIndexL(int eil)const
 	{
-		fprintf(mFile," %i",eil);
+		writeInt(mFile," ",eil);
 	}
 	void endEdgeIndexL()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEdgeIndexR(size_t eir_i,int eir)
 	{
 		if(eir == 0) return;
-		fprintf(mFile,"\tsetAttr \".eir[%i]\" %i;\n", eir_i,eir);
+		writeInt(mFile,"\tsetAttr \".eir[",eir_i); writeInt(mFile,"]\" ",eir,";\n");
 	}
 	void setEdgeIndexR(size_t eir_start,size_t eir_end,int* eir)
 	{
-		fprintf(mFile,"\tsetAttr \".eir[%i:%i]\" ", eir_start,eir_end);
+		writeInt(mFile,"\tsetAttr \".eir[",eir_start); writeInt(mFile,":",eir_end,"]\" ");
 		size_t size = (eir_end-eir_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",eir[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",eir[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEdgeIndexR(size_t eir_start,size_t eir_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".eir[%i:%i]\"",eir_start,eir_end);
+		writeInt(mFile,"\tsetAttr \".eir[",eir_start); writeInt(mFile,":",eir_end,"]\"");
 	}
 	void appendEdgeIndexR(int eir)const
 	{
-		fprintf(mFile," %i",eir);
+		writeInt(mFile," ",eir);
 	}
 	void endEdgeIndexR()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getEdgeIndexL(size_t eil_i)const
 	{
-		fprintf(mFile,"\"%s.eil[%i]\"",mName.c_str(),eil_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eil[",eil_i,"]\"");
 	}
 	void getEdgeIndexL()const
 	{
 
-		fprintf(mFile,"\"%s.eil\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eil\"");
 	}
 	void getEdgeIndexR(size_t eir_i)const
 	{
-		fprintf(mFile,"\"%s.eir[%i]\"",mName.c_str(),eir_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eir[",eir_i,"]\"");
 	}
 	void getEdgeIndexR()const
 	{
 
-		fprintf(mFile,"\"%s.eir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eir\"");
 	}
 protected:
 	CurveFromSubdivEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,76 +27,76 @@ public:
 	void setFaceIndexL(size_t fil_i,int fil)
 	{
 		if(fil == 0) return;
-		fprintf(mFile,"\tsetAttr \".fil[%i]\" %i;\n", fil_i,fil);
+		writeInt(mFile,"\tsetAttr \".fil[",fil_i); writeInt(mFile,"]\" ",fil,";\n");
 	}
 	void setFaceIndexL(size_t fil_start,size_t fil_end,int* fil)
 	{
-		fprintf(mFile,"\tsetAttr \".fil[%i:%i]\" ", fil_start,fil_end);
+		writeInt(mFile,"\tsetAttr \".fil[",fil_start); writeInt(mFile,":",fil_end,"]\" ");
 		size_t size = (fil_end-fil_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",fil[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",fil[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFaceIndexL(size_t fil_start,size_t fil_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fil[%i:%i]\"",fil_start,fil_end);
+		writeInt(mFile,"\tsetAttr \".fil[",fil_start); writeInt(mFile,":",fil_end,"]\"");
 	}
 	void appendFaceIndexL(int fil)const
 	{
-		fprintf(mFile," %i",fil);
+		writeInt(mFile," ",fil);
 	}
 	void endFaceIndexL()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFaceIndexR(size_t fir_i,int fir)
 	{
 		if(fir == 0) return;
-		fprintf(mFile,"\tsetAttr \".fir[%i]\" %i;\n", fir_i,fir);
+		writeInt(mFile,"\tsetAttr \".fir[",fir_i); writeInt(mFile,"]\" ",fir,";\n");
 	}
 	void setFaceIndexR(size_t fir_start,size_t fir_end,int* fir)
 	{
-		fprintf(mFile,"\tsetAttr \".fir[%i:%i]\" ", fir_start,fir_end);
+		writeInt(mFile,"\tsetAttr \".fir[",fir_start); writeInt(mFile,":",fir_end,"]\" ");
 		size_t size = (fir_end-fir_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",fir[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",fir[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFaceIndexR(size_t fir_start,size_t fir_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fir[%i:%i]\"",fir_start,fir_end);
+		writeInt(mFile,"\tsetAttr \".fir[",fir_start); writeInt(mFile,":",fir_end,"]\"");
 	}
 	void appendFaceIndexR(int fir)const
 	{
-		fprintf(mFile," %i",fir);
+		writeInt(mFile," ",fir);
 	}
 	void endFaceIndexR()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getFaceIndexL(size_t fil_i)const
 	{
-		fprintf(mFile,"\"%s.fil[%i]\"",mName.c_str(),fil_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fil[",fil_i,"]\"");
 	}
 	void getFaceIndexL()const
 	{
 
-		fprintf(mFile,"\"%s.fil\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fil\"");
 	}
 	void getFaceIndexR(size_t fir_i)const
 	{
-		fprintf(mFile,"\"%s.fir[%i]\"",mName.c_str(),fir_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fir[",fir_i,"]\"");
 	}
 	void getFaceIndexR()const
 	{
 
-		fprintf(mFile,"\"%s.fir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fir\"");
 	}
 protected:
 	CurveFromSubdivFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setFace(int f)
 	{
 		if(f == 0) return;
-		fprintf(mFile,"\tsetAttr \".f\" %i;\n", f);
+		writeInt(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void setBoundary(int b)
 	{
 		if(b == 0) return;
-		fprintf(mFile,"\tsetAttr \".b\" %i;\n", b);
+		writeInt(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setEdge(int e)
 	{
 		if(e == -1) return;
-		fprintf(mFile,"\tsetAttr \".e\" %i;\n", e);
+		writeInt(mFile,"\tsetAttr \".e\" ",e,";\n");
 	}
 	void getFace()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getBoundary()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getEdge()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 protected:
 	CurveFromSurfaceBnd(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,7 +26,7 @@ public:
 
 	void getCurveOnSurface()const
 	{
-		fprintf(mFile,"\"%s.cos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cos\"");
 	}
 protected:
 	CurveFromSurfaceCoS(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setIsoparmValue(double iv)
 	{
 		if(iv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".iv\" %f;\n", iv);
+		writeFloat(mFile,"\tsetAttr \".iv\" ",iv,";\n");
 	}
 	void setIsoparmDirection(unsigned int idr)
 	{
 		if(idr == 0) return;
-		fprintf(mFile,"\tsetAttr \".idr\" %i;\n", idr);
+		writeInt(mFile,"\tsetAttr \".idr\" ",idr,";\n");
 	}
 	void setRelativeValue(bool rv)
 	{
 		if(rv == false) return;
-		fprintf(mFile,"\tsetAttr \".rv\" %i;\n", rv);
+		writeInt(mFile,"\tsetAttr \".rv\" ",rv,";\n");
 	}
 	void getIsoparmValue()const
 	{
-		fprintf(mFile,"\"%s.iv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iv\"");
 	}
 	void getIsoparmDirection()const
 	{
-		fprintf(mFile,"\"%s.idr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idr\"");
 	}
 	void getRelativeValue()const
 	{
-		fprintf(mFile,"\"%s.rv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rv\"");
 	}
 protected:
 	CurveFromSurfaceIso(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
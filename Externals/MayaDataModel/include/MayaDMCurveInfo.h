@@ -26,65 +26,65 @@ public:
 
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getArcLength()const
 	{
-		fprintf(mFile,"\"%s.al\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al\"");
 	}
 	void getControlPoints(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i]\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"]\"");
 	}
 	void getControlPoints()const
 	{
 
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getXValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].xv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].xv\"");
 	}
 	void getXValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.xv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.xv\"");
 	}
 	void getYValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].yv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].yv\"");
 	}
 	void getYValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.yv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.yv\"");
 	}
 	void getZValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].zv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].zv\"");
 	}
 	void getZValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.zv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.zv\"");
 	}
 	void getWeights(size_t wt_i)const
 	{
-		fprintf(mFile,"\"%s.wt[%i]\"",mName.c_str(),wt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wt[",wt_i,"]\"");
 	}
 	void getWeights()const
 	{
 
-		fprintf(mFile,"\"%s.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wt\"");
 	}
 	void getKnots(size_t kn_i)const
 	{
-		fprintf(mFile,"\"%s.kn[%i]\"",mName.c_str(),kn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".kn[",kn_i,"]\"");
 	}
 	void getKnots()const
 	{
 
-		fprintf(mFile,"\"%s.kn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kn\"");
 	}
 protected:
 	CurveInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,83 +27,83 @@ public:
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setUseDirection(bool ud)
 	{
 		if(ud == false) return;
-		fprintf(mFile,"\tsetAttr \".ud\" %i;\n", ud);
+		writeInt(mFile,"\tsetAttr \".ud\" ",ud,";\n");
 	}
 	void setDirection(const double3& d)
 	{
-		fprintf(mFile,"\tsetAttr \".d\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"double3\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionX(double dx)
 	{
 		if(dx == 0) return;
-		fprintf(mFile,"\tsetAttr \".d.dx\" %f;\n", dx);
+		writeFloat(mFile,"\tsetAttr \".d.dx\" ",dx,";\n");
 	}
 	void setDirectionY(double dy)
 	{
 		if(dy == 1) return;
-		fprintf(mFile,"\tsetAttr \".d.dy\" %f;\n", dy);
+		writeFloat(mFile,"\tsetAttr \".d.dy\" ",dy,";\n");
 	}
 	void setDirectionZ(double dz)
 	{
 		if(dz == 0) return;
-		fprintf(mFile,"\tsetAttr \".d.dz\" %f;\n", dz);
+		writeFloat(mFile,"\tsetAttr \".d.dz\" ",dz,";\n");
 	}
 	void getInputCurve1()const
 	{
-		fprintf(mFile,"\"%s.ic1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic1\"");
 	}
 	void getInputCurve2()const
 	{
-		fprintf(mFile,"\"%s.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getUseDirection()const
 	{
-		fprintf(mFile,"\"%s.ud\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ud\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDirectionX()const
 	{
-		fprintf(mFile,"\"%s.d.dx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dx\"");
 	}
 	void getDirectionY()const
 	{
-		fprintf(mFile,"\"%s.d.dy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dy\"");
 	}
 	void getDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.d.dz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dz\"");
 	}
 	void getParameter1(size_t p1_i)const
 	{
-		fprintf(mFile,"\"%s.p1[%i]\"",mName.c_str(),p1_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p1[",p1_i,"]\"");
 	}
 	void getParameter1()const
 	{
 
-		fprintf(mFile,"\"%s.p1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p1\"");
 	}
 	void getParameter2(size_t p2_i)const
 	{
-		fprintf(mFile,"\"%s.p2[%i]\"",mName.c_str(),p2_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p2[",p2_i,"]\"");
 	}
 	void getParameter2()const
 	{
 
-		fprintf(mFile,"\"%s.p2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p2\"");
 	}
 protected:
 	CurveIntersect(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setScalar(double sc)
 	{
 		if(sc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %f;\n", sc);
+		writeFloat(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void getScalar()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 protected:
 	CurveNormalizer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
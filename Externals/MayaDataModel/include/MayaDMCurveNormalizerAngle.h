@@ -27,15 +27,15 @@ public:
 	void setAnimInput(double ai)
 	{
 		if(ai == 0) return;
-		fprintf(mFile,"\tsetAttr \".ai\" %f;\n", ai);
+		writeFloat(mFile,"\tsetAttr \".ai\" ",ai,";\n");
 	}
 	void getAnimInput()const
 	{
-		fprintf(mFile,"\"%s.ai\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ai\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	CurveNormalizerAngle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
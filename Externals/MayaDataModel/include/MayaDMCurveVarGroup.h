@@ -27,29 +27,29 @@ public:
 	void setDisplaySmoothness(int ds)
 	{
 		if(ds == -1) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %i;\n", ds);
+		writeInt(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void getCreate(size_t cr_i)const
 	{
-		fprintf(mFile,"\"%s.cr[%i]\"",mName.c_str(),cr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cr[",cr_i,"]\"");
 	}
 	void getCreate()const
 	{
 
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getLocal(size_t l_i)const
 	{
-		fprintf(mFile,"\"%s.l[%i]\"",mName.c_str(),l_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".l[",l_i,"]\"");
 	}
 	void getLocal()const
 	{
 
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getDisplaySmoothness()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 protected:
 	CurveVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
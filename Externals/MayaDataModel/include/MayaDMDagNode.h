@@ -30,9 +30,9 @@ public:
 			void write(FILE* file) const
 			{
 				objectGrpCompList.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%i ", objectGroupId);
-				fprintf(file,"%i", objectGrpColor);
+				writeString(file," ");
+				writeInt(file,"",objectGroupId," ");
+				writeInt(file,"",objectGrpColor);
 			}
 		}* objectGroups;
 		size_t nbObjectGroups;
@@ -41,7 +41,7 @@ public:
 			for (size_t i = 0; i<nbObjectGroups; ++i)
 			{
 				objectGroups[i].write(file);
-				if (i + 1<nbObjectGroups) fprintf(file, " ");
+				if (i + 1<nbObjectGroups) writeString(file," ");
 			}
 		}
 	};
@@ -56,14 +56,14 @@ public:
 		unsigned char overrideColor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", overrideDisplayType);
-			fprintf(file,"%i ", overrideLevelOfDetail);
-			fprintf(file,"%i ", overrideShading);
-			fprintf(file,"%i ", overrideTexturing);
-			fprintf(file,"%i ", overridePlayback);
-			fprintf(file,"%i ", overrideEnabled);
-			fprintf(file,"%i ", overrideVisibility);
-			fprintf(file,"%i", overrideColor);
+			writeInt(file,"",overrideDisplayType," ");
+			writeInt(file,"",overrideLevelOfDetail," ");
+			writeInt(file,"",overrideShading," ");
+			writeInt(file,"",overrideTexturing," ");
+			writeInt(file,"",overridePlayback," ");
+			writeInt(file,"",overrideEnabled," ");
+			writeInt(file,"",overrideVisibility," ");
+			writeInt(file,"",overrideColor);
 		}
 	};
 	struct RenderInfo{
@@ -72,9 +72,9 @@ public:
 		unsigned char layerOverrideColor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", identification);
-			fprintf(file,"%i ", layerRenderable);
-			fprintf(file,"%i", layerOverrideColor);
+			writeInt(file,"",identification," ");
+			writeInt(file,"",layerRenderable," ");
+			writeInt(file,"",layerOverrideColor);
 		}
 	};
 	struct RenderLayerInfo{
@@ -83,9 +83,9 @@ public:
 		unsigned char renderLayerColor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", renderLayerId);
-			fprintf(file,"%i ", renderLayerRenderable);
-			fprintf(file,"%i", renderLayerColor);
+			writeInt(file,"",renderLayerId," ");
+			writeInt(file,"",renderLayerRenderable," ");
+			writeInt(file,"",renderLayerColor);
 		}
 	};
 	struct GhostCustomSteps{
@@ -94,9 +94,9 @@ public:
 		int ghostStepSize;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", ghostPreSteps);
-			fprintf(file,"%i ", ghostPostSteps);
-			fprintf(file,"%i", ghostStepSize);
+			writeInt(file,"",ghostPreSteps," ");
+			writeInt(file,"",ghostPostSteps," ");
+			writeInt(file,"",ghostStepSize);
 		}
 	};
 public:
@@ -109,571 +109,571 @@ public:
 	void setVisibility(bool v)
 	{
 		if(v == true) return;
-		fprintf(mFile,"\tsetAttr \".v\" %i;\n", v);
+		writeInt(mFile,"\tsetAttr \".v\" ",v,";\n");
 	}
 	void setIntermediateObject(bool io)
 	{
 		if(io == false) return;
-		fprintf(mFile,"\tsetAttr \".io\" %i;\n", io);
+		writeInt(mFile,"\tsetAttr \".io\" ",io,";\n");
 	}
 	void setTemplate(bool tmp)
 	{
 		if(tmp == false) return;
-		fprintf(mFile,"\tsetAttr \".tmp\" %i;\n", tmp);
+		writeInt(mFile,"\tsetAttr \".tmp\" ",tmp,";\n");
 	}
 	void setGhosting(bool gh)
 	{
 		if(gh == false) return;
-		fprintf(mFile,"\tsetAttr \".gh\" %i;\n", gh);
+		writeInt(mFile,"\tsetAttr \".gh\" ",gh,";\n");
 	}
 	void setInstObjGroups(size_t iog_i,const InstObjGroups& iog)
 	{
-		fprintf(mFile,"\tsetAttr \".iog[%i]\" ",iog_i);
+		writeInt(mFile,"\tsetAttr \".iog[",iog_i,"]\" ");
 		iog.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInstObjGroups(size_t iog_start,size_t iog_end,InstObjGroups* iog)
 	{
-		fprintf(mFile,"\tsetAttr \".iog[%i:%i]\" ", iog_start,iog_end);
+		writeInt(mFile,"\tsetAttr \".iog[",iog_start); writeInt(mFile,":",iog_end,"]\" ");
 		size_t size = (iog_end-iog_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			iog[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInstObjGroups(size_t iog_start,size_t iog_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".iog[%i:%i]\"",iog_start,iog_end);
-		fprintf(mFile," -type \"InstObjGroups\" ");
+		writeInt(mFile,"\tsetAttr \".iog[",iog_start); writeInt(mFile,":",iog_end,"]\"");
+		writeString(mFile," -type \"InstObjGroups\" ");
 	}
 	void appendInstObjGroups(const InstObjGroups& iog)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		iog.write(mFile);
 	}
 	void endInstObjGroups()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setObjectGroups(size_t iog_i,size_t og_i,const InstObjGroups::ObjectGroups& og)
 	{
-		fprintf(mFile,"\tsetAttr \".iog[%i].og[%i]\" ",iog_i,og_i);
+		writeInt(mFile,"\tsetAttr \".iog[",iog_i); writeInt(mFile,"].og[",og_i,"]\" ");
 		og.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setObjectGroups(size_t iog_i,size_t og_start,size_t og_end,InstObjGroups::ObjectGroups* og)
 	{
-		fprintf(mFile,"\tsetAttr \".iog[%i].og[%i:%i]\" ", iog_i,og_start,og_end);
+		writeInt(mFile,"\tsetAttr \".iog[",iog_i); writeInt(mFile,"].og[",og_start); writeInt(mFile,":",og_end,"]\" ");
 		size_t size = (og_end-og_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			og[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startObjectGroups(size_t iog_i,size_t og_start,size_t og_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".iog[%i].og[%i:%i]\"",iog_i,og_start,og_end);
-		fprintf(mFile," -type \"InstObjGroups::ObjectGroups\" ");
+		writeInt(mFile,"\tsetAttr \".iog[",iog_i); writeInt(mFile,"].og[",og_start); writeInt(mFile,":",og_end,"]\"");
+		writeString(mFile," -type \"InstObjGroups::ObjectGroups\" ");
 	}
 	void appendObjectGroups(const InstObjGroups::ObjectGroups& og)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		og.write(mFile);
 	}
 	void endObjectGroups()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setObjectGrpCompList(size_t iog_i,size_t og_i,const componentList& gcl)
 	{
-		fprintf(mFile,"\tsetAttr \".iog[%i].og[%i].gcl\" -type \"componentList\" ",iog_i,og_i);
+		writeInt(mFile,"\tsetAttr \".iog[",iog_i); writeInt(mFile,"].og[",og_i,"].gcl\" -type \"componentList\" ");
 		gcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setObjectGroupId(size_t iog_i,size_t og_i,int gid)
 	{
 		if(gid == 0) return;
-		fprintf(mFile,"\tsetAttr \".iog[%i].og[%i].gid\" %i;\n", iog_i,og_i,gid);
+		writeInt(mFile,"\tsetAttr \".iog[",iog_i); writeInt(mFile,"].og[",og_i); writeInt(mFile,"].gid\" ",gid,";\n");
 	}
 	void setObjectGrpColor(size_t iog_i,size_t og_i,short gco)
 	{
 		if(gco == -1) return;
-		fprintf(mFile,"\tsetAttr \".iog[%i].og[%i].gco\" %i;\n", iog_i,og_i,gco);
+		writeInt(mFile,"\tsetAttr \".iog[",iog_i); writeInt(mFile,"].og[",og_i); writeInt(mFile,"].gco\" ",gco,";\n");
 	}
 	void setUseObjectColor(bool uoc)
 	{
 		if(uoc == false) return;
-		fprintf(mFile,"\tsetAttr \".uoc\" %i;\n", uoc);
+		writeInt(mFile,"\tsetAttr \".uoc\" ",uoc,";\n");
 	}
 	void setObjectColor(short oc)
 	{
 		if(oc == 0) return;
-		fprintf(mFile,"\tsetAttr \".oc\" %i;\n", oc);
+		writeInt(mFile,"\tsetAttr \".oc\" ",oc,";\n");
 	}
 	void setDrawOverride(const DrawOverride& do_)
 	{
-		fprintf(mFile,"\tsetAttr \".do\" ");
+		writeString(mFile,"\tsetAttr \".do\" ");
 		do_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOverrideDisplayType(unsigned int ovdt)
 	{
 		if(ovdt == 0) return;
-		fprintf(mFile,"\tsetAttr \".do.ovdt\" %i;\n", ovdt);
+		writeInt(mFile,"\tsetAttr \".do.ovdt\" ",ovdt,";\n");
 	}
 	void setOverrideLevelOfDetail(unsigned int ovlod)
 	{
 		if(ovlod == 0) return;
-		fprintf(mFile,"\tsetAttr \".do.ovlod\" %i;\n", ovlod);
+		writeInt(mFile,"\tsetAttr \".do.ovlod\" ",ovlod,";\n");
 	}
 	void setOverrideShading(bool ovs)
 	{
 		if(ovs == true) return;
-		fprintf(mFile,"\tsetAttr \".do.ovs\" %i;\n", ovs);
+		writeInt(mFile,"\tsetAttr \".do.ovs\" ",ovs,";\n");
 	}
 	void setOverrideTexturing(bool ovt)
 	{
 		if(ovt == true) return;
-		fprintf(mFile,"\tsetAttr \".do.ovt\" %i;\n", ovt);
+		writeInt(mFile,"\tsetAttr \".do.ovt\" ",ovt,";\n");
 	}
 	void setOverridePlayback(bool ovp)
 	{
 		if(ovp == true) return;
-		fprintf(mFile,"\tsetAttr \".do.ovp\" %i;\n", ovp);
+		writeInt(mFile,"\tsetAttr \".do.ovp\" ",ovp,";\n");
 	}
 	void setOverrideEnabled(bool ove)
 	{
 		if(ove == false) return;
-		fprintf(mFile,"\tsetAttr \".do.ove\" %i;\n", ove);
+		writeInt(mFile,"\tsetAttr \".do.ove\" ",ove,";\n");
 	}
 	void setOverrideVisibility(bool ovv)
 	{
 		if(ovv == true) return;
-		fprintf(mFile,"\tsetAttr \".do.ovv\" %i;\n", ovv);
+		writeInt(mFile,"\tsetAttr \".do.ovv\" ",ovv,";\n");
 	}
 	void setOverrideColor(unsigned char ovc)
 	{
 		if(ovc == 0) return;
-		fprintf(mFile,"\tsetAttr \".do.ovc\" %i;\n", ovc);
+		writeInt(mFile,"\tsetAttr \".do.ovc\" ",ovc,";\n");
 	}
 	void setLodVisibility(bool lodv)
 	{
 		if(lodv == true) return;
-		fprintf(mFile,"\tsetAttr \".lodv\" %i;\n", lodv);
+		writeInt(mFile,"\tsetAttr \".lodv\" ",lodv,";\n");
 	}
 	void setRenderInfo(const RenderInfo& ri)
 	{
-		fprintf(mFile,"\tsetAttr \".ri\" ");
+		writeString(mFile,"\tsetAttr \".ri\" ");
 		ri.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIdentification(short rlid)
 	{
 		if(rlid == 0) return;
-		fprintf(mFile,"\tsetAttr \".ri.rlid\" %i;\n", rlid);
+		writeInt(mFile,"\tsetAttr \".ri.rlid\" ",rlid,";\n");
 	}
 	void setLayerRenderable(bool rndr)
 	{
 		if(rndr == true) return;
-		fprintf(mFile,"\tsetAttr \".ri.rndr\" %i;\n", rndr);
+		writeInt(mFile,"\tsetAttr \".ri.rndr\" ",rndr,";\n");
 	}
 	void setLayerOverrideColor(unsigned char lovc)
 	{
 		if(lovc == 0) return;
-		fprintf(mFile,"\tsetAttr \".ri.lovc\" %i;\n", lovc);
+		writeInt(mFile,"\tsetAttr \".ri.lovc\" ",lovc,";\n");
 	}
 	void setRenderLayerInfo(size_t rlio_i,const RenderLayerInfo& rlio)
 	{
-		fprintf(mFile,"\tsetAttr \".rlio[%i]\" ",rlio_i);
+		writeInt(mFile,"\tsetAttr \".rlio[",rlio_i,"]\" ");
 		rlio.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRenderLayerInfo(size_t rlio_start,size_t rlio_end,RenderLayerInfo* rlio)
 	{
-		fprintf(mFile,"\tsetAttr \".rlio[%i:%i]\" ", rlio_start,rlio_end);
+		writeInt(mFile,"\tsetAttr \".rlio[",rlio_start); writeInt(mFile,":",rlio_end,"]\" ");
 		size_t size = (rlio_end-rlio_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			rlio[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startRenderLayerInfo(size_t rlio_start,size_t rlio_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".rlio[%i:%i]\"",rlio_start,rlio_end);
-		fprintf(mFile," -type \"RenderLayerInfo\" ");
+		writeInt(mFile,"\tsetAttr \".rlio[",rlio_start); writeInt(mFile,":",rlio_end,"]\"");
+		writeString(mFile," -type \"RenderLayerInfo\" ");
 	}
 	void appendRenderLayerInfo(const RenderLayerInfo& rlio)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		rlio.write(mFile);
 	}
 	void endRenderLayerInfo()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRenderLayerId(size_t rlio_i,short rli)
 	{
 		if(rli == 0) return;
-		fprintf(mFile,"\tsetAttr \".rlio[%i].rli\" %i;\n", rlio_i,rli);
+		writeInt(mFile,"\tsetAttr \".rlio[",rlio_i); writeInt(mFile,"].rli\" ",rli,";\n");
 	}
 	void setRenderLayerRenderable(size_t rlio_i,bool rlr)
 	{
 		if(rlr == true) return;
-		fprintf(mFile,"\tsetAttr \".rlio[%i].rlr\" %i;\n", rlio_i,rlr);
+		writeInt(mFile,"\tsetAttr \".rlio[",rlio_i); writeInt(mFile,"].rlr\" ",rlr,";\n");
 	}
 	void setRenderLayerColor(size_t rlio_i,unsigned char rlc)
 	{
 		if(rlc == 0) return;
-		fprintf(mFile,"\tsetAttr \".rlio[%i].rlc\" %i;\n", rlio_i,rlc);
+		writeInt(mFile,"\tsetAttr \".rlio[",rlio_i); writeInt(mFile,"].rlc\" ",rlc,";\n");
 	}
 	void setGhostingControl(unsigned int gc)
 	{
 		if(gc == 0) return;
-		fprintf(mFile,"\tsetAttr \".gc\" %i;\n", gc);
+		writeInt(mFile,"\tsetAttr \".gc\" ",gc,";\n");
 	}
 	void setGhostCustomSteps(const GhostCustomSteps& gcs)
 	{
-		fprintf(mFile,"\tsetAttr \".gcs\" ");
+		writeString(mFile,"\tsetAttr \".gcs\" ");
 		gcs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGhostPreSteps(int gpr)
 	{
 		if(gpr == 3) return;
-		fprintf(mFile,"\tsetAttr \".gcs.gpr\" %i;\n", gpr);
+		writeInt(mFile,"\tsetAttr \".gcs.gpr\" ",gpr,";\n");
 	}
 	void setGhostPostSteps(int gps)
 	{
 		if(gps == 3) return;
-		fprintf(mFile,"\tsetAttr \".gcs.gps\" %i;\n", gps);
+		writeInt(mFile,"\tsetAttr \".gcs.gps\" ",gps,";\n");
 	}
 	void setGhostStepSize(int gss)
 	{
 		if(gss == 1) return;
-		fprintf(mFile,"\tsetAttr \".gcs.gss\" %i;\n", gss);
+		writeInt(mFile,"\tsetAttr \".gcs.gss\" ",gss,";\n");
 	}
 	void setGhostFrames(const intArray& gf)
 	{
 		if(gf.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".gf\" -type \"intArray\" ");
+		writeString(mFile,"\tsetAttr \".gf\" -type \"intArray\" ");
 		gf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGhostRangeStart(double grs)
 	{
 		if(grs == 0) return;
-		fprintf(mFile,"\tsetAttr \".grs\" %f;\n", grs);
+		writeFloat(mFile,"\tsetAttr \".grs\" ",grs,";\n");
 	}
 	void setGhostRangeEnd(double gre)
 	{
 		if(gre == 1) return;
-		fprintf(mFile,"\tsetAttr \".gre\" %f;\n", gre);
+		writeFloat(mFile,"\tsetAttr \".gre\" ",gre,";\n");
 	}
 	void getBoundingBox()const
 	{
-		fprintf(mFile,"\"%s.bb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb\"");
 	}
 	void getBoundingBoxMin()const
 	{
-		fprintf(mFile,"\"%s.bb.bbmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbmn\"");
 	}
 	void getBoundingBoxMinX()const
 	{
-		fprintf(mFile,"\"%s.bb.bbmn.bbnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbmn.bbnx\"");
 	}
 	void getBoundingBoxMinY()const
 	{
-		fprintf(mFile,"\"%s.bb.bbmn.bbny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbmn.bbny\"");
 	}
 	void getBoundingBoxMinZ()const
 	{
-		fprintf(mFile,"\"%s.bb.bbmn.bbnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbmn.bbnz\"");
 	}
 	void getBoundingBoxMax()const
 	{
-		fprintf(mFile,"\"%s.bb.bbmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbmx\"");
 	}
 	void getBoundingBoxMaxX()const
 	{
-		fprintf(mFile,"\"%s.bb.bbmx.bbxx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbmx.bbxx\"");
 	}
 	void getBoundingBoxMaxY()const
 	{
-		fprintf(mFile,"\"%s.bb.bbmx.bbxy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbmx.bbxy\"");
 	}
 	void getBoundingBoxMaxZ()const
 	{
-		fprintf(mFile,"\"%s.bb.bbmx.bbxz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbmx.bbxz\"");
 	}
 	void getBoundingBoxSize()const
 	{
-		fprintf(mFile,"\"%s.bb.bbsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbsi\"");
 	}
 	void getBoundingBoxSizeX()const
 	{
-		fprintf(mFile,"\"%s.bb.bbsi.bbsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbsi.bbsx\"");
 	}
 	void getBoundingBoxSizeY()const
 	{
-		fprintf(mFile,"\"%s.bb.bbsi.bbsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbsi.bbsy\"");
 	}
 	void getBoundingBoxSizeZ()const
 	{
-		fprintf(mFile,"\"%s.bb.bbsi.bbsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bb.bbsi.bbsz\"");
 	}
 	void getCenter()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getBoundingBoxCenterX()const
 	{
-		fprintf(mFile,"\"%s.c.bcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.bcx\"");
 	}
 	void getBoundingBoxCenterY()const
 	{
-		fprintf(mFile,"\"%s.c.bcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.bcy\"");
 	}
 	void getBoundingBoxCenterZ()const
 	{
-		fprintf(mFile,"\"%s.c.bcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.bcz\"");
 	}
 	void getMatrix()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getInverseMatrix()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getWorldMatrix(size_t wm_i)const
 	{
-		fprintf(mFile,"\"%s.wm[%i]\"",mName.c_str(),wm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wm[",wm_i,"]\"");
 	}
 	void getWorldMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.wm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wm\"");
 	}
 	void getWorldInverseMatrix(size_t wim_i)const
 	{
-		fprintf(mFile,"\"%s.wim[%i]\"",mName.c_str(),wim_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wim[",wim_i,"]\"");
 	}
 	void getWorldInverseMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.wim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wim\"");
 	}
 	void getParentMatrix(size_t pm_i)const
 	{
-		fprintf(mFile,"\"%s.pm[%i]\"",mName.c_str(),pm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pm[",pm_i,"]\"");
 	}
 	void getParentMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.pm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pm\"");
 	}
 	void getParentInverseMatrix(size_t pim_i)const
 	{
-		fprintf(mFile,"\"%s.pim[%i]\"",mName.c_str(),pim_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pim[",pim_i,"]\"");
 	}
 	void getParentInverseMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.pim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pim\"");
 	}
 	void getVisibility()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getIntermediateObject()const
 	{
-		fprintf(mFile,"\"%s.io\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".io\"");
 	}
 	void getTemplate()const
 	{
-		fprintf(mFile,"\"%s.tmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmp\"");
 	}
 	void getGhosting()const
 	{
-		fprintf(mFile,"\"%s.gh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gh\"");
 	}
 	void getInstObjGroups(size_t iog_i)const
 	{
-		fprintf(mFile,"\"%s.iog[%i]\"",mName.c_str(),iog_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".iog[",iog_i,"]\"");
 	}
 	void getInstObjGroups()const
 	{
 
-		fprintf(mFile,"\"%s.iog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iog\"");
 	}
 	void getObjectGroups(size_t iog_i,size_t og_i)const
 	{
-		fprintf(mFile,"\"%s.iog[%i].og[%i]\"",mName.c_str(),iog_i,og_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".iog[",iog_i); writeInt(mFile,"].og[",og_i,"]\"");
 	}
 	void getObjectGroups(size_t og_i)const
 	{
 
-		fprintf(mFile,"\"%s.iog.og[%i]\"",mName.c_str(),og_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".iog.og[",og_i,"]\"");
 	}
 	void getObjectGroupId(size_t iog_i,size_t og_i)const
 	{
-		fprintf(mFile,"\"%s.iog[%i].og[%i].gid\"",mName.c_str(),iog_i,og_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".iog[",iog_i); writeInt(mFile,"].og[",og_i,"].gid\"");
 	}
 	void getObjectGroupId(size_t og_i)const
 	{
 
-		fprintf(mFile,"\"%s.iog.og[%i].gid\"",mName.c_str(),og_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".iog.og[",og_i,"].gid\"");
 	}
 	void getObjectGrpColor(size_t iog_i,size_t og_i)const
 	{
-		fprintf(mFile,"\"%s.iog[%i].og[%i].gco\"",mName.c_str(),iog_i,og_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".iog[",iog_i); writeInt(mFile,"].og[",og_i,"].gco\"");
 	}
 	void getObjectGrpColor(size_t og_i)const
 	{
 
-		fprintf(mFile,"\"%s.iog.og[%i].gco\"",mName.c_str(),og_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".iog.og[",og_i,"].gco\"");
 	}
 	void getUseObjectColor()const
 	{
-		fprintf(mFile,"\"%s.uoc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uoc\"");
 	}
 	void getObjectColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getDrawOverride()const
 	{
-		fprintf(mFile,"\"%s.do\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do\"");
 	}
 	void getOverrideDisplayType()const
 	{
-		fprintf(mFile,"\"%s.do.ovdt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do.ovdt\"");
 	}
 	void getOverrideLevelOfDetail()const
 	{
-		fprintf(mFile,"\"%s.do.ovlod\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do.ovlod\"");
 	}
 	void getOverrideShading()const
 	{
-		fprintf(mFile,"\"%s.do.ovs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do.ovs\"");
 	}
 	void getOverrideTexturing()const
 	{
-		fprintf(mFile,"\"%s.do.ovt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do.ovt\"");
 	}
 	void getOverridePlayback()const
 	{
-		fprintf(mFile,"\"%s.do.ovp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do.ovp\"");
 	}
 	void getOverrideEnabled()const
 	{
-		fprintf(mFile,"\"%s.do.ove\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do.ove\"");
 	}
 	void getOverrideVisibility()const
 	{
-		fprintf(mFile,"\"%s.do.ovv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do.ovv\"");
 	}
 	void getOverrideColor()const
 	{
-		fprintf(mFile,"\"%s.do.ovc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do.ovc\"");
 	}
 	void getLodVisibility()const
 	{
-		fprintf(mFile,"\"%s.lodv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lodv\"");
 	}
 	void getRenderInfo()const
 	{
-		fprintf(mFile,"\"%s.ri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri\"");
 	}
 	void getIdentification()const
 	{
-		fprintf(mFile,"\"%s.ri.rlid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.rlid\"");
 	}
 	void getLayerRenderable()const
 	{
-		fprintf(mFile,"\"%s.ri.rndr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.rndr\"");
 	}
 	void getLayerOverrideColor()const
 	{
-		fprintf(mFile,"\"%s.ri.lovc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.lovc\"");
 	}
 	void getRenderLayerInfo(size_t rlio_i)const
 	{
-		fprintf(mFile,"\"%s.rlio[%i]\"",mName.c_str(),rlio_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rlio[",rlio_i,"]\"");
 	}
 	void getRenderLayerInfo()const
 	{
 
-		fprintf(mFile,"\"%s.rlio\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlio\"");
 	}
 	void getRenderLayerId(size_t rlio_i)const
 	{
-		fprintf(mFile,"\"%s.rlio[%i].rli\"",mName.c_str(),rlio_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rlio[",rlio_i,"].rli\"");
 	}
 	void getRenderLayerId()const
 	{
 
-		fprintf(mFile,"\"%s.rlio.rli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlio.rli\"");
 	}
 	void getRenderLayerRenderable(size_t rlio_i)const
 	{
-		fprintf(mFile,"\"%s.rlio[%i].rlr\"",mName.c_str(),rlio_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rlio[",rlio_i,"].rlr\"");
 	}
 	void getRenderLayerRenderable()const
 	{
 
-		fprintf(mFile,"\"%s.rlio.rlr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlio.rlr\"");
 	}
 	void getRenderLayerColor(size_t rlio_i)const
 	{
-		fprintf(mFile,"\"%s.rlio[%i].rlc\"",mName.c_str(),rlio_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rlio[",rlio_i,"].rlc\"");
 	}
 	void getRenderLayerColor()const
 	{
 
-		fprintf(mFile,"\"%s.rlio.rlc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlio.rlc\"");
 	}
 	void getGhostingControl()const
 	{
-		fprintf(mFile,"\"%s.gc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc\"");
 	}
 	void getGhostCustomSteps()const
 	{
-		fprintf(mFile,"\"%s.gcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gcs\"");
 	}
 	void getGhostPreSteps()const
 	{
-		fprintf(mFile,"\"%s.gcs.gpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gcs.gpr\"");
 	}
 	void getGhostPostSteps()const
 	{
-		fprintf(mFile,"\"%s.gcs.gps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gcs.gps\"");
 	}
 	void getGhostStepSize()const
 	{
-		fprintf(mFile,"\"%s.gcs.gss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gcs.gss\"");
 	}
 	void getGhostFrames()const
 	{
-		fprintf(mFile,"\"%s.gf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gf\"");
 	}
 	void getGhostRangeStart()const
 	{
-		fprintf(mFile,"\"%s.grs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grs\"");
 	}
 	void getGhostRangeEnd()const
 	{
-		fprintf(mFile,"\"%s.gre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gre\"");
 	}
 	void getGhostDriver()const
 	{
-		fprintf(mFile,"\"%s.gdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gdr\"");
 	}
 protected:
 	DagNode(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
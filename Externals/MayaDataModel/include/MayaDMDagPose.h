@@ -27,130 +27,130 @@ public:
 	void setWorldMatrix(size_t wm_i,const matrix& wm)
 	{
 		if(wm == identity) return;
-		fprintf(mFile,"\tsetAttr \".wm[%i]\" -type \"matrix\" ",wm_i);
+		writeInt(mFile,"\tsetAttr \".wm[",wm_i,"]\" -type \"matrix\" ");
 		wm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWorldMatrix(size_t wm_start,size_t wm_end,matrix* wm)
 	{
-		fprintf(mFile,"\tsetAttr \".wm[%i:%i]\" ", wm_start,wm_end);
+		writeInt(mFile,"\tsetAttr \".wm[",wm_start); writeInt(mFile,":",wm_end,"]\" ");
 		size_t size = (wm_end-wm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWorldMatrix(size_t wm_start,size_t wm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wm[%i:%i]\"",wm_start,wm_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".wm[",wm_start); writeInt(mFile,":",wm_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendWorldMatrix(const matrix& wm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wm.write(mFile);
 	}
 	void endWorldMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setXformMatrix(size_t xm_i,const matrix& xm)
 	{
 		if(xm == identity) return;
-		fprintf(mFile,"\tsetAttr \".xm[%i]\" -type \"matrix\" ",xm_i);
+		writeInt(mFile,"\tsetAttr \".xm[",xm_i,"]\" -type \"matrix\" ");
 		xm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setXformMatrix(size_t xm_start,size_t xm_end,matrix* xm)
 	{
-		fprintf(mFile,"\tsetAttr \".xm[%i:%i]\" ", xm_start,xm_end);
+		writeInt(mFile,"\tsetAttr \".xm[",xm_start); writeInt(mFile,":",xm_end,"]\" ");
 		size_t size = (xm_end-xm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			xm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startXformMatrix(size_t xm_start,size_t xm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".xm[%i:%i]\"",xm_start,xm_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".xm[",xm_start); writeInt(mFile,":",xm_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendXformMatrix(const matrix& xm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		xm.write(mFile);
 	}
 	void endXformMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlobal(size_t g_i,bool g)
 	{
 		if(g == false) return;
-		fprintf(mFile,"\tsetAttr \".g[%i]\" %i;\n", g_i,g);
+		writeInt(mFile,"\tsetAttr \".g[",g_i); writeInt(mFile,"]\" ",g,";\n");
 	}
 	void setGlobal(size_t g_start,size_t g_end,bool* g)
 	{
-		fprintf(mFile,"\tsetAttr \".g[%i:%i]\" ", g_start,g_end);
+		writeInt(mFile,"\tsetAttr \".g[",g_start); writeInt(mFile,":",g_end,"]\" ");
 		size_t size = (g_end-g_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",g[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",g[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGlobal(size_t g_start,size_t g_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".g[%i:%i]\"",g_start,g_end);
+		writeInt(mFile,"\tsetAttr \".g[",g_start); writeInt(mFile,":",g_end,"]\"");
 	}
 	void appendGlobal(bool g)const
 	{
-		fprintf(mFile," %i",g);
+		writeInt(mFile," ",g);
 	}
 	void endGlobal()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBindPose(bool bp)
 	{
 		if(bp == false) return;
-		fprintf(mFile,"\tsetAttr \".bp\" %i;\n", bp);
+		writeInt(mFile,"\tsetAttr \".bp\" ",bp,";\n");
 	}
 	void getWorldMatrix(size_t wm_i)const
 	{
-		fprintf(mFile,"\"%s.wm[%i]\"",mName.c_str(),wm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wm[",wm_i,"]\"");
 	}
 	void getWorldMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.wm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wm\"");
 	}
 	void getMembers(size_t m_i)const
 	{
-		fprintf(mFile,"\"%s.m[%i]\"",mName.c_str(),m_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".m[",m_i,"]\"");
 	}
 	void getMembers()const
 	{
 
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getParents(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getParents()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getWorld()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 protected:
 	DagPose(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,198 +26,198 @@ public:
 
 	void getLightDataArray(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i]\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"]\"");
 	}
 	void getLightDataArray()const
 	{
 
-		fprintf(mFile,"\"%s.lda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda\"");
 	}
 	void getLightDirection(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].ld\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].ld\"");
 	}
 	void getLightDirection()const
 	{
 
-		fprintf(mFile,"\"%s.lda.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.ld\"");
 	}
 	void getLightDirectionX(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].ld.ldx\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].ld.ldx\"");
 	}
 	void getLightDirectionX()const
 	{
 
-		fprintf(mFile,"\"%s.lda.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.ld.ldx\"");
 	}
 	void getLightDirectionY(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].ld.ldy\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].ld.ldy\"");
 	}
 	void getLightDirectionY()const
 	{
 
-		fprintf(mFile,"\"%s.lda.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.ld.ldy\"");
 	}
 	void getLightDirectionZ(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].ld.ldz\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].ld.ldz\"");
 	}
 	void getLightDirectionZ()const
 	{
 
-		fprintf(mFile,"\"%s.lda.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.ld.ldz\"");
 	}
 	void getLightIntensity(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].li\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].li\"");
 	}
 	void getLightIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.lda.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.li\"");
 	}
 	void getLightIntensityR(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].li.lir\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].li.lir\"");
 	}
 	void getLightIntensityR()const
 	{
 
-		fprintf(mFile,"\"%s.lda.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.li.lir\"");
 	}
 	void getLightIntensityG(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].li.lig\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].li.lig\"");
 	}
 	void getLightIntensityG()const
 	{
 
-		fprintf(mFile,"\"%s.lda.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.li.lig\"");
 	}
 	void getLightIntensityB(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].li.lib\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].li.lib\"");
 	}
 	void getLightIntensityB()const
 	{
 
-		fprintf(mFile,"\"%s.lda.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.li.lib\"");
 	}
 	void getLightAmbient(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].la\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].la\"");
 	}
 	void getLightAmbient()const
 	{
 
-		fprintf(mFile,"\"%s.lda.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.la\"");
 	}
 	void getLightDiffuse(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].ldf\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].ldf\"");
 	}
 	void getLightDiffuse()const
 	{
 
-		fprintf(mFile,"\"%s.lda.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.ldf\"");
 	}
 	void getLightSpecular(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].ls\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].ls\"");
 	}
 	void getLightSpecular()const
 	{
 
-		fprintf(mFile,"\"%s.lda.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.ls\"");
 	}
 	void getLightShadowFraction(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].lsf\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].lsf\"");
 	}
 	void getLightShadowFraction()const
 	{
 
-		fprintf(mFile,"\"%s.lda.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.lsf\"");
 	}
 	void getPreShadowIntensity(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].psi\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].psi\"");
 	}
 	void getPreShadowIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.lda.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.psi\"");
 	}
 	void getLightBlindData(size_t lda_i)const
 	{
-		fprintf(mFile,"\"%s.lda[%i].lbd\"",mName.c_str(),lda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lda[",lda_i,"].lbd\"");
 	}
 	void getLightBlindData()const
 	{
 
-		fprintf(mFile,"\"%s.lda.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda.lbd\"");
 	}
 	void getLightData()const
 	{
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirectionOut()const
 	{
-		fprintf(mFile,"\"%s.ltd.ldo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldo\"");
 	}
 	void getLightDirectionOutX()const
 	{
-		fprintf(mFile,"\"%s.ltd.ldo.lqx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldo.lqx\"");
 	}
 	void getLightDirectionOutY()const
 	{
-		fprintf(mFile,"\"%s.ltd.ldo.lqy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldo.lqy\"");
 	}
 	void getLightDirectionOutZ()const
 	{
-		fprintf(mFile,"\"%s.ltd.ldo.lqz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldo.lqz\"");
 	}
 	void getLightIntensityOut()const
 	{
-		fprintf(mFile,"\"%s.ltd.lw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lw\"");
 	}
 	void getLightIntensityOutR()const
 	{
-		fprintf(mFile,"\"%s.ltd.lw.lwr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lw.lwr\"");
 	}
 	void getLightIntensityOutG()const
 	{
-		fprintf(mFile,"\"%s.ltd.lw.lwg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lw.lwg\"");
 	}
 	void getLightIntensityOutB()const
 	{
-		fprintf(mFile,"\"%s.ltd.lw.lwb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lw.lwb\"");
 	}
 	void getLightAmbientOut()const
 	{
-		fprintf(mFile,"\"%s.ltd.lya\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lya\"");
 	}
 	void getLightDiffuseOut()const
 	{
-		fprintf(mFile,"\"%s.ltd.lyf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lyf\"");
 	}
 	void getLightSpecularOut()const
 	{
-		fprintf(mFile,"\"%s.ltd.lys\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lys\"");
 	}
 	void getLightShadowFractionOut()const
 	{
-		fprintf(mFile,"\"%s.ltd.sfo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.sfo\"");
 	}
 	void getPreShadowIntensityOut()const
 	{
-		fprintf(mFile,"\"%s.ltd.psio\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psio\"");
 	}
 	void getLightBlindDataOut()const
 	{
-		fprintf(mFile,"\"%s.ltd.lbdo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbdo\"");
 	}
 protected:
 	DefaultLightList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,12 +26,12 @@ public:
 
 	void getUtilities(size_t u_i)const
 	{
-		fprintf(mFile,"\"%s.u[%i]\"",mName.c_str(),u_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".u[",u_i,"]\"");
 	}
 	void getUtilities()const
 	{
 
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 protected:
 	DefaultRenderUtilityList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,12 +26,12 @@ public:
 
 	void getShaders(size_t s_i)const
 	{
-		fprintf(mFile,"\"%s.s[%i]\"",mName.c_str(),s_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".s[",s_i,"]\"");
 	}
 	void getShaders()const
 	{
 
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 protected:
 	DefaultShaderList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,12 +26,12 @@ public:
 
 	void getTextures(size_t tx_i)const
 	{
-		fprintf(mFile,"\"%s.tx[%i]\"",mName.c_str(),tx_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tx[",tx_i,"]\"");
 	}
 	void getTextures()const
 	{
 
-		fprintf(mFile,"\"%s.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx\"");
 	}
 protected:
 	DefaultTextureList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setLowBound(double lb)
 	{
 		if(lb == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".lb\" %f;\n", lb);
+		writeFloat(mFile,"\tsetAttr \".lb\" ",lb,";\n");
 	}
 	void setHighBound(double hb)
 	{
 		if(hb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".hb\" ",hb,";\n");
 	}
 	void setCurvature(double cur)
 	{
 		if(cur == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cur\" %f;\n", cur);
+		writeFloat(mFile,"\tsetAttr \".cur\" ",cur,";\n");
 	}
 	void getLowBound()const
 	{
-		fprintf(mFile,"\"%s.lb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lb\"");
 	}
 	void getHighBound()const
 	{
-		fprintf(mFile,"\"%s.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb\"");
 	}
 	void getCurvature()const
 	{
-		fprintf(mFile,"\"%s.cur\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cur\"");
 	}
 protected:
 	DeformBend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,65 +27,65 @@ public:
 	void setLowBound(double lb)
 	{
 		if(lb == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".lb\" %f;\n", lb);
+		writeFloat(mFile,"\tsetAttr \".lb\" ",lb,";\n");
 	}
 	void setHighBound(double hb)
 	{
 		if(hb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".hb\" ",hb,";\n");
 	}
 	void setStartFlareX(double sfx)
 	{
 		if(sfx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sfx\" %f;\n", sfx);
+		writeFloat(mFile,"\tsetAttr \".sfx\" ",sfx,";\n");
 	}
 	void setStartFlareZ(double sfz)
 	{
 		if(sfz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sfz\" %f;\n", sfz);
+		writeFloat(mFile,"\tsetAttr \".sfz\" ",sfz,";\n");
 	}
 	void setEndFlareX(double efx)
 	{
 		if(efx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".efx\" %f;\n", efx);
+		writeFloat(mFile,"\tsetAttr \".efx\" ",efx,";\n");
 	}
 	void setEndFlareZ(double efz)
 	{
 		if(efz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".efz\" %f;\n", efz);
+		writeFloat(mFile,"\tsetAttr \".efz\" ",efz,";\n");
 	}
 	void setCurve(double crv)
 	{
 		if(crv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crv\" %f;\n", crv);
+		writeFloat(mFile,"\tsetAttr \".crv\" ",crv,";\n");
 	}
 	void getLowBound()const
 	{
-		fprintf(mFile,"\"%s.lb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lb\"");
 	}
 	void getHighBound()const
 	{
-		fprintf(mFile,"\"%s.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb\"");
 	}
 	void getStartFlareX()const
 	{
-		fprintf(mFile,"\"%s.sfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfx\"");
 	}
 	void getStartFlareZ()const
 	{
-		fprintf(mFile,"\"%s.sfz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfz\"");
 	}
 	void getEndFlareX()const
 	{
-		fprintf(mFile,"\"%s.efx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".efx\"");
 	}
 	void getEndFlareZ()const
 	{
-		fprintf(mFile,"\"%s.efz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".efz\"");
 	}
 	void getCurve()const
 	{
-		fprintf(mFile,"\"%s.crv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crv\"");
 	}
 protected:
 	DeformFlare(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,22 +27,22 @@ public:
 	void setDeformerData(const doubleArray& dd)
 	{
 		if(dd.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".dd\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".dd\" -type \"doubleArray\" ");
 		dd.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHandleWidth(double hw)
 	{
 		if(hw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hw\" %f;\n", hw);
+		writeFloat(mFile,"\tsetAttr \".hw\" ",hw,";\n");
 	}
 	void getDeformerData()const
 	{
-		fprintf(mFile,"\"%s.dd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dd\"");
 	}
 	void getHandleWidth()const
 	{
-		fprintf(mFile,"\"%s.hw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hw\"");
 	}
 protected:
 	DeformFunc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
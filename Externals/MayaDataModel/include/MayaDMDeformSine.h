@@ -27,56 +27,56 @@ public:
 	void setLowBound(double lb)
 	{
 		if(lb == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".lb\" %f;\n", lb);
+		writeFloat(mFile,"\tsetAttr \".lb\" ",lb,";\n");
 	}
 	void setHighBound(double hb)
 	{
 		if(hb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".hb\" ",hb,";\n");
 	}
 	void setAmplitude(double amp)
 	{
 		if(amp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".amp\" %f;\n", amp);
+		writeFloat(mFile,"\tsetAttr \".amp\" ",amp,";\n");
 	}
 	void setWavelength(double wav)
 	{
 		if(wav == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".wav\" %f;\n", wav);
+		writeFloat(mFile,"\tsetAttr \".wav\" ",wav,";\n");
 	}
 	void setDropoff(double dr)
 	{
 		if(dr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dr\" %f;\n", dr);
+		writeFloat(mFile,"\tsetAttr \".dr\" ",dr,";\n");
 	}
 	void setOffset(double off)
 	{
 		if(off == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".off\" %f;\n", off);
+		writeFloat(mFile,"\tsetAttr \".off\" ",off,";\n");
 	}
 	void getLowBound()const
 	{
-		fprintf(mFile,"\"%s.lb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lb\"");
 	}
 	void getHighBound()const
 	{
-		fprintf(mFile,"\"%s.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb\"");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.amp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amp\"");
 	}
 	void getWavelength()const
 	{
-		fprintf(mFile,"\"%s.wav\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wav\"");
 	}
 	void getDropoff()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.off\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".off\"");
 	}
 protected:
 	DeformSine(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,65 +27,65 @@ public:
 	void setLowBound(double lb)
 	{
 		if(lb == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".lb\" %f;\n", lb);
+		writeFloat(mFile,"\tsetAttr \".lb\" ",lb,";\n");
 	}
 	void setHighBound(double hb)
 	{
 		if(hb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".hb\" ",hb,";\n");
 	}
 	void setStartSmoothness(double ss)
 	{
 		if(ss == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %f;\n", ss);
+		writeFloat(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setEndSmoothness(double es)
 	{
 		if(es == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".es\" %f;\n", es);
+		writeFloat(mFile,"\tsetAttr \".es\" ",es,";\n");
 	}
 	void setMaxExpandPos(double mp)
 	{
 		if(mp == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mp\" %f;\n", mp);
+		writeFloat(mFile,"\tsetAttr \".mp\" ",mp,";\n");
 	}
 	void setExpand(double exp)
 	{
 		if(exp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".exp\" %f;\n", exp);
+		writeFloat(mFile,"\tsetAttr \".exp\" ",exp,";\n");
 	}
 	void setFactor(double fac)
 	{
 		if(fac == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fac\" %f;\n", fac);
+		writeFloat(mFile,"\tsetAttr \".fac\" ",fac,";\n");
 	}
 	void getLowBound()const
 	{
-		fprintf(mFile,"\"%s.lb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lb\"");
 	}
 	void getHighBound()const
 	{
-		fprintf(mFile,"\"%s.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb\"");
 	}
 	void getStartSmoothness()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getEndSmoothness()const
 	{
-		fprintf(mFile,"\"%s.es\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".es\"");
 	}
 	void getMaxExpandPos()const
 	{
-		fprintf(mFile,"\"%s.mp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mp\"");
 	}
 	void getExpand()const
 	{
-		fprintf(mFile,"\"%s.exp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".exp\"");
 	}
 	void getFactor()const
 	{
-		fprintf(mFile,"\"%s.fac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fac\"");
 	}
 protected:
 	DeformSquash(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,38 +27,38 @@ public:
 	void setLowBound(double lb)
 	{
 		if(lb == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".lb\" %f;\n", lb);
+		writeFloat(mFile,"\tsetAttr \".lb\" ",lb,";\n");
 	}
 	void setHighBound(double hb)
 	{
 		if(hb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".hb\" ",hb,";\n");
 	}
 	void setStartAngle(double sa)
 	{
 		if(sa == 0) return;
-		fprintf(mFile,"\tsetAttr \".sa\" %f;\n", sa);
+		writeFloat(mFile,"\tsetAttr \".sa\" ",sa,";\n");
 	}
 	void setEndAngle(double ea)
 	{
 		if(ea == 0) return;
-		fprintf(mFile,"\tsetAttr \".ea\" %f;\n", ea);
+		writeFloat(mFile,"\tsetAttr \".ea\" ",ea,";\n");
 	}
 	void getLowBound()const
 	{
-		fprintf(mFile,"\"%s.lb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lb\"");
 	}
 	void getHighBound()const
 	{
-		fprintf(mFile,"\"%s.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb\"");
 	}
 	void getStartAngle()const
 	{
-		fprintf(mFile,"\"%s.sa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sa\"");
 	}
 	void getEndAngle()const
 	{
-		fprintf(mFile,"\"%s.ea\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ea\"");
 	}
 protected:
 	DeformTwist(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,65 +27,65 @@ public:
 	void setMaxRadius(double mxr)
 	{
 		if(mxr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mxr\" %f;\n", mxr);
+		writeFloat(mFile,"\tsetAttr \".mxr\" ",mxr,";\n");
 	}
 	void setMinRadius(double mnr)
 	{
 		if(mnr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mnr\" %f;\n", mnr);
+		writeFloat(mFile,"\tsetAttr \".mnr\" ",mnr,";\n");
 	}
 	void setAmplitude(double amp)
 	{
 		if(amp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".amp\" %f;\n", amp);
+		writeFloat(mFile,"\tsetAttr \".amp\" ",amp,";\n");
 	}
 	void setWavelength(double wav)
 	{
 		if(wav == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wav\" %f;\n", wav);
+		writeFloat(mFile,"\tsetAttr \".wav\" ",wav,";\n");
 	}
 	void setDropoff(double dr)
 	{
 		if(dr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dr\" %f;\n", dr);
+		writeFloat(mFile,"\tsetAttr \".dr\" ",dr,";\n");
 	}
 	void setDropoffPosition(double dp)
 	{
 		if(dp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dp\" %f;\n", dp);
+		writeFloat(mFile,"\tsetAttr \".dp\" ",dp,";\n");
 	}
 	void setOffset(double off)
 	{
 		if(off == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".off\" %f;\n", off);
+		writeFloat(mFile,"\tsetAttr \".off\" ",off,";\n");
 	}
 	void getMaxRadius()const
 	{
-		fprintf(mFile,"\"%s.mxr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxr\"");
 	}
 	void getMinRadius()const
 	{
-		fprintf(mFile,"\"%s.mnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mnr\"");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.amp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amp\"");
 	}
 	void getWavelength()const
 	{
-		fprintf(mFile,"\"%s.wav\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wav\"");
 	}
 	void getDropoff()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getDropoffPosition()const
 	{
-		fprintf(mFile,"\"%s.dp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dp\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.off\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".off\"");
 	}
 protected:
 	DeformWave(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
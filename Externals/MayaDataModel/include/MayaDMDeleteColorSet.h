@@ -27,21 +27,21 @@ public:
 	void setColorSetName(const string& cols)
 	{
 		if(cols == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cols\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cols\" -type \"string\" ");
 		cols.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ig\"");
 	}
 	void getOutputGeometry()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 	void getColorSetName()const
 	{
-		fprintf(mFile,"\"%s.cols\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cols\"");
 	}
 protected:
 	DeleteColorSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
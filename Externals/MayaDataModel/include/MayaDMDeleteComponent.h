@@ -26,26 +26,26 @@ public:
 
 	void setDeleteComponents(const componentList& dc)
 	{
-		fprintf(mFile,"\tsetAttr \".dc\" -type \"componentList\" ");
+		writeString(mFile,"\tsetAttr \".dc\" -type \"componentList\" ");
 		dc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseOldPolyArchitecture(bool uopa)
 	{
 		if(uopa == false) return;
-		fprintf(mFile,"\tsetAttr \".uopa\" %i;\n", uopa);
+		writeInt(mFile,"\tsetAttr \".uopa\" ",uopa,";\n");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ig\"");
 	}
 	void getDeleteComponents()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getOutputGeometry()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 protected:
 	DeleteComponent(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -64,40 +64,40 @@ public:
 	void setIsHistoricallyInteresting(unsigned char ihi)
 	{
 		if(ihi == 2) return;
-		fprintf(mFile,"\tsetAttr \".ihi\" %i;\n", ihi);
+		writeInt(mFile,"\tsetAttr \".ihi\" ",ihi,";\n");
 	}
 	void setCaching(bool cch)
 	{
 		if(cch == false) return;
-		fprintf(mFile,"\tsetAttr \".cch\" %i;\n", cch);
+		writeInt(mFile,"\tsetAttr \".cch\" ",cch,";\n");
 	}
 	void setNodeState(unsigned int nds)
 	{
 		if(nds == 0) return;
-		fprintf(mFile,"\tsetAttr \".nds\" %i;\n", nds);
+		writeInt(mFile,"\tsetAttr \".nds\" ",nds,";\n");
 	}
 	void setBinMembership(const string& bnm)
 	{
 		if(bnm == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bnm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bnm\" -type \"string\" ");
 		bnm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getMessage()const
 	{
-		fprintf(mFile,"\"%s.msg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msg\"");
 	}
 	void getIsHistoricallyInteresting()const
 	{
-		fprintf(mFile,"\"%s.ihi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ihi\"");
 	}
 	void getCaching()const
 	{
-		fprintf(mFile,"\"%s.cch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cch\"");
 	}
 	void getNodeState()const
 	{
-		fprintf(mFile,"\"%s.nds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nds\"");
 	}
 protected:
 	DependNode(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -109,13 +109,13 @@ protected:
 private:
 	void createNode()const
 	{
+		writeString(mFile,"createNode ",mNodeType.c_str());
 		if(mShared)
-			fprintf(mFile, "createNode %s -s -n \"%s\"", mNodeType.c_str(),mName.c_str());
-		else
-			fprintf(mFile, "createNode %s -n \"%s\"", mNodeType.c_str(),mName.c_str());
+			writeString(mFile," -s");
+		writeString(mFile," -n \"",mName.c_str(),"\"");
 		if(mParent != "") 
-			fprintf(mFile, " -p \"%s\"", mParent.c_str());
-		fprintf(mFile, ";\n");
+			writeString(mFile," -p \"",mParent.c_str(),"\"");
+		writeString(mFile,";\n");
 	}
 
 };
@@ -27,89 +27,89 @@ public:
 	void setParameter(size_t p_i,double p)
 	{
 		if(p == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p[%i]\" %f;\n", p_i,p);
+		writeInt(mFile,"\tsetAttr \".p[",p_i); writeFloat(mFile,"]\" ",p,";\n");
 	}
 	void setParameter(size_t p_start,size_t p_end,double* p)
 	{
-		fprintf(mFile,"\tsetAttr \".p[%i:%i]\" ", p_start,p_end);
+		writeInt(mFile,"\tsetAttr \".p[",p_start); writeInt(mFile,":",p_end,"]\" ");
 		size_t size = (p_end-p_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",p[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",p[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startParameter(size_t p_start,size_t p_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".p[%i:%i]\"",p_start,p_end);
+		writeInt(mFile,"\tsetAttr \".p[",p_start); writeInt(mFile,":",p_end,"]\"");
 	}
 	void appendParameter(double p)const
 	{
-		fprintf(mFile," %f",p);
+		writeFloat(mFile," ",p);
 	}
 	void endParameter()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeep(size_t k_i,bool k)
 	{
 		if(k == true) return;
-		fprintf(mFile,"\tsetAttr \".k[%i]\" %i;\n", k_i,k);
+		writeInt(mFile,"\tsetAttr \".k[",k_i); writeInt(mFile,"]\" ",k,";\n");
 	}
 	void setKeep(size_t k_start,size_t k_end,bool* k)
 	{
-		fprintf(mFile,"\tsetAttr \".k[%i:%i]\" ", k_start,k_end);
+		writeInt(mFile,"\tsetAttr \".k[",k_start); writeInt(mFile,":",k_end,"]\" ");
 		size_t size = (k_end-k_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",k[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",k[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startKeep(size_t k_start,size_t k_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".k[%i:%i]\"",k_start,k_end);
+		writeInt(mFile,"\tsetAttr \".k[",k_start); writeInt(mFile,":",k_end,"]\"");
 	}
 	void appendKeep(bool k)const
 	{
-		fprintf(mFile," %i",k);
+		writeInt(mFile," ",k);
 	}
 	void endKeep()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getOutputCurve(size_t oc_i)const
 	{
-		fprintf(mFile,"\"%s.oc[%i]\"",mName.c_str(),oc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oc[",oc_i,"]\"");
 	}
 	void getOutputCurve()const
 	{
 
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getParameter(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getParameter()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getKeep(size_t k_i)const
 	{
-		fprintf(mFile,"\"%s.k[%i]\"",mName.c_str(),k_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".k[",k_i,"]\"");
 	}
 	void getKeep()const
 	{
 
-		fprintf(mFile,"\"%s.k\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".k\"");
 	}
 protected:
 	DetachCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
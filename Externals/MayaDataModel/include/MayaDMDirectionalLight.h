@@ -40,28 +40,28 @@ public:
 		bool smapDetailAlpha;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miExportMrLight);
-			fprintf(file,"%i ", emitPhotons);
+			writeInt(file,"",miExportMrLight," ");
+			writeInt(file,"",emitPhotons," ");
 			energy.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", photonIntensity);
-			fprintf(file,"%f ", exponent);
-			fprintf(file,"%i ", causticPhotons);
-			fprintf(file,"%i ", globIllPhotons);
-			fprintf(file,"%i ", shadowMap);
-			fprintf(file,"%i ", smapResolution);
-			fprintf(file,"%i ", smapSamples);
-			fprintf(file,"%f ", smapSoftness);
-			fprintf(file,"%f ", smapBias);
+			writeString(file," ");
+			writeFloat(file,"",photonIntensity," ");
+			writeFloat(file,"",exponent," ");
+			writeInt(file,"",causticPhotons," ");
+			writeInt(file,"",globIllPhotons," ");
+			writeInt(file,"",shadowMap," ");
+			writeInt(file,"",smapResolution," ");
+			writeInt(file,"",smapSamples," ");
+			writeFloat(file,"",smapSoftness," ");
+			writeFloat(file,"",smapBias," ");
 			smapFilename.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", smapLightName);
-			fprintf(file,"%i ", smapSceneName);
-			fprintf(file,"%i ", smapFrameExt);
-			fprintf(file,"%i ", smapDetail);
-			fprintf(file,"%i ", smapDetailSamples);
-			fprintf(file,"%f ", smapDetailAccuracy);
-			fprintf(file,"%i", smapDetailAlpha);
+			writeString(file," ");
+			writeInt(file,"",smapLightName," ");
+			writeInt(file,"",smapSceneName," ");
+			writeInt(file,"",smapFrameExt," ");
+			writeInt(file,"",smapDetail," ");
+			writeInt(file,"",smapDetailSamples," ");
+			writeFloat(file,"",smapDetailAccuracy," ");
+			writeInt(file,"",smapDetailAlpha);
 		}
 	};
 public:
@@ -74,7 +74,7 @@ public:
 	void setUseLightPosition(bool up)
 	{
 		if(up == false) return;
-		fprintf(mFile,"\tsetAttr \".up\" %i;\n", up);
+		writeInt(mFile,"\tsetAttr \".up\" ",up,";\n");
 	}
 	void setObjectType(char ot)
 	{
@@ -84,289 +84,289 @@ public:
 	void setLightAngle(float lang)
 	{
 		if(lang == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lang\" %f;\n", lang);
+		writeFloat(mFile,"\tsetAttr \".lang\" ",lang,";\n");
 	}
 	void setPointWorld(const float3& pw)
 	{
 		if(pw == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
 		pw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointWorldX(float tx)
 	{
 		if(tx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.tx\" %f;\n", tx);
+		writeFloat(mFile,"\tsetAttr \".pw.tx\" ",tx,";\n");
 	}
 	void setPointWorldY(float ty)
 	{
 		if(ty == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.ty\" %f;\n", ty);
+		writeFloat(mFile,"\tsetAttr \".pw.ty\" ",ty,";\n");
 	}
 	void setPointWorldZ(float tz)
 	{
 		if(tz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.tz\" %f;\n", tz);
+		writeFloat(mFile,"\tsetAttr \".pw.tz\" ",tz,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiExportMrLight(bool milt)
 	{
 		if(milt == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.milt\" %i;\n", milt);
+		writeInt(mFile,"\tsetAttr \".mrc.milt\" ",milt,";\n");
 	}
 	void setEmitPhotons(bool phot)
 	{
 		if(phot == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.phot\" %i;\n", phot);
+		writeInt(mFile,"\tsetAttr \".mrc.phot\" ",phot,";\n");
 	}
 	void setEnergy(const float3& eng)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc.eng\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mrc.eng\" -type \"float3\" ");
 		eng.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnergyR(float engr)
 	{
 		if(engr == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engr\" %f;\n", engr);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engr\" ",engr,";\n");
 	}
 	void setEnergyG(float engg)
 	{
 		if(engg == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engg\" %f;\n", engg);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engg\" ",engg,";\n");
 	}
 	void setEnergyB(float engb)
 	{
 		if(engb == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engb\" %f;\n", engb);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engb\" ",engb,";\n");
 	}
 	void setPhotonIntensity(float phi)
 	{
 		if(phi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.phi\" %f;\n", phi);
+		writeFloat(mFile,"\tsetAttr \".mrc.phi\" ",phi,";\n");
 	}
 	void setExponent(float exp)
 	{
 		if(exp == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.exp\" %f;\n", exp);
+		writeFloat(mFile,"\tsetAttr \".mrc.exp\" ",exp,";\n");
 	}
 	void setCausticPhotons(int cph)
 	{
 		if(cph == 10000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.cph\" %i;\n", cph);
+		writeInt(mFile,"\tsetAttr \".mrc.cph\" ",cph,";\n");
 	}
 	void setGlobIllPhotons(int gph)
 	{
 		if(gph == 10000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gph\" %i;\n", gph);
+		writeInt(mFile,"\tsetAttr \".mrc.gph\" ",gph,";\n");
 	}
 	void setShadowMap(bool usm)
 	{
 		if(usm == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.usm\" %i;\n", usm);
+		writeInt(mFile,"\tsetAttr \".mrc.usm\" ",usm,";\n");
 	}
 	void setSmapResolution(int smr)
 	{
 		if(smr == 256) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smr\" %i;\n", smr);
+		writeInt(mFile,"\tsetAttr \".mrc.smr\" ",smr,";\n");
 	}
 	void setSmapSamples(short smsa)
 	{
 		if(smsa == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smsa\" %i;\n", smsa);
+		writeInt(mFile,"\tsetAttr \".mrc.smsa\" ",smsa,";\n");
 	}
 	void setSmapSoftness(float smso)
 	{
 		if(smso == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smso\" %f;\n", smso);
+		writeFloat(mFile,"\tsetAttr \".mrc.smso\" ",smso,";\n");
 	}
 	void setSmapBias(float smb)
 	{
 		if(smb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smb\" %f;\n", smb);
+		writeFloat(mFile,"\tsetAttr \".mrc.smb\" ",smb,";\n");
 	}
 	void setSmapFilename(const string& smf)
 	{
 		if(smf == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".mrc.smf\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".mrc.smf\" -type \"string\" ");
 		smf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSmapLightName(bool smln)
 	{
 		if(smln == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smln\" %i;\n", smln);
+		writeInt(mFile,"\tsetAttr \".mrc.smln\" ",smln,";\n");
 	}
 	void setSmapSceneName(bool smsn)
 	{
 		if(smsn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smsn\" %i;\n", smsn);
+		writeInt(mFile,"\tsetAttr \".mrc.smsn\" ",smsn,";\n");
 	}
 	void setSmapFrameExt(bool smfe)
 	{
 		if(smfe == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smfe\" %i;\n", smfe);
+		writeInt(mFile,"\tsetAttr \".mrc.smfe\" ",smfe,";\n");
 	}
 	void setSmapDetail(bool smd)
 	{
 		if(smd == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smd\" %i;\n", smd);
+		writeInt(mFile,"\tsetAttr \".mrc.smd\" ",smd,";\n");
 	}
 	void setSmapDetailSamples(short sds)
 	{
 		if(sds == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sds\" %i;\n", sds);
+		writeInt(mFile,"\tsetAttr \".mrc.sds\" ",sds,";\n");
 	}
 	void setSmapDetailAccuracy(float sdac)
 	{
 		if(sdac == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sdac\" %f;\n", sdac);
+		writeFloat(mFile,"\tsetAttr \".mrc.sdac\" ",sdac,";\n");
 	}
 	void setSmapDetailAlpha(bool sdal)
 	{
 		if(sdal == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sdal\" %i;\n", sdal);
+		writeInt(mFile,"\tsetAttr \".mrc.sdal\" ",sdal,";\n");
 	}
 	void getUseLightPosition()const
 	{
-		fprintf(mFile,"\"%s.up\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".up\"");
 	}
 	void getObjectType()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getLightAngle()const
 	{
-		fprintf(mFile,"\"%s.lang\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lang\"");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.pw.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.tx\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.pw.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.ty\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.pw.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.tz\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiExportMrLight()const
 	{
-		fprintf(mFile,"\"%s.mrc.milt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.milt\"");
 	}
 	void getMiLightShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.mils\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mils\"");
 	}
 	void getMiPhotonEmitter()const
 	{
-		fprintf(mFile,"\"%s.mrc.mipe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mipe\"");
 	}
 	void getEmitPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.phot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.phot\"");
 	}
 	void getEnergy()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng\"");
 	}
 	void getEnergyR()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engr\"");
 	}
 	void getEnergyG()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engg\"");
 	}
 	void getEnergyB()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engb\"");
 	}
 	void getPhotonIntensity()const
 	{
-		fprintf(mFile,"\"%s.mrc.phi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.phi\"");
 	}
 	void getExponent()const
 	{
-		fprintf(mFile,"\"%s.mrc.exp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.exp\"");
 	}
 	void getCausticPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.cph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.cph\"");
 	}
 	void getGlobIllPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.gph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gph\"");
 	}
 	void getShadowMap()const
 	{
-		fprintf(mFile,"\"%s.mrc.usm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.usm\"");
 	}
 	void getSmapResolution()const
 	{
-		fprintf(mFile,"\"%s.mrc.smr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smr\"");
 	}
 	void getSmapSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.smsa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smsa\"");
 	}
 	void getSmapSoftness()const
 	{
-		fprintf(mFile,"\"%s.mrc.smso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smso\"");
 	}
 	void getSmapBias()const
 	{
-		fprintf(mFile,"\"%s.mrc.smb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smb\"");
 	}
 	void getSmapCamera()const
 	{
-		fprintf(mFile,"\"%s.mrc.smc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smc\"");
 	}
 	void getSmapFilename()const
 	{
-		fprintf(mFile,"\"%s.mrc.smf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smf\"");
 	}
 	void getSmapLightName()const
 	{
-		fprintf(mFile,"\"%s.mrc.smln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smln\"");
 	}
 	void getSmapSceneName()const
 	{
-		fprintf(mFile,"\"%s.mrc.smsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smsn\"");
 	}
 	void getSmapFrameExt()const
 	{
-		fprintf(mFile,"\"%s.mrc.smfe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smfe\"");
 	}
 	void getSmapDetail()const
 	{
-		fprintf(mFile,"\"%s.mrc.smd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smd\"");
 	}
 	void getSmapDetailSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.sds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sds\"");
 	}
 	void getSmapDetailAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.sdac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sdac\"");
 	}
 	void getSmapDetailAlpha()const
 	{
-		fprintf(mFile,"\"%s.mrc.sdal\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sdal\"");
 	}
 protected:
 	DirectionalLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,73 +27,73 @@ public:
 	void setEnable(bool ebl)
 	{
 		if(ebl == true) return;
-		fprintf(mFile,"\tsetAttr \".ebl\" %i;\n", ebl);
+		writeInt(mFile,"\tsetAttr \".ebl\" ",ebl,";\n");
 	}
 	void setCacheName(const string& cn)
 	{
 		if(cn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cn\" -type \"string\" ");
 		cn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCacheType(const string& ct)
 	{
 		if(ct == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ct\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ct\" -type \"string\" ");
 		ct.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHiddenCacheName(const string& hcn)
 	{
 		if(hcn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".hcn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".hcn\" -type \"string\" ");
 		hcn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCopyLocally(bool cpl)
 	{
 		if(cpl == true) return;
-		fprintf(mFile,"\tsetAttr \".cpl\" %i;\n", cpl);
+		writeInt(mFile,"\tsetAttr \".cpl\" ",cpl,";\n");
 	}
 	void getDiskCache()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getEnable()const
 	{
-		fprintf(mFile,"\"%s.ebl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ebl\"");
 	}
 	void getCacheName()const
 	{
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getStartTime()const
 	{
-		fprintf(mFile,"\"%s.stim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stim\"");
 	}
 	void getEndTime()const
 	{
-		fprintf(mFile,"\"%s.etim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".etim\"");
 	}
 	void getSamplingType()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getSamplingRate()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getCacheType()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getHiddenCacheName()const
 	{
-		fprintf(mFile,"\"%s.hcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcn\"");
 	}
 	void getCopyLocally()const
 	{
-		fprintf(mFile,"\"%s.cpl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpl\"");
 	}
 protected:
 	DiskCache(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setDisplacement(float d)
 	{
 		if(d == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void getDisplacement()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 protected:
 	DisplacementShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -28,14 +28,14 @@ public:
 		unsigned char color;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", displayType);
-			fprintf(file,"%i ", levelOfDetail);
-			fprintf(file,"%i ", shading);
-			fprintf(file,"%i ", texturing);
-			fprintf(file,"%i ", playback);
-			fprintf(file,"%i ", enabled);
-			fprintf(file,"%i ", visibility);
-			fprintf(file,"%i", color);
+			writeInt(file,"",displayType," ");
+			writeInt(file,"",levelOfDetail," ");
+			writeInt(file,"",shading," ");
+			writeInt(file,"",texturing," ");
+			writeInt(file,"",playback," ");
+			writeInt(file,"",enabled," ");
+			writeInt(file,"",visibility," ");
+			writeInt(file,"",color);
 		}
 	};
 public:
@@ -48,102 +48,102 @@ public:
 	void setIdentification(short id)
 	{
 		if(id == 0) return;
-		fprintf(mFile,"\tsetAttr \".id\" %i;\n", id);
+		writeInt(mFile,"\tsetAttr \".id\" ",id,";\n");
 	}
 	void setDrawInfo(const DrawInfo& di)
 	{
-		fprintf(mFile,"\tsetAttr \".di\" ");
+		writeString(mFile,"\tsetAttr \".di\" ");
 		di.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplayType(unsigned int dt)
 	{
 		if(dt == 0) return;
-		fprintf(mFile,"\tsetAttr \".di.dt\" %i;\n", dt);
+		writeInt(mFile,"\tsetAttr \".di.dt\" ",dt,";\n");
 	}
 	void setLevelOfDetail(unsigned int lod)
 	{
 		if(lod == 0) return;
-		fprintf(mFile,"\tsetAttr \".di.lod\" %i;\n", lod);
+		writeInt(mFile,"\tsetAttr \".di.lod\" ",lod,";\n");
 	}
 	void setShading(bool s)
 	{
 		if(s == true) return;
-		fprintf(mFile,"\tsetAttr \".di.s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".di.s\" ",s,";\n");
 	}
 	void setTexturing(bool t)
 	{
 		if(t == true) return;
-		fprintf(mFile,"\tsetAttr \".di.t\" %i;\n", t);
+		writeInt(mFile,"\tsetAttr \".di.t\" ",t,";\n");
 	}
 	void setPlayback(bool p)
 	{
 		if(p == true) return;
-		fprintf(mFile,"\tsetAttr \".di.p\" %i;\n", p);
+		writeInt(mFile,"\tsetAttr \".di.p\" ",p,";\n");
 	}
 	void setEnabled(bool e)
 	{
 		if(e == true) return;
-		fprintf(mFile,"\tsetAttr \".di.e\" %i;\n", e);
+		writeInt(mFile,"\tsetAttr \".di.e\" ",e,";\n");
 	}
 	void setVisibility(bool v)
 	{
 		if(v == true) return;
-		fprintf(mFile,"\tsetAttr \".di.v\" %i;\n", v);
+		writeInt(mFile,"\tsetAttr \".di.v\" ",v,";\n");
 	}
 	void setColor(unsigned char c)
 	{
 		if(c == 0) return;
-		fprintf(mFile,"\tsetAttr \".di.c\" %i;\n", c);
+		writeInt(mFile,"\tsetAttr \".di.c\" ",c,";\n");
 	}
 	void setDisplayOrder(short do_)
 	{
 		if(do_ == 0) return;
-		fprintf(mFile,"\tsetAttr \".do\" %i;\n", do_);
+		writeInt(mFile,"\tsetAttr \".do\" ",do_,";\n");
 	}
 	void getIdentification()const
 	{
-		fprintf(mFile,"\"%s.id\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".id\"");
 	}
 	void getDrawInfo()const
 	{
-		fprintf(mFile,"\"%s.di\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di\"");
 	}
 	void getDisplayType()const
 	{
-		fprintf(mFile,"\"%s.di.dt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di.dt\"");
 	}
 	void getLevelOfDetail()const
 	{
-		fprintf(mFile,"\"%s.di.lod\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di.lod\"");
 	}
 	void getShading()const
 	{
-		fprintf(mFile,"\"%s.di.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di.s\"");
 	}
 	void getTexturing()const
 	{
-		fprintf(mFile,"\"%s.di.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di.t\"");
 	}
 	void getPlayback()const
 	{
-		fprintf(mFile,"\"%s.di.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di.p\"");
 	}
 	void getEnabled()const
 	{
-		fprintf(mFile,"\"%s.di.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di.e\"");
 	}
 	void getVisibility()const
 	{
-		fprintf(mFile,"\"%s.di.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di.v\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.di.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di.c\"");
 	}
 	void getDisplayOrder()const
 	{
-		fprintf(mFile,"\"%s.do\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do\"");
 	}
 protected:
 	DisplayLayer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,48 +27,48 @@ public:
 	void setCurrentDisplayLayer(short cdl)
 	{
 		if(cdl == 0) return;
-		fprintf(mFile,"\tsetAttr \".cdl\" %i;\n", cdl);
+		writeInt(mFile,"\tsetAttr \".cdl\" ",cdl,";\n");
 	}
 	void setDisplayLayerId(size_t dli_i,short dli)
 	{
 		if(dli == 0) return;
-		fprintf(mFile,"\tsetAttr \".dli[%i]\" %i;\n", dli_i,dli);
+		writeInt(mFile,"\tsetAttr \".dli[",dli_i); writeInt(mFile,"]\" ",dli,";\n");
 	}
 	void setDisplayLayerId(size_t dli_start,size_t dli_end,short* dli)
 	{
-		fprintf(mFile,"\tsetAttr \".dli[%i:%i]\" ", dli_start,dli_end);
+		writeInt(mFile,"\tsetAttr \".dli[",dli_start); writeInt(mFile,":",dli_end,"]\" ");
 		size_t size = (dli_end-dli_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",dli[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",dli[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDisplayLayerId(size_t dli_start,size_t dli_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".dli[%i:%i]\"",dli_start,dli_end);
+		writeInt(mFile,"\tsetAttr \".dli[",dli_start); writeInt(mFile,":",dli_end,"]\"");
 	}
 	void appendDisplayLayerId(short dli)const
 	{
-		fprintf(mFile," %i",dli);
+		writeInt(mFile," ",dli);
 	}
 	void endDisplayLayerId()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getCurrentDisplayLayer()const
 	{
-		fprintf(mFile,"\"%s.cdl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdl\"");
 	}
 	void getDisplayLayerId(size_t dli_i)const
 	{
-		fprintf(mFile,"\"%s.dli[%i]\"",mName.c_str(),dli_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dli[",dli_i,"]\"");
 	}
 	void getDisplayLayerId()const
 	{
 
-		fprintf(mFile,"\"%s.dli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dli\"");
 	}
 protected:
 	DisplayLayerManager(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
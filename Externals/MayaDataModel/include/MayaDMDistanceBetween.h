@@ -26,103 +26,103 @@ public:
 
 	void setPoint1(const double3& p1)
 	{
-		fprintf(mFile,"\tsetAttr \".p1\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".p1\" -type \"double3\" ");
 		p1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoint1X(double p1x)
 	{
 		if(p1x == 0) return;
-		fprintf(mFile,"\tsetAttr \".p1.p1x\" %f;\n", p1x);
+		writeFloat(mFile,"\tsetAttr \".p1.p1x\" ",p1x,";\n");
 	}
 	void setPoint1Y(double p1y)
 	{
 		if(p1y == 0) return;
-		fprintf(mFile,"\tsetAttr \".p1.p1y\" %f;\n", p1y);
+		writeFloat(mFile,"\tsetAttr \".p1.p1y\" ",p1y,";\n");
 	}
 	void setPoint1Z(double p1z)
 	{
 		if(p1z == 0) return;
-		fprintf(mFile,"\tsetAttr \".p1.p1z\" %f;\n", p1z);
+		writeFloat(mFile,"\tsetAttr \".p1.p1z\" ",p1z,";\n");
 	}
 	void setInMatrix1(const matrix& im1)
 	{
 		if(im1 == identity) return;
-		fprintf(mFile,"\tsetAttr \".im1\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".im1\" -type \"matrix\" ");
 		im1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoint2(const double3& p2)
 	{
-		fprintf(mFile,"\tsetAttr \".p2\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".p2\" -type \"double3\" ");
 		p2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoint2X(double p2x)
 	{
 		if(p2x == 0) return;
-		fprintf(mFile,"\tsetAttr \".p2.p2x\" %f;\n", p2x);
+		writeFloat(mFile,"\tsetAttr \".p2.p2x\" ",p2x,";\n");
 	}
 	void setPoint2Y(double p2y)
 	{
 		if(p2y == 0) return;
-		fprintf(mFile,"\tsetAttr \".p2.p2y\" %f;\n", p2y);
+		writeFloat(mFile,"\tsetAttr \".p2.p2y\" ",p2y,";\n");
 	}
 	void setPoint2Z(double p2z)
 	{
 		if(p2z == 0) return;
-		fprintf(mFile,"\tsetAttr \".p2.p2z\" %f;\n", p2z);
+		writeFloat(mFile,"\tsetAttr \".p2.p2z\" ",p2z,";\n");
 	}
 	void setInMatrix2(const matrix& im2)
 	{
 		if(im2 == identity) return;
-		fprintf(mFile,"\tsetAttr \".im2\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".im2\" -type \"matrix\" ");
 		im2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getPoint1()const
 	{
-		fprintf(mFile,"\"%s.p1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p1\"");
 	}
 	void getPoint1X()const
 	{
-		fprintf(mFile,"\"%s.p1.p1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p1.p1x\"");
 	}
 	void getPoint1Y()const
 	{
-		fprintf(mFile,"\"%s.p1.p1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p1.p1y\"");
 	}
 	void getPoint1Z()const
 	{
-		fprintf(mFile,"\"%s.p1.p1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p1.p1z\"");
 	}
 	void getInMatrix1()const
 	{
-		fprintf(mFile,"\"%s.im1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im1\"");
 	}
 	void getPoint2()const
 	{
-		fprintf(mFile,"\"%s.p2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p2\"");
 	}
 	void getPoint2X()const
 	{
-		fprintf(mFile,"\"%s.p2.p2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p2.p2x\"");
 	}
 	void getPoint2Y()const
 	{
-		fprintf(mFile,"\"%s.p2.p2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p2.p2y\"");
 	}
 	void getPoint2Z()const
 	{
-		fprintf(mFile,"\"%s.p2.p2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p2.p2z\"");
 	}
 	void getInMatrix2()const
 	{
-		fprintf(mFile,"\"%s.im2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im2\"");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 protected:
 	DistanceBetween(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
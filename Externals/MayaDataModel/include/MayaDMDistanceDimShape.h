@@ -26,81 +26,81 @@ public:
 
 	void setStartPoint(const double3& sp)
 	{
-		fprintf(mFile,"\tsetAttr \".sp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".sp\" -type \"double3\" ");
 		sp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStartPointX(double spx)
 	{
 		if(spx == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.spx\" %f;\n", spx);
+		writeFloat(mFile,"\tsetAttr \".sp.spx\" ",spx,";\n");
 	}
 	void setStartPointY(double spy)
 	{
 		if(spy == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.spy\" %f;\n", spy);
+		writeFloat(mFile,"\tsetAttr \".sp.spy\" ",spy,";\n");
 	}
 	void setStartPointZ(double spz)
 	{
 		if(spz == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.spz\" %f;\n", spz);
+		writeFloat(mFile,"\tsetAttr \".sp.spz\" ",spz,";\n");
 	}
 	void setEndPoint(const double3& ep)
 	{
-		fprintf(mFile,"\tsetAttr \".ep\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ep\" -type \"double3\" ");
 		ep.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEndPointX(double epx)
 	{
 		if(epx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ep.epx\" %f;\n", epx);
+		writeFloat(mFile,"\tsetAttr \".ep.epx\" ",epx,";\n");
 	}
 	void setEndPointY(double epy)
 	{
 		if(epy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ep.epy\" %f;\n", epy);
+		writeFloat(mFile,"\tsetAttr \".ep.epy\" ",epy,";\n");
 	}
 	void setEndPointZ(double epz)
 	{
 		if(epz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ep.epz\" %f;\n", epz);
+		writeFloat(mFile,"\tsetAttr \".ep.epz\" ",epz,";\n");
 	}
 	void getStartPoint()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getStartPointX()const
 	{
-		fprintf(mFile,"\"%s.sp.spx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spx\"");
 	}
 	void getStartPointY()const
 	{
-		fprintf(mFile,"\"%s.sp.spy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spy\"");
 	}
 	void getStartPointZ()const
 	{
-		fprintf(mFile,"\"%s.sp.spz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spz\"");
 	}
 	void getEndPoint()const
 	{
-		fprintf(mFile,"\"%s.ep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ep\"");
 	}
 	void getEndPointX()const
 	{
-		fprintf(mFile,"\"%s.ep.epx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ep.epx\"");
 	}
 	void getEndPointY()const
 	{
-		fprintf(mFile,"\"%s.ep.epy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ep.epy\"");
 	}
 	void getEndPointZ()const
 	{
-		fprintf(mFile,"\"%s.ep.epz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ep.epz\"");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.dist\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dist\"");
 	}
 protected:
 	DistanceDimShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -22,7 +22,7 @@ public:
 		void write(FILE* file) const
 		{
 			inDouble.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 		}
 	};
 public:
@@ -34,136 +34,136 @@ public:
 
 	void setInput(size_t i_i,const Input& i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i]\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"]\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput(size_t i_start,size_t i_end,Input* i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\" ");
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			i_[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput(size_t i_start,size_t i_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\"",i_start,i_end);
-		fprintf(mFile," -type \"Input\" ");
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\"");
+		writeString(mFile," -type \"Input\" ");
 	}
 	void appendInput(const Input& i)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		i.write(mFile);
 	}
 	void endInput()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInDouble(size_t i_i,const float2& idl)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i].idl\" -type \"float2\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"].idl\" -type \"float2\" ");
 		idl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInComp1(size_t i_i,float ic1)
 	{
 		if(ic1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].idl.ic1\" %f;\n", i_i,ic1);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].idl.ic1\" ",ic1,";\n");
 	}
 	void setInComp2(size_t i_i,float ic2)
 	{
 		if(ic2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].idl.ic2\" %f;\n", i_i,ic2);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].idl.ic2\" ",ic2,";\n");
 	}
 	void setDefault(const float2& def)
 	{
 		if(def == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".def\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".def\" -type \"float2\" ");
 		def.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefComp1(float dc1)
 	{
 		if(dc1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".def.dc1\" %f;\n", dc1);
+		writeFloat(mFile,"\tsetAttr \".def.dc1\" ",dc1,";\n");
 	}
 	void setDefComp2(float dc2)
 	{
 		if(dc2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".def.dc2\" %f;\n", dc2);
+		writeFloat(mFile,"\tsetAttr \".def.dc2\" ",dc2,";\n");
 	}
 	void getInput(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getInput()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInDouble(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].idl\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].idl\"");
 	}
 	void getInDouble()const
 	{
 
-		fprintf(mFile,"\"%s.i.idl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.idl\"");
 	}
 	void getInComp1(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].idl.ic1\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].idl.ic1\"");
 	}
 	void getInComp1()const
 	{
 
-		fprintf(mFile,"\"%s.i.idl.ic1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.idl.ic1\"");
 	}
 	void getInComp2(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].idl.ic2\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].idl.ic2\"");
 	}
 	void getInComp2()const
 	{
 
-		fprintf(mFile,"\"%s.i.idl.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.idl.ic2\"");
 	}
 	void getInShape(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].is\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].is\"");
 	}
 	void getInShape()const
 	{
 
-		fprintf(mFile,"\"%s.i.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.is\"");
 	}
 	void getDefault()const
 	{
-		fprintf(mFile,"\"%s.def\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def\"");
 	}
 	void getDefComp1()const
 	{
-		fprintf(mFile,"\"%s.def.dc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def.dc1\"");
 	}
 	void getDefComp2()const
 	{
-		fprintf(mFile,"\"%s.def.dc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def.dc2\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 	void getOutComp1()const
 	{
-		fprintf(mFile,"\"%s.out.oc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out.oc1\"");
 	}
 	void getOutComp2()const
 	{
-		fprintf(mFile,"\"%s.out.oc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out.oc2\"");
 	}
 protected:
 	DoubleShadingSwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,37 +27,37 @@ public:
 	void setBlendFactor(double bl)
 	{
 		if(bl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".bl\" %f;\n", bl);
+		writeFloat(mFile,"\tsetAttr \".bl\" ",bl,";\n");
 	}
 	void setTangentContinuityProfile1(bool tp1)
 	{
 		if(tp1 == false) return;
-		fprintf(mFile,"\tsetAttr \".tp1\" %i;\n", tp1);
+		writeInt(mFile,"\tsetAttr \".tp1\" ",tp1,";\n");
 	}
 	void setTangentContinuityProfile2(bool tp2)
 	{
 		if(tp2 == false) return;
-		fprintf(mFile,"\tsetAttr \".tp2\" %i;\n", tp2);
+		writeInt(mFile,"\tsetAttr \".tp2\" ",tp2,";\n");
 	}
 	void getInputProfile1()const
 	{
-		fprintf(mFile,"\"%s.ip1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip1\"");
 	}
 	void getInputProfile2()const
 	{
-		fprintf(mFile,"\"%s.ip2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip2\"");
 	}
 	void getBlendFactor()const
 	{
-		fprintf(mFile,"\"%s.bl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bl\"");
 	}
 	void getTangentContinuityProfile1()const
 	{
-		fprintf(mFile,"\"%s.tp1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp1\"");
 	}
 	void getTangentContinuityProfile2()const
 	{
-		fprintf(mFile,"\"%s.tp2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp2\"");
 	}
 protected:
 	DpBirailSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		double directionZ;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", directionX);
-			fprintf(file,"%f ", directionY);
-			fprintf(file,"%f", directionZ);
+			writeFloat(file,"",directionX," ");
+			writeFloat(file,"",directionY," ");
+			writeFloat(file,"",directionZ);
 		}
 	};
 public:
@@ -37,80 +37,80 @@ public:
 
 	void setDirection(const Direction& d)
 	{
-		fprintf(mFile,"\tsetAttr \".d\" ");
+		writeString(mFile,"\tsetAttr \".d\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionX(double dx)
 	{
 		if(dx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dx\" %f;\n", dx);
+		writeFloat(mFile,"\tsetAttr \".d.dx\" ",dx,";\n");
 	}
 	void setDirectionY(double dy)
 	{
 		if(dy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dy\" %f;\n", dy);
+		writeFloat(mFile,"\tsetAttr \".d.dy\" ",dy,";\n");
 	}
 	void setDirectionZ(double dz)
 	{
 		if(dz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dz\" %f;\n", dz);
+		writeFloat(mFile,"\tsetAttr \".d.dz\" ",dz,";\n");
 	}
 	void setUseDirection(bool ud)
 	{
 		if(ud == false) return;
-		fprintf(mFile,"\tsetAttr \".ud\" %i;\n", ud);
+		writeInt(mFile,"\tsetAttr \".ud\" ",ud,";\n");
 	}
 	void setInheritVelocity(double iv)
 	{
 		if(iv == 0) return;
-		fprintf(mFile,"\tsetAttr \".iv\" %f;\n", iv);
+		writeFloat(mFile,"\tsetAttr \".iv\" ",iv,";\n");
 	}
 	void setMotionAttenuation(double mna)
 	{
 		if(mna == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mna\" %f;\n", mna);
+		writeFloat(mFile,"\tsetAttr \".mna\" ",mna,";\n");
 	}
 	void setSpeedAttenuation(double spa)
 	{
 		if(spa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spa\" %f;\n", spa);
+		writeFloat(mFile,"\tsetAttr \".spa\" ",spa,";\n");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDirectionX()const
 	{
-		fprintf(mFile,"\"%s.d.dx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dx\"");
 	}
 	void getDirectionY()const
 	{
-		fprintf(mFile,"\"%s.d.dy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dy\"");
 	}
 	void getDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.d.dz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dz\"");
 	}
 	void getUseDirection()const
 	{
-		fprintf(mFile,"\"%s.ud\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ud\"");
 	}
 	void getInheritVelocity()const
 	{
-		fprintf(mFile,"\"%s.iv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iv\"");
 	}
 	void getMotionAttenuation()const
 	{
-		fprintf(mFile,"\"%s.mna\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mna\"");
 	}
 	void getSpeedAttenuation()const
 	{
-		fprintf(mFile,"\"%s.spa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spa\"");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.cti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cti\"");
 	}
 protected:
 	DragField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
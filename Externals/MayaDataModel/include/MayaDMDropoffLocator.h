@@ -27,20 +27,20 @@ public:
 	void setPercent(float pc)
 	{
 		if(pc == 1) return;
-		fprintf(mFile,"\tsetAttr \".pc\" %f;\n", pc);
+		writeFloat(mFile,"\tsetAttr \".pc\" ",pc,";\n");
 	}
 	void setParam(float pr)
 	{
 		if(pr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pr\" %f;\n", pr);
+		writeFloat(mFile,"\tsetAttr \".pr\" ",pr,";\n");
 	}
 	void getPercent()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getParam()const
 	{
-		fprintf(mFile,"\"%s.pr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pr\"");
 	}
 protected:
 	DropoffLocator(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,52 +27,52 @@ public:
 	void setFromWhere(short fw)
 	{
 		if(fw == 0) return;
-		fprintf(mFile,"\tsetAttr \".fw\" %i;\n", fw);
+		writeInt(mFile,"\tsetAttr \".fw\" ",fw,";\n");
 	}
 	void setSubsetId(int sid)
 	{
 		if(sid == -1) return;
-		fprintf(mFile,"\tsetAttr \".sid\" %i;\n", sid);
+		writeInt(mFile,"\tsetAttr \".sid\" ",sid,";\n");
 	}
 	void getOwner()const
 	{
-		fprintf(mFile,"\"%s.ow\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ow\"");
 	}
 	void getFromWhere()const
 	{
-		fprintf(mFile,"\"%s.fw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw\"");
 	}
 	void getSubsetId()const
 	{
-		fprintf(mFile,"\"%s.sid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sid\"");
 	}
 	void getPositional()const
 	{
-		fprintf(mFile,"\"%s.psl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".psl\"");
 	}
 	void getOwnerCentroid()const
 	{
-		fprintf(mFile,"\"%s.ocd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd\"");
 	}
 	void getOwnerCentroidX()const
 	{
-		fprintf(mFile,"\"%s.ocd.ocx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.ocx\"");
 	}
 	void getOwnerCentroidY()const
 	{
-		fprintf(mFile,"\"%s.ocd.ocy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.ocy\"");
 	}
 	void getOwnerCentroidZ()const
 	{
-		fprintf(mFile,"\"%s.ocd.ocz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.ocz\"");
 	}
 	void getOwnerPosData()const
 	{
-		fprintf(mFile,"\"%s.opd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opd\"");
 	}
 	void getOwnerVelData()const
 	{
-		fprintf(mFile,"\"%s.ovd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ovd\"");
 	}
 protected:
 	DynBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,67 +27,67 @@ public:
 	void setOverSamples(int os)
 	{
 		if(os == 1) return;
-		fprintf(mFile,"\tsetAttr \".os\" %i;\n", os);
+		writeInt(mFile,"\tsetAttr \".os\" ",os,";\n");
 	}
 	void setUseParticleDiskCache(bool upd)
 	{
 		if(upd == 0) return;
-		fprintf(mFile,"\tsetAttr \".upd\" %i;\n", upd);
+		writeInt(mFile,"\tsetAttr \".upd\" ",upd,";\n");
 	}
 	void setCacheDirectory(const string& cd)
 	{
 		if(cd == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cd\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cd\" -type \"string\" ");
 		cd.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinFrameCached(int mnf)
 	{
 		if(mnf == 0) return;
-		fprintf(mFile,"\tsetAttr \".mnf\" %i;\n", mnf);
+		writeInt(mFile,"\tsetAttr \".mnf\" ",mnf,";\n");
 	}
 	void setMaxFrameCached(int mxf)
 	{
 		if(mxf == 0) return;
-		fprintf(mFile,"\tsetAttr \".mxf\" %i;\n", mxf);
+		writeInt(mFile,"\tsetAttr \".mxf\" ",mxf,";\n");
 	}
 	void setConfirmedPath(const string& cnp)
 	{
 		if(cnp == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cnp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cnp\" -type \"string\" ");
 		cnp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConfirmSceneName(const string& csn)
 	{
 		if(csn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".csn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".csn\" -type \"string\" ");
 		csn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getOverSamples()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getInternalOverSamples()const
 	{
-		fprintf(mFile,"\"%s.ios\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ios\"");
 	}
 	void getUseParticleDiskCache()const
 	{
-		fprintf(mFile,"\"%s.upd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upd\"");
 	}
 	void getCacheDirectory()const
 	{
-		fprintf(mFile,"\"%s.cd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cd\"");
 	}
 	void getMinFrameCached()const
 	{
-		fprintf(mFile,"\"%s.mnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mnf\"");
 	}
 	void getMaxFrameCached()const
 	{
-		fprintf(mFile,"\"%s.mxf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxf\"");
 	}
 protected:
 	DynGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
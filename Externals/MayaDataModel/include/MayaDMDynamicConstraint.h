@@ -23,9 +23,9 @@ public:
 		unsigned int connectionDensityRange_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", connectionDensityRange_Position);
-			fprintf(file,"%f ", connectionDensityRange_FloatValue);
-			fprintf(file,"%i", connectionDensityRange_Interp);
+			writeFloat(file,"",connectionDensityRange_Position," ");
+			writeFloat(file,"",connectionDensityRange_FloatValue," ");
+			writeInt(file,"",connectionDensityRange_Interp);
 		}
 	};
 	struct StrengthDropoff{
@@ -34,9 +34,9 @@ public:
 		unsigned int strengthDropoff_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", strengthDropoff_Position);
-			fprintf(file,"%f ", strengthDropoff_FloatValue);
-			fprintf(file,"%i", strengthDropoff_Interp);
+			writeFloat(file,"",strengthDropoff_Position," ");
+			writeFloat(file,"",strengthDropoff_FloatValue," ");
+			writeInt(file,"",strengthDropoff_Interp);
 		}
 	};
 public:
@@ -49,502 +49,502 @@ public:
 	void setIsDynamic(bool isd)
 	{
 		if(isd == true) return;
-		fprintf(mFile,"\tsetAttr \".isd\" %i;\n", isd);
+		writeInt(mFile,"\tsetAttr \".isd\" ",isd,";\n");
 	}
 	void setEnable(bool ena)
 	{
 		if(ena == true) return;
-		fprintf(mFile,"\tsetAttr \".ena\" %i;\n", ena);
+		writeInt(mFile,"\tsetAttr \".ena\" ",ena,";\n");
 	}
 	void setConstraintMethod(unsigned int cm)
 	{
 		if(cm == 1) return;
-		fprintf(mFile,"\tsetAttr \".cm\" %i;\n", cm);
+		writeInt(mFile,"\tsetAttr \".cm\" ",cm,";\n");
 	}
 	void setConnectionMethod(unsigned int cnm)
 	{
 		if(cnm == 0) return;
-		fprintf(mFile,"\tsetAttr \".cnm\" %i;\n", cnm);
+		writeInt(mFile,"\tsetAttr \".cnm\" ",cnm,";\n");
 	}
 	void setConstraintRelation(unsigned int crr)
 	{
 		if(crr == 1) return;
-		fprintf(mFile,"\tsetAttr \".crr\" %i;\n", crr);
+		writeInt(mFile,"\tsetAttr \".crr\" ",crr,";\n");
 	}
 	void setComponentRelation(unsigned int cmr)
 	{
 		if(cmr == 0) return;
-		fprintf(mFile,"\tsetAttr \".cmr\" %i;\n", cmr);
+		writeInt(mFile,"\tsetAttr \".cmr\" ",cmr,";\n");
 	}
 	void setConnectionUpdate(unsigned int cu)
 	{
 		if(cu == 0) return;
-		fprintf(mFile,"\tsetAttr \".cu\" %i;\n", cu);
+		writeInt(mFile,"\tsetAttr \".cu\" ",cu,";\n");
 	}
 	void setConnectWithinComponent(bool cwc)
 	{
 		if(cwc == false) return;
-		fprintf(mFile,"\tsetAttr \".cwc\" %i;\n", cwc);
+		writeInt(mFile,"\tsetAttr \".cwc\" ",cwc,";\n");
 	}
 	void setConnectionDensity(double cdn)
 	{
 		if(cdn == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cdn\" %f;\n", cdn);
+		writeFloat(mFile,"\tsetAttr \".cdn\" ",cdn,";\n");
 	}
 	void setConnectionDensityRange(size_t cdnr_i,const ConnectionDensityRange& cdnr)
 	{
-		fprintf(mFile,"\tsetAttr \".cdnr[%i]\" ",cdnr_i);
+		writeInt(mFile,"\tsetAttr \".cdnr[",cdnr_i,"]\" ");
 		cdnr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConnectionDensityRange(size_t cdnr_start,size_t cdnr_end,ConnectionDensityRange* cdnr)
 	{
-		fprintf(mFile,"\tsetAttr \".cdnr[%i:%i]\" ", cdnr_start,cdnr_end);
+		writeInt(mFile,"\tsetAttr \".cdnr[",cdnr_start); writeInt(mFile,":",cdnr_end,"]\" ");
 		size_t size = (cdnr_end-cdnr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cdnr[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startConnectionDensityRange(size_t cdnr_start,size_t cdnr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cdnr[%i:%i]\"",cdnr_start,cdnr_end);
-		fprintf(mFile," -type \"ConnectionDensityRange\" ");
+		writeInt(mFile,"\tsetAttr \".cdnr[",cdnr_start); writeInt(mFile,":",cdnr_end,"]\"");
+		writeString(mFile," -type \"ConnectionDensityRange\" ");
 	}
 	void appendConnectionDensityRange(const ConnectionDensityRange& cdnr)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cdnr.write(mFile);
 	}
 	void endConnectionDensityRange()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConnectionDensityRange_Position(size_t cdnr_i,float cdnrp)
 	{
 		if(cdnrp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cdnr[%i].cdnrp\" %f;\n", cdnr_i,cdnrp);
+		writeInt(mFile,"\tsetAttr \".cdnr[",cdnr_i); writeFloat(mFile,"].cdnrp\" ",cdnrp,";\n");
 	}
 	void setConnectionDensityRange_FloatValue(size_t cdnr_i,float cdnrfv)
 	{
 		if(cdnrfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cdnr[%i].cdnrfv\" %f;\n", cdnr_i,cdnrfv);
+		writeInt(mFile,"\tsetAttr \".cdnr[",cdnr_i); writeFloat(mFile,"].cdnrfv\" ",cdnrfv,";\n");
 	}
 	void setConnectionDensityRange_Interp(size_t cdnr_i,unsigned int cdnri)
 	{
 		if(cdnri == 0) return;
-		fprintf(mFile,"\tsetAttr \".cdnr[%i].cdnri\" %i;\n", cdnr_i,cdnri);
+		writeInt(mFile,"\tsetAttr \".cdnr[",cdnr_i); writeInt(mFile,"].cdnri\" ",cdnri,";\n");
 	}
 	void setDisplayConnections(bool dcn)
 	{
 		if(dcn == true) return;
-		fprintf(mFile,"\tsetAttr \".dcn\" %i;\n", dcn);
+		writeInt(mFile,"\tsetAttr \".dcn\" ",dcn,";\n");
 	}
 	void setStrength(double str)
 	{
 		if(str == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".str\" %f;\n", str);
+		writeFloat(mFile,"\tsetAttr \".str\" ",str,";\n");
 	}
 	void setRestLengthMethod(unsigned int rlm)
 	{
 		if(rlm == 0) return;
-		fprintf(mFile,"\tsetAttr \".rlm\" %i;\n", rlm);
+		writeInt(mFile,"\tsetAttr \".rlm\" ",rlm,";\n");
 	}
 	void setRestLength(double rl)
 	{
 		if(rl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rl\" %f;\n", rl);
+		writeFloat(mFile,"\tsetAttr \".rl\" ",rl,";\n");
 	}
 	void setRestLengthScale(double rls)
 	{
 		if(rls == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rls\" %f;\n", rls);
+		writeFloat(mFile,"\tsetAttr \".rls\" ",rls,";\n");
 	}
 	void setTangentStrength(double tst)
 	{
 		if(tst == 10) return;
-		fprintf(mFile,"\tsetAttr \".tst\" %f;\n", tst);
+		writeFloat(mFile,"\tsetAttr \".tst\" ",tst,";\n");
 	}
 	void setBend(bool bnd)
 	{
 		if(bnd == false) return;
-		fprintf(mFile,"\tsetAttr \".bnd\" %i;\n", bnd);
+		writeInt(mFile,"\tsetAttr \".bnd\" ",bnd,";\n");
 	}
 	void setBendStrength(double bns)
 	{
 		if(bns == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".bns\" %f;\n", bns);
+		writeFloat(mFile,"\tsetAttr \".bns\" ",bns,";\n");
 	}
 	void setBendBreakAngle(double bba)
 	{
 		if(bba == 360.0) return;
-		fprintf(mFile,"\tsetAttr \".bba\" %f;\n", bba);
+		writeFloat(mFile,"\tsetAttr \".bba\" ",bba,";\n");
 	}
 	void setGlueStrength(double gls)
 	{
 		if(gls == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gls\" %f;\n", gls);
+		writeFloat(mFile,"\tsetAttr \".gls\" ",gls,";\n");
 	}
 	void setGlueStrengthScale(double glss)
 	{
 		if(glss == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".glss\" %f;\n", glss);
+		writeFloat(mFile,"\tsetAttr \".glss\" ",glss,";\n");
 	}
 	void setForce(double for_)
 	{
 		if(for_ == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".for\" %f;\n", for_);
+		writeFloat(mFile,"\tsetAttr \".for\" ",for_,";\n");
 	}
 	void setMotionDrag(double mdg)
 	{
 		if(mdg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mdg\" %f;\n", mdg);
+		writeFloat(mFile,"\tsetAttr \".mdg\" ",mdg,";\n");
 	}
 	void setDropoff(double drp)
 	{
 		if(drp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".drp\" %f;\n", drp);
+		writeFloat(mFile,"\tsetAttr \".drp\" ",drp,";\n");
 	}
 	void setDropoffDistance(double ddd)
 	{
 		if(ddd == 50.0) return;
-		fprintf(mFile,"\tsetAttr \".ddd\" %f;\n", ddd);
+		writeFloat(mFile,"\tsetAttr \".ddd\" ",ddd,";\n");
 	}
 	void setStrengthDropoff(size_t sdp_i,const StrengthDropoff& sdp)
 	{
-		fprintf(mFile,"\tsetAttr \".sdp[%i]\" ",sdp_i);
+		writeInt(mFile,"\tsetAttr \".sdp[",sdp_i,"]\" ");
 		sdp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStrengthDropoff(size_t sdp_start,size_t sdp_end,StrengthDropoff* sdp)
 	{
-		fprintf(mFile,"\tsetAttr \".sdp[%i:%i]\" ", sdp_start,sdp_end);
+		writeInt(mFile,"\tsetAttr \".sdp[",sdp_start); writeInt(mFile,":",sdp_end,"]\" ");
 		size_t size = (sdp_end-sdp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			sdp[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startStrengthDropoff(size_t sdp_start,size_t sdp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sdp[%i:%i]\"",sdp_start,sdp_end);
-		fprintf(mFile," -type \"StrengthDropoff\" ");
+		writeInt(mFile,"\tsetAttr \".sdp[",sdp_start); writeInt(mFile,":",sdp_end,"]\"");
+		writeString(mFile," -type \"StrengthDropoff\" ");
 	}
 	void appendStrengthDropoff(const StrengthDropoff& sdp)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		sdp.write(mFile);
 	}
 	void endStrengthDropoff()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStrengthDropoff_Position(size_t sdp_i,float sdpp)
 	{
 		if(sdpp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sdp[%i].sdpp\" %f;\n", sdp_i,sdpp);
+		writeInt(mFile,"\tsetAttr \".sdp[",sdp_i); writeFloat(mFile,"].sdpp\" ",sdpp,";\n");
 	}
 	void setStrengthDropoff_FloatValue(size_t sdp_i,float sdpfv)
 	{
 		if(sdpfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sdp[%i].sdpfv\" %f;\n", sdp_i,sdpfv);
+		writeInt(mFile,"\tsetAttr \".sdp[",sdp_i); writeFloat(mFile,"].sdpfv\" ",sdpfv,";\n");
 	}
 	void setStrengthDropoff_Interp(size_t sdp_i,unsigned int sdpi)
 	{
 		if(sdpi == 0) return;
-		fprintf(mFile,"\tsetAttr \".sdp[%i].sdpi\" %i;\n", sdp_i,sdpi);
+		writeInt(mFile,"\tsetAttr \".sdp[",sdp_i); writeInt(mFile,"].sdpi\" ",sdpi,";\n");
 	}
 	void setMaxDistance(double mds)
 	{
 		if(mds == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".mds\" %f;\n", mds);
+		writeFloat(mFile,"\tsetAttr \".mds\" ",mds,";\n");
 	}
 	void setDamp(double dmp)
 	{
 		if(dmp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dmp\" %f;\n", dmp);
+		writeFloat(mFile,"\tsetAttr \".dmp\" ",dmp,";\n");
 	}
 	void setFriction(double frc)
 	{
 		if(frc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".frc\" %f;\n", frc);
+		writeFloat(mFile,"\tsetAttr \".frc\" ",frc,";\n");
 	}
 	void setLocalCollide(bool lcl)
 	{
 		if(lcl == false) return;
-		fprintf(mFile,"\tsetAttr \".lcl\" %i;\n", lcl);
+		writeInt(mFile,"\tsetAttr \".lcl\" ",lcl,";\n");
 	}
 	void setCollideWidthScale(double cws)
 	{
 		if(cws == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cws\" %f;\n", cws);
+		writeFloat(mFile,"\tsetAttr \".cws\" ",cws,";\n");
 	}
 	void setExcludeCollisions(bool excs)
 	{
 		if(excs == false) return;
-		fprintf(mFile,"\tsetAttr \".excs\" %i;\n", excs);
+		writeInt(mFile,"\tsetAttr \".excs\" ",excs,";\n");
 	}
 	void setSingleSided(bool ssd)
 	{
 		if(ssd == true) return;
-		fprintf(mFile,"\tsetAttr \".ssd\" %i;\n", ssd);
+		writeInt(mFile,"\tsetAttr \".ssd\" ",ssd,";\n");
 	}
 	void setMaxIterations(int mitr)
 	{
 		if(mitr == 500) return;
-		fprintf(mFile,"\tsetAttr \".mitr\" %i;\n", mitr);
+		writeInt(mFile,"\tsetAttr \".mitr\" ",mitr,";\n");
 	}
 	void setMinIterations(int mini)
 	{
 		if(mini == 0) return;
-		fprintf(mFile,"\tsetAttr \".mini\" %i;\n", mini);
+		writeInt(mFile,"\tsetAttr \".mini\" ",mini,";\n");
 	}
 	void getIsDynamic()const
 	{
-		fprintf(mFile,"\"%s.isd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isd\"");
 	}
 	void getEnable()const
 	{
-		fprintf(mFile,"\"%s.ena\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ena\"");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.cti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cti\"");
 	}
 	void getComponentIds(size_t cid_i)const
 	{
-		fprintf(mFile,"\"%s.cid[%i]\"",mName.c_str(),cid_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cid[",cid_i,"]\"");
 	}
 	void getComponentIds()const
 	{
 
-		fprintf(mFile,"\"%s.cid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cid\"");
 	}
 	void getConstraintMethod()const
 	{
-		fprintf(mFile,"\"%s.cm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cm\"");
 	}
 	void getConnectionMethod()const
 	{
-		fprintf(mFile,"\"%s.cnm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnm\"");
 	}
 	void getConstraintRelation()const
 	{
-		fprintf(mFile,"\"%s.crr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crr\"");
 	}
 	void getComponentRelation()const
 	{
-		fprintf(mFile,"\"%s.cmr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmr\"");
 	}
 	void getConnectionUpdate()const
 	{
-		fprintf(mFile,"\"%s.cu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cu\"");
 	}
 	void getConnectWithinComponent()const
 	{
-		fprintf(mFile,"\"%s.cwc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwc\"");
 	}
 	void getConnectionDensity()const
 	{
-		fprintf(mFile,"\"%s.cdn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdn\"");
 	}
 	void getConnectionDensityRange(size_t cdnr_i)const
 	{
-		fprintf(mFile,"\"%s.cdnr[%i]\"",mName.c_str(),cdnr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdnr[",cdnr_i,"]\"");
 	}
 	void getConnectionDensityRange()const
 	{
 
-		fprintf(mFile,"\"%s.cdnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdnr\"");
 	}
 	void getConnectionDensityRange_Position(size_t cdnr_i)const
 	{
-		fprintf(mFile,"\"%s.cdnr[%i].cdnrp\"",mName.c_str(),cdnr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdnr[",cdnr_i,"].cdnrp\"");
 	}
 	void getConnectionDensityRange_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cdnr.cdnrp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdnr.cdnrp\"");
 	}
 	void getConnectionDensityRange_FloatValue(size_t cdnr_i)const
 	{
-		fprintf(mFile,"\"%s.cdnr[%i].cdnrfv\"",mName.c_str(),cdnr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdnr[",cdnr_i,"].cdnrfv\"");
 	}
 	void getConnectionDensityRange_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.cdnr.cdnrfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdnr.cdnrfv\"");
 	}
 	void getConnectionDensityRange_Interp(size_t cdnr_i)const
 	{
-		fprintf(mFile,"\"%s.cdnr[%i].cdnri\"",mName.c_str(),cdnr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdnr[",cdnr_i,"].cdnri\"");
 	}
 	void getConnectionDensityRange_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cdnr.cdnri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdnr.cdnri\"");
 	}
 	void getDisplayConnections()const
 	{
-		fprintf(mFile,"\"%s.dcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcn\"");
 	}
 	void getStrength()const
 	{
-		fprintf(mFile,"\"%s.str\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".str\"");
 	}
 	void getRestLengthMethod()const
 	{
-		fprintf(mFile,"\"%s.rlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlm\"");
 	}
 	void getRestLength()const
 	{
-		fprintf(mFile,"\"%s.rl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rl\"");
 	}
 	void getRestLengthScale()const
 	{
-		fprintf(mFile,"\"%s.rls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rls\"");
 	}
 	void getTangentStrength()const
 	{
-		fprintf(mFile,"\"%s.tst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tst\"");
 	}
 	void getBend()const
 	{
-		fprintf(mFile,"\"%s.bnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bnd\"");
 	}
 	void getBendStrength()const
 	{
-		fprintf(mFile,"\"%s.bns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bns\"");
 	}
 	void getBendBreakAngle()const
 	{
-		fprintf(mFile,"\"%s.bba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bba\"");
 	}
 	void getGlueStrength()const
 	{
-		fprintf(mFile,"\"%s.gls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gls\"");
 	}
 	void getGlueStrengthScale()const
 	{
-		fprintf(mFile,"\"%s.glss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".glss\"");
 	}
 	void getForce()const
 	{
-		fprintf(mFile,"\"%s.for\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".for\"");
 	}
 	void getMotionDrag()const
 	{
-		fprintf(mFile,"\"%s.mdg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mdg\"");
 	}
 	void getDropoff()const
 	{
-		fprintf(mFile,"\"%s.drp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drp\"");
 	}
 	void getDropoffDistance()const
 	{
-		fprintf(mFile,"\"%s.ddd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ddd\"");
 	}
 	void getStrengthDropoff(size_t sdp_i)const
 	{
-		fprintf(mFile,"\"%s.sdp[%i]\"",mName.c_str(),sdp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sdp[",sdp_i,"]\"");
 	}
 	void getStrengthDropoff()const
 	{
 
-		fprintf(mFile,"\"%s.sdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdp\"");
 	}
 	void getStrengthDropoff_Position(size_t sdp_i)const
 	{
-		fprintf(mFile,"\"%s.sdp[%i].sdpp\"",mName.c_str(),sdp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sdp[",sdp_i,"].sdpp\"");
 	}
 	void getStrengthDropoff_Position()const
 	{
 
-		fprintf(mFile,"\"%s.sdp.sdpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdp.sdpp\"");
 	}
 	void getStrengthDropoff_FloatValue(size_t sdp_i)const
 	{
-		fprintf(mFile,"\"%s.sdp[%i].sdpfv\"",mName.c_str(),sdp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sdp[",sdp_i,"].sdpfv\"");
 	}
 	void getStrengthDropoff_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.sdp.sdpfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdp.sdpfv\"");
 	}
 	void getStrengthDropoff_Interp(size_t sdp_i)const
 	{
-		fprintf(mFile,"\"%s.sdp[%i].sdpi\"",mName.c_str(),sdp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sdp[",sdp_i,"].sdpi\"");
 	}
 	void getStrengthDropoff_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.sdp.sdpi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdp.sdpi\"");
 	}
 	void getMaxDistance()const
 	{
-		fprintf(mFile,"\"%s.mds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mds\"");
 	}
 	void getDamp()const
 	{
-		fprintf(mFile,"\"%s.dmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmp\"");
 	}
 	void getFriction()const
 	{
-		fprintf(mFile,"\"%s.frc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frc\"");
 	}
 	void getLocalCollide()const
 	{
-		fprintf(mFile,"\"%s.lcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcl\"");
 	}
 	void getCollideWidthScale()const
 	{
-		fprintf(mFile,"\"%s.cws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws\"");
 	}
 	void getExcludeCollisions()const
 	{
-		fprintf(mFile,"\"%s.excs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".excs\"");
 	}
 	void getSingleSided()const
 	{
-		fprintf(mFile,"\"%s.ssd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssd\"");
 	}
 	void getMaxIterations()const
 	{
-		fprintf(mFile,"\"%s.mitr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitr\"");
 	}
 	void getMinIterations()const
 	{
-		fprintf(mFile,"\"%s.mini\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mini\"");
 	}
 	void getEvalStart(size_t evs_i)const
 	{
-		fprintf(mFile,"\"%s.evs[%i]\"",mName.c_str(),evs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".evs[",evs_i,"]\"");
 	}
 	void getEvalStart()const
 	{
 
-		fprintf(mFile,"\"%s.evs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evs\"");
 	}
 	void getEvalCurrent(size_t evc_i)const
 	{
-		fprintf(mFile,"\"%s.evc[%i]\"",mName.c_str(),evc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".evc[",evc_i,"]\"");
 	}
 	void getEvalCurrent()const
 	{
 
-		fprintf(mFile,"\"%s.evc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evc\"");
 	}
 	void getIterations()const
 	{
-		fprintf(mFile,"\"%s.itr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itr\"");
 	}
 	void getCollide()const
 	{
-		fprintf(mFile,"\"%s.cld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cld\"");
 	}
 protected:
 	DynamicConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
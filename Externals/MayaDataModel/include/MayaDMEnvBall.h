@@ -27,159 +27,159 @@ public:
 	void setImage(const float3& so)
 	{
 		if(so == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".so\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".so\" -type \"float3\" ");
 		so.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageR(float sor)
 	{
 		if(sor == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".so.sor\" %f;\n", sor);
+		writeFloat(mFile,"\tsetAttr \".so.sor\" ",sor,";\n");
 	}
 	void setImageG(float sog)
 	{
 		if(sog == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".so.sog\" %f;\n", sog);
+		writeFloat(mFile,"\tsetAttr \".so.sog\" ",sog,";\n");
 	}
 	void setImageB(float sob)
 	{
 		if(sob == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".so.sob\" %f;\n", sob);
+		writeFloat(mFile,"\tsetAttr \".so.sob\" ",sob,";\n");
 	}
 	void setInclination(float i_)
 	{
 		if(i_ == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i\" %f;\n", i_);
+		writeFloat(mFile,"\tsetAttr \".i\" ",i_,";\n");
 	}
 	void setElevation(float e)
 	{
 		if(e == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".e\" %f;\n", e);
+		writeFloat(mFile,"\tsetAttr \".e\" ",e,";\n");
 	}
 	void setSkyRadius(float sr)
 	{
 		if(sr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setBottom(float bo)
 	{
 		if(bo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bo\" %f;\n", bo);
+		writeFloat(mFile,"\tsetAttr \".bo\" ",bo,";\n");
 	}
 	void setTop(float to)
 	{
 		if(to == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to\" %f;\n", to);
+		writeFloat(mFile,"\tsetAttr \".to\" ",to,";\n");
 	}
 	void setLeft(float le)
 	{
 		if(le == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".le\" %f;\n", le);
+		writeFloat(mFile,"\tsetAttr \".le\" ",le,";\n");
 	}
 	void setRight(float ri)
 	{
 		if(ri == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ri\" %f;\n", ri);
+		writeFloat(mFile,"\tsetAttr \".ri\" ",ri,";\n");
 	}
 	void setFront(float fr)
 	{
 		if(fr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setBack(float ba)
 	{
 		if(ba == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ba\" %f;\n", ba);
+		writeFloat(mFile,"\tsetAttr \".ba\" ",ba,";\n");
 	}
 	void setReflect(bool ref)
 	{
 		if(ref == true) return;
-		fprintf(mFile,"\tsetAttr \".ref\" %i;\n", ref);
+		writeInt(mFile,"\tsetAttr \".ref\" ",ref,";\n");
 	}
 	void setEyeSpace(bool eye)
 	{
 		if(eye == false) return;
-		fprintf(mFile,"\tsetAttr \".eye\" %i;\n", eye);
+		writeInt(mFile,"\tsetAttr \".eye\" ",eye,";\n");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getImage()const
 	{
-		fprintf(mFile,"\"%s.so\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so\"");
 	}
 	void getImageR()const
 	{
-		fprintf(mFile,"\"%s.so.sor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sor\"");
 	}
 	void getImageG()const
 	{
-		fprintf(mFile,"\"%s.so.sog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sog\"");
 	}
 	void getImageB()const
 	{
-		fprintf(mFile,"\"%s.so.sob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sob\"");
 	}
 	void getInclination()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getElevation()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 	void getSkyRadius()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getBottom()const
 	{
-		fprintf(mFile,"\"%s.bo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo\"");
 	}
 	void getTop()const
 	{
-		fprintf(mFile,"\"%s.to\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to\"");
 	}
 	void getLeft()const
 	{
-		fprintf(mFile,"\"%s.le\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".le\"");
 	}
 	void getRight()const
 	{
-		fprintf(mFile,"\"%s.ri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri\"");
 	}
 	void getFront()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getBack()const
 	{
-		fprintf(mFile,"\"%s.ba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ba\"");
 	}
 	void getReflect()const
 	{
-		fprintf(mFile,"\"%s.ref\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ref\"");
 	}
 	void getEyeSpace()const
 	{
-		fprintf(mFile,"\"%s.eye\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eye\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 protected:
 	EnvBall(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,372 +27,372 @@ public:
 	void setSkyColor(const float3& sc)
 	{
 		if(sc == float3(0.784f,0.784f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSkyColorR(float scr)
 	{
 		if(scr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scr\" %f;\n", scr);
+		writeFloat(mFile,"\tsetAttr \".sc.scr\" ",scr,";\n");
 	}
 	void setSkyColorG(float scg)
 	{
 		if(scg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scg\" %f;\n", scg);
+		writeFloat(mFile,"\tsetAttr \".sc.scg\" ",scg,";\n");
 	}
 	void setSkyColorB(float scb)
 	{
 		if(scb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scb\" %f;\n", scb);
+		writeFloat(mFile,"\tsetAttr \".sc.scb\" ",scb,";\n");
 	}
 	void setZenithColor(const float3& zc)
 	{
 		if(zc == float3(0.392f,0.392f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".zc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".zc\" -type \"float3\" ");
 		zc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setZenithColorR(float zcr)
 	{
 		if(zcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".zc.zcr\" %f;\n", zcr);
+		writeFloat(mFile,"\tsetAttr \".zc.zcr\" ",zcr,";\n");
 	}
 	void setZenithColorG(float zcg)
 	{
 		if(zcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".zc.zcg\" %f;\n", zcg);
+		writeFloat(mFile,"\tsetAttr \".zc.zcg\" ",zcg,";\n");
 	}
 	void setZenithColorB(float zcb)
 	{
 		if(zcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".zc.zcb\" %f;\n", zcb);
+		writeFloat(mFile,"\tsetAttr \".zc.zcb\" ",zcb,";\n");
 	}
 	void setLightColor(const float3& lc)
 	{
 		if(lc == float3(0.784f,0.784f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".lc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lc\" -type \"float3\" ");
 		lc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLightColorR(float lcr)
 	{
 		if(lcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lcr\" %f;\n", lcr);
+		writeFloat(mFile,"\tsetAttr \".lc.lcr\" ",lcr,";\n");
 	}
 	void setLightColorG(float lcg)
 	{
 		if(lcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lcg\" %f;\n", lcg);
+		writeFloat(mFile,"\tsetAttr \".lc.lcg\" ",lcg,";\n");
 	}
 	void setLightColorB(float lcb)
 	{
 		if(lcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lcb\" %f;\n", lcb);
+		writeFloat(mFile,"\tsetAttr \".lc.lcb\" ",lcb,";\n");
 	}
 	void setLightWidth(float lw)
 	{
 		if(lw == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".lw\" %f;\n", lw);
+		writeFloat(mFile,"\tsetAttr \".lw\" ",lw,";\n");
 	}
 	void setLightWidthGain(float lwg)
 	{
 		if(lwg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lwg\" %f;\n", lwg);
+		writeFloat(mFile,"\tsetAttr \".lwg\" ",lwg,";\n");
 	}
 	void setLightWidthOffset(float lwo)
 	{
 		if(lwo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lwo\" %f;\n", lwo);
+		writeFloat(mFile,"\tsetAttr \".lwo\" ",lwo,";\n");
 	}
 	void setLightDepth(float ld)
 	{
 		if(ld == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".ld\" %f;\n", ld);
+		writeFloat(mFile,"\tsetAttr \".ld\" ",ld,";\n");
 	}
 	void setLightDepthGain(float ldg)
 	{
 		if(ldg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ldg\" %f;\n", ldg);
+		writeFloat(mFile,"\tsetAttr \".ldg\" ",ldg,";\n");
 	}
 	void setLightDepthOffset(float ldo)
 	{
 		if(ldo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ldo\" %f;\n", ldo);
+		writeFloat(mFile,"\tsetAttr \".ldo\" ",ldo,";\n");
 	}
 	void setRealFloor(bool rf)
 	{
 		if(rf == true) return;
-		fprintf(mFile,"\tsetAttr \".rf\" %i;\n", rf);
+		writeInt(mFile,"\tsetAttr \".rf\" ",rf,";\n");
 	}
 	void setFloorColor(const float3& fc)
 	{
 		if(fc == float3(0.588f,0.588f,0.784f)) return;
-		fprintf(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFloorColorR(float fcr)
 	{
 		if(fcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fc.fcr\" ",fcr,";\n");
 	}
 	void setFloorColorG(float fcg)
 	{
 		if(fcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcg\" %f;\n", fcg);
+		writeFloat(mFile,"\tsetAttr \".fc.fcg\" ",fcg,";\n");
 	}
 	void setFloorColorB(float fcb)
 	{
 		if(fcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcb\" %f;\n", fcb);
+		writeFloat(mFile,"\tsetAttr \".fc.fcb\" ",fcb,";\n");
 	}
 	void setFloorAltitude(float fa)
 	{
 		if(fa == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".fa\" %f;\n", fa);
+		writeFloat(mFile,"\tsetAttr \".fa\" ",fa,";\n");
 	}
 	void setHorizonColor(const float3& hc)
 	{
 		if(hc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
 		hc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHorizonColorR(float hcr)
 	{
 		if(hcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcr\" %f;\n", hcr);
+		writeFloat(mFile,"\tsetAttr \".hc.hcr\" ",hcr,";\n");
 	}
 	void setHorizonColorG(float hcg)
 	{
 		if(hcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcg\" %f;\n", hcg);
+		writeFloat(mFile,"\tsetAttr \".hc.hcg\" ",hcg,";\n");
 	}
 	void setHorizonColorB(float hcb)
 	{
 		if(hcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcb\" %f;\n", hcb);
+		writeFloat(mFile,"\tsetAttr \".hc.hcb\" ",hcb,";\n");
 	}
 	void setGridColor(const float3& gc)
 	{
 		if(gc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
 		gc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGridColorR(float gcr)
 	{
 		if(gcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcr\" %f;\n", gcr);
+		writeFloat(mFile,"\tsetAttr \".gc.gcr\" ",gcr,";\n");
 	}
 	void setGridColorG(float gcg)
 	{
 		if(gcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcg\" %f;\n", gcg);
+		writeFloat(mFile,"\tsetAttr \".gc.gcg\" ",gcg,";\n");
 	}
 	void setGridColorB(float gcb)
 	{
 		if(gcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcb\" %f;\n", gcb);
+		writeFloat(mFile,"\tsetAttr \".gc.gcb\" ",gcb,";\n");
 	}
 	void setGridWidth(float gw)
 	{
 		if(gw == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".gw\" %f;\n", gw);
+		writeFloat(mFile,"\tsetAttr \".gw\" ",gw,";\n");
 	}
 	void setGridWidthGain(float gwg)
 	{
 		if(gwg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gwg\" %f;\n", gwg);
+		writeFloat(mFile,"\tsetAttr \".gwg\" ",gwg,";\n");
 	}
 	void setGridWidthOffset(float gwo)
 	{
 		if(gwo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gwo\" %f;\n", gwo);
+		writeFloat(mFile,"\tsetAttr \".gwo\" ",gwo,";\n");
 	}
 	void setGridDepth(float gd)
 	{
 		if(gd == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".gd\" %f;\n", gd);
+		writeFloat(mFile,"\tsetAttr \".gd\" ",gd,";\n");
 	}
 	void setGridDepthGain(float gdg)
 	{
 		if(gdg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gdg\" %f;\n", gdg);
+		writeFloat(mFile,"\tsetAttr \".gdg\" ",gdg,";\n");
 	}
 	void setGridDepthOffset(float gdo)
 	{
 		if(gdo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gdo\" %f;\n", gdo);
+		writeFloat(mFile,"\tsetAttr \".gdo\" ",gdo,";\n");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getSkyColor()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getSkyColorR()const
 	{
-		fprintf(mFile,"\"%s.sc.scr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scr\"");
 	}
 	void getSkyColorG()const
 	{
-		fprintf(mFile,"\"%s.sc.scg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scg\"");
 	}
 	void getSkyColorB()const
 	{
-		fprintf(mFile,"\"%s.sc.scb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scb\"");
 	}
 	void getZenithColor()const
 	{
-		fprintf(mFile,"\"%s.zc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".zc\"");
 	}
 	void getZenithColorR()const
 	{
-		fprintf(mFile,"\"%s.zc.zcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".zc.zcr\"");
 	}
 	void getZenithColorG()const
 	{
-		fprintf(mFile,"\"%s.zc.zcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".zc.zcg\"");
 	}
 	void getZenithColorB()const
 	{
-		fprintf(mFile,"\"%s.zc.zcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".zc.zcb\"");
 	}
 	void getLightColor()const
 	{
-		fprintf(mFile,"\"%s.lc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc\"");
 	}
 	void getLightColorR()const
 	{
-		fprintf(mFile,"\"%s.lc.lcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lcr\"");
 	}
 	void getLightColorG()const
 	{
-		fprintf(mFile,"\"%s.lc.lcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lcg\"");
 	}
 	void getLightColorB()const
 	{
-		fprintf(mFile,"\"%s.lc.lcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lcb\"");
 	}
 	void getLightWidth()const
 	{
-		fprintf(mFile,"\"%s.lw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lw\"");
 	}
 	void getLightWidthGain()const
 	{
-		fprintf(mFile,"\"%s.lwg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lwg\"");
 	}
 	void getLightWidthOffset()const
 	{
-		fprintf(mFile,"\"%s.lwo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lwo\"");
 	}
 	void getLightDepth()const
 	{
-		fprintf(mFile,"\"%s.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld\"");
 	}
 	void getLightDepthGain()const
 	{
-		fprintf(mFile,"\"%s.ldg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldg\"");
 	}
 	void getLightDepthOffset()const
 	{
-		fprintf(mFile,"\"%s.ldo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldo\"");
 	}
 	void getRealFloor()const
 	{
-		fprintf(mFile,"\"%s.rf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rf\"");
 	}
 	void getFloorColor()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFloorColorR()const
 	{
-		fprintf(mFile,"\"%s.fc.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcr\"");
 	}
 	void getFloorColorG()const
 	{
-		fprintf(mFile,"\"%s.fc.fcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcg\"");
 	}
 	void getFloorColorB()const
 	{
-		fprintf(mFile,"\"%s.fc.fcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcb\"");
 	}
 	void getFloorAltitude()const
 	{
-		fprintf(mFile,"\"%s.fa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fa\"");
 	}
 	void getHorizonColor()const
 	{
-		fprintf(mFile,"\"%s.hc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc\"");
 	}
 	void getHorizonColorR()const
 	{
-		fprintf(mFile,"\"%s.hc.hcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hcr\"");
 	}
 	void getHorizonColorG()const
 	{
-		fprintf(mFile,"\"%s.hc.hcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hcg\"");
 	}
 	void getHorizonColorB()const
 	{
-		fprintf(mFile,"\"%s.hc.hcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hcb\"");
 	}
 	void getGridColor()const
 	{
-		fprintf(mFile,"\"%s.gc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc\"");
 	}
 	void getGridColorR()const
 	{
-		fprintf(mFile,"\"%s.gc.gcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcr\"");
 	}
 	void getGridColorG()const
 	{
-		fprintf(mFile,"\"%s.gc.gcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcg\"");
 	}
 	void getGridColorB()const
 	{
-		fprintf(mFile,"\"%s.gc.gcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcb\"");
 	}
 	void getGridWidth()const
 	{
-		fprintf(mFile,"\"%s.gw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gw\"");
 	}
 	void getGridWidthGain()const
 	{
-		fprintf(mFile,"\"%s.gwg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gwg\"");
 	}
 	void getGridWidthOffset()const
 	{
-		fprintf(mFile,"\"%s.gwo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gwo\"");
 	}
 	void getGridDepth()const
 	{
-		fprintf(mFile,"\"%s.gd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gd\"");
 	}
 	void getGridDepthGain()const
 	{
-		fprintf(mFile,"\"%s.gdg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gdg\"");
 	}
 	void getGridDepthOffset()const
 	{
-		fprintf(mFile,"\"%s.gdo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gdo\"");
 	}
 protected:
 	EnvChrome(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,282 +26,282 @@ public:
 
 	void setPointWorld(const float3& pw)
 	{
-		fprintf(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
 		pw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointWorldX(float pwx)
 	{
 		if(pwx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.pwx\" %f;\n", pwx);
+		writeFloat(mFile,"\tsetAttr \".pw.pwx\" ",pwx,";\n");
 	}
 	void setPointWorldY(float pwy)
 	{
 		if(pwy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.pwy\" %f;\n", pwy);
+		writeFloat(mFile,"\tsetAttr \".pw.pwy\" ",pwy,";\n");
 	}
 	void setPointWorldZ(float pwz)
 	{
 		if(pwz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.pwz\" %f;\n", pwz);
+		writeFloat(mFile,"\tsetAttr \".pw.pwz\" ",pwz,";\n");
 	}
 	void setInfiniteSize(bool ie)
 	{
 		if(ie == 0) return;
-		fprintf(mFile,"\tsetAttr \".ie\" %i;\n", ie);
+		writeInt(mFile,"\tsetAttr \".ie\" ",ie,";\n");
 	}
 	void setLookupType(unsigned int lt)
 	{
 		if(lt == 0) return;
-		fprintf(mFile,"\tsetAttr \".lt\" %i;\n", lt);
+		writeInt(mFile,"\tsetAttr \".lt\" ",lt,";\n");
 	}
 	void setLeft(const float3& le)
 	{
 		if(le == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".le\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".le\" -type \"float3\" ");
 		le.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeftR(float ler)
 	{
 		if(ler == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".le.ler\" %f;\n", ler);
+		writeFloat(mFile,"\tsetAttr \".le.ler\" ",ler,";\n");
 	}
 	void setLeftG(float leg)
 	{
 		if(leg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".le.leg\" %f;\n", leg);
+		writeFloat(mFile,"\tsetAttr \".le.leg\" ",leg,";\n");
 	}
 	void setLeftB(float leb)
 	{
 		if(leb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".le.leb\" %f;\n", leb);
+		writeFloat(mFile,"\tsetAttr \".le.leb\" ",leb,";\n");
 	}
 	void setRight(const float3& ri)
 	{
 		if(ri == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ri\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ri\" -type \"float3\" ");
 		ri.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRightR(float rir)
 	{
 		if(rir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ri.rir\" %f;\n", rir);
+		writeFloat(mFile,"\tsetAttr \".ri.rir\" ",rir,";\n");
 	}
 	void setRightG(float rig)
 	{
 		if(rig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ri.rig\" %f;\n", rig);
+		writeFloat(mFile,"\tsetAttr \".ri.rig\" ",rig,";\n");
 	}
 	void setRightB(float rib)
 	{
 		if(rib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ri.rib\" %f;\n", rib);
+		writeFloat(mFile,"\tsetAttr \".ri.rib\" ",rib,";\n");
 	}
 	void setTop(const float3& to)
 	{
 		if(to == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".to\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".to\" -type \"float3\" ");
 		to.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTopR(float tor)
 	{
 		if(tor == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.tor\" %f;\n", tor);
+		writeFloat(mFile,"\tsetAttr \".to.tor\" ",tor,";\n");
 	}
 	void setTopG(float tog)
 	{
 		if(tog == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.tog\" %f;\n", tog);
+		writeFloat(mFile,"\tsetAttr \".to.tog\" ",tog,";\n");
 	}
 	void setTopB(float tob)
 	{
 		if(tob == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.tob\" %f;\n", tob);
+		writeFloat(mFile,"\tsetAttr \".to.tob\" ",tob,";\n");
 	}
 	void setBottom(const float3& bo)
 	{
 		if(bo == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".bo\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".bo\" -type \"float3\" ");
 		bo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBottomR(float bor)
 	{
 		if(bor == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bo.bor\" %f;\n", bor);
+		writeFloat(mFile,"\tsetAttr \".bo.bor\" ",bor,";\n");
 	}
 	void setBottomG(float bog)
 	{
 		if(bog == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bo.bog\" %f;\n", bog);
+		writeFloat(mFile,"\tsetAttr \".bo.bog\" ",bog,";\n");
 	}
 	void setBottomB(float bob)
 	{
 		if(bob == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bo.bob\" %f;\n", bob);
+		writeFloat(mFile,"\tsetAttr \".bo.bob\" ",bob,";\n");
 	}
 	void setFront(const float3& fr)
 	{
 		if(fr == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".fr\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fr\" -type \"float3\" ");
 		fr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFrontR(float frr)
 	{
 		if(frr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fr.frr\" %f;\n", frr);
+		writeFloat(mFile,"\tsetAttr \".fr.frr\" ",frr,";\n");
 	}
 	void setFrontG(float frg)
 	{
 		if(frg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fr.frg\" %f;\n", frg);
+		writeFloat(mFile,"\tsetAttr \".fr.frg\" ",frg,";\n");
 	}
 	void setFrontB(float frb)
 	{
 		if(frb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fr.frb\" %f;\n", frb);
+		writeFloat(mFile,"\tsetAttr \".fr.frb\" ",frb,";\n");
 	}
 	void setBack(const float3& ba)
 	{
 		if(ba == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ba\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ba\" -type \"float3\" ");
 		ba.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBackR(float bar)
 	{
 		if(bar == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ba.bar\" %f;\n", bar);
+		writeFloat(mFile,"\tsetAttr \".ba.bar\" ",bar,";\n");
 	}
 	void setBackG(float bag)
 	{
 		if(bag == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ba.bag\" %f;\n", bag);
+		writeFloat(mFile,"\tsetAttr \".ba.bag\" ",bag,";\n");
 	}
 	void setBackB(float bab)
 	{
 		if(bab == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ba.bab\" %f;\n", bab);
+		writeFloat(mFile,"\tsetAttr \".ba.bab\" ",bab,";\n");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.pw.pwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwx\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.pw.pwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwy\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.pw.pwz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwz\"");
 	}
 	void getLeft()const
 	{
-		fprintf(mFile,"\"%s.le\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".le\"");
 	}
 	void getLeftR()const
 	{
-		fprintf(mFile,"\"%s.le.ler\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".le.ler\"");
 	}
 	void getLeftG()const
 	{
-		fprintf(mFile,"\"%s.le.leg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".le.leg\"");
 	}
 	void getLeftB()const
 	{
-		fprintf(mFile,"\"%s.le.leb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".le.leb\"");
 	}
 	void getRight()const
 	{
-		fprintf(mFile,"\"%s.ri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri\"");
 	}
 	void getRightR()const
 	{
-		fprintf(mFile,"\"%s.ri.rir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.rir\"");
 	}
 	void getRightG()const
 	{
-		fprintf(mFile,"\"%s.ri.rig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.rig\"");
 	}
 	void getRightB()const
 	{
-		fprintf(mFile,"\"%s.ri.rib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.rib\"");
 	}
 	void getTop()const
 	{
-		fprintf(mFile,"\"%s.to\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to\"");
 	}
 	void getTopR()const
 	{
-		fprintf(mFile,"\"%s.to.tor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.tor\"");
 	}
 	void getTopG()const
 	{
-		fprintf(mFile,"\"%s.to.tog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.tog\"");
 	}
 	void getTopB()const
 	{
-		fprintf(mFile,"\"%s.to.tob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.tob\"");
 	}
 	void getBottom()const
 	{
-		fprintf(mFile,"\"%s.bo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo\"");
 	}
 	void getBottomR()const
 	{
-		fprintf(mFile,"\"%s.bo.bor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo.bor\"");
 	}
 	void getBottomG()const
 	{
-		fprintf(mFile,"\"%s.bo.bog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo.bog\"");
 	}
 	void getBottomB()const
 	{
-		fprintf(mFile,"\"%s.bo.bob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo.bob\"");
 	}
 	void getFront()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getFrontR()const
 	{
-		fprintf(mFile,"\"%s.fr.frr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr.frr\"");
 	}
 	void getFrontG()const
 	{
-		fprintf(mFile,"\"%s.fr.frg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr.frg\"");
 	}
 	void getFrontB()const
 	{
-		fprintf(mFile,"\"%s.fr.frb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr.frb\"");
 	}
 	void getBack()const
 	{
-		fprintf(mFile,"\"%s.ba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ba\"");
 	}
 	void getBackR()const
 	{
-		fprintf(mFile,"\"%s.ba.bar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ba.bar\"");
 	}
 	void getBackG()const
 	{
-		fprintf(mFile,"\"%s.ba.bag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ba.bag\"");
 	}
 	void getBackB()const
 	{
-		fprintf(mFile,"\"%s.ba.bab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ba.bab\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 protected:
 	EnvCube(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
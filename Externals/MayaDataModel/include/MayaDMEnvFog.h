@@ -27,628 +27,628 @@ public:
 	void setDistanceClipPlanes(unsigned int dcp)
 	{
 		if(dcp == 1) return;
-		fprintf(mFile,"\tsetAttr \".dcp\" %i;\n", dcp);
+		writeInt(mFile,"\tsetAttr \".dcp\" ",dcp,";\n");
 	}
 	void setUseLayer(bool ul)
 	{
 		if(ul == false) return;
-		fprintf(mFile,"\tsetAttr \".ul\" %i;\n", ul);
+		writeInt(mFile,"\tsetAttr \".ul\" ",ul,";\n");
 	}
 	void setUseHeight(bool uh)
 	{
 		if(uh == false) return;
-		fprintf(mFile,"\tsetAttr \".uh\" %i;\n", uh);
+		writeInt(mFile,"\tsetAttr \".uh\" ",uh,";\n");
 	}
 	void setBlendRange(float br)
 	{
 		if(br == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".br\" %f;\n", br);
+		writeFloat(mFile,"\tsetAttr \".br\" ",br,";\n");
 	}
 	void setSaturationDistance(float sdt)
 	{
 		if(sdt == 100.0) return;
-		fprintf(mFile,"\tsetAttr \".sdt\" %f;\n", sdt);
+		writeFloat(mFile,"\tsetAttr \".sdt\" ",sdt,";\n");
 	}
 	void setFogNearDistance(float fnd)
 	{
 		if(fnd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fnd\" %f;\n", fnd);
+		writeFloat(mFile,"\tsetAttr \".fnd\" ",fnd,";\n");
 	}
 	void setFogFarDistance(float ffd)
 	{
 		if(ffd == 200.0) return;
-		fprintf(mFile,"\tsetAttr \".ffd\" %f;\n", ffd);
+		writeFloat(mFile,"\tsetAttr \".ffd\" ",ffd,";\n");
 	}
 	void setLayer(float l)
 	{
 		if(l == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".l\" %f;\n", l);
+		writeFloat(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void setMinHeight(float mnh)
 	{
 		if(mnh == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".mnh\" %f;\n", mnh);
+		writeFloat(mFile,"\tsetAttr \".mnh\" ",mnh,";\n");
 	}
 	void setMaxHeight(float mxh)
 	{
 		if(mxh == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mxh\" %f;\n", mxh);
+		writeFloat(mFile,"\tsetAttr \".mxh\" ",mxh,";\n");
 	}
 	void setUseDistance(bool ud)
 	{
 		if(ud == false) return;
-		fprintf(mFile,"\tsetAttr \".ud\" %i;\n", ud);
+		writeInt(mFile,"\tsetAttr \".ud\" ",ud,";\n");
 	}
 	void setStartDistance(float sd)
 	{
 		if(sd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %f;\n", sd);
+		writeFloat(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void setEndDistance(float ed)
 	{
 		if(ed == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".ed\" %f;\n", ed);
+		writeFloat(mFile,"\tsetAttr \".ed\" ",ed,";\n");
 	}
 	void setPhysicalFog(bool sff)
 	{
 		if(sff == false) return;
-		fprintf(mFile,"\tsetAttr \".sff\" %i;\n", sff);
+		writeInt(mFile,"\tsetAttr \".sff\" ",sff,";\n");
 	}
 	void setFogType(unsigned int ftp)
 	{
 		if(ftp == 0) return;
-		fprintf(mFile,"\tsetAttr \".ftp\" %i;\n", ftp);
+		writeInt(mFile,"\tsetAttr \".ftp\" ",ftp,";\n");
 	}
 	void setFogDensity(double fdn)
 	{
 		if(fdn == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".fdn\" %f;\n", fdn);
+		writeFloat(mFile,"\tsetAttr \".fdn\" ",fdn,";\n");
 	}
 	void setFogColor(const float3& fcl)
 	{
-		fprintf(mFile,"\tsetAttr \".fcl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fcl\" -type \"float3\" ");
 		fcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFogColorR(float fcr)
 	{
 		if(fcr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fcl.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fcl.fcr\" ",fcr,";\n");
 	}
 	void setFogColorG(float fcg)
 	{
 		if(fcg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fcl.fcg\" %f;\n", fcg);
+		writeFloat(mFile,"\tsetAttr \".fcl.fcg\" ",fcg,";\n");
 	}
 	void setFogColorB(float fcb)
 	{
 		if(fcb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fcl.fcb\" %f;\n", fcb);
+		writeFloat(mFile,"\tsetAttr \".fcl.fcb\" ",fcb,";\n");
 	}
 	void setFogOpacity(const float3& fop)
 	{
-		fprintf(mFile,"\tsetAttr \".fop\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fop\" -type \"float3\" ");
 		fop.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFogOpacityR(float for_)
 	{
 		if(for_ == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".fop.for\" %f;\n", for_);
+		writeFloat(mFile,"\tsetAttr \".fop.for\" ",for_,";\n");
 	}
 	void setFogOpacityG(float fog)
 	{
 		if(fog == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".fop.fog\" %f;\n", fog);
+		writeFloat(mFile,"\tsetAttr \".fop.fog\" ",fog,";\n");
 	}
 	void setFogOpacityB(float fob)
 	{
 		if(fob == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".fop.fob\" %f;\n", fob);
+		writeFloat(mFile,"\tsetAttr \".fop.fob\" ",fob,";\n");
 	}
 	void setFogMinHeight(double fmh)
 	{
 		if(fmh == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fmh\" %f;\n", fmh);
+		writeFloat(mFile,"\tsetAttr \".fmh\" ",fmh,";\n");
 	}
 	void setFogMaxHeight(double fxh)
 	{
 		if(fxh == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fxh\" %f;\n", fxh);
+		writeFloat(mFile,"\tsetAttr \".fxh\" ",fxh,";\n");
 	}
 	void setFogDecay(double fdc)
 	{
 		if(fdc == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".fdc\" %f;\n", fdc);
+		writeFloat(mFile,"\tsetAttr \".fdc\" ",fdc,";\n");
 	}
 	void setFogLightScatter(double flc)
 	{
 		if(flc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".flc\" %f;\n", flc);
+		writeFloat(mFile,"\tsetAttr \".flc\" ",flc,";\n");
 	}
 	void setAirDensity(double adn)
 	{
 		if(adn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".adn\" %f;\n", adn);
+		writeFloat(mFile,"\tsetAttr \".adn\" ",adn,";\n");
 	}
 	void setAirColor(const float3& acl)
 	{
-		fprintf(mFile,"\tsetAttr \".acl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".acl\" -type \"float3\" ");
 		acl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAirColorR(float acr)
 	{
 		if(acr == 0.6) return;
-		fprintf(mFile,"\tsetAttr \".acl.acr\" %f;\n", acr);
+		writeFloat(mFile,"\tsetAttr \".acl.acr\" ",acr,";\n");
 	}
 	void setAirColorG(float acg)
 	{
 		if(acg == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".acl.acg\" %f;\n", acg);
+		writeFloat(mFile,"\tsetAttr \".acl.acg\" ",acg,";\n");
 	}
 	void setAirColorB(float acb)
 	{
 		if(acb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".acl.acb\" %f;\n", acb);
+		writeFloat(mFile,"\tsetAttr \".acl.acb\" ",acb,";\n");
 	}
 	void setAirOpacity(const float3& aop)
 	{
-		fprintf(mFile,"\tsetAttr \".aop\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".aop\" -type \"float3\" ");
 		aop.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAirOpacityR(float aor)
 	{
 		if(aor == 0.37) return;
-		fprintf(mFile,"\tsetAttr \".aop.aor\" %f;\n", aor);
+		writeFloat(mFile,"\tsetAttr \".aop.aor\" ",aor,";\n");
 	}
 	void setAirOpacityG(float aog)
 	{
 		if(aog == 0.47) return;
-		fprintf(mFile,"\tsetAttr \".aop.aog\" %f;\n", aog);
+		writeFloat(mFile,"\tsetAttr \".aop.aog\" ",aog,";\n");
 	}
 	void setAirOpacityB(float aob)
 	{
 		if(aob == 0.9) return;
-		fprintf(mFile,"\tsetAttr \".aop.aob\" %f;\n", aob);
+		writeFloat(mFile,"\tsetAttr \".aop.aob\" ",aob,";\n");
 	}
 	void setAirMinHeight(double amh)
 	{
 		if(amh == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".amh\" %f;\n", amh);
+		writeFloat(mFile,"\tsetAttr \".amh\" ",amh,";\n");
 	}
 	void setAirMaxHeight(double axh)
 	{
 		if(axh == 50.0) return;
-		fprintf(mFile,"\tsetAttr \".axh\" %f;\n", axh);
+		writeFloat(mFile,"\tsetAttr \".axh\" ",axh,";\n");
 	}
 	void setAirDecay(double adc)
 	{
 		if(adc == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".adc\" %f;\n", adc);
+		writeFloat(mFile,"\tsetAttr \".adc\" ",adc,";\n");
 	}
 	void setAirLightScatter(double alc)
 	{
 		if(alc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".alc\" %f;\n", alc);
+		writeFloat(mFile,"\tsetAttr \".alc\" ",alc,";\n");
 	}
 	void setWaterDensity(double wdn)
 	{
 		if(wdn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wdn\" %f;\n", wdn);
+		writeFloat(mFile,"\tsetAttr \".wdn\" ",wdn,";\n");
 	}
 	void setWaterColor(const float3& wcl)
 	{
-		fprintf(mFile,"\tsetAttr \".wcl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".wcl\" -type \"float3\" ");
 		wcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaterColorR(float wcr)
 	{
 		if(wcr == 0.6) return;
-		fprintf(mFile,"\tsetAttr \".wcl.wcr\" %f;\n", wcr);
+		writeFloat(mFile,"\tsetAttr \".wcl.wcr\" ",wcr,";\n");
 	}
 	void setWaterColorG(float wcg)
 	{
 		if(wcg == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".wcl.wcg\" %f;\n", wcg);
+		writeFloat(mFile,"\tsetAttr \".wcl.wcg\" ",wcg,";\n");
 	}
 	void setWaterColorB(float wcb)
 	{
 		if(wcb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wcl.wcb\" %f;\n", wcb);
+		writeFloat(mFile,"\tsetAttr \".wcl.wcb\" ",wcb,";\n");
 	}
 	void setWaterOpacity(const float3& wop)
 	{
-		fprintf(mFile,"\tsetAttr \".wop\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".wop\" -type \"float3\" ");
 		wop.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaterOpacityR(float wor)
 	{
 		if(wor == 0.37) return;
-		fprintf(mFile,"\tsetAttr \".wop.wor\" %f;\n", wor);
+		writeFloat(mFile,"\tsetAttr \".wop.wor\" ",wor,";\n");
 	}
 	void setWaterOpacityG(float wog)
 	{
 		if(wog == 0.47) return;
-		fprintf(mFile,"\tsetAttr \".wop.wog\" %f;\n", wog);
+		writeFloat(mFile,"\tsetAttr \".wop.wog\" ",wog,";\n");
 	}
 	void setWaterOpacityB(float wob)
 	{
 		if(wob == 0.9) return;
-		fprintf(mFile,"\tsetAttr \".wop.wob\" %f;\n", wob);
+		writeFloat(mFile,"\tsetAttr \".wop.wob\" ",wob,";\n");
 	}
 	void setWaterLevel(double wlv)
 	{
 		if(wlv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wlv\" %f;\n", wlv);
+		writeFloat(mFile,"\tsetAttr \".wlv\" ",wlv,";\n");
 	}
 	void setWaterDepth(double wdp)
 	{
 		if(wdp == 50.0) return;
-		fprintf(mFile,"\tsetAttr \".wdp\" %f;\n", wdp);
+		writeFloat(mFile,"\tsetAttr \".wdp\" ",wdp,";\n");
 	}
 	void setWaterLightDecay(double wdc)
 	{
 		if(wdc == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".wdc\" %f;\n", wdc);
+		writeFloat(mFile,"\tsetAttr \".wdc\" ",wdc,";\n");
 	}
 	void setWaterLightScatter(double wlc)
 	{
 		if(wlc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wlc\" %f;\n", wlc);
+		writeFloat(mFile,"\tsetAttr \".wlc\" ",wlc,";\n");
 	}
 	void setPlanetRadius(double prd)
 	{
 		if(prd == 1000.0) return;
-		fprintf(mFile,"\tsetAttr \".prd\" %f;\n", prd);
+		writeFloat(mFile,"\tsetAttr \".prd\" ",prd,";\n");
 	}
 	void setFogAxis(unsigned int fax)
 	{
 		if(fax == 0) return;
-		fprintf(mFile,"\tsetAttr \".fax\" %i;\n", fax);
+		writeInt(mFile,"\tsetAttr \".fax\" ",fax,";\n");
 	}
 	void setSunIntensity(double sin)
 	{
 		if(sin == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sin\" %f;\n", sin);
+		writeFloat(mFile,"\tsetAttr \".sin\" ",sin,";\n");
 	}
 	void setSunAzimuth(double saz)
 	{
 		if(saz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".saz\" %f;\n", saz);
+		writeFloat(mFile,"\tsetAttr \".saz\" ",saz,";\n");
 	}
 	void setSunElevation(double sel)
 	{
 		if(sel == 45.0) return;
-		fprintf(mFile,"\tsetAttr \".sel\" %f;\n", sel);
+		writeFloat(mFile,"\tsetAttr \".sel\" ",sel,";\n");
 	}
 	void setSunColor(const float3& snc)
 	{
-		fprintf(mFile,"\tsetAttr \".snc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".snc\" -type \"float3\" ");
 		snc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSunColorR(float snr)
 	{
 		if(snr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".snc.snr\" %f;\n", snr);
+		writeFloat(mFile,"\tsetAttr \".snc.snr\" ",snr,";\n");
 	}
 	void setSunColorG(float sng)
 	{
 		if(sng == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".snc.sng\" %f;\n", sng);
+		writeFloat(mFile,"\tsetAttr \".snc.sng\" ",sng,";\n");
 	}
 	void setSunColorB(float snb)
 	{
 		if(snb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".snc.snb\" %f;\n", snb);
+		writeFloat(mFile,"\tsetAttr \".snc.snb\" ",snb,";\n");
 	}
 	void getMatrixEyeToWorld()const
 	{
-		fprintf(mFile,"\"%s.e2w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2w\"");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.pw.pwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwx\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.pw.pwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwy\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.pw.pwz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwz\"");
 	}
 	void getRayDirection()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRayDirectionX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRayDirectionY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRayDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getDistanceClipPlanes()const
 	{
-		fprintf(mFile,"\"%s.dcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcp\"");
 	}
 	void getUseLayer()const
 	{
-		fprintf(mFile,"\"%s.ul\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ul\"");
 	}
 	void getUseHeight()const
 	{
-		fprintf(mFile,"\"%s.uh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uh\"");
 	}
 	void getBlendRange()const
 	{
-		fprintf(mFile,"\"%s.br\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".br\"");
 	}
 	void getSaturationDistance()const
 	{
-		fprintf(mFile,"\"%s.sdt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdt\"");
 	}
 	void getFogNearDistance()const
 	{
-		fprintf(mFile,"\"%s.fnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fnd\"");
 	}
 	void getFogFarDistance()const
 	{
-		fprintf(mFile,"\"%s.ffd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ffd\"");
 	}
 	void getLayer()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getMinHeight()const
 	{
-		fprintf(mFile,"\"%s.mnh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mnh\"");
 	}
 	void getMaxHeight()const
 	{
-		fprintf(mFile,"\"%s.mxh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxh\"");
 	}
 	void getUseDistance()const
 	{
-		fprintf(mFile,"\"%s.ud\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ud\"");
 	}
 	void getStartDistance()const
 	{
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getEndDistance()const
 	{
-		fprintf(mFile,"\"%s.ed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed\"");
 	}
 	void getPhysicalFog()const
 	{
-		fprintf(mFile,"\"%s.sff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sff\"");
 	}
 	void getFogType()const
 	{
-		fprintf(mFile,"\"%s.ftp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ftp\"");
 	}
 	void getFogDensity()const
 	{
-		fprintf(mFile,"\"%s.fdn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fdn\"");
 	}
 	void getFogColor()const
 	{
-		fprintf(mFile,"\"%s.fcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcl\"");
 	}
 	void getFogColorR()const
 	{
-		fprintf(mFile,"\"%s.fcl.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcl.fcr\"");
 	}
 	void getFogColorG()const
 	{
-		fprintf(mFile,"\"%s.fcl.fcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcl.fcg\"");
 	}
 	void getFogColorB()const
 	{
-		fprintf(mFile,"\"%s.fcl.fcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcl.fcb\"");
 	}
 	void getFogOpacity()const
 	{
-		fprintf(mFile,"\"%s.fop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fop\"");
 	}
 	void getFogOpacityR()const
 	{
-		fprintf(mFile,"\"%s.fop.for\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fop.for\"");
 	}
 	void getFogOpacityG()const
 	{
-		fprintf(mFile,"\"%s.fop.fog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fop.fog\"");
 	}
 	void getFogOpacityB()const
 	{
-		fprintf(mFile,"\"%s.fop.fob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fop.fob\"");
 	}
 	void getFogMinHeight()const
 	{
-		fprintf(mFile,"\"%s.fmh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fmh\"");
 	}
 	void getFogMaxHeight()const
 	{
-		fprintf(mFile,"\"%s.fxh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fxh\"");
 	}
 	void getFogDecay()const
 	{
-		fprintf(mFile,"\"%s.fdc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fdc\"");
 	}
 	void getFogLightScatter()const
 	{
-		fprintf(mFile,"\"%s.flc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc\"");
 	}
 	void getAirDensity()const
 	{
-		fprintf(mFile,"\"%s.adn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".adn\"");
 	}
 	void getAirColor()const
 	{
-		fprintf(mFile,"\"%s.acl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acl\"");
 	}
 	void getAirColorR()const
 	{
-		fprintf(mFile,"\"%s.acl.acr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acl.acr\"");
 	}
 	void getAirColorG()const
 	{
-		fprintf(mFile,"\"%s.acl.acg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acl.acg\"");
 	}
 	void getAirColorB()const
 	{
-		fprintf(mFile,"\"%s.acl.acb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acl.acb\"");
 	}
 	void getAirOpacity()const
 	{
-		fprintf(mFile,"\"%s.aop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aop\"");
 	}
 	void getAirOpacityR()const
 	{
-		fprintf(mFile,"\"%s.aop.aor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aop.aor\"");
 	}
 	void getAirOpacityG()const
 	{
-		fprintf(mFile,"\"%s.aop.aog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aop.aog\"");
 	}
 	void getAirOpacityB()const
 	{
-		fprintf(mFile,"\"%s.aop.aob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aop.aob\"");
 	}
 	void getAirMinHeight()const
 	{
-		fprintf(mFile,"\"%s.amh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amh\"");
 	}
 	void getAirMaxHeight()const
 	{
-		fprintf(mFile,"\"%s.axh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".axh\"");
 	}
 	void getAirDecay()const
 	{
-		fprintf(mFile,"\"%s.adc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".adc\"");
 	}
 	void getAirLightScatter()const
 	{
-		fprintf(mFile,"\"%s.alc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".alc\"");
 	}
 	void getWaterDensity()const
 	{
-		fprintf(mFile,"\"%s.wdn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wdn\"");
 	}
 	void getWaterColor()const
 	{
-		fprintf(mFile,"\"%s.wcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wcl\"");
 	}
 	void getWaterColorR()const
 	{
-		fprintf(mFile,"\"%s.wcl.wcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wcl.wcr\"");
 	}
 	void getWaterColorG()const
 	{
-		fprintf(mFile,"\"%s.wcl.wcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wcl.wcg\"");
 	}
 	void getWaterColorB()const
 	{
-		fprintf(mFile,"\"%s.wcl.wcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wcl.wcb\"");
 	}
 	void getWaterOpacity()const
 	{
-		fprintf(mFile,"\"%s.wop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wop\"");
 	}
 	void getWaterOpacityR()const
 	{
-		fprintf(mFile,"\"%s.wop.wor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wop.wor\"");
 	}
 	void getWaterOpacityG()const
 	{
-		fprintf(mFile,"\"%s.wop.wog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wop.wog\"");
 	}
 	void getWaterOpacityB()const
 	{
-		fprintf(mFile,"\"%s.wop.wob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wop.wob\"");
 	}
 	void getWaterLevel()const
 	{
-		fprintf(mFile,"\"%s.wlv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wlv\"");
 	}
 	void getWaterDepth()const
 	{
-		fprintf(mFile,"\"%s.wdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wdp\"");
 	}
 	void getWaterLightDecay()const
 	{
-		fprintf(mFile,"\"%s.wdc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wdc\"");
 	}
 	void getWaterLightScatter()const
 	{
-		fprintf(mFile,"\"%s.wlc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wlc\"");
 	}
 	void getPlanetRadius()const
 	{
-		fprintf(mFile,"\"%s.prd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".prd\"");
 	}
 	void getFogAxis()const
 	{
-		fprintf(mFile,"\"%s.fax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fax\"");
 	}
 	void getSunIntensity()const
 	{
-		fprintf(mFile,"\"%s.sin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sin\"");
 	}
 	void getSunAzimuth()const
 	{
-		fprintf(mFile,"\"%s.saz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".saz\"");
 	}
 	void getSunElevation()const
 	{
-		fprintf(mFile,"\"%s.sel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sel\"");
 	}
 	void getSunColor()const
 	{
-		fprintf(mFile,"\"%s.snc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".snc\"");
 	}
 	void getSunColorR()const
 	{
-		fprintf(mFile,"\"%s.snc.snr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".snc.snr\"");
 	}
 	void getSunColorG()const
 	{
-		fprintf(mFile,"\"%s.snc.sng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".snc.sng\"");
 	}
 	void getSunColorB()const
 	{
-		fprintf(mFile,"\"%s.snc.snb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".snc.snb\"");
 	}
 protected:
 	EnvFog(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
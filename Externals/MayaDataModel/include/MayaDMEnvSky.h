@@ -27,451 +27,451 @@ public:
 	void setTotalBrightness(float tb)
 	{
 		if(tb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tb\" %f;\n", tb);
+		writeFloat(mFile,"\tsetAttr \".tb\" ",tb,";\n");
 	}
 	void setSunBrightness(const float3& su)
 	{
 		if(su == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".su\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".su\" -type \"float3\" ");
 		su.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSunBrightnessR(float sur)
 	{
 		if(sur == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".su.sur\" %f;\n", sur);
+		writeFloat(mFile,"\tsetAttr \".su.sur\" ",sur,";\n");
 	}
 	void setSunBrightnessG(float sug)
 	{
 		if(sug == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".su.sug\" %f;\n", sug);
+		writeFloat(mFile,"\tsetAttr \".su.sug\" ",sug,";\n");
 	}
 	void setSunBrightnessB(float sub)
 	{
 		if(sub == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".su.sub\" %f;\n", sub);
+		writeFloat(mFile,"\tsetAttr \".su.sub\" ",sub,";\n");
 	}
 	void setHaloBrightness(const float3& hb)
 	{
 		if(hb == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".hb\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".hb\" -type \"float3\" ");
 		hb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHaloBrightnessR(float hbr)
 	{
 		if(hbr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hb.hbr\" %f;\n", hbr);
+		writeFloat(mFile,"\tsetAttr \".hb.hbr\" ",hbr,";\n");
 	}
 	void setHaloBrightnessG(float hbg)
 	{
 		if(hbg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hb.hbg\" %f;\n", hbg);
+		writeFloat(mFile,"\tsetAttr \".hb.hbg\" ",hbg,";\n");
 	}
 	void setHaloBrightnessB(float hbb)
 	{
 		if(hbb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hb.hbb\" %f;\n", hbb);
+		writeFloat(mFile,"\tsetAttr \".hb.hbb\" ",hbb,";\n");
 	}
 	void setElevation(double e)
 	{
 		if(e == 4) return;
-		fprintf(mFile,"\tsetAttr \".e\" %f;\n", e);
+		writeFloat(mFile,"\tsetAttr \".e\" ",e,";\n");
 	}
 	void setAzimuth(double az)
 	{
 		if(az == 1) return;
-		fprintf(mFile,"\tsetAttr \".az\" %f;\n", az);
+		writeFloat(mFile,"\tsetAttr \".az\" ",az,";\n");
 	}
 	void setSize(float sz)
 	{
 		if(sz == 0.531) return;
-		fprintf(mFile,"\tsetAttr \".sz\" %f;\n", sz);
+		writeFloat(mFile,"\tsetAttr \".sz\" ",sz,";\n");
 	}
 	void setBlur(float b)
 	{
 		if(b == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setSkyBrightness(const float3& sk)
 	{
 		if(sk == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".sk\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sk\" -type \"float3\" ");
 		sk.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSkyBrightnessR(float skr)
 	{
 		if(skr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sk.skr\" %f;\n", skr);
+		writeFloat(mFile,"\tsetAttr \".sk.skr\" ",skr,";\n");
 	}
 	void setSkyBrightnessG(float skg)
 	{
 		if(skg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sk.skg\" %f;\n", skg);
+		writeFloat(mFile,"\tsetAttr \".sk.skg\" ",skg,";\n");
 	}
 	void setSkyBrightnessB(float skb)
 	{
 		if(skb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sk.skb\" %f;\n", skb);
+		writeFloat(mFile,"\tsetAttr \".sk.skb\" ",skb,";\n");
 	}
 	void setAirDensity(float ad)
 	{
 		if(ad == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ad\" %f;\n", ad);
+		writeFloat(mFile,"\tsetAttr \".ad\" ",ad,";\n");
 	}
 	void setDustDensity(float dd)
 	{
 		if(dd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dd\" %f;\n", dd);
+		writeFloat(mFile,"\tsetAttr \".dd\" ",dd,";\n");
 	}
 	void setSkyThickness(float st)
 	{
 		if(st == 1000.0) return;
-		fprintf(mFile,"\tsetAttr \".st\" %f;\n", st);
+		writeFloat(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void setSkyRadius(float sr)
 	{
 		if(sr == 50.0) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setHasFloor(bool hf)
 	{
 		if(hf == true) return;
-		fprintf(mFile,"\tsetAttr \".hf\" %i;\n", hf);
+		writeInt(mFile,"\tsetAttr \".hf\" ",hf,";\n");
 	}
 	void setFloorColor(const float3& fc)
 	{
 		if(fc == float3(0.4f,0.4f,0.4f)) return;
-		fprintf(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFloorColorR(float fcr)
 	{
 		if(fcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fc.fcr\" ",fcr,";\n");
 	}
 	void setFloorColorG(float fcg)
 	{
 		if(fcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcg\" %f;\n", fcg);
+		writeFloat(mFile,"\tsetAttr \".fc.fcg\" ",fcg,";\n");
 	}
 	void setFloorColorB(float fcb)
 	{
 		if(fcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcb\" %f;\n", fcb);
+		writeFloat(mFile,"\tsetAttr \".fc.fcb\" ",fcb,";\n");
 	}
 	void setFloorAltitude(float fa)
 	{
 		if(fa == -10.0) return;
-		fprintf(mFile,"\tsetAttr \".fa\" %f;\n", fa);
+		writeFloat(mFile,"\tsetAttr \".fa\" ",fa,";\n");
 	}
 	void setUseTexture(bool ut)
 	{
 		if(ut == false) return;
-		fprintf(mFile,"\tsetAttr \".ut\" %i;\n", ut);
+		writeInt(mFile,"\tsetAttr \".ut\" ",ut,";\n");
 	}
 	void setCloudTexture(float ct)
 	{
 		if(ct == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ct\" %f;\n", ct);
+		writeFloat(mFile,"\tsetAttr \".ct\" ",ct,";\n");
 	}
 	void setCloudBrightness(const float3& cb)
 	{
 		if(cb == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".cb\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cb\" -type \"float3\" ");
 		cb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCloudBrightnessR(float cbr)
 	{
 		if(cbr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cb.cbr\" %f;\n", cbr);
+		writeFloat(mFile,"\tsetAttr \".cb.cbr\" ",cbr,";\n");
 	}
 	void setCloudBrightnessG(float cbg)
 	{
 		if(cbg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cb.cbg\" %f;\n", cbg);
+		writeFloat(mFile,"\tsetAttr \".cb.cbg\" ",cbg,";\n");
 	}
 	void setCloudBrightnessB(float cbb)
 	{
 		if(cbb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cb.cbb\" %f;\n", cbb);
+		writeFloat(mFile,"\tsetAttr \".cb.cbb\" ",cbb,";\n");
 	}
 	void setSunsetBrightness(const float3& ss)
 	{
 		if(ss == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ss\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ss\" -type \"float3\" ");
 		ss.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSunsetBrightnessR(float ssr)
 	{
 		if(ssr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ss.ssr\" %f;\n", ssr);
+		writeFloat(mFile,"\tsetAttr \".ss.ssr\" ",ssr,";\n");
 	}
 	void setSunsetBrightnessG(float ssg)
 	{
 		if(ssg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ss.ssg\" %f;\n", ssg);
+		writeFloat(mFile,"\tsetAttr \".ss.ssg\" ",ssg,";\n");
 	}
 	void setSunsetBrightnessB(float ssb)
 	{
 		if(ssb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ss.ssb\" %f;\n", ssb);
+		writeFloat(mFile,"\tsetAttr \".ss.ssb\" ",ssb,";\n");
 	}
 	void setDensity(float d)
 	{
 		if(d == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setThreshold(float t)
 	{
 		if(t == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".t\" %f;\n", t);
+		writeFloat(mFile,"\tsetAttr \".t\" ",t,";\n");
 	}
 	void setPower(float po)
 	{
 		if(po == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".po\" %f;\n", po);
+		writeFloat(mFile,"\tsetAttr \".po\" ",po,";\n");
 	}
 	void setAltitude(float a)
 	{
 		if(a == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setHaloSize(float hs)
 	{
 		if(hs == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".hs\" %f;\n", hs);
+		writeFloat(mFile,"\tsetAttr \".hs\" ",hs,";\n");
 	}
 	void setSkySamples(float ssa)
 	{
 		if(ssa == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".ssa\" %f;\n", ssa);
+		writeFloat(mFile,"\tsetAttr \".ssa\" ",ssa,";\n");
 	}
 	void setFloorSamples(float fsa)
 	{
 		if(fsa == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fsa\" %f;\n", fsa);
+		writeFloat(mFile,"\tsetAttr \".fsa\" ",fsa,";\n");
 	}
 	void setCloudSamples(float csa)
 	{
 		if(csa == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".csa\" %f;\n", csa);
+		writeFloat(mFile,"\tsetAttr \".csa\" ",csa,";\n");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getTotalBrightness()const
 	{
-		fprintf(mFile,"\"%s.tb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tb\"");
 	}
 	void getSunBrightness()const
 	{
-		fprintf(mFile,"\"%s.su\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su\"");
 	}
 	void getSunBrightnessR()const
 	{
-		fprintf(mFile,"\"%s.su.sur\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su.sur\"");
 	}
 	void getSunBrightnessG()const
 	{
-		fprintf(mFile,"\"%s.su.sug\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su.sug\"");
 	}
 	void getSunBrightnessB()const
 	{
-		fprintf(mFile,"\"%s.su.sub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su.sub\"");
 	}
 	void getHaloBrightness()const
 	{
-		fprintf(mFile,"\"%s.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb\"");
 	}
 	void getHaloBrightnessR()const
 	{
-		fprintf(mFile,"\"%s.hb.hbr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb.hbr\"");
 	}
 	void getHaloBrightnessG()const
 	{
-		fprintf(mFile,"\"%s.hb.hbg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb.hbg\"");
 	}
 	void getHaloBrightnessB()const
 	{
-		fprintf(mFile,"\"%s.hb.hbb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hb.hbb\"");
 	}
 	void getElevation()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 	void getAzimuth()const
 	{
-		fprintf(mFile,"\"%s.az\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".az\"");
 	}
 	void getSize()const
 	{
-		fprintf(mFile,"\"%s.sz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sz\"");
 	}
 	void getBlur()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getSkyBrightness()const
 	{
-		fprintf(mFile,"\"%s.sk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sk\"");
 	}
 	void getSkyBrightnessR()const
 	{
-		fprintf(mFile,"\"%s.sk.skr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sk.skr\"");
 	}
 	void getSkyBrightnessG()const
 	{
-		fprintf(mFile,"\"%s.sk.skg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sk.skg\"");
 	}
 	void getSkyBrightnessB()const
 	{
-		fprintf(mFile,"\"%s.sk.skb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sk.skb\"");
 	}
 	void getAirDensity()const
 	{
-		fprintf(mFile,"\"%s.ad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ad\"");
 	}
 	void getDustDensity()const
 	{
-		fprintf(mFile,"\"%s.dd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dd\"");
 	}
 	void getSkyThickness()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getSkyRadius()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getHasFloor()const
 	{
-		fprintf(mFile,"\"%s.hf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hf\"");
 	}
 	void getFloorColor()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFloorColorR()const
 	{
-		fprintf(mFile,"\"%s.fc.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcr\"");
 	}
 	void getFloorColorG()const
 	{
-		fprintf(mFile,"\"%s.fc.fcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcg\"");
 	}
 	void getFloorColorB()const
 	{
-		fprintf(mFile,"\"%s.fc.fcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcb\"");
 	}
 	void getFloorAltitude()const
 	{
-		fprintf(mFile,"\"%s.fa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fa\"");
 	}
 	void getUseTexture()const
 	{
-		fprintf(mFile,"\"%s.ut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ut\"");
 	}
 	void getCloudTexture()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getCloudBrightness()const
 	{
-		fprintf(mFile,"\"%s.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb\"");
 	}
 	void getCloudBrightnessR()const
 	{
-		fprintf(mFile,"\"%s.cb.cbr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb.cbr\"");
 	}
 	void getCloudBrightnessG()const
 	{
-		fprintf(mFile,"\"%s.cb.cbg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb.cbg\"");
 	}
 	void getCloudBrightnessB()const
 	{
-		fprintf(mFile,"\"%s.cb.cbb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb.cbb\"");
 	}
 	void getSunsetBrightness()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getSunsetBrightnessR()const
 	{
-		fprintf(mFile,"\"%s.ss.ssr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss.ssr\"");
 	}
 	void getSunsetBrightnessG()const
 	{
-		fprintf(mFile,"\"%s.ss.ssg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss.ssg\"");
 	}
 	void getSunsetBrightnessB()const
 	{
-		fprintf(mFile,"\"%s.ss.ssb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss.ssb\"");
 	}
 	void getDensity()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getPower()const
 	{
-		fprintf(mFile,"\"%s.po\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po\"");
 	}
 	void getAltitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getHaloSize()const
 	{
-		fprintf(mFile,"\"%s.hs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hs\"");
 	}
 	void getSkySamples()const
 	{
-		fprintf(mFile,"\"%s.ssa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssa\"");
 	}
 	void getFloorSamples()const
 	{
-		fprintf(mFile,"\"%s.fsa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsa\"");
 	}
 	void getCloudSamples()const
 	{
-		fprintf(mFile,"\"%s.csa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csa\"");
 	}
 protected:
 	EnvSky(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,114 +27,114 @@ public:
 	void setImage(const float3& so)
 	{
 		if(so == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".so\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".so\" -type \"float3\" ");
 		so.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageR(float sor)
 	{
 		if(sor == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".so.sor\" %f;\n", sor);
+		writeFloat(mFile,"\tsetAttr \".so.sor\" ",sor,";\n");
 	}
 	void setImageG(float sog)
 	{
 		if(sog == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".so.sog\" %f;\n", sog);
+		writeFloat(mFile,"\tsetAttr \".so.sog\" ",sog,";\n");
 	}
 	void setImageB(float sob)
 	{
 		if(sob == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".so.sob\" %f;\n", sob);
+		writeFloat(mFile,"\tsetAttr \".so.sob\" ",sob,";\n");
 	}
 	void setShearUV(const float2& suv)
 	{
 		if(suv == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".suv\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".suv\" -type \"float2\" ");
 		suv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShearU(float su)
 	{
 		if(su == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".suv.su\" %f;\n", su);
+		writeFloat(mFile,"\tsetAttr \".suv.su\" ",su,";\n");
 	}
 	void setShearV(float sv)
 	{
 		if(sv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".suv.sv\" %f;\n", sv);
+		writeFloat(mFile,"\tsetAttr \".suv.sv\" ",sv,";\n");
 	}
 	void setFlip(bool f)
 	{
 		if(f == false) return;
-		fprintf(mFile,"\tsetAttr \".f\" %i;\n", f);
+		writeInt(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getImage()const
 	{
-		fprintf(mFile,"\"%s.so\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so\"");
 	}
 	void getImageR()const
 	{
-		fprintf(mFile,"\"%s.so.sor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sor\"");
 	}
 	void getImageG()const
 	{
-		fprintf(mFile,"\"%s.so.sog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sog\"");
 	}
 	void getImageB()const
 	{
-		fprintf(mFile,"\"%s.so.sob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sob\"");
 	}
 	void getShearUV()const
 	{
-		fprintf(mFile,"\"%s.suv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".suv\"");
 	}
 	void getShearU()const
 	{
-		fprintf(mFile,"\"%s.suv.su\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".suv.su\"");
 	}
 	void getShearV()const
 	{
-		fprintf(mFile,"\"%s.suv.sv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".suv.sv\"");
 	}
 	void getFlip()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 protected:
 	EnvSphere(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,16 +26,16 @@ public:
 
 	void getInputShell()const
 	{
-		fprintf(mFile,"\"%s.ish\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ish\"");
 	}
 	void getOutputSurface(size_t os_i)const
 	{
-		fprintf(mFile,"\"%s.os[%i]\"",mName.c_str(),os_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".os[",os_i,"]\"");
 	}
 	void getOutputSurface()const
 	{
 
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	ExplodeNurbsShell(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,117 +27,117 @@ public:
 	void setInput(size_t in_i,double in)
 	{
 		if(in == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".in[%i]\" %f;\n", in_i,in);
+		writeInt(mFile,"\tsetAttr \".in[",in_i); writeFloat(mFile,"]\" ",in,";\n");
 	}
 	void setInput(size_t in_start,size_t in_end,double* in)
 	{
-		fprintf(mFile,"\tsetAttr \".in[%i:%i]\" ", in_start,in_end);
+		writeInt(mFile,"\tsetAttr \".in[",in_start); writeInt(mFile,":",in_end,"]\" ");
 		size_t size = (in_end-in_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",in[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",in[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput(size_t in_start,size_t in_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".in[%i:%i]\"",in_start,in_end);
+		writeInt(mFile,"\tsetAttr \".in[",in_start); writeInt(mFile,":",in_end,"]\"");
 	}
 	void appendInput(double in)const
 	{
-		fprintf(mFile," %f",in);
+		writeFloat(mFile," ",in);
 	}
 	void endInput()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInternalExpression(const string& ixp)
 	{
 		if(ixp == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ixp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ixp\" -type \"string\" ");
 		ixp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAnimated(unsigned int ani)
 	{
 		if(ani == 1) return;
-		fprintf(mFile,"\tsetAttr \".ani\" %i;\n", ani);
+		writeInt(mFile,"\tsetAttr \".ani\" ",ani,";\n");
 	}
 	void setUnitOption(unsigned int uno)
 	{
 		if(uno == 0) return;
-		fprintf(mFile,"\tsetAttr \".uno\" %i;\n", uno);
+		writeInt(mFile,"\tsetAttr \".uno\" ",uno,";\n");
 	}
 	void getInput(size_t in_i)const
 	{
-		fprintf(mFile,"\"%s.in[%i]\"",mName.c_str(),in_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".in[",in_i,"]\"");
 	}
 	void getInput()const
 	{
 
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getOutput(size_t out_i)const
 	{
-		fprintf(mFile,"\"%s.out[%i]\"",mName.c_str(),out_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".out[",out_i,"]\"");
 	}
 	void getOutput()const
 	{
 
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 	void getObject()const
 	{
-		fprintf(mFile,"\"%s.ob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ob\"");
 	}
 	void getAttribute()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getExpression()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 	void getExprConnCount()const
 	{
-		fprintf(mFile,"\"%s.xcc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xcc\"");
 	}
 	void getInternalExpression()const
 	{
-		fprintf(mFile,"\"%s.ixp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ixp\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.tim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tim\"");
 	}
 	void getFrame()const
 	{
-		fprintf(mFile,"\"%s.frm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frm\"");
 	}
 	void getLastTimeEvaluated()const
 	{
-		fprintf(mFile,"\"%s.lte\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lte\"");
 	}
 	void getEvaluateNow()const
 	{
-		fprintf(mFile,"\"%s.xen\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xen\"");
 	}
 	void getAnimated()const
 	{
-		fprintf(mFile,"\"%s.ani\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ani\"");
 	}
 	void getNewFileFormat()const
 	{
-		fprintf(mFile,"\"%s.nff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nff\"");
 	}
 	void getObjectMsg()const
 	{
-		fprintf(mFile,"\"%s.obm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".obm\"");
 	}
 	void getUnitOption()const
 	{
-		fprintf(mFile,"\"%s.uno\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uno\"");
 	}
 protected:
 	Expression(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
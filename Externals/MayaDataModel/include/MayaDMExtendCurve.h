@@ -26,114 +26,114 @@ public:
 
 	void setInputPoint(const double3& ip)
 	{
-		fprintf(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
 		ip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointX(double px)
 	{
 		if(px == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".ip.px\" ",px,";\n");
 	}
 	void setPointY(double py)
 	{
 		if(py == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".ip.py\" ",py,";\n");
 	}
 	void setPointZ(double pz)
 	{
 		if(pz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".ip.pz\" ",pz,";\n");
 	}
 	void setExtensionType(unsigned int et)
 	{
 		if(et == 0) return;
-		fprintf(mFile,"\tsetAttr \".et\" %i;\n", et);
+		writeInt(mFile,"\tsetAttr \".et\" ",et,";\n");
 	}
 	void setExtendMethod(unsigned int em)
 	{
 		if(em == 0) return;
-		fprintf(mFile,"\tsetAttr \".em\" %i;\n", em);
+		writeInt(mFile,"\tsetAttr \".em\" ",em,";\n");
 	}
 	void setStart(unsigned int s)
 	{
 		if(s == 1) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setJoin(bool jn)
 	{
 		if(jn == true) return;
-		fprintf(mFile,"\tsetAttr \".jn\" %i;\n", jn);
+		writeInt(mFile,"\tsetAttr \".jn\" ",jn,";\n");
 	}
 	void setDistance(double d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setRemoveMultipleKnots(bool rmk)
 	{
 		if(rmk == false) return;
-		fprintf(mFile,"\tsetAttr \".rmk\" %i;\n", rmk);
+		writeInt(mFile,"\tsetAttr \".rmk\" ",rmk,";\n");
 	}
 	void getInputCurve1()const
 	{
-		fprintf(mFile,"\"%s.ic1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic1\"");
 	}
 	void getInputCurve2()const
 	{
-		fprintf(mFile,"\"%s.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2\"");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInputPoint()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getPointX()const
 	{
-		fprintf(mFile,"\"%s.ip.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.px\"");
 	}
 	void getPointY()const
 	{
-		fprintf(mFile,"\"%s.ip.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.py\"");
 	}
 	void getPointZ()const
 	{
-		fprintf(mFile,"\"%s.ip.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.pz\"");
 	}
 	void getExtensionType()const
 	{
-		fprintf(mFile,"\"%s.et\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".et\"");
 	}
 	void getExtendMethod()const
 	{
-		fprintf(mFile,"\"%s.em\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".em\"");
 	}
 	void getStart()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getBothEnds()const
 	{
-		fprintf(mFile,"\"%s.be\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".be\"");
 	}
 	void getJoin()const
 	{
-		fprintf(mFile,"\"%s.jn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jn\"");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getRemoveMultipleKnots()const
 	{
-		fprintf(mFile,"\"%s.rmk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmk\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	ExtendCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
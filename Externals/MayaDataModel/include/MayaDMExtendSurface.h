@@ -27,68 +27,68 @@ public:
 	void setExtensionType(unsigned int et)
 	{
 		if(et == 0) return;
-		fprintf(mFile,"\tsetAttr \".et\" %i;\n", et);
+		writeInt(mFile,"\tsetAttr \".et\" ",et,";\n");
 	}
 	void setExtendMethod(unsigned int em)
 	{
 		if(em == 0) return;
-		fprintf(mFile,"\tsetAttr \".em\" %i;\n", em);
+		writeInt(mFile,"\tsetAttr \".em\" ",em,";\n");
 	}
 	void setExtendSide(unsigned int es)
 	{
 		if(es == 1) return;
-		fprintf(mFile,"\tsetAttr \".es\" %i;\n", es);
+		writeInt(mFile,"\tsetAttr \".es\" ",es,";\n");
 	}
 	void setExtendDirection(unsigned int ed)
 	{
 		if(ed == 0) return;
-		fprintf(mFile,"\tsetAttr \".ed\" %i;\n", ed);
+		writeInt(mFile,"\tsetAttr \".ed\" ",ed,";\n");
 	}
 	void setJoin(bool jn)
 	{
 		if(jn == true) return;
-		fprintf(mFile,"\tsetAttr \".jn\" %i;\n", jn);
+		writeInt(mFile,"\tsetAttr \".jn\" ",jn,";\n");
 	}
 	void setDistance(double d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getTargetObject()const
 	{
-		fprintf(mFile,"\"%s.to\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to\"");
 	}
 	void getExtensionType()const
 	{
-		fprintf(mFile,"\"%s.et\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".et\"");
 	}
 	void getExtendMethod()const
 	{
-		fprintf(mFile,"\"%s.em\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".em\"");
 	}
 	void getExtendSide()const
 	{
-		fprintf(mFile,"\"%s.es\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".es\"");
 	}
 	void getExtendDirection()const
 	{
-		fprintf(mFile,"\"%s.ed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed\"");
 	}
 	void getJoin()const
 	{
-		fprintf(mFile,"\"%s.jn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jn\"");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	ExtendSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
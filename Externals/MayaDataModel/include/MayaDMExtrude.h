@@ -27,178 +27,178 @@ public:
 	void setExtrudeType(unsigned int et)
 	{
 		if(et == 2) return;
-		fprintf(mFile,"\tsetAttr \".et\" %i;\n", et);
+		writeInt(mFile,"\tsetAttr \".et\" ",et,";\n");
 	}
 	void setFixedPath(bool fpt)
 	{
 		if(fpt == false) return;
-		fprintf(mFile,"\tsetAttr \".fpt\" %i;\n", fpt);
+		writeInt(mFile,"\tsetAttr \".fpt\" ",fpt,";\n");
 	}
 	void setUseComponentPivot(unsigned int ucp)
 	{
 		if(ucp == 0) return;
-		fprintf(mFile,"\tsetAttr \".ucp\" %i;\n", ucp);
+		writeInt(mFile,"\tsetAttr \".ucp\" ",ucp,";\n");
 	}
 	void setUseProfileNormal(bool upn)
 	{
 		if(upn == false) return;
-		fprintf(mFile,"\tsetAttr \".upn\" %i;\n", upn);
+		writeInt(mFile,"\tsetAttr \".upn\" ",upn,";\n");
 	}
 	void setDirection(const double3& d)
 	{
-		fprintf(mFile,"\tsetAttr \".d\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"double3\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionX(double dx)
 	{
 		if(dx == 0) return;
-		fprintf(mFile,"\tsetAttr \".d.dx\" %f;\n", dx);
+		writeFloat(mFile,"\tsetAttr \".d.dx\" ",dx,";\n");
 	}
 	void setDirectionY(double dy)
 	{
 		if(dy == 1) return;
-		fprintf(mFile,"\tsetAttr \".d.dy\" %f;\n", dy);
+		writeFloat(mFile,"\tsetAttr \".d.dy\" ",dy,";\n");
 	}
 	void setDirectionZ(double dz)
 	{
 		if(dz == 0) return;
-		fprintf(mFile,"\tsetAttr \".d.dz\" %f;\n", dz);
+		writeFloat(mFile,"\tsetAttr \".d.dz\" ",dz,";\n");
 	}
 	void setLength(double l)
 	{
 		if(l == 1) return;
-		fprintf(mFile,"\tsetAttr \".l\" %f;\n", l);
+		writeFloat(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void setPivot(const double3& p)
 	{
-		fprintf(mFile,"\tsetAttr \".p\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"double3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPivotX(double px)
 	{
 		if(px == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPivotY(double py)
 	{
 		if(py == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setPivotZ(double pz)
 	{
 		if(pz == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".p.pz\" ",pz,";\n");
 	}
 	void setRotation(double ro)
 	{
 		if(ro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %f;\n", ro);
+		writeFloat(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void setScale(double sc)
 	{
 		if(sc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %f;\n", sc);
+		writeFloat(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setReverseSurfaceIfPathReversed(bool rsp)
 	{
 		if(rsp == false) return;
-		fprintf(mFile,"\tsetAttr \".rsp\" %i;\n", rsp);
+		writeInt(mFile,"\tsetAttr \".rsp\" ",rsp,";\n");
 	}
 	void setDegreeAlongLength(short dl)
 	{
 		if(dl == 1) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %i;\n", dl);
+		writeInt(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setSubCurveSubSurface(bool scs)
 	{
 		if(scs == false) return;
-		fprintf(mFile,"\tsetAttr \".scs\" %i;\n", scs);
+		writeInt(mFile,"\tsetAttr \".scs\" ",scs,";\n");
 	}
 	void getProfile()const
 	{
-		fprintf(mFile,"\"%s.pr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pr\"");
 	}
 	void getPath()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getExtrudeType()const
 	{
-		fprintf(mFile,"\"%s.et\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".et\"");
 	}
 	void getFixedPath()const
 	{
-		fprintf(mFile,"\"%s.fpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fpt\"");
 	}
 	void getUseComponentPivot()const
 	{
-		fprintf(mFile,"\"%s.ucp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ucp\"");
 	}
 	void getUseProfileNormal()const
 	{
-		fprintf(mFile,"\"%s.upn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upn\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDirectionX()const
 	{
-		fprintf(mFile,"\"%s.d.dx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dx\"");
 	}
 	void getDirectionY()const
 	{
-		fprintf(mFile,"\"%s.d.dy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dy\"");
 	}
 	void getDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.d.dz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dz\"");
 	}
 	void getLength()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getPivot()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPivotX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPivotY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPivotZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getRotation()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getReverseSurfaceIfPathReversed()const
 	{
-		fprintf(mFile,"\"%s.rsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsp\"");
 	}
 	void getDegreeAlongLength()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getSubCurveSubSurface()const
 	{
-		fprintf(mFile,"\"%s.scs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scs\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	Extrude(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,61 +27,61 @@ public:
 	void setSharedLibName(const string& sln)
 	{
 		if(sln == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".sln\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".sln\" -type \"string\" ");
 		sln.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUiName(const string& uin)
 	{
 		if(uin == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uin\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uin\" -type \"string\" ");
 		uin.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeyWords(const string& kwds)
 	{
 		if(kwds == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".kwds\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".kwds\" -type \"string\" ");
 		kwds.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUiScript(const string& uis)
 	{
 		if(uis == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uis\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uis\" -type \"string\" ");
 		uis.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUniqueID(const string& uid)
 	{
 		if(uid == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uid\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uid\" -type \"string\" ");
 		uid.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getSharedLibName()const
 	{
-		fprintf(mFile,"\"%s.sln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sln\"");
 	}
 	void getConnection()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getUiName()const
 	{
-		fprintf(mFile,"\"%s.uin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uin\"");
 	}
 	void getKeyWords()const
 	{
-		fprintf(mFile,"\"%s.kwds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kwds\"");
 	}
 	void getUiScript()const
 	{
-		fprintf(mFile,"\"%s.uis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uis\"");
 	}
 	void getUniqueID()const
 	{
-		fprintf(mFile,"\"%s.uid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uid\"");
 	}
 protected:
 	Facade(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
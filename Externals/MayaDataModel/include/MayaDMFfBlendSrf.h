@@ -27,167 +27,167 @@ public:
 	void setMultipleKnots(bool mk)
 	{
 		if(mk == true) return;
-		fprintf(mFile,"\tsetAttr \".mk\" %i;\n", mk);
+		writeInt(mFile,"\tsetAttr \".mk\" ",mk,";\n");
 	}
 	void setPositionTolerance(double pt)
 	{
 		if(pt == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".pt\" %f;\n", pt);
+		writeFloat(mFile,"\tsetAttr \".pt\" ",pt,";\n");
 	}
 	void setTangentTolerance(double tt)
 	{
 		if(tt == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".tt\" %f;\n", tt);
+		writeFloat(mFile,"\tsetAttr \".tt\" ",tt,";\n");
 	}
 	void setAutoNormal(bool an)
 	{
 		if(an == true) return;
-		fprintf(mFile,"\tsetAttr \".an\" %i;\n", an);
+		writeInt(mFile,"\tsetAttr \".an\" ",an,";\n");
 	}
 	void setFlipLeftNormal(bool fln)
 	{
 		if(fln == false) return;
-		fprintf(mFile,"\tsetAttr \".fln\" %i;\n", fln);
+		writeInt(mFile,"\tsetAttr \".fln\" ",fln,";\n");
 	}
 	void setFlipRightNormal(bool frn)
 	{
 		if(frn == false) return;
-		fprintf(mFile,"\tsetAttr \".frn\" %i;\n", frn);
+		writeInt(mFile,"\tsetAttr \".frn\" ",frn,";\n");
 	}
 	void setAutoAnchor(bool aa)
 	{
 		if(aa == true) return;
-		fprintf(mFile,"\tsetAttr \".aa\" %i;\n", aa);
+		writeInt(mFile,"\tsetAttr \".aa\" ",aa,";\n");
 	}
 	void setLeftAnchor(double la)
 	{
 		if(la == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".la\" %f;\n", la);
+		writeFloat(mFile,"\tsetAttr \".la\" ",la,";\n");
 	}
 	void setLeftStart(double ls)
 	{
 		if(ls == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ls\" %f;\n", ls);
+		writeFloat(mFile,"\tsetAttr \".ls\" ",ls,";\n");
 	}
 	void setLeftEnd(double le)
 	{
 		if(le == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".le\" %f;\n", le);
+		writeFloat(mFile,"\tsetAttr \".le\" ",le,";\n");
 	}
 	void setReverseLeft(bool rvl)
 	{
 		if(rvl == false) return;
-		fprintf(mFile,"\tsetAttr \".rvl\" %i;\n", rvl);
+		writeInt(mFile,"\tsetAttr \".rvl\" ",rvl,";\n");
 	}
 	void setRightAnchor(double ra)
 	{
 		if(ra == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setRightStart(double rs)
 	{
 		if(rs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rs\" %f;\n", rs);
+		writeFloat(mFile,"\tsetAttr \".rs\" ",rs,";\n");
 	}
 	void setRightEnd(double re)
 	{
 		if(re == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".re\" %f;\n", re);
+		writeFloat(mFile,"\tsetAttr \".re\" ",re,";\n");
 	}
 	void setReverseRight(bool rvr)
 	{
 		if(rvr == false) return;
-		fprintf(mFile,"\tsetAttr \".rvr\" %i;\n", rvr);
+		writeInt(mFile,"\tsetAttr \".rvr\" ",rvr,";\n");
 	}
 	void getLeftCurve(size_t lc_i)const
 	{
-		fprintf(mFile,"\"%s.lc[%i]\"",mName.c_str(),lc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lc[",lc_i,"]\"");
 	}
 	void getLeftCurve()const
 	{
 
-		fprintf(mFile,"\"%s.lc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc\"");
 	}
 	void getRightCurve(size_t rc_i)const
 	{
-		fprintf(mFile,"\"%s.rc[%i]\"",mName.c_str(),rc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rc[",rc_i,"]\"");
 	}
 	void getRightCurve()const
 	{
 
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getLeftRail()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getRightRail()const
 	{
-		fprintf(mFile,"\"%s.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rr\"");
 	}
 	void getMultipleKnots()const
 	{
-		fprintf(mFile,"\"%s.mk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mk\"");
 	}
 	void getPositionTolerance()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getTangentTolerance()const
 	{
-		fprintf(mFile,"\"%s.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tt\"");
 	}
 	void getAutoNormal()const
 	{
-		fprintf(mFile,"\"%s.an\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".an\"");
 	}
 	void getFlipLeftNormal()const
 	{
-		fprintf(mFile,"\"%s.fln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fln\"");
 	}
 	void getFlipRightNormal()const
 	{
-		fprintf(mFile,"\"%s.frn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frn\"");
 	}
 	void getAutoAnchor()const
 	{
-		fprintf(mFile,"\"%s.aa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aa\"");
 	}
 	void getLeftAnchor()const
 	{
-		fprintf(mFile,"\"%s.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".la\"");
 	}
 	void getLeftStart()const
 	{
-		fprintf(mFile,"\"%s.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls\"");
 	}
 	void getLeftEnd()const
 	{
-		fprintf(mFile,"\"%s.le\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".le\"");
 	}
 	void getReverseLeft()const
 	{
-		fprintf(mFile,"\"%s.rvl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rvl\"");
 	}
 	void getRightAnchor()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getRightStart()const
 	{
-		fprintf(mFile,"\"%s.rs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs\"");
 	}
 	void getRightEnd()const
 	{
-		fprintf(mFile,"\"%s.re\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re\"");
 	}
 	void getReverseRight()const
 	{
-		fprintf(mFile,"\"%s.rvr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rvr\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	FfBlendSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
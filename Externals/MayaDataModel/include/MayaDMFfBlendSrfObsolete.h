@@ -27,104 +27,104 @@ public:
 	void setPositionTolerance(double pt)
 	{
 		if(pt == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".pt\" %f;\n", pt);
+		writeFloat(mFile,"\tsetAttr \".pt\" ",pt,";\n");
 	}
 	void setTangentTolerance(double tt)
 	{
 		if(tt == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".tt\" %f;\n", tt);
+		writeFloat(mFile,"\tsetAttr \".tt\" ",tt,";\n");
 	}
 	void setFlipLeft(bool fl)
 	{
 		if(fl == false) return;
-		fprintf(mFile,"\tsetAttr \".fl\" %i;\n", fl);
+		writeInt(mFile,"\tsetAttr \".fl\" ",fl,";\n");
 	}
 	void setFlipRight(bool fr)
 	{
 		if(fr == false) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %i;\n", fr);
+		writeInt(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setAutoDirection(bool ad)
 	{
 		if(ad == true) return;
-		fprintf(mFile,"\tsetAttr \".ad\" %i;\n", ad);
+		writeInt(mFile,"\tsetAttr \".ad\" ",ad,";\n");
 	}
 	void setLeftParameter(double lp)
 	{
 		if(lp == 123456.0) return;
-		fprintf(mFile,"\tsetAttr \".lp\" %f;\n", lp);
+		writeFloat(mFile,"\tsetAttr \".lp\" ",lp,";\n");
 	}
 	void setRightParameter(double rp)
 	{
 		if(rp == 123456.0) return;
-		fprintf(mFile,"\tsetAttr \".rp\" %f;\n", rp);
+		writeFloat(mFile,"\tsetAttr \".rp\" ",rp,";\n");
 	}
 	void setMultipleKnots(bool mk)
 	{
 		if(mk == true) return;
-		fprintf(mFile,"\tsetAttr \".mk\" %i;\n", mk);
+		writeInt(mFile,"\tsetAttr \".mk\" ",mk,";\n");
 	}
 	void getLeftCurve(size_t lc_i)const
 	{
-		fprintf(mFile,"\"%s.lc[%i]\"",mName.c_str(),lc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lc[",lc_i,"]\"");
 	}
 	void getLeftCurve()const
 	{
 
-		fprintf(mFile,"\"%s.lc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc\"");
 	}
 	void getRightCurve(size_t rc_i)const
 	{
-		fprintf(mFile,"\"%s.rc[%i]\"",mName.c_str(),rc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rc[",rc_i,"]\"");
 	}
 	void getRightCurve()const
 	{
 
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getPositionTolerance()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getTangentTolerance()const
 	{
-		fprintf(mFile,"\"%s.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tt\"");
 	}
 	void getFlipLeft()const
 	{
-		fprintf(mFile,"\"%s.fl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fl\"");
 	}
 	void getFlipRight()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getAutoDirection()const
 	{
-		fprintf(mFile,"\"%s.ad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ad\"");
 	}
 	void getLeftRail()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getRightRail()const
 	{
-		fprintf(mFile,"\"%s.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rr\"");
 	}
 	void getLeftParameter()const
 	{
-		fprintf(mFile,"\"%s.lp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp\"");
 	}
 	void getRightParameter()const
 	{
-		fprintf(mFile,"\"%s.rp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getMultipleKnots()const
 	{
-		fprintf(mFile,"\"%s.mk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mk\"");
 	}
 protected:
 	FfBlendSrfObsolete(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,50 +27,50 @@ public:
 	void setPositionTolerance(double pt)
 	{
 		if(pt == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".pt\" %f;\n", pt);
+		writeFloat(mFile,"\tsetAttr \".pt\" ",pt,";\n");
 	}
 	void setTangentTolerance(double tt)
 	{
 		if(tt == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".tt\" %f;\n", tt);
+		writeFloat(mFile,"\tsetAttr \".tt\" ",tt,";\n");
 	}
 	void setDepth(double d)
 	{
 		if(d == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setBias(double b)
 	{
 		if(b == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void getLeftCurve()const
 	{
-		fprintf(mFile,"\"%s.lc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc\"");
 	}
 	void getRightCurve()const
 	{
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getPositionTolerance()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getTangentTolerance()const
 	{
-		fprintf(mFile,"\"%s.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tt\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getBias()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	FfFilletSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
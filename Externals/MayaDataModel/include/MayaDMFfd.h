@@ -23,7 +23,7 @@ public:
 		void write(FILE* file) const
 		{
 			deformedLatticePoints.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			deformedLatticeMatrix.write(file);
 		}
 	};
@@ -33,7 +33,7 @@ public:
 		void write(FILE* file) const
 		{
 			baseLatticePoints.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			baseLatticeMatrix.write(file);
 		}
 	};
@@ -44,8 +44,8 @@ public:
 		{
 			for (size_t i = 0; i<nbStuCache; ++i)
 			{
-				fprintf(file,"%f", stuCache[i]);
-				if (i + 1<nbStuCache) fprintf(file, " ");
+				writeFloat(file,"",stuCache[i]);
+				if (i + 1<nbStuCache) writeString(file," ");
 			}
 		}
 	};
@@ -58,223 +58,223 @@ public:
 
 	void setDeformedLattice(const DeformedLattice& dl)
 	{
-		fprintf(mFile,"\tsetAttr \".dl\" ");
+		writeString(mFile,"\tsetAttr \".dl\" ");
 		dl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDeformedLatticePoints(const lattice& dlp)
 	{
-		fprintf(mFile,"\tsetAttr \".dl.dlp\" -type \"lattice\" ");
+		writeString(mFile,"\tsetAttr \".dl.dlp\" -type \"lattice\" ");
 		dlp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDeformedLatticeMatrix(const matrix& dlm)
 	{
 		if(dlm == identity) return;
-		fprintf(mFile,"\tsetAttr \".dl.dlm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".dl.dlm\" -type \"matrix\" ");
 		dlm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseLattice(const BaseLattice& bl)
 	{
-		fprintf(mFile,"\tsetAttr \".bl\" ");
+		writeString(mFile,"\tsetAttr \".bl\" ");
 		bl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseLatticePoints(const lattice& blp)
 	{
-		fprintf(mFile,"\tsetAttr \".bl.blp\" -type \"lattice\" ");
+		writeString(mFile,"\tsetAttr \".bl.blp\" -type \"lattice\" ");
 		blp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseLatticeMatrix(const matrix& blm)
 	{
 		if(blm == identity) return;
-		fprintf(mFile,"\tsetAttr \".bl.blm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".bl.blm\" -type \"matrix\" ");
 		blm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStuCacheList(size_t scl_i,const StuCacheList& scl)
 	{
-		fprintf(mFile,"\tsetAttr \".scl[%i]\" ",scl_i);
+		writeInt(mFile,"\tsetAttr \".scl[",scl_i,"]\" ");
 		scl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStuCacheList(size_t scl_start,size_t scl_end,StuCacheList* scl)
 	{
-		fprintf(mFile,"\tsetAttr \".scl[%i:%i]\" ", scl_start,scl_end);
+		writeInt(mFile,"\tsetAttr \".scl[",scl_start); writeInt(mFile,":",scl_end,"]\" ");
 		size_t size = (scl_end-scl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			scl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startStuCacheList(size_t scl_start,size_t scl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".scl[%i:%i]\"",scl_start,scl_end);
-		fprintf(mFile," -type \"StuCacheList\" ");
+		writeInt(mFile,"\tsetAttr \".scl[",scl_start); writeInt(mFile,":",scl_end,"]\"");
+		writeString(mFile," -type \"StuCacheList\" ");
 	}
 	void appendStuCacheList(const StuCacheList& scl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		scl.write(mFile);
 	}
 	void endStuCacheList()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStuCache(size_t scl_i,size_t stu_i,double stu)
 	{
 		if(stu == 0) return;
-		fprintf(mFile,"\tsetAttr \".scl[%i].stu[%i]\" %f;\n", scl_i,stu_i,stu);
+		writeInt(mFile,"\tsetAttr \".scl[",scl_i); writeInt(mFile,"].stu[",stu_i); writeFloat(mFile,"]\" ",stu,";\n");
 	}
 	void setStuCache(size_t scl_i,size_t stu_start,size_t stu_end,double* stu)
 	{
-		fprintf(mFile,"\tsetAttr \".scl[%i].stu[%i:%i]\" ", scl_i,stu_start,stu_end);
+		writeInt(mFile,"\tsetAttr \".scl[",scl_i); writeInt(mFile,"].stu[",stu_start); writeInt(mFile,":",stu_end,"]\" ");
 		size_t size = (stu_end-stu_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",stu[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",stu[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startStuCache(size_t scl_i,size_t stu_start,size_t stu_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".scl[%i].stu[%i:%i]\"",scl_i,stu_start,stu_end);
+		writeInt(mFile,"\tsetAttr \".scl[",scl_i); writeInt(mFile,"].stu[",stu_start); writeInt(mFile,":",stu_end,"]\"");
 	}
 	void appendStuCache(double stu)const
 	{
-		fprintf(mFile," %f",stu);
+		writeFloat(mFile," ",stu);
 	}
 	void endStuCache()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPartialResolution(double ptr)
 	{
 		if(ptr == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".ptr\" %f;\n", ptr);
+		writeFloat(mFile,"\tsetAttr \".ptr\" ",ptr,";\n");
 	}
 	void setLocalInfluenceS(short lis)
 	{
 		if(lis == 2) return;
-		fprintf(mFile,"\tsetAttr \".lis\" %i;\n", lis);
+		writeInt(mFile,"\tsetAttr \".lis\" ",lis,";\n");
 	}
 	void setLocalInfluenceT(short lit)
 	{
 		if(lit == 2) return;
-		fprintf(mFile,"\tsetAttr \".lit\" %i;\n", lit);
+		writeInt(mFile,"\tsetAttr \".lit\" ",lit,";\n");
 	}
 	void setLocalInfluenceU(short liu)
 	{
 		if(liu == 2) return;
-		fprintf(mFile,"\tsetAttr \".liu\" %i;\n", liu);
+		writeInt(mFile,"\tsetAttr \".liu\" ",liu,";\n");
 	}
 	void setFreezeGeometry(bool fg)
 	{
 		if(fg == 0) return;
-		fprintf(mFile,"\tsetAttr \".fg\" %i;\n", fg);
+		writeInt(mFile,"\tsetAttr \".fg\" ",fg,";\n");
 	}
 	void setLocal(bool lo)
 	{
 		if(lo == 0) return;
-		fprintf(mFile,"\tsetAttr \".lo\" %i;\n", lo);
+		writeInt(mFile,"\tsetAttr \".lo\" ",lo,";\n");
 	}
 	void setUsePartialResolution(unsigned int upr)
 	{
 		if(upr == 0) return;
-		fprintf(mFile,"\tsetAttr \".upr\" %i;\n", upr);
+		writeInt(mFile,"\tsetAttr \".upr\" ",upr,";\n");
 	}
 	void setOutsideLattice(unsigned int ot)
 	{
 		if(ot == 0) return;
-		fprintf(mFile,"\tsetAttr \".ot\" %i;\n", ot);
+		writeInt(mFile,"\tsetAttr \".ot\" ",ot,";\n");
 	}
 	void setOutsideFalloffDist(double ofd)
 	{
 		if(ofd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ofd\" %f;\n", ofd);
+		writeFloat(mFile,"\tsetAttr \".ofd\" ",ofd,";\n");
 	}
 	void getDeformedLattice()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getDeformedLatticePoints()const
 	{
-		fprintf(mFile,"\"%s.dl.dlp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl.dlp\"");
 	}
 	void getDeformedLatticeMatrix()const
 	{
-		fprintf(mFile,"\"%s.dl.dlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl.dlm\"");
 	}
 	void getBaseLattice()const
 	{
-		fprintf(mFile,"\"%s.bl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bl\"");
 	}
 	void getBaseLatticePoints()const
 	{
-		fprintf(mFile,"\"%s.bl.blp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bl.blp\"");
 	}
 	void getBaseLatticeMatrix()const
 	{
-		fprintf(mFile,"\"%s.bl.blm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bl.blm\"");
 	}
 	void getStuCacheList(size_t scl_i)const
 	{
-		fprintf(mFile,"\"%s.scl[%i]\"",mName.c_str(),scl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".scl[",scl_i,"]\"");
 	}
 	void getStuCacheList()const
 	{
 
-		fprintf(mFile,"\"%s.scl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scl\"");
 	}
 	void getStuCache(size_t scl_i,size_t stu_i)const
 	{
-		fprintf(mFile,"\"%s.scl[%i].stu[%i]\"",mName.c_str(),scl_i,stu_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".scl[",scl_i); writeInt(mFile,"].stu[",stu_i,"]\"");
 	}
 	void getStuCache(size_t stu_i)const
 	{
 
-		fprintf(mFile,"\"%s.scl.stu[%i]\"",mName.c_str(),stu_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".scl.stu[",stu_i,"]\"");
 	}
 	void getPartialResolution()const
 	{
-		fprintf(mFile,"\"%s.ptr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ptr\"");
 	}
 	void getLocalInfluenceS()const
 	{
-		fprintf(mFile,"\"%s.lis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lis\"");
 	}
 	void getLocalInfluenceT()const
 	{
-		fprintf(mFile,"\"%s.lit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lit\"");
 	}
 	void getLocalInfluenceU()const
 	{
-		fprintf(mFile,"\"%s.liu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".liu\"");
 	}
 	void getFreezeGeometry()const
 	{
-		fprintf(mFile,"\"%s.fg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fg\"");
 	}
 	void getLocal()const
 	{
-		fprintf(mFile,"\"%s.lo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lo\"");
 	}
 	void getUsePartialResolution()const
 	{
-		fprintf(mFile,"\"%s.upr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upr\"");
 	}
 	void getOutsideLattice()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutsideFalloffDist()const
 	{
-		fprintf(mFile,"\"%s.ofd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofd\"");
 	}
 protected:
 	Ffd(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
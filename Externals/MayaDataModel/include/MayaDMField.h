@@ -25,12 +25,12 @@ public:
 		void write(FILE* file) const
 		{
 			inputPositions.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			inputVelocities.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			inputMass.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", deltaTime);
+			writeString(file," ");
+			writeFloat(file,"",deltaTime);
 		}
 	};
 	struct FalloffCurve{
@@ -39,9 +39,9 @@ public:
 		unsigned int falloffCurve_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", falloffCurve_Position);
-			fprintf(file,"%f ", falloffCurve_FloatValue);
-			fprintf(file,"%i", falloffCurve_Interp);
+			writeFloat(file,"",falloffCurve_Position," ");
+			writeFloat(file,"",falloffCurve_FloatValue," ");
+			writeInt(file,"",falloffCurve_Interp);
 		}
 	};
 public:
@@ -54,335 +54,335 @@ public:
 	void setMagnitude(double mag)
 	{
 		if(mag == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mag\" %f;\n", mag);
+		writeFloat(mFile,"\tsetAttr \".mag\" ",mag,";\n");
 	}
 	void setAttenuation(double att)
 	{
 		if(att == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".att\" %f;\n", att);
+		writeFloat(mFile,"\tsetAttr \".att\" ",att,";\n");
 	}
 	void setMaxDistance(double max)
 	{
 		if(max == 1) return;
-		fprintf(mFile,"\tsetAttr \".max\" %f;\n", max);
+		writeFloat(mFile,"\tsetAttr \".max\" ",max,";\n");
 	}
 	void setApplyPerVertex(bool apv)
 	{
 		if(apv == false) return;
-		fprintf(mFile,"\tsetAttr \".apv\" %i;\n", apv);
+		writeInt(mFile,"\tsetAttr \".apv\" ",apv,";\n");
 	}
 	void setUseMaxDistance(bool umd)
 	{
 		if(umd == false) return;
-		fprintf(mFile,"\tsetAttr \".umd\" %i;\n", umd);
+		writeInt(mFile,"\tsetAttr \".umd\" ",umd,";\n");
 	}
 	void setInputData(size_t ind_i,const InputData& ind)
 	{
-		fprintf(mFile,"\tsetAttr \".ind[%i]\" ",ind_i);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i,"]\" ");
 		ind.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputData(size_t ind_start,size_t ind_end,InputData* ind)
 	{
-		fprintf(mFile,"\tsetAttr \".ind[%i:%i]\" ", ind_start,ind_end);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_start); writeInt(mFile,":",ind_end,"]\" ");
 		size_t size = (ind_end-ind_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ind[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputData(size_t ind_start,size_t ind_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ind[%i:%i]\"",ind_start,ind_end);
-		fprintf(mFile," -type \"InputData\" ");
+		writeInt(mFile,"\tsetAttr \".ind[",ind_start); writeInt(mFile,":",ind_end,"]\"");
+		writeString(mFile," -type \"InputData\" ");
 	}
 	void appendInputData(const InputData& ind)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ind.write(mFile);
 	}
 	void endInputData()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputPositions(size_t ind_i,const vectorArray& inp)
 	{
 		if(inp.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ind[%i].inp\" -type \"vectorArray\" ",ind_i);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i,"].inp\" -type \"vectorArray\" ");
 		inp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputVelocities(size_t ind_i,const vectorArray& inv)
 	{
 		if(inv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ind[%i].inv\" -type \"vectorArray\" ",ind_i);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i,"].inv\" -type \"vectorArray\" ");
 		inv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputMass(size_t ind_i,const doubleArray& inm)
 	{
 		if(inm.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ind[%i].inm\" -type \"doubleArray\" ",ind_i);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i,"].inm\" -type \"doubleArray\" ");
 		inm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDeltaTime(size_t ind_i,double dt)
 	{
 		if(dt == 0) return;
-		fprintf(mFile,"\tsetAttr \".ind[%i].dt\" %f;\n", ind_i,dt);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i); writeFloat(mFile,"].dt\" ",dt,";\n");
 	}
 	void setVolumeShape(unsigned int vol)
 	{
 		if(vol == 0) return;
-		fprintf(mFile,"\tsetAttr \".vol\" %i;\n", vol);
+		writeInt(mFile,"\tsetAttr \".vol\" ",vol,";\n");
 	}
 	void setVolumeExclusion(bool vex)
 	{
 		if(vex == false) return;
-		fprintf(mFile,"\tsetAttr \".vex\" %i;\n", vex);
+		writeInt(mFile,"\tsetAttr \".vex\" ",vex,";\n");
 	}
 	void setVolumeOffset(const double3& vfo)
 	{
-		fprintf(mFile,"\tsetAttr \".vfo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".vfo\" -type \"double3\" ");
 		vfo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVolumeOffsetX(double vox)
 	{
 		if(vox == 0) return;
-		fprintf(mFile,"\tsetAttr \".vfo.vox\" %f;\n", vox);
+		writeFloat(mFile,"\tsetAttr \".vfo.vox\" ",vox,";\n");
 	}
 	void setVolumeOffsetY(double voy)
 	{
 		if(voy == 0) return;
-		fprintf(mFile,"\tsetAttr \".vfo.voy\" %f;\n", voy);
+		writeFloat(mFile,"\tsetAttr \".vfo.voy\" ",voy,";\n");
 	}
 	void setVolumeOffsetZ(double voz)
 	{
 		if(voz == 0) return;
-		fprintf(mFile,"\tsetAttr \".vfo.voz\" %f;\n", voz);
+		writeFloat(mFile,"\tsetAttr \".vfo.voz\" ",voz,";\n");
 	}
 	void setSectionRadius(double tsr)
 	{
 		if(tsr == 0) return;
-		fprintf(mFile,"\tsetAttr \".tsr\" %f;\n", tsr);
+		writeFloat(mFile,"\tsetAttr \".tsr\" ",tsr,";\n");
 	}
 	void setVolumeSweep(double vsw)
 	{
 		if(vsw == 3) return;
-		fprintf(mFile,"\tsetAttr \".vsw\" %f;\n", vsw);
+		writeFloat(mFile,"\tsetAttr \".vsw\" ",vsw,";\n");
 	}
 	void setFalloffCurve(size_t fc_i,const FalloffCurve& fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i]\" ",fc_i);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i,"]\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFalloffCurve(size_t fc_start,size_t fc_end,FalloffCurve* fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i:%i]\" ", fc_start,fc_end);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_start); writeInt(mFile,":",fc_end,"]\" ");
 		size_t size = (fc_end-fc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			fc[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFalloffCurve(size_t fc_start,size_t fc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i:%i]\"",fc_start,fc_end);
-		fprintf(mFile," -type \"FalloffCurve\" ");
+		writeInt(mFile,"\tsetAttr \".fc[",fc_start); writeInt(mFile,":",fc_end,"]\"");
+		writeString(mFile," -type \"FalloffCurve\" ");
 	}
 	void appendFalloffCurve(const FalloffCurve& fc)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		fc.write(mFile);
 	}
 	void endFalloffCurve()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFalloffCurve_Position(size_t fc_i,float fcp)
 	{
 		if(fcp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc[%i].fcp\" %f;\n", fc_i,fcp);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i); writeFloat(mFile,"].fcp\" ",fcp,";\n");
 	}
 	void setFalloffCurve_FloatValue(size_t fc_i,float fcfv)
 	{
 		if(fcfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc[%i].fcfv\" %f;\n", fc_i,fcfv);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i); writeFloat(mFile,"].fcfv\" ",fcfv,";\n");
 	}
 	void setFalloffCurve_Interp(size_t fc_i,unsigned int fci)
 	{
 		if(fci == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc[%i].fci\" %i;\n", fc_i,fci);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i); writeInt(mFile,"].fci\" ",fci,";\n");
 	}
 	void getMagnitude()const
 	{
-		fprintf(mFile,"\"%s.mag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mag\"");
 	}
 	void getAttenuation()const
 	{
-		fprintf(mFile,"\"%s.att\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".att\"");
 	}
 	void getMaxDistance()const
 	{
-		fprintf(mFile,"\"%s.max\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".max\"");
 	}
 	void getApplyPerVertex()const
 	{
-		fprintf(mFile,"\"%s.apv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apv\"");
 	}
 	void getUseMaxDistance()const
 	{
-		fprintf(mFile,"\"%s.umd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".umd\"");
 	}
 	void getInputData(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i]\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"]\"");
 	}
 	void getInputData()const
 	{
 
-		fprintf(mFile,"\"%s.ind\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind\"");
 	}
 	void getInputPositions(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i].inp\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"].inp\"");
 	}
 	void getInputPositions()const
 	{
 
-		fprintf(mFile,"\"%s.ind.inp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind.inp\"");
 	}
 	void getInputVelocities(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i].inv\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"].inv\"");
 	}
 	void getInputVelocities()const
 	{
 
-		fprintf(mFile,"\"%s.ind.inv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind.inv\"");
 	}
 	void getInputMass(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i].inm\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"].inm\"");
 	}
 	void getInputMass()const
 	{
 
-		fprintf(mFile,"\"%s.ind.inm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind.inm\"");
 	}
 	void getDeltaTime(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i].dt\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"].dt\"");
 	}
 	void getDeltaTime()const
 	{
 
-		fprintf(mFile,"\"%s.ind.dt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind.dt\"");
 	}
 	void getInputForce(size_t inf_i)const
 	{
-		fprintf(mFile,"\"%s.inf[%i]\"",mName.c_str(),inf_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".inf[",inf_i,"]\"");
 	}
 	void getInputForce()const
 	{
 
-		fprintf(mFile,"\"%s.inf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inf\"");
 	}
 	void getOutputForce(size_t of_i)const
 	{
-		fprintf(mFile,"\"%s.of[%i]\"",mName.c_str(),of_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".of[",of_i,"]\"");
 	}
 	void getOutputForce()const
 	{
 
-		fprintf(mFile,"\"%s.of\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of\"");
 	}
 	void getVolumeShape()const
 	{
-		fprintf(mFile,"\"%s.vol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vol\"");
 	}
 	void getVolumeExclusion()const
 	{
-		fprintf(mFile,"\"%s.vex\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vex\"");
 	}
 	void getVolumeOffset()const
 	{
-		fprintf(mFile,"\"%s.vfo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vfo\"");
 	}
 	void getVolumeOffsetX()const
 	{
-		fprintf(mFile,"\"%s.vfo.vox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vfo.vox\"");
 	}
 	void getVolumeOffsetY()const
 	{
-		fprintf(mFile,"\"%s.vfo.voy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vfo.voy\"");
 	}
 	void getVolumeOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.vfo.voz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vfo.voz\"");
 	}
 	void getSectionRadius()const
 	{
-		fprintf(mFile,"\"%s.tsr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tsr\"");
 	}
 	void getVolumeSweep()const
 	{
-		fprintf(mFile,"\"%s.vsw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vsw\"");
 	}
 	void getInputPPData(size_t ppda_i)const
 	{
-		fprintf(mFile,"\"%s.ppda[%i]\"",mName.c_str(),ppda_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ppda[",ppda_i,"]\"");
 	}
 	void getInputPPData()const
 	{
 
-		fprintf(mFile,"\"%s.ppda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppda\"");
 	}
 	void getOwnerPPData()const
 	{
-		fprintf(mFile,"\"%s.oppd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oppd\"");
 	}
 	void getFalloffCurve(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i]\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"]\"");
 	}
 	void getFalloffCurve()const
 	{
 
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFalloffCurve_Position(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i].fcp\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"].fcp\"");
 	}
 	void getFalloffCurve_Position()const
 	{
 
-		fprintf(mFile,"\"%s.fc.fcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcp\"");
 	}
 	void getFalloffCurve_FloatValue(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i].fcfv\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"].fcfv\"");
 	}
 	void getFalloffCurve_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.fc.fcfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcfv\"");
 	}
 	void getFalloffCurve_Interp(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i].fci\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"].fci\"");
 	}
 	void getFalloffCurve_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.fc.fci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fci\"");
 	}
 protected:
 	Field(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
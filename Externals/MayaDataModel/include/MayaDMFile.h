@@ -27,310 +27,310 @@ public:
 	void setFileTextureName(const string& ftn)
 	{
 		if(ftn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ftn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ftn\" -type \"string\" ");
 		ftn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisableFileLoad(bool dfl)
 	{
 		if(dfl == false) return;
-		fprintf(mFile,"\tsetAttr \".dfl\" %i;\n", dfl);
+		writeInt(mFile,"\tsetAttr \".dfl\" ",dfl,";\n");
 	}
 	void setUseFrameExtension(bool ufe)
 	{
 		if(ufe == false) return;
-		fprintf(mFile,"\tsetAttr \".ufe\" %i;\n", ufe);
+		writeInt(mFile,"\tsetAttr \".ufe\" ",ufe,";\n");
 	}
 	void setFrameExtension(int fe)
 	{
 		if(fe == 1) return;
-		fprintf(mFile,"\tsetAttr \".fe\" %i;\n", fe);
+		writeInt(mFile,"\tsetAttr \".fe\" ",fe,";\n");
 	}
 	void setFrameOffset(int io)
 	{
 		if(io == 0) return;
-		fprintf(mFile,"\tsetAttr \".io\" %i;\n", io);
+		writeInt(mFile,"\tsetAttr \".io\" ",io,";\n");
 	}
 	void setUseHardwareTextureCycling(bool uhc)
 	{
 		if(uhc == false) return;
-		fprintf(mFile,"\tsetAttr \".uhc\" %i;\n", uhc);
+		writeInt(mFile,"\tsetAttr \".uhc\" ",uhc,";\n");
 	}
 	void setStartCycleExtension(int sce)
 	{
 		if(sce == 1) return;
-		fprintf(mFile,"\tsetAttr \".sce\" %i;\n", sce);
+		writeInt(mFile,"\tsetAttr \".sce\" ",sce,";\n");
 	}
 	void setEndCycleExtension(int ece)
 	{
 		if(ece == 1) return;
-		fprintf(mFile,"\tsetAttr \".ece\" %i;\n", ece);
+		writeInt(mFile,"\tsetAttr \".ece\" ",ece,";\n");
 	}
 	void setByCycleIncrement(int bci)
 	{
 		if(bci == 1) return;
-		fprintf(mFile,"\tsetAttr \".bci\" %i;\n", bci);
+		writeInt(mFile,"\tsetAttr \".bci\" ",bci,";\n");
 	}
 	void setFilterType(unsigned int ft)
 	{
 		if(ft == 3) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %i;\n", ft);
+		writeInt(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setFilterWidth(float fw)
 	{
 		if(fw == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".fw\" %f;\n", fw);
+		writeFloat(mFile,"\tsetAttr \".fw\" ",fw,";\n");
 	}
 	void setUseCache(bool uca)
 	{
 		if(uca == false) return;
-		fprintf(mFile,"\tsetAttr \".uca\" %i;\n", uca);
+		writeInt(mFile,"\tsetAttr \".uca\" ",uca,";\n");
 	}
 	void setUseMaximumRes(bool umr)
 	{
 		if(umr == false) return;
-		fprintf(mFile,"\tsetAttr \".umr\" %i;\n", umr);
+		writeInt(mFile,"\tsetAttr \".umr\" ",umr,";\n");
 	}
 	void setCoverage(const float2& c)
 	{
 		if(c == float2(1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float2\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCoverageU(float cu)
 	{
 		if(cu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cu\" %f;\n", cu);
+		writeFloat(mFile,"\tsetAttr \".c.cu\" ",cu,";\n");
 	}
 	void setCoverageV(float cv)
 	{
 		if(cv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cv\" %f;\n", cv);
+		writeFloat(mFile,"\tsetAttr \".c.cv\" ",cv,";\n");
 	}
 	void setTranslateFrame(const float2& tf)
 	{
 		if(tf == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".tf\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".tf\" -type \"float2\" ");
 		tf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslateFrameU(float tfu)
 	{
 		if(tfu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfu\" %f;\n", tfu);
+		writeFloat(mFile,"\tsetAttr \".tf.tfu\" ",tfu,";\n");
 	}
 	void setTranslateFrameV(float tfv)
 	{
 		if(tfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfv\" %f;\n", tfv);
+		writeFloat(mFile,"\tsetAttr \".tf.tfv\" ",tfv,";\n");
 	}
 	void setRotateFrame(double rf)
 	{
 		if(rf == 0) return;
-		fprintf(mFile,"\tsetAttr \".rf\" %f;\n", rf);
+		writeFloat(mFile,"\tsetAttr \".rf\" ",rf,";\n");
 	}
 	void setDoTransform(bool dtf)
 	{
 		if(dtf == true) return;
-		fprintf(mFile,"\tsetAttr \".dtf\" %i;\n", dtf);
+		writeInt(mFile,"\tsetAttr \".dtf\" ",dtf,";\n");
 	}
 	void setMirrorU(bool mu)
 	{
 		if(mu == false) return;
-		fprintf(mFile,"\tsetAttr \".mu\" %i;\n", mu);
+		writeInt(mFile,"\tsetAttr \".mu\" ",mu,";\n");
 	}
 	void setMirrorV(bool mv)
 	{
 		if(mv == false) return;
-		fprintf(mFile,"\tsetAttr \".mv\" %i;\n", mv);
+		writeInt(mFile,"\tsetAttr \".mv\" ",mv,";\n");
 	}
 	void setStagger(bool s)
 	{
 		if(s == false) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setWrapU(bool wu)
 	{
 		if(wu == true) return;
-		fprintf(mFile,"\tsetAttr \".wu\" %i;\n", wu);
+		writeInt(mFile,"\tsetAttr \".wu\" ",wu,";\n");
 	}
 	void setWrapV(bool wv)
 	{
 		if(wv == true) return;
-		fprintf(mFile,"\tsetAttr \".wv\" %i;\n", wv);
+		writeInt(mFile,"\tsetAttr \".wv\" ",wv,";\n");
 	}
 	void setRepeatUV(const float2& re)
 	{
 		if(re == float2(1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".re\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".re\" -type \"float2\" ");
 		re.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRepeatU(float reu)
 	{
 		if(reu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".re.reu\" %f;\n", reu);
+		writeFloat(mFile,"\tsetAttr \".re.reu\" ",reu,";\n");
 	}
 	void setRepeatV(float rev)
 	{
 		if(rev == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".re.rev\" %f;\n", rev);
+		writeFloat(mFile,"\tsetAttr \".re.rev\" ",rev,";\n");
 	}
 	void setOffset(const float2& of)
 	{
 		if(of == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".of\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".of\" -type \"float2\" ");
 		of.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetU(float ofu)
 	{
 		if(ofu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".of.ofu\" %f;\n", ofu);
+		writeFloat(mFile,"\tsetAttr \".of.ofu\" ",ofu,";\n");
 	}
 	void setOffsetV(float ofv)
 	{
 		if(ofv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".of.ofv\" %f;\n", ofv);
+		writeFloat(mFile,"\tsetAttr \".of.ofv\" ",ofv,";\n");
 	}
 	void setRotateUV(double ro)
 	{
 		if(ro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %f;\n", ro);
+		writeFloat(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void setNoiseUV(const float2& n)
 	{
 		if(n == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".n\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".n\" -type \"float2\" ");
 		n.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNoiseU(float nu)
 	{
 		if(nu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.nu\" %f;\n", nu);
+		writeFloat(mFile,"\tsetAttr \".n.nu\" ",nu,";\n");
 	}
 	void setNoiseV(float nv)
 	{
 		if(nv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.nv\" %f;\n", nv);
+		writeFloat(mFile,"\tsetAttr \".n.nv\" ",nv,";\n");
 	}
 	void setBlurPixelation(bool blp)
 	{
 		if(blp == true) return;
-		fprintf(mFile,"\tsetAttr \".blp\" %i;\n", blp);
+		writeInt(mFile,"\tsetAttr \".blp\" ",blp,";\n");
 	}
 	void setVertexCameraOne(const float3& vc1)
 	{
-		fprintf(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
 		vc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraOneX(float c1x)
 	{
 		if(c1x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1x\" %f;\n", c1x);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1x\" ",c1x,";\n");
 	}
 	void setVertexCameraOneY(float c1y)
 	{
 		if(c1y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1y\" %f;\n", c1y);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1y\" ",c1y,";\n");
 	}
 	void setVertexCameraOneZ(float c1z)
 	{
 		if(c1z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1z\" %f;\n", c1z);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1z\" ",c1z,";\n");
 	}
 	void setVertexCameraTwo(const float3& vc2)
 	{
-		fprintf(mFile,"\tsetAttr \".vc2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc2\" -type \"float3\" ");
 		vc2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraTwoX(float c2x)
 	{
 		if(c2x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2x\" %f;\n", c2x);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2x\" ",c2x,";\n");
 	}
 	void setVertexCameraTwoY(float c2y)
 	{
 		if(c2y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2y\" %f;\n", c2y);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2y\" ",c2y,";\n");
 	}
 	void setVertexCameraTwoZ(float c2z)
 	{
 		if(c2z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2z\" %f;\n", c2z);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2z\" ",c2z,";\n");
 	}
 	void setVertexCameraThree(const float3& vc3)
 	{
-		fprintf(mFile,"\tsetAttr \".vc3\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc3\" -type \"float3\" ");
 		vc3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraThreeX(float c3x)
 	{
 		if(c3x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc3.c3x\" %f;\n", c3x);
+		writeFloat(mFile,"\tsetAttr \".vc3.c3x\" ",c3x,";\n");
 	}
 	void setVertexCameraThreeY(float c3y)
 	{
 		if(c3y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc3.c3y\" %f;\n", c3y);
+		writeFloat(mFile,"\tsetAttr \".vc3.c3y\" ",c3y,";\n");
 	}
 	void setVertexCameraThreeZ(float c3z)
 	{
 		if(c3z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc3.c3z\" %f;\n", c3z);
+		writeFloat(mFile,"\tsetAttr \".vc3.c3z\" ",c3z,";\n");
 	}
 	void setVertexUvOne(const float2& vt1)
 	{
-		fprintf(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
 		vt1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvOneU(float t1u)
 	{
 		if(t1u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1u\" %f;\n", t1u);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1u\" ",t1u,";\n");
 	}
 	void setVertexUvOneV(float t1v)
 	{
 		if(t1v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1v\" %f;\n", t1v);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1v\" ",t1v,";\n");
 	}
 	void setVertexUvTwo(const float2& vt2)
 	{
-		fprintf(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
 		vt2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvTwoU(float t2u)
 	{
 		if(t2u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2u\" %f;\n", t2u);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2u\" ",t2u,";\n");
 	}
 	void setVertexUvTwoV(float t2v)
 	{
 		if(t2v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2v\" %f;\n", t2v);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2v\" ",t2v,";\n");
 	}
 	void setVertexUvThree(const float2& vt3)
 	{
-		fprintf(mFile,"\tsetAttr \".vt3\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt3\" -type \"float2\" ");
 		vt3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvThreeU(float t3u)
 	{
 		if(t3u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt3.t3u\" %f;\n", t3u);
+		writeFloat(mFile,"\tsetAttr \".vt3.t3u\" ",t3u,";\n");
 	}
 	void setVertexUvThreeV(float t3v)
 	{
 		if(t3v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt3.t3v\" %f;\n", t3v);
+		writeFloat(mFile,"\tsetAttr \".vt3.t3v\" ",t3v,";\n");
 	}
 	void setObjectType(char otp)
 	{
@@ -340,331 +340,331 @@ public:
 	void setRayDepth(int rdp)
 	{
 		if(rdp == 0) return;
-		fprintf(mFile,"\tsetAttr \".rdp\" %i;\n", rdp);
+		writeInt(mFile,"\tsetAttr \".rdp\" ",rdp,";\n");
 	}
 	void setPixelCenter(const float2& pct)
 	{
-		fprintf(mFile,"\tsetAttr \".pct\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".pct\" -type \"float2\" ");
 		pct.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPixelCenterX(float pcx)
 	{
 		if(pcx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pct.pcx\" %f;\n", pcx);
+		writeFloat(mFile,"\tsetAttr \".pct.pcx\" ",pcx,";\n");
 	}
 	void setPixelCenterY(float pcy)
 	{
 		if(pcy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pct.pcy\" %f;\n", pcy);
+		writeFloat(mFile,"\tsetAttr \".pct.pcy\" ",pcy,";\n");
 	}
 	void setHdrMapping(unsigned int hm)
 	{
 		if(hm == 1) return;
-		fprintf(mFile,"\tsetAttr \".hm\" %i;\n", hm);
+		writeInt(mFile,"\tsetAttr \".hm\" ",hm,";\n");
 	}
 	void setHdrExposure(float he)
 	{
 		if(he == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".he\" %f;\n", he);
+		writeFloat(mFile,"\tsetAttr \".he\" ",he,";\n");
 	}
 	void setPreFilter(bool pf)
 	{
 		if(pf == false) return;
-		fprintf(mFile,"\tsetAttr \".pf\" %i;\n", pf);
+		writeInt(mFile,"\tsetAttr \".pf\" ",pf,";\n");
 	}
 	void setPreFilterRadius(float pfr)
 	{
 		if(pfr == 2.0f) return;
-		fprintf(mFile,"\tsetAttr \".pfr\" %f;\n", pfr);
+		writeFloat(mFile,"\tsetAttr \".pfr\" ",pfr,";\n");
 	}
 	void getFileTextureName()const
 	{
-		fprintf(mFile,"\"%s.ftn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ftn\"");
 	}
 	void getDisableFileLoad()const
 	{
-		fprintf(mFile,"\"%s.dfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfl\"");
 	}
 	void getUseFrameExtension()const
 	{
-		fprintf(mFile,"\"%s.ufe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufe\"");
 	}
 	void getFrameExtension()const
 	{
-		fprintf(mFile,"\"%s.fe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fe\"");
 	}
 	void getFrameOffset()const
 	{
-		fprintf(mFile,"\"%s.io\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".io\"");
 	}
 	void getUseHardwareTextureCycling()const
 	{
-		fprintf(mFile,"\"%s.uhc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uhc\"");
 	}
 	void getStartCycleExtension()const
 	{
-		fprintf(mFile,"\"%s.sce\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sce\"");
 	}
 	void getEndCycleExtension()const
 	{
-		fprintf(mFile,"\"%s.ece\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ece\"");
 	}
 	void getByCycleIncrement()const
 	{
-		fprintf(mFile,"\"%s.bci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bci\"");
 	}
 	void getForceSwatchGen()const
 	{
-		fprintf(mFile,"\"%s.fsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsg\"");
 	}
 	void getCoverage()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getCoverageU()const
 	{
-		fprintf(mFile,"\"%s.c.cu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cu\"");
 	}
 	void getCoverageV()const
 	{
-		fprintf(mFile,"\"%s.c.cv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cv\"");
 	}
 	void getTranslateFrame()const
 	{
-		fprintf(mFile,"\"%s.tf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf\"");
 	}
 	void getTranslateFrameU()const
 	{
-		fprintf(mFile,"\"%s.tf.tfu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfu\"");
 	}
 	void getTranslateFrameV()const
 	{
-		fprintf(mFile,"\"%s.tf.tfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfv\"");
 	}
 	void getRotateFrame()const
 	{
-		fprintf(mFile,"\"%s.rf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rf\"");
 	}
 	void getDoTransform()const
 	{
-		fprintf(mFile,"\"%s.dtf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtf\"");
 	}
 	void getMirrorU()const
 	{
-		fprintf(mFile,"\"%s.mu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mu\"");
 	}
 	void getMirrorV()const
 	{
-		fprintf(mFile,"\"%s.mv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mv\"");
 	}
 	void getStagger()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getWrapU()const
 	{
-		fprintf(mFile,"\"%s.wu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu\"");
 	}
 	void getWrapV()const
 	{
-		fprintf(mFile,"\"%s.wv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wv\"");
 	}
 	void getRepeatUV()const
 	{
-		fprintf(mFile,"\"%s.re\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re\"");
 	}
 	void getRepeatU()const
 	{
-		fprintf(mFile,"\"%s.re.reu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.reu\"");
 	}
 	void getRepeatV()const
 	{
-		fprintf(mFile,"\"%s.re.rev\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rev\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.of\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of\"");
 	}
 	void getOffsetU()const
 	{
-		fprintf(mFile,"\"%s.of.ofu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of.ofu\"");
 	}
 	void getOffsetV()const
 	{
-		fprintf(mFile,"\"%s.of.ofv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of.ofv\"");
 	}
 	void getRotateUV()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getNoiseUV()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNoiseU()const
 	{
-		fprintf(mFile,"\"%s.n.nu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nu\"");
 	}
 	void getNoiseV()const
 	{
-		fprintf(mFile,"\"%s.n.nv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nv\"");
 	}
 	void getBlurPixelation()const
 	{
-		fprintf(mFile,"\"%s.blp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".blp\"");
 	}
 	void getVertexCameraOne()const
 	{
-		fprintf(mFile,"\"%s.vc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1\"");
 	}
 	void getVertexCameraOneX()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1x\"");
 	}
 	void getVertexCameraOneY()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1y\"");
 	}
 	void getVertexCameraOneZ()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1z\"");
 	}
 	void getVertexCameraTwo()const
 	{
-		fprintf(mFile,"\"%s.vc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2\"");
 	}
 	void getVertexCameraTwoX()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2x\"");
 	}
 	void getVertexCameraTwoY()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2y\"");
 	}
 	void getVertexCameraTwoZ()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2z\"");
 	}
 	void getVertexCameraThree()const
 	{
-		fprintf(mFile,"\"%s.vc3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc3\"");
 	}
 	void getVertexCameraThreeX()const
 	{
-		fprintf(mFile,"\"%s.vc3.c3x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc3.c3x\"");
 	}
 	void getVertexCameraThreeY()const
 	{
-		fprintf(mFile,"\"%s.vc3.c3y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc3.c3y\"");
 	}
 	void getVertexCameraThreeZ()const
 	{
-		fprintf(mFile,"\"%s.vc3.c3z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc3.c3z\"");
 	}
 	void getVertexUvOne()const
 	{
-		fprintf(mFile,"\"%s.vt1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1\"");
 	}
 	void getVertexUvOneU()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1u\"");
 	}
 	void getVertexUvOneV()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1v\"");
 	}
 	void getVertexUvTwo()const
 	{
-		fprintf(mFile,"\"%s.vt2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2\"");
 	}
 	void getVertexUvTwoU()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2u\"");
 	}
 	void getVertexUvTwoV()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2v\"");
 	}
 	void getVertexUvThree()const
 	{
-		fprintf(mFile,"\"%s.vt3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3\"");
 	}
 	void getVertexUvThreeU()const
 	{
-		fprintf(mFile,"\"%s.vt3.t3u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3.t3u\"");
 	}
 	void getVertexUvThreeV()const
 	{
-		fprintf(mFile,"\"%s.vt3.t3v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3.t3v\"");
 	}
 	void getObjectType()const
 	{
-		fprintf(mFile,"\"%s.otp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otp\"");
 	}
 	void getRayDepth()const
 	{
-		fprintf(mFile,"\"%s.rdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdp\"");
 	}
 	void getPrimitiveId()const
 	{
-		fprintf(mFile,"\"%s.pi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi\"");
 	}
 	void getPixelCenter()const
 	{
-		fprintf(mFile,"\"%s.pct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pct\"");
 	}
 	void getPixelCenterX()const
 	{
-		fprintf(mFile,"\"%s.pct.pcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pct.pcx\"");
 	}
 	void getPixelCenterY()const
 	{
-		fprintf(mFile,"\"%s.pct.pcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pct.pcy\"");
 	}
 	void getOutSize()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getOutSizeX()const
 	{
-		fprintf(mFile,"\"%s.os.osx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os.osx\"");
 	}
 	void getOutSizeY()const
 	{
-		fprintf(mFile,"\"%s.os.osy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os.osy\"");
 	}
 	void getFileHasAlpha()const
 	{
-		fprintf(mFile,"\"%s.fha\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fha\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getPreFilter()const
 	{
-		fprintf(mFile,"\"%s.pf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pf\"");
 	}
 	void getPreFilterRadius()const
 	{
-		fprintf(mFile,"\"%s.pfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfr\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 protected:
 	File(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
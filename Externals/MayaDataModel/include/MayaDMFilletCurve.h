@@ -27,112 +27,112 @@ public:
 	void setRadius(double r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setDepth(double d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setBias(double b)
 	{
 		if(b == 0) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setCurveParameter1(double cp1)
 	{
 		if(cp1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cp1\" %f;\n", cp1);
+		writeFloat(mFile,"\tsetAttr \".cp1\" ",cp1,";\n");
 	}
 	void setCurveParameter2(double cp2)
 	{
 		if(cp2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cp2\" %f;\n", cp2);
+		writeFloat(mFile,"\tsetAttr \".cp2\" ",cp2,";\n");
 	}
 	void setTrim(bool t)
 	{
 		if(t == false) return;
-		fprintf(mFile,"\tsetAttr \".t\" %i;\n", t);
+		writeInt(mFile,"\tsetAttr \".t\" ",t,";\n");
 	}
 	void setJoin(bool jn)
 	{
 		if(jn == false) return;
-		fprintf(mFile,"\tsetAttr \".jn\" %i;\n", jn);
+		writeInt(mFile,"\tsetAttr \".jn\" ",jn,";\n");
 	}
 	void setCircular(bool cir)
 	{
 		if(cir == true) return;
-		fprintf(mFile,"\tsetAttr \".cir\" %i;\n", cir);
+		writeInt(mFile,"\tsetAttr \".cir\" ",cir,";\n");
 	}
 	void setFreeformBlend(bool fb)
 	{
 		if(fb == false) return;
-		fprintf(mFile,"\tsetAttr \".fb\" %i;\n", fb);
+		writeInt(mFile,"\tsetAttr \".fb\" ",fb,";\n");
 	}
 	void setBlendControl(bool bc)
 	{
 		if(bc == false) return;
-		fprintf(mFile,"\tsetAttr \".bc\" %i;\n", bc);
+		writeInt(mFile,"\tsetAttr \".bc\" ",bc,";\n");
 	}
 	void getPrimaryCurve()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getSecondaryCurve()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getDetachedCurve1()const
 	{
-		fprintf(mFile,"\"%s.dc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc1\"");
 	}
 	void getDetachedCurve2()const
 	{
-		fprintf(mFile,"\"%s.dc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc2\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getBias()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getCurveParameter1()const
 	{
-		fprintf(mFile,"\"%s.cp1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp1\"");
 	}
 	void getCurveParameter2()const
 	{
-		fprintf(mFile,"\"%s.cp2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp2\"");
 	}
 	void getTrim()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getJoin()const
 	{
-		fprintf(mFile,"\"%s.jn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jn\"");
 	}
 	void getCircular()const
 	{
-		fprintf(mFile,"\"%s.cir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cir\"");
 	}
 	void getFreeformBlend()const
 	{
-		fprintf(mFile,"\"%s.fb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fb\"");
 	}
 	void getBlendControl()const
 	{
-		fprintf(mFile,"\"%s.bc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bc\"");
 	}
 protected:
 	FilletCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
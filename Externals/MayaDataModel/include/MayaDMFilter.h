@@ -37,11 +37,11 @@ public:
 	void setDeviceEditorActive(bool dea)
 	{
 		if(dea == false) return;
-		fprintf(mFile,"\tsetAttr \".dea\" %i;\n", dea);
+		writeInt(mFile,"\tsetAttr \".dea\" ",dea,";\n");
 	}
 	void getDeviceEditorActive()const
 	{
-		fprintf(mFile,"\"%s.dea\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dea\"");
 	}
 protected:
 	Filter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
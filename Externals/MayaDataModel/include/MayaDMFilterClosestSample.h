@@ -27,11 +27,11 @@ public:
 	void setFrequency(double f)
 	{
 		if(f == 30.) return;
-		fprintf(mFile,"\tsetAttr \".f\" %f;\n", f);
+		writeFloat(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void getFrequency()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 protected:
 	FilterClosestSample(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,114 +27,114 @@ public:
 	void setSmooth(unsigned int s)
 	{
 		if(s == 3) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setNearestTo(unsigned int nt)
 	{
 		if(nt == 2) return;
-		fprintf(mFile,"\tsetAttr \".nt\" %i;\n", nt);
+		writeInt(mFile,"\tsetAttr \".nt\" ",nt,";\n");
 	}
 	void setWeight(const double3& w)
 	{
 		if(w == double3(1.0, 1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".w\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".w\" -type \"double3\" ");
 		w.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeightX(double wx)
 	{
 		if(wx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".w.wx\" %f;\n", wx);
+		writeFloat(mFile,"\tsetAttr \".w.wx\" ",wx,";\n");
 	}
 	void setWeightY(double wy)
 	{
 		if(wy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".w.wy\" %f;\n", wy);
+		writeFloat(mFile,"\tsetAttr \".w.wy\" ",wy,";\n");
 	}
 	void setWeightZ(double wz)
 	{
 		if(wz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".w.wz\" %f;\n", wz);
+		writeFloat(mFile,"\tsetAttr \".w.wz\" ",wz,";\n");
 	}
 	void setEnableInitialRotation(bool eir)
 	{
 		if(eir == false) return;
-		fprintf(mFile,"\tsetAttr \".eir\" %i;\n", eir);
+		writeInt(mFile,"\tsetAttr \".eir\" ",eir,";\n");
 	}
 	void setInitialRotation(const double3& ir)
 	{
 		if(ir == double3(0., 0., 0.)) return;
-		fprintf(mFile,"\tsetAttr \".ir\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ir\" -type \"double3\" ");
 		ir.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialRotationX(double irx)
 	{
 		if(irx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir.irx\" %f;\n", irx);
+		writeFloat(mFile,"\tsetAttr \".ir.irx\" ",irx,";\n");
 	}
 	void setInitialRotationY(double iry)
 	{
 		if(iry == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir.iry\" %f;\n", iry);
+		writeFloat(mFile,"\tsetAttr \".ir.iry\" ",iry,";\n");
 	}
 	void setInitialRotationZ(double irz)
 	{
 		if(irz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir.irz\" %f;\n", irz);
+		writeFloat(mFile,"\tsetAttr \".ir.irz\" ",irz,";\n");
 	}
 	void setOutputUsageOpt(unsigned int use)
 	{
 		if(use == 0) return;
-		fprintf(mFile,"\tsetAttr \".use\" %i;\n", use);
+		writeInt(mFile,"\tsetAttr \".use\" ",use,";\n");
 	}
 	void getSmooth()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getNearestTo()const
 	{
-		fprintf(mFile,"\"%s.nt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nt\"");
 	}
 	void getWeight()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getWeightX()const
 	{
-		fprintf(mFile,"\"%s.w.wx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w.wx\"");
 	}
 	void getWeightY()const
 	{
-		fprintf(mFile,"\"%s.w.wy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w.wy\"");
 	}
 	void getWeightZ()const
 	{
-		fprintf(mFile,"\"%s.w.wz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w.wz\"");
 	}
 	void getEnableInitialRotation()const
 	{
-		fprintf(mFile,"\"%s.eir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eir\"");
 	}
 	void getInitialRotation()const
 	{
-		fprintf(mFile,"\"%s.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir\"");
 	}
 	void getInitialRotationX()const
 	{
-		fprintf(mFile,"\"%s.ir.irx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir.irx\"");
 	}
 	void getInitialRotationY()const
 	{
-		fprintf(mFile,"\"%s.ir.iry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir.iry\"");
 	}
 	void getInitialRotationZ()const
 	{
-		fprintf(mFile,"\"%s.ir.irz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir.irz\"");
 	}
 	void getOutputUsageOpt()const
 	{
-		fprintf(mFile,"\"%s.use\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".use\"");
 	}
 protected:
 	FilterEuler(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
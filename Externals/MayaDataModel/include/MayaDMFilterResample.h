@@ -27,20 +27,20 @@ public:
 	void setTimeStep(double ts)
 	{
 		if(ts == 0) return;
-		fprintf(mFile,"\tsetAttr \".ts\" %f;\n", ts);
+		writeFloat(mFile,"\tsetAttr \".ts\" ",ts,";\n");
 	}
 	void setKernel(unsigned int kr)
 	{
 		if(kr == 600) return;
-		fprintf(mFile,"\tsetAttr \".kr\" %i;\n", kr);
+		writeInt(mFile,"\tsetAttr \".kr\" ",kr,";\n");
 	}
 	void getTimeStep()const
 	{
-		fprintf(mFile,"\"%s.ts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ts\"");
 	}
 	void getKernel()const
 	{
-		fprintf(mFile,"\"%s.kr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kr\"");
 	}
 protected:
 	FilterResample(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
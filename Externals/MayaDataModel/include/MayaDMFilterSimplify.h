@@ -27,47 +27,47 @@ public:
 	void setTolerance(double tol)
 	{
 		if(tol == 0.001) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setTimeTolerance(double tt)
 	{
 		if(tt == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".tt\" %f;\n", tt);
+		writeFloat(mFile,"\tsetAttr \".tt\" ",tt,";\n");
 	}
 	void setMinTimeStep(double mnt)
 	{
 		if(mnt == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mnt\" %f;\n", mnt);
+		writeFloat(mFile,"\tsetAttr \".mnt\" ",mnt,";\n");
 	}
 	void setMaxTimeStep(double mxt)
 	{
 		if(mxt == 3600) return;
-		fprintf(mFile,"\tsetAttr \".mxt\" %f;\n", mxt);
+		writeFloat(mFile,"\tsetAttr \".mxt\" ",mxt,";\n");
 	}
 	void setAllowDuplicates(bool ad)
 	{
 		if(ad == true) return;
-		fprintf(mFile,"\tsetAttr \".ad\" %i;\n", ad);
+		writeInt(mFile,"\tsetAttr \".ad\" ",ad,";\n");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getTimeTolerance()const
 	{
-		fprintf(mFile,"\"%s.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tt\"");
 	}
 	void getMinTimeStep()const
 	{
-		fprintf(mFile,"\"%s.mnt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mnt\"");
 	}
 	void getMaxTimeStep()const
 	{
-		fprintf(mFile,"\"%s.mxt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxt\"");
 	}
 	void getAllowDuplicates()const
 	{
-		fprintf(mFile,"\"%s.ad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ad\"");
 	}
 protected:
 	FilterSimplify(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
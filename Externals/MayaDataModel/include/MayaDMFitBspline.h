@@ -27,19 +27,19 @@ public:
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	FitBspline(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setCurrentDriver(short cdr)
 	{
 		if(cdr == -1) return;
-		fprintf(mFile,"\tsetAttr \".cdr\" %i;\n", cdr);
+		writeInt(mFile,"\tsetAttr \".cdr\" ",cdr,";\n");
 	}
 	void getDriver(size_t dr_i)const
 	{
-		fprintf(mFile,"\"%s.dr[%i]\"",mName.c_str(),dr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dr[",dr_i,"]\"");
 	}
 	void getDriver()const
 	{
 
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getCurrentDriver()const
 	{
-		fprintf(mFile,"\"%s.cdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdr\"");
 	}
 	void getFlexorNodes(size_t fn_i)const
 	{
-		fprintf(mFile,"\"%s.fn[%i]\"",mName.c_str(),fn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fn[",fn_i,"]\"");
 	}
 	void getFlexorNodes()const
 	{
 
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 protected:
 	FlexorShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,270 +27,270 @@ public:
 	void setLatticeOnObject(bool lo)
 	{
 		if(lo == false) return;
-		fprintf(mFile,"\tsetAttr \".lo\" %i;\n", lo);
+		writeInt(mFile,"\tsetAttr \".lo\" ",lo,";\n");
 	}
 	void setParmValue(double pv)
 	{
 		if(pv == 0) return;
-		fprintf(mFile,"\tsetAttr \".pv\" %f;\n", pv);
+		writeFloat(mFile,"\tsetAttr \".pv\" ",pv,";\n");
 	}
 	void setSDivisions(short sdv)
 	{
 		if(sdv == 2) return;
-		fprintf(mFile,"\tsetAttr \".sdv\" %i;\n", sdv);
+		writeInt(mFile,"\tsetAttr \".sdv\" ",sdv,";\n");
 	}
 	void setTDivisions(short tdv)
 	{
 		if(tdv == 5) return;
-		fprintf(mFile,"\tsetAttr \".tdv\" %i;\n", tdv);
+		writeInt(mFile,"\tsetAttr \".tdv\" ",tdv,";\n");
 	}
 	void setUDivisions(short udv)
 	{
 		if(udv == 2) return;
-		fprintf(mFile,"\tsetAttr \".udv\" %i;\n", udv);
+		writeInt(mFile,"\tsetAttr \".udv\" ",udv,";\n");
 	}
 	void setInBaseMatrix(const matrix& ibm)
 	{
 		if(ibm == identity) return;
-		fprintf(mFile,"\tsetAttr \".ibm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".ibm\" -type \"matrix\" ");
 		ibm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefMatrixInv(const matrix& dmi)
 	{
 		if(dmi == identity) return;
-		fprintf(mFile,"\tsetAttr \".dmi\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".dmi\" -type \"matrix\" ");
 		dmi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSetFrontAxis(unsigned int sfa)
 	{
 		if(sfa == 1) return;
-		fprintf(mFile,"\tsetAttr \".sfa\" %i;\n", sfa);
+		writeInt(mFile,"\tsetAttr \".sfa\" ",sfa,";\n");
 	}
 	void setSetUpAxis(unsigned int sua)
 	{
 		if(sua == 2) return;
-		fprintf(mFile,"\tsetAttr \".sua\" %i;\n", sua);
+		writeInt(mFile,"\tsetAttr \".sua\" ",sua,";\n");
 	}
 	void setOrientMatrix(const matrix& omx)
 	{
 		if(omx == identity) return;
-		fprintf(mFile,"\tsetAttr \".omx\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".omx\" -type \"matrix\" ");
 		omx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAllCoords(const double3& ac)
 	{
 		if(ac == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ac\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ac\" -type \"double3\" ");
 		ac.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setXCoord(double xc)
 	{
 		if(xc == 0) return;
-		fprintf(mFile,"\tsetAttr \".ac.xc\" %f;\n", xc);
+		writeFloat(mFile,"\tsetAttr \".ac.xc\" ",xc,";\n");
 	}
 	void setYCoord(double yc)
 	{
 		if(yc == 0) return;
-		fprintf(mFile,"\tsetAttr \".ac.yc\" %f;\n", yc);
+		writeFloat(mFile,"\tsetAttr \".ac.yc\" ",yc,";\n");
 	}
 	void setZCoord(double zc)
 	{
 		if(zc == 0) return;
-		fprintf(mFile,"\tsetAttr \".ac.zc\" %f;\n", zc);
+		writeFloat(mFile,"\tsetAttr \".ac.zc\" ",zc,";\n");
 	}
 	void setCenter(size_t ctr_i,const double3& ctr)
 	{
 		if(ctr == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ctr[%i]\" -type \"double3\" ",ctr_i);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_i,"]\" -type \"double3\" ");
 		ctr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCenter(size_t ctr_start,size_t ctr_end,double* ctr)
 	{
-		fprintf(mFile,"\tsetAttr \".ctr[%i:%i]\" ", ctr_start,ctr_end);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_start); writeInt(mFile,":",ctr_end,"]\" ");
 		size_t size = (ctr_end-ctr_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ctr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ctr[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCenter(size_t ctr_start,size_t ctr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ctr[%i:%i]\"",ctr_start,ctr_end);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_start); writeInt(mFile,":",ctr_end,"]\"");
 	}
 	void appendCenter(double ctr)const
 	{
-		fprintf(mFile," %f",ctr);
+		writeFloat(mFile," ",ctr);
 	}
 	void endCenter()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCenterX(size_t ctr_i,double ctx)
 	{
 		if(ctx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ctr[%i].ctx\" %f;\n", ctr_i,ctx);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_i); writeFloat(mFile,"].ctx\" ",ctx,";\n");
 	}
 	void setCenterY(size_t ctr_i,double cty)
 	{
 		if(cty == 0) return;
-		fprintf(mFile,"\tsetAttr \".ctr[%i].cty\" %f;\n", ctr_i,cty);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_i); writeFloat(mFile,"].cty\" ",cty,";\n");
 	}
 	void setCenterZ(size_t ctr_i,double ctz)
 	{
 		if(ctz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ctr[%i].ctz\" %f;\n", ctr_i,ctz);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_i); writeFloat(mFile,"].ctz\" ",ctz,";\n");
 	}
 	void setObjectWorldMatrix(size_t owmx_i,const matrix& owmx)
 	{
 		if(owmx == identity) return;
-		fprintf(mFile,"\tsetAttr \".owmx[%i]\" -type \"matrix\" ",owmx_i);
+		writeInt(mFile,"\tsetAttr \".owmx[",owmx_i,"]\" -type \"matrix\" ");
 		owmx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setObjectWorldMatrix(size_t owmx_start,size_t owmx_end,matrix* owmx)
 	{
-		fprintf(mFile,"\tsetAttr \".owmx[%i:%i]\" ", owmx_start,owmx_end);
+		writeInt(mFile,"\tsetAttr \".owmx[",owmx_start); writeInt(mFile,":",owmx_end,"]\" ");
 		size_t size = (owmx_end-owmx_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			owmx[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startObjectWorldMatrix(size_t owmx_start,size_t owmx_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".owmx[%i:%i]\"",owmx_start,owmx_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".owmx[",owmx_start); writeInt(mFile,":",owmx_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendObjectWorldMatrix(const matrix& owmx)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		owmx.write(mFile);
 	}
 	void endObjectWorldMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getMotionPath()const
 	{
-		fprintf(mFile,"\"%s.mp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mp\"");
 	}
 	void getCurve()const
 	{
-		fprintf(mFile,"\"%s.crv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crv\"");
 	}
 	void getParmValue()const
 	{
-		fprintf(mFile,"\"%s.pv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pv\"");
 	}
 	void getSDivisions()const
 	{
-		fprintf(mFile,"\"%s.sdv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdv\"");
 	}
 	void getTDivisions()const
 	{
-		fprintf(mFile,"\"%s.tdv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tdv\"");
 	}
 	void getUDivisions()const
 	{
-		fprintf(mFile,"\"%s.udv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv\"");
 	}
 	void getInBaseMatrix()const
 	{
-		fprintf(mFile,"\"%s.ibm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ibm\"");
 	}
 	void getDefMatrixInv()const
 	{
-		fprintf(mFile,"\"%s.dmi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmi\"");
 	}
 	void getSetFrontAxis()const
 	{
-		fprintf(mFile,"\"%s.sfa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfa\"");
 	}
 	void getSetUpAxis()const
 	{
-		fprintf(mFile,"\"%s.sua\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sua\"");
 	}
 	void getOrientMatrix()const
 	{
-		fprintf(mFile,"\"%s.omx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omx\"");
 	}
 	void getAllCoords()const
 	{
-		fprintf(mFile,"\"%s.ac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac\"");
 	}
 	void getXCoord()const
 	{
-		fprintf(mFile,"\"%s.ac.xc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.xc\"");
 	}
 	void getYCoord()const
 	{
-		fprintf(mFile,"\"%s.ac.yc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.yc\"");
 	}
 	void getZCoord()const
 	{
-		fprintf(mFile,"\"%s.ac.zc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.zc\"");
 	}
 	void getCenter(size_t ctr_i)const
 	{
-		fprintf(mFile,"\"%s.ctr[%i]\"",mName.c_str(),ctr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ctr[",ctr_i,"]\"");
 	}
 	void getCenter()const
 	{
 
-		fprintf(mFile,"\"%s.ctr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctr\"");
 	}
 	void getCenterX(size_t ctr_i)const
 	{
-		fprintf(mFile,"\"%s.ctr[%i].ctx\"",mName.c_str(),ctr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ctr[",ctr_i,"].ctx\"");
 	}
 	void getCenterX()const
 	{
 
-		fprintf(mFile,"\"%s.ctr.ctx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctr.ctx\"");
 	}
 	void getCenterY(size_t ctr_i)const
 	{
-		fprintf(mFile,"\"%s.ctr[%i].cty\"",mName.c_str(),ctr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ctr[",ctr_i,"].cty\"");
 	}
 	void getCenterY()const
 	{
 
-		fprintf(mFile,"\"%s.ctr.cty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctr.cty\"");
 	}
 	void getCenterZ(size_t ctr_i)const
 	{
-		fprintf(mFile,"\"%s.ctr[%i].ctz\"",mName.c_str(),ctr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ctr[",ctr_i,"].ctz\"");
 	}
 	void getCenterZ()const
 	{
 
-		fprintf(mFile,"\"%s.ctr.ctz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctr.ctz\"");
 	}
 	void getObjectWorldMatrix(size_t owmx_i)const
 	{
-		fprintf(mFile,"\"%s.owmx[%i]\"",mName.c_str(),owmx_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".owmx[",owmx_i,"]\"");
 	}
 	void getObjectWorldMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.owmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".owmx\"");
 	}
 	void getOutBaseMatrix()const
 	{
-		fprintf(mFile,"\"%s.obm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".obm\"");
 	}
 	void getDefPts()const
 	{
-		fprintf(mFile,"\"%s.dpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpt\"");
 	}
 protected:
 	Flow(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,170 +27,170 @@ public:
 	void setFluidDropoff(double fdo)
 	{
 		if(fdo == 2) return;
-		fprintf(mFile,"\tsetAttr \".fdo\" %f;\n", fdo);
+		writeFloat(mFile,"\tsetAttr \".fdo\" ",fdo,";\n");
 	}
 	void setTurbulenceType(unsigned int trt)
 	{
 		if(trt == 0) return;
-		fprintf(mFile,"\tsetAttr \".trt\" %i;\n", trt);
+		writeInt(mFile,"\tsetAttr \".trt\" ",trt,";\n");
 	}
 	void setFluidJitter(bool fjt)
 	{
 		if(fjt == true) return;
-		fprintf(mFile,"\tsetAttr \".fjt\" %i;\n", fjt);
+		writeInt(mFile,"\tsetAttr \".fjt\" ",fjt,";\n");
 	}
 	void setTurbulence(double trb)
 	{
 		if(trb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".trb\" %f;\n", trb);
+		writeFloat(mFile,"\tsetAttr \".trb\" ",trb,";\n");
 	}
 	void setTurbulenceSpeed(double trs)
 	{
 		if(trs == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".trs\" %f;\n", trs);
+		writeFloat(mFile,"\tsetAttr \".trs\" ",trs,";\n");
 	}
 	void setTurbulenceFrequency(const double3& tf)
 	{
-		fprintf(mFile,"\tsetAttr \".tf\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".tf\" -type \"double3\" ");
 		tf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTurbulenceFrequencyX(double tfx)
 	{
 		if(tfx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfx\" %f;\n", tfx);
+		writeFloat(mFile,"\tsetAttr \".tf.tfx\" ",tfx,";\n");
 	}
 	void setTurbulenceFrequencyY(double tfy)
 	{
 		if(tfy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfy\" %f;\n", tfy);
+		writeFloat(mFile,"\tsetAttr \".tf.tfy\" ",tfy,";\n");
 	}
 	void setTurbulenceFrequencyZ(double tfz)
 	{
 		if(tfz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfz\" %f;\n", tfz);
+		writeFloat(mFile,"\tsetAttr \".tf.tfz\" ",tfz,";\n");
 	}
 	void setTurbulenceOffset(const double3& to)
 	{
-		fprintf(mFile,"\tsetAttr \".to\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".to\" -type \"double3\" ");
 		to.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTurbulenceOffsetX(double tox)
 	{
 		if(tox == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.tox\" %f;\n", tox);
+		writeFloat(mFile,"\tsetAttr \".to.tox\" ",tox,";\n");
 	}
 	void setTurbulenceOffsetY(double toy)
 	{
 		if(toy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.toy\" %f;\n", toy);
+		writeFloat(mFile,"\tsetAttr \".to.toy\" ",toy,";\n");
 	}
 	void setTurbulenceOffsetZ(double toz)
 	{
 		if(toz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.toz\" %f;\n", toz);
+		writeFloat(mFile,"\tsetAttr \".to.toz\" ",toz,";\n");
 	}
 	void setDetailTurbulence(double dtr)
 	{
 		if(dtr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtr\" %f;\n", dtr);
+		writeFloat(mFile,"\tsetAttr \".dtr\" ",dtr,";\n");
 	}
 	void setFluidDensityEmission(double fde)
 	{
 		if(fde == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fde\" %f;\n", fde);
+		writeFloat(mFile,"\tsetAttr \".fde\" ",fde,";\n");
 	}
 	void setFluidHeatEmission(double fhe)
 	{
 		if(fhe == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fhe\" %f;\n", fhe);
+		writeFloat(mFile,"\tsetAttr \".fhe\" ",fhe,";\n");
 	}
 	void setFluidFuelEmission(double ffe)
 	{
 		if(ffe == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ffe\" %f;\n", ffe);
+		writeFloat(mFile,"\tsetAttr \".ffe\" ",ffe,";\n");
 	}
 	void setEmitFluidColor(bool efc)
 	{
 		if(efc == false) return;
-		fprintf(mFile,"\tsetAttr \".efc\" %i;\n", efc);
+		writeInt(mFile,"\tsetAttr \".efc\" ",efc,";\n");
 	}
 	void getFluidDropoff()const
 	{
-		fprintf(mFile,"\"%s.fdo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fdo\"");
 	}
 	void getTurbulenceType()const
 	{
-		fprintf(mFile,"\"%s.trt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trt\"");
 	}
 	void getFluidJitter()const
 	{
-		fprintf(mFile,"\"%s.fjt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fjt\"");
 	}
 	void getTurbulence()const
 	{
-		fprintf(mFile,"\"%s.trb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trb\"");
 	}
 	void getTurbulenceSpeed()const
 	{
-		fprintf(mFile,"\"%s.trs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trs\"");
 	}
 	void getTurbulenceFrequency()const
 	{
-		fprintf(mFile,"\"%s.tf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf\"");
 	}
 	void getTurbulenceFrequencyX()const
 	{
-		fprintf(mFile,"\"%s.tf.tfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfx\"");
 	}
 	void getTurbulenceFrequencyY()const
 	{
-		fprintf(mFile,"\"%s.tf.tfy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfy\"");
 	}
 	void getTurbulenceFrequencyZ()const
 	{
-		fprintf(mFile,"\"%s.tf.tfz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfz\"");
 	}
 	void getTurbulenceOffset()const
 	{
-		fprintf(mFile,"\"%s.to\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to\"");
 	}
 	void getTurbulenceOffsetX()const
 	{
-		fprintf(mFile,"\"%s.to.tox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.tox\"");
 	}
 	void getTurbulenceOffsetY()const
 	{
-		fprintf(mFile,"\"%s.to.toy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.toy\"");
 	}
 	void getTurbulenceOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.to.toz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.toz\"");
 	}
 	void getDetailTurbulence()const
 	{
-		fprintf(mFile,"\"%s.dtr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtr\"");
 	}
 	void getFluidDensityEmission()const
 	{
-		fprintf(mFile,"\"%s.fde\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fde\"");
 	}
 	void getFluidHeatEmission()const
 	{
-		fprintf(mFile,"\"%s.fhe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fhe\"");
 	}
 	void getFluidFuelEmission()const
 	{
-		fprintf(mFile,"\"%s.ffe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ffe\"");
 	}
 	void getEmitFluidColor()const
 	{
-		fprintf(mFile,"\"%s.efc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".efc\"");
 	}
 	void getEmissionFunction()const
 	{
-		fprintf(mFile,"\"%s.ef\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ef\"");
 	}
 protected:
 	FluidEmitter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
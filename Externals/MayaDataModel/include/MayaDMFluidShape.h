@@ -23,9 +23,9 @@ public:
 		int resolutionD;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", resolutionW);
-			fprintf(file,"%i ", resolutionH);
-			fprintf(file,"%i", resolutionD);
+			writeInt(file,"",resolutionW," ");
+			writeInt(file,"",resolutionH," ");
+			writeInt(file,"",resolutionD);
 		}
 	};
 	struct Dimensions{
@@ -34,9 +34,9 @@ public:
 		double dimensionsD;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", dimensionsW);
-			fprintf(file,"%f ", dimensionsH);
-			fprintf(file,"%f", dimensionsD);
+			writeFloat(file,"",dimensionsW," ");
+			writeFloat(file,"",dimensionsH," ");
+			writeFloat(file,"",dimensionsD);
 		}
 	};
 	struct FieldData{
@@ -51,8 +51,8 @@ public:
 				short fieldFunction_InmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", fieldFunction_InmapTo);
-					fprintf(file,"%i", fieldFunction_InmapFrom);
+					writeInt(file,"",fieldFunction_InmapTo," ");
+					writeInt(file,"",fieldFunction_InmapFrom);
 				}
 			}* fieldFunction_Inmap;
 			size_t nbFieldFunction_Inmap;
@@ -61,8 +61,8 @@ public:
 				short fieldFunction_OutmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", fieldFunction_OutmapTo);
-					fprintf(file,"%i", fieldFunction_OutmapFrom);
+					writeInt(file,"",fieldFunction_OutmapTo," ");
+					writeInt(file,"",fieldFunction_OutmapFrom);
 				}
 			}* fieldFunction_Outmap;
 			size_t nbFieldFunction_Outmap;
@@ -71,13 +71,13 @@ public:
 				for (size_t i = 0; i<nbFieldFunction_Inmap; ++i)
 				{
 					fieldFunction_Inmap[i].write(file);
-					fprintf(file, " ");
-					if (i + 1<nbFieldFunction_Inmap) fprintf(file, " ");
+					writeString(file," ");
+					if (i + 1<nbFieldFunction_Inmap) writeString(file," ");
 				}
 				for (size_t i = 0; i<nbFieldFunction_Outmap; ++i)
 				{
 					fieldFunction_Outmap[i].write(file);
-					if (i + 1<nbFieldFunction_Outmap) fprintf(file, " ");
+					if (i + 1<nbFieldFunction_Outmap) writeString(file," ");
 				}
 			}
 		} fieldFunction;
@@ -93,8 +93,8 @@ public:
 				short emissionFunction_InmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", emissionFunction_InmapTo);
-					fprintf(file,"%i", emissionFunction_InmapFrom);
+					writeInt(file,"",emissionFunction_InmapTo," ");
+					writeInt(file,"",emissionFunction_InmapFrom);
 				}
 			}* emissionFunction_Inmap;
 			size_t nbEmissionFunction_Inmap;
@@ -103,8 +103,8 @@ public:
 				short emissionFunction_OutmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", emissionFunction_OutmapTo);
-					fprintf(file,"%i", emissionFunction_OutmapFrom);
+					writeInt(file,"",emissionFunction_OutmapTo," ");
+					writeInt(file,"",emissionFunction_OutmapFrom);
 				}
 			}* emissionFunction_Outmap;
 			size_t nbEmissionFunction_Outmap;
@@ -113,13 +113,13 @@ public:
 				for (size_t i = 0; i<nbEmissionFunction_Inmap; ++i)
 				{
 					emissionFunction_Inmap[i].write(file);
-					fprintf(file, " ");
-					if (i + 1<nbEmissionFunction_Inmap) fprintf(file, " ");
+					writeString(file," ");
+					if (i + 1<nbEmissionFunction_Inmap) writeString(file," ");
 				}
 				for (size_t i = 0; i<nbEmissionFunction_Outmap; ++i)
 				{
 					emissionFunction_Outmap[i].write(file);
-					if (i + 1<nbEmissionFunction_Outmap) fprintf(file, " ");
+					if (i + 1<nbEmissionFunction_Outmap) writeString(file," ");
 				}
 			}
 		} emissionFunction;
@@ -134,9 +134,9 @@ public:
 		int subVolumeCenterD;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", subVolumeCenterW);
-			fprintf(file,"%i ", subVolumeCenterH);
-			fprintf(file,"%i ", subVolumeCenterD);
+			writeInt(file,"",subVolumeCenterW," ");
+			writeInt(file,"",subVolumeCenterH," ");
+			writeInt(file,"",subVolumeCenterD," ");
 		}
 	};
 	struct SubVolumeSize{
@@ -145,9 +145,9 @@ public:
 		int subVolumeSizeD;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", subVolumeSizeW);
-			fprintf(file,"%i ", subVolumeSizeH);
-			fprintf(file,"%i ", subVolumeSizeD);
+			writeInt(file,"",subVolumeSizeW," ");
+			writeInt(file,"",subVolumeSizeH," ");
+			writeInt(file,"",subVolumeSizeD," ");
 		}
 	};
 	struct InputData{
@@ -158,12 +158,12 @@ public:
 		void write(FILE* file) const
 		{
 			inputPositions.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			inputVelocities.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			inputMass.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", deltaTime);
+			writeString(file," ");
+			writeFloat(file,"",deltaTime);
 		}
 	};
 	struct Color{
@@ -172,10 +172,10 @@ public:
 		unsigned int color_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", color_Position);
+			writeFloat(file,"",color_Position," ");
 			color_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", color_Interp);
+			writeString(file," ");
+			writeInt(file,"",color_Interp);
 		}
 	};
 	struct Opacity{
@@ -184,9 +184,9 @@ public:
 		unsigned int opacity_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", opacity_Position);
-			fprintf(file,"%f ", opacity_FloatValue);
-			fprintf(file,"%i", opacity_Interp);
+			writeFloat(file,"",opacity_Position," ");
+			writeFloat(file,"",opacity_FloatValue," ");
+			writeInt(file,"",opacity_Interp);
 		}
 	};
 	struct Incandescence{
@@ -195,10 +195,10 @@ public:
 		unsigned int incandescence_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", incandescence_Position);
+			writeFloat(file,"",incandescence_Position," ");
 			incandescence_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", incandescence_Interp);
+			writeString(file," ");
+			writeInt(file,"",incandescence_Interp);
 		}
 	};
 	struct Environment{
@@ -207,10 +207,10 @@ public:
 		unsigned int environment_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", environment_Position);
+			writeFloat(file,"",environment_Position," ");
 			environment_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", environment_Interp);
+			writeString(file," ");
+			writeInt(file,"",environment_Interp);
 		}
 	};
 	struct CollisionData{
@@ -236,21 +236,21 @@ public:
 		short miMaxSamples;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i", miMaxSamples);
+			writeInt(file,"",miOverrideCaustics," ");
+			writeInt(file,"",miCausticAccuracy," ");
+			writeFloat(file,"",miCausticRadius," ");
+			writeInt(file,"",miOverrideGlobalIllumination," ");
+			writeInt(file,"",miGlobillumAccuracy," ");
+			writeFloat(file,"",miGlobillumRadius," ");
+			writeInt(file,"",miOverrideFinalGather," ");
+			writeInt(file,"",miFinalGatherRays," ");
+			writeFloat(file,"",miFinalGatherMinRadius," ");
+			writeFloat(file,"",miFinalGatherMaxRadius," ");
+			writeInt(file,"",miFinalGatherFilter," ");
+			writeInt(file,"",miFinalGatherView," ");
+			writeInt(file,"",miOverrideSamples," ");
+			writeInt(file,"",miMinSamples," ");
+			writeInt(file,"",miMaxSamples);
 		}
 	};
 public:
@@ -263,1483 +263,1483 @@ public:
 	void setStartFrame(double stf)
 	{
 		if(stf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".stf\" %f;\n", stf);
+		writeFloat(mFile,"\tsetAttr \".stf\" ",stf,";\n");
 	}
 	void setDisableInteractiveEval(bool die)
 	{
 		if(die == false) return;
-		fprintf(mFile,"\tsetAttr \".die\" %i;\n", die);
+		writeInt(mFile,"\tsetAttr \".die\" ",die,";\n");
 	}
 	void setIs2d(bool is2)
 	{
 		if(is2 == false) return;
-		fprintf(mFile,"\tsetAttr \".is2\" %i;\n", is2);
+		writeInt(mFile,"\tsetAttr \".is2\" ",is2,";\n");
 	}
 	void setResolution(const Resolution& res)
 	{
-		fprintf(mFile,"\tsetAttr \".res\" ");
+		writeString(mFile,"\tsetAttr \".res\" ");
 		res.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setResolutionW(int rw)
 	{
 		if(rw == 10) return;
-		fprintf(mFile,"\tsetAttr \".res.rw\" %i;\n", rw);
+		writeInt(mFile,"\tsetAttr \".res.rw\" ",rw,";\n");
 	}
 	void setResolutionH(int rh)
 	{
 		if(rh == 10) return;
-		fprintf(mFile,"\tsetAttr \".res.rh\" %i;\n", rh);
+		writeInt(mFile,"\tsetAttr \".res.rh\" ",rh,";\n");
 	}
 	void setResolutionD(int rd)
 	{
 		if(rd == 10) return;
-		fprintf(mFile,"\tsetAttr \".res.rd\" %i;\n", rd);
+		writeInt(mFile,"\tsetAttr \".res.rd\" ",rd,";\n");
 	}
 	void setDimensions(const Dimensions& dim)
 	{
-		fprintf(mFile,"\tsetAttr \".dim\" ");
+		writeString(mFile,"\tsetAttr \".dim\" ");
 		dim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDimensionsW(double dw)
 	{
 		if(dw == 3) return;
-		fprintf(mFile,"\tsetAttr \".dim.dw\" %f;\n", dw);
+		writeFloat(mFile,"\tsetAttr \".dim.dw\" ",dw,";\n");
 	}
 	void setDimensionsH(double dh)
 	{
 		if(dh == 3) return;
-		fprintf(mFile,"\tsetAttr \".dim.dh\" %f;\n", dh);
+		writeFloat(mFile,"\tsetAttr \".dim.dh\" ",dh,";\n");
 	}
 	void setDimensionsD(double dd)
 	{
 		if(dd == 3) return;
-		fprintf(mFile,"\tsetAttr \".dim.dd\" %f;\n", dd);
+		writeFloat(mFile,"\tsetAttr \".dim.dd\" ",dd,";\n");
 	}
 	void setDoFields(bool dfr)
 	{
 		if(dfr == true) return;
-		fprintf(mFile,"\tsetAttr \".dfr\" %i;\n", dfr);
+		writeInt(mFile,"\tsetAttr \".dfr\" ",dfr,";\n");
 	}
 	void setFieldList(size_t fll_i,const FieldList& fll)
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i]\" ",fll_i);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i,"]\" ");
 		fll.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFieldList(size_t fll_start,size_t fll_end,FieldList* fll)
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i:%i]\" ", fll_start,fll_end);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_start); writeInt(mFile,":",fll_end,"]\" ");
 		size_t size = (fll_end-fll_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			fll[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFieldList(size_t fll_start,size_t fll_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i:%i]\"",fll_start,fll_end);
-		fprintf(mFile," -type \"FieldList\" ");
+		writeInt(mFile,"\tsetAttr \".fll[",fll_start); writeInt(mFile,":",fll_end,"]\"");
+		writeString(mFile," -type \"FieldList\" ");
 	}
 	void appendFieldList(const FieldList& fll)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		fll.write(mFile);
 	}
 	void endFieldList()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFieldFunction(size_t fll_i,const FieldList::FieldFunction& frf)
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf\" ",fll_i);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i,"].frf\" ");
 		frf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFieldFunction_Inmap(size_t fll_i,size_t frfi_i,const FieldList::FieldFunction::FieldFunction_Inmap& frfi)
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfi[%i]\" ",fll_i,frfi_i);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfi[",frfi_i,"]\" ");
 		frfi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFieldFunction_Inmap(size_t fll_i,size_t frfi_start,size_t frfi_end,FieldList::FieldFunction::FieldFunction_Inmap* frfi)
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfi[%i:%i]\" ", fll_i,frfi_start,frfi_end);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfi[",frfi_start); writeInt(mFile,":",frfi_end,"]\" ");
 		size_t size = (frfi_end-frfi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			frfi[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFieldFunction_Inmap(size_t fll_i,size_t frfi_start,size_t frfi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfi[%i:%i]\"",fll_i,frfi_start,frfi_end);
-		fprintf(mFile," -type \"FieldList::FieldFunction::FieldFunction_Inmap\" ");
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfi[",frfi_start); writeInt(mFile,":",frfi_end,"]\"");
+		writeString(mFile," -type \"FieldList::FieldFunction::FieldFunction_Inmap\" ");
 	}
 	void appendFieldFunction_Inmap(const FieldList::FieldFunction::FieldFunction_Inmap& frfi)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		frfi.write(mFile);
 	}
 	void endFieldFunction_Inmap()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFieldFunction_InmapTo(size_t fll_i,size_t frfi_i,short frfit)
 	{
 		if(frfit == 0) return;
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfi[%i].frfit\" %i;\n", fll_i,frfi_i,frfit);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfi[",frfi_i); writeInt(mFile,"].frfit\" ",frfit,";\n");
 	}
 	void setFieldFunction_InmapFrom(size_t fll_i,size_t frfi_i,short frfif)
 	{
 		if(frfif == 0) return;
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfi[%i].frfif\" %i;\n", fll_i,frfi_i,frfif);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfi[",frfi_i); writeInt(mFile,"].frfif\" ",frfif,";\n");
 	}
 	void setFieldFunction_Outmap(size_t fll_i,size_t frfo_i,const FieldList::FieldFunction::FieldFunction_Outmap& frfo)
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfo[%i]\" ",fll_i,frfo_i);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfo[",frfo_i,"]\" ");
 		frfo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFieldFunction_Outmap(size_t fll_i,size_t frfo_start,size_t frfo_end,FieldList::FieldFunction::FieldFunction_Outmap* frfo)
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfo[%i:%i]\" ", fll_i,frfo_start,frfo_end);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfo[",frfo_start); writeInt(mFile,":",frfo_end,"]\" ");
 		size_t size = (frfo_end-frfo_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			frfo[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFieldFunction_Outmap(size_t fll_i,size_t frfo_start,size_t frfo_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfo[%i:%i]\"",fll_i,frfo_start,frfo_end);
-		fprintf(mFile," -type \"FieldList::FieldFunction::FieldFunction_Outmap\" ");
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfo[",frfo_start); writeInt(mFile,":",frfo_end,"]\"");
+		writeString(mFile," -type \"FieldList::FieldFunction::FieldFunction_Outmap\" ");
 	}
 	void appendFieldFunction_Outmap(const FieldList::FieldFunction::FieldFunction_Outmap& frfo)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		frfo.write(mFile);
 	}
 	void endFieldFunction_Outmap()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFieldFunction_OutmapTo(size_t fll_i,size_t frfo_i,short frfot)
 	{
 		if(frfot == 0) return;
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfo[%i].frfot\" %i;\n", fll_i,frfo_i,frfot);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfo[",frfo_i); writeInt(mFile,"].frfot\" ",frfot,";\n");
 	}
 	void setFieldFunction_OutmapFrom(size_t fll_i,size_t frfo_i,short frfof)
 	{
 		if(frfof == 0) return;
-		fprintf(mFile,"\tsetAttr \".fll[%i].frf.frfo[%i].frfof\" %i;\n", fll_i,frfo_i,frfof);
+		writeInt(mFile,"\tsetAttr \".fll[",fll_i); writeInt(mFile,"].frf.frfo[",frfo_i); writeInt(mFile,"].frfof\" ",frfof,";\n");
 	}
 	void setDoEmission(bool de)
 	{
 		if(de == true) return;
-		fprintf(mFile,"\tsetAttr \".de\" %i;\n", de);
+		writeInt(mFile,"\tsetAttr \".de\" ",de,";\n");
 	}
 	void setInheritFactor(double inh)
 	{
 		if(inh == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".inh\" %f;\n", inh);
+		writeFloat(mFile,"\tsetAttr \".inh\" ",inh,";\n");
 	}
 	void setSeed(size_t sd_i,int sd)
 	{
 		if(sd == 1) return;
-		fprintf(mFile,"\tsetAttr \".sd[%i]\" %i;\n", sd_i,sd);
+		writeInt(mFile,"\tsetAttr \".sd[",sd_i); writeInt(mFile,"]\" ",sd,";\n");
 	}
 	void setSeed(size_t sd_start,size_t sd_end,int* sd)
 	{
-		fprintf(mFile,"\tsetAttr \".sd[%i:%i]\" ", sd_start,sd_end);
+		writeInt(mFile,"\tsetAttr \".sd[",sd_start); writeInt(mFile,":",sd_end,"]\" ");
 		size_t size = (sd_end-sd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",sd[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",sd[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSeed(size_t sd_start,size_t sd_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sd[%i:%i]\"",sd_start,sd_end);
+		writeInt(mFile,"\tsetAttr \".sd[",sd_start); writeInt(mFile,":",sd_end,"]\"");
 	}
 	void appendSeed(int sd)const
 	{
-		fprintf(mFile," %i",sd);
+		writeInt(mFile," ",sd);
 	}
 	void endSeed()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEmissionList(size_t eml_i,const EmissionList& eml)
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i]\" ",eml_i);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i,"]\" ");
 		eml.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEmissionList(size_t eml_start,size_t eml_end,EmissionList* eml)
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i:%i]\" ", eml_start,eml_end);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_start); writeInt(mFile,":",eml_end,"]\" ");
 		size_t size = (eml_end-eml_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			eml[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEmissionList(size_t eml_start,size_t eml_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i:%i]\"",eml_start,eml_end);
-		fprintf(mFile," -type \"EmissionList\" ");
+		writeInt(mFile,"\tsetAttr \".eml[",eml_start); writeInt(mFile,":",eml_end,"]\"");
+		writeString(mFile," -type \"EmissionList\" ");
 	}
 	void appendEmissionList(const EmissionList& eml)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		eml.write(mFile);
 	}
 	void endEmissionList()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEmissionFunction(size_t eml_i,const EmissionList::EmissionFunction& emf)
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf\" ",eml_i);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i,"].emf\" ");
 		emf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEmissionFunction_Inmap(size_t eml_i,size_t emfi_i,const EmissionList::EmissionFunction::EmissionFunction_Inmap& emfi)
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfi[%i]\" ",eml_i,emfi_i);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfi[",emfi_i,"]\" ");
 		emfi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEmissionFunction_Inmap(size_t eml_i,size_t emfi_start,size_t emfi_end,EmissionList::EmissionFunction::EmissionFunction_Inmap* emfi)
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfi[%i:%i]\" ", eml_i,emfi_start,emfi_end);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfi[",emfi_start); writeInt(mFile,":",emfi_end,"]\" ");
 		size_t size = (emfi_end-emfi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			emfi[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEmissionFunction_Inmap(size_t eml_i,size_t emfi_start,size_t emfi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfi[%i:%i]\"",eml_i,emfi_start,emfi_end);
-		fprintf(mFile," -type \"EmissionList::EmissionFunction::EmissionFunction_Inmap\" ");
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfi[",emfi_start); writeInt(mFile,":",emfi_end,"]\"");
+		writeString(mFile," -type \"EmissionList::EmissionFunction::EmissionFunction_Inmap\" ");
 	}
 	void appendEmissionFunction_Inmap(const EmissionList::EmissionFunction::EmissionFunction_Inmap& emfi)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		emfi.write(mFile);
 	}
 	void endEmissionFunction_Inmap()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEmissionFunction_InmapTo(size_t eml_i,size_t emfi_i,short emfit)
 	{
 		if(emfit == 0) return;
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfi[%i].emfit\" %i;\n", eml_i,emfi_i,emfit);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfi[",emfi_i); writeInt(mFile,"].emfit\" ",emfit,";\n");
 	}
 	void setEmissionFunction_InmapFrom(size_t eml_i,size_t emfi_i,short emfif)
 	{
 		if(emfif == 0) return;
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfi[%i].emfif\" %i;\n", eml_i,emfi_i,emfif);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfi[",emfi_i); writeInt(mFile,"].emfif\" ",emfif,";\n");
 	}
 	void setEmissionFunction_Outmap(size_t eml_i,size_t emfo_i,const EmissionList::EmissionFunction::EmissionFunction_Outmap& emfo)
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfo[%i]\" ",eml_i,emfo_i);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfo[",emfo_i,"]\" ");
 		emfo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEmissionFunction_Outmap(size_t eml_i,size_t emfo_start,size_t emfo_end,EmissionList::EmissionFunction::EmissionFunction_Outmap* emfo)
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfo[%i:%i]\" ", eml_i,emfo_start,emfo_end);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfo[",emfo_start); writeInt(mFile,":",emfo_end,"]\" ");
 		size_t size = (emfo_end-emfo_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			emfo[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEmissionFunction_Outmap(size_t eml_i,size_t emfo_start,size_t emfo_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfo[%i:%i]\"",eml_i,emfo_start,emfo_end);
-		fprintf(mFile," -type \"EmissionList::EmissionFunction::EmissionFunction_Outmap\" ");
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfo[",emfo_start); writeInt(mFile,":",emfo_end,"]\"");
+		writeString(mFile," -type \"EmissionList::EmissionFunction::EmissionFunction_Outmap\" ");
 	}
 	void appendEmissionFunction_Outmap(const EmissionList::EmissionFunction::EmissionFunction_Outmap& emfo)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		emfo.write(mFile);
 	}
 	void endEmissionFunction_Outmap()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEmissionFunction_OutmapTo(size_t eml_i,size_t emfo_i,short emfot)
 	{
 		if(emfot == 0) return;
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfo[%i].emfot\" %i;\n", eml_i,emfo_i,emfot);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfo[",emfo_i); writeInt(mFile,"].emfot\" ",emfot,";\n");
 	}
 	void setEmissionFunction_OutmapFrom(size_t eml_i,size_t emfo_i,short emfof)
 	{
 		if(emfof == 0) return;
-		fprintf(mFile,"\tsetAttr \".eml[%i].emf.emfo[%i].emfof\" %i;\n", eml_i,emfo_i,emfof);
+		writeInt(mFile,"\tsetAttr \".eml[",eml_i); writeInt(mFile,"].emf.emfo[",emfo_i); writeInt(mFile,"].emfof\" ",emfof,";\n");
 	}
 	void setSlices(int sli)
 	{
 		if(sli == 2) return;
-		fprintf(mFile,"\tsetAttr \".sli\" %i;\n", sli);
+		writeInt(mFile,"\tsetAttr \".sli\" ",sli,";\n");
 	}
 	void setVoxelQuality(unsigned int vqu)
 	{
 		if(vqu == 0) return;
-		fprintf(mFile,"\tsetAttr \".vqu\" %i;\n", vqu);
+		writeInt(mFile,"\tsetAttr \".vqu\" ",vqu,";\n");
 	}
 	void setDrawSubVolume(bool dsv)
 	{
 		if(dsv == false) return;
-		fprintf(mFile,"\tsetAttr \".dsv\" %i;\n", dsv);
+		writeInt(mFile,"\tsetAttr \".dsv\" ",dsv,";\n");
 	}
 	void setSubVolumeCenter(const SubVolumeCenter& svc)
 	{
-		fprintf(mFile,"\tsetAttr \".svc\" ");
+		writeString(mFile,"\tsetAttr \".svc\" ");
 		svc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSubVolumeCenterW(int scw)
 	{
 		if(scw == -1) return;
-		fprintf(mFile,"\tsetAttr \".svc.scw\" %i;\n", scw);
+		writeInt(mFile,"\tsetAttr \".svc.scw\" ",scw,";\n");
 	}
 	void setSubVolumeCenterH(int sch)
 	{
 		if(sch == -1) return;
-		fprintf(mFile,"\tsetAttr \".svc.sch\" %i;\n", sch);
+		writeInt(mFile,"\tsetAttr \".svc.sch\" ",sch,";\n");
 	}
 	void setSubVolumeCenterD(int scd)
 	{
 		if(scd == -1) return;
-		fprintf(mFile,"\tsetAttr \".svc.scd\" %i;\n", scd);
+		writeInt(mFile,"\tsetAttr \".svc.scd\" ",scd,";\n");
 	}
 	void setSubVolumeSize(const SubVolumeSize& svs)
 	{
-		fprintf(mFile,"\tsetAttr \".svs\" ");
+		writeString(mFile,"\tsetAttr \".svs\" ");
 		svs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSubVolumeSizeW(int ssw)
 	{
 		if(ssw == -1) return;
-		fprintf(mFile,"\tsetAttr \".svs.ssw\" %i;\n", ssw);
+		writeInt(mFile,"\tsetAttr \".svs.ssw\" ",ssw,";\n");
 	}
 	void setSubVolumeSizeH(int ssh)
 	{
 		if(ssh == -1) return;
-		fprintf(mFile,"\tsetAttr \".svs.ssh\" %i;\n", ssh);
+		writeInt(mFile,"\tsetAttr \".svs.ssh\" ",ssh,";\n");
 	}
 	void setSubVolumeSizeD(int ssd)
 	{
 		if(ssd == -1) return;
-		fprintf(mFile,"\tsetAttr \".svs.ssd\" %i;\n", ssd);
+		writeInt(mFile,"\tsetAttr \".svs.ssd\" ",ssd,";\n");
 	}
 	void setBoundaryDraw(unsigned int bod)
 	{
 		if(bod == 0) return;
-		fprintf(mFile,"\tsetAttr \".bod\" %i;\n", bod);
+		writeInt(mFile,"\tsetAttr \".bod\" ",bod,";\n");
 	}
 	void setDrawHeads(bool dhd)
 	{
 		if(dhd == true) return;
-		fprintf(mFile,"\tsetAttr \".dhd\" %i;\n", dhd);
+		writeInt(mFile,"\tsetAttr \".dhd\" ",dhd,";\n");
 	}
 	void setVelocityDraw(bool vld)
 	{
 		if(vld == false) return;
-		fprintf(mFile,"\tsetAttr \".vld\" %i;\n", vld);
+		writeInt(mFile,"\tsetAttr \".vld\" ",vld,";\n");
 	}
 	void setVelocityDrawLength(double vdl)
 	{
 		if(vdl == 1) return;
-		fprintf(mFile,"\tsetAttr \".vdl\" %f;\n", vdl);
+		writeFloat(mFile,"\tsetAttr \".vdl\" ",vdl,";\n");
 	}
 	void setVelocityDrawSkip(int vds)
 	{
 		if(vds == 1) return;
-		fprintf(mFile,"\tsetAttr \".vds\" %i;\n", vds);
+		writeInt(mFile,"\tsetAttr \".vds\" ",vds,";\n");
 	}
 	void setShadedDisplay(unsigned int sdp)
 	{
 		if(sdp == 1) return;
-		fprintf(mFile,"\tsetAttr \".sdp\" %i;\n", sdp);
+		writeInt(mFile,"\tsetAttr \".sdp\" ",sdp,";\n");
 	}
 	void setOpacityPreviewGain(float opg)
 	{
 		if(opg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".opg\" %f;\n", opg);
+		writeFloat(mFile,"\tsetAttr \".opg\" ",opg,";\n");
 	}
 	void setWireframeDisplay(unsigned int wdp)
 	{
 		if(wdp == 2) return;
-		fprintf(mFile,"\tsetAttr \".wdp\" %i;\n", wdp);
+		writeInt(mFile,"\tsetAttr \".wdp\" ",wdp,";\n");
 	}
 	void setNumericDisplay(unsigned int nud)
 	{
 		if(nud == 0) return;
-		fprintf(mFile,"\tsetAttr \".nud\" %i;\n", nud);
+		writeInt(mFile,"\tsetAttr \".nud\" ",nud,";\n");
 	}
 	void setHardwareSelfShadow(bool hss)
 	{
 		if(hss == true) return;
-		fprintf(mFile,"\tsetAttr \".hss\" %i;\n", hss);
+		writeInt(mFile,"\tsetAttr \".hss\" ",hss,";\n");
 	}
 	void setCoordinateMethod(unsigned int cmet)
 	{
 		if(cmet == 0) return;
-		fprintf(mFile,"\tsetAttr \".cmet\" %i;\n", cmet);
+		writeInt(mFile,"\tsetAttr \".cmet\" ",cmet,";\n");
 	}
 	void setOverrideTimeStep(double ots)
 	{
 		if(ots == 1) return;
-		fprintf(mFile,"\tsetAttr \".ots\" %f;\n", ots);
+		writeFloat(mFile,"\tsetAttr \".ots\" ",ots,";\n");
 	}
 	void setSimulationRateScale(float srs)
 	{
 		if(srs == 1) return;
-		fprintf(mFile,"\tsetAttr \".srs\" %f;\n", srs);
+		writeFloat(mFile,"\tsetAttr \".srs\" ",srs,";\n");
 	}
 	void setGridInterpolator(unsigned int gdi)
 	{
 		if(gdi == 0) return;
-		fprintf(mFile,"\tsetAttr \".gdi\" %i;\n", gdi);
+		writeInt(mFile,"\tsetAttr \".gdi\" ",gdi,";\n");
 	}
 	void setForceDynamics(bool fdn)
 	{
 		if(fdn == false) return;
-		fprintf(mFile,"\tsetAttr \".fdn\" %i;\n", fdn);
+		writeInt(mFile,"\tsetAttr \".fdn\" ",fdn,";\n");
 	}
 	void setSolver(unsigned int sol)
 	{
 		if(sol == 1) return;
-		fprintf(mFile,"\tsetAttr \".sol\" %i;\n", sol);
+		writeInt(mFile,"\tsetAttr \".sol\" ",sol,";\n");
 	}
 	void setSolverQuality(int sql)
 	{
 		if(sql == 20) return;
-		fprintf(mFile,"\tsetAttr \".sql\" %i;\n", sql);
+		writeInt(mFile,"\tsetAttr \".sql\" ",sql,";\n");
 	}
 	void setHighDetailSolve(unsigned int hds)
 	{
 		if(hds == 0) return;
-		fprintf(mFile,"\tsetAttr \".hds\" %i;\n", hds);
+		writeInt(mFile,"\tsetAttr \".hds\" ",hds,";\n");
 	}
 	void setBoundaryX(unsigned int bndx)
 	{
 		if(bndx == 1) return;
-		fprintf(mFile,"\tsetAttr \".bndx\" %i;\n", bndx);
+		writeInt(mFile,"\tsetAttr \".bndx\" ",bndx,";\n");
 	}
 	void setBoundaryY(unsigned int bndy)
 	{
 		if(bndy == 1) return;
-		fprintf(mFile,"\tsetAttr \".bndy\" %i;\n", bndy);
+		writeInt(mFile,"\tsetAttr \".bndy\" ",bndy,";\n");
 	}
 	void setBoundaryZ(unsigned int bndz)
 	{
 		if(bndz == 1) return;
-		fprintf(mFile,"\tsetAttr \".bndz\" %i;\n", bndz);
+		writeInt(mFile,"\tsetAttr \".bndz\" ",bndz,";\n");
 	}
 	void setMassConversion(double mcv)
 	{
 		if(mcv == 1) return;
-		fprintf(mFile,"\tsetAttr \".mcv\" %f;\n", mcv);
+		writeFloat(mFile,"\tsetAttr \".mcv\" ",mcv,";\n");
 	}
 	void setFalloffMethod(unsigned int fmt)
 	{
 		if(fmt == 0) return;
-		fprintf(mFile,"\tsetAttr \".fmt\" %i;\n", fmt);
+		writeInt(mFile,"\tsetAttr \".fmt\" ",fmt,";\n");
 	}
 	void setDensityMethod(unsigned int dmt)
 	{
 		if(dmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".dmt\" %i;\n", dmt);
+		writeInt(mFile,"\tsetAttr \".dmt\" ",dmt,";\n");
 	}
 	void setDensityGradient(unsigned int dgr)
 	{
 		if(dgr == 0) return;
-		fprintf(mFile,"\tsetAttr \".dgr\" %i;\n", dgr);
+		writeInt(mFile,"\tsetAttr \".dgr\" ",dgr,";\n");
 	}
 	void setDensityScale(float dsc)
 	{
 		if(dsc == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dsc\" %f;\n", dsc);
+		writeFloat(mFile,"\tsetAttr \".dsc\" ",dsc,";\n");
 	}
 	void setDensityDissipation(double dds)
 	{
 		if(dds == 0) return;
-		fprintf(mFile,"\tsetAttr \".dds\" %f;\n", dds);
+		writeFloat(mFile,"\tsetAttr \".dds\" ",dds,";\n");
 	}
 	void setDensityDiffusion(double ddf)
 	{
 		if(ddf == 0) return;
-		fprintf(mFile,"\tsetAttr \".ddf\" %f;\n", ddf);
+		writeFloat(mFile,"\tsetAttr \".ddf\" ",ddf,";\n");
 	}
 	void setConserveMass(bool cm)
 	{
 		if(cm == true) return;
-		fprintf(mFile,"\tsetAttr \".cm\" %i;\n", cm);
+		writeInt(mFile,"\tsetAttr \".cm\" ",cm,";\n");
 	}
 	void setDensityBuoyancy(float dsb)
 	{
 		if(dsb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dsb\" %f;\n", dsb);
+		writeFloat(mFile,"\tsetAttr \".dsb\" ",dsb,";\n");
 	}
 	void setGravity(float grv)
 	{
 		if(grv == 9.8) return;
-		fprintf(mFile,"\tsetAttr \".grv\" %f;\n", grv);
+		writeFloat(mFile,"\tsetAttr \".grv\" ",grv,";\n");
 	}
 	void setVelocityMethod(unsigned int vmt)
 	{
 		if(vmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".vmt\" %i;\n", vmt);
+		writeInt(mFile,"\tsetAttr \".vmt\" ",vmt,";\n");
 	}
 	void setVelocityGradient(unsigned int vgr)
 	{
 		if(vgr == 0) return;
-		fprintf(mFile,"\tsetAttr \".vgr\" %i;\n", vgr);
+		writeInt(mFile,"\tsetAttr \".vgr\" ",vgr,";\n");
 	}
 	void setVelocityScale(const float3& vsc)
 	{
 		if(vsc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".vsc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vsc\" -type \"float3\" ");
 		vsc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVelocityScaleX(float vsx)
 	{
 		if(vsx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vsc.vsx\" %f;\n", vsx);
+		writeFloat(mFile,"\tsetAttr \".vsc.vsx\" ",vsx,";\n");
 	}
 	void setVelocityScaleY(float vsy)
 	{
 		if(vsy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vsc.vsy\" %f;\n", vsy);
+		writeFloat(mFile,"\tsetAttr \".vsc.vsy\" ",vsy,";\n");
 	}
 	void setVelocityScaleZ(float vsz)
 	{
 		if(vsz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vsc.vsz\" %f;\n", vsz);
+		writeFloat(mFile,"\tsetAttr \".vsc.vsz\" ",vsz,";\n");
 	}
 	void setViscosity(float viy)
 	{
 		if(viy == 0) return;
-		fprintf(mFile,"\tsetAttr \".viy\" %f;\n", viy);
+		writeFloat(mFile,"\tsetAttr \".viy\" ",viy,";\n");
 	}
 	void setFriction(float fri)
 	{
 		if(fri == 0) return;
-		fprintf(mFile,"\tsetAttr \".fri\" %f;\n", fri);
+		writeFloat(mFile,"\tsetAttr \".fri\" ",fri,";\n");
 	}
 	void setVelocitySwirl(float vsw)
 	{
 		if(vsw == 0) return;
-		fprintf(mFile,"\tsetAttr \".vsw\" %f;\n", vsw);
+		writeFloat(mFile,"\tsetAttr \".vsw\" ",vsw,";\n");
 	}
 	void setVelocityDamp(float vdp)
 	{
 		if(vdp == 0) return;
-		fprintf(mFile,"\tsetAttr \".vdp\" %f;\n", vdp);
+		writeFloat(mFile,"\tsetAttr \".vdp\" ",vdp,";\n");
 	}
 	void setVelocityAdvect(bool va)
 	{
 		if(va == true) return;
-		fprintf(mFile,"\tsetAttr \".va\" %i;\n", va);
+		writeInt(mFile,"\tsetAttr \".va\" ",va,";\n");
 	}
 	void setVelocityProject(bool vi)
 	{
 		if(vi == true) return;
-		fprintf(mFile,"\tsetAttr \".vi\" %i;\n", vi);
+		writeInt(mFile,"\tsetAttr \".vi\" ",vi,";\n");
 	}
 	void setTurbulenceStrength(float tst)
 	{
 		if(tst == 0) return;
-		fprintf(mFile,"\tsetAttr \".tst\" %f;\n", tst);
+		writeFloat(mFile,"\tsetAttr \".tst\" ",tst,";\n");
 	}
 	void setTurbulenceFrequency(float tfr)
 	{
 		if(tfr == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".tfr\" %f;\n", tfr);
+		writeFloat(mFile,"\tsetAttr \".tfr\" ",tfr,";\n");
 	}
 	void setTurbulenceSpeed(float tbs)
 	{
 		if(tbs == .2) return;
-		fprintf(mFile,"\tsetAttr \".tbs\" %f;\n", tbs);
+		writeFloat(mFile,"\tsetAttr \".tbs\" ",tbs,";\n");
 	}
 	void setTurbulenceRes(int trs)
 	{
 		if(trs == 10) return;
-		fprintf(mFile,"\tsetAttr \".trs\" %i;\n", trs);
+		writeInt(mFile,"\tsetAttr \".trs\" ",trs,";\n");
 	}
 	void setTemperatureMethod(unsigned int tmet)
 	{
 		if(tmet == 0) return;
-		fprintf(mFile,"\tsetAttr \".tmet\" %i;\n", tmet);
+		writeInt(mFile,"\tsetAttr \".tmet\" ",tmet,";\n");
 	}
 	void setTemperatureGradient(unsigned int tgr)
 	{
 		if(tgr == 0) return;
-		fprintf(mFile,"\tsetAttr \".tgr\" %i;\n", tgr);
+		writeInt(mFile,"\tsetAttr \".tgr\" ",tgr,";\n");
 	}
 	void setTemperatureScale(float tmsc)
 	{
 		if(tmsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tmsc\" %f;\n", tmsc);
+		writeFloat(mFile,"\tsetAttr \".tmsc\" ",tmsc,";\n");
 	}
 	void setTemperatureDissipation(double tds)
 	{
 		if(tds == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".tds\" %f;\n", tds);
+		writeFloat(mFile,"\tsetAttr \".tds\" ",tds,";\n");
 	}
 	void setTemperatureDiffusion(double tdf)
 	{
 		if(tdf == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".tdf\" %f;\n", tdf);
+		writeFloat(mFile,"\tsetAttr \".tdf\" ",tdf,";\n");
 	}
 	void setTemperatureTurbulence(float ttb)
 	{
 		if(ttb == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".ttb\" %f;\n", ttb);
+		writeFloat(mFile,"\tsetAttr \".ttb\" ",ttb,";\n");
 	}
 	void setBuoyancy(float buo)
 	{
 		if(buo == 3) return;
-		fprintf(mFile,"\tsetAttr \".buo\" %f;\n", buo);
+		writeFloat(mFile,"\tsetAttr \".buo\" ",buo,";\n");
 	}
 	void setColorMethod(unsigned int cmt)
 	{
 		if(cmt == 0) return;
-		fprintf(mFile,"\tsetAttr \".cmt\" %i;\n", cmt);
+		writeInt(mFile,"\tsetAttr \".cmt\" ",cmt,";\n");
 	}
 	void setColorDissipation(double cds)
 	{
 		if(cds == 0) return;
-		fprintf(mFile,"\tsetAttr \".cds\" %f;\n", cds);
+		writeFloat(mFile,"\tsetAttr \".cds\" ",cds,";\n");
 	}
 	void setColorDiffusion(double cdf)
 	{
 		if(cdf == 0) return;
-		fprintf(mFile,"\tsetAttr \".cdf\" %f;\n", cdf);
+		writeFloat(mFile,"\tsetAttr \".cdf\" ",cdf,";\n");
 	}
 	void setFuelMethod(unsigned int fmet)
 	{
 		if(fmet == 0) return;
-		fprintf(mFile,"\tsetAttr \".fmet\" %i;\n", fmet);
+		writeInt(mFile,"\tsetAttr \".fmet\" ",fmet,";\n");
 	}
 	void setFuelGradient(unsigned int fgr)
 	{
 		if(fgr == 0) return;
-		fprintf(mFile,"\tsetAttr \".fgr\" %i;\n", fgr);
+		writeInt(mFile,"\tsetAttr \".fgr\" ",fgr,";\n");
 	}
 	void setFuelScale(float fesc)
 	{
 		if(fesc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fesc\" %f;\n", fesc);
+		writeFloat(mFile,"\tsetAttr \".fesc\" ",fesc,";\n");
 	}
 	void setReactionSpeed(float resp)
 	{
 		if(resp == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".resp\" %f;\n", resp);
+		writeFloat(mFile,"\tsetAttr \".resp\" ",resp,";\n");
 	}
 	void setFuelIgnitionTemp(float fuit)
 	{
 		if(fuit == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fuit\" %f;\n", fuit);
+		writeFloat(mFile,"\tsetAttr \".fuit\" ",fuit,";\n");
 	}
 	void setMaxReactionTemp(float mxrt)
 	{
 		if(mxrt == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mxrt\" %f;\n", mxrt);
+		writeFloat(mFile,"\tsetAttr \".mxrt\" ",mxrt,";\n");
 	}
 	void setHeatReleased(float hre)
 	{
 		if(hre == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hre\" %f;\n", hre);
+		writeFloat(mFile,"\tsetAttr \".hre\" ",hre,";\n");
 	}
 	void setLightReleased(float lre)
 	{
 		if(lre == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lre\" %f;\n", lre);
+		writeFloat(mFile,"\tsetAttr \".lre\" ",lre,";\n");
 	}
 	void setLightColor(const float3& lco)
 	{
-		fprintf(mFile,"\tsetAttr \".lco\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lco\" -type \"float3\" ");
 		lco.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLightColorR(float lcor)
 	{
 		if(lcor == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lco.lcor\" %f;\n", lcor);
+		writeFloat(mFile,"\tsetAttr \".lco.lcor\" ",lcor,";\n");
 	}
 	void setLightColorG(float lcog)
 	{
 		if(lcog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lco.lcog\" %f;\n", lcog);
+		writeFloat(mFile,"\tsetAttr \".lco.lcog\" ",lcog,";\n");
 	}
 	void setLightColorB(float lcob)
 	{
 		if(lcob == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lco.lcob\" %f;\n", lcob);
+		writeFloat(mFile,"\tsetAttr \".lco.lcob\" ",lcob,";\n");
 	}
 	void setUsePre70Dynamics(bool updy)
 	{
 		if(updy == false) return;
-		fprintf(mFile,"\tsetAttr \".updy\" %i;\n", updy);
+		writeInt(mFile,"\tsetAttr \".updy\" ",updy,";\n");
 	}
 	void setInputData(size_t ind_i,const InputData& ind)
 	{
-		fprintf(mFile,"\tsetAttr \".ind[%i]\" ",ind_i);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i,"]\" ");
 		ind.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputData(size_t ind_start,size_t ind_end,InputData* ind)
 	{
-		fprintf(mFile,"\tsetAttr \".ind[%i:%i]\" ", ind_start,ind_end);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_start); writeInt(mFile,":",ind_end,"]\" ");
 		size_t size = (ind_end-ind_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ind[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputData(size_t ind_start,size_t ind_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ind[%i:%i]\"",ind_start,ind_end);
-		fprintf(mFile," -type \"InputData\" ");
+		writeInt(mFile,"\tsetAttr \".ind[",ind_start); writeInt(mFile,":",ind_end,"]\"");
+		writeString(mFile," -type \"InputData\" ");
 	}
 	void appendInputData(const InputData& ind)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ind.write(mFile);
 	}
 	void endInputData()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputPositions(size_t ind_i,const vectorArray& inp)
 	{
 		if(inp.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ind[%i].inp\" -type \"vectorArray\" ",ind_i);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i,"].inp\" -type \"vectorArray\" ");
 		inp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputVelocities(size_t ind_i,const vectorArray& inv)
 	{
 		if(inv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ind[%i].inv\" -type \"vectorArray\" ",ind_i);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i,"].inv\" -type \"vectorArray\" ");
 		inv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputMass(size_t ind_i,const doubleArray& inm)
 	{
 		if(inm.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ind[%i].inm\" -type \"doubleArray\" ",ind_i);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i,"].inm\" -type \"doubleArray\" ");
 		inm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDeltaTime(size_t ind_i,double dt)
 	{
 		if(dt == 0) return;
-		fprintf(mFile,"\tsetAttr \".ind[%i].dt\" %f;\n", ind_i,dt);
+		writeInt(mFile,"\tsetAttr \".ind[",ind_i); writeFloat(mFile,"].dt\" ",dt,";\n");
 	}
 	void setMatteOpacityMode(unsigned int mom)
 	{
 		if(mom == 2) return;
-		fprintf(mFile,"\tsetAttr \".mom\" %i;\n", mom);
+		writeInt(mFile,"\tsetAttr \".mom\" ",mom,";\n");
 	}
 	void setMatteOpacity(float mog)
 	{
 		if(mog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mog\" %f;\n", mog);
+		writeFloat(mFile,"\tsetAttr \".mog\" ",mog,";\n");
 	}
 	void setSelfShadowing(bool ss)
 	{
 		if(ss == false) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %i;\n", ss);
+		writeInt(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setQuality(float qua)
 	{
 		if(qua == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".qua\" %f;\n", qua);
+		writeFloat(mFile,"\tsetAttr \".qua\" ",qua,";\n");
 	}
 	void setRenderInterpolator(unsigned int rin)
 	{
 		if(rin == 0) return;
-		fprintf(mFile,"\tsetAttr \".rin\" %i;\n", rin);
+		writeInt(mFile,"\tsetAttr \".rin\" ",rin,";\n");
 	}
 	void setColor(size_t cl_i,const Color& cl)
 	{
-		fprintf(mFile,"\tsetAttr \".cl[%i]\" ",cl_i);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i,"]\" ");
 		cl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor(size_t cl_start,size_t cl_end,Color* cl)
 	{
-		fprintf(mFile,"\tsetAttr \".cl[%i:%i]\" ", cl_start,cl_end);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_start); writeInt(mFile,":",cl_end,"]\" ");
 		size_t size = (cl_end-cl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColor(size_t cl_start,size_t cl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cl[%i:%i]\"",cl_start,cl_end);
-		fprintf(mFile," -type \"Color\" ");
+		writeInt(mFile,"\tsetAttr \".cl[",cl_start); writeInt(mFile,":",cl_end,"]\"");
+		writeString(mFile," -type \"Color\" ");
 	}
 	void appendColor(const Color& cl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cl.write(mFile);
 	}
 	void endColor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor_Position(size_t cl_i,float clp)
 	{
 		if(clp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].clp\" %f;\n", cl_i,clp);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeFloat(mFile,"].clp\" ",clp,";\n");
 	}
 	void setColor_Color(size_t cl_i,const float3& clc)
 	{
-		fprintf(mFile,"\tsetAttr \".cl[%i].clc\" -type \"float3\" ",cl_i);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i,"].clc\" -type \"float3\" ");
 		clc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor_ColorR(size_t cl_i,float clcr)
 	{
 		if(clcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].clc.clcr\" %f;\n", cl_i,clcr);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeFloat(mFile,"].clc.clcr\" ",clcr,";\n");
 	}
 	void setColor_ColorG(size_t cl_i,float clcg)
 	{
 		if(clcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].clc.clcg\" %f;\n", cl_i,clcg);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeFloat(mFile,"].clc.clcg\" ",clcg,";\n");
 	}
 	void setColor_ColorB(size_t cl_i,float clcb)
 	{
 		if(clcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].clc.clcb\" %f;\n", cl_i,clcb);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeFloat(mFile,"].clc.clcb\" ",clcb,";\n");
 	}
 	void setColor_Interp(size_t cl_i,unsigned int cli)
 	{
 		if(cli == 0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].cli\" %i;\n", cl_i,cli);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeInt(mFile,"].cli\" ",cli,";\n");
 	}
 	void setColorInput(unsigned int coi)
 	{
 		if(coi == 0) return;
-		fprintf(mFile,"\tsetAttr \".coi\" %i;\n", coi);
+		writeInt(mFile,"\tsetAttr \".coi\" ",coi,";\n");
 	}
 	void setColorInputBias(float cib)
 	{
 		if(cib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cib\" %f;\n", cib);
+		writeFloat(mFile,"\tsetAttr \".cib\" ",cib,";\n");
 	}
 	void setOpacity(size_t opa_i,const Opacity& opa)
 	{
-		fprintf(mFile,"\tsetAttr \".opa[%i]\" ",opa_i);
+		writeInt(mFile,"\tsetAttr \".opa[",opa_i,"]\" ");
 		opa.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOpacity(size_t opa_start,size_t opa_end,Opacity* opa)
 	{
-		fprintf(mFile,"\tsetAttr \".opa[%i:%i]\" ", opa_start,opa_end);
+		writeInt(mFile,"\tsetAttr \".opa[",opa_start); writeInt(mFile,":",opa_end,"]\" ");
 		size_t size = (opa_end-opa_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			opa[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startOpacity(size_t opa_start,size_t opa_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".opa[%i:%i]\"",opa_start,opa_end);
-		fprintf(mFile," -type \"Opacity\" ");
+		writeInt(mFile,"\tsetAttr \".opa[",opa_start); writeInt(mFile,":",opa_end,"]\"");
+		writeString(mFile," -type \"Opacity\" ");
 	}
 	void appendOpacity(const Opacity& opa)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		opa.write(mFile);
 	}
 	void endOpacity()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOpacity_Position(size_t opa_i,float opap)
 	{
 		if(opap == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".opa[%i].opap\" %f;\n", opa_i,opap);
+		writeInt(mFile,"\tsetAttr \".opa[",opa_i); writeFloat(mFile,"].opap\" ",opap,";\n");
 	}
 	void setOpacity_FloatValue(size_t opa_i,float opafv)
 	{
 		if(opafv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".opa[%i].opafv\" %f;\n", opa_i,opafv);
+		writeInt(mFile,"\tsetAttr \".opa[",opa_i); writeFloat(mFile,"].opafv\" ",opafv,";\n");
 	}
 	void setOpacity_Interp(size_t opa_i,unsigned int opai)
 	{
 		if(opai == 0) return;
-		fprintf(mFile,"\tsetAttr \".opa[%i].opai\" %i;\n", opa_i,opai);
+		writeInt(mFile,"\tsetAttr \".opa[",opa_i); writeInt(mFile,"].opai\" ",opai,";\n");
 	}
 	void setOpacityInput(unsigned int opi)
 	{
 		if(opi == 5) return;
-		fprintf(mFile,"\tsetAttr \".opi\" %i;\n", opi);
+		writeInt(mFile,"\tsetAttr \".opi\" ",opi,";\n");
 	}
 	void setOpacityInputBias(float oib)
 	{
 		if(oib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oib\" %f;\n", oib);
+		writeFloat(mFile,"\tsetAttr \".oib\" ",oib,";\n");
 	}
 	void setTransparency(const float3& t)
 	{
-		fprintf(mFile,"\tsetAttr \".t\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"float3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparencyR(float tr)
 	{
 		if(tr == 0.25) return;
-		fprintf(mFile,"\tsetAttr \".t.tr\" %f;\n", tr);
+		writeFloat(mFile,"\tsetAttr \".t.tr\" ",tr,";\n");
 	}
 	void setTransparencyG(float tg)
 	{
 		if(tg == 0.25) return;
-		fprintf(mFile,"\tsetAttr \".t.tg\" %f;\n", tg);
+		writeFloat(mFile,"\tsetAttr \".t.tg\" ",tg,";\n");
 	}
 	void setTransparencyB(float tb)
 	{
 		if(tb == 0.25) return;
-		fprintf(mFile,"\tsetAttr \".t.tb\" %f;\n", tb);
+		writeFloat(mFile,"\tsetAttr \".t.tb\" ",tb,";\n");
 	}
 	void setShadowOpacity(float shp)
 	{
 		if(shp == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".shp\" %f;\n", shp);
+		writeFloat(mFile,"\tsetAttr \".shp\" ",shp,";\n");
 	}
 	void setIncandescence(size_t i_i,const Incandescence& i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i]\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"]\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescence(size_t i_start,size_t i_end,Incandescence* i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\" ");
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			i_[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startIncandescence(size_t i_start,size_t i_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\"",i_start,i_end);
-		fprintf(mFile," -type \"Incandescence\" ");
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\"");
+		writeString(mFile," -type \"Incandescence\" ");
 	}
 	void appendIncandescence(const Incandescence& i)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		i.write(mFile);
 	}
 	void endIncandescence()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescence_Position(size_t i_i,float ip)
 	{
 		if(ip == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].ip\" %f;\n", i_i,ip);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].ip\" ",ip,";\n");
 	}
 	void setIncandescence_Color(size_t i_i,const float3& ic)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i].ic\" -type \"float3\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"].ic\" -type \"float3\" ");
 		ic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescence_ColorR(size_t i_i,float icr)
 	{
 		if(icr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].ic.icr\" %f;\n", i_i,icr);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].ic.icr\" ",icr,";\n");
 	}
 	void setIncandescence_ColorG(size_t i_i,float icg)
 	{
 		if(icg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].ic.icg\" %f;\n", i_i,icg);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].ic.icg\" ",icg,";\n");
 	}
 	void setIncandescence_ColorB(size_t i_i,float icb)
 	{
 		if(icb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].ic.icb\" %f;\n", i_i,icb);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].ic.icb\" ",icb,";\n");
 	}
 	void setIncandescence_Interp(size_t i_i,unsigned int ii)
 	{
 		if(ii == 0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].ii\" %i;\n", i_i,ii);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeInt(mFile,"].ii\" ",ii,";\n");
 	}
 	void setIncandescenceInput(unsigned int ili)
 	{
 		if(ili == 6) return;
-		fprintf(mFile,"\tsetAttr \".ili\" %i;\n", ili);
+		writeInt(mFile,"\tsetAttr \".ili\" ",ili,";\n");
 	}
 	void setIncandescenceInputBias(float iib)
 	{
 		if(iib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".iib\" %f;\n", iib);
+		writeFloat(mFile,"\tsetAttr \".iib\" ",iib,";\n");
 	}
 	void setGlowIntensity(float gi)
 	{
 		if(gi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %f;\n", gi);
+		writeFloat(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void setSpecularColor(const float3& spc)
 	{
-		fprintf(mFile,"\tsetAttr \".spc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".spc\" -type \"float3\" ");
 		spc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColorR(float spr)
 	{
 		if(spr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spc.spr\" %f;\n", spr);
+		writeFloat(mFile,"\tsetAttr \".spc.spr\" ",spr,";\n");
 	}
 	void setSpecularColorG(float spg)
 	{
 		if(spg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spc.spg\" %f;\n", spg);
+		writeFloat(mFile,"\tsetAttr \".spc.spg\" ",spg,";\n");
 	}
 	void setSpecularColorB(float spb)
 	{
 		if(spb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spc.spb\" %f;\n", spb);
+		writeFloat(mFile,"\tsetAttr \".spc.spb\" ",spb,";\n");
 	}
 	void setCosinePower(float csp)
 	{
 		if(csp == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".csp\" %f;\n", csp);
+		writeFloat(mFile,"\tsetAttr \".csp\" ",csp,";\n");
 	}
 	void setEnvironment(size_t env_i,const Environment& env)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i]\" ",env_i);
+		writeInt(mFile,"\tsetAttr \".env[",env_i,"]\" ");
 		env.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment(size_t env_start,size_t env_end,Environment* env)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i:%i]\" ", env_start,env_end);
+		writeInt(mFile,"\tsetAttr \".env[",env_start); writeInt(mFile,":",env_end,"]\" ");
 		size_t size = (env_end-env_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			env[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEnvironment(size_t env_start,size_t env_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i:%i]\"",env_start,env_end);
-		fprintf(mFile," -type \"Environment\" ");
+		writeInt(mFile,"\tsetAttr \".env[",env_start); writeInt(mFile,":",env_end,"]\"");
+		writeString(mFile," -type \"Environment\" ");
 	}
 	void appendEnvironment(const Environment& env)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		env.write(mFile);
 	}
 	void endEnvironment()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment_Position(size_t env_i,float envp)
 	{
 		if(envp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envp\" %f;\n", env_i,envp);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envp\" ",envp,";\n");
 	}
 	void setEnvironment_Color(size_t env_i,const float3& envc)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i].envc\" -type \"float3\" ",env_i);
+		writeInt(mFile,"\tsetAttr \".env[",env_i,"].envc\" -type \"float3\" ");
 		envc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment_ColorR(size_t env_i,float envcr)
 	{
 		if(envcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcr\" %f;\n", env_i,envcr);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcr\" ",envcr,";\n");
 	}
 	void setEnvironment_ColorG(size_t env_i,float envcg)
 	{
 		if(envcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcg\" %f;\n", env_i,envcg);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcg\" ",envcg,";\n");
 	}
 	void setEnvironment_ColorB(size_t env_i,float envcb)
 	{
 		if(envcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcb\" %f;\n", env_i,envcb);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcb\" ",envcb,";\n");
 	}
 	void setEnvironment_Interp(size_t env_i,unsigned int envi)
 	{
 		if(envi == 0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envi\" %i;\n", env_i,envi);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeInt(mFile,"].envi\" ",envi,";\n");
 	}
 	void setDropoffShape(unsigned int dos)
 	{
 		if(dos == 2) return;
-		fprintf(mFile,"\tsetAttr \".dos\" %i;\n", dos);
+		writeInt(mFile,"\tsetAttr \".dos\" ",dos,";\n");
 	}
 	void setEdgeDropoff(float edr)
 	{
 		if(edr == .05) return;
-		fprintf(mFile,"\tsetAttr \".edr\" %f;\n", edr);
+		writeFloat(mFile,"\tsetAttr \".edr\" ",edr,";\n");
 	}
 	void setContrastTolerance(float ctl)
 	{
 		if(ctl == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".ctl\" %f;\n", ctl);
+		writeFloat(mFile,"\tsetAttr \".ctl\" ",ctl,";\n");
 	}
 	void setHeightField(bool hfld)
 	{
 		if(hfld == false) return;
-		fprintf(mFile,"\tsetAttr \".hfld\" %i;\n", hfld);
+		writeInt(mFile,"\tsetAttr \".hfld\" ",hfld,";\n");
 	}
 	void setSurfaceRender(bool srr)
 	{
 		if(srr == false) return;
-		fprintf(mFile,"\tsetAttr \".srr\" %i;\n", srr);
+		writeInt(mFile,"\tsetAttr \".srr\" ",srr,";\n");
 	}
 	void setSurfaceThreshold(float srt)
 	{
 		if(srt == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".srt\" %f;\n", srt);
+		writeFloat(mFile,"\tsetAttr \".srt\" ",srt,";\n");
 	}
 	void setSurfaceTolerance(float stl)
 	{
 		if(stl == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".stl\" %f;\n", stl);
+		writeFloat(mFile,"\tsetAttr \".stl\" ",stl,";\n");
 	}
 	void setSoftSurface(bool ssf)
 	{
 		if(ssf == false) return;
-		fprintf(mFile,"\tsetAttr \".ssf\" %i;\n", ssf);
+		writeInt(mFile,"\tsetAttr \".ssf\" ",ssf,";\n");
 	}
 	void setRefractiveIndex(float rei)
 	{
 		if(rei == 1.8) return;
-		fprintf(mFile,"\tsetAttr \".rei\" %f;\n", rei);
+		writeFloat(mFile,"\tsetAttr \".rei\" ",rei,";\n");
 	}
 	void setSampleMethod(unsigned int smpm)
 	{
 		if(smpm == 3) return;
-		fprintf(mFile,"\tsetAttr \".smpm\" %i;\n", smpm);
+		writeInt(mFile,"\tsetAttr \".smpm\" ",smpm,";\n");
 	}
 	void setRealLights(bool rl)
 	{
 		if(rl == true) return;
-		fprintf(mFile,"\tsetAttr \".rl\" %i;\n", rl);
+		writeInt(mFile,"\tsetAttr \".rl\" ",rl,";\n");
 	}
 	void setDirectionalLight(const float3& dl)
 	{
-		fprintf(mFile,"\tsetAttr \".dl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dl\" -type \"float3\" ");
 		dl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionalLightX(float dlx)
 	{
 		if(dlx == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dl.dlx\" %f;\n", dlx);
+		writeFloat(mFile,"\tsetAttr \".dl.dlx\" ",dlx,";\n");
 	}
 	void setDirectionalLightY(float dly)
 	{
 		if(dly == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".dl.dly\" %f;\n", dly);
+		writeFloat(mFile,"\tsetAttr \".dl.dly\" ",dly,";\n");
 	}
 	void setDirectionalLightZ(float dlz)
 	{
 		if(dlz == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dl.dlz\" %f;\n", dlz);
+		writeFloat(mFile,"\tsetAttr \".dl.dlz\" ",dlz,";\n");
 	}
 	void setTextureType(unsigned int tty)
 	{
 		if(tty == 0) return;
-		fprintf(mFile,"\tsetAttr \".tty\" %i;\n", tty);
+		writeInt(mFile,"\tsetAttr \".tty\" ",tty,";\n");
 	}
 	void setColorTexture(bool ctx)
 	{
 		if(ctx == false) return;
-		fprintf(mFile,"\tsetAttr \".ctx\" %i;\n", ctx);
+		writeInt(mFile,"\tsetAttr \".ctx\" ",ctx,";\n");
 	}
 	void setColorTexGain(float ctxg)
 	{
 		if(ctxg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ctxg\" %f;\n", ctxg);
+		writeFloat(mFile,"\tsetAttr \".ctxg\" ",ctxg,";\n");
 	}
 	void setIncandTexture(bool itx)
 	{
 		if(itx == false) return;
-		fprintf(mFile,"\tsetAttr \".itx\" %i;\n", itx);
+		writeInt(mFile,"\tsetAttr \".itx\" ",itx,";\n");
 	}
 	void setIncandTexGain(float itxg)
 	{
 		if(itxg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".itxg\" %f;\n", itxg);
+		writeFloat(mFile,"\tsetAttr \".itxg\" ",itxg,";\n");
 	}
 	void setOpacityTexture(bool otx)
 	{
 		if(otx == false) return;
-		fprintf(mFile,"\tsetAttr \".otx\" %i;\n", otx);
+		writeInt(mFile,"\tsetAttr \".otx\" ",otx,";\n");
 	}
 	void setOpacityTexGain(float otxg)
 	{
 		if(otxg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".otxg\" %f;\n", otxg);
+		writeFloat(mFile,"\tsetAttr \".otxg\" ",otxg,";\n");
 	}
 	void setInvertTexture(bool ivt)
 	{
 		if(ivt == false) return;
-		fprintf(mFile,"\tsetAttr \".ivt\" %i;\n", ivt);
+		writeInt(mFile,"\tsetAttr \".ivt\" ",ivt,";\n");
 	}
 	void setAmplitude(float a)
 	{
 		if(a == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void setTextureScale(const float3& txsc)
 	{
 		if(txsc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".txsc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".txsc\" -type \"float3\" ");
 		txsc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTextureScaleX(float tscx)
 	{
 		if(tscx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".txsc.tscx\" %f;\n", tscx);
+		writeFloat(mFile,"\tsetAttr \".txsc.tscx\" ",tscx,";\n");
 	}
 	void setTextureScaleY(float tscy)
 	{
 		if(tscy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".txsc.tscy\" %f;\n", tscy);
+		writeFloat(mFile,"\tsetAttr \".txsc.tscy\" ",tscy,";\n");
 	}
 	void setTextureScaleZ(float tscz)
 	{
 		if(tscz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".txsc.tscz\" %f;\n", tscz);
+		writeFloat(mFile,"\tsetAttr \".txsc.tscz\" ",tscz,";\n");
 	}
 	void setTextureOrigin(const float3& tor)
 	{
 		if(tor == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".tor\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".tor\" -type \"float3\" ");
 		tor.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTextureOriginX(float torx)
 	{
 		if(torx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tor.torx\" %f;\n", torx);
+		writeFloat(mFile,"\tsetAttr \".tor.torx\" ",torx,";\n");
 	}
 	void setTextureOriginY(float tory)
 	{
 		if(tory == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tor.tory\" %f;\n", tory);
+		writeFloat(mFile,"\tsetAttr \".tor.tory\" ",tory,";\n");
 	}
 	void setTextureOriginZ(float torz)
 	{
 		if(torz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tor.torz\" %f;\n", torz);
+		writeFloat(mFile,"\tsetAttr \".tor.torz\" ",torz,";\n");
 	}
 	void setDepthMax(short dm)
 	{
 		if(dm == 2) return;
-		fprintf(mFile,"\tsetAttr \".dm\" %i;\n", dm);
+		writeInt(mFile,"\tsetAttr \".dm\" ",dm,";\n");
 	}
 	void setFrequency(float fq)
 	{
 		if(fq == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fq\" %f;\n", fq);
+		writeFloat(mFile,"\tsetAttr \".fq\" ",fq,";\n");
 	}
 	void setFrequencyRatio(float fr)
 	{
 		if(fr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setInflection(bool in)
 	{
 		if(in == false) return;
-		fprintf(mFile,"\tsetAttr \".in\" %i;\n", in);
+		writeInt(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setTextureTime(float tti)
 	{
 		if(tti == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tti\" %f;\n", tti);
+		writeFloat(mFile,"\tsetAttr \".tti\" ",tti,";\n");
 	}
 	void setBillowDensity(float bd)
 	{
 		if(bd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bd\" %f;\n", bd);
+		writeFloat(mFile,"\tsetAttr \".bd\" ",bd,";\n");
 	}
 	void setSpottyness(float sp)
 	{
 		if(sp == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".sp\" %f;\n", sp);
+		writeFloat(mFile,"\tsetAttr \".sp\" ",sp,";\n");
 	}
 	void setSizeRand(float sr)
 	{
 		if(sr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setRandomness(float rnd)
 	{
 		if(rnd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rnd\" %f;\n", rnd);
+		writeFloat(mFile,"\tsetAttr \".rnd\" ",rnd,";\n");
 	}
 	void setFalloff(unsigned int falo)
 	{
 		if(falo == 2) return;
-		fprintf(mFile,"\tsetAttr \".falo\" %i;\n", falo);
+		writeInt(mFile,"\tsetAttr \".falo\" ",falo,";\n");
 	}
 	void setNumWaves(short nw)
 	{
 		if(nw == 5) return;
-		fprintf(mFile,"\tsetAttr \".nw\" %i;\n", nw);
+		writeInt(mFile,"\tsetAttr \".nw\" ",nw,";\n");
 	}
 	void setImplode(float imp)
 	{
 		if(imp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imp\" %f;\n", imp);
+		writeFloat(mFile,"\tsetAttr \".imp\" ",imp,";\n");
 	}
 	void setImplodeCenter(const float3& imc)
 	{
 		if(imc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".imc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".imc\" -type \"float3\" ");
 		imc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImplodeCenterX(float imx)
 	{
 		if(imx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imc.imx\" %f;\n", imx);
+		writeFloat(mFile,"\tsetAttr \".imc.imx\" ",imx,";\n");
 	}
 	void setImplodeCenterY(float imy)
 	{
 		if(imy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imc.imy\" %f;\n", imy);
+		writeFloat(mFile,"\tsetAttr \".imc.imy\" ",imy,";\n");
 	}
 	void setImplodeCenterZ(float imz)
 	{
 		if(imz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imc.imz\" %f;\n", imz);
+		writeFloat(mFile,"\tsetAttr \".imc.imz\" ",imz,";\n");
 	}
 	void setCacheDensity(bool cdns)
 	{
 		if(cdns == true) return;
-		fprintf(mFile,"\tsetAttr \".cdns\" %i;\n", cdns);
+		writeInt(mFile,"\tsetAttr \".cdns\" ",cdns,";\n");
 	}
 	void setLoadDensity(bool ldns)
 	{
 		if(ldns == true) return;
-		fprintf(mFile,"\tsetAttr \".ldns\" %i;\n", ldns);
+		writeInt(mFile,"\tsetAttr \".ldns\" ",ldns,";\n");
 	}
 	void setCacheVelocity(bool cvel)
 	{
 		if(cvel == true) return;
-		fprintf(mFile,"\tsetAttr \".cvel\" %i;\n", cvel);
+		writeInt(mFile,"\tsetAttr \".cvel\" ",cvel,";\n");
 	}
 	void setLoadVelocity(bool lvel)
 	{
 		if(lvel == true) return;
-		fprintf(mFile,"\tsetAttr \".lvel\" %i;\n", lvel);
+		writeInt(mFile,"\tsetAttr \".lvel\" ",lvel,";\n");
 	}
 	void setCacheTemperature(bool ctmp)
 	{
 		if(ctmp == true) return;
-		fprintf(mFile,"\tsetAttr \".ctmp\" %i;\n", ctmp);
+		writeInt(mFile,"\tsetAttr \".ctmp\" ",ctmp,";\n");
 	}
 	void setLoadTemperature(bool ltmp)
 	{
 		if(ltmp == true) return;
-		fprintf(mFile,"\tsetAttr \".ltmp\" %i;\n", ltmp);
+		writeInt(mFile,"\tsetAttr \".ltmp\" ",ltmp,";\n");
 	}
 	void setCacheColor(bool ccol)
 	{
 		if(ccol == true) return;
-		fprintf(mFile,"\tsetAttr \".ccol\" %i;\n", ccol);
+		writeInt(mFile,"\tsetAttr \".ccol\" ",ccol,";\n");
 	}
 	void setLoadColor(bool lcol)
 	{
 		if(lcol == true) return;
-		fprintf(mFile,"\tsetAttr \".lcol\" %i;\n", lcol);
+		writeInt(mFile,"\tsetAttr \".lcol\" ",lcol,";\n");
 	}
 	void setCacheReaction(bool crea)
 	{
 		if(crea == true) return;
-		fprintf(mFile,"\tsetAttr \".crea\" %i;\n", crea);
+		writeInt(mFile,"\tsetAttr \".crea\" ",crea,";\n");
 	}
 	void setLoadReaction(bool lrea)
 	{
 		if(lrea == true) return;
-		fprintf(mFile,"\tsetAttr \".lrea\" %i;\n", lrea);
+		writeInt(mFile,"\tsetAttr \".lrea\" ",lrea,";\n");
 	}
 	void setCacheTextureCoordinates(bool catc)
 	{
 		if(catc == true) return;
-		fprintf(mFile,"\tsetAttr \".catc\" %i;\n", catc);
+		writeInt(mFile,"\tsetAttr \".catc\" ",catc,";\n");
 	}
 	void setLoadTextureCoordinates(bool lotc)
 	{
 		if(lotc == true) return;
-		fprintf(mFile,"\tsetAttr \".lotc\" %i;\n", lotc);
+		writeInt(mFile,"\tsetAttr \".lotc\" ",lotc,";\n");
 	}
 	void setCacheFalloff(bool cfal)
 	{
 		if(cfal == true) return;
-		fprintf(mFile,"\tsetAttr \".cfal\" %i;\n", cfal);
+		writeInt(mFile,"\tsetAttr \".cfal\" ",cfal,";\n");
 	}
 	void setLoadFalloff(bool lfal)
 	{
 		if(lfal == true) return;
-		fprintf(mFile,"\tsetAttr \".lfal\" %i;\n", lfal);
+		writeInt(mFile,"\tsetAttr \".lfal\" ",lfal,";\n");
 	}
 	void setCollide(bool cld)
 	{
 		if(cld == true) return;
-		fprintf(mFile,"\tsetAttr \".cld\" %i;\n", cld);
+		writeInt(mFile,"\tsetAttr \".cld\" ",cld,";\n");
 	}
 	void setObjectType(char obt)
 	{
@@ -1749,1746 +1749,1746 @@ public:
 	void setSurfaceShaderDepth(float susd)
 	{
 		if(susd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".susd\" %f;\n", susd);
+		writeFloat(mFile,"\tsetAttr \".susd\" ",susd,";\n");
 	}
 	void setCoordinateSpeed(float csd)
 	{
 		if(csd == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".csd\" %f;\n", csd);
+		writeFloat(mFile,"\tsetAttr \".csd\" ",csd,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiOverrideCaustics(bool oca)
 	{
 		if(oca == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oca\" %i;\n", oca);
+		writeInt(mFile,"\tsetAttr \".mrc.oca\" ",oca,";\n");
 	}
 	void setMiCausticAccuracy(short caa)
 	{
 		if(caa == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.caa\" %i;\n", caa);
+		writeInt(mFile,"\tsetAttr \".mrc.caa\" ",caa,";\n");
 	}
 	void setMiCausticRadius(float car)
 	{
 		if(car == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.car\" %f;\n", car);
+		writeFloat(mFile,"\tsetAttr \".mrc.car\" ",car,";\n");
 	}
 	void setMiOverrideGlobalIllumination(bool ogi)
 	{
 		if(ogi == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ogi\" %i;\n", ogi);
+		writeInt(mFile,"\tsetAttr \".mrc.ogi\" ",ogi,";\n");
 	}
 	void setMiGlobillumAccuracy(short gia)
 	{
 		if(gia == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gia\" %i;\n", gia);
+		writeInt(mFile,"\tsetAttr \".mrc.gia\" ",gia,";\n");
 	}
 	void setMiGlobillumRadius(float gir)
 	{
 		if(gir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gir\" %f;\n", gir);
+		writeFloat(mFile,"\tsetAttr \".mrc.gir\" ",gir,";\n");
 	}
 	void setMiOverrideFinalGather(bool ofg)
 	{
 		if(ofg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ofg\" %i;\n", ofg);
+		writeInt(mFile,"\tsetAttr \".mrc.ofg\" ",ofg,";\n");
 	}
 	void setMiFinalGatherRays(int fry)
 	{
 		if(fry == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fry\" %i;\n", fry);
+		writeInt(mFile,"\tsetAttr \".mrc.fry\" ",fry,";\n");
 	}
 	void setMiFinalGatherMinRadius(float fmn)
 	{
 		if(fmn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmn\" %f;\n", fmn);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmn\" ",fmn,";\n");
 	}
 	void setMiFinalGatherMaxRadius(float fmx)
 	{
 		if(fmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmx\" %f;\n", fmx);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmx\" ",fmx,";\n");
 	}
 	void setMiFinalGatherFilter(short ffi)
 	{
 		if(ffi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ffi\" %i;\n", ffi);
+		writeInt(mFile,"\tsetAttr \".mrc.ffi\" ",ffi,";\n");
 	}
 	void setMiFinalGatherView(bool fgv)
 	{
 		if(fgv == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgv\" %i;\n", fgv);
+		writeInt(mFile,"\tsetAttr \".mrc.fgv\" ",fgv,";\n");
 	}
 	void setMiOverrideSamples(bool oos)
 	{
 		if(oos == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oos\" %i;\n", oos);
+		writeInt(mFile,"\tsetAttr \".mrc.oos\" ",oos,";\n");
 	}
 	void setMiMinSamples(short mins)
 	{
 		if(mins == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mins\" %i;\n", mins);
+		writeInt(mFile,"\tsetAttr \".mrc.mins\" ",mins,";\n");
 	}
 	void setMiMaxSamples(short maxs)
 	{
 		if(maxs == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.maxs\" %i;\n", maxs);
+		writeInt(mFile,"\tsetAttr \".mrc.maxs\" ",maxs,";\n");
 	}
 	void getOutGrid()const
 	{
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.cti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cti\"");
 	}
 	void getStartTime()const
 	{
-		fprintf(mFile,"\"%s.sti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sti\"");
 	}
 	void getStartFrame()const
 	{
-		fprintf(mFile,"\"%s.stf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stf\"");
 	}
 	void getDisableInteractiveEval()const
 	{
-		fprintf(mFile,"\"%s.die\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".die\"");
 	}
 	void getIs2d()const
 	{
-		fprintf(mFile,"\"%s.is2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is2\"");
 	}
 	void getResolution()const
 	{
-		fprintf(mFile,"\"%s.res\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res\"");
 	}
 	void getResolutionW()const
 	{
-		fprintf(mFile,"\"%s.res.rw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res.rw\"");
 	}
 	void getResolutionH()const
 	{
-		fprintf(mFile,"\"%s.res.rh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res.rh\"");
 	}
 	void getResolutionD()const
 	{
-		fprintf(mFile,"\"%s.res.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res.rd\"");
 	}
 	void getDimensions()const
 	{
-		fprintf(mFile,"\"%s.dim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dim\"");
 	}
 	void getDimensionsW()const
 	{
-		fprintf(mFile,"\"%s.dim.dw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dim.dw\"");
 	}
 	void getDimensionsH()const
 	{
-		fprintf(mFile,"\"%s.dim.dh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dim.dh\"");
 	}
 	void getDimensionsD()const
 	{
-		fprintf(mFile,"\"%s.dim.dd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dim.dd\"");
 	}
 	void getInitialConditions()const
 	{
-		fprintf(mFile,"\"%s.inc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inc\"");
 	}
 	void getDoFields()const
 	{
-		fprintf(mFile,"\"%s.dfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfr\"");
 	}
 	void getInputForce(size_t ifc_i)const
 	{
-		fprintf(mFile,"\"%s.ifc[%i]\"",mName.c_str(),ifc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ifc[",ifc_i,"]\"");
 	}
 	void getInputForce()const
 	{
 
-		fprintf(mFile,"\"%s.ifc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ifc\"");
 	}
 	void getFieldData()const
 	{
-		fprintf(mFile,"\"%s.fd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd\"");
 	}
 	void getFieldDataPosition()const
 	{
-		fprintf(mFile,"\"%s.fd.fdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdp\"");
 	}
 	void getFieldDataVelocity()const
 	{
-		fprintf(mFile,"\"%s.fd.fdv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdv\"");
 	}
 	void getFieldDataMass()const
 	{
-		fprintf(mFile,"\"%s.fd.fdm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdm\"");
 	}
 	void getFieldDataDeltaTime()const
 	{
-		fprintf(mFile,"\"%s.fd.fdt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdt\"");
 	}
 	void getFieldList(size_t fll_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i]\"",mName.c_str(),fll_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i,"]\"");
 	}
 	void getFieldList()const
 	{
 
-		fprintf(mFile,"\"%s.fll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fll\"");
 	}
 	void getFieldFunction(size_t fll_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i].frf\"",mName.c_str(),fll_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i,"].frf\"");
 	}
 	void getFieldFunction()const
 	{
 
-		fprintf(mFile,"\"%s.fll.frf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fll.frf\"");
 	}
 	void getFieldFunction_Raw(size_t fll_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i].frf.frfr\"",mName.c_str(),fll_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i,"].frf.frfr\"");
 	}
 	void getFieldFunction_Raw()const
 	{
 
-		fprintf(mFile,"\"%s.fll.frf.frfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fll.frf.frfr\"");
 	}
 	void getFieldFunction_Inmap(size_t fll_i,size_t frfi_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i].frf.frfi[%i]\"",mName.c_str(),fll_i,frfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i); writeInt(mFile,"].frf.frfi[",frfi_i,"]\"");
 	}
 	void getFieldFunction_Inmap(size_t frfi_i)const
 	{
 
-		fprintf(mFile,"\"%s.fll.frf.frfi[%i]\"",mName.c_str(),frfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll.frf.frfi[",frfi_i,"]\"");
 	}
 	void getFieldFunction_InmapTo(size_t fll_i,size_t frfi_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i].frf.frfi[%i].frfit\"",mName.c_str(),fll_i,frfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i); writeInt(mFile,"].frf.frfi[",frfi_i,"].frfit\"");
 	}
 	void getFieldFunction_InmapTo(size_t frfi_i)const
 	{
 
-		fprintf(mFile,"\"%s.fll.frf.frfi[%i].frfit\"",mName.c_str(),frfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll.frf.frfi[",frfi_i,"].frfit\"");
 	}
 	void getFieldFunction_InmapFrom(size_t fll_i,size_t frfi_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i].frf.frfi[%i].frfif\"",mName.c_str(),fll_i,frfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i); writeInt(mFile,"].frf.frfi[",frfi_i,"].frfif\"");
 	}
 	void getFieldFunction_InmapFrom(size_t frfi_i)const
 	{
 
-		fprintf(mFile,"\"%s.fll.frf.frfi[%i].frfif\"",mName.c_str(),frfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll.frf.frfi[",frfi_i,"].frfif\"");
 	}
 	void getFieldFunction_Outmap(size_t fll_i,size_t frfo_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i].frf.frfo[%i]\"",mName.c_str(),fll_i,frfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i); writeInt(mFile,"].frf.frfo[",frfo_i,"]\"");
 	}
 	void getFieldFunction_Outmap(size_t frfo_i)const
 	{
 
-		fprintf(mFile,"\"%s.fll.frf.frfo[%i]\"",mName.c_str(),frfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll.frf.frfo[",frfo_i,"]\"");
 	}
 	void getFieldFunction_OutmapTo(size_t fll_i,size_t frfo_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i].frf.frfo[%i].frfot\"",mName.c_str(),fll_i,frfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i); writeInt(mFile,"].frf.frfo[",frfo_i,"].frfot\"");
 	}
 	void getFieldFunction_OutmapTo(size_t frfo_i)const
 	{
 
-		fprintf(mFile,"\"%s.fll.frf.frfo[%i].frfot\"",mName.c_str(),frfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll.frf.frfo[",frfo_i,"].frfot\"");
 	}
 	void getFieldFunction_OutmapFrom(size_t fll_i,size_t frfo_i)const
 	{
-		fprintf(mFile,"\"%s.fll[%i].frf.frfo[%i].frfof\"",mName.c_str(),fll_i,frfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll[",fll_i); writeInt(mFile,"].frf.frfo[",frfo_i,"].frfof\"");
 	}
 	void getFieldFunction_OutmapFrom(size_t frfo_i)const
 	{
 
-		fprintf(mFile,"\"%s.fll.frf.frfo[%i].frfof\"",mName.c_str(),frfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fll.frf.frfo[",frfo_i,"].frfof\"");
 	}
 	void getDoEmission()const
 	{
-		fprintf(mFile,"\"%s.de\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".de\"");
 	}
 	void getIsFull()const
 	{
-		fprintf(mFile,"\"%s.ifl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ifl\"");
 	}
 	void getInheritFactor()const
 	{
-		fprintf(mFile,"\"%s.inh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inh\"");
 	}
 	void getSeed(size_t sd_i)const
 	{
-		fprintf(mFile,"\"%s.sd[%i]\"",mName.c_str(),sd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sd[",sd_i,"]\"");
 	}
 	void getSeed()const
 	{
 
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getFluidColorEmission(size_t fce_i)const
 	{
-		fprintf(mFile,"\"%s.fce[%i]\"",mName.c_str(),fce_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fce[",fce_i,"]\"");
 	}
 	void getFluidColorEmission()const
 	{
 
-		fprintf(mFile,"\"%s.fce\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fce\"");
 	}
 	void getFluidReactantEmission(size_t frm_i)const
 	{
-		fprintf(mFile,"\"%s.frm[%i]\"",mName.c_str(),frm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".frm[",frm_i,"]\"");
 	}
 	void getFluidReactantEmission()const
 	{
 
-		fprintf(mFile,"\"%s.frm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frm\"");
 	}
 	void getEmissionList(size_t eml_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i]\"",mName.c_str(),eml_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i,"]\"");
 	}
 	void getEmissionList()const
 	{
 
-		fprintf(mFile,"\"%s.eml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eml\"");
 	}
 	void getEmissionFunction(size_t eml_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i].emf\"",mName.c_str(),eml_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i,"].emf\"");
 	}
 	void getEmissionFunction()const
 	{
 
-		fprintf(mFile,"\"%s.eml.emf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eml.emf\"");
 	}
 	void getEmissionFunction_Raw(size_t eml_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i].emf.emfr\"",mName.c_str(),eml_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i,"].emf.emfr\"");
 	}
 	void getEmissionFunction_Raw()const
 	{
 
-		fprintf(mFile,"\"%s.eml.emf.emfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eml.emf.emfr\"");
 	}
 	void getEmissionFunction_Inmap(size_t eml_i,size_t emfi_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i].emf.emfi[%i]\"",mName.c_str(),eml_i,emfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i); writeInt(mFile,"].emf.emfi[",emfi_i,"]\"");
 	}
 	void getEmissionFunction_Inmap(size_t emfi_i)const
 	{
 
-		fprintf(mFile,"\"%s.eml.emf.emfi[%i]\"",mName.c_str(),emfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml.emf.emfi[",emfi_i,"]\"");
 	}
 	void getEmissionFunction_InmapTo(size_t eml_i,size_t emfi_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i].emf.emfi[%i].emfit\"",mName.c_str(),eml_i,emfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i); writeInt(mFile,"].emf.emfi[",emfi_i,"].emfit\"");
 	}
 	void getEmissionFunction_InmapTo(size_t emfi_i)const
 	{
 
-		fprintf(mFile,"\"%s.eml.emf.emfi[%i].emfit\"",mName.c_str(),emfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml.emf.emfi[",emfi_i,"].emfit\"");
 	}
 	void getEmissionFunction_InmapFrom(size_t eml_i,size_t emfi_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i].emf.emfi[%i].emfif\"",mName.c_str(),eml_i,emfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i); writeInt(mFile,"].emf.emfi[",emfi_i,"].emfif\"");
 	}
 	void getEmissionFunction_InmapFrom(size_t emfi_i)const
 	{
 
-		fprintf(mFile,"\"%s.eml.emf.emfi[%i].emfif\"",mName.c_str(),emfi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml.emf.emfi[",emfi_i,"].emfif\"");
 	}
 	void getEmissionFunction_Outmap(size_t eml_i,size_t emfo_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i].emf.emfo[%i]\"",mName.c_str(),eml_i,emfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i); writeInt(mFile,"].emf.emfo[",emfo_i,"]\"");
 	}
 	void getEmissionFunction_Outmap(size_t emfo_i)const
 	{
 
-		fprintf(mFile,"\"%s.eml.emf.emfo[%i]\"",mName.c_str(),emfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml.emf.emfo[",emfo_i,"]\"");
 	}
 	void getEmissionFunction_OutmapTo(size_t eml_i,size_t emfo_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i].emf.emfo[%i].emfot\"",mName.c_str(),eml_i,emfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i); writeInt(mFile,"].emf.emfo[",emfo_i,"].emfot\"");
 	}
 	void getEmissionFunction_OutmapTo(size_t emfo_i)const
 	{
 
-		fprintf(mFile,"\"%s.eml.emf.emfo[%i].emfot\"",mName.c_str(),emfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml.emf.emfo[",emfo_i,"].emfot\"");
 	}
 	void getEmissionFunction_OutmapFrom(size_t eml_i,size_t emfo_i)const
 	{
-		fprintf(mFile,"\"%s.eml[%i].emf.emfo[%i].emfof\"",mName.c_str(),eml_i,emfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml[",eml_i); writeInt(mFile,"].emf.emfo[",emfo_i,"].emfof\"");
 	}
 	void getEmissionFunction_OutmapFrom(size_t emfo_i)const
 	{
 
-		fprintf(mFile,"\"%s.eml.emf.emfo[%i].emfof\"",mName.c_str(),emfo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eml.emf.emfo[",emfo_i,"].emfof\"");
 	}
 	void getSlices()const
 	{
-		fprintf(mFile,"\"%s.sli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sli\"");
 	}
 	void getVoxelQuality()const
 	{
-		fprintf(mFile,"\"%s.vqu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vqu\"");
 	}
 	void getDrawSubVolume()const
 	{
-		fprintf(mFile,"\"%s.dsv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsv\"");
 	}
 	void getSubVolumeCenter()const
 	{
-		fprintf(mFile,"\"%s.svc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svc\"");
 	}
 	void getSubVolumeCenterW()const
 	{
-		fprintf(mFile,"\"%s.svc.scw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svc.scw\"");
 	}
 	void getSubVolumeCenterH()const
 	{
-		fprintf(mFile,"\"%s.svc.sch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svc.sch\"");
 	}
 	void getSubVolumeCenterD()const
 	{
-		fprintf(mFile,"\"%s.svc.scd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svc.scd\"");
 	}
 	void getSubVolumeSize()const
 	{
-		fprintf(mFile,"\"%s.svs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svs\"");
 	}
 	void getSubVolumeSizeW()const
 	{
-		fprintf(mFile,"\"%s.svs.ssw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svs.ssw\"");
 	}
 	void getSubVolumeSizeH()const
 	{
-		fprintf(mFile,"\"%s.svs.ssh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svs.ssh\"");
 	}
 	void getSubVolumeSizeD()const
 	{
-		fprintf(mFile,"\"%s.svs.ssd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svs.ssd\"");
 	}
 	void getLockDrawAxis()const
 	{
-		fprintf(mFile,"\"%s.lda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lda\"");
 	}
 	void getBoundaryDraw()const
 	{
-		fprintf(mFile,"\"%s.bod\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bod\"");
 	}
 	void getDrawHeads()const
 	{
-		fprintf(mFile,"\"%s.dhd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dhd\"");
 	}
 	void getVelocityDraw()const
 	{
-		fprintf(mFile,"\"%s.vld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vld\"");
 	}
 	void getVelocityDrawLength()const
 	{
-		fprintf(mFile,"\"%s.vdl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vdl\"");
 	}
 	void getVelocityDrawSkip()const
 	{
-		fprintf(mFile,"\"%s.vds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vds\"");
 	}
 	void getShadedDisplay()const
 	{
-		fprintf(mFile,"\"%s.sdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdp\"");
 	}
 	void getOpacityPreviewGain()const
 	{
-		fprintf(mFile,"\"%s.opg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opg\"");
 	}
 	void getWireframeDisplay()const
 	{
-		fprintf(mFile,"\"%s.wdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wdp\"");
 	}
 	void getNumericDisplay()const
 	{
-		fprintf(mFile,"\"%s.nud\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nud\"");
 	}
 	void getHardwareSelfShadow()const
 	{
-		fprintf(mFile,"\"%s.hss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hss\"");
 	}
 	void getCoordinateMethod()const
 	{
-		fprintf(mFile,"\"%s.cmet\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmet\"");
 	}
 	void getOverrideTimeStep()const
 	{
-		fprintf(mFile,"\"%s.ots\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ots\"");
 	}
 	void getSimulationRateScale()const
 	{
-		fprintf(mFile,"\"%s.srs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srs\"");
 	}
 	void getGridInterpolator()const
 	{
-		fprintf(mFile,"\"%s.gdi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gdi\"");
 	}
 	void getSolver()const
 	{
-		fprintf(mFile,"\"%s.sol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sol\"");
 	}
 	void getSolverQuality()const
 	{
-		fprintf(mFile,"\"%s.sql\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sql\"");
 	}
 	void getHighDetailSolve()const
 	{
-		fprintf(mFile,"\"%s.hds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hds\"");
 	}
 	void getBoundaryX()const
 	{
-		fprintf(mFile,"\"%s.bndx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bndx\"");
 	}
 	void getBoundaryY()const
 	{
-		fprintf(mFile,"\"%s.bndy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bndy\"");
 	}
 	void getBoundaryZ()const
 	{
-		fprintf(mFile,"\"%s.bndz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bndz\"");
 	}
 	void getMassConversion()const
 	{
-		fprintf(mFile,"\"%s.mcv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mcv\"");
 	}
 	void getFalloffMethod()const
 	{
-		fprintf(mFile,"\"%s.fmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fmt\"");
 	}
 	void getDensityMethod()const
 	{
-		fprintf(mFile,"\"%s.dmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmt\"");
 	}
 	void getDensityGradient()const
 	{
-		fprintf(mFile,"\"%s.dgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dgr\"");
 	}
 	void getDensityScale()const
 	{
-		fprintf(mFile,"\"%s.dsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsc\"");
 	}
 	void getDensityDissipation()const
 	{
-		fprintf(mFile,"\"%s.dds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dds\"");
 	}
 	void getDensityDiffusion()const
 	{
-		fprintf(mFile,"\"%s.ddf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ddf\"");
 	}
 	void getConserveMass()const
 	{
-		fprintf(mFile,"\"%s.cm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cm\"");
 	}
 	void getDensityBuoyancy()const
 	{
-		fprintf(mFile,"\"%s.dsb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsb\"");
 	}
 	void getGravity()const
 	{
-		fprintf(mFile,"\"%s.grv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grv\"");
 	}
 	void getVelocityMethod()const
 	{
-		fprintf(mFile,"\"%s.vmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vmt\"");
 	}
 	void getVelocityGradient()const
 	{
-		fprintf(mFile,"\"%s.vgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vgr\"");
 	}
 	void getVelocityScale()const
 	{
-		fprintf(mFile,"\"%s.vsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vsc\"");
 	}
 	void getVelocityScaleX()const
 	{
-		fprintf(mFile,"\"%s.vsc.vsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vsc.vsx\"");
 	}
 	void getVelocityScaleY()const
 	{
-		fprintf(mFile,"\"%s.vsc.vsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vsc.vsy\"");
 	}
 	void getVelocityScaleZ()const
 	{
-		fprintf(mFile,"\"%s.vsc.vsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vsc.vsz\"");
 	}
 	void getViscosity()const
 	{
-		fprintf(mFile,"\"%s.viy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".viy\"");
 	}
 	void getFriction()const
 	{
-		fprintf(mFile,"\"%s.fri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fri\"");
 	}
 	void getVelocitySwirl()const
 	{
-		fprintf(mFile,"\"%s.vsw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vsw\"");
 	}
 	void getVelocityDamp()const
 	{
-		fprintf(mFile,"\"%s.vdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vdp\"");
 	}
 	void getVelocityAdvect()const
 	{
-		fprintf(mFile,"\"%s.va\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".va\"");
 	}
 	void getVelocityProject()const
 	{
-		fprintf(mFile,"\"%s.vi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vi\"");
 	}
 	void getTurbulenceStrength()const
 	{
-		fprintf(mFile,"\"%s.tst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tst\"");
 	}
 	void getTurbulenceFrequency()const
 	{
-		fprintf(mFile,"\"%s.tfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tfr\"");
 	}
 	void getTurbulenceSpeed()const
 	{
-		fprintf(mFile,"\"%s.tbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tbs\"");
 	}
 	void getTurbulenceRes()const
 	{
-		fprintf(mFile,"\"%s.trs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trs\"");
 	}
 	void getTemperatureMethod()const
 	{
-		fprintf(mFile,"\"%s.tmet\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmet\"");
 	}
 	void getTemperatureGradient()const
 	{
-		fprintf(mFile,"\"%s.tgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tgr\"");
 	}
 	void getTemperatureScale()const
 	{
-		fprintf(mFile,"\"%s.tmsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmsc\"");
 	}
 	void getTemperatureDissipation()const
 	{
-		fprintf(mFile,"\"%s.tds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tds\"");
 	}
 	void getTemperatureDiffusion()const
 	{
-		fprintf(mFile,"\"%s.tdf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tdf\"");
 	}
 	void getTemperatureTurbulence()const
 	{
-		fprintf(mFile,"\"%s.ttb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ttb\"");
 	}
 	void getBuoyancy()const
 	{
-		fprintf(mFile,"\"%s.buo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".buo\"");
 	}
 	void getColorMethod()const
 	{
-		fprintf(mFile,"\"%s.cmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmt\"");
 	}
 	void getColorDissipation()const
 	{
-		fprintf(mFile,"\"%s.cds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cds\"");
 	}
 	void getColorDiffusion()const
 	{
-		fprintf(mFile,"\"%s.cdf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdf\"");
 	}
 	void getFuelMethod()const
 	{
-		fprintf(mFile,"\"%s.fmet\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fmet\"");
 	}
 	void getFuelGradient()const
 	{
-		fprintf(mFile,"\"%s.fgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fgr\"");
 	}
 	void getFuelScale()const
 	{
-		fprintf(mFile,"\"%s.fesc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fesc\"");
 	}
 	void getReactionSpeed()const
 	{
-		fprintf(mFile,"\"%s.resp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".resp\"");
 	}
 	void getFuelIgnitionTemp()const
 	{
-		fprintf(mFile,"\"%s.fuit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fuit\"");
 	}
 	void getMaxReactionTemp()const
 	{
-		fprintf(mFile,"\"%s.mxrt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxrt\"");
 	}
 	void getHeatReleased()const
 	{
-		fprintf(mFile,"\"%s.hre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hre\"");
 	}
 	void getLightReleased()const
 	{
-		fprintf(mFile,"\"%s.lre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lre\"");
 	}
 	void getLightColor()const
 	{
-		fprintf(mFile,"\"%s.lco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lco\"");
 	}
 	void getLightColorR()const
 	{
-		fprintf(mFile,"\"%s.lco.lcor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lco.lcor\"");
 	}
 	void getLightColorG()const
 	{
-		fprintf(mFile,"\"%s.lco.lcog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lco.lcog\"");
 	}
 	void getLightColorB()const
 	{
-		fprintf(mFile,"\"%s.lco.lcob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lco.lcob\"");
 	}
 	void getUsePre70Dynamics()const
 	{
-		fprintf(mFile,"\"%s.updy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".updy\"");
 	}
 	void getOutMesh()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getInputData(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i]\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"]\"");
 	}
 	void getInputData()const
 	{
 
-		fprintf(mFile,"\"%s.ind\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind\"");
 	}
 	void getInputPositions(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i].inp\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"].inp\"");
 	}
 	void getInputPositions()const
 	{
 
-		fprintf(mFile,"\"%s.ind.inp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind.inp\"");
 	}
 	void getInputVelocities(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i].inv\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"].inv\"");
 	}
 	void getInputVelocities()const
 	{
 
-		fprintf(mFile,"\"%s.ind.inv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind.inv\"");
 	}
 	void getInputMass(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i].inm\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"].inm\"");
 	}
 	void getInputMass()const
 	{
 
-		fprintf(mFile,"\"%s.ind.inm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind.inm\"");
 	}
 	void getDeltaTime(size_t ind_i)const
 	{
-		fprintf(mFile,"\"%s.ind[%i].dt\"",mName.c_str(),ind_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ind[",ind_i,"].dt\"");
 	}
 	void getDeltaTime()const
 	{
 
-		fprintf(mFile,"\"%s.ind.dt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ind.dt\"");
 	}
 	void getInputForce2(size_t in2_i)const
 	{
-		fprintf(mFile,"\"%s.in2[%i]\"",mName.c_str(),in2_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".in2[",in2_i,"]\"");
 	}
 	void getInputForce2()const
 	{
 
-		fprintf(mFile,"\"%s.in2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in2\"");
 	}
 	void getOutputForce(size_t of_i)const
 	{
-		fprintf(mFile,"\"%s.of[%i]\"",mName.c_str(),of_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".of[",of_i,"]\"");
 	}
 	void getOutputForce()const
 	{
 
-		fprintf(mFile,"\"%s.of\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of\"");
 	}
 	void getMatteOpacityMode()const
 	{
-		fprintf(mFile,"\"%s.mom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mom\"");
 	}
 	void getMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.mog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mog\"");
 	}
 	void getFilterSize()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.fs.fsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsx\"");
 	}
 	void getFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.fs.fsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsy\"");
 	}
 	void getFilterSizeZ()const
 	{
-		fprintf(mFile,"\"%s.fs.fsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsz\"");
 	}
 	void getMatrixEyeToWorld()const
 	{
-		fprintf(mFile,"\"%s.e2w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2w\"");
 	}
 	void getMatrixWorldToObject()const
 	{
-		fprintf(mFile,"\"%s.w2o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w2o\"");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.pw.pwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwx\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.pw.pwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwy\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.pw.pwz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwz\"");
 	}
 	void getFarPointWorld()const
 	{
-		fprintf(mFile,"\"%s.fw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw\"");
 	}
 	void getFarPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.fw.fwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwx\"");
 	}
 	void getFarPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.fw.fwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwy\"");
 	}
 	void getFarPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.fw.fwz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwz\"");
 	}
 	void getPointObj()const
 	{
-		fprintf(mFile,"\"%s.po\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po\"");
 	}
 	void getPointObjX()const
 	{
-		fprintf(mFile,"\"%s.po.pox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.pox\"");
 	}
 	void getPointObjY()const
 	{
-		fprintf(mFile,"\"%s.po.poy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poy\"");
 	}
 	void getPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.po.poz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poz\"");
 	}
 	void getFarPointObj()const
 	{
-		fprintf(mFile,"\"%s.fo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo\"");
 	}
 	void getFarPointObjectX()const
 	{
-		fprintf(mFile,"\"%s.fo.fox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo.fox\"");
 	}
 	void getFarPointObjectY()const
 	{
-		fprintf(mFile,"\"%s.fo.foy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo.foy\"");
 	}
 	void getFarPointObjectZ()const
 	{
-		fprintf(mFile,"\"%s.fo.foz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo.foz\"");
 	}
 	void getRayInstance()const
 	{
-		fprintf(mFile,"\"%s.ryi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ryi\"");
 	}
 	void getLightDataArray(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i]\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"]\"");
 	}
 	void getLightDataArray()const
 	{
 
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld\"");
 	}
 	void getLightDirection()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldx\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldx\"");
 	}
 	void getLightDirectionX()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldy\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldy\"");
 	}
 	void getLightDirectionY()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldz\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldz\"");
 	}
 	void getLightDirectionZ()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li\"");
 	}
 	void getLightIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lir\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lir\"");
 	}
 	void getLightIntensityR()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lig\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lig\"");
 	}
 	void getLightIntensityG()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lib\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lib\"");
 	}
 	void getLightIntensityB()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].la\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].la\"");
 	}
 	void getLightAmbient()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ldf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ldf\"");
 	}
 	void getLightDiffuse()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ls\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ls\"");
 	}
 	void getLightSpecular()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lsf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lsf\"");
 	}
 	void getLightShadowFraction()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].psi\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].psi\"");
 	}
 	void getPreShadowIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lbd\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lbd\"");
 	}
 	void getLightBlindData()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbd\"");
 	}
 	void getSelfShadowing()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getQuality()const
 	{
-		fprintf(mFile,"\"%s.qua\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".qua\"");
 	}
 	void getRenderInterpolator()const
 	{
-		fprintf(mFile,"\"%s.rin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rin\"");
 	}
 	void getColor(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i]\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"]\"");
 	}
 	void getColor()const
 	{
 
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getColor_Position(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clp\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clp\"");
 	}
 	void getColor_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clp\"");
 	}
 	void getColor_Color(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clc\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clc\"");
 	}
 	void getColor_Color()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clc\"");
 	}
 	void getColor_ColorR(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clc.clcr\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clc.clcr\"");
 	}
 	void getColor_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clc.clcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clc.clcr\"");
 	}
 	void getColor_ColorG(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clc.clcg\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clc.clcg\"");
 	}
 	void getColor_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clc.clcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clc.clcg\"");
 	}
 	void getColor_ColorB(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clc.clcb\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clc.clcb\"");
 	}
 	void getColor_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clc.clcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clc.clcb\"");
 	}
 	void getColor_Interp(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].cli\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].cli\"");
 	}
 	void getColor_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cl.cli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cli\"");
 	}
 	void getColorInput()const
 	{
-		fprintf(mFile,"\"%s.coi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".coi\"");
 	}
 	void getColorInputBias()const
 	{
-		fprintf(mFile,"\"%s.cib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cib\"");
 	}
 	void getOpacity(size_t opa_i)const
 	{
-		fprintf(mFile,"\"%s.opa[%i]\"",mName.c_str(),opa_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".opa[",opa_i,"]\"");
 	}
 	void getOpacity()const
 	{
 
-		fprintf(mFile,"\"%s.opa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opa\"");
 	}
 	void getOpacity_Position(size_t opa_i)const
 	{
-		fprintf(mFile,"\"%s.opa[%i].opap\"",mName.c_str(),opa_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".opa[",opa_i,"].opap\"");
 	}
 	void getOpacity_Position()const
 	{
 
-		fprintf(mFile,"\"%s.opa.opap\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opa.opap\"");
 	}
 	void getOpacity_FloatValue(size_t opa_i)const
 	{
-		fprintf(mFile,"\"%s.opa[%i].opafv\"",mName.c_str(),opa_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".opa[",opa_i,"].opafv\"");
 	}
 	void getOpacity_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.opa.opafv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opa.opafv\"");
 	}
 	void getOpacity_Interp(size_t opa_i)const
 	{
-		fprintf(mFile,"\"%s.opa[%i].opai\"",mName.c_str(),opa_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".opa[",opa_i,"].opai\"");
 	}
 	void getOpacity_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.opa.opai\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opa.opai\"");
 	}
 	void getOpacityInput()const
 	{
-		fprintf(mFile,"\"%s.opi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opi\"");
 	}
 	void getOpacityInputBias()const
 	{
-		fprintf(mFile,"\"%s.oib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oib\"");
 	}
 	void getTransparency()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.t.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tr\"");
 	}
 	void getTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.t.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tg\"");
 	}
 	void getTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.t.tb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tb\"");
 	}
 	void getShadowOpacity()const
 	{
-		fprintf(mFile,"\"%s.shp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shp\"");
 	}
 	void getIncandescence(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getIncandescence()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getIncandescence_Position(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].ip\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].ip\"");
 	}
 	void getIncandescence_Position()const
 	{
 
-		fprintf(mFile,"\"%s.i.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ip\"");
 	}
 	void getIncandescence_Color(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].ic\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].ic\"");
 	}
 	void getIncandescence_Color()const
 	{
 
-		fprintf(mFile,"\"%s.i.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ic\"");
 	}
 	void getIncandescence_ColorR(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].ic.icr\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].ic.icr\"");
 	}
 	void getIncandescence_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.i.ic.icr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ic.icr\"");
 	}
 	void getIncandescence_ColorG(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].ic.icg\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].ic.icg\"");
 	}
 	void getIncandescence_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.i.ic.icg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ic.icg\"");
 	}
 	void getIncandescence_ColorB(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].ic.icb\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].ic.icb\"");
 	}
 	void getIncandescence_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.i.ic.icb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ic.icb\"");
 	}
 	void getIncandescence_Interp(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].ii\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].ii\"");
 	}
 	void getIncandescence_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.i.ii\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ii\"");
 	}
 	void getIncandescenceInput()const
 	{
-		fprintf(mFile,"\"%s.ili\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ili\"");
 	}
 	void getIncandescenceInputBias()const
 	{
-		fprintf(mFile,"\"%s.iib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iib\"");
 	}
 	void getGlowIntensity()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 	void getSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.spc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc\"");
 	}
 	void getSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.spc.spr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spr\"");
 	}
 	void getSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.spc.spg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spg\"");
 	}
 	void getSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.spc.spb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spb\"");
 	}
 	void getCosinePower()const
 	{
-		fprintf(mFile,"\"%s.csp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csp\"");
 	}
 	void getEnvironment(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i]\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"]\"");
 	}
 	void getEnvironment()const
 	{
 
-		fprintf(mFile,"\"%s.env\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env\"");
 	}
 	void getEnvironment_Position(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envp\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envp\"");
 	}
 	void getEnvironment_Position()const
 	{
 
-		fprintf(mFile,"\"%s.env.envp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envp\"");
 	}
 	void getEnvironment_Color(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc\"");
 	}
 	void getEnvironment_Color()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc\"");
 	}
 	void getEnvironment_ColorR(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcr\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcr\"");
 	}
 	void getEnvironment_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcr\"");
 	}
 	void getEnvironment_ColorG(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcg\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcg\"");
 	}
 	void getEnvironment_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcg\"");
 	}
 	void getEnvironment_ColorB(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcb\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcb\"");
 	}
 	void getEnvironment_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcb\"");
 	}
 	void getEnvironment_Interp(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envi\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envi\"");
 	}
 	void getEnvironment_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.env.envi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envi\"");
 	}
 	void getDropoffShape()const
 	{
-		fprintf(mFile,"\"%s.dos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dos\"");
 	}
 	void getEdgeDropoff()const
 	{
-		fprintf(mFile,"\"%s.edr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".edr\"");
 	}
 	void getContrastTolerance()const
 	{
-		fprintf(mFile,"\"%s.ctl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctl\"");
 	}
 	void getHeightField()const
 	{
-		fprintf(mFile,"\"%s.hfld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hfld\"");
 	}
 	void getSurfaceRender()const
 	{
-		fprintf(mFile,"\"%s.srr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srr\"");
 	}
 	void getSurfaceThreshold()const
 	{
-		fprintf(mFile,"\"%s.srt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srt\"");
 	}
 	void getSurfaceTolerance()const
 	{
-		fprintf(mFile,"\"%s.stl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stl\"");
 	}
 	void getSoftSurface()const
 	{
-		fprintf(mFile,"\"%s.ssf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssf\"");
 	}
 	void getRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.rei\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rei\"");
 	}
 	void getSampleMethod()const
 	{
-		fprintf(mFile,"\"%s.smpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smpm\"");
 	}
 	void getRealLights()const
 	{
-		fprintf(mFile,"\"%s.rl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rl\"");
 	}
 	void getDirectionalLight()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getDirectionalLightX()const
 	{
-		fprintf(mFile,"\"%s.dl.dlx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl.dlx\"");
 	}
 	void getDirectionalLightY()const
 	{
-		fprintf(mFile,"\"%s.dl.dly\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl.dly\"");
 	}
 	void getDirectionalLightZ()const
 	{
-		fprintf(mFile,"\"%s.dl.dlz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl.dlz\"");
 	}
 	void getTextureType()const
 	{
-		fprintf(mFile,"\"%s.tty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tty\"");
 	}
 	void getColorTexture()const
 	{
-		fprintf(mFile,"\"%s.ctx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctx\"");
 	}
 	void getColorTexGain()const
 	{
-		fprintf(mFile,"\"%s.ctxg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctxg\"");
 	}
 	void getIncandTexture()const
 	{
-		fprintf(mFile,"\"%s.itx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itx\"");
 	}
 	void getIncandTexGain()const
 	{
-		fprintf(mFile,"\"%s.itxg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itxg\"");
 	}
 	void getOpacityTexture()const
 	{
-		fprintf(mFile,"\"%s.otx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otx\"");
 	}
 	void getOpacityTexGain()const
 	{
-		fprintf(mFile,"\"%s.otxg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otxg\"");
 	}
 	void getInvertTexture()const
 	{
-		fprintf(mFile,"\"%s.ivt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ivt\"");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getTextureScale()const
 	{
-		fprintf(mFile,"\"%s.txsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txsc\"");
 	}
 	void getTextureScaleX()const
 	{
-		fprintf(mFile,"\"%s.txsc.tscx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txsc.tscx\"");
 	}
 	void getTextureScaleY()const
 	{
-		fprintf(mFile,"\"%s.txsc.tscy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txsc.tscy\"");
 	}
 	void getTextureScaleZ()const
 	{
-		fprintf(mFile,"\"%s.txsc.tscz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txsc.tscz\"");
 	}
 	void getTextureOrigin()const
 	{
-		fprintf(mFile,"\"%s.tor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tor\"");
 	}
 	void getTextureOriginX()const
 	{
-		fprintf(mFile,"\"%s.tor.torx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tor.torx\"");
 	}
 	void getTextureOriginY()const
 	{
-		fprintf(mFile,"\"%s.tor.tory\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tor.tory\"");
 	}
 	void getTextureOriginZ()const
 	{
-		fprintf(mFile,"\"%s.tor.torz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tor.torz\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.dm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dm\"");
 	}
 	void getFrequency()const
 	{
-		fprintf(mFile,"\"%s.fq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fq\"");
 	}
 	void getFrequencyRatio()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getInflection()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getTextureTime()const
 	{
-		fprintf(mFile,"\"%s.tti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tti\"");
 	}
 	void getBillowDensity()const
 	{
-		fprintf(mFile,"\"%s.bd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bd\"");
 	}
 	void getSpottyness()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getSizeRand()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getRandomness()const
 	{
-		fprintf(mFile,"\"%s.rnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rnd\"");
 	}
 	void getFalloff()const
 	{
-		fprintf(mFile,"\"%s.falo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".falo\"");
 	}
 	void getNumWaves()const
 	{
-		fprintf(mFile,"\"%s.nw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nw\"");
 	}
 	void getImplode()const
 	{
-		fprintf(mFile,"\"%s.imp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp\"");
 	}
 	void getImplodeCenter()const
 	{
-		fprintf(mFile,"\"%s.imc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc\"");
 	}
 	void getImplodeCenterX()const
 	{
-		fprintf(mFile,"\"%s.imc.imx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc.imx\"");
 	}
 	void getImplodeCenterY()const
 	{
-		fprintf(mFile,"\"%s.imc.imy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc.imy\"");
 	}
 	void getImplodeCenterZ()const
 	{
-		fprintf(mFile,"\"%s.imc.imz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc.imz\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.ocl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.ocl.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.ocl.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.ocl.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.ocb\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getDiskCache()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getDiskCacheIC()const
 	{
-		fprintf(mFile,"\"%s.dcic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcic\"");
 	}
 	void getCacheDensity()const
 	{
-		fprintf(mFile,"\"%s.cdns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdns\"");
 	}
 	void getLoadDensity()const
 	{
-		fprintf(mFile,"\"%s.ldns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldns\"");
 	}
 	void getCacheVelocity()const
 	{
-		fprintf(mFile,"\"%s.cvel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cvel\"");
 	}
 	void getLoadVelocity()const
 	{
-		fprintf(mFile,"\"%s.lvel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lvel\"");
 	}
 	void getCacheTemperature()const
 	{
-		fprintf(mFile,"\"%s.ctmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctmp\"");
 	}
 	void getLoadTemperature()const
 	{
-		fprintf(mFile,"\"%s.ltmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltmp\"");
 	}
 	void getCacheColor()const
 	{
-		fprintf(mFile,"\"%s.ccol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccol\"");
 	}
 	void getLoadColor()const
 	{
-		fprintf(mFile,"\"%s.lcol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcol\"");
 	}
 	void getCacheReaction()const
 	{
-		fprintf(mFile,"\"%s.crea\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crea\"");
 	}
 	void getLoadReaction()const
 	{
-		fprintf(mFile,"\"%s.lrea\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lrea\"");
 	}
 	void getCacheTextureCoordinates()const
 	{
-		fprintf(mFile,"\"%s.catc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".catc\"");
 	}
 	void getLoadTextureCoordinates()const
 	{
-		fprintf(mFile,"\"%s.lotc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lotc\"");
 	}
 	void getCacheFalloff()const
 	{
-		fprintf(mFile,"\"%s.cfal\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfal\"");
 	}
 	void getLoadFalloff()const
 	{
-		fprintf(mFile,"\"%s.lfal\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfal\"");
 	}
 	void getCollisionData()const
 	{
-		fprintf(mFile,"\"%s.cda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cda\"");
 	}
 	void getCollisionGeometry(size_t cge_i)const
 	{
-		fprintf(mFile,"\"%s.cda.cge[%i]\"",mName.c_str(),cge_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.cge[",cge_i,"]\"");
 	}
 	void getCollisionResilience(size_t crs_i)const
 	{
-		fprintf(mFile,"\"%s.cda.crs[%i]\"",mName.c_str(),crs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.crs[",crs_i,"]\"");
 	}
 	void getCollisionFriction(size_t cfr_i)const
 	{
-		fprintf(mFile,"\"%s.cda.cfr[%i]\"",mName.c_str(),cfr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.cfr[",cfr_i,"]\"");
 	}
 	void getCollide()const
 	{
-		fprintf(mFile,"\"%s.cld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cld\"");
 	}
 	void getObjectType()const
 	{
-		fprintf(mFile,"\"%s.obt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".obt\"");
 	}
 	void getSurfaceShaderDepth()const
 	{
-		fprintf(mFile,"\"%s.susd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".susd\"");
 	}
 	void getParticleWeight()const
 	{
-		fprintf(mFile,"\"%s.we\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".we\"");
 	}
 	void getCoordinateSpeed()const
 	{
-		fprintf(mFile,"\"%s.csd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csd\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiOverrideCaustics()const
 	{
-		fprintf(mFile,"\"%s.mrc.oca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oca\"");
 	}
 	void getMiCausticAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.caa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.caa\"");
 	}
 	void getMiCausticRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.car\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.car\"");
 	}
 	void getMiOverrideGlobalIllumination()const
 	{
-		fprintf(mFile,"\"%s.mrc.ogi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ogi\"");
 	}
 	void getMiGlobillumAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.gia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gia\"");
 	}
 	void getMiGlobillumRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.gir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gir\"");
 	}
 	void getMiOverrideFinalGather()const
 	{
-		fprintf(mFile,"\"%s.mrc.ofg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ofg\"");
 	}
 	void getMiFinalGatherRays()const
 	{
-		fprintf(mFile,"\"%s.mrc.fry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fry\"");
 	}
 	void getMiFinalGatherMinRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmn\"");
 	}
 	void getMiFinalGatherMaxRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmx\"");
 	}
 	void getMiFinalGatherFilter()const
 	{
-		fprintf(mFile,"\"%s.mrc.ffi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ffi\"");
 	}
 	void getMiFinalGatherView()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgv\"");
 	}
 	void getMiOverrideSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.oos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oos\"");
 	}
 	void getMiMinSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.mins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mins\"");
 	}
 	void getMiMaxSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.maxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.maxs\"");
 	}
 protected:
 	FluidShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
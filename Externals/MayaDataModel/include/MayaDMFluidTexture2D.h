@@ -27,98 +27,98 @@ public:
 	void setAlphaGain(float ag)
 	{
 		if(ag == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ag\" %f;\n", ag);
+		writeFloat(mFile,"\tsetAttr \".ag\" ",ag,";\n");
 	}
 	void setAlphaOffset(float ao)
 	{
 		if(ao == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ao\" %f;\n", ao);
+		writeFloat(mFile,"\tsetAttr \".ao\" ",ao,";\n");
 	}
 	void setDefaultColor(const float3& dcl)
 	{
 		if(dcl == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".dcl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dcl\" -type \"float3\" ");
 		dcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefaultColorR(float dcr)
 	{
 		if(dcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcr\" %f;\n", dcr);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcr\" ",dcr,";\n");
 	}
 	void setDefaultColorG(float dcg)
 	{
 		if(dcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcg\" %f;\n", dcg);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcg\" ",dcg,";\n");
 	}
 	void setDefaultColorB(float dcb)
 	{
 		if(dcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcb\" %f;\n", dcb);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcb\" ",dcb,";\n");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.uvu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.uvu\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.uvv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.uvv\"");
 	}
 	void getUvFilterSize()const
 	{
-		fprintf(mFile,"\"%s.uvfs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvfs\"");
 	}
 	void getUvFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.uvfs.uvfsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvfs.uvfsx\"");
 	}
 	void getUvFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.uvfs.uvfsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvfs.uvfsy\"");
 	}
 	void getOutAlpha()const
 	{
-		fprintf(mFile,"\"%s.oa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oa\"");
 	}
 	void getOutUV()const
 	{
-		fprintf(mFile,"\"%s.ouv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv\"");
 	}
 	void getOutU()const
 	{
-		fprintf(mFile,"\"%s.ouv.ou\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv.ou\"");
 	}
 	void getOutV()const
 	{
-		fprintf(mFile,"\"%s.ouv.ov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv.ov\"");
 	}
 	void getAlphaGain()const
 	{
-		fprintf(mFile,"\"%s.ag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ag\"");
 	}
 	void getAlphaOffset()const
 	{
-		fprintf(mFile,"\"%s.ao\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ao\"");
 	}
 	void getDefaultColor()const
 	{
-		fprintf(mFile,"\"%s.dcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl\"");
 	}
 	void getDefaultColorR()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcr\"");
 	}
 	void getDefaultColorG()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcg\"");
 	}
 	void getDefaultColorB()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcb\"");
 	}
 protected:
 	FluidTexture2D(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,94 +27,94 @@ public:
 	void setAlphaGain(float ag)
 	{
 		if(ag == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ag\" %f;\n", ag);
+		writeFloat(mFile,"\tsetAttr \".ag\" ",ag,";\n");
 	}
 	void setAlphaOffset(float ao)
 	{
 		if(ao == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ao\" %f;\n", ao);
+		writeFloat(mFile,"\tsetAttr \".ao\" ",ao,";\n");
 	}
 	void setDefaultColor(const float3& dcl)
 	{
 		if(dcl == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".dcl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dcl\" -type \"float3\" ");
 		dcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefaultColorR(float dcr)
 	{
 		if(dcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcr\" %f;\n", dcr);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcr\" ",dcr,";\n");
 	}
 	void setDefaultColorG(float dcg)
 	{
 		if(dcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcg\" %f;\n", dcg);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcg\" ",dcg,";\n");
 	}
 	void setDefaultColorB(float dcb)
 	{
 		if(dcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcb\" %f;\n", dcb);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcb\" ",dcb,";\n");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getOutAlpha()const
 	{
-		fprintf(mFile,"\"%s.oa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oa\"");
 	}
 	void getOutCoord()const
 	{
-		fprintf(mFile,"\"%s.ouc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouc\"");
 	}
 	void getOucx()const
 	{
-		fprintf(mFile,"\"%s.ouc.ocx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouc.ocx\"");
 	}
 	void getOucy()const
 	{
-		fprintf(mFile,"\"%s.ouc.ocy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouc.ocy\"");
 	}
 	void getOucz()const
 	{
-		fprintf(mFile,"\"%s.ouc.ocz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouc.ocz\"");
 	}
 	void getAlphaGain()const
 	{
-		fprintf(mFile,"\"%s.ag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ag\"");
 	}
 	void getAlphaOffset()const
 	{
-		fprintf(mFile,"\"%s.ao\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ao\"");
 	}
 	void getDefaultColor()const
 	{
-		fprintf(mFile,"\"%s.dcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl\"");
 	}
 	void getDefaultColorR()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcr\"");
 	}
 	void getDefaultColorG()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcg\"");
 	}
 	void getDefaultColorB()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcb\"");
 	}
 protected:
 	FluidTexture3D(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		unsigned int stiffnessScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", stiffnessScale_Position);
-			fprintf(file,"%f ", stiffnessScale_FloatValue);
-			fprintf(file,"%i", stiffnessScale_Interp);
+			writeFloat(file,"",stiffnessScale_Position," ");
+			writeFloat(file,"",stiffnessScale_FloatValue," ");
+			writeInt(file,"",stiffnessScale_Interp);
 		}
 	};
 	struct ClumpWidthScale{
@@ -34,9 +34,9 @@ public:
 		unsigned int clumpWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", clumpWidthScale_Position);
-			fprintf(file,"%f ", clumpWidthScale_FloatValue);
-			fprintf(file,"%i", clumpWidthScale_Interp);
+			writeFloat(file,"",clumpWidthScale_Position," ");
+			writeFloat(file,"",clumpWidthScale_FloatValue," ");
+			writeInt(file,"",clumpWidthScale_Interp);
 		}
 	};
 	struct AttractionScale{
@@ -45,9 +45,9 @@ public:
 		unsigned int attractionScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", attractionScale_Position);
-			fprintf(file,"%f ", attractionScale_FloatValue);
-			fprintf(file,"%i", attractionScale_Interp);
+			writeFloat(file,"",attractionScale_Position," ");
+			writeFloat(file,"",attractionScale_FloatValue," ");
+			writeInt(file,"",attractionScale_Interp);
 		}
 	};
 public:
@@ -60,639 +60,639 @@ public:
 	void setParameterU(double pu)
 	{
 		if(pu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pu\" %f;\n", pu);
+		writeFloat(mFile,"\tsetAttr \".pu\" ",pu,";\n");
 	}
 	void setParameterV(double pv)
 	{
 		if(pv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pv\" %f;\n", pv);
+		writeFloat(mFile,"\tsetAttr \".pv\" ",pv,";\n");
 	}
 	void setRestPose(unsigned int rsp)
 	{
 		if(rsp == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsp\" %i;\n", rsp);
+		writeInt(mFile,"\tsetAttr \".rsp\" ",rsp,";\n");
 	}
 	void setPointLock(unsigned int ptl)
 	{
 		if(ptl == 1) return;
-		fprintf(mFile,"\tsetAttr \".ptl\" %i;\n", ptl);
+		writeInt(mFile,"\tsetAttr \".ptl\" ",ptl,";\n");
 	}
 	void setSimulationMethod(unsigned int sim)
 	{
 		if(sim == 2) return;
-		fprintf(mFile,"\tsetAttr \".sim\" %i;\n", sim);
+		writeInt(mFile,"\tsetAttr \".sim\" ",sim,";\n");
 	}
 	void setStartDirection(unsigned int sdr)
 	{
 		if(sdr == 0) return;
-		fprintf(mFile,"\tsetAttr \".sdr\" %i;\n", sdr);
+		writeInt(mFile,"\tsetAttr \".sdr\" ",sdr,";\n");
 	}
 	void setFlipDirection(bool fld)
 	{
 		if(fld == false) return;
-		fprintf(mFile,"\tsetAttr \".fld\" %i;\n", fld);
+		writeInt(mFile,"\tsetAttr \".fld\" ",fld,";\n");
 	}
 	void setHairSysGravity(double hsg)
 	{
 		if(hsg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hsg\" %f;\n", hsg);
+		writeFloat(mFile,"\tsetAttr \".hsg\" ",hsg,";\n");
 	}
 	void setHairSysStiffness(double hss)
 	{
 		if(hss == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hss\" %f;\n", hss);
+		writeFloat(mFile,"\tsetAttr \".hss\" ",hss,";\n");
 	}
 	void setOverrideDynamics(bool ovd)
 	{
 		if(ovd == false) return;
-		fprintf(mFile,"\tsetAttr \".ovd\" %i;\n", ovd);
+		writeInt(mFile,"\tsetAttr \".ovd\" ",ovd,";\n");
 	}
 	void setCollide(bool cld)
 	{
 		if(cld == true) return;
-		fprintf(mFile,"\tsetAttr \".cld\" %i;\n", cld);
+		writeInt(mFile,"\tsetAttr \".cld\" ",cld,";\n");
 	}
 	void setDamp(double dmp)
 	{
 		if(dmp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dmp\" %f;\n", dmp);
+		writeFloat(mFile,"\tsetAttr \".dmp\" ",dmp,";\n");
 	}
 	void setStiffness(double stf)
 	{
 		if(stf == 0.15) return;
-		fprintf(mFile,"\tsetAttr \".stf\" %f;\n", stf);
+		writeFloat(mFile,"\tsetAttr \".stf\" ",stf,";\n");
 	}
 	void setStiffnessScale(size_t sts_i,const StiffnessScale& sts)
 	{
-		fprintf(mFile,"\tsetAttr \".sts[%i]\" ",sts_i);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_i,"]\" ");
 		sts.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStiffnessScale(size_t sts_start,size_t sts_end,StiffnessScale* sts)
 	{
-		fprintf(mFile,"\tsetAttr \".sts[%i:%i]\" ", sts_start,sts_end);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_start); writeInt(mFile,":",sts_end,"]\" ");
 		size_t size = (sts_end-sts_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			sts[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startStiffnessScale(size_t sts_start,size_t sts_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sts[%i:%i]\"",sts_start,sts_end);
-		fprintf(mFile," -type \"StiffnessScale\" ");
+		writeInt(mFile,"\tsetAttr \".sts[",sts_start); writeInt(mFile,":",sts_end,"]\"");
+		writeString(mFile," -type \"StiffnessScale\" ");
 	}
 	void appendStiffnessScale(const StiffnessScale& sts)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		sts.write(mFile);
 	}
 	void endStiffnessScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStiffnessScale_Position(size_t sts_i,float stsp)
 	{
 		if(stsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sts[%i].stsp\" %f;\n", sts_i,stsp);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_i); writeFloat(mFile,"].stsp\" ",stsp,";\n");
 	}
 	void setStiffnessScale_FloatValue(size_t sts_i,float stsfv)
 	{
 		if(stsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sts[%i].stsfv\" %f;\n", sts_i,stsfv);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_i); writeFloat(mFile,"].stsfv\" ",stsfv,";\n");
 	}
 	void setStiffnessScale_Interp(size_t sts_i,unsigned int stsi)
 	{
 		if(stsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".sts[%i].stsi\" %i;\n", sts_i,stsi);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_i); writeInt(mFile,"].stsi\" ",stsi,";\n");
 	}
 	void setLengthFlex(double lfl)
 	{
 		if(lfl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lfl\" %f;\n", lfl);
+		writeFloat(mFile,"\tsetAttr \".lfl\" ",lfl,";\n");
 	}
 	void setClumpWidthMult(double cwm)
 	{
 		if(cwm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cwm\" %f;\n", cwm);
+		writeFloat(mFile,"\tsetAttr \".cwm\" ",cwm,";\n");
 	}
 	void setClumpWidthScale(size_t cws_i,const ClumpWidthScale& cws)
 	{
-		fprintf(mFile,"\tsetAttr \".cws[%i]\" ",cws_i);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_i,"]\" ");
 		cws.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpWidthScale(size_t cws_start,size_t cws_end,ClumpWidthScale* cws)
 	{
-		fprintf(mFile,"\tsetAttr \".cws[%i:%i]\" ", cws_start,cws_end);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_start); writeInt(mFile,":",cws_end,"]\" ");
 		size_t size = (cws_end-cws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cws[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClumpWidthScale(size_t cws_start,size_t cws_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cws[%i:%i]\"",cws_start,cws_end);
-		fprintf(mFile," -type \"ClumpWidthScale\" ");
+		writeInt(mFile,"\tsetAttr \".cws[",cws_start); writeInt(mFile,":",cws_end,"]\"");
+		writeString(mFile," -type \"ClumpWidthScale\" ");
 	}
 	void appendClumpWidthScale(const ClumpWidthScale& cws)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cws.write(mFile);
 	}
 	void endClumpWidthScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpWidthScale_Position(size_t cws_i,float cwsp)
 	{
 		if(cwsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cws[%i].cwsp\" %f;\n", cws_i,cwsp);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_i); writeFloat(mFile,"].cwsp\" ",cwsp,";\n");
 	}
 	void setClumpWidthScale_FloatValue(size_t cws_i,float cwsfv)
 	{
 		if(cwsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cws[%i].cwsfv\" %f;\n", cws_i,cwsfv);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_i); writeFloat(mFile,"].cwsfv\" ",cwsfv,";\n");
 	}
 	void setClumpWidthScale_Interp(size_t cws_i,unsigned int cwsi)
 	{
 		if(cwsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".cws[%i].cwsi\" %i;\n", cws_i,cwsi);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_i); writeInt(mFile,"].cwsi\" ",cwsi,";\n");
 	}
 	void setStartCurveAttract(double sct)
 	{
 		if(sct == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sct\" %f;\n", sct);
+		writeFloat(mFile,"\tsetAttr \".sct\" ",sct,";\n");
 	}
 	void setAttractionScale(size_t ats_i,const AttractionScale& ats)
 	{
-		fprintf(mFile,"\tsetAttr \".ats[%i]\" ",ats_i);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i,"]\" ");
 		ats.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttractionScale(size_t ats_start,size_t ats_end,AttractionScale* ats)
 	{
-		fprintf(mFile,"\tsetAttr \".ats[%i:%i]\" ", ats_start,ats_end);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_start); writeInt(mFile,":",ats_end,"]\" ");
 		size_t size = (ats_end-ats_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ats[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startAttractionScale(size_t ats_start,size_t ats_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ats[%i:%i]\"",ats_start,ats_end);
-		fprintf(mFile," -type \"AttractionScale\" ");
+		writeInt(mFile,"\tsetAttr \".ats[",ats_start); writeInt(mFile,":",ats_end,"]\"");
+		writeString(mFile," -type \"AttractionScale\" ");
 	}
 	void appendAttractionScale(const AttractionScale& ats)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ats.write(mFile);
 	}
 	void endAttractionScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttractionScale_Position(size_t ats_i,float atsp)
 	{
 		if(atsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ats[%i].atsp\" %f;\n", ats_i,atsp);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i); writeFloat(mFile,"].atsp\" ",atsp,";\n");
 	}
 	void setAttractionScale_FloatValue(size_t ats_i,float atsfv)
 	{
 		if(atsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ats[%i].atsfv\" %f;\n", ats_i,atsfv);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i); writeFloat(mFile,"].atsfv\" ",atsfv,";\n");
 	}
 	void setAttractionScale_Interp(size_t ats_i,unsigned int atsi)
 	{
 		if(atsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".ats[%i].atsi\" %i;\n", ats_i,atsi);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i); writeInt(mFile,"].atsi\" ",atsi,";\n");
 	}
 	void setAttractionDamp(double ad)
 	{
 		if(ad == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ad\" %f;\n", ad);
+		writeFloat(mFile,"\tsetAttr \".ad\" ",ad,";\n");
 	}
 	void setDensityMult(double dml)
 	{
 		if(dml == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dml\" %f;\n", dml);
+		writeFloat(mFile,"\tsetAttr \".dml\" ",dml,";\n");
 	}
 	void setCurlMult(double cml)
 	{
 		if(cml == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cml\" %f;\n", cml);
+		writeFloat(mFile,"\tsetAttr \".cml\" ",cml,";\n");
 	}
 	void setClumpTwistOffset(double ctf)
 	{
 		if(ctf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ctf\" %f;\n", ctf);
+		writeFloat(mFile,"\tsetAttr \".ctf\" ",ctf,";\n");
 	}
 	void setBraid(bool brd)
 	{
 		if(brd == false) return;
-		fprintf(mFile,"\tsetAttr \".brd\" %i;\n", brd);
+		writeInt(mFile,"\tsetAttr \".brd\" ",brd,";\n");
 	}
 	void setColorBlend(double cbl)
 	{
 		if(cbl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cbl\" %f;\n", cbl);
+		writeFloat(mFile,"\tsetAttr \".cbl\" ",cbl,";\n");
 	}
 	void setColor(const float3& cl)
 	{
-		fprintf(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
 		cl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".cl.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".cl.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".cl.cb\" ",cb,";\n");
 	}
 	void setFixedSegmentLength(bool fsl)
 	{
 		if(fsl == 0) return;
-		fprintf(mFile,"\tsetAttr \".fsl\" %i;\n", fsl);
+		writeInt(mFile,"\tsetAttr \".fsl\" ",fsl,";\n");
 	}
 	void setSegmentLength(double sgl)
 	{
 		if(sgl == 1) return;
-		fprintf(mFile,"\tsetAttr \".sgl\" %f;\n", sgl);
+		writeFloat(mFile,"\tsetAttr \".sgl\" ",sgl,";\n");
 	}
 	void setSampleDensity(double sdn)
 	{
 		if(sdn == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sdn\" %f;\n", sdn);
+		writeFloat(mFile,"\tsetAttr \".sdn\" ",sdn,";\n");
 	}
 	void setDegree(int dgr)
 	{
 		if(dgr == 2) return;
-		fprintf(mFile,"\tsetAttr \".dgr\" %i;\n", dgr);
+		writeInt(mFile,"\tsetAttr \".dgr\" ",dgr,";\n");
 	}
 	void setClumpWidth(float cw)
 	{
 		if(cw == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".cw\" %f;\n", cw);
+		writeFloat(mFile,"\tsetAttr \".cw\" ",cw,";\n");
 	}
 	void setMapSetName(const string& msn)
 	{
 		if(msn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".msn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".msn\" -type \"string\" ");
 		msn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInputMesh()const
 	{
-		fprintf(mFile,"\"%s.inm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inm\"");
 	}
 	void getInputWorldMatrix()const
 	{
-		fprintf(mFile,"\"%s.iwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iwm\"");
 	}
 	void getParameterU()const
 	{
-		fprintf(mFile,"\"%s.pu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pu\"");
 	}
 	void getParameterV()const
 	{
-		fprintf(mFile,"\"%s.pv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pv\"");
 	}
 	void getStartPosition()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getRestPosition()const
 	{
-		fprintf(mFile,"\"%s.rp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp\"");
 	}
 	void getCurrentPosition()const
 	{
-		fprintf(mFile,"\"%s.crp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp\"");
 	}
 	void getRestPose()const
 	{
-		fprintf(mFile,"\"%s.rsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsp\"");
 	}
 	void getPointLock()const
 	{
-		fprintf(mFile,"\"%s.ptl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ptl\"");
 	}
 	void getSimulationMethod()const
 	{
-		fprintf(mFile,"\"%s.sim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sim\"");
 	}
 	void getStartDirection()const
 	{
-		fprintf(mFile,"\"%s.sdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdr\"");
 	}
 	void getFlipDirection()const
 	{
-		fprintf(mFile,"\"%s.fld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fld\"");
 	}
 	void getHairSysGravity()const
 	{
-		fprintf(mFile,"\"%s.hsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hsg\"");
 	}
 	void getHairSysStiffness()const
 	{
-		fprintf(mFile,"\"%s.hss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hss\"");
 	}
 	void getOverrideDynamics()const
 	{
-		fprintf(mFile,"\"%s.ovd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ovd\"");
 	}
 	void getCollide()const
 	{
-		fprintf(mFile,"\"%s.cld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cld\"");
 	}
 	void getDamp()const
 	{
-		fprintf(mFile,"\"%s.dmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmp\"");
 	}
 	void getStiffness()const
 	{
-		fprintf(mFile,"\"%s.stf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stf\"");
 	}
 	void getStiffnessScale(size_t sts_i)const
 	{
-		fprintf(mFile,"\"%s.sts[%i]\"",mName.c_str(),sts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sts[",sts_i,"]\"");
 	}
 	void getStiffnessScale()const
 	{
 
-		fprintf(mFile,"\"%s.sts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts\"");
 	}
 	void getStiffnessScale_Position(size_t sts_i)const
 	{
-		fprintf(mFile,"\"%s.sts[%i].stsp\"",mName.c_str(),sts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sts[",sts_i,"].stsp\"");
 	}
 	void getStiffnessScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.sts.stsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts.stsp\"");
 	}
 	void getStiffnessScale_FloatValue(size_t sts_i)const
 	{
-		fprintf(mFile,"\"%s.sts[%i].stsfv\"",mName.c_str(),sts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sts[",sts_i,"].stsfv\"");
 	}
 	void getStiffnessScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.sts.stsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts.stsfv\"");
 	}
 	void getStiffnessScale_Interp(size_t sts_i)const
 	{
-		fprintf(mFile,"\"%s.sts[%i].stsi\"",mName.c_str(),sts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sts[",sts_i,"].stsi\"");
 	}
 	void getStiffnessScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.sts.stsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts.stsi\"");
 	}
 	void getLengthFlex()const
 	{
-		fprintf(mFile,"\"%s.lfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfl\"");
 	}
 	void getClumpWidthMult()const
 	{
-		fprintf(mFile,"\"%s.cwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwm\"");
 	}
 	void getClumpWidthScale(size_t cws_i)const
 	{
-		fprintf(mFile,"\"%s.cws[%i]\"",mName.c_str(),cws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cws[",cws_i,"]\"");
 	}
 	void getClumpWidthScale()const
 	{
 
-		fprintf(mFile,"\"%s.cws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws\"");
 	}
 	void getClumpWidthScale_Position(size_t cws_i)const
 	{
-		fprintf(mFile,"\"%s.cws[%i].cwsp\"",mName.c_str(),cws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cws[",cws_i,"].cwsp\"");
 	}
 	void getClumpWidthScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cws.cwsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws.cwsp\"");
 	}
 	void getClumpWidthScale_FloatValue(size_t cws_i)const
 	{
-		fprintf(mFile,"\"%s.cws[%i].cwsfv\"",mName.c_str(),cws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cws[",cws_i,"].cwsfv\"");
 	}
 	void getClumpWidthScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.cws.cwsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws.cwsfv\"");
 	}
 	void getClumpWidthScale_Interp(size_t cws_i)const
 	{
-		fprintf(mFile,"\"%s.cws[%i].cwsi\"",mName.c_str(),cws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cws[",cws_i,"].cwsi\"");
 	}
 	void getClumpWidthScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cws.cwsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws.cwsi\"");
 	}
 	void getStartCurveAttract()const
 	{
-		fprintf(mFile,"\"%s.sct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sct\"");
 	}
 	void getAttractionScale(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i]\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"]\"");
 	}
 	void getAttractionScale()const
 	{
 
-		fprintf(mFile,"\"%s.ats\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats\"");
 	}
 	void getAttractionScale_Position(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i].atsp\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"].atsp\"");
 	}
 	void getAttractionScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.ats.atsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats.atsp\"");
 	}
 	void getAttractionScale_FloatValue(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i].atsfv\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"].atsfv\"");
 	}
 	void getAttractionScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.ats.atsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats.atsfv\"");
 	}
 	void getAttractionScale_Interp(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i].atsi\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"].atsi\"");
 	}
 	void getAttractionScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.ats.atsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats.atsi\"");
 	}
 	void getAttractionDamp()const
 	{
-		fprintf(mFile,"\"%s.ad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ad\"");
 	}
 	void getDensityMult()const
 	{
-		fprintf(mFile,"\"%s.dml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dml\"");
 	}
 	void getCurlMult()const
 	{
-		fprintf(mFile,"\"%s.cml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cml\"");
 	}
 	void getClumpTwistOffset()const
 	{
-		fprintf(mFile,"\"%s.ctf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctf\"");
 	}
 	void getBraid()const
 	{
-		fprintf(mFile,"\"%s.brd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".brd\"");
 	}
 	void getColorBlend()const
 	{
-		fprintf(mFile,"\"%s.cbl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cbl\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.cl.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.cl.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.cl.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cb\"");
 	}
 	void getFixedSegmentLength()const
 	{
-		fprintf(mFile,"\"%s.fsl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsl\"");
 	}
 	void getSegmentLength()const
 	{
-		fprintf(mFile,"\"%s.sgl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgl\"");
 	}
 	void getSampleDensity()const
 	{
-		fprintf(mFile,"\"%s.sdn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdn\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.dgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dgr\"");
 	}
 	void getClumpWidth()const
 	{
-		fprintf(mFile,"\"%s.cw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cw\"");
 	}
 	void getOutTranslate()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTranslateX()const
 	{
-		fprintf(mFile,"\"%s.ot.otx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otx\"");
 	}
 	void getOutTranslateY()const
 	{
-		fprintf(mFile,"\"%s.ot.oty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.oty\"");
 	}
 	void getOutTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.ot.otz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otz\"");
 	}
 	void getOutRotate()const
 	{
-		fprintf(mFile,"\"%s.or\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or\"");
 	}
 	void getOutRotateX()const
 	{
-		fprintf(mFile,"\"%s.or.orx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.orx\"");
 	}
 	void getOutRotateY()const
 	{
-		fprintf(mFile,"\"%s.or.ory\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.ory\"");
 	}
 	void getOutRotateZ()const
 	{
-		fprintf(mFile,"\"%s.or.orz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.orz\"");
 	}
 	void getOutTangent()const
 	{
-		fprintf(mFile,"\"%s.otn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otn\"");
 	}
 	void getOutTangentX()const
 	{
-		fprintf(mFile,"\"%s.otn.otnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otn.otnx\"");
 	}
 	void getOutTangentY()const
 	{
-		fprintf(mFile,"\"%s.otn.otny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otn.otny\"");
 	}
 	void getOutTangentZ()const
 	{
-		fprintf(mFile,"\"%s.otn.otnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otn.otnz\"");
 	}
 	void getOutNormal()const
 	{
-		fprintf(mFile,"\"%s.onm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".onm\"");
 	}
 	void getOutNormalX()const
 	{
-		fprintf(mFile,"\"%s.onm.onx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".onm.onx\"");
 	}
 	void getOutNormalY()const
 	{
-		fprintf(mFile,"\"%s.onm.ony\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".onm.ony\"");
 	}
 	void getOutNormalZ()const
 	{
-		fprintf(mFile,"\"%s.onm.onz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".onm.onz\"");
 	}
 	void getOutHair()const
 	{
-		fprintf(mFile,"\"%s.oha\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oha\"");
 	}
 	void getOutCurve()const
 	{
-		fprintf(mFile,"\"%s.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocr\"");
 	}
 	void getValidUv()const
 	{
-		fprintf(mFile,"\"%s.vuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vuv\"");
 	}
 	void getMapSetName()const
 	{
-		fprintf(mFile,"\"%s.msn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msn\"");
 	}
 protected:
 	Follicle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
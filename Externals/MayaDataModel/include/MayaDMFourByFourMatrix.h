@@ -27,150 +27,150 @@ public:
 	void setIn00(double i00)
 	{
 		if(i00 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".i00\" %f;\n", i00);
+		writeFloat(mFile,"\tsetAttr \".i00\" ",i00,";\n");
 	}
 	void setIn01(double i01)
 	{
 		if(i01 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i01\" %f;\n", i01);
+		writeFloat(mFile,"\tsetAttr \".i01\" ",i01,";\n");
 	}
 	void setIn02(double i02)
 	{
 		if(i02 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i02\" %f;\n", i02);
+		writeFloat(mFile,"\tsetAttr \".i02\" ",i02,";\n");
 	}
 	void setIn03(double i03)
 	{
 		if(i03 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i03\" %f;\n", i03);
+		writeFloat(mFile,"\tsetAttr \".i03\" ",i03,";\n");
 	}
 	void setIn10(double i10)
 	{
 		if(i10 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i10\" %f;\n", i10);
+		writeFloat(mFile,"\tsetAttr \".i10\" ",i10,";\n");
 	}
 	void setIn11(double i11)
 	{
 		if(i11 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".i11\" %f;\n", i11);
+		writeFloat(mFile,"\tsetAttr \".i11\" ",i11,";\n");
 	}
 	void setIn12(double i12)
 	{
 		if(i12 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i12\" %f;\n", i12);
+		writeFloat(mFile,"\tsetAttr \".i12\" ",i12,";\n");
 	}
 	void setIn13(double i13)
 	{
 		if(i13 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i13\" %f;\n", i13);
+		writeFloat(mFile,"\tsetAttr \".i13\" ",i13,";\n");
 	}
 	void setIn20(double i20)
 	{
 		if(i20 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i20\" %f;\n", i20);
+		writeFloat(mFile,"\tsetAttr \".i20\" ",i20,";\n");
 	}
 	void setIn21(double i21)
 	{
 		if(i21 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i21\" %f;\n", i21);
+		writeFloat(mFile,"\tsetAttr \".i21\" ",i21,";\n");
 	}
 	void setIn22(double i22)
 	{
 		if(i22 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".i22\" %f;\n", i22);
+		writeFloat(mFile,"\tsetAttr \".i22\" ",i22,";\n");
 	}
 	void setIn23(double i23)
 	{
 		if(i23 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i23\" %f;\n", i23);
+		writeFloat(mFile,"\tsetAttr \".i23\" ",i23,";\n");
 	}
 	void setIn30(double i30)
 	{
 		if(i30 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i30\" %f;\n", i30);
+		writeFloat(mFile,"\tsetAttr \".i30\" ",i30,";\n");
 	}
 	void setIn31(double i31)
 	{
 		if(i31 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i31\" %f;\n", i31);
+		writeFloat(mFile,"\tsetAttr \".i31\" ",i31,";\n");
 	}
 	void setIn32(double i32)
 	{
 		if(i32 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i32\" %f;\n", i32);
+		writeFloat(mFile,"\tsetAttr \".i32\" ",i32,";\n");
 	}
 	void setIn33(double i33)
 	{
 		if(i33 == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".i33\" %f;\n", i33);
+		writeFloat(mFile,"\tsetAttr \".i33\" ",i33,";\n");
 	}
 	void getIn00()const
 	{
-		fprintf(mFile,"\"%s.i00\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i00\"");
 	}
 	void getIn01()const
 	{
-		fprintf(mFile,"\"%s.i01\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i01\"");
 	}
 	void getIn02()const
 	{
-		fprintf(mFile,"\"%s.i02\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i02\"");
 	}
 	void getIn03()const
 	{
-		fprintf(mFile,"\"%s.i03\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i03\"");
 	}
 	void getIn10()const
 	{
-		fprintf(mFile,"\"%s.i10\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i10\"");
 	}
 	void getIn11()const
 	{
-		fprintf(mFile,"\"%s.i11\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i11\"");
 	}
 	void getIn12()const
 	{
-		fprintf(mFile,"\"%s.i12\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i12\"");
 	}
 	void getIn13()const
 	{
-		fprintf(mFile,"\"%s.i13\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i13\"");
 	}
 	void getIn20()const
 	{
-		fprintf(mFile,"\"%s.i20\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i20\"");
 	}
 	void getIn21()const
 	{
-		fprintf(mFile,"\"%s.i21\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i21\"");
 	}
 	void getIn22()const
 	{
-		fprintf(mFile,"\"%s.i22\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i22\"");
 	}
 	void getIn23()const
 	{
-		fprintf(mFile,"\"%s.i23\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i23\"");
 	}
 	void getIn30()const
 	{
-		fprintf(mFile,"\"%s.i30\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i30\"");
 	}
 	void getIn31()const
 	{
-		fprintf(mFile,"\"%s.i31\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i31\"");
 	}
 	void getIn32()const
 	{
-		fprintf(mFile,"\"%s.i32\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i32\"");
 	}
 	void getIn33()const
 	{
-		fprintf(mFile,"\"%s.i33\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i33\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	FourByFourMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
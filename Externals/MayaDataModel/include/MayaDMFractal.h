@@ -27,101 +27,101 @@ public:
 	void setAmplitude(float a)
 	{
 		if(a == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void setLevelMin(float lmn)
 	{
 		if(lmn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lmn\" %f;\n", lmn);
+		writeFloat(mFile,"\tsetAttr \".lmn\" ",lmn,";\n");
 	}
 	void setLevelMax(float lmx)
 	{
 		if(lmx == 9.0) return;
-		fprintf(mFile,"\tsetAttr \".lmx\" %f;\n", lmx);
+		writeFloat(mFile,"\tsetAttr \".lmx\" ",lmx,";\n");
 	}
 	void setFrequencyRatio(float fr)
 	{
 		if(fr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setBias(float bs)
 	{
 		if(bs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bs\" %f;\n", bs);
+		writeFloat(mFile,"\tsetAttr \".bs\" ",bs,";\n");
 	}
 	void setInflection(bool in)
 	{
 		if(in == false) return;
-		fprintf(mFile,"\tsetAttr \".in\" %i;\n", in);
+		writeInt(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setAnimated(bool an)
 	{
 		if(an == false) return;
-		fprintf(mFile,"\tsetAttr \".an\" %i;\n", an);
+		writeInt(mFile,"\tsetAttr \".an\" ",an,";\n");
 	}
 	void setTimeRatio(float tr)
 	{
 		if(tr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".tr\" %f;\n", tr);
+		writeFloat(mFile,"\tsetAttr \".tr\" ",tr,";\n");
 	}
 	void setTime(float ti)
 	{
 		if(ti == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ti\" %f;\n", ti);
+		writeFloat(mFile,"\tsetAttr \".ti\" ",ti,";\n");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getLevelMin()const
 	{
-		fprintf(mFile,"\"%s.lmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmn\"");
 	}
 	void getLevelMax()const
 	{
-		fprintf(mFile,"\"%s.lmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmx\"");
 	}
 	void getFrequencyRatio()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getBias()const
 	{
-		fprintf(mFile,"\"%s.bs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bs\"");
 	}
 	void getInflection()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getAnimated()const
 	{
-		fprintf(mFile,"\"%s.an\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".an\"");
 	}
 	void getTimeRatio()const
 	{
-		fprintf(mFile,"\"%s.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tr\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.ti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ti\"");
 	}
 protected:
 	Fractal(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,42 +27,42 @@ public:
 	void setVaryTime(double vt)
 	{
 		if(vt == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt\" %f;\n", vt);
+		writeFloat(mFile,"\tsetAttr \".vt\" ",vt,";\n");
 	}
 	void setStream(double s)
 	{
 		if(s == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void getFuture(size_t f_i)const
 	{
-		fprintf(mFile,"\"%s.f[%i]\"",mName.c_str(),f_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".f[",f_i,"]\"");
 	}
 	void getFuture()const
 	{
 
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getPast(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getPast()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getVarying()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getVaryTime()const
 	{
-		fprintf(mFile,"\"%s.vt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt\"");
 	}
 	void getStream()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 protected:
 	FrameCache(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
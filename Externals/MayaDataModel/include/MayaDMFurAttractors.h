@@ -63,351 +63,351 @@ public:
 	void setAttractorModel(unsigned int amd)
 	{
 		if(amd == 0) return;
-		fprintf(mFile,"\tsetAttr \".amd\" %i;\n", amd);
+		writeInt(mFile,"\tsetAttr \".amd\" ",amd,";\n");
 	}
 	void setAttractorsPerHair(int aph)
 	{
 		if(aph == 1) return;
-		fprintf(mFile,"\tsetAttr \".aph\" %i;\n", aph);
+		writeInt(mFile,"\tsetAttr \".aph\" ",aph,";\n");
 	}
 	void setGlobalScale(float gs)
 	{
 		if(gs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gs\" %f;\n", gs);
+		writeFloat(mFile,"\tsetAttr \".gs\" ",gs,";\n");
 	}
 	void setRadius(double rd)
 	{
 		if(rd == 1) return;
-		fprintf(mFile,"\tsetAttr \".rd\" %f;\n", rd);
+		writeFloat(mFile,"\tsetAttr \".rd\" ",rd,";\n");
 	}
 	void setRadiusMapOffset(double rmo)
 	{
 		if(rmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".rmo\" %f;\n", rmo);
+		writeFloat(mFile,"\tsetAttr \".rmo\" ",rmo,";\n");
 	}
 	void setRadiusMapMult(double rmm)
 	{
 		if(rmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".rmm\" %f;\n", rmm);
+		writeFloat(mFile,"\tsetAttr \".rmm\" ",rmm,";\n");
 	}
 	void setRadiusNoise(double rn)
 	{
 		if(rn == 0) return;
-		fprintf(mFile,"\tsetAttr \".rn\" %f;\n", rn);
+		writeFloat(mFile,"\tsetAttr \".rn\" ",rn,";\n");
 	}
 	void setRadiusNoiseFreq(float rnf)
 	{
 		if(rnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".rnf\" %f;\n", rnf);
+		writeFloat(mFile,"\tsetAttr \".rnf\" ",rnf,";\n");
 	}
 	void setPower(float dp)
 	{
 		if(dp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dp\" %f;\n", dp);
+		writeFloat(mFile,"\tsetAttr \".dp\" ",dp,";\n");
 	}
 	void setPowerMapOffset(float pmo)
 	{
 		if(pmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pmo\" %f;\n", pmo);
+		writeFloat(mFile,"\tsetAttr \".pmo\" ",pmo,";\n");
 	}
 	void setPowerMapMult(float pmm)
 	{
 		if(pmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pmm\" %f;\n", pmm);
+		writeFloat(mFile,"\tsetAttr \".pmm\" ",pmm,";\n");
 	}
 	void setPowerNoise(float pn)
 	{
 		if(pn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pn\" %f;\n", pn);
+		writeFloat(mFile,"\tsetAttr \".pn\" ",pn,";\n");
 	}
 	void setPowerNoiseFreq(float pnf)
 	{
 		if(pnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".pnf\" %f;\n", pnf);
+		writeFloat(mFile,"\tsetAttr \".pnf\" ",pnf,";\n");
 	}
 	void setInfluence(float di)
 	{
 		if(di == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".di\" %f;\n", di);
+		writeFloat(mFile,"\tsetAttr \".di\" ",di,";\n");
 	}
 	void setInfluenceMapOffset(float imo)
 	{
 		if(imo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imo\" %f;\n", imo);
+		writeFloat(mFile,"\tsetAttr \".imo\" ",imo,";\n");
 	}
 	void setInfluenceMapMult(float imm)
 	{
 		if(imm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".imm\" %f;\n", imm);
+		writeFloat(mFile,"\tsetAttr \".imm\" ",imm,";\n");
 	}
 	void setInfluenceNoise(float in)
 	{
 		if(in == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".in\" %f;\n", in);
+		writeFloat(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setInfluenceNoiseFreq(float inf)
 	{
 		if(inf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".inf\" %f;\n", inf);
+		writeFloat(mFile,"\tsetAttr \".inf\" ",inf,";\n");
 	}
 	void setStartLength(float dsl)
 	{
 		if(dsl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dsl\" %f;\n", dsl);
+		writeFloat(mFile,"\tsetAttr \".dsl\" ",dsl,";\n");
 	}
 	void setStartLengthMapOffset(double slmo)
 	{
 		if(slmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".slmo\" %f;\n", slmo);
+		writeFloat(mFile,"\tsetAttr \".slmo\" ",slmo,";\n");
 	}
 	void setStartLengthMapMult(double slmm)
 	{
 		if(slmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".slmm\" %f;\n", slmm);
+		writeFloat(mFile,"\tsetAttr \".slmm\" ",slmm,";\n");
 	}
 	void setStartLengthNoise(double sln)
 	{
 		if(sln == 0) return;
-		fprintf(mFile,"\tsetAttr \".sln\" %f;\n", sln);
+		writeFloat(mFile,"\tsetAttr \".sln\" ",sln,";\n");
 	}
 	void setStartLengthNoiseFreq(float slnf)
 	{
 		if(slnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".slnf\" %f;\n", slnf);
+		writeFloat(mFile,"\tsetAttr \".slnf\" ",slnf,";\n");
 	}
 	void setEndLength(float del)
 	{
 		if(del == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".del\" %f;\n", del);
+		writeFloat(mFile,"\tsetAttr \".del\" ",del,";\n");
 	}
 	void setEndLengthMapOffset(double elmo)
 	{
 		if(elmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".elmo\" %f;\n", elmo);
+		writeFloat(mFile,"\tsetAttr \".elmo\" ",elmo,";\n");
 	}
 	void setEndLengthMapMult(double elmm)
 	{
 		if(elmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".elmm\" %f;\n", elmm);
+		writeFloat(mFile,"\tsetAttr \".elmm\" ",elmm,";\n");
 	}
 	void setEndLengthNoise(double eln)
 	{
 		if(eln == 0) return;
-		fprintf(mFile,"\tsetAttr \".eln\" %f;\n", eln);
+		writeFloat(mFile,"\tsetAttr \".eln\" ",eln,";\n");
 	}
 	void setEndLengthNoiseFreq(float elnf)
 	{
 		if(elnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".elnf\" %f;\n", elnf);
+		writeFloat(mFile,"\tsetAttr \".elnf\" ",elnf,";\n");
 	}
 	void setThresholdLength(float dtl)
 	{
 		if(dtl == 0.33) return;
-		fprintf(mFile,"\tsetAttr \".dtl\" %f;\n", dtl);
+		writeFloat(mFile,"\tsetAttr \".dtl\" ",dtl,";\n");
 	}
 	void setThresholdLengthMapOffset(double tlmo)
 	{
 		if(tlmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".tlmo\" %f;\n", tlmo);
+		writeFloat(mFile,"\tsetAttr \".tlmo\" ",tlmo,";\n");
 	}
 	void setThresholdLengthMapMult(double tlmm)
 	{
 		if(tlmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".tlmm\" %f;\n", tlmm);
+		writeFloat(mFile,"\tsetAttr \".tlmm\" ",tlmm,";\n");
 	}
 	void setThresholdLengthNoise(double tln)
 	{
 		if(tln == 0) return;
-		fprintf(mFile,"\tsetAttr \".tln\" %f;\n", tln);
+		writeFloat(mFile,"\tsetAttr \".tln\" ",tln,";\n");
 	}
 	void setThresholdLengthNoiseFreq(float tlnf)
 	{
 		if(tlnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".tlnf\" %f;\n", tlnf);
+		writeFloat(mFile,"\tsetAttr \".tlnf\" ",tlnf,";\n");
 	}
 	void getAttractorModel()const
 	{
-		fprintf(mFile,"\"%s.amd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amd\"");
 	}
 	void getDagSetMembers()const
 	{
-		fprintf(mFile,"\"%s.dsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsm\"");
 	}
 	void getAttractors()const
 	{
-		fprintf(mFile,"\"%s.att\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".att\"");
 	}
 	void getFurGlobals()const
 	{
-		fprintf(mFile,"\"%s.fgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fgc\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 	void getRadiusMap()const
 	{
-		fprintf(mFile,"\"%s.rm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rm\"");
 	}
 	void getRadiusMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.rmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmus\"");
 	}
 	void getRadiusMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.rmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmvs\"");
 	}
 	void getRadiusMapOffset()const
 	{
-		fprintf(mFile,"\"%s.rmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmo\"");
 	}
 	void getRadiusMapMult()const
 	{
-		fprintf(mFile,"\"%s.rmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmm\"");
 	}
 	void getRadiusNoise()const
 	{
-		fprintf(mFile,"\"%s.rn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rn\"");
 	}
 	void getPower()const
 	{
-		fprintf(mFile,"\"%s.dp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dp\"");
 	}
 	void getPowerMap()const
 	{
-		fprintf(mFile,"\"%s.pm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pm\"");
 	}
 	void getPowerMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.pmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmus\"");
 	}
 	void getPowerMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.pmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmvs\"");
 	}
 	void getPowerMapOffset()const
 	{
-		fprintf(mFile,"\"%s.pmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmo\"");
 	}
 	void getPowerMapMult()const
 	{
-		fprintf(mFile,"\"%s.pmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmm\"");
 	}
 	void getPowerNoise()const
 	{
-		fprintf(mFile,"\"%s.pn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pn\"");
 	}
 	void getInfluence()const
 	{
-		fprintf(mFile,"\"%s.di\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di\"");
 	}
 	void getInfluenceMap()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getInfluenceMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.imus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imus\"");
 	}
 	void getInfluenceMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.imvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imvs\"");
 	}
 	void getInfluenceMapOffset()const
 	{
-		fprintf(mFile,"\"%s.imo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imo\"");
 	}
 	void getInfluenceMapMult()const
 	{
-		fprintf(mFile,"\"%s.imm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imm\"");
 	}
 	void getInfluenceNoise()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getStartLength()const
 	{
-		fprintf(mFile,"\"%s.dsl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsl\"");
 	}
 	void getStartLengthMap()const
 	{
-		fprintf(mFile,"\"%s.slm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slm\"");
 	}
 	void getStartLengthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.slmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slmus\"");
 	}
 	void getStartLengthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.slmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slmvs\"");
 	}
 	void getStartLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.slmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slmo\"");
 	}
 	void getStartLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.slmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slmm\"");
 	}
 	void getStartLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.sln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sln\"");
 	}
 	void getEndLength()const
 	{
-		fprintf(mFile,"\"%s.del\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".del\"");
 	}
 	void getEndLengthMap()const
 	{
-		fprintf(mFile,"\"%s.elm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".elm\"");
 	}
 	void getEndLengthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.elmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".elmus\"");
 	}
 	void getEndLengthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.elmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".elmvs\"");
 	}
 	void getEndLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.elmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".elmo\"");
 	}
 	void getEndLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.elmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".elmm\"");
 	}
 	void getEndLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.eln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eln\"");
 	}
 	void getThresholdLength()const
 	{
-		fprintf(mFile,"\"%s.dtl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtl\"");
 	}
 	void getThresholdLengthMap()const
 	{
-		fprintf(mFile,"\"%s.tlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlm\"");
 	}
 	void getThresholdLengthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.tlmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlmus\"");
 	}
 	void getThresholdLengthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.tlmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlmvs\"");
 	}
 	void getThresholdLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.tlmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlmo\"");
 	}
 	void getThresholdLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.tlmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlmm\"");
 	}
 	void getThresholdLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.tln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tln\"");
 	}
 protected:
 	FurAttractors(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
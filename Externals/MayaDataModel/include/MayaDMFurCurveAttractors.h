@@ -63,351 +63,351 @@ public:
 	void setCurveAttractorModel(unsigned int camd)
 	{
 		if(camd == 0) return;
-		fprintf(mFile,"\tsetAttr \".camd\" %i;\n", camd);
+		writeInt(mFile,"\tsetAttr \".camd\" ",camd,";\n");
 	}
 	void setCurveAttractorsPerHair(int caph)
 	{
 		if(caph == 1) return;
-		fprintf(mFile,"\tsetAttr \".caph\" %i;\n", caph);
+		writeInt(mFile,"\tsetAttr \".caph\" ",caph,";\n");
 	}
 	void setCurveGlobalScale(float cgs)
 	{
 		if(cgs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cgs\" %f;\n", cgs);
+		writeFloat(mFile,"\tsetAttr \".cgs\" ",cgs,";\n");
 	}
 	void setCurveRadius(double dcr)
 	{
 		if(dcr == 1) return;
-		fprintf(mFile,"\tsetAttr \".dcr\" %f;\n", dcr);
+		writeFloat(mFile,"\tsetAttr \".dcr\" ",dcr,";\n");
 	}
 	void setCurveRadiusMapOffset(double crmo)
 	{
 		if(crmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".crmo\" %f;\n", crmo);
+		writeFloat(mFile,"\tsetAttr \".crmo\" ",crmo,";\n");
 	}
 	void setCurveRadiusMapMult(double crmm)
 	{
 		if(crmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".crmm\" %f;\n", crmm);
+		writeFloat(mFile,"\tsetAttr \".crmm\" ",crmm,";\n");
 	}
 	void setCurveRadiusNoise(double crn)
 	{
 		if(crn == 0) return;
-		fprintf(mFile,"\tsetAttr \".crn\" %f;\n", crn);
+		writeFloat(mFile,"\tsetAttr \".crn\" ",crn,";\n");
 	}
 	void setCurveRadiusNoiseFreq(float crnf)
 	{
 		if(crnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".crnf\" %f;\n", crnf);
+		writeFloat(mFile,"\tsetAttr \".crnf\" ",crnf,";\n");
 	}
 	void setCurvePower(float dcp)
 	{
 		if(dcp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dcp\" %f;\n", dcp);
+		writeFloat(mFile,"\tsetAttr \".dcp\" ",dcp,";\n");
 	}
 	void setCurvePowerMapOffset(float cpmo)
 	{
 		if(cpmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cpmo\" %f;\n", cpmo);
+		writeFloat(mFile,"\tsetAttr \".cpmo\" ",cpmo,";\n");
 	}
 	void setCurvePowerMapMult(float cpmm)
 	{
 		if(cpmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cpmm\" %f;\n", cpmm);
+		writeFloat(mFile,"\tsetAttr \".cpmm\" ",cpmm,";\n");
 	}
 	void setCurvePowerNoise(float cpn)
 	{
 		if(cpn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cpn\" %f;\n", cpn);
+		writeFloat(mFile,"\tsetAttr \".cpn\" ",cpn,";\n");
 	}
 	void setCurvePowerNoiseFreq(float cpnf)
 	{
 		if(cpnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".cpnf\" %f;\n", cpnf);
+		writeFloat(mFile,"\tsetAttr \".cpnf\" ",cpnf,";\n");
 	}
 	void setCurveInfluence(float dci)
 	{
 		if(dci == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dci\" %f;\n", dci);
+		writeFloat(mFile,"\tsetAttr \".dci\" ",dci,";\n");
 	}
 	void setCurveInfluenceMapOffset(float cimo)
 	{
 		if(cimo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cimo\" %f;\n", cimo);
+		writeFloat(mFile,"\tsetAttr \".cimo\" ",cimo,";\n");
 	}
 	void setCurveInfluenceMapMult(float cimm)
 	{
 		if(cimm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cimm\" %f;\n", cimm);
+		writeFloat(mFile,"\tsetAttr \".cimm\" ",cimm,";\n");
 	}
 	void setCurveInfluenceNoise(float cin)
 	{
 		if(cin == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cin\" %f;\n", cin);
+		writeFloat(mFile,"\tsetAttr \".cin\" ",cin,";\n");
 	}
 	void setCurveInfluenceNoiseFreq(float cinf)
 	{
 		if(cinf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".cinf\" %f;\n", cinf);
+		writeFloat(mFile,"\tsetAttr \".cinf\" ",cinf,";\n");
 	}
 	void setCurveStartLength(float dcsl)
 	{
 		if(dcsl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcsl\" %f;\n", dcsl);
+		writeFloat(mFile,"\tsetAttr \".dcsl\" ",dcsl,";\n");
 	}
 	void setCurveStartLengthMapOffset(double cslmo)
 	{
 		if(cslmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".cslmo\" %f;\n", cslmo);
+		writeFloat(mFile,"\tsetAttr \".cslmo\" ",cslmo,";\n");
 	}
 	void setCurveStartLengthMapMult(double cslmm)
 	{
 		if(cslmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".cslmm\" %f;\n", cslmm);
+		writeFloat(mFile,"\tsetAttr \".cslmm\" ",cslmm,";\n");
 	}
 	void setCurveStartLengthNoise(double csln)
 	{
 		if(csln == 0) return;
-		fprintf(mFile,"\tsetAttr \".csln\" %f;\n", csln);
+		writeFloat(mFile,"\tsetAttr \".csln\" ",csln,";\n");
 	}
 	void setCurveStartLengthNoiseFreq(float cslnf)
 	{
 		if(cslnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".cslnf\" %f;\n", cslnf);
+		writeFloat(mFile,"\tsetAttr \".cslnf\" ",cslnf,";\n");
 	}
 	void setCurveEndLength(float dcel)
 	{
 		if(dcel == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".dcel\" %f;\n", dcel);
+		writeFloat(mFile,"\tsetAttr \".dcel\" ",dcel,";\n");
 	}
 	void setCurveEndLengthMapOffset(double celmo)
 	{
 		if(celmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".celmo\" %f;\n", celmo);
+		writeFloat(mFile,"\tsetAttr \".celmo\" ",celmo,";\n");
 	}
 	void setCurveEndLengthMapMult(double celmm)
 	{
 		if(celmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".celmm\" %f;\n", celmm);
+		writeFloat(mFile,"\tsetAttr \".celmm\" ",celmm,";\n");
 	}
 	void setCurveEndLengthNoise(double celn)
 	{
 		if(celn == 0) return;
-		fprintf(mFile,"\tsetAttr \".celn\" %f;\n", celn);
+		writeFloat(mFile,"\tsetAttr \".celn\" ",celn,";\n");
 	}
 	void setCurveEndLengthNoiseFreq(float celnf)
 	{
 		if(celnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".celnf\" %f;\n", celnf);
+		writeFloat(mFile,"\tsetAttr \".celnf\" ",celnf,";\n");
 	}
 	void setCurveThresholdLength(float dctl)
 	{
 		if(dctl == 0.33) return;
-		fprintf(mFile,"\tsetAttr \".dctl\" %f;\n", dctl);
+		writeFloat(mFile,"\tsetAttr \".dctl\" ",dctl,";\n");
 	}
 	void setCurveThresholdLengthMapOffset(double ctlmo)
 	{
 		if(ctlmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".ctlmo\" %f;\n", ctlmo);
+		writeFloat(mFile,"\tsetAttr \".ctlmo\" ",ctlmo,";\n");
 	}
 	void setCurveThresholdLengthMapMult(double ctlmm)
 	{
 		if(ctlmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".ctlmm\" %f;\n", ctlmm);
+		writeFloat(mFile,"\tsetAttr \".ctlmm\" ",ctlmm,";\n");
 	}
 	void setCurveThresholdLengthNoise(double ctln)
 	{
 		if(ctln == 0) return;
-		fprintf(mFile,"\tsetAttr \".ctln\" %f;\n", ctln);
+		writeFloat(mFile,"\tsetAttr \".ctln\" ",ctln,";\n");
 	}
 	void setCurveThresholdLengthNoiseFreq(float ctlnf)
 	{
 		if(ctlnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".ctlnf\" %f;\n", ctlnf);
+		writeFloat(mFile,"\tsetAttr \".ctlnf\" ",ctlnf,";\n");
 	}
 	void getCurveAttractorModel()const
 	{
-		fprintf(mFile,"\"%s.camd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".camd\"");
 	}
 	void getDagSetMembers()const
 	{
-		fprintf(mFile,"\"%s.dsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsm\"");
 	}
 	void getCurveAttractors()const
 	{
-		fprintf(mFile,"\"%s.catt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".catt\"");
 	}
 	void getFurGlobals()const
 	{
-		fprintf(mFile,"\"%s.fgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fgc\"");
 	}
 	void getCurveRadius()const
 	{
-		fprintf(mFile,"\"%s.dcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcr\"");
 	}
 	void getCurveRadiusMap()const
 	{
-		fprintf(mFile,"\"%s.crm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crm\"");
 	}
 	void getCurveRadiusMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.crmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crmus\"");
 	}
 	void getCurveRadiusMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.crmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crmvs\"");
 	}
 	void getCurveRadiusMapOffset()const
 	{
-		fprintf(mFile,"\"%s.crmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crmo\"");
 	}
 	void getCurveRadiusMapMult()const
 	{
-		fprintf(mFile,"\"%s.crmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crmm\"");
 	}
 	void getCurveRadiusNoise()const
 	{
-		fprintf(mFile,"\"%s.crn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crn\"");
 	}
 	void getCurvePower()const
 	{
-		fprintf(mFile,"\"%s.dcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcp\"");
 	}
 	void getCurvePowerMap()const
 	{
-		fprintf(mFile,"\"%s.cpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpm\"");
 	}
 	void getCurvePowerMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.cpmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpmus\"");
 	}
 	void getCurvePowerMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.cpmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpmvs\"");
 	}
 	void getCurvePowerMapOffset()const
 	{
-		fprintf(mFile,"\"%s.cpmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpmo\"");
 	}
 	void getCurvePowerMapMult()const
 	{
-		fprintf(mFile,"\"%s.cpmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpmm\"");
 	}
 	void getCurvePowerNoise()const
 	{
-		fprintf(mFile,"\"%s.cpn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpn\"");
 	}
 	void getCurveInfluence()const
 	{
-		fprintf(mFile,"\"%s.dci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dci\"");
 	}
 	void getCurveInfluenceMap()const
 	{
-		fprintf(mFile,"\"%s.cim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cim\"");
 	}
 	void getCurveInfluenceMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.cimus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cimus\"");
 	}
 	void getCurveInfluenceMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.cimvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cimvs\"");
 	}
 	void getCurveInfluenceMapOffset()const
 	{
-		fprintf(mFile,"\"%s.cimo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cimo\"");
 	}
 	void getCurveInfluenceMapMult()const
 	{
-		fprintf(mFile,"\"%s.cimm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cimm\"");
 	}
 	void getCurveInfluenceNoise()const
 	{
-		fprintf(mFile,"\"%s.cin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cin\"");
 	}
 	void getCurveStartLength()const
 	{
-		fprintf(mFile,"\"%s.dcsl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcsl\"");
 	}
 	void getCurveStartLengthMap()const
 	{
-		fprintf(mFile,"\"%s.cslm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cslm\"");
 	}
 	void getCurveStartLengthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.cslmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cslmus\"");
 	}
 	void getCurveStartLengthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.cslmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cslmvs\"");
 	}
 	void getCurveStartLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.cslmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cslmo\"");
 	}
 	void getCurveStartLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.cslmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cslmm\"");
 	}
 	void getCurveStartLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.csln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csln\"");
 	}
 	void getCurveEndLength()const
 	{
-		fprintf(mFile,"\"%s.dcel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcel\"");
 	}
 	void getCurveEndLengthMap()const
 	{
-		fprintf(mFile,"\"%s.celm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".celm\"");
 	}
 	void getCurveEndLengthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.celmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".celmus\"");
 	}
 	void getCurveEndLengthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.celmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".celmvs\"");
 	}
 	void getCurveEndLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.celmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".celmo\"");
 	}
 	void getCurveEndLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.celmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".celmm\"");
 	}
 	void getCurveEndLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.celn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".celn\"");
 	}
 	void getCurveThresholdLength()const
 	{
-		fprintf(mFile,"\"%s.dctl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dctl\"");
 	}
 	void getCurveThresholdLengthMap()const
 	{
-		fprintf(mFile,"\"%s.ctlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctlm\"");
 	}
 	void getCurveThresholdLengthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.ctlmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctlmus\"");
 	}
 	void getCurveThresholdLengthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.ctlmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctlmvs\"");
 	}
 	void getCurveThresholdLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.ctlmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctlmo\"");
 	}
 	void getCurveThresholdLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.ctlmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctlmm\"");
 	}
 	void getCurveThresholdLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.ctln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctln\"");
 	}
 protected:
 	FurCurveAttractors(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
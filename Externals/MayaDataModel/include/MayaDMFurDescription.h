@@ -183,1466 +183,1466 @@ public:
 	void setLightModel(unsigned int lmd)
 	{
 		if(lmd == 2) return;
-		fprintf(mFile,"\tsetAttr \".lmd\" %i;\n", lmd);
+		writeInt(mFile,"\tsetAttr \".lmd\" ",lmd,";\n");
 	}
 	void setDensity(int d)
 	{
 		if(d == 1000.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setGlobalScale(float gs)
 	{
 		if(gs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gs\" %f;\n", gs);
+		writeFloat(mFile,"\tsetAttr \".gs\" ",gs,";\n");
 	}
 	void setBaseColor(const float3& dbc)
 	{
 		if(dbc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".dbc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dbc\" -type \"float3\" ");
 		dbc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseColorR(float dbcr)
 	{
 		if(dbcr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dbcr\" %f;\n", dbcr);
+		writeFloat(mFile,"\tsetAttr \".dbcr\" ",dbcr,";\n");
 	}
 	void setBaseColorG(float dbcg)
 	{
 		if(dbcg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dbcg\" %f;\n", dbcg);
+		writeFloat(mFile,"\tsetAttr \".dbcg\" ",dbcg,";\n");
 	}
 	void setBaseColorB(float dbcb)
 	{
 		if(dbcb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dbcb\" %f;\n", dbcb);
+		writeFloat(mFile,"\tsetAttr \".dbcb\" ",dbcb,";\n");
 	}
 	void setBaseColorNoise(float bcn)
 	{
 		if(bcn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcn\" %f;\n", bcn);
+		writeFloat(mFile,"\tsetAttr \".bcn\" ",bcn,";\n");
 	}
 	void setBaseColorNoiseFreq(float bcnf)
 	{
 		if(bcnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bcnf\" %f;\n", bcnf);
+		writeFloat(mFile,"\tsetAttr \".bcnf\" ",bcnf,";\n");
 	}
 	void setTipColor(const float3& dtc)
 	{
 		if(dtc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".dtc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dtc\" -type \"float3\" ");
 		dtc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipColorR(float dtcr)
 	{
 		if(dtcr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dtcr\" %f;\n", dtcr);
+		writeFloat(mFile,"\tsetAttr \".dtcr\" ",dtcr,";\n");
 	}
 	void setTipColorG(float dtcg)
 	{
 		if(dtcg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dtcg\" %f;\n", dtcg);
+		writeFloat(mFile,"\tsetAttr \".dtcg\" ",dtcg,";\n");
 	}
 	void setTipColorB(float dtcb)
 	{
 		if(dtcb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dtcb\" %f;\n", dtcb);
+		writeFloat(mFile,"\tsetAttr \".dtcb\" ",dtcb,";\n");
 	}
 	void setTipColorNoise(float tcn)
 	{
 		if(tcn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcn\" %f;\n", tcn);
+		writeFloat(mFile,"\tsetAttr \".tcn\" ",tcn,";\n");
 	}
 	void setTipColorNoiseFreq(float tcnf)
 	{
 		if(tcnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".tcnf\" %f;\n", tcnf);
+		writeFloat(mFile,"\tsetAttr \".tcnf\" ",tcnf,";\n");
 	}
 	void setBaseAmbientColor(const float3& dbac)
 	{
 		if(dbac == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".dbac\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dbac\" -type \"float3\" ");
 		dbac.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseAmbientColorR(float dbacr)
 	{
 		if(dbacr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dbacr\" %f;\n", dbacr);
+		writeFloat(mFile,"\tsetAttr \".dbacr\" ",dbacr,";\n");
 	}
 	void setBaseAmbientColorG(float dbacg)
 	{
 		if(dbacg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dbacg\" %f;\n", dbacg);
+		writeFloat(mFile,"\tsetAttr \".dbacg\" ",dbacg,";\n");
 	}
 	void setBaseAmbientColorB(float dbacb)
 	{
 		if(dbacb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dbacb\" %f;\n", dbacb);
+		writeFloat(mFile,"\tsetAttr \".dbacb\" ",dbacb,";\n");
 	}
 	void setBaseAmbientColorNoise(float bacn)
 	{
 		if(bacn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bacn\" %f;\n", bacn);
+		writeFloat(mFile,"\tsetAttr \".bacn\" ",bacn,";\n");
 	}
 	void setBaseAmbientColorNoiseFreq(float bacnf)
 	{
 		if(bacnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bacnf\" %f;\n", bacnf);
+		writeFloat(mFile,"\tsetAttr \".bacnf\" ",bacnf,";\n");
 	}
 	void setTipAmbientColor(const float3& dtac)
 	{
 		if(dtac == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".dtac\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dtac\" -type \"float3\" ");
 		dtac.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipAmbientColorR(float dtacr)
 	{
 		if(dtacr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtacr\" %f;\n", dtacr);
+		writeFloat(mFile,"\tsetAttr \".dtacr\" ",dtacr,";\n");
 	}
 	void setTipAmbientColorG(float dtacg)
 	{
 		if(dtacg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtacg\" %f;\n", dtacg);
+		writeFloat(mFile,"\tsetAttr \".dtacg\" ",dtacg,";\n");
 	}
 	void setTipAmbientColorB(float dtacb)
 	{
 		if(dtacb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtacb\" %f;\n", dtacb);
+		writeFloat(mFile,"\tsetAttr \".dtacb\" ",dtacb,";\n");
 	}
 	void setTipAmbientColorNoise(float tacn)
 	{
 		if(tacn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tacn\" %f;\n", tacn);
+		writeFloat(mFile,"\tsetAttr \".tacn\" ",tacn,";\n");
 	}
 	void setTipAmbientColorNoiseFreq(float tacnf)
 	{
 		if(tacnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".tacnf\" %f;\n", tacnf);
+		writeFloat(mFile,"\tsetAttr \".tacnf\" ",tacnf,";\n");
 	}
 	void setSpecularColor(const float3& dsc)
 	{
 		if(dsc == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".dsc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dsc\" -type \"float3\" ");
 		dsc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColorR(float dscr)
 	{
 		if(dscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dscr\" %f;\n", dscr);
+		writeFloat(mFile,"\tsetAttr \".dscr\" ",dscr,";\n");
 	}
 	void setSpecularColorG(float dscg)
 	{
 		if(dscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dscg\" %f;\n", dscg);
+		writeFloat(mFile,"\tsetAttr \".dscg\" ",dscg,";\n");
 	}
 	void setSpecularColorB(float dscb)
 	{
 		if(dscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dscb\" %f;\n", dscb);
+		writeFloat(mFile,"\tsetAttr \".dscb\" ",dscb,";\n");
 	}
 	void setSpecularColorNoise(float scn)
 	{
 		if(scn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scn\" %f;\n", scn);
+		writeFloat(mFile,"\tsetAttr \".scn\" ",scn,";\n");
 	}
 	void setSpecularColorNoiseFreq(float scnf)
 	{
 		if(scnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".scnf\" %f;\n", scnf);
+		writeFloat(mFile,"\tsetAttr \".scnf\" ",scnf,";\n");
 	}
 	void setLength(double dl)
 	{
 		if(dl == 1) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %f;\n", dl);
+		writeFloat(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setLengthMapOffset(double lmo)
 	{
 		if(lmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".lmo\" %f;\n", lmo);
+		writeFloat(mFile,"\tsetAttr \".lmo\" ",lmo,";\n");
 	}
 	void setLengthMapMult(double lmm)
 	{
 		if(lmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".lmm\" %f;\n", lmm);
+		writeFloat(mFile,"\tsetAttr \".lmm\" ",lmm,";\n");
 	}
 	void setLengthNoise(double ln)
 	{
 		if(ln == 0) return;
-		fprintf(mFile,"\tsetAttr \".ln\" %f;\n", ln);
+		writeFloat(mFile,"\tsetAttr \".ln\" ",ln,";\n");
 	}
 	void setLengthNoiseFreq(float lnf)
 	{
 		if(lnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".lnf\" %f;\n", lnf);
+		writeFloat(mFile,"\tsetAttr \".lnf\" ",lnf,";\n");
 	}
 	void setSpecularSharpness(double dss)
 	{
 		if(dss == 5) return;
-		fprintf(mFile,"\tsetAttr \".dss\" %f;\n", dss);
+		writeFloat(mFile,"\tsetAttr \".dss\" ",dss,";\n");
 	}
 	void setSpecularSharpnessMapOffset(double ssmo)
 	{
 		if(ssmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".ssmo\" %f;\n", ssmo);
+		writeFloat(mFile,"\tsetAttr \".ssmo\" ",ssmo,";\n");
 	}
 	void setSpecularSharpnessMapMult(double ssmm)
 	{
 		if(ssmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".ssmm\" %f;\n", ssmm);
+		writeFloat(mFile,"\tsetAttr \".ssmm\" ",ssmm,";\n");
 	}
 	void setSpecularSharpnessNoise(double ssn)
 	{
 		if(ssn == 0) return;
-		fprintf(mFile,"\tsetAttr \".ssn\" %f;\n", ssn);
+		writeFloat(mFile,"\tsetAttr \".ssn\" ",ssn,";\n");
 	}
 	void setSpecularSharpnessNoiseFreq(float ssnf)
 	{
 		if(ssnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".ssnf\" %f;\n", ssnf);
+		writeFloat(mFile,"\tsetAttr \".ssnf\" ",ssnf,";\n");
 	}
 	void setBaldness(double db)
 	{
 		if(db == 1) return;
-		fprintf(mFile,"\tsetAttr \".db\" %f;\n", db);
+		writeFloat(mFile,"\tsetAttr \".db\" ",db,";\n");
 	}
 	void setBaldnessMapOffset(double bmo)
 	{
 		if(bmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".bmo\" %f;\n", bmo);
+		writeFloat(mFile,"\tsetAttr \".bmo\" ",bmo,";\n");
 	}
 	void setBaldnessMapMult(double bmm)
 	{
 		if(bmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".bmm\" %f;\n", bmm);
+		writeFloat(mFile,"\tsetAttr \".bmm\" ",bmm,";\n");
 	}
 	void setBaldnessNoise(double bn)
 	{
 		if(bn == 0) return;
-		fprintf(mFile,"\tsetAttr \".bn\" %f;\n", bn);
+		writeFloat(mFile,"\tsetAttr \".bn\" ",bn,";\n");
 	}
 	void setBaldnessNoiseFreq(float bnf)
 	{
 		if(bnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bnf\" %f;\n", bnf);
+		writeFloat(mFile,"\tsetAttr \".bnf\" ",bnf,";\n");
 	}
 	void setBaseOpacity(double dbo)
 	{
 		if(dbo == 1) return;
-		fprintf(mFile,"\tsetAttr \".dbo\" %f;\n", dbo);
+		writeFloat(mFile,"\tsetAttr \".dbo\" ",dbo,";\n");
 	}
 	void setBaseOpacityMapOffset(double bomo)
 	{
 		if(bomo == 0) return;
-		fprintf(mFile,"\tsetAttr \".bomo\" %f;\n", bomo);
+		writeFloat(mFile,"\tsetAttr \".bomo\" ",bomo,";\n");
 	}
 	void setBaseOpacityMapMult(double bomm)
 	{
 		if(bomm == 1) return;
-		fprintf(mFile,"\tsetAttr \".bomm\" %f;\n", bomm);
+		writeFloat(mFile,"\tsetAttr \".bomm\" ",bomm,";\n");
 	}
 	void setBaseOpacityNoise(double bon)
 	{
 		if(bon == 0) return;
-		fprintf(mFile,"\tsetAttr \".bon\" %f;\n", bon);
+		writeFloat(mFile,"\tsetAttr \".bon\" ",bon,";\n");
 	}
 	void setBaseOpacityNoiseFreq(float bonf)
 	{
 		if(bonf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bonf\" %f;\n", bonf);
+		writeFloat(mFile,"\tsetAttr \".bonf\" ",bonf,";\n");
 	}
 	void setTipOpacity(double dto)
 	{
 		if(dto == 1) return;
-		fprintf(mFile,"\tsetAttr \".dto\" %f;\n", dto);
+		writeFloat(mFile,"\tsetAttr \".dto\" ",dto,";\n");
 	}
 	void setTipOpacityMapOffset(double tomo)
 	{
 		if(tomo == 0) return;
-		fprintf(mFile,"\tsetAttr \".tomo\" %f;\n", tomo);
+		writeFloat(mFile,"\tsetAttr \".tomo\" ",tomo,";\n");
 	}
 	void setTipOpacityMapMult(double tomm)
 	{
 		if(tomm == 1) return;
-		fprintf(mFile,"\tsetAttr \".tomm\" %f;\n", tomm);
+		writeFloat(mFile,"\tsetAttr \".tomm\" ",tomm,";\n");
 	}
 	void setTipOpacityNoise(double ton)
 	{
 		if(ton == 0) return;
-		fprintf(mFile,"\tsetAttr \".ton\" %f;\n", ton);
+		writeFloat(mFile,"\tsetAttr \".ton\" ",ton,";\n");
 	}
 	void setTipOpacityNoiseFreq(float tonf)
 	{
 		if(tonf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".tonf\" %f;\n", tonf);
+		writeFloat(mFile,"\tsetAttr \".tonf\" ",tonf,";\n");
 	}
 	void setBaseWidth(double dbw)
 	{
 		if(dbw == 0) return;
-		fprintf(mFile,"\tsetAttr \".dbw\" %f;\n", dbw);
+		writeFloat(mFile,"\tsetAttr \".dbw\" ",dbw,";\n");
 	}
 	void setBaseWidthMapOffset(double bwmo)
 	{
 		if(bwmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".bwmo\" %f;\n", bwmo);
+		writeFloat(mFile,"\tsetAttr \".bwmo\" ",bwmo,";\n");
 	}
 	void setBaseWidthMapMult(double bwmm)
 	{
 		if(bwmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".bwmm\" %f;\n", bwmm);
+		writeFloat(mFile,"\tsetAttr \".bwmm\" ",bwmm,";\n");
 	}
 	void setBaseWidthNoise(double bwn)
 	{
 		if(bwn == 0) return;
-		fprintf(mFile,"\tsetAttr \".bwn\" %f;\n", bwn);
+		writeFloat(mFile,"\tsetAttr \".bwn\" ",bwn,";\n");
 	}
 	void setBaseWidthNoiseFreq(float bwnf)
 	{
 		if(bwnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bwnf\" %f;\n", bwnf);
+		writeFloat(mFile,"\tsetAttr \".bwnf\" ",bwnf,";\n");
 	}
 	void setTipWidth(double dtw)
 	{
 		if(dtw == 0) return;
-		fprintf(mFile,"\tsetAttr \".dtw\" %f;\n", dtw);
+		writeFloat(mFile,"\tsetAttr \".dtw\" ",dtw,";\n");
 	}
 	void setTipWidthMapOffset(double twmo)
 	{
 		if(twmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".twmo\" %f;\n", twmo);
+		writeFloat(mFile,"\tsetAttr \".twmo\" ",twmo,";\n");
 	}
 	void setTipWidthMapMult(double twmm)
 	{
 		if(twmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".twmm\" %f;\n", twmm);
+		writeFloat(mFile,"\tsetAttr \".twmm\" ",twmm,";\n");
 	}
 	void setTipWidthNoise(double twn)
 	{
 		if(twn == 0) return;
-		fprintf(mFile,"\tsetAttr \".twn\" %f;\n", twn);
+		writeFloat(mFile,"\tsetAttr \".twn\" ",twn,";\n");
 	}
 	void setTipWidthNoiseFreq(float twnf)
 	{
 		if(twnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".twnf\" %f;\n", twnf);
+		writeFloat(mFile,"\tsetAttr \".twnf\" ",twnf,";\n");
 	}
 	void setSegments(double dsg)
 	{
 		if(dsg == 1) return;
-		fprintf(mFile,"\tsetAttr \".dsg\" %f;\n", dsg);
+		writeFloat(mFile,"\tsetAttr \".dsg\" ",dsg,";\n");
 	}
 	void setSegmentsMapOffset(double sgmo)
 	{
 		if(sgmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".sgmo\" %f;\n", sgmo);
+		writeFloat(mFile,"\tsetAttr \".sgmo\" ",sgmo,";\n");
 	}
 	void setSegmentsMapMult(double sgmm)
 	{
 		if(sgmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".sgmm\" %f;\n", sgmm);
+		writeFloat(mFile,"\tsetAttr \".sgmm\" ",sgmm,";\n");
 	}
 	void setSegmentsNoise(double sgn)
 	{
 		if(sgn == 0) return;
-		fprintf(mFile,"\tsetAttr \".sgn\" %f;\n", sgn);
+		writeFloat(mFile,"\tsetAttr \".sgn\" ",sgn,";\n");
 	}
 	void setSegmentsNoiseFreq(float sgnf)
 	{
 		if(sgnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".sgnf\" %f;\n", sgnf);
+		writeFloat(mFile,"\tsetAttr \".sgnf\" ",sgnf,";\n");
 	}
 	void setBaseCurl(double dbcl)
 	{
 		if(dbcl == 0) return;
-		fprintf(mFile,"\tsetAttr \".dbcl\" %f;\n", dbcl);
+		writeFloat(mFile,"\tsetAttr \".dbcl\" ",dbcl,";\n");
 	}
 	void setBaseCurlMapOffset(double bclmo)
 	{
 		if(bclmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".bclmo\" %f;\n", bclmo);
+		writeFloat(mFile,"\tsetAttr \".bclmo\" ",bclmo,";\n");
 	}
 	void setBaseCurlMapMult(double bclmm)
 	{
 		if(bclmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".bclmm\" %f;\n", bclmm);
+		writeFloat(mFile,"\tsetAttr \".bclmm\" ",bclmm,";\n");
 	}
 	void setBaseCurlNoise(double bcln)
 	{
 		if(bcln == 0) return;
-		fprintf(mFile,"\tsetAttr \".bcln\" %f;\n", bcln);
+		writeFloat(mFile,"\tsetAttr \".bcln\" ",bcln,";\n");
 	}
 	void setBaseCurlNoiseFreq(float bclnf)
 	{
 		if(bclnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bclnf\" %f;\n", bclnf);
+		writeFloat(mFile,"\tsetAttr \".bclnf\" ",bclnf,";\n");
 	}
 	void setTipCurl(double dtcl)
 	{
 		if(dtcl == 0) return;
-		fprintf(mFile,"\tsetAttr \".dtcl\" %f;\n", dtcl);
+		writeFloat(mFile,"\tsetAttr \".dtcl\" ",dtcl,";\n");
 	}
 	void setTipCurlMapOffset(double tclmo)
 	{
 		if(tclmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".tclmo\" %f;\n", tclmo);
+		writeFloat(mFile,"\tsetAttr \".tclmo\" ",tclmo,";\n");
 	}
 	void setTipCurlMapMult(double tclmm)
 	{
 		if(tclmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".tclmm\" %f;\n", tclmm);
+		writeFloat(mFile,"\tsetAttr \".tclmm\" ",tclmm,";\n");
 	}
 	void setTipCurlNoise(double tcln)
 	{
 		if(tcln == 0) return;
-		fprintf(mFile,"\tsetAttr \".tcln\" %f;\n", tcln);
+		writeFloat(mFile,"\tsetAttr \".tcln\" ",tcln,";\n");
 	}
 	void setTipCurlNoiseFreq(float tclnf)
 	{
 		if(tclnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".tclnf\" %f;\n", tclnf);
+		writeFloat(mFile,"\tsetAttr \".tclnf\" ",tclnf,";\n");
 	}
 	void setScraggle(double ds)
 	{
 		if(ds == 0) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %f;\n", ds);
+		writeFloat(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void setScraggleMapOffset(double smo)
 	{
 		if(smo == 0) return;
-		fprintf(mFile,"\tsetAttr \".smo\" %f;\n", smo);
+		writeFloat(mFile,"\tsetAttr \".smo\" ",smo,";\n");
 	}
 	void setScraggleMapMult(double smm)
 	{
 		if(smm == 1) return;
-		fprintf(mFile,"\tsetAttr \".smm\" %f;\n", smm);
+		writeFloat(mFile,"\tsetAttr \".smm\" ",smm,";\n");
 	}
 	void setScraggleNoise(double sn)
 	{
 		if(sn == 0) return;
-		fprintf(mFile,"\tsetAttr \".sn\" %f;\n", sn);
+		writeFloat(mFile,"\tsetAttr \".sn\" ",sn,";\n");
 	}
 	void setScraggleNoiseFreq(float snf)
 	{
 		if(snf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".snf\" %f;\n", snf);
+		writeFloat(mFile,"\tsetAttr \".snf\" ",snf,";\n");
 	}
 	void setScraggleFrequency(double dsf)
 	{
 		if(dsf == 5) return;
-		fprintf(mFile,"\tsetAttr \".dsf\" %f;\n", dsf);
+		writeFloat(mFile,"\tsetAttr \".dsf\" ",dsf,";\n");
 	}
 	void setScraggleFrequencyMapOffset(double sfmo)
 	{
 		if(sfmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".sfmo\" %f;\n", sfmo);
+		writeFloat(mFile,"\tsetAttr \".sfmo\" ",sfmo,";\n");
 	}
 	void setScraggleFrequencyMapMult(double sfmm)
 	{
 		if(sfmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".sfmm\" %f;\n", sfmm);
+		writeFloat(mFile,"\tsetAttr \".sfmm\" ",sfmm,";\n");
 	}
 	void setScraggleFrequencyNoise(double sfn)
 	{
 		if(sfn == 0) return;
-		fprintf(mFile,"\tsetAttr \".sfn\" %f;\n", sfn);
+		writeFloat(mFile,"\tsetAttr \".sfn\" ",sfn,";\n");
 	}
 	void setScraggleFrequencyNoiseFreq(float sfnf)
 	{
 		if(sfnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".sfnf\" %f;\n", sfnf);
+		writeFloat(mFile,"\tsetAttr \".sfnf\" ",sfnf,";\n");
 	}
 	void setScraggleCorrelation(double dsco)
 	{
 		if(dsco == 0) return;
-		fprintf(mFile,"\tsetAttr \".dsco\" %f;\n", dsco);
+		writeFloat(mFile,"\tsetAttr \".dsco\" ",dsco,";\n");
 	}
 	void setScraggleCorrelationMapOffset(double scomo)
 	{
 		if(scomo == 0) return;
-		fprintf(mFile,"\tsetAttr \".scomo\" %f;\n", scomo);
+		writeFloat(mFile,"\tsetAttr \".scomo\" ",scomo,";\n");
 	}
 	void setScraggleCorrelationMapMult(double scomm)
 	{
 		if(scomm == 1) return;
-		fprintf(mFile,"\tsetAttr \".scomm\" %f;\n", scomm);
+		writeFloat(mFile,"\tsetAttr \".scomm\" ",scomm,";\n");
 	}
 	void setScraggleCorrelationNoise(double scon)
 	{
 		if(scon == 0) return;
-		fprintf(mFile,"\tsetAttr \".scon\" %f;\n", scon);
+		writeFloat(mFile,"\tsetAttr \".scon\" ",scon,";\n");
 	}
 	void setScraggleCorrelationNoiseFreq(float sconf)
 	{
 		if(sconf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".sconf\" %f;\n", sconf);
+		writeFloat(mFile,"\tsetAttr \".sconf\" ",sconf,";\n");
 	}
 	void setInclination(double di)
 	{
 		if(di == 0) return;
-		fprintf(mFile,"\tsetAttr \".di\" %f;\n", di);
+		writeFloat(mFile,"\tsetAttr \".di\" ",di,";\n");
 	}
 	void setInclinationMapOffset(double imo)
 	{
 		if(imo == 0) return;
-		fprintf(mFile,"\tsetAttr \".imo\" %f;\n", imo);
+		writeFloat(mFile,"\tsetAttr \".imo\" ",imo,";\n");
 	}
 	void setInclinationMapMult(double imm)
 	{
 		if(imm == 1) return;
-		fprintf(mFile,"\tsetAttr \".imm\" %f;\n", imm);
+		writeFloat(mFile,"\tsetAttr \".imm\" ",imm,";\n");
 	}
 	void setInclinationNoise(double in)
 	{
 		if(in == 0) return;
-		fprintf(mFile,"\tsetAttr \".in\" %f;\n", in);
+		writeFloat(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setInclinationNoiseFreq(float inf)
 	{
 		if(inf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".inf\" %f;\n", inf);
+		writeFloat(mFile,"\tsetAttr \".inf\" ",inf,";\n");
 	}
 	void setRoll(double dr)
 	{
 		if(dr == 0) return;
-		fprintf(mFile,"\tsetAttr \".dr\" %f;\n", dr);
+		writeFloat(mFile,"\tsetAttr \".dr\" ",dr,";\n");
 	}
 	void setRollMapOffset(double rmo)
 	{
 		if(rmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".rmo\" %f;\n", rmo);
+		writeFloat(mFile,"\tsetAttr \".rmo\" ",rmo,";\n");
 	}
 	void setRollMapMult(double rmm)
 	{
 		if(rmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".rmm\" %f;\n", rmm);
+		writeFloat(mFile,"\tsetAttr \".rmm\" ",rmm,";\n");
 	}
 	void setRollNoise(double rn)
 	{
 		if(rn == 0) return;
-		fprintf(mFile,"\tsetAttr \".rn\" %f;\n", rn);
+		writeFloat(mFile,"\tsetAttr \".rn\" ",rn,";\n");
 	}
 	void setRollNoiseFreq(float rnf)
 	{
 		if(rnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".rnf\" %f;\n", rnf);
+		writeFloat(mFile,"\tsetAttr \".rnf\" ",rnf,";\n");
 	}
 	void setPolar(double dp)
 	{
 		if(dp == 0) return;
-		fprintf(mFile,"\tsetAttr \".dp\" %f;\n", dp);
+		writeFloat(mFile,"\tsetAttr \".dp\" ",dp,";\n");
 	}
 	void setPolarMapOffset(double pmo)
 	{
 		if(pmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".pmo\" %f;\n", pmo);
+		writeFloat(mFile,"\tsetAttr \".pmo\" ",pmo,";\n");
 	}
 	void setPolarMapMult(double pmm)
 	{
 		if(pmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".pmm\" %f;\n", pmm);
+		writeFloat(mFile,"\tsetAttr \".pmm\" ",pmm,";\n");
 	}
 	void setPolarNoise(double pn)
 	{
 		if(pn == 0) return;
-		fprintf(mFile,"\tsetAttr \".pn\" %f;\n", pn);
+		writeFloat(mFile,"\tsetAttr \".pn\" ",pn,";\n");
 	}
 	void setPolarNoiseFreq(float pnf)
 	{
 		if(pnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".pnf\" %f;\n", pnf);
+		writeFloat(mFile,"\tsetAttr \".pnf\" ",pnf,";\n");
 	}
 	void setAttraction(double dat)
 	{
 		if(dat == 1) return;
-		fprintf(mFile,"\tsetAttr \".dat\" %f;\n", dat);
+		writeFloat(mFile,"\tsetAttr \".dat\" ",dat,";\n");
 	}
 	void setAttractionMapOffset(double atmo)
 	{
 		if(atmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".atmo\" %f;\n", atmo);
+		writeFloat(mFile,"\tsetAttr \".atmo\" ",atmo,";\n");
 	}
 	void setAttractionMapMult(double atmm)
 	{
 		if(atmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".atmm\" %f;\n", atmm);
+		writeFloat(mFile,"\tsetAttr \".atmm\" ",atmm,";\n");
 	}
 	void setAttractionNoise(double atn)
 	{
 		if(atn == 0) return;
-		fprintf(mFile,"\tsetAttr \".atn\" %f;\n", atn);
+		writeFloat(mFile,"\tsetAttr \".atn\" ",atn,";\n");
 	}
 	void setAttractionNoiseFreq(float atnf)
 	{
 		if(atnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".atnf\" %f;\n", atnf);
+		writeFloat(mFile,"\tsetAttr \".atnf\" ",atnf,";\n");
 	}
 	void setOffset(double dofs)
 	{
 		if(dofs == 0) return;
-		fprintf(mFile,"\tsetAttr \".dofs\" %f;\n", dofs);
+		writeFloat(mFile,"\tsetAttr \".dofs\" ",dofs,";\n");
 	}
 	void setOffsetMapOffset(double ofsmo)
 	{
 		if(ofsmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".ofsmo\" %f;\n", ofsmo);
+		writeFloat(mFile,"\tsetAttr \".ofsmo\" ",ofsmo,";\n");
 	}
 	void setOffsetMapMult(double ofsmm)
 	{
 		if(ofsmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".ofsmm\" %f;\n", ofsmm);
+		writeFloat(mFile,"\tsetAttr \".ofsmm\" ",ofsmm,";\n");
 	}
 	void setOffsetNoise(double ofsn)
 	{
 		if(ofsn == 0) return;
-		fprintf(mFile,"\tsetAttr \".ofsn\" %f;\n", ofsn);
+		writeFloat(mFile,"\tsetAttr \".ofsn\" ",ofsn,";\n");
 	}
 	void setOffsetNoiseFreq(float ofsnf)
 	{
 		if(ofsnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".ofsnf\" %f;\n", ofsnf);
+		writeFloat(mFile,"\tsetAttr \".ofsnf\" ",ofsnf,";\n");
 	}
 	void setClumping(float dc)
 	{
 		if(dc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %f;\n", dc);
+		writeFloat(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void setClumpingMapOffset(float cmo)
 	{
 		if(cmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cmo\" %f;\n", cmo);
+		writeFloat(mFile,"\tsetAttr \".cmo\" ",cmo,";\n");
 	}
 	void setClumpingMapMult(float cmm)
 	{
 		if(cmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cmm\" %f;\n", cmm);
+		writeFloat(mFile,"\tsetAttr \".cmm\" ",cmm,";\n");
 	}
 	void setClumpingNoise(float cn)
 	{
 		if(cn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cn\" %f;\n", cn);
+		writeFloat(mFile,"\tsetAttr \".cn\" ",cn,";\n");
 	}
 	void setClumpingNoiseFreq(float cnf)
 	{
 		if(cnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".cnf\" %f;\n", cnf);
+		writeFloat(mFile,"\tsetAttr \".cnf\" ",cnf,";\n");
 	}
 	void setClumpingFrequency(float dcf)
 	{
 		if(dcf == 50) return;
-		fprintf(mFile,"\tsetAttr \".dcf\" %f;\n", dcf);
+		writeFloat(mFile,"\tsetAttr \".dcf\" ",dcf,";\n");
 	}
 	void setClumpingFrequencyMapOffset(float cfmo)
 	{
 		if(cfmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfmo\" %f;\n", cfmo);
+		writeFloat(mFile,"\tsetAttr \".cfmo\" ",cfmo,";\n");
 	}
 	void setClumpingFrequencyMapMult(float cfmm)
 	{
 		if(cfmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cfmm\" %f;\n", cfmm);
+		writeFloat(mFile,"\tsetAttr \".cfmm\" ",cfmm,";\n");
 	}
 	void setClumpingFrequencyNoise(float cfn)
 	{
 		if(cfn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfn\" %f;\n", cfn);
+		writeFloat(mFile,"\tsetAttr \".cfn\" ",cfn,";\n");
 	}
 	void setClumpingFrequencyNoiseFreq(float cfnf)
 	{
 		if(cfnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".cfnf\" %f;\n", cfnf);
+		writeFloat(mFile,"\tsetAttr \".cfnf\" ",cfnf,";\n");
 	}
 	void setClumpShape(float dcs)
 	{
 		if(dcs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcs\" %f;\n", dcs);
+		writeFloat(mFile,"\tsetAttr \".dcs\" ",dcs,";\n");
 	}
 	void setClumpShapeMapOffset(float csmo)
 	{
 		if(csmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csmo\" %f;\n", csmo);
+		writeFloat(mFile,"\tsetAttr \".csmo\" ",csmo,";\n");
 	}
 	void setClumpShapeMapMult(float csmm)
 	{
 		if(csmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".csmm\" %f;\n", csmm);
+		writeFloat(mFile,"\tsetAttr \".csmm\" ",csmm,";\n");
 	}
 	void setClumpShapeNoise(float csn)
 	{
 		if(csn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csn\" %f;\n", csn);
+		writeFloat(mFile,"\tsetAttr \".csn\" ",csn,";\n");
 	}
 	void setClumpShapeNoiseFreq(float csnf)
 	{
 		if(csnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".csnf\" %f;\n", csnf);
+		writeFloat(mFile,"\tsetAttr \".csnf\" ",csnf,";\n");
 	}
 	void getLightModel()const
 	{
-		fprintf(mFile,"\"%s.lmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmd\"");
 	}
 	void getDagSetMembers()const
 	{
-		fprintf(mFile,"\"%s.dsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsm\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.uvsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvsn\"");
 	}
 	void getFurGlobals()const
 	{
-		fprintf(mFile,"\"%s.fgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fgc\"");
 	}
 	void getBaseColor()const
 	{
-		fprintf(mFile,"\"%s.dbc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbc\"");
 	}
 	void getBaseColorR()const
 	{
-		fprintf(mFile,"\"%s.dbcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbcr\"");
 	}
 	void getBaseColorG()const
 	{
-		fprintf(mFile,"\"%s.dbcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbcg\"");
 	}
 	void getBaseColorB()const
 	{
-		fprintf(mFile,"\"%s.dbcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbcb\"");
 	}
 	void getBaseColorMap()const
 	{
-		fprintf(mFile,"\"%s.bcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcm\"");
 	}
 	void getBaseColorMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.bcmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcmus\"");
 	}
 	void getBaseColorMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.bcmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcmvs\"");
 	}
 	void getBaseColorNoise()const
 	{
-		fprintf(mFile,"\"%s.bcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcn\"");
 	}
 	void getTipColor()const
 	{
-		fprintf(mFile,"\"%s.dtc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtc\"");
 	}
 	void getTipColorR()const
 	{
-		fprintf(mFile,"\"%s.dtcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtcr\"");
 	}
 	void getTipColorG()const
 	{
-		fprintf(mFile,"\"%s.dtcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtcg\"");
 	}
 	void getTipColorB()const
 	{
-		fprintf(mFile,"\"%s.dtcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtcb\"");
 	}
 	void getTipColorMap()const
 	{
-		fprintf(mFile,"\"%s.tcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcm\"");
 	}
 	void getTipColorMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.tcmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcmus\"");
 	}
 	void getTipColorMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.tcmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcmvs\"");
 	}
 	void getTipColorNoise()const
 	{
-		fprintf(mFile,"\"%s.tcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcn\"");
 	}
 	void getBaseAmbientColor()const
 	{
-		fprintf(mFile,"\"%s.dbac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbac\"");
 	}
 	void getBaseAmbientColorR()const
 	{
-		fprintf(mFile,"\"%s.dbacr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbacr\"");
 	}
 	void getBaseAmbientColorG()const
 	{
-		fprintf(mFile,"\"%s.dbacg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbacg\"");
 	}
 	void getBaseAmbientColorB()const
 	{
-		fprintf(mFile,"\"%s.dbacb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbacb\"");
 	}
 	void getBaseAmbientColorMap()const
 	{
-		fprintf(mFile,"\"%s.bacm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bacm\"");
 	}
 	void getBaseAmbientColorMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.bacmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bacmus\"");
 	}
 	void getBaseAmbientColorMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.bacmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bacmvs\"");
 	}
 	void getBaseAmbientColorNoise()const
 	{
-		fprintf(mFile,"\"%s.bacn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bacn\"");
 	}
 	void getTipAmbientColor()const
 	{
-		fprintf(mFile,"\"%s.dtac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtac\"");
 	}
 	void getTipAmbientColorR()const
 	{
-		fprintf(mFile,"\"%s.dtacr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtacr\"");
 	}
 	void getTipAmbientColorG()const
 	{
-		fprintf(mFile,"\"%s.dtacg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtacg\"");
 	}
 	void getTipAmbientColorB()const
 	{
-		fprintf(mFile,"\"%s.dtacb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtacb\"");
 	}
 	void getTipAmbientColorMap()const
 	{
-		fprintf(mFile,"\"%s.tacm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tacm\"");
 	}
 	void getTipAmbientColorMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.tacmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tacmus\"");
 	}
 	void getTipAmbientColorMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.tacmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tacmvs\"");
 	}
 	void getTipAmbientColorNoise()const
 	{
-		fprintf(mFile,"\"%s.tacn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tacn\"");
 	}
 	void getSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.dsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsc\"");
 	}
 	void getSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.dscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dscr\"");
 	}
 	void getSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.dscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dscg\"");
 	}
 	void getSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.dscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dscb\"");
 	}
 	void getSpecularColorMap()const
 	{
-		fprintf(mFile,"\"%s.scm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scm\"");
 	}
 	void getSpecularColorMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.scmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scmus\"");
 	}
 	void getSpecularColorMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.scmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scmvs\"");
 	}
 	void getSpecularColorNoise()const
 	{
-		fprintf(mFile,"\"%s.scn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scn\"");
 	}
 	void getLength()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getLengthMap()const
 	{
-		fprintf(mFile,"\"%s.lm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lm\"");
 	}
 	void getLengthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.lmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmus\"");
 	}
 	void getLengthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.lmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmvs\"");
 	}
 	void getLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.lmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmo\"");
 	}
 	void getLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.lmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmm\"");
 	}
 	void getLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.ln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ln\"");
 	}
 	void getSpecularSharpness()const
 	{
-		fprintf(mFile,"\"%s.dss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dss\"");
 	}
 	void getSpecularSharpnessMap()const
 	{
-		fprintf(mFile,"\"%s.ssm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssm\"");
 	}
 	void getSpecularSharpnessMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.ssmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssmus\"");
 	}
 	void getSpecularSharpnessMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.ssmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssmvs\"");
 	}
 	void getSpecularSharpnessMapOffset()const
 	{
-		fprintf(mFile,"\"%s.ssmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssmo\"");
 	}
 	void getSpecularSharpnessMapMult()const
 	{
-		fprintf(mFile,"\"%s.ssmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssmm\"");
 	}
 	void getSpecularSharpnessNoise()const
 	{
-		fprintf(mFile,"\"%s.ssn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssn\"");
 	}
 	void getBaldness()const
 	{
-		fprintf(mFile,"\"%s.db\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".db\"");
 	}
 	void getBaldnessMap()const
 	{
-		fprintf(mFile,"\"%s.bm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bm\"");
 	}
 	void getBaldnessMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.bmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmus\"");
 	}
 	void getBaldnessMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.bmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmvs\"");
 	}
 	void getBaldnessMapOffset()const
 	{
-		fprintf(mFile,"\"%s.bmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmo\"");
 	}
 	void getBaldnessMapMult()const
 	{
-		fprintf(mFile,"\"%s.bmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmm\"");
 	}
 	void getBaldnessNoise()const
 	{
-		fprintf(mFile,"\"%s.bn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bn\"");
 	}
 	void getBaseOpacity()const
 	{
-		fprintf(mFile,"\"%s.dbo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbo\"");
 	}
 	void getBaseOpacityMap()const
 	{
-		fprintf(mFile,"\"%s.bom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bom\"");
 	}
 	void getBaseOpacityMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.bomus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bomus\"");
 	}
 	void getBaseOpacityMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.bomvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bomvs\"");
 	}
 	void getBaseOpacityMapOffset()const
 	{
-		fprintf(mFile,"\"%s.bomo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bomo\"");
 	}
 	void getBaseOpacityMapMult()const
 	{
-		fprintf(mFile,"\"%s.bomm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bomm\"");
 	}
 	void getBaseOpacityNoise()const
 	{
-		fprintf(mFile,"\"%s.bon\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bon\"");
 	}
 	void getTipOpacity()const
 	{
-		fprintf(mFile,"\"%s.dto\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dto\"");
 	}
 	void getTipOpacityMap()const
 	{
-		fprintf(mFile,"\"%s.tom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tom\"");
 	}
 	void getTipOpacityMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.tomus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tomus\"");
 	}
 	void getTipOpacityMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.tomvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tomvs\"");
 	}
 	void getTipOpacityMapOffset()const
 	{
-		fprintf(mFile,"\"%s.tomo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tomo\"");
 	}
 	void getTipOpacityMapMult()const
 	{
-		fprintf(mFile,"\"%s.tomm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tomm\"");
 	}
 	void getTipOpacityNoise()const
 	{
-		fprintf(mFile,"\"%s.ton\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ton\"");
 	}
 	void getBaseWidth()const
 	{
-		fprintf(mFile,"\"%s.dbw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbw\"");
 	}
 	void getBaseWidthMap()const
 	{
-		fprintf(mFile,"\"%s.bwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwm\"");
 	}
 	void getBaseWidthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.bwmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwmus\"");
 	}
 	void getBaseWidthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.bwmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwmvs\"");
 	}
 	void getBaseWidthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.bwmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwmo\"");
 	}
 	void getBaseWidthMapMult()const
 	{
-		fprintf(mFile,"\"%s.bwmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwmm\"");
 	}
 	void getBaseWidthNoise()const
 	{
-		fprintf(mFile,"\"%s.bwn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwn\"");
 	}
 	void getTipWidth()const
 	{
-		fprintf(mFile,"\"%s.dtw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtw\"");
 	}
 	void getTipWidthMap()const
 	{
-		fprintf(mFile,"\"%s.twm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twm\"");
 	}
 	void getTipWidthMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.twmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twmus\"");
 	}
 	void getTipWidthMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.twmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twmvs\"");
 	}
 	void getTipWidthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.twmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twmo\"");
 	}
 	void getTipWidthMapMult()const
 	{
-		fprintf(mFile,"\"%s.twmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twmm\"");
 	}
 	void getTipWidthNoise()const
 	{
-		fprintf(mFile,"\"%s.twn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twn\"");
 	}
 	void getSegments()const
 	{
-		fprintf(mFile,"\"%s.dsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsg\"");
 	}
 	void getSegmentsMap()const
 	{
-		fprintf(mFile,"\"%s.sgm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgm\"");
 	}
 	void getSegmentsMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.sgmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgmus\"");
 	}
 	void getSegmentsMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.sgmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgmvs\"");
 	}
 	void getSegmentsMapOffset()const
 	{
-		fprintf(mFile,"\"%s.sgmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgmo\"");
 	}
 	void getSegmentsMapMult()const
 	{
-		fprintf(mFile,"\"%s.sgmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgmm\"");
 	}
 	void getSegmentsNoise()const
 	{
-		fprintf(mFile,"\"%s.sgn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgn\"");
 	}
 	void getBaseCurl()const
 	{
-		fprintf(mFile,"\"%s.dbcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbcl\"");
 	}
 	void getBaseCurlMap()const
 	{
-		fprintf(mFile,"\"%s.bclm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclm\"");
 	}
 	void getBaseCurlMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.bclmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclmus\"");
 	}
 	void getBaseCurlMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.bclmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclmvs\"");
 	}
 	void getBaseCurlMapOffset()const
 	{
-		fprintf(mFile,"\"%s.bclmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclmo\"");
 	}
 	void getBaseCurlMapMult()const
 	{
-		fprintf(mFile,"\"%s.bclmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclmm\"");
 	}
 	void getBaseCurlNoise()const
 	{
-		fprintf(mFile,"\"%s.bcln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcln\"");
 	}
 	void getTipCurl()const
 	{
-		fprintf(mFile,"\"%s.dtcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtcl\"");
 	}
 	void getTipCurlMap()const
 	{
-		fprintf(mFile,"\"%s.tclm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclm\"");
 	}
 	void getTipCurlMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.tclmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclmus\"");
 	}
 	void getTipCurlMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.tclmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclmvs\"");
 	}
 	void getTipCurlMapOffset()const
 	{
-		fprintf(mFile,"\"%s.tclmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclmo\"");
 	}
 	void getTipCurlMapMult()const
 	{
-		fprintf(mFile,"\"%s.tclmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclmm\"");
 	}
 	void getTipCurlNoise()const
 	{
-		fprintf(mFile,"\"%s.tcln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcln\"");
 	}
 	void getScraggle()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 	void getScraggleMap()const
 	{
-		fprintf(mFile,"\"%s.sm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sm\"");
 	}
 	void getScraggleMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.smus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smus\"");
 	}
 	void getScraggleMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.smvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smvs\"");
 	}
 	void getScraggleMapOffset()const
 	{
-		fprintf(mFile,"\"%s.smo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smo\"");
 	}
 	void getScraggleMapMult()const
 	{
-		fprintf(mFile,"\"%s.smm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smm\"");
 	}
 	void getScraggleNoise()const
 	{
-		fprintf(mFile,"\"%s.sn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sn\"");
 	}
 	void getScraggleFrequency()const
 	{
-		fprintf(mFile,"\"%s.dsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsf\"");
 	}
 	void getScraggleFrequencyMap()const
 	{
-		fprintf(mFile,"\"%s.sfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfm\"");
 	}
 	void getScraggleFrequencyMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.sfmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfmus\"");
 	}
 	void getScraggleFrequencyMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.sfmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfmvs\"");
 	}
 	void getScraggleFrequencyMapOffset()const
 	{
-		fprintf(mFile,"\"%s.sfmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfmo\"");
 	}
 	void getScraggleFrequencyMapMult()const
 	{
-		fprintf(mFile,"\"%s.sfmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfmm\"");
 	}
 	void getScraggleFrequencyNoise()const
 	{
-		fprintf(mFile,"\"%s.sfn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfn\"");
 	}
 	void getScraggleCorrelation()const
 	{
-		fprintf(mFile,"\"%s.dsco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsco\"");
 	}
 	void getScraggleCorrelationMap()const
 	{
-		fprintf(mFile,"\"%s.scom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scom\"");
 	}
 	void getScraggleCorrelationMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.scomus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scomus\"");
 	}
 	void getScraggleCorrelationMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.scomvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scomvs\"");
 	}
 	void getScraggleCorrelationMapOffset()const
 	{
-		fprintf(mFile,"\"%s.scomo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scomo\"");
 	}
 	void getScraggleCorrelationMapMult()const
 	{
-		fprintf(mFile,"\"%s.scomm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scomm\"");
 	}
 	void getScraggleCorrelationNoise()const
 	{
-		fprintf(mFile,"\"%s.scon\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scon\"");
 	}
 	void getInclination()const
 	{
-		fprintf(mFile,"\"%s.di\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di\"");
 	}
 	void getInclinationMap()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getInclinationMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.imus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imus\"");
 	}
 	void getInclinationMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.imvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imvs\"");
 	}
 	void getInclinationMapOffset()const
 	{
-		fprintf(mFile,"\"%s.imo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imo\"");
 	}
 	void getInclinationMapMult()const
 	{
-		fprintf(mFile,"\"%s.imm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imm\"");
 	}
 	void getInclinationNoise()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getRoll()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getRollMap()const
 	{
-		fprintf(mFile,"\"%s.rm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rm\"");
 	}
 	void getRollMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.rmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmus\"");
 	}
 	void getRollMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.rmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmvs\"");
 	}
 	void getRollMapOffset()const
 	{
-		fprintf(mFile,"\"%s.rmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmo\"");
 	}
 	void getRollMapMult()const
 	{
-		fprintf(mFile,"\"%s.rmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmm\"");
 	}
 	void getRollNoise()const
 	{
-		fprintf(mFile,"\"%s.rn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rn\"");
 	}
 	void getPolar()const
 	{
-		fprintf(mFile,"\"%s.dp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dp\"");
 	}
 	void getPolarMap()const
 	{
-		fprintf(mFile,"\"%s.pm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pm\"");
 	}
 	void getPolarMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.pmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmus\"");
 	}
 	void getPolarMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.pmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmvs\"");
 	}
 	void getPolarMapOffset()const
 	{
-		fprintf(mFile,"\"%s.pmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmo\"");
 	}
 	void getPolarMapMult()const
 	{
-		fprintf(mFile,"\"%s.pmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmm\"");
 	}
 	void getPolarNoise()const
 	{
-		fprintf(mFile,"\"%s.pn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pn\"");
 	}
 	void getAttraction()const
 	{
-		fprintf(mFile,"\"%s.dat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dat\"");
 	}
 	void getAttractionMap()const
 	{
-		fprintf(mFile,"\"%s.atm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atm\"");
 	}
 	void getAttractionMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.atmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atmus\"");
 	}
 	void getAttractionMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.atmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atmvs\"");
 	}
 	void getAttractionMapOffset()const
 	{
-		fprintf(mFile,"\"%s.atmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atmo\"");
 	}
 	void getAttractionMapMult()const
 	{
-		fprintf(mFile,"\"%s.atmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atmm\"");
 	}
 	void getAttractionNoise()const
 	{
-		fprintf(mFile,"\"%s.atn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atn\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.dofs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dofs\"");
 	}
 	void getOffsetMap()const
 	{
-		fprintf(mFile,"\"%s.ofsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsm\"");
 	}
 	void getOffsetMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.ofsmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsmus\"");
 	}
 	void getOffsetMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.ofsmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsmvs\"");
 	}
 	void getOffsetMapOffset()const
 	{
-		fprintf(mFile,"\"%s.ofsmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsmo\"");
 	}
 	void getOffsetMapMult()const
 	{
-		fprintf(mFile,"\"%s.ofsmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsmm\"");
 	}
 	void getOffsetNoise()const
 	{
-		fprintf(mFile,"\"%s.ofsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsn\"");
 	}
 	void getClumping()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getClumpingMap()const
 	{
-		fprintf(mFile,"\"%s.cm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cm\"");
 	}
 	void getClumpingMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.cmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmus\"");
 	}
 	void getClumpingMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.cmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmvs\"");
 	}
 	void getClumpingMapOffset()const
 	{
-		fprintf(mFile,"\"%s.cmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmo\"");
 	}
 	void getClumpingMapMult()const
 	{
-		fprintf(mFile,"\"%s.cmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmm\"");
 	}
 	void getClumpingNoise()const
 	{
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getClumpingFrequency()const
 	{
-		fprintf(mFile,"\"%s.dcf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcf\"");
 	}
 	void getClumpingFrequencyMap()const
 	{
-		fprintf(mFile,"\"%s.cfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfm\"");
 	}
 	void getClumpingFrequencyMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.cfmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfmus\"");
 	}
 	void getClumpingFrequencyMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.cfmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfmvs\"");
 	}
 	void getClumpingFrequencyMapOffset()const
 	{
-		fprintf(mFile,"\"%s.cfmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfmo\"");
 	}
 	void getClumpingFrequencyMapMult()const
 	{
-		fprintf(mFile,"\"%s.cfmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfmm\"");
 	}
 	void getClumpingFrequencyNoise()const
 	{
-		fprintf(mFile,"\"%s.cfn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfn\"");
 	}
 	void getClumpShape()const
 	{
-		fprintf(mFile,"\"%s.dcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcs\"");
 	}
 	void getClumpShapeMap()const
 	{
-		fprintf(mFile,"\"%s.csm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csm\"");
 	}
 	void getClumpShapeMapUSamples()const
 	{
-		fprintf(mFile,"\"%s.csmus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csmus\"");
 	}
 	void getClumpShapeMapVSamples()const
 	{
-		fprintf(mFile,"\"%s.csmvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csmvs\"");
 	}
 	void getClumpShapeMapOffset()const
 	{
-		fprintf(mFile,"\"%s.csmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csmo\"");
 	}
 	void getClumpShapeMapMult()const
 	{
-		fprintf(mFile,"\"%s.csmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csmm\"");
 	}
 	void getClumpShapeNoise()const
 	{
-		fprintf(mFile,"\"%s.csn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csn\"");
 	}
 protected:
 	FurDescription(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
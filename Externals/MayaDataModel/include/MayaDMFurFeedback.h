@@ -41,25 +41,25 @@ public:
 		bool miTransparencyReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i", miTransparencyReceive);
+			writeInt(file,"",miOverrideCaustics," ");
+			writeInt(file,"",miCausticAccuracy," ");
+			writeFloat(file,"",miCausticRadius," ");
+			writeInt(file,"",miOverrideGlobalIllumination," ");
+			writeInt(file,"",miGlobillumAccuracy," ");
+			writeFloat(file,"",miGlobillumRadius," ");
+			writeInt(file,"",miOverrideFinalGather," ");
+			writeInt(file,"",miFinalGatherRays," ");
+			writeFloat(file,"",miFinalGatherMinRadius," ");
+			writeFloat(file,"",miFinalGatherMaxRadius," ");
+			writeInt(file,"",miFinalGatherFilter," ");
+			writeInt(file,"",miFinalGatherView," ");
+			writeInt(file,"",miOverrideSamples," ");
+			writeInt(file,"",miMinSamples," ");
+			writeInt(file,"",miMaxSamples," ");
+			writeInt(file,"",miFinalGatherCast," ");
+			writeInt(file,"",miFinalGatherReceive," ");
+			writeInt(file,"",miTransparencyCast," ");
+			writeInt(file,"",miTransparencyReceive);
 		}
 	};
 public:
@@ -71,3714 +71,3714 @@ public:
 
 	void setInputSurface(const nurbsSurface& is)
 	{
-		fprintf(mFile,"\tsetAttr \".is\" -type \"nurbsSurface\" ");
+		writeString(mFile,"\tsetAttr \".is\" -type \"nurbsSurface\" ");
 		is.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputMesh(const mesh& imsh)
 	{
-		fprintf(mFile,"\tsetAttr \".imsh\" -type \"mesh\" ");
+		writeString(mFile,"\tsetAttr \".imsh\" -type \"mesh\" ");
 		imsh.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRealUSamples(int rus)
 	{
 		if(rus == 32) return;
-		fprintf(mFile,"\tsetAttr \".rus\" %i;\n", rus);
+		writeInt(mFile,"\tsetAttr \".rus\" ",rus,";\n");
 	}
 	void setRealVSamples(int rvs)
 	{
 		if(rvs == 32) return;
-		fprintf(mFile,"\tsetAttr \".rvs\" %i;\n", rvs);
+		writeInt(mFile,"\tsetAttr \".rvs\" ",rvs,";\n");
 	}
 	void setUSamples(int us)
 	{
 		if(us == 32) return;
-		fprintf(mFile,"\tsetAttr \".us\" %i;\n", us);
+		writeInt(mFile,"\tsetAttr \".us\" ",us,";\n");
 	}
 	void setVSamples(int vs)
 	{
 		if(vs == 32) return;
-		fprintf(mFile,"\tsetAttr \".vs\" %i;\n", vs);
+		writeInt(mFile,"\tsetAttr \".vs\" ",vs,";\n");
 	}
 	void setFlipNormals(bool fn)
 	{
 		if(fn == false) return;
-		fprintf(mFile,"\tsetAttr \".fn\" %i;\n", fn);
+		writeInt(mFile,"\tsetAttr \".fn\" ",fn,";\n");
 	}
 	void setHairs(const pointArray& h)
 	{
-		fprintf(mFile,"\tsetAttr \".h\" -type \"pointArray\" ");
+		writeString(mFile,"\tsetAttr \".h\" -type \"pointArray\" ");
 		h.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFurAccuracy(float ha)
 	{
 		if(ha == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ha\" %f;\n", ha);
+		writeFloat(mFile,"\tsetAttr \".ha\" ",ha,";\n");
 	}
 	void setFurGlobalScale(float fgs)
 	{
 		if(fgs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fgs\" %f;\n", fgs);
+		writeFloat(mFile,"\tsetAttr \".fgs\" ",fgs,";\n");
 	}
 	void setAttractorGlobalScale(float ags)
 	{
 		if(ags == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ags\" %f;\n", ags);
+		writeFloat(mFile,"\tsetAttr \".ags\" ",ags,";\n");
 	}
 	void setExportAttr(const string& ea)
 	{
 		if(ea == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".ea\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ea\" -type \"string\" ");
 		ea.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setExportFile(const string& ef)
 	{
 		if(ef == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".ef\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ef\" -type \"string\" ");
 		ef.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setExportWidth(int ew)
 	{
 		if(ew == 256) return;
-		fprintf(mFile,"\tsetAttr \".ew\" %i;\n", ew);
+		writeInt(mFile,"\tsetAttr \".ew\" ",ew,";\n");
 	}
 	void setExportHeight(int eh)
 	{
 		if(eh == 256) return;
-		fprintf(mFile,"\tsetAttr \".eh\" %i;\n", eh);
+		writeInt(mFile,"\tsetAttr \".eh\" ",eh,";\n");
 	}
 	void setColorFeedbackEnabled(bool cfe)
 	{
 		if(cfe == false) return;
-		fprintf(mFile,"\tsetAttr \".cfe\" %i;\n", cfe);
+		writeInt(mFile,"\tsetAttr \".cfe\" ",cfe,";\n");
 	}
 	void setAttractorModel(unsigned int amd)
 	{
 		if(amd == 0) return;
-		fprintf(mFile,"\tsetAttr \".amd\" %i;\n", amd);
+		writeInt(mFile,"\tsetAttr \".amd\" ",amd,";\n");
 	}
 	void setAttractorsPerHair(int aph)
 	{
 		if(aph == 1) return;
-		fprintf(mFile,"\tsetAttr \".aph\" %i;\n", aph);
+		writeInt(mFile,"\tsetAttr \".aph\" ",aph,";\n");
 	}
 	void setDrawAttractors(bool drat)
 	{
 		if(drat == false) return;
-		fprintf(mFile,"\tsetAttr \".drat\" %i;\n", drat);
+		writeInt(mFile,"\tsetAttr \".drat\" ",drat,";\n");
 	}
 	void setLength(double dl)
 	{
 		if(dl == 1) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %f;\n", dl);
+		writeFloat(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setLengthSamples(size_t ls_i,double ls)
 	{
 		if(ls == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ls[%i]\" %f;\n", ls_i,ls);
+		writeInt(mFile,"\tsetAttr \".ls[",ls_i); writeFloat(mFile,"]\" ",ls,";\n");
 	}
 	void setLengthSamples(size_t ls_start,size_t ls_end,double* ls)
 	{
-		fprintf(mFile,"\tsetAttr \".ls[%i:%i]\" ", ls_start,ls_end);
+		writeInt(mFile,"\tsetAttr \".ls[",ls_start); writeInt(mFile,":",ls_end,"]\" ");
 		size_t size = (ls_end-ls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ls[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLengthSamples(size_t ls_start,size_t ls_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ls[%i:%i]\"",ls_start,ls_end);
+		writeInt(mFile,"\tsetAttr \".ls[",ls_start); writeInt(mFile,":",ls_end,"]\"");
 	}
 	void appendLengthSamples(double ls)const
 	{
-		fprintf(mFile," %f",ls);
+		writeFloat(mFile," ",ls);
 	}
 	void endLengthSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLengthMap(const string& lm)
 	{
 		if(lm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".lm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".lm\" -type \"string\" ");
 		lm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLengthMapOffset(double lmo)
 	{
 		if(lmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".lmo\" %f;\n", lmo);
+		writeFloat(mFile,"\tsetAttr \".lmo\" ",lmo,";\n");
 	}
 	void setLengthMapMult(double lmm)
 	{
 		if(lmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".lmm\" %f;\n", lmm);
+		writeFloat(mFile,"\tsetAttr \".lmm\" ",lmm,";\n");
 	}
 	void setLengthNoise(double ln)
 	{
 		if(ln == 0) return;
-		fprintf(mFile,"\tsetAttr \".ln\" %f;\n", ln);
+		writeFloat(mFile,"\tsetAttr \".ln\" ",ln,";\n");
 	}
 	void setLengthNoiseFreq(float lnf)
 	{
 		if(lnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".lnf\" %f;\n", lnf);
+		writeFloat(mFile,"\tsetAttr \".lnf\" ",lnf,";\n");
 	}
 	void setLengthSamplesDirty(int lsd)
 	{
 		if(lsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lsd\" %i;\n", lsd);
+		writeInt(mFile,"\tsetAttr \".lsd\" ",lsd,";\n");
 	}
 	void setLengthMapDirty(int lmd)
 	{
 		if(lmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lmd\" %i;\n", lmd);
+		writeInt(mFile,"\tsetAttr \".lmd\" ",lmd,";\n");
 	}
 	void setInclination(float din)
 	{
 		if(din == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".din\" %f;\n", din);
+		writeFloat(mFile,"\tsetAttr \".din\" ",din,";\n");
 	}
 	void setInclinationSamples(size_t ins_i,double ins)
 	{
 		if(ins == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ins[%i]\" %f;\n", ins_i,ins);
+		writeInt(mFile,"\tsetAttr \".ins[",ins_i); writeFloat(mFile,"]\" ",ins,";\n");
 	}
 	void setInclinationSamples(size_t ins_start,size_t ins_end,double* ins)
 	{
-		fprintf(mFile,"\tsetAttr \".ins[%i:%i]\" ", ins_start,ins_end);
+		writeInt(mFile,"\tsetAttr \".ins[",ins_start); writeInt(mFile,":",ins_end,"]\" ");
 		size_t size = (ins_end-ins_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ins[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ins[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInclinationSamples(size_t ins_start,size_t ins_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ins[%i:%i]\"",ins_start,ins_end);
+		writeInt(mFile,"\tsetAttr \".ins[",ins_start); writeInt(mFile,":",ins_end,"]\"");
 	}
 	void appendInclinationSamples(double ins)const
 	{
-		fprintf(mFile," %f",ins);
+		writeFloat(mFile," ",ins);
 	}
 	void endInclinationSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInclinationMap(const string& inm)
 	{
 		if(inm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".inm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".inm\" -type \"string\" ");
 		inm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInclinationMapOffset(float inmo)
 	{
 		if(inmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".inmo\" %f;\n", inmo);
+		writeFloat(mFile,"\tsetAttr \".inmo\" ",inmo,";\n");
 	}
 	void setInclinationMapMult(float inmm)
 	{
 		if(inmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".inmm\" %f;\n", inmm);
+		writeFloat(mFile,"\tsetAttr \".inmm\" ",inmm,";\n");
 	}
 	void setInclinationNoise(float inn)
 	{
 		if(inn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".inn\" %f;\n", inn);
+		writeFloat(mFile,"\tsetAttr \".inn\" ",inn,";\n");
 	}
 	void setInclinationNoiseFreq(float innf)
 	{
 		if(innf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".innf\" %f;\n", innf);
+		writeFloat(mFile,"\tsetAttr \".innf\" ",innf,";\n");
 	}
 	void setInclinationSamplesDirty(int insd)
 	{
 		if(insd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".insd\" %i;\n", insd);
+		writeInt(mFile,"\tsetAttr \".insd\" ",insd,";\n");
 	}
 	void setInclinationMapDirty(int inmd)
 	{
 		if(inmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".inmd\" %i;\n", inmd);
+		writeInt(mFile,"\tsetAttr \".inmd\" ",inmd,";\n");
 	}
 	void setRoll(float drl)
 	{
 		if(drl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".drl\" %f;\n", drl);
+		writeFloat(mFile,"\tsetAttr \".drl\" ",drl,";\n");
 	}
 	void setRollSamples(size_t rls_i,double rls)
 	{
 		if(rls == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rls[%i]\" %f;\n", rls_i,rls);
+		writeInt(mFile,"\tsetAttr \".rls[",rls_i); writeFloat(mFile,"]\" ",rls,";\n");
 	}
 	void setRollSamples(size_t rls_start,size_t rls_end,double* rls)
 	{
-		fprintf(mFile,"\tsetAttr \".rls[%i:%i]\" ", rls_start,rls_end);
+		writeInt(mFile,"\tsetAttr \".rls[",rls_start); writeInt(mFile,":",rls_end,"]\" ");
 		size_t size = (rls_end-rls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",rls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",rls[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startRollSamples(size_t rls_start,size_t rls_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".rls[%i:%i]\"",rls_start,rls_end);
+		writeInt(mFile,"\tsetAttr \".rls[",rls_start); writeInt(mFile,":",rls_end,"]\"");
 	}
 	void appendRollSamples(double rls)const
 	{
-		fprintf(mFile," %f",rls);
+		writeFloat(mFile," ",rls);
 	}
 	void endRollSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRollMap(const string& rlm)
 	{
 		if(rlm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".rlm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rlm\" -type \"string\" ");
 		rlm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRollMapOffset(float rlmo)
 	{
 		if(rlmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rlmo\" %f;\n", rlmo);
+		writeFloat(mFile,"\tsetAttr \".rlmo\" ",rlmo,";\n");
 	}
 	void setRollMapMult(float rlmm)
 	{
 		if(rlmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rlmm\" %f;\n", rlmm);
+		writeFloat(mFile,"\tsetAttr \".rlmm\" ",rlmm,";\n");
 	}
 	void setRollNoise(float rln)
 	{
 		if(rln == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rln\" %f;\n", rln);
+		writeFloat(mFile,"\tsetAttr \".rln\" ",rln,";\n");
 	}
 	void setRollNoiseFreq(float rlnf)
 	{
 		if(rlnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".rlnf\" %f;\n", rlnf);
+		writeFloat(mFile,"\tsetAttr \".rlnf\" ",rlnf,";\n");
 	}
 	void setRollSamplesDirty(int rlsd)
 	{
 		if(rlsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rlsd\" %i;\n", rlsd);
+		writeInt(mFile,"\tsetAttr \".rlsd\" ",rlsd,";\n");
 	}
 	void setRollMapDirty(int rlmd)
 	{
 		if(rlmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rlmd\" %i;\n", rlmd);
+		writeInt(mFile,"\tsetAttr \".rlmd\" ",rlmd,";\n");
 	}
 	void setPolar(float dpo)
 	{
 		if(dpo == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dpo\" %f;\n", dpo);
+		writeFloat(mFile,"\tsetAttr \".dpo\" ",dpo,";\n");
 	}
 	void setPolarSamples(size_t pos_i,double pos)
 	{
 		if(pos == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pos[%i]\" %f;\n", pos_i,pos);
+		writeInt(mFile,"\tsetAttr \".pos[",pos_i); writeFloat(mFile,"]\" ",pos,";\n");
 	}
 	void setPolarSamples(size_t pos_start,size_t pos_end,double* pos)
 	{
-		fprintf(mFile,"\tsetAttr \".pos[%i:%i]\" ", pos_start,pos_end);
+		writeInt(mFile,"\tsetAttr \".pos[",pos_start); writeInt(mFile,":",pos_end,"]\" ");
 		size_t size = (pos_end-pos_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",pos[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",pos[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPolarSamples(size_t pos_start,size_t pos_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pos[%i:%i]\"",pos_start,pos_end);
+		writeInt(mFile,"\tsetAttr \".pos[",pos_start); writeInt(mFile,":",pos_end,"]\"");
 	}
 	void appendPolarSamples(double pos)const
 	{
-		fprintf(mFile," %f",pos);
+		writeFloat(mFile," ",pos);
 	}
 	void endPolarSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPolarMap(const string& pom)
 	{
 		if(pom == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".pom\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".pom\" -type \"string\" ");
 		pom.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPolarMapOffset(float pomo)
 	{
 		if(pomo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pomo\" %f;\n", pomo);
+		writeFloat(mFile,"\tsetAttr \".pomo\" ",pomo,";\n");
 	}
 	void setPolarMapMult(float pomm)
 	{
 		if(pomm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pomm\" %f;\n", pomm);
+		writeFloat(mFile,"\tsetAttr \".pomm\" ",pomm,";\n");
 	}
 	void setPolarNoise(float pon)
 	{
 		if(pon == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pon\" %f;\n", pon);
+		writeFloat(mFile,"\tsetAttr \".pon\" ",pon,";\n");
 	}
 	void setPolarNoiseFreq(float ponf)
 	{
 		if(ponf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".ponf\" %f;\n", ponf);
+		writeFloat(mFile,"\tsetAttr \".ponf\" ",ponf,";\n");
 	}
 	void setPolarSamplesDirty(int posd)
 	{
 		if(posd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".posd\" %i;\n", posd);
+		writeInt(mFile,"\tsetAttr \".posd\" ",posd,";\n");
 	}
 	void setPolarMapDirty(int pomd)
 	{
 		if(pomd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pomd\" %i;\n", pomd);
+		writeInt(mFile,"\tsetAttr \".pomd\" ",pomd,";\n");
 	}
 	void setBaldness(float db)
 	{
 		if(db == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".db\" %f;\n", db);
+		writeFloat(mFile,"\tsetAttr \".db\" ",db,";\n");
 	}
 	void setBaldnessSamples(size_t bs_i,double bs)
 	{
 		if(bs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bs[%i]\" %f;\n", bs_i,bs);
+		writeInt(mFile,"\tsetAttr \".bs[",bs_i); writeFloat(mFile,"]\" ",bs,";\n");
 	}
 	void setBaldnessSamples(size_t bs_start,size_t bs_end,double* bs)
 	{
-		fprintf(mFile,"\tsetAttr \".bs[%i:%i]\" ", bs_start,bs_end);
+		writeInt(mFile,"\tsetAttr \".bs[",bs_start); writeInt(mFile,":",bs_end,"]\" ");
 		size_t size = (bs_end-bs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",bs[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBaldnessSamples(size_t bs_start,size_t bs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".bs[%i:%i]\"",bs_start,bs_end);
+		writeInt(mFile,"\tsetAttr \".bs[",bs_start); writeInt(mFile,":",bs_end,"]\"");
 	}
 	void appendBaldnessSamples(double bs)const
 	{
-		fprintf(mFile," %f",bs);
+		writeFloat(mFile," ",bs);
 	}
 	void endBaldnessSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaldnessMap(const string& bm)
 	{
 		if(bm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".bm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bm\" -type \"string\" ");
 		bm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaldnessMapOffset(float bmo)
 	{
 		if(bmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bmo\" %f;\n", bmo);
+		writeFloat(mFile,"\tsetAttr \".bmo\" ",bmo,";\n");
 	}
 	void setBaldnessMapMult(float bmm)
 	{
 		if(bmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bmm\" %f;\n", bmm);
+		writeFloat(mFile,"\tsetAttr \".bmm\" ",bmm,";\n");
 	}
 	void setBaldnessNoise(float bn)
 	{
 		if(bn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bn\" %f;\n", bn);
+		writeFloat(mFile,"\tsetAttr \".bn\" ",bn,";\n");
 	}
 	void setBaldnessNoiseFreq(float bnf)
 	{
 		if(bnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bnf\" %f;\n", bnf);
+		writeFloat(mFile,"\tsetAttr \".bnf\" ",bnf,";\n");
 	}
 	void setBaldnessSamplesDirty(int bsd)
 	{
 		if(bsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bsd\" %i;\n", bsd);
+		writeInt(mFile,"\tsetAttr \".bsd\" ",bsd,";\n");
 	}
 	void setBaldnessMapDirty(int bmd)
 	{
 		if(bmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bmd\" %i;\n", bmd);
+		writeInt(mFile,"\tsetAttr \".bmd\" ",bmd,";\n");
 	}
 	void setBaseOpacity(float dbo)
 	{
 		if(dbo == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dbo\" %f;\n", dbo);
+		writeFloat(mFile,"\tsetAttr \".dbo\" ",dbo,";\n");
 	}
 	void setBaseOpacitySamples(size_t bos_i,double bos)
 	{
 		if(bos == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bos[%i]\" %f;\n", bos_i,bos);
+		writeInt(mFile,"\tsetAttr \".bos[",bos_i); writeFloat(mFile,"]\" ",bos,";\n");
 	}
 	void setBaseOpacitySamples(size_t bos_start,size_t bos_end,double* bos)
 	{
-		fprintf(mFile,"\tsetAttr \".bos[%i:%i]\" ", bos_start,bos_end);
+		writeInt(mFile,"\tsetAttr \".bos[",bos_start); writeInt(mFile,":",bos_end,"]\" ");
 		size_t size = (bos_end-bos_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bos[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",bos[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBaseOpacitySamples(size_t bos_start,size_t bos_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".bos[%i:%i]\"",bos_start,bos_end);
+		writeInt(mFile,"\tsetAttr \".bos[",bos_start); writeInt(mFile,":",bos_end,"]\"");
 	}
 	void appendBaseOpacitySamples(double bos)const
 	{
-		fprintf(mFile," %f",bos);
+		writeFloat(mFile," ",bos);
 	}
 	void endBaseOpacitySamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseOpacityMap(const string& bom)
 	{
 		if(bom == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".bom\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bom\" -type \"string\" ");
 		bom.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseOpacityMapOffset(float bomo)
 	{
 		if(bomo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bomo\" %f;\n", bomo);
+		writeFloat(mFile,"\tsetAttr \".bomo\" ",bomo,";\n");
 	}
 	void setBaseOpacityMapMult(float bomm)
 	{
 		if(bomm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bomm\" %f;\n", bomm);
+		writeFloat(mFile,"\tsetAttr \".bomm\" ",bomm,";\n");
 	}
 	void setBaseOpacityNoise(float bon)
 	{
 		if(bon == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bon\" %f;\n", bon);
+		writeFloat(mFile,"\tsetAttr \".bon\" ",bon,";\n");
 	}
 	void setBaseOpacityNoiseFreq(float bonf)
 	{
 		if(bonf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bonf\" %f;\n", bonf);
+		writeFloat(mFile,"\tsetAttr \".bonf\" ",bonf,";\n");
 	}
 	void setBaseOpacitySamplesDirty(int bosd)
 	{
 		if(bosd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bosd\" %i;\n", bosd);
+		writeInt(mFile,"\tsetAttr \".bosd\" ",bosd,";\n");
 	}
 	void setBaseOpacityMapDirty(int bomd)
 	{
 		if(bomd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bomd\" %i;\n", bomd);
+		writeInt(mFile,"\tsetAttr \".bomd\" ",bomd,";\n");
 	}
 	void setTipOpacity(float dto)
 	{
 		if(dto == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dto\" %f;\n", dto);
+		writeFloat(mFile,"\tsetAttr \".dto\" ",dto,";\n");
 	}
 	void setTipOpacitySamples(size_t tos_i,double tos)
 	{
 		if(tos == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tos[%i]\" %f;\n", tos_i,tos);
+		writeInt(mFile,"\tsetAttr \".tos[",tos_i); writeFloat(mFile,"]\" ",tos,";\n");
 	}
 	void setTipOpacitySamples(size_t tos_start,size_t tos_end,double* tos)
 	{
-		fprintf(mFile,"\tsetAttr \".tos[%i:%i]\" ", tos_start,tos_end);
+		writeInt(mFile,"\tsetAttr \".tos[",tos_start); writeInt(mFile,":",tos_end,"]\" ");
 		size_t size = (tos_end-tos_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tos[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",tos[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTipOpacitySamples(size_t tos_start,size_t tos_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tos[%i:%i]\"",tos_start,tos_end);
+		writeInt(mFile,"\tsetAttr \".tos[",tos_start); writeInt(mFile,":",tos_end,"]\"");
 	}
 	void appendTipOpacitySamples(double tos)const
 	{
-		fprintf(mFile," %f",tos);
+		writeFloat(mFile," ",tos);
 	}
 	void endTipOpacitySamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipOpacityMap(const string& tom)
 	{
 		if(tom == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".tom\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".tom\" -type \"string\" ");
 		tom.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipOpacityMapOffset(float tomo)
 	{
 		if(tomo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tomo\" %f;\n", tomo);
+		writeFloat(mFile,"\tsetAttr \".tomo\" ",tomo,";\n");
 	}
 	void setTipOpacityMapMult(float tomm)
 	{
 		if(tomm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tomm\" %f;\n", tomm);
+		writeFloat(mFile,"\tsetAttr \".tomm\" ",tomm,";\n");
 	}
 	void setTipOpacityNoise(float ton)
 	{
 		if(ton == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ton\" %f;\n", ton);
+		writeFloat(mFile,"\tsetAttr \".ton\" ",ton,";\n");
 	}
 	void setTipOpacityNoiseFreq(float tonf)
 	{
 		if(tonf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".tonf\" %f;\n", tonf);
+		writeFloat(mFile,"\tsetAttr \".tonf\" ",tonf,";\n");
 	}
 	void setTipOpacitySamplesDirty(int tosd)
 	{
 		if(tosd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tosd\" %i;\n", tosd);
+		writeInt(mFile,"\tsetAttr \".tosd\" ",tosd,";\n");
 	}
 	void setTipOpacityMapDirty(int tomd)
 	{
 		if(tomd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tomd\" %i;\n", tomd);
+		writeInt(mFile,"\tsetAttr \".tomd\" ",tomd,";\n");
 	}
 	void setBaseCurl(float dbcl)
 	{
 		if(dbcl == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".dbcl\" %f;\n", dbcl);
+		writeFloat(mFile,"\tsetAttr \".dbcl\" ",dbcl,";\n");
 	}
 	void setBaseCurlSamples(size_t bcls_i,double bcls)
 	{
 		if(bcls == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcls[%i]\" %f;\n", bcls_i,bcls);
+		writeInt(mFile,"\tsetAttr \".bcls[",bcls_i); writeFloat(mFile,"]\" ",bcls,";\n");
 	}
 	void setBaseCurlSamples(size_t bcls_start,size_t bcls_end,double* bcls)
 	{
-		fprintf(mFile,"\tsetAttr \".bcls[%i:%i]\" ", bcls_start,bcls_end);
+		writeInt(mFile,"\tsetAttr \".bcls[",bcls_start); writeInt(mFile,":",bcls_end,"]\" ");
 		size_t size = (bcls_end-bcls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bcls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",bcls[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBaseCurlSamples(size_t bcls_start,size_t bcls_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".bcls[%i:%i]\"",bcls_start,bcls_end);
+		writeInt(mFile,"\tsetAttr \".bcls[",bcls_start); writeInt(mFile,":",bcls_end,"]\"");
 	}
 	void appendBaseCurlSamples(double bcls)const
 	{
-		fprintf(mFile," %f",bcls);
+		writeFloat(mFile," ",bcls);
 	}
 	void endBaseCurlSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseCurlMap(const string& bclm)
 	{
 		if(bclm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".bclm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bclm\" -type \"string\" ");
 		bclm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseCurlMapOffset(float bclmo)
 	{
 		if(bclmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bclmo\" %f;\n", bclmo);
+		writeFloat(mFile,"\tsetAttr \".bclmo\" ",bclmo,";\n");
 	}
 	void setBaseCurlMapMult(float bclmm)
 	{
 		if(bclmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bclmm\" %f;\n", bclmm);
+		writeFloat(mFile,"\tsetAttr \".bclmm\" ",bclmm,";\n");
 	}
 	void setBaseCurlNoise(float bcln)
 	{
 		if(bcln == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcln\" %f;\n", bcln);
+		writeFloat(mFile,"\tsetAttr \".bcln\" ",bcln,";\n");
 	}
 	void setBaseCurlNoiseFreq(float bclnf)
 	{
 		if(bclnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bclnf\" %f;\n", bclnf);
+		writeFloat(mFile,"\tsetAttr \".bclnf\" ",bclnf,";\n");
 	}
 	void setBaseCurlSamplesDirty(int bclsd)
 	{
 		if(bclsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bclsd\" %i;\n", bclsd);
+		writeInt(mFile,"\tsetAttr \".bclsd\" ",bclsd,";\n");
 	}
 	void setBaseCurlMapDirty(int bclmd)
 	{
 		if(bclmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bclmd\" %i;\n", bclmd);
+		writeInt(mFile,"\tsetAttr \".bclmd\" ",bclmd,";\n");
 	}
 	void setTipCurl(float dtcl)
 	{
 		if(dtcl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dtcl\" %f;\n", dtcl);
+		writeFloat(mFile,"\tsetAttr \".dtcl\" ",dtcl,";\n");
 	}
 	void setTipCurlSamples(size_t tcls_i,double tcls)
 	{
 		if(tcls == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcls[%i]\" %f;\n", tcls_i,tcls);
+		writeInt(mFile,"\tsetAttr \".tcls[",tcls_i); writeFloat(mFile,"]\" ",tcls,";\n");
 	}
 	void setTipCurlSamples(size_t tcls_start,size_t tcls_end,double* tcls)
 	{
-		fprintf(mFile,"\tsetAttr \".tcls[%i:%i]\" ", tcls_start,tcls_end);
+		writeInt(mFile,"\tsetAttr \".tcls[",tcls_start); writeInt(mFile,":",tcls_end,"]\" ");
 		size_t size = (tcls_end-tcls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tcls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",tcls[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTipCurlSamples(size_t tcls_start,size_t tcls_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tcls[%i:%i]\"",tcls_start,tcls_end);
+		writeInt(mFile,"\tsetAttr \".tcls[",tcls_start); writeInt(mFile,":",tcls_end,"]\"");
 	}
 	void appendTipCurlSamples(double tcls)const
 	{
-		fprintf(mFile," %f",tcls);
+		writeFloat(mFile," ",tcls);
 	}
 	void endTipCurlSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipCurlMap(const string& tclm)
 	{
 		if(tclm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".tclm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".tclm\" -type \"string\" ");
 		tclm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipCurlMapOffset(float tclmo)
 	{
 		if(tclmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tclmo\" %f;\n", tclmo);
+		writeFloat(mFile,"\tsetAttr \".tclmo\" ",tclmo,";\n");
 	}
 	void setTipCurlMapMult(float tclmm)
 	{
 		if(tclmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tclmm\" %f;\n", tclmm);
+		writeFloat(mFile,"\tsetAttr \".tclmm\" ",tclmm,";\n");
 	}
 	void setTipCurlNoise(float tcln)
 	{
 		if(tcln == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcln\" %f;\n", tcln);
+		writeFloat(mFile,"\tsetAttr \".tcln\" ",tcln,";\n");
 	}
 	void setTipCurlNoiseFreq(float tclnf)
 	{
 		if(tclnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".tclnf\" %f;\n", tclnf);
+		writeFloat(mFile,"\tsetAttr \".tclnf\" ",tclnf,";\n");
 	}
 	void setTipCurlSamplesDirty(int tclsd)
 	{
 		if(tclsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tclsd\" %i;\n", tclsd);
+		writeInt(mFile,"\tsetAttr \".tclsd\" ",tclsd,";\n");
 	}
 	void setTipCurlMapDirty(int tclmd)
 	{
 		if(tclmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tclmd\" %i;\n", tclmd);
+		writeInt(mFile,"\tsetAttr \".tclmd\" ",tclmd,";\n");
 	}
 	void setBaseWidth(double dbw)
 	{
 		if(dbw == 0) return;
-		fprintf(mFile,"\tsetAttr \".dbw\" %f;\n", dbw);
+		writeFloat(mFile,"\tsetAttr \".dbw\" ",dbw,";\n");
 	}
 	void setBaseWidthSamples(size_t bws_i,double bws)
 	{
 		if(bws == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bws[%i]\" %f;\n", bws_i,bws);
+		writeInt(mFile,"\tsetAttr \".bws[",bws_i); writeFloat(mFile,"]\" ",bws,";\n");
 	}
 	void setBaseWidthSamples(size_t bws_start,size_t bws_end,double* bws)
 	{
-		fprintf(mFile,"\tsetAttr \".bws[%i:%i]\" ", bws_start,bws_end);
+		writeInt(mFile,"\tsetAttr \".bws[",bws_start); writeInt(mFile,":",bws_end,"]\" ");
 		size_t size = (bws_end-bws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bws[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",bws[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBaseWidthSamples(size_t bws_start,size_t bws_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".bws[%i:%i]\"",bws_start,bws_end);
+		writeInt(mFile,"\tsetAttr \".bws[",bws_start); writeInt(mFile,":",bws_end,"]\"");
 	}
 	void appendBaseWidthSamples(double bws)const
 	{
-		fprintf(mFile," %f",bws);
+		writeFloat(mFile," ",bws);
 	}
 	void endBaseWidthSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseWidthMap(const string& bwm)
 	{
 		if(bwm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".bwm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bwm\" -type \"string\" ");
 		bwm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseWidthMapOffset(double bwmo)
 	{
 		if(bwmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".bwmo\" %f;\n", bwmo);
+		writeFloat(mFile,"\tsetAttr \".bwmo\" ",bwmo,";\n");
 	}
 	void setBaseWidthMapMult(double bwmm)
 	{
 		if(bwmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".bwmm\" %f;\n", bwmm);
+		writeFloat(mFile,"\tsetAttr \".bwmm\" ",bwmm,";\n");
 	}
 	void setBaseWidthNoise(double bwn)
 	{
 		if(bwn == 0) return;
-		fprintf(mFile,"\tsetAttr \".bwn\" %f;\n", bwn);
+		writeFloat(mFile,"\tsetAttr \".bwn\" ",bwn,";\n");
 	}
 	void setBaseWidthNoiseFreq(float bwnf)
 	{
 		if(bwnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bwnf\" %f;\n", bwnf);
+		writeFloat(mFile,"\tsetAttr \".bwnf\" ",bwnf,";\n");
 	}
 	void setBaseWidthSamplesDirty(int bwsd)
 	{
 		if(bwsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bwsd\" %i;\n", bwsd);
+		writeInt(mFile,"\tsetAttr \".bwsd\" ",bwsd,";\n");
 	}
 	void setBaseWidthMapDirty(int bwmd)
 	{
 		if(bwmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bwmd\" %i;\n", bwmd);
+		writeInt(mFile,"\tsetAttr \".bwmd\" ",bwmd,";\n");
 	}
 	void setTipWidth(double dtw)
 	{
 		if(dtw == 0) return;
-		fprintf(mFile,"\tsetAttr \".dtw\" %f;\n", dtw);
+		writeFloat(mFile,"\tsetAttr \".dtw\" ",dtw,";\n");
 	}
 	void setTipWidthSamples(size_t tws_i,double tws)
 	{
 		if(tws == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tws[%i]\" %f;\n", tws_i,tws);
+		writeInt(mFile,"\tsetAttr \".tws[",tws_i); writeFloat(mFile,"]\" ",tws,";\n");
 	}
 	void setTipWidthSamples(size_t tws_start,size_t tws_end,double* tws)
 	{
-		fprintf(mFile,"\tsetAttr \".tws[%i:%i]\" ", tws_start,tws_end);
+		writeInt(mFile,"\tsetAttr \".tws[",tws_start); writeInt(mFile,":",tws_end,"]\" ");
 		size_t size = (tws_end-tws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tws[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",tws[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTipWidthSamples(size_t tws_start,size_t tws_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tws[%i:%i]\"",tws_start,tws_end);
+		writeInt(mFile,"\tsetAttr \".tws[",tws_start); writeInt(mFile,":",tws_end,"]\"");
 	}
 	void appendTipWidthSamples(double tws)const
 	{
-		fprintf(mFile," %f",tws);
+		writeFloat(mFile," ",tws);
 	}
 	void endTipWidthSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipWidthMap(const string& twm)
 	{
 		if(twm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".twm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".twm\" -type \"string\" ");
 		twm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipWidthMapOffset(double twmo)
 	{
 		if(twmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".twmo\" %f;\n", twmo);
+		writeFloat(mFile,"\tsetAttr \".twmo\" ",twmo,";\n");
 	}
 	void setTipWidthMapMult(double twmm)
 	{
 		if(twmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".twmm\" %f;\n", twmm);
+		writeFloat(mFile,"\tsetAttr \".twmm\" ",twmm,";\n");
 	}
 	void setTipWidthNoise(double twn)
 	{
 		if(twn == 0) return;
-		fprintf(mFile,"\tsetAttr \".twn\" %f;\n", twn);
+		writeFloat(mFile,"\tsetAttr \".twn\" ",twn,";\n");
 	}
 	void setTipWidthNoiseFreq(float twnf)
 	{
 		if(twnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".twnf\" %f;\n", twnf);
+		writeFloat(mFile,"\tsetAttr \".twnf\" ",twnf,";\n");
 	}
 	void setTipWidthSamplesDirty(int twsd)
 	{
 		if(twsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".twsd\" %i;\n", twsd);
+		writeInt(mFile,"\tsetAttr \".twsd\" ",twsd,";\n");
 	}
 	void setTipWidthMapDirty(int twmd)
 	{
 		if(twmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".twmd\" %i;\n", twmd);
+		writeInt(mFile,"\tsetAttr \".twmd\" ",twmd,";\n");
 	}
 	void setScraggle(float ds)
 	{
 		if(ds == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %f;\n", ds);
+		writeFloat(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void setScraggleSamples(size_t ss_i,double ss)
 	{
 		if(ss == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ss[%i]\" %f;\n", ss_i,ss);
+		writeInt(mFile,"\tsetAttr \".ss[",ss_i); writeFloat(mFile,"]\" ",ss,";\n");
 	}
 	void setScraggleSamples(size_t ss_start,size_t ss_end,double* ss)
 	{
-		fprintf(mFile,"\tsetAttr \".ss[%i:%i]\" ", ss_start,ss_end);
+		writeInt(mFile,"\tsetAttr \".ss[",ss_start); writeInt(mFile,":",ss_end,"]\" ");
 		size_t size = (ss_end-ss_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ss[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ss[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startScraggleSamples(size_t ss_start,size_t ss_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ss[%i:%i]\"",ss_start,ss_end);
+		writeInt(mFile,"\tsetAttr \".ss[",ss_start); writeInt(mFile,":",ss_end,"]\"");
 	}
 	void appendScraggleSamples(double ss)const
 	{
-		fprintf(mFile," %f",ss);
+		writeFloat(mFile," ",ss);
 	}
 	void endScraggleSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScraggleMap(const string& sm)
 	{
 		if(sm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".sm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".sm\" -type \"string\" ");
 		sm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScraggleMapOffset(float smo)
 	{
 		if(smo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".smo\" %f;\n", smo);
+		writeFloat(mFile,"\tsetAttr \".smo\" ",smo,";\n");
 	}
 	void setScraggleMapMult(float smm)
 	{
 		if(smm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".smm\" %f;\n", smm);
+		writeFloat(mFile,"\tsetAttr \".smm\" ",smm,";\n");
 	}
 	void setScraggleNoise(float sn)
 	{
 		if(sn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sn\" %f;\n", sn);
+		writeFloat(mFile,"\tsetAttr \".sn\" ",sn,";\n");
 	}
 	void setScraggleNoiseFreq(float snf)
 	{
 		if(snf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".snf\" %f;\n", snf);
+		writeFloat(mFile,"\tsetAttr \".snf\" ",snf,";\n");
 	}
 	void setScraggleSamplesDirty(int ssd)
 	{
 		if(ssd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ssd\" %i;\n", ssd);
+		writeInt(mFile,"\tsetAttr \".ssd\" ",ssd,";\n");
 	}
 	void setScraggleMapDirty(int smd)
 	{
 		if(smd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".smd\" %i;\n", smd);
+		writeInt(mFile,"\tsetAttr \".smd\" ",smd,";\n");
 	}
 	void setScraggleCorrelation(float dsco)
 	{
 		if(dsco == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dsco\" %f;\n", dsco);
+		writeFloat(mFile,"\tsetAttr \".dsco\" ",dsco,";\n");
 	}
 	void setScraggleCorrelationSamples(size_t scos_i,double scos)
 	{
 		if(scos == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scos[%i]\" %f;\n", scos_i,scos);
+		writeInt(mFile,"\tsetAttr \".scos[",scos_i); writeFloat(mFile,"]\" ",scos,";\n");
 	}
 	void setScraggleCorrelationSamples(size_t scos_start,size_t scos_end,double* scos)
 	{
-		fprintf(mFile,"\tsetAttr \".scos[%i:%i]\" ", scos_start,scos_end);
+		writeInt(mFile,"\tsetAttr \".scos[",scos_start); writeInt(mFile,":",scos_end,"]\" ");
 		size_t size = (scos_end-scos_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",scos[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",scos[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startScraggleCorrelationSamples(size_t scos_start,size_t scos_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".scos[%i:%i]\"",scos_start,scos_end);
+		writeInt(mFile,"\tsetAttr \".scos[",scos_start); writeInt(mFile,":",scos_end,"]\"");
 	}
 	void appendScraggleCorrelationSamples(double scos)const
 	{
-		fprintf(mFile," %f",scos);
+		writeFloat(mFile," ",scos);
 	}
 	void endScraggleCorrelationSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScraggleCorrelationMap(const string& scom)
 	{
 		if(scom == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".scom\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".scom\" -type \"string\" ");
 		scom.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScraggleCorrelationMapOffset(float scomo)
 	{
 		if(scomo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scomo\" %f;\n", scomo);
+		writeFloat(mFile,"\tsetAttr \".scomo\" ",scomo,";\n");
 	}
 	void setScraggleCorrelationMapMult(float scomm)
 	{
 		if(scomm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".scomm\" %f;\n", scomm);
+		writeFloat(mFile,"\tsetAttr \".scomm\" ",scomm,";\n");
 	}
 	void setScraggleCorrelationNoise(float scon)
 	{
 		if(scon == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scon\" %f;\n", scon);
+		writeFloat(mFile,"\tsetAttr \".scon\" ",scon,";\n");
 	}
 	void setScraggleCorrelationNoiseFreq(float sconf)
 	{
 		if(sconf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".sconf\" %f;\n", sconf);
+		writeFloat(mFile,"\tsetAttr \".sconf\" ",sconf,";\n");
 	}
 	void setScraggleCorrelationSamplesDirty(int scosd)
 	{
 		if(scosd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scosd\" %i;\n", scosd);
+		writeInt(mFile,"\tsetAttr \".scosd\" ",scosd,";\n");
 	}
 	void setScraggleCorrelationMapDirty(int scomd)
 	{
 		if(scomd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scomd\" %i;\n", scomd);
+		writeInt(mFile,"\tsetAttr \".scomd\" ",scomd,";\n");
 	}
 	void setScraggleFrequency(float dscf)
 	{
 		if(dscf == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".dscf\" %f;\n", dscf);
+		writeFloat(mFile,"\tsetAttr \".dscf\" ",dscf,";\n");
 	}
 	void setScraggleFrequencySamples(size_t scfs_i,double scfs)
 	{
 		if(scfs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scfs[%i]\" %f;\n", scfs_i,scfs);
+		writeInt(mFile,"\tsetAttr \".scfs[",scfs_i); writeFloat(mFile,"]\" ",scfs,";\n");
 	}
 	void setScraggleFrequencySamples(size_t scfs_start,size_t scfs_end,double* scfs)
 	{
-		fprintf(mFile,"\tsetAttr \".scfs[%i:%i]\" ", scfs_start,scfs_end);
+		writeInt(mFile,"\tsetAttr \".scfs[",scfs_start); writeInt(mFile,":",scfs_end,"]\" ");
 		size_t size = (scfs_end-scfs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",scfs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",scfs[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startScraggleFrequencySamples(size_t scfs_start,size_t scfs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".scfs[%i:%i]\"",scfs_start,scfs_end);
+		writeInt(mFile,"\tsetAttr \".scfs[",scfs_start); writeInt(mFile,":",scfs_end,"]\"");
 	}
 	void appendScraggleFrequencySamples(double scfs)const
 	{
-		fprintf(mFile," %f",scfs);
+		writeFloat(mFile," ",scfs);
 	}
 	void endScraggleFrequencySamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScraggleFrequencyMap(const string& scfm)
 	{
 		if(scfm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".scfm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".scfm\" -type \"string\" ");
 		scfm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScraggleFrequencyMapOffset(float scfmo)
 	{
 		if(scfmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scfmo\" %f;\n", scfmo);
+		writeFloat(mFile,"\tsetAttr \".scfmo\" ",scfmo,";\n");
 	}
 	void setScraggleFrequencyMapMult(float scfmm)
 	{
 		if(scfmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".scfmm\" %f;\n", scfmm);
+		writeFloat(mFile,"\tsetAttr \".scfmm\" ",scfmm,";\n");
 	}
 	void setScraggleFrequencyNoise(float scfn)
 	{
 		if(scfn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scfn\" %f;\n", scfn);
+		writeFloat(mFile,"\tsetAttr \".scfn\" ",scfn,";\n");
 	}
 	void setScraggleFrequencyNoiseFreq(float scfnf)
 	{
 		if(scfnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".scfnf\" %f;\n", scfnf);
+		writeFloat(mFile,"\tsetAttr \".scfnf\" ",scfnf,";\n");
 	}
 	void setScraggleFrequencySamplesDirty(int scfsd)
 	{
 		if(scfsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scfsd\" %i;\n", scfsd);
+		writeInt(mFile,"\tsetAttr \".scfsd\" ",scfsd,";\n");
 	}
 	void setScraggleFrequencyMapDirty(int scfmd)
 	{
 		if(scfmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scfmd\" %i;\n", scfmd);
+		writeInt(mFile,"\tsetAttr \".scfmd\" ",scfmd,";\n");
 	}
 	void setSegments(float dseg)
 	{
 		if(dseg == 10) return;
-		fprintf(mFile,"\tsetAttr \".dseg\" %f;\n", dseg);
+		writeFloat(mFile,"\tsetAttr \".dseg\" ",dseg,";\n");
 	}
 	void setSegmentsSamples(size_t segs_i,double segs)
 	{
 		if(segs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".segs[%i]\" %f;\n", segs_i,segs);
+		writeInt(mFile,"\tsetAttr \".segs[",segs_i); writeFloat(mFile,"]\" ",segs,";\n");
 	}
 	void setSegmentsSamples(size_t segs_start,size_t segs_end,double* segs)
 	{
-		fprintf(mFile,"\tsetAttr \".segs[%i:%i]\" ", segs_start,segs_end);
+		writeInt(mFile,"\tsetAttr \".segs[",segs_start); writeInt(mFile,":",segs_end,"]\" ");
 		size_t size = (segs_end-segs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",segs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",segs[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSegmentsSamples(size_t segs_start,size_t segs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".segs[%i:%i]\"",segs_start,segs_end);
+		writeInt(mFile,"\tsetAttr \".segs[",segs_start); writeInt(mFile,":",segs_end,"]\"");
 	}
 	void appendSegmentsSamples(double segs)const
 	{
-		fprintf(mFile," %f",segs);
+		writeFloat(mFile," ",segs);
 	}
 	void endSegmentsSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSegmentsMap(const string& segm)
 	{
 		if(segm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".segm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".segm\" -type \"string\" ");
 		segm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSegmentsMapOffset(float segmo)
 	{
 		if(segmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".segmo\" %f;\n", segmo);
+		writeFloat(mFile,"\tsetAttr \".segmo\" ",segmo,";\n");
 	}
 	void setSegmentsMapMult(float segmm)
 	{
 		if(segmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".segmm\" %f;\n", segmm);
+		writeFloat(mFile,"\tsetAttr \".segmm\" ",segmm,";\n");
 	}
 	void setSegmentsNoise(float segn)
 	{
 		if(segn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".segn\" %f;\n", segn);
+		writeFloat(mFile,"\tsetAttr \".segn\" ",segn,";\n");
 	}
 	void setSegmentsNoiseFreq(float segnf)
 	{
 		if(segnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".segnf\" %f;\n", segnf);
+		writeFloat(mFile,"\tsetAttr \".segnf\" ",segnf,";\n");
 	}
 	void setSegmentsSamplesDirty(int segsd)
 	{
 		if(segsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".segsd\" %i;\n", segsd);
+		writeInt(mFile,"\tsetAttr \".segsd\" ",segsd,";\n");
 	}
 	void setSegmentsMapDirty(int segmd)
 	{
 		if(segmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".segmd\" %i;\n", segmd);
+		writeInt(mFile,"\tsetAttr \".segmd\" ",segmd,";\n");
 	}
 	void setAttraction(float dat)
 	{
 		if(dat == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dat\" %f;\n", dat);
+		writeFloat(mFile,"\tsetAttr \".dat\" ",dat,";\n");
 	}
 	void setAttractionSamples(size_t ats_i,double ats)
 	{
 		if(ats == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ats[%i]\" %f;\n", ats_i,ats);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i); writeFloat(mFile,"]\" ",ats,";\n");
 	}
 	void setAttractionSamples(size_t ats_start,size_t ats_end,double* ats)
 	{
-		fprintf(mFile,"\tsetAttr \".ats[%i:%i]\" ", ats_start,ats_end);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_start); writeInt(mFile,":",ats_end,"]\" ");
 		size_t size = (ats_end-ats_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ats[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ats[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startAttractionSamples(size_t ats_start,size_t ats_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ats[%i:%i]\"",ats_start,ats_end);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_start); writeInt(mFile,":",ats_end,"]\"");
 	}
 	void appendAttractionSamples(double ats)const
 	{
-		fprintf(mFile," %f",ats);
+		writeFloat(mFile," ",ats);
 	}
 	void endAttractionSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttractionMap(const string& atm)
 	{
 		if(atm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".atm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".atm\" -type \"string\" ");
 		atm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttractionMapOffset(float atmo)
 	{
 		if(atmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".atmo\" %f;\n", atmo);
+		writeFloat(mFile,"\tsetAttr \".atmo\" ",atmo,";\n");
 	}
 	void setAttractionMapMult(float atmm)
 	{
 		if(atmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".atmm\" %f;\n", atmm);
+		writeFloat(mFile,"\tsetAttr \".atmm\" ",atmm,";\n");
 	}
 	void setAttractionNoise(float atn)
 	{
 		if(atn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".atn\" %f;\n", atn);
+		writeFloat(mFile,"\tsetAttr \".atn\" ",atn,";\n");
 	}
 	void setAttractionNoiseFreq(float atnf)
 	{
 		if(atnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".atnf\" %f;\n", atnf);
+		writeFloat(mFile,"\tsetAttr \".atnf\" ",atnf,";\n");
 	}
 	void setAttractionSamplesDirty(int atsd)
 	{
 		if(atsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".atsd\" %i;\n", atsd);
+		writeInt(mFile,"\tsetAttr \".atsd\" ",atsd,";\n");
 	}
 	void setAttractionMapDirty(int atmd)
 	{
 		if(atmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".atmd\" %i;\n", atmd);
+		writeInt(mFile,"\tsetAttr \".atmd\" ",atmd,";\n");
 	}
 	void setOffset(double dofs)
 	{
 		if(dofs == 0) return;
-		fprintf(mFile,"\tsetAttr \".dofs\" %f;\n", dofs);
+		writeFloat(mFile,"\tsetAttr \".dofs\" ",dofs,";\n");
 	}
 	void setOffsetSamples(size_t ofss_i,double ofss)
 	{
 		if(ofss == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ofss[%i]\" %f;\n", ofss_i,ofss);
+		writeInt(mFile,"\tsetAttr \".ofss[",ofss_i); writeFloat(mFile,"]\" ",ofss,";\n");
 	}
 	void setOffsetSamples(size_t ofss_start,size_t ofss_end,double* ofss)
 	{
-		fprintf(mFile,"\tsetAttr \".ofss[%i:%i]\" ", ofss_start,ofss_end);
+		writeInt(mFile,"\tsetAttr \".ofss[",ofss_start); writeInt(mFile,":",ofss_end,"]\" ");
 		size_t size = (ofss_end-ofss_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ofss[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ofss[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startOffsetSamples(size_t ofss_start,size_t ofss_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ofss[%i:%i]\"",ofss_start,ofss_end);
+		writeInt(mFile,"\tsetAttr \".ofss[",ofss_start); writeInt(mFile,":",ofss_end,"]\"");
 	}
 	void appendOffsetSamples(double ofss)const
 	{
-		fprintf(mFile," %f",ofss);
+		writeFloat(mFile," ",ofss);
 	}
 	void endOffsetSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetMap(const string& ofsm)
 	{
 		if(ofsm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".ofsm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ofsm\" -type \"string\" ");
 		ofsm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetMapOffset(double ofsmo)
 	{
 		if(ofsmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".ofsmo\" %f;\n", ofsmo);
+		writeFloat(mFile,"\tsetAttr \".ofsmo\" ",ofsmo,";\n");
 	}
 	void setOffsetMapMult(double ofsmm)
 	{
 		if(ofsmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".ofsmm\" %f;\n", ofsmm);
+		writeFloat(mFile,"\tsetAttr \".ofsmm\" ",ofsmm,";\n");
 	}
 	void setOffsetNoise(double ofsn)
 	{
 		if(ofsn == 0) return;
-		fprintf(mFile,"\tsetAttr \".ofsn\" %f;\n", ofsn);
+		writeFloat(mFile,"\tsetAttr \".ofsn\" ",ofsn,";\n");
 	}
 	void setOffsetNoiseFreq(float ofsnf)
 	{
 		if(ofsnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".ofsnf\" %f;\n", ofsnf);
+		writeFloat(mFile,"\tsetAttr \".ofsnf\" ",ofsnf,";\n");
 	}
 	void setOffsetSamplesDirty(int ofssd)
 	{
 		if(ofssd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ofssd\" %i;\n", ofssd);
+		writeInt(mFile,"\tsetAttr \".ofssd\" ",ofssd,";\n");
 	}
 	void setOffsetMapDirty(int ofsmd)
 	{
 		if(ofsmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ofsmd\" %i;\n", ofsmd);
+		writeInt(mFile,"\tsetAttr \".ofsmd\" ",ofsmd,";\n");
 	}
 	void setClumping(float dc)
 	{
 		if(dc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %f;\n", dc);
+		writeFloat(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void setClumpingSamples(size_t cs_i,double cs)
 	{
 		if(cs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i]\" %f;\n", cs_i,cs);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"]\" ",cs,";\n");
 	}
 	void setClumpingSamples(size_t cs_start,size_t cs_end,double* cs)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i:%i]\" ", cs_start,cs_end);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_start); writeInt(mFile,":",cs_end,"]\" ");
 		size_t size = (cs_end-cs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",cs[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClumpingSamples(size_t cs_start,size_t cs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i:%i]\"",cs_start,cs_end);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_start); writeInt(mFile,":",cs_end,"]\"");
 	}
 	void appendClumpingSamples(double cs)const
 	{
-		fprintf(mFile," %f",cs);
+		writeFloat(mFile," ",cs);
 	}
 	void endClumpingSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpingMap(const string& cm)
 	{
 		if(cm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".cm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cm\" -type \"string\" ");
 		cm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpingMapOffset(float cmo)
 	{
 		if(cmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cmo\" %f;\n", cmo);
+		writeFloat(mFile,"\tsetAttr \".cmo\" ",cmo,";\n");
 	}
 	void setClumpingMapMult(float cmm)
 	{
 		if(cmm == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cmm\" %f;\n", cmm);
+		writeFloat(mFile,"\tsetAttr \".cmm\" ",cmm,";\n");
 	}
 	void setClumpingNoise(float cn)
 	{
 		if(cn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cn\" %f;\n", cn);
+		writeFloat(mFile,"\tsetAttr \".cn\" ",cn,";\n");
 	}
 	void setClumpingNoiseFreq(float cnf)
 	{
 		if(cnf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cnf\" %f;\n", cnf);
+		writeFloat(mFile,"\tsetAttr \".cnf\" ",cnf,";\n");
 	}
 	void setClumpingSamplesDirty(int csd)
 	{
 		if(csd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csd\" %i;\n", csd);
+		writeInt(mFile,"\tsetAttr \".csd\" ",csd,";\n");
 	}
 	void setClumpingMapDirty(int cmd)
 	{
 		if(cmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cmd\" %i;\n", cmd);
+		writeInt(mFile,"\tsetAttr \".cmd\" ",cmd,";\n");
 	}
 	void setClumpingFrequency(float dcf)
 	{
 		if(dcf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcf\" %f;\n", dcf);
+		writeFloat(mFile,"\tsetAttr \".dcf\" ",dcf,";\n");
 	}
 	void setClumpingFrequencySamples(size_t cfs_i,double cfs)
 	{
 		if(cfs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfs[%i]\" %f;\n", cfs_i,cfs);
+		writeInt(mFile,"\tsetAttr \".cfs[",cfs_i); writeFloat(mFile,"]\" ",cfs,";\n");
 	}
 	void setClumpingFrequencySamples(size_t cfs_start,size_t cfs_end,double* cfs)
 	{
-		fprintf(mFile,"\tsetAttr \".cfs[%i:%i]\" ", cfs_start,cfs_end);
+		writeInt(mFile,"\tsetAttr \".cfs[",cfs_start); writeInt(mFile,":",cfs_end,"]\" ");
 		size_t size = (cfs_end-cfs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cfs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",cfs[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClumpingFrequencySamples(size_t cfs_start,size_t cfs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cfs[%i:%i]\"",cfs_start,cfs_end);
+		writeInt(mFile,"\tsetAttr \".cfs[",cfs_start); writeInt(mFile,":",cfs_end,"]\"");
 	}
 	void appendClumpingFrequencySamples(double cfs)const
 	{
-		fprintf(mFile," %f",cfs);
+		writeFloat(mFile," ",cfs);
 	}
 	void endClumpingFrequencySamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpingFrequencyMap(const string& cfm)
 	{
 		if(cfm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".cfm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cfm\" -type \"string\" ");
 		cfm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpingFrequencyMapOffset(float cfmo)
 	{
 		if(cfmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfmo\" %f;\n", cfmo);
+		writeFloat(mFile,"\tsetAttr \".cfmo\" ",cfmo,";\n");
 	}
 	void setClumpingFrequencyMapMult(float cfmm)
 	{
 		if(cfmm == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfmm\" %f;\n", cfmm);
+		writeFloat(mFile,"\tsetAttr \".cfmm\" ",cfmm,";\n");
 	}
 	void setClumpingFrequencyNoise(float cfn)
 	{
 		if(cfn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfn\" %f;\n", cfn);
+		writeFloat(mFile,"\tsetAttr \".cfn\" ",cfn,";\n");
 	}
 	void setClumpingFrequencyNoiseFreq(float cfnf)
 	{
 		if(cfnf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfnf\" %f;\n", cfnf);
+		writeFloat(mFile,"\tsetAttr \".cfnf\" ",cfnf,";\n");
 	}
 	void setClumpingFrequencySamplesDirty(int cfsd)
 	{
 		if(cfsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfsd\" %i;\n", cfsd);
+		writeInt(mFile,"\tsetAttr \".cfsd\" ",cfsd,";\n");
 	}
 	void setClumpingFrequencyMapDirty(int cfmd)
 	{
 		if(cfmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfmd\" %i;\n", cfmd);
+		writeInt(mFile,"\tsetAttr \".cfmd\" ",cfmd,";\n");
 	}
 	void setClumpingShape(float dcs)
 	{
 		if(dcs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcs\" %f;\n", dcs);
+		writeFloat(mFile,"\tsetAttr \".dcs\" ",dcs,";\n");
 	}
 	void setClumpingShapeSamples(size_t css_i,double css)
 	{
 		if(css == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".css[%i]\" %f;\n", css_i,css);
+		writeInt(mFile,"\tsetAttr \".css[",css_i); writeFloat(mFile,"]\" ",css,";\n");
 	}
 	void setClumpingShapeSamples(size_t css_start,size_t css_end,double* css)
 	{
-		fprintf(mFile,"\tsetAttr \".css[%i:%i]\" ", css_start,css_end);
+		writeInt(mFile,"\tsetAttr \".css[",css_start); writeInt(mFile,":",css_end,"]\" ");
 		size_t size = (css_end-css_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",css[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",css[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClumpingShapeSamples(size_t css_start,size_t css_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".css[%i:%i]\"",css_start,css_end);
+		writeInt(mFile,"\tsetAttr \".css[",css_start); writeInt(mFile,":",css_end,"]\"");
 	}
 	void appendClumpingShapeSamples(double css)const
 	{
-		fprintf(mFile," %f",css);
+		writeFloat(mFile," ",css);
 	}
 	void endClumpingShapeSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpingShapeMap(const string& csm)
 	{
 		if(csm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".csm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".csm\" -type \"string\" ");
 		csm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpingShapeMapOffset(float csmo)
 	{
 		if(csmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csmo\" %f;\n", csmo);
+		writeFloat(mFile,"\tsetAttr \".csmo\" ",csmo,";\n");
 	}
 	void setClumpingShapeMapMult(float csmm)
 	{
 		if(csmm == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csmm\" %f;\n", csmm);
+		writeFloat(mFile,"\tsetAttr \".csmm\" ",csmm,";\n");
 	}
 	void setClumpingShapeNoise(float csn)
 	{
 		if(csn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csn\" %f;\n", csn);
+		writeFloat(mFile,"\tsetAttr \".csn\" ",csn,";\n");
 	}
 	void setClumpingShapeNoiseFreq(float csnf)
 	{
 		if(csnf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csnf\" %f;\n", csnf);
+		writeFloat(mFile,"\tsetAttr \".csnf\" ",csnf,";\n");
 	}
 	void setClumpingShapeSamplesDirty(int cssd)
 	{
 		if(cssd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cssd\" %i;\n", cssd);
+		writeInt(mFile,"\tsetAttr \".cssd\" ",cssd,";\n");
 	}
 	void setClumpingShapeMapDirty(int csmd)
 	{
 		if(csmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csmd\" %i;\n", csmd);
+		writeInt(mFile,"\tsetAttr \".csmd\" ",csmd,";\n");
 	}
 	void setBaseColor(const float3& dbc)
 	{
 		if(dbc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".dbc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dbc\" -type \"float3\" ");
 		dbc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseColorR(float dbcr)
 	{
 		if(dbcr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dbcr\" %f;\n", dbcr);
+		writeFloat(mFile,"\tsetAttr \".dbcr\" ",dbcr,";\n");
 	}
 	void setBaseColorG(float dbcg)
 	{
 		if(dbcg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dbcg\" %f;\n", dbcg);
+		writeFloat(mFile,"\tsetAttr \".dbcg\" ",dbcg,";\n");
 	}
 	void setBaseColorB(float dbcb)
 	{
 		if(dbcb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dbcb\" %f;\n", dbcb);
+		writeFloat(mFile,"\tsetAttr \".dbcb\" ",dbcb,";\n");
 	}
 	void setBaseColorSamples(size_t bcs_i,double bcs)
 	{
 		if(bcs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcs[%i]\" %f;\n", bcs_i,bcs);
+		writeInt(mFile,"\tsetAttr \".bcs[",bcs_i); writeFloat(mFile,"]\" ",bcs,";\n");
 	}
 	void setBaseColorSamples(size_t bcs_start,size_t bcs_end,double* bcs)
 	{
-		fprintf(mFile,"\tsetAttr \".bcs[%i:%i]\" ", bcs_start,bcs_end);
+		writeInt(mFile,"\tsetAttr \".bcs[",bcs_start); writeInt(mFile,":",bcs_end,"]\" ");
 		size_t size = (bcs_end-bcs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bcs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",bcs[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBaseColorSamples(size_t bcs_start,size_t bcs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".bcs[%i:%i]\"",bcs_start,bcs_end);
+		writeInt(mFile,"\tsetAttr \".bcs[",bcs_start); writeInt(mFile,":",bcs_end,"]\"");
 	}
 	void appendBaseColorSamples(double bcs)const
 	{
-		fprintf(mFile," %f",bcs);
+		writeFloat(mFile," ",bcs);
 	}
 	void endBaseColorSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseColorMap(const string& bcm)
 	{
 		if(bcm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".bcm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bcm\" -type \"string\" ");
 		bcm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseColorNoise(float bcn)
 	{
 		if(bcn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcn\" %f;\n", bcn);
+		writeFloat(mFile,"\tsetAttr \".bcn\" ",bcn,";\n");
 	}
 	void setBaseColorNoiseFreq(float bcnf)
 	{
 		if(bcnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".bcnf\" %f;\n", bcnf);
+		writeFloat(mFile,"\tsetAttr \".bcnf\" ",bcnf,";\n");
 	}
 	void setBaseColorSamplesDirty(int bcsd)
 	{
 		if(bcsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcsd\" %i;\n", bcsd);
+		writeInt(mFile,"\tsetAttr \".bcsd\" ",bcsd,";\n");
 	}
 	void setBaseColorMapDirty(int bcmd)
 	{
 		if(bcmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcmd\" %i;\n", bcmd);
+		writeInt(mFile,"\tsetAttr \".bcmd\" ",bcmd,";\n");
 	}
 	void setTipColor(const float3& dtc)
 	{
 		if(dtc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".dtc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dtc\" -type \"float3\" ");
 		dtc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipColorR(float dtcr)
 	{
 		if(dtcr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dtcr\" %f;\n", dtcr);
+		writeFloat(mFile,"\tsetAttr \".dtcr\" ",dtcr,";\n");
 	}
 	void setTipColorG(float dtcg)
 	{
 		if(dtcg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dtcg\" %f;\n", dtcg);
+		writeFloat(mFile,"\tsetAttr \".dtcg\" ",dtcg,";\n");
 	}
 	void setTipColorB(float dtcb)
 	{
 		if(dtcb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dtcb\" %f;\n", dtcb);
+		writeFloat(mFile,"\tsetAttr \".dtcb\" ",dtcb,";\n");
 	}
 	void setTipColorSamples(size_t tcs_i,double tcs)
 	{
 		if(tcs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcs[%i]\" %f;\n", tcs_i,tcs);
+		writeInt(mFile,"\tsetAttr \".tcs[",tcs_i); writeFloat(mFile,"]\" ",tcs,";\n");
 	}
 	void setTipColorSamples(size_t tcs_start,size_t tcs_end,double* tcs)
 	{
-		fprintf(mFile,"\tsetAttr \".tcs[%i:%i]\" ", tcs_start,tcs_end);
+		writeInt(mFile,"\tsetAttr \".tcs[",tcs_start); writeInt(mFile,":",tcs_end,"]\" ");
 		size_t size = (tcs_end-tcs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tcs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",tcs[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTipColorSamples(size_t tcs_start,size_t tcs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tcs[%i:%i]\"",tcs_start,tcs_end);
+		writeInt(mFile,"\tsetAttr \".tcs[",tcs_start); writeInt(mFile,":",tcs_end,"]\"");
 	}
 	void appendTipColorSamples(double tcs)const
 	{
-		fprintf(mFile," %f",tcs);
+		writeFloat(mFile," ",tcs);
 	}
 	void endTipColorSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipColorMap(const string& tcm)
 	{
 		if(tcm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".tcm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".tcm\" -type \"string\" ");
 		tcm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTipColorNoise(float tcn)
 	{
 		if(tcn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcn\" %f;\n", tcn);
+		writeFloat(mFile,"\tsetAttr \".tcn\" ",tcn,";\n");
 	}
 	void setTipColorNoiseFreq(float tcnf)
 	{
 		if(tcnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".tcnf\" %f;\n", tcnf);
+		writeFloat(mFile,"\tsetAttr \".tcnf\" ",tcnf,";\n");
 	}
 	void setTipColorSamplesDirty(int tcsd)
 	{
 		if(tcsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcsd\" %i;\n", tcsd);
+		writeInt(mFile,"\tsetAttr \".tcsd\" ",tcsd,";\n");
 	}
 	void setTipColorMapDirty(int tcmd)
 	{
 		if(tcmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcmd\" %i;\n", tcmd);
+		writeInt(mFile,"\tsetAttr \".tcmd\" ",tcmd,";\n");
 	}
 	void setRadius(double dar)
 	{
 		if(dar == 1) return;
-		fprintf(mFile,"\tsetAttr \".dar\" %f;\n", dar);
+		writeFloat(mFile,"\tsetAttr \".dar\" ",dar,";\n");
 	}
 	void setRadiusSamples(size_t ars_i,double ars)
 	{
 		if(ars == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ars[%i]\" %f;\n", ars_i,ars);
+		writeInt(mFile,"\tsetAttr \".ars[",ars_i); writeFloat(mFile,"]\" ",ars,";\n");
 	}
 	void setRadiusSamples(size_t ars_start,size_t ars_end,double* ars)
 	{
-		fprintf(mFile,"\tsetAttr \".ars[%i:%i]\" ", ars_start,ars_end);
+		writeInt(mFile,"\tsetAttr \".ars[",ars_start); writeInt(mFile,":",ars_end,"]\" ");
 		size_t size = (ars_end-ars_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ars[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ars[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startRadiusSamples(size_t ars_start,size_t ars_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ars[%i:%i]\"",ars_start,ars_end);
+		writeInt(mFile,"\tsetAttr \".ars[",ars_start); writeInt(mFile,":",ars_end,"]\"");
 	}
 	void appendRadiusSamples(double ars)const
 	{
-		fprintf(mFile," %f",ars);
+		writeFloat(mFile," ",ars);
 	}
 	void endRadiusSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRadiusMap(const string& arm)
 	{
 		if(arm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".arm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".arm\" -type \"string\" ");
 		arm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRadiusMapOffset(double armo)
 	{
 		if(armo == 0) return;
-		fprintf(mFile,"\tsetAttr \".armo\" %f;\n", armo);
+		writeFloat(mFile,"\tsetAttr \".armo\" ",armo,";\n");
 	}
 	void setRadiusMapMult(double armm)
 	{
 		if(armm == 1) return;
-		fprintf(mFile,"\tsetAttr \".armm\" %f;\n", armm);
+		writeFloat(mFile,"\tsetAttr \".armm\" ",armm,";\n");
 	}
 	void setRadiusNoise(double arn)
 	{
 		if(arn == 0) return;
-		fprintf(mFile,"\tsetAttr \".arn\" %f;\n", arn);
+		writeFloat(mFile,"\tsetAttr \".arn\" ",arn,";\n");
 	}
 	void setRadiusNoiseFreq(float arnf)
 	{
 		if(arnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".arnf\" %f;\n", arnf);
+		writeFloat(mFile,"\tsetAttr \".arnf\" ",arnf,";\n");
 	}
 	void setRadiusSamplesDirty(int arsd)
 	{
 		if(arsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".arsd\" %i;\n", arsd);
+		writeInt(mFile,"\tsetAttr \".arsd\" ",arsd,";\n");
 	}
 	void setRadiusMapDirty(int armd)
 	{
 		if(armd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".armd\" %i;\n", armd);
+		writeInt(mFile,"\tsetAttr \".armd\" ",armd,";\n");
 	}
 	void setPower(float dap)
 	{
 		if(dap == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dap\" %f;\n", dap);
+		writeFloat(mFile,"\tsetAttr \".dap\" ",dap,";\n");
 	}
 	void setPowerSamples(size_t aps_i,double aps)
 	{
 		if(aps == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aps[%i]\" %f;\n", aps_i,aps);
+		writeInt(mFile,"\tsetAttr \".aps[",aps_i); writeFloat(mFile,"]\" ",aps,";\n");
 	}
 	void setPowerSamples(size_t aps_start,size_t aps_end,double* aps)
 	{
-		fprintf(mFile,"\tsetAttr \".aps[%i:%i]\" ", aps_start,aps_end);
+		writeInt(mFile,"\tsetAttr \".aps[",aps_start); writeInt(mFile,":",aps_end,"]\" ");
 		size_t size = (aps_end-aps_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",aps[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",aps[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPowerSamples(size_t aps_start,size_t aps_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".aps[%i:%i]\"",aps_start,aps_end);
+		writeInt(mFile,"\tsetAttr \".aps[",aps_start); writeInt(mFile,":",aps_end,"]\"");
 	}
 	void appendPowerSamples(double aps)const
 	{
-		fprintf(mFile," %f",aps);
+		writeFloat(mFile," ",aps);
 	}
 	void endPowerSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPowerMap(const string& apm)
 	{
 		if(apm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".apm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".apm\" -type \"string\" ");
 		apm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPowerMapOffset(float apmo)
 	{
 		if(apmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".apmo\" %f;\n", apmo);
+		writeFloat(mFile,"\tsetAttr \".apmo\" ",apmo,";\n");
 	}
 	void setPowerMapMult(float apmm)
 	{
 		if(apmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".apmm\" %f;\n", apmm);
+		writeFloat(mFile,"\tsetAttr \".apmm\" ",apmm,";\n");
 	}
 	void setPowerNoise(float apn)
 	{
 		if(apn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".apn\" %f;\n", apn);
+		writeFloat(mFile,"\tsetAttr \".apn\" ",apn,";\n");
 	}
 	void setPowerNoiseFreq(float apnf)
 	{
 		if(apnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".apnf\" %f;\n", apnf);
+		writeFloat(mFile,"\tsetAttr \".apnf\" ",apnf,";\n");
 	}
 	void setPowerSamplesDirty(int apsd)
 	{
 		if(apsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".apsd\" %i;\n", apsd);
+		writeInt(mFile,"\tsetAttr \".apsd\" ",apsd,";\n");
 	}
 	void setPowerMapDirty(int apmd)
 	{
 		if(apmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".apmd\" %i;\n", apmd);
+		writeInt(mFile,"\tsetAttr \".apmd\" ",apmd,";\n");
 	}
 	void setInfluence(float dai)
 	{
 		if(dai == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dai\" %f;\n", dai);
+		writeFloat(mFile,"\tsetAttr \".dai\" ",dai,";\n");
 	}
 	void setInfluenceSamples(size_t ais_i,double ais)
 	{
 		if(ais == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ais[%i]\" %f;\n", ais_i,ais);
+		writeInt(mFile,"\tsetAttr \".ais[",ais_i); writeFloat(mFile,"]\" ",ais,";\n");
 	}
 	void setInfluenceSamples(size_t ais_start,size_t ais_end,double* ais)
 	{
-		fprintf(mFile,"\tsetAttr \".ais[%i:%i]\" ", ais_start,ais_end);
+		writeInt(mFile,"\tsetAttr \".ais[",ais_start); writeInt(mFile,":",ais_end,"]\" ");
 		size_t size = (ais_end-ais_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ais[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ais[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInfluenceSamples(size_t ais_start,size_t ais_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ais[%i:%i]\"",ais_start,ais_end);
+		writeInt(mFile,"\tsetAttr \".ais[",ais_start); writeInt(mFile,":",ais_end,"]\"");
 	}
 	void appendInfluenceSamples(double ais)const
 	{
-		fprintf(mFile," %f",ais);
+		writeFloat(mFile," ",ais);
 	}
 	void endInfluenceSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInfluenceMap(const string& aim)
 	{
 		if(aim == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".aim\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".aim\" -type \"string\" ");
 		aim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInfluenceMapOffset(float aimo)
 	{
 		if(aimo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aimo\" %f;\n", aimo);
+		writeFloat(mFile,"\tsetAttr \".aimo\" ",aimo,";\n");
 	}
 	void setInfluenceMapMult(float aimm)
 	{
 		if(aimm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".aimm\" %f;\n", aimm);
+		writeFloat(mFile,"\tsetAttr \".aimm\" ",aimm,";\n");
 	}
 	void setInfluenceNoise(float ain)
 	{
 		if(ain == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ain\" %f;\n", ain);
+		writeFloat(mFile,"\tsetAttr \".ain\" ",ain,";\n");
 	}
 	void setInfluenceNoiseFreq(float ainf)
 	{
 		if(ainf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".ainf\" %f;\n", ainf);
+		writeFloat(mFile,"\tsetAttr \".ainf\" ",ainf,";\n");
 	}
 	void setInfluenceSamplesDirty(int aisd)
 	{
 		if(aisd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aisd\" %i;\n", aisd);
+		writeInt(mFile,"\tsetAttr \".aisd\" ",aisd,";\n");
 	}
 	void setInfluenceMapDirty(int aimd)
 	{
 		if(aimd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aimd\" %i;\n", aimd);
+		writeInt(mFile,"\tsetAttr \".aimd\" ",aimd,";\n");
 	}
 	void setStartLength(double dasl)
 	{
 		if(dasl == 0) return;
-		fprintf(mFile,"\tsetAttr \".dasl\" %f;\n", dasl);
+		writeFloat(mFile,"\tsetAttr \".dasl\" ",dasl,";\n");
 	}
 	void setStartLengthSamples(size_t asls_i,double asls)
 	{
 		if(asls == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".asls[%i]\" %f;\n", asls_i,asls);
+		writeInt(mFile,"\tsetAttr \".asls[",asls_i); writeFloat(mFile,"]\" ",asls,";\n");
 	}
 	void setStartLengthSamples(size_t asls_start,size_t asls_end,double* asls)
 	{
-		fprintf(mFile,"\tsetAttr \".asls[%i:%i]\" ", asls_start,asls_end);
+		writeInt(mFile,"\tsetAttr \".asls[",asls_start); writeInt(mFile,":",asls_end,"]\" ");
 		size_t size = (asls_end-asls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",asls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",asls[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startStartLengthSamples(size_t asls_start,size_t asls_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".asls[%i:%i]\"",asls_start,asls_end);
+		writeInt(mFile,"\tsetAttr \".asls[",asls_start); writeInt(mFile,":",asls_end,"]\"");
 	}
 	void appendStartLengthSamples(double asls)const
 	{
-		fprintf(mFile," %f",asls);
+		writeFloat(mFile," ",asls);
 	}
 	void endStartLengthSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStartLengthMap(const string& aslm)
 	{
 		if(aslm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".aslm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".aslm\" -type \"string\" ");
 		aslm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStartLengthMapOffset(double aslmo)
 	{
 		if(aslmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".aslmo\" %f;\n", aslmo);
+		writeFloat(mFile,"\tsetAttr \".aslmo\" ",aslmo,";\n");
 	}
 	void setStartLengthMapMult(double aslmm)
 	{
 		if(aslmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".aslmm\" %f;\n", aslmm);
+		writeFloat(mFile,"\tsetAttr \".aslmm\" ",aslmm,";\n");
 	}
 	void setStartLengthNoise(double asln)
 	{
 		if(asln == 0) return;
-		fprintf(mFile,"\tsetAttr \".asln\" %f;\n", asln);
+		writeFloat(mFile,"\tsetAttr \".asln\" ",asln,";\n");
 	}
 	void setStartLengthNoiseFreq(float aslnf)
 	{
 		if(aslnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".aslnf\" %f;\n", aslnf);
+		writeFloat(mFile,"\tsetAttr \".aslnf\" ",aslnf,";\n");
 	}
 	void setStartLengthSamplesDirty(int aslsd)
 	{
 		if(aslsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aslsd\" %i;\n", aslsd);
+		writeInt(mFile,"\tsetAttr \".aslsd\" ",aslsd,";\n");
 	}
 	void setStartLengthMapDirty(int aslmd)
 	{
 		if(aslmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aslmd\" %i;\n", aslmd);
+		writeInt(mFile,"\tsetAttr \".aslmd\" ",aslmd,";\n");
 	}
 	void setEndLength(double dael)
 	{
 		if(dael == 5) return;
-		fprintf(mFile,"\tsetAttr \".dael\" %f;\n", dael);
+		writeFloat(mFile,"\tsetAttr \".dael\" ",dael,";\n");
 	}
 	void setEndLengthSamples(size_t aels_i,double aels)
 	{
 		if(aels == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aels[%i]\" %f;\n", aels_i,aels);
+		writeInt(mFile,"\tsetAttr \".aels[",aels_i); writeFloat(mFile,"]\" ",aels,";\n");
 	}
 	void setEndLengthSamples(size_t aels_start,size_t aels_end,double* aels)
 	{
-		fprintf(mFile,"\tsetAttr \".aels[%i:%i]\" ", aels_start,aels_end);
+		writeInt(mFile,"\tsetAttr \".aels[",aels_start); writeInt(mFile,":",aels_end,"]\" ");
 		size_t size = (aels_end-aels_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",aels[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",aels[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEndLengthSamples(size_t aels_start,size_t aels_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".aels[%i:%i]\"",aels_start,aels_end);
+		writeInt(mFile,"\tsetAttr \".aels[",aels_start); writeInt(mFile,":",aels_end,"]\"");
 	}
 	void appendEndLengthSamples(double aels)const
 	{
-		fprintf(mFile," %f",aels);
+		writeFloat(mFile," ",aels);
 	}
 	void endEndLengthSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEndLengthMap(const string& aelm)
 	{
 		if(aelm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".aelm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".aelm\" -type \"string\" ");
 		aelm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEndLengthMapOffset(double aelmo)
 	{
 		if(aelmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".aelmo\" %f;\n", aelmo);
+		writeFloat(mFile,"\tsetAttr \".aelmo\" ",aelmo,";\n");
 	}
 	void setEndLengthMapMult(double aelmm)
 	{
 		if(aelmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".aelmm\" %f;\n", aelmm);
+		writeFloat(mFile,"\tsetAttr \".aelmm\" ",aelmm,";\n");
 	}
 	void setEndLengthNoise(double aeln)
 	{
 		if(aeln == 0) return;
-		fprintf(mFile,"\tsetAttr \".aeln\" %f;\n", aeln);
+		writeFloat(mFile,"\tsetAttr \".aeln\" ",aeln,";\n");
 	}
 	void setEndLengthNoiseFreq(float aelnf)
 	{
 		if(aelnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".aelnf\" %f;\n", aelnf);
+		writeFloat(mFile,"\tsetAttr \".aelnf\" ",aelnf,";\n");
 	}
 	void setEndLengthSamplesDirty(int aelsd)
 	{
 		if(aelsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aelsd\" %i;\n", aelsd);
+		writeInt(mFile,"\tsetAttr \".aelsd\" ",aelsd,";\n");
 	}
 	void setEndLengthMapDirty(int aelmd)
 	{
 		if(aelmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".aelmd\" %i;\n", aelmd);
+		writeInt(mFile,"\tsetAttr \".aelmd\" ",aelmd,";\n");
 	}
 	void setThresholdLength(double datl)
 	{
 		if(datl == 0) return;
-		fprintf(mFile,"\tsetAttr \".datl\" %f;\n", datl);
+		writeFloat(mFile,"\tsetAttr \".datl\" ",datl,";\n");
 	}
 	void setThresholdLengthSamples(size_t atls_i,double atls)
 	{
 		if(atls == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".atls[%i]\" %f;\n", atls_i,atls);
+		writeInt(mFile,"\tsetAttr \".atls[",atls_i); writeFloat(mFile,"]\" ",atls,";\n");
 	}
 	void setThresholdLengthSamples(size_t atls_start,size_t atls_end,double* atls)
 	{
-		fprintf(mFile,"\tsetAttr \".atls[%i:%i]\" ", atls_start,atls_end);
+		writeInt(mFile,"\tsetAttr \".atls[",atls_start); writeInt(mFile,":",atls_end,"]\" ");
 		size_t size = (atls_end-atls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",atls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",atls[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startThresholdLengthSamples(size_t atls_start,size_t atls_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".atls[%i:%i]\"",atls_start,atls_end);
+		writeInt(mFile,"\tsetAttr \".atls[",atls_start); writeInt(mFile,":",atls_end,"]\"");
 	}
 	void appendThresholdLengthSamples(double atls)const
 	{
-		fprintf(mFile," %f",atls);
+		writeFloat(mFile," ",atls);
 	}
 	void endThresholdLengthSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setThresholdLengthMap(const string& atlm)
 	{
 		if(atlm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".atlm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".atlm\" -type \"string\" ");
 		atlm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setThresholdLengthMapOffset(double atlmo)
 	{
 		if(atlmo == 0) return;
-		fprintf(mFile,"\tsetAttr \".atlmo\" %f;\n", atlmo);
+		writeFloat(mFile,"\tsetAttr \".atlmo\" ",atlmo,";\n");
 	}
 	void setThresholdLengthMapMult(double atlmm)
 	{
 		if(atlmm == 1) return;
-		fprintf(mFile,"\tsetAttr \".atlmm\" %f;\n", atlmm);
+		writeFloat(mFile,"\tsetAttr \".atlmm\" ",atlmm,";\n");
 	}
 	void setThresholdLengthNoise(double atln)
 	{
 		if(atln == 0) return;
-		fprintf(mFile,"\tsetAttr \".atln\" %f;\n", atln);
+		writeFloat(mFile,"\tsetAttr \".atln\" ",atln,";\n");
 	}
 	void setThresholdLengthNoiseFreq(float atlnf)
 	{
 		if(atlnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".atlnf\" %f;\n", atlnf);
+		writeFloat(mFile,"\tsetAttr \".atlnf\" ",atlnf,";\n");
 	}
 	void setThresholdLengthSamplesDirty(int atlsd)
 	{
 		if(atlsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".atlsd\" %i;\n", atlsd);
+		writeInt(mFile,"\tsetAttr \".atlsd\" ",atlsd,";\n");
 	}
 	void setThresholdLengthMapDirty(int atlmd)
 	{
 		if(atlmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".atlmd\" %i;\n", atlmd);
+		writeInt(mFile,"\tsetAttr \".atlmd\" ",atlmd,";\n");
 	}
 	void setUnused(float dun)
 	{
 		if(dun == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dun\" %f;\n", dun);
+		writeFloat(mFile,"\tsetAttr \".dun\" ",dun,";\n");
 	}
 	void setUnusedSamples(size_t uns_i,double uns)
 	{
 		if(uns == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uns[%i]\" %f;\n", uns_i,uns);
+		writeInt(mFile,"\tsetAttr \".uns[",uns_i); writeFloat(mFile,"]\" ",uns,";\n");
 	}
 	void setUnusedSamples(size_t uns_start,size_t uns_end,double* uns)
 	{
-		fprintf(mFile,"\tsetAttr \".uns[%i:%i]\" ", uns_start,uns_end);
+		writeInt(mFile,"\tsetAttr \".uns[",uns_start); writeInt(mFile,":",uns_end,"]\" ");
 		size_t size = (uns_end-uns_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uns[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",uns[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startUnusedSamples(size_t uns_start,size_t uns_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".uns[%i:%i]\"",uns_start,uns_end);
+		writeInt(mFile,"\tsetAttr \".uns[",uns_start); writeInt(mFile,":",uns_end,"]\"");
 	}
 	void appendUnusedSamples(double uns)const
 	{
-		fprintf(mFile," %f",uns);
+		writeFloat(mFile," ",uns);
 	}
 	void endUnusedSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUnusedMap(const string& unm)
 	{
 		if(unm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".unm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".unm\" -type \"string\" ");
 		unm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUnusedMapOffset(float unmo)
 	{
 		if(unmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".unmo\" %f;\n", unmo);
+		writeFloat(mFile,"\tsetAttr \".unmo\" ",unmo,";\n");
 	}
 	void setUnusedMapMult(float unmm)
 	{
 		if(unmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".unmm\" %f;\n", unmm);
+		writeFloat(mFile,"\tsetAttr \".unmm\" ",unmm,";\n");
 	}
 	void setUnusedNoise(float unn)
 	{
 		if(unn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".unn\" %f;\n", unn);
+		writeFloat(mFile,"\tsetAttr \".unn\" ",unn,";\n");
 	}
 	void setUnusedNoiseFreq(float unnf)
 	{
 		if(unnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".unnf\" %f;\n", unnf);
+		writeFloat(mFile,"\tsetAttr \".unnf\" ",unnf,";\n");
 	}
 	void setUnusedSamplesDirty(int unsd)
 	{
 		if(unsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".unsd\" %i;\n", unsd);
+		writeInt(mFile,"\tsetAttr \".unsd\" ",unsd,";\n");
 	}
 	void setUnusedMapDirty(int unmd)
 	{
 		if(unmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".unmd\" %i;\n", unmd);
+		writeInt(mFile,"\tsetAttr \".unmd\" ",unmd,";\n");
 	}
 	void setEqualizer(float dem)
 	{
 		if(dem == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dem\" %f;\n", dem);
+		writeFloat(mFile,"\tsetAttr \".dem\" ",dem,";\n");
 	}
 	void setEqualizerSamples(size_t ems_i,double ems)
 	{
 		if(ems == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ems[%i]\" %f;\n", ems_i,ems);
+		writeInt(mFile,"\tsetAttr \".ems[",ems_i); writeFloat(mFile,"]\" ",ems,";\n");
 	}
 	void setEqualizerSamples(size_t ems_start,size_t ems_end,double* ems)
 	{
-		fprintf(mFile,"\tsetAttr \".ems[%i:%i]\" ", ems_start,ems_end);
+		writeInt(mFile,"\tsetAttr \".ems[",ems_start); writeInt(mFile,":",ems_end,"]\" ");
 		size_t size = (ems_end-ems_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ems[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ems[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEqualizerSamples(size_t ems_start,size_t ems_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ems[%i:%i]\"",ems_start,ems_end);
+		writeInt(mFile,"\tsetAttr \".ems[",ems_start); writeInt(mFile,":",ems_end,"]\"");
 	}
 	void appendEqualizerSamples(double ems)const
 	{
-		fprintf(mFile," %f",ems);
+		writeFloat(mFile," ",ems);
 	}
 	void endEqualizerSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEqualizerMap(const string& emm)
 	{
 		if(emm == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".emm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".emm\" -type \"string\" ");
 		emm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEqualizerMapOffset(float emmo)
 	{
 		if(emmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".emmo\" %f;\n", emmo);
+		writeFloat(mFile,"\tsetAttr \".emmo\" ",emmo,";\n");
 	}
 	void setEqualizerMapMult(float emmm)
 	{
 		if(emmm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".emmm\" %f;\n", emmm);
+		writeFloat(mFile,"\tsetAttr \".emmm\" ",emmm,";\n");
 	}
 	void setEqualizerNoise(float emn)
 	{
 		if(emn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".emn\" %f;\n", emn);
+		writeFloat(mFile,"\tsetAttr \".emn\" ",emn,";\n");
 	}
 	void setEqualizerNoiseFreq(float emnf)
 	{
 		if(emnf == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".emnf\" %f;\n", emnf);
+		writeFloat(mFile,"\tsetAttr \".emnf\" ",emnf,";\n");
 	}
 	void setEqualizerSamplesDirty(int emsd)
 	{
 		if(emsd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".emsd\" %i;\n", emsd);
+		writeInt(mFile,"\tsetAttr \".emsd\" ",emsd,";\n");
 	}
 	void setEqualizerMapDirty(int emmd)
 	{
 		if(emmd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".emmd\" %i;\n", emmd);
+		writeInt(mFile,"\tsetAttr \".emmd\" ",emmd,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiOverrideCaustics(bool oca)
 	{
 		if(oca == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oca\" %i;\n", oca);
+		writeInt(mFile,"\tsetAttr \".mrc.oca\" ",oca,";\n");
 	}
 	void setMiCausticAccuracy(short caa)
 	{
 		if(caa == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.caa\" %i;\n", caa);
+		writeInt(mFile,"\tsetAttr \".mrc.caa\" ",caa,";\n");
 	}
 	void setMiCausticRadius(float car)
 	{
 		if(car == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.car\" %f;\n", car);
+		writeFloat(mFile,"\tsetAttr \".mrc.car\" ",car,";\n");
 	}
 	void setMiOverrideGlobalIllumination(bool ogi)
 	{
 		if(ogi == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ogi\" %i;\n", ogi);
+		writeInt(mFile,"\tsetAttr \".mrc.ogi\" ",ogi,";\n");
 	}
 	void setMiGlobillumAccuracy(short gia)
 	{
 		if(gia == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gia\" %i;\n", gia);
+		writeInt(mFile,"\tsetAttr \".mrc.gia\" ",gia,";\n");
 	}
 	void setMiGlobillumRadius(float gir)
 	{
 		if(gir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gir\" %f;\n", gir);
+		writeFloat(mFile,"\tsetAttr \".mrc.gir\" ",gir,";\n");
 	}
 	void setMiOverrideFinalGather(bool ofg)
 	{
 		if(ofg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ofg\" %i;\n", ofg);
+		writeInt(mFile,"\tsetAttr \".mrc.ofg\" ",ofg,";\n");
 	}
 	void setMiFinalGatherRays(int fry)
 	{
 		if(fry == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fry\" %i;\n", fry);
+		writeInt(mFile,"\tsetAttr \".mrc.fry\" ",fry,";\n");
 	}
 	void setMiFinalGatherMinRadius(float fmn)
 	{
 		if(fmn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmn\" %f;\n", fmn);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmn\" ",fmn,";\n");
 	}
 	void setMiFinalGatherMaxRadius(float fmx)
 	{
 		if(fmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmx\" %f;\n", fmx);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmx\" ",fmx,";\n");
 	}
 	void setMiFinalGatherFilter(short ffi)
 	{
 		if(ffi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ffi\" %i;\n", ffi);
+		writeInt(mFile,"\tsetAttr \".mrc.ffi\" ",ffi,";\n");
 	}
 	void setMiFinalGatherView(bool fgv)
 	{
 		if(fgv == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgv\" %i;\n", fgv);
+		writeInt(mFile,"\tsetAttr \".mrc.fgv\" ",fgv,";\n");
 	}
 	void setMiOverrideSamples(bool oos)
 	{
 		if(oos == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oos\" %i;\n", oos);
+		writeInt(mFile,"\tsetAttr \".mrc.oos\" ",oos,";\n");
 	}
 	void setMiMinSamples(short mins)
 	{
 		if(mins == -2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mins\" %i;\n", mins);
+		writeInt(mFile,"\tsetAttr \".mrc.mins\" ",mins,";\n");
 	}
 	void setMiMaxSamples(short maxs)
 	{
 		if(maxs == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.maxs\" %i;\n", maxs);
+		writeInt(mFile,"\tsetAttr \".mrc.maxs\" ",maxs,";\n");
 	}
 	void setMiFinalGatherCast(bool fgc)
 	{
 		if(fgc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgc\" %i;\n", fgc);
+		writeInt(mFile,"\tsetAttr \".mrc.fgc\" ",fgc,";\n");
 	}
 	void setMiFinalGatherReceive(bool fge)
 	{
 		if(fge == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fge\" %i;\n", fge);
+		writeInt(mFile,"\tsetAttr \".mrc.fge\" ",fge,";\n");
 	}
 	void setMiTransparencyCast(bool tpc)
 	{
 		if(tpc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpc\" %i;\n", tpc);
+		writeInt(mFile,"\tsetAttr \".mrc.tpc\" ",tpc,";\n");
 	}
 	void setMiTransparencyReceive(bool tpr)
 	{
 		if(tpr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpr\" %i;\n", tpr);
+		writeInt(mFile,"\tsetAttr \".mrc.tpr\" ",tpr,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInputMesh()const
 	{
-		fprintf(mFile,"\"%s.imsh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imsh\"");
 	}
 	void getRealUSamples()const
 	{
-		fprintf(mFile,"\"%s.rus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rus\"");
 	}
 	void getRealVSamples()const
 	{
-		fprintf(mFile,"\"%s.rvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rvs\"");
 	}
 	void getUSamples()const
 	{
-		fprintf(mFile,"\"%s.us\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".us\"");
 	}
 	void getVSamples()const
 	{
-		fprintf(mFile,"\"%s.vs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vs\"");
 	}
 	void getFlipNormals()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getHairs()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getFurAccuracy()const
 	{
-		fprintf(mFile,"\"%s.ha\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ha\"");
 	}
 	void getFurGlobalScale()const
 	{
-		fprintf(mFile,"\"%s.fgs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fgs\"");
 	}
 	void getAttractorGlobalScale()const
 	{
-		fprintf(mFile,"\"%s.ags\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ags\"");
 	}
 	void getExportAttr()const
 	{
-		fprintf(mFile,"\"%s.ea\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ea\"");
 	}
 	void getExportFile()const
 	{
-		fprintf(mFile,"\"%s.ef\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ef\"");
 	}
 	void getExportWidth()const
 	{
-		fprintf(mFile,"\"%s.ew\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ew\"");
 	}
 	void getExportHeight()const
 	{
-		fprintf(mFile,"\"%s.eh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eh\"");
 	}
 	void getColorFeedbackEnabled()const
 	{
-		fprintf(mFile,"\"%s.cfe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfe\"");
 	}
 	void getAttractors()const
 	{
-		fprintf(mFile,"\"%s.atr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atr\"");
 	}
 	void getAttractorModel()const
 	{
-		fprintf(mFile,"\"%s.amd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amd\"");
 	}
 	void getAttractorsPerHair()const
 	{
-		fprintf(mFile,"\"%s.aph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aph\"");
 	}
 	void getDrawAttractors()const
 	{
-		fprintf(mFile,"\"%s.drat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drat\"");
 	}
 	void getLength()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getLengthSamples(size_t ls_i)const
 	{
-		fprintf(mFile,"\"%s.ls[%i]\"",mName.c_str(),ls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ls[",ls_i,"]\"");
 	}
 	void getLengthSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls\"");
 	}
 	void getLengthMap()const
 	{
-		fprintf(mFile,"\"%s.lm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lm\"");
 	}
 	void getLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.lmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmo\"");
 	}
 	void getLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.lmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmm\"");
 	}
 	void getLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.ln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ln\"");
 	}
 	void getLengthNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.lnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lnf\"");
 	}
 	void getLengthSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.lsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsd\"");
 	}
 	void getLengthMapDirty()const
 	{
-		fprintf(mFile,"\"%s.lmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmd\"");
 	}
 	void getInclination()const
 	{
-		fprintf(mFile,"\"%s.din\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".din\"");
 	}
 	void getInclinationSamples(size_t ins_i)const
 	{
-		fprintf(mFile,"\"%s.ins[%i]\"",mName.c_str(),ins_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ins[",ins_i,"]\"");
 	}
 	void getInclinationSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ins\"");
 	}
 	void getInclinationMap()const
 	{
-		fprintf(mFile,"\"%s.inm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inm\"");
 	}
 	void getInclinationMapOffset()const
 	{
-		fprintf(mFile,"\"%s.inmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inmo\"");
 	}
 	void getInclinationMapMult()const
 	{
-		fprintf(mFile,"\"%s.inmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inmm\"");
 	}
 	void getInclinationNoise()const
 	{
-		fprintf(mFile,"\"%s.inn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inn\"");
 	}
 	void getInclinationNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.innf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".innf\"");
 	}
 	void getInclinationSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.insd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".insd\"");
 	}
 	void getInclinationMapDirty()const
 	{
-		fprintf(mFile,"\"%s.inmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inmd\"");
 	}
 	void getRoll()const
 	{
-		fprintf(mFile,"\"%s.drl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drl\"");
 	}
 	void getRollSamples(size_t rls_i)const
 	{
-		fprintf(mFile,"\"%s.rls[%i]\"",mName.c_str(),rls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rls[",rls_i,"]\"");
 	}
 	void getRollSamples()const
 	{
 
-		fprintf(mFile,"\"%s.rls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rls\"");
 	}
 	void getRollMap()const
 	{
-		fprintf(mFile,"\"%s.rlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlm\"");
 	}
 	void getRollMapOffset()const
 	{
-		fprintf(mFile,"\"%s.rlmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlmo\"");
 	}
 	void getRollMapMult()const
 	{
-		fprintf(mFile,"\"%s.rlmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlmm\"");
 	}
 	void getRollNoise()const
 	{
-		fprintf(mFile,"\"%s.rln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rln\"");
 	}
 	void getRollNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.rlnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlnf\"");
 	}
 	void getRollSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.rlsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlsd\"");
 	}
 	void getRollMapDirty()const
 	{
-		fprintf(mFile,"\"%s.rlmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlmd\"");
 	}
 	void getPolar()const
 	{
-		fprintf(mFile,"\"%s.dpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpo\"");
 	}
 	void getPolarSamples(size_t pos_i)const
 	{
-		fprintf(mFile,"\"%s.pos[%i]\"",mName.c_str(),pos_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pos[",pos_i,"]\"");
 	}
 	void getPolarSamples()const
 	{
 
-		fprintf(mFile,"\"%s.pos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos\"");
 	}
 	void getPolarMap()const
 	{
-		fprintf(mFile,"\"%s.pom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pom\"");
 	}
 	void getPolarMapOffset()const
 	{
-		fprintf(mFile,"\"%s.pomo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pomo\"");
 	}
 	void getPolarMapMult()const
 	{
-		fprintf(mFile,"\"%s.pomm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pomm\"");
 	}
 	void getPolarNoise()const
 	{
-		fprintf(mFile,"\"%s.pon\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pon\"");
 	}
 	void getPolarNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.ponf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ponf\"");
 	}
 	void getPolarSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.posd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".posd\"");
 	}
 	void getPolarMapDirty()const
 	{
-		fprintf(mFile,"\"%s.pomd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pomd\"");
 	}
 	void getBaldness()const
 	{
-		fprintf(mFile,"\"%s.db\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".db\"");
 	}
 	void getBaldnessSamples(size_t bs_i)const
 	{
-		fprintf(mFile,"\"%s.bs[%i]\"",mName.c_str(),bs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".bs[",bs_i,"]\"");
 	}
 	void getBaldnessSamples()const
 	{
 
-		fprintf(mFile,"\"%s.bs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bs\"");
 	}
 	void getBaldnessMap()const
 	{
-		fprintf(mFile,"\"%s.bm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bm\"");
 	}
 	void getBaldnessMapOffset()const
 	{
-		fprintf(mFile,"\"%s.bmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmo\"");
 	}
 	void getBaldnessMapMult()const
 	{
-		fprintf(mFile,"\"%s.bmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmm\"");
 	}
 	void getBaldnessNoise()const
 	{
-		fprintf(mFile,"\"%s.bn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bn\"");
 	}
 	void getBaldnessNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.bnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bnf\"");
 	}
 	void getBaldnessSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.bsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bsd\"");
 	}
 	void getBaldnessMapDirty()const
 	{
-		fprintf(mFile,"\"%s.bmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmd\"");
 	}
 	void getBaseOpacity()const
 	{
-		fprintf(mFile,"\"%s.dbo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbo\"");
 	}
 	void getBaseOpacitySamples(size_t bos_i)const
 	{
-		fprintf(mFile,"\"%s.bos[%i]\"",mName.c_str(),bos_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".bos[",bos_i,"]\"");
 	}
 	void getBaseOpacitySamples()const
 	{
 
-		fprintf(mFile,"\"%s.bos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bos\"");
 	}
 	void getBaseOpacityMap()const
 	{
-		fprintf(mFile,"\"%s.bom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bom\"");
 	}
 	void getBaseOpacityMapOffset()const
 	{
-		fprintf(mFile,"\"%s.bomo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bomo\"");
 	}
 	void getBaseOpacityMapMult()const
 	{
-		fprintf(mFile,"\"%s.bomm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bomm\"");
 	}
 	void getBaseOpacityNoise()const
 	{
-		fprintf(mFile,"\"%s.bon\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bon\"");
 	}
 	void getBaseOpacityNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.bonf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bonf\"");
 	}
 	void getBaseOpacitySamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.bosd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bosd\"");
 	}
 	void getBaseOpacityMapDirty()const
 	{
-		fprintf(mFile,"\"%s.bomd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bomd\"");
 	}
 	void getTipOpacity()const
 	{
-		fprintf(mFile,"\"%s.dto\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dto\"");
 	}
 	void getTipOpacitySamples(size_t tos_i)const
 	{
-		fprintf(mFile,"\"%s.tos[%i]\"",mName.c_str(),tos_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tos[",tos_i,"]\"");
 	}
 	void getTipOpacitySamples()const
 	{
 
-		fprintf(mFile,"\"%s.tos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tos\"");
 	}
 	void getTipOpacityMap()const
 	{
-		fprintf(mFile,"\"%s.tom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tom\"");
 	}
 	void getTipOpacityMapOffset()const
 	{
-		fprintf(mFile,"\"%s.tomo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tomo\"");
 	}
 	void getTipOpacityMapMult()const
 	{
-		fprintf(mFile,"\"%s.tomm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tomm\"");
 	}
 	void getTipOpacityNoise()const
 	{
-		fprintf(mFile,"\"%s.ton\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ton\"");
 	}
 	void getTipOpacityNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.tonf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tonf\"");
 	}
 	void getTipOpacitySamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.tosd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tosd\"");
 	}
 	void getTipOpacityMapDirty()const
 	{
-		fprintf(mFile,"\"%s.tomd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tomd\"");
 	}
 	void getBaseCurl()const
 	{
-		fprintf(mFile,"\"%s.dbcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbcl\"");
 	}
 	void getBaseCurlSamples(size_t bcls_i)const
 	{
-		fprintf(mFile,"\"%s.bcls[%i]\"",mName.c_str(),bcls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".bcls[",bcls_i,"]\"");
 	}
 	void getBaseCurlSamples()const
 	{
 
-		fprintf(mFile,"\"%s.bcls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcls\"");
 	}
 	void getBaseCurlMap()const
 	{
-		fprintf(mFile,"\"%s.bclm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclm\"");
 	}
 	void getBaseCurlMapOffset()const
 	{
-		fprintf(mFile,"\"%s.bclmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclmo\"");
 	}
 	void getBaseCurlMapMult()const
 	{
-		fprintf(mFile,"\"%s.bclmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclmm\"");
 	}
 	void getBaseCurlNoise()const
 	{
-		fprintf(mFile,"\"%s.bcln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcln\"");
 	}
 	void getBaseCurlNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.bclnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclnf\"");
 	}
 	void getBaseCurlSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.bclsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclsd\"");
 	}
 	void getBaseCurlMapDirty()const
 	{
-		fprintf(mFile,"\"%s.bclmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bclmd\"");
 	}
 	void getTipCurl()const
 	{
-		fprintf(mFile,"\"%s.dtcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtcl\"");
 	}
 	void getTipCurlSamples(size_t tcls_i)const
 	{
-		fprintf(mFile,"\"%s.tcls[%i]\"",mName.c_str(),tcls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tcls[",tcls_i,"]\"");
 	}
 	void getTipCurlSamples()const
 	{
 
-		fprintf(mFile,"\"%s.tcls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcls\"");
 	}
 	void getTipCurlMap()const
 	{
-		fprintf(mFile,"\"%s.tclm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclm\"");
 	}
 	void getTipCurlMapOffset()const
 	{
-		fprintf(mFile,"\"%s.tclmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclmo\"");
 	}
 	void getTipCurlMapMult()const
 	{
-		fprintf(mFile,"\"%s.tclmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclmm\"");
 	}
 	void getTipCurlNoise()const
 	{
-		fprintf(mFile,"\"%s.tcln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcln\"");
 	}
 	void getTipCurlNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.tclnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclnf\"");
 	}
 	void getTipCurlSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.tclsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclsd\"");
 	}
 	void getTipCurlMapDirty()const
 	{
-		fprintf(mFile,"\"%s.tclmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tclmd\"");
 	}
 	void getBaseWidth()const
 	{
-		fprintf(mFile,"\"%s.dbw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbw\"");
 	}
 	void getBaseWidthSamples(size_t bws_i)const
 	{
-		fprintf(mFile,"\"%s.bws[%i]\"",mName.c_str(),bws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".bws[",bws_i,"]\"");
 	}
 	void getBaseWidthSamples()const
 	{
 
-		fprintf(mFile,"\"%s.bws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bws\"");
 	}
 	void getBaseWidthMap()const
 	{
-		fprintf(mFile,"\"%s.bwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwm\"");
 	}
 	void getBaseWidthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.bwmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwmo\"");
 	}
 	void getBaseWidthMapMult()const
 	{
-		fprintf(mFile,"\"%s.bwmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwmm\"");
 	}
 	void getBaseWidthNoise()const
 	{
-		fprintf(mFile,"\"%s.bwn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwn\"");
 	}
 	void getBaseWidthNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.bwnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwnf\"");
 	}
 	void getBaseWidthSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.bwsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwsd\"");
 	}
 	void getBaseWidthMapDirty()const
 	{
-		fprintf(mFile,"\"%s.bwmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwmd\"");
 	}
 	void getTipWidth()const
 	{
-		fprintf(mFile,"\"%s.dtw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtw\"");
 	}
 	void getTipWidthSamples(size_t tws_i)const
 	{
-		fprintf(mFile,"\"%s.tws[%i]\"",mName.c_str(),tws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tws[",tws_i,"]\"");
 	}
 	void getTipWidthSamples()const
 	{
 
-		fprintf(mFile,"\"%s.tws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tws\"");
 	}
 	void getTipWidthMap()const
 	{
-		fprintf(mFile,"\"%s.twm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twm\"");
 	}
 	void getTipWidthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.twmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twmo\"");
 	}
 	void getTipWidthMapMult()const
 	{
-		fprintf(mFile,"\"%s.twmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twmm\"");
 	}
 	void getTipWidthNoise()const
 	{
-		fprintf(mFile,"\"%s.twn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twn\"");
 	}
 	void getTipWidthNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.twnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twnf\"");
 	}
 	void getTipWidthSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.twsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twsd\"");
 	}
 	void getTipWidthMapDirty()const
 	{
-		fprintf(mFile,"\"%s.twmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twmd\"");
 	}
 	void getScraggle()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 	void getScraggleSamples(size_t ss_i)const
 	{
-		fprintf(mFile,"\"%s.ss[%i]\"",mName.c_str(),ss_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ss[",ss_i,"]\"");
 	}
 	void getScraggleSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getScraggleMap()const
 	{
-		fprintf(mFile,"\"%s.sm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sm\"");
 	}
 	void getScraggleMapOffset()const
 	{
-		fprintf(mFile,"\"%s.smo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smo\"");
 	}
 	void getScraggleMapMult()const
 	{
-		fprintf(mFile,"\"%s.smm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smm\"");
 	}
 	void getScraggleNoise()const
 	{
-		fprintf(mFile,"\"%s.sn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sn\"");
 	}
 	void getScraggleNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.snf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".snf\"");
 	}
 	void getScraggleSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.ssd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssd\"");
 	}
 	void getScraggleMapDirty()const
 	{
-		fprintf(mFile,"\"%s.smd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smd\"");
 	}
 	void getScraggleCorrelation()const
 	{
-		fprintf(mFile,"\"%s.dsco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsco\"");
 	}
 	void getScraggleCorrelationSamples(size_t scos_i)const
 	{
-		fprintf(mFile,"\"%s.scos[%i]\"",mName.c_str(),scos_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".scos[",scos_i,"]\"");
 	}
 	void getScraggleCorrelationSamples()const
 	{
 
-		fprintf(mFile,"\"%s.scos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scos\"");
 	}
 	void getScraggleCorrelationMap()const
 	{
-		fprintf(mFile,"\"%s.scom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scom\"");
 	}
 	void getScraggleCorrelationMapOffset()const
 	{
-		fprintf(mFile,"\"%s.scomo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scomo\"");
 	}
 	void getScraggleCorrelationMapMult()const
 	{
-		fprintf(mFile,"\"%s.scomm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scomm\"");
 	}
 	void getScraggleCorrelationNoise()const
 	{
-		fprintf(mFile,"\"%s.scon\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scon\"");
 	}
 	void getScraggleCorrelationNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.sconf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sconf\"");
 	}
 	void getScraggleCorrelationSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.scosd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scosd\"");
 	}
 	void getScraggleCorrelationMapDirty()const
 	{
-		fprintf(mFile,"\"%s.scomd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scomd\"");
 	}
 	void getScraggleFrequency()const
 	{
-		fprintf(mFile,"\"%s.dscf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dscf\"");
 	}
 	void getScraggleFrequencySamples(size_t scfs_i)const
 	{
-		fprintf(mFile,"\"%s.scfs[%i]\"",mName.c_str(),scfs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".scfs[",scfs_i,"]\"");
 	}
 	void getScraggleFrequencySamples()const
 	{
 
-		fprintf(mFile,"\"%s.scfs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfs\"");
 	}
 	void getScraggleFrequencyMap()const
 	{
-		fprintf(mFile,"\"%s.scfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfm\"");
 	}
 	void getScraggleFrequencyMapOffset()const
 	{
-		fprintf(mFile,"\"%s.scfmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfmo\"");
 	}
 	void getScraggleFrequencyMapMult()const
 	{
-		fprintf(mFile,"\"%s.scfmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfmm\"");
 	}
 	void getScraggleFrequencyNoise()const
 	{
-		fprintf(mFile,"\"%s.scfn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfn\"");
 	}
 	void getScraggleFrequencyNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.scfnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfnf\"");
 	}
 	void getScraggleFrequencySamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.scfsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfsd\"");
 	}
 	void getScraggleFrequencyMapDirty()const
 	{
-		fprintf(mFile,"\"%s.scfmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfmd\"");
 	}
 	void getSegments()const
 	{
-		fprintf(mFile,"\"%s.dseg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dseg\"");
 	}
 	void getSegmentsSamples(size_t segs_i)const
 	{
-		fprintf(mFile,"\"%s.segs[%i]\"",mName.c_str(),segs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".segs[",segs_i,"]\"");
 	}
 	void getSegmentsSamples()const
 	{
 
-		fprintf(mFile,"\"%s.segs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".segs\"");
 	}
 	void getSegmentsMap()const
 	{
-		fprintf(mFile,"\"%s.segm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".segm\"");
 	}
 	void getSegmentsMapOffset()const
 	{
-		fprintf(mFile,"\"%s.segmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".segmo\"");
 	}
 	void getSegmentsMapMult()const
 	{
-		fprintf(mFile,"\"%s.segmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".segmm\"");
 	}
 	void getSegmentsNoise()const
 	{
-		fprintf(mFile,"\"%s.segn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".segn\"");
 	}
 	void getSegmentsNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.segnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".segnf\"");
 	}
 	void getSegmentsSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.segsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".segsd\"");
 	}
 	void getSegmentsMapDirty()const
 	{
-		fprintf(mFile,"\"%s.segmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".segmd\"");
 	}
 	void getAttraction()const
 	{
-		fprintf(mFile,"\"%s.dat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dat\"");
 	}
 	void getAttractionSamples(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i]\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"]\"");
 	}
 	void getAttractionSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ats\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats\"");
 	}
 	void getAttractionMap()const
 	{
-		fprintf(mFile,"\"%s.atm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atm\"");
 	}
 	void getAttractionMapOffset()const
 	{
-		fprintf(mFile,"\"%s.atmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atmo\"");
 	}
 	void getAttractionMapMult()const
 	{
-		fprintf(mFile,"\"%s.atmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atmm\"");
 	}
 	void getAttractionNoise()const
 	{
-		fprintf(mFile,"\"%s.atn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atn\"");
 	}
 	void getAttractionNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.atnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atnf\"");
 	}
 	void getAttractionSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.atsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atsd\"");
 	}
 	void getAttractionMapDirty()const
 	{
-		fprintf(mFile,"\"%s.atmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atmd\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.dofs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dofs\"");
 	}
 	void getOffsetSamples(size_t ofss_i)const
 	{
-		fprintf(mFile,"\"%s.ofss[%i]\"",mName.c_str(),ofss_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ofss[",ofss_i,"]\"");
 	}
 	void getOffsetSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ofss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofss\"");
 	}
 	void getOffsetMap()const
 	{
-		fprintf(mFile,"\"%s.ofsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsm\"");
 	}
 	void getOffsetMapOffset()const
 	{
-		fprintf(mFile,"\"%s.ofsmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsmo\"");
 	}
 	void getOffsetMapMult()const
 	{
-		fprintf(mFile,"\"%s.ofsmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsmm\"");
 	}
 	void getOffsetNoise()const
 	{
-		fprintf(mFile,"\"%s.ofsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsn\"");
 	}
 	void getOffsetNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.ofsnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsnf\"");
 	}
 	void getOffsetSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.ofssd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofssd\"");
 	}
 	void getOffsetMapDirty()const
 	{
-		fprintf(mFile,"\"%s.ofsmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofsmd\"");
 	}
 	void getClumping()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getClumpingSamples(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i]\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"]\"");
 	}
 	void getClumpingSamples()const
 	{
 
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getClumpingMap()const
 	{
-		fprintf(mFile,"\"%s.cm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cm\"");
 	}
 	void getClumpingMapOffset()const
 	{
-		fprintf(mFile,"\"%s.cmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmo\"");
 	}
 	void getClumpingMapMult()const
 	{
-		fprintf(mFile,"\"%s.cmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmm\"");
 	}
 	void getClumpingNoise()const
 	{
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getClumpingNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.cnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnf\"");
 	}
 	void getClumpingSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.csd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csd\"");
 	}
 	void getClumpingMapDirty()const
 	{
-		fprintf(mFile,"\"%s.cmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmd\"");
 	}
 	void getClumpingFrequency()const
 	{
-		fprintf(mFile,"\"%s.dcf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcf\"");
 	}
 	void getClumpingFrequencySamples(size_t cfs_i)const
 	{
-		fprintf(mFile,"\"%s.cfs[%i]\"",mName.c_str(),cfs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cfs[",cfs_i,"]\"");
 	}
 	void getClumpingFrequencySamples()const
 	{
 
-		fprintf(mFile,"\"%s.cfs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfs\"");
 	}
 	void getClumpingFrequencyMap()const
 	{
-		fprintf(mFile,"\"%s.cfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfm\"");
 	}
 	void getClumpingFrequencyMapOffset()const
 	{
-		fprintf(mFile,"\"%s.cfmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfmo\"");
 	}
 	void getClumpingFrequencyMapMult()const
 	{
-		fprintf(mFile,"\"%s.cfmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfmm\"");
 	}
 	void getClumpingFrequencyNoise()const
 	{
-		fprintf(mFile,"\"%s.cfn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfn\"");
 	}
 	void getClumpingFrequencyNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.cfnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfnf\"");
 	}
 	void getClumpingFrequencySamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.cfsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfsd\"");
 	}
 	void getClumpingFrequencyMapDirty()const
 	{
-		fprintf(mFile,"\"%s.cfmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfmd\"");
 	}
 	void getClumpingShape()const
 	{
-		fprintf(mFile,"\"%s.dcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcs\"");
 	}
 	void getClumpingShapeSamples(size_t css_i)const
 	{
-		fprintf(mFile,"\"%s.css[%i]\"",mName.c_str(),css_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".css[",css_i,"]\"");
 	}
 	void getClumpingShapeSamples()const
 	{
 
-		fprintf(mFile,"\"%s.css\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".css\"");
 	}
 	void getClumpingShapeMap()const
 	{
-		fprintf(mFile,"\"%s.csm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csm\"");
 	}
 	void getClumpingShapeMapOffset()const
 	{
-		fprintf(mFile,"\"%s.csmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csmo\"");
 	}
 	void getClumpingShapeMapMult()const
 	{
-		fprintf(mFile,"\"%s.csmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csmm\"");
 	}
 	void getClumpingShapeNoise()const
 	{
-		fprintf(mFile,"\"%s.csn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csn\"");
 	}
 	void getClumpingShapeNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.csnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csnf\"");
 	}
 	void getClumpingShapeSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.cssd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cssd\"");
 	}
 	void getClumpingShapeMapDirty()const
 	{
-		fprintf(mFile,"\"%s.csmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csmd\"");
 	}
 	void getBaseColor()const
 	{
-		fprintf(mFile,"\"%s.dbc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbc\"");
 	}
 	void getBaseColorR()const
 	{
-		fprintf(mFile,"\"%s.dbcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbcr\"");
 	}
 	void getBaseColorG()const
 	{
-		fprintf(mFile,"\"%s.dbcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbcg\"");
 	}
 	void getBaseColorB()const
 	{
-		fprintf(mFile,"\"%s.dbcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbcb\"");
 	}
 	void getBaseColorSamples(size_t bcs_i)const
 	{
-		fprintf(mFile,"\"%s.bcs[%i]\"",mName.c_str(),bcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".bcs[",bcs_i,"]\"");
 	}
 	void getBaseColorSamples()const
 	{
 
-		fprintf(mFile,"\"%s.bcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcs\"");
 	}
 	void getBaseColorMap()const
 	{
-		fprintf(mFile,"\"%s.bcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcm\"");
 	}
 	void getBaseColorNoise()const
 	{
-		fprintf(mFile,"\"%s.bcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcn\"");
 	}
 	void getBaseColorNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.bcnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcnf\"");
 	}
 	void getBaseColorSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.bcsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcsd\"");
 	}
 	void getBaseColorMapDirty()const
 	{
-		fprintf(mFile,"\"%s.bcmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcmd\"");
 	}
 	void getTipColor()const
 	{
-		fprintf(mFile,"\"%s.dtc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtc\"");
 	}
 	void getTipColorR()const
 	{
-		fprintf(mFile,"\"%s.dtcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtcr\"");
 	}
 	void getTipColorG()const
 	{
-		fprintf(mFile,"\"%s.dtcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtcg\"");
 	}
 	void getTipColorB()const
 	{
-		fprintf(mFile,"\"%s.dtcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtcb\"");
 	}
 	void getTipColorSamples(size_t tcs_i)const
 	{
-		fprintf(mFile,"\"%s.tcs[%i]\"",mName.c_str(),tcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tcs[",tcs_i,"]\"");
 	}
 	void getTipColorSamples()const
 	{
 
-		fprintf(mFile,"\"%s.tcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcs\"");
 	}
 	void getTipColorMap()const
 	{
-		fprintf(mFile,"\"%s.tcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcm\"");
 	}
 	void getTipColorNoise()const
 	{
-		fprintf(mFile,"\"%s.tcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcn\"");
 	}
 	void getTipColorNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.tcnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcnf\"");
 	}
 	void getTipColorSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.tcsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcsd\"");
 	}
 	void getTipColorMapDirty()const
 	{
-		fprintf(mFile,"\"%s.tcmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcmd\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.dar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dar\"");
 	}
 	void getRadiusSamples(size_t ars_i)const
 	{
-		fprintf(mFile,"\"%s.ars[%i]\"",mName.c_str(),ars_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ars[",ars_i,"]\"");
 	}
 	void getRadiusSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ars\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ars\"");
 	}
 	void getRadiusMap()const
 	{
-		fprintf(mFile,"\"%s.arm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".arm\"");
 	}
 	void getRadiusMapOffset()const
 	{
-		fprintf(mFile,"\"%s.armo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".armo\"");
 	}
 	void getRadiusMapMult()const
 	{
-		fprintf(mFile,"\"%s.armm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".armm\"");
 	}
 	void getRadiusNoise()const
 	{
-		fprintf(mFile,"\"%s.arn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".arn\"");
 	}
 	void getRadiusNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.arnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".arnf\"");
 	}
 	void getRadiusSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.arsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".arsd\"");
 	}
 	void getRadiusMapDirty()const
 	{
-		fprintf(mFile,"\"%s.armd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".armd\"");
 	}
 	void getPower()const
 	{
-		fprintf(mFile,"\"%s.dap\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dap\"");
 	}
 	void getPowerSamples(size_t aps_i)const
 	{
-		fprintf(mFile,"\"%s.aps[%i]\"",mName.c_str(),aps_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".aps[",aps_i,"]\"");
 	}
 	void getPowerSamples()const
 	{
 
-		fprintf(mFile,"\"%s.aps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aps\"");
 	}
 	void getPowerMap()const
 	{
-		fprintf(mFile,"\"%s.apm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apm\"");
 	}
 	void getPowerMapOffset()const
 	{
-		fprintf(mFile,"\"%s.apmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apmo\"");
 	}
 	void getPowerMapMult()const
 	{
-		fprintf(mFile,"\"%s.apmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apmm\"");
 	}
 	void getPowerNoise()const
 	{
-		fprintf(mFile,"\"%s.apn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apn\"");
 	}
 	void getPowerNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.apnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apnf\"");
 	}
 	void getPowerSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.apsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apsd\"");
 	}
 	void getPowerMapDirty()const
 	{
-		fprintf(mFile,"\"%s.apmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apmd\"");
 	}
 	void getInfluence()const
 	{
-		fprintf(mFile,"\"%s.dai\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dai\"");
 	}
 	void getInfluenceSamples(size_t ais_i)const
 	{
-		fprintf(mFile,"\"%s.ais[%i]\"",mName.c_str(),ais_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ais[",ais_i,"]\"");
 	}
 	void getInfluenceSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ais\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ais\"");
 	}
 	void getInfluenceMap()const
 	{
-		fprintf(mFile,"\"%s.aim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aim\"");
 	}
 	void getInfluenceMapOffset()const
 	{
-		fprintf(mFile,"\"%s.aimo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aimo\"");
 	}
 	void getInfluenceMapMult()const
 	{
-		fprintf(mFile,"\"%s.aimm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aimm\"");
 	}
 	void getInfluenceNoise()const
 	{
-		fprintf(mFile,"\"%s.ain\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ain\"");
 	}
 	void getInfluenceNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.ainf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ainf\"");
 	}
 	void getInfluenceSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.aisd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aisd\"");
 	}
 	void getInfluenceMapDirty()const
 	{
-		fprintf(mFile,"\"%s.aimd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aimd\"");
 	}
 	void getStartLength()const
 	{
-		fprintf(mFile,"\"%s.dasl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dasl\"");
 	}
 	void getStartLengthSamples(size_t asls_i)const
 	{
-		fprintf(mFile,"\"%s.asls[%i]\"",mName.c_str(),asls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".asls[",asls_i,"]\"");
 	}
 	void getStartLengthSamples()const
 	{
 
-		fprintf(mFile,"\"%s.asls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".asls\"");
 	}
 	void getStartLengthMap()const
 	{
-		fprintf(mFile,"\"%s.aslm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aslm\"");
 	}
 	void getStartLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.aslmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aslmo\"");
 	}
 	void getStartLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.aslmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aslmm\"");
 	}
 	void getStartLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.asln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".asln\"");
 	}
 	void getStartLengthNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.aslnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aslnf\"");
 	}
 	void getStartLengthSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.aslsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aslsd\"");
 	}
 	void getStartLengthMapDirty()const
 	{
-		fprintf(mFile,"\"%s.aslmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aslmd\"");
 	}
 	void getEndLength()const
 	{
-		fprintf(mFile,"\"%s.dael\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dael\"");
 	}
 	void getEndLengthSamples(size_t aels_i)const
 	{
-		fprintf(mFile,"\"%s.aels[%i]\"",mName.c_str(),aels_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".aels[",aels_i,"]\"");
 	}
 	void getEndLengthSamples()const
 	{
 
-		fprintf(mFile,"\"%s.aels\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aels\"");
 	}
 	void getEndLengthMap()const
 	{
-		fprintf(mFile,"\"%s.aelm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aelm\"");
 	}
 	void getEndLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.aelmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aelmo\"");
 	}
 	void getEndLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.aelmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aelmm\"");
 	}
 	void getEndLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.aeln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aeln\"");
 	}
 	void getEndLengthNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.aelnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aelnf\"");
 	}
 	void getEndLengthSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.aelsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aelsd\"");
 	}
 	void getEndLengthMapDirty()const
 	{
-		fprintf(mFile,"\"%s.aelmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aelmd\"");
 	}
 	void getThresholdLength()const
 	{
-		fprintf(mFile,"\"%s.datl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".datl\"");
 	}
 	void getThresholdLengthSamples(size_t atls_i)const
 	{
-		fprintf(mFile,"\"%s.atls[%i]\"",mName.c_str(),atls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".atls[",atls_i,"]\"");
 	}
 	void getThresholdLengthSamples()const
 	{
 
-		fprintf(mFile,"\"%s.atls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atls\"");
 	}
 	void getThresholdLengthMap()const
 	{
-		fprintf(mFile,"\"%s.atlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atlm\"");
 	}
 	void getThresholdLengthMapOffset()const
 	{
-		fprintf(mFile,"\"%s.atlmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atlmo\"");
 	}
 	void getThresholdLengthMapMult()const
 	{
-		fprintf(mFile,"\"%s.atlmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atlmm\"");
 	}
 	void getThresholdLengthNoise()const
 	{
-		fprintf(mFile,"\"%s.atln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atln\"");
 	}
 	void getThresholdLengthNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.atlnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atlnf\"");
 	}
 	void getThresholdLengthSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.atlsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atlsd\"");
 	}
 	void getThresholdLengthMapDirty()const
 	{
-		fprintf(mFile,"\"%s.atlmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atlmd\"");
 	}
 	void getUnused()const
 	{
-		fprintf(mFile,"\"%s.dun\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dun\"");
 	}
 	void getUnusedSamples(size_t uns_i)const
 	{
-		fprintf(mFile,"\"%s.uns[%i]\"",mName.c_str(),uns_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uns[",uns_i,"]\"");
 	}
 	void getUnusedSamples()const
 	{
 
-		fprintf(mFile,"\"%s.uns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uns\"");
 	}
 	void getUnusedMap()const
 	{
-		fprintf(mFile,"\"%s.unm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unm\"");
 	}
 	void getUnusedMapOffset()const
 	{
-		fprintf(mFile,"\"%s.unmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unmo\"");
 	}
 	void getUnusedMapMult()const
 	{
-		fprintf(mFile,"\"%s.unmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unmm\"");
 	}
 	void getUnusedNoise()const
 	{
-		fprintf(mFile,"\"%s.unn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unn\"");
 	}
 	void getUnusedSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.unsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unsd\"");
 	}
 	void getUnusedMapDirty()const
 	{
-		fprintf(mFile,"\"%s.unmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unmd\"");
 	}
 	void getEqualizer()const
 	{
-		fprintf(mFile,"\"%s.dem\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dem\"");
 	}
 	void getEqualizerSamples(size_t ems_i)const
 	{
-		fprintf(mFile,"\"%s.ems[%i]\"",mName.c_str(),ems_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ems[",ems_i,"]\"");
 	}
 	void getEqualizerSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ems\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ems\"");
 	}
 	void getEqualizerMap()const
 	{
-		fprintf(mFile,"\"%s.emm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emm\"");
 	}
 	void getEqualizerMapOffset()const
 	{
-		fprintf(mFile,"\"%s.emmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emmo\"");
 	}
 	void getEqualizerMapMult()const
 	{
-		fprintf(mFile,"\"%s.emmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emmm\"");
 	}
 	void getEqualizerNoise()const
 	{
-		fprintf(mFile,"\"%s.emn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emn\"");
 	}
 	void getEqualizerNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.emnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emnf\"");
 	}
 	void getEqualizerSamplesDirty()const
 	{
-		fprintf(mFile,"\"%s.emsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emsd\"");
 	}
 	void getEqualizerMapDirty()const
 	{
-		fprintf(mFile,"\"%s.emmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emmd\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiOverrideCaustics()const
 	{
-		fprintf(mFile,"\"%s.mrc.oca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oca\"");
 	}
 	void getMiCausticAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.caa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.caa\"");
 	}
 	void getMiCausticRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.car\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.car\"");
 	}
 	void getMiOverrideGlobalIllumination()const
 	{
-		fprintf(mFile,"\"%s.mrc.ogi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ogi\"");
 	}
 	void getMiGlobillumAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.gia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gia\"");
 	}
 	void getMiGlobillumRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.gir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gir\"");
 	}
 	void getMiOverrideFinalGather()const
 	{
-		fprintf(mFile,"\"%s.mrc.ofg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ofg\"");
 	}
 	void getMiFinalGatherRays()const
 	{
-		fprintf(mFile,"\"%s.mrc.fry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fry\"");
 	}
 	void getMiFinalGatherMinRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmn\"");
 	}
 	void getMiFinalGatherMaxRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmx\"");
 	}
 	void getMiFinalGatherFilter()const
 	{
-		fprintf(mFile,"\"%s.mrc.ffi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ffi\"");
 	}
 	void getMiFinalGatherView()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgv\"");
 	}
 	void getMiOverrideSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.oos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oos\"");
 	}
 	void getMiMinSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.mins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mins\"");
 	}
 	void getMiMaxSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.maxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.maxs\"");
 	}
 	void getMiFinalGatherCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgc\"");
 	}
 	void getMiFinalGatherReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.fge\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fge\"");
 	}
 	void getMiTransparencyCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpc\"");
 	}
 	void getMiTransparencyReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpr\"");
 	}
 protected:
 	FurFeedback(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
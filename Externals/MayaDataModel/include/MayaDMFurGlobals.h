@@ -27,231 +27,231 @@ public:
 	void setRenderFur(bool rh)
 	{
 		if(rh == true) return;
-		fprintf(mFile,"\tsetAttr \".rh\" %i;\n", rh);
+		writeInt(mFile,"\tsetAttr \".rh\" ",rh,";\n");
 	}
 	void setAreaValue(unsigned int av)
 	{
 		if(av == 2) return;
-		fprintf(mFile,"\tsetAttr \".av\" %i;\n", av);
+		writeInt(mFile,"\tsetAttr \".av\" ",av,";\n");
 	}
 	void setEqualMap(short em)
 	{
 		if(em == 1) return;
-		fprintf(mFile,"\tsetAttr \".em\" %i;\n", em);
+		writeInt(mFile,"\tsetAttr \".em\" ",em,";\n");
 	}
 	void setShadowFur(bool sh)
 	{
 		if(sh == true) return;
-		fprintf(mFile,"\tsetAttr \".sh\" %i;\n", sh);
+		writeInt(mFile,"\tsetAttr \".sh\" ",sh,";\n");
 	}
 	void setCompFur(bool ch)
 	{
 		if(ch == true) return;
-		fprintf(mFile,"\tsetAttr \".ch\" %i;\n", ch);
+		writeInt(mFile,"\tsetAttr \".ch\" ",ch,";\n");
 	}
 	void setReadFurFiles(bool rff)
 	{
 		if(rff == false) return;
-		fprintf(mFile,"\tsetAttr \".rff\" %i;\n", rff);
+		writeInt(mFile,"\tsetAttr \".rff\" ",rff,";\n");
 	}
 	void setReadFurFilesPath(const string& rfp)
 	{
 		if(rfp == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".rfp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rfp\" -type \"string\" ");
 		rfp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReadEqualMapPath(const string& rep)
 	{
 		if(rep == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".rep\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rep\" -type \"string\" ");
 		rep.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReadShadowMap(bool rsm)
 	{
 		if(rsm == false) return;
-		fprintf(mFile,"\tsetAttr \".rsm\" %i;\n", rsm);
+		writeInt(mFile,"\tsetAttr \".rsm\" ",rsm,";\n");
 	}
 	void setReadShadowMapPath(const string& rsp)
 	{
 		if(rsp == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".rsp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rsp\" -type \"string\" ");
 		rsp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReadFurImage(bool rhi)
 	{
 		if(rhi == false) return;
-		fprintf(mFile,"\tsetAttr \".rhi\" %i;\n", rhi);
+		writeInt(mFile,"\tsetAttr \".rhi\" ",rhi,";\n");
 	}
 	void setReadFurImagePath(const string& rhp)
 	{
 		if(rhp == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".rhp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rhp\" -type \"string\" ");
 		rhp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProjectLocation(const string& pjl)
 	{
 		if(pjl == "n/a") return;
-		fprintf(mFile,"\tsetAttr \".pjl\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".pjl\" -type \"string\" ");
 		pjl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeepIntermediateFiles(bool kif)
 	{
 		if(kif == false) return;
-		fprintf(mFile,"\tsetAttr \".kif\" %i;\n", kif);
+		writeInt(mFile,"\tsetAttr \".kif\" ",kif,";\n");
 	}
 	void setKeepFurImages(bool kfi)
 	{
 		if(kfi == true) return;
-		fprintf(mFile,"\tsetAttr \".kfi\" %i;\n", kfi);
+		writeInt(mFile,"\tsetAttr \".kfi\" ",kfi,";\n");
 	}
 	void setCopyAttrMaps(short cam)
 	{
 		if(cam == 0) return;
-		fprintf(mFile,"\tsetAttr \".cam\" %i;\n", cam);
+		writeInt(mFile,"\tsetAttr \".cam\" ",cam,";\n");
 	}
 	void setFurPixelBufferSize(short fpsz)
 	{
 		if(fpsz == 5) return;
-		fprintf(mFile,"\tsetAttr \".fpsz\" %i;\n", fpsz);
+		writeInt(mFile,"\tsetAttr \".fpsz\" ",fpsz,";\n");
 	}
 	void setShadowPixelBufferSize(short shsz)
 	{
 		if(shsz == 5) return;
-		fprintf(mFile,"\tsetAttr \".shsz\" %i;\n", shsz);
+		writeInt(mFile,"\tsetAttr \".shsz\" ",shsz,";\n");
 	}
 	void setNurbsTesselation(short nts)
 	{
 		if(nts == 4) return;
-		fprintf(mFile,"\tsetAttr \".nts\" %i;\n", nts);
+		writeInt(mFile,"\tsetAttr \".nts\" ",nts,";\n");
 	}
 	void setIncludePidInFilesName(bool ipid)
 	{
 		if(ipid == false) return;
-		fprintf(mFile,"\tsetAttr \".ipid\" %i;\n", ipid);
+		writeInt(mFile,"\tsetAttr \".ipid\" ",ipid,";\n");
 	}
 	void setRenderFurImages(bool rfi)
 	{
 		if(rfi == true) return;
-		fprintf(mFile,"\tsetAttr \".rfi\" %i;\n", rfi);
+		writeInt(mFile,"\tsetAttr \".rfi\" ",rfi,";\n");
 	}
 	void setRenderShadowMaps(bool rnsm)
 	{
 		if(rnsm == true) return;
-		fprintf(mFile,"\tsetAttr \".rnsm\" %i;\n", rnsm);
+		writeInt(mFile,"\tsetAttr \".rnsm\" ",rnsm,";\n");
 	}
 	void setDisableGeometryRendering(bool dgr)
 	{
 		if(dgr == false) return;
-		fprintf(mFile,"\tsetAttr \".dgr\" %i;\n", dgr);
+		writeInt(mFile,"\tsetAttr \".dgr\" ",dgr,";\n");
 	}
 	void getRenderFur()const
 	{
-		fprintf(mFile,"\"%s.rh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rh\"");
 	}
 	void getAreaValue()const
 	{
-		fprintf(mFile,"\"%s.av\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".av\"");
 	}
 	void getEqualMap()const
 	{
-		fprintf(mFile,"\"%s.em\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".em\"");
 	}
 	void getShadowFur()const
 	{
-		fprintf(mFile,"\"%s.sh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh\"");
 	}
 	void getCompFur()const
 	{
-		fprintf(mFile,"\"%s.ch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ch\"");
 	}
 	void getReadFurFiles()const
 	{
-		fprintf(mFile,"\"%s.rff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rff\"");
 	}
 	void getReadFurFilesPath()const
 	{
-		fprintf(mFile,"\"%s.rfp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfp\"");
 	}
 	void getReadEqualMapPath()const
 	{
-		fprintf(mFile,"\"%s.rep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rep\"");
 	}
 	void getReadShadowMap()const
 	{
-		fprintf(mFile,"\"%s.rsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsm\"");
 	}
 	void getReadShadowMapPath()const
 	{
-		fprintf(mFile,"\"%s.rsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsp\"");
 	}
 	void getReadFurImage()const
 	{
-		fprintf(mFile,"\"%s.rhi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rhi\"");
 	}
 	void getReadFurImagePath()const
 	{
-		fprintf(mFile,"\"%s.rhp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rhp\"");
 	}
 	void getProjectLocation()const
 	{
-		fprintf(mFile,"\"%s.pjl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pjl\"");
 	}
 	void getHairDescriptions()const
 	{
-		fprintf(mFile,"\"%s.hdc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hdc\"");
 	}
 	void getAttractorSets()const
 	{
-		fprintf(mFile,"\"%s.asc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".asc\"");
 	}
 	void getFurNodeList()const
 	{
-		fprintf(mFile,"\"%s.fnl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fnl\"");
 	}
 	void getKeepIntermediateFiles()const
 	{
-		fprintf(mFile,"\"%s.kif\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kif\"");
 	}
 	void getKeepFurImages()const
 	{
-		fprintf(mFile,"\"%s.kfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kfi\"");
 	}
 	void getCopyAttrMaps()const
 	{
-		fprintf(mFile,"\"%s.cam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cam\"");
 	}
 	void getFurPixelBufferSize()const
 	{
-		fprintf(mFile,"\"%s.fpsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fpsz\"");
 	}
 	void getShadowPixelBufferSize()const
 	{
-		fprintf(mFile,"\"%s.shsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shsz\"");
 	}
 	void getNurbsTesselation()const
 	{
-		fprintf(mFile,"\"%s.nts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nts\"");
 	}
 	void getIncludePidInFilesName()const
 	{
-		fprintf(mFile,"\"%s.ipid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ipid\"");
 	}
 	void getRenderFurImages()const
 	{
-		fprintf(mFile,"\"%s.rfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfi\"");
 	}
 	void getRenderShadowMaps()const
 	{
-		fprintf(mFile,"\"%s.rnsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rnsm\"");
 	}
 	void getDisableGeometryRendering()const
 	{
-		fprintf(mFile,"\"%s.dgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dgr\"");
 	}
 protected:
 	FurGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -28,120 +28,120 @@ public:
 
 	void setInMesh(const mesh& im)
 	{
-		fprintf(mFile,"\tsetAttr \".im\" -type \"mesh\" ");
+		writeString(mFile,"\tsetAttr \".im\" -type \"mesh\" ");
 		im.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRelative(bool r)
 	{
 		if(r == true) return;
-		fprintf(mFile,"\tsetAttr \".r\" %i;\n", r);
+		writeInt(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setParameterU(double u)
 	{
 		if(u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".u\" %f;\n", u);
+		writeFloat(mFile,"\tsetAttr \".u\" ",u,";\n");
 	}
 	void setParameterV(double v)
 	{
 		if(v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v\" %f;\n", v);
+		writeFloat(mFile,"\tsetAttr \".v\" ",v,";\n");
 	}
 	void setPosition(const double3& p)
 	{
 		if(p == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"double3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPositionX(double px)
 	{
 		if(px == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".px\" ",px,";\n");
 	}
 	void setPositionY(double py)
 	{
 		if(py == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".py\" ",py,";\n");
 	}
 	void setPositionZ(double pz)
 	{
 		if(pz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".pz\" ",pz,";\n");
 	}
 	void setNormal(const double3& n)
 	{
 		if(n == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".n\" -type \"double3\" ");
 		n.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNormalX(double nx)
 	{
 		if(nx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nx\" %f;\n", nx);
+		writeFloat(mFile,"\tsetAttr \".nx\" ",nx,";\n");
 	}
 	void setNormalY(double ny)
 	{
 		if(ny == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ny\" %f;\n", ny);
+		writeFloat(mFile,"\tsetAttr \".ny\" ",ny,";\n");
 	}
 	void setNormalZ(double nz)
 	{
 		if(nz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nz\" %f;\n", nz);
+		writeFloat(mFile,"\tsetAttr \".nz\" ",nz,";\n");
 	}
 	void getInMesh()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getFaceIndex()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getRelative()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getParameterU()const
 	{
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getParameterV()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".px\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".py\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pz\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ny\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nz\"");
 	}
 protected:
 	FurPointOnMeshInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
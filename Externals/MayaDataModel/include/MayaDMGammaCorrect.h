@@ -27,94 +27,94 @@ public:
 	void setValue(const float3& v)
 	{
 		if(v == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".v\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".v\" -type \"float3\" ");
 		v.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setValueX(float vx)
 	{
 		if(vx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vx\" %f;\n", vx);
+		writeFloat(mFile,"\tsetAttr \".v.vx\" ",vx,";\n");
 	}
 	void setValueY(float vy)
 	{
 		if(vy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vy\" %f;\n", vy);
+		writeFloat(mFile,"\tsetAttr \".v.vy\" ",vy,";\n");
 	}
 	void setValueZ(float vz)
 	{
 		if(vz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vz\" %f;\n", vz);
+		writeFloat(mFile,"\tsetAttr \".v.vz\" ",vz,";\n");
 	}
 	void setGamma(const float3& g)
 	{
 		if(g == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".g\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".g\" -type \"float3\" ");
 		g.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGammaX(float gx)
 	{
 		if(gx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g.gx\" %f;\n", gx);
+		writeFloat(mFile,"\tsetAttr \".g.gx\" ",gx,";\n");
 	}
 	void setGammaY(float gy)
 	{
 		if(gy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g.gy\" %f;\n", gy);
+		writeFloat(mFile,"\tsetAttr \".g.gy\" ",gy,";\n");
 	}
 	void setGammaZ(float gz)
 	{
 		if(gz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g.gz\" %f;\n", gz);
+		writeFloat(mFile,"\tsetAttr \".g.gz\" ",gz,";\n");
 	}
 	void getValue()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getValueX()const
 	{
-		fprintf(mFile,"\"%s.v.vx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vx\"");
 	}
 	void getValueY()const
 	{
-		fprintf(mFile,"\"%s.v.vy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vy\"");
 	}
 	void getValueZ()const
 	{
-		fprintf(mFile,"\"%s.v.vz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vz\"");
 	}
 	void getGamma()const
 	{
-		fprintf(mFile,"\"%s.g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g\"");
 	}
 	void getGammaX()const
 	{
-		fprintf(mFile,"\"%s.g.gx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gx\"");
 	}
 	void getGammaY()const
 	{
-		fprintf(mFile,"\"%s.g.gy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gy\"");
 	}
 	void getGammaZ()const
 	{
-		fprintf(mFile,"\"%s.g.gz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gz\"");
 	}
 	void getOutValue()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutValueX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutValueY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutValueZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 protected:
 	GammaCorrect(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
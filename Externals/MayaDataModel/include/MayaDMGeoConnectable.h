@@ -26,66 +26,66 @@ public:
 
 	void getConnectionsToMe(size_t ct_i)const
 	{
-		fprintf(mFile,"\"%s.ct[%i]\"",mName.c_str(),ct_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ct[",ct_i,"]\"");
 	}
 	void getConnectionsToMe()const
 	{
 
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getAuxiliariesOwned()const
 	{
-		fprintf(mFile,"\"%s.ao\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ao\"");
 	}
 	void getVelocityValid()const
 	{
-		fprintf(mFile,"\"%s.vv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vv\"");
 	}
 	void getDoVelocity()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getPrevTime()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getCachedPositions()const
 	{
-		fprintf(mFile,"\"%s.cpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpo\"");
 	}
 	void getCachedVelocities()const
 	{
-		fprintf(mFile,"\"%s.cve\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cve\"");
 	}
 	void getComponentPositions(size_t cpp_i)const
 	{
-		fprintf(mFile,"\"%s.cpp[%i]\"",mName.c_str(),cpp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpp[",cpp_i,"]\"");
 	}
 	void getComponentPositions()const
 	{
 
-		fprintf(mFile,"\"%s.cpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpp\"");
 	}
 	void getGroupId(size_t gri_i)const
 	{
-		fprintf(mFile,"\"%s.gri[%i]\"",mName.c_str(),gri_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gri[",gri_i,"]\"");
 	}
 	void getGroupId()const
 	{
 
-		fprintf(mFile,"\"%s.gri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gri\"");
 	}
 	void getInputGeometryMsg()const
 	{
-		fprintf(mFile,"\"%s.igm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igm\"");
 	}
 	void getSurfaceGeometry()const
 	{
-		fprintf(mFile,"\"%s.sge\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sge\"");
 	}
 	void getLocalSurfaceGeometry()const
 	{
-		fprintf(mFile,"\"%s.lsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsg\"");
 	}
 protected:
 	GeoConnectable(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
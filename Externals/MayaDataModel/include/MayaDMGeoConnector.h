@@ -32,293 +32,293 @@ public:
 	void setWorldMatrix(const matrix& wm)
 	{
 		if(wm == identity) return;
-		fprintf(mFile,"\tsetAttr \".wm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".wm\" -type \"matrix\" ");
 		wm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGroupId(size_t gri_i,int gri)
 	{
 		if(gri == -1) return;
-		fprintf(mFile,"\tsetAttr \".gri[%i]\" %i;\n", gri_i,gri);
+		writeInt(mFile,"\tsetAttr \".gri[",gri_i); writeInt(mFile,"]\" ",gri,";\n");
 	}
 	void setGroupId(size_t gri_start,size_t gri_end,int* gri)
 	{
-		fprintf(mFile,"\tsetAttr \".gri[%i:%i]\" ", gri_start,gri_end);
+		writeInt(mFile,"\tsetAttr \".gri[",gri_start); writeInt(mFile,":",gri_end,"]\" ");
 		size_t size = (gri_end-gri_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",gri[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",gri[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGroupId(size_t gri_start,size_t gri_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".gri[%i:%i]\"",gri_start,gri_end);
+		writeInt(mFile,"\tsetAttr \".gri[",gri_start); writeInt(mFile,":",gri_end,"]\"");
 	}
 	void appendGroupId(int gri)const
 	{
-		fprintf(mFile," %i",gri);
+		writeInt(mFile," ",gri);
 	}
 	void endGroupId()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTessellationFactor(int tf)
 	{
 		if(tf == 200) return;
-		fprintf(mFile,"\tsetAttr \".tf\" %i;\n", tf);
+		writeInt(mFile,"\tsetAttr \".tf\" ",tf,";\n");
 	}
 	void setUvSetName(const string& guv)
 	{
 		if(guv == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".guv\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".guv\" -type \"string\" ");
 		guv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setResilience(double res)
 	{
 		if(res == 1) return;
-		fprintf(mFile,"\tsetAttr \".res\" %f;\n", res);
+		writeFloat(mFile,"\tsetAttr \".res\" ",res,";\n");
 	}
 	void setFriction(double fri)
 	{
 		if(fri == 0) return;
-		fprintf(mFile,"\tsetAttr \".fri\" %f;\n", fri);
+		writeFloat(mFile,"\tsetAttr \".fri\" ",fri,";\n");
 	}
 	void setOffset(double off)
 	{
 		if(off == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".off\" %f;\n", off);
+		writeFloat(mFile,"\tsetAttr \".off\" ",off,";\n");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getOwner()const
 	{
-		fprintf(mFile,"\"%s.own\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".own\"");
 	}
 	void getInputGeometryMsg()const
 	{
-		fprintf(mFile,"\"%s.igm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igm\"");
 	}
 	void getLocalGeometry()const
 	{
-		fprintf(mFile,"\"%s.lge\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lge\"");
 	}
 	void getWorldMatrix()const
 	{
-		fprintf(mFile,"\"%s.wm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wm\"");
 	}
 	void getOwnerPositions()const
 	{
-		fprintf(mFile,"\"%s.pos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos\"");
 	}
 	void getOwnerVelocities()const
 	{
-		fprintf(mFile,"\"%s.vel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel\"");
 	}
 	void getOwnerMasses()const
 	{
-		fprintf(mFile,"\"%s.mas\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mas\"");
 	}
 	void getIdMapping()const
 	{
-		fprintf(mFile,"\"%s.idm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idm\"");
 	}
 	void getSortedId()const
 	{
-		fprintf(mFile,"\"%s.idm.sid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idm.sid\"");
 	}
 	void getIdIndex()const
 	{
-		fprintf(mFile,"\"%s.idm.idix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idm.idix\"");
 	}
 	void getInputForce(size_t ifc_i)const
 	{
-		fprintf(mFile,"\"%s.ifc[%i]\"",mName.c_str(),ifc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ifc[",ifc_i,"]\"");
 	}
 	void getInputForce()const
 	{
 
-		fprintf(mFile,"\"%s.ifc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ifc\"");
 	}
 	void getOwnerCentroid()const
 	{
-		fprintf(mFile,"\"%s.ocd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd\"");
 	}
 	void getOwnerCentroidX()const
 	{
-		fprintf(mFile,"\"%s.ocd.ocx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.ocx\"");
 	}
 	void getOwnerCentroidY()const
 	{
-		fprintf(mFile,"\"%s.ocd.ocy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.ocy\"");
 	}
 	void getOwnerCentroidZ()const
 	{
-		fprintf(mFile,"\"%s.ocd.ocz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.ocz\"");
 	}
 	void getOwnerCentroidLocal()const
 	{
-		fprintf(mFile,"\"%s.ocl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl\"");
 	}
 	void getOwnerCentroidLocalX()const
 	{
-		fprintf(mFile,"\"%s.ocl.olcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.olcx\"");
 	}
 	void getOwnerCentroidLocalY()const
 	{
-		fprintf(mFile,"\"%s.ocl.ocly\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.ocly\"");
 	}
 	void getOwnerCentroidLocalZ()const
 	{
-		fprintf(mFile,"\"%s.ocl.oclz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.oclz\"");
 	}
 	void getGroupId(size_t gri_i)const
 	{
-		fprintf(mFile,"\"%s.gri[%i]\"",mName.c_str(),gri_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gri[",gri_i,"]\"");
 	}
 	void getGroupId()const
 	{
 
-		fprintf(mFile,"\"%s.gri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gri\"");
 	}
 	void getComponentPositions(size_t cpp_i)const
 	{
-		fprintf(mFile,"\"%s.cpp[%i]\"",mName.c_str(),cpp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpp[",cpp_i,"]\"");
 	}
 	void getComponentPositions()const
 	{
 
-		fprintf(mFile,"\"%s.cpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpp\"");
 	}
 	void getComponentVelocities(size_t cpv_i)const
 	{
-		fprintf(mFile,"\"%s.cpv[%i]\"",mName.c_str(),cpv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpv[",cpv_i,"]\"");
 	}
 	void getComponentVelocities()const
 	{
 
-		fprintf(mFile,"\"%s.cpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpv\"");
 	}
 	void getComponentCentroid(size_t cpc_i)const
 	{
-		fprintf(mFile,"\"%s.cpc[%i]\"",mName.c_str(),cpc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpc[",cpc_i,"]\"");
 	}
 	void getComponentCentroid()const
 	{
 
-		fprintf(mFile,"\"%s.cpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpc\"");
 	}
 	void getComponentCentroidX(size_t cpc_i)const
 	{
-		fprintf(mFile,"\"%s.cpc[%i].ccx\"",mName.c_str(),cpc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpc[",cpc_i,"].ccx\"");
 	}
 	void getComponentCentroidX()const
 	{
 
-		fprintf(mFile,"\"%s.cpc.ccx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpc.ccx\"");
 	}
 	void getComponentCentroidY(size_t cpc_i)const
 	{
-		fprintf(mFile,"\"%s.cpc[%i].ccy\"",mName.c_str(),cpc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpc[",cpc_i,"].ccy\"");
 	}
 	void getComponentCentroidY()const
 	{
 
-		fprintf(mFile,"\"%s.cpc.ccy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpc.ccy\"");
 	}
 	void getComponentCentroidZ(size_t cpc_i)const
 	{
-		fprintf(mFile,"\"%s.cpc[%i].ccz\"",mName.c_str(),cpc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpc[",cpc_i,"].ccz\"");
 	}
 	void getComponentCentroidZ()const
 	{
 
-		fprintf(mFile,"\"%s.cpc.ccz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpc.ccz\"");
 	}
 	void getComponentCentroidLocal(size_t ccl_i)const
 	{
-		fprintf(mFile,"\"%s.ccl[%i]\"",mName.c_str(),ccl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ccl[",ccl_i,"]\"");
 	}
 	void getComponentCentroidLocal()const
 	{
 
-		fprintf(mFile,"\"%s.ccl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccl\"");
 	}
 	void getComponentCentroidLocalX(size_t ccl_i)const
 	{
-		fprintf(mFile,"\"%s.ccl[%i].cclx\"",mName.c_str(),ccl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ccl[",ccl_i,"].cclx\"");
 	}
 	void getComponentCentroidLocalX()const
 	{
 
-		fprintf(mFile,"\"%s.ccl.cclx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccl.cclx\"");
 	}
 	void getComponentCentroidLocalY(size_t ccl_i)const
 	{
-		fprintf(mFile,"\"%s.ccl[%i].clcy\"",mName.c_str(),ccl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ccl[",ccl_i,"].clcy\"");
 	}
 	void getComponentCentroidLocalY()const
 	{
 
-		fprintf(mFile,"\"%s.ccl.clcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccl.clcy\"");
 	}
 	void getComponentCentroidLocalZ(size_t ccl_i)const
 	{
-		fprintf(mFile,"\"%s.ccl[%i].clcz\"",mName.c_str(),ccl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ccl[",ccl_i,"].clcz\"");
 	}
 	void getComponentCentroidLocalZ()const
 	{
 
-		fprintf(mFile,"\"%s.ccl.clcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccl.clcz\"");
 	}
 	void getSweptGeometry()const
 	{
-		fprintf(mFile,"\"%s.swg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".swg\"");
 	}
 	void getLocalSweptGeometry()const
 	{
-		fprintf(mFile,"\"%s.lsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsg\"");
 	}
 	void getRatePPIn(size_t rpi_i)const
 	{
-		fprintf(mFile,"\"%s.rpi[%i]\"",mName.c_str(),rpi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rpi[",rpi_i,"]\"");
 	}
 	void getRatePPIn()const
 	{
 
-		fprintf(mFile,"\"%s.rpi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpi\"");
 	}
 	void getRatePPOut()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getMatrixModified()const
 	{
-		fprintf(mFile,"\"%s.mtm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mtm\"");
 	}
 	void getGeometryModified()const
 	{
-		fprintf(mFile,"\"%s.gmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gmd\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.guv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".guv\"");
 	}
 	void getResilience()const
 	{
-		fprintf(mFile,"\"%s.res\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res\"");
 	}
 	void getFriction()const
 	{
-		fprintf(mFile,"\"%s.fri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fri\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.off\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".off\"");
 	}
 protected:
 	GeoConnector(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -21,7 +21,7 @@ public:
 		double targetWeight;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", targetWeight);
+			writeFloat(file,"",targetWeight);
 		}
 	};
 public:
@@ -33,81 +33,81 @@ public:
 
 	void setTarget(size_t tg_i,const Target& tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i]\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"]\" ");
 		tg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTarget(size_t tg_start,size_t tg_end,Target* tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\" ", tg_start,tg_end);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\" ");
 		size_t size = (tg_end-tg_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			tg[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTarget(size_t tg_start,size_t tg_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\"",tg_start,tg_end);
-		fprintf(mFile," -type \"Target\" ");
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\"");
+		writeString(mFile," -type \"Target\" ");
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		tg.write(mFile);
 	}
 	void endTarget()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetWeight(size_t tg_i,double tw)
 	{
 		if(tw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tw\" %f;\n", tg_i,tw);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tw\" ",tw,";\n");
 	}
 	void setConstraintParentInverseMatrix(const matrix& cpim)
 	{
 		if(cpim == identity) return;
-		fprintf(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
 		cpim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getTarget(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i]\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"]\"");
 	}
 	void getTarget()const
 	{
 
-		fprintf(mFile,"\"%s.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg\"");
 	}
 	void getTargetGeometry(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tgm\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tgm\"");
 	}
 	void getTargetGeometry()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tgm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tgm\"");
 	}
 	void getTargetWeight(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tw\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tw\"");
 	}
 	void getTargetWeight()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tw\"");
 	}
 	void getConstraintParentInverseMatrix()const
 	{
-		fprintf(mFile,"\"%s.cpim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpim\"");
 	}
 	void getConstraintGeometry()const
 	{
-		fprintf(mFile,"\"%s.cgm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cgm\"");
 	}
 protected:
 	GeometryConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -21,7 +21,7 @@ public:
 		int groupId;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i", groupId);
+			writeInt(file,"",groupId);
 		}
 	};
 public:
@@ -33,104 +33,104 @@ public:
 
 	void setInput(size_t ip_i,const Input& ip)
 	{
-		fprintf(mFile,"\tsetAttr \".ip[%i]\" ",ip_i);
+		writeInt(mFile,"\tsetAttr \".ip[",ip_i,"]\" ");
 		ip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput(size_t ip_start,size_t ip_end,Input* ip)
 	{
-		fprintf(mFile,"\tsetAttr \".ip[%i:%i]\" ", ip_start,ip_end);
+		writeInt(mFile,"\tsetAttr \".ip[",ip_start); writeInt(mFile,":",ip_end,"]\" ");
 		size_t size = (ip_end-ip_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ip[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput(size_t ip_start,size_t ip_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ip[%i:%i]\"",ip_start,ip_end);
-		fprintf(mFile," -type \"Input\" ");
+		writeInt(mFile,"\tsetAttr \".ip[",ip_start); writeInt(mFile,":",ip_end,"]\"");
+		writeString(mFile," -type \"Input\" ");
 	}
 	void appendInput(const Input& ip)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ip.write(mFile);
 	}
 	void endInput()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGroupId(size_t ip_i,int gi)
 	{
 		if(gi == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip[%i].gi\" %i;\n", ip_i,gi);
+		writeInt(mFile,"\tsetAttr \".ip[",ip_i); writeInt(mFile,"].gi\" ",gi,";\n");
 	}
 	void setEnvelope(float en)
 	{
 		if(en == 1) return;
-		fprintf(mFile,"\tsetAttr \".en\" %f;\n", en);
+		writeFloat(mFile,"\tsetAttr \".en\" ",en,";\n");
 	}
 	void getInput(size_t ip_i)const
 	{
-		fprintf(mFile,"\"%s.ip[%i]\"",mName.c_str(),ip_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ip[",ip_i,"]\"");
 	}
 	void getInput()const
 	{
 
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getInputGeometry(size_t ip_i)const
 	{
-		fprintf(mFile,"\"%s.ip[%i].ig\"",mName.c_str(),ip_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ip[",ip_i,"].ig\"");
 	}
 	void getInputGeometry()const
 	{
 
-		fprintf(mFile,"\"%s.ip.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ig\"");
 	}
 	void getGroupId(size_t ip_i)const
 	{
-		fprintf(mFile,"\"%s.ip[%i].gi\"",mName.c_str(),ip_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ip[",ip_i,"].gi\"");
 	}
 	void getGroupId()const
 	{
 
-		fprintf(mFile,"\"%s.ip.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.gi\"");
 	}
 	void getOutputGeometry(size_t og_i)const
 	{
-		fprintf(mFile,"\"%s.og[%i]\"",mName.c_str(),og_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".og[",og_i,"]\"");
 	}
 	void getOutputGeometry()const
 	{
 
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 	void getEnvelope()const
 	{
-		fprintf(mFile,"\"%s.en\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".en\"");
 	}
 	void getFunction()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getFchild1()const
 	{
-		fprintf(mFile,"\"%s.f.f1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f.f1\"");
 	}
 	void getFchild2()const
 	{
-		fprintf(mFile,"\"%s.f.f2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f.f2\"");
 	}
 	void getFchild3()const
 	{
-		fprintf(mFile,"\"%s.f.f3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f.f3\"");
 	}
 	void getMap64BitIndices()const
 	{
-		fprintf(mFile,"\"%s.map\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".map\"");
 	}
 protected:
 	GeometryFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -24,8 +24,8 @@ public:
 			void write(FILE* file) const
 			{
 				compObjectGrpCompList.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%i", compObjectGroupId);
+				writeString(file," ");
+				writeInt(file,"",compObjectGroupId);
 			}
 		}* compObjectGroups;
 		size_t nbCompObjectGroups;
@@ -34,7 +34,7 @@ public:
 			for (size_t i = 0; i<nbCompObjectGroups; ++i)
 			{
 				compObjectGroups[i].write(file);
-				if (i + 1<nbCompObjectGroups) fprintf(file, " ");
+				if (i + 1<nbCompObjectGroups) writeString(file," ");
 			}
 		}
 	};
@@ -48,286 +48,286 @@ public:
 	void setRenderType(short rt)
 	{
 		if(rt == 0) return;
-		fprintf(mFile,"\tsetAttr \".rt\" %i;\n", rt);
+		writeInt(mFile,"\tsetAttr \".rt\" ",rt,";\n");
 	}
 	void setRenderVolume(bool rv)
 	{
 		if(rv == false) return;
-		fprintf(mFile,"\tsetAttr \".rv\" %i;\n", rv);
+		writeInt(mFile,"\tsetAttr \".rv\" ",rv,";\n");
 	}
 	void setVisibleFraction(float vf)
 	{
 		if(vf == 1.0f) return;
-		fprintf(mFile,"\tsetAttr \".vf\" %f;\n", vf);
+		writeFloat(mFile,"\tsetAttr \".vf\" ",vf,";\n");
 	}
 	void setMotionBlur(bool mb)
 	{
 		if(mb == true) return;
-		fprintf(mFile,"\tsetAttr \".mb\" %i;\n", mb);
+		writeInt(mFile,"\tsetAttr \".mb\" ",mb,";\n");
 	}
 	void setVisibleInReflections(bool vir)
 	{
 		if(vir == false) return;
-		fprintf(mFile,"\tsetAttr \".vir\" %i;\n", vir);
+		writeInt(mFile,"\tsetAttr \".vir\" ",vir,";\n");
 	}
 	void setVisibleInRefractions(bool vif)
 	{
 		if(vif == false) return;
-		fprintf(mFile,"\tsetAttr \".vif\" %i;\n", vif);
+		writeInt(mFile,"\tsetAttr \".vif\" ",vif,";\n");
 	}
 	void setCastsShadows(bool csh)
 	{
 		if(csh == true) return;
-		fprintf(mFile,"\tsetAttr \".csh\" %i;\n", csh);
+		writeInt(mFile,"\tsetAttr \".csh\" ",csh,";\n");
 	}
 	void setReceiveShadows(bool rcsh)
 	{
 		if(rcsh == true) return;
-		fprintf(mFile,"\tsetAttr \".rcsh\" %i;\n", rcsh);
+		writeInt(mFile,"\tsetAttr \".rcsh\" ",rcsh,";\n");
 	}
 	void setMaxVisibilitySamplesOverride(bool vbo)
 	{
 		if(vbo == false) return;
-		fprintf(mFile,"\tsetAttr \".vbo\" %i;\n", vbo);
+		writeInt(mFile,"\tsetAttr \".vbo\" ",vbo,";\n");
 	}
 	void setMaxVisibilitySamples(int mvs)
 	{
 		if(mvs == 1) return;
-		fprintf(mFile,"\tsetAttr \".mvs\" %i;\n", mvs);
+		writeInt(mFile,"\tsetAttr \".mvs\" ",mvs,";\n");
 	}
 	void setGeometryAntialiasingOverride(bool gao)
 	{
 		if(gao == false) return;
-		fprintf(mFile,"\tsetAttr \".gao\" %i;\n", gao);
+		writeInt(mFile,"\tsetAttr \".gao\" ",gao,";\n");
 	}
 	void setAntialiasingLevel(int gal)
 	{
 		if(gal == 1) return;
-		fprintf(mFile,"\tsetAttr \".gal\" %i;\n", gal);
+		writeInt(mFile,"\tsetAttr \".gal\" ",gal,";\n");
 	}
 	void setShadingSamplesOverride(bool sso)
 	{
 		if(sso == false) return;
-		fprintf(mFile,"\tsetAttr \".sso\" %i;\n", sso);
+		writeInt(mFile,"\tsetAttr \".sso\" ",sso,";\n");
 	}
 	void setShadingSamples(int ssa)
 	{
 		if(ssa == 1) return;
-		fprintf(mFile,"\tsetAttr \".ssa\" %i;\n", ssa);
+		writeInt(mFile,"\tsetAttr \".ssa\" ",ssa,";\n");
 	}
 	void setMaxShadingSamples(int msa)
 	{
 		if(msa == 1) return;
-		fprintf(mFile,"\tsetAttr \".msa\" %i;\n", msa);
+		writeInt(mFile,"\tsetAttr \".msa\" ",msa,";\n");
 	}
 	void setVolumeSamplesOverride(bool vso)
 	{
 		if(vso == false) return;
-		fprintf(mFile,"\tsetAttr \".vso\" %i;\n", vso);
+		writeInt(mFile,"\tsetAttr \".vso\" ",vso,";\n");
 	}
 	void setVolumeSamples(int vss)
 	{
 		if(vss == 1) return;
-		fprintf(mFile,"\tsetAttr \".vss\" %i;\n", vss);
+		writeInt(mFile,"\tsetAttr \".vss\" ",vss,";\n");
 	}
 	void setDepthJitter(bool dej)
 	{
 		if(dej == false) return;
-		fprintf(mFile,"\tsetAttr \".dej\" %i;\n", dej);
+		writeInt(mFile,"\tsetAttr \".dej\" ",dej,";\n");
 	}
 	void setIgnoreSelfShadowing(bool iss)
 	{
 		if(iss == false) return;
-		fprintf(mFile,"\tsetAttr \".iss\" %i;\n", iss);
+		writeInt(mFile,"\tsetAttr \".iss\" ",iss,";\n");
 	}
 	void setPrimaryVisibility(bool vis)
 	{
 		if(vis == true) return;
-		fprintf(mFile,"\tsetAttr \".vis\" %i;\n", vis);
+		writeInt(mFile,"\tsetAttr \".vis\" ",vis,";\n");
 	}
 	void setCompInstObjGroups(size_t ciog_i,const CompInstObjGroups& ciog)
 	{
-		fprintf(mFile,"\tsetAttr \".ciog[%i]\" ",ciog_i);
+		writeInt(mFile,"\tsetAttr \".ciog[",ciog_i,"]\" ");
 		ciog.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCompInstObjGroups(size_t ciog_start,size_t ciog_end,CompInstObjGroups* ciog)
 	{
-		fprintf(mFile,"\tsetAttr \".ciog[%i:%i]\" ", ciog_start,ciog_end);
+		writeInt(mFile,"\tsetAttr \".ciog[",ciog_start); writeInt(mFile,":",ciog_end,"]\" ");
 		size_t size = (ciog_end-ciog_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ciog[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCompInstObjGroups(size_t ciog_start,size_t ciog_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ciog[%i:%i]\"",ciog_start,ciog_end);
-		fprintf(mFile," -type \"CompInstObjGroups\" ");
+		writeInt(mFile,"\tsetAttr \".ciog[",ciog_start); writeInt(mFile,":",ciog_end,"]\"");
+		writeString(mFile," -type \"CompInstObjGroups\" ");
 	}
 	void appendCompInstObjGroups(const CompInstObjGroups& ciog)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ciog.write(mFile);
 	}
 	void endCompInstObjGroups()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCompObjectGroups(size_t ciog_i,size_t cog_i,const CompInstObjGroups::CompObjectGroups& cog)
 	{
-		fprintf(mFile,"\tsetAttr \".ciog[%i].cog[%i]\" ",ciog_i,cog_i);
+		writeInt(mFile,"\tsetAttr \".ciog[",ciog_i); writeInt(mFile,"].cog[",cog_i,"]\" ");
 		cog.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCompObjectGroups(size_t ciog_i,size_t cog_start,size_t cog_end,CompInstObjGroups::CompObjectGroups* cog)
 	{
-		fprintf(mFile,"\tsetAttr \".ciog[%i].cog[%i:%i]\" ", ciog_i,cog_start,cog_end);
+		writeInt(mFile,"\tsetAttr \".ciog[",ciog_i); writeInt(mFile,"].cog[",cog_start); writeInt(mFile,":",cog_end,"]\" ");
 		size_t size = (cog_end-cog_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cog[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCompObjectGroups(size_t ciog_i,size_t cog_start,size_t cog_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ciog[%i].cog[%i:%i]\"",ciog_i,cog_start,cog_end);
-		fprintf(mFile," -type \"CompInstObjGroups::CompObjectGroups\" ");
+		writeInt(mFile,"\tsetAttr \".ciog[",ciog_i); writeInt(mFile,"].cog[",cog_start); writeInt(mFile,":",cog_end,"]\"");
+		writeString(mFile," -type \"CompInstObjGroups::CompObjectGroups\" ");
 	}
 	void appendCompObjectGroups(const CompInstObjGroups::CompObjectGroups& cog)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cog.write(mFile);
 	}
 	void endCompObjectGroups()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCompObjectGrpCompList(size_t ciog_i,size_t cog_i,const componentList& cgcl)
 	{
-		fprintf(mFile,"\tsetAttr \".ciog[%i].cog[%i].cgcl\" -type \"componentList\" ",ciog_i,cog_i);
+		writeInt(mFile,"\tsetAttr \".ciog[",ciog_i); writeInt(mFile,"].cog[",cog_i,"].cgcl\" -type \"componentList\" ");
 		cgcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCompObjectGroupId(size_t ciog_i,size_t cog_i,int cgid)
 	{
 		if(cgid == 0) return;
-		fprintf(mFile,"\tsetAttr \".ciog[%i].cog[%i].cgid\" %i;\n", ciog_i,cog_i,cgid);
+		writeInt(mFile,"\tsetAttr \".ciog[",ciog_i); writeInt(mFile,"].cog[",cog_i); writeInt(mFile,"].cgid\" ",cgid,";\n");
 	}
 	void getRenderType()const
 	{
-		fprintf(mFile,"\"%s.rt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rt\"");
 	}
 	void getRenderVolume()const
 	{
-		fprintf(mFile,"\"%s.rv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rv\"");
 	}
 	void getVisibleFraction()const
 	{
-		fprintf(mFile,"\"%s.vf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vf\"");
 	}
 	void getMotionBlur()const
 	{
-		fprintf(mFile,"\"%s.mb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mb\"");
 	}
 	void getVisibleInReflections()const
 	{
-		fprintf(mFile,"\"%s.vir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vir\"");
 	}
 	void getVisibleInRefractions()const
 	{
-		fprintf(mFile,"\"%s.vif\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vif\"");
 	}
 	void getCastsShadows()const
 	{
-		fprintf(mFile,"\"%s.csh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csh\"");
 	}
 	void getReceiveShadows()const
 	{
-		fprintf(mFile,"\"%s.rcsh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcsh\"");
 	}
 	void getMaxVisibilitySamplesOverride()const
 	{
-		fprintf(mFile,"\"%s.vbo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vbo\"");
 	}
 	void getMaxVisibilitySamples()const
 	{
-		fprintf(mFile,"\"%s.mvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mvs\"");
 	}
 	void getGeometryAntialiasingOverride()const
 	{
-		fprintf(mFile,"\"%s.gao\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gao\"");
 	}
 	void getAntialiasingLevel()const
 	{
-		fprintf(mFile,"\"%s.gal\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gal\"");
 	}
 	void getShadingSamplesOverride()const
 	{
-		fprintf(mFile,"\"%s.sso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sso\"");
 	}
 	void getShadingSamples()const
 	{
-		fprintf(mFile,"\"%s.ssa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssa\"");
 	}
 	void getMaxShadingSamples()const
 	{
-		fprintf(mFile,"\"%s.msa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msa\"");
 	}
 	void getVolumeSamplesOverride()const
 	{
-		fprintf(mFile,"\"%s.vso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vso\"");
 	}
 	void getVolumeSamples()const
 	{
-		fprintf(mFile,"\"%s.vss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vss\"");
 	}
 	void getDepthJitter()const
 	{
-		fprintf(mFile,"\"%s.dej\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dej\"");
 	}
 	void getIgnoreSelfShadowing()const
 	{
-		fprintf(mFile,"\"%s.iss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iss\"");
 	}
 	void getPrimaryVisibility()const
 	{
-		fprintf(mFile,"\"%s.vis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vis\"");
 	}
 	void getReferenceObject()const
 	{
-		fprintf(mFile,"\"%s.rob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rob\"");
 	}
 	void getCompInstObjGroups(size_t ciog_i)const
 	{
-		fprintf(mFile,"\"%s.ciog[%i]\"",mName.c_str(),ciog_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ciog[",ciog_i,"]\"");
 	}
 	void getCompInstObjGroups()const
 	{
 
-		fprintf(mFile,"\"%s.ciog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ciog\"");
 	}
 	void getCompObjectGroups(size_t ciog_i,size_t cog_i)const
 	{
-		fprintf(mFile,"\"%s.ciog[%i].cog[%i]\"",mName.c_str(),ciog_i,cog_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ciog[",ciog_i); writeInt(mFile,"].cog[",cog_i,"]\"");
 	}
 	void getCompObjectGroups(size_t cog_i)const
 	{
 
-		fprintf(mFile,"\"%s.ciog.cog[%i]\"",mName.c_str(),cog_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ciog.cog[",cog_i,"]\"");
 	}
 	void getCompObjectGroupId(size_t ciog_i,size_t cog_i)const
 	{
-		fprintf(mFile,"\"%s.ciog[%i].cog[%i].cgid\"",mName.c_str(),ciog_i,cog_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ciog[",ciog_i); writeInt(mFile,"].cog[",cog_i,"].cgid\"");
 	}
 	void getCompObjectGroupId(size_t cog_i)const
 	{
 
-		fprintf(mFile,"\"%s.ciog.cog[%i].cgid\"",mName.c_str(),cog_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ciog.cog[",cog_i,"].cgid\"");
 	}
 protected:
 	GeometryShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
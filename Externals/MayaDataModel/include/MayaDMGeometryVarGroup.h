@@ -26,21 +26,21 @@ public:
 
 	void getCreate(size_t cr_i)const
 	{
-		fprintf(mFile,"\"%s.cr[%i]\"",mName.c_str(),cr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cr[",cr_i,"]\"");
 	}
 	void getCreate()const
 	{
 
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getLocal(size_t l_i)const
 	{
-		fprintf(mFile,"\"%s.l[%i]\"",mName.c_str(),l_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".l[",l_i,"]\"");
 	}
 	void getLocal()const
 	{
 
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 protected:
 	GeometryVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,20 +27,20 @@ public:
 	void setEnableStatus(unsigned int ebls)
 	{
 		if(ebls == 0) return;
-		fprintf(mFile,"\tsetAttr \".ebls\" %i;\n", ebls);
+		writeInt(mFile,"\tsetAttr \".ebls\" ",ebls,";\n");
 	}
 	void setWriteEnable(bool webl)
 	{
 		if(webl == false) return;
-		fprintf(mFile,"\tsetAttr \".webl\" %i;\n", webl);
+		writeInt(mFile,"\tsetAttr \".webl\" ",webl,";\n");
 	}
 	void getEnableStatus()const
 	{
-		fprintf(mFile,"\"%s.ebls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ebls\"");
 	}
 	void getWriteEnable()const
 	{
-		fprintf(mFile,"\"%s.webl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".webl\"");
 	}
 protected:
 	GlobalCacheControl(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,142 +27,142 @@ public:
 	void setStitchCorners(unsigned int sc)
 	{
 		if(sc == 1) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setStitchEdges(unsigned int se)
 	{
 		if(se == 1) return;
-		fprintf(mFile,"\tsetAttr \".se\" %i;\n", se);
+		writeInt(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setStitchSmoothness(unsigned int ss)
 	{
 		if(ss == 0) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %i;\n", ss);
+		writeInt(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setStitchPartialEdges(bool spe)
 	{
 		if(spe == false) return;
-		fprintf(mFile,"\tsetAttr \".spe\" %i;\n", spe);
+		writeInt(mFile,"\tsetAttr \".spe\" ",spe,";\n");
 	}
 	void setMaxSeparation(double ms)
 	{
 		if(ms == 0) return;
-		fprintf(mFile,"\tsetAttr \".ms\" %f;\n", ms);
+		writeFloat(mFile,"\tsetAttr \".ms\" ",ms,";\n");
 	}
 	void setSampling(int sam)
 	{
 		if(sam == 1) return;
-		fprintf(mFile,"\tsetAttr \".sam\" %i;\n", sam);
+		writeInt(mFile,"\tsetAttr \".sam\" ",sam,";\n");
 	}
 	void setModificationResistance(double mr)
 	{
 		if(mr == 1e-1) return;
-		fprintf(mFile,"\tsetAttr \".mr\" %f;\n", mr);
+		writeFloat(mFile,"\tsetAttr \".mr\" ",mr,";\n");
 	}
 	void setLockSurface(size_t lk_i,bool lk)
 	{
 		if(lk == false) return;
-		fprintf(mFile,"\tsetAttr \".lk[%i]\" %i;\n", lk_i,lk);
+		writeInt(mFile,"\tsetAttr \".lk[",lk_i); writeInt(mFile,"]\" ",lk,";\n");
 	}
 	void setLockSurface(size_t lk_start,size_t lk_end,bool* lk)
 	{
-		fprintf(mFile,"\tsetAttr \".lk[%i:%i]\" ", lk_start,lk_end);
+		writeInt(mFile,"\tsetAttr \".lk[",lk_start); writeInt(mFile,":",lk_end,"]\" ");
 		size_t size = (lk_end-lk_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",lk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",lk[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLockSurface(size_t lk_start,size_t lk_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".lk[%i:%i]\"",lk_start,lk_end);
+		writeInt(mFile,"\tsetAttr \".lk[",lk_start); writeInt(mFile,":",lk_end,"]\"");
 	}
 	void appendLockSurface(bool lk)const
 	{
-		fprintf(mFile," %i",lk);
+		writeInt(mFile," ",lk);
 	}
 	void endLockSurface()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputSurface(size_t is_i)const
 	{
-		fprintf(mFile,"\"%s.is[%i]\"",mName.c_str(),is_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".is[",is_i,"]\"");
 	}
 	void getInputSurface()const
 	{
 
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getStitchCorners()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getStitchEdges()const
 	{
-		fprintf(mFile,"\"%s.se\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".se\"");
 	}
 	void getStitchSmoothness()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getStitchPartialEdges()const
 	{
-		fprintf(mFile,"\"%s.spe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spe\"");
 	}
 	void getMaxSeparation()const
 	{
-		fprintf(mFile,"\"%s.ms\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ms\"");
 	}
 	void getSampling()const
 	{
-		fprintf(mFile,"\"%s.sam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sam\"");
 	}
 	void getModificationResistance()const
 	{
-		fprintf(mFile,"\"%s.mr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mr\"");
 	}
 	void getLockSurface(size_t lk_i)const
 	{
-		fprintf(mFile,"\"%s.lk[%i]\"",mName.c_str(),lk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lk[",lk_i,"]\"");
 	}
 	void getLockSurface()const
 	{
 
-		fprintf(mFile,"\"%s.lk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lk\"");
 	}
 	void getShouldBeLast()const
 	{
-		fprintf(mFile,"\"%s.sbl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sbl\"");
 	}
 	void getOutputSurface(size_t os_i)const
 	{
-		fprintf(mFile,"\"%s.os[%i]\"",mName.c_str(),os_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".os[",os_i,"]\"");
 	}
 	void getOutputSurface()const
 	{
 
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getConnectedEdges(size_t ce_i)const
 	{
-		fprintf(mFile,"\"%s.ce[%i]\"",mName.c_str(),ce_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ce[",ce_i,"]\"");
 	}
 	void getConnectedEdges()const
 	{
 
-		fprintf(mFile,"\"%s.ce\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ce\"");
 	}
 	void getUnconnectedEdges(size_t ue_i)const
 	{
-		fprintf(mFile,"\"%s.ue[%i]\"",mName.c_str(),ue_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ue[",ue_i,"]\"");
 	}
 	void getUnconnectedEdges()const
 	{
 
-		fprintf(mFile,"\"%s.ue\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ue\"");
 	}
 protected:
 	GlobalStitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
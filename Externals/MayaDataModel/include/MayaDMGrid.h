@@ -27,105 +27,105 @@ public:
 	void setFillerColor(const float3& fc)
 	{
 		if(fc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFillerColorR(float fcr)
 	{
 		if(fcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fc.fcr\" ",fcr,";\n");
 	}
 	void setFillerColorG(float fcg)
 	{
 		if(fcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcg\" %f;\n", fcg);
+		writeFloat(mFile,"\tsetAttr \".fc.fcg\" ",fcg,";\n");
 	}
 	void setFillerColorB(float fcb)
 	{
 		if(fcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcb\" %f;\n", fcb);
+		writeFloat(mFile,"\tsetAttr \".fc.fcb\" ",fcb,";\n");
 	}
 	void setLineColor(const float3& lc)
 	{
 		if(lc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".lc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lc\" -type \"float3\" ");
 		lc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLineColorR(float lcr)
 	{
 		if(lcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lcr\" %f;\n", lcr);
+		writeFloat(mFile,"\tsetAttr \".lc.lcr\" ",lcr,";\n");
 	}
 	void setLineColorG(float lcg)
 	{
 		if(lcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lcg\" %f;\n", lcg);
+		writeFloat(mFile,"\tsetAttr \".lc.lcg\" ",lcg,";\n");
 	}
 	void setLineColorB(float lcb)
 	{
 		if(lcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lcb\" %f;\n", lcb);
+		writeFloat(mFile,"\tsetAttr \".lc.lcb\" ",lcb,";\n");
 	}
 	void setContrast(float c)
 	{
 		if(c == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".c\" %f;\n", c);
+		writeFloat(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setUWidth(float uw)
 	{
 		if(uw == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".uw\" %f;\n", uw);
+		writeFloat(mFile,"\tsetAttr \".uw\" ",uw,";\n");
 	}
 	void setVWidth(float vw)
 	{
 		if(vw == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".vw\" %f;\n", vw);
+		writeFloat(mFile,"\tsetAttr \".vw\" ",vw,";\n");
 	}
 	void getFillerColor()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFillerColorR()const
 	{
-		fprintf(mFile,"\"%s.fc.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcr\"");
 	}
 	void getFillerColorG()const
 	{
-		fprintf(mFile,"\"%s.fc.fcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcg\"");
 	}
 	void getFillerColorB()const
 	{
-		fprintf(mFile,"\"%s.fc.fcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcb\"");
 	}
 	void getLineColor()const
 	{
-		fprintf(mFile,"\"%s.lc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc\"");
 	}
 	void getLineColorR()const
 	{
-		fprintf(mFile,"\"%s.lc.lcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lcr\"");
 	}
 	void getLineColorG()const
 	{
-		fprintf(mFile,"\"%s.lc.lcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lcg\"");
 	}
 	void getLineColorB()const
 	{
-		fprintf(mFile,"\"%s.lc.lcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lcb\"");
 	}
 	void getContrast()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getUWidth()const
 	{
-		fprintf(mFile,"\"%s.uw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uw\"");
 	}
 	void getVWidth()const
 	{
-		fprintf(mFile,"\"%s.vw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vw\"");
 	}
 protected:
 	Grid(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,7 +26,7 @@ public:
 
 	void getGroupId()const
 	{
-		fprintf(mFile,"\"%s.id\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".id\"");
 	}
 protected:
 	GroupId(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
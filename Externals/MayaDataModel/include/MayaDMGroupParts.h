@@ -26,40 +26,40 @@ public:
 
 	void setInputComponents(const componentList& ic)
 	{
-		fprintf(mFile,"\tsetAttr \".ic\" -type \"componentList\" ");
+		writeString(mFile,"\tsetAttr \".ic\" -type \"componentList\" ");
 		ic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputRemoveComponent(const componentList& irc)
 	{
-		fprintf(mFile,"\tsetAttr \".irc\" -type \"componentList\" ");
+		writeString(mFile,"\tsetAttr \".irc\" -type \"componentList\" ");
 		irc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGroupId(int gi)
 	{
 		if(gi == -1) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %i;\n", gi);
+		writeInt(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ig\"");
 	}
 	void getInputComponents()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getInputRemoveComponent()const
 	{
-		fprintf(mFile,"\"%s.irc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".irc\"");
 	}
 	void getOutputGeometry()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 	void getGroupId()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 protected:
 	GroupParts(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,87 +27,87 @@ public:
 	void setJointAboveMatrix(const matrix& am)
 	{
 		if(am == identity) return;
-		fprintf(mFile,"\tsetAttr \".am\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".am\" -type \"matrix\" ");
 		am.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setJointXformMatrix(const matrix& jm)
 	{
-		fprintf(mFile,"\tsetAttr \".jm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".jm\" -type \"matrix\" ");
 		jm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setJointBelowMatrix(const matrix& bm)
 	{
 		if(bm == identity) return;
-		fprintf(mFile,"\tsetAttr \".bm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".bm\" -type \"matrix\" ");
 		bm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setJointGuideAxis(unsigned int ga)
 	{
 		if(ga == 0) return;
-		fprintf(mFile,"\tsetAttr \".ga\" %i;\n", ga);
+		writeInt(mFile,"\tsetAttr \".ga\" ",ga,";\n");
 	}
 	void getJointAboveMatrix()const
 	{
-		fprintf(mFile,"\"%s.am\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".am\"");
 	}
 	void getJointXformMatrix()const
 	{
-		fprintf(mFile,"\"%s.jm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jm\"");
 	}
 	void getJointBelowMatrix()const
 	{
-		fprintf(mFile,"\"%s.bm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bm\"");
 	}
 	void getJointGuideAxis()const
 	{
-		fprintf(mFile,"\"%s.ga\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ga\"");
 	}
 	void getBendVector()const
 	{
-		fprintf(mFile,"\"%s.bv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv\"");
 	}
 	void getBendVectorX()const
 	{
-		fprintf(mFile,"\"%s.bv.bx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv.bx\"");
 	}
 	void getBendVectorY()const
 	{
-		fprintf(mFile,"\"%s.bv.by\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv.by\"");
 	}
 	void getBendVectorZ()const
 	{
-		fprintf(mFile,"\"%s.bv.bz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv.bz\"");
 	}
 	void getBendAngle()const
 	{
-		fprintf(mFile,"\"%s.ba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ba\"");
 	}
 	void getBendMagnitude()const
 	{
-		fprintf(mFile,"\"%s.mg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mg\"");
 	}
 	void getRotateX()const
 	{
-		fprintf(mFile,"\"%s.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rx\"");
 	}
 	void getRotateY()const
 	{
-		fprintf(mFile,"\"%s.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ry\"");
 	}
 	void getRotateZ()const
 	{
-		fprintf(mFile,"\"%s.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rz\"");
 	}
 	void getMaxXYZ()const
 	{
-		fprintf(mFile,"\"%s.ma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ma\"");
 	}
 	void getAutoGuide()const
 	{
-		fprintf(mFile,"\"%s.ag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ag\"");
 	}
 protected:
 	Guide(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
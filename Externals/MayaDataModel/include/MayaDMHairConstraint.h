@@ -27,102 +27,102 @@ public:
 	void setCurveIndices(size_t cin_i,int cin)
 	{
 		if(cin == 0) return;
-		fprintf(mFile,"\tsetAttr \".cin[%i]\" %i;\n", cin_i,cin);
+		writeInt(mFile,"\tsetAttr \".cin[",cin_i); writeInt(mFile,"]\" ",cin,";\n");
 	}
 	void setCurveIndices(size_t cin_start,size_t cin_end,int* cin)
 	{
-		fprintf(mFile,"\tsetAttr \".cin[%i:%i]\" ", cin_start,cin_end);
+		writeInt(mFile,"\tsetAttr \".cin[",cin_start); writeInt(mFile,":",cin_end,"]\" ");
 		size_t size = (cin_end-cin_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",cin[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",cin[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCurveIndices(size_t cin_start,size_t cin_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cin[%i:%i]\"",cin_start,cin_end);
+		writeInt(mFile,"\tsetAttr \".cin[",cin_start); writeInt(mFile,":",cin_end,"]\"");
 	}
 	void appendCurveIndices(int cin)const
 	{
-		fprintf(mFile," %i",cin);
+		writeInt(mFile," ",cin);
 	}
 	void endCurveIndices()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintMethod(unsigned int cm)
 	{
 		if(cm == 1) return;
-		fprintf(mFile,"\tsetAttr \".cm\" %i;\n", cm);
+		writeInt(mFile,"\tsetAttr \".cm\" ",cm,";\n");
 	}
 	void setPointMethod(unsigned int pmt)
 	{
 		if(pmt == 0) return;
-		fprintf(mFile,"\tsetAttr \".pmt\" %i;\n", pmt);
+		writeInt(mFile,"\tsetAttr \".pmt\" ",pmt,";\n");
 	}
 	void setStiffness(double stf)
 	{
 		if(stf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".stf\" %f;\n", stf);
+		writeFloat(mFile,"\tsetAttr \".stf\" ",stf,";\n");
 	}
 	void setGlueStrength(double gst)
 	{
 		if(gst == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gst\" %f;\n", gst);
+		writeFloat(mFile,"\tsetAttr \".gst\" ",gst,";\n");
 	}
 	void setUParameter(double upr)
 	{
 		if(upr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".upr\" %f;\n", upr);
+		writeFloat(mFile,"\tsetAttr \".upr\" ",upr,";\n");
 	}
 	void setUDistance(double udi)
 	{
 		if(udi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".udi\" %f;\n", udi);
+		writeFloat(mFile,"\tsetAttr \".udi\" ",udi,";\n");
 	}
 	void getCurveIndices(size_t cin_i)const
 	{
-		fprintf(mFile,"\"%s.cin[%i]\"",mName.c_str(),cin_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cin[",cin_i,"]\"");
 	}
 	void getCurveIndices()const
 	{
 
-		fprintf(mFile,"\"%s.cin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cin\"");
 	}
 	void getConstraintMethod()const
 	{
-		fprintf(mFile,"\"%s.cm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cm\"");
 	}
 	void getPointMethod()const
 	{
-		fprintf(mFile,"\"%s.pmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmt\"");
 	}
 	void getStiffness()const
 	{
-		fprintf(mFile,"\"%s.stf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stf\"");
 	}
 	void getGlueStrength()const
 	{
-		fprintf(mFile,"\"%s.gst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gst\"");
 	}
 	void getUParameter()const
 	{
-		fprintf(mFile,"\"%s.upr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upr\"");
 	}
 	void getUDistance()const
 	{
-		fprintf(mFile,"\"%s.udi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udi\"");
 	}
 	void getOutPin(size_t opn_i)const
 	{
-		fprintf(mFile,"\"%s.opn[%i]\"",mName.c_str(),opn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".opn[",opn_i,"]\"");
 	}
 	void getOutPin()const
 	{
 
-		fprintf(mFile,"\"%s.opn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opn\"");
 	}
 protected:
 	HairConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		unsigned int stiffnessScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", stiffnessScale_Position);
-			fprintf(file,"%f ", stiffnessScale_FloatValue);
-			fprintf(file,"%i", stiffnessScale_Interp);
+			writeFloat(file,"",stiffnessScale_Position," ");
+			writeFloat(file,"",stiffnessScale_FloatValue," ");
+			writeInt(file,"",stiffnessScale_Interp);
 		}
 	};
 	struct AttractionScale{
@@ -34,9 +34,9 @@ public:
 		unsigned int attractionScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", attractionScale_Position);
-			fprintf(file,"%f ", attractionScale_FloatValue);
-			fprintf(file,"%i", attractionScale_Interp);
+			writeFloat(file,"",attractionScale_Position," ");
+			writeFloat(file,"",attractionScale_FloatValue," ");
+			writeInt(file,"",attractionScale_Interp);
 		}
 	};
 	struct ClumpWidthScale{
@@ -45,9 +45,9 @@ public:
 		unsigned int clumpWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", clumpWidthScale_Position);
-			fprintf(file,"%f ", clumpWidthScale_FloatValue);
-			fprintf(file,"%i", clumpWidthScale_Interp);
+			writeFloat(file,"",clumpWidthScale_Position," ");
+			writeFloat(file,"",clumpWidthScale_FloatValue," ");
+			writeInt(file,"",clumpWidthScale_Interp);
 		}
 	};
 	struct ClumpCurl{
@@ -56,9 +56,9 @@ public:
 		unsigned int clumpCurl_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", clumpCurl_Position);
-			fprintf(file,"%f ", clumpCurl_FloatValue);
-			fprintf(file,"%i", clumpCurl_Interp);
+			writeFloat(file,"",clumpCurl_Position," ");
+			writeFloat(file,"",clumpCurl_FloatValue," ");
+			writeInt(file,"",clumpCurl_Interp);
 		}
 	};
 	struct ClumpFlatness{
@@ -67,9 +67,9 @@ public:
 		unsigned int clumpFlatness_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", clumpFlatness_Position);
-			fprintf(file,"%f ", clumpFlatness_FloatValue);
-			fprintf(file,"%i", clumpFlatness_Interp);
+			writeFloat(file,"",clumpFlatness_Position," ");
+			writeFloat(file,"",clumpFlatness_FloatValue," ");
+			writeInt(file,"",clumpFlatness_Interp);
 		}
 	};
 	struct HairWidthScale{
@@ -78,9 +78,9 @@ public:
 		unsigned int hairWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", hairWidthScale_Position);
-			fprintf(file,"%f ", hairWidthScale_FloatValue);
-			fprintf(file,"%i", hairWidthScale_Interp);
+			writeFloat(file,"",hairWidthScale_Position," ");
+			writeFloat(file,"",hairWidthScale_FloatValue," ");
+			writeInt(file,"",hairWidthScale_Interp);
 		}
 	};
 	struct HairColorScale{
@@ -89,10 +89,10 @@ public:
 		unsigned int hairColorScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", hairColorScale_Position);
+			writeFloat(file,"",hairColorScale_Position," ");
 			hairColorScale_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", hairColorScale_Interp);
+			writeString(file," ");
+			writeInt(file,"",hairColorScale_Interp);
 		}
 	};
 	struct DisplacementScale{
@@ -101,9 +101,9 @@ public:
 		unsigned int displacementScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", displacementScale_Position);
-			fprintf(file,"%f ", displacementScale_FloatValue);
-			fprintf(file,"%i", displacementScale_Interp);
+			writeFloat(file,"",displacementScale_Position," ");
+			writeFloat(file,"",displacementScale_FloatValue," ");
+			writeInt(file,"",displacementScale_Interp);
 		}
 	};
 	struct FieldData{
@@ -138,25 +138,25 @@ public:
 		bool miTransparencyReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i", miTransparencyReceive);
+			writeInt(file,"",miOverrideCaustics," ");
+			writeInt(file,"",miCausticAccuracy," ");
+			writeFloat(file,"",miCausticRadius," ");
+			writeInt(file,"",miOverrideGlobalIllumination," ");
+			writeInt(file,"",miGlobillumAccuracy," ");
+			writeFloat(file,"",miGlobillumRadius," ");
+			writeInt(file,"",miOverrideFinalGather," ");
+			writeInt(file,"",miFinalGatherRays," ");
+			writeFloat(file,"",miFinalGatherMinRadius," ");
+			writeFloat(file,"",miFinalGatherMaxRadius," ");
+			writeInt(file,"",miFinalGatherFilter," ");
+			writeInt(file,"",miFinalGatherView," ");
+			writeInt(file,"",miOverrideSamples," ");
+			writeInt(file,"",miMinSamples," ");
+			writeInt(file,"",miMaxSamples," ");
+			writeInt(file,"",miFinalGatherCast," ");
+			writeInt(file,"",miFinalGatherReceive," ");
+			writeInt(file,"",miTransparencyCast," ");
+			writeInt(file,"",miTransparencyReceive);
 		}
 	};
 public:
@@ -169,1715 +169,1715 @@ public:
 	void setSimulationMethod(unsigned int sim)
 	{
 		if(sim == 3) return;
-		fprintf(mFile,"\tsetAttr \".sim\" %i;\n", sim);
+		writeInt(mFile,"\tsetAttr \".sim\" ",sim,";\n");
 	}
 	void setCollide(bool cld)
 	{
 		if(cld == true) return;
-		fprintf(mFile,"\tsetAttr \".cld\" %i;\n", cld);
+		writeInt(mFile,"\tsetAttr \".cld\" ",cld,";\n");
 	}
 	void setCollideOverSample(int cos)
 	{
 		if(cos == 0) return;
-		fprintf(mFile,"\tsetAttr \".cos\" %i;\n", cos);
+		writeInt(mFile,"\tsetAttr \".cos\" ",cos,";\n");
 	}
 	void setSelfCollide(bool scd)
 	{
 		if(scd == false) return;
-		fprintf(mFile,"\tsetAttr \".scd\" %i;\n", scd);
+		writeInt(mFile,"\tsetAttr \".scd\" ",scd,";\n");
 	}
 	void setCollideGround(bool cdg)
 	{
 		if(cdg == false) return;
-		fprintf(mFile,"\tsetAttr \".cdg\" %i;\n", cdg);
+		writeInt(mFile,"\tsetAttr \".cdg\" ",cdg,";\n");
 	}
 	void setGroundHeight(double ghe)
 	{
 		if(ghe == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ghe\" %f;\n", ghe);
+		writeFloat(mFile,"\tsetAttr \".ghe\" ",ghe,";\n");
 	}
 	void setStiffness(double sfn)
 	{
 		if(sfn == 0.15) return;
-		fprintf(mFile,"\tsetAttr \".sfn\" %f;\n", sfn);
+		writeFloat(mFile,"\tsetAttr \".sfn\" ",sfn,";\n");
 	}
 	void setStiffnessScale(size_t sts_i,const StiffnessScale& sts)
 	{
-		fprintf(mFile,"\tsetAttr \".sts[%i]\" ",sts_i);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_i,"]\" ");
 		sts.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStiffnessScale(size_t sts_start,size_t sts_end,StiffnessScale* sts)
 	{
-		fprintf(mFile,"\tsetAttr \".sts[%i:%i]\" ", sts_start,sts_end);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_start); writeInt(mFile,":",sts_end,"]\" ");
 		size_t size = (sts_end-sts_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			sts[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startStiffnessScale(size_t sts_start,size_t sts_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sts[%i:%i]\"",sts_start,sts_end);
-		fprintf(mFile," -type \"StiffnessScale\" ");
+		writeInt(mFile,"\tsetAttr \".sts[",sts_start); writeInt(mFile,":",sts_end,"]\"");
+		writeString(mFile," -type \"StiffnessScale\" ");
 	}
 	void appendStiffnessScale(const StiffnessScale& sts)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		sts.write(mFile);
 	}
 	void endStiffnessScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStiffnessScale_Position(size_t sts_i,float stsp)
 	{
 		if(stsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sts[%i].stsp\" %f;\n", sts_i,stsp);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_i); writeFloat(mFile,"].stsp\" ",stsp,";\n");
 	}
 	void setStiffnessScale_FloatValue(size_t sts_i,float stsfv)
 	{
 		if(stsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sts[%i].stsfv\" %f;\n", sts_i,stsfv);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_i); writeFloat(mFile,"].stsfv\" ",stsfv,";\n");
 	}
 	void setStiffnessScale_Interp(size_t sts_i,unsigned int stsi)
 	{
 		if(stsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".sts[%i].stsi\" %i;\n", sts_i,stsi);
+		writeInt(mFile,"\tsetAttr \".sts[",sts_i); writeInt(mFile,"].stsi\" ",stsi,";\n");
 	}
 	void setLengthFlex(double lfx)
 	{
 		if(lfx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lfx\" %f;\n", lfx);
+		writeFloat(mFile,"\tsetAttr \".lfx\" ",lfx,";\n");
 	}
 	void setDamp(double dmp)
 	{
 		if(dmp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dmp\" %f;\n", dmp);
+		writeFloat(mFile,"\tsetAttr \".dmp\" ",dmp,";\n");
 	}
 	void setDrag(double drg)
 	{
 		if(drg == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".drg\" %f;\n", drg);
+		writeFloat(mFile,"\tsetAttr \".drg\" ",drg,";\n");
 	}
 	void setFriction(double frc)
 	{
 		if(frc == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".frc\" %f;\n", frc);
+		writeFloat(mFile,"\tsetAttr \".frc\" ",frc,";\n");
 	}
 	void setMass(double mss)
 	{
 		if(mss == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mss\" %f;\n", mss);
+		writeFloat(mFile,"\tsetAttr \".mss\" ",mss,";\n");
 	}
 	void setDynamicsWeight(double dw)
 	{
 		if(dw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dw\" %f;\n", dw);
+		writeFloat(mFile,"\tsetAttr \".dw\" ",dw,";\n");
 	}
 	void setCollideWidthOffset(double wid)
 	{
 		if(wid == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wid\" %f;\n", wid);
+		writeFloat(mFile,"\tsetAttr \".wid\" ",wid,";\n");
 	}
 	void setStaticCling(double stc)
 	{
 		if(stc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".stc\" %f;\n", stc);
+		writeFloat(mFile,"\tsetAttr \".stc\" ",stc,";\n");
 	}
 	void setRepulsion(double rpl)
 	{
 		if(rpl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".rpl\" %f;\n", rpl);
+		writeFloat(mFile,"\tsetAttr \".rpl\" ",rpl,";\n");
 	}
 	void setNumCollideNeighbors(int ncn)
 	{
 		if(ncn == 4) return;
-		fprintf(mFile,"\tsetAttr \".ncn\" %i;\n", ncn);
+		writeInt(mFile,"\tsetAttr \".ncn\" ",ncn,";\n");
 	}
 	void setIterations(int itr)
 	{
 		if(itr == 4) return;
-		fprintf(mFile,"\tsetAttr \".itr\" %i;\n", itr);
+		writeInt(mFile,"\tsetAttr \".itr\" ",itr,";\n");
 	}
 	void setDrawCollideWidth(bool dwd)
 	{
 		if(dwd == false) return;
-		fprintf(mFile,"\tsetAttr \".dwd\" %i;\n", dwd);
+		writeInt(mFile,"\tsetAttr \".dwd\" ",dwd,";\n");
 	}
 	void setWidthDrawSkip(int wds)
 	{
 		if(wds == 2) return;
-		fprintf(mFile,"\tsetAttr \".wds\" %i;\n", wds);
+		writeInt(mFile,"\tsetAttr \".wds\" ",wds,";\n");
 	}
 	void setGravity(double grv)
 	{
 		if(grv == 0.98) return;
-		fprintf(mFile,"\tsetAttr \".grv\" %f;\n", grv);
+		writeFloat(mFile,"\tsetAttr \".grv\" ",grv,";\n");
 	}
 	void setTurbulenceStrength(double tst)
 	{
 		if(tst == 0) return;
-		fprintf(mFile,"\tsetAttr \".tst\" %f;\n", tst);
+		writeFloat(mFile,"\tsetAttr \".tst\" ",tst,";\n");
 	}
 	void setTurbulenceFrequency(double tfr)
 	{
 		if(tfr == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".tfr\" %f;\n", tfr);
+		writeFloat(mFile,"\tsetAttr \".tfr\" ",tfr,";\n");
 	}
 	void setTurbulenceSpeed(double tbs)
 	{
 		if(tbs == .2) return;
-		fprintf(mFile,"\tsetAttr \".tbs\" %f;\n", tbs);
+		writeFloat(mFile,"\tsetAttr \".tbs\" ",tbs,";\n");
 	}
 	void setAttractionDamp(double ad)
 	{
 		if(ad == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ad\" %f;\n", ad);
+		writeFloat(mFile,"\tsetAttr \".ad\" ",ad,";\n");
 	}
 	void setStartCurveAttract(double sct)
 	{
 		if(sct == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sct\" %f;\n", sct);
+		writeFloat(mFile,"\tsetAttr \".sct\" ",sct,";\n");
 	}
 	void setAttractionScale(size_t ats_i,const AttractionScale& ats)
 	{
-		fprintf(mFile,"\tsetAttr \".ats[%i]\" ",ats_i);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i,"]\" ");
 		ats.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttractionScale(size_t ats_start,size_t ats_end,AttractionScale* ats)
 	{
-		fprintf(mFile,"\tsetAttr \".ats[%i:%i]\" ", ats_start,ats_end);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_start); writeInt(mFile,":",ats_end,"]\" ");
 		size_t size = (ats_end-ats_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ats[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startAttractionScale(size_t ats_start,size_t ats_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ats[%i:%i]\"",ats_start,ats_end);
-		fprintf(mFile," -type \"AttractionScale\" ");
+		writeInt(mFile,"\tsetAttr \".ats[",ats_start); writeInt(mFile,":",ats_end,"]\"");
+		writeString(mFile," -type \"AttractionScale\" ");
 	}
 	void appendAttractionScale(const AttractionScale& ats)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ats.write(mFile);
 	}
 	void endAttractionScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttractionScale_Position(size_t ats_i,float atsp)
 	{
 		if(atsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ats[%i].atsp\" %f;\n", ats_i,atsp);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i); writeFloat(mFile,"].atsp\" ",atsp,";\n");
 	}
 	void setAttractionScale_FloatValue(size_t ats_i,float atsfv)
 	{
 		if(atsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ats[%i].atsfv\" %f;\n", ats_i,atsfv);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i); writeFloat(mFile,"].atsfv\" ",atsfv,";\n");
 	}
 	void setAttractionScale_Interp(size_t ats_i,unsigned int atsi)
 	{
 		if(atsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".ats[%i].atsi\" %i;\n", ats_i,atsi);
+		writeInt(mFile,"\tsetAttr \".ats[",ats_i); writeInt(mFile,"].atsi\" ",atsi,";\n");
 	}
 	void setMotionDrag(double mdg)
 	{
 		if(mdg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mdg\" %f;\n", mdg);
+		writeFloat(mFile,"\tsetAttr \".mdg\" ",mdg,";\n");
 	}
 	void setDisplayQuality(double dpq)
 	{
 		if(dpq == 100.0) return;
-		fprintf(mFile,"\tsetAttr \".dpq\" %f;\n", dpq);
+		writeFloat(mFile,"\tsetAttr \".dpq\" ",dpq,";\n");
 	}
 	void setNoStretch(bool nst)
 	{
 		if(nst == false) return;
-		fprintf(mFile,"\tsetAttr \".nst\" %i;\n", nst);
+		writeInt(mFile,"\tsetAttr \".nst\" ",nst,";\n");
 	}
 	void setSubSegments(int ssg)
 	{
 		if(ssg == 0) return;
-		fprintf(mFile,"\tsetAttr \".ssg\" %i;\n", ssg);
+		writeInt(mFile,"\tsetAttr \".ssg\" ",ssg,";\n");
 	}
 	void setClumpWidth(double cwd)
 	{
 		if(cwd == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".cwd\" %f;\n", cwd);
+		writeFloat(mFile,"\tsetAttr \".cwd\" ",cwd,";\n");
 	}
 	void setClumpWidthScale(size_t cws_i,const ClumpWidthScale& cws)
 	{
-		fprintf(mFile,"\tsetAttr \".cws[%i]\" ",cws_i);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_i,"]\" ");
 		cws.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpWidthScale(size_t cws_start,size_t cws_end,ClumpWidthScale* cws)
 	{
-		fprintf(mFile,"\tsetAttr \".cws[%i:%i]\" ", cws_start,cws_end);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_start); writeInt(mFile,":",cws_end,"]\" ");
 		size_t size = (cws_end-cws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cws[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClumpWidthScale(size_t cws_start,size_t cws_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cws[%i:%i]\"",cws_start,cws_end);
-		fprintf(mFile," -type \"ClumpWidthScale\" ");
+		writeInt(mFile,"\tsetAttr \".cws[",cws_start); writeInt(mFile,":",cws_end,"]\"");
+		writeString(mFile," -type \"ClumpWidthScale\" ");
 	}
 	void appendClumpWidthScale(const ClumpWidthScale& cws)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cws.write(mFile);
 	}
 	void endClumpWidthScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpWidthScale_Position(size_t cws_i,float cwsp)
 	{
 		if(cwsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cws[%i].cwsp\" %f;\n", cws_i,cwsp);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_i); writeFloat(mFile,"].cwsp\" ",cwsp,";\n");
 	}
 	void setClumpWidthScale_FloatValue(size_t cws_i,float cwsfv)
 	{
 		if(cwsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cws[%i].cwsfv\" %f;\n", cws_i,cwsfv);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_i); writeFloat(mFile,"].cwsfv\" ",cwsfv,";\n");
 	}
 	void setClumpWidthScale_Interp(size_t cws_i,unsigned int cwsi)
 	{
 		if(cwsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".cws[%i].cwsi\" %i;\n", cws_i,cwsi);
+		writeInt(mFile,"\tsetAttr \".cws[",cws_i); writeInt(mFile,"].cwsi\" ",cwsi,";\n");
 	}
 	void setClumpTwist(double ctw)
 	{
 		if(ctw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ctw\" %f;\n", ctw);
+		writeFloat(mFile,"\tsetAttr \".ctw\" ",ctw,";\n");
 	}
 	void setClumpCurl(size_t clc_i,const ClumpCurl& clc)
 	{
-		fprintf(mFile,"\tsetAttr \".clc[%i]\" ",clc_i);
+		writeInt(mFile,"\tsetAttr \".clc[",clc_i,"]\" ");
 		clc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpCurl(size_t clc_start,size_t clc_end,ClumpCurl* clc)
 	{
-		fprintf(mFile,"\tsetAttr \".clc[%i:%i]\" ", clc_start,clc_end);
+		writeInt(mFile,"\tsetAttr \".clc[",clc_start); writeInt(mFile,":",clc_end,"]\" ");
 		size_t size = (clc_end-clc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			clc[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClumpCurl(size_t clc_start,size_t clc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".clc[%i:%i]\"",clc_start,clc_end);
-		fprintf(mFile," -type \"ClumpCurl\" ");
+		writeInt(mFile,"\tsetAttr \".clc[",clc_start); writeInt(mFile,":",clc_end,"]\"");
+		writeString(mFile," -type \"ClumpCurl\" ");
 	}
 	void appendClumpCurl(const ClumpCurl& clc)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		clc.write(mFile);
 	}
 	void endClumpCurl()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpCurl_Position(size_t clc_i,float clcp)
 	{
 		if(clcp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clc[%i].clcp\" %f;\n", clc_i,clcp);
+		writeInt(mFile,"\tsetAttr \".clc[",clc_i); writeFloat(mFile,"].clcp\" ",clcp,";\n");
 	}
 	void setClumpCurl_FloatValue(size_t clc_i,float clcfv)
 	{
 		if(clcfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clc[%i].clcfv\" %f;\n", clc_i,clcfv);
+		writeInt(mFile,"\tsetAttr \".clc[",clc_i); writeFloat(mFile,"].clcfv\" ",clcfv,";\n");
 	}
 	void setClumpCurl_Interp(size_t clc_i,unsigned int clci)
 	{
 		if(clci == 0) return;
-		fprintf(mFile,"\tsetAttr \".clc[%i].clci\" %i;\n", clc_i,clci);
+		writeInt(mFile,"\tsetAttr \".clc[",clc_i); writeInt(mFile,"].clci\" ",clci,";\n");
 	}
 	void setClumpFlatness(size_t cfl_i,const ClumpFlatness& cfl)
 	{
-		fprintf(mFile,"\tsetAttr \".cfl[%i]\" ",cfl_i);
+		writeInt(mFile,"\tsetAttr \".cfl[",cfl_i,"]\" ");
 		cfl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpFlatness(size_t cfl_start,size_t cfl_end,ClumpFlatness* cfl)
 	{
-		fprintf(mFile,"\tsetAttr \".cfl[%i:%i]\" ", cfl_start,cfl_end);
+		writeInt(mFile,"\tsetAttr \".cfl[",cfl_start); writeInt(mFile,":",cfl_end,"]\" ");
 		size_t size = (cfl_end-cfl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cfl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startClumpFlatness(size_t cfl_start,size_t cfl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cfl[%i:%i]\"",cfl_start,cfl_end);
-		fprintf(mFile," -type \"ClumpFlatness\" ");
+		writeInt(mFile,"\tsetAttr \".cfl[",cfl_start); writeInt(mFile,":",cfl_end,"]\"");
+		writeString(mFile," -type \"ClumpFlatness\" ");
 	}
 	void appendClumpFlatness(const ClumpFlatness& cfl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cfl.write(mFile);
 	}
 	void endClumpFlatness()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClumpFlatness_Position(size_t cfl_i,float cflp)
 	{
 		if(cflp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfl[%i].cflp\" %f;\n", cfl_i,cflp);
+		writeInt(mFile,"\tsetAttr \".cfl[",cfl_i); writeFloat(mFile,"].cflp\" ",cflp,";\n");
 	}
 	void setClumpFlatness_FloatValue(size_t cfl_i,float cflfv)
 	{
 		if(cflfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cfl[%i].cflfv\" %f;\n", cfl_i,cflfv);
+		writeInt(mFile,"\tsetAttr \".cfl[",cfl_i); writeFloat(mFile,"].cflfv\" ",cflfv,";\n");
 	}
 	void setClumpFlatness_Interp(size_t cfl_i,unsigned int cfli)
 	{
 		if(cfli == 0) return;
-		fprintf(mFile,"\tsetAttr \".cfl[%i].cfli\" %i;\n", cfl_i,cfli);
+		writeInt(mFile,"\tsetAttr \".cfl[",cfl_i); writeInt(mFile,"].cfli\" ",cfli,";\n");
 	}
 	void setBendFollow(double bnf)
 	{
 		if(bnf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bnf\" %f;\n", bnf);
+		writeFloat(mFile,"\tsetAttr \".bnf\" ",bnf,";\n");
 	}
 	void setHairWidth(double hwd)
 	{
 		if(hwd == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".hwd\" %f;\n", hwd);
+		writeFloat(mFile,"\tsetAttr \".hwd\" ",hwd,";\n");
 	}
 	void setHairWidthScale(size_t hws_i,const HairWidthScale& hws)
 	{
-		fprintf(mFile,"\tsetAttr \".hws[%i]\" ",hws_i);
+		writeInt(mFile,"\tsetAttr \".hws[",hws_i,"]\" ");
 		hws.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHairWidthScale(size_t hws_start,size_t hws_end,HairWidthScale* hws)
 	{
-		fprintf(mFile,"\tsetAttr \".hws[%i:%i]\" ", hws_start,hws_end);
+		writeInt(mFile,"\tsetAttr \".hws[",hws_start); writeInt(mFile,":",hws_end,"]\" ");
 		size_t size = (hws_end-hws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			hws[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startHairWidthScale(size_t hws_start,size_t hws_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".hws[%i:%i]\"",hws_start,hws_end);
-		fprintf(mFile," -type \"HairWidthScale\" ");
+		writeInt(mFile,"\tsetAttr \".hws[",hws_start); writeInt(mFile,":",hws_end,"]\"");
+		writeString(mFile," -type \"HairWidthScale\" ");
 	}
 	void appendHairWidthScale(const HairWidthScale& hws)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		hws.write(mFile);
 	}
 	void endHairWidthScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHairWidthScale_Position(size_t hws_i,float hwsp)
 	{
 		if(hwsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hws[%i].hwsp\" %f;\n", hws_i,hwsp);
+		writeInt(mFile,"\tsetAttr \".hws[",hws_i); writeFloat(mFile,"].hwsp\" ",hwsp,";\n");
 	}
 	void setHairWidthScale_FloatValue(size_t hws_i,float hwsfv)
 	{
 		if(hwsfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hws[%i].hwsfv\" %f;\n", hws_i,hwsfv);
+		writeInt(mFile,"\tsetAttr \".hws[",hws_i); writeFloat(mFile,"].hwsfv\" ",hwsfv,";\n");
 	}
 	void setHairWidthScale_Interp(size_t hws_i,unsigned int hwsi)
 	{
 		if(hwsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".hws[%i].hwsi\" %i;\n", hws_i,hwsi);
+		writeInt(mFile,"\tsetAttr \".hws[",hws_i); writeInt(mFile,"].hwsi\" ",hwsi,";\n");
 	}
 	void setBaldnessMap(double bmp)
 	{
 		if(bmp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bmp\" %f;\n", bmp);
+		writeFloat(mFile,"\tsetAttr \".bmp\" ",bmp,";\n");
 	}
 	void setOpacity(double opc)
 	{
 		if(opc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".opc\" %f;\n", opc);
+		writeFloat(mFile,"\tsetAttr \".opc\" ",opc,";\n");
 	}
 	void setHairColor(const float3& hcl)
 	{
-		fprintf(mFile,"\tsetAttr \".hcl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".hcl\" -type \"float3\" ");
 		hcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHairColorR(float hcr)
 	{
 		if(hcr == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".hcl.hcr\" %f;\n", hcr);
+		writeFloat(mFile,"\tsetAttr \".hcl.hcr\" ",hcr,";\n");
 	}
 	void setHairColorG(float hcg)
 	{
 		if(hcg == 0.25) return;
-		fprintf(mFile,"\tsetAttr \".hcl.hcg\" %f;\n", hcg);
+		writeFloat(mFile,"\tsetAttr \".hcl.hcg\" ",hcg,";\n");
 	}
 	void setHairColorB(float hcb)
 	{
 		if(hcb == 0.15) return;
-		fprintf(mFile,"\tsetAttr \".hcl.hcb\" %f;\n", hcb);
+		writeFloat(mFile,"\tsetAttr \".hcl.hcb\" ",hcb,";\n");
 	}
 	void setHairColorScale(size_t hcs_i,const HairColorScale& hcs)
 	{
-		fprintf(mFile,"\tsetAttr \".hcs[%i]\" ",hcs_i);
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_i,"]\" ");
 		hcs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHairColorScale(size_t hcs_start,size_t hcs_end,HairColorScale* hcs)
 	{
-		fprintf(mFile,"\tsetAttr \".hcs[%i:%i]\" ", hcs_start,hcs_end);
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_start); writeInt(mFile,":",hcs_end,"]\" ");
 		size_t size = (hcs_end-hcs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			hcs[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startHairColorScale(size_t hcs_start,size_t hcs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".hcs[%i:%i]\"",hcs_start,hcs_end);
-		fprintf(mFile," -type \"HairColorScale\" ");
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_start); writeInt(mFile,":",hcs_end,"]\"");
+		writeString(mFile," -type \"HairColorScale\" ");
 	}
 	void appendHairColorScale(const HairColorScale& hcs)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		hcs.write(mFile);
 	}
 	void endHairColorScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHairColorScale_Position(size_t hcs_i,float hcsp)
 	{
 		if(hcsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hcs[%i].hcsp\" %f;\n", hcs_i,hcsp);
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_i); writeFloat(mFile,"].hcsp\" ",hcsp,";\n");
 	}
 	void setHairColorScale_Color(size_t hcs_i,const float3& hcsc)
 	{
-		fprintf(mFile,"\tsetAttr \".hcs[%i].hcsc\" -type \"float3\" ",hcs_i);
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_i,"].hcsc\" -type \"float3\" ");
 		hcsc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHairColorScale_ColorR(size_t hcs_i,float hcscr)
 	{
 		if(hcscr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hcs[%i].hcsc.hcscr\" %f;\n", hcs_i,hcscr);
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_i); writeFloat(mFile,"].hcsc.hcscr\" ",hcscr,";\n");
 	}
 	void setHairColorScale_ColorG(size_t hcs_i,float hcscg)
 	{
 		if(hcscg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hcs[%i].hcsc.hcscg\" %f;\n", hcs_i,hcscg);
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_i); writeFloat(mFile,"].hcsc.hcscg\" ",hcscg,";\n");
 	}
 	void setHairColorScale_ColorB(size_t hcs_i,float hcscb)
 	{
 		if(hcscb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hcs[%i].hcsc.hcscb\" %f;\n", hcs_i,hcscb);
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_i); writeFloat(mFile,"].hcsc.hcscb\" ",hcscb,";\n");
 	}
 	void setHairColorScale_Interp(size_t hcs_i,unsigned int hcsi)
 	{
 		if(hcsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".hcs[%i].hcsi\" %i;\n", hcs_i,hcsi);
+		writeInt(mFile,"\tsetAttr \".hcs[",hcs_i); writeInt(mFile,"].hcsi\" ",hcsi,";\n");
 	}
 	void setHairsPerClump(int hpc)
 	{
 		if(hpc == 10) return;
-		fprintf(mFile,"\tsetAttr \".hpc\" %i;\n", hpc);
+		writeInt(mFile,"\tsetAttr \".hpc\" ",hpc,";\n");
 	}
 	void setThinning(double thn)
 	{
 		if(thn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".thn\" %f;\n", thn);
+		writeFloat(mFile,"\tsetAttr \".thn\" ",thn,";\n");
 	}
 	void setTranslucence(double tlc)
 	{
 		if(tlc == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tlc\" %f;\n", tlc);
+		writeFloat(mFile,"\tsetAttr \".tlc\" ",tlc,";\n");
 	}
 	void setSpecularColor(const float3& spc)
 	{
-		fprintf(mFile,"\tsetAttr \".spc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".spc\" -type \"float3\" ");
 		spc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColorR(float spr)
 	{
 		if(spr == 0.35) return;
-		fprintf(mFile,"\tsetAttr \".spc.spr\" %f;\n", spr);
+		writeFloat(mFile,"\tsetAttr \".spc.spr\" ",spr,";\n");
 	}
 	void setSpecularColorG(float spg)
 	{
 		if(spg == 0.35) return;
-		fprintf(mFile,"\tsetAttr \".spc.spg\" %f;\n", spg);
+		writeFloat(mFile,"\tsetAttr \".spc.spg\" ",spg,";\n");
 	}
 	void setSpecularColorB(float spb)
 	{
 		if(spb == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".spc.spb\" %f;\n", spb);
+		writeFloat(mFile,"\tsetAttr \".spc.spb\" ",spb,";\n");
 	}
 	void setSpecularPower(double spp)
 	{
 		if(spp == 3.0) return;
-		fprintf(mFile,"\tsetAttr \".spp\" %f;\n", spp);
+		writeFloat(mFile,"\tsetAttr \".spp\" ",spp,";\n");
 	}
 	void setCastShadows(bool csd)
 	{
 		if(csd == true) return;
-		fprintf(mFile,"\tsetAttr \".csd\" %i;\n", csd);
+		writeInt(mFile,"\tsetAttr \".csd\" ",csd,";\n");
 	}
 	void setDiffuseRand(double dfr)
 	{
 		if(dfr == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".dfr\" %f;\n", dfr);
+		writeFloat(mFile,"\tsetAttr \".dfr\" ",dfr,";\n");
 	}
 	void setSpecularRand(double sra)
 	{
 		if(sra == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".sra\" %f;\n", sra);
+		writeFloat(mFile,"\tsetAttr \".sra\" ",sra,";\n");
 	}
 	void setHueRand(double chr)
 	{
 		if(chr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".chr\" %f;\n", chr);
+		writeFloat(mFile,"\tsetAttr \".chr\" ",chr,";\n");
 	}
 	void setSatRand(double csr)
 	{
 		if(csr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".csr\" %f;\n", csr);
+		writeFloat(mFile,"\tsetAttr \".csr\" ",csr,";\n");
 	}
 	void setValRand(double cvr)
 	{
 		if(cvr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cvr\" %f;\n", cvr);
+		writeFloat(mFile,"\tsetAttr \".cvr\" ",cvr,";\n");
 	}
 	void setMultiStreaks(int mst)
 	{
 		if(mst == 0) return;
-		fprintf(mFile,"\tsetAttr \".mst\" %i;\n", mst);
+		writeInt(mFile,"\tsetAttr \".mst\" ",mst,";\n");
 	}
 	void setMultiStreakSpread1(double ms1)
 	{
 		if(ms1 == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".ms1\" %f;\n", ms1);
+		writeFloat(mFile,"\tsetAttr \".ms1\" ",ms1,";\n");
 	}
 	void setMultiStreakSpread2(double ms2)
 	{
 		if(ms2 == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".ms2\" %f;\n", ms2);
+		writeFloat(mFile,"\tsetAttr \".ms2\" ",ms2,";\n");
 	}
 	void setLightEachHair(bool leh)
 	{
 		if(leh == false) return;
-		fprintf(mFile,"\tsetAttr \".leh\" %i;\n", leh);
+		writeInt(mFile,"\tsetAttr \".leh\" ",leh,";\n");
 	}
 	void setDisplacementScale(size_t dsc_i,const DisplacementScale& dsc)
 	{
-		fprintf(mFile,"\tsetAttr \".dsc[%i]\" ",dsc_i);
+		writeInt(mFile,"\tsetAttr \".dsc[",dsc_i,"]\" ");
 		dsc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplacementScale(size_t dsc_start,size_t dsc_end,DisplacementScale* dsc)
 	{
-		fprintf(mFile,"\tsetAttr \".dsc[%i:%i]\" ", dsc_start,dsc_end);
+		writeInt(mFile,"\tsetAttr \".dsc[",dsc_start); writeInt(mFile,":",dsc_end,"]\" ");
 		size_t size = (dsc_end-dsc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			dsc[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDisplacementScale(size_t dsc_start,size_t dsc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".dsc[%i:%i]\"",dsc_start,dsc_end);
-		fprintf(mFile," -type \"DisplacementScale\" ");
+		writeInt(mFile,"\tsetAttr \".dsc[",dsc_start); writeInt(mFile,":",dsc_end,"]\"");
+		writeString(mFile," -type \"DisplacementScale\" ");
 	}
 	void appendDisplacementScale(const DisplacementScale& dsc)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		dsc.write(mFile);
 	}
 	void endDisplacementScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplacementScale_Position(size_t dsc_i,float dscp)
 	{
 		if(dscp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dsc[%i].dscp\" %f;\n", dsc_i,dscp);
+		writeInt(mFile,"\tsetAttr \".dsc[",dsc_i); writeFloat(mFile,"].dscp\" ",dscp,";\n");
 	}
 	void setDisplacementScale_FloatValue(size_t dsc_i,float dscfv)
 	{
 		if(dscfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dsc[%i].dscfv\" %f;\n", dsc_i,dscfv);
+		writeInt(mFile,"\tsetAttr \".dsc[",dsc_i); writeFloat(mFile,"].dscfv\" ",dscfv,";\n");
 	}
 	void setDisplacementScale_Interp(size_t dsc_i,unsigned int dsci)
 	{
 		if(dsci == 0) return;
-		fprintf(mFile,"\tsetAttr \".dsc[%i].dsci\" %i;\n", dsc_i,dsci);
+		writeInt(mFile,"\tsetAttr \".dsc[",dsc_i); writeInt(mFile,"].dsci\" ",dsci,";\n");
 	}
 	void setCurl(double crl)
 	{
 		if(crl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crl\" %f;\n", crl);
+		writeFloat(mFile,"\tsetAttr \".crl\" ",crl,";\n");
 	}
 	void setCurlFrequency(double crf)
 	{
 		if(crf == 10) return;
-		fprintf(mFile,"\tsetAttr \".crf\" %f;\n", crf);
+		writeFloat(mFile,"\tsetAttr \".crf\" ",crf,";\n");
 	}
 	void setNoiseMethod(unsigned int nmt)
 	{
 		if(nmt == 0) return;
-		fprintf(mFile,"\tsetAttr \".nmt\" %i;\n", nmt);
+		writeInt(mFile,"\tsetAttr \".nmt\" ",nmt,";\n");
 	}
 	void setNoise(double noi)
 	{
 		if(noi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".noi\" %f;\n", noi);
+		writeFloat(mFile,"\tsetAttr \".noi\" ",noi,";\n");
 	}
 	void setDetailNoise(double dno)
 	{
 		if(dno == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dno\" %f;\n", dno);
+		writeFloat(mFile,"\tsetAttr \".dno\" ",dno,";\n");
 	}
 	void setNoiseFrequency(double nof)
 	{
 		if(nof == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".nof\" %f;\n", nof);
+		writeFloat(mFile,"\tsetAttr \".nof\" ",nof,";\n");
 	}
 	void setNoiseFrequencyU(double nfu)
 	{
 		if(nfu == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nfu\" %f;\n", nfu);
+		writeFloat(mFile,"\tsetAttr \".nfu\" ",nfu,";\n");
 	}
 	void setNoiseFrequencyV(double nfv)
 	{
 		if(nfv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nfv\" %f;\n", nfv);
+		writeFloat(mFile,"\tsetAttr \".nfv\" ",nfv,";\n");
 	}
 	void setNoiseFrequencyW(double nfw)
 	{
 		if(nfw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nfw\" %f;\n", nfw);
+		writeFloat(mFile,"\tsetAttr \".nfw\" ",nfw,";\n");
 	}
 	void setSubClumpMethod(unsigned int scm)
 	{
 		if(scm == 0) return;
-		fprintf(mFile,"\tsetAttr \".scm\" %i;\n", scm);
+		writeInt(mFile,"\tsetAttr \".scm\" ",scm,";\n");
 	}
 	void setSubClumping(double scp)
 	{
 		if(scp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scp\" %f;\n", scp);
+		writeFloat(mFile,"\tsetAttr \".scp\" ",scp,";\n");
 	}
 	void setSubClumpRand(double scr)
 	{
 		if(scr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scr\" %f;\n", scr);
+		writeFloat(mFile,"\tsetAttr \".scr\" ",scr,";\n");
 	}
 	void setNumUClumps(double nuc)
 	{
 		if(nuc == 15.0) return;
-		fprintf(mFile,"\tsetAttr \".nuc\" %f;\n", nuc);
+		writeFloat(mFile,"\tsetAttr \".nuc\" ",nuc,";\n");
 	}
 	void setNumVClumps(double nvc)
 	{
 		if(nvc == 15.0) return;
-		fprintf(mFile,"\tsetAttr \".nvc\" %f;\n", nvc);
+		writeFloat(mFile,"\tsetAttr \".nvc\" ",nvc,";\n");
 	}
 	void setClumpInterpolation(double cin)
 	{
 		if(cin == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cin\" %f;\n", cin);
+		writeFloat(mFile,"\tsetAttr \".cin\" ",cin,";\n");
 	}
 	void setInterpolationRange(double inr)
 	{
 		if(inr == 8.0) return;
-		fprintf(mFile,"\tsetAttr \".inr\" %f;\n", inr);
+		writeFloat(mFile,"\tsetAttr \".inr\" ",inr,";\n");
 	}
 	void setStartFrame(double stf)
 	{
 		if(stf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".stf\" %f;\n", stf);
+		writeFloat(mFile,"\tsetAttr \".stf\" ",stf,";\n");
 	}
 	void setUsePre70ForceIntensity(bool upfi)
 	{
 		if(upfi == false) return;
-		fprintf(mFile,"\tsetAttr \".upfi\" %i;\n", upfi);
+		writeInt(mFile,"\tsetAttr \".upfi\" ",upfi,";\n");
 	}
 	void setReceiveShadows(bool rcsh)
 	{
 		if(rcsh == true) return;
-		fprintf(mFile,"\tsetAttr \".rcsh\" %i;\n", rcsh);
+		writeInt(mFile,"\tsetAttr \".rcsh\" ",rcsh,";\n");
 	}
 	void setVisibleInReflections(bool vir)
 	{
 		if(vir == false) return;
-		fprintf(mFile,"\tsetAttr \".vir\" %i;\n", vir);
+		writeInt(mFile,"\tsetAttr \".vir\" ",vir,";\n");
 	}
 	void setVisibleInRefractions(bool vif)
 	{
 		if(vif == false) return;
-		fprintf(mFile,"\tsetAttr \".vif\" %i;\n", vif);
+		writeInt(mFile,"\tsetAttr \".vif\" ",vif,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiOverrideCaustics(bool oca)
 	{
 		if(oca == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oca\" %i;\n", oca);
+		writeInt(mFile,"\tsetAttr \".mrc.oca\" ",oca,";\n");
 	}
 	void setMiCausticAccuracy(short caa)
 	{
 		if(caa == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.caa\" %i;\n", caa);
+		writeInt(mFile,"\tsetAttr \".mrc.caa\" ",caa,";\n");
 	}
 	void setMiCausticRadius(float car)
 	{
 		if(car == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.car\" %f;\n", car);
+		writeFloat(mFile,"\tsetAttr \".mrc.car\" ",car,";\n");
 	}
 	void setMiOverrideGlobalIllumination(bool ogi)
 	{
 		if(ogi == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ogi\" %i;\n", ogi);
+		writeInt(mFile,"\tsetAttr \".mrc.ogi\" ",ogi,";\n");
 	}
 	void setMiGlobillumAccuracy(short gia)
 	{
 		if(gia == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gia\" %i;\n", gia);
+		writeInt(mFile,"\tsetAttr \".mrc.gia\" ",gia,";\n");
 	}
 	void setMiGlobillumRadius(float gir)
 	{
 		if(gir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gir\" %f;\n", gir);
+		writeFloat(mFile,"\tsetAttr \".mrc.gir\" ",gir,";\n");
 	}
 	void setMiOverrideFinalGather(bool ofg)
 	{
 		if(ofg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ofg\" %i;\n", ofg);
+		writeInt(mFile,"\tsetAttr \".mrc.ofg\" ",ofg,";\n");
 	}
 	void setMiFinalGatherRays(int fry)
 	{
 		if(fry == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fry\" %i;\n", fry);
+		writeInt(mFile,"\tsetAttr \".mrc.fry\" ",fry,";\n");
 	}
 	void setMiFinalGatherMinRadius(float fmn)
 	{
 		if(fmn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmn\" %f;\n", fmn);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmn\" ",fmn,";\n");
 	}
 	void setMiFinalGatherMaxRadius(float fmx)
 	{
 		if(fmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmx\" %f;\n", fmx);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmx\" ",fmx,";\n");
 	}
 	void setMiFinalGatherFilter(short ffi)
 	{
 		if(ffi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ffi\" %i;\n", ffi);
+		writeInt(mFile,"\tsetAttr \".mrc.ffi\" ",ffi,";\n");
 	}
 	void setMiFinalGatherView(bool fgv)
 	{
 		if(fgv == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgv\" %i;\n", fgv);
+		writeInt(mFile,"\tsetAttr \".mrc.fgv\" ",fgv,";\n");
 	}
 	void setMiOverrideSamples(bool oos)
 	{
 		if(oos == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oos\" %i;\n", oos);
+		writeInt(mFile,"\tsetAttr \".mrc.oos\" ",oos,";\n");
 	}
 	void setMiMinSamples(short mins)
 	{
 		if(mins == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mins\" %i;\n", mins);
+		writeInt(mFile,"\tsetAttr \".mrc.mins\" ",mins,";\n");
 	}
 	void setMiMaxSamples(short maxs)
 	{
 		if(maxs == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.maxs\" %i;\n", maxs);
+		writeInt(mFile,"\tsetAttr \".mrc.maxs\" ",maxs,";\n");
 	}
 	void setMiFinalGatherCast(bool fgc)
 	{
 		if(fgc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgc\" %i;\n", fgc);
+		writeInt(mFile,"\tsetAttr \".mrc.fgc\" ",fgc,";\n");
 	}
 	void setMiFinalGatherReceive(bool fge)
 	{
 		if(fge == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fge\" %i;\n", fge);
+		writeInt(mFile,"\tsetAttr \".mrc.fge\" ",fge,";\n");
 	}
 	void setMiTransparencyCast(bool tpc)
 	{
 		if(tpc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpc\" %i;\n", tpc);
+		writeInt(mFile,"\tsetAttr \".mrc.tpc\" ",tpc,";\n");
 	}
 	void setMiTransparencyReceive(bool tpr)
 	{
 		if(tpr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpr\" %i;\n", tpr);
+		writeInt(mFile,"\tsetAttr \".mrc.tpr\" ",tpr,";\n");
 	}
 	void setOutputHair(size_t oh_i,const vectorArray& oh)
 	{
 		if(oh.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".oh[%i]\" -type \"vectorArray\" ",oh_i);
+		writeInt(mFile,"\tsetAttr \".oh[",oh_i,"]\" -type \"vectorArray\" ");
 		oh.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutputHair(size_t oh_start,size_t oh_end,vectorArray* oh)
 	{
-		fprintf(mFile,"\tsetAttr \".oh[%i:%i]\" ", oh_start,oh_end);
+		writeInt(mFile,"\tsetAttr \".oh[",oh_start); writeInt(mFile,":",oh_end,"]\" ");
 		size_t size = (oh_end-oh_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			oh[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startOutputHair(size_t oh_start,size_t oh_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".oh[%i:%i]\"",oh_start,oh_end);
-		fprintf(mFile," -type \"vectorArray\" ");
+		writeInt(mFile,"\tsetAttr \".oh[",oh_start); writeInt(mFile,":",oh_end,"]\"");
+		writeString(mFile," -type \"vectorArray\" ");
 	}
 	void appendOutputHair(const vectorArray& oh)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		oh.write(mFile);
 	}
 	void endOutputHair()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getSimulationMethod()const
 	{
-		fprintf(mFile,"\"%s.sim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sim\"");
 	}
 	void getInputHair(size_t ih_i)const
 	{
-		fprintf(mFile,"\"%s.ih[%i]\"",mName.c_str(),ih_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ih[",ih_i,"]\"");
 	}
 	void getInputHair()const
 	{
 
-		fprintf(mFile,"\"%s.ih\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ih\"");
 	}
 	void getInputHairPin(size_t ihp_i)const
 	{
-		fprintf(mFile,"\"%s.ihp[%i]\"",mName.c_str(),ihp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ihp[",ihp_i,"]\"");
 	}
 	void getInputHairPin()const
 	{
 
-		fprintf(mFile,"\"%s.ihp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ihp\"");
 	}
 	void getCollide()const
 	{
-		fprintf(mFile,"\"%s.cld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cld\"");
 	}
 	void getCollideOverSample()const
 	{
-		fprintf(mFile,"\"%s.cos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cos\"");
 	}
 	void getSelfCollide()const
 	{
-		fprintf(mFile,"\"%s.scd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scd\"");
 	}
 	void getCollideGround()const
 	{
-		fprintf(mFile,"\"%s.cdg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdg\"");
 	}
 	void getGroundHeight()const
 	{
-		fprintf(mFile,"\"%s.ghe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ghe\"");
 	}
 	void getStiffness()const
 	{
-		fprintf(mFile,"\"%s.sfn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sfn\"");
 	}
 	void getStiffnessScale(size_t sts_i)const
 	{
-		fprintf(mFile,"\"%s.sts[%i]\"",mName.c_str(),sts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sts[",sts_i,"]\"");
 	}
 	void getStiffnessScale()const
 	{
 
-		fprintf(mFile,"\"%s.sts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts\"");
 	}
 	void getStiffnessScale_Position(size_t sts_i)const
 	{
-		fprintf(mFile,"\"%s.sts[%i].stsp\"",mName.c_str(),sts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sts[",sts_i,"].stsp\"");
 	}
 	void getStiffnessScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.sts.stsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts.stsp\"");
 	}
 	void getStiffnessScale_FloatValue(size_t sts_i)const
 	{
-		fprintf(mFile,"\"%s.sts[%i].stsfv\"",mName.c_str(),sts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sts[",sts_i,"].stsfv\"");
 	}
 	void getStiffnessScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.sts.stsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts.stsfv\"");
 	}
 	void getStiffnessScale_Interp(size_t sts_i)const
 	{
-		fprintf(mFile,"\"%s.sts[%i].stsi\"",mName.c_str(),sts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sts[",sts_i,"].stsi\"");
 	}
 	void getStiffnessScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.sts.stsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts.stsi\"");
 	}
 	void getLengthFlex()const
 	{
-		fprintf(mFile,"\"%s.lfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfx\"");
 	}
 	void getDamp()const
 	{
-		fprintf(mFile,"\"%s.dmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmp\"");
 	}
 	void getDrag()const
 	{
-		fprintf(mFile,"\"%s.drg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drg\"");
 	}
 	void getFriction()const
 	{
-		fprintf(mFile,"\"%s.frc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frc\"");
 	}
 	void getMass()const
 	{
-		fprintf(mFile,"\"%s.mss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mss\"");
 	}
 	void getDynamicsWeight()const
 	{
-		fprintf(mFile,"\"%s.dw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dw\"");
 	}
 	void getCollideWidthOffset()const
 	{
-		fprintf(mFile,"\"%s.wid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wid\"");
 	}
 	void getStaticCling()const
 	{
-		fprintf(mFile,"\"%s.stc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stc\"");
 	}
 	void getRepulsion()const
 	{
-		fprintf(mFile,"\"%s.rpl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpl\"");
 	}
 	void getNumCollideNeighbors()const
 	{
-		fprintf(mFile,"\"%s.ncn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ncn\"");
 	}
 	void getIterations()const
 	{
-		fprintf(mFile,"\"%s.itr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itr\"");
 	}
 	void getDrawCollideWidth()const
 	{
-		fprintf(mFile,"\"%s.dwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwd\"");
 	}
 	void getWidthDrawSkip()const
 	{
-		fprintf(mFile,"\"%s.wds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wds\"");
 	}
 	void getGravity()const
 	{
-		fprintf(mFile,"\"%s.grv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grv\"");
 	}
 	void getTurbulenceStrength()const
 	{
-		fprintf(mFile,"\"%s.tst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tst\"");
 	}
 	void getTurbulenceFrequency()const
 	{
-		fprintf(mFile,"\"%s.tfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tfr\"");
 	}
 	void getTurbulenceSpeed()const
 	{
-		fprintf(mFile,"\"%s.tbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tbs\"");
 	}
 	void getAttractionDamp()const
 	{
-		fprintf(mFile,"\"%s.ad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ad\"");
 	}
 	void getStartCurveAttract()const
 	{
-		fprintf(mFile,"\"%s.sct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sct\"");
 	}
 	void getAttractionScale(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i]\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"]\"");
 	}
 	void getAttractionScale()const
 	{
 
-		fprintf(mFile,"\"%s.ats\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats\"");
 	}
 	void getAttractionScale_Position(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i].atsp\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"].atsp\"");
 	}
 	void getAttractionScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.ats.atsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats.atsp\"");
 	}
 	void getAttractionScale_FloatValue(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i].atsfv\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"].atsfv\"");
 	}
 	void getAttractionScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.ats.atsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats.atsfv\"");
 	}
 	void getAttractionScale_Interp(size_t ats_i)const
 	{
-		fprintf(mFile,"\"%s.ats[%i].atsi\"",mName.c_str(),ats_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ats[",ats_i,"].atsi\"");
 	}
 	void getAttractionScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.ats.atsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ats.atsi\"");
 	}
 	void getMotionDrag()const
 	{
-		fprintf(mFile,"\"%s.mdg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mdg\"");
 	}
 	void getDisplayQuality()const
 	{
-		fprintf(mFile,"\"%s.dpq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpq\"");
 	}
 	void getNoStretch()const
 	{
-		fprintf(mFile,"\"%s.nst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nst\"");
 	}
 	void getSubSegments()const
 	{
-		fprintf(mFile,"\"%s.ssg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssg\"");
 	}
 	void getClumpWidth()const
 	{
-		fprintf(mFile,"\"%s.cwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwd\"");
 	}
 	void getClumpWidthScale(size_t cws_i)const
 	{
-		fprintf(mFile,"\"%s.cws[%i]\"",mName.c_str(),cws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cws[",cws_i,"]\"");
 	}
 	void getClumpWidthScale()const
 	{
 
-		fprintf(mFile,"\"%s.cws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws\"");
 	}
 	void getClumpWidthScale_Position(size_t cws_i)const
 	{
-		fprintf(mFile,"\"%s.cws[%i].cwsp\"",mName.c_str(),cws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cws[",cws_i,"].cwsp\"");
 	}
 	void getClumpWidthScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cws.cwsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws.cwsp\"");
 	}
 	void getClumpWidthScale_FloatValue(size_t cws_i)const
 	{
-		fprintf(mFile,"\"%s.cws[%i].cwsfv\"",mName.c_str(),cws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cws[",cws_i,"].cwsfv\"");
 	}
 	void getClumpWidthScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.cws.cwsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws.cwsfv\"");
 	}
 	void getClumpWidthScale_Interp(size_t cws_i)const
 	{
-		fprintf(mFile,"\"%s.cws[%i].cwsi\"",mName.c_str(),cws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cws[",cws_i,"].cwsi\"");
 	}
 	void getClumpWidthScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cws.cwsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cws.cwsi\"");
 	}
 	void getClumpTwist()const
 	{
-		fprintf(mFile,"\"%s.ctw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctw\"");
 	}
 	void getClumpCurl(size_t clc_i)const
 	{
-		fprintf(mFile,"\"%s.clc[%i]\"",mName.c_str(),clc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clc[",clc_i,"]\"");
 	}
 	void getClumpCurl()const
 	{
 
-		fprintf(mFile,"\"%s.clc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clc\"");
 	}
 	void getClumpCurl_Position(size_t clc_i)const
 	{
-		fprintf(mFile,"\"%s.clc[%i].clcp\"",mName.c_str(),clc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clc[",clc_i,"].clcp\"");
 	}
 	void getClumpCurl_Position()const
 	{
 
-		fprintf(mFile,"\"%s.clc.clcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clc.clcp\"");
 	}
 	void getClumpCurl_FloatValue(size_t clc_i)const
 	{
-		fprintf(mFile,"\"%s.clc[%i].clcfv\"",mName.c_str(),clc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clc[",clc_i,"].clcfv\"");
 	}
 	void getClumpCurl_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.clc.clcfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clc.clcfv\"");
 	}
 	void getClumpCurl_Interp(size_t clc_i)const
 	{
-		fprintf(mFile,"\"%s.clc[%i].clci\"",mName.c_str(),clc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clc[",clc_i,"].clci\"");
 	}
 	void getClumpCurl_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.clc.clci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clc.clci\"");
 	}
 	void getClumpFlatness(size_t cfl_i)const
 	{
-		fprintf(mFile,"\"%s.cfl[%i]\"",mName.c_str(),cfl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cfl[",cfl_i,"]\"");
 	}
 	void getClumpFlatness()const
 	{
 
-		fprintf(mFile,"\"%s.cfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfl\"");
 	}
 	void getClumpFlatness_Position(size_t cfl_i)const
 	{
-		fprintf(mFile,"\"%s.cfl[%i].cflp\"",mName.c_str(),cfl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cfl[",cfl_i,"].cflp\"");
 	}
 	void getClumpFlatness_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cfl.cflp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfl.cflp\"");
 	}
 	void getClumpFlatness_FloatValue(size_t cfl_i)const
 	{
-		fprintf(mFile,"\"%s.cfl[%i].cflfv\"",mName.c_str(),cfl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cfl[",cfl_i,"].cflfv\"");
 	}
 	void getClumpFlatness_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.cfl.cflfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfl.cflfv\"");
 	}
 	void getClumpFlatness_Interp(size_t cfl_i)const
 	{
-		fprintf(mFile,"\"%s.cfl[%i].cfli\"",mName.c_str(),cfl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cfl[",cfl_i,"].cfli\"");
 	}
 	void getClumpFlatness_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cfl.cfli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfl.cfli\"");
 	}
 	void getBendFollow()const
 	{
-		fprintf(mFile,"\"%s.bnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bnf\"");
 	}
 	void getHairWidth()const
 	{
-		fprintf(mFile,"\"%s.hwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hwd\"");
 	}
 	void getHairWidthScale(size_t hws_i)const
 	{
-		fprintf(mFile,"\"%s.hws[%i]\"",mName.c_str(),hws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hws[",hws_i,"]\"");
 	}
 	void getHairWidthScale()const
 	{
 
-		fprintf(mFile,"\"%s.hws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws\"");
 	}
 	void getHairWidthScale_Position(size_t hws_i)const
 	{
-		fprintf(mFile,"\"%s.hws[%i].hwsp\"",mName.c_str(),hws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hws[",hws_i,"].hwsp\"");
 	}
 	void getHairWidthScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.hws.hwsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwsp\"");
 	}
 	void getHairWidthScale_FloatValue(size_t hws_i)const
 	{
-		fprintf(mFile,"\"%s.hws[%i].hwsfv\"",mName.c_str(),hws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hws[",hws_i,"].hwsfv\"");
 	}
 	void getHairWidthScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.hws.hwsfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwsfv\"");
 	}
 	void getHairWidthScale_Interp(size_t hws_i)const
 	{
-		fprintf(mFile,"\"%s.hws[%i].hwsi\"",mName.c_str(),hws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hws[",hws_i,"].hwsi\"");
 	}
 	void getHairWidthScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.hws.hwsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwsi\"");
 	}
 	void getBaldnessMap()const
 	{
-		fprintf(mFile,"\"%s.bmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmp\"");
 	}
 	void getOpacity()const
 	{
-		fprintf(mFile,"\"%s.opc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opc\"");
 	}
 	void getHairColor()const
 	{
-		fprintf(mFile,"\"%s.hcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcl\"");
 	}
 	void getHairColorR()const
 	{
-		fprintf(mFile,"\"%s.hcl.hcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcl.hcr\"");
 	}
 	void getHairColorG()const
 	{
-		fprintf(mFile,"\"%s.hcl.hcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcl.hcg\"");
 	}
 	void getHairColorB()const
 	{
-		fprintf(mFile,"\"%s.hcl.hcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcl.hcb\"");
 	}
 	void getHairColorScale(size_t hcs_i)const
 	{
-		fprintf(mFile,"\"%s.hcs[%i]\"",mName.c_str(),hcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hcs[",hcs_i,"]\"");
 	}
 	void getHairColorScale()const
 	{
 
-		fprintf(mFile,"\"%s.hcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcs\"");
 	}
 	void getHairColorScale_Position(size_t hcs_i)const
 	{
-		fprintf(mFile,"\"%s.hcs[%i].hcsp\"",mName.c_str(),hcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hcs[",hcs_i,"].hcsp\"");
 	}
 	void getHairColorScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.hcs.hcsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcs.hcsp\"");
 	}
 	void getHairColorScale_Color(size_t hcs_i)const
 	{
-		fprintf(mFile,"\"%s.hcs[%i].hcsc\"",mName.c_str(),hcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hcs[",hcs_i,"].hcsc\"");
 	}
 	void getHairColorScale_Color()const
 	{
 
-		fprintf(mFile,"\"%s.hcs.hcsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcs.hcsc\"");
 	}
 	void getHairColorScale_ColorR(size_t hcs_i)const
 	{
-		fprintf(mFile,"\"%s.hcs[%i].hcsc.hcscr\"",mName.c_str(),hcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hcs[",hcs_i,"].hcsc.hcscr\"");
 	}
 	void getHairColorScale_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.hcs.hcsc.hcscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcs.hcsc.hcscr\"");
 	}
 	void getHairColorScale_ColorG(size_t hcs_i)const
 	{
-		fprintf(mFile,"\"%s.hcs[%i].hcsc.hcscg\"",mName.c_str(),hcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hcs[",hcs_i,"].hcsc.hcscg\"");
 	}
 	void getHairColorScale_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.hcs.hcsc.hcscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcs.hcsc.hcscg\"");
 	}
 	void getHairColorScale_ColorB(size_t hcs_i)const
 	{
-		fprintf(mFile,"\"%s.hcs[%i].hcsc.hcscb\"",mName.c_str(),hcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hcs[",hcs_i,"].hcsc.hcscb\"");
 	}
 	void getHairColorScale_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.hcs.hcsc.hcscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcs.hcsc.hcscb\"");
 	}
 	void getHairColorScale_Interp(size_t hcs_i)const
 	{
-		fprintf(mFile,"\"%s.hcs[%i].hcsi\"",mName.c_str(),hcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hcs[",hcs_i,"].hcsi\"");
 	}
 	void getHairColorScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.hcs.hcsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcs.hcsi\"");
 	}
 	void getHairsPerClump()const
 	{
-		fprintf(mFile,"\"%s.hpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hpc\"");
 	}
 	void getThinning()const
 	{
-		fprintf(mFile,"\"%s.thn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".thn\"");
 	}
 	void getTranslucence()const
 	{
-		fprintf(mFile,"\"%s.tlc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlc\"");
 	}
 	void getSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.spc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc\"");
 	}
 	void getSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.spc.spr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spr\"");
 	}
 	void getSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.spc.spg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spg\"");
 	}
 	void getSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.spc.spb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spc.spb\"");
 	}
 	void getSpecularPower()const
 	{
-		fprintf(mFile,"\"%s.spp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spp\"");
 	}
 	void getCastShadows()const
 	{
-		fprintf(mFile,"\"%s.csd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csd\"");
 	}
 	void getDiffuseRand()const
 	{
-		fprintf(mFile,"\"%s.dfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfr\"");
 	}
 	void getSpecularRand()const
 	{
-		fprintf(mFile,"\"%s.sra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sra\"");
 	}
 	void getHueRand()const
 	{
-		fprintf(mFile,"\"%s.chr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chr\"");
 	}
 	void getSatRand()const
 	{
-		fprintf(mFile,"\"%s.csr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csr\"");
 	}
 	void getValRand()const
 	{
-		fprintf(mFile,"\"%s.cvr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cvr\"");
 	}
 	void getMultiStreaks()const
 	{
-		fprintf(mFile,"\"%s.mst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mst\"");
 	}
 	void getMultiStreakSpread1()const
 	{
-		fprintf(mFile,"\"%s.ms1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ms1\"");
 	}
 	void getMultiStreakSpread2()const
 	{
-		fprintf(mFile,"\"%s.ms2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ms2\"");
 	}
 	void getLightEachHair()const
 	{
-		fprintf(mFile,"\"%s.leh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".leh\"");
 	}
 	void getDisplacementScale(size_t dsc_i)const
 	{
-		fprintf(mFile,"\"%s.dsc[%i]\"",mName.c_str(),dsc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dsc[",dsc_i,"]\"");
 	}
 	void getDisplacementScale()const
 	{
 
-		fprintf(mFile,"\"%s.dsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsc\"");
 	}
 	void getDisplacementScale_Position(size_t dsc_i)const
 	{
-		fprintf(mFile,"\"%s.dsc[%i].dscp\"",mName.c_str(),dsc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dsc[",dsc_i,"].dscp\"");
 	}
 	void getDisplacementScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.dsc.dscp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsc.dscp\"");
 	}
 	void getDisplacementScale_FloatValue(size_t dsc_i)const
 	{
-		fprintf(mFile,"\"%s.dsc[%i].dscfv\"",mName.c_str(),dsc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dsc[",dsc_i,"].dscfv\"");
 	}
 	void getDisplacementScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.dsc.dscfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsc.dscfv\"");
 	}
 	void getDisplacementScale_Interp(size_t dsc_i)const
 	{
-		fprintf(mFile,"\"%s.dsc[%i].dsci\"",mName.c_str(),dsc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dsc[",dsc_i,"].dsci\"");
 	}
 	void getDisplacementScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.dsc.dsci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsc.dsci\"");
 	}
 	void getCurl()const
 	{
-		fprintf(mFile,"\"%s.crl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crl\"");
 	}
 	void getCurlFrequency()const
 	{
-		fprintf(mFile,"\"%s.crf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crf\"");
 	}
 	void getNoiseMethod()const
 	{
-		fprintf(mFile,"\"%s.nmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nmt\"");
 	}
 	void getNoise()const
 	{
-		fprintf(mFile,"\"%s.noi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".noi\"");
 	}
 	void getDetailNoise()const
 	{
-		fprintf(mFile,"\"%s.dno\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dno\"");
 	}
 	void getNoiseFrequency()const
 	{
-		fprintf(mFile,"\"%s.nof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nof\"");
 	}
 	void getNoiseFrequencyU()const
 	{
-		fprintf(mFile,"\"%s.nfu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nfu\"");
 	}
 	void getNoiseFrequencyV()const
 	{
-		fprintf(mFile,"\"%s.nfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nfv\"");
 	}
 	void getNoiseFrequencyW()const
 	{
-		fprintf(mFile,"\"%s.nfw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nfw\"");
 	}
 	void getSubClumpMethod()const
 	{
-		fprintf(mFile,"\"%s.scm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scm\"");
 	}
 	void getSubClumping()const
 	{
-		fprintf(mFile,"\"%s.scp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scp\"");
 	}
 	void getSubClumpRand()const
 	{
-		fprintf(mFile,"\"%s.scr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scr\"");
 	}
 	void getNumUClumps()const
 	{
-		fprintf(mFile,"\"%s.nuc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nuc\"");
 	}
 	void getNumVClumps()const
 	{
-		fprintf(mFile,"\"%s.nvc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nvc\"");
 	}
 	void getClumpInterpolation()const
 	{
-		fprintf(mFile,"\"%s.cin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cin\"");
 	}
 	void getInterpolationRange()const
 	{
-		fprintf(mFile,"\"%s.inr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inr\"");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.cti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cti\"");
 	}
 	void getStartTime()const
 	{
-		fprintf(mFile,"\"%s.sti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sti\"");
 	}
 	void getStartFrame()const
 	{
-		fprintf(mFile,"\"%s.stf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stf\"");
 	}
 	void getInputForce(size_t ifc_i)const
 	{
-		fprintf(mFile,"\"%s.ifc[%i]\"",mName.c_str(),ifc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ifc[",ifc_i,"]\"");
 	}
 	void getInputForce()const
 	{
 
-		fprintf(mFile,"\"%s.ifc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ifc\"");
 	}
 	void getFieldData()const
 	{
-		fprintf(mFile,"\"%s.fd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd\"");
 	}
 	void getFieldDataPosition()const
 	{
-		fprintf(mFile,"\"%s.fd.fdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdp\"");
 	}
 	void getFieldDataVelocity()const
 	{
-		fprintf(mFile,"\"%s.fd.fdv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdv\"");
 	}
 	void getFieldDataMass()const
 	{
-		fprintf(mFile,"\"%s.fd.fdm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdm\"");
 	}
 	void getFieldDataDeltaTime()const
 	{
-		fprintf(mFile,"\"%s.fd.fdt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdt\"");
 	}
 	void getUsePre70ForceIntensity()const
 	{
-		fprintf(mFile,"\"%s.upfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upfi\"");
 	}
 	void getCollisionData()const
 	{
-		fprintf(mFile,"\"%s.cda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cda\"");
 	}
 	void getCollisionGeometry(size_t cge_i)const
 	{
-		fprintf(mFile,"\"%s.cda.cge[%i]\"",mName.c_str(),cge_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.cge[",cge_i,"]\"");
 	}
 	void getCollisionResilience(size_t crs_i)const
 	{
-		fprintf(mFile,"\"%s.cda.crs[%i]\"",mName.c_str(),crs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.crs[",crs_i,"]\"");
 	}
 	void getCollisionFriction(size_t cfr_i)const
 	{
-		fprintf(mFile,"\"%s.cda.cfr[%i]\"",mName.c_str(),cfr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.cfr[",cfr_i,"]\"");
 	}
 	void getDiskCache()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getReceiveShadows()const
 	{
-		fprintf(mFile,"\"%s.rcsh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcsh\"");
 	}
 	void getVisibleInReflections()const
 	{
-		fprintf(mFile,"\"%s.vir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vir\"");
 	}
 	void getVisibleInRefractions()const
 	{
-		fprintf(mFile,"\"%s.vif\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vif\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiOverrideCaustics()const
 	{
-		fprintf(mFile,"\"%s.mrc.oca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oca\"");
 	}
 	void getMiCausticAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.caa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.caa\"");
 	}
 	void getMiCausticRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.car\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.car\"");
 	}
 	void getMiOverrideGlobalIllumination()const
 	{
-		fprintf(mFile,"\"%s.mrc.ogi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ogi\"");
 	}
 	void getMiGlobillumAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.gia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gia\"");
 	}
 	void getMiGlobillumRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.gir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gir\"");
 	}
 	void getMiOverrideFinalGather()const
 	{
-		fprintf(mFile,"\"%s.mrc.ofg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ofg\"");
 	}
 	void getMiFinalGatherRays()const
 	{
-		fprintf(mFile,"\"%s.mrc.fry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fry\"");
 	}
 	void getMiFinalGatherMinRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmn\"");
 	}
 	void getMiFinalGatherMaxRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmx\"");
 	}
 	void getMiFinalGatherFilter()const
 	{
-		fprintf(mFile,"\"%s.mrc.ffi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ffi\"");
 	}
 	void getMiFinalGatherView()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgv\"");
 	}
 	void getMiOverrideSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.oos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oos\"");
 	}
 	void getMiMinSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.mins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mins\"");
 	}
 	void getMiMaxSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.maxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.maxs\"");
 	}
 	void getMiFinalGatherCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgc\"");
 	}
 	void getMiFinalGatherReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.fge\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fge\"");
 	}
 	void getMiTransparencyCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpc\"");
 	}
 	void getMiTransparencyReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpr\"");
 	}
 	void getOutputHair(size_t oh_i)const
 	{
-		fprintf(mFile,"\"%s.oh[%i]\"",mName.c_str(),oh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oh[",oh_i,"]\"");
 	}
 	void getOutputHair()const
 	{
 
-		fprintf(mFile,"\"%s.oh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oh\"");
 	}
 	void getOutputRenderHairs()const
 	{
-		fprintf(mFile,"\"%s.orh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".orh\"");
 	}
 protected:
 	HairSystem(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,10 +23,10 @@ public:
 		unsigned int colorScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", colorScale_Position);
+			writeFloat(file,"",colorScale_Position," ");
 			colorScale_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", colorScale_Interp);
+			writeString(file," ");
+			writeInt(file,"",colorScale_Interp);
 		}
 	};
 public:
@@ -39,307 +39,307 @@ public:
 	void setTubeDirection(unsigned int tdr)
 	{
 		if(tdr == 0) return;
-		fprintf(mFile,"\tsetAttr \".tdr\" %i;\n", tdr);
+		writeInt(mFile,"\tsetAttr \".tdr\" ",tdr,";\n");
 	}
 	void setColorScale(size_t cls_i,const ColorScale& cls)
 	{
-		fprintf(mFile,"\tsetAttr \".cls[%i]\" ",cls_i);
+		writeInt(mFile,"\tsetAttr \".cls[",cls_i,"]\" ");
 		cls.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorScale(size_t cls_start,size_t cls_end,ColorScale* cls)
 	{
-		fprintf(mFile,"\tsetAttr \".cls[%i:%i]\" ", cls_start,cls_end);
+		writeInt(mFile,"\tsetAttr \".cls[",cls_start); writeInt(mFile,":",cls_end,"]\" ");
 		size_t size = (cls_end-cls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cls[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColorScale(size_t cls_start,size_t cls_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cls[%i:%i]\"",cls_start,cls_end);
-		fprintf(mFile," -type \"ColorScale\" ");
+		writeInt(mFile,"\tsetAttr \".cls[",cls_start); writeInt(mFile,":",cls_end,"]\"");
+		writeString(mFile," -type \"ColorScale\" ");
 	}
 	void appendColorScale(const ColorScale& cls)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cls.write(mFile);
 	}
 	void endColorScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorScale_Position(size_t cls_i,float clsp)
 	{
 		if(clsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cls[%i].clsp\" %f;\n", cls_i,clsp);
+		writeInt(mFile,"\tsetAttr \".cls[",cls_i); writeFloat(mFile,"].clsp\" ",clsp,";\n");
 	}
 	void setColorScale_Color(size_t cls_i,const float3& clsc)
 	{
-		fprintf(mFile,"\tsetAttr \".cls[%i].clsc\" -type \"float3\" ",cls_i);
+		writeInt(mFile,"\tsetAttr \".cls[",cls_i,"].clsc\" -type \"float3\" ");
 		clsc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorScale_ColorR(size_t cls_i,float clscr)
 	{
 		if(clscr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cls[%i].clsc.clscr\" %f;\n", cls_i,clscr);
+		writeInt(mFile,"\tsetAttr \".cls[",cls_i); writeFloat(mFile,"].clsc.clscr\" ",clscr,";\n");
 	}
 	void setColorScale_ColorG(size_t cls_i,float clscg)
 	{
 		if(clscg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cls[%i].clsc.clscg\" %f;\n", cls_i,clscg);
+		writeInt(mFile,"\tsetAttr \".cls[",cls_i); writeFloat(mFile,"].clsc.clscg\" ",clscg,";\n");
 	}
 	void setColorScale_ColorB(size_t cls_i,float clscb)
 	{
 		if(clscb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cls[%i].clsc.clscb\" %f;\n", cls_i,clscb);
+		writeInt(mFile,"\tsetAttr \".cls[",cls_i); writeFloat(mFile,"].clsc.clscb\" ",clscb,";\n");
 	}
 	void setColorScale_Interp(size_t cls_i,unsigned int clsi)
 	{
 		if(clsi == 0) return;
-		fprintf(mFile,"\tsetAttr \".cls[%i].clsi\" %i;\n", cls_i,clsi);
+		writeInt(mFile,"\tsetAttr \".cls[",cls_i); writeInt(mFile,"].clsi\" ",clsi,";\n");
 	}
 	void setSpecularPower(float sp)
 	{
 		if(sp == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".sp\" %f;\n", sp);
+		writeFloat(mFile,"\tsetAttr \".sp\" ",sp,";\n");
 	}
 	void setSpecularShift(float ssh)
 	{
 		if(ssh == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".ssh\" %f;\n", ssh);
+		writeFloat(mFile,"\tsetAttr \".ssh\" ",ssh,";\n");
 	}
 	void setScatterPower(float scp)
 	{
 		if(scp == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".scp\" %f;\n", scp);
+		writeFloat(mFile,"\tsetAttr \".scp\" ",scp,";\n");
 	}
 	void setScatter(float sct)
 	{
 		if(sct == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".sct\" %f;\n", sct);
+		writeFloat(mFile,"\tsetAttr \".sct\" ",sct,";\n");
 	}
 	void setMiReflectionBlur(float mircb)
 	{
 		if(mircb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mircb\" %f;\n", mircb);
+		writeFloat(mFile,"\tsetAttr \".mircb\" ",mircb,";\n");
 	}
 	void setMiReflectionRays(short mircr)
 	{
 		if(mircr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mircr\" %i;\n", mircr);
+		writeInt(mFile,"\tsetAttr \".mircr\" ",mircr,";\n");
 	}
 	void setMiAngle(float mia)
 	{
 		if(mia == 0) return;
-		fprintf(mFile,"\tsetAttr \".mia\" %f;\n", mia);
+		writeFloat(mFile,"\tsetAttr \".mia\" ",mia,";\n");
 	}
 	void setMiSpreadX(float misx)
 	{
 		if(misx == 10) return;
-		fprintf(mFile,"\tsetAttr \".misx\" %f;\n", misx);
+		writeFloat(mFile,"\tsetAttr \".misx\" ",misx,";\n");
 	}
 	void setMiSpreadY(float misy)
 	{
 		if(misy == 5) return;
-		fprintf(mFile,"\tsetAttr \".misy\" %f;\n", misy);
+		writeFloat(mFile,"\tsetAttr \".misy\" ",misy,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void getTangentUCamera()const
 	{
-		fprintf(mFile,"\"%s.utan\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utan\"");
 	}
 	void getTangentUCameraX()const
 	{
-		fprintf(mFile,"\"%s.utan.utnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utan.utnx\"");
 	}
 	void getTangentUCameraY()const
 	{
-		fprintf(mFile,"\"%s.utan.utny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utan.utny\"");
 	}
 	void getTangentUCameraZ()const
 	{
-		fprintf(mFile,"\"%s.utan.utnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utan.utnz\"");
 	}
 	void getTangentVCamera()const
 	{
-		fprintf(mFile,"\"%s.vtan\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtan\"");
 	}
 	void getTangentVCameraX()const
 	{
-		fprintf(mFile,"\"%s.vtan.vtnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtan.vtnx\"");
 	}
 	void getTangentVCameraY()const
 	{
-		fprintf(mFile,"\"%s.vtan.vtny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtan.vtny\"");
 	}
 	void getTangentVCameraZ()const
 	{
-		fprintf(mFile,"\"%s.vtan.vtnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtan.vtnz\"");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.uvu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.uvu\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.uvv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.uvv\"");
 	}
 	void getTubeDirection()const
 	{
-		fprintf(mFile,"\"%s.tdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tdr\"");
 	}
 	void getColorScale(size_t cls_i)const
 	{
-		fprintf(mFile,"\"%s.cls[%i]\"",mName.c_str(),cls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cls[",cls_i,"]\"");
 	}
 	void getColorScale()const
 	{
 
-		fprintf(mFile,"\"%s.cls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cls\"");
 	}
 	void getColorScale_Position(size_t cls_i)const
 	{
-		fprintf(mFile,"\"%s.cls[%i].clsp\"",mName.c_str(),cls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cls[",cls_i,"].clsp\"");
 	}
 	void getColorScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cls.clsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cls.clsp\"");
 	}
 	void getColorScale_Color(size_t cls_i)const
 	{
-		fprintf(mFile,"\"%s.cls[%i].clsc\"",mName.c_str(),cls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cls[",cls_i,"].clsc\"");
 	}
 	void getColorScale_Color()const
 	{
 
-		fprintf(mFile,"\"%s.cls.clsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cls.clsc\"");
 	}
 	void getColorScale_ColorR(size_t cls_i)const
 	{
-		fprintf(mFile,"\"%s.cls[%i].clsc.clscr\"",mName.c_str(),cls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cls[",cls_i,"].clsc.clscr\"");
 	}
 	void getColorScale_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.cls.clsc.clscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cls.clsc.clscr\"");
 	}
 	void getColorScale_ColorG(size_t cls_i)const
 	{
-		fprintf(mFile,"\"%s.cls[%i].clsc.clscg\"",mName.c_str(),cls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cls[",cls_i,"].clsc.clscg\"");
 	}
 	void getColorScale_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.cls.clsc.clscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cls.clsc.clscg\"");
 	}
 	void getColorScale_ColorB(size_t cls_i)const
 	{
-		fprintf(mFile,"\"%s.cls[%i].clsc.clscb\"",mName.c_str(),cls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cls[",cls_i,"].clsc.clscb\"");
 	}
 	void getColorScale_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.cls.clsc.clscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cls.clsc.clscb\"");
 	}
 	void getColorScale_Interp(size_t cls_i)const
 	{
-		fprintf(mFile,"\"%s.cls[%i].clsi\"",mName.c_str(),cls_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cls[",cls_i,"].clsi\"");
 	}
 	void getColorScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cls.clsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cls.clsi\"");
 	}
 	void getSpecularPower()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getSpecularShift()const
 	{
-		fprintf(mFile,"\"%s.ssh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssh\"");
 	}
 	void getScatterPower()const
 	{
-		fprintf(mFile,"\"%s.scp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scp\"");
 	}
 	void getScatter()const
 	{
-		fprintf(mFile,"\"%s.sct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sct\"");
 	}
 	void getMiReflectionBlur()const
 	{
-		fprintf(mFile,"\"%s.mircb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircb\"");
 	}
 	void getMiReflectionRays()const
 	{
-		fprintf(mFile,"\"%s.mircr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircr\"");
 	}
 	void getMiAngle()const
 	{
-		fprintf(mFile,"\"%s.mia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mia\"");
 	}
 	void getMiSpreadX()const
 	{
-		fprintf(mFile,"\"%s.misx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misx\"");
 	}
 	void getMiSpreadY()const
 	{
-		fprintf(mFile,"\"%s.misy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misy\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 protected:
 	HairTubeShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,56 +27,56 @@ public:
 	void setIndex(size_t i_i,int i_)
 	{
 		if(i_ == 0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i]\" %i;\n", i_i,i_);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeInt(mFile,"]\" ",i_,";\n");
 	}
 	void setIndex(size_t i_start,size_t i_end,int* i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\" ");
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",i_[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",i_[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startIndex(size_t i_start,size_t i_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\"",i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\"");
 	}
 	void appendIndex(int i)const
 	{
-		fprintf(mFile," %i",i);
+		writeInt(mFile," ",i);
 	}
 	void endIndex()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMultiplicity(int m)
 	{
 		if(m == -1) return;
-		fprintf(mFile,"\tsetAttr \".m\" %i;\n", m);
+		writeInt(mFile,"\tsetAttr \".m\" ",m,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getIndex(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getIndex()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getMultiplicity()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	HardenPoint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,299 +27,299 @@ public:
 	void setColorTextureResolution(int ctrs)
 	{
 		if(ctrs == 128) return;
-		fprintf(mFile,"\tsetAttr \".ctrs\" %i;\n", ctrs);
+		writeInt(mFile,"\tsetAttr \".ctrs\" ",ctrs,";\n");
 	}
 	void setBumpTextureResolution(int btrs)
 	{
 		if(btrs == 256) return;
-		fprintf(mFile,"\tsetAttr \".btrs\" %i;\n", btrs);
+		writeInt(mFile,"\tsetAttr \".btrs\" ",btrs,";\n");
 	}
 	void setFrameBufferFormat(unsigned int fbfm)
 	{
 		if(fbfm == 0) return;
-		fprintf(mFile,"\tsetAttr \".fbfm\" %i;\n", fbfm);
+		writeInt(mFile,"\tsetAttr \".fbfm\" ",fbfm,";\n");
 	}
 	void setEnableHighQualityLighting(bool ehql)
 	{
 		if(ehql == true) return;
-		fprintf(mFile,"\tsetAttr \".ehql\" %i;\n", ehql);
+		writeInt(mFile,"\tsetAttr \".ehql\" ",ehql,";\n");
 	}
 	void setEnableAcceleratedMultiSampling(bool eams)
 	{
 		if(eams == true) return;
-		fprintf(mFile,"\tsetAttr \".eams\" %i;\n", eams);
+		writeInt(mFile,"\tsetAttr \".eams\" ",eams,";\n");
 	}
 	void setEnableEdgeAntiAliasing(bool eeaa)
 	{
 		if(eeaa == false) return;
-		fprintf(mFile,"\tsetAttr \".eeaa\" %i;\n", eeaa);
+		writeInt(mFile,"\tsetAttr \".eeaa\" ",eeaa,";\n");
 	}
 	void setEnableGeometryMask(bool engm)
 	{
 		if(engm == false) return;
-		fprintf(mFile,"\tsetAttr \".engm\" %i;\n", engm);
+		writeInt(mFile,"\tsetAttr \".engm\" ",engm,";\n");
 	}
 	void setNumberOfSamples(unsigned int mes)
 	{
 		if(mes == 0) return;
-		fprintf(mFile,"\tsetAttr \".mes\" %i;\n", mes);
+		writeInt(mFile,"\tsetAttr \".mes\" ",mes,";\n");
 	}
 	void setEnableMotionBlur(bool emb)
 	{
 		if(emb == false) return;
-		fprintf(mFile,"\tsetAttr \".emb\" %i;\n", emb);
+		writeInt(mFile,"\tsetAttr \".emb\" ",emb,";\n");
 	}
 	void setMotionBlurByFrame(float mbbf)
 	{
 		if(mbbf == 1.000) return;
-		fprintf(mFile,"\tsetAttr \".mbbf\" %f;\n", mbbf);
+		writeFloat(mFile,"\tsetAttr \".mbbf\" ",mbbf,";\n");
 	}
 	void setNumberOfExposures(int mbs)
 	{
 		if(mbs == 3) return;
-		fprintf(mFile,"\tsetAttr \".mbs\" %i;\n", mbs);
+		writeInt(mFile,"\tsetAttr \".mbs\" ",mbs,";\n");
 	}
 	void setTransparencySorting(unsigned int trm)
 	{
 		if(trm == 0) return;
-		fprintf(mFile,"\tsetAttr \".trm\" %i;\n", trm);
+		writeInt(mFile,"\tsetAttr \".trm\" ",trm,";\n");
 	}
 	void setTransparentShadowCasting(bool tshc)
 	{
 		if(tshc == true) return;
-		fprintf(mFile,"\tsetAttr \".tshc\" %i;\n", tshc);
+		writeInt(mFile,"\tsetAttr \".tshc\" ",tshc,";\n");
 	}
 	void setEnableNonPowerOfTwoTexture(bool enpt)
 	{
 		if(enpt == true) return;
-		fprintf(mFile,"\tsetAttr \".enpt\" %i;\n", enpt);
+		writeInt(mFile,"\tsetAttr \".enpt\" ",enpt,";\n");
 	}
 	void setCulling(unsigned int clmt)
 	{
 		if(clmt == 0) return;
-		fprintf(mFile,"\tsetAttr \".clmt\" %i;\n", clmt);
+		writeInt(mFile,"\tsetAttr \".clmt\" ",clmt,";\n");
 	}
 	void setTextureCompression(unsigned int tcov)
 	{
 		if(tcov == 0) return;
-		fprintf(mFile,"\tsetAttr \".tcov\" %i;\n", tcov);
+		writeInt(mFile,"\tsetAttr \".tcov\" ",tcov,";\n");
 	}
 	void setLightIntensityThreshold(float lith)
 	{
 		if(lith == 0.001) return;
-		fprintf(mFile,"\tsetAttr \".lith\" %f;\n", lith);
+		writeFloat(mFile,"\tsetAttr \".lith\" ",lith,";\n");
 	}
 	void setSmallObjectCulling(bool sobc)
 	{
 		if(sobc == true) return;
-		fprintf(mFile,"\tsetAttr \".sobc\" %i;\n", sobc);
+		writeInt(mFile,"\tsetAttr \".sobc\" ",sobc,";\n");
 	}
 	void setCullingThreshold(float cuth)
 	{
 		if(cuth == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cuth\" %f;\n", cuth);
+		writeFloat(mFile,"\tsetAttr \".cuth\" ",cuth,";\n");
 	}
 	void setGraphicsHardwareGeometryCachingData(bool hgcd)
 	{
 		if(hgcd == true) return;
-		fprintf(mFile,"\tsetAttr \".hgcd\" %i;\n", hgcd);
+		writeInt(mFile,"\tsetAttr \".hgcd\" ",hgcd,";\n");
 	}
 	void setGraphicsHardwareGeometryCachingIndexing(bool hgci)
 	{
 		if(hgci == true) return;
-		fprintf(mFile,"\tsetAttr \".hgci\" %i;\n", hgci);
+		writeInt(mFile,"\tsetAttr \".hgci\" ",hgci,";\n");
 	}
 	void setMaximumGeometryCacheSize(int mgcs)
 	{
 		if(mgcs == 64) return;
-		fprintf(mFile,"\tsetAttr \".mgcs\" %i;\n", mgcs);
+		writeInt(mFile,"\tsetAttr \".mgcs\" ",mgcs,";\n");
 	}
 	void setWriteAlphaAsColor(bool twa)
 	{
 		if(twa == false) return;
-		fprintf(mFile,"\tsetAttr \".twa\" %i;\n", twa);
+		writeInt(mFile,"\tsetAttr \".twa\" ",twa,";\n");
 	}
 	void setWriteZDepthAsColor(bool twz)
 	{
 		if(twz == false) return;
-		fprintf(mFile,"\tsetAttr \".twz\" %i;\n", twz);
+		writeInt(mFile,"\tsetAttr \".twz\" ",twz,";\n");
 	}
 	void setHardwareCodec(int hwcc)
 	{
 		if(hwcc == 1919706400) return;
-		fprintf(mFile,"\tsetAttr \".hwcc\" %i;\n", hwcc);
+		writeInt(mFile,"\tsetAttr \".hwcc\" ",hwcc,";\n");
 	}
 	void setHardwareDepth(int hwdp)
 	{
 		if(hwdp == 32) return;
-		fprintf(mFile,"\tsetAttr \".hwdp\" %i;\n", hwdp);
+		writeInt(mFile,"\tsetAttr \".hwdp\" ",hwdp,";\n");
 	}
 	void setHardwareQual(int hwql)
 	{
 		if(hwql == 1024) return;
-		fprintf(mFile,"\tsetAttr \".hwql\" %i;\n", hwql);
+		writeInt(mFile,"\tsetAttr \".hwql\" ",hwql,";\n");
 	}
 	void setHardwareFrameRate(int hwfr)
 	{
 		if(hwfr == 24) return;
-		fprintf(mFile,"\tsetAttr \".hwfr\" %i;\n", hwfr);
+		writeInt(mFile,"\tsetAttr \".hwfr\" ",hwfr,";\n");
 	}
 	void setShadowsObeyLightLinking(bool soll)
 	{
 		if(soll == true) return;
-		fprintf(mFile,"\tsetAttr \".soll\" %i;\n", soll);
+		writeInt(mFile,"\tsetAttr \".soll\" ",soll,";\n");
 	}
 	void setShadowsObeyShadowLinking(bool sosl)
 	{
 		if(sosl == false) return;
-		fprintf(mFile,"\tsetAttr \".sosl\" %i;\n", sosl);
+		writeInt(mFile,"\tsetAttr \".sosl\" ",sosl,";\n");
 	}
 	void setBlendSpecularWithAlpha(bool bswa)
 	{
 		if(bswa == false) return;
-		fprintf(mFile,"\tsetAttr \".bswa\" %i;\n", bswa);
+		writeInt(mFile,"\tsetAttr \".bswa\" ",bswa,";\n");
 	}
 	void setShadingModel(unsigned int shml)
 	{
 		if(shml == 0) return;
-		fprintf(mFile,"\tsetAttr \".shml\" %i;\n", shml);
+		writeInt(mFile,"\tsetAttr \".shml\" ",shml,";\n");
 	}
 	void setHardwareEnvironmentLookup(bool hwel)
 	{
 		if(hwel == false) return;
-		fprintf(mFile,"\tsetAttr \".hwel\" %i;\n", hwel);
+		writeInt(mFile,"\tsetAttr \".hwel\" ",hwel,";\n");
 	}
 	void getColorTextureResolution()const
 	{
-		fprintf(mFile,"\"%s.ctrs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctrs\"");
 	}
 	void getBumpTextureResolution()const
 	{
-		fprintf(mFile,"\"%s.btrs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".btrs\"");
 	}
 	void getFrameBufferFormat()const
 	{
-		fprintf(mFile,"\"%s.fbfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fbfm\"");
 	}
 	void getEnableHighQualityLighting()const
 	{
-		fprintf(mFile,"\"%s.ehql\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ehql\"");
 	}
 	void getEnableAcceleratedMultiSampling()const
 	{
-		fprintf(mFile,"\"%s.eams\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eams\"");
 	}
 	void getEnableEdgeAntiAliasing()const
 	{
-		fprintf(mFile,"\"%s.eeaa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eeaa\"");
 	}
 	void getEnableGeometryMask()const
 	{
-		fprintf(mFile,"\"%s.engm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".engm\"");
 	}
 	void getNumberOfSamples()const
 	{
-		fprintf(mFile,"\"%s.mes\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mes\"");
 	}
 	void getEnableMotionBlur()const
 	{
-		fprintf(mFile,"\"%s.emb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emb\"");
 	}
 	void getMotionBlurByFrame()const
 	{
-		fprintf(mFile,"\"%s.mbbf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mbbf\"");
 	}
 	void getNumberOfExposures()const
 	{
-		fprintf(mFile,"\"%s.mbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mbs\"");
 	}
 	void getTransparencySorting()const
 	{
-		fprintf(mFile,"\"%s.trm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trm\"");
 	}
 	void getTransparentShadowCasting()const
 	{
-		fprintf(mFile,"\"%s.tshc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tshc\"");
 	}
 	void getEnableNonPowerOfTwoTexture()const
 	{
-		fprintf(mFile,"\"%s.enpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".enpt\"");
 	}
 	void getCulling()const
 	{
-		fprintf(mFile,"\"%s.clmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clmt\"");
 	}
 	void getTextureCompression()const
 	{
-		fprintf(mFile,"\"%s.tcov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcov\"");
 	}
 	void getLightIntensityThreshold()const
 	{
-		fprintf(mFile,"\"%s.lith\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lith\"");
 	}
 	void getSmallObjectCulling()const
 	{
-		fprintf(mFile,"\"%s.sobc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sobc\"");
 	}
 	void getCullingThreshold()const
 	{
-		fprintf(mFile,"\"%s.cuth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cuth\"");
 	}
 	void getGraphicsHardwareGeometryCachingData()const
 	{
-		fprintf(mFile,"\"%s.hgcd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hgcd\"");
 	}
 	void getGraphicsHardwareGeometryCachingIndexing()const
 	{
-		fprintf(mFile,"\"%s.hgci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hgci\"");
 	}
 	void getMaximumGeometryCacheSize()const
 	{
-		fprintf(mFile,"\"%s.mgcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mgcs\"");
 	}
 	void getWriteAlphaAsColor()const
 	{
-		fprintf(mFile,"\"%s.twa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twa\"");
 	}
 	void getWriteZDepthAsColor()const
 	{
-		fprintf(mFile,"\"%s.twz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twz\"");
 	}
 	void getHardwareCodec()const
 	{
-		fprintf(mFile,"\"%s.hwcc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hwcc\"");
 	}
 	void getHardwareDepth()const
 	{
-		fprintf(mFile,"\"%s.hwdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hwdp\"");
 	}
 	void getHardwareQual()const
 	{
-		fprintf(mFile,"\"%s.hwql\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hwql\"");
 	}
 	void getHardwareFrameRate()const
 	{
-		fprintf(mFile,"\"%s.hwfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hwfr\"");
 	}
 	void getShadowsObeyLightLinking()const
 	{
-		fprintf(mFile,"\"%s.soll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".soll\"");
 	}
 	void getShadowsObeyShadowLinking()const
 	{
-		fprintf(mFile,"\"%s.sosl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sosl\"");
 	}
 	void getBlendSpecularWithAlpha()const
 	{
-		fprintf(mFile,"\"%s.bswa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bswa\"");
 	}
 	void getShadingModel()const
 	{
-		fprintf(mFile,"\"%s.shml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shml\"");
 	}
 	void getHardwareEnvironmentLookup()const
 	{
-		fprintf(mFile,"\"%s.hwel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hwel\"");
 	}
 protected:
 	HardwareRenderGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
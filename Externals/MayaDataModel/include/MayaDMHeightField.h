@@ -27,70 +27,70 @@ public:
 	void setResolution(int res)
 	{
 		if(res == 10) return;
-		fprintf(mFile,"\tsetAttr \".res\" %i;\n", res);
+		writeInt(mFile,"\tsetAttr \".res\" ",res,";\n");
 	}
 	void setColor(const float3& cl)
 	{
-		fprintf(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
 		cl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".cl.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".cl.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".cl.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".cl.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".cl.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".cl.cb\" ",cb,";\n");
 	}
 	void setDisplacement(float dis)
 	{
 		if(dis == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dis\" %f;\n", dis);
+		writeFloat(mFile,"\tsetAttr \".dis\" ",dis,";\n");
 	}
 	void setHeightScale(float hc)
 	{
 		if(hc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hc\" %f;\n", hc);
+		writeFloat(mFile,"\tsetAttr \".hc\" ",hc,";\n");
 	}
 	void getResolution()const
 	{
-		fprintf(mFile,"\"%s.res\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.cl.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.cl.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.cl.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cb\"");
 	}
 	void getDisplacement()const
 	{
-		fprintf(mFile,"\"%s.dis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dis\"");
 	}
 	void getHeightScale()const
 	{
-		fprintf(mFile,"\"%s.hc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc\"");
 	}
 	void getCacheNeedsRebuilding()const
 	{
-		fprintf(mFile,"\"%s.cnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnr\"");
 	}
 protected:
 	HeightField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,211 +27,211 @@ public:
 	void setPinning(unsigned int pin)
 	{
 		if(pin == 0) return;
-		fprintf(mFile,"\tsetAttr \".pin\" %i;\n", pin);
+		writeInt(mFile,"\tsetAttr \".pin\" ",pin,";\n");
 	}
 	void setEffectorID(int ei)
 	{
 		if(ei == 0) return;
-		fprintf(mFile,"\tsetAttr \".ei\" %i;\n", ei);
+		writeInt(mFile,"\tsetAttr \".ei\" ",ei,";\n");
 	}
 	void setPivotOffset(const double3& po)
 	{
-		fprintf(mFile,"\tsetAttr \".po\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".po\" -type \"double3\" ");
 		po.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPivotOffsetX(double px)
 	{
 		if(px == 0) return;
-		fprintf(mFile,"\tsetAttr \".po.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".po.px\" ",px,";\n");
 	}
 	void setPivotOffsetY(double py)
 	{
 		if(py == 0) return;
-		fprintf(mFile,"\tsetAttr \".po.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".po.py\" ",py,";\n");
 	}
 	void setPivotOffsetZ(double pz)
 	{
 		if(pz == 0) return;
-		fprintf(mFile,"\tsetAttr \".po.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".po.pz\" ",pz,";\n");
 	}
 	void setReachTranslation(double rt)
 	{
 		if(rt == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rt\" %f;\n", rt);
+		writeFloat(mFile,"\tsetAttr \".rt\" ",rt,";\n");
 	}
 	void setReachRotation(double rr)
 	{
 		if(rr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rr\" %f;\n", rr);
+		writeFloat(mFile,"\tsetAttr \".rr\" ",rr,";\n");
 	}
 	void setRadius(double radi)
 	{
 		if(radi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".radi\" %f;\n", radi);
+		writeFloat(mFile,"\tsetAttr \".radi\" ",radi,";\n");
 	}
 	void setAuxEffector(bool aeff)
 	{
 		if(aeff == false) return;
-		fprintf(mFile,"\tsetAttr \".aeff\" %i;\n", aeff);
+		writeInt(mFile,"\tsetAttr \".aeff\" ",aeff,";\n");
 	}
 	void setPreRotation(const double3& pr)
 	{
-		fprintf(mFile,"\tsetAttr \".pr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pr\" -type \"double3\" ");
 		pr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPreRotationX(double prx)
 	{
 		if(prx == 0) return;
-		fprintf(mFile,"\tsetAttr \".pr.prx\" %f;\n", prx);
+		writeFloat(mFile,"\tsetAttr \".pr.prx\" ",prx,";\n");
 	}
 	void setPreRotationY(double pry)
 	{
 		if(pry == 0) return;
-		fprintf(mFile,"\tsetAttr \".pr.pry\" %f;\n", pry);
+		writeFloat(mFile,"\tsetAttr \".pr.pry\" ",pry,";\n");
 	}
 	void setPreRotationZ(double prz)
 	{
 		if(prz == 0) return;
-		fprintf(mFile,"\tsetAttr \".pr.prz\" %f;\n", prz);
+		writeFloat(mFile,"\tsetAttr \".pr.prz\" ",prz,";\n");
 	}
 	void setColor(const float3& col)
 	{
-		fprintf(mFile,"\tsetAttr \".col\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".col\" -type \"float3\" ");
 		col.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float clr)
 	{
 		if(clr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".col.clr\" %f;\n", clr);
+		writeFloat(mFile,"\tsetAttr \".col.clr\" ",clr,";\n");
 	}
 	void setColorG(float clg)
 	{
 		if(clg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".col.clg\" %f;\n", clg);
+		writeFloat(mFile,"\tsetAttr \".col.clg\" ",clg,";\n");
 	}
 	void setColorB(float clb)
 	{
 		if(clb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".col.clb\" %f;\n", clb);
+		writeFloat(mFile,"\tsetAttr \".col.clb\" ",clb,";\n");
 	}
 	void setAlpha(float alp)
 	{
 		if(alp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".alp\" %f;\n", alp);
+		writeFloat(mFile,"\tsetAttr \".alp\" ",alp,";\n");
 	}
 	void setMarkerLook(unsigned int mkl)
 	{
 		if(mkl == 3) return;
-		fprintf(mFile,"\tsetAttr \".mkl\" %i;\n", mkl);
+		writeInt(mFile,"\tsetAttr \".mkl\" ",mkl,";\n");
 	}
 	void getJoint()const
 	{
-		fprintf(mFile,"\"%s.jt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jt\"");
 	}
 	void getFkjoint()const
 	{
-		fprintf(mFile,"\"%s.fj\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fj\"");
 	}
 	void getPinning()const
 	{
-		fprintf(mFile,"\"%s.pin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pin\"");
 	}
 	void getHandle(size_t ha_i)const
 	{
-		fprintf(mFile,"\"%s.ha[%i]\"",mName.c_str(),ha_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ha[",ha_i,"]\"");
 	}
 	void getHandle()const
 	{
 
-		fprintf(mFile,"\"%s.ha\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ha\"");
 	}
 	void getEffectorID()const
 	{
-		fprintf(mFile,"\"%s.ei\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ei\"");
 	}
 	void getPivots(size_t pvt_i)const
 	{
-		fprintf(mFile,"\"%s.pvt[%i]\"",mName.c_str(),pvt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pvt[",pvt_i,"]\"");
 	}
 	void getPivots()const
 	{
 
-		fprintf(mFile,"\"%s.pvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt\"");
 	}
 	void getPivotOffset()const
 	{
-		fprintf(mFile,"\"%s.po\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po\"");
 	}
 	void getPivotOffsetX()const
 	{
-		fprintf(mFile,"\"%s.po.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.px\"");
 	}
 	void getPivotOffsetY()const
 	{
-		fprintf(mFile,"\"%s.po.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.py\"");
 	}
 	void getPivotOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.po.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.pz\"");
 	}
 	void getReachTranslation()const
 	{
-		fprintf(mFile,"\"%s.rt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rt\"");
 	}
 	void getReachRotation()const
 	{
-		fprintf(mFile,"\"%s.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rr\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.radi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".radi\"");
 	}
 	void getAuxEffector()const
 	{
-		fprintf(mFile,"\"%s.aeff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aeff\"");
 	}
 	void getPreRotation()const
 	{
-		fprintf(mFile,"\"%s.pr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pr\"");
 	}
 	void getPreRotationX()const
 	{
-		fprintf(mFile,"\"%s.pr.prx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pr.prx\"");
 	}
 	void getPreRotationY()const
 	{
-		fprintf(mFile,"\"%s.pr.pry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pr.pry\"");
 	}
 	void getPreRotationZ()const
 	{
-		fprintf(mFile,"\"%s.pr.prz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pr.prz\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.col\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.col.clr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.clr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.col.clg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.clg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.col.clb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.clb\"");
 	}
 	void getAlpha()const
 	{
-		fprintf(mFile,"\"%s.alp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".alp\"");
 	}
 	void getMarkerLook()const
 	{
-		fprintf(mFile,"\"%s.mkl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mkl\"");
 	}
 protected:
 	HikEffector(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,12 +26,12 @@ public:
 		bool toesContact;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", drawHandContact);
-			fprintf(file,"%i ", handsContact);
-			fprintf(file,"%i ", drawFeetContact);
-			fprintf(file,"%i ", feetContact);
-			fprintf(file,"%i ", fingersContact);
-			fprintf(file,"%i", toesContact);
+			writeInt(file,"",drawHandContact," ");
+			writeInt(file,"",handsContact," ");
+			writeInt(file,"",drawFeetContact," ");
+			writeInt(file,"",feetContact," ");
+			writeInt(file,"",fingersContact," ");
+			writeInt(file,"",toesContact);
 		}
 	};
 	struct HandsFloorContactSetup{
@@ -40,9 +40,9 @@ public:
 		float handsContactStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", handsFloorPivot);
-			fprintf(file,"%i ", handsContactType);
-			fprintf(file,"%f", handsContactStiffness);
+			writeInt(file,"",handsFloorPivot," ");
+			writeInt(file,"",handsContactType," ");
+			writeFloat(file,"",handsContactStiffness);
 		}
 	};
 	struct ContactsPosition{
@@ -54,12 +54,12 @@ public:
 		float handOutSide;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", handHeight);
-			fprintf(file,"%f ", handBack);
-			fprintf(file,"%f ", handMiddle);
-			fprintf(file,"%f ", handFront);
-			fprintf(file,"%f ", handInSide);
-			fprintf(file,"%f", handOutSide);
+			writeFloat(file,"",handHeight," ");
+			writeFloat(file,"",handBack," ");
+			writeFloat(file,"",handMiddle," ");
+			writeFloat(file,"",handFront," ");
+			writeFloat(file,"",handInSide," ");
+			writeFloat(file,"",handOutSide);
 		}
 	};
 	struct FeetFloorContactSetup{
@@ -68,9 +68,9 @@ public:
 		float feetContactStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", feetFloorPivot);
-			fprintf(file,"%i ", feetContactType);
-			fprintf(file,"%f", feetContactStiffness);
+			writeInt(file,"",feetFloorPivot," ");
+			writeInt(file,"",feetContactType," ");
+			writeFloat(file,"",feetContactStiffness);
 		}
 	};
 	struct FeetContactPosition{
@@ -82,12 +82,12 @@ public:
 		float footOutSide;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", footHeight);
-			fprintf(file,"%f ", footBack);
-			fprintf(file,"%f ", footMiddle);
-			fprintf(file,"%f ", footFront);
-			fprintf(file,"%f ", footInSide);
-			fprintf(file,"%f", footOutSide);
+			writeFloat(file,"",footHeight," ");
+			writeFloat(file,"",footBack," ");
+			writeFloat(file,"",footMiddle," ");
+			writeFloat(file,"",footFront," ");
+			writeFloat(file,"",footInSide," ");
+			writeFloat(file,"",footOutSide);
 		}
 	};
 	struct FingersFloorContactSetup{
@@ -95,8 +95,8 @@ public:
 		float fingersContactRollStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", fingersContactType);
-			fprintf(file,"%f", fingersContactRollStiffness);
+			writeInt(file,"",fingersContactType," ");
+			writeFloat(file,"",fingersContactRollStiffness);
 		}
 	};
 	struct ToesFloorContactSetup{
@@ -104,8 +104,8 @@ public:
 		float toesContactRollStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", toesContactType);
-			fprintf(file,"%f", toesContactRollStiffness);
+			writeInt(file,"",toesContactType," ");
+			writeFloat(file,"",toesContactRollStiffness);
 		}
 	};
 public:
@@ -118,333 +118,333 @@ public:
 	void setMarkerSize(double msz)
 	{
 		if(msz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".msz\" %f;\n", msz);
+		writeFloat(mFile,"\tsetAttr \".msz\" ",msz,";\n");
 	}
 	void setFloorContacts(const FloorContacts& fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc\" ");
+		writeString(mFile,"\tsetAttr \".fc\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDrawHandContact(bool dhc)
 	{
 		if(dhc == 1) return;
-		fprintf(mFile,"\tsetAttr \".fc.dhc\" %i;\n", dhc);
+		writeInt(mFile,"\tsetAttr \".fc.dhc\" ",dhc,";\n");
 	}
 	void setHandsContact(bool hfc)
 	{
 		if(hfc == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc.hfc\" %i;\n", hfc);
+		writeInt(mFile,"\tsetAttr \".fc.hfc\" ",hfc,";\n");
 	}
 	void setDrawFeetContact(bool dfc)
 	{
 		if(dfc == 1) return;
-		fprintf(mFile,"\tsetAttr \".fc.dfc\" %i;\n", dfc);
+		writeInt(mFile,"\tsetAttr \".fc.dfc\" ",dfc,";\n");
 	}
 	void setFeetContact(bool fec)
 	{
 		if(fec == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fec\" %i;\n", fec);
+		writeInt(mFile,"\tsetAttr \".fc.fec\" ",fec,";\n");
 	}
 	void setFingersContact(bool fic)
 	{
 		if(fic == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fic\" %i;\n", fic);
+		writeInt(mFile,"\tsetAttr \".fc.fic\" ",fic,";\n");
 	}
 	void setToesContact(bool tfc)
 	{
 		if(tfc == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc.tfc\" %i;\n", tfc);
+		writeInt(mFile,"\tsetAttr \".fc.tfc\" ",tfc,";\n");
 	}
 	void setHandsFloorContactSetup(const HandsFloorContactSetup& flc)
 	{
-		fprintf(mFile,"\tsetAttr \".flc\" ");
+		writeString(mFile,"\tsetAttr \".flc\" ");
 		flc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHandsFloorPivot(unsigned int hfp)
 	{
 		if(hfp == 0) return;
-		fprintf(mFile,"\tsetAttr \".flc.hfp\" %i;\n", hfp);
+		writeInt(mFile,"\tsetAttr \".flc.hfp\" ",hfp,";\n");
 	}
 	void setHandsContactType(unsigned int hct)
 	{
 		if(hct == 0) return;
-		fprintf(mFile,"\tsetAttr \".flc.hct\" %i;\n", hct);
+		writeInt(mFile,"\tsetAttr \".flc.hct\" ",hct,";\n");
 	}
 	void setHandsContactStiffness(float hcs)
 	{
 		if(hcs == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flc.hcs\" %f;\n", hcs);
+		writeFloat(mFile,"\tsetAttr \".flc.hcs\" ",hcs,";\n");
 	}
 	void setContactsPosition(const ContactsPosition& cp)
 	{
-		fprintf(mFile,"\tsetAttr \".cp\" ");
+		writeString(mFile,"\tsetAttr \".cp\" ");
 		cp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHandHeight(float hh)
 	{
 		if(hh == 7.50) return;
-		fprintf(mFile,"\tsetAttr \".cp.hh\" %f;\n", hh);
+		writeFloat(mFile,"\tsetAttr \".cp.hh\" ",hh,";\n");
 	}
 	void setHandBack(float hb)
 	{
 		if(hb == 4.50) return;
-		fprintf(mFile,"\tsetAttr \".cp.hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".cp.hb\" ",hb,";\n");
 	}
 	void setHandMiddle(float hm)
 	{
 		if(hm == 13.00) return;
-		fprintf(mFile,"\tsetAttr \".cp.hm\" %f;\n", hm);
+		writeFloat(mFile,"\tsetAttr \".cp.hm\" ",hm,";\n");
 	}
 	void setHandFront(float hf)
 	{
 		if(hf == 7.00) return;
-		fprintf(mFile,"\tsetAttr \".cp.hf\" %f;\n", hf);
+		writeFloat(mFile,"\tsetAttr \".cp.hf\" ",hf,";\n");
 	}
 	void setHandInSide(float his)
 	{
 		if(his == 5.00) return;
-		fprintf(mFile,"\tsetAttr \".cp.his\" %f;\n", his);
+		writeFloat(mFile,"\tsetAttr \".cp.his\" ",his,";\n");
 	}
 	void setHandOutSide(float hos)
 	{
 		if(hos == 5.00) return;
-		fprintf(mFile,"\tsetAttr \".cp.hos\" %f;\n", hos);
+		writeFloat(mFile,"\tsetAttr \".cp.hos\" ",hos,";\n");
 	}
 	void setFeetFloorContactSetup(const FeetFloorContactSetup& fle)
 	{
-		fprintf(mFile,"\tsetAttr \".fle\" ");
+		writeString(mFile,"\tsetAttr \".fle\" ");
 		fle.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFeetFloorPivot(unsigned int fpv)
 	{
 		if(fpv == 0) return;
-		fprintf(mFile,"\tsetAttr \".fle.fpv\" %i;\n", fpv);
+		writeInt(mFile,"\tsetAttr \".fle.fpv\" ",fpv,";\n");
 	}
 	void setFeetContactType(unsigned int fct)
 	{
 		if(fct == 0) return;
-		fprintf(mFile,"\tsetAttr \".fle.fct\" %i;\n", fct);
+		writeInt(mFile,"\tsetAttr \".fle.fct\" ",fct,";\n");
 	}
 	void setFeetContactStiffness(float fcs)
 	{
 		if(fcs == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".fle.fcs\" %f;\n", fcs);
+		writeFloat(mFile,"\tsetAttr \".fle.fcs\" ",fcs,";\n");
 	}
 	void setFeetContactPosition(const FeetContactPosition& flf)
 	{
-		fprintf(mFile,"\tsetAttr \".flf\" ");
+		writeString(mFile,"\tsetAttr \".flf\" ");
 		flf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFootHeight(float fh)
 	{
 		if(fh == 7.50) return;
-		fprintf(mFile,"\tsetAttr \".flf.fh\" %f;\n", fh);
+		writeFloat(mFile,"\tsetAttr \".flf.fh\" ",fh,";\n");
 	}
 	void setFootBack(float fra)
 	{
 		if(fra == 4.50) return;
-		fprintf(mFile,"\tsetAttr \".flf.fra\" %f;\n", fra);
+		writeFloat(mFile,"\tsetAttr \".flf.fra\" ",fra,";\n");
 	}
 	void setFootMiddle(float fma)
 	{
 		if(fma == 13.00) return;
-		fprintf(mFile,"\tsetAttr \".flf.fma\" %f;\n", fma);
+		writeFloat(mFile,"\tsetAttr \".flf.fma\" ",fma,";\n");
 	}
 	void setFootFront(float ffm)
 	{
 		if(ffm == 7.00) return;
-		fprintf(mFile,"\tsetAttr \".flf.ffm\" %f;\n", ffm);
+		writeFloat(mFile,"\tsetAttr \".flf.ffm\" ",ffm,";\n");
 	}
 	void setFootInSide(float fia)
 	{
 		if(fia == 5.00) return;
-		fprintf(mFile,"\tsetAttr \".flf.fia\" %f;\n", fia);
+		writeFloat(mFile,"\tsetAttr \".flf.fia\" ",fia,";\n");
 	}
 	void setFootOutSide(float foa)
 	{
 		if(foa == 5.00) return;
-		fprintf(mFile,"\tsetAttr \".flf.foa\" %f;\n", foa);
+		writeFloat(mFile,"\tsetAttr \".flf.foa\" ",foa,";\n");
 	}
 	void setFingersFloorContactSetup(const FingersFloorContactSetup& flg)
 	{
-		fprintf(mFile,"\tsetAttr \".flg\" ");
+		writeString(mFile,"\tsetAttr \".flg\" ");
 		flg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFingersContactType(unsigned int fcm)
 	{
 		if(fcm == 1) return;
-		fprintf(mFile,"\tsetAttr \".flg.fcm\" %i;\n", fcm);
+		writeInt(mFile,"\tsetAttr \".flg.fcm\" ",fcm,";\n");
 	}
 	void setFingersContactRollStiffness(float hcr)
 	{
 		if(hcr == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flg.hcr\" %f;\n", hcr);
+		writeFloat(mFile,"\tsetAttr \".flg.hcr\" ",hcr,";\n");
 	}
 	void setToesFloorContactSetup(const ToesFloorContactSetup& fli)
 	{
-		fprintf(mFile,"\tsetAttr \".fli\" ");
+		writeString(mFile,"\tsetAttr \".fli\" ");
 		fli.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setToesContactType(unsigned int tct)
 	{
 		if(tct == 1) return;
-		fprintf(mFile,"\tsetAttr \".fli.tct\" %i;\n", tct);
+		writeInt(mFile,"\tsetAttr \".fli.tct\" ",tct,";\n");
 	}
 	void setToesContactRollStiffness(float fcr)
 	{
 		if(fcr == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".fli.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fli.fcr\" ",fcr,";\n");
 	}
 	void getMarkerSize()const
 	{
-		fprintf(mFile,"\"%s.msz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msz\"");
 	}
 	void getFloorContacts()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getDrawHandContact()const
 	{
-		fprintf(mFile,"\"%s.fc.dhc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.dhc\"");
 	}
 	void getHandsContact()const
 	{
-		fprintf(mFile,"\"%s.fc.hfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.hfc\"");
 	}
 	void getDrawFeetContact()const
 	{
-		fprintf(mFile,"\"%s.fc.dfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.dfc\"");
 	}
 	void getFeetContact()const
 	{
-		fprintf(mFile,"\"%s.fc.fec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fec\"");
 	}
 	void getFingersContact()const
 	{
-		fprintf(mFile,"\"%s.fc.fic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fic\"");
 	}
 	void getToesContact()const
 	{
-		fprintf(mFile,"\"%s.fc.tfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.tfc\"");
 	}
 	void getHandsFloorContactSetup()const
 	{
-		fprintf(mFile,"\"%s.flc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc\"");
 	}
 	void getHandsFloorPivot()const
 	{
-		fprintf(mFile,"\"%s.flc.hfp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc.hfp\"");
 	}
 	void getHandsContactType()const
 	{
-		fprintf(mFile,"\"%s.flc.hct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc.hct\"");
 	}
 	void getHandsContactStiffness()const
 	{
-		fprintf(mFile,"\"%s.flc.hcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc.hcs\"");
 	}
 	void getContactsPosition()const
 	{
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getHandHeight()const
 	{
-		fprintf(mFile,"\"%s.cp.hh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hh\"");
 	}
 	void getHandBack()const
 	{
-		fprintf(mFile,"\"%s.cp.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hb\"");
 	}
 	void getHandMiddle()const
 	{
-		fprintf(mFile,"\"%s.cp.hm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hm\"");
 	}
 	void getHandFront()const
 	{
-		fprintf(mFile,"\"%s.cp.hf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hf\"");
 	}
 	void getHandInSide()const
 	{
-		fprintf(mFile,"\"%s.cp.his\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.his\"");
 	}
 	void getHandOutSide()const
 	{
-		fprintf(mFile,"\"%s.cp.hos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hos\"");
 	}
 	void getFeetFloorContactSetup()const
 	{
-		fprintf(mFile,"\"%s.fle\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fle\"");
 	}
 	void getFeetFloorPivot()const
 	{
-		fprintf(mFile,"\"%s.fle.fpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fle.fpv\"");
 	}
 	void getFeetContactType()const
 	{
-		fprintf(mFile,"\"%s.fle.fct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fle.fct\"");
 	}
 	void getFeetContactStiffness()const
 	{
-		fprintf(mFile,"\"%s.fle.fcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fle.fcs\"");
 	}
 	void getFeetContactPosition()const
 	{
-		fprintf(mFile,"\"%s.flf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf\"");
 	}
 	void getFootHeight()const
 	{
-		fprintf(mFile,"\"%s.flf.fh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.fh\"");
 	}
 	void getFootBack()const
 	{
-		fprintf(mFile,"\"%s.flf.fra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.fra\"");
 	}
 	void getFootMiddle()const
 	{
-		fprintf(mFile,"\"%s.flf.fma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.fma\"");
 	}
 	void getFootFront()const
 	{
-		fprintf(mFile,"\"%s.flf.ffm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.ffm\"");
 	}
 	void getFootInSide()const
 	{
-		fprintf(mFile,"\"%s.flf.fia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.fia\"");
 	}
 	void getFootOutSide()const
 	{
-		fprintf(mFile,"\"%s.flf.foa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.foa\"");
 	}
 	void getFingersFloorContactSetup()const
 	{
-		fprintf(mFile,"\"%s.flg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flg\"");
 	}
 	void getFingersContactType()const
 	{
-		fprintf(mFile,"\"%s.flg.fcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flg.fcm\"");
 	}
 	void getFingersContactRollStiffness()const
 	{
-		fprintf(mFile,"\"%s.flg.hcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flg.hcr\"");
 	}
 	void getToesFloorContactSetup()const
 	{
-		fprintf(mFile,"\"%s.fli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fli\"");
 	}
 	void getToesContactType()const
 	{
-		fprintf(mFile,"\"%s.fli.tct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fli.tct\"");
 	}
 	void getToesContactRollStiffness()const
 	{
-		fprintf(mFile,"\"%s.fli.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fli.fcr\"");
 	}
 protected:
 	HikFloorContactMarker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
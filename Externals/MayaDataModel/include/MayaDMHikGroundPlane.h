@@ -27,11 +27,11 @@ public:
 	void setLength(double leng)
 	{
 		if(leng == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".leng\" %f;\n", leng);
+		writeFloat(mFile,"\tsetAttr \".leng\" ",leng,";\n");
 	}
 	void getLength()const
 	{
-		fprintf(mFile,"\"%s.leng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".leng\"");
 	}
 protected:
 	HikGroundPlane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
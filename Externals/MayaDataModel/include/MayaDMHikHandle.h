@@ -25,11 +25,11 @@ public:
 		unsigned int hipTranslationMode;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", postureType);
-			fprintf(file,"%i ", expertMode);
-			fprintf(file,"%f ", realisticShoulderSolving);
-			fprintf(file,"%i ", solveFingers);
-			fprintf(file,"%i", hipTranslationMode);
+			writeInt(file,"",postureType," ");
+			writeInt(file,"",expertMode," ");
+			writeFloat(file,"",realisticShoulderSolving," ");
+			writeInt(file,"",solveFingers," ");
+			writeInt(file,"",hipTranslationMode);
 		}
 	};
 	struct FloorContacts{
@@ -39,10 +39,10 @@ public:
 		bool toesFloorContact;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", handsFloorContact);
-			fprintf(file,"%i ", feetFloorContact);
-			fprintf(file,"%i ", fingersFloorContact);
-			fprintf(file,"%i", toesFloorContact);
+			writeInt(file,"",handsFloorContact," ");
+			writeInt(file,"",feetFloorContact," ");
+			writeInt(file,"",fingersFloorContact," ");
+			writeInt(file,"",toesFloorContact);
 		}
 	};
 	struct HandsFloorContactSetup{
@@ -51,9 +51,9 @@ public:
 		float handsContactStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", handsFloorPivot);
-			fprintf(file,"%i ", handsContactType);
-			fprintf(file,"%f", handsContactStiffness);
+			writeInt(file,"",handsFloorPivot," ");
+			writeInt(file,"",handsContactType," ");
+			writeFloat(file,"",handsContactStiffness);
 		}
 	};
 	struct ContactsPosition{
@@ -65,12 +65,12 @@ public:
 		float handOutSide;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", handHeight);
-			fprintf(file,"%f ", handBack);
-			fprintf(file,"%f ", handMiddle);
-			fprintf(file,"%f ", handFront);
-			fprintf(file,"%f ", handInSide);
-			fprintf(file,"%f", handOutSide);
+			writeFloat(file,"",handHeight," ");
+			writeFloat(file,"",handBack," ");
+			writeFloat(file,"",handMiddle," ");
+			writeFloat(file,"",handFront," ");
+			writeFloat(file,"",handInSide," ");
+			writeFloat(file,"",handOutSide);
 		}
 	};
 	struct FeetFloorContactSetup{
@@ -79,9 +79,9 @@ public:
 		float feetContactStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", feetFloorPivot);
-			fprintf(file,"%i ", feetContactType);
-			fprintf(file,"%f", feetContactStiffness);
+			writeInt(file,"",feetFloorPivot," ");
+			writeInt(file,"",feetContactType," ");
+			writeFloat(file,"",feetContactStiffness);
 		}
 	};
 	struct FeetContactPosition{
@@ -93,12 +93,12 @@ public:
 		float footOutSide;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", footHeight);
-			fprintf(file,"%f ", footBack);
-			fprintf(file,"%f ", footMiddle);
-			fprintf(file,"%f ", footFront);
-			fprintf(file,"%f ", footInSide);
-			fprintf(file,"%f", footOutSide);
+			writeFloat(file,"",footHeight," ");
+			writeFloat(file,"",footBack," ");
+			writeFloat(file,"",footMiddle," ");
+			writeFloat(file,"",footFront," ");
+			writeFloat(file,"",footInSide," ");
+			writeFloat(file,"",footOutSide);
 		}
 	};
 	struct FingersFloorContactSetup{
@@ -106,8 +106,8 @@ public:
 		float fingersContactRollStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", fingersContactType);
-			fprintf(file,"%f", fingersContactRollStiffness);
+			writeInt(file,"",fingersContactType," ");
+			writeFloat(file,"",fingersContactRollStiffness);
 		}
 	};
 	struct FingerTipsSizes{
@@ -125,18 +125,18 @@ public:
 		float rightHandExtraFingerTip;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leftHandThumbTip);
-			fprintf(file,"%f ", leftHandIndexTip);
-			fprintf(file,"%f ", leftHandMiddleTip);
-			fprintf(file,"%f ", leftHandRingTip);
-			fprintf(file,"%f ", leftHandPinkyTip);
-			fprintf(file,"%f ", leftHandExtraFingerTip);
-			fprintf(file,"%f ", rightHandThumbTip);
-			fprintf(file,"%f ", rightHandIndexTip);
-			fprintf(file,"%f ", rightHandMiddleTip);
-			fprintf(file,"%f ", rightHandRingTip);
-			fprintf(file,"%f ", rightHandPinkyTip);
-			fprintf(file,"%f", rightHandExtraFingerTip);
+			writeFloat(file,"",leftHandThumbTip," ");
+			writeFloat(file,"",leftHandIndexTip," ");
+			writeFloat(file,"",leftHandMiddleTip," ");
+			writeFloat(file,"",leftHandRingTip," ");
+			writeFloat(file,"",leftHandPinkyTip," ");
+			writeFloat(file,"",leftHandExtraFingerTip," ");
+			writeFloat(file,"",rightHandThumbTip," ");
+			writeFloat(file,"",rightHandIndexTip," ");
+			writeFloat(file,"",rightHandMiddleTip," ");
+			writeFloat(file,"",rightHandRingTip," ");
+			writeFloat(file,"",rightHandPinkyTip," ");
+			writeFloat(file,"",rightHandExtraFingerTip);
 		}
 	};
 	struct ToesFloorContactSetup{
@@ -144,8 +144,8 @@ public:
 		float toesContactRollStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", toesContactType);
-			fprintf(file,"%f", toesContactRollStiffness);
+			writeInt(file,"",toesContactType," ");
+			writeFloat(file,"",toesContactRollStiffness);
 		}
 	};
 	struct ToeTipsSizes{
@@ -163,25 +163,25 @@ public:
 		float rightFootExtraFingerTip;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leftFootThumbTip);
-			fprintf(file,"%f ", leftFootIndexTip);
-			fprintf(file,"%f ", leftFootMiddleTip);
-			fprintf(file,"%f ", leftFootRingTip);
-			fprintf(file,"%f ", leftFootPinkyTip);
-			fprintf(file,"%f ", leftFootExtraFingerTip);
-			fprintf(file,"%f ", rightFootThumbTip);
-			fprintf(file,"%f ", rightFootIndexTip);
-			fprintf(file,"%f ", rightFootMiddleTip);
-			fprintf(file,"%f ", rightFootRingTip);
-			fprintf(file,"%f ", rightFootPinkyTip);
-			fprintf(file,"%f", rightFootExtraFingerTip);
+			writeFloat(file,"",leftFootThumbTip," ");
+			writeFloat(file,"",leftFootIndexTip," ");
+			writeFloat(file,"",leftFootMiddleTip," ");
+			writeFloat(file,"",leftFootRingTip," ");
+			writeFloat(file,"",leftFootPinkyTip," ");
+			writeFloat(file,"",leftFootExtraFingerTip," ");
+			writeFloat(file,"",rightFootThumbTip," ");
+			writeFloat(file,"",rightFootIndexTip," ");
+			writeFloat(file,"",rightFootMiddleTip," ");
+			writeFloat(file,"",rightFootRingTip," ");
+			writeFloat(file,"",rightFootPinkyTip," ");
+			writeFloat(file,"",rightFootExtraFingerTip);
 		}
 	};
 	struct Head{
 		float headPull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", headPull);
+			writeFloat(file,"",headPull);
 		}
 	};
 	struct LeftArm{
@@ -191,10 +191,10 @@ public:
 		float leftFingerBasePull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leftElbowPull);
-			fprintf(file,"%f ", leftHandPullChest);
-			fprintf(file,"%f ", leftHandPullHips);
-			fprintf(file,"%f", leftFingerBasePull);
+			writeFloat(file,"",leftElbowPull," ");
+			writeFloat(file,"",leftHandPullChest," ");
+			writeFloat(file,"",leftHandPullHips," ");
+			writeFloat(file,"",leftFingerBasePull);
 		}
 	};
 	struct RightArm{
@@ -204,24 +204,24 @@ public:
 		float rightFingerBasePull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", rightElbowPull);
-			fprintf(file,"%f ", rightHandPullChest);
-			fprintf(file,"%f ", rightHandPullHips);
-			fprintf(file,"%f", rightFingerBasePull);
+			writeFloat(file,"",rightElbowPull," ");
+			writeFloat(file,"",rightHandPullChest," ");
+			writeFloat(file,"",rightHandPullHips," ");
+			writeFloat(file,"",rightFingerBasePull);
 		}
 	};
 	struct Chest{
 		float chestPull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", chestPull);
+			writeFloat(file,"",chestPull);
 		}
 	};
 	struct Hips{
 		float hipsPull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", hipsPull);
+			writeFloat(file,"",hipsPull);
 		}
 	};
 	struct LeftLeg{
@@ -230,9 +230,9 @@ public:
 		float leftToeBasePull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leftKneePull);
-			fprintf(file,"%f ", leftFootPull);
-			fprintf(file,"%f", leftToeBasePull);
+			writeFloat(file,"",leftKneePull," ");
+			writeFloat(file,"",leftFootPull," ");
+			writeFloat(file,"",leftToeBasePull);
 		}
 	};
 	struct RightLeg{
@@ -241,16 +241,16 @@ public:
 		float rightToeBasePull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", rightKneePull);
-			fprintf(file,"%f ", rightFootPull);
-			fprintf(file,"%f", rightToeBasePull);
+			writeFloat(file,"",rightKneePull," ");
+			writeFloat(file,"",rightFootPull," ");
+			writeFloat(file,"",rightToeBasePull);
 		}
 	};
 	struct Extra{
 		float pullIterationCount;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", pullIterationCount);
+			writeFloat(file,"",pullIterationCount);
 		}
 	};
 	struct Stiffness{
@@ -275,25 +275,25 @@ public:
 		float rightKneeCompressionFactor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", neckStiffness);
-			fprintf(file,"%f ", leftShoulderStiffness);
-			fprintf(file,"%f ", leftArmStiffness);
-			fprintf(file,"%f ", leftElbowMaxExtension);
-			fprintf(file,"%f ", leftElbowCompressionFactor);
-			fprintf(file,"%f ", rightShoulderStiffness);
-			fprintf(file,"%f ", rightArmStiffness);
-			fprintf(file,"%f ", rightElbowMaxExtension);
-			fprintf(file,"%f ", rightElbowCompressionFactor);
-			fprintf(file,"%f ", hipsEnforceGravity);
-			fprintf(file,"%f ", chestStiffness);
-			fprintf(file,"%f ", spineStiffness);
-			fprintf(file,"%f ", hipsStiffness);
-			fprintf(file,"%f ", leftKneeMaxExtension);
-			fprintf(file,"%f ", leftLegStiffness);
-			fprintf(file,"%f ", leftKneeCompressionFactor);
-			fprintf(file,"%f ", rightLegStiffness);
-			fprintf(file,"%f ", rightKneeMaxExtension);
-			fprintf(file,"%f", rightKneeCompressionFactor);
+			writeFloat(file,"",neckStiffness," ");
+			writeFloat(file,"",leftShoulderStiffness," ");
+			writeFloat(file,"",leftArmStiffness," ");
+			writeFloat(file,"",leftElbowMaxExtension," ");
+			writeFloat(file,"",leftElbowCompressionFactor," ");
+			writeFloat(file,"",rightShoulderStiffness," ");
+			writeFloat(file,"",rightArmStiffness," ");
+			writeFloat(file,"",rightElbowMaxExtension," ");
+			writeFloat(file,"",rightElbowCompressionFactor," ");
+			writeFloat(file,"",hipsEnforceGravity," ");
+			writeFloat(file,"",chestStiffness," ");
+			writeFloat(file,"",spineStiffness," ");
+			writeFloat(file,"",hipsStiffness," ");
+			writeFloat(file,"",leftKneeMaxExtension," ");
+			writeFloat(file,"",leftLegStiffness," ");
+			writeFloat(file,"",leftKneeCompressionFactor," ");
+			writeFloat(file,"",rightLegStiffness," ");
+			writeFloat(file,"",rightKneeMaxExtension," ");
+			writeFloat(file,"",rightKneeCompressionFactor);
 		}
 	};
 	struct KillPitch{
@@ -303,10 +303,10 @@ public:
 		bool rightKneeKillPitch;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", leftElbowKillPitch);
-			fprintf(file,"%i ", rightElbowKillPitch);
-			fprintf(file,"%i ", leftKneeKillPitch);
-			fprintf(file,"%i", rightKneeKillPitch);
+			writeInt(file,"",leftElbowKillPitch," ");
+			writeInt(file,"",rightElbowKillPitch," ");
+			writeInt(file,"",leftKneeKillPitch," ");
+			writeInt(file,"",rightKneeKillPitch);
 		}
 	};
 	struct RollExtraction{
@@ -329,23 +329,23 @@ public:
 		float rightLegRoll;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", rollExtractionMode);
-			fprintf(file,"%i ", leftArmRollMode);
-			fprintf(file,"%f ", leftArmRoll);
-			fprintf(file,"%i ", leftForeArmRollMode);
-			fprintf(file,"%f ", leftForeArmRoll);
-			fprintf(file,"%i ", rightArmRollMode);
-			fprintf(file,"%f ", rightArmRoll);
-			fprintf(file,"%i ", rightForeArmRollMode);
-			fprintf(file,"%f ", rightForeArmRoll);
-			fprintf(file,"%i ", leftUpLegRollMode);
-			fprintf(file,"%f ", leftUpLegRoll);
-			fprintf(file,"%i ", leftLegRollMode);
-			fprintf(file,"%f ", leftLegRoll);
-			fprintf(file,"%i ", rightUpLegRollMode);
-			fprintf(file,"%f ", rightUpLegRoll);
-			fprintf(file,"%i ", rightLegRollMode);
-			fprintf(file,"%f", rightLegRoll);
+			writeInt(file,"",rollExtractionMode," ");
+			writeInt(file,"",leftArmRollMode," ");
+			writeFloat(file,"",leftArmRoll," ");
+			writeInt(file,"",leftForeArmRollMode," ");
+			writeFloat(file,"",leftForeArmRoll," ");
+			writeInt(file,"",rightArmRollMode," ");
+			writeFloat(file,"",rightArmRoll," ");
+			writeInt(file,"",rightForeArmRollMode," ");
+			writeFloat(file,"",rightForeArmRoll," ");
+			writeInt(file,"",leftUpLegRollMode," ");
+			writeFloat(file,"",leftUpLegRoll," ");
+			writeInt(file,"",leftLegRollMode," ");
+			writeFloat(file,"",leftLegRoll," ");
+			writeInt(file,"",rightUpLegRollMode," ");
+			writeFloat(file,"",rightUpLegRoll," ");
+			writeInt(file,"",rightLegRollMode," ");
+			writeFloat(file,"",rightLegRoll);
 		}
 	};
 public:
@@ -358,1410 +358,1410 @@ public:
 	void setTime(double tim)
 	{
 		if(tim == 0) return;
-		fprintf(mFile,"\tsetAttr \".tim\" %f;\n", tim);
+		writeFloat(mFile,"\tsetAttr \".tim\" ",tim,";\n");
 	}
 	void setDefaultMatrix(size_t dm_i,const matrix& dm)
 	{
 		if(dm == identity) return;
-		fprintf(mFile,"\tsetAttr \".dm[%i]\" -type \"matrix\" ",dm_i);
+		writeInt(mFile,"\tsetAttr \".dm[",dm_i,"]\" -type \"matrix\" ");
 		dm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefaultMatrix(size_t dm_start,size_t dm_end,matrix* dm)
 	{
-		fprintf(mFile,"\tsetAttr \".dm[%i:%i]\" ", dm_start,dm_end);
+		writeInt(mFile,"\tsetAttr \".dm[",dm_start); writeInt(mFile,":",dm_end,"]\" ");
 		size_t size = (dm_end-dm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			dm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDefaultMatrix(size_t dm_start,size_t dm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".dm[%i:%i]\"",dm_start,dm_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".dm[",dm_start); writeInt(mFile,":",dm_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendDefaultMatrix(const matrix& dm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		dm.write(mFile);
 	}
 	void endDefaultMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStancePoseMatrix(size_t sm_i,const matrix& sm)
 	{
 		if(sm == identity) return;
-		fprintf(mFile,"\tsetAttr \".sm[%i]\" -type \"matrix\" ",sm_i);
+		writeInt(mFile,"\tsetAttr \".sm[",sm_i,"]\" -type \"matrix\" ");
 		sm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStancePoseMatrix(size_t sm_start,size_t sm_end,matrix* sm)
 	{
-		fprintf(mFile,"\tsetAttr \".sm[%i:%i]\" ", sm_start,sm_end);
+		writeInt(mFile,"\tsetAttr \".sm[",sm_start); writeInt(mFile,":",sm_end,"]\" ");
 		size_t size = (sm_end-sm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			sm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startStancePoseMatrix(size_t sm_start,size_t sm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sm[%i:%i]\"",sm_start,sm_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".sm[",sm_start); writeInt(mFile,":",sm_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendStancePoseMatrix(const matrix& sm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		sm.write(mFile);
 	}
 	void endStancePoseMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUsingMB55Rig(bool m55)
 	{
 		if(m55 == false) return;
-		fprintf(mFile,"\tsetAttr \".m55\" %i;\n", m55);
+		writeInt(mFile,"\tsetAttr \".m55\" ",m55,";\n");
 	}
 	void setActivate(bool act)
 	{
 		if(act == true) return;
-		fprintf(mFile,"\tsetAttr \".act\" %i;\n", act);
+		writeInt(mFile,"\tsetAttr \".act\" ",act,";\n");
 	}
 	void setConvertScale(bool cs)
 	{
 		if(cs == true) return;
-		fprintf(mFile,"\tsetAttr \".cs\" %i;\n", cs);
+		writeInt(mFile,"\tsetAttr \".cs\" ",cs,";\n");
 	}
 	void setSolving(const Solving& sol)
 	{
-		fprintf(mFile,"\tsetAttr \".sol\" ");
+		writeString(mFile,"\tsetAttr \".sol\" ");
 		sol.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPostureType(unsigned int pt)
 	{
 		if(pt == 0) return;
-		fprintf(mFile,"\tsetAttr \".sol.pt\" %i;\n", pt);
+		writeInt(mFile,"\tsetAttr \".sol.pt\" ",pt,";\n");
 	}
 	void setExpertMode(bool exp)
 	{
 		if(exp == 0) return;
-		fprintf(mFile,"\tsetAttr \".sol.exp\" %i;\n", exp);
+		writeInt(mFile,"\tsetAttr \".sol.exp\" ",exp,";\n");
 	}
 	void setRealisticShoulderSolving(float rss)
 	{
 		if(rss == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".sol.rss\" %f;\n", rss);
+		writeFloat(mFile,"\tsetAttr \".sol.rss\" ",rss,";\n");
 	}
 	void setSolveFingers(bool sf)
 	{
 		if(sf == 1) return;
-		fprintf(mFile,"\tsetAttr \".sol.sf\" %i;\n", sf);
+		writeInt(mFile,"\tsetAttr \".sol.sf\" ",sf,";\n");
 	}
 	void setHipTranslationMode(unsigned int htm)
 	{
 		if(htm == 0) return;
-		fprintf(mFile,"\tsetAttr \".sol.htm\" %i;\n", htm);
+		writeInt(mFile,"\tsetAttr \".sol.htm\" ",htm,";\n");
 	}
 	void setFloorContacts(const FloorContacts& fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc\" ");
+		writeString(mFile,"\tsetAttr \".fc\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHandsFloorContact(bool hfc)
 	{
 		if(hfc == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc.hfc\" %i;\n", hfc);
+		writeInt(mFile,"\tsetAttr \".fc.hfc\" ",hfc,";\n");
 	}
 	void setFeetFloorContact(bool fec)
 	{
 		if(fec == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fec\" %i;\n", fec);
+		writeInt(mFile,"\tsetAttr \".fc.fec\" ",fec,";\n");
 	}
 	void setFingersFloorContact(bool fic)
 	{
 		if(fic == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fic\" %i;\n", fic);
+		writeInt(mFile,"\tsetAttr \".fc.fic\" ",fic,";\n");
 	}
 	void setToesFloorContact(bool tfc)
 	{
 		if(tfc == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc.tfc\" %i;\n", tfc);
+		writeInt(mFile,"\tsetAttr \".fc.tfc\" ",tfc,";\n");
 	}
 	void setHandsFloorContactSetup(const HandsFloorContactSetup& flc)
 	{
-		fprintf(mFile,"\tsetAttr \".flc\" ");
+		writeString(mFile,"\tsetAttr \".flc\" ");
 		flc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHandsFloorPivot(unsigned int hfp)
 	{
 		if(hfp == 0) return;
-		fprintf(mFile,"\tsetAttr \".flc.hfp\" %i;\n", hfp);
+		writeInt(mFile,"\tsetAttr \".flc.hfp\" ",hfp,";\n");
 	}
 	void setHandsContactType(unsigned int hct)
 	{
 		if(hct == 0) return;
-		fprintf(mFile,"\tsetAttr \".flc.hct\" %i;\n", hct);
+		writeInt(mFile,"\tsetAttr \".flc.hct\" ",hct,";\n");
 	}
 	void setHandsContactStiffness(float hcs)
 	{
 		if(hcs == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flc.hcs\" %f;\n", hcs);
+		writeFloat(mFile,"\tsetAttr \".flc.hcs\" ",hcs,";\n");
 	}
 	void setContactsPosition(const ContactsPosition& cp)
 	{
-		fprintf(mFile,"\tsetAttr \".cp\" ");
+		writeString(mFile,"\tsetAttr \".cp\" ");
 		cp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHandHeight(float hh)
 	{
 		if(hh == 7.50) return;
-		fprintf(mFile,"\tsetAttr \".cp.hh\" %f;\n", hh);
+		writeFloat(mFile,"\tsetAttr \".cp.hh\" ",hh,";\n");
 	}
 	void setHandBack(float hb)
 	{
 		if(hb == 4.50) return;
-		fprintf(mFile,"\tsetAttr \".cp.hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".cp.hb\" ",hb,";\n");
 	}
 	void setHandMiddle(float hm)
 	{
 		if(hm == 13.00) return;
-		fprintf(mFile,"\tsetAttr \".cp.hm\" %f;\n", hm);
+		writeFloat(mFile,"\tsetAttr \".cp.hm\" ",hm,";\n");
 	}
 	void setHandFront(float hf)
 	{
 		if(hf == 7.00) return;
-		fprintf(mFile,"\tsetAttr \".cp.hf\" %f;\n", hf);
+		writeFloat(mFile,"\tsetAttr \".cp.hf\" ",hf,";\n");
 	}
 	void setHandInSide(float his)
 	{
 		if(his == 5.00) return;
-		fprintf(mFile,"\tsetAttr \".cp.his\" %f;\n", his);
+		writeFloat(mFile,"\tsetAttr \".cp.his\" ",his,";\n");
 	}
 	void setHandOutSide(float hos)
 	{
 		if(hos == 5.00) return;
-		fprintf(mFile,"\tsetAttr \".cp.hos\" %f;\n", hos);
+		writeFloat(mFile,"\tsetAttr \".cp.hos\" ",hos,";\n");
 	}
 	void setFeetFloorContactSetup(const FeetFloorContactSetup& fle)
 	{
-		fprintf(mFile,"\tsetAttr \".fle\" ");
+		writeString(mFile,"\tsetAttr \".fle\" ");
 		fle.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFeetFloorPivot(unsigned int fpv)
 	{
 		if(fpv == 0) return;
-		fprintf(mFile,"\tsetAttr \".fle.fpv\" %i;\n", fpv);
+		writeInt(mFile,"\tsetAttr \".fle.fpv\" ",fpv,";\n");
 	}
 	void setFeetContactType(unsigned int fct)
 	{
 		if(fct == 0) return;
-		fprintf(mFile,"\tsetAttr \".fle.fct\" %i;\n", fct);
+		writeInt(mFile,"\tsetAttr \".fle.fct\" ",fct,";\n");
 	}
 	void setFeetContactStiffness(float fcs)
 	{
 		if(fcs == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".fle.fcs\" %f;\n", fcs);
+		writeFloat(mFile,"\tsetAttr \".fle.fcs\" ",fcs,";\n");
 	}
 	void setFeetContactPosition(const FeetContactPosition& flf)
 	{
-		fprintf(mFile,"\tsetAttr \".flf\" ");
+		writeString(mFile,"\tsetAttr \".flf\" ");
 		flf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFootHeight(float fh)
 	{
 		if(fh == 7.50) return;
-		fprintf(mFile,"\tsetAttr \".flf.fh\" %f;\n", fh);
+		writeFloat(mFile,"\tsetAttr \".flf.fh\" ",fh,";\n");
 	}
 	void setFootBack(float fra)
 	{
 		if(fra == 4.50) return;
-		fprintf(mFile,"\tsetAttr \".flf.fra\" %f;\n", fra);
+		writeFloat(mFile,"\tsetAttr \".flf.fra\" ",fra,";\n");
 	}
 	void setFootMiddle(float fma)
 	{
 		if(fma == 13.00) return;
-		fprintf(mFile,"\tsetAttr \".flf.fma\" %f;\n", fma);
+		writeFloat(mFile,"\tsetAttr \".flf.fma\" ",fma,";\n");
 	}
 	void setFootFront(float ffm)
 	{
 		if(ffm == 7.00) return;
-		fprintf(mFile,"\tsetAttr \".flf.ffm\" %f;\n", ffm);
+		writeFloat(mFile,"\tsetAttr \".flf.ffm\" ",ffm,";\n");
 	}
 	void setFootInSide(float fia)
 	{
 		if(fia == 5.00) return;
-		fprintf(mFile,"\tsetAttr \".flf.fia\" %f;\n", fia);
+		writeFloat(mFile,"\tsetAttr \".flf.fia\" ",fia,";\n");
 	}
 	void setFootOutSide(float foa)
 	{
 		if(foa == 5.00) return;
-		fprintf(mFile,"\tsetAttr \".flf.foa\" %f;\n", foa);
+		writeFloat(mFile,"\tsetAttr \".flf.foa\" ",foa,";\n");
 	}
 	void setFingersFloorContactSetup(const FingersFloorContactSetup& flg)
 	{
-		fprintf(mFile,"\tsetAttr \".flg\" ");
+		writeString(mFile,"\tsetAttr \".flg\" ");
 		flg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFingersContactType(unsigned int fcm)
 	{
 		if(fcm == 1) return;
-		fprintf(mFile,"\tsetAttr \".flg.fcm\" %i;\n", fcm);
+		writeInt(mFile,"\tsetAttr \".flg.fcm\" ",fcm,";\n");
 	}
 	void setFingersContactRollStiffness(float hcr)
 	{
 		if(hcr == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flg.hcr\" %f;\n", hcr);
+		writeFloat(mFile,"\tsetAttr \".flg.hcr\" ",hcr,";\n");
 	}
 	void setFingerTipsSizes(const FingerTipsSizes& fts)
 	{
-		fprintf(mFile,"\tsetAttr \".fts\" ");
+		writeString(mFile,"\tsetAttr \".fts\" ");
 		fts.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeftHandThumbTip(float ltt)
 	{
 		if(ltt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.ltt\" %f;\n", ltt);
+		writeFloat(mFile,"\tsetAttr \".fts.ltt\" ",ltt,";\n");
 	}
 	void setLeftHandIndexTip(float lit)
 	{
 		if(lit == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.lit\" %f;\n", lit);
+		writeFloat(mFile,"\tsetAttr \".fts.lit\" ",lit,";\n");
 	}
 	void setLeftHandMiddleTip(float lmt)
 	{
 		if(lmt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.lmt\" %f;\n", lmt);
+		writeFloat(mFile,"\tsetAttr \".fts.lmt\" ",lmt,";\n");
 	}
 	void setLeftHandRingTip(float lrt)
 	{
 		if(lrt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.lrt\" %f;\n", lrt);
+		writeFloat(mFile,"\tsetAttr \".fts.lrt\" ",lrt,";\n");
 	}
 	void setLeftHandPinkyTip(float lpt)
 	{
 		if(lpt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.lpt\" %f;\n", lpt);
+		writeFloat(mFile,"\tsetAttr \".fts.lpt\" ",lpt,";\n");
 	}
 	void setLeftHandExtraFingerTip(float lxt)
 	{
 		if(lxt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.lxt\" %f;\n", lxt);
+		writeFloat(mFile,"\tsetAttr \".fts.lxt\" ",lxt,";\n");
 	}
 	void setRightHandThumbTip(float rtt)
 	{
 		if(rtt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.rtt\" %f;\n", rtt);
+		writeFloat(mFile,"\tsetAttr \".fts.rtt\" ",rtt,";\n");
 	}
 	void setRightHandIndexTip(float rit)
 	{
 		if(rit == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.rit\" %f;\n", rit);
+		writeFloat(mFile,"\tsetAttr \".fts.rit\" ",rit,";\n");
 	}
 	void setRightHandMiddleTip(float rmt)
 	{
 		if(rmt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.rmt\" %f;\n", rmt);
+		writeFloat(mFile,"\tsetAttr \".fts.rmt\" ",rmt,";\n");
 	}
 	void setRightHandRingTip(float rrt)
 	{
 		if(rrt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.rrt\" %f;\n", rrt);
+		writeFloat(mFile,"\tsetAttr \".fts.rrt\" ",rrt,";\n");
 	}
 	void setRightHandPinkyTip(float rpp)
 	{
 		if(rpp == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.rpp\" %f;\n", rpp);
+		writeFloat(mFile,"\tsetAttr \".fts.rpp\" ",rpp,";\n");
 	}
 	void setRightHandExtraFingerTip(float rxt)
 	{
 		if(rxt == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".fts.rxt\" %f;\n", rxt);
+		writeFloat(mFile,"\tsetAttr \".fts.rxt\" ",rxt,";\n");
 	}
 	void setToesFloorContactSetup(const ToesFloorContactSetup& fli)
 	{
-		fprintf(mFile,"\tsetAttr \".fli\" ");
+		writeString(mFile,"\tsetAttr \".fli\" ");
 		fli.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setToesContactType(unsigned int tct)
 	{
 		if(tct == 1) return;
-		fprintf(mFile,"\tsetAttr \".fli.tct\" %i;\n", tct);
+		writeInt(mFile,"\tsetAttr \".fli.tct\" ",tct,";\n");
 	}
 	void setToesContactRollStiffness(float fcr)
 	{
 		if(fcr == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".fli.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fli.fcr\" ",fcr,";\n");
 	}
 	void setToeTipsSizes(const ToeTipsSizes& flj)
 	{
-		fprintf(mFile,"\tsetAttr \".flj\" ");
+		writeString(mFile,"\tsetAttr \".flj\" ");
 		flj.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeftFootThumbTip(float ttl)
 	{
 		if(ttl == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.ttl\" %f;\n", ttl);
+		writeFloat(mFile,"\tsetAttr \".flj.ttl\" ",ttl,";\n");
 	}
 	void setLeftFootIndexTip(float til)
 	{
 		if(til == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.til\" %f;\n", til);
+		writeFloat(mFile,"\tsetAttr \".flj.til\" ",til,";\n");
 	}
 	void setLeftFootMiddleTip(float tml)
 	{
 		if(tml == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.tml\" %f;\n", tml);
+		writeFloat(mFile,"\tsetAttr \".flj.tml\" ",tml,";\n");
 	}
 	void setLeftFootRingTip(float trl)
 	{
 		if(trl == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.trl\" %f;\n", trl);
+		writeFloat(mFile,"\tsetAttr \".flj.trl\" ",trl,";\n");
 	}
 	void setLeftFootPinkyTip(float tpl)
 	{
 		if(tpl == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.tpl\" %f;\n", tpl);
+		writeFloat(mFile,"\tsetAttr \".flj.tpl\" ",tpl,";\n");
 	}
 	void setLeftFootExtraFingerTip(float txl)
 	{
 		if(txl == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.txl\" %f;\n", txl);
+		writeFloat(mFile,"\tsetAttr \".flj.txl\" ",txl,";\n");
 	}
 	void setRightFootThumbTip(float ttr)
 	{
 		if(ttr == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.ttr\" %f;\n", ttr);
+		writeFloat(mFile,"\tsetAttr \".flj.ttr\" ",ttr,";\n");
 	}
 	void setRightFootIndexTip(float tir)
 	{
 		if(tir == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.tir\" %f;\n", tir);
+		writeFloat(mFile,"\tsetAttr \".flj.tir\" ",tir,";\n");
 	}
 	void setRightFootMiddleTip(float tmr)
 	{
 		if(tmr == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.tmr\" %f;\n", tmr);
+		writeFloat(mFile,"\tsetAttr \".flj.tmr\" ",tmr,";\n");
 	}
 	void setRightFootRingTip(float trr)
 	{
 		if(trr == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.trr\" %f;\n", trr);
+		writeFloat(mFile,"\tsetAttr \".flj.trr\" ",trr,";\n");
 	}
 	void setRightFootPinkyTip(float tpr)
 	{
 		if(tpr == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.tpr\" %f;\n", tpr);
+		writeFloat(mFile,"\tsetAttr \".flj.tpr\" ",tpr,";\n");
 	}
 	void setRightFootExtraFingerTip(float txr)
 	{
 		if(txr == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".flj.txr\" %f;\n", txr);
+		writeFloat(mFile,"\tsetAttr \".flj.txr\" ",txr,";\n");
 	}
 	void setHead(const Head& fll)
 	{
-		fprintf(mFile,"\tsetAttr \".fll\" ");
+		writeString(mFile,"\tsetAttr \".fll\" ");
 		fll.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHeadPull(float phd)
 	{
 		if(phd == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".fll.phd\" %f;\n", phd);
+		writeFloat(mFile,"\tsetAttr \".fll.phd\" ",phd,";\n");
 	}
 	void setLeftArm(const LeftArm& flm)
 	{
-		fprintf(mFile,"\tsetAttr \".flm\" ");
+		writeString(mFile,"\tsetAttr \".flm\" ");
 		flm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeftElbowPull(float ple)
 	{
 		if(ple == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flm.ple\" %f;\n", ple);
+		writeFloat(mFile,"\tsetAttr \".flm.ple\" ",ple,";\n");
 	}
 	void setLeftHandPullChest(float cpl)
 	{
 		if(cpl == 1.00) return;
-		fprintf(mFile,"\tsetAttr \".flm.cpl\" %f;\n", cpl);
+		writeFloat(mFile,"\tsetAttr \".flm.cpl\" ",cpl,";\n");
 	}
 	void setLeftHandPullHips(float plh)
 	{
 		if(plh == 1.00) return;
-		fprintf(mFile,"\tsetAttr \".flm.plh\" %f;\n", plh);
+		writeFloat(mFile,"\tsetAttr \".flm.plh\" ",plh,";\n");
 	}
 	void setLeftFingerBasePull(float plb)
 	{
 		if(plb == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flm.plb\" %f;\n", plb);
+		writeFloat(mFile,"\tsetAttr \".flm.plb\" ",plb,";\n");
 	}
 	void setRightArm(const RightArm& fln)
 	{
-		fprintf(mFile,"\tsetAttr \".fln\" ");
+		writeString(mFile,"\tsetAttr \".fln\" ");
 		fln.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRightElbowPull(float pre)
 	{
 		if(pre == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".fln.pre\" %f;\n", pre);
+		writeFloat(mFile,"\tsetAttr \".fln.pre\" ",pre,";\n");
 	}
 	void setRightHandPullChest(float cpr)
 	{
 		if(cpr == 1.00) return;
-		fprintf(mFile,"\tsetAttr \".fln.cpr\" %f;\n", cpr);
+		writeFloat(mFile,"\tsetAttr \".fln.cpr\" ",cpr,";\n");
 	}
 	void setRightHandPullHips(float prh)
 	{
 		if(prh == 1.00) return;
-		fprintf(mFile,"\tsetAttr \".fln.prh\" %f;\n", prh);
+		writeFloat(mFile,"\tsetAttr \".fln.prh\" ",prh,";\n");
 	}
 	void setRightFingerBasePull(float prb)
 	{
 		if(prb == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".fln.prb\" %f;\n", prb);
+		writeFloat(mFile,"\tsetAttr \".fln.prb\" ",prb,";\n");
 	}
 	void setChest(const Chest& flo)
 	{
-		fprintf(mFile,"\tsetAttr \".flo\" ");
+		writeString(mFile,"\tsetAttr \".flo\" ");
 		flo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChestPull(float rcp)
 	{
 		if(rcp == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flo.rcp\" %f;\n", rcp);
+		writeFloat(mFile,"\tsetAttr \".flo.rcp\" ",rcp,";\n");
 	}
 	void setHips(const Hips& flp)
 	{
-		fprintf(mFile,"\tsetAttr \".flp\" ");
+		writeString(mFile,"\tsetAttr \".flp\" ");
 		flp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHipsPull(float chp)
 	{
 		if(chp == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flp.chp\" %f;\n", chp);
+		writeFloat(mFile,"\tsetAttr \".flp.chp\" ",chp,";\n");
 	}
 	void setLeftLeg(const LeftLeg& flq)
 	{
-		fprintf(mFile,"\tsetAttr \".flq\" ");
+		writeString(mFile,"\tsetAttr \".flq\" ");
 		flq.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeftKneePull(float plk)
 	{
 		if(plk == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flq.plk\" %f;\n", plk);
+		writeFloat(mFile,"\tsetAttr \".flq.plk\" ",plk,";\n");
 	}
 	void setLeftFootPull(float plf)
 	{
 		if(plf == 1.00) return;
-		fprintf(mFile,"\tsetAttr \".flq.plf\" %f;\n", plf);
+		writeFloat(mFile,"\tsetAttr \".flq.plf\" ",plf,";\n");
 	}
 	void setLeftToeBasePull(float plt)
 	{
 		if(plt == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flq.plt\" %f;\n", plt);
+		writeFloat(mFile,"\tsetAttr \".flq.plt\" ",plt,";\n");
 	}
 	void setRightLeg(const RightLeg& flr)
 	{
-		fprintf(mFile,"\tsetAttr \".flr\" ");
+		writeString(mFile,"\tsetAttr \".flr\" ");
 		flr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRightKneePull(float prk)
 	{
 		if(prk == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flr.prk\" %f;\n", prk);
+		writeFloat(mFile,"\tsetAttr \".flr.prk\" ",prk,";\n");
 	}
 	void setRightFootPull(float prf)
 	{
 		if(prf == 1.00) return;
-		fprintf(mFile,"\tsetAttr \".flr.prf\" %f;\n", prf);
+		writeFloat(mFile,"\tsetAttr \".flr.prf\" ",prf,";\n");
 	}
 	void setRightToeBasePull(float prt)
 	{
 		if(prt == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".flr.prt\" %f;\n", prt);
+		writeFloat(mFile,"\tsetAttr \".flr.prt\" ",prt,";\n");
 	}
 	void setExtra(const Extra& ex)
 	{
-		fprintf(mFile,"\tsetAttr \".ex\" ");
+		writeString(mFile,"\tsetAttr \".ex\" ");
 		ex.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPullIterationCount(float pic)
 	{
 		if(pic == 10.00) return;
-		fprintf(mFile,"\tsetAttr \".ex.pic\" %f;\n", pic);
+		writeFloat(mFile,"\tsetAttr \".ex.pic\" ",pic,";\n");
 	}
 	void setStiffness(const Stiffness& st)
 	{
-		fprintf(mFile,"\tsetAttr \".st\" ");
+		writeString(mFile,"\tsetAttr \".st\" ");
 		st.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNeckStiffness(float nst)
 	{
 		if(nst == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".st.nst\" %f;\n", nst);
+		writeFloat(mFile,"\tsetAttr \".st.nst\" ",nst,";\n");
 	}
 	void setLeftShoulderStiffness(float rlco)
 	{
 		if(rlco == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.rlco\" %f;\n", rlco);
+		writeFloat(mFile,"\tsetAttr \".st.rlco\" ",rlco,";\n");
 	}
 	void setLeftArmStiffness(float rle)
 	{
 		if(rle == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.rle\" %f;\n", rle);
+		writeFloat(mFile,"\tsetAttr \".st.rle\" ",rle,";\n");
 	}
 	void setLeftElbowMaxExtension(float mle)
 	{
 		if(mle == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.mle\" %f;\n", mle);
+		writeFloat(mFile,"\tsetAttr \".st.mle\" ",mle,";\n");
 	}
 	void setLeftElbowCompressionFactor(float cle)
 	{
 		if(cle == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.cle\" %f;\n", cle);
+		writeFloat(mFile,"\tsetAttr \".st.cle\" ",cle,";\n");
 	}
 	void setRightShoulderStiffness(float rrc)
 	{
 		if(rrc == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.rrc\" %f;\n", rrc);
+		writeFloat(mFile,"\tsetAttr \".st.rrc\" ",rrc,";\n");
 	}
 	void setRightArmStiffness(float rre)
 	{
 		if(rre == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.rre\" %f;\n", rre);
+		writeFloat(mFile,"\tsetAttr \".st.rre\" ",rre,";\n");
 	}
 	void setRightElbowMaxExtension(float mre)
 	{
 		if(mre == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.mre\" %f;\n", mre);
+		writeFloat(mFile,"\tsetAttr \".st.mre\" ",mre,";\n");
 	}
 	void setRightElbowCompressionFactor(float cre)
 	{
 		if(cre == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.cre\" %f;\n", cre);
+		writeFloat(mFile,"\tsetAttr \".st.cre\" ",cre,";\n");
 	}
 	void setHipsEnforceGravity(float egr)
 	{
 		if(egr == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".st.egr\" %f;\n", egr);
+		writeFloat(mFile,"\tsetAttr \".st.egr\" ",egr,";\n");
 	}
 	void setChestStiffness(float rco)
 	{
 		if(rco == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".st.rco\" %f;\n", rco);
+		writeFloat(mFile,"\tsetAttr \".st.rco\" ",rco,";\n");
 	}
 	void setSpineStiffness(float sst)
 	{
 		if(sst == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".st.sst\" %f;\n", sst);
+		writeFloat(mFile,"\tsetAttr \".st.sst\" ",sst,";\n");
 	}
 	void setHipsStiffness(float rho)
 	{
 		if(rho == 0.00) return;
-		fprintf(mFile,"\tsetAttr \".st.rho\" %f;\n", rho);
+		writeFloat(mFile,"\tsetAttr \".st.rho\" ",rho,";\n");
 	}
 	void setLeftKneeMaxExtension(float mlk)
 	{
 		if(mlk == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.mlk\" %f;\n", mlk);
+		writeFloat(mFile,"\tsetAttr \".st.mlk\" ",mlk,";\n");
 	}
 	void setLeftLegStiffness(float rlk)
 	{
 		if(rlk == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.rlk\" %f;\n", rlk);
+		writeFloat(mFile,"\tsetAttr \".st.rlk\" ",rlk,";\n");
 	}
 	void setLeftKneeCompressionFactor(float clk)
 	{
 		if(clk == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.clk\" %f;\n", clk);
+		writeFloat(mFile,"\tsetAttr \".st.clk\" ",clk,";\n");
 	}
 	void setRightLegStiffness(float rrk)
 	{
 		if(rrk == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.rrk\" %f;\n", rrk);
+		writeFloat(mFile,"\tsetAttr \".st.rrk\" ",rrk,";\n");
 	}
 	void setRightKneeMaxExtension(float mrk)
 	{
 		if(mrk == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.mrk\" %f;\n", mrk);
+		writeFloat(mFile,"\tsetAttr \".st.mrk\" ",mrk,";\n");
 	}
 	void setRightKneeCompressionFactor(float crk)
 	{
 		if(crk == 0.50) return;
-		fprintf(mFile,"\tsetAttr \".st.crk\" %f;\n", crk);
+		writeFloat(mFile,"\tsetAttr \".st.crk\" ",crk,";\n");
 	}
 	void setKillPitch(const KillPitch& kp)
 	{
-		fprintf(mFile,"\tsetAttr \".kp\" ");
+		writeString(mFile,"\tsetAttr \".kp\" ");
 		kp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLeftElbowKillPitch(bool lek)
 	{
 		if(lek == 0) return;
-		fprintf(mFile,"\tsetAttr \".kp.lek\" %i;\n", lek);
+		writeInt(mFile,"\tsetAttr \".kp.lek\" ",lek,";\n");
 	}
 	void setRightElbowKillPitch(bool rek)
 	{
 		if(rek == 0) return;
-		fprintf(mFile,"\tsetAttr \".kp.rek\" %i;\n", rek);
+		writeInt(mFile,"\tsetAttr \".kp.rek\" ",rek,";\n");
 	}
 	void setLeftKneeKillPitch(bool lkk)
 	{
 		if(lkk == 0) return;
-		fprintf(mFile,"\tsetAttr \".kp.lkk\" %i;\n", lkk);
+		writeInt(mFile,"\tsetAttr \".kp.lkk\" ",lkk,";\n");
 	}
 	void setRightKneeKillPitch(bool rkk)
 	{
 		if(rkk == 0) return;
-		fprintf(mFile,"\tsetAttr \".kp.rkk\" %i;\n", rkk);
+		writeInt(mFile,"\tsetAttr \".kp.rkk\" ",rkk,";\n");
 	}
 	void setRollExtraction(const RollExtraction& re)
 	{
-		fprintf(mFile,"\tsetAttr \".re\" ");
+		writeString(mFile,"\tsetAttr \".re\" ");
 		re.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRollExtractionMode(unsigned int rem)
 	{
 		if(rem == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.rem\" %i;\n", rem);
+		writeInt(mFile,"\tsetAttr \".re.rem\" ",rem,";\n");
 	}
 	void setLeftArmRollMode(bool larm)
 	{
 		if(larm == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.larm\" %i;\n", larm);
+		writeInt(mFile,"\tsetAttr \".re.larm\" ",larm,";\n");
 	}
 	void setLeftArmRoll(float lar)
 	{
 		if(lar == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".re.lar\" %f;\n", lar);
+		writeFloat(mFile,"\tsetAttr \".re.lar\" ",lar,";\n");
 	}
 	void setLeftForeArmRollMode(bool lfrm)
 	{
 		if(lfrm == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.lfrm\" %i;\n", lfrm);
+		writeInt(mFile,"\tsetAttr \".re.lfrm\" ",lfrm,";\n");
 	}
 	void setLeftForeArmRoll(float lfr)
 	{
 		if(lfr == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".re.lfr\" %f;\n", lfr);
+		writeFloat(mFile,"\tsetAttr \".re.lfr\" ",lfr,";\n");
 	}
 	void setRightArmRollMode(bool rarm)
 	{
 		if(rarm == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.rarm\" %i;\n", rarm);
+		writeInt(mFile,"\tsetAttr \".re.rarm\" ",rarm,";\n");
 	}
 	void setRightArmRoll(float rar)
 	{
 		if(rar == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".re.rar\" %f;\n", rar);
+		writeFloat(mFile,"\tsetAttr \".re.rar\" ",rar,";\n");
 	}
 	void setRightForeArmRollMode(bool rfrm)
 	{
 		if(rfrm == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.rfrm\" %i;\n", rfrm);
+		writeInt(mFile,"\tsetAttr \".re.rfrm\" ",rfrm,";\n");
 	}
 	void setRightForeArmRoll(float rfr)
 	{
 		if(rfr == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".re.rfr\" %f;\n", rfr);
+		writeFloat(mFile,"\tsetAttr \".re.rfr\" ",rfr,";\n");
 	}
 	void setLeftUpLegRollMode(bool lurm)
 	{
 		if(lurm == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.lurm\" %i;\n", lurm);
+		writeInt(mFile,"\tsetAttr \".re.lurm\" ",lurm,";\n");
 	}
 	void setLeftUpLegRoll(float lur)
 	{
 		if(lur == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".re.lur\" %f;\n", lur);
+		writeFloat(mFile,"\tsetAttr \".re.lur\" ",lur,";\n");
 	}
 	void setLeftLegRollMode(bool llrm)
 	{
 		if(llrm == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.llrm\" %i;\n", llrm);
+		writeInt(mFile,"\tsetAttr \".re.llrm\" ",llrm,";\n");
 	}
 	void setLeftLegRoll(float llr)
 	{
 		if(llr == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".re.llr\" %f;\n", llr);
+		writeFloat(mFile,"\tsetAttr \".re.llr\" ",llr,";\n");
 	}
 	void setRightUpLegRollMode(bool rurm)
 	{
 		if(rurm == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.rurm\" %i;\n", rurm);
+		writeInt(mFile,"\tsetAttr \".re.rurm\" ",rurm,";\n");
 	}
 	void setRightUpLegRoll(float rur)
 	{
 		if(rur == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".re.rur\" %f;\n", rur);
+		writeFloat(mFile,"\tsetAttr \".re.rur\" ",rur,";\n");
 	}
 	void setRightLegRollMode(bool rlrm)
 	{
 		if(rlrm == 0) return;
-		fprintf(mFile,"\tsetAttr \".re.rlrm\" %i;\n", rlrm);
+		writeInt(mFile,"\tsetAttr \".re.rlrm\" ",rlrm,";\n");
 	}
 	void setRightLegRoll(float rlro)
 	{
 		if(rlro == 0.60) return;
-		fprintf(mFile,"\tsetAttr \".re.rlro\" %f;\n", rlro);
+		writeFloat(mFile,"\tsetAttr \".re.rlro\" ",rlro,";\n");
 	}
 	void getEffectors(size_t eff_i)const
 	{
-		fprintf(mFile,"\"%s.eff[%i]\"",mName.c_str(),eff_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eff[",eff_i,"]\"");
 	}
 	void getEffectors()const
 	{
 
-		fprintf(mFile,"\"%s.eff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eff\"");
 	}
 	void getLeftFootGroundPlane()const
 	{
-		fprintf(mFile,"\"%s.lfg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfg\"");
 	}
 	void getRightFootGroundPlane()const
 	{
-		fprintf(mFile,"\"%s.rfg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfg\"");
 	}
 	void getRightFootOrientedGroundPlane()const
 	{
-		fprintf(mFile,"\"%s.rog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rog\"");
 	}
 	void getLeftFootOrientedGroundPlane()const
 	{
-		fprintf(mFile,"\"%s.log\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".log\"");
 	}
 	void getLeftHandGroundPlane()const
 	{
-		fprintf(mFile,"\"%s.lhg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lhg\"");
 	}
 	void getRightHandGroundPlane()const
 	{
-		fprintf(mFile,"\"%s.rhg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rhg\"");
 	}
 	void getLeftHandOrientedGroundPlane()const
 	{
-		fprintf(mFile,"\"%s.loh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".loh\"");
 	}
 	void getRightHandOrientedGroundPlane()const
 	{
-		fprintf(mFile,"\"%s.roh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".roh\"");
 	}
 	void getJoints(size_t jt_i)const
 	{
-		fprintf(mFile,"\"%s.jt[%i]\"",mName.c_str(),jt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".jt[",jt_i,"]\"");
 	}
 	void getJoints()const
 	{
 
-		fprintf(mFile,"\"%s.jt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jt\"");
 	}
 	void getFkjoints(size_t fj_i)const
 	{
-		fprintf(mFile,"\"%s.fj[%i]\"",mName.c_str(),fj_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fj[",fj_i,"]\"");
 	}
 	void getFkjoints()const
 	{
 
-		fprintf(mFile,"\"%s.fj\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fj\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.tim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tim\"");
 	}
 	void getDefaultMatrix(size_t dm_i)const
 	{
-		fprintf(mFile,"\"%s.dm[%i]\"",mName.c_str(),dm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dm[",dm_i,"]\"");
 	}
 	void getDefaultMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.dm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dm\"");
 	}
 	void getStancePoseMatrix(size_t sm_i)const
 	{
-		fprintf(mFile,"\"%s.sm[%i]\"",mName.c_str(),sm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sm[",sm_i,"]\"");
 	}
 	void getStancePoseMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.sm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sm\"");
 	}
 	void getUsingMB55Rig()const
 	{
-		fprintf(mFile,"\"%s.m55\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m55\"");
 	}
 	void getActivate()const
 	{
-		fprintf(mFile,"\"%s.act\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".act\"");
 	}
 	void getConvertScale()const
 	{
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getPropertyChanged()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getSolving()const
 	{
-		fprintf(mFile,"\"%s.sol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sol\"");
 	}
 	void getPostureType()const
 	{
-		fprintf(mFile,"\"%s.sol.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sol.pt\"");
 	}
 	void getExpertMode()const
 	{
-		fprintf(mFile,"\"%s.sol.exp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sol.exp\"");
 	}
 	void getRealisticShoulderSolving()const
 	{
-		fprintf(mFile,"\"%s.sol.rss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sol.rss\"");
 	}
 	void getSolveFingers()const
 	{
-		fprintf(mFile,"\"%s.sol.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sol.sf\"");
 	}
 	void getHipTranslationMode()const
 	{
-		fprintf(mFile,"\"%s.sol.htm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sol.htm\"");
 	}
 	void getFloorContacts()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getHandsFloorContact()const
 	{
-		fprintf(mFile,"\"%s.fc.hfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.hfc\"");
 	}
 	void getFeetFloorContact()const
 	{
-		fprintf(mFile,"\"%s.fc.fec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fec\"");
 	}
 	void getFingersFloorContact()const
 	{
-		fprintf(mFile,"\"%s.fc.fic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fic\"");
 	}
 	void getToesFloorContact()const
 	{
-		fprintf(mFile,"\"%s.fc.tfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.tfc\"");
 	}
 	void getHandsFloorContactSetup()const
 	{
-		fprintf(mFile,"\"%s.flc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc\"");
 	}
 	void getHandsFloorPivot()const
 	{
-		fprintf(mFile,"\"%s.flc.hfp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc.hfp\"");
 	}
 	void getHandsContactType()const
 	{
-		fprintf(mFile,"\"%s.flc.hct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc.hct\"");
 	}
 	void getHandsContactStiffness()const
 	{
-		fprintf(mFile,"\"%s.flc.hcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flc.hcs\"");
 	}
 	void getContactsPosition()const
 	{
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getHandHeight()const
 	{
-		fprintf(mFile,"\"%s.cp.hh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hh\"");
 	}
 	void getHandBack()const
 	{
-		fprintf(mFile,"\"%s.cp.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hb\"");
 	}
 	void getHandMiddle()const
 	{
-		fprintf(mFile,"\"%s.cp.hm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hm\"");
 	}
 	void getHandFront()const
 	{
-		fprintf(mFile,"\"%s.cp.hf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hf\"");
 	}
 	void getHandInSide()const
 	{
-		fprintf(mFile,"\"%s.cp.his\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.his\"");
 	}
 	void getHandOutSide()const
 	{
-		fprintf(mFile,"\"%s.cp.hos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.hos\"");
 	}
 	void getFeetFloorContactSetup()const
 	{
-		fprintf(mFile,"\"%s.fle\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fle\"");
 	}
 	void getFeetFloorPivot()const
 	{
-		fprintf(mFile,"\"%s.fle.fpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fle.fpv\"");
 	}
 	void getFeetContactType()const
 	{
-		fprintf(mFile,"\"%s.fle.fct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fle.fct\"");
 	}
 	void getFeetContactStiffness()const
 	{
-		fprintf(mFile,"\"%s.fle.fcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fle.fcs\"");
 	}
 	void getFeetContactPosition()const
 	{
-		fprintf(mFile,"\"%s.flf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf\"");
 	}
 	void getFootHeight()const
 	{
-		fprintf(mFile,"\"%s.flf.fh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.fh\"");
 	}
 	void getFootBack()const
 	{
-		fprintf(mFile,"\"%s.flf.fra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.fra\"");
 	}
 	void getFootMiddle()const
 	{
-		fprintf(mFile,"\"%s.flf.fma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.fma\"");
 	}
 	void getFootFront()const
 	{
-		fprintf(mFile,"\"%s.flf.ffm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.ffm\"");
 	}
 	void getFootInSide()const
 	{
-		fprintf(mFile,"\"%s.flf.fia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.fia\"");
 	}
 	void getFootOutSide()const
 	{
-		fprintf(mFile,"\"%s.flf.foa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flf.foa\"");
 	}
 	void getFingersFloorContactSetup()const
 	{
-		fprintf(mFile,"\"%s.flg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flg\"");
 	}
 	void getFingersContactType()const
 	{
-		fprintf(mFile,"\"%s.flg.fcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flg.fcm\"");
 	}
 	void getFingersContactRollStiffness()const
 	{
-		fprintf(mFile,"\"%s.flg.hcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flg.hcr\"");
 	}
 	void getFingerTipsSizes()const
 	{
-		fprintf(mFile,"\"%s.fts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts\"");
 	}
 	void getLeftHandThumbTip()const
 	{
-		fprintf(mFile,"\"%s.fts.ltt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.ltt\"");
 	}
 	void getLeftHandIndexTip()const
 	{
-		fprintf(mFile,"\"%s.fts.lit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.lit\"");
 	}
 	void getLeftHandMiddleTip()const
 	{
-		fprintf(mFile,"\"%s.fts.lmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.lmt\"");
 	}
 	void getLeftHandRingTip()const
 	{
-		fprintf(mFile,"\"%s.fts.lrt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.lrt\"");
 	}
 	void getLeftHandPinkyTip()const
 	{
-		fprintf(mFile,"\"%s.fts.lpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.lpt\"");
 	}
 	void getLeftHandExtraFingerTip()const
 	{
-		fprintf(mFile,"\"%s.fts.lxt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.lxt\"");
 	}
 	void getRightHandThumbTip()const
 	{
-		fprintf(mFile,"\"%s.fts.rtt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.rtt\"");
 	}
 	void getRightHandIndexTip()const
 	{
-		fprintf(mFile,"\"%s.fts.rit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.rit\"");
 	}
 	void getRightHandMiddleTip()const
 	{
-		fprintf(mFile,"\"%s.fts.rmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.rmt\"");
 	}
 	void getRightHandRingTip()const
 	{
-		fprintf(mFile,"\"%s.fts.rrt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.rrt\"");
 	}
 	void getRightHandPinkyTip()const
 	{
-		fprintf(mFile,"\"%s.fts.rpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.rpp\"");
 	}
 	void getRightHandExtraFingerTip()const
 	{
-		fprintf(mFile,"\"%s.fts.rxt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fts.rxt\"");
 	}
 	void getToesFloorContactSetup()const
 	{
-		fprintf(mFile,"\"%s.fli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fli\"");
 	}
 	void getToesContactType()const
 	{
-		fprintf(mFile,"\"%s.fli.tct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fli.tct\"");
 	}
 	void getToesContactRollStiffness()const
 	{
-		fprintf(mFile,"\"%s.fli.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fli.fcr\"");
 	}
 	void getToeTipsSizes()const
 	{
-		fprintf(mFile,"\"%s.flj\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj\"");
 	}
 	void getLeftFootThumbTip()const
 	{
-		fprintf(mFile,"\"%s.flj.ttl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.ttl\"");
 	}
 	void getLeftFootIndexTip()const
 	{
-		fprintf(mFile,"\"%s.flj.til\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.til\"");
 	}
 	void getLeftFootMiddleTip()const
 	{
-		fprintf(mFile,"\"%s.flj.tml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.tml\"");
 	}
 	void getLeftFootRingTip()const
 	{
-		fprintf(mFile,"\"%s.flj.trl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.trl\"");
 	}
 	void getLeftFootPinkyTip()const
 	{
-		fprintf(mFile,"\"%s.flj.tpl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.tpl\"");
 	}
 	void getLeftFootExtraFingerTip()const
 	{
-		fprintf(mFile,"\"%s.flj.txl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.txl\"");
 	}
 	void getRightFootThumbTip()const
 	{
-		fprintf(mFile,"\"%s.flj.ttr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.ttr\"");
 	}
 	void getRightFootIndexTip()const
 	{
-		fprintf(mFile,"\"%s.flj.tir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.tir\"");
 	}
 	void getRightFootMiddleTip()const
 	{
-		fprintf(mFile,"\"%s.flj.tmr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.tmr\"");
 	}
 	void getRightFootRingTip()const
 	{
-		fprintf(mFile,"\"%s.flj.trr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.trr\"");
 	}
 	void getRightFootPinkyTip()const
 	{
-		fprintf(mFile,"\"%s.flj.tpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.tpr\"");
 	}
 	void getRightFootExtraFingerTip()const
 	{
-		fprintf(mFile,"\"%s.flj.txr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flj.txr\"");
 	}
 	void getHead()const
 	{
-		fprintf(mFile,"\"%s.fll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fll\"");
 	}
 	void getHeadPull()const
 	{
-		fprintf(mFile,"\"%s.fll.phd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fll.phd\"");
 	}
 	void getLeftArm()const
 	{
-		fprintf(mFile,"\"%s.flm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flm\"");
 	}
 	void getLeftElbowPull()const
 	{
-		fprintf(mFile,"\"%s.flm.ple\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flm.ple\"");
 	}
 	void getLeftHandPullChest()const
 	{
-		fprintf(mFile,"\"%s.flm.cpl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flm.cpl\"");
 	}
 	void getLeftHandPullHips()const
 	{
-		fprintf(mFile,"\"%s.flm.plh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flm.plh\"");
 	}
 	void getLeftFingerBasePull()const
 	{
-		fprintf(mFile,"\"%s.flm.plb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flm.plb\"");
 	}
 	void getRightArm()const
 	{
-		fprintf(mFile,"\"%s.fln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fln\"");
 	}
 	void getRightElbowPull()const
 	{
-		fprintf(mFile,"\"%s.fln.pre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fln.pre\"");
 	}
 	void getRightHandPullChest()const
 	{
-		fprintf(mFile,"\"%s.fln.cpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fln.cpr\"");
 	}
 	void getRightHandPullHips()const
 	{
-		fprintf(mFile,"\"%s.fln.prh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fln.prh\"");
 	}
 	void getRightFingerBasePull()const
 	{
-		fprintf(mFile,"\"%s.fln.prb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fln.prb\"");
 	}
 	void getChest()const
 	{
-		fprintf(mFile,"\"%s.flo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flo\"");
 	}
 	void getChestPull()const
 	{
-		fprintf(mFile,"\"%s.flo.rcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flo.rcp\"");
 	}
 	void getHips()const
 	{
-		fprintf(mFile,"\"%s.flp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flp\"");
 	}
 	void getHipsPull()const
 	{
-		fprintf(mFile,"\"%s.flp.chp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flp.chp\"");
 	}
 	void getLeftLeg()const
 	{
-		fprintf(mFile,"\"%s.flq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flq\"");
 	}
 	void getLeftKneePull()const
 	{
-		fprintf(mFile,"\"%s.flq.plk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flq.plk\"");
 	}
 	void getLeftFootPull()const
 	{
-		fprintf(mFile,"\"%s.flq.plf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flq.plf\"");
 	}
 	void getLeftToeBasePull()const
 	{
-		fprintf(mFile,"\"%s.flq.plt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flq.plt\"");
 	}
 	void getRightLeg()const
 	{
-		fprintf(mFile,"\"%s.flr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flr\"");
 	}
 	void getRightKneePull()const
 	{
-		fprintf(mFile,"\"%s.flr.prk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flr.prk\"");
 	}
 	void getRightFootPull()const
 	{
-		fprintf(mFile,"\"%s.flr.prf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flr.prf\"");
 	}
 	void getRightToeBasePull()const
 	{
-		fprintf(mFile,"\"%s.flr.prt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flr.prt\"");
 	}
 	void getExtra()const
 	{
-		fprintf(mFile,"\"%s.ex\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ex\"");
 	}
 	void getPullIterationCount()const
 	{
-		fprintf(mFile,"\"%s.ex.pic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ex.pic\"");
 	}
 	void getStiffness()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getNeckStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.nst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.nst\"");
 	}
 	void getLeftShoulderStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.rlco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.rlco\"");
 	}
 	void getLeftArmStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.rle\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.rle\"");
 	}
 	void getLeftElbowMaxExtension()const
 	{
-		fprintf(mFile,"\"%s.st.mle\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.mle\"");
 	}
 	void getLeftElbowCompressionFactor()const
 	{
-		fprintf(mFile,"\"%s.st.cle\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.cle\"");
 	}
 	void getRightShoulderStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.rrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.rrc\"");
 	}
 	void getRightArmStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.rre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.rre\"");
 	}
 	void getRightElbowMaxExtension()const
 	{
-		fprintf(mFile,"\"%s.st.mre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.mre\"");
 	}
 	void getRightElbowCompressionFactor()const
 	{
-		fprintf(mFile,"\"%s.st.cre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.cre\"");
 	}
 	void getHipsEnforceGravity()const
 	{
-		fprintf(mFile,"\"%s.st.egr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.egr\"");
 	}
 	void getChestStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.rco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.rco\"");
 	}
 	void getSpineStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.sst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.sst\"");
 	}
 	void getHipsStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.rho\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.rho\"");
 	}
 	void getLeftKneeMaxExtension()const
 	{
-		fprintf(mFile,"\"%s.st.mlk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.mlk\"");
 	}
 	void getLeftLegStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.rlk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.rlk\"");
 	}
 	void getLeftKneeCompressionFactor()const
 	{
-		fprintf(mFile,"\"%s.st.clk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.clk\"");
 	}
 	void getRightLegStiffness()const
 	{
-		fprintf(mFile,"\"%s.st.rrk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.rrk\"");
 	}
 	void getRightKneeMaxExtension()const
 	{
-		fprintf(mFile,"\"%s.st.mrk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.mrk\"");
 	}
 	void getRightKneeCompressionFactor()const
 	{
-		fprintf(mFile,"\"%s.st.crk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.crk\"");
 	}
 	void getKillPitch()const
 	{
-		fprintf(mFile,"\"%s.kp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kp\"");
 	}
 	void getLeftElbowKillPitch()const
 	{
-		fprintf(mFile,"\"%s.kp.lek\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kp.lek\"");
 	}
 	void getRightElbowKillPitch()const
 	{
-		fprintf(mFile,"\"%s.kp.rek\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kp.rek\"");
 	}
 	void getLeftKneeKillPitch()const
 	{
-		fprintf(mFile,"\"%s.kp.lkk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kp.lkk\"");
 	}
 	void getRightKneeKillPitch()const
 	{
-		fprintf(mFile,"\"%s.kp.rkk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kp.rkk\"");
 	}
 	void getRollExtraction()const
 	{
-		fprintf(mFile,"\"%s.re\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re\"");
 	}
 	void getRollExtractionMode()const
 	{
-		fprintf(mFile,"\"%s.re.rem\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rem\"");
 	}
 	void getLeftArmRollMode()const
 	{
-		fprintf(mFile,"\"%s.re.larm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.larm\"");
 	}
 	void getLeftArmRoll()const
 	{
-		fprintf(mFile,"\"%s.re.lar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.lar\"");
 	}
 	void getLeftForeArmRollMode()const
 	{
-		fprintf(mFile,"\"%s.re.lfrm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.lfrm\"");
 	}
 	void getLeftForeArmRoll()const
 	{
-		fprintf(mFile,"\"%s.re.lfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.lfr\"");
 	}
 	void getRightArmRollMode()const
 	{
-		fprintf(mFile,"\"%s.re.rarm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rarm\"");
 	}
 	void getRightArmRoll()const
 	{
-		fprintf(mFile,"\"%s.re.rar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rar\"");
 	}
 	void getRightForeArmRollMode()const
 	{
-		fprintf(mFile,"\"%s.re.rfrm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rfrm\"");
 	}
 	void getRightForeArmRoll()const
 	{
-		fprintf(mFile,"\"%s.re.rfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rfr\"");
 	}
 	void getLeftUpLegRollMode()const
 	{
-		fprintf(mFile,"\"%s.re.lurm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.lurm\"");
 	}
 	void getLeftUpLegRoll()const
 	{
-		fprintf(mFile,"\"%s.re.lur\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.lur\"");
 	}
 	void getLeftLegRollMode()const
 	{
-		fprintf(mFile,"\"%s.re.llrm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.llrm\"");
 	}
 	void getLeftLegRoll()const
 	{
-		fprintf(mFile,"\"%s.re.llr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.llr\"");
 	}
 	void getRightUpLegRollMode()const
 	{
-		fprintf(mFile,"\"%s.re.rurm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rurm\"");
 	}
 	void getRightUpLegRoll()const
 	{
-		fprintf(mFile,"\"%s.re.rur\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rur\"");
 	}
 	void getRightLegRollMode()const
 	{
-		fprintf(mFile,"\"%s.re.rlrm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rlrm\"");
 	}
 	void getRightLegRoll()const
 	{
-		fprintf(mFile,"\"%s.re.rlro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rlro\"");
 	}
 protected:
 	HikHandle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,38 +27,38 @@ public:
 	void setPlayFromCache(bool pfc)
 	{
 		if(pfc == false) return;
-		fprintf(mFile,"\tsetAttr \".pfc\" %i;\n", pfc);
+		writeInt(mFile,"\tsetAttr \".pfc\" ",pfc,";\n");
 	}
 	void getUndeformedGeometry(size_t ug_i)const
 	{
-		fprintf(mFile,"\"%s.ug[%i]\"",mName.c_str(),ug_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ug[",ug_i,"]\"");
 	}
 	void getUndeformedGeometry()const
 	{
 
-		fprintf(mFile,"\"%s.ug\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ug\"");
 	}
 	void getPlayFromCache()const
 	{
-		fprintf(mFile,"\"%s.pfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfc\"");
 	}
 	void getInPositions(size_t inp_i)const
 	{
-		fprintf(mFile,"\"%s.inp[%i]\"",mName.c_str(),inp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".inp[",inp_i,"]\"");
 	}
 	void getInPositions()const
 	{
 
-		fprintf(mFile,"\"%s.inp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inp\"");
 	}
 	void getOutPositions(size_t op_i)const
 	{
-		fprintf(mFile,"\"%s.op[%i]\"",mName.c_str(),op_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".op[",op_i,"]\"");
 	}
 	void getOutPositions()const
 	{
 
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 protected:
 	HistorySwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,24 +27,24 @@ public:
 	void setInMatrix(const matrix& i_)
 	{
 		if(i_ == identity) return;
-		fprintf(mFile,"\tsetAttr \".i\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".i\" -type \"matrix\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutMatrix(const matrix& o)
 	{
 		if(o == identity) return;
-		fprintf(mFile,"\tsetAttr \".o\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".o\" -type \"matrix\" ");
 		o.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInMatrix()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutMatrix()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	HoldMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
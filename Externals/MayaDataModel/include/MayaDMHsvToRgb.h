@@ -27,56 +27,56 @@ public:
 	void setInHsv(const float3& i_)
 	{
 		if(i_ == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".i\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".i\" -type \"float3\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInHsvR(float ir)
 	{
 		if(ir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ir\" %f;\n", ir);
+		writeFloat(mFile,"\tsetAttr \".i.ir\" ",ir,";\n");
 	}
 	void setInHsvG(float ig)
 	{
 		if(ig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ig\" %f;\n", ig);
+		writeFloat(mFile,"\tsetAttr \".i.ig\" ",ig,";\n");
 	}
 	void setInHsvB(float ib)
 	{
 		if(ib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ib\" %f;\n", ib);
+		writeFloat(mFile,"\tsetAttr \".i.ib\" ",ib,";\n");
 	}
 	void getInHsv()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInHsvR()const
 	{
-		fprintf(mFile,"\"%s.i.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ir\"");
 	}
 	void getInHsvG()const
 	{
-		fprintf(mFile,"\"%s.i.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ig\"");
 	}
 	void getInHsvB()const
 	{
-		fprintf(mFile,"\"%s.i.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ib\"");
 	}
 	void getOutRgb()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutRgbR()const
 	{
-		fprintf(mFile,"\"%s.o.or\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.or\"");
 	}
 	void getOutRgbG()const
 	{
-		fprintf(mFile,"\"%s.o.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.og\"");
 	}
 	void getOutRgbB()const
 	{
-		fprintf(mFile,"\"%s.o.ob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ob\"");
 	}
 protected:
 	HsvToRgb(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
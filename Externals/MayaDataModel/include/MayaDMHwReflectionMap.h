@@ -27,106 +27,106 @@ public:
 	void setDecalMode(bool dm)
 	{
 		if(dm == true) return;
-		fprintf(mFile,"\tsetAttr \".dm\" %i;\n", dm);
+		writeInt(mFile,"\tsetAttr \".dm\" ",dm,";\n");
 	}
 	void setCubeMap(bool cm)
 	{
 		if(cm == false) return;
-		fprintf(mFile,"\tsetAttr \".cm\" %i;\n", cm);
+		writeInt(mFile,"\tsetAttr \".cm\" ",cm,";\n");
 	}
 	void setTextureHasChanged(bool thc)
 	{
 		if(thc == false) return;
-		fprintf(mFile,"\tsetAttr \".thc\" %i;\n", thc);
+		writeInt(mFile,"\tsetAttr \".thc\" ",thc,";\n");
 	}
 	void setSphereMapTextureName(const string& smtn)
 	{
 		if(smtn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".smtn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".smtn\" -type \"string\" ");
 		smtn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCubeFrontTextureName(const string& cftn)
 	{
 		if(cftn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cftn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cftn\" -type \"string\" ");
 		cftn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCubeBackTextureName(const string& cbkn)
 	{
 		if(cbkn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cbkn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cbkn\" -type \"string\" ");
 		cbkn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCubeTopTextureName(const string& ctpn)
 	{
 		if(ctpn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ctpn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ctpn\" -type \"string\" ");
 		ctpn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCubeBottomTextureName(const string& cbmn)
 	{
 		if(cbmn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cbmn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cbmn\" -type \"string\" ");
 		cbmn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCubeLeftTextureName(const string& cltn)
 	{
 		if(cltn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cltn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cltn\" -type \"string\" ");
 		cltn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCubeRightTextureName(const string& crtn)
 	{
 		if(crtn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".crtn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".crtn\" -type \"string\" ");
 		crtn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getDecalMode()const
 	{
-		fprintf(mFile,"\"%s.dm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dm\"");
 	}
 	void getCubeMap()const
 	{
-		fprintf(mFile,"\"%s.cm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cm\"");
 	}
 	void getTextureHasChanged()const
 	{
-		fprintf(mFile,"\"%s.thc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".thc\"");
 	}
 	void getSphereMapTextureName()const
 	{
-		fprintf(mFile,"\"%s.smtn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smtn\"");
 	}
 	void getCubeFrontTextureName()const
 	{
-		fprintf(mFile,"\"%s.cftn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cftn\"");
 	}
 	void getCubeBackTextureName()const
 	{
-		fprintf(mFile,"\"%s.cbkn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cbkn\"");
 	}
 	void getCubeTopTextureName()const
 	{
-		fprintf(mFile,"\"%s.ctpn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctpn\"");
 	}
 	void getCubeBottomTextureName()const
 	{
-		fprintf(mFile,"\"%s.cbmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cbmn\"");
 	}
 	void getCubeLeftTextureName()const
 	{
-		fprintf(mFile,"\"%s.cltn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cltn\"");
 	}
 	void getCubeRightTextureName()const
 	{
-		fprintf(mFile,"\"%s.crtn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crtn\"");
 	}
 protected:
 	HwReflectionMap(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
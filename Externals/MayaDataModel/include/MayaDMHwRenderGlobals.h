@@ -27,296 +27,296 @@ public:
 	void setRenderPasses(unsigned int rp)
 	{
 		if(rp == 0) return;
-		fprintf(mFile,"\tsetAttr \".rp\" %i;\n", rp);
+		writeInt(mFile,"\tsetAttr \".rp\" ",rp,";\n");
 	}
 	void setCameraIcons(bool cai)
 	{
 		if(cai == false) return;
-		fprintf(mFile,"\tsetAttr \".cai\" %i;\n", cai);
+		writeInt(mFile,"\tsetAttr \".cai\" ",cai,";\n");
 	}
 	void setCollisionIcons(bool coi)
 	{
 		if(coi == false) return;
-		fprintf(mFile,"\tsetAttr \".coi\" %i;\n", coi);
+		writeInt(mFile,"\tsetAttr \".coi\" ",coi,";\n");
 	}
 	void setBackgroundColor(const float3& bc)
 	{
 		if(bc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".bc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".bc\" -type \"float3\" ");
 		bc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBackgroundColorR(float bcr)
 	{
 		if(bcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bc.bcr\" %f;\n", bcr);
+		writeFloat(mFile,"\tsetAttr \".bc.bcr\" ",bcr,";\n");
 	}
 	void setBackgroundColorG(float bcg)
 	{
 		if(bcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bc.bcg\" %f;\n", bcg);
+		writeFloat(mFile,"\tsetAttr \".bc.bcg\" ",bcg,";\n");
 	}
 	void setBackgroundColorB(float bcb)
 	{
 		if(bcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bc.bcb\" %f;\n", bcb);
+		writeFloat(mFile,"\tsetAttr \".bc.bcb\" ",bcb,";\n");
 	}
 	void setEmitterIcons(bool ei)
 	{
 		if(ei == false) return;
-		fprintf(mFile,"\tsetAttr \".ei\" %i;\n", ei);
+		writeInt(mFile,"\tsetAttr \".ei\" ",ei,";\n");
 	}
 	void setExtension(unsigned int ex)
 	{
 		if(ex == 3) return;
-		fprintf(mFile,"\tsetAttr \".ex\" %i;\n", ex);
+		writeInt(mFile,"\tsetAttr \".ex\" ",ex,";\n");
 	}
 	void setEdgeSmoothing(float es)
 	{
 		if(es == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".es\" %f;\n", es);
+		writeFloat(mFile,"\tsetAttr \".es\" ",es,";\n");
 	}
 	void setEndFrame(int ef)
 	{
 		if(ef == 10) return;
-		fprintf(mFile,"\tsetAttr \".ef\" %i;\n", ef);
+		writeInt(mFile,"\tsetAttr \".ef\" ",ef,";\n");
 	}
 	void setByFrame(int bf)
 	{
 		if(bf == 1) return;
-		fprintf(mFile,"\tsetAttr \".bf\" %i;\n", bf);
+		writeInt(mFile,"\tsetAttr \".bf\" ",bf,";\n");
 	}
 	void setFieldIcons(bool fii)
 	{
 		if(fii == false) return;
-		fprintf(mFile,"\tsetAttr \".fii\" %i;\n", fii);
+		writeInt(mFile,"\tsetAttr \".fii\" ",fii,";\n");
 	}
 	void setStartFrame(int sf)
 	{
 		if(sf == 1) return;
-		fprintf(mFile,"\tsetAttr \".sf\" %i;\n", sf);
+		writeInt(mFile,"\tsetAttr \".sf\" ",sf,";\n");
 	}
 	void setGrid(bool gr)
 	{
 		if(gr == false) return;
-		fprintf(mFile,"\tsetAttr \".gr\" %i;\n", gr);
+		writeInt(mFile,"\tsetAttr \".gr\" ",gr,";\n");
 	}
 	void setLightIcons(bool li)
 	{
 		if(li == false) return;
-		fprintf(mFile,"\tsetAttr \".li\" %i;\n", li);
+		writeInt(mFile,"\tsetAttr \".li\" ",li,";\n");
 	}
 	void setLineSmoothing(bool ls)
 	{
 		if(ls == false) return;
-		fprintf(mFile,"\tsetAttr \".ls\" %i;\n", ls);
+		writeInt(mFile,"\tsetAttr \".ls\" ",ls,";\n");
 	}
 	void setMotionBlur(float mb)
 	{
 		if(mb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mb\" %f;\n", mb);
+		writeFloat(mFile,"\tsetAttr \".mb\" ",mb,";\n");
 	}
 	void setTransformIcons(bool ti)
 	{
 		if(ti == false) return;
-		fprintf(mFile,"\tsetAttr \".ti\" %i;\n", ti);
+		writeInt(mFile,"\tsetAttr \".ti\" ",ti,";\n");
 	}
 	void setTexturing(bool txt)
 	{
 		if(txt == true) return;
-		fprintf(mFile,"\tsetAttr \".txt\" %i;\n", txt);
+		writeInt(mFile,"\tsetAttr \".txt\" ",txt,";\n");
 	}
 	void setMultiPassRendering(bool mpr)
 	{
 		if(mpr == false) return;
-		fprintf(mFile,"\tsetAttr \".mpr\" %i;\n", mpr);
+		writeInt(mFile,"\tsetAttr \".mpr\" ",mpr,";\n");
 	}
 	void setWriteZDepth(bool wzd)
 	{
 		if(wzd == false) return;
-		fprintf(mFile,"\tsetAttr \".wzd\" %i;\n", wzd);
+		writeInt(mFile,"\tsetAttr \".wzd\" ",wzd,";\n");
 	}
 	void setFilename(const string& fn)
 	{
 		if(fn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".fn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".fn\" -type \"string\" ");
 		fn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageFormat(unsigned int if_)
 	{
 		if(if_ == 0) return;
-		fprintf(mFile,"\tsetAttr \".if\" %i;\n", if_);
+		writeInt(mFile,"\tsetAttr \".if\" ",if_,";\n");
 	}
 	void setResolution(const string& res)
 	{
 		if(res == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".res\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".res\" -type \"string\" ");
 		res.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAlphaSource(unsigned int as)
 	{
 		if(as == 0) return;
-		fprintf(mFile,"\tsetAttr \".as\" %i;\n", as);
+		writeInt(mFile,"\tsetAttr \".as\" ",as,";\n");
 	}
 	void setDrawStyle(unsigned int ds)
 	{
 		if(ds == 3) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %i;\n", ds);
+		writeInt(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void setLightingMode(unsigned int lm)
 	{
 		if(lm == 0) return;
-		fprintf(mFile,"\tsetAttr \".lm\" %i;\n", lm);
+		writeInt(mFile,"\tsetAttr \".lm\" ",lm,";\n");
 	}
 	void setFullImageResolution(bool fir)
 	{
 		if(fir == false) return;
-		fprintf(mFile,"\tsetAttr \".fir\" %i;\n", fir);
+		writeInt(mFile,"\tsetAttr \".fir\" ",fir,";\n");
 	}
 	void setAntiAliasPolygons(bool aap)
 	{
 		if(aap == false) return;
-		fprintf(mFile,"\tsetAttr \".aap\" %i;\n", aap);
+		writeInt(mFile,"\tsetAttr \".aap\" ",aap,";\n");
 	}
 	void setGeometryMask(bool gh)
 	{
 		if(gh == false) return;
-		fprintf(mFile,"\tsetAttr \".gh\" %i;\n", gh);
+		writeInt(mFile,"\tsetAttr \".gh\" ",gh,";\n");
 	}
 	void setDisplayShadows(bool sd)
 	{
 		if(sd == false) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %i;\n", sd);
+		writeInt(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void getRenderPasses()const
 	{
-		fprintf(mFile,"\"%s.rp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp\"");
 	}
 	void getCameraIcons()const
 	{
-		fprintf(mFile,"\"%s.cai\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cai\"");
 	}
 	void getCollisionIcons()const
 	{
-		fprintf(mFile,"\"%s.coi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".coi\"");
 	}
 	void getBackgroundColor()const
 	{
-		fprintf(mFile,"\"%s.bc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bc\"");
 	}
 	void getBackgroundColorR()const
 	{
-		fprintf(mFile,"\"%s.bc.bcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bc.bcr\"");
 	}
 	void getBackgroundColorG()const
 	{
-		fprintf(mFile,"\"%s.bc.bcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bc.bcg\"");
 	}
 	void getBackgroundColorB()const
 	{
-		fprintf(mFile,"\"%s.bc.bcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bc.bcb\"");
 	}
 	void getEmitterIcons()const
 	{
-		fprintf(mFile,"\"%s.ei\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ei\"");
 	}
 	void getExtension()const
 	{
-		fprintf(mFile,"\"%s.ex\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ex\"");
 	}
 	void getEdgeSmoothing()const
 	{
-		fprintf(mFile,"\"%s.es\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".es\"");
 	}
 	void getEndFrame()const
 	{
-		fprintf(mFile,"\"%s.ef\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ef\"");
 	}
 	void getByFrame()const
 	{
-		fprintf(mFile,"\"%s.bf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bf\"");
 	}
 	void getFieldIcons()const
 	{
-		fprintf(mFile,"\"%s.fii\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fii\"");
 	}
 	void getStartFrame()const
 	{
-		fprintf(mFile,"\"%s.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sf\"");
 	}
 	void getGrid()const
 	{
-		fprintf(mFile,"\"%s.gr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gr\"");
 	}
 	void getLightIcons()const
 	{
-		fprintf(mFile,"\"%s.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".li\"");
 	}
 	void getLineSmoothing()const
 	{
-		fprintf(mFile,"\"%s.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls\"");
 	}
 	void getMotionBlur()const
 	{
-		fprintf(mFile,"\"%s.mb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mb\"");
 	}
 	void getTransformIcons()const
 	{
-		fprintf(mFile,"\"%s.ti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ti\"");
 	}
 	void getTexturing()const
 	{
-		fprintf(mFile,"\"%s.txt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txt\"");
 	}
 	void getMultiPassRendering()const
 	{
-		fprintf(mFile,"\"%s.mpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpr\"");
 	}
 	void getWriteZDepth()const
 	{
-		fprintf(mFile,"\"%s.wzd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wzd\"");
 	}
 	void getFilename()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getImageFormat()const
 	{
-		fprintf(mFile,"\"%s.if\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".if\"");
 	}
 	void getResolution()const
 	{
-		fprintf(mFile,"\"%s.res\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res\"");
 	}
 	void getAlphaSource()const
 	{
-		fprintf(mFile,"\"%s.as\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".as\"");
 	}
 	void getDrawStyle()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 	void getLightingMode()const
 	{
-		fprintf(mFile,"\"%s.lm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lm\"");
 	}
 	void getFullImageResolution()const
 	{
-		fprintf(mFile,"\"%s.fir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fir\"");
 	}
 	void getAntiAliasPolygons()const
 	{
-		fprintf(mFile,"\"%s.aap\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aap\"");
 	}
 	void getGeometryMask()const
 	{
-		fprintf(mFile,"\"%s.gh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gh\"");
 	}
 	void getDisplayShadows()const
 	{
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 protected:
 	HwRenderGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,97 +27,97 @@ public:
 	void setEnableHwShading(int ehs)
 	{
 		if(ehs == 1) return;
-		fprintf(mFile,"\tsetAttr \".ehs\" %i;\n", ehs);
+		writeInt(mFile,"\tsetAttr \".ehs\" ",ehs,";\n");
 	}
 	void setVaryingParameters(const stringArray& vpar)
 	{
 		if(vpar.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".vpar\" -type \"stringArray\" ");
+		writeString(mFile,"\tsetAttr \".vpar\" -type \"stringArray\" ");
 		vpar.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUniformParameters(const stringArray& upar)
 	{
 		if(upar.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".upar\" -type \"stringArray\" ");
+		writeString(mFile,"\tsetAttr \".upar\" -type \"stringArray\" ");
 		upar.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogb\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getEnableHwShading()const
 	{
-		fprintf(mFile,"\"%s.ehs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ehs\"");
 	}
 	void getVaryingParameters()const
 	{
-		fprintf(mFile,"\"%s.vpar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vpar\"");
 	}
 	void getUniformParameters()const
 	{
-		fprintf(mFile,"\"%s.upar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upar\"");
 	}
 protected:
 	HwShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,12 +26,12 @@ public:
 
 	void getBookmarks(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i]\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"]\"");
 	}
 	void getBookmarks()const
 	{
 
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 protected:
 	HyperGraphInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
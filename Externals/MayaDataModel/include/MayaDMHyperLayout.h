@@ -24,10 +24,10 @@ public:
 		bool isFreeform;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", positionX);
-			fprintf(file,"%f ", positionY);
-			fprintf(file,"%i ", isCollapsed);
-			fprintf(file,"%i ", isFreeform);
+			writeFloat(file,"",positionX," ");
+			writeFloat(file,"",positionY," ");
+			writeInt(file,"",isCollapsed," ");
+			writeInt(file,"",isFreeform," ");
 		}
 	};
 public:
@@ -39,166 +39,166 @@ public:
 
 	void setHyperPosition(size_t hyp_i,const HyperPosition& hyp)
 	{
-		fprintf(mFile,"\tsetAttr \".hyp[%i]\" ",hyp_i);
+		writeInt(mFile,"\tsetAttr \".hyp[",hyp_i,"]\" ");
 		hyp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHyperPosition(size_t hyp_start,size_t hyp_end,HyperPosition* hyp)
 	{
-		fprintf(mFile,"\tsetAttr \".hyp[%i:%i]\" ", hyp_start,hyp_end);
+		writeInt(mFile,"\tsetAttr \".hyp[",hyp_start); writeInt(mFile,":",hyp_end,"]\" ");
 		size_t size = (hyp_end-hyp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			hyp[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startHyperPosition(size_t hyp_start,size_t hyp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".hyp[%i:%i]\"",hyp_start,hyp_end);
-		fprintf(mFile," -type \"HyperPosition\" ");
+		writeInt(mFile,"\tsetAttr \".hyp[",hyp_start); writeInt(mFile,":",hyp_end,"]\"");
+		writeString(mFile," -type \"HyperPosition\" ");
 	}
 	void appendHyperPosition(const HyperPosition& hyp)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		hyp.write(mFile);
 	}
 	void endHyperPosition()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPositionX(size_t hyp_i,float x)
 	{
 		if(x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hyp[%i].x\" %f;\n", hyp_i,x);
+		writeInt(mFile,"\tsetAttr \".hyp[",hyp_i); writeFloat(mFile,"].x\" ",x,";\n");
 	}
 	void setPositionY(size_t hyp_i,float y)
 	{
 		if(y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hyp[%i].y\" %f;\n", hyp_i,y);
+		writeInt(mFile,"\tsetAttr \".hyp[",hyp_i); writeFloat(mFile,"].y\" ",y,";\n");
 	}
 	void setIsCollapsed(size_t hyp_i,bool isc)
 	{
 		if(isc == false) return;
-		fprintf(mFile,"\tsetAttr \".hyp[%i].isc\" %i;\n", hyp_i,isc);
+		writeInt(mFile,"\tsetAttr \".hyp[",hyp_i); writeInt(mFile,"].isc\" ",isc,";\n");
 	}
 	void setIsFreeform(size_t hyp_i,bool isf)
 	{
 		if(isf == false) return;
-		fprintf(mFile,"\tsetAttr \".hyp[%i].isf\" %i;\n", hyp_i,isf);
+		writeInt(mFile,"\tsetAttr \".hyp[",hyp_i); writeInt(mFile,"].isf\" ",isf,";\n");
 	}
 	void setImageName(const string& img)
 	{
 		if(img == "") return;
-		fprintf(mFile,"\tsetAttr \".img\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".img\" -type \"string\" ");
 		img.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImagePosition(const double2& imp)
 	{
 		if(imp == double2(0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".imp\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".imp\" -type \"double2\" ");
 		imp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImagePositionX(double ipx)
 	{
 		if(ipx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imp.ipx\" %f;\n", ipx);
+		writeFloat(mFile,"\tsetAttr \".imp.ipx\" ",ipx,";\n");
 	}
 	void setImagePositionY(double ipy)
 	{
 		if(ipy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imp.ipy\" %f;\n", ipy);
+		writeFloat(mFile,"\tsetAttr \".imp.ipy\" ",ipy,";\n");
 	}
 	void setImageScale(float ims)
 	{
 		if(ims == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ims\" %f;\n", ims);
+		writeFloat(mFile,"\tsetAttr \".ims\" ",ims,";\n");
 	}
 	void setAllNodesFreeform(bool anf)
 	{
 		if(anf == false) return;
-		fprintf(mFile,"\tsetAttr \".anf\" %i;\n", anf);
+		writeInt(mFile,"\tsetAttr \".anf\" ",anf,";\n");
 	}
 	void getHyperPosition(size_t hyp_i)const
 	{
-		fprintf(mFile,"\"%s.hyp[%i]\"",mName.c_str(),hyp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hyp[",hyp_i,"]\"");
 	}
 	void getHyperPosition()const
 	{
 
-		fprintf(mFile,"\"%s.hyp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hyp\"");
 	}
 	void getPositionX(size_t hyp_i)const
 	{
-		fprintf(mFile,"\"%s.hyp[%i].x\"",mName.c_str(),hyp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hyp[",hyp_i,"].x\"");
 	}
 	void getPositionX()const
 	{
 
-		fprintf(mFile,"\"%s.hyp.x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hyp.x\"");
 	}
 	void getPositionY(size_t hyp_i)const
 	{
-		fprintf(mFile,"\"%s.hyp[%i].y\"",mName.c_str(),hyp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hyp[",hyp_i,"].y\"");
 	}
 	void getPositionY()const
 	{
 
-		fprintf(mFile,"\"%s.hyp.y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hyp.y\"");
 	}
 	void getIsCollapsed(size_t hyp_i)const
 	{
-		fprintf(mFile,"\"%s.hyp[%i].isc\"",mName.c_str(),hyp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hyp[",hyp_i,"].isc\"");
 	}
 	void getIsCollapsed()const
 	{
 
-		fprintf(mFile,"\"%s.hyp.isc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hyp.isc\"");
 	}
 	void getIsFreeform(size_t hyp_i)const
 	{
-		fprintf(mFile,"\"%s.hyp[%i].isf\"",mName.c_str(),hyp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hyp[",hyp_i,"].isf\"");
 	}
 	void getIsFreeform()const
 	{
 
-		fprintf(mFile,"\"%s.hyp.isf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hyp.isf\"");
 	}
 	void getDependNode(size_t hyp_i)const
 	{
-		fprintf(mFile,"\"%s.hyp[%i].dn\"",mName.c_str(),hyp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hyp[",hyp_i,"].dn\"");
 	}
 	void getDependNode()const
 	{
 
-		fprintf(mFile,"\"%s.hyp.dn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hyp.dn\"");
 	}
 	void getImageName()const
 	{
-		fprintf(mFile,"\"%s.img\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".img\"");
 	}
 	void getImagePosition()const
 	{
-		fprintf(mFile,"\"%s.imp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp\"");
 	}
 	void getImagePositionX()const
 	{
-		fprintf(mFile,"\"%s.imp.ipx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp.ipx\"");
 	}
 	void getImagePositionY()const
 	{
-		fprintf(mFile,"\"%s.imp.ipy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp.ipy\"");
 	}
 	void getImageScale()const
 	{
-		fprintf(mFile,"\"%s.ims\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ims\"");
 	}
 	void getAllNodesFreeform()const
 	{
-		fprintf(mFile,"\"%s.anf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".anf\"");
 	}
 protected:
 	HyperLayout(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
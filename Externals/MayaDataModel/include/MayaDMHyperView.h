@@ -27,166 +27,166 @@ public:
 	void setPosition(const double2& p)
 	{
 		if(p == double2(0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".p\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"double2\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPositionX(double px)
 	{
 		if(px == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPositionY(double py)
 	{
 		if(py == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setViewRectLow(const double2& vl)
 	{
 		if(vl == double2(0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".vl\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".vl\" -type \"double2\" ");
 		vl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setViewXL(double xl)
 	{
 		if(xl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vl.xl\" %f;\n", xl);
+		writeFloat(mFile,"\tsetAttr \".vl.xl\" ",xl,";\n");
 	}
 	void setViewYL(double yl)
 	{
 		if(yl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vl.yl\" %f;\n", yl);
+		writeFloat(mFile,"\tsetAttr \".vl.yl\" ",yl,";\n");
 	}
 	void setViewRectHigh(const double2& vh)
 	{
 		if(vh == double2(0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".vh\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".vh\" -type \"double2\" ");
 		vh.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setViewXH(double xh)
 	{
 		if(xh == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vh.xh\" %f;\n", xh);
+		writeFloat(mFile,"\tsetAttr \".vh.xh\" ",xh,";\n");
 	}
 	void setViewYH(double yh)
 	{
 		if(yh == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vh.yh\" %f;\n", yh);
+		writeFloat(mFile,"\tsetAttr \".vh.yh\" ",yh,";\n");
 	}
 	void setDagView(bool dag)
 	{
 		if(dag == true) return;
-		fprintf(mFile,"\tsetAttr \".dag\" %i;\n", dag);
+		writeInt(mFile,"\tsetAttr \".dag\" ",dag,";\n");
 	}
 	void setDescription(const string& d)
 	{
 		if(d == "") return;
-		fprintf(mFile,"\tsetAttr \".d\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"string\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFullName(const string& fn)
 	{
 		if(fn == "") return;
-		fprintf(mFile,"\tsetAttr \".fn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".fn\" -type \"string\" ");
 		fn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShortName(const string& sn)
 	{
 		if(sn == "") return;
-		fprintf(mFile,"\tsetAttr \".sn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".sn\" -type \"string\" ");
 		sn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBuildDirection(unsigned int bd)
 	{
 		if(bd == 2) return;
-		fprintf(mFile,"\tsetAttr \".bd\" %i;\n", bd);
+		writeInt(mFile,"\tsetAttr \".bd\" ",bd,";\n");
 	}
 	void setGraphTraversalLimit(int gtl)
 	{
 		if(gtl == -1) return;
-		fprintf(mFile,"\tsetAttr \".gtl\" %i;\n", gtl);
+		writeInt(mFile,"\tsetAttr \".gtl\" ",gtl,";\n");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getViewRectLow()const
 	{
-		fprintf(mFile,"\"%s.vl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl\"");
 	}
 	void getViewXL()const
 	{
-		fprintf(mFile,"\"%s.vl.xl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl.xl\"");
 	}
 	void getViewYL()const
 	{
-		fprintf(mFile,"\"%s.vl.yl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl.yl\"");
 	}
 	void getViewRectHigh()const
 	{
-		fprintf(mFile,"\"%s.vh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vh\"");
 	}
 	void getViewXH()const
 	{
-		fprintf(mFile,"\"%s.vh.xh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vh.xh\"");
 	}
 	void getViewYH()const
 	{
-		fprintf(mFile,"\"%s.vh.yh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vh.yh\"");
 	}
 	void getDagView()const
 	{
-		fprintf(mFile,"\"%s.dag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dag\"");
 	}
 	void getDescription()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getFocusNode()const
 	{
-		fprintf(mFile,"\"%s.fnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fnd\"");
 	}
 	void getRootNode(size_t rnd_i)const
 	{
-		fprintf(mFile,"\"%s.rnd[%i]\"",mName.c_str(),rnd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rnd[",rnd_i,"]\"");
 	}
 	void getRootNode()const
 	{
 
-		fprintf(mFile,"\"%s.rnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rnd\"");
 	}
 	void getFullName()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getShortName()const
 	{
-		fprintf(mFile,"\"%s.sn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sn\"");
 	}
 	void getBuildDirection()const
 	{
-		fprintf(mFile,"\"%s.bd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bd\"");
 	}
 	void getGraphTraversalLimit()const
 	{
-		fprintf(mFile,"\"%s.gtl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gtl\"");
 	}
 	void getHyperLayout()const
 	{
-		fprintf(mFile,"\"%s.hl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hl\"");
 	}
 protected:
 	HyperView(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
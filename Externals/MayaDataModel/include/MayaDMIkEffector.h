@@ -27,20 +27,20 @@ public:
 	void setHideDisplay(bool hd)
 	{
 		if(hd == false) return;
-		fprintf(mFile,"\tsetAttr \".hd\" %i;\n", hd);
+		writeInt(mFile,"\tsetAttr \".hd\" ",hd,";\n");
 	}
 	void getHideDisplay()const
 	{
-		fprintf(mFile,"\"%s.hd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hd\"");
 	}
 	void getHandlePath(size_t hp_i)const
 	{
-		fprintf(mFile,"\"%s.hp[%i]\"",mName.c_str(),hp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".hp[",hp_i,"]\"");
 	}
 	void getHandlePath()const
 	{
 
-		fprintf(mFile,"\"%s.hp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hp\"");
 	}
 protected:
 	IkEffector(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
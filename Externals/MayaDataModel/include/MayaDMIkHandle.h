@@ -27,387 +27,387 @@ public:
 	void setSnapEnable(bool hsh)
 	{
 		if(hsh == true) return;
-		fprintf(mFile,"\tsetAttr \".hsh\" %i;\n", hsh);
+		writeInt(mFile,"\tsetAttr \".hsh\" ",hsh,";\n");
 	}
 	void setStickiness(unsigned int hs)
 	{
 		if(hs == 0) return;
-		fprintf(mFile,"\tsetAttr \".hs\" %i;\n", hs);
+		writeInt(mFile,"\tsetAttr \".hs\" ",hs,";\n");
 	}
 	void setPriority(int hpr)
 	{
 		if(hpr == 1) return;
-		fprintf(mFile,"\tsetAttr \".hpr\" %i;\n", hpr);
+		writeInt(mFile,"\tsetAttr \".hpr\" ",hpr,";\n");
 	}
 	void setWeight(double hw)
 	{
 		if(hw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hw\" %f;\n", hw);
+		writeFloat(mFile,"\tsetAttr \".hw\" ",hw,";\n");
 	}
 	void setPoWeight(double hpo)
 	{
 		if(hpo == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hpo\" %f;\n", hpo);
+		writeFloat(mFile,"\tsetAttr \".hpo\" ",hpo,";\n");
 	}
 	void setPoleVector(const double3& pv)
 	{
-		fprintf(mFile,"\tsetAttr \".pv\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pv\" -type \"double3\" ");
 		pv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoleVectorX(double pvx)
 	{
 		if(pvx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pv.pvx\" %f;\n", pvx);
+		writeFloat(mFile,"\tsetAttr \".pv.pvx\" ",pvx,";\n");
 	}
 	void setPoleVectorY(double pvy)
 	{
 		if(pvy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pv.pvy\" %f;\n", pvy);
+		writeFloat(mFile,"\tsetAttr \".pv.pvy\" ",pvy,";\n");
 	}
 	void setPoleVectorZ(double pvz)
 	{
 		if(pvz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pv.pvz\" %f;\n", pvz);
+		writeFloat(mFile,"\tsetAttr \".pv.pvz\" ",pvz,";\n");
 	}
 	void setOffset(double off)
 	{
 		if(off == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".off\" %f;\n", off);
+		writeFloat(mFile,"\tsetAttr \".off\" ",off,";\n");
 	}
 	void setRoll(double rol)
 	{
 		if(rol == 0) return;
-		fprintf(mFile,"\tsetAttr \".rol\" %f;\n", rol);
+		writeFloat(mFile,"\tsetAttr \".rol\" ",rol,";\n");
 	}
 	void setTwist(double twi)
 	{
 		if(twi == 0) return;
-		fprintf(mFile,"\tsetAttr \".twi\" %f;\n", twi);
+		writeFloat(mFile,"\tsetAttr \".twi\" ",twi,";\n");
 	}
 	void setRootOnCurve(bool roc)
 	{
 		if(roc == false) return;
-		fprintf(mFile,"\tsetAttr \".roc\" %i;\n", roc);
+		writeInt(mFile,"\tsetAttr \".roc\" ",roc,";\n");
 	}
 	void setTwistType(unsigned int twt)
 	{
 		if(twt == 0) return;
-		fprintf(mFile,"\tsetAttr \".twt\" %i;\n", twt);
+		writeInt(mFile,"\tsetAttr \".twt\" ",twt,";\n");
 	}
 	void setRootTwistMode(bool rtm)
 	{
 		if(rtm == false) return;
-		fprintf(mFile,"\tsetAttr \".rtm\" %i;\n", rtm);
+		writeInt(mFile,"\tsetAttr \".rtm\" ",rtm,";\n");
 	}
 	void setIkBlend(double ikb)
 	{
 		if(ikb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ikb\" %f;\n", ikb);
+		writeFloat(mFile,"\tsetAttr \".ikb\" ",ikb,";\n");
 	}
 	void setIkFkManipulation(bool eik)
 	{
 		if(eik == false) return;
-		fprintf(mFile,"\tsetAttr \".eik\" %i;\n", eik);
+		writeInt(mFile,"\tsetAttr \".eik\" ",eik,";\n");
 	}
 	void setDWorldUpType(unsigned int dwut)
 	{
 		if(dwut == 0) return;
-		fprintf(mFile,"\tsetAttr \".dwut\" %i;\n", dwut);
+		writeInt(mFile,"\tsetAttr \".dwut\" ",dwut,";\n");
 	}
 	void setDWorldUpAxis(unsigned int dwua)
 	{
 		if(dwua == 0) return;
-		fprintf(mFile,"\tsetAttr \".dwua\" %i;\n", dwua);
+		writeInt(mFile,"\tsetAttr \".dwua\" ",dwua,";\n");
 	}
 	void setDWorldUpVector(const double3& dwuv)
 	{
-		fprintf(mFile,"\tsetAttr \".dwuv\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".dwuv\" -type \"double3\" ");
 		dwuv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDWorldUpVectorX(double dwux)
 	{
 		if(dwux == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dwuv.dwux\" %f;\n", dwux);
+		writeFloat(mFile,"\tsetAttr \".dwuv.dwux\" ",dwux,";\n");
 	}
 	void setDWorldUpVectorY(double dwuy)
 	{
 		if(dwuy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dwuv.dwuy\" %f;\n", dwuy);
+		writeFloat(mFile,"\tsetAttr \".dwuv.dwuy\" ",dwuy,";\n");
 	}
 	void setDWorldUpVectorZ(double dwuz)
 	{
 		if(dwuz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dwuv.dwuz\" %f;\n", dwuz);
+		writeFloat(mFile,"\tsetAttr \".dwuv.dwuz\" ",dwuz,";\n");
 	}
 	void setDWorldUpVectorEnd(const double3& dwve)
 	{
-		fprintf(mFile,"\tsetAttr \".dwve\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".dwve\" -type \"double3\" ");
 		dwve.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDWorldUpVectorEndX(double dwvx)
 	{
 		if(dwvx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dwve.dwvx\" %f;\n", dwvx);
+		writeFloat(mFile,"\tsetAttr \".dwve.dwvx\" ",dwvx,";\n");
 	}
 	void setDWorldUpVectorEndY(double dwvy)
 	{
 		if(dwvy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dwve.dwvy\" %f;\n", dwvy);
+		writeFloat(mFile,"\tsetAttr \".dwve.dwvy\" ",dwvy,";\n");
 	}
 	void setDWorldUpVectorEndZ(double dwvz)
 	{
 		if(dwvz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dwve.dwvz\" %f;\n", dwvz);
+		writeFloat(mFile,"\tsetAttr \".dwve.dwvz\" ",dwvz,";\n");
 	}
 	void setDWorldUpMatrix(const matrix& dwum)
 	{
 		if(dwum == identity) return;
-		fprintf(mFile,"\tsetAttr \".dwum\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".dwum\" -type \"matrix\" ");
 		dwum.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDWorldUpMatrixEnd(const matrix& dwue)
 	{
 		if(dwue == identity) return;
-		fprintf(mFile,"\tsetAttr \".dwue\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".dwue\" -type \"matrix\" ");
 		dwue.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDTwistValueType(unsigned int dtvt)
 	{
 		if(dtvt == 0) return;
-		fprintf(mFile,"\tsetAttr \".dtvt\" %i;\n", dtvt);
+		writeInt(mFile,"\tsetAttr \".dtvt\" ",dtvt,";\n");
 	}
 	void setDTwistStartEnd(const double2& dtse)
 	{
-		fprintf(mFile,"\tsetAttr \".dtse\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".dtse\" -type \"double2\" ");
 		dtse.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDTwistStart(double dtst)
 	{
 		if(dtst == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtse.dtst\" %f;\n", dtst);
+		writeFloat(mFile,"\tsetAttr \".dtse.dtst\" ",dtst,";\n");
 	}
 	void setDTwistEnd(double dten)
 	{
 		if(dten == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtse.dten\" %f;\n", dten);
+		writeFloat(mFile,"\tsetAttr \".dtse.dten\" ",dten,";\n");
 	}
 	void setDTwistRamp(const float3& dtra)
 	{
-		fprintf(mFile,"\tsetAttr \".dtra\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dtra\" -type \"float3\" ");
 		dtra.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDTwistRampR(float dtrr)
 	{
 		if(dtrr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtra.dtrr\" %f;\n", dtrr);
+		writeFloat(mFile,"\tsetAttr \".dtra.dtrr\" ",dtrr,";\n");
 	}
 	void setDTwistRampG(float dtrg)
 	{
 		if(dtrg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtra.dtrg\" %f;\n", dtrg);
+		writeFloat(mFile,"\tsetAttr \".dtra.dtrg\" ",dtrg,";\n");
 	}
 	void setDTwistRampB(float dtrb)
 	{
 		if(dtrb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtra.dtrb\" %f;\n", dtrb);
+		writeFloat(mFile,"\tsetAttr \".dtra.dtrb\" ",dtrb,";\n");
 	}
 	void setDTwistRampMult(double dtrm)
 	{
 		if(dtrm == 90.0) return;
-		fprintf(mFile,"\tsetAttr \".dtrm\" %f;\n", dtrm);
+		writeFloat(mFile,"\tsetAttr \".dtrm\" ",dtrm,";\n");
 	}
 	void setDTwistControlEnable(bool dtce)
 	{
 		if(dtce == false) return;
-		fprintf(mFile,"\tsetAttr \".dtce\" %i;\n", dtce);
+		writeInt(mFile,"\tsetAttr \".dtce\" ",dtce,";\n");
 	}
 	void setSplineIkOldStyle(bool sio)
 	{
 		if(sio == false) return;
-		fprintf(mFile,"\tsetAttr \".sio\" %i;\n", sio);
+		writeInt(mFile,"\tsetAttr \".sio\" ",sio,";\n");
 	}
 	void getStartJoint()const
 	{
-		fprintf(mFile,"\"%s.hsj\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hsj\"");
 	}
 	void getEndEffector()const
 	{
-		fprintf(mFile,"\"%s.hee\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hee\"");
 	}
 	void getIkSolver()const
 	{
-		fprintf(mFile,"\"%s.hsv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hsv\"");
 	}
 	void getSnapEnable()const
 	{
-		fprintf(mFile,"\"%s.hsh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hsh\"");
 	}
 	void getStickiness()const
 	{
-		fprintf(mFile,"\"%s.hs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hs\"");
 	}
 	void getPriority()const
 	{
-		fprintf(mFile,"\"%s.hpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hpr\"");
 	}
 	void getWeight()const
 	{
-		fprintf(mFile,"\"%s.hw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hw\"");
 	}
 	void getPoWeight()const
 	{
-		fprintf(mFile,"\"%s.hpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hpo\"");
 	}
 	void getPoleVector()const
 	{
-		fprintf(mFile,"\"%s.pv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pv\"");
 	}
 	void getPoleVectorX()const
 	{
-		fprintf(mFile,"\"%s.pv.pvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pv.pvx\"");
 	}
 	void getPoleVectorY()const
 	{
-		fprintf(mFile,"\"%s.pv.pvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pv.pvy\"");
 	}
 	void getPoleVectorZ()const
 	{
-		fprintf(mFile,"\"%s.pv.pvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pv.pvz\"");
 	}
 	void getInCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.off\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".off\"");
 	}
 	void getRoll()const
 	{
-		fprintf(mFile,"\"%s.rol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rol\"");
 	}
 	void getTwist()const
 	{
-		fprintf(mFile,"\"%s.twi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twi\"");
 	}
 	void getRootOnCurve()const
 	{
-		fprintf(mFile,"\"%s.roc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".roc\"");
 	}
 	void getTwistType()const
 	{
-		fprintf(mFile,"\"%s.twt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twt\"");
 	}
 	void getRootTwistMode()const
 	{
-		fprintf(mFile,"\"%s.rtm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtm\"");
 	}
 	void getIkBlend()const
 	{
-		fprintf(mFile,"\"%s.ikb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ikb\"");
 	}
 	void getIkFkManipulation()const
 	{
-		fprintf(mFile,"\"%s.eik\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eik\"");
 	}
 	void getDWorldUpType()const
 	{
-		fprintf(mFile,"\"%s.dwut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwut\"");
 	}
 	void getDWorldUpAxis()const
 	{
-		fprintf(mFile,"\"%s.dwua\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwua\"");
 	}
 	void getDWorldUpVector()const
 	{
-		fprintf(mFile,"\"%s.dwuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwuv\"");
 	}
 	void getDWorldUpVectorX()const
 	{
-		fprintf(mFile,"\"%s.dwuv.dwux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwuv.dwux\"");
 	}
 	void getDWorldUpVectorY()const
 	{
-		fprintf(mFile,"\"%s.dwuv.dwuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwuv.dwuy\"");
 	}
 	void getDWorldUpVectorZ()const
 	{
-		fprintf(mFile,"\"%s.dwuv.dwuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwuv.dwuz\"");
 	}
 	void getDWorldUpVectorEnd()const
 	{
-		fprintf(mFile,"\"%s.dwve\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwve\"");
 	}
 	void getDWorldUpVectorEndX()const
 	{
-		fprintf(mFile,"\"%s.dwve.dwvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwve.dwvx\"");
 	}
 	void getDWorldUpVectorEndY()const
 	{
-		fprintf(mFile,"\"%s.dwve.dwvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwve.dwvy\"");
 	}
 	void getDWorldUpVectorEndZ()const
 	{
-		fprintf(mFile,"\"%s.dwve.dwvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwve.dwvz\"");
 	}
 	void getDWorldUpMatrix()const
 	{
-		fprintf(mFile,"\"%s.dwum\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwum\"");
 	}
 	void getDWorldUpMatrixEnd()const
 	{
-		fprintf(mFile,"\"%s.dwue\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwue\"");
 	}
 	void getDTwistValueType()const
 	{
-		fprintf(mFile,"\"%s.dtvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtvt\"");
 	}
 	void getDTwistStartEnd()const
 	{
-		fprintf(mFile,"\"%s.dtse\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtse\"");
 	}
 	void getDTwistStart()const
 	{
-		fprintf(mFile,"\"%s.dtse.dtst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtse.dtst\"");
 	}
 	void getDTwistEnd()const
 	{
-		fprintf(mFile,"\"%s.dtse.dten\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtse.dten\"");
 	}
 	void getDTwistRamp()const
 	{
-		fprintf(mFile,"\"%s.dtra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtra\"");
 	}
 	void getDTwistRampR()const
 	{
-		fprintf(mFile,"\"%s.dtra.dtrr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtra.dtrr\"");
 	}
 	void getDTwistRampG()const
 	{
-		fprintf(mFile,"\"%s.dtra.dtrg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtra.dtrg\"");
 	}
 	void getDTwistRampB()const
 	{
-		fprintf(mFile,"\"%s.dtra.dtrb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtra.dtrb\"");
 	}
 	void getDTwistRampMult()const
 	{
-		fprintf(mFile,"\"%s.dtrm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtrm\"");
 	}
 	void getDTwistControlEnable()const
 	{
-		fprintf(mFile,"\"%s.dtce\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtce\"");
 	}
 	void getSplineIkOldStyle()const
 	{
-		fprintf(mFile,"\"%s.sio\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sio\"");
 	}
 protected:
 	IkHandle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,12 +27,12 @@ public:
 	void setMaxIterations(int mxi)
 	{
 		if(mxi == 2147483647) return;
-		fprintf(mFile,"\tsetAttr \".mxi\" %i;\n", mxi);
+		writeInt(mFile,"\tsetAttr \".mxi\" ",mxi,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0.00001) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 protected:
 	IkSolver(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
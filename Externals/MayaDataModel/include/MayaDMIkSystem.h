@@ -27,29 +27,29 @@ public:
 	void setGlobalSnap(bool gsn)
 	{
 		if(gsn == true) return;
-		fprintf(mFile,"\tsetAttr \".gsn\" %i;\n", gsn);
+		writeInt(mFile,"\tsetAttr \".gsn\" ",gsn,";\n");
 	}
 	void setGlobalSolve(bool gsv)
 	{
 		if(gsv == true) return;
-		fprintf(mFile,"\tsetAttr \".gsv\" %i;\n", gsv);
+		writeInt(mFile,"\tsetAttr \".gsv\" ",gsv,";\n");
 	}
 	void getGlobalSnap()const
 	{
-		fprintf(mFile,"\"%s.gsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gsn\"");
 	}
 	void getGlobalSolve()const
 	{
-		fprintf(mFile,"\"%s.gsv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gsv\"");
 	}
 	void getIkSolver(size_t sol_i)const
 	{
-		fprintf(mFile,"\"%s.sol[%i]\"",mName.c_str(),sol_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sol[",sol_i,"]\"");
 	}
 	void getIkSolver()const
 	{
 
-		fprintf(mFile,"\"%s.sol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sol\"");
 	}
 protected:
 	IkSystem(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,460 +27,460 @@ public:
 	void setType(unsigned int t)
 	{
 		if(t == 0) return;
-		fprintf(mFile,"\tsetAttr \".t\" %i;\n", t);
+		writeInt(mFile,"\tsetAttr \".t\" ",t,";\n");
 	}
 	void setImageName(const string& imn)
 	{
 		if(imn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".imn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".imn\" -type \"string\" ");
 		imn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseFrameExtension(bool ufe)
 	{
 		if(ufe == false) return;
-		fprintf(mFile,"\tsetAttr \".ufe\" %i;\n", ufe);
+		writeInt(mFile,"\tsetAttr \".ufe\" ",ufe,";\n");
 	}
 	void setFrameExtension(int fe)
 	{
 		if(fe == 1) return;
-		fprintf(mFile,"\tsetAttr \".fe\" %i;\n", fe);
+		writeInt(mFile,"\tsetAttr \".fe\" ",fe,";\n");
 	}
 	void setFrameOffset(int fo)
 	{
 		if(fo == 0) return;
-		fprintf(mFile,"\tsetAttr \".fo\" %i;\n", fo);
+		writeInt(mFile,"\tsetAttr \".fo\" ",fo,";\n");
 	}
 	void setCoverage(const short2& cov)
 	{
 		if(cov == short2(1, 1)) return;
-		fprintf(mFile,"\tsetAttr \".cov\" -type \"short2\" ");
+		writeString(mFile,"\tsetAttr \".cov\" -type \"short2\" ");
 		cov.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCoverageX(short cvx)
 	{
 		if(cvx == 0) return;
-		fprintf(mFile,"\tsetAttr \".cov.cvx\" %i;\n", cvx);
+		writeInt(mFile,"\tsetAttr \".cov.cvx\" ",cvx,";\n");
 	}
 	void setCoverageY(short cvy)
 	{
 		if(cvy == 0) return;
-		fprintf(mFile,"\tsetAttr \".cov.cvy\" %i;\n", cvy);
+		writeInt(mFile,"\tsetAttr \".cov.cvy\" ",cvy,";\n");
 	}
 	void setCoverageOrigin(const short2& co)
 	{
 		if(co == short2(0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".co\" -type \"short2\" ");
+		writeString(mFile,"\tsetAttr \".co\" -type \"short2\" ");
 		co.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCoverageOriginX(short cox)
 	{
 		if(cox == 0) return;
-		fprintf(mFile,"\tsetAttr \".co.cox\" %i;\n", cox);
+		writeInt(mFile,"\tsetAttr \".co.cox\" ",cox,";\n");
 	}
 	void setCoverageOriginY(short coy)
 	{
 		if(coy == 0) return;
-		fprintf(mFile,"\tsetAttr \".co.coy\" %i;\n", coy);
+		writeInt(mFile,"\tsetAttr \".co.coy\" ",coy,";\n");
 	}
 	void setFit(unsigned int f)
 	{
 		if(f == 1) return;
-		fprintf(mFile,"\tsetAttr \".f\" %i;\n", f);
+		writeInt(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void setDisplayMode(unsigned int dm)
 	{
 		if(dm == 3) return;
-		fprintf(mFile,"\tsetAttr \".dm\" %i;\n", dm);
+		writeInt(mFile,"\tsetAttr \".dm\" ",dm,";\n");
 	}
 	void setDisplayOnlyIfCurrent(bool dic)
 	{
 		if(dic == false) return;
-		fprintf(mFile,"\tsetAttr \".dic\" %i;\n", dic);
+		writeInt(mFile,"\tsetAttr \".dic\" ",dic,";\n");
 	}
 	void setColorGain(const float3& cg)
 	{
 		if(cg == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".cg\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cg\" -type \"float3\" ");
 		cg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorGainR(float cgr)
 	{
 		if(cgr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgr\" %f;\n", cgr);
+		writeFloat(mFile,"\tsetAttr \".cg.cgr\" ",cgr,";\n");
 	}
 	void setColorGainG(float cgg)
 	{
 		if(cgg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgg\" %f;\n", cgg);
+		writeFloat(mFile,"\tsetAttr \".cg.cgg\" ",cgg,";\n");
 	}
 	void setColorGainB(float cgb)
 	{
 		if(cgb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgb\" %f;\n", cgb);
+		writeFloat(mFile,"\tsetAttr \".cg.cgb\" ",cgb,";\n");
 	}
 	void setColorOffset(const float3& cof)
 	{
 		if(cof == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".cof\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cof\" -type \"float3\" ");
 		cof.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorOffsetR(float cor)
 	{
 		if(cor == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cof.cor\" %f;\n", cor);
+		writeFloat(mFile,"\tsetAttr \".cof.cor\" ",cor,";\n");
 	}
 	void setColorOffsetG(float cog)
 	{
 		if(cog == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cof.cog\" %f;\n", cog);
+		writeFloat(mFile,"\tsetAttr \".cof.cog\" ",cog,";\n");
 	}
 	void setColorOffsetB(float cob)
 	{
 		if(cob == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cof.cob\" %f;\n", cob);
+		writeFloat(mFile,"\tsetAttr \".cof.cob\" ",cob,";\n");
 	}
 	void setAlphaGain(double ag)
 	{
 		if(ag == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ag\" %f;\n", ag);
+		writeFloat(mFile,"\tsetAttr \".ag\" ",ag,";\n");
 	}
 	void setShadingSamplesOverride(bool sso)
 	{
 		if(sso == true) return;
-		fprintf(mFile,"\tsetAttr \".sso\" %i;\n", sso);
+		writeInt(mFile,"\tsetAttr \".sso\" ",sso,";\n");
 	}
 	void setShadingSamples(int ssa)
 	{
 		if(ssa == 1) return;
-		fprintf(mFile,"\tsetAttr \".ssa\" %i;\n", ssa);
+		writeInt(mFile,"\tsetAttr \".ssa\" ",ssa,";\n");
 	}
 	void setMaxShadingSamples(int msa)
 	{
 		if(msa == 1) return;
-		fprintf(mFile,"\tsetAttr \".msa\" %i;\n", msa);
+		writeInt(mFile,"\tsetAttr \".msa\" ",msa,";\n");
 	}
 	void setLockedToCamera(bool dlc)
 	{
 		if(dlc == true) return;
-		fprintf(mFile,"\tsetAttr \".dlc\" %i;\n", dlc);
+		writeInt(mFile,"\tsetAttr \".dlc\" ",dlc,";\n");
 	}
 	void setDepth(double d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSqueezeCorrection(double sqc)
 	{
 		if(sqc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sqc\" %f;\n", sqc);
+		writeFloat(mFile,"\tsetAttr \".sqc\" ",sqc,";\n");
 	}
 	void setSize(const double2& s)
 	{
 		if(s == double2(3.6, 2.4)) return;
-		fprintf(mFile,"\tsetAttr \".s\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".s\" -type \"double2\" ");
 		s.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSizeX(double sx)
 	{
 		if(sx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sx\" %f;\n", sx);
+		writeFloat(mFile,"\tsetAttr \".s.sx\" ",sx,";\n");
 	}
 	void setSizeY(double sy)
 	{
 		if(sy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sy\" %f;\n", sy);
+		writeFloat(mFile,"\tsetAttr \".s.sy\" ",sy,";\n");
 	}
 	void setOffset(const double2& o)
 	{
 		if(o == double2(0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".o\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".o\" -type \"double2\" ");
 		o.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetX(double ox)
 	{
 		if(ox == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".o.ox\" %f;\n", ox);
+		writeFloat(mFile,"\tsetAttr \".o.ox\" ",ox,";\n");
 	}
 	void setOffsetY(double oy)
 	{
 		if(oy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".o.oy\" %f;\n", oy);
+		writeFloat(mFile,"\tsetAttr \".o.oy\" ",oy,";\n");
 	}
 	void setCenter(const double3& c)
 	{
 		if(c == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".c\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"double3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCenterX(double cx)
 	{
 		if(cx == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cx\" %f;\n", cx);
+		writeFloat(mFile,"\tsetAttr \".c.cx\" ",cx,";\n");
 	}
 	void setCenterY(double cy)
 	{
 		if(cy == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cy\" %f;\n", cy);
+		writeFloat(mFile,"\tsetAttr \".c.cy\" ",cy,";\n");
 	}
 	void setCenterZ(double cz)
 	{
 		if(cz == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cz\" %f;\n", cz);
+		writeFloat(mFile,"\tsetAttr \".c.cz\" ",cz,";\n");
 	}
 	void setWidth(double w)
 	{
 		if(w == 0) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setHeight(double h)
 	{
 		if(h == 0) return;
-		fprintf(mFile,"\tsetAttr \".h\" %f;\n", h);
+		writeFloat(mFile,"\tsetAttr \".h\" ",h,";\n");
 	}
 	void setVisibleInReflections(bool vir)
 	{
 		if(vir == false) return;
-		fprintf(mFile,"\tsetAttr \".vir\" %i;\n", vir);
+		writeInt(mFile,"\tsetAttr \".vir\" ",vir,";\n");
 	}
 	void setVisibleInRefractions(bool vif)
 	{
 		if(vif == false) return;
-		fprintf(mFile,"\tsetAttr \".vif\" %i;\n", vif);
+		writeInt(mFile,"\tsetAttr \".vif\" ",vif,";\n");
 	}
 	void setRotate(double r)
 	{
 		if(r == 0) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setUseDepthMap(bool udm)
 	{
 		if(udm == false) return;
-		fprintf(mFile,"\tsetAttr \".udm\" %i;\n", udm);
+		writeInt(mFile,"\tsetAttr \".udm\" ",udm,";\n");
 	}
 	void setCompositeDepth(bool cmp)
 	{
 		if(cmp == true) return;
-		fprintf(mFile,"\tsetAttr \".cmp\" %i;\n", cmp);
+		writeInt(mFile,"\tsetAttr \".cmp\" ",cmp,";\n");
 	}
 	void setAlreadyPremult(bool pre)
 	{
 		if(pre == false) return;
-		fprintf(mFile,"\tsetAttr \".pre\" %i;\n", pre);
+		writeInt(mFile,"\tsetAttr \".pre\" ",pre,";\n");
 	}
 	void setDepthOversample(bool osp)
 	{
 		if(osp == false) return;
-		fprintf(mFile,"\tsetAttr \".osp\" %i;\n", osp);
+		writeInt(mFile,"\tsetAttr \".osp\" ",osp,";\n");
 	}
 	void setSeparateDepth(bool sd)
 	{
 		if(sd == false) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %i;\n", sd);
+		writeInt(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void setDepthFile(const string& df)
 	{
 		if(df == "false") return;
-		fprintf(mFile,"\tsetAttr \".df\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".df\" -type \"string\" ");
 		df.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDepthBias(double dg)
 	{
 		if(dg == 0) return;
-		fprintf(mFile,"\tsetAttr \".dg\" %f;\n", dg);
+		writeFloat(mFile,"\tsetAttr \".dg\" ",dg,";\n");
 	}
 	void setDepthScale(double ds)
 	{
 		if(ds == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %f;\n", ds);
+		writeFloat(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void getType()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getImageName()const
 	{
-		fprintf(mFile,"\"%s.imn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imn\"");
 	}
 	void getUseFrameExtension()const
 	{
-		fprintf(mFile,"\"%s.ufe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufe\"");
 	}
 	void getFrameExtension()const
 	{
-		fprintf(mFile,"\"%s.fe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fe\"");
 	}
 	void getFrameOffset()const
 	{
-		fprintf(mFile,"\"%s.fo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo\"");
 	}
 	void getCoverage()const
 	{
-		fprintf(mFile,"\"%s.cov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cov\"");
 	}
 	void getCoverageX()const
 	{
-		fprintf(mFile,"\"%s.cov.cvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cov.cvx\"");
 	}
 	void getCoverageY()const
 	{
-		fprintf(mFile,"\"%s.cov.cvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cov.cvy\"");
 	}
 	void getCoverageOrigin()const
 	{
-		fprintf(mFile,"\"%s.co\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co\"");
 	}
 	void getCoverageOriginX()const
 	{
-		fprintf(mFile,"\"%s.co.cox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co.cox\"");
 	}
 	void getCoverageOriginY()const
 	{
-		fprintf(mFile,"\"%s.co.coy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co.coy\"");
 	}
 	void getSourceTexture()const
 	{
-		fprintf(mFile,"\"%s.stx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stx\"");
 	}
 	void getFit()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getDisplayMode()const
 	{
-		fprintf(mFile,"\"%s.dm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dm\"");
 	}
 	void getDisplayOnlyIfCurrent()const
 	{
-		fprintf(mFile,"\"%s.dic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dic\"");
 	}
 	void getAlphaGain()const
 	{
-		fprintf(mFile,"\"%s.ag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ag\"");
 	}
 	void getShadingSamplesOverride()const
 	{
-		fprintf(mFile,"\"%s.sso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sso\"");
 	}
 	void getShadingSamples()const
 	{
-		fprintf(mFile,"\"%s.ssa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssa\"");
 	}
 	void getMaxShadingSamples()const
 	{
-		fprintf(mFile,"\"%s.msa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msa\"");
 	}
 	void getLockedToCamera()const
 	{
-		fprintf(mFile,"\"%s.dlc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dlc\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSqueezeCorrection()const
 	{
-		fprintf(mFile,"\"%s.sqc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sqc\"");
 	}
 	void getSize()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getSizeX()const
 	{
-		fprintf(mFile,"\"%s.s.sx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sx\"");
 	}
 	void getSizeY()const
 	{
-		fprintf(mFile,"\"%s.s.sy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sy\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOffsetX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOffsetY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getCenter()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getCenterX()const
 	{
-		fprintf(mFile,"\"%s.c.cx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cx\"");
 	}
 	void getCenterY()const
 	{
-		fprintf(mFile,"\"%s.c.cy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cy\"");
 	}
 	void getCenterZ()const
 	{
-		fprintf(mFile,"\"%s.c.cz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cz\"");
 	}
 	void getWidth()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getHeight()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getVisibleInReflections()const
 	{
-		fprintf(mFile,"\"%s.vir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vir\"");
 	}
 	void getVisibleInRefractions()const
 	{
-		fprintf(mFile,"\"%s.vif\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vif\"");
 	}
 	void getRotate()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getUseDepthMap()const
 	{
-		fprintf(mFile,"\"%s.udm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udm\"");
 	}
 	void getCompositeDepth()const
 	{
-		fprintf(mFile,"\"%s.cmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmp\"");
 	}
 	void getAlreadyPremult()const
 	{
-		fprintf(mFile,"\"%s.pre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pre\"");
 	}
 	void getDepthOversample()const
 	{
-		fprintf(mFile,"\"%s.osp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".osp\"");
 	}
 	void getSeparateDepth()const
 	{
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getDepthFile()const
 	{
-		fprintf(mFile,"\"%s.df\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".df\"");
 	}
 	void getDepthBias()const
 	{
-		fprintf(mFile,"\"%s.dg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dg\"");
 	}
 	void getDepthScale()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 protected:
 	ImagePlane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
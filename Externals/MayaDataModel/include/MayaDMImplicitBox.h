@@ -26,44 +26,44 @@ public:
 
 	void setSize(const double3& siz)
 	{
-		fprintf(mFile,"\tsetAttr \".siz\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".siz\" -type \"double3\" ");
 		siz.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSizeX(double szx)
 	{
 		if(szx == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".siz.szx\" %f;\n", szx);
+		writeFloat(mFile,"\tsetAttr \".siz.szx\" ",szx,";\n");
 	}
 	void setSizeY(double szy)
 	{
 		if(szy == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".siz.szy\" %f;\n", szy);
+		writeFloat(mFile,"\tsetAttr \".siz.szy\" ",szy,";\n");
 	}
 	void setSizeZ(double szz)
 	{
 		if(szz == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".siz.szz\" %f;\n", szz);
+		writeFloat(mFile,"\tsetAttr \".siz.szz\" ",szz,";\n");
 	}
 	void getBox()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getSize()const
 	{
-		fprintf(mFile,"\"%s.siz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".siz\"");
 	}
 	void getSizeX()const
 	{
-		fprintf(mFile,"\"%s.siz.szx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".siz.szx\"");
 	}
 	void getSizeY()const
 	{
-		fprintf(mFile,"\"%s.siz.szy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".siz.szy\"");
 	}
 	void getSizeZ()const
 	{
-		fprintf(mFile,"\"%s.siz.szz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".siz.szz\"");
 	}
 protected:
 	ImplicitBox(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
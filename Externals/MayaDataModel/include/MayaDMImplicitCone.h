@@ -27,24 +27,24 @@ public:
 	void setConeAngle(double ca)
 	{
 		if(ca == 4) return;
-		fprintf(mFile,"\tsetAttr \".ca\" %f;\n", ca);
+		writeFloat(mFile,"\tsetAttr \".ca\" ",ca,";\n");
 	}
 	void setConeCap(double cap)
 	{
 		if(cap == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".cap\" %f;\n", cap);
+		writeFloat(mFile,"\tsetAttr \".cap\" ",cap,";\n");
 	}
 	void getCone()const
 	{
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getConeAngle()const
 	{
-		fprintf(mFile,"\"%s.ca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ca\"");
 	}
 	void getConeCap()const
 	{
-		fprintf(mFile,"\"%s.cap\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cap\"");
 	}
 protected:
 	ImplicitCone(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
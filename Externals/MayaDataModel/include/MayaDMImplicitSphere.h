@@ -27,15 +27,15 @@ public:
 	void setRadius(double rd)
 	{
 		if(rd == 1) return;
-		fprintf(mFile,"\tsetAttr \".rd\" %f;\n", rd);
+		writeFloat(mFile,"\tsetAttr \".rd\" ",rd,";\n");
 	}
 	void getSphere()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 protected:
 	ImplicitSphere(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
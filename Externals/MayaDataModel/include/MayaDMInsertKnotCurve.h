@@ -27,102 +27,102 @@ public:
 	void setParameter(size_t p_i,double p)
 	{
 		if(p == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p[%i]\" %f;\n", p_i,p);
+		writeInt(mFile,"\tsetAttr \".p[",p_i); writeFloat(mFile,"]\" ",p,";\n");
 	}
 	void setParameter(size_t p_start,size_t p_end,double* p)
 	{
-		fprintf(mFile,"\tsetAttr \".p[%i:%i]\" ", p_start,p_end);
+		writeInt(mFile,"\tsetAttr \".p[",p_start); writeInt(mFile,":",p_end,"]\" ");
 		size_t size = (p_end-p_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",p[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",p[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startParameter(size_t p_start,size_t p_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".p[%i:%i]\"",p_start,p_end);
+		writeInt(mFile,"\tsetAttr \".p[",p_start); writeInt(mFile,":",p_end,"]\"");
 	}
 	void appendParameter(double p)const
 	{
-		fprintf(mFile," %f",p);
+		writeFloat(mFile," ",p);
 	}
 	void endParameter()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNumberOfKnots(size_t nk_i,int nk)
 	{
 		if(nk == 1) return;
-		fprintf(mFile,"\tsetAttr \".nk[%i]\" %i;\n", nk_i,nk);
+		writeInt(mFile,"\tsetAttr \".nk[",nk_i); writeInt(mFile,"]\" ",nk,";\n");
 	}
 	void setNumberOfKnots(size_t nk_start,size_t nk_end,int* nk)
 	{
-		fprintf(mFile,"\tsetAttr \".nk[%i:%i]\" ", nk_start,nk_end);
+		writeInt(mFile,"\tsetAttr \".nk[",nk_start); writeInt(mFile,":",nk_end,"]\" ");
 		size_t size = (nk_end-nk_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",nk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",nk[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startNumberOfKnots(size_t nk_start,size_t nk_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".nk[%i:%i]\"",nk_start,nk_end);
+		writeInt(mFile,"\tsetAttr \".nk[",nk_start); writeInt(mFile,":",nk_end,"]\"");
 	}
 	void appendNumberOfKnots(int nk)const
 	{
-		fprintf(mFile," %i",nk);
+		writeInt(mFile," ",nk);
 	}
 	void endNumberOfKnots()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAddKnots(bool add)
 	{
 		if(add == true) return;
-		fprintf(mFile,"\tsetAttr \".add\" %i;\n", add);
+		writeInt(mFile,"\tsetAttr \".add\" ",add,";\n");
 	}
 	void setInsertBetween(bool ib)
 	{
 		if(ib == false) return;
-		fprintf(mFile,"\tsetAttr \".ib\" %i;\n", ib);
+		writeInt(mFile,"\tsetAttr \".ib\" ",ib,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getParameter(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getParameter()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getNumberOfKnots(size_t nk_i)const
 	{
-		fprintf(mFile,"\"%s.nk[%i]\"",mName.c_str(),nk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nk[",nk_i,"]\"");
 	}
 	void getNumberOfKnots()const
 	{
 
-		fprintf(mFile,"\"%s.nk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nk\"");
 	}
 	void getAddKnots()const
 	{
-		fprintf(mFile,"\"%s.add\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".add\"");
 	}
 	void getInsertBetween()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	InsertKnotCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
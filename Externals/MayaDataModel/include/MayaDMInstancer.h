@@ -27,77 +27,77 @@ public:
 	void setRotationOrder(unsigned int ror)
 	{
 		if(ror == 0) return;
-		fprintf(mFile,"\tsetAttr \".ror\" %i;\n", ror);
+		writeInt(mFile,"\tsetAttr \".ror\" ",ror,";\n");
 	}
 	void setRotationAngleUnits(unsigned int rau)
 	{
 		if(rau == 0) return;
-		fprintf(mFile,"\tsetAttr \".rau\" %i;\n", rau);
+		writeInt(mFile,"\tsetAttr \".rau\" ",rau,";\n");
 	}
 	void setCycle(unsigned int cyc)
 	{
 		if(cyc == 0) return;
-		fprintf(mFile,"\tsetAttr \".cyc\" %i;\n", cyc);
+		writeInt(mFile,"\tsetAttr \".cyc\" ",cyc,";\n");
 	}
 	void setCycleStep(double cs)
 	{
 		if(cs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cs\" %f;\n", cs);
+		writeFloat(mFile,"\tsetAttr \".cs\" ",cs,";\n");
 	}
 	void setCycleStepUnit(unsigned int csu)
 	{
 		if(csu == 0) return;
-		fprintf(mFile,"\tsetAttr \".csu\" %i;\n", csu);
+		writeInt(mFile,"\tsetAttr \".csu\" ",csu,";\n");
 	}
 	void setLevelOfDetail(unsigned int lod)
 	{
 		if(lod == 0) return;
-		fprintf(mFile,"\tsetAttr \".lod\" %i;\n", lod);
+		writeInt(mFile,"\tsetAttr \".lod\" ",lod,";\n");
 	}
 	void getInputPoints()const
 	{
-		fprintf(mFile,"\"%s.inp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inp\"");
 	}
 	void getInputHierarchy(size_t inh_i)const
 	{
-		fprintf(mFile,"\"%s.inh[%i]\"",mName.c_str(),inh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".inh[",inh_i,"]\"");
 	}
 	void getInputHierarchy()const
 	{
 
-		fprintf(mFile,"\"%s.inh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inh\"");
 	}
 	void getRotationOrder()const
 	{
-		fprintf(mFile,"\"%s.ror\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ror\"");
 	}
 	void getRotationAngleUnits()const
 	{
-		fprintf(mFile,"\"%s.rau\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rau\"");
 	}
 	void getCycle()const
 	{
-		fprintf(mFile,"\"%s.cyc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cyc\"");
 	}
 	void getCycleStep()const
 	{
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getCycleStepUnit()const
 	{
-		fprintf(mFile,"\"%s.csu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csu\"");
 	}
 	void getLevelOfDetail()const
 	{
-		fprintf(mFile,"\"%s.lod\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lod\"");
 	}
 	void getInstanceCount()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getHierarchyCount()const
 	{
-		fprintf(mFile,"\"%s.hc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc\"");
 	}
 protected:
 	Instancer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,46 +27,46 @@ public:
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void getInputSurface1()const
 	{
-		fprintf(mFile,"\"%s.is1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is1\"");
 	}
 	void getInputSurface2()const
 	{
-		fprintf(mFile,"\"%s.is2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is2\"");
 	}
 	void getCurveOnSurface1(size_t cs1_i)const
 	{
-		fprintf(mFile,"\"%s.cs1[%i]\"",mName.c_str(),cs1_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs1[",cs1_i,"]\"");
 	}
 	void getCurveOnSurface1()const
 	{
 
-		fprintf(mFile,"\"%s.cs1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs1\"");
 	}
 	void getCurveOnSurface2(size_t cs2_i)const
 	{
-		fprintf(mFile,"\"%s.cs2[%i]\"",mName.c_str(),cs2_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs2[",cs2_i,"]\"");
 	}
 	void getCurveOnSurface2()const
 	{
 
-		fprintf(mFile,"\"%s.cs2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs2\"");
 	}
 	void getOutput3dCurve(size_t oc_i)const
 	{
-		fprintf(mFile,"\"%s.oc[%i]\"",mName.c_str(),oc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oc[",oc_i,"]\"");
 	}
 	void getOutput3dCurve()const
 	{
 
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 protected:
 	IntersectSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
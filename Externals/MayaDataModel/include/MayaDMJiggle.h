@@ -37,91 +37,91 @@ public:
 	void setEnable(unsigned int ebl)
 	{
 		if(ebl == 2) return;
-		fprintf(mFile,"\tsetAttr \".ebl\" %i;\n", ebl);
+		writeInt(mFile,"\tsetAttr \".ebl\" ",ebl,";\n");
 	}
 	void setIgnoreTransform(bool it)
 	{
 		if(it == false) return;
-		fprintf(mFile,"\tsetAttr \".it\" %i;\n", it);
+		writeInt(mFile,"\tsetAttr \".it\" ",it,";\n");
 	}
 	void setForceAlongNormal(double fan)
 	{
 		if(fan == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fan\" %f;\n", fan);
+		writeFloat(mFile,"\tsetAttr \".fan\" ",fan,";\n");
 	}
 	void setForceOnTangent(double fot)
 	{
 		if(fot == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fot\" %f;\n", fot);
+		writeFloat(mFile,"\tsetAttr \".fot\" ",fot,";\n");
 	}
 	void setMotionMultiplier(double mm)
 	{
 		if(mm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mm\" %f;\n", mm);
+		writeFloat(mFile,"\tsetAttr \".mm\" ",mm,";\n");
 	}
 	void setStiffness(double sf)
 	{
 		if(sf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sf\" %f;\n", sf);
+		writeFloat(mFile,"\tsetAttr \".sf\" ",sf,";\n");
 	}
 	void setDamping(double dp)
 	{
 		if(dp == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".dp\" %f;\n", dp);
+		writeFloat(mFile,"\tsetAttr \".dp\" ",dp,";\n");
 	}
 	void setJiggleWeight(double jw)
 	{
 		if(jw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".jw\" %f;\n", jw);
+		writeFloat(mFile,"\tsetAttr \".jw\" ",jw,";\n");
 	}
 	void setDirectionBias(double bias)
 	{
 		if(bias == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bias\" %f;\n", bias);
+		writeFloat(mFile,"\tsetAttr \".bias\" ",bias,";\n");
 	}
 	void getDiskCache()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.cti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cti\"");
 	}
 	void getEnable()const
 	{
-		fprintf(mFile,"\"%s.ebl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ebl\"");
 	}
 	void getIgnoreTransform()const
 	{
-		fprintf(mFile,"\"%s.it\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it\"");
 	}
 	void getForceAlongNormal()const
 	{
-		fprintf(mFile,"\"%s.fan\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fan\"");
 	}
 	void getForceOnTangent()const
 	{
-		fprintf(mFile,"\"%s.fot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fot\"");
 	}
 	void getMotionMultiplier()const
 	{
-		fprintf(mFile,"\"%s.mm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mm\"");
 	}
 	void getStiffness()const
 	{
-		fprintf(mFile,"\"%s.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sf\"");
 	}
 	void getDamping()const
 	{
-		fprintf(mFile,"\"%s.dp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dp\"");
 	}
 	void getJiggleWeight()const
 	{
-		fprintf(mFile,"\"%s.jw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jw\"");
 	}
 	void getDirectionBias()const
 	{
-		fprintf(mFile,"\"%s.bias\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bias\"");
 	}
 protected:
 	Jiggle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
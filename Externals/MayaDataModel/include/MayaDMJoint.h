@@ -27,401 +27,401 @@ public:
 	void setJointOrientType(const string& jot)
 	{
 		if(jot == "xyz") return;
-		fprintf(mFile,"\tsetAttr \".jot\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".jot\" -type \"string\" ");
 		jot.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setJointTypeX(bool jtx)
 	{
 		if(jtx == true) return;
-		fprintf(mFile,"\tsetAttr \".jtx\" %i;\n", jtx);
+		writeInt(mFile,"\tsetAttr \".jtx\" ",jtx,";\n");
 	}
 	void setJointTypeY(bool jty)
 	{
 		if(jty == true) return;
-		fprintf(mFile,"\tsetAttr \".jty\" %i;\n", jty);
+		writeInt(mFile,"\tsetAttr \".jty\" ",jty,";\n");
 	}
 	void setJointTypeZ(bool jtz)
 	{
 		if(jtz == true) return;
-		fprintf(mFile,"\tsetAttr \".jtz\" %i;\n", jtz);
+		writeInt(mFile,"\tsetAttr \".jtz\" ",jtz,";\n");
 	}
 	void setJointOrient(const double3& jo)
 	{
-		fprintf(mFile,"\tsetAttr \".jo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".jo\" -type \"double3\" ");
 		jo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setJointOrientX(double jox)
 	{
 		if(jox == 0) return;
-		fprintf(mFile,"\tsetAttr \".jo.jox\" %f;\n", jox);
+		writeFloat(mFile,"\tsetAttr \".jo.jox\" ",jox,";\n");
 	}
 	void setJointOrientY(double joy)
 	{
 		if(joy == 0) return;
-		fprintf(mFile,"\tsetAttr \".jo.joy\" %f;\n", joy);
+		writeFloat(mFile,"\tsetAttr \".jo.joy\" ",joy,";\n");
 	}
 	void setJointOrientZ(double joz)
 	{
 		if(joz == 0) return;
-		fprintf(mFile,"\tsetAttr \".jo.joz\" %f;\n", joz);
+		writeFloat(mFile,"\tsetAttr \".jo.joz\" ",joz,";\n");
 	}
 	void setSegmentScaleCompensate(bool ssc)
 	{
 		if(ssc == true) return;
-		fprintf(mFile,"\tsetAttr \".ssc\" %i;\n", ssc);
+		writeInt(mFile,"\tsetAttr \".ssc\" ",ssc,";\n");
 	}
 	void setInverseScale(const double3& is)
 	{
-		fprintf(mFile,"\tsetAttr \".is\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".is\" -type \"double3\" ");
 		is.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInverseScaleX(double isx)
 	{
 		if(isx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".is.isx\" %f;\n", isx);
+		writeFloat(mFile,"\tsetAttr \".is.isx\" ",isx,";\n");
 	}
 	void setInverseScaleY(double isy)
 	{
 		if(isy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".is.isy\" %f;\n", isy);
+		writeFloat(mFile,"\tsetAttr \".is.isy\" ",isy,";\n");
 	}
 	void setInverseScaleZ(double isz)
 	{
 		if(isz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".is.isz\" %f;\n", isz);
+		writeFloat(mFile,"\tsetAttr \".is.isz\" ",isz,";\n");
 	}
 	void setStiffness(const double3& st)
 	{
-		fprintf(mFile,"\tsetAttr \".st\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".st\" -type \"double3\" ");
 		st.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStiffnessX(double stx)
 	{
 		if(stx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".st.stx\" %f;\n", stx);
+		writeFloat(mFile,"\tsetAttr \".st.stx\" ",stx,";\n");
 	}
 	void setStiffnessY(double sty)
 	{
 		if(sty == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".st.sty\" %f;\n", sty);
+		writeFloat(mFile,"\tsetAttr \".st.sty\" ",sty,";\n");
 	}
 	void setStiffnessZ(double stz)
 	{
 		if(stz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".st.stz\" %f;\n", stz);
+		writeFloat(mFile,"\tsetAttr \".st.stz\" ",stz,";\n");
 	}
 	void setPreferredAngle(const double3& pa)
 	{
-		fprintf(mFile,"\tsetAttr \".pa\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pa\" -type \"double3\" ");
 		pa.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPreferredAngleX(double pax)
 	{
 		if(pax == 0) return;
-		fprintf(mFile,"\tsetAttr \".pa.pax\" %f;\n", pax);
+		writeFloat(mFile,"\tsetAttr \".pa.pax\" ",pax,";\n");
 	}
 	void setPreferredAngleY(double pay)
 	{
 		if(pay == 0) return;
-		fprintf(mFile,"\tsetAttr \".pa.pay\" %f;\n", pay);
+		writeFloat(mFile,"\tsetAttr \".pa.pay\" ",pay,";\n");
 	}
 	void setPreferredAngleZ(double paz)
 	{
 		if(paz == 0) return;
-		fprintf(mFile,"\tsetAttr \".pa.paz\" %f;\n", paz);
+		writeFloat(mFile,"\tsetAttr \".pa.paz\" ",paz,";\n");
 	}
 	void setMinRotateDampRange(const double3& ndr)
 	{
-		fprintf(mFile,"\tsetAttr \".ndr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ndr\" -type \"double3\" ");
 		ndr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinRotateDampRangeX(double ndx)
 	{
 		if(ndx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ndr.ndx\" %f;\n", ndx);
+		writeFloat(mFile,"\tsetAttr \".ndr.ndx\" ",ndx,";\n");
 	}
 	void setMinRotateDampRangeY(double ndy)
 	{
 		if(ndy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ndr.ndy\" %f;\n", ndy);
+		writeFloat(mFile,"\tsetAttr \".ndr.ndy\" ",ndy,";\n");
 	}
 	void setMinRotateDampRangeZ(double ndz)
 	{
 		if(ndz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ndr.ndz\" %f;\n", ndz);
+		writeFloat(mFile,"\tsetAttr \".ndr.ndz\" ",ndz,";\n");
 	}
 	void setMinRotateDampStrength(const double3& nst)
 	{
-		fprintf(mFile,"\tsetAttr \".nst\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".nst\" -type \"double3\" ");
 		nst.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinRotateDampStrengthX(double nstx)
 	{
 		if(nstx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nst.nstx\" %f;\n", nstx);
+		writeFloat(mFile,"\tsetAttr \".nst.nstx\" ",nstx,";\n");
 	}
 	void setMinRotateDampStrengthY(double nsty)
 	{
 		if(nsty == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nst.nsty\" %f;\n", nsty);
+		writeFloat(mFile,"\tsetAttr \".nst.nsty\" ",nsty,";\n");
 	}
 	void setMinRotateDampStrengthZ(double nstz)
 	{
 		if(nstz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nst.nstz\" %f;\n", nstz);
+		writeFloat(mFile,"\tsetAttr \".nst.nstz\" ",nstz,";\n");
 	}
 	void setMaxRotateDampRange(const double3& xdr)
 	{
-		fprintf(mFile,"\tsetAttr \".xdr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".xdr\" -type \"double3\" ");
 		xdr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxRotateDampRangeX(double xdx)
 	{
 		if(xdx == 0) return;
-		fprintf(mFile,"\tsetAttr \".xdr.xdx\" %f;\n", xdx);
+		writeFloat(mFile,"\tsetAttr \".xdr.xdx\" ",xdx,";\n");
 	}
 	void setMaxRotateDampRangeY(double xdy)
 	{
 		if(xdy == 0) return;
-		fprintf(mFile,"\tsetAttr \".xdr.xdy\" %f;\n", xdy);
+		writeFloat(mFile,"\tsetAttr \".xdr.xdy\" ",xdy,";\n");
 	}
 	void setMaxRotateDampRangeZ(double xdz)
 	{
 		if(xdz == 0) return;
-		fprintf(mFile,"\tsetAttr \".xdr.xdz\" %f;\n", xdz);
+		writeFloat(mFile,"\tsetAttr \".xdr.xdz\" ",xdz,";\n");
 	}
 	void setMaxRotateDampStrength(const double3& xst)
 	{
-		fprintf(mFile,"\tsetAttr \".xst\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".xst\" -type \"double3\" ");
 		xst.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxRotateDampStrengthX(double xstx)
 	{
 		if(xstx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".xst.xstx\" %f;\n", xstx);
+		writeFloat(mFile,"\tsetAttr \".xst.xstx\" ",xstx,";\n");
 	}
 	void setMaxRotateDampStrengthY(double xsty)
 	{
 		if(xsty == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".xst.xsty\" %f;\n", xsty);
+		writeFloat(mFile,"\tsetAttr \".xst.xsty\" ",xsty,";\n");
 	}
 	void setMaxRotateDampStrengthZ(double xstz)
 	{
 		if(xstz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".xst.xstz\" %f;\n", xstz);
+		writeFloat(mFile,"\tsetAttr \".xst.xstz\" ",xstz,";\n");
 	}
 	void setBindPose(const matrix& bps)
 	{
 		if(bps == identity) return;
-		fprintf(mFile,"\tsetAttr \".bps\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".bps\" -type \"matrix\" ");
 		bps.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDrawStyle(unsigned int ds)
 	{
 		if(ds == 0) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %i;\n", ds);
+		writeInt(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void setDrawLabel(bool dl)
 	{
 		if(dl == false) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %i;\n", dl);
+		writeInt(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setSide(unsigned int sd)
 	{
 		if(sd == 0) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %i;\n", sd);
+		writeInt(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void setType(unsigned int typ)
 	{
 		if(typ == 0) return;
-		fprintf(mFile,"\tsetAttr \".typ\" %i;\n", typ);
+		writeInt(mFile,"\tsetAttr \".typ\" ",typ,";\n");
 	}
 	void setOtherType(const string& otp)
 	{
 		if(otp == "jaw") return;
-		fprintf(mFile,"\tsetAttr \".otp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".otp\" -type \"string\" ");
 		otp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRadius(double radi)
 	{
 		if(radi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".radi\" %f;\n", radi);
+		writeFloat(mFile,"\tsetAttr \".radi\" ",radi,";\n");
 	}
 	void setHikNodeID(int hni)
 	{
 		if(hni == -1) return;
-		fprintf(mFile,"\tsetAttr \".hni\" %i;\n", hni);
+		writeInt(mFile,"\tsetAttr \".hni\" ",hni,";\n");
 	}
 	void getJointTypeX()const
 	{
-		fprintf(mFile,"\"%s.jtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jtx\"");
 	}
 	void getJointTypeY()const
 	{
-		fprintf(mFile,"\"%s.jty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jty\"");
 	}
 	void getJointTypeZ()const
 	{
-		fprintf(mFile,"\"%s.jtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jtz\"");
 	}
 	void getJointOrient()const
 	{
-		fprintf(mFile,"\"%s.jo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jo\"");
 	}
 	void getJointOrientX()const
 	{
-		fprintf(mFile,"\"%s.jo.jox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jo.jox\"");
 	}
 	void getJointOrientY()const
 	{
-		fprintf(mFile,"\"%s.jo.joy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jo.joy\"");
 	}
 	void getJointOrientZ()const
 	{
-		fprintf(mFile,"\"%s.jo.joz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jo.joz\"");
 	}
 	void getSegmentScaleCompensate()const
 	{
-		fprintf(mFile,"\"%s.ssc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssc\"");
 	}
 	void getInverseScale()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInverseScaleX()const
 	{
-		fprintf(mFile,"\"%s.is.isx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isx\"");
 	}
 	void getInverseScaleY()const
 	{
-		fprintf(mFile,"\"%s.is.isy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isy\"");
 	}
 	void getInverseScaleZ()const
 	{
-		fprintf(mFile,"\"%s.is.isz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isz\"");
 	}
 	void getStiffness()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getStiffnessX()const
 	{
-		fprintf(mFile,"\"%s.st.stx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.stx\"");
 	}
 	void getStiffnessY()const
 	{
-		fprintf(mFile,"\"%s.st.sty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.sty\"");
 	}
 	void getStiffnessZ()const
 	{
-		fprintf(mFile,"\"%s.st.stz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st.stz\"");
 	}
 	void getPreferredAngle()const
 	{
-		fprintf(mFile,"\"%s.pa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa\"");
 	}
 	void getPreferredAngleX()const
 	{
-		fprintf(mFile,"\"%s.pa.pax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa.pax\"");
 	}
 	void getPreferredAngleY()const
 	{
-		fprintf(mFile,"\"%s.pa.pay\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa.pay\"");
 	}
 	void getPreferredAngleZ()const
 	{
-		fprintf(mFile,"\"%s.pa.paz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa.paz\"");
 	}
 	void getMinRotateDampRange()const
 	{
-		fprintf(mFile,"\"%s.ndr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ndr\"");
 	}
 	void getMinRotateDampRangeX()const
 	{
-		fprintf(mFile,"\"%s.ndr.ndx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ndr.ndx\"");
 	}
 	void getMinRotateDampRangeY()const
 	{
-		fprintf(mFile,"\"%s.ndr.ndy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ndr.ndy\"");
 	}
 	void getMinRotateDampRangeZ()const
 	{
-		fprintf(mFile,"\"%s.ndr.ndz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ndr.ndz\"");
 	}
 	void getMinRotateDampStrength()const
 	{
-		fprintf(mFile,"\"%s.nst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nst\"");
 	}
 	void getMinRotateDampStrengthX()const
 	{
-		fprintf(mFile,"\"%s.nst.nstx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nst.nstx\"");
 	}
 	void getMinRotateDampStrengthY()const
 	{
-		fprintf(mFile,"\"%s.nst.nsty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nst.nsty\"");
 	}
 	void getMinRotateDampStrengthZ()const
 	{
-		fprintf(mFile,"\"%s.nst.nstz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nst.nstz\"");
 	}
 	void getMaxRotateDampRange()const
 	{
-		fprintf(mFile,"\"%s.xdr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xdr\"");
 	}
 	void getMaxRotateDampRangeX()const
 	{
-		fprintf(mFile,"\"%s.xdr.xdx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xdr.xdx\"");
 	}
 	void getMaxRotateDampRangeY()const
 	{
-		fprintf(mFile,"\"%s.xdr.xdy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xdr.xdy\"");
 	}
 	void getMaxRotateDampRangeZ()const
 	{
-		fprintf(mFile,"\"%s.xdr.xdz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xdr.xdz\"");
 	}
 	void getMaxRotateDampStrength()const
 	{
-		fprintf(mFile,"\"%s.xst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xst\"");
 	}
 	void getMaxRotateDampStrengthX()const
 	{
-		fprintf(mFile,"\"%s.xst.xstx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xst.xstx\"");
 	}
 	void getMaxRotateDampStrengthY()const
 	{
-		fprintf(mFile,"\"%s.xst.xsty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xst.xsty\"");
 	}
 	void getMaxRotateDampStrengthZ()const
 	{
-		fprintf(mFile,"\"%s.xst.xstz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xst.xstz\"");
 	}
 	void getBindPose()const
 	{
-		fprintf(mFile,"\"%s.bps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bps\"");
 	}
 	void getDrawLabel()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.radi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".radi\"");
 	}
 	void getHikNodeID()const
 	{
-		fprintf(mFile,"\"%s.hni\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hni\"");
 	}
 protected:
 	Joint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -42,366 +42,366 @@ public:
 	void setChildEnabled(size_t che_i,bool che)
 	{
 		if(che == 0) return;
-		fprintf(mFile,"\tsetAttr \".che[%i]\" %i;\n", che_i,che);
+		writeInt(mFile,"\tsetAttr \".che[",che_i); writeInt(mFile,"]\" ",che,";\n");
 	}
 	void setChildEnabled(size_t che_start,size_t che_end,bool* che)
 	{
-		fprintf(mFile,"\tsetAttr \".che[%i:%i]\" ", che_start,che_end);
+		writeInt(mFile,"\tsetAttr \".che[",che_start); writeInt(mFile,":",che_end,"]\" ");
 		size_t size = (che_end-che_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",che[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",che[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startChildEnabled(size_t che_start,size_t che_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".che[%i:%i]\"",che_start,che_end);
+		writeInt(mFile,"\tsetAttr \".che[",che_start); writeInt(mFile,":",che_end,"]\"");
 	}
 	void appendChildEnabled(bool che)const
 	{
-		fprintf(mFile," %i",che);
+		writeInt(mFile," ",che);
 	}
 	void endChildEnabled()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setJointMidplaneAxis(const double3& jma)
 	{
-		fprintf(mFile,"\tsetAttr \".jma\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".jma\" -type \"double3\" ");
 		jma.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setJointMidplaneAxisX(double jmx)
 	{
 		if(jmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".jma.jmx\" %f;\n", jmx);
+		writeFloat(mFile,"\tsetAttr \".jma.jmx\" ",jmx,";\n");
 	}
 	void setJointMidplaneAxisY(double jmy)
 	{
 		if(jmy == 0) return;
-		fprintf(mFile,"\tsetAttr \".jma.jmy\" %f;\n", jmy);
+		writeFloat(mFile,"\tsetAttr \".jma.jmy\" ",jmy,";\n");
 	}
 	void setJointMidplaneAxisZ(double jmz)
 	{
 		if(jmz == 0) return;
-		fprintf(mFile,"\tsetAttr \".jma.jmz\" %f;\n", jmz);
+		writeFloat(mFile,"\tsetAttr \".jma.jmz\" ",jmz,";\n");
 	}
 	void setChildJointMidplaneAxis(size_t cjm_i,const double3& cjm)
 	{
-		fprintf(mFile,"\tsetAttr \".cjm[%i]\" -type \"double3\" ",cjm_i);
+		writeInt(mFile,"\tsetAttr \".cjm[",cjm_i,"]\" -type \"double3\" ");
 		cjm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChildJointMidplaneAxis(size_t cjm_start,size_t cjm_end,double* cjm)
 	{
-		fprintf(mFile,"\tsetAttr \".cjm[%i:%i]\" ", cjm_start,cjm_end);
+		writeInt(mFile,"\tsetAttr \".cjm[",cjm_start); writeInt(mFile,":",cjm_end,"]\" ");
 		size_t size = (cjm_end-cjm_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cjm[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",cjm[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startChildJointMidplaneAxis(size_t cjm_start,size_t cjm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cjm[%i:%i]\"",cjm_start,cjm_end);
+		writeInt(mFile,"\tsetAttr \".cjm[",cjm_start); writeInt(mFile,":",cjm_end,"]\"");
 	}
 	void appendChildJointMidplaneAxis(double cjm)const
 	{
-		fprintf(mFile," %f",cjm);
+		writeFloat(mFile," ",cjm);
 	}
 	void endChildJointMidplaneAxis()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setChildjointMidplaneAxisX(size_t cjm_i,double cmx)
 	{
 		if(cmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjm[%i].cmx\" %f;\n", cjm_i,cmx);
+		writeInt(mFile,"\tsetAttr \".cjm[",cjm_i); writeFloat(mFile,"].cmx\" ",cmx,";\n");
 	}
 	void setChildjointMidplaneAxisY(size_t cjm_i,double cmy)
 	{
 		if(cmy == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjm[%i].cmy\" %f;\n", cjm_i,cmy);
+		writeInt(mFile,"\tsetAttr \".cjm[",cjm_i); writeFloat(mFile,"].cmy\" ",cmy,";\n");
 	}
 	void setChildjointMidplaneAxisZ(size_t cjm_i,double cmz)
 	{
 		if(cmz == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjm[%i].cmz\" %f;\n", cjm_i,cmz);
+		writeInt(mFile,"\tsetAttr \".cjm[",cjm_i); writeFloat(mFile,"].cmz\" ",cmz,";\n");
 	}
 	void setBoneLength(float bl)
 	{
 		if(bl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bl\" %f;\n", bl);
+		writeFloat(mFile,"\tsetAttr \".bl\" ",bl,";\n");
 	}
 	void setUpperBound(float ub)
 	{
 		if(ub == 10) return;
-		fprintf(mFile,"\tsetAttr \".ub\" %f;\n", ub);
+		writeFloat(mFile,"\tsetAttr \".ub\" ",ub,";\n");
 	}
 	void setUpperValue(float uv)
 	{
 		if(uv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".uv\" %f;\n", uv);
+		writeFloat(mFile,"\tsetAttr \".uv\" ",uv,";\n");
 	}
 	void setLowerBound(float lb)
 	{
 		if(lb == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".lb\" %f;\n", lb);
+		writeFloat(mFile,"\tsetAttr \".lb\" ",lb,";\n");
 	}
 	void setLowerValue(float lv)
 	{
 		if(lv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lv\" %f;\n", lv);
+		writeFloat(mFile,"\tsetAttr \".lv\" ",lv,";\n");
 	}
 	void setUpperDropoffType(unsigned int udt)
 	{
 		if(udt == 0) return;
-		fprintf(mFile,"\tsetAttr \".udt\" %i;\n", udt);
+		writeInt(mFile,"\tsetAttr \".udt\" ",udt,";\n");
 	}
 	void setLowerDropoffType(unsigned int ldt)
 	{
 		if(ldt == 0) return;
-		fprintf(mFile,"\tsetAttr \".ldt\" %i;\n", ldt);
+		writeInt(mFile,"\tsetAttr \".ldt\" ",ldt,";\n");
 	}
 	void setUpperEnabled(bool upe)
 	{
 		if(upe == 0) return;
-		fprintf(mFile,"\tsetAttr \".upe\" %i;\n", upe);
+		writeInt(mFile,"\tsetAttr \".upe\" ",upe,";\n");
 	}
 	void setConvertedTo2(bool ct2)
 	{
 		if(ct2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ct2\" %i;\n", ct2);
+		writeInt(mFile,"\tsetAttr \".ct2\" ",ct2,";\n");
 	}
 	void getRedoLowerWeights()const
 	{
-		fprintf(mFile,"\"%s.rlw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlw\"");
 	}
 	void getRedoUpperWeights()const
 	{
-		fprintf(mFile,"\"%s.ruw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ruw\"");
 	}
 	void getChildJointClusterXforms(size_t cjx_i)const
 	{
-		fprintf(mFile,"\"%s.cjx[%i]\"",mName.c_str(),cjx_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjx[",cjx_i,"]\"");
 	}
 	void getChildJointClusterXforms()const
 	{
 
-		fprintf(mFile,"\"%s.cjx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjx\"");
 	}
 	void getChildJointPreMatrix(size_t cjx_i)const
 	{
-		fprintf(mFile,"\"%s.cjx[%i].cpr\"",mName.c_str(),cjx_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjx[",cjx_i,"].cpr\"");
 	}
 	void getChildJointPreMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.cjx.cpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjx.cpr\"");
 	}
 	void getChildJointWeightedMatrix(size_t cjx_i)const
 	{
-		fprintf(mFile,"\"%s.cjx[%i].cjw\"",mName.c_str(),cjx_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjx[",cjx_i,"].cjw\"");
 	}
 	void getChildJointWeightedMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.cjx.cjw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjx.cjw\"");
 	}
 	void getChildJointPostMatrix(size_t cjx_i)const
 	{
-		fprintf(mFile,"\"%s.cjx[%i].cpo\"",mName.c_str(),cjx_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjx[",cjx_i,"].cpo\"");
 	}
 	void getChildJointPostMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.cjx.cpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjx.cpo\"");
 	}
 	void getChildJointPreCompensationMatrix(size_t cjpr_i)const
 	{
-		fprintf(mFile,"\"%s.cjpr[%i]\"",mName.c_str(),cjpr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjpr[",cjpr_i,"]\"");
 	}
 	void getChildJointPreCompensationMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.cjpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjpr\"");
 	}
 	void getChildJointWeightedCompensationMatrix(size_t cjwc_i)const
 	{
-		fprintf(mFile,"\"%s.cjwc[%i]\"",mName.c_str(),cjwc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjwc[",cjwc_i,"]\"");
 	}
 	void getChildJointWeightedCompensationMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.cjwc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjwc\"");
 	}
 	void getChildJointPostCompensationMatrix(size_t cjps_i)const
 	{
-		fprintf(mFile,"\"%s.cjps[%i]\"",mName.c_str(),cjps_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjps[",cjps_i,"]\"");
 	}
 	void getChildJointPostCompensationMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.cjps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjps\"");
 	}
 	void getBindPose()const
 	{
-		fprintf(mFile,"\"%s.bp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bp\"");
 	}
 	void getNextJointBindPose()const
 	{
-		fprintf(mFile,"\"%s.njb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njb\"");
 	}
 	void getChildJointBindPose(size_t cjb_i)const
 	{
-		fprintf(mFile,"\"%s.cjb[%i]\"",mName.c_str(),cjb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjb[",cjb_i,"]\"");
 	}
 	void getChildJointBindPose()const
 	{
 
-		fprintf(mFile,"\"%s.cjb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjb\"");
 	}
 	void getJointMidplaneAxis()const
 	{
-		fprintf(mFile,"\"%s.jma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jma\"");
 	}
 	void getJointMidplaneAxisX()const
 	{
-		fprintf(mFile,"\"%s.jma.jmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jma.jmx\"");
 	}
 	void getJointMidplaneAxisY()const
 	{
-		fprintf(mFile,"\"%s.jma.jmy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jma.jmy\"");
 	}
 	void getJointMidplaneAxisZ()const
 	{
-		fprintf(mFile,"\"%s.jma.jmz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jma.jmz\"");
 	}
 	void getNextJointClusterXforms()const
 	{
-		fprintf(mFile,"\"%s.njx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njx\"");
 	}
 	void getNextJointPreMatrix()const
 	{
-		fprintf(mFile,"\"%s.njx.npr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njx.npr\"");
 	}
 	void getNextJointWeightedMatrix()const
 	{
-		fprintf(mFile,"\"%s.njx.njw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njx.njw\"");
 	}
 	void getNextJointPostMatrix()const
 	{
-		fprintf(mFile,"\"%s.njx.npo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njx.npo\"");
 	}
 	void getNextJointPreCompensationMatrix()const
 	{
-		fprintf(mFile,"\"%s.njpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njpr\"");
 	}
 	void getNextJointWeightedCompensationMatrix()const
 	{
-		fprintf(mFile,"\"%s.njwc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njwc\"");
 	}
 	void getNextJointPostCompensationMatrix()const
 	{
-		fprintf(mFile,"\"%s.njps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njps\"");
 	}
 	void getNextJointMidplaneAxis()const
 	{
-		fprintf(mFile,"\"%s.njm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njm\"");
 	}
 	void getNextjointMidplaneAxisX()const
 	{
-		fprintf(mFile,"\"%s.njm.nmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njm.nmx\"");
 	}
 	void getNextjointMidplaneAxisY()const
 	{
-		fprintf(mFile,"\"%s.njm.nmy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njm.nmy\"");
 	}
 	void getNextjointMidplaneAxisZ()const
 	{
-		fprintf(mFile,"\"%s.njm.nmz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".njm.nmz\"");
 	}
 	void getChildJointMidplaneAxis(size_t cjm_i)const
 	{
-		fprintf(mFile,"\"%s.cjm[%i]\"",mName.c_str(),cjm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjm[",cjm_i,"]\"");
 	}
 	void getChildJointMidplaneAxis()const
 	{
 
-		fprintf(mFile,"\"%s.cjm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjm\"");
 	}
 	void getChildjointMidplaneAxisX(size_t cjm_i)const
 	{
-		fprintf(mFile,"\"%s.cjm[%i].cmx\"",mName.c_str(),cjm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjm[",cjm_i,"].cmx\"");
 	}
 	void getChildjointMidplaneAxisX()const
 	{
 
-		fprintf(mFile,"\"%s.cjm.cmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjm.cmx\"");
 	}
 	void getChildjointMidplaneAxisY(size_t cjm_i)const
 	{
-		fprintf(mFile,"\"%s.cjm[%i].cmy\"",mName.c_str(),cjm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjm[",cjm_i,"].cmy\"");
 	}
 	void getChildjointMidplaneAxisY()const
 	{
 
-		fprintf(mFile,"\"%s.cjm.cmy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjm.cmy\"");
 	}
 	void getChildjointMidplaneAxisZ(size_t cjm_i)const
 	{
-		fprintf(mFile,"\"%s.cjm[%i].cmz\"",mName.c_str(),cjm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cjm[",cjm_i,"].cmz\"");
 	}
 	void getChildjointMidplaneAxisZ()const
 	{
 
-		fprintf(mFile,"\"%s.cjm.cmz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjm.cmz\"");
 	}
 	void getDistanceList(size_t dl_i)const
 	{
-		fprintf(mFile,"\"%s.dl[%i]\"",mName.c_str(),dl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dl[",dl_i,"]\"");
 	}
 	void getDistanceList()const
 	{
 
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getDistances(size_t dl_i,size_t cd_i)const
 	{
-		fprintf(mFile,"\"%s.dl[%i].cd[%i]\"",mName.c_str(),dl_i,cd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dl[",dl_i); writeInt(mFile,"].cd[",cd_i,"]\"");
 	}
 	void getDistances(size_t cd_i)const
 	{
 
-		fprintf(mFile,"\"%s.dl.cd[%i]\"",mName.c_str(),cd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dl.cd[",cd_i,"]\"");
 	}
 	void getBoneLength()const
 	{
-		fprintf(mFile,"\"%s.bl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bl\"");
 	}
 	void getUpperBound()const
 	{
-		fprintf(mFile,"\"%s.ub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ub\"");
 	}
 	void getUpperValue()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getLowerBound()const
 	{
-		fprintf(mFile,"\"%s.lb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lb\"");
 	}
 	void getLowerValue()const
 	{
-		fprintf(mFile,"\"%s.lv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lv\"");
 	}
 	void getClusterFlexorSet()const
 	{
-		fprintf(mFile,"\"%s.cfs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfs\"");
 	}
 protected:
 	JointCluster(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,48 +27,48 @@ public:
 	void setBaseLattice2Matrix(const matrix& b2)
 	{
 		if(b2 == identity) return;
-		fprintf(mFile,"\tsetAttr \".b2\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".b2\" -type \"matrix\" ");
 		b2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseComponentCache(bool uc)
 	{
 		if(uc == true) return;
-		fprintf(mFile,"\tsetAttr \".uc\" %i;\n", uc);
+		writeInt(mFile,"\tsetAttr \".uc\" ",uc,";\n");
 	}
 	void getBaseLattice2Matrix()const
 	{
-		fprintf(mFile,"\"%s.b2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b2\"");
 	}
 	void getGroupIdUpperBindSkin(size_t gu_i)const
 	{
-		fprintf(mFile,"\"%s.gu[%i]\"",mName.c_str(),gu_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gu[",gu_i,"]\"");
 	}
 	void getGroupIdUpperBindSkin()const
 	{
 
-		fprintf(mFile,"\"%s.gu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gu\"");
 	}
 	void getGroupIdLowerBindSkin(size_t gl_i)const
 	{
-		fprintf(mFile,"\"%s.gl[%i]\"",mName.c_str(),gl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gl[",gl_i,"]\"");
 	}
 	void getGroupIdLowerBindSkin()const
 	{
 
-		fprintf(mFile,"\"%s.gl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gl\"");
 	}
 	void getUpperBindSkinNode()const
 	{
-		fprintf(mFile,"\"%s.ub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ub\"");
 	}
 	void getLowerBindSkinNode()const
 	{
-		fprintf(mFile,"\"%s.lb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lb\"");
 	}
 	void getUseComponentCache()const
 	{
-		fprintf(mFile,"\"%s.uc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uc\"");
 	}
 protected:
 	JointFfd(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,176 +27,176 @@ public:
 	void setCreasing(double cr)
 	{
 		if(cr == 0) return;
-		fprintf(mFile,"\tsetAttr \".cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".cr\" ",cr,";\n");
 	}
 	void setRounding(double ro)
 	{
 		if(ro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %f;\n", ro);
+		writeFloat(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void setLengthIn(double li)
 	{
 		if(li == 0) return;
-		fprintf(mFile,"\tsetAttr \".li\" %f;\n", li);
+		writeFloat(mFile,"\tsetAttr \".li\" ",li,";\n");
 	}
 	void setLengthOut(double lo)
 	{
 		if(lo == 0) return;
-		fprintf(mFile,"\tsetAttr \".lo\" %f;\n", lo);
+		writeFloat(mFile,"\tsetAttr \".lo\" ",lo,";\n");
 	}
 	void setWidthLeft(double wl)
 	{
 		if(wl == 0) return;
-		fprintf(mFile,"\tsetAttr \".wl\" %f;\n", wl);
+		writeFloat(mFile,"\tsetAttr \".wl\" ",wl,";\n");
 	}
 	void setWidthRight(double wr)
 	{
 		if(wr == 0) return;
-		fprintf(mFile,"\tsetAttr \".wr\" %f;\n", wr);
+		writeFloat(mFile,"\tsetAttr \".wr\" ",wr,";\n");
 	}
 	void setUpperMatrix(const matrix& um)
 	{
 		if(um == identity) return;
-		fprintf(mFile,"\tsetAttr \".um\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".um\" -type \"matrix\" ");
 		um.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLowerMatrix(const matrix& lm)
 	{
 		if(lm == identity) return;
-		fprintf(mFile,"\tsetAttr \".lm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".lm\" -type \"matrix\" ");
 		lm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialUpperMatrix(const matrix& iu)
 	{
 		if(iu == identity) return;
-		fprintf(mFile,"\tsetAttr \".iu\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".iu\" -type \"matrix\" ");
 		iu.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialLowerMatrix(const matrix& il)
 	{
 		if(il == identity) return;
-		fprintf(mFile,"\tsetAttr \".il\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".il\" -type \"matrix\" ");
 		il.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDeformedLatticeMatrix(const matrix& md)
 	{
 		if(md == identity) return;
-		fprintf(mFile,"\tsetAttr \".md\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".md\" -type \"matrix\" ");
 		md.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBaseLatticeMatrix(const matrix& mb)
 	{
 		if(mb == identity) return;
-		fprintf(mFile,"\tsetAttr \".mb\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".mb\" -type \"matrix\" ");
 		mb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBendVector(const float3& bv)
 	{
-		fprintf(mFile,"\tsetAttr \".bv\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".bv\" -type \"float3\" ");
 		bv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBendVectorX(float bx)
 	{
 		if(bx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bv.bx\" %f;\n", bx);
+		writeFloat(mFile,"\tsetAttr \".bv.bx\" ",bx,";\n");
 	}
 	void setBendVectorY(float by)
 	{
 		if(by == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bv.by\" %f;\n", by);
+		writeFloat(mFile,"\tsetAttr \".bv.by\" ",by,";\n");
 	}
 	void setBendVectorZ(float bz)
 	{
 		if(bz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bv.bz\" %f;\n", bz);
+		writeFloat(mFile,"\tsetAttr \".bv.bz\" ",bz,";\n");
 	}
 	void setBendMagnitude(double bm)
 	{
 		if(bm == 0) return;
-		fprintf(mFile,"\tsetAttr \".bm\" %f;\n", bm);
+		writeFloat(mFile,"\tsetAttr \".bm\" ",bm,";\n");
 	}
 	void getCreasing()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getRounding()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getLengthIn()const
 	{
-		fprintf(mFile,"\"%s.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".li\"");
 	}
 	void getLengthOut()const
 	{
-		fprintf(mFile,"\"%s.lo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lo\"");
 	}
 	void getWidthLeft()const
 	{
-		fprintf(mFile,"\"%s.wl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wl\"");
 	}
 	void getWidthRight()const
 	{
-		fprintf(mFile,"\"%s.wr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wr\"");
 	}
 	void getUpperMatrix()const
 	{
-		fprintf(mFile,"\"%s.um\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".um\"");
 	}
 	void getLowerMatrix()const
 	{
-		fprintf(mFile,"\"%s.lm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lm\"");
 	}
 	void getInitialUpperMatrix()const
 	{
-		fprintf(mFile,"\"%s.iu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iu\"");
 	}
 	void getInitialLowerMatrix()const
 	{
-		fprintf(mFile,"\"%s.il\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".il\"");
 	}
 	void getDeformedLatticeMatrix()const
 	{
-		fprintf(mFile,"\"%s.md\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".md\"");
 	}
 	void getBaseLatticeMatrix()const
 	{
-		fprintf(mFile,"\"%s.mb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mb\"");
 	}
 	void getAdjustedUpperBaseLatticeMatrix()const
 	{
-		fprintf(mFile,"\"%s.au\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".au\"");
 	}
 	void getAdjustedLowerBaseLatticeMatrix()const
 	{
-		fprintf(mFile,"\"%s.al\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al\"");
 	}
 	void getBendVector()const
 	{
-		fprintf(mFile,"\"%s.bv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv\"");
 	}
 	void getBendVectorX()const
 	{
-		fprintf(mFile,"\"%s.bv.bx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv.bx\"");
 	}
 	void getBendVectorY()const
 	{
-		fprintf(mFile,"\"%s.bv.by\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv.by\"");
 	}
 	void getBendVectorZ()const
 	{
-		fprintf(mFile,"\"%s.bv.bz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bv.bz\"");
 	}
 	void getBendMagnitude()const
 	{
-		fprintf(mFile,"\"%s.bm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bm\"");
 	}
 protected:
 	JointLattice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,974 +27,974 @@ public:
 	void setRefractionLimit(short rdl)
 	{
 		if(rdl == 6) return;
-		fprintf(mFile,"\tsetAttr \".rdl\" %i;\n", rdl);
+		writeInt(mFile,"\tsetAttr \".rdl\" ",rdl,";\n");
 	}
 	void setRefractiveIndex(float rfi)
 	{
 		if(rfi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rfi\" %f;\n", rfi);
+		writeFloat(mFile,"\tsetAttr \".rfi\" ",rfi,";\n");
 	}
 	void setRefractions(bool rfc)
 	{
 		if(rfc == false) return;
-		fprintf(mFile,"\tsetAttr \".rfc\" %i;\n", rfc);
+		writeInt(mFile,"\tsetAttr \".rfc\" ",rfc,";\n");
 	}
 	void setDiffuse(float dc)
 	{
 		if(dc == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %f;\n", dc);
+		writeFloat(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void setColor(const float3& c)
 	{
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".c.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".c.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".c.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".c.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".c.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".c.cb\" ",cb,";\n");
 	}
 	void setTransparency(const float3& it)
 	{
-		fprintf(mFile,"\tsetAttr \".it\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".it\" -type \"float3\" ");
 		it.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparencyR(float itr)
 	{
 		if(itr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itr\" %f;\n", itr);
+		writeFloat(mFile,"\tsetAttr \".it.itr\" ",itr,";\n");
 	}
 	void setTransparencyG(float itg)
 	{
 		if(itg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itg\" %f;\n", itg);
+		writeFloat(mFile,"\tsetAttr \".it.itg\" ",itg,";\n");
 	}
 	void setTransparencyB(float itb)
 	{
 		if(itb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itb\" %f;\n", itb);
+		writeFloat(mFile,"\tsetAttr \".it.itb\" ",itb,";\n");
 	}
 	void setAmbientColor(const float3& ambc)
 	{
-		fprintf(mFile,"\tsetAttr \".ambc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ambc\" -type \"float3\" ");
 		ambc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAmbientColorR(float acr)
 	{
 		if(acr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acr\" %f;\n", acr);
+		writeFloat(mFile,"\tsetAttr \".ambc.acr\" ",acr,";\n");
 	}
 	void setAmbientColorG(float acg)
 	{
 		if(acg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acg\" %f;\n", acg);
+		writeFloat(mFile,"\tsetAttr \".ambc.acg\" ",acg,";\n");
 	}
 	void setAmbientColorB(float acb)
 	{
 		if(acb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acb\" %f;\n", acb);
+		writeFloat(mFile,"\tsetAttr \".ambc.acb\" ",acb,";\n");
 	}
 	void setIncandescence(const float3& ic)
 	{
-		fprintf(mFile,"\tsetAttr \".ic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ic\" -type \"float3\" ");
 		ic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescenceR(float ir)
 	{
 		if(ir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ir\" %f;\n", ir);
+		writeFloat(mFile,"\tsetAttr \".ic.ir\" ",ir,";\n");
 	}
 	void setIncandescenceG(float ig)
 	{
 		if(ig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ig\" %f;\n", ig);
+		writeFloat(mFile,"\tsetAttr \".ic.ig\" ",ig,";\n");
 	}
 	void setIncandescenceB(float ib)
 	{
 		if(ib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ib\" %f;\n", ib);
+		writeFloat(mFile,"\tsetAttr \".ic.ib\" ",ib,";\n");
 	}
 	void setTranslucence(float tc)
 	{
 		if(tc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tc\" %f;\n", tc);
+		writeFloat(mFile,"\tsetAttr \".tc\" ",tc,";\n");
 	}
 	void setTranslucenceFocus(float tcf)
 	{
 		if(tcf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tcf\" %f;\n", tcf);
+		writeFloat(mFile,"\tsetAttr \".tcf\" ",tcf,";\n");
 	}
 	void setTranslucenceDepth(float trsd)
 	{
 		if(trsd == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".trsd\" %f;\n", trsd);
+		writeFloat(mFile,"\tsetAttr \".trsd\" ",trsd,";\n");
 	}
 	void setOpacityDepth(float opad)
 	{
 		if(opad == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".opad\" %f;\n", opad);
+		writeFloat(mFile,"\tsetAttr \".opad\" ",opad,";\n");
 	}
 	void setGlowIntensity(float gi)
 	{
 		if(gi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %f;\n", gi);
+		writeFloat(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void setVrOverwriteDefaults(bool vrod)
 	{
 		if(vrod == 0) return;
-		fprintf(mFile,"\tsetAttr \".vrod\" %i;\n", vrod);
+		writeInt(mFile,"\tsetAttr \".vrod\" ",vrod,";\n");
 	}
 	void setVrFillObject(unsigned int vrfo)
 	{
 		if(vrfo == 0) return;
-		fprintf(mFile,"\tsetAttr \".vrfo\" %i;\n", vrfo);
+		writeInt(mFile,"\tsetAttr \".vrfo\" ",vrfo,";\n");
 	}
 	void setVrEdgeWeight(double vrew)
 	{
 		if(vrew == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vrew\" %f;\n", vrew);
+		writeFloat(mFile,"\tsetAttr \".vrew\" ",vrew,";\n");
 	}
 	void setVrEdgeColor(const float3& vrec)
 	{
-		fprintf(mFile,"\tsetAttr \".vrec\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vrec\" -type \"float3\" ");
 		vrec.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVrEdgeColorR(float vecr)
 	{
 		if(vecr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".vrec.vecr\" %f;\n", vecr);
+		writeFloat(mFile,"\tsetAttr \".vrec.vecr\" ",vecr,";\n");
 	}
 	void setVrEdgeColorG(float vecg)
 	{
 		if(vecg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".vrec.vecg\" %f;\n", vecg);
+		writeFloat(mFile,"\tsetAttr \".vrec.vecg\" ",vecg,";\n");
 	}
 	void setVrEdgeColorB(float vecb)
 	{
 		if(vecb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".vrec.vecb\" %f;\n", vecb);
+		writeFloat(mFile,"\tsetAttr \".vrec.vecb\" ",vecb,";\n");
 	}
 	void setVrEdgeStyle(unsigned int vres)
 	{
 		if(vres == 0) return;
-		fprintf(mFile,"\tsetAttr \".vres\" %i;\n", vres);
+		writeInt(mFile,"\tsetAttr \".vres\" ",vres,";\n");
 	}
 	void setVrEdgePriority(int vrep)
 	{
 		if(vrep == 0) return;
-		fprintf(mFile,"\tsetAttr \".vrep\" %i;\n", vrep);
+		writeInt(mFile,"\tsetAttr \".vrep\" ",vrep,";\n");
 	}
 	void setVrHiddenEdges(bool vrhe)
 	{
 		if(vrhe == 0) return;
-		fprintf(mFile,"\tsetAttr \".vrhe\" %i;\n", vrhe);
+		writeInt(mFile,"\tsetAttr \".vrhe\" ",vrhe,";\n");
 	}
 	void setVrHiddenEdgesOnTransparent(bool vrht)
 	{
 		if(vrht == 0) return;
-		fprintf(mFile,"\tsetAttr \".vrht\" %i;\n", vrht);
+		writeInt(mFile,"\tsetAttr \".vrht\" ",vrht,";\n");
 	}
 	void setVrOutlinesAtIntersections(bool vroi)
 	{
 		if(vroi == 1) return;
-		fprintf(mFile,"\tsetAttr \".vroi\" %i;\n", vroi);
+		writeInt(mFile,"\tsetAttr \".vroi\" ",vroi,";\n");
 	}
 	void setMaterialAlphaGain(float maga)
 	{
 		if(maga == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".maga\" %f;\n", maga);
+		writeFloat(mFile,"\tsetAttr \".maga\" ",maga,";\n");
 	}
 	void setHideSource(bool hs)
 	{
 		if(hs == false) return;
-		fprintf(mFile,"\tsetAttr \".hs\" %i;\n", hs);
+		writeInt(mFile,"\tsetAttr \".hs\" ",hs,";\n");
 	}
 	void setSurfaceThickness(float thik)
 	{
 		if(thik == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".thik\" %f;\n", thik);
+		writeFloat(mFile,"\tsetAttr \".thik\" ",thik,";\n");
 	}
 	void setShadowAttenuation(float fakc)
 	{
 		if(fakc == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".fakc\" %f;\n", fakc);
+		writeFloat(mFile,"\tsetAttr \".fakc\" ",fakc,";\n");
 	}
 	void setTransparencyDepth(float trdp)
 	{
 		if(trdp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".trdp\" %f;\n", trdp);
+		writeFloat(mFile,"\tsetAttr \".trdp\" ",trdp,";\n");
 	}
 	void setLightAbsorbance(float absb)
 	{
 		if(absb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".absb\" %f;\n", absb);
+		writeFloat(mFile,"\tsetAttr \".absb\" ",absb,";\n");
 	}
 	void setChromaticAberration(bool crab)
 	{
 		if(crab == false) return;
-		fprintf(mFile,"\tsetAttr \".crab\" %i;\n", crab);
+		writeInt(mFile,"\tsetAttr \".crab\" ",crab,";\n");
 	}
 	void setMatteOpacityMode(unsigned int mom)
 	{
 		if(mom == 2) return;
-		fprintf(mFile,"\tsetAttr \".mom\" %i;\n", mom);
+		writeInt(mFile,"\tsetAttr \".mom\" ",mom,";\n");
 	}
 	void setMatteOpacity(float mog)
 	{
 		if(mog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mog\" %f;\n", mog);
+		writeFloat(mFile,"\tsetAttr \".mog\" ",mog,";\n");
 	}
 	void setMiRefractionBlur(float mirfb)
 	{
 		if(mirfb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mirfb\" %f;\n", mirfb);
+		writeFloat(mFile,"\tsetAttr \".mirfb\" ",mirfb,";\n");
 	}
 	void setMiRefractionRays(short mirfr)
 	{
 		if(mirfr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mirfr\" %i;\n", mirfr);
+		writeInt(mFile,"\tsetAttr \".mirfr\" ",mirfr,";\n");
 	}
 	void setMiIrradiance(const float3& mii)
 	{
-		fprintf(mFile,"\tsetAttr \".mii\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mii\" -type \"float3\" ");
 		mii.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiIrradianceR(float miir)
 	{
 		if(miir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miir\" %f;\n", miir);
+		writeFloat(mFile,"\tsetAttr \".mii.miir\" ",miir,";\n");
 	}
 	void setMiIrradianceG(float miig)
 	{
 		if(miig == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miig\" %f;\n", miig);
+		writeFloat(mFile,"\tsetAttr \".mii.miig\" ",miig,";\n");
 	}
 	void setMiIrradianceB(float miib)
 	{
 		if(miib == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miib\" %f;\n", miib);
+		writeFloat(mFile,"\tsetAttr \".mii.miib\" ",miib,";\n");
 	}
 	void setMiIrradianceColor(const float3& miic)
 	{
-		fprintf(mFile,"\tsetAttr \".miic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".miic\" -type \"float3\" ");
 		miic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiIrradianceColorR(float miicr)
 	{
 		if(miicr == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicr\" %f;\n", miicr);
+		writeFloat(mFile,"\tsetAttr \".miic.miicr\" ",miicr,";\n");
 	}
 	void setMiIrradianceColorG(float miicg)
 	{
 		if(miicg == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicg\" %f;\n", miicg);
+		writeFloat(mFile,"\tsetAttr \".miic.miicg\" ",miicg,";\n");
 	}
 	void setMiIrradianceColorB(float miicb)
 	{
 		if(miicb == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicb\" %f;\n", miicb);
+		writeFloat(mFile,"\tsetAttr \".miic.miicb\" ",miicb,";\n");
 	}
 	void setMiDeriveFromMaya(bool mifm)
 	{
 		if(mifm == true) return;
-		fprintf(mFile,"\tsetAttr \".mifm\" %i;\n", mifm);
+		writeInt(mFile,"\tsetAttr \".mifm\" ",mifm,";\n");
 	}
 	void setMiRefractiveIndex(float miri)
 	{
 		if(miri == 1) return;
-		fprintf(mFile,"\tsetAttr \".miri\" %f;\n", miri);
+		writeFloat(mFile,"\tsetAttr \".miri\" ",miri,";\n");
 	}
 	void setMiRefractions(bool mirc)
 	{
 		if(mirc == true) return;
-		fprintf(mFile,"\tsetAttr \".mirc\" %i;\n", mirc);
+		writeInt(mFile,"\tsetAttr \".mirc\" ",mirc,";\n");
 	}
 	void setMiAbsorbs(bool miab)
 	{
 		if(miab == true) return;
-		fprintf(mFile,"\tsetAttr \".miab\" %i;\n", miab);
+		writeInt(mFile,"\tsetAttr \".miab\" ",miab,";\n");
 	}
 	void setMiDiffuse(float midc)
 	{
 		if(midc == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".midc\" %f;\n", midc);
+		writeFloat(mFile,"\tsetAttr \".midc\" ",midc,";\n");
 	}
 	void setMiColor(const float3& mic)
 	{
-		fprintf(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
 		mic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiColorR(float micr)
 	{
 		if(micr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micr\" %f;\n", micr);
+		writeFloat(mFile,"\tsetAttr \".mic.micr\" ",micr,";\n");
 	}
 	void setMiColorG(float micg)
 	{
 		if(micg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micg\" %f;\n", micg);
+		writeFloat(mFile,"\tsetAttr \".mic.micg\" ",micg,";\n");
 	}
 	void setMiColorB(float micb)
 	{
 		if(micb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micb\" %f;\n", micb);
+		writeFloat(mFile,"\tsetAttr \".mic.micb\" ",micb,";\n");
 	}
 	void setMiTransparency(const float3& mit)
 	{
-		fprintf(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
 		mit.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiTransparencyR(float mitr)
 	{
 		if(mitr == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitr\" %f;\n", mitr);
+		writeFloat(mFile,"\tsetAttr \".mit.mitr\" ",mitr,";\n");
 	}
 	void setMiTransparencyG(float mitg)
 	{
 		if(mitg == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitg\" %f;\n", mitg);
+		writeFloat(mFile,"\tsetAttr \".mit.mitg\" ",mitg,";\n");
 	}
 	void setMiTransparencyB(float mitb)
 	{
 		if(mitb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitb\" %f;\n", mitb);
+		writeFloat(mFile,"\tsetAttr \".mit.mitb\" ",mitb,";\n");
 	}
 	void setMiTranslucence(float mitc)
 	{
 		if(mitc == 0) return;
-		fprintf(mFile,"\tsetAttr \".mitc\" %f;\n", mitc);
+		writeFloat(mFile,"\tsetAttr \".mitc\" ",mitc,";\n");
 	}
 	void setMiTranslucenceFocus(float mitf)
 	{
 		if(mitf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mitf\" %f;\n", mitf);
+		writeFloat(mFile,"\tsetAttr \".mitf\" ",mitf,";\n");
 	}
 	void setMiNormalCamera(const float3& minc)
 	{
-		fprintf(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
 		minc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiNormalCameraX(float mincx)
 	{
 		if(mincx == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincx\" %f;\n", mincx);
+		writeFloat(mFile,"\tsetAttr \".minc.mincx\" ",mincx,";\n");
 	}
 	void setMiNormalCameraY(float mincy)
 	{
 		if(mincy == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincy\" %f;\n", mincy);
+		writeFloat(mFile,"\tsetAttr \".minc.mincy\" ",mincy,";\n");
 	}
 	void setMiNormalCameraZ(float mincz)
 	{
 		if(mincz == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincz\" %f;\n", mincz);
+		writeFloat(mFile,"\tsetAttr \".minc.mincz\" ",mincz,";\n");
 	}
 	void getObjectId()const
 	{
-		fprintf(mFile,"\"%s.oi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi\"");
 	}
 	void getPrimitiveId()const
 	{
-		fprintf(mFile,"\"%s.pi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi\"");
 	}
 	void getRaySampler()const
 	{
-		fprintf(mFile,"\"%s.rtr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtr\"");
 	}
 	void getRayDepth()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 	void getRayInstance()const
 	{
-		fprintf(mFile,"\"%s.ryi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ryi\"");
 	}
 	void getRefractionLimit()const
 	{
-		fprintf(mFile,"\"%s.rdl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdl\"");
 	}
 	void getRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.rfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfi\"");
 	}
 	void getMediumRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.mrfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrfi\"");
 	}
 	void getRefractions()const
 	{
-		fprintf(mFile,"\"%s.rfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfc\"");
 	}
 	void getDiffuse()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getRayDirection()const
 	{
-		fprintf(mFile,"\"%s.rad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad\"");
 	}
 	void getRayDirectionX()const
 	{
-		fprintf(mFile,"\"%s.rad.rdx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdx\"");
 	}
 	void getRayDirectionY()const
 	{
-		fprintf(mFile,"\"%s.rad.rdy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdy\"");
 	}
 	void getRayDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.rad.rdz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdz\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.c.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.c.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.c.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cb\"");
 	}
 	void getTransparency()const
 	{
-		fprintf(mFile,"\"%s.it\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it\"");
 	}
 	void getTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.it.itr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itr\"");
 	}
 	void getTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.it.itg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itg\"");
 	}
 	void getTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.it.itb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itb\"");
 	}
 	void getAmbientColor()const
 	{
-		fprintf(mFile,"\"%s.ambc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc\"");
 	}
 	void getAmbientColorR()const
 	{
-		fprintf(mFile,"\"%s.ambc.acr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acr\"");
 	}
 	void getAmbientColorG()const
 	{
-		fprintf(mFile,"\"%s.ambc.acg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acg\"");
 	}
 	void getAmbientColorB()const
 	{
-		fprintf(mFile,"\"%s.ambc.acb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acb\"");
 	}
 	void getIncandescence()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getIncandescenceR()const
 	{
-		fprintf(mFile,"\"%s.ic.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ir\"");
 	}
 	void getIncandescenceG()const
 	{
-		fprintf(mFile,"\"%s.ic.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ig\"");
 	}
 	void getIncandescenceB()const
 	{
-		fprintf(mFile,"\"%s.ic.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ib\"");
 	}
 	void getTranslucence()const
 	{
-		fprintf(mFile,"\"%s.tc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc\"");
 	}
 	void getTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.tcf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcf\"");
 	}
 	void getTranslucenceDepth()const
 	{
-		fprintf(mFile,"\"%s.trsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trsd\"");
 	}
 	void getOpacityDepth()const
 	{
-		fprintf(mFile,"\"%s.opad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opad\"");
 	}
 	void getGlowIntensity()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 	void getVrOverwriteDefaults()const
 	{
-		fprintf(mFile,"\"%s.vrod\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrod\"");
 	}
 	void getVrFillObject()const
 	{
-		fprintf(mFile,"\"%s.vrfo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrfo\"");
 	}
 	void getVrEdgeWeight()const
 	{
-		fprintf(mFile,"\"%s.vrew\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrew\"");
 	}
 	void getVrEdgeColor()const
 	{
-		fprintf(mFile,"\"%s.vrec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrec\"");
 	}
 	void getVrEdgeColorR()const
 	{
-		fprintf(mFile,"\"%s.vrec.vecr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrec.vecr\"");
 	}
 	void getVrEdgeColorG()const
 	{
-		fprintf(mFile,"\"%s.vrec.vecg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrec.vecg\"");
 	}
 	void getVrEdgeColorB()const
 	{
-		fprintf(mFile,"\"%s.vrec.vecb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrec.vecb\"");
 	}
 	void getVrEdgeStyle()const
 	{
-		fprintf(mFile,"\"%s.vres\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vres\"");
 	}
 	void getVrEdgePriority()const
 	{
-		fprintf(mFile,"\"%s.vrep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrep\"");
 	}
 	void getVrHiddenEdges()const
 	{
-		fprintf(mFile,"\"%s.vrhe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrhe\"");
 	}
 	void getVrHiddenEdgesOnTransparent()const
 	{
-		fprintf(mFile,"\"%s.vrht\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vrht\"");
 	}
 	void getVrOutlinesAtIntersections()const
 	{
-		fprintf(mFile,"\"%s.vroi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vroi\"");
 	}
 	void getMaterialAlphaGain()const
 	{
-		fprintf(mFile,"\"%s.maga\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".maga\"");
 	}
 	void getHideSource()const
 	{
-		fprintf(mFile,"\"%s.hs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hs\"");
 	}
 	void getSurfaceThickness()const
 	{
-		fprintf(mFile,"\"%s.thik\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".thik\"");
 	}
 	void getShadowAttenuation()const
 	{
-		fprintf(mFile,"\"%s.fakc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fakc\"");
 	}
 	void getTransparencyDepth()const
 	{
-		fprintf(mFile,"\"%s.trdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trdp\"");
 	}
 	void getLightAbsorbance()const
 	{
-		fprintf(mFile,"\"%s.absb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".absb\"");
 	}
 	void getChromaticAberration()const
 	{
-		fprintf(mFile,"\"%s.crab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crab\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogb\"");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.pc.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.pc.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.pc.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pz\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getLightDataArray(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i]\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"]\"");
 	}
 	void getLightDataArray()const
 	{
 
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld\"");
 	}
 	void getLightDirection()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldx\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldx\"");
 	}
 	void getLightDirectionX()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldy\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldy\"");
 	}
 	void getLightDirectionY()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldz\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldz\"");
 	}
 	void getLightDirectionZ()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li\"");
 	}
 	void getLightIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lir\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lir\"");
 	}
 	void getLightIntensityR()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lig\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lig\"");
 	}
 	void getLightIntensityG()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lib\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lib\"");
 	}
 	void getLightIntensityB()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].la\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].la\"");
 	}
 	void getLightAmbient()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ldf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ldf\"");
 	}
 	void getLightDiffuse()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ls\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ls\"");
 	}
 	void getLightSpecular()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lsf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lsf\"");
 	}
 	void getLightShadowFraction()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].psi\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].psi\"");
 	}
 	void getPreShadowIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lbd\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lbd\"");
 	}
 	void getLightBlindData()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbd\"");
 	}
 	void getMatteOpacityMode()const
 	{
-		fprintf(mFile,"\"%s.mom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mom\"");
 	}
 	void getMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.mog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mog\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getHardwareShader()const
 	{
-		fprintf(mFile,"\"%s.hws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws\"");
 	}
 	void getHardwareShaderR()const
 	{
-		fprintf(mFile,"\"%s.hws.hwr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwr\"");
 	}
 	void getHardwareShaderG()const
 	{
-		fprintf(mFile,"\"%s.hws.hwg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwg\"");
 	}
 	void getHardwareShaderB()const
 	{
-		fprintf(mFile,"\"%s.hws.hwb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwb\"");
 	}
 	void getMiRefractionBlur()const
 	{
-		fprintf(mFile,"\"%s.mirfb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirfb\"");
 	}
 	void getMiRefractionRays()const
 	{
-		fprintf(mFile,"\"%s.mirfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirfr\"");
 	}
 	void getMiIrradiance()const
 	{
-		fprintf(mFile,"\"%s.mii\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii\"");
 	}
 	void getMiIrradianceR()const
 	{
-		fprintf(mFile,"\"%s.mii.miir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miir\"");
 	}
 	void getMiIrradianceG()const
 	{
-		fprintf(mFile,"\"%s.mii.miig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miig\"");
 	}
 	void getMiIrradianceB()const
 	{
-		fprintf(mFile,"\"%s.mii.miib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miib\"");
 	}
 	void getMiIrradianceColor()const
 	{
-		fprintf(mFile,"\"%s.miic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic\"");
 	}
 	void getMiIrradianceColorR()const
 	{
-		fprintf(mFile,"\"%s.miic.miicr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicr\"");
 	}
 	void getMiIrradianceColorG()const
 	{
-		fprintf(mFile,"\"%s.miic.miicg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicg\"");
 	}
 	void getMiIrradianceColorB()const
 	{
-		fprintf(mFile,"\"%s.miic.miicb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicb\"");
 	}
 	void getMiDeriveFromMaya()const
 	{
-		fprintf(mFile,"\"%s.mifm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifm\"");
 	}
 	void getMiRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.miri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miri\"");
 	}
 	void getMiRefractions()const
 	{
-		fprintf(mFile,"\"%s.mirc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirc\"");
 	}
 	void getMiAbsorbs()const
 	{
-		fprintf(mFile,"\"%s.miab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miab\"");
 	}
 	void getMiDiffuse()const
 	{
-		fprintf(mFile,"\"%s.midc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".midc\"");
 	}
 	void getMiColor()const
 	{
-		fprintf(mFile,"\"%s.mic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic\"");
 	}
 	void getMiColorR()const
 	{
-		fprintf(mFile,"\"%s.mic.micr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micr\"");
 	}
 	void getMiColorG()const
 	{
-		fprintf(mFile,"\"%s.mic.micg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micg\"");
 	}
 	void getMiColorB()const
 	{
-		fprintf(mFile,"\"%s.mic.micb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micb\"");
 	}
 	void getMiTransparency()const
 	{
-		fprintf(mFile,"\"%s.mit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit\"");
 	}
 	void getMiTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.mit.mitr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitr\"");
 	}
 	void getMiTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.mit.mitg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitg\"");
 	}
 	void getMiTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.mit.mitb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitb\"");
 	}
 	void getMiTranslucence()const
 	{
-		fprintf(mFile,"\"%s.mitc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitc\"");
 	}
 	void getMiTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.mitf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitf\"");
 	}
 	void getMiNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.minc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc\"");
 	}
 	void getMiNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.minc.mincx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincx\"");
 	}
 	void getMiNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.minc.mincy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincy\"");
 	}
 	void getMiNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincz\"");
 	}
 protected:
 	Lambert(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,107 +27,107 @@ public:
 	void setSDivisions(short sd)
 	{
 		if(sd == 2) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %i;\n", sd);
+		writeInt(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void setTDivisions(short td)
 	{
 		if(td == 5) return;
-		fprintf(mFile,"\tsetAttr \".td\" %i;\n", td);
+		writeInt(mFile,"\tsetAttr \".td\" ",td,";\n");
 	}
 	void setUDivisions(short ud)
 	{
 		if(ud == 2) return;
-		fprintf(mFile,"\tsetAttr \".ud\" %i;\n", ud);
+		writeInt(mFile,"\tsetAttr \".ud\" ",ud,";\n");
 	}
 	void setCached(const lattice& cc)
 	{
-		fprintf(mFile,"\tsetAttr \".cc\" -type \"lattice\" ");
+		writeString(mFile,"\tsetAttr \".cc\" -type \"lattice\" ");
 		cc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDispPoints(bool dcv)
 	{
 		if(dcv == off) return;
-		fprintf(mFile,"\tsetAttr \".dcv\" %i;\n", dcv);
+		writeInt(mFile,"\tsetAttr \".dcv\" ",dcv,";\n");
 	}
 	void setDispLattice(bool dep)
 	{
 		if(dep == on) return;
-		fprintf(mFile,"\tsetAttr \".dep\" %i;\n", dep);
+		writeInt(mFile,"\tsetAttr \".dep\" ",dep,";\n");
 	}
 	void setOrigin(const double3& _or)
 	{
-		fprintf(mFile,"\tsetAttr \".or\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".or\" -type \"double3\" ");
 		_or.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOriginX(double ox)
 	{
 		if(ox == 0) return;
-		fprintf(mFile,"\tsetAttr \".or.ox\" %f;\n", ox);
+		writeFloat(mFile,"\tsetAttr \".or.ox\" ",ox,";\n");
 	}
 	void setOriginY(double oy)
 	{
 		if(oy == 0) return;
-		fprintf(mFile,"\tsetAttr \".or.oy\" %f;\n", oy);
+		writeFloat(mFile,"\tsetAttr \".or.oy\" ",oy,";\n");
 	}
 	void setOriginZ(double oz)
 	{
 		if(oz == 0) return;
-		fprintf(mFile,"\tsetAttr \".or.oz\" %f;\n", oz);
+		writeFloat(mFile,"\tsetAttr \".or.oz\" ",oz,";\n");
 	}
 	void getLatticeOutput()const
 	{
-		fprintf(mFile,"\"%s.lo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lo\"");
 	}
 	void getWorldLattice(size_t wl_i)const
 	{
-		fprintf(mFile,"\"%s.wl[%i]\"",mName.c_str(),wl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wl[",wl_i,"]\"");
 	}
 	void getWorldLattice()const
 	{
 
-		fprintf(mFile,"\"%s.wl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wl\"");
 	}
 	void getLatticeInput()const
 	{
-		fprintf(mFile,"\"%s.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".li\"");
 	}
 	void getCached()const
 	{
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 	void getLatticePointMoved()const
 	{
-		fprintf(mFile,"\"%s.lpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lpm\"");
 	}
 	void getDisplayControl()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getDispPoints()const
 	{
-		fprintf(mFile,"\"%s.dcv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcv\"");
 	}
 	void getDispLattice()const
 	{
-		fprintf(mFile,"\"%s.dep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dep\"");
 	}
 	void getOrigin()const
 	{
-		fprintf(mFile,"\"%s.or\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or\"");
 	}
 	void getOriginX()const
 	{
-		fprintf(mFile,"\"%s.or.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.ox\"");
 	}
 	void getOriginY()const
 	{
-		fprintf(mFile,"\"%s.or.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.oy\"");
 	}
 	void getOriginZ()const
 	{
-		fprintf(mFile,"\"%s.or.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.oz\"");
 	}
 protected:
 	Lattice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
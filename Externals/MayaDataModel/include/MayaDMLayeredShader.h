@@ -24,9 +24,9 @@ public:
 		void write(FILE* file) const
 		{
 			color.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			transparency.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			glowColor.write(file);
 		}
 	};
@@ -40,634 +40,634 @@ public:
 	void setCompositingFlag(unsigned int cf)
 	{
 		if(cf == 0) return;
-		fprintf(mFile,"\tsetAttr \".cf\" %i;\n", cf);
+		writeInt(mFile,"\tsetAttr \".cf\" ",cf,";\n");
 	}
 	void setInputs(size_t cs_i,const Inputs& cs)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i]\" ",cs_i);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i,"]\" ");
 		cs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputs(size_t cs_start,size_t cs_end,Inputs* cs)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i:%i]\" ", cs_start,cs_end);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_start); writeInt(mFile,":",cs_end,"]\" ");
 		size_t size = (cs_end-cs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cs[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputs(size_t cs_start,size_t cs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i:%i]\"",cs_start,cs_end);
-		fprintf(mFile," -type \"Inputs\" ");
+		writeInt(mFile,"\tsetAttr \".cs[",cs_start); writeInt(mFile,":",cs_end,"]\"");
+		writeString(mFile," -type \"Inputs\" ");
 	}
 	void appendInputs(const Inputs& cs)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cs.write(mFile);
 	}
 	void endInputs()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor(size_t cs_i,const float3& c)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i].c\" -type \"float3\" ",cs_i);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i,"].c\" -type \"float3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(size_t cs_i,float cr)
 	{
 		if(cr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].c.cr\" %f;\n", cs_i,cr);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].c.cr\" ",cr,";\n");
 	}
 	void setColorG(size_t cs_i,float cg)
 	{
 		if(cg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].c.cg\" %f;\n", cs_i,cg);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].c.cg\" ",cg,";\n");
 	}
 	void setColorB(size_t cs_i,float cb)
 	{
 		if(cb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].c.cb\" %f;\n", cs_i,cb);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].c.cb\" ",cb,";\n");
 	}
 	void setTransparency(size_t cs_i,const float3& t)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i].t\" -type \"float3\" ",cs_i);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i,"].t\" -type \"float3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparencyR(size_t cs_i,float tr)
 	{
 		if(tr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].t.tr\" %f;\n", cs_i,tr);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].t.tr\" ",tr,";\n");
 	}
 	void setTransparencyG(size_t cs_i,float tg)
 	{
 		if(tg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].t.tg\" %f;\n", cs_i,tg);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].t.tg\" ",tg,";\n");
 	}
 	void setTransparencyB(size_t cs_i,float tb)
 	{
 		if(tb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].t.tb\" %f;\n", cs_i,tb);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].t.tb\" ",tb,";\n");
 	}
 	void setGlowColor(size_t cs_i,const float3& g)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i].g\" -type \"float3\" ",cs_i);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i,"].g\" -type \"float3\" ");
 		g.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlowColorR(size_t cs_i,float gr)
 	{
 		if(gr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].g.gr\" %f;\n", cs_i,gr);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].g.gr\" ",gr,";\n");
 	}
 	void setGlowColorG(size_t cs_i,float gg)
 	{
 		if(gg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].g.gg\" %f;\n", cs_i,gg);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].g.gg\" ",gg,";\n");
 	}
 	void setGlowColorB(size_t cs_i,float gb)
 	{
 		if(gb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].g.gb\" %f;\n", cs_i,gb);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].g.gb\" ",gb,";\n");
 	}
 	void setHardwareColor(const float3& hc)
 	{
-		fprintf(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
 		hc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHardwareColorR(float hcr)
 	{
 		if(hcr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcr\" %f;\n", hcr);
+		writeFloat(mFile,"\tsetAttr \".hc.hcr\" ",hcr,";\n");
 	}
 	void setHardwareColorG(float hcg)
 	{
 		if(hcg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcg\" %f;\n", hcg);
+		writeFloat(mFile,"\tsetAttr \".hc.hcg\" ",hcg,";\n");
 	}
 	void setHardwareColorB(float hcb)
 	{
 		if(hcb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcb\" %f;\n", hcb);
+		writeFloat(mFile,"\tsetAttr \".hc.hcb\" ",hcb,";\n");
 	}
 	void setMatteOpacityMode(unsigned int mom)
 	{
 		if(mom == 2) return;
-		fprintf(mFile,"\tsetAttr \".mom\" %i;\n", mom);
+		writeInt(mFile,"\tsetAttr \".mom\" ",mom,";\n");
 	}
 	void setMatteOpacity(float mog)
 	{
 		if(mog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mog\" %f;\n", mog);
+		writeFloat(mFile,"\tsetAttr \".mog\" ",mog,";\n");
 	}
 	void setMiDeriveFromMaya(bool mifm)
 	{
 		if(mifm == true) return;
-		fprintf(mFile,"\tsetAttr \".mifm\" %i;\n", mifm);
+		writeInt(mFile,"\tsetAttr \".mifm\" ",mifm,";\n");
 	}
 	void setMiShinyness(float mis)
 	{
 		if(mis == 10) return;
-		fprintf(mFile,"\tsetAttr \".mis\" %f;\n", mis);
+		writeFloat(mFile,"\tsetAttr \".mis\" ",mis,";\n");
 	}
 	void setMiAngle(float mia)
 	{
 		if(mia == 0) return;
-		fprintf(mFile,"\tsetAttr \".mia\" %f;\n", mia);
+		writeFloat(mFile,"\tsetAttr \".mia\" ",mia,";\n");
 	}
 	void setMiSpreadX(float misx)
 	{
 		if(misx == 10) return;
-		fprintf(mFile,"\tsetAttr \".misx\" %f;\n", misx);
+		writeFloat(mFile,"\tsetAttr \".misx\" ",misx,";\n");
 	}
 	void setMiSpreadY(float misy)
 	{
 		if(misy == 5) return;
-		fprintf(mFile,"\tsetAttr \".misy\" %f;\n", misy);
+		writeFloat(mFile,"\tsetAttr \".misy\" ",misy,";\n");
 	}
 	void setMiWhiteness(const float3& miwn)
 	{
-		fprintf(mFile,"\tsetAttr \".miwn\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".miwn\" -type \"float3\" ");
 		miwn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiWhitenessR(float miwnr)
 	{
 		if(miwnr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwnr\" %f;\n", miwnr);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwnr\" ",miwnr,";\n");
 	}
 	void setMiWhitenessG(float miwng)
 	{
 		if(miwng == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwng\" %f;\n", miwng);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwng\" ",miwng,";\n");
 	}
 	void setMiWhitenessB(float miwnb)
 	{
 		if(miwnb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwnb\" %f;\n", miwnb);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwnb\" ",miwnb,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void setMiRefractiveIndex(float miri)
 	{
 		if(miri == 1) return;
-		fprintf(mFile,"\tsetAttr \".miri\" %f;\n", miri);
+		writeFloat(mFile,"\tsetAttr \".miri\" ",miri,";\n");
 	}
 	void setMiRefractions(bool mirc)
 	{
 		if(mirc == true) return;
-		fprintf(mFile,"\tsetAttr \".mirc\" %i;\n", mirc);
+		writeInt(mFile,"\tsetAttr \".mirc\" ",mirc,";\n");
 	}
 	void setMiAbsorbs(bool miab)
 	{
 		if(miab == true) return;
-		fprintf(mFile,"\tsetAttr \".miab\" %i;\n", miab);
+		writeInt(mFile,"\tsetAttr \".miab\" ",miab,";\n");
 	}
 	void setMiDiffuse(float midc)
 	{
 		if(midc == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".midc\" %f;\n", midc);
+		writeFloat(mFile,"\tsetAttr \".midc\" ",midc,";\n");
 	}
 	void setMiColor(const float3& mic)
 	{
-		fprintf(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
 		mic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiColorR(float micr)
 	{
 		if(micr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micr\" %f;\n", micr);
+		writeFloat(mFile,"\tsetAttr \".mic.micr\" ",micr,";\n");
 	}
 	void setMiColorG(float micg)
 	{
 		if(micg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micg\" %f;\n", micg);
+		writeFloat(mFile,"\tsetAttr \".mic.micg\" ",micg,";\n");
 	}
 	void setMiColorB(float micb)
 	{
 		if(micb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micb\" %f;\n", micb);
+		writeFloat(mFile,"\tsetAttr \".mic.micb\" ",micb,";\n");
 	}
 	void setMiTransparency(const float3& mit)
 	{
-		fprintf(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
 		mit.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiTransparencyR(float mitr)
 	{
 		if(mitr == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitr\" %f;\n", mitr);
+		writeFloat(mFile,"\tsetAttr \".mit.mitr\" ",mitr,";\n");
 	}
 	void setMiTransparencyG(float mitg)
 	{
 		if(mitg == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitg\" %f;\n", mitg);
+		writeFloat(mFile,"\tsetAttr \".mit.mitg\" ",mitg,";\n");
 	}
 	void setMiTransparencyB(float mitb)
 	{
 		if(mitb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitb\" %f;\n", mitb);
+		writeFloat(mFile,"\tsetAttr \".mit.mitb\" ",mitb,";\n");
 	}
 	void setMiTranslucence(float mitc)
 	{
 		if(mitc == 0) return;
-		fprintf(mFile,"\tsetAttr \".mitc\" %f;\n", mitc);
+		writeFloat(mFile,"\tsetAttr \".mitc\" ",mitc,";\n");
 	}
 	void setMiTranslucenceFocus(float mitf)
 	{
 		if(mitf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mitf\" %f;\n", mitf);
+		writeFloat(mFile,"\tsetAttr \".mitf\" ",mitf,";\n");
 	}
 	void setMiNormalCamera(const float3& minc)
 	{
-		fprintf(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
 		minc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiNormalCameraX(float mincx)
 	{
 		if(mincx == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincx\" %f;\n", mincx);
+		writeFloat(mFile,"\tsetAttr \".minc.mincx\" ",mincx,";\n");
 	}
 	void setMiNormalCameraY(float mincy)
 	{
 		if(mincy == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincy\" %f;\n", mincy);
+		writeFloat(mFile,"\tsetAttr \".minc.mincy\" ",mincy,";\n");
 	}
 	void setMiNormalCameraZ(float mincz)
 	{
 		if(mincz == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincz\" %f;\n", mincz);
+		writeFloat(mFile,"\tsetAttr \".minc.mincz\" ",mincz,";\n");
 	}
 	void getCompositingFlag()const
 	{
-		fprintf(mFile,"\"%s.cf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cf\"");
 	}
 	void getInputs(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i]\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"]\"");
 	}
 	void getInputs()const
 	{
 
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getColor(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].c\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].c\"");
 	}
 	void getColor()const
 	{
 
-		fprintf(mFile,"\"%s.cs.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.c\"");
 	}
 	void getColorR(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].c.cr\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].c.cr\"");
 	}
 	void getColorR()const
 	{
 
-		fprintf(mFile,"\"%s.cs.c.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.c.cr\"");
 	}
 	void getColorG(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].c.cg\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].c.cg\"");
 	}
 	void getColorG()const
 	{
 
-		fprintf(mFile,"\"%s.cs.c.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.c.cg\"");
 	}
 	void getColorB(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].c.cb\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].c.cb\"");
 	}
 	void getColorB()const
 	{
 
-		fprintf(mFile,"\"%s.cs.c.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.c.cb\"");
 	}
 	void getTransparency(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].t\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].t\"");
 	}
 	void getTransparency()const
 	{
 
-		fprintf(mFile,"\"%s.cs.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.t\"");
 	}
 	void getTransparencyR(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].t.tr\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].t.tr\"");
 	}
 	void getTransparencyR()const
 	{
 
-		fprintf(mFile,"\"%s.cs.t.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.t.tr\"");
 	}
 	void getTransparencyG(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].t.tg\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].t.tg\"");
 	}
 	void getTransparencyG()const
 	{
 
-		fprintf(mFile,"\"%s.cs.t.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.t.tg\"");
 	}
 	void getTransparencyB(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].t.tb\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].t.tb\"");
 	}
 	void getTransparencyB()const
 	{
 
-		fprintf(mFile,"\"%s.cs.t.tb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.t.tb\"");
 	}
 	void getGlowColor(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].g\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].g\"");
 	}
 	void getGlowColor()const
 	{
 
-		fprintf(mFile,"\"%s.cs.g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.g\"");
 	}
 	void getGlowColorR(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].g.gr\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].g.gr\"");
 	}
 	void getGlowColorR()const
 	{
 
-		fprintf(mFile,"\"%s.cs.g.gr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.g.gr\"");
 	}
 	void getGlowColorG(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].g.gg\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].g.gg\"");
 	}
 	void getGlowColorG()const
 	{
 
-		fprintf(mFile,"\"%s.cs.g.gg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.g.gg\"");
 	}
 	void getGlowColorB(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].g.gb\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].g.gb\"");
 	}
 	void getGlowColorB()const
 	{
 
-		fprintf(mFile,"\"%s.cs.g.gb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.g.gb\"");
 	}
 	void getHardwareShader()const
 	{
-		fprintf(mFile,"\"%s.hws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws\"");
 	}
 	void getHardwareShaderR()const
 	{
-		fprintf(mFile,"\"%s.hws.hwr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwr\"");
 	}
 	void getHardwareShaderG()const
 	{
-		fprintf(mFile,"\"%s.hws.hwg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwg\"");
 	}
 	void getHardwareShaderB()const
 	{
-		fprintf(mFile,"\"%s.hws.hwb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hws.hwb\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogb\"");
 	}
 	void getMatteOpacityMode()const
 	{
-		fprintf(mFile,"\"%s.mom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mom\"");
 	}
 	void getMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.mog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mog\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getMiDeriveFromMaya()const
 	{
-		fprintf(mFile,"\"%s.mifm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifm\"");
 	}
 	void getMiShinyness()const
 	{
-		fprintf(mFile,"\"%s.mis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mis\"");
 	}
 	void getMiAngle()const
 	{
-		fprintf(mFile,"\"%s.mia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mia\"");
 	}
 	void getMiSpreadX()const
 	{
-		fprintf(mFile,"\"%s.misx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misx\"");
 	}
 	void getMiSpreadY()const
 	{
-		fprintf(mFile,"\"%s.misy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misy\"");
 	}
 	void getMiWhiteness()const
 	{
-		fprintf(mFile,"\"%s.miwn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn\"");
 	}
 	void getMiWhitenessR()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwnr\"");
 	}
 	void getMiWhitenessG()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwng\"");
 	}
 	void getMiWhitenessB()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwnb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwnb\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 	void getMiRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.miri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miri\"");
 	}
 	void getMiRefractions()const
 	{
-		fprintf(mFile,"\"%s.mirc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirc\"");
 	}
 	void getMiAbsorbs()const
 	{
-		fprintf(mFile,"\"%s.miab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miab\"");
 	}
 	void getMiDiffuse()const
 	{
-		fprintf(mFile,"\"%s.midc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".midc\"");
 	}
 	void getMiColor()const
 	{
-		fprintf(mFile,"\"%s.mic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic\"");
 	}
 	void getMiColorR()const
 	{
-		fprintf(mFile,"\"%s.mic.micr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micr\"");
 	}
 	void getMiColorG()const
 	{
-		fprintf(mFile,"\"%s.mic.micg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micg\"");
 	}
 	void getMiColorB()const
 	{
-		fprintf(mFile,"\"%s.mic.micb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micb\"");
 	}
 	void getMiTransparency()const
 	{
-		fprintf(mFile,"\"%s.mit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit\"");
 	}
 	void getMiTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.mit.mitr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitr\"");
 	}
 	void getMiTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.mit.mitg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitg\"");
 	}
 	void getMiTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.mit.mitb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitb\"");
 	}
 	void getMiTranslucence()const
 	{
-		fprintf(mFile,"\"%s.mitc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitc\"");
 	}
 	void getMiTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.mitf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitf\"");
 	}
 	void getMiNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.minc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc\"");
 	}
 	void getMiNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.minc.mincx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincx\"");
 	}
 	void getMiNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.minc.mincy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincy\"");
 	}
 	void getMiNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincz\"");
 	}
 protected:
 	LayeredShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -25,10 +25,10 @@ public:
 		void write(FILE* file) const
 		{
 			color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", alpha);
-			fprintf(file,"%i ", blendMode);
-			fprintf(file,"%i", isVisible);
+			writeString(file," ");
+			writeFloat(file,"",alpha," ");
+			writeInt(file,"",blendMode," ");
+			writeInt(file,"",isVisible);
 		}
 	};
 public:
@@ -40,208 +40,208 @@ public:
 
 	void setInputs(size_t cs_i,const Inputs& cs)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i]\" ",cs_i);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i,"]\" ");
 		cs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputs(size_t cs_start,size_t cs_end,Inputs* cs)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i:%i]\" ", cs_start,cs_end);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_start); writeInt(mFile,":",cs_end,"]\" ");
 		size_t size = (cs_end-cs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cs[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputs(size_t cs_start,size_t cs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i:%i]\"",cs_start,cs_end);
-		fprintf(mFile," -type \"Inputs\" ");
+		writeInt(mFile,"\tsetAttr \".cs[",cs_start); writeInt(mFile,":",cs_end,"]\"");
+		writeString(mFile," -type \"Inputs\" ");
 	}
 	void appendInputs(const Inputs& cs)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cs.write(mFile);
 	}
 	void endInputs()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor(size_t cs_i,const float3& c)
 	{
-		fprintf(mFile,"\tsetAttr \".cs[%i].c\" -type \"float3\" ",cs_i);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i,"].c\" -type \"float3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(size_t cs_i,float cr)
 	{
 		if(cr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].c.cr\" %f;\n", cs_i,cr);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].c.cr\" ",cr,";\n");
 	}
 	void setColorG(size_t cs_i,float cg)
 	{
 		if(cg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].c.cg\" %f;\n", cs_i,cg);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].c.cg\" ",cg,";\n");
 	}
 	void setColorB(size_t cs_i,float cb)
 	{
 		if(cb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].c.cb\" %f;\n", cs_i,cb);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].c.cb\" ",cb,";\n");
 	}
 	void setAlpha(size_t cs_i,float a)
 	{
 		if(a == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].a\" %f;\n", cs_i,a);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeFloat(mFile,"].a\" ",a,";\n");
 	}
 	void setBlendMode(size_t cs_i,unsigned int bm)
 	{
 		if(bm == 1) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].bm\" %i;\n", cs_i,bm);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeInt(mFile,"].bm\" ",bm,";\n");
 	}
 	void setIsVisible(size_t cs_i,bool iv)
 	{
 		if(iv == true) return;
-		fprintf(mFile,"\tsetAttr \".cs[%i].iv\" %i;\n", cs_i,iv);
+		writeInt(mFile,"\tsetAttr \".cs[",cs_i); writeInt(mFile,"].iv\" ",iv,";\n");
 	}
 	void setHardwareColor(const float3& hc)
 	{
-		fprintf(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
 		hc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHardwareColorR(float hcr)
 	{
 		if(hcr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcr\" %f;\n", hcr);
+		writeFloat(mFile,"\tsetAttr \".hc.hcr\" ",hcr,";\n");
 	}
 	void setHardwareColorG(float hcg)
 	{
 		if(hcg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcg\" %f;\n", hcg);
+		writeFloat(mFile,"\tsetAttr \".hc.hcg\" ",hcg,";\n");
 	}
 	void setHardwareColorB(float hcb)
 	{
 		if(hcb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hc.hcb\" %f;\n", hcb);
+		writeFloat(mFile,"\tsetAttr \".hc.hcb\" ",hcb,";\n");
 	}
 	void setAlphaIsLuminance(bool ail)
 	{
 		if(ail == false) return;
-		fprintf(mFile,"\tsetAttr \".ail\" %i;\n", ail);
+		writeInt(mFile,"\tsetAttr \".ail\" ",ail,";\n");
 	}
 	void getInputs(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i]\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"]\"");
 	}
 	void getInputs()const
 	{
 
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getColor(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].c\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].c\"");
 	}
 	void getColor()const
 	{
 
-		fprintf(mFile,"\"%s.cs.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.c\"");
 	}
 	void getColorR(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].c.cr\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].c.cr\"");
 	}
 	void getColorR()const
 	{
 
-		fprintf(mFile,"\"%s.cs.c.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.c.cr\"");
 	}
 	void getColorG(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].c.cg\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].c.cg\"");
 	}
 	void getColorG()const
 	{
 
-		fprintf(mFile,"\"%s.cs.c.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.c.cg\"");
 	}
 	void getColorB(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].c.cb\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].c.cb\"");
 	}
 	void getColorB()const
 	{
 
-		fprintf(mFile,"\"%s.cs.c.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.c.cb\"");
 	}
 	void getAlpha(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].a\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].a\"");
 	}
 	void getAlpha()const
 	{
 
-		fprintf(mFile,"\"%s.cs.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.a\"");
 	}
 	void getBlendMode(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].bm\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].bm\"");
 	}
 	void getBlendMode()const
 	{
 
-		fprintf(mFile,"\"%s.cs.bm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.bm\"");
 	}
 	void getIsVisible(size_t cs_i)const
 	{
-		fprintf(mFile,"\"%s.cs[%i].iv\"",mName.c_str(),cs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cs[",cs_i,"].iv\"");
 	}
 	void getIsVisible()const
 	{
 
-		fprintf(mFile,"\"%s.cs.iv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.iv\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutAlpha()const
 	{
-		fprintf(mFile,"\"%s.oa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oa\"");
 	}
 	void getAlphaIsLuminance()const
 	{
-		fprintf(mFile,"\"%s.ail\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ail\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 protected:
 	LayeredTexture(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,22 +26,22 @@ public:
 			void write(FILE* file) const
 			{
 				pointPositionXYZ.write(file);
-				fprintf(file, " ");
+				writeString(file," ");
 				pointConstraintUVW.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f", pointWeight);
+				writeString(file," ");
+				writeFloat(file,"",pointWeight);
 			}
 		}* pointConstraint;
 		size_t nbPointConstraint;
 		void write(FILE* file) const
 		{
 			worldSpaceToObjectSpace.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			for (size_t i = 0; i<nbPointConstraint; ++i)
 			{
 				pointConstraint[i].write(file);
-				fprintf(file, " ");
-				if (i + 1<nbPointConstraint) fprintf(file, " ");
+				writeString(file," ");
+				if (i + 1<nbPointConstraint) writeString(file," ");
 			}
 		}
 	};
@@ -56,142 +56,142 @@ public:
 
 	void setAttributeCollection(const AttributeCollection& ac)
 	{
-		fprintf(mFile,"\tsetAttr \".ac\" ");
+		writeString(mFile,"\tsetAttr \".ac\" ");
 		ac.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWorldSpaceToObjectSpace(const matrix& wto)
 	{
 		if(wto == identity) return;
-		fprintf(mFile,"\tsetAttr \".ac.wto\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".ac.wto\" -type \"matrix\" ");
 		wto.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointConstraint(size_t pc_i,const AttributeCollection::PointConstraint& pc)
 	{
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i]\" ",pc_i);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i,"]\" ");
 		pc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointConstraint(size_t pc_start,size_t pc_end,AttributeCollection::PointConstraint* pc)
 	{
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i:%i]\" ", pc_start,pc_end);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_start); writeInt(mFile,":",pc_end,"]\" ");
 		size_t size = (pc_end-pc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			pc[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPointConstraint(size_t pc_start,size_t pc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i:%i]\"",pc_start,pc_end);
-		fprintf(mFile," -type \"AttributeCollection::PointConstraint\" ");
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_start); writeInt(mFile,":",pc_end,"]\"");
+		writeString(mFile," -type \"AttributeCollection::PointConstraint\" ");
 	}
 	void appendPointConstraint(const AttributeCollection::PointConstraint& pc)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		pc.write(mFile);
 	}
 	void endPointConstraint()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointPositionXYZ(size_t pc_i,const double3& xyz)
 	{
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].xyz\" -type \"double3\" ",pc_i);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i,"].xyz\" -type \"double3\" ");
 		xyz.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointPositionX(size_t pc_i,double ppx)
 	{
 		if(ppx == 1) return;
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].xyz.ppx\" %f;\n", pc_i,ppx);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i); writeFloat(mFile,"].xyz.ppx\" ",ppx,";\n");
 	}
 	void setPointPositionY(size_t pc_i,double ppy)
 	{
 		if(ppy == 1) return;
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].xyz.ppy\" %f;\n", pc_i,ppy);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i); writeFloat(mFile,"].xyz.ppy\" ",ppy,";\n");
 	}
 	void setPointPositionZ(size_t pc_i,double ppz)
 	{
 		if(ppz == 1) return;
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].xyz.ppz\" %f;\n", pc_i,ppz);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i); writeFloat(mFile,"].xyz.ppz\" ",ppz,";\n");
 	}
 	void setPointConstraintUVW(size_t pc_i,const double3& puv)
 	{
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].puv\" -type \"double3\" ",pc_i);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i,"].puv\" -type \"double3\" ");
 		puv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointConstraintU(size_t pc_i,double pcu)
 	{
 		if(pcu == -100000.0) return;
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].puv.pcu\" %f;\n", pc_i,pcu);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i); writeFloat(mFile,"].puv.pcu\" ",pcu,";\n");
 	}
 	void setPointConstraintV(size_t pc_i,double pcv)
 	{
 		if(pcv == -100000.0) return;
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].puv.pcv\" %f;\n", pc_i,pcv);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i); writeFloat(mFile,"].puv.pcv\" ",pcv,";\n");
 	}
 	void setPointConstraintW(size_t pc_i,double pcw)
 	{
 		if(pcw == -100000.0) return;
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].puv.pcw\" %f;\n", pc_i,pcw);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i); writeFloat(mFile,"].puv.pcw\" ",pcw,";\n");
 	}
 	void setPointWeight(size_t pc_i,double pw)
 	{
 		if(pw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ac.pc[%i].pw\" %f;\n", pc_i,pw);
+		writeInt(mFile,"\tsetAttr \".ac.pc[",pc_i); writeFloat(mFile,"].pw\" ",pw,";\n");
 	}
 	void getInputNurbsObject()const
 	{
-		fprintf(mFile,"\"%s.ac.ino\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.ino\"");
 	}
 	void getWorldSpaceToObjectSpace()const
 	{
-		fprintf(mFile,"\"%s.ac.wto\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.wto\"");
 	}
 	void getPointPositionXYZ(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].xyz\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].xyz\"");
 	}
 	void getPointPositionX(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].xyz.ppx\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].xyz.ppx\"");
 	}
 	void getPointPositionY(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].xyz.ppy\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].xyz.ppy\"");
 	}
 	void getPointPositionZ(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].xyz.ppz\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].xyz.ppz\"");
 	}
 	void getPointConstraintUVW(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].puv\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].puv\"");
 	}
 	void getPointConstraintU(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].puv.pcu\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].puv.pcu\"");
 	}
 	void getPointConstraintV(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].puv.pcv\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].puv.pcv\"");
 	}
 	void getPointConstraintW(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].puv.pcw\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].puv.pcw\"");
 	}
 	void getPointWeight(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.ac.pc[%i].pw\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ac.pc[",pc_i,"].pw\"");
 	}
 	void getOutputNurbsObject()const
 	{
-		fprintf(mFile,"\"%s.ac.ono\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.ono\"");
 	}
 protected:
 	LeastSquaresModifier(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
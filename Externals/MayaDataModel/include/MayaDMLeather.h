@@ -27,164 +27,164 @@ public:
 	void setCellColor(const float3& ce)
 	{
 		if(ce == float3(0.373f,0.157f,0.059f)) return;
-		fprintf(mFile,"\tsetAttr \".ce\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ce\" -type \"float3\" ");
 		ce.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCellColorR(float cer)
 	{
 		if(cer == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ce.cer\" %f;\n", cer);
+		writeFloat(mFile,"\tsetAttr \".ce.cer\" ",cer,";\n");
 	}
 	void setCellColorG(float ceg)
 	{
 		if(ceg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ce.ceg\" %f;\n", ceg);
+		writeFloat(mFile,"\tsetAttr \".ce.ceg\" ",ceg,";\n");
 	}
 	void setCellColorB(float ceb)
 	{
 		if(ceb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ce.ceb\" %f;\n", ceb);
+		writeFloat(mFile,"\tsetAttr \".ce.ceb\" ",ceb,";\n");
 	}
 	void setCreaseColor(const float3& cr)
 	{
 		if(cr == float3(0.235f,0.118f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".cr\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cr\" -type \"float3\" ");
 		cr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCreaseColorR(float crr)
 	{
 		if(crr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cr.crr\" %f;\n", crr);
+		writeFloat(mFile,"\tsetAttr \".cr.crr\" ",crr,";\n");
 	}
 	void setCreaseColorG(float crg)
 	{
 		if(crg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cr.crg\" %f;\n", crg);
+		writeFloat(mFile,"\tsetAttr \".cr.crg\" ",crg,";\n");
 	}
 	void setCreaseColorB(float crb)
 	{
 		if(crb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cr.crb\" %f;\n", crb);
+		writeFloat(mFile,"\tsetAttr \".cr.crb\" ",crb,";\n");
 	}
 	void setCellSize(float cs)
 	{
 		if(cs == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".cs\" %f;\n", cs);
+		writeFloat(mFile,"\tsetAttr \".cs\" ",cs,";\n");
 	}
 	void setDensity(float d)
 	{
 		if(d == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSpottyness(float s)
 	{
 		if(s == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setRandomness(float r)
 	{
 		if(r == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.83) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void setCreases(bool c)
 	{
 		if(c == true) return;
-		fprintf(mFile,"\tsetAttr \".c\" %i;\n", c);
+		writeInt(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getCellColor()const
 	{
-		fprintf(mFile,"\"%s.ce\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ce\"");
 	}
 	void getCellColorR()const
 	{
-		fprintf(mFile,"\"%s.ce.cer\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ce.cer\"");
 	}
 	void getCellColorG()const
 	{
-		fprintf(mFile,"\"%s.ce.ceg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ce.ceg\"");
 	}
 	void getCellColorB()const
 	{
-		fprintf(mFile,"\"%s.ce.ceb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ce.ceb\"");
 	}
 	void getCreaseColor()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getCreaseColorR()const
 	{
-		fprintf(mFile,"\"%s.cr.crr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crr\"");
 	}
 	void getCreaseColorG()const
 	{
-		fprintf(mFile,"\"%s.cr.crg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crg\"");
 	}
 	void getCreaseColorB()const
 	{
-		fprintf(mFile,"\"%s.cr.crb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crb\"");
 	}
 	void getCellSize()const
 	{
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getDensity()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSpottyness()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getRandomness()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getCreases()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 protected:
 	Leather(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
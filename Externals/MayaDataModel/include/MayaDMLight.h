@@ -27,307 +27,307 @@ public:
 	void setColor(const float3& cl)
 	{
 		if(cl == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
 		cl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".cl.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".cl.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".cl.cb\" ",cb,";\n");
 	}
 	void setIntensity(float in)
 	{
 		if(in == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".in\" %f;\n", in);
+		writeFloat(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setUseRayTraceShadows(bool urs)
 	{
 		if(urs == false) return;
-		fprintf(mFile,"\tsetAttr \".urs\" %i;\n", urs);
+		writeInt(mFile,"\tsetAttr \".urs\" ",urs,";\n");
 	}
 	void setShadowColor(const float3& sc)
 	{
 		if(sc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShadColorR(float scr)
 	{
 		if(scr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scr\" %f;\n", scr);
+		writeFloat(mFile,"\tsetAttr \".sc.scr\" ",scr,";\n");
 	}
 	void setShadColorG(float scg)
 	{
 		if(scg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scg\" %f;\n", scg);
+		writeFloat(mFile,"\tsetAttr \".sc.scg\" ",scg,";\n");
 	}
 	void setShadColorB(float scb)
 	{
 		if(scb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scb\" %f;\n", scb);
+		writeFloat(mFile,"\tsetAttr \".sc.scb\" ",scb,";\n");
 	}
 	void setShadowRays(short shr)
 	{
 		if(shr == 1) return;
-		fprintf(mFile,"\tsetAttr \".shr\" %i;\n", shr);
+		writeInt(mFile,"\tsetAttr \".shr\" ",shr,";\n");
 	}
 	void setRayDepthLimit(short rdl)
 	{
 		if(rdl == 1) return;
-		fprintf(mFile,"\tsetAttr \".rdl\" %i;\n", rdl);
+		writeInt(mFile,"\tsetAttr \".rdl\" ",rdl,";\n");
 	}
 	void setCenterOfIllumination(double col)
 	{
 		if(col == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".col\" %f;\n", col);
+		writeFloat(mFile,"\tsetAttr \".col\" ",col,";\n");
 	}
 	void setPointCamera(const float3& p)
 	{
 		if(p == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".p\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"float3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointCameraX(float px)
 	{
 		if(px == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPointCameraY(float py)
 	{
 		if(py == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setPointCameraZ(float pz)
 	{
 		if(pz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".p.pz\" ",pz,";\n");
 	}
 	void setRenderState(int rdst)
 	{
 		if(rdst == 0) return;
-		fprintf(mFile,"\tsetAttr \".rdst\" %i;\n", rdst);
+		writeInt(mFile,"\tsetAttr \".rdst\" ",rdst,";\n");
 	}
 	void setLocatorScale(double lls)
 	{
 		if(lls == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lls\" %f;\n", lls);
+		writeFloat(mFile,"\tsetAttr \".lls\" ",lls,";\n");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.cl.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.cl.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.cl.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cb\"");
 	}
 	void getIntensity()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getUseRayTraceShadows()const
 	{
-		fprintf(mFile,"\"%s.urs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".urs\"");
 	}
 	void getShadowColor()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getShadColorR()const
 	{
-		fprintf(mFile,"\"%s.sc.scr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scr\"");
 	}
 	void getShadColorG()const
 	{
-		fprintf(mFile,"\"%s.sc.scg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scg\"");
 	}
 	void getShadColorB()const
 	{
-		fprintf(mFile,"\"%s.sc.scb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scb\"");
 	}
 	void getShadowRays()const
 	{
-		fprintf(mFile,"\"%s.shr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shr\"");
 	}
 	void getRayDepthLimit()const
 	{
-		fprintf(mFile,"\"%s.rdl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdl\"");
 	}
 	void getCenterOfIllumination()const
 	{
-		fprintf(mFile,"\"%s.col\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col\"");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getMatrixWorldToEye()const
 	{
-		fprintf(mFile,"\"%s.wte\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wte\"");
 	}
 	void getMatrixEyeToWorld()const
 	{
-		fprintf(mFile,"\"%s.etw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".etw\"");
 	}
 	void getObjectId()const
 	{
-		fprintf(mFile,"\"%s.oi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi\"");
 	}
 	void getPrimitiveId()const
 	{
-		fprintf(mFile,"\"%s.pi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi\"");
 	}
 	void getRaySampler()const
 	{
-		fprintf(mFile,"\"%s.rts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rts\"");
 	}
 	void getRayDepth()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 	void getRenderState()const
 	{
-		fprintf(mFile,"\"%s.rdst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdst\"");
 	}
 	void getLocatorScale()const
 	{
-		fprintf(mFile,"\"%s.lls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lls\"");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.uu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.uu\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.vv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.vv\"");
 	}
 	void getUvFilterSize()const
 	{
-		fprintf(mFile,"\"%s.fq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fq\"");
 	}
 	void getUvFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.fq.fsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fq.fsx\"");
 	}
 	void getUvFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.fq.fsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fq.fsy\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 	void getLightData()const
 	{
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection()const
 	{
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX()const
 	{
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY()const
 	{
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity()const
 	{
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR()const
 	{
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG()const
 	{
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB()const
 	{
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient()const
 	{
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse()const
 	{
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular()const
 	{
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction()const
 	{
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity()const
 	{
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData()const
 	{
-		fprintf(mFile,"\"%s.ltd.lbl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbl\"");
 	}
 	void getOpticalFXvisibility()const
 	{
-		fprintf(mFile,"\"%s.ov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov\"");
 	}
 	void getOpticalFXvisibilityR()const
 	{
-		fprintf(mFile,"\"%s.ov.ovr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov.ovr\"");
 	}
 	void getOpticalFXvisibilityG()const
 	{
-		fprintf(mFile,"\"%s.ov.ovg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov.ovg\"");
 	}
 	void getOpticalFXvisibilityB()const
 	{
-		fprintf(mFile,"\"%s.ov.ovb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov.ovb\"");
 	}
 protected:
 	Light(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
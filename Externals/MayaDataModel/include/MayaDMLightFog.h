@@ -27,284 +27,284 @@ public:
 	void setColor(const float3& c)
 	{
 		if(c == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".c.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".c.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".c.cb\" ",cb,";\n");
 	}
 	void setDensity(float d)
 	{
 		if(d == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setFastDropOff(bool fd)
 	{
 		if(fd == false) return;
-		fprintf(mFile,"\tsetAttr \".fd\" %i;\n", fd);
+		writeInt(mFile,"\tsetAttr \".fd\" ",fd,";\n");
 	}
 	void setColorBasedTransparency(bool cbt)
 	{
 		if(cbt == true) return;
-		fprintf(mFile,"\tsetAttr \".cbt\" %i;\n", cbt);
+		writeInt(mFile,"\tsetAttr \".cbt\" ",cbt,";\n");
 	}
 	void setMatteOpacityMode(unsigned int mom)
 	{
 		if(mom == 2) return;
-		fprintf(mFile,"\tsetAttr \".mom\" %i;\n", mom);
+		writeInt(mFile,"\tsetAttr \".mom\" ",mom,";\n");
 	}
 	void setMatteOpacity(float mog)
 	{
 		if(mog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mog\" %f;\n", mog);
+		writeFloat(mFile,"\tsetAttr \".mog\" ",mog,";\n");
 	}
 	void getFilterSize()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.fs.fsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsx\"");
 	}
 	void getFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.fs.fsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsy\"");
 	}
 	void getFilterSizeZ()const
 	{
-		fprintf(mFile,"\"%s.fs.fsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsz\"");
 	}
 	void getLightDataArray(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i]\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"]\"");
 	}
 	void getLightDataArray()const
 	{
 
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld\"");
 	}
 	void getLightDirection()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldx\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldx\"");
 	}
 	void getLightDirectionX()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldy\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldy\"");
 	}
 	void getLightDirectionY()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldz\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldz\"");
 	}
 	void getLightDirectionZ()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li\"");
 	}
 	void getLightIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lir\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lir\"");
 	}
 	void getLightIntensityR()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lig\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lig\"");
 	}
 	void getLightIntensityG()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lib\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lib\"");
 	}
 	void getLightIntensityB()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].la\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].la\"");
 	}
 	void getLightAmbient()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ldf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ldf\"");
 	}
 	void getLightDiffuse()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ls\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ls\"");
 	}
 	void getLightSpecular()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lsf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lsf\"");
 	}
 	void getLightShadowFraction()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].psi\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].psi\"");
 	}
 	void getPreShadowIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lbd\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lbd\"");
 	}
 	void getLightBlindData()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbd\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.c.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.c.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.c.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cb\"");
 	}
 	void getDensity()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getFastDropOff()const
 	{
-		fprintf(mFile,"\"%s.fd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd\"");
 	}
 	void getColorBasedTransparency()const
 	{
-		fprintf(mFile,"\"%s.cbt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cbt\"");
 	}
 	void getMatteOpacityMode()const
 	{
-		fprintf(mFile,"\"%s.mom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mom\"");
 	}
 	void getMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.mog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mog\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 protected:
 	LightFog(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,71 +27,71 @@ public:
 	void setLightDirectionOnly(bool ldo)
 	{
 		if(ldo == false) return;
-		fprintf(mFile,"\tsetAttr \".ldo\" %i;\n", ldo);
+		writeInt(mFile,"\tsetAttr \".ldo\" ",ldo,";\n");
 	}
 	void getMatrixEyeToWorld()const
 	{
-		fprintf(mFile,"\"%s.e2w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2w\"");
 	}
 	void getLightDirectionOnly()const
 	{
-		fprintf(mFile,"\"%s.ldo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldo\"");
 	}
 	void getWorldMatrix()const
 	{
-		fprintf(mFile,"\"%s.wm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wm\"");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getLightPosition()const
 	{
-		fprintf(mFile,"\"%s.lp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp\"");
 	}
 	void getLightPositionX()const
 	{
-		fprintf(mFile,"\"%s.lp.lpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpx\"");
 	}
 	void getLightPositionY()const
 	{
-		fprintf(mFile,"\"%s.lp.lpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpy\"");
 	}
 	void getLightPositionZ()const
 	{
-		fprintf(mFile,"\"%s.lp.lpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpz\"");
 	}
 	void getLightDirection()const
 	{
-		fprintf(mFile,"\"%s.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld\"");
 	}
 	void getLightDirectionX()const
 	{
-		fprintf(mFile,"\"%s.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld.ldx\"");
 	}
 	void getLightDirectionY()const
 	{
-		fprintf(mFile,"\"%s.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld.ldy\"");
 	}
 	void getLightDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld.ldz\"");
 	}
 	void getSampleDistance()const
 	{
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 protected:
 	LightInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
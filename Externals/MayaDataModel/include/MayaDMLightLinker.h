@@ -46,235 +46,235 @@ public:
 
 	void setLink(size_t lnk_i,const Link& lnk)
 	{
-		fprintf(mFile,"\tsetAttr \".lnk[%i]\" ",lnk_i);
+		writeInt(mFile,"\tsetAttr \".lnk[",lnk_i,"]\" ");
 		lnk.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLink(size_t lnk_start,size_t lnk_end,Link* lnk)
 	{
-		fprintf(mFile,"\tsetAttr \".lnk[%i:%i]\" ", lnk_start,lnk_end);
+		writeInt(mFile,"\tsetAttr \".lnk[",lnk_start); writeInt(mFile,":",lnk_end,"]\" ");
 		size_t size = (lnk_end-lnk_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			lnk[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLink(size_t lnk_start,size_t lnk_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".lnk[%i:%i]\"",lnk_start,lnk_end);
-		fprintf(mFile," -type \"Link\" ");
+		writeInt(mFile,"\tsetAttr \".lnk[",lnk_start); writeInt(mFile,":",lnk_end,"]\"");
+		writeString(mFile," -type \"Link\" ");
 	}
 	void appendLink(const Link& lnk)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		lnk.write(mFile);
 	}
 	void endLink()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIgnore(size_t ign_i,const Ignore& ign)
 	{
-		fprintf(mFile,"\tsetAttr \".ign[%i]\" ",ign_i);
+		writeInt(mFile,"\tsetAttr \".ign[",ign_i,"]\" ");
 		ign.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIgnore(size_t ign_start,size_t ign_end,Ignore* ign)
 	{
-		fprintf(mFile,"\tsetAttr \".ign[%i:%i]\" ", ign_start,ign_end);
+		writeInt(mFile,"\tsetAttr \".ign[",ign_start); writeInt(mFile,":",ign_end,"]\" ");
 		size_t size = (ign_end-ign_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ign[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startIgnore(size_t ign_start,size_t ign_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ign[%i:%i]\"",ign_start,ign_end);
-		fprintf(mFile," -type \"Ignore\" ");
+		writeInt(mFile,"\tsetAttr \".ign[",ign_start); writeInt(mFile,":",ign_end,"]\"");
+		writeString(mFile," -type \"Ignore\" ");
 	}
 	void appendIgnore(const Ignore& ign)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ign.write(mFile);
 	}
 	void endIgnore()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShadowLink(size_t slnk_i,const ShadowLink& slnk)
 	{
-		fprintf(mFile,"\tsetAttr \".slnk[%i]\" ",slnk_i);
+		writeInt(mFile,"\tsetAttr \".slnk[",slnk_i,"]\" ");
 		slnk.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShadowLink(size_t slnk_start,size_t slnk_end,ShadowLink* slnk)
 	{
-		fprintf(mFile,"\tsetAttr \".slnk[%i:%i]\" ", slnk_start,slnk_end);
+		writeInt(mFile,"\tsetAttr \".slnk[",slnk_start); writeInt(mFile,":",slnk_end,"]\" ");
 		size_t size = (slnk_end-slnk_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			slnk[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startShadowLink(size_t slnk_start,size_t slnk_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".slnk[%i:%i]\"",slnk_start,slnk_end);
-		fprintf(mFile," -type \"ShadowLink\" ");
+		writeInt(mFile,"\tsetAttr \".slnk[",slnk_start); writeInt(mFile,":",slnk_end,"]\"");
+		writeString(mFile," -type \"ShadowLink\" ");
 	}
 	void appendShadowLink(const ShadowLink& slnk)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		slnk.write(mFile);
 	}
 	void endShadowLink()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShadowIgnore(size_t sign_i,const ShadowIgnore& sign)
 	{
-		fprintf(mFile,"\tsetAttr \".sign[%i]\" ",sign_i);
+		writeInt(mFile,"\tsetAttr \".sign[",sign_i,"]\" ");
 		sign.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShadowIgnore(size_t sign_start,size_t sign_end,ShadowIgnore* sign)
 	{
-		fprintf(mFile,"\tsetAttr \".sign[%i:%i]\" ", sign_start,sign_end);
+		writeInt(mFile,"\tsetAttr \".sign[",sign_start); writeInt(mFile,":",sign_end,"]\" ");
 		size_t size = (sign_end-sign_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			sign[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startShadowIgnore(size_t sign_start,size_t sign_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sign[%i:%i]\"",sign_start,sign_end);
-		fprintf(mFile," -type \"ShadowIgnore\" ");
+		writeInt(mFile,"\tsetAttr \".sign[",sign_start); writeInt(mFile,":",sign_end,"]\"");
+		writeString(mFile," -type \"ShadowIgnore\" ");
 	}
 	void appendShadowIgnore(const ShadowIgnore& sign)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		sign.write(mFile);
 	}
 	void endShadowIgnore()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getLink(size_t lnk_i)const
 	{
-		fprintf(mFile,"\"%s.lnk[%i]\"",mName.c_str(),lnk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lnk[",lnk_i,"]\"");
 	}
 	void getLink()const
 	{
 
-		fprintf(mFile,"\"%s.lnk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lnk\"");
 	}
 	void getLight(size_t lnk_i)const
 	{
-		fprintf(mFile,"\"%s.lnk[%i].llnk\"",mName.c_str(),lnk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lnk[",lnk_i,"].llnk\"");
 	}
 	void getLight()const
 	{
 
-		fprintf(mFile,"\"%s.lnk.llnk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lnk.llnk\"");
 	}
 	void getObject(size_t lnk_i)const
 	{
-		fprintf(mFile,"\"%s.lnk[%i].olnk\"",mName.c_str(),lnk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lnk[",lnk_i,"].olnk\"");
 	}
 	void getObject()const
 	{
 
-		fprintf(mFile,"\"%s.lnk.olnk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lnk.olnk\"");
 	}
 	void getIgnore(size_t ign_i)const
 	{
-		fprintf(mFile,"\"%s.ign[%i]\"",mName.c_str(),ign_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ign[",ign_i,"]\"");
 	}
 	void getIgnore()const
 	{
 
-		fprintf(mFile,"\"%s.ign\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ign\"");
 	}
 	void getLightIgnored(size_t ign_i)const
 	{
-		fprintf(mFile,"\"%s.ign[%i].lign\"",mName.c_str(),ign_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ign[",ign_i,"].lign\"");
 	}
 	void getLightIgnored()const
 	{
 
-		fprintf(mFile,"\"%s.ign.lign\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ign.lign\"");
 	}
 	void getObjectIgnored(size_t ign_i)const
 	{
-		fprintf(mFile,"\"%s.ign[%i].oign\"",mName.c_str(),ign_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ign[",ign_i,"].oign\"");
 	}
 	void getObjectIgnored()const
 	{
 
-		fprintf(mFile,"\"%s.ign.oign\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ign.oign\"");
 	}
 	void getShadowLink(size_t slnk_i)const
 	{
-		fprintf(mFile,"\"%s.slnk[%i]\"",mName.c_str(),slnk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".slnk[",slnk_i,"]\"");
 	}
 	void getShadowLink()const
 	{
 
-		fprintf(mFile,"\"%s.slnk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slnk\"");
 	}
 	void getShadowLight(size_t slnk_i)const
 	{
-		fprintf(mFile,"\"%s.slnk[%i].sllk\"",mName.c_str(),slnk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".slnk[",slnk_i,"].sllk\"");
 	}
 	void getShadowLight()const
 	{
 
-		fprintf(mFile,"\"%s.slnk.sllk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slnk.sllk\"");
 	}
 	void getShadowObject(size_t slnk_i)const
 	{
-		fprintf(mFile,"\"%s.slnk[%i].solk\"",mName.c_str(),slnk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".slnk[",slnk_i,"].solk\"");
 	}
 	void getShadowObject()const
 	{
 
-		fprintf(mFile,"\"%s.slnk.solk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slnk.solk\"");
 	}
 	void getShadowIgnore(size_t sign_i)const
 	{
-		fprintf(mFile,"\"%s.sign[%i]\"",mName.c_str(),sign_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sign[",sign_i,"]\"");
 	}
 	void getShadowIgnore()const
 	{
 
-		fprintf(mFile,"\"%s.sign\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sign\"");
 	}
 	void getShadowLightIgnored(size_t sign_i)const
 	{
-		fprintf(mFile,"\"%s.sign[%i].slig\"",mName.c_str(),sign_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sign[",sign_i,"].slig\"");
 	}
 	void getShadowLightIgnored()const
 	{
 
-		fprintf(mFile,"\"%s.sign.slig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sign.slig\"");
 	}
 	void getShadowObjectIgnored(size_t sign_i)const
 	{
-		fprintf(mFile,"\"%s.sign[%i].soig\"",mName.c_str(),sign_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sign[",sign_i,"].soig\"");
 	}
 	void getShadowObjectIgnored()const
 	{
 
-		fprintf(mFile,"\"%s.sign.soig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sign.soig\"");
 	}
 protected:
 	LightLinker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,21 +26,21 @@ public:
 
 	void getLights(size_t l_i)const
 	{
-		fprintf(mFile,"\"%s.l[%i]\"",mName.c_str(),l_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".l[",l_i,"]\"");
 	}
 	void getLights()const
 	{
 
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getLinkNodes(size_t ln_i)const
 	{
-		fprintf(mFile,"\"%s.ln[%i]\"",mName.c_str(),ln_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ln[",ln_i,"]\"");
 	}
 	void getLinkNodes()const
 	{
 
-		fprintf(mFile,"\"%s.ln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ln\"");
 	}
 protected:
 	LightList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
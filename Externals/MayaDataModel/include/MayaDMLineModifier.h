@@ -23,9 +23,9 @@ public:
 		unsigned int dropoff_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", dropoff_Position);
-			fprintf(file,"%f ", dropoff_FloatValue);
-			fprintf(file,"%i", dropoff_Interp);
+			writeFloat(file,"",dropoff_Position," ");
+			writeFloat(file,"",dropoff_FloatValue," ");
+			writeInt(file,"",dropoff_Interp);
 		}
 	};
 public:
@@ -38,328 +38,328 @@ public:
 	void setShape(unsigned int shp)
 	{
 		if(shp == 0) return;
-		fprintf(mFile,"\tsetAttr \".shp\" %i;\n", shp);
+		writeInt(mFile,"\tsetAttr \".shp\" ",shp,";\n");
 	}
 	void setWidthScale(double wsc)
 	{
 		if(wsc == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".wsc\" %f;\n", wsc);
+		writeFloat(mFile,"\tsetAttr \".wsc\" ",wsc,";\n");
 	}
 	void setWidthOffset(double wof)
 	{
 		if(wof == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wof\" %f;\n", wof);
+		writeFloat(mFile,"\tsetAttr \".wof\" ",wof,";\n");
 	}
 	void setOpacityScale(double osc)
 	{
 		if(osc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".osc\" %f;\n", osc);
+		writeFloat(mFile,"\tsetAttr \".osc\" ",osc,";\n");
 	}
 	void setOpacityOffset(double oof)
 	{
 		if(oof == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oof\" %f;\n", oof);
+		writeFloat(mFile,"\tsetAttr \".oof\" ",oof,";\n");
 	}
 	void setSurfaceOffset(double sof)
 	{
 		if(sof == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sof\" %f;\n", sof);
+		writeFloat(mFile,"\tsetAttr \".sof\" ",sof,";\n");
 	}
 	void setLineExtend(double lex)
 	{
 		if(lex == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lex\" %f;\n", lex);
+		writeFloat(mFile,"\tsetAttr \".lex\" ",lex,";\n");
 	}
 	void setModifyColor(bool mcl)
 	{
 		if(mcl == false) return;
-		fprintf(mFile,"\tsetAttr \".mcl\" %i;\n", mcl);
+		writeInt(mFile,"\tsetAttr \".mcl\" ",mcl,";\n");
 	}
 	void setColor(const float3& clr)
 	{
-		fprintf(mFile,"\tsetAttr \".clr\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".clr\" -type \"float3\" ");
 		clr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float crr)
 	{
 		if(crr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".clr.crr\" %f;\n", crr);
+		writeFloat(mFile,"\tsetAttr \".clr.crr\" ",crr,";\n");
 	}
 	void setColorG(float crg)
 	{
 		if(crg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr.crg\" %f;\n", crg);
+		writeFloat(mFile,"\tsetAttr \".clr.crg\" ",crg,";\n");
 	}
 	void setColorB(float crb)
 	{
 		if(crb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr.crb\" %f;\n", crb);
+		writeFloat(mFile,"\tsetAttr \".clr.crb\" ",crb,";\n");
 	}
 	void setTubeScale(double tus)
 	{
 		if(tus == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tus\" %f;\n", tus);
+		writeFloat(mFile,"\tsetAttr \".tus\" ",tus,";\n");
 	}
 	void setTubeDropout(double tud)
 	{
 		if(tud == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tud\" %f;\n", tud);
+		writeFloat(mFile,"\tsetAttr \".tud\" ",tud,";\n");
 	}
 	void setBranchDropout(double bdp)
 	{
 		if(bdp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bdp\" %f;\n", bdp);
+		writeFloat(mFile,"\tsetAttr \".bdp\" ",bdp,";\n");
 	}
 	void setTwigDropout(double tdp)
 	{
 		if(tdp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tdp\" %f;\n", tdp);
+		writeFloat(mFile,"\tsetAttr \".tdp\" ",tdp,";\n");
 	}
 	void setLeafDropout(double ldp)
 	{
 		if(ldp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ldp\" %f;\n", ldp);
+		writeFloat(mFile,"\tsetAttr \".ldp\" ",ldp,";\n");
 	}
 	void setFlowerDropout(double fdp)
 	{
 		if(fdp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fdp\" %f;\n", fdp);
+		writeFloat(mFile,"\tsetAttr \".fdp\" ",fdp,";\n");
 	}
 	void setLeafScale(double lsc)
 	{
 		if(lsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lsc\" %f;\n", lsc);
+		writeFloat(mFile,"\tsetAttr \".lsc\" ",lsc,";\n");
 	}
 	void setFlowerScale(double fsc)
 	{
 		if(fsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fsc\" %f;\n", fsc);
+		writeFloat(mFile,"\tsetAttr \".fsc\" ",fsc,";\n");
 	}
 	void setForce(double frc)
 	{
 		if(frc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".frc\" %f;\n", frc);
+		writeFloat(mFile,"\tsetAttr \".frc\" ",frc,";\n");
 	}
 	void setDirectionalForce(double dfc)
 	{
 		if(dfc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dfc\" %f;\n", dfc);
+		writeFloat(mFile,"\tsetAttr \".dfc\" ",dfc,";\n");
 	}
 	void setDisplacement(double dsp)
 	{
 		if(dsp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dsp\" %f;\n", dsp);
+		writeFloat(mFile,"\tsetAttr \".dsp\" ",dsp,";\n");
 	}
 	void setDirectionalDisplacement(double ddc)
 	{
 		if(ddc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ddc\" %f;\n", ddc);
+		writeFloat(mFile,"\tsetAttr \".ddc\" ",ddc,";\n");
 	}
 	void setDropoffNoise(double don)
 	{
 		if(don == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".don\" %f;\n", don);
+		writeFloat(mFile,"\tsetAttr \".don\" ",don,";\n");
 	}
 	void setNoiseFrequency(double nfr)
 	{
 		if(nfr == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".nfr\" %f;\n", nfr);
+		writeFloat(mFile,"\tsetAttr \".nfr\" ",nfr,";\n");
 	}
 	void setDropoff(size_t drp_i,const Dropoff& drp)
 	{
-		fprintf(mFile,"\tsetAttr \".drp[%i]\" ",drp_i);
+		writeInt(mFile,"\tsetAttr \".drp[",drp_i,"]\" ");
 		drp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDropoff(size_t drp_start,size_t drp_end,Dropoff* drp)
 	{
-		fprintf(mFile,"\tsetAttr \".drp[%i:%i]\" ", drp_start,drp_end);
+		writeInt(mFile,"\tsetAttr \".drp[",drp_start); writeInt(mFile,":",drp_end,"]\" ");
 		size_t size = (drp_end-drp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			drp[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDropoff(size_t drp_start,size_t drp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".drp[%i:%i]\"",drp_start,drp_end);
-		fprintf(mFile," -type \"Dropoff\" ");
+		writeInt(mFile,"\tsetAttr \".drp[",drp_start); writeInt(mFile,":",drp_end,"]\"");
+		writeString(mFile," -type \"Dropoff\" ");
 	}
 	void appendDropoff(const Dropoff& drp)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		drp.write(mFile);
 	}
 	void endDropoff()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDropoff_Position(size_t drp_i,float drpp)
 	{
 		if(drpp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".drp[%i].drpp\" %f;\n", drp_i,drpp);
+		writeInt(mFile,"\tsetAttr \".drp[",drp_i); writeFloat(mFile,"].drpp\" ",drpp,";\n");
 	}
 	void setDropoff_FloatValue(size_t drp_i,float drpfv)
 	{
 		if(drpfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".drp[%i].drpfv\" %f;\n", drp_i,drpfv);
+		writeInt(mFile,"\tsetAttr \".drp[",drp_i); writeFloat(mFile,"].drpfv\" ",drpfv,";\n");
 	}
 	void setDropoff_Interp(size_t drp_i,unsigned int drpi)
 	{
 		if(drpi == 0) return;
-		fprintf(mFile,"\tsetAttr \".drp[%i].drpi\" %i;\n", drp_i,drpi);
+		writeInt(mFile,"\tsetAttr \".drp[",drp_i); writeInt(mFile,"].drpi\" ",drpi,";\n");
 	}
 	void getShape()const
 	{
-		fprintf(mFile,"\"%s.shp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shp\"");
 	}
 	void getWidthScale()const
 	{
-		fprintf(mFile,"\"%s.wsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wsc\"");
 	}
 	void getWidthOffset()const
 	{
-		fprintf(mFile,"\"%s.wof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wof\"");
 	}
 	void getOpacityScale()const
 	{
-		fprintf(mFile,"\"%s.osc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".osc\"");
 	}
 	void getOpacityOffset()const
 	{
-		fprintf(mFile,"\"%s.oof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oof\"");
 	}
 	void getSurfaceOffset()const
 	{
-		fprintf(mFile,"\"%s.sof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sof\"");
 	}
 	void getLineExtend()const
 	{
-		fprintf(mFile,"\"%s.lex\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lex\"");
 	}
 	void getModifyColor()const
 	{
-		fprintf(mFile,"\"%s.mcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mcl\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.clr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.clr.crr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.crr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.clr.crg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.crg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.clr.crb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.crb\"");
 	}
 	void getTubeScale()const
 	{
-		fprintf(mFile,"\"%s.tus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tus\"");
 	}
 	void getTubeDropout()const
 	{
-		fprintf(mFile,"\"%s.tud\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tud\"");
 	}
 	void getBranchDropout()const
 	{
-		fprintf(mFile,"\"%s.bdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bdp\"");
 	}
 	void getTwigDropout()const
 	{
-		fprintf(mFile,"\"%s.tdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tdp\"");
 	}
 	void getLeafDropout()const
 	{
-		fprintf(mFile,"\"%s.ldp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldp\"");
 	}
 	void getFlowerDropout()const
 	{
-		fprintf(mFile,"\"%s.fdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fdp\"");
 	}
 	void getLeafScale()const
 	{
-		fprintf(mFile,"\"%s.lsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsc\"");
 	}
 	void getFlowerScale()const
 	{
-		fprintf(mFile,"\"%s.fsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsc\"");
 	}
 	void getForce()const
 	{
-		fprintf(mFile,"\"%s.frc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frc\"");
 	}
 	void getDirectionalForce()const
 	{
-		fprintf(mFile,"\"%s.dfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfc\"");
 	}
 	void getDisplacement()const
 	{
-		fprintf(mFile,"\"%s.dsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsp\"");
 	}
 	void getDirectionalDisplacement()const
 	{
-		fprintf(mFile,"\"%s.ddc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ddc\"");
 	}
 	void getDropoffNoise()const
 	{
-		fprintf(mFile,"\"%s.don\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".don\"");
 	}
 	void getNoiseFrequency()const
 	{
-		fprintf(mFile,"\"%s.nfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nfr\"");
 	}
 	void getDropoff(size_t drp_i)const
 	{
-		fprintf(mFile,"\"%s.drp[%i]\"",mName.c_str(),drp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".drp[",drp_i,"]\"");
 	}
 	void getDropoff()const
 	{
 
-		fprintf(mFile,"\"%s.drp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drp\"");
 	}
 	void getDropoff_Position(size_t drp_i)const
 	{
-		fprintf(mFile,"\"%s.drp[%i].drpp\"",mName.c_str(),drp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".drp[",drp_i,"].drpp\"");
 	}
 	void getDropoff_Position()const
 	{
 
-		fprintf(mFile,"\"%s.drp.drpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drp.drpp\"");
 	}
 	void getDropoff_FloatValue(size_t drp_i)const
 	{
-		fprintf(mFile,"\"%s.drp[%i].drpfv\"",mName.c_str(),drp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".drp[",drp_i,"].drpfv\"");
 	}
 	void getDropoff_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.drp.drpfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drp.drpfv\"");
 	}
 	void getDropoff_Interp(size_t drp_i)const
 	{
-		fprintf(mFile,"\"%s.drp[%i].drpi\"",mName.c_str(),drp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".drp[",drp_i,"].drpi\"");
 	}
 	void getDropoff_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.drp.drpi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drp.drpi\"");
 	}
 	void getOutLineModifier(size_t olm_i)const
 	{
-		fprintf(mFile,"\"%s.olm[%i]\"",mName.c_str(),olm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".olm[",olm_i,"]\"");
 	}
 	void getOutLineModifier()const
 	{
 
-		fprintf(mFile,"\"%s.olm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".olm\"");
 	}
 protected:
 	LineModifier(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
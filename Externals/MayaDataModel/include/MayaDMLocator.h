@@ -27,119 +27,119 @@ public:
 	void setUnderWorldObject(bool uwo)
 	{
 		if(uwo == false) return;
-		fprintf(mFile,"\tsetAttr \".uwo\" %i;\n", uwo);
+		writeInt(mFile,"\tsetAttr \".uwo\" ",uwo,";\n");
 	}
 	void setLocalPosition(const double3& lp)
 	{
 		if(lp == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".lp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".lp\" -type \"double3\" ");
 		lp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalPositionX(double lpx)
 	{
 		if(lpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".lp.lpx\" %f;\n", lpx);
+		writeFloat(mFile,"\tsetAttr \".lp.lpx\" ",lpx,";\n");
 	}
 	void setLocalPositionY(double lpy)
 	{
 		if(lpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".lp.lpy\" %f;\n", lpy);
+		writeFloat(mFile,"\tsetAttr \".lp.lpy\" ",lpy,";\n");
 	}
 	void setLocalPositionZ(double lpz)
 	{
 		if(lpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".lp.lpz\" %f;\n", lpz);
+		writeFloat(mFile,"\tsetAttr \".lp.lpz\" ",lpz,";\n");
 	}
 	void setLocalScale(const double3& los)
 	{
 		if(los == double3(1.0, 1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".los\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".los\" -type \"double3\" ");
 		los.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalScaleX(double lsx)
 	{
 		if(lsx == 1) return;
-		fprintf(mFile,"\tsetAttr \".los.lsx\" %f;\n", lsx);
+		writeFloat(mFile,"\tsetAttr \".los.lsx\" ",lsx,";\n");
 	}
 	void setLocalScaleY(double lsy)
 	{
 		if(lsy == 1) return;
-		fprintf(mFile,"\tsetAttr \".los.lsy\" %f;\n", lsy);
+		writeFloat(mFile,"\tsetAttr \".los.lsy\" ",lsy,";\n");
 	}
 	void setLocalScaleZ(double lsz)
 	{
 		if(lsz == 1) return;
-		fprintf(mFile,"\tsetAttr \".los.lsz\" %f;\n", lsz);
+		writeFloat(mFile,"\tsetAttr \".los.lsz\" ",lsz,";\n");
 	}
 	void getLocalPosition()const
 	{
-		fprintf(mFile,"\"%s.lp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp\"");
 	}
 	void getLocalPositionX()const
 	{
-		fprintf(mFile,"\"%s.lp.lpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpx\"");
 	}
 	void getLocalPositionY()const
 	{
-		fprintf(mFile,"\"%s.lp.lpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpy\"");
 	}
 	void getLocalPositionZ()const
 	{
-		fprintf(mFile,"\"%s.lp.lpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpz\"");
 	}
 	void getWorldPosition(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i]\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"]\"");
 	}
 	void getWorldPosition()const
 	{
 
-		fprintf(mFile,"\"%s.wp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp\"");
 	}
 	void getWorldPositionX(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpx\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpx\"");
 	}
 	void getWorldPositionX()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpx\"");
 	}
 	void getWorldPositionY(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpy\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpy\"");
 	}
 	void getWorldPositionY()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpy\"");
 	}
 	void getWorldPositionZ(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpz\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpz\"");
 	}
 	void getWorldPositionZ()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpz\"");
 	}
 	void getLocalScale()const
 	{
-		fprintf(mFile,"\"%s.los\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".los\"");
 	}
 	void getLocalScaleX()const
 	{
-		fprintf(mFile,"\"%s.los.lsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".los.lsx\"");
 	}
 	void getLocalScaleY()const
 	{
-		fprintf(mFile,"\"%s.los.lsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".los.lsy\"");
 	}
 	void getLocalScaleZ()const
 	{
-		fprintf(mFile,"\"%s.los.lsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".los.lsz\"");
 	}
 protected:
 	Locator(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,131 +27,131 @@ public:
 	void setCameraMatrix(const matrix& cm)
 	{
 		if(cm == identity) return;
-		fprintf(mFile,"\tsetAttr \".cm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".cm\" -type \"matrix\" ");
 		cm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setThreshold(size_t th_i,double th)
 	{
 		if(th == 0) return;
-		fprintf(mFile,"\tsetAttr \".th[%i]\" %f;\n", th_i,th);
+		writeInt(mFile,"\tsetAttr \".th[",th_i); writeFloat(mFile,"]\" ",th,";\n");
 	}
 	void setThreshold(size_t th_start,size_t th_end,double* th)
 	{
-		fprintf(mFile,"\tsetAttr \".th[%i:%i]\" ", th_start,th_end);
+		writeInt(mFile,"\tsetAttr \".th[",th_start); writeInt(mFile,":",th_end,"]\" ");
 		size_t size = (th_end-th_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",th[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",th[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startThreshold(size_t th_start,size_t th_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".th[%i:%i]\"",th_start,th_end);
+		writeInt(mFile,"\tsetAttr \".th[",th_start); writeInt(mFile,":",th_end,"]\"");
 	}
 	void appendThreshold(double th)const
 	{
-		fprintf(mFile," %f",th);
+		writeFloat(mFile," ",th);
 	}
 	void endThreshold()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplayLevel(size_t dl_i,unsigned int dl)
 	{
 		if(dl == 0) return;
-		fprintf(mFile,"\tsetAttr \".dl[%i]\" %i;\n", dl_i,dl);
+		writeInt(mFile,"\tsetAttr \".dl[",dl_i); writeInt(mFile,"]\" ",dl,";\n");
 	}
 	void setDisplayLevel(size_t dl_start,size_t dl_end,unsigned int* dl)
 	{
-		fprintf(mFile,"\tsetAttr \".dl[%i:%i]\" ", dl_start,dl_end);
+		writeInt(mFile,"\tsetAttr \".dl[",dl_start); writeInt(mFile,":",dl_end,"]\" ");
 		size_t size = (dl_end-dl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",dl[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",dl[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDisplayLevel(size_t dl_start,size_t dl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".dl[%i:%i]\"",dl_start,dl_end);
+		writeInt(mFile,"\tsetAttr \".dl[",dl_start); writeInt(mFile,":",dl_end,"]\"");
 	}
 	void appendDisplayLevel(unsigned int dl)const
 	{
-		fprintf(mFile," %i",dl);
+		writeInt(mFile," ",dl);
 	}
 	void endDisplayLevel()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinMaxDistance(bool mmd)
 	{
 		if(mmd == 0) return;
-		fprintf(mFile,"\tsetAttr \".mmd\" %i;\n", mmd);
+		writeInt(mFile,"\tsetAttr \".mmd\" ",mmd,";\n");
 	}
 	void setMinDistance(double mid)
 	{
 		if(mid == -100.0) return;
-		fprintf(mFile,"\tsetAttr \".mid\" %f;\n", mid);
+		writeFloat(mFile,"\tsetAttr \".mid\" ",mid,";\n");
 	}
 	void setMaxDistance(double mxd)
 	{
 		if(mxd == 100.0) return;
-		fprintf(mFile,"\tsetAttr \".mxd\" %f;\n", mxd);
+		writeFloat(mFile,"\tsetAttr \".mxd\" ",mxd,";\n");
 	}
 	void getCameraMatrix()const
 	{
-		fprintf(mFile,"\"%s.cm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cm\"");
 	}
 	void getThreshold(size_t th_i)const
 	{
-		fprintf(mFile,"\"%s.th[%i]\"",mName.c_str(),th_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".th[",th_i,"]\"");
 	}
 	void getThreshold()const
 	{
 
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getDisplayLevel(size_t dl_i)const
 	{
-		fprintf(mFile,"\"%s.dl[%i]\"",mName.c_str(),dl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dl[",dl_i,"]\"");
 	}
 	void getDisplayLevel()const
 	{
 
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getMinMaxDistance()const
 	{
-		fprintf(mFile,"\"%s.mmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmd\"");
 	}
 	void getMinDistance()const
 	{
-		fprintf(mFile,"\"%s.mid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mid\"");
 	}
 	void getMaxDistance()const
 	{
-		fprintf(mFile,"\"%s.mxd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxd\"");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getActiveLevel()const
 	{
-		fprintf(mFile,"\"%s.al\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al\"");
 	}
 	void getOutput(size_t o_i)const
 	{
-		fprintf(mFile,"\"%s.o[%i]\"",mName.c_str(),o_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".o[",o_i,"]\"");
 	}
 	void getOutput()const
 	{
 
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	LodGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,168 +26,168 @@ public:
 
 	void setInBoxMin(const double3& bmn)
 	{
-		fprintf(mFile,"\tsetAttr \".bmn\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".bmn\" -type \"double3\" ");
 		bmn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInBoxMinX(double bmix)
 	{
 		if(bmix == 0) return;
-		fprintf(mFile,"\tsetAttr \".bmn.bmix\" %f;\n", bmix);
+		writeFloat(mFile,"\tsetAttr \".bmn.bmix\" ",bmix,";\n");
 	}
 	void setInBoxMinY(double bmiy)
 	{
 		if(bmiy == 0) return;
-		fprintf(mFile,"\tsetAttr \".bmn.bmiy\" %f;\n", bmiy);
+		writeFloat(mFile,"\tsetAttr \".bmn.bmiy\" ",bmiy,";\n");
 	}
 	void setInBoxMinZ(double bmiz)
 	{
 		if(bmiz == 0) return;
-		fprintf(mFile,"\tsetAttr \".bmn.bmiz\" %f;\n", bmiz);
+		writeFloat(mFile,"\tsetAttr \".bmn.bmiz\" ",bmiz,";\n");
 	}
 	void setInBoxMax(const double3& bmx)
 	{
-		fprintf(mFile,"\tsetAttr \".bmx\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".bmx\" -type \"double3\" ");
 		bmx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInBoxMaxX(double bmax)
 	{
 		if(bmax == 0) return;
-		fprintf(mFile,"\tsetAttr \".bmx.bmax\" %f;\n", bmax);
+		writeFloat(mFile,"\tsetAttr \".bmx.bmax\" ",bmax,";\n");
 	}
 	void setInBoxMaxY(double bmay)
 	{
 		if(bmay == 0) return;
-		fprintf(mFile,"\tsetAttr \".bmx.bmay\" %f;\n", bmay);
+		writeFloat(mFile,"\tsetAttr \".bmx.bmay\" ",bmay,";\n");
 	}
 	void setInBoxMaxZ(double bmaz)
 	{
 		if(bmaz == 0) return;
-		fprintf(mFile,"\tsetAttr \".bmx.bmaz\" %f;\n", bmaz);
+		writeFloat(mFile,"\tsetAttr \".bmx.bmaz\" ",bmaz,";\n");
 	}
 	void setCamera(const double3& cam)
 	{
-		fprintf(mFile,"\tsetAttr \".cam\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".cam\" -type \"double3\" ");
 		cam.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCameraX(double cax)
 	{
 		if(cax == 0) return;
-		fprintf(mFile,"\tsetAttr \".cam.cax\" %f;\n", cax);
+		writeFloat(mFile,"\tsetAttr \".cam.cax\" ",cax,";\n");
 	}
 	void setCameraY(double cay)
 	{
 		if(cay == 0) return;
-		fprintf(mFile,"\tsetAttr \".cam.cay\" %f;\n", cay);
+		writeFloat(mFile,"\tsetAttr \".cam.cay\" ",cay,";\n");
 	}
 	void setCameraZ(double caz)
 	{
 		if(caz == 0) return;
-		fprintf(mFile,"\tsetAttr \".cam.caz\" %f;\n", caz);
+		writeFloat(mFile,"\tsetAttr \".cam.caz\" ",caz,";\n");
 	}
 	void setThreshold(size_t th_i,double th)
 	{
 		if(th == 0) return;
-		fprintf(mFile,"\tsetAttr \".th[%i]\" %f;\n", th_i,th);
+		writeInt(mFile,"\tsetAttr \".th[",th_i); writeFloat(mFile,"]\" ",th,";\n");
 	}
 	void setThreshold(size_t th_start,size_t th_end,double* th)
 	{
-		fprintf(mFile,"\tsetAttr \".th[%i:%i]\" ", th_start,th_end);
+		writeInt(mFile,"\tsetAttr \".th[",th_start); writeInt(mFile,":",th_end,"]\" ");
 		size_t size = (th_end-th_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",th[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",th[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startThreshold(size_t th_start,size_t th_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".th[%i:%i]\"",th_start,th_end);
+		writeInt(mFile,"\tsetAttr \".th[",th_start); writeInt(mFile,":",th_end,"]\"");
 	}
 	void appendThreshold(double th)const
 	{
-		fprintf(mFile," %f",th);
+		writeFloat(mFile," ",th);
 	}
 	void endThreshold()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInBoxMin()const
 	{
-		fprintf(mFile,"\"%s.bmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmn\"");
 	}
 	void getInBoxMinX()const
 	{
-		fprintf(mFile,"\"%s.bmn.bmix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmn.bmix\"");
 	}
 	void getInBoxMinY()const
 	{
-		fprintf(mFile,"\"%s.bmn.bmiy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmn.bmiy\"");
 	}
 	void getInBoxMinZ()const
 	{
-		fprintf(mFile,"\"%s.bmn.bmiz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmn.bmiz\"");
 	}
 	void getInBoxMax()const
 	{
-		fprintf(mFile,"\"%s.bmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmx\"");
 	}
 	void getInBoxMaxX()const
 	{
-		fprintf(mFile,"\"%s.bmx.bmax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmx.bmax\"");
 	}
 	void getInBoxMaxY()const
 	{
-		fprintf(mFile,"\"%s.bmx.bmay\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmx.bmay\"");
 	}
 	void getInBoxMaxZ()const
 	{
-		fprintf(mFile,"\"%s.bmx.bmaz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmx.bmaz\"");
 	}
 	void getCamera()const
 	{
-		fprintf(mFile,"\"%s.cam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cam\"");
 	}
 	void getCameraX()const
 	{
-		fprintf(mFile,"\"%s.cam.cax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cam.cax\"");
 	}
 	void getCameraY()const
 	{
-		fprintf(mFile,"\"%s.cam.cay\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cam.cay\"");
 	}
 	void getCameraZ()const
 	{
-		fprintf(mFile,"\"%s.cam.caz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cam.caz\"");
 	}
 	void getThreshold(size_t th_i)const
 	{
-		fprintf(mFile,"\"%s.th[%i]\"",mName.c_str(),th_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".th[",th_i,"]\"");
 	}
 	void getThreshold()const
 	{
 
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getActiveLevel()const
 	{
-		fprintf(mFile,"\"%s.al\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al\"");
 	}
 	void getOutLevel(size_t ol_i)const
 	{
-		fprintf(mFile,"\"%s.ol[%i]\"",mName.c_str(),ol_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ol[",ol_i,"]\"");
 	}
 	void getOutLevel()const
 	{
 
-		fprintf(mFile,"\"%s.ol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ol\"");
 	}
 protected:
 	LodThresholds(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
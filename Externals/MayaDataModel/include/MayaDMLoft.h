@@ -27,143 +27,143 @@ public:
 	void setUniform(bool u)
 	{
 		if(u == false) return;
-		fprintf(mFile,"\tsetAttr \".u\" %i;\n", u);
+		writeInt(mFile,"\tsetAttr \".u\" ",u,";\n");
 	}
 	void setClose(bool c)
 	{
 		if(c == false) return;
-		fprintf(mFile,"\tsetAttr \".c\" %i;\n", c);
+		writeInt(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setAutoReverse(bool ar)
 	{
 		if(ar == true) return;
-		fprintf(mFile,"\tsetAttr \".ar\" %i;\n", ar);
+		writeInt(mFile,"\tsetAttr \".ar\" ",ar,";\n");
 	}
 	void setReverse(size_t r_i,bool r)
 	{
 		if(r == false) return;
-		fprintf(mFile,"\tsetAttr \".r[%i]\" %i;\n", r_i,r);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeInt(mFile,"]\" ",r,";\n");
 	}
 	void setReverse(size_t r_start,size_t r_end,bool* r)
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i:%i]\" ", r_start,r_end);
+		writeInt(mFile,"\tsetAttr \".r[",r_start); writeInt(mFile,":",r_end,"]\" ");
 		size_t size = (r_end-r_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",r[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",r[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startReverse(size_t r_start,size_t r_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i:%i]\"",r_start,r_end);
+		writeInt(mFile,"\tsetAttr \".r[",r_start); writeInt(mFile,":",r_end,"]\"");
 	}
 	void appendReverse(bool r)const
 	{
-		fprintf(mFile," %i",r);
+		writeInt(mFile," ",r);
 	}
 	void endReverse()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReverseSurfaceNormals(bool rsn)
 	{
 		if(rsn == false) return;
-		fprintf(mFile,"\tsetAttr \".rsn\" %i;\n", rsn);
+		writeInt(mFile,"\tsetAttr \".rsn\" ",rsn,";\n");
 	}
 	void setSectionSpans(int ss)
 	{
 		if(ss == 1) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %i;\n", ss);
+		writeInt(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setCreateCusp(size_t cc_i,bool cc)
 	{
 		if(cc == false) return;
-		fprintf(mFile,"\tsetAttr \".cc[%i]\" %i;\n", cc_i,cc);
+		writeInt(mFile,"\tsetAttr \".cc[",cc_i); writeInt(mFile,"]\" ",cc,";\n");
 	}
 	void setCreateCusp(size_t cc_start,size_t cc_end,bool* cc)
 	{
-		fprintf(mFile,"\tsetAttr \".cc[%i:%i]\" ", cc_start,cc_end);
+		writeInt(mFile,"\tsetAttr \".cc[",cc_start); writeInt(mFile,":",cc_end,"]\" ");
 		size_t size = (cc_end-cc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",cc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",cc[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCreateCusp(size_t cc_start,size_t cc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cc[%i:%i]\"",cc_start,cc_end);
+		writeInt(mFile,"\tsetAttr \".cc[",cc_start); writeInt(mFile,":",cc_end,"]\"");
 	}
 	void appendCreateCusp(bool cc)const
 	{
-		fprintf(mFile," %i",cc);
+		writeInt(mFile," ",cc);
 	}
 	void endCreateCusp()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputCurve(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i]\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"]\"");
 	}
 	void getInputCurve()const
 	{
 
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getUniform()const
 	{
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getClose()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getAutoReverse()const
 	{
-		fprintf(mFile,"\"%s.ar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ar\"");
 	}
 	void getReverse(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i]\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"]\"");
 	}
 	void getReverse()const
 	{
 
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getReverseSurfaceNormals()const
 	{
-		fprintf(mFile,"\"%s.rsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsn\"");
 	}
 	void getSectionSpans()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getCreateCusp(size_t cc_i)const
 	{
-		fprintf(mFile,"\"%s.cc[%i]\"",mName.c_str(),cc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cc[",cc_i,"]\"");
 	}
 	void getCreateCusp()const
 	{
 
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 protected:
 	Loft(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setDistanceBetween(double db)
 	{
 		if(db == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".db\" %f;\n", db);
+		writeFloat(mFile,"\tsetAttr \".db\" ",db,";\n");
 	}
 	void setTwist(double tws)
 	{
 		if(tws == 0) return;
-		fprintf(mFile,"\tsetAttr \".tws\" %f;\n", tws);
+		writeFloat(mFile,"\tsetAttr \".tws\" ",tws,";\n");
 	}
 	void setDisplayConnector(bool dc)
 	{
 		if(dc == true) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %i;\n", dc);
+		writeInt(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void getDistanceBetween()const
 	{
-		fprintf(mFile,"\"%s.db\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".db\"");
 	}
 	void getTwist()const
 	{
-		fprintf(mFile,"\"%s.tws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tws\"");
 	}
 	void getDisplayConnector()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 protected:
 	LookAt(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,44 +27,44 @@ public:
 	void setValue(const float3& v)
 	{
 		if(v == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".v\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".v\" -type \"float3\" ");
 		v.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setValueR(float vr)
 	{
 		if(vr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vr\" %f;\n", vr);
+		writeFloat(mFile,"\tsetAttr \".v.vr\" ",vr,";\n");
 	}
 	void setValueG(float vg)
 	{
 		if(vg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vg\" %f;\n", vg);
+		writeFloat(mFile,"\tsetAttr \".v.vg\" ",vg,";\n");
 	}
 	void setValueB(float vb)
 	{
 		if(vb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vb\" %f;\n", vb);
+		writeFloat(mFile,"\tsetAttr \".v.vb\" ",vb,";\n");
 	}
 	void getValue()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getValueR()const
 	{
-		fprintf(mFile,"\"%s.v.vr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vr\"");
 	}
 	void getValueG()const
 	{
-		fprintf(mFile,"\"%s.v.vg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vg\"");
 	}
 	void getValueB()const
 	{
-		fprintf(mFile,"\"%s.v.vb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vb\"");
 	}
 	void getOutValue()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	Luminance(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,60 +27,60 @@ public:
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSections(int s)
 	{
 		if(s == 8) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSections()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getCenter()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getCenterX()const
 	{
-		fprintf(mFile,"\"%s.c.cx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cx\"");
 	}
 	void getCenterY()const
 	{
-		fprintf(mFile,"\"%s.c.cy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cy\"");
 	}
 	void getCenterZ()const
 	{
-		fprintf(mFile,"\"%s.c.cz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cz\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.nr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.nr.nrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nrx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.nr.nry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nry\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.nr.nrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nrz\"");
 	}
 	void getSweep()const
 	{
-		fprintf(mFile,"\"%s.sw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sw\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	MakeCircularArc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,49 +27,49 @@ public:
 	void setGroupType(unsigned int gt)
 	{
 		if(gt == 0) return;
-		fprintf(mFile,"\tsetAttr \".gt\" %i;\n", gt);
+		writeInt(mFile,"\tsetAttr \".gt\" ",gt,";\n");
 	}
 	void setGroupName(int gn)
 	{
 		if(gn == -1) return;
-		fprintf(mFile,"\tsetAttr \".gn\" %i;\n", gn);
+		writeInt(mFile,"\tsetAttr \".gn\" ",gn,";\n");
 	}
 	void setElemList(const intArray& el)
 	{
 		if(el.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".el\" -type \"intArray\" ");
+		writeString(mFile,"\tsetAttr \".el\" -type \"intArray\" ");
 		el.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputComponents(const componentList& ic)
 	{
-		fprintf(mFile,"\tsetAttr \".ic\" -type \"componentList\" ");
+		writeString(mFile,"\tsetAttr \".ic\" -type \"componentList\" ");
 		ic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ig\"");
 	}
 	void getOutputGeometry()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 	void getGroupType()const
 	{
-		fprintf(mFile,"\"%s.gt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gt\"");
 	}
 	void getGroupName()const
 	{
-		fprintf(mFile,"\"%s.gn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gn\"");
 	}
 	void getElemList()const
 	{
-		fprintf(mFile,"\"%s.el\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".el\"");
 	}
 	void getInputComponents()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 protected:
 	MakeGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,89 +27,89 @@ public:
 	void setIllustratorFilename(const string& ifn)
 	{
 		if(ifn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ifn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ifn\" -type \"string\" ");
 		ifn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScaleFactor(float sf)
 	{
 		if(sf == 1.0f) return;
-		fprintf(mFile,"\tsetAttr \".sf\" %f;\n", sf);
+		writeFloat(mFile,"\tsetAttr \".sf\" ",sf,";\n");
 	}
 	void setTolerance(float tl)
 	{
 		if(tl == 0.001f) return;
-		fprintf(mFile,"\tsetAttr \".tl\" %f;\n", tl);
+		writeFloat(mFile,"\tsetAttr \".tl\" ",tl,";\n");
 	}
 	void getIllustratorFilename()const
 	{
-		fprintf(mFile,"\"%s.ifn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ifn\"");
 	}
 	void getScaleFactor()const
 	{
-		fprintf(mFile,"\"%s.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sf\"");
 	}
 	void getReload()const
 	{
-		fprintf(mFile,"\"%s.rl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rl\"");
 	}
 	void getOutputCurves(size_t oc_i)const
 	{
-		fprintf(mFile,"\"%s.oc[%i]\"",mName.c_str(),oc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oc[",oc_i,"]\"");
 	}
 	void getOutputCurves()const
 	{
 
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getCount(size_t c_i)const
 	{
-		fprintf(mFile,"\"%s.c[%i]\"",mName.c_str(),c_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".c[",c_i,"]\"");
 	}
 	void getCount()const
 	{
 
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getPosition(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getPosition()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPositionX(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].px\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].px\"");
 	}
 	void getPositionX()const
 	{
 
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPositionY(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].py\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].py\"");
 	}
 	void getPositionY()const
 	{
 
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPositionZ(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].pz\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].pz\"");
 	}
 	void getPositionZ()const
 	{
 
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tl\"");
 	}
 protected:
 	MakeIllustratorCurves(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,181 +26,181 @@ public:
 
 	void setFirst(const double3& fp)
 	{
-		fprintf(mFile,"\tsetAttr \".fp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".fp\" -type \"double3\" ");
 		fp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFirstPointX(double fpx)
 	{
 		if(fpx == 1) return;
-		fprintf(mFile,"\tsetAttr \".fp.fpx\" %f;\n", fpx);
+		writeFloat(mFile,"\tsetAttr \".fp.fpx\" ",fpx,";\n");
 	}
 	void setFirstPointY(double fpy)
 	{
 		if(fpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".fp.fpy\" %f;\n", fpy);
+		writeFloat(mFile,"\tsetAttr \".fp.fpy\" ",fpy,";\n");
 	}
 	void setFirstPointZ(double fpz)
 	{
 		if(fpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".fp.fpz\" %f;\n", fpz);
+		writeFloat(mFile,"\tsetAttr \".fp.fpz\" ",fpz,";\n");
 	}
 	void setNormal(const double3& nr)
 	{
-		fprintf(mFile,"\tsetAttr \".nr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".nr\" -type \"double3\" ");
 		nr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNormalX(double nrx)
 	{
 		if(nrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".nr.nrx\" %f;\n", nrx);
+		writeFloat(mFile,"\tsetAttr \".nr.nrx\" ",nrx,";\n");
 	}
 	void setNormalY(double nry)
 	{
 		if(nry == 0) return;
-		fprintf(mFile,"\tsetAttr \".nr.nry\" %f;\n", nry);
+		writeFloat(mFile,"\tsetAttr \".nr.nry\" ",nry,";\n");
 	}
 	void setNormalZ(double nrz)
 	{
 		if(nrz == 1) return;
-		fprintf(mFile,"\tsetAttr \".nr.nrz\" %f;\n", nrz);
+		writeFloat(mFile,"\tsetAttr \".nr.nrz\" ",nrz,";\n");
 	}
 	void setCenter(const double3& c)
 	{
-		fprintf(mFile,"\tsetAttr \".c\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"double3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCenterX(double cx)
 	{
 		if(cx == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cx\" %f;\n", cx);
+		writeFloat(mFile,"\tsetAttr \".c.cx\" ",cx,";\n");
 	}
 	void setCenterY(double cy)
 	{
 		if(cy == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cy\" %f;\n", cy);
+		writeFloat(mFile,"\tsetAttr \".c.cy\" ",cy,";\n");
 	}
 	void setCenterZ(double cz)
 	{
 		if(cz == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cz\" %f;\n", cz);
+		writeFloat(mFile,"\tsetAttr \".c.cz\" ",cz,";\n");
 	}
 	void setRadius(double r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setSweep(double sw)
 	{
 		if(sw == 6.2831853) return;
-		fprintf(mFile,"\tsetAttr \".sw\" %f;\n", sw);
+		writeFloat(mFile,"\tsetAttr \".sw\" ",sw,";\n");
 	}
 	void setUseTolerance(bool ut)
 	{
 		if(ut == false) return;
-		fprintf(mFile,"\tsetAttr \".ut\" %i;\n", ut);
+		writeInt(mFile,"\tsetAttr \".ut\" ",ut,";\n");
 	}
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSections(int s)
 	{
 		if(s == 8) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setFixCenter(bool fc)
 	{
 		if(fc == true) return;
-		fprintf(mFile,"\tsetAttr \".fc\" %i;\n", fc);
+		writeInt(mFile,"\tsetAttr \".fc\" ",fc,";\n");
 	}
 	void getFirst()const
 	{
-		fprintf(mFile,"\"%s.fp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp\"");
 	}
 	void getFirstPointX()const
 	{
-		fprintf(mFile,"\"%s.fp.fpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp.fpx\"");
 	}
 	void getFirstPointY()const
 	{
-		fprintf(mFile,"\"%s.fp.fpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp.fpy\"");
 	}
 	void getFirstPointZ()const
 	{
-		fprintf(mFile,"\"%s.fp.fpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp.fpz\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.nr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.nr.nrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nrx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.nr.nry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nry\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.nr.nrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nrz\"");
 	}
 	void getCenter()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getCenterX()const
 	{
-		fprintf(mFile,"\"%s.c.cx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cx\"");
 	}
 	void getCenterY()const
 	{
-		fprintf(mFile,"\"%s.c.cy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cy\"");
 	}
 	void getCenterZ()const
 	{
-		fprintf(mFile,"\"%s.c.cz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cz\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getSweep()const
 	{
-		fprintf(mFile,"\"%s.sw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sw\"");
 	}
 	void getUseTolerance()const
 	{
-		fprintf(mFile,"\"%s.ut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ut\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSections()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getFixCenter()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	MakeNurbCircle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
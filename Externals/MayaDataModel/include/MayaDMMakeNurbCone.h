@@ -27,11 +27,11 @@ public:
 	void setUseOldInitBehaviour(bool oib)
 	{
 		if(oib == false) return;
-		fprintf(mFile,"\tsetAttr \".oib\" %i;\n", oib);
+		writeInt(mFile,"\tsetAttr \".oib\" ",oib,";\n");
 	}
 	void getUseOldInitBehaviour()const
 	{
-		fprintf(mFile,"\"%s.oib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oib\"");
 	}
 protected:
 	MakeNurbCone(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,76 +27,76 @@ public:
 	void setWidth(double w)
 	{
 		if(w == 1) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setLengthRatio(double lr)
 	{
 		if(lr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lr\" %f;\n", lr);
+		writeFloat(mFile,"\tsetAttr \".lr\" ",lr,";\n");
 	}
 	void setHeightRatio(double hr)
 	{
 		if(hr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hr\" %f;\n", hr);
+		writeFloat(mFile,"\tsetAttr \".hr\" ",hr,";\n");
 	}
 	void setPatchesU(int u)
 	{
 		if(u == 1) return;
-		fprintf(mFile,"\tsetAttr \".u\" %i;\n", u);
+		writeInt(mFile,"\tsetAttr \".u\" ",u,";\n");
 	}
 	void setPatchesV(int v)
 	{
 		if(v == 1) return;
-		fprintf(mFile,"\tsetAttr \".v\" %i;\n", v);
+		writeInt(mFile,"\tsetAttr \".v\" ",v,";\n");
 	}
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void getWidth()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getLengthRatio()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.hr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hr\"");
 	}
 	void getPatchesU()const
 	{
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getPatchesV()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getOutputSurface1()const
 	{
-		fprintf(mFile,"\"%s.os1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os1\"");
 	}
 	void getOutputSurface2()const
 	{
-		fprintf(mFile,"\"%s.os2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os2\"");
 	}
 	void getOutputSurface3()const
 	{
-		fprintf(mFile,"\"%s.os3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os3\"");
 	}
 	void getOutputSurface4()const
 	{
-		fprintf(mFile,"\"%s.os4\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os4\"");
 	}
 	void getOutputSurface5()const
 	{
-		fprintf(mFile,"\"%s.os5\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os5\"");
 	}
 protected:
 	MakeNurbCube(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,47 +27,47 @@ public:
 	void setWidth(double w)
 	{
 		if(w == 1) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setLengthRatio(double lr)
 	{
 		if(lr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lr\" %f;\n", lr);
+		writeFloat(mFile,"\tsetAttr \".lr\" ",lr,";\n");
 	}
 	void setPatchesU(int u)
 	{
 		if(u == 1) return;
-		fprintf(mFile,"\tsetAttr \".u\" %i;\n", u);
+		writeInt(mFile,"\tsetAttr \".u\" ",u,";\n");
 	}
 	void setPatchesV(int v)
 	{
 		if(v == 1) return;
-		fprintf(mFile,"\tsetAttr \".v\" %i;\n", v);
+		writeInt(mFile,"\tsetAttr \".v\" ",v,";\n");
 	}
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void getWidth()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getLengthRatio()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getPatchesU()const
 	{
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getPatchesV()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 protected:
 	MakeNurbPlane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
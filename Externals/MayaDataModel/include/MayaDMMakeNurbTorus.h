@@ -27,11 +27,11 @@ public:
 	void setMinorSweep(double msw)
 	{
 		if(msw == 6.2831853) return;
-		fprintf(mFile,"\tsetAttr \".msw\" %f;\n", msw);
+		writeFloat(mFile,"\tsetAttr \".msw\" ",msw,";\n");
 	}
 	void getMinorSweep()const
 	{
-		fprintf(mFile,"\"%s.msw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msw\"");
 	}
 protected:
 	MakeNurbTorus(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
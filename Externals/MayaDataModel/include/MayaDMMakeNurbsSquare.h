@@ -26,129 +26,129 @@ public:
 
 	void setNormal(const double3& nr)
 	{
-		fprintf(mFile,"\tsetAttr \".nr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".nr\" -type \"double3\" ");
 		nr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNormalX(double nrx)
 	{
 		if(nrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".nr.nrx\" %f;\n", nrx);
+		writeFloat(mFile,"\tsetAttr \".nr.nrx\" ",nrx,";\n");
 	}
 	void setNormalY(double nry)
 	{
 		if(nry == 0) return;
-		fprintf(mFile,"\tsetAttr \".nr.nry\" %f;\n", nry);
+		writeFloat(mFile,"\tsetAttr \".nr.nry\" ",nry,";\n");
 	}
 	void setNormalZ(double nrz)
 	{
 		if(nrz == 1) return;
-		fprintf(mFile,"\tsetAttr \".nr.nrz\" %f;\n", nrz);
+		writeFloat(mFile,"\tsetAttr \".nr.nrz\" ",nrz,";\n");
 	}
 	void setCenter(const double3& c)
 	{
-		fprintf(mFile,"\tsetAttr \".c\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"double3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCenterX(double cx)
 	{
 		if(cx == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cx\" %f;\n", cx);
+		writeFloat(mFile,"\tsetAttr \".c.cx\" ",cx,";\n");
 	}
 	void setCenterY(double cy)
 	{
 		if(cy == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cy\" %f;\n", cy);
+		writeFloat(mFile,"\tsetAttr \".c.cy\" ",cy,";\n");
 	}
 	void setCenterZ(double cz)
 	{
 		if(cz == 0) return;
-		fprintf(mFile,"\tsetAttr \".c.cz\" %f;\n", cz);
+		writeFloat(mFile,"\tsetAttr \".c.cz\" ",cz,";\n");
 	}
 	void setSideLength1(double sl1)
 	{
 		if(sl1 == 1) return;
-		fprintf(mFile,"\tsetAttr \".sl1\" %f;\n", sl1);
+		writeFloat(mFile,"\tsetAttr \".sl1\" ",sl1,";\n");
 	}
 	void setSideLength2(double sl2)
 	{
 		if(sl2 == 1) return;
-		fprintf(mFile,"\tsetAttr \".sl2\" %f;\n", sl2);
+		writeFloat(mFile,"\tsetAttr \".sl2\" ",sl2,";\n");
 	}
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSpansPerSide(int sps)
 	{
 		if(sps == 1) return;
-		fprintf(mFile,"\tsetAttr \".sps\" %i;\n", sps);
+		writeInt(mFile,"\tsetAttr \".sps\" ",sps,";\n");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.nr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.nr.nrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nrx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.nr.nry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nry\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.nr.nrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nrz\"");
 	}
 	void getCenter()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getCenterX()const
 	{
-		fprintf(mFile,"\"%s.c.cx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cx\"");
 	}
 	void getCenterY()const
 	{
-		fprintf(mFile,"\"%s.c.cy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cy\"");
 	}
 	void getCenterZ()const
 	{
-		fprintf(mFile,"\"%s.c.cz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cz\"");
 	}
 	void getSideLength1()const
 	{
-		fprintf(mFile,"\"%s.sl1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sl1\"");
 	}
 	void getSideLength2()const
 	{
-		fprintf(mFile,"\"%s.sl2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sl2\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSpansPerSide()const
 	{
-		fprintf(mFile,"\"%s.sps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sps\"");
 	}
 	void getOutputCurve1()const
 	{
-		fprintf(mFile,"\"%s.oc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc1\"");
 	}
 	void getOutputCurve2()const
 	{
-		fprintf(mFile,"\"%s.oc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc2\"");
 	}
 	void getOutputCurve3()const
 	{
-		fprintf(mFile,"\"%s.oc3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc3\"");
 	}
 	void getOutputCurve4()const
 	{
-		fprintf(mFile,"\"%s.oc4\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc4\"");
 	}
 protected:
 	MakeNurbsSquare(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,78 +27,78 @@ public:
 	void setText(const string& t)
 	{
 		if(t == "Maya") return;
-		fprintf(mFile,"\tsetAttr \".t\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"string\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFont(const string& f)
 	{
 		if(f == "Times-Roman") return;
-		fprintf(mFile,"\tsetAttr \".f\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".f\" -type \"string\" ");
 		f.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getText()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getFont()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getOutputCurve(size_t oc_i)const
 	{
-		fprintf(mFile,"\"%s.oc[%i]\"",mName.c_str(),oc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oc[",oc_i,"]\"");
 	}
 	void getOutputCurve()const
 	{
 
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getPosition(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getPosition()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPositionX(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].px\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].px\"");
 	}
 	void getPositionX()const
 	{
 
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPositionY(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].py\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].py\"");
 	}
 	void getPositionY()const
 	{
 
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPositionZ(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].pz\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].pz\"");
 	}
 	void getPositionZ()const
 	{
 
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getCount(size_t c_i)const
 	{
-		fprintf(mFile,"\"%s.c[%i]\"",mName.c_str(),c_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".c[",c_i,"]\"");
 	}
 	void getCount()const
 	{
 
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 protected:
 	MakeTextCurves(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,118 +26,118 @@ public:
 
 	void setPoint1(const double3& pt1)
 	{
-		fprintf(mFile,"\tsetAttr \".pt1\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pt1\" -type \"double3\" ");
 		pt1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoint1X(double p1x)
 	{
 		if(p1x == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt1.p1x\" %f;\n", p1x);
+		writeFloat(mFile,"\tsetAttr \".pt1.p1x\" ",p1x,";\n");
 	}
 	void setPoint1Y(double p1y)
 	{
 		if(p1y == 1) return;
-		fprintf(mFile,"\tsetAttr \".pt1.p1y\" %f;\n", p1y);
+		writeFloat(mFile,"\tsetAttr \".pt1.p1y\" ",p1y,";\n");
 	}
 	void setPoint1Z(double p1z)
 	{
 		if(p1z == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt1.p1z\" %f;\n", p1z);
+		writeFloat(mFile,"\tsetAttr \".pt1.p1z\" ",p1z,";\n");
 	}
 	void setPoint2(const double3& pt2)
 	{
-		fprintf(mFile,"\tsetAttr \".pt2\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pt2\" -type \"double3\" ");
 		pt2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoint2X(double p2x)
 	{
 		if(p2x == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt2.p2x\" %f;\n", p2x);
+		writeFloat(mFile,"\tsetAttr \".pt2.p2x\" ",p2x,";\n");
 	}
 	void setPoint2Y(double p2y)
 	{
 		if(p2y == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt2.p2y\" %f;\n", p2y);
+		writeFloat(mFile,"\tsetAttr \".pt2.p2y\" ",p2y,";\n");
 	}
 	void setPoint2Z(double p2z)
 	{
 		if(p2z == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt2.p2z\" %f;\n", p2z);
+		writeFloat(mFile,"\tsetAttr \".pt2.p2z\" ",p2z,";\n");
 	}
 	void setPoint3(const double3& pt3)
 	{
-		fprintf(mFile,"\tsetAttr \".pt3\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pt3\" -type \"double3\" ");
 		pt3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoint3X(double p3x)
 	{
 		if(p3x == 1) return;
-		fprintf(mFile,"\tsetAttr \".pt3.p3x\" %f;\n", p3x);
+		writeFloat(mFile,"\tsetAttr \".pt3.p3x\" ",p3x,";\n");
 	}
 	void setPoint3Y(double p3y)
 	{
 		if(p3y == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt3.p3y\" %f;\n", p3y);
+		writeFloat(mFile,"\tsetAttr \".pt3.p3y\" ",p3y,";\n");
 	}
 	void setPoint3Z(double p3z)
 	{
 		if(p3z == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt3.p3z\" %f;\n", p3z);
+		writeFloat(mFile,"\tsetAttr \".pt3.p3z\" ",p3z,";\n");
 	}
 	void getPoint1()const
 	{
-		fprintf(mFile,"\"%s.pt1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt1\"");
 	}
 	void getPoint1X()const
 	{
-		fprintf(mFile,"\"%s.pt1.p1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt1.p1x\"");
 	}
 	void getPoint1Y()const
 	{
-		fprintf(mFile,"\"%s.pt1.p1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt1.p1y\"");
 	}
 	void getPoint1Z()const
 	{
-		fprintf(mFile,"\"%s.pt1.p1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt1.p1z\"");
 	}
 	void getPoint2()const
 	{
-		fprintf(mFile,"\"%s.pt2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt2\"");
 	}
 	void getPoint2X()const
 	{
-		fprintf(mFile,"\"%s.pt2.p2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt2.p2x\"");
 	}
 	void getPoint2Y()const
 	{
-		fprintf(mFile,"\"%s.pt2.p2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt2.p2y\"");
 	}
 	void getPoint2Z()const
 	{
-		fprintf(mFile,"\"%s.pt2.p2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt2.p2z\"");
 	}
 	void getPoint3()const
 	{
-		fprintf(mFile,"\"%s.pt3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt3\"");
 	}
 	void getPoint3X()const
 	{
-		fprintf(mFile,"\"%s.pt3.p3x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt3.p3x\"");
 	}
 	void getPoint3Y()const
 	{
-		fprintf(mFile,"\"%s.pt3.p3y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt3.p3y\"");
 	}
 	void getPoint3Z()const
 	{
-		fprintf(mFile,"\"%s.pt3.p3z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt3.p3z\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 protected:
 	MakeThreePointCircularArc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
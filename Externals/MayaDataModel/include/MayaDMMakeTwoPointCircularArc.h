@@ -26,132 +26,132 @@ public:
 
 	void setPoint1(const double3& pt1)
 	{
-		fprintf(mFile,"\tsetAttr \".pt1\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pt1\" -type \"double3\" ");
 		pt1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoint1X(double p1x)
 	{
 		if(p1x == 1) return;
-		fprintf(mFile,"\tsetAttr \".pt1.p1x\" %f;\n", p1x);
+		writeFloat(mFile,"\tsetAttr \".pt1.p1x\" ",p1x,";\n");
 	}
 	void setPoint1Y(double p1y)
 	{
 		if(p1y == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt1.p1y\" %f;\n", p1y);
+		writeFloat(mFile,"\tsetAttr \".pt1.p1y\" ",p1y,";\n");
 	}
 	void setPoint1Z(double p1z)
 	{
 		if(p1z == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt1.p1z\" %f;\n", p1z);
+		writeFloat(mFile,"\tsetAttr \".pt1.p1z\" ",p1z,";\n");
 	}
 	void setPoint2(const double3& pt2)
 	{
-		fprintf(mFile,"\tsetAttr \".pt2\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pt2\" -type \"double3\" ");
 		pt2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPoint2X(double p2x)
 	{
 		if(p2x == 1) return;
-		fprintf(mFile,"\tsetAttr \".pt2.p2x\" %f;\n", p2x);
+		writeFloat(mFile,"\tsetAttr \".pt2.p2x\" ",p2x,";\n");
 	}
 	void setPoint2Y(double p2y)
 	{
 		if(p2y == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt2.p2y\" %f;\n", p2y);
+		writeFloat(mFile,"\tsetAttr \".pt2.p2y\" ",p2y,";\n");
 	}
 	void setPoint2Z(double p2z)
 	{
 		if(p2z == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt2.p2z\" %f;\n", p2z);
+		writeFloat(mFile,"\tsetAttr \".pt2.p2z\" ",p2z,";\n");
 	}
 	void setDirectionVector(const double3& dv)
 	{
-		fprintf(mFile,"\tsetAttr \".dv\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".dv\" -type \"double3\" ");
 		dv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionVectorX(double dvx)
 	{
 		if(dvx == 0) return;
-		fprintf(mFile,"\tsetAttr \".dv.dvx\" %f;\n", dvx);
+		writeFloat(mFile,"\tsetAttr \".dv.dvx\" ",dvx,";\n");
 	}
 	void setDirectionVectorY(double dvy)
 	{
 		if(dvy == 0) return;
-		fprintf(mFile,"\tsetAttr \".dv.dvy\" %f;\n", dvy);
+		writeFloat(mFile,"\tsetAttr \".dv.dvy\" ",dvy,";\n");
 	}
 	void setDirectionVectorZ(double dvz)
 	{
 		if(dvz == 1) return;
-		fprintf(mFile,"\tsetAttr \".dv.dvz\" %f;\n", dvz);
+		writeFloat(mFile,"\tsetAttr \".dv.dvz\" ",dvz,";\n");
 	}
 	void setRadius(double r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setToggleArc(bool tac)
 	{
 		if(tac == false) return;
-		fprintf(mFile,"\tsetAttr \".tac\" %i;\n", tac);
+		writeInt(mFile,"\tsetAttr \".tac\" ",tac,";\n");
 	}
 	void getPoint1()const
 	{
-		fprintf(mFile,"\"%s.pt1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt1\"");
 	}
 	void getPoint1X()const
 	{
-		fprintf(mFile,"\"%s.pt1.p1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt1.p1x\"");
 	}
 	void getPoint1Y()const
 	{
-		fprintf(mFile,"\"%s.pt1.p1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt1.p1y\"");
 	}
 	void getPoint1Z()const
 	{
-		fprintf(mFile,"\"%s.pt1.p1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt1.p1z\"");
 	}
 	void getPoint2()const
 	{
-		fprintf(mFile,"\"%s.pt2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt2\"");
 	}
 	void getPoint2X()const
 	{
-		fprintf(mFile,"\"%s.pt2.p2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt2.p2x\"");
 	}
 	void getPoint2Y()const
 	{
-		fprintf(mFile,"\"%s.pt2.p2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt2.p2y\"");
 	}
 	void getPoint2Z()const
 	{
-		fprintf(mFile,"\"%s.pt2.p2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt2.p2z\"");
 	}
 	void getDirectionVector()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getDirectionVectorX()const
 	{
-		fprintf(mFile,"\"%s.dv.dvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv.dvx\"");
 	}
 	void getDirectionVectorY()const
 	{
-		fprintf(mFile,"\"%s.dv.dvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv.dvy\"");
 	}
 	void getDirectionVectorZ()const
 	{
-		fprintf(mFile,"\"%s.dv.dvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv.dvz\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getToggleArc()const
 	{
-		fprintf(mFile,"\"%s.tac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tac\"");
 	}
 protected:
 	MakeTwoPointCircularArc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
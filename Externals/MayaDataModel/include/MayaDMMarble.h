@@ -27,247 +27,247 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setFillerColor(const float3& fc)
 	{
 		if(fc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFillerColorR(float fcr)
 	{
 		if(fcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fc.fcr\" ",fcr,";\n");
 	}
 	void setFillerColorG(float fcg)
 	{
 		if(fcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcg\" %f;\n", fcg);
+		writeFloat(mFile,"\tsetAttr \".fc.fcg\" ",fcg,";\n");
 	}
 	void setFillerColorB(float fcb)
 	{
 		if(fcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcb\" %f;\n", fcb);
+		writeFloat(mFile,"\tsetAttr \".fc.fcb\" ",fcb,";\n");
 	}
 	void setVeinColor(const float3& vc)
 	{
 		if(vc == float3(0.298f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".vc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc\" -type \"float3\" ");
 		vc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVeinColorR(float vcr)
 	{
 		if(vcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcr\" %f;\n", vcr);
+		writeFloat(mFile,"\tsetAttr \".vc.vcr\" ",vcr,";\n");
 	}
 	void setVeinColorG(float vcg)
 	{
 		if(vcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcg\" %f;\n", vcg);
+		writeFloat(mFile,"\tsetAttr \".vc.vcg\" ",vcg,";\n");
 	}
 	void setVeinColorB(float vcb)
 	{
 		if(vcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcb\" %f;\n", vcb);
+		writeFloat(mFile,"\tsetAttr \".vc.vcb\" ",vcb,";\n");
 	}
 	void setVeinWidth(float vw)
 	{
 		if(vw == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".vw\" %f;\n", vw);
+		writeFloat(mFile,"\tsetAttr \".vw\" ",vw,";\n");
 	}
 	void setDiffusion(float di)
 	{
 		if(di == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".di\" %f;\n", di);
+		writeFloat(mFile,"\tsetAttr \".di\" ",di,";\n");
 	}
 	void setContrast(float c)
 	{
 		if(c == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".c\" %f;\n", c);
+		writeFloat(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setRipples(const float3& r)
 	{
 		if(r == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".r\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".r\" -type \"float3\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRipplesX(float rx)
 	{
 		if(rx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".r.rx\" ",rx,";\n");
 	}
 	void setRipplesY(float ry)
 	{
 		if(ry == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".r.ry\" ",ry,";\n");
 	}
 	void setRipplesZ(float rz)
 	{
 		if(rz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".r.rz\" ",rz,";\n");
 	}
 	void setDepth(const float2& d)
 	{
 		if(d == float2(0.0f,20.0f)) return;
-		fprintf(mFile,"\tsetAttr \".d\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"float2\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDepthMin(float dmn)
 	{
 		if(dmn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmn\" %f;\n", dmn);
+		writeFloat(mFile,"\tsetAttr \".d.dmn\" ",dmn,";\n");
 	}
 	void setDepthMax(float dmx)
 	{
 		if(dmx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmx\" %f;\n", dmx);
+		writeFloat(mFile,"\tsetAttr \".d.dmx\" ",dmx,";\n");
 	}
 	void setAmplitude(float a)
 	{
 		if(a == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getFillerColor()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFillerColorR()const
 	{
-		fprintf(mFile,"\"%s.fc.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcr\"");
 	}
 	void getFillerColorG()const
 	{
-		fprintf(mFile,"\"%s.fc.fcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcg\"");
 	}
 	void getFillerColorB()const
 	{
-		fprintf(mFile,"\"%s.fc.fcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcb\"");
 	}
 	void getVeinColor()const
 	{
-		fprintf(mFile,"\"%s.vc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc\"");
 	}
 	void getVeinColorR()const
 	{
-		fprintf(mFile,"\"%s.vc.vcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcr\"");
 	}
 	void getVeinColorG()const
 	{
-		fprintf(mFile,"\"%s.vc.vcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcg\"");
 	}
 	void getVeinColorB()const
 	{
-		fprintf(mFile,"\"%s.vc.vcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcb\"");
 	}
 	void getVeinWidth()const
 	{
-		fprintf(mFile,"\"%s.vw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vw\"");
 	}
 	void getDiffusion()const
 	{
-		fprintf(mFile,"\"%s.di\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".di\"");
 	}
 	void getContrast()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getRipples()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRipplesX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRipplesY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRipplesZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDepthMin()const
 	{
-		fprintf(mFile,"\"%s.d.dmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmn\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.d.dmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmx\"");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 protected:
 	Marble(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
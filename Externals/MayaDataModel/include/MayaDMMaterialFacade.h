@@ -27,55 +27,55 @@ public:
 	void setProxyInitProc(const string& pip)
 	{
 		if(pip == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".pip\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".pip\" -type \"string\" ");
 		pip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutColor(const float3& oc)
 	{
 		if(oc == float3(1.0f,0.6f,0.4f)) return;
-		fprintf(mFile,"\tsetAttr \".oc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".oc\" -type \"float3\" ");
 		oc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutColorR(float ocr)
 	{
 		if(ocr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocr\" %f;\n", ocr);
+		writeFloat(mFile,"\tsetAttr \".oc.ocr\" ",ocr,";\n");
 	}
 	void setOutColorG(float ocg)
 	{
 		if(ocg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocg\" %f;\n", ocg);
+		writeFloat(mFile,"\tsetAttr \".oc.ocg\" ",ocg,";\n");
 	}
 	void setOutColorB(float ocb)
 	{
 		if(ocb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocb\" %f;\n", ocb);
+		writeFloat(mFile,"\tsetAttr \".oc.ocb\" ",ocb,";\n");
 	}
 	void getHardwareProxy()const
 	{
-		fprintf(mFile,"\"%s.hp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hp\"");
 	}
 	void getProxyInitProc()const
 	{
-		fprintf(mFile,"\"%s.pip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pip\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 protected:
 	MaterialFacade(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,36 +27,36 @@ public:
 	void setTextureFilter(unsigned int tmip)
 	{
 		if(tmip == 0) return;
-		fprintf(mFile,"\tsetAttr \".tmip\" %i;\n", tmip);
+		writeInt(mFile,"\tsetAttr \".tmip\" ",tmip,";\n");
 	}
 	void getShadingGroup()const
 	{
-		fprintf(mFile,"\"%s.sg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sg\"");
 	}
 	void getMaterial()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getTexture(size_t t_i)const
 	{
-		fprintf(mFile,"\"%s.t[%i]\"",mName.c_str(),t_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".t[",t_i,"]\"");
 	}
 	void getTexture()const
 	{
 
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTextureChannel()const
 	{
-		fprintf(mFile,"\"%s.tc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc\"");
 	}
 	void getTexturePlug()const
 	{
-		fprintf(mFile,"\"%s.tp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp\"");
 	}
 	void getTextureFilter()const
 	{
-		fprintf(mFile,"\"%s.tmip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmip\"");
 	}
 protected:
 	MaterialInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -64,709 +64,709 @@ public:
 	void setMapping(unsigned int map)
 	{
 		if(map == 0) return;
-		fprintf(mFile,"\tsetAttr \".map\" %i;\n", map);
+		writeInt(mFile,"\tsetAttr \".map\" ",map,";\n");
 	}
 	void setType(unsigned int typ)
 	{
 		if(typ == 0) return;
-		fprintf(mFile,"\tsetAttr \".typ\" %i;\n", typ);
+		writeInt(mFile,"\tsetAttr \".typ\" ",typ,";\n");
 	}
 	void setTexture(const string& tx)
 	{
 		if(tx == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".tx\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".tx\" -type \"string\" ");
 		tx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseFrameExtension(bool ufe)
 	{
 		if(ufe == false) return;
-		fprintf(mFile,"\tsetAttr \".ufe\" %i;\n", ufe);
+		writeInt(mFile,"\tsetAttr \".ufe\" ",ufe,";\n");
 	}
 	void setFrameExtension(int fe)
 	{
 		if(fe == 1) return;
-		fprintf(mFile,"\tsetAttr \".fe\" %i;\n", fe);
+		writeInt(mFile,"\tsetAttr \".fe\" ",fe,";\n");
 	}
 	void setColor(const float3& col)
 	{
 		if(col == float3(0,0,0)) return;
-		fprintf(mFile,"\tsetAttr \".col\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".col\" -type \"float3\" ");
 		col.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float colr)
 	{
 		if(colr == 0) return;
-		fprintf(mFile,"\tsetAttr \".col.colr\" %f;\n", colr);
+		writeFloat(mFile,"\tsetAttr \".col.colr\" ",colr,";\n");
 	}
 	void setColorG(float colg)
 	{
 		if(colg == 0) return;
-		fprintf(mFile,"\tsetAttr \".col.colg\" %f;\n", colg);
+		writeFloat(mFile,"\tsetAttr \".col.colg\" ",colg,";\n");
 	}
 	void setColorB(float colb)
 	{
 		if(colb == 0) return;
-		fprintf(mFile,"\tsetAttr \".col.colb\" %f;\n", colb);
+		writeFloat(mFile,"\tsetAttr \".col.colb\" ",colb,";\n");
 	}
 	void setHardwareFilter(unsigned int hwf)
 	{
 		if(hwf == 0) return;
-		fprintf(mFile,"\tsetAttr \".hwf\" %i;\n", hwf);
+		writeInt(mFile,"\tsetAttr \".hwf\" ",hwf,";\n");
 	}
 	void setHardwareAlpha(float hwt)
 	{
 		if(hwt == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hwt\" %f;\n", hwt);
+		writeFloat(mFile,"\tsetAttr \".hwt\" ",hwt,";\n");
 	}
 	void setColorGain(const float3& cg)
 	{
 		if(cg == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".cg\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cg\" -type \"float3\" ");
 		cg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorGainR(float cgr)
 	{
 		if(cgr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgr\" %f;\n", cgr);
+		writeFloat(mFile,"\tsetAttr \".cg.cgr\" ",cgr,";\n");
 	}
 	void setColorGainG(float cgg)
 	{
 		if(cgg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgg\" %f;\n", cgg);
+		writeFloat(mFile,"\tsetAttr \".cg.cgg\" ",cgg,";\n");
 	}
 	void setColorGainB(float cgb)
 	{
 		if(cgb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgb\" %f;\n", cgb);
+		writeFloat(mFile,"\tsetAttr \".cg.cgb\" ",cgb,";\n");
 	}
 	void setColorOffset(const float3& cof)
 	{
 		if(cof == float3(0,0,0)) return;
-		fprintf(mFile,"\tsetAttr \".cof\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cof\" -type \"float3\" ");
 		cof.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorOffsetR(float cofr)
 	{
 		if(cofr == 0) return;
-		fprintf(mFile,"\tsetAttr \".cof.cofr\" %f;\n", cofr);
+		writeFloat(mFile,"\tsetAttr \".cof.cofr\" ",cofr,";\n");
 	}
 	void setColorOffsetG(float cofg)
 	{
 		if(cofg == 0) return;
-		fprintf(mFile,"\tsetAttr \".cof.cofg\" %f;\n", cofg);
+		writeFloat(mFile,"\tsetAttr \".cof.cofg\" ",cofg,";\n");
 	}
 	void setColorOffsetB(float cofb)
 	{
 		if(cofb == 0) return;
-		fprintf(mFile,"\tsetAttr \".cof.cofb\" %f;\n", cofb);
+		writeFloat(mFile,"\tsetAttr \".cof.cofb\" ",cofb,";\n");
 	}
 	void setInvert(bool inv)
 	{
 		if(inv == false) return;
-		fprintf(mFile,"\tsetAttr \".inv\" %i;\n", inv);
+		writeInt(mFile,"\tsetAttr \".inv\" ",inv,";\n");
 	}
 	void setAlphaIsLuminance(bool ail)
 	{
 		if(ail == false) return;
-		fprintf(mFile,"\tsetAttr \".ail\" %i;\n", ail);
+		writeInt(mFile,"\tsetAttr \".ail\" ",ail,";\n");
 	}
 	void setPrimaryVisibility(bool vis)
 	{
 		if(vis == true) return;
-		fprintf(mFile,"\tsetAttr \".vis\" %i;\n", vis);
+		writeInt(mFile,"\tsetAttr \".vis\" ",vis,";\n");
 	}
 	void setVisibleInEnvironment(bool vien)
 	{
 		if(vien == false) return;
-		fprintf(mFile,"\tsetAttr \".vien\" %i;\n", vien);
+		writeInt(mFile,"\tsetAttr \".vien\" ",vien,";\n");
 	}
 	void setVisibleInReflections(bool vir)
 	{
 		if(vir == false) return;
-		fprintf(mFile,"\tsetAttr \".vir\" %i;\n", vir);
+		writeInt(mFile,"\tsetAttr \".vir\" ",vir,";\n");
 	}
 	void setVisibleInRefractions(bool vif)
 	{
 		if(vif == false) return;
-		fprintf(mFile,"\tsetAttr \".vif\" %i;\n", vif);
+		writeInt(mFile,"\tsetAttr \".vif\" ",vif,";\n");
 	}
 	void setVisibleInFinalGather(bool vifg)
 	{
 		if(vifg == false) return;
-		fprintf(mFile,"\tsetAttr \".vifg\" %i;\n", vifg);
+		writeInt(mFile,"\tsetAttr \".vifg\" ",vifg,";\n");
 	}
 	void setOverrideEnvColorFx(bool oefx)
 	{
 		if(oefx == false) return;
-		fprintf(mFile,"\tsetAttr \".oefx\" %i;\n", oefx);
+		writeInt(mFile,"\tsetAttr \".oefx\" ",oefx,";\n");
 	}
 	void setEnvInvert(bool einv)
 	{
 		if(einv == false) return;
-		fprintf(mFile,"\tsetAttr \".einv\" %i;\n", einv);
+		writeInt(mFile,"\tsetAttr \".einv\" ",einv,";\n");
 	}
 	void setEnvColorGain(const float3& ecg)
 	{
 		if(ecg == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ecg\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ecg\" -type \"float3\" ");
 		ecg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvColorGainR(float ecgr)
 	{
 		if(ecgr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ecg.ecgr\" %f;\n", ecgr);
+		writeFloat(mFile,"\tsetAttr \".ecg.ecgr\" ",ecgr,";\n");
 	}
 	void setEnvColorGainG(float ecgg)
 	{
 		if(ecgg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ecg.ecgg\" %f;\n", ecgg);
+		writeFloat(mFile,"\tsetAttr \".ecg.ecgg\" ",ecgg,";\n");
 	}
 	void setEnvColorGainB(float ecgb)
 	{
 		if(ecgb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ecg.ecgb\" %f;\n", ecgb);
+		writeFloat(mFile,"\tsetAttr \".ecg.ecgb\" ",ecgb,";\n");
 	}
 	void setEnvColorOffset(const float3& eco)
 	{
 		if(eco == float3(0,0,0)) return;
-		fprintf(mFile,"\tsetAttr \".eco\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".eco\" -type \"float3\" ");
 		eco.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvColorOffsetR(float ecor)
 	{
 		if(ecor == 0) return;
-		fprintf(mFile,"\tsetAttr \".eco.ecor\" %f;\n", ecor);
+		writeFloat(mFile,"\tsetAttr \".eco.ecor\" ",ecor,";\n");
 	}
 	void setEnvColorOffsetG(float ecog)
 	{
 		if(ecog == 0) return;
-		fprintf(mFile,"\tsetAttr \".eco.ecog\" %f;\n", ecog);
+		writeFloat(mFile,"\tsetAttr \".eco.ecog\" ",ecog,";\n");
 	}
 	void setEnvColorOffsetB(float ecorb)
 	{
 		if(ecorb == 0) return;
-		fprintf(mFile,"\tsetAttr \".eco.ecorb\" %f;\n", ecorb);
+		writeFloat(mFile,"\tsetAttr \".eco.ecorb\" ",ecorb,";\n");
 	}
 	void setOverrideFgColorFx(bool offx)
 	{
 		if(offx == false) return;
-		fprintf(mFile,"\tsetAttr \".offx\" %i;\n", offx);
+		writeInt(mFile,"\tsetAttr \".offx\" ",offx,";\n");
 	}
 	void setFgInvert(bool finv)
 	{
 		if(finv == false) return;
-		fprintf(mFile,"\tsetAttr \".finv\" %i;\n", finv);
+		writeInt(mFile,"\tsetAttr \".finv\" ",finv,";\n");
 	}
 	void setFgColorGain(const float3& fcg)
 	{
 		if(fcg == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".fcg\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fcg\" -type \"float3\" ");
 		fcg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFgColorGainR(float fcgr)
 	{
 		if(fcgr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fcg.fcgr\" %f;\n", fcgr);
+		writeFloat(mFile,"\tsetAttr \".fcg.fcgr\" ",fcgr,";\n");
 	}
 	void setFgColorGainG(float fcgg)
 	{
 		if(fcgg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fcg.fcgg\" %f;\n", fcgg);
+		writeFloat(mFile,"\tsetAttr \".fcg.fcgg\" ",fcgg,";\n");
 	}
 	void setFgColorGainB(float fcgb)
 	{
 		if(fcgb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fcg.fcgb\" %f;\n", fcgb);
+		writeFloat(mFile,"\tsetAttr \".fcg.fcgb\" ",fcgb,";\n");
 	}
 	void setFgColorOffset(const float3& fco)
 	{
 		if(fco == float3(0,0,0)) return;
-		fprintf(mFile,"\tsetAttr \".fco\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fco\" -type \"float3\" ");
 		fco.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFgColorOffsetR(float fcor)
 	{
 		if(fcor == 0) return;
-		fprintf(mFile,"\tsetAttr \".fco.fcor\" %f;\n", fcor);
+		writeFloat(mFile,"\tsetAttr \".fco.fcor\" ",fcor,";\n");
 	}
 	void setFgColorOffsetG(float fcog)
 	{
 		if(fcog == 0) return;
-		fprintf(mFile,"\tsetAttr \".fco.fcog\" %f;\n", fcog);
+		writeFloat(mFile,"\tsetAttr \".fco.fcog\" ",fcog,";\n");
 	}
 	void setFgColorOffsetB(float fcob)
 	{
 		if(fcob == 0) return;
-		fprintf(mFile,"\tsetAttr \".fco.fcob\" %f;\n", fcob);
+		writeFloat(mFile,"\tsetAttr \".fco.fcob\" ",fcob,";\n");
 	}
 	void setEmitLight(bool el)
 	{
 		if(el == false) return;
-		fprintf(mFile,"\tsetAttr \".el\" %i;\n", el);
+		writeInt(mFile,"\tsetAttr \".el\" ",el,";\n");
 	}
 	void setFilter(const long2& flt)
 	{
 		if(flt == long2(256, 256)) return;
-		fprintf(mFile,"\tsetAttr \".flt\" -type \"long2\" ");
+		writeString(mFile,"\tsetAttr \".flt\" -type \"long2\" ");
 		flt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFilterU(int fiu)
 	{
 		if(fiu == 256) return;
-		fprintf(mFile,"\tsetAttr \".flt.fiu\" %i;\n", fiu);
+		writeInt(mFile,"\tsetAttr \".flt.fiu\" ",fiu,";\n");
 	}
 	void setFilterV(int fiv)
 	{
 		if(fiv == 256) return;
-		fprintf(mFile,"\tsetAttr \".flt.fiv\" %i;\n", fiv);
+		writeInt(mFile,"\tsetAttr \".flt.fiv\" ",fiv,";\n");
 	}
 	void setSamples(const long2& smp)
 	{
 		if(smp == long2(40, 16)) return;
-		fprintf(mFile,"\tsetAttr \".smp\" -type \"long2\" ");
+		writeString(mFile,"\tsetAttr \".smp\" -type \"long2\" ");
 		smp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSamplesU(int smpu)
 	{
 		if(smpu == 40) return;
-		fprintf(mFile,"\tsetAttr \".smp.smpu\" %i;\n", smpu);
+		writeInt(mFile,"\tsetAttr \".smp.smpu\" ",smpu,";\n");
 	}
 	void setSamplesV(int smpv)
 	{
 		if(smpv == 16) return;
-		fprintf(mFile,"\tsetAttr \".smp.smpv\" %i;\n", smpv);
+		writeInt(mFile,"\tsetAttr \".smp.smpv\" ",smpv,";\n");
 	}
 	void setLowSamples(const long2& low)
 	{
 		if(low == long2(5, 2)) return;
-		fprintf(mFile,"\tsetAttr \".low\" -type \"long2\" ");
+		writeString(mFile,"\tsetAttr \".low\" -type \"long2\" ");
 		low.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLowSamplesU(int lowu)
 	{
 		if(lowu == 5) return;
-		fprintf(mFile,"\tsetAttr \".low.lowu\" %i;\n", lowu);
+		writeInt(mFile,"\tsetAttr \".low.lowu\" ",lowu,";\n");
 	}
 	void setLowSamplesV(int lowv)
 	{
 		if(lowv == 2) return;
-		fprintf(mFile,"\tsetAttr \".low.lowv\" %i;\n", lowv);
+		writeInt(mFile,"\tsetAttr \".low.lowv\" ",lowv,";\n");
 	}
 	void setJitter(float jit)
 	{
 		if(jit == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".jit\" %f;\n", jit);
+		writeFloat(mFile,"\tsetAttr \".jit\" ",jit,";\n");
 	}
 	void setSkipBack(bool skb)
 	{
 		if(skb == true) return;
-		fprintf(mFile,"\tsetAttr \".skb\" %i;\n", skb);
+		writeInt(mFile,"\tsetAttr \".skb\" ",skb,";\n");
 	}
 	void setEmitDiffuse(bool emdf)
 	{
 		if(emdf == true) return;
-		fprintf(mFile,"\tsetAttr \".emdf\" %i;\n", emdf);
+		writeInt(mFile,"\tsetAttr \".emdf\" ",emdf,";\n");
 	}
 	void setEmitSpecular(bool emsp)
 	{
 		if(emsp == true) return;
-		fprintf(mFile,"\tsetAttr \".emsp\" %i;\n", emsp);
+		writeInt(mFile,"\tsetAttr \".emsp\" ",emsp,";\n");
 	}
 	void setUseRayTraceShadows(bool rts)
 	{
 		if(rts == true) return;
-		fprintf(mFile,"\tsetAttr \".rts\" %i;\n", rts);
+		writeInt(mFile,"\tsetAttr \".rts\" ",rts,";\n");
 	}
 	void setShadowColor(const float3& shc)
 	{
 		if(shc == float3(0,0,0)) return;
-		fprintf(mFile,"\tsetAttr \".shc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".shc\" -type \"float3\" ");
 		shc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShadowColorR(float shcr)
 	{
 		if(shcr == 0) return;
-		fprintf(mFile,"\tsetAttr \".shc.shcr\" %f;\n", shcr);
+		writeFloat(mFile,"\tsetAttr \".shc.shcr\" ",shcr,";\n");
 	}
 	void setShadowColorG(float shcg)
 	{
 		if(shcg == 0) return;
-		fprintf(mFile,"\tsetAttr \".shc.shcg\" %f;\n", shcg);
+		writeFloat(mFile,"\tsetAttr \".shc.shcg\" ",shcg,";\n");
 	}
 	void setShadowColorB(float shcb)
 	{
 		if(shcb == 0) return;
-		fprintf(mFile,"\tsetAttr \".shc.shcb\" %f;\n", shcb);
+		writeFloat(mFile,"\tsetAttr \".shc.shcb\" ",shcb,";\n");
 	}
 	void setRayDepthLimit(int rdl)
 	{
 		if(rdl == 2) return;
-		fprintf(mFile,"\tsetAttr \".rdl\" %i;\n", rdl);
+		writeInt(mFile,"\tsetAttr \".rdl\" ",rdl,";\n");
 	}
 	void setOverrideLightColorFx(bool olfx)
 	{
 		if(olfx == false) return;
-		fprintf(mFile,"\tsetAttr \".olfx\" %i;\n", olfx);
+		writeInt(mFile,"\tsetAttr \".olfx\" ",olfx,";\n");
 	}
 	void setLightInvert(bool linv)
 	{
 		if(linv == false) return;
-		fprintf(mFile,"\tsetAttr \".linv\" %i;\n", linv);
+		writeInt(mFile,"\tsetAttr \".linv\" ",linv,";\n");
 	}
 	void setLightColorGain(const float3& lcg)
 	{
 		if(lcg == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".lcg\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lcg\" -type \"float3\" ");
 		lcg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLightColorGainR(float lcgr)
 	{
 		if(lcgr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lcg.lcgr\" %f;\n", lcgr);
+		writeFloat(mFile,"\tsetAttr \".lcg.lcgr\" ",lcgr,";\n");
 	}
 	void setLightColorGainG(float lcgg)
 	{
 		if(lcgg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lcg.lcgg\" %f;\n", lcgg);
+		writeFloat(mFile,"\tsetAttr \".lcg.lcgg\" ",lcgg,";\n");
 	}
 	void setLightColorGainB(float lcgb)
 	{
 		if(lcgb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lcg.lcgb\" %f;\n", lcgb);
+		writeFloat(mFile,"\tsetAttr \".lcg.lcgb\" ",lcgb,";\n");
 	}
 	void setLightColorOffset(const float3& lco)
 	{
 		if(lco == float3(0,0,0)) return;
-		fprintf(mFile,"\tsetAttr \".lco\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lco\" -type \"float3\" ");
 		lco.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLightColorOffsetR(float lcor)
 	{
 		if(lcor == 0) return;
-		fprintf(mFile,"\tsetAttr \".lco.lcor\" %f;\n", lcor);
+		writeFloat(mFile,"\tsetAttr \".lco.lcor\" ",lcor,";\n");
 	}
 	void setLightColorOffsetG(float lcog)
 	{
 		if(lcog == 0) return;
-		fprintf(mFile,"\tsetAttr \".lco.lcog\" %f;\n", lcog);
+		writeFloat(mFile,"\tsetAttr \".lco.lcog\" ",lcog,";\n");
 	}
 	void setLightColorOffsetB(float lcob)
 	{
 		if(lcob == 0) return;
-		fprintf(mFile,"\tsetAttr \".lco.lcob\" %f;\n", lcob);
+		writeFloat(mFile,"\tsetAttr \".lco.lcob\" ",lcob,";\n");
 	}
 	void setEmitPhotons(bool ep)
 	{
 		if(ep == false) return;
-		fprintf(mFile,"\tsetAttr \".ep\" %i;\n", ep);
+		writeInt(mFile,"\tsetAttr \".ep\" ",ep,";\n");
 	}
 	void setGlobillumPhotons(int giph)
 	{
 		if(giph == 25000) return;
-		fprintf(mFile,"\tsetAttr \".giph\" %i;\n", giph);
+		writeInt(mFile,"\tsetAttr \".giph\" ",giph,";\n");
 	}
 	void setCausticPhotons(int caph)
 	{
 		if(caph == 15000) return;
-		fprintf(mFile,"\tsetAttr \".caph\" %i;\n", caph);
+		writeInt(mFile,"\tsetAttr \".caph\" ",caph,";\n");
 	}
 	void setExponent(float exp)
 	{
 		if(exp == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".exp\" %f;\n", exp);
+		writeFloat(mFile,"\tsetAttr \".exp\" ",exp,";\n");
 	}
 	void setStandardEmission(bool se)
 	{
 		if(se == false) return;
-		fprintf(mFile,"\tsetAttr \".se\" %i;\n", se);
+		writeInt(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setOverridePhotonColorFx(bool opfx)
 	{
 		if(opfx == false) return;
-		fprintf(mFile,"\tsetAttr \".opfx\" %i;\n", opfx);
+		writeInt(mFile,"\tsetAttr \".opfx\" ",opfx,";\n");
 	}
 	void setPhotonInvert(bool pinv)
 	{
 		if(pinv == false) return;
-		fprintf(mFile,"\tsetAttr \".pinv\" %i;\n", pinv);
+		writeInt(mFile,"\tsetAttr \".pinv\" ",pinv,";\n");
 	}
 	void setPhotonColorGain(const float3& pcg)
 	{
 		if(pcg == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".pcg\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pcg\" -type \"float3\" ");
 		pcg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPhotonColorGainR(float pcgr)
 	{
 		if(pcgr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pcg.pcgr\" %f;\n", pcgr);
+		writeFloat(mFile,"\tsetAttr \".pcg.pcgr\" ",pcgr,";\n");
 	}
 	void setPhotonColorGainG(float pcgg)
 	{
 		if(pcgg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pcg.pcgg\" %f;\n", pcgg);
+		writeFloat(mFile,"\tsetAttr \".pcg.pcgg\" ",pcgg,";\n");
 	}
 	void setPhotonColorGainB(float pcgb)
 	{
 		if(pcgb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pcg.pcgb\" %f;\n", pcgb);
+		writeFloat(mFile,"\tsetAttr \".pcg.pcgb\" ",pcgb,";\n");
 	}
 	void setPhotonColorOffset(const float3& pco)
 	{
 		if(pco == float3(0,0,0)) return;
-		fprintf(mFile,"\tsetAttr \".pco\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pco\" -type \"float3\" ");
 		pco.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPhotonColorOffsetR(float pcor)
 	{
 		if(pcor == 0) return;
-		fprintf(mFile,"\tsetAttr \".pco.pcor\" %f;\n", pcor);
+		writeFloat(mFile,"\tsetAttr \".pco.pcor\" ",pcor,";\n");
 	}
 	void setPhotonColorOffsetG(float pcog)
 	{
 		if(pcog == 0) return;
-		fprintf(mFile,"\tsetAttr \".pco.pcog\" %f;\n", pcog);
+		writeFloat(mFile,"\tsetAttr \".pco.pcog\" ",pcog,";\n");
 	}
 	void setPhotonColorOffsetB(float pcob)
 	{
 		if(pcob == 0) return;
-		fprintf(mFile,"\tsetAttr \".pco.pcob\" %f;\n", pcob);
+		writeFloat(mFile,"\tsetAttr \".pco.pcob\" ",pcob,";\n");
 	}
 	void getFrameExtension()const
 	{
-		fprintf(mFile,"\"%s.fe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fe\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.col\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.col.colr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.colr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.col.colg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.colg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.col.colb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col.colb\"");
 	}
 	void getColorGain()const
 	{
-		fprintf(mFile,"\"%s.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg\"");
 	}
 	void getColorGainR()const
 	{
-		fprintf(mFile,"\"%s.cg.cgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg.cgr\"");
 	}
 	void getColorGainG()const
 	{
-		fprintf(mFile,"\"%s.cg.cgg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg.cgg\"");
 	}
 	void getColorGainB()const
 	{
-		fprintf(mFile,"\"%s.cg.cgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg.cgb\"");
 	}
 	void getColorOffset()const
 	{
-		fprintf(mFile,"\"%s.cof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cof\"");
 	}
 	void getColorOffsetR()const
 	{
-		fprintf(mFile,"\"%s.cof.cofr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cof.cofr\"");
 	}
 	void getColorOffsetG()const
 	{
-		fprintf(mFile,"\"%s.cof.cofg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cof.cofg\"");
 	}
 	void getColorOffsetB()const
 	{
-		fprintf(mFile,"\"%s.cof.cofb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cof.cofb\"");
 	}
 	void getEnvColorGain()const
 	{
-		fprintf(mFile,"\"%s.ecg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecg\"");
 	}
 	void getEnvColorGainR()const
 	{
-		fprintf(mFile,"\"%s.ecg.ecgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecg.ecgr\"");
 	}
 	void getEnvColorGainG()const
 	{
-		fprintf(mFile,"\"%s.ecg.ecgg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecg.ecgg\"");
 	}
 	void getEnvColorGainB()const
 	{
-		fprintf(mFile,"\"%s.ecg.ecgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecg.ecgb\"");
 	}
 	void getEnvColorOffset()const
 	{
-		fprintf(mFile,"\"%s.eco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eco\"");
 	}
 	void getEnvColorOffsetR()const
 	{
-		fprintf(mFile,"\"%s.eco.ecor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eco.ecor\"");
 	}
 	void getEnvColorOffsetG()const
 	{
-		fprintf(mFile,"\"%s.eco.ecog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eco.ecog\"");
 	}
 	void getEnvColorOffsetB()const
 	{
-		fprintf(mFile,"\"%s.eco.ecorb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eco.ecorb\"");
 	}
 	void getFgColorGain()const
 	{
-		fprintf(mFile,"\"%s.fcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcg\"");
 	}
 	void getFgColorGainR()const
 	{
-		fprintf(mFile,"\"%s.fcg.fcgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcg.fcgr\"");
 	}
 	void getFgColorGainG()const
 	{
-		fprintf(mFile,"\"%s.fcg.fcgg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcg.fcgg\"");
 	}
 	void getFgColorGainB()const
 	{
-		fprintf(mFile,"\"%s.fcg.fcgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcg.fcgb\"");
 	}
 	void getFgColorOffset()const
 	{
-		fprintf(mFile,"\"%s.fco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fco\"");
 	}
 	void getFgColorOffsetR()const
 	{
-		fprintf(mFile,"\"%s.fco.fcor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fco.fcor\"");
 	}
 	void getFgColorOffsetG()const
 	{
-		fprintf(mFile,"\"%s.fco.fcog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fco.fcog\"");
 	}
 	void getFgColorOffsetB()const
 	{
-		fprintf(mFile,"\"%s.fco.fcob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fco.fcob\"");
 	}
 	void getFilterU()const
 	{
-		fprintf(mFile,"\"%s.flt.fiu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flt.fiu\"");
 	}
 	void getFilterV()const
 	{
-		fprintf(mFile,"\"%s.flt.fiv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flt.fiv\"");
 	}
 	void getSamplesU()const
 	{
-		fprintf(mFile,"\"%s.smp.smpu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smp.smpu\"");
 	}
 	void getSamplesV()const
 	{
-		fprintf(mFile,"\"%s.smp.smpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smp.smpv\"");
 	}
 	void getLowSamplesU()const
 	{
-		fprintf(mFile,"\"%s.low.lowu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".low.lowu\"");
 	}
 	void getLowSamplesV()const
 	{
-		fprintf(mFile,"\"%s.low.lowv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".low.lowv\"");
 	}
 	void getShadowColor()const
 	{
-		fprintf(mFile,"\"%s.shc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shc\"");
 	}
 	void getShadowColorR()const
 	{
-		fprintf(mFile,"\"%s.shc.shcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shc.shcr\"");
 	}
 	void getShadowColorG()const
 	{
-		fprintf(mFile,"\"%s.shc.shcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shc.shcg\"");
 	}
 	void getShadowColorB()const
 	{
-		fprintf(mFile,"\"%s.shc.shcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shc.shcb\"");
 	}
 	void getLightColorGain()const
 	{
-		fprintf(mFile,"\"%s.lcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcg\"");
 	}
 	void getLightColorGainR()const
 	{
-		fprintf(mFile,"\"%s.lcg.lcgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcg.lcgr\"");
 	}
 	void getLightColorGainG()const
 	{
-		fprintf(mFile,"\"%s.lcg.lcgg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcg.lcgg\"");
 	}
 	void getLightColorGainB()const
 	{
-		fprintf(mFile,"\"%s.lcg.lcgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcg.lcgb\"");
 	}
 	void getLightColorOffset()const
 	{
-		fprintf(mFile,"\"%s.lco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lco\"");
 	}
 	void getLightColorOffsetR()const
 	{
-		fprintf(mFile,"\"%s.lco.lcor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lco.lcor\"");
 	}
 	void getLightColorOffsetG()const
 	{
-		fprintf(mFile,"\"%s.lco.lcog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lco.lcog\"");
 	}
 	void getLightColorOffsetB()const
 	{
-		fprintf(mFile,"\"%s.lco.lcob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lco.lcob\"");
 	}
 	void getPhotonColorGain()const
 	{
-		fprintf(mFile,"\"%s.pcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcg\"");
 	}
 	void getPhotonColorGainR()const
 	{
-		fprintf(mFile,"\"%s.pcg.pcgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcg.pcgr\"");
 	}
 	void getPhotonColorGainG()const
 	{
-		fprintf(mFile,"\"%s.pcg.pcgg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcg.pcgg\"");
 	}
 	void getPhotonColorGainB()const
 	{
-		fprintf(mFile,"\"%s.pcg.pcgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcg.pcgb\"");
 	}
 	void getPhotonColorOffset()const
 	{
-		fprintf(mFile,"\"%s.pco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pco\"");
 	}
 	void getPhotonColorOffsetR()const
 	{
-		fprintf(mFile,"\"%s.pco.pcor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pco.pcor\"");
 	}
 	void getPhotonColorOffsetG()const
 	{
-		fprintf(mFile,"\"%s.pco.pcog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pco.pcog\"");
 	}
 	void getPhotonColorOffsetB()const
 	{
-		fprintf(mFile,"\"%s.pco.pcob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pco.pcob\"");
 	}
 protected:
 	MentalrayIblShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -778,13 +778,13 @@ protected:
 private:
 	void createNode()const
 	{
+		writeString(mFile,"createNode ",mNodeType.c_str());
 		if(mShared)
-			fprintf(mFile, "createNode %s -s -n \"%s\"", mNodeType.c_str(),mName.c_str());
-		else
-			fprintf(mFile, "createNode %s -n \"%s\"", mNodeType.c_str(),mName.c_str());
+			writeString(mFile," -s");
+		writeString(mFile," -n \"",mName.c_str(),"\"");
 		if(mParent != "") 
-			fprintf(mFile, " -p \"%s\"", mParent.c_str());
-		fprintf(mFile, ";\n");
+			writeString(mFile," -p \"",mParent.c_str(),"\"");
+		writeString(mFile,";\n");
 	}
 
 };
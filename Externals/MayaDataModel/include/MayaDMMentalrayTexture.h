@@ -23,9 +23,9 @@ public:
 		unsigned int miDepth;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miWidth);
-			fprintf(file,"%i ", miHeight);
-			fprintf(file,"%i", miDepth);
+			writeInt(file,"",miWidth," ");
+			writeInt(file,"",miHeight," ");
+			writeInt(file,"",miDepth);
 		}
 	};
 public:
@@ -38,95 +38,95 @@ public:
 	void setMiTextureType(unsigned int mitt)
 	{
 		if(mitt == 1) return;
-		fprintf(mFile,"\tsetAttr \".mitt\" %i;\n", mitt);
+		writeInt(mFile,"\tsetAttr \".mitt\" ",mitt,";\n");
 	}
 	void setFileTextureName(const string& ftn)
 	{
 		if(ftn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ftn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ftn\" -type \"string\" ");
 		ftn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiLocal(bool mil)
 	{
 		if(mil == false) return;
-		fprintf(mFile,"\tsetAttr \".mil\" %i;\n", mil);
+		writeInt(mFile,"\tsetAttr \".mil\" ",mil,";\n");
 	}
 	void setMiWritable(bool miw)
 	{
 		if(miw == false) return;
-		fprintf(mFile,"\tsetAttr \".miw\" %i;\n", miw);
+		writeInt(mFile,"\tsetAttr \".miw\" ",miw,";\n");
 	}
 	void setMiFilter(bool mift)
 	{
 		if(mift == false) return;
-		fprintf(mFile,"\tsetAttr \".mift\" %i;\n", mift);
+		writeInt(mFile,"\tsetAttr \".mift\" ",mift,";\n");
 	}
 	void setMiFilterSize(float mifs)
 	{
 		if(mifs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mifs\" %f;\n", mifs);
+		writeFloat(mFile,"\tsetAttr \".mifs\" ",mifs,";\n");
 	}
 	void setMiFileSize(const MiFileSize& mifr)
 	{
-		fprintf(mFile,"\tsetAttr \".mifr\" ");
+		writeString(mFile,"\tsetAttr \".mifr\" ");
 		mifr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiWidth(int miwd)
 	{
 		if(miwd == 100) return;
-		fprintf(mFile,"\tsetAttr \".mifr.miwd\" %i;\n", miwd);
+		writeInt(mFile,"\tsetAttr \".mifr.miwd\" ",miwd,";\n");
 	}
 	void setMiHeight(int mihg)
 	{
 		if(mihg == 100) return;
-		fprintf(mFile,"\tsetAttr \".mifr.mihg\" %i;\n", mihg);
+		writeInt(mFile,"\tsetAttr \".mifr.mihg\" ",mihg,";\n");
 	}
 	void setMiDepth(unsigned int midp)
 	{
 		if(midp == 0) return;
-		fprintf(mFile,"\tsetAttr \".mifr.midp\" %i;\n", midp);
+		writeInt(mFile,"\tsetAttr \".mifr.midp\" ",midp,";\n");
 	}
 	void getMiTextureType()const
 	{
-		fprintf(mFile,"\"%s.mitt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitt\"");
 	}
 	void getFileTextureName()const
 	{
-		fprintf(mFile,"\"%s.ftn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ftn\"");
 	}
 	void getMiLocal()const
 	{
-		fprintf(mFile,"\"%s.mil\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mil\"");
 	}
 	void getMiWritable()const
 	{
-		fprintf(mFile,"\"%s.miw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miw\"");
 	}
 	void getMiFilter()const
 	{
-		fprintf(mFile,"\"%s.mift\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mift\"");
 	}
 	void getMiFilterSize()const
 	{
-		fprintf(mFile,"\"%s.mifs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifs\"");
 	}
 	void getMiFileSize()const
 	{
-		fprintf(mFile,"\"%s.mifr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifr\"");
 	}
 	void getMiWidth()const
 	{
-		fprintf(mFile,"\"%s.mifr.miwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifr.miwd\"");
 	}
 	void getMiHeight()const
 	{
-		fprintf(mFile,"\"%s.mifr.mihg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifr.mihg\"");
 	}
 	void getMiDepth()const
 	{
-		fprintf(mFile,"\"%s.mifr.midp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifr.midp\"");
 	}
 protected:
 	MentalrayTexture(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -24,10 +24,10 @@ public:
 		float colorA;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", colorR);
-			fprintf(file,"%f ", colorG);
-			fprintf(file,"%f ", colorB);
-			fprintf(file,"%f", colorA);
+			writeFloat(file,"",colorR," ");
+			writeFloat(file,"",colorG," ");
+			writeFloat(file,"",colorB," ");
+			writeFloat(file,"",colorA);
 		}
 	};
 	struct ColorPerVertex{
@@ -40,20 +40,20 @@ public:
 				void write(FILE* file) const
 				{
 					vertexFaceColorRGB.write(file);
-					fprintf(file, " ");
-					fprintf(file,"%f", vertexFaceAlpha);
+					writeString(file," ");
+					writeFloat(file,"",vertexFaceAlpha);
 				}
 			}* vertexFaceColor;
 			size_t nbVertexFaceColor;
 			void write(FILE* file) const
 			{
 				vertexColorRGB.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f ", vertexAlpha);
+				writeString(file," ");
+				writeFloat(file,"",vertexAlpha," ");
 				for (size_t i = 0; i<nbVertexFaceColor; ++i)
 				{
 					vertexFaceColor[i].write(file);
-					if (i + 1<nbVertexFaceColor) fprintf(file, " ");
+					if (i + 1<nbVertexFaceColor) writeString(file," ");
 				}
 			}
 		}* vertexColor;
@@ -63,7 +63,7 @@ public:
 			for (size_t i = 0; i<nbVertexColor; ++i)
 			{
 				vertexColor[i].write(file);
-				if (i + 1<nbVertexColor) fprintf(file, " ");
+				if (i + 1<nbVertexColor) writeString(file," ");
 			}
 		}
 	};
@@ -81,11 +81,11 @@ public:
 			void write(FILE* file) const
 			{
 				vertexNormalXYZ.write(file);
-				fprintf(file, " ");
+				writeString(file," ");
 				for (size_t i = 0; i<nbVertexFaceNormal; ++i)
 				{
 					vertexFaceNormal[i].write(file);
-					if (i + 1<nbVertexFaceNormal) fprintf(file, " ");
+					if (i + 1<nbVertexFaceNormal) writeString(file," ");
 				}
 			}
 		}* vertexNormal;
@@ -95,7 +95,7 @@ public:
 			for (size_t i = 0; i<nbVertexNormal; ++i)
 			{
 				vertexNormal[i].write(file);
-				if (i + 1<nbVertexNormal) fprintf(file, " ");
+				if (i + 1<nbVertexNormal) writeString(file," ");
 			}
 		}
 	};
@@ -123,27 +123,27 @@ public:
 		bool miRefractionReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i ", miTransparencyReceive);
-			fprintf(file,"%i ", miReflectionReceive);
-			fprintf(file,"%i", miRefractionReceive);
+			writeInt(file,"",miOverrideCaustics," ");
+			writeInt(file,"",miCausticAccuracy," ");
+			writeFloat(file,"",miCausticRadius," ");
+			writeInt(file,"",miOverrideGlobalIllumination," ");
+			writeInt(file,"",miGlobillumAccuracy," ");
+			writeFloat(file,"",miGlobillumRadius," ");
+			writeInt(file,"",miOverrideFinalGather," ");
+			writeInt(file,"",miFinalGatherRays," ");
+			writeFloat(file,"",miFinalGatherMinRadius," ");
+			writeFloat(file,"",miFinalGatherMaxRadius," ");
+			writeInt(file,"",miFinalGatherFilter," ");
+			writeInt(file,"",miFinalGatherView," ");
+			writeInt(file,"",miOverrideSamples," ");
+			writeInt(file,"",miMinSamples," ");
+			writeInt(file,"",miMaxSamples," ");
+			writeInt(file,"",miFinalGatherCast," ");
+			writeInt(file,"",miFinalGatherReceive," ");
+			writeInt(file,"",miTransparencyCast," ");
+			writeInt(file,"",miTransparencyReceive," ");
+			writeInt(file,"",miReflectionReceive," ");
+			writeInt(file,"",miRefractionReceive);
 		}
 	};
 public:
@@ -155,1502 +155,1502 @@ public:
 
 	void setOutMesh(const mesh& o)
 	{
-		fprintf(mFile,"\tsetAttr \".o\" -type \"mesh\" ");
+		writeString(mFile,"\tsetAttr \".o\" -type \"mesh\" ");
 		o.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCachedInMesh(const mesh& ci)
 	{
-		fprintf(mFile,"\tsetAttr \".ci\" -type \"mesh\" ");
+		writeString(mFile,"\tsetAttr \".ci\" -type \"mesh\" ");
 		ci.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSmoothWarn(bool sw)
 	{
 		if(sw == true) return;
-		fprintf(mFile,"\tsetAttr \".sw\" %i;\n", sw);
+		writeInt(mFile,"\tsetAttr \".sw\" ",sw,";\n");
 	}
 	void setSmoothLevel(short lev)
 	{
 		if(lev == 2) return;
-		fprintf(mFile,"\tsetAttr \".lev\" %i;\n", lev);
+		writeInt(mFile,"\tsetAttr \".lev\" ",lev,";\n");
 	}
 	void setContinuity(float co)
 	{
 		if(co == 1) return;
-		fprintf(mFile,"\tsetAttr \".co\" %f;\n", co);
+		writeFloat(mFile,"\tsetAttr \".co\" ",co,";\n");
 	}
 	void setSmoothUVs(bool suv)
 	{
 		if(suv == true) return;
-		fprintf(mFile,"\tsetAttr \".suv\" %i;\n", suv);
+		writeInt(mFile,"\tsetAttr \".suv\" ",suv,";\n");
 	}
 	void setKeepBorder(bool kb)
 	{
 		if(kb == false) return;
-		fprintf(mFile,"\tsetAttr \".kb\" %i;\n", kb);
+		writeInt(mFile,"\tsetAttr \".kb\" ",kb,";\n");
 	}
 	void setKeepHardEdge(bool khe)
 	{
 		if(khe == false) return;
-		fprintf(mFile,"\tsetAttr \".khe\" %i;\n", khe);
+		writeInt(mFile,"\tsetAttr \".khe\" ",khe,";\n");
 	}
 	void setPropagateEdgeHardness(bool peh)
 	{
 		if(peh == false) return;
-		fprintf(mFile,"\tsetAttr \".peh\" %i;\n", peh);
+		writeInt(mFile,"\tsetAttr \".peh\" ",peh,";\n");
 	}
 	void setKeepMapBorders(unsigned int kmb)
 	{
 		if(kmb == 1) return;
-		fprintf(mFile,"\tsetAttr \".kmb\" %i;\n", kmb);
+		writeInt(mFile,"\tsetAttr \".kmb\" ",kmb,";\n");
 	}
 	void setSmoothOffset(const float3& so)
 	{
-		fprintf(mFile,"\tsetAttr \".so\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".so\" -type \"float3\" ");
 		so.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSofx(float sx)
 	{
 		if(sx == 0) return;
-		fprintf(mFile,"\tsetAttr \".so.sx\" %f;\n", sx);
+		writeFloat(mFile,"\tsetAttr \".so.sx\" ",sx,";\n");
 	}
 	void setSofy(float sy)
 	{
 		if(sy == 0) return;
-		fprintf(mFile,"\tsetAttr \".so.sy\" %f;\n", sy);
+		writeFloat(mFile,"\tsetAttr \".so.sy\" ",sy,";\n");
 	}
 	void setSofz(float sz)
 	{
 		if(sz == 0) return;
-		fprintf(mFile,"\tsetAttr \".so.sz\" %f;\n", sz);
+		writeFloat(mFile,"\tsetAttr \".so.sz\" ",sz,";\n");
 	}
 	void setDisplaySubdComps(bool dsc)
 	{
 		if(dsc == false) return;
-		fprintf(mFile,"\tsetAttr \".dsc\" %i;\n", dsc);
+		writeInt(mFile,"\tsetAttr \".dsc\" ",dsc,";\n");
 	}
 	void setUseMaxEdgeLength(bool uxe)
 	{
 		if(uxe == false) return;
-		fprintf(mFile,"\tsetAttr \".uxe\" %i;\n", uxe);
+		writeInt(mFile,"\tsetAttr \".uxe\" ",uxe,";\n");
 	}
 	void setUseMinEdgeLength(bool uie)
 	{
 		if(uie == false) return;
-		fprintf(mFile,"\tsetAttr \".uie\" %i;\n", uie);
+		writeInt(mFile,"\tsetAttr \".uie\" ",uie,";\n");
 	}
 	void setUseMaxSubdivisions(bool uxs)
 	{
 		if(uxs == false) return;
-		fprintf(mFile,"\tsetAttr \".uxs\" %i;\n", uxs);
+		writeInt(mFile,"\tsetAttr \".uxs\" ",uxs,";\n");
 	}
 	void setUseMaxUV(bool uxu)
 	{
 		if(uxu == false) return;
-		fprintf(mFile,"\tsetAttr \".uxu\" %i;\n", uxu);
+		writeInt(mFile,"\tsetAttr \".uxu\" ",uxu,";\n");
 	}
 	void setUseMinScreen(bool uns)
 	{
 		if(uns == true) return;
-		fprintf(mFile,"\tsetAttr \".uns\" %i;\n", uns);
+		writeInt(mFile,"\tsetAttr \".uns\" ",uns,";\n");
 	}
 	void setUseNumTriangles(bool unp)
 	{
 		if(unp == false) return;
-		fprintf(mFile,"\tsetAttr \".unp\" %i;\n", unp);
+		writeInt(mFile,"\tsetAttr \".unp\" ",unp,";\n");
 	}
 	void setNumTriangles(int nt)
 	{
 		if(nt == 100) return;
-		fprintf(mFile,"\tsetAttr \".nt\" %i;\n", nt);
+		writeInt(mFile,"\tsetAttr \".nt\" ",nt,";\n");
 	}
 	void setMaxEdgeLength(float mxe)
 	{
 		if(mxe == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".mxe\" %f;\n", mxe);
+		writeFloat(mFile,"\tsetAttr \".mxe\" ",mxe,";\n");
 	}
 	void setMinEdgeLength(float mne)
 	{
 		if(mne == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".mne\" %f;\n", mne);
+		writeFloat(mFile,"\tsetAttr \".mne\" ",mne,";\n");
 	}
 	void setMaxSubd(int mxs)
 	{
 		if(mxs == 5) return;
-		fprintf(mFile,"\tsetAttr \".mxs\" %i;\n", mxs);
+		writeInt(mFile,"\tsetAttr \".mxs\" ",mxs,";\n");
 	}
 	void setMaxUv(float xuv)
 	{
 		if(xuv == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".xuv\" %f;\n", xuv);
+		writeFloat(mFile,"\tsetAttr \".xuv\" ",xuv,";\n");
 	}
 	void setMinScreen(float mns)
 	{
 		if(mns == 14) return;
-		fprintf(mFile,"\tsetAttr \".mns\" %f;\n", mns);
+		writeFloat(mFile,"\tsetAttr \".mns\" ",mns,";\n");
 	}
 	void setMaxTriangles(int tsl)
 	{
 		if(tsl == 60000) return;
-		fprintf(mFile,"\tsetAttr \".tsl\" %i;\n", tsl);
+		writeInt(mFile,"\tsetAttr \".tsl\" ",tsl,";\n");
 	}
 	void setPnts(size_t pt_i,const float3& pt)
 	{
-		fprintf(mFile,"\tsetAttr \".pt[%i]\" -type \"float3\" ",pt_i);
+		writeInt(mFile,"\tsetAttr \".pt[",pt_i,"]\" -type \"float3\" ");
 		pt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPnts(size_t pt_start,size_t pt_end,float* pt)
 	{
-		fprintf(mFile,"\tsetAttr \".pt[%i:%i]\" ", pt_start,pt_end);
+		writeInt(mFile,"\tsetAttr \".pt[",pt_start); writeInt(mFile,":",pt_end,"]\" ");
 		size_t size = (pt_end-pt_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",pt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",pt[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPnts(size_t pt_start,size_t pt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pt[%i:%i]\"",pt_start,pt_end);
+		writeInt(mFile,"\tsetAttr \".pt[",pt_start); writeInt(mFile,":",pt_end,"]\"");
 	}
 	void appendPnts(float pt)const
 	{
-		fprintf(mFile," %f",pt);
+		writeFloat(mFile," ",pt);
 	}
 	void endPnts()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPntx(size_t pt_i,float px)
 	{
 		if(px == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt[%i].px\" %f;\n", pt_i,px);
+		writeInt(mFile,"\tsetAttr \".pt[",pt_i); writeFloat(mFile,"].px\" ",px,";\n");
 	}
 	void setPnty(size_t pt_i,float py)
 	{
 		if(py == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt[%i].py\" %f;\n", pt_i,py);
+		writeInt(mFile,"\tsetAttr \".pt[",pt_i); writeFloat(mFile,"].py\" ",py,";\n");
 	}
 	void setPntz(size_t pt_i,float pz)
 	{
 		if(pz == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt[%i].pz\" %f;\n", pt_i,pz);
+		writeInt(mFile,"\tsetAttr \".pt[",pt_i); writeFloat(mFile,"].pz\" ",pz,";\n");
 	}
 	void setVrts(size_t vt_i,const float3& vt)
 	{
-		fprintf(mFile,"\tsetAttr \".vt[%i]\" -type \"float3\" ",vt_i);
+		writeInt(mFile,"\tsetAttr \".vt[",vt_i,"]\" -type \"float3\" ");
 		vt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVrts(size_t vt_start,size_t vt_end,float* vt)
 	{
-		fprintf(mFile,"\tsetAttr \".vt[%i:%i]\" ", vt_start,vt_end);
+		writeInt(mFile,"\tsetAttr \".vt[",vt_start); writeInt(mFile,":",vt_end,"]\" ");
 		size_t size = (vt_end-vt_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",vt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",vt[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVrts(size_t vt_start,size_t vt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".vt[%i:%i]\"",vt_start,vt_end);
+		writeInt(mFile,"\tsetAttr \".vt[",vt_start); writeInt(mFile,":",vt_end,"]\"");
 	}
 	void appendVrts(float vt)const
 	{
-		fprintf(mFile," %f",vt);
+		writeFloat(mFile," ",vt);
 	}
 	void endVrts()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVrtx(size_t vt_i,float vx)
 	{
 		if(vx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt[%i].vx\" %f;\n", vt_i,vx);
+		writeInt(mFile,"\tsetAttr \".vt[",vt_i); writeFloat(mFile,"].vx\" ",vx,";\n");
 	}
 	void setVrty(size_t vt_i,float vy)
 	{
 		if(vy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt[%i].vy\" %f;\n", vt_i,vy);
+		writeInt(mFile,"\tsetAttr \".vt[",vt_i); writeFloat(mFile,"].vy\" ",vy,";\n");
 	}
 	void setVrtz(size_t vt_i,float vz)
 	{
 		if(vz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt[%i].vz\" %f;\n", vt_i,vz);
+		writeInt(mFile,"\tsetAttr \".vt[",vt_i); writeFloat(mFile,"].vz\" ",vz,";\n");
 	}
 	void setEdge(size_t ed_i,const long3& ed)
 	{
-		fprintf(mFile,"\tsetAttr \".ed[%i]\" -type \"long3\" ",ed_i);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_i,"]\" -type \"long3\" ");
 		ed.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEdge(size_t ed_start,size_t ed_end,int* ed)
 	{
-		fprintf(mFile,"\tsetAttr \".ed[%i:%i]\" ", ed_start,ed_end);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_start); writeInt(mFile,":",ed_end,"]\" ");
 		size_t size = (ed_end-ed_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ed[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ed[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEdge(size_t ed_start,size_t ed_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ed[%i:%i]\"",ed_start,ed_end);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_start); writeInt(mFile,":",ed_end,"]\"");
 	}
 	void appendEdge(int ed)const
 	{
-		fprintf(mFile," %i",ed);
+		writeInt(mFile," ",ed);
 	}
 	void endEdge()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEdg1(size_t ed_i,int e1)
 	{
 		if(e1 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ed[%i].e1\" %i;\n", ed_i,e1);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_i); writeInt(mFile,"].e1\" ",e1,";\n");
 	}
 	void setEdg2(size_t ed_i,int e2)
 	{
 		if(e2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ed[%i].e2\" %i;\n", ed_i,e2);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_i); writeInt(mFile,"].e2\" ",e2,";\n");
 	}
 	void setEdgh(size_t ed_i,int eh)
 	{
 		if(eh == 0) return;
-		fprintf(mFile,"\tsetAttr \".ed[%i].eh\" %i;\n", ed_i,eh);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_i); writeInt(mFile,"].eh\" ",eh,";\n");
 	}
 	void setUvpt(size_t uv_i,const float2& uv)
 	{
-		fprintf(mFile,"\tsetAttr \".uv[%i]\" -type \"float2\" ",uv_i);
+		writeInt(mFile,"\tsetAttr \".uv[",uv_i,"]\" -type \"float2\" ");
 		uv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvpt(size_t uv_start,size_t uv_end,float* uv)
 	{
-		fprintf(mFile,"\tsetAttr \".uv[%i:%i]\" ", uv_start,uv_end);
+		writeInt(mFile,"\tsetAttr \".uv[",uv_start); writeInt(mFile,":",uv_end,"]\" ");
 		size_t size = (uv_end-uv_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",uv[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startUvpt(size_t uv_start,size_t uv_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".uv[%i:%i]\"",uv_start,uv_end);
+		writeInt(mFile,"\tsetAttr \".uv[",uv_start); writeInt(mFile,":",uv_end,"]\"");
 	}
 	void appendUvpt(float uv)const
 	{
-		fprintf(mFile," %f",uv);
+		writeFloat(mFile," ",uv);
 	}
 	void endUvpt()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvpx(size_t uv_i,float ux)
 	{
 		if(ux == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uv[%i].ux\" %f;\n", uv_i,ux);
+		writeInt(mFile,"\tsetAttr \".uv[",uv_i); writeFloat(mFile,"].ux\" ",ux,";\n");
 	}
 	void setUvpy(size_t uv_i,float uy)
 	{
 		if(uy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uv[%i].uy\" %f;\n", uv_i,uy);
+		writeInt(mFile,"\tsetAttr \".uv[",uv_i); writeFloat(mFile,"].uy\" ",uy,";\n");
 	}
 	void setColors(size_t clr_i,const Colors& clr)
 	{
-		fprintf(mFile,"\tsetAttr \".clr[%i]\" ",clr_i);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i,"]\" ");
 		clr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColors(size_t clr_start,size_t clr_end,Colors* clr)
 	{
-		fprintf(mFile,"\tsetAttr \".clr[%i:%i]\" ", clr_start,clr_end);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_start); writeInt(mFile,":",clr_end,"]\" ");
 		size_t size = (clr_end-clr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			clr[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColors(size_t clr_start,size_t clr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".clr[%i:%i]\"",clr_start,clr_end);
-		fprintf(mFile," -type \"Colors\" ");
+		writeInt(mFile,"\tsetAttr \".clr[",clr_start); writeInt(mFile,":",clr_end,"]\"");
+		writeString(mFile," -type \"Colors\" ");
 	}
 	void appendColors(const Colors& clr)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		clr.write(mFile);
 	}
 	void endColors()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(size_t clr_i,float clrr)
 	{
 		if(clrr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clrr\" %f;\n", clr_i,clrr);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeFloat(mFile,"].clrr\" ",clrr,";\n");
 	}
 	void setColorG(size_t clr_i,float clrg)
 	{
 		if(clrg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clrg\" %f;\n", clr_i,clrg);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeFloat(mFile,"].clrg\" ",clrg,";\n");
 	}
 	void setColorB(size_t clr_i,float clrb)
 	{
 		if(clrb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clrb\" %f;\n", clr_i,clrb);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeFloat(mFile,"].clrb\" ",clrb,";\n");
 	}
 	void setColorA(size_t clr_i,float clra)
 	{
 		if(clra == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clra\" %f;\n", clr_i,clra);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeFloat(mFile,"].clra\" ",clra,";\n");
 	}
 	void setNormals(size_t n_i,const float3& n)
 	{
-		fprintf(mFile,"\tsetAttr \".n[%i]\" -type \"float3\" ",n_i);
+		writeInt(mFile,"\tsetAttr \".n[",n_i,"]\" -type \"float3\" ");
 		n.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNormals(size_t n_start,size_t n_end,float* n)
 	{
-		fprintf(mFile,"\tsetAttr \".n[%i:%i]\" ", n_start,n_end);
+		writeInt(mFile,"\tsetAttr \".n[",n_start); writeInt(mFile,":",n_end,"]\" ");
 		size_t size = (n_end-n_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",n[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",n[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startNormals(size_t n_start,size_t n_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".n[%i:%i]\"",n_start,n_end);
+		writeInt(mFile,"\tsetAttr \".n[",n_start); writeInt(mFile,":",n_end,"]\"");
 	}
 	void appendNormals(float n)const
 	{
-		fprintf(mFile," %f",n);
+		writeFloat(mFile," ",n);
 	}
 	void endNormals()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNormalx(size_t n_i,float nx)
 	{
 		if(nx == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".n[%i].nx\" %f;\n", n_i,nx);
+		writeInt(mFile,"\tsetAttr \".n[",n_i); writeFloat(mFile,"].nx\" ",nx,";\n");
 	}
 	void setNormaly(size_t n_i,float ny)
 	{
 		if(ny == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".n[%i].ny\" %f;\n", n_i,ny);
+		writeInt(mFile,"\tsetAttr \".n[",n_i); writeFloat(mFile,"].ny\" ",ny,";\n");
 	}
 	void setNormalz(size_t n_i,float nz)
 	{
 		if(nz == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".n[%i].nz\" %f;\n", n_i,nz);
+		writeInt(mFile,"\tsetAttr \".n[",n_i); writeFloat(mFile,"].nz\" ",nz,";\n");
 	}
 	void setFace(size_t fc_i,const polyFaces& fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i]\" -type \"polyFaces\" ",fc_i);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i,"]\" -type \"polyFaces\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFace(size_t fc_start,size_t fc_end,polyFaces* fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i:%i]\" ", fc_start,fc_end);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_start); writeInt(mFile,":",fc_end,"]\" ");
 		size_t size = (fc_end-fc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			fc[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFace(size_t fc_start,size_t fc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i:%i]\"",fc_start,fc_end);
-		fprintf(mFile," -type \"polyFaces\" ");
+		writeInt(mFile,"\tsetAttr \".fc[",fc_start); writeInt(mFile,":",fc_end,"]\"");
+		writeString(mFile," -type \"polyFaces\" ");
 	}
 	void appendFace(const polyFaces& fc)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		fc.write(mFile);
 	}
 	void endFace()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorPerVertex(const ColorPerVertex& cpvx)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx\" ");
+		writeString(mFile,"\tsetAttr \".cpvx\" ");
 		cpvx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexColor(size_t vclr_i,const ColorPerVertex::VertexColor& vclr)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i]\" ",vclr_i);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i,"]\" ");
 		vclr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexColor(size_t vclr_start,size_t vclr_end,ColorPerVertex::VertexColor* vclr)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i:%i]\" ", vclr_start,vclr_end);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_start); writeInt(mFile,":",vclr_end,"]\" ");
 		size_t size = (vclr_end-vclr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vclr[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexColor(size_t vclr_start,size_t vclr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i:%i]\"",vclr_start,vclr_end);
-		fprintf(mFile," -type \"ColorPerVertex::VertexColor\" ");
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_start); writeInt(mFile,":",vclr_end,"]\"");
+		writeString(mFile," -type \"ColorPerVertex::VertexColor\" ");
 	}
 	void appendVertexColor(const ColorPerVertex::VertexColor& vclr)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vclr.write(mFile);
 	}
 	void endVertexColor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexColorRGB(size_t vclr_i,const float3& vrgb)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vrgb\" -type \"float3\" ",vclr_i);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i,"].vrgb\" -type \"float3\" ");
 		vrgb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexColorR(size_t vclr_i,float vxcr)
 	{
 		if(vxcr == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vrgb.vxcr\" %f;\n", vclr_i,vxcr);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeFloat(mFile,"].vrgb.vxcr\" ",vxcr,";\n");
 	}
 	void setVertexColorG(size_t vclr_i,float vxcg)
 	{
 		if(vxcg == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vrgb.vxcg\" %f;\n", vclr_i,vxcg);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeFloat(mFile,"].vrgb.vxcg\" ",vxcg,";\n");
 	}
 	void setVertexColorB(size_t vclr_i,float vxcb)
 	{
 		if(vxcb == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vrgb.vxcb\" %f;\n", vclr_i,vxcb);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeFloat(mFile,"].vrgb.vxcb\" ",vxcb,";\n");
 	}
 	void setVertexAlpha(size_t vclr_i,float vxal)
 	{
 		if(vxal == 1) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vxal\" %f;\n", vclr_i,vxal);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeFloat(mFile,"].vxal\" ",vxal,";\n");
 	}
 	void setVertexFaceColor(size_t vclr_i,size_t vfcl_i,const ColorPerVertex::VertexColor::VertexFaceColor& vfcl)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i]\" ",vclr_i,vfcl_i);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"]\" ");
 		vfcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceColor(size_t vclr_i,size_t vfcl_start,size_t vfcl_end,ColorPerVertex::VertexColor::VertexFaceColor* vfcl)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i:%i]\" ", vclr_i,vfcl_start,vfcl_end);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_start); writeInt(mFile,":",vfcl_end,"]\" ");
 		size_t size = (vfcl_end-vfcl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vfcl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexFaceColor(size_t vclr_i,size_t vfcl_start,size_t vfcl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i:%i]\"",vclr_i,vfcl_start,vfcl_end);
-		fprintf(mFile," -type \"ColorPerVertex::VertexColor::VertexFaceColor\" ");
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_start); writeInt(mFile,":",vfcl_end,"]\"");
+		writeString(mFile," -type \"ColorPerVertex::VertexColor::VertexFaceColor\" ");
 	}
 	void appendVertexFaceColor(const ColorPerVertex::VertexColor::VertexFaceColor& vfcl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vfcl.write(mFile);
 	}
 	void endVertexFaceColor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceColorRGB(size_t vclr_i,size_t vfcl_i,const float3& frgb)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].frgb\" -type \"float3\" ",vclr_i,vfcl_i);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb\" -type \"float3\" ");
 		frgb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceColorR(size_t vclr_i,size_t vfcl_i,float vfcr)
 	{
 		if(vfcr == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].frgb.vfcr\" %f;\n", vclr_i,vfcl_i,vfcr);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i); writeFloat(mFile,"].frgb.vfcr\" ",vfcr,";\n");
 	}
 	void setVertexFaceColorG(size_t vclr_i,size_t vfcl_i,float vfcg)
 	{
 		if(vfcg == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].frgb.vfcg\" %f;\n", vclr_i,vfcl_i,vfcg);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i); writeFloat(mFile,"].frgb.vfcg\" ",vfcg,";\n");
 	}
 	void setVertexFaceColorB(size_t vclr_i,size_t vfcl_i,float vfcb)
 	{
 		if(vfcb == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].frgb.vfcb\" %f;\n", vclr_i,vfcl_i,vfcb);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i); writeFloat(mFile,"].frgb.vfcb\" ",vfcb,";\n");
 	}
 	void setVertexFaceAlpha(size_t vclr_i,size_t vfcl_i,float vfal)
 	{
 		if(vfal == 1) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].vfal\" %f;\n", vclr_i,vfcl_i,vfal);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i); writeFloat(mFile,"].vfal\" ",vfal,";\n");
 	}
 	void setNormalPerVertex(const NormalPerVertex& npvx)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx\" ");
+		writeString(mFile,"\tsetAttr \".npvx\" ");
 		npvx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexNormal(size_t vn_i,const NormalPerVertex::VertexNormal& vn)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i]\" ",vn_i);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i,"]\" ");
 		vn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexNormal(size_t vn_start,size_t vn_end,NormalPerVertex::VertexNormal* vn)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i:%i]\" ", vn_start,vn_end);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_start); writeInt(mFile,":",vn_end,"]\" ");
 		size_t size = (vn_end-vn_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vn[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexNormal(size_t vn_start,size_t vn_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i:%i]\"",vn_start,vn_end);
-		fprintf(mFile," -type \"NormalPerVertex::VertexNormal\" ");
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_start); writeInt(mFile,":",vn_end,"]\"");
+		writeString(mFile," -type \"NormalPerVertex::VertexNormal\" ");
 	}
 	void appendVertexNormal(const NormalPerVertex::VertexNormal& vn)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vn.write(mFile);
 	}
 	void endVertexNormal()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexNormalXYZ(size_t vn_i,const float3& nxyz)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].nxyz\" -type \"float3\" ",vn_i);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i,"].nxyz\" -type \"float3\" ");
 		nxyz.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexNormalX(size_t vn_i,float vxnx)
 	{
 		if(vxnx == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].nxyz.vxnx\" %f;\n", vn_i,vxnx);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeFloat(mFile,"].nxyz.vxnx\" ",vxnx,";\n");
 	}
 	void setVertexNormalY(size_t vn_i,float vxny)
 	{
 		if(vxny == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].nxyz.vxny\" %f;\n", vn_i,vxny);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeFloat(mFile,"].nxyz.vxny\" ",vxny,";\n");
 	}
 	void setVertexNormalZ(size_t vn_i,float vxnz)
 	{
 		if(vxnz == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].nxyz.vxnz\" %f;\n", vn_i,vxnz);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeFloat(mFile,"].nxyz.vxnz\" ",vxnz,";\n");
 	}
 	void setVertexFaceNormal(size_t vn_i,size_t vfnl_i,const NormalPerVertex::VertexNormal::VertexFaceNormal& vfnl)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i]\" ",vn_i,vfnl_i);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i,"]\" ");
 		vfnl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceNormal(size_t vn_i,size_t vfnl_start,size_t vfnl_end,NormalPerVertex::VertexNormal::VertexFaceNormal* vfnl)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i:%i]\" ", vn_i,vfnl_start,vfnl_end);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_start); writeInt(mFile,":",vfnl_end,"]\" ");
 		size_t size = (vfnl_end-vfnl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vfnl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexFaceNormal(size_t vn_i,size_t vfnl_start,size_t vfnl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i:%i]\"",vn_i,vfnl_start,vfnl_end);
-		fprintf(mFile," -type \"NormalPerVertex::VertexNormal::VertexFaceNormal\" ");
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_start); writeInt(mFile,":",vfnl_end,"]\"");
+		writeString(mFile," -type \"NormalPerVertex::VertexNormal::VertexFaceNormal\" ");
 	}
 	void appendVertexFaceNormal(const NormalPerVertex::VertexNormal::VertexFaceNormal& vfnl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vfnl.write(mFile);
 	}
 	void endVertexFaceNormal()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceNormalXYZ(size_t vn_i,size_t vfnl_i,const float3& fnxy)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i].fnxy\" -type \"float3\" ",vn_i,vfnl_i);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i,"].fnxy\" -type \"float3\" ");
 		fnxy.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceNormalX(size_t vn_i,size_t vfnl_i,float vfnx)
 	{
 		if(vfnx == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i].fnxy.vfnx\" %f;\n", vn_i,vfnl_i,vfnx);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i); writeFloat(mFile,"].fnxy.vfnx\" ",vfnx,";\n");
 	}
 	void setVertexFaceNormalY(size_t vn_i,size_t vfnl_i,float vfny)
 	{
 		if(vfny == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i].fnxy.vfny\" %f;\n", vn_i,vfnl_i,vfny);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i); writeFloat(mFile,"].fnxy.vfny\" ",vfny,";\n");
 	}
 	void setVertexFaceNormalZ(size_t vn_i,size_t vfnl_i,float vfnz)
 	{
 		if(vfnz == 1e20) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i].fnxy.vfnz\" %f;\n", vn_i,vfnl_i,vfnz);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i); writeFloat(mFile,"].fnxy.vfnz\" ",vfnz,";\n");
 	}
 	void setDisplayVertices(bool dv)
 	{
 		if(dv == false) return;
-		fprintf(mFile,"\tsetAttr \".dv\" %i;\n", dv);
+		writeInt(mFile,"\tsetAttr \".dv\" ",dv,";\n");
 	}
 	void setDisplayBorders(bool db)
 	{
 		if(db == false) return;
-		fprintf(mFile,"\tsetAttr \".db\" %i;\n", db);
+		writeInt(mFile,"\tsetAttr \".db\" ",db,";\n");
 	}
 	void setDisplayFacesWithGroupId(int dfgi)
 	{
 		if(dfgi == -2) return;
-		fprintf(mFile,"\tsetAttr \".dfgi\" %i;\n", dfgi);
+		writeInt(mFile,"\tsetAttr \".dfgi\" ",dfgi,";\n");
 	}
 	void setDisplayCenter(bool dc)
 	{
 		if(dc == false) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %i;\n", dc);
+		writeInt(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void setDisplayTriangles(bool dt)
 	{
 		if(dt == false) return;
-		fprintf(mFile,"\tsetAttr \".dt\" %i;\n", dt);
+		writeInt(mFile,"\tsetAttr \".dt\" ",dt,";\n");
 	}
 	void setDisplayUVs(bool duv)
 	{
 		if(duv == false) return;
-		fprintf(mFile,"\tsetAttr \".duv\" %i;\n", duv);
+		writeInt(mFile,"\tsetAttr \".duv\" ",duv,";\n");
 	}
 	void setDisplayItemNumbers(int din)
 	{
 		if(din == 0) return;
-		fprintf(mFile,"\tsetAttr \".din\" %i;\n", din);
+		writeInt(mFile,"\tsetAttr \".din\" ",din,";\n");
 	}
 	void setDisplayNonPlanar(bool dnp)
 	{
 		if(dnp == false) return;
-		fprintf(mFile,"\tsetAttr \".dnp\" %i;\n", dnp);
+		writeInt(mFile,"\tsetAttr \".dnp\" ",dnp,";\n");
 	}
 	void setBackfaceCulling(unsigned int bck)
 	{
 		if(bck == 0) return;
-		fprintf(mFile,"\tsetAttr \".bck\" %i;\n", bck);
+		writeInt(mFile,"\tsetAttr \".bck\" ",bck,";\n");
 	}
 	void setVertexBackfaceCulling(bool vbc)
 	{
 		if(vbc == true) return;
-		fprintf(mFile,"\tsetAttr \".vbc\" %i;\n", vbc);
+		writeInt(mFile,"\tsetAttr \".vbc\" ",vbc,";\n");
 	}
 	void setVertexSize(double vs)
 	{
 		if(vs == 3.0) return;
-		fprintf(mFile,"\tsetAttr \".vs\" %f;\n", vs);
+		writeFloat(mFile,"\tsetAttr \".vs\" ",vs,";\n");
 	}
 	void setUvSize(double usz)
 	{
 		if(usz == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".usz\" %f;\n", usz);
+		writeFloat(mFile,"\tsetAttr \".usz\" ",usz,";\n");
 	}
 	void setBorderWidth(double bw)
 	{
 		if(bw == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".bw\" %f;\n", bw);
+		writeFloat(mFile,"\tsetAttr \".bw\" ",bw,";\n");
 	}
 	void setNormalSize(double ns)
 	{
 		if(ns == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".ns\" %f;\n", ns);
+		writeFloat(mFile,"\tsetAttr \".ns\" ",ns,";\n");
 	}
 	void setNormalType(unsigned int ndt)
 	{
 		if(ndt == 0) return;
-		fprintf(mFile,"\tsetAttr \".ndt\" %i;\n", ndt);
+		writeInt(mFile,"\tsetAttr \".ndt\" ",ndt,";\n");
 	}
 	void setDisplayNormal(bool dn)
 	{
 		if(dn == false) return;
-		fprintf(mFile,"\tsetAttr \".dn\" %i;\n", dn);
+		writeInt(mFile,"\tsetAttr \".dn\" ",dn,";\n");
 	}
 	void setDisplayTangent(bool dtn)
 	{
 		if(dtn == false) return;
-		fprintf(mFile,"\tsetAttr \".dtn\" %i;\n", dtn);
+		writeInt(mFile,"\tsetAttr \".dtn\" ",dtn,";\n");
 	}
 	void setTangentSpace(unsigned int tgsp)
 	{
 		if(tgsp == 0) return;
-		fprintf(mFile,"\tsetAttr \".tgsp\" %i;\n", tgsp);
+		writeInt(mFile,"\tsetAttr \".tgsp\" ",tgsp,";\n");
 	}
 	void setTangentSmoothingAngle(double tsa)
 	{
 		if(tsa == 0) return;
-		fprintf(mFile,"\tsetAttr \".tsa\" %f;\n", tsa);
+		writeFloat(mFile,"\tsetAttr \".tsa\" ",tsa,";\n");
 	}
 	void setTangentNormalThreshold(double tnt)
 	{
 		if(tnt == 0) return;
-		fprintf(mFile,"\tsetAttr \".tnt\" %f;\n", tnt);
+		writeFloat(mFile,"\tsetAttr \".tnt\" ",tnt,";\n");
 	}
 	void setAllowTopologyMod(bool atm)
 	{
 		if(atm == true) return;
-		fprintf(mFile,"\tsetAttr \".atm\" %i;\n", atm);
+		writeInt(mFile,"\tsetAttr \".atm\" ",atm,";\n");
 	}
 	void setMaterialBlend(unsigned int matb)
 	{
 		if(matb == 0) return;
-		fprintf(mFile,"\tsetAttr \".matb\" %i;\n", matb);
+		writeInt(mFile,"\tsetAttr \".matb\" ",matb,";\n");
 	}
 	void setUserTrg(const string& utrg)
 	{
 		if(utrg == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".utrg\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".utrg\" -type \"string\" ");
 		utrg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDispResolution(unsigned int dr)
 	{
 		if(dr == 0) return;
-		fprintf(mFile,"\tsetAttr \".dr\" %i;\n", dr);
+		writeInt(mFile,"\tsetAttr \".dr\" ",dr,";\n");
 	}
 	void setDisplaySmoothMesh(unsigned int dsm)
 	{
 		if(dsm == 0) return;
-		fprintf(mFile,"\tsetAttr \".dsm\" %i;\n", dsm);
+		writeInt(mFile,"\tsetAttr \".dsm\" ",dsm,";\n");
 	}
 	void setSmoothMeshSelectionMode(unsigned int ssm)
 	{
 		if(ssm == 0) return;
-		fprintf(mFile,"\tsetAttr \".ssm\" %i;\n", ssm);
+		writeInt(mFile,"\tsetAttr \".ssm\" ",ssm,";\n");
 	}
 	void setReuseTriangles(bool rtri)
 	{
 		if(rtri == false) return;
-		fprintf(mFile,"\tsetAttr \".rtri\" %i;\n", rtri);
+		writeInt(mFile,"\tsetAttr \".rtri\" ",rtri,";\n");
 	}
 	void setQuadSplit(unsigned int qsp)
 	{
 		if(qsp == 2) return;
-		fprintf(mFile,"\tsetAttr \".qsp\" %i;\n", qsp);
+		writeInt(mFile,"\tsetAttr \".qsp\" ",qsp,";\n");
 	}
 	void setPerInstanceIndex(size_t pii_i,int pii)
 	{
 		if(pii == -1) return;
-		fprintf(mFile,"\tsetAttr \".pii[%i]\" %i;\n", pii_i,pii);
+		writeInt(mFile,"\tsetAttr \".pii[",pii_i); writeInt(mFile,"]\" ",pii,";\n");
 	}
 	void setPerInstanceIndex(size_t pii_start,size_t pii_end,int* pii)
 	{
-		fprintf(mFile,"\tsetAttr \".pii[%i:%i]\" ", pii_start,pii_end);
+		writeInt(mFile,"\tsetAttr \".pii[",pii_start); writeInt(mFile,":",pii_end,"]\" ");
 		size_t size = (pii_end-pii_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",pii[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",pii[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPerInstanceIndex(size_t pii_start,size_t pii_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pii[%i:%i]\"",pii_start,pii_end);
+		writeInt(mFile,"\tsetAttr \".pii[",pii_start); writeInt(mFile,":",pii_end,"]\"");
 	}
 	void appendPerInstanceIndex(int pii)const
 	{
-		fprintf(mFile," %i",pii);
+		writeInt(mFile," ",pii);
 	}
 	void endPerInstanceIndex()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPerInstanceTag(size_t pit_i,int pit)
 	{
 		if(pit == -1) return;
-		fprintf(mFile,"\tsetAttr \".pit[%i]\" %i;\n", pit_i,pit);
+		writeInt(mFile,"\tsetAttr \".pit[",pit_i); writeInt(mFile,"]\" ",pit,";\n");
 	}
 	void setPerInstanceTag(size_t pit_start,size_t pit_end,int* pit)
 	{
-		fprintf(mFile,"\tsetAttr \".pit[%i:%i]\" ", pit_start,pit_end);
+		writeInt(mFile,"\tsetAttr \".pit[",pit_start); writeInt(mFile,":",pit_end,"]\" ");
 		size_t size = (pit_end-pit_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",pit[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",pit[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPerInstanceTag(size_t pit_start,size_t pit_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pit[%i:%i]\"",pit_start,pit_end);
+		writeInt(mFile,"\tsetAttr \".pit[",pit_start); writeInt(mFile,":",pit_end,"]\"");
 	}
 	void appendPerInstanceTag(int pit)const
 	{
-		fprintf(mFile," %i",pit);
+		writeInt(mFile," ",pit);
 	}
 	void endPerInstanceTag()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiOverrideCaustics(bool oca)
 	{
 		if(oca == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oca\" %i;\n", oca);
+		writeInt(mFile,"\tsetAttr \".mrc.oca\" ",oca,";\n");
 	}
 	void setMiCausticAccuracy(short caa)
 	{
 		if(caa == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.caa\" %i;\n", caa);
+		writeInt(mFile,"\tsetAttr \".mrc.caa\" ",caa,";\n");
 	}
 	void setMiCausticRadius(float car)
 	{
 		if(car == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.car\" %f;\n", car);
+		writeFloat(mFile,"\tsetAttr \".mrc.car\" ",car,";\n");
 	}
 	void setMiOverrideGlobalIllumination(bool ogi)
 	{
 		if(ogi == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ogi\" %i;\n", ogi);
+		writeInt(mFile,"\tsetAttr \".mrc.ogi\" ",ogi,";\n");
 	}
 	void setMiGlobillumAccuracy(short gia)
 	{
 		if(gia == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gia\" %i;\n", gia);
+		writeInt(mFile,"\tsetAttr \".mrc.gia\" ",gia,";\n");
 	}
 	void setMiGlobillumRadius(float gir)
 	{
 		if(gir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gir\" %f;\n", gir);
+		writeFloat(mFile,"\tsetAttr \".mrc.gir\" ",gir,";\n");
 	}
 	void setMiOverrideFinalGather(bool ofg)
 	{
 		if(ofg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ofg\" %i;\n", ofg);
+		writeInt(mFile,"\tsetAttr \".mrc.ofg\" ",ofg,";\n");
 	}
 	void setMiFinalGatherRays(int fry)
 	{
 		if(fry == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fry\" %i;\n", fry);
+		writeInt(mFile,"\tsetAttr \".mrc.fry\" ",fry,";\n");
 	}
 	void setMiFinalGatherMinRadius(float fmn)
 	{
 		if(fmn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmn\" %f;\n", fmn);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmn\" ",fmn,";\n");
 	}
 	void setMiFinalGatherMaxRadius(float fmx)
 	{
 		if(fmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmx\" %f;\n", fmx);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmx\" ",fmx,";\n");
 	}
 	void setMiFinalGatherFilter(short ffi)
 	{
 		if(ffi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ffi\" %i;\n", ffi);
+		writeInt(mFile,"\tsetAttr \".mrc.ffi\" ",ffi,";\n");
 	}
 	void setMiFinalGatherView(bool fgv)
 	{
 		if(fgv == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgv\" %i;\n", fgv);
+		writeInt(mFile,"\tsetAttr \".mrc.fgv\" ",fgv,";\n");
 	}
 	void setMiOverrideSamples(bool oos)
 	{
 		if(oos == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oos\" %i;\n", oos);
+		writeInt(mFile,"\tsetAttr \".mrc.oos\" ",oos,";\n");
 	}
 	void setMiMinSamples(short mins)
 	{
 		if(mins == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mins\" %i;\n", mins);
+		writeInt(mFile,"\tsetAttr \".mrc.mins\" ",mins,";\n");
 	}
 	void setMiMaxSamples(short maxs)
 	{
 		if(maxs == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.maxs\" %i;\n", maxs);
+		writeInt(mFile,"\tsetAttr \".mrc.maxs\" ",maxs,";\n");
 	}
 	void setMiFinalGatherCast(bool fgc)
 	{
 		if(fgc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgc\" %i;\n", fgc);
+		writeInt(mFile,"\tsetAttr \".mrc.fgc\" ",fgc,";\n");
 	}
 	void setMiFinalGatherReceive(bool fge)
 	{
 		if(fge == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fge\" %i;\n", fge);
+		writeInt(mFile,"\tsetAttr \".mrc.fge\" ",fge,";\n");
 	}
 	void setMiTransparencyCast(bool tpc)
 	{
 		if(tpc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpc\" %i;\n", tpc);
+		writeInt(mFile,"\tsetAttr \".mrc.tpc\" ",tpc,";\n");
 	}
 	void setMiTransparencyReceive(bool tpr)
 	{
 		if(tpr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpr\" %i;\n", tpr);
+		writeInt(mFile,"\tsetAttr \".mrc.tpr\" ",tpr,";\n");
 	}
 	void setMiReflectionReceive(bool rflr)
 	{
 		if(rflr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.rflr\" %i;\n", rflr);
+		writeInt(mFile,"\tsetAttr \".mrc.rflr\" ",rflr,";\n");
 	}
 	void setMiRefractionReceive(bool rfrr)
 	{
 		if(rfrr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.rfrr\" %i;\n", rfrr);
+		writeInt(mFile,"\tsetAttr \".mrc.rfrr\" ",rfrr,";\n");
 	}
 	void setDisplayAlphaAsGreyScale(bool dags)
 	{
 		if(dags == false) return;
-		fprintf(mFile,"\tsetAttr \".dags\" %i;\n", dags);
+		writeInt(mFile,"\tsetAttr \".dags\" ",dags,";\n");
 	}
 	void getInMesh()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutMesh()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutGeometryClean()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getWorldMesh(size_t w_i)const
 	{
-		fprintf(mFile,"\"%s.w[%i]\"",mName.c_str(),w_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".w[",w_i,"]\"");
 	}
 	void getWorldMesh()const
 	{
 
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getOutSmoothMesh()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getCachedSmoothMesh()const
 	{
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getSmoothWarn()const
 	{
-		fprintf(mFile,"\"%s.sw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sw\"");
 	}
 	void getSmoothLevel()const
 	{
-		fprintf(mFile,"\"%s.lev\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lev\"");
 	}
 	void getContinuity()const
 	{
-		fprintf(mFile,"\"%s.co\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co\"");
 	}
 	void getSmoothUVs()const
 	{
-		fprintf(mFile,"\"%s.suv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".suv\"");
 	}
 	void getKeepBorder()const
 	{
-		fprintf(mFile,"\"%s.kb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kb\"");
 	}
 	void getKeepHardEdge()const
 	{
-		fprintf(mFile,"\"%s.khe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".khe\"");
 	}
 	void getPropagateEdgeHardness()const
 	{
-		fprintf(mFile,"\"%s.peh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".peh\"");
 	}
 	void getKeepMapBorders()const
 	{
-		fprintf(mFile,"\"%s.kmb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kmb\"");
 	}
 	void getSmoothOffset()const
 	{
-		fprintf(mFile,"\"%s.so\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so\"");
 	}
 	void getSofx()const
 	{
-		fprintf(mFile,"\"%s.so.sx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sx\"");
 	}
 	void getSofy()const
 	{
-		fprintf(mFile,"\"%s.so.sy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sy\"");
 	}
 	void getSofz()const
 	{
-		fprintf(mFile,"\"%s.so.sz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so.sz\"");
 	}
 	void getDisplaySubdComps()const
 	{
-		fprintf(mFile,"\"%s.dsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsc\"");
 	}
 	void getUseMaxEdgeLength()const
 	{
-		fprintf(mFile,"\"%s.uxe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uxe\"");
 	}
 	void getUseMinEdgeLength()const
 	{
-		fprintf(mFile,"\"%s.uie\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uie\"");
 	}
 	void getUseMaxSubdivisions()const
 	{
-		fprintf(mFile,"\"%s.uxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uxs\"");
 	}
 	void getUseMaxUV()const
 	{
-		fprintf(mFile,"\"%s.uxu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uxu\"");
 	}
 	void getUseMinScreen()const
 	{
-		fprintf(mFile,"\"%s.uns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uns\"");
 	}
 	void getUseNumTriangles()const
 	{
-		fprintf(mFile,"\"%s.unp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unp\"");
 	}
 	void getNumTriangles()const
 	{
-		fprintf(mFile,"\"%s.nt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nt\"");
 	}
 	void getMaxEdgeLength()const
 	{
-		fprintf(mFile,"\"%s.mxe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxe\"");
 	}
 	void getMinEdgeLength()const
 	{
-		fprintf(mFile,"\"%s.mne\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mne\"");
 	}
 	void getMaxSubd()const
 	{
-		fprintf(mFile,"\"%s.mxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxs\"");
 	}
 	void getMaxUv()const
 	{
-		fprintf(mFile,"\"%s.xuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xuv\"");
 	}
 	void getMinScreen()const
 	{
-		fprintf(mFile,"\"%s.mns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mns\"");
 	}
 	void getMaxTriangles()const
 	{
-		fprintf(mFile,"\"%s.tsl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tsl\"");
 	}
 	void getPnts(size_t pt_i)const
 	{
-		fprintf(mFile,"\"%s.pt[%i]\"",mName.c_str(),pt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pt[",pt_i,"]\"");
 	}
 	void getPnts()const
 	{
 
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getPntx(size_t pt_i)const
 	{
-		fprintf(mFile,"\"%s.pt[%i].px\"",mName.c_str(),pt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pt[",pt_i,"].px\"");
 	}
 	void getPntx()const
 	{
 
-		fprintf(mFile,"\"%s.pt.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.px\"");
 	}
 	void getPnty(size_t pt_i)const
 	{
-		fprintf(mFile,"\"%s.pt[%i].py\"",mName.c_str(),pt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pt[",pt_i,"].py\"");
 	}
 	void getPnty()const
 	{
 
-		fprintf(mFile,"\"%s.pt.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.py\"");
 	}
 	void getPntz(size_t pt_i)const
 	{
-		fprintf(mFile,"\"%s.pt[%i].pz\"",mName.c_str(),pt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pt[",pt_i,"].pz\"");
 	}
 	void getPntz()const
 	{
 
-		fprintf(mFile,"\"%s.pt.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.pz\"");
 	}
 	void getVrtx(size_t vt_i)const
 	{
-		fprintf(mFile,"\"%s.vt[%i].vx\"",mName.c_str(),vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt[",vt_i,"].vx\"");
 	}
 	void getVrtx()const
 	{
 
-		fprintf(mFile,"\"%s.vt.vx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt.vx\"");
 	}
 	void getVrty(size_t vt_i)const
 	{
-		fprintf(mFile,"\"%s.vt[%i].vy\"",mName.c_str(),vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt[",vt_i,"].vy\"");
 	}
 	void getVrty()const
 	{
 
-		fprintf(mFile,"\"%s.vt.vy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt.vy\"");
 	}
 	void getVrtz(size_t vt_i)const
 	{
-		fprintf(mFile,"\"%s.vt[%i].vz\"",mName.c_str(),vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt[",vt_i,"].vz\"");
 	}
 	void getVrtz()const
 	{
 
-		fprintf(mFile,"\"%s.vt.vz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt.vz\"");
 	}
 	void getEdg1(size_t ed_i)const
 	{
-		fprintf(mFile,"\"%s.ed[%i].e1\"",mName.c_str(),ed_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ed[",ed_i,"].e1\"");
 	}
 	void getEdg1()const
 	{
 
-		fprintf(mFile,"\"%s.ed.e1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed.e1\"");
 	}
 	void getEdg2(size_t ed_i)const
 	{
-		fprintf(mFile,"\"%s.ed[%i].e2\"",mName.c_str(),ed_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ed[",ed_i,"].e2\"");
 	}
 	void getEdg2()const
 	{
 
-		fprintf(mFile,"\"%s.ed.e2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed.e2\"");
 	}
 	void getEdgh(size_t ed_i)const
 	{
-		fprintf(mFile,"\"%s.ed[%i].eh\"",mName.c_str(),ed_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ed[",ed_i,"].eh\"");
 	}
 	void getEdgh()const
 	{
 
-		fprintf(mFile,"\"%s.ed.eh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed.eh\"");
 	}
 	void getUvpx(size_t uv_i)const
 	{
-		fprintf(mFile,"\"%s.uv[%i].ux\"",mName.c_str(),uv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uv[",uv_i,"].ux\"");
 	}
 	void getUvpx()const
 	{
 
-		fprintf(mFile,"\"%s.uv.ux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.ux\"");
 	}
 	void getUvpy(size_t uv_i)const
 	{
-		fprintf(mFile,"\"%s.uv[%i].uy\"",mName.c_str(),uv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uv[",uv_i,"].uy\"");
 	}
 	void getUvpy()const
 	{
 
-		fprintf(mFile,"\"%s.uv.uy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.uy\"");
 	}
 	void getColorPerVertex()const
 	{
-		fprintf(mFile,"\"%s.cpvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpvx\"");
 	}
 	void getVertexColor(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i]\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"]\"");
 	}
 	void getVertexColorRGB(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vrgb\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vrgb\"");
 	}
 	void getVertexColorR(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vrgb.vxcr\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vrgb.vxcr\"");
 	}
 	void getVertexColorG(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vrgb.vxcg\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vrgb.vxcg\"");
 	}
 	void getVertexColorB(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vrgb.vxcb\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vrgb.vxcb\"");
 	}
 	void getVertexAlpha(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vxal\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vxal\"");
 	}
 	void getVertexFaceColor(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i]\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"]\"");
 	}
 	void getVertexFaceColorRGB(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].frgb\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb\"");
 	}
 	void getVertexFaceColorR(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].frgb.vfcr\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb.vfcr\"");
 	}
 	void getVertexFaceColorG(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].frgb.vfcg\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb.vfcg\"");
 	}
 	void getVertexFaceColorB(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].frgb.vfcb\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb.vfcb\"");
 	}
 	void getVertexFaceAlpha(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].vfal\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].vfal\"");
 	}
 	void getDisplayVertices()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getDisplayBorders()const
 	{
-		fprintf(mFile,"\"%s.db\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".db\"");
 	}
 	void getDisplayEdges()const
 	{
-		fprintf(mFile,"\"%s.de\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".de\"");
 	}
 	void getDisplayFacesWithGroupId()const
 	{
-		fprintf(mFile,"\"%s.dfgi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfgi\"");
 	}
 	void getDisplayCenter()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getDisplayTriangles()const
 	{
-		fprintf(mFile,"\"%s.dt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dt\"");
 	}
 	void getDisplayUVs()const
 	{
-		fprintf(mFile,"\"%s.duv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".duv\"");
 	}
 	void getDisplayItemNumbers()const
 	{
-		fprintf(mFile,"\"%s.din\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".din\"");
 	}
 	void getDisplayNonPlanar()const
 	{
-		fprintf(mFile,"\"%s.dnp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dnp\"");
 	}
 	void getBackfaceCulling()const
 	{
-		fprintf(mFile,"\"%s.bck\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bck\"");
 	}
 	void getVertexBackfaceCulling()const
 	{
-		fprintf(mFile,"\"%s.vbc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vbc\"");
 	}
 	void getVertexSize()const
 	{
-		fprintf(mFile,"\"%s.vs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vs\"");
 	}
 	void getUvSize()const
 	{
-		fprintf(mFile,"\"%s.usz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".usz\"");
 	}
 	void getBorderWidth()const
 	{
-		fprintf(mFile,"\"%s.bw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bw\"");
 	}
 	void getNormalSize()const
 	{
-		fprintf(mFile,"\"%s.ns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ns\"");
 	}
 	void getNormalType()const
 	{
-		fprintf(mFile,"\"%s.ndt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ndt\"");
 	}
 	void getDisplayNormal()const
 	{
-		fprintf(mFile,"\"%s.dn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dn\"");
 	}
 	void getDisplayTangent()const
 	{
-		fprintf(mFile,"\"%s.dtn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtn\"");
 	}
 	void getTangentSpace()const
 	{
-		fprintf(mFile,"\"%s.tgsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tgsp\"");
 	}
 	void getTangentSmoothingAngle()const
 	{
-		fprintf(mFile,"\"%s.tsa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tsa\"");
 	}
 	void getTangentNormalThreshold()const
 	{
-		fprintf(mFile,"\"%s.tnt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnt\"");
 	}
 	void getAllowTopologyMod()const
 	{
-		fprintf(mFile,"\"%s.atm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atm\"");
 	}
 	void getMaterialBlend()const
 	{
-		fprintf(mFile,"\"%s.matb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".matb\"");
 	}
 	void getUvTweakLocation()const
 	{
-		fprintf(mFile,"\"%s.uvtl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvtl\"");
 	}
 	void getUserTrg()const
 	{
-		fprintf(mFile,"\"%s.utrg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".utrg\"");
 	}
 	void getDispResolution()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getReuseTriangles()const
 	{
-		fprintf(mFile,"\"%s.rtri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtri\"");
 	}
 	void getQuadSplit()const
 	{
-		fprintf(mFile,"\"%s.qsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".qsp\"");
 	}
 	void getPerInstanceIndex(size_t pii_i)const
 	{
-		fprintf(mFile,"\"%s.pii[%i]\"",mName.c_str(),pii_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pii[",pii_i,"]\"");
 	}
 	void getPerInstanceIndex()const
 	{
 
-		fprintf(mFile,"\"%s.pii\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pii\"");
 	}
 	void getPerInstanceTag(size_t pit_i)const
 	{
-		fprintf(mFile,"\"%s.pit[%i]\"",mName.c_str(),pit_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pit[",pit_i,"]\"");
 	}
 	void getPerInstanceTag()const
 	{
 
-		fprintf(mFile,"\"%s.pit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pit\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiOverrideCaustics()const
 	{
-		fprintf(mFile,"\"%s.mrc.oca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oca\"");
 	}
 	void getMiCausticAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.caa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.caa\"");
 	}
 	void getMiCausticRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.car\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.car\"");
 	}
 	void getMiOverrideGlobalIllumination()const
 	{
-		fprintf(mFile,"\"%s.mrc.ogi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ogi\"");
 	}
 	void getMiGlobillumAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.gia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gia\"");
 	}
 	void getMiGlobillumRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.gir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gir\"");
 	}
 	void getMiOverrideFinalGather()const
 	{
-		fprintf(mFile,"\"%s.mrc.ofg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ofg\"");
 	}
 	void getMiFinalGatherRays()const
 	{
-		fprintf(mFile,"\"%s.mrc.fry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fry\"");
 	}
 	void getMiFinalGatherMinRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmn\"");
 	}
 	void getMiFinalGatherMaxRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmx\"");
 	}
 	void getMiFinalGatherFilter()const
 	{
-		fprintf(mFile,"\"%s.mrc.ffi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ffi\"");
 	}
 	void getMiFinalGatherView()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgv\"");
 	}
 	void getMiOverrideSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.oos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oos\"");
 	}
 	void getMiMinSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.mins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mins\"");
 	}
 	void getMiMaxSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.maxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.maxs\"");
 	}
 	void getMiFinalGatherCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgc\"");
 	}
 	void getMiFinalGatherReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.fge\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fge\"");
 	}
 	void getMiTransparencyCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpc\"");
 	}
 	void getMiTransparencyReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpr\"");
 	}
 	void getMiReflectionReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.rflr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.rflr\"");
 	}
 	void getMiRefractionReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.rfrr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.rfrr\"");
 	}
 	void getDisplayAlphaAsGreyScale()const
 	{
-		fprintf(mFile,"\"%s.dags\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dags\"");
 	}
 protected:
 	Mesh(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
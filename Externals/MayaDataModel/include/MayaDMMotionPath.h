@@ -27,304 +27,304 @@ public:
 	void setUValue(double u)
 	{
 		if(u == 0) return;
-		fprintf(mFile,"\tsetAttr \".u\" %f;\n", u);
+		writeFloat(mFile,"\tsetAttr \".u\" ",u,";\n");
 	}
 	void setFrontTwist(double ft)
 	{
 		if(ft == 0) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %f;\n", ft);
+		writeFloat(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setUpTwist(double ut)
 	{
 		if(ut == 0) return;
-		fprintf(mFile,"\tsetAttr \".ut\" %f;\n", ut);
+		writeFloat(mFile,"\tsetAttr \".ut\" ",ut,";\n");
 	}
 	void setSideTwist(double st)
 	{
 		if(st == 0) return;
-		fprintf(mFile,"\tsetAttr \".st\" %f;\n", st);
+		writeFloat(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void setRotateOrder(unsigned int ro)
 	{
 		if(ro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %i;\n", ro);
+		writeInt(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void setPositionMarkerTime(size_t pmt_i,double pmt)
 	{
 		if(pmt == 0) return;
-		fprintf(mFile,"\tsetAttr \".pmt[%i]\" %f;\n", pmt_i,pmt);
+		writeInt(mFile,"\tsetAttr \".pmt[",pmt_i); writeFloat(mFile,"]\" ",pmt,";\n");
 	}
 	void setPositionMarkerTime(size_t pmt_start,size_t pmt_end,double* pmt)
 	{
-		fprintf(mFile,"\tsetAttr \".pmt[%i:%i]\" ", pmt_start,pmt_end);
+		writeInt(mFile,"\tsetAttr \".pmt[",pmt_start); writeInt(mFile,":",pmt_end,"]\" ");
 		size_t size = (pmt_end-pmt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",pmt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",pmt[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPositionMarkerTime(size_t pmt_start,size_t pmt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pmt[%i:%i]\"",pmt_start,pmt_end);
+		writeInt(mFile,"\tsetAttr \".pmt[",pmt_start); writeInt(mFile,":",pmt_end,"]\"");
 	}
 	void appendPositionMarkerTime(double pmt)const
 	{
-		fprintf(mFile," %f",pmt);
+		writeFloat(mFile," ",pmt);
 	}
 	void endPositionMarkerTime()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOrientationMarkerTime(size_t omt_i,double omt)
 	{
 		if(omt == 0) return;
-		fprintf(mFile,"\tsetAttr \".omt[%i]\" %f;\n", omt_i,omt);
+		writeInt(mFile,"\tsetAttr \".omt[",omt_i); writeFloat(mFile,"]\" ",omt,";\n");
 	}
 	void setOrientationMarkerTime(size_t omt_start,size_t omt_end,double* omt)
 	{
-		fprintf(mFile,"\tsetAttr \".omt[%i:%i]\" ", omt_start,omt_end);
+		writeInt(mFile,"\tsetAttr \".omt[",omt_start); writeInt(mFile,":",omt_end,"]\" ");
 		size_t size = (omt_end-omt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",omt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",omt[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startOrientationMarkerTime(size_t omt_start,size_t omt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".omt[%i:%i]\"",omt_start,omt_end);
+		writeInt(mFile,"\tsetAttr \".omt[",omt_start); writeInt(mFile,":",omt_end,"]\"");
 	}
 	void appendOrientationMarkerTime(double omt)const
 	{
-		fprintf(mFile," %f",omt);
+		writeFloat(mFile," ",omt);
 	}
 	void endOrientationMarkerTime()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFollow(bool f)
 	{
 		if(f == false) return;
-		fprintf(mFile,"\tsetAttr \".f\" %i;\n", f);
+		writeInt(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void setNormal(bool nr)
 	{
 		if(nr == false) return;
-		fprintf(mFile,"\tsetAttr \".nr\" %i;\n", nr);
+		writeInt(mFile,"\tsetAttr \".nr\" ",nr,";\n");
 	}
 	void setInverseUp(bool iu)
 	{
 		if(iu == false) return;
-		fprintf(mFile,"\tsetAttr \".iu\" %i;\n", iu);
+		writeInt(mFile,"\tsetAttr \".iu\" ",iu,";\n");
 	}
 	void setInverseFront(bool if_)
 	{
 		if(if_ == false) return;
-		fprintf(mFile,"\tsetAttr \".if\" %i;\n", if_);
+		writeInt(mFile,"\tsetAttr \".if\" ",if_,";\n");
 	}
 	void setFrontAxis(unsigned int fa)
 	{
 		if(fa == 1) return;
-		fprintf(mFile,"\tsetAttr \".fa\" %i;\n", fa);
+		writeInt(mFile,"\tsetAttr \".fa\" ",fa,";\n");
 	}
 	void setUpAxis(unsigned int ua)
 	{
 		if(ua == 2) return;
-		fprintf(mFile,"\tsetAttr \".ua\" %i;\n", ua);
+		writeInt(mFile,"\tsetAttr \".ua\" ",ua,";\n");
 	}
 	void setWorldUpType(unsigned int wut)
 	{
 		if(wut == 3) return;
-		fprintf(mFile,"\tsetAttr \".wut\" %i;\n", wut);
+		writeInt(mFile,"\tsetAttr \".wut\" ",wut,";\n");
 	}
 	void setWorldUpVector(const double3& wu)
 	{
-		fprintf(mFile,"\tsetAttr \".wu\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".wu\" -type \"double3\" ");
 		wu.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWorldUpVectorX(double wux)
 	{
 		if(wux == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wu.wux\" %f;\n", wux);
+		writeFloat(mFile,"\tsetAttr \".wu.wux\" ",wux,";\n");
 	}
 	void setWorldUpVectorY(double wuy)
 	{
 		if(wuy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wu.wuy\" %f;\n", wuy);
+		writeFloat(mFile,"\tsetAttr \".wu.wuy\" ",wuy,";\n");
 	}
 	void setWorldUpVectorZ(double wuz)
 	{
 		if(wuz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wu.wuz\" %f;\n", wuz);
+		writeFloat(mFile,"\tsetAttr \".wu.wuz\" ",wuz,";\n");
 	}
 	void setWorldUpMatrix(const matrix& wum)
 	{
 		if(wum == identity) return;
-		fprintf(mFile,"\tsetAttr \".wum\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".wum\" -type \"matrix\" ");
 		wum.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBank(bool b)
 	{
 		if(b == false) return;
-		fprintf(mFile,"\tsetAttr \".b\" %i;\n", b);
+		writeInt(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setBankScale(double bs)
 	{
 		if(bs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bs\" %f;\n", bs);
+		writeFloat(mFile,"\tsetAttr \".bs\" ",bs,";\n");
 	}
 	void setBankLimit(double bl)
 	{
 		if(bl == 9) return;
-		fprintf(mFile,"\tsetAttr \".bl\" %f;\n", bl);
+		writeFloat(mFile,"\tsetAttr \".bl\" ",bl,";\n");
 	}
 	void setFractionMode(bool fm)
 	{
 		if(fm == false) return;
-		fprintf(mFile,"\tsetAttr \".fm\" %i;\n", fm);
+		writeInt(mFile,"\tsetAttr \".fm\" ",fm,";\n");
 	}
 	void getUValue()const
 	{
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getFrontTwist()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getUpTwist()const
 	{
-		fprintf(mFile,"\"%s.ut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ut\"");
 	}
 	void getSideTwist()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getAllCoordinates()const
 	{
-		fprintf(mFile,"\"%s.ac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac\"");
 	}
 	void getXCoordinate()const
 	{
-		fprintf(mFile,"\"%s.ac.xc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.xc\"");
 	}
 	void getYCoordinate()const
 	{
-		fprintf(mFile,"\"%s.ac.yc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.yc\"");
 	}
 	void getZCoordinate()const
 	{
-		fprintf(mFile,"\"%s.ac.zc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac.zc\"");
 	}
 	void getOrientMatrix()const
 	{
-		fprintf(mFile,"\"%s.om\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".om\"");
 	}
 	void getRotate()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRotateX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRotateY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRotateZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getRotateOrder()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getFlowNode()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getGeometryPath()const
 	{
-		fprintf(mFile,"\"%s.gp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gp\"");
 	}
 	void getPositionMarkerTime(size_t pmt_i)const
 	{
-		fprintf(mFile,"\"%s.pmt[%i]\"",mName.c_str(),pmt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pmt[",pmt_i,"]\"");
 	}
 	void getPositionMarkerTime()const
 	{
 
-		fprintf(mFile,"\"%s.pmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmt\"");
 	}
 	void getOrientationMarkerTime(size_t omt_i)const
 	{
-		fprintf(mFile,"\"%s.omt[%i]\"",mName.c_str(),omt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".omt[",omt_i,"]\"");
 	}
 	void getOrientationMarkerTime()const
 	{
 
-		fprintf(mFile,"\"%s.omt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omt\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.nr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr\"");
 	}
 	void getInverseUp()const
 	{
-		fprintf(mFile,"\"%s.iu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iu\"");
 	}
 	void getInverseFront()const
 	{
-		fprintf(mFile,"\"%s.if\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".if\"");
 	}
 	void getFrontAxis()const
 	{
-		fprintf(mFile,"\"%s.fa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fa\"");
 	}
 	void getUpAxis()const
 	{
-		fprintf(mFile,"\"%s.ua\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ua\"");
 	}
 	void getWorldUpType()const
 	{
-		fprintf(mFile,"\"%s.wut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wut\"");
 	}
 	void getWorldUpVector()const
 	{
-		fprintf(mFile,"\"%s.wu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu\"");
 	}
 	void getWorldUpVectorX()const
 	{
-		fprintf(mFile,"\"%s.wu.wux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu.wux\"");
 	}
 	void getWorldUpVectorY()const
 	{
-		fprintf(mFile,"\"%s.wu.wuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu.wuy\"");
 	}
 	void getWorldUpVectorZ()const
 	{
-		fprintf(mFile,"\"%s.wu.wuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu.wuz\"");
 	}
 	void getWorldUpMatrix()const
 	{
-		fprintf(mFile,"\"%s.wum\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wum\"");
 	}
 	void getBank()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getBankScale()const
 	{
-		fprintf(mFile,"\"%s.bs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bs\"");
 	}
 	void getBankLimit()const
 	{
-		fprintf(mFile,"\"%s.bl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bl\"");
 	}
 protected:
 	MotionPath(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,150 +27,150 @@ public:
 	void setSnowColor(const float3& sc)
 	{
 		if(sc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSnowColorR(float scr)
 	{
 		if(scr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scr\" %f;\n", scr);
+		writeFloat(mFile,"\tsetAttr \".sc.scr\" ",scr,";\n");
 	}
 	void setSnowColorG(float scg)
 	{
 		if(scg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scg\" %f;\n", scg);
+		writeFloat(mFile,"\tsetAttr \".sc.scg\" ",scg,";\n");
 	}
 	void setSnowColorB(float scb)
 	{
 		if(scb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.scb\" %f;\n", scb);
+		writeFloat(mFile,"\tsetAttr \".sc.scb\" ",scb,";\n");
 	}
 	void setRockColor(const float3& rc)
 	{
 		if(rc == float3(0.262f,0.102f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
 		rc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRockColorR(float rcr)
 	{
 		if(rcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rcr\" %f;\n", rcr);
+		writeFloat(mFile,"\tsetAttr \".rc.rcr\" ",rcr,";\n");
 	}
 	void setRockColorG(float rcg)
 	{
 		if(rcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rcg\" %f;\n", rcg);
+		writeFloat(mFile,"\tsetAttr \".rc.rcg\" ",rcg,";\n");
 	}
 	void setRockColorB(float rcb)
 	{
 		if(rcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rcb\" %f;\n", rcb);
+		writeFloat(mFile,"\tsetAttr \".rc.rcb\" ",rcb,";\n");
 	}
 	void setAmplitude(float a)
 	{
 		if(a == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setSnowRoughness(float sr)
 	{
 		if(sr == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setRockRoughness(float rr)
 	{
 		if(rr == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".rr\" %f;\n", rr);
+		writeFloat(mFile,"\tsetAttr \".rr\" ",rr,";\n");
 	}
 	void setBoundary(float bo)
 	{
 		if(bo == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bo\" %f;\n", bo);
+		writeFloat(mFile,"\tsetAttr \".bo\" ",bo,";\n");
 	}
 	void setSnowAltitude(float sa)
 	{
 		if(sa == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sa\" %f;\n", sa);
+		writeFloat(mFile,"\tsetAttr \".sa\" ",sa,";\n");
 	}
 	void setSnowDropoff(float sd)
 	{
 		if(sd == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %f;\n", sd);
+		writeFloat(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void setSnowSlope(float ss)
 	{
 		if(ss == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %f;\n", ss);
+		writeFloat(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setDepthMax(float dmx)
 	{
 		if(dmx == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".dmx\" %f;\n", dmx);
+		writeFloat(mFile,"\tsetAttr \".dmx\" ",dmx,";\n");
 	}
 	void getSnowColor()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getSnowColorR()const
 	{
-		fprintf(mFile,"\"%s.sc.scr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scr\"");
 	}
 	void getSnowColorG()const
 	{
-		fprintf(mFile,"\"%s.sc.scg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scg\"");
 	}
 	void getSnowColorB()const
 	{
-		fprintf(mFile,"\"%s.sc.scb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scb\"");
 	}
 	void getRockColor()const
 	{
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getRockColorR()const
 	{
-		fprintf(mFile,"\"%s.rc.rcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rcr\"");
 	}
 	void getRockColorG()const
 	{
-		fprintf(mFile,"\"%s.rc.rcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rcg\"");
 	}
 	void getRockColorB()const
 	{
-		fprintf(mFile,"\"%s.rc.rcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rcb\"");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getSnowRoughness()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getRockRoughness()const
 	{
-		fprintf(mFile,"\"%s.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rr\"");
 	}
 	void getBoundary()const
 	{
-		fprintf(mFile,"\"%s.bo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo\"");
 	}
 	void getSnowAltitude()const
 	{
-		fprintf(mFile,"\"%s.sa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sa\"");
 	}
 	void getSnowDropoff()const
 	{
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getSnowSlope()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.dmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmx\"");
 	}
 protected:
 	Mountain(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
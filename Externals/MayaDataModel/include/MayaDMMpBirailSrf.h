@@ -27,29 +27,29 @@ public:
 	void setTangentContinuityProfile1(bool tp1)
 	{
 		if(tp1 == false) return;
-		fprintf(mFile,"\tsetAttr \".tp1\" %i;\n", tp1);
+		writeInt(mFile,"\tsetAttr \".tp1\" ",tp1,";\n");
 	}
 	void setTangentContinuityProfile2(bool tp2)
 	{
 		if(tp2 == false) return;
-		fprintf(mFile,"\tsetAttr \".tp2\" %i;\n", tp2);
+		writeInt(mFile,"\tsetAttr \".tp2\" ",tp2,";\n");
 	}
 	void getInputProfile(size_t ip_i)const
 	{
-		fprintf(mFile,"\"%s.ip[%i]\"",mName.c_str(),ip_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ip[",ip_i,"]\"");
 	}
 	void getInputProfile()const
 	{
 
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getTangentContinuityProfile1()const
 	{
-		fprintf(mFile,"\"%s.tp1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp1\"");
 	}
 	void getTangentContinuityProfile2()const
 	{
-		fprintf(mFile,"\"%s.tp2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp2\"");
 	}
 protected:
 	MpBirailSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
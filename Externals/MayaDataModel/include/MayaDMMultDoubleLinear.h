@@ -27,24 +27,24 @@ public:
 	void setInput1(double i1)
 	{
 		if(i1 == 0) return;
-		fprintf(mFile,"\tsetAttr \".i1\" %f;\n", i1);
+		writeFloat(mFile,"\tsetAttr \".i1\" ",i1,";\n");
 	}
 	void setInput2(double i2)
 	{
 		if(i2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".i2\" %f;\n", i2);
+		writeFloat(mFile,"\tsetAttr \".i2\" ",i2,";\n");
 	}
 	void getInput1()const
 	{
-		fprintf(mFile,"\"%s.i1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i1\"");
 	}
 	void getInput2()const
 	{
-		fprintf(mFile,"\"%s.i2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i2\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	MultDoubleLinear(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
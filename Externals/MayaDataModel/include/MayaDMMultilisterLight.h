@@ -27,100 +27,100 @@ public:
 	void setPointCamera(const float3& p)
 	{
 		if(p == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".p\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"float3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointCameraX(float px)
 	{
 		if(px == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPointCameraY(float py)
 	{
 		if(py == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setPointCameraZ(float pz)
 	{
 		if(pz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".p.pz\" ",pz,";\n");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getLightData()const
 	{
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection()const
 	{
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX()const
 	{
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY()const
 	{
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity()const
 	{
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR()const
 	{
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG()const
 	{
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB()const
 	{
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient()const
 	{
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse()const
 	{
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular()const
 	{
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction()const
 	{
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity()const
 	{
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData()const
 	{
-		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbd\"");
 	}
 protected:
 	MultilisterLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,32 +27,32 @@ public:
 	void setHoldTime(double ht)
 	{
 		if(ht == 0) return;
-		fprintf(mFile,"\tsetAttr \".ht\" %f;\n", ht);
+		writeFloat(mFile,"\tsetAttr \".ht\" ",ht,";\n");
 	}
 	void setMute(bool m)
 	{
 		if(m == false) return;
-		fprintf(mFile,"\tsetAttr \".m\" %i;\n", m);
+		writeInt(mFile,"\tsetAttr \".m\" ",m,";\n");
 	}
 	void getInput()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getHold()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getHoldTime()const
 	{
-		fprintf(mFile,"\"%s.ht\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ht\"");
 	}
 	void getMute()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	Mute(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,546 +27,546 @@ public:
 	void setNumSubdivisions(int nsub)
 	{
 		if(nsub == 2) return;
-		fprintf(mFile,"\tsetAttr \".nsub\" %i;\n", nsub);
+		writeInt(mFile,"\tsetAttr \".nsub\" ",nsub,";\n");
 	}
 	void setScalingRelation(unsigned int srl)
 	{
 		if(srl == 0) return;
-		fprintf(mFile,"\tsetAttr \".srl\" %i;\n", srl);
+		writeInt(mFile,"\tsetAttr \".srl\" ",srl,";\n");
 	}
 	void setStretchResistance(float stch)
 	{
 		if(stch == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".stch\" %f;\n", stch);
+		writeFloat(mFile,"\tsetAttr \".stch\" ",stch,";\n");
 	}
 	void setCompressionResistance(float comr)
 	{
 		if(comr == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".comr\" %f;\n", comr);
+		writeFloat(mFile,"\tsetAttr \".comr\" ",comr,";\n");
 	}
 	void setStretchMap(float stmp)
 	{
 		if(stmp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".stmp\" %f;\n", stmp);
+		writeFloat(mFile,"\tsetAttr \".stmp\" ",stmp,";\n");
 	}
 	void setStretchPerVertex(const doubleArray& spv)
 	{
 		if(spv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".spv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".spv\" -type \"doubleArray\" ");
 		spv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBendResistance(float bnd)
 	{
 		if(bnd == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".bnd\" %f;\n", bnd);
+		writeFloat(mFile,"\tsetAttr \".bnd\" ",bnd,";\n");
 	}
 	void setBendMap(float bemp)
 	{
 		if(bemp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bemp\" %f;\n", bemp);
+		writeFloat(mFile,"\tsetAttr \".bemp\" ",bemp,";\n");
 	}
 	void setBendPerVertex(const doubleArray& bdpv)
 	{
 		if(bdpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".bdpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".bdpv\" -type \"doubleArray\" ");
 		bdpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBendAngleDropoff(float bnad)
 	{
 		if(bnad == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bnad\" %f;\n", bnad);
+		writeFloat(mFile,"\tsetAttr \".bnad\" ",bnad,";\n");
 	}
 	void setRestitutionTension(float retn)
 	{
 		if(retn == 1000.0) return;
-		fprintf(mFile,"\tsetAttr \".retn\" %f;\n", retn);
+		writeFloat(mFile,"\tsetAttr \".retn\" ",retn,";\n");
 	}
 	void setRestitutionAngle(float reae)
 	{
 		if(reae == 3) return;
-		fprintf(mFile,"\tsetAttr \".reae\" %f;\n", reae);
+		writeFloat(mFile,"\tsetAttr \".reae\" ",reae,";\n");
 	}
 	void setShearResistance(float shr)
 	{
 		if(shr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".shr\" %f;\n", shr);
+		writeFloat(mFile,"\tsetAttr \".shr\" ",shr,";\n");
 	}
 	void setRigidity(float rity)
 	{
 		if(rity == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rity\" %f;\n", rity);
+		writeFloat(mFile,"\tsetAttr \".rity\" ",rity,";\n");
 	}
 	void setRigidityMap(float rimp)
 	{
 		if(rimp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rimp\" %f;\n", rimp);
+		writeFloat(mFile,"\tsetAttr \".rimp\" ",rimp,";\n");
 	}
 	void setRigidityPerVertex(const doubleArray& rpv)
 	{
 		if(rpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".rpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".rpv\" -type \"doubleArray\" ");
 		rpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDeformResistance(float dety)
 	{
 		if(dety == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dety\" %f;\n", dety);
+		writeFloat(mFile,"\tsetAttr \".dety\" ",dety,";\n");
 	}
 	void setDeformMap(float demp)
 	{
 		if(demp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".demp\" %f;\n", demp);
+		writeFloat(mFile,"\tsetAttr \".demp\" ",demp,";\n");
 	}
 	void setDeformPerVertex(const doubleArray& dfpv)
 	{
 		if(dfpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".dfpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".dfpv\" -type \"doubleArray\" ");
 		dfpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputMeshAttract(float imat)
 	{
 		if(imat == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imat\" %f;\n", imat);
+		writeFloat(mFile,"\tsetAttr \".imat\" ",imat,";\n");
 	}
 	void setInputAttractMap(float iamp)
 	{
 		if(iamp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".iamp\" %f;\n", iamp);
+		writeFloat(mFile,"\tsetAttr \".iamp\" ",iamp,";\n");
 	}
 	void setInputAttractPerVertex(const doubleArray& iapv)
 	{
 		if(iapv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".iapv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".iapv\" -type \"doubleArray\" ");
 		iapv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputAttractDamp(float iadm)
 	{
 		if(iadm == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".iadm\" %f;\n", iadm);
+		writeFloat(mFile,"\tsetAttr \".iadm\" ",iadm,";\n");
 	}
 	void setWrinkleMap(float wkmp)
 	{
 		if(wkmp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wkmp\" %f;\n", wkmp);
+		writeFloat(mFile,"\tsetAttr \".wkmp\" ",wkmp,";\n");
 	}
 	void setWrinklePerVertex(const doubleArray& wpv)
 	{
 		if(wpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".wpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".wpv\" -type \"doubleArray\" ");
 		wpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWrinkleMapScale(float wms)
 	{
 		if(wms == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wms\" %f;\n", wms);
+		writeFloat(mFile,"\tsetAttr \".wms\" ",wms,";\n");
 	}
 	void setBendAngleScale(float basc)
 	{
 		if(basc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".basc\" %f;\n", basc);
+		writeFloat(mFile,"\tsetAttr \".basc\" ",basc,";\n");
 	}
 	void setSortLinks(bool stlk)
 	{
 		if(stlk == 0) return;
-		fprintf(mFile,"\tsetAttr \".stlk\" %i;\n", stlk);
+		writeInt(mFile,"\tsetAttr \".stlk\" ",stlk,";\n");
 	}
 	void setEvaluationOrder(unsigned int evo)
 	{
 		if(evo == 0) return;
-		fprintf(mFile,"\tsetAttr \".evo\" %i;\n", evo);
+		writeInt(mFile,"\tsetAttr \".evo\" ",evo,";\n");
 	}
 	void setAddCrossLinks(bool aclk)
 	{
 		if(aclk == true) return;
-		fprintf(mFile,"\tsetAttr \".aclk\" %i;\n", aclk);
+		writeInt(mFile,"\tsetAttr \".aclk\" ",aclk,";\n");
 	}
 	void setStretchDamp(float sdmp)
 	{
 		if(sdmp == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".sdmp\" %f;\n", sdmp);
+		writeFloat(mFile,"\tsetAttr \".sdmp\" ",sdmp,";\n");
 	}
 	void setSelfCollideWidthScale(float scws)
 	{
 		if(scws == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".scws\" %f;\n", scws);
+		writeFloat(mFile,"\tsetAttr \".scws\" ",scws,";\n");
 	}
 	void setSelfCollisionSoftness(float scsf)
 	{
 		if(scsf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scsf\" %f;\n", scsf);
+		writeFloat(mFile,"\tsetAttr \".scsf\" ",scsf,";\n");
 	}
 	void setSelfCrossoverPush(float scpu)
 	{
 		if(scpu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scpu\" %f;\n", scpu);
+		writeFloat(mFile,"\tsetAttr \".scpu\" ",scpu,";\n");
 	}
 	void setSelfTrappedCheck(bool stpc)
 	{
 		if(stpc == 0) return;
-		fprintf(mFile,"\tsetAttr \".stpc\" %i;\n", stpc);
+		writeInt(mFile,"\tsetAttr \".stpc\" ",stpc,";\n");
 	}
 	void setPressureMethod(unsigned int pmth)
 	{
 		if(pmth == 0) return;
-		fprintf(mFile,"\tsetAttr \".pmth\" %i;\n", pmth);
+		writeInt(mFile,"\tsetAttr \".pmth\" ",pmth,";\n");
 	}
 	void setPressure(float pres)
 	{
 		if(pres == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pres\" %f;\n", pres);
+		writeFloat(mFile,"\tsetAttr \".pres\" ",pres,";\n");
 	}
 	void setStartPressure(float stpe)
 	{
 		if(stpe == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".stpe\" %f;\n", stpe);
+		writeFloat(mFile,"\tsetAttr \".stpe\" ",stpe,";\n");
 	}
 	void setIncompressibility(float incm)
 	{
 		if(incm == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".incm\" %f;\n", incm);
+		writeFloat(mFile,"\tsetAttr \".incm\" ",incm,";\n");
 	}
 	void setPressureDamping(float prdg)
 	{
 		if(prdg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".prdg\" %f;\n", prdg);
+		writeFloat(mFile,"\tsetAttr \".prdg\" ",prdg,";\n");
 	}
 	void setPumpRate(float pure)
 	{
 		if(pure == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pure\" %f;\n", pure);
+		writeFloat(mFile,"\tsetAttr \".pure\" ",pure,";\n");
 	}
 	void setAirTightness(float aits)
 	{
 		if(aits == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".aits\" %f;\n", aits);
+		writeFloat(mFile,"\tsetAttr \".aits\" ",aits,";\n");
 	}
 	void setSealHoles(bool shol)
 	{
 		if(shol == true) return;
-		fprintf(mFile,"\tsetAttr \".shol\" %i;\n", shol);
+		writeInt(mFile,"\tsetAttr \".shol\" ",shol,";\n");
 	}
 	void setIgnoreSolverGravity(bool igsg)
 	{
 		if(igsg == 0) return;
-		fprintf(mFile,"\tsetAttr \".igsg\" %i;\n", igsg);
+		writeInt(mFile,"\tsetAttr \".igsg\" ",igsg,";\n");
 	}
 	void setIgnoreSolverWind(bool igsw)
 	{
 		if(igsw == 0) return;
-		fprintf(mFile,"\tsetAttr \".igsw\" %i;\n", igsw);
+		writeInt(mFile,"\tsetAttr \".igsw\" ",igsw,";\n");
 	}
 	void setWindSelfShadow(bool wssh)
 	{
 		if(wssh == 0) return;
-		fprintf(mFile,"\tsetAttr \".wssh\" %i;\n", wssh);
+		writeInt(mFile,"\tsetAttr \".wssh\" ",wssh,";\n");
 	}
 	void setLift(float lft)
 	{
 		if(lft == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".lft\" %f;\n", lft);
+		writeFloat(mFile,"\tsetAttr \".lft\" ",lft,";\n");
 	}
 	void setDrag(float drg)
 	{
 		if(drg == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".drg\" %f;\n", drg);
+		writeFloat(mFile,"\tsetAttr \".drg\" ",drg,";\n");
 	}
 	void setTangentialDrag(float tdrg)
 	{
 		if(tdrg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tdrg\" %f;\n", tdrg);
+		writeFloat(mFile,"\tsetAttr \".tdrg\" ",tdrg,";\n");
 	}
 	void setSolverDisplay(unsigned int svds)
 	{
 		if(svds == 0) return;
-		fprintf(mFile,"\tsetAttr \".svds\" %i;\n", svds);
+		writeInt(mFile,"\tsetAttr \".svds\" ",svds,";\n");
 	}
 	void setStretchMapType(unsigned int smt)
 	{
 		if(smt == 2) return;
-		fprintf(mFile,"\tsetAttr \".smt\" %i;\n", smt);
+		writeInt(mFile,"\tsetAttr \".smt\" ",smt,";\n");
 	}
 	void setBendMapType(unsigned int bdmt)
 	{
 		if(bdmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".bdmt\" %i;\n", bdmt);
+		writeInt(mFile,"\tsetAttr \".bdmt\" ",bdmt,";\n");
 	}
 	void setRigidityMapType(unsigned int rmt)
 	{
 		if(rmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".rmt\" %i;\n", rmt);
+		writeInt(mFile,"\tsetAttr \".rmt\" ",rmt,";\n");
 	}
 	void setDeformMapType(unsigned int dmmt)
 	{
 		if(dmmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".dmmt\" %i;\n", dmmt);
+		writeInt(mFile,"\tsetAttr \".dmmt\" ",dmmt,";\n");
 	}
 	void setInputAttractMapType(unsigned int iamt)
 	{
 		if(iamt == 2) return;
-		fprintf(mFile,"\tsetAttr \".iamt\" %i;\n", iamt);
+		writeInt(mFile,"\tsetAttr \".iamt\" ",iamt,";\n");
 	}
 	void setWrinkleMapType(unsigned int wmt)
 	{
 		if(wmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".wmt\" %i;\n", wmt);
+		writeInt(mFile,"\tsetAttr \".wmt\" ",wmt,";\n");
 	}
 	void getOutputMesh()const
 	{
-		fprintf(mFile,"\"%s.omsh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omsh\"");
 	}
 	void getRestShapeMesh()const
 	{
-		fprintf(mFile,"\"%s.rsmh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsmh\"");
 	}
 	void getNumSubdivisions()const
 	{
-		fprintf(mFile,"\"%s.nsub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nsub\"");
 	}
 	void getScalingRelation()const
 	{
-		fprintf(mFile,"\"%s.srl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srl\"");
 	}
 	void getStretchResistance()const
 	{
-		fprintf(mFile,"\"%s.stch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stch\"");
 	}
 	void getCompressionResistance()const
 	{
-		fprintf(mFile,"\"%s.comr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".comr\"");
 	}
 	void getStretchMap()const
 	{
-		fprintf(mFile,"\"%s.stmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stmp\"");
 	}
 	void getStretchPerVertex()const
 	{
-		fprintf(mFile,"\"%s.spv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spv\"");
 	}
 	void getBendResistance()const
 	{
-		fprintf(mFile,"\"%s.bnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bnd\"");
 	}
 	void getBendMap()const
 	{
-		fprintf(mFile,"\"%s.bemp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bemp\"");
 	}
 	void getBendPerVertex()const
 	{
-		fprintf(mFile,"\"%s.bdpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bdpv\"");
 	}
 	void getBendAngleDropoff()const
 	{
-		fprintf(mFile,"\"%s.bnad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bnad\"");
 	}
 	void getRestitutionTension()const
 	{
-		fprintf(mFile,"\"%s.retn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".retn\"");
 	}
 	void getRestitutionAngle()const
 	{
-		fprintf(mFile,"\"%s.reae\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".reae\"");
 	}
 	void getShearResistance()const
 	{
-		fprintf(mFile,"\"%s.shr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shr\"");
 	}
 	void getRigidity()const
 	{
-		fprintf(mFile,"\"%s.rity\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rity\"");
 	}
 	void getRigidityMap()const
 	{
-		fprintf(mFile,"\"%s.rimp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rimp\"");
 	}
 	void getRigidityPerVertex()const
 	{
-		fprintf(mFile,"\"%s.rpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpv\"");
 	}
 	void getDeformResistance()const
 	{
-		fprintf(mFile,"\"%s.dety\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dety\"");
 	}
 	void getDeformMap()const
 	{
-		fprintf(mFile,"\"%s.demp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".demp\"");
 	}
 	void getDeformPerVertex()const
 	{
-		fprintf(mFile,"\"%s.dfpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfpv\"");
 	}
 	void getInputMeshAttract()const
 	{
-		fprintf(mFile,"\"%s.imat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imat\"");
 	}
 	void getInputAttractMap()const
 	{
-		fprintf(mFile,"\"%s.iamp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iamp\"");
 	}
 	void getInputAttractPerVertex()const
 	{
-		fprintf(mFile,"\"%s.iapv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iapv\"");
 	}
 	void getInputAttractDamp()const
 	{
-		fprintf(mFile,"\"%s.iadm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iadm\"");
 	}
 	void getWrinkleMap()const
 	{
-		fprintf(mFile,"\"%s.wkmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wkmp\"");
 	}
 	void getWrinklePerVertex()const
 	{
-		fprintf(mFile,"\"%s.wpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wpv\"");
 	}
 	void getWrinkleMapScale()const
 	{
-		fprintf(mFile,"\"%s.wms\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wms\"");
 	}
 	void getBendAngleScale()const
 	{
-		fprintf(mFile,"\"%s.basc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".basc\"");
 	}
 	void getSortLinks()const
 	{
-		fprintf(mFile,"\"%s.stlk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stlk\"");
 	}
 	void getEvaluationOrder()const
 	{
-		fprintf(mFile,"\"%s.evo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evo\"");
 	}
 	void getAddCrossLinks()const
 	{
-		fprintf(mFile,"\"%s.aclk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aclk\"");
 	}
 	void getStretchDamp()const
 	{
-		fprintf(mFile,"\"%s.sdmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdmp\"");
 	}
 	void getMinimalStretch()const
 	{
-		fprintf(mFile,"\"%s.msso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msso\"");
 	}
 	void getMinimalBend()const
 	{
-		fprintf(mFile,"\"%s.mbso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mbso\"");
 	}
 	void getMinimalShear()const
 	{
-		fprintf(mFile,"\"%s.mshs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mshs\"");
 	}
 	void getStretchHierarchyLevels()const
 	{
-		fprintf(mFile,"\"%s.shlv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shlv\"");
 	}
 	void getStretchHierarchyPercent()const
 	{
-		fprintf(mFile,"\"%s.shpe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shpe\"");
 	}
 	void getSelfCollideWidthScale()const
 	{
-		fprintf(mFile,"\"%s.scws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scws\"");
 	}
 	void getSelfCollisionSoftness()const
 	{
-		fprintf(mFile,"\"%s.scsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scsf\"");
 	}
 	void getSelfCrossoverPush()const
 	{
-		fprintf(mFile,"\"%s.scpu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scpu\"");
 	}
 	void getSelfTrappedCheck()const
 	{
-		fprintf(mFile,"\"%s.stpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stpc\"");
 	}
 	void getPressureMethod()const
 	{
-		fprintf(mFile,"\"%s.pmth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmth\"");
 	}
 	void getPressure()const
 	{
-		fprintf(mFile,"\"%s.pres\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pres\"");
 	}
 	void getStartPressure()const
 	{
-		fprintf(mFile,"\"%s.stpe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stpe\"");
 	}
 	void getIncompressibility()const
 	{
-		fprintf(mFile,"\"%s.incm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".incm\"");
 	}
 	void getPressureDamping()const
 	{
-		fprintf(mFile,"\"%s.prdg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".prdg\"");
 	}
 	void getPumpRate()const
 	{
-		fprintf(mFile,"\"%s.pure\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pure\"");
 	}
 	void getAirTightness()const
 	{
-		fprintf(mFile,"\"%s.aits\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aits\"");
 	}
 	void getSealHoles()const
 	{
-		fprintf(mFile,"\"%s.shol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shol\"");
 	}
 	void getIgnoreSolverGravity()const
 	{
-		fprintf(mFile,"\"%s.igsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igsg\"");
 	}
 	void getIgnoreSolverWind()const
 	{
-		fprintf(mFile,"\"%s.igsw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igsw\"");
 	}
 	void getWindSelfShadow()const
 	{
-		fprintf(mFile,"\"%s.wssh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wssh\"");
 	}
 	void getLift()const
 	{
-		fprintf(mFile,"\"%s.lft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lft\"");
 	}
 	void getDrag()const
 	{
-		fprintf(mFile,"\"%s.drg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drg\"");
 	}
 	void getTangentialDrag()const
 	{
-		fprintf(mFile,"\"%s.tdrg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tdrg\"");
 	}
 	void getSolverDisplay()const
 	{
-		fprintf(mFile,"\"%s.svds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svds\"");
 	}
 	void getStretchMapType()const
 	{
-		fprintf(mFile,"\"%s.smt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smt\"");
 	}
 	void getBendMapType()const
 	{
-		fprintf(mFile,"\"%s.bdmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bdmt\"");
 	}
 	void getRigidityMapType()const
 	{
-		fprintf(mFile,"\"%s.rmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmt\"");
 	}
 	void getDeformMapType()const
 	{
-		fprintf(mFile,"\"%s.dmmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmmt\"");
 	}
 	void getInputAttractMapType()const
 	{
-		fprintf(mFile,"\"%s.iamt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iamt\"");
 	}
 	void getWrinkleMapType()const
 	{
-		fprintf(mFile,"\"%s.wmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wmt\"");
 	}
 protected:
 	NCloth(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,201 +27,201 @@ public:
 	void setComponentGroupId(int cid)
 	{
 		if(cid == 0) return;
-		fprintf(mFile,"\tsetAttr \".cid\" %i;\n", cid);
+		writeInt(mFile,"\tsetAttr \".cid\" ",cid,";\n");
 	}
 	void setComponentType(unsigned int ct)
 	{
 		if(ct == 0) return;
-		fprintf(mFile,"\tsetAttr \".ct\" %i;\n", ct);
+		writeInt(mFile,"\tsetAttr \".ct\" ",ct,";\n");
 	}
 	void setElements(unsigned int el)
 	{
 		if(el == 0) return;
-		fprintf(mFile,"\tsetAttr \".el\" %i;\n", el);
+		writeInt(mFile,"\tsetAttr \".el\" ",el,";\n");
 	}
 	void setStrength(double stn)
 	{
 		if(stn == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".stn\" %f;\n", stn);
+		writeFloat(mFile,"\tsetAttr \".stn\" ",stn,";\n");
 	}
 	void setStrengthMap(float stnm)
 	{
 		if(stnm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".stnm\" %f;\n", stnm);
+		writeFloat(mFile,"\tsetAttr \".stnm\" ",stnm,";\n");
 	}
 	void setStrengthPerVertex(const doubleArray& spv)
 	{
 		if(spv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".spv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".spv\" -type \"doubleArray\" ");
 		spv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlueStrength(double gst)
 	{
 		if(gst == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gst\" %f;\n", gst);
+		writeFloat(mFile,"\tsetAttr \".gst\" ",gst,";\n");
 	}
 	void setGlueStrengthMap(float gstm)
 	{
 		if(gstm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gstm\" %f;\n", gstm);
+		writeFloat(mFile,"\tsetAttr \".gstm\" ",gstm,";\n");
 	}
 	void setGlueStrengthPerVertex(const doubleArray& gspv)
 	{
 		if(gspv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".gspv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".gspv\" -type \"doubleArray\" ");
 		gspv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeight(double wgh)
 	{
 		if(wgh == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wgh\" %f;\n", wgh);
+		writeFloat(mFile,"\tsetAttr \".wgh\" ",wgh,";\n");
 	}
 	void setWeightMap(float wemp)
 	{
 		if(wemp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wemp\" %f;\n", wemp);
+		writeFloat(mFile,"\tsetAttr \".wemp\" ",wemp,";\n");
 	}
 	void setWeightPerVertex(const doubleArray& wpv)
 	{
 		if(wpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".wpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".wpv\" -type \"doubleArray\" ");
 		wpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTangentStrength(double tst)
 	{
 		if(tst == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tst\" %f;\n", tst);
+		writeFloat(mFile,"\tsetAttr \".tst\" ",tst,";\n");
 	}
 	void setComponentIndices(size_t ci_i,int ci)
 	{
 		if(ci == 0) return;
-		fprintf(mFile,"\tsetAttr \".ci[%i]\" %i;\n", ci_i,ci);
+		writeInt(mFile,"\tsetAttr \".ci[",ci_i); writeInt(mFile,"]\" ",ci,";\n");
 	}
 	void setComponentIndices(size_t ci_start,size_t ci_end,int* ci)
 	{
-		fprintf(mFile,"\tsetAttr \".ci[%i:%i]\" ", ci_start,ci_end);
+		writeInt(mFile,"\tsetAttr \".ci[",ci_start); writeInt(mFile,":",ci_end,"]\" ");
 		size_t size = (ci_end-ci_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ci[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ci[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startComponentIndices(size_t ci_start,size_t ci_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ci[%i:%i]\"",ci_start,ci_end);
+		writeInt(mFile,"\tsetAttr \".ci[",ci_start); writeInt(mFile,":",ci_end,"]\"");
 	}
 	void appendComponentIndices(int ci)const
 	{
-		fprintf(mFile," %i",ci);
+		writeInt(mFile," ",ci);
 	}
 	void endComponentIndices()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStrengthMapType(unsigned int smt)
 	{
 		if(smt == 2) return;
-		fprintf(mFile,"\tsetAttr \".smt\" %i;\n", smt);
+		writeInt(mFile,"\tsetAttr \".smt\" ",smt,";\n");
 	}
 	void setGlueStrengthMapType(unsigned int gsmt)
 	{
 		if(gsmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".gsmt\" %i;\n", gsmt);
+		writeInt(mFile,"\tsetAttr \".gsmt\" ",gsmt,";\n");
 	}
 	void setWeightMapType(unsigned int wmt)
 	{
 		if(wmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".wmt\" %i;\n", wmt);
+		writeInt(mFile,"\tsetAttr \".wmt\" ",wmt,";\n");
 	}
 	void getSurface()const
 	{
-		fprintf(mFile,"\"%s.srf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srf\"");
 	}
 	void getComponentGroupId()const
 	{
-		fprintf(mFile,"\"%s.cid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cid\"");
 	}
 	void getComponentType()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getElements()const
 	{
-		fprintf(mFile,"\"%s.el\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".el\"");
 	}
 	void getStrength()const
 	{
-		fprintf(mFile,"\"%s.stn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stn\"");
 	}
 	void getStrengthMap()const
 	{
-		fprintf(mFile,"\"%s.stnm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stnm\"");
 	}
 	void getStrengthPerVertex()const
 	{
-		fprintf(mFile,"\"%s.spv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spv\"");
 	}
 	void getGlueStrength()const
 	{
-		fprintf(mFile,"\"%s.gst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gst\"");
 	}
 	void getGlueStrengthMap()const
 	{
-		fprintf(mFile,"\"%s.gstm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gstm\"");
 	}
 	void getGlueStrengthPerVertex()const
 	{
-		fprintf(mFile,"\"%s.gspv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gspv\"");
 	}
 	void getWeight()const
 	{
-		fprintf(mFile,"\"%s.wgh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wgh\"");
 	}
 	void getWeightMap()const
 	{
-		fprintf(mFile,"\"%s.wemp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wemp\"");
 	}
 	void getWeightPerVertex()const
 	{
-		fprintf(mFile,"\"%s.wpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wpv\"");
 	}
 	void getTangentStrength()const
 	{
-		fprintf(mFile,"\"%s.tst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tst\"");
 	}
 	void getObjectId()const
 	{
-		fprintf(mFile,"\"%s.obid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".obid\"");
 	}
 	void getComponentIndices(size_t ci_i)const
 	{
-		fprintf(mFile,"\"%s.ci[%i]\"",mName.c_str(),ci_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ci[",ci_i,"]\"");
 	}
 	void getComponentIndices()const
 	{
 
-		fprintf(mFile,"\"%s.ci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ci\"");
 	}
 	void getOutComponent()const
 	{
-		fprintf(mFile,"\"%s.ocp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocp\"");
 	}
 	void getStrengthMapType()const
 	{
-		fprintf(mFile,"\"%s.smt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smt\"");
 	}
 	void getGlueStrengthMapType()const
 	{
-		fprintf(mFile,"\"%s.gsmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gsmt\"");
 	}
 	void getWeightMapType()const
 	{
-		fprintf(mFile,"\"%s.wmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wmt\"");
 	}
 protected:
 	NComponent(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,446 +27,446 @@ public:
 	void setPlayFromCache(bool pfc)
 	{
 		if(pfc == false) return;
-		fprintf(mFile,"\tsetAttr \".pfc\" %i;\n", pfc);
+		writeInt(mFile,"\tsetAttr \".pfc\" ",pfc,";\n");
 	}
 	void setStartPositions(const vectorArray& spns)
 	{
 		if(spns.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".spns\" -type \"vectorArray\" ");
+		writeString(mFile,"\tsetAttr \".spns\" -type \"vectorArray\" ");
 		spns.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStartVelocities(const vectorArray& sves)
 	{
 		if(sves.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".sves\" -type \"vectorArray\" ");
+		writeString(mFile,"\tsetAttr \".sves\" -type \"vectorArray\" ");
 		sves.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setThickness(float thss)
 	{
 		if(thss == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".thss\" %f;\n", thss);
+		writeFloat(mFile,"\tsetAttr \".thss\" ",thss,";\n");
 	}
 	void setThicknessMap(float thmp)
 	{
 		if(thmp == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".thmp\" %f;\n", thmp);
+		writeFloat(mFile,"\tsetAttr \".thmp\" ",thmp,";\n");
 	}
 	void setThicknessPerVertex(const doubleArray& thpv)
 	{
 		if(thpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".thpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".thpv\" -type \"doubleArray\" ");
 		thpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBounce(float boce)
 	{
 		if(boce == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".boce\" %f;\n", boce);
+		writeFloat(mFile,"\tsetAttr \".boce\" ",boce,";\n");
 	}
 	void setBounceMap(float bomp)
 	{
 		if(bomp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bomp\" %f;\n", bomp);
+		writeFloat(mFile,"\tsetAttr \".bomp\" ",bomp,";\n");
 	}
 	void setBouncePerVertex(const doubleArray& bpv)
 	{
 		if(bpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".bpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".bpv\" -type \"doubleArray\" ");
 		bpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFriction(float fron)
 	{
 		if(fron == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".fron\" %f;\n", fron);
+		writeFloat(mFile,"\tsetAttr \".fron\" ",fron,";\n");
 	}
 	void setFrictionMap(float frmp)
 	{
 		if(frmp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".frmp\" %f;\n", frmp);
+		writeFloat(mFile,"\tsetAttr \".frmp\" ",frmp,";\n");
 	}
 	void setFrictionPerVertex(const doubleArray& fpv)
 	{
 		if(fpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".fpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".fpv\" -type \"doubleArray\" ");
 		fpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDamp(float adng)
 	{
 		if(adng == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".adng\" %f;\n", adng);
+		writeFloat(mFile,"\tsetAttr \".adng\" ",adng,";\n");
 	}
 	void setDampMap(float admp)
 	{
 		if(admp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".admp\" %f;\n", admp);
+		writeFloat(mFile,"\tsetAttr \".admp\" ",admp,";\n");
 	}
 	void setDampPerVertex(const doubleArray& dpv)
 	{
 		if(dpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".dpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".dpv\" -type \"doubleArray\" ");
 		dpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionFlag(unsigned int cofl)
 	{
 		if(cofl == 2) return;
-		fprintf(mFile,"\tsetAttr \".cofl\" %i;\n", cofl);
+		writeInt(mFile,"\tsetAttr \".cofl\" ",cofl,";\n");
 	}
 	void setSelfCollisionFlag(unsigned int scfl)
 	{
 		if(scfl == 0) return;
-		fprintf(mFile,"\tsetAttr \".scfl\" %i;\n", scfl);
+		writeInt(mFile,"\tsetAttr \".scfl\" ",scfl,";\n");
 	}
 	void setMaxSelfCollisionIterations(int msci)
 	{
 		if(msci == 4) return;
-		fprintf(mFile,"\tsetAttr \".msci\" %i;\n", msci);
+		writeInt(mFile,"\tsetAttr \".msci\" ",msci,";\n");
 	}
 	void setMaxIterations(int mxit)
 	{
 		if(mxit == 500) return;
-		fprintf(mFile,"\tsetAttr \".mxit\" %i;\n", mxit);
+		writeInt(mFile,"\tsetAttr \".mxit\" ",mxit,";\n");
 	}
 	void setPointMass(float pmss)
 	{
 		if(pmss == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pmss\" %f;\n", pmss);
+		writeFloat(mFile,"\tsetAttr \".pmss\" ",pmss,";\n");
 	}
 	void setMassMap(float mamp)
 	{
 		if(mamp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mamp\" %f;\n", mamp);
+		writeFloat(mFile,"\tsetAttr \".mamp\" ",mamp,";\n");
 	}
 	void setMassPerVertex(const doubleArray& mpv)
 	{
 		if(mpv.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".mpv\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".mpv\" -type \"doubleArray\" ");
 		mpv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRestLengthScale(float rlsc)
 	{
 		if(rlsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rlsc\" %f;\n", rlsc);
+		writeFloat(mFile,"\tsetAttr \".rlsc\" ",rlsc,";\n");
 	}
 	void setActive(bool actv)
 	{
 		if(actv == 1) return;
-		fprintf(mFile,"\tsetAttr \".actv\" %i;\n", actv);
+		writeInt(mFile,"\tsetAttr \".actv\" ",actv,";\n");
 	}
 	void setCollide(bool cold)
 	{
 		if(cold == 1) return;
-		fprintf(mFile,"\tsetAttr \".cold\" %i;\n", cold);
+		writeInt(mFile,"\tsetAttr \".cold\" ",cold,";\n");
 	}
 	void setSelfCollide(bool scld)
 	{
 		if(scld == 1) return;
-		fprintf(mFile,"\tsetAttr \".scld\" %i;\n", scld);
+		writeInt(mFile,"\tsetAttr \".scld\" ",scld,";\n");
 	}
 	void setCollisionLayer(float cll)
 	{
 		if(cll == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cll\" %f;\n", cll);
+		writeFloat(mFile,"\tsetAttr \".cll\" ",cll,";\n");
 	}
 	void setWindShadowDiffusion(float wsdi)
 	{
 		if(wsdi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wsdi\" %f;\n", wsdi);
+		writeFloat(mFile,"\tsetAttr \".wsdi\" ",wsdi,";\n");
 	}
 	void setWindShadowDistance(float wsds)
 	{
 		if(wsds == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wsds\" %f;\n", wsds);
+		writeFloat(mFile,"\tsetAttr \".wsds\" ",wsds,";\n");
 	}
 	void setAirPushDistance(float apds)
 	{
 		if(apds == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".apds\" %f;\n", apds);
+		writeFloat(mFile,"\tsetAttr \".apds\" ",apds,";\n");
 	}
 	void setAirPushVorticity(float apvy)
 	{
 		if(apvy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".apvy\" %f;\n", apvy);
+		writeFloat(mFile,"\tsetAttr \".apvy\" ",apvy,";\n");
 	}
 	void setPushOut(float pou)
 	{
 		if(pou == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pou\" %f;\n", pou);
+		writeFloat(mFile,"\tsetAttr \".pou\" ",pou,";\n");
 	}
 	void setPushOutRadius(float por)
 	{
 		if(por == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".por\" %f;\n", por);
+		writeFloat(mFile,"\tsetAttr \".por\" ",por,";\n");
 	}
 	void setCrossoverPush(float cop)
 	{
 		if(cop == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cop\" %f;\n", cop);
+		writeFloat(mFile,"\tsetAttr \".cop\" ",cop,";\n");
 	}
 	void setTrappedCheck(bool tpc)
 	{
 		if(tpc == 0) return;
-		fprintf(mFile,"\tsetAttr \".tpc\" %i;\n", tpc);
+		writeInt(mFile,"\tsetAttr \".tpc\" ",tpc,";\n");
 	}
 	void setThicknessMapType(unsigned int tmt)
 	{
 		if(tmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".tmt\" %i;\n", tmt);
+		writeInt(mFile,"\tsetAttr \".tmt\" ",tmt,";\n");
 	}
 	void setBounceMapType(unsigned int bmt)
 	{
 		if(bmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".bmt\" %i;\n", bmt);
+		writeInt(mFile,"\tsetAttr \".bmt\" ",bmt,";\n");
 	}
 	void setFrictionMapType(unsigned int fmt)
 	{
 		if(fmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".fmt\" %i;\n", fmt);
+		writeInt(mFile,"\tsetAttr \".fmt\" ",fmt,";\n");
 	}
 	void setDampMapType(unsigned int dmt)
 	{
 		if(dmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".dmt\" %i;\n", dmt);
+		writeInt(mFile,"\tsetAttr \".dmt\" ",dmt,";\n");
 	}
 	void setMassMapType(unsigned int mmt)
 	{
 		if(mmt == 2) return;
-		fprintf(mFile,"\tsetAttr \".mmt\" %i;\n", mmt);
+		writeInt(mFile,"\tsetAttr \".mmt\" ",mmt,";\n");
 	}
 	void setLocalSpaceOutput(bool lsou)
 	{
 		if(lsou == 0) return;
-		fprintf(mFile,"\tsetAttr \".lsou\" %i;\n", lsou);
+		writeInt(mFile,"\tsetAttr \".lsou\" ",lsou,";\n");
 	}
 	void setDisplayColor(const float3& dcl)
 	{
-		fprintf(mFile,"\tsetAttr \".dcl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dcl\" -type \"float3\" ");
 		dcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplayColorR(float dcr)
 	{
 		if(dcr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcr\" %f;\n", dcr);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcr\" ",dcr,";\n");
 	}
 	void setDisplayColorG(float dcg)
 	{
 		if(dcg == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcg\" %f;\n", dcg);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcg\" ",dcg,";\n");
 	}
 	void setDisplayColorB(float dcb)
 	{
 		if(dcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dcl.dcb\" %f;\n", dcb);
+		writeFloat(mFile,"\tsetAttr \".dcl.dcb\" ",dcb,";\n");
 	}
 	void getInputMesh()const
 	{
-		fprintf(mFile,"\"%s.imsh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imsh\"");
 	}
 	void getPositions()const
 	{
-		fprintf(mFile,"\"%s.poss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".poss\"");
 	}
 	void getPlayFromCache()const
 	{
-		fprintf(mFile,"\"%s.pfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfc\"");
 	}
 	void getStartPositions()const
 	{
-		fprintf(mFile,"\"%s.spns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spns\"");
 	}
 	void getStartVelocities()const
 	{
-		fprintf(mFile,"\"%s.sves\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sves\"");
 	}
 	void getThickness()const
 	{
-		fprintf(mFile,"\"%s.thss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".thss\"");
 	}
 	void getThicknessMap()const
 	{
-		fprintf(mFile,"\"%s.thmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".thmp\"");
 	}
 	void getThicknessPerVertex()const
 	{
-		fprintf(mFile,"\"%s.thpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".thpv\"");
 	}
 	void getBounce()const
 	{
-		fprintf(mFile,"\"%s.boce\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".boce\"");
 	}
 	void getBounceMap()const
 	{
-		fprintf(mFile,"\"%s.bomp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bomp\"");
 	}
 	void getBouncePerVertex()const
 	{
-		fprintf(mFile,"\"%s.bpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bpv\"");
 	}
 	void getFriction()const
 	{
-		fprintf(mFile,"\"%s.fron\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fron\"");
 	}
 	void getFrictionMap()const
 	{
-		fprintf(mFile,"\"%s.frmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frmp\"");
 	}
 	void getFrictionPerVertex()const
 	{
-		fprintf(mFile,"\"%s.fpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fpv\"");
 	}
 	void getDamp()const
 	{
-		fprintf(mFile,"\"%s.adng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".adng\"");
 	}
 	void getDampMap()const
 	{
-		fprintf(mFile,"\"%s.admp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".admp\"");
 	}
 	void getDampPerVertex()const
 	{
-		fprintf(mFile,"\"%s.dpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpv\"");
 	}
 	void getCollisionFlag()const
 	{
-		fprintf(mFile,"\"%s.cofl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cofl\"");
 	}
 	void getSelfCollisionFlag()const
 	{
-		fprintf(mFile,"\"%s.scfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfl\"");
 	}
 	void getMaxSelfCollisionIterations()const
 	{
-		fprintf(mFile,"\"%s.msci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msci\"");
 	}
 	void getMaxIterations()const
 	{
-		fprintf(mFile,"\"%s.mxit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxit\"");
 	}
 	void getPointMass()const
 	{
-		fprintf(mFile,"\"%s.pmss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmss\"");
 	}
 	void getMassMap()const
 	{
-		fprintf(mFile,"\"%s.mamp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mamp\"");
 	}
 	void getMassPerVertex()const
 	{
-		fprintf(mFile,"\"%s.mpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpv\"");
 	}
 	void getRestLengthScale()const
 	{
-		fprintf(mFile,"\"%s.rlsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlsc\"");
 	}
 	void getActive()const
 	{
-		fprintf(mFile,"\"%s.actv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".actv\"");
 	}
 	void getCollide()const
 	{
-		fprintf(mFile,"\"%s.cold\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cold\"");
 	}
 	void getSelfCollide()const
 	{
-		fprintf(mFile,"\"%s.scld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scld\"");
 	}
 	void getCollisionLayer()const
 	{
-		fprintf(mFile,"\"%s.cll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cll\"");
 	}
 	void getWindShadowDiffusion()const
 	{
-		fprintf(mFile,"\"%s.wsdi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wsdi\"");
 	}
 	void getWindShadowDistance()const
 	{
-		fprintf(mFile,"\"%s.wsds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wsds\"");
 	}
 	void getAirPushDistance()const
 	{
-		fprintf(mFile,"\"%s.apds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apds\"");
 	}
 	void getAirPushVorticity()const
 	{
-		fprintf(mFile,"\"%s.apvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".apvy\"");
 	}
 	void getPushOut()const
 	{
-		fprintf(mFile,"\"%s.pou\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pou\"");
 	}
 	void getPushOutRadius()const
 	{
-		fprintf(mFile,"\"%s.por\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".por\"");
 	}
 	void getCrossoverPush()const
 	{
-		fprintf(mFile,"\"%s.cop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cop\"");
 	}
 	void getTrappedCheck()const
 	{
-		fprintf(mFile,"\"%s.tpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tpc\"");
 	}
 	void getThicknessMapType()const
 	{
-		fprintf(mFile,"\"%s.tmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmt\"");
 	}
 	void getBounceMapType()const
 	{
-		fprintf(mFile,"\"%s.bmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmt\"");
 	}
 	void getFrictionMapType()const
 	{
-		fprintf(mFile,"\"%s.fmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fmt\"");
 	}
 	void getDampMapType()const
 	{
-		fprintf(mFile,"\"%s.dmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmt\"");
 	}
 	void getMassMapType()const
 	{
-		fprintf(mFile,"\"%s.mmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmt\"");
 	}
 	void getNextState()const
 	{
-		fprintf(mFile,"\"%s.nxst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nxst\"");
 	}
 	void getCurrentState()const
 	{
-		fprintf(mFile,"\"%s.cust\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cust\"");
 	}
 	void getStartState()const
 	{
-		fprintf(mFile,"\"%s.stst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stst\"");
 	}
 	void getNucleusId()const
 	{
-		fprintf(mFile,"\"%s.nuid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nuid\"");
 	}
 	void getLocalSpaceOutput()const
 	{
-		fprintf(mFile,"\"%s.lsou\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsou\"");
 	}
 	void getDisplayColor()const
 	{
-		fprintf(mFile,"\"%s.dcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl\"");
 	}
 	void getDisplayColorR()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcr\"");
 	}
 	void getDisplayColorG()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcg\"");
 	}
 	void getDisplayColorB()const
 	{
-		fprintf(mFile,"\"%s.dcl.dcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcl.dcb\"");
 	}
 protected:
 	NParticle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setSolverDisplay(unsigned int svds)
 	{
 		if(svds == 0) return;
-		fprintf(mFile,"\tsetAttr \".svds\" %i;\n", svds);
+		writeInt(mFile,"\tsetAttr \".svds\" ",svds,";\n");
 	}
 	void getSolverDisplay()const
 	{
-		fprintf(mFile,"\"%s.svds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svds\"");
 	}
 protected:
 	NRigid(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
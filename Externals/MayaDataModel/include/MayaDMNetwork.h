@@ -26,21 +26,21 @@ public:
 
 	void getAffects(size_t a_i)const
 	{
-		fprintf(mFile,"\"%s.a[%i]\"",mName.c_str(),a_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".a[",a_i,"]\"");
 	}
 	void getAffects()const
 	{
 
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getAffectedBy(size_t ab_i)const
 	{
-		fprintf(mFile,"\"%s.ab[%i]\"",mName.c_str(),ab_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ab[",ab_i,"]\"");
 	}
 	void getAffectedBy()const
 	{
 
-		fprintf(mFile,"\"%s.ab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ab\"");
 	}
 protected:
 	Network(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
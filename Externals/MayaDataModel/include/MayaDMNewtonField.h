@@ -27,22 +27,22 @@ public:
 	void setMinDistance(double min)
 	{
 		if(min == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".min\" %f;\n", min);
+		writeFloat(mFile,"\tsetAttr \".min\" ",min,";\n");
 	}
 	void setOwnerMassData(const doubleArray& omd)
 	{
 		if(omd.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".omd\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".omd\" -type \"doubleArray\" ");
 		omd.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getMinDistance()const
 	{
-		fprintf(mFile,"\"%s.min\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".min\"");
 	}
 	void getOwnerMassData()const
 	{
-		fprintf(mFile,"\"%s.omd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omd\"");
 	}
 protected:
 	NewtonField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
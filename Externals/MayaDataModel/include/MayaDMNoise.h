@@ -27,175 +27,175 @@ public:
 	void setAmplitude(float a)
 	{
 		if(a == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void setDepthMax(short dm)
 	{
 		if(dm == 3) return;
-		fprintf(mFile,"\tsetAttr \".dm\" %i;\n", dm);
+		writeInt(mFile,"\tsetAttr \".dm\" ",dm,";\n");
 	}
 	void setFrequency(float fq)
 	{
 		if(fq == 8.0) return;
-		fprintf(mFile,"\tsetAttr \".fq\" %f;\n", fq);
+		writeFloat(mFile,"\tsetAttr \".fq\" ",fq,";\n");
 	}
 	void setFrequencyRatio(float fr)
 	{
 		if(fr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setInflection(bool in)
 	{
 		if(in == false) return;
-		fprintf(mFile,"\tsetAttr \".in\" %i;\n", in);
+		writeInt(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setTime(float ti)
 	{
 		if(ti == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ti\" %f;\n", ti);
+		writeFloat(mFile,"\tsetAttr \".ti\" ",ti,";\n");
 	}
 	void setNoiseType(unsigned int nty)
 	{
 		if(nty == 1) return;
-		fprintf(mFile,"\tsetAttr \".nty\" %i;\n", nty);
+		writeInt(mFile,"\tsetAttr \".nty\" ",nty,";\n");
 	}
 	void setDensity(float d)
 	{
 		if(d == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSpottyness(float sp)
 	{
 		if(sp == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".sp\" %f;\n", sp);
+		writeFloat(mFile,"\tsetAttr \".sp\" ",sp,";\n");
 	}
 	void setSizeRand(float sr)
 	{
 		if(sr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setRandomness(float rn)
 	{
 		if(rn == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rn\" %f;\n", rn);
+		writeFloat(mFile,"\tsetAttr \".rn\" ",rn,";\n");
 	}
 	void setFalloff(unsigned int fof)
 	{
 		if(fof == 2) return;
-		fprintf(mFile,"\tsetAttr \".fof\" %i;\n", fof);
+		writeInt(mFile,"\tsetAttr \".fof\" ",fof,";\n");
 	}
 	void setNumWaves(short nw)
 	{
 		if(nw == 5) return;
-		fprintf(mFile,"\tsetAttr \".nw\" %i;\n", nw);
+		writeInt(mFile,"\tsetAttr \".nw\" ",nw,";\n");
 	}
 	void setImplode(float imp)
 	{
 		if(imp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imp\" %f;\n", imp);
+		writeFloat(mFile,"\tsetAttr \".imp\" ",imp,";\n");
 	}
 	void setImplodeCenter(const float2& imc)
 	{
 		if(imc == float2(0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".imc\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".imc\" -type \"float2\" ");
 		imc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImplodeCenterU(float imu)
 	{
 		if(imu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imc.imu\" %f;\n", imu);
+		writeFloat(mFile,"\tsetAttr \".imc.imu\" ",imu,";\n");
 	}
 	void setImplodeCenterV(float imv)
 	{
 		if(imv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imc.imv\" %f;\n", imv);
+		writeFloat(mFile,"\tsetAttr \".imc.imv\" ",imv,";\n");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.dm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dm\"");
 	}
 	void getFrequency()const
 	{
-		fprintf(mFile,"\"%s.fq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fq\"");
 	}
 	void getFrequencyRatio()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getInflection()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.ti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ti\"");
 	}
 	void getNoiseType()const
 	{
-		fprintf(mFile,"\"%s.nty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nty\"");
 	}
 	void getDensity()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSpottyness()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getSizeRand()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getRandomness()const
 	{
-		fprintf(mFile,"\"%s.rn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rn\"");
 	}
 	void getFalloff()const
 	{
-		fprintf(mFile,"\"%s.fof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fof\"");
 	}
 	void getNumWaves()const
 	{
-		fprintf(mFile,"\"%s.nw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nw\"");
 	}
 	void getImplode()const
 	{
-		fprintf(mFile,"\"%s.imp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp\"");
 	}
 	void getImplodeCenter()const
 	{
-		fprintf(mFile,"\"%s.imc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc\"");
 	}
 	void getImplodeCenterU()const
 	{
-		fprintf(mFile,"\"%s.imc.imu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc.imu\"");
 	}
 	void getImplodeCenterV()const
 	{
-		fprintf(mFile,"\"%s.imc.imv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc.imv\"");
 	}
 protected:
 	Noise(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
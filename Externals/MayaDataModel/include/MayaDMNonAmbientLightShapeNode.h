@@ -27,29 +27,29 @@ public:
 	void setDecayRate(unsigned int de)
 	{
 		if(de == 0) return;
-		fprintf(mFile,"\tsetAttr \".de\" %i;\n", de);
+		writeInt(mFile,"\tsetAttr \".de\" ",de,";\n");
 	}
 	void setEmitDiffuse(bool edi)
 	{
 		if(edi == true) return;
-		fprintf(mFile,"\tsetAttr \".edi\" %i;\n", edi);
+		writeInt(mFile,"\tsetAttr \".edi\" ",edi,";\n");
 	}
 	void setEmitSpecular(bool esp)
 	{
 		if(esp == true) return;
-		fprintf(mFile,"\tsetAttr \".esp\" %i;\n", esp);
+		writeInt(mFile,"\tsetAttr \".esp\" ",esp,";\n");
 	}
 	void getDecayRate()const
 	{
-		fprintf(mFile,"\"%s.de\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".de\"");
 	}
 	void getEmitDiffuse()const
 	{
-		fprintf(mFile,"\"%s.edi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".edi\"");
 	}
 	void getEmitSpecular()const
 	{
-		fprintf(mFile,"\"%s.esp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".esp\"");
 	}
 protected:
 	NonAmbientLightShapeNode(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
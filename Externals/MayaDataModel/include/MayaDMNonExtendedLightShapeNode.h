@@ -27,287 +27,287 @@ public:
 	void setLightRadius(float lr)
 	{
 		if(lr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lr\" %f;\n", lr);
+		writeFloat(mFile,"\tsetAttr \".lr\" ",lr,";\n");
 	}
 	void setCastSoftShadows(bool cw)
 	{
 		if(cw == false) return;
-		fprintf(mFile,"\tsetAttr \".cw\" %i;\n", cw);
+		writeInt(mFile,"\tsetAttr \".cw\" ",cw,";\n");
 	}
 	void setUseDepthMapShadows(bool dms)
 	{
 		if(dms == false) return;
-		fprintf(mFile,"\tsetAttr \".dms\" %i;\n", dms);
+		writeInt(mFile,"\tsetAttr \".dms\" ",dms,";\n");
 	}
 	void setReuseDmap(bool du)
 	{
 		if(du == false) return;
-		fprintf(mFile,"\tsetAttr \".du\" %i;\n", du);
+		writeInt(mFile,"\tsetAttr \".du\" ",du,";\n");
 	}
 	void setUseMidDistDmap(bool md)
 	{
 		if(md == true) return;
-		fprintf(mFile,"\tsetAttr \".md\" %i;\n", md);
+		writeInt(mFile,"\tsetAttr \".md\" ",md,";\n");
 	}
 	void setDmapFilterSize(short fs)
 	{
 		if(fs == 1) return;
-		fprintf(mFile,"\tsetAttr \".fs\" %i;\n", fs);
+		writeInt(mFile,"\tsetAttr \".fs\" ",fs,";\n");
 	}
 	void setDmapResolution(short dr)
 	{
 		if(dr == 512) return;
-		fprintf(mFile,"\tsetAttr \".dr\" %i;\n", dr);
+		writeInt(mFile,"\tsetAttr \".dr\" ",dr,";\n");
 	}
 	void setDmapBias(float db)
 	{
 		if(db == 0.001) return;
-		fprintf(mFile,"\tsetAttr \".db\" %f;\n", db);
+		writeFloat(mFile,"\tsetAttr \".db\" ",db,";\n");
 	}
 	void setDmapFocus(float df)
 	{
 		if(df == 90.0) return;
-		fprintf(mFile,"\tsetAttr \".df\" %f;\n", df);
+		writeFloat(mFile,"\tsetAttr \".df\" ",df,";\n");
 	}
 	void setDmapWidthFocus(float dw)
 	{
 		if(dw == 100.0) return;
-		fprintf(mFile,"\tsetAttr \".dw\" %f;\n", dw);
+		writeFloat(mFile,"\tsetAttr \".dw\" ",dw,";\n");
 	}
 	void setUseDmapAutoFocus(bool af)
 	{
 		if(af == true) return;
-		fprintf(mFile,"\tsetAttr \".af\" %i;\n", af);
+		writeInt(mFile,"\tsetAttr \".af\" ",af,";\n");
 	}
 	void setVolumeShadowSamples(short nv)
 	{
 		if(nv == 20) return;
-		fprintf(mFile,"\tsetAttr \".nv\" %i;\n", nv);
+		writeInt(mFile,"\tsetAttr \".nv\" ",nv,";\n");
 	}
 	void setFogShadowIntensity(short fsi)
 	{
 		if(fsi == 1) return;
-		fprintf(mFile,"\tsetAttr \".fsi\" %i;\n", fsi);
+		writeInt(mFile,"\tsetAttr \".fsi\" ",fsi,";\n");
 	}
 	void setUseDmapAutoClipping(bool uc)
 	{
 		if(uc == true) return;
-		fprintf(mFile,"\tsetAttr \".uc\" %i;\n", uc);
+		writeInt(mFile,"\tsetAttr \".uc\" ",uc,";\n");
 	}
 	void setDmapNearClipPlane(float nc)
 	{
 		if(nc == 0.001) return;
-		fprintf(mFile,"\tsetAttr \".nc\" %f;\n", nc);
+		writeFloat(mFile,"\tsetAttr \".nc\" ",nc,";\n");
 	}
 	void setDmapFarClipPlane(float fcp)
 	{
 		if(fcp == 10000.0) return;
-		fprintf(mFile,"\tsetAttr \".fcp\" %f;\n", fcp);
+		writeFloat(mFile,"\tsetAttr \".fcp\" ",fcp,";\n");
 	}
 	void setUseOnlySingleDmap(bool us)
 	{
 		if(us == true) return;
-		fprintf(mFile,"\tsetAttr \".us\" %i;\n", us);
+		writeInt(mFile,"\tsetAttr \".us\" ",us,";\n");
 	}
 	void setUseXPositiveDmap(bool xp)
 	{
 		if(xp == true) return;
-		fprintf(mFile,"\tsetAttr \".xp\" %i;\n", xp);
+		writeInt(mFile,"\tsetAttr \".xp\" ",xp,";\n");
 	}
 	void setUseXNegativeDmap(bool xn)
 	{
 		if(xn == true) return;
-		fprintf(mFile,"\tsetAttr \".xn\" %i;\n", xn);
+		writeInt(mFile,"\tsetAttr \".xn\" ",xn,";\n");
 	}
 	void setUseYPositiveDmap(bool yp)
 	{
 		if(yp == true) return;
-		fprintf(mFile,"\tsetAttr \".yp\" %i;\n", yp);
+		writeInt(mFile,"\tsetAttr \".yp\" ",yp,";\n");
 	}
 	void setUseYNegativeDmap(bool yn)
 	{
 		if(yn == true) return;
-		fprintf(mFile,"\tsetAttr \".yn\" %i;\n", yn);
+		writeInt(mFile,"\tsetAttr \".yn\" ",yn,";\n");
 	}
 	void setUseZPositiveDmap(bool zp)
 	{
 		if(zp == true) return;
-		fprintf(mFile,"\tsetAttr \".zp\" %i;\n", zp);
+		writeInt(mFile,"\tsetAttr \".zp\" ",zp,";\n");
 	}
 	void setUseZNegativeDmap(bool zn)
 	{
 		if(zn == true) return;
-		fprintf(mFile,"\tsetAttr \".zn\" %i;\n", zn);
+		writeInt(mFile,"\tsetAttr \".zn\" ",zn,";\n");
 	}
 	void setDmapUseMacro(const string& dc)
 	{
 		if(dc == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".dc\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".dc\" -type \"string\" ");
 		dc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDmapName(const string& smn)
 	{
 		if(smn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".smn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".smn\" -type \"string\" ");
 		smn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDmapLightName(bool ul)
 	{
 		if(ul == true) return;
-		fprintf(mFile,"\tsetAttr \".ul\" %i;\n", ul);
+		writeInt(mFile,"\tsetAttr \".ul\" ",ul,";\n");
 	}
 	void setDmapSceneName(bool um)
 	{
 		if(um == false) return;
-		fprintf(mFile,"\tsetAttr \".um\" %i;\n", um);
+		writeInt(mFile,"\tsetAttr \".um\" ",um,";\n");
 	}
 	void setDmapFrameExt(bool uf)
 	{
 		if(uf == false) return;
-		fprintf(mFile,"\tsetAttr \".uf\" %i;\n", uf);
+		writeInt(mFile,"\tsetAttr \".uf\" ",uf,";\n");
 	}
 	void setWriteDmap(bool ws)
 	{
 		if(ws == false) return;
-		fprintf(mFile,"\tsetAttr \".ws\" %i;\n", ws);
+		writeInt(mFile,"\tsetAttr \".ws\" ",ws,";\n");
 	}
 	void setLastWrittenDmapAnimExtName(const string& lw)
 	{
 		if(lw == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".lw\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".lw\" -type \"string\" ");
 		lw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReceiveShadows(bool gs)
 	{
 		if(gs == true) return;
-		fprintf(mFile,"\tsetAttr \".gs\" %i;\n", gs);
+		writeInt(mFile,"\tsetAttr \".gs\" ",gs,";\n");
 	}
 	void getLightRadius()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getCastSoftShadows()const
 	{
-		fprintf(mFile,"\"%s.cw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cw\"");
 	}
 	void getUseDepthMapShadows()const
 	{
-		fprintf(mFile,"\"%s.dms\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dms\"");
 	}
 	void getReuseDmap()const
 	{
-		fprintf(mFile,"\"%s.du\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".du\"");
 	}
 	void getUseMidDistDmap()const
 	{
-		fprintf(mFile,"\"%s.md\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".md\"");
 	}
 	void getDmapFilterSize()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getDmapResolution()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getDmapBias()const
 	{
-		fprintf(mFile,"\"%s.db\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".db\"");
 	}
 	void getDmapFocus()const
 	{
-		fprintf(mFile,"\"%s.df\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".df\"");
 	}
 	void getDmapWidthFocus()const
 	{
-		fprintf(mFile,"\"%s.dw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dw\"");
 	}
 	void getUseDmapAutoFocus()const
 	{
-		fprintf(mFile,"\"%s.af\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".af\"");
 	}
 	void getVolumeShadowSamples()const
 	{
-		fprintf(mFile,"\"%s.nv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nv\"");
 	}
 	void getFogShadowIntensity()const
 	{
-		fprintf(mFile,"\"%s.fsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsi\"");
 	}
 	void getUseDmapAutoClipping()const
 	{
-		fprintf(mFile,"\"%s.uc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uc\"");
 	}
 	void getDmapNearClipPlane()const
 	{
-		fprintf(mFile,"\"%s.nc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nc\"");
 	}
 	void getDmapFarClipPlane()const
 	{
-		fprintf(mFile,"\"%s.fcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcp\"");
 	}
 	void getUseOnlySingleDmap()const
 	{
-		fprintf(mFile,"\"%s.us\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".us\"");
 	}
 	void getUseXPositiveDmap()const
 	{
-		fprintf(mFile,"\"%s.xp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xp\"");
 	}
 	void getUseXNegativeDmap()const
 	{
-		fprintf(mFile,"\"%s.xn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xn\"");
 	}
 	void getUseYPositiveDmap()const
 	{
-		fprintf(mFile,"\"%s.yp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".yp\"");
 	}
 	void getUseYNegativeDmap()const
 	{
-		fprintf(mFile,"\"%s.yn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".yn\"");
 	}
 	void getUseZPositiveDmap()const
 	{
-		fprintf(mFile,"\"%s.zp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".zp\"");
 	}
 	void getUseZNegativeDmap()const
 	{
-		fprintf(mFile,"\"%s.zn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".zn\"");
 	}
 	void getDmapUseMacro()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getDmapName()const
 	{
-		fprintf(mFile,"\"%s.smn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smn\"");
 	}
 	void getDmapLightName()const
 	{
-		fprintf(mFile,"\"%s.ul\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ul\"");
 	}
 	void getDmapSceneName()const
 	{
-		fprintf(mFile,"\"%s.um\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".um\"");
 	}
 	void getDmapFrameExt()const
 	{
-		fprintf(mFile,"\"%s.uf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uf\"");
 	}
 	void getWriteDmap()const
 	{
-		fprintf(mFile,"\"%s.ws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ws\"");
 	}
 	void getLastWrittenDmapAnimExtName()const
 	{
-		fprintf(mFile,"\"%s.lw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lw\"");
 	}
 	void getReceiveShadows()const
 	{
-		fprintf(mFile,"\"%s.gs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gs\"");
 	}
 protected:
 	NonExtendedLightShapeNode(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,17 +27,17 @@ public:
 	void setMatrix(const matrix& ma)
 	{
 		if(ma == identity) return;
-		fprintf(mFile,"\tsetAttr \".ma\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".ma\" -type \"matrix\" ");
 		ma.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getDeformerData()const
 	{
-		fprintf(mFile,"\"%s.dd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dd\"");
 	}
 	void getMatrix()const
 	{
-		fprintf(mFile,"\"%s.ma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ma\"");
 	}
 protected:
 	NonLinear(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
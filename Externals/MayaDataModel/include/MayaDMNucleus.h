@@ -27,379 +27,379 @@ public:
 	void setStartTime(double sti)
 	{
 		if(sti == 1) return;
-		fprintf(mFile,"\tsetAttr \".sti\" %f;\n", sti);
+		writeFloat(mFile,"\tsetAttr \".sti\" ",sti,";\n");
 	}
 	void setStartFrame(double stf)
 	{
 		if(stf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".stf\" %f;\n", stf);
+		writeFloat(mFile,"\tsetAttr \".stf\" ",stf,";\n");
 	}
 	void setEnable(bool ena)
 	{
 		if(ena == true) return;
-		fprintf(mFile,"\tsetAttr \".ena\" %i;\n", ena);
+		writeInt(mFile,"\tsetAttr \".ena\" ",ena,";\n");
 	}
 	void setGravity(float grty)
 	{
 		if(grty == 9.8) return;
-		fprintf(mFile,"\tsetAttr \".grty\" %f;\n", grty);
+		writeFloat(mFile,"\tsetAttr \".grty\" ",grty,";\n");
 	}
 	void setGravityDirection(const float3& grdi)
 	{
-		fprintf(mFile,"\tsetAttr \".grdi\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".grdi\" -type \"float3\" ");
 		grdi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGravityDirectionX(float grdx)
 	{
 		if(grdx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".grdi.grdx\" %f;\n", grdx);
+		writeFloat(mFile,"\tsetAttr \".grdi.grdx\" ",grdx,";\n");
 	}
 	void setGravityDirectionY(float grdy)
 	{
 		if(grdy == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".grdi.grdy\" %f;\n", grdy);
+		writeFloat(mFile,"\tsetAttr \".grdi.grdy\" ",grdy,";\n");
 	}
 	void setGravityDirectionZ(float grdz)
 	{
 		if(grdz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".grdi.grdz\" %f;\n", grdz);
+		writeFloat(mFile,"\tsetAttr \".grdi.grdz\" ",grdz,";\n");
 	}
 	void setAirDensity(float ady)
 	{
 		if(ady == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ady\" %f;\n", ady);
+		writeFloat(mFile,"\tsetAttr \".ady\" ",ady,";\n");
 	}
 	void setWindSpeed(float wisp)
 	{
 		if(wisp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wisp\" %f;\n", wisp);
+		writeFloat(mFile,"\tsetAttr \".wisp\" ",wisp,";\n");
 	}
 	void setWindDirection(const float3& widi)
 	{
-		fprintf(mFile,"\tsetAttr \".widi\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".widi\" -type \"float3\" ");
 		widi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWindDirectionX(float widx)
 	{
 		if(widx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".widi.widx\" %f;\n", widx);
+		writeFloat(mFile,"\tsetAttr \".widi.widx\" ",widx,";\n");
 	}
 	void setWindDirectionY(float widy)
 	{
 		if(widy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".widi.widy\" %f;\n", widy);
+		writeFloat(mFile,"\tsetAttr \".widi.widy\" ",widy,";\n");
 	}
 	void setWindDirectionZ(float widz)
 	{
 		if(widz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".widi.widz\" %f;\n", widz);
+		writeFloat(mFile,"\tsetAttr \".widi.widz\" ",widz,";\n");
 	}
 	void setWindNoise(float wnoi)
 	{
 		if(wnoi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wnoi\" %f;\n", wnoi);
+		writeFloat(mFile,"\tsetAttr \".wnoi\" ",wnoi,";\n");
 	}
 	void setCollisionLayerRange(float clra)
 	{
 		if(clra == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".clra\" %f;\n", clra);
+		writeFloat(mFile,"\tsetAttr \".clra\" ",clra,";\n");
 	}
 	void setCollisionSoftness(float clso)
 	{
 		if(clso == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clso\" %f;\n", clso);
+		writeFloat(mFile,"\tsetAttr \".clso\" ",clso,";\n");
 	}
 	void setUsePlane(bool nupl)
 	{
 		if(nupl == false) return;
-		fprintf(mFile,"\tsetAttr \".nupl\" %i;\n", nupl);
+		writeInt(mFile,"\tsetAttr \".nupl\" ",nupl,";\n");
 	}
 	void setPlaneOrigin(const float3& npor)
 	{
-		fprintf(mFile,"\tsetAttr \".npor\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".npor\" -type \"float3\" ");
 		npor.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPlaneOriginX(float npox)
 	{
 		if(npox == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".npor.npox\" %f;\n", npox);
+		writeFloat(mFile,"\tsetAttr \".npor.npox\" ",npox,";\n");
 	}
 	void setPlaneOriginY(float npoy)
 	{
 		if(npoy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".npor.npoy\" %f;\n", npoy);
+		writeFloat(mFile,"\tsetAttr \".npor.npoy\" ",npoy,";\n");
 	}
 	void setPlaneOriginZ(float npoz)
 	{
 		if(npoz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".npor.npoz\" %f;\n", npoz);
+		writeFloat(mFile,"\tsetAttr \".npor.npoz\" ",npoz,";\n");
 	}
 	void setPlaneNormal(const float3& npun)
 	{
-		fprintf(mFile,"\tsetAttr \".npun\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".npun\" -type \"float3\" ");
 		npun.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPlaneNormalX(float npnx)
 	{
 		if(npnx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".npun.npnx\" %f;\n", npnx);
+		writeFloat(mFile,"\tsetAttr \".npun.npnx\" ",npnx,";\n");
 	}
 	void setPlaneNormalY(float npny)
 	{
 		if(npny == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".npun.npny\" %f;\n", npny);
+		writeFloat(mFile,"\tsetAttr \".npun.npny\" ",npny,";\n");
 	}
 	void setPlaneNormalZ(float npnz)
 	{
 		if(npnz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".npun.npnz\" %f;\n", npnz);
+		writeFloat(mFile,"\tsetAttr \".npun.npnz\" ",npnz,";\n");
 	}
 	void setPlaneBounce(float npbc)
 	{
 		if(npbc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".npbc\" %f;\n", npbc);
+		writeFloat(mFile,"\tsetAttr \".npbc\" ",npbc,";\n");
 	}
 	void setPlaneFriction(float npfr)
 	{
 		if(npfr == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".npfr\" %f;\n", npfr);
+		writeFloat(mFile,"\tsetAttr \".npfr\" ",npfr,";\n");
 	}
 	void setSubSteps(int sstp)
 	{
 		if(sstp == 3) return;
-		fprintf(mFile,"\tsetAttr \".sstp\" %i;\n", sstp);
+		writeInt(mFile,"\tsetAttr \".sstp\" ",sstp,";\n");
 	}
 	void setMaxCollisionIterations(int mcit)
 	{
 		if(mcit == 4) return;
-		fprintf(mFile,"\tsetAttr \".mcit\" %i;\n", mcit);
+		writeInt(mFile,"\tsetAttr \".mcit\" ",mcit,";\n");
 	}
 	void setCollisionFlag(unsigned int cofl)
 	{
 		if(cofl == 4) return;
-		fprintf(mFile,"\tsetAttr \".cofl\" %i;\n", cofl);
+		writeInt(mFile,"\tsetAttr \".cofl\" ",cofl,";\n");
 	}
 	void setSelfCollisionFlag(unsigned int scfl)
 	{
 		if(scfl == 1) return;
-		fprintf(mFile,"\tsetAttr \".scfl\" %i;\n", scfl);
+		writeInt(mFile,"\tsetAttr \".scfl\" ",scfl,";\n");
 	}
 	void setTimeScale(float tisc)
 	{
 		if(tisc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tisc\" %f;\n", tisc);
+		writeFloat(mFile,"\tsetAttr \".tisc\" ",tisc,";\n");
 	}
 	void setSpaceScale(float spsc)
 	{
 		if(spsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".spsc\" %f;\n", spsc);
+		writeFloat(mFile,"\tsetAttr \".spsc\" ",spsc,";\n");
 	}
 	void getInputStart(size_t is_i)const
 	{
-		fprintf(mFile,"\"%s.is[%i]\"",mName.c_str(),is_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".is[",is_i,"]\"");
 	}
 	void getInputStart()const
 	{
 
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInputCurrent(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i]\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"]\"");
 	}
 	void getInputCurrent()const
 	{
 
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getInputActive(size_t niao_i)const
 	{
-		fprintf(mFile,"\"%s.niao[%i]\"",mName.c_str(),niao_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".niao[",niao_i,"]\"");
 	}
 	void getInputActive()const
 	{
 
-		fprintf(mFile,"\"%s.niao\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".niao\"");
 	}
 	void getInputPassive(size_t nipo_i)const
 	{
-		fprintf(mFile,"\"%s.nipo[%i]\"",mName.c_str(),nipo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nipo[",nipo_i,"]\"");
 	}
 	void getInputPassive()const
 	{
 
-		fprintf(mFile,"\"%s.nipo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nipo\"");
 	}
 	void getInputActiveStart(size_t nias_i)const
 	{
-		fprintf(mFile,"\"%s.nias[%i]\"",mName.c_str(),nias_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nias[",nias_i,"]\"");
 	}
 	void getInputActiveStart()const
 	{
 
-		fprintf(mFile,"\"%s.nias\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nias\"");
 	}
 	void getInputPassiveStart(size_t nips_i)const
 	{
-		fprintf(mFile,"\"%s.nips[%i]\"",mName.c_str(),nips_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nips[",nips_i,"]\"");
 	}
 	void getInputPassiveStart()const
 	{
 
-		fprintf(mFile,"\"%s.nips\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nips\"");
 	}
 	void getOutputObjects(size_t noao_i)const
 	{
-		fprintf(mFile,"\"%s.noao[%i]\"",mName.c_str(),noao_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".noao[",noao_i,"]\"");
 	}
 	void getOutputObjects()const
 	{
 
-		fprintf(mFile,"\"%s.noao\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".noao\"");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.cti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cti\"");
 	}
 	void getStartTime()const
 	{
-		fprintf(mFile,"\"%s.sti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sti\"");
 	}
 	void getStartFrame()const
 	{
-		fprintf(mFile,"\"%s.stf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stf\"");
 	}
 	void getEnable()const
 	{
-		fprintf(mFile,"\"%s.ena\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ena\"");
 	}
 	void getGravity()const
 	{
-		fprintf(mFile,"\"%s.grty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grty\"");
 	}
 	void getGravityDirection()const
 	{
-		fprintf(mFile,"\"%s.grdi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grdi\"");
 	}
 	void getGravityDirectionX()const
 	{
-		fprintf(mFile,"\"%s.grdi.grdx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grdi.grdx\"");
 	}
 	void getGravityDirectionY()const
 	{
-		fprintf(mFile,"\"%s.grdi.grdy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grdi.grdy\"");
 	}
 	void getGravityDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.grdi.grdz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grdi.grdz\"");
 	}
 	void getAirDensity()const
 	{
-		fprintf(mFile,"\"%s.ady\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ady\"");
 	}
 	void getWindSpeed()const
 	{
-		fprintf(mFile,"\"%s.wisp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wisp\"");
 	}
 	void getWindDirection()const
 	{
-		fprintf(mFile,"\"%s.widi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".widi\"");
 	}
 	void getWindDirectionX()const
 	{
-		fprintf(mFile,"\"%s.widi.widx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".widi.widx\"");
 	}
 	void getWindDirectionY()const
 	{
-		fprintf(mFile,"\"%s.widi.widy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".widi.widy\"");
 	}
 	void getWindDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.widi.widz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".widi.widz\"");
 	}
 	void getWindNoise()const
 	{
-		fprintf(mFile,"\"%s.wnoi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wnoi\"");
 	}
 	void getCollisionLayerRange()const
 	{
-		fprintf(mFile,"\"%s.clra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clra\"");
 	}
 	void getCollisionSoftness()const
 	{
-		fprintf(mFile,"\"%s.clso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clso\"");
 	}
 	void getUsePlane()const
 	{
-		fprintf(mFile,"\"%s.nupl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nupl\"");
 	}
 	void getPlaneOrigin()const
 	{
-		fprintf(mFile,"\"%s.npor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npor\"");
 	}
 	void getPlaneOriginX()const
 	{
-		fprintf(mFile,"\"%s.npor.npox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npor.npox\"");
 	}
 	void getPlaneOriginY()const
 	{
-		fprintf(mFile,"\"%s.npor.npoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npor.npoy\"");
 	}
 	void getPlaneOriginZ()const
 	{
-		fprintf(mFile,"\"%s.npor.npoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npor.npoz\"");
 	}
 	void getPlaneNormal()const
 	{
-		fprintf(mFile,"\"%s.npun\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npun\"");
 	}
 	void getPlaneNormalX()const
 	{
-		fprintf(mFile,"\"%s.npun.npnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npun.npnx\"");
 	}
 	void getPlaneNormalY()const
 	{
-		fprintf(mFile,"\"%s.npun.npny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npun.npny\"");
 	}
 	void getPlaneNormalZ()const
 	{
-		fprintf(mFile,"\"%s.npun.npnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npun.npnz\"");
 	}
 	void getPlaneBounce()const
 	{
-		fprintf(mFile,"\"%s.npbc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npbc\"");
 	}
 	void getPlaneFriction()const
 	{
-		fprintf(mFile,"\"%s.npfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npfr\"");
 	}
 	void getSubSteps()const
 	{
-		fprintf(mFile,"\"%s.sstp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sstp\"");
 	}
 	void getMaxCollisionIterations()const
 	{
-		fprintf(mFile,"\"%s.mcit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mcit\"");
 	}
 	void getCollisionFlag()const
 	{
-		fprintf(mFile,"\"%s.cofl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cofl\"");
 	}
 	void getSelfCollisionFlag()const
 	{
-		fprintf(mFile,"\"%s.scfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scfl\"");
 	}
 	void getTimeScale()const
 	{
-		fprintf(mFile,"\"%s.tisc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tisc\"");
 	}
 	void getSpaceScale()const
 	{
-		fprintf(mFile,"\"%s.spsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spsc\"");
 	}
 protected:
 	Nucleus(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,179 +26,179 @@ public:
 
 	void setCached(const nurbsCurve& cc)
 	{
-		fprintf(mFile,"\tsetAttr \".cc\" -type \"nurbsCurve\" ");
+		writeString(mFile,"\tsetAttr \".cc\" -type \"nurbsCurve\" ");
 		cc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInPlace(bool ipo)
 	{
 		if(ipo == false) return;
-		fprintf(mFile,"\tsetAttr \".ipo\" %i;\n", ipo);
+		writeInt(mFile,"\tsetAttr \".ipo\" ",ipo,";\n");
 	}
 	void setDispCV(bool dcv)
 	{
 		if(dcv == false) return;
-		fprintf(mFile,"\tsetAttr \".dcv\" %i;\n", dcv);
+		writeInt(mFile,"\tsetAttr \".dcv\" ",dcv,";\n");
 	}
 	void setDispEP(bool dep)
 	{
 		if(dep == false) return;
-		fprintf(mFile,"\tsetAttr \".dep\" %i;\n", dep);
+		writeInt(mFile,"\tsetAttr \".dep\" ",dep,";\n");
 	}
 	void setDispHull(bool dh)
 	{
 		if(dh == false) return;
-		fprintf(mFile,"\tsetAttr \".dh\" %i;\n", dh);
+		writeInt(mFile,"\tsetAttr \".dh\" ",dh,";\n");
 	}
 	void setDispGeometry(bool dg)
 	{
 		if(dg == true) return;
-		fprintf(mFile,"\tsetAttr \".dg\" %i;\n", dg);
+		writeInt(mFile,"\tsetAttr \".dg\" ",dg,";\n");
 	}
 	void getCreate()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getLocal()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getWorldSpace(size_t ws_i)const
 	{
-		fprintf(mFile,"\"%s.ws[%i]\"",mName.c_str(),ws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ws[",ws_i,"]\"");
 	}
 	void getWorldSpace()const
 	{
 
-		fprintf(mFile,"\"%s.ws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ws\"");
 	}
 	void getWorldNormal(size_t wn_i)const
 	{
-		fprintf(mFile,"\"%s.wn[%i]\"",mName.c_str(),wn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wn[",wn_i,"]\"");
 	}
 	void getWorldNormal()const
 	{
 
-		fprintf(mFile,"\"%s.wn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn\"");
 	}
 	void getWorldNormalX(size_t wn_i)const
 	{
-		fprintf(mFile,"\"%s.wn[%i].wnx\"",mName.c_str(),wn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wn[",wn_i,"].wnx\"");
 	}
 	void getWorldNormalX()const
 	{
 
-		fprintf(mFile,"\"%s.wn.wnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn.wnx\"");
 	}
 	void getWorldNormalY(size_t wn_i)const
 	{
-		fprintf(mFile,"\"%s.wn[%i].wny\"",mName.c_str(),wn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wn[",wn_i,"].wny\"");
 	}
 	void getWorldNormalY()const
 	{
 
-		fprintf(mFile,"\"%s.wn.wny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn.wny\"");
 	}
 	void getWorldNormalZ(size_t wn_i)const
 	{
-		fprintf(mFile,"\"%s.wn[%i].wnz\"",mName.c_str(),wn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wn[",wn_i,"].wnz\"");
 	}
 	void getWorldNormalZ()const
 	{
 
-		fprintf(mFile,"\"%s.wn.wnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn.wnz\"");
 	}
 	void getForm()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSpans()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getEditPoints(size_t eps_i)const
 	{
-		fprintf(mFile,"\"%s.eps[%i]\"",mName.c_str(),eps_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eps[",eps_i,"]\"");
 	}
 	void getEditPoints()const
 	{
 
-		fprintf(mFile,"\"%s.eps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eps\"");
 	}
 	void getXValueEp(size_t eps_i)const
 	{
-		fprintf(mFile,"\"%s.eps[%i].xve\"",mName.c_str(),eps_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eps[",eps_i,"].xve\"");
 	}
 	void getXValueEp()const
 	{
 
-		fprintf(mFile,"\"%s.eps.xve\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eps.xve\"");
 	}
 	void getYValueEp(size_t eps_i)const
 	{
-		fprintf(mFile,"\"%s.eps[%i].yve\"",mName.c_str(),eps_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eps[",eps_i,"].yve\"");
 	}
 	void getYValueEp()const
 	{
 
-		fprintf(mFile,"\"%s.eps.yve\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eps.yve\"");
 	}
 	void getZValueEp(size_t eps_i)const
 	{
-		fprintf(mFile,"\"%s.eps[%i].zve\"",mName.c_str(),eps_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eps[",eps_i,"].zve\"");
 	}
 	void getZValueEp()const
 	{
 
-		fprintf(mFile,"\"%s.eps.zve\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eps.zve\"");
 	}
 	void getCached()const
 	{
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 	void getInPlace()const
 	{
-		fprintf(mFile,"\"%s.ipo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ipo\"");
 	}
 	void getDispCV()const
 	{
-		fprintf(mFile,"\"%s.dcv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcv\"");
 	}
 	void getDispEP()const
 	{
-		fprintf(mFile,"\"%s.dep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dep\"");
 	}
 	void getDispHull()const
 	{
-		fprintf(mFile,"\"%s.dh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dh\"");
 	}
 	void getDispCurveEndPoints()const
 	{
-		fprintf(mFile,"\"%s.dce\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dce\"");
 	}
 	void getDispGeometry()const
 	{
-		fprintf(mFile,"\"%s.dg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dg\"");
 	}
 	void getTweakSize()const
 	{
-		fprintf(mFile,"\"%s.ts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ts\"");
 	}
 	void getMinMaxValue()const
 	{
-		fprintf(mFile,"\"%s.mmv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmv\"");
 	}
 	void getMinValue()const
 	{
-		fprintf(mFile,"\"%s.mmv.min\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmv.min\"");
 	}
 	void getMaxValue()const
 	{
-		fprintf(mFile,"\"%s.mmv.max\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmv.max\"");
 	}
 protected:
 	NurbsCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
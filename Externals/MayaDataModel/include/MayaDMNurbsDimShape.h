@@ -27,24 +27,24 @@ public:
 	void setUParamValue(double upv)
 	{
 		if(upv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".upv\" %f;\n", upv);
+		writeFloat(mFile,"\tsetAttr \".upv\" ",upv,";\n");
 	}
 	void setVParamValue(double vpv)
 	{
 		if(vpv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vpv\" %f;\n", vpv);
+		writeFloat(mFile,"\tsetAttr \".vpv\" ",vpv,";\n");
 	}
 	void getUParamValue()const
 	{
-		fprintf(mFile,"\"%s.upv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upv\"");
 	}
 	void getVParamValue()const
 	{
-		fprintf(mFile,"\"%s.vpv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vpv\"");
 	}
 	void getNurbsGeometry()const
 	{
-		fprintf(mFile,"\"%s.ng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ng\"");
 	}
 protected:
 	NurbsDimShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
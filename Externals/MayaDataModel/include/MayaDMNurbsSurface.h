@@ -41,27 +41,27 @@ public:
 		bool miRefractionReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i ", miTransparencyReceive);
-			fprintf(file,"%i ", miReflectionReceive);
-			fprintf(file,"%i", miRefractionReceive);
+			writeInt(file,"",miOverrideCaustics," ");
+			writeInt(file,"",miCausticAccuracy," ");
+			writeFloat(file,"",miCausticRadius," ");
+			writeInt(file,"",miOverrideGlobalIllumination," ");
+			writeInt(file,"",miGlobillumAccuracy," ");
+			writeFloat(file,"",miGlobillumRadius," ");
+			writeInt(file,"",miOverrideFinalGather," ");
+			writeInt(file,"",miFinalGatherRays," ");
+			writeFloat(file,"",miFinalGatherMinRadius," ");
+			writeFloat(file,"",miFinalGatherMaxRadius," ");
+			writeInt(file,"",miFinalGatherFilter," ");
+			writeInt(file,"",miFinalGatherView," ");
+			writeInt(file,"",miOverrideSamples," ");
+			writeInt(file,"",miMinSamples," ");
+			writeInt(file,"",miMaxSamples," ");
+			writeInt(file,"",miFinalGatherCast," ");
+			writeInt(file,"",miFinalGatherReceive," ");
+			writeInt(file,"",miTransparencyCast," ");
+			writeInt(file,"",miTransparencyReceive," ");
+			writeInt(file,"",miReflectionReceive," ");
+			writeInt(file,"",miRefractionReceive);
 		}
 	};
 public:
@@ -74,656 +74,656 @@ public:
 	void setDivisionsU(unsigned char dvu)
 	{
 		if(dvu == 0) return;
-		fprintf(mFile,"\tsetAttr \".dvu\" %i;\n", dvu);
+		writeInt(mFile,"\tsetAttr \".dvu\" ",dvu,";\n");
 	}
 	void setDivisionsV(unsigned char dvv)
 	{
 		if(dvv == 0) return;
-		fprintf(mFile,"\tsetAttr \".dvv\" %i;\n", dvv);
+		writeInt(mFile,"\tsetAttr \".dvv\" ",dvv,";\n");
 	}
 	void setCurvePrecision(unsigned char cpr)
 	{
 		if(cpr == 4) return;
-		fprintf(mFile,"\tsetAttr \".cpr\" %i;\n", cpr);
+		writeInt(mFile,"\tsetAttr \".cpr\" ",cpr,";\n");
 	}
 	void setCurvePrecisionShaded(unsigned char cps)
 	{
 		if(cps == 1) return;
-		fprintf(mFile,"\tsetAttr \".cps\" %i;\n", cps);
+		writeInt(mFile,"\tsetAttr \".cps\" ",cps,";\n");
 	}
 	void setSimplifyMode(unsigned char sm)
 	{
 		if(sm == 0) return;
-		fprintf(mFile,"\tsetAttr \".sm\" %i;\n", sm);
+		writeInt(mFile,"\tsetAttr \".sm\" ",sm,";\n");
 	}
 	void setSimplifyU(unsigned char smu)
 	{
 		if(smu == 1) return;
-		fprintf(mFile,"\tsetAttr \".smu\" %i;\n", smu);
+		writeInt(mFile,"\tsetAttr \".smu\" ",smu,";\n");
 	}
 	void setSimplifyV(unsigned char smv)
 	{
 		if(smv == 1) return;
-		fprintf(mFile,"\tsetAttr \".smv\" %i;\n", smv);
+		writeInt(mFile,"\tsetAttr \".smv\" ",smv,";\n");
 	}
 	void setSmoothEdge(bool ues)
 	{
 		if(ues == false) return;
-		fprintf(mFile,"\tsetAttr \".ues\" %i;\n", ues);
+		writeInt(mFile,"\tsetAttr \".ues\" ",ues,";\n");
 	}
 	void setSmoothEdgeRatio(double esr)
 	{
 		if(esr == 0.99) return;
-		fprintf(mFile,"\tsetAttr \".esr\" %f;\n", esr);
+		writeFloat(mFile,"\tsetAttr \".esr\" ",esr,";\n");
 	}
 	void setUseChordHeight(bool uch)
 	{
 		if(uch == false) return;
-		fprintf(mFile,"\tsetAttr \".uch\" %i;\n", uch);
+		writeInt(mFile,"\tsetAttr \".uch\" ",uch,";\n");
 	}
 	void setObjSpaceChordHeight(bool uco)
 	{
 		if(uco == true) return;
-		fprintf(mFile,"\tsetAttr \".uco\" %i;\n", uco);
+		writeInt(mFile,"\tsetAttr \".uco\" ",uco,";\n");
 	}
 	void setUseChordHeightRatio(bool ucr)
 	{
 		if(ucr == true) return;
-		fprintf(mFile,"\tsetAttr \".ucr\" %i;\n", ucr);
+		writeInt(mFile,"\tsetAttr \".ucr\" ",ucr,";\n");
 	}
 	void setEdgeSwap(bool es)
 	{
 		if(es == false) return;
-		fprintf(mFile,"\tsetAttr \".es\" %i;\n", es);
+		writeInt(mFile,"\tsetAttr \".es\" ",es,";\n");
 	}
 	void setUseMinScreen(bool uns)
 	{
 		if(uns == false) return;
-		fprintf(mFile,"\tsetAttr \".uns\" %i;\n", uns);
+		writeInt(mFile,"\tsetAttr \".uns\" ",uns,";\n");
 	}
 	void setSelCVDisp(bool scvd)
 	{
 		if(scvd == false) return;
-		fprintf(mFile,"\tsetAttr \".scvd\" %i;\n", scvd);
+		writeInt(mFile,"\tsetAttr \".scvd\" ",scvd,";\n");
 	}
 	void setDispCV(bool dcv)
 	{
 		if(dcv == false) return;
-		fprintf(mFile,"\tsetAttr \".dcv\" %i;\n", dcv);
+		writeInt(mFile,"\tsetAttr \".dcv\" ",dcv,";\n");
 	}
 	void setDispEP(bool dep)
 	{
 		if(dep == false) return;
-		fprintf(mFile,"\tsetAttr \".dep\" %i;\n", dep);
+		writeInt(mFile,"\tsetAttr \".dep\" ",dep,";\n");
 	}
 	void setDispHull(bool dh)
 	{
 		if(dh == false) return;
-		fprintf(mFile,"\tsetAttr \".dh\" %i;\n", dh);
+		writeInt(mFile,"\tsetAttr \".dh\" ",dh,";\n");
 	}
 	void setDispGeometry(bool dg)
 	{
 		if(dg == true) return;
-		fprintf(mFile,"\tsetAttr \".dg\" %i;\n", dg);
+		writeInt(mFile,"\tsetAttr \".dg\" ",dg,";\n");
 	}
 	void setDispOrigin(bool dor)
 	{
 		if(dor == false) return;
-		fprintf(mFile,"\tsetAttr \".dor\" %i;\n", dor);
+		writeInt(mFile,"\tsetAttr \".dor\" ",dor,";\n");
 	}
 	void setNumberU(int nu)
 	{
 		if(nu == 3) return;
-		fprintf(mFile,"\tsetAttr \".nu\" %i;\n", nu);
+		writeInt(mFile,"\tsetAttr \".nu\" ",nu,";\n");
 	}
 	void setModeU(unsigned int mu)
 	{
 		if(mu == 3) return;
-		fprintf(mFile,"\tsetAttr \".mu\" %i;\n", mu);
+		writeInt(mFile,"\tsetAttr \".mu\" ",mu,";\n");
 	}
 	void setNumberV(int nv)
 	{
 		if(nv == 3) return;
-		fprintf(mFile,"\tsetAttr \".nv\" %i;\n", nv);
+		writeInt(mFile,"\tsetAttr \".nv\" ",nv,";\n");
 	}
 	void setModeV(unsigned int mv)
 	{
 		if(mv == 3) return;
-		fprintf(mFile,"\tsetAttr \".mv\" %i;\n", mv);
+		writeInt(mFile,"\tsetAttr \".mv\" ",mv,";\n");
 	}
 	void setChordHeight(double ch)
 	{
 		if(ch == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".ch\" %f;\n", ch);
+		writeFloat(mFile,"\tsetAttr \".ch\" ",ch,";\n");
 	}
 	void setChordHeightRatio(double chr)
 	{
 		if(chr == 0.983) return;
-		fprintf(mFile,"\tsetAttr \".chr\" %f;\n", chr);
+		writeFloat(mFile,"\tsetAttr \".chr\" ",chr,";\n");
 	}
 	void setMinScreen(double mns)
 	{
 		if(mns == 14) return;
-		fprintf(mFile,"\tsetAttr \".mns\" %f;\n", mns);
+		writeFloat(mFile,"\tsetAttr \".mns\" ",mns,";\n");
 	}
 	void setCached(const nurbsSurface& cc)
 	{
-		fprintf(mFile,"\tsetAttr \".cc\" -type \"nurbsSurface\" ");
+		writeString(mFile,"\tsetAttr \".cc\" -type \"nurbsSurface\" ");
 		cc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInPlace(bool ipo)
 	{
 		if(ipo == false) return;
-		fprintf(mFile,"\tsetAttr \".ipo\" %i;\n", ipo);
+		writeInt(mFile,"\tsetAttr \".ipo\" ",ipo,";\n");
 	}
 	void setDisplayRenderTessellation(bool drt)
 	{
 		if(drt == false) return;
-		fprintf(mFile,"\tsetAttr \".drt\" %i;\n", drt);
+		writeInt(mFile,"\tsetAttr \".drt\" ",drt,";\n");
 	}
 	void setFixTextureWarp(bool ftwp)
 	{
 		if(ftwp == false) return;
-		fprintf(mFile,"\tsetAttr \".ftwp\" %i;\n", ftwp);
+		writeInt(mFile,"\tsetAttr \".ftwp\" ",ftwp,";\n");
 	}
 	void setGridDivisionPerSpanU(short gdsu)
 	{
 		if(gdsu == 4) return;
-		fprintf(mFile,"\tsetAttr \".gdsu\" %i;\n", gdsu);
+		writeInt(mFile,"\tsetAttr \".gdsu\" ",gdsu,";\n");
 	}
 	void setGridDivisionPerSpanV(short gdsv)
 	{
 		if(gdsv == 4) return;
-		fprintf(mFile,"\tsetAttr \".gdsv\" %i;\n", gdsv);
+		writeInt(mFile,"\tsetAttr \".gdsv\" ",gdsv,";\n");
 	}
 	void setExplicitTessellationAttributes(bool eta)
 	{
 		if(eta == false) return;
-		fprintf(mFile,"\tsetAttr \".eta\" %i;\n", eta);
+		writeInt(mFile,"\tsetAttr \".eta\" ",eta,";\n");
 	}
 	void setUDivisionsFactor(double nufa)
 	{
 		if(nufa == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".nufa\" %f;\n", nufa);
+		writeFloat(mFile,"\tsetAttr \".nufa\" ",nufa,";\n");
 	}
 	void setVDivisionsFactor(double nvfa)
 	{
 		if(nvfa == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".nvfa\" %f;\n", nvfa);
+		writeFloat(mFile,"\tsetAttr \".nvfa\" ",nvfa,";\n");
 	}
 	void setCurvatureTolerance(unsigned int cvto)
 	{
 		if(cvto == 2) return;
-		fprintf(mFile,"\tsetAttr \".cvto\" %i;\n", cvto);
+		writeInt(mFile,"\tsetAttr \".cvto\" ",cvto,";\n");
 	}
 	void setBasicTessellationType(unsigned int btt)
 	{
 		if(btt == 0) return;
-		fprintf(mFile,"\tsetAttr \".btt\" %i;\n", btt);
+		writeInt(mFile,"\tsetAttr \".btt\" ",btt,";\n");
 	}
 	void setDispSF(bool dsf)
 	{
 		if(dsf == false) return;
-		fprintf(mFile,"\tsetAttr \".dsf\" %i;\n", dsf);
+		writeInt(mFile,"\tsetAttr \".dsf\" ",dsf,";\n");
 	}
 	void setNormalsDisplayScale(double ndf)
 	{
 		if(ndf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ndf\" %f;\n", ndf);
+		writeFloat(mFile,"\tsetAttr \".ndf\" ",ndf,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiOverrideCaustics(bool oca)
 	{
 		if(oca == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oca\" %i;\n", oca);
+		writeInt(mFile,"\tsetAttr \".mrc.oca\" ",oca,";\n");
 	}
 	void setMiCausticAccuracy(short caa)
 	{
 		if(caa == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.caa\" %i;\n", caa);
+		writeInt(mFile,"\tsetAttr \".mrc.caa\" ",caa,";\n");
 	}
 	void setMiCausticRadius(float car)
 	{
 		if(car == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.car\" %f;\n", car);
+		writeFloat(mFile,"\tsetAttr \".mrc.car\" ",car,";\n");
 	}
 	void setMiOverrideGlobalIllumination(bool ogi)
 	{
 		if(ogi == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ogi\" %i;\n", ogi);
+		writeInt(mFile,"\tsetAttr \".mrc.ogi\" ",ogi,";\n");
 	}
 	void setMiGlobillumAccuracy(short gia)
 	{
 		if(gia == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gia\" %i;\n", gia);
+		writeInt(mFile,"\tsetAttr \".mrc.gia\" ",gia,";\n");
 	}
 	void setMiGlobillumRadius(float gir)
 	{
 		if(gir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gir\" %f;\n", gir);
+		writeFloat(mFile,"\tsetAttr \".mrc.gir\" ",gir,";\n");
 	}
 	void setMiOverrideFinalGather(bool ofg)
 	{
 		if(ofg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ofg\" %i;\n", ofg);
+		writeInt(mFile,"\tsetAttr \".mrc.ofg\" ",ofg,";\n");
 	}
 	void setMiFinalGatherRays(int fry)
 	{
 		if(fry == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fry\" %i;\n", fry);
+		writeInt(mFile,"\tsetAttr \".mrc.fry\" ",fry,";\n");
 	}
 	void setMiFinalGatherMinRadius(float fmn)
 	{
 		if(fmn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmn\" %f;\n", fmn);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmn\" ",fmn,";\n");
 	}
 	void setMiFinalGatherMaxRadius(float fmx)
 	{
 		if(fmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmx\" %f;\n", fmx);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmx\" ",fmx,";\n");
 	}
 	void setMiFinalGatherFilter(short ffi)
 	{
 		if(ffi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ffi\" %i;\n", ffi);
+		writeInt(mFile,"\tsetAttr \".mrc.ffi\" ",ffi,";\n");
 	}
 	void setMiFinalGatherView(bool fgv)
 	{
 		if(fgv == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgv\" %i;\n", fgv);
+		writeInt(mFile,"\tsetAttr \".mrc.fgv\" ",fgv,";\n");
 	}
 	void setMiOverrideSamples(bool oos)
 	{
 		if(oos == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oos\" %i;\n", oos);
+		writeInt(mFile,"\tsetAttr \".mrc.oos\" ",oos,";\n");
 	}
 	void setMiMinSamples(short mins)
 	{
 		if(mins == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mins\" %i;\n", mins);
+		writeInt(mFile,"\tsetAttr \".mrc.mins\" ",mins,";\n");
 	}
 	void setMiMaxSamples(short maxs)
 	{
 		if(maxs == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.maxs\" %i;\n", maxs);
+		writeInt(mFile,"\tsetAttr \".mrc.maxs\" ",maxs,";\n");
 	}
 	void setMiFinalGatherCast(bool fgc)
 	{
 		if(fgc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgc\" %i;\n", fgc);
+		writeInt(mFile,"\tsetAttr \".mrc.fgc\" ",fgc,";\n");
 	}
 	void setMiFinalGatherReceive(bool fge)
 	{
 		if(fge == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fge\" %i;\n", fge);
+		writeInt(mFile,"\tsetAttr \".mrc.fge\" ",fge,";\n");
 	}
 	void setMiTransparencyCast(bool tpc)
 	{
 		if(tpc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpc\" %i;\n", tpc);
+		writeInt(mFile,"\tsetAttr \".mrc.tpc\" ",tpc,";\n");
 	}
 	void setMiTransparencyReceive(bool tpr)
 	{
 		if(tpr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpr\" %i;\n", tpr);
+		writeInt(mFile,"\tsetAttr \".mrc.tpr\" ",tpr,";\n");
 	}
 	void setMiReflectionReceive(bool rflr)
 	{
 		if(rflr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.rflr\" %i;\n", rflr);
+		writeInt(mFile,"\tsetAttr \".mrc.rflr\" ",rflr,";\n");
 	}
 	void setMiRefractionReceive(bool rfrr)
 	{
 		if(rfrr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.rfrr\" %i;\n", rfrr);
+		writeInt(mFile,"\tsetAttr \".mrc.rfrr\" ",rfrr,";\n");
 	}
 	void getCreate()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getLocal()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getWorldSpace(size_t ws_i)const
 	{
-		fprintf(mFile,"\"%s.ws[%i]\"",mName.c_str(),ws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ws[",ws_i,"]\"");
 	}
 	void getWorldSpace()const
 	{
 
-		fprintf(mFile,"\"%s.ws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ws\"");
 	}
 	void getDivisionsU()const
 	{
-		fprintf(mFile,"\"%s.dvu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dvu\"");
 	}
 	void getDivisionsV()const
 	{
-		fprintf(mFile,"\"%s.dvv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dvv\"");
 	}
 	void getCurvePrecision()const
 	{
-		fprintf(mFile,"\"%s.cpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpr\"");
 	}
 	void getCurvePrecisionShaded()const
 	{
-		fprintf(mFile,"\"%s.cps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cps\"");
 	}
 	void getSimplifyMode()const
 	{
-		fprintf(mFile,"\"%s.sm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sm\"");
 	}
 	void getSimplifyU()const
 	{
-		fprintf(mFile,"\"%s.smu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smu\"");
 	}
 	void getSimplifyV()const
 	{
-		fprintf(mFile,"\"%s.smv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smv\"");
 	}
 	void getSmoothEdge()const
 	{
-		fprintf(mFile,"\"%s.ues\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ues\"");
 	}
 	void getSmoothEdgeRatio()const
 	{
-		fprintf(mFile,"\"%s.esr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".esr\"");
 	}
 	void getUseChordHeight()const
 	{
-		fprintf(mFile,"\"%s.uch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uch\"");
 	}
 	void getObjSpaceChordHeight()const
 	{
-		fprintf(mFile,"\"%s.uco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uco\"");
 	}
 	void getUseChordHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.ucr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ucr\"");
 	}
 	void getEdgeSwap()const
 	{
-		fprintf(mFile,"\"%s.es\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".es\"");
 	}
 	void getUseMinScreen()const
 	{
-		fprintf(mFile,"\"%s.uns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uns\"");
 	}
 	void getSelCVDisp()const
 	{
-		fprintf(mFile,"\"%s.scvd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scvd\"");
 	}
 	void getDispCV()const
 	{
-		fprintf(mFile,"\"%s.dcv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcv\"");
 	}
 	void getDispEP()const
 	{
-		fprintf(mFile,"\"%s.dep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dep\"");
 	}
 	void getDispHull()const
 	{
-		fprintf(mFile,"\"%s.dh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dh\"");
 	}
 	void getDispGeometry()const
 	{
-		fprintf(mFile,"\"%s.dg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dg\"");
 	}
 	void getDispOrigin()const
 	{
-		fprintf(mFile,"\"%s.dor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dor\"");
 	}
 	void getNumberU()const
 	{
-		fprintf(mFile,"\"%s.nu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nu\"");
 	}
 	void getModeU()const
 	{
-		fprintf(mFile,"\"%s.mu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mu\"");
 	}
 	void getNumberV()const
 	{
-		fprintf(mFile,"\"%s.nv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nv\"");
 	}
 	void getModeV()const
 	{
-		fprintf(mFile,"\"%s.mv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mv\"");
 	}
 	void getChordHeight()const
 	{
-		fprintf(mFile,"\"%s.ch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ch\"");
 	}
 	void getChordHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.chr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chr\"");
 	}
 	void getMinScreen()const
 	{
-		fprintf(mFile,"\"%s.mns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mns\"");
 	}
 	void getFormU()const
 	{
-		fprintf(mFile,"\"%s.fu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fu\"");
 	}
 	void getFormV()const
 	{
-		fprintf(mFile,"\"%s.fv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fv\"");
 	}
 	void getCached()const
 	{
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 	void getPatchUVIds(size_t pu_i)const
 	{
-		fprintf(mFile,"\"%s.pu[%i]\"",mName.c_str(),pu_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pu[",pu_i,"]\"");
 	}
 	void getPatchUVIds()const
 	{
 
-		fprintf(mFile,"\"%s.pu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pu\"");
 	}
 	void getInPlace()const
 	{
-		fprintf(mFile,"\"%s.ipo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ipo\"");
 	}
 	void getTweakSizeU()const
 	{
-		fprintf(mFile,"\"%s.tsu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tsu\"");
 	}
 	void getTweakSizeV()const
 	{
-		fprintf(mFile,"\"%s.tsv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tsv\"");
 	}
 	void getMinMaxRangeU()const
 	{
-		fprintf(mFile,"\"%s.mmu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmu\"");
 	}
 	void getMinValueU()const
 	{
-		fprintf(mFile,"\"%s.mmu.mnu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmu.mnu\"");
 	}
 	void getMaxValueU()const
 	{
-		fprintf(mFile,"\"%s.mmu.mxu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmu.mxu\"");
 	}
 	void getMinMaxRangeV()const
 	{
-		fprintf(mFile,"\"%s.mmv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmv\"");
 	}
 	void getMinValueV()const
 	{
-		fprintf(mFile,"\"%s.mmv.mnv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmv.mnv\"");
 	}
 	void getMaxValueV()const
 	{
-		fprintf(mFile,"\"%s.mmv.mxv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmv.mxv\"");
 	}
 	void getDegreeUV()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDegreeU()const
 	{
-		fprintf(mFile,"\"%s.d.du\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.du\"");
 	}
 	void getDegreeV()const
 	{
-		fprintf(mFile,"\"%s.d.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dv\"");
 	}
 	void getSpansUV()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getSpansU()const
 	{
-		fprintf(mFile,"\"%s.sp.su\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.su\"");
 	}
 	void getSpansV()const
 	{
-		fprintf(mFile,"\"%s.sp.sv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.sv\"");
 	}
 	void getDisplayRenderTessellation()const
 	{
-		fprintf(mFile,"\"%s.drt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drt\"");
 	}
 	void getRenderTriangleCount()const
 	{
-		fprintf(mFile,"\"%s.tcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcn\"");
 	}
 	void getFixTextureWarp()const
 	{
-		fprintf(mFile,"\"%s.ftwp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ftwp\"");
 	}
 	void getGridDivisionPerSpanU()const
 	{
-		fprintf(mFile,"\"%s.gdsu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gdsu\"");
 	}
 	void getGridDivisionPerSpanV()const
 	{
-		fprintf(mFile,"\"%s.gdsv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gdsv\"");
 	}
 	void getExplicitTessellationAttributes()const
 	{
-		fprintf(mFile,"\"%s.eta\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eta\"");
 	}
 	void getUDivisionsFactor()const
 	{
-		fprintf(mFile,"\"%s.nufa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nufa\"");
 	}
 	void getVDivisionsFactor()const
 	{
-		fprintf(mFile,"\"%s.nvfa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nvfa\"");
 	}
 	void getCurvatureTolerance()const
 	{
-		fprintf(mFile,"\"%s.cvto\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cvto\"");
 	}
 	void getBasicTessellationType()const
 	{
-		fprintf(mFile,"\"%s.btt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".btt\"");
 	}
 	void getDispSF()const
 	{
-		fprintf(mFile,"\"%s.dsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsf\"");
 	}
 	void getNormalsDisplayScale()const
 	{
-		fprintf(mFile,"\"%s.ndf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ndf\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiOverrideCaustics()const
 	{
-		fprintf(mFile,"\"%s.mrc.oca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oca\"");
 	}
 	void getMiCausticAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.caa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.caa\"");
 	}
 	void getMiCausticRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.car\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.car\"");
 	}
 	void getMiOverrideGlobalIllumination()const
 	{
-		fprintf(mFile,"\"%s.mrc.ogi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ogi\"");
 	}
 	void getMiGlobillumAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.gia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gia\"");
 	}
 	void getMiGlobillumRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.gir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gir\"");
 	}
 	void getMiOverrideFinalGather()const
 	{
-		fprintf(mFile,"\"%s.mrc.ofg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ofg\"");
 	}
 	void getMiFinalGatherRays()const
 	{
-		fprintf(mFile,"\"%s.mrc.fry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fry\"");
 	}
 	void getMiFinalGatherMinRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmn\"");
 	}
 	void getMiFinalGatherMaxRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmx\"");
 	}
 	void getMiFinalGatherFilter()const
 	{
-		fprintf(mFile,"\"%s.mrc.ffi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ffi\"");
 	}
 	void getMiFinalGatherView()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgv\"");
 	}
 	void getMiOverrideSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.oos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oos\"");
 	}
 	void getMiMinSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.mins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mins\"");
 	}
 	void getMiMaxSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.maxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.maxs\"");
 	}
 	void getMiFinalGatherCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgc\"");
 	}
 	void getMiFinalGatherReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.fge\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fge\"");
 	}
 	void getMiTransparencyCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpc\"");
 	}
 	void getMiTransparencyReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpr\"");
 	}
 	void getMiReflectionReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.rflr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.rflr\"");
 	}
 	void getMiRefractionReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.rfrr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.rfrr\"");
 	}
 protected:
 	NurbsSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,60 +27,60 @@ public:
 	void setSmoothEdge(bool ues)
 	{
 		if(ues == false) return;
-		fprintf(mFile,"\tsetAttr \".ues\" %i;\n", ues);
+		writeInt(mFile,"\tsetAttr \".ues\" ",ues,";\n");
 	}
 	void setSmoothEdgeRatio(double esr)
 	{
 		if(esr == 0.99) return;
-		fprintf(mFile,"\tsetAttr \".esr\" %f;\n", esr);
+		writeFloat(mFile,"\tsetAttr \".esr\" ",esr,";\n");
 	}
 	void setExplicitTessellationAttributes(bool eta)
 	{
 		if(eta == true) return;
-		fprintf(mFile,"\tsetAttr \".eta\" %i;\n", eta);
+		writeInt(mFile,"\tsetAttr \".eta\" ",eta,";\n");
 	}
 	void setUDivisionsFactor(double nuf)
 	{
 		if(nuf == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".nuf\" %f;\n", nuf);
+		writeFloat(mFile,"\tsetAttr \".nuf\" ",nuf,";\n");
 	}
 	void setVDivisionsFactor(double nvf)
 	{
 		if(nvf == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".nvf\" %f;\n", nvf);
+		writeFloat(mFile,"\tsetAttr \".nvf\" ",nvf,";\n");
 	}
 	void setCurvatureTolerance(unsigned int cvt)
 	{
 		if(cvt == 2) return;
-		fprintf(mFile,"\tsetAttr \".cvt\" %i;\n", cvt);
+		writeInt(mFile,"\tsetAttr \".cvt\" ",cvt,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getSmoothEdge()const
 	{
-		fprintf(mFile,"\"%s.ues\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ues\"");
 	}
 	void getSmoothEdgeRatio()const
 	{
-		fprintf(mFile,"\"%s.esr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".esr\"");
 	}
 	void getExplicitTessellationAttributes()const
 	{
-		fprintf(mFile,"\"%s.eta\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eta\"");
 	}
 	void getUDivisionsFactor()const
 	{
-		fprintf(mFile,"\"%s.nuf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nuf\"");
 	}
 	void getVDivisionsFactor()const
 	{
-		fprintf(mFile,"\"%s.nvf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nvf\"");
 	}
 	void getCurvatureTolerance()const
 	{
-		fprintf(mFile,"\"%s.cvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cvt\"");
 	}
 protected:
 	NurbsTessellate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
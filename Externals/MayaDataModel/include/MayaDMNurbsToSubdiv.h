@@ -27,46 +27,46 @@ public:
 	void setMaxPolyCount(int mpc)
 	{
 		if(mpc == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mpc\" %i;\n", mpc);
+		writeInt(mFile,"\tsetAttr \".mpc\" ",mpc,";\n");
 	}
 	void setReverseNormal(bool rn)
 	{
 		if(rn == true) return;
-		fprintf(mFile,"\tsetAttr \".rn\" %i;\n", rn);
+		writeInt(mFile,"\tsetAttr \".rn\" ",rn,";\n");
 	}
 	void setMatchPeriodic(bool mp)
 	{
 		if(mp == false) return;
-		fprintf(mFile,"\tsetAttr \".mp\" %i;\n", mp);
+		writeInt(mFile,"\tsetAttr \".mp\" ",mp,";\n");
 	}
 	void setCollapsePoles(bool cp)
 	{
 		if(cp == false) return;
-		fprintf(mFile,"\tsetAttr \".cp\" %i;\n", cp);
+		writeInt(mFile,"\tsetAttr \".cp\" ",cp,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getOutputSubd()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getMaxPolyCount()const
 	{
-		fprintf(mFile,"\"%s.mpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpc\"");
 	}
 	void getReverseNormal()const
 	{
-		fprintf(mFile,"\"%s.rn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rn\"");
 	}
 	void getMatchPeriodic()const
 	{
-		fprintf(mFile,"\"%s.mp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mp\"");
 	}
 	void getCollapsePoles()const
 	{
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 protected:
 	NurbsToSubdiv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,57 +27,57 @@ public:
 	void setSolidType(unsigned int st)
 	{
 		if(st == 2) return;
-		fprintf(mFile,"\tsetAttr \".st\" %i;\n", st);
+		writeInt(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void setCapType(unsigned int ct)
 	{
 		if(ct == 0) return;
-		fprintf(mFile,"\tsetAttr \".ct\" %i;\n", ct);
+		writeInt(mFile,"\tsetAttr \".ct\" ",ct,";\n");
 	}
 	void setTransform(const matrix& t)
 	{
 		if(t == identity) return;
-		fprintf(mFile,"\tsetAttr \".t\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"matrix\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffset(double o)
 	{
 		if(o == 1) return;
-		fprintf(mFile,"\tsetAttr \".o\" %f;\n", o);
+		writeFloat(mFile,"\tsetAttr \".o\" ",o,";\n");
 	}
 	void setBridge(unsigned int br)
 	{
 		if(br == 0) return;
-		fprintf(mFile,"\tsetAttr \".br\" %i;\n", br);
+		writeInt(mFile,"\tsetAttr \".br\" ",br,";\n");
 	}
 	void getSolidType()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getCapType()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getTransform()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getBridge()const
 	{
-		fprintf(mFile,"\"%s.br\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".br\"");
 	}
 	void getBridgeInU()const
 	{
-		fprintf(mFile,"\"%s.biu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".biu\"");
 	}
 	void getBridgeInV()const
 	{
-		fprintf(mFile,"\"%s.biv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".biv\"");
 	}
 protected:
 	NurbsToSubdivProc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setAttrType(unsigned int atyp)
 	{
 		if(atyp == 1) return;
-		fprintf(mFile,"\tsetAttr \".atyp\" %i;\n", atyp);
+		writeInt(mFile,"\tsetAttr \".atyp\" ",atyp,";\n");
 	}
 	void getAttrType()const
 	{
-		fprintf(mFile,"\"%s.atyp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".atyp\"");
 	}
 protected:
 	ObjectAttrFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,13 +27,13 @@ public:
 	void setBinName(const string& bnam)
 	{
 		if(bnam == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bnam\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bnam\" -type \"string\" ");
 		bnam.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getBinName()const
 	{
-		fprintf(mFile,"\"%s.bnam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bnam\"");
 	}
 protected:
 	ObjectBinFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
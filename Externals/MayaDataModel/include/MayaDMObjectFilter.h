@@ -27,67 +27,67 @@ public:
 	void setChild(bool ch)
 	{
 		if(ch == 0) return;
-		fprintf(mFile,"\tsetAttr \".ch\" %i;\n", ch);
+		writeInt(mFile,"\tsetAttr \".ch\" ",ch,";\n");
 	}
 	void setInvert(bool inv)
 	{
 		if(inv == 0) return;
-		fprintf(mFile,"\tsetAttr \".inv\" %i;\n", inv);
+		writeInt(mFile,"\tsetAttr \".inv\" ",inv,";\n");
 	}
 	void setAnnotation(const string& an)
 	{
 		if(an == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".an\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".an\" -type \"string\" ");
 		an.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCategory(const stringArray& cat)
 	{
-		fprintf(mFile,"\tsetAttr \".cat\" -type \"stringArray\" ");
+		writeString(mFile,"\tsetAttr \".cat\" -type \"stringArray\" ");
 		cat.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisable(bool dis)
 	{
 		if(dis == 0) return;
-		fprintf(mFile,"\tsetAttr \".dis\" %i;\n", dis);
+		writeInt(mFile,"\tsetAttr \".dis\" ",dis,";\n");
 	}
 	void setFilterClass(unsigned int fcls)
 	{
 		if(fcls == 0) return;
-		fprintf(mFile,"\tsetAttr \".fcls\" %i;\n", fcls);
+		writeInt(mFile,"\tsetAttr \".fcls\" ",fcls,";\n");
 	}
 	void getChild()const
 	{
-		fprintf(mFile,"\"%s.ch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ch\"");
 	}
 	void getInvert()const
 	{
-		fprintf(mFile,"\"%s.inv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inv\"");
 	}
 	void getInputList()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getOutputList()const
 	{
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 	void getAnnotation()const
 	{
-		fprintf(mFile,"\"%s.an\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".an\"");
 	}
 	void getCategory()const
 	{
-		fprintf(mFile,"\"%s.cat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cat\"");
 	}
 	void getDisable()const
 	{
-		fprintf(mFile,"\"%s.dis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dis\"");
 	}
 	void getFilterClass()const
 	{
-		fprintf(mFile,"\"%s.fcls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcls\"");
 	}
 protected:
 	ObjectFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,15 +27,15 @@ public:
 	void setFilterType(unsigned int ftyp)
 	{
 		if(ftyp == 0) return;
-		fprintf(mFile,"\tsetAttr \".ftyp\" %i;\n", ftyp);
+		writeInt(mFile,"\tsetAttr \".ftyp\" ",ftyp,";\n");
 	}
 	void getResultList()const
 	{
-		fprintf(mFile,"\"%s.res\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res\"");
 	}
 	void getFilterType()const
 	{
-		fprintf(mFile,"\"%s.ftyp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ftyp\"");
 	}
 protected:
 	ObjectMultiFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,33 +27,33 @@ public:
 	void setRegExp(const string& rex)
 	{
 		if(rex == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".rex\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rex\" -type \"string\" ");
 		rex.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNameStrings(const stringArray& nstr)
 	{
 		if(nstr.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".nstr\" -type \"stringArray\" ");
+		writeString(mFile,"\tsetAttr \".nstr\" -type \"stringArray\" ");
 		nstr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttrName(bool attr)
 	{
 		if(attr == false) return;
-		fprintf(mFile,"\tsetAttr \".attr\" %i;\n", attr);
+		writeInt(mFile,"\tsetAttr \".attr\" ",attr,";\n");
 	}
 	void getRegExp()const
 	{
-		fprintf(mFile,"\"%s.rex\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rex\"");
 	}
 	void getNameStrings()const
 	{
-		fprintf(mFile,"\"%s.nstr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nstr\"");
 	}
 	void getAttrName()const
 	{
-		fprintf(mFile,"\"%s.attr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".attr\"");
 	}
 protected:
 	ObjectNameFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,101 +27,101 @@ public:
 	void setShaders(bool shad)
 	{
 		if(shad == 0) return;
-		fprintf(mFile,"\tsetAttr \".shad\" %i;\n", shad);
+		writeInt(mFile,"\tsetAttr \".shad\" ",shad,";\n");
 	}
 	void setTextures(bool txtr)
 	{
 		if(txtr == 0) return;
-		fprintf(mFile,"\tsetAttr \".txtr\" %i;\n", txtr);
+		writeInt(mFile,"\tsetAttr \".txtr\" ",txtr,";\n");
 	}
 	void setTextures2D(bool tx2d)
 	{
 		if(tx2d == 0) return;
-		fprintf(mFile,"\tsetAttr \".tx2d\" %i;\n", tx2d);
+		writeInt(mFile,"\tsetAttr \".tx2d\" ",tx2d,";\n");
 	}
 	void setTextures3D(bool tx3d)
 	{
 		if(tx3d == 0) return;
-		fprintf(mFile,"\tsetAttr \".tx3d\" %i;\n", tx3d);
+		writeInt(mFile,"\tsetAttr \".tx3d\" ",tx3d,";\n");
 	}
 	void setLights(bool lght)
 	{
 		if(lght == 0) return;
-		fprintf(mFile,"\tsetAttr \".lght\" %i;\n", lght);
+		writeInt(mFile,"\tsetAttr \".lght\" ",lght,";\n");
 	}
 	void setExclusiveLights(bool exlt)
 	{
 		if(exlt == 0) return;
-		fprintf(mFile,"\tsetAttr \".exlt\" %i;\n", exlt);
+		writeInt(mFile,"\tsetAttr \".exlt\" ",exlt,";\n");
 	}
 	void setNonExclusiveLights(bool nxlt)
 	{
 		if(nxlt == 0) return;
-		fprintf(mFile,"\tsetAttr \".nxlt\" %i;\n", nxlt);
+		writeInt(mFile,"\tsetAttr \".nxlt\" ",nxlt,";\n");
 	}
 	void setPostProcess(bool post)
 	{
 		if(post == 0) return;
-		fprintf(mFile,"\tsetAttr \".post\" %i;\n", post);
+		writeInt(mFile,"\tsetAttr \".post\" ",post,";\n");
 	}
 	void setUtility(bool util)
 	{
 		if(util == 0) return;
-		fprintf(mFile,"\tsetAttr \".util\" %i;\n", util);
+		writeInt(mFile,"\tsetAttr \".util\" ",util,";\n");
 	}
 	void setRenderableObjectSets(bool ros)
 	{
 		if(ros == 0) return;
-		fprintf(mFile,"\tsetAttr \".ros\" %i;\n", ros);
+		writeInt(mFile,"\tsetAttr \".ros\" ",ros,";\n");
 	}
 	void setLightSets(bool ls)
 	{
 		if(ls == 0) return;
-		fprintf(mFile,"\tsetAttr \".ls\" %i;\n", ls);
+		writeInt(mFile,"\tsetAttr \".ls\" ",ls,";\n");
 	}
 	void getShaders()const
 	{
-		fprintf(mFile,"\"%s.shad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shad\"");
 	}
 	void getTextures()const
 	{
-		fprintf(mFile,"\"%s.txtr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txtr\"");
 	}
 	void getTextures2D()const
 	{
-		fprintf(mFile,"\"%s.tx2d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx2d\"");
 	}
 	void getTextures3D()const
 	{
-		fprintf(mFile,"\"%s.tx3d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx3d\"");
 	}
 	void getLights()const
 	{
-		fprintf(mFile,"\"%s.lght\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lght\"");
 	}
 	void getExclusiveLights()const
 	{
-		fprintf(mFile,"\"%s.exlt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".exlt\"");
 	}
 	void getNonExclusiveLights()const
 	{
-		fprintf(mFile,"\"%s.nxlt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nxlt\"");
 	}
 	void getPostProcess()const
 	{
-		fprintf(mFile,"\"%s.post\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".post\"");
 	}
 	void getUtility()const
 	{
-		fprintf(mFile,"\"%s.util\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".util\"");
 	}
 	void getRenderableObjectSets()const
 	{
-		fprintf(mFile,"\"%s.ros\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ros\"");
 	}
 	void getLightSets()const
 	{
-		fprintf(mFile,"\"%s.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls\"");
 	}
 protected:
 	ObjectRenderFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,40 +27,40 @@ public:
 	void setArrayArg(bool aarg)
 	{
 		if(aarg == 1) return;
-		fprintf(mFile,"\tsetAttr \".aarg\" %i;\n", aarg);
+		writeInt(mFile,"\tsetAttr \".aarg\" ",aarg,";\n");
 	}
 	void setProcName(const string& pnam)
 	{
 		if(pnam == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".pnam\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".pnam\" -type \"string\" ");
 		pnam.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttrName(bool attr)
 	{
 		if(attr == false) return;
-		fprintf(mFile,"\tsetAttr \".attr\" %i;\n", attr);
+		writeInt(mFile,"\tsetAttr \".attr\" ",attr,";\n");
 	}
 	void setUniqueNodeNames(bool unn)
 	{
 		if(unn == 0) return;
-		fprintf(mFile,"\tsetAttr \".unn\" %i;\n", unn);
+		writeInt(mFile,"\tsetAttr \".unn\" ",unn,";\n");
 	}
 	void getArrayArg()const
 	{
-		fprintf(mFile,"\"%s.aarg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aarg\"");
 	}
 	void getProcName()const
 	{
-		fprintf(mFile,"\"%s.pnam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pnam\"");
 	}
 	void getAttrName()const
 	{
-		fprintf(mFile,"\"%s.attr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".attr\"");
 	}
 	void getUniqueNodeNames()const
 	{
-		fprintf(mFile,"\"%s.unn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unn\"");
 	}
 protected:
 	ObjectScriptFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
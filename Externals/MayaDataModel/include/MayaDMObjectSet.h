@@ -27,88 +27,88 @@ public:
 	void setMemberWireframeColor(short mwc)
 	{
 		if(mwc == -1) return;
-		fprintf(mFile,"\tsetAttr \".mwc\" %i;\n", mwc);
+		writeInt(mFile,"\tsetAttr \".mwc\" ",mwc,";\n");
 	}
 	void setAnnotation(const string& an)
 	{
 		if(an == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".an\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".an\" -type \"string\" ");
 		an.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIsLayer(bool il)
 	{
 		if(il == false) return;
-		fprintf(mFile,"\tsetAttr \".il\" %i;\n", il);
+		writeInt(mFile,"\tsetAttr \".il\" ",il,";\n");
 	}
 	void setVerticesOnlySet(bool vo)
 	{
 		if(vo == false) return;
-		fprintf(mFile,"\tsetAttr \".vo\" %i;\n", vo);
+		writeInt(mFile,"\tsetAttr \".vo\" ",vo,";\n");
 	}
 	void setEdgesOnlySet(bool eo)
 	{
 		if(eo == false) return;
-		fprintf(mFile,"\tsetAttr \".eo\" %i;\n", eo);
+		writeInt(mFile,"\tsetAttr \".eo\" ",eo,";\n");
 	}
 	void setFacetsOnlySet(bool fo)
 	{
 		if(fo == false) return;
-		fprintf(mFile,"\tsetAttr \".fo\" %i;\n", fo);
+		writeInt(mFile,"\tsetAttr \".fo\" ",fo,";\n");
 	}
 	void setEditPointsOnlySet(bool epo)
 	{
 		if(epo == false) return;
-		fprintf(mFile,"\tsetAttr \".epo\" %i;\n", epo);
+		writeInt(mFile,"\tsetAttr \".epo\" ",epo,";\n");
 	}
 	void setRenderableOnlySet(bool ro)
 	{
 		if(ro == false) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %i;\n", ro);
+		writeInt(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void getDagSetMembers(size_t dsm_i)const
 	{
-		fprintf(mFile,"\"%s.dsm[%i]\"",mName.c_str(),dsm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dsm[",dsm_i,"]\"");
 	}
 	void getDagSetMembers()const
 	{
 
-		fprintf(mFile,"\"%s.dsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsm\"");
 	}
 	void getDnSetMembers(size_t dnsm_i)const
 	{
-		fprintf(mFile,"\"%s.dnsm[%i]\"",mName.c_str(),dnsm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dnsm[",dnsm_i,"]\"");
 	}
 	void getDnSetMembers()const
 	{
 
-		fprintf(mFile,"\"%s.dnsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dnsm\"");
 	}
 	void getMemberWireframeColor()const
 	{
-		fprintf(mFile,"\"%s.mwc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mwc\"");
 	}
 	void getPartition()const
 	{
-		fprintf(mFile,"\"%s.pa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa\"");
 	}
 	void getGroupNodes(size_t gn_i)const
 	{
-		fprintf(mFile,"\"%s.gn[%i]\"",mName.c_str(),gn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gn[",gn_i,"]\"");
 	}
 	void getGroupNodes()const
 	{
 
-		fprintf(mFile,"\"%s.gn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gn\"");
 	}
 	void getUsedBy(size_t ub_i)const
 	{
-		fprintf(mFile,"\"%s.ub[%i]\"",mName.c_str(),ub_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ub[",ub_i,"]\"");
 	}
 	void getUsedBy()const
 	{
 
-		fprintf(mFile,"\"%s.ub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ub\"");
 	}
 protected:
 	ObjectSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,17 +27,17 @@ public:
 	void setTypeName(const string& tnam)
 	{
 		if(tnam == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".tnam\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".tnam\" -type \"string\" ");
 		tnam.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getTypeName()const
 	{
-		fprintf(mFile,"\"%s.tnam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnam\"");
 	}
 	void getType()const
 	{
-		fprintf(mFile,"\"%s.typ\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".typ\"");
 	}
 protected:
 	ObjectTypeFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		unsigned int waveHeight_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", waveHeight_Position);
-			fprintf(file,"%f ", waveHeight_FloatValue);
-			fprintf(file,"%i", waveHeight_Interp);
+			writeFloat(file,"",waveHeight_Position," ");
+			writeFloat(file,"",waveHeight_FloatValue," ");
+			writeInt(file,"",waveHeight_Interp);
 		}
 	};
 	struct WaveTurbulence{
@@ -34,9 +34,9 @@ public:
 		unsigned int waveTurbulence_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", waveTurbulence_Position);
-			fprintf(file,"%f ", waveTurbulence_FloatValue);
-			fprintf(file,"%i", waveTurbulence_Interp);
+			writeFloat(file,"",waveTurbulence_Position," ");
+			writeFloat(file,"",waveTurbulence_FloatValue," ");
+			writeInt(file,"",waveTurbulence_Interp);
 		}
 	};
 	struct WavePeaking{
@@ -45,9 +45,9 @@ public:
 		unsigned int wavePeaking_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", wavePeaking_Position);
-			fprintf(file,"%f ", wavePeaking_FloatValue);
-			fprintf(file,"%i", wavePeaking_Interp);
+			writeFloat(file,"",wavePeaking_Position," ");
+			writeFloat(file,"",wavePeaking_FloatValue," ");
+			writeInt(file,"",wavePeaking_Interp);
 		}
 	};
 public:
@@ -60,371 +60,371 @@ public:
 	void setTime(float ti)
 	{
 		if(ti == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ti\" %f;\n", ti);
+		writeFloat(mFile,"\tsetAttr \".ti\" ",ti,";\n");
 	}
 	void setScale(float sc)
 	{
 		if(sc == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %f;\n", sc);
+		writeFloat(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setWindUV(const float2& wi)
 	{
 		if(wi == float2(1.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".wi\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".wi\" -type \"float2\" ");
 		wi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWindU(float wiu)
 	{
 		if(wiu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wi.wiu\" %f;\n", wiu);
+		writeFloat(mFile,"\tsetAttr \".wi.wiu\" ",wiu,";\n");
 	}
 	void setWindV(float wiv)
 	{
 		if(wiv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wi.wiv\" %f;\n", wiv);
+		writeFloat(mFile,"\tsetAttr \".wi.wiv\" ",wiv,";\n");
 	}
 	void setObserverSpeed(float os)
 	{
 		if(os == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".os\" %f;\n", os);
+		writeFloat(mFile,"\tsetAttr \".os\" ",os,";\n");
 	}
 	void setWaveDirSpread(float wd)
 	{
 		if(wd == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".wd\" %f;\n", wd);
+		writeFloat(mFile,"\tsetAttr \".wd\" ",wd,";\n");
 	}
 	void setNumFrequencies(float nf)
 	{
 		if(nf == 3.0) return;
-		fprintf(mFile,"\tsetAttr \".nf\" %f;\n", nf);
+		writeFloat(mFile,"\tsetAttr \".nf\" ",nf,";\n");
 	}
 	void setWaveLengthMin(float wlm)
 	{
 		if(wlm == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".wlm\" %f;\n", wlm);
+		writeFloat(mFile,"\tsetAttr \".wlm\" ",wlm,";\n");
 	}
 	void setWaveLengthMax(float wlx)
 	{
 		if(wlx == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".wlx\" %f;\n", wlx);
+		writeFloat(mFile,"\tsetAttr \".wlx\" ",wlx,";\n");
 	}
 	void setWaveHeight(size_t wh_i,const WaveHeight& wh)
 	{
-		fprintf(mFile,"\tsetAttr \".wh[%i]\" ",wh_i);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_i,"]\" ");
 		wh.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaveHeight(size_t wh_start,size_t wh_end,WaveHeight* wh)
 	{
-		fprintf(mFile,"\tsetAttr \".wh[%i:%i]\" ", wh_start,wh_end);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_start); writeInt(mFile,":",wh_end,"]\" ");
 		size_t size = (wh_end-wh_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wh[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWaveHeight(size_t wh_start,size_t wh_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wh[%i:%i]\"",wh_start,wh_end);
-		fprintf(mFile," -type \"WaveHeight\" ");
+		writeInt(mFile,"\tsetAttr \".wh[",wh_start); writeInt(mFile,":",wh_end,"]\"");
+		writeString(mFile," -type \"WaveHeight\" ");
 	}
 	void appendWaveHeight(const WaveHeight& wh)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wh.write(mFile);
 	}
 	void endWaveHeight()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaveHeight_Position(size_t wh_i,float whp)
 	{
 		if(whp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wh[%i].whp\" %f;\n", wh_i,whp);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_i); writeFloat(mFile,"].whp\" ",whp,";\n");
 	}
 	void setWaveHeight_FloatValue(size_t wh_i,float whfv)
 	{
 		if(whfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wh[%i].whfv\" %f;\n", wh_i,whfv);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_i); writeFloat(mFile,"].whfv\" ",whfv,";\n");
 	}
 	void setWaveHeight_Interp(size_t wh_i,unsigned int whi)
 	{
 		if(whi == 0) return;
-		fprintf(mFile,"\tsetAttr \".wh[%i].whi\" %i;\n", wh_i,whi);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_i); writeInt(mFile,"].whi\" ",whi,";\n");
 	}
 	void setWaveTurbulence(size_t wtb_i,const WaveTurbulence& wtb)
 	{
-		fprintf(mFile,"\tsetAttr \".wtb[%i]\" ",wtb_i);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_i,"]\" ");
 		wtb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaveTurbulence(size_t wtb_start,size_t wtb_end,WaveTurbulence* wtb)
 	{
-		fprintf(mFile,"\tsetAttr \".wtb[%i:%i]\" ", wtb_start,wtb_end);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_start); writeInt(mFile,":",wtb_end,"]\" ");
 		size_t size = (wtb_end-wtb_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wtb[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWaveTurbulence(size_t wtb_start,size_t wtb_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wtb[%i:%i]\"",wtb_start,wtb_end);
-		fprintf(mFile," -type \"WaveTurbulence\" ");
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_start); writeInt(mFile,":",wtb_end,"]\"");
+		writeString(mFile," -type \"WaveTurbulence\" ");
 	}
 	void appendWaveTurbulence(const WaveTurbulence& wtb)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wtb.write(mFile);
 	}
 	void endWaveTurbulence()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaveTurbulence_Position(size_t wtb_i,float wtbp)
 	{
 		if(wtbp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wtb[%i].wtbp\" %f;\n", wtb_i,wtbp);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_i); writeFloat(mFile,"].wtbp\" ",wtbp,";\n");
 	}
 	void setWaveTurbulence_FloatValue(size_t wtb_i,float wtbfv)
 	{
 		if(wtbfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wtb[%i].wtbfv\" %f;\n", wtb_i,wtbfv);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_i); writeFloat(mFile,"].wtbfv\" ",wtbfv,";\n");
 	}
 	void setWaveTurbulence_Interp(size_t wtb_i,unsigned int wtbi)
 	{
 		if(wtbi == 0) return;
-		fprintf(mFile,"\tsetAttr \".wtb[%i].wtbi\" %i;\n", wtb_i,wtbi);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_i); writeInt(mFile,"].wtbi\" ",wtbi,";\n");
 	}
 	void setWavePeaking(size_t wp_i,const WavePeaking& wp)
 	{
-		fprintf(mFile,"\tsetAttr \".wp[%i]\" ",wp_i);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_i,"]\" ");
 		wp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWavePeaking(size_t wp_start,size_t wp_end,WavePeaking* wp)
 	{
-		fprintf(mFile,"\tsetAttr \".wp[%i:%i]\" ", wp_start,wp_end);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_start); writeInt(mFile,":",wp_end,"]\" ");
 		size_t size = (wp_end-wp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wp[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWavePeaking(size_t wp_start,size_t wp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wp[%i:%i]\"",wp_start,wp_end);
-		fprintf(mFile," -type \"WavePeaking\" ");
+		writeInt(mFile,"\tsetAttr \".wp[",wp_start); writeInt(mFile,":",wp_end,"]\"");
+		writeString(mFile," -type \"WavePeaking\" ");
 	}
 	void appendWavePeaking(const WavePeaking& wp)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wp.write(mFile);
 	}
 	void endWavePeaking()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWavePeaking_Position(size_t wp_i,float wpp)
 	{
 		if(wpp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wp[%i].wpp\" %f;\n", wp_i,wpp);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_i); writeFloat(mFile,"].wpp\" ",wpp,";\n");
 	}
 	void setWavePeaking_FloatValue(size_t wp_i,float wpfv)
 	{
 		if(wpfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wp[%i].wpfv\" %f;\n", wp_i,wpfv);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_i); writeFloat(mFile,"].wpfv\" ",wpfv,";\n");
 	}
 	void setWavePeaking_Interp(size_t wp_i,unsigned int wpi)
 	{
 		if(wpi == 0) return;
-		fprintf(mFile,"\tsetAttr \".wp[%i].wpi\" %i;\n", wp_i,wpi);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_i); writeInt(mFile,"].wpi\" ",wpi,";\n");
 	}
 	void setFoamEmission(float fme)
 	{
 		if(fme == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fme\" %f;\n", fme);
+		writeFloat(mFile,"\tsetAttr \".fme\" ",fme,";\n");
 	}
 	void setFoamThreshold(float fmt)
 	{
 		if(fmt == 0.51) return;
-		fprintf(mFile,"\tsetAttr \".fmt\" %f;\n", fmt);
+		writeFloat(mFile,"\tsetAttr \".fmt\" ",fmt,";\n");
 	}
 	void setColorMode(unsigned int cmd)
 	{
 		if(cmd == 0) return;
-		fprintf(mFile,"\tsetAttr \".cmd\" %i;\n", cmd);
+		writeInt(mFile,"\tsetAttr \".cmd\" ",cmd,";\n");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.ti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ti\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getWindUV()const
 	{
-		fprintf(mFile,"\"%s.wi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi\"");
 	}
 	void getWindU()const
 	{
-		fprintf(mFile,"\"%s.wi.wiu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi.wiu\"");
 	}
 	void getWindV()const
 	{
-		fprintf(mFile,"\"%s.wi.wiv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi.wiv\"");
 	}
 	void getObserverSpeed()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getWaveDirSpread()const
 	{
-		fprintf(mFile,"\"%s.wd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wd\"");
 	}
 	void getNumFrequencies()const
 	{
-		fprintf(mFile,"\"%s.nf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nf\"");
 	}
 	void getWaveLengthMin()const
 	{
-		fprintf(mFile,"\"%s.wlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wlm\"");
 	}
 	void getWaveLengthMax()const
 	{
-		fprintf(mFile,"\"%s.wlx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wlx\"");
 	}
 	void getWaveHeight(size_t wh_i)const
 	{
-		fprintf(mFile,"\"%s.wh[%i]\"",mName.c_str(),wh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wh[",wh_i,"]\"");
 	}
 	void getWaveHeight()const
 	{
 
-		fprintf(mFile,"\"%s.wh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wh\"");
 	}
 	void getWaveHeight_Position(size_t wh_i)const
 	{
-		fprintf(mFile,"\"%s.wh[%i].whp\"",mName.c_str(),wh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wh[",wh_i,"].whp\"");
 	}
 	void getWaveHeight_Position()const
 	{
 
-		fprintf(mFile,"\"%s.wh.whp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wh.whp\"");
 	}
 	void getWaveHeight_FloatValue(size_t wh_i)const
 	{
-		fprintf(mFile,"\"%s.wh[%i].whfv\"",mName.c_str(),wh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wh[",wh_i,"].whfv\"");
 	}
 	void getWaveHeight_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.wh.whfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wh.whfv\"");
 	}
 	void getWaveHeight_Interp(size_t wh_i)const
 	{
-		fprintf(mFile,"\"%s.wh[%i].whi\"",mName.c_str(),wh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wh[",wh_i,"].whi\"");
 	}
 	void getWaveHeight_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.wh.whi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wh.whi\"");
 	}
 	void getWaveTurbulence(size_t wtb_i)const
 	{
-		fprintf(mFile,"\"%s.wtb[%i]\"",mName.c_str(),wtb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wtb[",wtb_i,"]\"");
 	}
 	void getWaveTurbulence()const
 	{
 
-		fprintf(mFile,"\"%s.wtb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtb\"");
 	}
 	void getWaveTurbulence_Position(size_t wtb_i)const
 	{
-		fprintf(mFile,"\"%s.wtb[%i].wtbp\"",mName.c_str(),wtb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wtb[",wtb_i,"].wtbp\"");
 	}
 	void getWaveTurbulence_Position()const
 	{
 
-		fprintf(mFile,"\"%s.wtb.wtbp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtb.wtbp\"");
 	}
 	void getWaveTurbulence_FloatValue(size_t wtb_i)const
 	{
-		fprintf(mFile,"\"%s.wtb[%i].wtbfv\"",mName.c_str(),wtb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wtb[",wtb_i,"].wtbfv\"");
 	}
 	void getWaveTurbulence_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.wtb.wtbfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtb.wtbfv\"");
 	}
 	void getWaveTurbulence_Interp(size_t wtb_i)const
 	{
-		fprintf(mFile,"\"%s.wtb[%i].wtbi\"",mName.c_str(),wtb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wtb[",wtb_i,"].wtbi\"");
 	}
 	void getWaveTurbulence_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.wtb.wtbi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtb.wtbi\"");
 	}
 	void getWavePeaking(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i]\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"]\"");
 	}
 	void getWavePeaking()const
 	{
 
-		fprintf(mFile,"\"%s.wp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp\"");
 	}
 	void getWavePeaking_Position(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpp\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpp\"");
 	}
 	void getWavePeaking_Position()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpp\"");
 	}
 	void getWavePeaking_FloatValue(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpfv\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpfv\"");
 	}
 	void getWavePeaking_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpfv\"");
 	}
 	void getWavePeaking_Interp(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpi\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpi\"");
 	}
 	void getWavePeaking_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpi\"");
 	}
 	void getFoamEmission()const
 	{
-		fprintf(mFile,"\"%s.fme\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fme\"");
 	}
 	void getFoamThreshold()const
 	{
-		fprintf(mFile,"\"%s.fmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fmt\"");
 	}
 	void getColorMode()const
 	{
-		fprintf(mFile,"\"%s.cmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmd\"");
 	}
 	void getOutFoam()const
 	{
-		fprintf(mFile,"\"%s.ofm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofm\"");
 	}
 protected:
 	Ocean(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,10 +23,10 @@ public:
 		unsigned int environment_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", environment_Position);
+			writeFloat(file,"",environment_Position," ");
 			environment_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", environment_Interp);
+			writeString(file," ");
+			writeInt(file,"",environment_Interp);
 		}
 	};
 	struct WaveHeight{
@@ -35,9 +35,9 @@ public:
 		unsigned int waveHeight_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", waveHeight_Position);
-			fprintf(file,"%f ", waveHeight_FloatValue);
-			fprintf(file,"%i", waveHeight_Interp);
+			writeFloat(file,"",waveHeight_Position," ");
+			writeFloat(file,"",waveHeight_FloatValue," ");
+			writeInt(file,"",waveHeight_Interp);
 		}
 	};
 	struct WaveTurbulence{
@@ -46,9 +46,9 @@ public:
 		unsigned int waveTurbulence_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", waveTurbulence_Position);
-			fprintf(file,"%f ", waveTurbulence_FloatValue);
-			fprintf(file,"%i", waveTurbulence_Interp);
+			writeFloat(file,"",waveTurbulence_Position," ");
+			writeFloat(file,"",waveTurbulence_FloatValue," ");
+			writeInt(file,"",waveTurbulence_Interp);
 		}
 	};
 	struct WavePeaking{
@@ -57,9 +57,9 @@ public:
 		unsigned int wavePeaking_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", wavePeaking_Position);
-			fprintf(file,"%f ", wavePeaking_FloatValue);
-			fprintf(file,"%i", wavePeaking_Interp);
+			writeFloat(file,"",wavePeaking_Position," ");
+			writeFloat(file,"",wavePeaking_FloatValue," ");
+			writeInt(file,"",wavePeaking_Interp);
 		}
 	};
 public:
@@ -72,1637 +72,1637 @@ public:
 	void setRefractionLimit(short rdl)
 	{
 		if(rdl == 6) return;
-		fprintf(mFile,"\tsetAttr \".rdl\" %i;\n", rdl);
+		writeInt(mFile,"\tsetAttr \".rdl\" ",rdl,";\n");
 	}
 	void setRefractiveIndex(float rfi)
 	{
 		if(rfi == 1.3) return;
-		fprintf(mFile,"\tsetAttr \".rfi\" %f;\n", rfi);
+		writeFloat(mFile,"\tsetAttr \".rfi\" ",rfi,";\n");
 	}
 	void setRefractions(bool rfc)
 	{
 		if(rfc == false) return;
-		fprintf(mFile,"\tsetAttr \".rfc\" %i;\n", rfc);
+		writeInt(mFile,"\tsetAttr \".rfc\" ",rfc,";\n");
 	}
 	void setDiffuse(float dc)
 	{
 		if(dc == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %f;\n", dc);
+		writeFloat(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void setWaterColor(const float3& wc)
 	{
-		fprintf(mFile,"\tsetAttr \".wc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".wc\" -type \"float3\" ");
 		wc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaterColorR(float wcr)
 	{
 		if(wcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wc.wcr\" %f;\n", wcr);
+		writeFloat(mFile,"\tsetAttr \".wc.wcr\" ",wcr,";\n");
 	}
 	void setWaterColorG(float wcg)
 	{
 		if(wcg == 0.36) return;
-		fprintf(mFile,"\tsetAttr \".wc.wcg\" %f;\n", wcg);
+		writeFloat(mFile,"\tsetAttr \".wc.wcg\" ",wcg,";\n");
 	}
 	void setWaterColorB(float wcb)
 	{
 		if(wcb == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".wc.wcb\" %f;\n", wcb);
+		writeFloat(mFile,"\tsetAttr \".wc.wcb\" ",wcb,";\n");
 	}
 	void setTransparency(const float3& it)
 	{
-		fprintf(mFile,"\tsetAttr \".it\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".it\" -type \"float3\" ");
 		it.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparencyR(float itr)
 	{
 		if(itr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itr\" %f;\n", itr);
+		writeFloat(mFile,"\tsetAttr \".it.itr\" ",itr,";\n");
 	}
 	void setTransparencyG(float itg)
 	{
 		if(itg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itg\" %f;\n", itg);
+		writeFloat(mFile,"\tsetAttr \".it.itg\" ",itg,";\n");
 	}
 	void setTransparencyB(float itb)
 	{
 		if(itb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itb\" %f;\n", itb);
+		writeFloat(mFile,"\tsetAttr \".it.itb\" ",itb,";\n");
 	}
 	void setAmbientColor(const float3& ambc)
 	{
-		fprintf(mFile,"\tsetAttr \".ambc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ambc\" -type \"float3\" ");
 		ambc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAmbientColorR(float acr)
 	{
 		if(acr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acr\" %f;\n", acr);
+		writeFloat(mFile,"\tsetAttr \".ambc.acr\" ",acr,";\n");
 	}
 	void setAmbientColorG(float acg)
 	{
 		if(acg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acg\" %f;\n", acg);
+		writeFloat(mFile,"\tsetAttr \".ambc.acg\" ",acg,";\n");
 	}
 	void setAmbientColorB(float acb)
 	{
 		if(acb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acb\" %f;\n", acb);
+		writeFloat(mFile,"\tsetAttr \".ambc.acb\" ",acb,";\n");
 	}
 	void setIncandescence(const float3& ic)
 	{
-		fprintf(mFile,"\tsetAttr \".ic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ic\" -type \"float3\" ");
 		ic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescenceR(float ir)
 	{
 		if(ir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ir\" %f;\n", ir);
+		writeFloat(mFile,"\tsetAttr \".ic.ir\" ",ir,";\n");
 	}
 	void setIncandescenceG(float ig)
 	{
 		if(ig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ig\" %f;\n", ig);
+		writeFloat(mFile,"\tsetAttr \".ic.ig\" ",ig,";\n");
 	}
 	void setIncandescenceB(float ib)
 	{
 		if(ib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ib\" %f;\n", ib);
+		writeFloat(mFile,"\tsetAttr \".ic.ib\" ",ib,";\n");
 	}
 	void setTranslucence(float tc)
 	{
 		if(tc == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".tc\" %f;\n", tc);
+		writeFloat(mFile,"\tsetAttr \".tc\" ",tc,";\n");
 	}
 	void setTranslucenceFocus(float tcf)
 	{
 		if(tcf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcf\" %f;\n", tcf);
+		writeFloat(mFile,"\tsetAttr \".tcf\" ",tcf,";\n");
 	}
 	void setTranslucenceDepth(float trsd)
 	{
 		if(trsd == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".trsd\" %f;\n", trsd);
+		writeFloat(mFile,"\tsetAttr \".trsd\" ",trsd,";\n");
 	}
 	void setOpacityDepth(float opad)
 	{
 		if(opad == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".opad\" %f;\n", opad);
+		writeFloat(mFile,"\tsetAttr \".opad\" ",opad,";\n");
 	}
 	void setGlowIntensity(float gi)
 	{
 		if(gi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %f;\n", gi);
+		writeFloat(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void setSpecularGlow(float spg)
 	{
 		if(spg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spg\" %f;\n", spg);
+		writeFloat(mFile,"\tsetAttr \".spg\" ",spg,";\n");
 	}
 	void setShadowAttenuation(float fakc)
 	{
 		if(fakc == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".fakc\" %f;\n", fakc);
+		writeFloat(mFile,"\tsetAttr \".fakc\" ",fakc,";\n");
 	}
 	void setEccentricity(float ec)
 	{
 		if(ec == 0.03) return;
-		fprintf(mFile,"\tsetAttr \".ec\" %f;\n", ec);
+		writeFloat(mFile,"\tsetAttr \".ec\" ",ec,";\n");
 	}
 	void setSpecularity(float spl)
 	{
 		if(spl == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".spl\" %f;\n", spl);
+		writeFloat(mFile,"\tsetAttr \".spl\" ",spl,";\n");
 	}
 	void setReflectionLimit(short fll)
 	{
 		if(fll == 1) return;
-		fprintf(mFile,"\tsetAttr \".fll\" %i;\n", fll);
+		writeInt(mFile,"\tsetAttr \".fll\" ",fll,";\n");
 	}
 	void setSpecularColor(const float3& sc)
 	{
-		fprintf(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColorR(float sr)
 	{
 		if(sr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sc.sr\" ",sr,";\n");
 	}
 	void setSpecularColorG(float sg)
 	{
 		if(sg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.sg\" %f;\n", sg);
+		writeFloat(mFile,"\tsetAttr \".sc.sg\" ",sg,";\n");
 	}
 	void setSpecularColorB(float sb)
 	{
 		if(sb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.sb\" %f;\n", sb);
+		writeFloat(mFile,"\tsetAttr \".sc.sb\" ",sb,";\n");
 	}
 	void setReflectivity(float rfl)
 	{
 		if(rfl == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".rfl\" %f;\n", rfl);
+		writeFloat(mFile,"\tsetAttr \".rfl\" ",rfl,";\n");
 	}
 	void setEnvironment(size_t env_i,const Environment& env)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i]\" ",env_i);
+		writeInt(mFile,"\tsetAttr \".env[",env_i,"]\" ");
 		env.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment(size_t env_start,size_t env_end,Environment* env)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i:%i]\" ", env_start,env_end);
+		writeInt(mFile,"\tsetAttr \".env[",env_start); writeInt(mFile,":",env_end,"]\" ");
 		size_t size = (env_end-env_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			env[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEnvironment(size_t env_start,size_t env_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i:%i]\"",env_start,env_end);
-		fprintf(mFile," -type \"Environment\" ");
+		writeInt(mFile,"\tsetAttr \".env[",env_start); writeInt(mFile,":",env_end,"]\"");
+		writeString(mFile," -type \"Environment\" ");
 	}
 	void appendEnvironment(const Environment& env)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		env.write(mFile);
 	}
 	void endEnvironment()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment_Position(size_t env_i,float envp)
 	{
 		if(envp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envp\" %f;\n", env_i,envp);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envp\" ",envp,";\n");
 	}
 	void setEnvironment_Color(size_t env_i,const float3& envc)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i].envc\" -type \"float3\" ",env_i);
+		writeInt(mFile,"\tsetAttr \".env[",env_i,"].envc\" -type \"float3\" ");
 		envc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment_ColorR(size_t env_i,float envcr)
 	{
 		if(envcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcr\" %f;\n", env_i,envcr);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcr\" ",envcr,";\n");
 	}
 	void setEnvironment_ColorG(size_t env_i,float envcg)
 	{
 		if(envcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcg\" %f;\n", env_i,envcg);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcg\" ",envcg,";\n");
 	}
 	void setEnvironment_ColorB(size_t env_i,float envcb)
 	{
 		if(envcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcb\" %f;\n", env_i,envcb);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcb\" ",envcb,";\n");
 	}
 	void setEnvironment_Interp(size_t env_i,unsigned int envi)
 	{
 		if(envi == 0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envi\" %i;\n", env_i,envi);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeInt(mFile,"].envi\" ",envi,";\n");
 	}
 	void setReflectedColor(const float3& rc)
 	{
-		fprintf(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
 		rc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReflectedColorR(float rr)
 	{
 		if(rr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rr\" %f;\n", rr);
+		writeFloat(mFile,"\tsetAttr \".rc.rr\" ",rr,";\n");
 	}
 	void setReflectedColorG(float rg)
 	{
 		if(rg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rg\" %f;\n", rg);
+		writeFloat(mFile,"\tsetAttr \".rc.rg\" ",rg,";\n");
 	}
 	void setReflectedColorB(float rb)
 	{
 		if(rb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rb\" %f;\n", rb);
+		writeFloat(mFile,"\tsetAttr \".rc.rb\" ",rb,";\n");
 	}
 	void setReflectionSpecularity(float rsp)
 	{
 		if(rsp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rsp\" %f;\n", rsp);
+		writeFloat(mFile,"\tsetAttr \".rsp\" ",rsp,";\n");
 	}
 	void setMatteOpacityMode(unsigned int mom)
 	{
 		if(mom == 2) return;
-		fprintf(mFile,"\tsetAttr \".mom\" %i;\n", mom);
+		writeInt(mFile,"\tsetAttr \".mom\" ",mom,";\n");
 	}
 	void setMatteOpacity(float mog)
 	{
 		if(mog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mog\" %f;\n", mog);
+		writeFloat(mFile,"\tsetAttr \".mog\" ",mog,";\n");
 	}
 	void setTime(double ti)
 	{
 		if(ti == 0) return;
-		fprintf(mFile,"\tsetAttr \".ti\" %f;\n", ti);
+		writeFloat(mFile,"\tsetAttr \".ti\" ",ti,";\n");
 	}
 	void setScale(float scl)
 	{
 		if(scl == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".scl\" %f;\n", scl);
+		writeFloat(mFile,"\tsetAttr \".scl\" ",scl,";\n");
 	}
 	void setWindUV(const float2& wi)
 	{
 		if(wi == float2(1.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".wi\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".wi\" -type \"float2\" ");
 		wi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWindU(float wiu)
 	{
 		if(wiu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wi.wiu\" %f;\n", wiu);
+		writeFloat(mFile,"\tsetAttr \".wi.wiu\" ",wiu,";\n");
 	}
 	void setWindV(float wiv)
 	{
 		if(wiv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wi.wiv\" %f;\n", wiv);
+		writeFloat(mFile,"\tsetAttr \".wi.wiv\" ",wiv,";\n");
 	}
 	void setObserverSpeed(float os)
 	{
 		if(os == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".os\" %f;\n", os);
+		writeFloat(mFile,"\tsetAttr \".os\" ",os,";\n");
 	}
 	void setWaveDirSpread(float wd)
 	{
 		if(wd == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".wd\" %f;\n", wd);
+		writeFloat(mFile,"\tsetAttr \".wd\" ",wd,";\n");
 	}
 	void setNumFrequencies(float nf)
 	{
 		if(nf == 3.0) return;
-		fprintf(mFile,"\tsetAttr \".nf\" %f;\n", nf);
+		writeFloat(mFile,"\tsetAttr \".nf\" ",nf,";\n");
 	}
 	void setWaveLengthMin(float wlm)
 	{
 		if(wlm == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".wlm\" %f;\n", wlm);
+		writeFloat(mFile,"\tsetAttr \".wlm\" ",wlm,";\n");
 	}
 	void setWaveLengthMax(float wlx)
 	{
 		if(wlx == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".wlx\" %f;\n", wlx);
+		writeFloat(mFile,"\tsetAttr \".wlx\" ",wlx,";\n");
 	}
 	void setWaveHeight(size_t wh_i,const WaveHeight& wh)
 	{
-		fprintf(mFile,"\tsetAttr \".wh[%i]\" ",wh_i);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_i,"]\" ");
 		wh.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaveHeight(size_t wh_start,size_t wh_end,WaveHeight* wh)
 	{
-		fprintf(mFile,"\tsetAttr \".wh[%i:%i]\" ", wh_start,wh_end);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_start); writeInt(mFile,":",wh_end,"]\" ");
 		size_t size = (wh_end-wh_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wh[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWaveHeight(size_t wh_start,size_t wh_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wh[%i:%i]\"",wh_start,wh_end);
-		fprintf(mFile," -type \"WaveHeight\" ");
+		writeInt(mFile,"\tsetAttr \".wh[",wh_start); writeInt(mFile,":",wh_end,"]\"");
+		writeString(mFile," -type \"WaveHeight\" ");
 	}
 	void appendWaveHeight(const WaveHeight& wh)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wh.write(mFile);
 	}
 	void endWaveHeight()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaveHeight_Position(size_t wh_i,float whp)
 	{
 		if(whp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wh[%i].whp\" %f;\n", wh_i,whp);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_i); writeFloat(mFile,"].whp\" ",whp,";\n");
 	}
 	void setWaveHeight_FloatValue(size_t wh_i,float whfv)
 	{
 		if(whfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wh[%i].whfv\" %f;\n", wh_i,whfv);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_i); writeFloat(mFile,"].whfv\" ",whfv,";\n");
 	}
 	void setWaveHeight_Interp(size_t wh_i,unsigned int whi)
 	{
 		if(whi == 0) return;
-		fprintf(mFile,"\tsetAttr \".wh[%i].whi\" %i;\n", wh_i,whi);
+		writeInt(mFile,"\tsetAttr \".wh[",wh_i); writeInt(mFile,"].whi\" ",whi,";\n");
 	}
 	void setWaveTurbulence(size_t wtb_i,const WaveTurbulence& wtb)
 	{
-		fprintf(mFile,"\tsetAttr \".wtb[%i]\" ",wtb_i);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_i,"]\" ");
 		wtb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaveTurbulence(size_t wtb_start,size_t wtb_end,WaveTurbulence* wtb)
 	{
-		fprintf(mFile,"\tsetAttr \".wtb[%i:%i]\" ", wtb_start,wtb_end);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_start); writeInt(mFile,":",wtb_end,"]\" ");
 		size_t size = (wtb_end-wtb_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wtb[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWaveTurbulence(size_t wtb_start,size_t wtb_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wtb[%i:%i]\"",wtb_start,wtb_end);
-		fprintf(mFile," -type \"WaveTurbulence\" ");
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_start); writeInt(mFile,":",wtb_end,"]\"");
+		writeString(mFile," -type \"WaveTurbulence\" ");
 	}
 	void appendWaveTurbulence(const WaveTurbulence& wtb)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wtb.write(mFile);
 	}
 	void endWaveTurbulence()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWaveTurbulence_Position(size_t wtb_i,float wtbp)
 	{
 		if(wtbp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wtb[%i].wtbp\" %f;\n", wtb_i,wtbp);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_i); writeFloat(mFile,"].wtbp\" ",wtbp,";\n");
 	}
 	void setWaveTurbulence_FloatValue(size_t wtb_i,float wtbfv)
 	{
 		if(wtbfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wtb[%i].wtbfv\" %f;\n", wtb_i,wtbfv);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_i); writeFloat(mFile,"].wtbfv\" ",wtbfv,";\n");
 	}
 	void setWaveTurbulence_Interp(size_t wtb_i,unsigned int wtbi)
 	{
 		if(wtbi == 0) return;
-		fprintf(mFile,"\tsetAttr \".wtb[%i].wtbi\" %i;\n", wtb_i,wtbi);
+		writeInt(mFile,"\tsetAttr \".wtb[",wtb_i); writeInt(mFile,"].wtbi\" ",wtbi,";\n");
 	}
 	void setWavePeaking(size_t wp_i,const WavePeaking& wp)
 	{
-		fprintf(mFile,"\tsetAttr \".wp[%i]\" ",wp_i);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_i,"]\" ");
 		wp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWavePeaking(size_t wp_start,size_t wp_end,WavePeaking* wp)
 	{
-		fprintf(mFile,"\tsetAttr \".wp[%i:%i]\" ", wp_start,wp_end);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_start); writeInt(mFile,":",wp_end,"]\" ");
 		size_t size = (wp_end-wp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wp[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWavePeaking(size_t wp_start,size_t wp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wp[%i:%i]\"",wp_start,wp_end);
-		fprintf(mFile," -type \"WavePeaking\" ");
+		writeInt(mFile,"\tsetAttr \".wp[",wp_start); writeInt(mFile,":",wp_end,"]\"");
+		writeString(mFile," -type \"WavePeaking\" ");
 	}
 	void appendWavePeaking(const WavePeaking& wp)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wp.write(mFile);
 	}
 	void endWavePeaking()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWavePeaking_Position(size_t wp_i,float wpp)
 	{
 		if(wpp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wp[%i].wpp\" %f;\n", wp_i,wpp);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_i); writeFloat(mFile,"].wpp\" ",wpp,";\n");
 	}
 	void setWavePeaking_FloatValue(size_t wp_i,float wpfv)
 	{
 		if(wpfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wp[%i].wpfv\" %f;\n", wp_i,wpfv);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_i); writeFloat(mFile,"].wpfv\" ",wpfv,";\n");
 	}
 	void setWavePeaking_Interp(size_t wp_i,unsigned int wpi)
 	{
 		if(wpi == 0) return;
-		fprintf(mFile,"\tsetAttr \".wp[%i].wpi\" %i;\n", wp_i,wpi);
+		writeInt(mFile,"\tsetAttr \".wp[",wp_i); writeInt(mFile,"].wpi\" ",wpi,";\n");
 	}
 	void setWaveHeightOffset(float who)
 	{
 		if(who == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".who\" %f;\n", who);
+		writeFloat(mFile,"\tsetAttr \".who\" ",who,";\n");
 	}
 	void setTroughShadowing(float tsh)
 	{
 		if(tsh == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".tsh\" %f;\n", tsh);
+		writeFloat(mFile,"\tsetAttr \".tsh\" ",tsh,";\n");
 	}
 	void setFoamColor(const float3& fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFoamColorR(float fcr)
 	{
 		if(fcr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fc.fcr\" ",fcr,";\n");
 	}
 	void setFoamColorG(float fcg)
 	{
 		if(fcg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcg\" %f;\n", fcg);
+		writeFloat(mFile,"\tsetAttr \".fc.fcg\" ",fcg,";\n");
 	}
 	void setFoamColorB(float fcb)
 	{
 		if(fcb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcb\" %f;\n", fcb);
+		writeFloat(mFile,"\tsetAttr \".fc.fcb\" ",fcb,";\n");
 	}
 	void setFoamEmission(float fme)
 	{
 		if(fme == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fme\" %f;\n", fme);
+		writeFloat(mFile,"\tsetAttr \".fme\" ",fme,";\n");
 	}
 	void setFoamThreshold(float fmt)
 	{
 		if(fmt == 0.51) return;
-		fprintf(mFile,"\tsetAttr \".fmt\" %f;\n", fmt);
+		writeFloat(mFile,"\tsetAttr \".fmt\" ",fmt,";\n");
 	}
 	void setFoamOffset(float fmo)
 	{
 		if(fmo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fmo\" %f;\n", fmo);
+		writeFloat(mFile,"\tsetAttr \".fmo\" ",fmo,";\n");
 	}
 	void setDisplacement(float d)
 	{
 		if(d == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setBumpBlur(float bbl)
 	{
 		if(bbl == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".bbl\" %f;\n", bbl);
+		writeFloat(mFile,"\tsetAttr \".bbl\" ",bbl,";\n");
 	}
 	void setHorizonFilter(float hft)
 	{
 		if(hft == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hft\" %f;\n", hft);
+		writeFloat(mFile,"\tsetAttr \".hft\" ",hft,";\n");
 	}
 	void setWaveSpeed(float wvs)
 	{
 		if(wvs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wvs\" %f;\n", wvs);
+		writeFloat(mFile,"\tsetAttr \".wvs\" ",wvs,";\n");
 	}
 	void setMiRefractionBlur(float mirfb)
 	{
 		if(mirfb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mirfb\" %f;\n", mirfb);
+		writeFloat(mFile,"\tsetAttr \".mirfb\" ",mirfb,";\n");
 	}
 	void setMiRefractionRays(short mirfr)
 	{
 		if(mirfr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mirfr\" %i;\n", mirfr);
+		writeInt(mFile,"\tsetAttr \".mirfr\" ",mirfr,";\n");
 	}
 	void setMiReflectionBlur(float mircb)
 	{
 		if(mircb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mircb\" %f;\n", mircb);
+		writeFloat(mFile,"\tsetAttr \".mircb\" ",mircb,";\n");
 	}
 	void setMiReflectionRays(short mircr)
 	{
 		if(mircr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mircr\" %i;\n", mircr);
+		writeInt(mFile,"\tsetAttr \".mircr\" ",mircr,";\n");
 	}
 	void setMiIrradiance(const float3& mii)
 	{
-		fprintf(mFile,"\tsetAttr \".mii\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mii\" -type \"float3\" ");
 		mii.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiIrradianceR(float miir)
 	{
 		if(miir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miir\" %f;\n", miir);
+		writeFloat(mFile,"\tsetAttr \".mii.miir\" ",miir,";\n");
 	}
 	void setMiIrradianceG(float miig)
 	{
 		if(miig == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miig\" %f;\n", miig);
+		writeFloat(mFile,"\tsetAttr \".mii.miig\" ",miig,";\n");
 	}
 	void setMiIrradianceB(float miib)
 	{
 		if(miib == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miib\" %f;\n", miib);
+		writeFloat(mFile,"\tsetAttr \".mii.miib\" ",miib,";\n");
 	}
 	void setMiIrradianceColor(const float3& miic)
 	{
-		fprintf(mFile,"\tsetAttr \".miic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".miic\" -type \"float3\" ");
 		miic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiIrradianceColorR(float miicr)
 	{
 		if(miicr == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicr\" %f;\n", miicr);
+		writeFloat(mFile,"\tsetAttr \".miic.miicr\" ",miicr,";\n");
 	}
 	void setMiIrradianceColorG(float miicg)
 	{
 		if(miicg == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicg\" %f;\n", miicg);
+		writeFloat(mFile,"\tsetAttr \".miic.miicg\" ",miicg,";\n");
 	}
 	void setMiIrradianceColorB(float miicb)
 	{
 		if(miicb == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicb\" %f;\n", miicb);
+		writeFloat(mFile,"\tsetAttr \".miic.miicb\" ",miicb,";\n");
 	}
 	void setMiDeriveFromMaya(bool mifm)
 	{
 		if(mifm == true) return;
-		fprintf(mFile,"\tsetAttr \".mifm\" %i;\n", mifm);
+		writeInt(mFile,"\tsetAttr \".mifm\" ",mifm,";\n");
 	}
 	void setMiShinyness(float mis)
 	{
 		if(mis == 10) return;
-		fprintf(mFile,"\tsetAttr \".mis\" %f;\n", mis);
+		writeFloat(mFile,"\tsetAttr \".mis\" ",mis,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void setMiRefractiveIndex(float miri)
 	{
 		if(miri == 1) return;
-		fprintf(mFile,"\tsetAttr \".miri\" %f;\n", miri);
+		writeFloat(mFile,"\tsetAttr \".miri\" ",miri,";\n");
 	}
 	void setMiRefractions(bool mirc)
 	{
 		if(mirc == true) return;
-		fprintf(mFile,"\tsetAttr \".mirc\" %i;\n", mirc);
+		writeInt(mFile,"\tsetAttr \".mirc\" ",mirc,";\n");
 	}
 	void setMiAbsorbs(bool miab)
 	{
 		if(miab == true) return;
-		fprintf(mFile,"\tsetAttr \".miab\" %i;\n", miab);
+		writeInt(mFile,"\tsetAttr \".miab\" ",miab,";\n");
 	}
 	void setMiDiffuse(float midc)
 	{
 		if(midc == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".midc\" %f;\n", midc);
+		writeFloat(mFile,"\tsetAttr \".midc\" ",midc,";\n");
 	}
 	void setMiColor(const float3& mic)
 	{
-		fprintf(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
 		mic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiColorR(float micr)
 	{
 		if(micr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micr\" %f;\n", micr);
+		writeFloat(mFile,"\tsetAttr \".mic.micr\" ",micr,";\n");
 	}
 	void setMiColorG(float micg)
 	{
 		if(micg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micg\" %f;\n", micg);
+		writeFloat(mFile,"\tsetAttr \".mic.micg\" ",micg,";\n");
 	}
 	void setMiColorB(float micb)
 	{
 		if(micb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micb\" %f;\n", micb);
+		writeFloat(mFile,"\tsetAttr \".mic.micb\" ",micb,";\n");
 	}
 	void setMiTransparency(const float3& mit)
 	{
-		fprintf(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
 		mit.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiTransparencyR(float mitr)
 	{
 		if(mitr == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitr\" %f;\n", mitr);
+		writeFloat(mFile,"\tsetAttr \".mit.mitr\" ",mitr,";\n");
 	}
 	void setMiTransparencyG(float mitg)
 	{
 		if(mitg == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitg\" %f;\n", mitg);
+		writeFloat(mFile,"\tsetAttr \".mit.mitg\" ",mitg,";\n");
 	}
 	void setMiTransparencyB(float mitb)
 	{
 		if(mitb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitb\" %f;\n", mitb);
+		writeFloat(mFile,"\tsetAttr \".mit.mitb\" ",mitb,";\n");
 	}
 	void setMiTranslucence(float mitc)
 	{
 		if(mitc == 0) return;
-		fprintf(mFile,"\tsetAttr \".mitc\" %f;\n", mitc);
+		writeFloat(mFile,"\tsetAttr \".mitc\" ",mitc,";\n");
 	}
 	void setMiTranslucenceFocus(float mitf)
 	{
 		if(mitf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mitf\" %f;\n", mitf);
+		writeFloat(mFile,"\tsetAttr \".mitf\" ",mitf,";\n");
 	}
 	void setMiNormalCamera(const float3& minc)
 	{
-		fprintf(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
 		minc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiNormalCameraX(float mincx)
 	{
 		if(mincx == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincx\" %f;\n", mincx);
+		writeFloat(mFile,"\tsetAttr \".minc.mincx\" ",mincx,";\n");
 	}
 	void setMiNormalCameraY(float mincy)
 	{
 		if(mincy == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincy\" %f;\n", mincy);
+		writeFloat(mFile,"\tsetAttr \".minc.mincy\" ",mincy,";\n");
 	}
 	void setMiNormalCameraZ(float mincz)
 	{
 		if(mincz == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincz\" %f;\n", mincz);
+		writeFloat(mFile,"\tsetAttr \".minc.mincz\" ",mincz,";\n");
 	}
 	void getObjectId()const
 	{
-		fprintf(mFile,"\"%s.oi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi\"");
 	}
 	void getPrimitiveId()const
 	{
-		fprintf(mFile,"\"%s.pi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi\"");
 	}
 	void getRaySampler()const
 	{
-		fprintf(mFile,"\"%s.rtr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtr\"");
 	}
 	void getRayDepth()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 	void getRayInstance()const
 	{
-		fprintf(mFile,"\"%s.ryi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ryi\"");
 	}
 	void getRefractionLimit()const
 	{
-		fprintf(mFile,"\"%s.rdl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdl\"");
 	}
 	void getRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.rfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfi\"");
 	}
 	void getMediumRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.mrfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrfi\"");
 	}
 	void getRefractions()const
 	{
-		fprintf(mFile,"\"%s.rfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfc\"");
 	}
 	void getDiffuse()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getRayDirection()const
 	{
-		fprintf(mFile,"\"%s.rad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad\"");
 	}
 	void getRayDirectionX()const
 	{
-		fprintf(mFile,"\"%s.rad.rdx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdx\"");
 	}
 	void getRayDirectionY()const
 	{
-		fprintf(mFile,"\"%s.rad.rdy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdy\"");
 	}
 	void getRayDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.rad.rdz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdz\"");
 	}
 	void getWaterColor()const
 	{
-		fprintf(mFile,"\"%s.wc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wc\"");
 	}
 	void getWaterColorR()const
 	{
-		fprintf(mFile,"\"%s.wc.wcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wc.wcr\"");
 	}
 	void getWaterColorG()const
 	{
-		fprintf(mFile,"\"%s.wc.wcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wc.wcg\"");
 	}
 	void getWaterColorB()const
 	{
-		fprintf(mFile,"\"%s.wc.wcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wc.wcb\"");
 	}
 	void getTransparency()const
 	{
-		fprintf(mFile,"\"%s.it\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it\"");
 	}
 	void getTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.it.itr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itr\"");
 	}
 	void getTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.it.itg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itg\"");
 	}
 	void getTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.it.itb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itb\"");
 	}
 	void getAmbientColor()const
 	{
-		fprintf(mFile,"\"%s.ambc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc\"");
 	}
 	void getAmbientColorR()const
 	{
-		fprintf(mFile,"\"%s.ambc.acr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acr\"");
 	}
 	void getAmbientColorG()const
 	{
-		fprintf(mFile,"\"%s.ambc.acg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acg\"");
 	}
 	void getAmbientColorB()const
 	{
-		fprintf(mFile,"\"%s.ambc.acb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acb\"");
 	}
 	void getIncandescence()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getIncandescenceR()const
 	{
-		fprintf(mFile,"\"%s.ic.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ir\"");
 	}
 	void getIncandescenceG()const
 	{
-		fprintf(mFile,"\"%s.ic.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ig\"");
 	}
 	void getIncandescenceB()const
 	{
-		fprintf(mFile,"\"%s.ic.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ib\"");
 	}
 	void getTranslucence()const
 	{
-		fprintf(mFile,"\"%s.tc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc\"");
 	}
 	void getTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.tcf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcf\"");
 	}
 	void getTranslucenceDepth()const
 	{
-		fprintf(mFile,"\"%s.trsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trsd\"");
 	}
 	void getOpacityDepth()const
 	{
-		fprintf(mFile,"\"%s.opad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opad\"");
 	}
 	void getGlowIntensity()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 	void getSpecularGlow()const
 	{
-		fprintf(mFile,"\"%s.spg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spg\"");
 	}
 	void getShadowAttenuation()const
 	{
-		fprintf(mFile,"\"%s.fakc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fakc\"");
 	}
 	void getEccentricity()const
 	{
-		fprintf(mFile,"\"%s.ec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ec\"");
 	}
 	void getSpecularity()const
 	{
-		fprintf(mFile,"\"%s.spl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spl\"");
 	}
 	void getReflectionLimit()const
 	{
-		fprintf(mFile,"\"%s.fll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fll\"");
 	}
 	void getSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.sc.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sr\"");
 	}
 	void getSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.sc.sg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sg\"");
 	}
 	void getSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.sc.sb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sb\"");
 	}
 	void getReflectivity()const
 	{
-		fprintf(mFile,"\"%s.rfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfl\"");
 	}
 	void getEnvironment(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i]\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"]\"");
 	}
 	void getEnvironment()const
 	{
 
-		fprintf(mFile,"\"%s.env\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env\"");
 	}
 	void getEnvironment_Position(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envp\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envp\"");
 	}
 	void getEnvironment_Position()const
 	{
 
-		fprintf(mFile,"\"%s.env.envp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envp\"");
 	}
 	void getEnvironment_Color(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc\"");
 	}
 	void getEnvironment_Color()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc\"");
 	}
 	void getEnvironment_ColorR(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcr\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcr\"");
 	}
 	void getEnvironment_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcr\"");
 	}
 	void getEnvironment_ColorG(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcg\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcg\"");
 	}
 	void getEnvironment_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcg\"");
 	}
 	void getEnvironment_ColorB(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcb\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcb\"");
 	}
 	void getEnvironment_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcb\"");
 	}
 	void getEnvironment_Interp(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envi\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envi\"");
 	}
 	void getEnvironment_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.env.envi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envi\"");
 	}
 	void getReflectedColor()const
 	{
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getReflectedColorR()const
 	{
-		fprintf(mFile,"\"%s.rc.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rr\"");
 	}
 	void getReflectedColorG()const
 	{
-		fprintf(mFile,"\"%s.rc.rg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rg\"");
 	}
 	void getReflectedColorB()const
 	{
-		fprintf(mFile,"\"%s.rc.rb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rb\"");
 	}
 	void getTriangleNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.tnc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc\"");
 	}
 	void getTriangleNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.tnc.tnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tnx\"");
 	}
 	void getTriangleNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.tnc.tny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tny\"");
 	}
 	void getTriangleNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.tnc.tnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tnz\"");
 	}
 	void getReflectionSpecularity()const
 	{
-		fprintf(mFile,"\"%s.rsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsp\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogb\"");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.pc.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.pc.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.pc.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pz\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getFilterSize()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.fs.fsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsx\"");
 	}
 	void getFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.fs.fsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsy\"");
 	}
 	void getFilterSizeZ()const
 	{
-		fprintf(mFile,"\"%s.fs.fsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsz\"");
 	}
 	void getMatrixWorldToEye()const
 	{
-		fprintf(mFile,"\"%s.wte\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wte\"");
 	}
 	void getMatrixEyeToWorld()const
 	{
-		fprintf(mFile,"\"%s.e2w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2w\"");
 	}
 	void getLightDataArray(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i]\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"]\"");
 	}
 	void getLightDataArray()const
 	{
 
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld\"");
 	}
 	void getLightDirection()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldx\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldx\"");
 	}
 	void getLightDirectionX()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldy\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldy\"");
 	}
 	void getLightDirectionY()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldz\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldz\"");
 	}
 	void getLightDirectionZ()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li\"");
 	}
 	void getLightIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lir\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lir\"");
 	}
 	void getLightIntensityR()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lig\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lig\"");
 	}
 	void getLightIntensityG()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lib\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lib\"");
 	}
 	void getLightIntensityB()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].la\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].la\"");
 	}
 	void getLightAmbient()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ldf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ldf\"");
 	}
 	void getLightDiffuse()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ls\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ls\"");
 	}
 	void getLightSpecular()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lsf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lsf\"");
 	}
 	void getLightShadowFraction()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].psi\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].psi\"");
 	}
 	void getPreShadowIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lbd\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lbd\"");
 	}
 	void getLightBlindData()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbd\"");
 	}
 	void getMatteOpacityMode()const
 	{
-		fprintf(mFile,"\"%s.mom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mom\"");
 	}
 	void getMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.mog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mog\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.ti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ti\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.scl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scl\"");
 	}
 	void getWindUV()const
 	{
-		fprintf(mFile,"\"%s.wi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi\"");
 	}
 	void getWindU()const
 	{
-		fprintf(mFile,"\"%s.wi.wiu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi.wiu\"");
 	}
 	void getWindV()const
 	{
-		fprintf(mFile,"\"%s.wi.wiv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi.wiv\"");
 	}
 	void getObserverSpeed()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getWaveDirSpread()const
 	{
-		fprintf(mFile,"\"%s.wd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wd\"");
 	}
 	void getNumFrequencies()const
 	{
-		fprintf(mFile,"\"%s.nf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nf\"");
 	}
 	void getWaveLengthMin()const
 	{
-		fprintf(mFile,"\"%s.wlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wlm\"");
 	}
 	void getWaveLengthMax()const
 	{
-		fprintf(mFile,"\"%s.wlx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wlx\"");
 	}
 	void getWaveHeight(size_t wh_i)const
 	{
-		fprintf(mFile,"\"%s.wh[%i]\"",mName.c_str(),wh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wh[",wh_i,"]\"");
 	}
 	void getWaveHeight()const
 	{
 
-		fprintf(mFile,"\"%s.wh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wh\"");
 	}
 	void getWaveHeight_Position(size_t wh_i)const
 	{
-		fprintf(mFile,"\"%s.wh[%i].whp\"",mName.c_str(),wh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wh[",wh_i,"].whp\"");
 	}
 	void getWaveHeight_Position()const
 	{
 
-		fprintf(mFile,"\"%s.wh.whp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wh.whp\"");
 	}
 	void getWaveHeight_FloatValue(size_t wh_i)const
 	{
-		fprintf(mFile,"\"%s.wh[%i].whfv\"",mName.c_str(),wh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wh[",wh_i,"].whfv\"");
 	}
 	void getWaveHeight_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.wh.whfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wh.whfv\"");
 	}
 	void getWaveHeight_Interp(size_t wh_i)const
 	{
-		fprintf(mFile,"\"%s.wh[%i].whi\"",mName.c_str(),wh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wh[",wh_i,"].whi\"");
 	}
 	void getWaveHeight_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.wh.whi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wh.whi\"");
 	}
 	void getWaveTurbulence(size_t wtb_i)const
 	{
-		fprintf(mFile,"\"%s.wtb[%i]\"",mName.c_str(),wtb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wtb[",wtb_i,"]\"");
 	}
 	void getWaveTurbulence()const
 	{
 
-		fprintf(mFile,"\"%s.wtb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtb\"");
 	}
 	void getWaveTurbulence_Position(size_t wtb_i)const
 	{
-		fprintf(mFile,"\"%s.wtb[%i].wtbp\"",mName.c_str(),wtb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wtb[",wtb_i,"].wtbp\"");
 	}
 	void getWaveTurbulence_Position()const
 	{
 
-		fprintf(mFile,"\"%s.wtb.wtbp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtb.wtbp\"");
 	}
 	void getWaveTurbulence_FloatValue(size_t wtb_i)const
 	{
-		fprintf(mFile,"\"%s.wtb[%i].wtbfv\"",mName.c_str(),wtb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wtb[",wtb_i,"].wtbfv\"");
 	}
 	void getWaveTurbulence_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.wtb.wtbfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtb.wtbfv\"");
 	}
 	void getWaveTurbulence_Interp(size_t wtb_i)const
 	{
-		fprintf(mFile,"\"%s.wtb[%i].wtbi\"",mName.c_str(),wtb_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wtb[",wtb_i,"].wtbi\"");
 	}
 	void getWaveTurbulence_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.wtb.wtbi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtb.wtbi\"");
 	}
 	void getWavePeaking(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i]\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"]\"");
 	}
 	void getWavePeaking()const
 	{
 
-		fprintf(mFile,"\"%s.wp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp\"");
 	}
 	void getWavePeaking_Position(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpp\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpp\"");
 	}
 	void getWavePeaking_Position()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpp\"");
 	}
 	void getWavePeaking_FloatValue(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpfv\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpfv\"");
 	}
 	void getWavePeaking_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpfv\"");
 	}
 	void getWavePeaking_Interp(size_t wp_i)const
 	{
-		fprintf(mFile,"\"%s.wp[%i].wpi\"",mName.c_str(),wp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wp[",wp_i,"].wpi\"");
 	}
 	void getWavePeaking_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.wp.wpi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wp.wpi\"");
 	}
 	void getWaveHeightOffset()const
 	{
-		fprintf(mFile,"\"%s.who\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".who\"");
 	}
 	void getTroughShadowing()const
 	{
-		fprintf(mFile,"\"%s.tsh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tsh\"");
 	}
 	void getFoamColor()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFoamColorR()const
 	{
-		fprintf(mFile,"\"%s.fc.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcr\"");
 	}
 	void getFoamColorG()const
 	{
-		fprintf(mFile,"\"%s.fc.fcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcg\"");
 	}
 	void getFoamColorB()const
 	{
-		fprintf(mFile,"\"%s.fc.fcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcb\"");
 	}
 	void getFoamEmission()const
 	{
-		fprintf(mFile,"\"%s.fme\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fme\"");
 	}
 	void getFoamThreshold()const
 	{
-		fprintf(mFile,"\"%s.fmt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fmt\"");
 	}
 	void getFoamOffset()const
 	{
-		fprintf(mFile,"\"%s.fmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fmo\"");
 	}
 	void getOutFoam()const
 	{
-		fprintf(mFile,"\"%s.ofm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofm\"");
 	}
 	void getDisplacement()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getBumpBlur()const
 	{
-		fprintf(mFile,"\"%s.bbl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bbl\"");
 	}
 	void getHorizonFilter()const
 	{
-		fprintf(mFile,"\"%s.hft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hft\"");
 	}
 	void getWaveSpeed()const
 	{
-		fprintf(mFile,"\"%s.wvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wvs\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getMiRefractionBlur()const
 	{
-		fprintf(mFile,"\"%s.mirfb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirfb\"");
 	}
 	void getMiRefractionRays()const
 	{
-		fprintf(mFile,"\"%s.mirfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirfr\"");
 	}
 	void getMiReflectionBlur()const
 	{
-		fprintf(mFile,"\"%s.mircb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircb\"");
 	}
 	void getMiReflectionRays()const
 	{
-		fprintf(mFile,"\"%s.mircr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircr\"");
 	}
 	void getMiIrradiance()const
 	{
-		fprintf(mFile,"\"%s.mii\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii\"");
 	}
 	void getMiIrradianceR()const
 	{
-		fprintf(mFile,"\"%s.mii.miir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miir\"");
 	}
 	void getMiIrradianceG()const
 	{
-		fprintf(mFile,"\"%s.mii.miig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miig\"");
 	}
 	void getMiIrradianceB()const
 	{
-		fprintf(mFile,"\"%s.mii.miib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miib\"");
 	}
 	void getMiIrradianceColor()const
 	{
-		fprintf(mFile,"\"%s.miic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic\"");
 	}
 	void getMiIrradianceColorR()const
 	{
-		fprintf(mFile,"\"%s.miic.miicr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicr\"");
 	}
 	void getMiIrradianceColorG()const
 	{
-		fprintf(mFile,"\"%s.miic.miicg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicg\"");
 	}
 	void getMiIrradianceColorB()const
 	{
-		fprintf(mFile,"\"%s.miic.miicb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicb\"");
 	}
 	void getMiDeriveFromMaya()const
 	{
-		fprintf(mFile,"\"%s.mifm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifm\"");
 	}
 	void getMiShinyness()const
 	{
-		fprintf(mFile,"\"%s.mis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mis\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 	void getMiRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.miri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miri\"");
 	}
 	void getMiRefractions()const
 	{
-		fprintf(mFile,"\"%s.mirc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirc\"");
 	}
 	void getMiAbsorbs()const
 	{
-		fprintf(mFile,"\"%s.miab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miab\"");
 	}
 	void getMiDiffuse()const
 	{
-		fprintf(mFile,"\"%s.midc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".midc\"");
 	}
 	void getMiColor()const
 	{
-		fprintf(mFile,"\"%s.mic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic\"");
 	}
 	void getMiColorR()const
 	{
-		fprintf(mFile,"\"%s.mic.micr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micr\"");
 	}
 	void getMiColorG()const
 	{
-		fprintf(mFile,"\"%s.mic.micg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micg\"");
 	}
 	void getMiColorB()const
 	{
-		fprintf(mFile,"\"%s.mic.micb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micb\"");
 	}
 	void getMiTransparency()const
 	{
-		fprintf(mFile,"\"%s.mit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit\"");
 	}
 	void getMiTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.mit.mitr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitr\"");
 	}
 	void getMiTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.mit.mitg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitg\"");
 	}
 	void getMiTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.mit.mitb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitb\"");
 	}
 	void getMiTranslucence()const
 	{
-		fprintf(mFile,"\"%s.mitc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitc\"");
 	}
 	void getMiTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.mitf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitf\"");
 	}
 	void getMiNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.minc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc\"");
 	}
 	void getMiNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.minc.mincx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincx\"");
 	}
 	void getMiNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.minc.mincy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincy\"");
 	}
 	void getMiNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincz\"");
 	}
 protected:
 	OceanShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
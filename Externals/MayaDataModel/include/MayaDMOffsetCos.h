@@ -27,78 +27,78 @@ public:
 	void setCutLoop(bool cl)
 	{
 		if(cl == false) return;
-		fprintf(mFile,"\tsetAttr \".cl\" %i;\n", cl);
+		writeInt(mFile,"\tsetAttr \".cl\" ",cl,";\n");
 	}
 	void setConnectBreaks(unsigned int cb)
 	{
 		if(cb == 2) return;
-		fprintf(mFile,"\tsetAttr \".cb\" %i;\n", cb);
+		writeInt(mFile,"\tsetAttr \".cb\" ",cb,";\n");
 	}
 	void setDistance(double d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setSubdivisionDensity(int sd)
 	{
 		if(sd == 5) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %i;\n", sd);
+		writeInt(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void setCheckPoints(short cp)
 	{
 		if(cp == 3) return;
-		fprintf(mFile,"\tsetAttr \".cp\" %i;\n", cp);
+		writeInt(mFile,"\tsetAttr \".cp\" ",cp,";\n");
 	}
 	void setStitch(bool st)
 	{
 		if(st == true) return;
-		fprintf(mFile,"\tsetAttr \".st\" %i;\n", st);
+		writeInt(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getCutLoop()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getConnectBreaks()const
 	{
-		fprintf(mFile,"\"%s.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb\"");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getSubdivisionDensity()const
 	{
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getCheckPoints()const
 	{
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getStitch()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getOutputCurve(size_t oc_i)const
 	{
-		fprintf(mFile,"\"%s.oc[%i]\"",mName.c_str(),oc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oc[",oc_i,"]\"");
 	}
 	void getOutputCurve()const
 	{
 
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	OffsetCos(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
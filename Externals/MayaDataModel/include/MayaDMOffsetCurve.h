@@ -27,151 +27,151 @@ public:
 	void setConnectBreaks(unsigned int cb)
 	{
 		if(cb == 2) return;
-		fprintf(mFile,"\tsetAttr \".cb\" %i;\n", cb);
+		writeInt(mFile,"\tsetAttr \".cb\" ",cb,";\n");
 	}
 	void setReparameterize(bool rp)
 	{
 		if(rp == false) return;
-		fprintf(mFile,"\tsetAttr \".rp\" %i;\n", rp);
+		writeInt(mFile,"\tsetAttr \".rp\" ",rp,";\n");
 	}
 	void setStitch(bool st)
 	{
 		if(st == true) return;
-		fprintf(mFile,"\tsetAttr \".st\" %i;\n", st);
+		writeInt(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void setCutLoop(bool cl)
 	{
 		if(cl == false) return;
-		fprintf(mFile,"\tsetAttr \".cl\" %i;\n", cl);
+		writeInt(mFile,"\tsetAttr \".cl\" ",cl,";\n");
 	}
 	void setCutRadius(double cr)
 	{
 		if(cr == 0) return;
-		fprintf(mFile,"\tsetAttr \".cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".cr\" ",cr,";\n");
 	}
 	void setDistance(double d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setSubdivisionDensity(int sd)
 	{
 		if(sd == 5) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %i;\n", sd);
+		writeInt(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void setUseGivenNormal(bool ugn)
 	{
 		if(ugn == 1) return;
-		fprintf(mFile,"\tsetAttr \".ugn\" %i;\n", ugn);
+		writeInt(mFile,"\tsetAttr \".ugn\" ",ugn,";\n");
 	}
 	void setNormal(const double3& nr)
 	{
-		fprintf(mFile,"\tsetAttr \".nr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".nr\" -type \"double3\" ");
 		nr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNormalX(double nrx)
 	{
 		if(nrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".nr.nrx\" %f;\n", nrx);
+		writeFloat(mFile,"\tsetAttr \".nr.nrx\" ",nrx,";\n");
 	}
 	void setNormalY(double nry)
 	{
 		if(nry == 1) return;
-		fprintf(mFile,"\tsetAttr \".nr.nry\" %f;\n", nry);
+		writeFloat(mFile,"\tsetAttr \".nr.nry\" ",nry,";\n");
 	}
 	void setNormalZ(double nrz)
 	{
 		if(nrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".nr.nrz\" %f;\n", nrz);
+		writeFloat(mFile,"\tsetAttr \".nr.nrz\" ",nrz,";\n");
 	}
 	void setParameter(double p)
 	{
 		if(p == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p\" %f;\n", p);
+		writeFloat(mFile,"\tsetAttr \".p\" ",p,";\n");
 	}
 	void setUseParameter(bool up)
 	{
 		if(up == false) return;
-		fprintf(mFile,"\tsetAttr \".up\" %i;\n", up);
+		writeInt(mFile,"\tsetAttr \".up\" ",up,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getConnectBreaks()const
 	{
-		fprintf(mFile,"\"%s.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb\"");
 	}
 	void getReparameterize()const
 	{
-		fprintf(mFile,"\"%s.rp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp\"");
 	}
 	void getStitch()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getCutLoop()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getCutRadius()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getSubdivisionDensity()const
 	{
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getUseGivenNormal()const
 	{
-		fprintf(mFile,"\"%s.ugn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ugn\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.nr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.nr.nrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nrx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.nr.nry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nry\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.nr.nrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nr.nrz\"");
 	}
 	void getParameter()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getUseParameter()const
 	{
-		fprintf(mFile,"\"%s.up\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".up\"");
 	}
 	void getOutputCurve(size_t oc_i)const
 	{
-		fprintf(mFile,"\"%s.oc[%i]\"",mName.c_str(),oc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oc[",oc_i,"]\"");
 	}
 	void getOutputCurve()const
 	{
 
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 protected:
 	OffsetCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
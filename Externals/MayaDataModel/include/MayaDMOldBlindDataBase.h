@@ -27,11 +27,11 @@ public:
 	void setTypeId(int tid)
 	{
 		if(tid == 0) return;
-		fprintf(mFile,"\tsetAttr \".tid\" %i;\n", tid);
+		writeInt(mFile,"\tsetAttr \".tid\" ",tid,";\n");
 	}
 	void getTypeId()const
 	{
-		fprintf(mFile,"\"%s.tid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tid\"");
 	}
 protected:
 	OldBlindDataBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,596 +27,596 @@ public:
 	void setActive(bool act)
 	{
 		if(act == true) return;
-		fprintf(mFile,"\tsetAttr \".act\" %i;\n", act);
+		writeInt(mFile,"\tsetAttr \".act\" ",act,";\n");
 	}
 	void setGlowType(unsigned int gt)
 	{
 		if(gt == 1) return;
-		fprintf(mFile,"\tsetAttr \".gt\" %i;\n", gt);
+		writeInt(mFile,"\tsetAttr \".gt\" ",gt,";\n");
 	}
 	void setHaloType(unsigned int ht)
 	{
 		if(ht == 0) return;
-		fprintf(mFile,"\tsetAttr \".ht\" %i;\n", ht);
+		writeInt(mFile,"\tsetAttr \".ht\" ",ht,";\n");
 	}
 	void setFogType(short ft)
 	{
 		if(ft == 0) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %i;\n", ft);
+		writeInt(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setLensFlare(bool lf)
 	{
 		if(lf == false) return;
-		fprintf(mFile,"\tsetAttr \".lf\" %i;\n", lf);
+		writeInt(mFile,"\tsetAttr \".lf\" ",lf,";\n");
 	}
 	void setGlowColor(const float3& gc)
 	{
 		if(gc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
 		gc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlowColorR(float gr)
 	{
 		if(gr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gr\" %f;\n", gr);
+		writeFloat(mFile,"\tsetAttr \".gc.gr\" ",gr,";\n");
 	}
 	void setGlowColorG(float gg)
 	{
 		if(gg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gg\" %f;\n", gg);
+		writeFloat(mFile,"\tsetAttr \".gc.gg\" ",gg,";\n");
 	}
 	void setGlowColorB(float gb)
 	{
 		if(gb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gb\" %f;\n", gb);
+		writeFloat(mFile,"\tsetAttr \".gc.gb\" ",gb,";\n");
 	}
 	void setHaloColor(const float3& hc)
 	{
 		if(hc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
 		hc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHaloColorR(float hr)
 	{
 		if(hr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hr\" %f;\n", hr);
+		writeFloat(mFile,"\tsetAttr \".hc.hr\" ",hr,";\n");
 	}
 	void setHaloColorG(float hg)
 	{
 		if(hg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hg\" %f;\n", hg);
+		writeFloat(mFile,"\tsetAttr \".hc.hg\" ",hg,";\n");
 	}
 	void setHaloColorB(float hb)
 	{
 		if(hb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".hc.hb\" ",hb,";\n");
 	}
 	void setFogColor(const float3& fc)
 	{
 		if(fc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFogColorR(float fr)
 	{
 		if(fr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fc.fr\" ",fr,";\n");
 	}
 	void setFogColorG(float fg)
 	{
 		if(fg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fg\" %f;\n", fg);
+		writeFloat(mFile,"\tsetAttr \".fc.fg\" ",fg,";\n");
 	}
 	void setFogColorB(float fb)
 	{
 		if(fb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fb\" %f;\n", fb);
+		writeFloat(mFile,"\tsetAttr \".fc.fb\" ",fb,";\n");
 	}
 	void setFlareColor(const float3& rc)
 	{
 		if(rc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
 		rc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFlareColorR(float rr)
 	{
 		if(rr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rr\" %f;\n", rr);
+		writeFloat(mFile,"\tsetAttr \".rc.rr\" ",rr,";\n");
 	}
 	void setFlareColorG(float rg)
 	{
 		if(rg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rg\" %f;\n", rg);
+		writeFloat(mFile,"\tsetAttr \".rc.rg\" ",rg,";\n");
 	}
 	void setFlareColorB(float rb)
 	{
 		if(rb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rb\" %f;\n", rb);
+		writeFloat(mFile,"\tsetAttr \".rc.rb\" ",rb,";\n");
 	}
 	void setFlareIntensity(float fi)
 	{
 		if(fi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fi\" %f;\n", fi);
+		writeFloat(mFile,"\tsetAttr \".fi\" ",fi,";\n");
 	}
 	void setFlareNumCircles(float fn)
 	{
 		if(fn == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".fn\" %f;\n", fn);
+		writeFloat(mFile,"\tsetAttr \".fn\" ",fn,";\n");
 	}
 	void setFlareMinSize(float fm)
 	{
 		if(fm == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".fm\" %f;\n", fm);
+		writeFloat(mFile,"\tsetAttr \".fm\" ",fm,";\n");
 	}
 	void setFlareMaxSize(float fa)
 	{
 		if(fa == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fa\" %f;\n", fa);
+		writeFloat(mFile,"\tsetAttr \".fa\" ",fa,";\n");
 	}
 	void setFlareColSpread(float lc)
 	{
 		if(lc == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".lc\" %f;\n", lc);
+		writeFloat(mFile,"\tsetAttr \".lc\" ",lc,";\n");
 	}
 	void setFlareFocus(float ff)
 	{
 		if(ff == 0.6) return;
-		fprintf(mFile,"\tsetAttr \".ff\" %f;\n", ff);
+		writeFloat(mFile,"\tsetAttr \".ff\" ",ff,";\n");
 	}
 	void setFlareVertical(float fv)
 	{
 		if(fv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fv\" %f;\n", fv);
+		writeFloat(mFile,"\tsetAttr \".fv\" ",fv,";\n");
 	}
 	void setFlareHorizontal(float fh)
 	{
 		if(fh == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fh\" %f;\n", fh);
+		writeFloat(mFile,"\tsetAttr \".fh\" ",fh,";\n");
 	}
 	void setFlareLength(float fl)
 	{
 		if(fl == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fl\" %f;\n", fl);
+		writeFloat(mFile,"\tsetAttr \".fl\" ",fl,";\n");
 	}
 	void setHexagonFlare(bool hf)
 	{
 		if(hf == false) return;
-		fprintf(mFile,"\tsetAttr \".hf\" %i;\n", hf);
+		writeInt(mFile,"\tsetAttr \".hf\" ",hf,";\n");
 	}
 	void setGlowIntensity(float gi)
 	{
 		if(gi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %f;\n", gi);
+		writeFloat(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void setHaloIntensity(float hi)
 	{
 		if(hi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hi\" %f;\n", hi);
+		writeFloat(mFile,"\tsetAttr \".hi\" ",hi,";\n");
 	}
 	void setFogIntensity(float oi)
 	{
 		if(oi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".oi\" %f;\n", oi);
+		writeFloat(mFile,"\tsetAttr \".oi\" ",oi,";\n");
 	}
 	void setGlowSpread(float gs)
 	{
 		if(gs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gs\" %f;\n", gs);
+		writeFloat(mFile,"\tsetAttr \".gs\" ",gs,";\n");
 	}
 	void setHaloSpread(float hs)
 	{
 		if(hs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hs\" %f;\n", hs);
+		writeFloat(mFile,"\tsetAttr \".hs\" ",hs,";\n");
 	}
 	void setFogSpread(float fs)
 	{
 		if(fs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fs\" %f;\n", fs);
+		writeFloat(mFile,"\tsetAttr \".fs\" ",fs,";\n");
 	}
 	void setGlowNoise(float gd)
 	{
 		if(gd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gd\" %f;\n", gd);
+		writeFloat(mFile,"\tsetAttr \".gd\" ",gd,";\n");
 	}
 	void setFogNoise(float fd)
 	{
 		if(fd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fd\" %f;\n", fd);
+		writeFloat(mFile,"\tsetAttr \".fd\" ",fd,";\n");
 	}
 	void setGlowRadialNoise(float gn)
 	{
 		if(gn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gn\" %f;\n", gn);
+		writeFloat(mFile,"\tsetAttr \".gn\" ",gn,";\n");
 	}
 	void setFogRadialNoise(float fz)
 	{
 		if(fz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fz\" %f;\n", fz);
+		writeFloat(mFile,"\tsetAttr \".fz\" ",fz,";\n");
 	}
 	void setGlowStarLevel(float gv)
 	{
 		if(gv == 3.0) return;
-		fprintf(mFile,"\tsetAttr \".gv\" %f;\n", gv);
+		writeFloat(mFile,"\tsetAttr \".gv\" ",gv,";\n");
 	}
 	void setFogStarlevel(float fe)
 	{
 		if(fe == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fe\" %f;\n", fe);
+		writeFloat(mFile,"\tsetAttr \".fe\" ",fe,";\n");
 	}
 	void setGlowOpacity(float go)
 	{
 		if(go == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".go\" %f;\n", go);
+		writeFloat(mFile,"\tsetAttr \".go\" ",go,";\n");
 	}
 	void setFogOpacity(float fo)
 	{
 		if(fo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fo\" %f;\n", fo);
+		writeFloat(mFile,"\tsetAttr \".fo\" ",fo,";\n");
 	}
 	void setRadialFrequency(float rf)
 	{
 		if(rf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".rf\" %f;\n", rf);
+		writeFloat(mFile,"\tsetAttr \".rf\" ",rf,";\n");
 	}
 	void setStarPoints(float sp)
 	{
 		if(sp == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".sp\" %f;\n", sp);
+		writeFloat(mFile,"\tsetAttr \".sp\" ",sp,";\n");
 	}
 	void setRotation(float ra)
 	{
 		if(ra == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setNoiseUscale(float nu)
 	{
 		if(nu == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nu\" %f;\n", nu);
+		writeFloat(mFile,"\tsetAttr \".nu\" ",nu,";\n");
 	}
 	void setNoiseVscale(float nv)
 	{
 		if(nv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nv\" %f;\n", nv);
+		writeFloat(mFile,"\tsetAttr \".nv\" ",nv,";\n");
 	}
 	void setNoiseUoffset(float ni)
 	{
 		if(ni == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ni\" %f;\n", ni);
+		writeFloat(mFile,"\tsetAttr \".ni\" ",ni,";\n");
 	}
 	void setNoiseVoffset(float nf)
 	{
 		if(nf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".nf\" %f;\n", nf);
+		writeFloat(mFile,"\tsetAttr \".nf\" ",nf,";\n");
 	}
 	void setNoiseThreshold(float nt)
 	{
 		if(nt == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".nt\" %f;\n", nt);
+		writeFloat(mFile,"\tsetAttr \".nt\" ",nt,";\n");
 	}
 	void setIgnoreLight(bool il)
 	{
 		if(il == false) return;
-		fprintf(mFile,"\tsetAttr \".il\" %i;\n", il);
+		writeInt(mFile,"\tsetAttr \".il\" ",il,";\n");
 	}
 	void setLightWorldMat(const matrix& lw)
 	{
 		if(lw == identity) return;
-		fprintf(mFile,"\tsetAttr \".lw\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".lw\" -type \"matrix\" ");
 		lw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlowVisibility(float gvb)
 	{
 		if(gvb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gvb\" %f;\n", gvb);
+		writeFloat(mFile,"\tsetAttr \".gvb\" ",gvb,";\n");
 	}
 	void setLightColor(const float3& lr)
 	{
 		if(lr == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".lr\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lr\" -type \"float3\" ");
 		lr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLightColorR(float lcr)
 	{
 		if(lcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lcr\" %f;\n", lcr);
+		writeFloat(mFile,"\tsetAttr \".lr.lcr\" ",lcr,";\n");
 	}
 	void setLightColorG(float lcg)
 	{
 		if(lcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lcg\" %f;\n", lcg);
+		writeFloat(mFile,"\tsetAttr \".lr.lcg\" ",lcg,";\n");
 	}
 	void setLightColorB(float lgb)
 	{
 		if(lgb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lgb\" %f;\n", lgb);
+		writeFloat(mFile,"\tsetAttr \".lr.lgb\" ",lgb,";\n");
 	}
 	void setVisibility(const float3& vb)
 	{
 		if(vb == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".vb\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vb\" -type \"float3\" ");
 		vb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVisibilityR(float vbr)
 	{
 		if(vbr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vb.vbr\" %f;\n", vbr);
+		writeFloat(mFile,"\tsetAttr \".vb.vbr\" ",vbr,";\n");
 	}
 	void setVisibilityG(float vbg)
 	{
 		if(vbg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vb.vbg\" %f;\n", vbg);
+		writeFloat(mFile,"\tsetAttr \".vb.vbg\" ",vbg,";\n");
 	}
 	void setVisibilityB(float vbb)
 	{
 		if(vbb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vb.vbb\" %f;\n", vbb);
+		writeFloat(mFile,"\tsetAttr \".vb.vbb\" ",vbb,";\n");
 	}
 	void getActive()const
 	{
-		fprintf(mFile,"\"%s.act\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".act\"");
 	}
 	void getGlowType()const
 	{
-		fprintf(mFile,"\"%s.gt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gt\"");
 	}
 	void getHaloType()const
 	{
-		fprintf(mFile,"\"%s.ht\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ht\"");
 	}
 	void getFogType()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getLensFlare()const
 	{
-		fprintf(mFile,"\"%s.lf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lf\"");
 	}
 	void getGlowColor()const
 	{
-		fprintf(mFile,"\"%s.gc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc\"");
 	}
 	void getGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.gc.gr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gr\"");
 	}
 	void getGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.gc.gg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gg\"");
 	}
 	void getGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.gc.gb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gb\"");
 	}
 	void getHaloColor()const
 	{
-		fprintf(mFile,"\"%s.hc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc\"");
 	}
 	void getHaloColorR()const
 	{
-		fprintf(mFile,"\"%s.hc.hr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hr\"");
 	}
 	void getHaloColorG()const
 	{
-		fprintf(mFile,"\"%s.hc.hg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hg\"");
 	}
 	void getHaloColorB()const
 	{
-		fprintf(mFile,"\"%s.hc.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hb\"");
 	}
 	void getFogColor()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFogColorR()const
 	{
-		fprintf(mFile,"\"%s.fc.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fr\"");
 	}
 	void getFogColorG()const
 	{
-		fprintf(mFile,"\"%s.fc.fg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fg\"");
 	}
 	void getFogColorB()const
 	{
-		fprintf(mFile,"\"%s.fc.fb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fb\"");
 	}
 	void getFlareColor()const
 	{
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getFlareColorR()const
 	{
-		fprintf(mFile,"\"%s.rc.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rr\"");
 	}
 	void getFlareColorG()const
 	{
-		fprintf(mFile,"\"%s.rc.rg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rg\"");
 	}
 	void getFlareColorB()const
 	{
-		fprintf(mFile,"\"%s.rc.rb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rb\"");
 	}
 	void getFlareIntensity()const
 	{
-		fprintf(mFile,"\"%s.fi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fi\"");
 	}
 	void getFlareNumCircles()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getFlareMinSize()const
 	{
-		fprintf(mFile,"\"%s.fm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fm\"");
 	}
 	void getFlareMaxSize()const
 	{
-		fprintf(mFile,"\"%s.fa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fa\"");
 	}
 	void getFlareColSpread()const
 	{
-		fprintf(mFile,"\"%s.lc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc\"");
 	}
 	void getFlareFocus()const
 	{
-		fprintf(mFile,"\"%s.ff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ff\"");
 	}
 	void getFlareVertical()const
 	{
-		fprintf(mFile,"\"%s.fv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fv\"");
 	}
 	void getFlareHorizontal()const
 	{
-		fprintf(mFile,"\"%s.fh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fh\"");
 	}
 	void getFlareLength()const
 	{
-		fprintf(mFile,"\"%s.fl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fl\"");
 	}
 	void getHexagonFlare()const
 	{
-		fprintf(mFile,"\"%s.hf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hf\"");
 	}
 	void getGlowIntensity()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 	void getHaloIntensity()const
 	{
-		fprintf(mFile,"\"%s.hi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hi\"");
 	}
 	void getFogIntensity()const
 	{
-		fprintf(mFile,"\"%s.oi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi\"");
 	}
 	void getGlowSpread()const
 	{
-		fprintf(mFile,"\"%s.gs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gs\"");
 	}
 	void getHaloSpread()const
 	{
-		fprintf(mFile,"\"%s.hs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hs\"");
 	}
 	void getFogSpread()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getGlowNoise()const
 	{
-		fprintf(mFile,"\"%s.gd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gd\"");
 	}
 	void getFogNoise()const
 	{
-		fprintf(mFile,"\"%s.fd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd\"");
 	}
 	void getGlowRadialNoise()const
 	{
-		fprintf(mFile,"\"%s.gn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gn\"");
 	}
 	void getFogRadialNoise()const
 	{
-		fprintf(mFile,"\"%s.fz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fz\"");
 	}
 	void getGlowStarLevel()const
 	{
-		fprintf(mFile,"\"%s.gv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gv\"");
 	}
 	void getFogStarlevel()const
 	{
-		fprintf(mFile,"\"%s.fe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fe\"");
 	}
 	void getGlowOpacity()const
 	{
-		fprintf(mFile,"\"%s.go\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".go\"");
 	}
 	void getFogOpacity()const
 	{
-		fprintf(mFile,"\"%s.fo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo\"");
 	}
 	void getRadialFrequency()const
 	{
-		fprintf(mFile,"\"%s.rf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rf\"");
 	}
 	void getStarPoints()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getRotation()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getNoiseUscale()const
 	{
-		fprintf(mFile,"\"%s.nu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nu\"");
 	}
 	void getNoiseVscale()const
 	{
-		fprintf(mFile,"\"%s.nv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nv\"");
 	}
 	void getNoiseUoffset()const
 	{
-		fprintf(mFile,"\"%s.ni\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ni\"");
 	}
 	void getNoiseVoffset()const
 	{
-		fprintf(mFile,"\"%s.nf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nf\"");
 	}
 	void getNoiseThreshold()const
 	{
-		fprintf(mFile,"\"%s.nt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nt\"");
 	}
 	void getIgnoreLight()const
 	{
-		fprintf(mFile,"\"%s.il\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".il\"");
 	}
 	void getLightWorldMat()const
 	{
-		fprintf(mFile,"\"%s.lw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lw\"");
 	}
 	void getLightConnection()const
 	{
-		fprintf(mFile,"\"%s.ln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ln\"");
 	}
 	void getGlowVisibility()const
 	{
-		fprintf(mFile,"\"%s.gvb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gvb\"");
 	}
 	void getLightColor()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getLightColorR()const
 	{
-		fprintf(mFile,"\"%s.lr.lcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lcr\"");
 	}
 	void getLightColorG()const
 	{
-		fprintf(mFile,"\"%s.lr.lcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lcg\"");
 	}
 	void getLightColorB()const
 	{
-		fprintf(mFile,"\"%s.lr.lgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lgb\"");
 	}
 	void getVisibility()const
 	{
-		fprintf(mFile,"\"%s.vb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vb\"");
 	}
 	void getVisibilityR()const
 	{
-		fprintf(mFile,"\"%s.vb.vbr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vb.vbr\"");
 	}
 	void getVisibilityG()const
 	{
-		fprintf(mFile,"\"%s.vb.vbg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vb.vbg\"");
 	}
 	void getVisibilityB()const
 	{
-		fprintf(mFile,"\"%s.vb.vbb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vb.vbb\"");
 	}
 protected:
 	OpticalFX(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,13 +27,13 @@ public:
 		void write(FILE* file) const
 		{
 			targetRotate.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", targetRotateOrder);
+			writeString(file," ");
+			writeInt(file,"",targetRotateOrder," ");
 			targetJointOrient.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", targetWeight);
+			writeString(file," ");
+			writeFloat(file,"",targetWeight," ");
 			targetRotateCached.write(file);
 		}
 	};
@@ -46,469 +46,469 @@ public:
 
 	void setTarget(size_t tg_i,const Target& tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i]\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"]\" ");
 		tg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTarget(size_t tg_start,size_t tg_end,Target* tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\" ", tg_start,tg_end);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\" ");
 		size_t size = (tg_end-tg_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			tg[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTarget(size_t tg_start,size_t tg_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\"",tg_start,tg_end);
-		fprintf(mFile," -type \"Target\" ");
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\"");
+		writeString(mFile," -type \"Target\" ");
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		tg.write(mFile);
 	}
 	void endTarget()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotate(size_t tg_i,const double3& tr)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tr\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tr\" -type \"double3\" ");
 		tr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotateX(size_t tg_i,double trx)
 	{
 		if(trx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tr.trx\" %f;\n", tg_i,trx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tr.trx\" ",trx,";\n");
 	}
 	void setTargetRotateY(size_t tg_i,double try_)
 	{
 		if(try_ == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tr.try\" %f;\n", tg_i,try_);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tr.try\" ",try_,";\n");
 	}
 	void setTargetRotateZ(size_t tg_i,double trz)
 	{
 		if(trz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tr.trz\" %f;\n", tg_i,trz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tr.trz\" ",trz,";\n");
 	}
 	void setTargetRotateOrder(size_t tg_i,unsigned int tro)
 	{
 		if(tro == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tro\" %i;\n", tg_i,tro);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeInt(mFile,"].tro\" ",tro,";\n");
 	}
 	void setTargetJointOrient(size_t tg_i,const double3& tjo)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tjo\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tjo\" -type \"double3\" ");
 		tjo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetJointOrientX(size_t tg_i,double tjox)
 	{
 		if(tjox == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tjo.tjox\" %f;\n", tg_i,tjox);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tjo.tjox\" ",tjox,";\n");
 	}
 	void setTargetJointOrientY(size_t tg_i,double tjoy)
 	{
 		if(tjoy == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tjo.tjoy\" %f;\n", tg_i,tjoy);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tjo.tjoy\" ",tjoy,";\n");
 	}
 	void setTargetJointOrientZ(size_t tg_i,double tjoz)
 	{
 		if(tjoz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tjo.tjoz\" %f;\n", tg_i,tjoz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tjo.tjoz\" ",tjoz,";\n");
 	}
 	void setTargetParentMatrix(size_t tg_i,const matrix& tpm)
 	{
 		if(tpm == identity) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tpm\" -type \"matrix\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tpm\" -type \"matrix\" ");
 		tpm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetWeight(size_t tg_i,double tw)
 	{
 		if(tw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tw\" %f;\n", tg_i,tw);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tw\" ",tw,";\n");
 	}
 	void setTargetRotateCached(size_t tg_i,const double3& ctr)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].ctr\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].ctr\" -type \"double3\" ");
 		ctr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotateCachedX(size_t tg_i,double ctrx)
 	{
 		if(ctrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ctr.ctrx\" %f;\n", tg_i,ctrx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ctr.ctrx\" ",ctrx,";\n");
 	}
 	void setTargetRotateCachedY(size_t tg_i,double ctry)
 	{
 		if(ctry == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ctr.ctry\" %f;\n", tg_i,ctry);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ctr.ctry\" ",ctry,";\n");
 	}
 	void setTargetRotateCachedZ(size_t tg_i,double ctrz)
 	{
 		if(ctrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ctr.ctrz\" %f;\n", tg_i,ctrz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ctr.ctrz\" ",ctrz,";\n");
 	}
 	void setLastTargetRotate(const double3& lr)
 	{
-		fprintf(mFile,"\tsetAttr \".lr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".lr\" -type \"double3\" ");
 		lr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLastTargetRotateX(double lrx)
 	{
 		if(lrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lrx\" %f;\n", lrx);
+		writeFloat(mFile,"\tsetAttr \".lr.lrx\" ",lrx,";\n");
 	}
 	void setLastTargetRotateY(double lry)
 	{
 		if(lry == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lry\" %f;\n", lry);
+		writeFloat(mFile,"\tsetAttr \".lr.lry\" ",lry,";\n");
 	}
 	void setLastTargetRotateZ(double lrz)
 	{
 		if(lrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lrz\" %f;\n", lrz);
+		writeFloat(mFile,"\tsetAttr \".lr.lrz\" ",lrz,";\n");
 	}
 	void setConstraintParentInverseMatrix(const matrix& cpim)
 	{
 		if(cpim == identity) return;
-		fprintf(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
 		cpim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotateOrder(unsigned int cro)
 	{
 		if(cro == 0) return;
-		fprintf(mFile,"\tsetAttr \".cro\" %i;\n", cro);
+		writeInt(mFile,"\tsetAttr \".cro\" ",cro,";\n");
 	}
 	void setConstraintJointOrient(const double3& cjo)
 	{
-		fprintf(mFile,"\tsetAttr \".cjo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".cjo\" -type \"double3\" ");
 		cjo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintJointOrientX(double cjox)
 	{
 		if(cjox == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjox\" %f;\n", cjox);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjox\" ",cjox,";\n");
 	}
 	void setConstraintJointOrientY(double cjoy)
 	{
 		if(cjoy == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjoy\" %f;\n", cjoy);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjoy\" ",cjoy,";\n");
 	}
 	void setConstraintJointOrientZ(double cjoz)
 	{
 		if(cjoz == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjoz\" %f;\n", cjoz);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjoz\" ",cjoz,";\n");
 	}
 	void setOffset(const double3& o)
 	{
-		fprintf(mFile,"\tsetAttr \".o\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".o\" -type \"double3\" ");
 		o.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetX(double ox)
 	{
 		if(ox == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.ox\" %f;\n", ox);
+		writeFloat(mFile,"\tsetAttr \".o.ox\" ",ox,";\n");
 	}
 	void setOffsetY(double oy)
 	{
 		if(oy == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.oy\" %f;\n", oy);
+		writeFloat(mFile,"\tsetAttr \".o.oy\" ",oy,";\n");
 	}
 	void setOffsetZ(double oz)
 	{
 		if(oz == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.oz\" %f;\n", oz);
+		writeFloat(mFile,"\tsetAttr \".o.oz\" ",oz,";\n");
 	}
 	void setRestRotate(const double3& rsrr)
 	{
-		fprintf(mFile,"\tsetAttr \".rsrr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rsrr\" -type \"double3\" ");
 		rsrr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRestRotateX(double rrx)
 	{
 		if(rrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rrx\" %f;\n", rrx);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rrx\" ",rrx,";\n");
 	}
 	void setRestRotateY(double rry)
 	{
 		if(rry == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rry\" %f;\n", rry);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rry\" ",rry,";\n");
 	}
 	void setRestRotateZ(double rrz)
 	{
 		if(rrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rrz\" %f;\n", rrz);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rrz\" ",rrz,";\n");
 	}
 	void setInterpType(unsigned int int_)
 	{
 		if(int_ == 1) return;
-		fprintf(mFile,"\tsetAttr \".int\" %i;\n", int_);
+		writeInt(mFile,"\tsetAttr \".int\" ",int_,";\n");
 	}
 	void setInterpCache(int inc)
 	{
 		if(inc == 0) return;
-		fprintf(mFile,"\tsetAttr \".inc\" %i;\n", inc);
+		writeInt(mFile,"\tsetAttr \".inc\" ",inc,";\n");
 	}
 	void setUseOldOffsetCalculation(bool uooc)
 	{
 		if(uooc == false) return;
-		fprintf(mFile,"\tsetAttr \".uooc\" %i;\n", uooc);
+		writeInt(mFile,"\tsetAttr \".uooc\" ",uooc,";\n");
 	}
 	void getTarget(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i]\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"]\"");
 	}
 	void getTarget()const
 	{
 
-		fprintf(mFile,"\"%s.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg\"");
 	}
 	void getTargetRotate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tr\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tr\"");
 	}
 	void getTargetRotate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tr\"");
 	}
 	void getTargetRotateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tr.trx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tr.trx\"");
 	}
 	void getTargetRotateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tr.trx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tr.trx\"");
 	}
 	void getTargetRotateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tr.try\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tr.try\"");
 	}
 	void getTargetRotateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tr.try\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tr.try\"");
 	}
 	void getTargetRotateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tr.trz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tr.trz\"");
 	}
 	void getTargetRotateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tr.trz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tr.trz\"");
 	}
 	void getTargetRotateOrder(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tro\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tro\"");
 	}
 	void getTargetRotateOrder()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tro\"");
 	}
 	void getTargetJointOrient(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tjo\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tjo\"");
 	}
 	void getTargetJointOrient()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tjo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tjo\"");
 	}
 	void getTargetJointOrientX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tjo.tjox\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tjo.tjox\"");
 	}
 	void getTargetJointOrientX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tjo.tjox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tjo.tjox\"");
 	}
 	void getTargetJointOrientY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tjo.tjoy\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tjo.tjoy\"");
 	}
 	void getTargetJointOrientY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tjo.tjoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tjo.tjoy\"");
 	}
 	void getTargetJointOrientZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tjo.tjoz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tjo.tjoz\"");
 	}
 	void getTargetJointOrientZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tjo.tjoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tjo.tjoz\"");
 	}
 	void getTargetParentMatrix(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tpm\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tpm\"");
 	}
 	void getTargetParentMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tpm\"");
 	}
 	void getTargetWeight(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tw\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tw\"");
 	}
 	void getTargetWeight()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tw\"");
 	}
 	void getTargetRotateCached(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ctr\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ctr\"");
 	}
 	void getTargetRotateCached()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ctr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ctr\"");
 	}
 	void getTargetRotateCachedX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ctr.ctrx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ctr.ctrx\"");
 	}
 	void getTargetRotateCachedX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ctr.ctrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ctr.ctrx\"");
 	}
 	void getTargetRotateCachedY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ctr.ctry\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ctr.ctry\"");
 	}
 	void getTargetRotateCachedY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ctr.ctry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ctr.ctry\"");
 	}
 	void getTargetRotateCachedZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ctr.ctrz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ctr.ctrz\"");
 	}
 	void getTargetRotateCachedZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ctr.ctrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ctr.ctrz\"");
 	}
 	void getLastTargetRotate()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getLastTargetRotateX()const
 	{
-		fprintf(mFile,"\"%s.lr.lrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lrx\"");
 	}
 	void getLastTargetRotateY()const
 	{
-		fprintf(mFile,"\"%s.lr.lry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lry\"");
 	}
 	void getLastTargetRotateZ()const
 	{
-		fprintf(mFile,"\"%s.lr.lrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lrz\"");
 	}
 	void getConstraintParentInverseMatrix()const
 	{
-		fprintf(mFile,"\"%s.cpim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpim\"");
 	}
 	void getConstraintRotateOrder()const
 	{
-		fprintf(mFile,"\"%s.cro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cro\"");
 	}
 	void getConstraintJointOrient()const
 	{
-		fprintf(mFile,"\"%s.cjo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo\"");
 	}
 	void getConstraintJointOrientX()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjox\"");
 	}
 	void getConstraintJointOrientY()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjoy\"");
 	}
 	void getConstraintJointOrientZ()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjoz\"");
 	}
 	void getConstraintRotate()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getConstraintRotateX()const
 	{
-		fprintf(mFile,"\"%s.cr.crx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crx\"");
 	}
 	void getConstraintRotateY()const
 	{
-		fprintf(mFile,"\"%s.cr.cry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.cry\"");
 	}
 	void getConstraintRotateZ()const
 	{
-		fprintf(mFile,"\"%s.cr.crz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crz\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOffsetX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOffsetY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 	void getRestRotate()const
 	{
-		fprintf(mFile,"\"%s.rsrr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr\"");
 	}
 	void getRestRotateX()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rrx\"");
 	}
 	void getRestRotateY()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rry\"");
 	}
 	void getRestRotateZ()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rrz\"");
 	}
 	void getInterpType()const
 	{
-		fprintf(mFile,"\"%s.int\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".int\"");
 	}
 	void getInterpCache()const
 	{
-		fprintf(mFile,"\"%s.inc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inc\"");
 	}
 	void getUseOldOffsetCalculation()const
 	{
-		fprintf(mFile,"\"%s.uooc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uooc\"");
 	}
 protected:
 	OrientConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setFrontTwist(double ft)
 	{
 		if(ft == 0) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %f;\n", ft);
+		writeFloat(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setUpTwist(double ut)
 	{
 		if(ut == 0) return;
-		fprintf(mFile,"\tsetAttr \".ut\" %f;\n", ut);
+		writeFloat(mFile,"\tsetAttr \".ut\" ",ut,";\n");
 	}
 	void setSideTwist(double st)
 	{
 		if(st == 0) return;
-		fprintf(mFile,"\tsetAttr \".st\" %f;\n", st);
+		writeFloat(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void getFrontTwist()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getUpTwist()const
 	{
-		fprintf(mFile,"\"%s.ut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ut\"");
 	}
 	void getSideTwist()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 protected:
 	OrientationMarker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
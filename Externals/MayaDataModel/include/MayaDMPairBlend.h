@@ -27,230 +27,230 @@ public:
 	void setCurrentDriver(unsigned int c)
 	{
 		if(c == 0) return;
-		fprintf(mFile,"\tsetAttr \".c\" %i;\n", c);
+		writeInt(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setInTranslate1(const double3& it1)
 	{
-		fprintf(mFile,"\tsetAttr \".it1\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".it1\" -type \"double3\" ");
 		it1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInTranslateX1(double itx1)
 	{
 		if(itx1 == 0) return;
-		fprintf(mFile,"\tsetAttr \".it1.itx1\" %f;\n", itx1);
+		writeFloat(mFile,"\tsetAttr \".it1.itx1\" ",itx1,";\n");
 	}
 	void setInTranslateY1(double ity1)
 	{
 		if(ity1 == 0) return;
-		fprintf(mFile,"\tsetAttr \".it1.ity1\" %f;\n", ity1);
+		writeFloat(mFile,"\tsetAttr \".it1.ity1\" ",ity1,";\n");
 	}
 	void setInTranslateZ1(double itz1)
 	{
 		if(itz1 == 0) return;
-		fprintf(mFile,"\tsetAttr \".it1.itz1\" %f;\n", itz1);
+		writeFloat(mFile,"\tsetAttr \".it1.itz1\" ",itz1,";\n");
 	}
 	void setInRotate1(const double3& ir1)
 	{
-		fprintf(mFile,"\tsetAttr \".ir1\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ir1\" -type \"double3\" ");
 		ir1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInRotateX1(double irx1)
 	{
 		if(irx1 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir1.irx1\" %f;\n", irx1);
+		writeFloat(mFile,"\tsetAttr \".ir1.irx1\" ",irx1,";\n");
 	}
 	void setInRotateY1(double iry1)
 	{
 		if(iry1 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir1.iry1\" %f;\n", iry1);
+		writeFloat(mFile,"\tsetAttr \".ir1.iry1\" ",iry1,";\n");
 	}
 	void setInRotateZ1(double irz1)
 	{
 		if(irz1 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir1.irz1\" %f;\n", irz1);
+		writeFloat(mFile,"\tsetAttr \".ir1.irz1\" ",irz1,";\n");
 	}
 	void setInTranslate2(const double3& it2)
 	{
-		fprintf(mFile,"\tsetAttr \".it2\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".it2\" -type \"double3\" ");
 		it2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInTranslateX2(double itx2)
 	{
 		if(itx2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".it2.itx2\" %f;\n", itx2);
+		writeFloat(mFile,"\tsetAttr \".it2.itx2\" ",itx2,";\n");
 	}
 	void setInTranslateY2(double ity2)
 	{
 		if(ity2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".it2.ity2\" %f;\n", ity2);
+		writeFloat(mFile,"\tsetAttr \".it2.ity2\" ",ity2,";\n");
 	}
 	void setInTranslateZ2(double itz2)
 	{
 		if(itz2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".it2.itz2\" %f;\n", itz2);
+		writeFloat(mFile,"\tsetAttr \".it2.itz2\" ",itz2,";\n");
 	}
 	void setInRotate2(const double3& ir2)
 	{
-		fprintf(mFile,"\tsetAttr \".ir2\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ir2\" -type \"double3\" ");
 		ir2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInRotateX2(double irx2)
 	{
 		if(irx2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir2.irx2\" %f;\n", irx2);
+		writeFloat(mFile,"\tsetAttr \".ir2.irx2\" ",irx2,";\n");
 	}
 	void setInRotateY2(double iry2)
 	{
 		if(iry2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir2.iry2\" %f;\n", iry2);
+		writeFloat(mFile,"\tsetAttr \".ir2.iry2\" ",iry2,";\n");
 	}
 	void setInRotateZ2(double irz2)
 	{
 		if(irz2 == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir2.irz2\" %f;\n", irz2);
+		writeFloat(mFile,"\tsetAttr \".ir2.irz2\" ",irz2,";\n");
 	}
 	void setWeight(double w)
 	{
 		if(w == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setRotateOrder(unsigned int ro)
 	{
 		if(ro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %i;\n", ro);
+		writeInt(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void setTranslateXMode(unsigned int txm)
 	{
 		if(txm == 0) return;
-		fprintf(mFile,"\tsetAttr \".txm\" %i;\n", txm);
+		writeInt(mFile,"\tsetAttr \".txm\" ",txm,";\n");
 	}
 	void setTranslateYMode(unsigned int tym)
 	{
 		if(tym == 0) return;
-		fprintf(mFile,"\tsetAttr \".tym\" %i;\n", tym);
+		writeInt(mFile,"\tsetAttr \".tym\" ",tym,";\n");
 	}
 	void setTranslateZMode(unsigned int tzm)
 	{
 		if(tzm == 0) return;
-		fprintf(mFile,"\tsetAttr \".tzm\" %i;\n", tzm);
+		writeInt(mFile,"\tsetAttr \".tzm\" ",tzm,";\n");
 	}
 	void setRotateMode(unsigned int rm)
 	{
 		if(rm == 0) return;
-		fprintf(mFile,"\tsetAttr \".rm\" %i;\n", rm);
+		writeInt(mFile,"\tsetAttr \".rm\" ",rm,";\n");
 	}
 	void setRotInterpolation(unsigned int ri)
 	{
 		if(ri == 0) return;
-		fprintf(mFile,"\tsetAttr \".ri\" %i;\n", ri);
+		writeInt(mFile,"\tsetAttr \".ri\" ",ri,";\n");
 	}
 	void getInTranslate1()const
 	{
-		fprintf(mFile,"\"%s.it1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it1\"");
 	}
 	void getInTranslateX1()const
 	{
-		fprintf(mFile,"\"%s.it1.itx1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it1.itx1\"");
 	}
 	void getInTranslateY1()const
 	{
-		fprintf(mFile,"\"%s.it1.ity1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it1.ity1\"");
 	}
 	void getInTranslateZ1()const
 	{
-		fprintf(mFile,"\"%s.it1.itz1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it1.itz1\"");
 	}
 	void getInRotate1()const
 	{
-		fprintf(mFile,"\"%s.ir1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir1\"");
 	}
 	void getInRotateX1()const
 	{
-		fprintf(mFile,"\"%s.ir1.irx1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir1.irx1\"");
 	}
 	void getInRotateY1()const
 	{
-		fprintf(mFile,"\"%s.ir1.iry1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir1.iry1\"");
 	}
 	void getInRotateZ1()const
 	{
-		fprintf(mFile,"\"%s.ir1.irz1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir1.irz1\"");
 	}
 	void getInTranslate2()const
 	{
-		fprintf(mFile,"\"%s.it2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it2\"");
 	}
 	void getInTranslateX2()const
 	{
-		fprintf(mFile,"\"%s.it2.itx2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it2.itx2\"");
 	}
 	void getInTranslateY2()const
 	{
-		fprintf(mFile,"\"%s.it2.ity2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it2.ity2\"");
 	}
 	void getInTranslateZ2()const
 	{
-		fprintf(mFile,"\"%s.it2.itz2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it2.itz2\"");
 	}
 	void getInRotate2()const
 	{
-		fprintf(mFile,"\"%s.ir2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir2\"");
 	}
 	void getInRotateX2()const
 	{
-		fprintf(mFile,"\"%s.ir2.irx2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir2.irx2\"");
 	}
 	void getInRotateY2()const
 	{
-		fprintf(mFile,"\"%s.ir2.iry2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir2.iry2\"");
 	}
 	void getInRotateZ2()const
 	{
-		fprintf(mFile,"\"%s.ir2.irz2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir2.irz2\"");
 	}
 	void getWeight()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getRotateOrder()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getOutTranslate()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTranslateX()const
 	{
-		fprintf(mFile,"\"%s.ot.otx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otx\"");
 	}
 	void getOutTranslateY()const
 	{
-		fprintf(mFile,"\"%s.ot.oty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.oty\"");
 	}
 	void getOutTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.ot.otz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otz\"");
 	}
 	void getOutRotate()const
 	{
-		fprintf(mFile,"\"%s.or\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or\"");
 	}
 	void getOutRotateX()const
 	{
-		fprintf(mFile,"\"%s.or.orx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.orx\"");
 	}
 	void getOutRotateY()const
 	{
-		fprintf(mFile,"\"%s.or.ory\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.ory\"");
 	}
 	void getOutRotateZ()const
 	{
-		fprintf(mFile,"\"%s.or.orz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or.orz\"");
 	}
 protected:
 	PairBlend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -33,25 +33,25 @@ public:
 		void write(FILE* file) const
 		{
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", targetWeight);
+			writeString(file," ");
+			writeFloat(file,"",targetWeight," ");
 			targetRotateCached.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetTranslate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetRotatePivot.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetRotateTranslate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetOffsetTranslate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetRotate.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", targetRotateOrder);
+			writeString(file," ");
+			writeInt(file,"",targetRotateOrder," ");
 			targetJointOrient.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetOffsetRotate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetScale.write(file);
 		}
 	};
@@ -64,893 +64,893 @@ public:
 
 	void setTarget(size_t tg_i,const Target& tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i]\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"]\" ");
 		tg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTarget(size_t tg_start,size_t tg_end,Target* tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\" ", tg_start,tg_end);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\" ");
 		size_t size = (tg_end-tg_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			tg[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTarget(size_t tg_start,size_t tg_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\"",tg_start,tg_end);
-		fprintf(mFile," -type \"Target\" ");
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\"");
+		writeString(mFile," -type \"Target\" ");
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		tg.write(mFile);
 	}
 	void endTarget()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetParentMatrix(size_t tg_i,const matrix& tpm)
 	{
 		if(tpm == identity) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tpm\" -type \"matrix\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tpm\" -type \"matrix\" ");
 		tpm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetWeight(size_t tg_i,double tw)
 	{
 		if(tw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tw\" %f;\n", tg_i,tw);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tw\" ",tw,";\n");
 	}
 	void setTargetRotateCached(size_t tg_i,const double3& ctr)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].ctr\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].ctr\" -type \"double3\" ");
 		ctr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotateCachedX(size_t tg_i,double ctrx)
 	{
 		if(ctrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ctr.ctrx\" %f;\n", tg_i,ctrx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ctr.ctrx\" ",ctrx,";\n");
 	}
 	void setTargetRotateCachedY(size_t tg_i,double ctry)
 	{
 		if(ctry == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ctr.ctry\" %f;\n", tg_i,ctry);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ctr.ctry\" ",ctry,";\n");
 	}
 	void setTargetRotateCachedZ(size_t tg_i,double ctrz)
 	{
 		if(ctrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ctr.ctrz\" %f;\n", tg_i,ctrz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ctr.ctrz\" ",ctrz,";\n");
 	}
 	void setTargetTranslate(size_t tg_i,const double3& tt)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tt\" -type \"double3\" ");
 		tt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetTranslateX(size_t tg_i,double ttx)
 	{
 		if(ttx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.ttx\" %f;\n", tg_i,ttx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.ttx\" ",ttx,";\n");
 	}
 	void setTargetTranslateY(size_t tg_i,double tty)
 	{
 		if(tty == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.tty\" %f;\n", tg_i,tty);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.tty\" ",tty,";\n");
 	}
 	void setTargetTranslateZ(size_t tg_i,double ttz)
 	{
 		if(ttz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.ttz\" %f;\n", tg_i,ttz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.ttz\" ",ttz,";\n");
 	}
 	void setTargetRotatePivot(size_t tg_i,const double3& trp)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].trp\" -type \"double3\" ");
 		trp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotatePivotX(size_t tg_i,double trpx)
 	{
 		if(trpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpx\" %f;\n", tg_i,trpx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpx\" ",trpx,";\n");
 	}
 	void setTargetRotatePivotY(size_t tg_i,double trpy)
 	{
 		if(trpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpy\" %f;\n", tg_i,trpy);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpy\" ",trpy,";\n");
 	}
 	void setTargetRotatePivotZ(size_t tg_i,double trpz)
 	{
 		if(trpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpz\" %f;\n", tg_i,trpz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpz\" ",trpz,";\n");
 	}
 	void setTargetRotateTranslate(size_t tg_i,const double3& trt)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].trt\" -type \"double3\" ");
 		trt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotateTranslateX(size_t tg_i,double trtx)
 	{
 		if(trtx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trtx\" %f;\n", tg_i,trtx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trtx\" ",trtx,";\n");
 	}
 	void setTargetRotateTranslateY(size_t tg_i,double trty)
 	{
 		if(trty == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trty\" %f;\n", tg_i,trty);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trty\" ",trty,";\n");
 	}
 	void setTargetRotateTranslateZ(size_t tg_i,double trtz)
 	{
 		if(trtz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trtz\" %f;\n", tg_i,trtz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trtz\" ",trtz,";\n");
 	}
 	void setTargetOffsetTranslate(size_t tg_i,const double3& tot)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tot\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tot\" -type \"double3\" ");
 		tot.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetOffsetTranslateX(size_t tg_i,double totx)
 	{
 		if(totx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tot.totx\" %f;\n", tg_i,totx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tot.totx\" ",totx,";\n");
 	}
 	void setTargetOffsetTranslateY(size_t tg_i,double toty)
 	{
 		if(toty == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tot.toty\" %f;\n", tg_i,toty);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tot.toty\" ",toty,";\n");
 	}
 	void setTargetOffsetTranslateZ(size_t tg_i,double totz)
 	{
 		if(totz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tot.totz\" %f;\n", tg_i,totz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tot.totz\" ",totz,";\n");
 	}
 	void setTargetRotate(size_t tg_i,const double3& tr)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tr\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tr\" -type \"double3\" ");
 		tr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotateX(size_t tg_i,double trx)
 	{
 		if(trx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tr.trx\" %f;\n", tg_i,trx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tr.trx\" ",trx,";\n");
 	}
 	void setTargetRotateY(size_t tg_i,double try_)
 	{
 		if(try_ == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tr.try\" %f;\n", tg_i,try_);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tr.try\" ",try_,";\n");
 	}
 	void setTargetRotateZ(size_t tg_i,double trz)
 	{
 		if(trz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tr.trz\" %f;\n", tg_i,trz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tr.trz\" ",trz,";\n");
 	}
 	void setTargetRotateOrder(size_t tg_i,unsigned int tro)
 	{
 		if(tro == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tro\" %i;\n", tg_i,tro);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeInt(mFile,"].tro\" ",tro,";\n");
 	}
 	void setTargetJointOrient(size_t tg_i,const double3& tjo)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tjo\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tjo\" -type \"double3\" ");
 		tjo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetJointOrientX(size_t tg_i,double tjox)
 	{
 		if(tjox == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tjo.tjox\" %f;\n", tg_i,tjox);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tjo.tjox\" ",tjox,";\n");
 	}
 	void setTargetJointOrientY(size_t tg_i,double tjoy)
 	{
 		if(tjoy == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tjo.tjoy\" %f;\n", tg_i,tjoy);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tjo.tjoy\" ",tjoy,";\n");
 	}
 	void setTargetJointOrientZ(size_t tg_i,double tjoz)
 	{
 		if(tjoz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tjo.tjoz\" %f;\n", tg_i,tjoz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tjo.tjoz\" ",tjoz,";\n");
 	}
 	void setTargetOffsetRotate(size_t tg_i,const double3& tor)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tor\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tor\" -type \"double3\" ");
 		tor.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetOffsetRotateX(size_t tg_i,double torx)
 	{
 		if(torx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tor.torx\" %f;\n", tg_i,torx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tor.torx\" ",torx,";\n");
 	}
 	void setTargetOffsetRotateY(size_t tg_i,double tory)
 	{
 		if(tory == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tor.tory\" %f;\n", tg_i,tory);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tor.tory\" ",tory,";\n");
 	}
 	void setTargetOffsetRotateZ(size_t tg_i,double torz)
 	{
 		if(torz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tor.torz\" %f;\n", tg_i,torz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tor.torz\" ",torz,";\n");
 	}
 	void setTargetScale(size_t tg_i,const double3& ts)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].ts\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].ts\" -type \"double3\" ");
 		ts.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetScaleX(size_t tg_i,double tsx)
 	{
 		if(tsx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ts.tsx\" %f;\n", tg_i,tsx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ts.tsx\" ",tsx,";\n");
 	}
 	void setTargetScaleY(size_t tg_i,double tsy)
 	{
 		if(tsy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ts.tsy\" %f;\n", tg_i,tsy);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ts.tsy\" ",tsy,";\n");
 	}
 	void setTargetScaleZ(size_t tg_i,double tsz)
 	{
 		if(tsz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ts.tsz\" %f;\n", tg_i,tsz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ts.tsz\" ",tsz,";\n");
 	}
 	void setConstraintParentInverseMatrix(const matrix& cpim)
 	{
 		if(cpim == identity) return;
-		fprintf(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
 		cpim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLastTargetRotate(const double3& lr)
 	{
-		fprintf(mFile,"\tsetAttr \".lr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".lr\" -type \"double3\" ");
 		lr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLastTargetRotateX(double lrx)
 	{
 		if(lrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lrx\" %f;\n", lrx);
+		writeFloat(mFile,"\tsetAttr \".lr.lrx\" ",lrx,";\n");
 	}
 	void setLastTargetRotateY(double lry)
 	{
 		if(lry == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lry\" %f;\n", lry);
+		writeFloat(mFile,"\tsetAttr \".lr.lry\" ",lry,";\n");
 	}
 	void setLastTargetRotateZ(double lrz)
 	{
 		if(lrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lrz\" %f;\n", lrz);
+		writeFloat(mFile,"\tsetAttr \".lr.lrz\" ",lrz,";\n");
 	}
 	void setConstraintRotatePivot(const double3& crp)
 	{
-		fprintf(mFile,"\tsetAttr \".crp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".crp\" -type \"double3\" ");
 		crp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotatePivotX(double crpx)
 	{
 		if(crpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpx\" %f;\n", crpx);
+		writeFloat(mFile,"\tsetAttr \".crp.crpx\" ",crpx,";\n");
 	}
 	void setConstraintRotatePivotY(double crpy)
 	{
 		if(crpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpy\" %f;\n", crpy);
+		writeFloat(mFile,"\tsetAttr \".crp.crpy\" ",crpy,";\n");
 	}
 	void setConstraintRotatePivotZ(double crpz)
 	{
 		if(crpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpz\" %f;\n", crpz);
+		writeFloat(mFile,"\tsetAttr \".crp.crpz\" ",crpz,";\n");
 	}
 	void setConstraintRotateTranslate(const double3& crt)
 	{
-		fprintf(mFile,"\tsetAttr \".crt\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".crt\" -type \"double3\" ");
 		crt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotateTranslateX(double crtx)
 	{
 		if(crtx == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crtx\" %f;\n", crtx);
+		writeFloat(mFile,"\tsetAttr \".crt.crtx\" ",crtx,";\n");
 	}
 	void setConstraintRotateTranslateY(double crty)
 	{
 		if(crty == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crty\" %f;\n", crty);
+		writeFloat(mFile,"\tsetAttr \".crt.crty\" ",crty,";\n");
 	}
 	void setConstraintRotateTranslateZ(double crtz)
 	{
 		if(crtz == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crtz\" %f;\n", crtz);
+		writeFloat(mFile,"\tsetAttr \".crt.crtz\" ",crtz,";\n");
 	}
 	void setRestTranslate(const double3& rst)
 	{
 		if(rst == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".rst\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rst\" -type \"double3\" ");
 		rst.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRestTranslateX(double rtx)
 	{
 		if(rtx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst.rtx\" %f;\n", rtx);
+		writeFloat(mFile,"\tsetAttr \".rst.rtx\" ",rtx,";\n");
 	}
 	void setRestTranslateY(double rty)
 	{
 		if(rty == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst.rty\" %f;\n", rty);
+		writeFloat(mFile,"\tsetAttr \".rst.rty\" ",rty,";\n");
 	}
 	void setRestTranslateZ(double rtz)
 	{
 		if(rtz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst.rtz\" %f;\n", rtz);
+		writeFloat(mFile,"\tsetAttr \".rst.rtz\" ",rtz,";\n");
 	}
 	void setConstraintRotateOrder(unsigned int cro)
 	{
 		if(cro == 0) return;
-		fprintf(mFile,"\tsetAttr \".cro\" %i;\n", cro);
+		writeInt(mFile,"\tsetAttr \".cro\" ",cro,";\n");
 	}
 	void setConstraintJointOrient(const double3& cjo)
 	{
-		fprintf(mFile,"\tsetAttr \".cjo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".cjo\" -type \"double3\" ");
 		cjo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintJointOrientX(double cjox)
 	{
 		if(cjox == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjox\" %f;\n", cjox);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjox\" ",cjox,";\n");
 	}
 	void setConstraintJointOrientY(double cjoy)
 	{
 		if(cjoy == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjoy\" %f;\n", cjoy);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjoy\" ",cjoy,";\n");
 	}
 	void setConstraintJointOrientZ(double cjoz)
 	{
 		if(cjoz == 0) return;
-		fprintf(mFile,"\tsetAttr \".cjo.cjoz\" %f;\n", cjoz);
+		writeFloat(mFile,"\tsetAttr \".cjo.cjoz\" ",cjoz,";\n");
 	}
 	void setRestRotate(const double3& rsrr)
 	{
-		fprintf(mFile,"\tsetAttr \".rsrr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rsrr\" -type \"double3\" ");
 		rsrr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRestRotateX(double rrx)
 	{
 		if(rrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rrx\" %f;\n", rrx);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rrx\" ",rrx,";\n");
 	}
 	void setRestRotateY(double rry)
 	{
 		if(rry == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rry\" %f;\n", rry);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rry\" ",rry,";\n");
 	}
 	void setRestRotateZ(double rrz)
 	{
 		if(rrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rsrr.rrz\" %f;\n", rrz);
+		writeFloat(mFile,"\tsetAttr \".rsrr.rrz\" ",rrz,";\n");
 	}
 	void setInterpType(unsigned int int_)
 	{
 		if(int_ == 1) return;
-		fprintf(mFile,"\tsetAttr \".int\" %i;\n", int_);
+		writeInt(mFile,"\tsetAttr \".int\" ",int_,";\n");
 	}
 	void setInterpCache(int inc)
 	{
 		if(inc == 0) return;
-		fprintf(mFile,"\tsetAttr \".inc\" %i;\n", inc);
+		writeInt(mFile,"\tsetAttr \".inc\" ",inc,";\n");
 	}
 	void getTarget(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i]\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"]\"");
 	}
 	void getTarget()const
 	{
 
-		fprintf(mFile,"\"%s.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg\"");
 	}
 	void getTargetParentMatrix(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tpm\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tpm\"");
 	}
 	void getTargetParentMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tpm\"");
 	}
 	void getTargetWeight(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tw\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tw\"");
 	}
 	void getTargetWeight()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tw\"");
 	}
 	void getTargetRotateCached(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ctr\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ctr\"");
 	}
 	void getTargetRotateCached()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ctr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ctr\"");
 	}
 	void getTargetRotateCachedX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ctr.ctrx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ctr.ctrx\"");
 	}
 	void getTargetRotateCachedX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ctr.ctrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ctr.ctrx\"");
 	}
 	void getTargetRotateCachedY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ctr.ctry\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ctr.ctry\"");
 	}
 	void getTargetRotateCachedY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ctr.ctry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ctr.ctry\"");
 	}
 	void getTargetRotateCachedZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ctr.ctrz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ctr.ctrz\"");
 	}
 	void getTargetRotateCachedZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ctr.ctrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ctr.ctrz\"");
 	}
 	void getTargetTranslate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt\"");
 	}
 	void getTargetTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt\"");
 	}
 	void getTargetTranslateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.ttx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.ttx\"");
 	}
 	void getTargetTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.ttx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.ttx\"");
 	}
 	void getTargetTranslateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.tty\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.tty\"");
 	}
 	void getTargetTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.tty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.tty\"");
 	}
 	void getTargetTranslateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.ttz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.ttz\"");
 	}
 	void getTargetTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.ttz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.ttz\"");
 	}
 	void getTargetRotatePivot(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp\"");
 	}
 	void getTargetRotatePivot()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp\"");
 	}
 	void getTargetRotatePivotX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpx\"");
 	}
 	void getTargetRotatePivotX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpx\"");
 	}
 	void getTargetRotatePivotY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpy\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpy\"");
 	}
 	void getTargetRotatePivotY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpy\"");
 	}
 	void getTargetRotatePivotZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpz\"");
 	}
 	void getTargetRotatePivotZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpz\"");
 	}
 	void getTargetRotateTranslate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt\"");
 	}
 	void getTargetRotateTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt\"");
 	}
 	void getTargetRotateTranslateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trtx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trtx\"");
 	}
 	void getTargetRotateTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trtx\"");
 	}
 	void getTargetRotateTranslateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trty\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trty\"");
 	}
 	void getTargetRotateTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trty\"");
 	}
 	void getTargetRotateTranslateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trtz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trtz\"");
 	}
 	void getTargetRotateTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trtz\"");
 	}
 	void getTargetOffsetTranslate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tot\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tot\"");
 	}
 	void getTargetOffsetTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tot\"");
 	}
 	void getTargetOffsetTranslateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tot.totx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tot.totx\"");
 	}
 	void getTargetOffsetTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tot.totx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tot.totx\"");
 	}
 	void getTargetOffsetTranslateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tot.toty\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tot.toty\"");
 	}
 	void getTargetOffsetTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tot.toty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tot.toty\"");
 	}
 	void getTargetOffsetTranslateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tot.totz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tot.totz\"");
 	}
 	void getTargetOffsetTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tot.totz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tot.totz\"");
 	}
 	void getTargetRotate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tr\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tr\"");
 	}
 	void getTargetRotate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tr\"");
 	}
 	void getTargetRotateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tr.trx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tr.trx\"");
 	}
 	void getTargetRotateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tr.trx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tr.trx\"");
 	}
 	void getTargetRotateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tr.try\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tr.try\"");
 	}
 	void getTargetRotateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tr.try\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tr.try\"");
 	}
 	void getTargetRotateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tr.trz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tr.trz\"");
 	}
 	void getTargetRotateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tr.trz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tr.trz\"");
 	}
 	void getTargetRotateOrder(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tro\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tro\"");
 	}
 	void getTargetRotateOrder()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tro\"");
 	}
 	void getTargetJointOrient(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tjo\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tjo\"");
 	}
 	void getTargetJointOrient()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tjo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tjo\"");
 	}
 	void getTargetJointOrientX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tjo.tjox\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tjo.tjox\"");
 	}
 	void getTargetJointOrientX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tjo.tjox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tjo.tjox\"");
 	}
 	void getTargetJointOrientY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tjo.tjoy\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tjo.tjoy\"");
 	}
 	void getTargetJointOrientY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tjo.tjoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tjo.tjoy\"");
 	}
 	void getTargetJointOrientZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tjo.tjoz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tjo.tjoz\"");
 	}
 	void getTargetJointOrientZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tjo.tjoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tjo.tjoz\"");
 	}
 	void getTargetOffsetRotate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tor\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tor\"");
 	}
 	void getTargetOffsetRotate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tor\"");
 	}
 	void getTargetOffsetRotateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tor.torx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tor.torx\"");
 	}
 	void getTargetOffsetRotateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tor.torx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tor.torx\"");
 	}
 	void getTargetOffsetRotateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tor.tory\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tor.tory\"");
 	}
 	void getTargetOffsetRotateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tor.tory\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tor.tory\"");
 	}
 	void getTargetOffsetRotateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tor.torz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tor.torz\"");
 	}
 	void getTargetOffsetRotateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tor.torz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tor.torz\"");
 	}
 	void getTargetScale(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ts\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ts\"");
 	}
 	void getTargetScale()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ts\"");
 	}
 	void getTargetScaleX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ts.tsx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ts.tsx\"");
 	}
 	void getTargetScaleX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ts.tsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ts.tsx\"");
 	}
 	void getTargetScaleY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ts.tsy\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ts.tsy\"");
 	}
 	void getTargetScaleY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ts.tsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ts.tsy\"");
 	}
 	void getTargetScaleZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ts.tsz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ts.tsz\"");
 	}
 	void getTargetScaleZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ts.tsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ts.tsz\"");
 	}
 	void getConstraintParentInverseMatrix()const
 	{
-		fprintf(mFile,"\"%s.cpim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpim\"");
 	}
 	void getLastTargetRotate()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getLastTargetRotateX()const
 	{
-		fprintf(mFile,"\"%s.lr.lrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lrx\"");
 	}
 	void getLastTargetRotateY()const
 	{
-		fprintf(mFile,"\"%s.lr.lry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lry\"");
 	}
 	void getLastTargetRotateZ()const
 	{
-		fprintf(mFile,"\"%s.lr.lrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lrz\"");
 	}
 	void getConstraintRotatePivot()const
 	{
-		fprintf(mFile,"\"%s.crp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp\"");
 	}
 	void getConstraintRotatePivotX()const
 	{
-		fprintf(mFile,"\"%s.crp.crpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpx\"");
 	}
 	void getConstraintRotatePivotY()const
 	{
-		fprintf(mFile,"\"%s.crp.crpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpy\"");
 	}
 	void getConstraintRotatePivotZ()const
 	{
-		fprintf(mFile,"\"%s.crp.crpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpz\"");
 	}
 	void getConstraintRotateTranslate()const
 	{
-		fprintf(mFile,"\"%s.crt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt\"");
 	}
 	void getConstraintRotateTranslateX()const
 	{
-		fprintf(mFile,"\"%s.crt.crtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crtx\"");
 	}
 	void getConstraintRotateTranslateY()const
 	{
-		fprintf(mFile,"\"%s.crt.crty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crty\"");
 	}
 	void getConstraintRotateTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.crt.crtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crtz\"");
 	}
 	void getConstraintTranslate()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getConstraintTranslateX()const
 	{
-		fprintf(mFile,"\"%s.ct.ctx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctx\"");
 	}
 	void getConstraintTranslateY()const
 	{
-		fprintf(mFile,"\"%s.ct.cty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.cty\"");
 	}
 	void getConstraintTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.ct.ctz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctz\"");
 	}
 	void getRestTranslate()const
 	{
-		fprintf(mFile,"\"%s.rst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rst\"");
 	}
 	void getRestTranslateX()const
 	{
-		fprintf(mFile,"\"%s.rst.rtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rst.rtx\"");
 	}
 	void getRestTranslateY()const
 	{
-		fprintf(mFile,"\"%s.rst.rty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rst.rty\"");
 	}
 	void getRestTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.rst.rtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rst.rtz\"");
 	}
 	void getConstraintRotateOrder()const
 	{
-		fprintf(mFile,"\"%s.cro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cro\"");
 	}
 	void getConstraintJointOrient()const
 	{
-		fprintf(mFile,"\"%s.cjo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo\"");
 	}
 	void getConstraintJointOrientX()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjox\"");
 	}
 	void getConstraintJointOrientY()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjoy\"");
 	}
 	void getConstraintJointOrientZ()const
 	{
-		fprintf(mFile,"\"%s.cjo.cjoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cjo.cjoz\"");
 	}
 	void getConstraintRotate()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getConstraintRotateX()const
 	{
-		fprintf(mFile,"\"%s.cr.crx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crx\"");
 	}
 	void getConstraintRotateY()const
 	{
-		fprintf(mFile,"\"%s.cr.cry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.cry\"");
 	}
 	void getConstraintRotateZ()const
 	{
-		fprintf(mFile,"\"%s.cr.crz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crz\"");
 	}
 	void getRestRotate()const
 	{
-		fprintf(mFile,"\"%s.rsrr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr\"");
 	}
 	void getRestRotateX()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rrx\"");
 	}
 	void getRestRotateY()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rry\"");
 	}
 	void getRestRotateZ()const
 	{
-		fprintf(mFile,"\"%s.rsrr.rrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsrr.rrz\"");
 	}
 	void getInterpType()const
 	{
-		fprintf(mFile,"\"%s.int\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".int\"");
 	}
 	void getInterpCache()const
 	{
-		fprintf(mFile,"\"%s.inc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inc\"");
 	}
 protected:
 	ParentConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
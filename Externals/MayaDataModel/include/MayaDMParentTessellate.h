@@ -27,168 +27,168 @@ public:
 	void setFormat(unsigned int f)
 	{
 		if(f == 1) return;
-		fprintf(mFile,"\tsetAttr \".f\" %i;\n", f);
+		writeInt(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void setPolygonType(unsigned int pt)
 	{
 		if(pt == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt\" %i;\n", pt);
+		writeInt(mFile,"\tsetAttr \".pt\" ",pt,";\n");
 	}
 	void setPolygonCount(int pc)
 	{
 		if(pc == 200) return;
-		fprintf(mFile,"\tsetAttr \".pc\" %i;\n", pc);
+		writeInt(mFile,"\tsetAttr \".pc\" ",pc,";\n");
 	}
 	void setChordHeightRatio(double chr)
 	{
 		if(chr == 0.983) return;
-		fprintf(mFile,"\tsetAttr \".chr\" %f;\n", chr);
+		writeFloat(mFile,"\tsetAttr \".chr\" ",chr,";\n");
 	}
 	void setPre70ChordHeightRatio(bool pchr)
 	{
 		if(pchr == false) return;
-		fprintf(mFile,"\tsetAttr \".pchr\" %i;\n", pchr);
+		writeInt(mFile,"\tsetAttr \".pchr\" ",pchr,";\n");
 	}
 	void setFractionalTolerance(double ft)
 	{
 		if(ft == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %f;\n", ft);
+		writeFloat(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setMinEdgeLength(double mel)
 	{
 		if(mel == 0) return;
-		fprintf(mFile,"\tsetAttr \".mel\" %f;\n", mel);
+		writeFloat(mFile,"\tsetAttr \".mel\" ",mel,";\n");
 	}
 	void setDelta(double d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setUType(unsigned int ut)
 	{
 		if(ut == 3) return;
-		fprintf(mFile,"\tsetAttr \".ut\" %i;\n", ut);
+		writeInt(mFile,"\tsetAttr \".ut\" ",ut,";\n");
 	}
 	void setUNumber(int un)
 	{
 		if(un == 3) return;
-		fprintf(mFile,"\tsetAttr \".un\" %i;\n", un);
+		writeInt(mFile,"\tsetAttr \".un\" ",un,";\n");
 	}
 	void setVType(unsigned int vt)
 	{
 		if(vt == 3) return;
-		fprintf(mFile,"\tsetAttr \".vt\" %i;\n", vt);
+		writeInt(mFile,"\tsetAttr \".vt\" ",vt,";\n");
 	}
 	void setVNumber(int vn)
 	{
 		if(vn == 3) return;
-		fprintf(mFile,"\tsetAttr \".vn\" %i;\n", vn);
+		writeInt(mFile,"\tsetAttr \".vn\" ",vn,";\n");
 	}
 	void setUseChordHeight(bool uch)
 	{
 		if(uch == false) return;
-		fprintf(mFile,"\tsetAttr \".uch\" %i;\n", uch);
+		writeInt(mFile,"\tsetAttr \".uch\" ",uch,";\n");
 	}
 	void setUseChordHeightRatio(bool ucr)
 	{
 		if(ucr == true) return;
-		fprintf(mFile,"\tsetAttr \".ucr\" %i;\n", ucr);
+		writeInt(mFile,"\tsetAttr \".ucr\" ",ucr,";\n");
 	}
 	void setChordHeight(double cht)
 	{
 		if(cht == 0) return;
-		fprintf(mFile,"\tsetAttr \".cht\" %f;\n", cht);
+		writeFloat(mFile,"\tsetAttr \".cht\" ",cht,";\n");
 	}
 	void setEdgeSwap(bool es)
 	{
 		if(es == false) return;
-		fprintf(mFile,"\tsetAttr \".es\" %i;\n", es);
+		writeInt(mFile,"\tsetAttr \".es\" ",es,";\n");
 	}
 	void setMatchNormalDir(bool mnd)
 	{
 		if(mnd == false) return;
-		fprintf(mFile,"\tsetAttr \".mnd\" %i;\n", mnd);
+		writeInt(mFile,"\tsetAttr \".mnd\" ",mnd,";\n");
 	}
 	void setNormalizeTrimmedUVRange(bool ntr)
 	{
 		if(ntr == true) return;
-		fprintf(mFile,"\tsetAttr \".ntr\" %i;\n", ntr);
+		writeInt(mFile,"\tsetAttr \".ntr\" ",ntr,";\n");
 	}
 	void getFormat()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getPolygonType()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getPolygonCount()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getChordHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.chr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chr\"");
 	}
 	void getPre70ChordHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.pchr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pchr\"");
 	}
 	void getFractionalTolerance()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getMinEdgeLength()const
 	{
-		fprintf(mFile,"\"%s.mel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mel\"");
 	}
 	void getDelta()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getUType()const
 	{
-		fprintf(mFile,"\"%s.ut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ut\"");
 	}
 	void getUNumber()const
 	{
-		fprintf(mFile,"\"%s.un\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".un\"");
 	}
 	void getVType()const
 	{
-		fprintf(mFile,"\"%s.vt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt\"");
 	}
 	void getVNumber()const
 	{
-		fprintf(mFile,"\"%s.vn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vn\"");
 	}
 	void getUseChordHeight()const
 	{
-		fprintf(mFile,"\"%s.uch\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uch\"");
 	}
 	void getUseChordHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.ucr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ucr\"");
 	}
 	void getChordHeight()const
 	{
-		fprintf(mFile,"\"%s.cht\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cht\"");
 	}
 	void getEdgeSwap()const
 	{
-		fprintf(mFile,"\"%s.es\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".es\"");
 	}
 	void getMatchNormalDir()const
 	{
-		fprintf(mFile,"\"%s.mnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mnd\"");
 	}
 	void getNormalizeTrimmedUVRange()const
 	{
-		fprintf(mFile,"\"%s.ntr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ntr\"");
 	}
 	void getOutputPolygon()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 protected:
 	ParentTessellate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
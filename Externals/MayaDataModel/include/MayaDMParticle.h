@@ -42,7 +42,7 @@ public:
 		void write(FILE* file) const
 		{
 			instanceAttributeMapping.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 		}
 	};
 	struct MentalRayControls{
@@ -63,21 +63,21 @@ public:
 		short miMaxSamples;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i", miMaxSamples);
+			writeInt(file,"",miOverrideCaustics," ");
+			writeInt(file,"",miCausticAccuracy," ");
+			writeFloat(file,"",miCausticRadius," ");
+			writeInt(file,"",miOverrideGlobalIllumination," ");
+			writeInt(file,"",miGlobillumAccuracy," ");
+			writeFloat(file,"",miGlobillumRadius," ");
+			writeInt(file,"",miOverrideFinalGather," ");
+			writeInt(file,"",miFinalGatherRays," ");
+			writeFloat(file,"",miFinalGatherMinRadius," ");
+			writeFloat(file,"",miFinalGatherMaxRadius," ");
+			writeInt(file,"",miFinalGatherFilter," ");
+			writeInt(file,"",miFinalGatherView," ");
+			writeInt(file,"",miOverrideSamples," ");
+			writeInt(file,"",miMinSamples," ");
+			writeInt(file,"",miMaxSamples);
 		}
 	};
 public:
@@ -90,1538 +90,1538 @@ public:
 	void setPosition0(const vectorArray& pos0)
 	{
 		if(pos0.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".pos0\" -type \"vectorArray\" ");
+		writeString(mFile,"\tsetAttr \".pos0\" -type \"vectorArray\" ");
 		pos0.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVelocity0(const vectorArray& vel0)
 	{
 		if(vel0.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".vel0\" -type \"vectorArray\" ");
+		writeString(mFile,"\tsetAttr \".vel0\" -type \"vectorArray\" ");
 		vel0.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAcceleration0(const vectorArray& acc0)
 	{
 		if(acc0.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".acc0\" -type \"vectorArray\" ");
+		writeString(mFile,"\tsetAttr \".acc0\" -type \"vectorArray\" ");
 		acc0.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseStartupCache(bool usc)
 	{
 		if(usc == false) return;
-		fprintf(mFile,"\tsetAttr \".usc\" %i;\n", usc);
+		writeInt(mFile,"\tsetAttr \".usc\" ",usc,";\n");
 	}
 	void setStartupCachePath(const string& scp)
 	{
 		if(scp == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".scp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".scp\" -type \"string\" ");
 		scp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStartupCacheFrame(int scf)
 	{
 		if(scf == 0) return;
-		fprintf(mFile,"\tsetAttr \".scf\" %i;\n", scf);
+		writeInt(mFile,"\tsetAttr \".scf\" ",scf,";\n");
 	}
 	void setMass0(const doubleArray& mas0)
 	{
 		if(mas0.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".mas0\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".mas0\" -type \"doubleArray\" ");
 		mas0.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParticleId0(const doubleArray& id0)
 	{
 		if(id0.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".id0\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".id0\" -type \"doubleArray\" ");
 		id0.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNextId(int nid)
 	{
 		if(nid == 0) return;
-		fprintf(mFile,"\tsetAttr \".nid\" %i;\n", nid);
+		writeInt(mFile,"\tsetAttr \".nid\" ",nid,";\n");
 	}
 	void setNextId0(int nid0)
 	{
 		if(nid0 == 0) return;
-		fprintf(mFile,"\tsetAttr \".nid0\" %i;\n", nid0);
+		writeInt(mFile,"\tsetAttr \".nid0\" ",nid0,";\n");
 	}
 	void setBirthTime0(const doubleArray& bt0)
 	{
 		if(bt0.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".bt0\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".bt0\" -type \"doubleArray\" ");
 		bt0.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAge0(const doubleArray& ag0)
 	{
 		if(ag0.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ag0\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".ag0\" -type \"doubleArray\" ");
 		ag0.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDieOnEmissionVolumeExit(bool dve)
 	{
 		if(dve == false) return;
-		fprintf(mFile,"\tsetAttr \".dve\" %i;\n", dve);
+		writeInt(mFile,"\tsetAttr \".dve\" ",dve,";\n");
 	}
 	void setLifespanMode(unsigned int lfm)
 	{
 		if(lfm == 0) return;
-		fprintf(mFile,"\tsetAttr \".lfm\" %i;\n", lfm);
+		writeInt(mFile,"\tsetAttr \".lfm\" ",lfm,";\n");
 	}
 	void setLifespanRandom(double lfr)
 	{
 		if(lfr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lfr\" %f;\n", lfr);
+		writeFloat(mFile,"\tsetAttr \".lfr\" ",lfr,";\n");
 	}
 	void setExpressionsAfterDynamics(bool ead)
 	{
 		if(ead == false) return;
-		fprintf(mFile,"\tsetAttr \".ead\" %i;\n", ead);
+		writeInt(mFile,"\tsetAttr \".ead\" ",ead,";\n");
 	}
 	void setInternalRuntimeBeforeDynamicsExpression(const string& irbx)
 	{
 		if(irbx == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".irbx\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".irbx\" -type \"string\" ");
 		irbx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInternalRuntimeAfterDynamicsExpression(const string& irax)
 	{
 		if(irax == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".irax\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".irax\" -type \"string\" ");
 		irax.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInternalCreationExpression(const string& icx)
 	{
 		if(icx == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".icx\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".icx\" -type \"string\" ");
 		icx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIsDynamic(bool isd)
 	{
 		if(isd == true) return;
-		fprintf(mFile,"\tsetAttr \".isd\" %i;\n", isd);
+		writeInt(mFile,"\tsetAttr \".isd\" ",isd,";\n");
 	}
 	void setDynamicsWeight(double dw)
 	{
 		if(dw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".dw\" %f;\n", dw);
+		writeFloat(mFile,"\tsetAttr \".dw\" ",dw,";\n");
 	}
 	void setForcesInWorld(bool fiw)
 	{
 		if(fiw == true) return;
-		fprintf(mFile,"\tsetAttr \".fiw\" %i;\n", fiw);
+		writeInt(mFile,"\tsetAttr \".fiw\" ",fiw,";\n");
 	}
 	void setConserve(double con)
 	{
 		if(con == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".con\" %f;\n", con);
+		writeFloat(mFile,"\tsetAttr \".con\" ",con,";\n");
 	}
 	void setEmissionInWorld(bool eiw)
 	{
 		if(eiw == true) return;
-		fprintf(mFile,"\tsetAttr \".eiw\" %i;\n", eiw);
+		writeInt(mFile,"\tsetAttr \".eiw\" ",eiw,";\n");
 	}
 	void setMaxCount(int mxc)
 	{
 		if(mxc == -1) return;
-		fprintf(mFile,"\tsetAttr \".mxc\" %i;\n", mxc);
+		writeInt(mFile,"\tsetAttr \".mxc\" ",mxc,";\n");
 	}
 	void setLevelOfDetail(double lod)
 	{
 		if(lod == 1) return;
-		fprintf(mFile,"\tsetAttr \".lod\" %f;\n", lod);
+		writeFloat(mFile,"\tsetAttr \".lod\" ",lod,";\n");
 	}
 	void setInheritFactor(double inh)
 	{
 		if(inh == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".inh\" %f;\n", inh);
+		writeFloat(mFile,"\tsetAttr \".inh\" ",inh,";\n");
 	}
 	void setSeed(size_t sd_i,int sd)
 	{
 		if(sd == 1) return;
-		fprintf(mFile,"\tsetAttr \".sd[%i]\" %i;\n", sd_i,sd);
+		writeInt(mFile,"\tsetAttr \".sd[",sd_i); writeInt(mFile,"]\" ",sd,";\n");
 	}
 	void setSeed(size_t sd_start,size_t sd_end,int* sd)
 	{
-		fprintf(mFile,"\tsetAttr \".sd[%i:%i]\" ", sd_start,sd_end);
+		writeInt(mFile,"\tsetAttr \".sd[",sd_start); writeInt(mFile,":",sd_end,"]\" ");
 		size_t size = (sd_end-sd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",sd[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",sd[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSeed(size_t sd_start,size_t sd_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sd[%i:%i]\"",sd_start,sd_end);
+		writeInt(mFile,"\tsetAttr \".sd[",sd_start); writeInt(mFile,":",sd_end,"]\"");
 	}
 	void appendSeed(int sd)const
 	{
-		fprintf(mFile," %i",sd);
+		writeInt(mFile," ",sd);
 	}
 	void endSeed()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCurrentTimeSave(double cts)
 	{
 		if(cts == 0) return;
-		fprintf(mFile,"\tsetAttr \".cts\" %f;\n", cts);
+		writeFloat(mFile,"\tsetAttr \".cts\" ",cts,";\n");
 	}
 	void setStartFrame(double stf)
 	{
 		if(stf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".stf\" %f;\n", stf);
+		writeFloat(mFile,"\tsetAttr \".stf\" ",stf,";\n");
 	}
 	void setInputGeometrySpace(unsigned int igs)
 	{
 		if(igs == 0) return;
-		fprintf(mFile,"\tsetAttr \".igs\" %i;\n", igs);
+		writeInt(mFile,"\tsetAttr \".igs\" ",igs,";\n");
 	}
 	void setEnforceCountFromHistory(bool ecfh)
 	{
 		if(ecfh == true) return;
-		fprintf(mFile,"\tsetAttr \".ecfh\" %i;\n", ecfh);
+		writeInt(mFile,"\tsetAttr \".ecfh\" ",ecfh,";\n");
 	}
 	void setTargetGeometrySpace(unsigned int tgs)
 	{
 		if(tgs == 2) return;
-		fprintf(mFile,"\tsetAttr \".tgs\" %i;\n", tgs);
+		writeInt(mFile,"\tsetAttr \".tgs\" ",tgs,";\n");
 	}
 	void setGoalSmoothness(double gsm)
 	{
 		if(gsm == 3) return;
-		fprintf(mFile,"\tsetAttr \".gsm\" %f;\n", gsm);
+		writeFloat(mFile,"\tsetAttr \".gsm\" ",gsm,";\n");
 	}
 	void setGoalWeight(size_t gw_i,double gw)
 	{
 		if(gw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gw[%i]\" %f;\n", gw_i,gw);
+		writeInt(mFile,"\tsetAttr \".gw[",gw_i); writeFloat(mFile,"]\" ",gw,";\n");
 	}
 	void setGoalWeight(size_t gw_start,size_t gw_end,double* gw)
 	{
-		fprintf(mFile,"\tsetAttr \".gw[%i:%i]\" ", gw_start,gw_end);
+		writeInt(mFile,"\tsetAttr \".gw[",gw_start); writeInt(mFile,":",gw_end,"]\" ");
 		size_t size = (gw_end-gw_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",gw[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",gw[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGoalWeight(size_t gw_start,size_t gw_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".gw[%i:%i]\"",gw_start,gw_end);
+		writeInt(mFile,"\tsetAttr \".gw[",gw_start); writeInt(mFile,":",gw_end,"]\"");
 	}
 	void appendGoalWeight(double gw)const
 	{
-		fprintf(mFile," %f",gw);
+		writeFloat(mFile," ",gw);
 	}
 	void endGoalWeight()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGoalActive(size_t ga_i,bool ga)
 	{
 		if(ga == true) return;
-		fprintf(mFile,"\tsetAttr \".ga[%i]\" %i;\n", ga_i,ga);
+		writeInt(mFile,"\tsetAttr \".ga[",ga_i); writeInt(mFile,"]\" ",ga,";\n");
 	}
 	void setGoalActive(size_t ga_start,size_t ga_end,bool* ga)
 	{
-		fprintf(mFile,"\tsetAttr \".ga[%i:%i]\" ", ga_start,ga_end);
+		writeInt(mFile,"\tsetAttr \".ga[",ga_start); writeInt(mFile,":",ga_end,"]\" ");
 		size_t size = (ga_end-ga_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ga[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ga[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGoalActive(size_t ga_start,size_t ga_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ga[%i:%i]\"",ga_start,ga_end);
+		writeInt(mFile,"\tsetAttr \".ga[",ga_start); writeInt(mFile,":",ga_end,"]\"");
 	}
 	void appendGoalActive(bool ga)const
 	{
-		fprintf(mFile," %i",ga);
+		writeInt(mFile," ",ga);
 	}
 	void endGoalActive()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGoalUvSetName(size_t guv_i,const string& guv)
 	{
 		if(guv == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".guv[%i]\" -type \"string\" ",guv_i);
+		writeInt(mFile,"\tsetAttr \".guv[",guv_i,"]\" -type \"string\" ");
 		guv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGoalUvSetName(size_t guv_start,size_t guv_end,string* guv)
 	{
-		fprintf(mFile,"\tsetAttr \".guv[%i:%i]\" ", guv_start,guv_end);
+		writeInt(mFile,"\tsetAttr \".guv[",guv_start); writeInt(mFile,":",guv_end,"]\" ");
 		size_t size = (guv_end-guv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			guv[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGoalUvSetName(size_t guv_start,size_t guv_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".guv[%i:%i]\"",guv_start,guv_end);
-		fprintf(mFile," -type \"string\" ");
+		writeInt(mFile,"\tsetAttr \".guv[",guv_start); writeInt(mFile,":",guv_end,"]\"");
+		writeString(mFile," -type \"string\" ");
 	}
 	void appendGoalUvSetName(const string& guv)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		guv.write(mFile);
 	}
 	void endGoalUvSetName()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCacheData(bool chd)
 	{
 		if(chd == 0) return;
-		fprintf(mFile,"\tsetAttr \".chd\" %i;\n", chd);
+		writeInt(mFile,"\tsetAttr \".chd\" ",chd,";\n");
 	}
 	void setCacheWidth(int chw)
 	{
 		if(chw == 1) return;
-		fprintf(mFile,"\tsetAttr \".chw\" %i;\n", chw);
+		writeInt(mFile,"\tsetAttr \".chw\" ",chw,";\n");
 	}
 	void setTraceDepth(int trd)
 	{
 		if(trd == 10) return;
-		fprintf(mFile,"\tsetAttr \".trd\" %i;\n", trd);
+		writeInt(mFile,"\tsetAttr \".trd\" ",trd,";\n");
 	}
 	void setEventName(size_t evn_i,const string& evn)
 	{
 		if(evn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".evn[%i]\" -type \"string\" ",evn_i);
+		writeInt(mFile,"\tsetAttr \".evn[",evn_i,"]\" -type \"string\" ");
 		evn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventName(size_t evn_start,size_t evn_end,string* evn)
 	{
-		fprintf(mFile,"\tsetAttr \".evn[%i:%i]\" ", evn_start,evn_end);
+		writeInt(mFile,"\tsetAttr \".evn[",evn_start); writeInt(mFile,":",evn_end,"]\" ");
 		size_t size = (evn_end-evn_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			evn[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventName(size_t evn_start,size_t evn_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".evn[%i:%i]\"",evn_start,evn_end);
-		fprintf(mFile," -type \"string\" ");
+		writeInt(mFile,"\tsetAttr \".evn[",evn_start); writeInt(mFile,":",evn_end,"]\"");
+		writeString(mFile," -type \"string\" ");
 	}
 	void appendEventName(const string& evn)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		evn.write(mFile);
 	}
 	void endEventName()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventValid(size_t evv_i,int evv)
 	{
 		if(evv == -1) return;
-		fprintf(mFile,"\tsetAttr \".evv[%i]\" %i;\n", evv_i,evv);
+		writeInt(mFile,"\tsetAttr \".evv[",evv_i); writeInt(mFile,"]\" ",evv,";\n");
 	}
 	void setEventValid(size_t evv_start,size_t evv_end,int* evv)
 	{
-		fprintf(mFile,"\tsetAttr \".evv[%i:%i]\" ", evv_start,evv_end);
+		writeInt(mFile,"\tsetAttr \".evv[",evv_start); writeInt(mFile,":",evv_end,"]\" ");
 		size_t size = (evv_end-evv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",evv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",evv[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventValid(size_t evv_start,size_t evv_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".evv[%i:%i]\"",evv_start,evv_end);
+		writeInt(mFile,"\tsetAttr \".evv[",evv_start); writeInt(mFile,":",evv_end,"]\"");
 	}
 	void appendEventValid(int evv)const
 	{
-		fprintf(mFile," %i",evv);
+		writeInt(mFile," ",evv);
 	}
 	void endEventValid()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventCount(size_t ecp_i,short ecp)
 	{
 		if(ecp == -1) return;
-		fprintf(mFile,"\tsetAttr \".ecp[%i]\" %i;\n", ecp_i,ecp);
+		writeInt(mFile,"\tsetAttr \".ecp[",ecp_i); writeInt(mFile,"]\" ",ecp,";\n");
 	}
 	void setEventCount(size_t ecp_start,size_t ecp_end,short* ecp)
 	{
-		fprintf(mFile,"\tsetAttr \".ecp[%i:%i]\" ", ecp_start,ecp_end);
+		writeInt(mFile,"\tsetAttr \".ecp[",ecp_start); writeInt(mFile,":",ecp_end,"]\" ");
 		size_t size = (ecp_end-ecp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ecp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ecp[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventCount(size_t ecp_start,size_t ecp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ecp[%i:%i]\"",ecp_start,ecp_end);
+		writeInt(mFile,"\tsetAttr \".ecp[",ecp_start); writeInt(mFile,":",ecp_end,"]\"");
 	}
 	void appendEventCount(short ecp)const
 	{
-		fprintf(mFile," %i",ecp);
+		writeInt(mFile," ",ecp);
 	}
 	void endEventCount()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventEmit(size_t eve_i,short eve)
 	{
 		if(eve == -1) return;
-		fprintf(mFile,"\tsetAttr \".eve[%i]\" %i;\n", eve_i,eve);
+		writeInt(mFile,"\tsetAttr \".eve[",eve_i); writeInt(mFile,"]\" ",eve,";\n");
 	}
 	void setEventEmit(size_t eve_start,size_t eve_end,short* eve)
 	{
-		fprintf(mFile,"\tsetAttr \".eve[%i:%i]\" ", eve_start,eve_end);
+		writeInt(mFile,"\tsetAttr \".eve[",eve_start); writeInt(mFile,":",eve_end,"]\" ");
 		size_t size = (eve_end-eve_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",eve[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",eve[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventEmit(size_t eve_start,size_t eve_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".eve[%i:%i]\"",eve_start,eve_end);
+		writeInt(mFile,"\tsetAttr \".eve[",eve_start); writeInt(mFile,":",eve_end,"]\"");
 	}
 	void appendEventEmit(short eve)const
 	{
-		fprintf(mFile," %i",eve);
+		writeInt(mFile," ",eve);
 	}
 	void endEventEmit()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventSplit(size_t evs_i,short evs)
 	{
 		if(evs == -1) return;
-		fprintf(mFile,"\tsetAttr \".evs[%i]\" %i;\n", evs_i,evs);
+		writeInt(mFile,"\tsetAttr \".evs[",evs_i); writeInt(mFile,"]\" ",evs,";\n");
 	}
 	void setEventSplit(size_t evs_start,size_t evs_end,short* evs)
 	{
-		fprintf(mFile,"\tsetAttr \".evs[%i:%i]\" ", evs_start,evs_end);
+		writeInt(mFile,"\tsetAttr \".evs[",evs_start); writeInt(mFile,":",evs_end,"]\" ");
 		size_t size = (evs_end-evs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",evs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",evs[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventSplit(size_t evs_start,size_t evs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".evs[%i:%i]\"",evs_start,evs_end);
+		writeInt(mFile,"\tsetAttr \".evs[",evs_start); writeInt(mFile,":",evs_end,"]\"");
 	}
 	void appendEventSplit(short evs)const
 	{
-		fprintf(mFile," %i",evs);
+		writeInt(mFile," ",evs);
 	}
 	void endEventSplit()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventDie(size_t evd_i,short evd)
 	{
 		if(evd == -1) return;
-		fprintf(mFile,"\tsetAttr \".evd[%i]\" %i;\n", evd_i,evd);
+		writeInt(mFile,"\tsetAttr \".evd[",evd_i); writeInt(mFile,"]\" ",evd,";\n");
 	}
 	void setEventDie(size_t evd_start,size_t evd_end,short* evd)
 	{
-		fprintf(mFile,"\tsetAttr \".evd[%i:%i]\" ", evd_start,evd_end);
+		writeInt(mFile,"\tsetAttr \".evd[",evd_start); writeInt(mFile,":",evd_end,"]\" ");
 		size_t size = (evd_end-evd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",evd[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",evd[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventDie(size_t evd_start,size_t evd_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".evd[%i:%i]\"",evd_start,evd_end);
+		writeInt(mFile,"\tsetAttr \".evd[",evd_start); writeInt(mFile,":",evd_end,"]\"");
 	}
 	void appendEventDie(short evd)const
 	{
-		fprintf(mFile," %i",evd);
+		writeInt(mFile," ",evd);
 	}
 	void endEventDie()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventRandom(size_t evr_i,short evr)
 	{
 		if(evr == -1) return;
-		fprintf(mFile,"\tsetAttr \".evr[%i]\" %i;\n", evr_i,evr);
+		writeInt(mFile,"\tsetAttr \".evr[",evr_i); writeInt(mFile,"]\" ",evr,";\n");
 	}
 	void setEventRandom(size_t evr_start,size_t evr_end,short* evr)
 	{
-		fprintf(mFile,"\tsetAttr \".evr[%i:%i]\" ", evr_start,evr_end);
+		writeInt(mFile,"\tsetAttr \".evr[",evr_start); writeInt(mFile,":",evr_end,"]\" ");
 		size_t size = (evr_end-evr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",evr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",evr[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventRandom(size_t evr_start,size_t evr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".evr[%i:%i]\"",evr_start,evr_end);
+		writeInt(mFile,"\tsetAttr \".evr[",evr_start); writeInt(mFile,":",evr_end,"]\"");
 	}
 	void appendEventRandom(short evr)const
 	{
-		fprintf(mFile," %i",evr);
+		writeInt(mFile," ",evr);
 	}
 	void endEventRandom()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventSpread(size_t esp_i,double esp)
 	{
 		if(esp == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".esp[%i]\" %f;\n", esp_i,esp);
+		writeInt(mFile,"\tsetAttr \".esp[",esp_i); writeFloat(mFile,"]\" ",esp,";\n");
 	}
 	void setEventSpread(size_t esp_start,size_t esp_end,double* esp)
 	{
-		fprintf(mFile,"\tsetAttr \".esp[%i:%i]\" ", esp_start,esp_end);
+		writeInt(mFile,"\tsetAttr \".esp[",esp_start); writeInt(mFile,":",esp_end,"]\" ");
 		size_t size = (esp_end-esp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",esp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",esp[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventSpread(size_t esp_start,size_t esp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".esp[%i:%i]\"",esp_start,esp_end);
+		writeInt(mFile,"\tsetAttr \".esp[",esp_start); writeInt(mFile,":",esp_end,"]\"");
 	}
 	void appendEventSpread(double esp)const
 	{
-		fprintf(mFile," %f",esp);
+		writeFloat(mFile," ",esp);
 	}
 	void endEventSpread()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventProc(size_t epr_i,const string& epr)
 	{
 		if(epr == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".epr[%i]\" -type \"string\" ",epr_i);
+		writeInt(mFile,"\tsetAttr \".epr[",epr_i,"]\" -type \"string\" ");
 		epr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEventProc(size_t epr_start,size_t epr_end,string* epr)
 	{
-		fprintf(mFile,"\tsetAttr \".epr[%i:%i]\" ", epr_start,epr_end);
+		writeInt(mFile,"\tsetAttr \".epr[",epr_start); writeInt(mFile,":",epr_end,"]\" ");
 		size_t size = (epr_end-epr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			epr[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEventProc(size_t epr_start,size_t epr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".epr[%i:%i]\"",epr_start,epr_end);
-		fprintf(mFile," -type \"string\" ");
+		writeInt(mFile,"\tsetAttr \".epr[",epr_start); writeInt(mFile,":",epr_end,"]\"");
+		writeString(mFile," -type \"string\" ");
 	}
 	void appendEventProc(const string& epr)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		epr.write(mFile);
 	}
 	void endEventProc()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInstanceData(size_t idt_i,const InstanceData& idt)
 	{
-		fprintf(mFile,"\tsetAttr \".idt[%i]\" ",idt_i);
+		writeInt(mFile,"\tsetAttr \".idt[",idt_i,"]\" ");
 		idt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInstanceData(size_t idt_start,size_t idt_end,InstanceData* idt)
 	{
-		fprintf(mFile,"\tsetAttr \".idt[%i:%i]\" ", idt_start,idt_end);
+		writeInt(mFile,"\tsetAttr \".idt[",idt_start); writeInt(mFile,":",idt_end,"]\" ");
 		size_t size = (idt_end-idt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			idt[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInstanceData(size_t idt_start,size_t idt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".idt[%i:%i]\"",idt_start,idt_end);
-		fprintf(mFile," -type \"InstanceData\" ");
+		writeInt(mFile,"\tsetAttr \".idt[",idt_start); writeInt(mFile,":",idt_end,"]\"");
+		writeString(mFile," -type \"InstanceData\" ");
 	}
 	void appendInstanceData(const InstanceData& idt)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		idt.write(mFile);
 	}
 	void endInstanceData()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInstanceAttributeMapping(size_t idt_i,const stringArray& iam)
 	{
-		fprintf(mFile,"\tsetAttr \".idt[%i].iam\" -type \"stringArray\" ",idt_i);
+		writeInt(mFile,"\tsetAttr \".idt[",idt_i,"].iam\" -type \"stringArray\" ");
 		iam.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNewFileFormat(short nff)
 	{
 		if(nff == 0) return;
-		fprintf(mFile,"\tsetAttr \".nff\" %i;\n", nff);
+		writeInt(mFile,"\tsetAttr \".nff\" ",nff,";\n");
 	}
 	void setDepthSort(bool ds)
 	{
 		if(ds == false) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %i;\n", ds);
+		writeInt(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void setParticleRenderType(unsigned int prt)
 	{
 		if(prt == 3) return;
-		fprintf(mFile,"\tsetAttr \".prt\" %i;\n", prt);
+		writeInt(mFile,"\tsetAttr \".prt\" ",prt,";\n");
 	}
 	void setDisableCloudAxis(bool dca)
 	{
 		if(dca == false) return;
-		fprintf(mFile,"\tsetAttr \".dca\" %i;\n", dca);
+		writeInt(mFile,"\tsetAttr \".dca\" ",dca,";\n");
 	}
 	void setNormalizeVelocity(bool nvl)
 	{
 		if(nvl == false) return;
-		fprintf(mFile,"\tsetAttr \".nvl\" %i;\n", nvl);
+		writeInt(mFile,"\tsetAttr \".nvl\" ",nvl,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiOverrideCaustics(bool oca)
 	{
 		if(oca == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oca\" %i;\n", oca);
+		writeInt(mFile,"\tsetAttr \".mrc.oca\" ",oca,";\n");
 	}
 	void setMiCausticAccuracy(short caa)
 	{
 		if(caa == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.caa\" %i;\n", caa);
+		writeInt(mFile,"\tsetAttr \".mrc.caa\" ",caa,";\n");
 	}
 	void setMiCausticRadius(float car)
 	{
 		if(car == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.car\" %f;\n", car);
+		writeFloat(mFile,"\tsetAttr \".mrc.car\" ",car,";\n");
 	}
 	void setMiOverrideGlobalIllumination(bool ogi)
 	{
 		if(ogi == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ogi\" %i;\n", ogi);
+		writeInt(mFile,"\tsetAttr \".mrc.ogi\" ",ogi,";\n");
 	}
 	void setMiGlobillumAccuracy(short gia)
 	{
 		if(gia == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gia\" %i;\n", gia);
+		writeInt(mFile,"\tsetAttr \".mrc.gia\" ",gia,";\n");
 	}
 	void setMiGlobillumRadius(float gir)
 	{
 		if(gir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gir\" %f;\n", gir);
+		writeFloat(mFile,"\tsetAttr \".mrc.gir\" ",gir,";\n");
 	}
 	void setMiOverrideFinalGather(bool ofg)
 	{
 		if(ofg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ofg\" %i;\n", ofg);
+		writeInt(mFile,"\tsetAttr \".mrc.ofg\" ",ofg,";\n");
 	}
 	void setMiFinalGatherRays(int fry)
 	{
 		if(fry == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fry\" %i;\n", fry);
+		writeInt(mFile,"\tsetAttr \".mrc.fry\" ",fry,";\n");
 	}
 	void setMiFinalGatherMinRadius(float fmn)
 	{
 		if(fmn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmn\" %f;\n", fmn);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmn\" ",fmn,";\n");
 	}
 	void setMiFinalGatherMaxRadius(float fmx)
 	{
 		if(fmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmx\" %f;\n", fmx);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmx\" ",fmx,";\n");
 	}
 	void setMiFinalGatherFilter(short ffi)
 	{
 		if(ffi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ffi\" %i;\n", ffi);
+		writeInt(mFile,"\tsetAttr \".mrc.ffi\" ",ffi,";\n");
 	}
 	void setMiFinalGatherView(bool fgv)
 	{
 		if(fgv == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgv\" %i;\n", fgv);
+		writeInt(mFile,"\tsetAttr \".mrc.fgv\" ",fgv,";\n");
 	}
 	void setMiOverrideSamples(bool oos)
 	{
 		if(oos == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oos\" %i;\n", oos);
+		writeInt(mFile,"\tsetAttr \".mrc.oos\" ",oos,";\n");
 	}
 	void setMiMinSamples(short mins)
 	{
 		if(mins == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mins\" %i;\n", mins);
+		writeInt(mFile,"\tsetAttr \".mrc.mins\" ",mins,";\n");
 	}
 	void setMiMaxSamples(short maxs)
 	{
 		if(maxs == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.maxs\" %i;\n", maxs);
+		writeInt(mFile,"\tsetAttr \".mrc.maxs\" ",maxs,";\n");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.pos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos\"");
 	}
 	void getRampPosition()const
 	{
-		fprintf(mFile,"\"%s.rps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rps\"");
 	}
 	void getCentroid()const
 	{
-		fprintf(mFile,"\"%s.ctd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctd\"");
 	}
 	void getCentroidX()const
 	{
-		fprintf(mFile,"\"%s.ctd.ctdx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctd.ctdx\"");
 	}
 	void getCentroidY()const
 	{
-		fprintf(mFile,"\"%s.ctd.ctdy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctd.ctdy\"");
 	}
 	void getCentroidZ()const
 	{
-		fprintf(mFile,"\"%s.ctd.ctdz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctd.ctdz\"");
 	}
 	void getLastPosition()const
 	{
-		fprintf(mFile,"\"%s.lpos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lpos\"");
 	}
 	void getVelocity()const
 	{
-		fprintf(mFile,"\"%s.vel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel\"");
 	}
 	void getRampVelocity()const
 	{
-		fprintf(mFile,"\"%s.rvl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rvl\"");
 	}
 	void getLastVelocity()const
 	{
-		fprintf(mFile,"\"%s.lvel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lvel\"");
 	}
 	void getAcceleration()const
 	{
-		fprintf(mFile,"\"%s.acc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acc\"");
 	}
 	void getRampAcceleration()const
 	{
-		fprintf(mFile,"\"%s.rac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rac\"");
 	}
 	void getForce()const
 	{
-		fprintf(mFile,"\"%s.frc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frc\"");
 	}
 	void getInputForce(size_t ifc_i)const
 	{
-		fprintf(mFile,"\"%s.ifc[%i]\"",mName.c_str(),ifc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ifc[",ifc_i,"]\"");
 	}
 	void getInputForce()const
 	{
 
-		fprintf(mFile,"\"%s.ifc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ifc\"");
 	}
 	void getWorldPosition()const
 	{
-		fprintf(mFile,"\"%s.wps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wps\"");
 	}
 	void getWorldCentroid()const
 	{
-		fprintf(mFile,"\"%s.wctn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wctn\"");
 	}
 	void getWorldCentroidX()const
 	{
-		fprintf(mFile,"\"%s.wctn.wctx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wctn.wctx\"");
 	}
 	void getWorldCentroidY()const
 	{
-		fprintf(mFile,"\"%s.wctn.wcty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wctn.wcty\"");
 	}
 	void getWorldCentroidZ()const
 	{
-		fprintf(mFile,"\"%s.wctn.wctz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wctn.wctz\"");
 	}
 	void getLastWorldPosition()const
 	{
-		fprintf(mFile,"\"%s.lwps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lwps\"");
 	}
 	void getWorldVelocity()const
 	{
-		fprintf(mFile,"\"%s.wvl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wvl\"");
 	}
 	void getWorldVelocityInObjectSpace()const
 	{
-		fprintf(mFile,"\"%s.wvo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wvo\"");
 	}
 	void getLastWorldVelocity()const
 	{
-		fprintf(mFile,"\"%s.lwvl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lwvl\"");
 	}
 	void getLastWorldMatrix()const
 	{
-		fprintf(mFile,"\"%s.lwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lwm\"");
 	}
 	void getPosition0()const
 	{
-		fprintf(mFile,"\"%s.pos0\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos0\"");
 	}
 	void getVelocity0()const
 	{
-		fprintf(mFile,"\"%s.vel0\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel0\"");
 	}
 	void getAcceleration0()const
 	{
-		fprintf(mFile,"\"%s.acc0\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acc0\"");
 	}
 	void getStartupCachePath()const
 	{
-		fprintf(mFile,"\"%s.scp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scp\"");
 	}
 	void getStartupCacheFrame()const
 	{
-		fprintf(mFile,"\"%s.scf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scf\"");
 	}
 	void getCachedPosition()const
 	{
-		fprintf(mFile,"\"%s.cpos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpos\"");
 	}
 	void getLastCachedPosition()const
 	{
-		fprintf(mFile,"\"%s.lcps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcps\"");
 	}
 	void getCachedWorldPosition()const
 	{
-		fprintf(mFile,"\"%s.cwps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwps\"");
 	}
 	void getCachedWorldCentroid()const
 	{
-		fprintf(mFile,"\"%s.cwcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwcn\"");
 	}
 	void getCachedWorldCentroidX()const
 	{
-		fprintf(mFile,"\"%s.cwcn.cwcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwcn.cwcx\"");
 	}
 	void getCachedWorldCentroidY()const
 	{
-		fprintf(mFile,"\"%s.cwcn.cwcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwcn.cwcy\"");
 	}
 	void getCachedWorldCentroidZ()const
 	{
-		fprintf(mFile,"\"%s.cwcn.cwcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwcn.cwcz\"");
 	}
 	void getCachedVelocity()const
 	{
-		fprintf(mFile,"\"%s.cvel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cvel\"");
 	}
 	void getCachedWorldVelocity()const
 	{
-		fprintf(mFile,"\"%s.cwvl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwvl\"");
 	}
 	void getCount()const
 	{
-		fprintf(mFile,"\"%s.cnt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnt\"");
 	}
 	void getMass()const
 	{
-		fprintf(mFile,"\"%s.mas\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mas\"");
 	}
 	void getMass0()const
 	{
-		fprintf(mFile,"\"%s.mas0\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mas0\"");
 	}
 	void getMassCache()const
 	{
-		fprintf(mFile,"\"%s.masc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".masc\"");
 	}
 	void getParticleId()const
 	{
-		fprintf(mFile,"\"%s.id\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".id\"");
 	}
 	void getParticleId0()const
 	{
-		fprintf(mFile,"\"%s.id0\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".id0\"");
 	}
 	void getIdCache()const
 	{
-		fprintf(mFile,"\"%s.idc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idc\"");
 	}
 	void getIdMapping()const
 	{
-		fprintf(mFile,"\"%s.idm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idm\"");
 	}
 	void getSortedId()const
 	{
-		fprintf(mFile,"\"%s.idm.sid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idm.sid\"");
 	}
 	void getIdIndex()const
 	{
-		fprintf(mFile,"\"%s.idm.idix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idm.idix\"");
 	}
 	void getBirthTime()const
 	{
-		fprintf(mFile,"\"%s.bt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bt\"");
 	}
 	void getBirthTime0()const
 	{
-		fprintf(mFile,"\"%s.bt0\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bt0\"");
 	}
 	void getBirthTimeCache()const
 	{
-		fprintf(mFile,"\"%s.btc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".btc\"");
 	}
 	void getAge()const
 	{
-		fprintf(mFile,"\"%s.ag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ag\"");
 	}
 	void getAge0()const
 	{
-		fprintf(mFile,"\"%s.ag0\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ag0\"");
 	}
 	void getAgeCache()const
 	{
-		fprintf(mFile,"\"%s.agc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".agc\"");
 	}
 	void getEmission()const
 	{
-		fprintf(mFile,"\"%s.emt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emt\"");
 	}
 	void getDieOnEmissionVolumeExit()const
 	{
-		fprintf(mFile,"\"%s.dve\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dve\"");
 	}
 	void getIsFull()const
 	{
-		fprintf(mFile,"\"%s.ifl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ifl\"");
 	}
 	void getNewParticles(size_t npt_i)const
 	{
-		fprintf(mFile,"\"%s.npt[%i]\"",mName.c_str(),npt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".npt[",npt_i,"]\"");
 	}
 	void getNewParticles()const
 	{
 
-		fprintf(mFile,"\"%s.npt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npt\"");
 	}
 	void getLifespanMode()const
 	{
-		fprintf(mFile,"\"%s.lfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfm\"");
 	}
 	void getLifespanRandom()const
 	{
-		fprintf(mFile,"\"%s.lfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lfr\"");
 	}
 	void getFinalLifespanPP()const
 	{
-		fprintf(mFile,"\"%s.flp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flp\"");
 	}
 	void getExpressionsAfterDynamics()const
 	{
-		fprintf(mFile,"\"%s.ead\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ead\"");
 	}
 	void getInput(size_t xi_i)const
 	{
-		fprintf(mFile,"\"%s.xi[%i]\"",mName.c_str(),xi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".xi[",xi_i,"]\"");
 	}
 	void getInput()const
 	{
 
-		fprintf(mFile,"\"%s.xi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xi\"");
 	}
 	void getOutput(size_t xo_i)const
 	{
-		fprintf(mFile,"\"%s.xo[%i]\"",mName.c_str(),xo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".xo[",xo_i,"]\"");
 	}
 	void getOutput()const
 	{
 
-		fprintf(mFile,"\"%s.xo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xo\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.tim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tim\"");
 	}
 	void getFrame()const
 	{
-		fprintf(mFile,"\"%s.frm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frm\"");
 	}
 	void getDiedLastTime()const
 	{
-		fprintf(mFile,"\"%s.dlt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dlt\"");
 	}
 	void getNetEmittedLastTime()const
 	{
-		fprintf(mFile,"\"%s.nlt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nlt\"");
 	}
 	void getStartEmittedIndex()const
 	{
-		fprintf(mFile,"\"%s.sei\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sei\"");
 	}
 	void getIsDynamic()const
 	{
-		fprintf(mFile,"\"%s.isd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isd\"");
 	}
 	void getDynamicsWeight()const
 	{
-		fprintf(mFile,"\"%s.dw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dw\"");
 	}
 	void getForcesInWorld()const
 	{
-		fprintf(mFile,"\"%s.fiw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fiw\"");
 	}
 	void getConserve()const
 	{
-		fprintf(mFile,"\"%s.con\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".con\"");
 	}
 	void getEmissionInWorld()const
 	{
-		fprintf(mFile,"\"%s.eiw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eiw\"");
 	}
 	void getMaxCount()const
 	{
-		fprintf(mFile,"\"%s.mxc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxc\"");
 	}
 	void getLevelOfDetail()const
 	{
-		fprintf(mFile,"\"%s.lod\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lod\"");
 	}
 	void getInheritFactor()const
 	{
-		fprintf(mFile,"\"%s.inh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inh\"");
 	}
 	void getSeed(size_t sd_i)const
 	{
-		fprintf(mFile,"\"%s.sd[%i]\"",mName.c_str(),sd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sd[",sd_i,"]\"");
 	}
 	void getSeed()const
 	{
 
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getFieldData()const
 	{
-		fprintf(mFile,"\"%s.fd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd\"");
 	}
 	void getFieldDataPosition()const
 	{
-		fprintf(mFile,"\"%s.fd.fdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdp\"");
 	}
 	void getFieldDataVelocity()const
 	{
-		fprintf(mFile,"\"%s.fd.fdv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdv\"");
 	}
 	void getFieldDataMass()const
 	{
-		fprintf(mFile,"\"%s.fd.fdm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdm\"");
 	}
 	void getFieldDataDeltaTime()const
 	{
-		fprintf(mFile,"\"%s.fd.fdt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fd.fdt\"");
 	}
 	void getEmitterData()const
 	{
-		fprintf(mFile,"\"%s.ed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed\"");
 	}
 	void getEmitterDataPosition()const
 	{
-		fprintf(mFile,"\"%s.ed.edp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed.edp\"");
 	}
 	void getEmitterDataVelocity()const
 	{
-		fprintf(mFile,"\"%s.ed.edv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed.edv\"");
 	}
 	void getEmitterDataDeltaTime()const
 	{
-		fprintf(mFile,"\"%s.ed.edt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed.edt\"");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.cti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cti\"");
 	}
 	void getLastTimeEvaluated()const
 	{
-		fprintf(mFile,"\"%s.lti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lti\"");
 	}
 	void getCachedTime()const
 	{
-		fprintf(mFile,"\"%s.chti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chti\"");
 	}
 	void getTimeStepSize()const
 	{
-		fprintf(mFile,"\"%s.tss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tss\"");
 	}
 	void getSceneTimeStepSize()const
 	{
-		fprintf(mFile,"\"%s.sts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sts\"");
 	}
 	void getStartFrame()const
 	{
-		fprintf(mFile,"\"%s.stf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stf\"");
 	}
 	void getStartTime()const
 	{
-		fprintf(mFile,"\"%s.stt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stt\"");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.igeo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igeo\"");
 	}
 	void getInputGeometryPoints()const
 	{
-		fprintf(mFile,"\"%s.igpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igpt\"");
 	}
 	void getInputGeometrySpace()const
 	{
-		fprintf(mFile,"\"%s.igs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igs\"");
 	}
 	void getEnforceCountFromHistory()const
 	{
-		fprintf(mFile,"\"%s.ecfh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecfh\"");
 	}
 	void getTargetGeometry()const
 	{
-		fprintf(mFile,"\"%s.tgeo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tgeo\"");
 	}
 	void getTargetGeometryWorldMatrix()const
 	{
-		fprintf(mFile,"\"%s.tgm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tgm\"");
 	}
 	void getTargetGeometrySpace()const
 	{
-		fprintf(mFile,"\"%s.tgs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tgs\"");
 	}
 	void getGoalSmoothness()const
 	{
-		fprintf(mFile,"\"%s.gsm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gsm\"");
 	}
 	void getGoalGeometry(size_t ggeo_i)const
 	{
-		fprintf(mFile,"\"%s.ggeo[%i]\"",mName.c_str(),ggeo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ggeo[",ggeo_i,"]\"");
 	}
 	void getGoalGeometry()const
 	{
 
-		fprintf(mFile,"\"%s.ggeo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ggeo\"");
 	}
 	void getGoalWeight(size_t gw_i)const
 	{
-		fprintf(mFile,"\"%s.gw[%i]\"",mName.c_str(),gw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gw[",gw_i,"]\"");
 	}
 	void getGoalWeight()const
 	{
 
-		fprintf(mFile,"\"%s.gw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gw\"");
 	}
 	void getGoalActive(size_t ga_i)const
 	{
-		fprintf(mFile,"\"%s.ga[%i]\"",mName.c_str(),ga_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ga[",ga_i,"]\"");
 	}
 	void getGoalActive()const
 	{
 
-		fprintf(mFile,"\"%s.ga\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ga\"");
 	}
 	void getGoalUvSetName(size_t guv_i)const
 	{
-		fprintf(mFile,"\"%s.guv[%i]\"",mName.c_str(),guv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".guv[",guv_i,"]\"");
 	}
 	void getGoalUvSetName()const
 	{
 
-		fprintf(mFile,"\"%s.guv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".guv\"");
 	}
 	void getCacheData()const
 	{
-		fprintf(mFile,"\"%s.chd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chd\"");
 	}
 	void getCacheWidth()const
 	{
-		fprintf(mFile,"\"%s.chw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chw\"");
 	}
 	void getTraceDepth()const
 	{
-		fprintf(mFile,"\"%s.trd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trd\"");
 	}
 	void getCollisionData()const
 	{
-		fprintf(mFile,"\"%s.cda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cda\"");
 	}
 	void getCollisionGeometry(size_t cge_i)const
 	{
-		fprintf(mFile,"\"%s.cda.cge[%i]\"",mName.c_str(),cge_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.cge[",cge_i,"]\"");
 	}
 	void getCollisionResilience(size_t crs_i)const
 	{
-		fprintf(mFile,"\"%s.cda.crs[%i]\"",mName.c_str(),crs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.crs[",crs_i,"]\"");
 	}
 	void getCollisionFriction(size_t cfr_i)const
 	{
-		fprintf(mFile,"\"%s.cda.cfr[%i]\"",mName.c_str(),cfr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.cfr[",cfr_i,"]\"");
 	}
 	void getCollisionOffset(size_t cof_i)const
 	{
-		fprintf(mFile,"\"%s.cda.cof[%i]\"",mName.c_str(),cof_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cda.cof[",cof_i,"]\"");
 	}
 	void getCollisionRecords()const
 	{
-		fprintf(mFile,"\"%s.crc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crc\"");
 	}
 	void getTotalEventCount()const
 	{
-		fprintf(mFile,"\"%s.tec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tec\"");
 	}
 	void getEventTest()const
 	{
-		fprintf(mFile,"\"%s.evt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evt\"");
 	}
 	void getLastTotalEventCount()const
 	{
-		fprintf(mFile,"\"%s.ltec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltec\"");
 	}
 	void getEventTarget(size_t etg_i)const
 	{
-		fprintf(mFile,"\"%s.etg[%i]\"",mName.c_str(),etg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".etg[",etg_i,"]\"");
 	}
 	void getEventTarget()const
 	{
 
-		fprintf(mFile,"\"%s.etg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".etg\"");
 	}
 	void getEventName(size_t evn_i)const
 	{
-		fprintf(mFile,"\"%s.evn[%i]\"",mName.c_str(),evn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".evn[",evn_i,"]\"");
 	}
 	void getEventName()const
 	{
 
-		fprintf(mFile,"\"%s.evn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evn\"");
 	}
 	void getEventValid(size_t evv_i)const
 	{
-		fprintf(mFile,"\"%s.evv[%i]\"",mName.c_str(),evv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".evv[",evv_i,"]\"");
 	}
 	void getEventValid()const
 	{
 
-		fprintf(mFile,"\"%s.evv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evv\"");
 	}
 	void getEventCount(size_t ecp_i)const
 	{
-		fprintf(mFile,"\"%s.ecp[%i]\"",mName.c_str(),ecp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ecp[",ecp_i,"]\"");
 	}
 	void getEventCount()const
 	{
 
-		fprintf(mFile,"\"%s.ecp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecp\"");
 	}
 	void getEventEmit(size_t eve_i)const
 	{
-		fprintf(mFile,"\"%s.eve[%i]\"",mName.c_str(),eve_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".eve[",eve_i,"]\"");
 	}
 	void getEventEmit()const
 	{
 
-		fprintf(mFile,"\"%s.eve\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eve\"");
 	}
 	void getEventSplit(size_t evs_i)const
 	{
-		fprintf(mFile,"\"%s.evs[%i]\"",mName.c_str(),evs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".evs[",evs_i,"]\"");
 	}
 	void getEventSplit()const
 	{
 
-		fprintf(mFile,"\"%s.evs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evs\"");
 	}
 	void getEventDie(size_t evd_i)const
 	{
-		fprintf(mFile,"\"%s.evd[%i]\"",mName.c_str(),evd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".evd[",evd_i,"]\"");
 	}
 	void getEventDie()const
 	{
 
-		fprintf(mFile,"\"%s.evd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evd\"");
 	}
 	void getEventRandom(size_t evr_i)const
 	{
-		fprintf(mFile,"\"%s.evr[%i]\"",mName.c_str(),evr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".evr[",evr_i,"]\"");
 	}
 	void getEventRandom()const
 	{
 
-		fprintf(mFile,"\"%s.evr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evr\"");
 	}
 	void getEventSpread(size_t esp_i)const
 	{
-		fprintf(mFile,"\"%s.esp[%i]\"",mName.c_str(),esp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".esp[",esp_i,"]\"");
 	}
 	void getEventSpread()const
 	{
 
-		fprintf(mFile,"\"%s.esp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".esp\"");
 	}
 	void getEventProc(size_t epr_i)const
 	{
-		fprintf(mFile,"\"%s.epr[%i]\"",mName.c_str(),epr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".epr[",epr_i,"]\"");
 	}
 	void getEventProc()const
 	{
 
-		fprintf(mFile,"\"%s.epr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".epr\"");
 	}
 	void getInstanceData(size_t idt_i)const
 	{
-		fprintf(mFile,"\"%s.idt[%i]\"",mName.c_str(),idt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".idt[",idt_i,"]\"");
 	}
 	void getInstanceData()const
 	{
 
-		fprintf(mFile,"\"%s.idt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idt\"");
 	}
 	void getInstancePointData(size_t idt_i)const
 	{
-		fprintf(mFile,"\"%s.idt[%i].ipd\"",mName.c_str(),idt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".idt[",idt_i,"].ipd\"");
 	}
 	void getInstancePointData()const
 	{
 
-		fprintf(mFile,"\"%s.idt.ipd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idt.ipd\"");
 	}
 	void getNumberOfEvents()const
 	{
-		fprintf(mFile,"\"%s.nev\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nev\"");
 	}
 	void getEventNameCount()const
 	{
-		fprintf(mFile,"\"%s.enc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".enc\"");
 	}
 	void getFieldConnections(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i]\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"]\"");
 	}
 	void getFieldConnections()const
 	{
 
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getCollisionConnections(size_t cc_i)const
 	{
-		fprintf(mFile,"\"%s.cc[%i]\"",mName.c_str(),cc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cc[",cc_i,"]\"");
 	}
 	void getCollisionConnections()const
 	{
 
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 	void getConnectionsToMe(size_t ct_i)const
 	{
-		fprintf(mFile,"\"%s.ct[%i]\"",mName.c_str(),ct_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ct[",ct_i,"]\"");
 	}
 	void getConnectionsToMe()const
 	{
 
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getAuxiliariesOwned()const
 	{
-		fprintf(mFile,"\"%s.ao\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ao\"");
 	}
 	void getEmitterConnections(size_t ec_i)const
 	{
-		fprintf(mFile,"\"%s.ec[%i]\"",mName.c_str(),ec_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ec[",ec_i,"]\"");
 	}
 	void getEmitterConnections()const
 	{
 
-		fprintf(mFile,"\"%s.ec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ec\"");
 	}
 	void getInheritColor()const
 	{
-		fprintf(mFile,"\"%s.inc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inc\"");
 	}
 	void getShapeNameMsg()const
 	{
-		fprintf(mFile,"\"%s.snmg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".snmg\"");
 	}
 	void getDoDynamics()const
 	{
-		fprintf(mFile,"\"%s.ddy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ddy\"");
 	}
 	void getDoEmission()const
 	{
-		fprintf(mFile,"\"%s.dem\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dem\"");
 	}
 	void getForceEmission()const
 	{
-		fprintf(mFile,"\"%s.fem\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fem\"");
 	}
 	void getDoAge()const
 	{
-		fprintf(mFile,"\"%s.dag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dag\"");
 	}
 	void getAgesLastDone()const
 	{
-		fprintf(mFile,"\"%s.agld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".agld\"");
 	}
 	void getTimeLastComputed()const
 	{
-		fprintf(mFile,"\"%s.tlc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlc\"");
 	}
 	void getParentMatrixDirty()const
 	{
-		fprintf(mFile,"\"%s.pmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmd\"");
 	}
 	void getNewFileFormat()const
 	{
-		fprintf(mFile,"\"%s.nff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nff\"");
 	}
 	void getDepthSort()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 	void getParticleRenderType()const
 	{
-		fprintf(mFile,"\"%s.prt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".prt\"");
 	}
 	void getDisableCloudAxis()const
 	{
-		fprintf(mFile,"\"%s.dca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dca\"");
 	}
 	void getNormalizeVelocity()const
 	{
-		fprintf(mFile,"\"%s.nvl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nvl\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiOverrideCaustics()const
 	{
-		fprintf(mFile,"\"%s.mrc.oca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oca\"");
 	}
 	void getMiCausticAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.caa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.caa\"");
 	}
 	void getMiCausticRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.car\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.car\"");
 	}
 	void getMiOverrideGlobalIllumination()const
 	{
-		fprintf(mFile,"\"%s.mrc.ogi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ogi\"");
 	}
 	void getMiGlobillumAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.gia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gia\"");
 	}
 	void getMiGlobillumRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.gir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gir\"");
 	}
 	void getMiOverrideFinalGather()const
 	{
-		fprintf(mFile,"\"%s.mrc.ofg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ofg\"");
 	}
 	void getMiFinalGatherRays()const
 	{
-		fprintf(mFile,"\"%s.mrc.fry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fry\"");
 	}
 	void getMiFinalGatherMinRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmn\"");
 	}
 	void getMiFinalGatherMaxRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmx\"");
 	}
 	void getMiFinalGatherFilter()const
 	{
-		fprintf(mFile,"\"%s.mrc.ffi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ffi\"");
 	}
 	void getMiFinalGatherView()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgv\"");
 	}
 	void getMiOverrideSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.oos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oos\"");
 	}
 	void getMiMinSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.mins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mins\"");
 	}
 	void getMiMaxSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.maxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.maxs\"");
 	}
 	void getPpFieldData(size_t ppfd_i)const
 	{
-		fprintf(mFile,"\"%s.ppfd[%i]\"",mName.c_str(),ppfd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ppfd[",ppfd_i,"]\"");
 	}
 	void getPpFieldData()const
 	{
 
-		fprintf(mFile,"\"%s.ppfd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ppfd\"");
 	}
 	void getOwnerPPFieldData(size_t opfd_i)const
 	{
-		fprintf(mFile,"\"%s.opfd[%i]\"",mName.c_str(),opfd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".opfd[",opfd_i,"]\"");
 	}
 	void getOwnerPPFieldData()const
 	{
 
-		fprintf(mFile,"\"%s.opfd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opfd\"");
 	}
 	void getDeformedPosition()const
 	{
-		fprintf(mFile,"\"%s.dpos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpos\"");
 	}
 protected:
 	Particle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
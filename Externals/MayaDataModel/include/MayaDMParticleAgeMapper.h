@@ -27,49 +27,49 @@ public:
 	void setRelativeAge(bool rea)
 	{
 		if(rea == false) return;
-		fprintf(mFile,"\tsetAttr \".rea\" %i;\n", rea);
+		writeInt(mFile,"\tsetAttr \".rea\" ",rea,";\n");
 	}
 	void setTimeScale(float ts)
 	{
 		if(ts == 1) return;
-		fprintf(mFile,"\tsetAttr \".ts\" %f;\n", ts);
+		writeFloat(mFile,"\tsetAttr \".ts\" ",ts,";\n");
 	}
 	void setFoldAtEnd(bool fae)
 	{
 		if(fae == false) return;
-		fprintf(mFile,"\tsetAttr \".fae\" %i;\n", fae);
+		writeInt(mFile,"\tsetAttr \".fae\" ",fae,";\n");
 	}
 	void getOutUvCoord()const
 	{
-		fprintf(mFile,"\"%s.ouv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv\"");
 	}
 	void getOutUCoord()const
 	{
-		fprintf(mFile,"\"%s.ouv.ouc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv.ouc\"");
 	}
 	void getOutVCoord()const
 	{
-		fprintf(mFile,"\"%s.ouv.ovc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv.ovc\"");
 	}
 	void getParticleAge()const
 	{
-		fprintf(mFile,"\"%s.pa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa\"");
 	}
 	void getParticleLifespan()const
 	{
-		fprintf(mFile,"\"%s.pls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pls\"");
 	}
 	void getRelativeAge()const
 	{
-		fprintf(mFile,"\"%s.rea\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rea\"");
 	}
 	void getTimeScale()const
 	{
-		fprintf(mFile,"\"%s.ts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ts\"");
 	}
 	void getFoldAtEnd()const
 	{
-		fprintf(mFile,"\"%s.fae\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fae\"");
 	}
 protected:
 	ParticleAgeMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
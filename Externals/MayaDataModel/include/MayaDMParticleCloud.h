@@ -26,573 +26,573 @@ public:
 
 	void setColor(const float3& c)
 	{
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".c.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.58824) return;
-		fprintf(mFile,"\tsetAttr \".c.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".c.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.644) return;
-		fprintf(mFile,"\tsetAttr \".c.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".c.cb\" ",cb,";\n");
 	}
 	void setTransparency(const float3& t)
 	{
-		fprintf(mFile,"\tsetAttr \".t\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"float3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparencyR(float tr)
 	{
 		if(tr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".t.tr\" %f;\n", tr);
+		writeFloat(mFile,"\tsetAttr \".t.tr\" ",tr,";\n");
 	}
 	void setTransparencyG(float tg)
 	{
 		if(tg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".t.tg\" %f;\n", tg);
+		writeFloat(mFile,"\tsetAttr \".t.tg\" ",tg,";\n");
 	}
 	void setTransparencyB(float tb)
 	{
 		if(tb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".t.tb\" %f;\n", tb);
+		writeFloat(mFile,"\tsetAttr \".t.tb\" ",tb,";\n");
 	}
 	void setIncandescence(const float3& i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".i\" -type \"float3\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescenceR(float ir)
 	{
 		if(ir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ir\" %f;\n", ir);
+		writeFloat(mFile,"\tsetAttr \".i.ir\" ",ir,";\n");
 	}
 	void setIncandescenceG(float ig)
 	{
 		if(ig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ig\" %f;\n", ig);
+		writeFloat(mFile,"\tsetAttr \".i.ig\" ",ig,";\n");
 	}
 	void setIncandescenceB(float ib)
 	{
 		if(ib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ib\" %f;\n", ib);
+		writeFloat(mFile,"\tsetAttr \".i.ib\" ",ib,";\n");
 	}
 	void setDensity(float d)
 	{
 		if(d == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setGlowIntensity(float gi)
 	{
 		if(gi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %f;\n", gi);
+		writeFloat(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void setNoise(float n)
 	{
 		if(n == 0.75) return;
-		fprintf(mFile,"\tsetAttr \".n\" %f;\n", n);
+		writeFloat(mFile,"\tsetAttr \".n\" ",n,";\n");
 	}
 	void setNoiseFreq(float nf)
 	{
 		if(nf == 0.15) return;
-		fprintf(mFile,"\tsetAttr \".nf\" %f;\n", nf);
+		writeFloat(mFile,"\tsetAttr \".nf\" ",nf,";\n");
 	}
 	void setNoiseAspect(float na)
 	{
 		if(na == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".na\" %f;\n", na);
+		writeFloat(mFile,"\tsetAttr \".na\" ",na,";\n");
 	}
 	void setBlobMap(const float3& m)
 	{
-		fprintf(mFile,"\tsetAttr \".m\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".m\" -type \"float3\" ");
 		m.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBlobMapR(float mr)
 	{
 		if(mr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".m.mr\" %f;\n", mr);
+		writeFloat(mFile,"\tsetAttr \".m.mr\" ",mr,";\n");
 	}
 	void setBlobMapG(float mg)
 	{
 		if(mg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".m.mg\" %f;\n", mg);
+		writeFloat(mFile,"\tsetAttr \".m.mg\" ",mg,";\n");
 	}
 	void setBlobMapB(float mb)
 	{
 		if(mb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".m.mb\" %f;\n", mb);
+		writeFloat(mFile,"\tsetAttr \".m.mb\" ",mb,";\n");
 	}
 	void setTranslucenceCoeff(float tc)
 	{
 		if(tc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tc\" %f;\n", tc);
+		writeFloat(mFile,"\tsetAttr \".tc\" ",tc,";\n");
 	}
 	void setDiffuseCoeff(float dc)
 	{
 		if(dc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %f;\n", dc);
+		writeFloat(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void setSurfaceShadingShadow(bool sss)
 	{
 		if(sss == false) return;
-		fprintf(mFile,"\tsetAttr \".sss\" %i;\n", sss);
+		writeInt(mFile,"\tsetAttr \".sss\" ",sss,";\n");
 	}
 	void setSurfaceColor(const float3& sc)
 	{
-		fprintf(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSurfaceColorR(float scr)
 	{
 		if(scr == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".sc.scr\" %f;\n", scr);
+		writeFloat(mFile,"\tsetAttr \".sc.scr\" ",scr,";\n");
 	}
 	void setSurfaceColorG(float scg)
 	{
 		if(scg == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".sc.scg\" %f;\n", scg);
+		writeFloat(mFile,"\tsetAttr \".sc.scg\" ",scg,";\n");
 	}
 	void setSurfaceColorB(float scb)
 	{
 		if(scb == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".sc.scb\" %f;\n", scb);
+		writeFloat(mFile,"\tsetAttr \".sc.scb\" ",scb,";\n");
 	}
 	void setSolidCoreSize(float scs)
 	{
 		if(scs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".scs\" %f;\n", scs);
+		writeFloat(mFile,"\tsetAttr \".scs\" ",scs,";\n");
 	}
 	void setTranslucence(float trsl)
 	{
 		if(trsl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".trsl\" %f;\n", trsl);
+		writeFloat(mFile,"\tsetAttr \".trsl\" ",trsl,";\n");
 	}
 	void setNoiseAnimRate(float nanr)
 	{
 		if(nanr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nanr\" %f;\n", nanr);
+		writeFloat(mFile,"\tsetAttr \".nanr\" ",nanr,";\n");
 	}
 	void setRoundness(float rdns)
 	{
 		if(rdns == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rdns\" %f;\n", rdns);
+		writeFloat(mFile,"\tsetAttr \".rdns\" ",rdns,";\n");
 	}
 	void setFilterRadius(float flrs)
 	{
 		if(flrs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".flrs\" %f;\n", flrs);
+		writeFloat(mFile,"\tsetAttr \".flrs\" ",flrs,";\n");
 	}
 	void setRenderState(int rdst)
 	{
 		if(rdst == 0) return;
-		fprintf(mFile,"\tsetAttr \".rdst\" %i;\n", rdst);
+		writeInt(mFile,"\tsetAttr \".rdst\" ",rdst,";\n");
 	}
 	void getOutParticleEmission()const
 	{
-		fprintf(mFile,"\"%s.oe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oe\"");
 	}
 	void getOutParticleEmissionR()const
 	{
-		fprintf(mFile,"\"%s.oe.oer\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oe.oer\"");
 	}
 	void getOutParticleEmissionG()const
 	{
-		fprintf(mFile,"\"%s.oe.oeg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oe.oeg\"");
 	}
 	void getOutParticleEmissionB()const
 	{
-		fprintf(mFile,"\"%s.oe.oeb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oe.oeb\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oi.oir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi.oir\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oi.oig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi.oig\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oi.oib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi.oib\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogi\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogi.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogi.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogi.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogi.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogi.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogi.ogb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.c.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.c.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.c.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cb\"");
 	}
 	void getTransparency()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.t.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tr\"");
 	}
 	void getTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.t.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tg\"");
 	}
 	void getTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.t.tb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tb\"");
 	}
 	void getIncandescence()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getIncandescenceR()const
 	{
-		fprintf(mFile,"\"%s.i.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ir\"");
 	}
 	void getIncandescenceG()const
 	{
-		fprintf(mFile,"\"%s.i.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ig\"");
 	}
 	void getIncandescenceB()const
 	{
-		fprintf(mFile,"\"%s.i.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ib\"");
 	}
 	void getDensity()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getGlowIntensity()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 	void getNoise()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.nf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nf\"");
 	}
 	void getNoiseAspect()const
 	{
-		fprintf(mFile,"\"%s.na\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".na\"");
 	}
 	void getParticleWeight()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getParticleEmission()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 	void getParticleEmissionR()const
 	{
-		fprintf(mFile,"\"%s.e.er\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e.er\"");
 	}
 	void getParticleEmissionG()const
 	{
-		fprintf(mFile,"\"%s.e.eg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e.eg\"");
 	}
 	void getParticleEmissionB()const
 	{
-		fprintf(mFile,"\"%s.e.eb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e.eb\"");
 	}
 	void getBlobMap()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getBlobMapR()const
 	{
-		fprintf(mFile,"\"%s.m.mr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.mr\"");
 	}
 	void getBlobMapG()const
 	{
-		fprintf(mFile,"\"%s.m.mg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.mg\"");
 	}
 	void getBlobMapB()const
 	{
-		fprintf(mFile,"\"%s.m.mb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.mb\"");
 	}
 	void getLightDataArray(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i]\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"]\"");
 	}
 	void getLightDataArray()const
 	{
 
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld\"");
 	}
 	void getLightDirection()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldx\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldx\"");
 	}
 	void getLightDirectionX()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldy\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldy\"");
 	}
 	void getLightDirectionY()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldz\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldz\"");
 	}
 	void getLightDirectionZ()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li\"");
 	}
 	void getLightIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lir\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lir\"");
 	}
 	void getLightIntensityR()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lig\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lig\"");
 	}
 	void getLightIntensityG()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lib\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lib\"");
 	}
 	void getLightIntensityB()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].la\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].la\"");
 	}
 	void getLightAmbient()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ldf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ldf\"");
 	}
 	void getLightDiffuse()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ls\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ls\"");
 	}
 	void getLightSpecular()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lsf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lsf\"");
 	}
 	void getLightShadowFraction()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].psi\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].psi\"");
 	}
 	void getPreShadowIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lbd\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lbd\"");
 	}
 	void getLightBlindData()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbd\"");
 	}
 	void getPointObj()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointObjX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointObjY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.nc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nc\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.nc.ncx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nc.ncx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.nc.ncy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nc.ncy\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.nc.ncz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nc.ncz\"");
 	}
 	void getTranslucenceCoeff()const
 	{
-		fprintf(mFile,"\"%s.tc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc\"");
 	}
 	void getDiffuseCoeff()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getSurfaceShadingShadow()const
 	{
-		fprintf(mFile,"\"%s.sss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sss\"");
 	}
 	void getSurfaceColor()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getSurfaceColorR()const
 	{
-		fprintf(mFile,"\"%s.sc.scr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scr\"");
 	}
 	void getSurfaceColorG()const
 	{
-		fprintf(mFile,"\"%s.sc.scg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scg\"");
 	}
 	void getSurfaceColorB()const
 	{
-		fprintf(mFile,"\"%s.sc.scb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scb\"");
 	}
 	void getSolidCoreSize()const
 	{
-		fprintf(mFile,"\"%s.scs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scs\"");
 	}
 	void getTranslucence()const
 	{
-		fprintf(mFile,"\"%s.trsl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trsl\"");
 	}
 	void getNoiseAnimRate()const
 	{
-		fprintf(mFile,"\"%s.nanr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nanr\"");
 	}
 	void getRoundness()const
 	{
-		fprintf(mFile,"\"%s.rdns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdns\"");
 	}
 	void getRayDepth()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 	void getParticleOrder()const
 	{
-		fprintf(mFile,"\"%s.podr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".podr\"");
 	}
 	void getFilterRadius()const
 	{
-		fprintf(mFile,"\"%s.flrs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flrs\"");
 	}
 	void getRenderState()const
 	{
-		fprintf(mFile,"\"%s.rdst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdst\"");
 	}
 protected:
 	ParticleCloud(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
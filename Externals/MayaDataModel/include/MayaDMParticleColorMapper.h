@@ -26,40 +26,40 @@ public:
 
 	void setParticleColor(const float3& pc)
 	{
-		fprintf(mFile,"\tsetAttr \".pc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pc\" -type \"float3\" ");
 		pc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParticleColorR(float pcr)
 	{
 		if(pcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcr\" %f;\n", pcr);
+		writeFloat(mFile,"\tsetAttr \".pc.pcr\" ",pcr,";\n");
 	}
 	void setParticleColorG(float pcg)
 	{
 		if(pcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcg\" %f;\n", pcg);
+		writeFloat(mFile,"\tsetAttr \".pc.pcg\" ",pcg,";\n");
 	}
 	void setParticleColorB(float pcb)
 	{
 		if(pcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcb\" %f;\n", pcb);
+		writeFloat(mFile,"\tsetAttr \".pc.pcb\" ",pcb,";\n");
 	}
 	void getParticleColor()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getParticleColorR()const
 	{
-		fprintf(mFile,"\"%s.pc.pcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcr\"");
 	}
 	void getParticleColorG()const
 	{
-		fprintf(mFile,"\"%s.pc.pcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcg\"");
 	}
 	void getParticleColorB()const
 	{
-		fprintf(mFile,"\"%s.pc.pcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcb\"");
 	}
 protected:
 	ParticleColorMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
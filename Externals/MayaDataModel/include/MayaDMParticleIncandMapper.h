@@ -26,40 +26,40 @@ public:
 
 	void setParticleIncandescence(const float3& pi)
 	{
-		fprintf(mFile,"\tsetAttr \".pi\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pi\" -type \"float3\" ");
 		pi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParticleIncandescenceR(float pir)
 	{
 		if(pir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pi.pir\" %f;\n", pir);
+		writeFloat(mFile,"\tsetAttr \".pi.pir\" ",pir,";\n");
 	}
 	void setParticleIncandescenceG(float pig)
 	{
 		if(pig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pi.pig\" %f;\n", pig);
+		writeFloat(mFile,"\tsetAttr \".pi.pig\" ",pig,";\n");
 	}
 	void setParticleIncandescenceB(float pib)
 	{
 		if(pib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pi.pib\" %f;\n", pib);
+		writeFloat(mFile,"\tsetAttr \".pi.pib\" ",pib,";\n");
 	}
 	void getParticleIncandescence()const
 	{
-		fprintf(mFile,"\"%s.pi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi\"");
 	}
 	void getParticleIncandescenceR()const
 	{
-		fprintf(mFile,"\"%s.pi.pir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi.pir\"");
 	}
 	void getParticleIncandescenceG()const
 	{
-		fprintf(mFile,"\"%s.pi.pig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi.pig\"");
 	}
 	void getParticleIncandescenceB()const
 	{
-		fprintf(mFile,"\"%s.pi.pib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi.pib\"");
 	}
 protected:
 	ParticleIncandMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,514 +27,514 @@ public:
 	void setOutUvType(unsigned int ouvt)
 	{
 		if(ouvt == 0) return;
-		fprintf(mFile,"\tsetAttr \".ouvt\" %i;\n", ouvt);
+		writeInt(mFile,"\tsetAttr \".ouvt\" ",ouvt,";\n");
 	}
 	void setNormalizationValue(float nlv)
 	{
 		if(nlv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nlv\" %f;\n", nlv);
+		writeFloat(mFile,"\tsetAttr \".nlv\" ",nlv,";\n");
 	}
 	void setNormalizationMethod(unsigned int nlm)
 	{
 		if(nlm == 0) return;
-		fprintf(mFile,"\tsetAttr \".nlm\" %i;\n", nlm);
+		writeInt(mFile,"\tsetAttr \".nlm\" ",nlm,";\n");
 	}
 	void setInverseOutUv(bool iouv)
 	{
 		if(iouv == false) return;
-		fprintf(mFile,"\tsetAttr \".iouv\" %i;\n", iouv);
+		writeInt(mFile,"\tsetAttr \".iouv\" ",iouv,";\n");
 	}
 	void getParticleAttrArray()const
 	{
-		fprintf(mFile,"\"%s.paa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".paa\"");
 	}
 	void getParticleOrder()const
 	{
-		fprintf(mFile,"\"%s.podr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".podr\"");
 	}
 	void getObjectType()const
 	{
-		fprintf(mFile,"\"%s.otyp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otyp\"");
 	}
 	void getParticleColor()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getParticleColorR()const
 	{
-		fprintf(mFile,"\"%s.pc.pcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcr\"");
 	}
 	void getParticleColorG()const
 	{
-		fprintf(mFile,"\"%s.pc.pcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcg\"");
 	}
 	void getParticleColorB()const
 	{
-		fprintf(mFile,"\"%s.pc.pcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcb\"");
 	}
 	void getParticleTransparency()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getParticleTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.pt.ptr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.ptr\"");
 	}
 	void getParticleTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.pt.ptg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.ptg\"");
 	}
 	void getParticleTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.pt.ptb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.ptb\"");
 	}
 	void getParticleIncandescence()const
 	{
-		fprintf(mFile,"\"%s.pi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi\"");
 	}
 	void getParticleIncandescenceR()const
 	{
-		fprintf(mFile,"\"%s.pi.pir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi.pir\"");
 	}
 	void getParticleIncandescenceG()const
 	{
-		fprintf(mFile,"\"%s.pi.pig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi.pig\"");
 	}
 	void getParticleIncandescenceB()const
 	{
-		fprintf(mFile,"\"%s.pi.pib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi.pib\"");
 	}
 	void getParticleAge()const
 	{
-		fprintf(mFile,"\"%s.pa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa\"");
 	}
 	void getParticleLifespan()const
 	{
-		fprintf(mFile,"\"%s.pls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pls\"");
 	}
 	void getOutUvCoord()const
 	{
-		fprintf(mFile,"\"%s.ouv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv\"");
 	}
 	void getOutUCoord()const
 	{
-		fprintf(mFile,"\"%s.ouv.ouc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv.ouc\"");
 	}
 	void getOutVCoord()const
 	{
-		fprintf(mFile,"\"%s.ouv.ovc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv.ovc\"");
 	}
 	void getOutUvType()const
 	{
-		fprintf(mFile,"\"%s.ouvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouvt\"");
 	}
 	void getNormalizationValue()const
 	{
-		fprintf(mFile,"\"%s.nlv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nlv\"");
 	}
 	void getNormalizationMethod()const
 	{
-		fprintf(mFile,"\"%s.nlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nlm\"");
 	}
 	void getInverseOutUv()const
 	{
-		fprintf(mFile,"\"%s.iouv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iouv\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutIncandescence()const
 	{
-		fprintf(mFile,"\"%s.oi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi\"");
 	}
 	void getOutIncandescenceR()const
 	{
-		fprintf(mFile,"\"%s.oi.oicr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi.oicr\"");
 	}
 	void getOutIncandescenceG()const
 	{
-		fprintf(mFile,"\"%s.oi.oicg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi.oicg\"");
 	}
 	void getOutIncandescenceB()const
 	{
-		fprintf(mFile,"\"%s.oi.oicb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi.oicb\"");
 	}
 	void getFinalLifespanPP()const
 	{
-		fprintf(mFile,"\"%s.flp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".flp\"");
 	}
 	void getAgeNormalized()const
 	{
-		fprintf(mFile,"\"%s.anl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".anl\"");
 	}
 	void getParticleId()const
 	{
-		fprintf(mFile,"\"%s.pid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pid\"");
 	}
 	void getAge()const
 	{
-		fprintf(mFile,"\"%s.ag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ag\"");
 	}
 	void getLifespan()const
 	{
-		fprintf(mFile,"\"%s.lsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsp\"");
 	}
 	void getLifespanPP()const
 	{
-		fprintf(mFile,"\"%s.lpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lpp\"");
 	}
 	void getAcceleration()const
 	{
-		fprintf(mFile,"\"%s.acc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acc\"");
 	}
 	void getAccelerationX()const
 	{
-		fprintf(mFile,"\"%s.acc.accx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acc.accx\"");
 	}
 	void getAccelerationY()const
 	{
-		fprintf(mFile,"\"%s.acc.accy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acc.accy\"");
 	}
 	void getAccelerationZ()const
 	{
-		fprintf(mFile,"\"%s.acc.accz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acc.accz\"");
 	}
 	void getBirthTime()const
 	{
-		fprintf(mFile,"\"%s.bt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bt\"");
 	}
 	void getForce()const
 	{
-		fprintf(mFile,"\"%s.frc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frc\"");
 	}
 	void getForceX()const
 	{
-		fprintf(mFile,"\"%s.frc.frx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frc.frx\"");
 	}
 	void getForceY()const
 	{
-		fprintf(mFile,"\"%s.frc.fry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frc.fry\"");
 	}
 	void getForceZ()const
 	{
-		fprintf(mFile,"\"%s.frc.frz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frc.frz\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.pos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.pos.posx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos.posx\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.pos.posy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos.posy\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.pos.posz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos.posz\"");
 	}
 	void getBirthPosition()const
 	{
-		fprintf(mFile,"\"%s.bpos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bpos\"");
 	}
 	void getBirthPositionX()const
 	{
-		fprintf(mFile,"\"%s.bpos.bpox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bpos.bpox\"");
 	}
 	void getBirthPositionY()const
 	{
-		fprintf(mFile,"\"%s.bpos.bpoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bpos.bpoy\"");
 	}
 	void getBirthPositionZ()const
 	{
-		fprintf(mFile,"\"%s.bpos.bpoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bpos.bpoz\"");
 	}
 	void getBirthWorldPosition()const
 	{
-		fprintf(mFile,"\"%s.bwpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwpo\"");
 	}
 	void getBirthWorldPositionX()const
 	{
-		fprintf(mFile,"\"%s.bwpo.bwpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwpo.bwpx\"");
 	}
 	void getBirthWorldPositionY()const
 	{
-		fprintf(mFile,"\"%s.bwpo.bwpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwpo.bwpy\"");
 	}
 	void getBirthWorldPositionZ()const
 	{
-		fprintf(mFile,"\"%s.bwpo.bwpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwpo.bwpz\"");
 	}
 	void getVelocity()const
 	{
-		fprintf(mFile,"\"%s.vel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel\"");
 	}
 	void getVelocityX()const
 	{
-		fprintf(mFile,"\"%s.vel.velx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.velx\"");
 	}
 	void getVelocityY()const
 	{
-		fprintf(mFile,"\"%s.vel.vely\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.vely\"");
 	}
 	void getVelocityZ()const
 	{
-		fprintf(mFile,"\"%s.vel.velz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.velz\"");
 	}
 	void getWorldPosition()const
 	{
-		fprintf(mFile,"\"%s.wps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wps\"");
 	}
 	void getWorldPositionX()const
 	{
-		fprintf(mFile,"\"%s.wps.wpsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wps.wpsx\"");
 	}
 	void getWorldPositionY()const
 	{
-		fprintf(mFile,"\"%s.wps.wpsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wps.wpsy\"");
 	}
 	void getWorldPositionZ()const
 	{
-		fprintf(mFile,"\"%s.wps.wpsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wps.wpsz\"");
 	}
 	void getWorldVelocity()const
 	{
-		fprintf(mFile,"\"%s.wvl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wvl\"");
 	}
 	void getWorldVelocityX()const
 	{
-		fprintf(mFile,"\"%s.wvl.wvlx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wvl.wvlx\"");
 	}
 	void getWorldVelocityY()const
 	{
-		fprintf(mFile,"\"%s.wvl.wvly\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wvl.wvly\"");
 	}
 	void getWorldVelocityZ()const
 	{
-		fprintf(mFile,"\"%s.wvl.wvlz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wvl.wvlz\"");
 	}
 	void getParentU()const
 	{
-		fprintf(mFile,"\"%s.pau\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pau\"");
 	}
 	void getParentV()const
 	{
-		fprintf(mFile,"\"%s.pav\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pav\"");
 	}
 	void getCollisionU()const
 	{
-		fprintf(mFile,"\"%s.clu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clu\"");
 	}
 	void getCollisionV()const
 	{
-		fprintf(mFile,"\"%s.clv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clv\"");
 	}
 	void getColorRed()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getColorGreen()const
 	{
-		fprintf(mFile,"\"%s.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg\"");
 	}
 	void getColorBlue()const
 	{
-		fprintf(mFile,"\"%s.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cb\"");
 	}
 	void getRgbPP()const
 	{
-		fprintf(mFile,"\"%s.rgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rgb\"");
 	}
 	void getRPP()const
 	{
-		fprintf(mFile,"\"%s.rgb.rpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rgb.rpp\"");
 	}
 	void getGPP()const
 	{
-		fprintf(mFile,"\"%s.rgb.gpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rgb.gpp\"");
 	}
 	void getBPP()const
 	{
-		fprintf(mFile,"\"%s.rgb.bpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rgb.bpp\"");
 	}
 	void getIncandescencePP()const
 	{
-		fprintf(mFile,"\"%s.oipp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oipp\"");
 	}
 	void getIncandescencePPR()const
 	{
-		fprintf(mFile,"\"%s.oipp.ippr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oipp.ippr\"");
 	}
 	void getIncandescencePPG()const
 	{
-		fprintf(mFile,"\"%s.oipp.ippg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oipp.ippg\"");
 	}
 	void getIncandescencePPB()const
 	{
-		fprintf(mFile,"\"%s.oipp.ippb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oipp.ippb\"");
 	}
 	void getIncandescence()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getIncandescenceR()const
 	{
-		fprintf(mFile,"\"%s.in.inr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in.inr\"");
 	}
 	void getIncandescenceG()const
 	{
-		fprintf(mFile,"\"%s.in.ing\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in.ing\"");
 	}
 	void getIncandescenceB()const
 	{
-		fprintf(mFile,"\"%s.in.inb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in.inb\"");
 	}
 	void getOpacity()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getOpacityPP()const
 	{
-		fprintf(mFile,"\"%s.opp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opp\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.rds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rds\"");
 	}
 	void getRadiusPP()const
 	{
-		fprintf(mFile,"\"%s.rdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdp\"");
 	}
 	void getUserScalar1PP()const
 	{
-		fprintf(mFile,"\"%s.uds1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uds1\"");
 	}
 	void getUserScalar2PP()const
 	{
-		fprintf(mFile,"\"%s.uds2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uds2\"");
 	}
 	void getUserScalar3PP()const
 	{
-		fprintf(mFile,"\"%s.uds3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uds3\"");
 	}
 	void getUserScalar4PP()const
 	{
-		fprintf(mFile,"\"%s.uds4\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uds4\"");
 	}
 	void getUserScalar5PP()const
 	{
-		fprintf(mFile,"\"%s.uds5\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uds5\"");
 	}
 	void getUserVector1PP()const
 	{
-		fprintf(mFile,"\"%s.udv1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv1\"");
 	}
 	void getUserVector1PPX()const
 	{
-		fprintf(mFile,"\"%s.udv1.uv1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv1.uv1x\"");
 	}
 	void getUserVector1PPY()const
 	{
-		fprintf(mFile,"\"%s.udv1.uv1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv1.uv1y\"");
 	}
 	void getUserVector1PPZ()const
 	{
-		fprintf(mFile,"\"%s.udv1.uv1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv1.uv1z\"");
 	}
 	void getUserVector2PP()const
 	{
-		fprintf(mFile,"\"%s.udv2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv2\"");
 	}
 	void getUserVector2PPX()const
 	{
-		fprintf(mFile,"\"%s.udv2.uv2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv2.uv2x\"");
 	}
 	void getUserVector2PPY()const
 	{
-		fprintf(mFile,"\"%s.udv2.uv2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv2.uv2y\"");
 	}
 	void getUserVector2PPZ()const
 	{
-		fprintf(mFile,"\"%s.udv2.uv2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv2.uv2z\"");
 	}
 	void getUserVector3PP()const
 	{
-		fprintf(mFile,"\"%s.udv3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv3\"");
 	}
 	void getUserVector3PPX()const
 	{
-		fprintf(mFile,"\"%s.udv3.uv3x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv3.uv3x\"");
 	}
 	void getUserVector3PPY()const
 	{
-		fprintf(mFile,"\"%s.udv3.uv3y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv3.uv3y\"");
 	}
 	void getUserVector3PPZ()const
 	{
-		fprintf(mFile,"\"%s.udv3.uv3z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv3.uv3z\"");
 	}
 	void getUserVector4PP()const
 	{
-		fprintf(mFile,"\"%s.udv4\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv4\"");
 	}
 	void getUserVector4PPX()const
 	{
-		fprintf(mFile,"\"%s.udv4.uv4x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv4.uv4x\"");
 	}
 	void getUserVector4PPY()const
 	{
-		fprintf(mFile,"\"%s.udv4.uv4y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv4.uv4y\"");
 	}
 	void getUserVector4PPZ()const
 	{
-		fprintf(mFile,"\"%s.udv4.uv4z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv4.uv4z\"");
 	}
 	void getUserVector5PP()const
 	{
-		fprintf(mFile,"\"%s.udv5\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv5\"");
 	}
 	void getUserVector5PPX()const
 	{
-		fprintf(mFile,"\"%s.udv5.uv5x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv5.uv5x\"");
 	}
 	void getUserVector5PPY()const
 	{
-		fprintf(mFile,"\"%s.udv5.uv5y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv5.uv5y\"");
 	}
 	void getUserVector5PPZ()const
 	{
-		fprintf(mFile,"\"%s.udv5.uv5z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udv5.uv5z\"");
 	}
 protected:
 	ParticleSamplerInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,40 +26,40 @@ public:
 
 	void setParticleTransparency(const float3& pt)
 	{
-		fprintf(mFile,"\tsetAttr \".pt\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pt\" -type \"float3\" ");
 		pt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParticleTransparencyR(float ptr)
 	{
 		if(ptr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pt.ptr\" %f;\n", ptr);
+		writeFloat(mFile,"\tsetAttr \".pt.ptr\" ",ptr,";\n");
 	}
 	void setParticleTransparencyG(float ptg)
 	{
 		if(ptg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pt.ptg\" %f;\n", ptg);
+		writeFloat(mFile,"\tsetAttr \".pt.ptg\" ",ptg,";\n");
 	}
 	void setParticleTransparencyB(float ptb)
 	{
 		if(ptb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pt.ptb\" %f;\n", ptb);
+		writeFloat(mFile,"\tsetAttr \".pt.ptb\" ",ptb,";\n");
 	}
 	void getParticleTransparency()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getParticleTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.pt.ptr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.ptr\"");
 	}
 	void getParticleTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.pt.ptg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.ptg\"");
 	}
 	void getParticleTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.pt.ptb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt.ptb\"");
 	}
 protected:
 	ParticleTranspMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
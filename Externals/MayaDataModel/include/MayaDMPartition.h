@@ -27,27 +27,27 @@ public:
 	void setAnnotation(const string& an)
 	{
 		if(an == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".an\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".an\" -type \"string\" ");
 		an.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPartitionType(unsigned int pt)
 	{
 		if(pt == 0) return;
-		fprintf(mFile,"\tsetAttr \".pt\" %i;\n", pt);
+		writeInt(mFile,"\tsetAttr \".pt\" ",pt,";\n");
 	}
 	void getSets(size_t st_i)const
 	{
-		fprintf(mFile,"\"%s.st[%i]\"",mName.c_str(),st_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".st[",st_i,"]\"");
 	}
 	void getSets()const
 	{
 
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getEnvironment()const
 	{
-		fprintf(mFile,"\"%s.envr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".envr\"");
 	}
 protected:
 	Partition(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
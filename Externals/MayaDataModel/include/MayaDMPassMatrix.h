@@ -27,26 +27,26 @@ public:
 	void setInMatrix(const matrix& i_)
 	{
 		if(i_ == identity) return;
-		fprintf(mFile,"\tsetAttr \".i\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".i\" -type \"matrix\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInScale(double s)
 	{
 		if(s == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void getInMatrix()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInScale()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getOutMatrix()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	PassMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,319 +27,319 @@ public:
 	void setDisplayPercent(double dpc)
 	{
 		if(dpc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dpc\" %f;\n", dpc);
+		writeFloat(mFile,"\tsetAttr \".dpc\" ",dpc,";\n");
 	}
 	void setDrawAsMesh(bool dam)
 	{
 		if(dam == 1) return;
-		fprintf(mFile,"\tsetAttr \".dam\" %i;\n", dam);
+		writeInt(mFile,"\tsetAttr \".dam\" ",dam,";\n");
 	}
 	void setSeed(int sed)
 	{
 		if(sed == 0) return;
-		fprintf(mFile,"\tsetAttr \".sed\" %i;\n", sed);
+		writeInt(mFile,"\tsetAttr \".sed\" ",sed,";\n");
 	}
 	void setDrawOrder(int dro)
 	{
 		if(dro == 0) return;
-		fprintf(mFile,"\tsetAttr \".dro\" %i;\n", dro);
+		writeInt(mFile,"\tsetAttr \".dro\" ",dro,";\n");
 	}
 	void setSurfaceOffset(double sof)
 	{
 		if(sof == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sof\" %f;\n", sof);
+		writeFloat(mFile,"\tsetAttr \".sof\" ",sof,";\n");
 	}
 	void setMotionBlurred(bool mblr)
 	{
 		if(mblr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mblr\" %i;\n", mblr);
+		writeInt(mFile,"\tsetAttr \".mblr\" ",mblr,";\n");
 	}
 	void setPrimaryVisibility(bool pvs)
 	{
 		if(pvs == 1) return;
-		fprintf(mFile,"\tsetAttr \".pvs\" %i;\n", pvs);
+		writeInt(mFile,"\tsetAttr \".pvs\" ",pvs,";\n");
 	}
 	void setMainVertBufSize(int mvbs)
 	{
 		if(mvbs == 0) return;
-		fprintf(mFile,"\tsetAttr \".mvbs\" %i;\n", mvbs);
+		writeInt(mFile,"\tsetAttr \".mvbs\" ",mvbs,";\n");
 	}
 	void setFlowerVertBufSize(int fvbs)
 	{
 		if(fvbs == 0) return;
-		fprintf(mFile,"\tsetAttr \".fvbs\" %i;\n", fvbs);
+		writeInt(mFile,"\tsetAttr \".fvbs\" ",fvbs,";\n");
 	}
 	void setLeafVertBufSize(int lvbs)
 	{
 		if(lvbs == 0) return;
-		fprintf(mFile,"\tsetAttr \".lvbs\" %i;\n", lvbs);
+		writeInt(mFile,"\tsetAttr \".lvbs\" ",lvbs,";\n");
 	}
 	void setMeshPolyLimit(int mpl)
 	{
 		if(mpl == 0) return;
-		fprintf(mFile,"\tsetAttr \".mpl\" %i;\n", mpl);
+		writeInt(mFile,"\tsetAttr \".mpl\" ",mpl,";\n");
 	}
 	void setMeshVertexColorMode(unsigned int mvc)
 	{
 		if(mvc == 0) return;
-		fprintf(mFile,"\tsetAttr \".mvc\" %i;\n", mvc);
+		writeInt(mFile,"\tsetAttr \".mvc\" ",mvc,";\n");
 	}
 	void setMeshHardEdges(bool mhe)
 	{
 		if(mhe == false) return;
-		fprintf(mFile,"\tsetAttr \".mhe\" %i;\n", mhe);
+		writeInt(mFile,"\tsetAttr \".mhe\" ",mhe,";\n");
 	}
 	void setMeshQuadOutput(bool mqo)
 	{
 		if(mqo == false) return;
-		fprintf(mFile,"\tsetAttr \".mqo\" %i;\n", mqo);
+		writeInt(mFile,"\tsetAttr \".mqo\" ",mqo,";\n");
 	}
 	void setCameraPoint(const double3& cpt)
 	{
-		fprintf(mFile,"\tsetAttr \".cpt\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".cpt\" -type \"double3\" ");
 		cpt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCameraPointX(double cpx)
 	{
 		if(cpx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cpt.cpx\" %f;\n", cpx);
+		writeFloat(mFile,"\tsetAttr \".cpt.cpx\" ",cpx,";\n");
 	}
 	void setCameraPointY(double cpy)
 	{
 		if(cpy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cpt.cpy\" %f;\n", cpy);
+		writeFloat(mFile,"\tsetAttr \".cpt.cpy\" ",cpy,";\n");
 	}
 	void setCameraPointZ(double cpz)
 	{
 		if(cpz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cpt.cpz\" %f;\n", cpz);
+		writeFloat(mFile,"\tsetAttr \".cpt.cpz\" ",cpz,";\n");
 	}
 	void setMaxDrawSegments(int mdsg)
 	{
 		if(mdsg == 1000000) return;
-		fprintf(mFile,"\tsetAttr \".mdsg\" %i;\n", mdsg);
+		writeInt(mFile,"\tsetAttr \".mdsg\" ",mdsg,";\n");
 	}
 	void setCurveMode(int cmd)
 	{
 		if(cmd == 0) return;
-		fprintf(mFile,"\tsetAttr \".cmd\" %i;\n", cmd);
+		writeInt(mFile,"\tsetAttr \".cmd\" ",cmd,";\n");
 	}
 	void setLeafCurveMode(int lcm)
 	{
 		if(lcm == 0) return;
-		fprintf(mFile,"\tsetAttr \".lcm\" %i;\n", lcm);
+		writeInt(mFile,"\tsetAttr \".lcm\" ",lcm,";\n");
 	}
 	void setFlowerCurveMode(int fcm)
 	{
 		if(fcm == 0) return;
-		fprintf(mFile,"\tsetAttr \".fcm\" %i;\n", fcm);
+		writeInt(mFile,"\tsetAttr \".fcm\" ",fcm,";\n");
 	}
 	void setDegree(int dgr)
 	{
 		if(dgr == 2) return;
-		fprintf(mFile,"\tsetAttr \".dgr\" %i;\n", dgr);
+		writeInt(mFile,"\tsetAttr \".dgr\" ",dgr,";\n");
 	}
 	void setCurveAlign(bool cva)
 	{
 		if(cva == false) return;
-		fprintf(mFile,"\tsetAttr \".cva\" %i;\n", cva);
+		writeInt(mFile,"\tsetAttr \".cva\" ",cva,";\n");
 	}
 	void getDisplayPercent()const
 	{
-		fprintf(mFile,"\"%s.dpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpc\"");
 	}
 	void getDrawAsMesh()const
 	{
-		fprintf(mFile,"\"%s.dam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dam\"");
 	}
 	void getSeed()const
 	{
-		fprintf(mFile,"\"%s.sed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sed\"");
 	}
 	void getDrawOrder()const
 	{
-		fprintf(mFile,"\"%s.dro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dro\"");
 	}
 	void getSurfaceOffset()const
 	{
-		fprintf(mFile,"\"%s.sof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sof\"");
 	}
 	void getBrush()const
 	{
-		fprintf(mFile,"\"%s.brs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".brs\"");
 	}
 	void getMotionBlurred()const
 	{
-		fprintf(mFile,"\"%s.mblr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mblr\"");
 	}
 	void getPrimaryVisibility()const
 	{
-		fprintf(mFile,"\"%s.pvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvs\"");
 	}
 	void getControlCurve(size_t clc_i)const
 	{
-		fprintf(mFile,"\"%s.clc[%i]\"",mName.c_str(),clc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clc[",clc_i,"]\"");
 	}
 	void getControlCurve()const
 	{
 
-		fprintf(mFile,"\"%s.clc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clc\"");
 	}
 	void getOutMainMesh()const
 	{
-		fprintf(mFile,"\"%s.omm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omm\"");
 	}
 	void getOutFlowerMesh()const
 	{
-		fprintf(mFile,"\"%s.ofm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofm\"");
 	}
 	void getOutLeafMesh()const
 	{
-		fprintf(mFile,"\"%s.olm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".olm\"");
 	}
 	void getWorldMainMesh(size_t wmm_i)const
 	{
-		fprintf(mFile,"\"%s.wmm[%i]\"",mName.c_str(),wmm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wmm[",wmm_i,"]\"");
 	}
 	void getWorldMainMesh()const
 	{
 
-		fprintf(mFile,"\"%s.wmm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wmm\"");
 	}
 	void getWorldLeafMesh(size_t wlm_i)const
 	{
-		fprintf(mFile,"\"%s.wlm[%i]\"",mName.c_str(),wlm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wlm[",wlm_i,"]\"");
 	}
 	void getWorldLeafMesh()const
 	{
 
-		fprintf(mFile,"\"%s.wlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wlm\"");
 	}
 	void getWorldFlowerMesh(size_t wfm_i)const
 	{
-		fprintf(mFile,"\"%s.wfm[%i]\"",mName.c_str(),wfm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wfm[",wfm_i,"]\"");
 	}
 	void getWorldFlowerMesh()const
 	{
 
-		fprintf(mFile,"\"%s.wfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wfm\"");
 	}
 	void getMainVertBufSize()const
 	{
-		fprintf(mFile,"\"%s.mvbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mvbs\"");
 	}
 	void getFlowerVertBufSize()const
 	{
-		fprintf(mFile,"\"%s.fvbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fvbs\"");
 	}
 	void getLeafVertBufSize()const
 	{
-		fprintf(mFile,"\"%s.lvbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lvbs\"");
 	}
 	void getMeshPolyLimit()const
 	{
-		fprintf(mFile,"\"%s.mpl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpl\"");
 	}
 	void getMeshVertexColorMode()const
 	{
-		fprintf(mFile,"\"%s.mvc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mvc\"");
 	}
 	void getMeshHardEdges()const
 	{
-		fprintf(mFile,"\"%s.mhe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mhe\"");
 	}
 	void getMeshQuadOutput()const
 	{
-		fprintf(mFile,"\"%s.mqo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mqo\"");
 	}
 	void getCameraPoint()const
 	{
-		fprintf(mFile,"\"%s.cpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpt\"");
 	}
 	void getCameraPointX()const
 	{
-		fprintf(mFile,"\"%s.cpt.cpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpt.cpx\"");
 	}
 	void getCameraPointY()const
 	{
-		fprintf(mFile,"\"%s.cpt.cpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpt.cpy\"");
 	}
 	void getCameraPointZ()const
 	{
-		fprintf(mFile,"\"%s.cpt.cpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpt.cpz\"");
 	}
 	void getLineModifier(size_t lmd_i)const
 	{
-		fprintf(mFile,"\"%s.lmd[%i]\"",mName.c_str(),lmd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lmd[",lmd_i,"]\"");
 	}
 	void getLineModifier()const
 	{
 
-		fprintf(mFile,"\"%s.lmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lmd\"");
 	}
 	void getMaxDrawSegments()const
 	{
-		fprintf(mFile,"\"%s.mdsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mdsg\"");
 	}
 	void getCurveMode()const
 	{
-		fprintf(mFile,"\"%s.cmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmd\"");
 	}
 	void getLeafCurveMode()const
 	{
-		fprintf(mFile,"\"%s.lcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcm\"");
 	}
 	void getFlowerCurveMode()const
 	{
-		fprintf(mFile,"\"%s.fcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcm\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.dgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dgr\"");
 	}
 	void getCurveAlign()const
 	{
-		fprintf(mFile,"\"%s.cva\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cva\"");
 	}
 	void getOutMainCurveCount()const
 	{
-		fprintf(mFile,"\"%s.omcc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omcc\"");
 	}
 	void getOutLeafCurveCount()const
 	{
-		fprintf(mFile,"\"%s.olcc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".olcc\"");
 	}
 	void getOutFlowerCurveCount()const
 	{
-		fprintf(mFile,"\"%s.ofcc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofcc\"");
 	}
 	void getOutMainCurves(size_t omc_i)const
 	{
-		fprintf(mFile,"\"%s.omc[%i]\"",mName.c_str(),omc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".omc[",omc_i,"]\"");
 	}
 	void getOutMainCurves()const
 	{
 
-		fprintf(mFile,"\"%s.omc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omc\"");
 	}
 	void getOutLeafCurves(size_t olc_i)const
 	{
-		fprintf(mFile,"\"%s.olc[%i]\"",mName.c_str(),olc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".olc[",olc_i,"]\"");
 	}
 	void getOutLeafCurves()const
 	{
 
-		fprintf(mFile,"\"%s.olc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".olc\"");
 	}
 	void getOutFlowerCurves(size_t ofc_i)const
 	{
-		fprintf(mFile,"\"%s.ofc[%i]\"",mName.c_str(),ofc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ofc[",ofc_i,"]\"");
 	}
 	void getOutFlowerCurves()const
 	{
 
-		fprintf(mFile,"\"%s.ofc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofc\"");
 	}
 protected:
 	PfxGeometry(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
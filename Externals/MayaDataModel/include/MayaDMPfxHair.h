@@ -26,7 +26,7 @@ public:
 
 	void getRenderHairs()const
 	{
-		fprintf(mFile,"\"%s.rhs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rhs\"");
 	}
 protected:
 	PfxHair(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
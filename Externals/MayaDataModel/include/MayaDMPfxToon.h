@@ -28,9 +28,9 @@ public:
 		unsigned int curvatureWidth_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", curvatureWidth_Position);
-			fprintf(file,"%f ", curvatureWidth_FloatValue);
-			fprintf(file,"%i", curvatureWidth_Interp);
+			writeFloat(file,"",curvatureWidth_Position," ");
+			writeFloat(file,"",curvatureWidth_FloatValue," ");
+			writeInt(file,"",curvatureWidth_Interp);
 		}
 	};
 public:
@@ -43,788 +43,788 @@ public:
 	void setDisplayInViewport(bool div)
 	{
 		if(div == true) return;
-		fprintf(mFile,"\tsetAttr \".div\" %i;\n", div);
+		writeInt(mFile,"\tsetAttr \".div\" ",div,";\n");
 	}
 	void setProfileLines(unsigned int pln)
 	{
 		if(pln == 1) return;
-		fprintf(mFile,"\tsetAttr \".pln\" %i;\n", pln);
+		writeInt(mFile,"\tsetAttr \".pln\" ",pln,";\n");
 	}
 	void setCreaseLines(bool cln)
 	{
 		if(cln == true) return;
-		fprintf(mFile,"\tsetAttr \".cln\" %i;\n", cln);
+		writeInt(mFile,"\tsetAttr \".cln\" ",cln,";\n");
 	}
 	void setBorderLines(unsigned int bln)
 	{
 		if(bln == 1) return;
-		fprintf(mFile,"\tsetAttr \".bln\" %i;\n", bln);
+		writeInt(mFile,"\tsetAttr \".bln\" ",bln,";\n");
 	}
 	void setIntersectionLines(bool iln)
 	{
 		if(iln == false) return;
-		fprintf(mFile,"\tsetAttr \".iln\" %i;\n", iln);
+		writeInt(mFile,"\tsetAttr \".iln\" ",iln,";\n");
 	}
 	void setSelfIntersect(bool sei)
 	{
 		if(sei == false) return;
-		fprintf(mFile,"\tsetAttr \".sei\" %i;\n", sei);
+		writeInt(mFile,"\tsetAttr \".sei\" ",sei,";\n");
 	}
 	void setLineWidth(double lwd)
 	{
 		if(lwd == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".lwd\" %f;\n", lwd);
+		writeFloat(mFile,"\tsetAttr \".lwd\" ",lwd,";\n");
 	}
 	void setLineWidthMap(double lwm)
 	{
 		if(lwm == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".lwm\" %f;\n", lwm);
+		writeFloat(mFile,"\tsetAttr \".lwm\" ",lwm,";\n");
 	}
 	void setLineOpacity(double lop)
 	{
 		if(lop == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lop\" %f;\n", lop);
+		writeFloat(mFile,"\tsetAttr \".lop\" ",lop,";\n");
 	}
 	void setLineOpacityMap(double lpm)
 	{
 		if(lpm == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lpm\" %f;\n", lpm);
+		writeFloat(mFile,"\tsetAttr \".lpm\" ",lpm,";\n");
 	}
 	void setLocalOcclusion(unsigned int lcl)
 	{
 		if(lcl == 0) return;
-		fprintf(mFile,"\tsetAttr \".lcl\" %i;\n", lcl);
+		writeInt(mFile,"\tsetAttr \".lcl\" ",lcl,";\n");
 	}
 	void setOcclusionTolerance(double otl)
 	{
 		if(otl == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".otl\" %f;\n", otl);
+		writeFloat(mFile,"\tsetAttr \".otl\" ",otl,";\n");
 	}
 	void setDepthBias(double dbs)
 	{
 		if(dbs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dbs\" %f;\n", dbs);
+		writeFloat(mFile,"\tsetAttr \".dbs\" ",dbs,";\n");
 	}
 	void setProfileLineWidth(double plw)
 	{
 		if(plw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".plw\" %f;\n", plw);
+		writeFloat(mFile,"\tsetAttr \".plw\" ",plw,";\n");
 	}
 	void setCreaseLineWidth(double clw)
 	{
 		if(clw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".clw\" %f;\n", clw);
+		writeFloat(mFile,"\tsetAttr \".clw\" ",clw,";\n");
 	}
 	void setBorderLineWidth(double blw)
 	{
 		if(blw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".blw\" %f;\n", blw);
+		writeFloat(mFile,"\tsetAttr \".blw\" ",blw,";\n");
 	}
 	void setIntersectionLineWidth(double ilw)
 	{
 		if(ilw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ilw\" %f;\n", ilw);
+		writeFloat(mFile,"\tsetAttr \".ilw\" ",ilw,";\n");
 	}
 	void setLineOffset(double lof)
 	{
 		if(lof == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lof\" %f;\n", lof);
+		writeFloat(mFile,"\tsetAttr \".lof\" ",lof,";\n");
 	}
 	void setLineOffsetMap(double lom)
 	{
 		if(lom == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lom\" %f;\n", lom);
+		writeFloat(mFile,"\tsetAttr \".lom\" ",lom,";\n");
 	}
 	void setLightingBasedWidth(double lbw)
 	{
 		if(lbw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lbw\" %f;\n", lbw);
+		writeFloat(mFile,"\tsetAttr \".lbw\" ",lbw,";\n");
 	}
 	void setOcclusionWidthScale(bool ows)
 	{
 		if(ows == true) return;
-		fprintf(mFile,"\tsetAttr \".ows\" %i;\n", ows);
+		writeInt(mFile,"\tsetAttr \".ows\" ",ows,";\n");
 	}
 	void setDepthOffset(double dff)
 	{
 		if(dff == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dff\" %f;\n", dff);
+		writeFloat(mFile,"\tsetAttr \".dff\" ",dff,";\n");
 	}
 	void setCreaseAngleMin(double amn)
 	{
 		if(amn == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".amn\" %f;\n", amn);
+		writeFloat(mFile,"\tsetAttr \".amn\" ",amn,";\n");
 	}
 	void setCreaseAngleMax(double amx)
 	{
 		if(amx == 90.0) return;
-		fprintf(mFile,"\tsetAttr \".amx\" %f;\n", amx);
+		writeFloat(mFile,"\tsetAttr \".amx\" ",amx,";\n");
 	}
 	void setHardCreasesOnly(bool hco)
 	{
 		if(hco == true) return;
-		fprintf(mFile,"\tsetAttr \".hco\" %i;\n", hco);
+		writeInt(mFile,"\tsetAttr \".hco\" ",hco,";\n");
 	}
 	void setBackfacingCreases(bool bfc)
 	{
 		if(bfc == true) return;
-		fprintf(mFile,"\tsetAttr \".bfc\" %i;\n", bfc);
+		writeInt(mFile,"\tsetAttr \".bfc\" ",bfc,";\n");
 	}
 	void setIntersectionAngleMin(double imn)
 	{
 		if(imn == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".imn\" %f;\n", imn);
+		writeFloat(mFile,"\tsetAttr \".imn\" ",imn,";\n");
 	}
 	void setIntersectionAngleMax(double imx)
 	{
 		if(imx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".imx\" %f;\n", imx);
+		writeFloat(mFile,"\tsetAttr \".imx\" ",imx,";\n");
 	}
 	void setSmoothProfile(bool spf)
 	{
 		if(spf == true) return;
-		fprintf(mFile,"\tsetAttr \".spf\" %i;\n", spf);
+		writeInt(mFile,"\tsetAttr \".spf\" ",spf,";\n");
 	}
 	void setTighterProfile(bool tpf)
 	{
 		if(tpf == false) return;
-		fprintf(mFile,"\tsetAttr \".tpf\" %i;\n", tpf);
+		writeInt(mFile,"\tsetAttr \".tpf\" ",tpf,";\n");
 	}
 	void setCurvatureModulation(bool cmo)
 	{
 		if(cmo == false) return;
-		fprintf(mFile,"\tsetAttr \".cmo\" %i;\n", cmo);
+		writeInt(mFile,"\tsetAttr \".cmo\" ",cmo,";\n");
 	}
 	void setCurvatureWidth(size_t cwd_i,const CurvatureWidth& cwd)
 	{
-		fprintf(mFile,"\tsetAttr \".cwd[%i]\" ",cwd_i);
+		writeInt(mFile,"\tsetAttr \".cwd[",cwd_i,"]\" ");
 		cwd.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCurvatureWidth(size_t cwd_start,size_t cwd_end,CurvatureWidth* cwd)
 	{
-		fprintf(mFile,"\tsetAttr \".cwd[%i:%i]\" ", cwd_start,cwd_end);
+		writeInt(mFile,"\tsetAttr \".cwd[",cwd_start); writeInt(mFile,":",cwd_end,"]\" ");
 		size_t size = (cwd_end-cwd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cwd[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCurvatureWidth(size_t cwd_start,size_t cwd_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cwd[%i:%i]\"",cwd_start,cwd_end);
-		fprintf(mFile," -type \"CurvatureWidth\" ");
+		writeInt(mFile,"\tsetAttr \".cwd[",cwd_start); writeInt(mFile,":",cwd_end,"]\"");
+		writeString(mFile," -type \"CurvatureWidth\" ");
 	}
 	void appendCurvatureWidth(const CurvatureWidth& cwd)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cwd.write(mFile);
 	}
 	void endCurvatureWidth()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCurvatureWidth_Position(size_t cwd_i,float cwdp)
 	{
 		if(cwdp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cwd[%i].cwdp\" %f;\n", cwd_i,cwdp);
+		writeInt(mFile,"\tsetAttr \".cwd[",cwd_i); writeFloat(mFile,"].cwdp\" ",cwdp,";\n");
 	}
 	void setCurvatureWidth_FloatValue(size_t cwd_i,float cwdfv)
 	{
 		if(cwdfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cwd[%i].cwdfv\" %f;\n", cwd_i,cwdfv);
+		writeInt(mFile,"\tsetAttr \".cwd[",cwd_i); writeFloat(mFile,"].cwdfv\" ",cwdfv,";\n");
 	}
 	void setCurvatureWidth_Interp(size_t cwd_i,unsigned int cwdi)
 	{
 		if(cwdi == 0) return;
-		fprintf(mFile,"\tsetAttr \".cwd[%i].cwdi\" %i;\n", cwd_i,cwdi);
+		writeInt(mFile,"\tsetAttr \".cwd[",cwd_i); writeInt(mFile,"].cwdi\" ",cwdi,";\n");
 	}
 	void setProfileWidthModulation(double pwm)
 	{
 		if(pwm == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pwm\" %f;\n", pwm);
+		writeFloat(mFile,"\tsetAttr \".pwm\" ",pwm,";\n");
 	}
 	void setCreaseWidthModulation(double cwm)
 	{
 		if(cwm == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cwm\" %f;\n", cwm);
+		writeFloat(mFile,"\tsetAttr \".cwm\" ",cwm,";\n");
 	}
 	void setBorderWidthModulation(double bwm)
 	{
 		if(bwm == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".bwm\" %f;\n", bwm);
+		writeFloat(mFile,"\tsetAttr \".bwm\" ",bwm,";\n");
 	}
 	void setIntersectionWidthModulation(double imd)
 	{
 		if(imd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imd\" %f;\n", imd);
+		writeFloat(mFile,"\tsetAttr \".imd\" ",imd,";\n");
 	}
 	void setProfileBreakAngle(double pba)
 	{
 		if(pba == 180.0) return;
-		fprintf(mFile,"\tsetAttr \".pba\" %f;\n", pba);
+		writeFloat(mFile,"\tsetAttr \".pba\" ",pba,";\n");
 	}
 	void setCreaseBreakAngle(double cba)
 	{
 		if(cba == 80) return;
-		fprintf(mFile,"\tsetAttr \".cba\" %f;\n", cba);
+		writeFloat(mFile,"\tsetAttr \".cba\" ",cba,";\n");
 	}
 	void setBorderBreakAngle(double bba)
 	{
 		if(bba == 80.0) return;
-		fprintf(mFile,"\tsetAttr \".bba\" %f;\n", bba);
+		writeFloat(mFile,"\tsetAttr \".bba\" ",bba,";\n");
 	}
 	void setIntersectionBreakAngle(double iba)
 	{
 		if(iba == 180.0) return;
-		fprintf(mFile,"\tsetAttr \".iba\" %f;\n", iba);
+		writeFloat(mFile,"\tsetAttr \".iba\" ",iba,";\n");
 	}
 	void setRemoveFlushBorders(bool rfb)
 	{
 		if(rfb == false) return;
-		fprintf(mFile,"\tsetAttr \".rfb\" %i;\n", rfb);
+		writeInt(mFile,"\tsetAttr \".rfb\" ",rfb,";\n");
 	}
 	void setFlushTolerance(double tfl)
 	{
 		if(tfl == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".tfl\" %f;\n", tfl);
+		writeFloat(mFile,"\tsetAttr \".tfl\" ",tfl,";\n");
 	}
 	void setFlushAngleMax(double fmx)
 	{
 		if(fmx == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".fmx\" %f;\n", fmx);
+		writeFloat(mFile,"\tsetAttr \".fmx\" ",fmx,";\n");
 	}
 	void setLineEndThinning(double let)
 	{
 		if(let == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".let\" %f;\n", let);
+		writeFloat(mFile,"\tsetAttr \".let\" ",let,";\n");
 	}
 	void setLineExtend(double lex)
 	{
 		if(lex == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lex\" %f;\n", lex);
+		writeFloat(mFile,"\tsetAttr \".lex\" ",lex,";\n");
 	}
 	void setResampleProfile(bool rpf)
 	{
 		if(rpf == false) return;
-		fprintf(mFile,"\tsetAttr \".rpf\" %i;\n", rpf);
+		writeInt(mFile,"\tsetAttr \".rpf\" ",rpf,";\n");
 	}
 	void setResampleCrease(bool rcr)
 	{
 		if(rcr == false) return;
-		fprintf(mFile,"\tsetAttr \".rcr\" %i;\n", rcr);
+		writeInt(mFile,"\tsetAttr \".rcr\" ",rcr,";\n");
 	}
 	void setResampleBorder(bool rbd)
 	{
 		if(rbd == false) return;
-		fprintf(mFile,"\tsetAttr \".rbd\" %i;\n", rbd);
+		writeInt(mFile,"\tsetAttr \".rbd\" ",rbd,";\n");
 	}
 	void setResampleIntersection(bool rin)
 	{
 		if(rin == false) return;
-		fprintf(mFile,"\tsetAttr \".rin\" %i;\n", rin);
+		writeInt(mFile,"\tsetAttr \".rin\" ",rin,";\n");
 	}
 	void setMaxSegmentLength(double msl)
 	{
 		if(msl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".msl\" %f;\n", msl);
+		writeFloat(mFile,"\tsetAttr \".msl\" ",msl,";\n");
 	}
 	void setMinSegmentLength(double mns)
 	{
 		if(mns == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mns\" %f;\n", mns);
+		writeFloat(mFile,"\tsetAttr \".mns\" ",mns,";\n");
 	}
 	void setScreenSpaceResampling(double ssr)
 	{
 		if(ssr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ssr\" %f;\n", ssr);
+		writeFloat(mFile,"\tsetAttr \".ssr\" ",ssr,";\n");
 	}
 	void setPfxRandomize(bool prz)
 	{
 		if(prz == false) return;
-		fprintf(mFile,"\tsetAttr \".prz\" %i;\n", prz);
+		writeInt(mFile,"\tsetAttr \".prz\" ",prz,";\n");
 	}
 	void setScreenspaceWidth(bool spw)
 	{
 		if(spw == false) return;
-		fprintf(mFile,"\tsetAttr \".spw\" %i;\n", spw);
+		writeInt(mFile,"\tsetAttr \".spw\" ",spw,";\n");
 	}
 	void setDistanceScaling(double dsl)
 	{
 		if(dsl == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dsl\" %f;\n", dsl);
+		writeFloat(mFile,"\tsetAttr \".dsl\" ",dsl,";\n");
 	}
 	void setMinPixelWidth(double mpw)
 	{
 		if(mpw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mpw\" %f;\n", mpw);
+		writeFloat(mFile,"\tsetAttr \".mpw\" ",mpw,";\n");
 	}
 	void setMaxPixelWidth(double mxp)
 	{
 		if(mxp == 1000.0) return;
-		fprintf(mFile,"\tsetAttr \".mxp\" %f;\n", mxp);
+		writeFloat(mFile,"\tsetAttr \".mxp\" ",mxp,";\n");
 	}
 	void setProfileColor(const float3& pcl)
 	{
-		fprintf(mFile,"\tsetAttr \".pcl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pcl\" -type \"float3\" ");
 		pcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProfileColorR(float pcr)
 	{
 		if(pcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pcl.pcr\" %f;\n", pcr);
+		writeFloat(mFile,"\tsetAttr \".pcl.pcr\" ",pcr,";\n");
 	}
 	void setProfileColorG(float pcg)
 	{
 		if(pcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pcl.pcg\" %f;\n", pcg);
+		writeFloat(mFile,"\tsetAttr \".pcl.pcg\" ",pcg,";\n");
 	}
 	void setProfileColorB(float pcb)
 	{
 		if(pcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pcl.pcb\" %f;\n", pcb);
+		writeFloat(mFile,"\tsetAttr \".pcl.pcb\" ",pcb,";\n");
 	}
 	void setCreaseColor(const float3& ccl)
 	{
-		fprintf(mFile,"\tsetAttr \".ccl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ccl\" -type \"float3\" ");
 		ccl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCreaseColorR(float ccr)
 	{
 		if(ccr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ccl.ccr\" %f;\n", ccr);
+		writeFloat(mFile,"\tsetAttr \".ccl.ccr\" ",ccr,";\n");
 	}
 	void setCreaseColorG(float ccg)
 	{
 		if(ccg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ccl.ccg\" %f;\n", ccg);
+		writeFloat(mFile,"\tsetAttr \".ccl.ccg\" ",ccg,";\n");
 	}
 	void setCreaseColorB(float ccb)
 	{
 		if(ccb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ccl.ccb\" %f;\n", ccb);
+		writeFloat(mFile,"\tsetAttr \".ccl.ccb\" ",ccb,";\n");
 	}
 	void setBorderColor(const float3& bcl)
 	{
-		fprintf(mFile,"\tsetAttr \".bcl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".bcl\" -type \"float3\" ");
 		bcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBorderColorR(float bcr)
 	{
 		if(bcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcl.bcr\" %f;\n", bcr);
+		writeFloat(mFile,"\tsetAttr \".bcl.bcr\" ",bcr,";\n");
 	}
 	void setBorderColorG(float bcg)
 	{
 		if(bcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcl.bcg\" %f;\n", bcg);
+		writeFloat(mFile,"\tsetAttr \".bcl.bcg\" ",bcg,";\n");
 	}
 	void setBorderColorB(float bcb)
 	{
 		if(bcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bcl.bcb\" %f;\n", bcb);
+		writeFloat(mFile,"\tsetAttr \".bcl.bcb\" ",bcb,";\n");
 	}
 	void setIntersectionColor(const float3& icl)
 	{
-		fprintf(mFile,"\tsetAttr \".icl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".icl\" -type \"float3\" ");
 		icl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIntersectionColorR(float icr)
 	{
 		if(icr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".icl.icr\" %f;\n", icr);
+		writeFloat(mFile,"\tsetAttr \".icl.icr\" ",icr,";\n");
 	}
 	void setIntersectionColorG(float icg)
 	{
 		if(icg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".icl.icg\" %f;\n", icg);
+		writeFloat(mFile,"\tsetAttr \".icl.icg\" ",icg,";\n");
 	}
 	void setIntersectionColorB(float icb)
 	{
 		if(icb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".icl.icb\" %f;\n", icb);
+		writeFloat(mFile,"\tsetAttr \".icl.icb\" ",icb,";\n");
 	}
 	void getInputSurface(size_t ins_i)const
 	{
-		fprintf(mFile,"\"%s.ins[%i]\"",mName.c_str(),ins_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ins[",ins_i,"]\"");
 	}
 	void getInputSurface()const
 	{
 
-		fprintf(mFile,"\"%s.ins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ins\"");
 	}
 	void getSurface(size_t ins_i)const
 	{
-		fprintf(mFile,"\"%s.ins[%i].srf\"",mName.c_str(),ins_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ins[",ins_i,"].srf\"");
 	}
 	void getSurface()const
 	{
 
-		fprintf(mFile,"\"%s.ins.srf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ins.srf\"");
 	}
 	void getInputWorldMatrix(size_t ins_i)const
 	{
-		fprintf(mFile,"\"%s.ins[%i].iwm\"",mName.c_str(),ins_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ins[",ins_i,"].iwm\"");
 	}
 	void getInputWorldMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.ins.iwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ins.iwm\"");
 	}
 	void getDisplayInViewport()const
 	{
-		fprintf(mFile,"\"%s.div\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".div\"");
 	}
 	void getProfileLines()const
 	{
-		fprintf(mFile,"\"%s.pln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pln\"");
 	}
 	void getCreaseLines()const
 	{
-		fprintf(mFile,"\"%s.cln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cln\"");
 	}
 	void getBorderLines()const
 	{
-		fprintf(mFile,"\"%s.bln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bln\"");
 	}
 	void getIntersectionLines()const
 	{
-		fprintf(mFile,"\"%s.iln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iln\"");
 	}
 	void getSelfIntersect()const
 	{
-		fprintf(mFile,"\"%s.sei\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sei\"");
 	}
 	void getLineWidth()const
 	{
-		fprintf(mFile,"\"%s.lwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lwd\"");
 	}
 	void getLineWidthMap()const
 	{
-		fprintf(mFile,"\"%s.lwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lwm\"");
 	}
 	void getLineOpacity()const
 	{
-		fprintf(mFile,"\"%s.lop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lop\"");
 	}
 	void getLineOpacityMap()const
 	{
-		fprintf(mFile,"\"%s.lpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lpm\"");
 	}
 	void getLocalOcclusion()const
 	{
-		fprintf(mFile,"\"%s.lcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcl\"");
 	}
 	void getOcclusionTolerance()const
 	{
-		fprintf(mFile,"\"%s.otl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".otl\"");
 	}
 	void getDepthBias()const
 	{
-		fprintf(mFile,"\"%s.dbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dbs\"");
 	}
 	void getProfileLineWidth()const
 	{
-		fprintf(mFile,"\"%s.plw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".plw\"");
 	}
 	void getCreaseLineWidth()const
 	{
-		fprintf(mFile,"\"%s.clw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clw\"");
 	}
 	void getBorderLineWidth()const
 	{
-		fprintf(mFile,"\"%s.blw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".blw\"");
 	}
 	void getIntersectionLineWidth()const
 	{
-		fprintf(mFile,"\"%s.ilw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ilw\"");
 	}
 	void getLineOffset()const
 	{
-		fprintf(mFile,"\"%s.lof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lof\"");
 	}
 	void getLineOffsetMap()const
 	{
-		fprintf(mFile,"\"%s.lom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lom\"");
 	}
 	void getLightingBasedWidth()const
 	{
-		fprintf(mFile,"\"%s.lbw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lbw\"");
 	}
 	void getOcclusionWidthScale()const
 	{
-		fprintf(mFile,"\"%s.ows\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ows\"");
 	}
 	void getDepthOffset()const
 	{
-		fprintf(mFile,"\"%s.dff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dff\"");
 	}
 	void getCreaseAngleMin()const
 	{
-		fprintf(mFile,"\"%s.amn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amn\"");
 	}
 	void getCreaseAngleMax()const
 	{
-		fprintf(mFile,"\"%s.amx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amx\"");
 	}
 	void getHardCreasesOnly()const
 	{
-		fprintf(mFile,"\"%s.hco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hco\"");
 	}
 	void getBackfacingCreases()const
 	{
-		fprintf(mFile,"\"%s.bfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bfc\"");
 	}
 	void getIntersectionAngleMin()const
 	{
-		fprintf(mFile,"\"%s.imn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imn\"");
 	}
 	void getIntersectionAngleMax()const
 	{
-		fprintf(mFile,"\"%s.imx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imx\"");
 	}
 	void getSmoothProfile()const
 	{
-		fprintf(mFile,"\"%s.spf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spf\"");
 	}
 	void getTighterProfile()const
 	{
-		fprintf(mFile,"\"%s.tpf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tpf\"");
 	}
 	void getCurvatureModulation()const
 	{
-		fprintf(mFile,"\"%s.cmo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cmo\"");
 	}
 	void getCurvatureWidth(size_t cwd_i)const
 	{
-		fprintf(mFile,"\"%s.cwd[%i]\"",mName.c_str(),cwd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cwd[",cwd_i,"]\"");
 	}
 	void getCurvatureWidth()const
 	{
 
-		fprintf(mFile,"\"%s.cwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwd\"");
 	}
 	void getCurvatureWidth_Position(size_t cwd_i)const
 	{
-		fprintf(mFile,"\"%s.cwd[%i].cwdp\"",mName.c_str(),cwd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cwd[",cwd_i,"].cwdp\"");
 	}
 	void getCurvatureWidth_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cwd.cwdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwd.cwdp\"");
 	}
 	void getCurvatureWidth_FloatValue(size_t cwd_i)const
 	{
-		fprintf(mFile,"\"%s.cwd[%i].cwdfv\"",mName.c_str(),cwd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cwd[",cwd_i,"].cwdfv\"");
 	}
 	void getCurvatureWidth_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.cwd.cwdfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwd.cwdfv\"");
 	}
 	void getCurvatureWidth_Interp(size_t cwd_i)const
 	{
-		fprintf(mFile,"\"%s.cwd[%i].cwdi\"",mName.c_str(),cwd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cwd[",cwd_i,"].cwdi\"");
 	}
 	void getCurvatureWidth_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cwd.cwdi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwd.cwdi\"");
 	}
 	void getProfileWidthModulation()const
 	{
-		fprintf(mFile,"\"%s.pwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pwm\"");
 	}
 	void getCreaseWidthModulation()const
 	{
-		fprintf(mFile,"\"%s.cwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwm\"");
 	}
 	void getBorderWidthModulation()const
 	{
-		fprintf(mFile,"\"%s.bwm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bwm\"");
 	}
 	void getIntersectionWidthModulation()const
 	{
-		fprintf(mFile,"\"%s.imd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imd\"");
 	}
 	void getProfileBreakAngle()const
 	{
-		fprintf(mFile,"\"%s.pba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pba\"");
 	}
 	void getCreaseBreakAngle()const
 	{
-		fprintf(mFile,"\"%s.cba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cba\"");
 	}
 	void getBorderBreakAngle()const
 	{
-		fprintf(mFile,"\"%s.bba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bba\"");
 	}
 	void getIntersectionBreakAngle()const
 	{
-		fprintf(mFile,"\"%s.iba\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iba\"");
 	}
 	void getRemoveFlushBorders()const
 	{
-		fprintf(mFile,"\"%s.rfb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfb\"");
 	}
 	void getFlushTolerance()const
 	{
-		fprintf(mFile,"\"%s.tfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tfl\"");
 	}
 	void getFlushAngleMax()const
 	{
-		fprintf(mFile,"\"%s.fmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fmx\"");
 	}
 	void getLineEndThinning()const
 	{
-		fprintf(mFile,"\"%s.let\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".let\"");
 	}
 	void getLineExtend()const
 	{
-		fprintf(mFile,"\"%s.lex\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lex\"");
 	}
 	void getResampleProfile()const
 	{
-		fprintf(mFile,"\"%s.rpf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpf\"");
 	}
 	void getResampleCrease()const
 	{
-		fprintf(mFile,"\"%s.rcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcr\"");
 	}
 	void getResampleBorder()const
 	{
-		fprintf(mFile,"\"%s.rbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rbd\"");
 	}
 	void getResampleIntersection()const
 	{
-		fprintf(mFile,"\"%s.rin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rin\"");
 	}
 	void getMaxSegmentLength()const
 	{
-		fprintf(mFile,"\"%s.msl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msl\"");
 	}
 	void getMinSegmentLength()const
 	{
-		fprintf(mFile,"\"%s.mns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mns\"");
 	}
 	void getScreenSpaceResampling()const
 	{
-		fprintf(mFile,"\"%s.ssr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssr\"");
 	}
 	void getPfxRandomize()const
 	{
-		fprintf(mFile,"\"%s.prz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".prz\"");
 	}
 	void getScreenspaceWidth()const
 	{
-		fprintf(mFile,"\"%s.spw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spw\"");
 	}
 	void getDistanceScaling()const
 	{
-		fprintf(mFile,"\"%s.dsl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsl\"");
 	}
 	void getMinPixelWidth()const
 	{
-		fprintf(mFile,"\"%s.mpw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpw\"");
 	}
 	void getMaxPixelWidth()const
 	{
-		fprintf(mFile,"\"%s.mxp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mxp\"");
 	}
 	void getProfileColor()const
 	{
-		fprintf(mFile,"\"%s.pcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcl\"");
 	}
 	void getProfileColorR()const
 	{
-		fprintf(mFile,"\"%s.pcl.pcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcl.pcr\"");
 	}
 	void getProfileColorG()const
 	{
-		fprintf(mFile,"\"%s.pcl.pcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcl.pcg\"");
 	}
 	void getProfileColorB()const
 	{
-		fprintf(mFile,"\"%s.pcl.pcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcl.pcb\"");
 	}
 	void getCreaseColor()const
 	{
-		fprintf(mFile,"\"%s.ccl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccl\"");
 	}
 	void getCreaseColorR()const
 	{
-		fprintf(mFile,"\"%s.ccl.ccr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccl.ccr\"");
 	}
 	void getCreaseColorG()const
 	{
-		fprintf(mFile,"\"%s.ccl.ccg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccl.ccg\"");
 	}
 	void getCreaseColorB()const
 	{
-		fprintf(mFile,"\"%s.ccl.ccb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ccl.ccb\"");
 	}
 	void getBorderColor()const
 	{
-		fprintf(mFile,"\"%s.bcl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcl\"");
 	}
 	void getBorderColorR()const
 	{
-		fprintf(mFile,"\"%s.bcl.bcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcl.bcr\"");
 	}
 	void getBorderColorG()const
 	{
-		fprintf(mFile,"\"%s.bcl.bcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcl.bcg\"");
 	}
 	void getBorderColorB()const
 	{
-		fprintf(mFile,"\"%s.bcl.bcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcl.bcb\"");
 	}
 	void getIntersectionColor()const
 	{
-		fprintf(mFile,"\"%s.icl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".icl\"");
 	}
 	void getIntersectionColorR()const
 	{
-		fprintf(mFile,"\"%s.icl.icr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".icl.icr\"");
 	}
 	void getIntersectionColorG()const
 	{
-		fprintf(mFile,"\"%s.icl.icg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".icl.icg\"");
 	}
 	void getIntersectionColorB()const
 	{
-		fprintf(mFile,"\"%s.icl.icb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".icl.icb\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.ocl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.ocl.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.ocl.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.ocl.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocl.ocb\"");
 	}
 	void getOutProfileMesh(size_t opm_i)const
 	{
-		fprintf(mFile,"\"%s.opm[%i]\"",mName.c_str(),opm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".opm[",opm_i,"]\"");
 	}
 	void getOutProfileMesh()const
 	{
 
-		fprintf(mFile,"\"%s.opm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opm\"");
 	}
 protected:
 	PfxToon(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,168 +27,168 @@ public:
 	void setRoughness(float rn)
 	{
 		if(rn == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".rn\" %f;\n", rn);
+		writeFloat(mFile,"\tsetAttr \".rn\" ",rn,";\n");
 	}
 	void setHighlightSize(float hls)
 	{
 		if(hls == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hls\" %f;\n", hls);
+		writeFloat(mFile,"\tsetAttr \".hls\" ",hls,";\n");
 	}
 	void setWhiteness(const float3& wn)
 	{
 		if(wn == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".wn\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".wn\" -type \"float3\" ");
 		wn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWhitenessR(float wnr)
 	{
 		if(wnr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wn.wnr\" %f;\n", wnr);
+		writeFloat(mFile,"\tsetAttr \".wn.wnr\" ",wnr,";\n");
 	}
 	void setWhitenessG(float wng)
 	{
 		if(wng == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wn.wng\" %f;\n", wng);
+		writeFloat(mFile,"\tsetAttr \".wn.wng\" ",wng,";\n");
 	}
 	void setWhitenessB(float wnb)
 	{
 		if(wnb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wn.wnb\" %f;\n", wnb);
+		writeFloat(mFile,"\tsetAttr \".wn.wnb\" ",wnb,";\n");
 	}
 	void setMiReflectionBlur(float mircb)
 	{
 		if(mircb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mircb\" %f;\n", mircb);
+		writeFloat(mFile,"\tsetAttr \".mircb\" ",mircb,";\n");
 	}
 	void setMiReflectionRays(short mircr)
 	{
 		if(mircr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mircr\" %i;\n", mircr);
+		writeInt(mFile,"\tsetAttr \".mircr\" ",mircr,";\n");
 	}
 	void setMiShinyness(float mis)
 	{
 		if(mis == 10) return;
-		fprintf(mFile,"\tsetAttr \".mis\" %f;\n", mis);
+		writeFloat(mFile,"\tsetAttr \".mis\" ",mis,";\n");
 	}
 	void setMiWhiteness(const float3& miwn)
 	{
-		fprintf(mFile,"\tsetAttr \".miwn\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".miwn\" -type \"float3\" ");
 		miwn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiWhitenessR(float miwnr)
 	{
 		if(miwnr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwnr\" %f;\n", miwnr);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwnr\" ",miwnr,";\n");
 	}
 	void setMiWhitenessG(float miwng)
 	{
 		if(miwng == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwng\" %f;\n", miwng);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwng\" ",miwng,";\n");
 	}
 	void setMiWhitenessB(float miwnb)
 	{
 		if(miwnb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwnb\" %f;\n", miwnb);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwnb\" ",miwnb,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void getRoughness()const
 	{
-		fprintf(mFile,"\"%s.rn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rn\"");
 	}
 	void getHighlightSize()const
 	{
-		fprintf(mFile,"\"%s.hls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hls\"");
 	}
 	void getWhiteness()const
 	{
-		fprintf(mFile,"\"%s.wn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn\"");
 	}
 	void getWhitenessR()const
 	{
-		fprintf(mFile,"\"%s.wn.wnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn.wnr\"");
 	}
 	void getWhitenessG()const
 	{
-		fprintf(mFile,"\"%s.wn.wng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn.wng\"");
 	}
 	void getWhitenessB()const
 	{
-		fprintf(mFile,"\"%s.wn.wnb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wn.wnb\"");
 	}
 	void getMiReflectionBlur()const
 	{
-		fprintf(mFile,"\"%s.mircb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircb\"");
 	}
 	void getMiReflectionRays()const
 	{
-		fprintf(mFile,"\"%s.mircr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircr\"");
 	}
 	void getMiShinyness()const
 	{
-		fprintf(mFile,"\"%s.mis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mis\"");
 	}
 	void getMiWhiteness()const
 	{
-		fprintf(mFile,"\"%s.miwn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn\"");
 	}
 	void getMiWhitenessR()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwnr\"");
 	}
 	void getMiWhitenessG()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwng\"");
 	}
 	void getMiWhitenessB()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwnb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwnb\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 protected:
 	PhongE(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
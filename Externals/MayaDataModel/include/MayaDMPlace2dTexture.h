@@ -26,393 +26,393 @@ public:
 
 	void setVertexUvOne(const float2& vt1)
 	{
-		fprintf(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
 		vt1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvOneU(float t1u)
 	{
 		if(t1u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1u\" %f;\n", t1u);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1u\" ",t1u,";\n");
 	}
 	void setVertexUvOneV(float t1v)
 	{
 		if(t1v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1v\" %f;\n", t1v);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1v\" ",t1v,";\n");
 	}
 	void setVertexUvTwo(const float2& vt2)
 	{
-		fprintf(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
 		vt2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvTwoU(float t2u)
 	{
 		if(t2u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2u\" %f;\n", t2u);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2u\" ",t2u,";\n");
 	}
 	void setVertexUvTwoV(float t2v)
 	{
 		if(t2v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2v\" %f;\n", t2v);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2v\" ",t2v,";\n");
 	}
 	void setVertexUvThree(const float2& vt3)
 	{
-		fprintf(mFile,"\tsetAttr \".vt3\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt3\" -type \"float2\" ");
 		vt3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvThreeU(float t3u)
 	{
 		if(t3u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt3.t3u\" %f;\n", t3u);
+		writeFloat(mFile,"\tsetAttr \".vt3.t3u\" ",t3u,";\n");
 	}
 	void setVertexUvThreeV(float t3v)
 	{
 		if(t3v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt3.t3v\" %f;\n", t3v);
+		writeFloat(mFile,"\tsetAttr \".vt3.t3v\" ",t3v,";\n");
 	}
 	void setVertexCameraOne(const float3& vc1)
 	{
-		fprintf(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
 		vc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraOneX(float c1x)
 	{
 		if(c1x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1x\" %f;\n", c1x);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1x\" ",c1x,";\n");
 	}
 	void setVertexCameraOneY(float c1y)
 	{
 		if(c1y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1y\" %f;\n", c1y);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1y\" ",c1y,";\n");
 	}
 	void setVertexCameraOneZ(float c1z)
 	{
 		if(c1z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1z\" %f;\n", c1z);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1z\" ",c1z,";\n");
 	}
 	void setCoverage(const float2& c)
 	{
 		if(c == float2(1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float2\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCoverageU(float cu)
 	{
 		if(cu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cu\" %f;\n", cu);
+		writeFloat(mFile,"\tsetAttr \".c.cu\" ",cu,";\n");
 	}
 	void setCoverageV(float cv)
 	{
 		if(cv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cv\" %f;\n", cv);
+		writeFloat(mFile,"\tsetAttr \".c.cv\" ",cv,";\n");
 	}
 	void setTranslateFrame(const float2& tf)
 	{
 		if(tf == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".tf\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".tf\" -type \"float2\" ");
 		tf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslateFrameU(float tfu)
 	{
 		if(tfu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfu\" %f;\n", tfu);
+		writeFloat(mFile,"\tsetAttr \".tf.tfu\" ",tfu,";\n");
 	}
 	void setTranslateFrameV(float tfv)
 	{
 		if(tfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfv\" %f;\n", tfv);
+		writeFloat(mFile,"\tsetAttr \".tf.tfv\" ",tfv,";\n");
 	}
 	void setRotateFrame(double rf)
 	{
 		if(rf == 0) return;
-		fprintf(mFile,"\tsetAttr \".rf\" %f;\n", rf);
+		writeFloat(mFile,"\tsetAttr \".rf\" ",rf,";\n");
 	}
 	void setMirrorU(bool mu)
 	{
 		if(mu == false) return;
-		fprintf(mFile,"\tsetAttr \".mu\" %i;\n", mu);
+		writeInt(mFile,"\tsetAttr \".mu\" ",mu,";\n");
 	}
 	void setMirrorV(bool mv)
 	{
 		if(mv == false) return;
-		fprintf(mFile,"\tsetAttr \".mv\" %i;\n", mv);
+		writeInt(mFile,"\tsetAttr \".mv\" ",mv,";\n");
 	}
 	void setStagger(bool s)
 	{
 		if(s == false) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setWrapU(bool wu)
 	{
 		if(wu == true) return;
-		fprintf(mFile,"\tsetAttr \".wu\" %i;\n", wu);
+		writeInt(mFile,"\tsetAttr \".wu\" ",wu,";\n");
 	}
 	void setWrapV(bool wv)
 	{
 		if(wv == true) return;
-		fprintf(mFile,"\tsetAttr \".wv\" %i;\n", wv);
+		writeInt(mFile,"\tsetAttr \".wv\" ",wv,";\n");
 	}
 	void setRepeatUV(const float2& re)
 	{
 		if(re == float2(1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".re\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".re\" -type \"float2\" ");
 		re.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRepeatU(float reu)
 	{
 		if(reu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".re.reu\" %f;\n", reu);
+		writeFloat(mFile,"\tsetAttr \".re.reu\" ",reu,";\n");
 	}
 	void setRepeatV(float rev)
 	{
 		if(rev == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".re.rev\" %f;\n", rev);
+		writeFloat(mFile,"\tsetAttr \".re.rev\" ",rev,";\n");
 	}
 	void setOffset(const float2& of)
 	{
 		if(of == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".of\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".of\" -type \"float2\" ");
 		of.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetU(float ofu)
 	{
 		if(ofu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".of.ofu\" %f;\n", ofu);
+		writeFloat(mFile,"\tsetAttr \".of.ofu\" ",ofu,";\n");
 	}
 	void setOffsetV(float ofv)
 	{
 		if(ofv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".of.ofv\" %f;\n", ofv);
+		writeFloat(mFile,"\tsetAttr \".of.ofv\" ",ofv,";\n");
 	}
 	void setRotateUV(double r)
 	{
 		if(r == 0) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setNoiseUV(const float2& n)
 	{
 		if(n == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".n\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".n\" -type \"float2\" ");
 		n.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNoiseU(float nu)
 	{
 		if(nu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.nu\" %f;\n", nu);
+		writeFloat(mFile,"\tsetAttr \".n.nu\" ",nu,";\n");
 	}
 	void setNoiseV(float nv)
 	{
 		if(nv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.nv\" %f;\n", nv);
+		writeFloat(mFile,"\tsetAttr \".n.nv\" ",nv,";\n");
 	}
 	void setFast(bool fa)
 	{
 		if(fa == false) return;
-		fprintf(mFile,"\tsetAttr \".fa\" %i;\n", fa);
+		writeInt(mFile,"\tsetAttr \".fa\" ",fa,";\n");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.u\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.v\"");
 	}
 	void getVertexUvOne()const
 	{
-		fprintf(mFile,"\"%s.vt1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1\"");
 	}
 	void getVertexUvOneU()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1u\"");
 	}
 	void getVertexUvOneV()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1v\"");
 	}
 	void getVertexUvTwo()const
 	{
-		fprintf(mFile,"\"%s.vt2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2\"");
 	}
 	void getVertexUvTwoU()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2u\"");
 	}
 	void getVertexUvTwoV()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2v\"");
 	}
 	void getVertexUvThree()const
 	{
-		fprintf(mFile,"\"%s.vt3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3\"");
 	}
 	void getVertexUvThreeU()const
 	{
-		fprintf(mFile,"\"%s.vt3.t3u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3.t3u\"");
 	}
 	void getVertexUvThreeV()const
 	{
-		fprintf(mFile,"\"%s.vt3.t3v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3.t3v\"");
 	}
 	void getVertexCameraOne()const
 	{
-		fprintf(mFile,"\"%s.vc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1\"");
 	}
 	void getVertexCameraOneX()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1x\"");
 	}
 	void getVertexCameraOneY()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1y\"");
 	}
 	void getVertexCameraOneZ()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1z\"");
 	}
 	void getUvFilterSize()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getUvFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.fs.fsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsx\"");
 	}
 	void getUvFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.fs.fsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsy\"");
 	}
 	void getCoverage()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getCoverageU()const
 	{
-		fprintf(mFile,"\"%s.c.cu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cu\"");
 	}
 	void getCoverageV()const
 	{
-		fprintf(mFile,"\"%s.c.cv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cv\"");
 	}
 	void getTranslateFrame()const
 	{
-		fprintf(mFile,"\"%s.tf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf\"");
 	}
 	void getTranslateFrameU()const
 	{
-		fprintf(mFile,"\"%s.tf.tfu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfu\"");
 	}
 	void getTranslateFrameV()const
 	{
-		fprintf(mFile,"\"%s.tf.tfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfv\"");
 	}
 	void getRotateFrame()const
 	{
-		fprintf(mFile,"\"%s.rf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rf\"");
 	}
 	void getMirrorU()const
 	{
-		fprintf(mFile,"\"%s.mu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mu\"");
 	}
 	void getMirrorV()const
 	{
-		fprintf(mFile,"\"%s.mv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mv\"");
 	}
 	void getStagger()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getWrapU()const
 	{
-		fprintf(mFile,"\"%s.wu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wu\"");
 	}
 	void getWrapV()const
 	{
-		fprintf(mFile,"\"%s.wv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wv\"");
 	}
 	void getRepeatUV()const
 	{
-		fprintf(mFile,"\"%s.re\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re\"");
 	}
 	void getRepeatU()const
 	{
-		fprintf(mFile,"\"%s.re.reu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.reu\"");
 	}
 	void getRepeatV()const
 	{
-		fprintf(mFile,"\"%s.re.rev\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re.rev\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.of\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of\"");
 	}
 	void getOffsetU()const
 	{
-		fprintf(mFile,"\"%s.of.ofu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of.ofu\"");
 	}
 	void getOffsetV()const
 	{
-		fprintf(mFile,"\"%s.of.ofv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of.ofv\"");
 	}
 	void getRotateUV()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getNoiseUV()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNoiseU()const
 	{
-		fprintf(mFile,"\"%s.n.nu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nu\"");
 	}
 	void getNoiseV()const
 	{
-		fprintf(mFile,"\"%s.n.nv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nv\"");
 	}
 	void getFast()const
 	{
-		fprintf(mFile,"\"%s.fa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fa\"");
 	}
 	void getOutUV()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutU()const
 	{
-		fprintf(mFile,"\"%s.o.ou\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ou\"");
 	}
 	void getOutV()const
 	{
-		fprintf(mFile,"\"%s.o.ov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ov\"");
 	}
 	void getOutUvFilterSize()const
 	{
-		fprintf(mFile,"\"%s.ofs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofs\"");
 	}
 	void getOutUvFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.ofs.ofsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofs.ofsx\"");
 	}
 	void getOutUvFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.ofs.ofsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofs.ofsy\"");
 	}
 	void getDoTransform()const
 	{
-		fprintf(mFile,"\"%s.do\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do\"");
 	}
 protected:
 	Place2dTexture(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
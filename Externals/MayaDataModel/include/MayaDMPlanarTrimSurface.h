@@ -27,42 +27,42 @@ public:
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setKeepOutside(bool ko)
 	{
 		if(ko == false) return;
-		fprintf(mFile,"\tsetAttr \".ko\" %i;\n", ko);
+		writeInt(mFile,"\tsetAttr \".ko\" ",ko,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void getInputCurve(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i]\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"]\"");
 	}
 	void getInputCurve()const
 	{
 
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getKeepOutside()const
 	{
-		fprintf(mFile,"\"%s.ko\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ko\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 protected:
 	PlanarTrimSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
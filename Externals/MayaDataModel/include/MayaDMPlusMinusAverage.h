@@ -27,228 +27,228 @@ public:
 	void setOperation(unsigned int op)
 	{
 		if(op == 1) return;
-		fprintf(mFile,"\tsetAttr \".op\" %i;\n", op);
+		writeInt(mFile,"\tsetAttr \".op\" ",op,";\n");
 	}
 	void setInput1D(size_t i1_i,float i1)
 	{
 		if(i1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i1[%i]\" %f;\n", i1_i,i1);
+		writeInt(mFile,"\tsetAttr \".i1[",i1_i); writeFloat(mFile,"]\" ",i1,";\n");
 	}
 	void setInput1D(size_t i1_start,size_t i1_end,float* i1)
 	{
-		fprintf(mFile,"\tsetAttr \".i1[%i:%i]\" ", i1_start,i1_end);
+		writeInt(mFile,"\tsetAttr \".i1[",i1_start); writeInt(mFile,":",i1_end,"]\" ");
 		size_t size = (i1_end-i1_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",i1[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",i1[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput1D(size_t i1_start,size_t i1_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i1[%i:%i]\"",i1_start,i1_end);
+		writeInt(mFile,"\tsetAttr \".i1[",i1_start); writeInt(mFile,":",i1_end,"]\"");
 	}
 	void appendInput1D(float i1)const
 	{
-		fprintf(mFile," %f",i1);
+		writeFloat(mFile," ",i1);
 	}
 	void endInput1D()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput2D(size_t i2_i,const float2& i2)
 	{
 		if(i2 == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".i2[%i]\" -type \"float2\" ",i2_i);
+		writeInt(mFile,"\tsetAttr \".i2[",i2_i,"]\" -type \"float2\" ");
 		i2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput2D(size_t i2_start,size_t i2_end,float* i2)
 	{
-		fprintf(mFile,"\tsetAttr \".i2[%i:%i]\" ", i2_start,i2_end);
+		writeInt(mFile,"\tsetAttr \".i2[",i2_start); writeInt(mFile,":",i2_end,"]\" ");
 		size_t size = (i2_end-i2_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",i2[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",i2[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput2D(size_t i2_start,size_t i2_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i2[%i:%i]\"",i2_start,i2_end);
+		writeInt(mFile,"\tsetAttr \".i2[",i2_start); writeInt(mFile,":",i2_end,"]\"");
 	}
 	void appendInput2D(float i2)const
 	{
-		fprintf(mFile," %f",i2);
+		writeFloat(mFile," ",i2);
 	}
 	void endInput2D()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput2Dx(size_t i2_i,float i2x)
 	{
 		if(i2x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i2[%i].i2x\" %f;\n", i2_i,i2x);
+		writeInt(mFile,"\tsetAttr \".i2[",i2_i); writeFloat(mFile,"].i2x\" ",i2x,";\n");
 	}
 	void setInput2Dy(size_t i2_i,float i2y)
 	{
 		if(i2y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i2[%i].i2y\" %f;\n", i2_i,i2y);
+		writeInt(mFile,"\tsetAttr \".i2[",i2_i); writeFloat(mFile,"].i2y\" ",i2y,";\n");
 	}
 	void setInput3D(size_t i3_i,const float3& i3)
 	{
 		if(i3 == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".i3[%i]\" -type \"float3\" ",i3_i);
+		writeInt(mFile,"\tsetAttr \".i3[",i3_i,"]\" -type \"float3\" ");
 		i3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput3D(size_t i3_start,size_t i3_end,float* i3)
 	{
-		fprintf(mFile,"\tsetAttr \".i3[%i:%i]\" ", i3_start,i3_end);
+		writeInt(mFile,"\tsetAttr \".i3[",i3_start); writeInt(mFile,":",i3_end,"]\" ");
 		size_t size = (i3_end-i3_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",i3[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",i3[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput3D(size_t i3_start,size_t i3_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i3[%i:%i]\"",i3_start,i3_end);
+		writeInt(mFile,"\tsetAttr \".i3[",i3_start); writeInt(mFile,":",i3_end,"]\"");
 	}
 	void appendInput3D(float i3)const
 	{
-		fprintf(mFile," %f",i3);
+		writeFloat(mFile," ",i3);
 	}
 	void endInput3D()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput3Dx(size_t i3_i,float i3x)
 	{
 		if(i3x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i3[%i].i3x\" %f;\n", i3_i,i3x);
+		writeInt(mFile,"\tsetAttr \".i3[",i3_i); writeFloat(mFile,"].i3x\" ",i3x,";\n");
 	}
 	void setInput3Dy(size_t i3_i,float i3y)
 	{
 		if(i3y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i3[%i].i3y\" %f;\n", i3_i,i3y);
+		writeInt(mFile,"\tsetAttr \".i3[",i3_i); writeFloat(mFile,"].i3y\" ",i3y,";\n");
 	}
 	void setInput3Dz(size_t i3_i,float i3z)
 	{
 		if(i3z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i3[%i].i3z\" %f;\n", i3_i,i3z);
+		writeInt(mFile,"\tsetAttr \".i3[",i3_i); writeFloat(mFile,"].i3z\" ",i3z,";\n");
 	}
 	void getOperation()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getInput1D(size_t i1_i)const
 	{
-		fprintf(mFile,"\"%s.i1[%i]\"",mName.c_str(),i1_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i1[",i1_i,"]\"");
 	}
 	void getInput1D()const
 	{
 
-		fprintf(mFile,"\"%s.i1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i1\"");
 	}
 	void getInput2D(size_t i2_i)const
 	{
-		fprintf(mFile,"\"%s.i2[%i]\"",mName.c_str(),i2_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i2[",i2_i,"]\"");
 	}
 	void getInput2D()const
 	{
 
-		fprintf(mFile,"\"%s.i2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i2\"");
 	}
 	void getInput2Dx(size_t i2_i)const
 	{
-		fprintf(mFile,"\"%s.i2[%i].i2x\"",mName.c_str(),i2_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i2[",i2_i,"].i2x\"");
 	}
 	void getInput2Dx()const
 	{
 
-		fprintf(mFile,"\"%s.i2.i2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i2.i2x\"");
 	}
 	void getInput2Dy(size_t i2_i)const
 	{
-		fprintf(mFile,"\"%s.i2[%i].i2y\"",mName.c_str(),i2_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i2[",i2_i,"].i2y\"");
 	}
 	void getInput2Dy()const
 	{
 
-		fprintf(mFile,"\"%s.i2.i2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i2.i2y\"");
 	}
 	void getInput3D(size_t i3_i)const
 	{
-		fprintf(mFile,"\"%s.i3[%i]\"",mName.c_str(),i3_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i3[",i3_i,"]\"");
 	}
 	void getInput3D()const
 	{
 
-		fprintf(mFile,"\"%s.i3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i3\"");
 	}
 	void getInput3Dx(size_t i3_i)const
 	{
-		fprintf(mFile,"\"%s.i3[%i].i3x\"",mName.c_str(),i3_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i3[",i3_i,"].i3x\"");
 	}
 	void getInput3Dx()const
 	{
 
-		fprintf(mFile,"\"%s.i3.i3x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i3.i3x\"");
 	}
 	void getInput3Dy(size_t i3_i)const
 	{
-		fprintf(mFile,"\"%s.i3[%i].i3y\"",mName.c_str(),i3_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i3[",i3_i,"].i3y\"");
 	}
 	void getInput3Dy()const
 	{
 
-		fprintf(mFile,"\"%s.i3.i3y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i3.i3y\"");
 	}
 	void getInput3Dz(size_t i3_i)const
 	{
-		fprintf(mFile,"\"%s.i3[%i].i3z\"",mName.c_str(),i3_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i3[",i3_i,"].i3z\"");
 	}
 	void getInput3Dz()const
 	{
 
-		fprintf(mFile,"\"%s.i3.i3z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i3.i3z\"");
 	}
 	void getOutput1D()const
 	{
-		fprintf(mFile,"\"%s.o1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o1\"");
 	}
 	void getOutput2D()const
 	{
-		fprintf(mFile,"\"%s.o2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o2\"");
 	}
 	void getOutput2Dx()const
 	{
-		fprintf(mFile,"\"%s.o2.o2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o2.o2x\"");
 	}
 	void getOutput2Dy()const
 	{
-		fprintf(mFile,"\"%s.o2.o2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o2.o2y\"");
 	}
 	void getOutput3D()const
 	{
-		fprintf(mFile,"\"%s.o3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o3\"");
 	}
 	void getOutput3Dx()const
 	{
-		fprintf(mFile,"\"%s.o3.o3x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o3.o3x\"");
 	}
 	void getOutput3Dy()const
 	{
-		fprintf(mFile,"\"%s.o3.o3y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o3.o3y\"");
 	}
 	void getOutput3Dz()const
 	{
-		fprintf(mFile,"\"%s.o3.o3z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o3.o3z\"");
 	}
 protected:
 	PlusMinusAverage(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,14 +26,14 @@ public:
 		void write(FILE* file) const
 		{
 			targetTranslate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetRotatePivot.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetRotateTranslate.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", targetWeight);
+			writeString(file," ");
+			writeFloat(file,"",targetWeight);
 		}
 	};
 public:
@@ -45,429 +45,429 @@ public:
 
 	void setTarget(size_t tg_i,const Target& tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i]\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"]\" ");
 		tg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTarget(size_t tg_start,size_t tg_end,Target* tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\" ", tg_start,tg_end);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\" ");
 		size_t size = (tg_end-tg_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			tg[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTarget(size_t tg_start,size_t tg_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\"",tg_start,tg_end);
-		fprintf(mFile," -type \"Target\" ");
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\"");
+		writeString(mFile," -type \"Target\" ");
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		tg.write(mFile);
 	}
 	void endTarget()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetTranslate(size_t tg_i,const double3& tt)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tt\" -type \"double3\" ");
 		tt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetTranslateX(size_t tg_i,double ttx)
 	{
 		if(ttx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.ttx\" %f;\n", tg_i,ttx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.ttx\" ",ttx,";\n");
 	}
 	void setTargetTranslateY(size_t tg_i,double tty)
 	{
 		if(tty == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.tty\" %f;\n", tg_i,tty);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.tty\" ",tty,";\n");
 	}
 	void setTargetTranslateZ(size_t tg_i,double ttz)
 	{
 		if(ttz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tt.ttz\" %f;\n", tg_i,ttz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tt.ttz\" ",ttz,";\n");
 	}
 	void setTargetRotatePivot(size_t tg_i,const double3& trp)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].trp\" -type \"double3\" ");
 		trp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotatePivotX(size_t tg_i,double trpx)
 	{
 		if(trpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpx\" %f;\n", tg_i,trpx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpx\" ",trpx,";\n");
 	}
 	void setTargetRotatePivotY(size_t tg_i,double trpy)
 	{
 		if(trpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpy\" %f;\n", tg_i,trpy);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpy\" ",trpy,";\n");
 	}
 	void setTargetRotatePivotZ(size_t tg_i,double trpz)
 	{
 		if(trpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trp.trpz\" %f;\n", tg_i,trpz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trp.trpz\" ",trpz,";\n");
 	}
 	void setTargetRotateTranslate(size_t tg_i,const double3& trt)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].trt\" -type \"double3\" ");
 		trt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetRotateTranslateX(size_t tg_i,double trtx)
 	{
 		if(trtx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trtx\" %f;\n", tg_i,trtx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trtx\" ",trtx,";\n");
 	}
 	void setTargetRotateTranslateY(size_t tg_i,double trty)
 	{
 		if(trty == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trty\" %f;\n", tg_i,trty);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trty\" ",trty,";\n");
 	}
 	void setTargetRotateTranslateZ(size_t tg_i,double trtz)
 	{
 		if(trtz == 0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].trt.trtz\" %f;\n", tg_i,trtz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].trt.trtz\" ",trtz,";\n");
 	}
 	void setTargetParentMatrix(size_t tg_i,const matrix& tpm)
 	{
 		if(tpm == identity) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tpm\" -type \"matrix\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tpm\" -type \"matrix\" ");
 		tpm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetWeight(size_t tg_i,double tw)
 	{
 		if(tw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tw\" %f;\n", tg_i,tw);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tw\" ",tw,";\n");
 	}
 	void setConstraintParentInverseMatrix(const matrix& cpim)
 	{
 		if(cpim == identity) return;
-		fprintf(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
 		cpim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotatePivot(const double3& crp)
 	{
-		fprintf(mFile,"\tsetAttr \".crp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".crp\" -type \"double3\" ");
 		crp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotatePivotX(double crpx)
 	{
 		if(crpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpx\" %f;\n", crpx);
+		writeFloat(mFile,"\tsetAttr \".crp.crpx\" ",crpx,";\n");
 	}
 	void setConstraintRotatePivotY(double crpy)
 	{
 		if(crpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpy\" %f;\n", crpy);
+		writeFloat(mFile,"\tsetAttr \".crp.crpy\" ",crpy,";\n");
 	}
 	void setConstraintRotatePivotZ(double crpz)
 	{
 		if(crpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".crp.crpz\" %f;\n", crpz);
+		writeFloat(mFile,"\tsetAttr \".crp.crpz\" ",crpz,";\n");
 	}
 	void setConstraintRotateTranslate(const double3& crt)
 	{
-		fprintf(mFile,"\tsetAttr \".crt\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".crt\" -type \"double3\" ");
 		crt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotateTranslateX(double crtx)
 	{
 		if(crtx == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crtx\" %f;\n", crtx);
+		writeFloat(mFile,"\tsetAttr \".crt.crtx\" ",crtx,";\n");
 	}
 	void setConstraintRotateTranslateY(double crty)
 	{
 		if(crty == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crty\" %f;\n", crty);
+		writeFloat(mFile,"\tsetAttr \".crt.crty\" ",crty,";\n");
 	}
 	void setConstraintRotateTranslateZ(double crtz)
 	{
 		if(crtz == 0) return;
-		fprintf(mFile,"\tsetAttr \".crt.crtz\" %f;\n", crtz);
+		writeFloat(mFile,"\tsetAttr \".crt.crtz\" ",crtz,";\n");
 	}
 	void setOffset(const double3& o)
 	{
-		fprintf(mFile,"\tsetAttr \".o\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".o\" -type \"double3\" ");
 		o.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetX(double ox)
 	{
 		if(ox == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.ox\" %f;\n", ox);
+		writeFloat(mFile,"\tsetAttr \".o.ox\" ",ox,";\n");
 	}
 	void setOffsetY(double oy)
 	{
 		if(oy == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.oy\" %f;\n", oy);
+		writeFloat(mFile,"\tsetAttr \".o.oy\" ",oy,";\n");
 	}
 	void setOffsetZ(double oz)
 	{
 		if(oz == 0) return;
-		fprintf(mFile,"\tsetAttr \".o.oz\" %f;\n", oz);
+		writeFloat(mFile,"\tsetAttr \".o.oz\" ",oz,";\n");
 	}
 	void setConstraintOffsetPolarity(double cop)
 	{
 		if(cop == 1) return;
-		fprintf(mFile,"\tsetAttr \".cop\" %f;\n", cop);
+		writeFloat(mFile,"\tsetAttr \".cop\" ",cop,";\n");
 	}
 	void setRestTranslate(const double3& rst)
 	{
 		if(rst == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".rst\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rst\" -type \"double3\" ");
 		rst.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRestTranslateX(double rtx)
 	{
 		if(rtx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst.rtx\" %f;\n", rtx);
+		writeFloat(mFile,"\tsetAttr \".rst.rtx\" ",rtx,";\n");
 	}
 	void setRestTranslateY(double rty)
 	{
 		if(rty == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst.rty\" %f;\n", rty);
+		writeFloat(mFile,"\tsetAttr \".rst.rty\" ",rty,";\n");
 	}
 	void setRestTranslateZ(double rtz)
 	{
 		if(rtz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst.rtz\" %f;\n", rtz);
+		writeFloat(mFile,"\tsetAttr \".rst.rtz\" ",rtz,";\n");
 	}
 	void getTarget(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i]\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"]\"");
 	}
 	void getTarget()const
 	{
 
-		fprintf(mFile,"\"%s.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg\"");
 	}
 	void getTargetTranslate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt\"");
 	}
 	void getTargetTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt\"");
 	}
 	void getTargetTranslateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.ttx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.ttx\"");
 	}
 	void getTargetTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.ttx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.ttx\"");
 	}
 	void getTargetTranslateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.tty\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.tty\"");
 	}
 	void getTargetTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.tty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.tty\"");
 	}
 	void getTargetTranslateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tt.ttz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tt.ttz\"");
 	}
 	void getTargetTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tt.ttz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tt.ttz\"");
 	}
 	void getTargetRotatePivot(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp\"");
 	}
 	void getTargetRotatePivot()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp\"");
 	}
 	void getTargetRotatePivotX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpx\"");
 	}
 	void getTargetRotatePivotX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpx\"");
 	}
 	void getTargetRotatePivotY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpy\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpy\"");
 	}
 	void getTargetRotatePivotY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpy\"");
 	}
 	void getTargetRotatePivotZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trp.trpz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trp.trpz\"");
 	}
 	void getTargetRotatePivotZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trp.trpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trp.trpz\"");
 	}
 	void getTargetRotateTranslate(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt\"");
 	}
 	void getTargetRotateTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt\"");
 	}
 	void getTargetRotateTranslateX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trtx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trtx\"");
 	}
 	void getTargetRotateTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trtx\"");
 	}
 	void getTargetRotateTranslateY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trty\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trty\"");
 	}
 	void getTargetRotateTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trty\"");
 	}
 	void getTargetRotateTranslateZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].trt.trtz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].trt.trtz\"");
 	}
 	void getTargetRotateTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.trt.trtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.trt.trtz\"");
 	}
 	void getTargetParentMatrix(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tpm\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tpm\"");
 	}
 	void getTargetParentMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tpm\"");
 	}
 	void getTargetWeight(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tw\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tw\"");
 	}
 	void getTargetWeight()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tw\"");
 	}
 	void getConstraintParentInverseMatrix()const
 	{
-		fprintf(mFile,"\"%s.cpim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpim\"");
 	}
 	void getConstraintRotatePivot()const
 	{
-		fprintf(mFile,"\"%s.crp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp\"");
 	}
 	void getConstraintRotatePivotX()const
 	{
-		fprintf(mFile,"\"%s.crp.crpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpx\"");
 	}
 	void getConstraintRotatePivotY()const
 	{
-		fprintf(mFile,"\"%s.crp.crpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpy\"");
 	}
 	void getConstraintRotatePivotZ()const
 	{
-		fprintf(mFile,"\"%s.crp.crpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crp.crpz\"");
 	}
 	void getConstraintRotateTranslate()const
 	{
-		fprintf(mFile,"\"%s.crt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt\"");
 	}
 	void getConstraintRotateTranslateX()const
 	{
-		fprintf(mFile,"\"%s.crt.crtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crtx\"");
 	}
 	void getConstraintRotateTranslateY()const
 	{
-		fprintf(mFile,"\"%s.crt.crty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crty\"");
 	}
 	void getConstraintRotateTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.crt.crtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crt.crtz\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOffsetX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOffsetY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 	void getConstraintOffsetPolarity()const
 	{
-		fprintf(mFile,"\"%s.cop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cop\"");
 	}
 	void getConstraintTranslate()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getConstraintTranslateX()const
 	{
-		fprintf(mFile,"\"%s.ct.ctx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctx\"");
 	}
 	void getConstraintTranslateY()const
 	{
-		fprintf(mFile,"\"%s.ct.cty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.cty\"");
 	}
 	void getConstraintTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.ct.ctz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct.ctz\"");
 	}
 	void getRestTranslate()const
 	{
-		fprintf(mFile,"\"%s.rst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rst\"");
 	}
 	void getRestTranslateX()const
 	{
-		fprintf(mFile,"\"%s.rst.rtx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rst.rtx\"");
 	}
 	void getRestTranslateY()const
 	{
-		fprintf(mFile,"\"%s.rst.rty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rst.rty\"");
 	}
 	void getRestTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.rst.rtz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rst.rtz\"");
 	}
 protected:
 	PointConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
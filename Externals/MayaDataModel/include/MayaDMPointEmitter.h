@@ -27,615 +27,615 @@ public:
 	void setEmitterType(unsigned int emt)
 	{
 		if(emt == 1) return;
-		fprintf(mFile,"\tsetAttr \".emt\" %i;\n", emt);
+		writeInt(mFile,"\tsetAttr \".emt\" ",emt,";\n");
 	}
 	void setRate(double rat)
 	{
 		if(rat == 100) return;
-		fprintf(mFile,"\tsetAttr \".rat\" %f;\n", rat);
+		writeFloat(mFile,"\tsetAttr \".rat\" ",rat,";\n");
 	}
 	void setScaleRateByObjectSize(bool sro)
 	{
 		if(sro == true) return;
-		fprintf(mFile,"\tsetAttr \".sro\" %i;\n", sro);
+		writeInt(mFile,"\tsetAttr \".sro\" ",sro,";\n");
 	}
 	void setUseRatePP(bool urpp)
 	{
 		if(urpp == false) return;
-		fprintf(mFile,"\tsetAttr \".urpp\" %i;\n", urpp);
+		writeInt(mFile,"\tsetAttr \".urpp\" ",urpp,";\n");
 	}
 	void setNeedParentUV(bool npuv)
 	{
 		if(npuv == false) return;
-		fprintf(mFile,"\tsetAttr \".npuv\" %i;\n", npuv);
+		writeInt(mFile,"\tsetAttr \".npuv\" ",npuv,";\n");
 	}
 	void setCycleEmission(unsigned int cye)
 	{
 		if(cye == 0) return;
-		fprintf(mFile,"\tsetAttr \".cye\" %i;\n", cye);
+		writeInt(mFile,"\tsetAttr \".cye\" ",cye,";\n");
 	}
 	void setCycleInterval(int cyi)
 	{
 		if(cyi == 1) return;
-		fprintf(mFile,"\tsetAttr \".cyi\" %i;\n", cyi);
+		writeInt(mFile,"\tsetAttr \".cyi\" ",cyi,";\n");
 	}
 	void setDeltaTimeCycle(size_t dtc_i,double dtc)
 	{
 		if(dtc == 0) return;
-		fprintf(mFile,"\tsetAttr \".dtc[%i]\" %f;\n", dtc_i,dtc);
+		writeInt(mFile,"\tsetAttr \".dtc[",dtc_i); writeFloat(mFile,"]\" ",dtc,";\n");
 	}
 	void setDeltaTimeCycle(size_t dtc_start,size_t dtc_end,double* dtc)
 	{
-		fprintf(mFile,"\tsetAttr \".dtc[%i:%i]\" ", dtc_start,dtc_end);
+		writeInt(mFile,"\tsetAttr \".dtc[",dtc_start); writeInt(mFile,":",dtc_end,"]\" ");
 		size_t size = (dtc_end-dtc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",dtc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",dtc[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDeltaTimeCycle(size_t dtc_start,size_t dtc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".dtc[%i:%i]\"",dtc_start,dtc_end);
+		writeInt(mFile,"\tsetAttr \".dtc[",dtc_start); writeInt(mFile,":",dtc_end,"]\"");
 	}
 	void appendDeltaTimeCycle(double dtc)const
 	{
-		fprintf(mFile," %f",dtc);
+		writeFloat(mFile," ",dtc);
 	}
 	void endDeltaTimeCycle()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxDistance(double max)
 	{
 		if(max == 0) return;
-		fprintf(mFile,"\tsetAttr \".max\" %f;\n", max);
+		writeFloat(mFile,"\tsetAttr \".max\" ",max,";\n");
 	}
 	void setMinDistance(double min)
 	{
 		if(min == 0) return;
-		fprintf(mFile,"\tsetAttr \".min\" %f;\n", min);
+		writeFloat(mFile,"\tsetAttr \".min\" ",min,";\n");
 	}
 	void setDirection(const double3& d)
 	{
-		fprintf(mFile,"\tsetAttr \".d\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"double3\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionX(double dx)
 	{
 		if(dx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dx\" %f;\n", dx);
+		writeFloat(mFile,"\tsetAttr \".d.dx\" ",dx,";\n");
 	}
 	void setDirectionY(double dy)
 	{
 		if(dy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dy\" %f;\n", dy);
+		writeFloat(mFile,"\tsetAttr \".d.dy\" ",dy,";\n");
 	}
 	void setDirectionZ(double dz)
 	{
 		if(dz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dz\" %f;\n", dz);
+		writeFloat(mFile,"\tsetAttr \".d.dz\" ",dz,";\n");
 	}
 	void setSpread(double spr)
 	{
 		if(spr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spr\" %f;\n", spr);
+		writeFloat(mFile,"\tsetAttr \".spr\" ",spr,";\n");
 	}
 	void setSpeed(double spd)
 	{
 		if(spd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".spd\" %f;\n", spd);
+		writeFloat(mFile,"\tsetAttr \".spd\" ",spd,";\n");
 	}
 	void setSpeedRandom(double srnd)
 	{
 		if(srnd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".srnd\" %f;\n", srnd);
+		writeFloat(mFile,"\tsetAttr \".srnd\" ",srnd,";\n");
 	}
 	void setTangentSpeed(double tspd)
 	{
 		if(tspd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tspd\" %f;\n", tspd);
+		writeFloat(mFile,"\tsetAttr \".tspd\" ",tspd,";\n");
 	}
 	void setNormalSpeed(double nspd)
 	{
 		if(nspd == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".nspd\" %f;\n", nspd);
+		writeFloat(mFile,"\tsetAttr \".nspd\" ",nspd,";\n");
 	}
 	void setInheritFactor(size_t inh_i,double inh)
 	{
 		if(inh == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".inh[%i]\" %f;\n", inh_i,inh);
+		writeInt(mFile,"\tsetAttr \".inh[",inh_i); writeFloat(mFile,"]\" ",inh,";\n");
 	}
 	void setInheritFactor(size_t inh_start,size_t inh_end,double* inh)
 	{
-		fprintf(mFile,"\tsetAttr \".inh[%i:%i]\" ", inh_start,inh_end);
+		writeInt(mFile,"\tsetAttr \".inh[",inh_start); writeInt(mFile,":",inh_end,"]\" ");
 		size_t size = (inh_end-inh_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",inh[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",inh[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInheritFactor(size_t inh_start,size_t inh_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".inh[%i:%i]\"",inh_start,inh_end);
+		writeInt(mFile,"\tsetAttr \".inh[",inh_start); writeInt(mFile,":",inh_end,"]\"");
 	}
 	void appendInheritFactor(double inh)const
 	{
-		fprintf(mFile," %f",inh);
+		writeFloat(mFile," ",inh);
 	}
 	void endInheritFactor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIsFull(size_t full_i,bool full)
 	{
 		if(full == false) return;
-		fprintf(mFile,"\tsetAttr \".full[%i]\" %i;\n", full_i,full);
+		writeInt(mFile,"\tsetAttr \".full[",full_i); writeInt(mFile,"]\" ",full,";\n");
 	}
 	void setIsFull(size_t full_start,size_t full_end,bool* full)
 	{
-		fprintf(mFile,"\tsetAttr \".full[%i:%i]\" ", full_start,full_end);
+		writeInt(mFile,"\tsetAttr \".full[",full_start); writeInt(mFile,":",full_end,"]\" ");
 		size_t size = (full_end-full_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",full[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",full[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startIsFull(size_t full_start,size_t full_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".full[%i:%i]\"",full_start,full_end);
+		writeInt(mFile,"\tsetAttr \".full[",full_start); writeInt(mFile,":",full_end,"]\"");
 	}
 	void appendIsFull(bool full)const
 	{
-		fprintf(mFile," %i",full);
+		writeInt(mFile," ",full);
 	}
 	void endIsFull()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRatePP(const doubleArray& rpp)
 	{
 		if(rpp.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".rpp\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".rpp\" -type \"doubleArray\" ");
 		rpp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParentId(const doubleArray& paid)
 	{
 		if(paid.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".paid\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".paid\" -type \"doubleArray\" ");
 		paid.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRandStateX(size_t rst_i,int rstx)
 	{
 		if(rstx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst[%i].rstx\" %i;\n", rst_i,rstx);
+		writeInt(mFile,"\tsetAttr \".rst[",rst_i); writeInt(mFile,"].rstx\" ",rstx,";\n");
 	}
 	void setRandStateY(size_t rst_i,int rsty)
 	{
 		if(rsty == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst[%i].rsty\" %i;\n", rst_i,rsty);
+		writeInt(mFile,"\tsetAttr \".rst[",rst_i); writeInt(mFile,"].rsty\" ",rsty,";\n");
 	}
 	void setRandStateZ(size_t rst_i,int rstz)
 	{
 		if(rstz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rst[%i].rstz\" %i;\n", rst_i,rstz);
+		writeInt(mFile,"\tsetAttr \".rst[",rst_i); writeInt(mFile,"].rstz\" ",rstz,";\n");
 	}
 	void setEnableTextureRate(bool etr)
 	{
 		if(etr == false) return;
-		fprintf(mFile,"\tsetAttr \".etr\" %i;\n", etr);
+		writeInt(mFile,"\tsetAttr \".etr\" ",etr,";\n");
 	}
 	void setTextureRate(const float3& txr)
 	{
 		if(txr == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".txr\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".txr\" -type \"float3\" ");
 		txr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTextureRateR(float txrr)
 	{
 		if(txrr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".txr.txrr\" %f;\n", txrr);
+		writeFloat(mFile,"\tsetAttr \".txr.txrr\" ",txrr,";\n");
 	}
 	void setTextureRateG(float txrg)
 	{
 		if(txrg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".txr.txrg\" %f;\n", txrg);
+		writeFloat(mFile,"\tsetAttr \".txr.txrg\" ",txrg,";\n");
 	}
 	void setTextureRateB(float txrb)
 	{
 		if(txrb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".txr.txrb\" %f;\n", txrb);
+		writeFloat(mFile,"\tsetAttr \".txr.txrb\" ",txrb,";\n");
 	}
 	void setEmitFromDark(bool efd)
 	{
 		if(efd == false) return;
-		fprintf(mFile,"\tsetAttr \".efd\" %i;\n", efd);
+		writeInt(mFile,"\tsetAttr \".efd\" ",efd,";\n");
 	}
 	void setInheritColor(bool inhc)
 	{
 		if(inhc == false) return;
-		fprintf(mFile,"\tsetAttr \".inhc\" %i;\n", inhc);
+		writeInt(mFile,"\tsetAttr \".inhc\" ",inhc,";\n");
 	}
 	void setInheritOpacity(bool inho)
 	{
 		if(inho == false) return;
-		fprintf(mFile,"\tsetAttr \".inho\" %i;\n", inho);
+		writeInt(mFile,"\tsetAttr \".inho\" ",inho,";\n");
 	}
 	void setInvertOpacity(bool invo)
 	{
 		if(invo == false) return;
-		fprintf(mFile,"\tsetAttr \".invo\" %i;\n", invo);
+		writeInt(mFile,"\tsetAttr \".invo\" ",invo,";\n");
 	}
 	void setUseLuminance(bool usel)
 	{
 		if(usel == false) return;
-		fprintf(mFile,"\tsetAttr \".usel\" %i;\n", usel);
+		writeInt(mFile,"\tsetAttr \".usel\" ",usel,";\n");
 	}
 	void setParticleColor(const float3& pc)
 	{
 		if(pc == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".pc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pc\" -type \"float3\" ");
 		pc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParticleColorR(float pcr)
 	{
 		if(pcr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcr\" %f;\n", pcr);
+		writeFloat(mFile,"\tsetAttr \".pc.pcr\" ",pcr,";\n");
 	}
 	void setParticleColorG(float pcg)
 	{
 		if(pcg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcg\" %f;\n", pcg);
+		writeFloat(mFile,"\tsetAttr \".pc.pcg\" ",pcg,";\n");
 	}
 	void setParticleColorB(float pcb)
 	{
 		if(pcb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcb\" %f;\n", pcb);
+		writeFloat(mFile,"\tsetAttr \".pc.pcb\" ",pcb,";\n");
 	}
 	void setVolumeShape(unsigned int vol)
 	{
 		if(vol == 0) return;
-		fprintf(mFile,"\tsetAttr \".vol\" %i;\n", vol);
+		writeInt(mFile,"\tsetAttr \".vol\" ",vol,";\n");
 	}
 	void setVolumeOffset(const double3& vof)
 	{
-		fprintf(mFile,"\tsetAttr \".vof\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".vof\" -type \"double3\" ");
 		vof.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVolumeOffsetX(double vfx)
 	{
 		if(vfx == 0) return;
-		fprintf(mFile,"\tsetAttr \".vof.vfx\" %f;\n", vfx);
+		writeFloat(mFile,"\tsetAttr \".vof.vfx\" ",vfx,";\n");
 	}
 	void setVolumeOffsetY(double vfy)
 	{
 		if(vfy == 0) return;
-		fprintf(mFile,"\tsetAttr \".vof.vfy\" %f;\n", vfy);
+		writeFloat(mFile,"\tsetAttr \".vof.vfy\" ",vfy,";\n");
 	}
 	void setVolumeOffsetZ(double vfz)
 	{
 		if(vfz == 0) return;
-		fprintf(mFile,"\tsetAttr \".vof.vfz\" %f;\n", vfz);
+		writeFloat(mFile,"\tsetAttr \".vof.vfz\" ",vfz,";\n");
 	}
 	void setVolumeSweep(double vsw)
 	{
 		if(vsw == 3) return;
-		fprintf(mFile,"\tsetAttr \".vsw\" %f;\n", vsw);
+		writeFloat(mFile,"\tsetAttr \".vsw\" ",vsw,";\n");
 	}
 	void setSectionRadius(double vsr)
 	{
 		if(vsr == 0) return;
-		fprintf(mFile,"\tsetAttr \".vsr\" %f;\n", vsr);
+		writeFloat(mFile,"\tsetAttr \".vsr\" ",vsr,";\n");
 	}
 	void setAwayFromCenter(double afc)
 	{
 		if(afc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".afc\" %f;\n", afc);
+		writeFloat(mFile,"\tsetAttr \".afc\" ",afc,";\n");
 	}
 	void setAwayFromAxis(double afa)
 	{
 		if(afa == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".afa\" %f;\n", afa);
+		writeFloat(mFile,"\tsetAttr \".afa\" ",afa,";\n");
 	}
 	void setAlongAxis(double alx)
 	{
 		if(alx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".alx\" %f;\n", alx);
+		writeFloat(mFile,"\tsetAttr \".alx\" ",alx,";\n");
 	}
 	void setAroundAxis(double arx)
 	{
 		if(arx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".arx\" %f;\n", arx);
+		writeFloat(mFile,"\tsetAttr \".arx\" ",arx,";\n");
 	}
 	void setRandomDirection(double rnd)
 	{
 		if(rnd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rnd\" %f;\n", rnd);
+		writeFloat(mFile,"\tsetAttr \".rnd\" ",rnd,";\n");
 	}
 	void setDirectionalSpeed(double drs)
 	{
 		if(drs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".drs\" %f;\n", drs);
+		writeFloat(mFile,"\tsetAttr \".drs\" ",drs,";\n");
 	}
 	void setScaleSpeedBySize(bool ssz)
 	{
 		if(ssz == false) return;
-		fprintf(mFile,"\tsetAttr \".ssz\" %i;\n", ssz);
+		writeInt(mFile,"\tsetAttr \".ssz\" ",ssz,";\n");
 	}
 	void setDisplaySpeed(bool dss)
 	{
 		if(dss == true) return;
-		fprintf(mFile,"\tsetAttr \".dss\" %i;\n", dss);
+		writeInt(mFile,"\tsetAttr \".dss\" ",dss,";\n");
 	}
 	void getEmitterType()const
 	{
-		fprintf(mFile,"\"%s.emt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".emt\"");
 	}
 	void getRate()const
 	{
-		fprintf(mFile,"\"%s.rat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rat\"");
 	}
 	void getCycleEmission()const
 	{
-		fprintf(mFile,"\"%s.cye\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cye\"");
 	}
 	void getCycleInterval()const
 	{
-		fprintf(mFile,"\"%s.cyi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cyi\"");
 	}
 	void getMaxDistance()const
 	{
-		fprintf(mFile,"\"%s.max\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".max\"");
 	}
 	void getMinDistance()const
 	{
-		fprintf(mFile,"\"%s.min\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".min\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDirectionX()const
 	{
-		fprintf(mFile,"\"%s.d.dx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dx\"");
 	}
 	void getDirectionY()const
 	{
-		fprintf(mFile,"\"%s.d.dy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dy\"");
 	}
 	void getDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.d.dz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dz\"");
 	}
 	void getSpread()const
 	{
-		fprintf(mFile,"\"%s.spr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spr\"");
 	}
 	void getSpeed()const
 	{
-		fprintf(mFile,"\"%s.spd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spd\"");
 	}
 	void getSpeedRandom()const
 	{
-		fprintf(mFile,"\"%s.srnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srnd\"");
 	}
 	void getTangentSpeed()const
 	{
-		fprintf(mFile,"\"%s.tspd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tspd\"");
 	}
 	void getNormalSpeed()const
 	{
-		fprintf(mFile,"\"%s.nspd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nspd\"");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getInheritFactor(size_t inh_i)const
 	{
-		fprintf(mFile,"\"%s.inh[%i]\"",mName.c_str(),inh_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".inh[",inh_i,"]\"");
 	}
 	void getInheritFactor()const
 	{
 
-		fprintf(mFile,"\"%s.inh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inh\"");
 	}
 	void getIsFull(size_t full_i)const
 	{
-		fprintf(mFile,"\"%s.full[%i]\"",mName.c_str(),full_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".full[",full_i,"]\"");
 	}
 	void getIsFull()const
 	{
 
-		fprintf(mFile,"\"%s.full\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".full\"");
 	}
 	void getStartTime(size_t stt_i)const
 	{
-		fprintf(mFile,"\"%s.stt[%i]\"",mName.c_str(),stt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".stt[",stt_i,"]\"");
 	}
 	void getStartTime()const
 	{
 
-		fprintf(mFile,"\"%s.stt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stt\"");
 	}
 	void getDeltaTime(size_t dt_i)const
 	{
-		fprintf(mFile,"\"%s.dt[%i]\"",mName.c_str(),dt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dt[",dt_i,"]\"");
 	}
 	void getDeltaTime()const
 	{
 
-		fprintf(mFile,"\"%s.dt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dt\"");
 	}
 	void getEmitCountRemainder(size_t ecr_i)const
 	{
-		fprintf(mFile,"\"%s.ecr[%i]\"",mName.c_str(),ecr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ecr[",ecr_i,"]\"");
 	}
 	void getEmitCountRemainder()const
 	{
 
-		fprintf(mFile,"\"%s.ecr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecr\"");
 	}
 	void getRatePP()const
 	{
-		fprintf(mFile,"\"%s.rpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpp\"");
 	}
 	void getParentId()const
 	{
-		fprintf(mFile,"\"%s.paid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".paid\"");
 	}
 	void getSweptGeometry()const
 	{
-		fprintf(mFile,"\"%s.swge\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".swge\"");
 	}
 	void getOutput(size_t ot_i)const
 	{
-		fprintf(mFile,"\"%s.ot[%i]\"",mName.c_str(),ot_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ot[",ot_i,"]\"");
 	}
 	void getOutput()const
 	{
 
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getSeed(size_t sd_i)const
 	{
-		fprintf(mFile,"\"%s.sd[%i]\"",mName.c_str(),sd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sd[",sd_i,"]\"");
 	}
 	void getSeed()const
 	{
 
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getEnableTextureRate()const
 	{
-		fprintf(mFile,"\"%s.etr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".etr\"");
 	}
 	void getTextureRate()const
 	{
-		fprintf(mFile,"\"%s.txr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txr\"");
 	}
 	void getTextureRateR()const
 	{
-		fprintf(mFile,"\"%s.txr.txrr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txr.txrr\"");
 	}
 	void getTextureRateG()const
 	{
-		fprintf(mFile,"\"%s.txr.txrg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txr.txrg\"");
 	}
 	void getTextureRateB()const
 	{
-		fprintf(mFile,"\"%s.txr.txrb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txr.txrb\"");
 	}
 	void getEmitFromDark()const
 	{
-		fprintf(mFile,"\"%s.efd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".efd\"");
 	}
 	void getInheritColor()const
 	{
-		fprintf(mFile,"\"%s.inhc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inhc\"");
 	}
 	void getInheritOpacity()const
 	{
-		fprintf(mFile,"\"%s.inho\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inho\"");
 	}
 	void getInvertOpacity()const
 	{
-		fprintf(mFile,"\"%s.invo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".invo\"");
 	}
 	void getUseLuminance()const
 	{
-		fprintf(mFile,"\"%s.usel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".usel\"");
 	}
 	void getParticleColor()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getParticleColorR()const
 	{
-		fprintf(mFile,"\"%s.pc.pcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcr\"");
 	}
 	void getParticleColorG()const
 	{
-		fprintf(mFile,"\"%s.pc.pcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcg\"");
 	}
 	void getParticleColorB()const
 	{
-		fprintf(mFile,"\"%s.pc.pcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcb\"");
 	}
 	void getVolumeShape()const
 	{
-		fprintf(mFile,"\"%s.vol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vol\"");
 	}
 	void getVolumeOffset()const
 	{
-		fprintf(mFile,"\"%s.vof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vof\"");
 	}
 	void getVolumeOffsetX()const
 	{
-		fprintf(mFile,"\"%s.vof.vfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vof.vfx\"");
 	}
 	void getVolumeOffsetY()const
 	{
-		fprintf(mFile,"\"%s.vof.vfy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vof.vfy\"");
 	}
 	void getVolumeOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.vof.vfz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vof.vfz\"");
 	}
 	void getVolumeEfficiency()const
 	{
-		fprintf(mFile,"\"%s.vef\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vef\"");
 	}
 	void getVolumeSweep()const
 	{
-		fprintf(mFile,"\"%s.vsw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vsw\"");
 	}
 	void getSectionRadius()const
 	{
-		fprintf(mFile,"\"%s.vsr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vsr\"");
 	}
 	void getAwayFromCenter()const
 	{
-		fprintf(mFile,"\"%s.afc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".afc\"");
 	}
 	void getAwayFromAxis()const
 	{
-		fprintf(mFile,"\"%s.afa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".afa\"");
 	}
 	void getAlongAxis()const
 	{
-		fprintf(mFile,"\"%s.alx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".alx\"");
 	}
 	void getAroundAxis()const
 	{
-		fprintf(mFile,"\"%s.arx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".arx\"");
 	}
 	void getRandomDirection()const
 	{
-		fprintf(mFile,"\"%s.rnd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rnd\"");
 	}
 	void getDirectionalSpeed()const
 	{
-		fprintf(mFile,"\"%s.drs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drs\"");
 	}
 	void getScaleSpeedBySize()const
 	{
-		fprintf(mFile,"\"%s.ssz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssz\"");
 	}
 	void getDisplaySpeed()const
 	{
-		fprintf(mFile,"\"%s.dss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dss\"");
 	}
 protected:
 	PointEmitter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
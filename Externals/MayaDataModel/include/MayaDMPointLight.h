@@ -49,41 +49,41 @@ public:
 		bool areaVisible;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miExportMrLight);
-			fprintf(file,"%i ", emitPhotons);
+			writeInt(file,"",miExportMrLight," ");
+			writeInt(file,"",emitPhotons," ");
 			energy.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", photonIntensity);
-			fprintf(file,"%f ", exponent);
-			fprintf(file,"%i ", causticPhotons);
-			fprintf(file,"%i ", globIllPhotons);
-			fprintf(file,"%i ", shadowMap);
-			fprintf(file,"%i ", smapResolution);
-			fprintf(file,"%i ", smapSamples);
-			fprintf(file,"%f ", smapSoftness);
-			fprintf(file,"%f ", smapBias);
+			writeString(file," ");
+			writeFloat(file,"",photonIntensity," ");
+			writeFloat(file,"",exponent," ");
+			writeInt(file,"",causticPhotons," ");
+			writeInt(file,"",globIllPhotons," ");
+			writeInt(file,"",shadowMap," ");
+			writeInt(file,"",smapResolution," ");
+			writeInt(file,"",smapSamples," ");
+			writeFloat(file,"",smapSoftness," ");
+			writeFloat(file,"",smapBias," ");
 			smapFilename.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", smapLightName);
-			fprintf(file,"%i ", smapSceneName);
-			fprintf(file,"%i ", smapFrameExt);
-			fprintf(file,"%i ", smapDetail);
-			fprintf(file,"%i ", smapDetailSamples);
-			fprintf(file,"%f ", smapDetailAccuracy);
-			fprintf(file,"%i ", smapDetailAlpha);
-			fprintf(file,"%i ", areaLight);
-			fprintf(file,"%i ", areaType);
+			writeString(file," ");
+			writeInt(file,"",smapLightName," ");
+			writeInt(file,"",smapSceneName," ");
+			writeInt(file,"",smapFrameExt," ");
+			writeInt(file,"",smapDetail," ");
+			writeInt(file,"",smapDetailSamples," ");
+			writeFloat(file,"",smapDetailAccuracy," ");
+			writeInt(file,"",smapDetailAlpha," ");
+			writeInt(file,"",areaLight," ");
+			writeInt(file,"",areaType," ");
 			areaNormal.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			areaEdge.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", areaRadius);
+			writeString(file," ");
+			writeFloat(file,"",areaRadius," ");
 			areaSampling.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", areaLowLevel);
+			writeString(file," ");
+			writeInt(file,"",areaLowLevel," ");
 			areaLowSampling.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", areaVisible);
+			writeString(file," ");
+			writeInt(file,"",areaVisible," ");
 		}
 	};
 public:
@@ -96,7 +96,7 @@ public:
 	void setFogRadius(float fr)
 	{
 		if(fr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setObjectType(char ot)
 	{
@@ -106,523 +106,523 @@ public:
 	void setFogType(unsigned int ft)
 	{
 		if(ft == 0) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %i;\n", ft);
+		writeInt(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setPointWorld(const float3& pw)
 	{
 		if(pw == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
 		pw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointWorldX(float tx)
 	{
 		if(tx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.tx\" %f;\n", tx);
+		writeFloat(mFile,"\tsetAttr \".pw.tx\" ",tx,";\n");
 	}
 	void setPointWorldY(float ty)
 	{
 		if(ty == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.ty\" %f;\n", ty);
+		writeFloat(mFile,"\tsetAttr \".pw.ty\" ",ty,";\n");
 	}
 	void setPointWorldZ(float tz)
 	{
 		if(tz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.tz\" %f;\n", tz);
+		writeFloat(mFile,"\tsetAttr \".pw.tz\" ",tz,";\n");
 	}
 	void setFarPointWorld(const float3& fw)
 	{
 		if(fw == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".fw\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fw\" -type \"float3\" ");
 		fw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFarPointWorldX(float fwx)
 	{
 		if(fwx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fw.fwx\" %f;\n", fwx);
+		writeFloat(mFile,"\tsetAttr \".fw.fwx\" ",fwx,";\n");
 	}
 	void setFarPointWorldY(float fwy)
 	{
 		if(fwy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fw.fwy\" %f;\n", fwy);
+		writeFloat(mFile,"\tsetAttr \".fw.fwy\" ",fwy,";\n");
 	}
 	void setFarPointWorldZ(float fwz)
 	{
 		if(fwz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fw.fwz\" %f;\n", fwz);
+		writeFloat(mFile,"\tsetAttr \".fw.fwz\" ",fwz,";\n");
 	}
 	void setFogIntensity(float fin)
 	{
 		if(fin == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fin\" %f;\n", fin);
+		writeFloat(mFile,"\tsetAttr \".fin\" ",fin,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiExportMrLight(bool milt)
 	{
 		if(milt == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.milt\" %i;\n", milt);
+		writeInt(mFile,"\tsetAttr \".mrc.milt\" ",milt,";\n");
 	}
 	void setEmitPhotons(bool phot)
 	{
 		if(phot == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.phot\" %i;\n", phot);
+		writeInt(mFile,"\tsetAttr \".mrc.phot\" ",phot,";\n");
 	}
 	void setEnergy(const float3& eng)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc.eng\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mrc.eng\" -type \"float3\" ");
 		eng.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnergyR(float engr)
 	{
 		if(engr == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engr\" %f;\n", engr);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engr\" ",engr,";\n");
 	}
 	void setEnergyG(float engg)
 	{
 		if(engg == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engg\" %f;\n", engg);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engg\" ",engg,";\n");
 	}
 	void setEnergyB(float engb)
 	{
 		if(engb == 8000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.eng.engb\" %f;\n", engb);
+		writeFloat(mFile,"\tsetAttr \".mrc.eng.engb\" ",engb,";\n");
 	}
 	void setPhotonIntensity(float phi)
 	{
 		if(phi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.phi\" %f;\n", phi);
+		writeFloat(mFile,"\tsetAttr \".mrc.phi\" ",phi,";\n");
 	}
 	void setExponent(float exp)
 	{
 		if(exp == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.exp\" %f;\n", exp);
+		writeFloat(mFile,"\tsetAttr \".mrc.exp\" ",exp,";\n");
 	}
 	void setCausticPhotons(int cph)
 	{
 		if(cph == 10000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.cph\" %i;\n", cph);
+		writeInt(mFile,"\tsetAttr \".mrc.cph\" ",cph,";\n");
 	}
 	void setGlobIllPhotons(int gph)
 	{
 		if(gph == 10000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gph\" %i;\n", gph);
+		writeInt(mFile,"\tsetAttr \".mrc.gph\" ",gph,";\n");
 	}
 	void setShadowMap(bool usm)
 	{
 		if(usm == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.usm\" %i;\n", usm);
+		writeInt(mFile,"\tsetAttr \".mrc.usm\" ",usm,";\n");
 	}
 	void setSmapResolution(int smr)
 	{
 		if(smr == 256) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smr\" %i;\n", smr);
+		writeInt(mFile,"\tsetAttr \".mrc.smr\" ",smr,";\n");
 	}
 	void setSmapSamples(short smsa)
 	{
 		if(smsa == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smsa\" %i;\n", smsa);
+		writeInt(mFile,"\tsetAttr \".mrc.smsa\" ",smsa,";\n");
 	}
 	void setSmapSoftness(float smso)
 	{
 		if(smso == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smso\" %f;\n", smso);
+		writeFloat(mFile,"\tsetAttr \".mrc.smso\" ",smso,";\n");
 	}
 	void setSmapBias(float smb)
 	{
 		if(smb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smb\" %f;\n", smb);
+		writeFloat(mFile,"\tsetAttr \".mrc.smb\" ",smb,";\n");
 	}
 	void setSmapFilename(const string& smf)
 	{
 		if(smf == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".mrc.smf\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".mrc.smf\" -type \"string\" ");
 		smf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSmapLightName(bool smln)
 	{
 		if(smln == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smln\" %i;\n", smln);
+		writeInt(mFile,"\tsetAttr \".mrc.smln\" ",smln,";\n");
 	}
 	void setSmapSceneName(bool smsn)
 	{
 		if(smsn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smsn\" %i;\n", smsn);
+		writeInt(mFile,"\tsetAttr \".mrc.smsn\" ",smsn,";\n");
 	}
 	void setSmapFrameExt(bool smfe)
 	{
 		if(smfe == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smfe\" %i;\n", smfe);
+		writeInt(mFile,"\tsetAttr \".mrc.smfe\" ",smfe,";\n");
 	}
 	void setSmapDetail(bool smd)
 	{
 		if(smd == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.smd\" %i;\n", smd);
+		writeInt(mFile,"\tsetAttr \".mrc.smd\" ",smd,";\n");
 	}
 	void setSmapDetailSamples(short sds)
 	{
 		if(sds == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sds\" %i;\n", sds);
+		writeInt(mFile,"\tsetAttr \".mrc.sds\" ",sds,";\n");
 	}
 	void setSmapDetailAccuracy(float sdac)
 	{
 		if(sdac == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sdac\" %f;\n", sdac);
+		writeFloat(mFile,"\tsetAttr \".mrc.sdac\" ",sdac,";\n");
 	}
 	void setSmapDetailAlpha(bool sdal)
 	{
 		if(sdal == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.sdal\" %i;\n", sdal);
+		writeInt(mFile,"\tsetAttr \".mrc.sdal\" ",sdal,";\n");
 	}
 	void setAreaLight(bool algt)
 	{
 		if(algt == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.algt\" %i;\n", algt);
+		writeInt(mFile,"\tsetAttr \".mrc.algt\" ",algt,";\n");
 	}
 	void setAreaType(unsigned int atyp)
 	{
 		if(atyp == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.atyp\" %i;\n", atyp);
+		writeInt(mFile,"\tsetAttr \".mrc.atyp\" ",atyp,";\n");
 	}
 	void setAreaNormal(const float3& ano)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc.ano\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mrc.ano\" -type \"float3\" ");
 		ano.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAreaNormalX(float anox)
 	{
 		if(anox == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ano.anox\" %f;\n", anox);
+		writeFloat(mFile,"\tsetAttr \".mrc.ano.anox\" ",anox,";\n");
 	}
 	void setAreaNormalY(float anoy)
 	{
 		if(anoy == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ano.anoy\" %f;\n", anoy);
+		writeFloat(mFile,"\tsetAttr \".mrc.ano.anoy\" ",anoy,";\n");
 	}
 	void setAreaNormalZ(float anoz)
 	{
 		if(anoz == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ano.anoz\" %f;\n", anoz);
+		writeFloat(mFile,"\tsetAttr \".mrc.ano.anoz\" ",anoz,";\n");
 	}
 	void setAreaEdge(const float3& aed)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc.aed\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mrc.aed\" -type \"float3\" ");
 		aed.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAreaEdgeX(float aedx)
 	{
 		if(aedx == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.aed.aedx\" %f;\n", aedx);
+		writeFloat(mFile,"\tsetAttr \".mrc.aed.aedx\" ",aedx,";\n");
 	}
 	void setAreaEdgeY(float aedy)
 	{
 		if(aedy == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.aed.aedy\" %f;\n", aedy);
+		writeFloat(mFile,"\tsetAttr \".mrc.aed.aedy\" ",aedy,";\n");
 	}
 	void setAreaEdgeZ(float aedz)
 	{
 		if(aedz == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.aed.aedz\" %f;\n", aedz);
+		writeFloat(mFile,"\tsetAttr \".mrc.aed.aedz\" ",aedz,";\n");
 	}
 	void setAreaRadius(float arad)
 	{
 		if(arad == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.arad\" %f;\n", arad);
+		writeFloat(mFile,"\tsetAttr \".mrc.arad\" ",arad,";\n");
 	}
 	void setAreaSampling(const short2& asa)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc.asa\" -type \"short2\" ");
+		writeString(mFile,"\tsetAttr \".mrc.asa\" -type \"short2\" ");
 		asa.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAreaSamplingU(short asau)
 	{
 		if(asau == 3) return;
-		fprintf(mFile,"\tsetAttr \".mrc.asa.asau\" %i;\n", asau);
+		writeInt(mFile,"\tsetAttr \".mrc.asa.asau\" ",asau,";\n");
 	}
 	void setAreaSamplingV(short asav)
 	{
 		if(asav == 3) return;
-		fprintf(mFile,"\tsetAttr \".mrc.asa.asav\" %i;\n", asav);
+		writeInt(mFile,"\tsetAttr \".mrc.asa.asav\" ",asav,";\n");
 	}
 	void setAreaLowLevel(short alev)
 	{
 		if(alev == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.alev\" %i;\n", alev);
+		writeInt(mFile,"\tsetAttr \".mrc.alev\" ",alev,";\n");
 	}
 	void setAreaLowSampling(const short2& alo)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc.alo\" -type \"short2\" ");
+		writeString(mFile,"\tsetAttr \".mrc.alo\" -type \"short2\" ");
 		alo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAreaLowSamplingU(short alou)
 	{
 		if(alou == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.alo.alou\" %i;\n", alou);
+		writeInt(mFile,"\tsetAttr \".mrc.alo.alou\" ",alou,";\n");
 	}
 	void setAreaLowSamplingV(short alov)
 	{
 		if(alov == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.alo.alov\" %i;\n", alov);
+		writeInt(mFile,"\tsetAttr \".mrc.alo.alov\" ",alov,";\n");
 	}
 	void setAreaVisible(bool avis)
 	{
 		if(avis == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.avis\" %i;\n", avis);
+		writeInt(mFile,"\tsetAttr \".mrc.avis\" ",avis,";\n");
 	}
 	void getFogGeometry()const
 	{
-		fprintf(mFile,"\"%s.fg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fg\"");
 	}
 	void getFogRadius()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getLightGlow()const
 	{
-		fprintf(mFile,"\"%s.lg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lg\"");
 	}
 	void getObjectType()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getFogType()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.pw.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.tx\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.pw.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.ty\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.pw.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.tz\"");
 	}
 	void getFarPointWorld()const
 	{
-		fprintf(mFile,"\"%s.fw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw\"");
 	}
 	void getFarPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.fw.fwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwx\"");
 	}
 	void getFarPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.fw.fwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwy\"");
 	}
 	void getFarPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.fw.fwz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwz\"");
 	}
 	void getFogIntensity()const
 	{
-		fprintf(mFile,"\"%s.fin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fin\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiExportMrLight()const
 	{
-		fprintf(mFile,"\"%s.mrc.milt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.milt\"");
 	}
 	void getMiLightShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.mils\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mils\"");
 	}
 	void getMiPhotonEmitter()const
 	{
-		fprintf(mFile,"\"%s.mrc.mipe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mipe\"");
 	}
 	void getEmitPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.phot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.phot\"");
 	}
 	void getEnergy()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng\"");
 	}
 	void getEnergyR()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engr\"");
 	}
 	void getEnergyG()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engg\"");
 	}
 	void getEnergyB()const
 	{
-		fprintf(mFile,"\"%s.mrc.eng.engb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.eng.engb\"");
 	}
 	void getPhotonIntensity()const
 	{
-		fprintf(mFile,"\"%s.mrc.phi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.phi\"");
 	}
 	void getExponent()const
 	{
-		fprintf(mFile,"\"%s.mrc.exp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.exp\"");
 	}
 	void getCausticPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.cph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.cph\"");
 	}
 	void getGlobIllPhotons()const
 	{
-		fprintf(mFile,"\"%s.mrc.gph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gph\"");
 	}
 	void getShadowMap()const
 	{
-		fprintf(mFile,"\"%s.mrc.usm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.usm\"");
 	}
 	void getSmapResolution()const
 	{
-		fprintf(mFile,"\"%s.mrc.smr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smr\"");
 	}
 	void getSmapSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.smsa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smsa\"");
 	}
 	void getSmapSoftness()const
 	{
-		fprintf(mFile,"\"%s.mrc.smso\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smso\"");
 	}
 	void getSmapBias()const
 	{
-		fprintf(mFile,"\"%s.mrc.smb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smb\"");
 	}
 	void getSmapCamera()const
 	{
-		fprintf(mFile,"\"%s.mrc.smc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smc\"");
 	}
 	void getSmapFilename()const
 	{
-		fprintf(mFile,"\"%s.mrc.smf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smf\"");
 	}
 	void getSmapLightName()const
 	{
-		fprintf(mFile,"\"%s.mrc.smln\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smln\"");
 	}
 	void getSmapSceneName()const
 	{
-		fprintf(mFile,"\"%s.mrc.smsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smsn\"");
 	}
 	void getSmapFrameExt()const
 	{
-		fprintf(mFile,"\"%s.mrc.smfe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smfe\"");
 	}
 	void getSmapDetail()const
 	{
-		fprintf(mFile,"\"%s.mrc.smd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.smd\"");
 	}
 	void getSmapDetailSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.sds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sds\"");
 	}
 	void getSmapDetailAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.sdac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sdac\"");
 	}
 	void getSmapDetailAlpha()const
 	{
-		fprintf(mFile,"\"%s.mrc.sdal\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.sdal\"");
 	}
 	void getAreaLight()const
 	{
-		fprintf(mFile,"\"%s.mrc.algt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.algt\"");
 	}
 	void getAreaType()const
 	{
-		fprintf(mFile,"\"%s.mrc.atyp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.atyp\"");
 	}
 	void getAreaNormal()const
 	{
-		fprintf(mFile,"\"%s.mrc.ano\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ano\"");
 	}
 	void getAreaNormalX()const
 	{
-		fprintf(mFile,"\"%s.mrc.ano.anox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ano.anox\"");
 	}
 	void getAreaNormalY()const
 	{
-		fprintf(mFile,"\"%s.mrc.ano.anoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ano.anoy\"");
 	}
 	void getAreaNormalZ()const
 	{
-		fprintf(mFile,"\"%s.mrc.ano.anoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ano.anoz\"");
 	}
 	void getAreaEdge()const
 	{
-		fprintf(mFile,"\"%s.mrc.aed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.aed\"");
 	}
 	void getAreaEdgeX()const
 	{
-		fprintf(mFile,"\"%s.mrc.aed.aedx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.aed.aedx\"");
 	}
 	void getAreaEdgeY()const
 	{
-		fprintf(mFile,"\"%s.mrc.aed.aedy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.aed.aedy\"");
 	}
 	void getAreaEdgeZ()const
 	{
-		fprintf(mFile,"\"%s.mrc.aed.aedz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.aed.aedz\"");
 	}
 	void getAreaRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.arad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.arad\"");
 	}
 	void getAreaSampling()const
 	{
-		fprintf(mFile,"\"%s.mrc.asa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.asa\"");
 	}
 	void getAreaSamplingU()const
 	{
-		fprintf(mFile,"\"%s.mrc.asa.asau\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.asa.asau\"");
 	}
 	void getAreaSamplingV()const
 	{
-		fprintf(mFile,"\"%s.mrc.asa.asav\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.asa.asav\"");
 	}
 	void getAreaLowLevel()const
 	{
-		fprintf(mFile,"\"%s.mrc.alev\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.alev\"");
 	}
 	void getAreaLowSampling()const
 	{
-		fprintf(mFile,"\"%s.mrc.alo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.alo\"");
 	}
 	void getAreaLowSamplingU()const
 	{
-		fprintf(mFile,"\"%s.mrc.alo.alou\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.alo.alou\"");
 	}
 	void getAreaLowSamplingV()const
 	{
-		fprintf(mFile,"\"%s.mrc.alo.alov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.alo.alov\"");
 	}
 	void getAreaVisible()const
 	{
-		fprintf(mFile,"\"%s.mrc.avis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.avis\"");
 	}
 	void getMiLightProfile()const
 	{
-		fprintf(mFile,"\"%s.mrc.mlp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mlp\"");
 	}
 protected:
 	PointLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
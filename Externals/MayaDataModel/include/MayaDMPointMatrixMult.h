@@ -26,76 +26,76 @@ public:
 
 	void setInPoint(const double3& ip)
 	{
-		fprintf(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
 		ip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInPointX(double ipx)
 	{
 		if(ipx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipx\" %f;\n", ipx);
+		writeFloat(mFile,"\tsetAttr \".ip.ipx\" ",ipx,";\n");
 	}
 	void setInPointY(double ipy)
 	{
 		if(ipy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipy\" %f;\n", ipy);
+		writeFloat(mFile,"\tsetAttr \".ip.ipy\" ",ipy,";\n");
 	}
 	void setInPointZ(double ipz)
 	{
 		if(ipz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipz\" %f;\n", ipz);
+		writeFloat(mFile,"\tsetAttr \".ip.ipz\" ",ipz,";\n");
 	}
 	void setInMatrix(const matrix& im)
 	{
 		if(im == identity) return;
-		fprintf(mFile,"\tsetAttr \".im\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".im\" -type \"matrix\" ");
 		im.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVectorMultiply(bool vm)
 	{
 		if(vm == false) return;
-		fprintf(mFile,"\tsetAttr \".vm\" %i;\n", vm);
+		writeInt(mFile,"\tsetAttr \".vm\" ",vm,";\n");
 	}
 	void getInPoint()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getInPointX()const
 	{
-		fprintf(mFile,"\"%s.ip.ipx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipx\"");
 	}
 	void getInPointY()const
 	{
-		fprintf(mFile,"\"%s.ip.ipy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipy\"");
 	}
 	void getInPointZ()const
 	{
-		fprintf(mFile,"\"%s.ip.ipz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipz\"");
 	}
 	void getInMatrix()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getVectorMultiply()const
 	{
-		fprintf(mFile,"\"%s.vm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vm\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutputX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutputY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutputZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 protected:
 	PointMatrixMult(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -32,128 +32,128 @@ public:
 	void setParameter(double pr)
 	{
 		if(pr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pr\" %f;\n", pr);
+		writeFloat(mFile,"\tsetAttr \".pr\" ",pr,";\n");
 	}
 	void setTurnOnPercentage(bool top)
 	{
 		if(top == false) return;
-		fprintf(mFile,"\tsetAttr \".top\" %i;\n", top);
+		writeInt(mFile,"\tsetAttr \".top\" ",top,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getParameter()const
 	{
-		fprintf(mFile,"\"%s.pr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pr\"");
 	}
 	void getTurnOnPercentage()const
 	{
-		fprintf(mFile,"\"%s.top\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".top\"");
 	}
 	void getResult()const
 	{
-		fprintf(mFile,"\"%s.rs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.rs.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.p\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.rs.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.p.px\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.rs.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.p.py\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.rs.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.p.pz\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.rs.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.n\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.rs.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.n.nx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.rs.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.n.ny\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.rs.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.n.nz\"");
 	}
 	void getNormalizedNormal()const
 	{
-		fprintf(mFile,"\"%s.rs.nn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.nn\"");
 	}
 	void getNormalizedNormalX()const
 	{
-		fprintf(mFile,"\"%s.rs.nn.nnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.nn.nnx\"");
 	}
 	void getNormalizedNormalY()const
 	{
-		fprintf(mFile,"\"%s.rs.nn.nny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.nn.nny\"");
 	}
 	void getNormalizedNormalZ()const
 	{
-		fprintf(mFile,"\"%s.rs.nn.nnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.nn.nnz\"");
 	}
 	void getTangent()const
 	{
-		fprintf(mFile,"\"%s.rs.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.t\"");
 	}
 	void getTangentX()const
 	{
-		fprintf(mFile,"\"%s.rs.t.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.t.tx\"");
 	}
 	void getTangentY()const
 	{
-		fprintf(mFile,"\"%s.rs.t.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.t.ty\"");
 	}
 	void getTangentZ()const
 	{
-		fprintf(mFile,"\"%s.rs.t.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.t.tz\"");
 	}
 	void getNormalizedTangent()const
 	{
-		fprintf(mFile,"\"%s.rs.nt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.nt\"");
 	}
 	void getNormalizedTangentX()const
 	{
-		fprintf(mFile,"\"%s.rs.nt.ntx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.nt.ntx\"");
 	}
 	void getNormalizedTangentY()const
 	{
-		fprintf(mFile,"\"%s.rs.nt.nty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.nt.nty\"");
 	}
 	void getNormalizedTangentZ()const
 	{
-		fprintf(mFile,"\"%s.rs.nt.ntz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.nt.ntz\"");
 	}
 	void getCurvatureCenter()const
 	{
-		fprintf(mFile,"\"%s.rs.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.cc\"");
 	}
 	void getCurvatureCenterX()const
 	{
-		fprintf(mFile,"\"%s.rs.cc.ccx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.cc.ccx\"");
 	}
 	void getCurvatureCenterY()const
 	{
-		fprintf(mFile,"\"%s.rs.cc.ccy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.cc.ccy\"");
 	}
 	void getCurvatureCenterZ()const
 	{
-		fprintf(mFile,"\"%s.rs.cc.ccz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.cc.ccz\"");
 	}
 	void getCurvatureRadius()const
 	{
-		fprintf(mFile,"\"%s.rs.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.cr\"");
 	}
 protected:
 	PointOnCurveInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
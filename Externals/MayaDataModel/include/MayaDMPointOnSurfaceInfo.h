@@ -32,149 +32,149 @@ public:
 	void setParameterU(double u)
 	{
 		if(u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".u\" %f;\n", u);
+		writeFloat(mFile,"\tsetAttr \".u\" ",u,";\n");
 	}
 	void setParameterV(double v)
 	{
 		if(v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v\" %f;\n", v);
+		writeFloat(mFile,"\tsetAttr \".v\" ",v,";\n");
 	}
 	void setTurnOnPercentage(bool top)
 	{
 		if(top == false) return;
-		fprintf(mFile,"\tsetAttr \".top\" %i;\n", top);
+		writeInt(mFile,"\tsetAttr \".top\" ",top,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getParameterU()const
 	{
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getParameterV()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getTurnOnPercentage()const
 	{
-		fprintf(mFile,"\"%s.top\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".top\"");
 	}
 	void getResult()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getPosition()const
 	{
-		fprintf(mFile,"\"%s.r.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p\"");
 	}
 	void getPositionX()const
 	{
-		fprintf(mFile,"\"%s.r.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.px\"");
 	}
 	void getPositionY()const
 	{
-		fprintf(mFile,"\"%s.r.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.py\"");
 	}
 	void getPositionZ()const
 	{
-		fprintf(mFile,"\"%s.r.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.p.pz\"");
 	}
 	void getNormal()const
 	{
-		fprintf(mFile,"\"%s.r.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n\"");
 	}
 	void getNormalX()const
 	{
-		fprintf(mFile,"\"%s.r.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.nx\"");
 	}
 	void getNormalY()const
 	{
-		fprintf(mFile,"\"%s.r.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.ny\"");
 	}
 	void getNormalZ()const
 	{
-		fprintf(mFile,"\"%s.r.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.n.nz\"");
 	}
 	void getNormalizedNormal()const
 	{
-		fprintf(mFile,"\"%s.r.nn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.nn\"");
 	}
 	void getNormalizedNormalX()const
 	{
-		fprintf(mFile,"\"%s.r.nn.nnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.nn.nnx\"");
 	}
 	void getNormalizedNormalY()const
 	{
-		fprintf(mFile,"\"%s.r.nn.nny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.nn.nny\"");
 	}
 	void getNormalizedNormalZ()const
 	{
-		fprintf(mFile,"\"%s.r.nn.nnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.nn.nnz\"");
 	}
 	void getTangentU()const
 	{
-		fprintf(mFile,"\"%s.r.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.tu\"");
 	}
 	void getTangentUx()const
 	{
-		fprintf(mFile,"\"%s.r.tu.tux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.tu.tux\"");
 	}
 	void getTangentUy()const
 	{
-		fprintf(mFile,"\"%s.r.tu.tuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.tu.tuy\"");
 	}
 	void getTangentUz()const
 	{
-		fprintf(mFile,"\"%s.r.tu.tuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.tu.tuz\"");
 	}
 	void getNormalizedTangentU()const
 	{
-		fprintf(mFile,"\"%s.r.ntu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ntu\"");
 	}
 	void getNormalizedTangentUX()const
 	{
-		fprintf(mFile,"\"%s.r.ntu.nux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ntu.nux\"");
 	}
 	void getNormalizedTangentUY()const
 	{
-		fprintf(mFile,"\"%s.r.ntu.nuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ntu.nuy\"");
 	}
 	void getNormalizedTangentUZ()const
 	{
-		fprintf(mFile,"\"%s.r.ntu.nuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ntu.nuz\"");
 	}
 	void getTangentV()const
 	{
-		fprintf(mFile,"\"%s.r.tv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.tv\"");
 	}
 	void getTangentVx()const
 	{
-		fprintf(mFile,"\"%s.r.tv.tvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.tv.tvx\"");
 	}
 	void getTangentVy()const
 	{
-		fprintf(mFile,"\"%s.r.tv.tvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.tv.tvy\"");
 	}
 	void getTangentVz()const
 	{
-		fprintf(mFile,"\"%s.r.tv.tvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.tv.tvz\"");
 	}
 	void getNormalizedTangentV()const
 	{
-		fprintf(mFile,"\"%s.r.ntv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ntv\"");
 	}
 	void getNormalizedTangentVX()const
 	{
-		fprintf(mFile,"\"%s.r.ntv.nvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ntv.nvx\"");
 	}
 	void getNormalizedTangentVY()const
 	{
-		fprintf(mFile,"\"%s.r.ntv.nvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ntv.nvy\"");
 	}
 	void getNormalizedTangentVZ()const
 	{
-		fprintf(mFile,"\"%s.r.ntv.nvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ntv.nvz\"");
 	}
 protected:
 	PointOnSurfaceInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
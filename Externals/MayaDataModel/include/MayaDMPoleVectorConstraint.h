@@ -27,13 +27,13 @@ public:
 	void setPivotSpace(const matrix& ps)
 	{
 		if(ps == identity) return;
-		fprintf(mFile,"\tsetAttr \".ps\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".ps\" -type \"matrix\" ");
 		ps.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getPivotSpace()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 protected:
 	PoleVectorConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
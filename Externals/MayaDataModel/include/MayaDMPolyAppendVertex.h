@@ -26,129 +26,129 @@ public:
 
 	void setVertices(size_t v_i,const float3& v)
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i]\" -type \"float3\" ",v_i);
+		writeInt(mFile,"\tsetAttr \".v[",v_i,"]\" -type \"float3\" ");
 		v.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertices(size_t v_start,size_t v_end,float* v)
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
+		writeInt(mFile,"\tsetAttr \".v[",v_start); writeInt(mFile,":",v_end,"]\" ");
 		size_t size = (v_end-v_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",v[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertices(size_t v_start,size_t v_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i:%i]\"",v_start,v_end);
+		writeInt(mFile,"\tsetAttr \".v[",v_start); writeInt(mFile,":",v_end,"]\"");
 	}
 	void appendVertices(float v)const
 	{
-		fprintf(mFile," %f",v);
+		writeFloat(mFile," ",v);
 	}
 	void endVertices()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVtxx(size_t v_i,float vx)
 	{
 		if(vx == 0) return;
-		fprintf(mFile,"\tsetAttr \".v[%i].vx\" %f;\n", v_i,vx);
+		writeInt(mFile,"\tsetAttr \".v[",v_i); writeFloat(mFile,"].vx\" ",vx,";\n");
 	}
 	void setVtxy(size_t v_i,float vy)
 	{
 		if(vy == 0) return;
-		fprintf(mFile,"\tsetAttr \".v[%i].vy\" %f;\n", v_i,vy);
+		writeInt(mFile,"\tsetAttr \".v[",v_i); writeFloat(mFile,"].vy\" ",vy,";\n");
 	}
 	void setVtxz(size_t v_i,float vz)
 	{
 		if(vz == 0) return;
-		fprintf(mFile,"\tsetAttr \".v[%i].vz\" %f;\n", v_i,vz);
+		writeInt(mFile,"\tsetAttr \".v[",v_i); writeFloat(mFile,"].vz\" ",vz,";\n");
 	}
 	void setDesc(size_t d_i,int d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d[%i]\" %i;\n", d_i,d);
+		writeInt(mFile,"\tsetAttr \".d[",d_i); writeInt(mFile,"]\" ",d,";\n");
 	}
 	void setDesc(size_t d_start,size_t d_end,int* d)
 	{
-		fprintf(mFile,"\tsetAttr \".d[%i:%i]\" ", d_start,d_end);
+		writeInt(mFile,"\tsetAttr \".d[",d_start); writeInt(mFile,":",d_end,"]\" ");
 		size_t size = (d_end-d_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",d[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",d[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDesc(size_t d_start,size_t d_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".d[%i:%i]\"",d_start,d_end);
+		writeInt(mFile,"\tsetAttr \".d[",d_start); writeInt(mFile,":",d_end,"]\"");
 	}
 	void appendDesc(int d)const
 	{
-		fprintf(mFile," %i",d);
+		writeInt(mFile," ",d);
 	}
 	void endDesc()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTexture(unsigned int tx)
 	{
 		if(tx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tx\" %i;\n", tx);
+		writeInt(mFile,"\tsetAttr \".tx\" ",tx,";\n");
 	}
 	void getVertices(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i]\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"]\"");
 	}
 	void getVertices()const
 	{
 
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getVtxx(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i].vx\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"].vx\"");
 	}
 	void getVtxx()const
 	{
 
-		fprintf(mFile,"\"%s.v.vx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vx\"");
 	}
 	void getVtxy(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i].vy\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"].vy\"");
 	}
 	void getVtxy()const
 	{
 
-		fprintf(mFile,"\"%s.v.vy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vy\"");
 	}
 	void getVtxz(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i].vz\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"].vz\"");
 	}
 	void getVtxz()const
 	{
 
-		fprintf(mFile,"\"%s.v.vz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vz\"");
 	}
 	void getDesc(size_t d_i)const
 	{
-		fprintf(mFile,"\"%s.d[%i]\"",mName.c_str(),d_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".d[",d_i,"]\"");
 	}
 	void getDesc()const
 	{
 
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getTexture()const
 	{
-		fprintf(mFile,"\"%s.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx\"");
 	}
 protected:
 	PolyAppendVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,239 +27,239 @@ public:
 	void setTranslate(const double3& t)
 	{
 		if(t == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".t\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"double3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslateX(double tx)
 	{
 		if(tx == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.tx\" %f;\n", tx);
+		writeFloat(mFile,"\tsetAttr \".t.tx\" ",tx,";\n");
 	}
 	void setTranslateY(double ty)
 	{
 		if(ty == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.ty\" %f;\n", ty);
+		writeFloat(mFile,"\tsetAttr \".t.ty\" ",ty,";\n");
 	}
 	void setTranslateZ(double tz)
 	{
 		if(tz == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.tz\" %f;\n", tz);
+		writeFloat(mFile,"\tsetAttr \".t.tz\" ",tz,";\n");
 	}
 	void setRotate(const double3& ro)
 	{
 		if(ro == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
 		ro.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateX(double rx)
 	{
 		if(rx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".ro.rx\" ",rx,";\n");
 	}
 	void setRotateY(double ry)
 	{
 		if(ry == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".ro.ry\" ",ry,";\n");
 	}
 	void setRotateZ(double rz)
 	{
 		if(rz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".ro.rz\" ",rz,";\n");
 	}
 	void setScale(const double3& s)
 	{
 		if(s == double3(1.0, 1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".s\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".s\" -type \"double3\" ");
 		s.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScaleX(double sx)
 	{
 		if(sx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sx\" %f;\n", sx);
+		writeFloat(mFile,"\tsetAttr \".s.sx\" ",sx,";\n");
 	}
 	void setScaleY(double sy)
 	{
 		if(sy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sy\" %f;\n", sy);
+		writeFloat(mFile,"\tsetAttr \".s.sy\" ",sy,";\n");
 	}
 	void setScaleZ(double sz)
 	{
 		if(sz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sz\" %f;\n", sz);
+		writeFloat(mFile,"\tsetAttr \".s.sz\" ",sz,";\n");
 	}
 	void setPivot(const float3& pvt)
 	{
 		if(pvt == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".pvt\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pvt\" -type \"float3\" ");
 		pvt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPivotX(float pvx)
 	{
 		if(pvx == 0) return;
-		fprintf(mFile,"\tsetAttr \".pvt.pvx\" %f;\n", pvx);
+		writeFloat(mFile,"\tsetAttr \".pvt.pvx\" ",pvx,";\n");
 	}
 	void setPivotY(float pvy)
 	{
 		if(pvy == 0) return;
-		fprintf(mFile,"\tsetAttr \".pvt.pvy\" %f;\n", pvy);
+		writeFloat(mFile,"\tsetAttr \".pvt.pvy\" ",pvy,";\n");
 	}
 	void setPivotZ(float pvz)
 	{
 		if(pvz == 0) return;
-		fprintf(mFile,"\tsetAttr \".pvt.pvz\" %f;\n", pvz);
+		writeFloat(mFile,"\tsetAttr \".pvt.pvz\" ",pvz,";\n");
 	}
 	void setPlanes(int p)
 	{
 		if(p == 6) return;
-		fprintf(mFile,"\tsetAttr \".p\" %i;\n", p);
+		writeInt(mFile,"\tsetAttr \".p\" ",p,";\n");
 	}
 	void setOptimize(unsigned int o)
 	{
 		if(o == 1) return;
-		fprintf(mFile,"\tsetAttr \".o\" %i;\n", o);
+		writeInt(mFile,"\tsetAttr \".o\" ",o,";\n");
 	}
 	void setLayoutMethod(unsigned int lm)
 	{
 		if(lm == 0) return;
-		fprintf(mFile,"\tsetAttr \".lm\" %i;\n", lm);
+		writeInt(mFile,"\tsetAttr \".lm\" ",lm,";\n");
 	}
 	void setSkipIntersect(bool si)
 	{
 		if(si == false) return;
-		fprintf(mFile,"\tsetAttr \".si\" %i;\n", si);
+		writeInt(mFile,"\tsetAttr \".si\" ",si,";\n");
 	}
 	void setLayout(unsigned int l)
 	{
 		if(l == 2) return;
-		fprintf(mFile,"\tsetAttr \".l\" %i;\n", l);
+		writeInt(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void setPercentageSpace(float ps)
 	{
 		if(ps == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps\" %f;\n", ps);
+		writeFloat(mFile,"\tsetAttr \".ps\" ",ps,";\n");
 	}
 	void setScaleMode(unsigned int sc)
 	{
 		if(sc == 1) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setDenseLayout(bool dl)
 	{
 		if(dl == false) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %i;\n", dl);
+		writeInt(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setProjectBothDirections(bool pb)
 	{
 		if(pb == false) return;
-		fprintf(mFile,"\tsetAttr \".pb\" %i;\n", pb);
+		writeInt(mFile,"\tsetAttr \".pb\" ",pb,";\n");
 	}
 	void getTranslate()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTranslateX()const
 	{
-		fprintf(mFile,"\"%s.t.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tx\"");
 	}
 	void getTranslateY()const
 	{
-		fprintf(mFile,"\"%s.t.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.ty\"");
 	}
 	void getTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.t.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tz\"");
 	}
 	void getRotate()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getRotateX()const
 	{
-		fprintf(mFile,"\"%s.ro.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rx\"");
 	}
 	void getRotateY()const
 	{
-		fprintf(mFile,"\"%s.ro.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.ry\"");
 	}
 	void getRotateZ()const
 	{
-		fprintf(mFile,"\"%s.ro.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rz\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getScaleX()const
 	{
-		fprintf(mFile,"\"%s.s.sx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sx\"");
 	}
 	void getScaleY()const
 	{
-		fprintf(mFile,"\"%s.s.sy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sy\"");
 	}
 	void getScaleZ()const
 	{
-		fprintf(mFile,"\"%s.s.sz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sz\"");
 	}
 	void getPivot()const
 	{
-		fprintf(mFile,"\"%s.pvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt\"");
 	}
 	void getPivotX()const
 	{
-		fprintf(mFile,"\"%s.pvt.pvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt.pvx\"");
 	}
 	void getPivotY()const
 	{
-		fprintf(mFile,"\"%s.pvt.pvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt.pvy\"");
 	}
 	void getPivotZ()const
 	{
-		fprintf(mFile,"\"%s.pvt.pvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt.pvz\"");
 	}
 	void getPlanes()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getOptimize()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getLayoutMethod()const
 	{
-		fprintf(mFile,"\"%s.lm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lm\"");
 	}
 	void getSkipIntersect()const
 	{
-		fprintf(mFile,"\"%s.si\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".si\"");
 	}
 	void getLayout()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getPercentageSpace()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getScaleMode()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getDenseLayout()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getProjectBothDirections()const
 	{
-		fprintf(mFile,"\"%s.pb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pb\"");
 	}
 	void getPolyGeomObject()const
 	{
-		fprintf(mFile,"\"%s.pg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pg\"");
 	}
 protected:
 	PolyAutoProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setAlpha(float a)
 	{
 		if(a == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setBeta(float b)
 	{
 		if(b == 0.7) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setIterations(int i_)
 	{
 		if(i_ == 10) return;
-		fprintf(mFile,"\tsetAttr \".i\" %i;\n", i_);
+		writeInt(mFile,"\tsetAttr \".i\" ",i_,";\n");
 	}
 	void getAlpha()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getBeta()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getIterations()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 protected:
 	PolyAverageVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,7 +26,7 @@ public:
 
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 protected:
 	PolyBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,110 +27,110 @@ public:
 	void setOffsetAsFraction(bool oaf)
 	{
 		if(oaf == false) return;
-		fprintf(mFile,"\tsetAttr \".oaf\" %i;\n", oaf);
+		writeInt(mFile,"\tsetAttr \".oaf\" ",oaf,";\n");
 	}
 	void setOffset(double o)
 	{
 		if(o == 0) return;
-		fprintf(mFile,"\tsetAttr \".o\" %f;\n", o);
+		writeFloat(mFile,"\tsetAttr \".o\" ",o,";\n");
 	}
 	void setRoundness(double r)
 	{
 		if(r == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setSegments(int sg)
 	{
 		if(sg == 1) return;
-		fprintf(mFile,"\tsetAttr \".sg\" %i;\n", sg);
+		writeInt(mFile,"\tsetAttr \".sg\" ",sg,";\n");
 	}
 	void setAutoFit(bool af)
 	{
 		if(af == true) return;
-		fprintf(mFile,"\tsetAttr \".af\" %i;\n", af);
+		writeInt(mFile,"\tsetAttr \".af\" ",af,";\n");
 	}
 	void setAngleTolerance(double at)
 	{
 		if(at == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".at\" %f;\n", at);
+		writeFloat(mFile,"\tsetAttr \".at\" ",at,";\n");
 	}
 	void setFillNgons(bool fn)
 	{
 		if(fn == false) return;
-		fprintf(mFile,"\tsetAttr \".fn\" %i;\n", fn);
+		writeInt(mFile,"\tsetAttr \".fn\" ",fn,";\n");
 	}
 	void setUvAssignment(unsigned int ua)
 	{
 		if(ua == 0) return;
-		fprintf(mFile,"\tsetAttr \".ua\" %i;\n", ua);
+		writeInt(mFile,"\tsetAttr \".ua\" ",ua,";\n");
 	}
 	void setMergeVertices(bool mv)
 	{
 		if(mv == false) return;
-		fprintf(mFile,"\tsetAttr \".mv\" %i;\n", mv);
+		writeInt(mFile,"\tsetAttr \".mv\" ",mv,";\n");
 	}
 	void setMergeVertexTolerance(double mvt)
 	{
 		if(mvt == 0) return;
-		fprintf(mFile,"\tsetAttr \".mvt\" %f;\n", mvt);
+		writeFloat(mFile,"\tsetAttr \".mvt\" ",mvt,";\n");
 	}
 	void setSmoothingAngle(double sa)
 	{
 		if(sa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sa\" %f;\n", sa);
+		writeFloat(mFile,"\tsetAttr \".sa\" ",sa,";\n");
 	}
 	void setMiteringAngle(double ma)
 	{
 		if(ma == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ma\" %f;\n", ma);
+		writeFloat(mFile,"\tsetAttr \".ma\" ",ma,";\n");
 	}
 	void getOffsetAsFraction()const
 	{
-		fprintf(mFile,"\"%s.oaf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oaf\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getRoundness()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getSegments()const
 	{
-		fprintf(mFile,"\"%s.sg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sg\"");
 	}
 	void getAutoFit()const
 	{
-		fprintf(mFile,"\"%s.af\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".af\"");
 	}
 	void getAngleTolerance()const
 	{
-		fprintf(mFile,"\"%s.at\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".at\"");
 	}
 	void getFillNgons()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getUvAssignment()const
 	{
-		fprintf(mFile,"\"%s.ua\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ua\"");
 	}
 	void getMergeVertices()const
 	{
-		fprintf(mFile,"\"%s.mv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mv\"");
 	}
 	void getMergeVertexTolerance()const
 	{
-		fprintf(mFile,"\"%s.mvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mvt\"");
 	}
 	void getSmoothingAngle()const
 	{
-		fprintf(mFile,"\"%s.sa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sa\"");
 	}
 	void getMiteringAngle()const
 	{
-		fprintf(mFile,"\"%s.ma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ma\"");
 	}
 protected:
 	PolyBevel(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
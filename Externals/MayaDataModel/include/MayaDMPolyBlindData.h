@@ -27,24 +27,24 @@ public:
 	void setTypeId(int tid)
 	{
 		if(tid == 0) return;
-		fprintf(mFile,"\tsetAttr \".tid\" %i;\n", tid);
+		writeInt(mFile,"\tsetAttr \".tid\" ",tid,";\n");
 	}
 	void setBlindDataEntriesAreNew(bool bdn)
 	{
 		if(bdn == false) return;
-		fprintf(mFile,"\tsetAttr \".bdn\" %i;\n", bdn);
+		writeInt(mFile,"\tsetAttr \".bdn\" ",bdn,";\n");
 	}
 	void getTypeId()const
 	{
-		fprintf(mFile,"\"%s.tid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tid\"");
 	}
 	void getInMesh()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutMesh()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	PolyBlindData(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
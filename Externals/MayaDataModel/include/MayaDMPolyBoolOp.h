@@ -27,38 +27,38 @@ public:
 	void setOperation(unsigned int op)
 	{
 		if(op == 0) return;
-		fprintf(mFile,"\tsetAttr \".op\" %i;\n", op);
+		writeInt(mFile,"\tsetAttr \".op\" ",op,";\n");
 	}
 	void setUseThresholds(bool uth)
 	{
 		if(uth == false) return;
-		fprintf(mFile,"\tsetAttr \".uth\" %i;\n", uth);
+		writeInt(mFile,"\tsetAttr \".uth\" ",uth,";\n");
 	}
 	void setVertexDistanceThreshold(double vdt)
 	{
 		if(vdt == 0) return;
-		fprintf(mFile,"\tsetAttr \".vdt\" %f;\n", vdt);
+		writeFloat(mFile,"\tsetAttr \".vdt\" ",vdt,";\n");
 	}
 	void setFaceAreaThreshold(double fat)
 	{
 		if(fat == 0) return;
-		fprintf(mFile,"\tsetAttr \".fat\" %f;\n", fat);
+		writeFloat(mFile,"\tsetAttr \".fat\" ",fat,";\n");
 	}
 	void getOperation()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getUseThresholds()const
 	{
-		fprintf(mFile,"\"%s.uth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uth\"");
 	}
 	void getVertexDistanceThreshold()const
 	{
-		fprintf(mFile,"\"%s.vdt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vdt\"");
 	}
 	void getFaceAreaThreshold()const
 	{
-		fprintf(mFile,"\"%s.fat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fat\"");
 	}
 protected:
 	PolyBoolOp(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,20 +27,20 @@ public:
 	void setKeepFacesTogether(bool kft)
 	{
 		if(kft == true) return;
-		fprintf(mFile,"\tsetAttr \".kft\" %i;\n", kft);
+		writeInt(mFile,"\tsetAttr \".kft\" ",kft,";\n");
 	}
 	void setDuplicate(bool dup)
 	{
 		if(dup == true) return;
-		fprintf(mFile,"\tsetAttr \".dup\" %i;\n", dup);
+		writeInt(mFile,"\tsetAttr \".dup\" ",dup,";\n");
 	}
 	void getKeepFacesTogether()const
 	{
-		fprintf(mFile,"\"%s.kft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kft\"");
 	}
 	void getDuplicate()const
 	{
-		fprintf(mFile,"\"%s.dup\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dup\"");
 	}
 protected:
 	PolyChipOff(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,20 +27,20 @@ public:
 	void setUseAreaThreshold(bool uat)
 	{
 		if(uat == false) return;
-		fprintf(mFile,"\tsetAttr \".uat\" %i;\n", uat);
+		writeInt(mFile,"\tsetAttr \".uat\" ",uat,";\n");
 	}
 	void setAreaThreshold(double at)
 	{
 		if(at == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".at\" %f;\n", at);
+		writeFloat(mFile,"\tsetAttr \".at\" ",at,";\n");
 	}
 	void getUseAreaThreshold()const
 	{
-		fprintf(mFile,"\"%s.uat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uat\"");
 	}
 	void getAreaThreshold()const
 	{
-		fprintf(mFile,"\"%s.at\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".at\"");
 	}
 protected:
 	PolyCollapseF(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,13 +27,13 @@ public:
 	void setColorSetName(const string& cls)
 	{
 		if(cls == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cls\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cls\" -type \"string\" ");
 		cls.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getColorSetName()const
 	{
-		fprintf(mFile,"\"%s.cls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cls\"");
 	}
 protected:
 	PolyColorDel(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		unsigned int redScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", redScale_Position);
-			fprintf(file,"%f ", redScale_FloatValue);
-			fprintf(file,"%i", redScale_Interp);
+			writeFloat(file,"",redScale_Position," ");
+			writeFloat(file,"",redScale_FloatValue," ");
+			writeInt(file,"",redScale_Interp);
 		}
 	};
 	struct GreenScale{
@@ -34,9 +34,9 @@ public:
 		unsigned int greenScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", greenScale_Position);
-			fprintf(file,"%f ", greenScale_FloatValue);
-			fprintf(file,"%i", greenScale_Interp);
+			writeFloat(file,"",greenScale_Position," ");
+			writeFloat(file,"",greenScale_FloatValue," ");
+			writeInt(file,"",greenScale_Interp);
 		}
 	};
 	struct BlueScale{
@@ -45,9 +45,9 @@ public:
 		unsigned int blueScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", blueScale_Position);
-			fprintf(file,"%f ", blueScale_FloatValue);
-			fprintf(file,"%i", blueScale_Interp);
+			writeFloat(file,"",blueScale_Position," ");
+			writeFloat(file,"",blueScale_FloatValue," ");
+			writeInt(file,"",blueScale_Interp);
 		}
 	};
 	struct AlphaScale{
@@ -56,9 +56,9 @@ public:
 		unsigned int alphaScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", alphaScale_Position);
-			fprintf(file,"%f ", alphaScale_FloatValue);
-			fprintf(file,"%i", alphaScale_Interp);
+			writeFloat(file,"",alphaScale_Position," ");
+			writeFloat(file,"",alphaScale_FloatValue," ");
+			writeInt(file,"",alphaScale_Interp);
 		}
 	};
 	struct IntensityScale{
@@ -67,9 +67,9 @@ public:
 		unsigned int intensityScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", intensityScale_Position);
-			fprintf(file,"%f ", intensityScale_FloatValue);
-			fprintf(file,"%i", intensityScale_Interp);
+			writeFloat(file,"",intensityScale_Position," ");
+			writeFloat(file,"",intensityScale_FloatValue," ");
+			writeInt(file,"",intensityScale_Interp);
 		}
 	};
 public:
@@ -82,450 +82,450 @@ public:
 	void setBaseColorName(const string& bcn)
 	{
 		if(bcn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".bcn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".bcn\" -type \"string\" ");
 		bcn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRedScale(size_t r_i,const RedScale& r)
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i]\" ",r_i);
+		writeInt(mFile,"\tsetAttr \".r[",r_i,"]\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRedScale(size_t r_start,size_t r_end,RedScale* r)
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i:%i]\" ", r_start,r_end);
+		writeInt(mFile,"\tsetAttr \".r[",r_start); writeInt(mFile,":",r_end,"]\" ");
 		size_t size = (r_end-r_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			r[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startRedScale(size_t r_start,size_t r_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i:%i]\"",r_start,r_end);
-		fprintf(mFile," -type \"RedScale\" ");
+		writeInt(mFile,"\tsetAttr \".r[",r_start); writeInt(mFile,":",r_end,"]\"");
+		writeString(mFile," -type \"RedScale\" ");
 	}
 	void appendRedScale(const RedScale& r)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		r.write(mFile);
 	}
 	void endRedScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRedScale_Position(size_t r_i,float rp)
 	{
 		if(rp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].rp\" %f;\n", r_i,rp);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeFloat(mFile,"].rp\" ",rp,";\n");
 	}
 	void setRedScale_FloatValue(size_t r_i,float rfv)
 	{
 		if(rfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].rfv\" %f;\n", r_i,rfv);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeFloat(mFile,"].rfv\" ",rfv,";\n");
 	}
 	void setRedScale_Interp(size_t r_i,unsigned int ri)
 	{
 		if(ri == 0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].ri\" %i;\n", r_i,ri);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeInt(mFile,"].ri\" ",ri,";\n");
 	}
 	void setGreenScale(size_t g_i,const GreenScale& g)
 	{
-		fprintf(mFile,"\tsetAttr \".g[%i]\" ",g_i);
+		writeInt(mFile,"\tsetAttr \".g[",g_i,"]\" ");
 		g.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGreenScale(size_t g_start,size_t g_end,GreenScale* g)
 	{
-		fprintf(mFile,"\tsetAttr \".g[%i:%i]\" ", g_start,g_end);
+		writeInt(mFile,"\tsetAttr \".g[",g_start); writeInt(mFile,":",g_end,"]\" ");
 		size_t size = (g_end-g_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			g[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGreenScale(size_t g_start,size_t g_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".g[%i:%i]\"",g_start,g_end);
-		fprintf(mFile," -type \"GreenScale\" ");
+		writeInt(mFile,"\tsetAttr \".g[",g_start); writeInt(mFile,":",g_end,"]\"");
+		writeString(mFile," -type \"GreenScale\" ");
 	}
 	void appendGreenScale(const GreenScale& g)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		g.write(mFile);
 	}
 	void endGreenScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGreenScale_Position(size_t g_i,float gp)
 	{
 		if(gp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g[%i].gp\" %f;\n", g_i,gp);
+		writeInt(mFile,"\tsetAttr \".g[",g_i); writeFloat(mFile,"].gp\" ",gp,";\n");
 	}
 	void setGreenScale_FloatValue(size_t g_i,float gfv)
 	{
 		if(gfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g[%i].gfv\" %f;\n", g_i,gfv);
+		writeInt(mFile,"\tsetAttr \".g[",g_i); writeFloat(mFile,"].gfv\" ",gfv,";\n");
 	}
 	void setGreenScale_Interp(size_t g_i,unsigned int gi)
 	{
 		if(gi == 0) return;
-		fprintf(mFile,"\tsetAttr \".g[%i].gi\" %i;\n", g_i,gi);
+		writeInt(mFile,"\tsetAttr \".g[",g_i); writeInt(mFile,"].gi\" ",gi,";\n");
 	}
 	void setBlueScale(size_t b_i,const BlueScale& b)
 	{
-		fprintf(mFile,"\tsetAttr \".b[%i]\" ",b_i);
+		writeInt(mFile,"\tsetAttr \".b[",b_i,"]\" ");
 		b.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBlueScale(size_t b_start,size_t b_end,BlueScale* b)
 	{
-		fprintf(mFile,"\tsetAttr \".b[%i:%i]\" ", b_start,b_end);
+		writeInt(mFile,"\tsetAttr \".b[",b_start); writeInt(mFile,":",b_end,"]\" ");
 		size_t size = (b_end-b_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			b[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBlueScale(size_t b_start,size_t b_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".b[%i:%i]\"",b_start,b_end);
-		fprintf(mFile," -type \"BlueScale\" ");
+		writeInt(mFile,"\tsetAttr \".b[",b_start); writeInt(mFile,":",b_end,"]\"");
+		writeString(mFile," -type \"BlueScale\" ");
 	}
 	void appendBlueScale(const BlueScale& b)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		b.write(mFile);
 	}
 	void endBlueScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBlueScale_Position(size_t b_i,float bp)
 	{
 		if(bp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".b[%i].bp\" %f;\n", b_i,bp);
+		writeInt(mFile,"\tsetAttr \".b[",b_i); writeFloat(mFile,"].bp\" ",bp,";\n");
 	}
 	void setBlueScale_FloatValue(size_t b_i,float bfv)
 	{
 		if(bfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".b[%i].bfv\" %f;\n", b_i,bfv);
+		writeInt(mFile,"\tsetAttr \".b[",b_i); writeFloat(mFile,"].bfv\" ",bfv,";\n");
 	}
 	void setBlueScale_Interp(size_t b_i,unsigned int bi)
 	{
 		if(bi == 0) return;
-		fprintf(mFile,"\tsetAttr \".b[%i].bi\" %i;\n", b_i,bi);
+		writeInt(mFile,"\tsetAttr \".b[",b_i); writeInt(mFile,"].bi\" ",bi,";\n");
 	}
 	void setAlphaScale(size_t a_i,const AlphaScale& a)
 	{
-		fprintf(mFile,"\tsetAttr \".a[%i]\" ",a_i);
+		writeInt(mFile,"\tsetAttr \".a[",a_i,"]\" ");
 		a.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAlphaScale(size_t a_start,size_t a_end,AlphaScale* a)
 	{
-		fprintf(mFile,"\tsetAttr \".a[%i:%i]\" ", a_start,a_end);
+		writeInt(mFile,"\tsetAttr \".a[",a_start); writeInt(mFile,":",a_end,"]\" ");
 		size_t size = (a_end-a_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			a[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startAlphaScale(size_t a_start,size_t a_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".a[%i:%i]\"",a_start,a_end);
-		fprintf(mFile," -type \"AlphaScale\" ");
+		writeInt(mFile,"\tsetAttr \".a[",a_start); writeInt(mFile,":",a_end,"]\"");
+		writeString(mFile," -type \"AlphaScale\" ");
 	}
 	void appendAlphaScale(const AlphaScale& a)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		a.write(mFile);
 	}
 	void endAlphaScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAlphaScale_Position(size_t a_i,float ap)
 	{
 		if(ap == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".a[%i].ap\" %f;\n", a_i,ap);
+		writeInt(mFile,"\tsetAttr \".a[",a_i); writeFloat(mFile,"].ap\" ",ap,";\n");
 	}
 	void setAlphaScale_FloatValue(size_t a_i,float afv)
 	{
 		if(afv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".a[%i].afv\" %f;\n", a_i,afv);
+		writeInt(mFile,"\tsetAttr \".a[",a_i); writeFloat(mFile,"].afv\" ",afv,";\n");
 	}
 	void setAlphaScale_Interp(size_t a_i,unsigned int ai)
 	{
 		if(ai == 0) return;
-		fprintf(mFile,"\tsetAttr \".a[%i].ai\" %i;\n", a_i,ai);
+		writeInt(mFile,"\tsetAttr \".a[",a_i); writeInt(mFile,"].ai\" ",ai,";\n");
 	}
 	void setIntensityScale(size_t n_i,const IntensityScale& n)
 	{
-		fprintf(mFile,"\tsetAttr \".n[%i]\" ",n_i);
+		writeInt(mFile,"\tsetAttr \".n[",n_i,"]\" ");
 		n.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIntensityScale(size_t n_start,size_t n_end,IntensityScale* n)
 	{
-		fprintf(mFile,"\tsetAttr \".n[%i:%i]\" ", n_start,n_end);
+		writeInt(mFile,"\tsetAttr \".n[",n_start); writeInt(mFile,":",n_end,"]\" ");
 		size_t size = (n_end-n_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			n[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startIntensityScale(size_t n_start,size_t n_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".n[%i:%i]\"",n_start,n_end);
-		fprintf(mFile," -type \"IntensityScale\" ");
+		writeInt(mFile,"\tsetAttr \".n[",n_start); writeInt(mFile,":",n_end,"]\"");
+		writeString(mFile," -type \"IntensityScale\" ");
 	}
 	void appendIntensityScale(const IntensityScale& n)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		n.write(mFile);
 	}
 	void endIntensityScale()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIntensityScale_Position(size_t n_i,float np)
 	{
 		if(np == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n[%i].np\" %f;\n", n_i,np);
+		writeInt(mFile,"\tsetAttr \".n[",n_i); writeFloat(mFile,"].np\" ",np,";\n");
 	}
 	void setIntensityScale_FloatValue(size_t n_i,float nfv)
 	{
 		if(nfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n[%i].nfv\" %f;\n", n_i,nfv);
+		writeInt(mFile,"\tsetAttr \".n[",n_i); writeFloat(mFile,"].nfv\" ",nfv,";\n");
 	}
 	void setIntensityScale_Interp(size_t n_i,unsigned int ni)
 	{
 		if(ni == 0) return;
-		fprintf(mFile,"\tsetAttr \".n[%i].ni\" %i;\n", n_i,ni);
+		writeInt(mFile,"\tsetAttr \".n[",n_i); writeInt(mFile,"].ni\" ",ni,";\n");
 	}
 	void setHuev(float h)
 	{
 		if(h == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".h\" %f;\n", h);
+		writeFloat(mFile,"\tsetAttr \".h\" ",h,";\n");
 	}
 	void setSatv(float s)
 	{
 		if(s == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setValue(float v)
 	{
 		if(v == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".v\" %f;\n", v);
+		writeFloat(mFile,"\tsetAttr \".v\" ",v,";\n");
 	}
 	void getBaseColorName()const
 	{
-		fprintf(mFile,"\"%s.bcn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcn\"");
 	}
 	void getRedScale(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i]\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"]\"");
 	}
 	void getRedScale()const
 	{
 
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRedScale_Position(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].rp\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].rp\"");
 	}
 	void getRedScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.r.rp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rp\"");
 	}
 	void getRedScale_FloatValue(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].rfv\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].rfv\"");
 	}
 	void getRedScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.r.rfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rfv\"");
 	}
 	void getRedScale_Interp(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].ri\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].ri\"");
 	}
 	void getRedScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.r.ri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ri\"");
 	}
 	void getGreenScale(size_t g_i)const
 	{
-		fprintf(mFile,"\"%s.g[%i]\"",mName.c_str(),g_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".g[",g_i,"]\"");
 	}
 	void getGreenScale()const
 	{
 
-		fprintf(mFile,"\"%s.g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g\"");
 	}
 	void getGreenScale_Position(size_t g_i)const
 	{
-		fprintf(mFile,"\"%s.g[%i].gp\"",mName.c_str(),g_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".g[",g_i,"].gp\"");
 	}
 	void getGreenScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.g.gp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gp\"");
 	}
 	void getGreenScale_FloatValue(size_t g_i)const
 	{
-		fprintf(mFile,"\"%s.g[%i].gfv\"",mName.c_str(),g_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".g[",g_i,"].gfv\"");
 	}
 	void getGreenScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.g.gfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gfv\"");
 	}
 	void getGreenScale_Interp(size_t g_i)const
 	{
-		fprintf(mFile,"\"%s.g[%i].gi\"",mName.c_str(),g_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".g[",g_i,"].gi\"");
 	}
 	void getGreenScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.g.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gi\"");
 	}
 	void getBlueScale(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i]\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"]\"");
 	}
 	void getBlueScale()const
 	{
 
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getBlueScale_Position(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i].bp\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"].bp\"");
 	}
 	void getBlueScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.b.bp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.bp\"");
 	}
 	void getBlueScale_FloatValue(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i].bfv\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"].bfv\"");
 	}
 	void getBlueScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.b.bfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.bfv\"");
 	}
 	void getBlueScale_Interp(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i].bi\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"].bi\"");
 	}
 	void getBlueScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.b.bi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.bi\"");
 	}
 	void getAlphaScale(size_t a_i)const
 	{
-		fprintf(mFile,"\"%s.a[%i]\"",mName.c_str(),a_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".a[",a_i,"]\"");
 	}
 	void getAlphaScale()const
 	{
 
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getAlphaScale_Position(size_t a_i)const
 	{
-		fprintf(mFile,"\"%s.a[%i].ap\"",mName.c_str(),a_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".a[",a_i,"].ap\"");
 	}
 	void getAlphaScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.a.ap\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a.ap\"");
 	}
 	void getAlphaScale_FloatValue(size_t a_i)const
 	{
-		fprintf(mFile,"\"%s.a[%i].afv\"",mName.c_str(),a_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".a[",a_i,"].afv\"");
 	}
 	void getAlphaScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.a.afv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a.afv\"");
 	}
 	void getAlphaScale_Interp(size_t a_i)const
 	{
-		fprintf(mFile,"\"%s.a[%i].ai\"",mName.c_str(),a_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".a[",a_i,"].ai\"");
 	}
 	void getAlphaScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.a.ai\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a.ai\"");
 	}
 	void getIntensityScale(size_t n_i)const
 	{
-		fprintf(mFile,"\"%s.n[%i]\"",mName.c_str(),n_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".n[",n_i,"]\"");
 	}
 	void getIntensityScale()const
 	{
 
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getIntensityScale_Position(size_t n_i)const
 	{
-		fprintf(mFile,"\"%s.n[%i].np\"",mName.c_str(),n_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".n[",n_i,"].np\"");
 	}
 	void getIntensityScale_Position()const
 	{
 
-		fprintf(mFile,"\"%s.n.np\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.np\"");
 	}
 	void getIntensityScale_FloatValue(size_t n_i)const
 	{
-		fprintf(mFile,"\"%s.n[%i].nfv\"",mName.c_str(),n_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".n[",n_i,"].nfv\"");
 	}
 	void getIntensityScale_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.n.nfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nfv\"");
 	}
 	void getIntensityScale_Interp(size_t n_i)const
 	{
-		fprintf(mFile,"\"%s.n[%i].ni\"",mName.c_str(),n_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".n[",n_i,"].ni\"");
 	}
 	void getIntensityScale_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.n.ni\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ni\"");
 	}
 	void getHuev()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getSatv()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getValue()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 protected:
 	PolyColorMod(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
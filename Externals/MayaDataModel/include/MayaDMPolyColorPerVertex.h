@@ -27,20 +27,20 @@ public:
 				void write(FILE* file) const
 				{
 					vertexFaceColorRGB.write(file);
-					fprintf(file, " ");
-					fprintf(file,"%f", vertexFaceAlpha);
+					writeString(file," ");
+					writeFloat(file,"",vertexFaceAlpha);
 				}
 			}* vertexFaceColor;
 			size_t nbVertexFaceColor;
 			void write(FILE* file) const
 			{
 				vertexColorRGB.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f ", vertexAlpha);
+				writeString(file," ");
+				writeFloat(file,"",vertexAlpha," ");
 				for (size_t i = 0; i<nbVertexFaceColor; ++i)
 				{
 					vertexFaceColor[i].write(file);
-					if (i + 1<nbVertexFaceColor) fprintf(file, " ");
+					if (i + 1<nbVertexFaceColor) writeString(file," ");
 				}
 			}
 		}* vertexColor;
@@ -50,7 +50,7 @@ public:
 			for (size_t i = 0; i<nbVertexColor; ++i)
 			{
 				vertexColor[i].write(file);
-				if (i + 1<nbVertexColor) fprintf(file, " ");
+				if (i + 1<nbVertexColor) writeString(file," ");
 			}
 		}
 	};
@@ -63,204 +63,204 @@ public:
 
 	void setColorPerVertex(const ColorPerVertex& cpvx)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx\" ");
+		writeString(mFile,"\tsetAttr \".cpvx\" ");
 		cpvx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexColor(size_t vclr_i,const ColorPerVertex::VertexColor& vclr)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i]\" ",vclr_i);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i,"]\" ");
 		vclr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexColor(size_t vclr_start,size_t vclr_end,ColorPerVertex::VertexColor* vclr)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i:%i]\" ", vclr_start,vclr_end);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_start); writeInt(mFile,":",vclr_end,"]\" ");
 		size_t size = (vclr_end-vclr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vclr[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexColor(size_t vclr_start,size_t vclr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i:%i]\"",vclr_start,vclr_end);
-		fprintf(mFile," -type \"ColorPerVertex::VertexColor\" ");
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_start); writeInt(mFile,":",vclr_end,"]\"");
+		writeString(mFile," -type \"ColorPerVertex::VertexColor\" ");
 	}
 	void appendVertexColor(const ColorPerVertex::VertexColor& vclr)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vclr.write(mFile);
 	}
 	void endVertexColor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexColorRGB(size_t vclr_i,const float3& vrgb)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vrgb\" -type \"float3\" ",vclr_i);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i,"].vrgb\" -type \"float3\" ");
 		vrgb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexColorR(size_t vclr_i,float vxcr)
 	{
 		if(vxcr == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vrgb.vxcr\" %f;\n", vclr_i,vxcr);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeFloat(mFile,"].vrgb.vxcr\" ",vxcr,";\n");
 	}
 	void setVertexColorG(size_t vclr_i,float vxcg)
 	{
 		if(vxcg == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vrgb.vxcg\" %f;\n", vclr_i,vxcg);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeFloat(mFile,"].vrgb.vxcg\" ",vxcg,";\n");
 	}
 	void setVertexColorB(size_t vclr_i,float vxcb)
 	{
 		if(vxcb == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vrgb.vxcb\" %f;\n", vclr_i,vxcb);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeFloat(mFile,"].vrgb.vxcb\" ",vxcb,";\n");
 	}
 	void setVertexAlpha(size_t vclr_i,float vxal)
 	{
 		if(vxal == 1) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vxal\" %f;\n", vclr_i,vxal);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeFloat(mFile,"].vxal\" ",vxal,";\n");
 	}
 	void setVertexFaceColor(size_t vclr_i,size_t vfcl_i,const ColorPerVertex::VertexColor::VertexFaceColor& vfcl)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i]\" ",vclr_i,vfcl_i);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"]\" ");
 		vfcl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceColor(size_t vclr_i,size_t vfcl_start,size_t vfcl_end,ColorPerVertex::VertexColor::VertexFaceColor* vfcl)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i:%i]\" ", vclr_i,vfcl_start,vfcl_end);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_start); writeInt(mFile,":",vfcl_end,"]\" ");
 		size_t size = (vfcl_end-vfcl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vfcl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexFaceColor(size_t vclr_i,size_t vfcl_start,size_t vfcl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i:%i]\"",vclr_i,vfcl_start,vfcl_end);
-		fprintf(mFile," -type \"ColorPerVertex::VertexColor::VertexFaceColor\" ");
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_start); writeInt(mFile,":",vfcl_end,"]\"");
+		writeString(mFile," -type \"ColorPerVertex::VertexColor::VertexFaceColor\" ");
 	}
 	void appendVertexFaceColor(const ColorPerVertex::VertexColor::VertexFaceColor& vfcl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vfcl.write(mFile);
 	}
 	void endVertexFaceColor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceColorRGB(size_t vclr_i,size_t vfcl_i,const float3& frgb)
 	{
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].frgb\" -type \"float3\" ",vclr_i,vfcl_i);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb\" -type \"float3\" ");
 		frgb.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceColorR(size_t vclr_i,size_t vfcl_i,float vfcr)
 	{
 		if(vfcr == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].frgb.vfcr\" %f;\n", vclr_i,vfcl_i,vfcr);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i); writeFloat(mFile,"].frgb.vfcr\" ",vfcr,";\n");
 	}
 	void setVertexFaceColorG(size_t vclr_i,size_t vfcl_i,float vfcg)
 	{
 		if(vfcg == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].frgb.vfcg\" %f;\n", vclr_i,vfcl_i,vfcg);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i); writeFloat(mFile,"].frgb.vfcg\" ",vfcg,";\n");
 	}
 	void setVertexFaceColorB(size_t vclr_i,size_t vfcl_i,float vfcb)
 	{
 		if(vfcb == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].frgb.vfcb\" %f;\n", vclr_i,vfcl_i,vfcb);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i); writeFloat(mFile,"].frgb.vfcb\" ",vfcb,";\n");
 	}
 	void setVertexFaceAlpha(size_t vclr_i,size_t vfcl_i,float vfal)
 	{
 		if(vfal == 1) return;
-		fprintf(mFile,"\tsetAttr \".cpvx.vclr[%i].vfcl[%i].vfal\" %f;\n", vclr_i,vfcl_i,vfal);
+		writeInt(mFile,"\tsetAttr \".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i); writeFloat(mFile,"].vfal\" ",vfal,";\n");
 	}
 	void setColorSetName(const string& cn)
 	{
 		if(cn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".cn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".cn\" -type \"string\" ");
 		cn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setClamped(bool clam)
 	{
 		if(clam == true) return;
-		fprintf(mFile,"\tsetAttr \".clam\" %i;\n", clam);
+		writeInt(mFile,"\tsetAttr \".clam\" ",clam,";\n");
 	}
 	void setRepresentation(unsigned int rprt)
 	{
 		if(rprt == 3) return;
-		fprintf(mFile,"\tsetAttr \".rprt\" %i;\n", rprt);
+		writeInt(mFile,"\tsetAttr \".rprt\" ",rprt,";\n");
 	}
 	void getColorPerVertex()const
 	{
-		fprintf(mFile,"\"%s.cpvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpvx\"");
 	}
 	void getVertexColor(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i]\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"]\"");
 	}
 	void getVertexColorRGB(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vrgb\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vrgb\"");
 	}
 	void getVertexColorR(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vrgb.vxcr\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vrgb.vxcr\"");
 	}
 	void getVertexColorG(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vrgb.vxcg\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vrgb.vxcg\"");
 	}
 	void getVertexColorB(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vrgb.vxcb\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vrgb.vxcb\"");
 	}
 	void getVertexAlpha(size_t vclr_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vxal\"",mName.c_str(),vclr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i,"].vxal\"");
 	}
 	void getVertexFaceColor(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i]\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"]\"");
 	}
 	void getVertexFaceColorRGB(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].frgb\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb\"");
 	}
 	void getVertexFaceColorR(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].frgb.vfcr\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb.vfcr\"");
 	}
 	void getVertexFaceColorG(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].frgb.vfcg\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb.vfcg\"");
 	}
 	void getVertexFaceColorB(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].frgb.vfcb\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].frgb.vfcb\"");
 	}
 	void getVertexFaceAlpha(size_t vclr_i,size_t vfcl_i)const
 	{
-		fprintf(mFile,"\"%s.cpvx.vclr[%i].vfcl[%i].vfal\"",mName.c_str(),vclr_i,vfcl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cpvx.vclr[",vclr_i); writeInt(mFile,"].vfcl[",vfcl_i,"].vfal\"");
 	}
 	void getColorSetName()const
 	{
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getClamped()const
 	{
-		fprintf(mFile,"\"%s.clam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clam\"");
 	}
 	void getRepresentation()const
 	{
-		fprintf(mFile,"\"%s.rprt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rprt\"");
 	}
 protected:
 	PolyColorPerVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
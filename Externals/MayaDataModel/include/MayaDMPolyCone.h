@@ -27,74 +27,74 @@ public:
 	void setRadius(double r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setHeight(double h)
 	{
 		if(h == 2) return;
-		fprintf(mFile,"\tsetAttr \".h\" %f;\n", h);
+		writeFloat(mFile,"\tsetAttr \".h\" ",h,";\n");
 	}
 	void setSubdivisionsAxis(int sa)
 	{
 		if(sa == 20) return;
-		fprintf(mFile,"\tsetAttr \".sa\" %i;\n", sa);
+		writeInt(mFile,"\tsetAttr \".sa\" ",sa,";\n");
 	}
 	void setSubdivisionsHeight(int sh)
 	{
 		if(sh == 1) return;
-		fprintf(mFile,"\tsetAttr \".sh\" %i;\n", sh);
+		writeInt(mFile,"\tsetAttr \".sh\" ",sh,";\n");
 	}
 	void setSubdivisionsCap(int sc)
 	{
 		if(sc == 0) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setTexture(bool tx)
 	{
 		if(tx == true) return;
-		fprintf(mFile,"\tsetAttr \".tx\" %i;\n", tx);
+		writeInt(mFile,"\tsetAttr \".tx\" ",tx,";\n");
 	}
 	void setCreateUVs(unsigned int cuv)
 	{
 		if(cuv == 2) return;
-		fprintf(mFile,"\tsetAttr \".cuv\" %i;\n", cuv);
+		writeInt(mFile,"\tsetAttr \".cuv\" ",cuv,";\n");
 	}
 	void setRoundCap(bool rcp)
 	{
 		if(rcp == false) return;
-		fprintf(mFile,"\tsetAttr \".rcp\" %i;\n", rcp);
+		writeInt(mFile,"\tsetAttr \".rcp\" ",rcp,";\n");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getHeight()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getSubdivisionsAxis()const
 	{
-		fprintf(mFile,"\"%s.sa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sa\"");
 	}
 	void getSubdivisionsHeight()const
 	{
-		fprintf(mFile,"\"%s.sh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh\"");
 	}
 	void getSubdivisionsCap()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getTexture()const
 	{
-		fprintf(mFile,"\"%s.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx\"");
 	}
 	void getCreateUVs()const
 	{
-		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cuv\"");
 	}
 	void getRoundCap()const
 	{
-		fprintf(mFile,"\"%s.rcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcp\"");
 	}
 protected:
 	PolyCone(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,13 +27,13 @@ public:
 	void setUvSetNameInput(const string& uvi)
 	{
 		if(uvi == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvi\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uvi\" -type \"string\" ");
 		uvi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getUvSetNameInput()const
 	{
-		fprintf(mFile,"\"%s.uvi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvi\"");
 	}
 protected:
 	PolyCopyUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
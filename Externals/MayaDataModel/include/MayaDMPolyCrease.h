@@ -27,86 +27,86 @@ public:
 	void setCrease(size_t cr_i,float cr)
 	{
 		if(cr == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".cr[%i]\" %f;\n", cr_i,cr);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_i); writeFloat(mFile,"]\" ",cr,";\n");
 	}
 	void setCrease(size_t cr_start,size_t cr_end,float* cr)
 	{
-		fprintf(mFile,"\tsetAttr \".cr[%i:%i]\" ", cr_start,cr_end);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_start); writeInt(mFile,":",cr_end,"]\" ");
 		size_t size = (cr_end-cr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",cr[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCrease(size_t cr_start,size_t cr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cr[%i:%i]\"",cr_start,cr_end);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_start); writeInt(mFile,":",cr_end,"]\"");
 	}
 	void appendCrease(float cr)const
 	{
-		fprintf(mFile," %f",cr);
+		writeFloat(mFile," ",cr);
 	}
 	void endCrease()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputVertexComponents(const componentList& ivc)
 	{
-		fprintf(mFile,"\tsetAttr \".ivc\" -type \"componentList\" ");
+		writeString(mFile,"\tsetAttr \".ivc\" -type \"componentList\" ");
 		ivc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCreaseVertex(size_t crv_i,float crv)
 	{
 		if(crv == -1.0) return;
-		fprintf(mFile,"\tsetAttr \".crv[%i]\" %f;\n", crv_i,crv);
+		writeInt(mFile,"\tsetAttr \".crv[",crv_i); writeFloat(mFile,"]\" ",crv,";\n");
 	}
 	void setCreaseVertex(size_t crv_start,size_t crv_end,float* crv)
 	{
-		fprintf(mFile,"\tsetAttr \".crv[%i:%i]\" ", crv_start,crv_end);
+		writeInt(mFile,"\tsetAttr \".crv[",crv_start); writeInt(mFile,":",crv_end,"]\" ");
 		size_t size = (crv_end-crv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",crv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",crv[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCreaseVertex(size_t crv_start,size_t crv_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".crv[%i:%i]\"",crv_start,crv_end);
+		writeInt(mFile,"\tsetAttr \".crv[",crv_start); writeInt(mFile,":",crv_end,"]\"");
 	}
 	void appendCreaseVertex(float crv)const
 	{
-		fprintf(mFile," %f",crv);
+		writeFloat(mFile," ",crv);
 	}
 	void endCreaseVertex()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getCrease(size_t cr_i)const
 	{
-		fprintf(mFile,"\"%s.cr[%i]\"",mName.c_str(),cr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cr[",cr_i,"]\"");
 	}
 	void getCrease()const
 	{
 
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getInputVertexComponents()const
 	{
-		fprintf(mFile,"\"%s.ivc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ivc\"");
 	}
 	void getCreaseVertex(size_t crv_i)const
 	{
-		fprintf(mFile,"\"%s.crv[%i]\"",mName.c_str(),crv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crv[",crv_i,"]\"");
 	}
 	void getCreaseVertex()const
 	{
 
-		fprintf(mFile,"\"%s.crv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crv\"");
 	}
 protected:
 	PolyCrease(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,149 +26,149 @@ public:
 
 	void setVertices(size_t v_i,const float3& v)
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i]\" -type \"float3\" ",v_i);
+		writeInt(mFile,"\tsetAttr \".v[",v_i,"]\" -type \"float3\" ");
 		v.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertices(size_t v_start,size_t v_end,float* v)
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
+		writeInt(mFile,"\tsetAttr \".v[",v_start); writeInt(mFile,":",v_end,"]\" ");
 		size_t size = (v_end-v_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",v[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertices(size_t v_start,size_t v_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i:%i]\"",v_start,v_end);
+		writeInt(mFile,"\tsetAttr \".v[",v_start); writeInt(mFile,":",v_end,"]\"");
 	}
 	void appendVertices(float v)const
 	{
-		fprintf(mFile," %f",v);
+		writeFloat(mFile," ",v);
 	}
 	void endVertices()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVtxx(size_t v_i,float vx)
 	{
 		if(vx == 0) return;
-		fprintf(mFile,"\tsetAttr \".v[%i].vx\" %f;\n", v_i,vx);
+		writeInt(mFile,"\tsetAttr \".v[",v_i); writeFloat(mFile,"].vx\" ",vx,";\n");
 	}
 	void setVtxy(size_t v_i,float vy)
 	{
 		if(vy == 0) return;
-		fprintf(mFile,"\tsetAttr \".v[%i].vy\" %f;\n", v_i,vy);
+		writeInt(mFile,"\tsetAttr \".v[",v_i); writeFloat(mFile,"].vy\" ",vy,";\n");
 	}
 	void setVtxz(size_t v_i,float vz)
 	{
 		if(vz == 0) return;
-		fprintf(mFile,"\tsetAttr \".v[%i].vz\" %f;\n", v_i,vz);
+		writeInt(mFile,"\tsetAttr \".v[",v_i); writeFloat(mFile,"].vz\" ",vz,";\n");
 	}
 	void setLoop(size_t l_i,int l)
 	{
 		if(l == 0) return;
-		fprintf(mFile,"\tsetAttr \".l[%i]\" %i;\n", l_i,l);
+		writeInt(mFile,"\tsetAttr \".l[",l_i); writeInt(mFile,"]\" ",l,";\n");
 	}
 	void setLoop(size_t l_start,size_t l_end,int* l)
 	{
-		fprintf(mFile,"\tsetAttr \".l[%i:%i]\" ", l_start,l_end);
+		writeInt(mFile,"\tsetAttr \".l[",l_start); writeInt(mFile,":",l_end,"]\" ");
 		size_t size = (l_end-l_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",l[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",l[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLoop(size_t l_start,size_t l_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".l[%i:%i]\"",l_start,l_end);
+		writeInt(mFile,"\tsetAttr \".l[",l_start); writeInt(mFile,":",l_end,"]\"");
 	}
 	void appendLoop(int l)const
 	{
-		fprintf(mFile," %i",l);
+		writeInt(mFile," ",l);
 	}
 	void endLoop()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSubdivision(int s)
 	{
 		if(s == 1) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setTexture(unsigned int tx)
 	{
 		if(tx == 0) return;
-		fprintf(mFile,"\tsetAttr \".tx\" %i;\n", tx);
+		writeInt(mFile,"\tsetAttr \".tx\" ",tx,";\n");
 	}
 	void setUvSetName(const string& uvs)
 	{
 		if(uvs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
 		uvs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getVertices(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i]\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"]\"");
 	}
 	void getVertices()const
 	{
 
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getVtxx(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i].vx\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"].vx\"");
 	}
 	void getVtxx()const
 	{
 
-		fprintf(mFile,"\"%s.v.vx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vx\"");
 	}
 	void getVtxy(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i].vy\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"].vy\"");
 	}
 	void getVtxy()const
 	{
 
-		fprintf(mFile,"\"%s.v.vy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vy\"");
 	}
 	void getVtxz(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i].vz\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"].vz\"");
 	}
 	void getVtxz()const
 	{
 
-		fprintf(mFile,"\"%s.v.vz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vz\"");
 	}
 	void getLoop(size_t l_i)const
 	{
-		fprintf(mFile,"\"%s.l[%i]\"",mName.c_str(),l_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".l[",l_i,"]\"");
 	}
 	void getLoop()const
 	{
 
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getSubdivision()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getTexture()const
 	{
-		fprintf(mFile,"\"%s.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 protected:
 	PolyCreateFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
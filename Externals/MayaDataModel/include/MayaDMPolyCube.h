@@ -27,74 +27,74 @@ public:
 	void setWidth(double w)
 	{
 		if(w == 1) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setHeight(double h)
 	{
 		if(h == 1) return;
-		fprintf(mFile,"\tsetAttr \".h\" %f;\n", h);
+		writeFloat(mFile,"\tsetAttr \".h\" ",h,";\n");
 	}
 	void setDepth(double d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSubdivisionsWidth(int sw)
 	{
 		if(sw == 1) return;
-		fprintf(mFile,"\tsetAttr \".sw\" %i;\n", sw);
+		writeInt(mFile,"\tsetAttr \".sw\" ",sw,";\n");
 	}
 	void setSubdivisionsHeight(int sh)
 	{
 		if(sh == 1) return;
-		fprintf(mFile,"\tsetAttr \".sh\" %i;\n", sh);
+		writeInt(mFile,"\tsetAttr \".sh\" ",sh,";\n");
 	}
 	void setSubdivisionsDepth(int sd)
 	{
 		if(sd == 1) return;
-		fprintf(mFile,"\tsetAttr \".sd\" %i;\n", sd);
+		writeInt(mFile,"\tsetAttr \".sd\" ",sd,";\n");
 	}
 	void setTexture(unsigned int tx)
 	{
 		if(tx == 1) return;
-		fprintf(mFile,"\tsetAttr \".tx\" %i;\n", tx);
+		writeInt(mFile,"\tsetAttr \".tx\" ",tx,";\n");
 	}
 	void setCreateUVs(unsigned int cuv)
 	{
 		if(cuv == 3) return;
-		fprintf(mFile,"\tsetAttr \".cuv\" %i;\n", cuv);
+		writeInt(mFile,"\tsetAttr \".cuv\" ",cuv,";\n");
 	}
 	void getWidth()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getHeight()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSubdivisionsWidth()const
 	{
-		fprintf(mFile,"\"%s.sw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sw\"");
 	}
 	void getSubdivisionsHeight()const
 	{
-		fprintf(mFile,"\"%s.sh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh\"");
 	}
 	void getSubdivisionsDepth()const
 	{
-		fprintf(mFile,"\"%s.sd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sd\"");
 	}
 	void getTexture()const
 	{
-		fprintf(mFile,"\"%s.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx\"");
 	}
 	void getCreateUVs()const
 	{
-		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cuv\"");
 	}
 protected:
 	PolyCube(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
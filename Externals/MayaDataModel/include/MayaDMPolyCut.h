@@ -27,176 +27,176 @@ public:
 	void setCutPlaneCenter(const double3& pc)
 	{
 		if(pc == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".pc\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pc\" -type \"double3\" ");
 		pc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCutPlaneCenterX(double pcx)
 	{
 		if(pcx == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcx\" %f;\n", pcx);
+		writeFloat(mFile,"\tsetAttr \".pc.pcx\" ",pcx,";\n");
 	}
 	void setCutPlaneCenterY(double pcy)
 	{
 		if(pcy == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcy\" %f;\n", pcy);
+		writeFloat(mFile,"\tsetAttr \".pc.pcy\" ",pcy,";\n");
 	}
 	void setCutPlaneCenterZ(double pcz)
 	{
 		if(pcz == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcz\" %f;\n", pcz);
+		writeFloat(mFile,"\tsetAttr \".pc.pcz\" ",pcz,";\n");
 	}
 	void setCutPlaneRotate(const double3& ro)
 	{
 		if(ro == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
 		ro.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCutPlaneRotateX(double rx)
 	{
 		if(rx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".ro.rx\" ",rx,";\n");
 	}
 	void setCutPlaneRotateY(double ry)
 	{
 		if(ry == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".ro.ry\" ",ry,";\n");
 	}
 	void setCutPlaneRotateZ(double rz)
 	{
 		if(rz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".ro.rz\" ",rz,";\n");
 	}
 	void setCutPlaneSize(const double2& ps)
 	{
 		if(ps == double2(1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".ps\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".ps\" -type \"double2\" ");
 		ps.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCutPlaneWidth(double pw)
 	{
 		if(pw == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps.pw\" %f;\n", pw);
+		writeFloat(mFile,"\tsetAttr \".ps.pw\" ",pw,";\n");
 	}
 	void setCutPlaneHeight(double ph)
 	{
 		if(ph == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps.ph\" %f;\n", ph);
+		writeFloat(mFile,"\tsetAttr \".ps.ph\" ",ph,";\n");
 	}
 	void setExtractFaces(bool ef)
 	{
 		if(ef == false) return;
-		fprintf(mFile,"\tsetAttr \".ef\" %i;\n", ef);
+		writeInt(mFile,"\tsetAttr \".ef\" ",ef,";\n");
 	}
 	void setExtractOffset(const double3& eo)
 	{
 		if(eo == double3(0.5, 0.5, 0.5)) return;
-		fprintf(mFile,"\tsetAttr \".eo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".eo\" -type \"double3\" ");
 		eo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setExtractOffsetX(double eox)
 	{
 		if(eox == 0) return;
-		fprintf(mFile,"\tsetAttr \".eo.eox\" %f;\n", eox);
+		writeFloat(mFile,"\tsetAttr \".eo.eox\" ",eox,";\n");
 	}
 	void setExtractOffsetY(double eoy)
 	{
 		if(eoy == 0) return;
-		fprintf(mFile,"\tsetAttr \".eo.eoy\" %f;\n", eoy);
+		writeFloat(mFile,"\tsetAttr \".eo.eoy\" ",eoy,";\n");
 	}
 	void setExtractOffsetZ(double eoz)
 	{
 		if(eoz == 0) return;
-		fprintf(mFile,"\tsetAttr \".eo.eoz\" %f;\n", eoz);
+		writeFloat(mFile,"\tsetAttr \".eo.eoz\" ",eoz,";\n");
 	}
 	void setDeleteFaces(bool df)
 	{
 		if(df == false) return;
-		fprintf(mFile,"\tsetAttr \".df\" %i;\n", df);
+		writeInt(mFile,"\tsetAttr \".df\" ",df,";\n");
 	}
 	void setOnObject(bool oo)
 	{
 		if(oo == true) return;
-		fprintf(mFile,"\tsetAttr \".oo\" %i;\n", oo);
+		writeInt(mFile,"\tsetAttr \".oo\" ",oo,";\n");
 	}
 	void getCutPlaneCenter()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getCutPlaneCenterX()const
 	{
-		fprintf(mFile,"\"%s.pc.pcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcx\"");
 	}
 	void getCutPlaneCenterY()const
 	{
-		fprintf(mFile,"\"%s.pc.pcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcy\"");
 	}
 	void getCutPlaneCenterZ()const
 	{
-		fprintf(mFile,"\"%s.pc.pcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcz\"");
 	}
 	void getCutPlaneRotate()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getCutPlaneRotateX()const
 	{
-		fprintf(mFile,"\"%s.ro.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rx\"");
 	}
 	void getCutPlaneRotateY()const
 	{
-		fprintf(mFile,"\"%s.ro.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.ry\"");
 	}
 	void getCutPlaneRotateZ()const
 	{
-		fprintf(mFile,"\"%s.ro.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rz\"");
 	}
 	void getCutPlaneSize()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getCutPlaneWidth()const
 	{
-		fprintf(mFile,"\"%s.ps.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps.pw\"");
 	}
 	void getCutPlaneHeight()const
 	{
-		fprintf(mFile,"\"%s.ps.ph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps.ph\"");
 	}
 	void getExtractFaces()const
 	{
-		fprintf(mFile,"\"%s.ef\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ef\"");
 	}
 	void getExtractOffset()const
 	{
-		fprintf(mFile,"\"%s.eo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eo\"");
 	}
 	void getExtractOffsetX()const
 	{
-		fprintf(mFile,"\"%s.eo.eox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eo.eox\"");
 	}
 	void getExtractOffsetY()const
 	{
-		fprintf(mFile,"\"%s.eo.eoy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eo.eoy\"");
 	}
 	void getExtractOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.eo.eoz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eo.eoz\"");
 	}
 	void getDeleteFaces()const
 	{
-		fprintf(mFile,"\"%s.df\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".df\"");
 	}
 	void getOnObject()const
 	{
-		fprintf(mFile,"\"%s.oo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oo\"");
 	}
 	void getCompId()const
 	{
-		fprintf(mFile,"\"%s.cid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cid\"");
 	}
 protected:
 	PolyCut(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setCleanVertices(bool cv)
 	{
 		if(cv == false) return;
-		fprintf(mFile,"\tsetAttr \".cv\" %i;\n", cv);
+		writeInt(mFile,"\tsetAttr \".cv\" ",cv,";\n");
 	}
 	void getCleanVertices()const
 	{
-		fprintf(mFile,"\"%s.cv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv\"");
 	}
 protected:
 	PolyDelEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,56 +27,56 @@ public:
 	void setOffset(float of)
 	{
 		if(of == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".of\" %f;\n", of);
+		writeFloat(mFile,"\tsetAttr \".of\" ",of,";\n");
 	}
 	void setStartVertexOffset(float svo)
 	{
 		if(svo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".svo\" %f;\n", svo);
+		writeFloat(mFile,"\tsetAttr \".svo\" ",svo,";\n");
 	}
 	void setEndVertexOffset(float evo)
 	{
 		if(evo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".evo\" %f;\n", evo);
+		writeFloat(mFile,"\tsetAttr \".evo\" ",evo,";\n");
 	}
 	void setDeleteEdge(bool de)
 	{
 		if(de == true) return;
-		fprintf(mFile,"\tsetAttr \".de\" %i;\n", de);
+		writeInt(mFile,"\tsetAttr \".de\" ",de,";\n");
 	}
 	void setSmoothingAngle(double sma)
 	{
 		if(sma == 1) return;
-		fprintf(mFile,"\tsetAttr \".sma\" %f;\n", sma);
+		writeFloat(mFile,"\tsetAttr \".sma\" ",sma,";\n");
 	}
 	void setSplitType(unsigned int stp)
 	{
 		if(stp == 1) return;
-		fprintf(mFile,"\tsetAttr \".stp\" %i;\n", stp);
+		writeInt(mFile,"\tsetAttr \".stp\" ",stp,";\n");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.of\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of\"");
 	}
 	void getStartVertexOffset()const
 	{
-		fprintf(mFile,"\"%s.svo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svo\"");
 	}
 	void getEndVertexOffset()const
 	{
-		fprintf(mFile,"\"%s.evo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".evo\"");
 	}
 	void getDeleteEdge()const
 	{
-		fprintf(mFile,"\"%s.de\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".de\"");
 	}
 	void getSmoothingAngle()const
 	{
-		fprintf(mFile,"\"%s.sma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sma\"");
 	}
 	void getSplitType()const
 	{
-		fprintf(mFile,"\"%s.stp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stp\"");
 	}
 protected:
 	PolyDuplicateEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
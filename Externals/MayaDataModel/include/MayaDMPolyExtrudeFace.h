@@ -23,9 +23,9 @@ public:
 		unsigned int taperCurve_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", taperCurve_Position);
-			fprintf(file,"%f ", taperCurve_FloatValue);
-			fprintf(file,"%i", taperCurve_Interp);
+			writeFloat(file,"",taperCurve_Position," ");
+			writeFloat(file,"",taperCurve_FloatValue," ");
+			writeInt(file,"",taperCurve_Interp);
 		}
 	};
 public:
@@ -38,133 +38,133 @@ public:
 	void setKeepFacesTogether(bool kft)
 	{
 		if(kft == true) return;
-		fprintf(mFile,"\tsetAttr \".kft\" %i;\n", kft);
+		writeInt(mFile,"\tsetAttr \".kft\" ",kft,";\n");
 	}
 	void setDivisions(int d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setTwist(double twt)
 	{
 		if(twt == 0) return;
-		fprintf(mFile,"\tsetAttr \".twt\" %f;\n", twt);
+		writeFloat(mFile,"\tsetAttr \".twt\" ",twt,";\n");
 	}
 	void setTaper(double tp)
 	{
 		if(tp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tp\" %f;\n", tp);
+		writeFloat(mFile,"\tsetAttr \".tp\" ",tp,";\n");
 	}
 	void setTaperCurve(size_t c_i,const TaperCurve& c)
 	{
-		fprintf(mFile,"\tsetAttr \".c[%i]\" ",c_i);
+		writeInt(mFile,"\tsetAttr \".c[",c_i,"]\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTaperCurve(size_t c_start,size_t c_end,TaperCurve* c)
 	{
-		fprintf(mFile,"\tsetAttr \".c[%i:%i]\" ", c_start,c_end);
+		writeInt(mFile,"\tsetAttr \".c[",c_start); writeInt(mFile,":",c_end,"]\" ");
 		size_t size = (c_end-c_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			c[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTaperCurve(size_t c_start,size_t c_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".c[%i:%i]\"",c_start,c_end);
-		fprintf(mFile," -type \"TaperCurve\" ");
+		writeInt(mFile,"\tsetAttr \".c[",c_start); writeInt(mFile,":",c_end,"]\"");
+		writeString(mFile," -type \"TaperCurve\" ");
 	}
 	void appendTaperCurve(const TaperCurve& c)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		c.write(mFile);
 	}
 	void endTaperCurve()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTaperCurve_Position(size_t c_i,float cp)
 	{
 		if(cp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c[%i].cp\" %f;\n", c_i,cp);
+		writeInt(mFile,"\tsetAttr \".c[",c_i); writeFloat(mFile,"].cp\" ",cp,";\n");
 	}
 	void setTaperCurve_FloatValue(size_t c_i,float cfv)
 	{
 		if(cfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c[%i].cfv\" %f;\n", c_i,cfv);
+		writeInt(mFile,"\tsetAttr \".c[",c_i); writeFloat(mFile,"].cfv\" ",cfv,";\n");
 	}
 	void setTaperCurve_Interp(size_t c_i,unsigned int ci)
 	{
 		if(ci == 0) return;
-		fprintf(mFile,"\tsetAttr \".c[%i].ci\" %i;\n", c_i,ci);
+		writeInt(mFile,"\tsetAttr \".c[",c_i); writeInt(mFile,"].ci\" ",ci,";\n");
 	}
 	void setSmoothingAngle(double sma)
 	{
 		if(sma == 3) return;
-		fprintf(mFile,"\tsetAttr \".sma\" %f;\n", sma);
+		writeFloat(mFile,"\tsetAttr \".sma\" ",sma,";\n");
 	}
 	void getKeepFacesTogether()const
 	{
-		fprintf(mFile,"\"%s.kft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kft\"");
 	}
 	void getDivisions()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getInputProfile()const
 	{
-		fprintf(mFile,"\"%s.ipc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ipc\"");
 	}
 	void getTwist()const
 	{
-		fprintf(mFile,"\"%s.twt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".twt\"");
 	}
 	void getTaper()const
 	{
-		fprintf(mFile,"\"%s.tp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp\"");
 	}
 	void getTaperCurve(size_t c_i)const
 	{
-		fprintf(mFile,"\"%s.c[%i]\"",mName.c_str(),c_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".c[",c_i,"]\"");
 	}
 	void getTaperCurve()const
 	{
 
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getTaperCurve_Position(size_t c_i)const
 	{
-		fprintf(mFile,"\"%s.c[%i].cp\"",mName.c_str(),c_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".c[",c_i,"].cp\"");
 	}
 	void getTaperCurve_Position()const
 	{
 
-		fprintf(mFile,"\"%s.c.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cp\"");
 	}
 	void getTaperCurve_FloatValue(size_t c_i)const
 	{
-		fprintf(mFile,"\"%s.c[%i].cfv\"",mName.c_str(),c_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".c[",c_i,"].cfv\"");
 	}
 	void getTaperCurve_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.c.cfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cfv\"");
 	}
 	void getTaperCurve_Interp(size_t c_i)const
 	{
-		fprintf(mFile,"\"%s.c[%i].ci\"",mName.c_str(),c_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".c[",c_i,"].ci\"");
 	}
 	void getTaperCurve_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.c.ci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.ci\"");
 	}
 	void getSmoothingAngle()const
 	{
-		fprintf(mFile,"\"%s.sma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sma\"");
 	}
 protected:
 	PolyExtrudeFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,13 +26,13 @@ public:
 
 	void setEdge(const componentList& e)
 	{
-		fprintf(mFile,"\tsetAttr \".e\" -type \"componentList\" ");
+		writeString(mFile,"\tsetAttr \".e\" -type \"componentList\" ");
 		e.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getEdge()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 protected:
 	PolyFlipEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
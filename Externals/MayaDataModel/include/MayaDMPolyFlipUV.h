@@ -27,20 +27,20 @@ public:
 	void setFlipType(unsigned int ft)
 	{
 		if(ft == 0) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %i;\n", ft);
+		writeInt(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setLocal(bool l)
 	{
 		if(l == true) return;
-		fprintf(mFile,"\tsetAttr \".l\" %i;\n", l);
+		writeInt(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void getFlipType()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getLocal()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 protected:
 	PolyFlipUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,110 +27,110 @@ public:
 	void setCoils(double c)
 	{
 		if(c == 3) return;
-		fprintf(mFile,"\tsetAttr \".c\" %f;\n", c);
+		writeFloat(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setHeight(double h)
 	{
 		if(h == 2) return;
-		fprintf(mFile,"\tsetAttr \".h\" %f;\n", h);
+		writeFloat(mFile,"\tsetAttr \".h\" ",h,";\n");
 	}
 	void setWidth(double w)
 	{
 		if(w == 2) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setRadius(double r)
 	{
 		if(r == 0) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setDirection(unsigned int d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSubdivisionsAxis(int sa)
 	{
 		if(sa == 8) return;
-		fprintf(mFile,"\tsetAttr \".sa\" %i;\n", sa);
+		writeInt(mFile,"\tsetAttr \".sa\" ",sa,";\n");
 	}
 	void setSubdivisionsCoil(int sco)
 	{
 		if(sco == 50) return;
-		fprintf(mFile,"\tsetAttr \".sco\" %i;\n", sco);
+		writeInt(mFile,"\tsetAttr \".sco\" ",sco,";\n");
 	}
 	void setSubdivisionsCaps(int sc)
 	{
 		if(sc == 0) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setTexture(unsigned int tx)
 	{
 		if(tx == 2) return;
-		fprintf(mFile,"\tsetAttr \".tx\" %i;\n", tx);
+		writeInt(mFile,"\tsetAttr \".tx\" ",tx,";\n");
 	}
 	void setCreateUVs(unsigned int cuv)
 	{
 		if(cuv == 2) return;
-		fprintf(mFile,"\tsetAttr \".cuv\" %i;\n", cuv);
+		writeInt(mFile,"\tsetAttr \".cuv\" ",cuv,";\n");
 	}
 	void setRoundCap(bool rcp)
 	{
 		if(rcp == false) return;
-		fprintf(mFile,"\tsetAttr \".rcp\" %i;\n", rcp);
+		writeInt(mFile,"\tsetAttr \".rcp\" ",rcp,";\n");
 	}
 	void setUseOldInitBehaviour(bool oib)
 	{
 		if(oib == false) return;
-		fprintf(mFile,"\tsetAttr \".oib\" %i;\n", oib);
+		writeInt(mFile,"\tsetAttr \".oib\" ",oib,";\n");
 	}
 	void getCoils()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getHeight()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getWidth()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSubdivisionsAxis()const
 	{
-		fprintf(mFile,"\"%s.sa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sa\"");
 	}
 	void getSubdivisionsCoil()const
 	{
-		fprintf(mFile,"\"%s.sco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sco\"");
 	}
 	void getSubdivisionsCaps()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getTexture()const
 	{
-		fprintf(mFile,"\"%s.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx\"");
 	}
 	void getCreateUVs()const
 	{
-		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cuv\"");
 	}
 	void getRoundCap()const
 	{
-		fprintf(mFile,"\"%s.rcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcp\"");
 	}
 	void getUseOldInitBehaviour()const
 	{
-		fprintf(mFile,"\"%s.oib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oib\"");
 	}
 protected:
 	PolyHelix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,20 +27,20 @@ public:
 	void setLimitPieceSize(bool lps)
 	{
 		if(lps == false) return;
-		fprintf(mFile,"\tsetAttr \".lps\" %i;\n", lps);
+		writeInt(mFile,"\tsetAttr \".lps\" ",lps,";\n");
 	}
 	void setNumberFaces(int nf)
 	{
 		if(nf == 10) return;
-		fprintf(mFile,"\tsetAttr \".nf\" %i;\n", nf);
+		writeInt(mFile,"\tsetAttr \".nf\" ",nf,";\n");
 	}
 	void getLimitPieceSize()const
 	{
-		fprintf(mFile,"\"%s.lps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lps\"");
 	}
 	void getNumberFaces()const
 	{
-		fprintf(mFile,"\"%s.nf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nf\"");
 	}
 protected:
 	PolyMapSewMove(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,38 +27,38 @@ public:
 	void setMergeMode(unsigned int mm)
 	{
 		if(mm == 1) return;
-		fprintf(mFile,"\tsetAttr \".mm\" %i;\n", mm);
+		writeInt(mFile,"\tsetAttr \".mm\" ",mm,";\n");
 	}
 	void setFirstEdge(int fe)
 	{
 		if(fe == -1) return;
-		fprintf(mFile,"\tsetAttr \".fe\" %i;\n", fe);
+		writeInt(mFile,"\tsetAttr \".fe\" ",fe,";\n");
 	}
 	void setSecondEdge(int se)
 	{
 		if(se == -1) return;
-		fprintf(mFile,"\tsetAttr \".se\" %i;\n", se);
+		writeInt(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setMergeTexture(bool mt)
 	{
 		if(mt == false) return;
-		fprintf(mFile,"\tsetAttr \".mt\" %i;\n", mt);
+		writeInt(mFile,"\tsetAttr \".mt\" ",mt,";\n");
 	}
 	void getMergeMode()const
 	{
-		fprintf(mFile,"\"%s.mm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mm\"");
 	}
 	void getFirstEdge()const
 	{
-		fprintf(mFile,"\"%s.fe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fe\"");
 	}
 	void getSecondEdge()const
 	{
-		fprintf(mFile,"\"%s.se\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".se\"");
 	}
 	void getMergeTexture()const
 	{
-		fprintf(mFile,"\"%s.mt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mt\"");
 	}
 protected:
 	PolyMergeEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
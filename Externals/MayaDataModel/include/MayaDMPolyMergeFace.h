@@ -27,34 +27,34 @@ public:
 	void setMergeMode(unsigned int mm)
 	{
 		if(mm == 6) return;
-		fprintf(mFile,"\tsetAttr \".mm\" %i;\n", mm);
+		writeInt(mFile,"\tsetAttr \".mm\" ",mm,";\n");
 	}
 	void setUseAreaTolerance(bool uat)
 	{
 		if(uat == true) return;
-		fprintf(mFile,"\tsetAttr \".uat\" %i;\n", uat);
+		writeInt(mFile,"\tsetAttr \".uat\" ",uat,";\n");
 	}
 	void setFirstFacet(int ff)
 	{
 		if(ff == -1) return;
-		fprintf(mFile,"\tsetAttr \".ff\" %i;\n", ff);
+		writeInt(mFile,"\tsetAttr \".ff\" ",ff,";\n");
 	}
 	void setSecondFacet(int sf)
 	{
 		if(sf == -1) return;
-		fprintf(mFile,"\tsetAttr \".sf\" %i;\n", sf);
+		writeInt(mFile,"\tsetAttr \".sf\" ",sf,";\n");
 	}
 	void getMergeMode()const
 	{
-		fprintf(mFile,"\"%s.mm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mm\"");
 	}
 	void getFirstFacet()const
 	{
-		fprintf(mFile,"\"%s.ff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ff\"");
 	}
 	void getSecondFacet()const
 	{
-		fprintf(mFile,"\"%s.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sf\"");
 	}
 protected:
 	PolyMergeFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setDistance(double d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setAlwaysMergeTwoVertices(bool am)
 	{
 		if(am == false) return;
-		fprintf(mFile,"\tsetAttr \".am\" %i;\n", am);
+		writeInt(mFile,"\tsetAttr \".am\" ",am,";\n");
 	}
 	void setTexture(bool tx)
 	{
 		if(tx == true) return;
-		fprintf(mFile,"\tsetAttr \".tx\" %i;\n", tx);
+		writeInt(mFile,"\tsetAttr \".tx\" ",tx,";\n");
 	}
 	void getDistance()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getAlwaysMergeTwoVertices()const
 	{
-		fprintf(mFile,"\"%s.am\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".am\"");
 	}
 	void getTexture()const
 	{
-		fprintf(mFile,"\"%s.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tx\"");
 	}
 protected:
 	PolyMergeVert(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,67 +27,67 @@ public:
 	void setPivot(const double3& p)
 	{
 		if(p == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".p\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"double3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPivotX(double px)
 	{
 		if(px == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPivotY(double py)
 	{
 		if(py == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setPivotZ(double pz)
 	{
 		if(pz == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".p.pz\" ",pz,";\n");
 	}
 	void setDirection(unsigned int d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setMergeMode(unsigned int mm)
 	{
 		if(mm == 0) return;
-		fprintf(mFile,"\tsetAttr \".mm\" %i;\n", mm);
+		writeInt(mFile,"\tsetAttr \".mm\" ",mm,";\n");
 	}
 	void setMergeThreshold(double mt)
 	{
 		if(mt == 0) return;
-		fprintf(mFile,"\tsetAttr \".mt\" %f;\n", mt);
+		writeFloat(mFile,"\tsetAttr \".mt\" ",mt,";\n");
 	}
 	void getPivot()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPivotX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPivotY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPivotZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getMergeMode()const
 	{
-		fprintf(mFile,"\"%s.mm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mm\"");
 	}
 	void getMergeThreshold()const
 	{
-		fprintf(mFile,"\"%s.mt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mt\"");
 	}
 protected:
 	PolyMirror(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,21 +27,21 @@ public:
 	void setUseOldPolyArchitecture(bool uopa)
 	{
 		if(uopa == false) return;
-		fprintf(mFile,"\tsetAttr \".uopa\" %i;\n", uopa);
+		writeInt(mFile,"\tsetAttr \".uopa\" ",uopa,";\n");
 	}
 	void setInputComponents(const componentList& ics)
 	{
-		fprintf(mFile,"\tsetAttr \".ics\" -type \"componentList\" ");
+		writeString(mFile,"\tsetAttr \".ics\" -type \"componentList\" ");
 		ics.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputPolymesh()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getInputComponents()const
 	{
-		fprintf(mFile,"\"%s.ics\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ics\"");
 	}
 protected:
 	PolyModifier(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,32 +26,32 @@ public:
 
 	void setInputMatrix(const matrix& ix)
 	{
-		fprintf(mFile,"\tsetAttr \".ix\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".ix\" -type \"matrix\" ");
 		ix.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWorldSpace(bool ws)
 	{
 		if(ws == false) return;
-		fprintf(mFile,"\tsetAttr \".ws\" %i;\n", ws);
+		writeInt(mFile,"\tsetAttr \".ws\" ",ws,";\n");
 	}
 	void setManipMatrix(const matrix& mp)
 	{
-		fprintf(mFile,"\tsetAttr \".mp\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".mp\" -type \"matrix\" ");
 		mp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputMatrix()const
 	{
-		fprintf(mFile,"\"%s.ix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ix\"");
 	}
 	void getWorldSpace()const
 	{
-		fprintf(mFile,"\"%s.ws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ws\"");
 	}
 	void getManipMatrix()const
 	{
-		fprintf(mFile,"\"%s.mp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mp\"");
 	}
 protected:
 	PolyModifierWorld(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,87 +27,87 @@ public:
 	void setLocalRotate(const double3& lr)
 	{
 		if(lr == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".lr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".lr\" -type \"double3\" ");
 		lr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalRotateX(double lrx)
 	{
 		if(lrx == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lrx\" %f;\n", lrx);
+		writeFloat(mFile,"\tsetAttr \".lr.lrx\" ",lrx,";\n");
 	}
 	void setLocalRotateY(double lry)
 	{
 		if(lry == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lry\" %f;\n", lry);
+		writeFloat(mFile,"\tsetAttr \".lr.lry\" ",lry,";\n");
 	}
 	void setLocalRotateZ(double lrz)
 	{
 		if(lrz == 0) return;
-		fprintf(mFile,"\tsetAttr \".lr.lrz\" %f;\n", lrz);
+		writeFloat(mFile,"\tsetAttr \".lr.lrz\" ",lrz,";\n");
 	}
 	void setLocalScale(const double3& ls)
 	{
 		if(ls == double3(1.0, 1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".ls\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ls\" -type \"double3\" ");
 		ls.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalScaleX(double lsx)
 	{
 		if(lsx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ls.lsx\" %f;\n", lsx);
+		writeFloat(mFile,"\tsetAttr \".ls.lsx\" ",lsx,";\n");
 	}
 	void setLocalScaleY(double lsy)
 	{
 		if(lsy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ls.lsy\" %f;\n", lsy);
+		writeFloat(mFile,"\tsetAttr \".ls.lsy\" ",lsy,";\n");
 	}
 	void setLocalScaleZ(double lsz)
 	{
 		if(lsz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ls.lsz\" %f;\n", lsz);
+		writeFloat(mFile,"\tsetAttr \".ls.lsz\" ",lsz,";\n");
 	}
 	void setLocalCenter(unsigned int lc)
 	{
 		if(lc == 0) return;
-		fprintf(mFile,"\tsetAttr \".lc\" %i;\n", lc);
+		writeInt(mFile,"\tsetAttr \".lc\" ",lc,";\n");
 	}
 	void getLocalRotate()const
 	{
-		fprintf(mFile,"\"%s.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr\"");
 	}
 	void getLocalRotateX()const
 	{
-		fprintf(mFile,"\"%s.lr.lrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lrx\"");
 	}
 	void getLocalRotateY()const
 	{
-		fprintf(mFile,"\"%s.lr.lry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lry\"");
 	}
 	void getLocalRotateZ()const
 	{
-		fprintf(mFile,"\"%s.lr.lrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lrz\"");
 	}
 	void getLocalScale()const
 	{
-		fprintf(mFile,"\"%s.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls\"");
 	}
 	void getLocalScaleX()const
 	{
-		fprintf(mFile,"\"%s.ls.lsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls.lsx\"");
 	}
 	void getLocalScaleY()const
 	{
-		fprintf(mFile,"\"%s.ls.lsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls.lsy\"");
 	}
 	void getLocalScaleZ()const
 	{
-		fprintf(mFile,"\"%s.ls.lsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls.lsz\"");
 	}
 	void getLocalCenter()const
 	{
-		fprintf(mFile,"\"%s.lc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc\"");
 	}
 protected:
 	PolyMoveEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,105 +27,105 @@ public:
 	void setOffset(float off)
 	{
 		if(off == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".off\" %f;\n", off);
+		writeFloat(mFile,"\tsetAttr \".off\" ",off,";\n");
 	}
 	void setWeight(double w)
 	{
 		if(w == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".w\" %f;\n", w);
+		writeFloat(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setGravity(const double3& g)
 	{
 		if(g == double3(0.0, -1.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".g\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".g\" -type \"double3\" ");
 		g.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGravityX(double gx)
 	{
 		if(gx == 0) return;
-		fprintf(mFile,"\tsetAttr \".g.gx\" %f;\n", gx);
+		writeFloat(mFile,"\tsetAttr \".g.gx\" ",gx,";\n");
 	}
 	void setGravityY(double gy)
 	{
 		if(gy == 0) return;
-		fprintf(mFile,"\tsetAttr \".g.gy\" %f;\n", gy);
+		writeFloat(mFile,"\tsetAttr \".g.gy\" ",gy,";\n");
 	}
 	void setGravityZ(double gz)
 	{
 		if(gz == 0) return;
-		fprintf(mFile,"\tsetAttr \".g.gz\" %f;\n", gz);
+		writeFloat(mFile,"\tsetAttr \".g.gz\" ",gz,";\n");
 	}
 	void setAttraction(double att)
 	{
 		if(att == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".att\" %f;\n", att);
+		writeFloat(mFile,"\tsetAttr \".att\" ",att,";\n");
 	}
 	void setMagnet(const double3& m)
 	{
 		if(m == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".m\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".m\" -type \"double3\" ");
 		m.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMagnX(double mx)
 	{
 		if(mx == 0) return;
-		fprintf(mFile,"\tsetAttr \".m.mx\" %f;\n", mx);
+		writeFloat(mFile,"\tsetAttr \".m.mx\" ",mx,";\n");
 	}
 	void setMagnY(double my)
 	{
 		if(my == 0) return;
-		fprintf(mFile,"\tsetAttr \".m.my\" %f;\n", my);
+		writeFloat(mFile,"\tsetAttr \".m.my\" ",my,";\n");
 	}
 	void setMagnZ(double mz)
 	{
 		if(mz == 0) return;
-		fprintf(mFile,"\tsetAttr \".m.mz\" %f;\n", mz);
+		writeFloat(mFile,"\tsetAttr \".m.mz\" ",mz,";\n");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.off\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".off\"");
 	}
 	void getWeight()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getGravity()const
 	{
-		fprintf(mFile,"\"%s.g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g\"");
 	}
 	void getGravityX()const
 	{
-		fprintf(mFile,"\"%s.g.gx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gx\"");
 	}
 	void getGravityY()const
 	{
-		fprintf(mFile,"\"%s.g.gy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gy\"");
 	}
 	void getGravityZ()const
 	{
-		fprintf(mFile,"\"%s.g.gz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gz\"");
 	}
 	void getAttraction()const
 	{
-		fprintf(mFile,"\"%s.att\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".att\"");
 	}
 	void getMagnet()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getMagnX()const
 	{
-		fprintf(mFile,"\"%s.m.mx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.mx\"");
 	}
 	void getMagnY()const
 	{
-		fprintf(mFile,"\"%s.m.my\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.my\"");
 	}
 	void getMagnZ()const
 	{
-		fprintf(mFile,"\"%s.m.mz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.mz\"");
 	}
 protected:
 	PolyMoveFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
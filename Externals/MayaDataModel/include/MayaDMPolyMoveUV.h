@@ -27,160 +27,160 @@ public:
 	void setTranslate(const double2& t)
 	{
 		if(t == double2(0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".t\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"double2\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslateU(double tu)
 	{
 		if(tu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".t.tu\" %f;\n", tu);
+		writeFloat(mFile,"\tsetAttr \".t.tu\" ",tu,";\n");
 	}
 	void setTranslateV(double tv)
 	{
 		if(tv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".t.tv\" %f;\n", tv);
+		writeFloat(mFile,"\tsetAttr \".t.tv\" ",tv,";\n");
 	}
 	void setRotationAngle(double ra)
 	{
 		if(ra == 0) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setPivot(const double2& pvt)
 	{
 		if(pvt == double2(0.5, 0.5)) return;
-		fprintf(mFile,"\tsetAttr \".pvt\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".pvt\" -type \"double2\" ");
 		pvt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPivotU(double pvu)
 	{
 		if(pvu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pvt.pvu\" %f;\n", pvu);
+		writeFloat(mFile,"\tsetAttr \".pvt.pvu\" ",pvu,";\n");
 	}
 	void setPivotV(double pvv)
 	{
 		if(pvv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pvt.pvv\" %f;\n", pvv);
+		writeFloat(mFile,"\tsetAttr \".pvt.pvv\" ",pvv,";\n");
 	}
 	void setScale(const double2& s)
 	{
 		if(s == double2(1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".s\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".s\" -type \"double2\" ");
 		s.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScaleU(double su)
 	{
 		if(su == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.su\" %f;\n", su);
+		writeFloat(mFile,"\tsetAttr \".s.su\" ",su,";\n");
 	}
 	void setScaleV(double sv)
 	{
 		if(sv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sv\" %f;\n", sv);
+		writeFloat(mFile,"\tsetAttr \".s.sv\" ",sv,";\n");
 	}
 	void setRandom(float ran)
 	{
 		if(ran == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ran\" %f;\n", ran);
+		writeFloat(mFile,"\tsetAttr \".ran\" ",ran,";\n");
 	}
 	void setRandomSeed(int rs)
 	{
 		if(rs == 0) return;
-		fprintf(mFile,"\tsetAttr \".rs\" %i;\n", rs);
+		writeInt(mFile,"\tsetAttr \".rs\" ",rs,";\n");
 	}
 	void setAxisLen(const double2& l)
 	{
 		if(l == double2(1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".l\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".l\" -type \"double2\" ");
 		l.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAxisLenX(double lx)
 	{
 		if(lx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".l.lx\" %f;\n", lx);
+		writeFloat(mFile,"\tsetAttr \".l.lx\" ",lx,";\n");
 	}
 	void setAxisLenY(double ly)
 	{
 		if(ly == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".l.ly\" %f;\n", ly);
+		writeFloat(mFile,"\tsetAttr \".l.ly\" ",ly,";\n");
 	}
 	void setUvSetName(const string& uvs)
 	{
 		if(uvs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
 		uvs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getTranslate()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTranslateU()const
 	{
-		fprintf(mFile,"\"%s.t.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tu\"");
 	}
 	void getTranslateV()const
 	{
-		fprintf(mFile,"\"%s.t.tv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tv\"");
 	}
 	void getRotationAngle()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getPivot()const
 	{
-		fprintf(mFile,"\"%s.pvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt\"");
 	}
 	void getPivotU()const
 	{
-		fprintf(mFile,"\"%s.pvt.pvu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt.pvu\"");
 	}
 	void getPivotV()const
 	{
-		fprintf(mFile,"\"%s.pvt.pvv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt.pvv\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getScaleU()const
 	{
-		fprintf(mFile,"\"%s.s.su\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.su\"");
 	}
 	void getScaleV()const
 	{
-		fprintf(mFile,"\"%s.s.sv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sv\"");
 	}
 	void getRandom()const
 	{
-		fprintf(mFile,"\"%s.ran\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ran\"");
 	}
 	void getRandomSeed()const
 	{
-		fprintf(mFile,"\"%s.rs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs\"");
 	}
 	void getAxisLen()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getAxisLenX()const
 	{
-		fprintf(mFile,"\"%s.l.lx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l.lx\"");
 	}
 	void getAxisLenY()const
 	{
-		fprintf(mFile,"\"%s.l.ly\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l.ly\"");
 	}
 	void getCompId()const
 	{
-		fprintf(mFile,"\"%s.cid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cid\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 protected:
 	PolyMoveUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,293 +27,293 @@ public:
 	void setTranslate(const double3& t)
 	{
 		if(t == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".t\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"double3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslateX(double tx)
 	{
 		if(tx == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.tx\" %f;\n", tx);
+		writeFloat(mFile,"\tsetAttr \".t.tx\" ",tx,";\n");
 	}
 	void setTranslateY(double ty)
 	{
 		if(ty == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.ty\" %f;\n", ty);
+		writeFloat(mFile,"\tsetAttr \".t.ty\" ",ty,";\n");
 	}
 	void setTranslateZ(double tz)
 	{
 		if(tz == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.tz\" %f;\n", tz);
+		writeFloat(mFile,"\tsetAttr \".t.tz\" ",tz,";\n");
 	}
 	void setRotate(const double3& ro)
 	{
 		if(ro == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
 		ro.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateX(double rx)
 	{
 		if(rx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".ro.rx\" ",rx,";\n");
 	}
 	void setRotateY(double ry)
 	{
 		if(ry == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".ro.ry\" ",ry,";\n");
 	}
 	void setRotateZ(double rz)
 	{
 		if(rz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".ro.rz\" ",rz,";\n");
 	}
 	void setScale(const double3& s)
 	{
 		if(s == double3(1.0, 1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".s\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".s\" -type \"double3\" ");
 		s.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScaleX(double sx)
 	{
 		if(sx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sx\" %f;\n", sx);
+		writeFloat(mFile,"\tsetAttr \".s.sx\" ",sx,";\n");
 	}
 	void setScaleY(double sy)
 	{
 		if(sy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sy\" %f;\n", sy);
+		writeFloat(mFile,"\tsetAttr \".s.sy\" ",sy,";\n");
 	}
 	void setScaleZ(double sz)
 	{
 		if(sz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sz\" %f;\n", sz);
+		writeFloat(mFile,"\tsetAttr \".s.sz\" ",sz,";\n");
 	}
 	void setPivot(const float3& pvt)
 	{
 		if(pvt == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".pvt\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pvt\" -type \"float3\" ");
 		pvt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPivotX(float pvx)
 	{
 		if(pvx == 0) return;
-		fprintf(mFile,"\tsetAttr \".pvt.pvx\" %f;\n", pvx);
+		writeFloat(mFile,"\tsetAttr \".pvt.pvx\" ",pvx,";\n");
 	}
 	void setPivotY(float pvy)
 	{
 		if(pvy == 0) return;
-		fprintf(mFile,"\tsetAttr \".pvt.pvy\" %f;\n", pvy);
+		writeFloat(mFile,"\tsetAttr \".pvt.pvy\" ",pvy,";\n");
 	}
 	void setPivotZ(float pvz)
 	{
 		if(pvz == 0) return;
-		fprintf(mFile,"\tsetAttr \".pvt.pvz\" %f;\n", pvz);
+		writeFloat(mFile,"\tsetAttr \".pvt.pvz\" ",pvz,";\n");
 	}
 	void setRandom(float ran)
 	{
 		if(ran == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ran\" %f;\n", ran);
+		writeFloat(mFile,"\tsetAttr \".ran\" ",ran,";\n");
 	}
 	void setRandomSeed(int rs)
 	{
 		if(rs == 0) return;
-		fprintf(mFile,"\tsetAttr \".rs\" %i;\n", rs);
+		writeInt(mFile,"\tsetAttr \".rs\" ",rs,";\n");
 	}
 	void setLocalTranslate(const double3& lt)
 	{
 		if(lt == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".lt\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".lt\" -type \"double3\" ");
 		lt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalTranslateX(double ltx)
 	{
 		if(ltx == 0) return;
-		fprintf(mFile,"\tsetAttr \".lt.ltx\" %f;\n", ltx);
+		writeFloat(mFile,"\tsetAttr \".lt.ltx\" ",ltx,";\n");
 	}
 	void setLocalTranslateY(double lty)
 	{
 		if(lty == 0) return;
-		fprintf(mFile,"\tsetAttr \".lt.lty\" %f;\n", lty);
+		writeFloat(mFile,"\tsetAttr \".lt.lty\" ",lty,";\n");
 	}
 	void setLocalTranslateZ(double ltz)
 	{
 		if(ltz == 0) return;
-		fprintf(mFile,"\tsetAttr \".lt.ltz\" %f;\n", ltz);
+		writeFloat(mFile,"\tsetAttr \".lt.ltz\" ",ltz,";\n");
 	}
 	void setLocalDirection(const double3& ld)
 	{
 		if(ld == double3(1.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ld\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ld\" -type \"double3\" ");
 		ld.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalDirectionX(double ldx)
 	{
 		if(ldx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ld.ldx\" %f;\n", ldx);
+		writeFloat(mFile,"\tsetAttr \".ld.ldx\" ",ldx,";\n");
 	}
 	void setLocalDirectionY(double ldy)
 	{
 		if(ldy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ld.ldy\" %f;\n", ldy);
+		writeFloat(mFile,"\tsetAttr \".ld.ldy\" ",ldy,";\n");
 	}
 	void setLocalDirectionZ(double ldz)
 	{
 		if(ldz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ld.ldz\" %f;\n", ldz);
+		writeFloat(mFile,"\tsetAttr \".ld.ldz\" ",ldz,";\n");
 	}
 	void setGain(size_t ga_i,float ga)
 	{
 		if(ga == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ga[%i]\" %f;\n", ga_i,ga);
+		writeInt(mFile,"\tsetAttr \".ga[",ga_i); writeFloat(mFile,"]\" ",ga,";\n");
 	}
 	void setGain(size_t ga_start,size_t ga_end,float* ga)
 	{
-		fprintf(mFile,"\tsetAttr \".ga[%i:%i]\" ", ga_start,ga_end);
+		writeInt(mFile,"\tsetAttr \".ga[",ga_start); writeInt(mFile,":",ga_end,"]\" ");
 		size_t size = (ga_end-ga_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ga[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ga[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGain(size_t ga_start,size_t ga_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ga[%i:%i]\"",ga_start,ga_end);
+		writeInt(mFile,"\tsetAttr \".ga[",ga_start); writeInt(mFile,":",ga_end,"]\"");
 	}
 	void appendGain(float ga)const
 	{
-		fprintf(mFile," %f",ga);
+		writeFloat(mFile," ",ga);
 	}
 	void endGain()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getTranslate()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTranslateX()const
 	{
-		fprintf(mFile,"\"%s.t.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tx\"");
 	}
 	void getTranslateY()const
 	{
-		fprintf(mFile,"\"%s.t.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.ty\"");
 	}
 	void getTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.t.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tz\"");
 	}
 	void getRotate()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getRotateX()const
 	{
-		fprintf(mFile,"\"%s.ro.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rx\"");
 	}
 	void getRotateY()const
 	{
-		fprintf(mFile,"\"%s.ro.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.ry\"");
 	}
 	void getRotateZ()const
 	{
-		fprintf(mFile,"\"%s.ro.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rz\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getScaleX()const
 	{
-		fprintf(mFile,"\"%s.s.sx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sx\"");
 	}
 	void getScaleY()const
 	{
-		fprintf(mFile,"\"%s.s.sy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sy\"");
 	}
 	void getScaleZ()const
 	{
-		fprintf(mFile,"\"%s.s.sz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sz\"");
 	}
 	void getPivot()const
 	{
-		fprintf(mFile,"\"%s.pvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt\"");
 	}
 	void getPivotX()const
 	{
-		fprintf(mFile,"\"%s.pvt.pvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt.pvx\"");
 	}
 	void getPivotY()const
 	{
-		fprintf(mFile,"\"%s.pvt.pvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt.pvy\"");
 	}
 	void getPivotZ()const
 	{
-		fprintf(mFile,"\"%s.pvt.pvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvt.pvz\"");
 	}
 	void getRandom()const
 	{
-		fprintf(mFile,"\"%s.ran\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ran\"");
 	}
 	void getRandomSeed()const
 	{
-		fprintf(mFile,"\"%s.rs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs\"");
 	}
 	void getLocalTranslate()const
 	{
-		fprintf(mFile,"\"%s.lt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lt\"");
 	}
 	void getLocalTranslateX()const
 	{
-		fprintf(mFile,"\"%s.lt.ltx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lt.ltx\"");
 	}
 	void getLocalTranslateY()const
 	{
-		fprintf(mFile,"\"%s.lt.lty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lt.lty\"");
 	}
 	void getLocalTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.lt.ltz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lt.ltz\"");
 	}
 	void getLocalDirection()const
 	{
-		fprintf(mFile,"\"%s.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld\"");
 	}
 	void getLocalDirectionX()const
 	{
-		fprintf(mFile,"\"%s.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld.ldx\"");
 	}
 	void getLocalDirectionY()const
 	{
-		fprintf(mFile,"\"%s.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld.ldy\"");
 	}
 	void getLocalDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ld.ldz\"");
 	}
 	void getMatrix()const
 	{
-		fprintf(mFile,"\"%s.cma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cma\"");
 	}
 	void getCompId()const
 	{
-		fprintf(mFile,"\"%s.cid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cid\"");
 	}
 	void getGain(size_t ga_i)const
 	{
-		fprintf(mFile,"\"%s.ga[%i]\"",mName.c_str(),ga_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ga[",ga_i,"]\"");
 	}
 	void getGain()const
 	{
 
-		fprintf(mFile,"\"%s.ga\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ga\"");
 	}
 protected:
 	PolyMoveVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,20 +27,20 @@ public:
 	void setNormalMode(unsigned int nm)
 	{
 		if(nm == 0) return;
-		fprintf(mFile,"\tsetAttr \".nm\" %i;\n", nm);
+		writeInt(mFile,"\tsetAttr \".nm\" ",nm,";\n");
 	}
 	void setUserNormalMode(bool unm)
 	{
 		if(unm == true) return;
-		fprintf(mFile,"\tsetAttr \".unm\" %i;\n", unm);
+		writeInt(mFile,"\tsetAttr \".unm\" ",unm,";\n");
 	}
 	void getNormalMode()const
 	{
-		fprintf(mFile,"\"%s.nm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nm\"");
 	}
 	void getUserNormalMode()const
 	{
-		fprintf(mFile,"\"%s.unm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".unm\"");
 	}
 protected:
 	PolyNormal(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -31,11 +31,11 @@ public:
 			void write(FILE* file) const
 			{
 				vertexNormalXYZ.write(file);
-				fprintf(file, " ");
+				writeString(file," ");
 				for (size_t i = 0; i<nbVertexFaceNormal; ++i)
 				{
 					vertexFaceNormal[i].write(file);
-					if (i + 1<nbVertexFaceNormal) fprintf(file, " ");
+					if (i + 1<nbVertexFaceNormal) writeString(file," ");
 				}
 			}
 		}* vertexNormal;
@@ -45,7 +45,7 @@ public:
 			for (size_t i = 0; i<nbVertexNormal; ++i)
 			{
 				vertexNormal[i].write(file);
-				if (i + 1<nbVertexNormal) fprintf(file, " ");
+				if (i + 1<nbVertexNormal) writeString(file," ");
 			}
 		}
 	};
@@ -58,131 +58,131 @@ public:
 
 	void setNormalPerVertex(const NormalPerVertex& npvx)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx\" ");
+		writeString(mFile,"\tsetAttr \".npvx\" ");
 		npvx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexNormal(size_t vn_i,const NormalPerVertex::VertexNormal& vn)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i]\" ",vn_i);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i,"]\" ");
 		vn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexNormal(size_t vn_start,size_t vn_end,NormalPerVertex::VertexNormal* vn)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i:%i]\" ", vn_start,vn_end);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_start); writeInt(mFile,":",vn_end,"]\" ");
 		size_t size = (vn_end-vn_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vn[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexNormal(size_t vn_start,size_t vn_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i:%i]\"",vn_start,vn_end);
-		fprintf(mFile," -type \"NormalPerVertex::VertexNormal\" ");
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_start); writeInt(mFile,":",vn_end,"]\"");
+		writeString(mFile," -type \"NormalPerVertex::VertexNormal\" ");
 	}
 	void appendVertexNormal(const NormalPerVertex::VertexNormal& vn)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vn.write(mFile);
 	}
 	void endVertexNormal()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexNormalXYZ(size_t vn_i,const float3& nxyz)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].nxyz\" -type \"float3\" ",vn_i);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i,"].nxyz\" -type \"float3\" ");
 		nxyz.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexNormalX(size_t vn_i,float vxnx)
 	{
 		if(vxnx == -999) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].nxyz.vxnx\" %f;\n", vn_i,vxnx);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeFloat(mFile,"].nxyz.vxnx\" ",vxnx,";\n");
 	}
 	void setVertexNormalY(size_t vn_i,float vxny)
 	{
 		if(vxny == -999) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].nxyz.vxny\" %f;\n", vn_i,vxny);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeFloat(mFile,"].nxyz.vxny\" ",vxny,";\n");
 	}
 	void setVertexNormalZ(size_t vn_i,float vxnz)
 	{
 		if(vxnz == -999) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].nxyz.vxnz\" %f;\n", vn_i,vxnz);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeFloat(mFile,"].nxyz.vxnz\" ",vxnz,";\n");
 	}
 	void setVertexFaceNormal(size_t vn_i,size_t vfnl_i,const NormalPerVertex::VertexNormal::VertexFaceNormal& vfnl)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i]\" ",vn_i,vfnl_i);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i,"]\" ");
 		vfnl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceNormal(size_t vn_i,size_t vfnl_start,size_t vfnl_end,NormalPerVertex::VertexNormal::VertexFaceNormal* vfnl)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i:%i]\" ", vn_i,vfnl_start,vfnl_end);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_start); writeInt(mFile,":",vfnl_end,"]\" ");
 		size_t size = (vfnl_end-vfnl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vfnl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexFaceNormal(size_t vn_i,size_t vfnl_start,size_t vfnl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i:%i]\"",vn_i,vfnl_start,vfnl_end);
-		fprintf(mFile," -type \"NormalPerVertex::VertexNormal::VertexFaceNormal\" ");
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_start); writeInt(mFile,":",vfnl_end,"]\"");
+		writeString(mFile," -type \"NormalPerVertex::VertexNormal::VertexFaceNormal\" ");
 	}
 	void appendVertexFaceNormal(const NormalPerVertex::VertexNormal::VertexFaceNormal& vfnl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vfnl.write(mFile);
 	}
 	void endVertexFaceNormal()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceNormalXYZ(size_t vn_i,size_t vfnl_i,const float3& fnxy)
 	{
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i].fnxy\" -type \"float3\" ",vn_i,vfnl_i);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i,"].fnxy\" -type \"float3\" ");
 		fnxy.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexFaceNormalX(size_t vn_i,size_t vfnl_i,float vfnx)
 	{
 		if(vfnx == -999) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i].fnxy.vfnx\" %f;\n", vn_i,vfnl_i,vfnx);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i); writeFloat(mFile,"].fnxy.vfnx\" ",vfnx,";\n");
 	}
 	void setVertexFaceNormalY(size_t vn_i,size_t vfnl_i,float vfny)
 	{
 		if(vfny == -999) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i].fnxy.vfny\" %f;\n", vn_i,vfnl_i,vfny);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i); writeFloat(mFile,"].fnxy.vfny\" ",vfny,";\n");
 	}
 	void setVertexFaceNormalZ(size_t vn_i,size_t vfnl_i,float vfnz)
 	{
 		if(vfnz == -999) return;
-		fprintf(mFile,"\tsetAttr \".npvx.vn[%i].vfnl[%i].fnxy.vfnz\" %f;\n", vn_i,vfnl_i,vfnz);
+		writeInt(mFile,"\tsetAttr \".npvx.vn[",vn_i); writeInt(mFile,"].vfnl[",vfnl_i); writeFloat(mFile,"].fnxy.vfnz\" ",vfnz,";\n");
 	}
 	void setNormalDeform(bool npvd)
 	{
 		if(npvd == true) return;
-		fprintf(mFile,"\tsetAttr \".npvd\" %i;\n", npvd);
+		writeInt(mFile,"\tsetAttr \".npvd\" ",npvd,";\n");
 	}
 	void setNormalAdd(bool npva)
 	{
 		if(npva == false) return;
-		fprintf(mFile,"\tsetAttr \".npva\" %i;\n", npva);
+		writeInt(mFile,"\tsetAttr \".npva\" ",npva,";\n");
 	}
 	void getNormalDeform()const
 	{
-		fprintf(mFile,"\"%s.npvd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npvd\"");
 	}
 	void getNormalAdd()const
 	{
-		fprintf(mFile,"\"%s.npva\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npva\"");
 	}
 protected:
 	PolyNormalPerVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
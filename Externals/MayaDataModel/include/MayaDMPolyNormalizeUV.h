@@ -27,20 +27,20 @@ public:
 	void setNormalizeType(unsigned int nt)
 	{
 		if(nt == 1) return;
-		fprintf(mFile,"\tsetAttr \".nt\" %i;\n", nt);
+		writeInt(mFile,"\tsetAttr \".nt\" ",nt,";\n");
 	}
 	void setPreserveAspectRatio(bool pa)
 	{
 		if(pa == true) return;
-		fprintf(mFile,"\tsetAttr \".pa\" %i;\n", pa);
+		writeInt(mFile,"\tsetAttr \".pa\" ",pa,";\n");
 	}
 	void getNormalizeType()const
 	{
-		fprintf(mFile,"\"%s.nt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nt\"");
 	}
 	void getPreserveAspectRatio()const
 	{
-		fprintf(mFile,"\"%s.pa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa\"");
 	}
 protected:
 	PolyNormalizeUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,101 +27,101 @@ public:
 	void setIterations(int i_)
 	{
 		if(i_ == 100) return;
-		fprintf(mFile,"\tsetAttr \".i\" %i;\n", i_);
+		writeInt(mFile,"\tsetAttr \".i\" ",i_,";\n");
 	}
 	void setStoppingThreshold(float ss)
 	{
 		if(ss == .001) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %f;\n", ss);
+		writeFloat(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setAreaWeight(float aw)
 	{
 		if(aw == 1.) return;
-		fprintf(mFile,"\tsetAttr \".aw\" %f;\n", aw);
+		writeFloat(mFile,"\tsetAttr \".aw\" ",aw,";\n");
 	}
 	void setUseScale(bool us)
 	{
 		if(us == false) return;
-		fprintf(mFile,"\tsetAttr \".us\" %i;\n", us);
+		writeInt(mFile,"\tsetAttr \".us\" ",us,";\n");
 	}
 	void setScale(float s)
 	{
 		if(s == 1.) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setPinUvBorder(bool pub)
 	{
 		if(pub == 0) return;
-		fprintf(mFile,"\tsetAttr \".pub\" %i;\n", pub);
+		writeInt(mFile,"\tsetAttr \".pub\" ",pub,";\n");
 	}
 	void setPinSelected(bool ps)
 	{
 		if(ps == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps\" %i;\n", ps);
+		writeInt(mFile,"\tsetAttr \".ps\" ",ps,";\n");
 	}
 	void setApplyToShell(bool as)
 	{
 		if(as == 0) return;
-		fprintf(mFile,"\tsetAttr \".as\" %i;\n", as);
+		writeInt(mFile,"\tsetAttr \".as\" ",as,";\n");
 	}
 	void setOptimizeAxis(unsigned int oa)
 	{
 		if(oa == 0) return;
-		fprintf(mFile,"\tsetAttr \".oa\" %i;\n", oa);
+		writeInt(mFile,"\tsetAttr \".oa\" ",oa,";\n");
 	}
 	void setGlobalBlend(float gb)
 	{
 		if(gb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gb\" %f;\n", gb);
+		writeFloat(mFile,"\tsetAttr \".gb\" ",gb,";\n");
 	}
 	void setGlobalMethodBlend(float gmb)
 	{
 		if(gmb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".gmb\" %f;\n", gmb);
+		writeFloat(mFile,"\tsetAttr \".gmb\" ",gmb,";\n");
 	}
 	void getIterations()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getStoppingThreshold()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getAreaWeight()const
 	{
-		fprintf(mFile,"\"%s.aw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aw\"");
 	}
 	void getUseScale()const
 	{
-		fprintf(mFile,"\"%s.us\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".us\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getPinUvBorder()const
 	{
-		fprintf(mFile,"\"%s.pub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pub\"");
 	}
 	void getPinSelected()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getApplyToShell()const
 	{
-		fprintf(mFile,"\"%s.as\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".as\"");
 	}
 	void getOptimizeAxis()const
 	{
-		fprintf(mFile,"\"%s.oa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oa\"");
 	}
 	void getGlobalBlend()const
 	{
-		fprintf(mFile,"\"%s.gb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gb\"");
 	}
 	void getGlobalMethodBlend()const
 	{
-		fprintf(mFile,"\"%s.gmb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gmb\"");
 	}
 protected:
 	PolyOptUvs(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,253 +27,253 @@ public:
 	void setProjectionCenter(const double3& pc)
 	{
 		if(pc == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".pc\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pc\" -type \"double3\" ");
 		pc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProjectionCenterX(double pcx)
 	{
 		if(pcx == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcx\" %f;\n", pcx);
+		writeFloat(mFile,"\tsetAttr \".pc.pcx\" ",pcx,";\n");
 	}
 	void setProjectionCenterY(double pcy)
 	{
 		if(pcy == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcy\" %f;\n", pcy);
+		writeFloat(mFile,"\tsetAttr \".pc.pcy\" ",pcy,";\n");
 	}
 	void setProjectionCenterZ(double pcz)
 	{
 		if(pcz == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcz\" %f;\n", pcz);
+		writeFloat(mFile,"\tsetAttr \".pc.pcz\" ",pcz,";\n");
 	}
 	void setImageCenter(const double2& ic)
 	{
 		if(ic == double2(0.5, 0.5)) return;
-		fprintf(mFile,"\tsetAttr \".ic\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".ic\" -type \"double2\" ");
 		ic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageCenterX(double icx)
 	{
 		if(icx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.icx\" %f;\n", icx);
+		writeFloat(mFile,"\tsetAttr \".ic.icx\" ",icx,";\n");
 	}
 	void setImageCenterY(double icy)
 	{
 		if(icy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.icy\" %f;\n", icy);
+		writeFloat(mFile,"\tsetAttr \".ic.icy\" ",icy,";\n");
 	}
 	void setRotate(const double3& ro)
 	{
 		if(ro == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
 		ro.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateX(double rx)
 	{
 		if(rx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".ro.rx\" ",rx,";\n");
 	}
 	void setRotateY(double ry)
 	{
 		if(ry == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".ro.ry\" ",ry,";\n");
 	}
 	void setRotateZ(double rz)
 	{
 		if(rz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".ro.rz\" ",rz,";\n");
 	}
 	void setProjectionScale(const double2& ps)
 	{
 		if(ps == double2(1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".ps\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".ps\" -type \"double2\" ");
 		ps.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProjectionWidth(double pw)
 	{
 		if(pw == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps.pw\" %f;\n", pw);
+		writeFloat(mFile,"\tsetAttr \".ps.pw\" ",pw,";\n");
 	}
 	void setProjectionHeight(double ph)
 	{
 		if(ph == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps.ph\" %f;\n", ph);
+		writeFloat(mFile,"\tsetAttr \".ps.ph\" ",ph,";\n");
 	}
 	void setUvSetName(const string& uvs)
 	{
 		if(uvs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
 		uvs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageScale(const double2& is)
 	{
 		if(is == double2(1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".is\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".is\" -type \"double2\" ");
 		is.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageScaleU(double isu)
 	{
 		if(isu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".is.isu\" %f;\n", isu);
+		writeFloat(mFile,"\tsetAttr \".is.isu\" ",isu,";\n");
 	}
 	void setImageScaleV(double isv)
 	{
 		if(isv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".is.isv\" %f;\n", isv);
+		writeFloat(mFile,"\tsetAttr \".is.isv\" ",isv,";\n");
 	}
 	void setRotationAngle(double ra)
 	{
 		if(ra == 0) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setRadius(double r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setIsPerspective(bool per)
 	{
 		if(per == false) return;
-		fprintf(mFile,"\tsetAttr \".per\" %i;\n", per);
+		writeInt(mFile,"\tsetAttr \".per\" ",per,";\n");
 	}
 	void setCameraMatrix(const matrix& cam)
 	{
-		fprintf(mFile,"\tsetAttr \".cam\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".cam\" -type \"matrix\" ");
 		cam.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPortLeft(short plft)
 	{
 		if(plft == 0) return;
-		fprintf(mFile,"\tsetAttr \".plft\" %i;\n", plft);
+		writeInt(mFile,"\tsetAttr \".plft\" ",plft,";\n");
 	}
 	void setPortBottom(short pbot)
 	{
 		if(pbot == 0) return;
-		fprintf(mFile,"\tsetAttr \".pbot\" %i;\n", pbot);
+		writeInt(mFile,"\tsetAttr \".pbot\" ",pbot,";\n");
 	}
 	void setPortRight(short prgt)
 	{
 		if(prgt == 10) return;
-		fprintf(mFile,"\tsetAttr \".prgt\" %i;\n", prgt);
+		writeInt(mFile,"\tsetAttr \".prgt\" ",prgt,";\n");
 	}
 	void setPortTop(short ptop)
 	{
 		if(ptop == 10) return;
-		fprintf(mFile,"\tsetAttr \".ptop\" %i;\n", ptop);
+		writeInt(mFile,"\tsetAttr \".ptop\" ",ptop,";\n");
 	}
 	void getProjectionCenter()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getProjectionCenterX()const
 	{
-		fprintf(mFile,"\"%s.pc.pcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcx\"");
 	}
 	void getProjectionCenterY()const
 	{
-		fprintf(mFile,"\"%s.pc.pcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcy\"");
 	}
 	void getProjectionCenterZ()const
 	{
-		fprintf(mFile,"\"%s.pc.pcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcz\"");
 	}
 	void getImageCenter()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getImageCenterX()const
 	{
-		fprintf(mFile,"\"%s.ic.icx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.icx\"");
 	}
 	void getImageCenterY()const
 	{
-		fprintf(mFile,"\"%s.ic.icy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.icy\"");
 	}
 	void getRotate()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getRotateX()const
 	{
-		fprintf(mFile,"\"%s.ro.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rx\"");
 	}
 	void getRotateY()const
 	{
-		fprintf(mFile,"\"%s.ro.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.ry\"");
 	}
 	void getRotateZ()const
 	{
-		fprintf(mFile,"\"%s.ro.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rz\"");
 	}
 	void getProjectionScale()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getProjectionWidth()const
 	{
-		fprintf(mFile,"\"%s.ps.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps.pw\"");
 	}
 	void getProjectionHeight()const
 	{
-		fprintf(mFile,"\"%s.ps.ph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps.ph\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 	void getImageScale()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getImageScaleU()const
 	{
-		fprintf(mFile,"\"%s.is.isu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isu\"");
 	}
 	void getImageScaleV()const
 	{
-		fprintf(mFile,"\"%s.is.isv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isv\"");
 	}
 	void getRotationAngle()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getCompId()const
 	{
-		fprintf(mFile,"\"%s.cid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cid\"");
 	}
 	void getIsPerspective()const
 	{
-		fprintf(mFile,"\"%s.per\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".per\"");
 	}
 	void getCameraMatrix()const
 	{
-		fprintf(mFile,"\"%s.cam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cam\"");
 	}
 	void getPortLeft()const
 	{
-		fprintf(mFile,"\"%s.plft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".plft\"");
 	}
 	void getPortBottom()const
 	{
-		fprintf(mFile,"\"%s.pbot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pbot\"");
 	}
 	void getPortRight()const
 	{
-		fprintf(mFile,"\"%s.prgt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".prgt\"");
 	}
 	void getPortTop()const
 	{
-		fprintf(mFile,"\"%s.ptop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ptop\"");
 	}
 protected:
 	PolyPlanarProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,87 +27,87 @@ public:
 	void setTranslate(const double3& t)
 	{
 		if(t == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".t\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"double3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslateX(double tx)
 	{
 		if(tx == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.tx\" %f;\n", tx);
+		writeFloat(mFile,"\tsetAttr \".t.tx\" ",tx,";\n");
 	}
 	void setTranslateY(double ty)
 	{
 		if(ty == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.ty\" %f;\n", ty);
+		writeFloat(mFile,"\tsetAttr \".t.ty\" ",ty,";\n");
 	}
 	void setTranslateZ(double tz)
 	{
 		if(tz == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.tz\" %f;\n", tz);
+		writeFloat(mFile,"\tsetAttr \".t.tz\" ",tz,";\n");
 	}
 	void setLocalTranslate(const double3& lt)
 	{
 		if(lt == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".lt\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".lt\" -type \"double3\" ");
 		lt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalTranslateX(double ltx)
 	{
 		if(ltx == 0) return;
-		fprintf(mFile,"\tsetAttr \".lt.ltx\" %f;\n", ltx);
+		writeFloat(mFile,"\tsetAttr \".lt.ltx\" ",ltx,";\n");
 	}
 	void setLocalTranslateY(double lty)
 	{
 		if(lty == 0) return;
-		fprintf(mFile,"\tsetAttr \".lt.lty\" %f;\n", lty);
+		writeFloat(mFile,"\tsetAttr \".lt.lty\" ",lty,";\n");
 	}
 	void setLocalTranslateZ(double ltz)
 	{
 		if(ltz == 0) return;
-		fprintf(mFile,"\tsetAttr \".lt.ltz\" %f;\n", ltz);
+		writeFloat(mFile,"\tsetAttr \".lt.ltz\" ",ltz,";\n");
 	}
 	void setMaya70(bool m70)
 	{
 		if(m70 == true) return;
-		fprintf(mFile,"\tsetAttr \".m70\" %i;\n", m70);
+		writeInt(mFile,"\tsetAttr \".m70\" ",m70,";\n");
 	}
 	void getTranslate()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTranslateX()const
 	{
-		fprintf(mFile,"\"%s.t.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tx\"");
 	}
 	void getTranslateY()const
 	{
-		fprintf(mFile,"\"%s.t.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.ty\"");
 	}
 	void getTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.t.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tz\"");
 	}
 	void getLocalTranslate()const
 	{
-		fprintf(mFile,"\"%s.lt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lt\"");
 	}
 	void getLocalTranslateX()const
 	{
-		fprintf(mFile,"\"%s.lt.ltx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lt.ltx\"");
 	}
 	void getLocalTranslateY()const
 	{
-		fprintf(mFile,"\"%s.lt.lty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lt.lty\"");
 	}
 	void getLocalTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.lt.ltz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lt.ltz\"");
 	}
 	void getMatrix()const
 	{
-		fprintf(mFile,"\"%s.cma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cma\"");
 	}
 protected:
 	PolyPoke(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,60 +26,60 @@ public:
 
 	void setAxis(const double3& ax)
 	{
-		fprintf(mFile,"\tsetAttr \".ax\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ax\" -type \"double3\" ");
 		ax.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAxisX(double axx)
 	{
 		if(axx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axx\" %f;\n", axx);
+		writeFloat(mFile,"\tsetAttr \".ax.axx\" ",axx,";\n");
 	}
 	void setAxisY(double axy)
 	{
 		if(axy == 1) return;
-		fprintf(mFile,"\tsetAttr \".ax.axy\" %f;\n", axy);
+		writeFloat(mFile,"\tsetAttr \".ax.axy\" ",axy,";\n");
 	}
 	void setAxisZ(double axz)
 	{
 		if(axz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axz\" %f;\n", axz);
+		writeFloat(mFile,"\tsetAttr \".ax.axz\" ",axz,";\n");
 	}
 	void setParamWarn(bool pw)
 	{
 		if(pw == true) return;
-		fprintf(mFile,"\tsetAttr \".pw\" %i;\n", pw);
+		writeInt(mFile,"\tsetAttr \".pw\" ",pw,";\n");
 	}
 	void setUvSetName(const string& uvs)
 	{
 		if(uvs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
 		uvs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getAxis()const
 	{
-		fprintf(mFile,"\"%s.ax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax\"");
 	}
 	void getAxisX()const
 	{
-		fprintf(mFile,"\"%s.ax.axx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axx\"");
 	}
 	void getAxisY()const
 	{
-		fprintf(mFile,"\"%s.ax.axy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axy\"");
 	}
 	void getAxisZ()const
 	{
-		fprintf(mFile,"\"%s.ax.axz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axz\"");
 	}
 	void getParamWarn()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 protected:
 	PolyPrimitive(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,43 +27,43 @@ public:
 	void setAngle(double a)
 	{
 		if(a == 3) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setKeepGroupBorder(bool kgb)
 	{
 		if(kgb == true) return;
-		fprintf(mFile,"\tsetAttr \".kgb\" %i;\n", kgb);
+		writeInt(mFile,"\tsetAttr \".kgb\" ",kgb,";\n");
 	}
 	void setKeepTextureBorders(bool ktb)
 	{
 		if(ktb == true) return;
-		fprintf(mFile,"\tsetAttr \".ktb\" %i;\n", ktb);
+		writeInt(mFile,"\tsetAttr \".ktb\" ",ktb,";\n");
 	}
 	void setKeepHardEdges(bool khe)
 	{
 		if(khe == true) return;
-		fprintf(mFile,"\tsetAttr \".khe\" %i;\n", khe);
+		writeInt(mFile,"\tsetAttr \".khe\" ",khe,";\n");
 	}
 	void setMaya80(bool m80)
 	{
 		if(m80 == true) return;
-		fprintf(mFile,"\tsetAttr \".m80\" %i;\n", m80);
+		writeInt(mFile,"\tsetAttr \".m80\" ",m80,";\n");
 	}
 	void getAngle()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getKeepGroupBorder()const
 	{
-		fprintf(mFile,"\"%s.kgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kgb\"");
 	}
 	void getKeepTextureBorders()const
 	{
-		fprintf(mFile,"\"%s.ktb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ktb\"");
 	}
 	void getKeepHardEdges()const
 	{
-		fprintf(mFile,"\"%s.khe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".khe\"");
 	}
 protected:
 	PolyQuad(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
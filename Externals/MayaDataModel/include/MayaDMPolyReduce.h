@@ -27,166 +27,166 @@ public:
 	void setPercentage(double p)
 	{
 		if(p == 0) return;
-		fprintf(mFile,"\tsetAttr \".p\" %f;\n", p);
+		writeFloat(mFile,"\tsetAttr \".p\" ",p,";\n");
 	}
 	void setCompactness(double com)
 	{
 		if(com == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".com\" %f;\n", com);
+		writeFloat(mFile,"\tsetAttr \".com\" ",com,";\n");
 	}
 	void setGeomWeights(double gwt)
 	{
 		if(gwt == 1) return;
-		fprintf(mFile,"\tsetAttr \".gwt\" %f;\n", gwt);
+		writeFloat(mFile,"\tsetAttr \".gwt\" ",gwt,";\n");
 	}
 	void setUvWeights(double uwt)
 	{
 		if(uwt == 0) return;
-		fprintf(mFile,"\tsetAttr \".uwt\" %f;\n", uwt);
+		writeFloat(mFile,"\tsetAttr \".uwt\" ",uwt,";\n");
 	}
 	void setColorWeights(double cwt)
 	{
 		if(cwt == 0) return;
-		fprintf(mFile,"\tsetAttr \".cwt\" %f;\n", cwt);
+		writeFloat(mFile,"\tsetAttr \".cwt\" ",cwt,";\n");
 	}
 	void setKeepQuadsWeight(double kqw)
 	{
 		if(kqw == 0) return;
-		fprintf(mFile,"\tsetAttr \".kqw\" %f;\n", kqw);
+		writeFloat(mFile,"\tsetAttr \".kqw\" ",kqw,";\n");
 	}
 	void setWeightCoefficient(double wc)
 	{
 		if(wc == 10000.0) return;
-		fprintf(mFile,"\tsetAttr \".wc\" %f;\n", wc);
+		writeFloat(mFile,"\tsetAttr \".wc\" ",wc,";\n");
 	}
 	void setVertexWeights(const doubleArray& vwt)
 	{
 		if(vwt.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".vwt\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".vwt\" -type \"doubleArray\" ");
 		vwt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setKeepBorder(bool kb)
 	{
 		if(kb == true) return;
-		fprintf(mFile,"\tsetAttr \".kb\" %i;\n", kb);
+		writeInt(mFile,"\tsetAttr \".kb\" ",kb,";\n");
 	}
 	void setKeepMapBorder(bool kmb)
 	{
 		if(kmb == true) return;
-		fprintf(mFile,"\tsetAttr \".kmb\" %i;\n", kmb);
+		writeInt(mFile,"\tsetAttr \".kmb\" ",kmb,";\n");
 	}
 	void setKeepHardEdge(bool khe)
 	{
 		if(khe == true) return;
-		fprintf(mFile,"\tsetAttr \".khe\" %i;\n", khe);
+		writeInt(mFile,"\tsetAttr \".khe\" ",khe,";\n");
 	}
 	void setKeepOriginalVertices(bool kev)
 	{
 		if(kev == false) return;
-		fprintf(mFile,"\tsetAttr \".kev\" %i;\n", kev);
+		writeInt(mFile,"\tsetAttr \".kev\" ",kev,";\n");
 	}
 	void setTriangulate(bool t)
 	{
 		if(t == true) return;
-		fprintf(mFile,"\tsetAttr \".t\" %i;\n", t);
+		writeInt(mFile,"\tsetAttr \".t\" ",t,";\n");
 	}
 	void setCachingReduce(bool cr)
 	{
 		if(cr == false) return;
-		fprintf(mFile,"\tsetAttr \".cr\" %i;\n", cr);
+		writeInt(mFile,"\tsetAttr \".cr\" ",cr,";\n");
 	}
 	void setBorder(double b)
 	{
 		if(b == .5) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setLine(double l)
 	{
 		if(l == .5) return;
-		fprintf(mFile,"\tsetAttr \".l\" %f;\n", l);
+		writeFloat(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void setDetail(double d)
 	{
 		if(d == .5) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void getPercentage()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getCompactness()const
 	{
-		fprintf(mFile,"\"%s.com\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".com\"");
 	}
 	void getGeomWeights()const
 	{
-		fprintf(mFile,"\"%s.gwt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gwt\"");
 	}
 	void getUvWeights()const
 	{
-		fprintf(mFile,"\"%s.uwt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uwt\"");
 	}
 	void getColorWeights()const
 	{
-		fprintf(mFile,"\"%s.cwt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cwt\"");
 	}
 	void getKeepQuadsWeight()const
 	{
-		fprintf(mFile,"\"%s.kqw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kqw\"");
 	}
 	void getWeightCoefficient()const
 	{
-		fprintf(mFile,"\"%s.wc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wc\"");
 	}
 	void getWeights(size_t wts_i)const
 	{
-		fprintf(mFile,"\"%s.wts[%i]\"",mName.c_str(),wts_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wts[",wts_i,"]\"");
 	}
 	void getWeights()const
 	{
 
-		fprintf(mFile,"\"%s.wts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wts\"");
 	}
 	void getVertexWeights()const
 	{
-		fprintf(mFile,"\"%s.vwt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vwt\"");
 	}
 	void getKeepBorder()const
 	{
-		fprintf(mFile,"\"%s.kb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kb\"");
 	}
 	void getKeepMapBorder()const
 	{
-		fprintf(mFile,"\"%s.kmb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kmb\"");
 	}
 	void getKeepHardEdge()const
 	{
-		fprintf(mFile,"\"%s.khe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".khe\"");
 	}
 	void getKeepOriginalVertices()const
 	{
-		fprintf(mFile,"\"%s.kev\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kev\"");
 	}
 	void getTriangulate()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getCachingReduce()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getBorder()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getLine()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getDetail()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 protected:
 	PolyReduce(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
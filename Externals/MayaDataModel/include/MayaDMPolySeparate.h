@@ -27,40 +27,40 @@ public:
 	void setUseOldPolyArchitecture(bool uopa)
 	{
 		if(uopa == false) return;
-		fprintf(mFile,"\tsetAttr \".uopa\" %i;\n", uopa);
+		writeInt(mFile,"\tsetAttr \".uopa\" ",uopa,";\n");
 	}
 	void setIcount(int ic)
 	{
 		if(ic == -1) return;
-		fprintf(mFile,"\tsetAttr \".ic\" %i;\n", ic);
+		writeInt(mFile,"\tsetAttr \".ic\" ",ic,";\n");
 	}
 	void setRemShells(const intArray& rs)
 	{
 		if(rs.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".rs\" -type \"intArray\" ");
+		writeString(mFile,"\tsetAttr \".rs\" -type \"intArray\" ");
 		rs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInputPoly()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getIcount()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getRemShells()const
 	{
-		fprintf(mFile,"\"%s.rs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs\"");
 	}
 	void getOutput(size_t out_i)const
 	{
-		fprintf(mFile,"\"%s.out[%i]\"",mName.c_str(),out_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".out[",out_i,"]\"");
 	}
 	void getOutput()const
 	{
 
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 protected:
 	PolySeparate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setSmoothness(short sm)
 	{
 		if(sm == 1) return;
-		fprintf(mFile,"\tsetAttr \".sm\" %i;\n", sm);
+		writeInt(mFile,"\tsetAttr \".sm\" ",sm,";\n");
 	}
 	void getSmoothness()const
 	{
-		fprintf(mFile,"\"%s.sm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sm\"");
 	}
 protected:
 	PolySmooth(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,150 +27,150 @@ public:
 	void setMethod(unsigned int mth)
 	{
 		if(mth == 0) return;
-		fprintf(mFile,"\tsetAttr \".mth\" %i;\n", mth);
+		writeInt(mFile,"\tsetAttr \".mth\" ",mth,";\n");
 	}
 	void setExponentialLevel(short el)
 	{
 		if(el == 1) return;
-		fprintf(mFile,"\tsetAttr \".el\" %i;\n", el);
+		writeInt(mFile,"\tsetAttr \".el\" ",el,";\n");
 	}
 	void setContinuity(float c)
 	{
 		if(c == 1) return;
-		fprintf(mFile,"\tsetAttr \".c\" %f;\n", c);
+		writeFloat(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setSmoothUVs(bool suv)
 	{
 		if(suv == false) return;
-		fprintf(mFile,"\tsetAttr \".suv\" %i;\n", suv);
+		writeInt(mFile,"\tsetAttr \".suv\" ",suv,";\n");
 	}
 	void setKeepBorder(bool kb)
 	{
 		if(kb == true) return;
-		fprintf(mFile,"\tsetAttr \".kb\" %i;\n", kb);
+		writeInt(mFile,"\tsetAttr \".kb\" ",kb,";\n");
 	}
 	void setKeepHardEdge(bool khe)
 	{
 		if(khe == false) return;
-		fprintf(mFile,"\tsetAttr \".khe\" %i;\n", khe);
+		writeInt(mFile,"\tsetAttr \".khe\" ",khe,";\n");
 	}
 	void setPropagateEdgeHardness(bool peh)
 	{
 		if(peh == false) return;
-		fprintf(mFile,"\tsetAttr \".peh\" %i;\n", peh);
+		writeInt(mFile,"\tsetAttr \".peh\" ",peh,";\n");
 	}
 	void setKeepMapBorders(unsigned int kmb)
 	{
 		if(kmb == 1) return;
-		fprintf(mFile,"\tsetAttr \".kmb\" %i;\n", kmb);
+		writeInt(mFile,"\tsetAttr \".kmb\" ",kmb,";\n");
 	}
 	void setLinearLevel(short ll)
 	{
 		if(ll == 1) return;
-		fprintf(mFile,"\tsetAttr \".ll\" %i;\n", ll);
+		writeInt(mFile,"\tsetAttr \".ll\" ",ll,";\n");
 	}
 	void setDivisionsPerEdge(int dpe)
 	{
 		if(dpe == 1) return;
-		fprintf(mFile,"\tsetAttr \".dpe\" %i;\n", dpe);
+		writeInt(mFile,"\tsetAttr \".dpe\" ",dpe,";\n");
 	}
 	void setDegree(int deg)
 	{
 		if(deg == 3) return;
-		fprintf(mFile,"\tsetAttr \".deg\" %i;\n", deg);
+		writeInt(mFile,"\tsetAttr \".deg\" ",deg,";\n");
 	}
 	void setPushStrength(float ps)
 	{
 		if(ps == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ps\" %f;\n", ps);
+		writeFloat(mFile,"\tsetAttr \".ps\" ",ps,";\n");
 	}
 	void setRoundness(float ro)
 	{
 		if(ro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %f;\n", ro);
+		writeFloat(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void setMultiEdgeCrease(bool mec)
 	{
 		if(mec == true) return;
-		fprintf(mFile,"\tsetAttr \".mec\" %i;\n", mec);
+		writeInt(mFile,"\tsetAttr \".mec\" ",mec,";\n");
 	}
 	void setMaya65Above(bool ma)
 	{
 		if(ma == false) return;
-		fprintf(mFile,"\tsetAttr \".ma\" %i;\n", ma);
+		writeInt(mFile,"\tsetAttr \".ma\" ",ma,";\n");
 	}
 	void setMaya2008Above(bool mn)
 	{
 		if(mn == false) return;
-		fprintf(mFile,"\tsetAttr \".mn\" %i;\n", mn);
+		writeInt(mFile,"\tsetAttr \".mn\" ",mn,";\n");
 	}
 	void getCachedSmoothMesh()const
 	{
-		fprintf(mFile,"\"%s.csm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csm\"");
 	}
 	void getMethod()const
 	{
-		fprintf(mFile,"\"%s.mth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mth\"");
 	}
 	void getExponentialLevel()const
 	{
-		fprintf(mFile,"\"%s.el\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".el\"");
 	}
 	void getContinuity()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getSmoothUVs()const
 	{
-		fprintf(mFile,"\"%s.suv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".suv\"");
 	}
 	void getKeepBorder()const
 	{
-		fprintf(mFile,"\"%s.kb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kb\"");
 	}
 	void getKeepHardEdge()const
 	{
-		fprintf(mFile,"\"%s.khe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".khe\"");
 	}
 	void getPropagateEdgeHardness()const
 	{
-		fprintf(mFile,"\"%s.peh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".peh\"");
 	}
 	void getKeepMapBorders()const
 	{
-		fprintf(mFile,"\"%s.kmb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kmb\"");
 	}
 	void getLinearLevel()const
 	{
-		fprintf(mFile,"\"%s.ll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ll\"");
 	}
 	void getDivisionsPerEdge()const
 	{
-		fprintf(mFile,"\"%s.dpe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpe\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.deg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".deg\"");
 	}
 	void getPushStrength()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getRoundness()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getMultiEdgeCrease()const
 	{
-		fprintf(mFile,"\"%s.mec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mec\"");
 	}
 	void getMaya65Above()const
 	{
-		fprintf(mFile,"\"%s.ma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ma\"");
 	}
 	void getMaya2008Above()const
 	{
-		fprintf(mFile,"\"%s.mn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mn\"");
 	}
 protected:
 	PolySmoothProxy(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		unsigned int profileCurve_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", profileCurve_Position);
-			fprintf(file,"%f ", profileCurve_FloatValue);
-			fprintf(file,"%i", profileCurve_Interp);
+			writeFloat(file,"",profileCurve_Position," ");
+			writeFloat(file,"",profileCurve_FloatValue," ");
+			writeInt(file,"",profileCurve_Interp);
 		}
 	};
 public:
@@ -38,196 +38,196 @@ public:
 	void setWeight(float wt)
 	{
 		if(wt == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".wt\" %f;\n", wt);
+		writeFloat(mFile,"\tsetAttr \".wt\" ",wt,";\n");
 	}
 	void setDirection(bool dr)
 	{
 		if(dr == true) return;
-		fprintf(mFile,"\tsetAttr \".dr\" %i;\n", dr);
+		writeInt(mFile,"\tsetAttr \".dr\" ",dr,";\n");
 	}
 	void setRootEdge(int re)
 	{
 		if(re == -1) return;
-		fprintf(mFile,"\tsetAttr \".re\" %i;\n", re);
+		writeInt(mFile,"\tsetAttr \".re\" ",re,";\n");
 	}
 	void setSmoothingAngle(double sma)
 	{
 		if(sma == 1) return;
-		fprintf(mFile,"\tsetAttr \".sma\" %f;\n", sma);
+		writeFloat(mFile,"\tsetAttr \".sma\" ",sma,";\n");
 	}
 	void setSplitType(unsigned int stp)
 	{
 		if(stp == 1) return;
-		fprintf(mFile,"\tsetAttr \".stp\" %i;\n", stp);
+		writeInt(mFile,"\tsetAttr \".stp\" ",stp,";\n");
 	}
 	void setDivisions(int div)
 	{
 		if(div == 2) return;
-		fprintf(mFile,"\tsetAttr \".div\" %i;\n", div);
+		writeInt(mFile,"\tsetAttr \".div\" ",div,";\n");
 	}
 	void setEnableProfileCurve(bool epc)
 	{
 		if(epc == true) return;
-		fprintf(mFile,"\tsetAttr \".epc\" %i;\n", epc);
+		writeInt(mFile,"\tsetAttr \".epc\" ",epc,";\n");
 	}
 	void setProfileCurve(size_t p_i,const ProfileCurve& p)
 	{
-		fprintf(mFile,"\tsetAttr \".p[%i]\" ",p_i);
+		writeInt(mFile,"\tsetAttr \".p[",p_i,"]\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProfileCurve(size_t p_start,size_t p_end,ProfileCurve* p)
 	{
-		fprintf(mFile,"\tsetAttr \".p[%i:%i]\" ", p_start,p_end);
+		writeInt(mFile,"\tsetAttr \".p[",p_start); writeInt(mFile,":",p_end,"]\" ");
 		size_t size = (p_end-p_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			p[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startProfileCurve(size_t p_start,size_t p_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".p[%i:%i]\"",p_start,p_end);
-		fprintf(mFile," -type \"ProfileCurve\" ");
+		writeInt(mFile,"\tsetAttr \".p[",p_start); writeInt(mFile,":",p_end,"]\"");
+		writeString(mFile," -type \"ProfileCurve\" ");
 	}
 	void appendProfileCurve(const ProfileCurve& p)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		p.write(mFile);
 	}
 	void endProfileCurve()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProfileCurve_Position(size_t p_i,float pp)
 	{
 		if(pp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p[%i].pp\" %f;\n", p_i,pp);
+		writeInt(mFile,"\tsetAttr \".p[",p_i); writeFloat(mFile,"].pp\" ",pp,";\n");
 	}
 	void setProfileCurve_FloatValue(size_t p_i,float pfv)
 	{
 		if(pfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p[%i].pfv\" %f;\n", p_i,pfv);
+		writeInt(mFile,"\tsetAttr \".p[",p_i); writeFloat(mFile,"].pfv\" ",pfv,";\n");
 	}
 	void setProfileCurve_Interp(size_t p_i,unsigned int pi)
 	{
 		if(pi == 0) return;
-		fprintf(mFile,"\tsetAttr \".p[%i].pi\" %i;\n", p_i,pi);
+		writeInt(mFile,"\tsetAttr \".p[",p_i); writeInt(mFile,"].pi\" ",pi,";\n");
 	}
 	void setProfileCurveInputOffset(float pio)
 	{
 		if(pio == 0.0f) return;
-		fprintf(mFile,"\tsetAttr \".pio\" %f;\n", pio);
+		writeFloat(mFile,"\tsetAttr \".pio\" ",pio,";\n");
 	}
 	void setProfileCurveInputScale(float pis)
 	{
 		if(pis == 1.0f) return;
-		fprintf(mFile,"\tsetAttr \".pis\" %f;\n", pis);
+		writeFloat(mFile,"\tsetAttr \".pis\" ",pis,";\n");
 	}
 	void setUseFaceNormalsAtEnds(bool fne)
 	{
 		if(fne == true) return;
-		fprintf(mFile,"\tsetAttr \".fne\" %i;\n", fne);
+		writeInt(mFile,"\tsetAttr \".fne\" ",fne,";\n");
 	}
 	void setUseEqualMultiplier(bool uem)
 	{
 		if(uem == true) return;
-		fprintf(mFile,"\tsetAttr \".uem\" %i;\n", uem);
+		writeInt(mFile,"\tsetAttr \".uem\" ",uem,";\n");
 	}
 	void setFixQuads(bool fq)
 	{
 		if(fq == false) return;
-		fprintf(mFile,"\tsetAttr \".fq\" %i;\n", fq);
+		writeInt(mFile,"\tsetAttr \".fq\" ",fq,";\n");
 	}
 	void getWeight()const
 	{
-		fprintf(mFile,"\"%s.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wt\"");
 	}
 	void getAbsoluteWeight()const
 	{
-		fprintf(mFile,"\"%s.ab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ab\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getRootEdge()const
 	{
-		fprintf(mFile,"\"%s.re\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".re\"");
 	}
 	void getSmoothingAngle()const
 	{
-		fprintf(mFile,"\"%s.sma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sma\"");
 	}
 	void getSplitType()const
 	{
-		fprintf(mFile,"\"%s.stp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stp\"");
 	}
 	void getDivisions()const
 	{
-		fprintf(mFile,"\"%s.div\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".div\"");
 	}
 	void getEnableProfileCurve()const
 	{
-		fprintf(mFile,"\"%s.epc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".epc\"");
 	}
 	void getProfileCurve(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getProfileCurve()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getProfileCurve_Position(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].pp\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].pp\"");
 	}
 	void getProfileCurve_Position()const
 	{
 
-		fprintf(mFile,"\"%s.p.pp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pp\"");
 	}
 	void getProfileCurve_FloatValue(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].pfv\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].pfv\"");
 	}
 	void getProfileCurve_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.p.pfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pfv\"");
 	}
 	void getProfileCurve_Interp(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].pi\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].pi\"");
 	}
 	void getProfileCurve_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.p.pi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pi\"");
 	}
 	void getProfileCurveInputOffset()const
 	{
-		fprintf(mFile,"\"%s.pio\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pio\"");
 	}
 	void getProfileCurveInputScale()const
 	{
-		fprintf(mFile,"\"%s.pis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pis\"");
 	}
 	void getUseFaceNormalsAtEnds()const
 	{
-		fprintf(mFile,"\"%s.fne\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fne\"");
 	}
 	void getUseEqualMultiplier()const
 	{
-		fprintf(mFile,"\"%s.uem\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uem\"");
 	}
 	void getFixQuads()const
 	{
-		fprintf(mFile,"\"%s.fq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fq\"");
 	}
 protected:
 	PolySplitRing(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,38 +27,38 @@ public:
 	void setCurvature(float c)
 	{
 		if(c == 0.) return;
-		fprintf(mFile,"\tsetAttr \".c\" %f;\n", c);
+		writeFloat(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setPreserveLength(float pl)
 	{
 		if(pl == 1.) return;
-		fprintf(mFile,"\tsetAttr \".pl\" %f;\n", pl);
+		writeFloat(mFile,"\tsetAttr \".pl\" ",pl,";\n");
 	}
 	void setBlendOriginal(float bo)
 	{
 		if(bo == 0.) return;
-		fprintf(mFile,"\tsetAttr \".bo\" %f;\n", bo);
+		writeFloat(mFile,"\tsetAttr \".bo\" ",bo,";\n");
 	}
 	void setGapTolerance(int gt)
 	{
 		if(gt == 5) return;
-		fprintf(mFile,"\tsetAttr \".gt\" %i;\n", gt);
+		writeInt(mFile,"\tsetAttr \".gt\" ",gt,";\n");
 	}
 	void getCurvature()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getPreserveLength()const
 	{
-		fprintf(mFile,"\"%s.pl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pl\"");
 	}
 	void getBlendOriginal()const
 	{
-		fprintf(mFile,"\"%s.bo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bo\"");
 	}
 	void getGapTolerance()const
 	{
-		fprintf(mFile,"\"%s.gt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gt\"");
 	}
 protected:
 	PolyStraightenUVBorder(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,20 +27,20 @@ public:
 	void setDivisions(int dv)
 	{
 		if(dv == 1) return;
-		fprintf(mFile,"\tsetAttr \".dv\" %i;\n", dv);
+		writeInt(mFile,"\tsetAttr \".dv\" ",dv,";\n");
 	}
 	void setSize(double s)
 	{
 		if(s == 0) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void getDivisions()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getSize()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 protected:
 	PolySubdEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,47 +27,47 @@ public:
 	void setDivisions(int dv)
 	{
 		if(dv == 1) return;
-		fprintf(mFile,"\tsetAttr \".dv\" %i;\n", dv);
+		writeInt(mFile,"\tsetAttr \".dv\" ",dv,";\n");
 	}
 	void setDivisionsU(int duv)
 	{
 		if(duv == 1) return;
-		fprintf(mFile,"\tsetAttr \".duv\" %i;\n", duv);
+		writeInt(mFile,"\tsetAttr \".duv\" ",duv,";\n");
 	}
 	void setDivisionsV(int dvv)
 	{
 		if(dvv == 1) return;
-		fprintf(mFile,"\tsetAttr \".dvv\" %i;\n", dvv);
+		writeInt(mFile,"\tsetAttr \".dvv\" ",dvv,";\n");
 	}
 	void setMode(unsigned int m)
 	{
 		if(m == 0) return;
-		fprintf(mFile,"\tsetAttr \".m\" %i;\n", m);
+		writeInt(mFile,"\tsetAttr \".m\" ",m,";\n");
 	}
 	void setSubdMethod(unsigned int sbm)
 	{
 		if(sbm == 0) return;
-		fprintf(mFile,"\tsetAttr \".sbm\" %i;\n", sbm);
+		writeInt(mFile,"\tsetAttr \".sbm\" ",sbm,";\n");
 	}
 	void getDivisions()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getDivisionsU()const
 	{
-		fprintf(mFile,"\"%s.duv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".duv\"");
 	}
 	void getDivisionsV()const
 	{
-		fprintf(mFile,"\"%s.dvv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dvv\"");
 	}
 	void getMode()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getSubdMethod()const
 	{
-		fprintf(mFile,"\"%s.sbm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sbm\"");
 	}
 protected:
 	PolySubdFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
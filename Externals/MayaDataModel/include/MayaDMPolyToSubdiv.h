@@ -25,7 +25,7 @@ public:
 			for (size_t i = 0; i<nbUvPoints; ++i)
 			{
 				uvPoints[i].write(file);
-				if (i + 1<nbUvPoints) fprintf(file, " ");
+				if (i + 1<nbUvPoints) writeString(file," ");
 			}
 		}
 	};
@@ -38,186 +38,186 @@ public:
 
 	void setInMesh(const mesh& i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i\" -type \"mesh\" ");
+		writeString(mFile,"\tsetAttr \".i\" -type \"mesh\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxPolyCount(int mpc)
 	{
 		if(mpc == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mpc\" %i;\n", mpc);
+		writeInt(mFile,"\tsetAttr \".mpc\" ",mpc,";\n");
 	}
 	void setMaxEdgesPerVert(int me)
 	{
 		if(me == 32) return;
-		fprintf(mFile,"\tsetAttr \".me\" %i;\n", me);
+		writeInt(mFile,"\tsetAttr \".me\" ",me,";\n");
 	}
 	void setApplyMatrixToResult(bool amr)
 	{
 		if(amr == true) return;
-		fprintf(mFile,"\tsetAttr \".amr\" %i;\n", amr);
+		writeInt(mFile,"\tsetAttr \".amr\" ",amr,";\n");
 	}
 	void setAbsolutePosition(bool ap)
 	{
 		if(ap == false) return;
-		fprintf(mFile,"\tsetAttr \".ap\" %i;\n", ap);
+		writeInt(mFile,"\tsetAttr \".ap\" ",ap,";\n");
 	}
 	void setUvTreatment(unsigned int uvt)
 	{
 		if(uvt == 0) return;
-		fprintf(mFile,"\tsetAttr \".uvt\" %i;\n", uvt);
+		writeInt(mFile,"\tsetAttr \".uvt\" ",uvt,";\n");
 	}
 	void setCachedUVs(size_t cuv_i,const CachedUVs& cuv)
 	{
-		fprintf(mFile,"\tsetAttr \".cuv[%i]\" ",cuv_i);
+		writeInt(mFile,"\tsetAttr \".cuv[",cuv_i,"]\" ");
 		cuv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCachedUVs(size_t cuv_start,size_t cuv_end,CachedUVs* cuv)
 	{
-		fprintf(mFile,"\tsetAttr \".cuv[%i:%i]\" ", cuv_start,cuv_end);
+		writeInt(mFile,"\tsetAttr \".cuv[",cuv_start); writeInt(mFile,":",cuv_end,"]\" ");
 		size_t size = (cuv_end-cuv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cuv[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCachedUVs(size_t cuv_start,size_t cuv_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cuv[%i:%i]\"",cuv_start,cuv_end);
-		fprintf(mFile," -type \"CachedUVs\" ");
+		writeInt(mFile,"\tsetAttr \".cuv[",cuv_start); writeInt(mFile,":",cuv_end,"]\"");
+		writeString(mFile," -type \"CachedUVs\" ");
 	}
 	void appendCachedUVs(const CachedUVs& cuv)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cuv.write(mFile);
 	}
 	void endCachedUVs()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvPoints(size_t cuv_i,size_t uvp_i,const float2& uvp)
 	{
-		fprintf(mFile,"\tsetAttr \".cuv[%i].uvp[%i]\" -type \"float2\" ",cuv_i,uvp_i);
+		writeInt(mFile,"\tsetAttr \".cuv[",cuv_i); writeInt(mFile,"].uvp[",uvp_i,"]\" -type \"float2\" ");
 		uvp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvPoints(size_t cuv_i,size_t uvp_start,size_t uvp_end,float* uvp)
 	{
-		fprintf(mFile,"\tsetAttr \".cuv[%i].uvp[%i:%i]\" ", cuv_i,uvp_start,uvp_end);
+		writeInt(mFile,"\tsetAttr \".cuv[",cuv_i); writeInt(mFile,"].uvp[",uvp_start); writeInt(mFile,":",uvp_end,"]\" ");
 		size_t size = (uvp_end-uvp_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uvp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",uvp[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startUvPoints(size_t cuv_i,size_t uvp_start,size_t uvp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cuv[%i].uvp[%i:%i]\"",cuv_i,uvp_start,uvp_end);
+		writeInt(mFile,"\tsetAttr \".cuv[",cuv_i); writeInt(mFile,"].uvp[",uvp_start); writeInt(mFile,":",uvp_end,"]\"");
 	}
 	void appendUvPoints(float uvp)const
 	{
-		fprintf(mFile," %f",uvp);
+		writeFloat(mFile," ",uvp);
 	}
 	void endUvPoints()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvPointsU(size_t cuv_i,size_t uvp_i,float uvu)
 	{
 		if(uvu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cuv[%i].uvp[%i].uvu\" %f;\n", cuv_i,uvp_i,uvu);
+		writeInt(mFile,"\tsetAttr \".cuv[",cuv_i); writeInt(mFile,"].uvp[",uvp_i); writeFloat(mFile,"].uvu\" ",uvu,";\n");
 	}
 	void setUvPointsV(size_t cuv_i,size_t uvp_i,float uvv)
 	{
 		if(uvv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cuv[%i].uvp[%i].uvv\" %f;\n", cuv_i,uvp_i,uvv);
+		writeInt(mFile,"\tsetAttr \".cuv[",cuv_i); writeInt(mFile,"].uvp[",uvp_i); writeFloat(mFile,"].uvv\" ",uvv,";\n");
 	}
 	void setPreserveVertexOrdering(bool pvo)
 	{
 		if(pvo == true) return;
-		fprintf(mFile,"\tsetAttr \".pvo\" %i;\n", pvo);
+		writeInt(mFile,"\tsetAttr \".pvo\" ",pvo,";\n");
 	}
 	void setQuickConvert(bool qc)
 	{
 		if(qc == true) return;
-		fprintf(mFile,"\tsetAttr \".qc\" %i;\n", qc);
+		writeInt(mFile,"\tsetAttr \".qc\" ",qc,";\n");
 	}
 	void getInMesh()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutSubdiv()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getMaxPolyCount()const
 	{
-		fprintf(mFile,"\"%s.mpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpc\"");
 	}
 	void getMaxEdgesPerVert()const
 	{
-		fprintf(mFile,"\"%s.me\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".me\"");
 	}
 	void getApplyMatrixToResult()const
 	{
-		fprintf(mFile,"\"%s.amr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amr\"");
 	}
 	void getAbsolutePosition()const
 	{
-		fprintf(mFile,"\"%s.ap\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ap\"");
 	}
 	void getUvTreatment()const
 	{
-		fprintf(mFile,"\"%s.uvt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvt\"");
 	}
 	void getCachedUVs(size_t cuv_i)const
 	{
-		fprintf(mFile,"\"%s.cuv[%i]\"",mName.c_str(),cuv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cuv[",cuv_i,"]\"");
 	}
 	void getCachedUVs()const
 	{
 
-		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cuv\"");
 	}
 	void getUvPoints(size_t cuv_i,size_t uvp_i)const
 	{
-		fprintf(mFile,"\"%s.cuv[%i].uvp[%i]\"",mName.c_str(),cuv_i,uvp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cuv[",cuv_i); writeInt(mFile,"].uvp[",uvp_i,"]\"");
 	}
 	void getUvPoints(size_t uvp_i)const
 	{
 
-		fprintf(mFile,"\"%s.cuv.uvp[%i]\"",mName.c_str(),uvp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cuv.uvp[",uvp_i,"]\"");
 	}
 	void getUvPointsU(size_t cuv_i,size_t uvp_i)const
 	{
-		fprintf(mFile,"\"%s.cuv[%i].uvp[%i].uvu\"",mName.c_str(),cuv_i,uvp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cuv[",cuv_i); writeInt(mFile,"].uvp[",uvp_i,"].uvu\"");
 	}
 	void getUvPointsU(size_t uvp_i)const
 	{
 
-		fprintf(mFile,"\"%s.cuv.uvp[%i].uvu\"",mName.c_str(),uvp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cuv.uvp[",uvp_i,"].uvu\"");
 	}
 	void getUvPointsV(size_t cuv_i,size_t uvp_i)const
 	{
-		fprintf(mFile,"\"%s.cuv[%i].uvp[%i].uvv\"",mName.c_str(),cuv_i,uvp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cuv[",cuv_i); writeInt(mFile,"].uvp[",uvp_i,"].uvv\"");
 	}
 	void getUvPointsV(size_t uvp_i)const
 	{
 
-		fprintf(mFile,"\"%s.cuv.uvp[%i].uvv\"",mName.c_str(),uvp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cuv.uvp[",uvp_i,"].uvv\"");
 	}
 	void getPreserveVertexOrdering()const
 	{
-		fprintf(mFile,"\"%s.pvo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvo\"");
 	}
 	void getQuickConvert()const
 	{
-		fprintf(mFile,"\"%s.qc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".qc\"");
 	}
 protected:
 	PolyToSubdiv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
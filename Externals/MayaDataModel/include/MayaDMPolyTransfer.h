@@ -26,40 +26,40 @@ public:
 
 	void setOtherPoly(const mesh& op)
 	{
-		fprintf(mFile,"\tsetAttr \".op\" -type \"mesh\" ");
+		writeString(mFile,"\tsetAttr \".op\" -type \"mesh\" ");
 		op.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertices(bool v)
 	{
 		if(v == false) return;
-		fprintf(mFile,"\tsetAttr \".v\" %i;\n", v);
+		writeInt(mFile,"\tsetAttr \".v\" ",v,";\n");
 	}
 	void setUvSets(bool uv)
 	{
 		if(uv == true) return;
-		fprintf(mFile,"\tsetAttr \".uv\" %i;\n", uv);
+		writeInt(mFile,"\tsetAttr \".uv\" ",uv,";\n");
 	}
 	void setVertexColor(bool vc)
 	{
 		if(vc == false) return;
-		fprintf(mFile,"\tsetAttr \".vc\" %i;\n", vc);
+		writeInt(mFile,"\tsetAttr \".vc\" ",vc,";\n");
 	}
 	void getOtherPoly()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getVertices()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getUvSets()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getVertexColor()const
 	{
-		fprintf(mFile,"\"%s.vc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc\"");
 	}
 protected:
 	PolyTransfer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
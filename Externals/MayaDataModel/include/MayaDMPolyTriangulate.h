@@ -27,7 +27,7 @@ public:
 	void setMaya80(bool m80)
 	{
 		if(m80 == true) return;
-		fprintf(mFile,"\tsetAttr \".m80\" %i;\n", m80);
+		writeInt(mFile,"\tsetAttr \".m80\" ",m80,";\n");
 	}
 protected:
 	PolyTriangulate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -24,10 +24,10 @@ public:
 		float newVValue;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", faceId);
-			fprintf(file,"%i ", vertexId);
-			fprintf(file,"%f ", newUValue);
-			fprintf(file,"%f", newVValue);
+			writeInt(file,"",faceId," ");
+			writeInt(file,"",vertexId," ");
+			writeFloat(file,"",newUValue," ");
+			writeFloat(file,"",newVValue);
 		}
 	};
 public:
@@ -40,176 +40,176 @@ public:
 	void setUvTweak(size_t uvtk_i,const float2& uvtk)
 	{
 		if(uvtk == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".uvtk[%i]\" -type \"float2\" ",uvtk_i);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_i,"]\" -type \"float2\" ");
 		uvtk.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvTweak(size_t uvtk_start,size_t uvtk_end,float* uvtk)
 	{
-		fprintf(mFile,"\tsetAttr \".uvtk[%i:%i]\" ", uvtk_start,uvtk_end);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_start); writeInt(mFile,":",uvtk_end,"]\" ");
 		size_t size = (uvtk_end-uvtk_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uvtk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",uvtk[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startUvTweak(size_t uvtk_start,size_t uvtk_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".uvtk[%i:%i]\"",uvtk_start,uvtk_end);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_start); writeInt(mFile,":",uvtk_end,"]\"");
 	}
 	void appendUvTweak(float uvtk)const
 	{
-		fprintf(mFile," %f",uvtk);
+		writeFloat(mFile," ",uvtk);
 	}
 	void endUvTweak()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvTweakU(size_t uvtk_i,float tu)
 	{
 		if(tu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uvtk[%i].tu\" %f;\n", uvtk_i,tu);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_i); writeFloat(mFile,"].tu\" ",tu,";\n");
 	}
 	void setUvTweakV(size_t uvtk_i,float tv)
 	{
 		if(tv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uvtk[%i].tv\" %f;\n", uvtk_i,tv);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_i); writeFloat(mFile,"].tv\" ",tv,";\n");
 	}
 	void setNewUV(size_t nuv_i,const NewUV& nuv)
 	{
-		fprintf(mFile,"\tsetAttr \".nuv[%i]\" ",nuv_i);
+		writeInt(mFile,"\tsetAttr \".nuv[",nuv_i,"]\" ");
 		nuv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNewUV(size_t nuv_start,size_t nuv_end,NewUV* nuv)
 	{
-		fprintf(mFile,"\tsetAttr \".nuv[%i:%i]\" ", nuv_start,nuv_end);
+		writeInt(mFile,"\tsetAttr \".nuv[",nuv_start); writeInt(mFile,":",nuv_end,"]\" ");
 		size_t size = (nuv_end-nuv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			nuv[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startNewUV(size_t nuv_start,size_t nuv_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".nuv[%i:%i]\"",nuv_start,nuv_end);
-		fprintf(mFile," -type \"NewUV\" ");
+		writeInt(mFile,"\tsetAttr \".nuv[",nuv_start); writeInt(mFile,":",nuv_end,"]\"");
+		writeString(mFile," -type \"NewUV\" ");
 	}
 	void appendNewUV(const NewUV& nuv)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		nuv.write(mFile);
 	}
 	void endNewUV()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFaceId(size_t nuv_i,int fid)
 	{
 		if(fid == 0) return;
-		fprintf(mFile,"\tsetAttr \".nuv[%i].fid\" %i;\n", nuv_i,fid);
+		writeInt(mFile,"\tsetAttr \".nuv[",nuv_i); writeInt(mFile,"].fid\" ",fid,";\n");
 	}
 	void setVertexId(size_t nuv_i,int vid)
 	{
 		if(vid == 0) return;
-		fprintf(mFile,"\tsetAttr \".nuv[%i].vid\" %i;\n", nuv_i,vid);
+		writeInt(mFile,"\tsetAttr \".nuv[",nuv_i); writeInt(mFile,"].vid\" ",vid,";\n");
 	}
 	void setNewUValue(size_t nuv_i,float nu)
 	{
 		if(nu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nuv[%i].nu\" %f;\n", nuv_i,nu);
+		writeInt(mFile,"\tsetAttr \".nuv[",nuv_i); writeFloat(mFile,"].nu\" ",nu,";\n");
 	}
 	void setNewVValue(size_t nuv_i,float nv)
 	{
 		if(nv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".nuv[%i].nv\" %f;\n", nuv_i,nv);
+		writeInt(mFile,"\tsetAttr \".nuv[",nuv_i); writeFloat(mFile,"].nv\" ",nv,";\n");
 	}
 	void setUvSetName(const string& uvs)
 	{
 		if(uvs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".uvs\" -type \"string\" ");
 		uvs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getUvTweak(size_t uvtk_i)const
 	{
-		fprintf(mFile,"\"%s.uvtk[%i]\"",mName.c_str(),uvtk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvtk[",uvtk_i,"]\"");
 	}
 	void getUvTweak()const
 	{
 
-		fprintf(mFile,"\"%s.uvtk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvtk\"");
 	}
 	void getUvTweakU(size_t uvtk_i)const
 	{
-		fprintf(mFile,"\"%s.uvtk[%i].tu\"",mName.c_str(),uvtk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvtk[",uvtk_i,"].tu\"");
 	}
 	void getUvTweakU()const
 	{
 
-		fprintf(mFile,"\"%s.uvtk.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvtk.tu\"");
 	}
 	void getUvTweakV(size_t uvtk_i)const
 	{
-		fprintf(mFile,"\"%s.uvtk[%i].tv\"",mName.c_str(),uvtk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvtk[",uvtk_i,"].tv\"");
 	}
 	void getUvTweakV()const
 	{
 
-		fprintf(mFile,"\"%s.uvtk.tv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvtk.tv\"");
 	}
 	void getNewUV(size_t nuv_i)const
 	{
-		fprintf(mFile,"\"%s.nuv[%i]\"",mName.c_str(),nuv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nuv[",nuv_i,"]\"");
 	}
 	void getNewUV()const
 	{
 
-		fprintf(mFile,"\"%s.nuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nuv\"");
 	}
 	void getFaceId(size_t nuv_i)const
 	{
-		fprintf(mFile,"\"%s.nuv[%i].fid\"",mName.c_str(),nuv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nuv[",nuv_i,"].fid\"");
 	}
 	void getFaceId()const
 	{
 
-		fprintf(mFile,"\"%s.nuv.fid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nuv.fid\"");
 	}
 	void getVertexId(size_t nuv_i)const
 	{
-		fprintf(mFile,"\"%s.nuv[%i].vid\"",mName.c_str(),nuv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nuv[",nuv_i,"].vid\"");
 	}
 	void getVertexId()const
 	{
 
-		fprintf(mFile,"\"%s.nuv.vid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nuv.vid\"");
 	}
 	void getNewUValue(size_t nuv_i)const
 	{
-		fprintf(mFile,"\"%s.nuv[%i].nu\"",mName.c_str(),nuv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nuv[",nuv_i,"].nu\"");
 	}
 	void getNewUValue()const
 	{
 
-		fprintf(mFile,"\"%s.nuv.nu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nuv.nu\"");
 	}
 	void getNewVValue(size_t nuv_i)const
 	{
-		fprintf(mFile,"\"%s.nuv[%i].nv\"",mName.c_str(),nuv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".nuv[",nuv_i,"].nv\"");
 	}
 	void getNewVValue()const
 	{
 
-		fprintf(mFile,"\"%s.nuv.nv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nuv.nv\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 protected:
 	PolyTweakUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,25 +27,25 @@ public:
 	void setUseOldPolyArchitecture(bool uopa)
 	{
 		if(uopa == false) return;
-		fprintf(mFile,"\tsetAttr \".uopa\" %i;\n", uopa);
+		writeInt(mFile,"\tsetAttr \".uopa\" ",uopa,";\n");
 	}
 	void getInputPoly(size_t ip_i)const
 	{
-		fprintf(mFile,"\"%s.ip[%i]\"",mName.c_str(),ip_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ip[",ip_i,"]\"");
 	}
 	void getInputPoly()const
 	{
 
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getInputMat(size_t im_i)const
 	{
-		fprintf(mFile,"\"%s.im[%i]\"",mName.c_str(),im_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".im[",im_i,"]\"");
 	}
 	void getInputMat()const
 	{
 
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 protected:
 	PolyUnite(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,57 +27,57 @@ public:
 	void setWedgeAngle(double wa)
 	{
 		if(wa == 0) return;
-		fprintf(mFile,"\tsetAttr \".wa\" %f;\n", wa);
+		writeFloat(mFile,"\tsetAttr \".wa\" ",wa,";\n");
 	}
 	void setDivisions(int d)
 	{
 		if(d == 1) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setEdge(size_t ed_i,int ed)
 	{
 		if(ed == 0) return;
-		fprintf(mFile,"\tsetAttr \".ed[%i]\" %i;\n", ed_i,ed);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_i); writeInt(mFile,"]\" ",ed,";\n");
 	}
 	void setEdge(size_t ed_start,size_t ed_end,int* ed)
 	{
-		fprintf(mFile,"\tsetAttr \".ed[%i:%i]\" ", ed_start,ed_end);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_start); writeInt(mFile,":",ed_end,"]\" ");
 		size_t size = (ed_end-ed_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ed[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ed[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEdge(size_t ed_start,size_t ed_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ed[%i:%i]\"",ed_start,ed_end);
+		writeInt(mFile,"\tsetAttr \".ed[",ed_start); writeInt(mFile,":",ed_end,"]\"");
 	}
 	void appendEdge(int ed)const
 	{
-		fprintf(mFile," %i",ed);
+		writeInt(mFile," ",ed);
 	}
 	void endEdge()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getWedgeAngle()const
 	{
-		fprintf(mFile,"\"%s.wa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wa\"");
 	}
 	void getDivisions()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getEdge(size_t ed_i)const
 	{
-		fprintf(mFile,"\"%s.ed[%i]\"",mName.c_str(),ed_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ed[",ed_i,"]\"");
 	}
 	void getEdge()const
 	{
 
-		fprintf(mFile,"\"%s.ed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed\"");
 	}
 protected:
 	PolyWedgeFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,11 +27,11 @@ public:
 	void setTime(double t)
 	{
 		if(t == 0) return;
-		fprintf(mFile,"\tsetAttr \".t\" %f;\n", t);
+		writeFloat(mFile,"\tsetAttr \".t\" ",t,";\n");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 protected:
 	PositionMarker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,81 +26,81 @@ public:
 
 	void setPivot(const double3& p)
 	{
-		fprintf(mFile,"\tsetAttr \".p\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"double3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPivotX(double px)
 	{
 		if(px == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPivotY(double py)
 	{
 		if(py == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setPivotZ(double pz)
 	{
 		if(pz == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".p.pz\" ",pz,";\n");
 	}
 	void setAxis(const double3& ax)
 	{
-		fprintf(mFile,"\tsetAttr \".ax\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ax\" -type \"double3\" ");
 		ax.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAxisX(double axx)
 	{
 		if(axx == 1) return;
-		fprintf(mFile,"\tsetAttr \".ax.axx\" %f;\n", axx);
+		writeFloat(mFile,"\tsetAttr \".ax.axx\" ",axx,";\n");
 	}
 	void setAxisY(double axy)
 	{
 		if(axy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axy\" %f;\n", axy);
+		writeFloat(mFile,"\tsetAttr \".ax.axy\" ",axy,";\n");
 	}
 	void setAxisZ(double axz)
 	{
 		if(axz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axz\" %f;\n", axz);
+		writeFloat(mFile,"\tsetAttr \".ax.axz\" ",axz,";\n");
 	}
 	void getPivot()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPivotX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPivotY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPivotZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getAxis()const
 	{
-		fprintf(mFile,"\"%s.ax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax\"");
 	}
 	void getAxisX()const
 	{
-		fprintf(mFile,"\"%s.ax.axx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axx\"");
 	}
 	void getAxisY()const
 	{
-		fprintf(mFile,"\"%s.ax.axy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axy\"");
 	}
 	void getAxisZ()const
 	{
-		fprintf(mFile,"\"%s.ax.axz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axz\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	Primitive(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,85 +27,85 @@ public:
 	void setTangentScale(double ts)
 	{
 		if(ts == 1) return;
-		fprintf(mFile,"\tsetAttr \".ts\" %f;\n", ts);
+		writeFloat(mFile,"\tsetAttr \".ts\" ",ts,";\n");
 	}
 	void setCurvatureScale(double cs)
 	{
 		if(cs == 0) return;
-		fprintf(mFile,"\tsetAttr \".cs\" %f;\n", cs);
+		writeFloat(mFile,"\tsetAttr \".cs\" ",cs,";\n");
 	}
 	void setRotate(double ro)
 	{
 		if(ro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %f;\n", ro);
+		writeFloat(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void setTangentDirection(unsigned int td)
 	{
 		if(td == 1) return;
-		fprintf(mFile,"\tsetAttr \".td\" %i;\n", td);
+		writeInt(mFile,"\tsetAttr \".td\" ",td,";\n");
 	}
 	void setCurvature(bool c)
 	{
 		if(c == false) return;
-		fprintf(mFile,"\tsetAttr \".c\" %i;\n", c);
+		writeInt(mFile,"\tsetAttr \".c\" ",c,";\n");
 	}
 	void setReverseTangent(bool rt)
 	{
 		if(rt == false) return;
-		fprintf(mFile,"\tsetAttr \".rt\" %i;\n", rt);
+		writeInt(mFile,"\tsetAttr \".rt\" ",rt,";\n");
 	}
 	void setIgnoreEdges(bool ie)
 	{
 		if(ie == false) return;
-		fprintf(mFile,"\tsetAttr \".ie\" %i;\n", ie);
+		writeInt(mFile,"\tsetAttr \".ie\" ",ie,";\n");
 	}
 	void getInputCurveToProject()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getInputCurve1ToProjectTo()const
 	{
-		fprintf(mFile,"\"%s.ic1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic1\"");
 	}
 	void getInputCurve2ToProjectTo()const
 	{
-		fprintf(mFile,"\"%s.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2\"");
 	}
 	void getInputSurfaceToProjectTo()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getTangentScale()const
 	{
-		fprintf(mFile,"\"%s.ts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ts\"");
 	}
 	void getCurvatureScale()const
 	{
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getRotate()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getTangentDirection()const
 	{
-		fprintf(mFile,"\"%s.td\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".td\"");
 	}
 	void getCurvature()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getReverseTangent()const
 	{
-		fprintf(mFile,"\"%s.rt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rt\"");
 	}
 	void getIgnoreEdges()const
 	{
-		fprintf(mFile,"\"%s.ie\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ie\"");
 	}
 protected:
 	ProjectTangent(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,555 +27,555 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setImage(const float3& im)
 	{
 		if(im == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".im\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".im\" -type \"float3\" ");
 		im.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageR(float imr)
 	{
 		if(imr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".im.imr\" %f;\n", imr);
+		writeFloat(mFile,"\tsetAttr \".im.imr\" ",imr,";\n");
 	}
 	void setImageG(float img)
 	{
 		if(img == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".im.img\" %f;\n", img);
+		writeFloat(mFile,"\tsetAttr \".im.img\" ",img,";\n");
 	}
 	void setImageB(float imb)
 	{
 		if(imb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".im.imb\" %f;\n", imb);
+		writeFloat(mFile,"\tsetAttr \".im.imb\" ",imb,";\n");
 	}
 	void setUAngle(double ua)
 	{
 		if(ua == 1) return;
-		fprintf(mFile,"\tsetAttr \".ua\" %f;\n", ua);
+		writeFloat(mFile,"\tsetAttr \".ua\" ",ua,";\n");
 	}
 	void setVAngle(double va)
 	{
 		if(va == 9) return;
-		fprintf(mFile,"\tsetAttr \".va\" %f;\n", va);
+		writeFloat(mFile,"\tsetAttr \".va\" ",va,";\n");
 	}
 	void setProjType(unsigned int t)
 	{
 		if(t == 1) return;
-		fprintf(mFile,"\tsetAttr \".t\" %i;\n", t);
+		writeInt(mFile,"\tsetAttr \".t\" ",t,";\n");
 	}
 	void setFitType(unsigned int ft)
 	{
 		if(ft == 1) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %i;\n", ft);
+		writeInt(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setFitFill(unsigned int ff)
 	{
 		if(ff == 0) return;
-		fprintf(mFile,"\tsetAttr \".ff\" %i;\n", ff);
+		writeInt(mFile,"\tsetAttr \".ff\" ",ff,";\n");
 	}
 	void setRipples(const float3& r)
 	{
 		if(r == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".r\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".r\" -type \"float3\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRipplesX(float rx)
 	{
 		if(rx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".r.rx\" ",rx,";\n");
 	}
 	void setRipplesY(float ry)
 	{
 		if(ry == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".r.ry\" ",ry,";\n");
 	}
 	void setRipplesZ(float rz)
 	{
 		if(rz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".r.rz\" ",rz,";\n");
 	}
 	void setDepth(const float2& d)
 	{
 		if(d == float2(0.0f,10.0f)) return;
-		fprintf(mFile,"\tsetAttr \".d\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"float2\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDepthMin(float dmn)
 	{
 		if(dmn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmn\" %f;\n", dmn);
+		writeFloat(mFile,"\tsetAttr \".d.dmn\" ",dmn,";\n");
 	}
 	void setDepthMax(float dmx)
 	{
 		if(dmx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmx\" %f;\n", dmx);
+		writeFloat(mFile,"\tsetAttr \".d.dmx\" ",dmx,";\n");
 	}
 	void setAmplitudeX(float ax)
 	{
 		if(ax == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ax\" %f;\n", ax);
+		writeFloat(mFile,"\tsetAttr \".ax\" ",ax,";\n");
 	}
 	void setAmplitudeY(float ay)
 	{
 		if(ay == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ay\" %f;\n", ay);
+		writeFloat(mFile,"\tsetAttr \".ay\" ",ay,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setVertexCameraOne(const float3& vc1)
 	{
-		fprintf(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
 		vc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraOneX(float c1x)
 	{
 		if(c1x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1x\" %f;\n", c1x);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1x\" ",c1x,";\n");
 	}
 	void setVertexCameraOneY(float c1y)
 	{
 		if(c1y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1y\" %f;\n", c1y);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1y\" ",c1y,";\n");
 	}
 	void setVertexCameraOneZ(float c1z)
 	{
 		if(c1z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1z\" %f;\n", c1z);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1z\" ",c1z,";\n");
 	}
 	void setVertexCameraTwo(const float3& vc2)
 	{
-		fprintf(mFile,"\tsetAttr \".vc2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc2\" -type \"float3\" ");
 		vc2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraTwoX(float c2x)
 	{
 		if(c2x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2x\" %f;\n", c2x);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2x\" ",c2x,";\n");
 	}
 	void setVertexCameraTwoY(float c2y)
 	{
 		if(c2y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2y\" %f;\n", c2y);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2y\" ",c2y,";\n");
 	}
 	void setVertexCameraTwoZ(float c2z)
 	{
 		if(c2z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc2.c2z\" %f;\n", c2z);
+		writeFloat(mFile,"\tsetAttr \".vc2.c2z\" ",c2z,";\n");
 	}
 	void setVertexCameraThree(const float3& vc3)
 	{
-		fprintf(mFile,"\tsetAttr \".vc3\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc3\" -type \"float3\" ");
 		vc3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraThreeX(float c3x)
 	{
 		if(c3x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc3.c3x\" %f;\n", c3x);
+		writeFloat(mFile,"\tsetAttr \".vc3.c3x\" ",c3x,";\n");
 	}
 	void setVertexCameraThreeY(float c3y)
 	{
 		if(c3y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc3.c3y\" %f;\n", c3y);
+		writeFloat(mFile,"\tsetAttr \".vc3.c3y\" ",c3y,";\n");
 	}
 	void setVertexCameraThreeZ(float c3z)
 	{
 		if(c3z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc3.c3z\" %f;\n", c3z);
+		writeFloat(mFile,"\tsetAttr \".vc3.c3z\" ",c3z,";\n");
 	}
 	void setVertexUvOne(const float2& vt1)
 	{
-		fprintf(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
 		vt1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvOneU(float t1u)
 	{
 		if(t1u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1u\" %f;\n", t1u);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1u\" ",t1u,";\n");
 	}
 	void setVertexUvOneV(float t1v)
 	{
 		if(t1v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1v\" %f;\n", t1v);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1v\" ",t1v,";\n");
 	}
 	void setVertexUvTwo(const float2& vt2)
 	{
-		fprintf(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
 		vt2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvTwoU(float t2u)
 	{
 		if(t2u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2u\" %f;\n", t2u);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2u\" ",t2u,";\n");
 	}
 	void setVertexUvTwoV(float t2v)
 	{
 		if(t2v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2v\" %f;\n", t2v);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2v\" ",t2v,";\n");
 	}
 	void setVertexUvThree(const float2& vt3)
 	{
-		fprintf(mFile,"\tsetAttr \".vt3\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt3\" -type \"float2\" ");
 		vt3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvThreeU(float t3u)
 	{
 		if(t3u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt3.t3u\" %f;\n", t3u);
+		writeFloat(mFile,"\tsetAttr \".vt3.t3u\" ",t3u,";\n");
 	}
 	void setVertexUvThreeV(float t3v)
 	{
 		if(t3v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt3.t3v\" %f;\n", t3v);
+		writeFloat(mFile,"\tsetAttr \".vt3.t3v\" ",t3v,";\n");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getSrfNormal()const
 	{
-		fprintf(mFile,"\"%s.srn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srn\"");
 	}
 	void getSrfNormalX()const
 	{
-		fprintf(mFile,"\"%s.srn.snx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srn.snx\"");
 	}
 	void getSrfNormalY()const
 	{
-		fprintf(mFile,"\"%s.srn.sny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srn.sny\"");
 	}
 	void getSrfNormalZ()const
 	{
-		fprintf(mFile,"\"%s.srn.snz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srn.snz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getImage()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getImageR()const
 	{
-		fprintf(mFile,"\"%s.im.imr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im.imr\"");
 	}
 	void getImageG()const
 	{
-		fprintf(mFile,"\"%s.im.img\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im.img\"");
 	}
 	void getImageB()const
 	{
-		fprintf(mFile,"\"%s.im.imb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im.imb\"");
 	}
 	void getUAngle()const
 	{
-		fprintf(mFile,"\"%s.ua\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ua\"");
 	}
 	void getVAngle()const
 	{
-		fprintf(mFile,"\"%s.va\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".va\"");
 	}
 	void getProjType()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getLinkedCamera()const
 	{
-		fprintf(mFile,"\"%s.lc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc\"");
 	}
 	void getFitType()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getFitFill()const
 	{
-		fprintf(mFile,"\"%s.ff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ff\"");
 	}
 	void getRipples()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRipplesX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRipplesY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRipplesZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDepthMin()const
 	{
-		fprintf(mFile,"\"%s.d.dmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmn\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.d.dmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmx\"");
 	}
 	void getAmplitudeX()const
 	{
-		fprintf(mFile,"\"%s.ax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax\"");
 	}
 	void getAmplitudeY()const
 	{
-		fprintf(mFile,"\"%s.ay\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ay\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 	void getDepWts()const
 	{
-		fprintf(mFile,"\"%s.dwt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dwt\"");
 	}
 	void getAngWts()const
 	{
-		fprintf(mFile,"\"%s.awt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".awt\"");
 	}
 	void getCamPos()const
 	{
-		fprintf(mFile,"\"%s.cpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpo\"");
 	}
 	void getCamPsX()const
 	{
-		fprintf(mFile,"\"%s.cpo.cpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpo.cpx\"");
 	}
 	void getCamPsY()const
 	{
-		fprintf(mFile,"\"%s.cpo.cpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpo.cpy\"");
 	}
 	void getCamPsZ()const
 	{
-		fprintf(mFile,"\"%s.cpo.cpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpo.cpz\"");
 	}
 	void getCamAg()const
 	{
-		fprintf(mFile,"\"%s.cag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cag\"");
 	}
 	void getCamAngX()const
 	{
-		fprintf(mFile,"\"%s.cag.cax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cag.cax\"");
 	}
 	void getCamAngY()const
 	{
-		fprintf(mFile,"\"%s.cag.cay\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cag.cay\"");
 	}
 	void getCamAngZ()const
 	{
-		fprintf(mFile,"\"%s.cag.caz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cag.caz\"");
 	}
 	void getPassTr()const
 	{
-		fprintf(mFile,"\"%s.pst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pst\"");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.u\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.v\"");
 	}
 	void getVertexCameraOne()const
 	{
-		fprintf(mFile,"\"%s.vc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1\"");
 	}
 	void getVertexCameraOneX()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1x\"");
 	}
 	void getVertexCameraOneY()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1y\"");
 	}
 	void getVertexCameraOneZ()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1z\"");
 	}
 	void getVertexCameraTwo()const
 	{
-		fprintf(mFile,"\"%s.vc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2\"");
 	}
 	void getVertexCameraTwoX()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2x\"");
 	}
 	void getVertexCameraTwoY()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2y\"");
 	}
 	void getVertexCameraTwoZ()const
 	{
-		fprintf(mFile,"\"%s.vc2.c2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc2.c2z\"");
 	}
 	void getVertexCameraThree()const
 	{
-		fprintf(mFile,"\"%s.vc3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc3\"");
 	}
 	void getVertexCameraThreeX()const
 	{
-		fprintf(mFile,"\"%s.vc3.c3x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc3.c3x\"");
 	}
 	void getVertexCameraThreeY()const
 	{
-		fprintf(mFile,"\"%s.vc3.c3y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc3.c3y\"");
 	}
 	void getVertexCameraThreeZ()const
 	{
-		fprintf(mFile,"\"%s.vc3.c3z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc3.c3z\"");
 	}
 	void getVertexUvOne()const
 	{
-		fprintf(mFile,"\"%s.vt1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1\"");
 	}
 	void getVertexUvOneU()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1u\"");
 	}
 	void getVertexUvOneV()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1v\"");
 	}
 	void getVertexUvTwo()const
 	{
-		fprintf(mFile,"\"%s.vt2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2\"");
 	}
 	void getVertexUvTwoU()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2u\"");
 	}
 	void getVertexUvTwoV()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2v\"");
 	}
 	void getVertexUvThree()const
 	{
-		fprintf(mFile,"\"%s.vt3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3\"");
 	}
 	void getVertexUvThreeU()const
 	{
-		fprintf(mFile,"\"%s.vt3.t3u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3.t3u\"");
 	}
 	void getVertexUvThreeV()const
 	{
-		fprintf(mFile,"\"%s.vt3.t3v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3.t3v\"");
 	}
 	void getUvFilterSize()const
 	{
-		fprintf(mFile,"\"%s.uf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uf\"");
 	}
 	void getUvFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.uf.ufx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uf.ufx\"");
 	}
 	void getUvFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.uf.ufy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uf.ufy\"");
 	}
 	void getTangentUCamera()const
 	{
-		fprintf(mFile,"\"%s.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu\"");
 	}
 	void getTangentUx()const
 	{
-		fprintf(mFile,"\"%s.tu.tux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tux\"");
 	}
 	void getTangentUy()const
 	{
-		fprintf(mFile,"\"%s.tu.tuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tuy\"");
 	}
 	void getTangentUz()const
 	{
-		fprintf(mFile,"\"%s.tu.tuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tuz\"");
 	}
 	void getTangentVCamera()const
 	{
-		fprintf(mFile,"\"%s.tv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv\"");
 	}
 	void getTangentVx()const
 	{
-		fprintf(mFile,"\"%s.tv.tvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvx\"");
 	}
 	void getTangentVy()const
 	{
-		fprintf(mFile,"\"%s.tv.tvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvy\"");
 	}
 	void getTangentVz()const
 	{
-		fprintf(mFile,"\"%s.tv.tvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvz\"");
 	}
 protected:
 	Projection(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -26,20 +26,20 @@ public:
 
 	void getProxyList(size_t plst_i)const
 	{
-		fprintf(mFile,"\"%s.plst[%i]\"",mName.c_str(),plst_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".plst[",plst_i,"]\"");
 	}
 	void getProxyList()const
 	{
 
-		fprintf(mFile,"\"%s.plst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".plst\"");
 	}
 	void getActiveProxy()const
 	{
-		fprintf(mFile,"\"%s.aprx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aprx\"");
 	}
 	void getSharedEditsOwner()const
 	{
-		fprintf(mFile,"\"%s.psed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".psed\"");
 	}
 protected:
 	ProxyManager(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
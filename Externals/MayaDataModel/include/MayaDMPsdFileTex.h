@@ -27,32 +27,32 @@ public:
 	void setLayerSetName(const string& lsn)
 	{
 		if(lsn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".lsn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".lsn\" -type \"string\" ");
 		lsn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAlpha(const string& alp)
 	{
 		if(alp == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".alp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".alp\" -type \"string\" ");
 		alp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getLayerSetName()const
 	{
-		fprintf(mFile,"\"%s.lsn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsn\"");
 	}
 	void getLayerSets()const
 	{
-		fprintf(mFile,"\"%s.lys\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lys\"");
 	}
 	void getAlpha()const
 	{
-		fprintf(mFile,"\"%s.alp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".alp\"");
 	}
 	void getAlphaList()const
 	{
-		fprintf(mFile,"\"%s.als\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".als\"");
 	}
 protected:
 	PsdFileTex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
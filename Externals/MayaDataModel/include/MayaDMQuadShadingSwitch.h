@@ -24,14 +24,14 @@ public:
 			void write(FILE* file) const
 			{
 				inTriple.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f", inSingle);
+				writeString(file," ");
+				writeFloat(file,"",inSingle);
 			}
 		} inQuad;
 		void write(FILE* file) const
 		{
 			inQuad.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 		}
 	};
 	struct Default{
@@ -40,8 +40,8 @@ public:
 		void write(FILE* file) const
 		{
 			defTriple.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", defSingle);
+			writeString(file," ");
+			writeFloat(file,"",defSingle);
 		}
 	};
 	struct Output{
@@ -58,219 +58,219 @@ public:
 
 	void setInput(size_t i_i,const Input& i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i]\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"]\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput(size_t i_start,size_t i_end,Input* i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\" ");
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			i_[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput(size_t i_start,size_t i_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\"",i_start,i_end);
-		fprintf(mFile," -type \"Input\" ");
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\"");
+		writeString(mFile," -type \"Input\" ");
 	}
 	void appendInput(const Input& i)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		i.write(mFile);
 	}
 	void endInput()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInQuad(size_t i_i,const Input::InQuad& iq)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i].iq\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"].iq\" ");
 		iq.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInTriple(size_t i_i,const float3& itr)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i].iq.itr\" -type \"float3\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"].iq.itr\" -type \"float3\" ");
 		itr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInComp1(size_t i_i,float ic1)
 	{
 		if(ic1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].iq.itr.ic1\" %f;\n", i_i,ic1);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].iq.itr.ic1\" ",ic1,";\n");
 	}
 	void setInComp2(size_t i_i,float ic2)
 	{
 		if(ic2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].iq.itr.ic2\" %f;\n", i_i,ic2);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].iq.itr.ic2\" ",ic2,";\n");
 	}
 	void setInComp3(size_t i_i,float ic3)
 	{
 		if(ic3 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].iq.itr.ic3\" %f;\n", i_i,ic3);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].iq.itr.ic3\" ",ic3,";\n");
 	}
 	void setInSingle(size_t i_i,float isi)
 	{
 		if(isi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].iq.isi\" %f;\n", i_i,isi);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].iq.isi\" ",isi,";\n");
 	}
 	void setDefault(const Default& def)
 	{
-		fprintf(mFile,"\tsetAttr \".def\" ");
+		writeString(mFile,"\tsetAttr \".def\" ");
 		def.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefTriple(const float3& dtr)
 	{
 		if(dtr == float3(0.8f,0.8f,0.8f)) return;
-		fprintf(mFile,"\tsetAttr \".def.dtr\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".def.dtr\" -type \"float3\" ");
 		dtr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefComp1(float dc1)
 	{
 		if(dc1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".def.dtr.dc1\" %f;\n", dc1);
+		writeFloat(mFile,"\tsetAttr \".def.dtr.dc1\" ",dc1,";\n");
 	}
 	void setDefComp2(float dc2)
 	{
 		if(dc2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".def.dtr.dc2\" %f;\n", dc2);
+		writeFloat(mFile,"\tsetAttr \".def.dtr.dc2\" ",dc2,";\n");
 	}
 	void setDefComp3(float dc3)
 	{
 		if(dc3 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".def.dtr.dc3\" %f;\n", dc3);
+		writeFloat(mFile,"\tsetAttr \".def.dtr.dc3\" ",dc3,";\n");
 	}
 	void setDefSingle(float dsi)
 	{
 		if(dsi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".def.dsi\" %f;\n", dsi);
+		writeFloat(mFile,"\tsetAttr \".def.dsi\" ",dsi,";\n");
 	}
 	void getInput(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getInput()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInQuad(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].iq\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].iq\"");
 	}
 	void getInQuad()const
 	{
 
-		fprintf(mFile,"\"%s.i.iq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.iq\"");
 	}
 	void getInTriple(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].iq.itr\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].iq.itr\"");
 	}
 	void getInTriple()const
 	{
 
-		fprintf(mFile,"\"%s.i.iq.itr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.iq.itr\"");
 	}
 	void getInComp1(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].iq.itr.ic1\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].iq.itr.ic1\"");
 	}
 	void getInComp1()const
 	{
 
-		fprintf(mFile,"\"%s.i.iq.itr.ic1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.iq.itr.ic1\"");
 	}
 	void getInComp2(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].iq.itr.ic2\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].iq.itr.ic2\"");
 	}
 	void getInComp2()const
 	{
 
-		fprintf(mFile,"\"%s.i.iq.itr.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.iq.itr.ic2\"");
 	}
 	void getInComp3(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].iq.itr.ic3\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].iq.itr.ic3\"");
 	}
 	void getInComp3()const
 	{
 
-		fprintf(mFile,"\"%s.i.iq.itr.ic3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.iq.itr.ic3\"");
 	}
 	void getInSingle(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].iq.isi\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].iq.isi\"");
 	}
 	void getInSingle()const
 	{
 
-		fprintf(mFile,"\"%s.i.iq.isi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.iq.isi\"");
 	}
 	void getInShape(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].is\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].is\"");
 	}
 	void getInShape()const
 	{
 
-		fprintf(mFile,"\"%s.i.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.is\"");
 	}
 	void getDefault()const
 	{
-		fprintf(mFile,"\"%s.def\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def\"");
 	}
 	void getDefTriple()const
 	{
-		fprintf(mFile,"\"%s.def.dtr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def.dtr\"");
 	}
 	void getDefComp1()const
 	{
-		fprintf(mFile,"\"%s.def.dtr.dc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def.dtr.dc1\"");
 	}
 	void getDefComp2()const
 	{
-		fprintf(mFile,"\"%s.def.dtr.dc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def.dtr.dc2\"");
 	}
 	void getDefComp3()const
 	{
-		fprintf(mFile,"\"%s.def.dtr.dc3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def.dtr.dc3\"");
 	}
 	void getDefSingle()const
 	{
-		fprintf(mFile,"\"%s.def.dsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def.dsi\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 	void getOutTriple()const
 	{
-		fprintf(mFile,"\"%s.out.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out.otr\"");
 	}
 	void getOutComp1()const
 	{
-		fprintf(mFile,"\"%s.out.otr.oc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out.otr.oc1\"");
 	}
 	void getOutComp2()const
 	{
-		fprintf(mFile,"\"%s.out.otr.oc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out.otr.oc2\"");
 	}
 	void getOutComp3()const
 	{
-		fprintf(mFile,"\"%s.out.otr.oc3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out.otr.oc3\"");
 	}
 	void getOutSingle()const
 	{
-		fprintf(mFile,"\"%s.out.osi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out.osi\"");
 	}
 protected:
 	QuadShadingSwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
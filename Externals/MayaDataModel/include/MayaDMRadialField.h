@@ -27,11 +27,11 @@ public:
 	void setRadialType(double typ)
 	{
 		if(typ == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".typ\" %f;\n", typ);
+		writeFloat(mFile,"\tsetAttr \".typ\" ",typ,";\n");
 	}
 	void getRadialType()const
 	{
-		fprintf(mFile,"\"%s.typ\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".typ\"");
 	}
 protected:
 	RadialField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
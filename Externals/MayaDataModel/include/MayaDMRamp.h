@@ -22,7 +22,7 @@ public:
 		float3 color;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", position);
+			writeFloat(file,"",position," ");
 			color.write(file);
 		}
 	};
@@ -36,222 +36,222 @@ public:
 	void setType(unsigned int t)
 	{
 		if(t == 0) return;
-		fprintf(mFile,"\tsetAttr \".t\" %i;\n", t);
+		writeInt(mFile,"\tsetAttr \".t\" ",t,";\n");
 	}
 	void setInterpolation(unsigned int in)
 	{
 		if(in == 1) return;
-		fprintf(mFile,"\tsetAttr \".in\" %i;\n", in);
+		writeInt(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setColorEntryList(size_t cel_i,const ColorEntryList& cel)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i]\" ",cel_i);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i,"]\" ");
 		cel.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorEntryList(size_t cel_start,size_t cel_end,ColorEntryList* cel)
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i:%i]\" ", cel_start,cel_end);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_start); writeInt(mFile,":",cel_end,"]\" ");
 		size_t size = (cel_end-cel_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cel[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColorEntryList(size_t cel_start,size_t cel_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cel[%i:%i]\"",cel_start,cel_end);
-		fprintf(mFile," -type \"ColorEntryList\" ");
+		writeInt(mFile,"\tsetAttr \".cel[",cel_start); writeInt(mFile,":",cel_end,"]\"");
+		writeString(mFile," -type \"ColorEntryList\" ");
 	}
 	void appendColorEntryList(const ColorEntryList& cel)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cel.write(mFile);
 	}
 	void endColorEntryList()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPosition(size_t cel_i,float ep)
 	{
 		if(ep == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].ep\" %f;\n", cel_i,ep);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeFloat(mFile,"].ep\" ",ep,";\n");
 	}
 	void setColor(size_t cel_i,const float3& ec)
 	{
 		if(ec == float3(1.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].ec\" -type \"float3\" ",cel_i);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i,"].ec\" -type \"float3\" ");
 		ec.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(size_t cel_i,float ecr)
 	{
 		if(ecr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].ec.ecr\" %f;\n", cel_i,ecr);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeFloat(mFile,"].ec.ecr\" ",ecr,";\n");
 	}
 	void setColorG(size_t cel_i,float ecg)
 	{
 		if(ecg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].ec.ecg\" %f;\n", cel_i,ecg);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeFloat(mFile,"].ec.ecg\" ",ecg,";\n");
 	}
 	void setColorB(size_t cel_i,float ecb)
 	{
 		if(ecb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cel[%i].ec.ecb\" %f;\n", cel_i,ecb);
+		writeInt(mFile,"\tsetAttr \".cel[",cel_i); writeFloat(mFile,"].ec.ecb\" ",ecb,";\n");
 	}
 	void setUWave(float uw)
 	{
 		if(uw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uw\" %f;\n", uw);
+		writeFloat(mFile,"\tsetAttr \".uw\" ",uw,";\n");
 	}
 	void setVWave(float vw)
 	{
 		if(vw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vw\" %f;\n", vw);
+		writeFloat(mFile,"\tsetAttr \".vw\" ",vw,";\n");
 	}
 	void setNoise(float n)
 	{
 		if(n == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n\" %f;\n", n);
+		writeFloat(mFile,"\tsetAttr \".n\" ",n,";\n");
 	}
 	void setNoiseFreq(float nf)
 	{
 		if(nf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".nf\" %f;\n", nf);
+		writeFloat(mFile,"\tsetAttr \".nf\" ",nf,";\n");
 	}
 	void setHueNoise(float hn)
 	{
 		if(hn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hn\" %f;\n", hn);
+		writeFloat(mFile,"\tsetAttr \".hn\" ",hn,";\n");
 	}
 	void setSatNoise(float sn)
 	{
 		if(sn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sn\" %f;\n", sn);
+		writeFloat(mFile,"\tsetAttr \".sn\" ",sn,";\n");
 	}
 	void setValNoise(float vn)
 	{
 		if(vn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vn\" %f;\n", vn);
+		writeFloat(mFile,"\tsetAttr \".vn\" ",vn,";\n");
 	}
 	void setHueNoiseFreq(float hnf)
 	{
 		if(hnf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hnf\" %f;\n", hnf);
+		writeFloat(mFile,"\tsetAttr \".hnf\" ",hnf,";\n");
 	}
 	void setSatNoiseFreq(float snf)
 	{
 		if(snf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".snf\" %f;\n", snf);
+		writeFloat(mFile,"\tsetAttr \".snf\" ",snf,";\n");
 	}
 	void setValNoiseFreq(float vnf)
 	{
 		if(vnf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".vnf\" %f;\n", vnf);
+		writeFloat(mFile,"\tsetAttr \".vnf\" ",vnf,";\n");
 	}
 	void getType()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getInterpolation()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getColorEntryList(size_t cel_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i]\"",mName.c_str(),cel_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i,"]\"");
 	}
 	void getColorEntryList()const
 	{
 
-		fprintf(mFile,"\"%s.cel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cel\"");
 	}
 	void getPosition(size_t cel_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].ep\"",mName.c_str(),cel_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i,"].ep\"");
 	}
 	void getPosition()const
 	{
 
-		fprintf(mFile,"\"%s.cel.ep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cel.ep\"");
 	}
 	void getColor(size_t cel_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].ec\"",mName.c_str(),cel_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i,"].ec\"");
 	}
 	void getColor()const
 	{
 
-		fprintf(mFile,"\"%s.cel.ec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cel.ec\"");
 	}
 	void getColorR(size_t cel_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].ec.ecr\"",mName.c_str(),cel_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i,"].ec.ecr\"");
 	}
 	void getColorR()const
 	{
 
-		fprintf(mFile,"\"%s.cel.ec.ecr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cel.ec.ecr\"");
 	}
 	void getColorG(size_t cel_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].ec.ecg\"",mName.c_str(),cel_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i,"].ec.ecg\"");
 	}
 	void getColorG()const
 	{
 
-		fprintf(mFile,"\"%s.cel.ec.ecg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cel.ec.ecg\"");
 	}
 	void getColorB(size_t cel_i)const
 	{
-		fprintf(mFile,"\"%s.cel[%i].ec.ecb\"",mName.c_str(),cel_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cel[",cel_i,"].ec.ecb\"");
 	}
 	void getColorB()const
 	{
 
-		fprintf(mFile,"\"%s.cel.ec.ecb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cel.ec.ecb\"");
 	}
 	void getUWave()const
 	{
-		fprintf(mFile,"\"%s.uw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uw\"");
 	}
 	void getVWave()const
 	{
-		fprintf(mFile,"\"%s.vw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vw\"");
 	}
 	void getNoise()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.nf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nf\"");
 	}
 	void getHueNoise()const
 	{
-		fprintf(mFile,"\"%s.hn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hn\"");
 	}
 	void getSatNoise()const
 	{
-		fprintf(mFile,"\"%s.sn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sn\"");
 	}
 	void getValNoise()const
 	{
-		fprintf(mFile,"\"%s.vn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vn\"");
 	}
 	void getHueNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.hnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hnf\"");
 	}
 	void getSatNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.snf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".snf\"");
 	}
 	void getValNoiseFreq()const
 	{
-		fprintf(mFile,"\"%s.vnf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vnf\"");
 	}
 protected:
 	Ramp(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,10 +23,10 @@ public:
 		unsigned int color_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", color_Position);
+			writeFloat(file,"",color_Position," ");
 			color_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", color_Interp);
+			writeString(file," ");
+			writeInt(file,"",color_Interp);
 		}
 	};
 	struct Transparency{
@@ -35,10 +35,10 @@ public:
 		unsigned int transparency_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", transparency_Position);
+			writeFloat(file,"",transparency_Position," ");
 			transparency_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", transparency_Interp);
+			writeString(file," ");
+			writeInt(file,"",transparency_Interp);
 		}
 	};
 	struct Incandescence{
@@ -47,10 +47,10 @@ public:
 		unsigned int incandescence_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", incandescence_Position);
+			writeFloat(file,"",incandescence_Position," ");
 			incandescence_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", incandescence_Interp);
+			writeString(file," ");
+			writeInt(file,"",incandescence_Interp);
 		}
 	};
 	struct SpecularRollOff{
@@ -59,9 +59,9 @@ public:
 		unsigned int specularRollOff_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", specularRollOff_Position);
-			fprintf(file,"%f ", specularRollOff_FloatValue);
-			fprintf(file,"%i", specularRollOff_Interp);
+			writeFloat(file,"",specularRollOff_Position," ");
+			writeFloat(file,"",specularRollOff_FloatValue," ");
+			writeInt(file,"",specularRollOff_Interp);
 		}
 	};
 	struct SpecularColor{
@@ -70,10 +70,10 @@ public:
 		unsigned int specularColor_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", specularColor_Position);
+			writeFloat(file,"",specularColor_Position," ");
 			specularColor_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", specularColor_Interp);
+			writeString(file," ");
+			writeInt(file,"",specularColor_Interp);
 		}
 	};
 	struct Reflectivity{
@@ -82,9 +82,9 @@ public:
 		unsigned int reflectivity_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", reflectivity_Position);
-			fprintf(file,"%f ", reflectivity_FloatValue);
-			fprintf(file,"%i", reflectivity_Interp);
+			writeFloat(file,"",reflectivity_Position," ");
+			writeFloat(file,"",reflectivity_FloatValue," ");
+			writeInt(file,"",reflectivity_Interp);
 		}
 	};
 	struct Environment{
@@ -93,10 +93,10 @@ public:
 		unsigned int environment_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", environment_Position);
+			writeFloat(file,"",environment_Position," ");
 			environment_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", environment_Interp);
+			writeString(file," ");
+			writeInt(file,"",environment_Interp);
 		}
 	};
 public:
@@ -109,1766 +109,1766 @@ public:
 	void setRefractionLimit(short rdl)
 	{
 		if(rdl == 6) return;
-		fprintf(mFile,"\tsetAttr \".rdl\" %i;\n", rdl);
+		writeInt(mFile,"\tsetAttr \".rdl\" ",rdl,";\n");
 	}
 	void setRefractiveIndex(float rfi)
 	{
 		if(rfi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rfi\" %f;\n", rfi);
+		writeFloat(mFile,"\tsetAttr \".rfi\" ",rfi,";\n");
 	}
 	void setRefractions(bool rfc)
 	{
 		if(rfc == false) return;
-		fprintf(mFile,"\tsetAttr \".rfc\" %i;\n", rfc);
+		writeInt(mFile,"\tsetAttr \".rfc\" ",rfc,";\n");
 	}
 	void setDiffuse(float dc)
 	{
 		if(dc == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %f;\n", dc);
+		writeFloat(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void setForwardScatter(float fsc)
 	{
 		if(fsc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fsc\" %f;\n", fsc);
+		writeFloat(mFile,"\tsetAttr \".fsc\" ",fsc,";\n");
 	}
 	void setColor(size_t clr_i,const Color& clr)
 	{
-		fprintf(mFile,"\tsetAttr \".clr[%i]\" ",clr_i);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i,"]\" ");
 		clr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor(size_t clr_start,size_t clr_end,Color* clr)
 	{
-		fprintf(mFile,"\tsetAttr \".clr[%i:%i]\" ", clr_start,clr_end);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_start); writeInt(mFile,":",clr_end,"]\" ");
 		size_t size = (clr_end-clr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			clr[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColor(size_t clr_start,size_t clr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".clr[%i:%i]\"",clr_start,clr_end);
-		fprintf(mFile," -type \"Color\" ");
+		writeInt(mFile,"\tsetAttr \".clr[",clr_start); writeInt(mFile,":",clr_end,"]\"");
+		writeString(mFile," -type \"Color\" ");
 	}
 	void appendColor(const Color& clr)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		clr.write(mFile);
 	}
 	void endColor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor_Position(size_t clr_i,float clrp)
 	{
 		if(clrp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clrp\" %f;\n", clr_i,clrp);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeFloat(mFile,"].clrp\" ",clrp,";\n");
 	}
 	void setColor_Color(size_t clr_i,const float3& clrc)
 	{
-		fprintf(mFile,"\tsetAttr \".clr[%i].clrc\" -type \"float3\" ",clr_i);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i,"].clrc\" -type \"float3\" ");
 		clrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor_ColorR(size_t clr_i,float clrcr)
 	{
 		if(clrcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clrc.clrcr\" %f;\n", clr_i,clrcr);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeFloat(mFile,"].clrc.clrcr\" ",clrcr,";\n");
 	}
 	void setColor_ColorG(size_t clr_i,float clrcg)
 	{
 		if(clrcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clrc.clrcg\" %f;\n", clr_i,clrcg);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeFloat(mFile,"].clrc.clrcg\" ",clrcg,";\n");
 	}
 	void setColor_ColorB(size_t clr_i,float clrcb)
 	{
 		if(clrcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clrc.clrcb\" %f;\n", clr_i,clrcb);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeFloat(mFile,"].clrc.clrcb\" ",clrcb,";\n");
 	}
 	void setColor_Interp(size_t clr_i,unsigned int clri)
 	{
 		if(clri == 0) return;
-		fprintf(mFile,"\tsetAttr \".clr[%i].clri\" %i;\n", clr_i,clri);
+		writeInt(mFile,"\tsetAttr \".clr[",clr_i); writeInt(mFile,"].clri\" ",clri,";\n");
 	}
 	void setColorInput(unsigned int cin)
 	{
 		if(cin == 0) return;
-		fprintf(mFile,"\tsetAttr \".cin\" %i;\n", cin);
+		writeInt(mFile,"\tsetAttr \".cin\" ",cin,";\n");
 	}
 	void setShadowMode(unsigned int smd)
 	{
 		if(smd == 0) return;
-		fprintf(mFile,"\tsetAttr \".smd\" %i;\n", smd);
+		writeInt(mFile,"\tsetAttr \".smd\" ",smd,";\n");
 	}
 	void setShadowColor(const float3& shc)
 	{
-		fprintf(mFile,"\tsetAttr \".shc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".shc\" -type \"float3\" ");
 		shc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShadowColorR(float shr)
 	{
 		if(shr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".shc.shr\" %f;\n", shr);
+		writeFloat(mFile,"\tsetAttr \".shc.shr\" ",shr,";\n");
 	}
 	void setShadowColorG(float shg)
 	{
 		if(shg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".shc.shg\" %f;\n", shg);
+		writeFloat(mFile,"\tsetAttr \".shc.shg\" ",shg,";\n");
 	}
 	void setShadowColorB(float shb)
 	{
 		if(shb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".shc.shb\" %f;\n", shb);
+		writeFloat(mFile,"\tsetAttr \".shc.shb\" ",shb,";\n");
 	}
 	void setShadowThreshold(float sht)
 	{
 		if(sht == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sht\" %f;\n", sht);
+		writeFloat(mFile,"\tsetAttr \".sht\" ",sht,";\n");
 	}
 	void setTransparency(size_t it_i,const Transparency& it)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i]\" ",it_i);
+		writeInt(mFile,"\tsetAttr \".it[",it_i,"]\" ");
 		it.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparency(size_t it_start,size_t it_end,Transparency* it)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i:%i]\" ", it_start,it_end);
+		writeInt(mFile,"\tsetAttr \".it[",it_start); writeInt(mFile,":",it_end,"]\" ");
 		size_t size = (it_end-it_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			it[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTransparency(size_t it_start,size_t it_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i:%i]\"",it_start,it_end);
-		fprintf(mFile," -type \"Transparency\" ");
+		writeInt(mFile,"\tsetAttr \".it[",it_start); writeInt(mFile,":",it_end,"]\"");
+		writeString(mFile," -type \"Transparency\" ");
 	}
 	void appendTransparency(const Transparency& it)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		it.write(mFile);
 	}
 	void endTransparency()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparency_Position(size_t it_i,float itp)
 	{
 		if(itp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it[%i].itp\" %f;\n", it_i,itp);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeFloat(mFile,"].itp\" ",itp,";\n");
 	}
 	void setTransparency_Color(size_t it_i,const float3& itc)
 	{
-		fprintf(mFile,"\tsetAttr \".it[%i].itc\" -type \"float3\" ",it_i);
+		writeInt(mFile,"\tsetAttr \".it[",it_i,"].itc\" -type \"float3\" ");
 		itc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparency_ColorR(size_t it_i,float itcr)
 	{
 		if(itcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it[%i].itc.itcr\" %f;\n", it_i,itcr);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeFloat(mFile,"].itc.itcr\" ",itcr,";\n");
 	}
 	void setTransparency_ColorG(size_t it_i,float itcg)
 	{
 		if(itcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it[%i].itc.itcg\" %f;\n", it_i,itcg);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeFloat(mFile,"].itc.itcg\" ",itcg,";\n");
 	}
 	void setTransparency_ColorB(size_t it_i,float itcb)
 	{
 		if(itcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it[%i].itc.itcb\" %f;\n", it_i,itcb);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeFloat(mFile,"].itc.itcb\" ",itcb,";\n");
 	}
 	void setTransparency_Interp(size_t it_i,unsigned int iti)
 	{
 		if(iti == 0) return;
-		fprintf(mFile,"\tsetAttr \".it[%i].iti\" %i;\n", it_i,iti);
+		writeInt(mFile,"\tsetAttr \".it[",it_i); writeInt(mFile,"].iti\" ",iti,";\n");
 	}
 	void setAmbientColor(const float3& ambc)
 	{
-		fprintf(mFile,"\tsetAttr \".ambc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ambc\" -type \"float3\" ");
 		ambc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAmbientColorR(float acr)
 	{
 		if(acr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acr\" %f;\n", acr);
+		writeFloat(mFile,"\tsetAttr \".ambc.acr\" ",acr,";\n");
 	}
 	void setAmbientColorG(float acg)
 	{
 		if(acg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acg\" %f;\n", acg);
+		writeFloat(mFile,"\tsetAttr \".ambc.acg\" ",acg,";\n");
 	}
 	void setAmbientColorB(float acb)
 	{
 		if(acb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ambc.acb\" %f;\n", acb);
+		writeFloat(mFile,"\tsetAttr \".ambc.acb\" ",acb,";\n");
 	}
 	void setIncandescence(size_t ic_i,const Incandescence& ic)
 	{
-		fprintf(mFile,"\tsetAttr \".ic[%i]\" ",ic_i);
+		writeInt(mFile,"\tsetAttr \".ic[",ic_i,"]\" ");
 		ic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescence(size_t ic_start,size_t ic_end,Incandescence* ic)
 	{
-		fprintf(mFile,"\tsetAttr \".ic[%i:%i]\" ", ic_start,ic_end);
+		writeInt(mFile,"\tsetAttr \".ic[",ic_start); writeInt(mFile,":",ic_end,"]\" ");
 		size_t size = (ic_end-ic_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ic[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startIncandescence(size_t ic_start,size_t ic_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ic[%i:%i]\"",ic_start,ic_end);
-		fprintf(mFile," -type \"Incandescence\" ");
+		writeInt(mFile,"\tsetAttr \".ic[",ic_start); writeInt(mFile,":",ic_end,"]\"");
+		writeString(mFile," -type \"Incandescence\" ");
 	}
 	void appendIncandescence(const Incandescence& ic)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ic.write(mFile);
 	}
 	void endIncandescence()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescence_Position(size_t ic_i,float icp)
 	{
 		if(icp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic[%i].icp\" %f;\n", ic_i,icp);
+		writeInt(mFile,"\tsetAttr \".ic[",ic_i); writeFloat(mFile,"].icp\" ",icp,";\n");
 	}
 	void setIncandescence_Color(size_t ic_i,const float3& icc)
 	{
-		fprintf(mFile,"\tsetAttr \".ic[%i].icc\" -type \"float3\" ",ic_i);
+		writeInt(mFile,"\tsetAttr \".ic[",ic_i,"].icc\" -type \"float3\" ");
 		icc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescence_ColorR(size_t ic_i,float iccr)
 	{
 		if(iccr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic[%i].icc.iccr\" %f;\n", ic_i,iccr);
+		writeInt(mFile,"\tsetAttr \".ic[",ic_i); writeFloat(mFile,"].icc.iccr\" ",iccr,";\n");
 	}
 	void setIncandescence_ColorG(size_t ic_i,float iccg)
 	{
 		if(iccg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic[%i].icc.iccg\" %f;\n", ic_i,iccg);
+		writeInt(mFile,"\tsetAttr \".ic[",ic_i); writeFloat(mFile,"].icc.iccg\" ",iccg,";\n");
 	}
 	void setIncandescence_ColorB(size_t ic_i,float iccb)
 	{
 		if(iccb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic[%i].icc.iccb\" %f;\n", ic_i,iccb);
+		writeInt(mFile,"\tsetAttr \".ic[",ic_i); writeFloat(mFile,"].icc.iccb\" ",iccb,";\n");
 	}
 	void setIncandescence_Interp(size_t ic_i,unsigned int ici)
 	{
 		if(ici == 0) return;
-		fprintf(mFile,"\tsetAttr \".ic[%i].ici\" %i;\n", ic_i,ici);
+		writeInt(mFile,"\tsetAttr \".ic[",ic_i); writeInt(mFile,"].ici\" ",ici,";\n");
 	}
 	void setTranslucence(float tc)
 	{
 		if(tc == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tc\" %f;\n", tc);
+		writeFloat(mFile,"\tsetAttr \".tc\" ",tc,";\n");
 	}
 	void setTranslucenceFocus(float tcf)
 	{
 		if(tcf == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tcf\" %f;\n", tcf);
+		writeFloat(mFile,"\tsetAttr \".tcf\" ",tcf,";\n");
 	}
 	void setTranslucenceDepth(float trsd)
 	{
 		if(trsd == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".trsd\" %f;\n", trsd);
+		writeFloat(mFile,"\tsetAttr \".trsd\" ",trsd,";\n");
 	}
 	void setOpacityDepth(float opad)
 	{
 		if(opad == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".opad\" %f;\n", opad);
+		writeFloat(mFile,"\tsetAttr \".opad\" ",opad,";\n");
 	}
 	void setGlowIntensity(float gi)
 	{
 		if(gi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %f;\n", gi);
+		writeFloat(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void setSpecularGlow(float spg)
 	{
 		if(spg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".spg\" %f;\n", spg);
+		writeFloat(mFile,"\tsetAttr \".spg\" ",spg,";\n");
 	}
 	void setHideSource(bool hs)
 	{
 		if(hs == false) return;
-		fprintf(mFile,"\tsetAttr \".hs\" %i;\n", hs);
+		writeInt(mFile,"\tsetAttr \".hs\" ",hs,";\n");
 	}
 	void setSurfaceThickness(float thik)
 	{
 		if(thik == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".thik\" %f;\n", thik);
+		writeFloat(mFile,"\tsetAttr \".thik\" ",thik,";\n");
 	}
 	void setShadowAttenuation(float fakc)
 	{
 		if(fakc == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".fakc\" %f;\n", fakc);
+		writeFloat(mFile,"\tsetAttr \".fakc\" ",fakc,";\n");
 	}
 	void setTransparencyDepth(float trdp)
 	{
 		if(trdp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".trdp\" %f;\n", trdp);
+		writeFloat(mFile,"\tsetAttr \".trdp\" ",trdp,";\n");
 	}
 	void setLightAbsorbance(float absb)
 	{
 		if(absb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".absb\" %f;\n", absb);
+		writeFloat(mFile,"\tsetAttr \".absb\" ",absb,";\n");
 	}
 	void setChromaticAberration(bool crab)
 	{
 		if(crab == false) return;
-		fprintf(mFile,"\tsetAttr \".crab\" %i;\n", crab);
+		writeInt(mFile,"\tsetAttr \".crab\" ",crab,";\n");
 	}
 	void setEccentricity(float ec)
 	{
 		if(ec == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".ec\" %f;\n", ec);
+		writeFloat(mFile,"\tsetAttr \".ec\" ",ec,";\n");
 	}
 	void setSpecularity(float spl)
 	{
 		if(spl == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".spl\" %f;\n", spl);
+		writeFloat(mFile,"\tsetAttr \".spl\" ",spl,";\n");
 	}
 	void setSpecularRollOff(size_t sro_i,const SpecularRollOff& sro)
 	{
-		fprintf(mFile,"\tsetAttr \".sro[%i]\" ",sro_i);
+		writeInt(mFile,"\tsetAttr \".sro[",sro_i,"]\" ");
 		sro.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularRollOff(size_t sro_start,size_t sro_end,SpecularRollOff* sro)
 	{
-		fprintf(mFile,"\tsetAttr \".sro[%i:%i]\" ", sro_start,sro_end);
+		writeInt(mFile,"\tsetAttr \".sro[",sro_start); writeInt(mFile,":",sro_end,"]\" ");
 		size_t size = (sro_end-sro_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			sro[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSpecularRollOff(size_t sro_start,size_t sro_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sro[%i:%i]\"",sro_start,sro_end);
-		fprintf(mFile," -type \"SpecularRollOff\" ");
+		writeInt(mFile,"\tsetAttr \".sro[",sro_start); writeInt(mFile,":",sro_end,"]\"");
+		writeString(mFile," -type \"SpecularRollOff\" ");
 	}
 	void appendSpecularRollOff(const SpecularRollOff& sro)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		sro.write(mFile);
 	}
 	void endSpecularRollOff()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularRollOff_Position(size_t sro_i,float srop)
 	{
 		if(srop == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sro[%i].srop\" %f;\n", sro_i,srop);
+		writeInt(mFile,"\tsetAttr \".sro[",sro_i); writeFloat(mFile,"].srop\" ",srop,";\n");
 	}
 	void setSpecularRollOff_FloatValue(size_t sro_i,float srofv)
 	{
 		if(srofv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sro[%i].srofv\" %f;\n", sro_i,srofv);
+		writeInt(mFile,"\tsetAttr \".sro[",sro_i); writeFloat(mFile,"].srofv\" ",srofv,";\n");
 	}
 	void setSpecularRollOff_Interp(size_t sro_i,unsigned int sroi)
 	{
 		if(sroi == 0) return;
-		fprintf(mFile,"\tsetAttr \".sro[%i].sroi\" %i;\n", sro_i,sroi);
+		writeInt(mFile,"\tsetAttr \".sro[",sro_i); writeInt(mFile,"].sroi\" ",sroi,";\n");
 	}
 	void setReflectionLimit(short fll)
 	{
 		if(fll == 1) return;
-		fprintf(mFile,"\tsetAttr \".fll\" %i;\n", fll);
+		writeInt(mFile,"\tsetAttr \".fll\" ",fll,";\n");
 	}
 	void setSpecularColor(size_t sc_i,const SpecularColor& sc)
 	{
-		fprintf(mFile,"\tsetAttr \".sc[%i]\" ",sc_i);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_i,"]\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColor(size_t sc_start,size_t sc_end,SpecularColor* sc)
 	{
-		fprintf(mFile,"\tsetAttr \".sc[%i:%i]\" ", sc_start,sc_end);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_start); writeInt(mFile,":",sc_end,"]\" ");
 		size_t size = (sc_end-sc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			sc[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSpecularColor(size_t sc_start,size_t sc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sc[%i:%i]\"",sc_start,sc_end);
-		fprintf(mFile," -type \"SpecularColor\" ");
+		writeInt(mFile,"\tsetAttr \".sc[",sc_start); writeInt(mFile,":",sc_end,"]\"");
+		writeString(mFile," -type \"SpecularColor\" ");
 	}
 	void appendSpecularColor(const SpecularColor& sc)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		sc.write(mFile);
 	}
 	void endSpecularColor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColor_Position(size_t sc_i,float scp)
 	{
 		if(scp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc[%i].scp\" %f;\n", sc_i,scp);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_i); writeFloat(mFile,"].scp\" ",scp,";\n");
 	}
 	void setSpecularColor_Color(size_t sc_i,const float3& scc)
 	{
-		fprintf(mFile,"\tsetAttr \".sc[%i].scc\" -type \"float3\" ",sc_i);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_i,"].scc\" -type \"float3\" ");
 		scc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColor_ColorR(size_t sc_i,float sccr)
 	{
 		if(sccr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc[%i].scc.sccr\" %f;\n", sc_i,sccr);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_i); writeFloat(mFile,"].scc.sccr\" ",sccr,";\n");
 	}
 	void setSpecularColor_ColorG(size_t sc_i,float sccg)
 	{
 		if(sccg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc[%i].scc.sccg\" %f;\n", sc_i,sccg);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_i); writeFloat(mFile,"].scc.sccg\" ",sccg,";\n");
 	}
 	void setSpecularColor_ColorB(size_t sc_i,float sccb)
 	{
 		if(sccb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc[%i].scc.sccb\" %f;\n", sc_i,sccb);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_i); writeFloat(mFile,"].scc.sccb\" ",sccb,";\n");
 	}
 	void setSpecularColor_Interp(size_t sc_i,unsigned int sci)
 	{
 		if(sci == 0) return;
-		fprintf(mFile,"\tsetAttr \".sc[%i].sci\" %i;\n", sc_i,sci);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_i); writeInt(mFile,"].sci\" ",sci,";\n");
 	}
 	void setReflectivity(size_t rfl_i,const Reflectivity& rfl)
 	{
-		fprintf(mFile,"\tsetAttr \".rfl[%i]\" ",rfl_i);
+		writeInt(mFile,"\tsetAttr \".rfl[",rfl_i,"]\" ");
 		rfl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReflectivity(size_t rfl_start,size_t rfl_end,Reflectivity* rfl)
 	{
-		fprintf(mFile,"\tsetAttr \".rfl[%i:%i]\" ", rfl_start,rfl_end);
+		writeInt(mFile,"\tsetAttr \".rfl[",rfl_start); writeInt(mFile,":",rfl_end,"]\" ");
 		size_t size = (rfl_end-rfl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			rfl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startReflectivity(size_t rfl_start,size_t rfl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".rfl[%i:%i]\"",rfl_start,rfl_end);
-		fprintf(mFile," -type \"Reflectivity\" ");
+		writeInt(mFile,"\tsetAttr \".rfl[",rfl_start); writeInt(mFile,":",rfl_end,"]\"");
+		writeString(mFile," -type \"Reflectivity\" ");
 	}
 	void appendReflectivity(const Reflectivity& rfl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		rfl.write(mFile);
 	}
 	void endReflectivity()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReflectivity_Position(size_t rfl_i,float rflp)
 	{
 		if(rflp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rfl[%i].rflp\" %f;\n", rfl_i,rflp);
+		writeInt(mFile,"\tsetAttr \".rfl[",rfl_i); writeFloat(mFile,"].rflp\" ",rflp,";\n");
 	}
 	void setReflectivity_FloatValue(size_t rfl_i,float rflfv)
 	{
 		if(rflfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rfl[%i].rflfv\" %f;\n", rfl_i,rflfv);
+		writeInt(mFile,"\tsetAttr \".rfl[",rfl_i); writeFloat(mFile,"].rflfv\" ",rflfv,";\n");
 	}
 	void setReflectivity_Interp(size_t rfl_i,unsigned int rfli)
 	{
 		if(rfli == 0) return;
-		fprintf(mFile,"\tsetAttr \".rfl[%i].rfli\" %i;\n", rfl_i,rfli);
+		writeInt(mFile,"\tsetAttr \".rfl[",rfl_i); writeInt(mFile,"].rfli\" ",rfli,";\n");
 	}
 	void setEnvironment(size_t env_i,const Environment& env)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i]\" ",env_i);
+		writeInt(mFile,"\tsetAttr \".env[",env_i,"]\" ");
 		env.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment(size_t env_start,size_t env_end,Environment* env)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i:%i]\" ", env_start,env_end);
+		writeInt(mFile,"\tsetAttr \".env[",env_start); writeInt(mFile,":",env_end,"]\" ");
 		size_t size = (env_end-env_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			env[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startEnvironment(size_t env_start,size_t env_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i:%i]\"",env_start,env_end);
-		fprintf(mFile," -type \"Environment\" ");
+		writeInt(mFile,"\tsetAttr \".env[",env_start); writeInt(mFile,":",env_end,"]\"");
+		writeString(mFile," -type \"Environment\" ");
 	}
 	void appendEnvironment(const Environment& env)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		env.write(mFile);
 	}
 	void endEnvironment()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment_Position(size_t env_i,float envp)
 	{
 		if(envp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envp\" %f;\n", env_i,envp);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envp\" ",envp,";\n");
 	}
 	void setEnvironment_Color(size_t env_i,const float3& envc)
 	{
-		fprintf(mFile,"\tsetAttr \".env[%i].envc\" -type \"float3\" ",env_i);
+		writeInt(mFile,"\tsetAttr \".env[",env_i,"].envc\" -type \"float3\" ");
 		envc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnvironment_ColorR(size_t env_i,float envcr)
 	{
 		if(envcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcr\" %f;\n", env_i,envcr);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcr\" ",envcr,";\n");
 	}
 	void setEnvironment_ColorG(size_t env_i,float envcg)
 	{
 		if(envcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcg\" %f;\n", env_i,envcg);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcg\" ",envcg,";\n");
 	}
 	void setEnvironment_ColorB(size_t env_i,float envcb)
 	{
 		if(envcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envc.envcb\" %f;\n", env_i,envcb);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeFloat(mFile,"].envc.envcb\" ",envcb,";\n");
 	}
 	void setEnvironment_Interp(size_t env_i,unsigned int envi)
 	{
 		if(envi == 0) return;
-		fprintf(mFile,"\tsetAttr \".env[%i].envi\" %i;\n", env_i,envi);
+		writeInt(mFile,"\tsetAttr \".env[",env_i); writeInt(mFile,"].envi\" ",envi,";\n");
 	}
 	void setReflectedColor(const float3& rc)
 	{
-		fprintf(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
 		rc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReflectedColorR(float rr)
 	{
 		if(rr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rr\" %f;\n", rr);
+		writeFloat(mFile,"\tsetAttr \".rc.rr\" ",rr,";\n");
 	}
 	void setReflectedColorG(float rg)
 	{
 		if(rg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rg\" %f;\n", rg);
+		writeFloat(mFile,"\tsetAttr \".rc.rg\" ",rg,";\n");
 	}
 	void setReflectedColorB(float rb)
 	{
 		if(rb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rb\" %f;\n", rb);
+		writeFloat(mFile,"\tsetAttr \".rc.rb\" ",rb,";\n");
 	}
 	void setReflectionSpecularity(float rsp)
 	{
 		if(rsp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rsp\" %f;\n", rsp);
+		writeFloat(mFile,"\tsetAttr \".rsp\" ",rsp,";\n");
 	}
 	void setMatteOpacityMode(unsigned int mom)
 	{
 		if(mom == 2) return;
-		fprintf(mFile,"\tsetAttr \".mom\" %i;\n", mom);
+		writeInt(mFile,"\tsetAttr \".mom\" ",mom,";\n");
 	}
 	void setMatteOpacity(float mog)
 	{
 		if(mog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mog\" %f;\n", mog);
+		writeFloat(mFile,"\tsetAttr \".mog\" ",mog,";\n");
 	}
 	void setMiRefractionBlur(float mirfb)
 	{
 		if(mirfb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mirfb\" %f;\n", mirfb);
+		writeFloat(mFile,"\tsetAttr \".mirfb\" ",mirfb,";\n");
 	}
 	void setMiRefractionRays(short mirfr)
 	{
 		if(mirfr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mirfr\" %i;\n", mirfr);
+		writeInt(mFile,"\tsetAttr \".mirfr\" ",mirfr,";\n");
 	}
 	void setMiReflectionBlur(float mircb)
 	{
 		if(mircb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mircb\" %f;\n", mircb);
+		writeFloat(mFile,"\tsetAttr \".mircb\" ",mircb,";\n");
 	}
 	void setMiReflectionRays(short mircr)
 	{
 		if(mircr == 1) return;
-		fprintf(mFile,"\tsetAttr \".mircr\" %i;\n", mircr);
+		writeInt(mFile,"\tsetAttr \".mircr\" ",mircr,";\n");
 	}
 	void setMiIrradiance(const float3& mii)
 	{
-		fprintf(mFile,"\tsetAttr \".mii\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mii\" -type \"float3\" ");
 		mii.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiIrradianceR(float miir)
 	{
 		if(miir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miir\" %f;\n", miir);
+		writeFloat(mFile,"\tsetAttr \".mii.miir\" ",miir,";\n");
 	}
 	void setMiIrradianceG(float miig)
 	{
 		if(miig == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miig\" %f;\n", miig);
+		writeFloat(mFile,"\tsetAttr \".mii.miig\" ",miig,";\n");
 	}
 	void setMiIrradianceB(float miib)
 	{
 		if(miib == 0) return;
-		fprintf(mFile,"\tsetAttr \".mii.miib\" %f;\n", miib);
+		writeFloat(mFile,"\tsetAttr \".mii.miib\" ",miib,";\n");
 	}
 	void setMiIrradianceColor(const float3& miic)
 	{
-		fprintf(mFile,"\tsetAttr \".miic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".miic\" -type \"float3\" ");
 		miic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiIrradianceColorR(float miicr)
 	{
 		if(miicr == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicr\" %f;\n", miicr);
+		writeFloat(mFile,"\tsetAttr \".miic.miicr\" ",miicr,";\n");
 	}
 	void setMiIrradianceColorG(float miicg)
 	{
 		if(miicg == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicg\" %f;\n", miicg);
+		writeFloat(mFile,"\tsetAttr \".miic.miicg\" ",miicg,";\n");
 	}
 	void setMiIrradianceColorB(float miicb)
 	{
 		if(miicb == 1) return;
-		fprintf(mFile,"\tsetAttr \".miic.miicb\" %f;\n", miicb);
+		writeFloat(mFile,"\tsetAttr \".miic.miicb\" ",miicb,";\n");
 	}
 	void setMiDeriveFromMaya(bool mifm)
 	{
 		if(mifm == true) return;
-		fprintf(mFile,"\tsetAttr \".mifm\" %i;\n", mifm);
+		writeInt(mFile,"\tsetAttr \".mifm\" ",mifm,";\n");
 	}
 	void setMiShinyness(float mis)
 	{
 		if(mis == 10) return;
-		fprintf(mFile,"\tsetAttr \".mis\" %f;\n", mis);
+		writeFloat(mFile,"\tsetAttr \".mis\" ",mis,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void setMiRefractiveIndex(float miri)
 	{
 		if(miri == 1) return;
-		fprintf(mFile,"\tsetAttr \".miri\" %f;\n", miri);
+		writeFloat(mFile,"\tsetAttr \".miri\" ",miri,";\n");
 	}
 	void setMiRefractions(bool mirc)
 	{
 		if(mirc == true) return;
-		fprintf(mFile,"\tsetAttr \".mirc\" %i;\n", mirc);
+		writeInt(mFile,"\tsetAttr \".mirc\" ",mirc,";\n");
 	}
 	void setMiAbsorbs(bool miab)
 	{
 		if(miab == true) return;
-		fprintf(mFile,"\tsetAttr \".miab\" %i;\n", miab);
+		writeInt(mFile,"\tsetAttr \".miab\" ",miab,";\n");
 	}
 	void setMiDiffuse(float midc)
 	{
 		if(midc == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".midc\" %f;\n", midc);
+		writeFloat(mFile,"\tsetAttr \".midc\" ",midc,";\n");
 	}
 	void setMiColor(const float3& mic)
 	{
-		fprintf(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
 		mic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiColorR(float micr)
 	{
 		if(micr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micr\" %f;\n", micr);
+		writeFloat(mFile,"\tsetAttr \".mic.micr\" ",micr,";\n");
 	}
 	void setMiColorG(float micg)
 	{
 		if(micg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micg\" %f;\n", micg);
+		writeFloat(mFile,"\tsetAttr \".mic.micg\" ",micg,";\n");
 	}
 	void setMiColorB(float micb)
 	{
 		if(micb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micb\" %f;\n", micb);
+		writeFloat(mFile,"\tsetAttr \".mic.micb\" ",micb,";\n");
 	}
 	void setMiTransparency(const float3& mit)
 	{
-		fprintf(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
 		mit.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiTransparencyR(float mitr)
 	{
 		if(mitr == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitr\" %f;\n", mitr);
+		writeFloat(mFile,"\tsetAttr \".mit.mitr\" ",mitr,";\n");
 	}
 	void setMiTransparencyG(float mitg)
 	{
 		if(mitg == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitg\" %f;\n", mitg);
+		writeFloat(mFile,"\tsetAttr \".mit.mitg\" ",mitg,";\n");
 	}
 	void setMiTransparencyB(float mitb)
 	{
 		if(mitb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitb\" %f;\n", mitb);
+		writeFloat(mFile,"\tsetAttr \".mit.mitb\" ",mitb,";\n");
 	}
 	void setMiTranslucence(float mitc)
 	{
 		if(mitc == 0) return;
-		fprintf(mFile,"\tsetAttr \".mitc\" %f;\n", mitc);
+		writeFloat(mFile,"\tsetAttr \".mitc\" ",mitc,";\n");
 	}
 	void setMiTranslucenceFocus(float mitf)
 	{
 		if(mitf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mitf\" %f;\n", mitf);
+		writeFloat(mFile,"\tsetAttr \".mitf\" ",mitf,";\n");
 	}
 	void setMiNormalCamera(const float3& minc)
 	{
-		fprintf(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
 		minc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiNormalCameraX(float mincx)
 	{
 		if(mincx == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincx\" %f;\n", mincx);
+		writeFloat(mFile,"\tsetAttr \".minc.mincx\" ",mincx,";\n");
 	}
 	void setMiNormalCameraY(float mincy)
 	{
 		if(mincy == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincy\" %f;\n", mincy);
+		writeFloat(mFile,"\tsetAttr \".minc.mincy\" ",mincy,";\n");
 	}
 	void setMiNormalCameraZ(float mincz)
 	{
 		if(mincz == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincz\" %f;\n", mincz);
+		writeFloat(mFile,"\tsetAttr \".minc.mincz\" ",mincz,";\n");
 	}
 	void getObjectId()const
 	{
-		fprintf(mFile,"\"%s.oi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi\"");
 	}
 	void getPrimitiveId()const
 	{
-		fprintf(mFile,"\"%s.pi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pi\"");
 	}
 	void getRaySampler()const
 	{
-		fprintf(mFile,"\"%s.rtr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtr\"");
 	}
 	void getRayDepth()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 	void getRayInstance()const
 	{
-		fprintf(mFile,"\"%s.ryi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ryi\"");
 	}
 	void getRefractionLimit()const
 	{
-		fprintf(mFile,"\"%s.rdl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rdl\"");
 	}
 	void getRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.rfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfi\"");
 	}
 	void getMediumRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.mrfi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrfi\"");
 	}
 	void getRefractions()const
 	{
-		fprintf(mFile,"\"%s.rfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfc\"");
 	}
 	void getDiffuse()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getForwardScatter()const
 	{
-		fprintf(mFile,"\"%s.fsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fsc\"");
 	}
 	void getRayDirection()const
 	{
-		fprintf(mFile,"\"%s.rad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad\"");
 	}
 	void getRayDirectionX()const
 	{
-		fprintf(mFile,"\"%s.rad.rdx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdx\"");
 	}
 	void getRayDirectionY()const
 	{
-		fprintf(mFile,"\"%s.rad.rdy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdy\"");
 	}
 	void getRayDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.rad.rdz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdz\"");
 	}
 	void getColor(size_t clr_i)const
 	{
-		fprintf(mFile,"\"%s.clr[%i]\"",mName.c_str(),clr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clr[",clr_i,"]\"");
 	}
 	void getColor()const
 	{
 
-		fprintf(mFile,"\"%s.clr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr\"");
 	}
 	void getColor_Position(size_t clr_i)const
 	{
-		fprintf(mFile,"\"%s.clr[%i].clrp\"",mName.c_str(),clr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clr[",clr_i,"].clrp\"");
 	}
 	void getColor_Position()const
 	{
 
-		fprintf(mFile,"\"%s.clr.clrp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.clrp\"");
 	}
 	void getColor_Color(size_t clr_i)const
 	{
-		fprintf(mFile,"\"%s.clr[%i].clrc\"",mName.c_str(),clr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clr[",clr_i,"].clrc\"");
 	}
 	void getColor_Color()const
 	{
 
-		fprintf(mFile,"\"%s.clr.clrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.clrc\"");
 	}
 	void getColor_ColorR(size_t clr_i)const
 	{
-		fprintf(mFile,"\"%s.clr[%i].clrc.clrcr\"",mName.c_str(),clr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clr[",clr_i,"].clrc.clrcr\"");
 	}
 	void getColor_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.clr.clrc.clrcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.clrc.clrcr\"");
 	}
 	void getColor_ColorG(size_t clr_i)const
 	{
-		fprintf(mFile,"\"%s.clr[%i].clrc.clrcg\"",mName.c_str(),clr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clr[",clr_i,"].clrc.clrcg\"");
 	}
 	void getColor_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.clr.clrc.clrcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.clrc.clrcg\"");
 	}
 	void getColor_ColorB(size_t clr_i)const
 	{
-		fprintf(mFile,"\"%s.clr[%i].clrc.clrcb\"",mName.c_str(),clr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clr[",clr_i,"].clrc.clrcb\"");
 	}
 	void getColor_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.clr.clrc.clrcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.clrc.clrcb\"");
 	}
 	void getColor_Interp(size_t clr_i)const
 	{
-		fprintf(mFile,"\"%s.clr[%i].clri\"",mName.c_str(),clr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".clr[",clr_i,"].clri\"");
 	}
 	void getColor_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.clr.clri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clr.clri\"");
 	}
 	void getColorInput()const
 	{
-		fprintf(mFile,"\"%s.cin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cin\"");
 	}
 	void getShadowMode()const
 	{
-		fprintf(mFile,"\"%s.smd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smd\"");
 	}
 	void getShadowColor()const
 	{
-		fprintf(mFile,"\"%s.shc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shc\"");
 	}
 	void getShadowColorR()const
 	{
-		fprintf(mFile,"\"%s.shc.shr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shc.shr\"");
 	}
 	void getShadowColorG()const
 	{
-		fprintf(mFile,"\"%s.shc.shg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shc.shg\"");
 	}
 	void getShadowColorB()const
 	{
-		fprintf(mFile,"\"%s.shc.shb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shc.shb\"");
 	}
 	void getShadowThreshold()const
 	{
-		fprintf(mFile,"\"%s.sht\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sht\"");
 	}
 	void getTransparency(size_t it_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i]\"",mName.c_str(),it_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i,"]\"");
 	}
 	void getTransparency()const
 	{
 
-		fprintf(mFile,"\"%s.it\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it\"");
 	}
 	void getTransparency_Position(size_t it_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itp\"",mName.c_str(),it_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i,"].itp\"");
 	}
 	void getTransparency_Position()const
 	{
 
-		fprintf(mFile,"\"%s.it.itp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itp\"");
 	}
 	void getTransparency_Color(size_t it_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itc\"",mName.c_str(),it_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i,"].itc\"");
 	}
 	void getTransparency_Color()const
 	{
 
-		fprintf(mFile,"\"%s.it.itc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itc\"");
 	}
 	void getTransparency_ColorR(size_t it_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itc.itcr\"",mName.c_str(),it_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i,"].itc.itcr\"");
 	}
 	void getTransparency_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.it.itc.itcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itc.itcr\"");
 	}
 	void getTransparency_ColorG(size_t it_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itc.itcg\"",mName.c_str(),it_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i,"].itc.itcg\"");
 	}
 	void getTransparency_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.it.itc.itcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itc.itcg\"");
 	}
 	void getTransparency_ColorB(size_t it_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].itc.itcb\"",mName.c_str(),it_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i,"].itc.itcb\"");
 	}
 	void getTransparency_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.it.itc.itcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itc.itcb\"");
 	}
 	void getTransparency_Interp(size_t it_i)const
 	{
-		fprintf(mFile,"\"%s.it[%i].iti\"",mName.c_str(),it_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".it[",it_i,"].iti\"");
 	}
 	void getTransparency_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.it.iti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.iti\"");
 	}
 	void getAmbientColor()const
 	{
-		fprintf(mFile,"\"%s.ambc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc\"");
 	}
 	void getAmbientColorR()const
 	{
-		fprintf(mFile,"\"%s.ambc.acr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acr\"");
 	}
 	void getAmbientColorG()const
 	{
-		fprintf(mFile,"\"%s.ambc.acg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acg\"");
 	}
 	void getAmbientColorB()const
 	{
-		fprintf(mFile,"\"%s.ambc.acb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ambc.acb\"");
 	}
 	void getIncandescence(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i]\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"]\"");
 	}
 	void getIncandescence()const
 	{
 
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getIncandescence_Position(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i].icp\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"].icp\"");
 	}
 	void getIncandescence_Position()const
 	{
 
-		fprintf(mFile,"\"%s.ic.icp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.icp\"");
 	}
 	void getIncandescence_Color(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i].icc\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"].icc\"");
 	}
 	void getIncandescence_Color()const
 	{
 
-		fprintf(mFile,"\"%s.ic.icc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.icc\"");
 	}
 	void getIncandescence_ColorR(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i].icc.iccr\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"].icc.iccr\"");
 	}
 	void getIncandescence_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.ic.icc.iccr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.icc.iccr\"");
 	}
 	void getIncandescence_ColorG(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i].icc.iccg\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"].icc.iccg\"");
 	}
 	void getIncandescence_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.ic.icc.iccg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.icc.iccg\"");
 	}
 	void getIncandescence_ColorB(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i].icc.iccb\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"].icc.iccb\"");
 	}
 	void getIncandescence_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.ic.icc.iccb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.icc.iccb\"");
 	}
 	void getIncandescence_Interp(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i].ici\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"].ici\"");
 	}
 	void getIncandescence_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.ic.ici\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ici\"");
 	}
 	void getTranslucence()const
 	{
-		fprintf(mFile,"\"%s.tc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc\"");
 	}
 	void getTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.tcf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcf\"");
 	}
 	void getTranslucenceDepth()const
 	{
-		fprintf(mFile,"\"%s.trsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trsd\"");
 	}
 	void getOpacityDepth()const
 	{
-		fprintf(mFile,"\"%s.opad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".opad\"");
 	}
 	void getGlowIntensity()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 	void getSpecularGlow()const
 	{
-		fprintf(mFile,"\"%s.spg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spg\"");
 	}
 	void getHideSource()const
 	{
-		fprintf(mFile,"\"%s.hs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hs\"");
 	}
 	void getSurfaceThickness()const
 	{
-		fprintf(mFile,"\"%s.thik\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".thik\"");
 	}
 	void getShadowAttenuation()const
 	{
-		fprintf(mFile,"\"%s.fakc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fakc\"");
 	}
 	void getTransparencyDepth()const
 	{
-		fprintf(mFile,"\"%s.trdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trdp\"");
 	}
 	void getLightAbsorbance()const
 	{
-		fprintf(mFile,"\"%s.absb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".absb\"");
 	}
 	void getChromaticAberration()const
 	{
-		fprintf(mFile,"\"%s.crab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crab\"");
 	}
 	void getEccentricity()const
 	{
-		fprintf(mFile,"\"%s.ec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ec\"");
 	}
 	void getSpecularity()const
 	{
-		fprintf(mFile,"\"%s.spl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spl\"");
 	}
 	void getSpecularRollOff(size_t sro_i)const
 	{
-		fprintf(mFile,"\"%s.sro[%i]\"",mName.c_str(),sro_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sro[",sro_i,"]\"");
 	}
 	void getSpecularRollOff()const
 	{
 
-		fprintf(mFile,"\"%s.sro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sro\"");
 	}
 	void getSpecularRollOff_Position(size_t sro_i)const
 	{
-		fprintf(mFile,"\"%s.sro[%i].srop\"",mName.c_str(),sro_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sro[",sro_i,"].srop\"");
 	}
 	void getSpecularRollOff_Position()const
 	{
 
-		fprintf(mFile,"\"%s.sro.srop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sro.srop\"");
 	}
 	void getSpecularRollOff_FloatValue(size_t sro_i)const
 	{
-		fprintf(mFile,"\"%s.sro[%i].srofv\"",mName.c_str(),sro_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sro[",sro_i,"].srofv\"");
 	}
 	void getSpecularRollOff_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.sro.srofv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sro.srofv\"");
 	}
 	void getSpecularRollOff_Interp(size_t sro_i)const
 	{
-		fprintf(mFile,"\"%s.sro[%i].sroi\"",mName.c_str(),sro_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sro[",sro_i,"].sroi\"");
 	}
 	void getSpecularRollOff_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.sro.sroi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sro.sroi\"");
 	}
 	void getReflectionLimit()const
 	{
-		fprintf(mFile,"\"%s.fll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fll\"");
 	}
 	void getSpecularColor(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i]\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"]\"");
 	}
 	void getSpecularColor()const
 	{
 
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getSpecularColor_Position(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i].scp\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"].scp\"");
 	}
 	void getSpecularColor_Position()const
 	{
 
-		fprintf(mFile,"\"%s.sc.scp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scp\"");
 	}
 	void getSpecularColor_Color(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i].scc\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"].scc\"");
 	}
 	void getSpecularColor_Color()const
 	{
 
-		fprintf(mFile,"\"%s.sc.scc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scc\"");
 	}
 	void getSpecularColor_ColorR(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i].scc.sccr\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"].scc.sccr\"");
 	}
 	void getSpecularColor_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.sc.scc.sccr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scc.sccr\"");
 	}
 	void getSpecularColor_ColorG(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i].scc.sccg\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"].scc.sccg\"");
 	}
 	void getSpecularColor_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.sc.scc.sccg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scc.sccg\"");
 	}
 	void getSpecularColor_ColorB(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i].scc.sccb\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"].scc.sccb\"");
 	}
 	void getSpecularColor_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.sc.scc.sccb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scc.sccb\"");
 	}
 	void getSpecularColor_Interp(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i].sci\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"].sci\"");
 	}
 	void getSpecularColor_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.sc.sci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sci\"");
 	}
 	void getReflectivity(size_t rfl_i)const
 	{
-		fprintf(mFile,"\"%s.rfl[%i]\"",mName.c_str(),rfl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rfl[",rfl_i,"]\"");
 	}
 	void getReflectivity()const
 	{
 
-		fprintf(mFile,"\"%s.rfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfl\"");
 	}
 	void getReflectivity_Position(size_t rfl_i)const
 	{
-		fprintf(mFile,"\"%s.rfl[%i].rflp\"",mName.c_str(),rfl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rfl[",rfl_i,"].rflp\"");
 	}
 	void getReflectivity_Position()const
 	{
 
-		fprintf(mFile,"\"%s.rfl.rflp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfl.rflp\"");
 	}
 	void getReflectivity_FloatValue(size_t rfl_i)const
 	{
-		fprintf(mFile,"\"%s.rfl[%i].rflfv\"",mName.c_str(),rfl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rfl[",rfl_i,"].rflfv\"");
 	}
 	void getReflectivity_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.rfl.rflfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfl.rflfv\"");
 	}
 	void getReflectivity_Interp(size_t rfl_i)const
 	{
-		fprintf(mFile,"\"%s.rfl[%i].rfli\"",mName.c_str(),rfl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rfl[",rfl_i,"].rfli\"");
 	}
 	void getReflectivity_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.rfl.rfli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfl.rfli\"");
 	}
 	void getEnvironment(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i]\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"]\"");
 	}
 	void getEnvironment()const
 	{
 
-		fprintf(mFile,"\"%s.env\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env\"");
 	}
 	void getEnvironment_Position(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envp\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envp\"");
 	}
 	void getEnvironment_Position()const
 	{
 
-		fprintf(mFile,"\"%s.env.envp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envp\"");
 	}
 	void getEnvironment_Color(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc\"");
 	}
 	void getEnvironment_Color()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc\"");
 	}
 	void getEnvironment_ColorR(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcr\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcr\"");
 	}
 	void getEnvironment_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcr\"");
 	}
 	void getEnvironment_ColorG(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcg\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcg\"");
 	}
 	void getEnvironment_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcg\"");
 	}
 	void getEnvironment_ColorB(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envc.envcb\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envc.envcb\"");
 	}
 	void getEnvironment_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.env.envc.envcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envc.envcb\"");
 	}
 	void getEnvironment_Interp(size_t env_i)const
 	{
-		fprintf(mFile,"\"%s.env[%i].envi\"",mName.c_str(),env_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".env[",env_i,"].envi\"");
 	}
 	void getEnvironment_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.env.envi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".env.envi\"");
 	}
 	void getReflectedColor()const
 	{
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getReflectedColorR()const
 	{
-		fprintf(mFile,"\"%s.rc.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rr\"");
 	}
 	void getReflectedColorG()const
 	{
-		fprintf(mFile,"\"%s.rc.rg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rg\"");
 	}
 	void getReflectedColorB()const
 	{
-		fprintf(mFile,"\"%s.rc.rb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rb\"");
 	}
 	void getTriangleNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.tnc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc\"");
 	}
 	void getTriangleNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.tnc.tnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tnx\"");
 	}
 	void getTriangleNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.tnc.tny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tny\"");
 	}
 	void getTriangleNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.tnc.tnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tnz\"");
 	}
 	void getReflectionSpecularity()const
 	{
-		fprintf(mFile,"\"%s.rsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsp\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogb\"");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.pc.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.pc.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.pc.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pz\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getMatrixEyeToWorld()const
 	{
-		fprintf(mFile,"\"%s.e2w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2w\"");
 	}
 	void getLightDataArray(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i]\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"]\"");
 	}
 	void getLightDataArray()const
 	{
 
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld\"");
 	}
 	void getLightDirection()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldx\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldx\"");
 	}
 	void getLightDirectionX()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldy\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldy\"");
 	}
 	void getLightDirectionY()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldz\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldz\"");
 	}
 	void getLightDirectionZ()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li\"");
 	}
 	void getLightIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lir\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lir\"");
 	}
 	void getLightIntensityR()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lig\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lig\"");
 	}
 	void getLightIntensityG()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lib\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lib\"");
 	}
 	void getLightIntensityB()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].la\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].la\"");
 	}
 	void getLightAmbient()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ldf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ldf\"");
 	}
 	void getLightDiffuse()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ls\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ls\"");
 	}
 	void getLightSpecular()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lsf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lsf\"");
 	}
 	void getLightShadowFraction()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].psi\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].psi\"");
 	}
 	void getPreShadowIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lbd\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lbd\"");
 	}
 	void getLightBlindData()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbd\"");
 	}
 	void getMatteOpacityMode()const
 	{
-		fprintf(mFile,"\"%s.mom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mom\"");
 	}
 	void getMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.mog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mog\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getMiRefractionBlur()const
 	{
-		fprintf(mFile,"\"%s.mirfb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirfb\"");
 	}
 	void getMiRefractionRays()const
 	{
-		fprintf(mFile,"\"%s.mirfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirfr\"");
 	}
 	void getMiReflectionBlur()const
 	{
-		fprintf(mFile,"\"%s.mircb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircb\"");
 	}
 	void getMiReflectionRays()const
 	{
-		fprintf(mFile,"\"%s.mircr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mircr\"");
 	}
 	void getMiIrradiance()const
 	{
-		fprintf(mFile,"\"%s.mii\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii\"");
 	}
 	void getMiIrradianceR()const
 	{
-		fprintf(mFile,"\"%s.mii.miir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miir\"");
 	}
 	void getMiIrradianceG()const
 	{
-		fprintf(mFile,"\"%s.mii.miig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miig\"");
 	}
 	void getMiIrradianceB()const
 	{
-		fprintf(mFile,"\"%s.mii.miib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mii.miib\"");
 	}
 	void getMiIrradianceColor()const
 	{
-		fprintf(mFile,"\"%s.miic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic\"");
 	}
 	void getMiIrradianceColorR()const
 	{
-		fprintf(mFile,"\"%s.miic.miicr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicr\"");
 	}
 	void getMiIrradianceColorG()const
 	{
-		fprintf(mFile,"\"%s.miic.miicg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicg\"");
 	}
 	void getMiIrradianceColorB()const
 	{
-		fprintf(mFile,"\"%s.miic.miicb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miic.miicb\"");
 	}
 	void getMiDeriveFromMaya()const
 	{
-		fprintf(mFile,"\"%s.mifm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifm\"");
 	}
 	void getMiShinyness()const
 	{
-		fprintf(mFile,"\"%s.mis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mis\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 	void getMiRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.miri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miri\"");
 	}
 	void getMiRefractions()const
 	{
-		fprintf(mFile,"\"%s.mirc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirc\"");
 	}
 	void getMiAbsorbs()const
 	{
-		fprintf(mFile,"\"%s.miab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miab\"");
 	}
 	void getMiDiffuse()const
 	{
-		fprintf(mFile,"\"%s.midc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".midc\"");
 	}
 	void getMiColor()const
 	{
-		fprintf(mFile,"\"%s.mic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic\"");
 	}
 	void getMiColorR()const
 	{
-		fprintf(mFile,"\"%s.mic.micr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micr\"");
 	}
 	void getMiColorG()const
 	{
-		fprintf(mFile,"\"%s.mic.micg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micg\"");
 	}
 	void getMiColorB()const
 	{
-		fprintf(mFile,"\"%s.mic.micb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micb\"");
 	}
 	void getMiTransparency()const
 	{
-		fprintf(mFile,"\"%s.mit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit\"");
 	}
 	void getMiTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.mit.mitr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitr\"");
 	}
 	void getMiTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.mit.mitg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitg\"");
 	}
 	void getMiTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.mit.mitb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitb\"");
 	}
 	void getMiTranslucence()const
 	{
-		fprintf(mFile,"\"%s.mitc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitc\"");
 	}
 	void getMiTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.mitf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitf\"");
 	}
 	void getMiNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.minc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc\"");
 	}
 	void getMiNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.minc.mincx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincx\"");
 	}
 	void getMiNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.minc.mincy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincy\"");
 	}
 	void getMiNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincz\"");
 	}
 protected:
 	RampShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,73 +27,73 @@ public:
 	void setPrimaryRadius(double pr)
 	{
 		if(pr == 1) return;
-		fprintf(mFile,"\tsetAttr \".pr\" %f;\n", pr);
+		writeFloat(mFile,"\tsetAttr \".pr\" ",pr,";\n");
 	}
 	void setSecondaryRadius(double sr)
 	{
 		if(sr == 1) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setPositionTolerance(double pt)
 	{
 		if(pt == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".pt\" %f;\n", pt);
+		writeFloat(mFile,"\tsetAttr \".pt\" ",pt,";\n");
 	}
 	void setTangentTolerance(double tt)
 	{
 		if(tt == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".tt\" %f;\n", tt);
+		writeFloat(mFile,"\tsetAttr \".tt\" ",tt,";\n");
 	}
 	void getPrimarySurface()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getSecondarySurface()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getPrimaryRadius()const
 	{
-		fprintf(mFile,"\"%s.pr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pr\"");
 	}
 	void getSecondaryRadius()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getPositionTolerance()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getTangentTolerance()const
 	{
-		fprintf(mFile,"\"%s.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tt\"");
 	}
 	void getOutputSurface(size_t os_i)const
 	{
-		fprintf(mFile,"\"%s.os[%i]\"",mName.c_str(),os_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".os[",os_i,"]\"");
 	}
 	void getOutputSurface()const
 	{
 
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getTrimCurveOnPrimary(size_t tcp_i)const
 	{
-		fprintf(mFile,"\"%s.tcp[%i]\"",mName.c_str(),tcp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tcp[",tcp_i,"]\"");
 	}
 	void getTrimCurveOnPrimary()const
 	{
 
-		fprintf(mFile,"\"%s.tcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcp\"");
 	}
 	void getTrimCurveOnSecondary(size_t tcs_i)const
 	{
-		fprintf(mFile,"\"%s.tcs[%i]\"",mName.c_str(),tcs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tcs[",tcs_i,"]\"");
 	}
 	void getTrimCurveOnSecondary()const
 	{
 
-		fprintf(mFile,"\"%s.tcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcs\"");
 	}
 protected:
 	RbfSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
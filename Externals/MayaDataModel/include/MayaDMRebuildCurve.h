@@ -27,113 +27,113 @@ public:
 	void setFitRebuild(bool fr)
 	{
 		if(fr == true) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %i;\n", fr);
+		writeInt(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setRebuildType(unsigned int rt)
 	{
 		if(rt == 0) return;
-		fprintf(mFile,"\tsetAttr \".rt\" %i;\n", rt);
+		writeInt(mFile,"\tsetAttr \".rt\" ",rt,";\n");
 	}
 	void setSpans(int s)
 	{
 		if(s == 4) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setEndKnots(unsigned int end)
 	{
 		if(end == 0) return;
-		fprintf(mFile,"\tsetAttr \".end\" %i;\n", end);
+		writeInt(mFile,"\tsetAttr \".end\" ",end,";\n");
 	}
 	void setKeepRange(unsigned int kr)
 	{
 		if(kr == 1) return;
-		fprintf(mFile,"\tsetAttr \".kr\" %i;\n", kr);
+		writeInt(mFile,"\tsetAttr \".kr\" ",kr,";\n");
 	}
 	void setKeepEndPoints(bool kep)
 	{
 		if(kep == true) return;
-		fprintf(mFile,"\tsetAttr \".kep\" %i;\n", kep);
+		writeInt(mFile,"\tsetAttr \".kep\" ",kep,";\n");
 	}
 	void setKeepTangents(bool kt)
 	{
 		if(kt == true) return;
-		fprintf(mFile,"\tsetAttr \".kt\" %i;\n", kt);
+		writeInt(mFile,"\tsetAttr \".kt\" ",kt,";\n");
 	}
 	void setKeepControlPoints(bool kcp)
 	{
 		if(kcp == false) return;
-		fprintf(mFile,"\tsetAttr \".kcp\" %i;\n", kcp);
+		writeInt(mFile,"\tsetAttr \".kcp\" ",kcp,";\n");
 	}
 	void setSmartSurfaceCurveRebuild(bool scr)
 	{
 		if(scr == false) return;
-		fprintf(mFile,"\tsetAttr \".scr\" %i;\n", scr);
+		writeInt(mFile,"\tsetAttr \".scr\" ",scr,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getMatchCurve()const
 	{
-		fprintf(mFile,"\"%s.mc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mc\"");
 	}
 	void getFitRebuild()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getRebuildType()const
 	{
-		fprintf(mFile,"\"%s.rt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rt\"");
 	}
 	void getSpans()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getEndKnots()const
 	{
-		fprintf(mFile,"\"%s.end\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".end\"");
 	}
 	void getKeepRange()const
 	{
-		fprintf(mFile,"\"%s.kr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kr\"");
 	}
 	void getKeepEndPoints()const
 	{
-		fprintf(mFile,"\"%s.kep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kep\"");
 	}
 	void getKeepTangents()const
 	{
-		fprintf(mFile,"\"%s.kt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kt\"");
 	}
 	void getOutputCurve()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getKeepControlPoints()const
 	{
-		fprintf(mFile,"\"%s.kcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kcp\"");
 	}
 	void getSmartSurfaceCurveRebuild()const
 	{
-		fprintf(mFile,"\"%s.scr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scr\"");
 	}
 protected:
 	RebuildCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,131 +27,131 @@ public:
 	void setRebuildType(unsigned int rt)
 	{
 		if(rt == 0) return;
-		fprintf(mFile,"\tsetAttr \".rt\" %i;\n", rt);
+		writeInt(mFile,"\tsetAttr \".rt\" ",rt,";\n");
 	}
 	void setDirection(unsigned int dir)
 	{
 		if(dir == 2) return;
-		fprintf(mFile,"\tsetAttr \".dir\" %i;\n", dir);
+		writeInt(mFile,"\tsetAttr \".dir\" ",dir,";\n");
 	}
 	void setSpansU(int su)
 	{
 		if(su == 4) return;
-		fprintf(mFile,"\tsetAttr \".su\" %i;\n", su);
+		writeInt(mFile,"\tsetAttr \".su\" ",su,";\n");
 	}
 	void setSpansV(int sv)
 	{
 		if(sv == 4) return;
-		fprintf(mFile,"\tsetAttr \".sv\" %i;\n", sv);
+		writeInt(mFile,"\tsetAttr \".sv\" ",sv,";\n");
 	}
 	void setDegreeU(unsigned int du)
 	{
 		if(du == 3) return;
-		fprintf(mFile,"\tsetAttr \".du\" %i;\n", du);
+		writeInt(mFile,"\tsetAttr \".du\" ",du,";\n");
 	}
 	void setDegreeV(unsigned int dv)
 	{
 		if(dv == 3) return;
-		fprintf(mFile,"\tsetAttr \".dv\" %i;\n", dv);
+		writeInt(mFile,"\tsetAttr \".dv\" ",dv,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setEndKnots(unsigned int end)
 	{
 		if(end == 0) return;
-		fprintf(mFile,"\tsetAttr \".end\" %i;\n", end);
+		writeInt(mFile,"\tsetAttr \".end\" ",end,";\n");
 	}
 	void setKeepCorners(bool kc)
 	{
 		if(kc == true) return;
-		fprintf(mFile,"\tsetAttr \".kc\" %i;\n", kc);
+		writeInt(mFile,"\tsetAttr \".kc\" ",kc,";\n");
 	}
 	void setKeepRange(unsigned int kr)
 	{
 		if(kr == 1) return;
-		fprintf(mFile,"\tsetAttr \".kr\" %i;\n", kr);
+		writeInt(mFile,"\tsetAttr \".kr\" ",kr,";\n");
 	}
 	void setKeepControlPoints(bool kcp)
 	{
 		if(kcp == false) return;
-		fprintf(mFile,"\tsetAttr \".kcp\" %i;\n", kcp);
+		writeInt(mFile,"\tsetAttr \".kcp\" ",kcp,";\n");
 	}
 	void setFitRebuild(unsigned int fr)
 	{
 		if(fr == 0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %i;\n", fr);
+		writeInt(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setOldRebuildRational(bool orr)
 	{
 		if(orr == false) return;
-		fprintf(mFile,"\tsetAttr \".orr\" %i;\n", orr);
+		writeInt(mFile,"\tsetAttr \".orr\" ",orr,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getMatchSurface()const
 	{
-		fprintf(mFile,"\"%s.ms\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ms\"");
 	}
 	void getRebuildType()const
 	{
-		fprintf(mFile,"\"%s.rt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rt\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.dir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dir\"");
 	}
 	void getSpansU()const
 	{
-		fprintf(mFile,"\"%s.su\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su\"");
 	}
 	void getSpansV()const
 	{
-		fprintf(mFile,"\"%s.sv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sv\"");
 	}
 	void getDegreeU()const
 	{
-		fprintf(mFile,"\"%s.du\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".du\"");
 	}
 	void getDegreeV()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getEndKnots()const
 	{
-		fprintf(mFile,"\"%s.end\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".end\"");
 	}
 	void getKeepCorners()const
 	{
-		fprintf(mFile,"\"%s.kc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kc\"");
 	}
 	void getKeepRange()const
 	{
-		fprintf(mFile,"\"%s.kr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kr\"");
 	}
 	void getKeepControlPoints()const
 	{
-		fprintf(mFile,"\"%s.kcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kcp\"");
 	}
 	void getFitRebuild()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getOldRebuildRational()const
 	{
-		fprintf(mFile,"\"%s.orr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".orr\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	RebuildSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
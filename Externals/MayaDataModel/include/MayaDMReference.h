@@ -37,222 +37,222 @@ public:
 	void setFileNames(size_t fn_i,const string& fn)
 	{
 		if(fn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".fn[%i]\" -type \"string\" ",fn_i);
+		writeInt(mFile,"\tsetAttr \".fn[",fn_i,"]\" -type \"string\" ");
 		fn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFileNames(size_t fn_start,size_t fn_end,string* fn)
 	{
-		fprintf(mFile,"\tsetAttr \".fn[%i:%i]\" ", fn_start,fn_end);
+		writeInt(mFile,"\tsetAttr \".fn[",fn_start); writeInt(mFile,":",fn_end,"]\" ");
 		size_t size = (fn_end-fn_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			fn[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFileNames(size_t fn_start,size_t fn_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fn[%i:%i]\"",fn_start,fn_end);
-		fprintf(mFile," -type \"string\" ");
+		writeInt(mFile,"\tsetAttr \".fn[",fn_start); writeInt(mFile,":",fn_end,"]\"");
+		writeString(mFile," -type \"string\" ");
 	}
 	void appendFileNames(const string& fn)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		fn.write(mFile);
 	}
 	void endFileNames()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMultiParentList(size_t mpl_i,const MultiParentList& mpl)
 	{
-		fprintf(mFile,"\tsetAttr \".mpl[%i]\" ",mpl_i);
+		writeInt(mFile,"\tsetAttr \".mpl[",mpl_i,"]\" ");
 		mpl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMultiParentList(size_t mpl_start,size_t mpl_end,MultiParentList* mpl)
 	{
-		fprintf(mFile,"\tsetAttr \".mpl[%i:%i]\" ", mpl_start,mpl_end);
+		writeInt(mFile,"\tsetAttr \".mpl[",mpl_start); writeInt(mFile,":",mpl_end,"]\" ");
 		size_t size = (mpl_end-mpl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			mpl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startMultiParentList(size_t mpl_start,size_t mpl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".mpl[%i:%i]\"",mpl_start,mpl_end);
-		fprintf(mFile," -type \"MultiParentList\" ");
+		writeInt(mFile,"\tsetAttr \".mpl[",mpl_start); writeInt(mFile,":",mpl_end,"]\"");
+		writeString(mFile," -type \"MultiParentList\" ");
 	}
 	void appendMultiParentList(const MultiParentList& mpl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		mpl.write(mFile);
 	}
 	void endMultiParentList()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProxyTag(const string& ptag)
 	{
 		if(ptag == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ptag\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ptag\" -type \"string\" ");
 		ptag.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocked(bool lk)
 	{
 		if(lk == false) return;
-		fprintf(mFile,"\tsetAttr \".lk\" %i;\n", lk);
+		writeInt(mFile,"\tsetAttr \".lk\" ",lk,";\n");
 	}
 	void getFileNames(size_t fn_i)const
 	{
-		fprintf(mFile,"\"%s.fn[%i]\"",mName.c_str(),fn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fn[",fn_i,"]\"");
 	}
 	void getFileNames()const
 	{
 
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getConnectionList(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i]\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"]\"");
 	}
 	void getConnectionList()const
 	{
 
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getConnectionAttr(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].ca\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].ca\"");
 	}
 	void getConnectionAttr()const
 	{
 
-		fprintf(mFile,"\"%s.cl.ca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.ca\"");
 	}
 	void getConnection(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].c\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].c\"");
 	}
 	void getConnection()const
 	{
 
-		fprintf(mFile,"\"%s.cl.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.c\"");
 	}
 	void getSetAttrList(size_t sl_i)const
 	{
-		fprintf(mFile,"\"%s.sl[%i]\"",mName.c_str(),sl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sl[",sl_i,"]\"");
 	}
 	void getSetAttrList()const
 	{
 
-		fprintf(mFile,"\"%s.sl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sl\"");
 	}
 	void getAddAttrList(size_t al_i)const
 	{
-		fprintf(mFile,"\"%s.al[%i]\"",mName.c_str(),al_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".al[",al_i,"]\"");
 	}
 	void getAddAttrList()const
 	{
 
-		fprintf(mFile,"\"%s.al\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al\"");
 	}
 	void getDeleteAttrList(size_t dl_i)const
 	{
-		fprintf(mFile,"\"%s.dl[%i]\"",mName.c_str(),dl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dl[",dl_i,"]\"");
 	}
 	void getDeleteAttrList()const
 	{
 
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getBrokenConnectionList(size_t bl_i)const
 	{
-		fprintf(mFile,"\"%s.bl[%i]\"",mName.c_str(),bl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".bl[",bl_i,"]\"");
 	}
 	void getBrokenConnectionList()const
 	{
 
-		fprintf(mFile,"\"%s.bl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bl\"");
 	}
 	void getParentList(size_t pl_i)const
 	{
-		fprintf(mFile,"\"%s.pl[%i]\"",mName.c_str(),pl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl[",pl_i,"]\"");
 	}
 	void getParentList()const
 	{
 
-		fprintf(mFile,"\"%s.pl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pl\"");
 	}
 	void getFosterParent()const
 	{
-		fprintf(mFile,"\"%s.fp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp\"");
 	}
 	void getFosterSiblings(size_t fs_i)const
 	{
-		fprintf(mFile,"\"%s.fs[%i]\"",mName.c_str(),fs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fs[",fs_i,"]\"");
 	}
 	void getFosterSiblings()const
 	{
 
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getPlaceHolderList(size_t phl_i)const
 	{
-		fprintf(mFile,"\"%s.phl[%i]\"",mName.c_str(),phl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".phl[",phl_i,"]\"");
 	}
 	void getPlaceHolderList()const
 	{
 
-		fprintf(mFile,"\"%s.phl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".phl\"");
 	}
 	void getMultiParentList(size_t mpl_i)const
 	{
-		fprintf(mFile,"\"%s.mpl[%i]\"",mName.c_str(),mpl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".mpl[",mpl_i,"]\"");
 	}
 	void getMultiParentList()const
 	{
 
-		fprintf(mFile,"\"%s.mpl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpl\"");
 	}
 	void getMultiParent(size_t mpl_i,size_t mp_i)const
 	{
-		fprintf(mFile,"\"%s.mpl[%i].mp[%i]\"",mName.c_str(),mpl_i,mp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".mpl[",mpl_i); writeInt(mFile,"].mp[",mp_i,"]\"");
 	}
 	void getMultiParent(size_t mp_i)const
 	{
 
-		fprintf(mFile,"\"%s.mpl.mp[%i]\"",mName.c_str(),mp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".mpl.mp[",mp_i,"]\"");
 	}
 	void getEdits()const
 	{
-		fprintf(mFile,"\"%s.ed\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ed\"");
 	}
 	void getProxyTag()const
 	{
-		fprintf(mFile,"\"%s.ptag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ptag\"");
 	}
 	void getProxyMsg()const
 	{
-		fprintf(mFile,"\"%s.pmsg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pmsg\"");
 	}
 	void getUnknownReference()const
 	{
-		fprintf(mFile,"\"%s.ur\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ur\"");
 	}
 	void getSharedReference()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getLocked()const
 	{
-		fprintf(mFile,"\"%s.lk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lk\"");
 	}
 protected:
 	Reference(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,119 +27,119 @@ public:
 	void setReflectionLimit(short fll)
 	{
 		if(fll == 1) return;
-		fprintf(mFile,"\tsetAttr \".fll\" %i;\n", fll);
+		writeInt(mFile,"\tsetAttr \".fll\" ",fll,";\n");
 	}
 	void setSpecularColor(const float3& sc)
 	{
-		fprintf(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpecularColorR(float sr)
 	{
 		if(sr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sc.sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sc.sr\" ",sr,";\n");
 	}
 	void setSpecularColorG(float sg)
 	{
 		if(sg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sc.sg\" %f;\n", sg);
+		writeFloat(mFile,"\tsetAttr \".sc.sg\" ",sg,";\n");
 	}
 	void setSpecularColorB(float sb)
 	{
 		if(sb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sc.sb\" %f;\n", sb);
+		writeFloat(mFile,"\tsetAttr \".sc.sb\" ",sb,";\n");
 	}
 	void setReflectivity(float rfl)
 	{
 		if(rfl == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".rfl\" %f;\n", rfl);
+		writeFloat(mFile,"\tsetAttr \".rfl\" ",rfl,";\n");
 	}
 	void setReflectedColor(const float3& rc)
 	{
-		fprintf(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".rc\" -type \"float3\" ");
 		rc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setReflectedColorR(float rr)
 	{
 		if(rr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rr\" %f;\n", rr);
+		writeFloat(mFile,"\tsetAttr \".rc.rr\" ",rr,";\n");
 	}
 	void setReflectedColorG(float rg)
 	{
 		if(rg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rg\" %f;\n", rg);
+		writeFloat(mFile,"\tsetAttr \".rc.rg\" ",rg,";\n");
 	}
 	void setReflectedColorB(float rb)
 	{
 		if(rb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rb\" %f;\n", rb);
+		writeFloat(mFile,"\tsetAttr \".rc.rb\" ",rb,";\n");
 	}
 	void setReflectionSpecularity(float rsp)
 	{
 		if(rsp == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rsp\" %f;\n", rsp);
+		writeFloat(mFile,"\tsetAttr \".rsp\" ",rsp,";\n");
 	}
 	void getReflectionLimit()const
 	{
-		fprintf(mFile,"\"%s.fll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fll\"");
 	}
 	void getSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.sc.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sr\"");
 	}
 	void getSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.sc.sg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sg\"");
 	}
 	void getSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.sc.sb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sb\"");
 	}
 	void getReflectivity()const
 	{
-		fprintf(mFile,"\"%s.rfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfl\"");
 	}
 	void getReflectedColor()const
 	{
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getReflectedColorR()const
 	{
-		fprintf(mFile,"\"%s.rc.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rr\"");
 	}
 	void getReflectedColorG()const
 	{
-		fprintf(mFile,"\"%s.rc.rg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rg\"");
 	}
 	void getReflectedColorB()const
 	{
-		fprintf(mFile,"\"%s.rc.rb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rb\"");
 	}
 	void getTriangleNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.tnc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc\"");
 	}
 	void getTriangleNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.tnc.tnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tnx\"");
 	}
 	void getTriangleNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.tnc.tny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tny\"");
 	}
 	void getTriangleNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.tnc.tnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tnc.tnz\"");
 	}
 	void getReflectionSpecularity()const
 	{
-		fprintf(mFile,"\"%s.rsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsp\"");
 	}
 protected:
 	Reflect(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
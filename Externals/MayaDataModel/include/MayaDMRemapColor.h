@@ -23,9 +23,9 @@ public:
 		unsigned int red_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", red_Position);
-			fprintf(file,"%f ", red_FloatValue);
-			fprintf(file,"%i", red_Interp);
+			writeFloat(file,"",red_Position," ");
+			writeFloat(file,"",red_FloatValue," ");
+			writeInt(file,"",red_Interp);
 		}
 	};
 	struct Green{
@@ -34,9 +34,9 @@ public:
 		unsigned int green_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", green_Position);
-			fprintf(file,"%f ", green_FloatValue);
-			fprintf(file,"%i", green_Interp);
+			writeFloat(file,"",green_Position," ");
+			writeFloat(file,"",green_FloatValue," ");
+			writeInt(file,"",green_Interp);
 		}
 	};
 	struct Blue{
@@ -45,9 +45,9 @@ public:
 		unsigned int blue_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", blue_Position);
-			fprintf(file,"%f ", blue_FloatValue);
-			fprintf(file,"%i", blue_Interp);
+			writeFloat(file,"",blue_Position," ");
+			writeFloat(file,"",blue_FloatValue," ");
+			writeInt(file,"",blue_Interp);
 		}
 	};
 public:
@@ -59,338 +59,338 @@ public:
 
 	void setColor(const float3& cl)
 	{
-		fprintf(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
 		cl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".cl.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".cl.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".cl.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".cl.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".cl.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".cl.cb\" ",cb,";\n");
 	}
 	void setInputMin(float imn)
 	{
 		if(imn == 0) return;
-		fprintf(mFile,"\tsetAttr \".imn\" %f;\n", imn);
+		writeFloat(mFile,"\tsetAttr \".imn\" ",imn,";\n");
 	}
 	void setInputMax(float imx)
 	{
 		if(imx == 1) return;
-		fprintf(mFile,"\tsetAttr \".imx\" %f;\n", imx);
+		writeFloat(mFile,"\tsetAttr \".imx\" ",imx,";\n");
 	}
 	void setOutputMin(float omn)
 	{
 		if(omn == 0) return;
-		fprintf(mFile,"\tsetAttr \".omn\" %f;\n", omn);
+		writeFloat(mFile,"\tsetAttr \".omn\" ",omn,";\n");
 	}
 	void setOutputMax(float omx)
 	{
 		if(omx == 1) return;
-		fprintf(mFile,"\tsetAttr \".omx\" %f;\n", omx);
+		writeFloat(mFile,"\tsetAttr \".omx\" ",omx,";\n");
 	}
 	void setRed(size_t r_i,const Red& r)
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i]\" ",r_i);
+		writeInt(mFile,"\tsetAttr \".r[",r_i,"]\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRed(size_t r_start,size_t r_end,Red* r)
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i:%i]\" ", r_start,r_end);
+		writeInt(mFile,"\tsetAttr \".r[",r_start); writeInt(mFile,":",r_end,"]\" ");
 		size_t size = (r_end-r_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			r[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startRed(size_t r_start,size_t r_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i:%i]\"",r_start,r_end);
-		fprintf(mFile," -type \"Red\" ");
+		writeInt(mFile,"\tsetAttr \".r[",r_start); writeInt(mFile,":",r_end,"]\"");
+		writeString(mFile," -type \"Red\" ");
 	}
 	void appendRed(const Red& r)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		r.write(mFile);
 	}
 	void endRed()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRed_Position(size_t r_i,float rp)
 	{
 		if(rp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].rp\" %f;\n", r_i,rp);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeFloat(mFile,"].rp\" ",rp,";\n");
 	}
 	void setRed_FloatValue(size_t r_i,float rfv)
 	{
 		if(rfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].rfv\" %f;\n", r_i,rfv);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeFloat(mFile,"].rfv\" ",rfv,";\n");
 	}
 	void setRed_Interp(size_t r_i,unsigned int ri)
 	{
 		if(ri == 0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].ri\" %i;\n", r_i,ri);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeInt(mFile,"].ri\" ",ri,";\n");
 	}
 	void setGreen(size_t g_i,const Green& g)
 	{
-		fprintf(mFile,"\tsetAttr \".g[%i]\" ",g_i);
+		writeInt(mFile,"\tsetAttr \".g[",g_i,"]\" ");
 		g.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGreen(size_t g_start,size_t g_end,Green* g)
 	{
-		fprintf(mFile,"\tsetAttr \".g[%i:%i]\" ", g_start,g_end);
+		writeInt(mFile,"\tsetAttr \".g[",g_start); writeInt(mFile,":",g_end,"]\" ");
 		size_t size = (g_end-g_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			g[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGreen(size_t g_start,size_t g_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".g[%i:%i]\"",g_start,g_end);
-		fprintf(mFile," -type \"Green\" ");
+		writeInt(mFile,"\tsetAttr \".g[",g_start); writeInt(mFile,":",g_end,"]\"");
+		writeString(mFile," -type \"Green\" ");
 	}
 	void appendGreen(const Green& g)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		g.write(mFile);
 	}
 	void endGreen()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGreen_Position(size_t g_i,float gp)
 	{
 		if(gp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g[%i].gp\" %f;\n", g_i,gp);
+		writeInt(mFile,"\tsetAttr \".g[",g_i); writeFloat(mFile,"].gp\" ",gp,";\n");
 	}
 	void setGreen_FloatValue(size_t g_i,float gfv)
 	{
 		if(gfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g[%i].gfv\" %f;\n", g_i,gfv);
+		writeInt(mFile,"\tsetAttr \".g[",g_i); writeFloat(mFile,"].gfv\" ",gfv,";\n");
 	}
 	void setGreen_Interp(size_t g_i,unsigned int gi)
 	{
 		if(gi == 0) return;
-		fprintf(mFile,"\tsetAttr \".g[%i].gi\" %i;\n", g_i,gi);
+		writeInt(mFile,"\tsetAttr \".g[",g_i); writeInt(mFile,"].gi\" ",gi,";\n");
 	}
 	void setBlue(size_t b_i,const Blue& b)
 	{
-		fprintf(mFile,"\tsetAttr \".b[%i]\" ",b_i);
+		writeInt(mFile,"\tsetAttr \".b[",b_i,"]\" ");
 		b.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBlue(size_t b_start,size_t b_end,Blue* b)
 	{
-		fprintf(mFile,"\tsetAttr \".b[%i:%i]\" ", b_start,b_end);
+		writeInt(mFile,"\tsetAttr \".b[",b_start); writeInt(mFile,":",b_end,"]\" ");
 		size_t size = (b_end-b_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			b[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBlue(size_t b_start,size_t b_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".b[%i:%i]\"",b_start,b_end);
-		fprintf(mFile," -type \"Blue\" ");
+		writeInt(mFile,"\tsetAttr \".b[",b_start); writeInt(mFile,":",b_end,"]\"");
+		writeString(mFile," -type \"Blue\" ");
 	}
 	void appendBlue(const Blue& b)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		b.write(mFile);
 	}
 	void endBlue()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBlue_Position(size_t b_i,float bp)
 	{
 		if(bp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".b[%i].bp\" %f;\n", b_i,bp);
+		writeInt(mFile,"\tsetAttr \".b[",b_i); writeFloat(mFile,"].bp\" ",bp,";\n");
 	}
 	void setBlue_FloatValue(size_t b_i,float bfv)
 	{
 		if(bfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".b[%i].bfv\" %f;\n", b_i,bfv);
+		writeInt(mFile,"\tsetAttr \".b[",b_i); writeFloat(mFile,"].bfv\" ",bfv,";\n");
 	}
 	void setBlue_Interp(size_t b_i,unsigned int bi)
 	{
 		if(bi == 0) return;
-		fprintf(mFile,"\tsetAttr \".b[%i].bi\" %i;\n", b_i,bi);
+		writeInt(mFile,"\tsetAttr \".b[",b_i); writeInt(mFile,"].bi\" ",bi,";\n");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.cl.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.cl.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.cl.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cb\"");
 	}
 	void getInputMin()const
 	{
-		fprintf(mFile,"\"%s.imn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imn\"");
 	}
 	void getInputMax()const
 	{
-		fprintf(mFile,"\"%s.imx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imx\"");
 	}
 	void getOutputMin()const
 	{
-		fprintf(mFile,"\"%s.omn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omn\"");
 	}
 	void getOutputMax()const
 	{
-		fprintf(mFile,"\"%s.omx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omx\"");
 	}
 	void getRed(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i]\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"]\"");
 	}
 	void getRed()const
 	{
 
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRed_Position(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].rp\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].rp\"");
 	}
 	void getRed_Position()const
 	{
 
-		fprintf(mFile,"\"%s.r.rp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rp\"");
 	}
 	void getRed_FloatValue(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].rfv\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].rfv\"");
 	}
 	void getRed_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.r.rfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rfv\"");
 	}
 	void getRed_Interp(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].ri\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].ri\"");
 	}
 	void getRed_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.r.ri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ri\"");
 	}
 	void getGreen(size_t g_i)const
 	{
-		fprintf(mFile,"\"%s.g[%i]\"",mName.c_str(),g_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".g[",g_i,"]\"");
 	}
 	void getGreen()const
 	{
 
-		fprintf(mFile,"\"%s.g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g\"");
 	}
 	void getGreen_Position(size_t g_i)const
 	{
-		fprintf(mFile,"\"%s.g[%i].gp\"",mName.c_str(),g_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".g[",g_i,"].gp\"");
 	}
 	void getGreen_Position()const
 	{
 
-		fprintf(mFile,"\"%s.g.gp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gp\"");
 	}
 	void getGreen_FloatValue(size_t g_i)const
 	{
-		fprintf(mFile,"\"%s.g[%i].gfv\"",mName.c_str(),g_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".g[",g_i,"].gfv\"");
 	}
 	void getGreen_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.g.gfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gfv\"");
 	}
 	void getGreen_Interp(size_t g_i)const
 	{
-		fprintf(mFile,"\"%s.g[%i].gi\"",mName.c_str(),g_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".g[",g_i,"].gi\"");
 	}
 	void getGreen_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.g.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gi\"");
 	}
 	void getBlue(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i]\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"]\"");
 	}
 	void getBlue()const
 	{
 
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getBlue_Position(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i].bp\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"].bp\"");
 	}
 	void getBlue_Position()const
 	{
 
-		fprintf(mFile,"\"%s.b.bp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.bp\"");
 	}
 	void getBlue_FloatValue(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i].bfv\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"].bfv\"");
 	}
 	void getBlue_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.b.bfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.bfv\"");
 	}
 	void getBlue_Interp(size_t b_i)const
 	{
-		fprintf(mFile,"\"%s.b[%i].bi\"",mName.c_str(),b_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".b[",b_i,"].bi\"");
 	}
 	void getBlue_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.b.bi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b.bi\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 protected:
 	RemapColor(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		unsigned int value_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", value_Position);
-			fprintf(file,"%f ", value_FloatValue);
-			fprintf(file,"%i", value_Interp);
+			writeFloat(file,"",value_Position," ");
+			writeFloat(file,"",value_FloatValue," ");
+			writeInt(file,"",value_Interp);
 		}
 	};
 	struct Color{
@@ -34,10 +34,10 @@ public:
 		unsigned int color_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", color_Position);
+			writeFloat(file,"",color_Position," ");
 			color_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", color_Interp);
+			writeString(file," ");
+			writeInt(file,"",color_Interp);
 		}
 	};
 public:
@@ -50,274 +50,274 @@ public:
 	void setInputValue(float i_)
 	{
 		if(i_ == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i\" %f;\n", i_);
+		writeFloat(mFile,"\tsetAttr \".i\" ",i_,";\n");
 	}
 	void setInputMin(float imn)
 	{
 		if(imn == 0) return;
-		fprintf(mFile,"\tsetAttr \".imn\" %f;\n", imn);
+		writeFloat(mFile,"\tsetAttr \".imn\" ",imn,";\n");
 	}
 	void setInputMax(float imx)
 	{
 		if(imx == 1) return;
-		fprintf(mFile,"\tsetAttr \".imx\" %f;\n", imx);
+		writeFloat(mFile,"\tsetAttr \".imx\" ",imx,";\n");
 	}
 	void setOutputMin(float omn)
 	{
 		if(omn == 0) return;
-		fprintf(mFile,"\tsetAttr \".omn\" %f;\n", omn);
+		writeFloat(mFile,"\tsetAttr \".omn\" ",omn,";\n");
 	}
 	void setOutputMax(float omx)
 	{
 		if(omx == 1) return;
-		fprintf(mFile,"\tsetAttr \".omx\" %f;\n", omx);
+		writeFloat(mFile,"\tsetAttr \".omx\" ",omx,";\n");
 	}
 	void setValue(size_t vl_i,const Value& vl)
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i]\" ",vl_i);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i,"]\" ");
 		vl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setValue(size_t vl_start,size_t vl_end,Value* vl)
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i:%i]\" ", vl_start,vl_end);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_start); writeInt(mFile,":",vl_end,"]\" ");
 		size_t size = (vl_end-vl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startValue(size_t vl_start,size_t vl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i:%i]\"",vl_start,vl_end);
-		fprintf(mFile," -type \"Value\" ");
+		writeInt(mFile,"\tsetAttr \".vl[",vl_start); writeInt(mFile,":",vl_end,"]\"");
+		writeString(mFile," -type \"Value\" ");
 	}
 	void appendValue(const Value& vl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vl.write(mFile);
 	}
 	void endValue()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setValue_Position(size_t vl_i,float vlp)
 	{
 		if(vlp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vl[%i].vlp\" %f;\n", vl_i,vlp);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeFloat(mFile,"].vlp\" ",vlp,";\n");
 	}
 	void setValue_FloatValue(size_t vl_i,float vlfv)
 	{
 		if(vlfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vl[%i].vlfv\" %f;\n", vl_i,vlfv);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeFloat(mFile,"].vlfv\" ",vlfv,";\n");
 	}
 	void setValue_Interp(size_t vl_i,unsigned int vli)
 	{
 		if(vli == 0) return;
-		fprintf(mFile,"\tsetAttr \".vl[%i].vli\" %i;\n", vl_i,vli);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeInt(mFile,"].vli\" ",vli,";\n");
 	}
 	void setColor(size_t cl_i,const Color& cl)
 	{
-		fprintf(mFile,"\tsetAttr \".cl[%i]\" ",cl_i);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i,"]\" ");
 		cl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor(size_t cl_start,size_t cl_end,Color* cl)
 	{
-		fprintf(mFile,"\tsetAttr \".cl[%i:%i]\" ", cl_start,cl_end);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_start); writeInt(mFile,":",cl_end,"]\" ");
 		size_t size = (cl_end-cl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColor(size_t cl_start,size_t cl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cl[%i:%i]\"",cl_start,cl_end);
-		fprintf(mFile," -type \"Color\" ");
+		writeInt(mFile,"\tsetAttr \".cl[",cl_start); writeInt(mFile,":",cl_end,"]\"");
+		writeString(mFile," -type \"Color\" ");
 	}
 	void appendColor(const Color& cl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cl.write(mFile);
 	}
 	void endColor()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor_Position(size_t cl_i,float clp)
 	{
 		if(clp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].clp\" %f;\n", cl_i,clp);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeFloat(mFile,"].clp\" ",clp,";\n");
 	}
 	void setColor_Color(size_t cl_i,const float3& clc)
 	{
-		fprintf(mFile,"\tsetAttr \".cl[%i].clc\" -type \"float3\" ",cl_i);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i,"].clc\" -type \"float3\" ");
 		clc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColor_ColorR(size_t cl_i,float clcr)
 	{
 		if(clcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].clc.clcr\" %f;\n", cl_i,clcr);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeFloat(mFile,"].clc.clcr\" ",clcr,";\n");
 	}
 	void setColor_ColorG(size_t cl_i,float clcg)
 	{
 		if(clcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].clc.clcg\" %f;\n", cl_i,clcg);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeFloat(mFile,"].clc.clcg\" ",clcg,";\n");
 	}
 	void setColor_ColorB(size_t cl_i,float clcb)
 	{
 		if(clcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].clc.clcb\" %f;\n", cl_i,clcb);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeFloat(mFile,"].clc.clcb\" ",clcb,";\n");
 	}
 	void setColor_Interp(size_t cl_i,unsigned int cli)
 	{
 		if(cli == 0) return;
-		fprintf(mFile,"\tsetAttr \".cl[%i].cli\" %i;\n", cl_i,cli);
+		writeInt(mFile,"\tsetAttr \".cl[",cl_i); writeInt(mFile,"].cli\" ",cli,";\n");
 	}
 	void getInputValue()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInputMin()const
 	{
-		fprintf(mFile,"\"%s.imn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imn\"");
 	}
 	void getInputMax()const
 	{
-		fprintf(mFile,"\"%s.imx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imx\"");
 	}
 	void getOutputMin()const
 	{
-		fprintf(mFile,"\"%s.omn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omn\"");
 	}
 	void getOutputMax()const
 	{
-		fprintf(mFile,"\"%s.omx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omx\"");
 	}
 	void getValue(size_t vl_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i]\"",mName.c_str(),vl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i,"]\"");
 	}
 	void getValue()const
 	{
 
-		fprintf(mFile,"\"%s.vl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl\"");
 	}
 	void getValue_Position(size_t vl_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i].vlp\"",mName.c_str(),vl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i,"].vlp\"");
 	}
 	void getValue_Position()const
 	{
 
-		fprintf(mFile,"\"%s.vl.vlp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl.vlp\"");
 	}
 	void getValue_FloatValue(size_t vl_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i].vlfv\"",mName.c_str(),vl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i,"].vlfv\"");
 	}
 	void getValue_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.vl.vlfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl.vlfv\"");
 	}
 	void getValue_Interp(size_t vl_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i].vli\"",mName.c_str(),vl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i,"].vli\"");
 	}
 	void getValue_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.vl.vli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl.vli\"");
 	}
 	void getColor(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i]\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"]\"");
 	}
 	void getColor()const
 	{
 
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getColor_Position(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clp\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clp\"");
 	}
 	void getColor_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clp\"");
 	}
 	void getColor_Color(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clc\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clc\"");
 	}
 	void getColor_Color()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clc\"");
 	}
 	void getColor_ColorR(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clc.clcr\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clc.clcr\"");
 	}
 	void getColor_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clc.clcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clc.clcr\"");
 	}
 	void getColor_ColorG(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clc.clcg\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clc.clcg\"");
 	}
 	void getColor_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clc.clcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clc.clcg\"");
 	}
 	void getColor_ColorB(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].clc.clcb\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].clc.clcb\"");
 	}
 	void getColor_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.cl.clc.clcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.clc.clcb\"");
 	}
 	void getColor_Interp(size_t cl_i)const
 	{
-		fprintf(mFile,"\"%s.cl[%i].cli\"",mName.c_str(),cl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cl[",cl_i,"].cli\"");
 	}
 	void getColor_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cl.cli\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cli\"");
 	}
 	void getOutValue()const
 	{
-		fprintf(mFile,"\"%s.ov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 protected:
 	RemapValue(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,804 +27,804 @@ public:
 	void setMacCodec(int macc)
 	{
 		if(macc == 1919706400) return;
-		fprintf(mFile,"\tsetAttr \".macc\" %i;\n", macc);
+		writeInt(mFile,"\tsetAttr \".macc\" ",macc,";\n");
 	}
 	void setMacDepth(int macd)
 	{
 		if(macd == 32) return;
-		fprintf(mFile,"\tsetAttr \".macd\" %i;\n", macd);
+		writeInt(mFile,"\tsetAttr \".macd\" ",macd,";\n");
 	}
 	void setMacQual(int macq)
 	{
 		if(macq == 1024) return;
-		fprintf(mFile,"\tsetAttr \".macq\" %i;\n", macq);
+		writeInt(mFile,"\tsetAttr \".macq\" ",macq,";\n");
 	}
 	void setComFrrt(int mcfr)
 	{
 		if(mcfr == 24) return;
-		fprintf(mFile,"\tsetAttr \".mcfr\" %i;\n", mcfr);
+		writeInt(mFile,"\tsetAttr \".mcfr\" ",mcfr,";\n");
 	}
 	void setIgnoreFilmGate(bool ifg)
 	{
 		if(ifg == true) return;
-		fprintf(mFile,"\tsetAttr \".ifg\" %i;\n", ifg);
+		writeInt(mFile,"\tsetAttr \".ifg\" ",ifg,";\n");
 	}
 	void setClipFinalShadedColor(bool clip)
 	{
 		if(clip == true) return;
-		fprintf(mFile,"\tsetAttr \".clip\" %i;\n", clip);
+		writeInt(mFile,"\tsetAttr \".clip\" ",clip,";\n");
 	}
 	void setEnableDepthMaps(bool edm)
 	{
 		if(edm == true) return;
-		fprintf(mFile,"\tsetAttr \".edm\" %i;\n", edm);
+		writeInt(mFile,"\tsetAttr \".edm\" ",edm,";\n");
 	}
 	void setEnableDefaultLight(bool edl)
 	{
 		if(edl == true) return;
-		fprintf(mFile,"\tsetAttr \".edl\" %i;\n", edl);
+		writeInt(mFile,"\tsetAttr \".edl\" ",edl,";\n");
 	}
 	void setCurrentRenderer(const string& ren)
 	{
 		if(ren == "mayaSoftware") return;
-		fprintf(mFile,"\tsetAttr \".ren\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ren\" -type \"string\" ");
 		ren.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEnableStrokeRender(bool esr)
 	{
 		if(esr == true) return;
-		fprintf(mFile,"\tsetAttr \".esr\" %i;\n", esr);
+		writeInt(mFile,"\tsetAttr \".esr\" ",esr,";\n");
 	}
 	void setOnlyRenderStrokes(bool ors)
 	{
 		if(ors == false) return;
-		fprintf(mFile,"\tsetAttr \".ors\" %i;\n", ors);
+		writeInt(mFile,"\tsetAttr \".ors\" ",ors,";\n");
 	}
 	void setStrokesDepthFile(const string& sdf)
 	{
 		if(sdf == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".sdf\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".sdf\" -type \"string\" ");
 		sdf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageFormat(unsigned int outf)
 	{
 		if(outf == 7) return;
-		fprintf(mFile,"\tsetAttr \".outf\" %i;\n", outf);
+		writeInt(mFile,"\tsetAttr \".outf\" ",outf,";\n");
 	}
 	void setImfPluginKey(const string& imfkey)
 	{
 		if(imfkey == "") return;
-		fprintf(mFile,"\tsetAttr \".imfkey\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".imfkey\" -type \"string\" ");
 		imfkey.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGammaCorrection(float gama)
 	{
 		if(gama == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gama\" %f;\n", gama);
+		writeFloat(mFile,"\tsetAttr \".gama\" ",gama,";\n");
 	}
 	void setAnimation(bool an)
 	{
 		if(an == false) return;
-		fprintf(mFile,"\tsetAttr \".an\" %i;\n", an);
+		writeInt(mFile,"\tsetAttr \".an\" ",an,";\n");
 	}
 	void setAnimationRange(unsigned int ar)
 	{
 		if(ar == 1) return;
-		fprintf(mFile,"\tsetAttr \".ar\" %i;\n", ar);
+		writeInt(mFile,"\tsetAttr \".ar\" ",ar,";\n");
 	}
 	void setStartFrame(double fs)
 	{
 		if(fs == 1) return;
-		fprintf(mFile,"\tsetAttr \".fs\" %f;\n", fs);
+		writeFloat(mFile,"\tsetAttr \".fs\" ",fs,";\n");
 	}
 	void setEndFrame(double ef)
 	{
 		if(ef == 1) return;
-		fprintf(mFile,"\tsetAttr \".ef\" %f;\n", ef);
+		writeFloat(mFile,"\tsetAttr \".ef\" ",ef,";\n");
 	}
 	void setByFrameStep(float bfs)
 	{
 		if(bfs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bfs\" %f;\n", bfs);
+		writeFloat(mFile,"\tsetAttr \".bfs\" ",bfs,";\n");
 	}
 	void setModifyExtension(bool me)
 	{
 		if(me == false) return;
-		fprintf(mFile,"\tsetAttr \".me\" %i;\n", me);
+		writeInt(mFile,"\tsetAttr \".me\" ",me,";\n");
 	}
 	void setStartExtension(float se)
 	{
 		if(se == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".se\" %f;\n", se);
+		writeFloat(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setByExtension(float be)
 	{
 		if(be == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".be\" %f;\n", be);
+		writeFloat(mFile,"\tsetAttr \".be\" ",be,";\n");
 	}
 	void setExtensionPadding(int ep)
 	{
 		if(ep == 1) return;
-		fprintf(mFile,"\tsetAttr \".ep\" %i;\n", ep);
+		writeInt(mFile,"\tsetAttr \".ep\" ",ep,";\n");
 	}
 	void setFieldExtControl(unsigned int fec)
 	{
 		if(fec == 0) return;
-		fprintf(mFile,"\tsetAttr \".fec\" %i;\n", fec);
+		writeInt(mFile,"\tsetAttr \".fec\" ",fec,";\n");
 	}
 	void setOutFormatControl(unsigned int ofc)
 	{
 		if(ofc == 0) return;
-		fprintf(mFile,"\tsetAttr \".ofc\" %i;\n", ofc);
+		writeInt(mFile,"\tsetAttr \".ofc\" ",ofc,";\n");
 	}
 	void setOddFieldExt(const string& ofe)
 	{
 		if(ofe == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ofe\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ofe\" -type \"string\" ");
 		ofe.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEvenFieldExt(const string& efe)
 	{
 		if(efe == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".efe\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".efe\" -type \"string\" ");
 		efe.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutFormatExt(const string& oft)
 	{
 		if(oft == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".oft\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".oft\" -type \"string\" ");
 		oft.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseMayaFileName(bool umfn)
 	{
 		if(umfn == true) return;
-		fprintf(mFile,"\tsetAttr \".umfn\" %i;\n", umfn);
+		writeInt(mFile,"\tsetAttr \".umfn\" ",umfn,";\n");
 	}
 	void setUseFrameExt(bool ufe)
 	{
 		if(ufe == false) return;
-		fprintf(mFile,"\tsetAttr \".ufe\" %i;\n", ufe);
+		writeInt(mFile,"\tsetAttr \".ufe\" ",ufe,";\n");
 	}
 	void setPutFrameBeforeExt(bool pff)
 	{
 		if(pff == false) return;
-		fprintf(mFile,"\tsetAttr \".pff\" %i;\n", pff);
+		writeInt(mFile,"\tsetAttr \".pff\" ",pff,";\n");
 	}
 	void setPeriodInExt(unsigned int peie)
 	{
 		if(peie == 1) return;
-		fprintf(mFile,"\tsetAttr \".peie\" %i;\n", peie);
+		writeInt(mFile,"\tsetAttr \".peie\" ",peie,";\n");
 	}
 	void setImageFilePrefix(const string& ifp)
 	{
 		if(ifp == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".ifp\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".ifp\" -type \"string\" ");
 		ifp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRenderVersion(const string& rv)
 	{
 		if(rv == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".rv\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rv\" -type \"string\" ");
 		rv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setComposite(bool comp)
 	{
 		if(comp == false) return;
-		fprintf(mFile,"\tsetAttr \".comp\" %i;\n", comp);
+		writeInt(mFile,"\tsetAttr \".comp\" ",comp,";\n");
 	}
 	void setCompositeThreshold(float cth)
 	{
 		if(cth == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cth\" %f;\n", cth);
+		writeFloat(mFile,"\tsetAttr \".cth\" ",cth,";\n");
 	}
 	void setShadowsObeyLightLinking(bool soll)
 	{
 		if(soll == true) return;
-		fprintf(mFile,"\tsetAttr \".soll\" %i;\n", soll);
+		writeInt(mFile,"\tsetAttr \".soll\" ",soll,";\n");
 	}
 	void setShadowsObeyShadowLinking(bool sosl)
 	{
 		if(sosl == false) return;
-		fprintf(mFile,"\tsetAttr \".sosl\" %i;\n", sosl);
+		writeInt(mFile,"\tsetAttr \".sosl\" ",sosl,";\n");
 	}
 	void setRecursionDepth(int rd)
 	{
 		if(rd == 2) return;
-		fprintf(mFile,"\tsetAttr \".rd\" %i;\n", rd);
+		writeInt(mFile,"\tsetAttr \".rd\" ",rd,";\n");
 	}
 	void setLeafPrimitives(int lp)
 	{
 		if(lp == 200) return;
-		fprintf(mFile,"\tsetAttr \".lp\" %i;\n", lp);
+		writeInt(mFile,"\tsetAttr \".lp\" ",lp,";\n");
 	}
 	void setSubdivisionPower(float sp)
 	{
 		if(sp == 0.25) return;
-		fprintf(mFile,"\tsetAttr \".sp\" %f;\n", sp);
+		writeFloat(mFile,"\tsetAttr \".sp\" ",sp,";\n");
 	}
 	void setSubdivisionHashSize(int shs)
 	{
 		if(shs == 5) return;
-		fprintf(mFile,"\tsetAttr \".shs\" %i;\n", shs);
+		writeInt(mFile,"\tsetAttr \".shs\" ",shs,";\n");
 	}
 	void setLogRenderPerformance(bool lpr)
 	{
 		if(lpr == false) return;
-		fprintf(mFile,"\tsetAttr \".lpr\" %i;\n", lpr);
+		writeInt(mFile,"\tsetAttr \".lpr\" ",lpr,";\n");
 	}
 	void setGeometryVector(int gv)
 	{
 		if(gv == 20) return;
-		fprintf(mFile,"\tsetAttr \".gv\" %i;\n", gv);
+		writeInt(mFile,"\tsetAttr \".gv\" ",gv,";\n");
 	}
 	void setShadingVector(int sv)
 	{
 		if(sv == 60) return;
-		fprintf(mFile,"\tsetAttr \".sv\" %i;\n", sv);
+		writeInt(mFile,"\tsetAttr \".sv\" ",sv,";\n");
 	}
 	void setMaximumMemory(int mm)
 	{
 		if(mm == 48) return;
-		fprintf(mFile,"\tsetAttr \".mm\" %i;\n", mm);
+		writeInt(mFile,"\tsetAttr \".mm\" ",mm,";\n");
 	}
 	void setNumCpusToUse(int npu)
 	{
 		if(npu == 0) return;
-		fprintf(mFile,"\tsetAttr \".npu\" %i;\n", npu);
+		writeInt(mFile,"\tsetAttr \".npu\" ",npu,";\n");
 	}
 	void setInterruptFrequency(int itf)
 	{
 		if(itf == 1) return;
-		fprintf(mFile,"\tsetAttr \".itf\" %i;\n", itf);
+		writeInt(mFile,"\tsetAttr \".itf\" ",itf,";\n");
 	}
 	void setShadowPass(bool shp)
 	{
 		if(shp == false) return;
-		fprintf(mFile,"\tsetAttr \".shp\" %i;\n", shp);
+		writeInt(mFile,"\tsetAttr \".shp\" ",shp,";\n");
 	}
 	void setIprShadowPass(bool isp)
 	{
 		if(isp == false) return;
-		fprintf(mFile,"\tsetAttr \".isp\" %i;\n", isp);
+		writeInt(mFile,"\tsetAttr \".isp\" ",isp,";\n");
 	}
 	void setUseFileCache(bool uf)
 	{
 		if(uf == true) return;
-		fprintf(mFile,"\tsetAttr \".uf\" %i;\n", uf);
+		writeInt(mFile,"\tsetAttr \".uf\" ",uf,";\n");
 	}
 	void setOptimizeInstances(bool oi)
 	{
 		if(oi == true) return;
-		fprintf(mFile,"\tsetAttr \".oi\" %i;\n", oi);
+		writeInt(mFile,"\tsetAttr \".oi\" ",oi,";\n");
 	}
 	void setReuseTessellations(bool rut)
 	{
 		if(rut == true) return;
-		fprintf(mFile,"\tsetAttr \".rut\" %i;\n", rut);
+		writeInt(mFile,"\tsetAttr \".rut\" ",rut,";\n");
 	}
 	void setMatteOpacityUsesTransparency(bool mot)
 	{
 		if(mot == true) return;
-		fprintf(mFile,"\tsetAttr \".mot\" %i;\n", mot);
+		writeInt(mFile,"\tsetAttr \".mot\" ",mot,";\n");
 	}
 	void setMotionBlur(bool mb)
 	{
 		if(mb == false) return;
-		fprintf(mFile,"\tsetAttr \".mb\" %i;\n", mb);
+		writeInt(mFile,"\tsetAttr \".mb\" ",mb,";\n");
 	}
 	void setMotionBlurByFrame(float mbf)
 	{
 		if(mbf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mbf\" %f;\n", mbf);
+		writeFloat(mFile,"\tsetAttr \".mbf\" ",mbf,";\n");
 	}
 	void setApplyFogInPost(bool afp)
 	{
 		if(afp == false) return;
-		fprintf(mFile,"\tsetAttr \".afp\" %i;\n", afp);
+		writeInt(mFile,"\tsetAttr \".afp\" ",afp,";\n");
 	}
 	void setPostFogBlur(int pfb)
 	{
 		if(pfb == 1) return;
-		fprintf(mFile,"\tsetAttr \".pfb\" %i;\n", pfb);
+		writeInt(mFile,"\tsetAttr \".pfb\" ",pfb,";\n");
 	}
 	void setPreMel(const string& pram)
 	{
 		if(pram == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".pram\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".pram\" -type \"string\" ");
 		pram.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPostMel(const string& poam)
 	{
 		if(poam == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".poam\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".poam\" -type \"string\" ");
 		poam.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPreRenderLayerMel(const string& prlm)
 	{
 		if(prlm == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".prlm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".prlm\" -type \"string\" ");
 		prlm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPostRenderLayerMel(const string& polm)
 	{
 		if(polm == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".polm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".polm\" -type \"string\" ");
 		polm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPreRenderMel(const string& prm)
 	{
 		if(prm == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".prm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".prm\" -type \"string\" ");
 		prm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPostRenderMel(const string& pom)
 	{
 		if(pom == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".pom\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".pom\" -type \"string\" ");
 		pom.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPreFurRenderMel(const string& pfrm)
 	{
 		if(pfrm == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".pfrm\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".pfrm\" -type \"string\" ");
 		pfrm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPostFurRenderMel(const string& pfom)
 	{
 		if(pfom == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".pfom\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".pfom\" -type \"string\" ");
 		pfom.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBlurLength(float bll)
 	{
 		if(bll == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bll\" %f;\n", bll);
+		writeFloat(mFile,"\tsetAttr \".bll\" ",bll,";\n");
 	}
 	void setBlurSharpness(float bls)
 	{
 		if(bls == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".bls\" %f;\n", bls);
+		writeFloat(mFile,"\tsetAttr \".bls\" ",bls,";\n");
 	}
 	void setSmoothValue(int smv)
 	{
 		if(smv == 2) return;
-		fprintf(mFile,"\tsetAttr \".smv\" %i;\n", smv);
+		writeInt(mFile,"\tsetAttr \".smv\" ",smv,";\n");
 	}
 	void setUseBlur2DMemoryCap(bool ubc)
 	{
 		if(ubc == true) return;
-		fprintf(mFile,"\tsetAttr \".ubc\" %i;\n", ubc);
+		writeInt(mFile,"\tsetAttr \".ubc\" ",ubc,";\n");
 	}
 	void setBlur2DMemoryCap(float mbc)
 	{
 		if(mbc == 200.0) return;
-		fprintf(mFile,"\tsetAttr \".mbc\" %f;\n", mbc);
+		writeFloat(mFile,"\tsetAttr \".mbc\" ",mbc,";\n");
 	}
 	void setMotionBlurType(unsigned int mbt)
 	{
 		if(mbt == 1) return;
-		fprintf(mFile,"\tsetAttr \".mbt\" %i;\n", mbt);
+		writeInt(mFile,"\tsetAttr \".mbt\" ",mbt,";\n");
 	}
 	void setUseDisplacementBoundingBox(bool udbx)
 	{
 		if(udbx == true) return;
-		fprintf(mFile,"\tsetAttr \".udbx\" %i;\n", udbx);
+		writeInt(mFile,"\tsetAttr \".udbx\" ",udbx,";\n");
 	}
 	void setSmoothColor(bool smc)
 	{
 		if(smc == false) return;
-		fprintf(mFile,"\tsetAttr \".smc\" %i;\n", smc);
+		writeInt(mFile,"\tsetAttr \".smc\" ",smc,";\n");
 	}
 	void setKeepMotionVector(bool kmv)
 	{
 		if(kmv == false) return;
-		fprintf(mFile,"\tsetAttr \".kmv\" %i;\n", kmv);
+		writeInt(mFile,"\tsetAttr \".kmv\" ",kmv,";\n");
 	}
 	void setIprRenderShading(bool isl)
 	{
 		if(isl == true) return;
-		fprintf(mFile,"\tsetAttr \".isl\" %i;\n", isl);
+		writeInt(mFile,"\tsetAttr \".isl\" ",isl,";\n");
 	}
 	void setIprRenderShadowMaps(bool ism)
 	{
 		if(ism == true) return;
-		fprintf(mFile,"\tsetAttr \".ism\" %i;\n", ism);
+		writeInt(mFile,"\tsetAttr \".ism\" ",ism,";\n");
 	}
 	void setIprRenderMotionBlur(bool imb)
 	{
 		if(imb == true) return;
-		fprintf(mFile,"\tsetAttr \".imb\" %i;\n", imb);
+		writeInt(mFile,"\tsetAttr \".imb\" ",imb,";\n");
 	}
 	void setRenderLayerEnable(bool rlen)
 	{
 		if(rlen == false) return;
-		fprintf(mFile,"\tsetAttr \".rlen\" %i;\n", rlen);
+		writeInt(mFile,"\tsetAttr \".rlen\" ",rlen,";\n");
 	}
 	void setForceTileSize(bool frts)
 	{
 		if(frts == false) return;
-		fprintf(mFile,"\tsetAttr \".frts\" %i;\n", frts);
+		writeInt(mFile,"\tsetAttr \".frts\" ",frts,";\n");
 	}
 	void setTileWidth(short tlwd)
 	{
 		if(tlwd == 64) return;
-		fprintf(mFile,"\tsetAttr \".tlwd\" %i;\n", tlwd);
+		writeInt(mFile,"\tsetAttr \".tlwd\" ",tlwd,";\n");
 	}
 	void setTileHeight(short tlht)
 	{
 		if(tlht == 64) return;
-		fprintf(mFile,"\tsetAttr \".tlht\" %i;\n", tlht);
+		writeInt(mFile,"\tsetAttr \".tlht\" ",tlht,";\n");
 	}
 	void setJitterFinalColor(bool jfc)
 	{
 		if(jfc == true) return;
-		fprintf(mFile,"\tsetAttr \".jfc\" %i;\n", jfc);
+		writeInt(mFile,"\tsetAttr \".jfc\" ",jfc,";\n");
 	}
 	void setRaysSeeBackground(bool rsb)
 	{
 		if(rsb == true) return;
-		fprintf(mFile,"\tsetAttr \".rsb\" %i;\n", rsb);
+		writeInt(mFile,"\tsetAttr \".rsb\" ",rsb,";\n");
 	}
 	void setOversamplePaintEffects(bool ope)
 	{
 		if(ope == false) return;
-		fprintf(mFile,"\tsetAttr \".ope\" %i;\n", ope);
+		writeInt(mFile,"\tsetAttr \".ope\" ",ope,";\n");
 	}
 	void setOversamplePfxPostFilter(bool oppf)
 	{
 		if(oppf == false) return;
-		fprintf(mFile,"\tsetAttr \".oppf\" %i;\n", oppf);
+		writeInt(mFile,"\tsetAttr \".oppf\" ",oppf,";\n");
 	}
 	void setHyperShadeBinList(const string& hbl)
 	{
 		if(hbl == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".hbl\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".hbl\" -type \"string\" ");
 		hbl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getMacCodec()const
 	{
-		fprintf(mFile,"\"%s.macc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".macc\"");
 	}
 	void getMacDepth()const
 	{
-		fprintf(mFile,"\"%s.macd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".macd\"");
 	}
 	void getMacQual()const
 	{
-		fprintf(mFile,"\"%s.macq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".macq\"");
 	}
 	void getComFrrt()const
 	{
-		fprintf(mFile,"\"%s.mcfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mcfr\"");
 	}
 	void getRenderAll()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getQuality()const
 	{
-		fprintf(mFile,"\"%s.qual\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".qual\"");
 	}
 	void getResolution()const
 	{
-		fprintf(mFile,"\"%s.res\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".res\"");
 	}
 	void getClipFinalShadedColor()const
 	{
-		fprintf(mFile,"\"%s.clip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clip\"");
 	}
 	void getEnableDepthMaps()const
 	{
-		fprintf(mFile,"\"%s.edm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".edm\"");
 	}
 	void getEnableDefaultLight()const
 	{
-		fprintf(mFile,"\"%s.edl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".edl\"");
 	}
 	void getEnableStrokeRender()const
 	{
-		fprintf(mFile,"\"%s.esr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".esr\"");
 	}
 	void getOnlyRenderStrokes()const
 	{
-		fprintf(mFile,"\"%s.ors\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ors\"");
 	}
 	void getStrokesDepthFile()const
 	{
-		fprintf(mFile,"\"%s.sdf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sdf\"");
 	}
 	void getImageFormat()const
 	{
-		fprintf(mFile,"\"%s.outf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".outf\"");
 	}
 	void getImfPluginKey()const
 	{
-		fprintf(mFile,"\"%s.imfkey\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imfkey\"");
 	}
 	void getGammaCorrection()const
 	{
-		fprintf(mFile,"\"%s.gama\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gama\"");
 	}
 	void getTopRegion()const
 	{
-		fprintf(mFile,"\"%s.top\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".top\"");
 	}
 	void getLeftRegion()const
 	{
-		fprintf(mFile,"\"%s.left\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".left\"");
 	}
 	void getBottomRegion()const
 	{
-		fprintf(mFile,"\"%s.bot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bot\"");
 	}
 	void getRightRegion()const
 	{
-		fprintf(mFile,"\"%s.rght\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rght\"");
 	}
 	void getUseRenderRegion()const
 	{
-		fprintf(mFile,"\"%s.urr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".urr\"");
 	}
 	void getByFrame()const
 	{
-		fprintf(mFile,"\"%s.bf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bf\"");
 	}
 	void getByFrameStep()const
 	{
-		fprintf(mFile,"\"%s.bfs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bfs\"");
 	}
 	void getByExtension()const
 	{
-		fprintf(mFile,"\"%s.be\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".be\"");
 	}
 	void getFieldExtControl()const
 	{
-		fprintf(mFile,"\"%s.fec\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fec\"");
 	}
 	void getOutFormatControl()const
 	{
-		fprintf(mFile,"\"%s.ofc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofc\"");
 	}
 	void getOddFieldExt()const
 	{
-		fprintf(mFile,"\"%s.ofe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofe\"");
 	}
 	void getEvenFieldExt()const
 	{
-		fprintf(mFile,"\"%s.efe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".efe\"");
 	}
 	void getOutFormatExt()const
 	{
-		fprintf(mFile,"\"%s.oft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oft\"");
 	}
 	void getComposite()const
 	{
-		fprintf(mFile,"\"%s.comp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".comp\"");
 	}
 	void getCompositeThreshold()const
 	{
-		fprintf(mFile,"\"%s.cth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cth\"");
 	}
 	void getShadowsObeyLightLinking()const
 	{
-		fprintf(mFile,"\"%s.soll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".soll\"");
 	}
 	void getShadowsObeyShadowLinking()const
 	{
-		fprintf(mFile,"\"%s.sosl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sosl\"");
 	}
 	void getRecursionDepth()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 	void getLeafPrimitives()const
 	{
-		fprintf(mFile,"\"%s.lp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp\"");
 	}
 	void getSubdivisionPower()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getSubdivisionHashSize()const
 	{
-		fprintf(mFile,"\"%s.shs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shs\"");
 	}
 	void getLogRenderPerformance()const
 	{
-		fprintf(mFile,"\"%s.lpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lpr\"");
 	}
 	void getGeometryVector()const
 	{
-		fprintf(mFile,"\"%s.gv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gv\"");
 	}
 	void getShadingVector()const
 	{
-		fprintf(mFile,"\"%s.sv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sv\"");
 	}
 	void getMaximumMemory()const
 	{
-		fprintf(mFile,"\"%s.mm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mm\"");
 	}
 	void getNumCpusToUse()const
 	{
-		fprintf(mFile,"\"%s.npu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".npu\"");
 	}
 	void getInterruptFrequency()const
 	{
-		fprintf(mFile,"\"%s.itf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itf\"");
 	}
 	void getShadowPass()const
 	{
-		fprintf(mFile,"\"%s.shp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shp\"");
 	}
 	void getIprShadowPass()const
 	{
-		fprintf(mFile,"\"%s.isp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isp\"");
 	}
 	void getUseFileCache()const
 	{
-		fprintf(mFile,"\"%s.uf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uf\"");
 	}
 	void getOptimizeInstances()const
 	{
-		fprintf(mFile,"\"%s.oi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oi\"");
 	}
 	void getReuseTessellations()const
 	{
-		fprintf(mFile,"\"%s.rut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rut\"");
 	}
 	void getMatteOpacityUsesTransparency()const
 	{
-		fprintf(mFile,"\"%s.mot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mot\"");
 	}
 	void getMotionBlurByFrame()const
 	{
-		fprintf(mFile,"\"%s.mbf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mbf\"");
 	}
 	void getFogGeometry()const
 	{
-		fprintf(mFile,"\"%s.fg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fg\"");
 	}
 	void getApplyFogInPost()const
 	{
-		fprintf(mFile,"\"%s.afp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".afp\"");
 	}
 	void getPostFogBlur()const
 	{
-		fprintf(mFile,"\"%s.pfb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfb\"");
 	}
 	void getPreMel()const
 	{
-		fprintf(mFile,"\"%s.pram\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pram\"");
 	}
 	void getPostMel()const
 	{
-		fprintf(mFile,"\"%s.poam\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".poam\"");
 	}
 	void getPreRenderLayerMel()const
 	{
-		fprintf(mFile,"\"%s.prlm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".prlm\"");
 	}
 	void getPostRenderLayerMel()const
 	{
-		fprintf(mFile,"\"%s.polm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".polm\"");
 	}
 	void getPreRenderMel()const
 	{
-		fprintf(mFile,"\"%s.prm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".prm\"");
 	}
 	void getPostRenderMel()const
 	{
-		fprintf(mFile,"\"%s.pom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pom\"");
 	}
 	void getPreFurRenderMel()const
 	{
-		fprintf(mFile,"\"%s.pfrm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfrm\"");
 	}
 	void getPostFurRenderMel()const
 	{
-		fprintf(mFile,"\"%s.pfom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfom\"");
 	}
 	void getCreateIprFile()const
 	{
-		fprintf(mFile,"\"%s.cif\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cif\"");
 	}
 	void getBlurLength()const
 	{
-		fprintf(mFile,"\"%s.bll\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bll\"");
 	}
 	void getBlurSharpness()const
 	{
-		fprintf(mFile,"\"%s.bls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bls\"");
 	}
 	void getSmoothValue()const
 	{
-		fprintf(mFile,"\"%s.smv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smv\"");
 	}
 	void getUseBlur2DMemoryCap()const
 	{
-		fprintf(mFile,"\"%s.ubc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ubc\"");
 	}
 	void getBlur2DMemoryCap()const
 	{
-		fprintf(mFile,"\"%s.mbc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mbc\"");
 	}
 	void getUseDisplacementBoundingBox()const
 	{
-		fprintf(mFile,"\"%s.udbx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udbx\"");
 	}
 	void getSmoothColor()const
 	{
-		fprintf(mFile,"\"%s.smc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smc\"");
 	}
 	void getKeepMotionVector()const
 	{
-		fprintf(mFile,"\"%s.kmv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kmv\"");
 	}
 	void getIprRenderShading()const
 	{
-		fprintf(mFile,"\"%s.isl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isl\"");
 	}
 	void getIprRenderShadowMaps()const
 	{
-		fprintf(mFile,"\"%s.ism\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ism\"");
 	}
 	void getIprRenderMotionBlur()const
 	{
-		fprintf(mFile,"\"%s.imb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imb\"");
 	}
 	void getRendercallback()const
 	{
-		fprintf(mFile,"\"%s.rcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rcb\"");
 	}
 	void getRenderLayerEnable()const
 	{
-		fprintf(mFile,"\"%s.rlen\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlen\"");
 	}
 	void getForceTileSize()const
 	{
-		fprintf(mFile,"\"%s.frts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frts\"");
 	}
 	void getTileWidth()const
 	{
-		fprintf(mFile,"\"%s.tlwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlwd\"");
 	}
 	void getTileHeight()const
 	{
-		fprintf(mFile,"\"%s.tlht\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tlht\"");
 	}
 	void getJitterFinalColor()const
 	{
-		fprintf(mFile,"\"%s.jfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".jfc\"");
 	}
 	void getRaysSeeBackground()const
 	{
-		fprintf(mFile,"\"%s.rsb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsb\"");
 	}
 	void getOversamplePaintEffects()const
 	{
-		fprintf(mFile,"\"%s.ope\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ope\"");
 	}
 	void getOversamplePfxPostFilter()const
 	{
-		fprintf(mFile,"\"%s.oppf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oppf\"");
 	}
 protected:
 	RenderGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
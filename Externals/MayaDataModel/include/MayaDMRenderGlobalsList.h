@@ -26,30 +26,30 @@ public:
 
 	void getRenderGlobals(size_t rg_i)const
 	{
-		fprintf(mFile,"\"%s.rg[%i]\"",mName.c_str(),rg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rg[",rg_i,"]\"");
 	}
 	void getRenderGlobals()const
 	{
 
-		fprintf(mFile,"\"%s.rg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rg\"");
 	}
 	void getRenderQualities(size_t rq_i)const
 	{
-		fprintf(mFile,"\"%s.rq[%i]\"",mName.c_str(),rq_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rq[",rq_i,"]\"");
 	}
 	void getRenderQualities()const
 	{
 
-		fprintf(mFile,"\"%s.rq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rq\"");
 	}
 	void getRenderResolutions(size_t rr_i)const
 	{
-		fprintf(mFile,"\"%s.rr[%i]\"",mName.c_str(),rr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rr[",rr_i,"]\"");
 	}
 	void getRenderResolutions()const
 	{
 
-		fprintf(mFile,"\"%s.rr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rr\"");
 	}
 protected:
 	RenderGlobalsList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
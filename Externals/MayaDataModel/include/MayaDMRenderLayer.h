@@ -23,9 +23,9 @@ public:
 		unsigned char drawColor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", identification);
-			fprintf(file,"%i ", renderable);
-			fprintf(file,"%i", drawColor);
+			writeInt(file,"",identification," ");
+			writeInt(file,"",renderable," ");
+			writeInt(file,"",drawColor);
 		}
 	};
 	struct RenderPassInfo{
@@ -37,19 +37,19 @@ public:
 		bool shadow;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", beauty);
-			fprintf(file,"%i ", color);
-			fprintf(file,"%i ", ambient);
-			fprintf(file,"%i ", diffuse);
-			fprintf(file,"%i ", specular);
-			fprintf(file,"%i", shadow);
+			writeInt(file,"",beauty," ");
+			writeInt(file,"",color," ");
+			writeInt(file,"",ambient," ");
+			writeInt(file,"",diffuse," ");
+			writeInt(file,"",specular," ");
+			writeInt(file,"",shadow);
 		}
 	};
 	struct MentalRayControls{
 		bool globalIllum;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i", globalIllum);
+			writeInt(file,"",globalIllum);
 		}
 	};
 	struct Adjustments{
@@ -72,347 +72,347 @@ public:
 	void setGlobal(bool g)
 	{
 		if(g == false) return;
-		fprintf(mFile,"\tsetAttr \".g\" %i;\n", g);
+		writeInt(mFile,"\tsetAttr \".g\" ",g,";\n");
 	}
 	void setRenderInfo(const RenderInfo& ri)
 	{
-		fprintf(mFile,"\tsetAttr \".ri\" ");
+		writeString(mFile,"\tsetAttr \".ri\" ");
 		ri.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIdentification(short rlid)
 	{
 		if(rlid == 0) return;
-		fprintf(mFile,"\tsetAttr \".ri.rlid\" %i;\n", rlid);
+		writeInt(mFile,"\tsetAttr \".ri.rlid\" ",rlid,";\n");
 	}
 	void setRenderable(bool rndr)
 	{
 		if(rndr == true) return;
-		fprintf(mFile,"\tsetAttr \".ri.rndr\" %i;\n", rndr);
+		writeInt(mFile,"\tsetAttr \".ri.rndr\" ",rndr,";\n");
 	}
 	void setDrawColor(unsigned char c)
 	{
 		if(c == 0) return;
-		fprintf(mFile,"\tsetAttr \".ri.c\" %i;\n", c);
+		writeInt(mFile,"\tsetAttr \".ri.c\" ",c,";\n");
 	}
 	void setLayerParent(short rlp)
 	{
 		if(rlp == 0) return;
-		fprintf(mFile,"\tsetAttr \".rlp\" %i;\n", rlp);
+		writeInt(mFile,"\tsetAttr \".rlp\" ",rlp,";\n");
 	}
 	void setLayerChildren(size_t rlc_i,short rlc)
 	{
 		if(rlc == 0) return;
-		fprintf(mFile,"\tsetAttr \".rlc[%i]\" %i;\n", rlc_i,rlc);
+		writeInt(mFile,"\tsetAttr \".rlc[",rlc_i); writeInt(mFile,"]\" ",rlc,";\n");
 	}
 	void setLayerChildren(size_t rlc_start,size_t rlc_end,short* rlc)
 	{
-		fprintf(mFile,"\tsetAttr \".rlc[%i:%i]\" ", rlc_start,rlc_end);
+		writeInt(mFile,"\tsetAttr \".rlc[",rlc_start); writeInt(mFile,":",rlc_end,"]\" ");
 		size_t size = (rlc_end-rlc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",rlc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",rlc[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLayerChildren(size_t rlc_start,size_t rlc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".rlc[%i:%i]\"",rlc_start,rlc_end);
+		writeInt(mFile,"\tsetAttr \".rlc[",rlc_start); writeInt(mFile,":",rlc_end,"]\"");
 	}
 	void appendLayerChildren(short rlc)const
 	{
-		fprintf(mFile," %i",rlc);
+		writeInt(mFile," ",rlc);
 	}
 	void endLayerChildren()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRenderPassInfo(const RenderPassInfo& rp)
 	{
-		fprintf(mFile,"\tsetAttr \".rp\" ");
+		writeString(mFile,"\tsetAttr \".rp\" ");
 		rp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBeauty(bool b)
 	{
 		if(b == true) return;
-		fprintf(mFile,"\tsetAttr \".rp.b\" %i;\n", b);
+		writeInt(mFile,"\tsetAttr \".rp.b\" ",b,";\n");
 	}
 	void setColor(bool cp)
 	{
 		if(cp == false) return;
-		fprintf(mFile,"\tsetAttr \".rp.cp\" %i;\n", cp);
+		writeInt(mFile,"\tsetAttr \".rp.cp\" ",cp,";\n");
 	}
 	void setAmbient(bool am)
 	{
 		if(am == false) return;
-		fprintf(mFile,"\tsetAttr \".rp.am\" %i;\n", am);
+		writeInt(mFile,"\tsetAttr \".rp.am\" ",am,";\n");
 	}
 	void setDiffuse(bool di)
 	{
 		if(di == false) return;
-		fprintf(mFile,"\tsetAttr \".rp.di\" %i;\n", di);
+		writeInt(mFile,"\tsetAttr \".rp.di\" ",di,";\n");
 	}
 	void setSpecular(bool sp)
 	{
 		if(sp == false) return;
-		fprintf(mFile,"\tsetAttr \".rp.sp\" %i;\n", sp);
+		writeInt(mFile,"\tsetAttr \".rp.sp\" ",sp,";\n");
 	}
 	void setShadow(bool s)
 	{
 		if(s == false) return;
-		fprintf(mFile,"\tsetAttr \".rp.s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".rp.s\" ",s,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlobalIllum(bool gp)
 	{
 		if(gp == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gp\" %i;\n", gp);
+		writeInt(mFile,"\tsetAttr \".mrc.gp\" ",gp,";\n");
 	}
 	void setAdjustments(size_t adjs_i,const Adjustments& adjs)
 	{
-		fprintf(mFile,"\tsetAttr \".adjs[%i]\" ",adjs_i);
+		writeInt(mFile,"\tsetAttr \".adjs[",adjs_i,"]\" ");
 		adjs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAdjustments(size_t adjs_start,size_t adjs_end,Adjustments* adjs)
 	{
-		fprintf(mFile,"\tsetAttr \".adjs[%i:%i]\" ", adjs_start,adjs_end);
+		writeInt(mFile,"\tsetAttr \".adjs[",adjs_start); writeInt(mFile,":",adjs_end,"]\" ");
 		size_t size = (adjs_end-adjs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			adjs[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startAdjustments(size_t adjs_start,size_t adjs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".adjs[%i:%i]\"",adjs_start,adjs_end);
-		fprintf(mFile," -type \"Adjustments\" ");
+		writeInt(mFile,"\tsetAttr \".adjs[",adjs_start); writeInt(mFile,":",adjs_end,"]\"");
+		writeString(mFile," -type \"Adjustments\" ");
 	}
 	void appendAdjustments(const Adjustments& adjs)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		adjs.write(mFile);
 	}
 	void endAdjustments()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutAdjustments(size_t oajs_i,const OutAdjustments& oajs)
 	{
-		fprintf(mFile,"\tsetAttr \".oajs[%i]\" ",oajs_i);
+		writeInt(mFile,"\tsetAttr \".oajs[",oajs_i,"]\" ");
 		oajs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutAdjustments(size_t oajs_start,size_t oajs_end,OutAdjustments* oajs)
 	{
-		fprintf(mFile,"\tsetAttr \".oajs[%i:%i]\" ", oajs_start,oajs_end);
+		writeInt(mFile,"\tsetAttr \".oajs[",oajs_start); writeInt(mFile,":",oajs_end,"]\" ");
 		size_t size = (oajs_end-oajs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			oajs[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startOutAdjustments(size_t oajs_start,size_t oajs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".oajs[%i:%i]\"",oajs_start,oajs_end);
-		fprintf(mFile," -type \"OutAdjustments\" ");
+		writeInt(mFile,"\tsetAttr \".oajs[",oajs_start); writeInt(mFile,":",oajs_end,"]\"");
+		writeString(mFile," -type \"OutAdjustments\" ");
 	}
 	void appendOutAdjustments(const OutAdjustments& oajs)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		oajs.write(mFile);
 	}
 	void endOutAdjustments()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAttributeOverrideScript(const string& aos)
 	{
 		if(aos == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".aos\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".aos\" -type \"string\" ");
 		aos.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDisplayOrder(short do_)
 	{
 		if(do_ == 0) return;
-		fprintf(mFile,"\tsetAttr \".do\" %i;\n", do_);
+		writeInt(mFile,"\tsetAttr \".do\" ",do_,";\n");
 	}
 	void setPsdBlendMode(short bm)
 	{
 		if(bm == 0) return;
-		fprintf(mFile,"\tsetAttr \".bm\" %i;\n", bm);
+		writeInt(mFile,"\tsetAttr \".bm\" ",bm,";\n");
 	}
 	void setPsdAlphaChannel(short ac)
 	{
 		if(ac == 0) return;
-		fprintf(mFile,"\tsetAttr \".ac\" %i;\n", ac);
+		writeInt(mFile,"\tsetAttr \".ac\" ",ac,";\n");
 	}
 	void getGlobal()const
 	{
-		fprintf(mFile,"\"%s.g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g\"");
 	}
 	void getRenderInfo()const
 	{
-		fprintf(mFile,"\"%s.ri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri\"");
 	}
 	void getIdentification()const
 	{
-		fprintf(mFile,"\"%s.ri.rlid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.rlid\"");
 	}
 	void getRenderable()const
 	{
-		fprintf(mFile,"\"%s.ri.rndr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.rndr\"");
 	}
 	void getDrawColor()const
 	{
-		fprintf(mFile,"\"%s.ri.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ri.c\"");
 	}
 	void getLayerParent()const
 	{
-		fprintf(mFile,"\"%s.rlp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlp\"");
 	}
 	void getLayerChildren(size_t rlc_i)const
 	{
-		fprintf(mFile,"\"%s.rlc[%i]\"",mName.c_str(),rlc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rlc[",rlc_i,"]\"");
 	}
 	void getLayerChildren()const
 	{
 
-		fprintf(mFile,"\"%s.rlc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlc\"");
 	}
 	void getRenderPassInfo()const
 	{
-		fprintf(mFile,"\"%s.rp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp\"");
 	}
 	void getBeauty()const
 	{
-		fprintf(mFile,"\"%s.rp.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.b\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.rp.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.cp\"");
 	}
 	void getAmbient()const
 	{
-		fprintf(mFile,"\"%s.rp.am\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.am\"");
 	}
 	void getDiffuse()const
 	{
-		fprintf(mFile,"\"%s.rp.di\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.di\"");
 	}
 	void getSpecular()const
 	{
-		fprintf(mFile,"\"%s.rp.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.sp\"");
 	}
 	void getShadow()const
 	{
-		fprintf(mFile,"\"%s.rp.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.s\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getGlobalIllum()const
 	{
-		fprintf(mFile,"\"%s.mrc.gp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gp\"");
 	}
 	void getAdjustments(size_t adjs_i)const
 	{
-		fprintf(mFile,"\"%s.adjs[%i]\"",mName.c_str(),adjs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".adjs[",adjs_i,"]\"");
 	}
 	void getAdjustments()const
 	{
 
-		fprintf(mFile,"\"%s.adjs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".adjs\"");
 	}
 	void getPlug(size_t adjs_i)const
 	{
-		fprintf(mFile,"\"%s.adjs[%i].plg\"",mName.c_str(),adjs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".adjs[",adjs_i,"].plg\"");
 	}
 	void getPlug()const
 	{
 
-		fprintf(mFile,"\"%s.adjs.plg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".adjs.plg\"");
 	}
 	void getValue(size_t adjs_i)const
 	{
-		fprintf(mFile,"\"%s.adjs[%i].val\"",mName.c_str(),adjs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".adjs[",adjs_i,"].val\"");
 	}
 	void getValue()const
 	{
 
-		fprintf(mFile,"\"%s.adjs.val\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".adjs.val\"");
 	}
 	void getOutAdjustments(size_t oajs_i)const
 	{
-		fprintf(mFile,"\"%s.oajs[%i]\"",mName.c_str(),oajs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oajs[",oajs_i,"]\"");
 	}
 	void getOutAdjustments()const
 	{
 
-		fprintf(mFile,"\"%s.oajs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oajs\"");
 	}
 	void getOutPlug(size_t oajs_i)const
 	{
-		fprintf(mFile,"\"%s.oajs[%i].opg\"",mName.c_str(),oajs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oajs[",oajs_i,"].opg\"");
 	}
 	void getOutPlug()const
 	{
 
-		fprintf(mFile,"\"%s.oajs.opg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oajs.opg\"");
 	}
 	void getOutValue(size_t oajs_i)const
 	{
-		fprintf(mFile,"\"%s.oajs[%i].ovl\"",mName.c_str(),oajs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".oajs[",oajs_i,"].ovl\"");
 	}
 	void getOutValue()const
 	{
 
-		fprintf(mFile,"\"%s.oajs.ovl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oajs.ovl\"");
 	}
 	void getShadingGroupOverride()const
 	{
-		fprintf(mFile,"\"%s.sgo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgo\"");
 	}
 	void getAttributeOverrideScript()const
 	{
-		fprintf(mFile,"\"%s.aos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aos\"");
 	}
 	void getImageRendered()const
 	{
-		fprintf(mFile,"\"%s.ird\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ird\"");
 	}
 	void getRecycleImage()const
 	{
-		fprintf(mFile,"\"%s.rci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rci\"");
 	}
 	void getImageName()const
 	{
-		fprintf(mFile,"\"%s.img\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".img\"");
 	}
 	void getDisplayOrder()const
 	{
-		fprintf(mFile,"\"%s.do\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".do\"");
 	}
 	void getPsdBlendMode()const
 	{
-		fprintf(mFile,"\"%s.bm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bm\"");
 	}
 	void getPsdAlphaChannel()const
 	{
-		fprintf(mFile,"\"%s.ac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac\"");
 	}
 protected:
 	RenderLayer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,48 +27,48 @@ public:
 	void setCurrentRenderLayer(short crl)
 	{
 		if(crl == 0) return;
-		fprintf(mFile,"\tsetAttr \".crl\" %i;\n", crl);
+		writeInt(mFile,"\tsetAttr \".crl\" ",crl,";\n");
 	}
 	void setRenderLayerId(size_t rlmi_i,short rlmi)
 	{
 		if(rlmi == 0) return;
-		fprintf(mFile,"\tsetAttr \".rlmi[%i]\" %i;\n", rlmi_i,rlmi);
+		writeInt(mFile,"\tsetAttr \".rlmi[",rlmi_i); writeInt(mFile,"]\" ",rlmi,";\n");
 	}
 	void setRenderLayerId(size_t rlmi_start,size_t rlmi_end,short* rlmi)
 	{
-		fprintf(mFile,"\tsetAttr \".rlmi[%i:%i]\" ", rlmi_start,rlmi_end);
+		writeInt(mFile,"\tsetAttr \".rlmi[",rlmi_start); writeInt(mFile,":",rlmi_end,"]\" ");
 		size_t size = (rlmi_end-rlmi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",rlmi[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",rlmi[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startRenderLayerId(size_t rlmi_start,size_t rlmi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".rlmi[%i:%i]\"",rlmi_start,rlmi_end);
+		writeInt(mFile,"\tsetAttr \".rlmi[",rlmi_start); writeInt(mFile,":",rlmi_end,"]\"");
 	}
 	void appendRenderLayerId(short rlmi)const
 	{
-		fprintf(mFile," %i",rlmi);
+		writeInt(mFile," ",rlmi);
 	}
 	void endRenderLayerId()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getCurrentRenderLayer()const
 	{
-		fprintf(mFile,"\"%s.crl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crl\"");
 	}
 	void getRenderLayerId(size_t rlmi_i)const
 	{
-		fprintf(mFile,"\"%s.rlmi[%i]\"",mName.c_str(),rlmi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".rlmi[",rlmi_i,"]\"");
 	}
 	void getRenderLayerId()const
 	{
 
-		fprintf(mFile,"\"%s.rlmi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlmi\"");
 	}
 protected:
 	RenderLayerManager(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
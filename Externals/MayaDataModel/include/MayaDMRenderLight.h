@@ -26,7 +26,7 @@ public:
 
 	void getRayInstance()const
 	{
-		fprintf(mFile,"\"%s.ryi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ryi\"");
 	}
 protected:
 	RenderLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,200 +27,200 @@ public:
 	void setReflections(int rfl)
 	{
 		if(rfl == 1) return;
-		fprintf(mFile,"\tsetAttr \".rfl\" %i;\n", rfl);
+		writeInt(mFile,"\tsetAttr \".rfl\" ",rfl,";\n");
 	}
 	void setRefractions(int rfr)
 	{
 		if(rfr == 6) return;
-		fprintf(mFile,"\tsetAttr \".rfr\" %i;\n", rfr);
+		writeInt(mFile,"\tsetAttr \".rfr\" ",rfr,";\n");
 	}
 	void setShadows(int sl)
 	{
 		if(sl == 2) return;
-		fprintf(mFile,"\tsetAttr \".sl\" %i;\n", sl);
+		writeInt(mFile,"\tsetAttr \".sl\" ",sl,";\n");
 	}
 	void setRayTraceBias(float rtb)
 	{
 		if(rtb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rtb\" %f;\n", rtb);
+		writeFloat(mFile,"\tsetAttr \".rtb\" ",rtb,";\n");
 	}
 	void setEdgeAntiAliasing(unsigned int eaa)
 	{
 		if(eaa == 3) return;
-		fprintf(mFile,"\tsetAttr \".eaa\" %i;\n", eaa);
+		writeInt(mFile,"\tsetAttr \".eaa\" ",eaa,";\n");
 	}
 	void setRenderSample(bool rsdn)
 	{
 		if(rsdn == false) return;
-		fprintf(mFile,"\tsetAttr \".rsdn\" %i;\n", rsdn);
+		writeInt(mFile,"\tsetAttr \".rsdn\" ",rsdn,";\n");
 	}
 	void setUseMultiPixelFilter(bool ufil)
 	{
 		if(ufil == false) return;
-		fprintf(mFile,"\tsetAttr \".ufil\" %i;\n", ufil);
+		writeInt(mFile,"\tsetAttr \".ufil\" ",ufil,";\n");
 	}
 	void setPixelFilterType(unsigned int pft)
 	{
 		if(pft == 1) return;
-		fprintf(mFile,"\tsetAttr \".pft\" %i;\n", pft);
+		writeInt(mFile,"\tsetAttr \".pft\" ",pft,";\n");
 	}
 	void setPixelFilterWidthX(float pfwx)
 	{
 		if(pfwx == 2.2) return;
-		fprintf(mFile,"\tsetAttr \".pfwx\" %f;\n", pfwx);
+		writeFloat(mFile,"\tsetAttr \".pfwx\" ",pfwx,";\n");
 	}
 	void setPixelFilterWidthY(float pfwy)
 	{
 		if(pfwy == 2.2) return;
-		fprintf(mFile,"\tsetAttr \".pfwy\" %f;\n", pfwy);
+		writeFloat(mFile,"\tsetAttr \".pfwy\" ",pfwy,";\n");
 	}
 	void setPlugInFilterWeight(float pifw)
 	{
 		if(pifw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pifw\" %f;\n", pifw);
+		writeFloat(mFile,"\tsetAttr \".pifw\" ",pifw,";\n");
 	}
 	void setShadingSamples(int ss)
 	{
 		if(ss == 1) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %i;\n", ss);
+		writeInt(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setMaxShadingSamples(int mss)
 	{
 		if(mss == 8) return;
-		fprintf(mFile,"\tsetAttr \".mss\" %i;\n", mss);
+		writeInt(mFile,"\tsetAttr \".mss\" ",mss,";\n");
 	}
 	void setVisibilitySamples(int mvs)
 	{
 		if(mvs == 1) return;
-		fprintf(mFile,"\tsetAttr \".mvs\" %i;\n", mvs);
+		writeInt(mFile,"\tsetAttr \".mvs\" ",mvs,";\n");
 	}
 	void setMaxVisibilitySamples(int mvm)
 	{
 		if(mvm == 4) return;
-		fprintf(mFile,"\tsetAttr \".mvm\" %i;\n", mvm);
+		writeInt(mFile,"\tsetAttr \".mvm\" ",mvm,";\n");
 	}
 	void setVolumeSamples(int vs)
 	{
 		if(vs == 1) return;
-		fprintf(mFile,"\tsetAttr \".vs\" %i;\n", vs);
+		writeInt(mFile,"\tsetAttr \".vs\" ",vs,";\n");
 	}
 	void setParticleSamples(int pss)
 	{
 		if(pss == 1) return;
-		fprintf(mFile,"\tsetAttr \".pss\" %i;\n", pss);
+		writeInt(mFile,"\tsetAttr \".pss\" ",pss,";\n");
 	}
 	void setEnableRaytracing(bool ert)
 	{
 		if(ert == false) return;
-		fprintf(mFile,"\tsetAttr \".ert\" %i;\n", ert);
+		writeInt(mFile,"\tsetAttr \".ert\" ",ert,";\n");
 	}
 	void setRedThreshold(float rct)
 	{
 		if(rct == 0.4) return;
-		fprintf(mFile,"\tsetAttr \".rct\" %f;\n", rct);
+		writeFloat(mFile,"\tsetAttr \".rct\" ",rct,";\n");
 	}
 	void setGreenThreshold(float gct)
 	{
 		if(gct == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".gct\" %f;\n", gct);
+		writeFloat(mFile,"\tsetAttr \".gct\" ",gct,";\n");
 	}
 	void setBlueThreshold(float bct)
 	{
 		if(bct == 0.6) return;
-		fprintf(mFile,"\tsetAttr \".bct\" %f;\n", bct);
+		writeFloat(mFile,"\tsetAttr \".bct\" ",bct,";\n");
 	}
 	void setCoverageThreshold(float cct)
 	{
 		if(cct == 0.125) return;
-		fprintf(mFile,"\tsetAttr \".cct\" %f;\n", cct);
+		writeFloat(mFile,"\tsetAttr \".cct\" ",cct,";\n");
 	}
 	void getReflections()const
 	{
-		fprintf(mFile,"\"%s.rfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfl\"");
 	}
 	void getRefractions()const
 	{
-		fprintf(mFile,"\"%s.rfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rfr\"");
 	}
 	void getShadows()const
 	{
-		fprintf(mFile,"\"%s.sl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sl\"");
 	}
 	void getRayTraceBias()const
 	{
-		fprintf(mFile,"\"%s.rtb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtb\"");
 	}
 	void getEdgeAntiAliasing()const
 	{
-		fprintf(mFile,"\"%s.eaa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eaa\"");
 	}
 	void getRenderSample()const
 	{
-		fprintf(mFile,"\"%s.rsdn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rsdn\"");
 	}
 	void getUseMultiPixelFilter()const
 	{
-		fprintf(mFile,"\"%s.ufil\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufil\"");
 	}
 	void getPixelFilterType()const
 	{
-		fprintf(mFile,"\"%s.pft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pft\"");
 	}
 	void getPixelFilterWidthX()const
 	{
-		fprintf(mFile,"\"%s.pfwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfwx\"");
 	}
 	void getPixelFilterWidthY()const
 	{
-		fprintf(mFile,"\"%s.pfwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pfwy\"");
 	}
 	void getPlugInFilterWeight()const
 	{
-		fprintf(mFile,"\"%s.pifw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pifw\"");
 	}
 	void getShadingSamples()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getMaxShadingSamples()const
 	{
-		fprintf(mFile,"\"%s.mss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mss\"");
 	}
 	void getVisibilitySamples()const
 	{
-		fprintf(mFile,"\"%s.mvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mvs\"");
 	}
 	void getMaxVisibilitySamples()const
 	{
-		fprintf(mFile,"\"%s.mvm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mvm\"");
 	}
 	void getVolumeSamples()const
 	{
-		fprintf(mFile,"\"%s.vs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vs\"");
 	}
 	void getParticleSamples()const
 	{
-		fprintf(mFile,"\"%s.pss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pss\"");
 	}
 	void getEnableRaytracing()const
 	{
-		fprintf(mFile,"\"%s.ert\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ert\"");
 	}
 	void getRedThreshold()const
 	{
-		fprintf(mFile,"\"%s.rct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rct\"");
 	}
 	void getGreenThreshold()const
 	{
-		fprintf(mFile,"\"%s.gct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gct\"");
 	}
 	void getBlueThreshold()const
 	{
-		fprintf(mFile,"\"%s.bct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bct\"");
 	}
 	void getCoverageThreshold()const
 	{
-		fprintf(mFile,"\"%s.cct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cct\"");
 	}
 protected:
 	RenderQuality(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
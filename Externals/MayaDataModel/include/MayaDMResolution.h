@@ -27,110 +27,110 @@ public:
 	void setWidth(int w)
 	{
 		if(w == 640) return;
-		fprintf(mFile,"\tsetAttr \".w\" %i;\n", w);
+		writeInt(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setHeight(int h)
 	{
 		if(h == 480) return;
-		fprintf(mFile,"\tsetAttr \".h\" %i;\n", h);
+		writeInt(mFile,"\tsetAttr \".h\" ",h,";\n");
 	}
 	void setPixelAspect(float pa)
 	{
 		if(pa == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pa\" %f;\n", pa);
+		writeFloat(mFile,"\tsetAttr \".pa\" ",pa,";\n");
 	}
 	void setAspectLock(bool al)
 	{
 		if(al == false) return;
-		fprintf(mFile,"\tsetAttr \".al\" %i;\n", al);
+		writeInt(mFile,"\tsetAttr \".al\" ",al,";\n");
 	}
 	void setDeviceAspectRatio(float dar)
 	{
 		if(dar == 1.33333) return;
-		fprintf(mFile,"\tsetAttr \".dar\" %f;\n", dar);
+		writeFloat(mFile,"\tsetAttr \".dar\" ",dar,";\n");
 	}
 	void setLockDeviceAspectRatio(bool ldar)
 	{
 		if(ldar == false) return;
-		fprintf(mFile,"\tsetAttr \".ldar\" %i;\n", ldar);
+		writeInt(mFile,"\tsetAttr \".ldar\" ",ldar,";\n");
 	}
 	void setDotsPerInch(float dpi)
 	{
 		if(dpi == 72.0) return;
-		fprintf(mFile,"\tsetAttr \".dpi\" %f;\n", dpi);
+		writeFloat(mFile,"\tsetAttr \".dpi\" ",dpi,";\n");
 	}
 	void setOddFieldFirst(bool off)
 	{
 		if(off == true) return;
-		fprintf(mFile,"\tsetAttr \".off\" %i;\n", off);
+		writeInt(mFile,"\tsetAttr \".off\" ",off,";\n");
 	}
 	void setFields(unsigned int fld)
 	{
 		if(fld == 0) return;
-		fprintf(mFile,"\tsetAttr \".fld\" %i;\n", fld);
+		writeInt(mFile,"\tsetAttr \".fld\" ",fld,";\n");
 	}
 	void setZerothScanline(unsigned int zsl)
 	{
 		if(zsl == 0) return;
-		fprintf(mFile,"\tsetAttr \".zsl\" %i;\n", zsl);
+		writeInt(mFile,"\tsetAttr \".zsl\" ",zsl,";\n");
 	}
 	void setImageSizeUnits(unsigned int isu)
 	{
 		if(isu == 0) return;
-		fprintf(mFile,"\tsetAttr \".isu\" %i;\n", isu);
+		writeInt(mFile,"\tsetAttr \".isu\" ",isu,";\n");
 	}
 	void setPixelDensityUnits(unsigned int pdu)
 	{
 		if(pdu == 0) return;
-		fprintf(mFile,"\tsetAttr \".pdu\" %i;\n", pdu);
+		writeInt(mFile,"\tsetAttr \".pdu\" ",pdu,";\n");
 	}
 	void getWidth()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getHeight()const
 	{
-		fprintf(mFile,"\"%s.h\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".h\"");
 	}
 	void getPixelAspect()const
 	{
-		fprintf(mFile,"\"%s.pa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pa\"");
 	}
 	void getAspectLock()const
 	{
-		fprintf(mFile,"\"%s.al\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".al\"");
 	}
 	void getDeviceAspectRatio()const
 	{
-		fprintf(mFile,"\"%s.dar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dar\"");
 	}
 	void getLockDeviceAspectRatio()const
 	{
-		fprintf(mFile,"\"%s.ldar\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldar\"");
 	}
 	void getDotsPerInch()const
 	{
-		fprintf(mFile,"\"%s.dpi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpi\"");
 	}
 	void getOddFieldFirst()const
 	{
-		fprintf(mFile,"\"%s.off\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".off\"");
 	}
 	void getFields()const
 	{
-		fprintf(mFile,"\"%s.fld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fld\"");
 	}
 	void getZerothScanline()const
 	{
-		fprintf(mFile,"\"%s.zsl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".zsl\"");
 	}
 	void getImageSizeUnits()const
 	{
-		fprintf(mFile,"\"%s.isu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".isu\"");
 	}
 	void getPixelDensityUnits()const
 	{
-		fprintf(mFile,"\"%s.pdu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pdu\"");
 	}
 protected:
 	Resolution(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,29 +27,29 @@ public:
 	void setStart(double st)
 	{
 		if(st == 0) return;
-		fprintf(mFile,"\tsetAttr \".st\" %f;\n", st);
+		writeFloat(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void setEnd(double et)
 	{
 		if(et == 3) return;
-		fprintf(mFile,"\tsetAttr \".et\" %f;\n", et);
+		writeFloat(mFile,"\tsetAttr \".et\" ",et,";\n");
 	}
 	void setSampleBy(double sby)
 	{
 		if(sby == 1) return;
-		fprintf(mFile,"\tsetAttr \".sby\" %f;\n", sby);
+		writeFloat(mFile,"\tsetAttr \".sby\" ",sby,";\n");
 	}
 	void getStart()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 	void getEnd()const
 	{
-		fprintf(mFile,"\"%s.et\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".et\"");
 	}
 	void getSampleBy()const
 	{
-		fprintf(mFile,"\"%s.sby\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sby\"");
 	}
 protected:
 	ResultCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,56 +27,56 @@ public:
 	void setInput(const float3& i_)
 	{
 		if(i_ == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".i\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".i\" -type \"float3\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputX(float ix)
 	{
 		if(ix == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ix\" %f;\n", ix);
+		writeFloat(mFile,"\tsetAttr \".i.ix\" ",ix,";\n");
 	}
 	void setInputY(float iy)
 	{
 		if(iy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.iy\" %f;\n", iy);
+		writeFloat(mFile,"\tsetAttr \".i.iy\" ",iy,";\n");
 	}
 	void setInputZ(float iz)
 	{
 		if(iz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.iz\" %f;\n", iz);
+		writeFloat(mFile,"\tsetAttr \".i.iz\" ",iz,";\n");
 	}
 	void getInput()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInputX()const
 	{
-		fprintf(mFile,"\"%s.i.ix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ix\"");
 	}
 	void getInputY()const
 	{
-		fprintf(mFile,"\"%s.i.iy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.iy\"");
 	}
 	void getInputZ()const
 	{
-		fprintf(mFile,"\"%s.i.iz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.iz\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutputX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutputY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutputZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 protected:
 	Reverse(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,248 +27,248 @@ public:
 	void setStartSweep(double ssw)
 	{
 		if(ssw == 0) return;
-		fprintf(mFile,"\tsetAttr \".ssw\" %f;\n", ssw);
+		writeFloat(mFile,"\tsetAttr \".ssw\" ",ssw,";\n");
 	}
 	void setEndSweep(double esw)
 	{
 		if(esw == 6.2831853) return;
-		fprintf(mFile,"\tsetAttr \".esw\" %f;\n", esw);
+		writeFloat(mFile,"\tsetAttr \".esw\" ",esw,";\n");
 	}
 	void setUseTolerance(bool ut)
 	{
 		if(ut == false) return;
-		fprintf(mFile,"\tsetAttr \".ut\" %i;\n", ut);
+		writeInt(mFile,"\tsetAttr \".ut\" ",ut,";\n");
 	}
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSections(int s)
 	{
 		if(s == 8) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setAxis(const double3& ax)
 	{
-		fprintf(mFile,"\tsetAttr \".ax\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ax\" -type \"double3\" ");
 		ax.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAxisX(double axx)
 	{
 		if(axx == 1) return;
-		fprintf(mFile,"\tsetAttr \".ax.axx\" %f;\n", axx);
+		writeFloat(mFile,"\tsetAttr \".ax.axx\" ",axx,";\n");
 	}
 	void setAxisY(double axy)
 	{
 		if(axy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axy\" %f;\n", axy);
+		writeFloat(mFile,"\tsetAttr \".ax.axy\" ",axy,";\n");
 	}
 	void setAxisZ(double axz)
 	{
 		if(axz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axz\" %f;\n", axz);
+		writeFloat(mFile,"\tsetAttr \".ax.axz\" ",axz,";\n");
 	}
 	void setPivot(const double3& p)
 	{
-		fprintf(mFile,"\tsetAttr \".p\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"double3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPivotX(double px)
 	{
 		if(px == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPivotY(double py)
 	{
 		if(py == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setPivotZ(double pz)
 	{
 		if(pz == 0) return;
-		fprintf(mFile,"\tsetAttr \".p.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".p.pz\" ",pz,";\n");
 	}
 	void setAutoCorrectNormal(bool acn)
 	{
 		if(acn == false) return;
-		fprintf(mFile,"\tsetAttr \".acn\" %i;\n", acn);
+		writeInt(mFile,"\tsetAttr \".acn\" ",acn,";\n");
 	}
 	void setComputePivotAndAxis(unsigned int cpa)
 	{
 		if(cpa == 0) return;
-		fprintf(mFile,"\tsetAttr \".cpa\" %i;\n", cpa);
+		writeInt(mFile,"\tsetAttr \".cpa\" ",cpa,";\n");
 	}
 	void setRadius(double r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setRadiusAnchor(double ra)
 	{
 		if(ra == -1) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setAxisChoice(unsigned int aco)
 	{
 		if(aco == 0) return;
-		fprintf(mFile,"\tsetAttr \".aco\" %i;\n", aco);
+		writeInt(mFile,"\tsetAttr \".aco\" ",aco,";\n");
 	}
 	void setBridge(bool br)
 	{
 		if(br == false) return;
-		fprintf(mFile,"\tsetAttr \".br\" %i;\n", br);
+		writeInt(mFile,"\tsetAttr \".br\" ",br,";\n");
 	}
 	void getInputCurve()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getStartSweep()const
 	{
-		fprintf(mFile,"\"%s.ssw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssw\"");
 	}
 	void getEndSweep()const
 	{
-		fprintf(mFile,"\"%s.esw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".esw\"");
 	}
 	void getUseTolerance()const
 	{
-		fprintf(mFile,"\"%s.ut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ut\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSections()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getAxis()const
 	{
-		fprintf(mFile,"\"%s.ax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax\"");
 	}
 	void getAxisX()const
 	{
-		fprintf(mFile,"\"%s.ax.axx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axx\"");
 	}
 	void getAxisY()const
 	{
-		fprintf(mFile,"\"%s.ax.axy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axy\"");
 	}
 	void getAxisZ()const
 	{
-		fprintf(mFile,"\"%s.ax.axz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axz\"");
 	}
 	void getPivot()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPivotX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPivotY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPivotZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getAutoCorrectNormal()const
 	{
-		fprintf(mFile,"\"%s.acn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acn\"");
 	}
 	void getComputePivotAndAxis()const
 	{
-		fprintf(mFile,"\"%s.cpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpa\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRadiusAnchor()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getAxisChoice()const
 	{
-		fprintf(mFile,"\"%s.aco\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".aco\"");
 	}
 	void getBridge()const
 	{
-		fprintf(mFile,"\"%s.br\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".br\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getBridgeCurve()const
 	{
-		fprintf(mFile,"\"%s.bc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bc\"");
 	}
 	void getCompAxis()const
 	{
-		fprintf(mFile,"\"%s.ca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ca\"");
 	}
 	void getCompAxisX()const
 	{
-		fprintf(mFile,"\"%s.ca.cax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ca.cax\"");
 	}
 	void getCompAxisY()const
 	{
-		fprintf(mFile,"\"%s.ca.cay\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ca.cay\"");
 	}
 	void getCompAxisZ()const
 	{
-		fprintf(mFile,"\"%s.ca.caz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ca.caz\"");
 	}
 	void getCompPivot()const
 	{
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getCompPivotX()const
 	{
-		fprintf(mFile,"\"%s.cp.cpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.cpx\"");
 	}
 	void getCompPivotY()const
 	{
-		fprintf(mFile,"\"%s.cp.cpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.cpy\"");
 	}
 	void getCompPivotZ()const
 	{
-		fprintf(mFile,"\"%s.cp.cpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.cpz\"");
 	}
 	void getCompAxisChoice()const
 	{
-		fprintf(mFile,"\"%s.cac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cac\"");
 	}
 	void getCompAnchor()const
 	{
-		fprintf(mFile,"\"%s.cn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn\"");
 	}
 	void getCompAnchorX()const
 	{
-		fprintf(mFile,"\"%s.cn.cnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn.cnx\"");
 	}
 	void getCompAnchorY()const
 	{
-		fprintf(mFile,"\"%s.cn.cny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn.cny\"");
 	}
 	void getCompAnchorZ()const
 	{
-		fprintf(mFile,"\"%s.cn.cnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cn.cnz\"");
 	}
 protected:
 	Revolve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
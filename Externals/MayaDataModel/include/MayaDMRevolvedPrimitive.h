@@ -27,95 +27,95 @@ public:
 	void setRadius(double r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void setStartSweep(double ssw)
 	{
 		if(ssw == 0) return;
-		fprintf(mFile,"\tsetAttr \".ssw\" %f;\n", ssw);
+		writeFloat(mFile,"\tsetAttr \".ssw\" ",ssw,";\n");
 	}
 	void setEndSweep(double esw)
 	{
 		if(esw == 6.2831853) return;
-		fprintf(mFile,"\tsetAttr \".esw\" %f;\n", esw);
+		writeFloat(mFile,"\tsetAttr \".esw\" ",esw,";\n");
 	}
 	void setUseTolerance(bool ut)
 	{
 		if(ut == false) return;
-		fprintf(mFile,"\tsetAttr \".ut\" %i;\n", ut);
+		writeInt(mFile,"\tsetAttr \".ut\" ",ut,";\n");
 	}
 	void setDegree(unsigned int d)
 	{
 		if(d == 3) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSections(int s)
 	{
 		if(s == 8) return;
-		fprintf(mFile,"\tsetAttr \".s\" %i;\n", s);
+		writeInt(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setSpans(int nsp)
 	{
 		if(nsp == 1) return;
-		fprintf(mFile,"\tsetAttr \".nsp\" %i;\n", nsp);
+		writeInt(mFile,"\tsetAttr \".nsp\" ",nsp,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setHeightRatio(double hr)
 	{
 		if(hr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".hr\" %f;\n", hr);
+		writeFloat(mFile,"\tsetAttr \".hr\" ",hr,";\n");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getStartSweep()const
 	{
-		fprintf(mFile,"\"%s.ssw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ssw\"");
 	}
 	void getEndSweep()const
 	{
-		fprintf(mFile,"\"%s.esw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".esw\"");
 	}
 	void getUseTolerance()const
 	{
-		fprintf(mFile,"\"%s.ut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ut\"");
 	}
 	void getDegree()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSections()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getSpans()const
 	{
-		fprintf(mFile,"\"%s.nsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nsp\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getHeightRatio()const
 	{
-		fprintf(mFile,"\"%s.hr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hr\"");
 	}
 	void getTopCapCurve()const
 	{
-		fprintf(mFile,"\"%s.tcc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcc\"");
 	}
 	void getBottomCapCurve()const
 	{
-		fprintf(mFile,"\"%s.bcc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bcc\"");
 	}
 	void getAbsoluteSweepDifference()const
 	{
-		fprintf(mFile,"\"%s.asd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".asd\"");
 	}
 protected:
 	RevolvedPrimitive(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
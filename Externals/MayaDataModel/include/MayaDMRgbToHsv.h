@@ -27,56 +27,56 @@ public:
 	void setInRgb(const float3& i_)
 	{
 		if(i_ == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".i\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".i\" -type \"float3\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInRgbR(float ir)
 	{
 		if(ir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ir\" %f;\n", ir);
+		writeFloat(mFile,"\tsetAttr \".i.ir\" ",ir,";\n");
 	}
 	void setInRgbG(float ig)
 	{
 		if(ig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ig\" %f;\n", ig);
+		writeFloat(mFile,"\tsetAttr \".i.ig\" ",ig,";\n");
 	}
 	void setInRgbB(float ib)
 	{
 		if(ib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ib\" %f;\n", ib);
+		writeFloat(mFile,"\tsetAttr \".i.ib\" ",ib,";\n");
 	}
 	void getInRgb()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInRgbR()const
 	{
-		fprintf(mFile,"\"%s.i.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ir\"");
 	}
 	void getInRgbG()const
 	{
-		fprintf(mFile,"\"%s.i.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ig\"");
 	}
 	void getInRgbB()const
 	{
-		fprintf(mFile,"\"%s.i.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ib\"");
 	}
 	void getOutHsv()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutHsvH()const
 	{
-		fprintf(mFile,"\"%s.o.oh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oh\"");
 	}
 	void getOutHsvS()const
 	{
-		fprintf(mFile,"\"%s.o.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.os\"");
 	}
 	void getOutHsvV()const
 	{
-		fprintf(mFile,"\"%s.o.ov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ov\"");
 	}
 protected:
 	RgbToHsv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -37,839 +37,839 @@ public:
 	void setRunUpCache(const doubleArray& rc)
 	{
 		if(rc.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".rc\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".rc\" -type \"doubleArray\" ");
 		rc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDataCache(const doubleArray& dc)
 	{
 		if(dc.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".dc\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".dc\" -type \"doubleArray\" ");
 		dc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFirstCachedFrame(int fcf)
 	{
 		if(fcf == 0) return;
-		fprintf(mFile,"\tsetAttr \".fcf\" %i;\n", fcf);
+		writeInt(mFile,"\tsetAttr \".fcf\" ",fcf,";\n");
 	}
 	void setLastCachedFrame(int lcf)
 	{
 		if(lcf == 0) return;
-		fprintf(mFile,"\tsetAttr \".lcf\" %i;\n", lcf);
+		writeInt(mFile,"\tsetAttr \".lcf\" ",lcf,";\n");
 	}
 	void setCachedFrameCount(int cfc)
 	{
 		if(cfc == 0) return;
-		fprintf(mFile,"\tsetAttr \".cfc\" %i;\n", cfc);
+		writeInt(mFile,"\tsetAttr \".cfc\" ",cfc,";\n");
 	}
 	void setInitialPosition(const double3& ip)
 	{
 		if(ip == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
 		ip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialPositionX(double ipx)
 	{
 		if(ipx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipx\" %f;\n", ipx);
+		writeFloat(mFile,"\tsetAttr \".ip.ipx\" ",ipx,";\n");
 	}
 	void setInitialPositionY(double ipy)
 	{
 		if(ipy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipy\" %f;\n", ipy);
+		writeFloat(mFile,"\tsetAttr \".ip.ipy\" ",ipy,";\n");
 	}
 	void setInitialPositionZ(double ipz)
 	{
 		if(ipz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipz\" %f;\n", ipz);
+		writeFloat(mFile,"\tsetAttr \".ip.ipz\" ",ipz,";\n");
 	}
 	void setInitialOrientation(const double3& ior)
 	{
 		if(ior == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".ior\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ior\" -type \"double3\" ");
 		ior.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialOrientationX(double iox)
 	{
 		if(iox == 0) return;
-		fprintf(mFile,"\tsetAttr \".ior.iox\" %f;\n", iox);
+		writeFloat(mFile,"\tsetAttr \".ior.iox\" ",iox,";\n");
 	}
 	void setInitialOrientationY(double ioy)
 	{
 		if(ioy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ior.ioy\" %f;\n", ioy);
+		writeFloat(mFile,"\tsetAttr \".ior.ioy\" ",ioy,";\n");
 	}
 	void setInitialOrientationZ(double ioz)
 	{
 		if(ioz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ior.ioz\" %f;\n", ioz);
+		writeFloat(mFile,"\tsetAttr \".ior.ioz\" ",ioz,";\n");
 	}
 	void setInitialVelocity(const double3& iv)
 	{
 		if(iv == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".iv\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".iv\" -type \"double3\" ");
 		iv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialVelocityX(double ivx)
 	{
 		if(ivx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".iv.ivx\" %f;\n", ivx);
+		writeFloat(mFile,"\tsetAttr \".iv.ivx\" ",ivx,";\n");
 	}
 	void setInitialVelocityY(double ivy)
 	{
 		if(ivy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".iv.ivy\" %f;\n", ivy);
+		writeFloat(mFile,"\tsetAttr \".iv.ivy\" ",ivy,";\n");
 	}
 	void setInitialVelocityZ(double ivz)
 	{
 		if(ivz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".iv.ivz\" %f;\n", ivz);
+		writeFloat(mFile,"\tsetAttr \".iv.ivz\" ",ivz,";\n");
 	}
 	void setInitialSpin(const double3& is)
 	{
 		if(is == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".is\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".is\" -type \"double3\" ");
 		is.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialSpinX(double isx)
 	{
 		if(isx == 0) return;
-		fprintf(mFile,"\tsetAttr \".is.isx\" %f;\n", isx);
+		writeFloat(mFile,"\tsetAttr \".is.isx\" ",isx,";\n");
 	}
 	void setInitialSpinY(double isy)
 	{
 		if(isy == 0) return;
-		fprintf(mFile,"\tsetAttr \".is.isy\" %f;\n", isy);
+		writeFloat(mFile,"\tsetAttr \".is.isy\" ",isy,";\n");
 	}
 	void setInitialSpinZ(double isz)
 	{
 		if(isz == 0) return;
-		fprintf(mFile,"\tsetAttr \".is.isz\" %f;\n", isz);
+		writeFloat(mFile,"\tsetAttr \".is.isz\" ",isz,";\n");
 	}
 	void setCenterOfMass(const double3& com)
 	{
 		if(com == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".com\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".com\" -type \"double3\" ");
 		com.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCenterOfMassX(double cmx)
 	{
 		if(cmx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".com.cmx\" %f;\n", cmx);
+		writeFloat(mFile,"\tsetAttr \".com.cmx\" ",cmx,";\n");
 	}
 	void setCenterOfMassY(double cmy)
 	{
 		if(cmy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".com.cmy\" %f;\n", cmy);
+		writeFloat(mFile,"\tsetAttr \".com.cmy\" ",cmy,";\n");
 	}
 	void setCenterOfMassZ(double cmz)
 	{
 		if(cmz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".com.cmz\" %f;\n", cmz);
+		writeFloat(mFile,"\tsetAttr \".com.cmz\" ",cmz,";\n");
 	}
 	void setImpulse(const double3& imp)
 	{
 		if(imp == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".imp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".imp\" -type \"double3\" ");
 		imp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImpulseX(double imx)
 	{
 		if(imx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imp.imx\" %f;\n", imx);
+		writeFloat(mFile,"\tsetAttr \".imp.imx\" ",imx,";\n");
 	}
 	void setImpulseY(double imy)
 	{
 		if(imy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imp.imy\" %f;\n", imy);
+		writeFloat(mFile,"\tsetAttr \".imp.imy\" ",imy,";\n");
 	}
 	void setImpulseZ(double imz)
 	{
 		if(imz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imp.imz\" %f;\n", imz);
+		writeFloat(mFile,"\tsetAttr \".imp.imz\" ",imz,";\n");
 	}
 	void setImpulsePosition(const double3& ipo)
 	{
 		if(ipo == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".ipo\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ipo\" -type \"double3\" ");
 		ipo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImpulsePositionX(double pix)
 	{
 		if(pix == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ipo.pix\" %f;\n", pix);
+		writeFloat(mFile,"\tsetAttr \".ipo.pix\" ",pix,";\n");
 	}
 	void setImpulsePositionY(double piy)
 	{
 		if(piy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ipo.piy\" %f;\n", piy);
+		writeFloat(mFile,"\tsetAttr \".ipo.piy\" ",piy,";\n");
 	}
 	void setImpulsePositionZ(double piz)
 	{
 		if(piz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ipo.piz\" %f;\n", piz);
+		writeFloat(mFile,"\tsetAttr \".ipo.piz\" ",piz,";\n");
 	}
 	void setSpinImpulse(const double3& sim)
 	{
 		if(sim == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".sim\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".sim\" -type \"double3\" ");
 		sim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSpinImpulseX(double six)
 	{
 		if(six == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sim.six\" %f;\n", six);
+		writeFloat(mFile,"\tsetAttr \".sim.six\" ",six,";\n");
 	}
 	void setSpinImpulseY(double siy)
 	{
 		if(siy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sim.siy\" %f;\n", siy);
+		writeFloat(mFile,"\tsetAttr \".sim.siy\" ",siy,";\n");
 	}
 	void setSpinImpulseZ(double siz)
 	{
 		if(siz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sim.siz\" %f;\n", siz);
+		writeFloat(mFile,"\tsetAttr \".sim.siz\" ",siz,";\n");
 	}
 	void setMass(double mas)
 	{
 		if(mas == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mas\" %f;\n", mas);
+		writeFloat(mFile,"\tsetAttr \".mas\" ",mas,";\n");
 	}
 	void setBounciness(double b)
 	{
 		if(b == 0.6) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setDamping(double dp)
 	{
 		if(dp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dp\" %f;\n", dp);
+		writeFloat(mFile,"\tsetAttr \".dp\" ",dp,";\n");
 	}
 	void setStaticFriction(double sf)
 	{
 		if(sf == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".sf\" %f;\n", sf);
+		writeFloat(mFile,"\tsetAttr \".sf\" ",sf,";\n");
 	}
 	void setDynamicFriction(double df)
 	{
 		if(df == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".df\" %f;\n", df);
+		writeFloat(mFile,"\tsetAttr \".df\" ",df,";\n");
 	}
 	void setCollisionLayer(int cl)
 	{
 		if(cl == 0) return;
-		fprintf(mFile,"\tsetAttr \".cl\" %i;\n", cl);
+		writeInt(mFile,"\tsetAttr \".cl\" ",cl,";\n");
 	}
 	void setStandIn(unsigned int si)
 	{
 		if(si == 0) return;
-		fprintf(mFile,"\tsetAttr \".si\" %i;\n", si);
+		writeInt(mFile,"\tsetAttr \".si\" ",si,";\n");
 	}
 	void setInputGeometryCnt(int igc)
 	{
 		if(igc == 0) return;
-		fprintf(mFile,"\tsetAttr \".igc\" %i;\n", igc);
+		writeInt(mFile,"\tsetAttr \".igc\" ",igc,";\n");
 	}
 	void setActive(bool act)
 	{
 		if(act == true) return;
-		fprintf(mFile,"\tsetAttr \".act\" %i;\n", act);
+		writeInt(mFile,"\tsetAttr \".act\" ",act,";\n");
 	}
 	void setChoice(int chc)
 	{
 		if(chc == 0) return;
-		fprintf(mFile,"\tsetAttr \".chc\" %i;\n", chc);
+		writeInt(mFile,"\tsetAttr \".chc\" ",chc,";\n");
 	}
 	void setIsKinematic(bool kin)
 	{
 		if(kin == false) return;
-		fprintf(mFile,"\tsetAttr \".kin\" %i;\n", kin);
+		writeInt(mFile,"\tsetAttr \".kin\" ",kin,";\n");
 	}
 	void setIsKeyframed(bool key)
 	{
 		if(key == false) return;
-		fprintf(mFile,"\tsetAttr \".key\" %i;\n", key);
+		writeInt(mFile,"\tsetAttr \".key\" ",key,";\n");
 	}
 	void setIsParented(bool par)
 	{
 		if(par == false) return;
-		fprintf(mFile,"\tsetAttr \".par\" %i;\n", par);
+		writeInt(mFile,"\tsetAttr \".par\" ",par,";\n");
 	}
 	void setParticleCollision(bool pc)
 	{
 		if(pc == false) return;
-		fprintf(mFile,"\tsetAttr \".pc\" %i;\n", pc);
+		writeInt(mFile,"\tsetAttr \".pc\" ",pc,";\n");
 	}
 	void setAutoInit(bool ai)
 	{
 		if(ai == true) return;
-		fprintf(mFile,"\tsetAttr \".ai\" %i;\n", ai);
+		writeInt(mFile,"\tsetAttr \".ai\" ",ai,";\n");
 	}
 	void setAllowDisconnection(bool ad)
 	{
 		if(ad == false) return;
-		fprintf(mFile,"\tsetAttr \".ad\" %i;\n", ad);
+		writeInt(mFile,"\tsetAttr \".ad\" ",ad,";\n");
 	}
 	void setCacheData(bool idc)
 	{
 		if(idc == false) return;
-		fprintf(mFile,"\tsetAttr \".idc\" %i;\n", idc);
+		writeInt(mFile,"\tsetAttr \".idc\" ",idc,";\n");
 	}
 	void setTessellationFactor(int tes)
 	{
 		if(tes == 200) return;
-		fprintf(mFile,"\tsetAttr \".tes\" %i;\n", tes);
+		writeInt(mFile,"\tsetAttr \".tes\" ",tes,";\n");
 	}
 	void setInputForceType(size_t ift_i,bool ift)
 	{
 		if(ift == false) return;
-		fprintf(mFile,"\tsetAttr \".ift[%i]\" %i;\n", ift_i,ift);
+		writeInt(mFile,"\tsetAttr \".ift[",ift_i); writeInt(mFile,"]\" ",ift,";\n");
 	}
 	void setInputForceType(size_t ift_start,size_t ift_end,bool* ift)
 	{
-		fprintf(mFile,"\tsetAttr \".ift[%i:%i]\" ", ift_start,ift_end);
+		writeInt(mFile,"\tsetAttr \".ift[",ift_start); writeInt(mFile,":",ift_end,"]\" ");
 		size_t size = (ift_end-ift_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ift[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ift[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInputForceType(size_t ift_start,size_t ift_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ift[%i:%i]\"",ift_start,ift_end);
+		writeInt(mFile,"\tsetAttr \".ift[",ift_start); writeInt(mFile,":",ift_end,"]\"");
 	}
 	void appendInputForceType(bool ift)const
 	{
-		fprintf(mFile," %i",ift);
+		writeInt(mFile," ",ift);
 	}
 	void endInputForceType()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSolverId(int sid)
 	{
 		if(sid == -1) return;
-		fprintf(mFile,"\tsetAttr \".sid\" %i;\n", sid);
+		writeInt(mFile,"\tsetAttr \".sid\" ",sid,";\n");
 	}
 	void setBakeSimulationIndex(int bsi)
 	{
 		if(bsi == -1) return;
-		fprintf(mFile,"\tsetAttr \".bsi\" %i;\n", bsi);
+		writeInt(mFile,"\tsetAttr \".bsi\" ",bsi,";\n");
 	}
 	void setLockCenterOfMass(bool lcm)
 	{
 		if(lcm == false) return;
-		fprintf(mFile,"\tsetAttr \".lcm\" %i;\n", lcm);
+		writeInt(mFile,"\tsetAttr \".lcm\" ",lcm,";\n");
 	}
 	void setIgnore(bool ign)
 	{
 		if(ign == false) return;
-		fprintf(mFile,"\tsetAttr \".ign\" %i;\n", ign);
+		writeInt(mFile,"\tsetAttr \".ign\" ",ign,";\n");
 	}
 	void setCollisions(bool col)
 	{
 		if(col == true) return;
-		fprintf(mFile,"\tsetAttr \".col\" %i;\n", col);
+		writeInt(mFile,"\tsetAttr \".col\" ",col,";\n");
 	}
 	void setApplyForceAt(unsigned int afa)
 	{
 		if(afa == 1) return;
-		fprintf(mFile,"\tsetAttr \".afa\" %i;\n", afa);
+		writeInt(mFile,"\tsetAttr \".afa\" ",afa,";\n");
 	}
 	void setDebugDraw(bool dd)
 	{
 		if(dd == false) return;
-		fprintf(mFile,"\tsetAttr \".dd\" %i;\n", dd);
+		writeInt(mFile,"\tsetAttr \".dd\" ",dd,";\n");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getRigidWorldMatrix()const
 	{
-		fprintf(mFile,"\"%s.rmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rmx\"");
 	}
 	void getInputGeometryMsg(size_t igm_i)const
 	{
-		fprintf(mFile,"\"%s.igm[%i]\"",mName.c_str(),igm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".igm[",igm_i,"]\"");
 	}
 	void getInputGeometryMsg()const
 	{
 
-		fprintf(mFile,"\"%s.igm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igm\"");
 	}
 	void getFieldConnections(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i]\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"]\"");
 	}
 	void getFieldConnections()const
 	{
 
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getRunUpCache()const
 	{
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getDataCache()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getFirstCachedFrame()const
 	{
-		fprintf(mFile,"\"%s.fcf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcf\"");
 	}
 	void getLastCachedFrame()const
 	{
-		fprintf(mFile,"\"%s.lcf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcf\"");
 	}
 	void getCachedFrameCount()const
 	{
-		fprintf(mFile,"\"%s.cfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfc\"");
 	}
 	void getCacheDirtyArray()const
 	{
-		fprintf(mFile,"\"%s.cda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cda\"");
 	}
 	void getContactName(size_t cnn_i)const
 	{
-		fprintf(mFile,"\"%s.cnn[%i]\"",mName.c_str(),cnn_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cnn[",cnn_i,"]\"");
 	}
 	void getContactName()const
 	{
 
-		fprintf(mFile,"\"%s.cnn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnn\"");
 	}
 	void getInterpenetrateWith(size_t itw_i)const
 	{
-		fprintf(mFile,"\"%s.itw[%i]\"",mName.c_str(),itw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".itw[",itw_i,"]\"");
 	}
 	void getInterpenetrateWith()const
 	{
 
-		fprintf(mFile,"\"%s.itw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itw\"");
 	}
 	void getInitialPositionX()const
 	{
-		fprintf(mFile,"\"%s.ip.ipx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipx\"");
 	}
 	void getInitialPositionY()const
 	{
-		fprintf(mFile,"\"%s.ip.ipy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipy\"");
 	}
 	void getInitialPositionZ()const
 	{
-		fprintf(mFile,"\"%s.ip.ipz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipz\"");
 	}
 	void getLastPositionX()const
 	{
-		fprintf(mFile,"\"%s.lp.lpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpx\"");
 	}
 	void getLastPositionY()const
 	{
-		fprintf(mFile,"\"%s.lp.lpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpy\"");
 	}
 	void getLastPositionZ()const
 	{
-		fprintf(mFile,"\"%s.lp.lpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpz\"");
 	}
 	void getLastRotationX()const
 	{
-		fprintf(mFile,"\"%s.lr.lrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lrx\"");
 	}
 	void getLastRotationY()const
 	{
-		fprintf(mFile,"\"%s.lr.lry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lry\"");
 	}
 	void getLastRotationZ()const
 	{
-		fprintf(mFile,"\"%s.lr.lrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lr.lrz\"");
 	}
 	void getInitialOrientationX()const
 	{
-		fprintf(mFile,"\"%s.ior.iox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ior.iox\"");
 	}
 	void getInitialOrientationY()const
 	{
-		fprintf(mFile,"\"%s.ior.ioy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ior.ioy\"");
 	}
 	void getInitialOrientationZ()const
 	{
-		fprintf(mFile,"\"%s.ior.ioz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ior.ioz\"");
 	}
 	void getInitialVelocity()const
 	{
-		fprintf(mFile,"\"%s.iv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iv\"");
 	}
 	void getInitialVelocityX()const
 	{
-		fprintf(mFile,"\"%s.iv.ivx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iv.ivx\"");
 	}
 	void getInitialVelocityY()const
 	{
-		fprintf(mFile,"\"%s.iv.ivy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iv.ivy\"");
 	}
 	void getInitialVelocityZ()const
 	{
-		fprintf(mFile,"\"%s.iv.ivz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iv.ivz\"");
 	}
 	void getInitialSpin()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInitialSpinX()const
 	{
-		fprintf(mFile,"\"%s.is.isx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isx\"");
 	}
 	void getInitialSpinY()const
 	{
-		fprintf(mFile,"\"%s.is.isy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isy\"");
 	}
 	void getInitialSpinZ()const
 	{
-		fprintf(mFile,"\"%s.is.isz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isz\"");
 	}
 	void getCenterOfMass()const
 	{
-		fprintf(mFile,"\"%s.com\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".com\"");
 	}
 	void getCenterOfMassX()const
 	{
-		fprintf(mFile,"\"%s.com.cmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".com.cmx\"");
 	}
 	void getCenterOfMassY()const
 	{
-		fprintf(mFile,"\"%s.com.cmy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".com.cmy\"");
 	}
 	void getCenterOfMassZ()const
 	{
-		fprintf(mFile,"\"%s.com.cmz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".com.cmz\"");
 	}
 	void getImpulse()const
 	{
-		fprintf(mFile,"\"%s.imp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp\"");
 	}
 	void getImpulseX()const
 	{
-		fprintf(mFile,"\"%s.imp.imx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp.imx\"");
 	}
 	void getImpulseY()const
 	{
-		fprintf(mFile,"\"%s.imp.imy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp.imy\"");
 	}
 	void getImpulseZ()const
 	{
-		fprintf(mFile,"\"%s.imp.imz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp.imz\"");
 	}
 	void getImpulsePosition()const
 	{
-		fprintf(mFile,"\"%s.ipo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ipo\"");
 	}
 	void getImpulsePositionX()const
 	{
-		fprintf(mFile,"\"%s.ipo.pix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ipo.pix\"");
 	}
 	void getImpulsePositionY()const
 	{
-		fprintf(mFile,"\"%s.ipo.piy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ipo.piy\"");
 	}
 	void getImpulsePositionZ()const
 	{
-		fprintf(mFile,"\"%s.ipo.piz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ipo.piz\"");
 	}
 	void getSpinImpulse()const
 	{
-		fprintf(mFile,"\"%s.sim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sim\"");
 	}
 	void getSpinImpulseX()const
 	{
-		fprintf(mFile,"\"%s.sim.six\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sim.six\"");
 	}
 	void getSpinImpulseY()const
 	{
-		fprintf(mFile,"\"%s.sim.siy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sim.siy\"");
 	}
 	void getSpinImpulseZ()const
 	{
-		fprintf(mFile,"\"%s.sim.siz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sim.siz\"");
 	}
 	void getMass()const
 	{
-		fprintf(mFile,"\"%s.mas\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mas\"");
 	}
 	void getVolume()const
 	{
-		fprintf(mFile,"\"%s.vol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vol\"");
 	}
 	void getBounciness()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getDamping()const
 	{
-		fprintf(mFile,"\"%s.dp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dp\"");
 	}
 	void getStaticFriction()const
 	{
-		fprintf(mFile,"\"%s.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sf\"");
 	}
 	void getDynamicFriction()const
 	{
-		fprintf(mFile,"\"%s.df\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".df\"");
 	}
 	void getCollisionLayer()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getStandIn()const
 	{
-		fprintf(mFile,"\"%s.si\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".si\"");
 	}
 	void getInputGeometryCnt()const
 	{
-		fprintf(mFile,"\"%s.igc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".igc\"");
 	}
 	void getActive()const
 	{
-		fprintf(mFile,"\"%s.act\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".act\"");
 	}
 	void getChoice()const
 	{
-		fprintf(mFile,"\"%s.chc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".chc\"");
 	}
 	void getIsKinematic()const
 	{
-		fprintf(mFile,"\"%s.kin\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kin\"");
 	}
 	void getIsKeyframed()const
 	{
-		fprintf(mFile,"\"%s.key\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".key\"");
 	}
 	void getIsParented()const
 	{
-		fprintf(mFile,"\"%s.par\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".par\"");
 	}
 	void getParticleCollision()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getAutoInit()const
 	{
-		fprintf(mFile,"\"%s.ai\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ai\"");
 	}
 	void getAllowDisconnection()const
 	{
-		fprintf(mFile,"\"%s.ad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ad\"");
 	}
 	void getCacheData()const
 	{
-		fprintf(mFile,"\"%s.idc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".idc\"");
 	}
 	void getVelocity()const
 	{
-		fprintf(mFile,"\"%s.vel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel\"");
 	}
 	void getVelocityX()const
 	{
-		fprintf(mFile,"\"%s.vel.vx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.vx\"");
 	}
 	void getVelocityY()const
 	{
-		fprintf(mFile,"\"%s.vel.vy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.vy\"");
 	}
 	void getVelocityZ()const
 	{
-		fprintf(mFile,"\"%s.vel.vz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.vz\"");
 	}
 	void getSpin()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getSpinX()const
 	{
-		fprintf(mFile,"\"%s.sp.spx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spx\"");
 	}
 	void getSpinY()const
 	{
-		fprintf(mFile,"\"%s.sp.spy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spy\"");
 	}
 	void getSpinZ()const
 	{
-		fprintf(mFile,"\"%s.sp.spz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spz\"");
 	}
 	void getContactCount()const
 	{
-		fprintf(mFile,"\"%s.cct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cct\"");
 	}
 	void getContactPosition(size_t cnp_i)const
 	{
-		fprintf(mFile,"\"%s.cnp[%i]\"",mName.c_str(),cnp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cnp[",cnp_i,"]\"");
 	}
 	void getContactPosition()const
 	{
 
-		fprintf(mFile,"\"%s.cnp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnp\"");
 	}
 	void getContactX(size_t cnp_i)const
 	{
-		fprintf(mFile,"\"%s.cnp[%i].cnx\"",mName.c_str(),cnp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cnp[",cnp_i,"].cnx\"");
 	}
 	void getContactX()const
 	{
 
-		fprintf(mFile,"\"%s.cnp.cnx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnp.cnx\"");
 	}
 	void getContactY(size_t cnp_i)const
 	{
-		fprintf(mFile,"\"%s.cnp[%i].cny\"",mName.c_str(),cnp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cnp[",cnp_i,"].cny\"");
 	}
 	void getContactY()const
 	{
 
-		fprintf(mFile,"\"%s.cnp.cny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnp.cny\"");
 	}
 	void getContactZ(size_t cnp_i)const
 	{
-		fprintf(mFile,"\"%s.cnp[%i].cnz\"",mName.c_str(),cnp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cnp[",cnp_i,"].cnz\"");
 	}
 	void getContactZ()const
 	{
 
-		fprintf(mFile,"\"%s.cnp.cnz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cnp.cnz\"");
 	}
 	void getForce()const
 	{
-		fprintf(mFile,"\"%s.for\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".for\"");
 	}
 	void getForceX()const
 	{
-		fprintf(mFile,"\"%s.for.fx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".for.fx\"");
 	}
 	void getForceY()const
 	{
-		fprintf(mFile,"\"%s.for.fy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".for.fy\"");
 	}
 	void getForceZ()const
 	{
-		fprintf(mFile,"\"%s.for.fz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".for.fz\"");
 	}
 	void getTorque()const
 	{
-		fprintf(mFile,"\"%s.tor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tor\"");
 	}
 	void getTorqueX()const
 	{
-		fprintf(mFile,"\"%s.tor.trx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tor.trx\"");
 	}
 	void getTorqueY()const
 	{
-		fprintf(mFile,"\"%s.tor.try\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tor.try\"");
 	}
 	void getTorqueZ()const
 	{
-		fprintf(mFile,"\"%s.tor.trz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tor.trz\"");
 	}
 	void getFieldData()const
 	{
-		fprintf(mFile,"\"%s.fld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fld\"");
 	}
 	void getFieldDataPosition()const
 	{
-		fprintf(mFile,"\"%s.fld.fdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fld.fdp\"");
 	}
 	void getFieldDataVelocity()const
 	{
-		fprintf(mFile,"\"%s.fld.fdv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fld.fdv\"");
 	}
 	void getFieldDataMass()const
 	{
-		fprintf(mFile,"\"%s.fld.fdm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fld.fdm\"");
 	}
 	void getDeltaTime()const
 	{
-		fprintf(mFile,"\"%s.fld.dt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fld.dt\"");
 	}
 	void getInputForce(size_t ifr_i)const
 	{
-		fprintf(mFile,"\"%s.ifr[%i]\"",mName.c_str(),ifr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ifr[",ifr_i,"]\"");
 	}
 	void getInputForce()const
 	{
 
-		fprintf(mFile,"\"%s.ifr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ifr\"");
 	}
 	void getInputForceType(size_t ift_i)const
 	{
-		fprintf(mFile,"\"%s.ift[%i]\"",mName.c_str(),ift_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ift[",ift_i,"]\"");
 	}
 	void getInputForceType()const
 	{
 
-		fprintf(mFile,"\"%s.ift\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ift\"");
 	}
 	void getCollisionRecords(size_t crc_i)const
 	{
-		fprintf(mFile,"\"%s.crc[%i]\"",mName.c_str(),crc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crc[",crc_i,"]\"");
 	}
 	void getCollisionRecords()const
 	{
 
-		fprintf(mFile,"\"%s.crc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crc\"");
 	}
 	void getGeneralForce()const
 	{
-		fprintf(mFile,"\"%s.gfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gfr\"");
 	}
 	void getOutputForce()const
 	{
-		fprintf(mFile,"\"%s.gfr.ofr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gfr.ofr\"");
 	}
 	void getOutputTorque()const
 	{
-		fprintf(mFile,"\"%s.gfr.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gfr.otr\"");
 	}
 	void getSolverId()const
 	{
-		fprintf(mFile,"\"%s.sid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sid\"");
 	}
 	void getBakeSimulationIndex()const
 	{
-		fprintf(mFile,"\"%s.bsi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bsi\"");
 	}
 	void getShapeChanged()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getLockCenterOfMass()const
 	{
-		fprintf(mFile,"\"%s.lcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lcm\"");
 	}
 	void getIgnore()const
 	{
-		fprintf(mFile,"\"%s.ign\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ign\"");
 	}
 	void getCollisions()const
 	{
-		fprintf(mFile,"\"%s.col\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col\"");
 	}
 	void getApplyForceAt()const
 	{
-		fprintf(mFile,"\"%s.afa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".afa\"");
 	}
 	void getDebugDraw()const
 	{
-		fprintf(mFile,"\"%s.dd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dd\"");
 	}
 protected:
 	RigidBody(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
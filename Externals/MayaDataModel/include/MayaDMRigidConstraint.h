@@ -27,229 +27,229 @@ public:
 	void setConstraintType(unsigned int typ)
 	{
 		if(typ == 1) return;
-		fprintf(mFile,"\tsetAttr \".typ\" %i;\n", typ);
+		writeInt(mFile,"\tsetAttr \".typ\" ",typ,";\n");
 	}
 	void setInitialPosition(const double3& ip)
 	{
 		if(ip == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ip\" -type \"double3\" ");
 		ip.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialPositionX(double ipx)
 	{
 		if(ipx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipx\" %f;\n", ipx);
+		writeFloat(mFile,"\tsetAttr \".ip.ipx\" ",ipx,";\n");
 	}
 	void setInitialPositionY(double ipy)
 	{
 		if(ipy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipy\" %f;\n", ipy);
+		writeFloat(mFile,"\tsetAttr \".ip.ipy\" ",ipy,";\n");
 	}
 	void setInitialPositionZ(double ipz)
 	{
 		if(ipz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ip.ipz\" %f;\n", ipz);
+		writeFloat(mFile,"\tsetAttr \".ip.ipz\" ",ipz,";\n");
 	}
 	void setInitialOrientation(const double3& ino)
 	{
 		if(ino == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".ino\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ino\" -type \"double3\" ");
 		ino.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInitialOrientationX(double iox)
 	{
 		if(iox == 0) return;
-		fprintf(mFile,"\tsetAttr \".ino.iox\" %f;\n", iox);
+		writeFloat(mFile,"\tsetAttr \".ino.iox\" ",iox,";\n");
 	}
 	void setInitialOrientationY(double ioy)
 	{
 		if(ioy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ino.ioy\" %f;\n", ioy);
+		writeFloat(mFile,"\tsetAttr \".ino.ioy\" ",ioy,";\n");
 	}
 	void setInitialOrientationZ(double ioz)
 	{
 		if(ioz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ino.ioz\" %f;\n", ioz);
+		writeFloat(mFile,"\tsetAttr \".ino.ioz\" ",ioz,";\n");
 	}
 	void setSpringStiffness(double sst)
 	{
 		if(sst == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".sst\" %f;\n", sst);
+		writeFloat(mFile,"\tsetAttr \".sst\" ",sst,";\n");
 	}
 	void setSpringDamping(double dmp)
 	{
 		if(dmp == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".dmp\" %f;\n", dmp);
+		writeFloat(mFile,"\tsetAttr \".dmp\" ",dmp,";\n");
 	}
 	void setSpringRestLength(double srl)
 	{
 		if(srl == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".srl\" %f;\n", srl);
+		writeFloat(mFile,"\tsetAttr \".srl\" ",srl,";\n");
 	}
 	void setInterpenetrate(bool int_)
 	{
 		if(int_ == false) return;
-		fprintf(mFile,"\tsetAttr \".int\" %i;\n", int_);
+		writeInt(mFile,"\tsetAttr \".int\" ",int_,";\n");
 	}
 	void setIsParented(bool par)
 	{
 		if(par == false) return;
-		fprintf(mFile,"\tsetAttr \".par\" %i;\n", par);
+		writeInt(mFile,"\tsetAttr \".par\" ",par,";\n");
 	}
 	void setSolverId(int sid)
 	{
 		if(sid == -1) return;
-		fprintf(mFile,"\tsetAttr \".sid\" %i;\n", sid);
+		writeInt(mFile,"\tsetAttr \".sid\" ",sid,";\n");
 	}
 	void setConstrain(bool con)
 	{
 		if(con == true) return;
-		fprintf(mFile,"\tsetAttr \".con\" %i;\n", con);
+		writeInt(mFile,"\tsetAttr \".con\" ",con,";\n");
 	}
 	void setRelativeTo(unsigned int rlt)
 	{
 		if(rlt == 0) return;
-		fprintf(mFile,"\tsetAttr \".rlt\" %i;\n", rlt);
+		writeInt(mFile,"\tsetAttr \".rlt\" ",rlt,";\n");
 	}
 	void setUserDefinedPosition(const double3& udp)
 	{
 		if(udp == double3(0, 0, 0)) return;
-		fprintf(mFile,"\tsetAttr \".udp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".udp\" -type \"double3\" ");
 		udp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUserDefinedPositionX(double upx)
 	{
 		if(upx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".udp.upx\" %f;\n", upx);
+		writeFloat(mFile,"\tsetAttr \".udp.upx\" ",upx,";\n");
 	}
 	void setUserDefinedPositionY(double upy)
 	{
 		if(upy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".udp.upy\" %f;\n", upy);
+		writeFloat(mFile,"\tsetAttr \".udp.upy\" ",upy,";\n");
 	}
 	void setUserDefinedPositionZ(double upz)
 	{
 		if(upz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".udp.upz\" %f;\n", upz);
+		writeFloat(mFile,"\tsetAttr \".udp.upz\" ",upz,";\n");
 	}
 	void getRigidBody1()const
 	{
-		fprintf(mFile,"\"%s.rb1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rb1\"");
 	}
 	void getRigidBody2()const
 	{
-		fprintf(mFile,"\"%s.rb2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rb2\"");
 	}
 	void getConstraintType()const
 	{
-		fprintf(mFile,"\"%s.typ\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".typ\"");
 	}
 	void getInitialPositionX()const
 	{
-		fprintf(mFile,"\"%s.ip.ipx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipx\"");
 	}
 	void getInitialPositionY()const
 	{
-		fprintf(mFile,"\"%s.ip.ipy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipy\"");
 	}
 	void getInitialPositionZ()const
 	{
-		fprintf(mFile,"\"%s.ip.ipz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip.ipz\"");
 	}
 	void getVelocity()const
 	{
-		fprintf(mFile,"\"%s.vel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel\"");
 	}
 	void getVelocityX()const
 	{
-		fprintf(mFile,"\"%s.vel.vlx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.vlx\"");
 	}
 	void getVelocityY()const
 	{
-		fprintf(mFile,"\"%s.vel.vly\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.vly\"");
 	}
 	void getVelocityZ()const
 	{
-		fprintf(mFile,"\"%s.vel.vlz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vel.vlz\"");
 	}
 	void getAngularVelocity()const
 	{
-		fprintf(mFile,"\"%s.avl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".avl\"");
 	}
 	void getAngularVelocityX()const
 	{
-		fprintf(mFile,"\"%s.avl.avx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".avl.avx\"");
 	}
 	void getAngularVelocityY()const
 	{
-		fprintf(mFile,"\"%s.avl.avy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".avl.avy\"");
 	}
 	void getAngularVelocityZ()const
 	{
-		fprintf(mFile,"\"%s.avl.avz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".avl.avz\"");
 	}
 	void getInitialOrientationX()const
 	{
-		fprintf(mFile,"\"%s.ino.iox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ino.iox\"");
 	}
 	void getInitialOrientationY()const
 	{
-		fprintf(mFile,"\"%s.ino.ioy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ino.ioy\"");
 	}
 	void getInitialOrientationZ()const
 	{
-		fprintf(mFile,"\"%s.ino.ioz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ino.ioz\"");
 	}
 	void getSpringStiffness()const
 	{
-		fprintf(mFile,"\"%s.sst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sst\"");
 	}
 	void getSpringDamping()const
 	{
-		fprintf(mFile,"\"%s.dmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmp\"");
 	}
 	void getSpringRestLength()const
 	{
-		fprintf(mFile,"\"%s.srl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".srl\"");
 	}
 	void getInterpenetrate()const
 	{
-		fprintf(mFile,"\"%s.int\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".int\"");
 	}
 	void getIsParented()const
 	{
-		fprintf(mFile,"\"%s.par\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".par\"");
 	}
 	void getIsBounded()const
 	{
-		fprintf(mFile,"\"%s.bon\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bon\"");
 	}
 	void getSolverId()const
 	{
-		fprintf(mFile,"\"%s.sid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sid\"");
 	}
 	void getConstrain()const
 	{
-		fprintf(mFile,"\"%s.con\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".con\"");
 	}
 	void getRelativeTo()const
 	{
-		fprintf(mFile,"\"%s.rlt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rlt\"");
 	}
 	void getUserDefinedPositionX()const
 	{
-		fprintf(mFile,"\"%s.udp.upx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udp.upx\"");
 	}
 	void getUserDefinedPositionY()const
 	{
-		fprintf(mFile,"\"%s.udp.upy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udp.upy\"");
 	}
 	void getUserDefinedPositionZ()const
 	{
-		fprintf(mFile,"\"%s.udp.upz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udp.upz\"");
 	}
 protected:
 	RigidConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,7 +23,7 @@ public:
 		void write(FILE* file) const
 		{
 			inputForce.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			inputTorque.write(file);
 		}
 	};
@@ -37,554 +37,554 @@ public:
 	void setStartTime(double stm)
 	{
 		if(stm == 0) return;
-		fprintf(mFile,"\tsetAttr \".stm\" %f;\n", stm);
+		writeFloat(mFile,"\tsetAttr \".stm\" ",stm,";\n");
 	}
 	void setGeneralForce(size_t gfr_i,const GeneralForce& gfr)
 	{
-		fprintf(mFile,"\tsetAttr \".gfr[%i]\" ",gfr_i);
+		writeInt(mFile,"\tsetAttr \".gfr[",gfr_i,"]\" ");
 		gfr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGeneralForce(size_t gfr_start,size_t gfr_end,GeneralForce* gfr)
 	{
-		fprintf(mFile,"\tsetAttr \".gfr[%i:%i]\" ", gfr_start,gfr_end);
+		writeInt(mFile,"\tsetAttr \".gfr[",gfr_start); writeInt(mFile,":",gfr_end,"]\" ");
 		size_t size = (gfr_end-gfr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			gfr[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGeneralForce(size_t gfr_start,size_t gfr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".gfr[%i:%i]\"",gfr_start,gfr_end);
-		fprintf(mFile," -type \"GeneralForce\" ");
+		writeInt(mFile,"\tsetAttr \".gfr[",gfr_start); writeInt(mFile,":",gfr_end,"]\"");
+		writeString(mFile," -type \"GeneralForce\" ");
 	}
 	void appendGeneralForce(const GeneralForce& gfr)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		gfr.write(mFile);
 	}
 	void endGeneralForce()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputForce(size_t gfr_i,const vectorArray& ifr)
 	{
 		if(ifr.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".gfr[%i].ifr\" -type \"vectorArray\" ",gfr_i);
+		writeInt(mFile,"\tsetAttr \".gfr[",gfr_i,"].ifr\" -type \"vectorArray\" ");
 		ifr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputTorque(size_t gfr_i,const vectorArray& itr)
 	{
 		if(itr.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".gfr[%i].itr\" -type \"vectorArray\" ",gfr_i);
+		writeInt(mFile,"\tsetAttr \".gfr[",gfr_i,"].itr\" -type \"vectorArray\" ");
 		itr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslate(size_t t_i,const double3& t)
 	{
-		fprintf(mFile,"\tsetAttr \".t[%i]\" -type \"double3\" ",t_i);
+		writeInt(mFile,"\tsetAttr \".t[",t_i,"]\" -type \"double3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslate(size_t t_start,size_t t_end,double* t)
 	{
-		fprintf(mFile,"\tsetAttr \".t[%i:%i]\" ", t_start,t_end);
+		writeInt(mFile,"\tsetAttr \".t[",t_start); writeInt(mFile,":",t_end,"]\" ");
 		size_t size = (t_end-t_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",t[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",t[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTranslate(size_t t_start,size_t t_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".t[%i:%i]\"",t_start,t_end);
+		writeInt(mFile,"\tsetAttr \".t[",t_start); writeInt(mFile,":",t_end,"]\"");
 	}
 	void appendTranslate(double t)const
 	{
-		fprintf(mFile," %f",t);
+		writeFloat(mFile," ",t);
 	}
 	void endTranslate()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslateX(size_t t_i,double tx)
 	{
 		if(tx == 0) return;
-		fprintf(mFile,"\tsetAttr \".t[%i].tx\" %f;\n", t_i,tx);
+		writeInt(mFile,"\tsetAttr \".t[",t_i); writeFloat(mFile,"].tx\" ",tx,";\n");
 	}
 	void setTranslateY(size_t t_i,double ty)
 	{
 		if(ty == 0) return;
-		fprintf(mFile,"\tsetAttr \".t[%i].ty\" %f;\n", t_i,ty);
+		writeInt(mFile,"\tsetAttr \".t[",t_i); writeFloat(mFile,"].ty\" ",ty,";\n");
 	}
 	void setTranslateZ(size_t t_i,double tz)
 	{
 		if(tz == 0) return;
-		fprintf(mFile,"\tsetAttr \".t[%i].tz\" %f;\n", t_i,tz);
+		writeInt(mFile,"\tsetAttr \".t[",t_i); writeFloat(mFile,"].tz\" ",tz,";\n");
 	}
 	void setRotate(size_t r_i,const double3& r)
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i]\" -type \"double3\" ",r_i);
+		writeInt(mFile,"\tsetAttr \".r[",r_i,"]\" -type \"double3\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotate(size_t r_start,size_t r_end,double* r)
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i:%i]\" ", r_start,r_end);
+		writeInt(mFile,"\tsetAttr \".r[",r_start); writeInt(mFile,":",r_end,"]\" ");
 		size_t size = (r_end-r_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",r[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",r[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startRotate(size_t r_start,size_t r_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".r[%i:%i]\"",r_start,r_end);
+		writeInt(mFile,"\tsetAttr \".r[",r_start); writeInt(mFile,":",r_end,"]\"");
 	}
 	void appendRotate(double r)const
 	{
-		fprintf(mFile," %f",r);
+		writeFloat(mFile," ",r);
 	}
 	void endRotate()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateX(size_t r_i,double rx)
 	{
 		if(rx == 0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].rx\" %f;\n", r_i,rx);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeFloat(mFile,"].rx\" ",rx,";\n");
 	}
 	void setRotateY(size_t r_i,double ry)
 	{
 		if(ry == 0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].ry\" %f;\n", r_i,ry);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeFloat(mFile,"].ry\" ",ry,";\n");
 	}
 	void setRotateZ(size_t r_i,double rz)
 	{
 		if(rz == 0) return;
-		fprintf(mFile,"\tsetAttr \".r[%i].rz\" %f;\n", r_i,rz);
+		writeInt(mFile,"\tsetAttr \".r[",r_i); writeFloat(mFile,"].rz\" ",rz,";\n");
 	}
 	void setConstraintTranslate(size_t ctr_i,const double3& ctr)
 	{
-		fprintf(mFile,"\tsetAttr \".ctr[%i]\" -type \"double3\" ",ctr_i);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_i,"]\" -type \"double3\" ");
 		ctr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintTranslate(size_t ctr_start,size_t ctr_end,double* ctr)
 	{
-		fprintf(mFile,"\tsetAttr \".ctr[%i:%i]\" ", ctr_start,ctr_end);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_start); writeInt(mFile,":",ctr_end,"]\" ");
 		size_t size = (ctr_end-ctr_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ctr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",ctr[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startConstraintTranslate(size_t ctr_start,size_t ctr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ctr[%i:%i]\"",ctr_start,ctr_end);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_start); writeInt(mFile,":",ctr_end,"]\"");
 	}
 	void appendConstraintTranslate(double ctr)const
 	{
-		fprintf(mFile," %f",ctr);
+		writeFloat(mFile," ",ctr);
 	}
 	void endConstraintTranslate()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintTranslateX(size_t ctr_i,double ctx)
 	{
 		if(ctx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ctr[%i].ctx\" %f;\n", ctr_i,ctx);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_i); writeFloat(mFile,"].ctx\" ",ctx,";\n");
 	}
 	void setConstraintTranslateY(size_t ctr_i,double cty)
 	{
 		if(cty == 0) return;
-		fprintf(mFile,"\tsetAttr \".ctr[%i].cty\" %f;\n", ctr_i,cty);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_i); writeFloat(mFile,"].cty\" ",cty,";\n");
 	}
 	void setConstraintTranslateZ(size_t ctr_i,double ctz)
 	{
 		if(ctz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ctr[%i].ctz\" %f;\n", ctr_i,ctz);
+		writeInt(mFile,"\tsetAttr \".ctr[",ctr_i); writeFloat(mFile,"].ctz\" ",ctz,";\n");
 	}
 	void setConstraintRotate(size_t cr_i,const double3& cr)
 	{
-		fprintf(mFile,"\tsetAttr \".cr[%i]\" -type \"double3\" ",cr_i);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_i,"]\" -type \"double3\" ");
 		cr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotate(size_t cr_start,size_t cr_end,double* cr)
 	{
-		fprintf(mFile,"\tsetAttr \".cr[%i:%i]\" ", cr_start,cr_end);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_start); writeInt(mFile,":",cr_end,"]\" ");
 		size_t size = (cr_end-cr_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",cr[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startConstraintRotate(size_t cr_start,size_t cr_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cr[%i:%i]\"",cr_start,cr_end);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_start); writeInt(mFile,":",cr_end,"]\"");
 	}
 	void appendConstraintRotate(double cr)const
 	{
-		fprintf(mFile," %f",cr);
+		writeFloat(mFile," ",cr);
 	}
 	void endConstraintRotate()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setConstraintRotateX(size_t cr_i,double crx)
 	{
 		if(crx == 0) return;
-		fprintf(mFile,"\tsetAttr \".cr[%i].crx\" %f;\n", cr_i,crx);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_i); writeFloat(mFile,"].crx\" ",crx,";\n");
 	}
 	void setConstraintRotateY(size_t cr_i,double cry)
 	{
 		if(cry == 0) return;
-		fprintf(mFile,"\tsetAttr \".cr[%i].cry\" %f;\n", cr_i,cry);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_i); writeFloat(mFile,"].cry\" ",cry,";\n");
 	}
 	void setConstraintRotateZ(size_t cr_i,double crz)
 	{
 		if(crz == 0) return;
-		fprintf(mFile,"\tsetAttr \".cr[%i].crz\" %f;\n", cr_i,crz);
+		writeInt(mFile,"\tsetAttr \".cr[",cr_i); writeFloat(mFile,"].crz\" ",crz,";\n");
 	}
 	void setCollisionTolerance(double ctl)
 	{
 		if(ctl == 0.02) return;
-		fprintf(mFile,"\tsetAttr \".ctl\" %f;\n", ctl);
+		writeFloat(mFile,"\tsetAttr \".ctl\" ",ctl,";\n");
 	}
 	void setStepSize(double ss)
 	{
 		if(ss == 0.03) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %f;\n", ss);
+		writeFloat(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setScaleVelocity(double svv)
 	{
 		if(svv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".svv\" %f;\n", svv);
+		writeFloat(mFile,"\tsetAttr \".svv\" ",svv,";\n");
 	}
 	void setSolverMethod(unsigned int slm)
 	{
 		if(slm == 2) return;
-		fprintf(mFile,"\tsetAttr \".slm\" %i;\n", slm);
+		writeInt(mFile,"\tsetAttr \".slm\" ",slm,";\n");
 	}
 	void setFriction(bool f)
 	{
 		if(f == true) return;
-		fprintf(mFile,"\tsetAttr \".f\" %i;\n", f);
+		writeInt(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void setBounciness(bool b)
 	{
 		if(b == true) return;
-		fprintf(mFile,"\tsetAttr \".b\" %i;\n", b);
+		writeInt(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setDynamics(bool dyn)
 	{
 		if(dyn == true) return;
-		fprintf(mFile,"\tsetAttr \".dyn\" %i;\n", dyn);
+		writeInt(mFile,"\tsetAttr \".dyn\" ",dyn,";\n");
 	}
 	void setAutoSolverTolerances(bool ast)
 	{
 		if(ast == false) return;
-		fprintf(mFile,"\tsetAttr \".ast\" %i;\n", ast);
+		writeInt(mFile,"\tsetAttr \".ast\" ",ast,";\n");
 	}
 	void setDisplayVelocity(bool dv)
 	{
 		if(dv == false) return;
-		fprintf(mFile,"\tsetAttr \".dv\" %i;\n", dv);
+		writeInt(mFile,"\tsetAttr \".dv\" ",dv,";\n");
 	}
 	void setDisplayCenterOfMass(bool dcom)
 	{
 		if(dcom == true) return;
-		fprintf(mFile,"\tsetAttr \".dcom\" %i;\n", dcom);
+		writeInt(mFile,"\tsetAttr \".dcom\" ",dcom,";\n");
 	}
 	void setDisplayConstraint(bool dc)
 	{
 		if(dc == true) return;
-		fprintf(mFile,"\tsetAttr \".dc\" %i;\n", dc);
+		writeInt(mFile,"\tsetAttr \".dc\" ",dc,";\n");
 	}
 	void setDisplayLabel(bool dl)
 	{
 		if(dl == false) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %i;\n", dl);
+		writeInt(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setCacheData(bool cd)
 	{
 		if(cd == false) return;
-		fprintf(mFile,"\tsetAttr \".cd\" %i;\n", cd);
+		writeInt(mFile,"\tsetAttr \".cd\" ",cd,";\n");
 	}
 	void setContactData(bool ctd)
 	{
 		if(ctd == false) return;
-		fprintf(mFile,"\tsetAttr \".ctd\" %i;\n", ctd);
+		writeInt(mFile,"\tsetAttr \".ctd\" ",ctd,";\n");
 	}
 	void setState(bool stt)
 	{
 		if(stt == true) return;
-		fprintf(mFile,"\tsetAttr \".stt\" %i;\n", stt);
+		writeInt(mFile,"\tsetAttr \".stt\" ",stt,";\n");
 	}
 	void setCurrent(bool cur)
 	{
 		if(cur == false) return;
-		fprintf(mFile,"\tsetAttr \".cur\" %i;\n", cur);
+		writeInt(mFile,"\tsetAttr \".cur\" ",cur,";\n");
 	}
 	void setForceDynamics(bool fdn)
 	{
 		if(fdn == false) return;
-		fprintf(mFile,"\tsetAttr \".fdn\" %i;\n", fdn);
+		writeInt(mFile,"\tsetAttr \".fdn\" ",fdn,";\n");
 	}
 	void setAllowDisconnection(bool ad)
 	{
 		if(ad == false) return;
-		fprintf(mFile,"\tsetAttr \".ad\" %i;\n", ad);
+		writeInt(mFile,"\tsetAttr \".ad\" ",ad,";\n");
 	}
 	void setStatistics(bool st)
 	{
 		if(st == false) return;
-		fprintf(mFile,"\tsetAttr \".st\" %i;\n", st);
+		writeInt(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void getCurrentTime()const
 	{
-		fprintf(mFile,"\"%s.ct\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct\"");
 	}
 	void getStartTime()const
 	{
-		fprintf(mFile,"\"%s.stm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stm\"");
 	}
 	void getGeneralForce(size_t gfr_i)const
 	{
-		fprintf(mFile,"\"%s.gfr[%i]\"",mName.c_str(),gfr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gfr[",gfr_i,"]\"");
 	}
 	void getGeneralForce()const
 	{
 
-		fprintf(mFile,"\"%s.gfr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gfr\"");
 	}
 	void getInputForce(size_t gfr_i)const
 	{
-		fprintf(mFile,"\"%s.gfr[%i].ifr\"",mName.c_str(),gfr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gfr[",gfr_i,"].ifr\"");
 	}
 	void getInputForce()const
 	{
 
-		fprintf(mFile,"\"%s.gfr.ifr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gfr.ifr\"");
 	}
 	void getInputTorque(size_t gfr_i)const
 	{
-		fprintf(mFile,"\"%s.gfr[%i].itr\"",mName.c_str(),gfr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gfr[",gfr_i,"].itr\"");
 	}
 	void getInputTorque()const
 	{
 
-		fprintf(mFile,"\"%s.gfr.itr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gfr.itr\"");
 	}
 	void getTranslate(size_t t_i)const
 	{
-		fprintf(mFile,"\"%s.t[%i]\"",mName.c_str(),t_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".t[",t_i,"]\"");
 	}
 	void getTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTranslateX(size_t t_i)const
 	{
-		fprintf(mFile,"\"%s.t[%i].tx\"",mName.c_str(),t_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".t[",t_i,"].tx\"");
 	}
 	void getTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.t.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tx\"");
 	}
 	void getTranslateY(size_t t_i)const
 	{
-		fprintf(mFile,"\"%s.t[%i].ty\"",mName.c_str(),t_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".t[",t_i,"].ty\"");
 	}
 	void getTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.t.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.ty\"");
 	}
 	void getTranslateZ(size_t t_i)const
 	{
-		fprintf(mFile,"\"%s.t[%i].tz\"",mName.c_str(),t_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".t[",t_i,"].tz\"");
 	}
 	void getTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.t.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tz\"");
 	}
 	void getRotate(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i]\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"]\"");
 	}
 	void getRotate()const
 	{
 
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRotateX(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].rx\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].rx\"");
 	}
 	void getRotateX()const
 	{
 
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRotateY(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].ry\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].ry\"");
 	}
 	void getRotateY()const
 	{
 
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRotateZ(size_t r_i)const
 	{
-		fprintf(mFile,"\"%s.r[%i].rz\"",mName.c_str(),r_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".r[",r_i,"].rz\"");
 	}
 	void getRotateZ()const
 	{
 
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getConstraintTranslate(size_t ctr_i)const
 	{
-		fprintf(mFile,"\"%s.ctr[%i]\"",mName.c_str(),ctr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ctr[",ctr_i,"]\"");
 	}
 	void getConstraintTranslate()const
 	{
 
-		fprintf(mFile,"\"%s.ctr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctr\"");
 	}
 	void getConstraintTranslateX(size_t ctr_i)const
 	{
-		fprintf(mFile,"\"%s.ctr[%i].ctx\"",mName.c_str(),ctr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ctr[",ctr_i,"].ctx\"");
 	}
 	void getConstraintTranslateX()const
 	{
 
-		fprintf(mFile,"\"%s.ctr.ctx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctr.ctx\"");
 	}
 	void getConstraintTranslateY(size_t ctr_i)const
 	{
-		fprintf(mFile,"\"%s.ctr[%i].cty\"",mName.c_str(),ctr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ctr[",ctr_i,"].cty\"");
 	}
 	void getConstraintTranslateY()const
 	{
 
-		fprintf(mFile,"\"%s.ctr.cty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctr.cty\"");
 	}
 	void getConstraintTranslateZ(size_t ctr_i)const
 	{
-		fprintf(mFile,"\"%s.ctr[%i].ctz\"",mName.c_str(),ctr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ctr[",ctr_i,"].ctz\"");
 	}
 	void getConstraintTranslateZ()const
 	{
 
-		fprintf(mFile,"\"%s.ctr.ctz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctr.ctz\"");
 	}
 	void getConstraintRotate(size_t cr_i)const
 	{
-		fprintf(mFile,"\"%s.cr[%i]\"",mName.c_str(),cr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cr[",cr_i,"]\"");
 	}
 	void getConstraintRotate()const
 	{
 
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getConstraintRotateX(size_t cr_i)const
 	{
-		fprintf(mFile,"\"%s.cr[%i].crx\"",mName.c_str(),cr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cr[",cr_i,"].crx\"");
 	}
 	void getConstraintRotateX()const
 	{
 
-		fprintf(mFile,"\"%s.cr.crx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crx\"");
 	}
 	void getConstraintRotateY(size_t cr_i)const
 	{
-		fprintf(mFile,"\"%s.cr[%i].cry\"",mName.c_str(),cr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cr[",cr_i,"].cry\"");
 	}
 	void getConstraintRotateY()const
 	{
 
-		fprintf(mFile,"\"%s.cr.cry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.cry\"");
 	}
 	void getConstraintRotateZ(size_t cr_i)const
 	{
-		fprintf(mFile,"\"%s.cr[%i].crz\"",mName.c_str(),cr_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cr[",cr_i,"].crz\"");
 	}
 	void getConstraintRotateZ()const
 	{
 
-		fprintf(mFile,"\"%s.cr.crz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr.crz\"");
 	}
 	void getScaleVelocity()const
 	{
-		fprintf(mFile,"\"%s.svv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".svv\"");
 	}
 	void getSolverMethod()const
 	{
-		fprintf(mFile,"\"%s.slm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".slm\"");
 	}
 	void getFriction()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getBounciness()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getDynamics()const
 	{
-		fprintf(mFile,"\"%s.dyn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dyn\"");
 	}
 	void getAutoSolverTolerances()const
 	{
-		fprintf(mFile,"\"%s.ast\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ast\"");
 	}
 	void getDisplayVelocity()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getDisplayCenterOfMass()const
 	{
-		fprintf(mFile,"\"%s.dcom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcom\"");
 	}
 	void getDisplayConstraint()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getDisplayLabel()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getCacheData()const
 	{
-		fprintf(mFile,"\"%s.cd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cd\"");
 	}
 	void getContactData()const
 	{
-		fprintf(mFile,"\"%s.ctd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ctd\"");
 	}
 	void getState()const
 	{
-		fprintf(mFile,"\"%s.stt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".stt\"");
 	}
 protected:
 	RigidSolver(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,8 +23,8 @@ public:
 			short function_InmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", function_InmapTo);
-				fprintf(file,"%i", function_InmapFrom);
+				writeInt(file,"",function_InmapTo," ");
+				writeInt(file,"",function_InmapFrom);
 			}
 		}* function_Inmap;
 		size_t nbFunction_Inmap;
@@ -33,8 +33,8 @@ public:
 			short function_OutmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", function_OutmapTo);
-				fprintf(file,"%i", function_OutmapFrom);
+				writeInt(file,"",function_OutmapTo," ");
+				writeInt(file,"",function_OutmapFrom);
 			}
 		}* function_Outmap;
 		size_t nbFunction_Outmap;
@@ -44,16 +44,16 @@ public:
 			for (size_t i = 0; i<nbFunction_Inmap; ++i)
 			{
 				function_Inmap[i].write(file);
-				fprintf(file, " ");
-				if (i + 1<nbFunction_Inmap) fprintf(file, " ");
+				writeString(file," ");
+				if (i + 1<nbFunction_Inmap) writeString(file," ");
 			}
 			for (size_t i = 0; i<nbFunction_Outmap; ++i)
 			{
 				function_Outmap[i].write(file);
-				fprintf(file, " ");
-				if (i + 1<nbFunction_Outmap) fprintf(file, " ");
+				writeString(file," ");
+				if (i + 1<nbFunction_Outmap) writeString(file," ");
 			}
-			fprintf(file,"%f", function_Default);
+			writeFloat(file,"",function_Default);
 		}
 	};
 public:
@@ -66,176 +66,176 @@ public:
 	void setMinimum(double min)
 	{
 		if(min == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".min\" %f;\n", min);
+		writeFloat(mFile,"\tsetAttr \".min\" ",min,";\n");
 	}
 	void setMaximum(double max)
 	{
 		if(max == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".max\" %f;\n", max);
+		writeFloat(mFile,"\tsetAttr \".max\" ",max,";\n");
 	}
 	void setStep(double s)
 	{
 		if(s == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setInvert(bool i_)
 	{
 		if(i_ == false) return;
-		fprintf(mFile,"\tsetAttr \".i\" %i;\n", i_);
+		writeInt(mFile,"\tsetAttr \".i\" ",i_,";\n");
 	}
 	void setFunction(const Function& f)
 	{
-		fprintf(mFile,"\tsetAttr \".f\" ");
+		writeString(mFile,"\tsetAttr \".f\" ");
 		f.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFunction_Inmap(size_t fi_i,const Function::Function_Inmap& fi)
 	{
-		fprintf(mFile,"\tsetAttr \".f.fi[%i]\" ",fi_i);
+		writeInt(mFile,"\tsetAttr \".f.fi[",fi_i,"]\" ");
 		fi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFunction_Inmap(size_t fi_start,size_t fi_end,Function::Function_Inmap* fi)
 	{
-		fprintf(mFile,"\tsetAttr \".f.fi[%i:%i]\" ", fi_start,fi_end);
+		writeInt(mFile,"\tsetAttr \".f.fi[",fi_start); writeInt(mFile,":",fi_end,"]\" ");
 		size_t size = (fi_end-fi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			fi[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFunction_Inmap(size_t fi_start,size_t fi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".f.fi[%i:%i]\"",fi_start,fi_end);
-		fprintf(mFile," -type \"Function::Function_Inmap\" ");
+		writeInt(mFile,"\tsetAttr \".f.fi[",fi_start); writeInt(mFile,":",fi_end,"]\"");
+		writeString(mFile," -type \"Function::Function_Inmap\" ");
 	}
 	void appendFunction_Inmap(const Function::Function_Inmap& fi)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		fi.write(mFile);
 	}
 	void endFunction_Inmap()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFunction_InmapTo(size_t fi_i,short fit)
 	{
 		if(fit == 0) return;
-		fprintf(mFile,"\tsetAttr \".f.fi[%i].fit\" %i;\n", fi_i,fit);
+		writeInt(mFile,"\tsetAttr \".f.fi[",fi_i); writeInt(mFile,"].fit\" ",fit,";\n");
 	}
 	void setFunction_InmapFrom(size_t fi_i,short fif)
 	{
 		if(fif == 0) return;
-		fprintf(mFile,"\tsetAttr \".f.fi[%i].fif\" %i;\n", fi_i,fif);
+		writeInt(mFile,"\tsetAttr \".f.fi[",fi_i); writeInt(mFile,"].fif\" ",fif,";\n");
 	}
 	void setFunction_Outmap(size_t fo_i,const Function::Function_Outmap& fo)
 	{
-		fprintf(mFile,"\tsetAttr \".f.fo[%i]\" ",fo_i);
+		writeInt(mFile,"\tsetAttr \".f.fo[",fo_i,"]\" ");
 		fo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFunction_Outmap(size_t fo_start,size_t fo_end,Function::Function_Outmap* fo)
 	{
-		fprintf(mFile,"\tsetAttr \".f.fo[%i:%i]\" ", fo_start,fo_end);
+		writeInt(mFile,"\tsetAttr \".f.fo[",fo_start); writeInt(mFile,":",fo_end,"]\" ");
 		size_t size = (fo_end-fo_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			fo[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFunction_Outmap(size_t fo_start,size_t fo_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".f.fo[%i:%i]\"",fo_start,fo_end);
-		fprintf(mFile," -type \"Function::Function_Outmap\" ");
+		writeInt(mFile,"\tsetAttr \".f.fo[",fo_start); writeInt(mFile,":",fo_end,"]\"");
+		writeString(mFile," -type \"Function::Function_Outmap\" ");
 	}
 	void appendFunction_Outmap(const Function::Function_Outmap& fo)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		fo.write(mFile);
 	}
 	void endFunction_Outmap()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFunction_OutmapTo(size_t fo_i,short fot)
 	{
 		if(fot == 0) return;
-		fprintf(mFile,"\tsetAttr \".f.fo[%i].fot\" %i;\n", fo_i,fot);
+		writeInt(mFile,"\tsetAttr \".f.fo[",fo_i); writeInt(mFile,"].fot\" ",fot,";\n");
 	}
 	void setFunction_OutmapFrom(size_t fo_i,short fof)
 	{
 		if(fof == 0) return;
-		fprintf(mFile,"\tsetAttr \".f.fo[%i].fof\" %i;\n", fo_i,fof);
+		writeInt(mFile,"\tsetAttr \".f.fo[",fo_i); writeInt(mFile,"].fof\" ",fof,";\n");
 	}
 	void setFunction_Default(double fd)
 	{
 		if(fd == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".f.fd\" %f;\n", fd);
+		writeFloat(mFile,"\tsetAttr \".f.fd\" ",fd,";\n");
 	}
 	void getMinimum()const
 	{
-		fprintf(mFile,"\"%s.min\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".min\"");
 	}
 	void getMaximum()const
 	{
-		fprintf(mFile,"\"%s.max\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".max\"");
 	}
 	void getStep()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getInvert()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getValue(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i]\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"]\"");
 	}
 	void getValue()const
 	{
 
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getFunction()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getFunction_Raw()const
 	{
-		fprintf(mFile,"\"%s.f.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f.fr\"");
 	}
 	void getFunction_Inmap(size_t fi_i)const
 	{
-		fprintf(mFile,"\"%s.f.fi[%i]\"",mName.c_str(),fi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".f.fi[",fi_i,"]\"");
 	}
 	void getFunction_InmapTo(size_t fi_i)const
 	{
-		fprintf(mFile,"\"%s.f.fi[%i].fit\"",mName.c_str(),fi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".f.fi[",fi_i,"].fit\"");
 	}
 	void getFunction_InmapFrom(size_t fi_i)const
 	{
-		fprintf(mFile,"\"%s.f.fi[%i].fif\"",mName.c_str(),fi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".f.fi[",fi_i,"].fif\"");
 	}
 	void getFunction_Outmap(size_t fo_i)const
 	{
-		fprintf(mFile,"\"%s.f.fo[%i]\"",mName.c_str(),fo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".f.fo[",fo_i,"]\"");
 	}
 	void getFunction_OutmapTo(size_t fo_i)const
 	{
-		fprintf(mFile,"\"%s.f.fo[%i].fot\"",mName.c_str(),fo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".f.fo[",fo_i,"].fot\"");
 	}
 	void getFunction_OutmapFrom(size_t fo_i)const
 	{
-		fprintf(mFile,"\"%s.f.fo[%i].fof\"",mName.c_str(),fo_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".f.fo[",fo_i,"].fof\"");
 	}
 	void getFunction_Default()const
 	{
-		fprintf(mFile,"\"%s.f.fd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f.fd\"");
 	}
 protected:
 	Sampler(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,348 +27,348 @@ public:
 	void setPointCamera(const float3& p)
 	{
 		if(p == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".p\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"float3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointCameraX(float px)
 	{
 		if(px == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPointCameraY(float py)
 	{
 		if(py == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setPointCameraZ(float pz)
 	{
 		if(pz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".p.pz\" ",pz,";\n");
 	}
 	void setPointObj(const float3& po)
 	{
 		if(po == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".po\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".po\" -type \"float3\" ");
 		po.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointObjX(float pox)
 	{
 		if(pox == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".po.pox\" %f;\n", pox);
+		writeFloat(mFile,"\tsetAttr \".po.pox\" ",pox,";\n");
 	}
 	void setPointObjY(float poy)
 	{
 		if(poy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".po.poy\" %f;\n", poy);
+		writeFloat(mFile,"\tsetAttr \".po.poy\" ",poy,";\n");
 	}
 	void setPointObjZ(float poz)
 	{
 		if(poz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".po.poz\" %f;\n", poz);
+		writeFloat(mFile,"\tsetAttr \".po.poz\" ",poz,";\n");
 	}
 	void setPointWorld(const float3& pw)
 	{
 		if(pw == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".pw\" -type \"float3\" ");
 		pw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointWorldX(float pwx)
 	{
 		if(pwx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.pwx\" %f;\n", pwx);
+		writeFloat(mFile,"\tsetAttr \".pw.pwx\" ",pwx,";\n");
 	}
 	void setPointWorldY(float pwy)
 	{
 		if(pwy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.pwy\" %f;\n", pwy);
+		writeFloat(mFile,"\tsetAttr \".pw.pwy\" ",pwy,";\n");
 	}
 	void setPointWorldZ(float pwz)
 	{
 		if(pwz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pw.pwz\" %f;\n", pwz);
+		writeFloat(mFile,"\tsetAttr \".pw.pwz\" ",pwz,";\n");
 	}
 	void setNormalCamera(const float3& n)
 	{
 		if(n == float3(0.0f,0.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".n\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".n\" -type \"float3\" ");
 		n.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setNormalCameraX(float nx)
 	{
 		if(nx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.nx\" %f;\n", nx);
+		writeFloat(mFile,"\tsetAttr \".n.nx\" ",nx,";\n");
 	}
 	void setNormalCameraY(float ny)
 	{
 		if(ny == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.ny\" %f;\n", ny);
+		writeFloat(mFile,"\tsetAttr \".n.ny\" ",ny,";\n");
 	}
 	void setNormalCameraZ(float nz)
 	{
 		if(nz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.nz\" %f;\n", nz);
+		writeFloat(mFile,"\tsetAttr \".n.nz\" ",nz,";\n");
 	}
 	void setUvCoord(const float2& uv)
 	{
 		if(uv == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".uv\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".uv\" -type \"float2\" ");
 		uv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUCoord(float u)
 	{
 		if(u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uv.u\" %f;\n", u);
+		writeFloat(mFile,"\tsetAttr \".uv.u\" ",u,";\n");
 	}
 	void setVCoord(float v)
 	{
 		if(v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uv.v\" %f;\n", v);
+		writeFloat(mFile,"\tsetAttr \".uv.v\" ",v,";\n");
 	}
 	void setRayDirection(const float3& r)
 	{
 		if(r == float3(0.0f,0.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".r\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".r\" -type \"float3\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRayDirectionX(float rx)
 	{
 		if(rx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".r.rx\" ",rx,";\n");
 	}
 	void setRayDirectionY(float ry)
 	{
 		if(ry == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".r.ry\" ",ry,";\n");
 	}
 	void setRayDirectionZ(float rz)
 	{
 		if(rz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".r.rz\" ",rz,";\n");
 	}
 	void setTangentUCamera(const float3& tu)
 	{
 		if(tu == float3(1.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".tu\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".tu\" -type \"float3\" ");
 		tu.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTangentUx(float tux)
 	{
 		if(tux == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tu.tux\" %f;\n", tux);
+		writeFloat(mFile,"\tsetAttr \".tu.tux\" ",tux,";\n");
 	}
 	void setTangentUy(float tuy)
 	{
 		if(tuy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tu.tuy\" %f;\n", tuy);
+		writeFloat(mFile,"\tsetAttr \".tu.tuy\" ",tuy,";\n");
 	}
 	void setTangentUz(float tuz)
 	{
 		if(tuz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tu.tuz\" %f;\n", tuz);
+		writeFloat(mFile,"\tsetAttr \".tu.tuz\" ",tuz,";\n");
 	}
 	void setTangentVCamera(const float3& tv)
 	{
 		if(tv == float3(0.0f,1.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".tv\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".tv\" -type \"float3\" ");
 		tv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTangentVx(float tvx)
 	{
 		if(tvx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tv.tvx\" %f;\n", tvx);
+		writeFloat(mFile,"\tsetAttr \".tv.tvx\" ",tvx,";\n");
 	}
 	void setTangentVy(float tvy)
 	{
 		if(tvy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tv.tvy\" %f;\n", tvy);
+		writeFloat(mFile,"\tsetAttr \".tv.tvy\" ",tvy,";\n");
 	}
 	void setTangentVz(float tvz)
 	{
 		if(tvz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tv.tvz\" %f;\n", tvz);
+		writeFloat(mFile,"\tsetAttr \".tv.tvz\" ",tvz,";\n");
 	}
 	void setPixelCenter(const float2& pc)
 	{
 		if(pc == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".pc\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".pc\" -type \"float2\" ");
 		pc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPixelCenterX(float pcx)
 	{
 		if(pcx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcx\" %f;\n", pcx);
+		writeFloat(mFile,"\tsetAttr \".pc.pcx\" ",pcx,";\n");
 	}
 	void setPixelCenterY(float pcy)
 	{
 		if(pcy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcy\" %f;\n", pcy);
+		writeFloat(mFile,"\tsetAttr \".pc.pcy\" ",pcy,";\n");
 	}
 	void setFlippedNormal(bool fn)
 	{
 		if(fn == false) return;
-		fprintf(mFile,"\tsetAttr \".fn\" %i;\n", fn);
+		writeInt(mFile,"\tsetAttr \".fn\" ",fn,";\n");
 	}
 	void setFacingRatio(float fr)
 	{
 		if(fr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getPointObj()const
 	{
-		fprintf(mFile,"\"%s.po\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po\"");
 	}
 	void getPointObjX()const
 	{
-		fprintf(mFile,"\"%s.po.pox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.pox\"");
 	}
 	void getPointObjY()const
 	{
-		fprintf(mFile,"\"%s.po.poy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poy\"");
 	}
 	void getPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.po.poz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poz\"");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.pw.pwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwx\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.pw.pwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwy\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.pw.pwz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwz\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.u\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.v\"");
 	}
 	void getRayDirection()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRayDirectionX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRayDirectionY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRayDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getTangentUCamera()const
 	{
-		fprintf(mFile,"\"%s.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu\"");
 	}
 	void getTangentUx()const
 	{
-		fprintf(mFile,"\"%s.tu.tux\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tux\"");
 	}
 	void getTangentUy()const
 	{
-		fprintf(mFile,"\"%s.tu.tuy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tuy\"");
 	}
 	void getTangentUz()const
 	{
-		fprintf(mFile,"\"%s.tu.tuz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tu.tuz\"");
 	}
 	void getTangentVCamera()const
 	{
-		fprintf(mFile,"\"%s.tv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv\"");
 	}
 	void getTangentVx()const
 	{
-		fprintf(mFile,"\"%s.tv.tvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvx\"");
 	}
 	void getTangentVy()const
 	{
-		fprintf(mFile,"\"%s.tv.tvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvy\"");
 	}
 	void getTangentVz()const
 	{
-		fprintf(mFile,"\"%s.tv.tvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tv.tvz\"");
 	}
 	void getMatrixEyeToWorld()const
 	{
-		fprintf(mFile,"\"%s.e2w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2w\"");
 	}
 	void getPixelCenter()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getPixelCenterX()const
 	{
-		fprintf(mFile,"\"%s.pc.pcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcx\"");
 	}
 	void getPixelCenterY()const
 	{
-		fprintf(mFile,"\"%s.pc.pcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcy\"");
 	}
 	void getFlippedNormal()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getFacingRatio()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 protected:
 	SamplerInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -24,10 +24,10 @@ public:
 		void write(FILE* file) const
 		{
 			targetScale.write(file);
-			fprintf(file, " ");
+			writeString(file," ");
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", targetWeight);
+			writeString(file," ");
+			writeFloat(file,"",targetWeight);
 		}
 	};
 public:
@@ -39,210 +39,210 @@ public:
 
 	void setTarget(size_t tg_i,const Target& tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i]\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"]\" ");
 		tg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTarget(size_t tg_start,size_t tg_end,Target* tg)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\" ", tg_start,tg_end);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\" ");
 		size_t size = (tg_end-tg_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			tg[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTarget(size_t tg_start,size_t tg_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i:%i]\"",tg_start,tg_end);
-		fprintf(mFile," -type \"Target\" ");
+		writeInt(mFile,"\tsetAttr \".tg[",tg_start); writeInt(mFile,":",tg_end,"]\"");
+		writeString(mFile," -type \"Target\" ");
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		tg.write(mFile);
 	}
 	void endTarget()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetScale(size_t tg_i,const double3& ts)
 	{
-		fprintf(mFile,"\tsetAttr \".tg[%i].ts\" -type \"double3\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].ts\" -type \"double3\" ");
 		ts.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetScaleX(size_t tg_i,double tsx)
 	{
 		if(tsx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ts.tsx\" %f;\n", tg_i,tsx);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ts.tsx\" ",tsx,";\n");
 	}
 	void setTargetScaleY(size_t tg_i,double tsy)
 	{
 		if(tsy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ts.tsy\" %f;\n", tg_i,tsy);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ts.tsy\" ",tsy,";\n");
 	}
 	void setTargetScaleZ(size_t tg_i,double tsz)
 	{
 		if(tsz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].ts.tsz\" %f;\n", tg_i,tsz);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].ts.tsz\" ",tsz,";\n");
 	}
 	void setTargetParentMatrix(size_t tg_i,const matrix& tpm)
 	{
 		if(tpm == identity) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tpm\" -type \"matrix\" ",tg_i);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i,"].tpm\" -type \"matrix\" ");
 		tpm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetWeight(size_t tg_i,double tw)
 	{
 		if(tw == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tg[%i].tw\" %f;\n", tg_i,tw);
+		writeInt(mFile,"\tsetAttr \".tg[",tg_i); writeFloat(mFile,"].tw\" ",tw,";\n");
 	}
 	void setConstraintParentInverseMatrix(const matrix& cpim)
 	{
 		if(cpim == identity) return;
-		fprintf(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".cpim\" -type \"matrix\" ");
 		cpim.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffset(const double3& o)
 	{
-		fprintf(mFile,"\tsetAttr \".o\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".o\" -type \"double3\" ");
 		o.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOffsetX(double ox)
 	{
 		if(ox == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".o.ox\" %f;\n", ox);
+		writeFloat(mFile,"\tsetAttr \".o.ox\" ",ox,";\n");
 	}
 	void setOffsetY(double oy)
 	{
 		if(oy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".o.oy\" %f;\n", oy);
+		writeFloat(mFile,"\tsetAttr \".o.oy\" ",oy,";\n");
 	}
 	void setOffsetZ(double oz)
 	{
 		if(oz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".o.oz\" %f;\n", oz);
+		writeFloat(mFile,"\tsetAttr \".o.oz\" ",oz,";\n");
 	}
 	void getTarget(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i]\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"]\"");
 	}
 	void getTarget()const
 	{
 
-		fprintf(mFile,"\"%s.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg\"");
 	}
 	void getTargetScale(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ts\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ts\"");
 	}
 	void getTargetScale()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ts\"");
 	}
 	void getTargetScaleX(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ts.tsx\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ts.tsx\"");
 	}
 	void getTargetScaleX()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ts.tsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ts.tsx\"");
 	}
 	void getTargetScaleY(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ts.tsy\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ts.tsy\"");
 	}
 	void getTargetScaleY()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ts.tsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ts.tsy\"");
 	}
 	void getTargetScaleZ(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].ts.tsz\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].ts.tsz\"");
 	}
 	void getTargetScaleZ()const
 	{
 
-		fprintf(mFile,"\"%s.tg.ts.tsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.ts.tsz\"");
 	}
 	void getTargetParentMatrix(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tpm\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tpm\"");
 	}
 	void getTargetParentMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tpm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tpm\"");
 	}
 	void getTargetWeight(size_t tg_i)const
 	{
-		fprintf(mFile,"\"%s.tg[%i].tw\"",mName.c_str(),tg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tg[",tg_i,"].tw\"");
 	}
 	void getTargetWeight()const
 	{
 
-		fprintf(mFile,"\"%s.tg.tw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tg.tw\"");
 	}
 	void getConstraintParentInverseMatrix()const
 	{
-		fprintf(mFile,"\"%s.cpim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cpim\"");
 	}
 	void getOffset()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOffsetX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOffsetY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 	void getConstraintScale()const
 	{
-		fprintf(mFile,"\"%s.cs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs\"");
 	}
 	void getConstraintScaleX()const
 	{
-		fprintf(mFile,"\"%s.cs.csx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.csx\"");
 	}
 	void getConstraintScaleY()const
 	{
-		fprintf(mFile,"\"%s.cs.csy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.csy\"");
 	}
 	void getConstraintScaleZ()const
 	{
-		fprintf(mFile,"\"%s.cs.csz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cs.csz\"");
 	}
 	void getRestScale()const
 	{
-		fprintf(mFile,"\"%s.rs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs\"");
 	}
 	void getRestScaleX()const
 	{
-		fprintf(mFile,"\"%s.rs.rsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.rsx\"");
 	}
 	void getRestScaleY()const
 	{
-		fprintf(mFile,"\"%s.rs.rsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.rsy\"");
 	}
 	void getRestScaleZ()const
 	{
-		fprintf(mFile,"\"%s.rs.rsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rs.rsz\"");
 	}
 protected:
 	ScaleConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,33 +27,33 @@ public:
 	void setBefore(const string& b)
 	{
 		if(b == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".b\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".b\" -type \"string\" ");
 		b.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAfter(const string& a)
 	{
 		if(a == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".a\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".a\" -type \"string\" ");
 		a.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScriptType(unsigned int st)
 	{
 		if(st == 0) return;
-		fprintf(mFile,"\tsetAttr \".st\" %i;\n", st);
+		writeInt(mFile,"\tsetAttr \".st\" ",st,";\n");
 	}
 	void getBefore()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getAfter()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getScriptType()const
 	{
-		fprintf(mFile,"\"%s.st\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".st\"");
 	}
 protected:
 	Script(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,108 +27,108 @@ public:
 	void setSculptObjectMatrix(const matrix& sm)
 	{
 		if(sm == identity) return;
-		fprintf(mFile,"\tsetAttr \".sm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".sm\" -type \"matrix\" ");
 		sm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMode(unsigned int mo)
 	{
 		if(mo == 2) return;
-		fprintf(mFile,"\tsetAttr \".mo\" %i;\n", mo);
+		writeInt(mFile,"\tsetAttr \".mo\" ",mo,";\n");
 	}
 	void setInsideMode(unsigned int im)
 	{
 		if(im == 1) return;
-		fprintf(mFile,"\tsetAttr \".im\" %i;\n", im);
+		writeInt(mFile,"\tsetAttr \".im\" ",im,";\n");
 	}
 	void setMaximumDisplacement(double md)
 	{
 		if(md == 1) return;
-		fprintf(mFile,"\tsetAttr \".md\" %f;\n", md);
+		writeFloat(mFile,"\tsetAttr \".md\" ",md,";\n");
 	}
 	void setDropoffDistance(double dd)
 	{
 		if(dd == 1) return;
-		fprintf(mFile,"\tsetAttr \".dd\" %f;\n", dd);
+		writeFloat(mFile,"\tsetAttr \".dd\" ",dd,";\n");
 	}
 	void setDropoffType(unsigned int dt)
 	{
 		if(dt == 1) return;
-		fprintf(mFile,"\tsetAttr \".dt\" %i;\n", dt);
+		writeInt(mFile,"\tsetAttr \".dt\" ",dt,";\n");
 	}
 	void setStartPosition(const float3& sp)
 	{
-		fprintf(mFile,"\tsetAttr \".sp\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sp\" -type \"float3\" ");
 		sp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStartPosX(float sx)
 	{
 		if(sx == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.sx\" %f;\n", sx);
+		writeFloat(mFile,"\tsetAttr \".sp.sx\" ",sx,";\n");
 	}
 	void setStartPosY(float sy)
 	{
 		if(sy == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.sy\" %f;\n", sy);
+		writeFloat(mFile,"\tsetAttr \".sp.sy\" ",sy,";\n");
 	}
 	void setStartPosZ(float sz)
 	{
 		if(sz == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.sz\" %f;\n", sz);
+		writeFloat(mFile,"\tsetAttr \".sp.sz\" ",sz,";\n");
 	}
 	void setExtendedEnd(bool exd)
 	{
 		if(exd == false) return;
-		fprintf(mFile,"\tsetAttr \".exd\" %i;\n", exd);
+		writeInt(mFile,"\tsetAttr \".exd\" ",exd,";\n");
 	}
 	void getSculptObjectMatrix()const
 	{
-		fprintf(mFile,"\"%s.sm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sm\"");
 	}
 	void getSculptObjectGeometry()const
 	{
-		fprintf(mFile,"\"%s.sg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sg\"");
 	}
 	void getMode()const
 	{
-		fprintf(mFile,"\"%s.mo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mo\"");
 	}
 	void getInsideMode()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getMaximumDisplacement()const
 	{
-		fprintf(mFile,"\"%s.md\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".md\"");
 	}
 	void getDropoffDistance()const
 	{
-		fprintf(mFile,"\"%s.dd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dd\"");
 	}
 	void getDropoffType()const
 	{
-		fprintf(mFile,"\"%s.dt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dt\"");
 	}
 	void getStartPosition()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getStartPosX()const
 	{
-		fprintf(mFile,"\"%s.sp.sx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.sx\"");
 	}
 	void getStartPosY()const
 	{
-		fprintf(mFile,"\"%s.sp.sy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.sy\"");
 	}
 	void getStartPosZ()const
 	{
-		fprintf(mFile,"\"%s.sp.sz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.sz\"");
 	}
 	void getExtendedEnd()const
 	{
-		fprintf(mFile,"\"%s.exd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".exd\"");
 	}
 protected:
 	Sculpt(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
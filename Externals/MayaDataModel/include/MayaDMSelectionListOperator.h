@@ -27,32 +27,32 @@ public:
 	void setOperation(unsigned int op)
 	{
 		if(op == 0) return;
-		fprintf(mFile,"\tsetAttr \".op\" %i;\n", op);
+		writeInt(mFile,"\tsetAttr \".op\" ",op,";\n");
 	}
 	void setOperatorClass(unsigned int ocls)
 	{
 		if(ocls == 0) return;
-		fprintf(mFile,"\tsetAttr \".ocls\" %i;\n", ocls);
+		writeInt(mFile,"\tsetAttr \".ocls\" ",ocls,";\n");
 	}
 	void getOperation()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getInputListA()const
 	{
-		fprintf(mFile,"\"%s.ina\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ina\"");
 	}
 	void getInputListB()const
 	{
-		fprintf(mFile,"\"%s.inb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inb\"");
 	}
 	void getOutputList()const
 	{
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 	void getOperatorClass()const
 	{
-		fprintf(mFile,"\"%s.ocls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocls\"");
 	}
 protected:
 	SelectionListOperator(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,208 +27,208 @@ public:
 	void setValue(const float3& v)
 	{
 		if(v == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".v\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".v\" -type \"float3\" ");
 		v.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setValueX(float vx)
 	{
 		if(vx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vx\" %f;\n", vx);
+		writeFloat(mFile,"\tsetAttr \".v.vx\" ",vx,";\n");
 	}
 	void setValueY(float vy)
 	{
 		if(vy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vy\" %f;\n", vy);
+		writeFloat(mFile,"\tsetAttr \".v.vy\" ",vy,";\n");
 	}
 	void setValueZ(float vz)
 	{
 		if(vz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".v.vz\" %f;\n", vz);
+		writeFloat(mFile,"\tsetAttr \".v.vz\" ",vz,";\n");
 	}
 	void setMin(const float3& n)
 	{
 		if(n == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".n\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".n\" -type \"float3\" ");
 		n.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinX(float nx)
 	{
 		if(nx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.nx\" %f;\n", nx);
+		writeFloat(mFile,"\tsetAttr \".n.nx\" ",nx,";\n");
 	}
 	void setMinY(float ny)
 	{
 		if(ny == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.ny\" %f;\n", ny);
+		writeFloat(mFile,"\tsetAttr \".n.ny\" ",ny,";\n");
 	}
 	void setMinZ(float nz)
 	{
 		if(nz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".n.nz\" %f;\n", nz);
+		writeFloat(mFile,"\tsetAttr \".n.nz\" ",nz,";\n");
 	}
 	void setMax(const float3& m)
 	{
 		if(m == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".m\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".m\" -type \"float3\" ");
 		m.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxX(float mx)
 	{
 		if(mx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".m.mx\" %f;\n", mx);
+		writeFloat(mFile,"\tsetAttr \".m.mx\" ",mx,";\n");
 	}
 	void setMaxY(float my)
 	{
 		if(my == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".m.my\" %f;\n", my);
+		writeFloat(mFile,"\tsetAttr \".m.my\" ",my,";\n");
 	}
 	void setMaxZ(float mz)
 	{
 		if(mz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".m.mz\" %f;\n", mz);
+		writeFloat(mFile,"\tsetAttr \".m.mz\" ",mz,";\n");
 	}
 	void setOldMin(const float3& on)
 	{
 		if(on == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".on\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".on\" -type \"float3\" ");
 		on.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOldMinX(float onx)
 	{
 		if(onx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".on.onx\" %f;\n", onx);
+		writeFloat(mFile,"\tsetAttr \".on.onx\" ",onx,";\n");
 	}
 	void setOldMinY(float ony)
 	{
 		if(ony == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".on.ony\" %f;\n", ony);
+		writeFloat(mFile,"\tsetAttr \".on.ony\" ",ony,";\n");
 	}
 	void setOldMinZ(float onz)
 	{
 		if(onz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".on.onz\" %f;\n", onz);
+		writeFloat(mFile,"\tsetAttr \".on.onz\" ",onz,";\n");
 	}
 	void setOldMax(const float3& om)
 	{
 		if(om == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".om\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".om\" -type \"float3\" ");
 		om.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOldMaxX(float omx)
 	{
 		if(omx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".om.omx\" %f;\n", omx);
+		writeFloat(mFile,"\tsetAttr \".om.omx\" ",omx,";\n");
 	}
 	void setOldMaxY(float omy)
 	{
 		if(omy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".om.omy\" %f;\n", omy);
+		writeFloat(mFile,"\tsetAttr \".om.omy\" ",omy,";\n");
 	}
 	void setOldMaxZ(float omz)
 	{
 		if(omz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".om.omz\" %f;\n", omz);
+		writeFloat(mFile,"\tsetAttr \".om.omz\" ",omz,";\n");
 	}
 	void getValue()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getValueX()const
 	{
-		fprintf(mFile,"\"%s.v.vx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vx\"");
 	}
 	void getValueY()const
 	{
-		fprintf(mFile,"\"%s.v.vy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vy\"");
 	}
 	void getValueZ()const
 	{
-		fprintf(mFile,"\"%s.v.vz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v.vz\"");
 	}
 	void getMin()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getMinX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getMinY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getMinZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getMax()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getMaxX()const
 	{
-		fprintf(mFile,"\"%s.m.mx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.mx\"");
 	}
 	void getMaxY()const
 	{
-		fprintf(mFile,"\"%s.m.my\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.my\"");
 	}
 	void getMaxZ()const
 	{
-		fprintf(mFile,"\"%s.m.mz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m.mz\"");
 	}
 	void getOldMin()const
 	{
-		fprintf(mFile,"\"%s.on\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".on\"");
 	}
 	void getOldMinX()const
 	{
-		fprintf(mFile,"\"%s.on.onx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".on.onx\"");
 	}
 	void getOldMinY()const
 	{
-		fprintf(mFile,"\"%s.on.ony\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".on.ony\"");
 	}
 	void getOldMinZ()const
 	{
-		fprintf(mFile,"\"%s.on.onz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".on.onz\"");
 	}
 	void getOldMax()const
 	{
-		fprintf(mFile,"\"%s.om\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".om\"");
 	}
 	void getOldMaxX()const
 	{
-		fprintf(mFile,"\"%s.om.omx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".om.omx\"");
 	}
 	void getOldMaxY()const
 	{
-		fprintf(mFile,"\"%s.om.omy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".om.omy\"");
 	}
 	void getOldMaxZ()const
 	{
-		fprintf(mFile,"\"%s.om.omz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".om.omz\"");
 	}
 	void getOutValue()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutValueX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutValueY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutValueZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 protected:
 	SetRange(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
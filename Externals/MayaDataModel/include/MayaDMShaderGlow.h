@@ -27,312 +27,312 @@ public:
 	void setGlowType(unsigned int gt)
 	{
 		if(gt == 1) return;
-		fprintf(mFile,"\tsetAttr \".gt\" %i;\n", gt);
+		writeInt(mFile,"\tsetAttr \".gt\" ",gt,";\n");
 	}
 	void setHaloType(unsigned int ht)
 	{
 		if(ht == 1) return;
-		fprintf(mFile,"\tsetAttr \".ht\" %i;\n", ht);
+		writeInt(mFile,"\tsetAttr \".ht\" ",ht,";\n");
 	}
 	void setGlowIntensity(float gi)
 	{
 		if(gi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %f;\n", gi);
+		writeFloat(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void setGlowColor(const float3& gc)
 	{
 		if(gc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
 		gc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlowColorR(float gr)
 	{
 		if(gr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gr\" %f;\n", gr);
+		writeFloat(mFile,"\tsetAttr \".gc.gr\" ",gr,";\n");
 	}
 	void setGlowColorG(float gg)
 	{
 		if(gg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gg\" %f;\n", gg);
+		writeFloat(mFile,"\tsetAttr \".gc.gg\" ",gg,";\n");
 	}
 	void setGlowColorB(float gb)
 	{
 		if(gb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gb\" %f;\n", gb);
+		writeFloat(mFile,"\tsetAttr \".gc.gb\" ",gb,";\n");
 	}
 	void setGlowSpread(float gs)
 	{
 		if(gs == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".gs\" %f;\n", gs);
+		writeFloat(mFile,"\tsetAttr \".gs\" ",gs,";\n");
 	}
 	void setGlowEccentricity(float gecc)
 	{
 		if(gecc == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".gecc\" %f;\n", gecc);
+		writeFloat(mFile,"\tsetAttr \".gecc\" ",gecc,";\n");
 	}
 	void setGlowRadialNoise(float gn)
 	{
 		if(gn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gn\" %f;\n", gn);
+		writeFloat(mFile,"\tsetAttr \".gn\" ",gn,";\n");
 	}
 	void setGlowStarLevel(float gv)
 	{
 		if(gv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gv\" %f;\n", gv);
+		writeFloat(mFile,"\tsetAttr \".gv\" ",gv,";\n");
 	}
 	void setGlowOpacity(float go)
 	{
 		if(go == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".go\" %f;\n", go);
+		writeFloat(mFile,"\tsetAttr \".go\" ",go,";\n");
 	}
 	void setGlowRingIntensity(float gri)
 	{
 		if(gri == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gri\" %f;\n", gri);
+		writeFloat(mFile,"\tsetAttr \".gri\" ",gri,";\n");
 	}
 	void setGlowRingFrequency(float grf)
 	{
 		if(grf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".grf\" %f;\n", grf);
+		writeFloat(mFile,"\tsetAttr \".grf\" ",grf,";\n");
 	}
 	void setGlowFilterWidth(int gfw)
 	{
 		if(gfw == 1) return;
-		fprintf(mFile,"\tsetAttr \".gfw\" %i;\n", gfw);
+		writeInt(mFile,"\tsetAttr \".gfw\" ",gfw,";\n");
 	}
 	void setHaloIntensity(float hi)
 	{
 		if(hi == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".hi\" %f;\n", hi);
+		writeFloat(mFile,"\tsetAttr \".hi\" ",hi,";\n");
 	}
 	void setHaloColor(const float3& hc)
 	{
 		if(hc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
 		hc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setHaloColorR(float hr)
 	{
 		if(hr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hr\" %f;\n", hr);
+		writeFloat(mFile,"\tsetAttr \".hc.hr\" ",hr,";\n");
 	}
 	void setHaloColorG(float hg)
 	{
 		if(hg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hg\" %f;\n", hg);
+		writeFloat(mFile,"\tsetAttr \".hc.hg\" ",hg,";\n");
 	}
 	void setHaloColorB(float hb)
 	{
 		if(hb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".hc.hb\" ",hb,";\n");
 	}
 	void setHaloSpread(float hs)
 	{
 		if(hs == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".hs\" %f;\n", hs);
+		writeFloat(mFile,"\tsetAttr \".hs\" ",hs,";\n");
 	}
 	void setHaloEccentricity(float hecc)
 	{
 		if(hecc == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".hecc\" %f;\n", hecc);
+		writeFloat(mFile,"\tsetAttr \".hecc\" ",hecc,";\n");
 	}
 	void setHaloRadialNoise(float hn)
 	{
 		if(hn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hn\" %f;\n", hn);
+		writeFloat(mFile,"\tsetAttr \".hn\" ",hn,";\n");
 	}
 	void setHaloStarLevel(float hv)
 	{
 		if(hv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hv\" %f;\n", hv);
+		writeFloat(mFile,"\tsetAttr \".hv\" ",hv,";\n");
 	}
 	void setHaloOpacity(float ho)
 	{
 		if(ho == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ho\" %f;\n", ho);
+		writeFloat(mFile,"\tsetAttr \".ho\" ",ho,";\n");
 	}
 	void setHaloRingIntensity(float hri)
 	{
 		if(hri == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hri\" %f;\n", hri);
+		writeFloat(mFile,"\tsetAttr \".hri\" ",hri,";\n");
 	}
 	void setHaloRingFrequency(float hrf)
 	{
 		if(hrf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hrf\" %f;\n", hrf);
+		writeFloat(mFile,"\tsetAttr \".hrf\" ",hrf,";\n");
 	}
 	void setHaloFilterWidth(int hfw)
 	{
 		if(hfw == 1) return;
-		fprintf(mFile,"\tsetAttr \".hfw\" %i;\n", hfw);
+		writeInt(mFile,"\tsetAttr \".hfw\" ",hfw,";\n");
 	}
 	void setQuality(float qual)
 	{
 		if(qual == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".qual\" %f;\n", qual);
+		writeFloat(mFile,"\tsetAttr \".qual\" ",qual,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void setRadialFrequency(float rf)
 	{
 		if(rf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".rf\" %f;\n", rf);
+		writeFloat(mFile,"\tsetAttr \".rf\" ",rf,";\n");
 	}
 	void setStarPoints(float sp)
 	{
 		if(sp == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".sp\" %f;\n", sp);
+		writeFloat(mFile,"\tsetAttr \".sp\" ",sp,";\n");
 	}
 	void setRotation(float ra)
 	{
 		if(ra == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setAutoExposure(bool ae)
 	{
 		if(ae == true) return;
-		fprintf(mFile,"\tsetAttr \".ae\" %i;\n", ae);
+		writeInt(mFile,"\tsetAttr \".ae\" ",ae,";\n");
 	}
 	void getGlowType()const
 	{
-		fprintf(mFile,"\"%s.gt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gt\"");
 	}
 	void getHaloType()const
 	{
-		fprintf(mFile,"\"%s.ht\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ht\"");
 	}
 	void getGlowIntensity()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 	void getGlowColor()const
 	{
-		fprintf(mFile,"\"%s.gc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc\"");
 	}
 	void getGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.gc.gr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gr\"");
 	}
 	void getGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.gc.gg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gg\"");
 	}
 	void getGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.gc.gb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gb\"");
 	}
 	void getGlowSpread()const
 	{
-		fprintf(mFile,"\"%s.gs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gs\"");
 	}
 	void getGlowEccentricity()const
 	{
-		fprintf(mFile,"\"%s.gecc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gecc\"");
 	}
 	void getGlowRadialNoise()const
 	{
-		fprintf(mFile,"\"%s.gn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gn\"");
 	}
 	void getGlowStarLevel()const
 	{
-		fprintf(mFile,"\"%s.gv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gv\"");
 	}
 	void getGlowOpacity()const
 	{
-		fprintf(mFile,"\"%s.go\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".go\"");
 	}
 	void getGlowRingIntensity()const
 	{
-		fprintf(mFile,"\"%s.gri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gri\"");
 	}
 	void getGlowRingFrequency()const
 	{
-		fprintf(mFile,"\"%s.grf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".grf\"");
 	}
 	void getGlowFilterWidth()const
 	{
-		fprintf(mFile,"\"%s.gfw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gfw\"");
 	}
 	void getHaloIntensity()const
 	{
-		fprintf(mFile,"\"%s.hi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hi\"");
 	}
 	void getHaloColor()const
 	{
-		fprintf(mFile,"\"%s.hc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc\"");
 	}
 	void getHaloColorR()const
 	{
-		fprintf(mFile,"\"%s.hc.hr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hr\"");
 	}
 	void getHaloColorG()const
 	{
-		fprintf(mFile,"\"%s.hc.hg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hg\"");
 	}
 	void getHaloColorB()const
 	{
-		fprintf(mFile,"\"%s.hc.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hb\"");
 	}
 	void getHaloSpread()const
 	{
-		fprintf(mFile,"\"%s.hs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hs\"");
 	}
 	void getHaloEccentricity()const
 	{
-		fprintf(mFile,"\"%s.hecc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hecc\"");
 	}
 	void getHaloRadialNoise()const
 	{
-		fprintf(mFile,"\"%s.hn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hn\"");
 	}
 	void getHaloStarLevel()const
 	{
-		fprintf(mFile,"\"%s.hv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hv\"");
 	}
 	void getHaloOpacity()const
 	{
-		fprintf(mFile,"\"%s.ho\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ho\"");
 	}
 	void getHaloRingIntensity()const
 	{
-		fprintf(mFile,"\"%s.hri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hri\"");
 	}
 	void getHaloRingFrequency()const
 	{
-		fprintf(mFile,"\"%s.hrf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hrf\"");
 	}
 	void getHaloFilterWidth()const
 	{
-		fprintf(mFile,"\"%s.hfw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hfw\"");
 	}
 	void getQuality()const
 	{
-		fprintf(mFile,"\"%s.qual\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".qual\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getRadialFrequency()const
 	{
-		fprintf(mFile,"\"%s.rf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rf\"");
 	}
 	void getStarPoints()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getRotation()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getAutoExposure()const
 	{
-		fprintf(mFile,"\"%s.ae\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ae\"");
 	}
 protected:
 	ShaderGlow(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,172 +27,172 @@ public:
 	void setMiExportMrMaterial(bool mimt)
 	{
 		if(mimt == false) return;
-		fprintf(mFile,"\tsetAttr \".mimt\" %i;\n", mimt);
+		writeInt(mFile,"\tsetAttr \".mimt\" ",mimt,";\n");
 	}
 	void setMiOpaque(bool miop)
 	{
 		if(miop == false) return;
-		fprintf(mFile,"\tsetAttr \".miop\" %i;\n", miop);
+		writeInt(mFile,"\tsetAttr \".miop\" ",miop,";\n");
 	}
 	void setMiCutAwayOpacity(float mico)
 	{
 		if(mico == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".mico\" %f;\n", mico);
+		writeFloat(mFile,"\tsetAttr \".mico\" ",mico,";\n");
 	}
 	void setMiExportShadingEngine(bool mise)
 	{
 		if(mise == false) return;
-		fprintf(mFile,"\tsetAttr \".mise\" %i;\n", mise);
+		writeInt(mFile,"\tsetAttr \".mise\" ",mise,";\n");
 	}
 	void setMiExportVolumeSampler(bool mism)
 	{
 		if(mism == false) return;
-		fprintf(mFile,"\tsetAttr \".mism\" %i;\n", mism);
+		writeInt(mFile,"\tsetAttr \".mism\" ",mism,";\n");
 	}
 	void setMiContourEnable(bool mice)
 	{
 		if(mice == false) return;
-		fprintf(mFile,"\tsetAttr \".mice\" %i;\n", mice);
+		writeInt(mFile,"\tsetAttr \".mice\" ",mice,";\n");
 	}
 	void setMiContourColor(const float3& micc)
 	{
-		fprintf(mFile,"\tsetAttr \".micc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".micc\" -type \"float3\" ");
 		micc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiContourColorR(float micr)
 	{
 		if(micr == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".micc.micr\" %f;\n", micr);
+		writeFloat(mFile,"\tsetAttr \".micc.micr\" ",micr,";\n");
 	}
 	void setMiContourColorG(float micg)
 	{
 		if(micg == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".micc.micg\" %f;\n", micg);
+		writeFloat(mFile,"\tsetAttr \".micc.micg\" ",micg,";\n");
 	}
 	void setMiContourColorB(float micb)
 	{
 		if(micb == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".micc.micb\" %f;\n", micb);
+		writeFloat(mFile,"\tsetAttr \".micc.micb\" ",micb,";\n");
 	}
 	void setMiContourAlpha(float mica)
 	{
 		if(mica == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mica\" %f;\n", mica);
+		writeFloat(mFile,"\tsetAttr \".mica\" ",mica,";\n");
 	}
 	void setMiContourWidth(float micw)
 	{
 		if(micw == 1.25) return;
-		fprintf(mFile,"\tsetAttr \".micw\" %f;\n", micw);
+		writeFloat(mFile,"\tsetAttr \".micw\" ",micw,";\n");
 	}
 	void setMiContourRelativeWidth(bool mirw)
 	{
 		if(mirw == false) return;
-		fprintf(mFile,"\tsetAttr \".mirw\" %i;\n", mirw);
+		writeInt(mFile,"\tsetAttr \".mirw\" ",mirw,";\n");
 	}
 	void getSurfaceShader()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getDisplacementShader()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 	void getVolumeShader()const
 	{
-		fprintf(mFile,"\"%s.vs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vs\"");
 	}
 	void getImageShader()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getMiExportMrMaterial()const
 	{
-		fprintf(mFile,"\"%s.mimt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mimt\"");
 	}
 	void getMiOpaque()const
 	{
-		fprintf(mFile,"\"%s.miop\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miop\"");
 	}
 	void getMiCutAwayOpacity()const
 	{
-		fprintf(mFile,"\"%s.mico\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mico\"");
 	}
 	void getMiExportShadingEngine()const
 	{
-		fprintf(mFile,"\"%s.mise\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mise\"");
 	}
 	void getMiMaterialShader()const
 	{
-		fprintf(mFile,"\"%s.mims\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mims\"");
 	}
 	void getMiShadowShader()const
 	{
-		fprintf(mFile,"\"%s.miss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miss\"");
 	}
 	void getMiExportVolumeSampler()const
 	{
-		fprintf(mFile,"\"%s.mism\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mism\"");
 	}
 	void getMiVolumeShader()const
 	{
-		fprintf(mFile,"\"%s.mivs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mivs\"");
 	}
 	void getMiPhotonShader()const
 	{
-		fprintf(mFile,"\"%s.mips\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mips\"");
 	}
 	void getMiPhotonVolumeShader()const
 	{
-		fprintf(mFile,"\"%s.mipv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mipv\"");
 	}
 	void getMiDisplacementShader()const
 	{
-		fprintf(mFile,"\"%s.mids\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mids\"");
 	}
 	void getMiEnvironmentShader()const
 	{
-		fprintf(mFile,"\"%s.mies\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mies\"");
 	}
 	void getMiLightMapShader()const
 	{
-		fprintf(mFile,"\"%s.milm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".milm\"");
 	}
 	void getMiContourShader()const
 	{
-		fprintf(mFile,"\"%s.mics\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mics\"");
 	}
 	void getMiContourEnable()const
 	{
-		fprintf(mFile,"\"%s.mice\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mice\"");
 	}
 	void getMiContourColor()const
 	{
-		fprintf(mFile,"\"%s.micc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".micc\"");
 	}
 	void getMiContourColorR()const
 	{
-		fprintf(mFile,"\"%s.micc.micr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".micc.micr\"");
 	}
 	void getMiContourColorG()const
 	{
-		fprintf(mFile,"\"%s.micc.micg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".micc.micg\"");
 	}
 	void getMiContourColorB()const
 	{
-		fprintf(mFile,"\"%s.micc.micb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".micc.micb\"");
 	}
 	void getMiContourAlpha()const
 	{
-		fprintf(mFile,"\"%s.mica\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mica\"");
 	}
 	void getMiContourWidth()const
 	{
-		fprintf(mFile,"\"%s.micw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".micw\"");
 	}
 	void getMiContourRelativeWidth()const
 	{
-		fprintf(mFile,"\"%s.mirw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirw\"");
 	}
 protected:
 	ShadingEngine(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
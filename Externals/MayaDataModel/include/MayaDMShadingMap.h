@@ -27,555 +27,555 @@ public:
 	void setMapFunctionU(unsigned int mfu)
 	{
 		if(mfu == 0) return;
-		fprintf(mFile,"\tsetAttr \".mfu\" %i;\n", mfu);
+		writeInt(mFile,"\tsetAttr \".mfu\" ",mfu,";\n");
 	}
 	void setMapFunctionV(unsigned int mfv)
 	{
 		if(mfv == 2) return;
-		fprintf(mFile,"\tsetAttr \".mfv\" %i;\n", mfv);
+		writeInt(mFile,"\tsetAttr \".mfv\" ",mfv,";\n");
 	}
 	void setColor(const float3& c)
 	{
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".c.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".c.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".c.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".c.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".c.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".c.cb\" ",cb,";\n");
 	}
 	void setShadingMapColor(const float3& sc)
 	{
-		fprintf(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShadingMapColorR(float scr)
 	{
 		if(scr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sc.scr\" %f;\n", scr);
+		writeFloat(mFile,"\tsetAttr \".sc.scr\" ",scr,";\n");
 	}
 	void setShadingMapColorG(float scg)
 	{
 		if(scg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sc.scg\" %f;\n", scg);
+		writeFloat(mFile,"\tsetAttr \".sc.scg\" ",scg,";\n");
 	}
 	void setShadingMapColorB(float scb)
 	{
 		if(scb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sc.scb\" %f;\n", scb);
+		writeFloat(mFile,"\tsetAttr \".sc.scb\" ",scb,";\n");
 	}
 	void setGlowColor(const float3& g)
 	{
-		fprintf(mFile,"\tsetAttr \".g\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".g\" -type \"float3\" ");
 		g.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGlowColorR(float gr)
 	{
 		if(gr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g.gr\" %f;\n", gr);
+		writeFloat(mFile,"\tsetAttr \".g.gr\" ",gr,";\n");
 	}
 	void setGlowColorG(float gg)
 	{
 		if(gg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g.gg\" %f;\n", gg);
+		writeFloat(mFile,"\tsetAttr \".g.gg\" ",gg,";\n");
 	}
 	void setGlowColorB(float gb)
 	{
 		if(gb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".g.gb\" %f;\n", gb);
+		writeFloat(mFile,"\tsetAttr \".g.gb\" ",gb,";\n");
 	}
 	void setTransparency(const float3& it)
 	{
-		fprintf(mFile,"\tsetAttr \".it\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".it\" -type \"float3\" ");
 		it.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparencyR(float itr)
 	{
 		if(itr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itr\" %f;\n", itr);
+		writeFloat(mFile,"\tsetAttr \".it.itr\" ",itr,";\n");
 	}
 	void setTransparencyG(float itg)
 	{
 		if(itg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itg\" %f;\n", itg);
+		writeFloat(mFile,"\tsetAttr \".it.itg\" ",itg,";\n");
 	}
 	void setTransparencyB(float itb)
 	{
 		if(itb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".it.itb\" %f;\n", itb);
+		writeFloat(mFile,"\tsetAttr \".it.itb\" ",itb,";\n");
 	}
 	void setMatteOpacityMode(unsigned int mom)
 	{
 		if(mom == 2) return;
-		fprintf(mFile,"\tsetAttr \".mom\" %i;\n", mom);
+		writeInt(mFile,"\tsetAttr \".mom\" ",mom,";\n");
 	}
 	void setMatteOpacity(float mog)
 	{
 		if(mog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mog\" %f;\n", mog);
+		writeFloat(mFile,"\tsetAttr \".mog\" ",mog,";\n");
 	}
 	void setMiDeriveFromMaya(bool mifm)
 	{
 		if(mifm == true) return;
-		fprintf(mFile,"\tsetAttr \".mifm\" %i;\n", mifm);
+		writeInt(mFile,"\tsetAttr \".mifm\" ",mifm,";\n");
 	}
 	void setMiShinyness(float mis)
 	{
 		if(mis == 10) return;
-		fprintf(mFile,"\tsetAttr \".mis\" %f;\n", mis);
+		writeFloat(mFile,"\tsetAttr \".mis\" ",mis,";\n");
 	}
 	void setMiAngle(float mia)
 	{
 		if(mia == 0) return;
-		fprintf(mFile,"\tsetAttr \".mia\" %f;\n", mia);
+		writeFloat(mFile,"\tsetAttr \".mia\" ",mia,";\n");
 	}
 	void setMiSpreadX(float misx)
 	{
 		if(misx == 10) return;
-		fprintf(mFile,"\tsetAttr \".misx\" %f;\n", misx);
+		writeFloat(mFile,"\tsetAttr \".misx\" ",misx,";\n");
 	}
 	void setMiSpreadY(float misy)
 	{
 		if(misy == 5) return;
-		fprintf(mFile,"\tsetAttr \".misy\" %f;\n", misy);
+		writeFloat(mFile,"\tsetAttr \".misy\" ",misy,";\n");
 	}
 	void setMiWhiteness(const float3& miwn)
 	{
-		fprintf(mFile,"\tsetAttr \".miwn\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".miwn\" -type \"float3\" ");
 		miwn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiWhitenessR(float miwnr)
 	{
 		if(miwnr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwnr\" %f;\n", miwnr);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwnr\" ",miwnr,";\n");
 	}
 	void setMiWhitenessG(float miwng)
 	{
 		if(miwng == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwng\" %f;\n", miwng);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwng\" ",miwng,";\n");
 	}
 	void setMiWhitenessB(float miwnb)
 	{
 		if(miwnb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwnb\" %f;\n", miwnb);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwnb\" ",miwnb,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void setMiRefractiveIndex(float miri)
 	{
 		if(miri == 1) return;
-		fprintf(mFile,"\tsetAttr \".miri\" %f;\n", miri);
+		writeFloat(mFile,"\tsetAttr \".miri\" ",miri,";\n");
 	}
 	void setMiRefractions(bool mirc)
 	{
 		if(mirc == true) return;
-		fprintf(mFile,"\tsetAttr \".mirc\" %i;\n", mirc);
+		writeInt(mFile,"\tsetAttr \".mirc\" ",mirc,";\n");
 	}
 	void setMiAbsorbs(bool miab)
 	{
 		if(miab == true) return;
-		fprintf(mFile,"\tsetAttr \".miab\" %i;\n", miab);
+		writeInt(mFile,"\tsetAttr \".miab\" ",miab,";\n");
 	}
 	void setMiDiffuse(float midc)
 	{
 		if(midc == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".midc\" %f;\n", midc);
+		writeFloat(mFile,"\tsetAttr \".midc\" ",midc,";\n");
 	}
 	void setMiColor(const float3& mic)
 	{
-		fprintf(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
 		mic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiColorR(float micr)
 	{
 		if(micr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micr\" %f;\n", micr);
+		writeFloat(mFile,"\tsetAttr \".mic.micr\" ",micr,";\n");
 	}
 	void setMiColorG(float micg)
 	{
 		if(micg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micg\" %f;\n", micg);
+		writeFloat(mFile,"\tsetAttr \".mic.micg\" ",micg,";\n");
 	}
 	void setMiColorB(float micb)
 	{
 		if(micb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micb\" %f;\n", micb);
+		writeFloat(mFile,"\tsetAttr \".mic.micb\" ",micb,";\n");
 	}
 	void setMiTransparency(const float3& mit)
 	{
-		fprintf(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
 		mit.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiTransparencyR(float mitr)
 	{
 		if(mitr == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitr\" %f;\n", mitr);
+		writeFloat(mFile,"\tsetAttr \".mit.mitr\" ",mitr,";\n");
 	}
 	void setMiTransparencyG(float mitg)
 	{
 		if(mitg == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitg\" %f;\n", mitg);
+		writeFloat(mFile,"\tsetAttr \".mit.mitg\" ",mitg,";\n");
 	}
 	void setMiTransparencyB(float mitb)
 	{
 		if(mitb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitb\" %f;\n", mitb);
+		writeFloat(mFile,"\tsetAttr \".mit.mitb\" ",mitb,";\n");
 	}
 	void setMiTranslucence(float mitc)
 	{
 		if(mitc == 0) return;
-		fprintf(mFile,"\tsetAttr \".mitc\" %f;\n", mitc);
+		writeFloat(mFile,"\tsetAttr \".mitc\" ",mitc,";\n");
 	}
 	void setMiTranslucenceFocus(float mitf)
 	{
 		if(mitf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mitf\" %f;\n", mitf);
+		writeFloat(mFile,"\tsetAttr \".mitf\" ",mitf,";\n");
 	}
 	void setMiNormalCamera(const float3& minc)
 	{
-		fprintf(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
 		minc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiNormalCameraX(float mincx)
 	{
 		if(mincx == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincx\" %f;\n", mincx);
+		writeFloat(mFile,"\tsetAttr \".minc.mincx\" ",mincx,";\n");
 	}
 	void setMiNormalCameraY(float mincy)
 	{
 		if(mincy == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincy\" %f;\n", mincy);
+		writeFloat(mFile,"\tsetAttr \".minc.mincy\" ",mincy,";\n");
 	}
 	void setMiNormalCameraZ(float mincz)
 	{
 		if(mincz == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincz\" %f;\n", mincz);
+		writeFloat(mFile,"\tsetAttr \".minc.mincz\" ",mincz,";\n");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.uu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.uu\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.vv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.vv\"");
 	}
 	void getMapFunctionU()const
 	{
-		fprintf(mFile,"\"%s.mfu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mfu\"");
 	}
 	void getMapFunctionV()const
 	{
-		fprintf(mFile,"\"%s.mfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mfv\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.c.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.c.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.c.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cb\"");
 	}
 	void getShadingMapColor()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getShadingMapColorR()const
 	{
-		fprintf(mFile,"\"%s.sc.scr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scr\"");
 	}
 	void getShadingMapColorG()const
 	{
-		fprintf(mFile,"\"%s.sc.scg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scg\"");
 	}
 	void getShadingMapColorB()const
 	{
-		fprintf(mFile,"\"%s.sc.scb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.scb\"");
 	}
 	void getGlowColor()const
 	{
-		fprintf(mFile,"\"%s.g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g\"");
 	}
 	void getGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.g.gr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gr\"");
 	}
 	void getGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.g.gg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gg\"");
 	}
 	void getGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.g.gb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g.gb\"");
 	}
 	void getTransparency()const
 	{
-		fprintf(mFile,"\"%s.it\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it\"");
 	}
 	void getTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.it.itr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itr\"");
 	}
 	void getTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.it.itg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itg\"");
 	}
 	void getTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.it.itb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it.itb\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogb\"");
 	}
 	void getMatteOpacityMode()const
 	{
-		fprintf(mFile,"\"%s.mom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mom\"");
 	}
 	void getMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.mog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mog\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getMiDeriveFromMaya()const
 	{
-		fprintf(mFile,"\"%s.mifm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifm\"");
 	}
 	void getMiShinyness()const
 	{
-		fprintf(mFile,"\"%s.mis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mis\"");
 	}
 	void getMiAngle()const
 	{
-		fprintf(mFile,"\"%s.mia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mia\"");
 	}
 	void getMiSpreadX()const
 	{
-		fprintf(mFile,"\"%s.misx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misx\"");
 	}
 	void getMiSpreadY()const
 	{
-		fprintf(mFile,"\"%s.misy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misy\"");
 	}
 	void getMiWhiteness()const
 	{
-		fprintf(mFile,"\"%s.miwn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn\"");
 	}
 	void getMiWhitenessR()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwnr\"");
 	}
 	void getMiWhitenessG()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwng\"");
 	}
 	void getMiWhitenessB()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwnb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwnb\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 	void getMiRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.miri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miri\"");
 	}
 	void getMiRefractions()const
 	{
-		fprintf(mFile,"\"%s.mirc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirc\"");
 	}
 	void getMiAbsorbs()const
 	{
-		fprintf(mFile,"\"%s.miab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miab\"");
 	}
 	void getMiDiffuse()const
 	{
-		fprintf(mFile,"\"%s.midc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".midc\"");
 	}
 	void getMiColor()const
 	{
-		fprintf(mFile,"\"%s.mic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic\"");
 	}
 	void getMiColorR()const
 	{
-		fprintf(mFile,"\"%s.mic.micr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micr\"");
 	}
 	void getMiColorG()const
 	{
-		fprintf(mFile,"\"%s.mic.micg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micg\"");
 	}
 	void getMiColorB()const
 	{
-		fprintf(mFile,"\"%s.mic.micb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micb\"");
 	}
 	void getMiTransparency()const
 	{
-		fprintf(mFile,"\"%s.mit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit\"");
 	}
 	void getMiTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.mit.mitr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitr\"");
 	}
 	void getMiTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.mit.mitg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitg\"");
 	}
 	void getMiTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.mit.mitb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitb\"");
 	}
 	void getMiTranslucence()const
 	{
-		fprintf(mFile,"\"%s.mitc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitc\"");
 	}
 	void getMiTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.mitf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitf\"");
 	}
 	void getMiNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.minc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc\"");
 	}
 	void getMiNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.minc.mincx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincx\"");
 	}
 	void getMiNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.minc.mincy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincy\"");
 	}
 	void getMiNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincz\"");
 	}
 protected:
 	ShadingMap(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
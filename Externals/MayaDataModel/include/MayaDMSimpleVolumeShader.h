@@ -27,156 +27,156 @@ public:
 	void setParameter1(float p1)
 	{
 		if(p1 == 0.45) return;
-		fprintf(mFile,"\tsetAttr \".p1\" %f;\n", p1);
+		writeFloat(mFile,"\tsetAttr \".p1\" ",p1,";\n");
 	}
 	void setColor(const float3& c)
 	{
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float3\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".c.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.58824) return;
-		fprintf(mFile,"\tsetAttr \".c.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".c.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.644) return;
-		fprintf(mFile,"\tsetAttr \".c.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".c.cb\" ",cb,";\n");
 	}
 	void setPointWorld(const float3& p)
 	{
 		if(p == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".p\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".p\" -type \"float3\" ");
 		p.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPointWorldX(float px)
 	{
 		if(px == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.px\" %f;\n", px);
+		writeFloat(mFile,"\tsetAttr \".p.px\" ",px,";\n");
 	}
 	void setPointWorldY(float py)
 	{
 		if(py == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.py\" %f;\n", py);
+		writeFloat(mFile,"\tsetAttr \".p.py\" ",py,";\n");
 	}
 	void setPointWorldZ(float pz)
 	{
 		if(pz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".p.pz\" %f;\n", pz);
+		writeFloat(mFile,"\tsetAttr \".p.pz\" ",pz,";\n");
 	}
 	void setFarPointWorld(const float3& fp)
 	{
 		if(fp == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".fp\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fp\" -type \"float3\" ");
 		fp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFarPointWorldX(float fpx)
 	{
 		if(fpx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fp.fpx\" %f;\n", fpx);
+		writeFloat(mFile,"\tsetAttr \".fp.fpx\" ",fpx,";\n");
 	}
 	void setFarPointWorldY(float fpy)
 	{
 		if(fpy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fp.fpy\" %f;\n", fpy);
+		writeFloat(mFile,"\tsetAttr \".fp.fpy\" ",fpy,";\n");
 	}
 	void setFarPointWorldZ(float fpz)
 	{
 		if(fpz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fp.fpz\" %f;\n", fpz);
+		writeFloat(mFile,"\tsetAttr \".fp.fpz\" ",fpz,";\n");
 	}
 	void getParameter1()const
 	{
-		fprintf(mFile,"\"%s.p1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p1\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.c.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.c.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.c.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cb\"");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getFarPointWorld()const
 	{
-		fprintf(mFile,"\"%s.fp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp\"");
 	}
 	void getFarPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.fp.fpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp.fpx\"");
 	}
 	void getFarPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.fp.fpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp.fpy\"");
 	}
 	void getFarPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.fp.fpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fp.fpz\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 protected:
 	SimpleVolumeShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
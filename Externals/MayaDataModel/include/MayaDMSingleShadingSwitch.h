@@ -21,7 +21,7 @@ public:
 		float inSingle;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", inSingle);
+			writeFloat(file,"",inSingle," ");
 		}
 	};
 public:
@@ -33,79 +33,79 @@ public:
 
 	void setInput(size_t i_i,const Input& i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i]\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"]\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput(size_t i_start,size_t i_end,Input* i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\" ");
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			i_[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInput(size_t i_start,size_t i_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\"",i_start,i_end);
-		fprintf(mFile," -type \"Input\" ");
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\"");
+		writeString(mFile," -type \"Input\" ");
 	}
 	void appendInput(const Input& i)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		i.write(mFile);
 	}
 	void endInput()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInSingle(size_t i_i,float it)
 	{
 		if(it == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].it\" %f;\n", i_i,it);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].it\" ",it,";\n");
 	}
 	void setDefault(float def)
 	{
 		if(def == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".def\" %f;\n", def);
+		writeFloat(mFile,"\tsetAttr \".def\" ",def,";\n");
 	}
 	void getInput(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getInput()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInSingle(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].it\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].it\"");
 	}
 	void getInSingle()const
 	{
 
-		fprintf(mFile,"\"%s.i.it\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.it\"");
 	}
 	void getInShape(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].is\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].is\"");
 	}
 	void getInShape()const
 	{
 
-		fprintf(mFile,"\"%s.i.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.is\"");
 	}
 	void getDefault()const
 	{
-		fprintf(mFile,"\"%s.def\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".def\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 protected:
 	SingleShadingSwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -24,8 +24,8 @@ public:
 		{
 			for (size_t i = 0; i<nbWeights; ++i)
 			{
-				fprintf(file,"%f", weights[i]);
-				if (i + 1<nbWeights) fprintf(file, " ");
+				writeFloat(file,"",weights[i]);
+				if (i + 1<nbWeights) writeString(file," ");
 			}
 		}
 	};
@@ -38,437 +38,437 @@ public:
 
 	void setWeightList(size_t wl_i,const WeightList& wl)
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i]\" ",wl_i);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_i,"]\" ");
 		wl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeightList(size_t wl_start,size_t wl_end,WeightList* wl)
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i:%i]\" ", wl_start,wl_end);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_start); writeInt(mFile,":",wl_end,"]\" ");
 		size_t size = (wl_end-wl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWeightList(size_t wl_start,size_t wl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i:%i]\"",wl_start,wl_end);
-		fprintf(mFile," -type \"WeightList\" ");
+		writeInt(mFile,"\tsetAttr \".wl[",wl_start); writeInt(mFile,":",wl_end,"]\"");
+		writeString(mFile," -type \"WeightList\" ");
 	}
 	void appendWeightList(const WeightList& wl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wl.write(mFile);
 	}
 	void endWeightList()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeights(size_t wl_i,size_t w_i,double w)
 	{
 		if(w == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wl[%i].w[%i]\" %f;\n", wl_i,w_i,w);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_i); writeInt(mFile,"].w[",w_i); writeFloat(mFile,"]\" ",w,";\n");
 	}
 	void setWeights(size_t wl_i,size_t w_start,size_t w_end,double* w)
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i].w[%i:%i]\" ", wl_i,w_start,w_end);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_i); writeInt(mFile,"].w[",w_start); writeInt(mFile,":",w_end,"]\" ");
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",w[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWeights(size_t wl_i,size_t w_start,size_t w_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i].w[%i:%i]\"",wl_i,w_start,w_end);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_i); writeInt(mFile,"].w[",w_start); writeInt(mFile,":",w_end,"]\"");
 	}
 	void appendWeights(double w)const
 	{
-		fprintf(mFile," %f",w);
+		writeFloat(mFile," ",w);
 	}
 	void endWeights()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBindPreMatrix(size_t pm_i,const matrix& pm)
 	{
 		if(pm == identity) return;
-		fprintf(mFile,"\tsetAttr \".pm[%i]\" -type \"matrix\" ",pm_i);
+		writeInt(mFile,"\tsetAttr \".pm[",pm_i,"]\" -type \"matrix\" ");
 		pm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBindPreMatrix(size_t pm_start,size_t pm_end,matrix* pm)
 	{
-		fprintf(mFile,"\tsetAttr \".pm[%i:%i]\" ", pm_start,pm_end);
+		writeInt(mFile,"\tsetAttr \".pm[",pm_start); writeInt(mFile,":",pm_end,"]\" ");
 		size_t size = (pm_end-pm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			pm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startBindPreMatrix(size_t pm_start,size_t pm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pm[%i:%i]\"",pm_start,pm_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".pm[",pm_start); writeInt(mFile,":",pm_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendBindPreMatrix(const matrix& pm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		pm.write(mFile);
 	}
 	void endBindPreMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGeomMatrix(const matrix& gm)
 	{
 		if(gm == identity) return;
-		fprintf(mFile,"\tsetAttr \".gm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".gm\" -type \"matrix\" ");
 		gm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMatrix(size_t ma_i,const matrix& ma)
 	{
 		if(ma == identity) return;
-		fprintf(mFile,"\tsetAttr \".ma[%i]\" -type \"matrix\" ",ma_i);
+		writeInt(mFile,"\tsetAttr \".ma[",ma_i,"]\" -type \"matrix\" ");
 		ma.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMatrix(size_t ma_start,size_t ma_end,matrix* ma)
 	{
-		fprintf(mFile,"\tsetAttr \".ma[%i:%i]\" ", ma_start,ma_end);
+		writeInt(mFile,"\tsetAttr \".ma[",ma_start); writeInt(mFile,":",ma_end,"]\" ");
 		size_t size = (ma_end-ma_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			ma[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startMatrix(size_t ma_start,size_t ma_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ma[%i:%i]\"",ma_start,ma_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".ma[",ma_start); writeInt(mFile,":",ma_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendMatrix(const matrix& ma)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		ma.write(mFile);
 	}
 	void endMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDropoff(size_t dpf_i,double dpf)
 	{
 		if(dpf == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".dpf[%i]\" %f;\n", dpf_i,dpf);
+		writeInt(mFile,"\tsetAttr \".dpf[",dpf_i); writeFloat(mFile,"]\" ",dpf,";\n");
 	}
 	void setDropoff(size_t dpf_start,size_t dpf_end,double* dpf)
 	{
-		fprintf(mFile,"\tsetAttr \".dpf[%i:%i]\" ", dpf_start,dpf_end);
+		writeInt(mFile,"\tsetAttr \".dpf[",dpf_start); writeInt(mFile,":",dpf_end,"]\" ");
 		size_t size = (dpf_end-dpf_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",dpf[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",dpf[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startDropoff(size_t dpf_start,size_t dpf_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".dpf[%i:%i]\"",dpf_start,dpf_end);
+		writeInt(mFile,"\tsetAttr \".dpf[",dpf_start); writeInt(mFile,":",dpf_end,"]\"");
 	}
 	void appendDropoff(double dpf)const
 	{
-		fprintf(mFile," %f",dpf);
+		writeFloat(mFile," ",dpf);
 	}
 	void endDropoff()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSmoothness(size_t smt_i,double smt)
 	{
 		if(smt == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".smt[%i]\" %f;\n", smt_i,smt);
+		writeInt(mFile,"\tsetAttr \".smt[",smt_i); writeFloat(mFile,"]\" ",smt,";\n");
 	}
 	void setSmoothness(size_t smt_start,size_t smt_end,double* smt)
 	{
-		fprintf(mFile,"\tsetAttr \".smt[%i:%i]\" ", smt_start,smt_end);
+		writeInt(mFile,"\tsetAttr \".smt[",smt_start); writeInt(mFile,":",smt_end,"]\" ");
 		size_t size = (smt_end-smt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",smt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",smt[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSmoothness(size_t smt_start,size_t smt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".smt[%i:%i]\"",smt_start,smt_end);
+		writeInt(mFile,"\tsetAttr \".smt[",smt_start); writeInt(mFile,":",smt_end,"]\"");
 	}
 	void appendSmoothness(double smt)const
 	{
-		fprintf(mFile," %f",smt);
+		writeFloat(mFile," ",smt);
 	}
 	void endSmoothness()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLockWeights(size_t lw_i,bool lw)
 	{
 		if(lw == false) return;
-		fprintf(mFile,"\tsetAttr \".lw[%i]\" %i;\n", lw_i,lw);
+		writeInt(mFile,"\tsetAttr \".lw[",lw_i); writeInt(mFile,"]\" ",lw,";\n");
 	}
 	void setLockWeights(size_t lw_start,size_t lw_end,bool* lw)
 	{
-		fprintf(mFile,"\tsetAttr \".lw[%i:%i]\" ", lw_start,lw_end);
+		writeInt(mFile,"\tsetAttr \".lw[",lw_start); writeInt(mFile,":",lw_end,"]\" ");
 		size_t size = (lw_end-lw_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",lw[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",lw[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLockWeights(size_t lw_start,size_t lw_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".lw[%i:%i]\"",lw_start,lw_end);
+		writeInt(mFile,"\tsetAttr \".lw[",lw_start); writeInt(mFile,":",lw_end,"]\"");
 	}
 	void appendLockWeights(bool lw)const
 	{
-		fprintf(mFile," %i",lw);
+		writeInt(mFile," ",lw);
 	}
 	void endLockWeights()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaintainMaxInfluences(bool mmi)
 	{
 		if(mmi == false) return;
-		fprintf(mFile,"\tsetAttr \".mmi\" %i;\n", mmi);
+		writeInt(mFile,"\tsetAttr \".mmi\" ",mmi,";\n");
 	}
 	void setMaxInfluences(int mi)
 	{
 		if(mi == 2) return;
-		fprintf(mFile,"\tsetAttr \".mi\" %i;\n", mi);
+		writeInt(mFile,"\tsetAttr \".mi\" ",mi,";\n");
 	}
 	void setBindMethod(int bm)
 	{
 		if(bm == 1) return;
-		fprintf(mFile,"\tsetAttr \".bm\" %i;\n", bm);
+		writeInt(mFile,"\tsetAttr \".bm\" ",bm,";\n");
 	}
 	void setPaintWeights(const doubleArray& ptw)
 	{
 		if(ptw.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".ptw\" -type \"doubleArray\" ");
+		writeString(mFile,"\tsetAttr \".ptw\" -type \"doubleArray\" ");
 		ptw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseComponents(bool uc)
 	{
 		if(uc == 0) return;
-		fprintf(mFile,"\tsetAttr \".uc\" %i;\n", uc);
+		writeInt(mFile,"\tsetAttr \".uc\" ",uc,";\n");
 	}
 	void setNurbsSamples(size_t ns_i,int ns)
 	{
 		if(ns == 10) return;
-		fprintf(mFile,"\tsetAttr \".ns[%i]\" %i;\n", ns_i,ns);
+		writeInt(mFile,"\tsetAttr \".ns[",ns_i); writeInt(mFile,"]\" ",ns,";\n");
 	}
 	void setNurbsSamples(size_t ns_start,size_t ns_end,int* ns)
 	{
-		fprintf(mFile,"\tsetAttr \".ns[%i:%i]\" ", ns_start,ns_end);
+		writeInt(mFile,"\tsetAttr \".ns[",ns_start); writeInt(mFile,":",ns_end,"]\" ");
 		size_t size = (ns_end-ns_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ns[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ns[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startNurbsSamples(size_t ns_start,size_t ns_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ns[%i:%i]\"",ns_start,ns_end);
+		writeInt(mFile,"\tsetAttr \".ns[",ns_start); writeInt(mFile,":",ns_end,"]\"");
 	}
 	void appendNurbsSamples(int ns)const
 	{
-		fprintf(mFile," %i",ns);
+		writeInt(mFile," ",ns);
 	}
 	void endNurbsSamples()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUseComponentsMatrix(bool ucm)
 	{
 		if(ucm == false) return;
-		fprintf(mFile,"\tsetAttr \".ucm\" %i;\n", ucm);
+		writeInt(mFile,"\tsetAttr \".ucm\" ",ucm,";\n");
 	}
 	void setNormalizeWeights(bool nw)
 	{
 		if(nw == true) return;
-		fprintf(mFile,"\tsetAttr \".nw\" %i;\n", nw);
+		writeInt(mFile,"\tsetAttr \".nw\" ",nw,";\n");
 	}
 	void setDeformUserNormals(bool dun)
 	{
 		if(dun == true) return;
-		fprintf(mFile,"\tsetAttr \".dun\" %i;\n", dun);
+		writeInt(mFile,"\tsetAttr \".dun\" ",dun,";\n");
 	}
 	void getWeightList(size_t wl_i)const
 	{
-		fprintf(mFile,"\"%s.wl[%i]\"",mName.c_str(),wl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wl[",wl_i,"]\"");
 	}
 	void getWeightList()const
 	{
 
-		fprintf(mFile,"\"%s.wl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wl\"");
 	}
 	void getWeights(size_t wl_i,size_t w_i)const
 	{
-		fprintf(mFile,"\"%s.wl[%i].w[%i]\"",mName.c_str(),wl_i,w_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wl[",wl_i); writeInt(mFile,"].w[",w_i,"]\"");
 	}
 	void getWeights(size_t w_i)const
 	{
 
-		fprintf(mFile,"\"%s.wl.w[%i]\"",mName.c_str(),w_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wl.w[",w_i,"]\"");
 	}
 	void getBindPreMatrix(size_t pm_i)const
 	{
-		fprintf(mFile,"\"%s.pm[%i]\"",mName.c_str(),pm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pm[",pm_i,"]\"");
 	}
 	void getBindPreMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.pm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pm\"");
 	}
 	void getGeomMatrix()const
 	{
-		fprintf(mFile,"\"%s.gm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gm\"");
 	}
 	void getMatrix(size_t ma_i)const
 	{
-		fprintf(mFile,"\"%s.ma[%i]\"",mName.c_str(),ma_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ma[",ma_i,"]\"");
 	}
 	void getMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.ma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ma\"");
 	}
 	void getDropoffRate()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getDropoff(size_t dpf_i)const
 	{
-		fprintf(mFile,"\"%s.dpf[%i]\"",mName.c_str(),dpf_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".dpf[",dpf_i,"]\"");
 	}
 	void getDropoff()const
 	{
 
-		fprintf(mFile,"\"%s.dpf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dpf\"");
 	}
 	void getSmoothness(size_t smt_i)const
 	{
-		fprintf(mFile,"\"%s.smt[%i]\"",mName.c_str(),smt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".smt[",smt_i,"]\"");
 	}
 	void getSmoothness()const
 	{
 
-		fprintf(mFile,"\"%s.smt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smt\"");
 	}
 	void getLockWeights(size_t lw_i)const
 	{
-		fprintf(mFile,"\"%s.lw[%i]\"",mName.c_str(),lw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lw[",lw_i,"]\"");
 	}
 	void getLockWeights()const
 	{
 
-		fprintf(mFile,"\"%s.lw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lw\"");
 	}
 	void getMaintainMaxInfluences()const
 	{
-		fprintf(mFile,"\"%s.mmi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mmi\"");
 	}
 	void getMaxInfluences()const
 	{
-		fprintf(mFile,"\"%s.mi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mi\"");
 	}
 	void getBindMethod()const
 	{
-		fprintf(mFile,"\"%s.bm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bm\"");
 	}
 	void getDriverPoints(size_t drp_i)const
 	{
-		fprintf(mFile,"\"%s.drp[%i]\"",mName.c_str(),drp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".drp[",drp_i,"]\"");
 	}
 	void getDriverPoints()const
 	{
 
-		fprintf(mFile,"\"%s.drp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drp\"");
 	}
 	void getBasePoints(size_t bsp_i)const
 	{
-		fprintf(mFile,"\"%s.bsp[%i]\"",mName.c_str(),bsp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".bsp[",bsp_i,"]\"");
 	}
 	void getBasePoints()const
 	{
 
-		fprintf(mFile,"\"%s.bsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bsp\"");
 	}
 	void getBaseDirty()const
 	{
-		fprintf(mFile,"\"%s.bsd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bsd\"");
 	}
 	void getPaintWeights()const
 	{
-		fprintf(mFile,"\"%s.ptw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ptw\"");
 	}
 	void getPaintTrans()const
 	{
-		fprintf(mFile,"\"%s.ptt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ptt\"");
 	}
 	void getPaintArrDirty()const
 	{
-		fprintf(mFile,"\"%s.pad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pad\"");
 	}
 	void getUseComponents()const
 	{
-		fprintf(mFile,"\"%s.uc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uc\"");
 	}
 	void getNurbsSamples(size_t ns_i)const
 	{
-		fprintf(mFile,"\"%s.ns[%i]\"",mName.c_str(),ns_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ns[",ns_i,"]\"");
 	}
 	void getNurbsSamples()const
 	{
 
-		fprintf(mFile,"\"%s.ns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ns\"");
 	}
 	void getUseComponentsMatrix()const
 	{
-		fprintf(mFile,"\"%s.ucm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ucm\"");
 	}
 	void getNormalizeWeights()const
 	{
-		fprintf(mFile,"\"%s.nw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nw\"");
 	}
 	void getDeformUserNormals()const
 	{
-		fprintf(mFile,"\"%s.dun\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dun\"");
 	}
 	void getWtDrty()const
 	{
-		fprintf(mFile,"\"%s.wtd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wtd\"");
 	}
 	void getBindPose()const
 	{
-		fprintf(mFile,"\"%s.bp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bp\"");
 	}
 protected:
 	SkinCluster(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
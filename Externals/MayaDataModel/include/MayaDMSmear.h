@@ -27,52 +27,52 @@ public:
 	void setInRgb(const float3& i_)
 	{
 		if(i_ == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".i\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".i\" -type \"float3\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInColorR(float ir)
 	{
 		if(ir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ir\" %f;\n", ir);
+		writeFloat(mFile,"\tsetAttr \".i.ir\" ",ir,";\n");
 	}
 	void setInColorG(float ig)
 	{
 		if(ig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ig\" %f;\n", ig);
+		writeFloat(mFile,"\tsetAttr \".i.ig\" ",ig,";\n");
 	}
 	void setInColorB(float ib)
 	{
 		if(ib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i.ib\" %f;\n", ib);
+		writeFloat(mFile,"\tsetAttr \".i.ib\" ",ib,";\n");
 	}
 	void getInRgb()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getInColorR()const
 	{
-		fprintf(mFile,"\"%s.i.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ir\"");
 	}
 	void getInColorG()const
 	{
-		fprintf(mFile,"\"%s.i.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ig\"");
 	}
 	void getInColorB()const
 	{
-		fprintf(mFile,"\"%s.i.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.ib\"");
 	}
 	void getOutUV()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutU()const
 	{
-		fprintf(mFile,"\"%s.o.ou\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ou\"");
 	}
 	void getOutV()const
 	{
-		fprintf(mFile,"\"%s.o.ov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ov\"");
 	}
 protected:
 	Smear(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,112 +27,112 @@ public:
 	void setStartTime(double s)
 	{
 		if(s == 0) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setEndTime(double e)
 	{
 		if(e == 0) return;
-		fprintf(mFile,"\tsetAttr \".e\" %f;\n", e);
+		writeFloat(mFile,"\tsetAttr \".e\" ",e,";\n");
 	}
 	void setIncrement(double b)
 	{
 		if(b == 1) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setInputMatrix(const matrix& im)
 	{
 		if(im == identity) return;
-		fprintf(mFile,"\tsetAttr \".im\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".im\" -type \"matrix\" ");
 		im.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalPosition(const double3& lp)
 	{
 		if(lp == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".lp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".lp\" -type \"double3\" ");
 		lp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocalPositionX(double lpx)
 	{
 		if(lpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".lp.lpx\" %f;\n", lpx);
+		writeFloat(mFile,"\tsetAttr \".lp.lpx\" ",lpx,";\n");
 	}
 	void setLocalPositionY(double lpy)
 	{
 		if(lpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".lp.lpy\" %f;\n", lpy);
+		writeFloat(mFile,"\tsetAttr \".lp.lpy\" ",lpy,";\n");
 	}
 	void setLocalPositionZ(double lpz)
 	{
 		if(lpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".lp.lpz\" %f;\n", lpz);
+		writeFloat(mFile,"\tsetAttr \".lp.lpz\" ",lpz,";\n");
 	}
 	void setUpdate(unsigned int up)
 	{
 		if(up == 1) return;
-		fprintf(mFile,"\tsetAttr \".up\" %i;\n", up);
+		writeInt(mFile,"\tsetAttr \".up\" ",up,";\n");
 	}
 	void getStartTime()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getEndTime()const
 	{
-		fprintf(mFile,"\"%s.e\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e\"");
 	}
 	void getIncrement()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getInputGeom()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getOutputGeom(size_t out_i)const
 	{
-		fprintf(mFile,"\"%s.out[%i]\"",mName.c_str(),out_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".out[",out_i,"]\"");
 	}
 	void getOutputGeom()const
 	{
 
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 	void getInputMatrix()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getLocalPosition()const
 	{
-		fprintf(mFile,"\"%s.lp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp\"");
 	}
 	void getLocalPositionX()const
 	{
-		fprintf(mFile,"\"%s.lp.lpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpx\"");
 	}
 	void getLocalPositionY()const
 	{
-		fprintf(mFile,"\"%s.lp.lpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpy\"");
 	}
 	void getLocalPositionZ()const
 	{
-		fprintf(mFile,"\"%s.lp.lpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lp.lpz\"");
 	}
 	void getPoints()const
 	{
-		fprintf(mFile,"\"%s.pts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pts\"");
 	}
 	void getFrames()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getAnimCurveChanged()const
 	{
-		fprintf(mFile,"\"%s.acc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".acc\"");
 	}
 	void getUpdate()const
 	{
-		fprintf(mFile,"\"%s.up\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".up\"");
 	}
 protected:
 	Snapshot(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,42 +27,42 @@ public:
 	void setPoints(const pointArray& pts)
 	{
 		if(pts.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".pts\" -type \"pointArray\" ");
+		writeString(mFile,"\tsetAttr \".pts\" -type \"pointArray\" ");
 		pts.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFrames(const intArray& f)
 	{
 		if(f.size == 0) return;
-		fprintf(mFile,"\tsetAttr \".f\" -type \"intArray\" ");
+		writeString(mFile,"\tsetAttr \".f\" -type \"intArray\" ");
 		f.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDrawStyle(unsigned int d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setShowFrames(bool sf)
 	{
 		if(sf == 0) return;
-		fprintf(mFile,"\tsetAttr \".sf\" %i;\n", sf);
+		writeInt(mFile,"\tsetAttr \".sf\" ",sf,";\n");
 	}
 	void getPoints()const
 	{
-		fprintf(mFile,"\"%s.pts\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pts\"");
 	}
 	void getFrames()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getDrawStyle()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getShowFrames()const
 	{
-		fprintf(mFile,"\"%s.sf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sf\"");
 	}
 protected:
 	SnapshotShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
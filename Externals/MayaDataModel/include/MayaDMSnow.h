@@ -27,157 +27,157 @@ public:
 	void setSnowColor(const float3& sn)
 	{
 		if(sn == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".sn\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sn\" -type \"float3\" ");
 		sn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSnowColorR(float snr)
 	{
 		if(snr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sn.snr\" %f;\n", snr);
+		writeFloat(mFile,"\tsetAttr \".sn.snr\" ",snr,";\n");
 	}
 	void setSnowColorG(float sng)
 	{
 		if(sng == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sn.sng\" %f;\n", sng);
+		writeFloat(mFile,"\tsetAttr \".sn.sng\" ",sng,";\n");
 	}
 	void setSnowColorB(float snb)
 	{
 		if(snb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sn.snb\" %f;\n", snb);
+		writeFloat(mFile,"\tsetAttr \".sn.snb\" ",snb,";\n");
 	}
 	void setSurfaceColor(const float3& su)
 	{
 		if(su == float3(0.5f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".su\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".su\" -type \"float3\" ");
 		su.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSurfaceColorR(float sur)
 	{
 		if(sur == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".su.sur\" %f;\n", sur);
+		writeFloat(mFile,"\tsetAttr \".su.sur\" ",sur,";\n");
 	}
 	void setSurfaceColorG(float sug)
 	{
 		if(sug == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".su.sug\" %f;\n", sug);
+		writeFloat(mFile,"\tsetAttr \".su.sug\" ",sug,";\n");
 	}
 	void setSurfaceColorB(float sub)
 	{
 		if(sub == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".su.sub\" %f;\n", sub);
+		writeFloat(mFile,"\tsetAttr \".su.sub\" ",sub,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void setDepthDecay(float dd)
 	{
 		if(dd == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".dd\" %f;\n", dd);
+		writeFloat(mFile,"\tsetAttr \".dd\" ",dd,";\n");
 	}
 	void setThickness(float tn)
 	{
 		if(tn == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tn\" %f;\n", tn);
+		writeFloat(mFile,"\tsetAttr \".tn\" ",tn,";\n");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getEyeToTextureMatrix()const
 	{
-		fprintf(mFile,"\"%s.e2t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2t\"");
 	}
 	void getSnowColor()const
 	{
-		fprintf(mFile,"\"%s.sn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sn\"");
 	}
 	void getSnowColorR()const
 	{
-		fprintf(mFile,"\"%s.sn.snr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sn.snr\"");
 	}
 	void getSnowColorG()const
 	{
-		fprintf(mFile,"\"%s.sn.sng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sn.sng\"");
 	}
 	void getSnowColorB()const
 	{
-		fprintf(mFile,"\"%s.sn.snb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sn.snb\"");
 	}
 	void getSurfaceColor()const
 	{
-		fprintf(mFile,"\"%s.su\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su\"");
 	}
 	void getSurfaceColorR()const
 	{
-		fprintf(mFile,"\"%s.su.sur\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su.sur\"");
 	}
 	void getSurfaceColorG()const
 	{
-		fprintf(mFile,"\"%s.su.sug\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su.sug\"");
 	}
 	void getSurfaceColorB()const
 	{
-		fprintf(mFile,"\"%s.su.sub\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".su.sub\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getDepthDecay()const
 	{
-		fprintf(mFile,"\"%s.dd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dd\"");
 	}
 	void getThickness()const
 	{
-		fprintf(mFile,"\"%s.tn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tn\"");
 	}
 protected:
 	Snow(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -28,9 +28,9 @@ public:
 		unsigned int falloffCurve_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", falloffCurve_Position);
-			fprintf(file,"%f ", falloffCurve_FloatValue);
-			fprintf(file,"%i", falloffCurve_Interp);
+			writeFloat(file,"",falloffCurve_Position," ");
+			writeFloat(file,"",falloffCurve_FloatValue," ");
+			writeInt(file,"",falloffCurve_Interp);
 		}
 	};
 public:
@@ -43,330 +43,330 @@ public:
 	void setPercentResolution(float ptr)
 	{
 		if(ptr == 5) return;
-		fprintf(mFile,"\tsetAttr \".ptr\" %f;\n", ptr);
+		writeFloat(mFile,"\tsetAttr \".ptr\" ",ptr,";\n");
 	}
 	void setUsePartialResolution(unsigned int upr)
 	{
 		if(upr == 0) return;
-		fprintf(mFile,"\tsetAttr \".upr\" %i;\n", upr);
+		writeInt(mFile,"\tsetAttr \".upr\" ",upr,";\n");
 	}
 	void setRelative(bool rel)
 	{
 		if(rel == false) return;
-		fprintf(mFile,"\tsetAttr \".rel\" %i;\n", rel);
+		writeInt(mFile,"\tsetAttr \".rel\" ",rel,";\n");
 	}
 	void setWeightedCompensationMatrix(const matrix& wcm)
 	{
 		if(wcm == identity) return;
-		fprintf(mFile,"\tsetAttr \".wcm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".wcm\" -type \"matrix\" ");
 		wcm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGeomMatrix(size_t gm_i,const matrix& gm)
 	{
 		if(gm == identity) return;
-		fprintf(mFile,"\tsetAttr \".gm[%i]\" -type \"matrix\" ",gm_i);
+		writeInt(mFile,"\tsetAttr \".gm[",gm_i,"]\" -type \"matrix\" ");
 		gm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGeomMatrix(size_t gm_start,size_t gm_end,matrix* gm)
 	{
-		fprintf(mFile,"\tsetAttr \".gm[%i:%i]\" ", gm_start,gm_end);
+		writeInt(mFile,"\tsetAttr \".gm[",gm_start); writeInt(mFile,":",gm_end,"]\" ");
 		size_t size = (gm_end-gm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			gm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startGeomMatrix(size_t gm_start,size_t gm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".gm[%i:%i]\"",gm_start,gm_end);
-		fprintf(mFile," -type \"matrix\" ");
+		writeInt(mFile,"\tsetAttr \".gm[",gm_start); writeInt(mFile,":",gm_end,"]\"");
+		writeString(mFile," -type \"matrix\" ");
 	}
 	void appendGeomMatrix(const matrix& gm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		gm.write(mFile);
 	}
 	void endGeomMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMatrix(const matrix& ma)
 	{
 		if(ma == identity) return;
-		fprintf(mFile,"\tsetAttr \".ma\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".ma\" -type \"matrix\" ");
 		ma.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBindPreMatrix(const matrix& pm)
 	{
 		if(pm == identity) return;
-		fprintf(mFile,"\tsetAttr \".pm\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".pm\" -type \"matrix\" ");
 		pm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFalloffCurve(size_t fc_i,const FalloffCurve& fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i]\" ",fc_i);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i,"]\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFalloffCurve(size_t fc_start,size_t fc_end,FalloffCurve* fc)
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i:%i]\" ", fc_start,fc_end);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_start); writeInt(mFile,":",fc_end,"]\" ");
 		size_t size = (fc_end-fc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			fc[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startFalloffCurve(size_t fc_start,size_t fc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".fc[%i:%i]\"",fc_start,fc_end);
-		fprintf(mFile," -type \"FalloffCurve\" ");
+		writeInt(mFile,"\tsetAttr \".fc[",fc_start); writeInt(mFile,":",fc_end,"]\"");
+		writeString(mFile," -type \"FalloffCurve\" ");
 	}
 	void appendFalloffCurve(const FalloffCurve& fc)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		fc.write(mFile);
 	}
 	void endFalloffCurve()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFalloffCurve_Position(size_t fc_i,float fcp)
 	{
 		if(fcp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc[%i].fcp\" %f;\n", fc_i,fcp);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i); writeFloat(mFile,"].fcp\" ",fcp,";\n");
 	}
 	void setFalloffCurve_FloatValue(size_t fc_i,float fcfv)
 	{
 		if(fcfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc[%i].fcfv\" %f;\n", fc_i,fcfv);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i); writeFloat(mFile,"].fcfv\" ",fcfv,";\n");
 	}
 	void setFalloffCurve_Interp(size_t fc_i,unsigned int fci)
 	{
 		if(fci == 0) return;
-		fprintf(mFile,"\tsetAttr \".fc[%i].fci\" %i;\n", fc_i,fci);
+		writeInt(mFile,"\tsetAttr \".fc[",fc_i); writeInt(mFile,"].fci\" ",fci,";\n");
 	}
 	void setFalloffRadius(double fr)
 	{
 		if(fr == 5) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setFalloffCenter(const double3& fcr)
 	{
-		fprintf(mFile,"\tsetAttr \".fcr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".fcr\" -type \"double3\" ");
 		fcr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFalloffCenterX(double fcx)
 	{
 		if(fcx == 0) return;
-		fprintf(mFile,"\tsetAttr \".fcr.fcx\" %f;\n", fcx);
+		writeFloat(mFile,"\tsetAttr \".fcr.fcx\" ",fcx,";\n");
 	}
 	void setFalloffCenterY(double fcy)
 	{
 		if(fcy == 0) return;
-		fprintf(mFile,"\tsetAttr \".fcr.fcy\" %f;\n", fcy);
+		writeFloat(mFile,"\tsetAttr \".fcr.fcy\" ",fcy,";\n");
 	}
 	void setFalloffCenterZ(double fcz)
 	{
 		if(fcz == 0) return;
-		fprintf(mFile,"\tsetAttr \".fcr.fcz\" %f;\n", fcz);
+		writeFloat(mFile,"\tsetAttr \".fcr.fcz\" ",fcz,";\n");
 	}
 	void setFalloffInX(bool fix)
 	{
 		if(fix == true) return;
-		fprintf(mFile,"\tsetAttr \".fix\" %i;\n", fix);
+		writeInt(mFile,"\tsetAttr \".fix\" ",fix,";\n");
 	}
 	void setFalloffInY(bool fiy)
 	{
 		if(fiy == true) return;
-		fprintf(mFile,"\tsetAttr \".fiy\" %i;\n", fiy);
+		writeInt(mFile,"\tsetAttr \".fiy\" ",fiy,";\n");
 	}
 	void setFalloffInZ(bool fiz)
 	{
 		if(fiz == true) return;
-		fprintf(mFile,"\tsetAttr \".fiz\" %i;\n", fiz);
+		writeInt(mFile,"\tsetAttr \".fiz\" ",fiz,";\n");
 	}
 	void setFalloffAroundSelection(bool fas)
 	{
 		if(fas == true) return;
-		fprintf(mFile,"\tsetAttr \".fas\" %i;\n", fas);
+		writeInt(mFile,"\tsetAttr \".fas\" ",fas,";\n");
 	}
 	void setFalloffMasking(bool fm)
 	{
 		if(fm == true) return;
-		fprintf(mFile,"\tsetAttr \".fm\" %i;\n", fm);
+		writeInt(mFile,"\tsetAttr \".fm\" ",fm,";\n");
 	}
 	void setInfluenceMatrix(const matrix& im)
 	{
 		if(im == identity) return;
-		fprintf(mFile,"\tsetAttr \".im\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".im\" -type \"matrix\" ");
 		im.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAngleInterpolation(unsigned int ait)
 	{
 		if(ait == 0) return;
-		fprintf(mFile,"\tsetAttr \".ait\" %i;\n", ait);
+		writeInt(mFile,"\tsetAttr \".ait\" ",ait,";\n");
 	}
 	void setUseDistanceCache(bool udc)
 	{
 		if(udc == true) return;
-		fprintf(mFile,"\tsetAttr \".udc\" %i;\n", udc);
+		writeInt(mFile,"\tsetAttr \".udc\" ",udc,";\n");
 	}
 	void setFalloffMode(unsigned int fom)
 	{
 		if(fom == 0) return;
-		fprintf(mFile,"\tsetAttr \".fom\" %i;\n", fom);
+		writeInt(mFile,"\tsetAttr \".fom\" ",fom,";\n");
 	}
 	void getUsePartialResolution()const
 	{
-		fprintf(mFile,"\"%s.upr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".upr\"");
 	}
 	void getRelative()const
 	{
-		fprintf(mFile,"\"%s.rel\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rel\"");
 	}
 	void getSoftModXforms()const
 	{
-		fprintf(mFile,"\"%s.x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x\"");
 	}
 	void getPreMatrix()const
 	{
-		fprintf(mFile,"\"%s.x.pre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.pre\"");
 	}
 	void getWeightedMatrix()const
 	{
-		fprintf(mFile,"\"%s.x.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.wt\"");
 	}
 	void getPostMatrix()const
 	{
-		fprintf(mFile,"\"%s.x.post\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".x.post\"");
 	}
 	void getWeightedCompensationMatrix()const
 	{
-		fprintf(mFile,"\"%s.wcm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wcm\"");
 	}
 	void getGeomMatrix(size_t gm_i)const
 	{
-		fprintf(mFile,"\"%s.gm[%i]\"",mName.c_str(),gm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".gm[",gm_i,"]\"");
 	}
 	void getGeomMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.gm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gm\"");
 	}
 	void getMatrix()const
 	{
-		fprintf(mFile,"\"%s.ma\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ma\"");
 	}
 	void getBindPreMatrix()const
 	{
-		fprintf(mFile,"\"%s.pm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pm\"");
 	}
 	void getFalloffCurve(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i]\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"]\"");
 	}
 	void getFalloffCurve()const
 	{
 
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFalloffCurve_Position(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i].fcp\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"].fcp\"");
 	}
 	void getFalloffCurve_Position()const
 	{
 
-		fprintf(mFile,"\"%s.fc.fcp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcp\"");
 	}
 	void getFalloffCurve_FloatValue(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i].fcfv\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"].fcfv\"");
 	}
 	void getFalloffCurve_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.fc.fcfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcfv\"");
 	}
 	void getFalloffCurve_Interp(size_t fc_i)const
 	{
-		fprintf(mFile,"\"%s.fc[%i].fci\"",mName.c_str(),fc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fc[",fc_i,"].fci\"");
 	}
 	void getFalloffCurve_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.fc.fci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fci\"");
 	}
 	void getFalloffRadius()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getFalloffCenter()const
 	{
-		fprintf(mFile,"\"%s.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcr\"");
 	}
 	void getFalloffCenterX()const
 	{
-		fprintf(mFile,"\"%s.fcr.fcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcr.fcx\"");
 	}
 	void getFalloffCenterY()const
 	{
-		fprintf(mFile,"\"%s.fcr.fcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcr.fcy\"");
 	}
 	void getFalloffCenterZ()const
 	{
-		fprintf(mFile,"\"%s.fcr.fcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcr.fcz\"");
 	}
 	void getFalloffInX()const
 	{
-		fprintf(mFile,"\"%s.fix\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fix\"");
 	}
 	void getFalloffInY()const
 	{
-		fprintf(mFile,"\"%s.fiy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fiy\"");
 	}
 	void getFalloffInZ()const
 	{
-		fprintf(mFile,"\"%s.fiz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fiz\"");
 	}
 	void getFalloffAroundSelection()const
 	{
-		fprintf(mFile,"\"%s.fas\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fas\"");
 	}
 	void getFalloffMasking()const
 	{
-		fprintf(mFile,"\"%s.fm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fm\"");
 	}
 	void getInfluenceMatrix()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getAngleInterpolation()const
 	{
-		fprintf(mFile,"\"%s.ait\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ait\"");
 	}
 	void getUseDistanceCache()const
 	{
-		fprintf(mFile,"\"%s.udc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".udc\"");
 	}
 	void getDistanceCacheDirty()const
 	{
-		fprintf(mFile,"\"%s.dcd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcd\"");
 	}
 	void getFalloffMode()const
 	{
-		fprintf(mFile,"\"%s.fom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fom\"");
 	}
 protected:
 	SoftMod(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
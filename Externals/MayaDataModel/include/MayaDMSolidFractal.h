@@ -27,191 +27,191 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setAmplitude(float a)
 	{
 		if(a == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void setRipples(const float3& r)
 	{
 		if(r == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".r\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".r\" -type \"float3\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRipplesX(float rx)
 	{
 		if(rx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".r.rx\" ",rx,";\n");
 	}
 	void setRipplesY(float ry)
 	{
 		if(ry == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".r.ry\" ",ry,";\n");
 	}
 	void setRipplesZ(float rz)
 	{
 		if(rz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".r.rz\" ",rz,";\n");
 	}
 	void setDepth(const float2& d)
 	{
 		if(d == float2(0.0f,8.0f)) return;
-		fprintf(mFile,"\tsetAttr \".d\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"float2\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDepthMin(float dmn)
 	{
 		if(dmn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmn\" %f;\n", dmn);
+		writeFloat(mFile,"\tsetAttr \".d.dmn\" ",dmn,";\n");
 	}
 	void setDepthMax(float dmx)
 	{
 		if(dmx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmx\" %f;\n", dmx);
+		writeFloat(mFile,"\tsetAttr \".d.dmx\" ",dmx,";\n");
 	}
 	void setFrequencyRatio(float fr)
 	{
 		if(fr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setBias(float bs)
 	{
 		if(bs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bs\" %f;\n", bs);
+		writeFloat(mFile,"\tsetAttr \".bs\" ",bs,";\n");
 	}
 	void setInflection(bool in)
 	{
 		if(in == false) return;
-		fprintf(mFile,"\tsetAttr \".in\" %i;\n", in);
+		writeInt(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setAnimated(bool an)
 	{
 		if(an == false) return;
-		fprintf(mFile,"\tsetAttr \".an\" %i;\n", an);
+		writeInt(mFile,"\tsetAttr \".an\" ",an,";\n");
 	}
 	void setTimeRatio(float tr)
 	{
 		if(tr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".tr\" %f;\n", tr);
+		writeFloat(mFile,"\tsetAttr \".tr\" ",tr,";\n");
 	}
 	void setTime(float ti)
 	{
 		if(ti == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ti\" %f;\n", ti);
+		writeFloat(mFile,"\tsetAttr \".ti\" ",ti,";\n");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getRipples()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRipplesX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRipplesY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRipplesZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDepthMin()const
 	{
-		fprintf(mFile,"\"%s.d.dmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmn\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.d.dmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmx\"");
 	}
 	void getFrequencyRatio()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getBias()const
 	{
-		fprintf(mFile,"\"%s.bs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bs\"");
 	}
 	void getInflection()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getAnimated()const
 	{
-		fprintf(mFile,"\"%s.an\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".an\"");
 	}
 	void getTimeRatio()const
 	{
-		fprintf(mFile,"\"%s.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tr\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.ti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ti\"");
 	}
 protected:
 	SolidFractal(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,15 +27,15 @@ public:
 	void setTangentContinuityProfile1(bool tp1)
 	{
 		if(tp1 == false) return;
-		fprintf(mFile,"\tsetAttr \".tp1\" %i;\n", tp1);
+		writeInt(mFile,"\tsetAttr \".tp1\" ",tp1,";\n");
 	}
 	void getInputProfile()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getTangentContinuityProfile1()const
 	{
-		fprintf(mFile,"\"%s.tp1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tp1\"");
 	}
 protected:
 	SpBirailSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,99 +27,99 @@ public:
 	void setCurveFitCheckpoints(int cfc)
 	{
 		if(cfc == 5) return;
-		fprintf(mFile,"\tsetAttr \".cfc\" %i;\n", cfc);
+		writeInt(mFile,"\tsetAttr \".cfc\" ",cfc,";\n");
 	}
 	void setContinuityType1(unsigned int ct1)
 	{
 		if(ct1 == 2) return;
-		fprintf(mFile,"\tsetAttr \".ct1\" %i;\n", ct1);
+		writeInt(mFile,"\tsetAttr \".ct1\" ",ct1,";\n");
 	}
 	void setContinuityType2(unsigned int ct2)
 	{
 		if(ct2 == 2) return;
-		fprintf(mFile,"\tsetAttr \".ct2\" %i;\n", ct2);
+		writeInt(mFile,"\tsetAttr \".ct2\" ",ct2,";\n");
 	}
 	void setContinuityType3(unsigned int ct3)
 	{
 		if(ct3 == 2) return;
-		fprintf(mFile,"\tsetAttr \".ct3\" %i;\n", ct3);
+		writeInt(mFile,"\tsetAttr \".ct3\" ",ct3,";\n");
 	}
 	void setContinuityType4(unsigned int ct4)
 	{
 		if(ct4 == 2) return;
-		fprintf(mFile,"\tsetAttr \".ct4\" %i;\n", ct4);
+		writeInt(mFile,"\tsetAttr \".ct4\" ",ct4,";\n");
 	}
 	void setRebuildCurve1(bool rc1)
 	{
 		if(rc1 == false) return;
-		fprintf(mFile,"\tsetAttr \".rc1\" %i;\n", rc1);
+		writeInt(mFile,"\tsetAttr \".rc1\" ",rc1,";\n");
 	}
 	void setRebuildCurve2(bool rc2)
 	{
 		if(rc2 == false) return;
-		fprintf(mFile,"\tsetAttr \".rc2\" %i;\n", rc2);
+		writeInt(mFile,"\tsetAttr \".rc2\" ",rc2,";\n");
 	}
 	void setRebuildCurve3(bool rc3)
 	{
 		if(rc3 == false) return;
-		fprintf(mFile,"\tsetAttr \".rc3\" %i;\n", rc3);
+		writeInt(mFile,"\tsetAttr \".rc3\" ",rc3,";\n");
 	}
 	void setRebuildCurve4(bool rc4)
 	{
 		if(rc4 == false) return;
-		fprintf(mFile,"\tsetAttr \".rc4\" %i;\n", rc4);
+		writeInt(mFile,"\tsetAttr \".rc4\" ",rc4,";\n");
 	}
 	void getCurveFitCheckpoints()const
 	{
-		fprintf(mFile,"\"%s.cfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cfc\"");
 	}
 	void getContinuityType1()const
 	{
-		fprintf(mFile,"\"%s.ct1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct1\"");
 	}
 	void getContinuityType2()const
 	{
-		fprintf(mFile,"\"%s.ct2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct2\"");
 	}
 	void getContinuityType3()const
 	{
-		fprintf(mFile,"\"%s.ct3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct3\"");
 	}
 	void getContinuityType4()const
 	{
-		fprintf(mFile,"\"%s.ct4\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ct4\"");
 	}
 	void getRebuildCurve1()const
 	{
-		fprintf(mFile,"\"%s.rc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc1\"");
 	}
 	void getRebuildCurve2()const
 	{
-		fprintf(mFile,"\"%s.rc2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc2\"");
 	}
 	void getRebuildCurve3()const
 	{
-		fprintf(mFile,"\"%s.rc3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc3\"");
 	}
 	void getRebuildCurve4()const
 	{
-		fprintf(mFile,"\"%s.rc4\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc4\"");
 	}
 	void getContinuityPassed1()const
 	{
-		fprintf(mFile,"\"%s.cp1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp1\"");
 	}
 	void getContinuityPassed2()const
 	{
-		fprintf(mFile,"\"%s.cp2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp2\"");
 	}
 	void getContinuityPassed3()const
 	{
-		fprintf(mFile,"\"%s.cp3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp3\"");
 	}
 	void getContinuityPassed4()const
 	{
-		fprintf(mFile,"\"%s.cp4\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp4\"");
 	}
 protected:
 	SquareSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,150 +27,150 @@ public:
 	void setImage(const float3& im)
 	{
 		if(im == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".im\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".im\" -type \"float3\" ");
 		im.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageR(float imr)
 	{
 		if(imr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".im.imr\" %f;\n", imr);
+		writeFloat(mFile,"\tsetAttr \".im.imr\" ",imr,";\n");
 	}
 	void setImageG(float img)
 	{
 		if(img == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".im.img\" %f;\n", img);
+		writeFloat(mFile,"\tsetAttr \".im.img\" ",img,";\n");
 	}
 	void setImageB(float imb)
 	{
 		if(imb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".im.imb\" %f;\n", imb);
+		writeFloat(mFile,"\tsetAttr \".im.imb\" ",imb,";\n");
 	}
 	void setMask(float m)
 	{
 		if(m == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".m\" %f;\n", m);
+		writeFloat(mFile,"\tsetAttr \".m\" ",m,";\n");
 	}
 	void setEdgeBlend(float eb)
 	{
 		if(eb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".eb\" %f;\n", eb);
+		writeFloat(mFile,"\tsetAttr \".eb\" ",eb,";\n");
 	}
 	void setKeyMasking(bool km)
 	{
 		if(km == false) return;
-		fprintf(mFile,"\tsetAttr \".km\" %i;\n", km);
+		writeInt(mFile,"\tsetAttr \".km\" ",km,";\n");
 	}
 	void setPositiveKey(bool pk)
 	{
 		if(pk == false) return;
-		fprintf(mFile,"\tsetAttr \".pk\" %i;\n", pk);
+		writeInt(mFile,"\tsetAttr \".pk\" ",pk,";\n");
 	}
 	void setColorKey(const float3& ck)
 	{
 		if(ck == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ck\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ck\" -type \"float3\" ");
 		ck.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorKeyR(float ckr)
 	{
 		if(ckr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ck.ckr\" %f;\n", ckr);
+		writeFloat(mFile,"\tsetAttr \".ck.ckr\" ",ckr,";\n");
 	}
 	void setColorKeyG(float ckg)
 	{
 		if(ckg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ck.ckg\" %f;\n", ckg);
+		writeFloat(mFile,"\tsetAttr \".ck.ckg\" ",ckg,";\n");
 	}
 	void setColorKeyB(float ckb)
 	{
 		if(ckb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ck.ckb\" %f;\n", ckb);
+		writeFloat(mFile,"\tsetAttr \".ck.ckb\" ",ckb,";\n");
 	}
 	void setHueRange(float hr)
 	{
 		if(hr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".hr\" %f;\n", hr);
+		writeFloat(mFile,"\tsetAttr \".hr\" ",hr,";\n");
 	}
 	void setSaturationRange(float sr)
 	{
 		if(sr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setValueRange(float vr)
 	{
 		if(vr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".vr\" %f;\n", vr);
+		writeFloat(mFile,"\tsetAttr \".vr\" ",vr,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void getImage()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getImageR()const
 	{
-		fprintf(mFile,"\"%s.im.imr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im.imr\"");
 	}
 	void getImageG()const
 	{
-		fprintf(mFile,"\"%s.im.img\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im.img\"");
 	}
 	void getImageB()const
 	{
-		fprintf(mFile,"\"%s.im.imb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im.imb\"");
 	}
 	void getMask()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getEdgeBlend()const
 	{
-		fprintf(mFile,"\"%s.eb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".eb\"");
 	}
 	void getKeyMasking()const
 	{
-		fprintf(mFile,"\"%s.km\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".km\"");
 	}
 	void getPositiveKey()const
 	{
-		fprintf(mFile,"\"%s.pk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pk\"");
 	}
 	void getColorKey()const
 	{
-		fprintf(mFile,"\"%s.ck\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ck\"");
 	}
 	void getColorKeyR()const
 	{
-		fprintf(mFile,"\"%s.ck.ckr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ck.ckr\"");
 	}
 	void getColorKeyG()const
 	{
-		fprintf(mFile,"\"%s.ck.ckg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ck.ckg\"");
 	}
 	void getColorKeyB()const
 	{
-		fprintf(mFile,"\"%s.ck.ckb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ck.ckb\"");
 	}
 	void getHueRange()const
 	{
-		fprintf(mFile,"\"%s.hr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hr\"");
 	}
 	void getSaturationRange()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getValueRange()const
 	{
-		fprintf(mFile,"\"%s.vr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vr\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 protected:
 	Stencil(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,24 +27,24 @@ public:
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void getInputSurface(size_t is_i)const
 	{
-		fprintf(mFile,"\"%s.is[%i]\"",mName.c_str(),is_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".is[",is_i,"]\"");
 	}
 	void getInputSurface()const
 	{
 
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getOutputShell()const
 	{
-		fprintf(mFile,"\"%s.osh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".osh\"");
 	}
 protected:
 	StitchAsNurbsShell(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,518 +27,518 @@ public:
 	void setPositionalContinuity(size_t pc_i,bool pc)
 	{
 		if(pc == true) return;
-		fprintf(mFile,"\tsetAttr \".pc[%i]\" %i;\n", pc_i,pc);
+		writeInt(mFile,"\tsetAttr \".pc[",pc_i); writeInt(mFile,"]\" ",pc,";\n");
 	}
 	void setPositionalContinuity(size_t pc_start,size_t pc_end,bool* pc)
 	{
-		fprintf(mFile,"\tsetAttr \".pc[%i:%i]\" ", pc_start,pc_end);
+		writeInt(mFile,"\tsetAttr \".pc[",pc_start); writeInt(mFile,":",pc_end,"]\" ");
 		size_t size = (pc_end-pc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",pc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",pc[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPositionalContinuity(size_t pc_start,size_t pc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pc[%i:%i]\"",pc_start,pc_end);
+		writeInt(mFile,"\tsetAttr \".pc[",pc_start); writeInt(mFile,":",pc_end,"]\"");
 	}
 	void appendPositionalContinuity(bool pc)const
 	{
-		fprintf(mFile," %i",pc);
+		writeInt(mFile," ",pc);
 	}
 	void endPositionalContinuity()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTangentialContinuity(size_t tc_i,bool tc)
 	{
 		if(tc == false) return;
-		fprintf(mFile,"\tsetAttr \".tc[%i]\" %i;\n", tc_i,tc);
+		writeInt(mFile,"\tsetAttr \".tc[",tc_i); writeInt(mFile,"]\" ",tc,";\n");
 	}
 	void setTangentialContinuity(size_t tc_start,size_t tc_end,bool* tc)
 	{
-		fprintf(mFile,"\tsetAttr \".tc[%i:%i]\" ", tc_start,tc_end);
+		writeInt(mFile,"\tsetAttr \".tc[",tc_start); writeInt(mFile,":",tc_end,"]\" ");
 		size_t size = (tc_end-tc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",tc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",tc[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTangentialContinuity(size_t tc_start,size_t tc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tc[%i:%i]\"",tc_start,tc_end);
+		writeInt(mFile,"\tsetAttr \".tc[",tc_start); writeInt(mFile,":",tc_end,"]\"");
 	}
 	void appendTangentialContinuity(bool tc)const
 	{
-		fprintf(mFile," %i",tc);
+		writeInt(mFile," ",tc);
 	}
 	void endTangentialContinuity()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setToggleTolerance(size_t tt_i,bool tt)
 	{
 		if(tt == false) return;
-		fprintf(mFile,"\tsetAttr \".tt[%i]\" %i;\n", tt_i,tt);
+		writeInt(mFile,"\tsetAttr \".tt[",tt_i); writeInt(mFile,"]\" ",tt,";\n");
 	}
 	void setToggleTolerance(size_t tt_start,size_t tt_end,bool* tt)
 	{
-		fprintf(mFile,"\tsetAttr \".tt[%i:%i]\" ", tt_start,tt_end);
+		writeInt(mFile,"\tsetAttr \".tt[",tt_start); writeInt(mFile,":",tt_end,"]\" ");
 		size_t size = (tt_end-tt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",tt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",tt[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startToggleTolerance(size_t tt_start,size_t tt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tt[%i:%i]\"",tt_start,tt_end);
+		writeInt(mFile,"\tsetAttr \".tt[",tt_start); writeInt(mFile,":",tt_end,"]\"");
 	}
 	void appendToggleTolerance(bool tt)const
 	{
-		fprintf(mFile," %i",tt);
+		writeInt(mFile," ",tt);
 	}
 	void endToggleTolerance()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTolerance(size_t tol_i,double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol[%i]\" %f;\n", tol_i,tol);
+		writeInt(mFile,"\tsetAttr \".tol[",tol_i); writeFloat(mFile,"]\" ",tol,";\n");
 	}
 	void setTolerance(size_t tol_start,size_t tol_end,double* tol)
 	{
-		fprintf(mFile,"\tsetAttr \".tol[%i:%i]\" ", tol_start,tol_end);
+		writeInt(mFile,"\tsetAttr \".tol[",tol_start); writeInt(mFile,":",tol_end,"]\" ");
 		size_t size = (tol_end-tol_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tol[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",tol[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTolerance(size_t tol_start,size_t tol_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tol[%i:%i]\"",tol_start,tol_end);
+		writeInt(mFile,"\tsetAttr \".tol[",tol_start); writeInt(mFile,":",tol_end,"]\"");
 	}
 	void appendTolerance(double tol)const
 	{
-		fprintf(mFile," %f",tol);
+		writeFloat(mFile," ",tol);
 	}
 	void endTolerance()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setStepCount(size_t sc_i,int sc)
 	{
 		if(sc == 20) return;
-		fprintf(mFile,"\tsetAttr \".sc[%i]\" %i;\n", sc_i,sc);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_i); writeInt(mFile,"]\" ",sc,";\n");
 	}
 	void setStepCount(size_t sc_start,size_t sc_end,int* sc)
 	{
-		fprintf(mFile,"\tsetAttr \".sc[%i:%i]\" ", sc_start,sc_end);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_start); writeInt(mFile,":",sc_end,"]\" ");
 		size_t size = (sc_end-sc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",sc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",sc[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startStepCount(size_t sc_start,size_t sc_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sc[%i:%i]\"",sc_start,sc_end);
+		writeInt(mFile,"\tsetAttr \".sc[",sc_start); writeInt(mFile,":",sc_end,"]\"");
 	}
 	void appendStepCount(int sc)const
 	{
-		fprintf(mFile," %i",sc);
+		writeInt(mFile," ",sc);
 	}
 	void endStepCount()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParameterU(size_t u_i,double u)
 	{
 		if(u == -10000) return;
-		fprintf(mFile,"\tsetAttr \".u[%i]\" %f;\n", u_i,u);
+		writeInt(mFile,"\tsetAttr \".u[",u_i); writeFloat(mFile,"]\" ",u,";\n");
 	}
 	void setParameterU(size_t u_start,size_t u_end,double* u)
 	{
-		fprintf(mFile,"\tsetAttr \".u[%i:%i]\" ", u_start,u_end);
+		writeInt(mFile,"\tsetAttr \".u[",u_start); writeInt(mFile,":",u_end,"]\" ");
 		size_t size = (u_end-u_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",u[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",u[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startParameterU(size_t u_start,size_t u_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".u[%i:%i]\"",u_start,u_end);
+		writeInt(mFile,"\tsetAttr \".u[",u_start); writeInt(mFile,":",u_end,"]\"");
 	}
 	void appendParameterU(double u)const
 	{
-		fprintf(mFile," %f",u);
+		writeFloat(mFile," ",u);
 	}
 	void endParameterU()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setParameterV(size_t v_i,double v)
 	{
 		if(v == -10000) return;
-		fprintf(mFile,"\tsetAttr \".v[%i]\" %f;\n", v_i,v);
+		writeInt(mFile,"\tsetAttr \".v[",v_i); writeFloat(mFile,"]\" ",v,";\n");
 	}
 	void setParameterV(size_t v_start,size_t v_end,double* v)
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
+		writeInt(mFile,"\tsetAttr \".v[",v_start); writeInt(mFile,":",v_end,"]\" ");
 		size_t size = (v_end-v_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",v[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startParameterV(size_t v_start,size_t v_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".v[%i:%i]\"",v_start,v_end);
+		writeInt(mFile,"\tsetAttr \".v[",v_start); writeInt(mFile,":",v_end,"]\"");
 	}
 	void appendParameterV(double v)const
 	{
-		fprintf(mFile," %f",v);
+		writeFloat(mFile," ",v);
 	}
 	void endParameterV()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTogglePointNormals(bool tpn)
 	{
 		if(tpn == false) return;
-		fprintf(mFile,"\tsetAttr \".tpn\" %i;\n", tpn);
+		writeInt(mFile,"\tsetAttr \".tpn\" ",tpn,";\n");
 	}
 	void setTogglePointPosition(bool tpp)
 	{
 		if(tpp == true) return;
-		fprintf(mFile,"\tsetAttr \".tpp\" %i;\n", tpp);
+		writeInt(mFile,"\tsetAttr \".tpp\" ",tpp,";\n");
 	}
 	void setCvIthIndex(size_t ci_i,int ci)
 	{
 		if(ci == -1) return;
-		fprintf(mFile,"\tsetAttr \".ci[%i]\" %i;\n", ci_i,ci);
+		writeInt(mFile,"\tsetAttr \".ci[",ci_i); writeInt(mFile,"]\" ",ci,";\n");
 	}
 	void setCvIthIndex(size_t ci_start,size_t ci_end,int* ci)
 	{
-		fprintf(mFile,"\tsetAttr \".ci[%i:%i]\" ", ci_start,ci_end);
+		writeInt(mFile,"\tsetAttr \".ci[",ci_start); writeInt(mFile,":",ci_end,"]\" ");
 		size_t size = (ci_end-ci_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ci[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ci[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCvIthIndex(size_t ci_start,size_t ci_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ci[%i:%i]\"",ci_start,ci_end);
+		writeInt(mFile,"\tsetAttr \".ci[",ci_start); writeInt(mFile,":",ci_end,"]\"");
 	}
 	void appendCvIthIndex(int ci)const
 	{
-		fprintf(mFile," %i",ci);
+		writeInt(mFile," ",ci);
 	}
 	void endCvIthIndex()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCvJthIndex(size_t cj_i,int cj)
 	{
 		if(cj == -1) return;
-		fprintf(mFile,"\tsetAttr \".cj[%i]\" %i;\n", cj_i,cj);
+		writeInt(mFile,"\tsetAttr \".cj[",cj_i); writeInt(mFile,"]\" ",cj,";\n");
 	}
 	void setCvJthIndex(size_t cj_start,size_t cj_end,int* cj)
 	{
-		fprintf(mFile,"\tsetAttr \".cj[%i:%i]\" ", cj_start,cj_end);
+		writeInt(mFile,"\tsetAttr \".cj[",cj_start); writeInt(mFile,":",cj_end,"]\" ");
 		size_t size = (cj_end-cj_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",cj[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",cj[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCvJthIndex(size_t cj_start,size_t cj_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cj[%i:%i]\"",cj_start,cj_end);
+		writeInt(mFile,"\tsetAttr \".cj[",cj_start); writeInt(mFile,":",cj_end,"]\"");
 	}
 	void appendCvJthIndex(int cj)const
 	{
-		fprintf(mFile," %i",cj);
+		writeInt(mFile," ",cj);
 	}
 	void endCvJthIndex()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBias(double b)
 	{
 		if(b == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setFixBoundary(bool fb)
 	{
 		if(fb == false) return;
-		fprintf(mFile,"\tsetAttr \".fb\" %i;\n", fb);
+		writeInt(mFile,"\tsetAttr \".fb\" ",fb,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInputCurve(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i]\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"]\"");
 	}
 	void getInputCurve()const
 	{
 
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getInputMatchCurve(size_t imc_i)const
 	{
-		fprintf(mFile,"\"%s.imc[%i]\"",mName.c_str(),imc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".imc[",imc_i,"]\"");
 	}
 	void getInputMatchCurve()const
 	{
 
-		fprintf(mFile,"\"%s.imc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc\"");
 	}
 	void getInputReferenceCOS(size_t ir_i)const
 	{
-		fprintf(mFile,"\"%s.ir[%i]\"",mName.c_str(),ir_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ir[",ir_i,"]\"");
 	}
 	void getInputReferenceCOS()const
 	{
 
-		fprintf(mFile,"\"%s.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir\"");
 	}
 	void getPositionalContinuity(size_t pc_i)const
 	{
-		fprintf(mFile,"\"%s.pc[%i]\"",mName.c_str(),pc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pc[",pc_i,"]\"");
 	}
 	void getPositionalContinuity()const
 	{
 
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getTangentialContinuity(size_t tc_i)const
 	{
-		fprintf(mFile,"\"%s.tc[%i]\"",mName.c_str(),tc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tc[",tc_i,"]\"");
 	}
 	void getTangentialContinuity()const
 	{
 
-		fprintf(mFile,"\"%s.tc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tc\"");
 	}
 	void getToggleTolerance(size_t tt_i)const
 	{
-		fprintf(mFile,"\"%s.tt[%i]\"",mName.c_str(),tt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tt[",tt_i,"]\"");
 	}
 	void getToggleTolerance()const
 	{
 
-		fprintf(mFile,"\"%s.tt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tt\"");
 	}
 	void getTolerance(size_t tol_i)const
 	{
-		fprintf(mFile,"\"%s.tol[%i]\"",mName.c_str(),tol_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tol[",tol_i,"]\"");
 	}
 	void getTolerance()const
 	{
 
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getStepCount(size_t sc_i)const
 	{
-		fprintf(mFile,"\"%s.sc[%i]\"",mName.c_str(),sc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sc[",sc_i,"]\"");
 	}
 	void getStepCount()const
 	{
 
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getParameterU(size_t u_i)const
 	{
-		fprintf(mFile,"\"%s.u[%i]\"",mName.c_str(),u_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".u[",u_i,"]\"");
 	}
 	void getParameterU()const
 	{
 
-		fprintf(mFile,"\"%s.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".u\"");
 	}
 	void getParameterV(size_t v_i)const
 	{
-		fprintf(mFile,"\"%s.v[%i]\"",mName.c_str(),v_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".v[",v_i,"]\"");
 	}
 	void getParameterV()const
 	{
 
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getPosition(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i]\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"]\"");
 	}
 	void getPosition()const
 	{
 
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPositionX(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].px\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].px\"");
 	}
 	void getPositionX()const
 	{
 
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPositionY(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].py\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].py\"");
 	}
 	void getPositionY()const
 	{
 
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPositionZ(size_t p_i)const
 	{
-		fprintf(mFile,"\"%s.p[%i].pz\"",mName.c_str(),p_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".p[",p_i,"].pz\"");
 	}
 	void getPositionZ()const
 	{
 
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getNormal(size_t n_i)const
 	{
-		fprintf(mFile,"\"%s.n[%i]\"",mName.c_str(),n_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".n[",n_i,"]\"");
 	}
 	void getNormal()const
 	{
 
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalX(size_t n_i)const
 	{
-		fprintf(mFile,"\"%s.n[%i].nx\"",mName.c_str(),n_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".n[",n_i,"].nx\"");
 	}
 	void getNormalX()const
 	{
 
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalY(size_t n_i)const
 	{
-		fprintf(mFile,"\"%s.n[%i].ny\"",mName.c_str(),n_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".n[",n_i,"].ny\"");
 	}
 	void getNormalY()const
 	{
 
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalZ(size_t n_i)const
 	{
-		fprintf(mFile,"\"%s.n[%i].nz\"",mName.c_str(),n_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".n[",n_i,"].nz\"");
 	}
 	void getNormalZ()const
 	{
 
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getTogglePointNormals()const
 	{
-		fprintf(mFile,"\"%s.tpn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tpn\"");
 	}
 	void getTogglePointPosition()const
 	{
-		fprintf(mFile,"\"%s.tpp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tpp\"");
 	}
 	void getCvIthIndex(size_t ci_i)const
 	{
-		fprintf(mFile,"\"%s.ci[%i]\"",mName.c_str(),ci_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ci[",ci_i,"]\"");
 	}
 	void getCvIthIndex()const
 	{
 
-		fprintf(mFile,"\"%s.ci\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ci\"");
 	}
 	void getCvJthIndex(size_t cj_i)const
 	{
-		fprintf(mFile,"\"%s.cj[%i]\"",mName.c_str(),cj_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cj[",cj_i,"]\"");
 	}
 	void getCvJthIndex()const
 	{
 
-		fprintf(mFile,"\"%s.cj\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cj\"");
 	}
 	void getCvPosition(size_t cv_i)const
 	{
-		fprintf(mFile,"\"%s.cv[%i]\"",mName.c_str(),cv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cv[",cv_i,"]\"");
 	}
 	void getCvPosition()const
 	{
 
-		fprintf(mFile,"\"%s.cv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv\"");
 	}
 	void getCvpositionX(size_t cv_i)const
 	{
-		fprintf(mFile,"\"%s.cv[%i].cvx\"",mName.c_str(),cv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cv[",cv_i,"].cvx\"");
 	}
 	void getCvpositionX()const
 	{
 
-		fprintf(mFile,"\"%s.cv.cvx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv.cvx\"");
 	}
 	void getCvpositionY(size_t cv_i)const
 	{
-		fprintf(mFile,"\"%s.cv[%i].cvy\"",mName.c_str(),cv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cv[",cv_i,"].cvy\"");
 	}
 	void getCvpositionY()const
 	{
 
-		fprintf(mFile,"\"%s.cv.cvy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv.cvy\"");
 	}
 	void getCvpositionZ(size_t cv_i)const
 	{
-		fprintf(mFile,"\"%s.cv[%i].cvz\"",mName.c_str(),cv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cv[",cv_i,"].cvz\"");
 	}
 	void getCvpositionZ()const
 	{
 
-		fprintf(mFile,"\"%s.cv.cvz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cv.cvz\"");
 	}
 	void getBias()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getFixBoundary()const
 	{
-		fprintf(mFile,"\"%s.fb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fb\"");
 	}
 	void getShouldBeLast()const
 	{
-		fprintf(mFile,"\"%s.sbl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sbl\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	StitchSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,129 +27,129 @@ public:
 	void setSceneScale(double pss)
 	{
 		if(pss == 5.0) return;
-		fprintf(mFile,"\tsetAttr \".pss\" %f;\n", pss);
+		writeFloat(mFile,"\tsetAttr \".pss\" ",pss,";\n");
 	}
 	void setCanvasScale(double pcs)
 	{
 		if(pcs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".pcs\" %f;\n", pcs);
+		writeFloat(mFile,"\tsetAttr \".pcs\" ",pcs,";\n");
 	}
 	void setWrapH(bool wrh)
 	{
 		if(wrh == false) return;
-		fprintf(mFile,"\tsetAttr \".wrh\" %i;\n", wrh);
+		writeInt(mFile,"\tsetAttr \".wrh\" ",wrh,";\n");
 	}
 	void setWrapV(bool wrv)
 	{
 		if(wrv == false) return;
-		fprintf(mFile,"\tsetAttr \".wrv\" %i;\n", wrv);
+		writeInt(mFile,"\tsetAttr \".wrv\" ",wrv,";\n");
 	}
 	void setSceneWrapH(bool swh)
 	{
 		if(swh == false) return;
-		fprintf(mFile,"\tsetAttr \".swh\" %i;\n", swh);
+		writeInt(mFile,"\tsetAttr \".swh\" ",swh,";\n");
 	}
 	void setSceneWrapV(bool swv)
 	{
 		if(swv == false) return;
-		fprintf(mFile,"\tsetAttr \".swv\" %i;\n", swv);
+		writeInt(mFile,"\tsetAttr \".swv\" ",swv,";\n");
 	}
 	void setForceRealLights(bool frl)
 	{
 		if(frl == true) return;
-		fprintf(mFile,"\tsetAttr \".frl\" %i;\n", frl);
+		writeInt(mFile,"\tsetAttr \".frl\" ",frl,";\n");
 	}
 	void setForceDepth(bool fdp)
 	{
 		if(fdp == true) return;
-		fprintf(mFile,"\tsetAttr \".fdp\" %i;\n", fdp);
+		writeInt(mFile,"\tsetAttr \".fdp\" ",fdp,";\n");
 	}
 	void setUseCanvasLight(bool ucl)
 	{
 		if(ucl == true) return;
-		fprintf(mFile,"\tsetAttr \".ucl\" %i;\n", ucl);
+		writeInt(mFile,"\tsetAttr \".ucl\" ",ucl,";\n");
 	}
 	void setForceTubeDirAlongPath(bool ftd)
 	{
 		if(ftd == true) return;
-		fprintf(mFile,"\tsetAttr \".ftd\" %i;\n", ftd);
+		writeInt(mFile,"\tsetAttr \".ftd\" ",ftd,";\n");
 	}
 	void setLightDirection(const double3& ldr)
 	{
-		fprintf(mFile,"\tsetAttr \".ldr\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ldr\" -type \"double3\" ");
 		ldr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLightDirectionX(double ldx)
 	{
 		if(ldx == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".ldr.ldx\" %f;\n", ldx);
+		writeFloat(mFile,"\tsetAttr \".ldr.ldx\" ",ldx,";\n");
 	}
 	void setLightDirectionY(double ldy)
 	{
 		if(ldy == -.9) return;
-		fprintf(mFile,"\tsetAttr \".ldr.ldy\" %f;\n", ldy);
+		writeFloat(mFile,"\tsetAttr \".ldr.ldy\" ",ldy,";\n");
 	}
 	void setLightDirectionZ(double ldz)
 	{
 		if(ldz == -0.5) return;
-		fprintf(mFile,"\tsetAttr \".ldr.ldz\" %f;\n", ldz);
+		writeFloat(mFile,"\tsetAttr \".ldr.ldz\" ",ldz,";\n");
 	}
 	void getSceneScale()const
 	{
-		fprintf(mFile,"\"%s.pss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pss\"");
 	}
 	void getCanvasScale()const
 	{
-		fprintf(mFile,"\"%s.pcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pcs\"");
 	}
 	void getWrapH()const
 	{
-		fprintf(mFile,"\"%s.wrh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wrh\"");
 	}
 	void getWrapV()const
 	{
-		fprintf(mFile,"\"%s.wrv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wrv\"");
 	}
 	void getSceneWrapH()const
 	{
-		fprintf(mFile,"\"%s.swh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".swh\"");
 	}
 	void getSceneWrapV()const
 	{
-		fprintf(mFile,"\"%s.swv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".swv\"");
 	}
 	void getForceRealLights()const
 	{
-		fprintf(mFile,"\"%s.frl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frl\"");
 	}
 	void getForceDepth()const
 	{
-		fprintf(mFile,"\"%s.fdp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fdp\"");
 	}
 	void getUseCanvasLight()const
 	{
-		fprintf(mFile,"\"%s.ucl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ucl\"");
 	}
 	void getForceTubeDirAlongPath()const
 	{
-		fprintf(mFile,"\"%s.ftd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ftd\"");
 	}
 	void getLightDirection()const
 	{
-		fprintf(mFile,"\"%s.ldr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldr\"");
 	}
 	void getLightDirectionX()const
 	{
-		fprintf(mFile,"\"%s.ldr.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldr.ldx\"");
 	}
 	void getLightDirectionY()const
 	{
-		fprintf(mFile,"\"%s.ldr.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldr.ldy\"");
 	}
 	void getLightDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.ldr.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ldr.ldz\"");
 	}
 protected:
 	StrokeGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
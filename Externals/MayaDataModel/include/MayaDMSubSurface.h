@@ -27,46 +27,46 @@ public:
 	void setFirstFaceU(int ffu)
 	{
 		if(ffu == 0) return;
-		fprintf(mFile,"\tsetAttr \".ffu\" %i;\n", ffu);
+		writeInt(mFile,"\tsetAttr \".ffu\" ",ffu,";\n");
 	}
 	void setFirstFaceV(int ffv)
 	{
 		if(ffv == 0) return;
-		fprintf(mFile,"\tsetAttr \".ffv\" %i;\n", ffv);
+		writeInt(mFile,"\tsetAttr \".ffv\" ",ffv,";\n");
 	}
 	void setFaceCountU(int fcu)
 	{
 		if(fcu == 1) return;
-		fprintf(mFile,"\tsetAttr \".fcu\" %i;\n", fcu);
+		writeInt(mFile,"\tsetAttr \".fcu\" ",fcu,";\n");
 	}
 	void setFaceCountV(int fcv)
 	{
 		if(fcv == 1) return;
-		fprintf(mFile,"\tsetAttr \".fcv\" %i;\n", fcv);
+		writeInt(mFile,"\tsetAttr \".fcv\" ",fcv,";\n");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getFirstFaceU()const
 	{
-		fprintf(mFile,"\"%s.ffu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ffu\"");
 	}
 	void getFirstFaceV()const
 	{
-		fprintf(mFile,"\"%s.ffv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ffv\"");
 	}
 	void getFaceCountU()const
 	{
-		fprintf(mFile,"\"%s.fcu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcu\"");
 	}
 	void getFaceCountV()const
 	{
-		fprintf(mFile,"\"%s.fcv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fcv\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	SubSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,74 +27,74 @@ public:
 	void setPlanes(int p)
 	{
 		if(p == 6) return;
-		fprintf(mFile,"\tsetAttr \".p\" %i;\n", p);
+		writeInt(mFile,"\tsetAttr \".p\" ",p,";\n");
 	}
 	void setOptimize(unsigned int o)
 	{
 		if(o == 1) return;
-		fprintf(mFile,"\tsetAttr \".o\" %i;\n", o);
+		writeInt(mFile,"\tsetAttr \".o\" ",o,";\n");
 	}
 	void setSkipIntersect(bool si)
 	{
 		if(si == false) return;
-		fprintf(mFile,"\tsetAttr \".si\" %i;\n", si);
+		writeInt(mFile,"\tsetAttr \".si\" ",si,";\n");
 	}
 	void setLayout(unsigned int l)
 	{
 		if(l == 1) return;
-		fprintf(mFile,"\tsetAttr \".l\" %i;\n", l);
+		writeInt(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void setLayoutMethod(unsigned int lm)
 	{
 		if(lm == 0) return;
-		fprintf(mFile,"\tsetAttr \".lm\" %i;\n", lm);
+		writeInt(mFile,"\tsetAttr \".lm\" ",lm,";\n");
 	}
 	void setPercentageSpace(float ps)
 	{
 		if(ps == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps\" %f;\n", ps);
+		writeFloat(mFile,"\tsetAttr \".ps\" ",ps,";\n");
 	}
 	void setScale(unsigned int sc)
 	{
 		if(sc == 1) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setDenseLayout(bool dl)
 	{
 		if(dl == false) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %i;\n", dl);
+		writeInt(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void getPlanes()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getOptimize()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getSkipIntersect()const
 	{
-		fprintf(mFile,"\"%s.si\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".si\"");
 	}
 	void getLayout()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getLayoutMethod()const
 	{
-		fprintf(mFile,"\"%s.lm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lm\"");
 	}
 	void getPercentageSpace()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getDenseLayout()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 protected:
 	SubdAutoProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
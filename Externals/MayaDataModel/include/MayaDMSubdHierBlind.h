@@ -27,7 +27,7 @@ public:
 	void setWhichOneIndex(int woi)
 	{
 		if(woi == -1) return;
-		fprintf(mFile,"\tsetAttr \".woi\" %i;\n", woi);
+		writeInt(mFile,"\tsetAttr \".woi\" ",woi,";\n");
 	}
 protected:
 	SubdHierBlind(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,74 +27,74 @@ public:
 	void setSeparate(unsigned int se)
 	{
 		if(se == 0) return;
-		fprintf(mFile,"\tsetAttr \".se\" %i;\n", se);
+		writeInt(mFile,"\tsetAttr \".se\" ",se,";\n");
 	}
 	void setFlipReversed(bool fr)
 	{
 		if(fr == true) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %i;\n", fr);
+		writeInt(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setLayout(unsigned int l)
 	{
 		if(l == 2) return;
-		fprintf(mFile,"\tsetAttr \".l\" %i;\n", l);
+		writeInt(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void setPercentageSpace(float ps)
 	{
 		if(ps == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps\" %f;\n", ps);
+		writeFloat(mFile,"\tsetAttr \".ps\" ",ps,";\n");
 	}
 	void setScale(unsigned int sc)
 	{
 		if(sc == 1) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setDenseLayout(bool dl)
 	{
 		if(dl == false) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %i;\n", dl);
+		writeInt(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setRotateForBestFit(unsigned int rbf)
 	{
 		if(rbf == 0) return;
-		fprintf(mFile,"\tsetAttr \".rbf\" %i;\n", rbf);
+		writeInt(mFile,"\tsetAttr \".rbf\" ",rbf,";\n");
 	}
 	void setLayoutMethod(unsigned int lm)
 	{
 		if(lm == 0) return;
-		fprintf(mFile,"\tsetAttr \".lm\" %i;\n", lm);
+		writeInt(mFile,"\tsetAttr \".lm\" ",lm,";\n");
 	}
 	void getSeparate()const
 	{
-		fprintf(mFile,"\"%s.se\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".se\"");
 	}
 	void getFlipReversed()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getLayout()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getPercentageSpace()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getDenseLayout()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getRotateForBestFit()const
 	{
-		fprintf(mFile,"\"%s.rbf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rbf\"");
 	}
 	void getLayoutMethod()const
 	{
-		fprintf(mFile,"\"%s.lm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lm\"");
 	}
 protected:
 	SubdLayoutUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
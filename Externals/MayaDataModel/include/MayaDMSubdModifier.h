@@ -26,21 +26,21 @@ public:
 
 	void setInputComponents(const componentList& ics)
 	{
-		fprintf(mFile,"\tsetAttr \".ics\" -type \"componentList\" ");
+		writeString(mFile,"\tsetAttr \".ics\" -type \"componentList\" ");
 		ics.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getInSubdiv()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getCachedSubdiv()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getInputComponents()const
 	{
-		fprintf(mFile,"\"%s.ics\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ics\"");
 	}
 protected:
 	SubdModifier(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
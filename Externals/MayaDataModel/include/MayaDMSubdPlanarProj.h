@@ -27,187 +27,187 @@ public:
 	void setProjectionCenter(const double3& pc)
 	{
 		if(pc == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".pc\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".pc\" -type \"double3\" ");
 		pc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProjectionCenterX(double pcx)
 	{
 		if(pcx == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcx\" %f;\n", pcx);
+		writeFloat(mFile,"\tsetAttr \".pc.pcx\" ",pcx,";\n");
 	}
 	void setProjectionCenterY(double pcy)
 	{
 		if(pcy == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcy\" %f;\n", pcy);
+		writeFloat(mFile,"\tsetAttr \".pc.pcy\" ",pcy,";\n");
 	}
 	void setProjectionCenterZ(double pcz)
 	{
 		if(pcz == 0) return;
-		fprintf(mFile,"\tsetAttr \".pc.pcz\" %f;\n", pcz);
+		writeFloat(mFile,"\tsetAttr \".pc.pcz\" ",pcz,";\n");
 	}
 	void setImageCenter(const double2& ic2)
 	{
 		if(ic2 == double2(0.5, 0.5)) return;
-		fprintf(mFile,"\tsetAttr \".ic2\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".ic2\" -type \"double2\" ");
 		ic2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageCenterX(double icx)
 	{
 		if(icx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic2.icx\" %f;\n", icx);
+		writeFloat(mFile,"\tsetAttr \".ic2.icx\" ",icx,";\n");
 	}
 	void setImageCenterY(double icy)
 	{
 		if(icy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic2.icy\" %f;\n", icy);
+		writeFloat(mFile,"\tsetAttr \".ic2.icy\" ",icy,";\n");
 	}
 	void setRotate(const double3& ro)
 	{
 		if(ro == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ro\" -type \"double3\" ");
 		ro.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateX(double rx)
 	{
 		if(rx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".ro.rx\" ",rx,";\n");
 	}
 	void setRotateY(double ry)
 	{
 		if(ry == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".ro.ry\" ",ry,";\n");
 	}
 	void setRotateZ(double rz)
 	{
 		if(rz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".ro.rz\" ",rz,";\n");
 	}
 	void setProjectionScale(const double2& ps)
 	{
 		if(ps == double2(1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".ps\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".ps\" -type \"double2\" ");
 		ps.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setProjectionWidth(double pw)
 	{
 		if(pw == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps.pw\" %f;\n", pw);
+		writeFloat(mFile,"\tsetAttr \".ps.pw\" ",pw,";\n");
 	}
 	void setProjectionHeight(double ph)
 	{
 		if(ph == 0) return;
-		fprintf(mFile,"\tsetAttr \".ps.ph\" %f;\n", ph);
+		writeFloat(mFile,"\tsetAttr \".ps.ph\" ",ph,";\n");
 	}
 	void setImageScale(const double2& is2)
 	{
 		if(is2 == double2(1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".is2\" -type \"double2\" ");
+		writeString(mFile,"\tsetAttr \".is2\" -type \"double2\" ");
 		is2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImageScaleU(double isu)
 	{
 		if(isu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".is2.isu\" %f;\n", isu);
+		writeFloat(mFile,"\tsetAttr \".is2.isu\" ",isu,";\n");
 	}
 	void setImageScaleV(double isv)
 	{
 		if(isv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".is2.isv\" %f;\n", isv);
+		writeFloat(mFile,"\tsetAttr \".is2.isv\" ",isv,";\n");
 	}
 	void setRotationAngle(double ra)
 	{
 		if(ra == 0) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setRadius(double r)
 	{
 		if(r == 1) return;
-		fprintf(mFile,"\tsetAttr \".r\" %f;\n", r);
+		writeFloat(mFile,"\tsetAttr \".r\" ",r,";\n");
 	}
 	void getProjectionCenter()const
 	{
-		fprintf(mFile,"\"%s.pc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc\"");
 	}
 	void getProjectionCenterX()const
 	{
-		fprintf(mFile,"\"%s.pc.pcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcx\"");
 	}
 	void getProjectionCenterY()const
 	{
-		fprintf(mFile,"\"%s.pc.pcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcy\"");
 	}
 	void getProjectionCenterZ()const
 	{
-		fprintf(mFile,"\"%s.pc.pcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pc.pcz\"");
 	}
 	void getImageCenter()const
 	{
-		fprintf(mFile,"\"%s.ic2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2\"");
 	}
 	void getImageCenterX()const
 	{
-		fprintf(mFile,"\"%s.ic2.icx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2.icx\"");
 	}
 	void getImageCenterY()const
 	{
-		fprintf(mFile,"\"%s.ic2.icy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic2.icy\"");
 	}
 	void getRotate()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getRotateX()const
 	{
-		fprintf(mFile,"\"%s.ro.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rx\"");
 	}
 	void getRotateY()const
 	{
-		fprintf(mFile,"\"%s.ro.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.ry\"");
 	}
 	void getRotateZ()const
 	{
-		fprintf(mFile,"\"%s.ro.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro.rz\"");
 	}
 	void getProjectionScale()const
 	{
-		fprintf(mFile,"\"%s.ps\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps\"");
 	}
 	void getProjectionWidth()const
 	{
-		fprintf(mFile,"\"%s.ps.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps.pw\"");
 	}
 	void getProjectionHeight()const
 	{
-		fprintf(mFile,"\"%s.ps.ph\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ps.ph\"");
 	}
 	void getImageScale()const
 	{
-		fprintf(mFile,"\"%s.is2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is2\"");
 	}
 	void getImageScaleU()const
 	{
-		fprintf(mFile,"\"%s.is2.isu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is2.isu\"");
 	}
 	void getImageScaleV()const
 	{
-		fprintf(mFile,"\"%s.is2.isv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is2.isv\"");
 	}
 	void getRotationAngle()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getRadius()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getCompId()const
 	{
-		fprintf(mFile,"\"%s.cid\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cid\"");
 	}
 protected:
 	SubdPlanarProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
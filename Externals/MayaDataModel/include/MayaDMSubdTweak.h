@@ -27,87 +27,87 @@ public:
 	void setTweak(size_t tk_i,const double3& tk)
 	{
 		if(tk == double3(0.0, 0.0, 0.0)) return;
-		fprintf(mFile,"\tsetAttr \".tk[%i]\" -type \"double3\" ",tk_i);
+		writeInt(mFile,"\tsetAttr \".tk[",tk_i,"]\" -type \"double3\" ");
 		tk.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTweak(size_t tk_start,size_t tk_end,double* tk)
 	{
-		fprintf(mFile,"\tsetAttr \".tk[%i:%i]\" ", tk_start,tk_end);
+		writeInt(mFile,"\tsetAttr \".tk[",tk_start); writeInt(mFile,":",tk_end,"]\" ");
 		size_t size = (tk_end-tk_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",tk[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startTweak(size_t tk_start,size_t tk_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".tk[%i:%i]\"",tk_start,tk_end);
+		writeInt(mFile,"\tsetAttr \".tk[",tk_start); writeInt(mFile,":",tk_end,"]\"");
 	}
 	void appendTweak(double tk)const
 	{
-		fprintf(mFile," %f",tk);
+		writeFloat(mFile," ",tk);
 	}
 	void endTweak()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTweakX(size_t tk_i,double tx)
 	{
 		if(tx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tk[%i].tx\" %f;\n", tk_i,tx);
+		writeInt(mFile,"\tsetAttr \".tk[",tk_i); writeFloat(mFile,"].tx\" ",tx,";\n");
 	}
 	void setTweakY(size_t tk_i,double ty)
 	{
 		if(ty == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tk[%i].ty\" %f;\n", tk_i,ty);
+		writeInt(mFile,"\tsetAttr \".tk[",tk_i); writeFloat(mFile,"].ty\" ",ty,";\n");
 	}
 	void setTweakZ(size_t tk_i,double tz)
 	{
 		if(tz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".tk[%i].tz\" %f;\n", tk_i,tz);
+		writeInt(mFile,"\tsetAttr \".tk[",tk_i); writeFloat(mFile,"].tz\" ",tz,";\n");
 	}
 	void getTweak(size_t tk_i)const
 	{
-		fprintf(mFile,"\"%s.tk[%i]\"",mName.c_str(),tk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tk[",tk_i,"]\"");
 	}
 	void getTweak()const
 	{
 
-		fprintf(mFile,"\"%s.tk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tk\"");
 	}
 	void getTweakX(size_t tk_i)const
 	{
-		fprintf(mFile,"\"%s.tk[%i].tx\"",mName.c_str(),tk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tk[",tk_i,"].tx\"");
 	}
 	void getTweakX()const
 	{
 
-		fprintf(mFile,"\"%s.tk.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tk.tx\"");
 	}
 	void getTweakY(size_t tk_i)const
 	{
-		fprintf(mFile,"\"%s.tk[%i].ty\"",mName.c_str(),tk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tk[",tk_i,"].ty\"");
 	}
 	void getTweakY()const
 	{
 
-		fprintf(mFile,"\"%s.tk.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tk.ty\"");
 	}
 	void getTweakZ(size_t tk_i)const
 	{
-		fprintf(mFile,"\"%s.tk[%i].tz\"",mName.c_str(),tk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".tk[",tk_i,"].tz\"");
 	}
 	void getTweakZ()const
 	{
 
-		fprintf(mFile,"\"%s.tk.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tk.tz\"");
 	}
 	void getMap64BitIndices()const
 	{
-		fprintf(mFile,"\"%s.map\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".map\"");
 	}
 protected:
 	SubdTweak(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,69 +27,69 @@ public:
 	void setUvTweak(size_t uvtk_i,const float2& uvtk)
 	{
 		if(uvtk == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".uvtk[%i]\" -type \"float2\" ",uvtk_i);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_i,"]\" -type \"float2\" ");
 		uvtk.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvTweak(size_t uvtk_start,size_t uvtk_end,float* uvtk)
 	{
-		fprintf(mFile,"\tsetAttr \".uvtk[%i:%i]\" ", uvtk_start,uvtk_end);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_start); writeInt(mFile,":",uvtk_end,"]\" ");
 		size_t size = (uvtk_end-uvtk_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uvtk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",uvtk[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startUvTweak(size_t uvtk_start,size_t uvtk_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".uvtk[%i:%i]\"",uvtk_start,uvtk_end);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_start); writeInt(mFile,":",uvtk_end,"]\"");
 	}
 	void appendUvTweak(float uvtk)const
 	{
-		fprintf(mFile," %f",uvtk);
+		writeFloat(mFile," ",uvtk);
 	}
 	void endUvTweak()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvTweakU(size_t uvtk_i,float tu)
 	{
 		if(tu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uvtk[%i].tu\" %f;\n", uvtk_i,tu);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_i); writeFloat(mFile,"].tu\" ",tu,";\n");
 	}
 	void setUvTweakV(size_t uvtk_i,float tv)
 	{
 		if(tv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".uvtk[%i].tv\" %f;\n", uvtk_i,tv);
+		writeInt(mFile,"\tsetAttr \".uvtk[",uvtk_i); writeFloat(mFile,"].tv\" ",tv,";\n");
 	}
 	void getUvTweak(size_t uvtk_i)const
 	{
-		fprintf(mFile,"\"%s.uvtk[%i]\"",mName.c_str(),uvtk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvtk[",uvtk_i,"]\"");
 	}
 	void getUvTweak()const
 	{
 
-		fprintf(mFile,"\"%s.uvtk\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvtk\"");
 	}
 	void getUvTweakU(size_t uvtk_i)const
 	{
-		fprintf(mFile,"\"%s.uvtk[%i].tu\"",mName.c_str(),uvtk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvtk[",uvtk_i,"].tu\"");
 	}
 	void getUvTweakU()const
 	{
 
-		fprintf(mFile,"\"%s.uvtk.tu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvtk.tu\"");
 	}
 	void getUvTweakV(size_t uvtk_i)const
 	{
-		fprintf(mFile,"\"%s.uvtk[%i].tv\"",mName.c_str(),uvtk_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvtk[",uvtk_i,"].tv\"");
 	}
 	void getUvTweakV()const
 	{
 
-		fprintf(mFile,"\"%s.uvtk.tv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvtk.tv\"");
 	}
 protected:
 	SubdTweakUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
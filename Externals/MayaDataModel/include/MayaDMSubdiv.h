@@ -30,7 +30,7 @@ public:
 			for (size_t i = 0; i<nbSingleVertexTweak; ++i)
 			{
 				singleVertexTweak[i].write(file);
-				if (i + 1<nbSingleVertexTweak) fprintf(file, " ");
+				if (i + 1<nbSingleVertexTweak) writeString(file," ");
 			}
 		}
 	};
@@ -58,27 +58,27 @@ public:
 		bool miRefractionReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i ", miTransparencyReceive);
-			fprintf(file,"%i ", miReflectionReceive);
-			fprintf(file,"%i", miRefractionReceive);
+			writeInt(file,"",miOverrideCaustics," ");
+			writeInt(file,"",miCausticAccuracy," ");
+			writeFloat(file,"",miCausticRadius," ");
+			writeInt(file,"",miOverrideGlobalIllumination," ");
+			writeInt(file,"",miGlobillumAccuracy," ");
+			writeFloat(file,"",miGlobillumRadius," ");
+			writeInt(file,"",miOverrideFinalGather," ");
+			writeInt(file,"",miFinalGatherRays," ");
+			writeFloat(file,"",miFinalGatherMinRadius," ");
+			writeFloat(file,"",miFinalGatherMaxRadius," ");
+			writeInt(file,"",miFinalGatherFilter," ");
+			writeInt(file,"",miFinalGatherView," ");
+			writeInt(file,"",miOverrideSamples," ");
+			writeInt(file,"",miMinSamples," ");
+			writeInt(file,"",miMaxSamples," ");
+			writeInt(file,"",miFinalGatherCast," ");
+			writeInt(file,"",miFinalGatherReceive," ");
+			writeInt(file,"",miTransparencyCast," ");
+			writeInt(file,"",miTransparencyReceive," ");
+			writeInt(file,"",miReflectionReceive," ");
+			writeInt(file,"",miRefractionReceive);
 		}
 	};
 public:
@@ -91,555 +91,555 @@ public:
 	void setDispVertices(bool dv)
 	{
 		if(dv == false) return;
-		fprintf(mFile,"\tsetAttr \".dv\" %i;\n", dv);
+		writeInt(mFile,"\tsetAttr \".dv\" ",dv,";\n");
 	}
 	void setDispEdges(bool de)
 	{
 		if(de == false) return;
-		fprintf(mFile,"\tsetAttr \".de\" %i;\n", de);
+		writeInt(mFile,"\tsetAttr \".de\" ",de,";\n");
 	}
 	void setDispFaces(bool df)
 	{
 		if(df == false) return;
-		fprintf(mFile,"\tsetAttr \".df\" %i;\n", df);
+		writeInt(mFile,"\tsetAttr \".df\" ",df,";\n");
 	}
 	void setDispMaps(bool dm)
 	{
 		if(dm == false) return;
-		fprintf(mFile,"\tsetAttr \".dm\" %i;\n", dm);
+		writeInt(mFile,"\tsetAttr \".dm\" ",dm,";\n");
 	}
 	void setDispUVBorder(bool db)
 	{
 		if(db == false) return;
-		fprintf(mFile,"\tsetAttr \".db\" %i;\n", db);
+		writeInt(mFile,"\tsetAttr \".db\" ",db,";\n");
 	}
 	void setDispCreases(bool dcr)
 	{
 		if(dcr == false) return;
-		fprintf(mFile,"\tsetAttr \".dcr\" %i;\n", dcr);
+		writeInt(mFile,"\tsetAttr \".dcr\" ",dcr,";\n");
 	}
 	void setDispGeometry(bool dg)
 	{
 		if(dg == true) return;
-		fprintf(mFile,"\tsetAttr \".dg\" %i;\n", dg);
+		writeInt(mFile,"\tsetAttr \".dg\" ",dg,";\n");
 	}
 	void setDispResolution(int dr)
 	{
 		if(dr == 1) return;
-		fprintf(mFile,"\tsetAttr \".dr\" %i;\n", dr);
+		writeInt(mFile,"\tsetAttr \".dr\" ",dr,";\n");
 	}
 	void setVertexTweak(size_t vtw_i,const VertexTweak& vtw)
 	{
-		fprintf(mFile,"\tsetAttr \".vtw[%i]\" ",vtw_i);
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_i,"]\" ");
 		vtw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexTweak(size_t vtw_start,size_t vtw_end,VertexTweak* vtw)
 	{
-		fprintf(mFile,"\tsetAttr \".vtw[%i:%i]\" ", vtw_start,vtw_end);
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_start); writeInt(mFile,":",vtw_end,"]\" ");
 		size_t size = (vtw_end-vtw_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vtw[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertexTweak(size_t vtw_start,size_t vtw_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".vtw[%i:%i]\"",vtw_start,vtw_end);
-		fprintf(mFile," -type \"VertexTweak\" ");
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_start); writeInt(mFile,":",vtw_end,"]\"");
+		writeString(mFile," -type \"VertexTweak\" ");
 	}
 	void appendVertexTweak(const VertexTweak& vtw)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vtw.write(mFile);
 	}
 	void endVertexTweak()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSingleVertexTweak(size_t vtw_i,size_t stw_i,const double3& stw)
 	{
-		fprintf(mFile,"\tsetAttr \".vtw[%i].stw[%i]\" -type \"double3\" ",vtw_i,stw_i);
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_i,"]\" -type \"double3\" ");
 		stw.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSingleVertexTweak(size_t vtw_i,size_t stw_start,size_t stw_end,double* stw)
 	{
-		fprintf(mFile,"\tsetAttr \".vtw[%i].stw[%i:%i]\" ", vtw_i,stw_start,stw_end);
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_start); writeInt(mFile,":",stw_end,"]\" ");
 		size_t size = (stw_end-stw_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",stw[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",stw[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSingleVertexTweak(size_t vtw_i,size_t stw_start,size_t stw_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".vtw[%i].stw[%i:%i]\"",vtw_i,stw_start,stw_end);
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_start); writeInt(mFile,":",stw_end,"]\"");
 	}
 	void appendSingleVertexTweak(double stw)const
 	{
-		fprintf(mFile," %f",stw);
+		writeFloat(mFile," ",stw);
 	}
 	void endSingleVertexTweak()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSingleVertexTweakX(size_t vtw_i,size_t stw_i,double stwx)
 	{
 		if(stwx == 0) return;
-		fprintf(mFile,"\tsetAttr \".vtw[%i].stw[%i].stwx\" %f;\n", vtw_i,stw_i,stwx);
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_i); writeFloat(mFile,"].stwx\" ",stwx,";\n");
 	}
 	void setSingleVertexTweakY(size_t vtw_i,size_t stw_i,double stwy)
 	{
 		if(stwy == 0) return;
-		fprintf(mFile,"\tsetAttr \".vtw[%i].stw[%i].stwy\" %f;\n", vtw_i,stw_i,stwy);
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_i); writeFloat(mFile,"].stwy\" ",stwy,";\n");
 	}
 	void setSingleVertexTweakZ(size_t vtw_i,size_t stw_i,double stwz)
 	{
 		if(stwz == 0) return;
-		fprintf(mFile,"\tsetAttr \".vtw[%i].stw[%i].stwz\" %f;\n", vtw_i,stw_i,stwz);
+		writeInt(mFile,"\tsetAttr \".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_i); writeFloat(mFile,"].stwz\" ",stwz,";\n");
 	}
 	void setNormalsDisplayScale(double ndf)
 	{
 		if(ndf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ndf\" %f;\n", ndf);
+		writeFloat(mFile,"\tsetAttr \".ndf\" ",ndf,";\n");
 	}
 	void setFormat(unsigned int f)
 	{
 		if(f == 1) return;
-		fprintf(mFile,"\tsetAttr \".f\" %i;\n", f);
+		writeInt(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void setDepth(int d)
 	{
 		if(d == 2) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSampleCount(int sc)
 	{
 		if(sc == 4) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setDisplayLevel(unsigned int dl)
 	{
 		if(dl == 0) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %i;\n", dl);
+		writeInt(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setDisplayFilter(unsigned int dfl)
 	{
 		if(dfl == 0) return;
-		fprintf(mFile,"\tsetAttr \".dfl\" %i;\n", dfl);
+		writeInt(mFile,"\tsetAttr \".dfl\" ",dfl,";\n");
 	}
 	void setScalingHierarchy(unsigned int sh)
 	{
 		if(sh == 1) return;
-		fprintf(mFile,"\tsetAttr \".sh\" %i;\n", sh);
+		writeInt(mFile,"\tsetAttr \".sh\" ",sh,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiOverrideCaustics(bool oca)
 	{
 		if(oca == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oca\" %i;\n", oca);
+		writeInt(mFile,"\tsetAttr \".mrc.oca\" ",oca,";\n");
 	}
 	void setMiCausticAccuracy(short caa)
 	{
 		if(caa == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.caa\" %i;\n", caa);
+		writeInt(mFile,"\tsetAttr \".mrc.caa\" ",caa,";\n");
 	}
 	void setMiCausticRadius(float car)
 	{
 		if(car == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.car\" %f;\n", car);
+		writeFloat(mFile,"\tsetAttr \".mrc.car\" ",car,";\n");
 	}
 	void setMiOverrideGlobalIllumination(bool ogi)
 	{
 		if(ogi == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ogi\" %i;\n", ogi);
+		writeInt(mFile,"\tsetAttr \".mrc.ogi\" ",ogi,";\n");
 	}
 	void setMiGlobillumAccuracy(short gia)
 	{
 		if(gia == 64) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gia\" %i;\n", gia);
+		writeInt(mFile,"\tsetAttr \".mrc.gia\" ",gia,";\n");
 	}
 	void setMiGlobillumRadius(float gir)
 	{
 		if(gir == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.gir\" %f;\n", gir);
+		writeFloat(mFile,"\tsetAttr \".mrc.gir\" ",gir,";\n");
 	}
 	void setMiOverrideFinalGather(bool ofg)
 	{
 		if(ofg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ofg\" %i;\n", ofg);
+		writeInt(mFile,"\tsetAttr \".mrc.ofg\" ",ofg,";\n");
 	}
 	void setMiFinalGatherRays(int fry)
 	{
 		if(fry == 1000) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fry\" %i;\n", fry);
+		writeInt(mFile,"\tsetAttr \".mrc.fry\" ",fry,";\n");
 	}
 	void setMiFinalGatherMinRadius(float fmn)
 	{
 		if(fmn == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmn\" %f;\n", fmn);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmn\" ",fmn,";\n");
 	}
 	void setMiFinalGatherMaxRadius(float fmx)
 	{
 		if(fmx == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fmx\" %f;\n", fmx);
+		writeFloat(mFile,"\tsetAttr \".mrc.fmx\" ",fmx,";\n");
 	}
 	void setMiFinalGatherFilter(short ffi)
 	{
 		if(ffi == 1) return;
-		fprintf(mFile,"\tsetAttr \".mrc.ffi\" %i;\n", ffi);
+		writeInt(mFile,"\tsetAttr \".mrc.ffi\" ",ffi,";\n");
 	}
 	void setMiFinalGatherView(bool fgv)
 	{
 		if(fgv == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgv\" %i;\n", fgv);
+		writeInt(mFile,"\tsetAttr \".mrc.fgv\" ",fgv,";\n");
 	}
 	void setMiOverrideSamples(bool oos)
 	{
 		if(oos == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.oos\" %i;\n", oos);
+		writeInt(mFile,"\tsetAttr \".mrc.oos\" ",oos,";\n");
 	}
 	void setMiMinSamples(short mins)
 	{
 		if(mins == 0) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mins\" %i;\n", mins);
+		writeInt(mFile,"\tsetAttr \".mrc.mins\" ",mins,";\n");
 	}
 	void setMiMaxSamples(short maxs)
 	{
 		if(maxs == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.maxs\" %i;\n", maxs);
+		writeInt(mFile,"\tsetAttr \".mrc.maxs\" ",maxs,";\n");
 	}
 	void setMiFinalGatherCast(bool fgc)
 	{
 		if(fgc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fgc\" %i;\n", fgc);
+		writeInt(mFile,"\tsetAttr \".mrc.fgc\" ",fgc,";\n");
 	}
 	void setMiFinalGatherReceive(bool fge)
 	{
 		if(fge == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.fge\" %i;\n", fge);
+		writeInt(mFile,"\tsetAttr \".mrc.fge\" ",fge,";\n");
 	}
 	void setMiTransparencyCast(bool tpc)
 	{
 		if(tpc == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpc\" %i;\n", tpc);
+		writeInt(mFile,"\tsetAttr \".mrc.tpc\" ",tpc,";\n");
 	}
 	void setMiTransparencyReceive(bool tpr)
 	{
 		if(tpr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.tpr\" %i;\n", tpr);
+		writeInt(mFile,"\tsetAttr \".mrc.tpr\" ",tpr,";\n");
 	}
 	void setMiReflectionReceive(bool rflr)
 	{
 		if(rflr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.rflr\" %i;\n", rflr);
+		writeInt(mFile,"\tsetAttr \".mrc.rflr\" ",rflr,";\n");
 	}
 	void setMiRefractionReceive(bool rfrr)
 	{
 		if(rfrr == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.rfrr\" %i;\n", rfrr);
+		writeInt(mFile,"\tsetAttr \".mrc.rfrr\" ",rfrr,";\n");
 	}
 	void getCreate()const
 	{
-		fprintf(mFile,"\"%s.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cr\"");
 	}
 	void getCached()const
 	{
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 	void getDispVertices()const
 	{
-		fprintf(mFile,"\"%s.dv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dv\"");
 	}
 	void getDispVerticesAsLimitPoints()const
 	{
-		fprintf(mFile,"\"%s.dvl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dvl\"");
 	}
 	void getLocalizeLimitPointsEdit()const
 	{
-		fprintf(mFile,"\"%s.llp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".llp\"");
 	}
 	void getDispEdges()const
 	{
-		fprintf(mFile,"\"%s.de\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".de\"");
 	}
 	void getDispFaces()const
 	{
-		fprintf(mFile,"\"%s.df\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".df\"");
 	}
 	void getDispMaps()const
 	{
-		fprintf(mFile,"\"%s.dm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dm\"");
 	}
 	void getDispUVBorder()const
 	{
-		fprintf(mFile,"\"%s.db\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".db\"");
 	}
 	void getDispCreases()const
 	{
-		fprintf(mFile,"\"%s.dcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dcr\"");
 	}
 	void getDispGeometry()const
 	{
-		fprintf(mFile,"\"%s.dg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dg\"");
 	}
 	void getDispResolution()const
 	{
-		fprintf(mFile,"\"%s.dr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dr\"");
 	}
 	void getVertex(size_t vt_i)const
 	{
-		fprintf(mFile,"\"%s.vt[%i]\"",mName.c_str(),vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt[",vt_i,"]\"");
 	}
 	void getVertex()const
 	{
 
-		fprintf(mFile,"\"%s.vt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt\"");
 	}
 	void getSingleVertex(size_t vt_i,size_t svt_i)const
 	{
-		fprintf(mFile,"\"%s.vt[%i].svt[%i]\"",mName.c_str(),vt_i,svt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt[",vt_i); writeInt(mFile,"].svt[",svt_i,"]\"");
 	}
 	void getSingleVertex(size_t svt_i)const
 	{
 
-		fprintf(mFile,"\"%s.vt.svt[%i]\"",mName.c_str(),svt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt.svt[",svt_i,"]\"");
 	}
 	void getSingleVertexX(size_t vt_i,size_t svt_i)const
 	{
-		fprintf(mFile,"\"%s.vt[%i].svt[%i].svx\"",mName.c_str(),vt_i,svt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt[",vt_i); writeInt(mFile,"].svt[",svt_i,"].svx\"");
 	}
 	void getSingleVertexX(size_t svt_i)const
 	{
 
-		fprintf(mFile,"\"%s.vt.svt[%i].svx\"",mName.c_str(),svt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt.svt[",svt_i,"].svx\"");
 	}
 	void getSingleVertexY(size_t vt_i,size_t svt_i)const
 	{
-		fprintf(mFile,"\"%s.vt[%i].svt[%i].svy\"",mName.c_str(),vt_i,svt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt[",vt_i); writeInt(mFile,"].svt[",svt_i,"].svy\"");
 	}
 	void getSingleVertexY(size_t svt_i)const
 	{
 
-		fprintf(mFile,"\"%s.vt.svt[%i].svy\"",mName.c_str(),svt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt.svt[",svt_i,"].svy\"");
 	}
 	void getSingleVertexZ(size_t vt_i,size_t svt_i)const
 	{
-		fprintf(mFile,"\"%s.vt[%i].svt[%i].svz\"",mName.c_str(),vt_i,svt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt[",vt_i); writeInt(mFile,"].svt[",svt_i,"].svz\"");
 	}
 	void getSingleVertexZ(size_t svt_i)const
 	{
 
-		fprintf(mFile,"\"%s.vt.svt[%i].svz\"",mName.c_str(),svt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vt.svt[",svt_i,"].svz\"");
 	}
 	void getVertexTweak(size_t vtw_i)const
 	{
-		fprintf(mFile,"\"%s.vtw[%i]\"",mName.c_str(),vtw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw[",vtw_i,"]\"");
 	}
 	void getVertexTweak()const
 	{
 
-		fprintf(mFile,"\"%s.vtw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vtw\"");
 	}
 	void getSingleVertexTweak(size_t vtw_i,size_t stw_i)const
 	{
-		fprintf(mFile,"\"%s.vtw[%i].stw[%i]\"",mName.c_str(),vtw_i,stw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_i,"]\"");
 	}
 	void getSingleVertexTweak(size_t stw_i)const
 	{
 
-		fprintf(mFile,"\"%s.vtw.stw[%i]\"",mName.c_str(),stw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw.stw[",stw_i,"]\"");
 	}
 	void getSingleVertexTweakX(size_t vtw_i,size_t stw_i)const
 	{
-		fprintf(mFile,"\"%s.vtw[%i].stw[%i].stwx\"",mName.c_str(),vtw_i,stw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_i,"].stwx\"");
 	}
 	void getSingleVertexTweakX(size_t stw_i)const
 	{
 
-		fprintf(mFile,"\"%s.vtw.stw[%i].stwx\"",mName.c_str(),stw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw.stw[",stw_i,"].stwx\"");
 	}
 	void getSingleVertexTweakY(size_t vtw_i,size_t stw_i)const
 	{
-		fprintf(mFile,"\"%s.vtw[%i].stw[%i].stwy\"",mName.c_str(),vtw_i,stw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_i,"].stwy\"");
 	}
 	void getSingleVertexTweakY(size_t stw_i)const
 	{
 
-		fprintf(mFile,"\"%s.vtw.stw[%i].stwy\"",mName.c_str(),stw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw.stw[",stw_i,"].stwy\"");
 	}
 	void getSingleVertexTweakZ(size_t vtw_i,size_t stw_i)const
 	{
-		fprintf(mFile,"\"%s.vtw[%i].stw[%i].stwz\"",mName.c_str(),vtw_i,stw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw[",vtw_i); writeInt(mFile,"].stw[",stw_i,"].stwz\"");
 	}
 	void getSingleVertexTweakZ(size_t stw_i)const
 	{
 
-		fprintf(mFile,"\"%s.vtw.stw[%i].stwz\"",mName.c_str(),stw_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vtw.stw[",stw_i,"].stwz\"");
 	}
 	void getOutSubdiv()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getWorldSubdiv(size_t ws_i)const
 	{
-		fprintf(mFile,"\"%s.ws[%i]\"",mName.c_str(),ws_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ws[",ws_i,"]\"");
 	}
 	void getWorldSubdiv()const
 	{
 
-		fprintf(mFile,"\"%s.ws\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ws\"");
 	}
 	void getEdgeCrease()const
 	{
-		fprintf(mFile,"\"%s.ecr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ecr\"");
 	}
 	void getTextureCoord()const
 	{
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 	void getFaceUVIds(size_t fuv_i)const
 	{
-		fprintf(mFile,"\"%s.fuv[%i]\"",mName.c_str(),fuv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".fuv[",fuv_i,"]\"");
 	}
 	void getFaceUVIds()const
 	{
 
-		fprintf(mFile,"\"%s.fuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fuv\"");
 	}
 	void getNormalsDisplayScale()const
 	{
-		fprintf(mFile,"\"%s.ndf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ndf\"");
 	}
 	void getFormat()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSampleCount()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getDisplayLevel()const
 	{
-		fprintf(mFile,"\"%s.dl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dl\"");
 	}
 	void getDisplayFilter()const
 	{
-		fprintf(mFile,"\"%s.dfl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dfl\"");
 	}
 	void getBaseFaceCount()const
 	{
-		fprintf(mFile,"\"%s.bfc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bfc\"");
 	}
 	void getLevelOneFaceCount()const
 	{
-		fprintf(mFile,"\"%s.ofc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofc\"");
 	}
 	void getScalingHierarchy()const
 	{
-		fprintf(mFile,"\"%s.sh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiOverrideCaustics()const
 	{
-		fprintf(mFile,"\"%s.mrc.oca\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oca\"");
 	}
 	void getMiCausticAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.caa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.caa\"");
 	}
 	void getMiCausticRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.car\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.car\"");
 	}
 	void getMiOverrideGlobalIllumination()const
 	{
-		fprintf(mFile,"\"%s.mrc.ogi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ogi\"");
 	}
 	void getMiGlobillumAccuracy()const
 	{
-		fprintf(mFile,"\"%s.mrc.gia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gia\"");
 	}
 	void getMiGlobillumRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.gir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.gir\"");
 	}
 	void getMiOverrideFinalGather()const
 	{
-		fprintf(mFile,"\"%s.mrc.ofg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ofg\"");
 	}
 	void getMiFinalGatherRays()const
 	{
-		fprintf(mFile,"\"%s.mrc.fry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fry\"");
 	}
 	void getMiFinalGatherMinRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmn\"");
 	}
 	void getMiFinalGatherMaxRadius()const
 	{
-		fprintf(mFile,"\"%s.mrc.fmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fmx\"");
 	}
 	void getMiFinalGatherFilter()const
 	{
-		fprintf(mFile,"\"%s.mrc.ffi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.ffi\"");
 	}
 	void getMiFinalGatherView()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgv\"");
 	}
 	void getMiOverrideSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.oos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.oos\"");
 	}
 	void getMiMinSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.mins\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mins\"");
 	}
 	void getMiMaxSamples()const
 	{
-		fprintf(mFile,"\"%s.mrc.maxs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.maxs\"");
 	}
 	void getMiFinalGatherCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.fgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fgc\"");
 	}
 	void getMiFinalGatherReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.fge\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.fge\"");
 	}
 	void getMiTransparencyCast()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpc\"");
 	}
 	void getMiTransparencyReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.tpr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.tpr\"");
 	}
 	void getMiReflectionReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.rflr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.rflr\"");
 	}
 	void getMiRefractionReceive()const
 	{
-		fprintf(mFile,"\"%s.mrc.rfrr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.rfrr\"");
 	}
 protected:
 	Subdiv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,93 +27,93 @@ public:
 	void setInBase(int ib)
 	{
 		if(ib == 0) return;
-		fprintf(mFile,"\tsetAttr \".ib\" %i;\n", ib);
+		writeInt(mFile,"\tsetAttr \".ib\" ",ib,";\n");
 	}
 	void setInEdge(int ie)
 	{
 		if(ie == 0) return;
-		fprintf(mFile,"\tsetAttr \".ie\" %i;\n", ie);
+		writeInt(mFile,"\tsetAttr \".ie\" ",ie,";\n");
 	}
 	void setInLevel(unsigned int il)
 	{
 		if(il == 0) return;
-		fprintf(mFile,"\tsetAttr \".il\" %i;\n", il);
+		writeInt(mFile,"\tsetAttr \".il\" ",il,";\n");
 	}
 	void setInPath(int ip)
 	{
 		if(ip == 0) return;
-		fprintf(mFile,"\tsetAttr \".ip\" %i;\n", ip);
+		writeInt(mFile,"\tsetAttr \".ip\" ",ip,";\n");
 	}
 	void setInFinal(unsigned int if_)
 	{
 		if(if_ == 0) return;
-		fprintf(mFile,"\tsetAttr \".if\" %i;\n", if_);
+		writeInt(mFile,"\tsetAttr \".if\" ",if_,";\n");
 	}
 	void setInLeft(int ilt)
 	{
 		if(ilt == 0) return;
-		fprintf(mFile,"\tsetAttr \".ilt\" %i;\n", ilt);
+		writeInt(mFile,"\tsetAttr \".ilt\" ",ilt,";\n");
 	}
 	void setInRight(int ir)
 	{
 		if(ir == 0) return;
-		fprintf(mFile,"\tsetAttr \".ir\" %i;\n", ir);
+		writeInt(mFile,"\tsetAttr \".ir\" ",ir,";\n");
 	}
 	void getInBase()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 	void getInEdge()const
 	{
-		fprintf(mFile,"\"%s.ie\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ie\"");
 	}
 	void getInLevel()const
 	{
-		fprintf(mFile,"\"%s.il\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".il\"");
 	}
 	void getInPath()const
 	{
-		fprintf(mFile,"\"%s.ip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ip\"");
 	}
 	void getInFinal()const
 	{
-		fprintf(mFile,"\"%s.if\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".if\"");
 	}
 	void getOutLeft()const
 	{
-		fprintf(mFile,"\"%s.olt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".olt\"");
 	}
 	void getOutRight()const
 	{
-		fprintf(mFile,"\"%s.or\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".or\"");
 	}
 	void getInLeft()const
 	{
-		fprintf(mFile,"\"%s.ilt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ilt\"");
 	}
 	void getInRight()const
 	{
-		fprintf(mFile,"\"%s.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ir\"");
 	}
 	void getOutBase()const
 	{
-		fprintf(mFile,"\"%s.ob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ob\"");
 	}
 	void getOutEdge()const
 	{
-		fprintf(mFile,"\"%s.oe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oe\"");
 	}
 	void getOutLevel()const
 	{
-		fprintf(mFile,"\"%s.ol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ol\"");
 	}
 	void getOutPath()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getOutFinal()const
 	{
-		fprintf(mFile,"\"%s.of\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".of\"");
 	}
 protected:
 	SubdivComponentId(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,37 +27,37 @@ public:
 	void setXMirror(bool xm)
 	{
 		if(xm == false) return;
-		fprintf(mFile,"\tsetAttr \".xm\" %i;\n", xm);
+		writeInt(mFile,"\tsetAttr \".xm\" ",xm,";\n");
 	}
 	void setYMirror(bool ym)
 	{
 		if(ym == false) return;
-		fprintf(mFile,"\tsetAttr \".ym\" %i;\n", ym);
+		writeInt(mFile,"\tsetAttr \".ym\" ",ym,";\n");
 	}
 	void setZMirror(bool zm)
 	{
 		if(zm == false) return;
-		fprintf(mFile,"\tsetAttr \".zm\" %i;\n", zm);
+		writeInt(mFile,"\tsetAttr \".zm\" ",zm,";\n");
 	}
 	void getInSubdiv()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getXMirror()const
 	{
-		fprintf(mFile,"\"%s.xm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xm\"");
 	}
 	void getYMirror()const
 	{
-		fprintf(mFile,"\"%s.ym\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ym\"");
 	}
 	void getZMirror()const
 	{
-		fprintf(mFile,"\"%s.zm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".zm\"");
 	}
 	void getOutSubdiv()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	SubdivReverseFaces(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,33 +27,33 @@ public:
 	void setOutputType(unsigned int ot)
 	{
 		if(ot == 0) return;
-		fprintf(mFile,"\tsetAttr \".ot\" %i;\n", ot);
+		writeInt(mFile,"\tsetAttr \".ot\" ",ot,";\n");
 	}
 	void setApplyMatrixToResult(bool amr)
 	{
 		if(amr == true) return;
-		fprintf(mFile,"\tsetAttr \".amr\" %i;\n", amr);
+		writeInt(mFile,"\tsetAttr \".amr\" ",amr,";\n");
 	}
 	void getInSubdiv()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutputSurfaces(size_t os_i)const
 	{
-		fprintf(mFile,"\"%s.os[%i]\"",mName.c_str(),os_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".os[",os_i,"]\"");
 	}
 	void getOutputSurfaces()const
 	{
 
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getOutputType()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getApplyMatrixToResult()const
 	{
-		fprintf(mFile,"\"%s.amr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amr\"");
 	}
 protected:
 	SubdivToNurbs(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,296 +27,296 @@ public:
 	void setFormat(unsigned int f)
 	{
 		if(f == 0) return;
-		fprintf(mFile,"\tsetAttr \".f\" %i;\n", f);
+		writeInt(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void setPolygonType(unsigned int pt)
 	{
 		if(pt == 2) return;
-		fprintf(mFile,"\tsetAttr \".pt\" %i;\n", pt);
+		writeInt(mFile,"\tsetAttr \".pt\" ",pt,";\n");
 	}
 	void setExtractPointPosition(bool epp)
 	{
 		if(epp == false) return;
-		fprintf(mFile,"\tsetAttr \".epp\" %i;\n", epp);
+		writeInt(mFile,"\tsetAttr \".epp\" ",epp,";\n");
 	}
 	void setSampleCount(int sc)
 	{
 		if(sc == 1) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setDepth(int d)
 	{
 		if(d == 0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %i;\n", d);
+		writeInt(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setMaxPolys(int mp)
 	{
 		if(mp == 0) return;
-		fprintf(mFile,"\tsetAttr \".mp\" %i;\n", mp);
+		writeInt(mFile,"\tsetAttr \".mp\" ",mp,";\n");
 	}
 	void setSubdNormals(bool un)
 	{
 		if(un == false) return;
-		fprintf(mFile,"\tsetAttr \".un\" %i;\n", un);
+		writeInt(mFile,"\tsetAttr \".un\" ",un,";\n");
 	}
 	void setCopyUVTopology(bool cut)
 	{
 		if(cut == false) return;
-		fprintf(mFile,"\tsetAttr \".cut\" %i;\n", cut);
+		writeInt(mFile,"\tsetAttr \".cut\" ",cut,";\n");
 	}
 	void setShareUVs(bool suv)
 	{
 		if(suv == false) return;
-		fprintf(mFile,"\tsetAttr \".suv\" %i;\n", suv);
+		writeInt(mFile,"\tsetAttr \".suv\" ",suv,";\n");
 	}
 	void setLevel(int l)
 	{
 		if(l == 0) return;
-		fprintf(mFile,"\tsetAttr \".l\" %i;\n", l);
+		writeInt(mFile,"\tsetAttr \".l\" ",l,";\n");
 	}
 	void setConvertComp(bool cc)
 	{
 		if(cc == false) return;
-		fprintf(mFile,"\tsetAttr \".cc\" %i;\n", cc);
+		writeInt(mFile,"\tsetAttr \".cc\" ",cc,";\n");
 	}
 	void setOutSubdCVId(size_t os_i,const long2& os)
 	{
-		fprintf(mFile,"\tsetAttr \".os[%i]\" -type \"long2\" ",os_i);
+		writeInt(mFile,"\tsetAttr \".os[",os_i,"]\" -type \"long2\" ");
 		os.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutSubdCVId(size_t os_start,size_t os_end,int* os)
 	{
-		fprintf(mFile,"\tsetAttr \".os[%i:%i]\" ", os_start,os_end);
+		writeInt(mFile,"\tsetAttr \".os[",os_start); writeInt(mFile,":",os_end,"]\" ");
 		size_t size = (os_end-os_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",os[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",os[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startOutSubdCVId(size_t os_start,size_t os_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".os[%i:%i]\"",os_start,os_end);
+		writeInt(mFile,"\tsetAttr \".os[",os_start); writeInt(mFile,":",os_end,"]\"");
 	}
 	void appendOutSubdCVId(int os)const
 	{
-		fprintf(mFile," %i",os);
+		writeInt(mFile," ",os);
 	}
 	void endOutSubdCVId()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutSubdCVIdLeft(size_t os_i,int osl)
 	{
 		if(osl == 0) return;
-		fprintf(mFile,"\tsetAttr \".os[%i].osl\" %i;\n", os_i,osl);
+		writeInt(mFile,"\tsetAttr \".os[",os_i); writeInt(mFile,"].osl\" ",osl,";\n");
 	}
 	void setOutSubdCVIdRight(size_t os_i,int osr)
 	{
 		if(osr == 0) return;
-		fprintf(mFile,"\tsetAttr \".os[%i].osr\" %i;\n", os_i,osr);
+		writeInt(mFile,"\tsetAttr \".os[",os_i); writeInt(mFile,"].osr\" ",osr,";\n");
 	}
 	void setInSubdCVId(size_t is_i,const long2& is)
 	{
-		fprintf(mFile,"\tsetAttr \".is[%i]\" -type \"long2\" ",is_i);
+		writeInt(mFile,"\tsetAttr \".is[",is_i,"]\" -type \"long2\" ");
 		is.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInSubdCVId(size_t is_start,size_t is_end,int* is)
 	{
-		fprintf(mFile,"\tsetAttr \".is[%i:%i]\" ", is_start,is_end);
+		writeInt(mFile,"\tsetAttr \".is[",is_start); writeInt(mFile,":",is_end,"]\" ");
 		size_t size = (is_end-is_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",is[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",is[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startInSubdCVId(size_t is_start,size_t is_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".is[%i:%i]\"",is_start,is_end);
+		writeInt(mFile,"\tsetAttr \".is[",is_start); writeInt(mFile,":",is_end,"]\"");
 	}
 	void appendInSubdCVId(int is)const
 	{
-		fprintf(mFile," %i",is);
+		writeInt(mFile," ",is);
 	}
 	void endInSubdCVId()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInSubdCVIdLeft(size_t is_i,int isl)
 	{
 		if(isl == 0) return;
-		fprintf(mFile,"\tsetAttr \".is[%i].isl\" %i;\n", is_i,isl);
+		writeInt(mFile,"\tsetAttr \".is[",is_i); writeInt(mFile,"].isl\" ",isl,";\n");
 	}
 	void setInSubdCVIdRight(size_t is_i,int isr)
 	{
 		if(isr == 0) return;
-		fprintf(mFile,"\tsetAttr \".is[%i].isr\" %i;\n", is_i,isr);
+		writeInt(mFile,"\tsetAttr \".is[",is_i); writeInt(mFile,"].isr\" ",isr,";\n");
 	}
 	void setPreserveVertexOrdering(bool pvo)
 	{
 		if(pvo == true) return;
-		fprintf(mFile,"\tsetAttr \".pvo\" %i;\n", pvo);
+		writeInt(mFile,"\tsetAttr \".pvo\" ",pvo,";\n");
 	}
 	void setOutv(size_t ov_i,int ov)
 	{
 		if(ov == 0) return;
-		fprintf(mFile,"\tsetAttr \".ov[%i]\" %i;\n", ov_i,ov);
+		writeInt(mFile,"\tsetAttr \".ov[",ov_i); writeInt(mFile,"]\" ",ov,";\n");
 	}
 	void setOutv(size_t ov_start,size_t ov_end,int* ov)
 	{
-		fprintf(mFile,"\tsetAttr \".ov[%i:%i]\" ", ov_start,ov_end);
+		writeInt(mFile,"\tsetAttr \".ov[",ov_start); writeInt(mFile,":",ov_end,"]\" ");
 		size_t size = (ov_end-ov_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ov[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",ov[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startOutv(size_t ov_start,size_t ov_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".ov[%i:%i]\"",ov_start,ov_end);
+		writeInt(mFile,"\tsetAttr \".ov[",ov_start); writeInt(mFile,":",ov_end,"]\"");
 	}
 	void appendOutv(int ov)const
 	{
-		fprintf(mFile," %i",ov);
+		writeInt(mFile," ",ov);
 	}
 	void endOutv()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setApplyMatrixToResult(bool amr)
 	{
 		if(amr == true) return;
-		fprintf(mFile,"\tsetAttr \".amr\" %i;\n", amr);
+		writeInt(mFile,"\tsetAttr \".amr\" ",amr,";\n");
 	}
 	void getInSubdiv()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutMesh()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getFormat()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getPolygonType()const
 	{
-		fprintf(mFile,"\"%s.pt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pt\"");
 	}
 	void getExtractPointPosition()const
 	{
-		fprintf(mFile,"\"%s.epp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".epp\"");
 	}
 	void getSampleCount()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getMaxPolys()const
 	{
-		fprintf(mFile,"\"%s.mp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mp\"");
 	}
 	void getSubdNormals()const
 	{
-		fprintf(mFile,"\"%s.un\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".un\"");
 	}
 	void getCopyUVTopology()const
 	{
-		fprintf(mFile,"\"%s.cut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cut\"");
 	}
 	void getShareUVs()const
 	{
-		fprintf(mFile,"\"%s.suv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".suv\"");
 	}
 	void getLevel()const
 	{
-		fprintf(mFile,"\"%s.l\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".l\"");
 	}
 	void getConvertComp()const
 	{
-		fprintf(mFile,"\"%s.cc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cc\"");
 	}
 	void getOutSubdCVId(size_t os_i)const
 	{
-		fprintf(mFile,"\"%s.os[%i]\"",mName.c_str(),os_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".os[",os_i,"]\"");
 	}
 	void getOutSubdCVId()const
 	{
 
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getOutSubdCVIdLeft(size_t os_i)const
 	{
-		fprintf(mFile,"\"%s.os[%i].osl\"",mName.c_str(),os_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".os[",os_i,"].osl\"");
 	}
 	void getOutSubdCVIdLeft()const
 	{
 
-		fprintf(mFile,"\"%s.os.osl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os.osl\"");
 	}
 	void getOutSubdCVIdRight(size_t os_i)const
 	{
-		fprintf(mFile,"\"%s.os[%i].osr\"",mName.c_str(),os_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".os[",os_i,"].osr\"");
 	}
 	void getOutSubdCVIdRight()const
 	{
 
-		fprintf(mFile,"\"%s.os.osr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os.osr\"");
 	}
 	void getInSubdCVId(size_t is_i)const
 	{
-		fprintf(mFile,"\"%s.is[%i]\"",mName.c_str(),is_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".is[",is_i,"]\"");
 	}
 	void getInSubdCVId()const
 	{
 
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getInSubdCVIdLeft(size_t is_i)const
 	{
-		fprintf(mFile,"\"%s.is[%i].isl\"",mName.c_str(),is_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".is[",is_i,"].isl\"");
 	}
 	void getInSubdCVIdLeft()const
 	{
 
-		fprintf(mFile,"\"%s.is.isl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isl\"");
 	}
 	void getInSubdCVIdRight(size_t is_i)const
 	{
-		fprintf(mFile,"\"%s.is[%i].isr\"",mName.c_str(),is_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".is[",is_i,"].isr\"");
 	}
 	void getInSubdCVIdRight()const
 	{
 
-		fprintf(mFile,"\"%s.is.isr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is.isr\"");
 	}
 	void getPreserveVertexOrdering()const
 	{
-		fprintf(mFile,"\"%s.pvo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pvo\"");
 	}
 	void getOutv(size_t ov_i)const
 	{
-		fprintf(mFile,"\"%s.ov[%i]\"",mName.c_str(),ov_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ov[",ov_i,"]\"");
 	}
 	void getOutv()const
 	{
 
-		fprintf(mFile,"\"%s.ov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov\"");
 	}
 	void getApplyMatrixToResult()const
 	{
-		fprintf(mFile,"\"%s.amr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".amr\"");
 	}
 protected:
 	SubdivToPoly(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
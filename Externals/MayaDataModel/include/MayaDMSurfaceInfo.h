@@ -26,70 +26,70 @@ public:
 
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getControlPoints(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i]\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"]\"");
 	}
 	void getControlPoints()const
 	{
 
-		fprintf(mFile,"\"%s.cp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp\"");
 	}
 	void getXValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].xv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].xv\"");
 	}
 	void getXValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.xv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.xv\"");
 	}
 	void getYValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].yv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].yv\"");
 	}
 	void getYValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.yv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.yv\"");
 	}
 	void getZValue(size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.cp[%i].zv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cp[",cp_i,"].zv\"");
 	}
 	void getZValue()const
 	{
 
-		fprintf(mFile,"\"%s.cp.zv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cp.zv\"");
 	}
 	void getWeights(size_t wt_i)const
 	{
-		fprintf(mFile,"\"%s.wt[%i]\"",mName.c_str(),wt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wt[",wt_i,"]\"");
 	}
 	void getWeights()const
 	{
 
-		fprintf(mFile,"\"%s.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wt\"");
 	}
 	void getKnotsU(size_t ku_i)const
 	{
-		fprintf(mFile,"\"%s.ku[%i]\"",mName.c_str(),ku_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ku[",ku_i,"]\"");
 	}
 	void getKnotsU()const
 	{
 
-		fprintf(mFile,"\"%s.ku\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ku\"");
 	}
 	void getKnotsV(size_t kv_i)const
 	{
-		fprintf(mFile,"\"%s.kv[%i]\"",mName.c_str(),kv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".kv[",kv_i,"]\"");
 	}
 	void getKnotsV()const
 	{
 
-		fprintf(mFile,"\"%s.kv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".kv\"");
 	}
 protected:
 	SurfaceInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,104 +27,104 @@ public:
 	void setMaxDist(float S00)
 	{
 		if(S00 == 0) return;
-		fprintf(mFile,"\tsetAttr \".S00\" %f;\n", S00);
+		writeFloat(mFile,"\tsetAttr \".S00\" ",S00,";\n");
 	}
 	void setEnveloperSearch(int S02)
 	{
 		if(S02 == 0) return;
-		fprintf(mFile,"\tsetAttr \".S02\" %i;\n", S02);
+		writeInt(mFile,"\tsetAttr \".S02\" ",S02,";\n");
 	}
 	void setEvaluateMaterial(bool S03)
 	{
 		if(S03 == 0) return;
-		fprintf(mFile,"\tsetAttr \".S03\" %i;\n", S03);
+		writeInt(mFile,"\tsetAttr \".S03\" ",S03,";\n");
 	}
 	void setEvaluateCustomShader(bool S04)
 	{
 		if(S04 == 0) return;
-		fprintf(mFile,"\tsetAttr \".S04\" %i;\n", S04);
+		writeInt(mFile,"\tsetAttr \".S04\" ",S04,";\n");
 	}
 	void setCustomColor(const float3& S05)
 	{
 		if(S05 == float3(1,1,1)) return;
-		fprintf(mFile,"\tsetAttr \".S05\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".S05\" -type \"float3\" ");
 		S05.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefaultColor(const float3& S06)
 	{
-		fprintf(mFile,"\tsetAttr \".S06\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".S06\" -type \"float3\" ");
 		S06.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCoordinate(int S07)
 	{
 		if(S07 == 1) return;
-		fprintf(mFile,"\tsetAttr \".S07\" %i;\n", S07);
+		writeInt(mFile,"\tsetAttr \".S07\" ",S07,";\n");
 	}
 	void setAutoInverseNormal(bool S08)
 	{
 		if(S08 == 1) return;
-		fprintf(mFile,"\tsetAttr \".S08\" %i;\n", S08);
+		writeInt(mFile,"\tsetAttr \".S08\" ",S08,";\n");
 	}
 	void setVectorToColor(bool S09)
 	{
 		if(S09 == 0) return;
-		fprintf(mFile,"\tsetAttr \".S09\" %i;\n", S09);
+		writeInt(mFile,"\tsetAttr \".S09\" ",S09,";\n");
 	}
 	void getMaxDist()const
 	{
-		fprintf(mFile,"\"%s.S00\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S00\"");
 	}
 	void getEnvelopes(size_t S01_i)const
 	{
-		fprintf(mFile,"\"%s.S01[%i]\"",mName.c_str(),S01_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".S01[",S01_i,"]\"");
 	}
 	void getEnvelopes()const
 	{
 
-		fprintf(mFile,"\"%s.S01\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S01\"");
 	}
 	void getEnveloperSearch()const
 	{
-		fprintf(mFile,"\"%s.S02\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S02\"");
 	}
 	void getEvaluateMaterial()const
 	{
-		fprintf(mFile,"\"%s.S03\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S03\"");
 	}
 	void getEvaluateCustomShader()const
 	{
-		fprintf(mFile,"\"%s.S04\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S04\"");
 	}
 	void getCustomColor()const
 	{
-		fprintf(mFile,"\"%s.S05\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S05\"");
 	}
 	void getDefaultColor()const
 	{
-		fprintf(mFile,"\"%s.S06\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S06\"");
 	}
 	void getCoordinate()const
 	{
-		fprintf(mFile,"\"%s.S07\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S07\"");
 	}
 	void getAutoInverseNormal()const
 	{
-		fprintf(mFile,"\"%s.S08\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S08\"");
 	}
 	void getVectorToColor()const
 	{
-		fprintf(mFile,"\"%s.S09\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S09\"");
 	}
 	void getSources(size_t S10_i)const
 	{
-		fprintf(mFile,"\"%s.S10[%i]\"",mName.c_str(),S10_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".S10[",S10_i,"]\"");
 	}
 	void getSources()const
 	{
 
-		fprintf(mFile,"\"%s.S10\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".S10\"");
 	}
 protected:
 	SurfaceSampler(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,456 +27,456 @@ public:
 	void setOutColor(const float3& oc)
 	{
 		if(oc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".oc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".oc\" -type \"float3\" ");
 		oc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutColorR(float ocr)
 	{
 		if(ocr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocr\" %f;\n", ocr);
+		writeFloat(mFile,"\tsetAttr \".oc.ocr\" ",ocr,";\n");
 	}
 	void setOutColorG(float ocg)
 	{
 		if(ocg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocg\" %f;\n", ocg);
+		writeFloat(mFile,"\tsetAttr \".oc.ocg\" ",ocg,";\n");
 	}
 	void setOutColorB(float ocb)
 	{
 		if(ocb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocb\" %f;\n", ocb);
+		writeFloat(mFile,"\tsetAttr \".oc.ocb\" ",ocb,";\n");
 	}
 	void setOutTransparency(const float3& ot)
 	{
 		if(ot == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ot\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ot\" -type \"float3\" ");
 		ot.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutTransparencyR(float otr)
 	{
 		if(otr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ot.otr\" %f;\n", otr);
+		writeFloat(mFile,"\tsetAttr \".ot.otr\" ",otr,";\n");
 	}
 	void setOutTransparencyG(float otg)
 	{
 		if(otg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ot.otg\" %f;\n", otg);
+		writeFloat(mFile,"\tsetAttr \".ot.otg\" ",otg,";\n");
 	}
 	void setOutTransparencyB(float otb)
 	{
 		if(otb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ot.otb\" %f;\n", otb);
+		writeFloat(mFile,"\tsetAttr \".ot.otb\" ",otb,";\n");
 	}
 	void setOutMatteOpacity(const float3& omo)
 	{
 		if(omo == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".omo\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".omo\" -type \"float3\" ");
 		omo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutMatteOpacityR(float omor)
 	{
 		if(omor == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".omo.omor\" %f;\n", omor);
+		writeFloat(mFile,"\tsetAttr \".omo.omor\" ",omor,";\n");
 	}
 	void setOutMatteOpacityG(float omog)
 	{
 		if(omog == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".omo.omog\" %f;\n", omog);
+		writeFloat(mFile,"\tsetAttr \".omo.omog\" ",omog,";\n");
 	}
 	void setOutMatteOpacityB(float omob)
 	{
 		if(omob == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".omo.omob\" %f;\n", omob);
+		writeFloat(mFile,"\tsetAttr \".omo.omob\" ",omob,";\n");
 	}
 	void setOutGlowColor(const float3& og)
 	{
 		if(og == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".og\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".og\" -type \"float3\" ");
 		og.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutGlowColorR(float ogr)
 	{
 		if(ogr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".og.ogr\" %f;\n", ogr);
+		writeFloat(mFile,"\tsetAttr \".og.ogr\" ",ogr,";\n");
 	}
 	void setOutGlowColorG(float ogg)
 	{
 		if(ogg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".og.ogg\" %f;\n", ogg);
+		writeFloat(mFile,"\tsetAttr \".og.ogg\" ",ogg,";\n");
 	}
 	void setOutGlowColorB(float ogb)
 	{
 		if(ogb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".og.ogb\" %f;\n", ogb);
+		writeFloat(mFile,"\tsetAttr \".og.ogb\" ",ogb,";\n");
 	}
 	void setMiDeriveFromMaya(bool mifm)
 	{
 		if(mifm == true) return;
-		fprintf(mFile,"\tsetAttr \".mifm\" %i;\n", mifm);
+		writeInt(mFile,"\tsetAttr \".mifm\" ",mifm,";\n");
 	}
 	void setMiShinyness(float mis)
 	{
 		if(mis == 10) return;
-		fprintf(mFile,"\tsetAttr \".mis\" %f;\n", mis);
+		writeFloat(mFile,"\tsetAttr \".mis\" ",mis,";\n");
 	}
 	void setMiAngle(float mia)
 	{
 		if(mia == 0) return;
-		fprintf(mFile,"\tsetAttr \".mia\" %f;\n", mia);
+		writeFloat(mFile,"\tsetAttr \".mia\" ",mia,";\n");
 	}
 	void setMiSpreadX(float misx)
 	{
 		if(misx == 10) return;
-		fprintf(mFile,"\tsetAttr \".misx\" %f;\n", misx);
+		writeFloat(mFile,"\tsetAttr \".misx\" ",misx,";\n");
 	}
 	void setMiSpreadY(float misy)
 	{
 		if(misy == 5) return;
-		fprintf(mFile,"\tsetAttr \".misy\" %f;\n", misy);
+		writeFloat(mFile,"\tsetAttr \".misy\" ",misy,";\n");
 	}
 	void setMiWhiteness(const float3& miwn)
 	{
-		fprintf(mFile,"\tsetAttr \".miwn\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".miwn\" -type \"float3\" ");
 		miwn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiWhitenessR(float miwnr)
 	{
 		if(miwnr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwnr\" %f;\n", miwnr);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwnr\" ",miwnr,";\n");
 	}
 	void setMiWhitenessG(float miwng)
 	{
 		if(miwng == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwng\" %f;\n", miwng);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwng\" ",miwng,";\n");
 	}
 	void setMiWhitenessB(float miwnb)
 	{
 		if(miwnb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".miwn.miwnb\" %f;\n", miwnb);
+		writeFloat(mFile,"\tsetAttr \".miwn.miwnb\" ",miwnb,";\n");
 	}
 	void setMiSpecularColor(const float3& misc)
 	{
-		fprintf(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".misc\" -type \"float3\" ");
 		misc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiSpecularColorR(float miscr)
 	{
 		if(miscr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscr\" %f;\n", miscr);
+		writeFloat(mFile,"\tsetAttr \".misc.miscr\" ",miscr,";\n");
 	}
 	void setMiSpecularColorG(float miscg)
 	{
 		if(miscg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscg\" %f;\n", miscg);
+		writeFloat(mFile,"\tsetAttr \".misc.miscg\" ",miscg,";\n");
 	}
 	void setMiSpecularColorB(float miscb)
 	{
 		if(miscb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".misc.miscb\" %f;\n", miscb);
+		writeFloat(mFile,"\tsetAttr \".misc.miscb\" ",miscb,";\n");
 	}
 	void setMiReflectivity(float mirf)
 	{
 		if(mirf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mirf\" %f;\n", mirf);
+		writeFloat(mFile,"\tsetAttr \".mirf\" ",mirf,";\n");
 	}
 	void setMiRefractiveIndex(float miri)
 	{
 		if(miri == 1) return;
-		fprintf(mFile,"\tsetAttr \".miri\" %f;\n", miri);
+		writeFloat(mFile,"\tsetAttr \".miri\" ",miri,";\n");
 	}
 	void setMiRefractions(bool mirc)
 	{
 		if(mirc == true) return;
-		fprintf(mFile,"\tsetAttr \".mirc\" %i;\n", mirc);
+		writeInt(mFile,"\tsetAttr \".mirc\" ",mirc,";\n");
 	}
 	void setMiAbsorbs(bool miab)
 	{
 		if(miab == true) return;
-		fprintf(mFile,"\tsetAttr \".miab\" %i;\n", miab);
+		writeInt(mFile,"\tsetAttr \".miab\" ",miab,";\n");
 	}
 	void setMiDiffuse(float midc)
 	{
 		if(midc == 0.8) return;
-		fprintf(mFile,"\tsetAttr \".midc\" %f;\n", midc);
+		writeFloat(mFile,"\tsetAttr \".midc\" ",midc,";\n");
 	}
 	void setMiColor(const float3& mic)
 	{
-		fprintf(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mic\" -type \"float3\" ");
 		mic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiColorR(float micr)
 	{
 		if(micr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micr\" %f;\n", micr);
+		writeFloat(mFile,"\tsetAttr \".mic.micr\" ",micr,";\n");
 	}
 	void setMiColorG(float micg)
 	{
 		if(micg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micg\" %f;\n", micg);
+		writeFloat(mFile,"\tsetAttr \".mic.micg\" ",micg,";\n");
 	}
 	void setMiColorB(float micb)
 	{
 		if(micb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mic.micb\" %f;\n", micb);
+		writeFloat(mFile,"\tsetAttr \".mic.micb\" ",micb,";\n");
 	}
 	void setMiTransparency(const float3& mit)
 	{
-		fprintf(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".mit\" -type \"float3\" ");
 		mit.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiTransparencyR(float mitr)
 	{
 		if(mitr == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitr\" %f;\n", mitr);
+		writeFloat(mFile,"\tsetAttr \".mit.mitr\" ",mitr,";\n");
 	}
 	void setMiTransparencyG(float mitg)
 	{
 		if(mitg == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitg\" %f;\n", mitg);
+		writeFloat(mFile,"\tsetAttr \".mit.mitg\" ",mitg,";\n");
 	}
 	void setMiTransparencyB(float mitb)
 	{
 		if(mitb == 0) return;
-		fprintf(mFile,"\tsetAttr \".mit.mitb\" %f;\n", mitb);
+		writeFloat(mFile,"\tsetAttr \".mit.mitb\" ",mitb,";\n");
 	}
 	void setMiTranslucence(float mitc)
 	{
 		if(mitc == 0) return;
-		fprintf(mFile,"\tsetAttr \".mitc\" %f;\n", mitc);
+		writeFloat(mFile,"\tsetAttr \".mitc\" ",mitc,";\n");
 	}
 	void setMiTranslucenceFocus(float mitf)
 	{
 		if(mitf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".mitf\" %f;\n", mitf);
+		writeFloat(mFile,"\tsetAttr \".mitf\" ",mitf,";\n");
 	}
 	void setMiNormalCamera(const float3& minc)
 	{
-		fprintf(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".minc\" -type \"float3\" ");
 		minc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiNormalCameraX(float mincx)
 	{
 		if(mincx == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincx\" %f;\n", mincx);
+		writeFloat(mFile,"\tsetAttr \".minc.mincx\" ",mincx,";\n");
 	}
 	void setMiNormalCameraY(float mincy)
 	{
 		if(mincy == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincy\" %f;\n", mincy);
+		writeFloat(mFile,"\tsetAttr \".minc.mincy\" ",mincy,";\n");
 	}
 	void setMiNormalCameraZ(float mincz)
 	{
 		if(mincz == 0) return;
-		fprintf(mFile,"\tsetAttr \".minc.mincz\" %f;\n", mincz);
+		writeFloat(mFile,"\tsetAttr \".minc.mincz\" ",mincz,";\n");
 	}
 	void setMaterialAlphaGain(float maga)
 	{
 		if(maga == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".maga\" %f;\n", maga);
+		writeFloat(mFile,"\tsetAttr \".maga\" ",maga,";\n");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.og.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.og.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.og.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og.ogb\"");
 	}
 	void getMiDeriveFromMaya()const
 	{
-		fprintf(mFile,"\"%s.mifm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mifm\"");
 	}
 	void getMiShinyness()const
 	{
-		fprintf(mFile,"\"%s.mis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mis\"");
 	}
 	void getMiAngle()const
 	{
-		fprintf(mFile,"\"%s.mia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mia\"");
 	}
 	void getMiSpreadX()const
 	{
-		fprintf(mFile,"\"%s.misx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misx\"");
 	}
 	void getMiSpreadY()const
 	{
-		fprintf(mFile,"\"%s.misy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misy\"");
 	}
 	void getMiWhiteness()const
 	{
-		fprintf(mFile,"\"%s.miwn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn\"");
 	}
 	void getMiWhitenessR()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwnr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwnr\"");
 	}
 	void getMiWhitenessG()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwng\"");
 	}
 	void getMiWhitenessB()const
 	{
-		fprintf(mFile,"\"%s.miwn.miwnb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miwn.miwnb\"");
 	}
 	void getMiSpecularColor()const
 	{
-		fprintf(mFile,"\"%s.misc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc\"");
 	}
 	void getMiSpecularColorR()const
 	{
-		fprintf(mFile,"\"%s.misc.miscr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscr\"");
 	}
 	void getMiSpecularColorG()const
 	{
-		fprintf(mFile,"\"%s.misc.miscg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscg\"");
 	}
 	void getMiSpecularColorB()const
 	{
-		fprintf(mFile,"\"%s.misc.miscb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".misc.miscb\"");
 	}
 	void getMiReflectivity()const
 	{
-		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirf\"");
 	}
 	void getMiRefractiveIndex()const
 	{
-		fprintf(mFile,"\"%s.miri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miri\"");
 	}
 	void getMiRefractions()const
 	{
-		fprintf(mFile,"\"%s.mirc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mirc\"");
 	}
 	void getMiAbsorbs()const
 	{
-		fprintf(mFile,"\"%s.miab\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".miab\"");
 	}
 	void getMiDiffuse()const
 	{
-		fprintf(mFile,"\"%s.midc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".midc\"");
 	}
 	void getMiColor()const
 	{
-		fprintf(mFile,"\"%s.mic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic\"");
 	}
 	void getMiColorR()const
 	{
-		fprintf(mFile,"\"%s.mic.micr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micr\"");
 	}
 	void getMiColorG()const
 	{
-		fprintf(mFile,"\"%s.mic.micg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micg\"");
 	}
 	void getMiColorB()const
 	{
-		fprintf(mFile,"\"%s.mic.micb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mic.micb\"");
 	}
 	void getMiTransparency()const
 	{
-		fprintf(mFile,"\"%s.mit\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit\"");
 	}
 	void getMiTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.mit.mitr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitr\"");
 	}
 	void getMiTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.mit.mitg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitg\"");
 	}
 	void getMiTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.mit.mitb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mit.mitb\"");
 	}
 	void getMiTranslucence()const
 	{
-		fprintf(mFile,"\"%s.mitc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitc\"");
 	}
 	void getMiTranslucenceFocus()const
 	{
-		fprintf(mFile,"\"%s.mitf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mitf\"");
 	}
 	void getMiNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.minc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc\"");
 	}
 	void getMiNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.minc.mincx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincx\"");
 	}
 	void getMiNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.minc.mincy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincy\"");
 	}
 	void getMiNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".minc.mincz\"");
 	}
 	void getMaterialAlphaGain()const
 	{
-		fprintf(mFile,"\"%s.maga\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".maga\"");
 	}
 protected:
 	SurfaceShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
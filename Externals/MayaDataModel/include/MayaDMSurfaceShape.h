@@ -23,9 +23,9 @@ public:
 		unsigned int collisionOffsetVelocityIncrement_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", collisionOffsetVelocityIncrement_Position);
-			fprintf(file,"%f ", collisionOffsetVelocityIncrement_FloatValue);
-			fprintf(file,"%i", collisionOffsetVelocityIncrement_Interp);
+			writeFloat(file,"",collisionOffsetVelocityIncrement_Position," ");
+			writeFloat(file,"",collisionOffsetVelocityIncrement_FloatValue," ");
+			writeInt(file,"",collisionOffsetVelocityIncrement_Interp);
 		}
 	};
 	struct CollisionDepthVelocityIncrement{
@@ -34,9 +34,9 @@ public:
 		unsigned int collisionDepthVelocityIncrement_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", collisionDepthVelocityIncrement_Position);
-			fprintf(file,"%f ", collisionDepthVelocityIncrement_FloatValue);
-			fprintf(file,"%i", collisionDepthVelocityIncrement_Interp);
+			writeFloat(file,"",collisionDepthVelocityIncrement_Position," ");
+			writeFloat(file,"",collisionDepthVelocityIncrement_FloatValue," ");
+			writeInt(file,"",collisionDepthVelocityIncrement_Interp);
 		}
 	};
 	struct CollisionOffsetVelocityMultiplier{
@@ -45,9 +45,9 @@ public:
 		unsigned int collisionOffsetVelocityMultiplier_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", collisionOffsetVelocityMultiplier_Position);
-			fprintf(file,"%f ", collisionOffsetVelocityMultiplier_FloatValue);
-			fprintf(file,"%i", collisionOffsetVelocityMultiplier_Interp);
+			writeFloat(file,"",collisionOffsetVelocityMultiplier_Position," ");
+			writeFloat(file,"",collisionOffsetVelocityMultiplier_FloatValue," ");
+			writeInt(file,"",collisionOffsetVelocityMultiplier_Interp);
 		}
 	};
 	struct CollisionDepthVelocityMultiplier{
@@ -56,9 +56,9 @@ public:
 		unsigned int collisionDepthVelocityMultiplier_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", collisionDepthVelocityMultiplier_Position);
-			fprintf(file,"%f ", collisionDepthVelocityMultiplier_FloatValue);
-			fprintf(file,"%i", collisionDepthVelocityMultiplier_Interp);
+			writeFloat(file,"",collisionDepthVelocityMultiplier_Position," ");
+			writeFloat(file,"",collisionDepthVelocityMultiplier_FloatValue," ");
+			writeInt(file,"",collisionDepthVelocityMultiplier_Interp);
 		}
 	};
 public:
@@ -71,457 +71,457 @@ public:
 	void setIgnoreHwShader(bool ih)
 	{
 		if(ih == false) return;
-		fprintf(mFile,"\tsetAttr \".ih\" %i;\n", ih);
+		writeInt(mFile,"\tsetAttr \".ih\" ",ih,";\n");
 	}
 	void setDoubleSided(bool ds)
 	{
 		if(ds == true) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %i;\n", ds);
+		writeInt(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void setOpposite(bool op)
 	{
 		if(op == false) return;
-		fprintf(mFile,"\tsetAttr \".op\" %i;\n", op);
+		writeInt(mFile,"\tsetAttr \".op\" ",op,";\n");
 	}
 	void setSmoothShading(bool smo)
 	{
 		if(smo == true) return;
-		fprintf(mFile,"\tsetAttr \".smo\" %i;\n", smo);
+		writeInt(mFile,"\tsetAttr \".smo\" ",smo,";\n");
 	}
 	void setBoundingBoxScale(const float3& bbs)
 	{
-		fprintf(mFile,"\tsetAttr \".bbs\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".bbs\" -type \"float3\" ");
 		bbs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBoundingBoxScaleX(float bscx)
 	{
 		if(bscx == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".bbs.bscx\" %f;\n", bscx);
+		writeFloat(mFile,"\tsetAttr \".bbs.bscx\" ",bscx,";\n");
 	}
 	void setBoundingBoxScaleY(float bscy)
 	{
 		if(bscy == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".bbs.bscy\" %f;\n", bscy);
+		writeFloat(mFile,"\tsetAttr \".bbs.bscy\" ",bscy,";\n");
 	}
 	void setBoundingBoxScaleZ(float bscz)
 	{
 		if(bscz == 1.5) return;
-		fprintf(mFile,"\tsetAttr \".bbs.bscz\" %f;\n", bscz);
+		writeFloat(mFile,"\tsetAttr \".bbs.bscz\" ",bscz,";\n");
 	}
 	void setFeatureDisplacement(bool fbda)
 	{
 		if(fbda == true) return;
-		fprintf(mFile,"\tsetAttr \".fbda\" %i;\n", fbda);
+		writeInt(mFile,"\tsetAttr \".fbda\" ",fbda,";\n");
 	}
 	void setInitialSampleRate(int dsr)
 	{
 		if(dsr == 6) return;
-		fprintf(mFile,"\tsetAttr \".dsr\" %i;\n", dsr);
+		writeInt(mFile,"\tsetAttr \".dsr\" ",dsr,";\n");
 	}
 	void setExtraSampleRate(int xsr)
 	{
 		if(xsr == 5) return;
-		fprintf(mFile,"\tsetAttr \".xsr\" %i;\n", xsr);
+		writeInt(mFile,"\tsetAttr \".xsr\" ",xsr,";\n");
 	}
 	void setTextureThreshold(int fth)
 	{
 		if(fth == 0) return;
-		fprintf(mFile,"\tsetAttr \".fth\" %i;\n", fth);
+		writeInt(mFile,"\tsetAttr \".fth\" ",fth,";\n");
 	}
 	void setNormalThreshold(float nat)
 	{
 		if(nat == 30) return;
-		fprintf(mFile,"\tsetAttr \".nat\" %f;\n", nat);
+		writeFloat(mFile,"\tsetAttr \".nat\" ",nat,";\n");
 	}
 	void setDisplayHWEnvironment(bool dhe)
 	{
 		if(dhe == false) return;
-		fprintf(mFile,"\tsetAttr \".dhe\" %i;\n", dhe);
+		writeInt(mFile,"\tsetAttr \".dhe\" ",dhe,";\n");
 	}
 	void setCollisionOffsetVelocityIncrement(size_t covi_i,const CollisionOffsetVelocityIncrement& covi)
 	{
-		fprintf(mFile,"\tsetAttr \".covi[%i]\" ",covi_i);
+		writeInt(mFile,"\tsetAttr \".covi[",covi_i,"]\" ");
 		covi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionOffsetVelocityIncrement(size_t covi_start,size_t covi_end,CollisionOffsetVelocityIncrement* covi)
 	{
-		fprintf(mFile,"\tsetAttr \".covi[%i:%i]\" ", covi_start,covi_end);
+		writeInt(mFile,"\tsetAttr \".covi[",covi_start); writeInt(mFile,":",covi_end,"]\" ");
 		size_t size = (covi_end-covi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			covi[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCollisionOffsetVelocityIncrement(size_t covi_start,size_t covi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".covi[%i:%i]\"",covi_start,covi_end);
-		fprintf(mFile," -type \"CollisionOffsetVelocityIncrement\" ");
+		writeInt(mFile,"\tsetAttr \".covi[",covi_start); writeInt(mFile,":",covi_end,"]\"");
+		writeString(mFile," -type \"CollisionOffsetVelocityIncrement\" ");
 	}
 	void appendCollisionOffsetVelocityIncrement(const CollisionOffsetVelocityIncrement& covi)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		covi.write(mFile);
 	}
 	void endCollisionOffsetVelocityIncrement()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionOffsetVelocityIncrement_Position(size_t covi_i,float covip)
 	{
 		if(covip == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".covi[%i].covip\" %f;\n", covi_i,covip);
+		writeInt(mFile,"\tsetAttr \".covi[",covi_i); writeFloat(mFile,"].covip\" ",covip,";\n");
 	}
 	void setCollisionOffsetVelocityIncrement_FloatValue(size_t covi_i,float covifv)
 	{
 		if(covifv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".covi[%i].covifv\" %f;\n", covi_i,covifv);
+		writeInt(mFile,"\tsetAttr \".covi[",covi_i); writeFloat(mFile,"].covifv\" ",covifv,";\n");
 	}
 	void setCollisionOffsetVelocityIncrement_Interp(size_t covi_i,unsigned int covii)
 	{
 		if(covii == 0) return;
-		fprintf(mFile,"\tsetAttr \".covi[%i].covii\" %i;\n", covi_i,covii);
+		writeInt(mFile,"\tsetAttr \".covi[",covi_i); writeInt(mFile,"].covii\" ",covii,";\n");
 	}
 	void setCollisionDepthVelocityIncrement(size_t cdvi_i,const CollisionDepthVelocityIncrement& cdvi)
 	{
-		fprintf(mFile,"\tsetAttr \".cdvi[%i]\" ",cdvi_i);
+		writeInt(mFile,"\tsetAttr \".cdvi[",cdvi_i,"]\" ");
 		cdvi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionDepthVelocityIncrement(size_t cdvi_start,size_t cdvi_end,CollisionDepthVelocityIncrement* cdvi)
 	{
-		fprintf(mFile,"\tsetAttr \".cdvi[%i:%i]\" ", cdvi_start,cdvi_end);
+		writeInt(mFile,"\tsetAttr \".cdvi[",cdvi_start); writeInt(mFile,":",cdvi_end,"]\" ");
 		size_t size = (cdvi_end-cdvi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cdvi[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCollisionDepthVelocityIncrement(size_t cdvi_start,size_t cdvi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cdvi[%i:%i]\"",cdvi_start,cdvi_end);
-		fprintf(mFile," -type \"CollisionDepthVelocityIncrement\" ");
+		writeInt(mFile,"\tsetAttr \".cdvi[",cdvi_start); writeInt(mFile,":",cdvi_end,"]\"");
+		writeString(mFile," -type \"CollisionDepthVelocityIncrement\" ");
 	}
 	void appendCollisionDepthVelocityIncrement(const CollisionDepthVelocityIncrement& cdvi)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cdvi.write(mFile);
 	}
 	void endCollisionDepthVelocityIncrement()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionDepthVelocityIncrement_Position(size_t cdvi_i,float cdvip)
 	{
 		if(cdvip == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cdvi[%i].cdvip\" %f;\n", cdvi_i,cdvip);
+		writeInt(mFile,"\tsetAttr \".cdvi[",cdvi_i); writeFloat(mFile,"].cdvip\" ",cdvip,";\n");
 	}
 	void setCollisionDepthVelocityIncrement_FloatValue(size_t cdvi_i,float cdvifv)
 	{
 		if(cdvifv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cdvi[%i].cdvifv\" %f;\n", cdvi_i,cdvifv);
+		writeInt(mFile,"\tsetAttr \".cdvi[",cdvi_i); writeFloat(mFile,"].cdvifv\" ",cdvifv,";\n");
 	}
 	void setCollisionDepthVelocityIncrement_Interp(size_t cdvi_i,unsigned int cdvii)
 	{
 		if(cdvii == 0) return;
-		fprintf(mFile,"\tsetAttr \".cdvi[%i].cdvii\" %i;\n", cdvi_i,cdvii);
+		writeInt(mFile,"\tsetAttr \".cdvi[",cdvi_i); writeInt(mFile,"].cdvii\" ",cdvii,";\n");
 	}
 	void setCollisionOffsetVelocityMultiplier(size_t covm_i,const CollisionOffsetVelocityMultiplier& covm)
 	{
-		fprintf(mFile,"\tsetAttr \".covm[%i]\" ",covm_i);
+		writeInt(mFile,"\tsetAttr \".covm[",covm_i,"]\" ");
 		covm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionOffsetVelocityMultiplier(size_t covm_start,size_t covm_end,CollisionOffsetVelocityMultiplier* covm)
 	{
-		fprintf(mFile,"\tsetAttr \".covm[%i:%i]\" ", covm_start,covm_end);
+		writeInt(mFile,"\tsetAttr \".covm[",covm_start); writeInt(mFile,":",covm_end,"]\" ");
 		size_t size = (covm_end-covm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			covm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCollisionOffsetVelocityMultiplier(size_t covm_start,size_t covm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".covm[%i:%i]\"",covm_start,covm_end);
-		fprintf(mFile," -type \"CollisionOffsetVelocityMultiplier\" ");
+		writeInt(mFile,"\tsetAttr \".covm[",covm_start); writeInt(mFile,":",covm_end,"]\"");
+		writeString(mFile," -type \"CollisionOffsetVelocityMultiplier\" ");
 	}
 	void appendCollisionOffsetVelocityMultiplier(const CollisionOffsetVelocityMultiplier& covm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		covm.write(mFile);
 	}
 	void endCollisionOffsetVelocityMultiplier()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionOffsetVelocityMultiplier_Position(size_t covm_i,float covmp)
 	{
 		if(covmp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".covm[%i].covmp\" %f;\n", covm_i,covmp);
+		writeInt(mFile,"\tsetAttr \".covm[",covm_i); writeFloat(mFile,"].covmp\" ",covmp,";\n");
 	}
 	void setCollisionOffsetVelocityMultiplier_FloatValue(size_t covm_i,float covmfv)
 	{
 		if(covmfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".covm[%i].covmfv\" %f;\n", covm_i,covmfv);
+		writeInt(mFile,"\tsetAttr \".covm[",covm_i); writeFloat(mFile,"].covmfv\" ",covmfv,";\n");
 	}
 	void setCollisionOffsetVelocityMultiplier_Interp(size_t covm_i,unsigned int covmi)
 	{
 		if(covmi == 0) return;
-		fprintf(mFile,"\tsetAttr \".covm[%i].covmi\" %i;\n", covm_i,covmi);
+		writeInt(mFile,"\tsetAttr \".covm[",covm_i); writeInt(mFile,"].covmi\" ",covmi,";\n");
 	}
 	void setCollisionDepthVelocityMultiplier(size_t cdvm_i,const CollisionDepthVelocityMultiplier& cdvm)
 	{
-		fprintf(mFile,"\tsetAttr \".cdvm[%i]\" ",cdvm_i);
+		writeInt(mFile,"\tsetAttr \".cdvm[",cdvm_i,"]\" ");
 		cdvm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionDepthVelocityMultiplier(size_t cdvm_start,size_t cdvm_end,CollisionDepthVelocityMultiplier* cdvm)
 	{
-		fprintf(mFile,"\tsetAttr \".cdvm[%i:%i]\" ", cdvm_start,cdvm_end);
+		writeInt(mFile,"\tsetAttr \".cdvm[",cdvm_start); writeInt(mFile,":",cdvm_end,"]\" ");
 		size_t size = (cdvm_end-cdvm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			cdvm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startCollisionDepthVelocityMultiplier(size_t cdvm_start,size_t cdvm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".cdvm[%i:%i]\"",cdvm_start,cdvm_end);
-		fprintf(mFile," -type \"CollisionDepthVelocityMultiplier\" ");
+		writeInt(mFile,"\tsetAttr \".cdvm[",cdvm_start); writeInt(mFile,":",cdvm_end,"]\"");
+		writeString(mFile," -type \"CollisionDepthVelocityMultiplier\" ");
 	}
 	void appendCollisionDepthVelocityMultiplier(const CollisionDepthVelocityMultiplier& cdvm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		cdvm.write(mFile);
 	}
 	void endCollisionDepthVelocityMultiplier()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCollisionDepthVelocityMultiplier_Position(size_t cdvm_i,float cdvmp)
 	{
 		if(cdvmp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cdvm[%i].cdvmp\" %f;\n", cdvm_i,cdvmp);
+		writeInt(mFile,"\tsetAttr \".cdvm[",cdvm_i); writeFloat(mFile,"].cdvmp\" ",cdvmp,";\n");
 	}
 	void setCollisionDepthVelocityMultiplier_FloatValue(size_t cdvm_i,float cdvmfv)
 	{
 		if(cdvmfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cdvm[%i].cdvmfv\" %f;\n", cdvm_i,cdvmfv);
+		writeInt(mFile,"\tsetAttr \".cdvm[",cdvm_i); writeFloat(mFile,"].cdvmfv\" ",cdvmfv,";\n");
 	}
 	void setCollisionDepthVelocityMultiplier_Interp(size_t cdvm_i,unsigned int cdvmi)
 	{
 		if(cdvmi == 0) return;
-		fprintf(mFile,"\tsetAttr \".cdvm[%i].cdvmi\" %i;\n", cdvm_i,cdvmi);
+		writeInt(mFile,"\tsetAttr \".cdvm[",cdvm_i); writeInt(mFile,"].cdvmi\" ",cdvmi,";\n");
 	}
 	void getIgnoreHwShader()const
 	{
-		fprintf(mFile,"\"%s.ih\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ih\"");
 	}
 	void getDoubleSided()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 	void getOpposite()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getSmoothShading()const
 	{
-		fprintf(mFile,"\"%s.smo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smo\"");
 	}
 	void getBoundingBoxScale()const
 	{
-		fprintf(mFile,"\"%s.bbs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bbs\"");
 	}
 	void getBoundingBoxScaleX()const
 	{
-		fprintf(mFile,"\"%s.bbs.bscx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bbs.bscx\"");
 	}
 	void getBoundingBoxScaleY()const
 	{
-		fprintf(mFile,"\"%s.bbs.bscy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bbs.bscy\"");
 	}
 	void getBoundingBoxScaleZ()const
 	{
-		fprintf(mFile,"\"%s.bbs.bscz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bbs.bscz\"");
 	}
 	void getFeatureDisplacement()const
 	{
-		fprintf(mFile,"\"%s.fbda\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fbda\"");
 	}
 	void getInitialSampleRate()const
 	{
-		fprintf(mFile,"\"%s.dsr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsr\"");
 	}
 	void getExtraSampleRate()const
 	{
-		fprintf(mFile,"\"%s.xsr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xsr\"");
 	}
 	void getTextureThreshold()const
 	{
-		fprintf(mFile,"\"%s.fth\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fth\"");
 	}
 	void getNormalThreshold()const
 	{
-		fprintf(mFile,"\"%s.nat\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nat\"");
 	}
 	void getDisplayHWEnvironment()const
 	{
-		fprintf(mFile,"\"%s.dhe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dhe\"");
 	}
 	void getCollisionOffsetVelocityIncrement(size_t covi_i)const
 	{
-		fprintf(mFile,"\"%s.covi[%i]\"",mName.c_str(),covi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".covi[",covi_i,"]\"");
 	}
 	void getCollisionOffsetVelocityIncrement()const
 	{
 
-		fprintf(mFile,"\"%s.covi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".covi\"");
 	}
 	void getCollisionOffsetVelocityIncrement_Position(size_t covi_i)const
 	{
-		fprintf(mFile,"\"%s.covi[%i].covip\"",mName.c_str(),covi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".covi[",covi_i,"].covip\"");
 	}
 	void getCollisionOffsetVelocityIncrement_Position()const
 	{
 
-		fprintf(mFile,"\"%s.covi.covip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".covi.covip\"");
 	}
 	void getCollisionOffsetVelocityIncrement_FloatValue(size_t covi_i)const
 	{
-		fprintf(mFile,"\"%s.covi[%i].covifv\"",mName.c_str(),covi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".covi[",covi_i,"].covifv\"");
 	}
 	void getCollisionOffsetVelocityIncrement_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.covi.covifv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".covi.covifv\"");
 	}
 	void getCollisionOffsetVelocityIncrement_Interp(size_t covi_i)const
 	{
-		fprintf(mFile,"\"%s.covi[%i].covii\"",mName.c_str(),covi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".covi[",covi_i,"].covii\"");
 	}
 	void getCollisionOffsetVelocityIncrement_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.covi.covii\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".covi.covii\"");
 	}
 	void getCollisionDepthVelocityIncrement(size_t cdvi_i)const
 	{
-		fprintf(mFile,"\"%s.cdvi[%i]\"",mName.c_str(),cdvi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdvi[",cdvi_i,"]\"");
 	}
 	void getCollisionDepthVelocityIncrement()const
 	{
 
-		fprintf(mFile,"\"%s.cdvi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdvi\"");
 	}
 	void getCollisionDepthVelocityIncrement_Position(size_t cdvi_i)const
 	{
-		fprintf(mFile,"\"%s.cdvi[%i].cdvip\"",mName.c_str(),cdvi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdvi[",cdvi_i,"].cdvip\"");
 	}
 	void getCollisionDepthVelocityIncrement_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cdvi.cdvip\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdvi.cdvip\"");
 	}
 	void getCollisionDepthVelocityIncrement_FloatValue(size_t cdvi_i)const
 	{
-		fprintf(mFile,"\"%s.cdvi[%i].cdvifv\"",mName.c_str(),cdvi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdvi[",cdvi_i,"].cdvifv\"");
 	}
 	void getCollisionDepthVelocityIncrement_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.cdvi.cdvifv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdvi.cdvifv\"");
 	}
 	void getCollisionDepthVelocityIncrement_Interp(size_t cdvi_i)const
 	{
-		fprintf(mFile,"\"%s.cdvi[%i].cdvii\"",mName.c_str(),cdvi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdvi[",cdvi_i,"].cdvii\"");
 	}
 	void getCollisionDepthVelocityIncrement_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cdvi.cdvii\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdvi.cdvii\"");
 	}
 	void getCollisionOffsetVelocityMultiplier(size_t covm_i)const
 	{
-		fprintf(mFile,"\"%s.covm[%i]\"",mName.c_str(),covm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".covm[",covm_i,"]\"");
 	}
 	void getCollisionOffsetVelocityMultiplier()const
 	{
 
-		fprintf(mFile,"\"%s.covm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".covm\"");
 	}
 	void getCollisionOffsetVelocityMultiplier_Position(size_t covm_i)const
 	{
-		fprintf(mFile,"\"%s.covm[%i].covmp\"",mName.c_str(),covm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".covm[",covm_i,"].covmp\"");
 	}
 	void getCollisionOffsetVelocityMultiplier_Position()const
 	{
 
-		fprintf(mFile,"\"%s.covm.covmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".covm.covmp\"");
 	}
 	void getCollisionOffsetVelocityMultiplier_FloatValue(size_t covm_i)const
 	{
-		fprintf(mFile,"\"%s.covm[%i].covmfv\"",mName.c_str(),covm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".covm[",covm_i,"].covmfv\"");
 	}
 	void getCollisionOffsetVelocityMultiplier_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.covm.covmfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".covm.covmfv\"");
 	}
 	void getCollisionOffsetVelocityMultiplier_Interp(size_t covm_i)const
 	{
-		fprintf(mFile,"\"%s.covm[%i].covmi\"",mName.c_str(),covm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".covm[",covm_i,"].covmi\"");
 	}
 	void getCollisionOffsetVelocityMultiplier_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.covm.covmi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".covm.covmi\"");
 	}
 	void getCollisionDepthVelocityMultiplier(size_t cdvm_i)const
 	{
-		fprintf(mFile,"\"%s.cdvm[%i]\"",mName.c_str(),cdvm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdvm[",cdvm_i,"]\"");
 	}
 	void getCollisionDepthVelocityMultiplier()const
 	{
 
-		fprintf(mFile,"\"%s.cdvm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdvm\"");
 	}
 	void getCollisionDepthVelocityMultiplier_Position(size_t cdvm_i)const
 	{
-		fprintf(mFile,"\"%s.cdvm[%i].cdvmp\"",mName.c_str(),cdvm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdvm[",cdvm_i,"].cdvmp\"");
 	}
 	void getCollisionDepthVelocityMultiplier_Position()const
 	{
 
-		fprintf(mFile,"\"%s.cdvm.cdvmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdvm.cdvmp\"");
 	}
 	void getCollisionDepthVelocityMultiplier_FloatValue(size_t cdvm_i)const
 	{
-		fprintf(mFile,"\"%s.cdvm[%i].cdvmfv\"",mName.c_str(),cdvm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdvm[",cdvm_i,"].cdvmfv\"");
 	}
 	void getCollisionDepthVelocityMultiplier_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.cdvm.cdvmfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdvm.cdvmfv\"");
 	}
 	void getCollisionDepthVelocityMultiplier_Interp(size_t cdvm_i)const
 	{
-		fprintf(mFile,"\"%s.cdvm[%i].cdvmi\"",mName.c_str(),cdvm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".cdvm[",cdvm_i,"].cdvmi\"");
 	}
 	void getCollisionDepthVelocityMultiplier_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.cdvm.cdvmi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cdvm.cdvmi\"");
 	}
 protected:
 	SurfaceShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
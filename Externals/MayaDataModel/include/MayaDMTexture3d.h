@@ -27,269 +27,269 @@ public:
 	void setFilter(float f)
 	{
 		if(f == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".f\" %f;\n", f);
+		writeFloat(mFile,"\tsetAttr \".f\" ",f,";\n");
 	}
 	void setFilterOffset(float fo)
 	{
 		if(fo == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fo\" %f;\n", fo);
+		writeFloat(mFile,"\tsetAttr \".fo\" ",fo,";\n");
 	}
 	void setBlend(float b)
 	{
 		if(b == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".b\" %f;\n", b);
+		writeFloat(mFile,"\tsetAttr \".b\" ",b,";\n");
 	}
 	void setLocal(bool lo)
 	{
 		if(lo == false) return;
-		fprintf(mFile,"\tsetAttr \".lo\" %i;\n", lo);
+		writeInt(mFile,"\tsetAttr \".lo\" ",lo,";\n");
 	}
 	void setWrap(bool w)
 	{
 		if(w == true) return;
-		fprintf(mFile,"\tsetAttr \".w\" %i;\n", w);
+		writeInt(mFile,"\tsetAttr \".w\" ",w,";\n");
 	}
 	void setInvert(bool i_)
 	{
 		if(i_ == false) return;
-		fprintf(mFile,"\tsetAttr \".i\" %i;\n", i_);
+		writeInt(mFile,"\tsetAttr \".i\" ",i_,";\n");
 	}
 	void setAlphaIsLuminance(bool ail)
 	{
 		if(ail == false) return;
-		fprintf(mFile,"\tsetAttr \".ail\" %i;\n", ail);
+		writeInt(mFile,"\tsetAttr \".ail\" ",ail,";\n");
 	}
 	void setColorGain(const float3& cg)
 	{
 		if(cg == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".cg\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cg\" -type \"float3\" ");
 		cg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorGainR(float cgr)
 	{
 		if(cgr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgr\" %f;\n", cgr);
+		writeFloat(mFile,"\tsetAttr \".cg.cgr\" ",cgr,";\n");
 	}
 	void setColorGainG(float cgg)
 	{
 		if(cgg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgg\" %f;\n", cgg);
+		writeFloat(mFile,"\tsetAttr \".cg.cgg\" ",cgg,";\n");
 	}
 	void setColorGainB(float cgb)
 	{
 		if(cgb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cg.cgb\" %f;\n", cgb);
+		writeFloat(mFile,"\tsetAttr \".cg.cgb\" ",cgb,";\n");
 	}
 	void setColorOffset(const float3& co)
 	{
 		if(co == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".co\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".co\" -type \"float3\" ");
 		co.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorOffsetR(float cor)
 	{
 		if(cor == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".co.cor\" %f;\n", cor);
+		writeFloat(mFile,"\tsetAttr \".co.cor\" ",cor,";\n");
 	}
 	void setColorOffsetG(float cog)
 	{
 		if(cog == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".co.cog\" %f;\n", cog);
+		writeFloat(mFile,"\tsetAttr \".co.cog\" ",cog,";\n");
 	}
 	void setColorOffsetB(float cob)
 	{
 		if(cob == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".co.cob\" %f;\n", cob);
+		writeFloat(mFile,"\tsetAttr \".co.cob\" ",cob,";\n");
 	}
 	void setAlphaGain(float ag)
 	{
 		if(ag == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ag\" %f;\n", ag);
+		writeFloat(mFile,"\tsetAttr \".ag\" ",ag,";\n");
 	}
 	void setAlphaOffset(float ao)
 	{
 		if(ao == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ao\" %f;\n", ao);
+		writeFloat(mFile,"\tsetAttr \".ao\" ",ao,";\n");
 	}
 	void setDefaultColor(const float3& dc)
 	{
 		if(dc == float3(0.5f,0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".dc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".dc\" -type \"float3\" ");
 		dc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDefaultColorR(float dcr)
 	{
 		if(dcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dc.dcr\" %f;\n", dcr);
+		writeFloat(mFile,"\tsetAttr \".dc.dcr\" ",dcr,";\n");
 	}
 	void setDefaultColorG(float dcg)
 	{
 		if(dcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dc.dcg\" %f;\n", dcg);
+		writeFloat(mFile,"\tsetAttr \".dc.dcg\" ",dcg,";\n");
 	}
 	void setDefaultColorB(float dcb)
 	{
 		if(dcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dc.dcb\" %f;\n", dcb);
+		writeFloat(mFile,"\tsetAttr \".dc.dcb\" ",dcb,";\n");
 	}
 	void getPointObj()const
 	{
-		fprintf(mFile,"\"%s.po\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po\"");
 	}
 	void getPointObjX()const
 	{
-		fprintf(mFile,"\"%s.po.pox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.pox\"");
 	}
 	void getPointObjY()const
 	{
-		fprintf(mFile,"\"%s.po.poy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poy\"");
 	}
 	void getPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.po.poz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poz\"");
 	}
 	void getPointCamera()const
 	{
-		fprintf(mFile,"\"%s.p\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p\"");
 	}
 	void getPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.p.px\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.px\"");
 	}
 	void getPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.p.py\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.py\"");
 	}
 	void getPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.p.pz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".p.pz\"");
 	}
 	void getFilterSize()const
 	{
-		fprintf(mFile,"\"%s.fs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs\"");
 	}
 	void getFilterSizeX()const
 	{
-		fprintf(mFile,"\"%s.fs.fsx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsx\"");
 	}
 	void getFilterSizeY()const
 	{
-		fprintf(mFile,"\"%s.fs.fsy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsy\"");
 	}
 	void getFilterSizeZ()const
 	{
-		fprintf(mFile,"\"%s.fs.fsz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fs.fsz\"");
 	}
 	void getPlacementMatrix()const
 	{
-		fprintf(mFile,"\"%s.pm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pm\"");
 	}
 	void getMatrixEyeToWorld()const
 	{
-		fprintf(mFile,"\"%s.e2w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".e2w\"");
 	}
 	void getFilter()const
 	{
-		fprintf(mFile,"\"%s.f\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".f\"");
 	}
 	void getFilterOffset()const
 	{
-		fprintf(mFile,"\"%s.fo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo\"");
 	}
 	void getBlend()const
 	{
-		fprintf(mFile,"\"%s.b\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".b\"");
 	}
 	void getWrap()const
 	{
-		fprintf(mFile,"\"%s.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".w\"");
 	}
 	void getInvert()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getAlphaIsLuminance()const
 	{
-		fprintf(mFile,"\"%s.ail\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ail\"");
 	}
 	void getColorGain()const
 	{
-		fprintf(mFile,"\"%s.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg\"");
 	}
 	void getColorGainR()const
 	{
-		fprintf(mFile,"\"%s.cg.cgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg.cgr\"");
 	}
 	void getColorGainG()const
 	{
-		fprintf(mFile,"\"%s.cg.cgg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg.cgg\"");
 	}
 	void getColorGainB()const
 	{
-		fprintf(mFile,"\"%s.cg.cgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cg.cgb\"");
 	}
 	void getColorOffset()const
 	{
-		fprintf(mFile,"\"%s.co\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co\"");
 	}
 	void getColorOffsetR()const
 	{
-		fprintf(mFile,"\"%s.co.cor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co.cor\"");
 	}
 	void getColorOffsetG()const
 	{
-		fprintf(mFile,"\"%s.co.cog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co.cog\"");
 	}
 	void getColorOffsetB()const
 	{
-		fprintf(mFile,"\"%s.co.cob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".co.cob\"");
 	}
 	void getAlphaGain()const
 	{
-		fprintf(mFile,"\"%s.ag\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ag\"");
 	}
 	void getAlphaOffset()const
 	{
-		fprintf(mFile,"\"%s.ao\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ao\"");
 	}
 	void getDefaultColor()const
 	{
-		fprintf(mFile,"\"%s.dc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc\"");
 	}
 	void getDefaultColorR()const
 	{
-		fprintf(mFile,"\"%s.dc.dcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc.dcr\"");
 	}
 	void getDefaultColorG()const
 	{
-		fprintf(mFile,"\"%s.dc.dcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc.dcg\"");
 	}
 	void getDefaultColorB()const
 	{
-		fprintf(mFile,"\"%s.dc.dcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dc.dcb\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutAlpha()const
 	{
-		fprintf(mFile,"\"%s.oa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oa\"");
 	}
 protected:
 	Texture3d(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,212 +27,212 @@ public:
 	void setSeparation(unsigned int sep)
 	{
 		if(sep == 0) return;
-		fprintf(mFile,"\tsetAttr \".sep\" %i;\n", sep);
+		writeInt(mFile,"\tsetAttr \".sep\" ",sep,";\n");
 	}
 	void setXResolution(int xres)
 	{
 		if(xres == 512) return;
-		fprintf(mFile,"\tsetAttr \".xres\" %i;\n", xres);
+		writeInt(mFile,"\tsetAttr \".xres\" ",xres,";\n");
 	}
 	void setYResolution(int yres)
 	{
 		if(yres == 512) return;
-		fprintf(mFile,"\tsetAttr \".yres\" %i;\n", yres);
+		writeInt(mFile,"\tsetAttr \".yres\" ",yres,";\n");
 	}
 	void setFileFormat(unsigned int format)
 	{
 		if(format == 0) return;
-		fprintf(mFile,"\tsetAttr \".format\" %i;\n", format);
+		writeInt(mFile,"\tsetAttr \".format\" ",format,";\n");
 	}
 	void setBitsPerChannel(unsigned int bits)
 	{
 		if(bits == 0) return;
-		fprintf(mFile,"\tsetAttr \".bits\" %i;\n", bits);
+		writeInt(mFile,"\tsetAttr \".bits\" ",bits,";\n");
 	}
 	void setOverrideUvSet(bool overrideuv)
 	{
 		if(overrideuv == 0) return;
-		fprintf(mFile,"\tsetAttr \".overrideuv\" %i;\n", overrideuv);
+		writeInt(mFile,"\tsetAttr \".overrideuv\" ",overrideuv,";\n");
 	}
 	void setUvSetName(const string& set)
 	{
 		if(set == "uvSet1") return;
-		fprintf(mFile,"\tsetAttr \".set\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".set\" -type \"string\" ");
 		set.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvRange(unsigned int range)
 	{
 		if(range == 0) return;
-		fprintf(mFile,"\tsetAttr \".range\" %i;\n", range);
+		writeInt(mFile,"\tsetAttr \".range\" ",range,";\n");
 	}
 	void setUMin(float ul)
 	{
 		if(ul == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".ul\" %f;\n", ul);
+		writeFloat(mFile,"\tsetAttr \".ul\" ",ul,";\n");
 	}
 	void setUMax(float uh)
 	{
 		if(uh == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".uh\" %f;\n", uh);
+		writeFloat(mFile,"\tsetAttr \".uh\" ",uh,";\n");
 	}
 	void setVMin(float vl)
 	{
 		if(vl == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".vl\" %f;\n", vl);
+		writeFloat(mFile,"\tsetAttr \".vl\" ",vl,";\n");
 	}
 	void setVMax(float vh)
 	{
 		if(vh == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".vh\" %f;\n", vh);
+		writeFloat(mFile,"\tsetAttr \".vh\" ",vh,";\n");
 	}
 	void setBackgroundMode(unsigned int bmode)
 	{
 		if(bmode == 0) return;
-		fprintf(mFile,"\tsetAttr \".bmode\" %i;\n", bmode);
+		writeInt(mFile,"\tsetAttr \".bmode\" ",bmode,";\n");
 	}
 	void setBackgroundColor(const float3& bgc)
 	{
 		if(bgc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".bgc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".bgc\" -type \"float3\" ");
 		bgc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBackgroundColorR(float bgr)
 	{
 		if(bgr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bgc.bgr\" %f;\n", bgr);
+		writeFloat(mFile,"\tsetAttr \".bgc.bgr\" ",bgr,";\n");
 	}
 	void setBackgroundColorG(float bgg)
 	{
 		if(bgg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bgc.bgg\" %f;\n", bgg);
+		writeFloat(mFile,"\tsetAttr \".bgc.bgg\" ",bgg,";\n");
 	}
 	void setBackgroundColorB(float bgb)
 	{
 		if(bgb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bgc.bgb\" %f;\n", bgb);
+		writeFloat(mFile,"\tsetAttr \".bgc.bgb\" ",bgb,";\n");
 	}
 	void setFillTextureSeams(float fillseams)
 	{
 		if(fillseams == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".fillseams\" %f;\n", fillseams);
+		writeFloat(mFile,"\tsetAttr \".fillseams\" ",fillseams,";\n");
 	}
 	void setFinalGatherQuality(float fgq)
 	{
 		if(fgq == 1) return;
-		fprintf(mFile,"\tsetAttr \".fgq\" %f;\n", fgq);
+		writeFloat(mFile,"\tsetAttr \".fgq\" ",fgq,";\n");
 	}
 	void setFinalGatherReflect(float fgr)
 	{
 		if(fgr == 0) return;
-		fprintf(mFile,"\tsetAttr \".fgr\" %f;\n", fgr);
+		writeFloat(mFile,"\tsetAttr \".fgr\" ",fgr,";\n");
 	}
 	void setBakeToOneMap(bool one)
 	{
 		if(one == 0) return;
-		fprintf(mFile,"\tsetAttr \".one\" %i;\n", one);
+		writeInt(mFile,"\tsetAttr \".one\" ",one,";\n");
 	}
 	void setSamples(int nsp)
 	{
 		if(nsp == 1) return;
-		fprintf(mFile,"\tsetAttr \".nsp\" %i;\n", nsp);
+		writeInt(mFile,"\tsetAttr \".nsp\" ",nsp,";\n");
 	}
 	void getSeparation()const
 	{
-		fprintf(mFile,"\"%s.sep\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sep\"");
 	}
 	void getPrefix()const
 	{
-		fprintf(mFile,"\"%s.pre\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pre\"");
 	}
 	void getXResolution()const
 	{
-		fprintf(mFile,"\"%s.xres\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xres\"");
 	}
 	void getYResolution()const
 	{
-		fprintf(mFile,"\"%s.yres\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".yres\"");
 	}
 	void getFileFormat()const
 	{
-		fprintf(mFile,"\"%s.format\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".format\"");
 	}
 	void getBitsPerChannel()const
 	{
-		fprintf(mFile,"\"%s.bits\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bits\"");
 	}
 	void getOverrideUvSet()const
 	{
-		fprintf(mFile,"\"%s.overrideuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".overrideuv\"");
 	}
 	void getUvSetName()const
 	{
-		fprintf(mFile,"\"%s.set\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".set\"");
 	}
 	void getUvRange()const
 	{
-		fprintf(mFile,"\"%s.range\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".range\"");
 	}
 	void getUMin()const
 	{
-		fprintf(mFile,"\"%s.ul\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ul\"");
 	}
 	void getUMax()const
 	{
-		fprintf(mFile,"\"%s.uh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uh\"");
 	}
 	void getVMin()const
 	{
-		fprintf(mFile,"\"%s.vl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl\"");
 	}
 	void getVMax()const
 	{
-		fprintf(mFile,"\"%s.vh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vh\"");
 	}
 	void getBackgroundMode()const
 	{
-		fprintf(mFile,"\"%s.bmode\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmode\"");
 	}
 	void getBackgroundColor()const
 	{
-		fprintf(mFile,"\"%s.bgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bgc\"");
 	}
 	void getBackgroundColorR()const
 	{
-		fprintf(mFile,"\"%s.bgc.bgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bgc.bgr\"");
 	}
 	void getBackgroundColorG()const
 	{
-		fprintf(mFile,"\"%s.bgc.bgg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bgc.bgg\"");
 	}
 	void getBackgroundColorB()const
 	{
-		fprintf(mFile,"\"%s.bgc.bgb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bgc.bgb\"");
 	}
 	void getFillTextureSeams()const
 	{
-		fprintf(mFile,"\"%s.fillseams\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fillseams\"");
 	}
 	void getFillScale()const
 	{
-		fprintf(mFile,"\"%s.fillscale\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fillscale\"");
 	}
 	void getFinalGatherQuality()const
 	{
-		fprintf(mFile,"\"%s.fgq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fgq\"");
 	}
 	void getFinalGatherReflect()const
 	{
-		fprintf(mFile,"\"%s.fgr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fgr\"");
 	}
 	void getBakeToOneMap()const
 	{
-		fprintf(mFile,"\"%s.one\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".one\"");
 	}
 	void getSamples()const
 	{
-		fprintf(mFile,"\"%s.nsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nsp\"");
 	}
 protected:
 	TextureBakeSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
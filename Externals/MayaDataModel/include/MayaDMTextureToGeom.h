@@ -32,306 +32,306 @@ public:
 	void setSegGroupIds(size_t sgi_i,int sgi)
 	{
 		if(sgi == -1) return;
-		fprintf(mFile,"\tsetAttr \".sgi[%i]\" %i;\n", sgi_i,sgi);
+		writeInt(mFile,"\tsetAttr \".sgi[",sgi_i); writeInt(mFile,"]\" ",sgi,";\n");
 	}
 	void setSegGroupIds(size_t sgi_start,size_t sgi_end,int* sgi)
 	{
-		fprintf(mFile,"\tsetAttr \".sgi[%i:%i]\" ", sgi_start,sgi_end);
+		writeInt(mFile,"\tsetAttr \".sgi[",sgi_start); writeInt(mFile,":",sgi_end,"]\" ");
 		size_t size = (sgi_end-sgi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",sgi[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeInt(mFile,"",sgi[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startSegGroupIds(size_t sgi_start,size_t sgi_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".sgi[%i:%i]\"",sgi_start,sgi_end);
+		writeInt(mFile,"\tsetAttr \".sgi[",sgi_start); writeInt(mFile,":",sgi_end,"]\"");
 	}
 	void appendSegGroupIds(int sgi)const
 	{
-		fprintf(mFile," %i",sgi);
+		writeInt(mFile," ",sgi);
 	}
 	void endSegGroupIds()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputMesh(const mesh& im)
 	{
-		fprintf(mFile,"\tsetAttr \".im\" -type \"mesh\" ");
+		writeString(mFile,"\tsetAttr \".im\" -type \"mesh\" ");
 		im.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInputMeshUVSet(const string& iuv)
 	{
 		if(iuv == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".iuv\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".iuv\" -type \"string\" ");
 		iuv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setQuantize(bool qut)
 	{
 		if(qut == 0) return;
-		fprintf(mFile,"\tsetAttr \".qut\" %i;\n", qut);
+		writeInt(mFile,"\tsetAttr \".qut\" ",qut,";\n");
 	}
 	void setQuantizeLevels(unsigned char qutl)
 	{
 		if(qutl == 10) return;
-		fprintf(mFile,"\tsetAttr \".qutl\" %i;\n", qutl);
+		writeInt(mFile,"\tsetAttr \".qutl\" ",qutl,";\n");
 	}
 	void setMaxColorDiff(float mcd)
 	{
 		if(mcd == 0.125) return;
-		fprintf(mFile,"\tsetAttr \".mcd\" %f;\n", mcd);
+		writeFloat(mFile,"\tsetAttr \".mcd\" ",mcd,";\n");
 	}
 	void setMinSegmentSize(float msz)
 	{
 		if(msz == 0.005) return;
-		fprintf(mFile,"\tsetAttr \".msz\" %f;\n", msz);
+		writeFloat(mFile,"\tsetAttr \".msz\" ",msz,";\n");
 	}
 	void setSpatialRadius(int spr)
 	{
 		if(spr == 7) return;
-		fprintf(mFile,"\tsetAttr \".spr\" %i;\n", spr);
+		writeInt(mFile,"\tsetAttr \".spr\" ",spr,";\n");
 	}
 	void setColorRange(float crng)
 	{
 		if(crng == 4.5) return;
-		fprintf(mFile,"\tsetAttr \".crng\" %f;\n", crng);
+		writeFloat(mFile,"\tsetAttr \".crng\" ",crng,";\n");
 	}
 	void setImageFile(const string& if_)
 	{
 		if(if_ == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".if\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".if\" -type \"string\" ");
 		if_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMeshQuality(double mq)
 	{
 		if(mq == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".mq\" %f;\n", mq);
+		writeFloat(mFile,"\tsetAttr \".mq\" ",mq,";\n");
 	}
 	void setSurfaceOffset(float so)
 	{
 		if(so == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".so\" %f;\n", so);
+		writeFloat(mFile,"\tsetAttr \".so\" ",so,";\n");
 	}
 	void setSmoothBoundary(bool smbd)
 	{
 		if(smbd == 1) return;
-		fprintf(mFile,"\tsetAttr \".smbd\" %i;\n", smbd);
+		writeInt(mFile,"\tsetAttr \".smbd\" ",smbd,";\n");
 	}
 	void setSmoothFactor(float smf)
 	{
 		if(smf == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".smf\" %f;\n", smf);
+		writeFloat(mFile,"\tsetAttr \".smf\" ",smf,";\n");
 	}
 	void setFitTolerance(float ft)
 	{
 		if(ft == 0.007) return;
-		fprintf(mFile,"\tsetAttr \".ft\" %f;\n", ft);
+		writeFloat(mFile,"\tsetAttr \".ft\" ",ft,";\n");
 	}
 	void setHardCornerDetect(bool hcd)
 	{
 		if(hcd == 1) return;
-		fprintf(mFile,"\tsetAttr \".hcd\" %i;\n", hcd);
+		writeInt(mFile,"\tsetAttr \".hcd\" ",hcd,";\n");
 	}
 	void setHardCornerMaxLength(float hcml)
 	{
 		if(hcml == 10.0) return;
-		fprintf(mFile,"\tsetAttr \".hcml\" %f;\n", hcml);
+		writeFloat(mFile,"\tsetAttr \".hcml\" ",hcml,";\n");
 	}
 	void setSimplifyBoundary(bool smpl)
 	{
 		if(smpl == 1) return;
-		fprintf(mFile,"\tsetAttr \".smpl\" %i;\n", smpl);
+		writeInt(mFile,"\tsetAttr \".smpl\" ",smpl,";\n");
 	}
 	void setSimplifyThreshold(double smpt)
 	{
 		if(smpt == 0) return;
-		fprintf(mFile,"\tsetAttr \".smpt\" %f;\n", smpt);
+		writeFloat(mFile,"\tsetAttr \".smpt\" ",smpt,";\n");
 	}
 	void setPointsOnBoundary(bool pob)
 	{
 		if(pob == 0) return;
-		fprintf(mFile,"\tsetAttr \".pob\" %i;\n", pob);
+		writeInt(mFile,"\tsetAttr \".pob\" ",pob,";\n");
 	}
 	void setMaxPointsAdded(int mpa)
 	{
 		if(mpa == 0) return;
-		fprintf(mFile,"\tsetAttr \".mpa\" %i;\n", mpa);
+		writeInt(mFile,"\tsetAttr \".mpa\" ",mpa,";\n");
 	}
 	void setShaderScript(const string& shs)
 	{
 		if(shs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".shs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".shs\" -type \"string\" ");
 		shs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getSegmentCount()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.out\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".out\"");
 	}
 	void getOutColorData(size_t ocd_i)const
 	{
-		fprintf(mFile,"\"%s.ocd[%i]\"",mName.c_str(),ocd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ocd[",ocd_i,"]\"");
 	}
 	void getOutColorData()const
 	{
 
-		fprintf(mFile,"\"%s.ocd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd\"");
 	}
 	void getOutColor(size_t ocd_i)const
 	{
-		fprintf(mFile,"\"%s.ocd[%i].oc\"",mName.c_str(),ocd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ocd[",ocd_i,"].oc\"");
 	}
 	void getOutColor()const
 	{
 
-		fprintf(mFile,"\"%s.ocd.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.oc\"");
 	}
 	void getOutColorR(size_t ocd_i)const
 	{
-		fprintf(mFile,"\"%s.ocd[%i].oc.ocr\"",mName.c_str(),ocd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ocd[",ocd_i,"].oc.ocr\"");
 	}
 	void getOutColorR()const
 	{
 
-		fprintf(mFile,"\"%s.ocd.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.oc.ocr\"");
 	}
 	void getOutColorG(size_t ocd_i)const
 	{
-		fprintf(mFile,"\"%s.ocd[%i].oc.ocg\"",mName.c_str(),ocd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ocd[",ocd_i,"].oc.ocg\"");
 	}
 	void getOutColorG()const
 	{
 
-		fprintf(mFile,"\"%s.ocd.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.oc.ocg\"");
 	}
 	void getOutColorB(size_t ocd_i)const
 	{
-		fprintf(mFile,"\"%s.ocd[%i].oc.ocb\"",mName.c_str(),ocd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ocd[",ocd_i,"].oc.ocb\"");
 	}
 	void getOutColorB()const
 	{
 
-		fprintf(mFile,"\"%s.ocd.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.oc.ocb\"");
 	}
 	void getOutAlpha(size_t ocd_i)const
 	{
-		fprintf(mFile,"\"%s.ocd[%i].oa\"",mName.c_str(),ocd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ocd[",ocd_i,"].oa\"");
 	}
 	void getOutAlpha()const
 	{
 
-		fprintf(mFile,"\"%s.ocd.oa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ocd.oa\"");
 	}
 	void getOutSegFace(size_t ofm_i)const
 	{
-		fprintf(mFile,"\"%s.ofm[%i]\"",mName.c_str(),ofm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ofm[",ofm_i,"]\"");
 	}
 	void getOutSegFace()const
 	{
 
-		fprintf(mFile,"\"%s.ofm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ofm\"");
 	}
 	void getSegGroupIds(size_t sgi_i)const
 	{
-		fprintf(mFile,"\"%s.sgi[%i]\"",mName.c_str(),sgi_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".sgi[",sgi_i,"]\"");
 	}
 	void getSegGroupIds()const
 	{
 
-		fprintf(mFile,"\"%s.sgi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sgi\"");
 	}
 	void getInputMesh()const
 	{
-		fprintf(mFile,"\"%s.im\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".im\"");
 	}
 	void getInputMeshUVSet()const
 	{
-		fprintf(mFile,"\"%s.iuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".iuv\"");
 	}
 	void getQuantize()const
 	{
-		fprintf(mFile,"\"%s.qut\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".qut\"");
 	}
 	void getQuantizeLevels()const
 	{
-		fprintf(mFile,"\"%s.qutl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".qutl\"");
 	}
 	void getMaxColorDiff()const
 	{
-		fprintf(mFile,"\"%s.mcd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mcd\"");
 	}
 	void getMinSegmentSize()const
 	{
-		fprintf(mFile,"\"%s.msz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".msz\"");
 	}
 	void getSpatialRadius()const
 	{
-		fprintf(mFile,"\"%s.spr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spr\"");
 	}
 	void getColorRange()const
 	{
-		fprintf(mFile,"\"%s.crng\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crng\"");
 	}
 	void getImageFile()const
 	{
-		fprintf(mFile,"\"%s.if\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".if\"");
 	}
 	void getMeshQuality()const
 	{
-		fprintf(mFile,"\"%s.mq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mq\"");
 	}
 	void getSurfaceOffset()const
 	{
-		fprintf(mFile,"\"%s.so\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".so\"");
 	}
 	void getSmoothBoundary()const
 	{
-		fprintf(mFile,"\"%s.smbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smbd\"");
 	}
 	void getSmoothFactor()const
 	{
-		fprintf(mFile,"\"%s.smf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smf\"");
 	}
 	void getFitTolerance()const
 	{
-		fprintf(mFile,"\"%s.ft\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ft\"");
 	}
 	void getHardCornerDetect()const
 	{
-		fprintf(mFile,"\"%s.hcd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcd\"");
 	}
 	void getHardCornerMaxLength()const
 	{
-		fprintf(mFile,"\"%s.hcml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hcml\"");
 	}
 	void getSimplifyBoundary()const
 	{
-		fprintf(mFile,"\"%s.smpl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smpl\"");
 	}
 	void getSimplifyThreshold()const
 	{
-		fprintf(mFile,"\"%s.smpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smpt\"");
 	}
 	void getPointsOnBoundary()const
 	{
-		fprintf(mFile,"\"%s.pob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pob\"");
 	}
 	void getMaxPointsAdded()const
 	{
-		fprintf(mFile,"\"%s.mpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mpa\"");
 	}
 	void getShaderScript()const
 	{
-		fprintf(mFile,"\"%s.shs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shs\"");
 	}
 protected:
 	TextureToGeom(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
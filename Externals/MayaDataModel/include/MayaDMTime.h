@@ -27,11 +27,11 @@ public:
 	void setOutTime(double o)
 	{
 		if(o == 0) return;
-		fprintf(mFile,"\tsetAttr \".o\" %f;\n", o);
+		writeFloat(mFile,"\tsetAttr \".o\" ",o,";\n");
 	}
 	void getOutTime()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	Time(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
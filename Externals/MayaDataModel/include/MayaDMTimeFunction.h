@@ -27,15 +27,15 @@ public:
 	void setInput(double i_)
 	{
 		if(i_ == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i\" %f;\n", i_);
+		writeFloat(mFile,"\tsetAttr \".i\" ",i_,";\n");
 	}
 	void getInput()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	TimeFunction(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
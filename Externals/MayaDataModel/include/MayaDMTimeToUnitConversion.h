@@ -27,20 +27,20 @@ public:
 	void setInput(double i_)
 	{
 		if(i_ == 0) return;
-		fprintf(mFile,"\tsetAttr \".i\" %f;\n", i_);
+		writeFloat(mFile,"\tsetAttr \".i\" ",i_,";\n");
 	}
 	void setConversionFactor(double cf)
 	{
 		if(cf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cf\" %f;\n", cf);
+		writeFloat(mFile,"\tsetAttr \".cf\" ",cf,";\n");
 	}
 	void getInput()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	TimeToUnitConversion(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
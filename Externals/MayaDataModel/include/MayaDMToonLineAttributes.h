@@ -27,29 +27,29 @@ public:
 	void setLineWidth(float lwd)
 	{
 		if(lwd == 1) return;
-		fprintf(mFile,"\tsetAttr \".lwd\" %f;\n", lwd);
+		writeFloat(mFile,"\tsetAttr \".lwd\" ",lwd,";\n");
 	}
 	void setLineVisibility(bool lv)
 	{
 		if(lv == true) return;
-		fprintf(mFile,"\tsetAttr \".lv\" %i;\n", lv);
+		writeInt(mFile,"\tsetAttr \".lv\" ",lv,";\n");
 	}
 	void setViewUpdate(unsigned int vu)
 	{
 		if(vu == 1) return;
-		fprintf(mFile,"\tsetAttr \".vu\" %i;\n", vu);
+		writeInt(mFile,"\tsetAttr \".vu\" ",vu,";\n");
 	}
 	void getLineWidth()const
 	{
-		fprintf(mFile,"\"%s.lwd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lwd\"");
 	}
 	void getLineVisibility()const
 	{
-		fprintf(mFile,"\"%s.lv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lv\"");
 	}
 	void getViewUpdate()const
 	{
-		fprintf(mFile,"\"%s.vu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vu\"");
 	}
 protected:
 	ToonLineAttributes(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,205 +27,205 @@ public:
 	void setTransferPositions(unsigned int pos)
 	{
 		if(pos == 0) return;
-		fprintf(mFile,"\tsetAttr \".pos\" %i;\n", pos);
+		writeInt(mFile,"\tsetAttr \".pos\" ",pos,";\n");
 	}
 	void setTransferNormals(unsigned int nml)
 	{
 		if(nml == 0) return;
-		fprintf(mFile,"\tsetAttr \".nml\" %i;\n", nml);
+		writeInt(mFile,"\tsetAttr \".nml\" ",nml,";\n");
 	}
 	void setTransferUVs(unsigned int uvs)
 	{
 		if(uvs == 0) return;
-		fprintf(mFile,"\tsetAttr \".uvs\" %i;\n", uvs);
+		writeInt(mFile,"\tsetAttr \".uvs\" ",uvs,";\n");
 	}
 	void setSourceUVSet(const string& suv)
 	{
 		if(suv == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".suv\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".suv\" -type \"string\" ");
 		suv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetUVSet(const string& tuv)
 	{
 		if(tuv == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".tuv\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".tuv\" -type \"string\" ");
 		tuv.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransferColors(unsigned int col)
 	{
 		if(col == 0) return;
-		fprintf(mFile,"\tsetAttr \".col\" %i;\n", col);
+		writeInt(mFile,"\tsetAttr \".col\" ",col,";\n");
 	}
 	void setSourceColorSet(const string& scs)
 	{
 		if(scs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".scs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".scs\" -type \"string\" ");
 		scs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetColorSet(const string& tcs)
 	{
 		if(tcs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".tcs\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".tcs\" -type \"string\" ");
 		tcs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSampleSpace(unsigned int spa)
 	{
 		if(spa == 0) return;
-		fprintf(mFile,"\tsetAttr \".spa\" %i;\n", spa);
+		writeInt(mFile,"\tsetAttr \".spa\" ",spa,";\n");
 	}
 	void setSourceUVSpace(const string& sus)
 	{
 		if(sus == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".sus\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".sus\" -type \"string\" ");
 		sus.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTargetUVSpace(const string& tus)
 	{
 		if(tus == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".tus\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".tus\" -type \"string\" ");
 		tus.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSearchMethod(unsigned int mtd)
 	{
 		if(mtd == 1) return;
-		fprintf(mFile,"\tsetAttr \".mtd\" %i;\n", mtd);
+		writeInt(mFile,"\tsetAttr \".mtd\" ",mtd,";\n");
 	}
 	void setSearchDistance(double dis)
 	{
 		if(dis == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dis\" %f;\n", dis);
+		writeFloat(mFile,"\tsetAttr \".dis\" ",dis,";\n");
 	}
 	void setSearchTolerance(double tol)
 	{
 		if(tol == 1.3) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void setSearchScale(const double3& ss)
 	{
 		if(ss == double3(1.0, 1.0, 1.0)) return;
-		fprintf(mFile,"\tsetAttr \".ss\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ss\" -type \"double3\" ");
 		ss.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSearchScaleX(double ssx)
 	{
 		if(ssx == 0) return;
-		fprintf(mFile,"\tsetAttr \".ss.ssx\" %f;\n", ssx);
+		writeFloat(mFile,"\tsetAttr \".ss.ssx\" ",ssx,";\n");
 	}
 	void setSearchScaleY(double ssy)
 	{
 		if(ssy == 0) return;
-		fprintf(mFile,"\tsetAttr \".ss.ssy\" %f;\n", ssy);
+		writeFloat(mFile,"\tsetAttr \".ss.ssy\" ",ssy,";\n");
 	}
 	void setSearchScaleZ(double ssz)
 	{
 		if(ssz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ss.ssz\" %f;\n", ssz);
+		writeFloat(mFile,"\tsetAttr \".ss.ssz\" ",ssz,";\n");
 	}
 	void setFlipUVs(unsigned int fuv)
 	{
 		if(fuv == 0) return;
-		fprintf(mFile,"\tsetAttr \".fuv\" %i;\n", fuv);
+		writeInt(mFile,"\tsetAttr \".fuv\" ",fuv,";\n");
 	}
 	void setColorBorders(unsigned int clb)
 	{
 		if(clb == 1) return;
-		fprintf(mFile,"\tsetAttr \".clb\" %i;\n", clb);
+		writeInt(mFile,"\tsetAttr \".clb\" ",clb,";\n");
 	}
 	void getSource(size_t src_i)const
 	{
-		fprintf(mFile,"\"%s.src[%i]\"",mName.c_str(),src_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".src[",src_i,"]\"");
 	}
 	void getSource()const
 	{
 
-		fprintf(mFile,"\"%s.src\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".src\"");
 	}
 	void getTransferPositions()const
 	{
-		fprintf(mFile,"\"%s.pos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pos\"");
 	}
 	void getTransferNormals()const
 	{
-		fprintf(mFile,"\"%s.nml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nml\"");
 	}
 	void getTransferUVs()const
 	{
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 	void getSourceUVSet()const
 	{
-		fprintf(mFile,"\"%s.suv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".suv\"");
 	}
 	void getTargetUVSet()const
 	{
-		fprintf(mFile,"\"%s.tuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tuv\"");
 	}
 	void getTransferColors()const
 	{
-		fprintf(mFile,"\"%s.col\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".col\"");
 	}
 	void getSourceColorSet()const
 	{
-		fprintf(mFile,"\"%s.scs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scs\"");
 	}
 	void getTargetColorSet()const
 	{
-		fprintf(mFile,"\"%s.tcs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tcs\"");
 	}
 	void getSampleSpace()const
 	{
-		fprintf(mFile,"\"%s.spa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spa\"");
 	}
 	void getSourceUVSpace()const
 	{
-		fprintf(mFile,"\"%s.sus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sus\"");
 	}
 	void getTargetUVSpace()const
 	{
-		fprintf(mFile,"\"%s.tus\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tus\"");
 	}
 	void getSearchMethod()const
 	{
-		fprintf(mFile,"\"%s.mtd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mtd\"");
 	}
 	void getSearchDistance()const
 	{
-		fprintf(mFile,"\"%s.dis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dis\"");
 	}
 	void getSearchTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getSearchScale()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getSearchScaleX()const
 	{
-		fprintf(mFile,"\"%s.ss.ssx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss.ssx\"");
 	}
 	void getSearchScaleY()const
 	{
-		fprintf(mFile,"\"%s.ss.ssy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss.ssy\"");
 	}
 	void getSearchScaleZ()const
 	{
-		fprintf(mFile,"\"%s.ss.ssz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss.ssz\"");
 	}
 	void getFlipUVs()const
 	{
-		fprintf(mFile,"\"%s.fuv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fuv\"");
 	}
 	void getColorBorders()const
 	{
-		fprintf(mFile,"\"%s.clb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".clb\"");
 	}
 protected:
 	TransferAttributes(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,9 +23,9 @@ public:
 		bool minTransZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", minTransXLimitEnable);
-			fprintf(file,"%i ", minTransYLimitEnable);
-			fprintf(file,"%i", minTransZLimitEnable);
+			writeInt(file,"",minTransXLimitEnable," ");
+			writeInt(file,"",minTransYLimitEnable," ");
+			writeInt(file,"",minTransZLimitEnable);
 		}
 	};
 	struct MaxTransLimitEnable{
@@ -34,9 +34,9 @@ public:
 		bool maxTransZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", maxTransXLimitEnable);
-			fprintf(file,"%i ", maxTransYLimitEnable);
-			fprintf(file,"%i", maxTransZLimitEnable);
+			writeInt(file,"",maxTransXLimitEnable," ");
+			writeInt(file,"",maxTransYLimitEnable," ");
+			writeInt(file,"",maxTransZLimitEnable);
 		}
 	};
 	struct MinRotLimitEnable{
@@ -45,9 +45,9 @@ public:
 		bool minRotZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", minRotXLimitEnable);
-			fprintf(file,"%i ", minRotYLimitEnable);
-			fprintf(file,"%i", minRotZLimitEnable);
+			writeInt(file,"",minRotXLimitEnable," ");
+			writeInt(file,"",minRotYLimitEnable," ");
+			writeInt(file,"",minRotZLimitEnable);
 		}
 	};
 	struct MaxRotLimitEnable{
@@ -56,9 +56,9 @@ public:
 		bool maxRotZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", maxRotXLimitEnable);
-			fprintf(file,"%i ", maxRotYLimitEnable);
-			fprintf(file,"%i", maxRotZLimitEnable);
+			writeInt(file,"",maxRotXLimitEnable," ");
+			writeInt(file,"",maxRotYLimitEnable," ");
+			writeInt(file,"",maxRotZLimitEnable);
 		}
 	};
 	struct MinScaleLimitEnable{
@@ -67,9 +67,9 @@ public:
 		bool minScaleZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", minScaleXLimitEnable);
-			fprintf(file,"%i ", minScaleYLimitEnable);
-			fprintf(file,"%i", minScaleZLimitEnable);
+			writeInt(file,"",minScaleXLimitEnable," ");
+			writeInt(file,"",minScaleYLimitEnable," ");
+			writeInt(file,"",minScaleZLimitEnable);
 		}
 	};
 	struct MaxScaleLimitEnable{
@@ -78,9 +78,9 @@ public:
 		bool maxScaleZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", maxScaleXLimitEnable);
-			fprintf(file,"%i ", maxScaleYLimitEnable);
-			fprintf(file,"%i", maxScaleZLimitEnable);
+			writeInt(file,"",maxScaleXLimitEnable," ");
+			writeInt(file,"",maxScaleYLimitEnable," ");
+			writeInt(file,"",maxScaleZLimitEnable);
 		}
 	};
 	struct MentalRayControls{
@@ -94,14 +94,14 @@ public:
 		bool miExportGeoShader;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miDeriveFromMaya);
-			fprintf(file,"%i ", miHide);
-			fprintf(file,"%i ", miVisible);
-			fprintf(file,"%i ", miTrace);
-			fprintf(file,"%i ", miShadow);
-			fprintf(file,"%i ", miCaustic);
-			fprintf(file,"%i ", miGlobillum);
-			fprintf(file,"%i ", miExportGeoShader);
+			writeInt(file,"",miDeriveFromMaya," ");
+			writeInt(file,"",miHide," ");
+			writeInt(file,"",miVisible," ");
+			writeInt(file,"",miTrace," ");
+			writeInt(file,"",miShadow," ");
+			writeInt(file,"",miCaustic," ");
+			writeInt(file,"",miGlobillum," ");
+			writeInt(file,"",miExportGeoShader," ");
 		}
 	};
 public:
@@ -113,856 +113,856 @@ public:
 
 	void setTranslate(const double3& t)
 	{
-		fprintf(mFile,"\tsetAttr \".t\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"double3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTranslateX(double tx)
 	{
 		if(tx == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.tx\" %f;\n", tx);
+		writeFloat(mFile,"\tsetAttr \".t.tx\" ",tx,";\n");
 	}
 	void setTranslateY(double ty)
 	{
 		if(ty == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.ty\" %f;\n", ty);
+		writeFloat(mFile,"\tsetAttr \".t.ty\" ",ty,";\n");
 	}
 	void setTranslateZ(double tz)
 	{
 		if(tz == 0) return;
-		fprintf(mFile,"\tsetAttr \".t.tz\" %f;\n", tz);
+		writeFloat(mFile,"\tsetAttr \".t.tz\" ",tz,";\n");
 	}
 	void setRotate(const double3& r)
 	{
-		fprintf(mFile,"\tsetAttr \".r\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".r\" -type \"double3\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateX(double rx)
 	{
 		if(rx == 0) return;
-		fprintf(mFile,"\tsetAttr \".r.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".r.rx\" ",rx,";\n");
 	}
 	void setRotateY(double ry)
 	{
 		if(ry == 0) return;
-		fprintf(mFile,"\tsetAttr \".r.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".r.ry\" ",ry,";\n");
 	}
 	void setRotateZ(double rz)
 	{
 		if(rz == 0) return;
-		fprintf(mFile,"\tsetAttr \".r.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".r.rz\" ",rz,";\n");
 	}
 	void setRotateOrder(unsigned int ro)
 	{
 		if(ro == 0) return;
-		fprintf(mFile,"\tsetAttr \".ro\" %i;\n", ro);
+		writeInt(mFile,"\tsetAttr \".ro\" ",ro,";\n");
 	}
 	void setScale(const double3& s)
 	{
-		fprintf(mFile,"\tsetAttr \".s\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".s\" -type \"double3\" ");
 		s.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScaleX(double sx)
 	{
 		if(sx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sx\" %f;\n", sx);
+		writeFloat(mFile,"\tsetAttr \".s.sx\" ",sx,";\n");
 	}
 	void setScaleY(double sy)
 	{
 		if(sy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sy\" %f;\n", sy);
+		writeFloat(mFile,"\tsetAttr \".s.sy\" ",sy,";\n");
 	}
 	void setScaleZ(double sz)
 	{
 		if(sz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".s.sz\" %f;\n", sz);
+		writeFloat(mFile,"\tsetAttr \".s.sz\" ",sz,";\n");
 	}
 	void setShear(const double3& sh)
 	{
-		fprintf(mFile,"\tsetAttr \".sh\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".sh\" -type \"double3\" ");
 		sh.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setShearXY(double shxy)
 	{
 		if(shxy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sh.shxy\" %f;\n", shxy);
+		writeFloat(mFile,"\tsetAttr \".sh.shxy\" ",shxy,";\n");
 	}
 	void setShearXZ(double shxz)
 	{
 		if(shxz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sh.shxz\" %f;\n", shxz);
+		writeFloat(mFile,"\tsetAttr \".sh.shxz\" ",shxz,";\n");
 	}
 	void setShearYZ(double shyz)
 	{
 		if(shyz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sh.shyz\" %f;\n", shyz);
+		writeFloat(mFile,"\tsetAttr \".sh.shyz\" ",shyz,";\n");
 	}
 	void setRotatePivot(const double3& rp)
 	{
-		fprintf(mFile,"\tsetAttr \".rp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rp\" -type \"double3\" ");
 		rp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotatePivotX(double rpx)
 	{
 		if(rpx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rp.rpx\" %f;\n", rpx);
+		writeFloat(mFile,"\tsetAttr \".rp.rpx\" ",rpx,";\n");
 	}
 	void setRotatePivotY(double rpy)
 	{
 		if(rpy == 0) return;
-		fprintf(mFile,"\tsetAttr \".rp.rpy\" %f;\n", rpy);
+		writeFloat(mFile,"\tsetAttr \".rp.rpy\" ",rpy,";\n");
 	}
 	void setRotatePivotZ(double rpz)
 	{
 		if(rpz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rp.rpz\" %f;\n", rpz);
+		writeFloat(mFile,"\tsetAttr \".rp.rpz\" ",rpz,";\n");
 	}
 	void setRotatePivotTranslate(const double3& rpt)
 	{
-		fprintf(mFile,"\tsetAttr \".rpt\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".rpt\" -type \"double3\" ");
 		rpt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotatePivotTranslateX(double rptx)
 	{
 		if(rptx == 0) return;
-		fprintf(mFile,"\tsetAttr \".rpt.rptx\" %f;\n", rptx);
+		writeFloat(mFile,"\tsetAttr \".rpt.rptx\" ",rptx,";\n");
 	}
 	void setRotatePivotTranslateY(double rpty)
 	{
 		if(rpty == 0) return;
-		fprintf(mFile,"\tsetAttr \".rpt.rpty\" %f;\n", rpty);
+		writeFloat(mFile,"\tsetAttr \".rpt.rpty\" ",rpty,";\n");
 	}
 	void setRotatePivotTranslateZ(double rptz)
 	{
 		if(rptz == 0) return;
-		fprintf(mFile,"\tsetAttr \".rpt.rptz\" %f;\n", rptz);
+		writeFloat(mFile,"\tsetAttr \".rpt.rptz\" ",rptz,";\n");
 	}
 	void setScalePivot(const double3& sp)
 	{
-		fprintf(mFile,"\tsetAttr \".sp\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".sp\" -type \"double3\" ");
 		sp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScalePivotX(double spx)
 	{
 		if(spx == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.spx\" %f;\n", spx);
+		writeFloat(mFile,"\tsetAttr \".sp.spx\" ",spx,";\n");
 	}
 	void setScalePivotY(double spy)
 	{
 		if(spy == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.spy\" %f;\n", spy);
+		writeFloat(mFile,"\tsetAttr \".sp.spy\" ",spy,";\n");
 	}
 	void setScalePivotZ(double spz)
 	{
 		if(spz == 0) return;
-		fprintf(mFile,"\tsetAttr \".sp.spz\" %f;\n", spz);
+		writeFloat(mFile,"\tsetAttr \".sp.spz\" ",spz,";\n");
 	}
 	void setScalePivotTranslate(const double3& spt)
 	{
-		fprintf(mFile,"\tsetAttr \".spt\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".spt\" -type \"double3\" ");
 		spt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScalePivotTranslateX(double sptx)
 	{
 		if(sptx == 0) return;
-		fprintf(mFile,"\tsetAttr \".spt.sptx\" %f;\n", sptx);
+		writeFloat(mFile,"\tsetAttr \".spt.sptx\" ",sptx,";\n");
 	}
 	void setScalePivotTranslateY(double spty)
 	{
 		if(spty == 0) return;
-		fprintf(mFile,"\tsetAttr \".spt.spty\" %f;\n", spty);
+		writeFloat(mFile,"\tsetAttr \".spt.spty\" ",spty,";\n");
 	}
 	void setScalePivotTranslateZ(double sptz)
 	{
 		if(sptz == 0) return;
-		fprintf(mFile,"\tsetAttr \".spt.sptz\" %f;\n", sptz);
+		writeFloat(mFile,"\tsetAttr \".spt.sptz\" ",sptz,";\n");
 	}
 	void setRotateAxis(const double3& ra)
 	{
-		fprintf(mFile,"\tsetAttr \".ra\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".ra\" -type \"double3\" ");
 		ra.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateAxisX(double rax)
 	{
 		if(rax == 0) return;
-		fprintf(mFile,"\tsetAttr \".ra.rax\" %f;\n", rax);
+		writeFloat(mFile,"\tsetAttr \".ra.rax\" ",rax,";\n");
 	}
 	void setRotateAxisY(double ray)
 	{
 		if(ray == 0) return;
-		fprintf(mFile,"\tsetAttr \".ra.ray\" %f;\n", ray);
+		writeFloat(mFile,"\tsetAttr \".ra.ray\" ",ray,";\n");
 	}
 	void setRotateAxisZ(double raz)
 	{
 		if(raz == 0) return;
-		fprintf(mFile,"\tsetAttr \".ra.raz\" %f;\n", raz);
+		writeFloat(mFile,"\tsetAttr \".ra.raz\" ",raz,";\n");
 	}
 	void setMinTransLimit(const double3& mntl)
 	{
-		fprintf(mFile,"\tsetAttr \".mntl\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".mntl\" -type \"double3\" ");
 		mntl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinTransXLimit(double mtxl)
 	{
 		if(mtxl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mntl.mtxl\" %f;\n", mtxl);
+		writeFloat(mFile,"\tsetAttr \".mntl.mtxl\" ",mtxl,";\n");
 	}
 	void setMinTransYLimit(double mtyl)
 	{
 		if(mtyl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mntl.mtyl\" %f;\n", mtyl);
+		writeFloat(mFile,"\tsetAttr \".mntl.mtyl\" ",mtyl,";\n");
 	}
 	void setMinTransZLimit(double mtzl)
 	{
 		if(mtzl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mntl.mtzl\" %f;\n", mtzl);
+		writeFloat(mFile,"\tsetAttr \".mntl.mtzl\" ",mtzl,";\n");
 	}
 	void setMaxTransLimit(const double3& mxtl)
 	{
-		fprintf(mFile,"\tsetAttr \".mxtl\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".mxtl\" -type \"double3\" ");
 		mxtl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxTransXLimit(double xtxl)
 	{
 		if(xtxl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mxtl.xtxl\" %f;\n", xtxl);
+		writeFloat(mFile,"\tsetAttr \".mxtl.xtxl\" ",xtxl,";\n");
 	}
 	void setMaxTransYLimit(double xtyl)
 	{
 		if(xtyl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mxtl.xtyl\" %f;\n", xtyl);
+		writeFloat(mFile,"\tsetAttr \".mxtl.xtyl\" ",xtyl,";\n");
 	}
 	void setMaxTransZLimit(double xtzl)
 	{
 		if(xtzl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mxtl.xtzl\" %f;\n", xtzl);
+		writeFloat(mFile,"\tsetAttr \".mxtl.xtzl\" ",xtzl,";\n");
 	}
 	void setMinTransLimitEnable(const MinTransLimitEnable& mtle)
 	{
-		fprintf(mFile,"\tsetAttr \".mtle\" ");
+		writeString(mFile,"\tsetAttr \".mtle\" ");
 		mtle.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinTransXLimitEnable(bool mtxe)
 	{
 		if(mtxe == false) return;
-		fprintf(mFile,"\tsetAttr \".mtle.mtxe\" %i;\n", mtxe);
+		writeInt(mFile,"\tsetAttr \".mtle.mtxe\" ",mtxe,";\n");
 	}
 	void setMinTransYLimitEnable(bool mtye)
 	{
 		if(mtye == false) return;
-		fprintf(mFile,"\tsetAttr \".mtle.mtye\" %i;\n", mtye);
+		writeInt(mFile,"\tsetAttr \".mtle.mtye\" ",mtye,";\n");
 	}
 	void setMinTransZLimitEnable(bool mtze)
 	{
 		if(mtze == false) return;
-		fprintf(mFile,"\tsetAttr \".mtle.mtze\" %i;\n", mtze);
+		writeInt(mFile,"\tsetAttr \".mtle.mtze\" ",mtze,";\n");
 	}
 	void setMaxTransLimitEnable(const MaxTransLimitEnable& xtle)
 	{
-		fprintf(mFile,"\tsetAttr \".xtle\" ");
+		writeString(mFile,"\tsetAttr \".xtle\" ");
 		xtle.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxTransXLimitEnable(bool xtxe)
 	{
 		if(xtxe == false) return;
-		fprintf(mFile,"\tsetAttr \".xtle.xtxe\" %i;\n", xtxe);
+		writeInt(mFile,"\tsetAttr \".xtle.xtxe\" ",xtxe,";\n");
 	}
 	void setMaxTransYLimitEnable(bool xtye)
 	{
 		if(xtye == false) return;
-		fprintf(mFile,"\tsetAttr \".xtle.xtye\" %i;\n", xtye);
+		writeInt(mFile,"\tsetAttr \".xtle.xtye\" ",xtye,";\n");
 	}
 	void setMaxTransZLimitEnable(bool xtze)
 	{
 		if(xtze == false) return;
-		fprintf(mFile,"\tsetAttr \".xtle.xtze\" %i;\n", xtze);
+		writeInt(mFile,"\tsetAttr \".xtle.xtze\" ",xtze,";\n");
 	}
 	void setMinRotLimit(const double3& mnrl)
 	{
-		fprintf(mFile,"\tsetAttr \".mnrl\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".mnrl\" -type \"double3\" ");
 		mnrl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinRotXLimit(double mrxl)
 	{
 		if(mrxl == 4) return;
-		fprintf(mFile,"\tsetAttr \".mnrl.mrxl\" %f;\n", mrxl);
+		writeFloat(mFile,"\tsetAttr \".mnrl.mrxl\" ",mrxl,";\n");
 	}
 	void setMinRotYLimit(double mryl)
 	{
 		if(mryl == 4) return;
-		fprintf(mFile,"\tsetAttr \".mnrl.mryl\" %f;\n", mryl);
+		writeFloat(mFile,"\tsetAttr \".mnrl.mryl\" ",mryl,";\n");
 	}
 	void setMinRotZLimit(double mrzl)
 	{
 		if(mrzl == 4) return;
-		fprintf(mFile,"\tsetAttr \".mnrl.mrzl\" %f;\n", mrzl);
+		writeFloat(mFile,"\tsetAttr \".mnrl.mrzl\" ",mrzl,";\n");
 	}
 	void setMaxRotLimit(const double3& mxrl)
 	{
-		fprintf(mFile,"\tsetAttr \".mxrl\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".mxrl\" -type \"double3\" ");
 		mxrl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxRotXLimit(double xrxl)
 	{
 		if(xrxl == 4) return;
-		fprintf(mFile,"\tsetAttr \".mxrl.xrxl\" %f;\n", xrxl);
+		writeFloat(mFile,"\tsetAttr \".mxrl.xrxl\" ",xrxl,";\n");
 	}
 	void setMaxRotYLimit(double xryl)
 	{
 		if(xryl == 4) return;
-		fprintf(mFile,"\tsetAttr \".mxrl.xryl\" %f;\n", xryl);
+		writeFloat(mFile,"\tsetAttr \".mxrl.xryl\" ",xryl,";\n");
 	}
 	void setMaxRotZLimit(double xrzl)
 	{
 		if(xrzl == 4) return;
-		fprintf(mFile,"\tsetAttr \".mxrl.xrzl\" %f;\n", xrzl);
+		writeFloat(mFile,"\tsetAttr \".mxrl.xrzl\" ",xrzl,";\n");
 	}
 	void setMinRotLimitEnable(const MinRotLimitEnable& mrle)
 	{
-		fprintf(mFile,"\tsetAttr \".mrle\" ");
+		writeString(mFile,"\tsetAttr \".mrle\" ");
 		mrle.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinRotXLimitEnable(bool mrxe)
 	{
 		if(mrxe == false) return;
-		fprintf(mFile,"\tsetAttr \".mrle.mrxe\" %i;\n", mrxe);
+		writeInt(mFile,"\tsetAttr \".mrle.mrxe\" ",mrxe,";\n");
 	}
 	void setMinRotYLimitEnable(bool mrye)
 	{
 		if(mrye == false) return;
-		fprintf(mFile,"\tsetAttr \".mrle.mrye\" %i;\n", mrye);
+		writeInt(mFile,"\tsetAttr \".mrle.mrye\" ",mrye,";\n");
 	}
 	void setMinRotZLimitEnable(bool mrze)
 	{
 		if(mrze == false) return;
-		fprintf(mFile,"\tsetAttr \".mrle.mrze\" %i;\n", mrze);
+		writeInt(mFile,"\tsetAttr \".mrle.mrze\" ",mrze,";\n");
 	}
 	void setMaxRotLimitEnable(const MaxRotLimitEnable& xrle)
 	{
-		fprintf(mFile,"\tsetAttr \".xrle\" ");
+		writeString(mFile,"\tsetAttr \".xrle\" ");
 		xrle.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxRotXLimitEnable(bool xrxe)
 	{
 		if(xrxe == false) return;
-		fprintf(mFile,"\tsetAttr \".xrle.xrxe\" %i;\n", xrxe);
+		writeInt(mFile,"\tsetAttr \".xrle.xrxe\" ",xrxe,";\n");
 	}
 	void setMaxRotYLimitEnable(bool xrye)
 	{
 		if(xrye == false) return;
-		fprintf(mFile,"\tsetAttr \".xrle.xrye\" %i;\n", xrye);
+		writeInt(mFile,"\tsetAttr \".xrle.xrye\" ",xrye,";\n");
 	}
 	void setMaxRotZLimitEnable(bool xrze)
 	{
 		if(xrze == false) return;
-		fprintf(mFile,"\tsetAttr \".xrle.xrze\" %i;\n", xrze);
+		writeInt(mFile,"\tsetAttr \".xrle.xrze\" ",xrze,";\n");
 	}
 	void setMinScaleLimit(const double3& mnsl)
 	{
-		fprintf(mFile,"\tsetAttr \".mnsl\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".mnsl\" -type \"double3\" ");
 		mnsl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinScaleXLimit(double msxl)
 	{
 		if(msxl == -1) return;
-		fprintf(mFile,"\tsetAttr \".mnsl.msxl\" %f;\n", msxl);
+		writeFloat(mFile,"\tsetAttr \".mnsl.msxl\" ",msxl,";\n");
 	}
 	void setMinScaleYLimit(double msyl)
 	{
 		if(msyl == -1) return;
-		fprintf(mFile,"\tsetAttr \".mnsl.msyl\" %f;\n", msyl);
+		writeFloat(mFile,"\tsetAttr \".mnsl.msyl\" ",msyl,";\n");
 	}
 	void setMinScaleZLimit(double mszl)
 	{
 		if(mszl == -1) return;
-		fprintf(mFile,"\tsetAttr \".mnsl.mszl\" %f;\n", mszl);
+		writeFloat(mFile,"\tsetAttr \".mnsl.mszl\" ",mszl,";\n");
 	}
 	void setMaxScaleLimit(const double3& mxsl)
 	{
-		fprintf(mFile,"\tsetAttr \".mxsl\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".mxsl\" -type \"double3\" ");
 		mxsl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxScaleXLimit(double xsxl)
 	{
 		if(xsxl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mxsl.xsxl\" %f;\n", xsxl);
+		writeFloat(mFile,"\tsetAttr \".mxsl.xsxl\" ",xsxl,";\n");
 	}
 	void setMaxScaleYLimit(double xsyl)
 	{
 		if(xsyl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mxsl.xsyl\" %f;\n", xsyl);
+		writeFloat(mFile,"\tsetAttr \".mxsl.xsyl\" ",xsyl,";\n");
 	}
 	void setMaxScaleZLimit(double xszl)
 	{
 		if(xszl == 1) return;
-		fprintf(mFile,"\tsetAttr \".mxsl.xszl\" %f;\n", xszl);
+		writeFloat(mFile,"\tsetAttr \".mxsl.xszl\" ",xszl,";\n");
 	}
 	void setMinScaleLimitEnable(const MinScaleLimitEnable& msle)
 	{
-		fprintf(mFile,"\tsetAttr \".msle\" ");
+		writeString(mFile,"\tsetAttr \".msle\" ");
 		msle.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinScaleXLimitEnable(bool msxe)
 	{
 		if(msxe == false) return;
-		fprintf(mFile,"\tsetAttr \".msle.msxe\" %i;\n", msxe);
+		writeInt(mFile,"\tsetAttr \".msle.msxe\" ",msxe,";\n");
 	}
 	void setMinScaleYLimitEnable(bool msye)
 	{
 		if(msye == false) return;
-		fprintf(mFile,"\tsetAttr \".msle.msye\" %i;\n", msye);
+		writeInt(mFile,"\tsetAttr \".msle.msye\" ",msye,";\n");
 	}
 	void setMinScaleZLimitEnable(bool msze)
 	{
 		if(msze == false) return;
-		fprintf(mFile,"\tsetAttr \".msle.msze\" %i;\n", msze);
+		writeInt(mFile,"\tsetAttr \".msle.msze\" ",msze,";\n");
 	}
 	void setMaxScaleLimitEnable(const MaxScaleLimitEnable& xsle)
 	{
-		fprintf(mFile,"\tsetAttr \".xsle\" ");
+		writeString(mFile,"\tsetAttr \".xsle\" ");
 		xsle.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxScaleXLimitEnable(bool xsxe)
 	{
 		if(xsxe == false) return;
-		fprintf(mFile,"\tsetAttr \".xsle.xsxe\" %i;\n", xsxe);
+		writeInt(mFile,"\tsetAttr \".xsle.xsxe\" ",xsxe,";\n");
 	}
 	void setMaxScaleYLimitEnable(bool xsye)
 	{
 		if(xsye == false) return;
-		fprintf(mFile,"\tsetAttr \".xsle.xsye\" %i;\n", xsye);
+		writeInt(mFile,"\tsetAttr \".xsle.xsye\" ",xsye,";\n");
 	}
 	void setMaxScaleZLimitEnable(bool xsze)
 	{
 		if(xsze == false) return;
-		fprintf(mFile,"\tsetAttr \".xsle.xsze\" %i;\n", xsze);
+		writeInt(mFile,"\tsetAttr \".xsle.xsze\" ",xsze,";\n");
 	}
 	void setSelectHandle(const double3& hdl)
 	{
-		fprintf(mFile,"\tsetAttr \".hdl\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".hdl\" -type \"double3\" ");
 		hdl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSelectHandleX(double hdlx)
 	{
 		if(hdlx == 0) return;
-		fprintf(mFile,"\tsetAttr \".hdl.hdlx\" %f;\n", hdlx);
+		writeFloat(mFile,"\tsetAttr \".hdl.hdlx\" ",hdlx,";\n");
 	}
 	void setSelectHandleY(double hdly)
 	{
 		if(hdly == 0) return;
-		fprintf(mFile,"\tsetAttr \".hdl.hdly\" %f;\n", hdly);
+		writeFloat(mFile,"\tsetAttr \".hdl.hdly\" ",hdly,";\n");
 	}
 	void setSelectHandleZ(double hdlz)
 	{
 		if(hdlz == 0) return;
-		fprintf(mFile,"\tsetAttr \".hdl.hdlz\" %f;\n", hdlz);
+		writeFloat(mFile,"\tsetAttr \".hdl.hdlz\" ",hdlz,";\n");
 	}
 	void setInheritsTransform(bool it)
 	{
 		if(it == true) return;
-		fprintf(mFile,"\tsetAttr \".it\" %i;\n", it);
+		writeInt(mFile,"\tsetAttr \".it\" ",it,";\n");
 	}
 	void setDisplayHandle(bool dh)
 	{
 		if(dh == false) return;
-		fprintf(mFile,"\tsetAttr \".dh\" %i;\n", dh);
+		writeInt(mFile,"\tsetAttr \".dh\" ",dh,";\n");
 	}
 	void setDisplayScalePivot(bool dsp)
 	{
 		if(dsp == false) return;
-		fprintf(mFile,"\tsetAttr \".dsp\" %i;\n", dsp);
+		writeInt(mFile,"\tsetAttr \".dsp\" ",dsp,";\n");
 	}
 	void setDisplayRotatePivot(bool drp)
 	{
 		if(drp == false) return;
-		fprintf(mFile,"\tsetAttr \".drp\" %i;\n", drp);
+		writeInt(mFile,"\tsetAttr \".drp\" ",drp,";\n");
 	}
 	void setDisplayLocalAxis(bool dla)
 	{
 		if(dla == false) return;
-		fprintf(mFile,"\tsetAttr \".dla\" %i;\n", dla);
+		writeInt(mFile,"\tsetAttr \".dla\" ",dla,";\n");
 	}
 	void setShowManipDefault(unsigned int smd)
 	{
 		if(smd == 0) return;
-		fprintf(mFile,"\tsetAttr \".smd\" %i;\n", smd);
+		writeInt(mFile,"\tsetAttr \".smd\" ",smd,";\n");
 	}
 	void setRotateQuaternion(const double4& rq)
 	{
-		fprintf(mFile,"\tsetAttr \".rq\" -type \"double4\" ");
+		writeString(mFile,"\tsetAttr \".rq\" -type \"double4\" ");
 		rq.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRotateQuaternionX(double rqx)
 	{
 		if(rqx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rq.rqx\" %f;\n", rqx);
+		writeFloat(mFile,"\tsetAttr \".rq.rqx\" ",rqx,";\n");
 	}
 	void setRotateQuaternionY(double rqy)
 	{
 		if(rqy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rq.rqy\" %f;\n", rqy);
+		writeFloat(mFile,"\tsetAttr \".rq.rqy\" ",rqy,";\n");
 	}
 	void setRotateQuaternionZ(double rqz)
 	{
 		if(rqz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rq.rqz\" %f;\n", rqz);
+		writeFloat(mFile,"\tsetAttr \".rq.rqz\" ",rqz,";\n");
 	}
 	void setRotateQuaternionW(double rqw)
 	{
 		if(rqw == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rq.rqw\" %f;\n", rqw);
+		writeFloat(mFile,"\tsetAttr \".rq.rqw\" ",rqw,";\n");
 	}
 	void setMentalRayControls(const MentalRayControls& mrc)
 	{
-		fprintf(mFile,"\tsetAttr \".mrc\" ");
+		writeString(mFile,"\tsetAttr \".mrc\" ");
 		mrc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMiDeriveFromMaya(bool dfm)
 	{
 		if(dfm == true) return;
-		fprintf(mFile,"\tsetAttr \".mrc.dfm\" %i;\n", dfm);
+		writeInt(mFile,"\tsetAttr \".mrc.dfm\" ",dfm,";\n");
 	}
 	void setMiHide(bool hde)
 	{
 		if(hde == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.hde\" %i;\n", hde);
+		writeInt(mFile,"\tsetAttr \".mrc.hde\" ",hde,";\n");
 	}
 	void setMiVisible(unsigned int vsb)
 	{
 		if(vsb == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.vsb\" %i;\n", vsb);
+		writeInt(mFile,"\tsetAttr \".mrc.vsb\" ",vsb,";\n");
 	}
 	void setMiTrace(unsigned int trc)
 	{
 		if(trc == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.trc\" %i;\n", trc);
+		writeInt(mFile,"\tsetAttr \".mrc.trc\" ",trc,";\n");
 	}
 	void setMiShadow(unsigned int shd)
 	{
 		if(shd == 2) return;
-		fprintf(mFile,"\tsetAttr \".mrc.shd\" %i;\n", shd);
+		writeInt(mFile,"\tsetAttr \".mrc.shd\" ",shd,";\n");
 	}
 	void setMiCaustic(unsigned int cst)
 	{
 		if(cst == 5) return;
-		fprintf(mFile,"\tsetAttr \".mrc.cst\" %i;\n", cst);
+		writeInt(mFile,"\tsetAttr \".mrc.cst\" ",cst,";\n");
 	}
 	void setMiGlobillum(unsigned int glb)
 	{
 		if(glb == 5) return;
-		fprintf(mFile,"\tsetAttr \".mrc.glb\" %i;\n", glb);
+		writeInt(mFile,"\tsetAttr \".mrc.glb\" ",glb,";\n");
 	}
 	void setMiExportGeoShader(bool mieg)
 	{
 		if(mieg == false) return;
-		fprintf(mFile,"\tsetAttr \".mrc.mieg\" %i;\n", mieg);
+		writeInt(mFile,"\tsetAttr \".mrc.mieg\" ",mieg,";\n");
 	}
 	void getTranslate()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTranslateX()const
 	{
-		fprintf(mFile,"\"%s.t.tx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tx\"");
 	}
 	void getTranslateY()const
 	{
-		fprintf(mFile,"\"%s.t.ty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.ty\"");
 	}
 	void getTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.t.tz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tz\"");
 	}
 	void getRotate()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRotateX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRotateY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRotateZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getRotateOrder()const
 	{
-		fprintf(mFile,"\"%s.ro\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ro\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getScaleX()const
 	{
-		fprintf(mFile,"\"%s.s.sx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sx\"");
 	}
 	void getScaleY()const
 	{
-		fprintf(mFile,"\"%s.s.sy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sy\"");
 	}
 	void getScaleZ()const
 	{
-		fprintf(mFile,"\"%s.s.sz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s.sz\"");
 	}
 	void getShear()const
 	{
-		fprintf(mFile,"\"%s.sh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh\"");
 	}
 	void getShearXY()const
 	{
-		fprintf(mFile,"\"%s.sh.shxy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh.shxy\"");
 	}
 	void getShearXZ()const
 	{
-		fprintf(mFile,"\"%s.sh.shxz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh.shxz\"");
 	}
 	void getShearYZ()const
 	{
-		fprintf(mFile,"\"%s.sh.shyz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh.shyz\"");
 	}
 	void getRotatePivot()const
 	{
-		fprintf(mFile,"\"%s.rp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp\"");
 	}
 	void getRotatePivotX()const
 	{
-		fprintf(mFile,"\"%s.rp.rpx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.rpx\"");
 	}
 	void getRotatePivotY()const
 	{
-		fprintf(mFile,"\"%s.rp.rpy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.rpy\"");
 	}
 	void getRotatePivotZ()const
 	{
-		fprintf(mFile,"\"%s.rp.rpz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rp.rpz\"");
 	}
 	void getRotatePivotTranslate()const
 	{
-		fprintf(mFile,"\"%s.rpt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpt\"");
 	}
 	void getRotatePivotTranslateX()const
 	{
-		fprintf(mFile,"\"%s.rpt.rptx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpt.rptx\"");
 	}
 	void getRotatePivotTranslateY()const
 	{
-		fprintf(mFile,"\"%s.rpt.rpty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpt.rpty\"");
 	}
 	void getRotatePivotTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.rpt.rptz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpt.rptz\"");
 	}
 	void getScalePivot()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getScalePivotX()const
 	{
-		fprintf(mFile,"\"%s.sp.spx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spx\"");
 	}
 	void getScalePivotY()const
 	{
-		fprintf(mFile,"\"%s.sp.spy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spy\"");
 	}
 	void getScalePivotZ()const
 	{
-		fprintf(mFile,"\"%s.sp.spz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp.spz\"");
 	}
 	void getScalePivotTranslate()const
 	{
-		fprintf(mFile,"\"%s.spt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spt\"");
 	}
 	void getScalePivotTranslateX()const
 	{
-		fprintf(mFile,"\"%s.spt.sptx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spt.sptx\"");
 	}
 	void getScalePivotTranslateY()const
 	{
-		fprintf(mFile,"\"%s.spt.spty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spt.spty\"");
 	}
 	void getScalePivotTranslateZ()const
 	{
-		fprintf(mFile,"\"%s.spt.sptz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".spt.sptz\"");
 	}
 	void getRotateAxis()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getRotateAxisX()const
 	{
-		fprintf(mFile,"\"%s.ra.rax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra.rax\"");
 	}
 	void getRotateAxisY()const
 	{
-		fprintf(mFile,"\"%s.ra.ray\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra.ray\"");
 	}
 	void getRotateAxisZ()const
 	{
-		fprintf(mFile,"\"%s.ra.raz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra.raz\"");
 	}
 	void getTransMinusRotatePivot()const
 	{
-		fprintf(mFile,"\"%s.tmrp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmrp\"");
 	}
 	void getTransMinusRotatePivotX()const
 	{
-		fprintf(mFile,"\"%s.tmrp.tmrx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmrp.tmrx\"");
 	}
 	void getTransMinusRotatePivotY()const
 	{
-		fprintf(mFile,"\"%s.tmrp.tmry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmrp.tmry\"");
 	}
 	void getTransMinusRotatePivotZ()const
 	{
-		fprintf(mFile,"\"%s.tmrp.tmrz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tmrp.tmrz\"");
 	}
 	void getGeometry()const
 	{
-		fprintf(mFile,"\"%s.g\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".g\"");
 	}
 	void getXformMatrix()const
 	{
-		fprintf(mFile,"\"%s.xm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xm\"");
 	}
 	void getSelectHandle()const
 	{
-		fprintf(mFile,"\"%s.hdl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hdl\"");
 	}
 	void getSelectHandleX()const
 	{
-		fprintf(mFile,"\"%s.hdl.hdlx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hdl.hdlx\"");
 	}
 	void getSelectHandleY()const
 	{
-		fprintf(mFile,"\"%s.hdl.hdly\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hdl.hdly\"");
 	}
 	void getSelectHandleZ()const
 	{
-		fprintf(mFile,"\"%s.hdl.hdlz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hdl.hdlz\"");
 	}
 	void getInheritsTransform()const
 	{
-		fprintf(mFile,"\"%s.it\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".it\"");
 	}
 	void getDisplayHandle()const
 	{
-		fprintf(mFile,"\"%s.dh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dh\"");
 	}
 	void getDisplayScalePivot()const
 	{
-		fprintf(mFile,"\"%s.dsp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dsp\"");
 	}
 	void getDisplayRotatePivot()const
 	{
-		fprintf(mFile,"\"%s.drp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drp\"");
 	}
 	void getDisplayLocalAxis()const
 	{
-		fprintf(mFile,"\"%s.dla\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dla\"");
 	}
 	void getDynamics()const
 	{
-		fprintf(mFile,"\"%s.dyn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dyn\"");
 	}
 	void getShowManipDefault()const
 	{
-		fprintf(mFile,"\"%s.smd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".smd\"");
 	}
 	void getSpecifiedManipLocation()const
 	{
-		fprintf(mFile,"\"%s.sml\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sml\"");
 	}
 	void getRotateQuaternion()const
 	{
-		fprintf(mFile,"\"%s.rq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rq\"");
 	}
 	void getRotateQuaternionX()const
 	{
-		fprintf(mFile,"\"%s.rq.rqx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rq.rqx\"");
 	}
 	void getRotateQuaternionY()const
 	{
-		fprintf(mFile,"\"%s.rq.rqy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rq.rqy\"");
 	}
 	void getRotateQuaternionZ()const
 	{
-		fprintf(mFile,"\"%s.rq.rqz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rq.rqz\"");
 	}
 	void getRotateQuaternionW()const
 	{
-		fprintf(mFile,"\"%s.rq.rqw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rq.rqw\"");
 	}
 	void getRotationInterpolation()const
 	{
-		fprintf(mFile,"\"%s.roi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".roi\"");
 	}
 	void getMentalRayControls()const
 	{
-		fprintf(mFile,"\"%s.mrc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc\"");
 	}
 	void getMiDeriveFromMaya()const
 	{
-		fprintf(mFile,"\"%s.mrc.dfm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.dfm\"");
 	}
 	void getMiHide()const
 	{
-		fprintf(mFile,"\"%s.mrc.hde\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.hde\"");
 	}
 	void getMiVisible()const
 	{
-		fprintf(mFile,"\"%s.mrc.vsb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.vsb\"");
 	}
 	void getMiTrace()const
 	{
-		fprintf(mFile,"\"%s.mrc.trc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.trc\"");
 	}
 	void getMiShadow()const
 	{
-		fprintf(mFile,"\"%s.mrc.shd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.shd\"");
 	}
 	void getMiCaustic()const
 	{
-		fprintf(mFile,"\"%s.mrc.cst\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.cst\"");
 	}
 	void getMiGlobillum()const
 	{
-		fprintf(mFile,"\"%s.mrc.glb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.glb\"");
 	}
 	void getMiExportGeoShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.mieg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.mieg\"");
 	}
 	void getMiGeoShader()const
 	{
-		fprintf(mFile,"\"%s.mrc.migs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mrc.migs\"");
 	}
 protected:
 	Transform(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
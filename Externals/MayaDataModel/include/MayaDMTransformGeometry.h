@@ -27,39 +27,39 @@ public:
 	void setTransform(const matrix& txf)
 	{
 		if(txf == identity) return;
-		fprintf(mFile,"\tsetAttr \".txf\" -type \"matrix\" ");
+		writeString(mFile,"\tsetAttr \".txf\" -type \"matrix\" ");
 		txf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInvertTransform(bool itf)
 	{
 		if(itf == false) return;
-		fprintf(mFile,"\tsetAttr \".itf\" %i;\n", itf);
+		writeInt(mFile,"\tsetAttr \".itf\" ",itf,";\n");
 	}
 	void setFreezeNormals(unsigned int fn)
 	{
 		if(fn == 0) return;
-		fprintf(mFile,"\tsetAttr \".fn\" %i;\n", fn);
+		writeInt(mFile,"\tsetAttr \".fn\" ",fn,";\n");
 	}
 	void getInputGeometry()const
 	{
-		fprintf(mFile,"\"%s.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ig\"");
 	}
 	void getTransform()const
 	{
-		fprintf(mFile,"\"%s.txf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".txf\"");
 	}
 	void getInvertTransform()const
 	{
-		fprintf(mFile,"\"%s.itf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".itf\"");
 	}
 	void getFreezeNormals()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getOutputGeometry()const
 	{
-		fprintf(mFile,"\"%s.og\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".og\"");
 	}
 protected:
 	TransformGeometry(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,137 +27,137 @@ public:
 	void setLocatorU(size_t lu_i,double lu)
 	{
 		if(lu == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".lu[%i]\" %f;\n", lu_i,lu);
+		writeInt(mFile,"\tsetAttr \".lu[",lu_i); writeFloat(mFile,"]\" ",lu,";\n");
 	}
 	void setLocatorU(size_t lu_start,size_t lu_end,double* lu)
 	{
-		fprintf(mFile,"\tsetAttr \".lu[%i:%i]\" ", lu_start,lu_end);
+		writeInt(mFile,"\tsetAttr \".lu[",lu_start); writeInt(mFile,":",lu_end,"]\" ");
 		size_t size = (lu_end-lu_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",lu[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",lu[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLocatorU(size_t lu_start,size_t lu_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".lu[%i:%i]\"",lu_start,lu_end);
+		writeInt(mFile,"\tsetAttr \".lu[",lu_start); writeInt(mFile,":",lu_end,"]\"");
 	}
 	void appendLocatorU(double lu)const
 	{
-		fprintf(mFile," %f",lu);
+		writeFloat(mFile," ",lu);
 	}
 	void endLocatorU()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setLocatorV(size_t lv_i,double lv)
 	{
 		if(lv == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".lv[%i]\" %f;\n", lv_i,lv);
+		writeInt(mFile,"\tsetAttr \".lv[",lv_i); writeFloat(mFile,"]\" ",lv,";\n");
 	}
 	void setLocatorV(size_t lv_start,size_t lv_end,double* lv)
 	{
-		fprintf(mFile,"\tsetAttr \".lv[%i:%i]\" ", lv_start,lv_end);
+		writeInt(mFile,"\tsetAttr \".lv[",lv_start); writeInt(mFile,":",lv_end,"]\" ");
 		size_t size = (lv_end-lv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",lv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",lv[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startLocatorV(size_t lv_start,size_t lv_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".lv[%i:%i]\"",lv_start,lv_end);
+		writeInt(mFile,"\tsetAttr \".lv[",lv_start); writeInt(mFile,":",lv_end,"]\"");
 	}
 	void appendLocatorV(double lv)const
 	{
-		fprintf(mFile," %f",lv);
+		writeFloat(mFile," ",lv);
 	}
 	void endLocatorV()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setSelected(unsigned int sl)
 	{
 		if(sl == 0) return;
-		fprintf(mFile,"\tsetAttr \".sl\" %i;\n", sl);
+		writeInt(mFile,"\tsetAttr \".sl\" ",sl,";\n");
 	}
 	void setShrink(bool sh)
 	{
 		if(sh == false) return;
-		fprintf(mFile,"\tsetAttr \".sh\" %i;\n", sh);
+		writeInt(mFile,"\tsetAttr \".sh\" ",sh,";\n");
 	}
 	void setTolerance(double tol)
 	{
 		if(tol == 0) return;
-		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
+		writeFloat(mFile,"\tsetAttr \".tol\" ",tol,";\n");
 	}
 	void getInputCurve(size_t ic_i)const
 	{
-		fprintf(mFile,"\"%s.ic[%i]\"",mName.c_str(),ic_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ic[",ic_i,"]\"");
 	}
 	void getInputCurve()const
 	{
 
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getLocatorU(size_t lu_i)const
 	{
-		fprintf(mFile,"\"%s.lu[%i]\"",mName.c_str(),lu_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lu[",lu_i,"]\"");
 	}
 	void getLocatorU()const
 	{
 
-		fprintf(mFile,"\"%s.lu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lu\"");
 	}
 	void getLocatorV(size_t lv_i)const
 	{
-		fprintf(mFile,"\"%s.lv[%i]\"",mName.c_str(),lv_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".lv[",lv_i,"]\"");
 	}
 	void getLocatorV()const
 	{
 
-		fprintf(mFile,"\"%s.lv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lv\"");
 	}
 	void getSelected()const
 	{
-		fprintf(mFile,"\"%s.sl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sl\"");
 	}
 	void getShrink()const
 	{
-		fprintf(mFile,"\"%s.sh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sh\"");
 	}
 	void getTolerance()const
 	{
-		fprintf(mFile,"\"%s.tol\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tol\"");
 	}
 	void getUsedCurves(size_t uc_i)const
 	{
-		fprintf(mFile,"\"%s.uc[%i]\"",mName.c_str(),uc_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uc[",uc_i,"]\"");
 	}
 	void getUsedCurves()const
 	{
 
-		fprintf(mFile,"\"%s.uc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uc\"");
 	}
 	void getSplitSurface()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 	void getShouldBeLast()const
 	{
-		fprintf(mFile,"\"%s.sbl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sbl\"");
 	}
 protected:
 	Trim(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,46 +27,46 @@ public:
 	void setFlipNormal(bool fn)
 	{
 		if(fn == false) return;
-		fprintf(mFile,"\tsetAttr \".fn\" %i;\n", fn);
+		writeInt(mFile,"\tsetAttr \".fn\" ",fn,";\n");
 	}
 	void setTolerancePE(double tpe)
 	{
 		if(tpe == 0) return;
-		fprintf(mFile,"\tsetAttr \".tpe\" %f;\n", tpe);
+		writeFloat(mFile,"\tsetAttr \".tpe\" ",tpe,";\n");
 	}
 	void setToleranceE(double te)
 	{
 		if(te == 0) return;
-		fprintf(mFile,"\tsetAttr \".te\" %f;\n", te);
+		writeFloat(mFile,"\tsetAttr \".te\" ",te,";\n");
 	}
 	void getInputBoundaries(size_t ib_i)const
 	{
-		fprintf(mFile,"\"%s.ib[%i]\"",mName.c_str(),ib_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ib[",ib_i,"]\"");
 	}
 	void getInputBoundaries()const
 	{
 
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 	void getInputSurface()const
 	{
-		fprintf(mFile,"\"%s.is\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".is\"");
 	}
 	void getFlipNormal()const
 	{
-		fprintf(mFile,"\"%s.fn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fn\"");
 	}
 	void getTolerancePE()const
 	{
-		fprintf(mFile,"\"%s.tpe\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tpe\"");
 	}
 	void getToleranceE()const
 	{
-		fprintf(mFile,"\"%s.te\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".te\"");
 	}
 	void getOutputSurface()const
 	{
-		fprintf(mFile,"\"%s.os\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".os\"");
 	}
 protected:
 	TrimWithBoundaries(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
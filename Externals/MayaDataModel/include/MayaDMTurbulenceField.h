@@ -27,65 +27,65 @@ public:
 	void setFrequency(double frq)
 	{
 		if(frq == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".frq\" %f;\n", frq);
+		writeFloat(mFile,"\tsetAttr \".frq\" ",frq,";\n");
 	}
 	void setPhaseX(double phx)
 	{
 		if(phx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".phx\" %f;\n", phx);
+		writeFloat(mFile,"\tsetAttr \".phx\" ",phx,";\n");
 	}
 	void setPhaseY(double phy)
 	{
 		if(phy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".phy\" %f;\n", phy);
+		writeFloat(mFile,"\tsetAttr \".phy\" ",phy,";\n");
 	}
 	void setPhaseZ(double phz)
 	{
 		if(phz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".phz\" %f;\n", phz);
+		writeFloat(mFile,"\tsetAttr \".phz\" ",phz,";\n");
 	}
 	void setNoiseLevel(int nslv)
 	{
 		if(nslv == 0) return;
-		fprintf(mFile,"\tsetAttr \".nslv\" %i;\n", nslv);
+		writeInt(mFile,"\tsetAttr \".nslv\" ",nslv,";\n");
 	}
 	void setNoiseRatio(double nsrt)
 	{
 		if(nsrt == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".nsrt\" %f;\n", nsrt);
+		writeFloat(mFile,"\tsetAttr \".nsrt\" ",nsrt,";\n");
 	}
 	void setInterpolationType(unsigned int intr)
 	{
 		if(intr == 0) return;
-		fprintf(mFile,"\tsetAttr \".intr\" %i;\n", intr);
+		writeInt(mFile,"\tsetAttr \".intr\" ",intr,";\n");
 	}
 	void getFrequency()const
 	{
-		fprintf(mFile,"\"%s.frq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".frq\"");
 	}
 	void getPhaseX()const
 	{
-		fprintf(mFile,"\"%s.phx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".phx\"");
 	}
 	void getPhaseY()const
 	{
-		fprintf(mFile,"\"%s.phy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".phy\"");
 	}
 	void getPhaseZ()const
 	{
-		fprintf(mFile,"\"%s.phz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".phz\"");
 	}
 	void getNoiseLevel()const
 	{
-		fprintf(mFile,"\"%s.nslv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nslv\"");
 	}
 	void getNoiseRatio()const
 	{
-		fprintf(mFile,"\"%s.nsrt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nsrt\"");
 	}
 	void getInterpolationType()const
 	{
-		fprintf(mFile,"\"%s.intr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".intr\"");
 	}
 protected:
 	TurbulenceField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
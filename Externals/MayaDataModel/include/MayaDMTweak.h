@@ -25,7 +25,7 @@ public:
 			for (size_t i = 0; i<nbControlPoints; ++i)
 			{
 				controlPoints[i].write(file);
-				if (i + 1<nbControlPoints) fprintf(file, " ");
+				if (i + 1<nbControlPoints) writeString(file," ");
 			}
 		}
 	};
@@ -37,7 +37,7 @@ public:
 			for (size_t i = 0; i<nbVertex; ++i)
 			{
 				vertex[i].write(file);
-				if (i + 1<nbVertex) fprintf(file, " ");
+				if (i + 1<nbVertex) writeString(file," ");
 			}
 		}
 	};
@@ -51,251 +51,251 @@ public:
 	void setRelativeTweak(bool rtw)
 	{
 		if(rtw == true) return;
-		fprintf(mFile,"\tsetAttr \".rtw\" %i;\n", rtw);
+		writeInt(mFile,"\tsetAttr \".rtw\" ",rtw,";\n");
 	}
 	void setPlist(size_t pl_i,const Plist& pl)
 	{
-		fprintf(mFile,"\tsetAttr \".pl[%i]\" ",pl_i);
+		writeInt(mFile,"\tsetAttr \".pl[",pl_i,"]\" ");
 		pl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPlist(size_t pl_start,size_t pl_end,Plist* pl)
 	{
-		fprintf(mFile,"\tsetAttr \".pl[%i:%i]\" ", pl_start,pl_end);
+		writeInt(mFile,"\tsetAttr \".pl[",pl_start); writeInt(mFile,":",pl_end,"]\" ");
 		size_t size = (pl_end-pl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			pl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPlist(size_t pl_start,size_t pl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pl[%i:%i]\"",pl_start,pl_end);
-		fprintf(mFile," -type \"Plist\" ");
+		writeInt(mFile,"\tsetAttr \".pl[",pl_start); writeInt(mFile,":",pl_end,"]\"");
+		writeString(mFile," -type \"Plist\" ");
 	}
 	void appendPlist(const Plist& pl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		pl.write(mFile);
 	}
 	void endPlist()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setControlPoints(size_t pl_i,size_t cp_i,const double3& cp)
 	{
-		fprintf(mFile,"\tsetAttr \".pl[%i].cp[%i]\" -type \"double3\" ",pl_i,cp_i);
+		writeInt(mFile,"\tsetAttr \".pl[",pl_i); writeInt(mFile,"].cp[",cp_i,"]\" -type \"double3\" ");
 		cp.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setControlPoints(size_t pl_i,size_t cp_start,size_t cp_end,double* cp)
 	{
-		fprintf(mFile,"\tsetAttr \".pl[%i].cp[%i:%i]\" ", pl_i,cp_start,cp_end);
+		writeInt(mFile,"\tsetAttr \".pl[",pl_i); writeInt(mFile,"].cp[",cp_start); writeInt(mFile,":",cp_end,"]\" ");
 		size_t size = (cp_end-cp_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",cp[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startControlPoints(size_t pl_i,size_t cp_start,size_t cp_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pl[%i].cp[%i:%i]\"",pl_i,cp_start,cp_end);
+		writeInt(mFile,"\tsetAttr \".pl[",pl_i); writeInt(mFile,"].cp[",cp_start); writeInt(mFile,":",cp_end,"]\"");
 	}
 	void appendControlPoints(double cp)const
 	{
-		fprintf(mFile," %f",cp);
+		writeFloat(mFile," ",cp);
 	}
 	void endControlPoints()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setXValue(size_t pl_i,size_t cp_i,double xv)
 	{
 		if(xv == 0) return;
-		fprintf(mFile,"\tsetAttr \".pl[%i].cp[%i].xv\" %f;\n", pl_i,cp_i,xv);
+		writeInt(mFile,"\tsetAttr \".pl[",pl_i); writeInt(mFile,"].cp[",cp_i); writeFloat(mFile,"].xv\" ",xv,";\n");
 	}
 	void setYValue(size_t pl_i,size_t cp_i,double yv)
 	{
 		if(yv == 0) return;
-		fprintf(mFile,"\tsetAttr \".pl[%i].cp[%i].yv\" %f;\n", pl_i,cp_i,yv);
+		writeInt(mFile,"\tsetAttr \".pl[",pl_i); writeInt(mFile,"].cp[",cp_i); writeFloat(mFile,"].yv\" ",yv,";\n");
 	}
 	void setZValue(size_t pl_i,size_t cp_i,double zv)
 	{
 		if(zv == 0) return;
-		fprintf(mFile,"\tsetAttr \".pl[%i].cp[%i].zv\" %f;\n", pl_i,cp_i,zv);
+		writeInt(mFile,"\tsetAttr \".pl[",pl_i); writeInt(mFile,"].cp[",cp_i); writeFloat(mFile,"].zv\" ",zv,";\n");
 	}
 	void setVlist(size_t vl_i,const Vlist& vl)
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i]\" ",vl_i);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i,"]\" ");
 		vl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVlist(size_t vl_start,size_t vl_end,Vlist* vl)
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i:%i]\" ", vl_start,vl_end);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_start); writeInt(mFile,":",vl_end,"]\" ");
 		size_t size = (vl_end-vl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			vl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVlist(size_t vl_start,size_t vl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i:%i]\"",vl_start,vl_end);
-		fprintf(mFile," -type \"Vlist\" ");
+		writeInt(mFile,"\tsetAttr \".vl[",vl_start); writeInt(mFile,":",vl_end,"]\"");
+		writeString(mFile," -type \"Vlist\" ");
 	}
 	void appendVlist(const Vlist& vl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		vl.write(mFile);
 	}
 	void endVlist()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertex(size_t vl_i,size_t vt_i,const float3& vt)
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i].vt[%i]\" -type \"float3\" ",vl_i,vt_i);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeInt(mFile,"].vt[",vt_i,"]\" -type \"float3\" ");
 		vt.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertex(size_t vl_i,size_t vt_start,size_t vt_end,float* vt)
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i].vt[%i:%i]\" ", vl_i,vt_start,vt_end);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeInt(mFile,"].vt[",vt_start); writeInt(mFile,":",vt_end,"]\" ");
 		size_t size = (vt_end-vt_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",vt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",vt[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startVertex(size_t vl_i,size_t vt_start,size_t vt_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".vl[%i].vt[%i:%i]\"",vl_i,vt_start,vt_end);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeInt(mFile,"].vt[",vt_start); writeInt(mFile,":",vt_end,"]\"");
 	}
 	void appendVertex(float vt)const
 	{
-		fprintf(mFile," %f",vt);
+		writeFloat(mFile," ",vt);
 	}
 	void endVertex()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setXVertex(size_t vl_i,size_t vt_i,float vx)
 	{
 		if(vx == 0) return;
-		fprintf(mFile,"\tsetAttr \".vl[%i].vt[%i].vx\" %f;\n", vl_i,vt_i,vx);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeInt(mFile,"].vt[",vt_i); writeFloat(mFile,"].vx\" ",vx,";\n");
 	}
 	void setYVertex(size_t vl_i,size_t vt_i,float vy)
 	{
 		if(vy == 0) return;
-		fprintf(mFile,"\tsetAttr \".vl[%i].vt[%i].vy\" %f;\n", vl_i,vt_i,vy);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeInt(mFile,"].vt[",vt_i); writeFloat(mFile,"].vy\" ",vy,";\n");
 	}
 	void setZVertex(size_t vl_i,size_t vt_i,float vz)
 	{
 		if(vz == 0) return;
-		fprintf(mFile,"\tsetAttr \".vl[%i].vt[%i].vz\" %f;\n", vl_i,vt_i,vz);
+		writeInt(mFile,"\tsetAttr \".vl[",vl_i); writeInt(mFile,"].vt[",vt_i); writeFloat(mFile,"].vz\" ",vz,";\n");
 	}
 	void getRelativeTweak()const
 	{
-		fprintf(mFile,"\"%s.rtw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rtw\"");
 	}
 	void getPlist(size_t pl_i)const
 	{
-		fprintf(mFile,"\"%s.pl[%i]\"",mName.c_str(),pl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl[",pl_i,"]\"");
 	}
 	void getPlist()const
 	{
 
-		fprintf(mFile,"\"%s.pl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pl\"");
 	}
 	void getControlPoints(size_t pl_i,size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.pl[%i].cp[%i]\"",mName.c_str(),pl_i,cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl[",pl_i); writeInt(mFile,"].cp[",cp_i,"]\"");
 	}
 	void getControlPoints(size_t cp_i)const
 	{
 
-		fprintf(mFile,"\"%s.pl.cp[%i]\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl.cp[",cp_i,"]\"");
 	}
 	void getXValue(size_t pl_i,size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.pl[%i].cp[%i].xv\"",mName.c_str(),pl_i,cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl[",pl_i); writeInt(mFile,"].cp[",cp_i,"].xv\"");
 	}
 	void getXValue(size_t cp_i)const
 	{
 
-		fprintf(mFile,"\"%s.pl.cp[%i].xv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl.cp[",cp_i,"].xv\"");
 	}
 	void getYValue(size_t pl_i,size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.pl[%i].cp[%i].yv\"",mName.c_str(),pl_i,cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl[",pl_i); writeInt(mFile,"].cp[",cp_i,"].yv\"");
 	}
 	void getYValue(size_t cp_i)const
 	{
 
-		fprintf(mFile,"\"%s.pl.cp[%i].yv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl.cp[",cp_i,"].yv\"");
 	}
 	void getZValue(size_t pl_i,size_t cp_i)const
 	{
-		fprintf(mFile,"\"%s.pl[%i].cp[%i].zv\"",mName.c_str(),pl_i,cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl[",pl_i); writeInt(mFile,"].cp[",cp_i,"].zv\"");
 	}
 	void getZValue(size_t cp_i)const
 	{
 
-		fprintf(mFile,"\"%s.pl.cp[%i].zv\"",mName.c_str(),cp_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pl.cp[",cp_i,"].zv\"");
 	}
 	void getVlist(size_t vl_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i]\"",mName.c_str(),vl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i,"]\"");
 	}
 	void getVlist()const
 	{
 
-		fprintf(mFile,"\"%s.vl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vl\"");
 	}
 	void getVertex(size_t vl_i,size_t vt_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i].vt[%i]\"",mName.c_str(),vl_i,vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i); writeInt(mFile,"].vt[",vt_i,"]\"");
 	}
 	void getVertex(size_t vt_i)const
 	{
 
-		fprintf(mFile,"\"%s.vl.vt[%i]\"",mName.c_str(),vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl.vt[",vt_i,"]\"");
 	}
 	void getXVertex(size_t vl_i,size_t vt_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i].vt[%i].vx\"",mName.c_str(),vl_i,vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i); writeInt(mFile,"].vt[",vt_i,"].vx\"");
 	}
 	void getXVertex(size_t vt_i)const
 	{
 
-		fprintf(mFile,"\"%s.vl.vt[%i].vx\"",mName.c_str(),vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl.vt[",vt_i,"].vx\"");
 	}
 	void getYVertex(size_t vl_i,size_t vt_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i].vt[%i].vy\"",mName.c_str(),vl_i,vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i); writeInt(mFile,"].vt[",vt_i,"].vy\"");
 	}
 	void getYVertex(size_t vt_i)const
 	{
 
-		fprintf(mFile,"\"%s.vl.vt[%i].vy\"",mName.c_str(),vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl.vt[",vt_i,"].vy\"");
 	}
 	void getZVertex(size_t vl_i,size_t vt_i)const
 	{
-		fprintf(mFile,"\"%s.vl[%i].vt[%i].vz\"",mName.c_str(),vl_i,vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl[",vl_i); writeInt(mFile,"].vt[",vt_i,"].vz\"");
 	}
 	void getZVertex(size_t vt_i)const
 	{
 
-		fprintf(mFile,"\"%s.vl.vt[%i].vz\"",mName.c_str(),vt_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".vl.vt[",vt_i,"].vz\"");
 	}
 protected:
 	Tweak(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
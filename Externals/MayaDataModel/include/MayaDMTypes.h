@@ -14,6 +14,8 @@
 #include <string>
 #include <vector>
 
+#include "MayaDMWriter.h"
+
 // from ogre OgrePlatform.h
 // Win32 compilers use _DEBUG for specifying debug builds.
 // Unlike the Win32 compilers, Linux compilers seem to use DEBUG for when
@@ -59,7 +61,7 @@ struct short2
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%i %i", values[0], values[1]);
+		writeInts(file, values, 2);
 	}
 };
 
@@ -93,7 +95,7 @@ struct short3
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%i %i %i", values[0], values[1], values[2]);
+		writeInts(file, values, 3);
 	}
 };
 
@@ -134,7 +136,7 @@ struct long2
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%i %i", values[0], values[1]);
+		writeInts(file, values, 2);
 	}
 };
 
@@ -174,7 +176,7 @@ struct long3
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%i %i %i", values[0], values[1], values[2]);
+		writeInts(file, values, 3);
 	}
 };
 
@@ -212,11 +214,7 @@ struct int32Array
 	}
 	void write(FILE* file) const
 	{
-		for(size_t i=0; i<size; ++i)
-		{
-			fprintf(file, "%i", values[i]);
-			if(i+1<size) fprintf(file, " ");
-		}		
+		writeInts(file, values, size);
 	}
 };
 
@@ -248,7 +246,7 @@ struct float2
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f", values[0], values[1]);
+		writeFloats(file, values, 2);
 	}
 };
 
@@ -288,7 +286,7 @@ struct float3
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f %f", values[0], values[1], values[2]);
+		writeFloats(file, values, 3);
 	}
 };
 
@@ -329,7 +327,7 @@ struct double2
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f", values[0], values[1]);
+		writeFloats(file, values, 2);
 	}
 };
 
@@ -369,7 +367,7 @@ struct double3
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f", values[0], values[1], values[2]);
+		writeFloats(file, values, 3);
 	}
 };
 
@@ -415,7 +413,7 @@ struct double4
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f %f", values[0], values[1], values[2], values[3]);
+		writeFloats(file, values, 4);
 	}
 };
 
@@ -458,11 +456,7 @@ struct doubleArray
 	}
 	void write(FILE* file) const
 	{
-		for(size_t i=0; i<size; ++i)
-		{
-			fprintf(file,"%f", values[i]);
-			if(i+1<size) fprintf(file," ");
-		}		
+		writeFloats(file, values, size);
 	}
 };
 
@@ -573,10 +567,13 @@ struct matrix
 
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f %f ", m[0][0], m[0][1], m[0][2], m[0][3]);
-		fprintf(file,"%f %f %f %f ", m[1][0], m[1][1], m[1][2], m[1][3]);
-		fprintf(file,"%f %f %f %f ", m[2][0], m[2][1], m[2][2], m[2][3]);
-		fprintf(file,"%f %f %f %f", m[3][0], m[3][1], m[3][2], m[3][3]);
+		writeFloats(file, m[0], 4);
+		writeString(file, " ");
+		writeFloats(file, m[1], 4);
+		writeString(file, " ");
+		writeFloats(file, m[2], 4);
+		writeString(file, " ");
+		writeFloats(file, m[3], 4);
 	}
 };
 
@@ -612,7 +609,10 @@ struct point
 	double w;
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f %f", x, y, z, w);
+		writeFloat(file, "", x);
+		writeFloat(file, " ", y);
+		writeFloat(file, " ", z);
+		writeFloat(file, " ", w);
 	}
 };
 struct pointArray
@@ -636,7 +636,7 @@ struct pointArray
 		for(size_t i=0; i<size; ++i)
 		{
 			values[i].write(file);
-			if(i+1<size) fprintf(file," ");
+			if(i+1<size) writeString(file, " ");
 		}		
 	}
 };
@@ -654,7 +654,9 @@ struct vector
 	double z;
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f", x, y, z);
+		writeFloat(file, "", x);
+		writeFloat(file, " ", y);
+		writeFloat(file, " ", z);
 	}
 };
 struct vectorArray
@@ -678,7 +680,7 @@ struct vectorArray
 		for(size_t i=0; i<size; ++i)
 		{
 			values[i].write(file);
-			if(i+1<size) fprintf(file," ");
+			if(i+1<size) writeString(file, " ");
 		}		
 	}
 };
@@ -712,7 +714,7 @@ struct string
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "\"%s\"", str.c_str());
+		writeString(file, "\"", str.c_str(), "\"");
 	}
 };
 
@@ -748,7 +750,7 @@ struct stringArray
 		for(size_t i=0; i<size; ++i)
 		{
 			values[i].write(file);
-			if(i+1<size) fprintf(file," ");
+			if(i+1<size) writeString(file, " ");
 		}		
 	}
 };
@@ -764,7 +766,7 @@ struct sphere
 	double radius;
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f", radius);
+		writeFloat(file, "", radius);
 	}
 };
 
@@ -780,7 +782,8 @@ struct cone
 	double coneCap;
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f", coneAngle, coneCap);
+		writeFloat(file, "", coneAngle);
+		writeFloat(file, " ", coneCap);
 	}
 };
 
@@ -797,7 +800,9 @@ struct reflectanceRGB
 	double blueReflect;
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f %f", redReflect, greenReflect, blueReflect);
+		writeFloat(file, "", redReflect);
+		writeFloat(file, " ", greenReflect);
+		writeFloat(file, " ", blueReflect);
 	}
 };
 
@@ -814,7 +819,9 @@ struct spectrumRGB
 	double blueSpectrum;
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f %f", redSpectrum, greenSpectrum, blueSpectrum);
+		writeFloat(file, "", redSpectrum);
+		writeFloat(file, " ", greenSpectrum);
+		writeFloat(file, " ", blueSpectrum);
 	}
 };
 
@@ -832,11 +839,11 @@ public:
 	~componentList(){}
 	void write(FILE* file) const
 	{
-		fprintf(file,"%i ", size());
+		writeInt(file, "", size(), " ");
 		for(size_t i=0; i<size(); ++i)
 		{
 			at(i).write(file);
-			if(i+1<size()) fprintf(file," ");
+			if(i+1<size()) writeString(file, " ");
 		}		
 	}
 };
@@ -900,21 +907,22 @@ struct nurbsCurve
 
 	void write(FILE* file) const
 	{
-		fprintf(file,"%i %i %i %i %i %i ", degree, spans, form, isRational, dimension, knotCount);
+		writeInt(file, "", degree);
+		writeInt(file, " ", spans);
+		writeInt(file, " ", form);
+		writeInt(file, " ", isRational);
+		writeInt(file, " ", dimension);
+		writeInt(file, " ", knotCount, " ");
 		for(int i=0; i<knotCount; ++i)
 		{
-			fprintf(file, "%f ", knotValues[i]);
+			writeFloat(file, "", knotValues[i], " ");
 		}
-		fprintf(file, "%i ", cvCount);
+		writeInt(file, "", cvCount, " ");
 		size_t numElements = 2;		
 		if(dimension == 3) numElements++;
 		if(isRational) 	numElements++;
 		size_t size = cvCount * numElements;
-		for(size_t i=0; i<size; ++i)
-		{
-			fprintf(file, "%f", cvValues[i]);
-			if(i+1<size) fprintf(file," ");
-		}
+		writeFloats(file, cvValues, size);
 	}
 };
 
@@ -987,31 +995,32 @@ struct nurbsSurface
 
 	void write(FILE* file) const
 	{
-		fprintf(file,"%i %i %i %i %i %i ", uDegree, vDegree, uForm, vForm, isRational, uKnotCount);
+		writeInt(file, "", uDegree);
+		writeInt(file, " ", vDegree);
+		writeInt(file, " ", uForm);
+		writeInt(file, " ", vForm);
+		writeInt(file, " ", isRational);
+		writeInt(file, " ", uKnotCount, " ");
 		for(int i=0; i<uKnotCount; ++i)
 		{
-			fprintf(file, "%f ", uKnotValues[i]);
+			writeFloat(file, "", uKnotValues[i], " ");
 		}
-		fprintf(file,"%i ", vKnotCount);
+		writeInt(file, "", vKnotCount, " ");
 		for(int i=0; i<uKnotCount; ++i)
 		{
-			fprintf(file, "%f ", uKnotValues[i]);
+			writeFloat(file, "", uKnotValues[i], " ");
 		}	
 		if(trim == TRIM){
-			fprintf(file, "\"%s\" ", "TRIM");
+			writeString(file, "\"TRIM\" ");
 		} else
 		{
-			fprintf(file, "\"%s\" ", "NOTRIM");
+			writeString(file, "\"NOTRIM\" ");
 		}
-		fprintf(file, "%i ", cvCount);
+		writeInt(file, "", cvCount, " ");
 		size_t numElements = 3;		
 		if(isRational) 	numElements++;
 		size_t size = cvCount * numElements;
-		for(size_t i=0; i<size; ++i)
-		{
-			fprintf(file, "%f", cvValues[i]);
-			if(i+1<size) fprintf(file," ");
-		}
+		writeFloats(file, cvValues, size);
 	}
 };
 /**
@@ -1048,7 +1057,9 @@ struct nurbsTrimface
 				
 				void write(FILE* file) const
 				{
-					fprintf(file, "%i %i %i", edgeTolerance, isEdgeReversed, geometricContinuity);
+					writeInt(file, "", edgeTolerance);
+					writeInt(file, " ", isEdgeReversed);
+					writeInt(file, " ", geometricContinuity);
 				}
 			} *splinesOnEdge;
 			
@@ -1062,7 +1073,8 @@ struct nurbsTrimface
 			
 				void write(FILE* file) const
 				{
-					fprintf(file, "%i %i", isMonotone, pedgeTolerance);
+					writeInt(file, "", isMonotone);
+					writeInt(file, " ", pedgeTolerance);
 				}
 			} *splinesOnPedge;
 
@@ -1079,17 +1091,17 @@ struct nurbsTrimface
 
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", splineCountOnEdge);
+				writeInt(file, "", splineCountOnEdge, " ");
 				for(int i=0; i<splineCountOnEdge; ++i)
 				{
 					splinesOnEdge[i].write(file);
-					if(i+1<splineCountOnEdge) fprintf(file, " ");
+					if(i+1<splineCountOnEdge) writeString(file, " ");
 				}
-				fprintf(file,"%i ", splineCountOnPedge);
+				writeInt(file, "", splineCountOnPedge, " ");
 				for(int i=0; i<splineCountOnPedge; ++i)
 				{
 					splinesOnPedge[i].write(file);
-					if(i+1<splineCountOnPedge) fprintf(file, " ");
+					if(i+1<splineCountOnPedge) writeString(file, " ");
 				}
 			}
 		} *edges;
@@ -1105,11 +1117,12 @@ struct nurbsTrimface
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i %i ", boundaryType, tedgeCountOnBoundary);
+			writeInt(file, "", boundaryType);
+			writeInt(file, " ", tedgeCountOnBoundary, " ");
 			for(int i=0; i<tedgeCountOnBoundary; ++i)
 			{
 				edges[i].write(file);
-				if(i+1<tedgeCountOnBoundary) fprintf(file, " ");
+				if(i+1<tedgeCountOnBoundary) writeString(file, " ");
 			}
 		}
 	} *boundaries;
@@ -1125,11 +1138,12 @@ struct nurbsTrimface
 
 	void write(FILE* file) const
 	{
-		fprintf(file,"%i %i ", flipNormal, boundaryCount);
+		writeInt(file, "", flipNormal);
+		writeInt(file, " ", boundaryCount, " ");
 		for(int i=0; i<boundaryCount; ++i)
 		{
 			boundaries[i].write(file);
-			if(i+1<boundaryCount) fprintf(file, " ");
+			if(i+1<boundaryCount) writeString(file, " ");
 		}
 	}
 };
@@ -1190,12 +1204,8 @@ struct polyFaces
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"\t\tf %i ", faceEdgeCount);
-			for(int i=0; i<faceEdgeCount; ++i)
-			{
-				fprintf(file,"%i", edgeIdValue[i]);
-				if(i+1<faceEdgeCount) fprintf(file, " ");
-			}
+			writeInt(file, "\t\tf ", faceEdgeCount, " ");
+			writeInts(file, edgeIdValue, faceEdgeCount);
 		}
 	}f;
 
@@ -1222,12 +1232,8 @@ struct polyFaces
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"\t\th %i ", holeEdgeCount);
-			for(int i=0; i<holeEdgeCount; ++i)
-			{
-				fprintf(file,"%i", edgeIdValue[i]);
-				if(i+1<holeEdgeCount) fprintf(file, " ");
-			}
+			writeInt(file, "\t\th ", holeEdgeCount, " ");
+			writeInts(file, edgeIdValue, holeEdgeCount);
 		}
 	}h;
 
@@ -1254,12 +1260,8 @@ struct polyFaces
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"\t\tmf %i ", faceUVCount);
-			for(int i=0; i<faceUVCount; ++i)
-			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<faceUVCount) fprintf(file, " ");
-			}
+			writeInt(file, "\t\tmf ", faceUVCount, " ");
+			writeInts(file, uvIdValue, faceUVCount);
 		}
 	}mf;
 
@@ -1286,12 +1288,8 @@ struct polyFaces
 		}
 		void write(FILE* file) const
 		{
-			fprintf(file,"\t\tmh %i ", holeUVCount);
-			for(int i=0; i<holeUVCount; ++i)
-			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<holeUVCount) fprintf(file, " ");
-			}
+			writeInt(file, "\t\tmh ", holeUVCount, " ");
+			writeInts(file, uvIdValue, holeUVCount);
 		}
 	}mh;
 
@@ -1326,13 +1324,9 @@ struct polyFaces
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"\t\tmu %i ", uvSet);
-			fprintf(file,"%i ", faceUVCount);
-			for(int i=0; i<faceUVCount; ++i)
-			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<faceUVCount) fprintf(file, " ");
-			}
+			writeInt(file, "\t\tmu ", uvSet, " ");
+			writeInt(file, "", faceUVCount, " ");
+			writeInts(file, uvIdValue, faceUVCount);
 		}
 	};
 
@@ -1369,13 +1363,9 @@ struct polyFaces
 
         void write(FILE* file) const
         {
-            fprintf(file,"\t\tmc %i ", colorSet);
-            fprintf(file,"%i ", faceColorCount);
-            for(int i=0; i<faceColorCount; ++i)
-            {
-                fprintf(file,"%i", colorIdValue[i]);
-                if(i+1<faceColorCount) fprintf(file, " ");
-            }
+            writeInt(file, "\t\tmc ", colorSet, " ");
+            writeInt(file, "", faceColorCount, " ");
+            writeInts(file, colorIdValue, faceColorCount);
         }
     };
 
@@ -1404,12 +1394,8 @@ struct polyFaces
 		
 		void write(FILE* file) const
 		{
-			fprintf(file,"\t\tfc %i ", faceColorCount);
-			for(int i=0; i<faceColorCount; ++i)
-			{
-				fprintf(file,"%i", colorIndexValue[i]);
-				if(i+1<faceColorCount) fprintf(file, " ");
-			}
+			writeInt(file, "\t\tfc ", faceColorCount, " ");
+			writeInts(file, colorIndexValue, faceColorCount);
 		}
 	}fc;
 
@@ -1433,23 +1419,23 @@ struct polyFaces
 	{
 		if(f.faceEdgeCount)
 		{
-            fprintf(file, "\n");
+            writeString(file, "\n");
 			f.write(file);			
 		}
 		if(h.holeEdgeCount)
 		{
-			fprintf(file, "\n");
+			writeString(file, "\n");
 			h.write(file);
 			
 		}
 		if(mf.faceUVCount)
 		{
-			fprintf(file, "\n");
+			writeString(file, "\n");
 			mf.write(file);			
 		}
 		if(mh.holeUVCount)
 		{
-			fprintf(file, "\n");
+			writeString(file, "\n");
 			mh.write(file);			
 		}
         if ( muCount > 0 )
@@ -1458,7 +1444,7 @@ struct polyFaces
             {
                 if(mu[i].faceUVCount)
                 {
-                    fprintf(file, "\n");
+                    writeString(file, "\n");
                     mu[i].write(file);			
                 }
             }
@@ -1469,14 +1455,14 @@ struct polyFaces
             {
                 if(mc[i].faceColorCount)
                 {
-                    fprintf(file, "\n");
+                    writeString(file, "\n");
                     mc[i].write(file);			
                 }
             }
         }
 		if(fc.faceColorCount)
 		{
-			fprintf(file, "\n");
+			writeString(file, "\n");
 			fc.write(file);
 		}		
 	}
@@ -1525,13 +1511,9 @@ struct mesh
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"\"v\" %i ", vertexCount);
+			writeInt(file, "\"v\" ", vertexCount, " ");
 			size_t size = vertexCount * 3;
-			for(size_t i=0; i<size; ++i)
-			{
-				fprintf(file,"%f", vertices[i]);
-				if(i+1<size) fprintf(file," ");
-			}
+			writeFloats(file, vertices, size);
 		}
 	}v;
 
@@ -1555,13 +1537,9 @@ struct mesh
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"\"vn\" %i ", normalCount);
+			writeInt(file, "\"vn\" ", normalCount, " ");
 			size_t size = normalCount * 3;
-			for(size_t i=0; i<size; ++i)
-			{
-				fprintf(file,"%f", normals[i]);
-				if(i+1<size) fprintf(file," ");
-			}
+			writeFloats(file, normals, size);
 		}
 	}vn;
 
@@ -1585,13 +1563,9 @@ struct mesh
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"\"vt\" %i ", uvCount);
+			writeInt(file, "\"vt\" ", uvCount, " ");
 			size_t size = uvCount * 2;
-			for(size_t i=0; i<size; ++i)
-			{
-				fprintf(file,"%f", uvValues[i]);
-				if(i+1<size) fprintf(file," ");
-			}
+			writeFloats(file, uvValues, size);
 		}
 	}vt;
 
@@ -1611,13 +1585,14 @@ struct mesh
 
 			void write(FILE* file) const
 			{
-				fprintf(file, "%f %f ", startVertex, endVertex);
+				writeFloat(file, "", startVertex);
+				writeFloat(file, " ", endVertex, " ");
 				if(type == HARD)
 				{
-					fprintf(file, "\"hard\"");	
+					writeString(file, "\"hard\"");	
 				}else
 				{
-					fprintf(file, "\"smooth\"");	
+					writeString(file, "\"smooth\"");	
 				}
 			}
 		}*edges;
@@ -1636,11 +1611,11 @@ struct mesh
 
 		void write(FILE* file) const
 		{
-			fprintf(file,"\"e\" %i ", edgeCount);
+			writeInt(file, "\"e\" ", edgeCount, " ");
 			for(int i=0; i<edgeCount; ++i)
 			{
 				edges[i].write(file);
-				if(i+1<edgeCount) fprintf(file," ");
+				if(i+1<edgeCount) writeString(file, " ");
 			}
 		}
 	}e;
@@ -1650,22 +1625,22 @@ struct mesh
 		if(v.vertexCount)
 		{
 			v.write(file);
-			fprintf(file, " ");
+			writeString(file, " ");
 		}
 		if(vn.normalCount)
 		{
 			vn.write(file);
-			fprintf(file, " ");
+			writeString(file, " ");
 		}
 		if(vt.uvCount)
 		{
 			vt.write(file);
-			fprintf(file, " ");
+			writeString(file, " ");
 		}
 		if(e.edgeCount)
 		{
 			v.write(file);
-			fprintf(file, " ");
+			writeString(file, " ");
 		}
 	}
 };
@@ -1723,13 +1698,12 @@ struct lattice
 	
 	void write(FILE* file) const
 	{
-		fprintf(file,"%i %i %i %i ", sDivisionCount, tDivisionCount, uDivisionCount, pointCount);
+		writeInt(file, "", sDivisionCount);
+		writeInt(file, " ", tDivisionCount);
+		writeInt(file, " ", uDivisionCount);
+		writeInt(file, " ", pointCount, " ");
 		size_t size = pointCount*3;
-		for(size_t i = 0; i<size; ++i)
-		{
-			fprintf(file, "%f", points[i]);
-			if(i+1<size) fprintf(file, " ");
-		}
+		writeFloats(file, points, size);
 	}
 };
 
@@ -23,9 +23,9 @@ public:
 		double directionZ;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", directionX);
-			fprintf(file,"%f ", directionY);
-			fprintf(file,"%f", directionZ);
+			writeFloat(file,"",directionX," ");
+			writeFloat(file,"",directionY," ");
+			writeFloat(file,"",directionZ);
 		}
 	};
 public:
@@ -37,44 +37,44 @@ public:
 
 	void setDirection(const Direction& d)
 	{
-		fprintf(mFile,"\tsetAttr \".d\" ");
+		writeString(mFile,"\tsetAttr \".d\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionX(double dx)
 	{
 		if(dx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dx\" %f;\n", dx);
+		writeFloat(mFile,"\tsetAttr \".d.dx\" ",dx,";\n");
 	}
 	void setDirectionY(double dy)
 	{
 		if(dy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dy\" %f;\n", dy);
+		writeFloat(mFile,"\tsetAttr \".d.dy\" ",dy,";\n");
 	}
 	void setDirectionZ(double dz)
 	{
 		if(dz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dz\" %f;\n", dz);
+		writeFloat(mFile,"\tsetAttr \".d.dz\" ",dz,";\n");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDirectionX()const
 	{
-		fprintf(mFile,"\"%s.d.dx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dx\"");
 	}
 	void getDirectionY()const
 	{
-		fprintf(mFile,"\"%s.d.dy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dy\"");
 	}
 	void getDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.d.dz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dz\"");
 	}
 	void getInheritFactor()const
 	{
-		fprintf(mFile,"\"%s.inh\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inh\"");
 	}
 protected:
 	UniformField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,15 +27,15 @@ public:
 	void setConversionFactor(double cf)
 	{
 		if(cf == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".cf\" %f;\n", cf);
+		writeFloat(mFile,"\tsetAttr \".cf\" ",cf,";\n");
 	}
 	void getInput()const
 	{
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	UnitConversion(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
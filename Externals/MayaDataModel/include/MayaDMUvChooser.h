@@ -27,313 +27,313 @@ public:
 	void setUvSets(size_t uvs_i,const string& uvs)
 	{
 		if(uvs == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".uvs[%i]\" -type \"string\" ",uvs_i);
+		writeInt(mFile,"\tsetAttr \".uvs[",uvs_i,"]\" -type \"string\" ");
 		uvs.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setUvSets(size_t uvs_start,size_t uvs_end,string* uvs)
 	{
-		fprintf(mFile,"\tsetAttr \".uvs[%i:%i]\" ", uvs_start,uvs_end);
+		writeInt(mFile,"\tsetAttr \".uvs[",uvs_start); writeInt(mFile,":",uvs_end,"]\" ");
 		size_t size = (uvs_end-uvs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			uvs[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startUvSets(size_t uvs_start,size_t uvs_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".uvs[%i:%i]\"",uvs_start,uvs_end);
-		fprintf(mFile," -type \"string\" ");
+		writeInt(mFile,"\tsetAttr \".uvs[",uvs_start); writeInt(mFile,":",uvs_end,"]\"");
+		writeString(mFile," -type \"string\" ");
 	}
 	void appendUvSets(const string& uvs)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		uvs.write(mFile);
 	}
 	void endUvSets()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvOne(const float2& vt1)
 	{
-		fprintf(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt1\" -type \"float2\" ");
 		vt1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvOneU(float t1u)
 	{
 		if(t1u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1u\" %f;\n", t1u);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1u\" ",t1u,";\n");
 	}
 	void setVertexUvOneV(float t1v)
 	{
 		if(t1v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt1.t1v\" %f;\n", t1v);
+		writeFloat(mFile,"\tsetAttr \".vt1.t1v\" ",t1v,";\n");
 	}
 	void setVertexUvTwo(const float2& vt2)
 	{
-		fprintf(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt2\" -type \"float2\" ");
 		vt2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvTwoU(float t2u)
 	{
 		if(t2u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2u\" %f;\n", t2u);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2u\" ",t2u,";\n");
 	}
 	void setVertexUvTwoV(float t2v)
 	{
 		if(t2v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt2.t2v\" %f;\n", t2v);
+		writeFloat(mFile,"\tsetAttr \".vt2.t2v\" ",t2v,";\n");
 	}
 	void setVertexUvThree(const float2& vt3)
 	{
-		fprintf(mFile,"\tsetAttr \".vt3\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".vt3\" -type \"float2\" ");
 		vt3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexUvThreeU(float t3u)
 	{
 		if(t3u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt3.t3u\" %f;\n", t3u);
+		writeFloat(mFile,"\tsetAttr \".vt3.t3u\" ",t3u,";\n");
 	}
 	void setVertexUvThreeV(float t3v)
 	{
 		if(t3v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vt3.t3v\" %f;\n", t3v);
+		writeFloat(mFile,"\tsetAttr \".vt3.t3v\" ",t3v,";\n");
 	}
 	void setVertexCameraOne(const float3& vc1)
 	{
-		fprintf(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc1\" -type \"float3\" ");
 		vc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVertexCameraOneX(float c1x)
 	{
 		if(c1x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1x\" %f;\n", c1x);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1x\" ",c1x,";\n");
 	}
 	void setVertexCameraOneY(float c1y)
 	{
 		if(c1y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1y\" %f;\n", c1y);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1y\" ",c1y,";\n");
 	}
 	void setVertexCameraOneZ(float c1z)
 	{
 		if(c1z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc1.c1z\" %f;\n", c1z);
+		writeFloat(mFile,"\tsetAttr \".vc1.c1z\" ",c1z,";\n");
 	}
 	void setOutVertexUvOne(const float2& ov1)
 	{
-		fprintf(mFile,"\tsetAttr \".ov1\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".ov1\" -type \"float2\" ");
 		ov1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutVertexUvOneU(float o1u)
 	{
 		if(o1u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ov1.o1u\" %f;\n", o1u);
+		writeFloat(mFile,"\tsetAttr \".ov1.o1u\" ",o1u,";\n");
 	}
 	void setOutVertexUvOneV(float o1v)
 	{
 		if(o1v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ov1.o1v\" %f;\n", o1v);
+		writeFloat(mFile,"\tsetAttr \".ov1.o1v\" ",o1v,";\n");
 	}
 	void setOutVertexUvTwo(const float2& ov2)
 	{
-		fprintf(mFile,"\tsetAttr \".ov2\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".ov2\" -type \"float2\" ");
 		ov2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutVertexUvTwoU(float o2u)
 	{
 		if(o2u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ov2.o2u\" %f;\n", o2u);
+		writeFloat(mFile,"\tsetAttr \".ov2.o2u\" ",o2u,";\n");
 	}
 	void setOutVertexUvTwoV(float o2v)
 	{
 		if(o2v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ov2.o2v\" %f;\n", o2v);
+		writeFloat(mFile,"\tsetAttr \".ov2.o2v\" ",o2v,";\n");
 	}
 	void setOutVertexUvThree(const float2& ov3)
 	{
-		fprintf(mFile,"\tsetAttr \".ov3\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".ov3\" -type \"float2\" ");
 		ov3.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutVertexUvThreeU(float o3u)
 	{
 		if(o3u == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ov3.o3u\" %f;\n", o3u);
+		writeFloat(mFile,"\tsetAttr \".ov3.o3u\" ",o3u,";\n");
 	}
 	void setOutVertexUvThreeV(float o3v)
 	{
 		if(o3v == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ov3.o3v\" %f;\n", o3v);
+		writeFloat(mFile,"\tsetAttr \".ov3.o3v\" ",o3v,";\n");
 	}
 	void setOutVertexCameraOne(const float3& oc1)
 	{
-		fprintf(mFile,"\tsetAttr \".oc1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".oc1\" -type \"float3\" ");
 		oc1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutVertexCameraOneX(float o1x)
 	{
 		if(o1x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc1.o1x\" %f;\n", o1x);
+		writeFloat(mFile,"\tsetAttr \".oc1.o1x\" ",o1x,";\n");
 	}
 	void setOutVertexCameraOneY(float o1y)
 	{
 		if(o1y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc1.o1y\" %f;\n", o1y);
+		writeFloat(mFile,"\tsetAttr \".oc1.o1y\" ",o1y,";\n");
 	}
 	void setOutVertexCameraOneZ(float o1z)
 	{
 		if(o1z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc1.o1z\" %f;\n", o1z);
+		writeFloat(mFile,"\tsetAttr \".oc1.o1z\" ",o1z,";\n");
 	}
 	void getUvSets(size_t uvs_i)const
 	{
-		fprintf(mFile,"\"%s.uvs[%i]\"",mName.c_str(),uvs_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".uvs[",uvs_i,"]\"");
 	}
 	void getUvSets()const
 	{
 
-		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uvs\"");
 	}
 	void getUvCoord()const
 	{
-		fprintf(mFile,"\"%s.uv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv\"");
 	}
 	void getUCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.u\"");
 	}
 	void getVCoord()const
 	{
-		fprintf(mFile,"\"%s.uv.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".uv.v\"");
 	}
 	void getVertexUvOne()const
 	{
-		fprintf(mFile,"\"%s.vt1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1\"");
 	}
 	void getVertexUvOneU()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1u\"");
 	}
 	void getVertexUvOneV()const
 	{
-		fprintf(mFile,"\"%s.vt1.t1v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt1.t1v\"");
 	}
 	void getVertexUvTwo()const
 	{
-		fprintf(mFile,"\"%s.vt2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2\"");
 	}
 	void getVertexUvTwoU()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2u\"");
 	}
 	void getVertexUvTwoV()const
 	{
-		fprintf(mFile,"\"%s.vt2.t2v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt2.t2v\"");
 	}
 	void getVertexUvThree()const
 	{
-		fprintf(mFile,"\"%s.vt3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3\"");
 	}
 	void getVertexUvThreeU()const
 	{
-		fprintf(mFile,"\"%s.vt3.t3u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3.t3u\"");
 	}
 	void getVertexUvThreeV()const
 	{
-		fprintf(mFile,"\"%s.vt3.t3v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vt3.t3v\"");
 	}
 	void getVertexCameraOne()const
 	{
-		fprintf(mFile,"\"%s.vc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1\"");
 	}
 	void getVertexCameraOneX()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1x\"");
 	}
 	void getVertexCameraOneY()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1y\"");
 	}
 	void getVertexCameraOneZ()const
 	{
-		fprintf(mFile,"\"%s.vc1.c1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc1.c1z\"");
 	}
 	void getInfoBits()const
 	{
-		fprintf(mFile,"\"%s.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ib\"");
 	}
 	void getOutUv()const
 	{
-		fprintf(mFile,"\"%s.ouv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv\"");
 	}
 	void getOutU()const
 	{
-		fprintf(mFile,"\"%s.ouv.ou\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv.ou\"");
 	}
 	void getOutV()const
 	{
-		fprintf(mFile,"\"%s.ouv.ov\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ouv.ov\"");
 	}
 	void getOutVertexUvOne()const
 	{
-		fprintf(mFile,"\"%s.ov1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov1\"");
 	}
 	void getOutVertexUvOneU()const
 	{
-		fprintf(mFile,"\"%s.ov1.o1u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov1.o1u\"");
 	}
 	void getOutVertexUvOneV()const
 	{
-		fprintf(mFile,"\"%s.ov1.o1v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov1.o1v\"");
 	}
 	void getOutVertexUvTwo()const
 	{
-		fprintf(mFile,"\"%s.ov2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov2\"");
 	}
 	void getOutVertexUvTwoU()const
 	{
-		fprintf(mFile,"\"%s.ov2.o2u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov2.o2u\"");
 	}
 	void getOutVertexUvTwoV()const
 	{
-		fprintf(mFile,"\"%s.ov2.o2v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov2.o2v\"");
 	}
 	void getOutVertexUvThree()const
 	{
-		fprintf(mFile,"\"%s.ov3\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov3\"");
 	}
 	void getOutVertexUvThreeU()const
 	{
-		fprintf(mFile,"\"%s.ov3.o3u\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov3.o3u\"");
 	}
 	void getOutVertexUvThreeV()const
 	{
-		fprintf(mFile,"\"%s.ov3.o3v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ov3.o3v\"");
 	}
 	void getOutVertexCameraOne()const
 	{
-		fprintf(mFile,"\"%s.oc1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc1\"");
 	}
 	void getOutVertexCameraOneX()const
 	{
-		fprintf(mFile,"\"%s.oc1.o1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc1.o1x\"");
 	}
 	void getOutVertexCameraOneY()const
 	{
-		fprintf(mFile,"\"%s.oc1.o1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc1.o1y\"");
 	}
 	void getOutVertexCameraOneZ()const
 	{
-		fprintf(mFile,"\"%s.oc1.o1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc1.o1z\"");
 	}
 protected:
 	UvChooser(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
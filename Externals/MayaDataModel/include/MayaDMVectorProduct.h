@@ -27,116 +27,116 @@ public:
 	void setOperation(unsigned int op)
 	{
 		if(op == 1) return;
-		fprintf(mFile,"\tsetAttr \".op\" %i;\n", op);
+		writeInt(mFile,"\tsetAttr \".op\" ",op,";\n");
 	}
 	void setInput1(const float3& i1)
 	{
 		if(i1 == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".i1\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".i1\" -type \"float3\" ");
 		i1.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput1X(float i1x)
 	{
 		if(i1x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i1.i1x\" %f;\n", i1x);
+		writeFloat(mFile,"\tsetAttr \".i1.i1x\" ",i1x,";\n");
 	}
 	void setInput1Y(float i1y)
 	{
 		if(i1y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i1.i1y\" %f;\n", i1y);
+		writeFloat(mFile,"\tsetAttr \".i1.i1y\" ",i1y,";\n");
 	}
 	void setInput1Z(float i1z)
 	{
 		if(i1z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i1.i1z\" %f;\n", i1z);
+		writeFloat(mFile,"\tsetAttr \".i1.i1z\" ",i1z,";\n");
 	}
 	void setInput2(const float3& i2)
 	{
 		if(i2 == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".i2\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".i2\" -type \"float3\" ");
 		i2.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setInput2X(float i2x)
 	{
 		if(i2x == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i2.i2x\" %f;\n", i2x);
+		writeFloat(mFile,"\tsetAttr \".i2.i2x\" ",i2x,";\n");
 	}
 	void setInput2Y(float i2y)
 	{
 		if(i2y == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i2.i2y\" %f;\n", i2y);
+		writeFloat(mFile,"\tsetAttr \".i2.i2y\" ",i2y,";\n");
 	}
 	void setInput2Z(float i2z)
 	{
 		if(i2z == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i2.i2z\" %f;\n", i2z);
+		writeFloat(mFile,"\tsetAttr \".i2.i2z\" ",i2z,";\n");
 	}
 	void setNormalizeOutput(bool no)
 	{
 		if(no == false) return;
-		fprintf(mFile,"\tsetAttr \".no\" %i;\n", no);
+		writeInt(mFile,"\tsetAttr \".no\" ",no,";\n");
 	}
 	void getOperation()const
 	{
-		fprintf(mFile,"\"%s.op\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".op\"");
 	}
 	void getInput1()const
 	{
-		fprintf(mFile,"\"%s.i1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i1\"");
 	}
 	void getInput1X()const
 	{
-		fprintf(mFile,"\"%s.i1.i1x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i1.i1x\"");
 	}
 	void getInput1Y()const
 	{
-		fprintf(mFile,"\"%s.i1.i1y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i1.i1y\"");
 	}
 	void getInput1Z()const
 	{
-		fprintf(mFile,"\"%s.i1.i1z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i1.i1z\"");
 	}
 	void getInput2()const
 	{
-		fprintf(mFile,"\"%s.i2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i2\"");
 	}
 	void getInput2X()const
 	{
-		fprintf(mFile,"\"%s.i2.i2x\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i2.i2x\"");
 	}
 	void getInput2Y()const
 	{
-		fprintf(mFile,"\"%s.i2.i2y\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i2.i2y\"");
 	}
 	void getInput2Z()const
 	{
-		fprintf(mFile,"\"%s.i2.i2z\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i2.i2z\"");
 	}
 	void getMatrix()const
 	{
-		fprintf(mFile,"\"%s.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".m\"");
 	}
 	void getNormalizeOutput()const
 	{
-		fprintf(mFile,"\"%s.no\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".no\"");
 	}
 	void getOutput()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 	void getOutputX()const
 	{
-		fprintf(mFile,"\"%s.o.ox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.ox\"");
 	}
 	void getOutputY()const
 	{
-		fprintf(mFile,"\"%s.o.oy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oy\"");
 	}
 	void getOutputZ()const
 	{
-		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o.oz\"");
 	}
 protected:
 	VectorProduct(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
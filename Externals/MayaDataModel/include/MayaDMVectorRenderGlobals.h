@@ -27,171 +27,171 @@ public:
 	void setCurrentFrame(bool cf)
 	{
 		if(cf == false) return;
-		fprintf(mFile,"\tsetAttr \".cf\" %i;\n", cf);
+		writeInt(mFile,"\tsetAttr \".cf\" ",cf,";\n");
 	}
 	void setFrameRate(int fr)
 	{
 		if(fr == 12) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %i;\n", fr);
+		writeInt(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setSvgAnimation(unsigned int sa)
 	{
 		if(sa == 0) return;
-		fprintf(mFile,"\tsetAttr \".sa\" %i;\n", sa);
+		writeInt(mFile,"\tsetAttr \".sa\" ",sa,";\n");
 	}
 	void setSvgCompression(bool sc)
 	{
 		if(sc == false) return;
-		fprintf(mFile,"\tsetAttr \".sc\" %i;\n", sc);
+		writeInt(mFile,"\tsetAttr \".sc\" ",sc,";\n");
 	}
 	void setFlashVersion(unsigned int fv)
 	{
 		if(fv == 2) return;
-		fprintf(mFile,"\tsetAttr \".fv\" %i;\n", fv);
+		writeInt(mFile,"\tsetAttr \".fv\" ",fv,";\n");
 	}
 	void setBrowserView(bool bv)
 	{
 		if(bv == false) return;
-		fprintf(mFile,"\tsetAttr \".bv\" %i;\n", bv);
+		writeInt(mFile,"\tsetAttr \".bv\" ",bv,";\n");
 	}
 	void setShowBackFaces(bool sb)
 	{
 		if(sb == true) return;
-		fprintf(mFile,"\tsetAttr \".sb\" %i;\n", sb);
+		writeInt(mFile,"\tsetAttr \".sb\" ",sb,";\n");
 	}
 	void setShadows(bool sh)
 	{
 		if(sh == false) return;
-		fprintf(mFile,"\tsetAttr \".sh\" %i;\n", sh);
+		writeInt(mFile,"\tsetAttr \".sh\" ",sh,";\n");
 	}
 	void setHighlights(bool hi)
 	{
 		if(hi == false) return;
-		fprintf(mFile,"\tsetAttr \".hi\" %i;\n", hi);
+		writeInt(mFile,"\tsetAttr \".hi\" ",hi,";\n");
 	}
 	void setHighlightLevel(short hl)
 	{
 		if(hl == 4) return;
-		fprintf(mFile,"\tsetAttr \".hl\" %i;\n", hl);
+		writeInt(mFile,"\tsetAttr \".hl\" ",hl,";\n");
 	}
 	void setReflections(bool rf)
 	{
 		if(rf == false) return;
-		fprintf(mFile,"\tsetAttr \".rf\" %i;\n", rf);
+		writeInt(mFile,"\tsetAttr \".rf\" ",rf,";\n");
 	}
 	void setReflectionDepth(short rd)
 	{
 		if(rd == 2) return;
-		fprintf(mFile,"\tsetAttr \".rd\" %i;\n", rd);
+		writeInt(mFile,"\tsetAttr \".rd\" ",rd,";\n");
 	}
 	void setCombineFillsEdges(bool cfe)
 	{
 		if(cfe == false) return;
-		fprintf(mFile,"\tsetAttr \".cfe\" %i;\n", cfe);
+		writeInt(mFile,"\tsetAttr \".cfe\" ",cfe,";\n");
 	}
 	void setCurveTolerance(double ct)
 	{
 		if(ct == 7.5) return;
-		fprintf(mFile,"\tsetAttr \".ct\" %f;\n", ct);
+		writeFloat(mFile,"\tsetAttr \".ct\" ",ct,";\n");
 	}
 	void setSecondaryCF(bool scf)
 	{
 		if(scf == false) return;
-		fprintf(mFile,"\tsetAttr \".scf\" %i;\n", scf);
+		writeInt(mFile,"\tsetAttr \".scf\" ",scf,";\n");
 	}
 	void setDetailLevel(short dl)
 	{
 		if(dl == 0) return;
-		fprintf(mFile,"\tsetAttr \".dl\" %i;\n", dl);
+		writeInt(mFile,"\tsetAttr \".dl\" ",dl,";\n");
 	}
 	void setIncludeEdges(bool ie)
 	{
 		if(ie == false) return;
-		fprintf(mFile,"\tsetAttr \".ie\" %i;\n", ie);
+		writeInt(mFile,"\tsetAttr \".ie\" ",ie,";\n");
 	}
 	void setRenderOptimization(const string& rno)
 	{
 		if(rno == "Safe") return;
-		fprintf(mFile,"\tsetAttr \".rno\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".rno\" -type \"string\" ");
 		rno.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFillObjects(bool fo)
 	{
 		if(fo == true) return;
-		fprintf(mFile,"\tsetAttr \".fo\" %i;\n", fo);
+		writeInt(mFile,"\tsetAttr \".fo\" ",fo,";\n");
 	}
 	void setFillStyle(unsigned int fs)
 	{
 		if(fs == 0) return;
-		fprintf(mFile,"\tsetAttr \".fs\" %i;\n", fs);
+		writeInt(mFile,"\tsetAttr \".fs\" ",fs,";\n");
 	}
 	void setEdgeStyle(unsigned int es)
 	{
 		if(es == 0) return;
-		fprintf(mFile,"\tsetAttr \".es\" %i;\n", es);
+		writeInt(mFile,"\tsetAttr \".es\" ",es,";\n");
 	}
 	void setHiddenEdges(bool he)
 	{
 		if(he == false) return;
-		fprintf(mFile,"\tsetAttr \".he\" %i;\n", he);
+		writeInt(mFile,"\tsetAttr \".he\" ",he,";\n");
 	}
 	void setEdgeDetail(bool ed)
 	{
 		if(ed == false) return;
-		fprintf(mFile,"\tsetAttr \".ed\" %i;\n", ed);
+		writeInt(mFile,"\tsetAttr \".ed\" ",ed,";\n");
 	}
 	void setOutlinesAtIntersections(bool oai)
 	{
 		if(oai == true) return;
-		fprintf(mFile,"\tsetAttr \".oai\" %i;\n", oai);
+		writeInt(mFile,"\tsetAttr \".oai\" ",oai,";\n");
 	}
 	void setMinEdgeAngle(double mea)
 	{
 		if(mea == 90.0) return;
-		fprintf(mFile,"\tsetAttr \".mea\" %f;\n", mea);
+		writeFloat(mFile,"\tsetAttr \".mea\" ",mea,";\n");
 	}
 	void setEdgeColor(const float3& ec)
 	{
-		fprintf(mFile,"\tsetAttr \".ec\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ec\" -type \"float3\" ");
 		ec.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setEdgeColorR(float ecr)
 	{
 		if(ecr == 0) return;
-		fprintf(mFile,"\tsetAttr \".ec.ecr\" %f;\n", ecr);
+		writeFloat(mFile,"\tsetAttr \".ec.ecr\" ",ecr,";\n");
 	}
 	void setEdgeColorG(float ecg)
 	{
 		if(ecg == 0) return;
-		fprintf(mFile,"\tsetAttr \".ec.ecg\" %f;\n", ecg);
+		writeFloat(mFile,"\tsetAttr \".ec.ecg\" ",ecg,";\n");
 	}
 	void setEdgeColorB(float ecb)
 	{
 		if(ecb == 0) return;
-		fprintf(mFile,"\tsetAttr \".ec.ecb\" %f;\n", ecb);
+		writeFloat(mFile,"\tsetAttr \".ec.ecb\" ",ecb,";\n");
 	}
 	void setEdgeWeight(double ew)
 	{
 		if(ew == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ew\" %f;\n", ew);
+		writeFloat(mFile,"\tsetAttr \".ew\" ",ew,";\n");
 	}
 	void getImageNamePrefix()const
 	{
-		fprintf(mFile,"\"%s.inp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".inp\"");
 	}
 	void getImageFormat()const
 	{
-		fprintf(mFile,"\"%s.if\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".if\"");
 	}
 	void getPixelAspectRatio()const
 	{
-		fprintf(mFile,"\"%s.par\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".par\"");
 	}
 	void getFilenameFormat()const
 	{
-		fprintf(mFile,"\"%s.ff\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ff\"");
 	}
 protected:
 	VectorRenderGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -27,164 +27,164 @@ public:
 	void setBakeColor(bool color)
 	{
 		if(color == 1) return;
-		fprintf(mFile,"\tsetAttr \".color\" %i;\n", color);
+		writeInt(mFile,"\tsetAttr \".color\" ",color,";\n");
 	}
 	void setColorBlending(unsigned int cblend)
 	{
 		if(cblend == 0) return;
-		fprintf(mFile,"\tsetAttr \".cblend\" %i;\n", cblend);
+		writeInt(mFile,"\tsetAttr \".cblend\" ",cblend,";\n");
 	}
 	void setAlphaBlending(unsigned int ablend)
 	{
 		if(ablend == 0) return;
-		fprintf(mFile,"\tsetAttr \".ablend\" %i;\n", ablend);
+		writeInt(mFile,"\tsetAttr \".ablend\" ",ablend,";\n");
 	}
 	void setScaleRgba(float scale)
 	{
 		if(scale == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".scale\" %f;\n", scale);
+		writeFloat(mFile,"\tsetAttr \".scale\" ",scale,";\n");
 	}
 	void setClampMin(bool min)
 	{
 		if(min == 0) return;
-		fprintf(mFile,"\tsetAttr \".min\" %i;\n", min);
+		writeInt(mFile,"\tsetAttr \".min\" ",min,";\n");
 	}
 	void setMinColor(const float3& lc)
 	{
-		fprintf(mFile,"\tsetAttr \".lc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".lc\" -type \"float3\" ");
 		lc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMinColorR(float lr)
 	{
 		if(lr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lr\" %f;\n", lr);
+		writeFloat(mFile,"\tsetAttr \".lc.lr\" ",lr,";\n");
 	}
 	void setMinColorG(float lg)
 	{
 		if(lg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lg\" %f;\n", lg);
+		writeFloat(mFile,"\tsetAttr \".lc.lg\" ",lg,";\n");
 	}
 	void setMinColorB(float lb)
 	{
 		if(lb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".lc.lb\" %f;\n", lb);
+		writeFloat(mFile,"\tsetAttr \".lc.lb\" ",lb,";\n");
 	}
 	void setMinAlpha(float mina)
 	{
 		if(mina == 0) return;
-		fprintf(mFile,"\tsetAttr \".mina\" %f;\n", mina);
+		writeFloat(mFile,"\tsetAttr \".mina\" ",mina,";\n");
 	}
 	void setClampMax(bool max)
 	{
 		if(max == 0) return;
-		fprintf(mFile,"\tsetAttr \".max\" %i;\n", max);
+		writeInt(mFile,"\tsetAttr \".max\" ",max,";\n");
 	}
 	void setMaxColor(const float3& hc)
 	{
-		fprintf(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".hc\" -type \"float3\" ");
 		hc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMaxColorR(float hr)
 	{
 		if(hr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hr\" %f;\n", hr);
+		writeFloat(mFile,"\tsetAttr \".hc.hr\" ",hr,";\n");
 	}
 	void setMaxColorG(float hg)
 	{
 		if(hg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hg\" %f;\n", hg);
+		writeFloat(mFile,"\tsetAttr \".hc.hg\" ",hg,";\n");
 	}
 	void setMaxColorB(float hb)
 	{
 		if(hb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".hc.hb\" %f;\n", hb);
+		writeFloat(mFile,"\tsetAttr \".hc.hb\" ",hb,";\n");
 	}
 	void setMaxAlpha(float maxa)
 	{
 		if(maxa == 1) return;
-		fprintf(mFile,"\tsetAttr \".maxa\" %f;\n", maxa);
+		writeFloat(mFile,"\tsetAttr \".maxa\" ",maxa,";\n");
 	}
 	void setUseFaceNormals(bool ufn)
 	{
 		if(ufn == 0) return;
-		fprintf(mFile,"\tsetAttr \".ufn\" %i;\n", ufn);
+		writeInt(mFile,"\tsetAttr \".ufn\" ",ufn,";\n");
 	}
 	void setColorSetName(const string& csn)
 	{
 		if(csn == "NULL") return;
-		fprintf(mFile,"\tsetAttr \".csn\" -type \"string\" ");
+		writeString(mFile,"\tsetAttr \".csn\" -type \"string\" ");
 		csn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getSharedVertices()const
 	{
-		fprintf(mFile,"\"%s.shared\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".shared\"");
 	}
 	void getBakeColor()const
 	{
-		fprintf(mFile,"\"%s.color\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".color\"");
 	}
 	void getColorBlending()const
 	{
-		fprintf(mFile,"\"%s.cblend\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cblend\"");
 	}
 	void getAlphaBlending()const
 	{
-		fprintf(mFile,"\"%s.ablend\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ablend\"");
 	}
 	void getScaleRgba()const
 	{
-		fprintf(mFile,"\"%s.scale\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".scale\"");
 	}
 	void getClampMin()const
 	{
-		fprintf(mFile,"\"%s.min\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".min\"");
 	}
 	void getMinColorR()const
 	{
-		fprintf(mFile,"\"%s.lc.lr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lr\"");
 	}
 	void getMinColorG()const
 	{
-		fprintf(mFile,"\"%s.lc.lg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lg\"");
 	}
 	void getMinColorB()const
 	{
-		fprintf(mFile,"\"%s.lc.lb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lc.lb\"");
 	}
 	void getMinAlpha()const
 	{
-		fprintf(mFile,"\"%s.mina\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mina\"");
 	}
 	void getClampMax()const
 	{
-		fprintf(mFile,"\"%s.max\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".max\"");
 	}
 	void getMaxColorR()const
 	{
-		fprintf(mFile,"\"%s.hc.hr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hr\"");
 	}
 	void getMaxColorG()const
 	{
-		fprintf(mFile,"\"%s.hc.hg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hg\"");
 	}
 	void getMaxColorB()const
 	{
-		fprintf(mFile,"\"%s.hc.hb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".hc.hb\"");
 	}
 	void getMaxAlpha()const
 	{
-		fprintf(mFile,"\"%s.maxa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".maxa\"");
 	}
 	void getUseFaceNormals()const
 	{
-		fprintf(mFile,"\"%s.ufn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ufn\"");
 	}
 	void getColorSetName()const
 	{
-		fprintf(mFile,"\"%s.csn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".csn\"");
 	}
 protected:
 	VertexBakeSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
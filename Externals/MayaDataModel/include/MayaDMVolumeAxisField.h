@@ -27,212 +27,212 @@ public:
 	void setInvertAttenuation(bool ia)
 	{
 		if(ia == false) return;
-		fprintf(mFile,"\tsetAttr \".ia\" %i;\n", ia);
+		writeInt(mFile,"\tsetAttr \".ia\" ",ia,";\n");
 	}
 	void setAwayFromCenter(double afc)
 	{
 		if(afc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".afc\" %f;\n", afc);
+		writeFloat(mFile,"\tsetAttr \".afc\" ",afc,";\n");
 	}
 	void setAwayFromAxis(double afa)
 	{
 		if(afa == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".afa\" %f;\n", afa);
+		writeFloat(mFile,"\tsetAttr \".afa\" ",afa,";\n");
 	}
 	void setAlongAxis(double alx)
 	{
 		if(alx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".alx\" %f;\n", alx);
+		writeFloat(mFile,"\tsetAttr \".alx\" ",alx,";\n");
 	}
 	void setAroundAxis(double arx)
 	{
 		if(arx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".arx\" %f;\n", arx);
+		writeFloat(mFile,"\tsetAttr \".arx\" ",arx,";\n");
 	}
 	void setDirectionalSpeed(double drs)
 	{
 		if(drs == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".drs\" %f;\n", drs);
+		writeFloat(mFile,"\tsetAttr \".drs\" ",drs,";\n");
 	}
 	void setDirection(const double3& d)
 	{
-		fprintf(mFile,"\tsetAttr \".d\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"double3\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDirectionX(double dx)
 	{
 		if(dx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dx\" %f;\n", dx);
+		writeFloat(mFile,"\tsetAttr \".d.dx\" ",dx,";\n");
 	}
 	void setDirectionY(double dy)
 	{
 		if(dy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dy\" %f;\n", dy);
+		writeFloat(mFile,"\tsetAttr \".d.dy\" ",dy,";\n");
 	}
 	void setDirectionZ(double dz)
 	{
 		if(dz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dz\" %f;\n", dz);
+		writeFloat(mFile,"\tsetAttr \".d.dz\" ",dz,";\n");
 	}
 	void setDisplaySpeed(bool dss)
 	{
 		if(dss == true) return;
-		fprintf(mFile,"\tsetAttr \".dss\" %i;\n", dss);
+		writeInt(mFile,"\tsetAttr \".dss\" ",dss,";\n");
 	}
 	void setTurbulence(double trb)
 	{
 		if(trb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".trb\" %f;\n", trb);
+		writeFloat(mFile,"\tsetAttr \".trb\" ",trb,";\n");
 	}
 	void setTurbulenceSpeed(double trs)
 	{
 		if(trs == 0.2) return;
-		fprintf(mFile,"\tsetAttr \".trs\" %f;\n", trs);
+		writeFloat(mFile,"\tsetAttr \".trs\" ",trs,";\n");
 	}
 	void setTurbulenceFrequency(const double3& tf)
 	{
-		fprintf(mFile,"\tsetAttr \".tf\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".tf\" -type \"double3\" ");
 		tf.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTurbulenceFrequencyX(double tfx)
 	{
 		if(tfx == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfx\" %f;\n", tfx);
+		writeFloat(mFile,"\tsetAttr \".tf.tfx\" ",tfx,";\n");
 	}
 	void setTurbulenceFrequencyY(double tfy)
 	{
 		if(tfy == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfy\" %f;\n", tfy);
+		writeFloat(mFile,"\tsetAttr \".tf.tfy\" ",tfy,";\n");
 	}
 	void setTurbulenceFrequencyZ(double tfz)
 	{
 		if(tfz == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".tf.tfz\" %f;\n", tfz);
+		writeFloat(mFile,"\tsetAttr \".tf.tfz\" ",tfz,";\n");
 	}
 	void setTurbulenceOffset(const double3& to)
 	{
-		fprintf(mFile,"\tsetAttr \".to\" -type \"double3\" ");
+		writeString(mFile,"\tsetAttr \".to\" -type \"double3\" ");
 		to.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTurbulenceOffsetX(double tox)
 	{
 		if(tox == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.tox\" %f;\n", tox);
+		writeFloat(mFile,"\tsetAttr \".to.tox\" ",tox,";\n");
 	}
 	void setTurbulenceOffsetY(double toy)
 	{
 		if(toy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.toy\" %f;\n", toy);
+		writeFloat(mFile,"\tsetAttr \".to.toy\" ",toy,";\n");
 	}
 	void setTurbulenceOffsetZ(double toz)
 	{
 		if(toz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".to.toz\" %f;\n", toz);
+		writeFloat(mFile,"\tsetAttr \".to.toz\" ",toz,";\n");
 	}
 	void setDetailTurbulence(double dtr)
 	{
 		if(dtr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".dtr\" %f;\n", dtr);
+		writeFloat(mFile,"\tsetAttr \".dtr\" ",dtr,";\n");
 	}
 	void setTime(double tim)
 	{
 		if(tim == 0) return;
-		fprintf(mFile,"\tsetAttr \".tim\" %f;\n", tim);
+		writeFloat(mFile,"\tsetAttr \".tim\" ",tim,";\n");
 	}
 	void getInvertAttenuation()const
 	{
-		fprintf(mFile,"\"%s.ia\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ia\"");
 	}
 	void getAwayFromCenter()const
 	{
-		fprintf(mFile,"\"%s.afc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".afc\"");
 	}
 	void getAwayFromAxis()const
 	{
-		fprintf(mFile,"\"%s.afa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".afa\"");
 	}
 	void getAlongAxis()const
 	{
-		fprintf(mFile,"\"%s.alx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".alx\"");
 	}
 	void getAroundAxis()const
 	{
-		fprintf(mFile,"\"%s.arx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".arx\"");
 	}
 	void getDirectionalSpeed()const
 	{
-		fprintf(mFile,"\"%s.drs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drs\"");
 	}
 	void getDirection()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDirectionX()const
 	{
-		fprintf(mFile,"\"%s.d.dx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dx\"");
 	}
 	void getDirectionY()const
 	{
-		fprintf(mFile,"\"%s.d.dy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dy\"");
 	}
 	void getDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.d.dz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dz\"");
 	}
 	void getDisplaySpeed()const
 	{
-		fprintf(mFile,"\"%s.dss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dss\"");
 	}
 	void getTurbulence()const
 	{
-		fprintf(mFile,"\"%s.trb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trb\"");
 	}
 	void getTurbulenceSpeed()const
 	{
-		fprintf(mFile,"\"%s.trs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".trs\"");
 	}
 	void getTurbulenceFrequency()const
 	{
-		fprintf(mFile,"\"%s.tf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf\"");
 	}
 	void getTurbulenceFrequencyX()const
 	{
-		fprintf(mFile,"\"%s.tf.tfx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfx\"");
 	}
 	void getTurbulenceFrequencyY()const
 	{
-		fprintf(mFile,"\"%s.tf.tfy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfy\"");
 	}
 	void getTurbulenceFrequencyZ()const
 	{
-		fprintf(mFile,"\"%s.tf.tfz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tf.tfz\"");
 	}
 	void getTurbulenceOffset()const
 	{
-		fprintf(mFile,"\"%s.to\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to\"");
 	}
 	void getTurbulenceOffsetX()const
 	{
-		fprintf(mFile,"\"%s.to.tox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.tox\"");
 	}
 	void getTurbulenceOffsetY()const
 	{
-		fprintf(mFile,"\"%s.to.toy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.toy\"");
 	}
 	void getTurbulenceOffsetZ()const
 	{
-		fprintf(mFile,"\"%s.to.toz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".to.toz\"");
 	}
 	void getDetailTurbulence()const
 	{
-		fprintf(mFile,"\"%s.dtr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dtr\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.tim\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".tim\"");
 	}
 protected:
 	VolumeAxisField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -23,10 +23,10 @@ public:
 		unsigned int colorRamp_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", colorRamp_Position);
+			writeFloat(file,"",colorRamp_Position," ");
 			colorRamp_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", colorRamp_Interp);
+			writeString(file," ");
+			writeInt(file,"",colorRamp_Interp);
 		}
 	};
 public:
@@ -38,639 +38,639 @@ public:
 
 	void setColor(const float3& cl)
 	{
-		fprintf(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".cl\" -type \"float3\" ");
 		cl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorR(float cr)
 	{
 		if(cr == 0.9) return;
-		fprintf(mFile,"\tsetAttr \".cl.cr\" %f;\n", cr);
+		writeFloat(mFile,"\tsetAttr \".cl.cr\" ",cr,";\n");
 	}
 	void setColorG(float cg)
 	{
 		if(cg == 0.9) return;
-		fprintf(mFile,"\tsetAttr \".cl.cg\" %f;\n", cg);
+		writeFloat(mFile,"\tsetAttr \".cl.cg\" ",cg,";\n");
 	}
 	void setColorB(float cb)
 	{
 		if(cb == 0.9) return;
-		fprintf(mFile,"\tsetAttr \".cl.cb\" %f;\n", cb);
+		writeFloat(mFile,"\tsetAttr \".cl.cb\" ",cb,";\n");
 	}
 	void setColorRampInput(unsigned int cri)
 	{
 		if(cri == 0) return;
-		fprintf(mFile,"\tsetAttr \".cri\" %i;\n", cri);
+		writeInt(mFile,"\tsetAttr \".cri\" ",cri,";\n");
 	}
 	void setColorRamp(size_t crm_i,const ColorRamp& crm)
 	{
-		fprintf(mFile,"\tsetAttr \".crm[%i]\" ",crm_i);
+		writeInt(mFile,"\tsetAttr \".crm[",crm_i,"]\" ");
 		crm.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorRamp(size_t crm_start,size_t crm_end,ColorRamp* crm)
 	{
-		fprintf(mFile,"\tsetAttr \".crm[%i:%i]\" ", crm_start,crm_end);
+		writeInt(mFile,"\tsetAttr \".crm[",crm_start); writeInt(mFile,":",crm_end,"]\" ");
 		size_t size = (crm_end-crm_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			crm[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColorRamp(size_t crm_start,size_t crm_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".crm[%i:%i]\"",crm_start,crm_end);
-		fprintf(mFile," -type \"ColorRamp\" ");
+		writeInt(mFile,"\tsetAttr \".crm[",crm_start); writeInt(mFile,":",crm_end,"]\"");
+		writeString(mFile," -type \"ColorRamp\" ");
 	}
 	void appendColorRamp(const ColorRamp& crm)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		crm.write(mFile);
 	}
 	void endColorRamp()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorRamp_Position(size_t crm_i,float crmp)
 	{
 		if(crmp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crm[%i].crmp\" %f;\n", crm_i,crmp);
+		writeInt(mFile,"\tsetAttr \".crm[",crm_i); writeFloat(mFile,"].crmp\" ",crmp,";\n");
 	}
 	void setColorRamp_Color(size_t crm_i,const float3& crmc)
 	{
-		fprintf(mFile,"\tsetAttr \".crm[%i].crmc\" -type \"float3\" ",crm_i);
+		writeInt(mFile,"\tsetAttr \".crm[",crm_i,"].crmc\" -type \"float3\" ");
 		crmc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorRamp_ColorR(size_t crm_i,float crmcr)
 	{
 		if(crmcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crm[%i].crmc.crmcr\" %f;\n", crm_i,crmcr);
+		writeInt(mFile,"\tsetAttr \".crm[",crm_i); writeFloat(mFile,"].crmc.crmcr\" ",crmcr,";\n");
 	}
 	void setColorRamp_ColorG(size_t crm_i,float crmcg)
 	{
 		if(crmcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crm[%i].crmc.crmcg\" %f;\n", crm_i,crmcg);
+		writeInt(mFile,"\tsetAttr \".crm[",crm_i); writeFloat(mFile,"].crmc.crmcg\" ",crmcg,";\n");
 	}
 	void setColorRamp_ColorB(size_t crm_i,float crmcb)
 	{
 		if(crmcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crm[%i].crmc.crmcb\" %f;\n", crm_i,crmcb);
+		writeInt(mFile,"\tsetAttr \".crm[",crm_i); writeFloat(mFile,"].crmc.crmcb\" ",crmcb,";\n");
 	}
 	void setColorRamp_Interp(size_t crm_i,unsigned int crmi)
 	{
 		if(crmi == 0) return;
-		fprintf(mFile,"\tsetAttr \".crm[%i].crmi\" %i;\n", crm_i,crmi);
+		writeInt(mFile,"\tsetAttr \".crm[",crm_i); writeInt(mFile,"].crmi\" ",crmi,";\n");
 	}
 	void setTransparency(const float3& t)
 	{
-		fprintf(mFile,"\tsetAttr \".t\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".t\" -type \"float3\" ");
 		t.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setTransparencyR(float tr)
 	{
 		if(tr == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".t.tr\" %f;\n", tr);
+		writeFloat(mFile,"\tsetAttr \".t.tr\" ",tr,";\n");
 	}
 	void setTransparencyG(float tg)
 	{
 		if(tg == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".t.tg\" %f;\n", tg);
+		writeFloat(mFile,"\tsetAttr \".t.tg\" ",tg,";\n");
 	}
 	void setTransparencyB(float tb)
 	{
 		if(tb == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".t.tb\" %f;\n", tb);
+		writeFloat(mFile,"\tsetAttr \".t.tb\" ",tb,";\n");
 	}
 	void setIncandescence(const float3& ic)
 	{
-		fprintf(mFile,"\tsetAttr \".ic\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ic\" -type \"float3\" ");
 		ic.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setIncandescenceR(float ir)
 	{
 		if(ir == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ir\" %f;\n", ir);
+		writeFloat(mFile,"\tsetAttr \".ic.ir\" ",ir,";\n");
 	}
 	void setIncandescenceG(float ig)
 	{
 		if(ig == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ig\" %f;\n", ig);
+		writeFloat(mFile,"\tsetAttr \".ic.ig\" ",ig,";\n");
 	}
 	void setIncandescenceB(float ib)
 	{
 		if(ib == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ic.ib\" %f;\n", ib);
+		writeFloat(mFile,"\tsetAttr \".ic.ib\" ",ib,";\n");
 	}
 	void setGlowIntensity(float gi)
 	{
 		if(gi == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gi\" %f;\n", gi);
+		writeFloat(mFile,"\tsetAttr \".gi\" ",gi,";\n");
 	}
 	void setDensity(float dns)
 	{
 		if(dns == 1) return;
-		fprintf(mFile,"\tsetAttr \".dns\" %f;\n", dns);
+		writeFloat(mFile,"\tsetAttr \".dns\" ",dns,";\n");
 	}
 	void setDensityMode(unsigned int dmd)
 	{
 		if(dmd == 1) return;
-		fprintf(mFile,"\tsetAttr \".dmd\" %i;\n", dmd);
+		writeInt(mFile,"\tsetAttr \".dmd\" ",dmd,";\n");
 	}
 	void setDropoffShape(unsigned int dos)
 	{
 		if(dos == 0) return;
-		fprintf(mFile,"\tsetAttr \".dos\" %i;\n", dos);
+		writeInt(mFile,"\tsetAttr \".dos\" ",dos,";\n");
 	}
 	void setEdgeDropoff(float edr)
 	{
 		if(edr == .5) return;
-		fprintf(mFile,"\tsetAttr \".edr\" %f;\n", edr);
+		writeFloat(mFile,"\tsetAttr \".edr\" ",edr,";\n");
 	}
 	void setAxialDropoff(float axd)
 	{
 		if(axd == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".axd\" %f;\n", axd);
+		writeFloat(mFile,"\tsetAttr \".axd\" ",axd,";\n");
 	}
 	void setDropoffMethod(unsigned int drm)
 	{
 		if(drm == 0) return;
-		fprintf(mFile,"\tsetAttr \".drm\" %i;\n", drm);
+		writeInt(mFile,"\tsetAttr \".drm\" ",drm,";\n");
 	}
 	void setDropoffSubtract(float drs)
 	{
 		if(drs == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".drs\" %f;\n", drs);
+		writeFloat(mFile,"\tsetAttr \".drs\" ",drs,";\n");
 	}
 	void setIlluminated(bool il)
 	{
 		if(il == false) return;
-		fprintf(mFile,"\tsetAttr \".il\" %i;\n", il);
+		writeInt(mFile,"\tsetAttr \".il\" ",il,";\n");
 	}
 	void setLightScatter(float lsc)
 	{
 		if(lsc == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".lsc\" %f;\n", lsc);
+		writeFloat(mFile,"\tsetAttr \".lsc\" ",lsc,";\n");
 	}
 	void setMatteOpacityMode(unsigned int mom)
 	{
 		if(mom == 2) return;
-		fprintf(mFile,"\tsetAttr \".mom\" %i;\n", mom);
+		writeInt(mFile,"\tsetAttr \".mom\" ",mom,";\n");
 	}
 	void setMatteOpacity(float mog)
 	{
 		if(mog == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".mog\" %f;\n", mog);
+		writeFloat(mFile,"\tsetAttr \".mog\" ",mog,";\n");
 	}
 	void getRayDirection()const
 	{
-		fprintf(mFile,"\"%s.rad\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad\"");
 	}
 	void getRayDirectionX()const
 	{
-		fprintf(mFile,"\"%s.rad.rdx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdx\"");
 	}
 	void getRayDirectionY()const
 	{
-		fprintf(mFile,"\"%s.rad.rdy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdy\"");
 	}
 	void getRayDirectionZ()const
 	{
-		fprintf(mFile,"\"%s.rad.rdz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rad.rdz\"");
 	}
 	void getPointWorld()const
 	{
-		fprintf(mFile,"\"%s.pw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw\"");
 	}
 	void getPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.pw.pwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwx\"");
 	}
 	void getPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.pw.pwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwy\"");
 	}
 	void getPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.pw.pwz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pw.pwz\"");
 	}
 	void getFarPointWorld()const
 	{
-		fprintf(mFile,"\"%s.fw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw\"");
 	}
 	void getFarPointWorldX()const
 	{
-		fprintf(mFile,"\"%s.fw.fwx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwx\"");
 	}
 	void getFarPointWorldY()const
 	{
-		fprintf(mFile,"\"%s.fw.fwy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwy\"");
 	}
 	void getFarPointWorldZ()const
 	{
-		fprintf(mFile,"\"%s.fw.fwz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fw.fwz\"");
 	}
 	void getPointObj()const
 	{
-		fprintf(mFile,"\"%s.po\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po\"");
 	}
 	void getPointObjX()const
 	{
-		fprintf(mFile,"\"%s.po.pox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.pox\"");
 	}
 	void getPointObjY()const
 	{
-		fprintf(mFile,"\"%s.po.poy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poy\"");
 	}
 	void getPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.po.poz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".po.poz\"");
 	}
 	void getFarPointObj()const
 	{
-		fprintf(mFile,"\"%s.fo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo\"");
 	}
 	void getFarPointObjectX()const
 	{
-		fprintf(mFile,"\"%s.fo.fox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo.fox\"");
 	}
 	void getFarPointObjectY()const
 	{
-		fprintf(mFile,"\"%s.fo.foy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo.foy\"");
 	}
 	void getFarPointObjectZ()const
 	{
-		fprintf(mFile,"\"%s.fo.foz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fo.foz\"");
 	}
 	void getMatrixWorldToEye()const
 	{
-		fprintf(mFile,"\"%s.wte\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wte\"");
 	}
 	void getLightDataArray(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i]\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"]\"");
 	}
 	void getLightDataArray()const
 	{
 
-		fprintf(mFile,"\"%s.ltd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd\"");
 	}
 	void getLightDirection(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld\"");
 	}
 	void getLightDirection()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld\"");
 	}
 	void getLightDirectionX(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldx\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldx\"");
 	}
 	void getLightDirectionX()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldx\"");
 	}
 	void getLightDirectionY(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldy\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldy\"");
 	}
 	void getLightDirectionY()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldy\"");
 	}
 	void getLightDirectionZ(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ld.ldz\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ld.ldz\"");
 	}
 	void getLightDirectionZ()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ld.ldz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ld.ldz\"");
 	}
 	void getLightIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li\"");
 	}
 	void getLightIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li\"");
 	}
 	void getLightIntensityR(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lir\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lir\"");
 	}
 	void getLightIntensityR()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lir\"");
 	}
 	void getLightIntensityG(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lig\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lig\"");
 	}
 	void getLightIntensityG()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lig\"");
 	}
 	void getLightIntensityB(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].li.lib\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].li.lib\"");
 	}
 	void getLightIntensityB()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.li.lib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.li.lib\"");
 	}
 	void getLightAmbient(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].la\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].la\"");
 	}
 	void getLightAmbient()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.la\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.la\"");
 	}
 	void getLightDiffuse(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ldf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ldf\"");
 	}
 	void getLightDiffuse()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ldf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ldf\"");
 	}
 	void getLightSpecular(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].ls\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].ls\"");
 	}
 	void getLightSpecular()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.ls\"");
 	}
 	void getLightShadowFraction(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lsf\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lsf\"");
 	}
 	void getLightShadowFraction()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lsf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lsf\"");
 	}
 	void getPreShadowIntensity(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].psi\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].psi\"");
 	}
 	void getPreShadowIntensity()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.psi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.psi\"");
 	}
 	void getLightBlindData(size_t ltd_i)const
 	{
-		fprintf(mFile,"\"%s.ltd[%i].lbd\"",mName.c_str(),ltd_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".ltd[",ltd_i,"].lbd\"");
 	}
 	void getLightBlindData()const
 	{
 
-		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ltd.lbd\"");
 	}
 	void getColor()const
 	{
-		fprintf(mFile,"\"%s.cl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl\"");
 	}
 	void getColorR()const
 	{
-		fprintf(mFile,"\"%s.cl.cr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cr\"");
 	}
 	void getColorG()const
 	{
-		fprintf(mFile,"\"%s.cl.cg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cg\"");
 	}
 	void getColorB()const
 	{
-		fprintf(mFile,"\"%s.cl.cb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cl.cb\"");
 	}
 	void getColorRampInput()const
 	{
-		fprintf(mFile,"\"%s.cri\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cri\"");
 	}
 	void getColorRamp(size_t crm_i)const
 	{
-		fprintf(mFile,"\"%s.crm[%i]\"",mName.c_str(),crm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crm[",crm_i,"]\"");
 	}
 	void getColorRamp()const
 	{
 
-		fprintf(mFile,"\"%s.crm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crm\"");
 	}
 	void getColorRamp_Position(size_t crm_i)const
 	{
-		fprintf(mFile,"\"%s.crm[%i].crmp\"",mName.c_str(),crm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crm[",crm_i,"].crmp\"");
 	}
 	void getColorRamp_Position()const
 	{
 
-		fprintf(mFile,"\"%s.crm.crmp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crm.crmp\"");
 	}
 	void getColorRamp_Color(size_t crm_i)const
 	{
-		fprintf(mFile,"\"%s.crm[%i].crmc\"",mName.c_str(),crm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crm[",crm_i,"].crmc\"");
 	}
 	void getColorRamp_Color()const
 	{
 
-		fprintf(mFile,"\"%s.crm.crmc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crm.crmc\"");
 	}
 	void getColorRamp_ColorR(size_t crm_i)const
 	{
-		fprintf(mFile,"\"%s.crm[%i].crmc.crmcr\"",mName.c_str(),crm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crm[",crm_i,"].crmc.crmcr\"");
 	}
 	void getColorRamp_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.crm.crmc.crmcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crm.crmc.crmcr\"");
 	}
 	void getColorRamp_ColorG(size_t crm_i)const
 	{
-		fprintf(mFile,"\"%s.crm[%i].crmc.crmcg\"",mName.c_str(),crm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crm[",crm_i,"].crmc.crmcg\"");
 	}
 	void getColorRamp_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.crm.crmc.crmcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crm.crmc.crmcg\"");
 	}
 	void getColorRamp_ColorB(size_t crm_i)const
 	{
-		fprintf(mFile,"\"%s.crm[%i].crmc.crmcb\"",mName.c_str(),crm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crm[",crm_i,"].crmc.crmcb\"");
 	}
 	void getColorRamp_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.crm.crmc.crmcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crm.crmc.crmcb\"");
 	}
 	void getColorRamp_Interp(size_t crm_i)const
 	{
-		fprintf(mFile,"\"%s.crm[%i].crmi\"",mName.c_str(),crm_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crm[",crm_i,"].crmi\"");
 	}
 	void getColorRamp_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.crm.crmi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crm.crmi\"");
 	}
 	void getTransparency()const
 	{
-		fprintf(mFile,"\"%s.t\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t\"");
 	}
 	void getTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.t.tr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tr\"");
 	}
 	void getTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.t.tg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tg\"");
 	}
 	void getTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.t.tb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".t.tb\"");
 	}
 	void getIncandescence()const
 	{
-		fprintf(mFile,"\"%s.ic\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic\"");
 	}
 	void getIncandescenceR()const
 	{
-		fprintf(mFile,"\"%s.ic.ir\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ir\"");
 	}
 	void getIncandescenceG()const
 	{
-		fprintf(mFile,"\"%s.ic.ig\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ig\"");
 	}
 	void getIncandescenceB()const
 	{
-		fprintf(mFile,"\"%s.ic.ib\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ic.ib\"");
 	}
 	void getGlowIntensity()const
 	{
-		fprintf(mFile,"\"%s.gi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gi\"");
 	}
 	void getOutGlowColor()const
 	{
-		fprintf(mFile,"\"%s.ogc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc\"");
 	}
 	void getOutGlowColorR()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogr\"");
 	}
 	void getOutGlowColorG()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogg\"");
 	}
 	void getOutGlowColorB()const
 	{
-		fprintf(mFile,"\"%s.ogc.ogb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ogc.ogb\"");
 	}
 	void getDensity()const
 	{
-		fprintf(mFile,"\"%s.dns\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dns\"");
 	}
 	void getDensityMode()const
 	{
-		fprintf(mFile,"\"%s.dmd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dmd\"");
 	}
 	void getDropoffShape()const
 	{
-		fprintf(mFile,"\"%s.dos\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dos\"");
 	}
 	void getEdgeDropoff()const
 	{
-		fprintf(mFile,"\"%s.edr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".edr\"");
 	}
 	void getAxialDropoff()const
 	{
-		fprintf(mFile,"\"%s.axd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".axd\"");
 	}
 	void getDropoffMethod()const
 	{
-		fprintf(mFile,"\"%s.drm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drm\"");
 	}
 	void getDropoffSubtract()const
 	{
-		fprintf(mFile,"\"%s.drs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".drs\"");
 	}
 	void getIlluminated()const
 	{
-		fprintf(mFile,"\"%s.il\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".il\"");
 	}
 	void getLightScatter()const
 	{
-		fprintf(mFile,"\"%s.lsc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lsc\"");
 	}
 	void getMatteOpacityMode()const
 	{
-		fprintf(mFile,"\"%s.mom\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mom\"");
 	}
 	void getMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.mog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".mog\"");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 protected:
 	VolumeFog(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
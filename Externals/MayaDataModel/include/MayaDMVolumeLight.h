@@ -23,10 +23,10 @@ public:
 		unsigned int colorRange_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", colorRange_Position);
+			writeFloat(file,"",colorRange_Position," ");
 			colorRange_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", colorRange_Interp);
+			writeString(file," ");
+			writeInt(file,"",colorRange_Interp);
 		}
 	};
 	struct Penumbra{
@@ -35,9 +35,9 @@ public:
 		unsigned int penumbra_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", penumbra_Position);
-			fprintf(file,"%f ", penumbra_FloatValue);
-			fprintf(file,"%i", penumbra_Interp);
+			writeFloat(file,"",penumbra_Position," ");
+			writeFloat(file,"",penumbra_FloatValue," ");
+			writeInt(file,"",penumbra_Interp);
 		}
 	};
 public:
@@ -50,254 +50,254 @@ public:
 	void setLightShape(unsigned int lis)
 	{
 		if(lis == 1) return;
-		fprintf(mFile,"\tsetAttr \".lis\" %i;\n", lis);
+		writeInt(mFile,"\tsetAttr \".lis\" ",lis,";\n");
 	}
 	void setVolumeLightDir(unsigned int vld)
 	{
 		if(vld == 0) return;
-		fprintf(mFile,"\tsetAttr \".vld\" %i;\n", vld);
+		writeInt(mFile,"\tsetAttr \".vld\" ",vld,";\n");
 	}
 	void setArc(float ac)
 	{
 		if(ac == 360.0) return;
-		fprintf(mFile,"\tsetAttr \".ac\" %f;\n", ac);
+		writeFloat(mFile,"\tsetAttr \".ac\" ",ac,";\n");
 	}
 	void setConeEndRadius(float cer)
 	{
 		if(cer == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".cer\" %f;\n", cer);
+		writeFloat(mFile,"\tsetAttr \".cer\" ",cer,";\n");
 	}
 	void setColorRange(size_t crg_i,const ColorRange& crg)
 	{
-		fprintf(mFile,"\tsetAttr \".crg[%i]\" ",crg_i);
+		writeInt(mFile,"\tsetAttr \".crg[",crg_i,"]\" ");
 		crg.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorRange(size_t crg_start,size_t crg_end,ColorRange* crg)
 	{
-		fprintf(mFile,"\tsetAttr \".crg[%i:%i]\" ", crg_start,crg_end);
+		writeInt(mFile,"\tsetAttr \".crg[",crg_start); writeInt(mFile,":",crg_end,"]\" ");
 		size_t size = (crg_end-crg_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			crg[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startColorRange(size_t crg_start,size_t crg_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".crg[%i:%i]\"",crg_start,crg_end);
-		fprintf(mFile," -type \"ColorRange\" ");
+		writeInt(mFile,"\tsetAttr \".crg[",crg_start); writeInt(mFile,":",crg_end,"]\"");
+		writeString(mFile," -type \"ColorRange\" ");
 	}
 	void appendColorRange(const ColorRange& crg)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		crg.write(mFile);
 	}
 	void endColorRange()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorRange_Position(size_t crg_i,float crgp)
 	{
 		if(crgp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crg[%i].crgp\" %f;\n", crg_i,crgp);
+		writeInt(mFile,"\tsetAttr \".crg[",crg_i); writeFloat(mFile,"].crgp\" ",crgp,";\n");
 	}
 	void setColorRange_Color(size_t crg_i,const float3& crgc)
 	{
-		fprintf(mFile,"\tsetAttr \".crg[%i].crgc\" -type \"float3\" ",crg_i);
+		writeInt(mFile,"\tsetAttr \".crg[",crg_i,"].crgc\" -type \"float3\" ");
 		crgc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setColorRange_ColorR(size_t crg_i,float crgcr)
 	{
 		if(crgcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crg[%i].crgc.crgcr\" %f;\n", crg_i,crgcr);
+		writeInt(mFile,"\tsetAttr \".crg[",crg_i); writeFloat(mFile,"].crgc.crgcr\" ",crgcr,";\n");
 	}
 	void setColorRange_ColorG(size_t crg_i,float crgcg)
 	{
 		if(crgcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crg[%i].crgc.crgcg\" %f;\n", crg_i,crgcg);
+		writeInt(mFile,"\tsetAttr \".crg[",crg_i); writeFloat(mFile,"].crgc.crgcg\" ",crgcg,";\n");
 	}
 	void setColorRange_ColorB(size_t crg_i,float crgcb)
 	{
 		if(crgcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".crg[%i].crgc.crgcb\" %f;\n", crg_i,crgcb);
+		writeInt(mFile,"\tsetAttr \".crg[",crg_i); writeFloat(mFile,"].crgc.crgcb\" ",crgcb,";\n");
 	}
 	void setColorRange_Interp(size_t crg_i,unsigned int crgi)
 	{
 		if(crgi == 0) return;
-		fprintf(mFile,"\tsetAttr \".crg[%i].crgi\" %i;\n", crg_i,crgi);
+		writeInt(mFile,"\tsetAttr \".crg[",crg_i); writeInt(mFile,"].crgi\" ",crgi,";\n");
 	}
 	void setPenumbra(size_t pen_i,const Penumbra& pen)
 	{
-		fprintf(mFile,"\tsetAttr \".pen[%i]\" ",pen_i);
+		writeInt(mFile,"\tsetAttr \".pen[",pen_i,"]\" ");
 		pen.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPenumbra(size_t pen_start,size_t pen_end,Penumbra* pen)
 	{
-		fprintf(mFile,"\tsetAttr \".pen[%i:%i]\" ", pen_start,pen_end);
+		writeInt(mFile,"\tsetAttr \".pen[",pen_start); writeInt(mFile,":",pen_end,"]\" ");
 		size_t size = (pen_end-pen_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			pen[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startPenumbra(size_t pen_start,size_t pen_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".pen[%i:%i]\"",pen_start,pen_end);
-		fprintf(mFile," -type \"Penumbra\" ");
+		writeInt(mFile,"\tsetAttr \".pen[",pen_start); writeInt(mFile,":",pen_end,"]\"");
+		writeString(mFile," -type \"Penumbra\" ");
 	}
 	void appendPenumbra(const Penumbra& pen)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		pen.write(mFile);
 	}
 	void endPenumbra()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setPenumbra_Position(size_t pen_i,float penp)
 	{
 		if(penp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pen[%i].penp\" %f;\n", pen_i,penp);
+		writeInt(mFile,"\tsetAttr \".pen[",pen_i); writeFloat(mFile,"].penp\" ",penp,";\n");
 	}
 	void setPenumbra_FloatValue(size_t pen_i,float penfv)
 	{
 		if(penfv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".pen[%i].penfv\" %f;\n", pen_i,penfv);
+		writeInt(mFile,"\tsetAttr \".pen[",pen_i); writeFloat(mFile,"].penfv\" ",penfv,";\n");
 	}
 	void setPenumbra_Interp(size_t pen_i,unsigned int peni)
 	{
 		if(peni == 0) return;
-		fprintf(mFile,"\tsetAttr \".pen[%i].peni\" %i;\n", pen_i,peni);
+		writeInt(mFile,"\tsetAttr \".pen[",pen_i); writeInt(mFile,"].peni\" ",peni,";\n");
 	}
 	void setEmitAmbient(bool ema)
 	{
 		if(ema == false) return;
-		fprintf(mFile,"\tsetAttr \".ema\" %i;\n", ema);
+		writeInt(mFile,"\tsetAttr \".ema\" ",ema,";\n");
 	}
 	void getLightShape()const
 	{
-		fprintf(mFile,"\"%s.lis\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".lis\"");
 	}
 	void getVolumeLightDir()const
 	{
-		fprintf(mFile,"\"%s.vld\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vld\"");
 	}
 	void getArc()const
 	{
-		fprintf(mFile,"\"%s.ac\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ac\"");
 	}
 	void getConeEndRadius()const
 	{
-		fprintf(mFile,"\"%s.cer\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".cer\"");
 	}
 	void getColorRange(size_t crg_i)const
 	{
-		fprintf(mFile,"\"%s.crg[%i]\"",mName.c_str(),crg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crg[",crg_i,"]\"");
 	}
 	void getColorRange()const
 	{
 
-		fprintf(mFile,"\"%s.crg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crg\"");
 	}
 	void getColorRange_Position(size_t crg_i)const
 	{
-		fprintf(mFile,"\"%s.crg[%i].crgp\"",mName.c_str(),crg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crg[",crg_i,"].crgp\"");
 	}
 	void getColorRange_Position()const
 	{
 
-		fprintf(mFile,"\"%s.crg.crgp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crg.crgp\"");
 	}
 	void getColorRange_Color(size_t crg_i)const
 	{
-		fprintf(mFile,"\"%s.crg[%i].crgc\"",mName.c_str(),crg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crg[",crg_i,"].crgc\"");
 	}
 	void getColorRange_Color()const
 	{
 
-		fprintf(mFile,"\"%s.crg.crgc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crg.crgc\"");
 	}
 	void getColorRange_ColorR(size_t crg_i)const
 	{
-		fprintf(mFile,"\"%s.crg[%i].crgc.crgcr\"",mName.c_str(),crg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crg[",crg_i,"].crgc.crgcr\"");
 	}
 	void getColorRange_ColorR()const
 	{
 
-		fprintf(mFile,"\"%s.crg.crgc.crgcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crg.crgc.crgcr\"");
 	}
 	void getColorRange_ColorG(size_t crg_i)const
 	{
-		fprintf(mFile,"\"%s.crg[%i].crgc.crgcg\"",mName.c_str(),crg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crg[",crg_i,"].crgc.crgcg\"");
 	}
 	void getColorRange_ColorG()const
 	{
 
-		fprintf(mFile,"\"%s.crg.crgc.crgcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crg.crgc.crgcg\"");
 	}
 	void getColorRange_ColorB(size_t crg_i)const
 	{
-		fprintf(mFile,"\"%s.crg[%i].crgc.crgcb\"",mName.c_str(),crg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crg[",crg_i,"].crgc.crgcb\"");
 	}
 	void getColorRange_ColorB()const
 	{
 
-		fprintf(mFile,"\"%s.crg.crgc.crgcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crg.crgc.crgcb\"");
 	}
 	void getColorRange_Interp(size_t crg_i)const
 	{
-		fprintf(mFile,"\"%s.crg[%i].crgi\"",mName.c_str(),crg_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".crg[",crg_i,"].crgi\"");
 	}
 	void getColorRange_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.crg.crgi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".crg.crgi\"");
 	}
 	void getPenumbra(size_t pen_i)const
 	{
-		fprintf(mFile,"\"%s.pen[%i]\"",mName.c_str(),pen_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pen[",pen_i,"]\"");
 	}
 	void getPenumbra()const
 	{
 
-		fprintf(mFile,"\"%s.pen\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pen\"");
 	}
 	void getPenumbra_Position(size_t pen_i)const
 	{
-		fprintf(mFile,"\"%s.pen[%i].penp\"",mName.c_str(),pen_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pen[",pen_i,"].penp\"");
 	}
 	void getPenumbra_Position()const
 	{
 
-		fprintf(mFile,"\"%s.pen.penp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pen.penp\"");
 	}
 	void getPenumbra_FloatValue(size_t pen_i)const
 	{
-		fprintf(mFile,"\"%s.pen[%i].penfv\"",mName.c_str(),pen_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pen[",pen_i,"].penfv\"");
 	}
 	void getPenumbra_FloatValue()const
 	{
 
-		fprintf(mFile,"\"%s.pen.penfv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pen.penfv\"");
 	}
 	void getPenumbra_Interp(size_t pen_i)const
 	{
-		fprintf(mFile,"\"%s.pen[%i].peni\"",mName.c_str(),pen_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".pen[",pen_i,"].peni\"");
 	}
 	void getPenumbra_Interp()const
 	{
 
-		fprintf(mFile,"\"%s.pen.peni\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pen.peni\"");
 	}
 	void getEmitAmbient()const
 	{
-		fprintf(mFile,"\"%s.ema\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ema\"");
 	}
 protected:
 	VolumeLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
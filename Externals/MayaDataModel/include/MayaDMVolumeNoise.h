@@ -27,301 +27,301 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setAmplitude(float a)
 	{
 		if(a == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.707) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setThreshold(float th)
 	{
 		if(th == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".th\" %f;\n", th);
+		writeFloat(mFile,"\tsetAttr \".th\" ",th,";\n");
 	}
 	void setScale(const float3& sc)
 	{
 		if(sc == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".sc\" -type \"float3\" ");
 		sc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setScaleX(float sx)
 	{
 		if(sx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.sx\" %f;\n", sx);
+		writeFloat(mFile,"\tsetAttr \".sc.sx\" ",sx,";\n");
 	}
 	void setScaleY(float sy)
 	{
 		if(sy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.sy\" %f;\n", sy);
+		writeFloat(mFile,"\tsetAttr \".sc.sy\" ",sy,";\n");
 	}
 	void setScaleZ(float sz)
 	{
 		if(sz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sc.sz\" %f;\n", sz);
+		writeFloat(mFile,"\tsetAttr \".sc.sz\" ",sz,";\n");
 	}
 	void setOrigin(const float3& orr)
 	{
 		if(orr == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".orr\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".orr\" -type \"float3\" ");
 		orr.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOriginX(float orx)
 	{
 		if(orx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".orr.orx\" %f;\n", orx);
+		writeFloat(mFile,"\tsetAttr \".orr.orx\" ",orx,";\n");
 	}
 	void setOriginY(float ory)
 	{
 		if(ory == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".orr.ory\" %f;\n", ory);
+		writeFloat(mFile,"\tsetAttr \".orr.ory\" ",ory,";\n");
 	}
 	void setOriginZ(float orz)
 	{
 		if(orz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".orr.orz\" %f;\n", orz);
+		writeFloat(mFile,"\tsetAttr \".orr.orz\" ",orz,";\n");
 	}
 	void setDepthMax(short dm)
 	{
 		if(dm == 3) return;
-		fprintf(mFile,"\tsetAttr \".dm\" %i;\n", dm);
+		writeInt(mFile,"\tsetAttr \".dm\" ",dm,";\n");
 	}
 	void setFrequency(float fq)
 	{
 		if(fq == 8.0) return;
-		fprintf(mFile,"\tsetAttr \".fq\" %f;\n", fq);
+		writeFloat(mFile,"\tsetAttr \".fq\" ",fq,";\n");
 	}
 	void setFrequencyRatio(float fr)
 	{
 		if(fr == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".fr\" %f;\n", fr);
+		writeFloat(mFile,"\tsetAttr \".fr\" ",fr,";\n");
 	}
 	void setInflection(bool in)
 	{
 		if(in == false) return;
-		fprintf(mFile,"\tsetAttr \".in\" %i;\n", in);
+		writeInt(mFile,"\tsetAttr \".in\" ",in,";\n");
 	}
 	void setTime(float ti)
 	{
 		if(ti == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ti\" %f;\n", ti);
+		writeFloat(mFile,"\tsetAttr \".ti\" ",ti,";\n");
 	}
 	void setNoiseType(unsigned int nty)
 	{
 		if(nty == 1) return;
-		fprintf(mFile,"\tsetAttr \".nty\" %i;\n", nty);
+		writeInt(mFile,"\tsetAttr \".nty\" ",nty,";\n");
 	}
 	void setDensity(float d)
 	{
 		if(d == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".d\" %f;\n", d);
+		writeFloat(mFile,"\tsetAttr \".d\" ",d,";\n");
 	}
 	void setSpottyness(float sp)
 	{
 		if(sp == 0.1) return;
-		fprintf(mFile,"\tsetAttr \".sp\" %f;\n", sp);
+		writeFloat(mFile,"\tsetAttr \".sp\" ",sp,";\n");
 	}
 	void setSizeRand(float sr)
 	{
 		if(sr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setRandomness(float rn)
 	{
 		if(rn == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".rn\" %f;\n", rn);
+		writeFloat(mFile,"\tsetAttr \".rn\" ",rn,";\n");
 	}
 	void setFalloff(unsigned int fof)
 	{
 		if(fof == 2) return;
-		fprintf(mFile,"\tsetAttr \".fof\" %i;\n", fof);
+		writeInt(mFile,"\tsetAttr \".fof\" ",fof,";\n");
 	}
 	void setNumWaves(short nw)
 	{
 		if(nw == 5) return;
-		fprintf(mFile,"\tsetAttr \".nw\" %i;\n", nw);
+		writeInt(mFile,"\tsetAttr \".nw\" ",nw,";\n");
 	}
 	void setImplode(float imp)
 	{
 		if(imp == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imp\" %f;\n", imp);
+		writeFloat(mFile,"\tsetAttr \".imp\" ",imp,";\n");
 	}
 	void setImplodeCenter(const float3& imc)
 	{
 		if(imc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".imc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".imc\" -type \"float3\" ");
 		imc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setImplodeCenterX(float imx)
 	{
 		if(imx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imc.imx\" %f;\n", imx);
+		writeFloat(mFile,"\tsetAttr \".imc.imx\" ",imx,";\n");
 	}
 	void setImplodeCenterY(float imy)
 	{
 		if(imy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imc.imy\" %f;\n", imy);
+		writeFloat(mFile,"\tsetAttr \".imc.imy\" ",imy,";\n");
 	}
 	void setImplodeCenterZ(float imz)
 	{
 		if(imz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".imc.imz\" %f;\n", imz);
+		writeFloat(mFile,"\tsetAttr \".imc.imz\" ",imz,";\n");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getAmplitude()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getThreshold()const
 	{
-		fprintf(mFile,"\"%s.th\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".th\"");
 	}
 	void getScale()const
 	{
-		fprintf(mFile,"\"%s.sc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc\"");
 	}
 	void getScaleX()const
 	{
-		fprintf(mFile,"\"%s.sc.sx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sx\"");
 	}
 	void getScaleY()const
 	{
-		fprintf(mFile,"\"%s.sc.sy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sy\"");
 	}
 	void getScaleZ()const
 	{
-		fprintf(mFile,"\"%s.sc.sz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sc.sz\"");
 	}
 	void getOrigin()const
 	{
-		fprintf(mFile,"\"%s.orr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".orr\"");
 	}
 	void getOriginX()const
 	{
-		fprintf(mFile,"\"%s.orr.orx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".orr.orx\"");
 	}
 	void getOriginY()const
 	{
-		fprintf(mFile,"\"%s.orr.ory\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".orr.ory\"");
 	}
 	void getOriginZ()const
 	{
-		fprintf(mFile,"\"%s.orr.orz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".orr.orz\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.dm\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".dm\"");
 	}
 	void getFrequency()const
 	{
-		fprintf(mFile,"\"%s.fq\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fq\"");
 	}
 	void getFrequencyRatio()const
 	{
-		fprintf(mFile,"\"%s.fr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fr\"");
 	}
 	void getInflection()const
 	{
-		fprintf(mFile,"\"%s.in\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".in\"");
 	}
 	void getTime()const
 	{
-		fprintf(mFile,"\"%s.ti\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ti\"");
 	}
 	void getNoiseType()const
 	{
-		fprintf(mFile,"\"%s.nty\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nty\"");
 	}
 	void getDensity()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getSpottyness()const
 	{
-		fprintf(mFile,"\"%s.sp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sp\"");
 	}
 	void getSizeRand()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getRandomness()const
 	{
-		fprintf(mFile,"\"%s.rn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rn\"");
 	}
 	void getFalloff()const
 	{
-		fprintf(mFile,"\"%s.fof\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fof\"");
 	}
 	void getNumWaves()const
 	{
-		fprintf(mFile,"\"%s.nw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nw\"");
 	}
 	void getImplode()const
 	{
-		fprintf(mFile,"\"%s.imp\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imp\"");
 	}
 	void getImplodeCenter()const
 	{
-		fprintf(mFile,"\"%s.imc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc\"");
 	}
 	void getImplodeCenterX()const
 	{
-		fprintf(mFile,"\"%s.imc.imx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc.imx\"");
 	}
 	void getImplodeCenterY()const
 	{
-		fprintf(mFile,"\"%s.imc.imy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc.imy\"");
 	}
 	void getImplodeCenterZ()const
 	{
-		fprintf(mFile,"\"%s.imc.imz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".imc.imz\"");
 	}
 protected:
 	VolumeNoise(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
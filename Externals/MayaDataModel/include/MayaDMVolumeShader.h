@@ -27,116 +27,116 @@ public:
 	void setOutColor(const float3& oc)
 	{
 		if(oc == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".oc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".oc\" -type \"float3\" ");
 		oc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutColorR(float ocr)
 	{
 		if(ocr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocr\" %f;\n", ocr);
+		writeFloat(mFile,"\tsetAttr \".oc.ocr\" ",ocr,";\n");
 	}
 	void setOutColorG(float ocg)
 	{
 		if(ocg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocg\" %f;\n", ocg);
+		writeFloat(mFile,"\tsetAttr \".oc.ocg\" ",ocg,";\n");
 	}
 	void setOutColorB(float ocb)
 	{
 		if(ocb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".oc.ocb\" %f;\n", ocb);
+		writeFloat(mFile,"\tsetAttr \".oc.ocb\" ",ocb,";\n");
 	}
 	void setOutTransparency(const float3& ot)
 	{
 		if(ot == float3(0.0f,0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".ot\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".ot\" -type \"float3\" ");
 		ot.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutTransparencyR(float otr)
 	{
 		if(otr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ot.otr\" %f;\n", otr);
+		writeFloat(mFile,"\tsetAttr \".ot.otr\" ",otr,";\n");
 	}
 	void setOutTransparencyG(float otg)
 	{
 		if(otg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ot.otg\" %f;\n", otg);
+		writeFloat(mFile,"\tsetAttr \".ot.otg\" ",otg,";\n");
 	}
 	void setOutTransparencyB(float otb)
 	{
 		if(otb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ot.otb\" %f;\n", otb);
+		writeFloat(mFile,"\tsetAttr \".ot.otb\" ",otb,";\n");
 	}
 	void setOutMatteOpacity(const float3& omo)
 	{
 		if(omo == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".omo\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".omo\" -type \"float3\" ");
 		omo.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setOutMatteOpacityR(float omor)
 	{
 		if(omor == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".omo.omor\" %f;\n", omor);
+		writeFloat(mFile,"\tsetAttr \".omo.omor\" ",omor,";\n");
 	}
 	void setOutMatteOpacityG(float omog)
 	{
 		if(omog == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".omo.omog\" %f;\n", omog);
+		writeFloat(mFile,"\tsetAttr \".omo.omog\" ",omog,";\n");
 	}
 	void setOutMatteOpacityB(float omob)
 	{
 		if(omob == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".omo.omob\" %f;\n", omob);
+		writeFloat(mFile,"\tsetAttr \".omo.omob\" ",omob,";\n");
 	}
 	void getOutColor()const
 	{
-		fprintf(mFile,"\"%s.oc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc\"");
 	}
 	void getOutColorR()const
 	{
-		fprintf(mFile,"\"%s.oc.ocr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocr\"");
 	}
 	void getOutColorG()const
 	{
-		fprintf(mFile,"\"%s.oc.ocg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocg\"");
 	}
 	void getOutColorB()const
 	{
-		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".oc.ocb\"");
 	}
 	void getOutTransparency()const
 	{
-		fprintf(mFile,"\"%s.ot\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot\"");
 	}
 	void getOutTransparencyR()const
 	{
-		fprintf(mFile,"\"%s.ot.otr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otr\"");
 	}
 	void getOutTransparencyG()const
 	{
-		fprintf(mFile,"\"%s.ot.otg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otg\"");
 	}
 	void getOutTransparencyB()const
 	{
-		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ot.otb\"");
 	}
 	void getOutMatteOpacity()const
 	{
-		fprintf(mFile,"\"%s.omo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo\"");
 	}
 	void getOutMatteOpacityR()const
 	{
-		fprintf(mFile,"\"%s.omo.omor\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omor\"");
 	}
 	void getOutMatteOpacityG()const
 	{
-		fprintf(mFile,"\"%s.omo.omog\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omog\"");
 	}
 	void getOutMatteOpacityB()const
 	{
-		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".omo.omob\"");
 	}
 protected:
 	VolumeShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
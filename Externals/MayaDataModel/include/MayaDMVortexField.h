@@ -23,9 +23,9 @@ public:
 		double axisZ;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", axisX);
-			fprintf(file,"%f ", axisY);
-			fprintf(file,"%f", axisZ);
+			writeFloat(file,"",axisX," ");
+			writeFloat(file,"",axisY," ");
+			writeFloat(file,"",axisZ);
 		}
 	};
 public:
@@ -37,40 +37,40 @@ public:
 
 	void setAxis(const Axis& ax)
 	{
-		fprintf(mFile,"\tsetAttr \".ax\" ");
+		writeString(mFile,"\tsetAttr \".ax\" ");
 		ax.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setAxisX(double axx)
 	{
 		if(axx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axx\" %f;\n", axx);
+		writeFloat(mFile,"\tsetAttr \".ax.axx\" ",axx,";\n");
 	}
 	void setAxisY(double axy)
 	{
 		if(axy == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axy\" %f;\n", axy);
+		writeFloat(mFile,"\tsetAttr \".ax.axy\" ",axy,";\n");
 	}
 	void setAxisZ(double axz)
 	{
 		if(axz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ax.axz\" %f;\n", axz);
+		writeFloat(mFile,"\tsetAttr \".ax.axz\" ",axz,";\n");
 	}
 	void getAxis()const
 	{
-		fprintf(mFile,"\"%s.ax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax\"");
 	}
 	void getAxisX()const
 	{
-		fprintf(mFile,"\"%s.ax.axx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axx\"");
 	}
 	void getAxisY()const
 	{
-		fprintf(mFile,"\"%s.ax.axy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axy\"");
 	}
 	void getAxisZ()const
 	{
-		fprintf(mFile,"\"%s.ax.axz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax.axz\"");
 	}
 protected:
 	VortexField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
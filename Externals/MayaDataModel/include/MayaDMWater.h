@@ -27,271 +27,271 @@ public:
 	void setNumberOfWaves(short nw)
 	{
 		if(nw == 8) return;
-		fprintf(mFile,"\tsetAttr \".nw\" %i;\n", nw);
+		writeInt(mFile,"\tsetAttr \".nw\" ",nw,";\n");
 	}
 	void setWaveTime(float wt)
 	{
 		if(wt == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wt\" %f;\n", wt);
+		writeFloat(mFile,"\tsetAttr \".wt\" ",wt,";\n");
 	}
 	void setWaveVelocity(float wv)
 	{
 		if(wv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wv\" %f;\n", wv);
+		writeFloat(mFile,"\tsetAttr \".wv\" ",wv,";\n");
 	}
 	void setWaveAmplitude(float wa)
 	{
 		if(wa == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".wa\" %f;\n", wa);
+		writeFloat(mFile,"\tsetAttr \".wa\" ",wa,";\n");
 	}
 	void setWaveFrequency(float wf)
 	{
 		if(wf == 4.0) return;
-		fprintf(mFile,"\tsetAttr \".wf\" %f;\n", wf);
+		writeFloat(mFile,"\tsetAttr \".wf\" ",wf,";\n");
 	}
 	void setSubWaveFrequency(float swf)
 	{
 		if(swf == 0.125) return;
-		fprintf(mFile,"\tsetAttr \".swf\" %f;\n", swf);
+		writeFloat(mFile,"\tsetAttr \".swf\" ",swf,";\n");
 	}
 	void setSmoothness(float s)
 	{
 		if(s == 2.0) return;
-		fprintf(mFile,"\tsetAttr \".s\" %f;\n", s);
+		writeFloat(mFile,"\tsetAttr \".s\" ",s,";\n");
 	}
 	void setWindUV(const float2& wi)
 	{
 		if(wi == float2(1.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".wi\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".wi\" -type \"float2\" ");
 		wi.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWindU(float wiu)
 	{
 		if(wiu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wi.wiu\" %f;\n", wiu);
+		writeFloat(mFile,"\tsetAttr \".wi.wiu\" ",wiu,";\n");
 	}
 	void setWindV(float wiv)
 	{
 		if(wiv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".wi.wiv\" %f;\n", wiv);
+		writeFloat(mFile,"\tsetAttr \".wi.wiv\" ",wiv,";\n");
 	}
 	void setRippleTime(float rt)
 	{
 		if(rt == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rt\" %f;\n", rt);
+		writeFloat(mFile,"\tsetAttr \".rt\" ",rt,";\n");
 	}
 	void setRippleFrequency(float rf)
 	{
 		if(rf == 25.0) return;
-		fprintf(mFile,"\tsetAttr \".rf\" %f;\n", rf);
+		writeFloat(mFile,"\tsetAttr \".rf\" ",rf,";\n");
 	}
 	void setRippleAmplitude(float ra)
 	{
 		if(ra == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setDropSize(float ds)
 	{
 		if(ds == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".ds\" %f;\n", ds);
+		writeFloat(mFile,"\tsetAttr \".ds\" ",ds,";\n");
 	}
 	void setRippleOrigin(const float2& rc)
 	{
 		if(rc == float2(0.5f,0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".rc\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".rc\" -type \"float2\" ");
 		rc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRippleOriginU(float rcu)
 	{
 		if(rcu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rcu\" %f;\n", rcu);
+		writeFloat(mFile,"\tsetAttr \".rc.rcu\" ",rcu,";\n");
 	}
 	void setRippleOriginV(float rcv)
 	{
 		if(rcv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".rc.rcv\" %f;\n", rcv);
+		writeFloat(mFile,"\tsetAttr \".rc.rcv\" ",rcv,";\n");
 	}
 	void setGroupVelocity(float gv)
 	{
 		if(gv == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".gv\" %f;\n", gv);
+		writeFloat(mFile,"\tsetAttr \".gv\" ",gv,";\n");
 	}
 	void setPhaseVelocity(float pv)
 	{
 		if(pv == 2.5) return;
-		fprintf(mFile,"\tsetAttr \".pv\" %f;\n", pv);
+		writeFloat(mFile,"\tsetAttr \".pv\" ",pv,";\n");
 	}
 	void setSpreadStart(float ss)
 	{
 		if(ss == 0.005) return;
-		fprintf(mFile,"\tsetAttr \".ss\" %f;\n", ss);
+		writeFloat(mFile,"\tsetAttr \".ss\" ",ss,";\n");
 	}
 	void setSpreadRate(float sr)
 	{
 		if(sr == 0.3) return;
-		fprintf(mFile,"\tsetAttr \".sr\" %f;\n", sr);
+		writeFloat(mFile,"\tsetAttr \".sr\" ",sr,";\n");
 	}
 	void setReflectionBox(bool rb)
 	{
 		if(rb == false) return;
-		fprintf(mFile,"\tsetAttr \".rb\" %i;\n", rb);
+		writeInt(mFile,"\tsetAttr \".rb\" ",rb,";\n");
 	}
 	void setBoxMin(const float2& bmn)
 	{
 		if(bmn == float2(0.0f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".bmn\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".bmn\" -type \"float2\" ");
 		bmn.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBoxMinU(float bu1)
 	{
 		if(bu1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bmn.bu1\" %f;\n", bu1);
+		writeFloat(mFile,"\tsetAttr \".bmn.bu1\" ",bu1,";\n");
 	}
 	void setBoxMinV(float bv1)
 	{
 		if(bv1 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bmn.bv1\" %f;\n", bv1);
+		writeFloat(mFile,"\tsetAttr \".bmn.bv1\" ",bv1,";\n");
 	}
 	void setBoxMax(const float2& bmx)
 	{
 		if(bmx == float2(1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".bmx\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".bmx\" -type \"float2\" ");
 		bmx.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setBoxMaxU(float bu2)
 	{
 		if(bu2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bmx.bu2\" %f;\n", bu2);
+		writeFloat(mFile,"\tsetAttr \".bmx.bu2\" ",bu2,";\n");
 	}
 	void setBoxMaxV(float bv2)
 	{
 		if(bv2 == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".bmx.bv2\" %f;\n", bv2);
+		writeFloat(mFile,"\tsetAttr \".bmx.bv2\" ",bv2,";\n");
 	}
 	void setFast(bool fa)
 	{
 		if(fa == true) return;
-		fprintf(mFile,"\tsetAttr \".fa\" %i;\n", fa);
+		writeInt(mFile,"\tsetAttr \".fa\" ",fa,";\n");
 	}
 	void getNumberOfWaves()const
 	{
-		fprintf(mFile,"\"%s.nw\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".nw\"");
 	}
 	void getWaveTime()const
 	{
-		fprintf(mFile,"\"%s.wt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wt\"");
 	}
 	void getWaveVelocity()const
 	{
-		fprintf(mFile,"\"%s.wv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wv\"");
 	}
 	void getWaveAmplitude()const
 	{
-		fprintf(mFile,"\"%s.wa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wa\"");
 	}
 	void getWaveFrequency()const
 	{
-		fprintf(mFile,"\"%s.wf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wf\"");
 	}
 	void getSubWaveFrequency()const
 	{
-		fprintf(mFile,"\"%s.swf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".swf\"");
 	}
 	void getSmoothness()const
 	{
-		fprintf(mFile,"\"%s.s\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".s\"");
 	}
 	void getWindUV()const
 	{
-		fprintf(mFile,"\"%s.wi\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi\"");
 	}
 	void getWindU()const
 	{
-		fprintf(mFile,"\"%s.wi.wiu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi.wiu\"");
 	}
 	void getWindV()const
 	{
-		fprintf(mFile,"\"%s.wi.wiv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wi.wiv\"");
 	}
 	void getRippleTime()const
 	{
-		fprintf(mFile,"\"%s.rt\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rt\"");
 	}
 	void getRippleFrequency()const
 	{
-		fprintf(mFile,"\"%s.rf\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rf\"");
 	}
 	void getRippleAmplitude()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getDropSize()const
 	{
-		fprintf(mFile,"\"%s.ds\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ds\"");
 	}
 	void getRippleOrigin()const
 	{
-		fprintf(mFile,"\"%s.rc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc\"");
 	}
 	void getRippleOriginU()const
 	{
-		fprintf(mFile,"\"%s.rc.rcu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rcu\"");
 	}
 	void getRippleOriginV()const
 	{
-		fprintf(mFile,"\"%s.rc.rcv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rc.rcv\"");
 	}
 	void getGroupVelocity()const
 	{
-		fprintf(mFile,"\"%s.gv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gv\"");
 	}
 	void getPhaseVelocity()const
 	{
-		fprintf(mFile,"\"%s.pv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".pv\"");
 	}
 	void getSpreadStart()const
 	{
-		fprintf(mFile,"\"%s.ss\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ss\"");
 	}
 	void getSpreadRate()const
 	{
-		fprintf(mFile,"\"%s.sr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".sr\"");
 	}
 	void getReflectionBox()const
 	{
-		fprintf(mFile,"\"%s.rb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rb\"");
 	}
 	void getBoxMin()const
 	{
-		fprintf(mFile,"\"%s.bmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmn\"");
 	}
 	void getBoxMinU()const
 	{
-		fprintf(mFile,"\"%s.bmn.bu1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmn.bu1\"");
 	}
 	void getBoxMinV()const
 	{
-		fprintf(mFile,"\"%s.bmn.bv1\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmn.bv1\"");
 	}
 	void getBoxMax()const
 	{
-		fprintf(mFile,"\"%s.bmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmx\"");
 	}
 	void getBoxMaxU()const
 	{
-		fprintf(mFile,"\"%s.bmx.bu2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmx.bu2\"");
 	}
 	void getBoxMaxV()const
 	{
-		fprintf(mFile,"\"%s.bmx.bv2\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".bmx.bv2\"");
 	}
 	void getFast()const
 	{
-		fprintf(mFile,"\"%s.fa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fa\"");
 	}
 protected:
 	Water(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
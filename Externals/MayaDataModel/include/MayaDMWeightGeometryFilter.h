@@ -24,8 +24,8 @@ public:
 		{
 			for (size_t i = 0; i<nbWeights; ++i)
 			{
-				fprintf(file,"%f", weights[i]);
-				if (i + 1<nbWeights) fprintf(file, " ");
+				writeFloat(file,"",weights[i]);
+				if (i + 1<nbWeights) writeString(file," ");
 			}
 		}
 	};
@@ -38,80 +38,80 @@ public:
 
 	void setWeightList(size_t wl_i,const WeightList& wl)
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i]\" ",wl_i);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_i,"]\" ");
 		wl.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeightList(size_t wl_start,size_t wl_end,WeightList* wl)
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i:%i]\" ", wl_start,wl_end);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_start); writeInt(mFile,":",wl_end,"]\" ");
 		size_t size = (wl_end-wl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			wl[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWeightList(size_t wl_start,size_t wl_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i:%i]\"",wl_start,wl_end);
-		fprintf(mFile," -type \"WeightList\" ");
+		writeInt(mFile,"\tsetAttr \".wl[",wl_start); writeInt(mFile,":",wl_end,"]\"");
+		writeString(mFile," -type \"WeightList\" ");
 	}
 	void appendWeightList(const WeightList& wl)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		wl.write(mFile);
 	}
 	void endWeightList()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeights(size_t wl_i,size_t w_i,float w)
 	{
 		if(w == 1.0) return;
-		fprintf(mFile,"\tsetAttr \".wl[%i].w[%i]\" %f;\n", wl_i,w_i,w);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_i); writeInt(mFile,"].w[",w_i); writeFloat(mFile,"]\" ",w,";\n");
 	}
 	void setWeights(size_t wl_i,size_t w_start,size_t w_end,float* w)
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i].w[%i:%i]\" ", wl_i,w_start,w_end);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_i); writeInt(mFile,"].w[",w_start); writeInt(mFile,":",w_end,"]\" ");
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeFloat(mFile,"",w[i]);
+			if(i+1<size) writeString(mFile," ");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWeights(size_t wl_i,size_t w_start,size_t w_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".wl[%i].w[%i:%i]\"",wl_i,w_start,w_end);
+		writeInt(mFile,"\tsetAttr \".wl[",wl_i); writeInt(mFile,"].w[",w_start); writeInt(mFile,":",w_end,"]\"");
 	}
 	void appendWeights(float w)const
 	{
-		fprintf(mFile," %f",w);
+		writeFloat(mFile," ",w);
 	}
 	void endWeights()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void getWeightList(size_t wl_i)const
 	{
-		fprintf(mFile,"\"%s.wl[%i]\"",mName.c_str(),wl_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wl[",wl_i,"]\"");
 	}
 	void getWeightList()const
 	{
 
-		fprintf(mFile,"\"%s.wl\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".wl\"");
 	}
 	void getWeights(size_t wl_i,size_t w_i)const
 	{
-		fprintf(mFile,"\"%s.wl[%i].w[%i]\"",mName.c_str(),wl_i,w_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wl[",wl_i); writeInt(mFile,"].w[",w_i,"]\"");
 	}
 	void getWeights(size_t w_i)const
 	{
 
-		fprintf(mFile,"\"%s.wl.w[%i]\"",mName.c_str(),w_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".wl.w[",w_i,"]\"");
 	}
 protected:
 	WeightGeometryFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
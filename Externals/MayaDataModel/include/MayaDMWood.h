@@ -27,350 +27,350 @@ public:
 	void setXPixelAngle(float xpa)
 	{
 		if(xpa == 0.002053) return;
-		fprintf(mFile,"\tsetAttr \".xpa\" %f;\n", xpa);
+		writeFloat(mFile,"\tsetAttr \".xpa\" ",xpa,";\n");
 	}
 	void setFillerColor(const float3& fc)
 	{
 		if(fc == float3(0.824f,0.627f,0.471f)) return;
-		fprintf(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".fc\" -type \"float3\" ");
 		fc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setFillerColorR(float fcr)
 	{
 		if(fcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcr\" %f;\n", fcr);
+		writeFloat(mFile,"\tsetAttr \".fc.fcr\" ",fcr,";\n");
 	}
 	void setFillerColorG(float fcg)
 	{
 		if(fcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcg\" %f;\n", fcg);
+		writeFloat(mFile,"\tsetAttr \".fc.fcg\" ",fcg,";\n");
 	}
 	void setFillerColorB(float fcb)
 	{
 		if(fcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".fc.fcb\" %f;\n", fcb);
+		writeFloat(mFile,"\tsetAttr \".fc.fcb\" ",fcb,";\n");
 	}
 	void setVeinColor(const float3& vc)
 	{
 		if(vc == float3(0.157f,0.078f,0.039f)) return;
-		fprintf(mFile,"\tsetAttr \".vc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".vc\" -type \"float3\" ");
 		vc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setVeinColorR(float vcr)
 	{
 		if(vcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcr\" %f;\n", vcr);
+		writeFloat(mFile,"\tsetAttr \".vc.vcr\" ",vcr,";\n");
 	}
 	void setVeinColorG(float vcg)
 	{
 		if(vcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcg\" %f;\n", vcg);
+		writeFloat(mFile,"\tsetAttr \".vc.vcg\" ",vcg,";\n");
 	}
 	void setVeinColorB(float vcb)
 	{
 		if(vcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".vc.vcb\" %f;\n", vcb);
+		writeFloat(mFile,"\tsetAttr \".vc.vcb\" ",vcb,";\n");
 	}
 	void setVeinSpread(float v)
 	{
 		if(v == 0.25) return;
-		fprintf(mFile,"\tsetAttr \".v\" %f;\n", v);
+		writeFloat(mFile,"\tsetAttr \".v\" ",v,";\n");
 	}
 	void setLayerSize(float ls)
 	{
 		if(ls == 0.05) return;
-		fprintf(mFile,"\tsetAttr \".ls\" %f;\n", ls);
+		writeFloat(mFile,"\tsetAttr \".ls\" ",ls,";\n");
 	}
 	void setRandomness(float rd)
 	{
 		if(rd == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".rd\" %f;\n", rd);
+		writeFloat(mFile,"\tsetAttr \".rd\" ",rd,";\n");
 	}
 	void setAge(float a)
 	{
 		if(a == 20.0) return;
-		fprintf(mFile,"\tsetAttr \".a\" %f;\n", a);
+		writeFloat(mFile,"\tsetAttr \".a\" ",a,";\n");
 	}
 	void setGrainColor(const float3& gc)
 	{
 		if(gc == float3(0.118f,0.039f,0.0f)) return;
-		fprintf(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".gc\" -type \"float3\" ");
 		gc.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setGrainColorR(float gcr)
 	{
 		if(gcr == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcr\" %f;\n", gcr);
+		writeFloat(mFile,"\tsetAttr \".gc.gcr\" ",gcr,";\n");
 	}
 	void setGrainColorG(float gcg)
 	{
 		if(gcg == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcg\" %f;\n", gcg);
+		writeFloat(mFile,"\tsetAttr \".gc.gcg\" ",gcg,";\n");
 	}
 	void setGrainColorB(float gcb)
 	{
 		if(gcb == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".gc.gcb\" %f;\n", gcb);
+		writeFloat(mFile,"\tsetAttr \".gc.gcb\" ",gcb,";\n");
 	}
 	void setGrainContrast(float gx)
 	{
 		if(gx == 0.5) return;
-		fprintf(mFile,"\tsetAttr \".gx\" %f;\n", gx);
+		writeFloat(mFile,"\tsetAttr \".gx\" ",gx,";\n");
 	}
 	void setGrainSpacing(float gs)
 	{
 		if(gs == 0.01) return;
-		fprintf(mFile,"\tsetAttr \".gs\" %f;\n", gs);
+		writeFloat(mFile,"\tsetAttr \".gs\" ",gs,";\n");
 	}
 	void setCenter(const float2& c)
 	{
 		if(c == float2(0.5f,-0.5f)) return;
-		fprintf(mFile,"\tsetAttr \".c\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".c\" -type \"float2\" ");
 		c.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setCenterU(float cu)
 	{
 		if(cu == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cu\" %f;\n", cu);
+		writeFloat(mFile,"\tsetAttr \".c.cu\" ",cu,";\n");
 	}
 	void setCenterV(float cv)
 	{
 		if(cv == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".c.cv\" %f;\n", cv);
+		writeFloat(mFile,"\tsetAttr \".c.cv\" ",cv,";\n");
 	}
 	void setAmplitudeX(float ax)
 	{
 		if(ax == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ax\" %f;\n", ax);
+		writeFloat(mFile,"\tsetAttr \".ax\" ",ax,";\n");
 	}
 	void setAmplitudeY(float ay)
 	{
 		if(ay == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".ay\" %f;\n", ay);
+		writeFloat(mFile,"\tsetAttr \".ay\" ",ay,";\n");
 	}
 	void setRatio(float ra)
 	{
 		if(ra == 0.35) return;
-		fprintf(mFile,"\tsetAttr \".ra\" %f;\n", ra);
+		writeFloat(mFile,"\tsetAttr \".ra\" ",ra,";\n");
 	}
 	void setRipples(const float3& r)
 	{
 		if(r == float3(1.0f,1.0f,1.0f)) return;
-		fprintf(mFile,"\tsetAttr \".r\" -type \"float3\" ");
+		writeString(mFile,"\tsetAttr \".r\" -type \"float3\" ");
 		r.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setRipplesX(float rx)
 	{
 		if(rx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rx\" %f;\n", rx);
+		writeFloat(mFile,"\tsetAttr \".r.rx\" ",rx,";\n");
 	}
 	void setRipplesY(float ry)
 	{
 		if(ry == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.ry\" %f;\n", ry);
+		writeFloat(mFile,"\tsetAttr \".r.ry\" ",ry,";\n");
 	}
 	void setRipplesZ(float rz)
 	{
 		if(rz == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".r.rz\" %f;\n", rz);
+		writeFloat(mFile,"\tsetAttr \".r.rz\" ",rz,";\n");
 	}
 	void setDepth(const float2& d)
 	{
 		if(d == float2(0.0f,8.0f)) return;
-		fprintf(mFile,"\tsetAttr \".d\" -type \"float2\" ");
+		writeString(mFile,"\tsetAttr \".d\" -type \"float2\" ");
 		d.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setDepthMin(float dmn)
 	{
 		if(dmn == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmn\" %f;\n", dmn);
+		writeFloat(mFile,"\tsetAttr \".d.dmn\" ",dmn,";\n");
 	}
 	void setDepthMax(float dmx)
 	{
 		if(dmx == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".d.dmx\" %f;\n", dmx);
+		writeFloat(mFile,"\tsetAttr \".d.dmx\" ",dmx,";\n");
 	}
 	void getXPixelAngle()const
 	{
-		fprintf(mFile,"\"%s.xpa\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".xpa\"");
 	}
 	void getNormalCamera()const
 	{
-		fprintf(mFile,"\"%s.n\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n\"");
 	}
 	void getNormalCameraX()const
 	{
-		fprintf(mFile,"\"%s.n.nx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nx\"");
 	}
 	void getNormalCameraY()const
 	{
-		fprintf(mFile,"\"%s.n.ny\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.ny\"");
 	}
 	void getNormalCameraZ()const
 	{
-		fprintf(mFile,"\"%s.n.nz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".n.nz\"");
 	}
 	void getRefPointObj()const
 	{
-		fprintf(mFile,"\"%s.rpo\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo\"");
 	}
 	void getRefPointObjX()const
 	{
-		fprintf(mFile,"\"%s.rpo.rox\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.rox\"");
 	}
 	void getRefPointObjY()const
 	{
-		fprintf(mFile,"\"%s.rpo.roy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roy\"");
 	}
 	void getRefPointObjZ()const
 	{
-		fprintf(mFile,"\"%s.rpo.roz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpo.roz\"");
 	}
 	void getRefPointCamera()const
 	{
-		fprintf(mFile,"\"%s.rpc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc\"");
 	}
 	void getRefPointCameraX()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcx\"");
 	}
 	void getRefPointCameraY()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcy\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcy\"");
 	}
 	void getRefPointCameraZ()const
 	{
-		fprintf(mFile,"\"%s.rpc.rcz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rpc.rcz\"");
 	}
 	void getFillerColor()const
 	{
-		fprintf(mFile,"\"%s.fc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc\"");
 	}
 	void getFillerColorR()const
 	{
-		fprintf(mFile,"\"%s.fc.fcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcr\"");
 	}
 	void getFillerColorG()const
 	{
-		fprintf(mFile,"\"%s.fc.fcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcg\"");
 	}
 	void getFillerColorB()const
 	{
-		fprintf(mFile,"\"%s.fc.fcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".fc.fcb\"");
 	}
 	void getVeinColor()const
 	{
-		fprintf(mFile,"\"%s.vc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc\"");
 	}
 	void getVeinColorR()const
 	{
-		fprintf(mFile,"\"%s.vc.vcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcr\"");
 	}
 	void getVeinColorG()const
 	{
-		fprintf(mFile,"\"%s.vc.vcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcg\"");
 	}
 	void getVeinColorB()const
 	{
-		fprintf(mFile,"\"%s.vc.vcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".vc.vcb\"");
 	}
 	void getVeinSpread()const
 	{
-		fprintf(mFile,"\"%s.v\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".v\"");
 	}
 	void getLayerSize()const
 	{
-		fprintf(mFile,"\"%s.ls\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ls\"");
 	}
 	void getRandomness()const
 	{
-		fprintf(mFile,"\"%s.rd\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".rd\"");
 	}
 	void getAge()const
 	{
-		fprintf(mFile,"\"%s.a\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".a\"");
 	}
 	void getGrainColor()const
 	{
-		fprintf(mFile,"\"%s.gc\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc\"");
 	}
 	void getGrainColorR()const
 	{
-		fprintf(mFile,"\"%s.gc.gcr\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcr\"");
 	}
 	void getGrainColorG()const
 	{
-		fprintf(mFile,"\"%s.gc.gcg\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcg\"");
 	}
 	void getGrainColorB()const
 	{
-		fprintf(mFile,"\"%s.gc.gcb\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gc.gcb\"");
 	}
 	void getGrainContrast()const
 	{
-		fprintf(mFile,"\"%s.gx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gx\"");
 	}
 	void getGrainSpacing()const
 	{
-		fprintf(mFile,"\"%s.gs\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".gs\"");
 	}
 	void getCenter()const
 	{
-		fprintf(mFile,"\"%s.c\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c\"");
 	}
 	void getCenterU()const
 	{
-		fprintf(mFile,"\"%s.c.cu\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cu\"");
 	}
 	void getCenterV()const
 	{
-		fprintf(mFile,"\"%s.c.cv\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".c.cv\"");
 	}
 	void getAmplitudeX()const
 	{
-		fprintf(mFile,"\"%s.ax\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ax\"");
 	}
 	void getAmplitudeY()const
 	{
-		fprintf(mFile,"\"%s.ay\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ay\"");
 	}
 	void getRatio()const
 	{
-		fprintf(mFile,"\"%s.ra\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".ra\"");
 	}
 	void getRipples()const
 	{
-		fprintf(mFile,"\"%s.r\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r\"");
 	}
 	void getRipplesX()const
 	{
-		fprintf(mFile,"\"%s.r.rx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rx\"");
 	}
 	void getRipplesY()const
 	{
-		fprintf(mFile,"\"%s.r.ry\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.ry\"");
 	}
 	void getRipplesZ()const
 	{
-		fprintf(mFile,"\"%s.r.rz\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".r.rz\"");
 	}
 	void getDepth()const
 	{
-		fprintf(mFile,"\"%s.d\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d\"");
 	}
 	void getDepthMin()const
 	{
-		fprintf(mFile,"\"%s.d.dmn\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmn\"");
 	}
 	void getDepthMax()const
 	{
-		fprintf(mFile,"\"%s.d.dmx\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".d.dmx\"");
 	}
 protected:
 	Wood(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
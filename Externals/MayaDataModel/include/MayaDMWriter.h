@@ -0,0 +1,184 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of MayaDataModel.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+#ifndef __MayaDM_WRITER_H__
+#define __MayaDM_WRITER_H__
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// the file is written by one thread only, so locking it for every value is not needed
+#if defined(_MSC_VER)
+#	define MAYADM_FWRITE _fwrite_nolock
+#	define MAYADM_SNPRINTF sprintf_s
+#elif defined(__GLIBC__)
+#	define MAYADM_FWRITE fwrite_unlocked
+#	define MAYADM_SNPRINTF snprintf
+#else
+#	define MAYADM_FWRITE fwrite
+#	define MAYADM_SNPRINTF snprintf
+#endif
+
+namespace MayaDM
+{
+
+/**
+Output of the values of the data model. The values are formatted exactly as fprintf does with "%f"
+and "%i", but without parsing a format string and without locking the file for every value.
+*/
+
+/** The size of a buffer large enough for every value formatted by formatFloat() or formatInt().*/
+const size_t MAX_VALUE_LENGTH = 330;
+
+/** Values with a larger magnitude are formatted by the C library.*/
+const double MAX_FAST_FLOAT = 1e9;
+
+inline void writeData(FILE* file, const char* data, size_t length)
+{
+	if(length > 0) MAYADM_FWRITE(data, 1, length, file);
+}
+
+inline void writeString(FILE* file, const char* text)
+{
+	writeData(file, text, strlen(text));
+}
+
+/** Writes @a text preceded by @a prefix and followed by @a suffix, as fprintf with "prefix%ssuffix".*/
+inline void writeString(FILE* file, const char* prefix, const char* text, const char* suffix = "")
+{
+	writeString(file, prefix);
+	writeString(file, text);
+	writeString(file, suffix);
+}
+
+/** Writes the decimal digits of @a value to the end of @a buffer, at least @a minDigitCount.
+@return The first digit.*/
+inline char* formatDigits(char* bufferEnd, unsigned long long value, int minDigitCount = 1)
+{
+	char* p = bufferEnd;
+	while(value > 0 || minDigitCount > 0)
+	{
+		*--p = (char)('0' + value % 10);
+		value /= 10;
+		--minDigitCount;
+	}
+	return p;
+}
+
+/** Formats @a value into @a buffer as sprintf with "%i".
+@return The number of characters written, without terminating zero.*/
+inline size_t formatInt(char* buffer, long long value)
+{
+	char digits[24];
+	char* digitsEnd = digits + sizeof(digits);
+	unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+	char* first = formatDigits(digitsEnd, magnitude);
+	size_t length = 0;
+	if(value < 0) buffer[length++] = '-';
+	memcpy(buffer + length, first, digitsEnd - first);
+	return length + (digitsEnd - first);
+}
+
+/** Formats @a value into @a buffer as sprintf with "%f". @a buffer must hold MAX_VALUE_LENGTH characters.
+@return The number of characters written, without terminating zero.*/
+inline size_t formatFloat(char* buffer, double value)
+{
+	double magnitude = fabs(value);
+	if(magnitude < MAX_FAST_FLOAT)
+	{
+		// below 2^50 the product is at most 1/16 off, so it can only be rounded wrong close to .5
+		double scaled = magnitude * 1e6;
+		double integral = floor(scaled);
+		double fraction = scaled - integral;
+		if(fabs(fraction - 0.5) > 0.125)
+		{
+			unsigned long long micros = (unsigned long long)integral + (fraction > 0.5 ? 1 : 0);
+
+			unsigned long long bits;
+			memcpy(&bits, &value, sizeof(bits));
+
+			char digits[32];
+			char* digitsEnd = digits + sizeof(digits);
+			char* first = formatDigits(digitsEnd, micros % 1000000, 6);
+			*--first = '.';
+			first = formatDigits(first, micros / 1000000);
+			// as printf, negative values and -0 keep their sign, even if rounded to zero
+			if(bits >> 63) *--first = '-';
+
+			size_t length = digitsEnd - first;
+			memcpy(buffer, first, length);
+			return length;
+		}
+	}
+	// ties, large values, infinity and NaN
+	int length = MAYADM_SNPRINTF(buffer, MAX_VALUE_LENGTH, "%f", value);
+	return length > 0 ? (size_t)length : 0;
+}
+
+/** Writes @a value preceded by @a prefix and followed by @a suffix, as fprintf with "prefix%fsuffix".*/
+inline void writeFloat(FILE* file, const char* prefix, double value, const char* suffix = "")
+{
+	char buffer[MAX_VALUE_LENGTH];
+	writeString(file, prefix);
+	writeData(file, buffer, formatFloat(buffer, value));
+	writeString(file, suffix);
+}
+
+/** Writes @a value preceded by @a prefix and followed by @a suffix, as fprintf with "prefix%isuffix".*/
+inline void writeInt(FILE* file, const char* prefix, long long value, const char* suffix = "")
+{
+	char buffer[MAX_VALUE_LENGTH];
+	writeString(file, prefix);
+	writeData(file, buffer, formatInt(buffer, value));
+	writeString(file, suffix);
+}
+
+/** Writes @a count values separated by @a separator, as fprintf with "%f" for each value. The values
+are formatted into a buffer written at once, instead of writing each value to the file.*/
+template<class T>
+inline void writeFloats(FILE* file, const T* values, size_t count, char separator = ' ')
+{
+	char buffer[16 * MAX_VALUE_LENGTH];
+	size_t length = 0;
+	for(size_t i=0; i<count; ++i)
+	{
+		if(length + MAX_VALUE_LENGTH + 1 > sizeof(buffer))
+		{
+			writeData(file, buffer, length);
+			length = 0;
+		}
+		if(i > 0) buffer[length++] = separator;
+		length += formatFloat(buffer + length, values[i]);
+	}
+	writeData(file, buffer, length);
+}
+
+/** Writes @a count values separated by @a separator, as fprintf with "%i" for each value.*/
+template<class T>
+inline void writeInts(FILE* file, const T* values, size_t count, char separator = ' ')
+{
+	char buffer[16 * MAX_VALUE_LENGTH];
+	size_t length = 0;
+	for(size_t i=0; i<count; ++i)
+	{
+		if(length + MAX_VALUE_LENGTH + 1 > sizeof(buffer))
+		{
+			writeData(file, buffer, length);
+			length = 0;
+		}
+		if(i > 0) buffer[length++] = separator;
+		length += formatInt(buffer + length, values[i]);
+	}
+	writeData(file, buffer, length);
+}
+
+} //namespace MayaDM
+
+#endif//__MayaDM_WRITER_H__
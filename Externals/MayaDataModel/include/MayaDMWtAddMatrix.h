@@ -23,8 +23,8 @@ public:
 		void write(FILE* file) const
 		{
 			matrixIn.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", weightIn);
+			writeString(file," ");
+			writeFloat(file,"",weightIn);
 		}
 	};
 public:
@@ -36,77 +36,77 @@ public:
 
 	void setWtMatrix(size_t i_i,const WtMatrix& i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i]\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"]\" ");
 		i_.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWtMatrix(size_t i_start,size_t i_end,WtMatrix* i_)
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\" ");
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
 			i_[i].write(mFile);
-			fprintf(mFile,"\n");
+			writeString(mFile,"\n");
 		}
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void startWtMatrix(size_t i_start,size_t i_end)const
 	{
-		fprintf(mFile,"\tsetAttr \".i[%i:%i]\"",i_start,i_end);
-		fprintf(mFile," -type \"WtMatrix\" ");
+		writeInt(mFile,"\tsetAttr \".i[",i_start); writeInt(mFile,":",i_end,"]\"");
+		writeString(mFile," -type \"WtMatrix\" ");
 	}
 	void appendWtMatrix(const WtMatrix& i)const
 	{
-		fprintf(mFile," ");
+		writeString(mFile," ");
 		i.write(mFile);
 	}
 	void endWtMatrix()const
 	{
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setMatrixIn(size_t i_i,const matrix& m)
 	{
 		if(m == identity) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].m\" -type \"matrix\" ",i_i);
+		writeInt(mFile,"\tsetAttr \".i[",i_i,"].m\" -type \"matrix\" ");
 		m.write(mFile);
-		fprintf(mFile,";\n");
+		writeString(mFile,";\n");
 	}
 	void setWeightIn(size_t i_i,double w)
 	{
 		if(w == 0.0) return;
-		fprintf(mFile,"\tsetAttr \".i[%i].w\" %f;\n", i_i,w);
+		writeInt(mFile,"\tsetAttr \".i[",i_i); writeFloat(mFile,"].w\" ",w,";\n");
 	}
 	void getWtMatrix(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i]\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"]\"");
 	}
 	void getWtMatrix()const
 	{
 
-		fprintf(mFile,"\"%s.i\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i\"");
 	}
 	void getMatrixIn(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].m\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].m\"");
 	}
 	void getMatrixIn()const
 	{
 
-		fprintf(mFile,"\"%s.i.m\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.m\"");
 	}
 	void getWeightIn(size_t i_i)const
 	{
-		fprintf(mFile,"\"%s.i[%i].w\"",mName.c_str(),i_i);
+		writeString(mFile,"\"",mName.c_str()); writeInt(mFile,".i[",i_i,"].w\"");
 	}
 	void getWeightIn()const
 	{
 
-		fprintf(mFile,"\"%s.i.w\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".i.w\"");
 	}
 	void getMatrixSum()const
 	{
-		fprintf(mFile,"\"%s.o\"",mName.c_str());
+		writeString(mFile,"\"",mName.c_str(),".o\"");
 	}
 protected:
 	WtAddMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
@@ -13,7 +13,7 @@
 
 
 // This header includes all headers needed to use this library.
-// note: you have to set one of these preprocessor flags:
+// note: you have to set at least one of these preprocessor flags:
 // - GENERATEDSAXPARSER_XMLPARSER_LIBXML
 // - GENERATEDSAXPARSER_XMLPARSER_EXPAT
 #include "GeneratedSaxParserPrerequisites.h"
@@ -30,7 +30,8 @@
 #include "GeneratedSaxParserSaxParser.h"
 #if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
 #include "GeneratedSaxParserLibxmlSaxParser.h"
-#elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+#endif
+#if defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
 #include "GeneratedSaxParserExpatSaxParser.h"
 #endif
 #include "GeneratedSaxParserParserTemplateBase.h"
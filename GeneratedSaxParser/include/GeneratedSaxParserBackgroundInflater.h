@@ -0,0 +1,134 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_BACKGROUNDINFLATER_H__
+#define __GENERATEDSAXPARSER_BACKGROUNDINFLATER_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GeneratedSaxParser
+{
+	/** Inflates compressed data in memory on a second thread. The inflated data is passed to the reading
+	thread through a small ring of buffers, so inflating and parsing run concurrently, while the memory
+	used is bounded by the size of the ring.*/
+	class BackgroundInflater
+	{
+	public:
+		/** The formats of the compressed data.*/
+		enum Format
+		{
+			/** A gzip file. Files consisting of several gzip members are inflated completely.*/
+			FORMAT_GZIP,
+			/** Raw deflate data, as stored in zip archives.*/
+			FORMAT_DEFLATE
+		};
+
+		static const size_t DEFAULT_BUFFER_SIZE = 256 * 1024;
+		static const size_t DEFAULT_BUFFER_COUNT = 4;
+
+	private:
+		/** A buffer filled by the inflating thread.*/
+		struct FilledBuffer
+		{
+			char* data;
+			size_t length;
+		};
+
+		typedef std::deque<FilledBuffer> FilledBufferQueue;
+
+	private:
+		/** The compressed data.*/
+		const char* mCompressedData;
+		size_t mCompressedSize;
+
+		Format mFormat;
+
+		/** The size of each buffer of the ring.*/
+		size_t mBufferSize;
+
+		/** All buffers of the ring.*/
+		std::vector<char*> mBuffers;
+
+		/** The buffers the inflating thread can fill.*/
+		std::vector<char*> mFreeBuffers;
+
+		/** The buffers filled, but not yet read, in the order of the inflated data.*/
+		FilledBufferQueue mFilledBuffers;
+
+		/** The buffer returned by the last call of readChunk(). It is given back by the next call.*/
+		char* mReadBuffer;
+
+		/** True, once the inflating thread has filled its last buffer.*/
+		bool mFinished;
+
+		/** True, if the compressed data is corrupt or incomplete.*/
+		bool mFailed;
+
+		/** True, if the inflating thread should stop, since the data is not read anymore.*/
+		bool mStop;
+
+		/** Guards all members shared with the inflating thread.*/
+		mutable std::mutex mMutex;
+
+		/** Signaled, when the inflating thread has filled a buffer or finished.*/
+		std::condition_variable mBufferFilled;
+
+		/** Signaled, when a buffer has been read or the inflating thread should stop.*/
+		std::condition_variable mBufferFreed;
+
+		/** The inflating thread. Started last in the constructor.*/
+		std::thread mThread;
+
+	public:
+		/** Starts inflating the @a size bytes at @a data, which have to stay valid until the inflater
+		is destroyed.*/
+		BackgroundInflater( const char* data, size_t size, Format format, size_t bufferSize = DEFAULT_BUFFER_SIZE, size_t bufferCount = DEFAULT_BUFFER_COUNT );
+
+		/** Stops inflating, if the data has not been read completely, and waits for the inflating thread.*/
+		~BackgroundInflater();
+
+		/** Returns the next inflated bytes in @a chunk. They are valid until the next call. Waits, if
+		the inflating thread has not filled the next buffer yet.
+		@return The number of bytes in @a chunk, 0 at the end of the data or if it could not be inflated.*/
+		size_t readChunk( const char*& chunk );
+
+		/** Returns true, if the compressed data is corrupt or incomplete. Reliable after readChunk()
+		returned 0.*/
+		bool hasFailed() const;
+
+		/** Returns true, if the @a size bytes at @a data start like a gzip file.*/
+		static bool isGzipData( const char* data, size_t size );
+
+	private:
+		/** Disable default copy ctor. */
+		BackgroundInflater( const BackgroundInflater& pre );
+		/** Disable default assignment operator. */
+		const BackgroundInflater& operator= ( const BackgroundInflater& pre );
+
+		/** The main function of the inflating thread.*/
+		void inflateData();
+
+		/** Waits for a free buffer. Returns 0, if the inflating thread should stop.*/
+		char* takeFreeBuffer();
+
+		/** Passes the first @a length bytes of @a buffer to the reading thread. If @a finished is true,
+		no more buffers follow.*/
+		void passBuffer( char* buffer, size_t length, bool finished, bool failed );
+	};
+
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_BACKGROUNDINFLATER_H__
@@ -38,6 +38,11 @@ namespace GeneratedSaxParser
 
 		bool parseFile(const char* fileName);
 		virtual bool parseBuffer(const char* uri, const char* buffer, int length);
+		bool parseMemoryMappedFile(const char* fileName, ISectionFilter* sectionFilter = 0);
+
+		bool beginPushParsing(const char* uri);
+		bool pushData(const char* data, size_t length);
+		bool endPushParsing();
 
 		size_t getLineNumer()const;
 		size_t getColumnNumer()const;
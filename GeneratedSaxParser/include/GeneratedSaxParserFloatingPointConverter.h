@@ -0,0 +1,150 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_FLOATINGPOINTCONVERTER_H__
+#define __GENERATEDSAXPARSER_FLOATINGPOINTCONVERTER_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+#include "GeneratedSaxParserTypes.h"
+
+#include <float.h>
+
+
+namespace GeneratedSaxParser
+{
+	/** Decimal number as read from a character buffer, i.e. the value is mantissa * 10^exponent.
+	The digits are accumulated without any checks. If there are more than 19 of them, the 
+	mantissa might have overflown and FloatingPointConverter reads the digits again from the text.*/
+	struct DecimalNumber
+	{
+		uint64 mantissa;
+		sint64 exponent;
+		int digitCount;
+		bool negative;
+
+		DecimalNumber()
+			: mantissa(0)
+			, exponent(0)
+			, digitCount(0)
+			, negative(false)
+		{}
+
+		/** Appends a digit of the integer part.*/
+		void addIntegerDigit( ParserChar c )
+		{
+			mantissa = mantissa * 10 + (c - '0');
+			++digitCount;
+		}
+
+		/** Appends a digit of the fractional part.*/
+		void addFractionalDigit( ParserChar c )
+		{
+			mantissa = mantissa * 10 + (c - '0');
+			++digitCount;
+			--exponent;
+		}
+	};
+
+
+	/** Converts decimal numbers to the nearest float or double, i.e. the result is correctly
+	rounded. Most numbers are converted using the fast path of Clinger or the algorithm of
+	Eisel and Lemire. The few numbers these cannot decide are converted with the C library.*/
+	class FloatingPointConverter
+	{
+	public:
+		/** Converts @a number to the nearest value of type @a FloatingPointType.
+		@param number The decimal number.
+		@param text First character of the text @a number has been read from, including sign and exponent.
+		Only used for numbers with more than 19 digits and numbers the fast algorithms cannot decide.
+		@param textEnd The first character after the text @a number has been read from.*/
+		template<class FloatingPointType>
+		static FloatingPointType toFloatingPoint( const DecimalNumber& number, const ParserChar* text, const ParserChar* textEnd )
+		{
+			FloatingPointType value;
+			if ( clingerFastPath( number, value ) )
+				return value;
+			return convertSlowly<FloatingPointType>( number, text, textEnd );
+		}
+
+	private:
+		/** Disable default constructor. */
+		FloatingPointConverter();
+
+		/** Maximum number of digits that always fit into the mantissa of a DecimalNumber.*/
+		static const int MAX_MANTISSA_DIGITS = 19;
+
+		/** Fast path of Clinger: if the mantissa and the power of ten are exact in the floating point 
+		type, one multiplication or division yields the correctly rounded result.
+		@return True if the fast path could be taken and @a value has been set.*/
+		static bool clingerFastPath( const DecimalNumber& number, float& value );
+
+		/** @see clingerFastPath( const DecimalNumber& number, float& value ) */
+		static bool clingerFastPath( const DecimalNumber& number, double& value );
+
+		/** Converts numbers the fast path of Clinger cannot handle.*/
+		template<class FloatingPointType>
+		static FloatingPointType convertSlowly( const DecimalNumber& number, const ParserChar* text, const ParserChar* textEnd );
+	};
+
+	template<>
+	float FloatingPointConverter::convertSlowly<float>( const DecimalNumber& number, const ParserChar* text, const ParserChar* textEnd );
+
+	template<>
+	double FloatingPointConverter::convertSlowly<double>( const DecimalNumber& number, const ParserChar* text, const ParserChar* textEnd );
+
+	//--------------------------------------------------------------------
+	inline bool FloatingPointConverter::clingerFastPath( const DecimalNumber& number, float& value )
+	{
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD != 0)
+		// intermediate results with higher precision would be rounded twice
+		return false;
+#else
+		static const float powersOfTen[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+		if ( number.digitCount > MAX_MANTISSA_DIGITS || number.mantissa > ((uint64)1 << 24) ||
+			 number.exponent < -10 || number.exponent > 10 )
+			return false;
+
+		value = (float)number.mantissa;
+		if ( number.exponent < 0 )
+			value = value / powersOfTen[-number.exponent];
+		else
+			value = value * powersOfTen[number.exponent];
+		if ( number.negative )
+			value = -value;
+		return true;
+#endif
+	}
+
+	//--------------------------------------------------------------------
+	inline bool FloatingPointConverter::clingerFastPath( const DecimalNumber& number, double& value )
+	{
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD != 0)
+		return false;
+#else
+		static const double powersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+		if ( number.digitCount > MAX_MANTISSA_DIGITS || number.mantissa > ((uint64)1 << 53) ||
+			 number.exponent < -22 || number.exponent > 22 )
+			return false;
+
+		value = (double)number.mantissa;
+		if ( number.exponent < 0 )
+			value = value / powersOfTen[-number.exponent];
+		else
+			value = value * powersOfTen[number.exponent];
+		if ( number.negative )
+			value = -value;
+		return true;
+#endif
+	}
+
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_FLOATINGPOINTCONVERTER_H__
@@ -0,0 +1,40 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_ISECTIONFILTER_H__
+#define __GENERATEDSAXPARSER_ISECTIONFILTER_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+#include "GeneratedSaxParserTypes.h"
+
+namespace GeneratedSaxParser
+{
+	/** Decides which child elements of the root element of a memory mapped document are passed to the
+	xml parser. See SaxParser::parseMemoryMappedFile().*/
+	class ISectionFilter
+	{
+	public:
+		ISectionFilter(){}
+		virtual ~ISectionFilter(){}
+
+		/** Returns false, if the child element of the root element with the qualified name @a elementName,
+		which is not null terminated, does not need to be parsed at all.*/
+		virtual bool isSectionRequired( const ParserChar* elementName, size_t elementNameLength ) = 0;
+
+	private:
+		/** Disable default copy ctor. */
+		ISectionFilter( const ISectionFilter& pre );
+		/** Disable default assignment operator. */
+		const ISectionFilter& operator= ( const ISectionFilter& pre );
+	};
+
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_ISECTIONFILTER_H__
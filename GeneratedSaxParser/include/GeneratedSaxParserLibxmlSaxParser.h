@@ -16,6 +16,9 @@
 #include "GeneratedSaxParserIErrorHandler.h"
 #include <libxml/parser.h>
 
+#include <unordered_map>
+#include <vector>
+
 
 namespace GeneratedSaxParser
 {
@@ -24,21 +27,79 @@ namespace GeneratedSaxParser
 
 	class LibxmlSaxParser  : public SaxParser
 	{
+	public:
+		/** The libxml interface used to receive the sax events.*/
+		enum SaxInterface
+		{
+			/** libxml passes qualified names and null terminated attribute arrays. Each element name is
+			hashed by the parser.*/
+			SAX1,
+			/** libxml passes local names and prefixes interned in its dictionary. The qualified names
+			and their hashes are calculated once per distinct name and looked up by the interned 
+			pointers afterwards.*/
+			SAX2
+		};
+
+	private:
+		/** Qualified name of an element or attribute and the hashes of the element name.*/
+		struct QualifiedName
+		{
+			/** The qualified name. Points either to the interned local name or to qualifiedNameBuffer.*/
+			const ParserChar* name;
+			/** Holds prefix:localname for names with a prefix.*/
+			String qualifiedNameBuffer;
+			StringHashPair hashPair;
+		};
+
+		/** Prefix and local name, as interned by libxml.*/
+		typedef std::pair<const ::xmlChar*, const ::xmlChar*> InternedName;
+
+		struct InternedNameHash
+		{
+			size_t operator()( const InternedName& internedName ) const
+			{
+				return (size_t)internedName.first * 31 + ((size_t)internedName.second >> 3);
+			}
+		};
+
+		typedef std::unordered_map<InternedName, QualifiedName, InternedNameHash> QualifiedNameMap;
+
 	private:
 		static xmlSAXHandler SAXHANDLER;
+		static xmlSAXHandler SAX2HANDLER;
 
 		xmlParserCtxtPtr mParserContext;
 
+		SaxInterface mSaxInterface;
+
+		/** The names of the elements and attributes of the current document, if SAX2 is used. Valid as 
+		long as the dictionary of mParserContext.*/
+		QualifiedNameMap mQualifiedNames;
+
+		/** The null terminated attribute array passed to the parser, if SAX2 is used.*/
+		std::vector<const ParserChar*> mAttributeArray;
+
+		/** The null terminated attribute values mAttributeArray points to.*/
+		std::vector<ParserChar> mAttributeValues;
+
 	public:
-		LibxmlSaxParser(Parser* parser);
+		LibxmlSaxParser(Parser* parser, SaxInterface saxInterface = SAX1);
 		virtual ~LibxmlSaxParser();
 
 		bool parseFile(const char* fileName);
 		bool parseBuffer(const char* uri, const char* buffer, int length);
+		bool parseMemoryMappedFile(const char* fileName, ISectionFilter* sectionFilter = 0);
+
+		bool beginPushParsing(const char* uri);
+		bool pushData(const char* data, size_t length);
+		bool endPushParsing();
 
 		size_t getLineNumer()const;
 		size_t getColumnNumer()const;
 
+		/** Returns the libxml interface used.*/
+		SaxInterface getSaxInterface() const { return mSaxInterface; }
+
 	private:
         /** Disable default copy ctor. */
 		LibxmlSaxParser( const LibxmlSaxParser& pre );
@@ -50,10 +111,37 @@ namespace GeneratedSaxParser
 
 		static void characters( void* user_data, const ::xmlChar* name, int length );
 
+		static void startElementNs( void* user_data, const ::xmlChar* localname, const ::xmlChar* prefix, const ::xmlChar* URI,
+			int nb_namespaces, const ::xmlChar** namespaces, int nb_attributes, int nb_defaulted, const ::xmlChar** attributes );
+		static void endElementNs( void* user_data, const ::xmlChar* localname, const ::xmlChar* prefix, const ::xmlChar* URI );
+
+		/** Returns the qualified name of @a localname with @a prefix, which may be 0.*/
+		const QualifiedName& getQualifiedName( const ::xmlChar* prefix, const ::xmlChar* localname );
+
+		/** Fills mAttributeArray with the namespace declarations and attributes passed to 
+		startElementNs(), in the layout the SAX1 interface uses.
+		@return The attribute array, 0 if there are neither namespace declarations nor attributes.*/
+		const ParserChar** createAttributeArray( int namespaceCount, const ::xmlChar** namespaces, int attributeCount, const ::xmlChar** attributes );
+
 		static void errorFunction (void *ctx,	const char *msg, ...);
 
 		void initializeParserContext();
 
+		/** Parses the document using the already created mParserContext and frees the context
+		afterwards.
+		@return False, if a fatal error occurred or the parsing has been aborted.*/
+		bool parseDocument();
+
+		/** Makes mParserContext pass the sax events to this object.*/
+		void attachSaxHandler();
+
+		/** Frees mParserContext after parsing.*/
+		void freeParserContext();
+
+		/** Read callback that copies the next bytes of a memory mapped file into libxml's input buffer.
+		@a context is the SectionReader of the file.*/
+		static int readMemoryMappedFile( void* context, char* buffer, int length );
+
 		void abortParsing();
 
 	};
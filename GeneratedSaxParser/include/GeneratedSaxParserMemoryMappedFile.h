@@ -0,0 +1,71 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
+#define __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+
+
+namespace GeneratedSaxParser
+{
+	/** Read only view of a complete file, mapped into the address space of the process.
+	The pages are supplied by the operating system on demand, i.e. the content of the file is
+	not copied into a user space buffer.*/
+	class MemoryMappedFile
+	{
+	private:
+		/** Pointer to the first byte of the mapping or 0 if no file is mapped.*/
+		const char* mData;
+
+		/** Size of the mapped file in bytes.*/
+		size_t mSize;
+
+#if defined(COLLADABU_OS_WIN)
+		/** Handle of the opened file.*/
+		void* mFileHandle;
+
+		/** Handle of the file mapping object.*/
+		void* mMappingHandle;
+#else
+		/** Descriptor of the opened file.*/
+		int mFileDescriptor;
+#endif
+
+	public:
+		MemoryMappedFile();
+
+		/** Unmaps the file, if still mapped.*/
+		~MemoryMappedFile();
+
+		/** Maps the complete file @a fileName. A previously mapped file is unmapped first.
+		@return True if the file could be opened and mapped, false otherwise. Empty files are
+		reported as success with a size of 0.*/
+		bool open( const char* fileName );
+
+		/** Unmaps the file and closes all handles.*/
+		void close();
+
+		/** Returns the first byte of the mapped file or 0 if no file is mapped.*/
+		const char* getData() const { return mData; }
+
+		/** Returns the size of the mapped file in bytes.*/
+		size_t getSize() const { return mSize; }
+
+	private:
+		/** Disable default copy ctor. */
+		MemoryMappedFile( const MemoryMappedFile& pre );
+		/** Disable default assignment operator. */
+		const MemoryMappedFile& operator= ( const MemoryMappedFile& pre );
+	};
+
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
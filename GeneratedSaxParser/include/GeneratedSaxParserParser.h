@@ -31,6 +31,11 @@ namespace GeneratedSaxParser
 
 		virtual bool elementBegin(const ParserChar* elementName, const ParserAttributes& attributes )=0;
 
+		/** Same as elementBegin(), called by sax parsers that already know the hashes of the element
+		name, as calculated by Utils::calculateStringHashWithNamespace(). The default implementation
+		ignores them.*/
+		virtual bool elementBeginWithHash(const ParserChar* elementName, const StringHashPair& elementHashPair, const ParserAttributes& attributes ) { return elementBegin( elementName, attributes ); }
+
 		virtual bool elementEnd(const ParserChar* elementName )=0;
 
 		virtual bool textData(const ParserChar* text, size_t textLength)=0;
@@ -23,6 +23,7 @@
 
 #include <map>
 #include <stack>
+#include <vector>
 #include <string.h>
 
 
@@ -135,6 +136,37 @@ namespace GeneratedSaxParser
         /** Number of elements that have been opened and are in a different namespace. */
         size_t mNamespaceElements;
 
+        /** Result of the dispatch of an element with a certain name and xml namespace inside an
+        element of a certain type. Caches what findElementHash(), mElementToNamespaceMap and the
+        function map return for that combination. */
+        struct DispatchEntry
+        {
+            size_t parentTypeID;
+            StringHash elementHash;
+            StringHash namespaceHash;
+            size_t typeID;
+            StringHash generatedElementHash;
+            /** The functions of the element. 0 marks an unused entry. */
+            const FunctionStruct* functions;
+        };
+        typedef std::vector<DispatchEntry> DispatchTable;
+
+        /** Parent type id used for the root element. */
+        static const size_t ROOT_PARENT_TYPE_ID = (size_t)-1;
+        /** Number of entries of the dispatch table, when the first element is added. */
+        static const size_t INITIAL_DISPATCH_TABLE_SIZE = 256;
+
+        /** Open addressing hash table of all elements dispatched to generated functions so far. Its
+        size is a power of two and it is never filled by more than half. */
+        DispatchTable mDispatchTable;
+        /** Number of used entries in mDispatchTable. */
+        size_t mDispatchEntryCount;
+        /** If false, mDispatchTable is neither used nor filled. */
+        bool mDispatchCacheEnabled;
+        /** The functions of the elements in mElementDataStack, so that text data and element ends
+        need no lookup. */
+        std::vector<const FunctionStruct*> mElementFunctionsStack;
+
 
 	public:
 		ParserTemplate(ImplClass* impl, IErrorHandler* errorHandler)
@@ -147,7 +179,9 @@ namespace GeneratedSaxParser
               mLaxNamespaceHandling(false),
 			  mIgnoreElements(0),
               mUnknownElements(0),
-              mNamespaceElements(0)
+              mNamespaceElements(0),
+              mDispatchEntryCount(0),
+              mDispatchCacheEnabled(true)
 		  {};
 		virtual ~ParserTemplate(){};
 
@@ -167,7 +201,7 @@ namespace GeneratedSaxParser
         const ElementFunctionMap* getElementFunctionMap() {return mCurrentElementFunctionMap;}
 
         /** Sets a new ElementFunctionMap. May be used to retrieve certain data first. */
-        void setElementFunctionMap(const ElementFunctionMap* map) {mCurrentElementFunctionMap = map;}
+        void setElementFunctionMap(const ElementFunctionMap* map) {mCurrentElementFunctionMap = map; clearDispatchCache();}
 
         /** Returns complete ElementFunctionMap (the one containing all function pointers). */
         const ElementFunctionMap& getCompleteElementFunctionMap() {return mElementFunctionMap;}
@@ -175,11 +209,21 @@ namespace GeneratedSaxParser
         /** Returns whether lax namespace handling is turned on. */
         bool isLaxNamespaceHandling() {return mLaxNamespaceHandling;}
         /** Enables/Disables lax namespace handling. */
-        void setLaxNamespaceHandling(bool value) {mLaxNamespaceHandling=value;}
+        void setLaxNamespaceHandling(bool value) {mLaxNamespaceHandling=value; clearDispatchCache();}
+
+        /** Returns whether the dispatch of elements to generated functions is cached. */
+        bool isDispatchCacheEnabled() {return mDispatchCacheEnabled;}
+        /** Enables/Disables the cache of element dispatches. Enabled by default. Once an element has
+        been found below a parent of a certain type, the next element with the same name and namespace
+        below a parent of that type is dispatched with one lookup in a flat hash table, instead of
+        findElementHash() and two map lookups. */
+        void setDispatchCacheEnabled(bool value) {mDispatchCacheEnabled=value; clearDispatchCache();}
 
     public:
 		bool elementBegin(const ParserChar* elementName, const ParserAttributes& attributes );
 
+		bool elementBeginWithHash(const ParserChar* elementName, const StringHashPair& elementHashPair, const ParserAttributes& attributes );
+
 		bool elementEnd(const ParserChar* elementName );
 
 		bool textData(const ParserChar* text, size_t textLength);
@@ -192,6 +236,21 @@ namespace GeneratedSaxParser
         /** Checks for xmlns and xmlns:<name> attributes to add them to mNamespacesStack. */
         void parseNamespaceDeclarations( const ParserAttributes& attributes );
 
+    private:
+        /** Looks up the dispatch of the element @a elementData inside an element of type
+        @a parentTypeID. If found, the type id and generated element hash of @a elementData are set.
+        @return The functions of the element, 0 if the element is not in the dispatch cache. */
+        const FunctionStruct* findDispatchEntry( size_t parentTypeID, StringHash namespaceHash, ElementData& elementData ) const;
+
+        /** Adds the dispatch of the element @a elementData to @a functions to the dispatch cache. */
+        void addDispatchEntry( size_t parentTypeID, StringHash namespaceHash, const ElementData& elementData, const FunctionStruct* functions );
+
+        /** Removes all entries from the dispatch cache. */
+        void clearDispatchCache();
+
+        /** Returns the first entry of the dispatch table of size @a tableSize to probe for the key. */
+        static size_t calculateDispatchSlot( size_t parentTypeID, StringHash elementHash, StringHash namespaceHash, size_t tableSize );
+
 	protected:
 		template<class DataType,
 				 DataType (*toData)( const ParserChar**, const ParserChar*, bool& )
@@ -791,7 +850,20 @@ namespace GeneratedSaxParser
                             }
                         }
 #endif
-                        (mImpl->*dataFunction)(typedBuffer, dataBufferIndex);
+                        if ( !(mImpl->*dataFunction)(typedBuffer, dataBufferIndex) )
+                        {
+                            // the data function wants to abort
+                            mStackMemoryManager.deleteObject();  //typedBuffer
+                            if ( haveToDeleteParsedFragmentData )
+                                mStackMemoryManager.deleteObject(); // haveToDeleteParsedFragmentData
+                            if ( mLastIncompleteFragmentInCharacterData )
+                            {
+                                mStackMemoryManager.deleteObject(); //mLastIncompleteFragmentInCharacterData
+                                mLastIncompleteFragmentInCharacterData = 0;
+                                mEndOfDataInCurrentObjectOnStack = 0;
+                            }
+                            return false;
+                        }
 					    dataBufferIndex = 0;
                         callsToDataFunc++;
 				    }
@@ -833,7 +905,20 @@ namespace GeneratedSaxParser
                         }
                     }
 #endif
-                    (mImpl->*dataFunction)(typedBuffer, dataBufferIndex);
+                    if ( !(mImpl->*dataFunction)(typedBuffer, dataBufferIndex) )
+                    {
+                        // the data function wants to abort
+                        mStackMemoryManager.deleteObject();  //typedBuffer
+                        if ( haveToDeleteParsedFragmentData )
+                            mStackMemoryManager.deleteObject(); // haveToDeleteParsedFragmentData
+                        if ( mLastIncompleteFragmentInCharacterData )
+                        {
+                            mStackMemoryManager.deleteObject(); //mLastIncompleteFragmentInCharacterData
+                            mLastIncompleteFragmentInCharacterData = 0;
+                            mEndOfDataInCurrentObjectOnStack = 0;
+                        }
+                        return false;
+                    }
                     callsToDataFunc++;
                 }
 			    mStackMemoryManager.deleteObject();
@@ -990,7 +1075,20 @@ namespace GeneratedSaxParser
                 ++dataBufferIndex;
                 if ( dataBufferIndex == TYPED_VALUES_BUFFER_SIZE )
                 {
-                    (mImpl->*dataFunction)(typedBuffer, dataBufferIndex);
+                    if ( !(mImpl->*dataFunction)(typedBuffer, dataBufferIndex) )
+                    {
+                        // the data function wants to abort
+                        mStackMemoryManager.deleteObject();  //typedBuffer
+                        if ( haveToDeleteParsedFragmentData )
+                            mStackMemoryManager.deleteObject(); // haveToDeleteParsedFragmentData
+                        if ( mLastIncompleteFragmentInCharacterData )
+                        {
+                            mStackMemoryManager.deleteObject(); //mLastIncompleteFragmentInCharacterData
+                            mLastIncompleteFragmentInCharacterData = 0;
+                            mEndOfDataInCurrentObjectOnStack = 0;
+                        }
+                        return false;
+                    }
                     dataBufferIndex = 0;
                     callsToDataFunc++;
                 }
@@ -1004,7 +1102,20 @@ namespace GeneratedSaxParser
             // we need to store the not parsed fraction
             if ( dataBufferIndex > 0)
             {
-                (mImpl->*dataFunction)(typedBuffer, dataBufferIndex);
+                if ( !(mImpl->*dataFunction)(typedBuffer, dataBufferIndex) )
+                {
+                    // the data function wants to abort
+                    mStackMemoryManager.deleteObject();  //typedBuffer
+                    if ( haveToDeleteParsedFragmentData )
+                        mStackMemoryManager.deleteObject(); // haveToDeleteParsedFragmentData
+                    if ( mLastIncompleteFragmentInCharacterData )
+                    {
+                        mStackMemoryManager.deleteObject(); //mLastIncompleteFragmentInCharacterData
+                        mLastIncompleteFragmentInCharacterData = 0;
+                        mEndOfDataInCurrentObjectOnStack = 0;
+                    }
+                    return false;
+                }
                 callsToDataFunc++;
             }
             mStackMemoryManager.deleteObject();
@@ -1511,7 +1622,7 @@ namespace GeneratedSaxParser
             }
 #endif
             if ( !failed )
-                (mImpl->*dataFunction)(&typedValue, 1);
+                return (mImpl->*dataFunction)(&typedValue, 1);
 
 		}
 		return true;
@@ -1561,7 +1672,7 @@ namespace GeneratedSaxParser
             }
             else
             {
-                (mImpl->*dataFunction)(&typedValue, 1);
+                return (mImpl->*dataFunction)(&typedValue, 1);
             }
 
         }
@@ -1822,22 +1933,29 @@ namespace GeneratedSaxParser
             return mActiveNamespaceHandler->textData( text, textLength );
         }
 
-        if ( mElementDataStack.empty() )
+        if ( mElementFunctionsStack.empty() )
             return false;
-        ElementData elementData = mElementDataStack.back();
-        typename ElementFunctionMap::const_iterator it;
+		const FunctionStruct& functions = *mElementFunctionsStack.back();
 
-        const ElementFunctionMap* functionMapToUse;
-        if ( mCurrentElementFunctionMap )
-            functionMapToUse = mCurrentElementFunctionMap;
-        else
-            functionMapToUse = &mElementFunctionMap;
-		it = functionMapToUse->find(elementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
-			return true;
-		const FunctionStruct& functions = it->second;
+		if ( !functions.textDataFunction )
+			return false;
 
-		if ( !functions.textDataFunction || !(static_cast<DerivedClass*>(this)->*functions.textDataFunction)(text, textLength) )
+		// long text, e.g. a whole float_array passed by a parser working on a memory mapped file,
+		// is passed in slices. Text data functions that accumulate text then grow their buffer in
+		// small steps and never have to handle more than a slice at once.
+		while ( textLength > TEXT_DATA_SLICE_SIZE )
+		{
+			size_t sliceLength = TEXT_DATA_SLICE_SIZE;
+			// do not split UTF-8 sequences
+			while ( sliceLength > 1 && (((unsigned char)text[sliceLength]) & 0xC0) == 0x80 )
+				--sliceLength;
+			if ( !(static_cast<DerivedClass*>(this)->*functions.textDataFunction)(text, sliceLength) )
+				return false;
+			text += sliceLength;
+			textLength -= sliceLength;
+		}
+
+		if ( !(static_cast<DerivedClass*>(this)->*functions.textDataFunction)(text, textLength) )
 			return false;
 
 		return true;
@@ -1883,27 +2001,17 @@ namespace GeneratedSaxParser
         if ( mElementDataStack.empty() )
             return false;
         ElementData elementData = mElementDataStack.back();
-
-        const ElementFunctionMap* functionMapToUse;
-        if ( mCurrentElementFunctionMap )
-            functionMapToUse = mCurrentElementFunctionMap;
-        else
-            functionMapToUse = &mElementFunctionMap;
-        typename ElementFunctionMap::const_iterator it = functionMapToUse->find(elementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
-        {
-            mElementDataStack.pop_back();
-			return false;
-        }
-		const FunctionStruct& functions = it->second;
+		const FunctionStruct& functions = *mElementFunctionsStack.back();
 
 		if ( !functions.validateEndFunction || !(static_cast<DerivedClass*>(this)->*functions.validateEndFunction)())
         {
             mElementDataStack.pop_back();
+            mElementFunctionsStack.pop_back();
 			return false;
         }
 
         mElementDataStack.pop_back();
+        mElementFunctionsStack.pop_back();
 
         if ( !functions.endFunction || !(static_cast<DerivedClass*>(this)->*functions.endFunction)() )
 			return false;
@@ -1919,6 +2027,16 @@ namespace GeneratedSaxParser
 	template<class DerivedClass, class ImplClass>
 	bool ParserTemplate<DerivedClass, ImplClass>::elementBegin( const ParserChar* elementName,
 																   const ParserAttributes& attributes)
+	{
+		return elementBeginWithHash( elementName, Utils::calculateStringHashWithNamespace(elementName), attributes );
+	}
+
+
+	//--------------------------------------------------------------------
+	template<class DerivedClass, class ImplClass>
+	bool ParserTemplate<DerivedClass, ImplClass>::elementBeginWithHash( const ParserChar* elementName,
+																		   const StringHashPair& elementHashPair,
+																		   const ParserAttributes& attributes)
 	{
         if ( (mIgnoreElements > 0 || mUnknownElements > 0 || mNamespaceElements > 0) 
             && !mNamespacesStack.empty() )
@@ -1945,8 +2063,7 @@ namespace GeneratedSaxParser
         if ( mNamespaceElements > 0 )
         {
             mNamespaceElements++;
-            StringHashPair hashPair = Utils::calculateStringHashWithNamespace( elementName );
-            return mActiveNamespaceHandler->elementBegin( hashPair.second, elementName, attributes.attributes );
+            return mActiveNamespaceHandler->elementBegin( elementHashPair.second, elementName, attributes.attributes );
         }
 
         if ( isDifferentNamespaceAllowed() )
@@ -1954,9 +2071,8 @@ namespace GeneratedSaxParser
             parseNamespaceDeclarations( attributes );
         }
         ElementData newElementData;
-        StringHashPair elementNsPair = Utils::calculateStringHashWithNamespace(elementName);
-        newElementData.elementHash = elementNsPair.second;
-        StringHash currentNsPrefix = elementNsPair.first;
+        newElementData.elementHash = elementHashPair.second;
+        StringHash currentNsPrefix = elementHashPair.first;
         StringHash namespaceHash = 0;
         if ( !mNamespacesStack.empty() )
         {
@@ -1970,78 +2086,91 @@ namespace GeneratedSaxParser
         newElementData.generatedElementHash = 0;
         newElementData.typeID = 0;
         newElementData.validationData = 0;
-        bool foundElementHash = findElementHash( newElementData );
 
-        bool correctNamespace = false;
-        if ( foundElementHash )
+        size_t parentTypeID = ROOT_PARENT_TYPE_ID;
+        if ( !mElementDataStack.empty() )
+            parentTypeID = mElementDataStack.back().typeID;
+        const FunctionStruct* elementFunctions = 0;
+        if ( mDispatchCacheEnabled )
+            elementFunctions = findDispatchEntry( parentTypeID, namespaceHash, newElementData );
+        if ( !elementFunctions )
         {
-            typename NamespacePrefixesMap::const_iterator nsFromMap = mElementToNamespaceMap.find( newElementData.generatedElementHash );
-            if ( nsFromMap != mElementToNamespaceMap.end() && nsFromMap->second == namespaceHash )
-            {
-                correctNamespace = true;
-            }
-        }
+            bool foundElementHash = findElementHash( newElementData );
 
-        const ElementFunctionMap* functionMapToUse;
-        if ( mCurrentElementFunctionMap )
-            functionMapToUse = mCurrentElementFunctionMap;
-        else
-            functionMapToUse = &mElementFunctionMap;
-        typename ElementFunctionMap::const_iterator it = functionMapToUse->end();
-        if ( foundElementHash && (correctNamespace || mLaxNamespaceHandling) )
-            it = functionMapToUse->find(newElementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
-		{
-            INamespaceHandler* nsHandler = mNamespaceHandlers[ namespaceHash ];
-            if ( nsHandler != 0 )
-            {
-                mActiveNamespaceHandler = nsHandler;
-                mNamespaceElements = 1;
-                return nsHandler->elementBegin( newElementData.elementHash, elementName, attributes.attributes );
-            }
-            if ( isXsAnyAllowed( newElementData.elementHash ) )
+            bool correctNamespace = false;
+            if ( foundElementHash )
             {
-                mUnknownElements = 1;
+                typename NamespacePrefixesMap::const_iterator nsFromMap = mElementToNamespaceMap.find( newElementData.generatedElementHash );
+                if ( nsFromMap != mElementToNamespaceMap.end() && nsFromMap->second == namespaceHash )
+                {
+                    correctNamespace = true;
+                }
             }
+
+            const ElementFunctionMap* functionMapToUse;
+            if ( mCurrentElementFunctionMap )
+                functionMapToUse = mCurrentElementFunctionMap;
             else
-            {
-                it = mElementFunctionMap.find(newElementData.elementHash);
-                if ( it != mElementFunctionMap.end() && correctNamespace )
+                functionMapToUse = &mElementFunctionMap;
+            typename ElementFunctionMap::const_iterator it = functionMapToUse->end();
+            if ( foundElementHash && (correctNamespace || mLaxNamespaceHandling) )
+                it = functionMapToUse->find(newElementData.generatedElementHash);
+			if ( it == functionMapToUse->end() )
+			{
+                INamespaceHandler* nsHandler = mNamespaceHandlers[ namespaceHash ];
+                if ( nsHandler != 0 )
                 {
-                    mIgnoreElements = 1;
+                    mActiveNamespaceHandler = nsHandler;
+                    mNamespaceElements = 1;
+                    return nsHandler->elementBegin( newElementData.elementHash, elementName, attributes.attributes );
                 }
-                else
+                if ( isXsAnyAllowed( newElementData.elementHash ) )
                 {
                     mUnknownElements = 1;
                 }
-            }
-            if ( mIgnoreElements )
-            {
-                return true;
-            }
-            if ( mUnknownElements )
-            {
-                if ( mUnknownHandler != 0 )
+                else
                 {
-                    return mUnknownHandler->elementBegin( elementName, attributes.attributes );
+                    it = mElementFunctionMap.find(newElementData.elementHash);
+                    if ( it != mElementFunctionMap.end() && correctNamespace )
+                    {
+                        mIgnoreElements = 1;
+                    }
+                    else
+                    {
+                        mUnknownElements = 1;
+                    }
                 }
-                else
+                if ( mIgnoreElements )
                 {
-			        if ( handleError(ParserError::SEVERITY_ERROR_NONCRITICAL,
-							         ParserError::ERROR_UNKNOWN_ELEMENT,
-				                     0,
-				                     elementName))
-			        {
-				        return false;
-			        }
-			        else
-			        {
-				        return true;
-			        }
+                    return true;
                 }
-            }
-		}
-		const FunctionStruct& functions = it->second;
+                if ( mUnknownElements )
+                {
+                    if ( mUnknownHandler != 0 )
+                    {
+                        return mUnknownHandler->elementBegin( elementName, attributes.attributes );
+                    }
+                    else
+                    {
+				        if ( handleError(ParserError::SEVERITY_ERROR_NONCRITICAL,
+								         ParserError::ERROR_UNKNOWN_ELEMENT,
+					                     0,
+					                     elementName))
+				        {
+					        return false;
+				        }
+				        else
+				        {
+					        return true;
+				        }
+                    }
+                }
+			}
+            elementFunctions = &it->second;
+            if ( mDispatchCacheEnabled )
+                addDispatchEntry( parentTypeID, namespaceHash, newElementData, elementFunctions );
+        }
+		const FunctionStruct& functions = *elementFunctions;
 
 		void* attributeData = 0;
 		void* validationData = 0;
@@ -2070,6 +2199,7 @@ namespace GeneratedSaxParser
 		if ( success )
 		{
             mElementDataStack.push_back(newElementData);
+            mElementFunctionsStack.push_back(elementFunctions);
 			newElementData.validationData = validationData;
 		}
 		return success;
@@ -2372,6 +2502,83 @@ namespace GeneratedSaxParser
         }
     }
 
+    //--------------------------------------------------------------------
+    template<class DerivedClass, class ImplClass>
+    size_t ParserTemplate<DerivedClass, ImplClass>::calculateDispatchSlot( size_t parentTypeID, StringHash elementHash, StringHash namespaceHash, size_t tableSize )
+    {
+        size_t hash = (size_t)elementHash;
+        hash ^= parentTypeID + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= (size_t)namespaceHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash & (tableSize - 1);
+    }
+
+    //--------------------------------------------------------------------
+    template<class DerivedClass, class ImplClass>
+    const typename ParserTemplate<DerivedClass, ImplClass>::FunctionStruct* ParserTemplate<DerivedClass, ImplClass>::findDispatchEntry( size_t parentTypeID, StringHash namespaceHash, ElementData& elementData ) const
+    {
+        size_t tableSize = mDispatchTable.size();
+        if ( tableSize == 0 )
+            return 0;
+        size_t slot = calculateDispatchSlot( parentTypeID, elementData.elementHash, namespaceHash, tableSize );
+        while ( true )
+        {
+            const DispatchEntry& entry = mDispatchTable[ slot ];
+            if ( !entry.functions )
+                return 0;
+            if ( entry.elementHash == elementData.elementHash && entry.parentTypeID == parentTypeID && entry.namespaceHash == namespaceHash )
+            {
+                elementData.typeID = entry.typeID;
+                elementData.generatedElementHash = entry.generatedElementHash;
+                return entry.functions;
+            }
+            slot = (slot + 1) & (tableSize - 1);
+        }
+    }
+
+    //--------------------------------------------------------------------
+    template<class DerivedClass, class ImplClass>
+    void ParserTemplate<DerivedClass, ImplClass>::addDispatchEntry( size_t parentTypeID, StringHash namespaceHash, const ElementData& elementData, const FunctionStruct* functions )
+    {
+        if ( (mDispatchEntryCount + 1) * 2 > mDispatchTable.size() )
+        {
+            size_t newSize = mDispatchTable.empty() ? INITIAL_DISPATCH_TABLE_SIZE : mDispatchTable.size() * 2;
+            DispatchTable oldTable( newSize );
+            oldTable.swap( mDispatchTable );
+            for ( size_t i = 0; i < oldTable.size(); ++i )
+            {
+                const DispatchEntry& entry = oldTable[ i ];
+                if ( !entry.functions )
+                    continue;
+                size_t slot = calculateDispatchSlot( entry.parentTypeID, entry.elementHash, entry.namespaceHash, newSize );
+                while ( mDispatchTable[ slot ].functions )
+                    slot = (slot + 1) & (newSize - 1);
+                mDispatchTable[ slot ] = entry;
+            }
+        }
+
+        size_t tableSize = mDispatchTable.size();
+        size_t slot = calculateDispatchSlot( parentTypeID, elementData.elementHash, namespaceHash, tableSize );
+        while ( mDispatchTable[ slot ].functions )
+            slot = (slot + 1) & (tableSize - 1);
+
+        DispatchEntry& entry = mDispatchTable[ slot ];
+        entry.parentTypeID = parentTypeID;
+        entry.elementHash = elementData.elementHash;
+        entry.namespaceHash = namespaceHash;
+        entry.typeID = elementData.typeID;
+        entry.generatedElementHash = elementData.generatedElementHash;
+        entry.functions = functions;
+        mDispatchEntryCount++;
+    }
+
+    //--------------------------------------------------------------------
+    template<class DerivedClass, class ImplClass>
+    void ParserTemplate<DerivedClass, ImplClass>::clearDispatchCache()
+    {
+        DispatchTable().swap( mDispatchTable );
+        mDispatchEntryCount = 0;
+    }
+
 } // namespace GeneratedSaxParser
 
 #endif // __GENERATEDSAXPARSER_COLLADAPARSERTEMPLATE_H__
@@ -38,6 +38,10 @@ namespace GeneratedSaxParser
 		/** Number of floats that fit into the buffer, used to convert text data to a float array.*/
 		static const size_t TYPED_VALUES_BUFFER_SIZE = 1000;
 
+		/** Maximum number of characters passed to a text data function at once. Longer text is 
+		passed in several calls.*/
+		static const size_t TEXT_DATA_SLICE_SIZE = 64*1024;
+
 		struct ElementData
 		{
 			StringHash elementHash;
@@ -349,7 +353,7 @@ namespace GeneratedSaxParser
 
         //find first whitespace in buffer
         const ParserChar* bufferPos = *buffer;
-        while ( !Utils::isWhiteSpace(*bufferPos) )
+        while ( bufferPos < bufferEnd && !Utils::isWhiteSpace(*bufferPos) )
             ++bufferPos;
 
         size_t prefixBufferSize = prefixBufferPos - prefixBufferStartPos;
@@ -391,7 +395,7 @@ namespace GeneratedSaxParser
 
         //find first whitespace in buffer
         const ParserChar* bufferPos = *buffer;
-        while ( !Utils::isWhiteSpace(*bufferPos) && bufferPos < bufferEnd )
+        while ( bufferPos < bufferEnd && !Utils::isWhiteSpace(*bufferPos) )
             ++bufferPos;
 
         size_t prefixBufferSize = prefixBufferPos - prefixBufferStartPos;
@@ -437,7 +441,7 @@ namespace GeneratedSaxParser
 
         //find first whitespace in buffer
         const ParserChar* bufferPos = *buffer;
-        while ( !Utils::isWhiteSpace(*bufferPos) )
+        while ( bufferPos < bufferEnd && !Utils::isWhiteSpace(*bufferPos) )
             ++bufferPos;
 
         size_t prefixBufferSize = prefixBufferPos - prefixBufferStartPos;
@@ -17,6 +17,8 @@
 namespace GeneratedSaxParser
 {
 	class Parser;
+	class ISectionFilter;
+	class ZipArchive;
 
 	class SaxParser
 	{
@@ -30,12 +32,46 @@ namespace GeneratedSaxParser
 		virtual bool parseFile(const char* fileName)=0;
 		virtual bool parseBuffer(const char* uri, const char* buffer, int length)=0;
 
+		/** Maps the file @a fileName into memory and passes the mapping directly to the xml 
+		parser, avoiding the copies made by parseFile(). If @a sectionFilter is not 0, the child elements
+		of the root element it rejects are not passed to the xml parser at all. They are found by a 
+		SectionIndex of the mapping.*/
+		virtual bool parseMemoryMappedFile(const char* fileName, ISectionFilter* sectionFilter = 0)=0;
+
+		/** Starts parsing a document, that is passed in chunks by pushData(). The document does not need 
+		to be in memory completely, so it can be parsed while it is read from a stream.*/
+		virtual bool beginPushParsing(const char* uri)=0;
+
+		/** Parses the next @a length bytes of the document started by beginPushParsing(). The chunks may
+		end anywhere, even inside a tag or a multibyte character.
+		@return False, if parsing has been stopped by an error or by the parser.*/
+		virtual bool pushData(const char* data, size_t length)=0;
+
+		/** Parses the rest of the document started by beginPushParsing() and frees the xml parser.
+		@return False, if parsing has been stopped or the document is incomplete.*/
+		virtual bool endPushParsing()=0;
+
+		/** Parses the gzip compressed file @a fileName. The file is memory mapped and inflated on a 
+		second thread, while the inflated data is parsed on the calling thread.*/
+		bool parseGzipFile(const char* fileName);
+
+		/** Parses the member @a memberName of @a archive. Deflated members are inflated on a second 
+		thread as by parseGzipFile().*/
+		bool parseZipArchiveMember(const ZipArchive& archive, const String& memberName);
+
+		/** Returns true, if the file @a fileName is gzip compressed.*/
+		static bool isGzipFile(const char* fileName);
+
 		virtual size_t getLineNumer()const=0;
 		virtual size_t getColumnNumer()const=0;
 
 		Parser* getParser(){return mParser;}
         void setParser( Parser* parser );
 
+	protected:
+		/** Reports that @a fileName could not be opened.*/
+		void reportCouldNotOpenFile( const char* fileName );
+
 	private:
         /** Disable default copy ctor. */
 		SaxParser( const SaxParser& pre );
@@ -0,0 +1,118 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_SECTIONINDEX_H__
+#define __GENERATEDSAXPARSER_SECTIONINDEX_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+#include "GeneratedSaxParserTypes.h"
+
+#include <vector>
+
+namespace GeneratedSaxParser
+{
+	class ISectionFilter;
+
+	/** Byte ranges of the child elements of the root element of a document in memory. The document is
+	not parsed, only the tags are found, which is about as fast as searching the document for '<'.
+	Documents with an internal DTD subset are not indexed, since their entities might contain tags.*/
+	class SectionIndex
+	{
+	public:
+		/** A child element of the root element.*/
+		struct Section
+		{
+			/** The qualified name of the element. Points into the indexed document and is not null terminated.*/
+			const ParserChar* name;
+			size_t nameLength;
+
+			/** Offset of the '<' of the start tag.*/
+			size_t begin;
+
+			/** Offset behind the '>' of the end tag.*/
+			size_t end;
+		};
+
+		typedef std::vector<Section> SectionList;
+
+	private:
+		SectionList mSections;
+
+	public:
+		SectionIndex(){}
+		~SectionIndex(){}
+
+		/** Finds the child elements of the root element in the @a size bytes starting at @a data.
+		@return False, if the document could not be indexed. The index is empty in this case.*/
+		bool build( const char* data, size_t size );
+
+		/** Returns the child elements of the root element in document order.*/
+		const SectionList& getSections() const { return mSections; }
+
+	private:
+		/** Disable default copy ctor. */
+		SectionIndex( const SectionIndex& pre );
+		/** Disable default assignment operator. */
+		const SectionIndex& operator= ( const SectionIndex& pre );
+	};
+
+
+	/** Reads a document in memory, leaving out the sections rejected by a section filter. Each section
+	left out is replaced by the line breaks it contained, so the xml parser still reports the line numbers
+	of the original document.*/
+	class SectionReader
+	{
+	private:
+		/** Begin and end offsets of a section left out.*/
+		typedef std::pair<size_t, size_t> Range;
+		typedef std::vector<Range> RangeList;
+
+	private:
+		const char* mData;
+		size_t mSize;
+
+		/** The offset of the next byte to read.*/
+		size_t mPosition;
+
+		/** The sections left out, in document order.*/
+		RangeList mSkippedRanges;
+
+		/** The index of the next section to leave out in mSkippedRanges.*/
+		size_t mNextSkippedRange;
+
+		/** The number of line breaks of the last section left out, that have not been read yet.*/
+		size_t mPendingLineBreaks;
+
+	public:
+		/** Reads the @a size bytes starting at @a data. If @a sectionFilter is not 0, the document is indexed
+		and the sections, for which the filter returns false, are left out. If the document could not be
+		indexed, it is read completely.*/
+		SectionReader( const char* data, size_t size, ISectionFilter* sectionFilter );
+		~SectionReader(){}
+
+		/** Returns the next at most @a maxLength bytes to pass to the xml parser in @a chunk. @a maxLength
+		must not be 0. The bytes point either into the document or to line breaks replacing a section.
+		@return The number of bytes in @a chunk, 0 at the end of the document.*/
+		size_t readChunk( const char*& chunk, size_t maxLength );
+
+		/** Copies the next at most @a length bytes to pass to the xml parser to @a buffer.
+		@return The number of bytes copied, 0 at the end of the document.*/
+		size_t read( char* buffer, size_t length );
+
+	private:
+		/** Disable default copy ctor. */
+		SectionReader( const SectionReader& pre );
+		/** Disable default assignment operator. */
+		const SectionReader& operator= ( const SectionReader& pre );
+	};
+
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_SECTIONINDEX_H__
@@ -13,6 +13,7 @@
 
 #include "GeneratedSaxParserPrerequisites.h"
 
+#include <vector>
 
 
 namespace GeneratedSaxParser
@@ -23,11 +24,14 @@ namespace GeneratedSaxParser
 		|              | |              | |              | |
 		 -------------- - -------------- - -------------- - 
 		     data0    size0   data1    size1   data2    size2
+
+		The stack is stored in a list of frames, that grows without limit. A new frame is at least
+		twice as large as the previous one and large enough for the object it is created for. An 
+		object that is the only one in its frame is grown by reallocating the frame.
 	*/
 	class StackMemoryManager 
 	{
 	private:
-        static const size_t MAX_NUM_OF_FRAMES = 12;
         static const size_t SIZE_OF_NEW_FRAME_FACTOR = 2;
 
         struct StackFrame
@@ -49,8 +53,22 @@ namespace GeneratedSaxParser
             /** Pointer to allocated memory. */
 		    char* mMemoryBlob;
         };
+        typedef std::vector<StackFrame> StackFrameList;
+
+        /** Index of the frame that contains the top object. */
         size_t mActiveFrame;
-        StackFrame* mFrames;
+
+        /** 
+         * The frames. The frame after mActiveFrame, if any, is empty and kept to avoid freeing and 
+         * allocating a frame each time an object crosses the frame boundary.
+         */
+        StackFrameList mFrames;
+
+        /** Number of growObject() calls that had to copy the top object. */
+        size_t mGrowCopyCount;
+
+        /** Number of bytes copied by growObject(). */
+        size_t mGrowCopiedBytes;
 
 	public:
 		StackMemoryManager(size_t stackSize);
@@ -61,17 +79,37 @@ namespace GeneratedSaxParser
 
 		void deleteObject();
 
+        /** Grows the top object by @a amount bytes. The content is preserved, but the object might
+        be moved. Returns the new address of the top object or 0 if the memory could not be allocated. */
         void* growObject(size_t amount);
 
         /** Returns ptr to top object on stack or 0 when stack is empty. Object will not be removed. */
         void* top();
 
+        /** Returns the number of growObject() calls that had to copy the top object to a new 
+        frame or a reallocated one. */
+        size_t getGrowCopyCount() const { return mGrowCopyCount; }
+
+        /** Returns the number of bytes growObject() copied. Objects moved by reallocating their 
+        frame are counted as copied, even if the system could move them without copying. */
+        size_t getGrowCopiedBytes() const { return mGrowCopiedBytes; }
+
+        /** Resets the counters returned by getGrowCopyCount() and getGrowCopiedBytes(). */
+        void resetGrowStatistics() { mGrowCopyCount = 0; mGrowCopiedBytes = 0; }
+
+        /** Returns the number of frames currently allocated. */
+        size_t getFrameCount() const { return mFrames.size(); }
+
     protected:
         inline size_t getTopObjectSize();
 
         inline void writeNewObjectSize(size_t position, size_t size);
 
-        bool allocateMoreMemory();
+        /** Makes a frame with at least @a minimumSize bytes the active one. */
+        bool allocateMoreMemory(size_t minimumSize);
+
+        /** Frees the frames after the active one. */
+        void releaseUnusedFrames();
 
     private:
 		/** Disable default copy ctor. */
@@ -14,6 +14,7 @@
 
 #include "GeneratedSaxParserPrerequisites.h"
 
+#include <utility>
 
 namespace GeneratedSaxParser
 {
@@ -22,6 +23,9 @@ namespace GeneratedSaxParser
 
 	typedef unsigned long StringHash;
 
+	/** Hash of the namespace prefix and hash of the local name of an element or attribute name.*/
+	typedef std::pair<StringHash, StringHash> StringHashPair;
+
 
     /**
      * Special string for unions. They cannot have c-tors.
@@ -19,11 +19,14 @@
 #include <utility>
 #include <map>
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__) || (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+    /** Defined on little endian targets, where little endian binary data can be used without byte swapping.*/
+#   define GENERATEDSAXPARSER_LITTLE_ENDIAN
+#endif
+
 namespace GeneratedSaxParser
 {
 
-    typedef std::pair<StringHash, StringHash> StringHashPair;
-
     class Utils
 	{
 	public:
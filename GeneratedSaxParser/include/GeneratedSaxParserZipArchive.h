@@ -0,0 +1,113 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_ZIPARCHIVE_H__
+#define __GENERATEDSAXPARSER_ZIPARCHIVE_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+
+#include <vector>
+
+namespace GeneratedSaxParser
+{
+	/** Read only access to the members of a zip archive, e.g. a COLLADA .zae archive. The archive is
+	memory mapped, the members are not extracted. Members can be stored or deflated, zip64 archives
+	are supported.*/
+	class ZipArchive
+	{
+	public:
+		/** The compression methods of the members that can be read.*/
+		enum CompressionMethod
+		{
+			METHOD_STORED = 0,
+			METHOD_DEFLATED = 8
+		};
+
+		/** A member of the archive, as listed in its central directory.*/
+		struct Entry
+		{
+			/** The name of the member, with '/' as separator.*/
+			String name;
+			/** The compression method, see CompressionMethod.*/
+			unsigned short compressionMethod;
+			size_t compressedSize;
+			size_t uncompressedSize;
+			/** Offset of the local header of the member.*/
+			size_t localHeaderOffset;
+		};
+
+		typedef std::vector<Entry> EntryList;
+
+		/** The name of the member of a .zae archive that names the root document.*/
+		static const char* ZAE_MANIFEST_NAME;
+
+	private:
+		MemoryMappedFile mFile;
+
+		/** The name of the opened archive file.*/
+		String mFileName;
+
+		EntryList mEntries;
+
+	public:
+		ZipArchive(){}
+		~ZipArchive(){}
+
+		/** Opens the archive @a fileName and reads its central directory.
+		@return False, if the file could not be opened or is no zip archive.*/
+		bool open( const char* fileName );
+
+		/** Opens the archive containing the COLLADA document @a path refers to. This is either a .zae
+		archive, whose root document is named by its manifest, or a member of a .zae archive, as in
+		"dir/scene.zae/models/tree.dae".
+		@param memberName Receives the name of the document in the archive.
+		@return False, if @a path does not refer to a document in a zip archive.*/
+		bool openDocument( const String& path, String& memberName );
+
+		/** Closes the archive.*/
+		void close();
+
+		/** Returns the name of the opened archive file.*/
+		const String& getFileName() const { return mFileName; }
+
+		/** Returns all members of the archive.*/
+		const EntryList& getEntries() const { return mEntries; }
+
+		/** Returns the member @a name or 0, if the archive has no such member. A leading "./" is ignored.*/
+		const Entry* findEntry( const String& name ) const;
+
+		/** Returns the data of @a entry as stored in the archive, i.e. compressed, if the member is
+		deflated. The size of the data is entry.compressedSize.
+		@return 0, if the local header of the member is corrupt.*/
+		const char* getEntryData( const Entry& entry ) const;
+
+		/** Reads and, if needed, inflates the complete member @a entry into @a content. Meant for small
+		members like the manifest.*/
+		bool readEntry( const Entry& entry, String& content ) const;
+
+		/** Returns the name of the root document of a .zae archive, as given by the dae_root element of
+		its manifest.
+		@return False, if the archive has no manifest or the manifest names no root document.*/
+		bool readZaeRootName( String& rootName ) const;
+
+	private:
+		/** Disable default copy ctor. */
+		ZipArchive( const ZipArchive& pre );
+		/** Disable default assignment operator. */
+		const ZipArchive& operator= ( const ZipArchive& pre );
+
+		/** Reads the central directory into mEntries.*/
+		bool readCentralDirectory();
+	};
+
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_ZIPARCHIVE_H__
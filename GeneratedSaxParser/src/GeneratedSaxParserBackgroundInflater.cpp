@@ -0,0 +1,204 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserBackgroundInflater.h"
+
+#include "zlib.h"
+
+#include <string.h>
+
+
+namespace GeneratedSaxParser
+{
+
+	//--------------------------------------------------------------------
+	BackgroundInflater::BackgroundInflater( const char* data, size_t size, Format format, size_t bufferSize, size_t bufferCount )
+		: mCompressedData( data )
+		, mCompressedSize( size )
+		, mFormat( format )
+		, mBufferSize( bufferSize )
+		, mReadBuffer( 0 )
+		, mFinished( false )
+		, mFailed( false )
+		, mStop( false )
+	{
+		// one buffer is read while the others are filled
+		if ( bufferCount < 2 )
+			bufferCount = 2;
+		for ( size_t i = 0; i < bufferCount; ++i )
+			mBuffers.push_back( new char[mBufferSize] );
+		mFreeBuffers = mBuffers;
+
+		mThread = std::thread( &BackgroundInflater::inflateData, this );
+	}
+
+	//--------------------------------------------------------------------
+	BackgroundInflater::~BackgroundInflater()
+	{
+		{
+			std::lock_guard<std::mutex> lock( mMutex );
+			mStop = true;
+		}
+		mBufferFreed.notify_one();
+		mThread.join();
+
+		for ( size_t i = 0; i < mBuffers.size(); ++i )
+			delete[] mBuffers[i];
+	}
+
+	//--------------------------------------------------------------------
+	size_t BackgroundInflater::readChunk( const char*& chunk )
+	{
+		std::unique_lock<std::mutex> lock( mMutex );
+		if ( mReadBuffer )
+		{
+			mFreeBuffers.push_back( mReadBuffer );
+			mReadBuffer = 0;
+			mBufferFreed.notify_one();
+		}
+
+		while ( mFilledBuffers.empty() && !mFinished )
+			mBufferFilled.wait( lock );
+
+		if ( mFilledBuffers.empty() )
+			return 0;
+
+		FilledBuffer filledBuffer = mFilledBuffers.front();
+		mFilledBuffers.pop_front();
+		mReadBuffer = filledBuffer.data;
+		chunk = filledBuffer.data;
+		return filledBuffer.length;
+	}
+
+	//--------------------------------------------------------------------
+	bool BackgroundInflater::hasFailed() const
+	{
+		std::lock_guard<std::mutex> lock( mMutex );
+		return mFailed;
+	}
+
+	//--------------------------------------------------------------------
+	bool BackgroundInflater::isGzipData( const char* data, size_t size )
+	{
+		return ( size >= 2 ) && ( (unsigned char)data[0] == 0x1f ) && ( (unsigned char)data[1] == 0x8b );
+	}
+
+	//--------------------------------------------------------------------
+	char* BackgroundInflater::takeFreeBuffer()
+	{
+		std::unique_lock<std::mutex> lock( mMutex );
+		while ( mFreeBuffers.empty() && !mStop )
+			mBufferFreed.wait( lock );
+
+		if ( mStop )
+			return 0;
+
+		char* buffer = mFreeBuffers.back();
+		mFreeBuffers.pop_back();
+		return buffer;
+	}
+
+	//--------------------------------------------------------------------
+	void BackgroundInflater::passBuffer( char* buffer, size_t length, bool finished, bool failed )
+	{
+		std::lock_guard<std::mutex> lock( mMutex );
+		if ( length > 0 )
+		{
+			FilledBuffer filledBuffer = { buffer, length };
+			mFilledBuffers.push_back( filledBuffer );
+		}
+		else if ( buffer )
+		{
+			mFreeBuffers.push_back( buffer );
+		}
+		mFinished = finished;
+		mFailed = failed;
+		mBufferFilled.notify_one();
+	}
+
+	//--------------------------------------------------------------------
+	void BackgroundInflater::inflateData()
+	{
+		// zlib takes the input length as unsigned int, larger data is passed in slices
+		const size_t MAX_SLICE_SIZE = 1 << 30;
+
+		z_stream stream;
+		memset( &stream, 0, sizeof(stream) );
+
+		// 16 makes zlib expect a gzip header and trailer, negative window bits raw deflate data
+		int windowBits = ( mFormat == FORMAT_GZIP ) ? 16 + MAX_WBITS : -MAX_WBITS;
+		if ( inflateInit2( &stream, windowBits ) != Z_OK )
+		{
+			passBuffer( 0, 0, true, true );
+			return;
+		}
+
+		const char* input = mCompressedData;
+		size_t inputLeft = mCompressedSize;
+		bool streamEnded = false;
+		bool failed = false;
+
+		while ( !streamEnded && !failed )
+		{
+			char* buffer = takeFreeBuffer();
+			if ( !buffer )
+				break;
+
+			stream.next_out = (Bytef*)buffer;
+			stream.avail_out = (uInt)mBufferSize;
+
+			while ( stream.avail_out > 0 )
+			{
+				if ( stream.avail_in == 0 )
+				{
+					if ( inputLeft == 0 )
+					{
+						// the data ends before the end of the compressed stream
+						failed = true;
+						break;
+					}
+					size_t sliceLength = ( inputLeft < MAX_SLICE_SIZE ) ? inputLeft : MAX_SLICE_SIZE;
+					stream.next_in = (Bytef*)input;
+					stream.avail_in = (uInt)sliceLength;
+					input += sliceLength;
+					inputLeft -= sliceLength;
+				}
+
+				int result = inflate( &stream, Z_NO_FLUSH );
+				if ( result == Z_STREAM_END )
+				{
+					// gzip files may consist of several members, trailing garbage is ignored as by gzip
+					const char* next = (const char*)stream.next_in;
+					size_t nextLength = stream.avail_in;
+					if ( mFormat == FORMAT_GZIP && nextLength == 0 && inputLeft > 0 )
+					{
+						next = input;
+						nextLength = inputLeft;
+					}
+					if ( mFormat == FORMAT_GZIP && isGzipData( next, nextLength ) && inflateReset( &stream ) == Z_OK )
+						continue;
+
+					streamEnded = true;
+					break;
+				}
+				if ( result != Z_OK && result != Z_BUF_ERROR )
+				{
+					failed = true;
+					break;
+				}
+			}
+
+			passBuffer( buffer, mBufferSize - stream.avail_out, streamEnded || failed, failed );
+		}
+
+		inflateEnd( &stream );
+	}
+
+} // namespace GeneratedSaxParser
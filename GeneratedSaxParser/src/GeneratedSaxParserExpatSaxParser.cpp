@@ -18,6 +18,8 @@
 #include <stdio.h>
 #include <iostream>
 #include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserSectionIndex.h"
 
 
 namespace GeneratedSaxParser
@@ -36,6 +38,9 @@ namespace GeneratedSaxParser
 	//--------------------------------------------------------------------
 	ExpatSaxParser::~ExpatSaxParser()
 	{
+		// a document passed by pushData(), that has not been ended
+		if ( mParser )
+			XML_ParserFree(mParser);
 	}
 
 	//--------------------------------------------------------------------
@@ -54,6 +59,7 @@ namespace GeneratedSaxParser
 		XML_Parse(mParser, buffer, (int)length, isFinal);
 
 		XML_ParserFree(mParser);
+		mParser = 0;
 
 		return status != XML_STATUS_ERROR;
 	}
@@ -86,6 +92,95 @@ namespace GeneratedSaxParser
 		fclose (fd);
 		free (buffer);
 		XML_ParserFree(mParser);
+		mParser = 0;
+
+		return status != XML_STATUS_ERROR;
+	}
+
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::parseMemoryMappedFile( const char* fileName, ISectionFilter* sectionFilter )
+	{
+		// expat takes the length as int, larger mappings are passed in slices
+		const size_t MAX_SLICE_SIZE = 1 << 30;
+
+		MemoryMappedFile mappedFile;
+		if ( !mappedFile.open(fileName) )
+			return false;
+
+		mParser = XML_ParserCreate(0);
+
+		XML_SetUserData(mParser, this);
+		XML_SetElementHandler(mParser, startElement, endElement);
+		XML_SetCharacterDataHandler(mParser, characters);
+
+		SectionReader reader( mappedFile.getData(), mappedFile.getSize(), sectionFilter );
+
+		// expat parses directly from the passed memory and only buffers incomplete tokens 
+		// at the end of a slice
+		XML_Status status = XML_STATUS_OK;
+		const char* data = 0;
+		size_t length = 0;
+		while ( (status != XML_STATUS_ERROR) && (length = reader.readChunk( data, MAX_SLICE_SIZE )) > 0 )
+		{
+			status = XML_Parse(mParser, data, (int)length, false);
+		}
+		if ( status != XML_STATUS_ERROR )
+		{
+			status = XML_Parse(mParser, 0, 0, true);
+		}
+
+		XML_ParserFree(mParser);
+		mParser = 0;
+
+		return status != XML_STATUS_ERROR;
+	}
+
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::beginPushParsing( const char* uri )
+	{
+		mParser = XML_ParserCreate(0);
+		if ( !mParser )
+			return false;
+
+		XML_SetUserData(mParser, this);
+		XML_SetElementHandler(mParser, startElement, endElement);
+		XML_SetCharacterDataHandler(mParser, characters);
+
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::pushData( const char* data, size_t length )
+	{
+		// expat takes the length as int, larger chunks are passed in slices
+		const size_t MAX_SLICE_SIZE = 1 << 30;
+
+		if ( !mParser )
+			return false;
+
+		XML_Status status = XML_STATUS_OK;
+		while ( (status != XML_STATUS_ERROR) && (length > 0) )
+		{
+			size_t sliceLength = (length < MAX_SLICE_SIZE) ? length : MAX_SLICE_SIZE;
+			status = XML_Parse(mParser, data, (int)sliceLength, false);
+			data += sliceLength;
+			length -= sliceLength;
+		}
+
+		// a stopped parser fails all following calls
+		return (status != XML_STATUS_ERROR) && (XML_GetErrorCode(mParser) == XML_ERROR_NONE);
+	}
+
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::endPushParsing()
+	{
+		if ( !mParser )
+			return false;
+
+		XML_Status status = XML_Parse(mParser, 0, 0, true);
+
+		XML_ParserFree(mParser);
+		mParser = 0;
 
 		return status != XML_STATUS_ERROR;
 	}
@@ -14,6 +14,10 @@
 #include "GeneratedSaxParserLibxmlSaxParser.h"
 #include "GeneratedSaxParserParser.h"
 #include "GeneratedSaxParserIErrorHandler.h"
+#include "GeneratedSaxParserBackgroundInflater.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserSectionIndex.h"
+#include "GeneratedSaxParserUtils.h"
 
 #include <libxml/parserInternals.h> // for xmlCreateFileParserCtxt
 
@@ -50,11 +54,48 @@ namespace GeneratedSaxParser
 
 	};
 
+    xmlSAXHandler LibxmlSaxParser::SAX2HANDLER =
+	{
+		0,                 		           //internalSubsetSAXFunc internalSubset;
+		0,                 		           //isStandaloneSAXFunc isStandalone;
+		0,                 		           //hasInternalSubsetSAXFunc hasInternalSubset;
+		0,                 		           //hasExternalSubsetSAXFunc hasExternalSubset;
+		0,                 		           //resolveEntitySAXFunc resolveEntity;
+		0,                 		           //getEntitySAXFunc getEntity;
+		0,                 		           //entityDeclSAXFunc entityDecl;
+		0,                 		           //notationDeclSAXFunc notationDecl;
+		0,                 		           //attributeDeclSAXFunc attributeDecl;
+		0,                 		           //elementDeclSAXFunc elementDecl;
+		0,                 		           //unparsedEntityDeclSAXFunc unparsedEntityDecl;
+		0,                 		           //setDocumentLocatorSAXFunc setDocumentLocator;
+		0,                 		           //startDocumentSAXFunc startDocument;
+		0,                      		   //endDocumentSAXFunc endDocument;
+		0,                                 //startElementSAXFunc startElement;
+		0,                                 //endElementSAXFunc endElement;
+		0,                 		           //referenceSAXFunc reference;
+		&LibxmlSaxParser::characters,	   //charactersSAXFunc characters;
+		0,                 		           //ignorableWhitespaceSAXFunc ignorableWhitespace;
+		0,                 		           //processingInstructionSAXFunc processingInstruction;
+		0,                 		           //commentSAXFunc comment;
+		0,                 		           //warningSAXFunc warning;
+		&LibxmlSaxParser::errorFunction,   //errorSAXFunc error;
+		&LibxmlSaxParser::errorFunction,   //fatalErrorSAXFunc fatalError;
+		0,                                 //getParameterEntitySAXFunc getParameterEntity;
+		0,                                 //cdataBlockSAXFunc cdataBlock;
+		0,                                 //externalSubsetSAXFunc externalSubset;
+		XML_SAX2_MAGIC,                    //unsigned int initialized;
+		0,                                 //void* _private;
+		&LibxmlSaxParser::startElementNs,  //startElementNsSAX2Func startElementNs;
+		&LibxmlSaxParser::endElementNs,    //endElementNsSAX2Func endElementNs;
+		0                                  //xmlStructuredErrorFunc serror;
+	};
+
 
 	//--------------------------------------------------------------------
-	LibxmlSaxParser::LibxmlSaxParser(Parser* parser)
+	LibxmlSaxParser::LibxmlSaxParser(Parser* parser, SaxInterface saxInterface)
 		: SaxParser(parser),
-		mParserContext(0)
+		mParserContext(0),
+		mSaxInterface(saxInterface)
 	{
 	}
 
@@ -65,6 +106,10 @@ namespace GeneratedSaxParser
 		//-> libxml documentation says xmlCleanupParser() should only be called before
 		//   process terminates and the libxml-library is not to be used anymore.
 		//xmlCleanupParser();
+
+		// a document passed by pushData(), that has not been ended
+		if ( mParserContext )
+			freeParserContext();
 	}
 
 	bool LibxmlSaxParser::parseFile( const char* fileName )
@@ -73,47 +118,11 @@ namespace GeneratedSaxParser
 			
 			if ( !mParserContext )
 			{
-				ParserError error(ParserError::SEVERITY_CRITICAL,
-									ParserError::ERROR_COULD_NOT_OPEN_FILE,
-									0,
-									0,
-									0,
-									0,
-									fileName);
-				IErrorHandler* errorHandler = getParser()->getErrorHandler();
-				if ( errorHandler )
-				{
-					errorHandler->handleError(error);
-				}
+				reportCouldNotOpenFile(fileName);
 				return false;
 			}
 
-			// We let libxml replace the entities
-			mParserContext->replaceEntities = 1;
-
-			if (mParserContext->sax != (xmlSAXHandlerPtr) &xmlDefaultSAXHandler)
-			{
-				xmlFree(mParserContext->sax);
-			}
-
-			mParserContext->sax = &SAXHANDLER;
-			mParserContext->userData = (void*)this;
-
-			initializeParserContext();
-			xmlParseDocument(mParserContext);
-
-			mParserContext->sax = 0;
-
-			if ( mParserContext->myDoc )
-			{
-				xmlFreeDoc(mParserContext->myDoc);
-				mParserContext->myDoc = 0;
-			}
-
-			xmlFreeParserCtxt(mParserContext);
-			mParserContext = 0;
-
-			return true;
+			return parseDocument();
 	}
 
 	bool LibxmlSaxParser::parseBuffer( const char* uri, const char* buffer, int length )
@@ -122,49 +131,148 @@ namespace GeneratedSaxParser
         
         if ( !mParserContext )
         {
-            ParserError error(ParserError::SEVERITY_CRITICAL,
-                              ParserError::ERROR_COULD_NOT_OPEN_FILE,
-                              0,
-                              0,
-                              0,
-                              0,
-                              uri);
-            IErrorHandler* errorHandler = getParser()->getErrorHandler();
-            if ( errorHandler )
-            {
-                errorHandler->handleError(error);
-            }
+            reportCouldNotOpenFile(uri);
             return false;
         }
         
-        // We let libxml replace the entities
-        mParserContext->replaceEntities = 1;
+        return parseDocument();
+	}
 
-        if (mParserContext->sax != (xmlSAXHandlerPtr) &xmlDefaultSAXHandler)
-        {
-            xmlFree(mParserContext->sax);
-        }
-        
-        mParserContext->sax = &SAXHANDLER;
-        mParserContext->userData = (void*)this;
-        
-        initializeParserContext();
-        xmlParseDocument(mParserContext);
-        
-        mParserContext->sax = 0;
-        
-        if ( mParserContext->myDoc )
-        {
-            xmlFreeDoc(mParserContext->myDoc);
-            mParserContext->myDoc = 0;
-        }
-        
-        xmlFreeParserCtxt(mParserContext);
-        mParserContext = 0;
-        
-        return true;
+	/** Position of the read callback inside a memory mapped file.*/
+	bool LibxmlSaxParser::parseMemoryMappedFile( const char* fileName, ISectionFilter* sectionFilter )
+	{
+		MemoryMappedFile mappedFile;
+		if ( !mappedFile.open(fileName) )
+		{
+			reportCouldNotOpenFile(fileName);
+			return false;
+		}
+
+		// gzip files are inflated on a second thread
+		if ( BackgroundInflater::isGzipData( mappedFile.getData(), mappedFile.getSize() ) )
+		{
+			mappedFile.close();
+			return parseGzipFile( fileName );
+		}
+
+		SectionReader reader( mappedFile.getData(), mappedFile.getSize(), sectionFilter );
+
+		// libxml pulls the document through a read callback that copies straight from the mapping into 
+		// its input window. Static memory inputs are not used, since they are restricted to int sizes 
+		// and are not handled reliably by the SAX1 interface of all libxml versions.
+		mParserContext = xmlCreateIOParserCtxt( 0, 0, &LibxmlSaxParser::readMemoryMappedFile, 0, &reader, XML_CHAR_ENCODING_NONE );
+
+		if ( !mParserContext )
+		{
+			reportCouldNotOpenFile(fileName);
+			return false;
+		}
+
+		return parseDocument();
+	}
+
+	int LibxmlSaxParser::readMemoryMappedFile( void* context, char* buffer, int length )
+	{
+		SectionReader* reader = (SectionReader*)context;
+		return (int)reader->read( buffer, (size_t)length );
+	}
+
+	bool LibxmlSaxParser::beginPushParsing( const char* uri )
+	{
+		// the encoding is detected from the first bytes pushed
+		mParserContext = xmlCreatePushParserCtxt( 0, 0, 0, 0, uri );
+
+		if ( !mParserContext )
+		{
+			reportCouldNotOpenFile(uri);
+			return false;
+		}
+
+		attachSaxHandler();
+
+		return true;
+	}
+
+	bool LibxmlSaxParser::pushData( const char* data, size_t length )
+	{
+		// libxml takes the length as int, larger chunks are pushed in slices
+		const size_t MAX_SLICE_SIZE = 1 << 30;
+
+		if ( !mParserContext )
+			return false;
+
+		while ( length > 0 && !mParserContext->disableSAX )
+		{
+			size_t sliceLength = (length < MAX_SLICE_SIZE) ? length : MAX_SLICE_SIZE;
+			xmlParseChunk( mParserContext, data, (int)sliceLength, 0 );
+			data += sliceLength;
+			length -= sliceLength;
+		}
+
+		// fatal errors and abortParsing() disable the sax events, other errors are only reported
+		return !mParserContext->disableSAX;
+	}
+
+	bool LibxmlSaxParser::endPushParsing()
+	{
+		if ( !mParserContext )
+			return false;
+
+		xmlParseChunk( mParserContext, 0, 0, 1 );
+		bool success = !mParserContext->disableSAX;
+
+		freeParserContext();
+
+		return success;
+	}
+
+	void LibxmlSaxParser::attachSaxHandler()
+	{
+		// We let libxml replace the entities
+		mParserContext->replaceEntities = 1;
+
+		if (mParserContext->sax != (xmlSAXHandlerPtr) &xmlDefaultSAXHandler)
+		{
+			xmlFree(mParserContext->sax);
+		}
+
+		mParserContext->sax = (mSaxInterface == SAX2) ? &SAX2HANDLER : &SAXHANDLER;
+		mParserContext->userData = (void*)this;
+
+		initializeParserContext();
+	}
+
+	bool LibxmlSaxParser::parseDocument()
+	{
+		attachSaxHandler();
+		xmlParseDocument(mParserContext);
+
+		// fatal errors and abortParsing() disable the sax events
+		bool success = !mParserContext->disableSAX;
+
+		freeParserContext();
+
+		return success;
 	}
 
+	void LibxmlSaxParser::freeParserContext()
+	{
+		mParserContext->sax = 0;
+
+		// the interned names are freed with the context
+		mQualifiedNames.clear();
+
+		if ( mParserContext->myDoc )
+		{
+			xmlFreeDoc(mParserContext->myDoc);
+			mParserContext->myDoc = 0;
+		}
+
+		xmlFreeParserCtxt(mParserContext);
+		mParserContext = 0;
+	}
+
+
 	void LibxmlSaxParser::initializeParserContext()
 	{
 		mParserContext->linenumbers = true;
@@ -197,6 +305,96 @@ namespace GeneratedSaxParser
 			thisObject->abortParsing();
 	}
 
+	void LibxmlSaxParser::startElementNs( void* user_data, const ::xmlChar* localname, const ::xmlChar* prefix, const ::xmlChar* URI,
+		int nb_namespaces, const ::xmlChar** namespaces, int nb_attributes, int nb_defaulted, const ::xmlChar** attributes )
+	{
+		LibxmlSaxParser* thisObject = (LibxmlSaxParser*)user_data;
+		Parser* parser = thisObject->getParser();
+		const QualifiedName& elementName = thisObject->getQualifiedName( prefix, localname );
+		const ParserChar** attributeArray = thisObject->createAttributeArray( nb_namespaces, namespaces, nb_attributes, attributes );
+		if ( !parser->elementBeginWithHash(elementName.name, elementName.hashPair, attributeArray) )
+			thisObject->abortParsing();
+	}
+
+	void LibxmlSaxParser::endElementNs( void* user_data, const ::xmlChar* localname, const ::xmlChar* prefix, const ::xmlChar* URI )
+	{
+		LibxmlSaxParser* thisObject = (LibxmlSaxParser*)user_data;
+		Parser* parser = thisObject->getParser();
+		const QualifiedName& elementName = thisObject->getQualifiedName( prefix, localname );
+		if ( !parser->elementEnd(elementName.name) )
+			thisObject->abortParsing();
+	}
+
+	const LibxmlSaxParser::QualifiedName& LibxmlSaxParser::getQualifiedName( const ::xmlChar* prefix, const ::xmlChar* localname )
+	{
+		InternedName internedName( prefix, localname );
+		QualifiedNameMap::iterator it = mQualifiedNames.find( internedName );
+		if ( it != mQualifiedNames.end() )
+			return it->second;
+
+		QualifiedName& qualifiedName = mQualifiedNames[ internedName ];
+		if ( prefix )
+		{
+			qualifiedName.qualifiedNameBuffer = (const char*)prefix;
+			qualifiedName.qualifiedNameBuffer += ':';
+			qualifiedName.qualifiedNameBuffer += (const char*)localname;
+			qualifiedName.name = qualifiedName.qualifiedNameBuffer.c_str();
+		}
+		else
+		{
+			qualifiedName.name = (const ParserChar*)localname;
+		}
+		qualifiedName.hashPair = Utils::calculateStringHashWithNamespace( qualifiedName.name );
+		return qualifiedName;
+	}
+
+	/** Name of the attributes that declare a namespace.*/
+	static const ::xmlChar XMLNS[] = "xmlns";
+
+	const ParserChar** LibxmlSaxParser::createAttributeArray( int namespaceCount, const ::xmlChar** namespaces, int attributeCount, const ::xmlChar** attributes )
+	{
+		if ( namespaceCount == 0 && attributeCount == 0 )
+			return 0;
+
+		// attribute values are not null terminated, they are copied one after the other into
+		// mAttributeValues first, since the buffer must not grow while pointers into it are taken
+		size_t valuesSize = 0;
+		for ( int i = 0; i < attributeCount; ++i )
+		{
+			const ::xmlChar** attribute = attributes + i * 5;
+			valuesSize += (size_t)(attribute[4] - attribute[3]) + 1;
+		}
+		mAttributeValues.resize( valuesSize );
+		mAttributeArray.resize( (size_t)(namespaceCount + attributeCount) * 2 + 1 );
+
+		size_t arrayIndex = 0;
+		for ( int i = 0; i < namespaceCount; ++i )
+		{
+			// namespaces contains pairs of prefix and uri, the prefix is 0 for the default namespace
+			const ::xmlChar* namespacePrefix = namespaces[ i * 2 ];
+			const QualifiedName& attributeName = namespacePrefix ? getQualifiedName( XMLNS, namespacePrefix ) : getQualifiedName( 0, XMLNS );
+			mAttributeArray[ arrayIndex++ ] = attributeName.name;
+			mAttributeArray[ arrayIndex++ ] = (const ParserChar*)namespaces[ i * 2 + 1 ];
+		}
+
+		ParserChar* value = valuesSize ? &mAttributeValues[0] : 0;
+		for ( int i = 0; i < attributeCount; ++i )
+		{
+			// each attribute consists of localname, prefix, uri, value and end of value
+			const ::xmlChar** attribute = attributes + i * 5;
+			size_t valueLength = (size_t)(attribute[4] - attribute[3]);
+			memcpy( value, attribute[3], valueLength );
+			value[ valueLength ] = 0;
+
+			mAttributeArray[ arrayIndex++ ] = getQualifiedName( attribute[1], attribute[0] ).name;
+			mAttributeArray[ arrayIndex++ ] = value;
+			value += valueLength + 1;
+		}
+		mAttributeArray[ arrayIndex ] = 0;
+
+		return &mAttributeArray[0];
+	}
+
 	void LibxmlSaxParser::abortParsing()
 	{
 		xmlStopParser(mParserContext);
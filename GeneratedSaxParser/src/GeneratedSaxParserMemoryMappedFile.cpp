@@ -0,0 +1,152 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserMemoryMappedFile.h"
+
+#if defined(COLLADABU_OS_WIN)
+#	include <windows.h>
+#else
+#	include <sys/types.h>
+#	include <sys/stat.h>
+#	include <sys/mman.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+
+namespace GeneratedSaxParser
+{
+
+	//--------------------------------------------------------------------
+	MemoryMappedFile::MemoryMappedFile()
+		: mData(0)
+		, mSize(0)
+#if defined(COLLADABU_OS_WIN)
+		, mFileHandle(INVALID_HANDLE_VALUE)
+		, mMappingHandle(0)
+#else
+		, mFileDescriptor(-1)
+#endif
+	{
+	}
+
+	//--------------------------------------------------------------------
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		close();
+	}
+
+#if defined(COLLADABU_OS_WIN)
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::open( const char* fileName )
+	{
+		close();
+
+		mFileHandle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+		if ( mFileHandle == INVALID_HANDLE_VALUE )
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if ( !GetFileSizeEx(mFileHandle, &fileSize) )
+		{
+			close();
+			return false;
+		}
+
+		mSize = (size_t)fileSize.QuadPart;
+		if ( mSize == 0 )
+			return true;
+
+		mMappingHandle = CreateFileMappingA(mFileHandle, 0, PAGE_READONLY, 0, 0, 0);
+		if ( !mMappingHandle )
+		{
+			close();
+			return false;
+		}
+
+		mData = (const char*)MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if ( !mData )
+		{
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	void MemoryMappedFile::close()
+	{
+		if ( mData )
+			UnmapViewOfFile(mData);
+		if ( mMappingHandle )
+			CloseHandle(mMappingHandle);
+		if ( mFileHandle != INVALID_HANDLE_VALUE )
+			CloseHandle(mFileHandle);
+
+		mData = 0;
+		mSize = 0;
+		mMappingHandle = 0;
+		mFileHandle = INVALID_HANDLE_VALUE;
+	}
+
+#else
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::open( const char* fileName )
+	{
+		close();
+
+		mFileDescriptor = ::open(fileName, O_RDONLY);
+		if ( mFileDescriptor < 0 )
+			return false;
+
+		struct stat fileStat;
+		if ( fstat(mFileDescriptor, &fileStat) != 0 )
+		{
+			close();
+			return false;
+		}
+
+		mSize = (size_t)fileStat.st_size;
+		if ( mSize == 0 )
+			return true;
+
+		void* data = mmap(0, mSize, PROT_READ, MAP_PRIVATE, mFileDescriptor, 0);
+		if ( data == MAP_FAILED )
+		{
+			close();
+			return false;
+		}
+		mData = (const char*)data;
+
+#if defined(POSIX_MADV_SEQUENTIAL)
+		// the xml parsers read the document front to back
+		posix_madvise(data, mSize, POSIX_MADV_SEQUENTIAL);
+#endif
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	void MemoryMappedFile::close()
+	{
+		if ( mData )
+			munmap((void*)mData, mSize);
+		if ( mFileDescriptor >= 0 )
+			::close(mFileDescriptor);
+
+		mData = 0;
+		mSize = 0;
+		mFileDescriptor = -1;
+	}
+
+#endif
+
+} // namespace GeneratedSaxParser
@@ -10,9 +10,32 @@
 
 #include "GeneratedSaxParserSaxParser.h"
 #include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserParserError.h"
+#include "GeneratedSaxParserIErrorHandler.h"
+#include "GeneratedSaxParserBackgroundInflater.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserZipArchive.h"
+
+#include <stdio.h>
 
 namespace GeneratedSaxParser
 {
+	//--------------------------------------------------------------------
+	/** Passes the data inflated from the @a size bytes at @a data to the push parser interface of 
+	@a saxParser, that has already been started.*/
+	static bool pushInflatedData( SaxParser& saxParser, const char* data, size_t size, BackgroundInflater::Format format )
+	{
+		BackgroundInflater inflater( data, size, format );
+
+		bool success = true;
+		const char* chunk = 0;
+		size_t chunkLength = 0;
+		while ( success && (chunkLength = inflater.readChunk( chunk )) > 0 )
+			success = saxParser.pushData( chunk, chunkLength );
+
+		// the inflater stops, if the parser did not read all data
+		return success && !inflater.hasFailed();
+	}
 
 	SaxParser::SaxParser( Parser* parser )
 		: mParser(parser)
@@ -36,4 +59,71 @@ namespace GeneratedSaxParser
         }
     }
 
+	//--------------------------------------------------------------------
+	bool SaxParser::parseGzipFile( const char* fileName )
+	{
+		MemoryMappedFile mappedFile;
+		if ( !mappedFile.open( fileName ) )
+		{
+			reportCouldNotOpenFile( fileName );
+			return false;
+		}
+		if ( !beginPushParsing( fileName ) )
+			return false;
+
+		bool success = pushInflatedData( *this, mappedFile.getData(), mappedFile.getSize(), BackgroundInflater::FORMAT_GZIP );
+		return endPushParsing() && success;
+	}
+
+	//--------------------------------------------------------------------
+	bool SaxParser::parseZipArchiveMember( const ZipArchive& archive, const String& memberName )
+	{
+		String uri = archive.getFileName() + "/" + memberName;
+		const ZipArchive::Entry* entry = archive.findEntry( memberName );
+		const char* data = entry ? archive.getEntryData( *entry ) : 0;
+		bool supportedMethod = entry && ( entry->compressionMethod == ZipArchive::METHOD_STORED || entry->compressionMethod == ZipArchive::METHOD_DEFLATED );
+		if ( !data || !supportedMethod )
+		{
+			reportCouldNotOpenFile( uri.c_str() );
+			return false;
+		}
+		if ( !beginPushParsing( uri.c_str() ) )
+			return false;
+
+		// stored members are passed directly from the mapping
+		bool success = ( entry->compressionMethod == ZipArchive::METHOD_STORED ) ?
+			pushData( data, entry->compressedSize ) :
+			pushInflatedData( *this, data, entry->compressedSize, BackgroundInflater::FORMAT_DEFLATE );
+		return endPushParsing() && success;
+	}
+
+	//--------------------------------------------------------------------
+	bool SaxParser::isGzipFile( const char* fileName )
+	{
+		FILE* file = fopen( fileName, "rb" );
+		if ( !file )
+			return false;
+		char magic[2];
+		size_t length = fread( magic, 1, sizeof(magic), file );
+		fclose( file );
+		return BackgroundInflater::isGzipData( magic, length );
+	}
+
+	//--------------------------------------------------------------------
+	void SaxParser::reportCouldNotOpenFile( const char* fileName )
+	{
+		ParserError error(ParserError::SEVERITY_CRITICAL,
+							ParserError::ERROR_COULD_NOT_OPEN_FILE,
+							0,
+							0,
+							0,
+							0,
+							fileName);
+		IErrorHandler* errorHandler = getParser()->getErrorHandler();
+		if ( errorHandler )
+		{
+			errorHandler->handleError(error);
+		}
+	}
+
 } // namespace COLLADAPARSER
@@ -0,0 +1,254 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserSectionIndex.h"
+#include "GeneratedSaxParserISectionFilter.h"
+
+#include <algorithm>
+#include <string>
+#include <string.h>
+
+
+namespace GeneratedSaxParser
+{
+
+	//--------------------------------------------------------------------
+	/** Returns true, if the bytes from @a pos to @a end start with the @a length characters of @a str.*/
+	static bool startsWith( const char* pos, const char* end, const char* str, size_t length )
+	{
+		return ( (size_t)(end - pos) >= length ) && ( memcmp( pos, str, length ) == 0 );
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns the first occurrence of the @a length characters of @a str between @a pos and @a end
+	or 0 if there is none.*/
+	static const char* findString( const char* pos, const char* end, const char* str, size_t length )
+	{
+		while ( (size_t)(end - pos) >= length )
+		{
+			pos = (const char*)memchr( pos, str[0], (end - pos) - length + 1 );
+			if ( !pos )
+				return 0;
+			if ( memcmp( pos, str, length ) == 0 )
+				return pos;
+			++pos;
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns the number of line breaks between @a pos and @a end.*/
+	static size_t countLineBreaks( const char* pos, const char* end )
+	{
+		// memchr is considerably faster than comparing each byte
+		size_t lineBreakCount = 0;
+		while ( (pos = (const char*)memchr( pos, '\n', end - pos )) != 0 )
+		{
+			lineBreakCount++;
+			pos++;
+		}
+		return lineBreakCount;
+	}
+
+	//--------------------------------------------------------------------
+	bool SectionIndex::build( const char* data, size_t size )
+	{
+		mSections.clear();
+
+		const char* end = data + size;
+		const char* pos = data;
+
+		// utf-16 documents are not indexed
+		if ( startsWith( pos, end, "\xff\xfe", 2 ) || startsWith( pos, end, "\xfe\xff", 2 ) )
+			return false;
+
+		// the number of open elements, the sections are opened at depth 1
+		size_t depth = 0;
+		bool rootFound = false;
+		bool rootClosed = false;
+
+		while ( !rootClosed )
+		{
+			pos = (const char*)memchr( pos, '<', end - pos );
+			if ( !pos || (end - pos) < 2 )
+				break;
+
+			char next = pos[1];
+			if ( next == '?' )
+			{
+				const char* piEnd = findString( pos + 2, end, "?>", 2 );
+				if ( !piEnd )
+					break;
+				pos = piEnd + 2;
+			}
+			else if ( next == '!' )
+			{
+				if ( startsWith( pos, end, "<!--", 4 ) )
+				{
+					const char* commentEnd = findString( pos + 4, end, "-->", 3 );
+					if ( !commentEnd )
+						break;
+					pos = commentEnd + 3;
+				}
+				else if ( startsWith( pos, end, "<![CDATA[", 9 ) )
+				{
+					const char* cdataEnd = findString( pos + 9, end, "]]>", 3 );
+					if ( !cdataEnd )
+						break;
+					pos = cdataEnd + 3;
+				}
+				else
+				{
+					// a doctype declaration. Its internal subset might declare entities containing tags.
+					const char* declarationEnd = pos + 2;
+					while ( declarationEnd < end && *declarationEnd != '>' && *declarationEnd != '[' )
+						++declarationEnd;
+					if ( declarationEnd == end || *declarationEnd == '[' )
+						break;
+					pos = declarationEnd + 1;
+				}
+			}
+			else if ( next == '/' )
+			{
+				const char* tagEnd = (const char*)memchr( pos, '>', end - pos );
+				if ( !tagEnd || depth == 0 )
+					break;
+				depth--;
+				if ( depth == 1 )
+					mSections.back().end = (tagEnd + 1) - data;
+				else if ( depth == 0 )
+					rootClosed = true;
+				pos = tagEnd + 1;
+			}
+			else
+			{
+				const char* nameBegin = pos + 1;
+				const char* nameEnd = nameBegin;
+				while ( nameEnd < end && *nameEnd != '>' && *nameEnd != '/' && *nameEnd != ' '
+					&& *nameEnd != '\t' && *nameEnd != '\n' && *nameEnd != '\r' )
+					++nameEnd;
+
+				// '>' is allowed in attribute values
+				const char* tagEnd = nameEnd;
+				while ( tagEnd < end && *tagEnd != '>' )
+				{
+					if ( *tagEnd == '"' || *tagEnd == '\'' )
+					{
+						tagEnd = (const char*)memchr( tagEnd + 1, *tagEnd, end - tagEnd - 1 );
+						if ( !tagEnd )
+							break;
+					}
+					++tagEnd;
+				}
+				if ( !tagEnd || tagEnd >= end || (depth == 0 && rootFound) )
+					break;
+
+				bool isEmptyElement = ( tagEnd[-1] == '/' );
+				if ( depth == 0 )
+				{
+					rootFound = true;
+					rootClosed = isEmptyElement;
+				}
+				else if ( depth == 1 )
+				{
+					Section section = { nameBegin, (size_t)(nameEnd - nameBegin), (size_t)(pos - data), 0 };
+					if ( isEmptyElement )
+						section.end = (tagEnd + 1) - data;
+					mSections.push_back( section );
+				}
+				if ( !isEmptyElement )
+					depth++;
+				pos = tagEnd + 1;
+			}
+		}
+
+		if ( !rootClosed )
+		{
+			// the document is not well formed or uses constructs not handled. The xml parser gets all of it.
+			mSections.clear();
+			return false;
+		}
+		return true;
+	}
+
+
+	//--------------------------------------------------------------------
+	SectionReader::SectionReader( const char* data, size_t size, ISectionFilter* sectionFilter )
+		: mData( data )
+		, mSize( size )
+		, mPosition( 0 )
+		, mNextSkippedRange( 0 )
+		, mPendingLineBreaks( 0 )
+	{
+		if ( !sectionFilter )
+			return;
+
+		SectionIndex sectionIndex;
+		if ( !sectionIndex.build( data, size ) )
+			return;
+
+		const SectionIndex::SectionList& sections = sectionIndex.getSections();
+		for ( size_t i = 0; i < sections.size(); ++i )
+		{
+			const SectionIndex::Section& section = sections[i];
+			if ( !sectionFilter->isSectionRequired( section.name, section.nameLength ) )
+				mSkippedRanges.push_back( Range( section.begin, section.end ) );
+		}
+	}
+
+	//--------------------------------------------------------------------
+	size_t SectionReader::readChunk( const char*& chunk, size_t maxLength )
+	{
+		static const std::string LINE_BREAKS( 4096, '\n' );
+
+		for ( ;; )
+		{
+			if ( mPendingLineBreaks > 0 )
+			{
+				size_t length = std::min( std::min( mPendingLineBreaks, LINE_BREAKS.size() ), maxLength );
+				chunk = LINE_BREAKS.data();
+				mPendingLineBreaks -= length;
+				return length;
+			}
+
+			if ( mNextSkippedRange < mSkippedRanges.size() && mPosition == mSkippedRanges[mNextSkippedRange].first )
+			{
+				const Range& skippedRange = mSkippedRanges[mNextSkippedRange];
+				mPendingLineBreaks = countLineBreaks( mData + skippedRange.first, mData + skippedRange.second );
+				mPosition = skippedRange.second;
+				mNextSkippedRange++;
+				continue;
+			}
+
+			size_t limit = ( mNextSkippedRange < mSkippedRanges.size() ) ? mSkippedRanges[mNextSkippedRange].first : mSize;
+			size_t length = std::min( limit - mPosition, maxLength );
+			chunk = mData + mPosition;
+			mPosition += length;
+			return length;
+		}
+	}
+
+	//--------------------------------------------------------------------
+	size_t SectionReader::read( char* buffer, size_t length )
+	{
+		size_t bytesCopied = 0;
+		while ( bytesCopied < length )
+		{
+			const char* chunk = 0;
+			size_t chunkLength = readChunk( chunk, length - bytesCopied );
+			if ( chunkLength == 0 )
+				break;
+			memcpy( buffer + bytesCopied, chunk, chunkLength );
+			bytesCopied += chunkLength;
+		}
+		return bytesCopied;
+	}
+
+} // namespace GeneratedSaxParser
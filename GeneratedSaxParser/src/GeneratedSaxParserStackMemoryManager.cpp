@@ -9,6 +9,7 @@
 */
 
 #include <cstring>
+#include <cstdlib>
 #include "GeneratedSaxParserStackMemoryManager.h"
 
 namespace GeneratedSaxParser
@@ -16,43 +17,39 @@ namespace GeneratedSaxParser
 	//--------------------------------------------------------------------
 	StackMemoryManager::StackMemoryManager(size_t stackSize)
 		: mActiveFrame(0)
+		, mGrowCopyCount(0)
+		, mGrowCopiedBytes(0)
     {
-        mFrames = new StackFrame[ MAX_NUM_OF_FRAMES ];
-		mFrames[ mActiveFrame ] = StackFrame(stackSize, new char[stackSize]);
+		mFrames.push_back( StackFrame(stackSize, (char*)malloc(stackSize)) );
 	}
 	
 	//--------------------------------------------------------------------
 	StackMemoryManager::~StackMemoryManager()
 	{
-        for (size_t i=mActiveFrame+1; i>0; --i)
-			delete[] mFrames[ i-1 ].mMemoryBlob;
-        delete[] mFrames;
+        for (size_t i=0; i<mFrames.size(); ++i)
+			free( mFrames[ i ].mMemoryBlob );
 	}
 
 	//--------------------------------------------------------------------
 	void* StackMemoryManager::newObject( size_t objectSize )
 	{
-		size_t newDataPos = mFrames[ mActiveFrame ].mCurrentPosition;
-
-		size_t newDataSizePos = mFrames[ mActiveFrame ].mCurrentPosition + objectSize;
-
-        size_t newCurrentPos = newDataSizePos + sizeof(objectSize);
-		while ( newCurrentPos > mFrames[ mActiveFrame ].mMaxMemoryBlob )
+        size_t requiredSize = objectSize + sizeof(objectSize);
+		if ( mFrames[ mActiveFrame ].mCurrentPosition + requiredSize > mFrames[ mActiveFrame ].mMaxMemoryBlob )
 		{
-            if (!allocateMoreMemory())
+            if (!allocateMoreMemory(requiredSize))
                 return 0;
-
-            newDataPos = mFrames[ mActiveFrame ].mCurrentPosition;
-            newDataSizePos = mFrames[ mActiveFrame ].mCurrentPosition + objectSize;
-            newCurrentPos = newDataSizePos + sizeof(objectSize);
 		}
 
+		StackFrame& frame = mFrames[ mActiveFrame ];
+		size_t newDataPos = frame.mCurrentPosition;
+		size_t newDataSizePos = newDataPos + objectSize;
+
         // objectSize will be written at newDataSizePos
-        mFrames[ mActiveFrame ].mCurrentPosition = newCurrentPos;
+        frame.mCurrentPosition = newDataSizePos + sizeof(objectSize);
 
         writeNewObjectSize(newDataSizePos, objectSize);
 
-        return mFrames[ mActiveFrame ].mMemoryBlob + newDataPos;
+        return frame.mMemoryBlob + newDataPos;
 	}
 
     //--------------------------------------------------------------------
@@ -61,8 +58,9 @@ namespace GeneratedSaxParser
         mFrames[ mActiveFrame ].mCurrentPosition -= ( getTopObjectSize() + sizeof(mFrames[ mActiveFrame ].mCurrentPosition) );
         while ( mFrames[ mActiveFrame ].mCurrentPosition == 0 && mActiveFrame != 0 )
         {
-            delete[] mFrames[ mActiveFrame ].mMemoryBlob;
-            mFrames[ mActiveFrame-- ].mMemoryBlob = 0;
+            // the emptied frame is kept for the next object that does not fit into the previous one
+            releaseUnusedFrames();
+            --mActiveFrame;
         }
 	}
 
@@ -83,28 +81,45 @@ namespace GeneratedSaxParser
     {
         size_t currentSize = getTopObjectSize();
         size_t newSize = currentSize + amount;
-        size_t oldCurrentPos = mFrames[ mActiveFrame ].mCurrentPosition;
-        size_t newDataSizePos = (mFrames[ mActiveFrame ].mCurrentPosition + amount) - sizeof(newSize);
-        size_t newCurrentPos = newDataSizePos + sizeof(newSize);
-        if ( newCurrentPos > mFrames[ mActiveFrame ].mMaxMemoryBlob )
+        size_t objectPos = mFrames[ mActiveFrame ].mCurrentPosition - currentSize - sizeof(currentSize);
+        size_t requiredSize = newSize + sizeof(newSize);
+        if ( objectPos + requiredSize > mFrames[ mActiveFrame ].mMaxMemoryBlob )
         {
-            size_t numOfAllocs = 0;
-            while ( newCurrentPos > mFrames[ mActiveFrame ].mMaxMemoryBlob )
+            // reserve twice the required size, to grow the object in place the next times
+            size_t newFrameSize = requiredSize * SIZE_OF_NEW_FRAME_FACTOR;
+            if ( objectPos == 0 )
+            {
+                // the object is the only one in its frame, which can be reallocated
+                StackFrame& frame = mFrames[ mActiveFrame ];
+                if ( newFrameSize < frame.mMaxMemoryBlob * SIZE_OF_NEW_FRAME_FACTOR )
+                    newFrameSize = frame.mMaxMemoryBlob * SIZE_OF_NEW_FRAME_FACTOR;
+                char* newMem = (char*)realloc(frame.mMemoryBlob, newFrameSize);
+                if ( !newMem )
+                    return 0;
+                if ( newMem != frame.mMemoryBlob )
+                {
+                    mGrowCopyCount++;
+                    mGrowCopiedBytes += currentSize;
+                }
+                frame.mMemoryBlob = newMem;
+                frame.mMaxMemoryBlob = newFrameSize;
+            }
+            else
             {
-                if (!allocateMoreMemory())
+                size_t oldFrame = mActiveFrame;
+                if (!allocateMoreMemory(newFrameSize))
                     return 0;
-                newDataSizePos = mFrames[ mActiveFrame ].mCurrentPosition + newSize;
-                newCurrentPos = newDataSizePos + sizeof(newSize);
-                numOfAllocs++;
+                memcpy(mFrames[ mActiveFrame ].mMemoryBlob, mFrames[ oldFrame ].mMemoryBlob + objectPos, currentSize);
+                mGrowCopyCount++;
+                mGrowCopiedBytes += currentSize;
+                // delete last object in last frame
+                mFrames[ oldFrame ].mCurrentPosition = objectPos;
+                objectPos = 0;
             }
-            void* source = mFrames[ mActiveFrame-numOfAllocs ].mMemoryBlob + oldCurrentPos - currentSize - sizeof(currentSize);
-            memcpy(mFrames[ mActiveFrame ].mMemoryBlob, source, currentSize);
-            // delete last object in last frame
-            mFrames[ mActiveFrame-numOfAllocs ].mCurrentPosition -= ( currentSize + sizeof(mFrames[ mActiveFrame-numOfAllocs ].mCurrentPosition) );
         }
-        mFrames[ mActiveFrame ].mCurrentPosition = newCurrentPos;
-        writeNewObjectSize(newDataSizePos, newSize);
-        return top();
+        mFrames[ mActiveFrame ].mCurrentPosition = objectPos + requiredSize;
+        writeNewObjectSize(objectPos + newSize, newSize);
+        return mFrames[ mActiveFrame ].mMemoryBlob + objectPos;
     }
 
     //-----------------------------------------------------------------
@@ -116,16 +131,37 @@ namespace GeneratedSaxParser
     }
 
     //-----------------------------------------------------------------
-    bool StackMemoryManager::allocateMoreMemory()
+    bool StackMemoryManager::allocateMoreMemory( size_t minimumSize )
     {
-        if ( mActiveFrame == MAX_NUM_OF_FRAMES-1 )
-            return false;
+        if ( mActiveFrame + 1 < mFrames.size() )
+        {
+            if ( mFrames[ mActiveFrame + 1 ].mMaxMemoryBlob >= minimumSize )
+            {
+                ++mActiveFrame;
+                return true;
+            }
+            releaseUnusedFrames();
+        }
+
         size_t sizeOfNewBlob = mFrames[ mActiveFrame ].mMaxMemoryBlob * SIZE_OF_NEW_FRAME_FACTOR;
-        char* newMem = new char[sizeOfNewBlob];
+        if ( sizeOfNewBlob < minimumSize )
+            sizeOfNewBlob = minimumSize;
+        char* newMem = (char*)malloc(sizeOfNewBlob);
         if (!newMem)
             return false;
-        mFrames[ ++mActiveFrame ] = StackFrame(sizeOfNewBlob, newMem);
+        mFrames.push_back( StackFrame(sizeOfNewBlob, newMem) );
+        ++mActiveFrame;
         return true;
     }
 
+    //-----------------------------------------------------------------
+    void StackMemoryManager::releaseUnusedFrames()
+    {
+        while ( mFrames.size() > mActiveFrame + 1 )
+        {
+            free( mFrames.back().mMemoryBlob );
+            mFrames.pop_back();
+        }
+    }
+
 } // namespace GeneratedSaxParser
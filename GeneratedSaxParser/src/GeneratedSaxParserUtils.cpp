@@ -9,6 +9,7 @@
 */
 
 #include "GeneratedSaxParserUtils.h"
+#include "GeneratedSaxParserFloatingPointConverter.h"
 #include <math.h>
 #include <memory>
 #include <string.h>
@@ -225,12 +226,12 @@ namespace GeneratedSaxParser
             }
         }
 
-        double value = 0.0;
-		FloatingPointType sign = 1.0;
+        DecimalNumber number;
+		const ParserChar* numberBegin = s;
 		if (*s == '-')
 		{
 			++s;
-			sign = -1.0;
+			number.negative = true;
 		}
 		else if (*s == '+')
 		{
@@ -244,7 +245,7 @@ namespace GeneratedSaxParser
             {
                 *buffer = s + 3;
                 failed = false;
-                return sign * std::numeric_limits<FloatingPointType>::infinity();
+                return number.negative ? -std::numeric_limits<FloatingPointType>::infinity() : std::numeric_limits<FloatingPointType>::infinity();
             }
             else
             {
@@ -263,7 +264,7 @@ namespace GeneratedSaxParser
 				{
 					failed = false;
 					*buffer = s;
-					return sign * (FloatingPointType)value;
+					return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s);
 				}
 				else
 				{
@@ -275,7 +276,7 @@ namespace GeneratedSaxParser
 
 			if ( isdigit(*s) )
 			{
-				value = value * 10 + (*s - '0');
+				number.addIntegerDigit(*s);
 				charBeforeDecimalPoint = true;
 			}
 			else
@@ -286,7 +287,6 @@ namespace GeneratedSaxParser
 		if ( (*s=='.') )
 			++s;
 
-		int power = 0;
 		bool charAfterDecimalPoint = false;
 		while ( true )
 		{
@@ -296,7 +296,7 @@ namespace GeneratedSaxParser
 				{
 					failed = false;
 					*buffer = s;
-					return (FloatingPointType)value * pow((FloatingPointType)10, (FloatingPointType)power) * sign;
+					return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s);
 				}
 				else
 				{
@@ -308,8 +308,7 @@ namespace GeneratedSaxParser
 
 			if ( isdigit(*s) )
 			{
-				value = value * 10 + (*s - '0');
-				--power;
+				number.addFractionalDigit(*s);
 				charAfterDecimalPoint = true;
 			}
 			else
@@ -335,12 +334,12 @@ namespace GeneratedSaxParser
 				*buffer = s;
 				return 0.0f;
 			}
-			power += exponent;
+			number.exponent += exponent;
 		}
 
 		failed = false;
 		*buffer = s;
-		return (FloatingPointType)value * pow((FloatingPointType)10, (FloatingPointType)power) * sign;
+		return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s);
 	}
 
 
@@ -388,12 +387,12 @@ namespace GeneratedSaxParser
             }
         }
 
-        double value = 0.0;
-		FloatingPointType sign = 1.0;
+        DecimalNumber number;
+		const ParserChar* numberBegin = s;
 		if (*s == '-')
 		{
 			++s;
-			sign = -1.0;
+			number.negative = true;
 		}
 		else if (*s == '+')
 		{
@@ -406,7 +405,7 @@ namespace GeneratedSaxParser
             if ( s[3] == '\0' || isWhiteSpace(s[3]) )
             {
                 failed = false;
-                return sign * std::numeric_limits<FloatingPointType>::infinity();
+                return number.negative ? -std::numeric_limits<FloatingPointType>::infinity() : std::numeric_limits<FloatingPointType>::infinity();
             }
             else
             {
@@ -421,12 +420,12 @@ namespace GeneratedSaxParser
 			if ( *s == '\0' )
 			{
 				failed = false;
-				return (FloatingPointType)value * sign;
+				return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s);
 			}
 
 			if ( isdigit(*s) )
 			{
-				value = value * 10 + (*s - '0');
+				number.addIntegerDigit(*s);
 				charBeforeDecimalPoint = true;
 			}
 			else
@@ -437,7 +436,6 @@ namespace GeneratedSaxParser
 		if ( (*s=='.') )
 			++s;
 
-		int power = 0;
 		bool charAfterDecimalPoint = false;
 		while ( true )
 		{
@@ -451,14 +449,13 @@ namespace GeneratedSaxParser
 				else
 				{
 					failed = false;
-					return (FloatingPointType)value * pow((FloatingPointType)10, (FloatingPointType)power) * sign;
+					return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s);
 				}
 			}
 
 			if ( isdigit(*s) )
 			{
-				value = value * 10 + (*s - '0');
-				--power;
+				number.addFractionalDigit(*s);
 				charAfterDecimalPoint = true;
 			}
 			else
@@ -482,11 +479,11 @@ namespace GeneratedSaxParser
 				failed = true;
 				return 0.0f;
 			}
-			power += exponent;
+			number.exponent += exponent;
 		}
 
 		failed = false;
-		return (FloatingPointType)value * pow((FloatingPointType)10, (FloatingPointType)power) * sign;
+		return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s + strlen(s));
 	}
 
 
@@ -537,12 +534,12 @@ namespace GeneratedSaxParser
             }
         }
 
-        double value = 0.0;
-        FloatingPointType sign = 1.0;
+        DecimalNumber number;
+        const ParserChar* numberBegin = s;
         if (*s == '-')
         {
             ++s;
-            sign = -1.0;
+            number.negative = true;
         }
         else if (*s == '+')
         {
@@ -556,7 +553,7 @@ namespace GeneratedSaxParser
             {
                 *buffer = s + 3;
                 failed = false;
-                return sign * std::numeric_limits<FloatingPointType>::infinity();
+                return number.negative ? -std::numeric_limits<FloatingPointType>::infinity() : std::numeric_limits<FloatingPointType>::infinity();
             }
             else
             {
@@ -575,7 +572,7 @@ namespace GeneratedSaxParser
                 {
                     failed = false;
                     *buffer = s;
-                    return sign * (FloatingPointType)value;
+                    return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s);
                 }
                 else
                 {
@@ -587,7 +584,7 @@ namespace GeneratedSaxParser
 
             if ( isdigit(*s) )
             {
-                value = value * 10 + (*s - '0');
+                number.addIntegerDigit(*s);
                 charBeforeDecimalPoint = true;
             }
             else
@@ -598,7 +595,6 @@ namespace GeneratedSaxParser
         if ( (*s=='.') )
             ++s;
 
-        int power = 0;
         bool charAfterDecimalPoint = false;
         while ( true )
         {
@@ -608,7 +604,7 @@ namespace GeneratedSaxParser
                 {
                     failed = false;
                     *buffer = s;
-                    return (FloatingPointType)value * pow((FloatingPointType)10, (FloatingPointType)power) * sign;
+                    return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s);
                 }
                 else
                 {
@@ -620,8 +616,7 @@ namespace GeneratedSaxParser
 
             if ( isdigit(*s) )
             {
-                value = value * 10 + (*s - '0');
-                --power;
+                number.addFractionalDigit(*s);
                 charAfterDecimalPoint = true;
             }
             else
@@ -647,12 +642,12 @@ namespace GeneratedSaxParser
                 *buffer = s;
                 return 0.0f;
             }
-            power += exponent;
+            number.exponent += exponent;
         }
 
         failed = false;
         *buffer = s;
-        return (FloatingPointType)value * pow((FloatingPointType)10, (FloatingPointType)power) * sign;
+        return FloatingPointConverter::toFloatingPoint<FloatingPointType>(number, numberBegin, s);
     }
 
 
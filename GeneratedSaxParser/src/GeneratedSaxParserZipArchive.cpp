@@ -0,0 +1,353 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserZipArchive.h"
+
+#include "zlib.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+namespace GeneratedSaxParser
+{
+	const char* ZipArchive::ZAE_MANIFEST_NAME = "manifest.xml";
+
+	/** Signatures of the zip records.*/
+	static const unsigned long SIGNATURE_LOCAL_HEADER = 0x04034b50;
+	static const unsigned long SIGNATURE_CENTRAL_HEADER = 0x02014b50;
+	static const unsigned long SIGNATURE_END_OF_CENTRAL_DIRECTORY = 0x06054b50;
+	static const unsigned long SIGNATURE_ZIP64_END_OF_CENTRAL_DIRECTORY = 0x06064b50;
+	static const unsigned long SIGNATURE_ZIP64_LOCATOR = 0x07064b50;
+
+	/** Sizes of the fixed parts of the zip records.*/
+	static const size_t LOCAL_HEADER_SIZE = 30;
+	static const size_t CENTRAL_HEADER_SIZE = 46;
+	static const size_t END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+	static const size_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE = 56;
+	static const size_t ZIP64_LOCATOR_SIZE = 20;
+
+	/** The id of the extra field holding the 64 bit sizes and offsets.*/
+	static const unsigned short ZIP64_EXTRA_FIELD_ID = 0x0001;
+
+	/** The largest factor by which deflate can expand data.*/
+	static const size_t MAX_DEFLATE_RATIO = 1032;
+
+	//--------------------------------------------------------------------
+	/** Reads the little endian value of @a byteCount bytes at @a data.*/
+	static unsigned long long readLittleEndian( const char* data, size_t byteCount )
+	{
+		unsigned long long value = 0;
+		for ( size_t i = byteCount; i > 0; --i )
+			value = (value << 8) | (unsigned char)data[i - 1];
+		return value;
+	}
+
+	static unsigned short read16( const char* data ) { return (unsigned short)readLittleEndian( data, 2 ); }
+	static unsigned long read32( const char* data ) { return (unsigned long)readLittleEndian( data, 4 ); }
+	static unsigned long long read64( const char* data ) { return readLittleEndian( data, 8 ); }
+
+	//--------------------------------------------------------------------
+	/** Replaces the %xx escapes of an uri path by the characters they encode.*/
+	static String decodePercentEscapes( const String& path )
+	{
+		String decoded;
+		for ( size_t i = 0; i < path.size(); ++i )
+		{
+			if ( path[i] == '%' && i + 2 < path.size() && isxdigit( (unsigned char)path[i + 1] ) && isxdigit( (unsigned char)path[i + 2] ) )
+			{
+				decoded += (char)strtol( path.substr( i + 1, 2 ).c_str(), 0, 16 );
+				i += 2;
+			}
+			else
+			{
+				decoded += path[i];
+			}
+		}
+		return decoded;
+	}
+
+	//--------------------------------------------------------------------
+	bool ZipArchive::open( const char* fileName )
+	{
+		close();
+
+		if ( !mFile.open( fileName ) )
+			return false;
+
+		// every archive with at least one member starts with a local header
+		if ( mFile.getSize() < LOCAL_HEADER_SIZE || read32( mFile.getData() ) != SIGNATURE_LOCAL_HEADER || !readCentralDirectory() )
+		{
+			close();
+			return false;
+		}
+
+		mFileName = fileName;
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool ZipArchive::openDocument( const String& path, String& memberName )
+	{
+		if ( open( path.c_str() ) )
+		{
+			String rootName;
+			const Entry* entry = readZaeRootName( rootName ) ? findEntry( rootName ) : 0;
+			if ( !entry )
+				entry = findEntry( decodePercentEscapes( rootName ) );
+			if ( !entry )
+			{
+				close();
+				return false;
+			}
+			memberName = entry->name;
+			return true;
+		}
+
+		// the archive is the part of the path up to a ".zae" followed by a separator
+		for ( size_t pos = 0; pos + 5 < path.size(); ++pos )
+		{
+			if ( (path[pos + 4] != '/' && path[pos + 4] != '\\') || path[pos] != '.'
+				|| tolower( path[pos + 1] ) != 'z' || tolower( path[pos + 2] ) != 'a' || tolower( path[pos + 3] ) != 'e' )
+				continue;
+
+			if ( !open( path.substr( 0, pos + 4 ).c_str() ) )
+				continue;
+
+			String name = path.substr( pos + 5 );
+			for ( size_t i = 0; i < name.size(); ++i )
+			{
+				if ( name[i] == '\\' )
+					name[i] = '/';
+			}
+			const Entry* entry = findEntry( name );
+			if ( !entry )
+			{
+				close();
+				return false;
+			}
+			memberName = entry->name;
+			return true;
+		}
+		return false;
+	}
+
+	//--------------------------------------------------------------------
+	void ZipArchive::close()
+	{
+		mFile.close();
+		mFileName.clear();
+		mEntries.clear();
+	}
+
+	//--------------------------------------------------------------------
+	const ZipArchive::Entry* ZipArchive::findEntry( const String& name ) const
+	{
+		size_t start = 0;
+		while ( name.compare( start, 2, "./" ) == 0 )
+			start += 2;
+
+		for ( size_t i = 0; i < mEntries.size(); ++i )
+		{
+			if ( mEntries[i].name.compare( 0, String::npos, name, start, String::npos ) == 0 )
+				return &mEntries[i];
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	const char* ZipArchive::getEntryData( const Entry& entry ) const
+	{
+		const char* data = mFile.getData();
+		size_t size = mFile.getSize();
+
+		size_t headerOffset = entry.localHeaderOffset;
+		if ( headerOffset > size || size - headerOffset < LOCAL_HEADER_SIZE || read32( data + headerOffset ) != SIGNATURE_LOCAL_HEADER )
+			return 0;
+
+		// the extra field of the local header may differ from the one in the central directory
+		size_t dataOffset = headerOffset + LOCAL_HEADER_SIZE + read16( data + headerOffset + 26 ) + read16( data + headerOffset + 28 );
+		if ( dataOffset > size || size - dataOffset < entry.compressedSize )
+			return 0;
+
+		return data + dataOffset;
+	}
+
+	//--------------------------------------------------------------------
+	bool ZipArchive::readEntry( const Entry& entry, String& content ) const
+	{
+		const char* data = getEntryData( entry );
+		if ( !data )
+			return false;
+
+		if ( entry.compressionMethod == METHOD_STORED )
+		{
+			content.assign( data, entry.compressedSize );
+			return true;
+		}
+
+		if ( entry.compressionMethod != METHOD_DEFLATED || entry.compressedSize > (uInt)-1 || entry.uncompressedSize > (uInt)-1 )
+			return false;
+
+		// the size in the header is not trusted: deflate cannot expand data by more than 1032:1, so a
+		// larger size comes from a corrupt or malicious archive and must not be allocated
+		if ( entry.uncompressedSize / MAX_DEFLATE_RATIO > entry.compressedSize )
+			return false;
+
+		content.resize( entry.uncompressedSize );
+		if ( content.empty() )
+			return true;
+
+		z_stream stream;
+		memset( &stream, 0, sizeof(stream) );
+		if ( inflateInit2( &stream, -MAX_WBITS ) != Z_OK )
+			return false;
+
+		stream.next_in = (Bytef*)data;
+		stream.avail_in = (uInt)entry.compressedSize;
+		stream.next_out = (Bytef*)&content[0];
+		stream.avail_out = (uInt)content.size();
+		int result = inflate( &stream, Z_FINISH );
+		inflateEnd( &stream );
+
+		return ( result == Z_STREAM_END ) && ( stream.avail_out == 0 );
+	}
+
+	//--------------------------------------------------------------------
+	bool ZipArchive::readZaeRootName( String& rootName ) const
+	{
+		const Entry* manifestEntry = findEntry( ZAE_MANIFEST_NAME );
+		String manifest;
+		if ( !manifestEntry || !readEntry( *manifestEntry, manifest ) )
+			return false;
+
+		size_t elementBegin = manifest.find( "<dae_root" );
+		if ( elementBegin == String::npos )
+			return false;
+		size_t textBegin = manifest.find( '>', elementBegin );
+		if ( textBegin == String::npos )
+			return false;
+		textBegin++;
+		size_t textEnd = manifest.find( "</dae_root", textBegin );
+		if ( textEnd == String::npos )
+			return false;
+
+		const char* whiteSpaces = " \t\r\n";
+		textBegin = manifest.find_first_not_of( whiteSpaces, textBegin );
+		if ( textBegin == String::npos || textBegin >= textEnd )
+			return false;
+		textEnd = manifest.find_last_not_of( whiteSpaces, textEnd - 1 ) + 1;
+
+		rootName = manifest.substr( textBegin, textEnd - textBegin );
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool ZipArchive::readCentralDirectory()
+	{
+		const char* data = mFile.getData();
+		size_t size = mFile.getSize();
+		if ( size < END_OF_CENTRAL_DIRECTORY_SIZE )
+			return false;
+
+		// the end of central directory record is followed by a comment of at most 64k
+		size_t endOffset = size - END_OF_CENTRAL_DIRECTORY_SIZE;
+		size_t searchEnd = ( endOffset > 0xffff ) ? endOffset - 0xffff : 0;
+		while ( read32( data + endOffset ) != SIGNATURE_END_OF_CENTRAL_DIRECTORY )
+		{
+			if ( endOffset == searchEnd )
+				return false;
+			endOffset--;
+		}
+
+		unsigned long long entryCount = read16( data + endOffset + 10 );
+		unsigned long long directoryOffset = read32( data + endOffset + 16 );
+
+		if ( entryCount == 0xffff || directoryOffset == 0xffffffff )
+		{
+			// the zip64 locator precedes the end of central directory record
+			if ( endOffset < ZIP64_LOCATOR_SIZE || read32( data + endOffset - ZIP64_LOCATOR_SIZE ) != SIGNATURE_ZIP64_LOCATOR )
+				return false;
+			unsigned long long zip64EndOffset = read64( data + endOffset - ZIP64_LOCATOR_SIZE + 8 );
+			if ( zip64EndOffset > size || size - zip64EndOffset < ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE
+				|| read32( data + zip64EndOffset ) != SIGNATURE_ZIP64_END_OF_CENTRAL_DIRECTORY )
+				return false;
+			entryCount = read64( data + zip64EndOffset + 32 );
+			directoryOffset = read64( data + zip64EndOffset + 48 );
+		}
+
+		size_t offset = (size_t)directoryOffset;
+		if ( directoryOffset > size )
+			return false;
+
+		for ( unsigned long long i = 0; i < entryCount; ++i )
+		{
+			if ( size - offset < CENTRAL_HEADER_SIZE || read32( data + offset ) != SIGNATURE_CENTRAL_HEADER )
+				return false;
+
+			const char* header = data + offset;
+			size_t nameLength = read16( header + 28 );
+			size_t extraLength = read16( header + 30 );
+			size_t commentLength = read16( header + 32 );
+			size_t recordSize = CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength;
+			if ( size - offset < recordSize )
+				return false;
+
+			unsigned long long compressedSize = read32( header + 20 );
+			unsigned long long uncompressedSize = read32( header + 24 );
+			unsigned long long localHeaderOffset = read32( header + 42 );
+
+			// values that do not fit into 32 bits are stored in the zip64 extra field, in this order
+			const char* extra = header + CENTRAL_HEADER_SIZE + nameLength;
+			const char* extraEnd = extra + extraLength;
+			while ( extraEnd - extra >= 4 )
+			{
+				unsigned short fieldId = read16( extra );
+				size_t fieldLength = read16( extra + 2 );
+				const char* field = extra + 4;
+				if ( (size_t)(extraEnd - field) < fieldLength )
+					break;
+				if ( fieldId == ZIP64_EXTRA_FIELD_ID )
+				{
+					const char* fieldEnd = field + fieldLength;
+					if ( uncompressedSize == 0xffffffff && fieldEnd - field >= 8 )
+					{
+						uncompressedSize = read64( field );
+						field += 8;
+					}
+					if ( compressedSize == 0xffffffff && fieldEnd - field >= 8 )
+					{
+						compressedSize = read64( field );
+						field += 8;
+					}
+					if ( localHeaderOffset == 0xffffffff && fieldEnd - field >= 8 )
+					{
+						localHeaderOffset = read64( field );
+					}
+					break;
+				}
+				extra = field + fieldLength;
+			}
+
+			Entry entry;
+			entry.name.assign( header + CENTRAL_HEADER_SIZE, nameLength );
+			entry.compressionMethod = read16( header + 10 );
+			entry.compressedSize = (size_t)compressedSize;
+			entry.uncompressedSize = (size_t)uncompressedSize;
+			entry.localHeaderOffset = (size_t)localHeaderOffset;
+			mEntries.push_back( entry );
+
+			offset += recordSize;
+		}
+		return true;
+	}
+
+} // namespace GeneratedSaxParser
@@ -0,0 +1,18 @@
+
+OPTIONS="-O3 -Wall"
+
+INCLUDES="-I../../include -I../../include/performanceTest -I../../../COLLADABaseUtils/include -I../../../Externals/pcre/include -I../../../Externals/UTF/include -I/usr/include/libxml2"
+
+PARSERFILES="main.cpp performanceTest.cpp ../GeneratedSaxParserUtils.cpp ../GeneratedSaxParserFloatingPointConverter.cpp ../GeneratedSaxParserStackMemoryManager.cpp ../GeneratedSaxParserParser.cpp ../GeneratedSaxParserSaxParser.cpp ../GeneratedSaxParserParserError.cpp ../GeneratedSaxParserMemoryMappedFile.cpp ../GeneratedSaxParserSectionIndex.cpp ../GeneratedSaxParserBackgroundInflater.cpp ../GeneratedSaxParserZipArchive.cpp ../GeneratedSaxParserLibxmlSaxParser.cpp ../GeneratedSaxParserExpatSaxParser.cpp "
+
+BASEUTILSFILES="../../../COLLADABaseUtils/src/COLLADABUURI.cpp ../../../COLLADABaseUtils/src/COLLADABUStringUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUPcreCompiledPattern.cpp ../../../COLLADABaseUtils/src/COLLADABUHashFunctions.cpp ../../../COLLADABaseUtils/src/COLLADABUNativeString.cpp ../../../Externals/UTF/src/ConvertUTF.c"
+
+FILES=$PARSERFILES$BASEUTILSFILES
+
+LIBS="-lpcre -lxml2 -lexpat -lz -pthread"
+
+OUTPUTFILE="-o performanceTest"
+
+
+
+g++ $OPTIONS $INCLUDES $FILES $LIBS $OUTPUTFILE
@@ -0,0 +1,236 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include "GeneratedSaxParserUtils.h"
+#include "GeneratedSaxParserStackMemoryManager.h"
+#include "GeneratedSaxParserParserTemplateBase.h"
+#include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserLibxmlSaxParser.h"
+#include "GeneratedSaxParserExpatSaxParser.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+using namespace GeneratedSaxParser;
+
+/** Number of list items in each test buffer.*/
+static const size_t VALUE_COUNT = 10000000;
+
+/** Number of nodes in the document parsed by the xml parsers.*/
+static const size_t NODE_COUNT = 200000;
+
+
+//--------------------------------------------------------------------
+static double elapsedSeconds( clock_t startTime )
+{
+	return (double)(clock() - startTime) / CLOCKS_PER_SEC;
+}
+
+//--------------------------------------------------------------------
+/** Converts all items of @a text with @a toData, one item per call, like the generated parsers do, 
+and prints the time needed.*/
+template<class DataType, DataType (*toData)( const ParserChar**, const ParserChar*, bool& )>
+static void convertList( const char* title, const std::string& text )
+{
+	std::vector<DataType> values( VALUE_COUNT );
+	const ParserChar* buffer = text.c_str();
+	const ParserChar* bufferEnd = buffer + text.size();
+	size_t count = 0;
+
+	clock_t startTime = clock();
+	bool failed = false;
+	while ( count < VALUE_COUNT )
+	{
+		DataType value = toData( &buffer, bufferEnd, failed );
+		if ( failed )
+			break;
+		values[count++] = value;
+	}
+	double time = elapsedSeconds( startTime );
+
+	std::cout << title << ": " << time << "s, " << count << " values" << std::endl;
+}
+
+
+//--------------------------------------------------------------------
+/** Accumulates @a textSize bytes of text on the stack the way the generated text data functions do,
+in slices of ParserTemplateBase::TEXT_DATA_SLICE_SIZE, on top of @a objectsBelow small objects.*/
+static void accumulateText( size_t textSize, size_t objectsBelow )
+{
+	const size_t sliceSize = ParserTemplateBase::TEXT_DATA_SLICE_SIZE;
+	std::vector<ParserChar> slice( sliceSize, '1' );
+
+	StackMemoryManager stack( ParserTemplateBase::STACK_SIZE );
+	for ( size_t i = 0; i < objectsBelow; ++i )
+		stack.newObject( 100 );
+
+	clock_t startTime = clock();
+	ParserChar* text = (ParserChar*)stack.newObject( sliceSize );
+	memcpy( text, &slice[0], sliceSize );
+	size_t size = sliceSize;
+	while ( size < textSize && text )
+	{
+		text = (ParserChar*)stack.growObject( sliceSize );
+		if ( text )
+			memcpy( text + size, &slice[0], sliceSize );
+		size += sliceSize;
+	}
+	double time = elapsedSeconds( startTime );
+
+	std::cout << "accumulate " << (textSize >> 20) << "MB text above " << objectsBelow << " objects: " << time << "s, "
+		<< stack.getGrowCopyCount() << " copies, " << (stack.getGrowCopiedBytes() >> 20) << "MB copied, "
+		<< stack.getFrameCount() << " frames";
+	if ( !text )
+		std::cout << " (OUT OF MEMORY)";
+	std::cout << std::endl;
+}
+
+
+//--------------------------------------------------------------------
+/** Parser that hashes the element names, like the generated parsers do, and counts the elements and
+attributes.*/
+class HashingParser : public Parser
+{
+public:
+	size_t elementCount;
+	size_t attributeCount;
+	StringHash hashSum;
+
+	HashingParser() : Parser(0), elementCount(0), attributeCount(0), hashSum(0) {}
+
+	virtual bool elementBegin( const ParserChar* elementName, const ParserAttributes& attributes )
+	{
+		return elementBeginWithHash( elementName, Utils::calculateStringHashWithNamespace(elementName), attributes );
+	}
+
+	virtual bool elementBeginWithHash( const ParserChar* elementName, const StringHashPair& elementHashPair, const ParserAttributes& attributes )
+	{
+		elementCount++;
+		hashSum += elementHashPair.first + elementHashPair.second;
+		if ( attributes.attributes )
+		{
+			for ( const ParserChar** attribute = attributes.attributes; *attribute; attribute += 2 )
+				attributeCount++;
+		}
+		return true;
+	}
+
+	virtual bool elementEnd( const ParserChar* elementName ) { return true; }
+
+	virtual bool textData( const ParserChar* text, size_t textLength ) { return true; }
+};
+
+//--------------------------------------------------------------------
+/** Parses @a document with @a saxParser and prints the time needed.*/
+static void parseDocument( const char* title, SaxParser& saxParser, HashingParser& parser, const std::string& document )
+{
+	clock_t startTime = clock();
+	bool success = saxParser.parseBuffer( "", document.c_str(), (int)document.size() );
+	double time = elapsedSeconds( startTime );
+
+	std::cout << title << ": " << time << "s, " << parser.elementCount << " elements, " << parser.attributeCount << " attributes, hash sum " << parser.hashSum;
+	if ( !success )
+		std::cout << " (PARSING FAILED)";
+	std::cout << std::endl;
+}
+
+//--------------------------------------------------------------------
+/** Parses a document with many small elements with libxml's SAX1 and SAX2 interface and with expat.*/
+static void compareXmlParsers()
+{
+	std::string document = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+		"<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+		"<library_visual_scenes>\n<visual_scene id=\"scene\">\n";
+	char nodeBuffer[512];
+	for ( size_t i = 0; i < NODE_COUNT; ++i )
+	{
+		sprintf( nodeBuffer, "<node id=\"node%u\" name=\"node%u\" type=\"NODE\">"
+			"<translate sid=\"translate\">1 2 3</translate>"
+			"<rotate sid=\"rotateZ\">0 0 1 90</rotate>"
+			"<instance_geometry url=\"#geometry\"><bind_material><technique_common>"
+			"<instance_material symbol=\"material\" target=\"#material\"/>"
+			"</technique_common></bind_material></instance_geometry>"
+			"<extra><technique profile=\"ext\"><ext:visibility xmlns:ext=\"urn:ext\" ext:value=\"1\"/></technique></extra>"
+			"</node>\n", (unsigned int)i, (unsigned int)i );
+		document.append( nodeBuffer );
+	}
+	document.append( "</visual_scene>\n</library_visual_scenes>\n</COLLADA>\n" );
+
+	{
+		HashingParser parser;
+		LibxmlSaxParser saxParser( &parser, LibxmlSaxParser::SAX1 );
+		parseDocument( "libxml SAX1", saxParser, parser, document );
+	}
+	{
+		HashingParser parser;
+		LibxmlSaxParser saxParser( &parser, LibxmlSaxParser::SAX2 );
+		parseDocument( "libxml SAX2", saxParser, parser, document );
+	}
+	{
+		HashingParser parser;
+		ExpatSaxParser saxParser( &parser, 64 * 1024 );
+		parseDocument( "expat", saxParser, parser, document );
+	}
+}
+
+
+//--------------------------------------------------------------------
+void performanceTest()
+{
+	srand( 1 );
+
+	// typical float_array content
+	std::string floats;
+	floats.reserve( VALUE_COUNT * 12 );
+	char valueBuffer[32];
+	for ( size_t i = 0; i < VALUE_COUNT; ++i )
+	{
+		sprintf( valueBuffer, "%g ", (double)(rand() - RAND_MAX / 2) / 1000 );
+		floats.append( valueBuffer );
+	}
+
+	// typical <p> content
+	std::string indices;
+	indices.reserve( VALUE_COUNT * 7 );
+	for ( size_t i = 0; i < VALUE_COUNT; ++i )
+	{
+		sprintf( valueBuffer, "%u ", (unsigned int)(rand() % 100000) );
+		indices.append( valueBuffer );
+	}
+
+	// pretty printed lists
+	std::string indentedFloats;
+	indentedFloats.reserve( VALUE_COUNT * 20 );
+	for ( size_t i = 0; i < VALUE_COUNT; ++i )
+	{
+		sprintf( valueBuffer, (i % 3 == 2) ? "%g\n          " : "%g ", (double)(rand() - RAND_MAX / 2) / 1000 );
+		indentedFloats.append( valueBuffer );
+	}
+
+	convertList<float, Utils::toFloat>( "float list", floats );
+	convertList<float, Utils::toFloat>( "indented float list", indentedFloats );
+	convertList<double, Utils::toDouble>( "double list", floats );
+	convertList<uint32, Utils::toUint32>( "uint32 list", indices );
+	convertList<uint64, Utils::toUint64>( "uint64 list", indices );
+	convertList<sint32, Utils::toSint32>( "sint32 list", indices );
+
+	accumulateText( 256 << 20, 0 );
+	accumulateText( 256 << 20, 10 );
+
+	compareXmlParsers();
+}
@@ -0,0 +1,158 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COMMON_ASYNCFWRITEBUFFERFLUSHER_H__
+#define __COMMON_ASYNCFWRITEBUFFERFLUSHER_H__
+
+#include "CommonIBufferFlusher.h"
+#include "CommonFWriteBufferFlusher.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace Common
+{
+	/** Writes the received data to a file on a background thread, so that the caller can fill the next
+	buffer while the previous one is written. The data is copied into a small ring of buffers, each of
+	which is handed to the I/O thread once it is full. The marks are executed by a FWriteBufferFlusher
+	on the I/O thread in the order they were set, so seeking back to a mark works as with the
+	FWriteBufferFlusher. Errors of the writes become visible through receiveData(), flush() and getError().*/
+	class AsyncFWriteBufferFlusher : public IBufferFlusher
+	{
+	public:
+		static const size_t DEFAULT_BUFFER_SIZE = FWriteBufferFlusher::DEFAUL_BUFFER_SIZE;
+		static const size_t DEFAULT_BUFFER_COUNT = 4;
+
+	private:
+		/** The operations executed by the I/O thread.*/
+		enum CommandType
+		{
+			COMMAND_WRITE,
+			COMMAND_START_MARK,
+			COMMAND_JUMP_TO_MARK,
+			COMMAND_FLUSH
+		};
+
+		struct Command
+		{
+			CommandType type;
+			/** The buffer to write, for COMMAND_WRITE only.*/
+			char* buffer;
+			size_t length;
+			/** The mark to jump to, for COMMAND_JUMP_TO_MARK only.*/
+			MarkId markId;
+			bool keepMarkId;
+		};
+
+		typedef std::deque<Command> CommandQueue;
+
+		typedef std::set<MarkId> MarkIdSet;
+
+	private:
+		/** Writes to the file. Used by the I/O thread only, once it has been started.*/
+		FWriteBufferFlusher mFlusher;
+
+		/** The size of each buffer of the ring.*/
+		size_t mBufferSize;
+
+		/** All buffers of the ring.*/
+		std::vector<char*> mBuffers;
+
+		/** The buffers not queued to be written.*/
+		std::vector<char*> mFreeBuffers;
+
+		/** The buffer currently filled by receiveData.*/
+		char* mCurrentBuffer;
+
+		/** The number of bytes in mCurrentBuffer.*/
+		size_t mCurrentLength;
+
+		/** The commands not yet taken by the I/O thread.*/
+		CommandQueue mCommands;
+
+		/** The number of commands queued or being executed.*/
+		size_t mPendingCommandCount;
+
+		/** Guards all members shared with the I/O thread.*/
+		mutable std::mutex mMutex;
+
+		/** Signaled, when a command has been queued or the I/O thread should stop.*/
+		std::condition_variable mCommandQueued;
+
+		/** Signaled, when the I/O thread has executed a command.*/
+		std::condition_variable mCommandExecuted;
+
+		/** True, if the I/O thread should stop, once all commands are executed.*/
+		bool mStop;
+
+		/** True, if a command failed on the I/O thread.*/
+		bool mFailed;
+
+		/** The id of the last mark started. Mirrors the ids assigned by mFlusher.*/
+		MarkId mLastMarkId;
+
+		/** The marks that can be jumped to.*/
+		MarkIdSet mMarkIds;
+
+		/** The I/O thread. Started last in the constructor.*/
+		std::thread mThread;
+
+	public:
+		AsyncFWriteBufferFlusher( const char* fileName, size_t bufferSize = DEFAULT_BUFFER_SIZE, size_t bufferCount = DEFAULT_BUFFER_COUNT, const char* mode="wb" );
+
+		/** Writes all pending data and stops the I/O thread.*/
+		virtual ~AsyncFWriteBufferFlusher();
+
+		/** The error code of fopen_s or EIO, if writing to the file failed.*/
+		int getError() const;
+
+		/** Copies @a length bytes starting at @a buffer into the ring to be written on the I/O thread.
+		Waits, if all buffers are queued.
+		@return True on success, false if the file could not be opened or a previous write failed.*/
+		virtual bool receiveData( const char* buffer, size_t length);
+
+		/** Waits until all the data previously received by receiveData has been written and flushes the file.*/
+		virtual bool flush();
+
+		void startMark();
+
+		IBufferFlusher::MarkId endMark();
+
+		/** Jumps to @a markId for all data received afterwards.
+		@return False, if the mark is unknown. A failing seek is reported by the next flush.*/
+		bool jumpToMark(IBufferFlusher::MarkId markId, bool keepMarkId = false);
+
+	private:
+        /** Disable default copy ctor. */
+		AsyncFWriteBufferFlusher( const AsyncFWriteBufferFlusher& pre );
+        /** Disable default assignment operator. */
+		const AsyncFWriteBufferFlusher& operator= ( const AsyncFWriteBufferFlusher& pre );
+
+		/** Queues the current buffer, if it contains data, and takes the next free one.*/
+		bool queueCurrentBuffer();
+
+		/** Queues a command that does not write a buffer.*/
+		void queueCommand( CommandType type, MarkId markId = END_OF_STREAM, bool keepMarkId = false );
+
+		/** Waits until all queued commands have been executed.
+		@return False, if a command failed.*/
+		bool waitForPendingCommands();
+
+		/** The main function of the I/O thread.*/
+		void executeCommands();
+
+	};
+} // namespace COMMON
+
+#endif // __COMMON_ASYNCFWRITEBUFFERFLUSHER_H__
@@ -65,6 +65,16 @@ namespace Common
 		( 16 digits ) if @a doublePrecision is true, otherwise single precision as the float version.*/
 		bool copyToBufferAsChar( double d, bool doublePrecision = false);
 
+		/** Copies the string representations of the @a length floats in @a values into the buffer, each 
+		followed by @a separator. The numbers are written directly into the buffer, which is only flushed 
+		if the next number might not fit. Values within float epsilon of zero are written as 0.*/
+		bool copyToBufferAsChar( const float values[], size_t length, char separator = ' ' );
+
+		/** Copies the string representations of the @a length doubles in @a values into the buffer, each 
+		followed by @a separator. Values within double epsilon of zero are written as 0.
+		@see copyToBufferAsChar( double d, bool doublePrecision ).*/
+		bool copyToBufferAsChar( const double values[], size_t length, bool doublePrecision = false, char separator = ' ' );
+
 		/** Copies a string representation @a i into the buffer.*/
 		bool copyToBufferAsChar( char i);
 		bool copyToBufferAsChar( unsigned char i);
@@ -0,0 +1,218 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COMMON_GZIPBUFFERFLUSHER_H__
+#define __COMMON_GZIPBUFFERFLUSHER_H__
+
+#include "CommonIBufferFlusher.h"
+#include "CommonFWriteBufferFlusher.h"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Common
+{
+	/** Writes the received data gzip compressed to a file or as the COLLADA document of a .zae archive.
+	The data is cut into blocks, which are deflated independently by a pool of threads and written in
+	order, so the result is a single valid deflate stream. Each block is primed with the last 32 KB of
+	the previous one, so the compression ratio is close to that of a sequential compressor.
+	A compressed stream can not be rewritten, therefore all data from the first mark set on is kept
+	uncompressed in memory, until no mark is left and the end of the stream has been jumped to again.
+	The stream is completed by the destructor.*/
+	class GzipBufferFlusher : public IBufferFlusher
+	{
+	public:
+		/** The formats of the written file.*/
+		enum Format
+		{
+			/** A gzip file.*/
+			FORMAT_GZIP,
+			/** A .zae archive containing the document and a manifest naming it.*/
+			FORMAT_ZAE
+		};
+
+		static const size_t DEFAULT_BLOCK_SIZE = 256*1024;
+
+		/** Passing this thread count uses one thread per processor.*/
+		static const size_t AUTOMATIC_THREAD_COUNT = 0;
+
+		/** The compression level used by gzip by default.*/
+		static const int DEFAULT_COMPRESSION_LEVEL = 6;
+
+	private:
+		/** A block of the received data and its compressed form.*/
+		struct Block
+		{
+			/** The last bytes of the previous block, used as dictionary.*/
+			std::vector<char> dictionary;
+			std::vector<char> data;
+			std::vector<char> compressedData;
+			/** The crc32 of data.*/
+			unsigned long crc;
+			bool compressed;
+			bool failed;
+		};
+
+		typedef std::deque<Block*> BlockQueue;
+
+		typedef std::map<MarkId, size_t> MarkIdToOffset;
+
+	private:
+		/** Writes the compressed data to the file. Used by the calling thread only.*/
+		FWriteBufferFlusher mFlusher;
+
+		Format mFormat;
+
+		/** The name of the document in the archive, for FORMAT_ZAE only.*/
+		std::string mDocumentName;
+
+		size_t mBlockSize;
+
+		int mCompressionLevel;
+
+		/** The compressing threads.*/
+		std::vector<std::thread> mThreads;
+
+		/** The block currently filled by receiveData.*/
+		Block* mCurrentBlock;
+
+		/** The last bytes of the block queued last.*/
+		std::vector<char> mDictionary;
+
+		/** All queued blocks, in the order they are written.*/
+		BlockQueue mQueuedBlocks;
+
+		/** The queued blocks not yet taken by a compressing thread.*/
+		BlockQueue mUncompressedBlocks;
+
+		/** Written blocks that can be reused.*/
+		std::vector<Block*> mFreeBlocks;
+
+		/** Guards all members shared with the compressing threads.*/
+		std::mutex mMutex;
+
+		/** Signaled, when a block has been queued or the compressing threads should stop.*/
+		std::condition_variable mBlockQueued;
+
+		/** Signaled, when a compressing thread has compressed a block.*/
+		std::condition_variable mBlockCompressed;
+
+		/** True, if the compressing threads should stop.*/
+		bool mStop;
+
+		/** True, if compressing or writing failed.*/
+		bool mFailed;
+
+		/** The crc32 and the size of the data written so far.*/
+		unsigned long mCrc;
+		unsigned long long mSize;
+
+		/** The number of bytes written to the file so far.*/
+		unsigned long long mFileSize;
+
+		/** The size of the compressed document, for FORMAT_ZAE only.*/
+		unsigned long long mCompressedSize;
+
+		/** The position of the local header of the document in the archive, for FORMAT_ZAE only.*/
+		unsigned long long mDocumentHeaderOffset;
+
+		/** The central directory entry of the manifest, for FORMAT_ZAE only.*/
+		std::vector<char> mCentralDirectory;
+
+		/** The modification time of the archive members in MS-DOS format, for FORMAT_ZAE only.*/
+		unsigned short mDosTime;
+		unsigned short mDosDate;
+
+		/** The data starting at the first mark set, not yet passed to compression.*/
+		std::vector<char> mMarkedData;
+
+		/** True, while data is kept in mMarkedData.*/
+		bool mKeepMarkedData;
+
+		/** The position in mMarkedData the received data is written to.*/
+		size_t mMarkedDataPosition;
+
+		MarkId mLastMarkId;
+
+		/** The marks that can be jumped to and their position in mMarkedData.*/
+		MarkIdToOffset mMarkIds;
+
+	public:
+		/** Creates the file @a fileName.
+		@param documentName The name of the document in a .zae archive. If empty, it is the name of the
+		archive with the extension .dae.
+		@param threadCount The number of compressing threads.*/
+		GzipBufferFlusher( const char* fileName,
+			Format format = FORMAT_GZIP,
+			const std::string& documentName = std::string(),
+			size_t blockSize = DEFAULT_BLOCK_SIZE,
+			size_t threadCount = AUTOMATIC_THREAD_COUNT,
+			int compressionLevel = DEFAULT_COMPRESSION_LEVEL );
+
+		/** Compresses all pending data, completes the stream and stops the compressing threads.*/
+		virtual ~GzipBufferFlusher();
+
+		/** The error code of fopen_s or EIO, if compressing or writing to the file failed.*/
+		int getError() const;
+
+		/** Receives and handles @a length bytes starting at @a buffer.
+		@return True on success, false if the file could not be opened or a previous block failed.*/
+		virtual bool receiveData( const char* buffer, size_t length);
+
+		/** Compresses and writes all the data received so far, except data kept for marks. The file
+		is not a complete gzip stream before the flusher is destroyed.*/
+		virtual bool flush();
+
+		void startMark();
+
+		IBufferFlusher::MarkId endMark();
+
+		bool jumpToMark(IBufferFlusher::MarkId markId, bool keepMarkId = false);
+
+	private:
+        /** Disable default copy ctor. */
+		GzipBufferFlusher( const GzipBufferFlusher& pre );
+        /** Disable default assignment operator. */
+		const GzipBufferFlusher& operator= ( const GzipBufferFlusher& pre );
+
+		/** Appends @a length bytes to the blocks to compress.*/
+		bool compressData( const char* buffer, size_t length );
+
+		/** Passes mMarkedData to compression, once no mark is left.*/
+		bool releaseMarkedData();
+
+		/** Queues the current block for compression, if it contains data, and takes a new one.*/
+		bool queueCurrentBlock();
+
+		/** Writes the queued blocks in order, as long as they are compressed. Waits for a block, if
+		more than @a maxQueuedBlockCount blocks are queued.*/
+		bool writeCompressedBlocks( size_t maxQueuedBlockCount );
+
+		/** Writes @a length bytes to the file.*/
+		bool writeToFile( const char* data, size_t length );
+
+		/** Writes the gzip header or the manifest and the local header of the document.*/
+		bool writeHeader();
+
+		/** Terminates the deflate stream and writes the gzip trailer or the end of the archive.*/
+		bool writeTrailer();
+
+		/** The main function of the compressing threads.*/
+		void compressBlocks();
+
+	};
+} // namespace COMMON
+
+#endif // __COMMON_GZIPBUFFERFLUSHER_H__
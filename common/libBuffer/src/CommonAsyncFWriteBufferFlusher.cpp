@@ -0,0 +1,269 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "CommonAsyncFWriteBufferFlusher.h"
+
+#include <cerrno>
+#include <string.h>
+
+namespace Common
+{
+	//--------------------------------------------------------------------
+	AsyncFWriteBufferFlusher::AsyncFWriteBufferFlusher( const char* fileName, size_t bufferSize, size_t bufferCount, const char* mode/*="wb"*/ )
+		: mFlusher( fileName, bufferSize, mode )
+		, mBufferSize( bufferSize )
+		, mCurrentBuffer(0)
+		, mCurrentLength(0)
+		, mPendingCommandCount(0)
+		, mStop(false)
+		, mFailed(false)
+		, mLastMarkId(END_OF_STREAM)
+	{
+		// one buffer is filled while the others are written
+		if ( bufferCount < 2 )
+		{
+			bufferCount = 2;
+		}
+		for ( size_t i = 0; i < bufferCount; ++i )
+		{
+			mBuffers.push_back( new char[mBufferSize] );
+		}
+		mFreeBuffers.assign( mBuffers.begin() + 1, mBuffers.end() );
+		mCurrentBuffer = mBuffers[0];
+
+		if ( mFlusher.getError() == 0 )
+		{
+			mThread = std::thread( &AsyncFWriteBufferFlusher::executeCommands, this );
+		}
+	}
+
+	//--------------------------------------------------------------------
+	AsyncFWriteBufferFlusher::~AsyncFWriteBufferFlusher()
+	{
+		if ( mThread.joinable() )
+		{
+			flush();
+			{
+				std::lock_guard<std::mutex> lock( mMutex );
+				mStop = true;
+			}
+			mCommandQueued.notify_one();
+			mThread.join();
+		}
+		for ( size_t i = 0; i < mBuffers.size(); ++i )
+		{
+			delete[] mBuffers[i];
+		}
+	}
+
+	//--------------------------------------------------------------------
+	int AsyncFWriteBufferFlusher::getError() const
+	{
+		int error = mFlusher.getError();
+		if ( error != 0 )
+		{
+			return error;
+		}
+		std::lock_guard<std::mutex> lock( mMutex );
+		return mFailed ? EIO : 0;
+	}
+
+	//--------------------------------------------------------------------
+	bool AsyncFWriteBufferFlusher::receiveData( const char* buffer, size_t length )
+	{
+		if ( !mThread.joinable() )
+		{
+			return false;
+		}
+		while ( length > 0 )
+		{
+			if ( mCurrentLength == mBufferSize )
+			{
+				if ( !queueCurrentBuffer() )
+				{
+					return false;
+				}
+			}
+			size_t copyLength = mBufferSize - mCurrentLength;
+			if ( copyLength > length )
+			{
+				copyLength = length;
+			}
+			memcpy( mCurrentBuffer + mCurrentLength, buffer, copyLength );
+			mCurrentLength += copyLength;
+			buffer += copyLength;
+			length -= copyLength;
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool AsyncFWriteBufferFlusher::flush()
+	{
+		if ( !mThread.joinable() )
+		{
+			return false;
+		}
+		if ( !queueCurrentBuffer() )
+		{
+			return false;
+		}
+		queueCommand( COMMAND_FLUSH );
+		return waitForPendingCommands();
+	}
+
+	//------------------------------
+	void AsyncFWriteBufferFlusher::startMark()
+	{
+		if ( !mThread.joinable() )
+		{
+			return;
+		}
+		// the mark has to be set behind the data received so far
+		queueCurrentBuffer();
+		queueCommand( COMMAND_START_MARK );
+
+		// mFlusher assigns the same ids, when it executes the command
+		mLastMarkId++;
+		mMarkIds.insert( mLastMarkId );
+	}
+
+	//------------------------------
+	IBufferFlusher::MarkId AsyncFWriteBufferFlusher::endMark()
+	{
+		return mLastMarkId;
+	}
+
+	//------------------------------
+	bool AsyncFWriteBufferFlusher::jumpToMark( IBufferFlusher::MarkId markId, bool keepMarkId /*= false*/ )
+	{
+		if ( !mThread.joinable() )
+		{
+			return false;
+		}
+		if ( markId != END_OF_STREAM )
+		{
+			MarkIdSet::iterator markIdIt = mMarkIds.find( markId );
+			if ( markIdIt == mMarkIds.end() )
+			{
+				return false;
+			}
+			if ( !keepMarkId )
+			{
+				mMarkIds.erase( markIdIt );
+			}
+		}
+		if ( !queueCurrentBuffer() )
+		{
+			return false;
+		}
+		queueCommand( COMMAND_JUMP_TO_MARK, markId, keepMarkId );
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool AsyncFWriteBufferFlusher::queueCurrentBuffer()
+	{
+		std::unique_lock<std::mutex> lock( mMutex );
+		if ( mCurrentLength > 0 )
+		{
+			Command command = { COMMAND_WRITE, mCurrentBuffer, mCurrentLength, END_OF_STREAM, false };
+			mCommands.push_back( command );
+			mPendingCommandCount++;
+			mCommandQueued.notify_one();
+
+			// the I/O thread returns every buffer, even if writing it failed
+			while ( mFreeBuffers.empty() )
+			{
+				mCommandExecuted.wait( lock );
+			}
+			mCurrentBuffer = mFreeBuffers.back();
+			mFreeBuffers.pop_back();
+			mCurrentLength = 0;
+		}
+		return !mFailed;
+	}
+
+	//--------------------------------------------------------------------
+	void AsyncFWriteBufferFlusher::queueCommand( CommandType type, MarkId markId, bool keepMarkId )
+	{
+		std::lock_guard<std::mutex> lock( mMutex );
+		Command command = { type, 0, 0, markId, keepMarkId };
+		mCommands.push_back( command );
+		mPendingCommandCount++;
+		mCommandQueued.notify_one();
+	}
+
+	//--------------------------------------------------------------------
+	bool AsyncFWriteBufferFlusher::waitForPendingCommands()
+	{
+		std::unique_lock<std::mutex> lock( mMutex );
+		while ( mPendingCommandCount > 0 )
+		{
+			mCommandExecuted.wait( lock );
+		}
+		return !mFailed;
+	}
+
+	//--------------------------------------------------------------------
+	void AsyncFWriteBufferFlusher::executeCommands()
+	{
+		std::unique_lock<std::mutex> lock( mMutex );
+		for ( ;; )
+		{
+			while ( mCommands.empty() && !mStop )
+			{
+				mCommandQueued.wait( lock );
+			}
+			if ( mCommands.empty() )
+			{
+				return;
+			}
+			Command command = mCommands.front();
+			mCommands.pop_front();
+			// commands following a failed one are skipped, the data would end up at the wrong position
+			bool failed = mFailed;
+			lock.unlock();
+
+			bool success = true;
+			if ( !failed )
+			{
+				switch ( command.type )
+				{
+				case COMMAND_WRITE:
+					success = mFlusher.receiveData( command.buffer, command.length );
+					break;
+				case COMMAND_START_MARK:
+					mFlusher.startMark();
+					break;
+				case COMMAND_JUMP_TO_MARK:
+					success = mFlusher.jumpToMark( command.markId, command.keepMarkId );
+					break;
+				case COMMAND_FLUSH:
+					success = mFlusher.flush();
+					break;
+				}
+			}
+
+			lock.lock();
+			if ( command.type == COMMAND_WRITE )
+			{
+				mFreeBuffers.push_back( command.buffer );
+			}
+			if ( !success )
+			{
+				mFailed = true;
+			}
+			mPendingCommandCount--;
+			mCommandExecuted.notify_all();
+		}
+	}
+
+} // namespace Common
@@ -11,6 +11,7 @@
 #include "CommonCharacterBuffer.h"
 
 #include <string.h>
+#include <float.h>
 #include <algorithm>
 #include <Commonftoa.h>
 #include <Commondtoa.h>
@@ -97,6 +98,74 @@ namespace Common
 		return true;
 	}
 
+	//--------------------------------------------------------------------
+	bool CharacterBuffer::copyToBufferAsChar( const float values[], size_t length, char separator )
+	{
+		for ( size_t i = 0; i < length; ++i )
+		{
+			if ( getBytesAvailable() < FTOA_BUFFERSIZE + 1 )
+			{
+				//The float and the separator might not fit into the buffer. We need to flush first.
+				flushBuffer();
+				if ( getBytesAvailable() < FTOA_BUFFERSIZE + 1 )
+				{
+					//No chance to convert the float with this buffer
+					return false;
+				}
+			}
+
+			char* position = getCurrentPosition();
+			size_t bytesWritten;
+			if ( values[i] < FLT_EPSILON && values[i] > -FLT_EPSILON )
+			{
+				*position = '0';
+				bytesWritten = 1;
+			}
+			else
+			{
+				bytesWritten = ftoa( values[i], position );
+			}
+			position[bytesWritten] = separator;
+
+			increaseCurrentPosition( bytesWritten + 1 );
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool CharacterBuffer::copyToBufferAsChar( const double values[], size_t length, bool doublePrecision, char separator )
+	{
+		for ( size_t i = 0; i < length; ++i )
+		{
+			if ( getBytesAvailable() < DTOA_BUFFERSIZE + 1 )
+			{
+				//The double and the separator might not fit into the buffer. We need to flush first.
+				flushBuffer();
+				if ( getBytesAvailable() < DTOA_BUFFERSIZE + 1 )
+				{
+					//No chance to convert the double with this buffer
+					return false;
+				}
+			}
+
+			char* position = getCurrentPosition();
+			size_t bytesWritten;
+			if ( values[i] < DBL_EPSILON && values[i] > -DBL_EPSILON )
+			{
+				*position = '0';
+				bytesWritten = 1;
+			}
+			else
+			{
+				bytesWritten = dtoa( values[i], position, doublePrecision );
+			}
+			position[bytesWritten] = separator;
+
+			increaseCurrentPosition( bytesWritten + 1 );
+		}
+		return true;
+	}
+
 	//--------------------------------------------------------------------
 	bool CharacterBuffer::copyToBufferAsChar( bool v )
 	{
@@ -0,0 +1,631 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "CommonGzipBufferFlusher.h"
+
+#include "zlib.h"
+
+#include <cerrno>
+#include <ctime>
+#include <string.h>
+
+namespace Common
+{
+	/** The size of the window of deflate, i.e. the size of the dictionary a block is primed with.*/
+	static const size_t DICTIONARY_SIZE = 32*1024;
+
+	/** A final deflate block without data. It terminates the stream of blocks ended by sync flushes.*/
+	static const char FINAL_EMPTY_BLOCK[] = { 0x03, 0x00 };
+
+	static const char ZAE_MANIFEST_NAME[] = "manifest.xml";
+
+	/** The zip version needed to extract zip64 archives.*/
+	static const unsigned short ZIP64_VERSION = 45;
+
+	//--------------------------------------------------------------------
+	static void append16( std::vector<char>& data, unsigned long value )
+	{
+		data.push_back( (char)(value & 0xff) );
+		data.push_back( (char)((value >> 8) & 0xff) );
+	}
+
+	//--------------------------------------------------------------------
+	static void append32( std::vector<char>& data, unsigned long value )
+	{
+		append16( data, value & 0xffff );
+		append16( data, (value >> 16) & 0xffff );
+	}
+
+	//--------------------------------------------------------------------
+	static void append64( std::vector<char>& data, unsigned long long value )
+	{
+		append32( data, (unsigned long)(value & 0xffffffff) );
+		append32( data, (unsigned long)(value >> 32) );
+	}
+
+	//--------------------------------------------------------------------
+	static void appendString( std::vector<char>& data, const std::string& str )
+	{
+		data.insert( data.end(), str.begin(), str.end() );
+	}
+
+	//--------------------------------------------------------------------
+	/** Percent encodes all characters of @a name, that may not appear in the path of an uri.*/
+	static std::string encodeUriPath( const std::string& name )
+	{
+		static const char HEX_DIGITS[] = "0123456789ABCDEF";
+		std::string encodedName;
+		for ( size_t i = 0; i < name.size(); ++i )
+		{
+			unsigned char c = (unsigned char)name[i];
+			if ( (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || strchr( "-._~/", c ) )
+			{
+				encodedName += (char)c;
+			}
+			else
+			{
+				encodedName += '%';
+				encodedName += HEX_DIGITS[c >> 4];
+				encodedName += HEX_DIGITS[c & 0xf];
+			}
+		}
+		return encodedName;
+	}
+
+	//--------------------------------------------------------------------
+	GzipBufferFlusher::GzipBufferFlusher( const char* fileName, Format format, const std::string& documentName, size_t blockSize, size_t threadCount, int compressionLevel )
+		: mFlusher( fileName )
+		, mFormat( format )
+		, mDocumentName( documentName )
+		, mBlockSize( blockSize > 0 ? blockSize : DEFAULT_BLOCK_SIZE )
+		, mCompressionLevel( compressionLevel )
+		, mCurrentBlock( new Block() )
+		, mStop( false )
+		, mFailed( false )
+		, mCrc( crc32( 0, Z_NULL, 0 ) )
+		, mSize( 0 )
+		, mFileSize( 0 )
+		, mCompressedSize( 0 )
+		, mDocumentHeaderOffset( 0 )
+		, mDosTime( 0 )
+		, mDosDate( 0 )
+		, mKeepMarkedData( false )
+		, mMarkedDataPosition( 0 )
+		, mLastMarkId( END_OF_STREAM )
+	{
+		mCurrentBlock->data.reserve( mBlockSize );
+
+		if ( mDocumentName.empty() )
+		{
+			// the name of the archive, without directory and extension
+			std::string archiveName( fileName );
+			size_t separatorPos = archiveName.find_last_of( "/\\" );
+			if ( separatorPos != std::string::npos )
+			{
+				archiveName.erase( 0, separatorPos + 1 );
+			}
+			size_t extensionPos = archiveName.find_last_of( '.' );
+			if ( extensionPos != std::string::npos && extensionPos > 0 )
+			{
+				archiveName.erase( extensionPos );
+			}
+			mDocumentName = archiveName + ".dae";
+		}
+
+		time_t currentTime = time( 0 );
+		const tm* localTime = localtime( &currentTime );
+		if ( localTime && localTime->tm_year >= 80 )
+		{
+			mDosTime = (unsigned short)( (localTime->tm_hour << 11) | (localTime->tm_min << 5) | (localTime->tm_sec / 2) );
+			mDosDate = (unsigned short)( ((localTime->tm_year - 80) << 9) | ((localTime->tm_mon + 1) << 5) | localTime->tm_mday );
+		}
+
+		if ( mFlusher.getError() != 0 || !writeHeader() )
+		{
+			return;
+		}
+
+		if ( threadCount == AUTOMATIC_THREAD_COUNT )
+		{
+			threadCount = std::thread::hardware_concurrency();
+		}
+		if ( threadCount < 1 )
+		{
+			threadCount = 1;
+		}
+		for ( size_t i = 0; i < threadCount; ++i )
+		{
+			mThreads.push_back( std::thread( &GzipBufferFlusher::compressBlocks, this ) );
+		}
+	}
+
+	//--------------------------------------------------------------------
+	GzipBufferFlusher::~GzipBufferFlusher()
+	{
+		if ( !mThreads.empty() )
+		{
+			// data kept for marks not jumped to anymore is written as it is
+			if ( mKeepMarkedData )
+			{
+				mKeepMarkedData = false;
+				compressData( mMarkedData.empty() ? 0 : &mMarkedData[0], mMarkedData.size() );
+			}
+			queueCurrentBlock();
+			writeCompressedBlocks( 0 );
+			writeTrailer();
+			mFlusher.flush();
+
+			{
+				std::lock_guard<std::mutex> lock( mMutex );
+				mStop = true;
+			}
+			mBlockQueued.notify_all();
+			for ( size_t i = 0; i < mThreads.size(); ++i )
+			{
+				mThreads[i].join();
+			}
+		}
+
+		delete mCurrentBlock;
+		for ( size_t i = 0; i < mFreeBlocks.size(); ++i )
+		{
+			delete mFreeBlocks[i];
+		}
+	}
+
+	//--------------------------------------------------------------------
+	int GzipBufferFlusher::getError() const
+	{
+		int error = mFlusher.getError();
+		if ( error != 0 )
+		{
+			return error;
+		}
+		return mFailed ? EIO : 0;
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::receiveData( const char* buffer, size_t length )
+	{
+		if ( mThreads.empty() )
+		{
+			return false;
+		}
+		if ( !mKeepMarkedData )
+		{
+			return compressData( buffer, length );
+		}
+
+		// overwrites the data behind a mark jumped to and appends the rest
+		size_t overwriteLength = mMarkedData.size() - mMarkedDataPosition;
+		if ( overwriteLength > length )
+		{
+			overwriteLength = length;
+		}
+		if ( overwriteLength > 0 )
+		{
+			memcpy( &mMarkedData[0] + mMarkedDataPosition, buffer, overwriteLength );
+		}
+		mMarkedData.insert( mMarkedData.end(), buffer + overwriteLength, buffer + length );
+		mMarkedDataPosition += length;
+		return !mFailed;
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::flush()
+	{
+		if ( mThreads.empty() )
+		{
+			return false;
+		}
+		if ( !queueCurrentBlock() || !writeCompressedBlocks( 0 ) )
+		{
+			return false;
+		}
+		return mFlusher.flush();
+	}
+
+	//------------------------------
+	void GzipBufferFlusher::startMark()
+	{
+		if ( !mKeepMarkedData )
+		{
+			mKeepMarkedData = true;
+			mMarkedData.clear();
+			mMarkedDataPosition = 0;
+		}
+		mLastMarkId++;
+		mMarkIds.insert( std::make_pair( mLastMarkId, mMarkedDataPosition ) );
+	}
+
+	//------------------------------
+	IBufferFlusher::MarkId GzipBufferFlusher::endMark()
+	{
+		return mLastMarkId;
+	}
+
+	//------------------------------
+	bool GzipBufferFlusher::jumpToMark( IBufferFlusher::MarkId markId, bool keepMarkId /*= false*/ )
+	{
+		if ( markId == END_OF_STREAM )
+		{
+			mMarkedDataPosition = mMarkedData.size();
+		}
+		else
+		{
+			MarkIdToOffset::iterator markIdIt = mMarkIds.find( markId );
+			if ( markIdIt == mMarkIds.end() )
+			{
+				return false;
+			}
+			mMarkedDataPosition = markIdIt->second;
+			if ( !keepMarkId )
+			{
+				mMarkIds.erase( markIdIt );
+			}
+		}
+		return releaseMarkedData();
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::compressData( const char* buffer, size_t length )
+	{
+		while ( length > 0 )
+		{
+			if ( mCurrentBlock->data.size() == mBlockSize )
+			{
+				if ( !queueCurrentBlock() )
+				{
+					return false;
+				}
+			}
+			size_t copyLength = mBlockSize - mCurrentBlock->data.size();
+			if ( copyLength > length )
+			{
+				copyLength = length;
+			}
+			mCurrentBlock->data.insert( mCurrentBlock->data.end(), buffer, buffer + copyLength );
+			buffer += copyLength;
+			length -= copyLength;
+		}
+		return !mFailed;
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::releaseMarkedData()
+	{
+		if ( !mKeepMarkedData || !mMarkIds.empty() || mMarkedDataPosition != mMarkedData.size() )
+		{
+			return !mFailed;
+		}
+		mKeepMarkedData = false;
+		bool success = compressData( mMarkedData.empty() ? 0 : &mMarkedData[0], mMarkedData.size() );
+
+		// marked regions can be large, their memory is not kept
+		std::vector<char>().swap( mMarkedData );
+		mMarkedDataPosition = 0;
+		return success;
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::queueCurrentBlock()
+	{
+		Block* block = mCurrentBlock;
+		if ( block->data.empty() )
+		{
+			return !mFailed;
+		}
+
+		// blocks are compressed independently, each one is primed with the end of its predecessor
+		block->dictionary.swap( mDictionary );
+		size_t dictionaryLength = block->data.size() < DICTIONARY_SIZE ? block->data.size() : DICTIONARY_SIZE;
+		mDictionary.assign( block->data.end() - dictionaryLength, block->data.end() );
+		block->compressed = false;
+		block->failed = false;
+
+		{
+			std::lock_guard<std::mutex> lock( mMutex );
+			mQueuedBlocks.push_back( block );
+			mUncompressedBlocks.push_back( block );
+		}
+		mBlockQueued.notify_one();
+
+		if ( mFreeBlocks.empty() )
+		{
+			mCurrentBlock = new Block();
+			mCurrentBlock->data.reserve( mBlockSize );
+		}
+		else
+		{
+			mCurrentBlock = mFreeBlocks.back();
+			mFreeBlocks.pop_back();
+			mCurrentBlock->data.clear();
+		}
+
+		// two blocks per thread keep all threads busy, while the memory used stays bounded
+		return writeCompressedBlocks( 2 * mThreads.size() );
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::writeCompressedBlocks( size_t maxQueuedBlockCount )
+	{
+		for ( ;; )
+		{
+			Block* block = 0;
+			{
+				std::unique_lock<std::mutex> lock( mMutex );
+				if ( mQueuedBlocks.empty() )
+				{
+					break;
+				}
+				block = mQueuedBlocks.front();
+				while ( !block->compressed && mQueuedBlocks.size() > maxQueuedBlockCount )
+				{
+					mBlockCompressed.wait( lock );
+				}
+				if ( !block->compressed )
+				{
+					break;
+				}
+				mQueuedBlocks.pop_front();
+			}
+
+			if ( block->failed )
+			{
+				mFailed = true;
+			}
+			else if ( !mFailed )
+			{
+				mCrc = crc32_combine( mCrc, block->crc, (z_off_t)block->data.size() );
+				mSize += block->data.size();
+				mCompressedSize += block->compressedData.size();
+				writeToFile( &block->compressedData[0], block->compressedData.size() );
+			}
+			mFreeBlocks.push_back( block );
+		}
+		return !mFailed;
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::writeToFile( const char* data, size_t length )
+	{
+		if ( !mFlusher.receiveData( data, length ) )
+		{
+			mFailed = true;
+		}
+		mFileSize += length;
+		return !mFailed;
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::writeHeader()
+	{
+		std::vector<char> header;
+		if ( mFormat == FORMAT_GZIP )
+		{
+			// deflate, no name, no modification time, unknown operating system
+			const char GZIP_HEADER[] = { (char)0x1f, (char)0x8b, 8, 0, 0, 0, 0, 0, 0, (char)0xff };
+			header.assign( GZIP_HEADER, GZIP_HEADER + sizeof(GZIP_HEADER) );
+			return writeToFile( &header[0], header.size() );
+		}
+
+		// the manifest is stored, it is a member of its own before the document
+		std::string manifest = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<dae_root>./" + encodeUriPath( mDocumentName ) + "</dae_root>\n";
+		unsigned long manifestCrc = crc32( crc32( 0, Z_NULL, 0 ), (const Bytef*)manifest.data(), (uInt)manifest.size() );
+		std::string manifestName( ZAE_MANIFEST_NAME );
+
+		append32( header, 0x04034b50 );
+		append16( header, 20 );
+		append16( header, 0 );
+		append16( header, 0 );
+		append16( header, mDosTime );
+		append16( header, mDosDate );
+		append32( header, manifestCrc );
+		append32( header, (unsigned long)manifest.size() );
+		append32( header, (unsigned long)manifest.size() );
+		append16( header, (unsigned long)manifestName.size() );
+		append16( header, 0 );
+		appendString( header, manifestName );
+		appendString( header, manifest );
+
+		append32( mCentralDirectory, 0x02014b50 );
+		append16( mCentralDirectory, 20 );
+		append16( mCentralDirectory, 20 );
+		append16( mCentralDirectory, 0 );
+		append16( mCentralDirectory, 0 );
+		append16( mCentralDirectory, mDosTime );
+		append16( mCentralDirectory, mDosDate );
+		append32( mCentralDirectory, manifestCrc );
+		append32( mCentralDirectory, (unsigned long)manifest.size() );
+		append32( mCentralDirectory, (unsigned long)manifest.size() );
+		append16( mCentralDirectory, (unsigned long)manifestName.size() );
+		append16( mCentralDirectory, 0 );
+		append16( mCentralDirectory, 0 );
+		append16( mCentralDirectory, 0 );
+		append16( mCentralDirectory, 0 );
+		append32( mCentralDirectory, 0 );
+		append32( mCentralDirectory, 0 );
+		appendString( mCentralDirectory, manifestName );
+
+		// the sizes of the document are not known yet, they follow its data in a zip64 data descriptor
+		mDocumentHeaderOffset = header.size();
+		append32( header, 0x04034b50 );
+		append16( header, ZIP64_VERSION );
+		append16( header, 0x0008 );
+		append16( header, Z_DEFLATED );
+		append16( header, mDosTime );
+		append16( header, mDosDate );
+		append32( header, 0 );
+		append32( header, 0xffffffff );
+		append32( header, 0xffffffff );
+		append16( header, (unsigned long)mDocumentName.size() );
+		append16( header, 20 );
+		appendString( header, mDocumentName );
+		append16( header, 0x0001 );
+		append16( header, 16 );
+		append64( header, 0 );
+		append64( header, 0 );
+
+		return writeToFile( &header[0], header.size() );
+	}
+
+	//--------------------------------------------------------------------
+	bool GzipBufferFlusher::writeTrailer()
+	{
+		if ( !writeToFile( FINAL_EMPTY_BLOCK, sizeof(FINAL_EMPTY_BLOCK) ) )
+		{
+			return false;
+		}
+		mCompressedSize += sizeof(FINAL_EMPTY_BLOCK);
+
+		std::vector<char> trailer;
+		if ( mFormat == FORMAT_GZIP )
+		{
+			// the size is stored modulo 2^32
+			append32( trailer, mCrc );
+			append32( trailer, (unsigned long)(mSize & 0xffffffff) );
+			return writeToFile( &trailer[0], trailer.size() );
+		}
+
+		append32( trailer, 0x08074b50 );
+		append32( trailer, mCrc );
+		append64( trailer, mCompressedSize );
+		append64( trailer, mSize );
+
+		append32( mCentralDirectory, 0x02014b50 );
+		append16( mCentralDirectory, ZIP64_VERSION );
+		append16( mCentralDirectory, ZIP64_VERSION );
+		append16( mCentralDirectory, 0x0008 );
+		append16( mCentralDirectory, Z_DEFLATED );
+		append16( mCentralDirectory, mDosTime );
+		append16( mCentralDirectory, mDosDate );
+		append32( mCentralDirectory, mCrc );
+		append32( mCentralDirectory, 0xffffffff );
+		append32( mCentralDirectory, 0xffffffff );
+		append16( mCentralDirectory, (unsigned long)mDocumentName.size() );
+		append16( mCentralDirectory, 28 );
+		append16( mCentralDirectory, 0 );
+		append16( mCentralDirectory, 0 );
+		append16( mCentralDirectory, 0 );
+		append32( mCentralDirectory, 0 );
+		append32( mCentralDirectory, 0xffffffff );
+		appendString( mCentralDirectory, mDocumentName );
+		append16( mCentralDirectory, 0x0001 );
+		append16( mCentralDirectory, 24 );
+		append64( mCentralDirectory, mSize );
+		append64( mCentralDirectory, mCompressedSize );
+		append64( mCentralDirectory, mDocumentHeaderOffset );
+
+		unsigned long long centralDirectoryOffset = mFileSize + trailer.size();
+		trailer.insert( trailer.end(), mCentralDirectory.begin(), mCentralDirectory.end() );
+		unsigned long long zip64EndOffset = mFileSize + trailer.size();
+
+		// zip64 end of central directory record and locator
+		append32( trailer, 0x06064b50 );
+		append64( trailer, 44 );
+		append16( trailer, ZIP64_VERSION );
+		append16( trailer, ZIP64_VERSION );
+		append32( trailer, 0 );
+		append32( trailer, 0 );
+		append64( trailer, 2 );
+		append64( trailer, 2 );
+		append64( trailer, mCentralDirectory.size() );
+		append64( trailer, centralDirectoryOffset );
+
+		append32( trailer, 0x07064b50 );
+		append32( trailer, 0 );
+		append64( trailer, zip64EndOffset );
+		append32( trailer, 1 );
+
+		// end of central directory record, the values not fitting are taken from the zip64 record
+		append32( trailer, 0x06054b50 );
+		append16( trailer, 0 );
+		append16( trailer, 0 );
+		append16( trailer, 2 );
+		append16( trailer, 2 );
+		append32( trailer, (unsigned long)mCentralDirectory.size() );
+		append32( trailer, centralDirectoryOffset < 0xffffffff ? (unsigned long)centralDirectoryOffset : 0xffffffff );
+		append16( trailer, 0 );
+
+		return writeToFile( &trailer[0], trailer.size() );
+	}
+
+	//--------------------------------------------------------------------
+	void GzipBufferFlusher::compressBlocks()
+	{
+		z_stream stream;
+		memset( &stream, 0, sizeof(stream) );
+		// raw deflate, the gzip or zip framing is written by the flusher
+		bool initialized = ( deflateInit2( &stream, mCompressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY ) == Z_OK );
+
+		std::unique_lock<std::mutex> lock( mMutex );
+		for ( ;; )
+		{
+			while ( mUncompressedBlocks.empty() && !mStop )
+			{
+				mBlockQueued.wait( lock );
+			}
+			if ( mUncompressedBlocks.empty() )
+			{
+				break;
+			}
+			Block* block = mUncompressedBlocks.front();
+			mUncompressedBlocks.pop_front();
+			lock.unlock();
+
+			bool success = initialized && ( deflateReset( &stream ) == Z_OK );
+			if ( success && !block->dictionary.empty() )
+			{
+				success = ( deflateSetDictionary( &stream, (const Bytef*)&block->dictionary[0], (uInt)block->dictionary.size() ) == Z_OK );
+			}
+
+			if ( success )
+			{
+				// a sync flush ends the block on a byte boundary, so the blocks can be concatenated
+				block->compressedData.resize( deflateBound( &stream, (uLong)block->data.size() ) + 16 );
+				stream.next_in = (Bytef*)&block->data[0];
+				stream.avail_in = (uInt)block->data.size();
+				stream.next_out = (Bytef*)&block->compressedData[0];
+				stream.avail_out = (uInt)block->compressedData.size();
+				for ( ;; )
+				{
+					int result = deflate( &stream, Z_SYNC_FLUSH );
+					if ( result != Z_OK && result != Z_BUF_ERROR )
+					{
+						success = false;
+						break;
+					}
+					if ( stream.avail_out > 0 )
+					{
+						break;
+					}
+					size_t compressedLength = block->compressedData.size();
+					block->compressedData.resize( 2 * compressedLength );
+					stream.next_out = (Bytef*)&block->compressedData[compressedLength];
+					stream.avail_out = (uInt)compressedLength;
+				}
+				block->compressedData.resize( block->compressedData.size() - stream.avail_out );
+				block->crc = crc32( crc32( 0, Z_NULL, 0 ), (const Bytef*)&block->data[0], (uInt)block->data.size() );
+			}
+
+			lock.lock();
+			block->compressed = true;
+			block->failed = !success;
+			mBlockCompressed.notify_all();
+		}
+		lock.unlock();
+
+		if ( initialized )
+		{
+			deflateEnd( &stream );
+		}
+	}
+
+} // namespace Common
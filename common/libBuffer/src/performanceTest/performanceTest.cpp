@@ -12,6 +12,8 @@
 
 #include "CommonCharacterBuffer.h"
 #include "CommonFWriteBufferFlusher.h"
+#include "CommonAsyncFWriteBufferFlusher.h"
+#include "CommonGzipBufferFlusher.h"
 #include "CommonStreamBufferFlusher.h"
 #include "math.h"
 
@@ -30,39 +32,27 @@
 
 
 
-void performanceTest()
+static double getTime()
 {
-
-	const size_t BUFFERSIZE = /*1024**/1024*64;
-	char *mBuffer = new char[BUFFERSIZE];
-	FILE* stream;
-	std::string mLocale = setlocale(LC_NUMERIC, 0);
-	setlocale(LC_NUMERIC, "C");
-
-
 #ifdef WIN32
-	char fileNameBuffer[] = "c:\\temp\\testBuffer.txt";
-	char fileNameFwrite[] = "c:\\temp\\testFwrite.txt";
-#else
-	char fileNameBuffer[] = "/tmp/testBuffer.txt";
-	char fileNameFwrite[] = "/tmp/testFwrite.txt";
-#endif
-	
-	int error = 0;
-#ifdef WIN32
-	error = fopen_s ( &stream, fileNameFwrite, "wb" );
+#pragma warning(disable: 4996)
+	_timeb timeBuffer;
+	_ftime( &timeBuffer );
+#pragma warning(default: 4996)
 #else
-    stream = fopen( fileNameBuffer, "wb" );
-	error = stream ? 0 : errno;
+	timeb timeBuffer;
+	ftime( &timeBuffer );
 #endif
-
-	bool failed = ( setvbuf ( stream , mBuffer, _IOFBF, BUFFERSIZE ) != 0 );
+	return (double)timeBuffer.time + (double)timeBuffer.millitm / 1000;
+}
 
 
+/** Formats floats into a character buffer flushed by @a bufferFlusher and prints the throughput.*/
+static void writeFloats( const char* flusherName, Common::IBufferFlusher& bufferFlusher, size_t bufferSize )
+{
+	const size_t VALUE_COUNT = 100000000;
 
-	Common::FWriteBufferFlusher bufferFlusher(fileNameBuffer, BUFFERSIZE);
-//	Common::StreamBufferFlusher bufferFlusher(fileNameBuffer, BUFFERSIZE);
-	Common::CharacterBuffer buffer(64*BUFFERSIZE, &bufferFlusher);
+	Common::CharacterBuffer buffer(64*bufferSize, &bufferFlusher);
 	buffer.setDirectFlushSize( 40 );
 
 
@@ -71,64 +61,85 @@ void performanceTest()
 	char testChar = '1';
 
 
-	float testFloat = 1.23456;
+	float testFloat = 1.23456f;
 	double testDouble = 1;
 
 	int testInt = 123;
 
-#ifdef WIN32
-#pragma warning(disable: 4996)
-	_timeb startTimeBuffer;
-	_ftime( &startTimeBuffer );
-#pragma warning(default: 4996)
-#else
-	timeb startTimeBuffer;
-	ftime( &startTimeBuffer );
-#endif
+	double startTime = getTime();
 
-	double startTime = (double)startTimeBuffer.time + (double)startTimeBuffer.millitm / 1000;
+	for ( size_t i= 0; i < VALUE_COUNT; ++i)
+	{
+//		buffer.copyToBufferAsChar( testDouble );
 
+//		buffer.copyToBufferAsChar( testInt );
 
-	for ( size_t i= 0; i < 100000000; ++i)
-	{
-//		fwrite( testString, sizeof(char), sizeof(testString)-1, stream);
+//		buffer.copyToBuffer( testString, sizeof(testString)-1);
+//		buffer.copyToBuffer( testChar);
 
-//	    FPRINTF( stream, "%g", testFloat);
+		buffer.copyToBufferAsChar( testFloat );
+	}
+	// the time includes writing the remaining data to disk
+	buffer.flushFlusher();
 
-//		FPRINTF( stream, "%g", testDouble);
+	double elapsedTime = getTime() - startTime;
+	double megaBytes = (double)buffer.getBytesCopiedToBuffer() / (1024*1024);
 
-//		FPRINTF( stream, "%d", testInt);
+	std::cout << flusherName << ": " << megaBytes << " MB in " << elapsedTime << " s";
+	if ( elapsedTime > 0 )
+	{
+		std::cout << ", " << megaBytes / elapsedTime << " MB/s";
+	}
+	std::cout << std::endl;
 
-		buffer.copyToBufferAsChar( testFloat );
+	(void)testString;
+	(void)testChar;
+	(void)testDouble;
+	(void)testInt;
+}
 
-//		buffer.copyToBufferAsChar( testDouble );
 
-//		buffer.copyToBufferAsChar( testInt );
+void performanceTest()
+{
 
-//		buffer.copyToBuffer( testString, sizeof(testString)-1);
-//		buffer.copyToBuffer( testChar);
-	}
+	const size_t BUFFERSIZE = /*1024**/1024*64;
+	std::string mLocale = setlocale(LC_NUMERIC, 0);
+	setlocale(LC_NUMERIC, "C");
 
 
 #ifdef WIN32
-#pragma warning(disable: 4996)
-	_timeb endTimeBuffer;
-	_ftime(&endTimeBuffer);
-#pragma warning(default: 4996)
+	char fileNameFwrite[] = "c:\\temp\\testFwrite.txt";
+	char fileNameAsync[] = "c:\\temp\\testAsyncFwrite.txt";
+	char fileNameGzip[] = "c:\\temp\\testGzip.txt.gz";
 #else
-	timeb endTimeBuffer;
-	ftime(&endTimeBuffer);
+	char fileNameFwrite[] = "/tmp/testFwrite.txt";
+	char fileNameAsync[] = "/tmp/testAsyncFwrite.txt";
+	char fileNameGzip[] = "/tmp/testGzip.txt.gz";
 #endif
 
+	{
+		Common::FWriteBufferFlusher bufferFlusher(fileNameFwrite, BUFFERSIZE);
+		writeFloats( "FWriteBufferFlusher", bufferFlusher, BUFFERSIZE );
+	}
 
+	{
+		Common::AsyncFWriteBufferFlusher bufferFlusher(fileNameAsync, BUFFERSIZE);
+		writeFloats( "AsyncFWriteBufferFlusher", bufferFlusher, BUFFERSIZE );
+	}
 
+	// the compression throughput, with one thread and with one thread per processor
+	{
+		Common::GzipBufferFlusher bufferFlusher(fileNameGzip, Common::GzipBufferFlusher::FORMAT_GZIP, "",
+			Common::GzipBufferFlusher::DEFAULT_BLOCK_SIZE, 1);
+		writeFloats( "GzipBufferFlusher, 1 thread", bufferFlusher, BUFFERSIZE );
+	}
 
-	fclose ( stream );
-
-	delete[] mBuffer;
-
-	double endTime = (double)endTimeBuffer.time + (double)endTimeBuffer.millitm / 1000;
+	{
+		Common::GzipBufferFlusher bufferFlusher(fileNameGzip);
+		writeFloats( "GzipBufferFlusher", bufferFlusher, BUFFERSIZE );
+	}
 
-	std::cout << std::endl << "time elapsed: " << endTime - startTime << std::endl;
+//	Common::StreamBufferFlusher bufferFlusher(fileNameBuffer, BUFFERSIZE);
 
+	setlocale(LC_NUMERIC, mLocale.c_str());
 };
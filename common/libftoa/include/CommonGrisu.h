@@ -0,0 +1,37 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libftoa.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COMMON_GRISU_H__
+#define __COMMON_GRISU_H__
+
+#include <stdlib.h>
+
+namespace Common
+{
+
+	/** Writes the shortest decimal representation of the positive, finite and non zero binary floating
+	point number @a significand * 2^@a exponent into @a buffer, that is read back as the same number.
+	The digits are generated with the Grisu2 algorithm of Florian Loitsch ("Printing Floating-Point
+	Numbers Quickly and Accurately with Integers"). The result always reads back as the same number and
+	is the shortest one in almost all cases.
+	Numbers from 0.001 up to 999999 are written without exponent, all others in exponential
+	representation, e.g. 1.5e-7. The string is not null terminated.
+	@param significand The significand including the hidden bit, if any.
+	@param exponent The binary exponent of the least significant bit of @a significand.
+	@param lowerBoundaryIsCloser True if the predecessor of the number is closer than its successor,
+	i.e. the significand is a power of two and the number is not the smallest normalized number.
+	@param buffer The buffer to write to. Must be large enough for 17 digits, a decimal point and an
+	exponent.
+	@return Pointer to the first character after the written string.*/
+	char* grisu( unsigned long long significand, int exponent, bool lowerBoundaryIsCloser, char* buffer );
+
+}
+
+#endif // __COMMON_GRISU_H__
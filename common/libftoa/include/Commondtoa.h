@@ -20,10 +20,13 @@ namespace Common
 	static const size_t DTOA_BUFFERSIZE = 30;
 
 
-	/** Returns the number of bytes written in to the buffer.
+	/** Writes the shortest string representation of @a f, that is read back as the same number, and returns 
+	the number of bytes written in to the buffer.
 	@param buffer The buffer the string representation of the number will be written to. Its size must be at 
 	least DTOA_BUFFERSIZE.
-	@param doublePrecision If set to true, up to 16 significant digits are written, otherwise 6*/
+	@param doublePrecision If set to true, the shortest representation of the double is written (up to 17 
+	significant digits), otherwise the one of the nearest float (up to 9 significant digits), as long as the 
+	number is in the range of float.*/
 	int dtoa(double f, char* buffer, bool doublePrecision = false);
 
 }
@@ -20,7 +20,8 @@ namespace Common
 	static const size_t FTOA_BUFFERSIZE = 30;
 
 
-	/** Returns the number of bytes written in to the buffer.
+	/** Writes the shortest string representation of @a f, that is read back as the same float (up to 9 
+	significant digits), and returns the number of bytes written in to the buffer.
 	@param buffer The buffer the string representation of the number will be written to. Its size must be at 
 	least FTOA_BUFFERSIZE.*/
 	int ftoa(float f, char* buffer);
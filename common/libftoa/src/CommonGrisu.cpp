@@ -0,0 +1,322 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libftoa.
+	
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "CommonGrisu.h"
+
+namespace Common
+{
+
+	typedef unsigned long long uint64;
+
+	/** Floating point number with a 64 bit significand, i.e. the value is f * 2^e.*/
+	struct DiyFp
+	{
+		uint64 f;
+		int e;
+
+		DiyFp() : f(0), e(0) {}
+		DiyFp( uint64 significand, int exponent ) : f(significand), e(exponent) {}
+	};
+
+	/** Significands of the cached powers of ten 10^-348, 10^-340, ... 10^340, normalized and rounded 
+	to 64 bits.*/
+	static const uint64 CACHED_POWERS_SIGNIFICAND[] = {
+		0xFA8FD5A0081C0288ULL, 0xBAAEE17FA23EBF76ULL, 0x8B16FB203055AC76ULL,
+		0xCF42894A5DCE35EAULL, 0x9A6BB0AA55653B2DULL, 0xE61ACF033D1A45DFULL,
+		0xAB70FE17C79AC6CAULL, 0xFF77B1FCBEBCDC4FULL, 0xBE5691EF416BD60CULL,
+		0x8DD01FAD907FFC3CULL, 0xD3515C2831559A83ULL, 0x9D71AC8FADA6C9B5ULL,
+		0xEA9C227723EE8BCBULL, 0xAECC49914078536DULL, 0x823C12795DB6CE57ULL,
+		0xC21094364DFB5637ULL, 0x9096EA6F3848984FULL, 0xD77485CB25823AC7ULL,
+		0xA086CFCD97BF97F4ULL, 0xEF340A98172AACE5ULL, 0xB23867FB2A35B28EULL,
+		0x84C8D4DFD2C63F3BULL, 0xC5DD44271AD3CDBAULL, 0x936B9FCEBB25C996ULL,
+		0xDBAC6C247D62A584ULL, 0xA3AB66580D5FDAF6ULL, 0xF3E2F893DEC3F126ULL,
+		0xB5B5ADA8AAFF80B8ULL, 0x87625F056C7C4A8BULL, 0xC9BCFF6034C13053ULL,
+		0x964E858C91BA2655ULL, 0xDFF9772470297EBDULL, 0xA6DFBD9FB8E5B88FULL,
+		0xF8A95FCF88747D94ULL, 0xB94470938FA89BCFULL, 0x8A08F0F8BF0F156BULL,
+		0xCDB02555653131B6ULL, 0x993FE2C6D07B7FACULL, 0xE45C10C42A2B3B06ULL,
+		0xAA242499697392D3ULL, 0xFD87B5F28300CA0EULL, 0xBCE5086492111AEBULL,
+		0x8CBCCC096F5088CCULL, 0xD1B71758E219652CULL, 0x9C40000000000000ULL,
+		0xE8D4A51000000000ULL, 0xAD78EBC5AC620000ULL, 0x813F3978F8940984ULL,
+		0xC097CE7BC90715B3ULL, 0x8F7E32CE7BEA5C70ULL, 0xD5D238A4ABE98068ULL,
+		0x9F4F2726179A2245ULL, 0xED63A231D4C4FB27ULL, 0xB0DE65388CC8ADA8ULL,
+		0x83C7088E1AAB65DBULL, 0xC45D1DF942711D9AULL, 0x924D692CA61BE758ULL,
+		0xDA01EE641A708DEAULL, 0xA26DA3999AEF774AULL, 0xF209787BB47D6B85ULL,
+		0xB454E4A179DD1877ULL, 0x865B86925B9BC5C2ULL, 0xC83553C5C8965D3DULL,
+		0x952AB45CFA97A0B3ULL, 0xDE469FBD99A05FE3ULL, 0xA59BC234DB398C25ULL,
+		0xF6C69A72A3989F5CULL, 0xB7DCBF5354E9BECEULL, 0x88FCF317F22241E2ULL,
+		0xCC20CE9BD35C78A5ULL, 0x98165AF37B2153DFULL, 0xE2A0B5DC971F303AULL,
+		0xA8D9D1535CE3B396ULL, 0xFB9B7CD9A4A7443CULL, 0xBB764C4CA7A44410ULL,
+		0x8BAB8EEFB6409C1AULL, 0xD01FEF10A657842CULL, 0x9B10A4E5E9913129ULL,
+		0xE7109BFBA19C0C9DULL, 0xAC2820D9623BF429ULL, 0x80444B5E7AA7CF85ULL,
+		0xBF21E44003ACDD2DULL, 0x8E679C2F5E44FF8FULL, 0xD433179D9C8CB841ULL,
+		0x9E19DB92B4E31BA9ULL, 0xEB96BF6EBADF77D9ULL, 0xAF87023B9BF0EE6BULL
+	};
+
+	/** Binary exponents of the cached powers of ten.*/
+	static const short CACHED_POWERS_EXPONENT[] = {
+		-1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927,
+		-901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635, -608,
+		-582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+		-263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+		56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+		375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+		694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986,
+		1013, 1039, 1066
+	};
+
+	/** Smallest decimal exponent in the table of cached powers of ten.*/
+	static const int CACHED_POWERS_MIN_DECIMAL_EXPONENT = -348;
+
+	/** Distance of the decimal exponents of two consecutive cached powers of ten.*/
+	static const int CACHED_POWERS_DECIMAL_EXPONENT_DISTANCE = 8;
+
+	static const uint64 POWERS_OF_TEN[] = {
+		1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 
+		1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 
+		100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 
+		1000000000000000000ULL, 10000000000000000000ULL
+	};
+
+	//--------------------------------------------------------------------
+	/** Returns x * y, rounded to 64 bits.*/
+	static inline DiyFp multiply( const DiyFp& x, const DiyFp& y )
+	{
+		const uint64 M32 = 0xFFFFFFFFULL;
+		uint64 a = x.f >> 32;
+		uint64 b = x.f & M32;
+		uint64 c = y.f >> 32;
+		uint64 d = y.f & M32;
+		uint64 ac = a * c;
+		uint64 bc = b * c;
+		uint64 ad = a * d;
+		uint64 bd = b * d;
+		uint64 tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+		// round
+		tmp += 1ULL << 31;
+		return DiyFp( ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64 );
+	}
+
+	//--------------------------------------------------------------------
+	/** Shifts the significand of @a x until its most significant bit is set.*/
+	static inline DiyFp normalize( DiyFp x )
+	{
+		while ( (x.f & 0xFFC0000000000000ULL) == 0 )
+		{
+			x.f <<= 10;
+			x.e -= 10;
+		}
+		while ( (x.f & 0x8000000000000000ULL) == 0 )
+		{
+			x.f <<= 1;
+			x.e--;
+		}
+		return x;
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns the cached power of ten c = 10^-k, such that the binary exponent of @a exponent + the 
+	one of c is in [-60, -32].*/
+	static inline DiyFp getCachedPower( int exponent, int& k )
+	{
+		// the decimal exponent of the needed power of ten is log10(2) * (-61 - exponent) rounded up
+		double dk = (-61 - exponent) * 0.30102999566398114 - CACHED_POWERS_MIN_DECIMAL_EXPONENT - 1;
+		int decimalExponent = (int)dk;
+		if ( dk - decimalExponent > 0.0 )
+			decimalExponent++;
+		size_t index = (size_t)((decimalExponent / CACHED_POWERS_DECIMAL_EXPONENT_DISTANCE) + 1);
+		k = -(CACHED_POWERS_MIN_DECIMAL_EXPONENT + (int)index * CACHED_POWERS_DECIMAL_EXPONENT_DISTANCE);
+		return DiyFp( CACHED_POWERS_SIGNIFICAND[index], CACHED_POWERS_EXPONENT[index] );
+	}
+
+	//--------------------------------------------------------------------
+	static inline int countDecimalDigits( unsigned int n )
+	{
+		if ( n < 10 ) return 1;
+		if ( n < 100 ) return 2;
+		if ( n < 1000 ) return 3;
+		if ( n < 10000 ) return 4;
+		if ( n < 100000 ) return 5;
+		if ( n < 1000000 ) return 6;
+		if ( n < 10000000 ) return 7;
+		if ( n < 100000000 ) return 8;
+		if ( n < 1000000000 ) return 9;
+		return 10;
+	}
+
+	//--------------------------------------------------------------------
+	/** Decrements the last digit as long as the digits get closer to the scaled number @a w, 
+	without leaving the rounding interval.*/
+	static inline void roundWeed( char* digits, int length, uint64 delta, uint64 rest, uint64 tenKappa, uint64 distanceToW )
+	{
+		while ( rest < distanceToW && delta - rest >= tenKappa &&
+			   ( rest + tenKappa < distanceToW || distanceToW - rest > rest + tenKappa - distanceToW ) )
+		{
+			digits[length - 1]--;
+			rest += tenKappa;
+		}
+	}
+
+	//--------------------------------------------------------------------
+	/** Generates the shortest digits of the scaled upper boundary @a upper, that are not more than 
+	@a delta below it.*/
+	static void generateDigits( const DiyFp& w, const DiyFp& upper, uint64 delta, char* digits, int& length, int& k )
+	{
+		const DiyFp one( 1ULL << -upper.e, upper.e );
+		const uint64 distanceToW = upper.f - w.f;
+		unsigned int integral = (unsigned int)(upper.f >> -one.e);
+		uint64 fractional = upper.f & (one.f - 1);
+		int kappa = countDecimalDigits( integral );
+		length = 0;
+
+		while ( kappa > 0 )
+		{
+			// constant divisors are a lot faster than a division by a table entry
+			unsigned int digit = 0;
+			switch ( kappa )
+			{
+			case 10: digit = integral / 1000000000; integral %= 1000000000; break;
+			case  9: digit = integral /  100000000; integral %=  100000000; break;
+			case  8: digit = integral /   10000000; integral %=   10000000; break;
+			case  7: digit = integral /    1000000; integral %=    1000000; break;
+			case  6: digit = integral /     100000; integral %=     100000; break;
+			case  5: digit = integral /      10000; integral %=      10000; break;
+			case  4: digit = integral /       1000; integral %=       1000; break;
+			case  3: digit = integral /        100; integral %=        100; break;
+			case  2: digit = integral /         10; integral %=         10; break;
+			case  1: digit = integral;              integral =           0; break;
+			}
+			if ( digit || length )
+				digits[length++] = (char)('0' + digit);
+			kappa--;
+			uint64 rest = ((uint64)integral << -one.e) + fractional;
+			if ( rest <= delta )
+			{
+				k += kappa;
+				roundWeed( digits, length, delta, rest, POWERS_OF_TEN[kappa] << -one.e, distanceToW );
+				return;
+			}
+		}
+
+		for ( ;; )
+		{
+			fractional *= 10;
+			delta *= 10;
+			char digit = (char)(fractional >> -one.e);
+			if ( digit || length )
+				digits[length++] = (char)('0' + digit);
+			fractional &= one.f - 1;
+			kappa--;
+			if ( fractional < delta )
+			{
+				k += kappa;
+				int index = -kappa;
+				roundWeed( digits, length, delta, fractional, one.f, index < 20 ? distanceToW * POWERS_OF_TEN[index] : 0 );
+				return;
+			}
+		}
+	}
+
+	//--------------------------------------------------------------------
+	/** Writes the @a length digits, that represent digits * 10^k, without exponent if possible.*/
+	static char* formatDigits( const char* digits, int length, int k, char* buffer )
+	{
+		// the decimal exponent of the first digit + 1
+		const int pointPosition = length + k;
+		char* p = buffer;
+
+		if ( pointPosition >= -2 && pointPosition <= 6 )
+		{
+			if ( pointPosition <= 0 )
+			{
+				// 0.00ddd
+				*p++ = '0';
+				*p++ = '.';
+				for ( int i = pointPosition; i < 0; ++i )
+					*p++ = '0';
+				for ( int i = 0; i < length; ++i )
+					*p++ = digits[i];
+			}
+			else if ( pointPosition >= length )
+			{
+				// ddd00
+				for ( int i = 0; i < length; ++i )
+					*p++ = digits[i];
+				for ( int i = length; i < pointPosition; ++i )
+					*p++ = '0';
+			}
+			else
+			{
+				// dd.ddd
+				for ( int i = 0; i < pointPosition; ++i )
+					*p++ = digits[i];
+				*p++ = '.';
+				for ( int i = pointPosition; i < length; ++i )
+					*p++ = digits[i];
+			}
+			return p;
+		}
+
+		// d.ddde-xx
+		*p++ = digits[0];
+		if ( length > 1 )
+		{
+			*p++ = '.';
+			for ( int i = 1; i < length; ++i )
+				*p++ = digits[i];
+		}
+		*p++ = 'e';
+
+		int exponent = pointPosition - 1;
+		if ( exponent < 0 )
+		{
+			*p++ = '-';
+			exponent = -exponent;
+		}
+		if ( exponent >= 100 )
+		{
+			*p++ = (char)('0' + exponent / 100);
+			exponent %= 100;
+			*p++ = (char)('0' + exponent / 10);
+		}
+		else if ( exponent >= 10 )
+		{
+			*p++ = (char)('0' + exponent / 10);
+		}
+		*p++ = (char)('0' + exponent % 10);
+		return p;
+	}
+
+	//--------------------------------------------------------------------
+	char* grisu( uint64 significand, int exponent, bool lowerBoundaryIsCloser, char* buffer )
+	{
+		// boundaries of the rounding interval, with the same exponent
+		DiyFp upper = normalize( DiyFp( (significand << 1) + 1, exponent - 1 ) );
+		DiyFp lower = lowerBoundaryIsCloser ? DiyFp( (significand << 2) - 1, exponent - 2 ) : DiyFp( (significand << 1) - 1, exponent - 1 );
+		lower.f <<= lower.e - upper.e;
+		lower.e = upper.e;
+
+		int k = 0;
+		const DiyFp cachedPower = getCachedPower( upper.e, k );
+		const DiyFp w = multiply( normalize( DiyFp( significand, exponent ) ), cachedPower );
+		DiyFp scaledUpper = multiply( upper, cachedPower );
+		DiyFp scaledLower = multiply( lower, cachedPower );
+
+		// stay inside the interval, despite the rounding errors of the multiplications
+		scaledLower.f++;
+		scaledUpper.f--;
+
+		char digits[20];
+		int length = 0;
+		generateDigits( w, scaledUpper, scaledUpper.f - scaledLower.f, digits, length, k );
+
+		return formatDigits( digits, length, k, buffer );
+	}
+
+}
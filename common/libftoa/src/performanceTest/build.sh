@@ -0,0 +1,11 @@
+OPTIONS="-O3 -Wall"
+
+INCLUDES="-I../../include -I../../include/performanceTest"
+
+FILES="main.cpp performanceTest.cpp ../Commondtoa.cpp ../Commonftoa.cpp ../Commonitoa.cpp ../CommonGrisu.cpp"
+
+OUTPUTFILE="-o performanceTest"
+
+
+
+g++ $OPTIONS $INCLUDES $FILES $OUTPUTFILE
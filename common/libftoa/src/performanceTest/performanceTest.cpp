@@ -12,61 +12,124 @@
 
 #include "Commonftoa.h"
 #include "Commondtoa.h"
-#include "math.h"
 
 #include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
 
-#include <sys/types.h>
-#include <sys/timeb.h> 
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
 
 
-void performanceTest()
+#ifdef WIN32
+#   define SNPRINTF _snprintf
+#else
+#   define SNPRINTF snprintf
+#endif
+
+
+/** Number of values converted by each test.*/
+static const size_t VALUE_COUNT = 2000000;
+
+
+/** Result of one conversion test.*/
+struct TestResult
 {
+	/** Seconds needed to convert all values.*/
+	double seconds;
 
-	std::string mLocale = setlocale(LC_NUMERIC, 0);
-	setlocale(LC_NUMERIC, "C");
+	/** Number of characters written.*/
+	size_t characterCount;
 
-	char testString[] = "01234";
+	/** Number of values that are not read back as the converted value.*/
+	size_t roundTripErrorCount;
+};
 
-	float testFloat = 0;
-	double testDouble = 1.23456;
 
-#pragma warning(disable: 4996)
-	_timeb startTimeBuffer;
-	_ftime( &startTimeBuffer );
-	double startTime = (double)startTimeBuffer.time + (double)startTimeBuffer.millitm / 1000;
+/** Returns a pseudo random number in [-range, range], with a distribution similar to vertex data.*/
+static double randomValue( double range )
+{
+	double r = (double)rand() / RAND_MAX;
+	return (2 * r - 1) * range;
+}
 
 
-	char ftoaBuffer[Common::FTOA_BUFFERSIZE];
-	static float sum = 0 ;
-	static int sumi = 0;
+/** Converts all @a values with @a convert and measures time, output size and round trip errors.*/
+template<class FloatingPointType, class Converter>
+static TestResult runTest( const std::vector<FloatingPointType>& values, Converter convert )
+{
+	TestResult result;
+	result.characterCount = 0;
+	result.roundTripErrorCount = 0;
 
-	for ( size_t i= 0; i < 10000000 ; ++i)
+	char buffer[64];
+	clock_t startTime = clock();
+	for ( size_t i = 0; i < values.size(); ++i )
 	{
+		result.characterCount += convert( values[i], buffer );
+	}
+	result.seconds = (double)(clock() - startTime) / CLOCKS_PER_SEC;
 
+	// the round trip check is not part of the measured time
+	for ( size_t i = 0; i < values.size(); ++i )
+	{
+		convert( values[i], buffer );
+		if ( (FloatingPointType)strtod( buffer, 0 ) != values[i] )
+			++result.roundTripErrorCount;
+	}
+	return result;
+}
 
-		int bytesWritten;
 
-//		bytesWritten=sprintf(ftoaBuffer, "%g", testFloat);
+static void printResult( const char* name, const TestResult& result )
+{
+	std::cout << std::setw(28) << std::left << name 
+			  << std::setw(10) << std::right << std::fixed << std::setprecision(3) << result.seconds << " s" 
+			  << std::setw(12) << result.characterCount << " chars" 
+			  << std::setw(10) << result.roundTripErrorCount << " round trip errors" << std::endl;
+}
 
-//		bytesWritten=sprintf(ftoaBuffer, "%.16f", testDouble);
 
-//		bytesWritten = Common::ftoa(testFloat, ftoaBuffer);
+static int sprintfFloatG( float f, char* buffer ) { return SNPRINTF( buffer, 64, "%g", f ); }
+static int sprintfFloat9G( float f, char* buffer ) { return SNPRINTF( buffer, 64, "%.9g", f ); }
+static int commonFtoa( float f, char* buffer ) { return Common::ftoa( f, buffer ); }
+static int commonDtoaSinglePrecision( float f, char* buffer ) { return Common::dtoa( f, buffer, false ); }
 
-		bytesWritten = Common::dtoa(testDouble, ftoaBuffer);
+static int sprintfDoubleG( double d, char* buffer ) { return SNPRINTF( buffer, 64, "%g", d ); }
+static int sprintfDouble17G( double d, char* buffer ) { return SNPRINTF( buffer, 64, "%.17g", d ); }
+static int commonDtoaDoublePrecision( double d, char* buffer ) { return Common::dtoa( d, buffer, true ); }
 
-		sumi += bytesWritten;
 
-	}
+void performanceTest()
+{
+	std::string mLocale = setlocale(LC_NUMERIC, 0);
+	setlocale(LC_NUMERIC, "C");
 
+	srand( 12345 );
 
-	setlocale(LC_NUMERIC, mLocale.c_str());
-	_timeb endTimeBuffer;
-	_ftime(&endTimeBuffer);
-#pragma warning(default: 4996)
+	std::vector<float> floats( VALUE_COUNT );
+	std::vector<double> doubles( VALUE_COUNT );
+	for ( size_t i = 0; i < VALUE_COUNT; ++i )
+	{
+		// mix of positions, normals and texture coordinates
+		double range = (i % 3 == 0) ? 1000 : ((i % 3 == 1) ? 1 : 0.01);
+		floats[i] = (float)randomValue( range );
+		doubles[i] = randomValue( range );
+	}
 
-	double endTime = (double)endTimeBuffer.time + (double)endTimeBuffer.millitm / 1000;
+	std::cout << "converting " << VALUE_COUNT << " floats" << std::endl;
+	printResult( "sprintf(\"%g\")", runTest( floats, sprintfFloatG ) );
+	printResult( "sprintf(\"%.9g\")", runTest( floats, sprintfFloat9G ) );
+	printResult( "Common::ftoa", runTest( floats, commonFtoa ) );
+	printResult( "Common::dtoa", runTest( floats, commonDtoaSinglePrecision ) );
 
-	std::cout << std::endl << "time elapsed: " << endTime - startTime << std::endl;
+	std::cout << std::endl << "converting " << VALUE_COUNT << " doubles" << std::endl;
+	printResult( "sprintf(\"%g\")", runTest( doubles, sprintfDoubleG ) );
+	printResult( "sprintf(\"%.17g\")", runTest( doubles, sprintfDouble17G ) );
+	printResult( "Common::dtoa(double prec.)", runTest( doubles, commonDtoaDoublePrecision ) );
 
-};
\ No newline at end of file
+	setlocale(LC_NUMERIC, mLocale.c_str());
+}
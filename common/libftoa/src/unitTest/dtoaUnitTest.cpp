@@ -65,10 +65,10 @@ bool dtoaUnitTest()
 	testDouble(1.00001e7,         "1.00001e7");
 	testDouble(1.234567,          "1.234567");
 	testDouble(123456,            "123456");
-	testDouble(1234567,           "1.23457e6");
-	testDouble(1234567e23,        "1.23457e29");
-	testDouble(1234567e-23,       "1.23457e-17");
-	testDouble(123456.789,        "123456.8");
+	testDouble(1234567,           "1.234567e6");
+	testDouble(1234567e23,        "1.234567e29");
+	testDouble(1234567e-23,       "1.234567e-17");
+	testDouble(123456.789,        "123456.79");
 
 	std::cout << std::endl;
 	std::cout << std::endl;
@@ -78,17 +78,17 @@ bool dtoaUnitTest()
 	testDouble(-1.00001,           "-1.00001");
 	testDouble(-1.00001e7,         "-1.00001e7");
 	testDouble(-123456,            "-123456");
-	testDouble(-1234567,           "-1.23457e6");
-	testDouble(-1234567e23,        "-1.23457e29");
-	testDouble(-1234567e-23,       "-1.23457e-17");
-	testDouble(-123456.789,        "-123456.8");
+	testDouble(-1234567,           "-1.234567e6");
+	testDouble(-1234567e23,        "-1.234567e29");
+	testDouble(-1234567e-23,       "-1.234567e-17");
+	testDouble(-123456.789,        "-123456.79");
 
 	std::cout << std::endl;
 	std::cout << std::endl;
 
 	testDouble(999999,             "999999");
-	testDouble(999999.9,           "10e5");
-	testDouble(0.0001,             "10e-5");
+	testDouble(999999.9,           "999999.9");
+	testDouble(0.0001,             "1e-4");
 	testDouble(0.00010006,         "1.0006e-4");
 	testDouble(0.000098,           "9.8e-5");
 
@@ -96,16 +96,16 @@ bool dtoaUnitTest()
 	std::cout << std::endl;
 
 	testDouble(-999999,            "-999999");
-	testDouble(-999999.9,          "-10e5");
-	testDouble(-0.0001,            "-10e-5");
+	testDouble(-999999.9,          "-999999.9");
+	testDouble(-0.0001,            "-1e-4");
 	testDouble(-0.000098,          "-9.8e-5");
 
 	std::cout << std::endl;
 	std::cout << std::endl;
 
-	testDouble(0.00001,             "10e-6");
-	testDouble(0.0001,              "10e-5");
-	testDouble(0.001,               "10e-4");
+	testDouble(0.00001,             "1e-5");
+	testDouble(0.0001,              "1e-4");
+	testDouble(0.001,               "0.001");
 	testDouble(0.01,                "0.01");
 	testDouble(0.1,                 "0.1");
 	testDouble(1,                   "1");
@@ -120,11 +120,11 @@ bool dtoaUnitTest()
 
 	std::cout << std::endl;
 	std::cout << "double precision" << std::endl;
-	testDouble(123456789012345678,          "1.234567890123457e17", true);
-	testDouble(1.23456789012345678,          "1.234567890123457", true);
+	testDouble(123456789012345678,          "1.2345678901234568e17", true);
+	testDouble(1.23456789012345678,          "1.2345678901234567", true);
 	testDouble(0.00000000000000000000000023456789012345678,          "2.345678901234568e-25", true);
 	testDouble(0.00000000000000000000000000000000000000000000000023456789012345678,          "2.345678901234568e-49", true);
-	testDouble(0.9999999999999999,          "0.9999999999999998", true);
+	testDouble(0.9999999999999999,          "0.9999999999999999", true);
 
 	std::cout << std::endl;
 	std::cout << std::endl;
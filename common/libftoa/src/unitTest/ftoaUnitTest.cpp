@@ -53,10 +53,10 @@ bool ftoaUnitTest()
 	testFloat(1.00001e7f,         "1.00001e7");
 	testFloat(1.234567f,          "1.234567");
 	testFloat(123456,            "123456");
-	testFloat(1234567,           "1.23457e6");
-	testFloat(1234567e23f,        "1.23457e29");
-	testFloat(1234567e-23f,       "1.23457e-17");
-	testFloat(123456.789f,        "123456.8");
+	testFloat(1234567,           "1.234567e6");
+	testFloat(1234567e23f,        "1.234567e29");
+	testFloat(1234567e-23f,       "1.234567e-17");
+	testFloat(123456.789f,        "123456.79");
 
 	std::cout << std::endl;
 	std::cout << std::endl;
@@ -66,17 +66,17 @@ bool ftoaUnitTest()
 	testFloat(-1.00001f,           "-1.00001");
 	testFloat(-1.00001e7f,         "-1.00001e7");
 	testFloat(-123456,            "-123456");
-	testFloat(-1234567,           "-1.23457e6");
-	testFloat(-1234567e23f,        "-1.23457e29");
-	testFloat(-1234567e-23f,       "-1.23457e-17");
-	testFloat(-123456.789f,        "-123456.8");
+	testFloat(-1234567,           "-1.234567e6");
+	testFloat(-1234567e23f,        "-1.234567e29");
+	testFloat(-1234567e-23f,       "-1.234567e-17");
+	testFloat(-123456.789f,        "-123456.79");
 
 	std::cout << std::endl;
 	std::cout << std::endl;
 
 	testFloat(999999,             "999999");
-	testFloat(999999.9f,           "1e6");
-	testFloat(0.0001f,             "10e-5");
+	testFloat(999999.9f,           "999999.9");
+	testFloat(0.0001f,             "1e-4");
 	testFloat(0.00010006f,         "1.0006e-4");
 	testFloat(0.000098f,           "9.8e-5");
 
@@ -84,17 +84,17 @@ bool ftoaUnitTest()
 	std::cout << std::endl;
 
 	testFloat(-999999,            "-999999");
-	testFloat(-999999.9f,          "-1e6");
-	testFloat(-0.0001f,            "-10e-5");
+	testFloat(-999999.9f,          "-999999.9");
+	testFloat(-0.0001f,            "-1e-4");
 	testFloat(-0.000098f,          "-9.8e-5");
 
 	std::cout << std::endl;
 	std::cout << std::endl;
 
-	testFloat(0.00001f,             "10e-6");
-	testFloat(0.0001f,              "10e-5");
-	testFloat(0.001f,               "0.000999987");
-	testFloat(0.01f,                "0.00999999");
+	testFloat(0.00001f,             "1e-5");
+	testFloat(0.0001f,              "1e-4");
+	testFloat(0.001f,               "0.001");
+	testFloat(0.01f,                "0.01");
 	testFloat(0.1f,                 "0.1");
 	testFloat(1,                   "1");
 	testFloat(1,                   "1");
@@ -34,6 +34,9 @@ namespace DAE23ds
 
 		static void reportError(const String& method, const String& message, Writer::Severity severity);
 
+		/** The writer all data is written to.*/
+		Writer* getWriter() const { return mWriter; }
+
 		const Writer::GeometryUniqueIdInstanceGeometryInfoMap& getGeometryUniqueIdInstanceGeometryInfoMap();
 
 		void addInstanceGeometryInstanceGeometryInfoPair(const COLLADAFW::UniqueId& geoId, const Writer::InstanceGeometryInfo& instanceGeoInfo);
@@ -88,6 +91,9 @@ namespace DAE23ds
 		/** Returns and increases the Object Id of the next object that will be exported.*/
 		Writer::ObjectId getAndIncreaseNextObjectId() const;
 
+		/** Returns the Object Id of the next object that will be exported and increases it by @a objectsCount.*/
+		Writer::ObjectId getAndIncreaseNextObjectId( size_t objectsCount ) const;
+
 		/** The Object Id of the next object that will be exported.*/
 		MaterialNumber getNextMaterialNumber() const { return mWriter->getNextMaterialNumber(); }
 
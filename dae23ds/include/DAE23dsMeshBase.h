@@ -55,6 +55,9 @@ namespace DAE23ds
 		/** Set of GeometryMaterialBinding that have been handled already. Is used to avoid multiple export of identical meshes.*/
 		Writer::GeometryMaterialBindingSet mGeometryMaterialBindingSet;
 
+		/** The number of objects the handled instances of the mesh are written into.*/
+		size_t mObjectsCount;
+
 	public:
 
 		/** Constructor. */
@@ -70,6 +73,10 @@ namespace DAE23ds
 		bool handle();
 
 		static void calculateBlockCountAndRemainingTriangles( size_t trianglesCount, ChunkLength& remainingTriangles, ChunkLength& blockCount, ChunkLength& fullBlockCount);
+
+		/** Returns the number of objects, i.e. object ids, the instances of the mesh handled by handle() 
+		are written into.*/
+		size_t getObjectsCount() const { return mObjectsCount; }
 	
 	private:
 
@@ -33,6 +33,9 @@ namespace DAE23ds
 
 		Common::Buffer& mBuffer;
 
+		/** The Object Id of the next object written by this mesh writer.*/
+		Writer::ObjectId mNextObjectId;
+
 		// material ids of the triangles in the last block written
 		COLLADAFW::MaterialId mMaterialIds[MAX_TRIANGLES_PER_BLOCK];
 
@@ -46,12 +49,17 @@ namespace DAE23ds
 
 	public:
 
-        /** Constructor. */
-		MeshWriter(Writer* writer3ds, const COLLADAFW::Mesh* mesh );
+        /** Constructor. 
+		@param buffer The buffer the objects are written to.
+		@param firstObjectId The Object Id of the first object written for the mesh.*/
+		MeshWriter(Writer* writer3ds, const COLLADAFW::Mesh* mesh, Common::Buffer& buffer, Writer::ObjectId firstObjectId );
 
         /** Destructor. */
 		virtual ~MeshWriter();
 
+		/** The Object Id following the last object written by this mesh writer.*/
+		Writer::ObjectId getNextMeshObjectId() const { return mNextObjectId; }
+
 		/** Writes the mesh using @a materialBindings to assign materials.*/
 		bool writeMeshIntoOneObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoOneObject& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance);
 
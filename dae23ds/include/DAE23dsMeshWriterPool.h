@@ -0,0 +1,115 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of dae23ds.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __DAE23DS_MESHWRITERPOOL_H__
+#define __DAE23DS_MESHWRITERPOOL_H__
+
+#include "DAE23dsPrerequisites.h"
+#include "DAE23dsBaseWriter.h"
+
+#include "COLLADABUThreadPool.h"
+
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace DAE23ds
+{
+
+	/** Writes meshes on worker threads, each into a buffer of its own. The buffers are copied into the
+	buffer of the writer in the order the meshes have been added, so the file does not depend on the
+	number of threads. The object ids of each mesh are reserved when it is added. */
+	class MeshWriterPool : public BaseWriter
+	{
+	private:
+		/** A mesh added to the pool and the data written for it.*/
+		struct Job
+		{
+			const COLLADAFW::Mesh* mesh;
+
+			/** True, if the mesh is deleted, once it has been written.*/
+			bool ownsMesh;
+
+			/** The Object Id of the first object of the mesh.*/
+			Writer::ObjectId firstObjectId;
+
+			/** The data written for the mesh.*/
+			std::vector<char> data;
+
+			bool finished;
+			bool succeeded;
+		};
+
+		/** The jobs not yet copied into the buffer of the writer, in the order they have been added.*/
+		typedef std::deque<Job*> JobQueue;
+
+	private:
+		JobQueue mJobs;
+
+		/** The number of jobs that may be pending before addMesh() blocks.*/
+		size_t mMaxPendingJobsCount;
+
+		/** False, if writing one of the meshes failed.*/
+		bool mSucceeded;
+
+		/** Guards the finished flag of the jobs and mJobs.*/
+		std::mutex mMutex;
+
+		/** Signaled when a job has been finished.*/
+		std::condition_variable mJobFinished;
+
+		/** The worker threads. Declared last, to be destroyed before the members used by the workers.*/
+		COLLADABU::ThreadPool mThreadPool;
+
+	public:
+
+        /** Constructor.
+		@param threadCount The number of worker threads, 0 for one per hardware thread.*/
+		MeshWriterPool( Writer* writer3ds, size_t threadCount );
+
+        /** Destructor. */
+		virtual ~MeshWriterPool();
+
+		/** Adds @a mesh to be written by the next idle worker thread and copies the data of the jobs
+		finished so far. Blocks, if too many meshes are pending.
+		@param takeOwnership If true, the mesh is deleted, once it has been written. Otherwise it must
+		not be deleted before finish() returns.
+		@return False, if writing a mesh failed, true otherwise.*/
+		bool addMesh( const COLLADAFW::Mesh* mesh, bool takeOwnership );
+
+		/** Waits for all meshes to be written and copies their data into the buffer of the writer.
+		@return False, if writing a mesh failed, true otherwise.*/
+		bool finish();
+
+	private:
+
+        /** Disable default copy ctor. */
+		MeshWriterPool( const MeshWriterPool& pre );
+
+        /** Disable default assignment operator. */
+		const MeshWriterPool& operator= ( const MeshWriterPool& pre );
+
+		/** Writes the mesh of @a job into its data. Executed by the worker threads.*/
+		void writeMesh( Job* job );
+
+		/** Copies the data of finished jobs at the front of the queue into the buffer of the writer,
+		waiting for unfinished ones while more than @a maxPendingJobsCount jobs are pending.*/
+		bool copyFinishedJobs( size_t maxPendingJobsCount );
+
+		/** Deletes @a job and, if owned, its mesh.*/
+		static void deleteJob( Job* job );
+
+	};
+
+} // namespace DAE23DS
+
+#endif // __DAE23DS_MESHWRITERPOOL_H__
@@ -28,6 +28,8 @@
 #include <stack>
 #include <list>
 #include <map>
+#include <vector>
+#include <mutex>
 
 
 namespace Common
@@ -35,9 +37,15 @@ namespace Common
 	class Buffer;
 }
 
+namespace COLLADAFW
+{
+	class Mesh;
+}
+
 
 namespace DAE23ds
 {
+	class MeshWriterPool;
 
 	typedef unsigned int ChunkLength;
 	typedef unsigned short CountType;
@@ -202,10 +210,15 @@ namespace DAE23ds
 			size_t trianglesCount;
 			size_t positionsCount;
 			String name;
+			/** The number of objects the instances of the mesh are written into.*/
+			size_t objectsCount;
 		};
 
 		typedef std::map< COLLADAFW::UniqueId, MeshData > MeshDataMap;
 
+		/** List of meshes in the order they appear in the document.*/
+		typedef std::vector<COLLADAFW::Mesh*> MeshList;
+
 		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Node*> UniqueIdNodeMap;
 
 		typedef std::map< COLLADAFW::UniqueId, MaterialNumber> UniqueMaterialNumberMap;
@@ -239,6 +252,9 @@ namespace DAE23ds
 		list contains more than one item if the object is a mesh that needed to be split.*/
 		InstanceGeometryObjectIdMap mInstanceGeometryObjectIdMap;
 
+		/** Guards mInstanceGeometryObjectIdMap, which is filled by the mesh writer threads.*/
+		std::mutex mInstanceGeometryObjectIdMapMutex;
+
 		UniqueIdFWMaterialMap mUniqueIdFWMaterialMap;
 		UniqueIdFWImageMap mUniqueIdFWImageMap;
 		UniqueIdFWEffectMap mUniqueIdFWEffectMap;
@@ -258,10 +274,59 @@ namespace DAE23ds
 		/** The Material number of the next material that will be exported.*/
 		MaterialNumber mNextMaterialNumber;
 
+		/** If true, the document is parsed only once. The meshes are retained during the first run and 
+		written from mRetainedMeshes, instead of being loaded again in a second run.*/
+		bool mParseOnce;
+
+		/** The maximum number of bytes of mesh data retained in mRetainedMeshes, 0 for no limit.*/
+		size_t mRetainedMeshesMemoryLimit;
+
+		/** The number of bytes of mesh data currently retained in mRetainedMeshes.*/
+		size_t mRetainedMeshesMemory;
+
+		/** True, if the meshes exceeded mRetainedMeshesMemoryLimit. The retained meshes have been released
+		and the geometries are loaded in a second run.*/
+		bool mRetainedMeshesDropped;
+
+		/** Compact copies of the meshes parsed at the first run, if parsing only once. They contain only
+		the data required to write the .3ds file.*/
+		MeshList mRetainedMeshes;
+
+		/** The number of threads meshes are converted by. 1 converts them on the loading thread, 0 uses
+		one thread per hardware thread.*/
+		size_t mThreadCount;
+
+		/** The pool the meshes are passed to during the geometry run, 0 if they are written on the loading thread.*/
+		MeshWriterPool* mMeshWriterPool;
+
 	public:
 		Writer( const COLLADABU::URI& inputFile, const COLLADABU::URI& outputFile, bool applyTransformationsToMeshes );
 		virtual ~Writer();
 
+		/** If true, the document is parsed only once and the meshes are kept in memory until the scene 
+		graph is known. Otherwise the document is parsed a second time to write the meshes, which is the
+		default.*/
+		void setParseOnce( bool parseOnce ) { mParseOnce = parseOnce; }
+
+		/** Returns true, if the document is parsed only once.*/
+		bool getParseOnce() const { return mParseOnce; }
+
+		/** Sets the maximum number of bytes of mesh data kept in memory, if parsing only once. If the
+		meshes of a document need more, they are released and the document is parsed a second time. 0, 
+		the default, means no limit.*/
+		void setRetainedMeshesMemoryLimit( size_t memoryLimit ) { mRetainedMeshesMemoryLimit = memoryLimit; }
+
+		/** Returns the maximum number of bytes of mesh data kept in memory, if parsing only once.*/
+		size_t getRetainedMeshesMemoryLimit() const { return mRetainedMeshesMemoryLimit; }
+
+		/** Sets the number of threads the meshes are converted by. They are written to the file in 
+		document order, regardless of the number of threads. 1, the default, converts them on the loading
+		thread, 0 uses one thread per hardware thread.*/
+		void setThreadCount( size_t threadCount ) { mThreadCount = threadCount; }
+
+		/** Returns the number of threads the meshes are converted by.*/
+		size_t getThreadCount() const { return mThreadCount; }
+
 	public:
 		static void reportError(const String& method, const String& message, Severity severity);
 
@@ -353,13 +418,13 @@ namespace DAE23ds
 		static bool compare(const GeometryMaterialBinding& lhs, const GeometryMaterialBinding& rhs);
 
 		/** Returns the string representation of ObjectId @a objectId. This representation is used as the name of the object.
-		Do not use in threads!!!!
+		The returned string is overwritten by the next call on the same thread.
 		*/
 		static const char* calculateObjectNameFromObjectId( const ObjectId& objectId);
 
 		/** Returns the string representation of MaterialNumber @a materialNumber. This representation is used as 
 		the name of the material.
-		Do not use in threads!!!!
+		The returned string is overwritten by the next call on the same thread.
 		*/
 		static const char* calculateMaterialNameFromMaterialNumer( const MaterialNumber& materialNumber);
 
@@ -393,6 +458,9 @@ namespace DAE23ds
 		list contains more than one item if the mesh needed to be split.*/
 		InstanceGeometryObjectIdMap& getInstanceGeometryObjectIdMap() { return mInstanceGeometryObjectIdMap; }
 
+		/** Guards the map returned by getInstanceGeometryObjectIdMap().*/
+		std::mutex& getInstanceGeometryObjectIdMapMutex() { return mInstanceGeometryObjectIdMapMutex; }
+
 		const COLLADABU::URI& getInputFile() const { return mInputFile; }
 
 		const COLLADABU::URI& getOutputFile() const { return mOutputFile; }
@@ -454,6 +522,27 @@ namespace DAE23ds
 
 		bool writeHeader( ChunkLength sceneGraphLength );
 
+		/** Adds a compact copy of @a mesh to mRetainedMeshes. If the memory limit is exceeded, all 
+		retained meshes are released.*/
+		void retainMesh( const COLLADAFW::Mesh* mesh );
+
+		/** Writes @a mesh, directly or, if there is one, through mMeshWriterPool. If @a isRetained is 
+		false, the mesh is deleted by the loader after this call and the pool gets a compact copy of it.
+		@return True on succeeded, false otherwise.*/
+		bool writeMesh( const COLLADAFW::Mesh* mesh, bool isRetained );
+
+		/** Writes all meshes in mRetainedMeshes.
+		@return True on succeeded, false otherwise.*/
+		bool writeRetainedMeshes();
+
+		/** Deletes all meshes in mRetainedMeshes.*/
+		void releaseRetainedMeshes();
+
+		/** Creates a copy of @a mesh that contains only the positions and, of each mesh primitive, the 
+		position indices, vertex counts and material id. The number of bytes of the copied data is added
+		to @a byteCount.*/
+		static COLLADAFW::Mesh* createCompactMeshCopy( const COLLADAFW::Mesh* mesh, size_t& byteCount );
+
 		template<class NumberType, char prefix>
 		static const char* calculateNameFromNumber( const NumberType& number);
 	};
@@ -72,12 +72,14 @@ namespace DAE23ds
 	//------------------------------
 	void BaseWriter::addInstanceGeometryObjectId( const Writer::InstanceGeometryIdentifier& instanceGeometryIdentifier, const Writer::ObjectId& objectId )
 	{
+		std::lock_guard<std::mutex> lock( mWriter->getInstanceGeometryObjectIdMapMutex() );
 		mWriter->getInstanceGeometryObjectIdMap()[instanceGeometryIdentifier].push_back( objectId );
 	}
 
 	//------------------------------
 	const Writer::ObjectIdList& BaseWriter::getInstanceGeometryObjectIds( const Writer::InstanceGeometryIdentifier& instanceGeometryIdentifier )
 	{
+		std::lock_guard<std::mutex> lock( mWriter->getInstanceGeometryObjectIdMapMutex() );
 		return mWriter->getInstanceGeometryObjectIdMap()[instanceGeometryIdentifier];
 	}
 
@@ -182,6 +184,14 @@ namespace DAE23ds
 		return nextObjectId;
 	}
 
+	//------------------------------
+	Writer::ObjectId BaseWriter::getAndIncreaseNextObjectId( size_t objectsCount ) const
+	{
+		Writer::ObjectId nextObjectId = mWriter->getNextObjectId();
+		mWriter->setNextObjectId( nextObjectId + objectsCount );
+		return nextObjectId;
+	}
+
 	//------------------------------
 	MaterialNumber BaseWriter::getAndIncreaseNextMaterialNumber() const
 	{
@@ -22,15 +22,18 @@ namespace DAE23ds
 		: BaseWriter(writer3ds)
 		, mMeshData(meshData)
 		, mGeometryMaterialBindingSet( Writer::compare )
+		, mObjectsCount(0)
 	{
 	}
 
 	MeshBase::MeshBase( Writer* writer3ds )
 		: BaseWriter(writer3ds)
 		, mGeometryMaterialBindingSet( Writer::compare )
+		, mObjectsCount(0)
 	{
 		mMeshData.positionsCount = 0;
 		mMeshData.trianglesCount = 0;
+		mMeshData.objectsCount = 0;
 	}
 
 	//------------------------------
@@ -147,6 +150,9 @@ namespace DAE23ds
 		data.fullBlocksCount = fullBlockCount;
 		data.remainingTriangles = remainingTriangles;
 
+		if ( !alreadyUsingInstance || getApplyTransformationsToMeshes() )
+			mObjectsCount += blockCount;
+
 		return writeMeshIntoMultipleObjects( instanceGeometryInfo, data, alreadyUsingInstance );
 	}
 
@@ -178,6 +184,9 @@ namespace DAE23ds
 		data.triangularMeshLength = triangularMeshLength;
 		data.verticesLength = verticesLength;
 
+		if ( !alreadyUsingInstance || getApplyTransformationsToMeshes() )
+			mObjectsCount++;
+
 		return writeMeshIntoOneObject( instanceGeometryInfo, data, alreadyUsingInstance );
 	}
 
@@ -36,6 +36,7 @@ namespace DAE23ds
 		meshData.trianglesCount = meshAccessor.getTrianglesCount();
 		meshData.positionsCount = mMesh->getPositions().getValuesCount();
 		meshData.name = mMesh->getName();
+		meshData.objectsCount = 0;
 		addMeshData( meshData );
 		return true;
 	}
@@ -25,10 +25,11 @@ namespace DAE23ds
 	bool multiplyMeshes = true;
 
 	//------------------------------
-	MeshWriter::MeshWriter( Writer* writer3ds, const COLLADAFW::Mesh* mesh )
+	MeshWriter::MeshWriter( Writer* writer3ds, const COLLADAFW::Mesh* mesh, Common::Buffer& buffer, Writer::ObjectId firstObjectId )
 		: MeshBase(writer3ds)
 		, mMesh(mesh)
-		, mBuffer(getBuffer())
+		, mBuffer(buffer)
+		, mNextObjectId(firstObjectId)
 		, mMeshAccessor(mesh)
 		, mMeshPositions( mesh->getPositions() )
 		, mMeshNormals( mesh->getNormals() )
@@ -40,6 +41,7 @@ namespace DAE23ds
 		meshData.trianglesCount = mMeshAccessor.getTrianglesCount();
 		meshData.positionsCount = mMeshPositions.getValuesCount();
 		meshData.name = mesh->getName();
+		meshData.objectsCount = 0;
 		setMeshData(meshData);
 	}
 
@@ -112,7 +114,7 @@ namespace DAE23ds
 		mBuffer.copyToBuffer(EDIT_OBJECT);
 		mBuffer.copyToBuffer(editObjectLength);
 
-		Writer::ObjectId objectId = getAndIncreaseNextObjectId();
+		Writer::ObjectId objectId = mNextObjectId++;
 		const char* meshName3ds = Writer::calculateObjectNameFromObjectId( objectId );
 		mBuffer.copyToBuffer(meshName3ds, Writer::getObjectNameLength());
 		addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
@@ -165,7 +167,7 @@ namespace DAE23ds
 			mBuffer.copyToBuffer(EDIT_OBJECT);
 			mBuffer.copyToBuffer(data.editObjectLength);
 
-			Writer::ObjectId objectId = getAndIncreaseNextObjectId();
+			Writer::ObjectId objectId = mNextObjectId++;
 			const char* meshName3ds = Writer::calculateObjectNameFromObjectId( objectId );
 			mBuffer.copyToBuffer(meshName3ds, Writer::getObjectNameLength());
 			addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
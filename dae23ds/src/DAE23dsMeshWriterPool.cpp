@@ -0,0 +1,172 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of dae23ds.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "DAE23dsStableHeaders.h"
+#include "DAE23dsMeshWriterPool.h"
+#include "DAE23dsMeshWriter.h"
+
+#include "CommonBuffer.h"
+#include "CommonIBufferFlusher.h"
+
+#include "COLLADAFWMesh.h"
+
+#include <functional>
+
+
+namespace DAE23ds
+{
+
+	/** Size of the buffer each mesh is written through.*/
+	static const size_t JOB_BUFFER_SIZE = 64*1024;
+
+	/** Number of jobs per worker thread, that may be pending before adding a mesh blocks.*/
+	static const size_t PENDING_JOBS_PER_THREAD = 4;
+
+
+	/** Appends all data received to a vector.*/
+	class VectorBufferFlusher : public Common::IBufferFlusher
+	{
+	private:
+		std::vector<char>& mData;
+
+	public:
+		VectorBufferFlusher( std::vector<char>& data ) : mData(data) {}
+		virtual ~VectorBufferFlusher() {}
+
+		virtual bool receiveData( const char* buffer, size_t length )
+		{
+			mData.insert( mData.end(), buffer, buffer + length );
+			return true;
+		}
+
+		virtual bool flush() { return true; }
+
+		// marks are not used by the mesh writer
+		virtual void startMark() {}
+		virtual MarkId endMark() { return INVALID_ID; }
+		virtual bool jumpToMark( MarkId markId, bool keepMarkId = false ) { return false; }
+
+		virtual int getError() const { return 0; }
+	};
+
+
+	//------------------------------
+	MeshWriterPool::MeshWriterPool( Writer* writer3ds, size_t threadCount )
+		: BaseWriter(writer3ds)
+		, mMaxPendingJobsCount(0)
+		, mSucceeded(true)
+		, mThreadPool(threadCount)
+	{
+		mMaxPendingJobsCount = PENDING_JOBS_PER_THREAD * mThreadPool.getThreadCount();
+	}
+
+	//------------------------------
+	MeshWriterPool::~MeshWriterPool()
+	{
+		mThreadPool.waitForAllTasks();
+
+		JobQueue::const_iterator it = mJobs.begin();
+		for ( ; it != mJobs.end(); ++it )
+		{
+			deleteJob( *it );
+		}
+	}
+
+	//------------------------------
+	bool MeshWriterPool::addMesh( const COLLADAFW::Mesh* mesh, bool takeOwnership )
+	{
+		Job* job = new Job();
+		job->mesh = mesh;
+		job->ownsMesh = takeOwnership;
+		job->firstObjectId = getAndIncreaseNextObjectId( getMeshData(mesh->getUniqueId()).objectsCount );
+		job->finished = false;
+		job->succeeded = false;
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mJobs.push_back( job );
+		}
+		mThreadPool.addTask( std::bind( &MeshWriterPool::writeMesh, this, job ) );
+
+		return copyFinishedJobs( mMaxPendingJobsCount );
+	}
+
+	//------------------------------
+	bool MeshWriterPool::finish()
+	{
+		return copyFinishedJobs( 0 );
+	}
+
+	//------------------------------
+	void MeshWriterPool::writeMesh( Job* job )
+	{
+		// the data is written outside the lock, nobody else accesses it before finished is set
+		bool succeeded;
+		{
+			VectorBufferFlusher flusher( job->data );
+			Common::Buffer buffer( JOB_BUFFER_SIZE, &flusher );
+			MeshWriter meshWriter( getWriter(), job->mesh, buffer, job->firstObjectId );
+			succeeded = meshWriter.handle();
+			succeeded = buffer.flushBuffer() && succeeded;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			job->succeeded = succeeded;
+			job->finished = true;
+		}
+		mJobFinished.notify_all();
+	}
+
+	//------------------------------
+	bool MeshWriterPool::copyFinishedJobs( size_t maxPendingJobsCount )
+	{
+		for ( ;; )
+		{
+			Job* job = 0;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				if ( mJobs.empty() )
+					break;
+
+				job = mJobs.front();
+				if ( !job->finished )
+				{
+					if ( mJobs.size() <= maxPendingJobsCount )
+						break;
+
+					while ( !job->finished )
+						mJobFinished.wait(lock);
+				}
+				mJobs.pop_front();
+			}
+
+			if ( !job->succeeded )
+			{
+				mSucceeded = false;
+			}
+			else if ( !job->data.empty() )
+			{
+				getBuffer().copyToBuffer( &job->data[0], job->data.size() );
+			}
+			deleteJob( job );
+		}
+		return mSucceeded;
+	}
+
+	//------------------------------
+	void MeshWriterPool::deleteJob( Job* job )
+	{
+		if ( job->ownsMesh )
+			delete job->mesh;
+		delete job;
+	}
+
+} // namespace DAE23ds
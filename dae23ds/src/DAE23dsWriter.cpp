@@ -11,6 +11,7 @@
 #include "DAE23dsStableHeaders.h"
 #include "DAE23dsWriter.h"
 #include "DAE23dsMeshWriter.h"
+#include "DAE23dsMeshWriterPool.h"
 #include "DAE23dsMeshHandler.h"
 #include "DAE23dsMeshLengthCalculator.h"
 #include "DAE23dsSceneGraphWriter.h"
@@ -22,6 +23,10 @@
 
 #include "COLLADAFWRoot.h"
 #include "COLLADAFWGeometry.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWTriangles.h"
+#include "COLLADAFWTristrips.h"
+#include "COLLADAFWTrifans.h"
 #include "COLLADAFWNode.h"
 #include "COLLADAFWVisualScene.h"
 #include "COLLADAFWInstanceGeometry.h"
@@ -79,12 +84,19 @@ namespace DAE23ds
 		, mObjectAndMaterialBlockLength(0)
 		, mNextObjectId( RESERVED_OBJECTIDS_COUNT )
 		, mNextMaterialNumber( RESERVED_MATERIALNUMBERS_COUNT )
+		, mParseOnce(false)
+		, mRetainedMeshesMemoryLimit(0)
+		, mRetainedMeshesMemory(0)
+		, mRetainedMeshesDropped(false)
+		, mThreadCount(1)
+		, mMeshWriterPool(0)
 	{
 	}
 
 	//--------------------------------------------------------------------
 	Writer::~Writer()
 	{
+		releaseRetainedMeshes();
 		delete mVisualScene;
 	}
 
@@ -144,7 +156,25 @@ namespace DAE23ds
 
 		// load and write geometries
 		mCurrentRun = GEOMETRY_RUN;
-		if ( !root.loadDocument(mInputFile.toNativePath()) )
+		if ( mThreadCount != 1 )
+			mMeshWriterPool = new MeshWriterPool( this, mThreadCount );
+
+		bool success = true;
+		if ( mParseOnce && !mRetainedMeshesDropped )
+			success = writeRetainedMeshes();
+		else
+			success = root.loadDocument(mInputFile.toNativePath());
+
+		if ( mMeshWriterPool )
+		{
+			// the pool might still use the retained meshes
+			success = mMeshWriterPool->finish() && success;
+			delete mMeshWriterPool;
+			mMeshWriterPool = 0;
+		}
+		releaseRetainedMeshes();
+
+		if ( !success )
 			return false;
 
 		SceneGraphWriter sceneGraphWriter(this, mVisualScene, mLibraryNodesList);
@@ -156,12 +186,14 @@ namespace DAE23ds
 	//--------------------------------------------------------------------
 	void Writer::calculateMeshesLength()
 	{
-		MeshDataMap::const_iterator it = mMeshDataMap.begin();
+		MeshDataMap::iterator it = mMeshDataMap.begin();
 		for ( ; it != mMeshDataMap.end(); ++it)
 		{
-			const MeshData& meshData = it->second;
+			MeshData& meshData = it->second;
 			MeshLengthCalculator meshLengthCalculator( this, meshData );
 			meshLengthCalculator.handle();
+			// used to reserve the object ids of the mesh, if it is written on another thread
+			meshData.objectsCount = meshLengthCalculator.getObjectsCount();
 		}
 	}
 
@@ -261,13 +293,14 @@ namespace DAE23ds
 		case SCENEGRAPH_RUN:
 			{
 				MeshHandler meshHandler( this, (COLLADAFW::Mesh*)geometry );
+				if ( mParseOnce && !mRetainedMeshesDropped )
+					retainMesh( (const COLLADAFW::Mesh*)geometry );
 				return meshHandler.handle();
 				break;
 			}
 		case GEOMETRY_RUN:
 			{
-				MeshWriter meshWriter( this, (COLLADAFW::Mesh*)geometry );
-				return meshWriter.handle();
+				return writeMesh( (const COLLADAFW::Mesh*)geometry, false );
 				break;
 			}
 		default:
@@ -275,6 +308,140 @@ namespace DAE23ds
 		}
 	}
 
+	//--------------------------------------------------------------------
+	void Writer::retainMesh( const COLLADAFW::Mesh* mesh )
+	{
+		COLLADAFW::Mesh* meshCopy = createCompactMeshCopy( mesh, mRetainedMeshesMemory );
+		mRetainedMeshes.push_back( meshCopy );
+
+		if ( (mRetainedMeshesMemoryLimit != 0) && (mRetainedMeshesMemory > mRetainedMeshesMemoryLimit) )
+		{
+			// fall back to loading the geometries a second time
+			reportError("Writer::retainMesh", "Meshes exceed the memory limit. The document will be parsed twice.", SEVERITY_INFORMATION);
+			releaseRetainedMeshes();
+			mRetainedMeshesDropped = true;
+		}
+	}
+
+	//--------------------------------------------------------------------
+	bool Writer::writeMesh( const COLLADAFW::Mesh* mesh, bool isRetained )
+	{
+		if ( mMeshWriterPool )
+		{
+			if ( isRetained )
+				return mMeshWriterPool->addMesh( mesh, false );
+
+			size_t byteCount = 0;
+			return mMeshWriterPool->addMesh( createCompactMeshCopy( mesh, byteCount ), true );
+		}
+
+		MeshWriter meshWriter( this, mesh, getBuffer(), mNextObjectId );
+		bool success = meshWriter.handle();
+		mNextObjectId = meshWriter.getNextMeshObjectId();
+		return success;
+	}
+
+	//--------------------------------------------------------------------
+	bool Writer::writeRetainedMeshes()
+	{
+		MeshList::const_iterator it = mRetainedMeshes.begin();
+		for ( ; it != mRetainedMeshes.end(); ++it )
+		{
+			if ( !writeMesh( *it, true ) )
+				return false;
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	void Writer::releaseRetainedMeshes()
+	{
+		MeshList::const_iterator it = mRetainedMeshes.begin();
+		for ( ; it != mRetainedMeshes.end(); ++it )
+		{
+			delete *it;
+		}
+		mRetainedMeshes.clear();
+		mRetainedMeshesMemory = 0;
+	}
+
+	//--------------------------------------------------------------------
+	COLLADAFW::Mesh* Writer::createCompactMeshCopy( const COLLADAFW::Mesh* mesh, size_t& byteCount )
+	{
+		COLLADAFW::Mesh* meshCopy = new COLLADAFW::Mesh( mesh->getUniqueId() );
+		meshCopy->setName( mesh->getName() );
+
+		const COLLADAFW::MeshVertexData& positions = mesh->getPositions();
+		COLLADAFW::MeshVertexData& positionsCopy = meshCopy->getPositions();
+		positionsCopy.setType( positions.getType() );
+		if ( positions.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT )
+		{
+			positionsCopy.appendValues( *positions.getFloatValues() );
+			byteCount += positions.getValuesCount() * sizeof(float);
+		}
+		else if ( positions.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE )
+		{
+			positionsCopy.appendValues( *positions.getDoubleValues() );
+			byteCount += positions.getValuesCount() * sizeof(double);
+		}
+
+		const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mesh->getMeshPrimitives();
+		COLLADAFW::MeshPrimitiveArray& meshPrimitivesCopy = meshCopy->getMeshPrimitives();
+		meshPrimitivesCopy.reserve( meshPrimitives.getCount() );
+		for ( size_t i = 0, count = meshPrimitives.getCount(); i < count; ++i)
+		{
+			const COLLADAFW::MeshPrimitive* meshPrimitive = meshPrimitives[i];
+			const COLLADAFW::UniqueId& uniqueId = meshPrimitive->getUniqueId();
+
+			// the mesh writer only needs the vertex counts of strips and fans
+			const COLLADAFW::UIntValuesArray* faceVertexCountArray = 0;
+			COLLADAFW::UIntValuesArray* faceVertexCountArrayCopy = 0;
+			COLLADAFW::MeshPrimitive* meshPrimitiveCopy = 0;
+			switch ( meshPrimitive->getPrimitiveType() )
+			{
+			case COLLADAFW::MeshPrimitive::TRIANGLES:
+				meshPrimitiveCopy = new COLLADAFW::Triangles( uniqueId );
+				break;
+			case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
+				{
+					COLLADAFW::Tristrips* tristrips = new COLLADAFW::Tristrips( uniqueId );
+					faceVertexCountArray = &((const COLLADAFW::Tristrips*)meshPrimitive)->getGroupedVerticesVertexCountArray();
+					faceVertexCountArrayCopy = &tristrips->getGroupedVerticesVertexCountArray();
+					meshPrimitiveCopy = tristrips;
+					break;
+				}
+			case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
+				{
+					COLLADAFW::Trifans* trifans = new COLLADAFW::Trifans( uniqueId );
+					faceVertexCountArray = &((const COLLADAFW::Trifans*)meshPrimitive)->getGroupedVerticesVertexCountArray();
+					faceVertexCountArrayCopy = &trifans->getGroupedVerticesVertexCountArray();
+					meshPrimitiveCopy = trifans;
+					break;
+				}
+			default:
+				// not written into the .3ds file, only the type is needed to report it
+				meshPrimitiveCopy = new COLLADAFW::MeshPrimitive( uniqueId, meshPrimitive->getPrimitiveType() );
+				break;
+			}
+
+			meshPrimitiveCopy->setMaterialId( meshPrimitive->getMaterialId() );
+
+			const COLLADAFW::UIntValuesArray& positionIndices = meshPrimitive->getPositionIndices();
+			meshPrimitiveCopy->getPositionIndices().appendValues( positionIndices );
+			byteCount += positionIndices.getCount() * sizeof(unsigned int);
+
+			if ( faceVertexCountArray )
+			{
+				faceVertexCountArrayCopy->appendValues( *faceVertexCountArray );
+				byteCount += faceVertexCountArray->getCount() * sizeof(unsigned int);
+			}
+
+			meshPrimitivesCopy.append( meshPrimitiveCopy );
+		}
+
+		return meshCopy;
+	}
+
 	//--------------------------------------------------------------------
 	bool Writer::writeMaterial( const COLLADAFW::Material* material )
 	{
@@ -468,7 +635,7 @@ namespace DAE23ds
 	{
 		// we do not support to big meshes here
 		assert(number < 100000);
-		static char buffer[OBJECT_NAME_LENGTH];
+		static thread_local char buffer[OBJECT_NAME_LENGTH];
 		char* p = buffer;
 		*(p++) = prefix;
 		if ( number < 1000000) *(p++) = '0';
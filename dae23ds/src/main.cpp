@@ -17,6 +17,8 @@
 #include "COLLADABUURI.h"
 
 #include <iostream>
+#include <string.h>
+#include <stdlib.h>
 #include <sys/types.h>
 #include <sys/timeb.h>
 
@@ -37,6 +39,28 @@ int main(int argc, char* argv[])
 
 //		DAE23ds::Writer writer( COLLADABU::URI::nativePathToUri(inputFile), COLLADABU::URI::nativePathToUri(outputFile), false);
 		DAE23ds::Writer writer( COLLADABU::URI::nativePathToUri(inputFile), COLLADABU::URI::nativePathToUri(outputFile), true);
+
+		for ( int i = 3; i < argc; ++i )
+		{
+			if ( strcmp(argv[i], "-parseonce") == 0 )
+			{
+				writer.setParseOnce(true);
+			}
+			else if ( (strcmp(argv[i], "-threads") == 0) && (i + 1 < argc) )
+			{
+				writer.setThreadCount( (size_t)atol(argv[++i]) );
+			}
+			else if ( (strcmp(argv[i], "-memorylimit") == 0) && (i + 1 < argc) )
+			{
+				// limit in megabytes
+				writer.setRetainedMeshesMemoryLimit( (size_t)atol(argv[++i]) * 1024 * 1024 );
+			}
+			else
+			{
+				std::cout << "Unknown option " << argv[i] << std::endl;
+			}
+		}
+
 		writer.write();
 
 
@@ -53,6 +77,9 @@ int main(int argc, char* argv[])
 	{
 		std::cout << "You must specify an input and output file name" << std::endl;
 
-		std::cout << "Usage: dae23ds <inputfilename> <outputfilename>" << std::endl;
+		std::cout << "Usage: dae23ds <inputfilename> <outputfilename> [-parseonce [-memorylimit <megabytes>]] [-threads <count>]" << std::endl;
+		std::cout << "  -parseonce    Parse the input file only once and keep the meshes in memory" << std::endl;
+		std::cout << "  -memorylimit  Parse the input file twice, if the meshes need more memory" << std::endl;
+		std::cout << "  -threads      Number of threads the meshes are converted by, 0 for one per core" << std::endl;
 	}
 }
\ No newline at end of file
@@ -29,6 +29,8 @@ namespace DAE2Ogre
 
 		static void reportError(const String& method, const String& message, OgreWriter::Severity severity);
 
+		OgreWriter* getOgreWriter() const { return mOgreWriter; }
+
 		const OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap& getGeometryUniqueIdInstanceGeometryInfoMap();
 		
 		void addGeometryUniqueIdInstanceGeometryInfoPair(const COLLADAFW::UniqueId& geoId, const OgreWriter::InstanceGeometryInfo& instanceGeoInfo);
@@ -21,7 +21,7 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWArrayPrimitiveType.h"
 #include "COLLADAFWMeshVertexData.h"
 
-#include <map>
+#include <vector>
 
 namespace COLLADAFW
 {
@@ -42,19 +42,26 @@ namespace DAE2Ogre
 			unsigned int normalIndex;
 			unsigned int textureIndex;
 			unsigned int colorIndex;
-			bool operator<(const Tuple& rhs) const;
+			bool operator==(const Tuple& rhs) const;
+			size_t calculateHash() const;
 		};
 
 		typedef COLLADAFW::ArrayPrimitiveType<float> FloatList;
 		typedef COLLADAFW::ArrayPrimitiveType<double> DoubleList;
 		typedef COLLADAFW::ArrayPrimitiveType<int> IntList;
 		typedef COLLADAFW::ArrayPrimitiveType<unsigned int> UIntList;
-		typedef std::map<Tuple, int> TupleIndexMap;
+		typedef std::vector<Tuple> TupleList;
+
+		/** Open addressing hash table of tuple indices, -1 marks an empty slot.*/
+		typedef std::vector<int> TupleIndexTable;
 		typedef std::vector<String> StringList;
 
 	private:
 		const COLLADAFW::Mesh* mMesh;
-		TupleIndexMap mTupleMap;
+		/** The tuples of the current sub mesh, in the order of their indices.*/
+		TupleList mTuples;
+		TupleIndexTable mTupleIndexTable;
+		size_t mTupleIndexTableMask;
 		int mNextTupleIndex;
 		size_t mMeshSize;
 		size_t mSubmeshCount;
@@ -78,6 +85,9 @@ namespace DAE2Ogre
 		DoubleList mOgreColors;
 		UIntList mOgreIndices;
 
+		/** The indices into the index arrays of the current mesh primitive, three for each triangle.*/
+		UIntList mCornerIndices;
+
 		bool mHasNormals;
 		bool mHasUVCoords;
 
@@ -94,8 +104,17 @@ namespace DAE2Ogre
         /** Destructor. */
 		virtual ~MeshWriter();
 
+		/** Writes the mesh into the output file.*/
 		bool write();
 
+		/** Writes the mesh into @a file, which must be opened for writing in binary mode and seekable.
+		The file is not closed.*/
+		bool write( FILE* file );
+
+		/** Creates a copy of @a mesh that contains all the data the mesh writer uses. Used to write
+		meshes after the loader has deleted them.*/
+		static COLLADAFW::Mesh* createMeshCopy( const COLLADAFW::Mesh* mesh );
+
 	private:
 
         /** Disable default copy ctor. */
@@ -108,6 +127,18 @@ namespace DAE2Ogre
 
 		void addTupleIndex( const Tuple& tuple);
 
+		/** Clears the tuples and sizes the hash table for a sub mesh with @a cornerCount corners.*/
+		void initializeTupleIndexTable( size_t cornerCount );
+
+		/** Fills @a cornerIndices with the indices into the index arrays of @a meshPrimitive, that form 
+		a triangle list. Polygons and polylists are triangulated as fans, holes are ignored. Lines are 
+		not supported and result in an empty list.*/
+		static void triangulate( const COLLADAFW::MeshPrimitive* meshPrimitive, UIntList& cornerIndices );
+
+		/** Reorders the triangles of the triangle list @a indices to improve the use of the post
+		transform vertex cache, using Tom Forsyth's linear speed vertex cache optimization.*/
+		static void optimizeVertexCacheOrder( uint32* indices, size_t indexCount, size_t vertexCount );
+
 		void writeGeometry( );
 		size_t getVertexSizeInByte() const;
 		void writeVertexElement( unsigned short source, size_t offset, Ogre::VertexElementType type, Ogre::VertexElementSemantic semantic, unsigned short index );
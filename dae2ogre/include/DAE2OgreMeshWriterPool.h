@@ -0,0 +1,115 @@
+/*
+Copyright (c) 2009 NetAllied Systems GmbH
+
+This file is part of dae2ogre.
+
+Licensed under the MIT Open Source License, 
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __DAE2OGRE_MESHWRITERPOOL_H__
+#define __DAE2OGRE_MESHWRITERPOOL_H__
+
+#include "DAE2OgrePrerequisites.h"
+#include "DAE2OgreBaseWriter.h"
+
+#include "COLLADABUThreadPool.h"
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <cstdio>
+
+namespace COLLADAFW
+{
+	class Mesh;
+}
+
+namespace DAE2Ogre
+{
+
+	/** Converts meshes on worker threads, each into a temporary file. The temporary files are copied
+	into the output file in the order the meshes have been added, so the output does not depend on the
+	number of threads.*/
+	class MeshWriterPool : public BaseWriter
+	{
+	private:
+		/** A mesh added to the pool and the file it has been written to.*/
+		struct Job
+		{
+			/** Copy of the mesh, owned by the job.*/
+			const COLLADAFW::Mesh* mesh;
+
+			/** The temporary file the mesh has been written to.*/
+			FILE* file;
+
+			bool finished;
+			bool succeeded;
+		};
+
+		/** The jobs not yet copied into the output file, in the order they have been added.*/
+		typedef std::deque<Job*> JobQueue;
+
+	private:
+		JobQueue mJobs;
+
+		/** The number of jobs that may be pending before addMesh() blocks.*/
+		size_t mMaxPendingJobsCount;
+
+		/** False, if writing one of the meshes failed.*/
+		bool mSucceeded;
+
+		/** Guards the finished flag of the jobs and mJobs.*/
+		std::mutex mMutex;
+
+		/** Signaled when a job has been finished.*/
+		std::condition_variable mJobFinished;
+
+		/** The worker threads. Declared last, to be destroyed before the members used by the workers.*/
+		COLLADABU::ThreadPool mThreadPool;
+
+	public:
+
+        /** Constructor.
+		@param threadCount The number of worker threads, 0 for one per hardware thread.*/
+		MeshWriterPool( OgreWriter* ogreWriter, size_t threadCount );
+
+        /** Destructor. */
+		virtual ~MeshWriterPool();
+
+		/** Adds a copy of @a mesh to be written by the next idle worker thread and copies the files of 
+		the jobs finished so far. Blocks, if too many meshes are pending.
+		@return False, if writing a mesh failed, true otherwise.*/
+		bool addMesh( const COLLADAFW::Mesh* mesh );
+
+		/** Waits for all meshes to be written and copies their files into the output file.
+		@return False, if writing a mesh failed, true otherwise.*/
+		bool finish();
+
+	private:
+
+        /** Disable default copy ctor. */
+		MeshWriterPool( const MeshWriterPool& pre );
+
+        /** Disable default assignment operator. */
+		const MeshWriterPool& operator= ( const MeshWriterPool& pre );
+
+		/** Writes the mesh of @a job into a temporary file. Executed by the worker threads.*/
+		void writeMesh( Job* job );
+
+		/** Copies the files of finished jobs at the front of the queue into the output file, waiting
+		for unfinished ones while more than @a maxPendingJobsCount jobs are pending.*/
+		bool copyFinishedJobs( size_t maxPendingJobsCount );
+
+		/** Copies the temporary file of @a job into the output file.*/
+		bool copyToOutputFile( Job* job );
+
+		/** Deletes @a job, its mesh and closes its file.*/
+		static void deleteJob( Job* job );
+
+	};
+
+} // namespace DAE2Ogre
+
+#endif // __DAE2OGRE_MESHWRITERPOOL_H__
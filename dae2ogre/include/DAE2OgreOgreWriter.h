@@ -32,6 +32,7 @@ namespace DAE2Ogre
 {
 
 	class BaseWriter;
+	class MeshWriterPool;
 
 	class OgreWriter : public COLLADAFW::IWriter
 	{
@@ -84,6 +85,12 @@ namespace DAE2Ogre
 		UniqueIdFWMaterialMap mUniqueIdFWMaterialMap;
 		UniqueIdFWImageMap mUniqueIdFWImageMap;
 		UniqueIdFWEffectMap mUniqueIdFWEffectMap;
+
+		/** The number of threads meshes are converted with, 0 for one per hardware thread.*/
+		size_t mThreadCount;
+
+		/** Converts the meshes during the geometry run, if more than one thread is used.*/
+		MeshWriterPool* mMeshWriterPool;
 	
 	public:
 		OgreWriter( const COLLADABU::URI& inputFile, const COLLADABU::URI& outputFile );
@@ -96,6 +103,13 @@ namespace DAE2Ogre
 
 		bool write();
 
+		/** Sets the number of threads meshes are converted with. 1 converts them on the loading 
+		thread, 0 uses one thread per hardware thread. The output does not depend on the number.*/
+		void setThreadCount( size_t threadCount ) { mThreadCount = threadCount; }
+
+		/** Returns the number of threads meshes are converted with.*/
+		size_t getThreadCount() const { return mThreadCount; }
+
 		/** Deletes the entire scene.
 		@param errorMessage A message containing informations about the error that occurred.
 		*/
@@ -20,6 +20,7 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWTriangles.h"
 #include "COLLADAFWTrifans.h"
 #include "COLLADAFWTristrips.h"
+#include "COLLADAFWPolygons.h"
 
 #include "COLLADABUPlatform.h"
 
@@ -27,14 +28,29 @@ http://www.opensource.org/licenses/mit-license.php
 #	include <windows.h>
 #endif
 
+#include <math.h>
+#include <algorithm>
+
 namespace DAE2Ogre
 {
 	String material("BaseWhite");
 
+	/** Smallest number of slots of the tuple index table.*/
+	static const size_t MIN_TUPLE_INDEX_TABLE_SIZE = 16;
+
+	/** Parameters of the vertex cache optimization. See Tom Forsyth, "Linear-Speed Vertex Cache 
+	Optimisation".*/
+	static const int VERTEX_CACHE_SIZE = 32;
+	static const float CACHE_DECAY_POWER = 1.5f;
+	static const float LAST_TRIANGLE_SCORE = 0.75f;
+	static const float VALENCE_BOOST_SCALE = 2.0f;
+	static const float VALENCE_BOOST_POWER = 0.5f;
+
     //------------------------------
 	MeshWriter::MeshWriter( OgreWriter* ogreWriter, const COLLADAFW::Mesh* mesh )
 		: BaseWriter(ogreWriter)
 		, mMesh(mesh)
+		, mTupleIndexTableMask(0)
 		, mNextTupleIndex(0)
 		, mMeshSize(0)
 		, mSubmeshCount(0)
@@ -51,6 +67,7 @@ namespace DAE2Ogre
 	    , mOgreUVCoordinates(FloatList::RELEASE_MEMORY)
 	    , mOgreColors(FloatList::RELEASE_MEMORY)
 	    , mOgreIndices(IntList::RELEASE_MEMORY)
+	    , mCornerIndices(UIntList::RELEASE_MEMORY)
 	{
 		 mVersion = "[MeshSerializer_v1.30]";
 		 calcMeshSize();
@@ -68,49 +85,47 @@ namespace DAE2Ogre
 	}
 
 	//------------------------------
-	bool MeshWriter::Tuple::operator<( const Tuple& rhs ) const
+	bool MeshWriter::Tuple::operator==( const Tuple& rhs ) const
 	{
-		if ( positionIndex < rhs.positionIndex )
-			return true;
-
-		if ( positionIndex > rhs.positionIndex )
-			return false;
-
-		if ( normalIndex < rhs.normalIndex )
-			return true;
-
-		if ( normalIndex > rhs.normalIndex )
-			return false;
-
-		if ( textureIndex < rhs.textureIndex )
-			return true;
-
-		if ( textureIndex > rhs.textureIndex )
-			return false;
-
-		if ( colorIndex < rhs.colorIndex )
-			return true;
-
-		if ( colorIndex > rhs.colorIndex )
-			return false;
+		return (positionIndex == rhs.positionIndex)
+			&& (normalIndex == rhs.normalIndex)
+			&& (textureIndex == rhs.textureIndex)
+			&& (colorIndex == rhs.colorIndex);
+	}
 
-		return false;
+	//------------------------------
+	size_t MeshWriter::Tuple::calculateHash() const
+	{
+		size_t hash = positionIndex;
+		hash ^= normalIndex + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		hash ^= textureIndex + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		hash ^= colorIndex + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		return hash;
 	}
 
 
 	//------------------------------
 	bool MeshWriter::write()
 	{
-		determineEndianness( ENDIAN_NATIVE );
-
 		const String path = getOutputFile().toNativePath();
-		mpfFile = fopen( path.c_str(), "wb" );
+		FILE* file = fopen( path.c_str(), "wb" );
 
-		if ( !mpfFile )
+		if ( !file )
 		{
 			return false;
 		}
 
+		bool success = write( file );
+		fclose( file );
+		return success;
+	}
+
+	//------------------------------
+	bool MeshWriter::write( FILE* file )
+	{
+		determineEndianness( ENDIAN_NATIVE );
+
+		mpfFile = file;
 
 		// Header
 		writeFileHeader();
@@ -160,8 +175,103 @@ namespace DAE2Ogre
 		setPos( filePos );
 		writeChunkHeader( Ogre::M_MESH, mMeshSize );
 		
-		fclose( mpfFile );
-		return true;
+		bool success = (ferror( mpfFile ) == 0);
+		mpfFile = 0;
+		return success;
+	}
+
+	//------------------------------
+	template<class VertexCountType>
+	static void copyGroupedVerticesVertexCountArray( const COLLADAFW::MeshPrimitive* meshPrimitive, COLLADAFW::MeshPrimitive* meshPrimitiveCopy )
+	{
+		typedef COLLADAFW::MeshPrimitiveWithFaceVertexCount<VertexCountType> PrimitiveWithFaceVertexCount;
+		const typename PrimitiveWithFaceVertexCount::VertexCountArray& faceVertexCountArray = ((const PrimitiveWithFaceVertexCount*)meshPrimitive)->getGroupedVerticesVertexCountArray();
+		((PrimitiveWithFaceVertexCount*)meshPrimitiveCopy)->getGroupedVerticesVertexCountArray().appendValues( faceVertexCountArray );
+	}
+
+	//------------------------------
+	static void copyMeshVertexData( const COLLADAFW::MeshVertexData& vertexData, COLLADAFW::MeshVertexData& vertexDataCopy )
+	{
+		// the mesh writer only uses the stride of the first input
+		String name;
+		size_t stride = 0;
+		if ( vertexData.getNumInputInfos() > 0 )
+		{
+			name = vertexData.getName(0);
+			stride = vertexData.getStride(0);
+		}
+
+		vertexDataCopy.setType( vertexData.getType() );
+		if ( vertexData.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT )
+			vertexDataCopy.appendValues( *vertexData.getFloatValues(), name, stride );
+		else if ( vertexData.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
+			vertexDataCopy.appendValues( *vertexData.getDoubleValues(), name, stride );
+	}
+
+	//------------------------------
+	COLLADAFW::Mesh* MeshWriter::createMeshCopy( const COLLADAFW::Mesh* mesh )
+	{
+		COLLADAFW::Mesh* meshCopy = new COLLADAFW::Mesh( mesh->getUniqueId() );
+		meshCopy->setName( mesh->getName() );
+
+		copyMeshVertexData( mesh->getPositions(), meshCopy->getPositions() );
+		copyMeshVertexData( mesh->getNormals(), meshCopy->getNormals() );
+		copyMeshVertexData( mesh->getUVCoords(), meshCopy->getUVCoords() );
+
+		const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mesh->getMeshPrimitives();
+		COLLADAFW::MeshPrimitiveArray& meshPrimitivesCopy = meshCopy->getMeshPrimitives();
+		meshPrimitivesCopy.reserve( meshPrimitives.getCount() );
+		for ( size_t i = 0, count = meshPrimitives.getCount(); i < count; ++i )
+		{
+			const COLLADAFW::MeshPrimitive* meshPrimitive = meshPrimitives[i];
+			const COLLADAFW::UniqueId& uniqueId = meshPrimitive->getUniqueId();
+
+			COLLADAFW::MeshPrimitive* meshPrimitiveCopy = 0;
+			switch ( meshPrimitive->getPrimitiveType() )
+			{
+			case COLLADAFW::MeshPrimitive::TRIANGLES:
+				meshPrimitiveCopy = new COLLADAFW::Triangles( uniqueId );
+				break;
+			case COLLADAFW::MeshPrimitive::POLYGONS:
+			case COLLADAFW::MeshPrimitive::POLYLIST:
+				meshPrimitiveCopy = new COLLADAFW::Polygons( uniqueId );
+				meshPrimitiveCopy->setPrimitiveType( meshPrimitive->getPrimitiveType() );
+				copyGroupedVerticesVertexCountArray<int>( meshPrimitive, meshPrimitiveCopy );
+				break;
+			case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
+				meshPrimitiveCopy = new COLLADAFW::Trifans( uniqueId );
+				copyGroupedVerticesVertexCountArray<unsigned int>( meshPrimitive, meshPrimitiveCopy );
+				break;
+			case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
+				meshPrimitiveCopy = new COLLADAFW::Tristrips( uniqueId );
+				copyGroupedVerticesVertexCountArray<unsigned int>( meshPrimitive, meshPrimitiveCopy );
+				break;
+			default:
+				// not triangulated, only the type is needed
+				meshPrimitiveCopy = new COLLADAFW::MeshPrimitive( uniqueId, meshPrimitive->getPrimitiveType() );
+				break;
+			}
+
+			meshPrimitiveCopy->setMaterialId( meshPrimitive->getMaterialId() );
+			meshPrimitiveCopy->getPositionIndices().appendValues( meshPrimitive->getPositionIndices() );
+			meshPrimitiveCopy->getNormalIndices().appendValues( meshPrimitive->getNormalIndices() );
+
+			// the mesh writer only uses the first set of uv coordinates
+			const COLLADAFW::IndexListArray& uVIndicesList = meshPrimitive->getUVCoordIndicesArray();
+			if ( !uVIndicesList.empty() )
+			{
+				const COLLADAFW::IndexList* uvIndices = uVIndicesList[0];
+				COLLADAFW::IndexList* uvIndicesCopy = new COLLADAFW::IndexList();
+				uvIndicesCopy->setSetIndex( uvIndices->getSetIndex() );
+				uvIndicesCopy->setStride( uvIndices->getStride() );
+				uvIndicesCopy->getIndices().appendValues( uvIndices->getIndices() );
+				meshPrimitiveCopy->appendUVCoordIndices( uvIndicesCopy );
+			}
+
+			meshPrimitivesCopy.append( meshPrimitiveCopy );
+		}
+
+		return meshCopy;
 	}
 
 	//-----------------------------------------------------------------------
@@ -224,13 +334,36 @@ namespace DAE2Ogre
 		//mMeshSize += calcEdgeListSize(mesh);
 	}
 
+	//------------------------------
+	void MeshWriter::initializeTupleIndexTable( size_t cornerCount )
+	{
+		// each corner adds at most one tuple, keep the table at most half full
+		size_t tableSize = MIN_TUPLE_INDEX_TABLE_SIZE;
+		while ( tableSize < 2 * cornerCount )
+			tableSize *= 2;
+
+		mTupleIndexTable.assign( tableSize, -1 );
+		mTupleIndexTableMask = tableSize - 1;
+		mTuples.clear();
+		mTuples.reserve( cornerCount );
+	}
+
 	//------------------------------
 	void MeshWriter::addTupleIndex( const Tuple& tuple )
 	{
-		TupleIndexMap::const_iterator it = mTupleMap.find(tuple);
-		if ( it == mTupleMap.end() )
+		size_t slot = tuple.calculateHash() & mTupleIndexTableMask;
+		int tupleIndex = mTupleIndexTable[slot];
+		while ( (tupleIndex >= 0) && !(mTuples[tupleIndex] == tuple) )
+		{
+			slot = (slot + 1) & mTupleIndexTableMask;
+			tupleIndex = mTupleIndexTable[slot];
+		}
+
+		if ( tupleIndex < 0 )
 		{
-			mOgreIndices.append( mTupleMap[tuple] = mNextTupleIndex++ );
+			mTupleIndexTable[slot] = mNextTupleIndex;
+			mTuples.push_back( tuple );
+			mOgreIndices.append( mNextTupleIndex++ );
 
 			if ( mMeshPositions.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
 			{
@@ -300,10 +433,260 @@ namespace DAE2Ogre
 		}
 		else
 		{
-			mOgreIndices.append(it->second);
+			mOgreIndices.append(tupleIndex);
 		}
 	}
 
+	//------------------------------
+	void MeshWriter::triangulate( const COLLADAFW::MeshPrimitive* meshPrimitive, UIntList& cornerIndices )
+	{
+		cornerIndices.clear();
+		size_t indexCount = meshPrimitive->getPositionIndices().getCount();
+
+		switch ( meshPrimitive->getPrimitiveType() )
+		{
+		case COLLADAFW::MeshPrimitive::TRIANGLES:
+			{
+				size_t cornerCount = indexCount - indexCount % 3;
+				cornerIndices.reallocMemory( cornerCount );
+				for ( unsigned int i = 0; i < cornerCount; ++i )
+					cornerIndices.append( i );
+				break;
+			}
+		case COLLADAFW::MeshPrimitive::POLYGONS:
+		case COLLADAFW::MeshPrimitive::POLYLIST:
+			{
+				const COLLADAFW::Polygons::VertexCountArray& faceVertexCountArray = ((const COLLADAFW::Polygons*)meshPrimitive)->getGroupedVerticesVertexCountArray();
+				unsigned int firstIndex = 0;
+				for ( size_t k = 0, count = faceVertexCountArray.getCount(); k < count; ++k )
+				{
+					int faceVertexCount = faceVertexCountArray[k];
+					if ( faceVertexCount < 0 )
+					{
+						// a hole of the previous polygon
+						firstIndex += (unsigned int)(-faceVertexCount);
+						continue;
+					}
+					if ( firstIndex + faceVertexCount > indexCount )
+						break;
+					for ( int i = 2; i < faceVertexCount; ++i )
+					{
+						cornerIndices.append( firstIndex );
+						cornerIndices.append( firstIndex + i - 1 );
+						cornerIndices.append( firstIndex + i );
+					}
+					firstIndex += (unsigned int)faceVertexCount;
+				}
+				break;
+			}
+		case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
+			{
+				const COLLADAFW::Trifans::VertexCountArray& faceVertexCountArray = ((const COLLADAFW::Trifans*)meshPrimitive)->getGroupedVerticesVertexCountArray();
+				unsigned int firstIndex = 0;
+				for ( size_t k = 0, count = faceVertexCountArray.getCount(); k < count; ++k )
+				{
+					unsigned int faceVertexCount = faceVertexCountArray[k];
+					if ( firstIndex + faceVertexCount > indexCount )
+						break;
+					for ( unsigned int i = 2; i < faceVertexCount; ++i )
+					{
+						cornerIndices.append( firstIndex );
+						cornerIndices.append( firstIndex + i - 1 );
+						cornerIndices.append( firstIndex + i );
+					}
+					firstIndex += faceVertexCount;
+				}
+				break;
+			}
+		case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
+			{
+				const COLLADAFW::Tristrips::VertexCountArray& faceVertexCountArray = ((const COLLADAFW::Tristrips*)meshPrimitive)->getGroupedVerticesVertexCountArray();
+				unsigned int firstIndex = 0;
+				for ( size_t k = 0, count = faceVertexCountArray.getCount(); k < count; ++k )
+				{
+					unsigned int faceVertexCount = faceVertexCountArray[k];
+					if ( firstIndex + faceVertexCount > indexCount )
+						break;
+					for ( unsigned int i = 2; i < faceVertexCount; ++i )
+					{
+						// every second triangle of a strip has reversed winding
+						unsigned int first = firstIndex + i - 2;
+						unsigned int second = firstIndex + i - 1;
+						if ( (i % 2) == 1 )
+							std::swap( first, second );
+						cornerIndices.append( first );
+						cornerIndices.append( second );
+						cornerIndices.append( firstIndex + i );
+					}
+					firstIndex += faceVertexCount;
+				}
+				break;
+			}
+		default:
+			break;
+		}
+	}
+
+	//------------------------------
+	static float calculateVertexScore( int cachePosition, unsigned int remainingTrianglesCount )
+	{
+		if ( remainingTrianglesCount == 0 )
+			return -1.0f;
+
+		float score = 0;
+		if ( cachePosition >= 0 )
+		{
+			if ( cachePosition < 3 )
+			{
+				// the vertices of the last triangle get a fixed score, to not favor one of its edges
+				score = LAST_TRIANGLE_SCORE;
+			}
+			else
+			{
+				const float scaler = 1.0f / ( VERTEX_CACHE_SIZE - 3 );
+				score = powf( 1.0f - ( cachePosition - 3 ) * scaler, CACHE_DECAY_POWER );
+			}
+		}
+
+		// boost vertices with few remaining triangles, to get rid of lone vertices early
+		score += VALENCE_BOOST_SCALE * powf( (float)remainingTrianglesCount, -VALENCE_BOOST_POWER );
+		return score;
+	}
+
+	//------------------------------
+	void MeshWriter::optimizeVertexCacheOrder( uint32* indices, size_t indexCount, size_t vertexCount )
+	{
+		size_t triangleCount = indexCount / 3;
+		if ( triangleCount < 2 )
+			return;
+
+		// triangles of each vertex, that have not been emitted yet
+		std::vector<unsigned int> remainingTrianglesCounts( vertexCount, 0 );
+		for ( size_t i = 0; i < triangleCount * 3; ++i )
+			remainingTrianglesCounts[indices[i]]++;
+
+		std::vector<size_t> vertexTrianglesOffsets( vertexCount + 1 );
+		vertexTrianglesOffsets[0] = 0;
+		for ( size_t v = 0; v < vertexCount; ++v )
+			vertexTrianglesOffsets[v + 1] = vertexTrianglesOffsets[v] + remainingTrianglesCounts[v];
+
+		std::vector<unsigned int> vertexTriangles( triangleCount * 3 );
+		std::fill( remainingTrianglesCounts.begin(), remainingTrianglesCounts.end(), 0 );
+		for ( size_t t = 0; t < triangleCount; ++t )
+		{
+			for ( size_t k = 0; k < 3; ++k )
+			{
+				uint32 v = indices[3 * t + k];
+				vertexTriangles[vertexTrianglesOffsets[v] + remainingTrianglesCounts[v]++] = (unsigned int)t;
+			}
+		}
+
+		std::vector<float> vertexScores( vertexCount );
+		for ( size_t v = 0; v < vertexCount; ++v )
+			vertexScores[v] = calculateVertexScore( -1, remainingTrianglesCounts[v] );
+
+		std::vector<bool> triangleEmitted( triangleCount, false );
+		std::vector<uint32> orderedIndices;
+		orderedIndices.reserve( triangleCount * 3 );
+
+		// start with the best triangle of the whole mesh
+		size_t bestTriangle = 0;
+		float bestScore = -1.0f;
+		for ( size_t t = 0; t < triangleCount; ++t )
+		{
+			const uint32* triangle = indices + 3 * t;
+			float score = vertexScores[triangle[0]] + vertexScores[triangle[1]] + vertexScores[triangle[2]];
+			if ( score > bestScore )
+			{
+				bestScore = score;
+				bestTriangle = t;
+			}
+		}
+
+		uint32 cache[VERTEX_CACHE_SIZE + 3];
+		size_t cacheCount = 0;
+		size_t nextUnemittedTriangle = 0;
+
+		for ( size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount )
+		{
+			const uint32* triangle = indices + 3 * bestTriangle;
+			triangleEmitted[bestTriangle] = true;
+
+			uint32 newCache[VERTEX_CACHE_SIZE + 3];
+			size_t newCacheCount = 0;
+			for ( size_t k = 0; k < 3; ++k )
+			{
+				uint32 v = triangle[k];
+				orderedIndices.push_back( v );
+
+				// remove the triangle from the remaining triangles of the vertex
+				unsigned int* vertexTrianglesBegin = &vertexTriangles[vertexTrianglesOffsets[v]];
+				unsigned int& remainingCount = remainingTrianglesCounts[v];
+				for ( unsigned int i = 0; i < remainingCount; ++i )
+				{
+					if ( vertexTrianglesBegin[i] == bestTriangle )
+					{
+						vertexTrianglesBegin[i] = vertexTrianglesBegin[remainingCount - 1];
+						--remainingCount;
+						break;
+					}
+				}
+
+				if ( std::find( newCache, newCache + newCacheCount, v ) == newCache + newCacheCount )
+					newCache[newCacheCount++] = v;
+			}
+
+			// the vertices of the triangle move to the front of the cache, the others move back
+			size_t triangleVerticesCount = newCacheCount;
+			for ( size_t i = 0; i < cacheCount; ++i )
+			{
+				if ( std::find( newCache, newCache + triangleVerticesCount, cache[i] ) == newCache + triangleVerticesCount )
+					newCache[newCacheCount++] = cache[i];
+			}
+
+			for ( size_t i = 0; i < newCacheCount; ++i )
+			{
+				uint32 v = newCache[i];
+				int cachePosition = ( i < (size_t)VERTEX_CACHE_SIZE ) ? (int)i : -1;
+				vertexScores[v] = calculateVertexScore( cachePosition, remainingTrianglesCounts[v] );
+			}
+
+			cacheCount = std::min( newCacheCount, (size_t)VERTEX_CACHE_SIZE );
+			std::copy( newCache, newCache + cacheCount, cache );
+
+			// continue with the best triangle that uses a vertex in the cache
+			bestScore = -1.0f;
+			bool found = false;
+			for ( size_t i = 0; i < cacheCount; ++i )
+			{
+				uint32 v = cache[i];
+				const unsigned int* vertexTrianglesBegin = &vertexTriangles[vertexTrianglesOffsets[v]];
+				for ( unsigned int j = 0, count = remainingTrianglesCounts[v]; j < count; ++j )
+				{
+					unsigned int t = vertexTrianglesBegin[j];
+					const uint32* candidate = indices + 3 * t;
+					float score = vertexScores[candidate[0]] + vertexScores[candidate[1]] + vertexScores[candidate[2]];
+					if ( score > bestScore )
+					{
+						bestScore = score;
+						bestTriangle = t;
+						found = true;
+					}
+				}
+			}
+
+			if ( !found )
+			{
+				// no triangle touches the cache, take the next one not emitted yet
+				while ( (nextUnemittedTriangle < triangleCount) && triangleEmitted[nextUnemittedTriangle] )
+					++nextUnemittedTriangle;
+				bestTriangle = nextUnemittedTriangle;
+			}
+		}
+
+		std::copy( orderedIndices.begin(), orderedIndices.end(), indices );
+	}
+
 	//------------------------------
 	void MeshWriter::writeSubMesh( COLLADAFW::MeshPrimitive* meshPrimitive, const COLLADABU::Math::Matrix4& matrix )
 	{
@@ -339,34 +722,30 @@ namespace DAE2Ogre
 		assert( !mHasNormals || (positionIndicesCount == normalIndicesCount));
 		assert( !mHasUVCoords || (positionIndicesCount == uvIndicesCount));
 
-		switch (meshPrimitive->getPrimitiveType())
-		{
-		case COLLADAFW::MeshPrimitive::TRIANGLES:
-			{
-				const COLLADAFW::Triangles* triangles = (const COLLADAFW::Triangles*) meshPrimitive;
-				numIndices = (int)positionIndicesCount;
+		// all primitives are written as triangle lists
+		triangulate( meshPrimitive, mCornerIndices );
+		numIndices = (int)mCornerIndices.getCount();
+		initializeTupleIndexTable( mCornerIndices.getCount() );
 
-				for ( int j = 0; j < numIndices; ++j )
-				{
-					unsigned int positionIndex = positionIndices[j];
+		for ( int i = 0; i < numIndices; ++i )
+		{
+			unsigned int j = mCornerIndices[i];
+			unsigned int positionIndex = positionIndices[j];
 
-					unsigned int normalIndex = 0;
-					if ( mHasNormals )
-						normalIndex = normalIndices[j];
+			unsigned int normalIndex = 0;
+			if ( mHasNormals )
+				normalIndex = normalIndices[j];
 
-					unsigned int uvIndex = 0;
-					if ( mHasUVCoords )
-						uvIndex = (*uvIndices)[j];
+			unsigned int uvIndex = 0;
+			if ( mHasUVCoords )
+				uvIndex = (*uvIndices)[j];
 
-					Tuple tuple( positionIndex, normalIndex, uvIndex, 0);
-					addTupleIndex(tuple);
-				}
-			}
-			break;
-		default:
-			break;
+			Tuple tuple( positionIndex, normalIndex, uvIndex, 0);
+			addTupleIndex(tuple);
 		}
 
+		optimizeVertexCacheOrder( mOgreIndices.getData(), mOgreIndices.getCount(), (size_t)mNextTupleIndex );
+
 		// Header
 		size_t subMeshSize = calcSubMeshSize( numIndices, subMeshName );
 		writeChunkHeader( Ogre::M_SUBMESH, subMeshSize );
@@ -398,7 +777,7 @@ namespace DAE2Ogre
 		// M_GEOMETRY stream (Optional: present only if useSharedVertices = false)
 		writeGeometry( );
 
-		writeSubMeshOperation( meshPrimitive->getPrimitiveType() );
+		writeSubMeshOperation( COLLADAFW::MeshPrimitive::TRIANGLES );
 
 		calculateMeshBounds();
 
@@ -408,7 +787,7 @@ namespace DAE2Ogre
 		mOgreUVCoordinates.clear();
 		mOgreColors.clear();
 		mOgreIndices.clear();
-		mTupleMap.clear();
+		mTuples.clear();
 	}
 
 	//-----------------------------------------------------------------------
@@ -0,0 +1,159 @@
+/*
+Copyright (c) 2009 NetAllied Systems GmbH
+
+This file is part of dae2ogre.
+
+Licensed under the MIT Open Source License, 
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "DAE2OgreStableHeaders.h"
+#include "DAE2OgreMeshWriterPool.h"
+#include "DAE2OgreMeshWriter.h"
+
+#include "COLLADAFWMesh.h"
+
+#include <functional>
+
+namespace DAE2Ogre
+{
+
+	/** Number of jobs per worker thread, that may be pending before adding a mesh blocks.*/
+	static const size_t PENDING_JOBS_PER_THREAD = 4;
+
+	/** Size of the chunks the temporary files are copied in.*/
+	static const size_t COPY_BUFFER_SIZE = 64*1024;
+
+
+	//------------------------------
+	MeshWriterPool::MeshWriterPool( OgreWriter* ogreWriter, size_t threadCount )
+		: BaseWriter(ogreWriter)
+		, mMaxPendingJobsCount(0)
+		, mSucceeded(true)
+		, mThreadPool(threadCount)
+	{
+		mMaxPendingJobsCount = PENDING_JOBS_PER_THREAD * mThreadPool.getThreadCount();
+	}
+
+	//------------------------------
+	MeshWriterPool::~MeshWriterPool()
+	{
+		mThreadPool.waitForAllTasks();
+
+		JobQueue::const_iterator it = mJobs.begin();
+		for ( ; it != mJobs.end(); ++it )
+		{
+			deleteJob( *it );
+		}
+	}
+
+	//------------------------------
+	bool MeshWriterPool::addMesh( const COLLADAFW::Mesh* mesh )
+	{
+		// the loader deletes the mesh, once writeGeometry() returns
+		Job* job = new Job();
+		job->mesh = MeshWriter::createMeshCopy( mesh );
+		job->file = 0;
+		job->finished = false;
+		job->succeeded = false;
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mJobs.push_back( job );
+		}
+		mThreadPool.addTask( std::bind( &MeshWriterPool::writeMesh, this, job ) );
+
+		return copyFinishedJobs( mMaxPendingJobsCount );
+	}
+
+	//------------------------------
+	bool MeshWriterPool::finish()
+	{
+		return copyFinishedJobs( 0 );
+	}
+
+	//------------------------------
+	void MeshWriterPool::writeMesh( Job* job )
+	{
+		// the file is written outside the lock, nobody else accesses it before finished is set
+		bool succeeded = false;
+		FILE* file = tmpfile();
+		if ( file )
+		{
+			MeshWriter meshWriter( getOgreWriter(), job->mesh );
+			succeeded = meshWriter.write( file );
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			job->file = file;
+			job->succeeded = succeeded;
+			job->finished = true;
+		}
+		mJobFinished.notify_all();
+	}
+
+	//------------------------------
+	bool MeshWriterPool::copyFinishedJobs( size_t maxPendingJobsCount )
+	{
+		for ( ;; )
+		{
+			Job* job = 0;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				if ( mJobs.empty() )
+					break;
+
+				job = mJobs.front();
+				if ( !job->finished )
+				{
+					if ( mJobs.size() <= maxPendingJobsCount )
+						break;
+
+					while ( !job->finished )
+						mJobFinished.wait(lock);
+				}
+				mJobs.pop_front();
+			}
+
+			if ( !job->succeeded || !copyToOutputFile(job) )
+				mSucceeded = false;
+			deleteJob( job );
+		}
+		return mSucceeded;
+	}
+
+	//------------------------------
+	bool MeshWriterPool::copyToOutputFile( Job* job )
+	{
+		// each mesh replaces the output file, as in MeshWriter::write()
+		const String path = getOutputFile().toNativePath();
+		FILE* outputFile = fopen( path.c_str(), "wb" );
+		if ( !outputFile )
+			return false;
+
+		rewind( job->file );
+		char buffer[COPY_BUFFER_SIZE];
+		bool success = true;
+		size_t readBytes;
+		while ( success && (readBytes = fread( buffer, 1, COPY_BUFFER_SIZE, job->file )) > 0 )
+		{
+			success = (fwrite( buffer, 1, readBytes, outputFile ) == readBytes);
+		}
+		success = success && (ferror( job->file ) == 0);
+
+		fclose( outputFile );
+		return success;
+	}
+
+	//------------------------------
+	void MeshWriterPool::deleteJob( Job* job )
+	{
+		if ( job->file )
+			fclose( job->file );
+		delete job->mesh;
+		delete job;
+	}
+
+} // namespace DAE2Ogre
@@ -11,6 +11,7 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "DAE2OgreOgreWriter.h"
 #include "DAE2OgreMeshWriter.h"
+#include "DAE2OgreMeshWriterPool.h"
 #include "DAE2OgreSceneGraphWriter.h"
 
 #include "COLLADASaxFWLLoader.h"
@@ -35,12 +36,15 @@ namespace DAE2Ogre
 		, mOutputFile(outputFile)
 		, mCurrentRun(SCENEGRAPH_RUN)
 	, mVisualScene(0)
+		, mThreadCount(1)
+		, mMeshWriterPool(0)
 	{
 	}
 
 	//--------------------------------------------------------------------
 	OgreWriter::~OgreWriter()
 	{
+		delete mMeshWriterPool;
 		delete mVisualScene;
 	}
 
@@ -84,10 +88,19 @@ namespace DAE2Ogre
 
 		// load and write geometries
 		mCurrentRun = GEOMETRY_RUN;
-		if ( !root.loadDocument(mInputFile.toNativePath()) )
-			return false;
+		if ( mThreadCount != 1 )
+			mMeshWriterPool = new MeshWriterPool(this, mThreadCount);
 
-		return true;
+		bool success = root.loadDocument(mInputFile.toNativePath());
+
+		if ( mMeshWriterPool )
+		{
+			success = mMeshWriterPool->finish() && success;
+			delete mMeshWriterPool;
+			mMeshWriterPool = 0;
+		}
+
+		return success;
 	}
 
 	//--------------------------------------------------------------------
@@ -150,6 +163,9 @@ namespace DAE2Ogre
 		if ( geometry->getType() != COLLADAFW::Geometry::GEO_TYPE_MESH )
 			return true;
 	
+		if ( mMeshWriterPool )
+			return mMeshWriterPool->addMesh( (COLLADAFW::Mesh*)geometry );
+
 		MeshWriter meshWriter( this, (COLLADAFW::Mesh*)geometry );
 		return meshWriter.write();
 	}
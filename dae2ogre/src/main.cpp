@@ -12,6 +12,8 @@ http://www.opensource.org/licenses/mit-license.php
 #include "DAE2OgreOgreWriter.h"
 
 #include <iostream>
+#include <stdlib.h>
+#include <string.h>
 #include "COLLADABUURI.h"
 
 #if defined(WIN32) && !defined(NDEBUG)
@@ -32,6 +34,19 @@ int main(int argc, char* argv[])
 		DAE2Ogre::String outputFile = argv[2];
 
 		DAE2Ogre::OgreWriter writer( COLLADABU::URI::nativePathToUri(inputFile), COLLADABU::URI::nativePathToUri(outputFile));
+
+		for ( int i = 3; i < argc; ++i )
+		{
+			if ( (strcmp(argv[i], "-threads") == 0) && (i + 1 < argc) )
+			{
+				writer.setThreadCount( (size_t)atol(argv[++i]) );
+			}
+			else
+			{
+				std::cout << "Unknown option " << argv[i] << std::endl;
+			}
+		}
+
 		writer.write();
 
 	
@@ -40,6 +55,7 @@ int main(int argc, char* argv[])
 	{
 		std::cout << "You must specify an input and output file name" << std::endl;
 
-		std::cout << "Usage: dae2ogre <inputfilename> <outputfilename>" << std::endl;
+		std::cout << "Usage: dae2ogre <inputfilename> <outputfilename> [-threads <count>]" << std::endl;
+		std::cout << "  -threads      Number of threads the meshes are converted by, 0 for one per core" << std::endl;
 	}
 }
\ No newline at end of file